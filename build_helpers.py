@@ -0,0 +1,55 @@
+"""
+Build helpers for the nipy extensions.
+
+This module is imported by setup.py.
+"""
+from os.path import join as pjoin, dirname, exists
+
+from distutils import log
+from distutils.dep_util import newer_group
+from distutils.errors import DistutilsError
+
+from numpy.distutils.misc_util import appendpath
+
+
+def generate_a_pyrex_source(self, base, ext_name, source, extension):
+    ''' Monkey patch for numpy build_src.build_src method
+
+    Compiles the .pyx sources of the extensions with Cython instead of
+    Pyrex. The C files generated by Cython are not kept under version
+    control, so that they cannot be out of date with respect to their
+    .pyx sources. If Cython is not installed, a C file lying next to the
+    .pyx source is used; otherwise, compilation fails.
+    '''
+    if self.inplace:
+        target_dir = dirname(base)
+    else:
+        target_dir = appendpath(self.build_src, dirname(base))
+    target_file = pjoin(target_dir, ext_name + '.c')
+    depends = [source] + extension.depends
+    # Look for the included .pxi files in the include directories of
+    # the extension and of the package
+    incl_dirs = [dirname(source)] + extension.include_dirs
+    dist_incl_dirs = self.distribution.include_dirs
+    if not dist_incl_dirs is None:
+        incl_dirs += dist_incl_dirs
+    try:
+        import Cython.Compiler.Main
+    except ImportError:
+        shipped_file = base + '.c'
+        if exists(shipped_file):
+            log.warn('Cython is not installed, using %s' % shipped_file)
+            return shipped_file
+        raise DistutilsError('Cython is required to compile %r' % source)
+    if self.force or newer_group(depends, target_file, 'newer'):
+        log.info('cythonc:> %s' % target_file)
+        self.mkpath(target_dir)
+        options = Cython.Compiler.Main.CompilationOptions(
+            defaults=Cython.Compiler.Main.default_options,
+            include_path=incl_dirs,
+            output_file=target_file)
+        cython_result = Cython.Compiler.Main.compile(source, options=options)
+        if cython_result.num_errors != 0:
+            raise DistutilsError('%d errors while compiling %r with Cython'
+                                 % (cython_result.num_errors, source))
+    return target_file
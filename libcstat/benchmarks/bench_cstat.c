@@ -0,0 +1,396 @@
+/*
+   Micro-benchmarks of the libcstat kernels.
+
+   Usage: bench_cstat [-r repeat] [-t nthreads] [kernel ...]
+
+   Each kernel runs on a fixed problem of realistic size, built from
+   a fixed random seed, so that the numbers can be compared across
+   releases. Only the kernel call is timed, and the best of \a repeat
+   runs (default 5) is reported. Kernels that take a number of threads
+   use \a nthreads (default 1).
+
+   The output is one header line followed by one line per kernel,
+   with tab-separated fields:
+
+     kernel   name of the kernel
+     size     problem size
+     items    work items processed by a run
+     unit     what an item is
+     seconds  best run time
+     rate     items per second
+
+   Build and run with `make bench-cstat` from the top directory.
+*/
+
+#include "fff_base.h"
+#include "fff_array.h"
+#include "fff_iconic_match.h"
+#include "fff_cubic_spline.h"
+#include "fff_onesample_stat.h"
+#include "fff_twosample_stat.h"
+#include "fff_glm_kalman.h"
+#include "fff_GMM.h"
+#include "fff_clustering.h"
+#include "fff_graphlib.h"
+#include "fff_field.h"
+#include "randomkit.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+
+#define BENCH_SEED 1
+
+
+typedef struct {
+  int nthreads;
+  rk_state rng;
+
+  /* Images */
+  fff_array* imI;
+  fff_array* imJ;
+  fff_array* coef;
+  fff_imatch* imatch;
+
+  /* Voxel-wise data */
+  fff_matrix* Y;
+  fff_matrix* X;
+  fff_vector* y;
+
+  /* Graphs and fields */
+  fff_graph* G;
+  fff_vector* field;
+
+  /* Clustering */
+  fff_matrix* Centers;
+  fff_matrix* Precision;
+  fff_vector* Weights;
+  fff_array* Label;
+  fff_vector* cost;
+} bench_data;
+
+typedef struct {
+  const char* name;
+  const char* size;
+  const char* unit;
+  void (*setup)(bench_data*);
+  double (*run)(bench_data*);  /* returns the number of items */
+} bench_kernel;
+
+
+static fff_array* _bench_image(bench_data* B, size_t dx, size_t dy, size_t dz, double max)
+{
+  fff_array* im = fff_array_new3d(FFF_DOUBLE, dx, dy, dz);
+  double* buf = (double*)im->data;
+  size_t i;
+
+  for (i=0; i<dx*dy*dz; i++)
+    buf[i] = max*rk_double(&(B->rng));
+  return im;
+}
+
+static fff_matrix* _bench_gauss(bench_data* B, size_t n, size_t p)
+{
+  fff_matrix* X = fff_matrix_new(n, p);
+  size_t i;
+
+  for (i=0; i<n*p; i++)
+    X->data[i] = rk_gauss(&(B->rng));
+  return X;
+}
+
+/* Coordinates of a dx*dy*dz grid, as expected by fff_graph_grid_six */
+static long* _bench_grid(long dx, long dy, long dz)
+{
+  long N = dx*dy*dz, i;
+  long* xyz = (long*)malloc(3*N*sizeof(long));
+
+  for (i=0; i<N; i++) {
+    xyz[i] = i/(dy*dz);
+    xyz[N+i] = (i/dz)%dy;
+    xyz[2*N+i] = i%dz;
+  }
+  return xyz;
+}
+
+
+/* Joint histogram of a 128x128x64 source (64 bins) and a slightly
+   shifted target, with PV interpolation */
+static void _bench_joint_hist_setup(bench_data* B)
+{
+  B->imI = _bench_image(B, 128, 128, 64, 1000.0);
+  B->imJ = _bench_image(B, 128, 128, 64, 1000.0);
+  B->imatch = fff_imatch_new(B->imI, B->imJ, 0.0, 0.0, 64, 64);
+}
+
+static double _bench_joint_hist_run(bench_data* B)
+{
+  double Tvox[16] = {1, 0, 0, .3, 0, 1, 0, -.2, 0, 0, 1, .1, 0, 0, 0, 1};
+  fff_imatch_joint_hist_mt(B->imatch->H, B->imatch->clampI, B->imatch->clampJ,
+			   B->imatch->imI, B->imatch->imJ_padded, Tvox, 0, B->nthreads);
+  return (double)(128*128*64);
+}
+
+/* Cubic spline transform of a 128x128x64 image */
+static void _bench_spline_transform_setup(bench_data* B)
+{
+  B->imI = _bench_image(B, 128, 128, 64, 1.0);
+  B->coef = fff_array_new3d(FFF_DOUBLE, 128, 128, 64);
+}
+
+static double _bench_spline_transform_run(bench_data* B)
+{
+  fff_cubic_spline_transform_image_mt(B->coef, B->imI, B->nthreads);
+  return (double)(128*128*64);
+}
+
+/* Spline resampling of a 64x64x64 image at 10^6 random points */
+static void _bench_spline_sample_setup(bench_data* B)
+{
+  fff_array* im = _bench_image(B, 64, 64, 64, 1.0);
+  size_t i;
+
+  B->coef = fff_array_new3d(FFF_DOUBLE, 64, 64, 64);
+  fff_cubic_spline_transform_image(B->coef, im, NULL);
+  fff_array_delete(im);
+  B->X = fff_matrix_new(1000000, 3);
+  for (i=0; i<3*1000000; i++)
+    B->X->data[i] = 63.0*rk_double(&(B->rng));
+}
+
+static double _bench_spline_sample_run(bench_data* B)
+{
+  size_t i;
+  double* x = B->X->data;
+  double s = 0.0;
+
+  for (i=0; i<B->X->size1; i++, x+=3)
+    s += fff_cubic_spline_sample_image(x[0], x[1], x[2], 0, B->coef);
+  if (s != s)
+    fprintf(stderr, "spline_sample: NaN\n");
+  return (double)B->X->size1;
+}
+
+/* Student statistics of 100000 voxels, with 20 subjects in one
+   group or two groups of 10 */
+static void _bench_stat_setup(bench_data* B)
+{
+  B->Y = _bench_gauss(B, 100000, 20);
+}
+
+static double _bench_onesample_run(bench_data* B)
+{
+  fff_onesample_stat* stat = fff_onesample_stat_new(20, FFF_ONESAMPLE_STUDENT, 0.0);
+  fff_vector y;
+  size_t i;
+
+  for (i=0; i<B->Y->size1; i++) {
+    y = fff_matrix_row(B->Y, i);
+    fff_onesample_stat_eval(stat, &y);
+  }
+  fff_onesample_stat_delete(stat);
+  return (double)B->Y->size1;
+}
+
+static double _bench_twosample_run(bench_data* B)
+{
+  fff_twosample_stat* stat = fff_twosample_stat_new(10, 10, FFF_TWOSAMPLE_STUDENT);
+  fff_vector y;
+  size_t i;
+
+  for (i=0; i<B->Y->size1; i++) {
+    y = fff_matrix_row(B->Y, i);
+    fff_twosample_stat_eval(stat, &y);
+  }
+  fff_twosample_stat_delete(stat);
+  return (double)B->Y->size1;
+}
+
+/* Kalman fit of 10000 voxels with 200 scans and 10 regressors */
+static void _bench_kalman_setup(bench_data* B)
+{
+  B->Y = _bench_gauss(B, 10000, 200);
+  B->X = _bench_gauss(B, 200, 10);
+}
+
+static double _bench_kalman_run(bench_data* B)
+{
+  fff_glm_KF* kf = fff_glm_KF_new(B->X->size2);
+  fff_vector y;
+  size_t i;
+
+  for (i=0; i<B->Y->size1; i++) {
+    y = fff_matrix_row(B->Y, i);
+    fff_glm_KF_fit(kf, &y, B->X);
+  }
+  fff_glm_KF_delete(kf);
+  return (double)B->Y->size1;
+}
+
+/* 20 EM iterations of a 10-class full-covariance GMM on 20000
+   points in dimension 3 */
+static void _bench_gmm_setup(bench_data* B)
+{
+  size_t i;
+
+  B->X = _bench_gauss(B, 20000, 3);
+  B->Centers = fff_matrix_new(10, 3);
+  B->Precision = fff_matrix_new(10, 9);
+  B->Weights = fff_vector_new(10);
+  B->Label = fff_array_new1d(FFF_LONG, 20000);
+  for (i=0; i<20000; i++)
+    fff_array_set1d(B->Label, i, i%10);
+}
+
+static double _bench_gmm_run(bench_data* B)
+{
+  fff_clustering_gmm(B->Centers, B->Precision, B->Weights, B->Label, B->X,
+		     20, FFF_NEGINF, 20000, 0, B->nthreads);
+  return 20.0*20000;
+}
+
+/* Ward clustering of 4000 points in dimension 3 */
+static void _bench_ward_setup(bench_data* B)
+{
+  B->X = _bench_gauss(B, 4000, 3);
+  B->Label = fff_array_new1d(FFF_LONG, 2*4000-1);
+  B->cost = fff_vector_new(2*4000-1);
+}
+
+static double _bench_ward_run(bench_data* B)
+{
+  fff_clustering_ward(B->Label, B->cost, B->X);
+  return 4000.0;
+}
+
+/* Dijkstra from one seed on a 64x64x64 26-neighbour grid */
+static void _bench_dijkstra_setup(bench_data* B)
+{
+  long* xyz = _bench_grid(64, 64, 64);
+
+  fff_graph_grid_twenty_six(&(B->G), xyz, 64*64*64);
+  free(xyz);
+  B->y = fff_vector_new(64*64*64);
+}
+
+static double _bench_dijkstra_run(bench_data* B)
+{
+  fff_graph_Dijkstra(B->y->data, B->G, 0, FFF_POSINF);
+  return (double)B->G->V;
+}
+
+/* Dilation of radius 3 of a random field on a 64x64x64 implicit
+   26-neighbour grid */
+static void _bench_dilation_setup(bench_data* B)
+{
+  long* xyz = _bench_grid(64, 64, 64);
+  size_t i;
+
+  fff_graph_grid_stencil(&(B->G), xyz, 64*64*64, 26);
+  free(xyz);
+  B->y = fff_vector_new(64*64*64);
+  for (i=0; i<B->y->size; i++)
+    B->y->data[i] = rk_double(&(B->rng));
+  B->field = fff_vector_new(64*64*64);
+}
+
+static double _bench_dilation_run(bench_data* B)
+{
+  fff_vector_memcpy(B->field, B->y);
+  fff_field_dilation(B->field, B->G, 3);
+  return (double)B->G->V;
+}
+
+
+static const bench_kernel _bench_kernels[] = {
+  {"joint_hist", "128x128x64", "voxels", &_bench_joint_hist_setup, &_bench_joint_hist_run},
+  {"spline_transform", "128x128x64", "voxels", &_bench_spline_transform_setup, &_bench_spline_transform_run},
+  {"spline_sample", "64x64x64", "points", &_bench_spline_sample_setup, &_bench_spline_sample_run},
+  {"onesample_student", "100000x20", "voxels", &_bench_stat_setup, &_bench_onesample_run},
+  {"twosample_student", "100000x(10+10)", "voxels", &_bench_stat_setup, &_bench_twosample_run},
+  {"glm_kalman", "10000x200x10", "voxels", &_bench_kalman_setup, &_bench_kalman_run},
+  {"gmm_em", "20000x3,k=10", "point-iterations", &_bench_gmm_setup, &_bench_gmm_run},
+  {"ward", "4000x3", "points", &_bench_ward_setup, &_bench_ward_run},
+  {"dijkstra", "64x64x64,26", "vertices", &_bench_dijkstra_setup, &_bench_dijkstra_run},
+  {"field_dilation", "64x64x64,26,r=3", "vertices", &_bench_dilation_setup, &_bench_dilation_run},
+  {NULL, NULL, NULL, NULL, NULL}
+};
+
+
+/* The fff destructors do not accept NULL */
+#define BENCH_DELETE(func, obj) if ((obj) != NULL) func(obj)
+
+static void _bench_data_clear(bench_data* B)
+{
+  BENCH_DELETE(fff_imatch_delete, B->imatch);
+  BENCH_DELETE(fff_array_delete, B->imI);
+  BENCH_DELETE(fff_array_delete, B->imJ);
+  BENCH_DELETE(fff_array_delete, B->coef);
+  BENCH_DELETE(fff_matrix_delete, B->Y);
+  BENCH_DELETE(fff_matrix_delete, B->X);
+  BENCH_DELETE(fff_vector_delete, B->y);
+  BENCH_DELETE(fff_graph_delete, B->G);
+  BENCH_DELETE(fff_vector_delete, B->field);
+  BENCH_DELETE(fff_matrix_delete, B->Centers);
+  BENCH_DELETE(fff_matrix_delete, B->Precision);
+  BENCH_DELETE(fff_vector_delete, B->Weights);
+  BENCH_DELETE(fff_array_delete, B->Label);
+  BENCH_DELETE(fff_vector_delete, B->cost);
+}
+
+static int _bench_selected(const char* name, int argc, char** argv, int first)
+{
+  int i;
+
+  if (first >= argc)
+    return 1;
+  for (i=first; i<argc; i++)
+    if (strcmp(argv[i], name) == 0)
+      return 1;
+  return 0;
+}
+
+int main(int argc, char** argv)
+{
+  const bench_kernel* K;
+  bench_data B;
+  int repeat = 5, nthreads = 1, first = 1, r;
+  double t0, t, best, items = 0.0;
+
+  while ((first+1 < argc) && (argv[first][0] == '-')) {
+    if (strcmp(argv[first], "-r") == 0)
+      repeat = FFF_MAX(atoi(argv[first+1]), 1);
+    else if (strcmp(argv[first], "-t") == 0)
+      nthreads = atoi(argv[first+1]);
+    else {
+      fprintf(stderr, "usage: %s [-r repeat] [-t nthreads] [kernel ...]\n", argv[0]);
+      return 1;
+    }
+    first += 2;
+  }
+
+  printf("kernel\tsize\titems\tunit\tseconds\trate\n");
+  for (K=_bench_kernels; K->name!=NULL; K++) {
+    if (!_bench_selected(K->name, argc, argv, first))
+      continue;
+    memset((void*)&B, 0, sizeof(bench_data));
+    B.nthreads = nthreads;
+    rk_seed(BENCH_SEED, &(B.rng));
+    (*K->setup)(&B);
+    best = FFF_POSINF;
+    for (r=0; r<repeat; r++) {
+      t0 = fff_profile_clock();
+      items = (*K->run)(&B);
+      t = fff_profile_clock() - t0;
+      if (t < best)
+	best = t;
+    }
+    printf("%s\t%s\t%.0f\t%s\t%.6f\t%.6g\n", K->name, K->size, items, K->unit, best,
+	   (best > 0) ? items/best : FFF_POSINF);
+    fflush(stdout);
+    _bench_data_clear(&B);
+  }
+
+  return 0;
+}
@@ -1,7 +1,10 @@
 #include "fff_BPmatch.h"
+#include "fff_threads.h"
 #include <stdlib.h>
 #include <stdio.h>
 #include <math.h>
+#include <string.h>
+#include <errno.h>
 
 
 static int  _fff_swapindex(fff_array *idx, const fff_graph *G);
@@ -248,3 +251,435 @@ extern int fff_BPmatch(fff_matrix * source, fff_matrix * target, fff_matrix * ad
   return(1);
   
 }
+
+
+/**********************************************************************
+ ************************ sparse BP matching ***************************
+ **********************************************************************/
+
+/* Sparse BP matching: the beliefs of source i are only stored for its
+   candidate targets cand[cs[i]..cs[i+1]-1], and the messages of edge
+   e=(A,B) only for the candidates of B; the transition of edge e is
+   the |C_A|*|C_B| block trans[to[e]..]. Each sweep is split across
+   threads, by edge for the messages and by source for the beliefs. */
+typedef struct {
+  const fff_matrix* source;
+  const fff_matrix* target;
+  double sqs;
+  double dth;
+  double damping;
+  double eps;
+  int stage;
+  int first;          /* first sweep: nothing to damp */
+  long n1;
+  long E;
+  long* cs;           /* candidates of each source (n1+1) */
+  long* cand;
+  double* binit;      /* prior and current beliefs (cs[n1]) */
+  double* belief;
+  double* diff;       /* squared belief change of each source (n1) */
+  long* ea;           /* edges (E) */
+  long* eb;
+  long* rev;          /* reverse edge, -1 if none (E) */
+  long* is;           /* incoming edges of each source (n1+1) */
+  long* ie;
+  long* to;           /* offsets of the transitions (E) */
+  long* mo;           /* offsets of the messages (E), over C_B */
+  long* po;           /* offsets of the outgoing messages (E), over C_A */
+  double* trans;
+  double* msg;
+  double* pmsg;
+  long maxc;          /* largest candidate set */
+  double* buf;        /* work buffers of the threads (maxc each) */
+} _fff_BPmatch_job;
+
+enum {
+  _FFF_BP_COUNT,
+  _FFF_BP_FILL,
+  _FFF_BP_TRANS,
+  _FFF_BP_MSG,
+  _FFF_BP_BELIEF,
+  _FFF_BP_PMSG
+};
+
+/* Normalize x (n) to sum 1 -when possible */
+static void _fff_BPmatch_normalize(double* x, const long n)
+{
+  long j;
+  double sx = 0;
+
+  for (j=0 ; j<n ; j++)
+    sx += x[j];
+  if (sx != 0)
+    for (j=0 ; j<n ; j++)
+      x[j] /= sx;
+}
+
+/* Candidate targets of source i, as in fff_BPmatch; if b is NULL,
+   they are only counted */
+static long _fff_BPmatch_candidates(long* cand, double* b, const _fff_BPmatch_job* job, const long i)
+{
+  long j, k, c = 0, p = job->source->size2;
+  double dx, dist;
+  const double *x = job->source->data + i*job->source->tda, *y;
+
+  for (j=0 ; j<(long)job->target->size1 ; j++){
+    y = job->target->data + j*job->target->tda;
+    dist = 0;
+    for (k=0 ; k<p ; k++){
+      dx = x[k]-y[k];
+      dist += dx*dx;
+      if (dist>job->dth) break;
+    }
+    if (dist<job->dth){
+      if (b != NULL){
+	cand[c] = j;
+	b[c] = exp(-dist/job->sqs);
+      }
+      c++;
+    }
+  }
+  return c;
+}
+
+/* Transition of edge e: T[a][b] ~ exp(-|(sA-ta)-(sB-tb)|^2/sqs) */
+static void _fff_BPmatch_transition(const _fff_BPmatch_job* job, const long e)
+{
+  long A = job->ea[e], B = job->eb[e];
+  long na = job->cs[A+1]-job->cs[A], nb = job->cs[B+1]-job->cs[B];
+  long a, b, k, p = job->source->size2;
+  double v, dist;
+  double* T = job->trans + job->to[e];
+  const double *sA = job->source->data + A*job->source->tda;
+  const double *sB = job->source->data + B*job->source->tda;
+  const double *ti, *tj;
+
+  for (a=0 ; a<na ; a++){
+    ti = job->target->data + job->cand[job->cs[A]+a]*job->target->tda;
+    for (b=0 ; b<nb ; b++){
+      tj = job->target->data + job->cand[job->cs[B]+b]*job->target->tda;
+      dist = 0;
+      for (k=0 ; k<p ; k++){
+	v = (sA[k]-sB[k]) - ti[k] + tj[k];
+	dist += v*v;
+      }
+      T[a*nb+b] = exp(-dist/job->sqs);
+    }
+    _fff_BPmatch_normalize(T+a*nb, nb);
+  }
+}
+
+/* Message of edge e, from the outgoing message of its origin */
+static void _fff_BPmatch_message(const _fff_BPmatch_job* job, const long e, double* buf)
+{
+  long A = job->ea[e], B = job->eb[e];
+  long na = job->cs[A+1]-job->cs[A], nb = job->cs[B+1]-job->cs[B];
+  long a, b;
+  const double *T = job->trans + job->to[e], *P = job->pmsg + job->po[e];
+  double* M = job->msg + job->mo[e];
+
+  for (b=0 ; b<nb ; b++)
+    buf[b] = 0;
+  for (a=0 ; a<na ; a++)
+    for (b=0 ; b<nb ; b++)
+      buf[b] += T[a*nb+b]*P[a];
+  _fff_BPmatch_normalize(buf, nb);
+  for (b=0 ; b<nb ; b++)
+    M[b] = job->first ? buf[b] : (1-job->damping)*buf[b] + job->damping*M[b];
+}
+
+/* Belief of source B: prior times incoming messages */
+static void _fff_BPmatch_belief(const _fff_BPmatch_job* job, const long B, double* buf)
+{
+  long b, l, nb = job->cs[B+1]-job->cs[B];
+  double *bel = job->belief + job->cs[B];
+  const double *b0 = job->binit + job->cs[B], *M;
+  double d, diff = 0;
+
+  for (b=0 ; b<nb ; b++)
+    buf[b] = b0[b];
+  for (l=job->is[B] ; l<job->is[B+1] ; l++){
+    M = job->msg + job->mo[job->ie[l]];
+    for (b=0 ; b<nb ; b++)
+      buf[b] *= M[b];
+  }
+  _fff_BPmatch_normalize(buf, nb);
+  for (b=0 ; b<nb ; b++){
+    d = bel[b]-buf[b];
+    diff += d*d;
+    bel[b] = buf[b];
+  }
+  job->diff[B] = diff;
+}
+
+/* Outgoing message of edge e=(A,B): belief of A, less the message
+   that B sent to A */
+static void _fff_BPmatch_pmessage(const _fff_BPmatch_job* job, const long e)
+{
+  long A = job->ea[e], a, na = job->cs[A+1]-job->cs[A];
+  const double *bel = job->belief + job->cs[A], *M;
+  double* P = job->pmsg + job->po[e];
+
+  if (job->rev[e] < 0){
+    for (a=0 ; a<na ; a++)
+      P[a] = bel[a];
+    return;
+  }
+  M = job->msg + job->mo[job->rev[e]];
+  for (a=0 ; a<na ; a++)
+    P[a] = bel[a] / FFF_MAX(M[a], job->eps);
+}
+
+static void _fff_BPmatch_job_run(int rank, int nthreads, void* params)
+{
+  _fff_BPmatch_job* job = (_fff_BPmatch_job*)params;
+  size_t start, stop;
+  long i;
+  double* buf = job->buf + rank*FFF_MAX(job->maxc,1);
+
+  if ((job->stage == _FFF_BP_COUNT) || (job->stage == _FFF_BP_FILL) || (job->stage == _FFF_BP_BELIEF))
+    fff_parallel_range(job->n1, rank, nthreads, &start, &stop);
+  else
+    fff_parallel_range(job->E, rank, nthreads, &start, &stop);
+
+  for (i=(long)start ; i<(long)stop ; i++)
+    switch (job->stage){
+    case _FFF_BP_COUNT:
+      job->cs[i+1] = _fff_BPmatch_candidates(NULL, NULL, job, i);
+      break;
+    case _FFF_BP_FILL:
+      _fff_BPmatch_candidates(job->cand+job->cs[i], job->binit+job->cs[i], job, i);
+      _fff_BPmatch_normalize(job->binit+job->cs[i], job->cs[i+1]-job->cs[i]);
+      break;
+    case _FFF_BP_TRANS:
+      _fff_BPmatch_transition(job, i);
+      break;
+    case _FFF_BP_MSG:
+      _fff_BPmatch_message(job, i, buf);
+      break;
+    case _FFF_BP_BELIEF:
+      _fff_BPmatch_belief(job, i, buf);
+      break;
+    case _FFF_BP_PMSG:
+      _fff_BPmatch_pmessage(job, i);
+      break;
+    }
+}
+
+static void _fff_BPmatch_job_delete(_fff_BPmatch_job* job)
+{
+  free(job->cs);
+  free(job->cand);
+  free(job->binit);
+  free(job->belief);
+  free(job->diff);
+  free(job->ea);
+  free(job->eb);
+  free(job->rev);
+  free(job->is);
+  free(job->ie);
+  free(job->to);
+  free(job->mo);
+  free(job->po);
+  free(job->trans);
+  free(job->msg);
+  free(job->pmsg);
+  free(job->buf);
+}
+
+/* Edges of G without self-loops and null weights, grouped by origin;
+   returns 1 if memory is lacking */
+static int _fff_BPmatch_edges(_fff_BPmatch_job* job, const fff_graph* G)
+{
+  long i, j, d, e, f, n1 = job->n1, E = 0;
+  long *os, *count;
+  fff_graph_neighb N;
+  const long *nn;
+  const double *nw;
+
+  if (fff_graph_neighb_init(&N, G))
+    return 1;
+  for (i=0 ; i<n1 ; i++){
+    d = fff_graph_neighb_get(&N, i, &nn, &nw);
+    for (j=0 ; j<d ; j++)
+      if ((nn[j] != i) && (nw[j] != 0))
+	E++;
+  }
+  job->E = E;
+  job->ea = (long*) calloc(FFF_MAX(E,1), sizeof(long));
+  job->eb = (long*) calloc(FFF_MAX(E,1), sizeof(long));
+  job->rev = (long*) calloc(FFF_MAX(E,1), sizeof(long));
+  job->ie = (long*) calloc(FFF_MAX(E,1), sizeof(long));
+  job->is = (long*) calloc(n1+1, sizeof(long));
+  os = (long*) calloc(n1+1, sizeof(long));
+  count = (long*) calloc(n1+1, sizeof(long));
+  if ((job->ea == NULL) || (job->eb == NULL) || (job->rev == NULL) || (job->ie == NULL) ||
+      (job->is == NULL) || (os == NULL) || (count == NULL)){
+    fff_graph_neighb_clear(&N);
+    free(os);
+    free(count);
+    return 1;
+  }
+
+  e = 0;
+  for (i=0 ; i<n1 ; i++){
+    os[i] = e;
+    d = fff_graph_neighb_get(&N, i, &nn, &nw);
+    for (j=0 ; j<d ; j++)
+      if ((nn[j] != i) && (nw[j] != 0)){
+	job->ea[e] = i;
+	job->eb[e] = nn[j];
+	e++;
+      }
+  }
+  os[n1] = E;
+  fff_graph_neighb_clear(&N);
+
+  /* reverse edges, and incoming edges of each source */
+  for (e=0 ; e<E ; e++){
+    job->rev[e] = -1;
+    for (f=os[job->eb[e]] ; f<os[job->eb[e]+1] ; f++)
+      if (job->eb[f] == job->ea[e]){
+	job->rev[e] = f;
+	break;
+      }
+    job->is[job->eb[e]+1]++;
+  }
+  for (i=0 ; i<n1 ; i++)
+    job->is[i+1] += job->is[i];
+  for (e=0 ; e<E ; e++){
+    i = job->eb[e];
+    job->ie[job->is[i]+count[i]] = e;
+    count[i]++;
+  }
+  free(os);
+  free(count);
+  return 0;
+}
+
+/* Candidates, edges, transitions and initial messages; returns 1 if
+   memory is lacking */
+static int _fff_BPmatch_init(_fff_BPmatch_job* job, const fff_graph* G, const int nthreads)
+{
+  long i, e, na, nb, nt = 0, nm = 0, np = 0, n1 = job->n1;
+
+  /* candidates and prior beliefs */
+  job->cs = (long*) calloc(n1+1, sizeof(long));
+  job->diff = (double*) calloc(FFF_MAX(n1,1), sizeof(double));
+  if ((job->cs == NULL) || (job->diff == NULL))
+    return 1;
+  job->stage = _FFF_BP_COUNT;
+  fff_parallel_run(nthreads, &_fff_BPmatch_job_run, (void*)job);
+  for (i=0 ; i<n1 ; i++){
+    job->maxc = FFF_MAX(job->maxc, job->cs[i+1]);
+    job->cs[i+1] += job->cs[i];
+  }
+  job->cand = (long*) calloc(FFF_MAX(job->cs[n1],1), sizeof(long));
+  job->binit = (double*) calloc(FFF_MAX(job->cs[n1],1), sizeof(double));
+  job->belief = (double*) calloc(FFF_MAX(job->cs[n1],1), sizeof(double));
+  job->buf = (double*) calloc(FFF_MAX(job->maxc,1)*nthreads, sizeof(double));
+  if ((job->cand == NULL) || (job->binit == NULL) || (job->belief == NULL) || (job->buf == NULL))
+    return 1;
+  job->stage = _FFF_BP_FILL;
+  fff_parallel_run(nthreads, &_fff_BPmatch_job_run, (void*)job);
+  memcpy(job->belief, job->binit, job->cs[n1]*sizeof(double));
+
+  /* edges, transitions and messages */
+  if (_fff_BPmatch_edges(job, G))
+    return 1;
+  job->to = (long*) calloc(FFF_MAX(job->E,1), sizeof(long));
+  job->mo = (long*) calloc(FFF_MAX(job->E,1), sizeof(long));
+  job->po = (long*) calloc(FFF_MAX(job->E,1), sizeof(long));
+  if ((job->to == NULL) || (job->mo == NULL) || (job->po == NULL))
+    return 1;
+  for (e=0 ; e<job->E ; e++){
+    na = job->cs[job->ea[e]+1]-job->cs[job->ea[e]];
+    nb = job->cs[job->eb[e]+1]-job->cs[job->eb[e]];
+    job->to[e] = nt;
+    job->mo[e] = nm;
+    job->po[e] = np;
+    nt += na*nb;
+    nm += nb;
+    np += na;
+  }
+  job->trans = (double*) calloc(FFF_MAX(nt,1), sizeof(double));
+  job->msg = (double*) calloc(FFF_MAX(nm,1), sizeof(double));
+  job->pmsg = (double*) calloc(FFF_MAX(np,1), sizeof(double));
+  if ((job->trans == NULL) || (job->msg == NULL) || (job->pmsg == NULL))
+    return 1;
+
+  job->stage = _FFF_BP_TRANS;
+  fff_parallel_run(nthreads, &_fff_BPmatch_job_run, (void*)job);
+  for (e=0 ; e<job->E ; e++)
+    memcpy(job->pmsg+job->po[e], job->binit+job->cs[job->ea[e]], 
+	   (job->cs[job->ea[e]+1]-job->cs[job->ea[e]])*sizeof(double));
+  return 0;
+}
+
+long fff_BPmatch_sparse(fff_graph** belief, const fff_matrix* source, const fff_matrix* target, const fff_graph* G,
+			const double d0, const double damping, int nthreads)
+{
+  long i, e, iter;
+  long n1 = source->size1;
+  double dB;
+  int maxiter = 20;
+  _fff_BPmatch_job job;
+  fff_graph* thisone = NULL;
+
+  *belief = NULL;
+  if (source->size2 != target->size2){
+    FFF_WARNING("Incompaticle dimension four source and target\n");
+    return(0);
+  }
+  if (G->V != n1){
+    FFF_WARNING("Bad size for the graph\n");
+    return(0);
+  }
+
+  memset(&job, 0, sizeof(job));
+  job.source = source;
+  job.target = target;
+  job.sqs = 2*d0*d0;
+  job.dth = 4.5*job.sqs;
+  job.damping = damping;
+  job.eps = 1.e-12;
+  job.n1 = n1;
+  nthreads = fff_threads_count(nthreads);
+  if (_fff_BPmatch_init(&job, G, nthreads) == 0)
+    thisone = fff_graph_new(n1, job.cs[n1]);
+  if (thisone == NULL){
+    FFF_ERROR("Memory allocation failed", ENOMEM);
+    _fff_BPmatch_job_delete(&job);
+    return(0);
+  }
+
+  /* message passing algorithm */
+  for (iter=0 ; (iter<maxiter) && (job.E>0) ; iter++){
+    job.first = (iter == 0);
+    job.stage = _FFF_BP_MSG;
+    fff_parallel_run(nthreads, &_fff_BPmatch_job_run, (void*)&job);
+    job.stage = _FFF_BP_BELIEF;
+    fff_parallel_run(nthreads, &_fff_BPmatch_job_run, (void*)&job);
+
+    /* stopping criterion, summed in a fixed order */
+    dB = 0;
+    for (i=0 ; i<n1 ; i++)
+      dB += job.diff[i];
+    if (dB<job.eps)
+      break;
+
+    job.stage = _FFF_BP_PMSG;
+    fff_parallel_run(nthreads, &_fff_BPmatch_job_run, (void*)&job);
+  }
+
+  /* sparse beliefs */
+  for (i=0 ; i<n1 ; i++)
+    for (e=job.cs[i] ; e<job.cs[i+1] ; e++){
+      thisone->eA[e] = i;
+      thisone->eB[e] = job.cand[e];
+      thisone->eD[e] = job.belief[e];
+    }
+  _fff_BPmatch_job_delete(&job);
+  *belief = thisone;
+  return(thisone->E);
+}
@@ -36,6 +36,36 @@ extern "C" {
   */
   
   extern int fff_BPmatch(fff_matrix * source, fff_matrix * target, fff_matrix * adjacency, fff_matrix * belief, double d0);
+
+  /*!
+  \brief Sparse discrete matching algorithm
+  \param belief resulting graph of the matching beliefs, from the rows of source to those of target
+  \param source matrix of the source data
+  \param target matrix of the target data
+  \param G graph between the sources (G->V = number of sources)
+  \param d0  distance considered in the matching 
+  \param damping weight of the former messages in each update, in [0,1[
+  \param nthreads number of threads (see \c fff_threads_count)
+
+  Same belief propagation as fff_BPmatch, with a memory and time that
+  scale with the edges rather than with the number of source*target
+  pairs: the candidate targets of a source are those within the
+  cutoff distance of fff_BPmatch (3*d0), and both the beliefs and the
+  messages along the edges of G (self-loops and null edges are
+  ignored) are only stored for the candidates. The transitions are
+  normalized over the candidates as well, hence the results slightly
+  differ from those of fff_BPmatch when some targets are pruned. With
+  a non-zero \a damping, each new message is averaged with the former
+  one, which helps convergence on loopy graphs. The updates of each
+  sweep are shared among \a nthreads threads, and the results do not
+  depend on nthreads.
+
+  belief is allocated in the function, with an edge (i,j,b) for each
+  candidate target j of source i. Its number of edges is returned,
+  or 0 if memory is lacking.
+  */
+  extern long fff_BPmatch_sparse(fff_graph** belief, const fff_matrix* source, const fff_matrix* target, 
+				 const fff_graph* G, const double d0, const double damping, int nthreads);
  
 
 #ifdef __cplusplus
@@ -2,21 +2,50 @@
 #include "fff_routines.h"
 #include "fff_specfun.h"
 #include <stdlib.h>
+#include <string.h>
 #include <stdio.h>
 #include <math.h>
 #include <randomkit.h>
 
 
+/*
+  Sufficient statistics of the mixture components, shared by the IMM
+  and FDP samplers. Each slot holds the count, sum and sum of squares
+  of the items currently assigned to it, so that the items of a chunk
+  are withdrawn and reassigned in O(dim) each instead of rescanning
+  the whole dataset. Empty slots are only removed at the beginning
+  and end of each sweep, where the statistics are also recomputed
+  from scratch so that rounding errors do not accumulate.
+*/
+typedef struct {
+  long dim;
+  long size;
+  long cap;
+  long nactive;
+  long* count;
+  long* active; /* slots currently in the model, in increasing order */
+  double* sum;
+  double* sum2;
+} _fff_DP_stats;
+
+static _fff_DP_stats* _fff_DP_stats_new(const long dim);
+static void _fff_DP_stats_delete(_fff_DP_stats* S);
+static long _fff_DP_stats_push(_fff_DP_stats* S);
+static void _fff_DP_stats_update(_fff_DP_stats* S, const long l, const fff_matrix *data, const long i, const int sign);
+static void _fff_DP_stats_reset(_fff_DP_stats* S, fff_array *Z, const fff_matrix *data, const long first);
+static long _fff_DP_stats_active(_fff_DP_stats* S, const long first);
+static long _fff_DP_chunks(long** start, long** group, const fff_array * labels, fff_arena* scratch);
+
 static int _recompute_and_redraw(fff_FDP* FDP, fff_array *Z, const fff_matrix *data, const fff_vector * pvals, const fff_array * labels, const int nit);
 
-static int _withdraw (fff_FDP* FDP, fff_array *Z, const fff_matrix *data,  const fff_array * valid);
+static int _withdraw (fff_FDP* FDP, const _fff_DP_stats* S);
 
-static int _compute_W(fff_matrix* W, const fff_FDP* FDP, const fff_matrix *data, const fff_vector * pvals, const fff_array * valid);
+static int _compute_W(fff_matrix* W, const fff_FDP* FDP, const fff_matrix *data, const fff_vector * pvals, const long* group);
 
 static double _theoretical_pval_gaussian(fff_vector * proba, const fff_vector * X,const fff_FDP* FDP);
 static double _theoretical_pval_student(fff_vector * proba, const fff_vector * X,const fff_FDP* FDP);
 
-static int _redraw(fff_array *Z, fff_matrix* W,const fff_array * valid, int nit);
+static int _redraw(fff_array *Z, const fff_matrix* W, const long* group, _fff_DP_stats* S, rk_state* state);
 
 static int _compute_P_under_H1(fff_vector *density, const fff_FDP* FDP, const fff_matrix *grid);
 static int _FDP_show(fff_FDP* FDP,int i);
@@ -27,16 +56,147 @@ static int _recompute_and_redraw_IMM(fff_IMM* IMM, fff_array *Z, const fff_matri
 
 static int _compute_P_IMM(fff_vector *density, const fff_IMM* IMM, const fff_matrix *grid);
 
-static int _compute_W_IMM(fff_matrix* W, const fff_IMM* IMM, const fff_matrix *data, const fff_array * valid);
+static int _compute_W_IMM(fff_matrix* W, const fff_IMM* IMM, const fff_matrix *data, const long* group);
 
 static double _pval_gaussian_(fff_vector * proba, const fff_vector * X,const fff_IMM* IMM);
 static double _pval_WN_(fff_vector * proba, const fff_vector * X,const fff_IMM* IMM);
 
-static int _withdraw_fixed (fff_IMM* IMM, fff_array *Z, const fff_matrix *data,  const fff_array * valid);
+static int _withdraw_fixed (fff_IMM* IMM, const _fff_DP_stats* S);
 
-static int _withdraw_var (fff_IMM* IMM, fff_array *Z, const fff_matrix *data,  const fff_array * valid);
+static int _withdraw_var (fff_IMM* IMM, const _fff_DP_stats* S);
 
-static int _withdraw_common (fff_IMM* IMM, fff_array *Z, const fff_matrix *data,  const fff_array * valid);
+static int _withdraw_common (fff_IMM* IMM, const _fff_DP_stats* S);
+
+/************************************************************************/
+/*********** Sufficient statistics  *************************************/
+/************************************************************************/
+
+static _fff_DP_stats* _fff_DP_stats_new(const long dim)
+{
+  _fff_DP_stats* S = (_fff_DP_stats*) calloc(1, sizeof(_fff_DP_stats));
+  S->dim = dim;
+  return S;
+}
+
+static void _fff_DP_stats_delete(_fff_DP_stats* S)
+{
+  free(S->count);
+  free(S->active);
+  free(S->sum);
+  free(S->sum2);
+  free(S);
+}
+
+/* Append an empty slot and return its index */
+static long _fff_DP_stats_push(_fff_DP_stats* S)
+{
+  long m, cap;
+
+  if (S->size == S->cap){
+	cap = FFF_MAX(2*S->cap, 8);
+	S->count = (long*) realloc(S->count, cap*sizeof(long));
+	S->active = (long*) realloc(S->active, cap*sizeof(long));
+	S->sum = (double*) realloc(S->sum, cap*S->dim*sizeof(double));
+	S->sum2 = (double*) realloc(S->sum2, cap*S->dim*sizeof(double));
+	S->cap = cap;
+  }
+  S->count[S->size] = 0;
+  for (m=0 ; m<S->dim ; m++){
+	S->sum[S->size*S->dim+m] = 0;
+	S->sum2[S->size*S->dim+m] = 0;
+  }
+  return S->size++;
+}
+
+/* Add (sign=1) or withdraw (sign=-1) the item i of data to/from slot l */
+static void _fff_DP_stats_update(_fff_DP_stats* S, const long l, const fff_matrix *data, const long i, const int sign)
+{
+  long m;
+  double x;
+  double* sum = S->sum + l*S->dim;
+  double* sum2 = S->sum2 + l*S->dim;
+
+  S->count[l] += sign;
+  for (m=0 ; m<S->dim ; m++){
+	x = fff_matrix_get(data,i,m);
+	sum[m] += sign*x;
+	sum2[m] += sign*x*x;
+  }
+}
+
+/*
+  Relabel Z so that the labels below first are kept and the other
+  non-empty ones are numbered consecutively, in increasing order; then
+  recompute the statistics. Negative labels denote unassigned items.
+*/
+static void _fff_DP_stats_reset(_fff_DP_stats* S, fff_array *Z, const fff_matrix *data, const long first)
+{
+  long i, l, k = 0, kmax = first, n = Z->dimX;
+  long* relabel;
+
+  for (i=0 ; i<n ; i++)
+	kmax = FFF_MAX(kmax, (long)fff_array_get1d(Z,i)+1);
+  relabel = (long*) calloc(kmax, sizeof(long));
+  for (i=0 ; i<n ; i++){
+	l = fff_array_get1d(Z,i);
+	if (l>-1)
+	  relabel[l]++;
+  }
+  for (l=0 ; l<kmax ; l++)
+	relabel[l] = ((l<first) || (relabel[l]>0)) ? k++ : -1;
+
+  S->size = 0;
+  for (l=0 ; l<k ; l++)
+	_fff_DP_stats_push(S);
+  for (i=0 ; i<n ; i++){
+	l = fff_array_get1d(Z,i);
+	if (l>-1){
+	  l = relabel[l];
+	  fff_array_set1d(Z,i,l);
+	  _fff_DP_stats_update(S, l, data, i, 1);
+	}
+  }
+  free(relabel);
+}
+
+/* List the slots below first and the non-empty ones */
+static long _fff_DP_stats_active(_fff_DP_stats* S, const long first)
+{
+  long l;
+
+  S->nactive = 0;
+  for (l=0 ; l<S->size ; l++)
+	if ((l<first) || (S->count[l]>0))
+	  S->active[S->nactive++] = l;
+  return S->nactive;
+}
+
+/*
+  Group the items by chunk: chunk s is made of the items 
+  group[start[s]], ..., group[start[s+1]-1]. Returns the number of
+  chunks. The lists are allocated from scratch.
+*/
+static long _fff_DP_chunks(long** start, long** group, const fff_array * labels, fff_arena* scratch)
+{
+  long i, s, n = labels->dimX;
+  long S = (long) fff_array_max1d(labels)+1;
+  long* pos = (long*) fff_arena_alloc(scratch, (S+1)*sizeof(long));
+
+  *start = (long*) fff_arena_alloc(scratch, (S+1)*sizeof(long));
+  *group = (long*) fff_arena_alloc(scratch, n*sizeof(long));
+  memset((void*)*start, 0, (S+1)*sizeof(long));
+  for (i=0 ; i<n ; i++)
+	(*start)[(long)fff_array_get1d(labels,i)+1]++;
+  for (s=0 ; s<S ; s++){
+	(*start)[s+1] += (*start)[s];
+	pos[s] = (*start)[s];
+  }
+  for (i=0 ; i<n ; i++){
+	s = fff_array_get1d(labels,i);
+	(*group)[pos[s]++] = i;
+  }
+  return S;
+}
 
 /************************************************************************/
 /*********** Infinite Gaussian Mixture Model (IMM)  *********************/
@@ -74,6 +234,7 @@ extern fff_IMM* fff_IMM_new( const double alpha, const long dim, const int type)
 
   thisone->weights = fff_vector_new(k);  
   thisone->pop = fff_array_new1d(FFF_LONG,k);
+  thisone->scratch = fff_arena_new(0);
   
   fff_vector_set(thisone->weights,0,alpha);
 
@@ -105,6 +266,7 @@ extern int fff_IMM_delete( fff_IMM* thisone )
 	  fff_vector_delete(thisone->dof);
 	  fff_matrix_delete(thisone->precisions);
 	}
+	fff_arena_delete(thisone->scratch);
 	free(thisone);
   }
   return(0);
@@ -173,79 +335,85 @@ extern int fff_IMM_estimation(fff_IMM* IMM, fff_array *Z, const fff_matrix *data
 
 static int _recompute_and_redraw_IMM(fff_IMM* IMM,fff_array *Z, const fff_matrix *data, const fff_array * labels, const int nit)
 {
-  int i,j,s,S = (int) fff_array_max1d(labels)+1;
-  fff_matrix *W ;
-  fff_array * popl = fff_array_new1d(FFF_LONG,S);
-  long aux;
-  int n = labels->dimX;
-  fff_array * valid = fff_array_new1d(FFF_LONG,n);
+  long i,r,s,S;
+  long *start, *group;
+  fff_matrix W;
+  size_t mark, smark;
+  rk_state state;
+  _fff_DP_stats* St = _fff_DP_stats_new(IMM->dim);
+
+  mark = fff_arena_mark(IMM->scratch);
+  S = _fff_DP_chunks(&start, &group, labels, IMM->scratch);
+  _fff_DP_stats_reset(St, Z, data, 0);
+  rk_randomseed(&state);
 
-  for (i=0 ; i<n ; i++) {
-	j = fff_array_get1d(labels,i);
-	aux = fff_array_get1d(popl,j);
-	fff_array_set1d(popl,j,aux+1);
-  }
-  
   for (s=0 ; s<S ; s++){
-	for (i=0 ; i<n ; i++)
-	  fff_array_set1d(valid,i,fff_array_get1d(labels,i)==s);
-	if (fff_array_get1d(popl,s)>0){
+	if (start[s+1]>start[s]){
+	  for (r=start[s] ; r<start[s+1] ; r++){
+		i = group[r];
+		_fff_DP_stats_update(St, fff_array_get1d(Z,i), data, i, -1);
+	  }
+	  _fff_DP_stats_active(St, 0);
 	  if (IMM->type==0)
-		_withdraw_fixed(IMM, Z, data, valid);
+		_withdraw_fixed(IMM, St);
 	  else
-		_withdraw_var(IMM, Z, data, valid);
-	  W = fff_matrix_new(n,IMM->k);
-	  _compute_W_IMM(W, IMM, data,valid);
-	  _redraw(Z,W,valid,nit);
-	  fff_matrix_delete(W);
+		_withdraw_var(IMM, St);
+	  smark = fff_arena_mark(IMM->scratch);
+	  W = fff_matrix_arena(IMM->scratch,start[s+1]-start[s],IMM->k);
+	  _compute_W_IMM(&W, IMM, data, group+start[s]);
+	  _redraw(Z, &W, group+start[s], St, &state);
+	  fff_arena_reset(IMM->scratch, smark);
+	  for (r=start[s] ; r<start[s+1] ; r++){
+		i = group[r];
+		_fff_DP_stats_update(St, fff_array_get1d(Z,i), data, i, 1);
+	  }
 	}
   }
+  _fff_DP_stats_reset(St, Z, data, 0);
   
-  fff_array_delete(popl);
-  fff_array_delete(valid);
+  _fff_DP_stats_delete(St);
+  fff_arena_reset(IMM->scratch, mark);
   return 0;
 }
 
 static int _compute_P_IMM(fff_vector *density, const fff_IMM* IMM, const fff_matrix *grid)
 {
   int i;
-  fff_vector * x = fff_vector_new(IMM->dim);
-  fff_vector * w = fff_vector_new(IMM->k);
+  size_t mark = fff_arena_mark(IMM->scratch);
+  fff_vector x = fff_vector_arena(IMM->scratch, IMM->dim);
+  fff_vector w = fff_vector_arena(IMM->scratch, IMM->k);
   double sw;
 
   for (i=0 ; i<grid->size1 ; i++) {
-	fff_matrix_get_row (x, grid, i);
+	fff_matrix_get_row (&x, grid, i);
 	sw = 0;
 	if (IMM->type==0)
-	  sw = _pval_gaussian_(w,x,IMM);
+	  sw = _pval_gaussian_(&w,&x,IMM);
 	else
-	  sw = _pval_WN_(w,x,IMM);
+	  sw = _pval_WN_(&w,&x,IMM);
 	fff_vector_set(density,i,sw);
   }
   
-  fff_vector_delete(x);
-  fff_vector_delete(w);
+  fff_arena_reset(IMM->scratch, mark);
   return 0;
 }
 
-static int _compute_W_IMM(fff_matrix* W, const fff_IMM* IMM, const fff_matrix *data, const fff_array * valid)
+static int _compute_W_IMM(fff_matrix* W, const fff_IMM* IMM, const fff_matrix *data, const long* group)
 {
-  int i;
-  fff_vector * x = fff_vector_new(IMM->dim);
-  fff_vector * w = fff_vector_new(IMM->k);
+  int r;
+  size_t mark = fff_arena_mark(IMM->scratch);
+  fff_vector x = fff_vector_arena(IMM->scratch, IMM->dim);
+  fff_vector w = fff_vector_arena(IMM->scratch, IMM->k);
 
-  for (i=0 ; i<valid->dimX ; i++) {
-	if (fff_array_get1d(valid,i)==1){
-	  fff_matrix_get_row (x, data, i);
-	  if (IMM->type==0)
-		_pval_gaussian_(w,x,IMM);
-	  else
-		_pval_WN_(w,x,IMM);
-	  fff_matrix_set_row(W,i,w);
-	}
+  for (r=0 ; r<W->size1 ; r++) {
+	fff_matrix_get_row (&x, data, group[r]);
+	if (IMM->type==0)
+	  _pval_gaussian_(&w,&x,IMM);
+	else
+	  _pval_WN_(&w,&x,IMM);
+	fff_matrix_set_row(W,r,&w);
   }
-  fff_vector_delete(x);
-  fff_vector_delete(w);
+  fff_arena_reset(IMM->scratch, mark);
   return 0;
 }
 
@@ -311,104 +479,63 @@ static double _pval_WN_(fff_vector * proba, const fff_vector * X,const fff_IMM*
   return(sw);
 }
 
-static int _withdraw_common (fff_IMM* IMM, fff_array *Z, const fff_matrix *data,  const fff_array * valid)
+static int _withdraw_common (fff_IMM* IMM, const _fff_DP_stats* S)
 {
-  int l,i,m,j;
-  double aux,sw,w;
-  long laux;
-  
-  /* compute the population per cluster */
-  fff_array_set_all(IMM->pop,0);
-  for (i=0 ; i<valid->dimX ; i++) {
-	if (fff_array_get1d(valid,i)==0){
-	  l = fff_array_get1d(Z,i);
-		laux = fff_array_get1d(IMM->pop,l);
-		fff_array_set1d(IMM->pop,l,laux+1);
-	}
-  }
-
-  /* update Z by removing empty components/clusters */
-  fff_array * relabel = fff_array_new1d(FFF_LONG,IMM->k);
-  int k=0;
-  for (i=0 ; i<IMM->k ; i++)
-	if (fff_array_get1d(IMM->pop,i)>0){
-	  fff_array_set1d(relabel,i,k);
-	  k++;
-	}
+  int i,j;
+  double aux,sw,w,ps;
   
-  for (i=0 ; i<valid->dimX ; i++) {
-	if (fff_array_get1d(valid,i)==0){
-	  l = fff_array_get1d(Z,i);
-		l = fff_array_get1d(relabel,l);
-		fff_array_set1d(Z,i,l);
-	}
+  /* the non-empty clusters, plus a new one */
+  long k = S->nactive+1;
+  if (IMM->k != k){
+	fff_array_delete(IMM->pop);
+	IMM->pop = fff_array_new1d(FFF_LONG,k);
+	fff_vector_delete(IMM->weights);
+	IMM->weights = fff_vector_new(k);
+	fff_matrix_delete(IMM->means);
+	IMM->means = fff_matrix_new(k, IMM->dim);
+	IMM->k = k;
   }
   
-  /* reset pop */ 
-  fff_array* pop = fff_array_new1d(FFF_LONG,k+1);
-  fff_array_set_all(pop,0);
-  for (i=0 ; i<IMM->k ; i++){
-	long toto = fff_array_get1d(IMM->pop,i);
-	if (toto>0)
-	  fff_array_set1d(pop,fff_array_get1d(relabel,i),toto);
-  }
-  fff_array_delete(IMM->pop);
-  fff_array_delete(relabel);
-  IMM->pop = pop;
-  IMM->k = k+1;
-  
-  /* compute the weights */
-  fff_vector_delete(IMM->weights);
-  IMM->weights = fff_vector_new(IMM->k);
-  fff_vector_set(IMM->weights,IMM->k-1, IMM->alpha);
+  /* compute the population and the weights */
   sw = IMM->alpha;
-  for (i=0 ; i<IMM->k-1 ; i++){
-	w = (double) fff_array_get1d(IMM->pop,i);
+  for (i=0 ; i<k-1 ; i++){
+	w = (double) S->count[S->active[i]];
+	fff_array_set1d(IMM->pop,i,w);
 	fff_vector_set(IMM->weights,i,w);
 	sw +=w;
   }
+  fff_array_set1d(IMM->pop,k-1,0);
+  fff_vector_set(IMM->weights,k-1, IMM->alpha);
   fff_vector_scale(IMM->weights,1./sw);
   
-  /* compute the empirical means */
-  
-  fff_matrix *empmeans = fff_matrix_new(IMM->k, IMM->dim);
-  for (i=0 ; i<valid->dimX ; i++) {
-	if (fff_array_get1d(valid,i)==0){
-	  l = fff_array_get1d(Z,i);
-	  for (m=0 ; m<IMM->dim ; m++){
-		aux =  fff_matrix_get(empmeans,l,m)+ fff_matrix_get(data,i,m);
-		fff_matrix_set(empmeans,l,m,aux);
-	  }
-	}
-  }
-
   /* compute the means */ 
-  fff_matrix_delete(IMM->means);
-  IMM->means = fff_matrix_new(IMM->k, IMM->dim);
-  for (i=0 ; i<IMM->k ; i++){
+  for (i=0 ; i<k ; i++){
+	w = (double) fff_array_get1d(IMM->pop,i);
 	for (j=0 ; j<IMM->dim ; j++){
-	  aux = fff_matrix_get(empmeans,i,j);
-	  aux += fff_vector_get(IMM->prior_means,j)*fff_vector_get(IMM->prior_mean_scale,j);
-	  aux /= (fff_array_get1d(IMM->pop,i)+fff_vector_get(IMM->prior_mean_scale,j));
+	  aux = (i<k-1) ? S->sum[S->active[i]*S->dim+j] : 0;
+	  ps = fff_vector_get(IMM->prior_mean_scale,j);
+	  aux += fff_vector_get(IMM->prior_means,j)*ps;
+	  aux /= (w+ps);
 	  fff_matrix_set(IMM->means,i,j,aux);
 	}
   }
-  fff_matrix_delete(empmeans);
   return IMM->k;
 }
 
-static int _withdraw_fixed (fff_IMM* IMM, fff_array *Z, const fff_matrix *data,  const fff_array * valid)
+static int _withdraw_fixed (fff_IMM* IMM, const _fff_DP_stats* S)
 {
   
   int j,i;
   double aux;
   
-  _withdraw_common (IMM,Z, data, valid);
+  _withdraw_common (IMM, S);
 
   /* reset the precision on the mean  */
   double w;
-  fff_matrix_delete(IMM->prec_means);
-  IMM->prec_means = fff_matrix_new(IMM->k, IMM->dim);
+  if (IMM->prec_means->size1 != IMM->k){
+	fff_matrix_delete(IMM->prec_means);
+	IMM->prec_means = fff_matrix_new(IMM->k, IMM->dim);
+  }
   for (i=0 ; i<IMM->k ; i++){
 	w = (double) fff_array_get1d(IMM->pop,i);
 	for (j=0 ; j<IMM->dim ; j++){
@@ -423,46 +550,40 @@ static int _withdraw_fixed (fff_IMM* IMM, fff_array *Z, const fff_matrix *data,
   return IMM->k;
 }
 
-static int _withdraw_var (fff_IMM* IMM, fff_array *Z, const fff_matrix *data,  const fff_array * valid)
+static int _withdraw_var (fff_IMM* IMM, const _fff_DP_stats* S)
 {
   
-  int j,i,l,m;
-  double aux;
+  int j,i,l;
+  double aux,m,w;
   
-  _withdraw_common (IMM,Z, data, valid);
+  _withdraw_common (IMM, S);
+
+  if (IMM->dof->size != IMM->k){
+	fff_vector_delete(IMM->dof);
+	IMM->dof = fff_vector_new(IMM->k);
+	fff_matrix_delete(IMM->precisions);
+	IMM->precisions = fff_matrix_new(IMM->k, IMM->dim);
+  }
 
   /* reset the dof */
-  fff_vector_delete(IMM->dof);
-  IMM->dof = fff_vector_new(IMM->k);
-  fff_vector_set_all(IMM->dof,IMM->prior_dof);
   for (i=0 ; i<IMM->k ; i++)
-	fff_vector_set(IMM->dof,i,fff_vector_get(IMM->dof,i)+fff_array_get1d(IMM->pop,i));
+	fff_vector_set(IMM->dof,i,IMM->prior_dof+fff_array_get1d(IMM->pop,i));
 
-  /* compute the covariance */
-  fff_matrix * emp_covariance = fff_matrix_new(IMM->k, IMM->dim);  
-  for (i=0 ; i<valid->dimX ; i++) {
-	if (fff_array_get1d(valid,i)==0){
-	  l = fff_array_get1d(Z,i);
-	  for (m=0 ; m<IMM->dim ; m++){
-		aux = fff_matrix_get(data,i,m)-fff_matrix_get(IMM->means,l,m);
-		aux =  fff_matrix_get(emp_covariance,l,m)+ aux*aux;
-		fff_matrix_set(emp_covariance,l,m,aux);
-	  }
-	}
-  }
-   
-  /* reset the precision */
-  fff_matrix_delete(IMM->precisions);
-  IMM->precisions = fff_matrix_new(IMM->k, IMM->dim);
+  /* reset the precision, from the scatter around the means */
   for (i=0 ; i<IMM->k ; i++){
+	w = (double) fff_array_get1d(IMM->pop,i);
 	for (j=0 ; j<IMM->dim ; j++){
-	  aux = fff_matrix_get(emp_covariance,i,j);
+	  aux = 0;
+	  if (i<IMM->k-1){
+		l = S->active[i]*S->dim+j;
+		m = fff_matrix_get(IMM->means,i,j);
+		aux = S->sum2[l] - 2*m*S->sum[l] + w*m*m;
+		aux = FFF_MAX(aux,0);
+	  }
 	  aux += 1/fff_vector_get(IMM->prior_precisions,j);
 	  fff_matrix_set(IMM->precisions,i,j,1.0/aux);
 	}
   }
-
-  fff_matrix_delete(emp_covariance);
   
   /* reset the precision on the mean  */
   /* in this model, this is not necessary */
@@ -507,6 +628,7 @@ extern fff_FDP* fff_FDP_new( const double alpha, const double g0, const double g
   thisone->prior_precisions = fff_matrix_new(1,dim);
   thisone->weights = fff_vector_new(k-1);  
   thisone->pop = fff_array_new1d(FFF_LONG,k);
+  thisone->scratch = fff_arena_new(0);
   /* thisone->empmeans = fff_matrix_new(k-1,dim); */
 
   fff_vector_set(thisone->weights,0,alpha);
@@ -525,6 +647,7 @@ extern int fff_FDP_delete( fff_FDP* thisone )
 	fff_matrix_delete(thisone->precisions);
 	fff_array_delete(thisone->pop);
 	/* fff_matrix_delete(thisone->empmeans); */
+	fff_arena_delete(thisone->scratch);
 
 	free(thisone);
   }
@@ -655,218 +778,152 @@ extern int fff_FDP_estimation(fff_FDP* FDP, fff_array *Z, const fff_matrix *data
 
 static int _recompute_and_redraw(fff_FDP* FDP,fff_array *Z, const fff_matrix *data, const fff_vector * pvals, const fff_array * labels, const int nit)
 {
-  int i,j,s,S = (int) fff_array_max1d(labels)+1;
-  fff_matrix *W ;
-  fff_array * popl = fff_array_new1d(FFF_LONG,S);
-  long aux;
-  int n = labels->dimX;
-  fff_array * valid = fff_array_new1d(FFF_LONG,n);
+  long i,l,r,s,S;
+  long *start, *group;
+  fff_matrix W;
+  size_t mark, smark;
+  rk_state state;
+  _fff_DP_stats* St = _fff_DP_stats_new(FDP->dim);
+
+  mark = fff_arena_mark(FDP->scratch);
+  S = _fff_DP_chunks(&start, &group, labels, FDP->scratch);
+  /* slot 0 is the null class */
+  _fff_DP_stats_reset(St, Z, data, 1);
+  rk_randomseed(&state);
 
-  for (i=0 ; i<n ; i++) {
-	j = fff_array_get1d(labels,i);
-	aux = fff_array_get1d(popl,j);
-	fff_array_set1d(popl,j,aux+1);
-  }
   for (s=0 ; s<S ; s++){
-	for (i=0 ; i<n ; i++)
-	  fff_array_set1d(valid,i,fff_array_get1d(labels,i)==s);
-	_withdraw (FDP, Z, data, valid);
-	if (fff_array_get1d(popl,s)>0){
-	  W = fff_matrix_new(n,FDP->k);
-	  _compute_W(W, FDP, data, pvals, valid);
-	  _redraw(Z,W,valid,nit);
-	  fff_matrix_delete(W);
+	for (r=start[s] ; r<start[s+1] ; r++){
+	  i = group[r];
+	  l = fff_array_get1d(Z,i);
+	  if (l>-1)
+		_fff_DP_stats_update(St, l, data, i, -1);
+	}
+	_fff_DP_stats_active(St, 1);
+	_withdraw (FDP, St);
+	if (start[s+1]>start[s]){
+	  smark = fff_arena_mark(FDP->scratch);
+	  W = fff_matrix_arena(FDP->scratch,start[s+1]-start[s],FDP->k);
+	  _compute_W(&W, FDP, data, pvals, group+start[s]);
+	  _redraw(Z, &W, group+start[s], St, &state);
+	  fff_arena_reset(FDP->scratch, smark);
+	  for (r=start[s] ; r<start[s+1] ; r++){
+		i = group[r];
+		_fff_DP_stats_update(St, fff_array_get1d(Z,i), data, i, 1);
+	  }
 	}	
   }
+  _fff_DP_stats_reset(St, Z, data, 1);
 
-  fff_array_delete(popl);
-  fff_array_delete(valid);
+  _fff_DP_stats_delete(St);
+  fff_arena_reset(FDP->scratch, mark);
   return 0;
 }
 
-static int _withdraw (fff_FDP* FDP, fff_array *Z, const fff_matrix *data,  const fff_array * valid)
+static int _withdraw (fff_FDP* FDP, const _fff_DP_stats* S)
 {
   
-  int j,l,i,m;
-  double aux,temp;
-  long laux;
-  int n = valid->dimX;
+  int j,l,i;
+  double aux,temp,w,sw;
  
-  /**/
-  fff_array_delete(FDP->pop);
-  FDP->k = (long)fff_array_max1d(Z)+1;
-  FDP->pop = fff_array_new1d(FFF_LONG,FDP->k);
-  /**/
-
-  /* compute the population */
-  fff_array_set_all(FDP->pop,0);
-  for (i=0 ; i<n ; i++) {
-	if (fff_array_get1d(valid,i)==0){
-	  l = fff_array_get1d(Z,i);
-	  if (l>-1){
-		laux = fff_array_get1d(FDP->pop,l);
-		fff_array_set1d(FDP->pop,l,laux+1);
-	  }
-	}
+  /* the null class, the non-empty clusters and a new one */
+  long k = S->nactive+1;
+  if (FDP->k != k){
+	fff_array_delete(FDP->pop);
+	FDP->pop = fff_array_new1d(FFF_LONG,k);
+	fff_vector_delete(FDP->weights);
+	FDP->weights = fff_vector_new(k-1);
+	FDP->k = k;
   }
 
-  /* update Z by removing null components  */
-  fff_array * relabel = fff_array_new1d(FFF_LONG,FDP->k);
-  int k=1;
-  for (i=1 ; i<FDP->k ; i++)
-	if (fff_array_get1d(FDP->pop,i)>0){
-	  fff_array_set1d(relabel,i,k);
-	  k++;
-	}
-
-  FDP->k = k+1;
-  for (i=0 ; i<n ; i++) {
-	if (fff_array_get1d(valid,i)==0){
-	  l = fff_array_get1d(Z,i);
-	  if (l>0){
-		j = fff_array_get1d(relabel,l);
-		fff_array_set1d(Z,i,j);
-	  }
-	}
-  }
-  fff_array_delete(relabel);
-  
-  /* reset pop */
-  fff_array_delete(FDP->pop);
-  FDP->pop = fff_array_new1d(FFF_LONG,FDP->k);
-  fff_array_set_all(FDP->pop,0);
-  for (i=0 ; i<n ; i++) {
-	if (fff_array_get1d(valid,i)==0){
-	  l = fff_array_get1d(Z,i);
-	  if (l>-1){
-		laux = fff_array_get1d(FDP->pop,l);
-		fff_array_set1d(FDP->pop,l,laux+1);
-	  }
-	}
-  }
-  
-  /* compute the empirical means and covariance */
-  /* fff_matrix_delete(FDP->empmeans); */
-  fff_matrix *empmeans = fff_matrix_new(FDP->k-1, FDP->dim);
-  fff_matrix *empcovar = fff_matrix_new(FDP->k-1, FDP->dim);
-  for (i=0 ; i<n ; i++) {
-	if (fff_array_get1d(valid,i)==0){
-	  l = fff_array_get1d(Z,i);
-	  if (l>0)
-		for (m=0 ; m<FDP->dim ; m++){
-		  temp = fff_matrix_get(data,i,m);
-		  aux =  fff_matrix_get(empmeans,l-1,m)+ temp;
-		  fff_matrix_set(empmeans,l-1,m,aux);
-		  aux =  fff_matrix_get(empcovar,l-1,m)+ temp*temp;
-		  fff_matrix_set(empcovar,l-1,m,aux);
-		}
-	}
-  }
+  /* compute the population */
+  for (i=0 ; i<k-1 ; i++)
+	fff_array_set1d(FDP->pop,i,S->count[S->active[i]]);
+  fff_array_set1d(FDP->pop,k-1,0);
   
   /* compute the weights */
-  fff_vector_delete(FDP->weights);
-  FDP->weights = fff_vector_new(FDP->k-1);
-  fff_vector_set_all(FDP->weights, FDP->alpha);
-  double w,sw = FDP->alpha;
-  for (i=0 ; i<FDP->k-2 ; i++){
+  sw = FDP->alpha;
+  for (i=0 ; i<k-2 ; i++){
 	w = (double) fff_array_get1d(FDP->pop,i+1);
 	fff_vector_set(FDP->weights,i,w);
 	sw +=w;
   }
+  fff_vector_set(FDP->weights,k-2,FDP->alpha);
   fff_vector_scale(FDP->weights,1./sw);
   
-  /* compute the means */
+  /* compute the means and reset the precision */
   if (k>2){
-	fff_matrix_delete(FDP->means);
-	FDP->means = fff_matrix_new(FDP->k-2, FDP->dim);
-	for (i=0 ; i<FDP->k-2 ; i++){
+	if (FDP->means->size1 != k-2){
+	  fff_matrix_delete(FDP->means);
+	  FDP->means = fff_matrix_new(k-2, FDP->dim);
+	  fff_matrix_delete (FDP->precisions);
+	  FDP->precisions = fff_matrix_new(k-2,FDP->dim);
+	}
+	for (i=0 ; i<k-2 ; i++){
 	  w = (double)fff_array_get1d(FDP->pop,i+1);
 	  for (j=0 ; j<FDP->dim ; j++){
-		aux = fff_matrix_get(empmeans,i,j);
-		aux /=w;
+		l = S->active[i+1]*S->dim+j;
+		aux = S->sum[l]/w;
 		fff_matrix_set(FDP->means,i,j,aux);
-		temp = fff_matrix_get(empcovar,i,j)-aux*aux*w;
-		fff_matrix_set(empcovar,i,j,temp);
-	  }
-	}
-  }
-  
-
-  /* reset the precision */
-  fff_matrix * precision;
-  if (FDP->k>2){	
-	precision = fff_matrix_new(FDP->k-2,FDP->dim);
-	if (FDP->prior_dof==0){ 
-	  /* this means infinite prior dof (!), thus posterior=prior */
-	  for (i=0 ; i<FDP->k-2 ; i++)
-		for (m=0 ; m<FDP->dim ; m++){
-		  aux = fff_matrix_get(FDP->prior_precisions,0,m);
-		  fff_matrix_set(precision,i,m,aux);
-		}
-	}
-	else{/* finite prior_dofs */
-	  for (i=0 ; i<FDP->k-2 ; i++)
-		for (m=0 ; m<FDP->dim ; m++){
-		  aux = FDP->prior_dof*1.0/fff_matrix_get(FDP->prior_precisions,0,m);
-		  aux += fff_matrix_get(empcovar,i,m);
-		  fff_matrix_set(precision,i,m,1.0/aux);
+		if (FDP->prior_dof==0)
+		  /* this means infinite prior dof (!), thus posterior=prior */
+		  temp = fff_matrix_get(FDP->prior_precisions,0,j);
+		else{/* finite prior_dofs */
+		  temp = FDP->prior_dof*1.0/fff_matrix_get(FDP->prior_precisions,0,j);
+		  temp += FFF_MAX(S->sum2[l]-aux*aux*w, 0);
+		  temp = 1.0/temp;
 		}
+		fff_matrix_set(FDP->precisions,i,j,temp);
+	  }
 	}
-	fff_matrix_delete (FDP->precisions);
-	FDP->precisions = precision; 
   }
-  fff_matrix_delete(empmeans);
-  fff_matrix_delete(empcovar);
   return FDP->k;
 }
 
-static int _compute_W(fff_matrix* W, const fff_FDP* FDP, const fff_matrix *data, const fff_vector * pvals, const fff_array * valid)
+static int _compute_W(fff_matrix* W, const fff_FDP* FDP, const fff_matrix *data, const fff_vector * pvals, const long* group)
 {
-  int i,k;
+  int r,k;
   double pp,p0;
-  fff_vector * x = fff_vector_new(FDP->dim);
-  fff_vector * w = fff_vector_new(FDP->k);
-
-  for (i=0 ; i<valid->dimX ; i++) {
-	if (fff_array_get1d(valid,i)==1){
-	  p0 = 1.0-fff_vector_get(pvals,i);
-	  fff_matrix_set(W,i,0,p0*FDP->g0);
-	  fff_matrix_get_row (x, data, i);
-	  if (FDP->prior_dof==0)
-		_theoretical_pval_gaussian(w,x,FDP);
-	  else
-		_theoretical_pval_student(w,x,FDP);
-	  for (k=0 ; k<FDP->k-1; k++){
-		pp = (1-p0)*fff_vector_get(w,k);
-        fff_matrix_set(W,i,k+1,pp);
-      }
+  size_t mark = fff_arena_mark(FDP->scratch);
+  fff_vector x = fff_vector_arena(FDP->scratch, FDP->dim);
+  fff_vector w = fff_vector_arena(FDP->scratch, FDP->k);
+
+  for (r=0 ; r<W->size1 ; r++) {
+	p0 = 1.0-fff_vector_get(pvals,group[r]);
+	fff_matrix_set(W,r,0,p0*FDP->g0);
+	fff_matrix_get_row (&x, data, group[r]);
+	if (FDP->prior_dof==0)
+	  _theoretical_pval_gaussian(&w,&x,FDP);
+	else
+	  _theoretical_pval_student(&w,&x,FDP);
+	for (k=0 ; k<FDP->k-1; k++){
+	  pp = (1-p0)*fff_vector_get(&w,k);
+	  fff_matrix_set(W,r,k+1,pp);
 	}
   }
-  fff_vector_delete(x);
-  fff_vector_delete(w);
+  fff_arena_reset(FDP->scratch, mark);
   return 0;
 }
 
 static int _compute_P_under_H1(fff_vector *density, const fff_FDP* FDP, const fff_matrix *grid)
 {
   int i;
-  fff_vector * x = fff_vector_new(FDP->dim);
-  fff_vector * w = fff_vector_new(FDP->k);
-  fff_vector * tmp = fff_vector_new(FDP->k);
+  size_t mark = fff_arena_mark(FDP->scratch);
+  fff_vector x = fff_vector_arena(FDP->scratch, FDP->dim);
+  fff_vector w = fff_vector_arena(FDP->scratch, FDP->k);
+  fff_vector tmp = fff_vector_arena(FDP->scratch, FDP->k);
   double sw;
 
   for (i=0 ; i<grid->size1 ; i++) {
-	fff_matrix_get_row (x, grid, i);
+	fff_matrix_get_row (&x, grid, i);
 	if (FDP->prior_dof==0)
-	  sw = _theoretical_pval_gaussian(w,x,FDP);
+	  sw = _theoretical_pval_gaussian(&w,&x,FDP);
 	else
-	  sw = _theoretical_pval_student(w,x,FDP);
+	  sw = _theoretical_pval_student(&w,&x,FDP);
 	fff_vector_set(density,i,sw);
-    fff_vector_add(tmp,w);
+    fff_vector_add(&tmp,&w);
   }
 
-  fff_vector_delete(x);
-  fff_vector_delete(w);
+  fff_arena_reset(FDP->scratch, mark);
   return 0;
 }
 
@@ -944,42 +1001,36 @@ static double _theoretical_pval_student(fff_vector * proba, const fff_vector * X
 }
 
 
-static int _redraw(fff_array *Z, fff_matrix* W,const fff_array * valid, int nit)
+/*
+  Draw the component of each item of the chunk (the rows of W) and
+  store the corresponding slot in Z. An item that falls in the last
+  column opens a new slot of its own.
+*/
+static int _redraw(fff_array *Z, const fff_matrix* W, const long* group, _fff_DP_stats* S, rk_state* state)
 {
-  int n,j; 
-  rk_state state; 
-  /*
-    nit = 0;
-    rk_seed(nit, &state);
-  */
-  rk_randomseed(&state);
-  /* I do not fully understand the reason, but using
-     rk_seed(nit, &state) instead of rk_randomseed(&state)
-     is 4 fold faster on some problems.
-     using nit=0 seems to work better than varying nit (?).
-  */
+  int r,j; 
+  long l;
   double sp,h;
+  double u[RK_FILL_BLOCK]; 
   
-  int q = W->size2-1;
-  for (n=0 ; n<valid->dimX ; n++) {
-	if (fff_array_get1d(valid,n)==1){
-	  sp = 0;
-	  for (j=0 ; j<W->size2 ; j++)
-		sp += fff_matrix_get(W,n,j);
-	  
-	  h = rk_double(&state)*sp;
-	  sp = 0;
-	  for (j=0 ; j<W->size2 ; j++){
-		sp +=fff_matrix_get(W,n,j);
-		if (sp>h) break;
-	  }
-      if (j>W->size2-2){
-        j = q;
-        q++;
-      }
-	  /* j = FFF_MIN(j,W->size2-1); */
-	  fff_array_set1d(Z,n,j);
+  for (r=0 ; r<W->size1 ; r++) {
+	if (r%RK_FILL_BLOCK == 0)
+	  rk_fill_double(state, u, FFF_MIN(RK_FILL_BLOCK, W->size1-r)); 
+	sp = 0;
+	for (j=0 ; j<W->size2 ; j++)
+	  sp += fff_matrix_get(W,r,j);
+	
+	h = u[r%RK_FILL_BLOCK]*sp;
+	sp = 0;
+	for (j=0 ; j<W->size2 ; j++){
+	  sp +=fff_matrix_get(W,r,j);
+	  if (sp>h) break;
 	}
+	if (j>(int)W->size2-2)
+	  l = _fff_DP_stats_push(S);
+	else
+	  l = S->active[j];
+	fff_array_set1d(Z,group[r],l);
   }
   return 0;
 }
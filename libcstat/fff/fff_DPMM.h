@@ -64,6 +64,9 @@ extern "C" {
 	double prior_dof;
 	fff_vector * dof;
 
+	fff_arena * scratch;
+	/* this is the scratch memory of the sampler */ 
+
 
   }fff_IMM;
   
@@ -204,6 +207,9 @@ extern "C" {
     /* fff_matrix *empmeans; */
 	fff_array *pop;
 	fff_matrix * prior_precisions;
+
+	fff_arena * scratch;
+	/* this is the scratch memory of the sampler */ 
 	
   }fff_FDP;
 
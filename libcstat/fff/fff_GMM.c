@@ -3,23 +3,29 @@
 #include "fff_GMM.h"
 #include "fff_routines.h"
 #include <randomkit.h>
+#include <rk_counter.h>
 #include "fff_specfun.h"
+#include "fff_threads.h"
 
 #include <stdlib.h>
 #include <stdio.h>
 #include <math.h>
 #include <errno.h>
 
+#define GMM_BLOCK 128
 
-static void _fff_clustering_subsample(fff_matrix* X_short, fff_array *Label_short, const fff_matrix* X, const fff_array *Label);
 
-int _fff_GMM_init(fff_matrix* Centers,fff_matrix* Precision, fff_vector *Weights,fff_matrix* X);
+static void _fff_gmm_draw(size_t* list, long k, long N, unsigned long seed, long fit, unsigned long channel);
+static void _fff_clustering_subsample(fff_matrix* X_short, fff_array *Label_short, const fff_matrix* X, const fff_array *Label, unsigned long seed, long fit);
+
+static double _fff_clustering_gmm(fff_matrix* Centers, fff_matrix* Precision, fff_vector *Weights, fff_array *Label, const fff_matrix* X, const int maxiter, const double delta, const int chunksize, const int verbose, const int nthreads, const unsigned long seed, const long fit);
+int _fff_GMM_init(fff_matrix* Centers,fff_matrix* Precision, fff_vector *Weights,fff_matrix* X, unsigned long seed, long fit);
 int _fff_GMM_init_hard(fff_matrix* Centers,fff_matrix* Precision, fff_vector *Weights, const fff_matrix* X, const fff_array* Label);
-double _fff_update_gmm(fff_matrix* Centers, fff_matrix* Precision,  fff_vector *Weights, const fff_matrix* X);
-double _fff_update_gmm_diag(fff_matrix* Centers, fff_matrix* Precision,  fff_vector *Weights, const fff_matrix* X);
+double _fff_update_gmm(fff_matrix* Centers, fff_matrix* Precision,  fff_vector *Weights, const fff_matrix* X, int nthreads);
+double _fff_update_gmm_diag(fff_matrix* Centers, fff_matrix* Precision,  fff_vector *Weights, const fff_matrix* X, int nthreads);
 double _fff_update_gmm_diag_dev( fff_matrix* Centers, fff_matrix* Precision,  fff_vector *Weights, fff_array **pa, fff_array *vo, const fff_matrix* X);
 double _fff_update_gmm_hom(fff_matrix* Centers, fff_matrix* Precision, const fff_matrix* X );
-double _fff_gmm_partition(fff_array* Labels, const fff_matrix* X, const fff_matrix* Centers, const fff_matrix* Precision, const fff_vector* Weights );
+double _fff_gmm_partition(fff_array* Labels, const fff_matrix* X, const fff_matrix* Centers, const fff_matrix* Precision, const fff_vector* Weights, int nthreads );
 
 /* VB-GMM */
 static int _fff_VBGMM_init(fff_Bayesian_GMM* BGMM);
@@ -28,13 +34,13 @@ static int _fff_VB_gmm_MAP(fff_array *Label, const fff_matrix* X, const fff_Baye
 static int _fff_VB_log_norm(fff_vector* log_norm_fact, const fff_Bayesian_GMM* BGMM);
 
 /* Gibbs-Bayesian GMM */
-static int _fff_BGMM_init(fff_Bayesian_GMM* BG);
+static int _fff_BGMM_init(fff_Bayesian_GMM* BG, unsigned long seed, unsigned long chain);
 static double _fff_WNpval_(fff_vector * proba, const fff_vector *X, const fff_Bayesian_GMM* BG);
 static double _fff_Npval(fff_matrix * proba, const fff_matrix *X, const fff_Bayesian_GMM* BG);
 
-static double _fff_update_BGMM(fff_Bayesian_GMM* BG, const fff_matrix *X, int nit,const int method);
+static double _fff_update_BGMM(fff_Bayesian_GMM* BG, const fff_matrix *X, unsigned long seed, unsigned long chain, int nit, const int method);
 
-static double _fff_full_update_BGMM(fff_matrix * proba, fff_Bayesian_GMM* BG, const fff_matrix *X, int nit, const int method);
+static double _fff_full_update_BGMM(fff_matrix * proba, fff_Bayesian_GMM* BG, const fff_matrix *X, unsigned long seed, unsigned long chain, int nit, const int method);
 
 /* these ones should and will be put elsewhere */
 /*
@@ -50,7 +56,21 @@ static double _fff_full_update_BGMM(fff_matrix * proba, fff_Bayesian_GMM* BG, co
 
 
 
-static void _fff_clustering_subsample(fff_matrix* X_short, fff_array *Label_short, const fff_matrix* X, const fff_array *Label)
+/* Draw k values in [0..N-1], as fff_rng_draw_noreplace if fit is
+   negative, otherwise from the counter-based stream (seed, fit) */ 
+static void _fff_gmm_draw(size_t* list, long k, long N, unsigned long seed, long fit, unsigned long channel)
+{
+  long i; 
+
+  if (fit < 0) {
+    fff_rng_draw_noreplace(list, k, N); 
+    return; 
+  }
+  for (i=0; i<k; i++)
+    list[i] = (size_t)(N*rk_counter_double(seed, (unsigned long)fit, channel, (unsigned long)i)); 
+}
+
+static void _fff_clustering_subsample(fff_matrix* X_short, fff_array *Label_short, const fff_matrix* X, const fff_array *Label, unsigned long seed, long fit)
 {
   
   int N,i,n,fd;
@@ -62,7 +82,7 @@ static void _fff_clustering_subsample(fff_matrix* X_short, fff_array *Label_shor
   if (!list) return;
   fff_vector * v = fff_vector_new(fd); 
   
-  fff_rng_draw_noreplace (list, n, N);
+  _fff_gmm_draw(list, n, N, seed, fit, 0);
   
   for (i=0 ; i<n ; i++){
     fff_array_set1d(Label_short,i,fff_array_get1d(Label,list[i])); 
@@ -80,117 +100,268 @@ static void _fff_clustering_subsample(fff_matrix* X_short, fff_array *Label_shor
 ********************* EM algorithm ******************************
 **********************************************************************/
 
-int fff_clustering_gmm_select( fff_matrix* Centers, fff_matrix* Precision,  fff_vector *Weights, fff_array *Label, const fff_matrix* X, const fff_vector *nbclust, const int maxiter, const double delta)
+/*
+   Independent fits, used by fff_clustering_gmm_select and
+   fff_clustering_gmm_ninit. Fit i has nbclust[i] clusters and draws
+   its initialization from the random stream (seed, i), so that it
+   does not depend on which thread runs it. Fits are interleaved
+   across threads, as their cost may grow with the number of
+   clusters, and each thread keeps its best model in private
+   buffers. The overall best is the one with the highest score, the
+   lowest index breaking ties, as in a serial loop.
+*/
+
+typedef struct {
+  fff_matrix* Centers; 
+  fff_matrix* Precision; 
+  fff_vector* Weights; 
+  fff_array* Label; 
+  long fit;                     /* index of the fit, or -1 */ 
+} _fff_gmm_model; 
+
+typedef struct {
+  const fff_matrix* X; 
+  const fff_array* Label;       /* initial labels */ 
+  const long* nbclust; 
+  long nfits; 
+  int prec_type; 
+  size_t prec_size2; 
+  int maxiter; 
+  double delta; 
+  unsigned long seed; 
+  int bic;                      /* penalize the scores */ 
+  double* L;                    /* score of each fit */ 
+  _fff_gmm_model* best;         /* best model of each thread */ 
+} _fff_gmm_restarts_job; 
+
+static void _fff_gmm_model_delete(_fff_gmm_model* M)
+{
+  if (M->fit < 0)
+    return; 
+  fff_matrix_delete(M->Centers);
+  fff_matrix_delete(M->Precision);
+  fff_vector_delete(M->Weights);
+  fff_array_delete(M->Label);
+  M->fit = -1; 
+}
+
+/* BIC-like penalty of the normalized log-likelihood */ 
+static double _fff_gmm_penalty(int prec_type, int k, int fd, int N)
+{
+  double nparams = 0; 
+
+  switch (prec_type) {
+  case 0: /* full cluster-based covariance*/
+    nparams = k*fd*(fd+3)/2+k-1; 
+    break; 
+  case 1: /*diagonal cluster-based covariance*/
+    nparams = k*fd*2+k-1; 
+    break; 
+  case 2:/*diagonal average covariance, constant weights*/
+    nparams = (k+1)*fd; 
+    break; 
+  }
+  return(nparams*log(N)/(2*N)); 
+}
+
+static void _fff_gmm_restarts_job_run(int rank, int nthreads, void* params)
+{
+  _fff_gmm_restarts_job* job = (_fff_gmm_restarts_job*)params; 
+  _fff_gmm_model* best = job->best + rank; 
+  _fff_gmm_model M; 
+  int N = job->X->size1; 
+  int fd = job->X->size2; 
+  long i; 
+  int k; 
+
+  for (i=rank; i<job->nfits; i+=nthreads) {
+    k = (int)job->nbclust[i]; 
+    M.fit = i; 
+    M.Centers = fff_matrix_new(k, fd); 
+    M.Precision = fff_matrix_new((job->prec_type==2) ? 1 : k, job->prec_size2); 
+    M.Weights = fff_vector_new(k); 
+    M.Label = fff_array_new1d(FFF_LONG, N); 
+    fff_array_copy(M.Label, job->Label); 
+
+    job->L[i] = _fff_clustering_gmm(M.Centers, M.Precision, M.Weights, M.Label, job->X, 
+				    job->maxiter, job->delta, N, 0, 1, job->seed, i); 
+    if (job->bic)
+      job->L[i] -= _fff_gmm_penalty(job->prec_type, k, fd, N); 
+
+    /* Fits are visited in increasing order, so ties keep the first */ 
+    if ((best->fit < 0) || (job->L[i] > job->L[best->fit])) {
+      _fff_gmm_model_delete(best); 
+      *best = M; 
+    }
+    else 
+      _fff_gmm_model_delete(&M); 
+  }
+}
+
+/* Run the fits and return the index of the best one, whose model is
+   copied into the first rows of Centers, Precision and Weights */ 
+static long _fff_gmm_restarts(double* L, fff_matrix* Centers, fff_matrix* Precision, fff_vector *Weights, fff_array *Label, 
+			      const fff_matrix* X, const long* nbclust, long nfits, int prec_type, 
+			      const int maxiter, const double delta, const int bic, const unsigned long seed, int nthreads)
+{
+  _fff_gmm_restarts_job job; 
+  _fff_gmm_model* B = NULL; 
+  fff_matrix block; 
+  fff_vector sub; 
+  long ib = -1; 
+  int t, k; 
+
+  nthreads = fff_threads_count(nthreads); 
+  if (nthreads > nfits)
+    nthreads = (nfits > 0) ? (int)nfits : 1; 
+
+  job.X = X; 
+  job.Label = Label; 
+  job.nbclust = nbclust; 
+  job.nfits = nfits; 
+  job.prec_type = prec_type; 
+  job.prec_size2 = Precision->size2; 
+  job.maxiter = maxiter; 
+  job.delta = delta; 
+  job.seed = seed; 
+  job.bic = bic; 
+  job.L = L; 
+  job.best = (_fff_gmm_model*)calloc(nthreads, sizeof(_fff_gmm_model)); 
+  if (job.best == NULL) {
+    FFF_ERROR("Out of memory", ENOMEM); 
+    return(-1); 
+  }
+  for (t=0; t<nthreads; t++)
+    job.best[t].fit = -1; 
+
+  fff_parallel_run(nthreads, &_fff_gmm_restarts_job_run, (void*)&job); 
+
+  for (t=0; t<nthreads; t++) {
+    if (job.best[t].fit < 0)
+      continue; 
+    if ((ib < 0) || (L[job.best[t].fit] > L[ib]) || 
+	((L[job.best[t].fit] == L[ib]) && (job.best[t].fit < ib))) {
+      ib = job.best[t].fit; 
+      B = job.best + t; 
+    }
+  }
+
+  if (B != NULL) {
+    k = B->Centers->size1; 
+    block = fff_matrix_block(Centers, 0, k, 0, Centers->size2); 
+    fff_matrix_memcpy(&block, B->Centers); 
+    block = fff_matrix_block(Precision, 0, B->Precision->size1, 0, Precision->size2); 
+    fff_matrix_memcpy(&block, B->Precision); 
+    sub = fff_vector_view(Weights->data, k, Weights->stride); 
+    fff_vector_memcpy(&sub, B->Weights); 
+    fff_array_copy(Label, B->Label); 
+  }
+
+  for (t=0; t<nthreads; t++)
+    _fff_gmm_model_delete(job.best + t); 
+  free(job.best); 
+
+  return(ib); 
+}
+
+static int _fff_gmm_prec_type(const fff_matrix* Precision, int fd)
+{
+  if ((Precision->size1)==1)
+    return(2);/*diagonal average covariance*/
+  if ((int)(Precision->size2)==fd*fd)
+    return(0);/* full cluster-based covariance*/
+  if ((int)(Precision->size2)==fd)
+    return(1);/*diagonal cluster-based covariance*/
+  return(-1); 
+}
+
+int fff_clustering_gmm_select( fff_matrix* Centers, fff_matrix* Precision,  fff_vector *Weights, fff_array *Label, const fff_matrix* X, const fff_vector *nbclust, const int maxiter, const double delta, const unsigned long seed, const int nthreads)
 {
   char* proc = "fff_clustering_gmm_select";
   int i;
-  double Li;
   double Lb = 0;
-  int N = X->size1;
   int fd = X->size2;
-  int fd2 = fd*fd;
-  int k;
-
-   int prec_type;
-  
-  if ((Precision->size1)==1)
-    prec_type = 2;
-  else
-    if ((int)(Precision->size2)==fd2)
-      prec_type = 0;
-    else {
-      if ((int)(Precision->size2)==fd)
-	prec_type = 1;
-      else return(0);
-    }
-
+  int prec_type = _fff_gmm_prec_type(Precision, fd);
   int ninit = nbclust->size;
-  double *bufn = nbclust->data;
   int kb = 0;
-  fff_matrix* Precision_aux = fff_matrix_new(Precision->size1, Precision->size2);
-  fff_array* Label_aux = fff_array_new1d( FFF_LONG,N);
-  fff_array* Label_init = fff_array_new1d( FFF_LONG,N);
-  fff_array_copy(Label_init,Label);
-  
-  for (i=0 ; i<ninit ; i++, bufn++){
-    k = (int)(*bufn);
-    fff_matrix* Centers_aux = fff_matrix_new(k, fd);
-    
-    fff_vector* Weights_aux = fff_vector_new(k);
-    fff_array_copy(Label_aux,Label_init);
-    
-    Li = fff_clustering_gmm(Centers_aux, Precision_aux, Weights_aux, Label_aux,X, maxiter, delta,N,0 );
+  long ib; 
 
-    switch (prec_type) {
-    case 0: /* full cluster-based covariance*/
-      Li = Li-(k*fd*(fd+3)/2+k-1)*log(N)/(2*N);
-      
-    case 1: /*diagonal cluster-based covariance*/
-      Li = Li-(k*fd*2+k-1)*log(N)/(2*N);
-    case 2:/*diagonal average covariance, constant weights*/
-      Li = Li-((k+1)*fd)*log(N)/(2*N);
-    }
-    
-    if(i==0) Lb = Li-1;
-    if (Li>Lb){
-      kb = k;
-      Lb = Li;
-      fff_matrix_memcpy(Centers,Centers_aux);
-      fff_matrix_memcpy(Precision,Precision_aux);
-      fff_vector_memcpy(Weights,Weights_aux);
-      fff_array_copy(Label, Label_aux); 
+  if (prec_type < 0)
+    return(0);
+
+  long* k = (long*)calloc(ninit, sizeof(long)); 
+  double* L = (double*)calloc(ninit, sizeof(double)); 
+  if ((k == NULL) || (L == NULL)) {
+    FFF_ERROR("Out of memory", ENOMEM); 
+    free(k); 
+    free(L); 
+    return(0); 
+  }
+  for (i=0 ; i<ninit ; i++)
+    k[i] = (long)fff_vector_get(nbclust, i); 
+
+  fff_matrix_set_all(Centers, 0); 
+  fff_vector_set_all(Weights, 0); 
+  ib = _fff_gmm_restarts(L, Centers, Precision, Weights, Label, X, k, ninit, prec_type, 
+			 maxiter, delta, 1, seed, nthreads); 
+
+  /* Same report as a serial search */ 
+  for (i=0 ; i<ninit ; i++){
+    if ((i==0) || (L[i]>Lb)) {
+      Lb = L[i];
+      kb = k[i];
     }
-    fff_matrix_delete(Centers_aux);    
-    fff_vector_delete(Weights_aux);
-    printf ("%s : %f %f %d\n",proc,Li,Lb,kb);
+    printf ("%s : %f %f %d\n",proc,L[i],Lb,kb);
   }
+  kb = (ib < 0) ? 0 : (int)k[ib]; 
 
-  fff_matrix_delete(Precision_aux);
-  fff_array_delete(Label_aux);
-  fff_array_delete(Label_init);
+  free(k); 
+  free(L); 
 
   return(kb);
 }
 
-extern double fff_clustering_gmm_ninit( fff_matrix* Centers, fff_matrix* Precision,  fff_vector *Weights, fff_array *Label, const fff_matrix* X, const int maxiter, const double delta, const int ninit )
+extern double fff_clustering_gmm_ninit( fff_matrix* Centers, fff_matrix* Precision,  fff_vector *Weights, fff_array *Label, const fff_matrix* X, const int maxiter, const double delta, const int ninit, const unsigned long seed, const int nthreads )
 {
   /* char* proc = "fff_clustering_gmm_ninit"; */
   int i;
-  double Li;
-  double Lb = 0;
-  int N = X->size1;
-  int k = Centers->size1;
   int fd = X->size2;
-  
-  fff_matrix* Centers_aux = fff_matrix_new(k, fd);
-  fff_matrix* Precision_aux = fff_matrix_new(Precision->size1, Precision->size2 );
-  fff_vector* Weights_aux = fff_vector_new(k);
-  fff_array* Label_aux = fff_array_new1d( FFF_LONG,N);
+  int prec_type = _fff_gmm_prec_type(Precision, fd);
+  double Lb = 0; 
+  long ib; 
+
+  if ((prec_type < 0) || (ninit < 1))
+    return(0);
+
+  long* k = (long*)calloc(ninit, sizeof(long)); 
+  double* L = (double*)calloc(ninit, sizeof(double)); 
+  if ((k == NULL) || (L == NULL)) {
+    FFF_ERROR("Out of memory", ENOMEM); 
+    free(k); 
+    free(L); 
+    return(0); 
+  }
+  for (i=0; i<ninit; i++)
+    k[i] = Centers->size1; 
+
   fff_matrix_set_all( Centers,0 );
   fff_matrix_set_all( Precision,0 );
   fff_vector_set_all( Weights,0 );
   fff_array_set_all( Label,-1 );
 
-  for (i=0; i<ninit; i++){
-    Li = fff_clustering_gmm(Centers_aux, Precision_aux, Weights_aux, Label_aux, X, maxiter, delta, N ,0);
-    
-    if(i==0) Lb = Li-1;
-    if (Li>Lb){
-      fff_matrix_memcpy(Centers, Centers_aux );
-      fff_matrix_memcpy(Precision, Precision_aux );
-      fff_array_copy(Label, Label_aux);
-      fff_vector_memcpy(Weights, Weights_aux);
-    }
-  }
-  fff_matrix_delete(Centers_aux);
-  fff_matrix_delete(Precision_aux);
-  fff_vector_delete(Weights_aux);
-  fff_array_delete(Label_aux);
+  ib = _fff_gmm_restarts(L, Centers, Precision, Weights, Label, X, k, ninit, prec_type, 
+			 maxiter, delta, 0, seed, nthreads); 
+  if (ib >= 0)
+    Lb = L[ib]; 
+
+  free(k); 
+  free(L); 
   
   return(Lb);
 } 
 
-extern int fff_gmm_relax( fff_vector* LogLike, fff_array* Labels, fff_matrix* Centers, fff_matrix* Precision, fff_vector* Weights, const fff_matrix* X, const int maxiter, const double delta)
+
+extern int fff_gmm_relax( fff_vector* LogLike, fff_array* Labels, fff_matrix* Centers, fff_matrix* Precision, fff_vector* Weights, const fff_matrix* X, const int maxiter, const double delta, const int nthreads)
 {
   char* proc = "fff_clustering_relax";
   int i;
@@ -216,11 +387,11 @@ extern int fff_gmm_relax( fff_vector* LogLike, fff_array* Labels, fff_matrix* Ce
   for (i=0; i<maxiter; i++){
     switch (prec_type) {
     case 0:{
-      Like->data[i] = _fff_update_gmm(Centers,Precision, Weights,X);
+      Like->data[i] = _fff_update_gmm(Centers,Precision, Weights,X,nthreads);
       break;
     }
     case 1:{
-      Like->data[i] = _fff_update_gmm_diag(Centers,Precision, Weights,X);
+      Like->data[i] = _fff_update_gmm_diag(Centers,Precision, Weights,X,nthreads);
 	  break;
     }
     case 2:{
@@ -241,14 +412,23 @@ extern int fff_gmm_relax( fff_vector* LogLike, fff_array* Labels, fff_matrix* Ce
     La = Like->data[i];
   }
     
-  La = fff_gmm_partition(LogLike, Labels, X, Centers, Precision,Weights);
+  La = fff_gmm_partition(LogLike, Labels, X, Centers, Precision,Weights,nthreads);
 
   fff_vector_delete( Like );
  
   return(La);
 }
 
-extern double fff_clustering_gmm( fff_matrix* Centers, fff_matrix* Precision,  fff_vector *Weights, fff_array *Label, const fff_matrix* X, const int maxiter, const double delta, const int chunksize, const int verbose )
+extern double fff_clustering_gmm( fff_matrix* Centers, fff_matrix* Precision,  fff_vector *Weights, fff_array *Label, const fff_matrix* X, const int maxiter, const double delta, const int chunksize, const int verbose, const int nthreads )
+{
+  double La; 
+  FFF_PROFILE_BEGIN(FFF_PROFILE_GMM); 
+  La = _fff_clustering_gmm(Centers, Precision, Weights, Label, X, maxiter, delta, chunksize, verbose, nthreads, 0, -1); 
+  FFF_PROFILE_END(FFF_PROFILE_GMM); 
+  return(La); 
+}
+
+static double _fff_clustering_gmm( fff_matrix* Centers, fff_matrix* Precision,  fff_vector *Weights, fff_array *Label, const fff_matrix* X, const int maxiter, const double delta, const int chunksize, const int verbose, const int nthreads, const unsigned long seed, const long fit )
 {
   char* proc = "fff_clustering_gmm";
   int i;
@@ -281,7 +461,7 @@ extern double fff_clustering_gmm( fff_matrix* Centers, fff_matrix* Precision,  f
     Label_short =  fff_array_new1d( FFF_LONG,chunksize);
     X_short = fff_matrix_new( chunksize, fd); 
     
-    _fff_clustering_subsample(X_short, Label_short, X, Label);
+    _fff_clustering_subsample(X_short, Label_short, X, Label, seed, fit);
     
   }
   else{
@@ -295,19 +475,20 @@ extern double fff_clustering_gmm( fff_matrix* Centers, fff_matrix* Precision,  f
 	_fff_GMM_init_hard(Centers,Precision,Weights,X_short,Label_short);
   }
   else{
-	_fff_GMM_init(Centers,Precision,Weights,X_short);
+	_fff_GMM_init(Centers,Precision,Weights,X_short,seed,fit);
   }
   
   fff_array *pa = fff_array_new1d(FFF_LONG,X->size1);
   fff_array *vo = fff_array_new1d(FFF_LONG,X->size1+1);
   for (i=0; i<maxiter; i++){
+    FFF_PROFILE_COUNT(FFF_PROFILE_EM_ITERATIONS, 1); 
     switch (prec_type) {
     case 0:{
-      Like->data[i] = _fff_update_gmm(Centers,Precision, Weights, X_short);
+      Like->data[i] = _fff_update_gmm(Centers,Precision, Weights, X_short, nthreads);
       break;
     }
     case 1:{
-      Like->data[i] = _fff_update_gmm_diag(Centers,Precision, Weights,X_short);
+      Like->data[i] = _fff_update_gmm_diag(Centers,Precision, Weights,X_short,nthreads);
       /* Like->data[i] = _fff_update_gmm_diag_dev(X_short,Centers,Precision, Weights,&pa,vo); */
 		break;
     }
@@ -331,7 +512,7 @@ extern double fff_clustering_gmm( fff_matrix* Centers, fff_matrix* Precision,  f
   }
   
   
-  La = _fff_gmm_partition(Label, X, Centers, Precision,Weights);
+  La = _fff_gmm_partition(Label, X, Centers, Precision,Weights,nthreads);
 
   fff_array_delete(pa);
   fff_array_delete(vo);
@@ -342,7 +523,7 @@ extern double fff_clustering_gmm( fff_matrix* Centers, fff_matrix* Precision,  f
   return(La);
 }
 
-int _fff_GMM_init(fff_matrix* Centers,fff_matrix* Precision, fff_vector *Weights,fff_matrix* X)
+int _fff_GMM_init(fff_matrix* Centers,fff_matrix* Precision, fff_vector *Weights,fff_matrix* X, unsigned long seed, long fit)
 {
   /* char* proc = "_fff_gmm_init";*/
   int fd = X->size2;   
@@ -360,7 +541,7 @@ int _fff_GMM_init(fff_matrix* Centers,fff_matrix* Precision, fff_vector *Weights
   fff_vector_set_all(Weights, 1./k);
   
   /* init the centers */
-  fff_rng_draw_noreplace(seeds, k, N);
+  _fff_gmm_draw(seeds, k, N, seed, fit, 1);
   
   for (j=0 ; j<k ; j++){
     fff_matrix_get_row(v,X,seeds[j]);
@@ -393,6 +574,7 @@ int _fff_GMM_init(fff_matrix* Centers,fff_matrix* Precision, fff_vector *Weights
   case 0:{   
     fff_matrix* precision = fff_matrix_new(fd, fd);
     fff_matrix* covariance = fff_matrix_new(fd, fd);
+    fff_matrix C, P;
     fff_matrix_set_all( covariance,0);
     
     /* compute the global covariance */
@@ -405,7 +587,9 @@ int _fff_GMM_init(fff_matrix* Centers,fff_matrix* Precision, fff_vector *Weights
     fff_matrix_scale(covariance,1.0/N);
 		
 	/* Derive a precision estimate */
-    fff_lapack_inv_sym(precision,covariance);
+    C = fff_matrix_view(covariance->data, 1, fd2, fd2);
+    P = fff_matrix_view(precision->data, 1, fd2, fd2);
+    fff_lapack_inv_sym_batch(&P, NULL, &C);
 	 
     for (l=0 ; l<fd ; l++)
       for (l2=0 ; l2<fd ; l2++){
@@ -508,6 +692,7 @@ int _fff_GMM_init_hard(fff_matrix* Centers,fff_matrix* Precision, fff_vector *We
     case 0:{   
     fff_matrix* precision = fff_matrix_new(fd, fd);
     fff_matrix* covariance = fff_matrix_new(fd, fd);
+    fff_matrix C, P;
     
     fff_matrix_set_all (covariance,0);
     double aux;
@@ -521,7 +706,9 @@ int _fff_GMM_init_hard(fff_matrix* Centers,fff_matrix* Precision, fff_vector *We
     }
     
     fff_matrix_scale(covariance,1.0/N);
-    fff_lapack_inv_sym(precision,covariance);
+    C = fff_matrix_view(covariance->data, 1, fd2, fd2);
+    P = fff_matrix_view(precision->data, 1, fd2, fd2);
+    fff_lapack_inv_sym_batch(&P, NULL, &C);
     
     /* Derive a precision estimate */
     /* todo : improve this by using vector views */
@@ -591,107 +778,405 @@ int _fff_GMM_init_hard(fff_matrix* Centers,fff_matrix* Precision, fff_vector *We
   return(1);
 }
 
-double _fff_update_gmm(fff_matrix* Centers, fff_matrix* Precision,  fff_vector *Weights, const fff_matrix* X)
+/* 
+   Blocked E-step of the heteroscedastic models.
+
+   For a full precision P = L L', the Mahalanobis distances of a block
+   of samples Y = X - mu are the squared row norms of Y L, which is a
+   single triangular product. The factors are computed once per
+   iteration; a precision that is not positive definite is used as is
+   through a general product. Responsibilities are normalized with a
+   log-sum-exp, so that distant samples keep their memberships
+   instead of underflowing. Blocks of samples are split across
+   threads, each of which accumulates its own sufficient statistics;
+   these are summed in rank order, so the result only depends on
+   the number of threads through rounding errors.
+
+   In the diagonal model, components whose distance exceeds thq are
+   discarded unless all of them are.
+*/
+
+typedef struct {
+  int k; 
+  int fd; 
+  int full;                     /* full precisions, otherwise diagonal */ 
+  double thq;                   /* truncation threshold, or 0 */ 
+  const fff_matrix* Centers; 
+  const fff_matrix* Precision; 
+  double* factors;              /* k*fd*fd Cholesky factors or precisions */ 
+  int* chol;                    /* whether factor j is a Cholesky factor */ 
+  double* logc;                 /* log(weight * sqrt(det(precision))) */ 
+} _fff_gmm_dens; 
+
+typedef struct {
+  const _fff_gmm_dens* D; 
+  const fff_matrix* X; 
+  double llmin;                 /* log-likelihood of vanishing samples */ 
+  int update;                   /* accumulate sufficient statistics */ 
+  size_t nblocks; 
+  size_t size;                  /* per-thread work size */ 
+  double* work; 
+  long* nvanish; 
+  fff_vector* LogLike; 
+  fff_array* Labels; 
+} _fff_gmm_estep_job; 
+
+static _fff_gmm_dens* _fff_gmm_dens_new(const fff_matrix* Centers, const fff_matrix* Precision, 
+					const fff_vector* Weights, int full, double thq)
+{
+  _fff_gmm_dens* D = (_fff_gmm_dens*)malloc(sizeof(_fff_gmm_dens)); 
+  int k = Centers->size1, fd = Centers->size2; 
+  int j, l; 
+  fff_matrix F; 
+  fff_vector* logdet; 
+  fff_array* info; 
+  double logd; 
+
+  D->k = k; 
+  D->fd = fd; 
+  D->full = full; 
+  D->thq = thq; 
+  D->Centers = Centers; 
+  D->Precision = Precision; 
+  D->factors = NULL; 
+  D->chol = NULL; 
+  D->logc = (double*)malloc(k*sizeof(double)); 
+
+  if (!full) {
+    for (j=0 ; j<k ; j++){
+      logd = 1; 
+      for (l=0 ; l<fd ; l++)
+	logd *= fff_matrix_get(Precision,j,l); 
+      D->logc[j] = log(fff_vector_get(Weights,j)) + 0.5*log(logd); 
+    }
+    return D; 
+  }
+
+  logdet = fff_vector_new(k); 
+  info = fff_array_new1d(FFF_INT,k); 
+  /* Factors, or precisions where the factorization fails */ 
+  D->factors = (double*)malloc(k*fd*fd*sizeof(double)); 
+  D->chol = (int*)malloc(k*sizeof(int)); 
+  F = fff_matrix_view(D->factors, k, fd*fd, fd*fd); 
+  fff_matrix_memcpy(&F, Precision); 
+  fff_lapack_chol_batch(&F, logdet, info); 
+  for (j=0 ; j<k ; j++){
+    D->chol[j] = (fff_array_get1d(info,j) == 0); 
+    D->logc[j] = log(fff_vector_get(Weights,j)) + 0.5*fff_vector_get(logdet,j); 
+  }
+  fff_vector_delete(logdet); 
+  fff_array_delete(info); 
+
+  return D; 
+}
+
+static void _fff_gmm_dens_delete(_fff_gmm_dens* D)
+{
+  free(D->factors); 
+  free(D->chol); 
+  free(D->logc); 
+  free(D); 
+}
+
+/* Centered block Y = Xb - mu_j */ 
+static void _fff_gmm_center_block(fff_matrix* Y, const fff_matrix* Xb, const fff_matrix* Centers, int j)
+{
+  size_t i, l; 
+  const double *bufx, *bufc = Centers->data + j*Centers->tda; 
+  double *bufy; 
+
+  for (i=0 ; i<Xb->size1 ; i++){
+    bufx = Xb->data + i*Xb->tda; 
+    bufy = Y->data + i*Y->tda; 
+    for (l=0 ; l<Xb->size2 ; l++)
+      bufy[l] = bufx[l] - bufc[l]; 
+  }
+}
+
+/* Q (nb*k) receives the distances of the block Xb to all components */ 
+static void _fff_gmm_quad_block(double* Q, const _fff_gmm_dens* D, const fff_matrix* Xb, 
+				fff_matrix* Y, fff_matrix* Z)
 {
-   char* proc = "_fff_update_gmm"; 
+  int k = D->k, fd = D->fd; 
+  size_t i, nb = Xb->size1; 
+  int j, l; 
+  const double *bufx, *bufc, *bufp; 
+  double *bufy, *bufz, quad, aux; 
+  fff_matrix F; 
+
+  for (j=0 ; j<k ; j++){
+    if (!D->full) {
+      bufc = D->Centers->data + j*D->Centers->tda; 
+      bufp = D->Precision->data + j*D->Precision->tda; 
+      for (i=0 ; i<nb ; i++){
+	bufx = Xb->data + i*Xb->tda; 
+	for (l=0, quad=0 ; l<fd ; l++){
+	  aux = bufx[l] - bufc[l]; 
+	  quad += aux*aux*bufp[l]; 
+	}
+	Q[i*k+j] = quad; 
+      }
+      continue; 
+    }
+    
+    _fff_gmm_center_block(Y, Xb, D->Centers, j); 
+    F = fff_matrix_view(D->factors + j*fd*fd, fd, fd, fd); 
+    if (D->chol[j]) {
+      fff_blas_dtrmm(CblasRight, CblasLower, CblasNoTrans, CblasNonUnit, 1.0, &F, Y); 
+      for (i=0 ; i<nb ; i++){
+	bufy = Y->data + i*Y->tda; 
+	for (l=0, quad=0 ; l<fd ; l++)
+	  quad += bufy[l]*bufy[l]; 
+	Q[i*k+j] = quad; 
+      }
+    }
+    else {
+      fff_blas_dgemm(CblasNoTrans, CblasNoTrans, 1.0, Y, &F, 0.0, Z); 
+      for (i=0 ; i<nb ; i++){
+	bufy = Y->data + i*Y->tda; 
+	bufz = Z->data + i*Z->tda; 
+	for (l=0, quad=0 ; l<fd ; l++)
+	  quad += bufy[l]*bufz[l]; 
+	Q[i*k+j] = quad; 
+      }
+    }
+  }
+}
+
+/* 
+   Replaces the distances q (size k) of a sample by its
+   responsibilities, and returns the log-likelihood of the sample
+   up to the Gaussian constant (llmin if it vanishes). The most
+   likely component is written in label, or -1.
+*/
+static double _fff_gmm_resp(double* q, long* label, const _fff_gmm_dens* D, double llmin)
+{
+  int j, k = D->k, trunc = 0; 
+  double m = FFF_NEGINF, s = 0; 
+
+  /* Check whether some component survives the truncation */ 
+  if (D->thq > 0) 
+    for (j=0 ; j<k ; j++)
+      if ((q[j] <= D->thq) && (D->logc[j] - q[j]/2 > FFF_NEGINF)) {
+	trunc = 1; 
+	break; 
+      }
+  
+  *label = -1; 
+  for (j=0 ; j<k ; j++){
+    if (trunc && (q[j] > D->thq)) 
+      q[j] = FFF_NEGINF; 
+    else
+      q[j] = D->logc[j] - q[j]/2; 
+    if (q[j] > m) {
+      m = q[j]; 
+      *label = j; 
+    }
+  }
+  
+  if (m == FFF_NEGINF) {
+    for (j=0 ; j<k ; j++)
+      q[j] = 0; 
+    return llmin; 
+  }
+
+  for (j=0 ; j<k ; j++){
+    q[j] = exp(q[j] - m); 
+    s += q[j]; 
+  }
+  for (j=0 ; j<k ; j++)
+    q[j] /= s; 
+
+  return m + log(s); 
+}
+
+/* 
+   Per-thread work layout: Y, Z (GMM_BLOCK*fd), Q (GMM_BLOCK*k), then
+   the accumulators Centers_new (k*fd), Covariance (k*fd*fd or k*fd),
+   Weights_new (k) and the log-likelihood (1).
+*/ 
+static void _fff_gmm_estep_job_run(int rank, int nthreads, void* params)
+{
+  _fff_gmm_estep_job* job = (_fff_gmm_estep_job*)params; 
+  const _fff_gmm_dens* D = job->D; 
+  const fff_matrix* X = job->X; 
+  int k = D->k, fd = D->fd, fdc = D->full ? fd*fd : fd; 
+  double* work = job->work + rank*job->size; 
+  double *bufy = work, *bufz = bufy + GMM_BLOCK*fd, *Q = bufz + GMM_BLOCK*fd; 
+  double *Cn = Q + GMM_BLOCK*k, *Cov = Cn + k*fd, *Wn = Cov + k*fdc, *L = Wn + k; 
+  size_t b, b0, b1, i, i0, nb; 
+  int j, l; 
+  long label; 
+  double ll, r, aux, *q; 
+  const double *bufx, *bufc; 
+  fff_matrix Xb, Y, Z, R, Cnm, Covj; 
+
+  fff_parallel_range(job->nblocks, rank, nthreads, &b0, &b1); 
+  Cnm = fff_matrix_view(Cn, k, fd, fd); 
+
+  for (b=b0 ; b<b1 ; b++){
+    i0 = b*GMM_BLOCK; 
+    nb = FFF_MIN(GMM_BLOCK, X->size1-i0); 
+    Xb = fff_matrix_view(X->data + i0*X->tda, nb, fd, X->tda); 
+    Y = fff_matrix_view(bufy, nb, fd, fd); 
+    Z = fff_matrix_view(bufz, nb, fd, fd); 
+    
+    _fff_gmm_quad_block(Q, D, &Xb, &Y, &Z); 
+    for (i=0 ; i<nb ; i++){
+      q = Q + i*k; 
+      ll = _fff_gmm_resp(q, &label, D, job->llmin); 
+      if (label < 0)
+	job->nvanish[rank] ++; 
+      if (job->update) {
+	*L += ll; 
+	for (j=0 ; j<k ; j++)
+	  Wn[j] += q[j]; 
+      }
+      else {
+	fff_vector_set(job->LogLike, i0+i, ll); 
+	fff_array_set1d(job->Labels, i0+i, label); 
+      }
+    }
+    if (!job->update)
+      continue; 
+
+    /* Sufficient statistics, covariances around the current centers */
+    R = fff_matrix_view(Q, nb, k, k); 
+    fff_blas_dgemm(CblasTrans, CblasNoTrans, 1.0, &R, &Xb, 1.0, &Cnm); 
+    for (j=0 ; j<k ; j++){
+      if (!D->full) {
+	bufc = D->Centers->data + j*D->Centers->tda; 
+	for (i=0 ; i<nb ; i++){
+	  r = Q[i*k+j]; 
+	  if (r <= 0)
+	    continue; 
+	  bufx = Xb.data + i*Xb.tda; 
+	  for (l=0 ; l<fd ; l++){
+	    aux = bufx[l] - bufc[l]; 
+	    Cov[j*fd+l] += r*aux*aux; 
+	  }
+	}
+	continue; 
+      }
+      _fff_gmm_center_block(&Y, &Xb, D->Centers, j); 
+      for (i=0 ; i<nb ; i++){
+	r = Q[i*k+j]; 
+	for (l=0 ; l<fd ; l++)
+	  bufz[i*fd+l] = r*bufy[i*fd+l]; 
+      }
+      Covj = fff_matrix_view(Cov + j*fdc, fd, fd, fd); 
+      fff_blas_dgemm(CblasTrans, CblasNoTrans, 1.0, &Z, &Y, 1.0, &Covj); 
+    }
+  }
+
+  return; 
+}
+
+/* 
+   Runs the E-step of D on X. If Centers_new is not NULL, the
+   unnormalized sufficient statistics are written in Centers_new,
+   Covariance and Weights_new, and the summed log-likelihood in L.
+   Otherwise, the sample log-likelihoods and labels are written in
+   LogLike and Labels. Log-likelihoods are given up to the Gaussian
+   constant. Returns the number of samples whose likelihood
+   vanished.
+*/
+static long _fff_gmm_estep(double* L, const _fff_gmm_dens* D, const fff_matrix* X, double llmin, 
+			   fff_matrix* Centers_new, fff_matrix* Covariance, fff_vector* Weights_new, 
+			   fff_vector* LogLike, fff_array* Labels, int nthreads)
+{
+  _fff_gmm_estep_job job; 
+  int k = D->k, fd = D->fd, fdc = D->full ? fd*fd : fd; 
+  int t, j, l; 
+  long nvanish = 0; 
+  double *acc; 
+
+  job.D = D; 
+  job.X = X; 
+  job.llmin = llmin; 
+  job.update = (Centers_new != NULL); 
+  job.nblocks = (X->size1 + GMM_BLOCK - 1)/GMM_BLOCK; 
+  job.size = GMM_BLOCK*(2*fd+k) + k*(fd+fdc+1) + 1; 
+  job.LogLike = LogLike; 
+  job.Labels = Labels; 
+
+  nthreads = fff_threads_count(nthreads); 
+  if (nthreads > (int)job.nblocks)
+    nthreads = (job.nblocks > 0) ? (int)job.nblocks : 1; 
+  job.work = (double*)calloc(nthreads*job.size, sizeof(double)); 
+  job.nvanish = (long*)calloc(nthreads, sizeof(long)); 
+  if ((job.work == NULL) || (job.nvanish == NULL)) {
+    FFF_ERROR("Cannot allocate the E-step buffers", ENOMEM); 
+    free(job.work); 
+    free(job.nvanish); 
+    return 0; 
+  }
+
+  fff_parallel_run(nthreads, &_fff_gmm_estep_job_run, (void*)&job); 
+
+  /* Reduce the thread accumulators in rank order */ 
+  if (job.update) {
+    fff_matrix_set_all(Centers_new, 0); 
+    fff_matrix_set_all(Covariance, 0); 
+    fff_vector_set_all(Weights_new, 0); 
+    *L = 0; 
+  }
+  for (t=0 ; t<nthreads ; t++){
+    nvanish += job.nvanish[t]; 
+    if (!job.update)
+      continue; 
+    acc = job.work + t*job.size + GMM_BLOCK*(2*fd+k); 
+    for (j=0 ; j<k ; j++){
+      for (l=0 ; l<fd ; l++)
+	Centers_new->data[j*Centers_new->tda+l] += acc[j*fd+l]; 
+      for (l=0 ; l<fdc ; l++)
+	Covariance->data[j*Covariance->tda+l] += acc[k*fd+j*fdc+l]; 
+      Weights_new->data[j*Weights_new->stride] += acc[k*(fd+fdc)+j]; 
+    }
+    *L += acc[k*(fd+fdc+1)]; 
+  }
+
+  free(job.work); 
+  free(job.nvanish); 
+
+  return nvanish; 
+}
+
+
+double _fff_update_gmm(fff_matrix* Centers, fff_matrix* Precision,  fff_vector *Weights, const fff_matrix* X, int nthreads)
+{
+  char* proc = "_fff_update_gmm"; 
   double L = 0;
 
   int fd = X->size2;   
   int fd2 = fd*fd;
   int k = Centers->size1;
   int N = X->size1;
-  int i,j,l,l1,l2;
+  int j,l;
+  long nvanish; 
   
   fff_matrix* Centers_new = fff_matrix_new(k, fd);
   fff_matrix* Covariance = fff_matrix_new(k,fd2);
   fff_vector* Weights_new = fff_vector_new(k);
-  fff_vector* aux = fff_vector_new(fd);
-  fff_vector* v = fff_vector_new(fd);
   fff_vector* w = fff_vector_new(fd);
-  fff_vector* sqr_dets = fff_vector_new(k);
-  fff_vector* resp = fff_vector_new(k);
-  fff_matrix* precision = fff_matrix_new(fd, fd);
-  fff_matrix* covariance = fff_matrix_new(fd, fd);
-
-  fff_matrix_set_all (Centers_new,0);
-  fff_vector_set_all (Weights_new,0);
-  fff_matrix_set_all (Covariance,0);
+  _fff_gmm_dens* D; 
   
-  double temp, quad, sumr, daux;
+  double temp;
   double thq = 4*fd;
  
-  /* Pre-compute the determinants of precision matrices */
-  for (j=0 ; j<k ; j++){
-    for (l1=0 ; l1<fd ; l1++)
-      for (l2=0 ; l2<fd ; l2++){
-		temp = fff_matrix_get(Precision,j,l1*fd+l2);
-		fff_matrix_set(precision,l1,l2,temp);
-      }
-	fff_vector_set(sqr_dets,j,sqrt(fff_lapack_det_sym(precision)));
-  }
-
-  for (i=0 ; i<N ; i++){
-    fff_vector_set_all(resp,0);
-    sumr = 0;
-    /* compute the responsabilities */
-    for (j=0 ; j<k ; j++){   
-      for (l1=0 ; l1<fd ; l1++)
-		for (l2=0 ; l2<fd ; l2++){
-		  temp = fff_matrix_get(Precision,j,l1*fd+l2);
-		  fff_matrix_set(precision,l1,l2,temp);
-		}
-      
-      fff_matrix_get_row(aux,X,i);
-      fff_matrix_get_row(v,Centers,j);
-      fff_vector_sub(aux,v);
-      
-      fff_vector_set_all(v,0);
-      fff_blas_dgemv (CblasNoTrans, 1., precision, aux, 0, v);
-      quad = fff_blas_ddot (v, aux);
-      
-      temp = exp(-quad/2) * fff_vector_get(Weights,j) *fff_vector_get(sqr_dets,j);
-      
-	  fff_vector_set(resp,j,temp);
-      sumr += temp;
-    }
-    if (sumr==0){
-      sumr = exp(-thq/2);
-      printf ("%s : %d %f \n",proc, i,sumr);    
-    }
-    
-    L = L+log(sumr);
-
-    /* update the empirical mean and covariance */
-    fff_vector_scale(resp, 1./sumr);
-    fff_vector_add(Weights_new,resp);
-    fff_matrix_get_row(aux,X,i);
-    for (j=0 ; j<k ; j++) {
-      temp = fff_vector_get(resp,j);
-      fff_vector_memcpy(v,aux);
-      fff_vector_scale(v,temp);
-      fff_matrix_get_row(w,Centers_new,j);
-      fff_vector_add(v,w);
-      fff_matrix_set_row(Centers_new,j,v);
-      
-      fff_matrix_set_all(covariance,0);
-      fff_matrix_get_row(w,Centers,j);
-      fff_vector_sub(w,aux);
-      fff_blas_dger (1, w, w, covariance);
-      for (l1=0 ; l1<fd ; l1++)
-		for (l2=0 ; l2<fd ; l2++){
-		  daux = fff_matrix_get(covariance,l1,l2);
-		  daux *= temp;
-		  fff_matrix_set(Covariance,j,l1*fd+l2,daux + fff_matrix_get(Covariance,j,l1*fd+l2)); 
-		}
-    }
-  }
+  /* compute the responsabilities and the empirical mean and covariance */
+  D = _fff_gmm_dens_new(Centers, Precision, Weights, 1, 0); 
+  nvanish = _fff_gmm_estep(&L, D, X, -thq/2, Centers_new, Covariance, Weights_new, NULL, NULL, nthreads); 
+  _fff_gmm_dens_delete(D); 
+  if (nvanish > 0)
+    printf ("%s : %ld samples with vanishing likelihood \n",proc, nvanish);    
   
   /* normalize the values */ 
   for (j=0 ; j<k ; j++){
     if (fff_vector_get(Weights_new,j)==0){
       printf("%s : %d \n",proc,j);
-      fff_vector_set_all(v,0);
-      fff_matrix_set_row(Centers_new,j,v);
+      fff_vector_set_all(w,0);
+      fff_matrix_set_row(Centers_new,j,w);
       for (l=0 ; l<fd2 ; l++)
 	fff_matrix_set(Covariance,j,l,0);
     }
@@ -709,17 +1194,7 @@ double _fff_update_gmm(fff_matrix* Centers, fff_matrix* Precision,  fff_vector *
   L /= N;
   
   /* Compute precision from the covariance */
-  for (j=0 ; j<k ; j++){
-    for (l1=0 ; l1<fd ; l1++)
-      for (l2=0 ; l2<fd ; l2++)
-	fff_matrix_set(covariance,l1,l2,fff_matrix_get(Covariance,j,l1*fd+l2));
-    
-    fff_lapack_inv_sym(precision,covariance);
-    
-    for (l1=0 ; l1<fd ; l1++)
-      for (l2=0 ; l2<fd ; l2++)
-	fff_matrix_set(Precision,j,l1*fd+l2,fff_matrix_get(precision,l1,l2));
-  }
+  fff_lapack_inv_sym_batch(Precision, NULL, Covariance);
  
   fff_matrix_memcpy(Centers, Centers_new);
   fff_vector_memcpy(Weights, Weights_new);
@@ -727,19 +1202,13 @@ double _fff_update_gmm(fff_matrix* Centers, fff_matrix* Precision,  fff_vector *
 
   fff_matrix_delete(Centers_new);
   fff_matrix_delete(Covariance);
-  fff_matrix_delete(covariance);
-  fff_matrix_delete(precision);
   fff_vector_delete(Weights_new);
-  fff_vector_delete(resp);
-  fff_vector_delete(aux);
-  fff_vector_delete(v);
   fff_vector_delete(w);
-  fff_vector_delete(sqr_dets);
   
   return(L-0.5*fd*log(2*M_PI));
 }
 
-double _fff_update_gmm_diag(fff_matrix* Centers, fff_matrix* Precision,  fff_vector *Weights, const fff_matrix* X )
+double _fff_update_gmm_diag(fff_matrix* Centers, fff_matrix* Precision,  fff_vector *Weights, const fff_matrix* X, int nthreads )
 {
   char* proc = "fff_update_gmm_diag"; 
   double L = 0;
@@ -747,85 +1216,24 @@ double _fff_update_gmm_diag(fff_matrix* Centers, fff_matrix* Precision,  fff_vec
   int fd = X->size2;   
   int k = Centers->size1;
   int N = X->size1;
-  int i,j,l;
+  int j,l;
+  long nvanish; 
   
   fff_matrix* Centers_new = fff_matrix_new(k, fd);
   fff_matrix* Covariance = fff_matrix_new(k,fd);
   fff_vector* Weights_new = fff_vector_new(k);
-  fff_vector* sqr_dets = fff_vector_new(k);
-  fff_vector* resp = fff_vector_new(k);
   fff_vector* v = fff_vector_new(fd);
+  _fff_gmm_dens* D; 
 
-  fff_matrix_set_all( Centers_new,0);
-  fff_vector_set_all( Weights_new,0);
-  fff_matrix_set_all( Covariance,0);
-  
-  double quad, sumr, sqr_det , aux, temp;
+  double temp;
   double thq = 4*fd;
   
-  /* Pre-compute the determinants of precision matrices */  
-  for (j=0 ; j<k ; j++){
-    sqr_det = 1;
-    for (l=0 ; l<fd ; l++)
-      sqr_det *= fff_matrix_get(Precision,j,l);
-    fff_vector_set(sqr_dets,j,sqrt(sqr_det));
-  }
-  
-  for (i=0 ; i<N ; i++){
-    fff_vector_set_all( resp,0);
-    sumr = 0;
-
-    /* compute the responsabilities: quick method */
-    for (j=0 ; j<k ; j++){     
-      quad = 0;
-      for (l=0 ; l<fd ; l++){
-		aux = fff_matrix_get(X,i,l) - fff_matrix_get(Centers,j,l);
-		quad += (aux * aux * fff_matrix_get(Precision,j,l));
-		if (quad >thq) break;
-      }
-      if (quad>thq)
-		fff_vector_set(resp,j,0);
-      else{
-		temp = fff_vector_get(sqr_dets,j)*fff_vector_get(Weights,j)*exp(-quad/2);
-		fff_vector_set(resp, j, temp);
-		sumr += fff_vector_get(resp,j);
-      }
-    }
-    if (sumr==0){
-      /* compute the responsabilities */
-      for (j=0 ; j<k ; j++){     
-		quad = 0;
-		for (l=0 ; l<fd ; l++){
-		  aux = fff_matrix_get(X,i,l) - fff_matrix_get(Centers,j,l);
-		  temp = fff_matrix_get(Precision,j,l);
-		  quad += (aux * aux * temp);
-		}
-		temp = fff_vector_get(sqr_dets,j)*fff_vector_get(Weights,j)*exp(-quad/2);
-		fff_vector_set(resp, j, temp);
-	sumr += temp;
-      }
-    }
-    if (sumr==0){
-      printf ("%s : %d %f \n", proc, i,sumr);
-      sumr = exp(-thq/2);
-    }
-    L = L+log(sumr);
-    
-    /* update the empirical mean and covariance */
-    fff_vector_scale(resp,1./sumr);
-    for (j=0 ; j<k ; j++) {
-      temp = fff_vector_get(resp,j);
-      if (temp>0){
-	for (l=0 ; l<fd ; l++){
-	  aux = fff_matrix_get(X,i,l);
-	  fff_matrix_set(Centers_new, j,l, temp*aux + fff_matrix_get(Centers_new,j,l));
-	  aux -= fff_matrix_get(Centers,j,l);
-	  fff_matrix_set(Covariance, j,l,aux * aux * temp+ fff_matrix_get(Covariance,j,l));
-	}
-      }
-    }
-    fff_vector_add(Weights_new,resp);
-  }
+  /* compute the responsabilities and the empirical mean and covariance */
+  D = _fff_gmm_dens_new(Centers, Precision, Weights, 0, thq); 
+  nvanish = _fff_gmm_estep(&L, D, X, -thq/2, Centers_new, Covariance, Weights_new, NULL, NULL, nthreads); 
+  _fff_gmm_dens_delete(D); 
+  if (nvanish > 0)
+    printf ("%s : %ld samples with vanishing likelihood \n", proc, nvanish);
 
   /* normalize */ 
   for (j=0 ; j<k ; j++){
@@ -864,14 +1272,152 @@ double _fff_update_gmm_diag(fff_matrix* Centers, fff_matrix* Precision,  fff_vec
   fff_matrix_delete(Centers_new);
   fff_matrix_delete(Covariance);
   fff_vector_delete(Weights_new);
-  fff_vector_delete(resp);
-  fff_vector_delete(sqr_dets);
   fff_vector_delete(v);
 
   return(L-0.5*fd*log(2*M_PI));
 }
 
 
+/* 
+   Mini-batch EM. The second-order moments of a chunk are obtained
+   from its covariances around the current centers mu, as
+   sum r x x' = sum r (x-mu)(x-mu)' + mu m' + m mu' - w mu mu'
+   where w = sum r and m = sum r x.
+*/
+
+extern double fff_gmm_stats_update(fff_vector* W, fff_matrix* M, fff_matrix* S, const fff_matrix* X, const fff_matrix* Centers, const fff_matrix* Precision, const fff_vector* Weights, const double step, const int nthreads)
+{
+  int fd = X->size2;
+  int k = Centers->size1;
+  int N = X->size1;
+  int full, fdc, j, l, l1, l2;
+  double L = 0, thq = 4*fd, a = 1-step, b, wj;
+  double *mu, *m, *c, *s;
+  _fff_gmm_dens* D;
+
+  if ((Precision->size1==1) && (k>1)){
+    FFF_ERROR("Homoscedastic models are not handled", EDOM);
+    return(0);
+  }
+  full = ((int)Precision->size2==fd*fd) && (fd>1);
+  fdc = full ? fd*fd : fd;
+  if ((X->size2 != Centers->size2) || ((int)Precision->size2 != fdc) || ((int)S->size2 != fdc)){
+    FFF_ERROR(" Inconsistant matrix sizes \n",EFAULT);
+    return(0);
+  }
+  if (N==0)
+    return(0);
+  b = step/N;
+  if (a<=0){
+    /* unit steps discard the previous, possibly uninitialized, statistics */
+    a = 0;
+    fff_vector_set_all(W,0);
+    fff_matrix_set_all(M,0);
+    fff_matrix_set_all(S,0);
+  }
+
+  fff_matrix* Centers_new = fff_matrix_new(k, fd);
+  fff_matrix* Covariance = fff_matrix_new(k, fdc);
+  fff_vector* Weights_new = fff_vector_new(k);
+
+  D = _fff_gmm_dens_new(Centers, Precision, Weights, full, full ? 0 : thq);
+  _fff_gmm_estep(&L, D, X, -thq/2, Centers_new, Covariance, Weights_new, NULL, NULL, nthreads);
+  _fff_gmm_dens_delete(D);
+  
+  /* blend the chunk statistics into the running averages */
+  for (j=0 ; j<k ; j++){
+    wj = fff_vector_get(Weights_new,j);
+    mu = Centers->data + j*Centers->tda;
+    m = Centers_new->data + j*Centers_new->tda;
+    c = Covariance->data + j*Covariance->tda;
+    s = S->data + j*S->tda;
+    if (full) {
+      for (l1=0 ; l1<fd ; l1++)
+	for (l2=0 ; l2<fd ; l2++){
+	  l = l1*fd+l2;
+	  s[l] = a*s[l] + b*(c[l] + mu[l1]*m[l2] + m[l1]*mu[l2] - wj*mu[l1]*mu[l2]);
+	}
+    }
+    else 
+      for (l=0 ; l<fd ; l++)
+	s[l] = a*s[l] + b*(c[l] + (2*m[l] - wj*mu[l])*mu[l]);
+    for (l=0 ; l<fd ; l++)
+      fff_matrix_set(M,j,l,a*fff_matrix_get(M,j,l) + b*m[l]);
+    fff_vector_set(W,j,a*fff_vector_get(W,j) + b*wj);
+  }
+  
+  fff_matrix_delete(Centers_new);
+  fff_matrix_delete(Covariance);
+  fff_vector_delete(Weights_new);
+
+  return(L/N-0.5*fd*log(2*M_PI));
+}
+
+extern int fff_gmm_stats_model(fff_matrix* Centers, fff_matrix* Precision, fff_vector* Weights, const fff_vector* W, const fff_matrix* M, const fff_matrix* S)
+{
+  int fd = Centers->size2;
+  int k = Centers->size1;
+  int full = ((int)Precision->size2==fd*fd) && (fd>1);
+  int j, l, l1, l2, nc = 0;
+  double wj, sw = 0, temp;
+  fff_matrix* covariance = NULL;
+  fff_matrix C;
+  int* comps = NULL;
+
+  /* covariances of the non-empty components, inverted at once */
+  if (full) {
+    covariance = fff_matrix_new(k, fd*fd);
+    comps = (int*) malloc(k*sizeof(int));
+  }
+
+  for (j=0 ; j<k ; j++)
+    sw += FFF_MAX(fff_vector_get(W,j),0);
+  
+  for (j=0 ; j<k ; j++){
+    wj = fff_vector_get(W,j);
+    if (wj<=0){
+      fff_vector_set(Weights,j,0);
+      continue;
+    }
+    fff_vector_set(Weights,j,wj/sw);
+    for (l=0 ; l<fd ; l++)
+      fff_matrix_set(Centers,j,l,fff_matrix_get(M,j,l)/wj);
+    
+    /* Compute precision from the covariance */
+    if (full) {
+      for (l1=0 ; l1<fd ; l1++)
+	for (l2=0 ; l2<fd ; l2++){
+	  temp = fff_matrix_get(S,j,l1*fd+l2)/wj - fff_matrix_get(Centers,j,l1)*fff_matrix_get(Centers,j,l2);
+	  fff_matrix_set(covariance,nc,l1*fd+l2,temp);
+	}
+      comps[nc++] = j;
+    }
+    else
+      for (l=0 ; l<fd ; l++){
+	temp = fff_matrix_get(S,j,l)/wj - FFF_SQR(fff_matrix_get(Centers,j,l));
+	if (temp>0)
+	  fff_matrix_set(Precision,j,l,1./temp);
+	else
+	  fff_matrix_set(Precision,j,l,0);
+      }
+  }
+  
+  if (full) {
+    if (nc>0) {
+      C = fff_matrix_block(covariance, 0, nc, 0, fd*fd);
+      fff_lapack_inv_sym_batch(&C, NULL, &C);
+    }
+    for (j=0 ; j<nc ; j++)
+      for (l=0 ; l<fd*fd ; l++)
+	fff_matrix_set(Precision,comps[j],l,fff_matrix_get(covariance,j,l));
+    fff_matrix_delete(covariance);
+    free(comps);
+  }
+
+  return(1);
+}
+
+
 double _fff_update_gmm_hom(fff_matrix* Centers, fff_matrix* Precision, const fff_matrix* X)
 {
   /*  char* proc = "fff_update_gmm_hom"; */
@@ -1000,7 +1546,7 @@ double fff_gmm_mean_eval(double* L, const fff_matrix* X, const fff_matrix* Cente
   fff_vector * LogLike = fff_vector_new(X->size1);
   fff_array * Labels = fff_array_new1d( FFF_LONG,X->size1);
   
-  fff_gmm_partition(LogLike, Labels, X, Centers, Precision,Weights);
+  fff_gmm_partition(LogLike, Labels, X, Centers, Precision,Weights,1);
   /* fff_gmm_eval(LogLike, X, Centers,Precision,Weights); */
   
   int i;
@@ -1015,10 +1561,10 @@ double fff_gmm_mean_eval(double* L, const fff_matrix* X, const fff_matrix* Cente
 }
 
 
-double _fff_gmm_partition(fff_array* Labels, const fff_matrix* X, const fff_matrix* Centers, const fff_matrix* Precision, const fff_vector* Weights)
+double _fff_gmm_partition(fff_array* Labels, const fff_matrix* X, const fff_matrix* Centers, const fff_matrix* Precision, const fff_vector* Weights, int nthreads)
 {
   fff_vector * LogLike = fff_vector_new(X->size1);
-  fff_gmm_partition(LogLike, Labels, X, Centers, Precision,Weights);
+  fff_gmm_partition(LogLike, Labels, X, Centers, Precision,Weights,nthreads);
   double mL = 0; 
   int i;
   for (i=0 ; i<(int)X->size1 ; i++)
@@ -1030,7 +1576,7 @@ double _fff_gmm_partition(fff_array* Labels, const fff_matrix* X, const fff_matr
 
 
 
-int fff_gmm_partition(fff_vector* LogLike, fff_array* Labels, const fff_matrix* X, const fff_matrix* Centers, const fff_matrix* Precision, const fff_vector* Weights)
+int fff_gmm_partition(fff_vector* LogLike, fff_array* Labels, const fff_matrix* X, const fff_matrix* Centers, const fff_matrix* Precision, const fff_vector* Weights, const int nthreads)
 {
   if (X->size2 != Centers->size2){
     FFF_ERROR(" Inconsistant matrix sizes \n",EFAULT);
@@ -1041,11 +1587,13 @@ int fff_gmm_partition(fff_vector* LogLike, fff_array* Labels, const fff_matrix*
   int fd2 = fd*fd;
   int k = Centers->size1;
   int N = X->size1;
-  int i,j,l,l1,l2;
+  int i,j,l;
  
-  double quad, sumr,sqr_det, aux, weight,hw, temp;
+  double quad, sumr,sqr_det, aux, weight,hw;
   double thq = 40*fd;
   double thinf = -1000;
+  double cst = 0.5*fd*log(2*M_PI);
+  _fff_gmm_dens* D;
   fff_vector *v = fff_vector_new(fd); 
  
   int prec_type;
@@ -1066,111 +1614,21 @@ int fff_gmm_partition(fff_vector* LogLike, fff_array* Labels, const fff_matrix*
   fff_array_set_all(Labels,-1);
 
   switch (prec_type) {
-  case 0:{
-    fff_vector * sqr_dets = fff_vector_new(k);
-    fff_vector * tempx = fff_vector_new(fd);
-    fff_matrix * precision = fff_matrix_new(fd,fd);
-
-   /* Pre-compute the determinants of precision matrices */
-    for (j=0 ; j<k ; j++){
-      for (l1=0 ; l1<fd ; l1++)
-		for (l2=0 ; l2<fd ; l2++)
-		  fff_matrix_set(precision,l1,l2,fff_matrix_get(Precision,j,l1*fd+l2));
-      fff_vector_set(sqr_dets,j,sqrt(fff_lapack_det_sym(precision)));
-    }
-	/*
-	  for (j=0 ; j<k ; j++)printf("%f ",fff_vector_get(sqr_dets,j));printf("\n");
-	*/
+  case 0:
+  case 1:{
     /* element-wise likelihood */    
-    for (i=0 ; i<N ; i++){
-      sumr = 0;
-      hw = 0;
-      for (j=0 ; j<k ; j++)
-		{
-		  for (l1=0 ; l1<fd ; l1++)
-			for (l2=0 ; l2<fd ; l2++)
-			  fff_matrix_set(precision,l1,l2,fff_matrix_get(Precision,j,l1*fd+l2));
-		  
-		  for (l=0 ; l<fd ; l++){
-			temp = fff_matrix_get(X,i,l)-fff_matrix_get(Centers,j,l);
-			fff_vector_set(tempx,l,temp); 
-		  }
-		  fff_vector_set_all(v,0);
-		  fff_blas_dgemv (CblasNoTrans, 1., precision, tempx, 0, v);
-		  quad = fff_blas_ddot (v, tempx);
-		  weight = exp(-quad/2) * fff_vector_get(Weights,j)*fff_vector_get(sqr_dets,j);
-		  if (weight>hw){
-			hw = weight;
-			fff_array_set1d(Labels,i,j);
-		  } 
-		  sumr += weight;
-		} 
-      if (sumr<=0)
-		fff_vector_set(LogLike,i,thinf);
-	  else
-		fff_vector_set(LogLike,i,log(sumr)-0.5*fd*log(2*M_PI));
-    }    
-    fff_vector_delete(sqr_dets);
-    fff_vector_delete(tempx);
-    fff_matrix_delete(precision);
+    if (prec_type==0)
+      D = _fff_gmm_dens_new(Centers, Precision, Weights, 1, 0); 
+    else
+      D = _fff_gmm_dens_new(Centers, Precision, Weights, 0, thq); 
+    _fff_gmm_estep(NULL, D, X, (prec_type==0) ? thinf+cst : -thq, 
+		   NULL, NULL, NULL, LogLike, Labels, nthreads); 
+    _fff_gmm_dens_delete(D); 
+    for (i=0 ; i<N ; i++)
+      fff_vector_set(LogLike,i,fff_vector_get(LogLike,i)-cst);
     break;
   }
 
-  case 1:{
-    fff_vector * sqr_dets = fff_vector_new(k);
-   /* Pre-compute the determinants of precision matrices */
-    for (j=0 ; j<k ; j++){
-      sqr_det = 1;
-      for (l=0 ; l<fd ; l++)
-	sqr_det *= (fff_matrix_get(Precision,j,l));
-      fff_vector_set(sqr_dets,j,sqrt(sqr_det));
-    }
-    
-    /* element-wise GMM update */
-    for (i=0 ; i<N ; i++){
-      sumr = 0;
-      hw = 0;
-      for (j=0 ; j<k ; j++){     
-	quad = 0;
-	for (l=0 ; l<fd ; l++){
-	  aux = fff_matrix_get(X,i,l)-fff_matrix_get(Centers,j,l);
-	  quad += (aux * aux * fff_matrix_get(Precision,j,l));
-	  /**/
-	  if (quad >thq) break;
-	}
-	if (quad<=thq){
-	  weight = fff_vector_get(sqr_dets,j) * exp(-quad/2) * fff_vector_get(Weights,j);
-	  if (weight>hw){
-	    hw = weight;
-	    fff_array_set1d(Labels,i,j);
-	  } 
-	  sumr += weight;
-	}
-      }
-      if (sumr==0){  
-	  for (j=0 ; j<k ; j++){     
-	    quad = 0;
-	    for (l=0 ; l<fd ; l++){
-	      aux = fff_matrix_get(X,i,l)-fff_matrix_get(Centers,j,l);
-	      quad += (aux * aux * fff_matrix_get(Precision,j,l));	  
-	    } 
-	    weight = fff_vector_get(sqr_dets,j) * exp(-quad/2) * fff_vector_get(Weights,j);
-	    if (weight>hw){
-	      hw = weight;
-	      fff_array_set1d(Labels,i,j);
-	    } 
-	    sumr += weight;
-	  }
-      }
-	
-      if (sumr<=0)
-	sumr = exp(-thq);
-      fff_vector_set(LogLike,i,log(sumr) -0.5*fd*log(2*M_PI));
-      
-    }    
-    fff_vector_delete(sqr_dets);
-    break;
-  }
   case 2:{ 
     /* Pre-compute the determinants of precision matrices */
     sqr_det = 1;
@@ -1235,6 +1693,7 @@ extern int fff_gmm_membership(fff_graph* G, const fff_matrix* X, const fff_matri
 	prec_type = 1;/*diagonal cluster-based covariance*/
       else return(0);
     }
+  fff_graph_uncompile(G);
 
   switch (prec_type) {
   case 0:{
@@ -1243,12 +1702,12 @@ extern int fff_gmm_membership(fff_graph* G, const fff_matrix* X, const fff_matri
     fff_matrix * precision = fff_matrix_new(fd,fd);
 
    /* Pre-compute the determinants of precision matrices */
-    for (j=0 ; j<k ; j++){
-      for (l1=0 ; l1<fd ; l1++)
-	for (l2=0 ; l2<fd ; l2++)
-	  fff_matrix_set(precision,l1,l2,fff_matrix_get(Precision,j,l1*fd+l2));
-      fff_vector_set(sqr_dets,j,sqrt(fff_lapack_det_sym(precision)));
-    }
+    fff_matrix * factors = fff_matrix_new(k,fd2);
+    fff_matrix_memcpy(factors,Precision);
+    fff_lapack_chol_batch(factors,sqr_dets,NULL);
+    for (j=0 ; j<k ; j++)
+      fff_vector_set(sqr_dets,j,exp(fff_vector_get(sqr_dets,j)/2));
+    fff_matrix_delete(factors);
 
     /* element-wise likelihood */ 
     for (i=0 ; i<N ; i++){
@@ -1977,31 +2436,36 @@ extern int fff_BGMM_set_priors(fff_Bayesian_GMM* BG, const fff_matrix * prior_me
   return(0);
 }
 
-static int _fff_BGMM_init(fff_Bayesian_GMM* BG)
+/* 
+   Draws of a chain are keyed by (seed, chain, j, index) in the
+   counter-based generator: j = 0 for the initialization and j = nit+1
+   for the labels of iteration nit, so chains are independent and
+   reproducible whatever the thread that runs them.
+*/
+static int _fff_BGMM_init(fff_Bayesian_GMM* BG, unsigned long seed, unsigned long chain)
 {
   int i,j;
-  double a,b,ms;
+  double a,b,ms,u,v;
+  unsigned long idx; 
 
   fff_vector_memcpy(BG->means_scale,BG->prior_means_scale );
   fff_vector_memcpy(BG->weights,BG->prior_weights );
   fff_vector_memcpy(BG->dof,BG->prior_dof);
   fff_matrix_memcpy(BG->precisions,BG->prior_precisions );
 
-  fff_matrix * mprecision = fff_matrix_new(BG->k,BG->dim);
-
+  /* means drawn around the prior means (Box-Muller) */ 
   for (i=0 ; i<BG->k ; i++){
 	a = fff_vector_get(BG->dof,i);
 	ms = fff_vector_get(BG->means_scale,i);
 	for (j=0 ; j<BG->dim ; j++){
-	  b = fff_matrix_get(BG->precisions,i,j);
-	  b*=a;
-	  fff_matrix_set(mprecision,i,j,b*ms);
+	  b = fff_matrix_get(BG->precisions,i,j)*a*ms;
+	  idx = 2*(i*BG->dim+j); 
+	  u = 1. - rk_counter_double(seed, chain, 0, idx); 
+	  v = rk_counter_double(seed, chain, 0, idx+1); 
+	  fff_matrix_set(BG->means,i,j,fff_matrix_get(BG->prior_means,i,j) + sqrt(-2*log(u)/b)*cos(2*M_PI*v));
 	}
   }
-  
-  generate_normals(BG->means, BG->prior_means, mprecision);
    
-  fff_matrix_delete(mprecision);
   return(0);
 }
 
@@ -2041,110 +2505,150 @@ static double _fff_WNpval_(fff_vector * proba, const fff_vector *X, const fff_Ba
 extern double fff_WNpval(fff_matrix * proba, const fff_matrix *X, const fff_Bayesian_GMM* BG)
 {
    int i,j,n;
-   double x,tau,m,w,a,b,f,sxw,LL=0;
+   int k = BG->k, dim = BG->dim; 
+   double x,m,a,f,w,sxw,LL=0;
+   double *tau, *cst, *ib, *row; 
+
+   /* the terms that do not depend on the sample are computed once */ 
+   tau = (double*)calloc(k*(dim+2), sizeof(double)); 
+   if (tau == NULL) {
+     FFF_ERROR("Out of memory", ENOMEM); 
+     return(0); 
+   }
+   cst = tau + k; 
+   ib = cst + k; 
+   for (i=0 ; i<k ; i++){
+	 a = fff_vector_get(BG->dof,i);
+	 tau[i] = fff_vector_get(BG->means_scale,i);
+	 tau[i] = tau[i]/(1+tau[i]);
+	 w = 0; 
+	 for (j=0 ; j<dim ; j++){
+	   ib[i*dim+j] = 1./fff_matrix_get(BG->precisions,i,j);
+	   w = w + log(ib[i*dim+j])*a; 
+	   w += 2*fff_gamln((a+1-j)/2);
+	   w -= 2*fff_gamln((a-j)/2);
+	 }
+	 w = w + log(tau[i])*dim;
+	 w = w-log(M_PI)*dim;
+	 cst[i] = w/2 + log(fff_vector_get(BG->weights,i)); 
+   }
   
    for (n=0 ; n<X->size1 ; n++){
 	 sxw = 0;
-	 for (i=0 ; i<BG->k ; i++){
-	   w = 0;
-	   f = 0;
+	 row = X->data + n*X->tda; 
+	 for (i=0 ; i<k ; i++){
 	   a = fff_vector_get(BG->dof,i);
-	   tau = fff_vector_get(BG->means_scale,i);
-	   tau = tau/(1+tau);
-	   for (j=0 ; j<BG->dim ; j++){
+	   f = 0;
+	   for (j=0 ; j<dim ; j++){
 		 m = fff_matrix_get(BG->means,i,j);
-		 b = fff_matrix_get(BG->precisions,i,j);
-		 x = fff_matrix_get(X,n,j);
-		 f = f+ log( 1./b + tau* (m-x)*(m-x));
-		 w = w - log(b)*a; 
-		 w += 2*fff_gamln((a+1-j)/2);
-		 w -= 2*fff_gamln((a-j)/2);
+		 x = row[j]; 
+		 f = f+ log( ib[i*dim+j] + tau[i]* (m-x)*(m-x));
 	   }
-	   w = w -f*(a+1) + log(tau)*BG->dim;
-	   w = w-log(M_PI)*BG->dim;
-	   w = w/2;
-	   w = w + log(fff_vector_get(BG->weights,i));
-	   w = exp(w);
+	   w = exp(cst[i] - f*(a+1)/2);
 	   sxw += w;
 	   fff_matrix_set(proba,n,i,w);
 	 }
 	 LL += log(sxw);
    }
+
+   free(tau); 
    return(LL/X->size1);
 }
 
 static double _fff_Npval(fff_matrix * proba, const fff_matrix *X, const fff_Bayesian_GMM* BG)
 {
   int i,j,n;
-  double tau,m,w,p,x,sxw,a;
+  int k = BG->k, dim = BG->dim; 
+  double m,p,x,q,sxw,w;
   double LL=0;
+  double *tau, *cst, *row; 
+
+  /* the terms that do not depend on the sample are computed once */ 
+  tau = (double*)calloc(2*k, sizeof(double)); 
+  if (tau == NULL) {
+    FFF_ERROR("Out of memory", ENOMEM); 
+    return(0); 
+  }
+  cst = tau + k; 
+  for (i=0 ; i<k ; i++){
+	tau[i] = fff_vector_get(BG->means_scale,i);
+	tau[i] = tau[i]/(1+tau[i]);
+	w = 0; 
+	for (j=0 ; j<dim ; j++)
+	  w = w + log(tau[i]) + log(fff_matrix_get(BG->precisions,i,j)*fff_vector_get(BG->dof,i)); 
+	w = w-log(2*M_PI)*dim;
+	cst[i] = w/2 + log(fff_vector_get(BG->weights,i)); 
+  }
 
   for (n=0 ; n<X->size1 ; n++){
 	sxw = 0;
-	for (i=0 ; i<BG->k ; i++){
-	  w = 0;
-	  tau = fff_vector_get(BG->means_scale,i);
-	  tau = tau/(1+tau);
-	  a = fff_vector_get(BG->dof,i);
-	  for (j=0 ; j<BG->dim ; j++){
+	row = X->data + n*X->tda; 
+	for (i=0 ; i<k ; i++){
+	  q = 0; 
+	  for (j=0 ; j<dim ; j++){
 		m = fff_matrix_get(BG->means,i,j);
-		p = fff_matrix_get(BG->precisions,i,j)*a;
-		x = fff_matrix_get(X,n,j);
-		w = w + log(tau) + log(p) - tau*(m-x)*(m-x)*p; 
+		p = fff_matrix_get(BG->precisions,i,j)*fff_vector_get(BG->dof,i);
+		x = row[j]; 
+		q = q + (m-x)*(m-x)*p; 
 	  }
-	  w = w-log(2*M_PI)*BG->dim;
-	  w = w/2;
-	  w = w + log(fff_vector_get(BG->weights,i));
-	  w = exp(w);
+	  w = exp(cst[i] - tau[i]*q/2);
 	  fff_matrix_set(proba,n,i,w);
 	  sxw += w;
 	} 
 	LL += log(sxw);
   }
+
+  free(tau); 
   return(LL/X->size1);
 }
 
 
-static int _fff_random_choice(fff_array *choice, fff_vector * pop, const fff_matrix * proba, int nit)
+/* Labels are drawn by blocks of samples: the uniforms of a block are
+   generated first, then each row of proba is inverted in place */ 
+static int _fff_random_choice(fff_array *choice, fff_vector * pop, const fff_matrix * proba, unsigned long seed, unsigned long chain, int nit)
 {
-  int n,j;
-  rk_state state; 
-  rk_seed(nit, &state);
-  
-  double sp,h,cou;
-  
-  
-  for (n=0 ; n<proba->size1 ; n++){
-	sp = 0;
-	for (j=0 ; j<proba->size2 ; j++)
-	  sp += fff_matrix_get(proba,n,j);
+  size_t n,n0,b,nb,j;
+  size_t N = proba->size1, k = proba->size2; 
+  double u[GMM_BLOCK]; 
+  double sp,h;
+  const double* p; 
+  
+  for (n0=0 ; n0<N ; n0+=GMM_BLOCK){
+	nb = FFF_MIN(GMM_BLOCK, N-n0); 
+	rk_counter_fill_double(seed, chain, (unsigned long)nit+1, (unsigned long)n0, u, nb); 
 	
-	h = rk_double(&state)*sp;
-	sp = 0;
-	for (j=0 ; j<proba->size2 ; j++){
-	  sp +=fff_matrix_get(proba,n,j);
-	  if (sp>=h) break;
-	}
-  
-	fff_array_set1d(choice,n,j);
-	cou = fff_vector_get(pop,j);
-	fff_vector_set(pop,j,cou+1);
+	for (b=0 ; b<nb ; b++){
+	  n = n0+b; 
+	  p = proba->data + n*proba->tda; 
+	  sp = 0;
+	  for (j=0 ; j<k ; j++)
+		sp += p[j];
 	
+	  h = u[b]*sp;
+	  sp = 0;
+	  for (j=0 ; j<k-1 ; j++){
+		sp += p[j];
+		if (sp>=h) break;
+	  }
+  
+	  fff_array_set1d(choice,n,j);
+	  pop->data[j*pop->stride] += 1; 
+	}
   }
   
   return 0;
 }
 
-static double _fff_update_BGMM(fff_Bayesian_GMM* BG, const fff_matrix *X, int nit, const int method)
+static double _fff_update_BGMM(fff_Bayesian_GMM* BG, const fff_matrix *X, unsigned long seed, unsigned long chain, int nit, const int method)
 {
   double LL=0;
   fff_matrix * proba = fff_matrix_new(X->size1,BG->k);
-  LL = _fff_full_update_BGMM(proba, BG, X, nit, method);
+  LL = _fff_full_update_BGMM(proba, BG, X, seed, chain, nit, method);
   fff_matrix_delete(proba);
   return LL;
 }
 
-static double _fff_full_update_BGMM(fff_matrix * proba, fff_Bayesian_GMM* BG, const fff_matrix *X, int nit, const int method)
+static double _fff_full_update_BGMM(fff_matrix * proba, fff_Bayesian_GMM* BG, const fff_matrix *X, unsigned long seed, unsigned long chain, int nit, const int method)
 {
   int i,j,n;
   double sw,x,a,b,dx,LL=0;
@@ -2157,7 +2661,7 @@ static double _fff_full_update_BGMM(fff_matrix * proba, fff_Bayesian_GMM* BG, co
   
   if (method == 0) _fff_Npval(proba,X,BG);
   else LL = fff_WNpval(proba,X,BG);
-  _fff_random_choice(choice,pop,proba,nit);
+  _fff_random_choice(choice,pop,proba,seed,chain,nit);
   
   /* update the weight*/
   fff_vector_memcpy(BG->weights,BG->prior_weights );
@@ -2226,18 +2730,18 @@ static double _fff_full_update_BGMM(fff_matrix * proba, fff_Bayesian_GMM* BG, co
   return(LL);
 }
 
-extern int fff_BGMM_Gibbs_sampling(fff_vector* density, fff_Bayesian_GMM* BG, const fff_matrix *X, const fff_matrix *grid, const int niter, const int method)
+/* niter sampling iterations of a chain, numbered from nit0 */ 
+static int _fff_BGMM_Gibbs_sample_chain(fff_vector* density, fff_Bayesian_GMM* BG, const fff_matrix *X, const fff_matrix *grid, const int niter, const int method, unsigned long seed, unsigned long chain, int nit0)
 {
-  double LL;
   fff_matrix * proba = fff_matrix_new(grid->size1,BG->k);
   fff_vector *v = fff_vector_new(grid->size1);
   /* it is assumed here that the MC is stationary */
   int i,j;
 
    for (i=0 ; i<niter ; i++){
-	 _fff_update_BGMM(BG,X,i+niter,method);
-	 if (method == 0) LL = _fff_Npval(proba,grid,BG);
-	 else LL = fff_WNpval(proba,grid,BG);
+	 _fff_update_BGMM(BG,X,seed,chain,i+nit0,method);
+	 if (method == 0) _fff_Npval(proba,grid,BG);
+	 else fff_WNpval(proba,grid,BG);
 	 for (j=0; j <BG->k;j++){
 	   fff_matrix_get_col(v,proba,j);
 	   fff_vector_add(density,v);
@@ -2250,11 +2754,11 @@ extern int fff_BGMM_Gibbs_sampling(fff_vector* density, fff_Bayesian_GMM* BG, co
    return 0;
 }
 
-extern int fff_BGMM_Gibbs_estimation(fff_matrix* membership, fff_Bayesian_GMM* BG, const fff_matrix *X, const int niter, const int method)
+/* Burn-in then estimation, iterations 0..2*niter-1 of a chain */ 
+static int _fff_BGMM_Gibbs_chain(fff_matrix* membership, fff_Bayesian_GMM* BG, const fff_matrix *X, const int niter, const int method, unsigned long seed, unsigned long chain)
 {
   int i=0;
-  double LL;
-  _fff_BGMM_init(BG);
+  _fff_BGMM_init(BG, seed, chain);
   
   fff_matrix_set_all(membership,0);
   fff_matrix * average_means = fff_matrix_new(BG->k,BG->dim);
@@ -2267,13 +2771,13 @@ extern int fff_BGMM_Gibbs_estimation(fff_matrix* membership, fff_Bayesian_GMM* B
   
   /* burn-in period */
   for (i=0 ; i<niter ; i++)
-	LL = _fff_update_BGMM(BG,X,i,method);
+	_fff_update_BGMM(BG,X,seed,chain,i,method);
   
   /* final updates */
   proba = fff_matrix_new(X->size1,BG->k);
   
   for (i=0 ; i<niter ; i++){
-	_fff_full_update_BGMM(proba,BG,X,i+niter,method);
+	_fff_full_update_BGMM(proba,BG,X,seed,chain,i+niter,method);
 	
 	fff_matrix_add(membership,proba);
 	fff_matrix_add(average_means,BG->means);
@@ -2283,7 +2787,6 @@ extern int fff_BGMM_Gibbs_estimation(fff_matrix* membership, fff_Bayesian_GMM* B
 	fff_vector_add(average_weights,BG->weights );
 	
   }
-  
   fff_matrix_scale(membership,1./niter);
   fff_matrix_scale(average_means,1./niter);
   fff_matrix_scale(average_precisions,1./niter);
@@ -2298,10 +2801,192 @@ extern int fff_BGMM_Gibbs_estimation(fff_matrix* membership, fff_Bayesian_GMM* B
   fff_vector_memcpy(BG->weights,average_weights);
  
   fff_matrix_delete(proba);
+  fff_matrix_delete(average_means);
+  fff_matrix_delete(average_precisions);
+  fff_vector_delete(average_means_scale);
+  fff_vector_delete(average_dof);
+  fff_vector_delete(average_weights);
   
   return(0);
 }
 
+extern int fff_BGMM_Gibbs_sampling(fff_vector* density, fff_Bayesian_GMM* BG, const fff_matrix *X, const fff_matrix *grid, const int niter, const int method)
+{
+  return(_fff_BGMM_Gibbs_sample_chain(density, BG, X, grid, niter, method, 1, 0, niter)); 
+}
+
+extern int fff_BGMM_Gibbs_estimation(fff_matrix* membership, fff_Bayesian_GMM* BG, const fff_matrix *X, const int niter, const int method)
+{
+  return(_fff_BGMM_Gibbs_chain(membership, BG, X, niter, method, 1, 0)); 
+}
+
+/*
+   Multiple chains. Each chain runs on a private copy of the model,
+   and chains are interleaved across threads. Since the components
+   of independent chains need not come in the same order, each chain
+   is aligned with the first one before averaging, by greedily
+   pairing the components whose memberships overlap most.
+*/
+
+typedef struct {
+  const fff_Bayesian_GMM* BG;   /* priors */ 
+  const fff_matrix* X; 
+  const fff_matrix* grid; 
+  int niter; 
+  int nsamplings; 
+  int method; 
+  int nchains; 
+  unsigned long seed; 
+  fff_Bayesian_GMM** chains; 
+  fff_matrix** membership; 
+  fff_vector** density; 
+} _fff_BGMM_chains_job; 
+
+static void _fff_BGMM_chains_job_run(int rank, int nthreads, void* params)
+{
+  _fff_BGMM_chains_job* job = (_fff_BGMM_chains_job*)params; 
+  const fff_Bayesian_GMM* BG = job->BG; 
+  fff_Bayesian_GMM* C; 
+  int c; 
+
+  for (c=rank ; c<job->nchains ; c+=nthreads){
+    C = fff_BGMM_new(BG->k, BG->dim); 
+    fff_BGMM_set_priors(C, BG->prior_means, BG->prior_means_scale, BG->prior_precisions, BG->prior_dof, BG->prior_weights); 
+    job->chains[c] = C; 
+    job->membership[c] = fff_matrix_new(job->X->size1, BG->k); 
+    _fff_BGMM_Gibbs_chain(job->membership[c], C, job->X, job->niter, job->method, job->seed, c); 
+    if (job->density != NULL) {
+      job->density[c] = fff_vector_new(job->grid->size1); 
+      _fff_BGMM_Gibbs_sample_chain(job->density[c], C, job->X, job->grid, job->nsamplings, job->method, 
+				   job->seed, c, 2*job->niter); 
+    }
+  }
+}
+
+/* perm[i] is the component of the reference R matched with component i of M */ 
+static void _fff_BGMM_align(long* perm, const fff_matrix* M, const fff_matrix* R)
+{
+  int k = M->size2; 
+  int i, j, l, ib=0, jb=0; 
+  double o, ob; 
+  fff_matrix* O = fff_matrix_new(k, k); 
+  int* used = (int*)calloc(2*k, sizeof(int)); 
+
+  fff_blas_dgemm(CblasTrans, CblasNoTrans, 1, M, R, 0, O); 
+  for (l=0 ; l<k ; l++){
+    ob = FFF_NEGINF; 
+    for (i=0 ; i<k ; i++){
+      if (used[i]) continue; 
+      for (j=0 ; j<k ; j++){
+	if (used[k+j]) continue; 
+	o = fff_matrix_get(O, i, j); 
+	if (o > ob) {
+	  ob = o; 
+	  ib = i; 
+	  jb = j; 
+	}
+      }
+    }
+    perm[ib] = jb; 
+    used[ib] = 1; 
+    used[k+jb] = 1; 
+  }
+
+  free(used); 
+  fff_matrix_delete(O); 
+}
+
+extern int fff_BGMM_Gibbs_chains(fff_matrix* membership, fff_vector* density, fff_Bayesian_GMM* BG, const fff_matrix *X, const fff_matrix *grid, const int niter, const int nsamplings, const int method, const int nchains, const unsigned long seed, const int nthreads)
+{
+  _fff_BGMM_chains_job job; 
+  fff_Bayesian_GMM* C; 
+  long* perm; 
+  int c, i, j, n, p, nt; 
+  int k = BG->k, dim = BG->dim; 
+  double s; 
+
+  if (nchains < 1)
+    return(0); 
+
+  job.BG = BG; 
+  job.X = X; 
+  job.grid = (grid == NULL) ? X : grid; 
+  job.niter = niter; 
+  job.nsamplings = nsamplings; 
+  job.method = method; 
+  job.nchains = nchains; 
+  job.seed = seed; 
+  job.chains = (fff_Bayesian_GMM**)calloc(nchains, sizeof(fff_Bayesian_GMM*)); 
+  job.membership = (fff_matrix**)calloc(nchains, sizeof(fff_matrix*)); 
+  job.density = ((density != NULL) && (nsamplings > 0)) ? 
+    (fff_vector**)calloc(nchains, sizeof(fff_vector*)) : NULL; 
+  perm = (long*)calloc(k, sizeof(long)); 
+  if ((job.chains == NULL) || (job.membership == NULL) || (perm == NULL) || 
+      ((density != NULL) && (nsamplings > 0) && (job.density == NULL))) {
+    FFF_ERROR("Out of memory", ENOMEM); 
+    free(job.chains); 
+    free(job.membership); 
+    free(job.density); 
+    free(perm); 
+    return(0); 
+  }
+
+  nt = fff_threads_count(nthreads); 
+  if (nt > nchains)
+    nt = nchains; 
+  fff_parallel_run(nt, &_fff_BGMM_chains_job_run, (void*)&job); 
+
+  /* Average the aligned chains */ 
+  s = 1./nchains; 
+  fff_matrix_set_all(membership, 0); 
+  fff_matrix_set_all(BG->means, 0); 
+  fff_matrix_set_all(BG->precisions, 0); 
+  fff_vector_set_all(BG->means_scale, 0); 
+  fff_vector_set_all(BG->dof, 0); 
+  fff_vector_set_all(BG->weights, 0); 
+  if (job.density != NULL)
+    fff_vector_set_all(density, 0); 
+
+  for (c=0 ; c<nchains ; c++){
+    C = job.chains[c]; 
+    if (c == 0)
+      for (i=0 ; i<k ; i++)
+	perm[i] = i; 
+    else 
+      _fff_BGMM_align(perm, job.membership[c], job.membership[0]); 
+    
+    for (i=0 ; i<k ; i++){
+      p = perm[i]; 
+      for (n=0 ; n<(int)X->size1 ; n++)
+	membership->data[n*membership->tda+p] += s*fff_matrix_get(job.membership[c], n, i); 
+      for (j=0 ; j<dim ; j++){
+	fff_matrix_set(BG->means, p, j, fff_matrix_get(BG->means, p, j) + s*fff_matrix_get(C->means, i, j)); 
+	fff_matrix_set(BG->precisions, p, j, fff_matrix_get(BG->precisions, p, j) + s*fff_matrix_get(C->precisions, i, j)); 
+      }
+      fff_vector_set(BG->means_scale, p, fff_vector_get(BG->means_scale, p) + s*fff_vector_get(C->means_scale, i)); 
+      fff_vector_set(BG->dof, p, fff_vector_get(BG->dof, p) + s*fff_vector_get(C->dof, i)); 
+      fff_vector_set(BG->weights, p, fff_vector_get(BG->weights, p) + s*fff_vector_get(C->weights, i)); 
+    }
+    /* the density does not depend on the order of the components */ 
+    if (job.density != NULL) {
+      fff_vector_scale(job.density[c], s); 
+      fff_vector_add(density, job.density[c]); 
+      fff_vector_delete(job.density[c]); 
+    }
+  }
+
+  for (c=0 ; c<nchains ; c++){
+    fff_BGMM_delete(job.chains[c]); 
+    fff_matrix_delete(job.membership[c]); 
+  }
+  free(job.chains); 
+  free(job.membership); 
+  free(job.density); 
+  free(perm); 
+
+  return(0); 
+}
+
 extern int fff_BGMM_get_model( fff_matrix * means, fff_vector * means_scale,  fff_matrix * precisions, fff_vector* dof, fff_vector * weights, const fff_Bayesian_GMM* BG)
 {
   fff_matrix_memcpy(means,BG->means);
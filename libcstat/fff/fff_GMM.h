@@ -107,6 +107,8 @@ extern "C" {
     \param nbclust number of clusters for which a mixture is searched. 
     \param maxiter maximum number of iterations
     \param delta small constant for control of convergence
+    \param seed seed of the random initializations
+    \param nthreads number of threads (all processors if zero or negative)
 
     This function performs different initializations of the GMM clustering
     algorithm with nbclust mixtures, and keeps the best one according
@@ -114,9 +116,13 @@ extern "C" {
 
     The optimal number of clusters is returned.  It is assumed that Centers,
     Precision, and Weights have been allocated for max(nbclust)
-    clusters.
+    clusters; the rows beyond the optimal number are set to zero.
+
+    The fits run concurrently on nthreads threads, each of them
+    drawing from its own random stream, so the result only depends
+    on the seed.
   */
-  int fff_clustering_gmm_select( fff_matrix* Centers, fff_matrix* Precision,  fff_vector *Weights, fff_array *Label, const fff_matrix* X, const fff_vector *nbclust, const int maxiter, const double delta);
+  int fff_clustering_gmm_select( fff_matrix* Centers, fff_matrix* Precision,  fff_vector *Weights, fff_array *Label, const fff_matrix* X, const fff_vector *nbclust, const int maxiter, const double delta, const unsigned long seed, const int nthreads);
   /*!
     \brief GMM algorithm
     \param X data matrix 
@@ -127,13 +133,18 @@ extern "C" {
     \param maxiter maximum number of iterations
     \param delta small constant for control of convergence
     \param ninit number of initializations
+    \param seed seed of the random initializations
+    \param nthreads number of threads (all processors if zero or negative)
 
     This function performs ninit initializations of the GMM clustering
     algorithm, and keeps the best one. The average log-likelihood is
     returned.
-    
+
+    The fits run concurrently on nthreads threads, each of them
+    drawing from its own random stream, so the result only depends
+    on the seed.
   */
-  extern double fff_clustering_gmm_ninit( fff_matrix* Centers, fff_matrix* Precision,  fff_vector *Weights, fff_array *Label, const fff_matrix* X, const int maxiter, const double delta, const int ninit );
+  extern double fff_clustering_gmm_ninit( fff_matrix* Centers, fff_matrix* Precision,  fff_vector *Weights, fff_array *Label, const fff_matrix* X, const int maxiter, const double delta, const int ninit, const unsigned long seed, const int nthreads );
  /*!
     \brief GMM algorithm
     \param X data matrix 
@@ -145,6 +156,7 @@ extern "C" {
     \param delta small constant for control of convergence
     \param chunksize the number of features on which gmm is performed
 	\param verbose verbosity mode
+    \param nthreads number of threads (all processors if zero or negative)
 
     This algorithm performs a GMM of the data X.  Note that the data
     and cluster matrices should be dimensioned as (nb items * feature
@@ -167,8 +179,12 @@ extern "C" {
     The returned Label vector is a hard membership function 
     computed after convergence.
     The normlized log-likelihood is returned.
+
+    In the heteroscedastic models, the E-step is evaluated on blocks
+    of samples that are split across nthreads threads. Results only
+    depend on nthreads through rounding errors.
   */
-  extern double fff_clustering_gmm( fff_matrix* Centers, fff_matrix* Precision,  fff_vector *Weights, fff_array *Label, const fff_matrix* X, const int maxiter, const double delta, const int chunksize, const int verbose );
+  extern double fff_clustering_gmm( fff_matrix* Centers, fff_matrix* Precision,  fff_vector *Weights, fff_array *Label, const fff_matrix* X, const int maxiter, const double delta, const int chunksize, const int verbose, const int nthreads );
  
 
   /*!
@@ -196,6 +212,7 @@ extern "C" {
     \param Weights Mixture Weights
     \param LogLike  log-likelihood of each data
 	\param Labels final labelling
+    \param nthreads number of threads, see fff_clustering_gmm
 
     This algorithm computes the average log-likelihood of a GMM on an
     empirical dataset. This number is returned.
@@ -204,7 +221,7 @@ extern "C" {
     - (k*f) precision diagonal
     - (1*f) precision diagonal and equal for all clusters
   */
-  extern int fff_gmm_relax( fff_vector* LogLike, fff_array* Labels, fff_matrix* Centers, fff_matrix* Precision, fff_vector* Weights, const fff_matrix* X, const int maxiter, const double delta);
+  extern int fff_gmm_relax( fff_vector* LogLike, fff_array* Labels, fff_matrix* Centers, fff_matrix* Precision, fff_vector* Weights, const fff_matrix* X, const int maxiter, const double delta, const int nthreads);
 
   /*!
     \brief Evaluation of a GMM on a dataset and labelling of the dataset X
@@ -214,6 +231,7 @@ extern "C" {
     \param Weights Mixture Weights
     \param LogLike  log-likelihood of each data
     \param Labels final labelling
+    \param nthreads number of threads, see fff_clustering_gmm
 
     This algorithm computes the average log-likelihood of a GMM on an
     empirical dataset. This number is returned.
@@ -222,7 +240,45 @@ extern "C" {
     - (k*f) precision diagonal
     - (1*f) precision diagonal and equal for all clusters
   */
-  extern int fff_gmm_partition(fff_vector* LogLike, fff_array* Labels, const fff_matrix* X, const fff_matrix* Centers, const fff_matrix* Precision, const fff_vector* Weights);
+  extern int fff_gmm_partition(fff_vector* LogLike, fff_array* Labels, const fff_matrix* X, const fff_matrix* Centers, const fff_matrix* Precision, const fff_vector* Weights, const int nthreads);
+
+  /*!
+    \brief Stepwise update of the sufficient statistics of a GMM with a chunk of data
+    \param W running average of the responsibilities (k)
+    \param M running average of the first-order moments (k*f)
+    \param S running average of the second-order moments, with the shape of Precision
+    \param X chunk of data
+    \param Centers Cluster centers
+    \param Precision Cluster precisions
+    \param Weights Mixture Weights
+    \param step step size in [0,1]
+    \param nthreads number of threads, see fff_clustering_gmm
+
+    This is the E-step of a mini-batch (stepwise) EM algorithm: the
+    statistics of the chunk X, averaged over its items, are computed
+    under the current model and blended as
+    W = (1-step)*W + step*W(X), and likewise for M and S. Only the
+    heteroscedastic models (full or diagonal precisions) are
+    handled. Responsibilities are never stored for more than a block
+    of items, so that the whole dataset can be processed by chunks
+    that fit in memory. The average log-likelihood of X is returned.
+  */
+  extern double fff_gmm_stats_update(fff_vector* W, fff_matrix* M, fff_matrix* S, const fff_matrix* X, const fff_matrix* Centers, const fff_matrix* Precision, const fff_vector* Weights, const double step, const int nthreads);
+
+  /*!
+    \brief GMM parameters from sufficient statistics
+    \param Centers Cluster centers
+    \param Precision Cluster precisions
+    \param Weights Mixture Weights
+    \param W average responsibilities
+    \param M average first-order moments
+    \param S average second-order moments
+
+    This is the M-step associated with fff_gmm_stats_update.
+    Components with no responsibility are left unchanged and get a
+    zero weight.
+  */
+  extern int fff_gmm_stats_model(fff_matrix* Centers, fff_matrix* Precision, fff_vector* Weights, const fff_vector* W, const fff_matrix* M, const fff_matrix* S);
 
     /*!
     \brief representation of GMM membership with a graph structure
@@ -333,6 +389,30 @@ extern "C" {
    */
   extern int fff_BGMM_Gibbs_sampling(fff_vector* density, fff_Bayesian_GMM* BG, const fff_matrix *X, const fff_matrix *grid, const int niter, const int method);
 
+   /*
+	\brief Multi-chain Gibbs estimation and sampling of the BGMM
+	\param membership the average membership variable across chains
+	\param density the average density on the grid, or NULL
+	\param BG the BGMM to be estimated
+	\param X the data used in the estimation of the model
+	\param grid the grid used for the density (X if NULL)
+	\param niter the number of iterations of the estimation
+	\param nsamplings the number of iterations of the sampling
+	\param method choice of a quick(purely normal) technique
+	\param nchains the number of independent chains
+	\param seed seed of the random draws
+	\param nthreads number of threads (all processors if zero or negative)
+
+	Each chain performs fff_BGMM_Gibbs_estimation on a private copy
+	of BG, then nsamplings iterations of fff_BGMM_Gibbs_sampling on
+	the grid if density is not NULL. Chains run concurrently and
+	draw from independent random streams, so the results only depend
+	on the seed. The components of each chain are matched with those
+	of the first one before the memberships and parameters are
+	averaged; BG is re-instantiated with the average parameters.
+   */
+  extern int fff_BGMM_Gibbs_chains(fff_matrix* membership, fff_vector* density, fff_Bayesian_GMM* BG, const fff_matrix *X, const fff_matrix *grid, const int niter, const int nsamplings, const int method, const int nchains, const unsigned long seed, const int nthreads);
+
 
   /*
 	\brief Reading out the BGMM structure
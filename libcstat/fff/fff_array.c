@@ -1,6 +1,7 @@
 #include "fff_array.h"
 
 #include <stdlib.h>
+#include <string.h>
 #include <errno.h>
 
 
@@ -30,6 +31,38 @@ static void _fff_array_iterator_update1d(void* it);
 static void _fff_array_iterator_update2d(void* it);
 static void _fff_array_iterator_update3d(void* it);
 static void _fff_array_iterator_update4d(void* it);
+static int _fff_array_linear(const fff_array* im, size_t* offset); 
+static fff_array_iterator _fff_array_runs(const fff_array* im, int linear, size_t linear_offset, 
+					  size_t* length, size_t* offset); 
+static void _fff_array_binary(fff_array* aRes, const fff_array* aSrc, int op, double a, double b); 
+
+/* Operations of _fff_array_binary */ 
+#define _FFF_ARRAY_COPY 0
+#define _FFF_ARRAY_COMPRESS 1
+#define _FFF_ARRAY_ADD 2
+#define _FFF_ARRAY_SUB 3
+#define _FFF_ARRAY_MUL 4
+#define _FFF_ARRAY_DIV 5
+
+/* Conversions from double, as done by the set accessors */ 
+#define _FFF_ARRAY_ROUND(type, v) ((type)(FFF_ROUND(v)))
+#define _FFF_ARRAY_CAST(type, v) ((type)(v))
+
+/* Expand KERNEL(type, STORE) for the C type matching datatype */ 
+#define _FFF_ARRAY_TYPED(datatype, KERNEL)				\
+  switch(datatype) {							\
+  case FFF_UCHAR: KERNEL(unsigned char, _FFF_ARRAY_ROUND); break;	\
+  case FFF_SCHAR: KERNEL(signed char, _FFF_ARRAY_ROUND); break;		\
+  case FFF_USHORT: KERNEL(unsigned short, _FFF_ARRAY_ROUND); break;	\
+  case FFF_SSHORT: KERNEL(signed short, _FFF_ARRAY_ROUND); break;	\
+  case FFF_UINT: KERNEL(unsigned int, _FFF_ARRAY_ROUND); break;		\
+  case FFF_INT: KERNEL(int, _FFF_ARRAY_ROUND); break;			\
+  case FFF_ULONG: KERNEL(unsigned long int, _FFF_ARRAY_ROUND); break;	\
+  case FFF_LONG: KERNEL(long int, _FFF_ARRAY_ROUND); break;		\
+  case FFF_FLOAT: KERNEL(float, _FFF_ARRAY_CAST); break;		\
+  case FFF_DOUBLE: KERNEL(double, _FFF_ARRAY_CAST); break;		\
+  default: break;							\
+  }
 /*
 
 Creates a C-contiguous array. 
@@ -68,6 +101,7 @@ fff_array* fff_array_new(fff_datatype datatype,
 
   /* Gives ownership */ 
   thisone->owner = 1; 
+  FFF_PROFILE_COUNT(FFF_PROFILE_ALLOCATIONS, 1); 
 
   /* Allocate the image buffer */ 
   switch(datatype) {
@@ -155,6 +189,21 @@ void fff_array_delete(fff_array* thisone)
 }
 
 
+fff_array fff_array_arena(fff_arena* arena, fff_datatype datatype, 
+			  size_t dimX, size_t dimY, size_t dimZ, size_t dimT)
+{
+  size_t nbytes = dimX*dimY*dimZ*dimT*fff_nbytes(datatype); 
+  void* buf = fff_arena_alloc(arena, nbytes); 
+
+  if (buf != NULL) 
+    memset(buf, 0, nbytes); 
+
+  return fff_array_view(datatype, buf, 
+			dimX, dimY, dimZ, dimT, 
+			dimY*dimZ*dimT, dimZ*dimT, dimT, 1); 
+}
+
+
 fff_array fff_array_view(fff_datatype datatype, void* buf,  
 			 size_t dimX, size_t dimY, size_t dimZ, size_t dimT,
 			 size_t offX, size_t offY, size_t offZ, size_t offT)
@@ -315,10 +364,21 @@ void fff_array_set(fff_array* thisone,
 
 void fff_array_set_all(fff_array* thisone, double val)
 {
-  fff_array_iterator iter = fff_array_iterator_init(thisone); 
+  size_t k, n, off; 
+  fff_array_iterator iter = fff_array_iterator_init_runs(thisone, &n, &off); 
 
   while (iter.idx < iter.size) {
-    fff_array_set_from_iterator(thisone, iter, val);
+#define _FFF_ARRAY_SET_ALL(type, STORE)					\
+    {									\
+      type* r = (type*)iter.data;					\
+      type c = STORE(type, val);					\
+      if (off == 1)							\
+	for (k=0; k<n; k++) r[k] = c;					\
+      else								\
+	for (k=0; k<n; k++) r[k*off] = c;				\
+    }
+    _FFF_ARRAY_TYPED(thisone->datatype, _FFF_ARRAY_SET_ALL);
+#undef _FFF_ARRAY_SET_ALL
     fff_array_iterator_update(&iter); 
   }								
   
@@ -345,18 +405,27 @@ fff_array fff_array_get_block(const fff_array* thisone,
 void fff_array_extrema (double* min, double* max, const fff_array* thisone) 
 {
   double val; 
-  fff_array_iterator iter = fff_array_iterator_init(thisone); 
+  size_t k, n, off; 
+  fff_array_iterator iter = fff_array_iterator_init_runs(thisone, &n, &off); 
   
   /* Initialization */ 
   *min = FFF_POSINF; /* 0.0;*/ 
   *max = FFF_NEGINF; /*0.0;*/ 
 
   while (iter.idx < iter.size) {
-    val = fff_array_get_from_iterator(thisone, iter);
-    if (val < *min)
-      *min = val; 
-    else if (val > *max) 
-      *max = val;
+#define _FFF_ARRAY_EXTREMA(type, STORE)					\
+    {									\
+      const type* r = (const type*)iter.data;				\
+      for (k=0; k<n; k++) {						\
+	val = (double)r[k*off];						\
+	if (val < *min)							\
+	  *min = val;							\
+	else if (val > *max)						\
+	  *max = val;							\
+      }									\
+    }
+    _FFF_ARRAY_TYPED(thisone->datatype, _FFF_ARRAY_EXTREMA);
+#undef _FFF_ARRAY_EXTREMA
     fff_array_iterator_update(&iter); 
   }
 
@@ -376,19 +445,7 @@ void fff_array_extrema (double* min, double* max, const fff_array* thisone)
 
 void fff_array_copy(fff_array* aRes, const fff_array* aSrc)
 {
-  fff_array_iterator itSrc = fff_array_iterator_init(aSrc); 
-  fff_array_iterator itRes = fff_array_iterator_init(aRes); 
-  double valSrc; 
-
-  CHECK_DIMS(aRes, aSrc); 
-  
-  while (itSrc.idx < itSrc.size) {
-    valSrc = fff_array_get_from_iterator(aSrc, itSrc);
-    fff_array_set_from_iterator(aRes, itRes, valSrc); 
-    fff_array_iterator_update(&itSrc); 
-    fff_array_iterator_update(&itRes); 
-  }
-
+  _fff_array_binary(aRes, aSrc, _FFF_ARRAY_COPY, 0, 0); 
   return;
 }
 
@@ -403,80 +460,30 @@ void fff_array_compress(fff_array* aRes, const fff_array* aSrc,
 			double r0, double s0, 
 			double r1, double s1)
 {
-  fff_array_iterator itSrc = fff_array_iterator_init(aSrc); 
-  fff_array_iterator itRes = fff_array_iterator_init(aRes); 
-  double a, b, valSrc; 
+  double a, b; 
 
-  CHECK_DIMS(aRes, aSrc); 
-  
   a = (r1-r0) / (s1-s0); 
   b = r0 - a*s0; 
-
-  while (itSrc.idx < itSrc.size) {
-    valSrc = fff_array_get_from_iterator(aSrc, itSrc);
-    fff_array_set_from_iterator(aRes, itRes, a*valSrc+b); 
-    fff_array_iterator_update(&itSrc); 
-    fff_array_iterator_update(&itRes); 
-  }
+  _fff_array_binary(aRes, aSrc, _FFF_ARRAY_COMPRESS, a, b); 
 
   return;
 }
 
 void fff_array_add(fff_array* aRes, const fff_array* aSrc)
 {
-  
-  fff_array_iterator itSrc = fff_array_iterator_init(aSrc); 
-  fff_array_iterator itRes = fff_array_iterator_init(aRes); 
-  double v; 
-
-  CHECK_DIMS(aRes, aSrc); 
-
-  while (itSrc.idx < itSrc.size) {
-    v = fff_array_get_from_iterator(aRes, itRes); 
-    v += fff_array_get_from_iterator(aSrc, itSrc); 
-    fff_array_set_from_iterator(aRes, itRes, v); 
-    fff_array_iterator_update(&itSrc); 
-    fff_array_iterator_update(&itRes); 
-  }
-
+  _fff_array_binary(aRes, aSrc, _FFF_ARRAY_ADD, 0, 0); 
   return;
 }
 
 void fff_array_sub(fff_array* aRes, const fff_array* aSrc) 
 {
-  fff_array_iterator itSrc = fff_array_iterator_init(aSrc); 
-  fff_array_iterator itRes = fff_array_iterator_init(aRes); 
-  double v; 
-
-  CHECK_DIMS(aRes, aSrc);   
-
-  while (itSrc.idx < itSrc.size) {
-    v = fff_array_get_from_iterator(aRes, itRes); 
-    v -= fff_array_get_from_iterator(aSrc, itSrc); 
-    fff_array_set_from_iterator(aRes, itRes, v);  
-    fff_array_iterator_update(&itSrc); 
-    fff_array_iterator_update(&itRes); 
-  }
-
+  _fff_array_binary(aRes, aSrc, _FFF_ARRAY_SUB, 0, 0); 
   return;
 }
 
 void fff_array_mul(fff_array* aRes, const fff_array* aSrc) 
 {
-  fff_array_iterator itSrc = fff_array_iterator_init(aSrc); 
-  fff_array_iterator itRes = fff_array_iterator_init(aRes); 
-  double v; 
-
-  CHECK_DIMS(aRes, aSrc); 
-  
-  while (itSrc.idx < itSrc.size) {
-    v = fff_array_get_from_iterator(aRes, itRes); 
-    v *= fff_array_get_from_iterator(aSrc, itSrc); 
-    fff_array_set_from_iterator(aRes, itRes, v);   
-    fff_array_iterator_update(&itSrc); 
-    fff_array_iterator_update(&itRes); 
-  }
-
+  _fff_array_binary(aRes, aSrc, _FFF_ARRAY_MUL, 0, 0); 
   return;
 }
 
@@ -485,18 +492,102 @@ void fff_array_mul(fff_array* aRes, const fff_array* aSrc)
  */
 void fff_array_div(fff_array* aRes, const fff_array* aSrc) 
 {
-  fff_array_iterator itSrc = fff_array_iterator_init(aSrc); 
-  fff_array_iterator itRes = fff_array_iterator_init(aRes); 
+  _fff_array_binary(aRes, aSrc, _FFF_ARRAY_DIV, 0, 0); 
+  return;
+}
+
+
+/* 
+   Element-wise operation aRes = op(aRes, aSrc), run by run. Arrays
+   of the same type use typed loops, with unit offsets singled out so
+   that the compiler may vectorize them; other arrays go through the
+   accessors. Values are computed in double and stored as by the set
+   accessors, hence both paths agree, except that copies between
+   arrays of the same type are exact.
+*/
+static void _fff_array_binary(fff_array* aRes, const fff_array* aSrc, int op, double a, double b)
+{
+  fff_array_iterator itSrc, itRes; 
+  size_t k, n, oSrc, oRes, linSrc, linRes; 
+  int linear; 
   double v; 
 
   CHECK_DIMS(aRes, aSrc); 
-  
+
+  linear = _fff_array_linear(aRes, &linRes) && _fff_array_linear(aSrc, &linSrc); 
+  itRes = _fff_array_runs(aRes, linear, linRes, &n, &oRes); 
+  itSrc = _fff_array_runs(aSrc, linear, linSrc, &n, &oSrc); 
+
   while (itSrc.idx < itSrc.size) {
-    v = fff_array_get_from_iterator(aSrc, itSrc); 
-    if (FFF_ABS(v)<FFF_TINY) 
-      v = FFF_TINY; 
-    v = fff_array_get_from_iterator(aRes, itRes)/v; 
-    fff_array_set_from_iterator(aRes, itRes, v);   
+
+    if (aRes->datatype == aSrc->datatype) {
+#define _FFF_ARRAY_BINARY_RUN(type, STORE, oR, oS)			\
+      {									\
+	type* r = (type*)itRes.data;					\
+	const type* s = (const type*)itSrc.data;			\
+	switch (op) {							\
+	case _FFF_ARRAY_COPY:						\
+	  for (k=0; k<n; k++) r[k*(oR)] = s[k*(oS)];			\
+	  break;							\
+	case _FFF_ARRAY_COMPRESS:					\
+	  for (k=0; k<n; k++) r[k*(oR)] = STORE(type, a*(double)s[k*(oS)]+b); \
+	  break;							\
+	case _FFF_ARRAY_ADD:						\
+	  for (k=0; k<n; k++) r[k*(oR)] = STORE(type, (double)r[k*(oR)]+(double)s[k*(oS)]); \
+	  break;							\
+	case _FFF_ARRAY_SUB:						\
+	  for (k=0; k<n; k++) r[k*(oR)] = STORE(type, (double)r[k*(oR)]-(double)s[k*(oS)]); \
+	  break;							\
+	case _FFF_ARRAY_MUL:						\
+	  for (k=0; k<n; k++) r[k*(oR)] = STORE(type, (double)r[k*(oR)]*(double)s[k*(oS)]); \
+	  break;							\
+	default:							\
+	  for (k=0; k<n; k++) {						\
+	    v = (double)s[k*(oS)];					\
+	    if (FFF_ABS(v)<FFF_TINY)					\
+	      v = FFF_TINY;						\
+	    r[k*(oR)] = STORE(type, (double)r[k*(oR)]/v);		\
+	  }								\
+	  break;							\
+	}								\
+      }
+#define _FFF_ARRAY_BINARY(type, STORE)					\
+      if ((oRes == 1) && (oSrc == 1))					\
+	_FFF_ARRAY_BINARY_RUN(type, STORE, 1, 1)			\
+      else								\
+	_FFF_ARRAY_BINARY_RUN(type, STORE, oRes, oSrc)
+      _FFF_ARRAY_TYPED(aRes->datatype, _FFF_ARRAY_BINARY);
+#undef _FFF_ARRAY_BINARY
+#undef _FFF_ARRAY_BINARY_RUN
+    }
+
+    else 
+      for (k=0; k<n; k++) {
+	v = aSrc->get(itSrc.data, k*oSrc); 
+	switch (op) {
+	case _FFF_ARRAY_COPY:
+	  break; 
+	case _FFF_ARRAY_COMPRESS:
+	  v = a*v+b; 
+	  break; 
+	case _FFF_ARRAY_ADD:
+	  v = aRes->get(itRes.data, k*oRes) + v; 
+	  break; 
+	case _FFF_ARRAY_SUB:
+	  v = aRes->get(itRes.data, k*oRes) - v; 
+	  break; 
+	case _FFF_ARRAY_MUL:
+	  v = aRes->get(itRes.data, k*oRes) * v; 
+	  break; 
+	default:
+	  if (FFF_ABS(v)<FFF_TINY) 
+	    v = FFF_TINY; 
+	  v = aRes->get(itRes.data, k*oRes) / v; 
+	  break; 
+	}
+	aRes->set(itRes.data, k*oRes, v); 
+      }
+
     fff_array_iterator_update(&itSrc); 
     fff_array_iterator_update(&itRes); 
   }
@@ -507,7 +598,6 @@ void fff_array_div(fff_array* aRes, const fff_array* aSrc)
 
 
 
-
 fff_array_iterator fff_array_iterator_init_skip_axis(const fff_array* im, int axis)
 {
   fff_array_iterator iter;
@@ -583,6 +673,68 @@ fff_array_iterator fff_array_iterator_init(const fff_array* im)
 }
 
 
+/* 
+   Check whether all the elements of an array, in iteration order,
+   are separated by a constant offset, and return it.
+*/
+static int _fff_array_linear(const fff_array* im, size_t* offset)
+{
+  size_t dims[4] = {im->dimX, im->dimY, im->dimZ, im->dimT}; 
+  size_t offs[4] = {im->offsetX, im->offsetY, im->offsetZ, im->offsetT}; 
+  size_t next = 0; 
+  int axis, first = 1; 
+
+  *offset = 1; 
+  for (axis=3; axis>=0; axis--) {
+    if (dims[axis] <= 1) 
+      continue; 
+    if (first) {
+      *offset = offs[axis]; 
+      first = 0; 
+    }
+    else if (offs[axis] != next) 
+      return 0; 
+    next = offs[axis]*dims[axis]; 
+  }
+
+  return 1; 
+}
+
+/* 
+   Runs of an array: the whole array if linear, otherwise its lines
+   along the last axis
+*/ 
+static fff_array_iterator _fff_array_runs(const fff_array* im, int linear, size_t linear_offset, 
+					  size_t* length, size_t* offset)
+{
+  fff_array_iterator iter; 
+  int axis = (int)im->ndims - 1; 
+  size_t size = im->dimX*im->dimY*im->dimZ*im->dimT; 
+
+  if (linear || (size == 0)) {
+    iter = fff_array_iterator_init(im); 
+    iter.size = (size > 0); 
+    *length = size; 
+    *offset = linear_offset; 
+  }
+  else {
+    iter = fff_array_iterator_init_skip_axis(im, axis); 
+    *length = fff_array_dim(im, axis); 
+    *offset = fff_array_offset(im, axis); 
+  }
+
+  return iter; 
+}
+
+fff_array_iterator fff_array_iterator_init_runs(const fff_array* im, size_t* length, size_t* offset)
+{
+  size_t linear_offset; 
+  int linear = _fff_array_linear(im, &linear_offset); 
+
+  return _fff_array_runs(im, linear, linear_offset, length, offset); 
+}
+
+
 
 
 static void _fff_array_iterator_update1d(void* it)
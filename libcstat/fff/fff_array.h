@@ -197,6 +197,22 @@ extern "C" {
 				   size_t dimX, size_t dimY, size_t dimZ, size_t dimT,
 				   size_t offX, size_t offY, size_t offZ, size_t offT); 
 
+  /*! 
+    \brief Array allocated from an arena
+    \param arena scratch memory
+    \param datatype image encoding type
+    \param dimX number of pixels along the first axis
+    \param dimY number of pixels along the second axis
+    \param dimZ number of pixels along the third axis
+    \param dimT number of pixels along the fourth axis
+
+    The array has the layout of \c fff_array_new and is zero-filled,
+    but does not own its data, which is released by resetting the
+    arena.
+  */
+  extern fff_array fff_array_arena(fff_arena* arena, fff_datatype datatype, 
+				    size_t dimX, size_t dimY, size_t dimZ, size_t dimT); 
+
 
   /*! 
     \brief Generic function to access a voxel's value
@@ -290,6 +306,22 @@ extern "C" {
 
   extern fff_array_iterator fff_array_iterator_init(const fff_array* array); 
   extern fff_array_iterator fff_array_iterator_init_skip_axis(const fff_array* array, int axis); 
+
+  /*!
+    \brief Iterator over the runs of an array
+    \param array input array
+    \param length number of elements of each run
+    \param offset offset between consecutive elements of a run (relative to type)
+
+    The iterator points to the first element of each run, the \a k-th
+    element being at \c k*offset items from there. Runs cover the
+    array in the order of \c fff_array_iterator_init: there is a
+    single run if all elements are separated by a constant offset,
+    e.g. for contiguous arrays, otherwise runs are the lines along the
+    last non-unit axis. Element-wise operations on arrays use runs,
+    with typed loops when the types match.
+  */
+  extern fff_array_iterator fff_array_iterator_init_runs(const fff_array* array, size_t* length, size_t* offset); 
   
   /*  extern void fff_array_iterator_update(fff_array_iterator* thisone); */
   extern void fff_array_iterate_vector_function(fff_array* array, int axis, 
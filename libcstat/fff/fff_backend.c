@@ -0,0 +1,307 @@
+#include "fff_base.h"
+#include "fff_backend.h"
+#include "fff_threads.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#ifndef FFF_NO_DLOPEN
+#include <dlfcn.h>
+#endif
+#ifndef FFF_NO_THREADS
+#include <pthread.h>
+#endif
+
+#define FNAME FFF_FNAME
+
+#define _FFF_BACKEND_STR(x) #x
+#define _FFF_BACKEND_XSTR(x) _FFF_BACKEND_STR(x)
+
+/* BLAS 1 */
+extern double FNAME(ddot)(int* n, double* dx, int* incx, double* dy,
+			  int* incy); 
+extern double FNAME(dnrm2)(int* n, double* x, int* incx); 
+extern double FNAME(dasum)(int* n, double* dx, int* incx); 
+extern int FNAME(idamax)(int* n, double* dx, int* incx); 
+extern int FNAME(dswap)(int* n, double* dx, int* incx,
+			double* dy, int* incy); 
+extern int FNAME(dcopy)(int* n, double* dx, int* incx,
+			double* dy, int* incy); 
+extern int FNAME(daxpy)(int* n, double* da, double* dx,
+			int* incx, double* dy, int* incy);
+extern int FNAME(dscal)(int* n, double* da, double* dx,
+			int* incx); 
+extern int FNAME(drotg)(double* da, double* db, double* c__,
+			double* s);
+extern int FNAME(drot)(int* n, double* dx, int* incx,
+		       double* dy, int* incy, double* c__, double* s); 
+extern int FNAME(drotmg)(double* dd1, double* dd2, double* 
+			 dx1, double* dy1, double* dparam);
+extern int FNAME(drotm)(int* n, double* dx, int* incx,
+			double* dy, int* incy, double* dparam); 
+
+/* BLAS 2 */
+extern int FNAME(dgemv)(char *trans, int* m, int* n, double* 
+			alpha, double* a, int* lda, double* x, int* incx,
+			double* beta, double* y, int* incy);
+extern int FNAME(dtrmv)(char *uplo, char *trans, char *diag, int* n,
+			double* a, int* lda, double* x, int* incx); 
+extern int FNAME(dtrsv)(char *uplo, char *trans, char *diag, int* n,
+			double* a, int* lda, double* x, int* incx); 
+extern int FNAME(dsymv)(char *uplo, int* n, double* alpha,
+			double* a, int* lda, double* x, int* incx, double
+			*beta, double* y, int* incy);
+extern int FNAME(dger)(int* m, int* n, double* alpha,
+		       double* x, int* incx, double* y, int* incy,
+		       double* a, int* lda);
+extern int FNAME(dsyr)(char *uplo, int* n, double* alpha,
+		       double* x, int* incx, double* a, int* lda); 
+extern int FNAME(dsyr2)(char *uplo, int* n, double* alpha,
+			double* x, int* incx, double* y, int* incy,
+			double* a, int* lda); 
+
+/* BLAS 3 */ 
+extern int FNAME(dgemm)(char *transa, char *transb, int* m, int* 
+			n, int* k, double* alpha, double* a, int* lda,
+			double* b, int* ldb, double* beta, double* c__,
+			int* ldc); 
+extern int FNAME(dsymm)(char *side, char *uplo, int* m, int* n,
+			double* alpha, double* a, int* lda, double* b,
+			int* ldb, double* beta, double* c__, int* ldc); 
+extern int FNAME(dtrmm)(char *side, char *uplo, char *transa, char *diag,
+			int* m, int* n, double* alpha, double* a, int* 
+			lda, double* b, int* ldb); 
+extern int FNAME(dtrsm)(char *side, char *uplo, char *transa, char *diag,
+			int* m, int* n, double* alpha, double* a, int* 
+			lda, double* b, int* ldb); 
+extern int FNAME(dsyrk)(char *uplo, char *trans, int* n, int* k,
+			double* alpha, double* a, int* lda, double* beta,
+			double* c__, int* ldc); 
+extern int FNAME(dsyr2k)(char *uplo, char *trans, int* n, int* k,
+			 double* alpha, double* a, int* lda, double* b,
+			 int* ldb, double* beta, double* c__, int* ldc);
+
+/* LAPACK */
+extern int FNAME(dgetrf)(int* m, int* n, double* a, int* lda, int* ipiv, int* info);
+extern int FNAME(dpotrf)(char *uplo, int* n, double* a, int* lda, int* info); 
+extern int FNAME(dgesdd)(char *jobz, int* m, int* n, double* a, int* lda, double* s, double* u, int* ldu,
+			 double* vt, int* ldvt, double* work, int* lwork, int* iwork, int* info);
+extern int FNAME(dgeqrf)(int* m, int* n, double* a, int* lda, double* tau, double* work, int* lwork, int* info);
+
+
+/* Routines libcstat is linked with */ 
+static const fff_backend _fff_backend_builtin = {
+  "builtin", "builtin", 
+  FNAME(ddot), FNAME(dnrm2), FNAME(dasum), FNAME(idamax), FNAME(dswap),
+  FNAME(dcopy), FNAME(daxpy), FNAME(dscal), FNAME(drotg), FNAME(drot),
+  FNAME(drotmg), FNAME(drotm), FNAME(dgemv), FNAME(dtrmv), FNAME(dtrsv),
+  FNAME(dsymv), FNAME(dger), FNAME(dsyr), FNAME(dsyr2), FNAME(dgemm),
+  FNAME(dsymm), FNAME(dtrmm), FNAME(dtrsm), FNAME(dsyrk), FNAME(dsyr2k),
+  FNAME(dgetrf), FNAME(dpotrf), FNAME(dgesdd), FNAME(dgeqrf),
+}; 
+
+static fff_backend _fff_backend; 
+
+/* Thread control of the loaded library */ 
+static int (*_fff_backend_get_threads)(void) = NULL; 
+static void (*_fff_backend_set_threads)(int) = NULL; 
+static void (*_fff_backend_set_threads_long)(long) = NULL; 
+
+static void _fff_backend_init(void); 
+static int _fff_backend_load(const char* path); 
+
+#ifndef FFF_NO_THREADS
+static pthread_once_t _fff_backend_once = PTHREAD_ONCE_INIT; 
+#define _FFF_BACKEND_INIT() pthread_once(&_fff_backend_once, &_fff_backend_init)
+#else
+static int _fff_backend_ready = 0; 
+#define _FFF_BACKEND_INIT()						\
+  if (!_fff_backend_ready) {						\
+    _fff_backend_ready = 1;						\
+    _fff_backend_init();						\
+  }
+#endif
+
+
+#ifndef FFF_NO_DLOPEN
+
+/* Libraries searched by default, with their name */ 
+static const char* _fff_backend_libs[] = {
+#ifdef __APPLE__
+  "openblas", "libopenblas.0.dylib", 
+  "openblas", "libopenblas.dylib", 
+  "mkl", "libmkl_rt.2.dylib", 
+  "mkl", "libmkl_rt.dylib", 
+  "blis", "libblis.4.dylib", 
+  "blis", "libblis.dylib", 
+  "accelerate", "/System/Library/Frameworks/Accelerate.framework/Accelerate", 
+#else
+  "openblas", "libopenblas.so.0", 
+  "openblas", "libopenblas.so", 
+  "mkl", "libmkl_rt.so.2", 
+  "mkl", "libmkl_rt.so", 
+  "blis", "libblis.so.4", 
+  "blis", "libblis.so", 
+#endif
+  NULL, NULL
+}; 
+
+static void* _fff_backend_handle = NULL; 
+
+#define _FFF_BACKEND_RESOLVE(T, name)					\
+  ((*(void**)(&((T)->name)) = dlsym(handle, _FFF_BACKEND_XSTR(FNAME(name)))) != NULL)
+
+/* 
+   Take the BLAS, and the LAPACK if complete, from the library; 1 is
+   returned if the BLAS is incomplete.
+*/ 
+static int _fff_backend_open(const char* name, const char* path)
+{
+  void* handle = dlopen(path, RTLD_NOW | RTLD_LOCAL); 
+  fff_backend T = _fff_backend_builtin; 
+
+  if (handle == NULL) 
+    return 1; 
+  
+  if (!(
+    _FFF_BACKEND_RESOLVE(&T, ddot) &&
+    _FFF_BACKEND_RESOLVE(&T, dnrm2) &&
+    _FFF_BACKEND_RESOLVE(&T, dasum) &&
+    _FFF_BACKEND_RESOLVE(&T, idamax) &&
+    _FFF_BACKEND_RESOLVE(&T, dswap) &&
+    _FFF_BACKEND_RESOLVE(&T, dcopy) &&
+    _FFF_BACKEND_RESOLVE(&T, daxpy) &&
+    _FFF_BACKEND_RESOLVE(&T, dscal) &&
+    _FFF_BACKEND_RESOLVE(&T, drotg) &&
+    _FFF_BACKEND_RESOLVE(&T, drot) &&
+    _FFF_BACKEND_RESOLVE(&T, drotmg) &&
+    _FFF_BACKEND_RESOLVE(&T, drotm) &&
+    _FFF_BACKEND_RESOLVE(&T, dgemv) &&
+    _FFF_BACKEND_RESOLVE(&T, dtrmv) &&
+    _FFF_BACKEND_RESOLVE(&T, dtrsv) &&
+    _FFF_BACKEND_RESOLVE(&T, dsymv) &&
+    _FFF_BACKEND_RESOLVE(&T, dger) &&
+    _FFF_BACKEND_RESOLVE(&T, dsyr) &&
+    _FFF_BACKEND_RESOLVE(&T, dsyr2) &&
+    _FFF_BACKEND_RESOLVE(&T, dgemm) &&
+    _FFF_BACKEND_RESOLVE(&T, dsymm) &&
+    _FFF_BACKEND_RESOLVE(&T, dtrmm) &&
+    _FFF_BACKEND_RESOLVE(&T, dtrsm) &&
+    _FFF_BACKEND_RESOLVE(&T, dsyrk) &&
+    _FFF_BACKEND_RESOLVE(&T, dsyr2k))) {
+    dlclose(handle); 
+    return 1; 
+  }
+  T.blas = name; 
+  
+  if (
+    _FFF_BACKEND_RESOLVE(&T, dgetrf) &&
+    _FFF_BACKEND_RESOLVE(&T, dpotrf) &&
+    _FFF_BACKEND_RESOLVE(&T, dgesdd) &&
+    _FFF_BACKEND_RESOLVE(&T, dgeqrf))
+    T.lapack = name; 
+  else {
+    T.dgetrf = _fff_backend_builtin.dgetrf; 
+    T.dpotrf = _fff_backend_builtin.dpotrf; 
+    T.dgesdd = _fff_backend_builtin.dgesdd; 
+    T.dgeqrf = _fff_backend_builtin.dgeqrf; 
+  }
+
+  _fff_backend = T; 
+  _fff_backend_handle = handle; 
+  *(void**)(&_fff_backend_get_threads) = dlsym(handle, "openblas_get_num_threads"); 
+  *(void**)(&_fff_backend_set_threads) = dlsym(handle, "openblas_set_num_threads"); 
+  if (_fff_backend_get_threads == NULL) {
+    *(void**)(&_fff_backend_get_threads) = dlsym(handle, "MKL_Get_Max_Threads"); 
+    *(void**)(&_fff_backend_set_threads) = dlsym(handle, "MKL_Set_Num_Threads"); 
+  }
+  if (_fff_backend_get_threads == NULL) {
+    /* dim_t arguments, which are 64-bit integers by default */ 
+    *(void**)(&_fff_backend_get_threads) = dlsym(handle, "bli_thread_get_num_threads"); 
+    *(void**)(&_fff_backend_set_threads_long) = dlsym(handle, "bli_thread_set_num_threads"); 
+  }
+
+  return 0; 
+}
+
+static void _fff_backend_close(void)
+{
+  _fff_backend = _fff_backend_builtin; 
+  _fff_backend_get_threads = NULL; 
+  _fff_backend_set_threads = NULL; 
+  _fff_backend_set_threads_long = NULL; 
+  if (_fff_backend_handle != NULL) 
+    dlclose(_fff_backend_handle); 
+  _fff_backend_handle = NULL; 
+}
+
+#endif
+
+
+static void _fff_backend_init(void)
+{
+  _fff_backend = _fff_backend_builtin; 
+  _fff_backend_load(getenv("FFF_BLAS")); 
+}
+
+const fff_backend* fff_backend_get(void)
+{
+  _FFF_BACKEND_INIT(); 
+  return &_fff_backend; 
+}
+
+int fff_backend_load(const char* path)
+{
+  _FFF_BACKEND_INIT(); 
+  return _fff_backend_load(path); 
+}
+
+static int _fff_backend_load(const char* path)
+{
+#ifndef FFF_NO_DLOPEN
+  int i; 
+
+  _fff_backend_close(); 
+  if ((path != NULL) && (strcmp(path, "builtin") == 0)) 
+    return 0; 
+
+  if (path != NULL) {
+    if (_fff_backend_open(path, path) == 0) 
+      return 0; 
+    FFF_WARNING("BLAS library not found, using the builtin routines"); 
+    return 1; 
+  }
+  
+  for (i=0; _fff_backend_libs[i] != NULL; i+=2) 
+    if (_fff_backend_open(_fff_backend_libs[i], _fff_backend_libs[i+1]) == 0) 
+      return 0; 
+  return 1; 
+
+#else
+  if ((path == NULL) || (strcmp(path, "builtin") == 0)) 
+    return 0; 
+  return 1; 
+#endif
+}
+
+int fff_backend_get_num_threads(void)
+{
+  _FFF_BACKEND_INIT(); 
+  if (_fff_backend_get_threads != NULL) 
+    return (*_fff_backend_get_threads)(); 
+  if (strcmp(_fff_backend.blas, "builtin") == 0) 
+    return 1; 
+  return 0; 
+}
+
+int fff_backend_set_num_threads(int nthreads)
+{
+  _FFF_BACKEND_INIT(); 
+  if (_fff_backend_set_threads != NULL) 
+    (*_fff_backend_set_threads)(nthreads); 
+  else if (_fff_backend_set_threads_long != NULL) 
+    (*_fff_backend_set_threads_long)((long)nthreads); 
+  else
+    return 1; 
+  return 0; 
+}
@@ -0,0 +1,144 @@
+/*!
+  \file fff_backend.h
+  \brief Run-time selection of the BLAS and LAPACK implementation
+  \date 2009
+
+  \c fff_blas and \c fff_lapack call the Fortran routines through a
+  table of function pointers. The table initially holds the routines
+  libcstat is linked with, that is lapack_lite unless an external
+  LAPACK was found at build time. On first use, it is redirected to
+  an optimized library loaded at run time: the one named by the \c
+  FFF_BLAS environment variable if it is set, otherwise the first of
+  OpenBLAS, MKL, BLIS and Accelerate that can be found. BLAS and
+  LAPACK are resolved separately, so that a library that only
+  provides the BLAS, such as BLIS, is used together with the linked
+  LAPACK. Setting \c FFF_BLAS to \c builtin keeps the linked
+  routines.
+
+  Libraries are loaded using \c dlopen. Define \c FFF_NO_DLOPEN at
+  compile time to always use the linked routines; this is the
+  default on Windows.
+
+  Optimized libraries usually run their own threads. Callers that
+  run BLAS routines from several threads at once, e.g. through \c
+  fff_parallel_run, may limit them with \c
+  fff_backend_set_num_threads.
+*/
+
+#ifndef FFF_BACKEND
+#define FFF_BACKEND
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if defined(_WIN32) && !defined(FFF_NO_DLOPEN)
+#define FFF_NO_DLOPEN
+#endif
+
+  /*!
+    \struct fff_backend
+    \brief Fortran BLAS and LAPACK routines in use
+  */
+  typedef struct {
+    const char* blas;        /*!< name of the BLAS provider */
+    const char* lapack;      /*!< name of the LAPACK provider */
+
+    /* BLAS 1 */
+    double (*ddot)(int* n, double* dx, int* incx, double* dy, int* incy);
+    double (*dnrm2)(int* n, double* x, int* incx);
+    double (*dasum)(int* n, double* dx, int* incx);
+    int (*idamax)(int* n, double* dx, int* incx);
+    int (*dswap)(int* n, double* dx, int* incx, double* dy, int* incy);
+    int (*dcopy)(int* n, double* dx, int* incx, double* dy, int* incy);
+    int (*daxpy)(int* n, double* da, double* dx, int* incx, double* dy,
+		 int* incy);
+    int (*dscal)(int* n, double* da, double* dx, int* incx);
+    int (*drotg)(double* da, double* db, double* c__, double* s);
+    int (*drot)(int* n, double* dx, int* incx, double* dy, int* incy,
+		 double* c__, double* s);
+    int (*drotmg)(double* dd1, double* dd2, double* dx1, double* dy1,
+		 double* dparam);
+    int (*drotm)(int* n, double* dx, int* incx, double* dy, int* incy,
+		 double* dparam);
+    /* BLAS 2 */
+    int (*dgemv)(char *trans, int* m, int* n, double* alpha, double* a,
+		 int* lda, double* x, int* incx, double* beta, double* y, int* incy);
+    int (*dtrmv)(char *uplo, char *trans, char *diag, int* n, double* a,
+		 int* lda, double* x, int* incx);
+    int (*dtrsv)(char *uplo, char *trans, char *diag, int* n, double* a,
+		 int* lda, double* x, int* incx);
+    int (*dsymv)(char *uplo, int* n, double* alpha, double* a, int* lda,
+		 double* x, int* incx, double *beta, double* y, int* incy);
+    int (*dger)(int* m, int* n, double* alpha, double* x, int* incx,
+		 double* y, int* incy, double* a, int* lda);
+    int (*dsyr)(char *uplo, int* n, double* alpha, double* x, int* incx,
+		 double* a, int* lda);
+    int (*dsyr2)(char *uplo, int* n, double* alpha, double* x, int* incx,
+		 double* y, int* incy, double* a, int* lda);
+    /* BLAS 3 */
+    int (*dgemm)(char *transa, char *transb, int* m, int* n, int* k,
+		 double* alpha, double* a, int* lda, double* b, int* ldb, double* beta,
+		 double* c__, int* ldc);
+    int (*dsymm)(char *side, char *uplo, int* m, int* n, double* alpha,
+		 double* a, int* lda, double* b, int* ldb, double* beta, double* c__,
+		 int* ldc);
+    int (*dtrmm)(char *side, char *uplo, char *transa, char *diag, int* m,
+		 int* n, double* alpha, double* a, int* lda, double* b, int* ldb);
+    int (*dtrsm)(char *side, char *uplo, char *transa, char *diag, int* m,
+		 int* n, double* alpha, double* a, int* lda, double* b, int* ldb);
+    int (*dsyrk)(char *uplo, char *trans, int* n, int* k, double* alpha,
+		 double* a, int* lda, double* beta, double* c__, int* ldc);
+    int (*dsyr2k)(char *uplo, char *trans, int* n, int* k, double* alpha,
+		 double* a, int* lda, double* b, int* ldb, double* beta, double* c__,
+		 int* ldc);
+    /* LAPACK */
+    int (*dgetrf)(int* m, int* n, double* a, int* lda, int* ipiv, int* info);
+    int (*dpotrf)(char *uplo, int* n, double* a, int* lda, int* info);
+    int (*dgesdd)(char *jobz, int* m, int* n, double* a, int* lda, double* s,
+		 double* u, int* ldu, double* vt, int* ldvt, double* work, int* lwork,
+		 int* iwork, int* info);
+    int (*dgeqrf)(int* m, int* n, double* a, int* lda, double* tau,
+		 double* work, int* lwork, int* info);
+  } fff_backend;
+
+  /*!
+    \brief Routines in use
+
+    The first call selects the library, and is thread-safe.
+  */
+  extern const fff_backend* fff_backend_get(void);
+
+  /*!
+    \brief Switch to another library
+    \param path shared library to load, \c builtin for the linked
+    routines, or NULL to search the default libraries
+
+    Returns 0 if the library provides at least the BLAS; otherwise,
+    the linked routines are used and 1 is returned. This function may
+    not be called while other threads run BLAS or LAPACK routines.
+  */
+  extern int fff_backend_load(const char* path);
+
+  /*!
+    \brief Number of threads of the BLAS library
+
+    Returns 1 for the linked routines, and 0 if the library does not
+    tell.
+  */
+  extern int fff_backend_get_num_threads(void);
+
+  /*!
+    \brief Set the number of threads of the BLAS library
+    \param nthreads number of threads
+
+    Returns 0 on success, 1 if the library cannot be controlled.
+  */
+  extern int fff_backend_set_num_threads(int nthreads);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
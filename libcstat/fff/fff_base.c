@@ -1,5 +1,26 @@
 #include "fff_base.h"
 
+#include <stdlib.h>
+#include <errno.h>
+#include <string.h>
+#ifdef _WIN32
+#include <time.h>
+#else
+#include <sys/time.h>
+#endif
+
+/* Allocation granularity, enough for the alignment of any datatype */ 
+#define FFF_ARENA_ALIGN 16
+#define FFF_ARENA_ROUND(n) (((n) + FFF_ARENA_ALIGN - 1) / FFF_ARENA_ALIGN * FFF_ARENA_ALIGN)
+
+/* Header of the overflow blocks, which are chained backwards */ 
+typedef struct _fff_arena_block {
+  struct _fff_arena_block* prev; 
+  size_t mark;   /* arena position when the block was allocated */
+} _fff_arena_block; 
+
+#define FFF_ARENA_HEADER FFF_ARENA_ROUND(sizeof(_fff_arena_block))
+
 
 unsigned int fff_nbytes(fff_datatype type)
 {
@@ -116,3 +137,192 @@ fff_datatype fff_get_datatype( unsigned int sizeType,
 
 }
 
+
+
+fff_arena* fff_arena_new(size_t size)
+{
+  fff_arena* thisone = (fff_arena*)malloc(sizeof(fff_arena)); 
+
+  if (thisone == NULL) {
+    FFF_ERROR("Allocation failed", ENOMEM); 
+    return NULL; 
+  }
+  
+  size = FFF_ARENA_ROUND(size); 
+  thisone->buf = NULL; 
+  if (size > 0) {
+    thisone->buf = (char*)malloc(size); 
+    FFF_PROFILE_COUNT(FFF_PROFILE_ALLOCATIONS, 1); 
+    if (thisone->buf == NULL) {
+      FFF_ERROR("Allocation failed", ENOMEM); 
+      size = 0; 
+    }
+  }
+  thisone->size = size; 
+  thisone->pos = 0; 
+  thisone->peak = 0; 
+  thisone->overflow = NULL; 
+
+  return thisone; 
+}
+
+void fff_arena_delete(fff_arena* thisone)
+{
+  if (thisone == NULL) 
+    return; 
+  fff_arena_reset(thisone, 0); 
+  free(thisone->buf); 
+  free(thisone); 
+
+  return; 
+}
+
+void* fff_arena_alloc(fff_arena* thisone, size_t nbytes)
+{
+  _fff_arena_block* block; 
+  void* ptr; 
+
+  nbytes = FFF_ARENA_ROUND(FFF_MAX(nbytes, 1)); 
+
+  /* Fits in the buffer, unless overflow blocks are in use */ 
+  if ((thisone->overflow == NULL) && (thisone->pos + nbytes <= thisone->size)) {
+    ptr = (void*)(thisone->buf + thisone->pos); 
+    thisone->pos += nbytes; 
+  }
+  else {
+    block = (_fff_arena_block*)malloc(FFF_ARENA_HEADER + nbytes); 
+    FFF_PROFILE_COUNT(FFF_PROFILE_ALLOCATIONS, 1); 
+    if (block == NULL) {
+      FFF_ERROR("Allocation failed", ENOMEM); 
+      return NULL; 
+    }
+    block->prev = (_fff_arena_block*)thisone->overflow; 
+    block->mark = thisone->pos; 
+    thisone->overflow = (void*)block; 
+    ptr = (void*)((char*)block + FFF_ARENA_HEADER); 
+    thisone->pos = FFF_MAX(thisone->pos, thisone->size) + nbytes; 
+  }
+  
+  if (thisone->pos > thisone->peak) 
+    thisone->peak = thisone->pos; 
+
+  return ptr; 
+}
+
+size_t fff_arena_mark(const fff_arena* thisone)
+{
+  return thisone->pos; 
+}
+
+void fff_arena_reset(fff_arena* thisone, size_t mark)
+{
+  _fff_arena_block* block = (_fff_arena_block*)thisone->overflow; 
+  char* buf; 
+
+  while ((block != NULL) && (block->mark >= mark)) {
+    thisone->overflow = (void*)block->prev; 
+    free(block); 
+    block = (_fff_arena_block*)thisone->overflow; 
+  }
+  thisone->pos = mark; 
+
+  /* Grow the buffer once it is empty */ 
+  if ((mark == 0) && (thisone->peak > thisone->size)) {
+    buf = (char*)malloc(thisone->peak); 
+    FFF_PROFILE_COUNT(FFF_PROFILE_ALLOCATIONS, 1); 
+    if (buf != NULL) {
+      free(thisone->buf); 
+      thisone->buf = buf; 
+      thisone->size = thisone->peak; 
+    }
+  }
+
+  return; 
+}
+
+
+
+static fff_profile _fff_profile_local; 
+static fff_profile* _fff_profile = &_fff_profile_local; 
+
+#ifdef __GNUC__
+#define FFF_PROFILE_ADD(ptr, n) __sync_fetch_and_add(ptr, n)
+#else 
+#define FFF_PROFILE_ADD(ptr, n) (*(ptr) += (n))
+#endif
+
+/* Timers are added atomically by swapping the bits of the double if
+   the compiler has an 8-byte compare-and-swap */ 
+#if defined(__GNUC__) && defined(__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8)
+typedef unsigned long long __attribute__((__may_alias__)) _fff_profile_word; 
+
+static void _fff_profile_add_seconds(double* ptr, double t)
+{
+  _fff_profile_word* word = (_fff_profile_word*)ptr; 
+  union { double d; unsigned long long u; } old, new; 
+  unsigned long long cur = __sync_val_compare_and_swap(word, 0ULL, 0ULL); 
+
+  do {
+    old.u = cur; 
+    new.d = old.d + t; 
+    cur = __sync_val_compare_and_swap(word, old.u, new.u); 
+  } while (cur != old.u); 
+  return; 
+}
+#else 
+static void _fff_profile_add_seconds(double* ptr, double t)
+{
+  *ptr += t; 
+  return; 
+}
+#endif
+
+int fff_profile_enabled(void)
+{
+#ifdef FFF_PROFILE
+  return 1; 
+#else
+  return 0; 
+#endif
+}
+
+fff_profile* fff_profile_get(void)
+{
+  return _fff_profile; 
+}
+
+void fff_profile_share(fff_profile* table)
+{
+  _fff_profile = (table == NULL) ? &_fff_profile_local : table; 
+  return; 
+}
+
+void fff_profile_reset(void)
+{
+  memset((void*)_fff_profile, 0, sizeof(fff_profile)); 
+  return; 
+}
+
+double fff_profile_clock(void)
+{
+#ifdef _WIN32
+  return (double)clock()/(double)CLOCKS_PER_SEC; 
+#else
+  struct timeval tv; 
+  gettimeofday(&tv, NULL); 
+  return (double)tv.tv_sec + 1e-6*(double)tv.tv_usec; 
+#endif
+}
+
+void fff_profile_stop(fff_profile_timer timer, double start)
+{
+  FFF_PROFILE_ADD(_fff_profile->calls+timer, 1); 
+  _fff_profile_add_seconds(_fff_profile->seconds+timer, fff_profile_clock() - start); 
+  return; 
+}
+
+void fff_profile_count(fff_profile_counter counter, unsigned long n)
+{
+  FFF_PROFILE_ADD(_fff_profile->count+counter, n); 
+  return; 
+}
@@ -179,6 +179,163 @@ extern "C" {
 					unsigned int integerType, 
 					unsigned int signedType ); 
 
+  /*!
+    \struct fff_arena
+    \brief Scratch memory for the temporaries of hot loops
+
+    An arena hands out memory from a single buffer by moving a
+    position forward. Allocations are released all at once by
+    resetting the arena to a position previously returned by \c
+    fff_arena_mark, typically at the end of each loop iteration.
+
+    Requests that do not fit in the buffer are served by separate
+    overflow blocks; the next time the arena is reset to the empty
+    position, the buffer is resized to the largest position reached,
+    so that loops do no allocation at all after the first iteration.
+
+    An arena may not be shared between threads: each worker should
+    use its own.
+  */
+  typedef struct {
+    char* buf;       /*!< buffer */
+    size_t size;     /*!< buffer size in bytes */
+    size_t pos;      /*!< current position in bytes */
+    size_t peak;     /*!< largest position reached */
+    void* overflow;  /*!< last overflow block */
+  } fff_arena;
+
+  /*!
+    \brief Arena constructor
+    \param size initial buffer size in bytes, may be zero
+  */
+  extern fff_arena* fff_arena_new(size_t size); 
+
+  /*!
+    \brief Destructor for the \c fff_arena structure
+  */
+  extern void fff_arena_delete(fff_arena* thisone); 
+
+  /*!
+    \brief Allocate uninitialized memory from an arena
+    \param thisone arena
+    \param nbytes number of bytes
+
+    The memory is aligned for any fff datatype, and remains valid
+    until the arena is reset to a position preceding this
+    call. Returns NULL if memory allocation fails.
+  */
+  extern void* fff_arena_alloc(fff_arena* thisone, size_t nbytes); 
+
+  /*!
+    \brief Current position of an arena
+  */
+  extern size_t fff_arena_mark(const fff_arena* thisone); 
+
+  /*!
+    \brief Release the memory allocated after a given position
+    \param thisone arena
+    \param mark position returned by \c fff_arena_mark, or 0 to release everything
+  */
+  extern void fff_arena_reset(fff_arena* thisone, size_t mark); 
+
+
+  /*!
+    \typedef fff_profile_timer
+    \brief Timed entry points of the instrumentation layer
+  */
+  typedef enum {
+    FFF_PROFILE_JOINT_HIST = 0,   /*!< \c fff_imatch_joint_hist */
+    FFF_PROFILE_ONESAMPLE = 1,    /*!< \c fff_onesample_stat_eval */
+    FFF_PROFILE_GLM_KF = 2,       /*!< \c fff_glm_KF_fit */
+    FFF_PROFILE_GMM = 3,          /*!< \c fff_clustering_gmm */
+    FFF_PROFILE_DIJKSTRA = 4,     /*!< \c fff_graph_Dijkstra */
+    FFF_PROFILE_NTIMERS = 5
+  } fff_profile_timer;
+
+  /*!
+    \typedef fff_profile_counter
+    \brief Event counters of the instrumentation layer
+  */
+  typedef enum {
+    FFF_PROFILE_VOXELS = 0,          /*!< voxels processed */
+    FFF_PROFILE_EM_ITERATIONS = 1,   /*!< EM iterations */
+    FFF_PROFILE_RELAXATIONS = 2,     /*!< Dijkstra edge relaxations */
+    FFF_PROFILE_ALLOCATIONS = 3,     /*!< vector, matrix, array and arena allocations */
+    FFF_PROFILE_NCOUNTERS = 4
+  } fff_profile_counter;
+
+  /*!
+    \struct fff_profile
+    \brief Instrumentation counters
+
+    The instrumentation layer is only compiled in if \c FFF_PROFILE is
+    defined at compile time; otherwise, the macros below expand to
+    nothing and the counters remain zero.
+
+    Counters and timers are updated atomically with GCC-compatible
+    compilers, so that they may be incremented from worker threads.
+    Timers are updated by the thread that calls the timed function,
+    and measure wall time, including that of nested timed calls.
+  */
+  typedef struct {
+    unsigned long calls[FFF_PROFILE_NTIMERS];    /*!< number of calls of each entry point */
+    double seconds[FFF_PROFILE_NTIMERS];         /*!< time spent in each entry point */
+    unsigned long count[FFF_PROFILE_NCOUNTERS];  /*!< event counts */
+  } fff_profile;
+
+  /*!
+    \brief Return 1 if the library was compiled with \c FFF_PROFILE, 0 otherwise
+  */
+  extern int fff_profile_enabled(void);
+
+  /*!
+    \brief Counters updated by the library
+  */
+  extern fff_profile* fff_profile_get(void);
+
+  /*!
+    \brief Update another set of counters
+
+    Each program or extension module linked with a static copy of the
+    library has its own counters; this lets them share a single set.
+    \a table must remain valid as long as the library is used.
+  */
+  extern void fff_profile_share(fff_profile* table);
+
+  /*!
+    \brief Reset all the counters to zero
+  */
+  extern void fff_profile_reset(void);
+
+  /*!
+    \brief Wall clock in seconds, for the timers
+  */
+  extern double fff_profile_clock(void);
+
+  /*!
+    \brief Add one call and the time elapsed from \a start to a timer
+  */
+  extern void fff_profile_stop(fff_profile_timer timer, double start);
+
+  /*!
+    \brief Add \a n events to a counter
+  */
+  extern void fff_profile_count(fff_profile_counter counter, unsigned long n);
+
+  /*!
+    Scoped timer: \c FFF_PROFILE_BEGIN opens a block, which \c
+    FFF_PROFILE_END closes; the block must not be left by a \c return.
+  */
+#ifdef FFF_PROFILE
+#define FFF_PROFILE_BEGIN(timer) { double _fff_profile_start = fff_profile_clock();
+#define FFF_PROFILE_END(timer) fff_profile_stop(timer, _fff_profile_start); }
+#define FFF_PROFILE_COUNT(counter, n) fff_profile_count(counter, (unsigned long)(n))
+#else
+#define FFF_PROFILE_BEGIN(timer) {
+#define FFF_PROFILE_END(timer) }
+#define FFF_PROFILE_COUNT(counter, n) ((void)(n))
+#endif
+
 
 
 #ifdef __cplusplus
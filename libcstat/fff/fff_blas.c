@@ -1,9 +1,10 @@
 #include "fff_base.h"
 #include "fff_blas.h"
+#include "fff_backend.h"
 
 #include <math.h>
 
-#define FNAME FFF_FNAME
+#define BLAS(name) (fff_backend_get()->name)
 
 /* TODO : add tests for dimension compatibility */ 
 
@@ -20,71 +21,6 @@
 
 
 
-/* BLAS 1 */
-extern double FNAME(ddot)(int* n, double* dx, int* incx, double* dy,
-			  int* incy); 
-extern double FNAME(dnrm2)(int* n, double* x, int* incx); 
-extern double FNAME(dasum)(int* n, double* dx, int* incx); 
-extern int FNAME(idamax)(int* n, double* dx, int* incx); 
-extern int FNAME(dswap)(int* n, double* dx, int* incx,
-			double* dy, int* incy); 
-extern int FNAME(dcopy)(int* n, double* dx, int* incx,
-			double* dy, int* incy); 
-extern int FNAME(daxpy)(int* n, double* da, double* dx,
-			int* incx, double* dy, int* incy);
-extern int FNAME(dscal)(int* n, double* da, double* dx,
-			int* incx); 
-extern int FNAME(drotg)(double* da, double* db, double* c__,
-			double* s);
-extern int FNAME(drot)(int* n, double* dx, int* incx,
-		       double* dy, int* incy, double* c__, double* s); 
-extern int FNAME(drotmg)(double* dd1, double* dd2, double* 
-			 dx1, double* dy1, double* dparam);
-extern int FNAME(drotm)(int* n, double* dx, int* incx,
-			double* dy, int* incy, double* dparam); 
-
-/* BLAS 2 */
-extern int FNAME(dgemv)(char *trans, int* m, int* n, double* 
-			alpha, double* a, int* lda, double* x, int* incx,
-			double* beta, double* y, int* incy);
-extern int FNAME(dtrmv)(char *uplo, char *trans, char *diag, int* n,
-			double* a, int* lda, double* x, int* incx); 
-extern int FNAME(dtrsv)(char *uplo, char *trans, char *diag, int* n,
-			double* a, int* lda, double* x, int* incx); 
-extern int FNAME(dsymv)(char *uplo, int* n, double* alpha,
-			double* a, int* lda, double* x, int* incx, double
-			*beta, double* y, int* incy);
-extern int FNAME(dger)(int* m, int* n, double* alpha,
-		       double* x, int* incx, double* y, int* incy,
-		       double* a, int* lda);
-extern int FNAME(dsyr)(char *uplo, int* n, double* alpha,
-		       double* x, int* incx, double* a, int* lda); 
-extern int FNAME(dsyr2)(char *uplo, int* n, double* alpha,
-			double* x, int* incx, double* y, int* incy,
-			double* a, int* lda); 
-
-/* BLAS 3 */ 
-extern int FNAME(dgemm)(char *transa, char *transb, int* m, int* 
-			n, int* k, double* alpha, double* a, int* lda,
-			double* b, int* ldb, double* beta, double* c__,
-			int* ldc); 
-extern int FNAME(dsymm)(char *side, char *uplo, int* m, int* n,
-			double* alpha, double* a, int* lda, double* b,
-			int* ldb, double* beta, double* c__, int* ldc); 
-extern int FNAME(dtrmm)(char *side, char *uplo, char *transa, char *diag,
-			int* m, int* n, double* alpha, double* a, int* 
-			lda, double* b, int* ldb); 
-extern int FNAME(dtrsm)(char *side, char *uplo, char *transa, char *diag,
-			int* m, int* n, double* alpha, double* a, int* 
-			lda, double* b, int* ldb); 
-extern int FNAME(dsyrk)(char *uplo, char *trans, int* n, int* k,
-			double* alpha, double* a, int* lda, double* beta,
-			double* c__, int* ldc); 
-extern int FNAME(dsyr2k)(char *uplo, char *trans, int* n, int* k,
-			 double* alpha, double* a, int* lda, double* b,
-			 int* ldb, double* beta, double* c__, int* ldc); 
-
-
 /****** BLAS 1 ******/ 
 
 /* Compute the scalar product x^T y for the vectors x and y, returning the result in result.*/
@@ -97,7 +33,7 @@ double fff_blas_ddot (const fff_vector * x, const fff_vector * y)
   if ( n != y->size )
     return 1;  
  
-  return( FNAME(ddot)(&n, x->data, &incx, y->data, &incy) ); 
+  return( BLAS(ddot)(&n, x->data, &incx, y->data, &incy) ); 
 }
 
 /* Compute the Euclidean norm ||x||_2 = \sqrt {\sum x_i^2} of the vector x. */ 
@@ -106,7 +42,7 @@ double fff_blas_dnrm2 (const fff_vector * x)
   int n = (int) x->size; 
   int incx = (int) x->stride; 
 
-  return( FNAME(dnrm2)(&n, x->data, &incx) ); 
+  return( BLAS(dnrm2)(&n, x->data, &incx) ); 
 }
 
 /* Compute the absolute sum \sum |x_i| of the elements of the vector x.*/
@@ -115,7 +51,7 @@ double fff_blas_dasum (const fff_vector * x)
   int n = (int) x->size; 
   int incx = (int) x->stride; 
 
-  return( FNAME(dasum)(&n, x->data, &incx) ); 
+  return( BLAS(dasum)(&n, x->data, &incx) ); 
 }
 
 /* 
@@ -129,7 +65,7 @@ CBLAS_INDEX_t fff_blas_idamax (const fff_vector * x)
   int n = (int) x->size; 
   int incx = (int) x->stride; 
 
-  return( (CBLAS_INDEX_t)(FNAME(idamax)(&n, x->data, &incx) - 1) ); 
+  return( (CBLAS_INDEX_t)(BLAS(idamax)(&n, x->data, &incx) - 1) ); 
 }
 
 /* Exchange the elements of the vectors x and y.*/
@@ -142,7 +78,7 @@ int fff_blas_dswap (fff_vector * x, fff_vector * y)
   if ( n != y->size )
     return 1;  
   
-  return( FNAME(dswap)(&n, x->data, &incx, y->data, &incy) ); 
+  return( BLAS(dswap)(&n, x->data, &incx, y->data, &incy) ); 
 }
 
 /* Copy the elements of the vector x into the vector y */ 
@@ -155,7 +91,7 @@ int fff_blas_dcopy (const fff_vector * x, fff_vector * y)
   if ( n != y->size )
     return 1;  
   
-  return( FNAME(dcopy)(&n, x->data, &incx, y->data, &incy) ); 
+  return( BLAS(dcopy)(&n, x->data, &incx, y->data, &incy) ); 
 }
 
 /* Compute the sum y = \alpha x + y for the vectors x and y */ 
@@ -168,7 +104,7 @@ int fff_blas_daxpy (double alpha, const fff_vector * x, fff_vector * y)
   if ( n != y->size )
     return 1;  
   
-  return( FNAME(daxpy)(&n, &alpha, x->data, &incx, y->data, &incy) ); 
+  return( BLAS(daxpy)(&n, &alpha, x->data, &incx, y->data, &incy) ); 
 }
 
 /* Rescale the vector x by the multiplicative factor alpha. */ 
@@ -177,7 +113,7 @@ int fff_blas_dscal (double alpha, fff_vector * x)
   int n = (int) x->size; 
   int incx = (int) x->stride; 
   
-  return( FNAME(dscal)(&n, &alpha, x->data, &incx) ); 
+  return( BLAS(dscal)(&n, &alpha, x->data, &incx) ); 
 }
 
 
@@ -189,7 +125,7 @@ int fff_blas_dscal (double alpha, fff_vector * x)
 	  The variables a and b are overwritten by the routine. */
 int fff_blas_drotg (double a[], double b[], double c[], double s[])
 {
-  return( FNAME(drotg)(a, b, c, s) );
+  return( BLAS(drotg)(a, b, c, s) );
 } 
 
 /* Apply a Givens rotation (x', y') = (c x + s y, -s x + c y) to the vectors x, y.*/
@@ -202,7 +138,7 @@ int fff_blas_drot (fff_vector * x, fff_vector * y, double c, double s)
   if ( n != y->size )
     return 1;  
   
-  return( FNAME(drot)(&n, x->data, &incx, y->data, &incy, &c, &s) ); 
+  return( BLAS(drot)(&n, x->data, &incx, y->data, &incy, &c, &s) ); 
 }
 
 /* Compute a modified Givens transformation. The modified Givens
@@ -210,7 +146,7 @@ int fff_blas_drot (fff_vector * x, fff_vector * y, double c, double s)
    specification. */
 int fff_blas_drotmg (double d1[], double d2[], double b1[], double b2, double P[])
 {
-  return( FNAME(drotmg)(d1, d2, b1, &b2, P) ); 
+  return( BLAS(drotmg)(d1, d2, b1, &b2, P) ); 
 }
 
     
@@ -224,7 +160,7 @@ int fff_blas_drotm (fff_vector * x, fff_vector * y, const double P[])
   if ( n != y->size )
     return 1;  
   
-  return( FNAME(drotm)(&n, x->data, &incx, y->data, &incy, (double*)P) ); 
+  return( BLAS(drotm)(&n, x->data, &incx, y->data, &incy, (double*)P) ); 
 }
 
 
@@ -244,7 +180,7 @@ int fff_blas_dgemv (CBLAS_TRANSPOSE_t TransA, double alpha,
   int n = (int) A->size1; 
   int lda = (int) A->tda; 
 
-  return( FNAME(dgemv)(trans, &m, &n, 
+  return( BLAS(dgemv)(trans, &m, &n, 
 		       &alpha, 
 		       A->data, &lda, 
 		       x->data, &incx, 
@@ -271,7 +207,7 @@ int fff_blas_dtrmv (CBLAS_UPLO_t Uplo, CBLAS_TRANSPOSE_t TransA, CBLAS_DIAG_t Di
   int n = (int) A->size1; 
   int lda = (int) A->tda; 
 
-  return( FNAME(dtrmv)(uplo, trans, diag, &n, 
+  return( BLAS(dtrmv)(uplo, trans, diag, &n, 
 		       A->data, &lda,
 		       x->data, &incx) ); 
 
@@ -295,7 +231,7 @@ int fff_blas_dtrsv (CBLAS_UPLO_t Uplo, CBLAS_TRANSPOSE_t TransA, CBLAS_DIAG_t Di
   int n = (int) A->size1; 
   int lda = (int) A->tda; 
 
-  return( FNAME(dtrsv)(uplo, trans, diag, &n, 
+  return( BLAS(dtrsv)(uplo, trans, diag, &n, 
 		       A->data, &lda, 
 		       x->data, &incx) ); 
 }
@@ -318,7 +254,7 @@ int fff_blas_dsymv (CBLAS_UPLO_t Uplo,
   int n = (int) A->size1; 
   int lda = (int) A->tda; 
 
-  return( FNAME(dsymv)(uplo, &n, 
+  return( BLAS(dsymv)(uplo, &n, 
 		       &alpha, 
 		       A->data, &lda, 
 		       x->data, &incx, 
@@ -335,7 +271,7 @@ int fff_blas_dger (double alpha, const fff_vector * x, const fff_vector * y, fff
   int n = (int) A->size1; 
   int lda = (int) A->tda; 
  
-  return( FNAME(dger)(&m, &n, 
+  return( BLAS(dger)(&m, &n, 
 		      &alpha, 
 		      y->data, &incy, 
 		      x->data, &incx, 
@@ -356,7 +292,7 @@ int fff_blas_dsyr (CBLAS_UPLO_t Uplo, double alpha, const fff_vector * x, fff_ma
   int n = (int) A->size1; 
   int lda = (int) A->tda; 
 
-  return( FNAME(dsyr)(uplo, &n, 
+  return( BLAS(dsyr)(uplo, &n, 
 		      &alpha, 
 		      x->data, &incx, 
 		      A->data, &lda ) ); 
@@ -379,7 +315,7 @@ int fff_blas_dsyr2 (CBLAS_UPLO_t Uplo, double alpha,
   int n = (int) A->size1; 
   int lda = (int) A->tda; 
 
-  return( FNAME(dsyr2)(uplo, &n, 
+  return( BLAS(dsyr2)(uplo, &n, 
 		       &alpha, 
 		       y->data, &incy, 
 		       x->data, &incx, 
@@ -416,7 +352,7 @@ int fff_blas_dgemm (CBLAS_TRANSPOSE_t TransA, CBLAS_TRANSPOSE_t TransB,
   int ldc = (int) C->tda;
   int k = (TransB == CblasNoTrans) ? (int)B->size1 : (int)B->size2;
 
-  return( FNAME(dgemm)(transb, transa, &m, &n, &k, &alpha, 
+  return( BLAS(dgemm)(transb, transa, &m, &n, &k, &alpha, 
 		       B->data, &ldb, 
 		       A->data, &lda, 
 		       &beta, 
@@ -441,7 +377,7 @@ int fff_blas_dsymm (CBLAS_SIDE_t Side, CBLAS_UPLO_t Uplo,
   int ldb = (int) B->tda; 
   int ldc = (int) C->tda; 
 
-  return ( FNAME(dsymm)(side, uplo, &m, &n,
+  return ( BLAS(dsymm)(side, uplo, &m, &n,
 			&alpha, 
 			A->data, &lda, 
 			B->data, &ldb,
@@ -472,7 +408,7 @@ int fff_blas_dtrmm (CBLAS_SIDE_t Side, CBLAS_UPLO_t Uplo, CBLAS_TRANSPOSE_t Tran
   int ldb = (int) B->tda; 
 
   
-  return( FNAME(dtrmm)(side, uplo, transa, diag, &m, &n,
+  return( BLAS(dtrmm)(side, uplo, transa, diag, &m, &n,
 		       &alpha, 
 		       A->data, &lda, 
 		       B->data, &ldb) ); 
@@ -502,7 +438,7 @@ int fff_blas_dtrsm (CBLAS_SIDE_t Side, CBLAS_UPLO_t Uplo, CBLAS_TRANSPOSE_t Tran
   int lda = (int) A->tda; 
   int ldb = (int) B->tda; 
 
-  return( FNAME(dtrsm)(side, uplo, transa, diag, &m, &n, 
+  return( BLAS(dtrsm)(side, uplo, transa, diag, &m, &n, 
 		       &alpha, 
 		       A->data, &lda, 
 		       B->data, &ldb) ); 
@@ -527,7 +463,7 @@ int fff_blas_dsyrk (CBLAS_UPLO_t Uplo, CBLAS_TRANSPOSE_t Trans,
   int lda = (int) A->tda; 
   int ldc = (int) C->tda; 
   
-  return( FNAME(dsyrk)(uplo, trans, &n, &k,
+  return( BLAS(dsyrk)(uplo, trans, &n, &k,
 		       &alpha, 
 		       A->data, &lda, 
 		       &beta,
@@ -554,7 +490,7 @@ int fff_blas_dsyr2k (CBLAS_UPLO_t Uplo, CBLAS_TRANSPOSE_t Trans,
   int ldb = (int) B->tda; 
   int ldc = (int) C->tda; 
  
-  return( FNAME(dsyr2k)(uplo, trans, &n, &k, 
+  return( BLAS(dsyr2k)(uplo, trans, &n, &k, 
 			&alpha, 
 			B->data, &ldb, 
 			A->data, &lda, 
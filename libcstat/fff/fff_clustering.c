@@ -1,17 +1,30 @@
 #include "fff_clustering.h"
 #include "fff_blas.h"
 #include <randomkit.h>
+#include <rk_counter.h>
 #include "fff_routines.h"
+#include "fff_threads.h"
 
 #include <stdlib.h>
 #include <math.h>
 #include <stdio.h>
+#include <errno.h>
+
+/* Number of points whose distances to the centers are computed by
+   one matrix product */
+#define CM_BLOCK 256
 
 
 
 static void _fff_CM_init( fff_matrix* Centers, const fff_matrix* X);
 static double _fff_CM_functional(const fff_matrix* X, const fff_matrix* Centers, const fff_array *Label);
 static void _fff_Mstep ( fff_array *Label, const fff_matrix* X, const fff_matrix* Centers);
+static void _fff_CM_norms(double* xx, const fff_matrix* X);
+static void _fff_CM_sqdist(fff_matrix* D, const fff_matrix* Xb, const double* xx, 
+			   const fff_matrix* Centers, const double* cc);
+static void _fff_CM_assign(fff_array *Label, double* u, double* lb, const fff_matrix* X, 
+			   const long* idx, long n, const fff_matrix* Centers, const double* cc, 
+			   fff_matrix* Xb, fff_matrix* D);
 
 
 static void _fff_FCM_init(fff_matrix* U);
@@ -23,55 +36,124 @@ static void _fff_fuzzy_Estep(fff_matrix* Centers, const fff_matrix* X, const fff
 /**********************************************************************
 ********************* Ward's clustering ******************************
 **********************************************************************/
-static int _fff_matrix_sym_get_min(long* i, long* j, double *v, const fff_matrix *M);
 double _inertia(const int i,const int j, const fff_matrix* M1, const fff_matrix *M2, const long *count);
-
-static int _fff_matrix_sym_get_min(long* i, long* j, double* v, const fff_matrix *M)
-{
-  /* return the coordinates and value of the matrix min */
-  /* optimized through symmetry */
-  long k,l,n =M->size1;
-  v[0] = fff_matrix_get(M,0,0);
-  i[0] = 0;
-  j[0] = 0;
-  for (k=0; k<n ; k++)
-	for (l=0 ; l<k ; l++)
-	  if (fff_matrix_get(M,k,l)<v[0]){
-		v[0] = fff_matrix_get(M,k,l);
-		i[0] = k;
-		j[0]= l;
-	  }
-  return 0;
-}
+static void _fff_ward_nearest(long* nn, double* nnd, long i, const long* alive, 
+			      const fff_matrix* M1, const fff_matrix *M2, const long *count);
 
 double _inertia(const int i,const int j, const fff_matrix* M1, const fff_matrix *M2, const long *count)
 {
   long card,k,p=M1->size2;
   double u,w,v = 0;
+  double *m1i = M1->data + i*M1->tda, *m1j = M1->data + j*M1->tda; 
+  double *m2i = M2->data + i*M2->tda, *m2j = M2->data + j*M2->tda; 
   
   card = count[i] +count[j]; 
   for (k=0 ; k<p ; k++){
-	w = fff_matrix_get(M1,i,k) + fff_matrix_get(M1,j,k);
+	w = m1i[k] + m1j[k];
 	w /= card;
-	u = fff_matrix_get(M2,i,k) + fff_matrix_get(M2,j,k);
+	u = m2i[k] + m2j[k];
 	u /= card;
 	v += (u-w*w);
   }
   return v;
 }
 
+/* nearest neighbour of cluster i among the alive clusters j<i,
+   the first one in case of ties; nn[i] = -1 if there is none */
+static void _fff_ward_nearest(long* nn, double* nnd, long i, const long* alive, 
+			      const fff_matrix* M1, const fff_matrix *M2, const long *count)
+{
+  long j;
+  double var;
+
+  nn[i] = -1;
+  nnd[i] = FFF_POSINF;
+  for (j=0 ; j<i ; j++)
+	if (alive[j]){
+	  var = _inertia(i,j,M1,M2,count);
+	  if ((nn[i] < 0) || (var < nnd[i])){
+		nn[i] = j;
+		nnd[i] = var;
+	  }
+	}
+}
+
+/* Buffers of Ward's algorithm for n items of dimension up to p, so
+   that repeated runs (e.g. bootstrap replicates) allocate them once */
+typedef struct{
+  fff_matrix* M1;
+  fff_matrix* M2;
+  long* count;
+  long* alive;
+  long* node;
+  long* nn;
+  double* nnd;
+} _fff_ward_work;
 
+static _fff_ward_work* _fff_ward_work_new(long n, long p);
+static void _fff_ward_work_delete(_fff_ward_work* W);
+static void _fff_ward(fff_array* parent, fff_vector *cost, const fff_matrix* X, _fff_ward_work* W);
+
+static _fff_ward_work* _fff_ward_work_new(long n, long p)
+{
+  _fff_ward_work* W = (_fff_ward_work*) calloc(1, sizeof(_fff_ward_work));
+  W->M1 = fff_matrix_new(n,p);
+  W->M2 = fff_matrix_new(n,p);
+  W->count = (long*) calloc(n, sizeof(long));
+  W->alive = (long*) calloc(n, sizeof(long));
+  W->node = (long*) calloc(n, sizeof(long));
+  W->nn = (long*) calloc(n, sizeof(long));
+  W->nnd = (double*) calloc(n, sizeof(double));
+  return W;
+}
+
+static void _fff_ward_work_delete(_fff_ward_work* W)
+{
+  fff_matrix_delete(W->M1);
+  fff_matrix_delete(W->M2);
+  free(W->count);
+  free(W->alive);
+  free(W->node);
+  free(W->nn);
+  free(W->nnd);
+  free(W);
+}
+
+/*
+  The inertia (variance of the union) of two clusters can decrease
+  when they grow, so that nearest-neighbour chains would not yield the
+  same tree as merging the closest pair at each step. Instead, the
+  nearest neighbour of each cluster among those of lower index is
+  kept, see Mullner, "Modern hierarchical, agglomerative clustering
+  algorithms", 2011. After a merge, only the clusters whose nearest
+  neighbour is involved are searched again. This yields the same
+  merges as scanning the lower half of the n*n inertia matrix, in
+  O(n) memory and typically O(n^2) evaluations of the inertia.
+*/
 int fff_clustering_ward(fff_array* parent,fff_vector *cost, const fff_matrix* X)
 { 
-  long i,j,k,l,k0,l0,n = X->size1, p=X->size2;
-  fff_matrix * Inertia = fff_matrix_new(n,n); 
+  _fff_ward_work* W = _fff_ward_work_new(X->size1, X->size2);
+
+  _fff_ward(parent, cost, X, W);
+  _fff_ward_work_delete(W);
+  return 0;
+}
+
+static void _fff_ward(fff_array* parent, fff_vector *cost, const fff_matrix* X, _fff_ward_work* W)
+{ 
+  long i,j,k,l,n = X->size1, p=X->size2;
   double lx, var;
   long q,lc;
-  fff_matrix * M1 = fff_matrix_new(n,p);
-  fff_matrix * M2 = fff_matrix_new(n,p);
-  double linf;
-  long * count = (long*) calloc(n, sizeof(long));
-
+  /* the work matrices may be wider than X */
+  fff_matrix M1buf = fff_matrix_block(W->M1, 0, n, 0, p);
+  fff_matrix M2buf = fff_matrix_block(W->M2, 0, n, 0, p);
+  fff_matrix * M1 = &M1buf;
+  fff_matrix * M2 = &M2buf;
+  long * count = W->count;
+  long * alive = W->alive;
+  long * node = W->node;
+  long * nn = W->nn;
+  double * nnd = W->nnd;
   
   /* M1 and M2 represent the cluster-wise sum and sum of square values*/
   for (i=0 ; i<n ; i++){
@@ -81,20 +163,15 @@ int fff_clustering_ward(fff_array* parent,fff_vector *cost, const fff_matrix* X)
 	  fff_matrix_set(M2,i,j,lx*lx);
 	}
   }
-  linf = fff_matrix_sum(M2)+1.0;
-  
-  /* init count*/
-  for (i=0 ; i<n ; i++) count[i]=1;
   
-  /* compute the inertia matrix*/
-  fff_matrix_set_all(Inertia,linf);
+  /* init count, the tree node held by each slot and the nearest neighbours*/
   for (i=0 ; i<n ; i++){
-	for (j=0 ; j<i; j++){
-	  var = _inertia(i,j,M1, M2, count);
-	  fff_matrix_set(Inertia,i,j,var);
-	  fff_matrix_set(Inertia,j,i,var);
-	}
+	count[i] = 1;
+	alive[i] = 1;
+	node[i] = i;
   }
+  for (i=0 ; i<n ; i++)
+	_fff_ward_nearest(nn, nnd, i, alive, M1, M2, count);
   
   /* init parent */
   q = 2*n-1;
@@ -104,55 +181,437 @@ int fff_clustering_ward(fff_array* parent,fff_vector *cost, const fff_matrix* X)
   for (i=0; i<n-1 ; i++){
 	q = i+n;
 	
-	/* detect the merge */
-	_fff_matrix_sym_get_min(&k, &l, &var, Inertia);
-	/* since parents are quatters, the actual identity of k and l has to be found */
-	k0 = k;
-	l0 = l;
-	while (fff_array_get1d(parent,k)!=k)
-	  k = fff_array_get1d(parent,k);
-	while (fff_array_get1d(parent,l)!=l)
-	  l = fff_array_get1d(parent,l);
+	/* detect the merge: the first closest pair (k,l), l<k */
+	k = -1;
+	for (j=0 ; j<n ; j++)
+	  if ((alive[j]) && (nn[j] >= 0))
+		if ((k < 0) || (nnd[j] < nnd[k]))
+		  k = j;
+	l = nn[k];
+	var = nnd[k];
 
 	/* perform the merge */
-	/* count,clist,parent,cost */
+	/* count,parent,cost */
 	fff_vector_set(cost,q,var);
-	fff_array_set1d(parent,k,q);
-	fff_array_set1d(parent,l,q);
+	fff_array_set1d(parent,node[k],q);
+	fff_array_set1d(parent,node[l],q);
+	node[k] = q;
 	
 	/* update the counts */
-	lc = count[k0]+count[l0];
-	count[k0] = lc;
+	lc = count[k]+count[l];
+	count[k] = lc;
 
 	/* update the moments */
-	/* to save space, q squattes  the place of k */
+	/* q squattes  the place of k */
 	/* the place of  l is abandoned */
 	for (j =0 ; j<p; j++){
-	  lx = fff_matrix_get(M1,k0,j) + fff_matrix_get(M1,l0,j); 
-	  fff_matrix_set(M1,k0,j,lx);
-	  var = fff_matrix_get(M2,k0,j) + fff_matrix_get(M2,l0,j);
-	  fff_matrix_set(M2,k0,j,var);
+	  lx = fff_matrix_get(M1,k,j) + fff_matrix_get(M1,l,j); 
+	  fff_matrix_set(M1,k,j,lx);
+	  var = fff_matrix_get(M2,k,j) + fff_matrix_get(M2,l,j);
+	  fff_matrix_set(M2,k,j,var);
 	}
+	alive[l] = 0;
 	
-	/* update the inertia */
-	for (j=0 ; j<n ; j++){
-	  fff_matrix_set(Inertia,l0,j,linf);
-	  fff_matrix_set(Inertia,j,l0,linf);
-	}
-	for (j=0 ; j<n ; j++)
-	  if (fff_matrix_get(Inertia,k0,j)<linf){
-		var = _inertia(k0,j,M1, M2, count);
-		fff_matrix_set(Inertia,k0,j,var);
-		fff_matrix_set(Inertia,j,k0,var);
+	/* update the nearest neighbours */
+	_fff_ward_nearest(nn, nnd, k, alive, M1, M2, count);
+	for (j=l+1 ; j<n ; j++){
+	  if ((!alive[j]) || (j == k))
+		continue;
+	  if ((nn[j] == l) || (nn[j] == k))
+		_fff_ward_nearest(nn, nnd, j, alive, M1, M2, count);
+	  else if (j > k){
+		var = _inertia(j,k,M1,M2,count);
+		if ((var < nnd[j]) || ((var == nnd[j]) && (k < nn[j]))){
+		  nn[j] = k;
+		  nnd[j] = var;
+		}
 	  }
+	}
   }
-  
-  /* delete: count,Inertia,M1,M2 */
+}
+
+
+/* A candidate merge along a graph edge, between the clusters held
+   by slots a and b, valid as long as their versions are unchanged */
+typedef struct{
+  double cost;
+  long rank;
+  long a;
+  long b;
+  long va;
+  long vb;
+} _fff_ward_edge;
+
+/* Binary min-heap of candidate merges, ordered by cost and rank */
+typedef struct{
+  _fff_ward_edge* e;
+  long size;
+  long capacity;
+  long rank;
+} _fff_ward_heap;
+
+static int _fff_ward_edge_less(const _fff_ward_edge* e, const _fff_ward_edge* f);
+static void _fff_ward_heap_push(_fff_ward_heap* H, double cost, long a, long b, const long* version);
+static void _fff_ward_heap_pop(_fff_ward_edge* top, _fff_ward_heap* H);
+static void _fff_ward_adj_add(long** adj, long* size, long* capacity, long i, long j);
+static long _fff_ward_find(long* slot, long i);
+
+static int _fff_ward_edge_less(const _fff_ward_edge* e, const _fff_ward_edge* f)
+{
+  if (e->cost < f->cost) return 1;
+  if (e->cost > f->cost) return 0;
+  return (e->rank < f->rank);
+}
+
+static void _fff_ward_heap_push(_fff_ward_heap* H, double cost, long a, long b, const long* version)
+{
+  long i, j;
+  _fff_ward_edge e;
+
+  if (H->size == H->capacity){
+	H->capacity = 2*H->capacity+1;
+	H->e = (_fff_ward_edge*) realloc(H->e, H->capacity*sizeof(_fff_ward_edge));
+  }
+  e.cost = cost;
+  e.rank = H->rank++;
+  e.a = a;
+  e.b = b;
+  e.va = version[a];
+  e.vb = version[b];
+
+  /* sift up */
+  for (i=H->size++ ; i>0 ; i=j){
+	j = (i-1)/2;
+	if (!_fff_ward_edge_less(&e, H->e+j))
+	  break;
+	H->e[i] = H->e[j];
+  }
+  H->e[i] = e;
+}
+
+static void _fff_ward_heap_pop(_fff_ward_edge* top, _fff_ward_heap* H)
+{
+  long i, j;
+  _fff_ward_edge e;
+
+  *top = H->e[0];
+  e = H->e[--H->size];
+
+  /* sift down */
+  for (i=0 ; (j=2*i+1)<H->size ; i=j){
+	if ((j+1 < H->size) && _fff_ward_edge_less(H->e+j+1, H->e+j))
+	  j++;
+	if (!_fff_ward_edge_less(H->e+j, &e))
+	  break;
+	H->e[i] = H->e[j];
+  }
+  H->e[i] = e;
+}
+
+/* append j to the adjacency list of slot i */
+static void _fff_ward_adj_add(long** adj, long* size, long* capacity, long i, long j)
+{
+  if (size[i] == capacity[i]){
+	capacity[i] = 2*capacity[i]+4;
+	adj[i] = (long*) realloc(adj[i], capacity[i]*sizeof(long));
+  }
+  adj[i][size[i]++] = j;
+}
+
+/* slot of the cluster containing slot i, with path halving */
+static long _fff_ward_find(long* slot, long i)
+{
+  while (slot[i] != i){
+	slot[i] = slot[slot[i]];
+	i = slot[i];
+  }
+  return i;
+}
+
+/*
+  Candidate merges are kept in a heap keyed on the graph edges, where
+  entries become stale when one of their clusters changes (lazy
+  deletion). When l is merged into k, the adjacency list of k becomes
+  the union of both lists, in which merged slots are resolved with a
+  union-find structure, and the merges of k with its neighbours are
+  pushed.
+*/
+long fff_clustering_ward_graph(fff_array* parent, fff_vector *cost, const fff_graph* G, const fff_matrix* X)
+{
+  long i,j,k,l,c,e,n = X->size1, p=X->size2, nmerge = 0;
+  long q,nadj;
+  double lx, var;
+  _fff_ward_heap H;
+  _fff_ward_edge top;
+  fff_matrix * M1 = fff_matrix_new(n,p);
+  fff_matrix * M2 = fff_matrix_new(n,p);
+  long * count = (long*) calloc(n, sizeof(long));
+  long * version = (long*) calloc(n, sizeof(long));
+  long * slot = (long*) calloc(n, sizeof(long));
+  long * node = (long*) calloc(n, sizeof(long));
+  long * mark = (long*) calloc(n, sizeof(long));
+  long ** adj = (long**) calloc(n, sizeof(long*));
+  long * size = (long*) calloc(n, sizeof(long));
+  long * capacity = (long*) calloc(n, sizeof(long));
+  long * tmp = NULL;
+
+  /* M1 and M2 represent the cluster-wise sum and sum of square values*/
+  for (i=0 ; i<n ; i++){
+	for (j=0 ; j<p; j++){
+	  lx = fff_matrix_get(X,i,j);
+	  fff_matrix_set(M1,i,j,lx);
+	  fff_matrix_set(M2,i,j,lx*lx);
+	}
+	count[i] = 1;
+	slot[i] = i;
+	node[i] = i;
+	mark[i] = -1;
+  }
+
+  /* init parent */
+  q = 2*n-1;
+  for (i=0 ; i<q; i++) fff_array_set1d(parent,i,i);
+
+  /* adjacency lists and initial candidate merges */
+  H.e = NULL;
+  H.size = 0;
+  H.capacity = 0;
+  H.rank = 0;
+  for (e=0 ; e<G->E ; e++){
+	i = G->eA[e];
+	j = G->eB[e];
+	if (i == j) continue;
+	_fff_ward_adj_add(adj, size, capacity, i, j);
+	_fff_ward_adj_add(adj, size, capacity, j, i);
+	_fff_ward_heap_push(&H, _inertia(i,j,M1,M2,count), i, j, version);
+  }
+
+  /* recursive merge loop */
+  while (H.size > 0){
+	_fff_ward_heap_pop(&top, &H);
+	k = top.a;
+	l = top.b;
+	if ((slot[k] != k) || (slot[l] != l) || (version[k] != top.va) || (version[l] != top.vb))
+	  continue;
+	
+	/* perform the merge, l is merged into k */
+	q = n + nmerge++;
+	fff_vector_set(cost,q,top.cost);
+	fff_array_set1d(parent,node[k],q);
+	fff_array_set1d(parent,node[l],q);
+	node[k] = q;
+	slot[l] = k;
+	version[k] ++;
+	count[k] += count[l];
+	for (j =0 ; j<p; j++){
+	  lx = fff_matrix_get(M1,k,j) + fff_matrix_get(M1,l,j); 
+	  fff_matrix_set(M1,k,j,lx);
+	  var = fff_matrix_get(M2,k,j) + fff_matrix_get(M2,l,j);
+	  fff_matrix_set(M2,k,j,var);
+	}
+
+	/* merge the adjacency lists, without duplicates */
+	tmp = (long*) realloc(tmp, (size[k]+size[l])*sizeof(long));
+	nadj = 0;
+	mark[k] = q;
+	for (i=0 ; i<size[k]+size[l] ; i++){
+	  c = (i<size[k]) ? adj[k][i] : adj[l][i-size[k]];
+	  c = _fff_ward_find(slot, c);
+	  if (mark[c] == q) continue;
+	  mark[c] = q;
+	  tmp[nadj++] = c;
+	}
+	size[k] = 0;
+	for (i=0 ; i<nadj ; i++){
+	  _fff_ward_adj_add(adj, size, capacity, k, tmp[i]);
+	  _fff_ward_heap_push(&H, _inertia(k,tmp[i],M1,M2,count), k, tmp[i], version);
+	}
+	free(adj[l]);
+	adj[l] = NULL;
+	size[l] = 0;
+	capacity[l] = 0;
+  }
+
+  /* delete */
+  for (i=0 ; i<n ; i++) free(adj[i]);
+  free(adj);
+  free(size);
+  free(capacity);
+  free(tmp);
+  free(H.e);
   fff_matrix_delete(M1);
   fff_matrix_delete(M2);
-  fff_matrix_delete(Inertia);
   free(count);
-  return 0;
+  free(version);
+  free(slot);
+  free(node);
+  free(mark);
+  return nmerge;
+}
+
+
+/* Bootstrap of Ward's clustering, shared by the workers */
+typedef struct{
+  const fff_matrix* X;
+  const long* child;
+  const long* size_ref;
+  const long* sizes;
+  long nsizes;
+  long niter;
+  long pmax;
+  unsigned long seed;
+  fff_matrix** hits;
+} _fff_ward_bootstrap_job;
+
+static void _fff_ward_bootstrap_job_run(int rank, int nthreads, void* params);
+
+/*
+  Each worker owns its replicate, tree and hit buffers. Replicate
+  t=j*niter+r draws its columns from the counter-based generator with
+  counter (j,r,c), so that the result does not depend on the number
+  of threads.
+*/
+static void _fff_ward_bootstrap_job_run(int rank, int nthreads, void* params)
+{
+  _fff_ward_bootstrap_job* job = (_fff_ward_bootstrap_job*)params; 
+  const fff_matrix* X = job->X;
+  long n = X->size1, d = X->size2, q, t, i, j, r, c, p, a, b, col;
+  fff_matrix* Xr = fff_matrix_new(n, job->pmax);
+  fff_matrix Xb;
+  _fff_ward_work* W = _fff_ward_work_new(n, job->pmax);
+  fff_array* P = fff_array_new1d(FFF_LONG, 2*n-1);
+  fff_vector* C = fff_vector_new(2*n-1);
+  long* par = (long*) calloc(2*n-1, sizeof(long));
+  long* size = (long*) calloc(2*n-1, sizeof(long));
+  long* lca = (long*) calloc(n-1, sizeof(long));
+  fff_matrix* hits = job->hits[rank];
+
+  for (t=rank ; t<job->nsizes*job->niter ; t+=nthreads){
+	j = t/job->niter;
+	r = t%job->niter;
+	p = job->sizes[j];
+
+	/* resample the columns */
+	Xb = fff_matrix_block(Xr, 0, n, 0, p);
+	for (c=0 ; c<p ; c++){
+	  col = (long)(d*rk_counter_double(job->seed, j, r, c));
+	  for (i=0 ; i<n ; i++)
+		fff_matrix_set(&Xb, i, c, fff_matrix_get(X, i, col));
+	}
+	_fff_ward(P, C, &Xb, W);
+
+	/* subtree sizes, parents having higher indices than their children */
+	for (i=0 ; i<2*n-1 ; i++){
+	  par[i] = (long) fff_array_get1d(P, i);
+	  size[i] = (i<n);
+	}
+	for (i=0 ; i<2*n-2 ; i++)
+	  size[par[i]] += size[i];
+
+	/* a reference subtree is found if the lowest common ancestor of
+	   its leaves in the replicate tree has as many leaves */
+	for (q=0 ; q<n-1 ; q++){
+	  a = job->child[2*q];
+	  b = job->child[2*q+1];
+	  a = (a<n) ? a : lca[a-n];
+	  b = (b<n) ? b : lca[b-n];
+	  while (a != b){
+		if (a < b) a = par[a];
+		else b = par[b];
+	  }
+	  lca[q] = a;
+	  if (size[a] == job->size_ref[q])
+		hits->data[q*hits->tda+j] += 1;
+	}
+  }
+
+  fff_matrix_delete(Xr);
+  _fff_ward_work_delete(W);
+  fff_array_delete(P);
+  fff_vector_delete(C);
+  free(par);
+  free(size);
+  free(lca);
+}
+
+int fff_clustering_ward_bootstrap(fff_matrix* hits, const fff_array* parent, const fff_matrix* X, 
+				  const fff_array* sizes, const long niter, const unsigned long seed, int nthreads)
+{
+  _fff_ward_bootstrap_job job;
+  long n = X->size1, nsizes = sizes->dimX, i, j, q, pi;
+  long* child;
+  long* size_ref;
+  long* lsizes;
+  int t, status = 0;
+
+  fff_matrix_set_all(hits, 0);
+  if ((n < 2) || (niter < 1) || (nsizes < 1))
+	return 0;
+  if (((long)hits->size1 != n-1) || ((long)hits->size2 != nsizes)){
+	FFF_ERROR("hits should have shape (n-1, number of sizes)", EDOM);
+	return 1;
+  }
+
+  child = (long*) malloc(2*(n-1)*sizeof(long));
+  size_ref = (long*) calloc(n-1, sizeof(long));
+  lsizes = (long*) calloc(nsizes, sizeof(long));
+
+  /* children and sizes of the reference subtrees */
+  for (q=0 ; q<2*(n-1) ; q++)
+	child[q] = -1;
+  for (i=0 ; i<2*n-2 ; i++){
+	pi = (long) fff_array_get1d(parent, i);
+	if ((pi <= i) || (pi < n) || (pi > 2*n-2) || (child[2*(pi-n)+1] >= 0)){
+	  FFF_ERROR("parent does not define a binary tree with increasing indices", EDOM);
+	  status = 1;
+	  break;
+	}
+	if (child[2*(pi-n)] < 0) child[2*(pi-n)] = i;
+	else child[2*(pi-n)+1] = i;
+	size_ref[pi-n] += (i<n) ? 1 : size_ref[i-n];
+  }
+
+  job.pmax = 1;
+  for (j=0 ; j<nsizes ; j++){
+	lsizes[j] = (long) fff_array_get1d(sizes, j);
+	if (lsizes[j] < 0){
+	  FFF_ERROR("negative bootstrap size", EDOM);
+	  status = 1;
+	}
+	job.pmax = FFF_MAX(job.pmax, lsizes[j]);
+  }
+
+  if (status == 0){
+	nthreads = fff_threads_count(nthreads);
+	if (nthreads > nsizes*niter)
+	  nthreads = (int)(nsizes*niter);
+	
+	job.X = X;
+	job.child = child;
+	job.size_ref = size_ref;
+	job.sizes = lsizes;
+	job.nsizes = nsizes;
+	job.niter = niter;
+	job.seed = seed;
+	job.hits = (fff_matrix**) calloc(nthreads, sizeof(fff_matrix*));
+	for (t=0 ; t<nthreads ; t++){
+	  job.hits[t] = fff_matrix_new(n-1, nsizes);
+	  fff_matrix_set_all(job.hits[t], 0);
+	}
+
+	fff_parallel_run(nthreads, &_fff_ward_bootstrap_job_run, (void*)&job); 
+
+	for (t=0 ; t<nthreads ; t++){
+	  fff_matrix_add(hits, job.hits[t]);
+	  fff_matrix_delete(job.hits[t]);
+	}
+	free(job.hits);
+  }
+
+  free(child);
+  free(size_ref);
+  free(lsizes);
+  return status;
 }
 
 
@@ -169,11 +628,23 @@ double fff_clustering_cmeans( fff_matrix* Centers, fff_array *Label, const fff_m
   int fd = X->size2;      
   long k = Centers->size1;
   int i,j,l;
+  long n, N = X->size1, c, ntodo, cmax;
   double normdC,normC; 
-  double dx;
+  double dx, m, p1, p2;
   int verbose = 0;
+  double *bufx, *bufc;
   
   fff_matrix* Centers_old = fff_matrix_new(Centers->size1, Centers->size2);
+  fff_matrix* Centers_prev = fff_matrix_new(Centers->size1, Centers->size2);
+  fff_matrix* DC = fff_matrix_new(k, k);
+  fff_matrix* Xb = fff_matrix_new(CM_BLOCK, fd);
+  fff_matrix* D = fff_matrix_new(CM_BLOCK, k);
+  double* u = (double*) calloc(N, sizeof(double));
+  double* lb = (double*) calloc(N, sizeof(double));
+  long* todo = (long*) calloc(N, sizeof(long));
+  double* cc = (double*) calloc(k, sizeof(double));
+  double* s = (double*) calloc(k, sizeof(double));
+  double* p = (double*) calloc(k, sizeof(double));
   
   fff_matrix_set_all( Centers_old,0);
   
@@ -183,9 +654,68 @@ double fff_clustering_cmeans( fff_matrix* Centers, fff_array *Label, const fff_m
     _fff_CM_init(Centers,X);
   
   for (l=0; l<maxiter ; l++){
-    /* basic algorithm  */
-    _fff_Mstep(Label,X,Centers);
+    /* Hard memberships, see _fff_Mstep. Following Hamerly (2010),
+       u and lb are an upper bound on the distance of each point to
+       its center and a lower bound on its distance to the other
+       centers, and s is half the distance of each center to the
+       closest other one. Only the points for which these bounds do
+       not guarantee that the label is unchanged are searched again. */
+    _fff_CM_norms(cc, Centers);
+    if (l == 0)
+      _fff_CM_assign(Label, u, lb, X, NULL, N, Centers, cc, Xb, D);
+    else {
+      _fff_CM_sqdist(DC, Centers, cc, Centers, cc);
+      for (c=0 ; c<k ; c++){
+	s[c] = FFF_POSINF;
+	for (j=0 ; j<k ; j++)
+	  if ((j != c) && (fff_matrix_get(DC,c,j) < s[c]))
+	    s[c] = fff_matrix_get(DC,c,j);
+	s[c] = .5*sqrt(s[c]);
+      }
+      ntodo = 0;
+      for (n=0 ; n<N ; n++){
+	c = fff_array_get1d(Label,n);
+	m = FFF_MAX(s[c], lb[n]);
+	if (u[n] <= m)
+	  continue;
+	bufx = X->data + n*X->tda;
+	bufc = Centers->data + c*Centers->tda;
+	for (j=0, u[n]=0.0 ; j<fd ; j++)
+	  u[n] += FFF_SQR(bufx[j]-bufc[j]);
+	u[n] = sqrt(u[n]);
+	if (u[n] <= m)
+	  continue;
+	todo[ntodo++] = n;
+      }
+      _fff_CM_assign(Label, u, lb, X, todo, ntodo, Centers, cc, Xb, D);
+    }
+
+    fff_matrix_memcpy (Centers_prev, Centers);
     fff_Estep(Centers,Label,X); 
+
+    /* Center shifts and bound updates */
+    p1 = 0.0;
+    p2 = 0.0;
+    cmax = 0;
+    for (c=0 ; c<k ; c++){
+      bufx = Centers->data + c*Centers->tda;
+      bufc = Centers_prev->data + c*Centers_prev->tda;
+      for (j=0, p[c]=0.0 ; j<fd ; j++)
+	p[c] += FFF_SQR(bufx[j]-bufc[j]);
+      p[c] = sqrt(p[c]);
+      if (p[c] > p1){
+	p2 = p1;
+	p1 = p[c];
+	cmax = c;
+      }
+      else if (p[c] > p2)
+	p2 = p[c];
+    }
+    for (n=0 ; n<N ; n++){
+      c = fff_array_get1d(Label,n);
+      u[n] += p[c];
+      lb[n] -= (c == cmax) ? p2 : p1;
+    }
     
     J = _fff_CM_functional(X, Centers, Label);
     if (verbose)
@@ -209,6 +739,16 @@ double fff_clustering_cmeans( fff_matrix* Centers, fff_array *Label, const fff_m
   }  
   
   fff_matrix_delete(Centers_old);
+  fff_matrix_delete(Centers_prev);
+  fff_matrix_delete(DC);
+  fff_matrix_delete(Xb);
+  fff_matrix_delete(D);
+  free(u);
+  free(lb);
+  free(todo);
+  free(cc);
+  free(s);
+  free(p);
   
   return(J);
 }
@@ -267,39 +807,87 @@ static double _fff_CM_functional(const fff_matrix* X, const fff_matrix* Centers,
 /* Mstep of the CM algo: compute hard memberships */
 static void _fff_Mstep ( fff_array *Label, const fff_matrix* X, const fff_matrix* Centers)
 {
-   double dist,mindist;
-   double index;
-   int n1,n2;
-   int N = X->size1;
-   int T  = X->size2;
-   int C = Centers->size1;
-  
-   fff_vector *v1 = fff_vector_new(T);
-   fff_vector *v2 = fff_vector_new(T);
-   fff_array_set_all(Label,0);
-
-   for (n1=0 ; n1<N ; n1++){
-     fff_matrix_get_row (v1,X,n1);
-     fff_matrix_get_row (v2,Centers,0);
-     fff_vector_sub (v2, v1);
-	 fff_vector_mul(v2,v2);
-     mindist = fff_vector_sum(v2);
- 
-     index = 0;
-     for (n2=1 ; n2<C ; n2++){
-       fff_matrix_get_row (v2,Centers,n2);
-       fff_vector_sub (v2, v1);
-	   fff_vector_mul(v2,v2);
-       dist = fff_vector_sum(v2);
-       if (dist<mindist){
-	 mindist = dist;
-	 index = n2;
-       }
-     } 
-     fff_array_set1d(Label,n1,index);
-   }
-   fff_vector_delete(v1);
-   fff_vector_delete(v2);
+  fff_clustering_Voronoi(Label, Centers, X);
+}
+
+/* squared norms of the rows of X */
+static void _fff_CM_norms(double* xx, const fff_matrix* X)
+{
+  size_t i, j;
+  double *buf;
+
+  for (i=0 ; i<X->size1 ; i++){
+    buf = X->data + i*X->tda;
+    for (j=0, xx[i]=0.0 ; j<X->size2 ; j++)
+      xx[i] += FFF_SQR(buf[j]);
+  }
+}
+
+/* squared distances D(i,c) between the rows of Xb and the centers,
+   computed as |x|^2 - 2 x.c + |c|^2 with one matrix product; xx and
+   cc hold the squared norms of the rows of Xb and of the centers */
+static void _fff_CM_sqdist(fff_matrix* D, const fff_matrix* Xb, const double* xx, 
+			   const fff_matrix* Centers, const double* cc)
+{
+  size_t i, c;
+  double *buf;
+
+  fff_blas_dgemm(CblasNoTrans, CblasTrans, -2.0, Xb, Centers, 0.0, D);
+  for (i=0 ; i<D->size1 ; i++){
+    buf = D->data + i*D->tda;
+    for (c=0 ; c<D->size2 ; c++)
+      buf[c] = FFF_MAX(buf[c] + xx[i] + cc[c], 0.0);
+  }
+}
+
+/* Closest center of the rows idx[0..n-1] of X, or of its n first
+   rows if idx is NULL, by blocks of CM_BLOCK rows. If u and lb are not
+   NULL, the distances to the closest and second closest centers are
+   stored there. Xb and D are work matrices of sizes CM_BLOCK*X->size2
+   and CM_BLOCK*Centers->size1. */
+static void _fff_CM_assign(fff_array *Label, double* u, double* lb, const fff_matrix* X, 
+			   const long* idx, long n, const fff_matrix* Centers, const double* cc, 
+			   fff_matrix* Xb, fff_matrix* D)
+{
+  long i0, i, ii, c, nb, index, C = Centers->size1, T = X->size2;
+  double d1, d2, *buf;
+  double xx[CM_BLOCK];
+  fff_matrix xb, d;
+  fff_vector row;
+
+  for (i0=0 ; i0<n ; i0+=CM_BLOCK){
+    nb = FFF_MIN(CM_BLOCK, n-i0);
+    xb = fff_matrix_view(Xb->data, nb, T, Xb->tda);
+    d = fff_matrix_view(D->data, nb, C, D->tda);
+    for (i=0 ; i<nb ; i++){
+      ii = (idx == NULL) ? i0+i : idx[i0+i];
+      row = fff_matrix_row(&xb, i);
+      fff_matrix_get_row(&row, X, ii);
+    }
+    _fff_CM_norms(xx, &xb);
+    _fff_CM_sqdist(&d, &xb, xx, Centers, cc);
+
+    for (i=0 ; i<nb ; i++){
+      ii = (idx == NULL) ? i0+i : idx[i0+i];
+      buf = d.data + i*d.tda;
+      index = 0;
+      d1 = buf[0];
+      d2 = FFF_POSINF;
+      for (c=1 ; c<C ; c++)
+	if (buf[c] < d1){
+	  d2 = d1;
+	  d1 = buf[c];
+	  index = c;
+	}
+	else if (buf[c] < d2)
+	  d2 = buf[c];
+      fff_array_set1d(Label, ii, index);
+      if (u != NULL){
+	u[ii] = sqrt(d1);
+	lb[ii] = sqrt(d2);
+      }
+    }
+  }
 }
 
 /* E step of the CM algo: update the cluster centers */
@@ -341,37 +929,18 @@ extern void fff_Estep( fff_matrix* Centers, const fff_array *Label, const fff_ma
 /* Mstep of the CM algo: compute hard memberships ; quicker version */
 extern int fff_clustering_Voronoi ( fff_array *Label, const fff_matrix* Centers, const fff_matrix* X)
 {
-   double dx,dist,mindist;
-   double index;
-   int n1,n2,t;
-   int N = X->size1;
-   int T  = X->size2;
-   int C = Centers->size1;
-  
-   fff_array_set_all(Label,0);
-  
-   for (n1=0 ; n1<N ; n1++){
-     mindist = 0;
-     for ( t=0 ; t<T ; t++){
-       dx = fff_matrix_get(X,n1,t)-fff_matrix_get(Centers,0,t);
-       mindist += dx*dx;
-     }
-     index = 0;
-     for (n2=1; n2<C; n2++){
-       dist = 0;
-       for ( t=0 ; t<T ; t++){
-	 dx = fff_matrix_get(X,n1,t)-fff_matrix_get(Centers,n2,t);
-	 dist += dx*dx;
-	 if (dist>mindist) break;
-       }
-       if (dist<mindist){
-	 mindist = dist;
-	 index = (double)n2;
-       }
-     } 
-     fff_array_set1d(Label, n1, index);
-  }
-   return(0);
+  long C = Centers->size1;
+  double* cc = (double*) calloc(C, sizeof(double));
+  fff_matrix* Xb = fff_matrix_new(CM_BLOCK, X->size2);
+  fff_matrix* D = fff_matrix_new(CM_BLOCK, C);
+
+  _fff_CM_norms(cc, Centers);
+  _fff_CM_assign(Label, NULL, NULL, X, NULL, X->size1, Centers, cc, Xb, D);
+
+  fff_matrix_delete(Xb);
+  fff_matrix_delete(D);
+  free(cc);
+  return(0);
 }
 
 /**********************************************************************
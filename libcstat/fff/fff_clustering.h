@@ -98,10 +98,53 @@ extern "C" {
 	\param cost associated vector of merging cost
 	\param X input data to be clustered
 	
-	This version is pretty efficient
+	At each step, the two clusters whose union has the lowest
+	variance are merged. Nearest neighbours are cached, so that no
+	n*n matrix is stored and the run time is typically O(n^2).
    */
   extern int fff_clustering_ward(fff_array* parent, fff_vector *cost, const fff_matrix* X);
 
+  /*
+	\brief Connectivity-constrained Ward clustering algorithm
+	\param parent resulting tree-defining structure
+	\param cost associated vector of merging cost
+	\param G graph whose edges define the allowed merges
+	\param X input data to be clustered
+
+	Same as fff_clustering_ward, except that only clusters joined by
+	an edge of G (e.g. from fff_graph_grid_six) can be merged, the
+	lightest candidate being taken from a heap keyed on edges. Each
+	connected component of G ends up in a tree of its own, so that
+	only n-c merges are performed for c components; their number is
+	returned, and the nodes beyond are their own parents. parent and
+	cost are allocated with size 2n-1, as for fff_clustering_ward.
+   */
+  extern long fff_clustering_ward_graph(fff_array* parent, fff_vector *cost, const fff_graph* G, const fff_matrix* X);
+
+  /*
+	\brief Multi-scale bootstrap of Ward's clustering
+	\param hits (n-1)*m matrix of detection counts
+	\param parent reference tree of the data, as given by fff_clustering_ward
+	\param X input data, with shape (n,p)
+	\param sizes numbers of resampled columns, with size m
+	\param niter number of replicates per size
+	\param seed random seed
+	\param nthreads number of threads (0 for all processors)
+
+	For each size sizes[j], niter replicates of X are made of sizes[j]
+	columns drawn with replacement, and clustered with Ward's
+	algorithm. hits[q-n][j] counts the replicates whose tree contains
+	the reference subtree q, i.e. a node with the same leaves. The
+	replicates are spread over the threads, which reuse their
+	buffers; columns are drawn from counter-based random streams, so
+	that the result only depends on the seed. parent needs have
+	parent[i]>i for all nodes but the root, as in the output of
+	fff_clustering_ward. Returns 0, or 1 if the inputs are invalid.
+   */
+  extern int fff_clustering_ward_bootstrap(fff_matrix* hits, const fff_array* parent, const fff_matrix* X, 
+					   const fff_array* sizes, const long niter, const unsigned long seed, 
+					   int nthreads);
+
 
 #ifdef __cplusplus
 }
@@ -1,5 +1,6 @@
 #include "fff_cubic_spline.h"
 #include "fff_base.h"
+#include "fff_threads.h"
 
 #include <stdlib.h>
 
@@ -7,7 +8,9 @@
 #define CUBIC_SPLINE_MIRROR(x, n, p) \
   ( (x)<0.0 ? (-(x)) : ( (x)>(n) ? ((p)-(x)) : (x) ) )
 
-static void _fff_cubic_spline_transform( fff_vector* res, void* par ); 
+/* Number of lines filtered together by the tiled image transform */
+#define FFF_CUBIC_SPLINE_TILE 16
+
 
 static double _fff_cubic_spline_sample1d ( double x, double *coef, int dim, int stride );
 static double _fff_cubic_spline_sample2d ( double x, double y, double *imcoef, int dimX, int dimY, int offX, int offY );
@@ -42,16 +45,6 @@ double fff_cubic_spline_basis ( double x )
 }
 
 
-static void _fff_cubic_spline_transform( fff_vector* res, void* par ) 
-{
-  fff_vector *src = (fff_vector*)par; 
-  
-  fff_vector_memcpy( src, res );
-  fff_cubic_spline_transform ( res, src ); 
-
-  return; 
-}
-
 void fff_cubic_spline_transform ( fff_vector* res_vect, const fff_vector* src_vect )
 {
   int k, dim = src_vect->size; 
@@ -126,12 +119,191 @@ void fff_cubic_spline_transform ( fff_vector* res_vect, const fff_vector* src_ve
 }
 
 /*
-  work needs be allocated with at least the maximum dimension of "res" 
+  Tiled transform along one axis. Lines are processed in tiles of
+  FFF_CUBIC_SPLINE_TILE lines that are gathered into a contiguous
+  buffer with the line index varying fastest, so that the recursions
+  of the different lines are interleaved. Each line undergoes exactly
+  the same operations as in fff_cubic_spline_transform.
+*/
+typedef struct {
+  double* data;
+  int ndims;
+  const size_t* dims;
+  const size_t* strides;
+  int axis;
+  size_t nlines;
+  double* work;
+} _fff_cubic_spline_axis_job;
+
+
+/* Offset of the line-th line, lines being enumerated in C order */
+static size_t _fff_cubic_spline_line_offset( size_t line, int ndims, const size_t* dims,
+					    const size_t* strides, int axis )
+{
+  size_t offset = 0;
+  int a;
+
+  for ( a=ndims-1; a>=0; a-- ) {
+    if ( a == axis )
+      continue;
+    offset += ( line % dims[a] ) * strides[a];
+    line /= dims[a];
+  }
+
+  return offset;
+}
+
+static void _fff_cubic_spline_transform_tile( double* buf, size_t dim, size_t nl, size_t ldb )
+{
+  size_t k, l;
+  double cp[FFF_CUBIC_SPLINE_TILE], last[FFF_CUBIC_SPLINE_TILE];
+  double z1_k, a, *b;
+  const double z1 = -0.26794919243112; /* -2 + sqrt(3) */
+  const double cz1 = 0.28867513459481; /* z1/(z1^2-1) */
+
+  /* Initial values for the causal recursion, see
+     fff_cubic_spline_transform */
+  for ( l=0; l<nl; l++ )
+    cp[l] = buf[l];
+  z1_k = 1;
+  for ( k=1; k<dim; k++ ) {
+    z1_k = z1 * z1_k;
+    b = buf + k*ldb;
+    for ( l=0; l<nl; l++ )
+      cp[l] += b[l] * z1_k;
+  }
+  for ( k=2; k<dim; k++ ) {
+    z1_k = z1 * z1_k;
+    b = buf + (dim-k)*ldb;
+    for ( l=0; l<nl; l++ )
+      cp[l] += b[l] * z1_k;
+  }
+  z1_k = z1 * z1_k;
+  a = 1 - z1_k;
+  for ( l=0; l<nl; l++ ) {
+    cp[l] = cp[l] / a;
+    last[l] = buf[(dim-1)*ldb + l];
+    buf[l] = cp[l];
+  }
+
+  /* Causal recursion, overwriting the signal */
+  for ( k=1; k<dim; k++ ) {
+    b = buf + k*ldb;
+    for ( l=0; l<nl; l++ ) {
+      cp[l] = b[l] + z1 * cp[l];
+      b[l] = cp[l];
+    }
+  }
+
+  /* Anticausal recursion */
+  b = buf + (dim-1)*ldb;
+  for ( l=0; l<nl; l++ ) {
+    cp[l] = cz1 * ( 2.0 * cp[l] - last[l] );
+    b[l] = 6.0 * cp[l];
+  }
+  for ( k=dim-1; k>0; k-- ) {
+    b = buf + (k-1)*ldb;
+    for ( l=0; l<nl; l++ ) {
+      cp[l] = z1 * ( cp[l] - b[l] );
+      b[l] = 6.0 * cp[l];
+    }
+  }
+
+  return;
+}
+
+static void _fff_cubic_spline_axis_job_run( int rank, int nthreads, void* params )
+{
+  _fff_cubic_spline_axis_job* job = (_fff_cubic_spline_axis_job*)params;
+  size_t dim = job->dims[job->axis], stride = job->strides[job->axis];
+  size_t ntiles = ( job->nlines + FFF_CUBIC_SPLINE_TILE - 1 ) / FFF_CUBIC_SPLINE_TILE;
+  size_t t0, t1, t, k, l, l0, nl;
+  size_t offsets[FFF_CUBIC_SPLINE_TILE];
+  double *buf = job->work + rank*dim*FFF_CUBIC_SPLINE_TILE, *b, *p;
+
+  fff_parallel_range( ntiles, rank, nthreads, &t0, &t1 );
+
+  for ( t=t0; t<t1; t++ ) {
+    l0 = t*FFF_CUBIC_SPLINE_TILE;
+    nl = FFF_MIN( FFF_CUBIC_SPLINE_TILE, job->nlines-l0 );
+    for ( l=0; l<nl; l++ )
+      offsets[l] = _fff_cubic_spline_line_offset( l0+l, job->ndims, job->dims, job->strides, job->axis );
+
+    /* Gather */
+    for ( k=0, b=buf; k<dim; k++, b+=FFF_CUBIC_SPLINE_TILE ) {
+      p = job->data + k*stride;
+      for ( l=0; l<nl; l++ )
+	b[l] = p[offsets[l]];
+    }
+
+    _fff_cubic_spline_transform_tile( buf, dim, nl, FFF_CUBIC_SPLINE_TILE );
+
+    /* Scatter */
+    for ( k=0, b=buf; k<dim; k++, b+=FFF_CUBIC_SPLINE_TILE ) {
+      p = job->data + k*stride;
+      for ( l=0; l<nl; l++ )
+	p[offsets[l]] = b[l];
+    }
+  }
+
+  return;
+}
+
+void fff_cubic_spline_transform_axis ( double* data, int ndims, const size_t* dims, const size_t* strides,
+				       int axis, int nthreads )
+{
+  _fff_cubic_spline_axis_job job;
+  size_t ntiles;
+  int a;
+
+  if ( ( axis < 0 ) || ( axis >= ndims ) ) {
+    FFF_WARNING("Aborting. Invalid axis.");
+    return;
+  }
+
+  job.data = data;
+  job.ndims = ndims;
+  job.dims = dims;
+  job.strides = strides;
+  job.axis = axis;
+  job.nlines = 1;
+  for ( a=0; a<ndims; a++ )
+    if ( a != axis )
+      job.nlines *= dims[a];
+  if ( ( job.nlines == 0 ) || ( dims[axis] == 0 ) )
+    return;
+
+  /* One contiguous tile buffer per thread */
+  ntiles = ( job.nlines + FFF_CUBIC_SPLINE_TILE - 1 ) / FFF_CUBIC_SPLINE_TILE;
+  nthreads = fff_threads_count( nthreads );
+  if ( (size_t)nthreads > ntiles )
+    nthreads = (int)ntiles;
+  job.work = (double*)malloc( nthreads*dims[axis]*FFF_CUBIC_SPLINE_TILE*sizeof(double) );
+  if ( job.work == NULL ) {
+    FFF_WARNING("Aborting. Could not allocate tile buffers.");
+    return;
+  }
+
+  fff_parallel_run( nthreads, &_fff_cubic_spline_axis_job_run, (void*)&job );
+
+  free( job.work );
+
+  return;
+}
+
+/*
+  work is not used anymore and is only kept for backward compatibility
 */
 void fff_cubic_spline_transform_image ( fff_array* res, const fff_array* src, fff_vector* work )
 {
-  int axis; 
-  fff_vector v; 
+  fff_cubic_spline_transform_image_mt( res, src, 1 );
+  return;
+}
+
+void fff_cubic_spline_transform_image_mt ( fff_array* res, const fff_array* src, int nthreads )
+{
+  int axis;
+  size_t dims[4], strides[4];
 
   if ( res->datatype != FFF_DOUBLE )  {
     FFF_WARNING("Aborting. Output image encoding type must be double."); 
@@ -149,10 +321,12 @@ void fff_cubic_spline_transform_image ( fff_array* res, const fff_array* src, ff
   fff_array_copy( res, src ); 
 
   /* Apply separable cubic spline transforms */ 
-  for ( axis=0; axis<res->ndims; axis ++ ) {
-    v = fff_vector_view( work->data, fff_array_dim(res, axis), work->stride ); 
-    fff_array_iterate_vector_function( res, axis, &_fff_cubic_spline_transform, (void*)(&v) );
+  for ( axis=0; axis<4; axis ++ ) {
+    dims[axis] = fff_array_dim(res, axis);
+    strides[axis] = fff_array_offset(res, axis);
   }
+  for ( axis=0; axis<res->ndims; axis ++ ) 
+    fff_cubic_spline_transform_axis( (double*)res->data, res->ndims, dims, strides, axis, nthreads );
 
   return; 
 }
@@ -42,16 +42,43 @@ extern "C" {
     \brief Cubic spline transform of an image
     \param src input image 
     \param res output image (same size), should be of data type FFF_DOUBLE
-    \param work auxiliary vector
-
-    The output image \a res must be the same size as \a src.  \a work
-    must be allocated with size at least the maximum dimension of \a
-    res or \a src.  While the input image may have any data type, the
-    output image \a res has the mandatory data type FFF_DOUBLE, as
-    spline coefficients are generally not discrete (even for discrete
-    signals).
+    \param work unused, kept for backward compatibility
+
+    The output image \a res must be the same size as \a src.  While
+    the input image may have any data type, the output image \a res
+    has the mandatory data type FFF_DOUBLE, as spline coefficients are
+    generally not discrete (even for discrete signals).
   */
   extern void fff_cubic_spline_transform_image ( fff_array* res, const fff_array* src, fff_vector* work );
+  /*! 
+    \brief Multi-threaded cubic spline transform of an image
+    \param src input image 
+    \param res output image (same size), should be of data type FFF_DOUBLE
+    \param nthreads number of threads (all available processors if
+    nthreads<=0)
+
+    Same as \c fff_cubic_spline_transform_image. The result does not
+    depend on \a nthreads.
+  */
+  extern void fff_cubic_spline_transform_image_mt ( fff_array* res, const fff_array* src, int nthreads );
+  /*! 
+    \brief In-place cubic spline transform along one axis of a double array
+    \param data array data
+    \param ndims number of axes
+    \param dims array dimensions
+    \param strides array offsets, in number of doubles
+    \param axis transformed axis
+    \param nthreads number of threads (all available processors if
+    nthreads<=0)
+
+    Lines are gathered by tiles into a contiguous buffer and filtered
+    together, which avoids walking the array with large strides and
+    lets the recursions of neighbouring lines be interleaved. Each
+    line is filtered exactly as by \c fff_cubic_spline_transform, so
+    the result does not depend on \a nthreads.
+  */
+  extern void fff_cubic_spline_transform_axis ( double* data, int ndims, const size_t* dims, const size_t* strides,
+						int axis, int nthreads );
   /*! 
     \brief Sample a one-dimensional cubic spline at a given location 
     \param x interpolation point 
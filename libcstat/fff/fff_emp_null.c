@@ -0,0 +1,277 @@
+#include "fff_emp_null.h"
+#include "fff_threads.h"
+#include "fff_base.h"
+
+#include <stdlib.h>
+#include <math.h>
+#include <errno.h>
+
+
+/* The rank-th worker processes the rank-th range of maps, stored
+   along the rows of X, with its own buffers; res holds the outputs
+   of each map. */
+typedef struct {
+  fff_vector* res[3];
+  const fff_matrix* X;
+  double alpha;
+  double left;
+  double right;
+  int* error;                  /* nthreads flags */
+} _fff_emp_null_job;
+
+
+double fff_fdr_threshold(const fff_vector* pv, double alpha, long* work)
+{
+  size_t n = pv->size, i, k, b;
+  double pcorr, p, t, pth;
+  const double* buf;
+  long g;
+
+  if ((n == 0) || (!(alpha > 0)))
+    return 0.0;
+  pcorr = alpha/(double)n;
+
+  /* work[i-1] counts the p-values below the i-th critical value
+     pcorr*i, and not below the previous one */
+  for (i=0 ; i<n ; i++)
+    work[i] = 0;
+  for (i=0, buf=pv->data ; i<n ; i++, buf+=pv->stride){
+    p = *buf;
+    if (!(p < pcorr*(double)n))
+      continue;
+    b = (p > 0) ? (size_t)(p/pcorr) + 1 : 1;
+    b = FFF_MIN(b, n);
+    while ((b > 1) && (p < pcorr*(double)(b-1)))
+      b--;
+    while ((b <= n) && (!(p < pcorr*(double)b)))
+      b++;
+    if (b <= n)
+      work[b-1]++;
+  }
+
+  /* The k-th smallest p-value is below the k-th critical value if
+     and only if k p-values are; find the first k where it is not */
+  g = 0;
+  for (k=1 ; k<=n ; k++){
+    g += work[k-1];
+    if (g < (long)k)
+      break;
+  }
+  if (k == 1)
+    return 0.0;
+
+  /* The threshold is the largest of the k-1 p-values below the
+     (k-1)-th critical value */
+  t = pcorr*(double)(k-1);
+  pth = 0.0;
+  for (i=0, buf=pv->data ; i<n ; i++, buf+=pv->stride)
+    if ((*buf < t) && (*buf > pth))
+      pth = *buf;
+
+  return pth;
+}
+
+
+int fff_emp_null_fit(double* mu, double* sigma, double* p0, const fff_vector* x,
+		     double left, double right, fff_vector* work)
+{
+  size_t n = x->size, i0, i1, i, k, nbins, nz = 0;
+  size_t nlo = 0, nelo = 0, nhi = 0;
+  long* hist;
+  const double* buf;
+  double m, v, std, xmin, xmax, step, lo, hi, width, u, y, uk;
+  double S[5] = {0, 0, 0, 0, 0}, Ty[3] = {0, 0, 0};
+  double det, a, b, c, sqsigma, lp0;
+
+  *mu = FFF_NAN;
+  *sigma = FFF_NAN;
+  *p0 = FFF_NAN;
+  i0 = (size_t)((double)n*left);
+  i1 = (size_t)((double)n*right);
+  if ((!(left >= 0)) || (!(right <= 1)) || (i1 <= i0) || (work->size != n))
+    return 1;
+
+  /* Bin width from the standard deviation of all samples */
+  std = sqrt((double)fff_vector_ssd(x, &m, 0)/(double)n);
+  xmin = FFF_POSINF;
+  xmax = FFF_NEGINF;
+  for (i=0, buf=x->data ; i<n ; i++, buf+=x->stride){
+    xmin = FFF_MIN(xmin, *buf);
+    xmax = FFF_MAX(xmax, *buf);
+  }
+  step = 3.5*std/exp(log((double)n)/3.);
+
+  /* Bounds of the central part */
+  fff_vector_memcpy(work, x);
+  lo = fff_vector_select(work, i0);
+  hi = fff_vector_select(work, i1-1);
+  if ((!(step > 0)) || (!(hi > lo)) || (!(xmax-xmin < FFF_POSINF)))
+    return 1;
+  nbins = (size_t)FFF_MAX(10, (xmax-xmin)/step);
+  width = (hi-lo)/(double)nbins;
+  hist = (long*) calloc(nbins, sizeof(long));
+  if (hist == NULL){
+    FFF_ERROR("Out of memory", ENOMEM);
+    return 1;
+  }
+
+  /* Histogram of the central part: the samples strictly between the
+     bounds are binned, and the samples equal to the bounds are
+     counted to find how many belong to the central part */
+  for (i=0, buf=x->data ; i<n ; i++, buf+=x->stride){
+    v = *buf;
+    if (v < lo)
+      nlo++;
+    else if (v == lo)
+      nelo++;
+    else if (v < hi){
+      nhi++;
+      k = (size_t)((v-lo)/width);
+      hist[FFF_MIN(k, nbins-1)]++;
+    }
+  }
+  nhi += nlo + nelo;
+  hist[0] += (long)(FFF_MIN(nlo+nelo, i1) - i0);
+  hist[nbins-1] += (long)(i1 - FFF_MAX(nhi, i0));
+
+  /* Least-square fit of the log-histogram by a quadratic function of
+     the bin centers, expressed in bins from the middle of the
+     central part */
+  for (k=0 ; k<nbins ; k++){
+    if (hist[k] <= 0)
+      continue;
+    nz++;
+    u = (double)k + .5 - .5*(double)nbins;
+    y = log((double)hist[k]);
+    for (i=0, uk=1 ; i<5 ; i++, uk*=u){
+      S[i] += uk;
+      if (i < 3)
+	Ty[i] += uk*y;
+    }
+  }
+  free(hist);
+  if (nz < 3)
+    return 1;
+  det = S[0]*(S[2]*S[4]-S[3]*S[3]) - S[1]*(S[1]*S[4]-S[2]*S[3]) + S[2]*(S[1]*S[3]-S[2]*S[2]);
+  a = Ty[0]*(S[2]*S[4]-S[3]*S[3]) - S[1]*(Ty[1]*S[4]-S[3]*Ty[2]) + S[2]*(Ty[1]*S[3]-S[2]*Ty[2]);
+  b = S[0]*(Ty[1]*S[4]-Ty[2]*S[3]) - Ty[0]*(S[1]*S[4]-S[2]*S[3]) + S[2]*(S[1]*Ty[2]-S[2]*Ty[1]);
+  c = S[0]*(S[2]*Ty[2]-S[3]*Ty[1]) - S[1]*(S[1]*Ty[2]-S[2]*Ty[1]) + Ty[0]*(S[1]*S[3]-S[2]*S[2]);
+  if ((!(det > 0)) || (!(c < 0)))
+    return 1;
+  a /= det;
+  b /= det;
+  c /= det;
+
+  /* Normal density: the log-histogram peaks at mu with value
+     log(p0*n*width/sqrt(2*pi*sigma^2)) */
+  sqsigma = -width*width/(2*c);
+  lp0 = a - b*b/(4*c) - log(width*(double)n) + .5*log(2*M_PI*sqsigma);
+  *mu = .5*(lo+hi) - width*b/(2*c);
+  *sigma = sqrt(sqsigma);
+  *p0 = FFF_MIN(1, exp(lp0));
+
+  return 0;
+}
+
+
+static void _fff_fdr_threshold_job_run(int rank, int nthreads, void* params)
+{
+  _fff_emp_null_job* job = (_fff_emp_null_job*)params;
+  size_t n = job->X->size2, start, stop, j;
+  long* work;
+  fff_vector pv;
+
+  fff_parallel_range(job->X->size1, rank, nthreads, &start, &stop);
+  work = (long*) calloc(FFF_MAX(n,1), sizeof(long));
+  if (work == NULL){
+    FFF_ERROR("Out of memory", ENOMEM);
+    job->error[rank] = 1;
+    return;
+  }
+  for (j=start ; j<stop ; j++){
+    pv = fff_vector_view(job->X->data + j*job->X->tda, n, 1);
+    fff_vector_set(job->res[0], j, fff_fdr_threshold(&pv, job->alpha, work));
+  }
+  free(work);
+}
+
+static void _fff_emp_null_job_run(int rank, int nthreads, void* params)
+{
+  _fff_emp_null_job* job = (_fff_emp_null_job*)params;
+  size_t n = job->X->size2, start, stop, j;
+  double mu, sigma, p0;
+  fff_vector* work;
+  fff_vector x;
+
+  fff_parallel_range(job->X->size1, rank, nthreads, &start, &stop);
+  if (start == stop)
+    return;
+  work = fff_vector_new(n);
+  if (work == NULL){
+    job->error[rank] = 1;
+    return;
+  }
+  for (j=start ; j<stop ; j++){
+    x = fff_vector_view(job->X->data + j*job->X->tda, n, 1);
+    fff_emp_null_fit(&mu, &sigma, &p0, &x, job->left, job->right, work);
+    fff_vector_set(job->res[0], j, mu);
+    fff_vector_set(job->res[1], j, sigma);
+    fff_vector_set(job->res[2], j, p0);
+  }
+  fff_vector_delete(work);
+}
+
+/* Run a job over the maps, see _fff_emp_null_job */
+static int _fff_emp_null_run(_fff_emp_null_job* job, fff_parallel_func func, int nthreads)
+{
+  size_t nmaps = job->X->size1;
+  int r, err = 0;
+
+  nthreads = fff_threads_count(nthreads);
+  if ((size_t)nthreads > nmaps)
+    nthreads = (int)FFF_MAX(nmaps, 1);
+  job->error = (int*) calloc(nthreads, sizeof(int));
+  if (job->error == NULL){
+    FFF_ERROR("Out of memory", ENOMEM);
+    return 1;
+  }
+  fff_parallel_run(nthreads, func, (void*)job);
+  for (r=0 ; r<nthreads ; r++)
+    err = err || job->error[r];
+  free(job->error);
+  return err;
+}
+
+
+int fff_fdr_threshold_batch(fff_vector* pth, const fff_matrix* P, double alpha, int nthreads)
+{
+  _fff_emp_null_job job;
+
+  if (pth->size != P->size1){
+    FFF_WARNING("Incompatible dimensions");
+    return 1;
+  }
+  job.res[0] = pth;
+  job.X = P;
+  job.alpha = alpha;
+  return _fff_emp_null_run(&job, &_fff_fdr_threshold_job_run, nthreads);
+}
+
+
+int fff_emp_null_fit_batch(fff_vector* mu, fff_vector* sigma, fff_vector* p0,
+			   const fff_matrix* X, double left, double right, int nthreads)
+{
+  _fff_emp_null_job job;
+
+  if ((mu->size != X->size1) || (sigma->size != X->size1) || (p0->size != X->size1)){
+    FFF_WARNING("Incompatible dimensions");
+    return 1;
+  }
+  job.res[0] = mu;
+  job.res[1] = sigma;
+  job.res[2] = p0;
+  job.X = X;
+  job.left = left;
+  job.right = right;
+  return _fff_emp_null_run(&job, &_fff_emp_null_job_run, nthreads);
+}
@@ -0,0 +1,98 @@
+/*!
+  \file fff_emp_null.h
+  \brief False discovery rate thresholds and empirical null fits of statistic maps
+  \date 2009
+
+  These routines implement nipy.neurospin.utils.emp_null in linear
+  time, without sorting the maps: the Benjamini-Hochberg threshold of
+  FDR.pth_from_pvals is found by counting the p-values between
+  consecutive critical values, and the empirical null of ENN.learn,
+  a normal density fitted to the central part of the histogram of a
+  map (Schwartzman et al, NeuroImage 44, 2009), only selects the
+  bounds of that part.
+
+  The batched versions process the rows of a matrix, one map per row,
+  and share the maps among threads.
+*/
+
+#ifndef FFF_EMP_NULL
+#define FFF_EMP_NULL
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "fff_vector.h"
+#include "fff_matrix.h"
+
+  /*!
+    \brief Benjamini-Hochberg threshold of a p-value map
+    \param pv p-values
+    \param alpha false discovery rate
+    \param work buffer of the size of \a pv
+
+    With \f$ p_{(1)} \leq \dots \leq p_{(n)} \f$ the sorted p-values,
+    returns \f$ p_{(k)} \f$ where \a k is the largest index such that
+    \f$ p_{(i)} < \alpha i/n \f$ for all \f$ i \leq k \f$, or 0 if
+    there is none, as FDR.pth_from_pvals. NaNs are never below the
+    critical values.
+  */
+  extern double fff_fdr_threshold(const fff_vector* pv, double alpha, long* work);
+
+  /*!
+    \brief Benjamini-Hochberg thresholds of several p-value maps
+    \param pth thresholds (number of maps)
+    \param P (number of maps, n) p-values, one map per row
+    \param alpha false discovery rate
+    \param nthreads number of threads (see \c fff_threads_count)
+
+    See \c fff_fdr_threshold. Returns 0, or 1 if the arguments are
+    inconsistent or memory is lacking.
+  */
+  extern int fff_fdr_threshold_batch(fff_vector* pth, const fff_matrix* P, double alpha, int nthreads);
+
+  /*!
+    \brief Empirical null of a statistic map
+    \param mu mean of the null density
+    \param sigma standard deviation of the null density
+    \param p0 proportion of null samples, at most 1
+    \param x samples
+    \param left lower quantile of the central part
+    \param right upper quantile of the central part
+    \param work buffer of the size of \a x
+
+    As ENN.learn, the samples of ranks \a left*n to \a right*n-1 are
+    binned into equal bins of width \f$ 3.5 \sigma_x/n^{1/3} \f$, and
+    a quadratic function is fitted by least squares to the logarithm
+    of the non-empty bins. The bounds of the central part are selected
+    with \c fff_vector_select, and the histogram is made by one pass
+    over the samples.
+
+    Returns 0, or 1 and NaNs if the central part of the histogram
+    has fewer than three non-empty bins or is not concave.
+  */
+  extern int fff_emp_null_fit(double* mu, double* sigma, double* p0, const fff_vector* x,
+			      double left, double right, fff_vector* work);
+
+  /*!
+    \brief Empirical nulls of several statistic maps
+    \param mu means of the null densities (number of maps)
+    \param sigma standard deviations of the null densities (number of maps)
+    \param p0 proportions of null samples (number of maps)
+    \param X (number of maps, n) samples, one map per row
+    \param left lower quantile of the central parts
+    \param right upper quantile of the central parts
+    \param nthreads number of threads (see \c fff_threads_count)
+
+    See \c fff_emp_null_fit; the maps that cannot be fitted have NaN
+    parameters. Returns 0, or 1 if the arguments are inconsistent or
+    memory is lacking.
+  */
+  extern int fff_emp_null_fit_batch(fff_vector* mu, fff_vector* sigma, fff_vector* p0,
+				    const fff_matrix* X, double left, double right, int nthreads);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
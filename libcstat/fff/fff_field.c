@@ -1,5 +1,6 @@
 #include "fff_field.h"
 #include "fff_routines.h"
+#include "fff_threads.h"
 #include <stdio.h>
 #include <stdlib.h>
 #include <stdlib.h>
@@ -7,12 +8,9 @@
 #include <errno.h>
 
 
-static long  _fff_list_add( long *listn, double *listd,  const long newn, const double newd, const long k, const long j);
-
-
-static long _fff_list_move( long *listn, double *listd,  const long newn, const double newd, const long k, const long j);
-
 static int _fff_field_maxima_rth(fff_array *depth, const fff_graph* G, const fff_vector *field, const int rec, const double th);
+static int _fff_field_origins(long** ti, long** tn, double** tw, const fff_graph* G);
+static long _fff_field_origins_get(const long** nn, fff_graph_neighb* NG, const long* ti, const long* tn, const long j);
 
 /******************************************************/
 /**************** ancillary stuff *********************/
@@ -83,138 +81,175 @@ extern int fff_field_get_maxima_th(fff_array **depth, fff_array ** idx,const fff
   return(q);
 }
 
-extern int fff_field_maxima_r(fff_array *depth, const fff_graph* G, const fff_vector *field, const int rec)
+/* Depth of the local maxima of s*field, where s is 1 or -1, among the
+   vertices above th if thresholded. The passes of dilation of the
+   original algorithm are not run: a vertex loses in the pass after
+   the distance to its nearest higher vertex (on paths that avoid NaN
+   values, which never change), and the passes stop early
+   - when less than two vertices are left, i.e. after as many passes
+     as the second largest of these distances,
+   - or when the dilation is stable, one pass after the largest
+     distance from a vertex to the maximum that it reaches, unless
+     there are NaN or infinite values left.
+   The vertices are swept once by decreasing value, each set of equal
+   values claiming the vertices that reach it through the incoming
+   edges and are not claimed yet: this gives the maximum that each
+   vertex reaches and its distance. The nearest higher vertex is only
+   searched for candidates that do not reach their own value. */
+static int _fff_field_maxima_sweep(fff_array *depth, const fff_graph* G, const fff_vector *field,
+				   const int rec, const double s, const double th, const int thresholded)
 {
-  int i,r,N = G->V;
-  int E = G->E;
-  int nA,nB,remain;
-  double delta;
-  fff_array *win; 
-  fff_vector *mfield, *Mfield; 
-  int k; 
-
-  if (((int)(field->size) != N)||((int)(depth->dimX) !=N)){
+  long i, j, e, d, p, q, b, nv, nq, D, D1, D2, P, T = 0;
+  long N = G->V, nwin = 0, k = 0;
+  long *order, *dist, *stamp, *queue, *far, *ti, *tn;
+  double *x, *top, *tw, v;
+  const long *nn;
+  const double *nw;
+  int bad = 0;
+  fff_graph_neighb NG;
+
+  if (((long)(field->size) != N)||((long)(depth->dimX) != N)){
     FFF_WARNING("Size pof the graph and of the vectors do not match");
     return(0);
   }
-
-  win = fff_array_new1d(FFF_LONG,N);
-  mfield = fff_vector_new(N);
-  Mfield = fff_vector_new(N);
-  if (!mfield)    return(0);
-  if (!Mfield)    return(0);	
-  if (!win)    return(0);
-
-  fff_vector_memcpy(mfield, field);
-  fff_vector_memcpy(Mfield, field);
-  fff_array_set_all(win,1);
   fff_array_set_all(depth,0);
-   
-   /* Iterative dilatation */
-  for (r=0 ; r<rec ; r++){
-    for (i=0 ; i<E ; i++){
-      nA = G->eA[i];
-      nB = G->eB[i];
-      if (fff_vector_get(mfield,nA)<fff_vector_get(mfield,nB)){
-	fff_array_set1d (win, nA, 0);
-	if (fff_vector_get(Mfield,nA)<fff_vector_get(mfield,nB))
-	  fff_vector_set (Mfield,nA, fff_vector_get(mfield,nB));	
-      }
-    }
-    remain = 0;
-    
-    fff_vector_sub(mfield,Mfield);
-    delta = fff_blas_ddot (mfield,mfield);
-    fff_vector_memcpy(mfield, Mfield);
-    fff_array_add(depth,win);
-    for (i=0 ; i<N ; i++)
-      remain += (fff_array_get1d(win,i)>0);
-    if (remain<2)
-      break;
-    if (delta==0)
-      break; 
-    /* stop when all the maxima have been found */
+  if ((rec < 1) || (N < 1))
+    return(0);
+  if (fff_graph_neighb_init(&NG, G))
+    return(0);
+  if (_fff_field_origins(&ti, &tn, &tw, G)){
+    fff_graph_neighb_clear(&NG);
+    return(0);
   }
-
-  k = 0;
-  for (i=0 ; i<N ; i++)
-    k+= (fff_array_get1d(depth,i)>0);
-
-  fff_array_delete(win);
-  fff_vector_delete(mfield);
-  fff_vector_delete(Mfield);
-
-  return(k);
-}
-
-static int _fff_field_maxima_rth(fff_array *depth, const fff_graph* G, const fff_vector *field, const int rec, const double th)
-{
-  int i,r,N = G->V;
-  int E = G->E;
-  int nA,nB,remain;
-  double delta;
-  fff_array *win; 
-  fff_vector *mfield, *Mfield; 
-  int k; 
-
-  if (((int)(field->size) != N)||((int)(depth->dimX) !=N)){
-    FFF_WARNING("Size pof the graph and of the vectors do not match");
+  order = (long*) calloc(N, sizeof(long));
+  dist = (long*) calloc(N, sizeof(long));
+  stamp = (long*) calloc(N, sizeof(long));
+  queue = (long*) calloc(N, sizeof(long));
+  far = (long*) calloc(N, sizeof(long));
+  x = (double*) calloc(N, sizeof(double));
+  top = (double*) calloc(N, sizeof(double));
+  if ((order == NULL) || (dist == NULL) || (stamp == NULL) || (queue == NULL) || (far == NULL) ||
+      (x == NULL) || (top == NULL)){
+    free(order); free(dist); free(stamp); free(queue); free(far); free(x); free(top);
+    free(ti); free(tn); free(tw);
+    fff_graph_neighb_clear(&NG);
     return(0);
   }
 
-  win = fff_array_new1d(FFF_LONG,N);
-  mfield = fff_vector_new(N);
-  Mfield = fff_vector_new(N);
-  if (!mfield)    return(0);
-  if (!Mfield)    return(0);	
-  if (!win)    return(0);
+  /* vertices that are not NaN, by decreasing value */
+  nv = 0;
+  for (i=0 ; i<N ; i++){
+    x[i] = s*fff_vector_get(field, i);
+    dist[i] = -1;
+    stamp[i] = -1;
+    if (x[i] != x[i])
+      bad = 1;
+    else{
+      queue[nv] = i;
+      top[nv++] = -x[i];
+    }
+  }
+  sort_ascending_and_get_permutation(top, order, nv);
+  for (p=0 ; p<nv ; p++)
+    order[p] = queue[order[p]];
+
+  /* maximum reached by each vertex, and distance to it */
+  for (p=0 ; p<nv ; p=q){
+    v = x[order[p]];
+    nq = 0;
+    for (q=p ; (q<nv) && (x[order[q]]==v) ; q++)
+      if (dist[order[q]] < 0){
+	dist[order[q]] = 0;
+	queue[nq++] = order[q];
+      }
+    for (b=0 ; b<nq ; b++){
+      i = queue[b];
+      top[i] = v;
+      T = FFF_MAX(T, dist[i]);
+      d = _fff_field_origins_get(&nn, &NG, ti, tn, i);
+      for (e=0 ; e<d ; e++){
+	j = nn[e];
+	if ((dist[j] < 0) && (x[j] == x[j])){
+	  dist[j] = dist[i]+1;
+	  queue[nq++] = j;
+	}
+      }
+    }
+    if ((nq > 0) && (v-v != 0))
+      bad = 1;
+  }
 
-  fff_vector_memcpy(mfield, field);
-  fff_vector_memcpy(Mfield, field);
-  fff_array_set_all(win,0);
-  fff_array_set_all(depth,0);
-   
-  for (i=0 ; i<N ; i++)
-    if (fff_vector_get(field,i)>th)
-      fff_array_set1d(win,i,1);
-
-   /* Iterative dilatation */
-  for (r=0 ; r<rec ; r++){
-    for (i=0 ; i<E ; i++){
-      nA = G->eA[i];
-      nB = G->eB[i];
-      if (fff_vector_get(mfield,nA)<fff_vector_get(mfield,nB)){
-	fff_array_set1d (win, nA, 0);
-	if (fff_vector_get(Mfield,nA)<fff_vector_get(mfield,nB))
-	  fff_vector_set (Mfield,nA, fff_vector_get(mfield,nB));	
+  /* distance to the nearest higher vertex, if not above rec+1 */
+  D1 = 0;
+  D2 = 0;
+  for (i=0 ; i<N ; i++){
+    far[i] = -1;
+    if (thresholded && !(fff_vector_get(field,i) > th))
+      continue;
+    D = rec+2;
+    if ((x[i] == x[i]) && (top[i] > x[i])){
+      nq = 0;
+      queue[nq++] = i;
+      stamp[i] = i;
+      dist[i] = 0;
+      for (b=0 ; (b<nq) && (D>rec+1) && (dist[queue[b]]<=rec) ; b++){
+	j = queue[b];
+	d = fff_graph_neighb_get(&NG, j, &nn, &nw);
+	for (e=0 ; e<d ; e++){
+	  q = nn[e];
+	  if ((stamp[q] == i) || (x[q] != x[q]))
+	    continue;
+	  if (x[q] > x[i]){
+	    D = dist[j]+1;
+	    break;
+	  }
+	  stamp[q] = i;
+	  dist[q] = dist[j]+1;
+	  queue[nq++] = q;
+	}
       }
     }
-    remain = 0;
-    
-    fff_vector_sub(mfield,Mfield);
-    delta = fff_blas_ddot (mfield,mfield);
-    fff_vector_memcpy(mfield, Mfield);
-    fff_array_add(depth,win);
-    for (i=0 ; i<N ; i++)
-      remain += (fff_array_get1d(win,i)>0);
-    if (remain<2)
-      break;
-    if (delta==0)
-      break; 
-    /* stop when all the maxima have been found */
+    far[i] = D;
+    nwin++;
+    if (D > D1){
+      D2 = D1;
+      D1 = D;
+    }
+    else if (D > D2)
+      D2 = D;
   }
+  fff_graph_neighb_clear(&NG);
 
-  k = 0;
+  /* number of passes, and depths */
+  P = rec;
+  if (nwin < 2)
+    P = 1;
+  else
+    P = FFF_MIN(P, D2);
+  if (!bad)
+    P = FFF_MIN(P, T+1);
   for (i=0 ; i<N ; i++)
-    k+= (fff_array_get1d(depth,i)>0);
-
-  fff_array_delete(win);
-  fff_vector_delete(mfield);
-  fff_vector_delete(Mfield);
+    if (far[i] > 0){
+      D = FFF_MIN(far[i]-1, P);
+      fff_array_set1d(depth, i, D);
+      k += (D > 0);
+    }
 
+  free(order); free(dist); free(stamp); free(queue); free(far); free(x); free(top);
+  free(ti); free(tn); free(tw);
   return(k);
 }
 
+extern int fff_field_maxima_r(fff_array *depth, const fff_graph* G, const fff_vector *field, const int rec)
+{
+  return(_fff_field_maxima_sweep(depth, G, field, rec, 1, 0, 0));
+}
+
+static int _fff_field_maxima_rth(fff_array *depth, const fff_graph* G, const fff_vector *field, const int rec, const double th)
+{
+  return(_fff_field_maxima_sweep(depth, G, field, rec, 1, th, 1));
+}
+
 /**********************************************************************
  *************************** Field Minima ******************************
 **********************************************************************/
@@ -255,133 +290,337 @@ extern int fff_field_get_minima(fff_array **depth, fff_array ** idx,const fff_gr
 
 extern int fff_field_minima_r(fff_array *depth, const fff_graph* G, const fff_vector *field, const int rec)
 {
-  int i,r,N = G->V;
-  int E = G->E;
-  int nA,nB,remain;
-  double delta;
-  fff_array *win; 
-  fff_vector *mfield, *Mfield; 
-  int k; 
-
-  if (((int)(field->size) != N)||((int)(depth->dimX) !=N)){
-     FFF_WARNING("Size pof the graph and of the vectors do not match");
-     return(0);
+  return(_fff_field_maxima_sweep(depth, G, field, rec, -1, 0, 0));
+}
+
+
+/************************************************************************/
+/************* Diffusion ************************************************/
+/************************************************************************/
+
+
+
+/* The diffusion is the product of the field by the transposed
+   adjacency: vertex j receives w*field[i] from each edge (i,j,w).
+   It is computed as a gather over the incoming edges of each vertex,
+   sorted by origin, so that the terms are summed in the same order
+   as in a scatter over the edges, while the vertices are shared
+   among threads. */
+typedef struct {
+  long V;
+  long nc;           /* number of fields */
+  const long* ti;    /* incoming edges of each vertex (V+1) */
+  const long* tn;    /* origin of the incoming edges (E) */
+  const double* tw;  /* weight of the incoming edges (E) */
+  const double* in;  /* V*nc input fields, with leading dimension tdi */
+  long tdi;
+  double* out;       /* V*nc output fields, with leading dimension tdo */
+  long tdo;
+} _fff_field_diffusion_job;
+
+static void _fff_field_diffusion_job_run(int rank, int nthreads, void* params)
+{
+  _fff_field_diffusion_job* job = (_fff_field_diffusion_job*)params;
+  size_t start, stop;
+  long j, e, c, nc = job->nc;
+  double w, *y;
+  const double *x;
+
+  fff_parallel_range(job->V, rank, nthreads, &start, &stop);
+  for (j=(long)start ; j<(long)stop ; j++){
+    y = job->out + j*job->tdo;
+    for (c=0 ; c<nc ; c++)
+      y[c] = 0;
+    for (e=job->ti[j] ; e<job->ti[j+1] ; e++){
+      w = job->tw[e];
+      x = job->in + job->tn[e]*job->tdi;
+      for (c=0 ; c<nc ; c++)
+	y[c] += w*x[c];
+    }
   }
+}
 
-  win = fff_array_new1d(FFF_LONG,N);
-  mfield = fff_vector_new(N);
-  Mfield = fff_vector_new(N);
-  if (!mfield)    return(0);
-  if (!Mfield)    return(0);	
-  if (!win)    return(0);
+/* Incoming edges of each vertex, sorted by origin; returns 1 if
+   memory is lacking */
+static int _fff_field_transpose(long** ti, long** tn, double** tw, const fff_graph* G)
+{
+  long V = G->V;
+  long i, j, e, p, E;
+  long *ci, *cn, *pos;
+  double *cw;
 
-  fff_vector_memcpy(mfield, field);
-  fff_vector_memcpy(Mfield, field);
-  fff_array_set_all(win,1);
-  fff_array_set_all(depth,0);
-   
-   /* Iterative dilatation */
-  for (r=0 ; r<rec ; r++){
-    for (i=0 ; i<E ; i++){
-      nA = G->eA[i];
-      nB = G->eB[i];
-      if (fff_vector_get(mfield,nA)>fff_vector_get(mfield,nB)){
-	fff_array_set1d (win, nA, 0);
-	if (fff_vector_get(Mfield,nA)>fff_vector_get(mfield,nB))
-	  fff_vector_set (Mfield,nA, fff_vector_get(mfield,nB));	
-      }
+  if (fff_graph_adjacency(&ci, &cn, &cw, G))
+    return(1);
+  E = ci[V];
+  *ti = (long*) calloc(V+1, sizeof(long));
+  *tn = (long*) calloc(FFF_MAX(E,1), sizeof(long));
+  *tw = (double*) calloc(FFF_MAX(E,1), sizeof(double));
+  pos = (long*) calloc(FFF_MAX(V,1), sizeof(long));
+  if ((*ti == NULL) || (*tn == NULL) || (*tw == NULL) || (pos == NULL)){
+    fff_graph_adjacency_delete(ci, cn, cw, G);
+    free(*ti);
+    free(*tn);
+    free(*tw);
+    free(pos);
+    return(1);
+  }
+  for (e=0 ; e<E ; e++)
+    (*ti)[cn[e]+1]++;
+  for (j=0 ; j<V ; j++)
+    (*ti)[j+1] += (*ti)[j];
+  for (i=0 ; i<V ; i++)
+    for (e=ci[i] ; e<ci[i+1] ; e++){
+      j = cn[e];
+      p = (*ti)[j] + pos[j]++;
+      (*tn)[p] = i;
+      (*tw)[p] = cw[e];
     }
-    remain = 0;
-    
-    fff_vector_sub(mfield,Mfield);
-    delta = fff_blas_ddot (mfield,mfield);
-    fff_vector_memcpy(mfield, Mfield);
-    fff_array_add(depth,win);
-    for (i=0 ; i<N ; i++)
-      remain += (fff_array_get1d(win,i)>0);
-    if (remain<2)
-      break;
-    if (delta==0)
-      break; 
-    /* stop when all the minima have been found */
+  fff_graph_adjacency_delete(ci, cn, cw, G);
+  free(pos);
+  return(0);
+}
+
+/* niter diffusions of the V*nc fields data, with leading dimension tda */
+static int _fff_field_diffusion(double* data, const long tda, const long nc, const fff_graph* G,
+				const long niter, int nthreads)
+{
+  long V = G->V;
+  long i, c, it;
+  long *ti, *tn;
+  double *tw, *buf, *cur;
+  _fff_field_diffusion_job job;
+
+  if ((niter < 1) || (V < 1) || (nc < 1))
+    return(0);
+  if (_fff_field_transpose(&ti, &tn, &tw, G))
+    return(1);
+  buf = (double*) calloc(V*nc, sizeof(double));
+  if (buf == NULL){
+    free(ti);
+    free(tn);
+    free(tw);
+    return(1);
   }
+  nthreads = fff_threads_count(nthreads);
+  if (nthreads > V)
+    nthreads = (int)V;
+
+  job.V = V;
+  job.nc = nc;
+  job.ti = ti;
+  job.tn = tn;
+  job.tw = tw;
+  /* the fields alternate between data and buf */
+  for (it=0 ; it<niter ; it++){
+    if (it%2 == 0){
+      job.in = data;
+      job.tdi = tda;
+      job.out = buf;
+      job.tdo = nc;
+    }
+    else{
+      job.in = buf;
+      job.tdi = nc;
+      job.out = data;
+      job.tdo = tda;
+    }
+    fff_parallel_run(nthreads, &_fff_field_diffusion_job_run, (void*)&job);
+  }
+  if (niter%2 == 1)
+    for (i=0 ; i<V ; i++){
+      cur = buf + i*nc;
+      for (c=0 ; c<nc ; c++)
+	data[i*tda+c] = cur[c];
+    }
 
-  k = 0;
-  for (i=0 ; i<N ; i++)
-    k+= (fff_array_get1d(depth,i)>0);
+  free(buf);
+  free(ti);
+  free(tn);
+  free(tw);
+  return(0);
+}
 
-  fff_array_delete(win);
-  fff_vector_delete(mfield);
-  fff_vector_delete(Mfield);
+int fff_field_diffusion( fff_vector *field, const fff_graph* G)
+{
+  return(fff_field_diffusion_iter(field, G, 1, 1));
+}
 
-  return(k);
+int fff_field_diffusion_iter( fff_vector *field, const fff_graph* G, const long niter, int nthreads)
+{
+  if ((long)(field->size)!=G->V){
+    FFF_WARNING(" incompatible matrix size \n");
+    return(1);
+  }
+  return(_fff_field_diffusion(field->data, field->stride, 1, G, niter, nthreads));
 }
 
+int fff_field_md_diffusion( fff_matrix *field, const fff_graph* G)
+{
+  return(fff_field_md_diffusion_iter(field, G, 1, 1));
+}
 
-/************************************************************************/
-/************* Diffusion ************************************************/
-/************************************************************************/
+int fff_field_md_diffusion_iter( fff_matrix *field, const fff_graph* G, const long niter, int nthreads)
+{
+  if ((long)(field->size1)!=G->V){
+    FFF_WARNING(" incompatible matrix size \n");
+    return(1);
+  }
+  return(_fff_field_diffusion(field->data, field->tda, field->size2, G, niter, nthreads));
+}
 
 
+/************************************************************************/
+/************* Separable Gaussian smoothing *****************************/
+/************************************************************************/
 
-int fff_field_diffusion( fff_vector *field, const fff_graph* G)
+typedef struct {
+  const long* index;   /* vertex of each voxel of the box, -1 out of the mask */
+  long n[3];           /* box dimensions */
+  long axis;           /* axis of the pass */
+  long nc;             /* number of columns */
+  long r;              /* kernel radius */
+  const double* w;     /* kernel weights w[0..r] */
+  const double* in;
+  long tdi;
+  double* out;
+  long tdo;
+} _fff_field_smoothing_job;
+
+/* One pass of normalized convolution along the lines of the box that
+   are parallel to the axis: each vertex gets the average of the
+   vertices of the mask within distance r on its line, weighted by
+   the kernel. Lines are shared among the workers. */
+static void _fff_field_smoothing_job_run(int rank, int nthreads, void* params)
 {
-    int V = G->V;
-    int E = G->E;
-    int i;
-    double temp;
-    fff_vector *cfield; 
-
-    if ((int)(field->size)!=V){
-      FFF_WARNING(" incompatible matrix size \n");
-      return(1);
-    }
-
-    cfield = fff_vector_new(V);
-    fff_vector_memcpy(cfield,field);
-    fff_vector_set_all(field,0);
+  _fff_field_smoothing_job* job = (_fff_field_smoothing_job*)params;
+  long a = job->axis, b = (a+1)%3, c = (a+2)%3, nc = job->nc, r = job->r;
+  long stride[3], len = job->n[a], line, i, j, k, v, m;
+  long* pos;
+  double s, wt, *y;
+  const double* x;
+  size_t start, stop;
+
+  stride[0] = 1;
+  stride[1] = job->n[0];
+  stride[2] = job->n[0]*job->n[1];
+  pos = (long*) calloc(len, sizeof(long));
+  if (pos == NULL){
+    FFF_ERROR("Out of memory", ENOMEM);
+    return;
+  }
 
-    for(i=0 ; i<E ; i++){ 
-      temp = fff_vector_get(field,G->eB[i])+ G->eD[i]*fff_vector_get(cfield,G->eA[i]);
-      fff_vector_set(field,G->eB[i],temp);	  
+  fff_parallel_range(job->n[b]*job->n[c], rank, nthreads, &start, &stop);
+  for (line=(long)start ; line<(long)stop ; line++){
+    /* Positions of the mask along the line */
+    v = (line%job->n[b])*stride[b] + (line/job->n[b])*stride[c];
+    for (i=0, m=0 ; i<len ; i++)
+      if (job->index[v+i*stride[a]] >= 0)
+	pos[m++] = i;
+    for (i=0 ; i<m ; i++){
+      y = job->out + job->index[v+pos[i]*stride[a]]*job->tdo;
+      for (k=0 ; k<nc ; k++)
+	y[k] = 0;
+      s = 0;
+      for (j=i ; (j>=0) && (pos[i]-pos[j]<=r) ; j--){
+	wt = job->w[pos[i]-pos[j]];
+	x = job->in + job->index[v+pos[j]*stride[a]]*job->tdi;
+	for (k=0 ; k<nc ; k++)
+	  y[k] += wt*x[k];
+	s += wt;
+      }
+      for (j=i+1 ; (j<m) && (pos[j]-pos[i]<=r) ; j++){
+	wt = job->w[pos[j]-pos[i]];
+	x = job->in + job->index[v+pos[j]*stride[a]]*job->tdi;
+	for (k=0 ; k<nc ; k++)
+	  y[k] += wt*x[k];
+	s += wt;
+      }
+      for (k=0 ; k<nc ; k++)
+	y[k] /= s;
     }
-   
-    fff_vector_delete(cfield);
-    return(0);
+  }
+
+  free(pos);
 }
 
-int fff_field_md_diffusion( fff_matrix *field, const fff_graph* G)
+int fff_field_gaussian_smoothing(fff_matrix* field, const long* xyz, const double sigma, int nthreads)
 {
-    int E = G->E;
-    int V = G->V;
-    int i,nc,nr;    
-    fff_matrix *cfield;
-    fff_vector vi, *v; 
+  long V = field->size1, i, t, r, U, u;
+  long lo[3], hi[3];
+  long *index;
+  double *w, *buf;
+  _fff_field_smoothing_job job;
 
-    nc = field->size2;
-    nr = field->size1;
+  if ((V < 1) || (field->size2 < 1) || !(sigma > 0))
+    return(0);
 
-    if (nr!=V){
-      FFF_WARNING(" incompatible matrix size \n");
-      return(1);
+  /* Bounding box and voxel index of the mask */
+  for (t=0 ; t<3 ; t++){
+    lo[t] = hi[t] = xyz[t*V];
+    for (i=1 ; i<V ; i++){
+      lo[t] = FFF_MIN(lo[t], xyz[i+t*V]);
+      hi[t] = FFF_MAX(hi[t], xyz[i+t*V]);
     }
-    
-    cfield = fff_matrix_new(nr,nc);
-    fff_matrix_memcpy(cfield,field);
-    fff_matrix_set_all(field,0);
-    v = fff_vector_new(nc);
-	/* */
-	/* */
-    for(i=0 ; i<E ; i++){
-	  vi = fff_matrix_row (field, G->eB[i]);
-	  fff_matrix_get_row (v,cfield, G->eA[i]);
-	  fff_vector_scale(v,G->eD[i]);
-	  fff_vector_add(&vi,v );
+    job.n[t] = hi[t]-lo[t]+1;
+  }
+  U = job.n[0]*job.n[1]*job.n[2];
+
+  /* Kernel truncated at 4 sigma */
+  r = (long)ceil(4*sigma);
+  index = (long*) malloc(U*sizeof(long));
+  w = (double*) malloc((r+1)*sizeof(double));
+  buf = (double*) malloc(V*field->size2*sizeof(double));
+  if ((index == NULL) || (w == NULL) || (buf == NULL)){
+    FFF_ERROR("Out of memory", ENOMEM);
+    free(index);
+    free(w);
+    free(buf);
+    return(1);
+  }
+  for (i=0 ; i<U ; i++)
+    index[i] = -1;
+#define _FFF_FIELD_VOXEL(i) ((xyz[i]-lo[0]) + job.n[0]*((xyz[(i)+V]-lo[1]) + job.n[1]*(xyz[(i)+2*V]-lo[2])))
+  for (i=0 ; i<V ; i++)
+    index[_FFF_FIELD_VOXEL(i)] = i;
+  for (t=0 ; t<=r ; t++)
+    w[t] = exp(-0.5*t*t/(sigma*sigma));
+
+  nthreads = fff_threads_count(nthreads);
+  job.index = index;
+  job.nc = field->size2;
+  job.r = r;
+  job.w = w;
+
+  /* x and z passes from the field to the buffer, y pass back */
+  for (t=0 ; t<3 ; t++){
+    job.axis = t;
+    if (t == 1){
+      job.in = buf;
+      job.tdi = job.nc;
+      job.out = field->data;
+      job.tdo = field->tda;
     }
-	fff_vector_delete(v);
-    
-    fff_matrix_delete(cfield);
-    return(0);
+    else{
+      job.in = field->data;
+      job.tdi = field->tda;
+      job.out = buf;
+      job.tdo = job.nc;
+    }
+    fff_parallel_run(FFF_MAX(1, FFF_MIN(nthreads, job.n[(t+1)%3]*job.n[(t+2)%3])),
+		     &_fff_field_smoothing_job_run, (void*)&job);
+  }
+  /* Repeated voxels take the value of the last one */
+  for (i=0 ; i<V ; i++){
+    u = index[_FFF_FIELD_VOXEL(i)];
+    for (t=0 ; t<job.nc ; t++)
+      field->data[i*field->tda+t] = buf[u*job.nc+t];
+  }
+#undef _FFF_FIELD_VOXEL
+
+  free(index);
+  free(w);
+  free(buf);
+  return(0);
 }
 
 
@@ -390,66 +629,248 @@ int fff_field_md_diffusion( fff_matrix *field, const fff_graph* G)
 /************************************************************************/
 
 
-extern int fff_field_dilation(fff_vector *field, const fff_graph* G, const int rec)
+/* Whether v would replace the current value c of a dilation (or of
+   an erosion) */
+#define _FFF_FIELD_MORPHO_TAKES(c, v, erode) ((erode) ? ((v) < (c)) : ((c) < (v)))
+
+/* Max (or min) of the line x[0], x[s] .. x[(n-1)s] over the windows
+   [i-r,i+r] clipped to the line, using the prefix and suffix extrema
+   g and h of the blocks of 2r+1 samples (van Herk / Gil-Werman): each
+   window overlaps at most two blocks, so the cost does not depend on r */
+static void _fff_field_morpho_line(double* x, const long s, const long n, const long r,
+				   double* g, double* h, const int erode)
 {
-  int i,r,N = G->V;
-  int E = G->E;
-  int nA,nB;
-  int ri = 0;
-  fff_vector* mfield; 
+  long i, a, b, w = 2*r+1;
+
+  for (i=0 ; i<n ; i++)
+    g[i] = ((i%w == 0) || _FFF_FIELD_MORPHO_TAKES(g[i-1], x[i*s], erode)) ? x[i*s] : g[i-1];
+  for (i=n-1 ; i>=0 ; i--)
+    h[i] = ((i == n-1) || ((i+1)%w == 0) || _FFF_FIELD_MORPHO_TAKES(h[i+1], x[i*s], erode)) ? x[i*s] : h[i+1];
+  for (i=0 ; i<n ; i++){
+    a = FFF_MAX(i-r, 0);
+    b = FFF_MIN(i+r, n-1);
+    if (a/w != b/w)
+      x[i*s] = _FFF_FIELD_MORPHO_TAKES(h[a], g[b], erode) ? g[b] : h[a];
+    else
+      x[i*s] = (a%w == 0) ? g[b] : h[a];
+  }
+}
 
-  if ((int)(field->size) != N){
-     FFF_WARNING("Size pof the graph and of the vectors do not match");
-     return(0);
+/* rec passes of 26-neighbour dilation (or erosion) on an implicit
+   grid graph are a max (or min) over the cube of radius rec clipped
+   to the bounding box, provided that the grid fills its box and that
+   no value is NaN (NaN never changes, and stops the propagation);
+   the cube is then separable in x, y and z. Returns 1 if the fast
+   path does not apply. */
+static int _fff_field_morpho_grid(fff_vector* field, const fff_graph* G, const long rec, const int erode)
+{
+  const fff_graph_stencil* S = G->grid;
+  long i, x, y, z, nx, ny, nz, Mx, Mxy, n, r;
+  double *buf, *g, *h, v;
+
+  if ((S == NULL) || (S->k != FFF_GRAPH_STENCIL_MAX) || (G->V < 1))
+    return(1);
+  Mx = S->offset[3];
+  Mxy = S->offset[5];
+  nx = Mx-1;
+  ny = Mxy/Mx-1;
+  nz = (S->U-1)/Mxy+1;
+  if (nx*ny*nz != G->V)
+    return(1);
+  for (z=0 ; z<nz ; z++)
+    for (y=0 ; y<ny ; y++)
+      for (x=0 ; x<nx ; x++)
+	if (S->index[x+y*Mx+z*Mxy] < 0)
+	  return(1);
+  for (i=0 ; i<G->V ; i++){
+    v = fff_vector_get(field, i);
+    if (v != v)
+      return(1);
   }
 
-  mfield = fff_vector_new(N);
-  if (!mfield)    return(0);
-  
-  /* Iterative dilatation */
-  for (r=0 ; r<rec ; r++){    
-    fff_vector_memcpy(mfield,field);
-    for (i=0 ; i<E ; i++){
-      nA = G->eA[i];
-      nB = G->eB[i];
-      if (fff_vector_get(field,nA)<fff_vector_get(mfield,nB))
-	fff_vector_set (field,nA, fff_vector_get(mfield,nB));	
-    }
+  n = FFF_MAX(nx, FFF_MAX(ny, nz));
+  r = FFF_MIN(rec, n);
+  buf = (double*) calloc(S->U, sizeof(double));
+  g = (double*) calloc(n, sizeof(double));
+  h = (double*) calloc(n, sizeof(double));
+  if ((buf == NULL) || (g == NULL) || (h == NULL)){
+    free(buf);
+    free(g);
+    free(h);
+    return(1);
   }
-  fff_vector_delete(mfield);
-  
-  return(ri);
+  for (i=0 ; i<G->V ; i++)
+    buf[S->u[i]] = fff_vector_get(field, i);
+  for (z=0 ; z<nz ; z++)
+    for (y=0 ; y<ny ; y++)
+      _fff_field_morpho_line(buf+y*Mx+z*Mxy, 1, nx, r, g, h, erode);
+  for (z=0 ; z<nz ; z++)
+    for (x=0 ; x<nx ; x++)
+      _fff_field_morpho_line(buf+x+z*Mxy, Mx, ny, r, g, h, erode);
+  for (y=0 ; y<ny ; y++)
+    for (x=0 ; x<nx ; x++)
+      _fff_field_morpho_line(buf+x+y*Mx, Mxy, nz, r, g, h, erode);
+  for (i=0 ; i<G->V ; i++)
+    fff_vector_set(field, i, buf[S->u[i]]);
+
+  free(buf);
+  free(g);
+  free(h);
+  return(0);
 }
 
-extern int fff_field_erosion(fff_vector *field, const fff_graph* G, const int rec)
+/* Incoming edges of each vertex, as _fff_field_transpose builds them,
+   unless G is a grid graph whose voxels are distinct: its edges are
+   symmetric, and *ti is then NULL. Returns 1 if memory is lacking */
+static int _fff_field_origins(long** ti, long** tn, double** tw, const fff_graph* G)
 {
-  int i,r,N = G->V;
-  int E = G->E;
-  int nA,nB;
-  int ri = 0;
-  fff_vector* mfield;   
+  long i;
+  int sym = (G->grid != NULL);
+
+  for (i=0 ; (i<G->V) && sym ; i++)
+    sym = (G->grid->index[G->grid->u[i]] == i);
+  *ti = NULL;
+  *tn = NULL;
+  *tw = NULL;
+  if (sym)
+    return(0);
+  return(_fff_field_transpose(ti, tn, tw, G));
+}
+
+/* Origins of the edges that point to j, written in nn; returns their
+   number */
+static long _fff_field_origins_get(const long** nn, fff_graph_neighb* NG, const long* ti, const long* tn, const long j)
+{
+  const double *nw;
+
+  if (ti == NULL)
+    return(fff_graph_neighb_get(NG, j, nn, &nw));
+  *nn = tn + ti[j];
+  return(ti[j+1]-ti[j]);
+}
+
+/* Append to the nf first entries of front the origins of the edges
+   that point to j, unless they are already marked with r; returns
+   the new size of front */
+static long _fff_field_origins_push(long* front, long nf, long* mark, const long r, const long j,
+				    fff_graph_neighb* NG, const long* ti, const long* tn)
+{
+  long e, d;
+  const long *nn;
+
+  d = _fff_field_origins_get(&nn, NG, ti, tn, j);
+  for (e=0 ; e<d ; e++)
+    if (mark[nn[e]] != r){
+      mark[nn[e]] = r;
+      front[nf++] = nn[e];
+    }
+  return(nf);
+}
+
+/* rec passes of dilation (or erosion). A vertex can only change in a
+   pass if one of its neighbours changed in the previous one, since
+   it already holds the extremum of the other ones: each pass only
+   recomputes the origins of the edges that point to the vertices
+   changed by the previous pass, from the values at the start of the
+   pass and in the order of the full passes. */
+static int _fff_field_morpho(fff_vector* field, const fff_graph* G, const int rec, const int erode)
+{
+  long V = G->V;
+  long i, j, e, p, d, r, nf, nc;
+  long *ti, *tn, *front, *mark, *changed;
+  double *tw, *cur, *val;
+  const long *nn;
+  const double *nw;
+  double v;
+  int ch;
+  fff_graph_neighb NG;
+
+  if ((long)(field->size) != V){
+    FFF_WARNING("Size pof the graph and of the vectors do not match");
+    return(0);
+  }
+  if ((rec < 1) || (V < 1))
+    return(0);
+  if (_fff_field_morpho_grid(field, G, rec, erode) == 0)
+    return(0);
 
-  if ((int)(field->size) != N){
-     FFF_WARNING("Size pof the graph and of the vectors do not match");
-     return(0);
+  if (fff_graph_neighb_init(&NG, G))
+    return(0);
+  if (_fff_field_origins(&ti, &tn, &tw, G)){
+    fff_graph_neighb_clear(&NG);
+    return(0);
+  }
+  cur = (double*) calloc(V, sizeof(double));
+  val = (double*) calloc(V, sizeof(double));
+  front = (long*) calloc(V, sizeof(long));
+  changed = (long*) calloc(V, sizeof(long));
+  mark = (long*) calloc(V, sizeof(long));
+  if ((cur == NULL) || (val == NULL) || (front == NULL) || (changed == NULL) || (mark == NULL)){
+    free(cur);
+    free(val);
+    free(front);
+    free(changed);
+    free(mark);
+    free(ti);
+    free(tn);
+    free(tw);
+    fff_graph_neighb_clear(&NG);
+    return(0);
   }
 
-  mfield = fff_vector_new(N);
-  if (!mfield)    return(0);
-  
-  /* Iterative dilatation */
-  for (r=0 ; r<rec ; r++){    
-    fff_vector_memcpy(mfield,field);
-    for (i=0 ; i<E ; i++){
-      nA = G->eA[i];
-      nB = G->eB[i];
-      if (fff_vector_get(field,nA)>fff_vector_get(mfield,nB))
-	fff_vector_set (field,nA, fff_vector_get(mfield,nB));	
+  for (i=0 ; i<V ; i++){
+    cur[i] = fff_vector_get(field, i);
+    front[i] = i;
+    mark[i] = -1;
+  }
+  nf = V;
+  for (r=0 ; (r<rec) && (nf>0) ; r++){
+    nc = 0;
+    for (p=0 ; p<nf ; p++){
+      i = front[p];
+      v = cur[i];
+      ch = 0;
+      d = fff_graph_neighb_get(&NG, i, &nn, &nw);
+      for (e=0 ; e<d ; e++)
+	if (_FFF_FIELD_MORPHO_TAKES(v, cur[nn[e]], erode)){
+	  v = cur[nn[e]];
+	  ch = 1;
+	}
+      if (ch){
+	changed[nc] = i;
+	val[nc++] = v;
+      }
+    }
+    nf = 0;
+    for (p=0 ; p<nc ; p++){
+      j = changed[p];
+      cur[j] = val[p];
+      nf = _fff_field_origins_push(front, nf, mark, r, j, &NG, ti, tn);
     }
   }
-  fff_vector_delete(mfield);
-  
-  return(ri);
+  for (i=0 ; i<V ; i++)
+    fff_vector_set(field, i, cur[i]);
+
+  free(cur);
+  free(val);
+  free(front);
+  free(changed);
+  free(mark);
+  free(ti);
+  free(tn);
+  free(tw);
+  fff_graph_neighb_clear(&NG);
+  return(0);
+}
+
+extern int fff_field_dilation(fff_vector *field, const fff_graph* G, const int rec)
+{
+  return(_fff_field_morpho(field, G, rec, 0));
+}
+
+extern int fff_field_erosion(fff_vector *field, const fff_graph* G, const int rec)
+{
+  return(_fff_field_morpho(field, G, rec, 1));
 }
 
 extern int fff_field_opening(fff_vector *field, const fff_graph* G, const int rec)
@@ -469,221 +890,153 @@ extern int fff_field_closing(fff_vector *field, const fff_graph* G, const int re
 }
 
 
-extern int fff_custom_watershed(fff_array **idx, fff_array **depth, fff_array **major, fff_array* label,  const fff_vector *field, const fff_graph* G)
+static int _fff_field_long_cmp(const void* a, const void* b)
 {
-  int i,r,N = G->V;
-  int E = G->E;
-  int nA,nB,remain;
-  double delta;
-  int k; 
-  fff_array *win, *maj1, *maj2, *incwin; 
-  fff_vector *mfield, *Mfield; 
-  int j,aux;
-  fff_array *lidx, *ldepth, *lmajor;
-
-  if ((int)(field->size) != N){
-     FFF_WARNING("Size pof the graph and of the vectors do not match");
-     return(0);
-  } 
-  k = 0;
-  
-  win = fff_array_new1d(FFF_LONG,N);
-  maj1 = fff_array_new1d(FFF_LONG,N);
-  maj2 = fff_array_new1d(FFF_LONG,N);
-  incwin = fff_array_new1d(FFF_LONG,N);
-  mfield = fff_vector_new(N);
-  Mfield = fff_vector_new(N);
-  if (!mfield) return(0);
-  if (!Mfield) return(0);	
-  if (!win) return(0);
-  
-  fff_vector_memcpy(mfield, field);
-  fff_vector_memcpy(Mfield, field);
-  fff_array_set_all(win,1);
-  fff_array_set_all(incwin,0);
-  
-  for (i=0 ; i<N ; i++)
-    fff_array_set1d(maj1,i,i);
-  fff_array_copy(maj2, maj1);
-   
-   /* Iterative dilatation  */
-  for (r=0 ; r<N ; r++){
-    for (i=0 ; i<E ; i++){
-      nA = G->eA[i];
-      nB = G->eB[i];
-      if (fff_vector_get(mfield,nA)<fff_vector_get(mfield,nB)){
-	fff_array_set1d (win, nA, 0);
-	if (fff_vector_get(Mfield,nA)<fff_vector_get(mfield,nB)){
-	  fff_vector_set (Mfield,nA, fff_vector_get(mfield,nB));
-	  fff_array_set1d(maj2,nA,fff_array_get1d( maj2,nB));
-	  if (fff_array_get1d(incwin,nA)==r)
-	    fff_array_set1d(maj1,nA,fff_array_get1d(maj2,nB));
-	}
-      }
-    }
-    remain = 0;
-    
-    fff_vector_sub(mfield,Mfield);
-    delta = fff_blas_ddot (mfield,mfield);
-    fff_vector_memcpy(mfield, Mfield);
-    fff_array_add(incwin,win);
-    for (i=0 ; i<N ; i++)
-      remain += (fff_array_get1d(win,i)>0);
-    
-    if (remain<2)
-      break;
-    if (delta==0)
-      break; 
-    /* stop when all the maxima have been found  */
-  }
-  
-  /* get the local maximum associated with any point  */
-  for (i=0 ; i<N ; i++){
-    j = fff_array_get1d(maj1,i);
-    while (fff_array_get1d(incwin,j)==0)
-      j = fff_array_get1d(maj1,j);
-    fff_array_set1d(maj1,i,j);
-  }
-
-  /* number of bassins  */
-  for (i=0 ; i<N ; i++)
-    k+= (fff_array_get1d(incwin,i)>0);
-
-  lidx = fff_array_new1d(FFF_LONG,k);
-  ldepth = fff_array_new1d(FFF_LONG,k);
-  lmajor = fff_array_new1d(FFF_LONG,k); 
-
-  /* write the maxima and related stuff  */
-  j=0;
-  for (i=0 ; i<N ; i++)
-    if (fff_array_get1d(incwin,i)>0){
-      fff_array_set1d(lidx,j,i);
-      fff_array_set1d(ldepth,j, fff_array_get1d(incwin,i));
-      fff_array_set1d(maj2,i,j);/* ugly, but OK  */
-      j++;
-    }
-  for (j=0 ; j<k ; j++){
-    i = fff_array_get1d(lidx,j);
-    if (fff_array_get1d(maj1,i) != i){ /* i is not a global maximum */
-      aux = fff_array_get1d(maj2,fff_array_get1d(maj1,i));
-      fff_array_set1d(lmajor,j,aux);
-    }
-  else
-    fff_array_set1d(lmajor,j,j);
-  }
-  
-  /* Finally set the labels */
-  for (i=0 ; i<N ; i++){
-    aux = fff_array_get1d(maj2,fff_array_get1d(maj1,i));
-    fff_array_set1d(label,i,aux);
-  }
-  for (j=0 ; j<k ; j++){
-    i = fff_array_get1d(lidx,j);
-    fff_array_set1d(label,i,j);
-  }
-  
-  *idx = lidx;
-  *depth = ldepth;
-  *major = lmajor;
-
-  fff_array_delete(win);
-  fff_array_delete(maj1);
-  fff_array_delete(maj2);
-  fff_array_delete(incwin);
-  fff_vector_delete(mfield);
-  fff_vector_delete(Mfield);
-
-  return(k);
+  long la = *((const long*)a), lb = *((const long*)b);
+  return (la > lb) - (la < lb);
 }
 
-extern int fff_custom_watershed_th(fff_array **idx, fff_array **depth, fff_array **major, fff_array* label,  const fff_vector *field, const fff_graph* G, const double th)
+/* Watershed of the supra-threshold part of the field (of the whole
+   field if !thresholded). The passes of dilation that measure the
+   depth of the maxima are computed as in _fff_field_morpho: only the
+   vertices with a neighbour changed by the previous pass are visited,
+   by increasing index, since the basins read the updates of the
+   current pass. The sum of the squared changes is zero if and only
+   if none of its terms is, which is tracked along the way. */
+static int _fff_field_watershed(fff_array **idx, fff_array **depth, fff_array **major, fff_array* label,
+				const fff_vector *field, const fff_graph* G, const double th, const int thresholded)
 {
-  int i,r,N = G->V;
-  int E = G->E;
-  int nA,nB,remain;
-  double delta;
-  int k; 
-  fff_array *win, *maj1, *maj2, *incwin; 
-  fff_vector *mfield, *Mfield; 
-  int j, aux;
+  long i, j, e, d, p, r, N = G->V;
+  long nf, nc, nw, remain, nonfinite = 0, k = 0, aux;
+  long *win, *maj1, *maj2, *incwin, *front, *mark, *changed, *winners;
+  long *ti, *tn;
+  double *tw, *mfield, *val, v, dv;
+  const long *nn;
+  const double *nwe;
+  int ch, still;
+  fff_graph_neighb NG;
   fff_array *lidx, *ldepth, *lmajor;
-  
 
-  if ((int)(field->size) != N){
+  if ((long)(field->size) != N){
     FFF_WARNING("Size pof the graph and of the vectors do not match");
     return(0);
-  } 
-  k = 0;
-  
-  win = fff_array_new1d(FFF_LONG,N);
-  maj1 = fff_array_new1d(FFF_LONG,N);
-  maj2 = fff_array_new1d(FFF_LONG,N);
-  incwin = fff_array_new1d(FFF_LONG,N);
-  mfield = fff_vector_new(N);
-  Mfield = fff_vector_new(N);
-  if (!mfield) return(0);
-  if (!Mfield) return(0);	
-  if (!win) return(0);
-
-  fff_vector_memcpy(mfield, field);
-  fff_vector_memcpy(Mfield, field);
-  fff_array_set_all(win,0);
-  fff_array_set_all(incwin,0);
-  
+  }
+  if (fff_graph_neighb_init(&NG, G))
+    return(0);
+  if (_fff_field_origins(&ti, &tn, &tw, G)){
+    fff_graph_neighb_clear(&NG);
+    return(0);
+  }
+  win = (long*) calloc(FFF_MAX(N,1), sizeof(long));
+  maj1 = (long*) calloc(FFF_MAX(N,1), sizeof(long));
+  maj2 = (long*) calloc(FFF_MAX(N,1), sizeof(long));
+  incwin = (long*) calloc(FFF_MAX(N,1), sizeof(long));
+  front = (long*) calloc(FFF_MAX(N,1), sizeof(long));
+  mark = (long*) calloc(FFF_MAX(N,1), sizeof(long));
+  changed = (long*) calloc(FFF_MAX(N,1), sizeof(long));
+  winners = (long*) calloc(FFF_MAX(N,1), sizeof(long));
+  mfield = (double*) calloc(FFF_MAX(N,1), sizeof(double));
+  val = (double*) calloc(FFF_MAX(N,1), sizeof(double));
+  if ((win == NULL) || (maj1 == NULL) || (maj2 == NULL) || (incwin == NULL) || (front == NULL) ||
+      (mark == NULL) || (changed == NULL) || (winners == NULL) || (mfield == NULL) || (val == NULL)){
+    free(win); free(maj1); free(maj2); free(incwin); free(front);
+    free(mark); free(changed); free(winners); free(mfield); free(val);
+    free(ti); free(tn); free(tw);
+    fff_graph_neighb_clear(&NG);
+    return(0);
+  }
+
+  nw = 0;
   for (i=0 ; i<N ; i++){
-    fff_array_set1d(maj1,i,i);
-    if (fff_vector_get(field,i)>th)
-      fff_array_set1d(win,i,1);
+    mfield[i] = fff_vector_get(field, i);
+    nonfinite += (mfield[i]-mfield[i] != 0);
+    maj1[i] = i;
+    maj2[i] = i;
+    mark[i] = -1;
+    front[i] = i;
+    win[i] = ((!thresholded) || (mfield[i] > th));
+    if (win[i])
+      winners[nw++] = i;
   }
-  fff_array_copy(maj2, maj1);
+  remain = nw;
 
-   /* Iterative dilatation  */
+  /* Iterative dilatation */
+  nf = N;
   for (r=0 ; r<N ; r++){
-    for (i=0 ; i<E ; i++){
-      nA = G->eA[i];
-      nB = G->eB[i];
-      if (fff_vector_get(field,nA)>th)
-		if (fff_vector_get(mfield,nA)<fff_vector_get(mfield,nB)){
-		  fff_array_set1d (win, nA, 0);
-		  if (fff_vector_get(Mfield,nA)<fff_vector_get(mfield,nB)){
-			fff_vector_set (Mfield,nA, fff_vector_get(mfield,nB));
-			fff_array_set1d(maj2,nA,fff_array_get1d( maj2,nB));
-			if (fff_array_get1d(incwin,nA)==r)
-	      fff_array_set1d(maj1,nA,fff_array_get1d(maj2,nB));
-		  }
-		}
+    nc = 0;
+    for (p=0 ; p<nf ; p++){
+      i = front[p];
+      if (thresholded && !(fff_vector_get(field,i) > th))
+	continue;
+      v = mfield[i];
+      ch = 0;
+      d = fff_graph_neighb_get(&NG, i, &nn, &nwe);
+      for (e=0 ; e<d ; e++){
+	j = nn[e];
+	if (mfield[i] < mfield[j]){
+	  if (win[i]){
+	    win[i] = 0;
+	    remain--;
+	  }
+	  if (v < mfield[j]){
+	    v = mfield[j];
+	    ch = 1;
+	    maj2[i] = maj2[j];
+	    if (incwin[i] == r)
+	      maj1[i] = maj2[j];
+	  }
+	}
+      }
+      if (ch){
+	changed[nc] = i;
+	val[nc++] = v;
+      }
     }
-    remain = 0;
-    
-    fff_vector_sub(mfield,Mfield);
-    delta = fff_blas_ddot (mfield,mfield);
-    fff_vector_memcpy(mfield, Mfield);
-    fff_array_add(incwin,win);
-    for (i=0 ; i<N ; i++)
-      remain += (fff_array_get1d(win,i)>0);
-    
+
+    still = 1;
+    nf = 0;
+    for (p=0 ; p<nc ; p++){
+      i = changed[p];
+      dv = mfield[i] - val[p];
+      if (dv*dv != 0)
+	still = 0;
+      nonfinite += (val[p]-val[p] != 0) - (mfield[i]-mfield[i] != 0);
+      mfield[i] = val[p];
+      nf = _fff_field_origins_push(front, nf, mark, r, i, &NG, ti, tn);
+    }
+    qsort(front, nf, sizeof(long), &_fff_field_long_cmp);
+
+    j = 0;
+    for (p=0 ; p<nw ; p++)
+      if (win[winners[p]]){
+	incwin[winners[p]]++;
+	winners[j++] = winners[p];
+      }
+    nw = j;
+
     if (remain<2)
       break;
-    if (delta==0)
-      break; 
+    if (still && (nonfinite == 0))
+      break;
     /* stop when all the maxima have been found  */
   }
-  
+  fff_graph_neighb_clear(&NG);
+
   /* get the local maximum associated with any point  */
   for (i=0 ; i<N ; i++){
-    if (fff_vector_get(field,i)>th){
-      j = fff_array_get1d(maj1,i);
-      while (fff_array_get1d(incwin,j)==0)
-	j = fff_array_get1d(maj1,j);
-      fff_array_set1d(maj1,i,j);
-    }
+    if (thresholded && !(fff_vector_get(field,i) > th))
+      continue;
+    j = maj1[i];
+    while (incwin[j]==0)
+      j = maj1[j];
+    maj1[i] = j;
   }
 
   /* number of bassins  */
   for (i=0 ; i<N ; i++)
-    k+= (fff_array_get1d(incwin,i)>0);
+    k += (incwin[i]>0);
 
-  if (k<1){
+  if (thresholded && (k<1)){
     lidx = NULL;
     ldepth = NULL;
     lmajor = NULL;
@@ -692,33 +1045,31 @@ extern int fff_custom_watershed_th(fff_array **idx, fff_array **depth, fff_array
   else{
     lidx = fff_array_new1d(FFF_LONG,k);
     ldepth = fff_array_new1d(FFF_LONG,k);
-    lmajor = fff_array_new1d(FFF_LONG,k); 
-    
+    lmajor = fff_array_new1d(FFF_LONG,k);
+
     /* write the maxima and related stuff  */
-    j=0;
+    j = 0;
     for (i=0 ; i<N ; i++)
-      if (fff_array_get1d(incwin,i)>0){
+      if (incwin[i]>0){
 	fff_array_set1d(lidx,j,i);
-	fff_array_set1d(ldepth,j, fff_array_get1d(incwin,i));
-	fff_array_set1d(maj2,i,j);/* ugly, but OK  */
+	fff_array_set1d(ldepth,j,incwin[i]);
+	maj2[i] = j;/* ugly, but OK  */
 	j++;
       }
     for (j=0 ; j<k ; j++){
       i = fff_array_get1d(lidx,j);
-      if (fff_array_get1d(maj1,i) != i){ /* i is not a global maximum */
-	aux = fff_array_get1d(maj2,fff_array_get1d(maj1,i));
-	fff_array_set1d(lmajor,j,aux);
-      }
+      if (maj1[i] != i) /* i is not a global maximum */
+	fff_array_set1d(lmajor,j,maj2[maj1[i]]);
       else
 	fff_array_set1d(lmajor,j,j);
     }
-    
+
     /* Finally set the labels */
     for (i=0 ; i<N ; i++){
-      if (fff_vector_get(field,i)<th)
+      if (thresholded && (fff_vector_get(field,i)<th))
 	fff_array_set1d(label,i,-1);
       else{
-	aux = fff_array_get1d(maj2,fff_array_get1d(maj1,i));
+	aux = maj2[maj1[i]];
 	fff_array_set1d(label,i,aux);
       }
     }
@@ -726,41 +1077,61 @@ extern int fff_custom_watershed_th(fff_array **idx, fff_array **depth, fff_array
       i = fff_array_get1d(lidx,j);
       fff_array_set1d(label,i,j);
     }
-  }  
+  }
   *idx = lidx;
   *depth = ldepth;
   *major = lmajor;
-  
-  fff_array_delete(win);
-  fff_array_delete(maj1);
-  fff_array_delete(maj2);
-  fff_array_delete(incwin);
-  fff_vector_delete(mfield);
-  fff_vector_delete(Mfield);
+
+  free(win); free(maj1); free(maj2); free(incwin); free(front);
+  free(mark); free(changed); free(winners); free(mfield); free(val);
+  free(ti); free(tn); free(tw);
 
   return(k);
 }
 
+extern int fff_custom_watershed(fff_array **idx, fff_array **depth, fff_array **major, fff_array* label,  const fff_vector *field, const fff_graph* G)
+{
+  return(_fff_field_watershed(idx, depth, major, label, field, G, 0, 0));
+}
 
+extern int fff_custom_watershed_th(fff_array **idx, fff_array **depth, fff_array **major, fff_array* label,  const fff_vector *field, const fff_graph* G, const double th)
+{
+  return(_fff_field_watershed(idx, depth, major, label, field, G, th, 1));
+}
 
+/* Root of the level set of the label k, with path halving; root only
+   differs from the Father tree by these shortcuts */
+static long _fff_field_root(long* root, long k)
+{
+  while (root[k] != k){
+    root[k] = root[root[k]];
+    k = root[k];
+  }
+  return(k);
+}
 
+/* The vertices are swept once by decreasing value: each one either
+   starts a level set, extends that of its neighbours, or merges the
+   level sets of its neighbours under a new label, which is the
+   Father of the merged ones. The level sets are found by union-find
+   on the labels instead of walking up the Father tree. */
 extern long fff_field_bifurcations(fff_array **Idx, fff_vector **Height, fff_array **Father, fff_array* label,  const fff_vector *field, const fff_graph* G, const double th)
 {
-  long i,j,k,l,win,start, end;
+  long i, j, k, l, win, d;
   long V = G->V;
-  long E = G->E;
   long ri = 0;
   long ll = 0;
-  fff_array *cindices, *neighb;
-  fff_vector *weight; 
+  fff_graph_neighb NG;
+  const long *nn;
+  const double *nw;
   fff_vector *cfield;
-  fff_array *father, *possible, *idx; 
-  fff_vector *height; 
+  long *father, *root, *possible, *idx, *lab;
+  double *height;
   fff_array* papa;
   fff_array* indices;
   fff_vector* hauteur;
-  long *p; 
-  long q; 
+  long *p;
+  long q;
 
   /* argument checking */
   if ((label->dimX)!=V){
@@ -769,164 +1140,300 @@ extern long fff_field_bifurcations(fff_array **Idx, fff_vector **Height, fff_arr
   }
 
   /* initializations */
-  cindices = fff_array_new1d(FFF_LONG,V+1);
-  neighb = fff_array_new1d(FFF_LONG,E);
-  weight = fff_vector_new(E);
-  
-  ri = fff_graph_to_neighb(cindices,neighb,weight,G);
-  
+  ri = fff_graph_neighb_init(&NG, G);
+  if (ri)
+    return(ri);
+
   /* sort the data */
   cfield = fff_vector_new(V);
   fff_vector_memcpy(cfield,field);
   fff_vector_scale (cfield, -1);
-  p = (long *) calloc(V,sizeof(long));
+  p = (long *) calloc(FFF_MAX(V,1),sizeof(long));
   sort_ascending_and_get_permutation( cfield->data, p, cfield->size );
   fff_vector_delete(cfield);
-  
 
-  fff_array_set_all(label,-1);
-  father = fff_array_new1d(FFF_LONG,2*V);
-  for (i=0; i<2*V ; i++)
-	fff_array_set1d(father,i,i);
-  
-  possible = fff_array_new1d(FFF_LONG,V);
-  idx = fff_array_new1d(FFF_LONG,2*V);
-  height = fff_vector_new(2*V);
+  father = (long*) calloc(FFF_MAX(V,1), sizeof(long));
+  root = (long*) calloc(FFF_MAX(V,1), sizeof(long));
+  possible = (long*) calloc(FFF_MAX(V,1), sizeof(long));
+  idx = (long*) calloc(FFF_MAX(V,1), sizeof(long));
+  lab = (long*) calloc(FFF_MAX(V,1), sizeof(long));
+  height = (double*) calloc(FFF_MAX(V,1), sizeof(double));
+  for (i=0; i<V ; i++)
+    lab[i] = -1;
 
   for (i=0; i<V ; i++){
-	win = p[i];
-	if (fff_vector_get(field,win)<th) break;
-	else{
-	  start = fff_array_get1d(cindices,win);
-	  end = fff_array_get1d(cindices,win+1);
-	  fff_array_set_all(possible,-1);
-	  q = 0;
-	  
-	  for (j=start ; j<end ; j++){
-		k = fff_array_get1d(label,fff_array_get1d(neighb,j));
-				
-		if (k>-1){
-		  while (fff_array_get1d(father,k)!=k) 
-			k = fff_array_get1d(father,k);
-		  for (l=0 ; l<q ; l++)
-			if (fff_array_get1d(possible,l)>-1)
-			  if (fff_array_get1d(possible,l)==k)
-				break;
-		  if (fff_array_get1d(possible,l)!=k){
-			if (l>1) {
-			  /* printf("%ld %ld %ld",i,q, l);
-			     for (m=0 ; m<l+1 ; m++) printf(" %ld ",fff_array_get1d(possible,m));
-			     printf("\n"); */
-			}
-			fff_array_set1d(possible,q,k);
-			q++;
-		  }
-		}
-	  }
-	  
-	  if (q==0){
-		fff_array_set1d(label,win,ll);
-		fff_array_set1d(idx,ll,win);
-		fff_vector_set(height,ll,fff_vector_get(field,win));
-		ll++;
-	  }
-	  if (q==1)
-		fff_array_set1d(label,win,fff_array_get1d(possible,0));
-	  if (q>1){
-	    /* birfurcation : create a new label */
-		for (j=0 ; j<q ; j++){
-		  k =  fff_array_get1d(possible,j);
-		  fff_array_set1d(father,k,ll);
-		}
-		fff_array_set1d(label,win,ll);
-		fff_array_set1d(idx,ll,win);
-		fff_vector_set(height,ll,fff_vector_get(field,win));
-		ll++;
-	  }
-	}
+    win = p[i];
+    if (fff_vector_get(field,win)<th) break;
+    d = fff_graph_neighb_get(&NG, win, &nn, &nw);
+    q = 0;
+
+    /* distinct level sets of the neighbours, in order of appearance */
+    for (j=0 ; j<d ; j++){
+      k = lab[nn[j]];
+      if (k>-1){
+	k = _fff_field_root(root, k);
+	for (l=0 ; l<q ; l++)
+	  if (possible[l]==k)
+	    break;
+	if (l==q)
+	  possible[q++] = k;
+      }
+    }
+
+    if (q==1)
+      lab[win] = possible[0];
+    else{
+      /* new level set, or birfurcation : create a new label */
+      for (j=0 ; j<q ; j++){
+	father[possible[j]] = ll;
+	root[possible[j]] = ll;
+      }
+      father[ll] = ll;
+      root[ll] = ll;
+      lab[win] = ll;
+      idx[ll] = win;
+      height[ll] = fff_vector_get(field,win);
+      ll++;
+    }
   }
-  
-    
+
   papa = fff_array_new1d(FFF_LONG,ll);
   indices = fff_array_new1d(FFF_LONG,ll);
   hauteur = fff_vector_new(ll);
   for (i=0 ; i<ll ; i++){
-	fff_array_set1d(papa,i,fff_array_get1d(father,i));
-	fff_array_set1d(indices,i,fff_array_get1d(idx,i));
-	fff_vector_set(hauteur,i,fff_vector_get(height,i));
+    fff_array_set1d(papa,i,father[i]);
+    fff_array_set1d(indices,i,idx[i]);
+    fff_vector_set(hauteur,i,height[i]);
   }
+  for (i=0 ; i<V ; i++)
+    fff_array_set1d(label,i,lab[i]);
   *Father = papa;
   *Height = hauteur;
   *Idx = indices;
 
-  fff_array_delete(cindices);
-  fff_array_delete(neighb);
-  fff_vector_delete(weight);
-  
-  fff_array_delete(possible);
-  fff_array_delete(father);
-  fff_array_delete(idx);
-  fff_vector_delete(height);
+  fff_graph_neighb_clear(&NG);
+
+  free(father);
+  free(root);
+  free(possible);
+  free(idx);
+  free(lab);
+  free(height);
   free(p);
 
   return(ll);
 }
-static long  _fff_list_add( long *listn, double *listd,  const long newn, const double newd, const long k, const long j)
-{  
-  long i = k; 
-  while (listd[i-1] > newd){
-	if (i==j)break;
-    listd[i] = listd[i-1];
-    listn[i] = listn[i-1];
-    i--;
-  } 
-  i = FFF_MAX(i,j);
-  listd[i] = newd;
-  listn[i] = newn;
+
+/* Resize a buffer, leaving it unchanged on failure */
+static int _fff_field_grow(void** x, size_t nbytes)
+{
+  void* y = realloc(*x, nbytes);
+  if (y == NULL)
+    return(1);
+  *x = y;
   return(0);
 }
 
-static long _fff_list_move( long *listn, double *listd,  const long newn, const double newd, const long k, const long j)
-{ 
-  char* proc = "_fff_list_move"; 
-  long i = k-1;
-  while (listn[i]!=newn) {
-    i--;
-    if (i<j){
-	  long m;
-	  for (m=0 ; m<k ; m++) if (listn[m]==newn) printf("found %ld %ld \n",m,listn[m]);
-	  printf("\n");
-	  printf("%s %ld %ld %ld \n",proc,newn,k,j);
+/* The vertices are swept once by decreasing value and the thresholds
+   once by decreasing value: before each threshold, the vertices above
+   it are added to the union-find forest of the clusters, which are
+   then read off the forest. The clusters of a threshold are thus
+   nested in those of the lower ones. Each root holds the size, the
+   sum of the values and the peak of its cluster, the peak being the
+   first vertex of the cluster in the sweep. */
+extern long fff_field_threshold_clusters(fff_array **Th, fff_array **Size, fff_vector **Mass, fff_array **Peak, fff_array* label, const fff_vector *field, const fff_graph* G, const fff_vector *th)
+{
+  long i, j, k, t, d, r, s, v, win, q, ot;
+  long V = G->V;
+  long nth = th->size;
+  long nc = 0;
+  long nmax = 0;
+  long ncomp = 0;
+  double uth;
+  fff_graph_neighb NG;
+  const long *nn;
+  const double *nw;
+  fff_vector *cfield;
+  long *p, *tord, *rank, *root, *csize, *cpeak, *cid, *start, *count;
+  long *ct, *cs, *cp;
+  double *csum, *cm;
+  fff_array *thidx, *size, *peak;
+  fff_vector *mass;
+
+  /* argument checking */
+  if (((long)field->size != V) ||
+      ((label != NULL) && ((label->dimX != V) || (label->dimY != nth)))){
+    FFF_WARNING(" incompatible matrix size \n");
+    return(-1);
+  }
+  if (fff_graph_neighb_init(&NG, G))
+    return(-1);
+
+  p = (long*) calloc(FFF_MAX(V,1), sizeof(long));
+  tord = (long*) calloc(FFF_MAX(nth,1), sizeof(long));
+  rank = (long*) calloc(FFF_MAX(V,1), sizeof(long));
+  root = (long*) calloc(FFF_MAX(V,1), sizeof(long));
+  csize = (long*) calloc(FFF_MAX(V,1), sizeof(long));
+  cpeak = (long*) calloc(FFF_MAX(V,1), sizeof(long));
+  cid = (long*) calloc(FFF_MAX(V,1), sizeof(long));
+  csum = (double*) calloc(FFF_MAX(V,1), sizeof(double));
+  start = (long*) calloc(FFF_MAX(nth,1), sizeof(long));
+  count = (long*) calloc(FFF_MAX(nth,1), sizeof(long));
+  ct = cs = cp = NULL;
+  cm = NULL;
+  if ((p == NULL) || (tord == NULL) || (rank == NULL) || (root == NULL) ||
+      (csize == NULL) || (cpeak == NULL) || (cid == NULL) || (csum == NULL) ||
+      (start == NULL) || (count == NULL)){
+    FFF_ERROR("Out of memory", ENOMEM);
+    nc = -1;
+  }
+
+  /* sort the data and the thresholds by decreasing value */
+  if (nc == 0){
+    cfield = fff_vector_new(V);
+    fff_vector_memcpy(cfield, field);
+    fff_vector_scale(cfield, -1);
+    sort_ascending_and_get_permutation(cfield->data, p, V);
+    fff_vector_delete(cfield);
+    cfield = fff_vector_new(nth);
+    fff_vector_memcpy(cfield, th);
+    fff_vector_scale(cfield, -1);
+    sort_ascending_and_get_permutation(cfield->data, tord, nth);
+    fff_vector_delete(cfield);
+    for (i=0 ; i<V ; i++){
+      rank[p[i]] = i;
+      root[i] = -1;
     }
+    if (label != NULL)
+      for (i=0 ; i<V ; i++)
+	for (t=0 ; t<nth ; t++)
+	  fff_array_set2d(label, i, t, -1);
   }
-  if (i>=j){
-	while (listd[i-1]>newd){
-	  if (i==j)break;
-	  listd[i] = listd[i-1];
-	  listn[i] = listn[i-1];
-	  i--;
+
+  i = 0;
+  for (t=0 ; (t<nth) && (nc>=0) ; t++){
+    ot = tord[t];
+    uth = fff_vector_get(th, ot);
+
+    /* add the vertices above the threshold to the forest */
+    for ( ; i<V ; i++){
+      win = p[i];
+      if (!(fff_vector_get(field, win) > uth))
+	break;
+      root[win] = win;
+      csize[win] = 1;
+      csum[win] = fff_vector_get(field, win);
+      cpeak[win] = win;
+      ncomp++;
+      d = fff_graph_neighb_get(&NG, win, &nn, &nw);
+      for (j=0 ; j<d ; j++){
+	if (root[nn[j]] < 0)
+	  continue;
+	r = _fff_field_root(root, nn[j]);
+	s = _fff_field_root(root, win);
+	if (r == s)
+	  continue;
+	/* union by size */
+	if (csize[r] > csize[s]){
+	  k = r; r = s; s = k;
 	}
-	i = FFF_MAX(i,j);
-	listd[i] = newd;
-	listn[i] = newn;
+	root[r] = s;
+	csize[s] += csize[r];
+	csum[s] += csum[r];
+	if (rank[cpeak[r]] < rank[cpeak[s]])
+	  cpeak[s] = cpeak[r];
+	ncomp--;
+      }
+    }
+
+    /* read the clusters off the forest, by decreasing peak value */
+    if (nc+ncomp > nmax){
+      nmax = FFF_MAX(2*nmax, nc+ncomp);
+      if (_fff_field_grow((void**)&ct, nmax*sizeof(long)) ||
+	  _fff_field_grow((void**)&cs, nmax*sizeof(long)) ||
+	  _fff_field_grow((void**)&cp, nmax*sizeof(long)) ||
+	  _fff_field_grow((void**)&cm, nmax*sizeof(double))){
+	FFF_ERROR("Out of memory", ENOMEM);
+	nc = -1;
+	break;
+      }
+    }
+    start[ot] = nc;
+    count[ot] = ncomp;
+    q = 0;
+    for (k=0 ; k<i ; k++){
+      v = p[k];
+      r = _fff_field_root(root, v);
+      if (cpeak[r] == v){
+	cid[r] = q;
+	ct[nc+q] = ot;
+	cs[nc+q] = csize[r];
+	cm[nc+q] = csum[r] - csize[r]*uth;
+	cp[nc+q] = v;
+	q++;
+      }
+      if (label != NULL)
+	fff_array_set2d(label, v, ot, cid[r]);
+    }
+    nc += q;
   }
-  return(0);
+
+  /* clusters in the order of the thresholds */
+  if (nc >= 0){
+    thidx = fff_array_new1d(FFF_LONG, nc);
+    size = fff_array_new1d(FFF_LONG, nc);
+    peak = fff_array_new1d(FFF_LONG, nc);
+    mass = fff_vector_new(nc);
+    k = 0;
+    for (t=0 ; t<nth ; t++)
+      for (j=start[t] ; j<start[t]+count[t] ; j++){
+	fff_array_set1d(thidx, k, ct[j]);
+	fff_array_set1d(size, k, cs[j]);
+	fff_array_set1d(peak, k, cp[j]);
+	fff_vector_set(mass, k, cm[j]);
+	k++;
+      }
+    *Th = thidx;
+    *Size = size;
+    *Peak = peak;
+    *Mass = mass;
+  }
+
+  fff_graph_neighb_clear(&NG);
+  free(p);
+  free(tord);
+  free(rank);
+  free(root);
+  free(csize);
+  free(cpeak);
+  free(cid);
+  free(csum);
+  free(start);
+  free(count);
+  free(ct);
+  free(cs);
+  free(cp);
+  free(cm);
+
+  return(nc);
 }
 
 extern long fff_field_voronoi(fff_array *label, const fff_graph* G,const fff_matrix* field,const  fff_array *seeds)
 {
-  long i,j,k,l,win,start, end;
+  long i,k,l,d,win;
   long sp = seeds->dimX;
   double infdist = 1.0;
   long V = G->V;
-  long E = G->E;
   long ri = 0;
   double w;
   double dsmin,dsmax;
   long smin, smax, lwin; 
 
-  fff_vector *dist, *dg, *weight; 
-  fff_array *lg, *cindices, *neighb;
+  fff_vector *dist; 
+  fff_graph_heap* H;
+  fff_graph_neighb NG;
+  const long *nn;
+  const double *nw;
  
   fff_array * visited;
   fff_matrix * feature;
@@ -949,25 +1456,19 @@ extern long fff_field_voronoi(fff_array *label, const fff_graph* G,const fff_mat
   }
 
   /* initializations*/
+  ri = fff_graph_neighb_init(&NG, G);
+  if (ri)
+    return(ri);
   dist = fff_vector_new(V);
-  dg = fff_vector_new(V+1);
-  lg = fff_array_new1d(FFF_LONG,V+1);
-  cindices = fff_array_new1d(FFF_LONG,V+1);
-  neighb = fff_array_new1d(FFF_LONG,E);
-  weight = fff_vector_new(E);
+  H = fff_graph_heap_new(V);
   visited = fff_array_new1d(FFF_LONG,V);
   fff_array_set_all(visited,0);
-  ri = fff_graph_to_neighb(cindices, neighb, weight,G);
   
   /* create a feature matrix*/
   feature = fff_matrix_new(seeds->dimX,field->size2);
   x = fff_vector_new(field->size2);
   y = fff_vector_new(field->size2);
 
-  for(i=0 ; i<V+1 ; i++){
-    fff_vector_set(dg,i,infdist);
-    fff_array_set1d(lg,i,-1);
-  }
   for(i=0 ; i<V ; i++){
     fff_vector_set(dist,i,infdist);
     fff_array_set1d(label,i,-1);
@@ -976,59 +1477,47 @@ extern long fff_field_voronoi(fff_array *label, const fff_graph* G,const fff_mat
   for(i=0 ; i<sp ; i++){
     win = fff_array_get1d(seeds,i);
     if (fff_vector_get(dist,win)>0){ 
-	  fff_array_set1d(lg,k,win);
-	  fff_array_set1d(label,win,k);
-	  fff_matrix_get_row(x,field,win);
-	  fff_matrix_set_row(feature,i,x);
-	  k++;
-	}
-    fff_vector_set(dist,win,0);
-    fff_vector_set(dg,i,0);
+      fff_array_set1d(label,win,k);
+      fff_matrix_get_row(x,field,win);
+      fff_matrix_set_row(feature,k,x);
+      fff_vector_set(dist,win,0);
+      fff_graph_heap_push(H, win, 0);
+      k++;
+    }
   } 
-  win = fff_array_get1d(seeds,0);
 
-  /* iterations */
-  for (j=1 ; j<V ; j++){
-	fff_array_set1d(visited,win,1);
-    start = fff_array_get1d(cindices,win);
-    end = fff_array_get1d(cindices,win+1);
+  /* iterations: the distance to the seed feature is not additive,
+     hence vertices are frozen once they leave the heap */
+  while (H->size > 0){
+    win = fff_graph_heap_pop(H);
+    fff_array_set1d(visited,win,1);
+    lwin = fff_array_get1d(label, win);
+    fff_matrix_get_row(x,feature,lwin);
     
-    for (i=start ; i<end ; i++){
-	  /* compute the distance*/
-      l = fff_array_get1d(neighb,i);
-	  lwin  = fff_array_get1d(label, win);
-	  if (fff_array_get1d(visited,l)==0){
-		fff_matrix_get_row(x,feature,lwin);
-		fff_matrix_get_row(y,field,l);
-		fff_vector_sub(x,y);
-		w = fff_blas_ddot(x,x);
-		
-		if ( w < fff_vector_get(dist,l)){	  
-		  if (fff_vector_get(dist,l) < infdist)
-			ri += _fff_list_move(lg->data, dg->data, l, w, k,j);
-		  else{
-			ri += _fff_list_add(lg->data, dg->data, l, w, k,j);
-			k++; 
-		  }
-		  fff_vector_set(dist,l,w);
-		  fff_array_set1d(label,l, lwin);
-		}
-	  }
+    d = fff_graph_neighb_get(&NG, win, &nn, &nw);
+    for (i=0 ; i<d ; i++){
+      /* compute the distance*/
+      l = nn[i];
+      if (fff_array_get1d(visited,l)==0){
+	fff_matrix_get_row(y,field,l);
+	fff_vector_sub(y,x);
+	w = fff_blas_ddot(y,y);
+	
+	if ( w < fff_vector_get(dist,l)){	  
+	  fff_vector_set(dist,l,w);
+	  fff_array_set1d(label,l, lwin);
+	  fff_graph_heap_push(H, l, w);
+	}
+      }
     }
-    win = fff_array_get1d(lg,j);
-    if (win == -1) break;
-    
   }
   fff_array_delete(visited);
   fff_vector_delete(x);
   fff_vector_delete(y);
   fff_matrix_delete(feature);
-  fff_array_delete(cindices);
-  fff_array_delete(neighb);
-  fff_vector_delete(dg);
+  fff_graph_neighb_clear(&NG);
+  fff_graph_heap_delete(H);
   fff_vector_delete(dist);
-  fff_array_delete(lg);
-  fff_vector_delete(weight);
 
   return(ri);
 }
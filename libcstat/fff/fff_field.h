@@ -42,6 +42,11 @@ extern "C" {
     in the graph topology.
     depth[v] = 0 for non-maxima
     0=<depth[v]<rec
+
+    The depths are not computed by iterating over the neighbourhoods:
+    depth[v] is the distance from v to its nearest higher vertex,
+    minus one, which is found after a single sweep over the vertices
+    by decreasing value (see fff_field.c for the stopping rules).
   */
   extern int fff_field_maxima_r(fff_array *depth, const fff_graph* G, const fff_vector* field,  const int rec);
 
@@ -160,6 +165,50 @@ extern "C" {
   */
   extern int fff_field_md_diffusion(fff_matrix *field, const fff_graph* G);
 
+  /*!
+    \brief iterated sparse kernel diffusion
+    \param field field of data that is diffused
+    \param G  graph, explicit or implicit
+    \param niter number of iterations
+    \param nthreads number of threads (see \c fff_threads_count)
+
+    Performs niter iterations of fff_field_diffusion, with the same
+    result, but builds the incoming adjacency of G only once. Each
+    iteration is a sparse matrix-vector product whose rows are shared
+    among \a nthreads threads.
+  */
+  extern int fff_field_diffusion_iter(fff_vector *field, const fff_graph* G, const long niter, int nthreads);
+
+  /*!
+    \brief iterated multi-dimensional sparse kernel diffusion
+    \param field field of data that is diffused, one column per dimension
+    \param G  graph, explicit or implicit
+    \param niter number of iterations
+    \param nthreads number of threads (see \c fff_threads_count)
+
+    Performs niter iterations of fff_field_md_diffusion, as
+    fff_field_diffusion_iter does; all the columns of the field are
+    diffused in the same pass over the edges.
+  */
+  extern int fff_field_md_diffusion_iter(fff_matrix *field, const fff_graph* G, const long niter, int nthreads);
+
+  /*!
+    \brief separable Gaussian smoothing of a field on a set of voxels
+    \param field field of data that is smoothed, one column per dimension
+    \param xyz voxel coordinates, written as in fff_graph_grid_six
+    \param sigma kernel width, in voxels
+    \param nthreads number of threads (see \c fff_threads_count)
+
+    Convolves the field with a Gaussian kernel truncated at 4 sigma,
+    by passes along x, y and z. Each pass is normalized by the kernel
+    mass within the voxels of its line, so that voxels near the border
+    of the set are averaged over their neighbours only, and constant
+    fields are left unchanged. The cost is linear in sigma, and the
+    lines of each pass are shared among \a nthreads threads; the
+    result does not depend on nthreads. Returns 1 if memory is lacking.
+  */
+  extern int fff_field_gaussian_smoothing(fff_matrix* field, const long* xyz, const double sigma, int nthreads);
+
     /*!
     \brief morphological dilation of the field of 1 unit
     \param field field of data that is diffused
@@ -167,7 +216,16 @@ extern "C" {
     \param rec (topological) radius of the dilation
 
     Interpreting the graph G as a sparse kernel, the algorithm
-    performs one iteration of dilation on the field data.
+    performs rec iterations of dilation on the field data: each vertex
+    takes the maximum of its value and of those of its neighbours.
+
+    After the first iteration, only the vertices with a neighbour
+    changed by the previous iteration are revisited. On implicit
+    26-neighbour grid graphs that fill their bounding box, the
+    iterations amount to a maximum over a cube of radius rec, which is
+    computed by separable van Herk / Gil-Werman filters whose cost
+    does not depend on rec (unless the field contains NaN, which
+    stays in place and stops the propagation).
   */
   extern int fff_field_dilation(fff_vector *field, const fff_graph* G, const int rec);
 
@@ -178,7 +236,8 @@ extern "C" {
     \param rec (topological) radius of the erosion
     
     Interpreting the graph G as a sparse kernel, the algorithm
-    performs an erosion of radius rec on the field data.
+    performs an erosion of radius rec on the field data; it is computed
+    as fff_field_dilation, with minima instead of maxima.
   */
   extern int fff_field_erosion(fff_vector *field, const fff_graph* G, const int rec);
 
@@ -218,6 +277,10 @@ extern "C" {
     Label is of size field->size
     Note that bassins are defined as zones around maxima, 
     unlike the usual intuition.
+
+    The depth of a maximum is the number of dilations it survives;
+    after the first one, only the vertices next to a vertex changed
+    by the previous dilation are revisited.
   */
   extern int fff_custom_watershed(fff_array **idx, fff_array **depth, fff_array **major, fff_array *label, const fff_vector *field, const fff_graph* G);
 
@@ -241,23 +304,52 @@ extern "C" {
 
   
 /*!
-    \brief customized watershed analysis of the field, with only supra-threshold parts considered
-    \param idx gives the indices of the maxima in each bassin
-    \param depth gives the (topological) depth of these maxima
-    \param major gives the index of the nearest dominating maximum
-    \param label is a labelling of the vertices according to the watershed bassins
-    \param field field of data that is diffused
+    \brief bifurcations of the level sets of the field, with only supra-threshold parts considered
+    \param Idx gives the vertex at which each level set appears
+    \param Height gives the field value at which each level set appears
+    \param Father gives the level set in which each level set is merged (itself for the roots)
+    \param label is a labelling of the vertices according to the level sets, -1 below th
+    \param field field of data
     \param G  graph
     \param th threshold
     
-    The number q of bassins is returned.
-    the first three vectors (idx,depth,major) are of size q.
+    The number q of level sets is returned.
+    the first three vectors (Idx,Height,Father) are of size q.
     Label is of size field->size
-    Note that bassins are defined as zones around maxima, 
-    unlike the usual intuition.
+
+    The vertices are swept once by decreasing value, and the level
+    sets are merged by union-find, so that the cost is O(V log V + E)
+    up to an inverse Ackermann factor. Father describes the
+    persistence hierarchy of the maxima.
   */
   extern long fff_field_bifurcations(fff_array **Idx, fff_vector **Height, fff_array **Father, fff_array* label,  const fff_vector *field, const fff_graph* G, const double th);
 
+/*!
+    \brief supra-threshold clusters of the field for several thresholds
+    \param Th gives the index of the threshold of each cluster
+    \param Size gives the number of vertices of each cluster
+    \param Mass gives the sum of the field values minus the threshold over each cluster
+    \param Peak gives the vertex of each cluster with the largest field value
+    \param label is a (V, number of thresholds) labelling of the vertices
+    according to the clusters of each threshold, -1 below it; may be NULL
+    \param field field of data
+    \param G  graph
+    \param th thresholds, in any order
+
+    The clusters of a threshold are the connected components of the
+    vertices whose value is strictly above it. They are given
+    threshold by threshold, in the order of \a th, and by decreasing
+    peak value for each threshold; labels are numbered in the same
+    order, starting from 0 for each threshold.
+
+    The total number q of clusters is returned, -1 on error. The
+    four output arrays are of size q.
+
+    The vertices are swept once by decreasing value, whatever the
+    number of thresholds, and the clusters are grown by union-find.
+  */
+  extern long fff_field_threshold_clusters(fff_array **Th, fff_array **Size, fff_vector **Mass, fff_array **Peak, fff_array* label, const fff_vector *field, const fff_graph* G, const fff_vector *th);
+
   /*!
     \brief Voronoi parcellation of the field structure, starting from given seed
 	
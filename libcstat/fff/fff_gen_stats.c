@@ -28,18 +28,26 @@ extern void fff_permutation(unsigned int* x, unsigned int n, unsigned long magic
     m = m / nc; 
     j = ir + i; 
 
-    /* Move x[j] to i-th index and shift indices in range [i..j[ to
-       the right */ 
+    /* Swap x[i] and x[j] */ 
     tmp = x[j]; 
-    xi = x + i; 
-    memmove((void*)(xi+1), (void*)xi, ir*sizeof(unsigned int));
-    *xi = tmp; 
+    x[j] = x[i]; 
+    x[i] = tmp; 
     
   }
  
   return; 
 }
 
+extern void fff_permutations(unsigned int* x, unsigned int n, unsigned long magic, unsigned int m)
+{
+  unsigned int i; 
+
+  for (i=0; i<m; i++, x+=n)
+    fff_permutation(x, n, magic+i); 
+
+  return; 
+}
+
 
 /*
   Generate a random combination of k elements in [0..n-1]. 
@@ -70,16 +78,19 @@ extern void fff_combination(unsigned int* x, unsigned int k, unsigned int n, uns
   /* Ensure 0 <= magic < Cn,k */ 
   c = _combinations(k, n); 
   m = magic % c; 
+  if (k == 0)
+    return; 
 
-  /* Loop. At the beginning of each iteration, c == Cn-(i+1),k-(i+1). */
+  /* Loop. At the beginning of each iteration, c == Cnn,kk. Its
+     successor C(nn-1),(kk-1) is updated rather than recomputed, so
+     that the loop takes O(n) operations. */
   i = 0; 
   kk = k; 
   nn = n; 
-  kk = k; 
-  while( kk > 0 ) {
+  while( (kk > 0) && (nn > 0) ) {
 
+    c = c*kk/nn; 
     nn --;
-    c = _combinations(kk-1, nn); 
  
     /* If i is accepted, then store it and do: kk-- */
     if ( m < c ) {
@@ -87,8 +98,11 @@ extern void fff_combination(unsigned int* x, unsigned int k, unsigned int n, uns
       bx ++; 
       kk --; 
     }
-    else
+    else {
       m = m - c; 
+      /* Cnn,kk = Cnn,(kk-1) * (nn-kk+1) / kk */
+      c = c*(nn-kk+1)/kk; 
+    }
 
      /* Next candidate */ 
     i ++; 
@@ -98,6 +112,16 @@ extern void fff_combination(unsigned int* x, unsigned int k, unsigned int n, uns
   return; 
 }
 
+extern void fff_combinations(unsigned int* x, unsigned int k, unsigned int n, unsigned long magic, unsigned int m)
+{
+  unsigned int i; 
+
+  for (i=0; i<m; i++, x+=k)
+    fff_combination(x, k, n, magic+i); 
+
+  return; 
+}
+
 
 /* 
    Squared mahalanobis distance: d2 = x' S^-1 x 
@@ -39,18 +39,40 @@ extern "C" {
 	\param seed initial state of the random number generator
 
 	\a x needs is assumed contiguous, pre-allocated with size \a n. 
+	Every \a magic in [0..n![ gives a different permutation, which
+	is computed in O(n) operations.
   */
   extern void fff_permutation(unsigned int* x, unsigned int n, unsigned long magic);
 
+  /*
+    \brief Generate the \a m permutations of magic numbers \a magic
+    to \a magic+m-1
+
+    \a x must be contiguous, pre-allocated with size \a m*n; the
+    i-th permutation is stored in \a x[i*n..(i+1)*n-1].
+  */
+  extern void fff_permutations(unsigned int* x, unsigned int n, unsigned long magic, unsigned int m);
+
 
   /*
     \brief Generate a random combination of \a k elements in \a [0..n-1].   
  
     \a x must be contiguous, pre-allocated with size \a k. By
-    convention, elements are output in ascending order.
+    convention, elements are output in ascending order. Combinations
+    are enumerated in lexicographic order of magic numbers modulo
+    Cn,k, and computed in O(n) operations.
   */
   extern void fff_combination(unsigned int* x, unsigned int k, unsigned int n, unsigned long magic); 
 
+  /*
+    \brief Generate the \a m combinations of magic numbers \a magic
+    to \a magic+m-1
+
+    \a x must be contiguous, pre-allocated with size \a m*k; the
+    i-th combination is stored in \a x[i*k..(i+1)*k-1].
+  */
+  extern void fff_combinations(unsigned int* x, unsigned int k, unsigned int n, unsigned long magic, unsigned int m); 
+
 #ifdef __cplusplus
 }
 #endif
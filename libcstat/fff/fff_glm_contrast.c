@@ -0,0 +1,305 @@
+#include "fff_glm_contrast.h"
+#include "fff_blas.h"
+#include "fff_lapack.h"
+#include "fff_threads.h"
+#include "fff_base.h"
+
+#include <stdlib.h>
+#include <math.h>
+#include <errno.h>
+
+
+/* Number of voxels whose contrasts are evaluated by one matrix
+   product */
+#define FFF_GLM_CONTRAST_BLOCK 128
+
+/* The rank-th worker processes the rank-th range of blocks of
+   voxels. The contrast variances of the j-th contrast and the k-th
+   variance matrix start at factor[K*foffset[j]+k*q*q], where q is the
+   number of rows of the contrast, and are Cholesky factors if q>1
+   and info[j*K+k] is zero. With voxelwise variances, each worker
+   computes its own table for each block. */
+typedef struct {
+  fff_matrix* T;
+  const fff_matrix* B;
+  const fff_vector* s2;
+  const fff_matrix* VB;
+  const long* label;
+  const fff_matrix* C;
+  const size_t* offset;        /* ncon+1 first rows of the contrasts in C */
+  const size_t* foffset;       /* ncon offsets of the tables of each contrast, per variance matrix */
+  const double* factor;        /* NULL with voxelwise variances */
+  const int* info;
+  size_t ncon;
+  size_t maxq;
+  double tiny;
+  int* error;                  /* nthreads flags */
+} _fff_glm_contrast_job;
+
+
+/* Symmetric (q, q) matrix m = c vb c^t, where c holds q rows of
+   stride tdc and vb is a (p, p) matrix in row-major order */
+static void _fff_glm_contrast_variance(double* m, const double* c, size_t tdc,
+				       const double* vb, size_t q, size_t p, double* aux)
+{
+  size_t i, r, k, l;
+  const double* ci;
+  double s;
+
+  for (i=0 ; i<q ; i++){
+    ci = c + i*tdc;
+    for (l=0 ; l<p ; l++){
+      s = 0.0;
+      for (k=0 ; k<p ; k++)
+	s += ci[k]*vb[k*p+l];
+      aux[i*p+l] = s;
+    }
+  }
+  for (i=0 ; i<q ; i++)
+    for (r=0 ; r<=i ; r++){
+      s = 0.0;
+      for (l=0 ; l<p ; l++)
+	s += aux[i*p+l]*c[r*tdc+l];
+      m[i*q+r] = s;
+      m[r*q+i] = s;
+    }
+}
+
+/* Contrast variance tables of the K rows of VB, see
+   _fff_glm_contrast_job */
+static void _fff_glm_contrast_factors(double* factor, int* info, const fff_matrix* VB,
+				      const fff_matrix* C, const size_t* offset, size_t ncon,
+				      double* aux)
+{
+  size_t K = VB->size1, p = C->size2;
+  size_t j, k, q;
+  double* f = factor;
+  fff_matrix F;
+  fff_array I;
+
+  for (j=0 ; j<ncon ; j++){
+    q = offset[j+1] - offset[j];
+    for (k=0 ; k<K ; k++)
+      _fff_glm_contrast_variance(f + k*q*q, C->data + offset[j]*C->tda, C->tda,
+				 VB->data + k*VB->tda, q, p, aux);
+    if (q > 1){
+      F = fff_matrix_view(f, K, q*q, q*q);
+      I = fff_array_view1d(FFF_INT, info + j*K, K, 1);
+      fff_lapack_chol_batch(&F, NULL, &I);
+    }
+    else
+      for (k=0 ; k<K ; k++)
+	info[j*K+k] = 0;
+    f += K*q*q;
+  }
+}
+
+static void _fff_glm_contrast_job_run(int rank, int nthreads, void* params)
+{
+  _fff_glm_contrast_job* job = (_fff_glm_contrast_job*)params;
+  const fff_matrix* B = job->B;
+  const fff_matrix* C = job->C;
+  const size_t* offset = job->offset;
+  size_t p = B->size1, V = B->size2, Q = C->size1, ncon = job->ncon;
+  size_t nblocks = (V + FFF_GLM_CONTRAST_BLOCK - 1)/FFF_GLM_CONTRAST_BLOCK;
+  size_t start, stop, blk, v0, nb, j, b, i, l, q, k, K;
+  const double *factor, *f, *L, *e;
+  const int *info, *inf;
+  double *lfactor = NULL, *aux = NULL, *y = NULL, *t;
+  int* linfo = NULL;
+  double s, r, ssd;
+  fff_matrix* E;
+  fff_matrix Bb, Eb, VBb;
+
+  fff_parallel_range(nblocks, rank, nthreads, &start, &stop);
+  E = fff_matrix_new(Q, FFF_GLM_CONTRAST_BLOCK);
+  y = (double*) malloc(job->maxq*sizeof(double));
+  if (job->factor == NULL){
+    lfactor = (double*) malloc(FFF_GLM_CONTRAST_BLOCK*job->foffset[ncon]*sizeof(double));
+    linfo = (int*) malloc(FFF_GLM_CONTRAST_BLOCK*ncon*sizeof(int));
+    aux = (double*) malloc(job->maxq*p*sizeof(double));
+  }
+  if ((E == NULL) || (y == NULL) ||
+      ((job->factor == NULL) && ((lfactor == NULL) || (linfo == NULL) || (aux == NULL)))){
+    FFF_ERROR("Out of memory", ENOMEM);
+    job->error[rank] = 1;
+    start = stop;
+  }
+  factor = job->factor;
+  info = job->info;
+  K = job->VB->size1;
+
+  for (blk=start ; blk<stop ; blk++){
+    v0 = blk*FFF_GLM_CONTRAST_BLOCK;
+    nb = FFF_MIN(FFF_GLM_CONTRAST_BLOCK, V-v0);
+
+    /* Contrast effects of the block */
+    Bb = fff_matrix_view(B->data + v0, p, nb, B->tda);
+    Eb = fff_matrix_view(E->data, Q, nb, FFF_GLM_CONTRAST_BLOCK);
+    fff_blas_dgemm(CblasNoTrans, CblasNoTrans, 1.0, C, &Bb, 0.0, &Eb);
+
+    /* Voxelwise contrast variances */
+    if (job->factor == NULL){
+      VBb = fff_matrix_view(job->VB->data + v0*job->VB->tda, nb, p*p, job->VB->tda);
+      _fff_glm_contrast_factors(lfactor, linfo, &VBb, C, offset, ncon, aux);
+      factor = lfactor;
+      info = linfo;
+      K = nb;
+    }
+
+    for (j=0 ; j<ncon ; j++){
+      q = offset[j+1] - offset[j];
+      e = Eb.data + offset[j]*FFF_GLM_CONTRAST_BLOCK;
+      f = factor + K*job->foffset[j];
+      inf = info + j*K;
+      t = job->T->data + j*job->T->tda + v0;
+      for (b=0 ; b<nb ; b++){
+	if (job->label != NULL)
+	  k = (size_t)job->label[v0+b];
+	else
+	  k = (K == 1) ? 0 : b;
+	s = job->s2->data[(v0+b)*job->s2->stride];
+
+	/* Student statistic */
+	if (q == 1){
+	  t[b] = e[b] / sqrt(FFF_MAX(s*f[k], job->tiny));
+	  continue;
+	}
+
+	/* Fisher statistic: squared norm of y = L^-1 Cb */
+	if (inf[k] != 0){
+	  t[b] = FFF_NAN;
+	  continue;
+	}
+	L = f + k*q*q;
+	ssd = 0.0;
+	for (i=0 ; i<q ; i++){
+	  r = e[i*FFF_GLM_CONTRAST_BLOCK+b];
+	  for (l=0 ; l<i ; l++)
+	    r -= L[i*q+l]*y[l];
+	  y[i] = r / L[i*q+i];
+	  ssd += y[i]*y[i];
+	}
+	t[b] = ssd / ((double)q*FFF_MAX(s, job->tiny));
+      }
+    }
+  }
+
+  if (E != NULL)
+    fff_matrix_delete(E);
+  free(y);
+  free(lfactor);
+  free(linfo);
+  free(aux);
+}
+
+
+int fff_glm_contrast_stats(fff_matrix* T, const fff_matrix* B, const fff_vector* s2,
+			   const fff_matrix* VB, const fff_array* label,
+			   const fff_matrix* C, const fff_array* dim,
+			   double tiny, int nthreads)
+{
+  size_t p = B->size1, V = B->size2, K = VB->size1, ncon = dim->dimX;
+  size_t nblocks = (V + FFF_GLM_CONTRAST_BLOCK - 1)/FFF_GLM_CONTRAST_BLOCK;
+  size_t j, v, q, maxq = 1;
+  double d;
+  int r, voxelwise, err = 0;
+  long* lab = NULL;
+  size_t *offset, *foffset;
+  double *factor = NULL, *aux = NULL;
+  int* info = NULL;
+  _fff_glm_contrast_job job;
+
+  /* argument checking */
+  if ((VB->size2 != p*p) || (K < 1) || (s2->size != V) || (C->size2 != p) ||
+      (T->size1 != ncon) || (T->size2 != V) ||
+      ((label == NULL) && (K != 1) && (K != V)) ||
+      ((label != NULL) && (label->dimX != V))){
+    FFF_WARNING("Incompatible dimensions");
+    return(1);
+  }
+  if ((ncon == 0) || (V == 0))
+    return(0);
+  voxelwise = (label == NULL) && (K == V) && (K > 1);
+
+  offset = (size_t*) calloc(ncon+1, sizeof(size_t));
+  foffset = (size_t*) calloc(ncon+1, sizeof(size_t));
+  if (label != NULL)
+    lab = (long*) calloc(FFF_MAX(V,1), sizeof(long));
+  job.error = (int*) calloc(FFF_MAX(nblocks,1), sizeof(int));
+  if ((offset == NULL) || (foffset == NULL) || ((label != NULL) && (lab == NULL)) ||
+      (job.error == NULL)){
+    FFF_ERROR("Out of memory", ENOMEM);
+    err = 1;
+  }
+
+  /* Rows of the contrasts and offsets of their variance tables */
+  for (j=0 ; (j<ncon) && (!err) ; j++){
+    d = fff_array_get1d(dim, j);
+    if (!(d >= 1)){
+      FFF_WARNING("Contrasts must have at least one row");
+      err = 1;
+      break;
+    }
+    q = (size_t)d;
+    maxq = FFF_MAX(maxq, q);
+    offset[j+1] = offset[j] + q;
+    foffset[j+1] = foffset[j] + q*q;
+  }
+  if ((!err) && (offset[ncon] != C->size1)){
+    FFF_WARNING("Contrast dimensions do not match the contrast matrix");
+    err = 1;
+  }
+  for (v=0 ; (v<V) && (lab != NULL) && (!err) ; v++){
+    d = fff_array_get1d(label, v);
+    if ((d < 0) || (d >= (double)K)){
+      FFF_WARNING("Label out of range");
+      err = 1;
+    }
+    lab[v] = (long)d;
+  }
+
+  /* Contrast variances shared by several voxels are factored once */
+  if ((!voxelwise) && (!err)){
+    factor = (double*) malloc(FFF_MAX(K*foffset[ncon],1)*sizeof(double));
+    info = (int*) malloc(FFF_MAX(K*ncon,1)*sizeof(int));
+    aux = (double*) malloc(maxq*p*sizeof(double));
+    if ((factor == NULL) || (info == NULL) || (aux == NULL)){
+      FFF_ERROR("Out of memory", ENOMEM);
+      err = 1;
+    }
+    else
+      _fff_glm_contrast_factors(factor, info, VB, C, offset, ncon, aux);
+  }
+
+  if (!err){
+    nthreads = fff_threads_count(nthreads);
+    if ((size_t)nthreads > nblocks)
+      nthreads = (int)FFF_MAX(nblocks, 1);
+    job.T = T;
+    job.B = B;
+    job.s2 = s2;
+    job.VB = VB;
+    job.label = lab;
+    job.C = C;
+    job.offset = offset;
+    job.foffset = foffset;
+    job.factor = factor;
+    job.info = info;
+    job.ncon = ncon;
+    job.maxq = maxq;
+    job.tiny = tiny;
+    fff_parallel_run(nthreads, &_fff_glm_contrast_job_run, (void*)&job);
+    for (r=0 ; r<nthreads ; r++)
+      err = err || job.error[r];
+  }
+
+  free(offset);
+  free(foffset);
+  free(lab);
+  free(job.error);
+  free(factor);
+  free(info);
+  free(aux);
+  return(err);
+}
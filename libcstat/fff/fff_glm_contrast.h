@@ -0,0 +1,68 @@
+/*!
+  \file fff_glm_contrast.h
+  \brief Statistics of linear contrasts of fitted general linear models
+  \date 2009
+
+  Given the effects \f$ b \f$ of a general linear model fitted in V
+  voxels, their normalized variance matrices \f$ V_b \f$ and scale
+  parameters \f$ s^2 \f$, the Student statistic of a contrast vector
+  \a c is \f$ t = c^t b / \sqrt{s^2 c^t V_b c} \f$, and the Fisher
+  statistic of a (q, p) contrast matrix \a C is \f$ F = (Cb)^t (s^2
+  C V_b C^t)^{-1} (Cb) / q \f$, see nipy.neurospin.glm.glm.contrast.
+
+  All the contrasts of a model are evaluated in one pass over blocks
+  of voxels, which are shared among threads. The variance matrices
+  may be common to all voxels (ordinary least squares), to groups of
+  voxels (e.g. binned AR(1) models), or voxelwise; in the first two
+  cases, the contrast variances are factored once per group.
+*/
+
+#ifndef FFF_GLM_CONTRAST
+#define FFF_GLM_CONTRAST
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "fff_array.h"
+#include "fff_vector.h"
+#include "fff_matrix.h"
+
+  /*!
+    \brief Statistics of a stack of contrasts
+    \param T (number of contrasts, V) output statistics
+    \param B (p, V) effects, one column per voxel
+    \param s2 scale parameters (V)
+    \param VB (K, p*p) normalized variance matrices of the effects, one per row
+    \param label group of each voxel in [0..K-1] (V); may be NULL if K is 1 or V
+    \param C (Q, p) rows of the contrasts, stacked
+    \param dim number of rows of each contrast in \a C, summing to Q
+    \param tiny lower bound of the Student variances and of the scale parameters
+    \param nthreads number of threads (see \c fff_threads_count)
+
+    Contrasts of one row yield Student statistics, with the variance
+    \f$ s^2 c^t V_b c \f$ bounded below by \a tiny, as in
+    nipy.neurospin.glm.glm.contrast. Contrasts of several rows yield
+    Fisher statistics from the Cholesky factor of \f$ C V_b C^t \f$,
+    with \f$ s^2 \f$ bounded below by \a tiny; the statistic is NaN
+    where \f$ C V_b C^t \f$ is not positive definite.
+
+    If \a label is NULL and K is V, the variance matrix of the v-th
+    voxel is the v-th row of \a VB, and the contrast variances are
+    factored block by block. Otherwise, they are factored once for
+    each of the K matrices. The blocks of voxels do not depend on the
+    number of threads, nor does the result.
+
+    Returns 0, or 1 if the arguments are inconsistent or memory is
+    lacking.
+  */
+  extern int fff_glm_contrast_stats(fff_matrix* T, const fff_matrix* B, const fff_vector* s2,
+				    const fff_matrix* VB, const fff_array* label,
+				    const fff_matrix* C, const fff_array* dim,
+				    double tiny, int nthreads);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -1,9 +1,11 @@
 #include "fff_glm_kalman.h"
 #include "fff_base.h"
 #include "fff_blas.h"
+#include "fff_lapack.h"
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <math.h>
 
 /* Declaration of static functions */
 static void _fff_glm_RKF_iterate_Vb( fff_matrix* Vb, const fff_matrix* Vb0, const fff_matrix* Hspp, 
@@ -298,12 +300,15 @@ void fff_glm_KF_fit( fff_glm_KF* thisone,
     return;
 
   /* Loop */
+  FFF_PROFILE_BEGIN(FFF_PROFILE_GLM_KF); 
   for( i=0; i<y->size; i++, yi+=y->stride, offset_xi+=X->tda ) {
     /* Get the i-th row of the design matrix */
     xi.data = X->data + offset_xi;
     /* Iterate the Kalman filter */
     fff_glm_KF_iterate( thisone, *yi, &xi );
   }
+  FFF_PROFILE_END(FFF_PROFILE_GLM_KF); 
+  FFF_PROFILE_COUNT(FFF_PROFILE_VOXELS, 1); 
 
   /* DOF */ 
   thisone->dof = (double)(y->size - X->size2); 
@@ -364,6 +369,180 @@ void fff_glm_RKF_fit( fff_glm_RKF* thisone,
 }
 
 
+fff_glm_OLS* fff_glm_OLS_new( const fff_matrix* X )
+{
+  fff_glm_OLS* thisone;
+  fff_matrix *XtX, *Aux; 
+  size_t n = X->size1, dim = X->size2;
+  
+  /* Start with allocating the object */
+  thisone = (fff_glm_OLS*) calloc( 1, sizeof(fff_glm_OLS) );
+  
+  /* Checks that the pointer has been allocated */
+  if ( thisone == NULL) 
+    return NULL; 
+
+  /* Allocate OLS objects */
+  thisone->PX = fff_matrix_new( dim, n ); 
+  thisone->Vb = fff_matrix_new( dim, dim ); 
+  XtX = fff_matrix_new( dim, dim ); 
+  Aux = fff_matrix_new( dim, dim ); 
+
+  /* Initialization */
+  thisone->n = n; 
+  thisone->dim = dim; 
+  thisone->dof = (double)(n - dim); 
+
+  /* The Kalman filter starts from a scalar variance matrix, hence
+     after the last time frame: Vb = inv(X'*X + Id/FFF_GLM_KALMAN_INIT_VAR) */
+  fff_matrix_set_scalar( XtX, 1/FFF_GLM_KALMAN_INIT_VAR ); 
+  fff_blas_dgemm( CblasTrans, CblasNoTrans, 1.0, X, X, 1.0, XtX ); 
+
+  /* Cholesky decomposition: XtX = L L^t, L lower triangular, then
+     Vb = L^-t L^-1 */ 
+  fff_lapack_dpotrf( CblasLower, XtX, Aux ); 
+  fff_matrix_set_scalar( thisone->Vb, 1.0 ); 
+  fff_blas_dtrsm( CblasLeft, CblasLower, CblasNoTrans, CblasNonUnit, 1.0, XtX, thisone->Vb ); 
+  fff_blas_dtrsm( CblasLeft, CblasLower, CblasTrans, CblasNonUnit, 1.0, XtX, thisone->Vb ); 
+
+  /* Pseudo-inverse: PX = Vb*X' */
+  fff_blas_dgemm( CblasNoTrans, CblasTrans, 1.0, thisone->Vb, X, 0.0, thisone->PX ); 
+
+  fff_matrix_delete( XtX ); 
+  fff_matrix_delete( Aux ); 
+
+  return thisone; 
+}
+
+
+void fff_glm_OLS_delete( fff_glm_OLS* thisone )
+{
+  if ( thisone != NULL ) {
+    if ( thisone->PX != NULL ) fff_matrix_delete(thisone->PX);
+    if ( thisone->Vb != NULL ) fff_matrix_delete(thisone->Vb);
+    free( thisone );
+  }
+
+  return;
+}
+
+
+void fff_glm_OLS_fit( const fff_glm_OLS* thisone,
+		      fff_matrix* B,
+		      fff_vector* s2,
+		      const fff_matrix* Y,
+		      const fff_matrix* X, 
+		      fff_matrix* R )
+{
+  size_t i; 
+  double ssd; 
+  fff_vector r, b; 
+
+  /* Tests */
+  if ( (Y->size2 != thisone->n) || (X->size1 != thisone->n) )
+    return;
+
+  /* Effects: B = Y*PX' */ 
+  fff_blas_dgemm( CblasNoTrans, CblasTrans, 1.0, Y, thisone->PX, 0.0, B ); 
+
+  /* Residuals: R = Y - B*X' */ 
+  fff_matrix_memcpy( R, Y ); 
+  fff_blas_dgemm( CblasNoTrans, CblasTrans, -1.0, B, X, 1.0, R ); 
+
+  /* Scales. The Kalman sum of squares also accounts for the initial
+     variance matrix: ssd = |r|^2 + |b|^2/FFF_GLM_KALMAN_INIT_VAR */ 
+  for ( i=0; i<Y->size1; i++ ) {
+    r = fff_matrix_row( R, i ); 
+    b = fff_matrix_row( B, i ); 
+    ssd = fff_blas_ddot( &r, &r ) + fff_blas_ddot( &b, &b )/FFF_GLM_KALMAN_INIT_VAR; 
+    fff_vector_set( s2, i, ssd/(double)thisone->n ); 
+  }
+
+  return; 
+}
+
+
+void fff_glm_ar1_estimate( fff_vector* a, const fff_matrix* R )
+{
+  size_t i, t, n = R->size2; 
+  double ssd, spp, cor; 
+  double *r; 
+
+  /* Bias correction factor, see fff_glm_RKF_iterate */
+  cor = (n > 1) ? (double)n / (double)(n - 1) : 1.0; 
+
+  for ( i=0; i<R->size1; i++ ) {
+    r = R->data + i*R->tda; 
+    ssd = FFF_SQR( r[0] ); 
+    spp = 0.0; 
+    for ( t=1; t<n; t++ ) {
+      ssd += FFF_SQR( r[t] ); 
+      spp += r[t]*r[t-1]; 
+    }
+    fff_vector_set( a, i, cor*spp / FFF_ENSURE_POSITIVE(ssd) ); 
+  }
+
+  return; 
+}
+
+
+void fff_glm_ar1_whiten( fff_matrix* A, double a )
+{
+  size_t i, t, n = A->size2; 
+  double c = sqrt( 1 - FFF_SQR(a) ); 
+  double *y; 
+
+  if ( n == 0 )
+    return; 
+
+  for ( i=0; i<A->size1; i++ ) {
+    y = A->data + i*A->tda; 
+    /* Backwards so that y[t-1] is still the original sample */ 
+    for ( t=n-1; t>0; t-- ) 
+      y[t] -= a*y[t-1]; 
+    y[0] *= c; 
+  }
+
+  return; 
+}
+
+
+void fff_glm_KF_iterate_batch( fff_matrix* B,
+			       fff_vector* ssd,
+			       fff_matrix* Vb,
+			       const fff_vector* y,
+			       const fff_vector* x,
+			       fff_vector* Cby,
+			       fff_vector* ino )
+{
+  size_t i; 
+  double Vy, invVy, *bufino, *bufssd; 
+
+  /* Measurement variance conditional to the effect, common to all signals */ 
+  fff_blas_dsymv( CblasUpper, 1.0, Vb, x, 0.0, Cby );
+  Vy = fff_blas_ddot( x, Cby ) + 1.0; 
+  invVy = 1/Vy;
+
+  /* Innovations: ino = y - B'*x */ 
+  fff_vector_memcpy( ino, y ); 
+  fff_blas_dgemv( CblasTrans, -1.0, B, x, 1.0, ino ); 
+
+  /* Update effect estimates: B = B + invVy*Cby*ino' */
+  fff_blas_dger( invVy, Cby, ino, B ); 
+
+  /* Update effect variance matrix: Vb = Vb - invVy*Cby*Cby' */
+  fff_blas_dger( -invVy, Cby, Cby, Vb ); 
+
+  /* Update sums of squares */
+  bufino = ino->data; 
+  bufssd = ssd->data; 
+  for ( i=0; i<ssd->size; i++, bufino+=ino->stride, bufssd+=ssd->stride )
+    *bufssd += FFF_SQR(*bufino)*invVy; 
+
+  return; 
+}
+
+
 /* Compute: Vb = aux1 * ( Id + aux1*aux2*Vb0*Hspp ) * Vb0
    This corresponds to a simplification as the exact update formula would be:
    Vb = aux1 * pinv( eye(p) - aux1*aux2*Vbd*He ) * Vbd
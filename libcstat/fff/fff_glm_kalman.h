@@ -20,6 +20,15 @@
   autoregressive AR(1) model. Significantly more memory demanding than
   the standard KF.
 
+  A batched solver, fff_glm_OLS, yields the standard Kalman filter
+  estimates at the last time frame for many signals at once, using
+  matrix-matrix products. Combined with AR(1) whitening, it also
+  fits signals sharing the same autocorrelation at once.
+
+  fff_glm_KF_iterate_batch performs one standard Kalman iteration for
+  many signals sharing the same design, e.g. all the voxels of a
+  newly acquired volume, so that the estimates can be updated online.
+
   */
 
 
@@ -82,6 +91,27 @@ extern "C" {
     fff_matrix* Maux;       /*!< auxiliary matrix */
 
   } fff_glm_RKF;
+
+
+  /*! 
+    \struct fff_glm_OLS
+    \brief Batched ordinary least squares structure.
+
+    Holds the data independent quantities of the standard Kalman
+    filter at the last time frame, namely the effect variance matrix
+    \f$ V_b = (X^t X + \lambda I)^{-1} \f$ with \f$ \lambda \f$ the
+    inverse of FFF_GLM_KALMAN_INIT_VAR, and the corresponding
+    pseudo-inverse \f$ V_b X^t \f$ of the design matrix.
+  */
+  typedef struct{
+
+    size_t n;                /*!< number of time frames */
+    size_t dim;              /*!< model dimension (i.e. number of linear regressors) */
+    fff_matrix* PX;          /*!< pseudo-inverse of the design matrix (dim x n) */
+    fff_matrix* Vb;          /*!< effect variance matrix before multiplication by scale */
+    double dof;              /*!< degrees of freedom */
+
+  } fff_glm_OLS;
   
   
   /*! \brief Constructor for the fff_glm_KF structure 
@@ -149,6 +179,78 @@ extern "C" {
 			       const fff_vector* y,
 			       const fff_matrix* X );
 
+  /*! \brief Constructor for the fff_glm_OLS structure 
+      \param X design matrix (column-wise stored covariates)
+  */
+  extern fff_glm_OLS* fff_glm_OLS_new( const fff_matrix* X );
+  /*! \brief Destructor for the fff_glm_OLS structure
+      \param thisone the fff_glm_OLS structure to be deleted
+  */
+  extern void fff_glm_OLS_delete( fff_glm_OLS* thisone );
+  /*!  
+    \brief Perform ordinary least square regressions of several
+    signals at once
+    \param thisone the fff_glm_OLS structure built from \a X
+    \param B output effects, one signal per row (m x dim)
+    \param s2 output scale parameters (size m)
+    \param Y input data, one signal per row (m x n)
+    \param X design matrix (column-wise stored covariates)
+    \param R auxiliary matrix for the residuals (m x n)
+
+    Outputs the same effects and scales as fff_glm_KF_fit applied to
+    each row of \a Y, using two matrix-matrix products instead of
+    one rank-one update per time frame.
+  */
+  extern void fff_glm_OLS_fit( const fff_glm_OLS* thisone,
+			       fff_matrix* B,
+			       fff_vector* s2,
+			       const fff_matrix* Y,
+			       const fff_matrix* X,
+			       fff_matrix* R );
+
+  /*!  
+    \brief Estimate the AR(1) autocorrelation of several signals 
+    \param a output autocorrelation estimates (size m)
+    \param R input residuals, one signal per row (m x n)
+
+    Uses the same bias corrected estimate as the refined Kalman filter.
+  */
+  extern void fff_glm_ar1_estimate( fff_vector* a, const fff_matrix* R );
+  /*!  
+    \brief Whiten several signals according to an AR(1) model
+    \param A signals to be whitened in place, one signal per row
+    \param a autocorrelation parameter, such that |a|<1
+
+    The first sample is scaled by \f$ \sqrt{1-a^2} \f$ and the
+    others are replaced with \f$ y_t - a y_{t-1} \f$, so that the
+    whitened noise has the innovation variance.
+  */
+  extern void fff_glm_ar1_whiten( fff_matrix* A, double a );
+
+  /*!  
+    \brief Performs a standard Kalman iteration for several signals at once
+    \param B effects, one column per signal (dim x m)
+    \param ssd sums of squared residuals (size m)
+    \param Vb effect variance matrix before multiplication by scale (dim x dim)
+    \param y current signal samples (size m)
+    \param x current regressor values (size dim)
+    \param Cby auxiliary vector (size dim)
+    \param ino auxiliary vector for the innovations (size m)
+
+    Since the effect variance matrix does not depend on the data, it
+    is shared by all signals, so that the update of \a B and \a Vb
+    only involves rank-one products, as in fff_glm_KF_iterate. \a B,
+    \a ssd and \a Vb should be initialized as in fff_glm_KF_new. The
+    time counter is left to the caller.
+  */
+  extern void fff_glm_KF_iterate_batch( fff_matrix* B,
+					fff_vector* ssd,
+					fff_matrix* Vb,
+					const fff_vector* y,
+					const fff_vector* x,
+					fff_vector* Cby,
+					fff_vector* ino );
+
 
 
 #ifdef __cplusplus
@@ -36,11 +36,14 @@ fff_glm_twolevel_EM* fff_glm_twolevel_EM_new(size_t n, size_t p)
   thisone->n = n; 
   thisone->p = p;
   thisone->s2 = FFF_POSINF;
+  thisone->niter = 0; 
+  thisone->tol = 0.0; 
   
   thisone->b = fff_vector_new(p); 
   thisone->z = fff_vector_new(n); 
   thisone->vz = fff_vector_new(n); 
   thisone->Qz = fff_vector_new(n);
+  thisone->bprev = fff_vector_new(p); 
 
   return thisone;   
 }
@@ -53,6 +56,7 @@ void fff_glm_twolevel_EM_delete(fff_glm_twolevel_EM* thisone)
   fff_vector_delete(thisone->z);
   fff_vector_delete(thisone->vz); 
   fff_vector_delete(thisone->Qz);  
+  fff_vector_delete(thisone->bprev);  
   free(thisone); 
 }
 
@@ -69,13 +73,19 @@ void fff_glm_twolevel_EM_run(fff_glm_twolevel_EM* em, const fff_vector* y, const
 			     const fff_matrix* X, const fff_matrix* PpiX, unsigned int niter)
 {
   unsigned int iter = 0;
-  size_t n=X->size1, i;
+  size_t n=X->size1, i, j;
   double *yi, *zi, *vyi, *vzi; 
-  double w1, w2; 
+  double w1, w2, s2prev, db; 
   double m = 0.0; 
+  int converged = 0; 
+
 
+  while ((iter < niter) && (!converged)) {
 
-  while (iter < niter) {
+    /* Previous estimates */ 
+    s2prev = em->s2; 
+    if (em->tol > 0) 
+      fff_vector_memcpy(em->bprev, em->b); 
 
     /*** E step ***/ 
 
@@ -108,7 +118,190 @@ void fff_glm_twolevel_EM_run(fff_glm_twolevel_EM* em, const fff_vector* y, const
 
     /*** Increment iteration number ***/
     iter ++; 
+
+    /*** Convergence test ***/ 
+    if ((em->tol <= 0) || (s2prev == FFF_POSINF)) 
+      continue; 
+    converged = (FFF_ABS(em->s2-s2prev) <= em->tol*em->s2); 
+    for (j=0; (j<em->p) && converged; j++) {
+      db = em->b->data[j*em->b->stride] - em->bprev->data[j]; 
+      converged = (FFF_SQR(db) <= FFF_SQR(em->tol)*em->s2); 
+    }
   }
+  em->niter = iter; 
+
+  return;
+}
+
+
+fff_glm_twolevel_batch* fff_glm_twolevel_batch_new(size_t m, size_t n, size_t p)
+{
+  fff_glm_twolevel_batch* thisone; 
+
+  thisone = (fff_glm_twolevel_batch*)malloc(sizeof(fff_glm_twolevel_batch)); 
+
+  if (thisone==NULL)
+    return NULL; 
+
+  thisone->m = m; 
+  thisone->n = n; 
+  thisone->p = p;
+  
+  thisone->Y = fff_matrix_new(m, n); 
+  thisone->VY = fff_matrix_new(m, n); 
+  thisone->B = fff_matrix_new(m, p); 
+  thisone->s2 = fff_vector_new(m); 
+  thisone->Z = fff_matrix_new(m, n); 
+  thisone->Qz = fff_matrix_new(m, n); 
+  thisone->Bprev = fff_matrix_new(m, p); 
+  thisone->svz = fff_vector_new(m); 
+  thisone->idx = (size_t*)malloc(m*sizeof(size_t)); 
+
+  return thisone;   
+}
+
+void fff_glm_twolevel_batch_delete(fff_glm_twolevel_batch* thisone)
+{
+  if (thisone==NULL)
+    return; 
+  fff_matrix_delete(thisone->Y); 
+  fff_matrix_delete(thisone->VY); 
+  fff_matrix_delete(thisone->B); 
+  fff_vector_delete(thisone->s2); 
+  fff_matrix_delete(thisone->Z); 
+  fff_matrix_delete(thisone->Qz); 
+  fff_matrix_delete(thisone->Bprev); 
+  fff_vector_delete(thisone->svz); 
+  free(thisone->idx); 
+  free(thisone); 
+}
+
+/* Swap rows i and j of the matrices, and elements i and j of the vectors */  
+static void _fff_glm_twolevel_batch_swap(fff_glm_twolevel_batch* thisone, size_t i, size_t j)
+{
+  fff_vector ri, rj; 
+  double aux; 
+  size_t iaux; 
+
+  ri = fff_matrix_row(thisone->Y, i); 
+  rj = fff_matrix_row(thisone->Y, j); 
+  fff_blas_dswap(&ri, &rj); 
+  ri = fff_matrix_row(thisone->VY, i); 
+  rj = fff_matrix_row(thisone->VY, j); 
+  fff_blas_dswap(&ri, &rj); 
+  ri = fff_matrix_row(thisone->B, i); 
+  rj = fff_matrix_row(thisone->B, j); 
+  fff_blas_dswap(&ri, &rj); 
+
+  aux = thisone->s2->data[i]; 
+  thisone->s2->data[i] = thisone->s2->data[j]; 
+  thisone->s2->data[j] = aux; 
+  iaux = thisone->idx[i]; 
+  thisone->idx[i] = thisone->idx[j]; 
+  thisone->idx[j] = iaux; 
+
+  return; 
+}
+
+void fff_glm_twolevel_batch_run(fff_glm_twolevel_batch* thisone, size_t m, 
+				const fff_matrix* X, const fff_matrix* PpiX, 
+				unsigned int niter, double tol)
+{
+  unsigned int iter = 0; 
+  size_t n = thisone->n, p = thisone->p, active = m, i, j, t; 
+  double *yi, *vyi, *zi, *bi, *bpi, *qi; 
+  double w1, w2, vz, svz, s2, s2prev, db; 
+  int converged; 
+  fff_matrix Za, Qa, Ba, Pa; 
+
+  if (m > thisone->m)
+    return; 
+
+  /* Initialization, see fff_glm_twolevel_EM_init */   
+  for (i=0; i<m; i++) {
+    thisone->idx[i] = i; 
+    fff_vector_set(thisone->s2, i, FFF_POSINF); 
+  }
+  Ba = fff_matrix_block(thisone->B, 0, m, 0, p); 
+  fff_matrix_set_all(&Ba, 0.0); 
+
+  while ((iter < niter) && (active > 0)) {
+
+    Za = fff_matrix_block(thisone->Z, 0, active, 0, n); 
+    Qa = fff_matrix_block(thisone->Qz, 0, active, 0, n); 
+    Ba = fff_matrix_block(thisone->B, 0, active, 0, p); 
+    if (tol > 0) {
+      Pa = fff_matrix_block(thisone->Bprev, 0, active, 0, p); 
+      fff_matrix_memcpy(&Pa, &Ba); 
+    }
+
+    /*** E step ***/ 
+
+    /* Compute current prediction estimates: Z = B*X' */ 
+    fff_blas_dgemm(CblasNoTrans, CblasTrans, 1.0, &Ba, X, 0.0, &Za); 
+
+    /* Posterior means and variances of the "true" effects, see
+       fff_glm_twolevel_EM_run */ 
+    for (i=0; i<active; i++) {
+      w2 = FFF_ENSURE_POSITIVE(thisone->s2->data[i]);
+      w2 = 1/w2; 
+      yi = thisone->Y->data + i*thisone->Y->tda; 
+      vyi = thisone->VY->data + i*thisone->VY->tda; 
+      zi = thisone->Z->data + i*thisone->Z->tda; 
+      svz = 0.0; 
+      for (t=0; t<n; t++) {
+	w1 = FFF_ENSURE_POSITIVE(vyi[t]);
+	w1 = 1/w1; 
+	vz = 1/(w1+w2);
+	zi[t] = vz * (w1*yi[t] + w2*zi[t]); 
+	svz += vz; 
+      }
+      thisone->svz->data[i] = svz; 
+    }
+
+    /*** M step ***/ 
+
+    /* Update effects: B = Z*PpiX' */ 
+    fff_blas_dgemm(CblasNoTrans, CblasTrans, 1.0, &Za, PpiX, 0.0, &Ba); 
+    
+    /* Prediction errors: Qz = B*X' - Z */ 
+    fff_matrix_memcpy(&Qa, &Za); 
+    fff_blas_dgemm(CblasNoTrans, CblasTrans, 1.0, &Ba, X, -1.0, &Qa); 
+
+    /*** Update variances and check convergence, from the last row so
+	 that converged signals can be swapped with the last active
+	 one, which is already up to date ***/ 
+    iter ++; 
+    for (i=active; i>0; i--) {
+      qi = thisone->Qz->data + (i-1)*thisone->Qz->tda; 
+      svz = thisone->svz->data[i-1]; 
+      for (t=0; t<n; t++) 
+	svz += FFF_SQR(qi[t]); 
+      s2prev = thisone->s2->data[i-1]; 
+      s2 = svz / (double)n; 
+      thisone->s2->data[i-1] = s2; 
+
+      if ((tol <= 0) || (s2prev == FFF_POSINF))
+	continue; 
+      converged = (FFF_ABS(s2-s2prev) <= tol*s2); 
+      bi = thisone->B->data + (i-1)*thisone->B->tda; 
+      bpi = thisone->Bprev->data + (i-1)*thisone->Bprev->tda; 
+      for (j=0; (j<p) && converged; j++) {
+	db = bi[j] - bpi[j]; 
+	converged = (FFF_SQR(db) <= FFF_SQR(tol)*s2); 
+      }
+      if (converged) {
+	active --; 
+	if (i-1 < active)
+	  _fff_glm_twolevel_batch_swap(thisone, i-1, active); 
+      }
+    }
+  }
+
+  /* Restore the original order */ 
+  for (i=0; i<m; i++) 
+    while (thisone->idx[i] != i)
+      _fff_glm_twolevel_batch_swap(thisone, i, thisone->idx[i]); 
 
   return;
 }
@@ -36,7 +36,9 @@ extern "C" {
     fff_vector* z; /*! Expected true effects */
     fff_vector* vz; /*! Expected variance of the true effects (diagonal matrix) */
     fff_vector* Qz; /* Expected prediction error */ 
-    unsigned int niter; /* Number of iterations */ 
+    fff_vector* bprev; /* Previous effect estimate */ 
+    unsigned int niter; /* Number of iterations of the last run */ 
+    double tol; /* If positive, relative tolerance for early termination, see fff_glm_twolevel_batch_run */ 
 
   } fff_glm_twolevel_EM; 
 
@@ -55,10 +57,59 @@ extern "C" {
   Please note that the equality \a PpiX*X=P should hold but is not
   checked.
 
+  At most \a niter iterations are run, fewer if \a em->tol is
+  positive and the estimates have converged, using the same
+  criterion as fff_glm_twolevel_batch_run.
+
   */
   extern void fff_glm_twolevel_EM_run(fff_glm_twolevel_EM* em, const fff_vector* y, const fff_vector* vy, 
 				 const fff_matrix* X, const fff_matrix* PpiX, unsigned int niter); 
 
+  /*! 
+    \struct fff_glm_twolevel_batch
+    \brief Structure for fitting many mixed-effect GLMs at once
+
+    Holds a block of signals sharing the same design, one signal per
+    row, so that the EM iterations of the whole block reduce to
+    matrix-matrix products. 
+  */
+  typedef struct{
+
+    size_t m; /*! Maximum number of signals */ 
+    size_t n; /*! Number of observations */ 
+    size_t p; /*! Number of regresssors */ 
+    fff_matrix* Y; /*! Input data (m x n) */ 
+    fff_matrix* VY; /*! Input variances (m x n) */ 
+    fff_matrix* B; /*! Effect estimates (m x p) */
+    fff_vector* s2; /*! Variance estimates (size m) */ 
+    fff_matrix* Z; /*! Expected true effects (m x n) */ 
+    fff_matrix* Qz; /*! Expected prediction errors (m x n) */ 
+    fff_matrix* Bprev; /*! Previous effect estimates (m x p) */ 
+    fff_vector* svz; /*! Sums of the expected variances of the true effects (size m) */ 
+    size_t* idx; /*! Current row of each signal */ 
+
+  } fff_glm_twolevel_batch; 
+
+  extern fff_glm_twolevel_batch* fff_glm_twolevel_batch_new(size_t m, size_t n, size_t p); 
+  extern void fff_glm_twolevel_batch_delete(fff_glm_twolevel_batch* thisone);
+  /*
+
+  Runs fff_glm_twolevel_EM_init and fff_glm_twolevel_EM_run for the
+  first \a m rows of \a Y and \a VY, which should be filled in by
+  the caller, and outputs the results in the rows of \a B and \a s2.
+  
+  If \a tol is positive, a signal stops iterating as soon as the
+  relative change of its variance is below \a tol, and the change of
+  each effect is below \a tol times the standard deviation. Converged
+  signals are swapped to the end of the block so that the remaining
+  ones still form a contiguous block. The original order is restored
+  on exit.
+
+  */
+  extern void fff_glm_twolevel_batch_run(fff_glm_twolevel_batch* thisone, size_t m, 
+					 const fff_matrix* X, const fff_matrix* PpiX, 
+					 unsigned int niter, double tol); 
+
   extern double fff_glm_twolevel_log_likelihood( const fff_vector* y, 
 						 const fff_vector* vy, 
 						 const fff_matrix* X, 
@@ -1,6 +1,8 @@
 #include "fff_graphlib.h"
 #include "fff_field.h"
 #include "fff_routines.h"
+#include "fff_threads.h"
+#include "fff_kdtree.h"
 
 #include <stdio.h>
 #include <stdlib.h>
@@ -11,18 +13,27 @@
 #define _SQRT2   1.41421356237309504880
 #define _SQRT3   1.73205080756887719000
 
+/* All-pairs geodesics use Floyd-Warshall rather than Dijkstra's
+   algorithm from each vertex beyond this edge density (E/V^2) */
+#define FFF_GRAPH_FLOYD_DENSITY 0.25
+/* Tile size of the blocked Floyd-Warshall algorithm */
+#define FFF_GRAPH_FLOYD_BLOCK 64
+/* Maximal number of points per leaf of the k-d trees used by the
+   neighbour graphs */
+#define FFF_GRAPH_KDTREE_LEAFSIZE 16
 
-static long _fff_list_add(long *listn, double *listd, const long newn, const double newd, const long k);
-static long _fff_list_move(long *listn, double *listd, const long newn, const double newd, const long k);
-static double _fff_list_insertion(long *listn, double *listd, const long newn, const double newd, const long k);
 
 static double _fff_g_euclidian(const fff_matrix* X, const long n1, const long n2);
 
 static double _fff_cross_euclidian(const fff_matrix* X, const fff_matrix* Y, const long n1, const long n2);
 static long _fff_graph_vect_neighb( fff_array *cindices, fff_array * neighb, fff_vector* weight, const fff_graph* G);
 static void _fff_graph_preprocess_grid(long*u, long*MMx, long* MMxy, long* MMu, const long N, const long* xyz);
-static void _fff_graph_preprocess_vgrid( long*u, long*MMx, long* MMxy, long* MMu,  const fff_array* xyz);
+static long _fff_graph_stencil_neighb(long* nn, double* nw, const fff_graph_stencil* S, const long i);
+static void _fff_graph_stencil_delete(fff_graph_stencil* S);
 static void  _fff_sort_vector_index (fff_vector *dist, long* idx);
+static long _fff_uf_root(long* parent, long i);
+static void _fff_uf_union(long* parent, long a, long b);
+static int _fff_graph_heap_less(const fff_graph_heap* H, const long a, const long b);
 
 extern void _fff_graph_normalize_rows(fff_graph* G);
 extern void _fff_graph_normalize_coluns(fff_graph* G);
@@ -30,69 +41,91 @@ extern void _fff_graph_normalize_symmetric(fff_graph* G);
 
 
 /******************************************************/
-/**************** list handling ***********************/
+/**************** indexed heap ************************/
 /******************************************************/
 
+fff_graph_heap* fff_graph_heap_new(const long V)
+{
+  long i;
+  fff_graph_heap* H = (fff_graph_heap*) calloc(1, sizeof(fff_graph_heap));
+  if (H == NULL)
+    return NULL;
+  H->node = (long*) calloc(FFF_MAX(V,1), sizeof(long));
+  H->pos = (long*) calloc(FFF_MAX(V,1), sizeof(long));
+  H->key = (double*) calloc(FFF_MAX(V,1), sizeof(double));
+  H->rank = (long*) calloc(FFF_MAX(V,1), sizeof(long));
+  if ((H->node == NULL) | (H->pos == NULL) | (H->key == NULL) | (H->rank == NULL)){
+    fff_graph_heap_delete(H);
+    return NULL;
+  }
+  for (i=0 ; i<V ; i++)
+    H->pos[i] = -1;
+  return H;
+}
 
-static long  _fff_list_add( long *listn, double *listd,  const long newn, const double newd, const long k)
-{  
-  long i = k; 
-  while (listd[i-1] > newd){
-    listd[i] = listd[i-1];
-    listn[i] = listn[i-1];
-    i--;
-    if (i<0){
-      FFF_ERROR(" could not deal with newd ",EFAULT);
-      /* return(1); */
-    }
-  } 
-  listd[i] = newd;
-  listn[i] = newn;
-  return(0);
+void fff_graph_heap_delete(fff_graph_heap* H)
+{
+  if (H == NULL)
+    return;
+  free(H->node);
+  free(H->pos);
+  free(H->key);
+  free(H->rank);
+  free(H);
 }
 
-static long _fff_list_move( long *listn, double *listd,  const long newn, const double newd, const long k)
-{ 
-  long i = k-1;
-  while (listn[i]!=newn) {
-    i--;
-    if (i<0){
-	  FFF_ERROR("item not identified in the list",EFAULT);
-    }
-  }
+static int _fff_graph_heap_less(const fff_graph_heap* H, const long a, const long b)
+{
+  if (H->key[a] < H->key[b]) return 1;
+  if (H->key[a] > H->key[b]) return 0;
+  return (H->rank[a] < H->rank[b]);
+}
 
-  while (listd[i-1]>newd){
-    listd[i] = listd[i-1];
-    listn[i] = listn[i-1];
-    i--;
-    if (i<0){
-       FFF_ERROR(" could not deal with newd ",EFAULT);
-    }
-  }
-  listd[i] = newd;
-  listn[i] = newn;
-  return(0);
+/* Insert v with key d, or decrease its key to d */
+void fff_graph_heap_push(fff_graph_heap* H, const long v, const double d)
+{
+  long i, j;
+
+  H->key[v] = d;
+  H->rank[v] = H->stamp++;
+  i = H->pos[v];
+  if (i < 0)
+    i = H->size++;
+
+  /* sift up */
+  for ( ; i>0 ; i=j){
+    j = (i-1)/2;
+    if (!_fff_graph_heap_less(H, v, H->node[j]))
+      break;
+    H->node[i] = H->node[j];
+    H->pos[H->node[i]] = i;
+  }
+  H->node[i] = v;
+  H->pos[v] = i;
 }
 
-static double _fff_list_insertion(long *listn, double *listd, const long newn, const double newd, const long q)
-{ 
-  /* this is a suboptimal routine to insert a value into a sorted list */
-  long i; 
+/* Remove and return the vertex with the lowest key */
+long fff_graph_heap_pop(fff_graph_heap* H)
+{
+  long i, j, v, top = H->node[0];
 
-  if (newd>listd[q-1])
-	FFF_ERROR("insertion error ",EDOM);
-  
-  i = q-1;
-  if (i>0)
-    while (newd<listd[i-1]){  
-      listd[i] = listd[i-1];
-      listn[i] = listn[i-1];
-      i--;
-      if (i==0)break;
-    }    
-  listd[i] = newd;
-  listn[i] =  newn;
-  return(listd[q-1]);
+  H->pos[top] = -1;
+  v = H->node[--H->size];
+  if (H->size == 0)
+    return(top);
+
+  /* sift down */
+  for (i=0 ; (j=2*i+1)<H->size ; i=j){
+    if ((j+1 < H->size) && _fff_graph_heap_less(H, H->node[j+1], H->node[j]))
+      j++;
+    if (!_fff_graph_heap_less(H, H->node[j], v))
+      break;
+    H->node[i] = H->node[j];
+    H->pos[H->node[i]] = i;
+  }
+  H->node[i] = v;
+  H->pos[v] = i;
+  return(top);
 }
 
 
@@ -263,6 +296,7 @@ extern void fff_graph_set( fff_graph* thisone , const long *A, const long* B, co
 {
   long v = thisone->V;
   long i; 
+  fff_graph_uncompile(thisone);
   for (i=0 ; i<thisone->E ; i++){
       if (A[i]>v-1){
 		FFF_ERROR(" Edge index is too high",EDOM);
@@ -284,6 +318,7 @@ extern void fff_graph_set_safe( fff_graph* thisone , const fff_array *A, const f
   size_t E = thisone->E;
   long v = thisone->V;
   
+  fff_graph_uncompile(thisone);
   if (((A->dimX)!=E)|((B->dimX)!=E)|((D->size)!=E))
     FFF_ERROR("inconsistant vector size \n",EDOM);
   
@@ -308,6 +343,8 @@ void fff_graph_delete( fff_graph* thisone )
 {
 
   if ( thisone != NULL ) {
+    fff_graph_uncompile(thisone);
+    _fff_graph_stencil_delete(thisone->grid);
     free(thisone->eA);
     free(thisone->eB);
     free(thisone->eD);
@@ -321,6 +358,9 @@ void fff_graph_reset( fff_graph** G, const long v, const long e )
   fff_graph* thisone = *G;
   long i;
 
+  fff_graph_uncompile(thisone);
+  _fff_graph_stencil_delete(thisone->grid);
+  thisone->grid = NULL;
   thisone->E = e;
   thisone->V = v;
 
@@ -342,6 +382,161 @@ void fff_graph_reset( fff_graph** G, const long v, const long e )
   return;
 }  
 
+/**********************************************************************
+ ************************ compiled adjacency **************************
+**********************************************************************/
+
+/* Counting sort of the edges by origin, which keeps the order of the
+   edges of each vertex; those of implicit graphs are generated in
+   place */
+static void _fff_graph_csr(long* ci, long* cn, double* cw, const fff_graph* G)
+{
+  long V = G->V;
+  long E = G->E;
+  long i,j; 
+
+  if (G->grid != NULL){
+    ci[0] = 0;
+    for (i=0 ; i<V ; i++)
+      ci[i+1] = ci[i] + _fff_graph_stencil_neighb(cn+ci[i], cw+ci[i], G->grid, i);
+    return;
+  }
+
+  for (i=0 ; i<V+1 ; i++)
+    ci[i] = 0;
+  for (i=0 ; i<E ; i++)
+    ci[G->eA[i]+1] ++;
+  for (i=0 ; i<V ; i++)
+    ci[i+1] += ci[i];
+
+  /* ci[a] is used as the insertion cursor of a, then shifted back */
+  for (i=0 ; i<E ; i++){
+    j = ci[G->eA[i]]++;
+    cn[j] = G->eB[i];
+    cw[j] = G->eD[i];
+  }
+  for (i=V ; i>0 ; i--)
+    ci[i] = ci[i-1];
+  ci[0] = 0;
+}
+
+static int _fff_graph_csr_new(long** ci, long** cn, double** cw, const fff_graph* G)
+{
+  *ci = (long*) calloc( G->V+1,sizeof(long));
+  *cn = (long*) calloc( FFF_MAX(G->E,1),sizeof(long));
+  *cw = (double*) calloc( FFF_MAX(G->E,1),sizeof(double));
+  if ( (*ci == NULL) | (*cn == NULL) | (*cw == NULL)) {
+    FFF_ERROR("Out of memory", ENOMEM);
+    free(*ci);
+    free(*cn);
+    free(*cw);
+    *ci = NULL;
+    *cn = NULL;
+    *cw = NULL;
+    return(1);
+  }
+  _fff_graph_csr(*ci, *cn, *cw, G);
+  return(0);
+}
+
+int fff_graph_compile(fff_graph* G)
+{
+  fff_graph_uncompile(G);
+  return(_fff_graph_csr_new(&(G->ci), &(G->cn), &(G->cw), G));
+}
+
+void fff_graph_uncompile(fff_graph* G)
+{
+  free(G->ci);
+  free(G->cn);
+  free(G->cw);
+  G->ci = NULL;
+  G->cn = NULL;
+  G->cw = NULL;
+}
+
+int fff_graph_adjacency(long** ci, long** cn, double** cw, const fff_graph* G)
+{
+  if (G->ci != NULL){
+    *ci = G->ci;
+    *cn = G->cn;
+    *cw = G->cw;
+    return(0);
+  }
+  return(_fff_graph_csr_new(ci, cn, cw, G));
+}
+
+void fff_graph_adjacency_delete(long* ci, long* cn, double* cw, const fff_graph* G)
+{
+  if (ci == G->ci) 
+    return;
+  free(ci);
+  free(cn);
+  free(cw);
+}
+
+int fff_graph_neighb_init(fff_graph_neighb* N, const fff_graph* G)
+{
+  N->G = G;
+  N->ci = NULL;
+  N->cn = NULL;
+  N->cw = NULL;
+  /* the stencil is only used when G is not compiled */
+  if ((G->grid != NULL) && (G->ci == NULL))
+    return(0);
+  return(fff_graph_adjacency(&(N->ci), &(N->cn), &(N->cw), G));
+}
+
+void fff_graph_neighb_clear(fff_graph_neighb* N)
+{
+  if (N->ci != NULL)
+    fff_graph_adjacency_delete(N->ci, N->cn, N->cw, N->G);
+  N->ci = NULL;
+  N->cn = NULL;
+  N->cw = NULL;
+}
+
+long fff_graph_neighb_get(fff_graph_neighb* N, const long i, const long** nn, const double** nw)
+{
+  if (N->ci != NULL){
+    *nn = N->cn + N->ci[i];
+    *nw = N->cw + N->ci[i];
+    return(N->ci[i+1] - N->ci[i]);
+  }
+  *nn = N->nn;
+  *nw = N->nw;
+  return(_fff_graph_stencil_neighb(N->nn, N->nw, N->G->grid, i));
+}
+
+long fff_graph_explicit(fff_graph** K, const fff_graph* G)
+{
+  fff_graph* thisone;
+  fff_graph_neighb N;
+  const long* nn;
+  const double* nw;
+  long i, j, d, e = 0;
+
+  if (fff_graph_neighb_init(&N, G))
+    return(-1);
+  thisone = fff_graph_new(G->V, G->E);
+  if (thisone == NULL){
+    FFF_WARNING("fff_graph_new failed");
+    fff_graph_neighb_clear(&N);
+    return(-1);
+  }
+  for (i=0 ; i<G->V ; i++){
+    d = fff_graph_neighb_get(&N, i, &nn, &nw);
+    for (j=0 ; j<d ; j++, e++){
+      thisone->eA[e] = i;
+      thisone->eB[e] = nn[j];
+      thisone->eD[e] = nw[j];
+    }
+  }
+  fff_graph_neighb_clear(&N);
+  *K = thisone;
+  return(e);
+}
+
 extern void fff_graph_edit_safe(fff_array *A, fff_array* B, fff_vector *D, const fff_graph* thisone )
 {
   long i; 
@@ -374,6 +569,7 @@ extern void fff_graph_set_euclidian(fff_graph *G, const fff_matrix *X)
   long v = G->V;
   long i,e = G->E;
 
+  fff_graph_uncompile(G);
   if ((X->size1) < v){
     FFF_ERROR("inconsistant matrix size \n",EDOM);
     /* return; */
@@ -390,6 +586,7 @@ extern void fff_graph_set_Gaussian(fff_graph *G, const fff_matrix *X, const doub
   double dx;
   double sigmasq = 2*sigma*sigma;
 
+  fff_graph_uncompile(G);
   if ((X->size1) < v){
     FFF_ERROR("inconsistant matrix size \n",EDOM);
     /* return; */
@@ -408,6 +605,7 @@ extern void fff_graph_auto_Gaussian(fff_graph *G, const fff_matrix *X)
   double sigma = 0;
   double sigmasq; 
 
+  fff_graph_uncompile(G);
   if ((X->size1) < v){
     FFF_ERROR("inconsistant matrix size \n",EDOM);
     /* return; */
@@ -519,6 +717,7 @@ extern void _fff_graph_normalize_rows(fff_graph* G)
   
   double *SeD  = (double*) calloc( G->V,sizeof(double));
   
+  fff_graph_uncompile(G);
   for (i=0 ; i<V ; i++)
     SeD[i]=0;
 
@@ -543,6 +742,7 @@ extern void fff_graph_normalize_rows(fff_graph* G, fff_vector* SeD)
   long E = G->E;
   double aux; 
  
+  fff_graph_uncompile(G);
   fff_vector_set_all(SeD,0);
 
   for (i=0 ; i<E ; i++){
@@ -567,6 +767,7 @@ extern void _fff_graph_normalize_columns(fff_graph* G)
   
   double *SeD  = (double*) calloc( G->V,sizeof(double));
   
+  fff_graph_uncompile(G);
   for (i=0 ; i<V ; i++)
     SeD[i]=0;
 
@@ -590,6 +791,7 @@ extern void fff_graph_normalize_columns(fff_graph* G,fff_vector* SeD)
   long E = G->E;
   double aux;
     
+  fff_graph_uncompile(G);
   fff_vector_set_all(SeD,0);
 
   for (i=0 ; i<E ; i++){
@@ -615,6 +817,7 @@ extern void _fff_graph_normalize_symmetric(fff_graph* G)
   double *SeA  = (double*) calloc( G->V,sizeof(double));
   double *SeB  = (double*) calloc( G->V,sizeof(double));
 
+  fff_graph_uncompile(G);
   for (i=0 ; i<V ; i++){
     SeB[i]=0;
 	SeA[i]=0;
@@ -647,6 +850,7 @@ extern void fff_graph_normalize_symmetric(fff_graph* G, fff_vector* SeA, fff_vec
   long E = G->E;
   double aux;
   
+  fff_graph_uncompile(G);
   fff_vector_set_all(SeA,0);
   fff_vector_set_all(SeB,0);
 
@@ -682,6 +886,7 @@ void fff_graph_reorderA(fff_graph* G)
   long *tempi  = (long*) calloc( G->E,sizeof(long));
   double *tempd  = (double*) calloc( G->E,sizeof(double));
  
+  fff_graph_uncompile(G);
   /* sort the vertices */
  
   for (i=0 ; i<E ; i++)
@@ -727,6 +932,7 @@ void fff_graph_reorderB(fff_graph* G)
   long *tempi  = (long*) calloc( G->E,sizeof(long) );
   double *tempd  = (double*) calloc( G->E,sizeof(double) );
  
+  fff_graph_uncompile(G);
   /* sort the vertices */
   for (i=0 ; i<E ; i++)
     tempd[i] = (double)G->eA[i] + (double)(V)*(double)(G->eB[i]);
@@ -766,6 +972,7 @@ void fff_graph_reorderD(fff_graph* G)
   long *tempi  = (long*) calloc( G->E,sizeof(long));
   double *tempd  = (double*) calloc( G->E,sizeof(double));
 
+  fff_graph_uncompile(G);
   sort_ascending_and_get_permutation( G->eD, index, G->E );
   
   /* replace the origins of the vertices */
@@ -799,6 +1006,7 @@ void fff_graph_copy(fff_graph* G2, const fff_graph* G1)
 {
   long i;
   
+  fff_graph_uncompile(G2);
   G2->V = G1->V;
   if ((G1->E != G2->E)){
     FFF_ERROR("Incompatible edge numbers\n",EDOM);
@@ -1106,61 +1314,175 @@ static void _fff_sort_vector_index (fff_vector *dist, long* idx)
 }
 
 
-long fff_graph_knn(fff_graph** G, const fff_matrix* X, const long k)
+/* Queries of a k-d tree of the rows of Y, from the rows of X, split
+   across threads by interleaved rows. Each query point n1 gets either
+   its k nearest neighbours, written in nn[n1*k..], or its neighbours
+   within eps: their number is written in count[n1] and, if G is not
+   NULL, the corresponding edges are written in G from edge off[n1]
+   on, in increasing neighbour order. */
+typedef struct {
+  const fff_kdtree* T;
+  const fff_matrix* X;
+  const fff_matrix* Y;
+  long k;
+  long* nn;
+  double sqeps;
+  int robust;
+  int symmetric;
+  long* count;
+  long* off;
+  fff_graph* G;
+} _fff_graph_neighb_job;
+
+static void _fff_graph_knn_job_run(int rank, int nthreads, void* params)
+{
+  _fff_graph_neighb_job* job = (_fff_graph_neighb_job*) params;
+  long n1;
+  double* d2 = (double*) calloc(job->k, sizeof(double));
+
+  for (n1=rank ; n1<(long)job->X->size1 ; n1+=nthreads)
+    fff_kdtree_knn(job->nn+n1*job->k, d2, job->T, job->X->data+n1*job->X->tda, job->k);
+  free(d2);
+}
+
+static void _fff_graph_eps_job_run(int rank, int nthreads, void* params)
+{
+  _fff_graph_neighb_job* job = (_fff_graph_neighb_job*) params;
+  long n1, n2, i, q, m, found, nmax = 16;
+  const double* x;
+  long* nn = (long*) malloc(nmax*sizeof(long));
+  double* d2 = (double*) malloc(nmax*sizeof(double));
+
+  for (n1=rank ; n1<(long)job->X->size1 ; n1+=nthreads){
+    x = job->X->data+n1*job->X->tda;
+    while ((found = fff_kdtree_eps(nn, d2, nmax, job->T, x, job->sqeps, job->robust)) > nmax){
+      nmax = 2*found;
+      nn = (long*) realloc(nn, nmax*sizeof(long));
+      d2 = (double*) realloc(d2, nmax*sizeof(double));
+    }
+    /* the symmetric graph only holds the pairs n2<n1, in both directions */
+    m = found;
+    if (job->symmetric)
+      for (m=0 ; (m<found) && (nn[m]<n1) ; m++);
+    /* the robust graph links each point to its nearest neighbour at least */
+    if ((job->robust) && (m == 0))
+      m = fff_kdtree_knn(nn, d2, job->T, x, 1);
+
+    job->count[n1] = m;
+    if (job->G == NULL)
+      continue;
+    q = job->off[n1];
+    for (i=0 ; i<m ; i++){
+      n2 = nn[i];
+      d2[i] = sqrt(d2[i]);
+      job->G->eA[q] = n1;
+      job->G->eB[q] = n2;
+      job->G->eD[q] = d2[i];
+      q++;
+      if (job->symmetric){
+	job->G->eA[q] = n2;
+	job->G->eB[q] = n1;
+	job->G->eD[q] = d2[i];
+	q++;
+      }
+    }
+  }
+  free(nn);
+  free(d2);
+}
+
+/* Neighbours of the rows of X among those of Y, see
+   _fff_graph_neighb_job; returns 1 if the tree could not be built */
+static int _fff_graph_neighb(_fff_graph_neighb_job* job, fff_parallel_func func, int nthreads)
+{
+  fff_kdtree* T = (fff_kdtree*)job->T;
+
+  if (T == NULL)
+    T = fff_kdtree_new(job->Y, FFF_GRAPH_KDTREE_LEAFSIZE);
+  if (T == NULL){
+    FFF_ERROR("memory allocation failed", ENOMEM);
+    return 1;
+  }
+  nthreads = fff_threads_count(nthreads);
+  if (nthreads > (long)job->X->size1)
+    nthreads = FFF_MAX((int)job->X->size1, 1);
+  job->T = T;
+  fff_parallel_run(nthreads, func, (void*)job);
+  return 0;
+}
+
+/* Edges within eps, counted in a first pass, then written */
+static fff_graph* _fff_graph_eps_build(const fff_matrix* X, const fff_matrix* Y, const double eps, 
+				       const int robust, const int symmetric, int nthreads)
+{
+  long n1, E = 0, Nx = X->size1;
+  fff_graph* G = NULL;
+  _fff_graph_neighb_job job;
+
+  job.T = NULL;
+  job.X = X;
+  job.Y = Y;
+  job.sqeps = eps*eps;
+  job.robust = robust;
+  job.symmetric = symmetric;
+  job.count = (long*) calloc(FFF_MAX(Nx,1), sizeof(long));
+  job.off = (long*) calloc(FFF_MAX(Nx,1), sizeof(long));
+  job.G = NULL;
+  if (_fff_graph_neighb(&job, &_fff_graph_eps_job_run, nthreads) == 0){
+    for (n1=0 ; n1<Nx ; n1++){
+      job.off[n1] = (symmetric) ? 2*E : E;
+      E += job.count[n1];
+    }
+    if (symmetric)
+      E *= 2;
+    G = fff_graph_new(Nx, E);
+    job.G = G;
+    _fff_graph_neighb(&job, &_fff_graph_eps_job_run, nthreads);
+  }
+  fff_kdtree_delete((fff_kdtree*)job.T);
+  free(job.count);
+  free(job.off);
+  return G;
+}
+
+long fff_graph_knn(fff_graph** G, const fff_matrix* X, const long k, const int nthreads)
 {
   /* NB : could be further simplified */
   /* char* proc = "fff_graph_knn"; */
 
   long N = X->size1;
-  long T = X->size2;
-  long E = k*N;
+  long kk = FFF_MAX(FFF_MIN(k, N-1), 0);
+  long E = kk*N;
   
-  fff_array* Knn = fff_array_new2d(FFF_LONG,N,k+1);
-  fff_vector* dist = fff_vector_new(k+1);
-  long * bufn;
+  fff_array* Knn = fff_array_new2d(FFF_LONG,N,kk+1);
   long *Knndata = (long *)Knn->data;
-
-  double dx,disth,ndist;
-  long n1,n2,n3,b,j,t,q;
+  long n1,n2,n3,b,j,q;
   fff_graph *thisone; 
-
-  /* Make a knn non-symmetric matrix */
-  for (n1=0 ; n1<N ; n1++){
-    for (n2 =0; n2<k+1; n2++){
-      ndist = 0;
-      for ( t=0 ; t<T ; t++){
-		dx = fff_matrix_get(X,n1,t)-fff_matrix_get(X,n2,t);
-		ndist += dx*dx;
-      }
-      dist->data[n2] = ndist;
-    }
-    
-    /* initialize neighb */ 
-    bufn =  &Knndata[n1*(k+1)];/* Knn->data+n1*(k+1); */
-    _fff_sort_vector_index (dist, bufn);
-    disth = dist->data[k];
-    
-    /* Iterate */
-    for ( n2=k+1 ; n2<N ; n2++){
-      ndist = 0;      
-      for ( t=0 ; t<T ; t++){
-		dx = fff_matrix_get(X,n1,t)-fff_matrix_get(X,n2,t);
-		ndist += dx*dx;
-		if (ndist>disth) break;
-      }
-      if (ndist<disth) {
-	bufn = &Knndata[n1*(k+1)];/* Knn->data+n1*(k+1); */
-	disth = _fff_list_insertion(bufn,dist->data,n2, ndist,k+1);
-      } 
-    }
+  _fff_graph_neighb_job job;
+
+  if (kk < k)
+    FFF_WARNING("k is larger than the number of other points \n");
+
+  /* Make a knn non-symmetric matrix: the k+1 nearest points, the
+     first one being the point itself unless it has duplicates */
+  job.T = NULL;
+  job.X = X;
+  job.Y = X;
+  job.k = kk+1;
+  job.nn = Knndata;
+  if (_fff_graph_neighb(&job, &_fff_graph_knn_job_run, nthreads)){
+    fff_array_delete(Knn);
+    *G = fff_graph_new(N,0);
+    return(0);
   }
+  fff_kdtree_delete((fff_kdtree*)job.T);
   
   /* Compute the true number of edges in the symmetric system */
   for (n1=0 ; n1<N ; n1++) {
-	for ( n2=0 ; n2<k ; n2++){
+	for ( n2=0 ; n2<kk ; n2++){
 	  n3 = fff_array_get2d(Knn,n1,n2+1);
 	  b = 0;
-	  for (j=0; j<k; j++)
+	  for (j=0; j<kk; j++)
 		if (fff_array_get2d(Knn,n3,j+1) == n1) b=1;
 	  if (b==0) E++;
 	}
@@ -1169,21 +1491,21 @@ long fff_graph_knn(fff_graph** G, const fff_matrix* X, const long k)
   /* write the edge matrix  */ 
   thisone = fff_graph_new(N,E);
   for ( n1=0 ; n1<N ; n1++){
-	for (n2=0 ; n2<k ; n2++){
+	for (n2=0 ; n2<kk ; n2++){
 	  long n4 = n2+1;
 	  n3 = fff_array_get2d(Knn,n1,n4);
-	  thisone->eA[k*n1+n2] = n1;
-	  thisone->eB[k*n1+n2] = n3;
-	  thisone->eD[k*n1+n2] = _fff_g_euclidian(X, n1, n3);
+	  thisone->eA[kk*n1+n2] = n1;
+	  thisone->eB[kk*n1+n2] = n3;
+	  thisone->eD[kk*n1+n2] = _fff_g_euclidian(X, n1, n3);
     }
   }
 
-  q = k*N;
+  q = kk*N;
   for (n1 =0 ; n1<N ; n1++){ 
-    for (n2=0 ; n2<k ; n2++){
+    for (n2=0 ; n2<kk ; n2++){
       b=0;
       n3 = fff_array_get2d(Knn,n1,n2+1);
-      for (j=0; j<k; j++)
+      for (j=0; j<kk; j++)
 	if (fff_array_get2d(Knn,n3,j+1) == n1) b=1;
       if (b==0){
 	thisone->eA[q]= n3;
@@ -1195,78 +1517,59 @@ long fff_graph_knn(fff_graph** G, const fff_matrix* X, const long k)
   }
 
   fff_array_delete(Knn);
-  fff_vector_delete(dist);
   *G = thisone;
   return(E);
 } 
 
-long fff_graph_cross_knn(fff_graph* G, const fff_matrix* X, const fff_matrix *Y,const long k)
+long fff_graph_cross_knn(fff_graph* G, const fff_matrix* X, const fff_matrix *Y,const long k, const int nthreads)
 {
   
   long Nx = X->size1;
   long Ny = Y->size1;
-  long T = X->size2;
-  long E = k*Nx;
-  fff_array* Knn;
-  fff_vector* dist;
+  long kk = FFF_MIN(k, Ny);
+  long E = kk*Nx;
   long *Knndata;
-  long * bufn;
-  double dx,disth,ndist;
-  long n1,n2,t;
+  long n1,n2;
   long q,n3;
+  _fff_graph_neighb_job job;
 
   if (X->size2 != Y->size2){
     FFF_ERROR("Incompatible dimensions\n",EDOM);
     /* fff_message( fff_ERROR_MSG, proc,"Incompatible dimensions\n");
        return(1); */
   }
+  if (kk < k)
+    FFF_WARNING("k is larger than the number of points in Y \n");
+  if (G->E < E){
+    FFF_ERROR("the graph has not enough edges \n",EDOM);
+    return(0);
+  }
 
-  Knn = fff_array_new2d(FFF_LONG,Nx,k);
-  dist = fff_vector_new(k);
-  Knndata = (long *)Knn->data;
+  fff_graph_uncompile(G);
+  Knndata = (long*) calloc(FFF_MAX(E,1), sizeof(long));
 
   /* Make a knn non-symmetric matrix */  
-  for (n1 =0 ; n1<Nx ; n1++){
-    for (n2 =0; n2<k ; n2++){
-      ndist = 0;
-      for ( t=0 ; t<T ; t++){
-		dx = fff_matrix_get(X,n1,t)-fff_matrix_get(Y,n2,t);
-		ndist += dx*dx;
-      }
-      dist->data[n2] = ndist;
-    }
-    
-    /* initialize neighb  */  
-    bufn = Knndata+n1*k;
-    _fff_sort_vector_index (dist, bufn);
-    disth = dist->data[k-1];
-    /* Iterate  */  
-    for ( n2=k ; n2<Ny ; n2++){    
-      ndist = 0;     
-      for ( t=0 ; t<T ; t++){
-		dx = fff_matrix_get(X,n1,t)-fff_matrix_get(Y,n2,t);
-		ndist += dx*dx;
-		if (ndist>disth) break;
-      }
-      if (ndist<disth) {
-		bufn = Knndata+n1*k;
-		disth = _fff_list_insertion(bufn,dist->data,n2, ndist,k);
-      }
-    }
-  }  
+  job.T = NULL;
+  job.X = X;
+  job.Y = Y;
+  job.k = kk;
+  job.nn = Knndata;
+  if ((kk > 0) && _fff_graph_neighb(&job, &_fff_graph_knn_job_run, nthreads))
+    E = 0;
   
   /* write into the graph structure  */  
   for ( n1=0 ; n1<Nx ; n1++)
-    for (n2=0 ; n2<k ; n2++){
-      q = n1*k+n2;
-      n3 =  (Knndata[n1*k+n2]);
+    for (n2=0 ; (n2<kk) && (E>0) ; n2++){
+      q = n1*kk+n2;
+      n3 =  (Knndata[n1*kk+n2]);
       G->eA[q] = n1;
       G->eB[q] = n3;
       G->eD[q] = _fff_cross_euclidian(X,Y,n1,n3);
     }
-   
-  fff_array_delete(Knn);
-  fff_vector_delete(dist);
+  G->E = E;
+
+  fff_kdtree_delete((fff_kdtree*)job.T);
+  free(Knndata);
     
   return(E);
 } 
@@ -1275,184 +1578,42 @@ long fff_graph_cross_knn(fff_graph* G, const fff_matrix* X, const fff_matrix *Y,
  *************************** eps-NN graph ******************************
 **********************************************************************/
 
-long fff_graph_eps(fff_graph** G, const fff_matrix* X, const double eps)
+long fff_graph_eps(fff_graph** G, const fff_matrix* X, const double eps, const int nthreads)
 {
-  /* char* proc = "fff_graph_eps";*/
-
-  long N = X->size1;
-  long T = X->size2;
-  long E = 0;
-
-  double dx,ndist;
-  long n1,n2,t,q;
-  double sqeps = eps*eps;
-  fff_graph *thisone; 
+  fff_graph *thisone = _fff_graph_eps_build(X, X, eps, 0, 1, nthreads);
 
-  /* compute te number of edges */
-  for (n1=0 ; n1<N ; n1++){
-    for ( n2=0 ; n2<n1 ; n2++){
-      ndist = 0;
-      for ( t=0 ; t<T ; t++){
-	dx = fff_matrix_get(X,n1,t)-fff_matrix_get(X,n2,t);
-	ndist += dx*dx;
-	if (ndist>sqeps) break;
-      }
-      if (ndist<sqeps)  E++;
-    }
-  }
-  
-  E*=2;
-  thisone = fff_graph_new( N,E);
-  q = 0;
-  /* build the graph */
-   for (n1 =0 ; n1<N ; n1++){
-    for ( n2 =0 ; n2<n1 ; n2++){  
-      ndist = 0;
-      for ( t=0 ; t<T ; t++){
-	dx = fff_matrix_get(X,n1,t)-fff_matrix_get(X,n2,t);
-	ndist += dx*dx;
-	if (ndist>sqeps) break;
-      }
-      if (ndist<sqeps){
-	ndist = sqrt(ndist);
-	thisone->eA[q] = n1;
-	thisone->eB[q] = n2;
-	thisone->eD[q] = ndist;
-	q++;
-	thisone->eA[q] = n2;
-	thisone->eB[q] = n1;
-	thisone->eD[q] = ndist;
-	q++;
-      }
-    }
-  }   
-   *G = thisone;
-   return(E);
+  if (thisone == NULL)
+    thisone = fff_graph_new(X->size1, 0);
+  *G = thisone;
+  return(thisone->E);
 } 
 
-long fff_graph_cross_eps(fff_graph** G, const fff_matrix* X,const fff_matrix* Y, const double eps)
+long fff_graph_cross_eps(fff_graph** G, const fff_matrix* X,const fff_matrix* Y, const double eps, const int nthreads)
 {
-  long Nx = X->size1;
-  long Ny = Y->size1;
-  long T = X->size2;
-  long E = 0;
-
-  double dx,ndist;
-  long n1,n2,t,q;
-  double sqeps = eps*eps;
-  fff_graph *thisone; 
+  fff_graph *thisone;
 
   if (X->size2 != Y->size2){
     FFF_ERROR("Incompatible dimensions\n",EDOM);
     /* return(0); */
   }
-
-  /* compute te number of edges */
-  for (n1=0 ; n1<Nx ; n1++){
-    for ( n2=0 ; n2<Ny ; n2++){
-      ndist = 0;
-      for ( t=0 ; t<T ; t++){
-	dx = fff_matrix_get(X,n1,t)-fff_matrix_get(Y,n2,t);
-	ndist += dx*dx;
-	if (ndist>sqeps) break;
-      }
-      if (ndist<sqeps)  E++;
-    }
-  }
-  
-  thisone = fff_graph_new(Nx,E);
-  q = 0;
-  /* build the graph */
-   for (n1 =0 ; n1<Nx ; n1++){
-    for ( n2 =0 ; n2<Ny ; n2++){  
-      ndist = 0;
-      for ( t=0 ; t<T ; t++){
-	dx = fff_matrix_get(X,n1,t)-fff_matrix_get(Y,n2,t);
-	ndist += dx*dx;
-	if (ndist>sqeps) break;
-      }
-      if (ndist<sqeps){
-	ndist = sqrt(ndist);
-	thisone->eA[q] = n1;
-	thisone->eB[q] = n2;
-	thisone->eD[q] = ndist;
-	q++;
-      }
-    }
-  }
-   *G = thisone;
-   return(E);
+  thisone = _fff_graph_eps_build(X, Y, eps, 0, 0, nthreads);
+  if (thisone == NULL)
+    thisone = fff_graph_new(X->size1, 0);
+  *G = thisone;
+  return(thisone->E);
 } 
 
-long fff_graph_cross_eps_robust(fff_graph** G, const fff_matrix* X,const fff_matrix* Y, const double eps)
+long fff_graph_cross_eps_robust(fff_graph** G, const fff_matrix* X,const fff_matrix* Y, const double eps, const int nthreads)
 {
-  long Nx = X->size1;
-  long Ny = Y->size1;
-  long T = X->size2;
-  long E = 0;
-
-  double dx,ndist, maxdist;
-  long n1,n2,t,q,win=0;
-  double sqeps = eps*eps;
-  fff_graph *thisone; 
+  fff_graph *thisone;
 
   if (X->size2 != Y->size2)
     FFF_ERROR("Incompatible dimensions\n",EDOM);
-
-  /* compute te number of edges */
-  for (n1=0 ; n1<Nx ; n1++){
-    q = 0;
-	for ( n2=0 ; n2<Ny ; n2++){
-      ndist = 0;
-      for ( t=0 ; t<T ; t++){
-		dx = fff_matrix_get(X,n1,t)-fff_matrix_get(Y,n2,t);
-		ndist += dx*dx;
-		if (ndist>sqeps) break;
-      }
-      if (ndist<=sqeps){
-		E++;
-		q++;
-	  }
-    }
-	if (q==0) E++;
-  }
-  
-  thisone = fff_graph_new(Nx,E);
-  q = 0;
-  /* build the graph */
-   for (n1 =0 ; n1<Nx ; n1++){
-	 maxdist = FFF_POSINF;
-	 for ( n2 =0 ; n2<Ny ; n2++){  
-	   ndist = 0;
-	   for ( t=0 ; t<T ; t++){
-		 dx = fff_matrix_get(X,n1,t)-fff_matrix_get(Y,n2,t);
-		 ndist += dx*dx;
-		 if (ndist>maxdist) break;
-      }
-	   if (ndist<=sqeps){
-		 maxdist = sqeps;
-		 ndist = sqrt(ndist);
-		 thisone->eA[q] = n1;
-		 thisone->eB[q] = n2;
-		 thisone->eD[q] = ndist;
-		 q++;
-	   }
-	   else
-		 if (ndist<maxdist){
-		   maxdist = ndist;
-		   win = n2;
-		 }
-	 }
-	 if (maxdist>sqeps){
-	   maxdist = sqrt(maxdist);
-	   thisone->eA[q] = n1;
-	   thisone->eB[q] = win;
-	   thisone->eD[q] = maxdist;
-	   q++;
-	 }
-   }
-   *G = thisone;
-   return(E);
+  thisone = _fff_graph_eps_build(X, Y, eps, 1, 0, nthreads);
+  if (thisone == NULL)
+    thisone = fff_graph_new(X->size1, 0);
+  *G = thisone;
+  return(thisone->E);
 } 
 
 
@@ -1496,855 +1657,163 @@ static void _fff_graph_preprocess_grid(long*u, long*MMx, long* MMxy, long* MMu,
   *MMu = Mu;
 }
 
-long fff_graph_grid_six(fff_graph** G, const  long* xyz, const long N)
+/* Steps (x,y,z) of the stencils, in the order in which the grid
+   graphs list the neighbours: the voxel itself, then the 6 faces, the
+   12 edges and the 8 corners of the cube */
+static const long _fff_graph_stencil_steps[FFF_GRAPH_STENCIL_MAX][3] = {
+  {0,0,0},
+  {1,0,0}, {-1,0,0}, {0,1,0}, {0,-1,0}, {0,0,1}, {0,0,-1},
+  {1,1,0}, {-1,-1,0}, {-1,1,0}, {1,-1,0}, {1,0,1}, {-1,0,-1},
+  {-1,0,1}, {1,0,-1}, {0,1,1}, {0,-1,-1}, {0,-1,1}, {0,1,-1},
+  {1,-1,1}, {-1,-1,1}, {-1,1,1}, {1,1,1}, {-1,1,-1}, {-1,-1,-1}, {1,1,-1}, {1,-1,-1}
+};
+
+static void _fff_graph_stencil_delete(fff_graph_stencil* S)
 {
-  /*   char* proc = "fff_graph_grid_six"; */
-
-  fff_graph *thisone; 
-
-  long E = 0;
-  long i,j;
-  long Mx,Mxy,Mu,ui;
-  long *u, *A, *B, *invu; 
-  double *D; 
-
-  u = ( long*) calloc( N,sizeof(long));
-  if (!u) return(0);
-  A = ( long*) calloc( N*7,sizeof(long));
-  if (!A) return(0);
-  B = ( long*) calloc( N*7,sizeof(long));
-  if (!B) return(0);
-  D = ( double*) calloc( N*7,sizeof( double));
-  if (!D) return(0);
-
-  _fff_graph_preprocess_grid(u,&Mx,&Mxy, &Mu,N,xyz);
-   
-  /* find  invu such that  invu[u[i]]=i */
-  invu = (long*) calloc( Mu,sizeof(long));
-  if (!invu) return(0);
-  for (i=0 ; i<(Mu) ; i++) invu[i]=-1;   
-  for (i=0 ; i<N ; i++) invu[u[i]]=i;    
- 
-  /* Search for neighbours*/
-  j=0;
-  for (i=0 ; i<N ; i++){ 
-    A[j] = i;
-    B[j] = i;
-    D[j] = 0;
-    j++;   
-    ui = u[i];
-    if (ui+1 < Mu)
-      if(invu[ui+1] > -1){
-	A[j] = i;
-	B[j] = invu[ui+1];
-	D[j] = 1;
-	j++;
-      }
-    if (ui > 0)
-      if(invu[ui-1] > -1){
-	A[j] = i;
-	B[j] = invu[ui-1];
-	D[j] = 1;
-	j++;
-      }
-    if (ui+Mx < Mu)
-      if(invu[ui+Mx]>-1){
-	A[j] = i;
-	B[j] = invu[ui+Mx];
-	D[j] = 1;
-	j++;
-      }
-    if (ui+1 > Mx)
-      if(invu[ui-Mx]>-1){
-	A[j] = i;
-	B[j] = invu[ui-Mx];
-	D[j] = 1;
-	j++;
-      }
-    if (ui+Mxy<Mu)
-      if(invu[ui + Mxy]>-1){
-	A[j] = i;
-	B[j] = invu[ui + Mxy];
-	D[j] = 1;
-	j++;
-      }
-    if (ui+1>Mxy)
-      if(invu[ui-Mxy]>-1){
-	A[j] = i;
-	B[j] = invu[ui-Mxy];
-	D[j] = 1;
-	j++;
-      }
-  }
-  E = j;
-
-  thisone = fff_graph_build(N,E,A,B,D);
-  
-  *G = thisone;
+  if (S == NULL)
+    return;
+  free(S->u);
+  free(S->index);
+  free(S);
+}
 
-  free(u);
-  free(invu);
-  free(A);
-  free(B);
-  free(D);
-  return(E);
-} 
+/* Edges from the vertex i of an implicit graph, written in (nn,nw);
+   the first one links i to itself, even if another vertex has the
+   same coordinates */
+static long _fff_graph_stencil_neighb(long* nn, double* nw, const fff_graph_stencil* S, const long i)
+{
+  long s, v, n = 1;
+  long ui = S->u[i];
+
+  nn[0] = i;
+  nw[0] = S->weight[0];
+  for (s=1 ; s<S->k ; s++){
+    v = ui + S->offset[s];
+    if ((v < 0) || (v >= S->U))
+      continue;
+    if (S->index[v] < 0)
+      continue;
+    nn[n] = S->index[v];
+    nw[n] = S->weight[s];
+    n++;
+  }
+  return(n);
+}
 
-long fff_graph_grid_eighteen(fff_graph** G, const long* xyz, const long N)
+long fff_graph_grid_stencil(fff_graph** G, const long* xyz, const long N, const long k)
 {
-  /*   char* proc = "fff_graph_grid_eighteen"; */
   fff_graph* thisone;
-  
+  fff_graph_stencil* S;
+  long i, s, t, nz, Mx = 1, Mxy = 1;
   long E = 0;
-  long i,j;
-  long Mx,Mxy,Mu,ui;
-  long *u, *A, *B, *invu; 
-  double *D; 
+  long nn[FFF_GRAPH_STENCIL_MAX];
+  double nw[FFF_GRAPH_STENCIL_MAX];
+  const double weights[4] = {0, 1, _SQRT2, _SQRT3};
 
-  u = ( long*) calloc( N,sizeof(long));
-  if (!u) {
-    FFF_WARNING("calloc failed, graph to big?\n");
-    return(0);
-  }
-  A = ( long*) calloc( N*19,sizeof(long));
-  if (!A) {
-    FFF_WARNING("calloc failed, graph to big?\n");
-    return(0);
-  }
-  B = ( long*) calloc( N*19,sizeof(long));
-  if (!B) {
-    FFF_WARNING("calloc failed, graph to big?\n");
-    return(0);
-  }
-  D = (double*) calloc( N*19,sizeof(double));
-  if (!D) {
+  if ((k!=6)&&(k!=18)&&(k!=26))
+    FFF_WARNING("Wrong value for k. Corrected to k=6\n");
+
+  thisone = (fff_graph*) calloc(1, sizeof(fff_graph));
+  S = (fff_graph_stencil*) calloc(1, sizeof(fff_graph_stencil));
+  if (S != NULL)
+    S->u = (long*) calloc(FFF_MAX(N,1), sizeof(long));
+  if ((thisone == NULL) || (S == NULL) || (S->u == NULL)){
     FFF_WARNING("calloc failed, graph to big?\n");
+    free(thisone);
+    _fff_graph_stencil_delete(S);
     return(0);
   }
 
-  _fff_graph_preprocess_grid(u,&Mx,&Mxy, &Mu,N,xyz);
- 
-  /* find  invu such that  invu[u[i]]=i */
-  invu = (long*) calloc( Mu,sizeof(long));
-  if (!invu) {
+  /* voxel index of the bounding box */
+  if (N > 0)
+    _fff_graph_preprocess_grid(S->u, &Mx, &Mxy, &(S->U), N, xyz);
+  S->index = (long*) calloc(FFF_MAX(S->U,1), sizeof(long));
+  if (S->index == NULL){
     FFF_WARNING("calloc failed, graph to big?\n");
+    free(thisone);
+    _fff_graph_stencil_delete(S);
     return(0);
   }
-  for (i=0 ; i<(Mu) ; i++) invu[i]=-1;   
-  for (i=0 ; i<N ; i++) invu[u[i]]=i;    
- 
-  /* Search for neighbours*/
-  j=0;
-  for (i=0 ; i<N ; i++){ 
-    /* the base polong istelf */
-    A[j] = i;
-    B[j] = i;
-    D[j] = 0;
-    j++;   
-    ui = u[i];
-    /*6 neighbours at  distance 1*/
-    if (ui+1 < Mu)
-      if(invu[ui+1] > -1){
-	A[j] = i;
-	B[j] = invu[ui+1];
-	D[j] = 1;
-	j++;
-      }
-    if (ui > 0)
-      if(invu[ui-1] > -1){
-	A[j] = i;
-	B[j] = invu[ui-1];
-	D[j] = 1;
-	j++;
-      }
-    if (ui+Mx < Mu)
-      if(invu[ui+Mx]>-1){
-	A[j] = i;
-	B[j] = invu[ui+Mx];
-	D[j] = 1;
-	j++;
-      }
-    if (ui+1 > Mx)
-      if(invu[ui-Mx]>-1){
-	A[j] = i;
-	B[j] = invu[ui-Mx];
-	D[j] = 1;
-	j++;
-      }
-    if (ui+Mxy <Mu )
-     if(invu[ui + Mxy]>-1){
-      A[j] = i;
-      B[j] = invu[ui + Mxy];
-      D[j] = 1;
-      j++;
-    }
-    if (ui+1>Mxy)
-      if(invu[ui-Mxy]>-1){
-	A[j] = i;
-	B[j] = invu[ui-Mxy];
-	D[j] = 1;
-	j++;
-      }
-      /*12 neighbours at sqrt(2) distance*/
-    if (ui+Mx+1 < Mu)
-      if(invu[ui+1+Mx]>-1){
-	A[j] = i;
-	B[j] = invu[ui+1+Mx];
-	D[j] = _SQRT2;
-	j++;
-      }
-    if (ui>Mx)
-      if(invu[ui-1-Mx]>-1){
-	A[j] = i;
-	B[j] = invu[ui-1-Mx];
-	D[j] = _SQRT2;
-	j++;
-      }
-    if (ui+Mx<Mu+1)
-      if(invu[ui-1+Mx]>-1){
-	A[j] = i;
-	B[j] = invu[ui-1+Mx];
-	D[j] = _SQRT2;
-	j++;
-      }
-    if (ui+2>Mx)
-      if(invu[ui+1-Mx]>-1){
-	A[j] = i;
-	B[j] = invu[ui+1-Mx];
-	D[j] = _SQRT2;
-	j++;
-      }
-    if (ui+Mxy+1<Mu)
-      if(invu[ui+1+Mxy]>-1){
-	A[j] = i;
-	B[j] = invu[ui+1+Mxy];
-	D[j] = _SQRT2;
-	j++;
-      }
-    if (ui>Mxy)
-      if(invu[ui-1-Mxy]>-1){
-	A[j] = i;
-	B[j] = invu[ui-1-Mxy];
-	D[j] = _SQRT2;
-	j++;
-      }
-    if (ui+Mxy<Mu+1)
-      if(invu[ui-1+Mxy]>-1){
-	A[j] = i;
-	B[j] = invu[ui-1+Mxy];
-	D[j] = _SQRT2;
-	j++;
-      }
-    if (ui+2>Mxy)
-      if(invu[ui+1-Mxy]>-1){
-	A[j] = i;
-	B[j] = invu[ui+1-Mxy];
-	D[j] = _SQRT2;
-	j++;
-      }
-    if (ui+Mx+Mxy<Mu)
-      if(invu[ui+Mxy+Mx]>-1){
-	A[j] = i;
-	B[j] = invu[ui+Mxy+Mx];
-	D[j] = _SQRT2;
-	j++;
-      }
-    if (ui+1>Mx+Mxy)
-      if(invu[ui-Mxy-Mx]>-1){
-	A[j] = i;
-	B[j] = invu[ui-Mxy-Mx];
-	D[j] = _SQRT2;
-	j++;
-      }
-    if (ui+Mxy<Mu+Mx)
-      if(invu[ui+Mxy-Mx]>-1){
-	A[j] = i;
-	B[j] = invu[ui+Mxy-Mx];
-	D[j] = _SQRT2;
-	j++;
-      }
-    if (ui+Mx+1>+Mxy)
-      if(invu[ui-Mxy+Mx]>-1){
-	A[j] = i;
-	B[j] = invu[ui-Mxy+Mx];
-	D[j] = _SQRT2;
-	j++;
-      }
+  for (i=0 ; i<S->U ; i++) 
+    S->index[i] = -1;
+  for (i=0 ; i<N ; i++) 
+    S->index[S->u[i]] = i;
+
+  /* stencil */
+  S->k = ((k==18)||(k==26)) ? k+1 : 7;
+  for (s=0 ; s<S->k ; s++){
+    nz = 0;
+    for (t=0 ; t<3 ; t++)
+      nz += (_fff_graph_stencil_steps[s][t] != 0);
+    S->offset[s] = _fff_graph_stencil_steps[s][0] + _fff_graph_stencil_steps[s][1]*Mx 
+      + _fff_graph_stencil_steps[s][2]*Mxy;
+    S->weight[s] = weights[nz];
   }
 
-  E = j;
-  thisone = fff_graph_build(N,E,A,B,D);
-  
+  for (i=0 ; i<N ; i++)
+    E += _fff_graph_stencil_neighb(nn, nw, S, i);
+
+  thisone->V = N;
+  thisone->E = E;
+  thisone->grid = S;
   *G = thisone;
+  return(E);
+}
 
-  free(u);
-  free(invu);
-  free(A);
-  free(B);
-  free(D);
-  return(E);
-} 
-
-
-long fff_graph_grid_twenty_six(fff_graph** G, const long* xyz, const long N)
+/* Explicit grid graphs are expanded from the implicit one, which
+   lists the edges in the same order */
+static long _fff_graph_grid_expand(fff_graph** G, const long* xyz, const long N, const long k)
 {
-  /*  char* proc = "fff_graph_grid_twenty_six"; */
-  
-  fff_graph * thisone;
-  
-  long E = 0;
-  long i,j;
-  long Mx,Mxy,Mu,ui;
-  long *u, *A, *B, *invu; 
-  double *D; 
-
-  u = ( long*) calloc( N,sizeof(long));
-  if (!u) return(0);
-  A = ( long*) calloc( N*27,sizeof(long));
-  if (!A) return(0);
-  B = ( long*) calloc( N*27,sizeof(long));
-  if (!B) return(0);
-  D = (double*) calloc( N*27,sizeof(double));
-  if (!D) return(0);
-
-  _fff_graph_preprocess_grid(u,&Mx,&Mxy, &Mu,N,xyz);
- 
-  /* find  invu such that  invu[u[i]]=i */
-  invu = (long*) calloc( Mu,sizeof(long));
-  if (!invu) return(0);
-  for (i=0 ; i<(Mu) ; i++) invu[i]=-1;   
-  for (i=0 ; i<N ; i++) invu[u[i]]=i;    
- 
-  /* Search for neighbours*/
-  j=0;
-  for (i=0 ; i<N ; i++){ 
-    /* the base polong istelf */
-    A[j] = i;
-    B[j] = i;
-    D[j] = 0;
-    j++;   
-    ui = u[i];
-    /*6 neighbours at  distance 1*/
-    if (ui+1 < Mu)
-      if(invu[ui+1] > -1){
-	A[j] = i;
-	B[j] = invu[ui+1];
-	D[j] = 1;
-	j++;
-      }
-    if (ui > 0)
-      if(invu[ui-1] > -1){
-	A[j] = i;
-	B[j] = invu[ui-1];
-	D[j] = 1;
-	j++;
-      }
-    if (ui+Mx < Mu)
-      if(invu[ui+Mx]>-1){
-	A[j] = i;
-	B[j] = invu[ui+Mx];
-	D[j] = 1;
-	j++;
-      }
-    if (ui+1 > Mx)
-      if(invu[ui-Mx]>-1){
-	A[j] = i;
-	B[j] = invu[ui-Mx];
-	D[j] = 1;
-	j++;
-      }
-    if (ui+Mxy<Mu)
-     if(invu[ui + Mxy]>-1){
-      A[j] = i;
-      B[j] = invu[ui + Mxy];
-      D[j] = 1;
-	j++;
-    }
-    if (ui+1>Mxy)
-      if(invu[ui-Mxy]>-1){
-	A[j] = i;
-	B[j] = invu[ui-Mxy];
-	D[j] = 1;
-	j++;
-      }
-      /*12 neighbours at sqrt(2) distance*/
-    
-    if (ui+Mx+1<Mu)
-      if(invu[ui+1+Mx]>-1){
-	A[j] = i;
-	B[j] = invu[ui+1+Mx];
-	D[j] = _SQRT2;
-	j++;
-      }
-    if (ui>Mx)
-      if(invu[ui-1-Mx]>-1){
-	A[j] = i;
-	B[j] = invu[ui-1-Mx];
-	D[j] = _SQRT2;
-	j++;
-      }
-    if (ui+Mx<Mu+1)
-      if(invu[ui-1+Mx]>-1){
-	A[j] = i;
-	B[j] = invu[ui-1+Mx];
-	D[j] = _SQRT2;
-	j++;
-      }
-    if (ui+2>Mx)
-      if(invu[ui+1-Mx]>-1){
-	A[j] = i;
-	B[j] = invu[ui+1-Mx];
-	D[j] = _SQRT2;
-	j++;
-      }
-    if (ui+Mxy+1<Mu)
-      if(invu[ui+1+Mxy]>-1){
-	A[j] = i;
-	B[j] = invu[ui+1+Mxy];
-	D[j] = _SQRT2;
-	j++;
-      }
-    if (ui>Mxy)
-      if(invu[ui-1-Mxy]>-1){
-	A[j] = i;
-	B[j] = invu[ui-1-Mxy];
-	D[j] = _SQRT2;
-	j++;
-      }
-    if (ui+Mxy<Mu+1)
-      if(invu[ui-1+Mxy]>-1){
-	A[j] = i;
-	B[j] = invu[ui-1+Mxy];
-	D[j] = _SQRT2;
-	j++;
-      }
-    if (ui+2>Mxy)
-      if(invu[ui+1-Mxy]>-1){
-	A[j] = i;
-	B[j] = invu[ui+1-Mxy];
-	D[j] = _SQRT2;
-	j++;
-	}
-    if (ui+Mx+Mxy<Mu)
-      if(invu[ui+Mxy+Mx]>-1){
-	A[j] = i;
-	B[j] = invu[ui+Mxy+Mx];
-	D[j] = _SQRT2;
-	j++;
-	}
-    if (ui+1>Mx+Mxy)
-      if(invu[ui-Mxy-Mx]>-1){
-	A[j] = i;
-	B[j] = invu[ui-Mxy-Mx];
-	D[j] = _SQRT2;
-	j++;
-      }
-    if (ui+Mxy<Mu+Mx)
-      if(invu[ui+Mxy-Mx]>-1){
-	A[j] = i;
-	B[j] = invu[ui+Mxy-Mx];
-	D[j] = _SQRT2;
-	j++;
-      }
-    if (ui+Mx+1>+Mxy)
-      if(invu[ui-Mxy+Mx]>-1){
-	A[j] = i;
-	B[j] = invu[ui-Mxy+Mx];
-	D[j] = _SQRT2;
-	j++;
-	}
-       
-    /*8 neighbours at srt(3) distance*/
-    if (ui+Mxy+1<Mu+Mx)
-      if(invu[ui+Mxy-Mx+1]>-1){
-	A[j] = i;
-	B[j] = invu[ui+Mxy-Mx+1];
-	D[j] = _SQRT3;
-	j++;
-      }
-    if (ui+Mxy<Mu+Mx+1)
-      if(invu[ui+Mxy-Mx-1]>-1){
-	A[j] = i;
-	B[j] = invu[ui+Mxy-Mx-1];
-	D[j] = _SQRT3;
-	j++;
-      }
-    if (ui+Mxy+Mx<Mu+1)
-      if(invu[ui+Mxy+Mx-1]>-1){
-	A[j] = i;
-	B[j] = invu[ui+Mxy+Mx-1];
-	D[j] = _SQRT3;
-	j++;
-      }
-    if (ui+Mxy+Mx+1<Mu)
-      if(invu[ui+Mxy+Mx+1]>-1){
-	A[j] = i;
-	B[j] = invu[ui+Mxy+Mx+1];
-	D[j] = _SQRT3;
-	j++;
-      } 
-      
-    if (ui+Mx>Mxy)
-      if(invu[ui-Mxy+Mx-1]>-1){
-	A[j] = i;
-	B[j] = invu[ui-Mxy+Mx-1];
-	D[j] = _SQRT3;
-	j++;
-      }
-    if (ui>Mxy+Mx)
-      if(invu[ui-Mxy-Mx-1]>-1){
-	A[j] = i;
-	B[j] = invu[ui-Mxy-Mx-1];
-	D[j] = _SQRT3;
-	j++;
-      }
-    if (ui+Mx+2>Mxy)
-      if(invu[ui-Mxy+Mx+1]>-1){
-	A[j] = i;
-	B[j] = invu[ui-Mxy+Mx+1];
-	D[j] = _SQRT3;
-	j++;
-      }
-    if (ui+2>Mxy+Mx)
-      if(invu[ui-Mxy-Mx+1]>-1){
-	A[j] = i;
-	B[j] = invu[ui-Mxy-Mx+1];
-	D[j] = _SQRT3;
-	j++;
-      } 
-    
-  }
-  E = j;
-  thisone = fff_graph_build(N,E,A,B,D);
-  
-  *G = thisone;
+  fff_graph* K = NULL;
+  long E;
 
-  free(u);
-  free(invu);
-  free(A);
-  free(B);
-  free(D);
-  return(E);
-} 
+  fff_graph_grid_stencil(&K, xyz, N, k);
+  if (K == NULL)
+    return(0);
+  E = fff_graph_explicit(G, K);
+  fff_graph_delete(K);
+  return(FFF_MAX(E,0));
+}
 
-static void _fff_graph_preprocess_vgrid( long*u, long*MMx, long* MMxy, long* MMu,  const fff_array* xyz)
+long fff_graph_grid_six(fff_graph** G, const long* xyz, const long N)
 {
-  /*   char* proc = "fff_graph_preprocess_grid"; */
-  long i;
-  long mx,my,mz,Mx,My,Mxy,Mu;
-  long N = xyz->dimX;
-
-  /* Find minimal/maximal values of (x,y,z) */
-  mx = fff_array_get2d(xyz,0,0);
-  my = fff_array_get2d(xyz,0,1);
-  mz = fff_array_get2d(xyz,0,2);
-  Mx = fff_array_get2d(xyz,0,0);
-  My = fff_array_get2d(xyz,0,1);
-  
-  for (i=0 ; i<N ; i++){
-    if (fff_array_get2d(xyz,i,0)<mx) mx = fff_array_get2d(xyz,i,0);
-    if (fff_array_get2d(xyz,i,1)<my) my = fff_array_get2d(xyz,i,1);
-    if (fff_array_get2d(xyz,i,2)<mz) mz = fff_array_get2d(xyz,i,2);   
-    if (fff_array_get2d(xyz,i,0)>Mx) Mx = fff_array_get2d(xyz,i,0);
-    if (fff_array_get2d(xyz,i,1)>My) My = fff_array_get2d(xyz,i,1); 
-    /* printf(" %d ",fff_array_get2d(xyz,i,1)); */
-  }
-  /* printf(" %d %d %d %d %d \n",mx,my,mz,Mx,My);*/
-  
-  Mx = Mx-mx+2;
-  My = My-my+2;
-  Mxy = Mx*My;
-  Mu = 0;
+  return(_fff_graph_grid_expand(G, xyz, N, 6));
+}
 
- 
+long fff_graph_grid_eighteen(fff_graph** G, const long* xyz, const long N)
+{
+  return(_fff_graph_grid_expand(G, xyz, N, 18));
+}
 
-  /* Code (x,y,z) by a scalar u*/
-  for (i=0 ; i<N ; i++){
-    u[i] = fff_array_get2d(xyz,i,0)-mx + (fff_array_get2d(xyz,i,1)-my)*Mx + (fff_array_get2d(xyz,i,2)-mz)*Mxy;
-    if (u[i]>Mu) Mu = u[i];
-  }
-  Mu = Mu+1;  
-  
-  *MMx = Mx;
-  *MMxy = Mxy;
-  *MMu = Mu;
+long fff_graph_grid_twenty_six(fff_graph** G, const long* xyz, const long N)
+{
+  return(_fff_graph_grid_expand(G, xyz, N, 26));
 }
 
 long fff_graph_grid(fff_graph** G, const fff_array* xyz, const long k)
 {
-  
-  fff_graph * thisone;  
-  long E = 0;
-  long i,j;
-  long Mx,Mxy,Mu,ui;
-  long q = 6;
-  long *u, *A, *B, *invu; 
-  double *D; 
+  long i, t, E;
+  long N = xyz->dimX;
+  long *lxyz; 
 
-  /* printf("%d %d \n",xyz->size1,xyz->size2); */
-  
   /* argument checking */
-  long N = xyz->dimX;
   if (( xyz->dimY !=3)||(N<1)){
     FFF_WARNING("Incorrect grid matrix supplied\n");
     FFF_ERROR("Incorrect grid matrix supplied\n", EDOM);
     return(0);
   }
-  if ((k!=6)&&(k!=18)&&(k!=26)) {
-    FFF_WARNING("Wrong value for k. Corrected to k=6\n");
-  }
-  else
-    q=k;
-  
-  
-  u = ( long*) calloc( N,sizeof(long));
-  if (!u) {
-    FFF_WARNING(" calloc failed. The graph is too big?");
-    return(0);
-  }
-  A = ( long*) calloc( N*(q+1),sizeof(long));
-  if (!A) {
-    FFF_WARNING(" calloc failed. The graph is too big?");
-    return(0);
-  }
-  B = ( long*) calloc( N*(q+1),sizeof(long));
-  if (!B) {
-    FFF_WARNING(" calloc failed. The graph is too big?");
-    return(0);
-  }
-  D = (double*) calloc( N*(q+1),sizeof(double));
-  if (!D) {
-    FFF_WARNING(" calloc failed. The graph is too big?");
-    return(0);
-  }
 
-  _fff_graph_preprocess_vgrid(u,&Mx,&Mxy, &Mu,xyz);
- 
-  /* find  invu such that  invu[u[i]]=i */
-  invu = (long*) calloc( Mu,sizeof(long));
-  if (!invu) {
+  lxyz = (long*) calloc(3*N, sizeof(long));
+  if (!lxyz) {
     FFF_WARNING(" calloc failed. The graph is too big?");
     return(0);
   }
-  for (i=0 ; i<(Mu) ; i++) invu[i]=-1;   
-  for (i=0 ; i<N ; i++) invu[u[i]]=i;    
- 
-  /* Search for neighbours*/
-  j=0;
-  for (i=0 ; i<N ; i++){ 
-    /* the base polong istelf */
-    A[j] = i;
-    B[j] = i;
-    D[j] = 0;
-    j++;   
-    ui = u[i];
-    /*6 neighbours at  distance 1*/
-    if (ui+1 < Mu)
-      if(invu[ui+1] > -1){
-	A[j] = i;
-	B[j] = invu[ui+1];
-	D[j] = 1;
-	j++;
-      }
-    if (ui > 0)
-      if(invu[ui-1] > -1){
-	A[j] = i;
-	B[j] = invu[ui-1];
-	D[j] = 1;
-	j++;
-      }
-    if (ui+Mx < Mu)
-      if(invu[ui+Mx]>-1){
-	A[j] = i;
-	B[j] = invu[ui+Mx];
-	D[j] = 1;
-	j++;
-      }
-    if (ui+1 > Mx)
-      if(invu[ui-Mx]>-1){
-	A[j] = i;
-	B[j] = invu[ui-Mx];
-	D[j] = 1;
-	j++;
-      }
-    if (ui+Mxy<Mu)
-     if(invu[ui + Mxy]>-1){
-      A[j] = i;
-      B[j] = invu[ui + Mxy];
-      D[j] = 1;
-	j++;
-    }
-    if (ui+1>Mxy)
-      if(invu[ui-Mxy]>-1){
-	A[j] = i;
-	B[j] = invu[ui-Mxy];
-	D[j] = 1;
-	j++;
-      }
-    if (q>6){
-      /*12 neighbours at sqrt(2) distance*/
-      
-      if (ui+Mx+1<Mu)
-	if(invu[ui+1+Mx]>-1){
-	  A[j] = i;
-	  B[j] = invu[ui+1+Mx];
-	  D[j] = _SQRT2;
-	  j++;
-	}
-      if (ui>Mx)
-	if(invu[ui-1-Mx]>-1){
-	  A[j] = i;
-	  B[j] = invu[ui-1-Mx];
-	  D[j] = _SQRT2;
-	  j++;
-	}
-      if (ui+Mx<Mu+1)
-	if(invu[ui-1+Mx]>-1){
-	  A[j] = i;
-	  B[j] = invu[ui-1+Mx];
-	  D[j] = _SQRT2;
-	  j++;
-	}
-      if (ui+2>Mx)
-	if(invu[ui+1-Mx]>-1){
-	  A[j] = i;
-	  B[j] = invu[ui+1-Mx];
-	  D[j] = _SQRT2;
-	  j++;
-	}
-      if (ui+Mxy+1<Mu)
-	if(invu[ui+1+Mxy]>-1){
-	  A[j] = i;
-	  B[j] = invu[ui+1+Mxy];
-	  D[j] = _SQRT2;
-	  j++;
-	}
-      if (ui>Mxy)
-	if(invu[ui-1-Mxy]>-1){
-	  A[j] = i;
-	  B[j] = invu[ui-1-Mxy];
-	  D[j] = _SQRT2;
-	  j++;
-	}
-      if (ui+Mxy<Mu+1)
-	if(invu[ui-1+Mxy]>-1){
-	  A[j] = i;
-	  B[j] = invu[ui-1+Mxy];
-	  D[j] = _SQRT2;
-	  j++;
-	}
-      if (ui+2>Mxy)
-	if(invu[ui+1-Mxy]>-1){
-	  A[j] = i;
-	  B[j] = invu[ui+1-Mxy];
-	  D[j] = _SQRT2;
-	  j++;
-	}
-      if (ui+Mx+Mxy<Mu)
-	if(invu[ui+Mxy+Mx]>-1){
-	  A[j] = i;
-	  B[j] = invu[ui+Mxy+Mx];
-	  D[j] = _SQRT2;
-	  j++;
-	}
-      if (ui+1>Mx+Mxy)
-	if(invu[ui-Mxy-Mx]>-1){
-	  A[j] = i;
-	  B[j] = invu[ui-Mxy-Mx];
-	  D[j] = _SQRT2;
-	  j++;
-	}
-      if (ui+Mxy<Mu+Mx)
-	if(invu[ui+Mxy-Mx]>-1){
-	  A[j] = i;
-	  B[j] = invu[ui+Mxy-Mx];
-	  D[j] = _SQRT2;
-	  j++;
-	}
-      if (ui+Mx+1>+Mxy)
-	if(invu[ui-Mxy+Mx]>-1){
-	  A[j] = i;
-	  B[j] = invu[ui-Mxy+Mx];
-	  D[j] = _SQRT2;
-	  j++;
-	}
-      if (q>18){
-	/*8 neighbours at srt(3) distance*/
-	if (ui+Mxy+1<Mu+Mx)
-	  if(invu[ui+Mxy-Mx+1]>-1){
-	    A[j] = i;
-	    B[j] = invu[ui+Mxy-Mx+1];
-	    D[j] = _SQRT3;
-	    j++;
-	  }
-	if (ui+Mxy<Mu+Mx+1)
-	  if(invu[ui+Mxy-Mx-1]>-1){
-	    A[j] = i;
-	    B[j] = invu[ui+Mxy-Mx-1];
-	    D[j] = _SQRT3;
-	    j++;
-	  }
-	if (ui+Mxy+Mx<Mu+1)
-	  if(invu[ui+Mxy+Mx-1]>-1){
-	    A[j] = i;
-	    B[j] = invu[ui+Mxy+Mx-1];
-	    D[j] = _SQRT3;
-	    j++;
-	  }
-	if (ui+Mxy+Mx+1<Mu)
-	  if(invu[ui+Mxy+Mx+1]>-1){
-	    A[j] = i;
-	    B[j] = invu[ui+Mxy+Mx+1];
-	    D[j] = _SQRT3;
-	    j++;
-	  } 
-	
-	if (ui+Mx>Mxy)
-	  if(invu[ui-Mxy+Mx-1]>-1){
-	    A[j] = i;
-	    B[j] = invu[ui-Mxy+Mx-1];
-	    D[j] = _SQRT3;
-	    j++;
-	  }
-	if (ui>Mxy+Mx)
-	  if(invu[ui-Mxy-Mx-1]>-1){
-	    A[j] = i;
-	    B[j] = invu[ui-Mxy-Mx-1];
-	    D[j] = _SQRT3;
-	    j++;
-	  }
-	if (ui+Mx+2>Mxy)
-	  if(invu[ui-Mxy+Mx+1]>-1){
-	    A[j] = i;
-	    B[j] = invu[ui-Mxy+Mx+1];
-	    D[j] = _SQRT3;
-	    j++;
-	  }
-	if (ui+2>Mxy+Mx)
-	  if(invu[ui-Mxy-Mx+1]>-1){
-	    A[j] = i;
-	    B[j] = invu[ui-Mxy-Mx+1];
-	    D[j] = _SQRT3;
-	    j++;
-	  } 
-      }
-    }
-  }
-  E = j;
+  for (i=0 ; i<N ; i++)
+    for (t=0 ; t<3 ; t++)
+      lxyz[i+t*N] = fff_array_get2d(xyz,i,t);
   
-  thisone = fff_graph_build(N,E,A,B,D);
-  if (thisone == NULL) {
-    FFF_WARNING("fff_graph_build failed");
-    return(-1);
-  }
- 
-  *G = thisone;
-
-  free(u);
-  free(invu);
-  free(A);
-  free(B);
-  free(D);
+  E = _fff_graph_grid_expand(G, lxyz, N, k);
+  free(lxyz);
   return(E);
 } 
 
@@ -2369,6 +1838,7 @@ double fff_graph_MST_old(fff_graph* G,const fff_matrix* X)
   long* label; 
   long q;  
   
+  fff_graph_uncompile(G);
   /* labels Initialization */
   label = (long*) calloc( V,sizeof(long));
 
@@ -2461,25 +1931,274 @@ double fff_graph_MST_old(fff_graph* G,const fff_matrix* X)
   return(length);
 }
 
-double fff_graph_MST(fff_graph* G,const fff_matrix* X)
+/* Minimal single links of the components in Boruvka's algorithm. Each
+   thread scans its own share of the candidate links and keeps the
+   best ones of each component in its own buffers; they are then
+   merged so that ties are broken as in a serial scan: for the MST,
+   the first pair (n1,n2), n2<n1, in lexicographic order, and for the
+   skeleton the link of lowest rank key, which is the edge index, or
+   i*FFF_GRAPH_STENCIL_MAX+j for the j-th neighbour of vertex i of an
+   implicit graph. */
+typedef struct {
+  const fff_matrix* X;          /* MST: points */
+  const fff_graph* G;           /* skeleton: graph */
+  const fff_graph_neighb* N;    /* skeleton: stencil of an implicit graph */
+  const long* label;
+  long nbcc;
+  double maxdist;
+  double** mindist;             /* best links of each thread (nbcc) */
+  long** amd;
+  long** imd;
+  long** key;                   /* skeleton: rank of the links */
+} _fff_graph_boruvka_job;
+
+static void _fff_graph_MST_job_run(int rank, int nthreads, void* params)
+{
+  _fff_graph_boruvka_job* job = (_fff_graph_boruvka_job*)params;
+  long V = job->X->size1, T = job->X->size2, tda = job->X->tda;
+  const long* label = job->label;
+  double *mindist = job->mindist[rank];
+  long *amd = job->amd[rank], *imd = job->imd[rank];
+  const double *x1, *x2;
+  double ndist, auxdist, dx;
+  long i, n1, n2, j, k, t;
+
+  for (i=0; i<job->nbcc; i++)
+    mindist[i] = job->maxdist;
+
+  for (n1=rank ; n1<V ; n1+=nthreads){
+    j = label[n1];
+    x1 = job->X->data + n1*tda;
+    for ( n2=0 ; n2<n1 ; n2++){
+      k = label[n2];
+      if (j!=k){
+	auxdist = FFF_MAX(mindist[j],mindist[k]);
+	x2 = job->X->data + n2*tda;
+	ndist = 0;
+	for ( t=0 ; t<T ; t++){
+	  dx = x1[t]-x2[t];
+	  ndist += dx*dx;
+	  if (ndist>auxdist) break;
+	}
+	if (ndist<mindist[j]) {
+	  mindist[j] = ndist;
+	  amd[j] = n1;
+	  imd[j] = n2;
+	}
+	if (ndist<mindist[k]){
+	  mindist[k] = ndist;
+	  amd[k] = n2;
+	  imd[k] = n1;
+	}
+      }
+    }
+  }
+}
+
+/* Candidate link (n1,n2) of the component of n1 */
+static void _fff_graph_skeleton_link(_fff_graph_boruvka_job* job, double *mindist, long *amd, long *imd, long *key,
+				     const long n1, const long n2, const double ndist, const long rank)
+{
+  long j = job->label[n1];
+  long k = job->label[n2];
+
+  if (j==k)
+    return;
+  if (ndist<mindist[j]) {
+    mindist[j] = ndist;
+    amd[j] = n1;
+    imd[j] = n2;
+    key[j] = rank;
+  }
+  if (ndist<mindist[k]){
+    mindist[k] = ndist;
+    amd[k] = n2;
+    imd[k] = n1;
+    key[k] = rank;
+  }
+}
+
+static void _fff_graph_skeleton_job_run(int rank, int nthreads, void* params)
+{
+  _fff_graph_boruvka_job* job = (_fff_graph_boruvka_job*)params;
+  const fff_graph* G = job->G;
+  double *mindist = job->mindist[rank];
+  long *amd = job->amd[rank], *imd = job->imd[rank], *key = job->key[rank];
+  long i, j, d, e;
+  size_t start, stop;
+  fff_graph_neighb N;
+  const long *nn;
+  const double *nw;
+
+  for (i=0; i<job->nbcc; i++)
+    mindist[i] = job->maxdist;
+
+  if (job->N == NULL){
+    fff_parallel_range(G->E, rank, nthreads, &start, &stop);
+    for (e=(long)start ; e<(long)stop ; e++)
+      _fff_graph_skeleton_link(job, mindist, amd, imd, key, G->eA[e], G->eB[e], G->eD[e], e);
+    return;
+  }
+  N = *(job->N);
+  fff_parallel_range(G->V, rank, nthreads, &start, &stop);
+  for (i=(long)start ; i<(long)stop ; i++){
+    d = fff_graph_neighb_get(&N, i, &nn, &nw);
+    for (j=0 ; j<d ; j++)
+      _fff_graph_skeleton_link(job, mindist, amd, imd, key, i, nn[j], nw[j], i*FFF_GRAPH_STENCIL_MAX+j);
+  }
+}
+
+/* Merge the best links of the threads into those of thread 0 */
+static void _fff_graph_boruvka_merge(_fff_graph_boruvka_job* job, const int nthreads)
+{
+  long i, a0, b0, a1, b1;
+  int t, first;
+  double *m0 = job->mindist[0], *m1;
+
+  for (t=1 ; t<nthreads ; t++){
+    m1 = job->mindist[t];
+    for (i=0 ; i<job->nbcc ; i++){
+      if ((m1[i] > m0[i]) || (m1[i] == job->maxdist))
+	continue;
+      if (m1[i] == m0[i]){
+	if (job->key != NULL)
+	  first = (job->key[t][i] < job->key[0][i]);
+	else {
+	  a0 = FFF_MAX(job->amd[0][i], job->imd[0][i]);
+	  b0 = FFF_MIN(job->amd[0][i], job->imd[0][i]);
+	  a1 = FFF_MAX(job->amd[t][i], job->imd[t][i]);
+	  b1 = FFF_MIN(job->amd[t][i], job->imd[t][i]);
+	  first = ((a1 < a0) || ((a1 == a0) && (b1 < b0)));
+	}
+	if (!first)
+	  continue;
+      }
+      m0[i] = m1[i];
+      job->amd[0][i] = job->amd[t][i];
+      job->imd[0][i] = job->imd[t][i];
+      if (job->key != NULL)
+	job->key[0][i] = job->key[t][i];
+    }
+  }
+}
+
+static void _fff_graph_boruvka_delete(_fff_graph_boruvka_job* job)
+{
+  if (job->mindist != NULL)
+    free(job->mindist[0]);
+  if (job->amd != NULL)
+    free(job->amd[0]);
+  if (job->imd != NULL)
+    free(job->imd[0]);
+  if (job->key != NULL)
+    free(job->key[0]);
+  free(job->mindist);
+  free(job->amd);
+  free(job->imd);
+  free(job->key);
+}
+
+/* Buffers of nthreads threads, for V components; returns 1 if memory
+   is lacking */
+static int _fff_graph_boruvka_new(_fff_graph_boruvka_job* job, const long V, const int nthreads, const int haskey)
+{
+  int t;
+  long n = FFF_MAX(V,1);
+
+  job->mindist = (double**) calloc(nthreads, sizeof(double*));
+  job->amd = (long**) calloc(nthreads, sizeof(long*));
+  job->imd = (long**) calloc(nthreads, sizeof(long*));
+  job->key = haskey ? (long**) calloc(nthreads, sizeof(long*)) : NULL;
+  if ((job->mindist == NULL) || (job->amd == NULL) || (job->imd == NULL) || (haskey && (job->key == NULL))){
+    _fff_graph_boruvka_delete(job);
+    return 1;
+  }
+  job->mindist[0] = (double*) calloc(n*nthreads, sizeof(double));
+  job->amd[0] = (long*) calloc(n*nthreads, sizeof(long));
+  job->imd[0] = (long*) calloc(n*nthreads, sizeof(long));
+  if (haskey)
+    job->key[0] = (long*) calloc(n*nthreads, sizeof(long));
+  if ((job->mindist[0] == NULL) || (job->amd[0] == NULL) || (job->imd[0] == NULL) || (haskey && (job->key[0] == NULL))){
+    _fff_graph_boruvka_delete(job);
+    return 1;
+  }
+  for (t=1 ; t<nthreads ; t++){
+    job->mindist[t] = job->mindist[0] + t*n;
+    job->amd[t] = job->amd[0] + t*n;
+    job->imd[t] = job->imd[0] + t*n;
+    if (haskey)
+      job->key[t] = job->key[0] + t*n;
+  }
+  return 0;
+}
+
+/* Add the best links of the components to K, merging the components
+   they join; returns the number of links added and adds their
+   lengths to *length */
+static long _fff_graph_boruvka_write(fff_graph* K, long* q, double* length, long* idx, const _fff_graph_boruvka_job* job,
+				     const int sqroot)
+{
+  long i, j, k, nlinks = 0;
+  double ndist;
+  const double *mindist = job->mindist[0];
+  const long *amd = job->amd[0], *imd = job->imd[0];
+
+  for (i=0; i<job->nbcc; i++)
+    idx[i] = i;
+  for(i=0; i<job->nbcc; i++){
+    if (mindist[i] == job->maxdist)
+      continue;
+    k = job->label[amd[i]];
+    while (k > idx[k])
+      k  = idx[k];
+    j = job->label[imd[i]];
+    while (j > idx[j])
+      j  = idx[j];
+    if (k!=j){
+      ndist = sqroot ? sqrt(mindist[i]) : mindist[i];
+      K->eA[*q] = amd[i];
+      K->eB[*q] = imd[i];
+      K->eD[*q] = ndist;
+      (*q)++;
+      K->eA[*q] = imd[i];
+      K->eB[*q] = amd[i];
+      K->eD[*q] = ndist;
+      (*q)++;
+      if (k<j)
+	idx[j] = k;
+      else
+	idx[k] = j;
+      nlinks++;
+      *length += ndist; 
+    } 
+  }
+  return nlinks;
+}
+
+double fff_graph_MST(fff_graph* G, const fff_matrix* X, int nthreads)
 { 
-  /* char* proc = "fff_graph_MST"; */
   long V = X->size1;
   long T = X->size2;
-  double ndist,auxdist,dx,maxdist;
-  long nnbcc,nbcc = V;
-  double * mindist;
-  long * amd;
-  long * imd;
-  long i,n1,n2,j,t,k;
+  double ndist,dx,maxdist;
+  long nbcc = V;
+  long i,n1,t;
   double length = 0;
   long *idx, *label; 
-  long q; 
+  long q = 0; 
+  _fff_graph_boruvka_job job;
 
+  fff_graph_uncompile(G);
+  nthreads = fff_threads_count(nthreads);
+  if (nthreads > V)
+    nthreads = FFF_MAX((int)V, 1);
   /* labels Initialization */
-  idx = (long*) calloc( V,sizeof(long));
-  label = (long*) calloc( V,sizeof(long));
-  if (!label) return(0);
+  idx = (long*) calloc(FFF_MAX(V,1), sizeof(long));
+  label = (long*) calloc(FFF_MAX(V,1), sizeof(long));
+  if ((!idx) || (!label) || _fff_graph_boruvka_new(&job, V, nthreads, 0)){
+    free(idx);
+    free(label);
+    return(0);
+  }
   for (i =0; i<V; i++) label[i]=i;
   
   /* init maxdist */
@@ -2494,193 +2213,97 @@ double fff_graph_MST(fff_graph* G,const fff_matrix* X)
   }   
   maxdist += 1.e-7;
   
-  q = 0;
-  mindist = (double*) calloc( nbcc,sizeof(double));
-  if (!mindist)    return(0);
-  amd = (long*) calloc( nbcc,sizeof(long));
-  if (!amd)    return(0);
-  imd = (long*) calloc( nbcc,sizeof(long));
-  if (!imd)    return(0);
-  
+  job.X = X;
+  job.G = NULL;
+  job.N = NULL;
+  job.label = label;
+  job.maxdist = maxdist;
   while (nbcc>1){  
-    for (i=0; i<nbcc; i++){
-      idx[i]=i;
-      mindist[i] = maxdist;
-    }
-
     /* for each connected component, find the minimal single link */    
-    
-    for (n1=0 ; n1<V ; n1++){
-      j = label[n1];
-      for ( n2=0 ; n2<n1 ; n2++){
-		k = label[n2];
-		if (j!=k){
-		  auxdist = FFF_MAX(mindist[j],mindist[k]);
-		  ndist = 0;
-		  for ( t=0 ; t<T ; t++){
-			dx = fff_matrix_get(X,n1,t)-fff_matrix_get(X,n2,t);
-			ndist += dx*dx;
-			if (ndist>auxdist) break;
-		  }
-		  if (ndist<mindist[j]) {
-			mindist[j] = ndist;
-			amd[j] = n1;
-			imd[j] = n2;
-		  }
-		  if (ndist<mindist[k]){
-			mindist[k] = ndist;
-			amd[k] = n2;
-			imd[k] = n1;
-		  }
-		}
-      }
-    }
-    
+    job.nbcc = nbcc;
+    fff_parallel_run(nthreads, &_fff_graph_MST_job_run, (void*)&job);
+    _fff_graph_boruvka_merge(&job, nthreads);
+
     /* write the new edges at the current iteration */
-    nnbcc = nbcc;
-    
-    
-    for(i=0; i<nnbcc; i++){
-      k = label[amd[i]];
-      while (k > idx[k])
-		k  = idx[k];
-      
-      j = label[imd[i]];
-      while (j > idx[j])
-		j  = idx[j];
-      if (k!=j){
-		ndist = sqrt(mindist[i]);
-		G->eA[q] = amd[i];
-		G->eB[q] = imd[i];
-		G->eD[q] = ndist;
-		q++;
-		G->eA[q] = imd[i];
-		G->eB[q] = amd[i];
-		G->eD[q] = ndist;
-		q++;
-		
-		if (k<j)
-		  idx[j] = k;
-		else
-		  idx[k] = j;
-		
-		nbcc--;
-		length += ndist; 
-      } 
-    }
-    
+    _fff_graph_boruvka_write(G, &q, &length, idx, &job, 1);
+
     /* relabel the ccs */
-    nnbcc = fff_graph_cc_label(label,G);
+    nbcc = fff_graph_cc_label(label,G);
   } 
-  free(mindist);
-  free(amd);
-  free(imd);
+  _fff_graph_boruvka_delete(&job);
   free(label);
   free(idx);
   return(length);
 }
 
-double fff_graph_skeleton(fff_graph* K, const fff_graph* G)
+double fff_graph_skeleton(fff_graph* K, const fff_graph* G, int nthreads)
 {
-  /* For now G is assumed to be connected */
-  /* char* proc = "fff_graph_MST"; */
   long V = G->V;
-  double ndist,maxdist;
-  long nnbcc,nbcc = V;
-  double * mindist;
-  long * amd;
-  long * imd;
-  long i,n1,n2,j,e,k;
+  double maxdist;
+  long nbcc = V;
+  long i,e;
   double length = 0;
   long *idx, *label; 
-  long q; 
-
+  long q = 0; 
+  _fff_graph_boruvka_job job;
+  fff_graph_neighb N;
+
+  fff_graph_uncompile(K);
+  job.N = NULL;
+  if (G->eA == NULL){
+    if (fff_graph_neighb_init(&N, G))
+      return(0);
+    job.N = &N;
+  }
+  nthreads = fff_threads_count(nthreads);
+  if (nthreads > FFF_MAX(V, G->E))
+    nthreads = (int)FFF_MAX(FFF_MAX(V, G->E), 1);
   /* labels Initialization */
-  idx = (long*) calloc( V,sizeof(long));
-  label = (long*) calloc( V,sizeof(long));
-  if (!label) return(0);
+  idx = (long*) calloc(FFF_MAX(V,1), sizeof(long));
+  label = (long*) calloc(FFF_MAX(V,1), sizeof(long));
+  if ((!idx) || (!label) || _fff_graph_boruvka_new(&job, V, nthreads, 1)){
+    free(idx);
+    free(label);
+    if (job.N != NULL)
+      fff_graph_neighb_clear(&N);
+    return(0);
+  }
   for (i =0; i<V; i++) label[i]=i;
   
   /* init maxdist */
   maxdist = 0;
-  for (e=0 ; e<G->E ; e++)
-	if (G->eD[e]>maxdist)
-	  maxdist = G->eD[e];
-  
+  if (job.N == NULL){
+    for (e=0 ; e<G->E ; e++)
+      if (G->eD[e]>maxdist)
+	maxdist = G->eD[e];
+  }
+  else
+    for (e=0 ; e<G->grid->k ; e++)
+      if (G->grid->weight[e]>maxdist)
+	maxdist = G->grid->weight[e];
   maxdist += 1.e-7;
   
-  q = 0;
-  mindist = (double*) calloc( nbcc,sizeof(double));
-  if (!mindist)    return(0);
-  amd = (long*) calloc( nbcc,sizeof(long));
-  if (!amd)    return(0);
-  imd = (long*) calloc( nbcc,sizeof(long));
-  if (!imd)    return(0);
-  
+  job.X = NULL;
+  job.G = G;
+  job.label = label;
+  job.maxdist = maxdist;
   while (nbcc>1){  
-    for (i=0; i<nbcc; i++){
-      idx[i]=i;
-      mindist[i] = maxdist;
-    }
     /* for each connected component, find the minimal single link */
-	for (e=0 ; e<G->E ; e++){
-	  n1 = G->eA[e];
-	  n2 = G->eB[e];
-	  j = label[n1];
-	  k = label[n2];
-	  if (j!=k){
-		 ndist = G->eD[e];
-		 if (ndist<mindist[j]) {
-			mindist[j] = ndist;
-			amd[j] = n1;
-			imd[j] = n2;
-		  }
-		  if (ndist<mindist[k]){
-			mindist[k] = ndist;
-			amd[k] = n2;
-			imd[k] = n1;
-		  }
-		}
-      }
-    
-    /* write the new edges at the current iteration */
-  nnbcc = nbcc;
-  for(i=0; i<nnbcc; i++){
-	k = label[amd[i]];
-	while (k > idx[k])
-	  k  = idx[k];
-      
-	j = label[imd[i]];
-	while (j > idx[j])
-	  j  = idx[j];
-	if (k!=j){
-	  ndist = mindist[i];
-	  K->eA[q] = amd[i];
-	  K->eB[q] = imd[i];
-	  K->eD[q] = ndist;
-	  q++;
-	  K->eA[q] = imd[i];
-	  K->eB[q] = amd[i];
-	  K->eD[q] = ndist;
-		q++;
-		
-		if (k<j)
-		  idx[j] = k;
-		else
-		  idx[k] = j;
-		
-		nbcc--;
-		length += ndist; 
-      } 
-    }
-    
+    job.nbcc = nbcc;
+    fff_parallel_run(nthreads, &_fff_graph_skeleton_job_run, (void*)&job);
+    _fff_graph_boruvka_merge(&job, nthreads);
+
+    /* write the new edges at the current iteration; stop when no
+       link is left, G being not connected */
+    if (_fff_graph_boruvka_write(K, &q, &length, idx, &job, 0) == 0)
+      break;
+
     /* relabel the ccs */
-    nnbcc = fff_graph_cc_label(label,K);
- 
+    nbcc = fff_graph_cc_label(label,K);
   } 
-free(mindist);
-  free(amd);
-  free(imd);
+  _fff_graph_boruvka_delete(&job);
+  if (job.N != NULL)
+    fff_graph_neighb_clear(&N);
   free(label);
   free(idx);
   return(length);
@@ -2716,39 +2339,26 @@ static long _fff_graph_vect_neighb( fff_array *cindices, fff_array * neighb, fff
   */
   long E = G->E;
   long V = G->V;
-  long a,b;
-  long i,j;
-  double aux = 0; 
+  long i;
+  long *ci, *cn;
+  double *cw;
 
   if (((cindices->dimX)<V)|((neighb->dimX)<E)|((weight->size)<E)){
     FFF_ERROR("inconsistant vector size \n",EDOM);
     /* return(1); */
   }
   
-  fff_array_set_all( cindices,0 );
-
-  for(i=0 ; i<E ; i++){
-    j = fff_array_get1d(cindices,G->eA[i])+1;
-    fff_array_set1d(cindices,G->eA[i],j);
-    fff_array_set1d(neighb,i,-1);
-  }
-  
-  for(i=0; i<V; i++){
-    j = fff_array_get1d(cindices,i);
-    aux  = aux + j;
-    fff_array_set1d(cindices,i, aux - j);
-  } 
+  if (fff_graph_adjacency(&ci, &cn, &cw, G))
+    return(1);
+  for(i=0; i<V; i++)
+    fff_array_set1d(cindices,i,ci[i]);
   if ((cindices->dimX)>V)
     fff_array_set1d(cindices,V, E);
-
   for(i=0 ; i<E ; i++){
-    a = G->eA[i]; 
-    b = G->eB[i]; 
-    j = fff_array_get1d(cindices,a);
-    while (fff_array_get1d(neighb,j)>-1) j++;
-    fff_array_set1d(neighb,j,b);
-    fff_vector_set(weight,j,G->eD[i]);
+    fff_array_set1d(neighb,i,cn[i]);
+    fff_vector_set(weight,i,cw[i]);
   } 
+  fff_graph_adjacency_delete(ci, cn, cw, G);
   return(0);
 }
 
@@ -2756,16 +2366,17 @@ int fff_graph_isconnected(const fff_graph* G)
 { 
   /* simply the coonectedness of the input graph */
   int V = G->V;
-  int E = G->E;
-  int i,j,k,l,start,end;
-  fff_array *cindices = fff_array_new1d(FFF_LONG,V+1);
-  fff_array *neighb = fff_array_new1d(FFF_LONG,E);
-  fff_array *label = fff_array_new1d(FFF_LONG,V);
-  fff_vector *weight = fff_vector_new(E);
-  fff_array *list = fff_array_new1d(FFF_LONG,V);
+  int i,j,k,l,d;
+  fff_array *label, *list;
+  fff_graph_neighb N;
+  const long *nn;
+  const double *nw;
   long win = 0;
 
-  _fff_graph_vect_neighb(cindices,neighb,weight,G);
+  if (fff_graph_neighb_init(&N, G))
+    return(0);
+  label = fff_array_new1d(FFF_LONG,V);
+  list = fff_array_new1d(FFF_LONG,V);
   
   fff_array_set_all(label,0);
   fff_array_set_all(list,-1);
@@ -2774,10 +2385,9 @@ int fff_graph_isconnected(const fff_graph* G)
   k = 1;
   
   for (j=1 ; j<V ; j++){
-    start = fff_array_get1d(cindices,win);
-    end = fff_array_get1d(cindices,win+1);
-    for (i=start ; i<end ; i++){
-      l = fff_array_get1d(neighb,i);
+    d = fff_graph_neighb_get(&N, win, &nn, &nw);
+    for (i=0 ; i<d ; i++){
+      l = nn[i];
 	  if (fff_array_get1d(label,l)==0){
 		fff_array_set1d(label,l,1);
 		fff_array_set1d(list,k,l);
@@ -2788,53 +2398,195 @@ int fff_graph_isconnected(const fff_graph* G)
     win = fff_array_get1d(list,j);
     if (win == -1) break;
   }
-  fff_array_delete(cindices);
-  fff_array_delete(neighb);
-  fff_vector_delete(weight);
+  fff_graph_neighb_clear(&N);
   fff_array_delete(list);
   fff_array_delete(label);
   return (k==V);
 }
 
-long fff_graph_cc_label( long* label, const fff_graph* G)
-{ 
-  long n1,ne;
-  long k;
-  long E = G->E;
-  long N = G->V;
-  long remain = N;
-  long su,sv;
-  
-  for (n1 =0; n1<N; n1++) 
-    label[n1] = -1;
-  
-  k=0;
-  while (remain>0){
-    n1 = 0;
-    while (label[n1]>-1) n1++;
-    label[n1] = k;
-    su =  0;
-    sv  = 1;
-	
-    while (sv>su){
-      su = sv; 
-      for(ne=0; ne<E; ne++){
-		if(label[G->eA[ne]]==k)
-		  label[G->eB[ne]] = k;
-		if(label[G->eB[ne]]==k)
-		  label[G->eA[ne]] = k;
-      }
-      sv = 0;
-      for(n1=0; n1<N; n1++) 
-		sv += (label[n1]==k); 
+/* Connected components by union-find, in place in the label array:
+   label[i] is the parent of vertex i, or -1 for the vertices that are
+   left out. The root of a component is its first vertex, so that
+   parents always precede their children. Each thread first links the
+   edges within its own range of vertices (see fff_parallel_range),
+   which only modifies that range; it also records the vertices of
+   its range that have neighbours in other ranges, whose edges are
+   then linked serially. */
+typedef struct {
+  long* label;
+  const fff_graph* G;
+  const fff_graph_neighb* N;   /* NULL to read the edge list */
+  long* first;                 /* first and last vertices with edges */
+  long* last;                  /* across ranges, for each thread */
+} _fff_graph_cc_job;
+
+static void _fff_uf_union(long* parent, long a, long b)
+{
+  a = _fff_uf_root(parent, a);
+  b = _fff_uf_root(parent, b);
+  if (a < b)
+    parent[b] = a;
+  else
+    parent[a] = b;
+}
+
+/* Thread whose fff_parallel_range contains i, for n>=nthreads */
+static int _fff_graph_range_rank(const long i, const long n, const int nthreads)
+{
+  long chunk = n / nthreads, rem = n % nthreads;
+
+  if (i < rem*(chunk+1))
+    return (int)(i / (chunk+1));
+  return (int)(rem + (i - rem*(chunk+1)) / chunk);
+}
+
+static void _fff_graph_cc_job_run(int rank, int nthreads, void* params)
+{
+  _fff_graph_cc_job* job = (_fff_graph_cc_job*)params;
+  const fff_graph* G = job->G;
+  long* label = job->label;
+  long i, j, d, a, b, e, start, stop, first, last;
+  size_t r0, r1;
+  fff_graph_neighb N;
+  const long *nn;
+  const double *nw;
+
+  fff_parallel_range(G->V, rank, nthreads, &r0, &r1);
+  start = (long)r0;
+  stop = (long)r1;
+
+  if (job->N == NULL){
+    for (e=0 ; e<G->E ; e++){
+      a = G->eA[e];
+      b = G->eB[e];
+      if ((a < start) || (a >= stop) || (b < start) || (b >= stop))
+	continue;
+      if ((label[a] >= 0) && (label[b] >= 0))
+	_fff_uf_union(label, a, b);
+    }
+    return;
+  }
+
+  /* private copy of the neighbour buffers */
+  N = *(job->N);
+  first = stop;
+  last = start-1;
+  for (i=start ; i<stop ; i++){
+    if (label[i] < 0)
+      continue;
+    d = fff_graph_neighb_get(&N, i, &nn, &nw);
+    for (j=0 ; j<d ; j++){
+      b = nn[j];
+      if (label[b] < 0)
+	continue;
+      if ((b < start) || (b >= stop)){
+	if (first == stop)
+	  first = i;
+	last = i;
+      }
+      else
+	_fff_uf_union(label, i, b);
+    }
+  }
+  if (job->first != NULL){
+    job->first[rank] = first;
+    job->last[rank] = last;
+  }
+}
+
+long fff_graph_cc_label_th(long* label, const fff_graph* G, const fff_vector* x, const double th, int nthreads)
+{
+  long V = G->V;
+  long i, j, d, a, b, e, k = 0;
+  int r;
+  _fff_graph_cc_job job;
+  fff_graph_neighb N;
+  const long *nn;
+  const double *nw;
+
+  if ((x != NULL) && (x->size != (size_t)V)){
+    FFF_WARNING("Vertex values do not match the graph");
+    return(0);
+  }
+  for (i=0 ; i<V ; i++)
+    label[i] = ((x == NULL) || (x->data[i*x->stride] >= th)) ? i : -1;
+  if (V == 0)
+    return(0);
+
+  job.label = label;
+  job.G = G;
+  job.N = NULL;
+  job.first = NULL;
+  job.last = NULL;
+  if ((G->grid != NULL) || (G->ci != NULL)){
+    if (fff_graph_neighb_init(&N, G))
+      return(0);
+    job.N = &N;
+  }
+  nthreads = fff_threads_count(nthreads);
+  if (nthreads > V)
+    nthreads = (int)V;
+  if ((nthreads > 1) && (job.N != NULL)){
+    job.first = (long*) calloc(nthreads, sizeof(long));
+    job.last = (long*) calloc(nthreads, sizeof(long));
+    if ((job.first == NULL) || (job.last == NULL)){
+      free(job.first);
+      free(job.last);
+      job.first = NULL;
+      job.last = NULL;
+      nthreads = 1;
     }
-	
-    remain = remain-su;
-    k++;  
+  }
+  fff_parallel_run(nthreads, &_fff_graph_cc_job_run, (void*)&job);
+
+  /* edges across the thread ranges */
+  if ((nthreads > 1) && (job.N == NULL))
+    for (e=0 ; e<G->E ; e++){
+      a = G->eA[e];
+      b = G->eB[e];
+      if ((label[a] < 0) || (label[b] < 0))
+	continue;
+      if (_fff_graph_range_rank(a, V, nthreads) != _fff_graph_range_rank(b, V, nthreads))
+	_fff_uf_union(label, a, b);
+    }
+  else if (nthreads > 1){
+    for (r=0 ; r<nthreads ; r++)
+      for (i=job.first[r] ; i<=job.last[r] ; i++){
+	if (label[i] < 0)
+	  continue;
+	d = fff_graph_neighb_get(&N, i, &nn, &nw);
+	for (j=0 ; j<d ; j++){
+	  b = nn[j];
+	  if (label[b] < 0)
+	    continue;
+	  if (_fff_graph_range_rank(b, V, nthreads) != r)
+	    _fff_uf_union(label, i, b);
+	}
+      }
+    free(job.first);
+    free(job.last);
+  }
+  if (job.N != NULL)
+    fff_graph_neighb_clear(&N);
+
+  /* Number the roots in increasing order; since parents precede their
+     children, the other vertices take the label of their parent */
+  for (i=0 ; i<V ; i++){
+    if (label[i] < 0)
+      continue;
+    if (label[i] == i)
+      label[i] = k++;
+    else
+      label[i] = label[label[i]];
   }
   return(k);
 }
 
+long fff_graph_cc_label( long* label, const fff_graph* G)
+{ 
+  return(fff_graph_cc_label_th(label, G, NULL, 0, 1));
+}
+
 long fff_graph_main_cc(fff_array** Mcc, const fff_graph* G)
 {
   long i,j;
@@ -2876,349 +2628,524 @@ long fff_graph_main_cc(fff_array** Mcc, const fff_graph* G)
   return(k);
 }
 
+/* Root of a vertex in the union-find forest, with path halving */
+static long _fff_uf_root(long* parent, long i)
+{
+  while (parent[i] != i) {
+    parent[i] = parent[parent[i]];
+    i = parent[i];
+  }
+  return(i);
+}
+
+long fff_graph_cc_max(long* size, double* mass, const fff_graph* G, 
+		      const fff_vector* x, double th)
+{
+  long V = G->V;
+  long i, l, k;
+  long *label, *csize;
+  double *cmass; 
+
+  *size = 0; 
+  *mass = 0.0; 
+  if (x->size != (size_t)V) {
+    FFF_WARNING("Vertex values do not match the graph");
+    return(0);
+  }
+
+  label = (long*)calloc(FFF_MAX(V,1), sizeof(long));
+  if (!label) {
+    FFF_WARNING("Allocation failed");
+    return(0);
+  }
+  k = fff_graph_cc_label_th(label, G, x, th, 1);
+  csize = (long*)calloc(FFF_MAX(k,1), sizeof(long));
+  cmass = (double*)calloc(FFF_MAX(k,1), sizeof(double));
+  if ((!csize) || (!cmass)) {
+    FFF_WARNING("Allocation failed");
+    free(label);
+    free(csize);
+    free(cmass);
+    return(0);
+  }
+
+  /* Accumulate the cluster sizes and masses */
+  for (i=0; i<V; i++) {
+    l = label[i];
+    if (l < 0)
+      continue;
+    csize[l] ++;
+    cmass[l] += x->data[i*x->stride] - th;
+  }
+  for (l=0; l<k; l++) {
+    if (csize[l] > *size)
+      *size = csize[l];
+    if (cmass[l] > *mass)
+      *mass = cmass[l];
+  }
+
+  free(label);
+  free(csize);
+  free(cmass);
+  return(k);
+}
+
 
 /**********************************************************************
  *************************** Dijkstra, Floyd ******************************
 **********************************************************************/
 
+/* Add the edge weights to *sum, in the order of the edge list; 1 is
+   returned if one of them is negative */
+static int _fff_graph_weights_sum(double *sum, const fff_graph* G)
+{
+  long i,j,d;
+  fff_graph_neighb N;
+  const long *nn;
+  const double *nw;
+
+  if (G->grid == NULL){
+    for (i=0 ; i<G->E ; i++)
+      if (G->eD[i]<0)
+	return(1);
+      else
+	*sum += G->eD[i];
+    return(0);
+  }
+  
+  fff_graph_neighb_init(&N, G);
+  for (i=0 ; i<G->V ; i++){
+    d = fff_graph_neighb_get(&N, i, &nn, &nw);
+    for (j=0 ; j<d ; j++)
+      if (nw[j]<0){
+	fff_graph_neighb_clear(&N);
+	return(1);
+      }
+      else
+	*sum += nw[j];
+  }
+  fff_graph_neighb_clear(&N);
+  return(0);
+}
+
 long fff_graph_dijkstra( double *dist, const fff_graph* G, const long seed)
 {
-  long i,E=G->E;
   double infdist = 1.0;
-  for (i=0 ; i<E ; i++)
-    if (G->eD[i]<0){
-      FFF_WARNING("found a negative distance \n");
-      return(1);
-    }
-    else
-      infdist += G->eD[i];
+  if (_fff_graph_weights_sum(&infdist, G)){
+    FFF_WARNING("found a negative distance \n");
+    return(1);
+  }
   fff_graph_Dijkstra( dist,G,seed,infdist);
   return(0);
     
 }
 
-long fff_graph_Dijkstra( double *dist, const fff_graph* G, const long seed, const double infdist)
-{ 
-  /* char* proc = "fff_graph_Dijkstra"; */
-  long E = G->E;
-  long V = G->V;
-  long i,j,k,l,win,start,end;
+/* Multi-source Dijkstra's algorithm on the graph visited by N, H
+   being an empty heap of size V. The distinct seeds are labelled
+   0,1,.. in their order of appearance, and each vertex gets the
+   distance to its nearest seed and, if label is not NULL, the label
+   of this seed. Vertices that cannot be reached keep the distance
+   infdist and the label -1. The number of edge relaxations is
+   returned. */
+static long _fff_graph_Dijkstra_neighb(double *dist, long *label, fff_graph_heap* H, fff_graph_neighb* N, 
+				       const long *seeds, const long sp, const double infdist)
+{
+  long i,k,l,d,win,nrelax = 0;
+  long V = N->G->V;
   double newdist;
-  
-  fff_vector *dg = fff_vector_new(V);
-  fff_array *lg = fff_array_new1d(FFF_LONG,V);
-  fff_array *cindices = fff_array_new1d(FFF_LONG,V+1);
-  fff_array *neighb = fff_array_new1d(FFF_LONG,E);
-  fff_vector *weight = fff_vector_new(E);
-  long *lgdata = (long*) lg->data;
-  long *cidata = (long*) cindices->data;
-  long *nedata = (long*) neighb->data;
-  long ri = _fff_graph_vect_neighb(cindices,neighb,weight,G);
-  
+  const long *nn;
+  const double *nw;
 
   /* initializations*/
   for(i=0 ; i<V ; i++){
     dist[i] = infdist;
-    dg->data[i] = infdist;
-    lgdata[i] = -1;
+    if (label != NULL)
+      label[i] = -1;
+  }
+  k = 0;
+  for(i=0 ; i<sp ; i++){
+    win = seeds[i];
+    if (dist[win] > 0){
+      dist[win] = 0;
+      if (label != NULL)
+	label[win] = k;
+      k++;
+      fff_graph_heap_push(H, win, 0);
+    }
   }
-  win = seed;
-  dist[win] = 0;
-  dg->data[0] = 0;
-  lgdata[0] = win;
-  k = 1;
   
   /* iterations */
-  for (j=1 ; j<V ; j++){
-    start = cidata[win];
-    end = cidata[win+1];
-    for (i=start ; i<end ; i++){
-      l = nedata[i];
-      if (dist[win]+weight->data[i] < dist[l]){
-	  newdist = dist[win] + weight->data[i];
-	  if (dist[l] < infdist)
-	    ri += _fff_list_move(lgdata, dg->data, l, newdist, k);
-	  else{
-	    ri += _fff_list_add(lgdata, dg->data, l, newdist, k);
-	    k++;
-	  }
-	  dist[l] = newdist;
+  while (H->size > 0){
+    win = fff_graph_heap_pop(H);
+    d = fff_graph_neighb_get(N, win, &nn, &nw);
+    nrelax += d;
+    for (i=0 ; i<d ; i++){
+      l = nn[i];
+      newdist = dist[win] + nw[i];
+      if (newdist < dist[l]){
+	dist[l] = newdist;
+	if (label != NULL)
+	  label[l] = label[win];
+	fff_graph_heap_push(H, l, newdist);
       }
     } 
-    win = lgdata[j];
-    if (win == -1) break;
+  }
+  return(nrelax);
+}
+
+long fff_graph_Dijkstra( double *dist, const fff_graph* G, const long seed, const double infdist)
+{ 
+  /* char* proc = "fff_graph_Dijkstra"; */
+  long V = G->V, nrelax;
+  fff_graph_neighb N;
+  fff_graph_heap* H;
+  
+  if (fff_graph_neighb_init(&N, G))
+    return(1);
+  H = fff_graph_heap_new(V);
+  if (H == NULL){
+    fff_graph_neighb_clear(&N);
+    return(1);
   }
 
-  fff_array_delete(cindices);
-  fff_array_delete(neighb);
-  fff_vector_delete(dg);
-  fff_array_delete(lg);
-  fff_vector_delete(weight);
-  return(ri);
+  FFF_PROFILE_BEGIN(FFF_PROFILE_DIJKSTRA);
+  nrelax = _fff_graph_Dijkstra_neighb(dist, NULL, H, &N, &seed, 1, infdist);
+  FFF_PROFILE_END(FFF_PROFILE_DIJKSTRA);
+  FFF_PROFILE_COUNT(FFF_PROFILE_RELAXATIONS, nrelax);
+
+  fff_graph_neighb_clear(&N);
+  fff_graph_heap_delete(H);
+  return(0);
 }
 
-int fff_graph_Dijkstra_multiseed( fff_vector *dist, const fff_graph* G, const fff_array* seeds)
+long fff_graph_geodesic_voronoi(fff_array *label, fff_vector *dist, const fff_graph* G, const fff_array* seeds)
 { 
-  long E = G->E;
   long V = G->V;
-  long i,j,k,l,win,start,end;
-  double newdist;
-  int sp = seeds->dimX;
-  double infdist = FFF_POSINF;
-  
-  fff_vector *dg = fff_vector_new(V);
-  fff_array *lg = fff_array_new1d(FFF_LONG,V);
-  fff_array *cindices = fff_array_new1d(FFF_LONG,V+1);
-  fff_array *neighb = fff_array_new1d(FFF_LONG,E);
-  fff_vector *weight = fff_vector_new(E);
-  long *cidata = (long*) cindices->data;
-  long *lgdata = (long*) lg->data;
-  long *nedata = (long*) neighb->data;
-  double dsmin,dsmax;
-  long smin, smax, ri; 
+  long sp = seeds->dimX;
+  long i, nrelax;
+  long *lseeds, *llabel = NULL;
+  double *ldist;
+  double dsmin,dsmax,wsum = 0;
+  fff_graph_neighb N;
+  fff_graph_heap* H;
 
-  for (i=0 ; i<E ; i++)
-    if (G->eD[i]<0){
-      FFF_WARNING("found a negative distance \n");
+  /* argument checking */
+  if (((label != NULL) && ((long)(label->dimX)!=V)) || ((dist != NULL) && ((long)(dist->size)!=V))){
+    FFF_ERROR("incompatible vector size \n",EDOM);
+    return(1);
+  }
+  if (_fff_graph_weights_sum(&wsum, G)){
+    FFF_WARNING("found a negative distance \n");
+    return(1);
+  }
+  if (sp > 0){
+    fff_array_extrema ( &dsmin, &dsmax, seeds );
+    if ((dsmin<0)|(dsmax>V-1)){
+      FFF_ERROR("seeds have incorrect indices \n",EDOM);
       return(1);
     }
+  }
 
-  fff_array_extrema ( &dsmin, &dsmax, seeds );
-  smin = (long) dsmin;
-  smax = (long) dsmax;
- 
-  if ((smin<0)|(smax>V-1)){
-    FFF_ERROR("seeds have incorrect indices \n",EDOM);
+  /* initializations*/
+  if (fff_graph_neighb_init(&N, G))
     return(1);
+  H = fff_graph_heap_new(V);
+  lseeds = (long*) calloc(FFF_MAX(sp,1),sizeof(long));
+  ldist = (double*) calloc(FFF_MAX(V,1),sizeof(double));
+  if (label != NULL)
+    llabel = (long*) calloc(FFF_MAX(V,1),sizeof(long));
+  for (i=0 ; i<sp ; i++)
+    lseeds[i] = (long) fff_array_get1d(seeds,i);
+
+  nrelax = _fff_graph_Dijkstra_neighb(ldist, llabel, H, &N, lseeds, sp, FFF_POSINF);
+  FFF_PROFILE_COUNT(FFF_PROFILE_RELAXATIONS, nrelax);
+
+  for (i=0 ; i<V ; i++){
+    if (dist != NULL)
+      fff_vector_set(dist,i,ldist[i]);
+    if (label != NULL)
+      fff_array_set1d(label,i,llabel[i]);
   }
-  ri = _fff_graph_vect_neighb(cindices,neighb,weight,G);
 
-  /* initializations*/
+  fff_graph_neighb_clear(&N);
+  fff_graph_heap_delete(H);
+  free(lseeds);
+  free(ldist);
+  free(llabel);
+  return(0);
+}
 
-  for(i=0 ; i<V ; i++){
-    fff_vector_set(dg,i,infdist);
-    fff_array_set1d(lg,i,-1);
-	fff_vector_set(dist,i,infdist);
-   }
-  k = 0;
-  for(i=0 ; i<sp ; i++){
-    win = fff_array_get1d(seeds,i);
-    if (fff_vector_get(dist,win)>0) k++;
-    fff_vector_set(dist,win,0);
-    fff_vector_set(dg,i,0);
-    fff_array_set1d(lg,i,win);
-   } 
-  win = fff_array_get1d(lg,0);
-    
-  /* iterations */
-  for (j=1 ; j<V ; j++){
-    start = cidata[win];
-    end = cidata[win+1];
-    for (i=start ; i<end ; i++){
-      l = nedata[i];
-      if (fff_vector_get(dist,win)+fff_vector_get(weight,i) < fff_vector_get(dist,l)){
-		newdist = fff_vector_get(dist,win) + fff_vector_get(weight,i);
-		if (fff_vector_get(dist,l) < infdist)
-		  ri += _fff_list_move(lgdata, dg->data, l, newdist, k);
-		else{
-		  ri += _fff_list_add(lgdata, dg->data, l, newdist, k);
-		  k++;
-		}
-		fff_vector_set(dist,l,newdist);
-      }
-    } 
-    win = fff_array_get1d(lg,j);
-    if (win == -1) break;
+int fff_graph_Dijkstra_multiseed( fff_vector *dist, const fff_graph* G, const fff_array* seeds)
+{ 
+  return((int)fff_graph_geodesic_voronoi(NULL, dist, G, seeds));
+}
+
+/* Rows of geodesic distances: row i holds the distances from
+   seeds[i], or from i if seeds is NULL, and is computed by thread
+   i%nthreads, which owns the heap H[rank] and a copy of the iterator
+   N */
+typedef struct {
+  const fff_graph_neighb *N;
+  long V;
+  const long *seeds;
+  long i0;
+  long nrows;
+  double *out;
+  long tda;
+  double infdist;
+  fff_graph_heap** H;
+} _fff_graph_Dijkstra_rows_job;
+
+static void _fff_graph_Dijkstra_rows_job_run(int rank, int nthreads, void* params)
+{
+  _fff_graph_Dijkstra_rows_job* job = (_fff_graph_Dijkstra_rows_job*) params;
+  fff_graph_neighb N = *(job->N);
+  long r, seed, nrelax = 0;
+
+  for (r=rank ; r<job->nrows ; r+=nthreads){
+    seed = (job->seeds==NULL) ? job->i0+r : job->seeds[job->i0+r];
+    nrelax += _fff_graph_Dijkstra_neighb(job->out+r*job->tda, NULL, job->H[rank], &N, &seed, 1, job->infdist);
   }
+  FFF_PROFILE_COUNT(FFF_PROFILE_RELAXATIONS, nrelax);
+}
+
+/* Geodesic distances from the sp seeds, by blocks of nb rows. If func
+   is NULL, the rows are written in out (with leading dimension tda)
+   in a single block; otherwise each block is computed in a buffer and
+   handed to func row by row, in order. */
+static long _fff_graph_Dijkstra_rows(double *out, const long tda, fff_graph_rows_func func, void* params, 
+				     const fff_graph* G, const long *seeds, const long sp, const double infdist, 
+				     long nb, int nthreads)
+{
+  long i, r, V = G->V;
+  double *buf;
+  int t, status = 0;
+  fff_graph_neighb N;
+  _fff_graph_Dijkstra_rows_job job;
+
+  if (sp < 1)
+    return(0);
+  if ((func == NULL) || (nb < 1) || (nb > sp))
+    nb = sp;
+  nthreads = fff_threads_count(nthreads);
+  if (nthreads > nb)
+    nthreads = (int)nb;
 
-  fff_array_delete(cindices);
-  fff_array_delete(neighb);
-  fff_vector_delete(dg);
-  fff_array_delete(lg);
-  fff_vector_delete(weight);
-  return(ri);
+  if (fff_graph_neighb_init(&N, G))
+    return(1);
+  buf = (func == NULL) ? out : (double*) malloc(nb*V*sizeof(double));
+  job.H = (fff_graph_heap**) calloc(nthreads, sizeof(fff_graph_heap*));
+  if ((buf == NULL) || (job.H == NULL))
+    status = 1;
+  for (t=0 ; (t<nthreads) && (status==0) ; t++){
+    job.H[t] = fff_graph_heap_new(V);
+    if (job.H[t] == NULL)
+      status = 1;
+  }
+  
+  job.N = &N;
+  job.V = V;
+  job.seeds = seeds;
+  job.infdist = infdist;
+  job.tda = (func == NULL) ? tda : V;
+  for (i=0 ; (i<sp) && (status==0) ; i+=nb){
+    job.i0 = i;
+    job.nrows = FFF_MIN(nb, sp-i);
+    job.out = (func == NULL) ? out+i*tda : buf;
+    fff_parallel_run(nthreads, &_fff_graph_Dijkstra_rows_job_run, (void*)&job);
+    if (func != NULL)
+      for (r=0 ; r<job.nrows ; r++)
+	(*func)(i+r, buf+r*V, V, params);
+  }
+  
+  if (status)
+    FFF_ERROR("memory allocation failed", ENOMEM);
+  if (job.H != NULL)
+    for (t=0 ; t<nthreads ; t++)
+      fff_graph_heap_delete(job.H[t]);
+  free(job.H);
+  if (func != NULL)
+    free(buf);
+  fff_graph_neighb_clear(&N);
+  return(status);
 }
 
-long fff_graph_partial_Floyd( fff_matrix *dist, const fff_graph* G, const long *seeds)
+/* Relaxation of the tile [i0..i1)x[j0..j1) of D through the
+   intermediate vertices [k0..k1) */
+static void _fff_graph_Floyd_tile(double *D, const long tda, const long i0, const long i1, 
+				  const long j0, const long j1, const long k0, const long k1)
 {
-  long i,j;
-  long sp = dist->size1;
-  double infdist = 1.0;
-  long V = G->V;
-  long E = G->E;
-  long ri = 0;
-  double *bufd; 
- 
-  if ((dist->size2)!=V){
-	FFF_ERROR("incompatible matrix size \n",EDOM);
-	/* return(1); */
-    }
-  
-  for (i=0 ; i<E ; i++)
-    if (G->eD[i]<0){
-      FFF_WARNING("found a negative distance \n");
-      return(1);
+  long i, j, k;
+  double dik, s;
+  double *Di;
+  const double *Dk;
+  
+  for (k=k0 ; k<k1 ; k++){
+    Dk = D + k*tda;
+    for (i=i0 ; i<i1 ; i++){
+      Di = D + i*tda;
+      dik = Di[k];
+      if (dik == FFF_POSINF)
+	continue;
+      /* branch-free so that the loop can be vectorized */
+      for (j=j0 ; j<j1 ; j++){
+	s = dik + Dk[j];
+	Di[j] = (s < Di[j]) ? s : Di[j];
+      }
     }
-    else
-      infdist += G->eD[i];
-  
-  bufd = (double*) calloc(V,sizeof(double));
-  
-  for (i=0 ; i<sp ; i++){   
-    ri = fff_graph_Dijkstra( bufd,G,seeds[i],infdist);
-    for(j=0 ; j<V ; j++)
-      fff_matrix_set(dist,i,j,bufd[j]);
   }
-  
-  free(bufd);
-  return(ri);
 }
 
+/* Once the tiles of the pivot rows [k0..k1) are final, each thread
+   relaxes its own rows of tiles, starting with the pivot column */
+typedef struct {
+  double *D;
+  long tda;
+  long V;
+  long k0;
+  long k1;
+} _fff_graph_Floyd_job;
+
+static void _fff_graph_Floyd_job_run(int rank, int nthreads, void* params)
+{
+  _fff_graph_Floyd_job* job = (_fff_graph_Floyd_job*) params;
+  long i0, i1, j0, j1, B = FFF_GRAPH_FLOYD_BLOCK;
+  long V = job->V, k0 = job->k0, k1 = job->k1;
+
+  for (i0=rank*B ; i0<V ; i0+=nthreads*B){
+    if (i0 == k0)
+      continue;
+    i1 = FFF_MIN(i0+B, V);
+    _fff_graph_Floyd_tile(job->D, job->tda, i0, i1, k0, k1, k0, k1);
+    for (j0=0 ; j0<V ; j0+=B){
+      if (j0 == k0)
+	continue;
+      j1 = FFF_MIN(j0+B, V);
+      _fff_graph_Floyd_tile(job->D, job->tda, i0, i1, j0, j1, k0, k1);
+    }
+  }
+}
 
-long fff_graph_Floyd(fff_matrix *dist, const fff_graph* G)
+/* Blocked Floyd-Warshall algorithm on the V*V matrix D */
+static long _fff_graph_Floyd_Warshall(double *D, const long tda, const fff_graph* G, 
+				      const double infdist, int nthreads)
 {
-   long i,j;
-   double infdist = 1.0;
-   long V = G->V;
-   long E = G->E;
-   long ri = 0;
-   double *bufd; 
+  long i, j, d, V = G->V, B = FFF_GRAPH_FLOYD_BLOCK;
+  double *Di;
+  fff_graph_neighb N;
+  const long *nn;
+  const double *nw;
+  _fff_graph_Floyd_job job;
 
-   if (((dist->size1)!=V)|((dist->size2)!=V)){
-      FFF_ERROR("incompatible matrix size \n",EDOM);
-      return(1);
-    }
-   
-  for (i=0 ; i<E ; i++)
-    if (G->eD[i]<0){
-      FFF_WARNING("found a negative distance \n");
-      return(1);
-    }
-    else
-    infdist += G->eD[i];
-  
-  bufd = (double*) calloc(V,sizeof(double));
+  for (i=0 ; i<V ; i++){
+    Di = D + i*tda;
+    for (j=0 ; j<V ; j++) 
+      Di[j] = FFF_POSINF;
+    Di[i] = 0;
+  }
+  if (fff_graph_neighb_init(&N, G))
+    return(1);
+  for (i=0 ; i<V ; i++){
+    Di = D + i*tda;
+    d = fff_graph_neighb_get(&N, i, &nn, &nw);
+    for (j=0 ; j<d ; j++)
+      if (nw[j] < Di[nn[j]])
+	Di[nn[j]] = nw[j];
+  }
+  fff_graph_neighb_clear(&N);
+  
+  nthreads = fff_threads_count(nthreads);
+  if (nthreads > (V+B-1)/B)
+    nthreads = (int)((V+B-1)/B);
+  job.D = D;
+  job.tda = tda;
+  job.V = V;
+  for (job.k0=0 ; job.k0<V ; job.k0+=B){
+    job.k1 = FFF_MIN(job.k0+B, V);
+    _fff_graph_Floyd_tile(D, tda, job.k0, job.k1, job.k0, job.k1, job.k0, job.k1);
+    for (j=0 ; j<V ; j+=B)
+      if (j != job.k0)
+	_fff_graph_Floyd_tile(D, tda, job.k0, job.k1, j, FFF_MIN(j+B, V), job.k0, job.k1);
+    fff_parallel_run(nthreads, &_fff_graph_Floyd_job_run, (void*)&job);
+  }
 
-  for (i=0 ; i<V ; i++){   
-    ri = fff_graph_Dijkstra( bufd,G,i,infdist);
-    for(j=0 ; j<V ; j++)
-      fff_matrix_set(dist,i,j,bufd[j]);
+  for (i=0 ; i<V ; i++){
+    Di = D + i*tda;
+    for (j=0 ; j<V ; j++) 
+      if (Di[j] == FFF_POSINF)
+	Di[j] = infdist;
   }
-  free(bufd);
-  return(ri);
+  return(0);
 }
 
+/* Check the seeds and the weights; the distance between
+   disconnected vertices is coded by the sum of the weights plus 1 */
+static long _fff_graph_geodesic_check(double *infdist, const fff_graph* G, const long *seeds, const long sp)
+{
+  long i;
+  
+  *infdist = 1.0;
+  if (_fff_graph_weights_sum(infdist, G)){
+    FFF_WARNING("found a negative distance \n");
+    return(1);
+  }
+  if (seeds != NULL)
+    for (i=0 ; i<sp ; i++)
+      if ((seeds[i]<0) || (seeds[i]>G->V-1)){
+	FFF_WARNING("seeds have incorrect indices \n");
+	return(1);
+      }
+  return(0);
+}
 
-extern long fff_graph_voronoi(fff_array *label, const fff_graph* G,const  fff_array *seeds)
+long fff_graph_geodesic_distances(fff_matrix *dist, const fff_graph* G, const long *seeds, int nthreads)
 {
-  long i,j,k,l,win,start, end;
-  long sp = seeds->dimX;
-  double infdist = 1.0;
+  long sp = dist->size1;
   long V = G->V;
-  long E = G->E;
-  long ri = 0;
-  double dwin,w,newdist;
-  double dsmin,dsmax;
-  long smin, smax; 
+  double infdist;
 
-  fff_vector *dist, *dg, *weight; 
-  fff_array *lg, *cindices, *neighb;
- 
-  /* argument checking */
-  if ((label->dimX)!=V){
+  if (((long)dist->size2!=V) || ((seeds==NULL) && (sp!=V))){
     FFF_ERROR("incompatible matrix size \n",EDOM);
-    /* return(1); */
-  }
-  
-  for (i=0 ; i<E ; i++)
-    if (G->eD[i]<0){
-      FFF_WARNING("found a negative distance \n");
-      return(1);
-    }
-    else
-      infdist += G->eD[i];
-  
-    fff_array_extrema ( &dsmin, &dsmax, seeds );
-    smin = (long) dsmin;
-    smax = (long) dsmax;
- 
-  if ((smin<0)|(smax>V-1)){
-    FFF_ERROR("seeds have incorrect indices \n",EDOM);
-    /* return(1); */
+    return(1);
   }
+  if (_fff_graph_geodesic_check(&infdist, G, seeds, sp))
+    return(1);
 
-  /* initializations*/
-  
-  dist = fff_vector_new(V);
-  dg = fff_vector_new(V+1);
-  lg = fff_array_new1d(FFF_LONG,V+1);
-  cindices = fff_array_new1d(FFF_LONG,V+1);
-  neighb = fff_array_new1d(FFF_LONG,E);
-  weight = fff_vector_new(E);
-  
-  ri = _fff_graph_vect_neighb(cindices,neighb,weight,G);
-  
-  for(i=0 ; i<V+1 ; i++){
-    fff_vector_set(dg,i,infdist);
-    fff_array_set1d(lg,i,-1);
-  }
-  for(i=0 ; i<V ; i++){
-    fff_vector_set(dist,i,infdist);
-    fff_array_set1d(label,i,-1);
-  }
-  k = 0;
-  for(i=0 ; i<sp ; i++){
-    win = fff_array_get1d(seeds,i);
-    if (fff_vector_get(dist,win)>0){ 
-	  fff_array_set1d(lg,k,win);
-	  fff_array_set1d(label,win,k);
-	  k++;
-	}
-    fff_vector_set(dist,win,0);
-    fff_vector_set(dg,i,0);
-    /*fff_array_set1d(lg,i,win);*/
-	/*fff_array_set1d(label,win,i);*/
-  } 
-  win = fff_array_get1d(seeds,0);
-  /*printf("%ld %ld\n",k,win);*/
+  if ((seeds == NULL) && (G->E > FFF_GRAPH_FLOYD_DENSITY*V*V))
+    return(_fff_graph_Floyd_Warshall(dist->data, dist->tda, G, infdist, nthreads));
+  return(_fff_graph_Dijkstra_rows(dist->data, dist->tda, NULL, NULL, G, seeds, sp, infdist, sp, nthreads));
+}
 
-  /* iterations */
-  
-  for (j=1 ; j<V ; j++){	
-    dwin = fff_vector_get(dist,win);
-	/* printf("%d %ld %f \n",j,win,dwin); */
-    start = fff_array_get1d(cindices,win);
-    end = fff_array_get1d(cindices,win+1);
-    
-    for (i=start ; i<end ; i++){
-      l = fff_array_get1d(neighb,i);
-      w = fff_vector_get(weight,i);
-      
-      if ( dwin+w < fff_vector_get(dist,l)){
-		newdist = dwin + w;	  
-		if (fff_vector_get(dist,l) < infdist)
-		  ri += _fff_list_move(lg->data, dg->data, l, newdist, k);
-		else{
-		  ri += _fff_list_add(lg->data, dg->data, l, newdist, k);
-		  k++; 
-		}
-		fff_vector_set(dist,l,newdist);
-		fff_array_set1d(label,l, fff_array_get1d(label,win));
-      }
-    }
-    win = fff_array_get1d(lg,j);
-    if (win == -1) break;
-    
+long fff_graph_geodesic_stream(fff_graph_rows_func func, void* params, const fff_graph* G, 
+			       const long *seeds, const long sp, const long nrows, int nthreads)
+{
+  double infdist;
+  long ns = (seeds==NULL) ? G->V : sp;
+
+  if (_fff_graph_geodesic_check(&infdist, G, seeds, ns))
+    return(1);
+  if (nrows < 1){
+    FFF_ERROR("the number of buffered rows should be positive \n",EDOM);
+    return(1);
   }
-  
-  fff_array_delete(cindices);
-  fff_array_delete(neighb);
-  fff_vector_delete(dg);
-  fff_vector_delete(dist);
-  fff_array_delete(lg);
-  fff_vector_delete(weight);
+  return(_fff_graph_Dijkstra_rows(NULL, 0, func, params, G, seeds, ns, infdist, nrows, nthreads));
+}
+
+long fff_graph_partial_Floyd( fff_matrix *dist, const fff_graph* G, const long *seeds)
+{
+  return(fff_graph_geodesic_distances(dist, G, seeds, 1));
+}
+
 
-  return(ri);
+long fff_graph_Floyd(fff_matrix *dist, const fff_graph* G)
+{
+  return(fff_graph_geodesic_distances(dist, G, NULL, 1));
+}
+
+
+extern long fff_graph_voronoi(fff_array *label, const fff_graph* G,const  fff_array *seeds)
+{
+  return(fff_graph_geodesic_voronoi(label, NULL, G, seeds));
 }
 
 
@@ -28,6 +28,12 @@
   The coding is appropriate for very large numbers of vertices with
   sparse connections. It is clearly suboptimal for small, dense
   graphs.
+
+  Traversals (Dijkstra, Voronoi, ...) need the neighbours of each
+  vertex, i.e. the edges sorted by origin. This compiled adjacency is
+  built on each call, unless the graph has been compiled with
+  fff_graph_compile, in which case it is kept with the graph until
+  the edges are modified.
   
   2008/04/02: 
   To be implemented : 
@@ -48,13 +54,39 @@ extern "C" {
 #include "fff_base.h"
 
 
+  /* Largest stencil of the grid graphs: the voxel and its 26 neighbours */
+#define FFF_GRAPH_STENCIL_MAX 27
+
+  /*!
+    \struct fff_graph_stencil
+    \brief Implicit adjacency of a set of voxels
+
+    The voxels are coded by their rank u = x + y*Mx + z*Mxy in their
+    bounding box, which is padded with one empty plane in x and y so
+    that the offsets never wrap around. The neighbours of vertex i are
+    the vertices index[u[i]+offset[s]] other than -1, for s in [0..k),
+    with weight weight[s].
+  */
+  typedef struct fff_graph_stencil{
+    long U;                   /*!< number of voxels of the padded bounding box */
+    long* u;                  /*!< voxel of each vertex (V) */
+    long* index;              /*!< vertex of each voxel, -1 out of the mask (U) */
+    long k;                   /*!< number of offsets, including the voxel itself */
+    long offset[FFF_GRAPH_STENCIL_MAX];    /*!< voxel offsets of the neighbours (k) */
+    double weight[FFF_GRAPH_STENCIL_MAX];  /*!< edge weights (k) */
+  } fff_graph_stencil;
+
   typedef struct fff_graph{
     
     long V;                /*!< Number of vertices of the graph */
     long E;                /*!< Number of Edges of the graph */
-    long* eA;                 /*!< edge origins (E) */
-    long* eB;                 /*!< edge ends (E) */
-    double* eD;              /*!< edge weights (E) */
+    long* eA;                 /*!< edge origins (E), NULL for implicit graphs */
+    long* eB;                 /*!< edge ends (E), NULL for implicit graphs */
+    double* eD;              /*!< edge weights (E), NULL for implicit graphs */
+    long* ci;                 /*!< compiled adjacency: first edge of each vertex (V+1), or NULL */
+    long* cn;                 /*!< compiled adjacency: edge ends, sorted by origin (E) */
+    double* cw;              /*!< compiled adjacency: edge weights, sorted by origin (E) */
+    fff_graph_stencil* grid;  /*!< implicit adjacency of grid graphs, or NULL */
     
   } fff_graph;
 
@@ -361,12 +393,135 @@ extern "C" {
     neigh and weight must be allocated G->E elements
   */
   extern long fff_graph_to_neighb(fff_array *cindices, fff_array * neighb, fff_vector* weight, const fff_graph* G);
+  /*!
+    \struct fff_graph_heap
+    \brief Binary min-heap of vertices with decrease-key
+
+    Each vertex is in the heap at most once. Vertices with equal keys
+    come out in the order in which their keys were set, so that the
+    geodesic routines visit vertices at equal distance in FIFO order.
+  */
+  typedef struct fff_graph_heap{
+    long size;               /*!< number of vertices in the heap */
+    long stamp;              /*!< number of key updates so far */
+    long* node;              /*!< heap of vertices (V) */
+    long* pos;               /*!< position of each vertex in the heap, -1 if out (V) */
+    double* key;             /*!< key of each vertex (V) */
+    long* rank;              /*!< stamp of the last key update of each vertex (V) */
+  } fff_graph_heap;
+
+  /*!
+    \brief Constructor for an empty heap of vertices in [0..V-1]
+  */
+  extern fff_graph_heap* fff_graph_heap_new(const long V);
+  /*!
+    \brief Destructor for the fff_graph_heap structure
+  */
+  extern void fff_graph_heap_delete(fff_graph_heap* H);
+  /*!
+    \brief Insert the vertex v with key d, or set its key to d if it is in the heap
+    
+    Setting a larger key than the current one is allowed, but then
+    the heap order is not restored. 
+  */
+  extern void fff_graph_heap_push(fff_graph_heap* H, const long v, const double d);
+  /*!
+    \brief Remove and return the vertex with the lowest key; H->size needs be positive
+  */
+  extern long fff_graph_heap_pop(fff_graph_heap* H);
+
+  /*!
+    \brief Compile the adjacency of a graph
+    \param G graph
+
+    Stores in G->ci, G->cn and G->cw the coding of fff_graph_to_neighb,
+    which the traversal functions (Dijkstra, Floyd, Voronoi, ...) then
+    use instead of rebuilding it on each call. The functions of this
+    library that modify the edges of G drop it; code that writes
+    G->eA, G->eB or G->eD directly needs call fff_graph_uncompile or
+    fff_graph_compile again. Returns 0, or 1 if memory is lacking.
+  */
+  extern int fff_graph_compile(fff_graph* G);
+  /*!
+    \brief Drop the compiled adjacency of a graph, if any
+    \param G graph
+  */
+  extern void fff_graph_uncompile(fff_graph* G);
+  /*!
+    \brief Get the compiled adjacency of a graph
+    \param ci first edge of each vertex (V+1)
+    \param cn edge ends, sorted by origin (E)
+    \param cw edge weights, sorted by origin (E)
+    \param G graph
+
+    The arrays are those of G if it is compiled, and are built
+    otherwise; in both cases, they need be released with
+    fff_graph_adjacency_delete. Returns 0, or 1 if memory is lacking.
+  */
+  extern int fff_graph_adjacency(long** ci, long** cn, double** cw, const fff_graph* G);
+  /*!
+    \brief Release the arrays given by fff_graph_adjacency
+  */
+  extern void fff_graph_adjacency_delete(long* ci, long* cn, double* cw, const fff_graph* G);
+
+  /*!
+    \struct fff_graph_neighb
+    \brief Neighbour iterator, common to explicit and implicit graphs
+
+    The neighbours of explicit graphs are read from their compiled
+    adjacency (which is built by fff_graph_neighb_init if G is not
+    compiled), those of implicit grid graphs are generated from the
+    stencil in the buffers nn and nw. Copies of an initialized
+    iterator may be used by concurrent threads, but only the original
+    needs be cleared.
+  */
+  typedef struct fff_graph_neighb{
+    const fff_graph* G;      /*!< graph */
+    long* ci;                /*!< compiled adjacency of explicit graphs */
+    long* cn;                /*!< compiled adjacency of explicit graphs */
+    double* cw;              /*!< compiled adjacency of explicit graphs */
+    long nn[FFF_GRAPH_STENCIL_MAX];     /*!< neighbours of implicit graphs */
+    double nw[FFF_GRAPH_STENCIL_MAX];   /*!< weights of implicit graphs */
+  } fff_graph_neighb;
+
+  /*!
+    \brief Initialize a neighbour iterator on G
+    Returns 0, or 1 if memory is lacking.
+  */
+  extern int fff_graph_neighb_init(fff_graph_neighb* N, const fff_graph* G);
+  /*!
+    \brief Release the arrays held by a neighbour iterator
+  */
+  extern void fff_graph_neighb_clear(fff_graph_neighb* N);
+  /*!
+    \brief Neighbours of a vertex
+    \param N iterator
+    \param i vertex
+    \param nn neighbours of i
+    \param nw weights of the edges from i
+
+    Returns the number of edges from i. The ends and weights of these
+    edges are (*nn)[j] and (*nw)[j], in the order of the edge list of
+    G, and remain valid until the next call on N.
+  */
+  extern long fff_graph_neighb_get(fff_graph_neighb* N, const long i, const long** nn, const double** nw);
+  /*!
+    \brief Explicit copy of a graph
+    \param K resulting graph, whose edges are sorted by origin
+    \param G graph, possibly implicit
+    
+    The functions that do not go through fff_graph_neighb (edge
+    editing, MST, clustering, ...) need explicit graphs. Returns the
+    number of edges, or -1 if memory is lacking.
+  */
+  extern long fff_graph_explicit(fff_graph** K, const fff_graph* G);
 
 /*!
     \brief k-nearest neighbours sparse graph construction
     \param G resulting sparse graph
     \param X data matrix. 
     \param k number of nearest neighbours considered.
+    \param nthreads number of threads (see \c fff_threads_count)
 
     This algorithm builds a graph whose vertices are the list of items
     and whose edges  are the symmeterised knn's.
@@ -380,11 +535,12 @@ extern "C" {
     The metric used in the algo is Euclidian.
 
     The number of edges is returned.
-    For the sake of speed, it is advisable to set X
-    so that the first coordinate contains more information than 
-    the second one, etc. This is simply achieved by SVD.
+    The neighbours are found with a k-d tree of the rows of X (see
+    fff_kdtree.h), queried on \a nthreads threads. Equidistant
+    neighbours are ranked by increasing index, and the result does
+    not depend on nthreads.
   */
-  extern long fff_graph_knn(fff_graph** G, const fff_matrix* X, const long k); 
+  extern long fff_graph_knn(fff_graph** G, const fff_matrix* X, const long k, const int nthreads); 
   
   /*!
     \brief k-nearest neighbours sparse graph construction
@@ -392,6 +548,7 @@ extern "C" {
     \param X source data matrix 
     \param Y target data matrix 
     \param k number of nearest neighbours considered.
+    \param nthreads number of threads (see \c fff_threads_count)
     
     This algorithm builds a graph whose vertices are the list of rows of X 
     and whose edges  are the knn of these in the rows of Y 
@@ -402,18 +559,18 @@ extern "C" {
 
     The metric used in the algo is Euclidian.
 
-    The number of edges is returned.
-    For the sake of speed, it is advisable to set X and  Y 
-    so that the first coordinate contains more information than 
-    the second one, etc. This is simply achieved by SVD.
+    The number of edges is returned, and G->E is set accordingly.
+    The neighbours are found with a k-d tree of the rows of Y, see
+    fff_graph_knn.
   */
-  extern long  fff_graph_cross_knn( fff_graph* G, const fff_matrix* X, const fff_matrix *Y, const long k);
+  extern long  fff_graph_cross_knn( fff_graph* G, const fff_matrix* X, const fff_matrix *Y, const long k, const int nthreads);
  
  /*!
     \brief eps-neighbours graph construction
     \param G resulting graph
     \param X data matrix. 
     \param eps neighborhood radius  
+    \param nthreads number of threads (see \c fff_threads_count)
 
     This algorithm builds a graph whose vertices are the list of items
     and whose edges  are the points that lie closer than eps.
@@ -424,10 +581,12 @@ extern "C" {
     Note that each edge is given twice ; for each vertex v, the edge
     (v,v,0) is NOT included in he E matrix
     The metric used in the algo is Euclidian.
+    The neighbours are found with a k-d tree of the rows of X,
+    queried on \a nthreads threads, see fff_graph_knn.
 
     the number of edges is returned
   */
-  extern long fff_graph_eps( fff_graph** G, const fff_matrix* X, const double eps); 
+  extern long fff_graph_eps( fff_graph** G, const fff_matrix* X, const double eps, const int nthreads); 
 
 /*!
     \brief eps-neighbours graph construction
@@ -435,6 +594,7 @@ extern "C" {
     \param X data matrix. 
     \param Y data matrix. 
     \param eps neighborhood radius
+    \param nthreads number of threads (see \c fff_threads_count)
     
 
     This algorithm builds a graph 
@@ -446,10 +606,12 @@ extern "C" {
     The final structure G has the correct set of edges
   
     The metric used in the algo is Euclidian.
+    The neighbours are found with a k-d tree of the rows of Y,
+    queried on \a nthreads threads, see fff_graph_knn.
 
     the number of edges is returned
   */
-  extern long fff_graph_cross_eps( fff_graph** G, const fff_matrix* X, const fff_matrix* Y, const double eps);   
+  extern long fff_graph_cross_eps( fff_graph** G, const fff_matrix* X, const fff_matrix* Y, const double eps, const int nthreads);   
  
 /*!
     \brief eps-neighbours robust graph construction
@@ -457,11 +619,12 @@ extern "C" {
     \param X data matrix. 
     \param Y data matrix. 
     \param eps neighborhood radius
+    \param nthreads number of threads (see \c fff_threads_count)
     
    idem fff_graph_cross_eps, but the nearest neighbor is always included
    for each row of X
   */
-  extern long fff_graph_cross_eps_robust( fff_graph** G, const fff_matrix* X, const fff_matrix* Y, const double eps);   
+  extern long fff_graph_cross_eps_robust( fff_graph** G, const fff_matrix* X, const fff_matrix* Y, const double eps, const int nthreads);   
  
   /*!
     \brief k-Cartesian-neighbours graph construction
@@ -522,37 +685,63 @@ extern "C" {
     the number of edges is returned
   */
   extern long fff_graph_grid_twenty_six(fff_graph** G,const long* xyz, const long N);
+  /*!
+    \brief Implicit k-Cartesian-neighbours graph construction
+    \param G resulting graph
+    \param xyz input coordinates, written as in fff_graph_grid_six
+    \param N number of points
+    \param k number of neighbors (6,18 or 26)
+
+    The graph has the same vertices and edges as those of
+    fff_graph_grid_six, fff_graph_grid_eighteen and
+    fff_graph_grid_twenty_six, but only stores the voxel index of its
+    bounding box and a stencil (see fff_graph_stencil) instead of the
+    edge vectors; G->eA, G->eB and G->eD are NULL. It is accepted by
+    the functions that visit the graph through fff_graph_neighb:
+    field maxima, minima, diffusion, morphology, watershed,
+    bifurcations and Voronoi, connected components, Dijkstra and
+    geodesic distances. The number of edges is returned, or 0 if
+    memory is lacking.
+  */
+  extern long fff_graph_grid_stencil(fff_graph** G, const long* xyz, const long N, const long k);
    
  
    /*!
     \brief Minimum Spanning Tree construction
     \param X data matrix. 
     \param G resulting sparse graph
+    \param nthreads number of threads (see \c fff_threads_count)
 
     This algorithm builds a graph whose vertices are the list of items
     and whose edges for the MST of X.
     The data matrix should be dimensioned as (nb items * feature dimension)
     The number of edges is 2*nb vertices-2, due to the symmetry.
     The metric used in the algo is Euclidian.
-    The algo used is Boruvska's algorithm. It is not fully optimized yet.
+    The algo used is Boruvska's algorithm: at each round, the minimal
+    link of each component is searched on \a nthreads threads, each
+    one scanning its own share of the points; ties are broken as in a
+    serial scan, so that the result does not depend on nthreads.
 
     The length of the MST is returned
   */
-  double fff_graph_MST(fff_graph* G,const fff_matrix* X);
+  double fff_graph_MST(fff_graph* G, const fff_matrix* X, int nthreads);
 
 /*!
     \brief Minimum Spanning Tree construction from an existing graph
-    \param G input graph
+    \param G input graph, explicit or implicit
     \param K resulting sparse graph
+    \param nthreads number of threads (see \c fff_threads_count)
 
     This algorithm builds a graph whose vertices are the list of items
     The number of edges is 2*nb vertices-2, due to the symmetry.
-    The metric used in the algo is Euclidian.
-    The algo used is Boruvska's algorithm. It is not fully optimized yet.
+    The algo used is Boruvska's algorithm, with the edges shared among
+    \a nthreads threads as in fff_graph_MST; ties are broken by edge
+    order. If G is not connected, the spanning forest is built and the
+    remaining edges of K are left unchanged.
 
     The length of the MST or "skeleton" is returned
   */
-  double fff_graph_skeleton(fff_graph* K,const fff_graph* G);
+  double fff_graph_skeleton(fff_graph* K, const fff_graph* G, int nthreads);
 
    /*!
     \brief graph connectedness test
@@ -580,6 +769,28 @@ extern "C" {
     the number of cc's is returned
   */
   extern long fff_graph_cc_label(long* label, const fff_graph* G);
+
+  /*!
+    \brief labelling of the connected components of a subgraph
+    \param label resulting labels (G->V), -1 for the vertices left out
+    \param G sparse graph, explicit or implicit
+    \param x vertex values (G->V), or NULL to keep all the vertices
+    \param th height threshold: the vertices such that x>=th are kept
+    \param nthreads number of threads (see \c fff_threads_count)
+
+    The components of the subgraph of the kept vertices are labelled
+    in the order of their first vertex, as fff_graph_cc_label does for
+    the whole graph, hence as the subgraph itself would be. They are
+    found by union-find in place in \a label, each thread linking the
+    edges within its own range of vertices before the edges across
+    ranges are linked serially. Except for a few words per thread,
+    nothing is allocated, so that it can be called repeatedly, e.g.
+    once per permutation of a cluster-level test.
+
+    The number of components is returned.
+  */
+  extern long fff_graph_cc_label_th(long* label, const fff_graph* G, const fff_vector* x, 
+				    const double th, int nthreads);
   
   /*!
     \brief returns the greatest connected component of the graph
@@ -594,6 +805,24 @@ extern "C" {
     The number of c's is returned.
   */
   extern long fff_graph_main_cc(fff_array** Mcc, const fff_graph* G);
+
+  /*!
+    \brief largest suprathreshold clusters
+    \param size size of the largest cluster
+    \param mass mass of the heaviest cluster
+    \param G  sparse graph
+    \param x vertex values (G->V)
+    \param th height threshold
+
+    Clusters are the connected components of the subgraph of vertices
+    such that x>=th. The mass of a cluster is the sum of x-th over its
+    vertices. Both are zero if there is no cluster. Components are
+    found by fff_graph_cc_label_th.
+
+    The number of clusters is returned.
+  */
+  extern long fff_graph_cc_max(long* size, double* mass, const fff_graph* G, 
+			       const fff_vector* x, double th);
   
   /*!
     \brief Dijkstra's algorithm
@@ -663,6 +892,56 @@ extern "C" {
   */
   extern long fff_graph_Floyd( fff_matrix *dist, const fff_graph* G);
 
+  /*!
+    \brief Geodesic distances from a set of seeds
+    \param dist the computed distance matrix (seeds*vertices)
+    \param G  graph
+    \param seeds the seed points, or NULL for all the vertices
+    \param nthreads number of threads (see \c fff_threads_count)
+    
+    Row i of dist receives the geodesic distances from seeds[i] (or
+    from i if seeds==NULL) to all the vertices. The distance to an
+    unreachable vertex is coded by the sum of the edge weights plus
+    one, and all the weights should be non-negative.
+
+    The rows are computed by Dijkstra's algorithm on the compiled
+    adjacency, in parallel. When all the pairs are required and the
+    graph is dense (E > V^2/4), a blocked Floyd-Warshall algorithm is
+    used instead. Results are the same whatever the number of threads.
+    fff_graph_Floyd and fff_graph_partial_Floyd are the serial
+    versions of this function.
+  */
+  extern long fff_graph_geodesic_distances(fff_matrix *dist, const fff_graph* G, const long *seeds, int nthreads);
+
+  /*!
+    \brief Callback receiving one row of geodesic distances
+    \param i index of the row, i.e. of the seed
+    \param row distances from the seed to the V vertices
+    \param V number of vertices 
+    \param params user parameters
+
+    \a row is only valid during the call.
+  */
+  typedef void (*fff_graph_rows_func)(long i, const double* row, long V, void* params);
+
+  /*!
+    \brief Geodesic distances from a set of seeds, streamed row by row
+    \param func function called on each row of distances, in order
+    \param params parameters passed to \a func
+    \param G  graph
+    \param seeds the \a sp seed points, or NULL for all the vertices
+    \param sp number of seeds (ignored if \a seeds is NULL)
+    \param nrows number of rows computed at a time
+    \param nthreads number of threads (see \c fff_threads_count)
+
+    Same as fff_graph_geodesic_distances, except that only \a nrows
+    rows of distances are held in memory at a time, so that
+    many-source distances on large graphs can be reduced or written
+    out on the fly. \a func is always called from the calling thread.
+  */
+  extern long fff_graph_geodesic_stream(fff_graph_rows_func func, void* params, const fff_graph* G, 
+					const long *seeds, const long sp, const long nrows, int nthreads);
+
 /*!
     \brief geodesic Voronoi algorithm
     \param label is the Voronoi vertices labelling 
@@ -675,6 +954,22 @@ extern "C" {
   */
   extern long fff_graph_voronoi(fff_array *label, const fff_graph* G,const  fff_array *seeds);
 
+/*!
+    \brief Multi-source Dijkstra's algorithm
+    \param label the index of the nearest seed of each vertex, or NULL
+    \param dist the distance of each vertex to its nearest seed, or NULL
+    \param G  graph
+    \param seeds the set of seed points of geodesic cells
+
+    A single pass of Dijkstra's algorithm started from all the seeds
+    yields both the Voronoi labelling of fff_graph_voronoi and the
+    distances of fff_graph_Dijkstra_multiseed, which are based on it.
+    The distinct seeds are labelled 0,1,.. in their order in \a seeds;
+    vertices that cannot be reached get label -1 and an infinite
+    distance. The edge weights need be non-negative.
+  */
+  extern long fff_graph_geodesic_voronoi(fff_array *label, fff_vector *dist, const fff_graph* G, const fff_array *seeds);
+
   
 /*!
     \brief Cliques extraction algorithm based on replicator dynamics
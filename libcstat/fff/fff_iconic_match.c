@@ -1,12 +1,14 @@
 #include "fff_iconic_match.h"
 #include "fff_base.h"
 #include "fff_cubic_spline.h" 
+#include "fff_threads.h"
 
-#include <randomkit.h>
+#include <rk_counter.h>
 
 #include <math.h>
 #include <stdlib.h>
 #include <string.h>
+#include <errno.h>
 
 
 
@@ -62,172 +64,440 @@ unsigned int fff_imatch_source_npoints(const fff_array* imI)
 
 /*
   
-imI : assumed signed short encoded, possibly non-contiguous.
+imI : possibly non-contiguous. Intensities outside [0, clampI[ are
+ignored, which includes the FFF_IMATCH_UCHAR_PAD value of UCHAR
+encoded sources.
 
-imJ_padded : assumed C-contiguous (last index varies faster) & signed
-short encoded.
+imJ_padded : assumed C-contiguous (last index varies faster), either
+SSHORT encoded with borders padded with -1, or UCHAR encoded with
+borders padded with FFF_IMATCH_UCHAR_PAD.
 
 H : assumed C-contiguous 
 
 Tvox : assumed C-contiguous
 
-Negative intensities are ignored. 
-
 */
 
-#define APPEND_NEIGHBOR(q, w)			\
+/* 
+   Padding value of UCHAR encoded images, which cannot hold -1. An
+   UCHAR encoded image may thus hold at most FFF_IMATCH_UCHAR_PAD
+   bins. 
+*/ 
+#define FFF_IMATCH_UCHAR_PAD 255 
+
+#define FFF_IMATCH_VALID_SSHORT(j) ((j)>=0)
+#define FFF_IMATCH_VALID_UCHAR(j) ((j)!=FFF_IMATCH_UCHAR_PAD)
+
+#define FFF_IMATCH_GET_SSHORT(row, pos) ((int)((const signed short*)(row))[pos])
+#define FFF_IMATCH_GET_UCHAR(row, pos) ((int)((const unsigned char*)(row))[pos])
+#define FFF_IMATCH_GET_ANY(row, pos) ((int)get(row, pos))
+
+/* 
+   Random interpolation parameters: the draw for a source voxel is a
+   function of the seed and of the voxel coordinates, so that it does
+   not depend on the order in which voxels are processed. 
+*/ 
+typedef struct {
+  unsigned long seed; 
+  unsigned long x; 
+  unsigned long y; 
+  unsigned long z; 
+} _fff_imatch_rand_params; 
+
+#define APPEND_NEIGHBOR(q, w, VALID)		\
   j = J[q];					\
-  if (j>=0) {					\
+  if (VALID(j)) {				\
     *bufJnn = j; bufJnn ++; 			\
     *bufW = w; bufW ++;				\
     nn ++; }
 
 
+/* 
+   Scanline joint histogram kernel. 
+
+   Source voxels are processed row by row along the fastest axis
+   (z). The transformed coordinates of the row origin are computed
+   once per row, so that each voxel only adds the contribution of z
+   (3 products instead of 9). Since the bounds test guarantees Tx>-1,
+   the floor is computed as (int)Tx+(Tx>=0) rather than with the
+   generic FFF_FLOOR macro. The arithmetic is otherwise the same as in
+   a full matrix-vector product, in the same order, so the result is
+   unchanged.
+
+   The kernel is instantiated below for SSHORT and UCHAR encoded
+   padded targets (TYPEJ, with VALIDJ telling in-mask values) and for
+   SSHORT, UCHAR or arbitrary sources (GETI), so that the target
+   image is read in its narrowest type and the source intensities do
+   not go through the generic accessor. Source voxels with
+   intensities outside [ilo, ihi[ are skipped, which also skips the
+   padding value of UCHAR sources since ihi <= clampI <=
+   FFF_IMATCH_UCHAR_PAD.
+
+   The convention for neighbor indexing is as follows:
+  
+     Floor slice        Ceil slice
+  
+       2----6             3----7                     y          
+       |    |             |    |                     ^ 
+       |    |             |    |                     |
+       0----4             1----5                     ---> x
+
+   imI is assumed 3d. 
+*/
+#define FFF_IMATCH_JOINT_HIST_BAND(NAME, TYPEJ, VALIDJ, GETI)		\
+static void NAME(double* H, int clampI, int clampJ,			\
+		 const fff_array* imI,					\
+		 const fff_array* imJ_padded,				\
+		 const double* Tvox,					\
+		 int interp,						\
+		 int ilo,						\
+		 int ihi)						\
+{									\
+  const TYPEJ* J=(const TYPEJ*)imJ_padded->data;			\
+  double dimJX=imJ_padded->dimX-2, dimJY=imJ_padded->dimY-2, dimJZ=imJ_padded->dimZ-2; \
+  signed short Jnn[8];							\
+  double W[8];								\
+  signed short *bufJnn;							\
+  double *bufW;								\
+  int i, j;								\
+  size_t off;								\
+  size_t u2 = imJ_padded->dimZ;						\
+  size_t u3 = u2+1;							\
+  size_t u4 = (imJ_padded->dimY)*u2;					\
+  size_t u5 = u4+1;							\
+  size_t u6 = u4+u2;							\
+  size_t u7 = u6+1;							\
+  double wx, wy, wz, wxwy, wxwz, wywz;					\
+  double W0, W2, W3, W4;						\
+  size_t x, y;								\
+  int z, dimZ = (int)imI->dimZ;						\
+  int nn, nx, ny, nz;							\
+  double Tx, Ty, Tz, Rx, Ry, Rz;					\
+  double Tx_z = Tvox[2], Ty_z = Tvox[6], Tz_z = Tvox[10];		\
+  double Tx_0 = Tvox[3], Ty_0 = Tvox[7], Tz_0 = Tvox[11];		\
+  const char* row;							\
+  size_t incZ = imI->offsetZ;						\
+  double (*get)(const char*, size_t) = imI->get;			\
+  void (*interpolate)(int, double*, int, const signed short*, const double*, int, void*); \
+  void* interp_params = NULL;						\
+  _fff_imatch_rand_params rp;						\
+									\
+  (void)get;								\
+									\
+  /* Set interpolation method */					\
+  if (interp==0)							\
+    interpolate = &_pv_interpolation;					\
+  else if (interp>0)							\
+    interpolate = &_tri_interpolation;					\
+  else { /* interp < 0 */						\
+    interpolate = &_rand_interpolation;					\
+    rp.seed = (unsigned long)(-interp);					\
+    interp_params = (void*)(&rp);					\
+  }									\
+									\
+  /* Loop over source rows */						\
+  for (x=0; x<imI->dimX; x++)						\
+    for (y=0; y<imI->dimY; y++) {					\
+									\
+      row = (const char*)imI->data + x*imI->byte_offsetX + y*imI->byte_offsetY; \
+									\
+      /* Transformed coordinates of the row origin */			\
+      Rx = Tvox[0]*x; Rx += Tvox[1]*y;					\
+      Ry = Tvox[4]*x; Ry += Tvox[5]*y;					\
+      Rz = Tvox[8]*x; Rz += Tvox[9]*y;					\
+									\
+      /* Loop over row voxels */					\
+      for (z=0; z<dimZ; z++) {						\
+									\
+	/* Source voxel intensity */					\
+	i = GETI(row, z*incZ);						\
+									\
+	/* Skip voxels whose intensity is outside the band of		\
+	   histogram rows handled by this call (this includes masked	\
+	   voxels) */							\
+	if ((i<ilo) || (i>=ihi))					\
+	  continue;							\
+									\
+	/* Compute the transformed grid coordinates of current voxel */ \
+	Tx = Rx + Tx_z*z; Tx += Tx_0;					\
+	Ty = Ry + Ty_z*z; Ty += Ty_0;					\
+	Tz = Rz + Tz_z*z; Tz += Tz_0;					\
+									\
+	/* Test whether the transformed point is completly outside the	\
+	   reference grid */						\
+	if (!((Tx>-1) && (Tx<dimJX) &&					\
+	      (Ty>-1) && (Ty<dimJY) &&					\
+	      (Tz>-1) && (Tz<dimJZ)))					\
+	  continue;							\
+									\
+	/* Nearest neighbor (floor coordinates in the padded image,	\
+	   hence +1). As Tx>-1, FFF_FLOOR(Tx)+1 is 0 if Tx<0 and	\
+	   (int)Tx+1 otherwise. */					\
+	nx = (int)Tx + (Tx>=0);						\
+	ny = (int)Ty + (Ty>=0);						\
+	nz = (int)Tz + (Tz>=0);						\
+									\
+	/* Trilinear interpolation weights (see the neighbor		\
+	   indexing convention above). Note: wx = nnx + 1 - Tx, where	\
+	   nnx is the location in the NON-PADDED grid */		\
+	wx = nx - Tx;							\
+	wy = ny - Ty;							\
+	wz = nz - Tz;							\
+	wxwy = wx*wy;							\
+	wxwz = wx*wz;							\
+	wywz = wy*wz;							\
+									\
+	/* Prepare buffers */						\
+	bufJnn = Jnn;							\
+	bufW = W;							\
+									\
+	/* Initialize neighbor list */					\
+	off = nx*u4 + ny*u2 + nz;					\
+	nn = 0;								\
+									\
+	/* Neighbor 0: (0,0,0) */					\
+	W0 = wxwy*wz;							\
+	APPEND_NEIGHBOR(off, W0, VALIDJ);				\
+									\
+	/* Neighbor 1: (0,0,1) */					\
+	APPEND_NEIGHBOR(off+1, wxwy-W0, VALIDJ);			\
+									\
+	/* Neighbor 2: (0,1,0) */					\
+	W2 = wxwz-W0;							\
+	APPEND_NEIGHBOR(off+u2, W2, VALIDJ);				\
+									\
+	/* Neightbor 3: (0,1,1) */					\
+	W3 = wx-wxwy-W2;						\
+	APPEND_NEIGHBOR(off+u3, W3, VALIDJ);				\
+									\
+	/* Neighbor 4: (1,0,0) */					\
+	W4 = wywz-W0;							\
+	APPEND_NEIGHBOR(off+u4, W4, VALIDJ);				\
+									\
+	/* Neighbor 5: (1,0,1) */					\
+	APPEND_NEIGHBOR(off+u5, wy-wxwy-W4, VALIDJ);			\
+									\
+	/* Neighbor 6: (1,1,0) */					\
+	APPEND_NEIGHBOR(off+u6, wz-wxwz-W4, VALIDJ);			\
+									\
+	/* Neighbor 7: (1,1,1) */					\
+	APPEND_NEIGHBOR(off+u7, 1-W3-wy-wz+wywz, VALIDJ);		\
+									\
+	/* Update the joint histogram using the desired interpolation	\
+	   technique */							\
+	rp.x = x;							\
+	rp.y = y;							\
+	rp.z = z;							\
+	interpolate(i, H, clampJ, Jnn, W, nn, interp_params);		\
+									\
+      } /* End of loop over row voxels */				\
+									\
+    } /* End of loop over rows */					\
+									\
+  return;								\
+}
+
+FFF_IMATCH_JOINT_HIST_BAND(_fff_imatch_joint_hist_band_ss_ss, signed short, FFF_IMATCH_VALID_SSHORT, FFF_IMATCH_GET_SSHORT)
+FFF_IMATCH_JOINT_HIST_BAND(_fff_imatch_joint_hist_band_ss_uc, unsigned char, FFF_IMATCH_VALID_UCHAR, FFF_IMATCH_GET_SSHORT)
+FFF_IMATCH_JOINT_HIST_BAND(_fff_imatch_joint_hist_band_uc_ss, signed short, FFF_IMATCH_VALID_SSHORT, FFF_IMATCH_GET_UCHAR)
+FFF_IMATCH_JOINT_HIST_BAND(_fff_imatch_joint_hist_band_uc_uc, unsigned char, FFF_IMATCH_VALID_UCHAR, FFF_IMATCH_GET_UCHAR)
+FFF_IMATCH_JOINT_HIST_BAND(_fff_imatch_joint_hist_band_any_ss, signed short, FFF_IMATCH_VALID_SSHORT, FFF_IMATCH_GET_ANY)
+FFF_IMATCH_JOINT_HIST_BAND(_fff_imatch_joint_hist_band_any_uc, unsigned char, FFF_IMATCH_VALID_UCHAR, FFF_IMATCH_GET_ANY)
+
+
+/* Dispatch on the source and padded target encodings */ 
+static void _fff_imatch_joint_hist_band(double* H, int clampI, int clampJ,  
+					const fff_array* imI,
+					const fff_array* imJ_padded, 
+					const double* Tvox, 
+					int interp, 
+					int ilo, 
+					int ihi)
+{
+  if (imJ_padded->datatype == FFF_UCHAR) {
+    if (imI->datatype == FFF_SSHORT) 
+      _fff_imatch_joint_hist_band_ss_uc(H, clampI, clampJ, imI, imJ_padded, Tvox, interp, ilo, ihi); 
+    else if (imI->datatype == FFF_UCHAR) 
+      _fff_imatch_joint_hist_band_uc_uc(H, clampI, clampJ, imI, imJ_padded, Tvox, interp, ilo, ihi); 
+    else 
+      _fff_imatch_joint_hist_band_any_uc(H, clampI, clampJ, imI, imJ_padded, Tvox, interp, ilo, ihi); 
+  }
+  else {
+    if (imI->datatype == FFF_SSHORT) 
+      _fff_imatch_joint_hist_band_ss_ss(H, clampI, clampJ, imI, imJ_padded, Tvox, interp, ilo, ihi); 
+    else if (imI->datatype == FFF_UCHAR) 
+      _fff_imatch_joint_hist_band_uc_ss(H, clampI, clampJ, imI, imJ_padded, Tvox, interp, ilo, ihi); 
+    else 
+      _fff_imatch_joint_hist_band_any_ss(H, clampI, clampJ, imI, imJ_padded, Tvox, interp, ilo, ihi); 
+  }
+
+  return; 
+}
+
+
 void fff_imatch_joint_hist(double* H, int clampI, int clampJ,  
 			    const fff_array* imI,
 			    const fff_array* imJ_padded, 
 			    const double* Tvox, 
 			    int interp)
 {
-  fff_array_iterator iterI = fff_array_iterator_init(imI); 
-  const signed short* J=(signed short*)imJ_padded->data; 
-  size_t dimJX=imJ_padded->dimX-2, dimJY=imJ_padded->dimY-2, dimJZ=imJ_padded->dimZ-2;  
-  signed short Jnn[8]; 
-  double W[8]; 
-  signed short *bufJnn; 
-  double *bufW; 
-  int i, j;
-  size_t off;
-  size_t u2 = imJ_padded->dimZ; 
-  size_t u3 = u2+1; 
-  size_t u4 = (imJ_padded->dimY)*u2;
-  size_t u5 = u4+1; 
-  size_t u6 = u4+u2; 
-  size_t u7 = u6+1; 
-  double wx, wy, wz, wxwy, wxwz, wywz; 
-  double W0, W2, W3, W4; 
-  size_t x, y, z; 
-  int nn, nx, ny, nz;
-  double Tx, Ty, Tz; 
-  void (*interpolate)(int, double*, int, const signed short*, const double*, int, void*); 
-  void* interp_params = NULL; 
-  rk_state rng; 
+  fff_imatch_joint_hist_mt(H, clampI, clampJ, imI, imJ_padded, Tvox, interp, 1); 
+  return; 
+}
 
-  /* Set interpolation method */ 
-  if (interp==0) 
-    interpolate = &_pv_interpolation;
-  else if (interp>0) 
-    interpolate = &_tri_interpolation; 
-  else { /* interp < 0 */ 
-    interpolate = &_rand_interpolation;
-    rk_seed(-interp, &rng); 
-    interp_params = (void*)(&rng); 
+
+/* 
+   Multi-threaded joint histogram. 
+
+   Each worker owns a band of consecutive rows of H (i.e. a range of
+   source intensities) and scans the whole source image, only
+   processing the voxels that fall into its band. Hence, no two
+   workers ever write to the same bin, and each bin receives its
+   contributions in the same order as in the serial loop: the result
+   is bit-identical to the serial computation, including PV
+   interpolation. Bands are balanced by first counting the source
+   intensities in parallel over slabs of the source image.
+
+   Random interpolation draws only depend on the source voxel
+   coordinates, hence random joint histograms are bit-identical too.
+*/ 
+
+typedef struct {
+  double* H; 
+  int clampI; 
+  int clampJ; 
+  const fff_array* imI;
+  const fff_array* imJ_padded; 
+  const double* Tvox; 
+  int interp; 
+  unsigned int* counts; 
+  int* bands; 
+} _fff_imatch_joint_hist_job; 
+
+
+static void _fff_imatch_count_source_slab(int rank, int nthreads, void* params)
+{
+  _fff_imatch_joint_hist_job* job = (_fff_imatch_joint_hist_job*)params; 
+  const fff_array* imI = job->imI; 
+  unsigned int* counts = job->counts + rank*job->clampI; 
+  fff_array slab; 
+  fff_array_iterator iter; 
+  size_t x0, x1; 
+  int i; 
+
+  fff_parallel_range(imI->dimX, rank, nthreads, &x0, &x1); 
+  if (x1 <= x0) 
+    return; 
+
+  slab = fff_array_get_block(imI, x0, x1-1, 1, 
+			     0, imI->dimY-1, 1, 
+			     0, imI->dimZ-1, 1, 
+			     0, imI->dimT-1, 1); 
+  iter = fff_array_iterator_init(&slab); 
+  while(iter.idx < iter.size) {
+    i = (int)fff_array_get_from_iterator((&slab), iter); 
+    if ((i>=0) && (i<job->clampI)) 
+      counts[i] ++; 
+    fff_array_iterator_update(&iter); 
   }
 
+  return; 
+}
+
+static void _fff_imatch_joint_hist_band_job(int rank, int nthreads, void* params)
+{
+  _fff_imatch_joint_hist_job* job = (_fff_imatch_joint_hist_job*)params; 
+  int ilo = job->bands[rank], ihi = job->bands[rank+1]; 
+
+  if (ihi > ilo) 
+    _fff_imatch_joint_hist_band(job->H, job->clampI, job->clampJ, 
+				job->imI, job->imJ_padded, job->Tvox, 
+				job->interp, ilo, ihi); 
+  return; 
+}
+
+static void _fff_imatch_joint_hist_mt(double* H, int clampI, int clampJ,  
+				      const fff_array* imI,
+				      const fff_array* imJ_padded, 
+				      const double* Tvox, 
+				      int interp, 
+				      int nthreads)
+{
+  _fff_imatch_joint_hist_job job; 
+  double total, cum, target; 
+  int i, k; 
+
   /* Re-initialize joint histogram */ 
   memset((void*)H, 0, clampI*clampJ*sizeof(double));
 
-  /* Looop over source voxels */
-  while(iterI.idx < iterI.size) {
-  
-    /* Source voxel intensity */
-    i = (int)fff_array_get_from_iterator(imI, iterI); 
+  nthreads = fff_threads_count(nthreads); 
+  if (nthreads > clampI) 
+    nthreads = clampI; 
 
-    /* Source voxel coordinates */
-    x = iterI.x;
-    y = iterI.y;
-    z = iterI.z;
-    
-    /* Compute the transformed grid coordinates of current voxel */ 
-    _apply_affine_transformation(&Tx, &Ty, &Tz, Tvox, x, y, z); 
-    
-    /* Test whether the current voxel is below the intensity
-       threshold, or the transformed point is completly outside
-       the reference grid */
-    if ((i>=0) && 
-	 (Tx>-1) && (Tx<dimJX) && 
-	 (Ty>-1) && (Ty<dimJY) && 
-	 (Tz>-1) && (Tz<dimJZ)) {
-	
-      /* 
-	 Nearest neighbor (floor coordinates in the padded
-	 image, hence +1). 
-	 
-	 Notice that using the floor function doubles excetution time.
-	 
-	 FIXME: see if we can replace this with assembler instructions. 
-      */
-      nx = FFF_FLOOR(Tx) + 1;
-      ny = FFF_FLOOR(Ty) + 1;
-      nz = FFF_FLOOR(Tz) + 1;
-      
-      /* The convention for neighbor indexing is as follows:
-       *
-       *   Floor slice        Ceil slice
-       *
-       *     2----6             3----7                     y          
-       *     |    |             |    |                     ^ 
-       *     |    |             |    |                     |
-       *     0----4             1----5                     ---> x
-       */
-      
-      /*** Trilinear interpolation weights.  
-	   Note: wx = nnx + 1 - Tx, where nnx is the location in
-	   the NON-PADDED grid */ 
-      wx = nx - Tx; 
-      wy = ny - Ty;
-      wz = nz - Tz;
-      wxwy = wx*wy;    
-      wxwz = wx*wz;
-      wywz = wy*wz;
-      
-      /*** Prepare buffers */ 
-      bufJnn = Jnn;
-      bufW = W; 
-      
-      /*** Initialize neighbor list */
-      off = nx*u4 + ny*u2 + nz; 
-      nn = 0; 
-      
-      /*** Neighbor 0: (0,0,0) */ 
-      W0 = wxwy*wz; 
-      APPEND_NEIGHBOR(off, W0); 
-      
-      /*** Neighbor 1: (0,0,1) */ 
-      APPEND_NEIGHBOR(off+1, wxwy-W0);
-      
-      /*** Neighbor 2: (0,1,0) */ 
-      W2 = wxwz-W0; 
-      APPEND_NEIGHBOR(off+u2, W2);  
-      
-      /*** Neightbor 3: (0,1,1) */
-      W3 = wx-wxwy-W2;  
-      APPEND_NEIGHBOR(off+u3, W3);  
-      
-      /*** Neighbor 4: (1,0,0) */
-      W4 = wywz-W0;  
-      APPEND_NEIGHBOR(off+u4, W4); 
-      
-      /*** Neighbor 5: (1,0,1) */ 
-      APPEND_NEIGHBOR(off+u5, wy-wxwy-W4);   
-      
-      /*** Neighbor 6: (1,1,0) */ 
-      APPEND_NEIGHBOR(off+u6, wz-wxwz-W4);  
-      
-      /*** Neighbor 7: (1,1,1) */ 
-      APPEND_NEIGHBOR(off+u7, 1-W3-wy-wz+wywz);  
-      
-      /* Update the joint histogram using the desired interpolation technique */ 
-      interpolate(i, H, clampJ, Jnn, W, nn, interp_params); 
-      
-      
-    } /* End of IF TRANSFORMS INSIDE */
-    
-    /* Update source index */ 
-    fff_array_iterator_update(&iterI); 
-    
-  } /* End of loop over voxels */ 
-  
+  /* Serial case */ 
+  if (nthreads <= 1) {
+    _fff_imatch_joint_hist_band(H, clampI, clampJ, imI, imJ_padded, Tvox, interp, 0, clampI); 
+    return; 
+  }
+
+  job.H = H; 
+  job.clampI = clampI; 
+  job.clampJ = clampJ; 
+  job.imI = imI; 
+  job.imJ_padded = imJ_padded; 
+  job.Tvox = Tvox; 
+  job.interp = interp; 
+  job.counts = (unsigned int*)calloc(nthreads*clampI, sizeof(unsigned int)); 
+  job.bands = (int*)malloc((nthreads+1)*sizeof(int)); 
+  if ((job.counts == NULL) || (job.bands == NULL)) {
+    FFF_WARNING("Could not allocate band data, running serially"); 
+    free(job.counts); 
+    free(job.bands); 
+    _fff_imatch_joint_hist_band(H, clampI, clampJ, imI, imJ_padded, Tvox, interp, 0, clampI); 
+    return; 
+  }
+
+  /* Count source intensities over slabs and reduce counts into the
+     first slab's buffer (integer sums, hence exact) */ 
+  fff_parallel_run(nthreads, &_fff_imatch_count_source_slab, (void*)&job); 
+  for (k=1; k<nthreads; k++) 
+    for (i=0; i<clampI; i++) 
+      job.counts[i] += job.counts[k*clampI+i]; 
+
+  /* Split histogram rows into bands of roughly equal voxel counts */ 
+  for (i=0, total=0.0; i<clampI; i++) 
+    total += job.counts[i]; 
+  job.bands[0] = 0; 
+  for (k=1, i=0, cum=0.0; k<nthreads; k++) {
+    target = (total*k)/nthreads; 
+    while ((i<clampI) && (cum+job.counts[i] <= target)) {
+      cum += job.counts[i]; 
+      i ++; 
+    }
+    job.bands[k] = FFF_MAX(i, job.bands[k-1]); 
+  }
+  job.bands[nthreads] = clampI; 
+
+  /* Accumulate the joint histogram band-wise */ 
+  fff_parallel_run(nthreads, &_fff_imatch_joint_hist_band_job, (void*)&job); 
+
+  free(job.counts); 
+  free(job.bands); 
+
+  return; 
+}
+
+void fff_imatch_joint_hist_mt(double* H, int clampI, int clampJ,  
+			      const fff_array* imI,
+			      const fff_array* imJ_padded, 
+			      const double* Tvox, 
+			      int interp, 
+			      int nthreads)
+{
+  FFF_PROFILE_BEGIN(FFF_PROFILE_JOINT_HIST); 
+  _fff_imatch_joint_hist_mt(H, clampI, clampJ, imI, imJ_padded, Tvox, interp, nthreads); 
+  FFF_PROFILE_END(FFF_PROFILE_JOINT_HIST); 
+  FFF_PROFILE_COUNT(FFF_PROFILE_VOXELS, imI->dimX*imI->dimY*imI->dimZ*imI->dimT); 
   return; 
 }
 
@@ -276,7 +546,8 @@ static inline void _tri_interpolation(int i,
   return; 
 }
 
-/* Random interpolation. */
+/* Random interpolation. The draw is a function of the seed and the
+   source voxel coordinates. */
 static inline void _rand_interpolation(int i, 
 				       double* H, int clampJ, 
 				       const signed short* J, 
@@ -284,7 +555,7 @@ static inline void _rand_interpolation(int i,
 				       int nn, 
 				       void* params) 
 { 
-  rk_state* rng = (rk_state*)params; 
+  _fff_imatch_rand_params* rp = (_fff_imatch_rand_params*)params; 
   int k;
   int clampJ_i = clampJ*i;
   const double *bufW;
@@ -293,7 +564,7 @@ static inline void _rand_interpolation(int i,
   for(k=0, bufW=W, sumW=0.0; k<nn; k++, bufW++) 
     sumW += *bufW; 
   
-  draw = sumW*rk_double(rng); 
+  draw = sumW*rk_counter_double(rp->seed, rp->x, rp->y, rp->z); 
 
   for(k=0, bufW=W, sumW=0.0; k<nn; k++, bufW++) {
     sumW += *bufW; 
@@ -833,52 +1104,246 @@ static void _L1_moments (const double * h, int clamp, int stride,
    RESAMPLING ROUTINES
    ========================================================================= */
 
+/* Output voxels are resampled by square tiles of their (y,z)
+   planes, so that neighbouring voxels map to neighbouring source
+   coefficients */ 
+#define FFF_IMATCH_RESAMPLE_TILE 16
+
+typedef struct {
+  fff_array* res; 
+  const fff_array* coef; /* double source image, or its cubic spline coefficients */ 
+  const double* Tvox; 
+  int order; 
+  long box[6]; /* bounds of the output voxels that may map into the source */  
+} _fff_imatch_resample_job; 
+
+
+/* Value of the source at a transformed point, zero outside the image */ 
+static inline double _fff_imatch_resample_point(const fff_array* coef, int order, 
+						double Tx, double Ty, double Tz)
+{
+  const double* c = (const double*)coef->data; 
+  size_t ddimX=coef->dimX-1, ddimY=coef->dimY-1, ddimZ=coef->dimZ-1; 
+  size_t oX=coef->offsetX, oY=coef->offsetY, oZ=coef->offsetZ; 
+  size_t x, y, z, dx, dy, dz; 
+  double wx, wy, wz; 
+
+  if ((Tx<0) || (Tx>ddimX) ||
+      (Ty<0) || (Ty>ddimY) ||
+      (Tz<0) || (Tz>ddimZ))
+    return 0.0; 
+
+  if (order == 3)
+    return fff_cubic_spline_sample_image(Tx, Ty, Tz, 0, coef); 
+
+  if (order == 0) 
+    return c[(size_t)(Tx+0.5)*oX + (size_t)(Ty+0.5)*oY + (size_t)(Tz+0.5)*oZ]; 
+
+  /* Trilinear interpolation; the upper neighbours of points on the
+     last plane of an axis have zero weight */ 
+  x = (size_t)Tx; wx = Tx - x; dx = (x < ddimX) ? oX : 0; 
+  y = (size_t)Ty; wy = Ty - y; dy = (y < ddimY) ? oY : 0; 
+  z = (size_t)Tz; wz = Tz - z; dz = (z < ddimZ) ? oZ : 0; 
+  c += x*oX + y*oY + z*oZ; 
+  return 
+    (1-wx)*((1-wy)*((1-wz)*c[0] + wz*c[dz]) + 
+	    wy*((1-wz)*c[dy] + wz*c[dy+dz])) + 
+    wx*((1-wy)*((1-wz)*c[dx] + wz*c[dx+dz]) + 
+	wy*((1-wz)*c[dx+dy] + wz*c[dx+dy+dz])); 
+}
+
+/* Store n values along the third axis of the output, rounded to
+   the nearest integer for integer types as by the set accessors */ 
+static void _fff_imatch_resample_store(fff_array* res, char* row, const double* buf, size_t n)
+{
+  size_t k, off = res->offsetZ; 
+
+  switch (res->datatype) {
+  case FFF_UCHAR: 
+    {
+      unsigned char* r = (unsigned char*)row; 
+      for (k=0; k<n; k++) r[k*off] = (unsigned char)FFF_ROUND(buf[k]); 
+    }
+    break; 
+  case FFF_SSHORT: 
+    {
+      signed short* r = (signed short*)row; 
+      for (k=0; k<n; k++) r[k*off] = (signed short)FFF_ROUND(buf[k]); 
+    }
+    break; 
+  case FFF_FLOAT: 
+    {
+      float* r = (float*)row; 
+      for (k=0; k<n; k++) r[k*off] = (float)buf[k]; 
+    }
+    break; 
+  case FFF_DOUBLE: 
+    {
+      double* r = (double*)row; 
+      for (k=0; k<n; k++) r[k*off] = buf[k]; 
+    }
+    break; 
+  default: 
+    for (k=0; k<n; k++) 
+      res->set(row, k*off, buf[k]); 
+    break; 
+  }
+
+  return; 
+}
+
+static void _fff_imatch_resample_slab(int rank, int nthreads, void* params)
+{
+  _fff_imatch_resample_job* job = (_fff_imatch_resample_job*)params; 
+  fff_array* res = job->res; 
+  const long* box = job->box; 
+  double buf[FFF_IMATCH_RESAMPLE_TILE]; 
+  double Tx, Ty, Tz; 
+  size_t x, y, z, x0, x1, y0, y1, z0, z1, k; 
+  char* row; 
+  int inside; 
+
+  fff_parallel_range(res->dimX, rank, nthreads, &x0, &x1); 
+  for (x=x0; x<x1; x++) 
+    for (y0=0; y0<res->dimY; y0+=FFF_IMATCH_RESAMPLE_TILE)
+      for (z0=0; z0<res->dimZ; z0+=FFF_IMATCH_RESAMPLE_TILE) {
+	y1 = FFF_MIN(y0+FFF_IMATCH_RESAMPLE_TILE, res->dimY); 
+	z1 = FFF_MIN(z0+FFF_IMATCH_RESAMPLE_TILE, res->dimZ); 
+	for (y=y0; y<y1; y++) {
+	  inside = ((long)x >= box[0]) && ((long)x <= box[1]) && 
+	    ((long)y >= box[2]) && ((long)y <= box[3]); 
+	  for (z=z0, k=0; z<z1; z++, k++) {
+	    if (inside && ((long)z >= box[4]) && ((long)z <= box[5])) {
+	      _apply_affine_transformation(&Tx, &Ty, &Tz, job->Tvox, x, y, z); 
+	      buf[k] = _fff_imatch_resample_point(job->coef, job->order, Tx, Ty, Tz); 
+	    }
+	    else 
+	      buf[k] = 0.0; 
+	  }
+	  row = (char*)res->data + x*res->byte_offsetX + y*res->byte_offsetY + z0*res->byte_offsetZ; 
+	  _fff_imatch_resample_store(res, row, buf, z1-z0); 
+	}
+      }
+
+  return; 
+}
+
+/* 
+   Bounding box of the output voxels mapped into the source, from the
+   preimages of the source corners, with a one-voxel margin against
+   rounding errors. The whole output if clip is zero or Tvox is not
+   invertible. 
+*/ 
+static void _fff_imatch_resample_box(long* box, const fff_array* res, const fff_array* im, 
+				     const double* Tvox, int clip)
+{
+  const double* T = Tvox; 
+  double inv[9], det, s[3], p, pmin[3], pmax[3], lo, hi; 
+  size_t dims[3] = {res->dimX, res->dimY, res->dimZ}; 
+  size_t ddims[3] = {im->dimX-1, im->dimY-1, im->dimZ-1}; 
+  int c, i; 
+
+  for (i=0; i<3; i++) {
+    box[2*i] = 0; 
+    box[2*i+1] = (long)dims[i]-1; 
+  }
+  if (!clip) 
+    return; 
+
+  inv[0] = T[5]*T[10] - T[6]*T[9]; 
+  inv[1] = T[2]*T[9] - T[1]*T[10]; 
+  inv[2] = T[1]*T[6] - T[2]*T[5]; 
+  inv[3] = T[6]*T[8] - T[4]*T[10]; 
+  inv[4] = T[0]*T[10] - T[2]*T[8]; 
+  inv[5] = T[2]*T[4] - T[0]*T[6]; 
+  inv[6] = T[4]*T[9] - T[5]*T[8]; 
+  inv[7] = T[1]*T[8] - T[0]*T[9]; 
+  inv[8] = T[0]*T[5] - T[1]*T[4]; 
+  det = T[0]*inv[0] + T[1]*inv[3] + T[2]*inv[6]; 
+  if (FFF_ABS(det) < FFF_TINY) 
+    return; 
+
+  for (c=0; c<8; c++) {
+    for (i=0; i<3; i++) 
+      s[i] = ((c>>i)&1)*(double)ddims[i] - T[4*i+3]; 
+    for (i=0; i<3; i++) {
+      p = (inv[3*i]*s[0] + inv[3*i+1]*s[1] + inv[3*i+2]*s[2])/det; 
+      pmin[i] = (c == 0) ? p : FFF_MIN(pmin[i], p); 
+      pmax[i] = (c == 0) ? p : FFF_MAX(pmax[i], p); 
+    }
+  }
+  
+  for (i=0; i<3; i++) {
+    lo = FFF_MAX(floor(pmin[i])-1, 0); 
+    hi = FFF_MIN(ceil(pmax[i])+1, (double)dims[i]-1); 
+    if (lo > hi) {
+      box[2*i] = 1; 
+      box[2*i+1] = 0; 
+    }
+    else {
+      box[2*i] = (long)lo; 
+      box[2*i+1] = (long)hi; 
+    }
+  }
+
+  return; 
+}
+
+void fff_imatch_resample_mt(fff_array* im_resampled, 
+			    const fff_array* im, 
+			    const double* Tvox, 
+			    int order, 
+			    int clip, 
+			    int nthreads)
+{
+  _fff_imatch_resample_job job; 
+  fff_array* coef = NULL; 
+
+  if ((order != 0) && (order != 1) && (order != 3)) {
+    FFF_WARNING("Unsupported interpolation order"); 
+    return; 
+  }
+
+  /* Cubic spline coefficients, or a double copy of the source for
+     lower orders */ 
+  if ((order == 3) || (im->datatype != FFF_DOUBLE)) {
+    coef = fff_array_new3d(FFF_DOUBLE, im->dimX, im->dimY, im->dimZ);
+    if (coef == NULL) {
+      FFF_ERROR("Out of memory", ENOMEM); 
+      return; 
+    }
+    if (order == 3) 
+      fff_cubic_spline_transform_image_mt(coef, im, nthreads); 
+    else 
+      fff_array_copy(coef, im); 
+  }
+
+  job.res = im_resampled; 
+  job.coef = (coef != NULL) ? coef : im; 
+  job.Tvox = Tvox; 
+  job.order = order; 
+  _fff_imatch_resample_box(job.box, im_resampled, im, Tvox, clip); 
+
+  nthreads = fff_threads_count(nthreads); 
+  if (nthreads > (int)im_resampled->dimX) 
+    nthreads = (int)im_resampled->dimX; 
+  if (nthreads >= 1) 
+    fff_parallel_run(nthreads, &_fff_imatch_resample_slab, (void*)&job); 
+
+  if (coef != NULL) 
+    fff_array_delete(coef); 
+
+  return;
+}
+
 /* Tvox is the voxel transformation from source to target 
    Resample a 2d-3d image undergoing an affine transformation. */
 void fff_imatch_resample(fff_array* im_resampled, 
 			  const fff_array* im, 
 			  const double* Tvox)
 {
-  double i1;
-  fff_array* im_spline_coeff;
-  fff_array_iterator imIter = fff_array_iterator_init(im_resampled); 
-  size_t x, y, z;
-  size_t ddimX=im->dimX-1, ddimY=im->dimY-1, ddimZ=im->dimZ-1; 
-  double Tx, Ty, Tz;
-  fff_vector* work; 
-  size_t work_size; 
-
-  /* Compute the spline coefficient image */
-  im_spline_coeff = fff_array_new3d(FFF_DOUBLE, im->dimX, im->dimY, im->dimZ);
-  work_size = FFF_MAX(im->dimX, im->dimY); 
-  work_size = FFF_MAX(work_size, im->dimZ); 
-  work = fff_vector_new(work_size);   
-  fff_cubic_spline_transform_image(im_spline_coeff, im, work);
-  fff_vector_delete(work); 
-
-  /* Resampling loop */
-  while(imIter.idx < imIter.size) {
-    x = imIter.x;
-    y = imIter.y; 
-    z = imIter.z; 
-    _apply_affine_transformation(&Tx, &Ty, &Tz, Tvox, x, y, z); 
-    if ((Tx<0) || (Tx>ddimX) ||
-	(Ty<0) || (Ty>ddimY) ||
-	(Tz<0) || (Tz>ddimZ))
-      i1 = 0.0; 
-    else 
-      i1 = fff_cubic_spline_sample_image(Tx, Ty, Tz, 0, im_spline_coeff); 
-
-    /* fff_array_set3d(im_resampled, x, y, z, i1); */
-    fff_array_set_from_iterator(im_resampled, imIter, i1); 
-    fff_array_iterator_update(&imIter); 
-  }
-
-  /* Free coefficient image */
-  fff_array_delete(im_spline_coeff); 
-
+  fff_imatch_resample_mt(im_resampled, im, Tvox, 3, 0, 1); 
   return;
-	 
 }
 
 
@@ -888,6 +1353,27 @@ void fff_imatch_resample(fff_array* im_resampled,
    MEMORY ALLOCATION
    ========================================================================= */
 
+/* 
+   Convert a clamped SSHORT image into UCHAR, mapping negative values
+   to FFF_IMATCH_UCHAR_PAD. 
+*/ 
+static fff_array* _fff_imatch_narrow(const fff_array* im)
+{
+  fff_array* res = fff_array_new3d(FFF_UCHAR, im->dimX, im->dimY, im->dimZ);
+  fff_array_iterator iter = fff_array_iterator_init(im); 
+  fff_array_iterator iterRes = fff_array_iterator_init(res); 
+  double v; 
+
+  while(iter.idx < iter.size) {
+    v = fff_array_get_from_iterator(im, iter); 
+    fff_array_set_from_iterator(res, iterRes, (v<0 ? FFF_IMATCH_UCHAR_PAD : v)); 
+    fff_array_iterator_update(&iter); 
+    fff_array_iterator_update(&iterRes); 
+  }
+
+  return res; 
+}
+
 fff_imatch* fff_imatch_new (const fff_array* imI,
 			     const fff_array* imJ,
 			     double thI,
@@ -896,6 +1382,7 @@ fff_imatch* fff_imatch_new (const fff_array* imI,
 			     int clampJ)
 {
   fff_imatch* imatch;
+  fff_array* aux; 
   
   /* Verify that input images are not 4D */ 
   if ((imI->ndims == FFF_ARRAY_4D) ||
@@ -926,6 +1413,24 @@ fff_imatch* fff_imatch_new (const fff_array* imI,
 					 1, imJ->dimY, 1,
 					 1, imJ->dimZ, 1);
   fff_array_clamp(imatch->imJ, imJ, thJ, &clampJ);
+
+  /* Switch to UCHAR encoding whenever the number of bins allows it,
+     which halves the memory footprint of the images scanned by the
+     joint histogram kernels */
+  if (clampI <= FFF_IMATCH_UCHAR_PAD) {
+    aux = _fff_imatch_narrow(imatch->imI); 
+    fff_array_delete(imatch->imI); 
+    imatch->imI = aux; 
+  }
+  if (clampJ <= FFF_IMATCH_UCHAR_PAD) {
+    aux = _fff_imatch_narrow(imatch->imJ_padded); 
+    fff_array_delete(imatch->imJ_padded); 
+    imatch->imJ_padded = aux; 
+    *(imatch->imJ) = fff_array_get_block3d(imatch->imJ_padded, 
+					   1, imJ->dimX, 1,  
+					   1, imJ->dimY, 1,
+					   1, imJ->dimZ, 1);
+  }
   
 
   /* Create the joint histogram structure. Important notice: in all
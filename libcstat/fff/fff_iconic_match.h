@@ -24,9 +24,9 @@ extern "C" {
 
   typedef struct fff_imatch{
     
-    fff_array* imI; /* Source image in signed short format */  
-    fff_array* imJ; /* Target image in signed short format */  
-    fff_array* imJ_padded; /* Enlarged target image with borders padded with -1 */  
+    fff_array* imI; /* Source image in signed short or unsigned char format */  
+    fff_array* imJ; /* Target image, view on imJ_padded */  
+    fff_array* imJ_padded; /* Enlarged target image with padded borders (see fff_imatch_new) */  
     
     int clampI; 
     int clampJ; 
@@ -66,6 +66,19 @@ extern "C" {
 				     const double* Tvox, 
 				     int interp ); 
 
+  /* 
+     Same as fff_imatch_joint_hist, using \a nthreads threads (all
+     available processors if nthreads<=0). The result is
+     bit-identical to the serial computation whatever the number of
+     threads, including for random interpolation. 
+  */ 
+  extern void fff_imatch_joint_hist_mt( double* H, int clampI, int clampJ,  
+					const fff_array* imI,
+					const fff_array* imJ_padded, 
+					const double* Tvox, 
+					int interp, 
+					int nthreads ); 
+
   extern unsigned int fff_imatch_source_npoints( const fff_array* imI ); 
 
 
@@ -101,7 +114,38 @@ extern "C" {
 				   const fff_array* im, 
 				   const double* Tvox ); 
 
+  /*!
+    \brief Apply a transformation to an image with a given interpolation
+    \param im_resampled output image, of any data type
+    \param im input image
+    \param Tvox voxel transformation 
+    \param order interpolation order: 0 (nearest neighbour), 1 (trilinear) or 3 (cubic spline)
+    \param clip if non-zero, only resample output voxels within the
+    bounding box of the preimages of the input corners
+    \param nthreads number of threads (all available processors if
+    nthreads<=0)
+
+    Same as \c fff_imatch_resample for \a order 3. Points outside
+    the input image are set to zero. Values are stored directly in
+    the data type of \a im_resampled, rounded to the nearest integer
+    for integer types. Clipping skips the output voxels that can't
+    map into the input, and does not change the result, which does
+    not depend on \a nthreads either.
+  */ 
+  extern void fff_imatch_resample_mt( fff_array* im_resampled, 
+				      const fff_array* im, 
+				      const double* Tvox, 
+				      int order, 
+				      int clip, 
+				      int nthreads ); 
 
+
+  /* 
+     Clamp the source and target images and pad the target. Images
+     are encoded in unsigned char when the number of bins is at most
+     255, in which case out-of-mask voxels and borders hold 255, and
+     in signed short otherwise, in which case they hold -1.
+  */
   extern fff_imatch* fff_imatch_new ( const fff_array* imI,
 				      const fff_array* imJ,
 				      double thI,
@@ -0,0 +1,329 @@
+#include "fff_kdtree.h"
+#include "fff_base.h"
+
+#include <stdlib.h>
+
+
+static long _fff_kdtree_count(const long n, const long leafsize);
+static void _fff_kdtree_build(fff_kdtree* T, const long node, long* next, const long leafsize);
+static void _fff_kdtree_select(long* idx, const long n, const long m, const fff_matrix* X, const long c);
+static double _fff_kdtree_box_d2(const fff_kdtree* T, const long node, const double* x);
+static int _fff_kdtree_long_cmp(const void* a, const void* b);
+
+/* Squared distance from x to the point p, in the same order as a
+   brute-force scan; the summation stops as soon as it exceeds thr */
+static double _fff_kdtree_d2(const fff_kdtree* T, const double* x, const long p, const double thr)
+{
+  long t;
+  double dx, d2 = 0;
+  const double* y = T->X->data + p*T->X->tda;
+
+  for (t=0 ; t<T->dim ; t++){
+    dx = x[t] - y[t];
+    d2 += dx*dx;
+    if (d2 > thr)
+      break;
+  }
+  return d2;
+}
+
+
+/**********************************************************************
+ ******************************* build *********************************
+ **********************************************************************/
+
+fff_kdtree* fff_kdtree_new(const fff_matrix* X, const long leafsize)
+{
+  long i, next = 1;
+  long n = X->size1, dim = X->size2, ls = FFF_MAX(leafsize, 1);
+  fff_kdtree* T = (fff_kdtree*) calloc(1, sizeof(fff_kdtree));
+
+  if (T == NULL)
+    return NULL;
+  T->X = X;
+  T->n = n;
+  T->dim = dim;
+  T->nnodes = _fff_kdtree_count(n, ls);
+  T->idx = (long*) calloc(FFF_MAX(n,1), sizeof(long));
+  T->start = (long*) calloc(T->nnodes, sizeof(long));
+  T->stop = (long*) calloc(T->nnodes, sizeof(long));
+  T->child = (long*) calloc(T->nnodes, sizeof(long));
+  T->lo = (double*) calloc(FFF_MAX(T->nnodes*dim,1), sizeof(double));
+  T->hi = (double*) calloc(FFF_MAX(T->nnodes*dim,1), sizeof(double));
+  if ((T->idx == NULL) | (T->start == NULL) | (T->stop == NULL) |
+      (T->child == NULL) | (T->lo == NULL) | (T->hi == NULL)){
+    fff_kdtree_delete(T);
+    return NULL;
+  }
+
+  for (i=0 ; i<n ; i++)
+    T->idx[i] = i;
+  T->start[0] = 0;
+  T->stop[0] = n;
+  _fff_kdtree_build(T, 0, &next, ls);
+
+  return T;
+}
+
+void fff_kdtree_delete(fff_kdtree* T)
+{
+  if (T == NULL)
+    return;
+  free(T->idx);
+  free(T->start);
+  free(T->stop);
+  free(T->child);
+  free(T->lo);
+  free(T->hi);
+  free(T);
+}
+
+/* Number of nodes of the tree of n points */
+static long _fff_kdtree_count(const long n, const long leafsize)
+{
+  if (n <= leafsize)
+    return 1;
+  return 1 + _fff_kdtree_count(n/2, leafsize) + _fff_kdtree_count(n-n/2, leafsize);
+}
+
+/* Bounding box of the node, then split at the median of its widest
+   coordinate; the children are numbered in preorder */
+static void _fff_kdtree_build(fff_kdtree* T, const long node, long* next, const long leafsize)
+{
+  long i, t, c = 0;
+  long start = T->start[node], stop = T->stop[node], n = stop-start;
+  double *lo = T->lo + node*T->dim, *hi = T->hi + node*T->dim;
+  const double* y;
+
+  for (t=0 ; t<T->dim ; t++){
+    lo[t] = FFF_POSINF;
+    hi[t] = FFF_NEGINF;
+  }
+  for (i=start ; i<stop ; i++){
+    y = T->X->data + T->idx[i]*T->X->tda;
+    for (t=0 ; t<T->dim ; t++){
+      if (y[t] < lo[t]) lo[t] = y[t];
+      if (y[t] > hi[t]) hi[t] = y[t];
+    }
+  }
+
+  if (n <= leafsize){
+    T->child[node] = -1;
+    return;
+  }
+  for (t=1 ; t<T->dim ; t++)
+    if (hi[t]-lo[t] > hi[c]-lo[c])
+      c = t;
+  _fff_kdtree_select(T->idx+start, n, n/2, T->X, c);
+
+  T->child[node] = *next;
+  *next += 2;
+  T->start[T->child[node]] = start;
+  T->stop[T->child[node]] = start+n/2;
+  T->start[T->child[node]+1] = start+n/2;
+  T->stop[T->child[node]+1] = stop;
+  _fff_kdtree_build(T, T->child[node], next, leafsize);
+  _fff_kdtree_build(T, T->child[node]+1, next, leafsize);
+}
+
+/* Reorder idx so that the m first points have a coordinate c lower
+   than or equal to that of the other ones (Hoare's selection) */
+static void _fff_kdtree_select(long* idx, const long n, const long m, const fff_matrix* X, const long c)
+{
+  long i, j, l = 0, r = n-1, tmp;
+  double pivot;
+  const double* x = X->data + c;
+  long tda = X->tda;
+
+  while (l < r){
+    pivot = x[idx[(l+r)/2]*tda];
+    i = l;
+    j = r;
+    while (i <= j){
+      while (x[idx[i]*tda] < pivot) i++;
+      while (x[idx[j]*tda] > pivot) j--;
+      if (i <= j){
+	tmp = idx[i]; idx[i] = idx[j]; idx[j] = tmp;
+	i++;
+	j--;
+      }
+    }
+    if (m <= j)
+      r = j;
+    else if (m >= i)
+      l = i;
+    else
+      break;
+  }
+}
+
+
+/**********************************************************************
+ ******************************* queries *******************************
+ **********************************************************************/
+
+/* Lower bound of the squared distance from x to the points of the
+   node. It is computed in the same order as _fff_kdtree_d2, with the
+   box corners in place of the point coordinates, hence it can not
+   exceed the distance to any of the points even after rounding. */
+static double _fff_kdtree_box_d2(const fff_kdtree* T, const long node, const double* x)
+{
+  long t;
+  double dx, d2 = 0;
+  const double *lo = T->lo + node*T->dim, *hi = T->hi + node*T->dim;
+
+  for (t=0 ; t<T->dim ; t++){
+    if (x[t] < lo[t])
+      dx = x[t] - lo[t];
+    else if (x[t] > hi[t])
+      dx = x[t] - hi[t];
+    else
+      continue;
+    d2 += dx*dx;
+  }
+  return d2;
+}
+
+typedef struct {
+  const fff_kdtree* T;
+  const double* x;
+  long k;
+  long count;
+  long* nn;
+  double* d2;
+} _fff_kdtree_knn_query;
+
+/* Sorted insertion of the point p, unless it is not among the k best */
+static void _fff_kdtree_knn_insert(_fff_kdtree_knn_query* Q, const long p, const double d2)
+{
+  long i;
+
+  if (Q->count == Q->k){
+    if ((d2 > Q->d2[Q->k-1]) || ((d2 == Q->d2[Q->k-1]) && (p > Q->nn[Q->k-1])))
+      return;
+    i = Q->k-1;
+  }
+  else
+    i = Q->count++;
+  while ((i > 0) && ((Q->d2[i-1] > d2) || ((Q->d2[i-1] == d2) && (Q->nn[i-1] > p)))){
+    Q->d2[i] = Q->d2[i-1];
+    Q->nn[i] = Q->nn[i-1];
+    i--;
+  }
+  Q->d2[i] = d2;
+  Q->nn[i] = p;
+}
+
+static void _fff_kdtree_knn_visit(_fff_kdtree_knn_query* Q, const long node)
+{
+  long i, c, p;
+  double d2, b0, b1, thr;
+  const fff_kdtree* T = Q->T;
+
+  if (T->child[node] < 0){
+    for (i=T->start[node] ; i<T->stop[node] ; i++){
+      p = T->idx[i];
+      thr = (Q->count == Q->k) ? Q->d2[Q->k-1] : FFF_POSINF;
+      d2 = _fff_kdtree_d2(T, Q->x, p, thr);
+      if (d2 <= thr)
+	_fff_kdtree_knn_insert(Q, p, d2);
+    }
+    return;
+  }
+
+  /* nearest child first */
+  c = T->child[node];
+  b0 = _fff_kdtree_box_d2(T, c, Q->x);
+  b1 = _fff_kdtree_box_d2(T, c+1, Q->x);
+  if (b1 < b0){
+    thr = b0; b0 = b1; b1 = thr;
+    c++;
+  }
+  if ((Q->count < Q->k) || (b0 <= Q->d2[Q->k-1]))
+    _fff_kdtree_knn_visit(Q, c);
+  c = 2*T->child[node]+1-c;
+  if ((Q->count < Q->k) || (b1 <= Q->d2[Q->k-1]))
+    _fff_kdtree_knn_visit(Q, c);
+}
+
+long fff_kdtree_knn(long* nn, double* d2, const fff_kdtree* T, const double* x, const long k)
+{
+  _fff_kdtree_knn_query Q;
+
+  if ((k < 1) || (T->n < 1))
+    return 0;
+  Q.T = T;
+  Q.x = x;
+  Q.k = FFF_MIN(k, T->n);
+  Q.count = 0;
+  Q.nn = nn;
+  Q.d2 = d2;
+  _fff_kdtree_knn_visit(&Q, 0);
+  return Q.count;
+}
+
+typedef struct {
+  const fff_kdtree* T;
+  const double* x;
+  double sqeps;
+  int closed;
+  long count;
+  long nmax;
+  long* nn;
+} _fff_kdtree_eps_query;
+
+static void _fff_kdtree_eps_visit(_fff_kdtree_eps_query* Q, const long node)
+{
+  long i;
+  double d2;
+  const fff_kdtree* T = Q->T;
+
+  d2 = _fff_kdtree_box_d2(T, node, Q->x);
+  if ((d2 > Q->sqeps) || ((d2 == Q->sqeps) && (!Q->closed)))
+    return;
+  if (T->child[node] >= 0){
+    _fff_kdtree_eps_visit(Q, T->child[node]);
+    _fff_kdtree_eps_visit(Q, T->child[node]+1);
+    return;
+  }
+  for (i=T->start[node] ; i<T->stop[node] ; i++){
+    d2 = _fff_kdtree_d2(T, Q->x, T->idx[i], Q->sqeps);
+    if ((d2 < Q->sqeps) || ((d2 == Q->sqeps) && (Q->closed))){
+      if (Q->count < Q->nmax)
+	Q->nn[Q->count] = T->idx[i];
+      Q->count++;
+    }
+  }
+}
+
+static int _fff_kdtree_long_cmp(const void* a, const void* b)
+{
+  long la = *((const long*)a), lb = *((const long*)b);
+  return (la > lb) - (la < lb);
+}
+
+long fff_kdtree_eps(long* nn, double* d2, const long nmax, const fff_kdtree* T, const double* x,
+		    const double sqeps, const int closed)
+{
+  long i;
+  _fff_kdtree_eps_query Q;
+
+  if (T->n < 1)
+    return 0;
+  Q.T = T;
+  Q.x = x;
+  Q.sqeps = sqeps;
+  Q.closed = closed;
+  Q.count = 0;
+  Q.nmax = nmax;
+  Q.nn = nn;
+  _fff_kdtree_eps_visit(&Q, 0);
+
+  if (Q.count <= nmax){
+    qsort(nn, Q.count, sizeof(long), &_fff_kdtree_long_cmp);
+    if (d2 != NULL)
+      for (i=0 ; i<Q.count ; i++)
+	d2[i] = _fff_kdtree_d2(T, x, nn[i], FFF_POSINF);
+  }
+  return Q.count;
+}
@@ -0,0 +1,103 @@
+/*!
+  \file fff_kdtree.h
+  \brief k-d tree for nearest neighbour and range queries
+  \date 2009
+
+  A k-d tree recursively splits the rows of a point matrix at the
+  median of their widest coordinate, until the nodes hold at most a
+  given number of points. Each node stores the bounding box of its
+  points, so that queries only visit the nodes that may contain an
+  answer, instead of scanning all the points.
+
+  Squared distances are computed coordinate by coordinate in the same
+  order as a brute-force scan, and nodes are only discarded when their
+  bounding box is strictly beyond the current threshold, so that
+  queries return exactly the same neighbours. Ties are broken by
+  increasing point index.
+
+  The tree only reads the point matrix, and may be queried from
+  several threads at the same time.
+*/
+
+#ifndef FFF_KDTREE
+#define FFF_KDTREE
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "fff_matrix.h"
+
+  /*!
+    \struct fff_kdtree
+    \brief k-d tree of the rows of a matrix
+
+    The points of node \a i are \c idx[start[i]..stop[i]-1], and its
+    bounding box is \c [lo[i*dim+t],hi[i*dim+t]] along coordinate \a
+    t. The children of an inner node \a i are \c child[i] and \c
+    child[i]+1; \c child[i] is -1 for leaves. Node 0 is the root.
+  */
+  typedef struct{
+    const fff_matrix* X;     /*!< points (borrowed, one per row) */
+    long n;                  /*!< number of points */
+    long dim;                /*!< dimension of the points */
+    long nnodes;             /*!< number of nodes */
+    long* idx;               /*!< point indices, grouped by node (n) */
+    long* start;             /*!< first point of each node (nnodes) */
+    long* stop;              /*!< last point of each node plus one (nnodes) */
+    long* child;             /*!< first child of each node, -1 for leaves (nnodes) */
+    double* lo;              /*!< lower corner of the bounding boxes (nnodes*dim) */
+    double* hi;              /*!< upper corner of the bounding boxes (nnodes*dim) */
+  } fff_kdtree;
+
+  /*!
+    \brief Build the k-d tree of the rows of X
+    \param X n*dim matrix of points, which must outlive the tree
+    \param leafsize maximal number of points per leaf
+
+    Returns NULL if memory allocation fails.
+  */
+  extern fff_kdtree* fff_kdtree_new(const fff_matrix* X, const long leafsize);
+
+  /*!
+    \brief Destructor for the fff_kdtree structure
+  */
+  extern void fff_kdtree_delete(fff_kdtree* T);
+
+  /*!
+    \brief k nearest neighbours of a point
+    \param nn indices of the neighbours (k)
+    \param d2 squared distances to the neighbours (k)
+    \param T tree
+    \param x query point (T->dim contiguous coordinates)
+    \param k number of neighbours
+
+    The neighbours are sorted by increasing distance, then index. The
+    number of neighbours found, min(k,T->n), is returned.
+  */
+  extern long fff_kdtree_knn(long* nn, double* d2, const fff_kdtree* T, const double* x, const long k);
+
+  /*!
+    \brief Points within a given distance of a point
+    \param nn indices of the neighbours (nmax)
+    \param d2 squared distances to the neighbours (nmax), or NULL
+    \param nmax size of \a nn and \a d2
+    \param T tree
+    \param x query point (T->dim contiguous coordinates)
+    \param sqeps squared radius
+    \param closed if non-zero, points at distance eps are included
+
+    Finds the points y such that |x-y|^2 < sqeps (or <= sqeps if \a
+    closed), and returns their number. If it is not larger than \a
+    nmax, the points are written in \a nn by increasing index;
+    otherwise, the content of \a nn is undefined and the query should
+    be run again with larger buffers.
+  */
+  extern long fff_kdtree_eps(long* nn, double* d2, const long nmax, const fff_kdtree* T, const double* x,
+			     const double sqeps, const int closed);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -1,9 +1,12 @@
 #include "fff_base.h"
 #include "fff_lapack.h"
+#include "fff_backend.h"
 
 #include <errno.h>
+#include <stdlib.h>
+#include <string.h>
 
-#define FNAME FFF_FNAME
+#define LAPACK(name) (fff_backend_get()->name)
 
 /*
 dgetrf : LU decomp
@@ -19,13 +22,6 @@ dgeqrf: QR decomp
 #define LAPACK_UPLO(Uplo) ( (Uplo)==(CblasUpper) ? "U" : "L" )
 
 
-extern int FNAME(dgetrf)(int* m, int* n, double* a, int* lda, int* ipiv, int* info);
-extern int FNAME(dpotrf)(char *uplo, int* n, double* a, int* lda, int* info); 
-extern int FNAME(dgesdd)(char *jobz, int* m, int* n, double* a, int* lda, double* s, double* u, int* ldu,
-			 double* vt, int* ldvt, double* work, int* lwork, int* iwork, int* info);
-extern int FNAME(dgeqrf)(int* m, int* n, double* a, int* lda, double* tau, double* work, int* lwork, int* info);
-
-
 /* Cholesky decomposition */ 
 /*** Aux needs be square with the same size as A ***/
 int fff_lapack_dpotrf( CBLAS_UPLO_t Uplo, fff_matrix* A, fff_matrix* Aux )
@@ -38,7 +34,7 @@ int fff_lapack_dpotrf( CBLAS_UPLO_t Uplo, fff_matrix* A, fff_matrix* Aux )
   CHECK_SQUARE(A); 
   
   fff_matrix_transpose( Aux, A ); 
-  FNAME(dpotrf)(uplo, &n, Aux->data, &lda, &info); 
+  LAPACK(dpotrf)(uplo, &n, Aux->data, &lda, &info); 
   fff_matrix_transpose( A, Aux ); 
   
   return info; 
@@ -61,7 +57,7 @@ int fff_lapack_dgetrf( fff_matrix* A, fff_array* ipiv, fff_matrix* Aux )
     FFF_ERROR("Invalid array: Ipiv", EDOM); 
 
   fff_matrix_transpose( Aux, A );
-  FNAME(dgetrf)(&m, &n, Aux->data, &lda, (int*)ipiv->data, &info);
+  LAPACK(dgetrf)(&m, &n, Aux->data, &lda, (int*)ipiv->data, &info);
   fff_matrix_transpose( A, Aux ); 
   
   return info; 
@@ -92,7 +88,7 @@ int fff_lapack_dgeqrf( fff_matrix* A, fff_vector* tau, fff_vector* work, fff_mat
       FFF_ERROR("Invalid vector: work", EDOM); 
 
   fff_matrix_transpose( Aux, A );
-  FNAME(dgeqrf)(&m, &n, Aux->data, &lda, tau->data, work->data, &lwork, &info); 
+  LAPACK(dgeqrf)(&m, &n, Aux->data, &lda, tau->data, work->data, &lwork, &info); 
   fff_matrix_transpose( A, Aux ); 
   
   return info; 
@@ -128,7 +124,6 @@ int fff_lapack_dgesdd( fff_matrix* A, fff_vector* s, fff_matrix* U, fff_matrix*
   int ldvt = (int)Vt->tda;
   int lwork = work->size;  
 
-  fff_matrix Aux_mm, Aux_nn; 
   
   CHECK_SQUARE(U);
   CHECK_SQUARE(Vt);
@@ -163,18 +158,13 @@ int fff_lapack_dgesdd( fff_matrix* A, fff_vector* s, fff_matrix* U, fff_matrix*
      => U = V*, V = U*, s = s* 
      so we just need to swap m <-> n, and U <-> Vt in the input line
   */
-  FNAME(dgesdd)("A", &n, &m, A->data, &lda, 
+  LAPACK(dgesdd)("A", &n, &m, A->data, &lda, 
 		s->data, Vt->data, &ldvt, U->data, &ldu, 
 		work->data, &lwork, (int*)iwork->data, &info);
 
-  /* At this point, both U and V are in Fortran order, so we need to
-     transpose */
-  Aux_mm = fff_matrix_block( Aux, 0, m, 0, m );
-  fff_matrix_transpose(&Aux_mm, U); 
-  fff_matrix_memcpy(U, &Aux_mm); 
-  Aux_nn = fff_matrix_block( Aux, 0, n, 0, n ); 
-  fff_matrix_transpose(&Aux_nn, Vt); 
-  fff_matrix_memcpy(Vt, &Aux_nn); 
+  /* At this point, U and Vt hold the Fortran-order V* and U*,
+     i.e. the C-order transposes of V*t and U*t, which are U and Vt:
+     no transposition is needed */
 
   return info; 
 }
@@ -240,9 +230,9 @@ extern int fff_lapack_inv_sym(fff_matrix* iA, fff_matrix *A)
   for (i=0 ; i<n ; i++)
 	fff_matrix_set(iS,i,i,1.0/fff_vector_get(s,i));
 
-  /* these two lines were mean to make it work with AR's bug */
-  fff_blas_dgemm (CblasNoTrans, CblasNoTrans,1,U,iS, 0, aux);
-  fff_blas_dgemm (CblasNoTrans, CblasTrans,1,aux,Vt,0, iA);
+  /* A = U S Vt => iA = V iS Ut */
+  fff_blas_dgemm (CblasTrans, CblasNoTrans,1,Vt,iS, 0, aux);
+  fff_blas_dgemm (CblasNoTrans, CblasTrans,1,aux,U,0, iA);
   
   fff_matrix_delete(U);
   fff_matrix_delete(Vt);
@@ -253,3 +243,203 @@ extern int fff_lapack_inv_sym(fff_matrix* iA, fff_matrix *A)
   return info;
   
 }
+
+
+/* 
+   Batched kernels for small symmetric positive definite matrices 
+
+   Each row of the input holds a d-by-d matrix in row-major order.
+   Matrices are factored in place in a d-by-d work buffer by an inline
+   Cholesky kernel, instantiated with constant d for d<=4 so that the
+   compiler fully unrolls it. Matrices that are not numerically
+   positive definite fall back on the SVD-based routines above.
+*/
+
+#define FFF_LAPACK_SMALL 4
+
+/* 
+   Cholesky factorization a = L L^t in place, in the lower triangle
+   (the upper triangle is zeroed). Returns 0, or the order of the
+   first leading minor that is not positive definite. 
+*/
+static inline int _fff_chol_small(double* a, double* logdet, const int d)
+{
+  int i, j, l; 
+  double s, t; 
+
+  *logdet = 0; 
+  for (j=0 ; j<d ; j++) {
+    s = a[j*d+j]; 
+    for (l=0 ; l<j ; l++)
+      s -= a[j*d+l]*a[j*d+l]; 
+    if (!(s > 0))
+      return j+1; 
+    s = sqrt(s); 
+    a[j*d+j] = s; 
+    *logdet += log(s); 
+    for (i=j+1 ; i<d ; i++) {
+      t = a[i*d+j]; 
+      for (l=0 ; l<j ; l++)
+	t -= a[i*d+l]*a[j*d+l]; 
+      a[i*d+j] = t/s; 
+      a[j*d+i] = 0; 
+    }
+  }
+  *logdet *= 2; 
+
+  return 0; 
+}
+
+/* 
+   Inverse from the Cholesky factor L held in a: m = L^-1, then 
+   ia = m^t m. 
+*/ 
+static inline void _fff_chol_inv_small(double* ia, const double* a, double* m, const int d)
+{
+  int i, j, l; 
+  double s; 
+
+  for (j=0 ; j<d ; j++) {
+    m[j*d+j] = 1.0/a[j*d+j]; 
+    for (i=j+1 ; i<d ; i++) {
+      for (l=j, s=0 ; l<i ; l++)
+	s += a[i*d+l]*m[l*d+j]; 
+      m[i*d+j] = -s/a[i*d+i]; 
+    }
+  }
+  for (i=0 ; i<d ; i++)
+    for (j=0 ; j<=i ; j++) {
+      for (l=i, s=0 ; l<d ; l++)
+	s += m[l*d+i]*m[l*d+j]; 
+      ia[i*d+j] = s; 
+      ia[j*d+i] = s; 
+    }
+}
+
+static int _fff_chol_batch_row(double* a, double* logdet, int d)
+{
+  switch (d) {
+  case 1: 
+    return _fff_chol_small(a, logdet, 1); 
+  case 2: 
+    return _fff_chol_small(a, logdet, 2); 
+  case 3: 
+    return _fff_chol_small(a, logdet, 3); 
+  case 4: 
+    return _fff_chol_small(a, logdet, 4); 
+  default: 
+    return _fff_chol_small(a, logdet, d); 
+  }
+}
+
+static void _fff_chol_inv_batch_row(double* ia, const double* a, double* m, int d)
+{
+  switch (d) {
+  case 1: 
+    _fff_chol_inv_small(ia, a, m, 1); 
+    break; 
+  case 2: 
+    _fff_chol_inv_small(ia, a, m, 2); 
+    break; 
+  case 3: 
+    _fff_chol_inv_small(ia, a, m, 3); 
+    break; 
+  case 4: 
+    _fff_chol_inv_small(ia, a, m, 4); 
+    break; 
+  default: 
+    _fff_chol_inv_small(ia, a, m, d); 
+    break; 
+  }
+}
+
+/* Side of the matrices held in the rows of A */
+static int _fff_batch_side(const fff_matrix* A)
+{
+  int d = (int)(sqrt((double)A->size2) + 0.5); 
+
+  if ((size_t)(d*d) != A->size2) 
+    FFF_ERROR("Rows do not hold square matrices", EDOM); 
+  return d; 
+}
+
+/* log|det(a)| by the SVD, for matrices that are not positive definite */ 
+static double _fff_logdet_sym_svd(const double* a, int d)
+{
+  fff_matrix* F = fff_matrix_new(d, d); 
+  fff_matrix Fa = fff_matrix_view(a, d, d, d); 
+  double logdet; 
+
+  fff_matrix_memcpy(F, &Fa); 
+  logdet = log(fff_lapack_det_sym(F)); 
+  fff_matrix_delete(F); 
+
+  return logdet; 
+}
+
+extern int fff_lapack_chol_batch(fff_matrix* A, fff_vector* logdet, fff_array* info)
+{
+  int d = _fff_batch_side(A); 
+  size_t j, dd = A->size2; 
+  int fail = 0, infoj; 
+  double *a, ld, work[FFF_LAPACK_SMALL*FFF_LAPACK_SMALL]; 
+  double *buf = (d>FFF_LAPACK_SMALL) ? (double*)malloc(dd*sizeof(double)) : work; 
+
+  for (j=0 ; j<A->size1 ; j++) {
+    a = A->data + j*A->tda; 
+    memcpy(buf, a, dd*sizeof(double)); 
+    infoj = _fff_chol_batch_row(buf, &ld, d); 
+    if (infoj == 0) 
+      memcpy(a, buf, dd*sizeof(double)); 
+    else {
+      ld = _fff_logdet_sym_svd(a, d); 
+      fail ++; 
+    }
+    if (logdet != NULL) 
+      fff_vector_set(logdet, j, ld); 
+    if (info != NULL) 
+      fff_array_set1d(info, j, infoj); 
+  }
+  
+  if (buf != work)
+    free(buf); 
+  return fail; 
+}
+
+extern int fff_lapack_inv_sym_batch(fff_matrix* iA, fff_vector* logdet, const fff_matrix* A)
+{
+  int d = _fff_batch_side(A); 
+  size_t j, dd = A->size2; 
+  int fail = 0; 
+  double *a, *ia, ld, work[2*FFF_LAPACK_SMALL*FFF_LAPACK_SMALL]; 
+  double *buf = (d>FFF_LAPACK_SMALL) ? (double*)malloc(2*dd*sizeof(double)) : work; 
+  fff_matrix *F, *iF, Fa; 
+
+  for (j=0 ; j<A->size1 ; j++) {
+    a = A->data + j*A->tda; 
+    ia = iA->data + j*iA->tda; 
+    memcpy(buf, a, dd*sizeof(double)); 
+    if (_fff_chol_batch_row(buf, &ld, d) == 0) 
+      _fff_chol_inv_batch_row(ia, buf, buf+dd, d); 
+    else {
+      /* fff_lapack_inv_sym and fff_lapack_det_sym overwrite their argument */
+      F = fff_matrix_new(d, d); 
+      iF = fff_matrix_new(d, d); 
+      Fa = fff_matrix_view(a, d, d, d); 
+      if (logdet != NULL) 
+	ld = _fff_logdet_sym_svd(a, d); 
+      fff_matrix_memcpy(F, &Fa); 
+      fff_lapack_inv_sym(iF, F); 
+      memcpy(ia, iF->data, dd*sizeof(double)); 
+      fff_matrix_delete(F); 
+      fff_matrix_delete(iF); 
+      fail ++; 
+    }
+    if (logdet != NULL) 
+      fff_vector_set(logdet, j, ld); 
+  }
+
+  if (buf != work)
+    free(buf); 
+  return fail; 
+}
@@ -161,6 +161,37 @@ extern "C" {
 
 	extern int fff_lapack_inv_sym(fff_matrix* iA, fff_matrix *A);
 
+  /*
+	\brief Cholesky factorization of a batch of small symmetric matrices
+	\param A K-by-(M*M) matrix, each row holding an M-by-M matrix in row-major order
+	\param logdet vector of size K receiving the log-determinants, or NULL
+	\param info array of size K receiving the factorization status, or NULL
+
+	Each positive definite matrix is replaced by its lower triangular
+	Cholesky factor L, such that A = L L^t, and its info entry is set
+	to 0. Other matrices are left unchanged and their info entry is set
+	to the order of the first leading minor that is not positive
+	definite; their log-determinant is then that of the absolute
+	value of the determinant, as computed by fff_lapack_det_sym.
+	Intended for the many small (M<=10 or so) matrices of mixture
+	models, for which the LAPACK call overhead dominates.
+	The number of matrices that are not positive definite is returned.
+  */
+	extern int fff_lapack_chol_batch(fff_matrix* A, fff_vector* logdet, fff_array* info);
+
+  /*
+	\brief Inversion of a batch of small symmetric matrices
+	\param iA K-by-(M*M) matrix receiving the inverses
+	\param logdet vector of size K receiving the log-determinants, or NULL
+	\param A K-by-(M*M) matrix, each row holding an M-by-M matrix in row-major order
+
+	Positive definite matrices are inverted through their Cholesky
+	factor, other ones through fff_lapack_inv_sym. Unlike the latter,
+	A is not modified, and iA may be A itself.
+	The number of matrices that are not positive definite is returned.
+  */
+	extern int fff_lapack_inv_sym_batch(fff_matrix* iA, fff_vector* logdet, const fff_matrix* A);
+
 #ifdef __cplusplus
 }
 #endif
@@ -18,6 +18,7 @@ fff_matrix* fff_matrix_new(size_t size1, size_t size2)
   thisone->data = (double*)calloc(size1*size2, sizeof(double)); 
   if (thisone->data == NULL) 
     FFF_ERROR("Allocation failed", ENOMEM); 
+  FFF_PROFILE_COUNT(FFF_PROFILE_ALLOCATIONS, 1); 
 
   thisone->size1 = size1;
   thisone->size2 = size2;
@@ -52,6 +53,16 @@ fff_matrix fff_matrix_view(const double* data, size_t size1, size_t size2, size_
   return A; 
 }
 
+fff_matrix fff_matrix_arena(fff_arena* arena, size_t size1, size_t size2)
+{
+  double* data = (double*)fff_arena_alloc(arena, size1*size2*sizeof(double)); 
+
+  if (data != NULL) 
+    memset((void*)data, 0, size1*size2*sizeof(double)); 
+
+  return fff_matrix_view(data, size1, size2, size2); 
+}
+
 /* Get element */ 
 double fff_matrix_get (const fff_matrix * A, size_t i, size_t j)
 {
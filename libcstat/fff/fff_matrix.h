@@ -60,6 +60,16 @@ extern "C" {
 
   /*** Views ***/ 
   extern fff_matrix fff_matrix_view(const double* data, size_t size1, size_t size2, size_t tda); 
+  /*!
+    \brief Matrix allocated from an arena
+    \param arena scratch memory
+    \param size1 number of rows
+    \param size2 number of columns
+
+    The matrix is zero-filled, like with \c fff_matrix_new, but does
+    not own its data, which is released by resetting the arena.
+  */
+  extern fff_matrix fff_matrix_arena(fff_arena* arena, size_t size1, size_t size2); 
   extern fff_vector fff_matrix_row(const fff_matrix* A, size_t i); 
   extern fff_vector fff_matrix_col(const fff_matrix* A, size_t j);
   extern fff_vector fff_matrix_diag(const fff_matrix* A);  
@@ -2,6 +2,8 @@
 #include "fff_base.h"
 #include "fff_blas.h"
 
+#include <rk_counter.h>
+
 #include <stdlib.h>
 #include <stdlib.h>
 #include <math.h>
@@ -11,11 +13,9 @@
 #define EL_LDA_ITERMAX 100
 #define MIN_RELATIVE_VAR_FFX 1e-4
 
-/* Dummy structure for sorting */ 
-typedef struct{
-  double x; 
-  size_t i; 
-} fff_indexed_data;
+/* Number of voxels whose population distributions are fitted in
+   lockstep by the block EM algorithms */ 
+#define FFF_ONESAMPLE_PDF_FIT_BLOCK 32
 
 /* Static structure for empirical MFX stats */ 
 typedef struct{
@@ -25,10 +25,23 @@ typedef struct{
   fff_vector* tvar; /* low thresholded variances */  
   fff_vector* tmp1; 
   fff_vector* tmp2; 
-  fff_indexed_data* idx; 
+  fff_vector* w0; /* previous weights */ 
+  fff_vector* z0; /* previous centers */ 
+  double* block; /* scratch buffers of the block EM, allocated on first use */ 
+  size_t block_size; 
   unsigned int* niter; 
+  double* tol; 
 } fff_onesample_mfx;
 
+/* Static structure for normal MFX stats */ 
+typedef struct{
+  unsigned int* niter; 
+  double* tol; 
+  int cached; /* non-zero if the null fit below is valid */ 
+  double v0; /* variance under the zero mean constraint */ 
+  double nll0; /* negated log-likelihood under the zero mean constraint */ 
+} fff_onesample_gmfx;
+
 
 /* Declaration of static functions */ 
 
@@ -44,17 +57,21 @@ static double _fff_onesample_elr(void* params, const fff_vector* x, double base)
 static double _fff_onesample_grubb(void* params, const fff_vector* x, double base); 
 static void _fff_absolute_residuals(fff_vector* r, const fff_vector* x, double base);
 static double _fff_el_solve_lda(fff_vector* c, const fff_vector* w); 
+static void _fff_el_solve_lda_block(double* lda, double* c, size_t n, size_t nb, double* work); 
+static void _fff_onesample_elr_signs(fff_matrix* T, double base, 
+				     const fff_matrix* S, const fff_matrix* Y); 
 
 /** Normal MFX analysis **/
 static double _fff_onesample_LR_gmfx(void* params, const fff_vector* x, const fff_vector* var, double base); 
 static double _fff_onesample_mean_gmfx(void* params, const fff_vector* x, const fff_vector* var, double base); 
 static void _fff_onesample_gmfx_EM(double* m, double* v, 
 				   const fff_vector* x, const fff_vector* var, 
-				   unsigned int niter, int constraint);
+				   unsigned int niter, double tol, int constraint);
+static fff_onesample_gmfx* _fff_onesample_gmfx_new(unsigned int* niter, double* tol); 
 static double _fff_onesample_gmfx_nll(const fff_vector* x, const fff_vector* var, double m, double v);
 
 /** Empirical MFX analysis **/
-static fff_onesample_mfx* _fff_onesample_mfx_new(unsigned int n, unsigned int* niter, int flagIdx); 
+static fff_onesample_mfx* _fff_onesample_mfx_new(unsigned int n, unsigned int* niter, double* tol); 
 static void _fff_onesample_mfx_delete(fff_onesample_mfx* thisone); 
 static double _fff_onesample_mean_mfx(void* params, const fff_vector* x, const fff_vector* var, double base); 
 static double _fff_onesample_median_mfx(void* params, const fff_vector* x, const fff_vector* var, double base); 
@@ -69,10 +86,8 @@ static void _fff_onesample_mfx_EM_init(fff_onesample_mfx* Params,
 static double _fff_onesample_mfx_nll(fff_onesample_mfx* Params, const fff_vector* x);
 
 
-/** Low level for qsort **/ 
-static int _fff_abs_comp(const void * x, const void * y); 
-static int _fff_indexed_data_comp(const void * x, const void * y);
-static void _fff_sort_z(fff_indexed_data* idx, fff_vector* tmp1, fff_vector* tmp2, 
+/** Sorting **/ 
+static void _fff_sort_z(fff_vector* tmp1, fff_vector* tmp2, 
 			 const fff_vector* z, const fff_vector* w); 
 
 
@@ -119,7 +134,7 @@ fff_onesample_stat* fff_onesample_stat_new(unsigned int n, fff_onesample_stat_fl
      break;
 
    case FFF_ONESAMPLE_WILCOXON:
-     thisone->params = (void*) fff_vector_new(n); 
+     thisone->params = (void*) fff_vector_new(2*n); 
      thisone->compute_stat = &_fff_onesample_wilcoxon;
      break;
 
@@ -170,7 +185,10 @@ void fff_onesample_stat_delete(fff_onesample_stat* thisone)
 double fff_onesample_stat_eval(fff_onesample_stat* thisone, const fff_vector* x)
 {
   double t; 
+  FFF_PROFILE_BEGIN(FFF_PROFILE_ONESAMPLE); 
   t = thisone->compute_stat(thisone->params, x, thisone->base); 
+  FFF_PROFILE_END(FFF_PROFILE_ONESAMPLE); 
+  FFF_PROFILE_COUNT(FFF_PROFILE_VOXELS, 1); 
   return t; 
 }
 
@@ -339,44 +357,30 @@ static double _fff_onesample_sign_stat(void* params, const fff_vector* x, double
 
 /********************* WILCOXON (SIGNED RANK) STATISTIC *********************/ 
 
-static int _fff_abs_comp(const void * x, const void * y)
-{
-  int ans = 1;
-  double xx = *((double*)x);
-  double yy = *((double*)y);
-
-  xx = FFF_ABS(xx);
-  yy = FFF_ABS(yy); 
-
-  if (yy > xx) {
-    ans = -1;
-    return ans;
-  }
-  if (yy == xx)
-    ans = 0;
-
-  return ans;
-}
-
 static double _fff_onesample_wilcoxon(void* params, const fff_vector* x, double base)
 {
   size_t i, n = x->size; 
   double t = 0.0;
-  double* buf; 
+  double *bufx, *bufr, *bufa; 
   fff_vector* tmp = (fff_vector*)params;
+  fff_vector r, a; 
  
-  /* Compute the residuals wrt baseline */ 
-  fff_vector_memcpy(tmp, x); 
-  fff_vector_add_constant(tmp, -base);
+  /* Compute the residuals wrt baseline and their absolute values
+     NOTE: tmp is contiguous and of size 2n, if allocated using fff_onesample_stat_new */ 
+  r = fff_vector_view(tmp->data, n, 1); 
+  a = fff_vector_view(tmp->data+n, n, 1); 
+  for(i=0, bufx=x->data, bufr=r.data, bufa=a.data; i<n; i++, bufx+=x->stride, bufr++, bufa++) {
+    *bufr = *bufx - base; 
+    *bufa = FFF_ABS(*bufr); 
+  }
 
-  /* Sort the residuals in terms of their ABSOLUTE values 
-     NOTE: tmp needs be contiguous -- and it is, if allocated using fff_onesample_stat_new */ 
-  qsort (tmp->data, n, sizeof(double), &_fff_abs_comp);
+  /* Sort the residuals in terms of their ABSOLUTE values */ 
+  fff_vector_sort_with(&a, &r); 
 
   /* Compute the sum of ranks multiplied by corresponding elements' signs */ 
-  buf = tmp->data; 
-  for(i=1; i<=n; i++, buf++) /* Again buf++ works IFF tmp is contiguous */ 
-    t += (double)i * FFF_SIGN(*buf); 
+  bufr = r.data; 
+  for(i=1; i<=n; i++, bufr++) 
+    t += (double)i * FFF_SIGN(*bufr); 
 
   /* Normalization to have the stat range in [-1,1] */ 
   /*  t /= (double)((n*(n+1))/2);*/
@@ -533,6 +537,168 @@ static double _fff_el_solve_lda(fff_vector* c, const fff_vector* w)
   return lda; 
 }
 
+/*
+  Same as _fff_el_solve_lda with uniform weights, for nb problems
+  solved in lockstep. The constraints are stored lane-wise: c[j*nb+i]
+  is the j-th constraint of the i-th problem, so that the inner loops
+  run over contiguous lanes. Lanes whose braket is narrow enough keep
+  their current solution while the others are iterated, which yields
+  the same solutions as _fff_el_solve_lda. The constraints are
+  overwritten; work has size 4*nb.
+*/ 
+static void _fff_el_solve_lda_block(double* lda, double* c, size_t n, size_t nb, double* work)
+{
+  size_t i, j, nactive; 
+  unsigned int iter; 
+  double aux, *lda0 = work, *lda1 = work+nb, *g = work+2*nb, *dg = work+3*nb, *bufc; 
+
+  /* Transform the constraints and find the brakets, see _fff_el_solve_lda */ 
+  for (i=0; i<nb; i++) {
+    lda0[i] = FFF_NEGINF; 
+    lda1[i] = FFF_POSINF; 
+  }
+  for (j=0, bufc=c; j<n; j++, bufc+=nb) 
+    for (i=0; i<nb; i++) {
+      aux = -1.0/bufc[i]; 
+      bufc[i] = aux; 
+      if ((aux<0.0) && (aux>lda0[i]))
+	lda0[i] = aux; 
+      else if ((aux>0.0) && (aux<lda1[i]))
+	lda1[i] = aux; 
+    }
+
+  /* Lanes without a finite braket are marked with infinite brakets,
+     so that they are never active, and iterated at zero */ 
+  for (i=0; i<nb; i++) {
+    if (!(lda0[i]>FFF_NEGINF) || !(lda1[i]<FFF_POSINF)) {
+      lda0[i] = FFF_POSINF; 
+      lda1[i] = FFF_POSINF; 
+      lda[i] = 0.0; 
+    }
+    else 
+      lda[i] = .5*(lda0[i]+lda1[i]); 
+  }
+
+  for (iter=0; iter<EL_LDA_ITERMAX; iter++) {
+
+    /* Active lanes */ 
+    for (i=0, nactive=0; i<nb; i++) 
+      if (lda1[i]-lda0[i] > EL_LDA_TOL) 
+	nactive ++; 
+    if (nactive == 0)
+      break; 
+
+    /* g and dg for all lanes */ 
+    for (i=0; i<nb; i++) {
+      g[i] = 0.0; 
+      dg[i] = 0.0; 
+    }
+    for (j=0, bufc=c; j<n; j++, bufc+=nb) 
+      for (i=0; i<nb; i++) {
+	aux = 1/(lda[i]-bufc[i]); 
+	g[i] += aux; 
+	dg[i] += aux*aux; 
+      }
+
+    /* Braket and Newton updates of the active lanes only */ 
+    for (i=0; i<nb; i++) {
+      if (!(lda1[i]-lda0[i] > EL_LDA_TOL))
+	continue; 
+      if (g[i] > 0.0) 
+	lda0[i] = lda[i]; 
+      else if (g[i] < 0.0) 
+	lda1[i] = lda[i]; 
+      aux = lda[i] + (g[i]/dg[i]); 
+      if ((lda0[i] < lda[i]) && (lda[i] < lda1[i])) 
+	lda[i] = aux; 
+      else 
+	lda[i] = .5*(lda0[i]+lda1[i]); 
+    }
+
+  }
+
+  for (i=0; i<nb; i++) 
+    if (lda0[i] >= FFF_POSINF)
+      lda[i] = FFF_POSINF; 
+
+  return; 
+}
+
+/* 
+   ELR statistics of the signals (rows of Y) for the sign
+   permutations (rows of S), see _fff_onesample_elr. The signals of a
+   permutation are stored lane-wise and solved by
+   _fff_el_solve_lda_block.
+*/ 
+static void _fff_onesample_elr_signs(fff_matrix* T, double base, 
+				     const fff_matrix* S, const fff_matrix* Y)
+{
+  size_t n = Y->size2, nb = Y->size1, i, j, k; 
+  double *x, *c, *lda, *m, *work, *bufs, *buft, *bufx; 
+  double nwi, aux; 
+  long double* sum; 
+  int sign; 
+
+  x = (double*)malloc((2*n+6)*nb*sizeof(double)); 
+  c = x + n*nb; 
+  lda = c + n*nb; 
+  m = lda + nb; 
+  work = m + nb; 
+  sum = (long double*)malloc(nb*sizeof(long double)); 
+
+  for (k=0; k<S->size1; k++) {
+    bufs = S->data + k*S->tda; 
+    buft = T->data + k*T->tda; 
+    
+    /* x = signed signals - base, and their means */ 
+    for (i=0; i<nb; i++) 
+      sum[i] = 0.0; 
+    for (j=0, bufx=x; j<n; j++, bufx+=nb) 
+      for (i=0; i<nb; i++) {
+	bufx[i] = bufs[j]*Y->data[i*Y->tda+j] - base; 
+	sum[i] += bufx[i]; 
+      }
+    for (i=0; i<nb; i++) 
+      m[i] = sum[i]/(long double)n; 
+
+    /* Lagrange multipliers */ 
+    for (i=0; i<n*nb; i++) 
+      c[i] = x[i]; 
+    _fff_el_solve_lda_block(lda, c, n, nb, work); 
+
+    /* Log empirical likelihood ratios */ 
+    for (i=0; i<nb; i++) 
+      work[i] = 0.0; 
+    for (j=0, bufx=x; j<n; j++, bufx+=nb) 
+      for (i=0; i<nb; i++) {
+	nwi = 1/(1 + lda[i]*bufx[i]); 
+	nwi = FFF_MAX(nwi, 0.0); 
+	work[i] += log(nwi); 
+      }
+
+    /* Signed statistics, see _fff_onesample_elr */ 
+    for (i=0; i<nb; i++) {
+      sign = FFF_SIGN(m[i]); 
+      if (sign == 0) {
+	buft[i] = 0.0; 
+	continue; 
+      }
+      aux = -2.0 * work[i]; 
+      aux = sqrt(FFF_MAX(aux, 0.0)); 
+      if ((lda[i] < FFF_POSINF) && (aux < FFF_POSINF))
+	buft[i] = sign*aux; 
+      else if (sign > 0)
+	buft[i] = FFF_POSINF; 
+      else 
+	buft[i] = FFF_NEGINF; 
+    }
+  }
+
+  free(x); 
+  free(sum); 
+  return; 
+}
+
 
 /******************************* GRUBB STATISTIC *******************************/ 
 
@@ -583,6 +749,7 @@ fff_onesample_stat_mfx* fff_onesample_stat_mfx_new(unsigned int n, fff_onesample
   thisone->base = base; 
   thisone->empirical = 1; 
   thisone->niter = 0; 
+  thisone->tol = 0.0; 
   thisone->constraint = 0; 
   thisone->params = NULL; 
   
@@ -592,38 +759,38 @@ fff_onesample_stat_mfx* fff_onesample_stat_mfx_new(unsigned int n, fff_onesample
    case FFF_ONESAMPLE_STUDENT_MFX:
      thisone->empirical = 0; 
      thisone->compute_stat = &_fff_onesample_LR_gmfx;
-     thisone->params = (void*)(&(thisone->niter)); 
+     thisone->params = (void*)_fff_onesample_gmfx_new(&(thisone->niter), &(thisone->tol)); 
      break;
 
    case FFF_ONESAMPLE_GAUSSIAN_MEAN_MFX:
      thisone->empirical = 0; 
      thisone->compute_stat = &_fff_onesample_mean_gmfx;
-     thisone->params = (void*)(&(thisone->niter)); 
+     thisone->params = (void*)_fff_onesample_gmfx_new(&(thisone->niter), &(thisone->tol)); 
      break;
 
    case FFF_ONESAMPLE_EMPIRICAL_MEAN_MFX:
      thisone->compute_stat = &_fff_onesample_mean_mfx;
-     thisone->params = (void*)_fff_onesample_mfx_new(n, &(thisone->niter), 0);
+     thisone->params = (void*)_fff_onesample_mfx_new(n, &(thisone->niter), &(thisone->tol));
      break;
 
    case FFF_ONESAMPLE_EMPIRICAL_MEDIAN_MFX:
      thisone->compute_stat = &_fff_onesample_median_mfx;
-     thisone->params = (void*)_fff_onesample_mfx_new(n, &(thisone->niter), 1);
+     thisone->params = (void*)_fff_onesample_mfx_new(n, &(thisone->niter), &(thisone->tol));
      break;
 
    case FFF_ONESAMPLE_SIGN_STAT_MFX:
      thisone->compute_stat = &_fff_onesample_sign_stat_mfx;
-     thisone->params = (void*)_fff_onesample_mfx_new(n, &(thisone->niter), 0);
+     thisone->params = (void*)_fff_onesample_mfx_new(n, &(thisone->niter), &(thisone->tol));
      break;
 
    case FFF_ONESAMPLE_WILCOXON_MFX:
      thisone->compute_stat = &_fff_onesample_wilcoxon_mfx;
-     thisone->params = (void*)_fff_onesample_mfx_new(n, &(thisone->niter), 1);
+     thisone->params = (void*)_fff_onesample_mfx_new(n, &(thisone->niter), &(thisone->tol));
      break;
 
    case FFF_ONESAMPLE_ELR_MFX:
      thisone->compute_stat = &_fff_onesample_LR_mfx;
-     thisone->params = (void*)_fff_onesample_mfx_new(n, &(thisone->niter), 0);
+     thisone->params = (void*)_fff_onesample_mfx_new(n, &(thisone->niter), &(thisone->tol));
      break;
      
    default:
@@ -642,13 +809,29 @@ void fff_onesample_stat_mfx_delete(fff_onesample_stat_mfx* thisone)
   
   if (thisone->empirical) 
     _fff_onesample_mfx_delete((fff_onesample_mfx*)thisone->params); 
+  else 
+    free(thisone->params); 
   
   free(thisone); 
   return; 
 }
 
 
-static fff_onesample_mfx* _fff_onesample_mfx_new(unsigned int n, unsigned int* niter, int flagIdx) 
+static fff_onesample_gmfx* _fff_onesample_gmfx_new(unsigned int* niter, double* tol)
+{
+  fff_onesample_gmfx* thisone;
+
+  thisone = (fff_onesample_gmfx*)malloc(sizeof(fff_onesample_gmfx));
+  thisone->niter = niter; 
+  thisone->tol = tol; 
+  thisone->cached = 0; 
+  thisone->v0 = 0.0; 
+  thisone->nll0 = 0.0; 
+
+  return thisone;  
+}
+
+static fff_onesample_mfx* _fff_onesample_mfx_new(unsigned int n, unsigned int* niter, double* tol)
 {
   fff_onesample_mfx* thisone;
 
@@ -659,11 +842,12 @@ static fff_onesample_mfx* _fff_onesample_mfx_new(unsigned int n, unsigned int* n
   thisone->tvar = fff_vector_new(n);
   thisone->tmp1 = fff_vector_new(n); 
   thisone->tmp2 = fff_vector_new(n);
-  thisone->idx = NULL;
+  thisone->w0 = fff_vector_new(n); 
+  thisone->z0 = fff_vector_new(n); 
+  thisone->block = NULL; 
+  thisone->block_size = 0; 
   thisone->niter = niter; 
-  
-  if (flagIdx == 1) 
-    thisone->idx = (fff_indexed_data*)calloc(n, sizeof(fff_indexed_data));
+  thisone->tol = tol; 
 
   return thisone;  
 }
@@ -677,8 +861,9 @@ static void _fff_onesample_mfx_delete(fff_onesample_mfx* thisone)
   fff_vector_delete(thisone->tvar);
   fff_vector_delete(thisone->tmp1); 
   fff_vector_delete(thisone->tmp2);
-  if (thisone->idx != NULL) 
-    free(thisone->idx); 
+  fff_vector_delete(thisone->w0); 
+  fff_vector_delete(thisone->z0); 
+  free(thisone->block); 
 
   free(thisone); 
 
@@ -695,16 +880,38 @@ double fff_onesample_stat_mfx_eval(fff_onesample_stat_mfx* thisone, const fff_ve
 }
 
 
+int fff_onesample_stat_mfx_cache(fff_onesample_stat_mfx* thisone, const fff_vector* x, const fff_vector* vx)
+{
+  fff_onesample_gmfx* Params; 
+  double m0 = 0.0; 
+
+  if (thisone->flag != FFF_ONESAMPLE_STUDENT_MFX) 
+    return 0; 
+
+  Params = (fff_onesample_gmfx*)thisone->params; 
+  Params->cached = 0; 
+  if (x == NULL) 
+    return 0; 
+
+  /* Zero mean fit, which only depends on the squared data */ 
+  _fff_onesample_gmfx_EM(&m0, &(Params->v0), x, vx, thisone->niter, thisone->tol, 1); 
+  Params->nll0 = _fff_onesample_gmfx_nll(x, vx, m0, Params->v0);
+  Params->cached = 1; 
+
+  return 1; 
+}
+
+
 
 /*****************************************************************************************/
 /*                   Standard MFX (normal population model)                              */
 /*****************************************************************************************/
 static double _fff_onesample_mean_gmfx(void* params, const fff_vector* x, const fff_vector* var, double base)
 {
-  unsigned int niter = *((unsigned int*)params); 
+  fff_onesample_gmfx* Params = (fff_onesample_gmfx*)params; 
   double mu = 0.0, v = 0.0; 
 
-  _fff_onesample_gmfx_EM(&mu, &v, x, var, niter, 0); 
+  _fff_onesample_gmfx_EM(&mu, &v, x, var, *(Params->niter), *(Params->tol), 0); 
 
   return (mu-base); 
 }
@@ -714,10 +921,12 @@ static double _fff_onesample_LR_gmfx(void* params, const fff_vector* x, const ff
 {
   int sign; 
   double t, mu = 0.0, v = 0.0, v0 = 0.0, nll, nll0;
-  unsigned int niter = *((unsigned int*)params); 
+  fff_onesample_gmfx* Params = (fff_onesample_gmfx*)params; 
+  unsigned int niter = *(Params->niter); 
+  double tol = *(Params->tol); 
   
   /* Estimate maximum likelihood group mean and group variance */ 
-  _fff_onesample_gmfx_EM(&mu, &v, x, var, niter, 0); 
+  _fff_onesample_gmfx_EM(&mu, &v, x, var, niter, tol, 0); 
   
   /* MFX mean estimate equals baseline, return zero */ 
   t = mu - base; 
@@ -725,12 +934,15 @@ static double _fff_onesample_LR_gmfx(void* params, const fff_vector* x, const ff
   if (sign == 0) 
     return 0.0; 
 
-  /* Estimate maximum likelihood group variance under zero group mean assumption */ 
-  _fff_onesample_gmfx_EM(&base, &v0, x, var, niter, 1); 
-
-  /* Negated log-likelihoods */ 
+  /* Estimate maximum likelihood group variance under zero group
+     mean assumption, unless cached */ 
   nll = _fff_onesample_gmfx_nll(x, var, mu, v);
-  nll0 = _fff_onesample_gmfx_nll(x, var, base, v0);
+  if (Params->cached) 
+    nll0 = Params->nll0; 
+  else {
+    _fff_onesample_gmfx_EM(&base, &v0, x, var, niter, tol, 1); 
+    nll0 = _fff_onesample_gmfx_nll(x, var, base, v0);
+  }
   
   /* If both nll and nll0 are globally minimized, we always have: 
      nll0 >= nll; however, EM convergence issues may cause nll>nll0,
@@ -752,7 +964,7 @@ static double _fff_onesample_LR_gmfx(void* params, const fff_vector* x, const ff
 /* EM algorithm to estimate the mean and variance parameters. */ 
 static void _fff_onesample_gmfx_EM(double* m, double* v, 
 				    const fff_vector* x, const fff_vector* var, 
-				    unsigned int niter, int constraint)
+				    unsigned int niter, double tol, int constraint)
 {
   size_t n = x->size, i; 
   unsigned int iter = 0; 
@@ -807,6 +1019,12 @@ static void _fff_onesample_gmfx_EM(double* m, double* v,
     
     /* Iteration number */ 
     iter ++; 
+
+    /* Stop if both estimates have converged */ 
+    if ((tol > 0) && 
+	(FFF_ABS(v1-v0) <= tol*FFF_ABS(v1)) && 
+	(FFF_SQR(m1-m0) <= FFF_SQR(tol)*FFF_ABS(v1))) 
+      break; 
     
   }
   
@@ -872,7 +1090,7 @@ static double _fff_onesample_median_mfx(void* params, const fff_vector* x, const
   
   /* Compute the median of the estimated distribution */ 
   /** m = fff_weighted_median(Params->idx, Params->w, Params->z) - base;  **/
-  _fff_sort_z(Params->idx, Params->tmp1, Params->tmp2, Params->z, Params->w); 
+  _fff_sort_z(Params->tmp1, Params->tmp2, Params->z, Params->w); 
   m = fff_vector_wmedian_from_sorted_data (Params->tmp1, Params->tmp2); 
 
   return m;
@@ -931,7 +1149,7 @@ static double _fff_onesample_wilcoxon_mfx(void* params, const fff_vector* x, con
 
   /* Sort the absolute residuals and get the permutation of indices */ 
   /**  gsl_sort_vector_index(Params->idx, Params->tmp1); **/
-  _fff_sort_z(Params->idx, Params->tmp1, Params->tmp2, Params->z, Params->w); 
+  _fff_sort_z(Params->tmp1, Params->tmp2, Params->z, Params->w); 
   
   /* Compute the sum of ranks */ 
   /** Ri = 0.0; 
@@ -1012,14 +1230,17 @@ static void _fff_onesample_mfx_EM(fff_onesample_mfx* Params,
   fff_vector *tvar = Params->tvar, *tmp1 = Params->tmp1, *tmp2 = Params->tmp2; 
   fff_matrix *Q = Params->Q; 
   unsigned int niter = *(Params->niter); 
+  double tol = *(Params->tol); 
   size_t n = x->size, i, k; 
   unsigned int iter = 0; 
-  double m, lda, aux;
+  double m, lda, aux, dz, dw;
   double *buf, *buf2; 
   fff_vector Qk; 
   
   /* Pre-process: low threshold the variances to avoid numerical instabilities */ 
   aux = fff_vector_ssd(x, &m, 0)/(long double)(FFF_MAX(n,2)-1); 
+  dz = tol*sqrt(aux); /* convergence thresholds on centers and weights */ 
+  dw = tol/(double)n; 
   aux *= MIN_RELATIVE_VAR_FFX;
   fff_vector_memcpy(tvar, var); 
   buf = tvar->data; 
@@ -1034,6 +1255,12 @@ static void _fff_onesample_mfx_EM(fff_onesample_mfx* Params,
 
   /* Refine result using an EM loop */ 
   while (iter < niter) {
+
+    /* Previous estimates */ 
+    if (tol > 0) {
+      fff_vector_memcpy(Params->w0, w); 
+      fff_vector_memcpy(Params->z0, z); 
+    }
     
     /* Compute the posterior probability matrix 
        Qik : probability that subject i belongs to class k */ 
@@ -1096,6 +1323,18 @@ static void _fff_onesample_mfx_EM(fff_onesample_mfx* Params,
 
     /* Iteration number */ 
     iter ++; 
+
+    /* Stop if all weights and centers have converged */ 
+    if (tol > 0) {
+      for (k=0; k<n; k++) {
+	if (FFF_ABS(w->data[k*w->stride] - Params->w0->data[k]) > dw) 
+	  break; 
+	if (FFF_ABS(z->data[k*z->stride] - Params->z0->data[k]) > dz) 
+	  break; 
+      }
+      if (k == n) 
+	break; 
+    }
     
   }
   
@@ -1223,55 +1462,378 @@ extern void fff_onesample_stat_gmfx_pdf_fit(double *mu, double *v,
   unsigned int constraint = thisone->constraint; 
 
   /* Estimate the population gaussian parameters using EM */ 
-  _fff_onesample_gmfx_EM(mu, v, x, var, niter, constraint); 
+  _fff_onesample_gmfx_EM(mu, v, x, var, niter, thisone->tol, constraint); 
 
 }
 
 
-/** Comparison function for qsort **/ 
-static int _fff_indexed_data_comp(const void * x, const void * y)
+/* 
+   Block EM algorithms: the population distributions of nb voxels
+   (lanes) are estimated in lockstep, the data of subject i and lane
+   l being x[i*tda+l]. Each lane goes through exactly the same steps
+   as the single voxel EM algorithms above, and stops updating its
+   estimates once they have converged. 
+*/ 
+
+static void _fff_onesample_gmfx_EM_block(double* m, double* v, 
+					  const double* x, size_t tdx, 
+					  const double* var, size_t tdv, 
+					  size_t n, size_t nb, 
+					  unsigned int niter, double tol, int constraint)
 {
-  int ans = 1; 
-  fff_indexed_data xx = *((fff_indexed_data*)x);
-  fff_indexed_data yy = *((fff_indexed_data*)y);
+  double m0[FFF_ONESAMPLE_PDF_FIT_BLOCK], v0[FFF_ONESAMPLE_PDF_FIT_BLOCK]; 
+  double m1[FFF_ONESAMPLE_PDF_FIT_BLOCK], v1[FFF_ONESAMPLE_PDF_FIT_BLOCK]; 
+  long double sum[FFF_ONESAMPLE_PDF_FIT_BLOCK], ssd[FFF_ONESAMPLE_PDF_FIT_BLOCK]; 
+  int active[FFF_ONESAMPLE_PDF_FIT_BLOCK]; 
+  size_t i, l, nactive = nb; 
+  unsigned int iter = 0; 
+  long double ln = (long double)n; 
+  double nn = (double)n, mi_ap, vi_ap, a; 
+  const double *bufx, *bufvar; 
+
+  /* Initialization: pure RFX solution, as by fff_vector_ssd */ 
+  for (l=0; l<nb; l++) 
+    sum[l] = ssd[l] = 0.0; 
+  for (i=0, bufx=x; i<n; i++, bufx+=tdx) 
+    for (l=0; l<nb; l++) {
+      a = bufx[l]; 
+      sum[l] += a; 
+      ssd[l] += FFF_SQR(a); 
+    }
+  for (l=0; l<nb; l++) {
+    sum[l] /= ln; 
+    if (constraint) {
+      a = 0.0 - sum[l]; 
+      ssd[l] += ln * (FFF_SQR(a) - FFF_SQR(sum[l])); 
+      m1[l] = 0.0; 
+    }
+    else {
+      m1[l] = sum[l]; 
+      ssd[l] -= ln * FFF_SQR(sum[l]); 
+    }
+    v1[l] = ssd[l]/ln; 
+    active[l] = 1; 
+  }
+
+  /* Refine result using an EM loop */ 
+  while ((iter < niter) && (nactive > 0)) {
+
+    /* Previous estimates of the lanes that have not converged */ 
+    for (l=0; l<nb; l++) 
+      if (active[l]) {
+	m0[l] = m1[l]; 
+	v0[l] = v1[l]; 
+      }
+    for (l=0; l<nb; l++) {
+      m1[l] = constraint ? m1[l] : 0.0; 
+      v1[l] = 0.0; 
+    }
+
+    /* Aggregated E- and M-steps, for all lanes */ 
+    for (i=0, bufx=x, bufvar=var; i<n; i++, bufx+=tdx, bufvar+=tdv) 
+      for (l=0; l<nb; l++) {
+	a = 1.0 / (bufvar[l] + v0[l]); 
+	mi_ap = v0[l] * bufx[l] + bufvar[l] * m0[l]; 
+	mi_ap *= a; 
+	vi_ap = a * bufvar[l] * v0[l]; 
+	if ( ! constraint )
+	  m1[l] += mi_ap; 
+	v1[l] += vi_ap + FFF_SQR(mi_ap);
+      }
+
+    /* Normalization; converged lanes keep their estimates */ 
+    iter ++; 
+    for (l=0; l<nb; l++) {
+      if (!active[l]) {
+	m1[l] = m0[l]; 
+	v1[l] = v0[l]; 
+	continue; 
+      }
+      if ( ! constraint ) 
+	m1[l] /= nn; 
+      v1[l] /= nn; 
+      v1[l] -= FFF_SQR(m1[l]); 
+      if ((tol > 0) && 
+	  (FFF_ABS(v1[l]-v0[l]) <= tol*FFF_ABS(v1[l])) && 
+	  (FFF_SQR(m1[l]-m0[l]) <= FFF_SQR(tol)*FFF_ABS(v1[l]))) {
+	active[l] = 0; 
+	m0[l] = m1[l]; 
+	v0[l] = v1[l]; 
+	nactive --; 
+      }
+    }
+
+  }
 
-  if (yy.x > xx.x) { 
-    ans = -1; 
-    return ans; 
+  for (l=0; l<nb; l++) {
+    m[l] = m1[l]; 
+    v[l] = v1[l]; 
   }
-  if (yy.x == xx.x) 
-    ans = 0; 
 
-  return ans;  
+  return; 
 }
 
-/** Sort z array and re-order w accordingly **/ 
-static void _fff_sort_z(fff_indexed_data* idx, fff_vector* tmp1, fff_vector* tmp2, 
-			 const fff_vector* z, const fff_vector* w)
+
+static void _fff_onesample_mfx_EM_block(fff_onesample_mfx* Params, 
+					 double* W, size_t tdw, double* Z, size_t tdz, 
+					 const double* x, size_t tdx, 
+					 const double* var, size_t tdv, 
+					 size_t nb, int constraint)
 {
-  size_t n = z->size, i, is; 
-  double *buf1, *buf2; 
-  fff_indexed_data* buf_idx; 
-
-  /* Copy z into the auxiliary qsort structure idx */ 
-  for(i=0, buf1=z->data, buf_idx=idx; 
-       i<n; 
-       i++, buf_idx++, buf1+=z->stride) {
-    (*buf_idx).x = *buf1; 
-    (*buf_idx).i = i; 
+  size_t n = Params->w->size, i, k, l, nactive = nb; 
+  size_t nl = n*nb; 
+  double *Q = Params->block, *tvar = Q + n*nl, *w = tvar + nl, *z = w + nl; 
+  double *w0 = z + nl, *z0 = w0 + nl, *R = z0 + nl, *Rik = R + nl; 
+  double dz[FFF_ONESAMPLE_PDF_FIT_BLOCK], sum[FFF_ONESAMPLE_PDF_FIT_BLOCK]; 
+  long double acc[FFF_ONESAMPLE_PDF_FIT_BLOCK], acc2[FFF_ONESAMPLE_PDF_FIT_BLOCK]; 
+  double si[FFF_ONESAMPLE_PDF_FIT_BLOCK]; 
+  int active[FFF_ONESAMPLE_PDF_FIT_BLOCK]; 
+  unsigned int niter = *(Params->niter); 
+  double tol = *(Params->tol); 
+  unsigned int iter = 0; 
+  long double ln = (long double)n; 
+  double dw = tol/(double)n, aux, lda, q, *Qik; 
+  const double* xi; 
+  fff_vector *tmp1 = Params->tmp1, *wl = Params->w, *zl = Params->z; 
+  fff_vector a, b; 
+
+  /* Pre-process: low threshold the variances to avoid numerical
+     instabilities, as in _fff_onesample_mfx_EM */ 
+  for (l=0; l<nb; l++) 
+    acc[l] = acc2[l] = 0.0; 
+  for (i=0; i<n; i++) 
+    for (l=0; l<nb; l++) {
+      aux = x[i*tdx+l]; 
+      acc[l] += aux; 
+      acc2[l] += FFF_SQR(aux); 
+    }
+  for (l=0; l<nb; l++) {
+    acc[l] /= ln; 
+    acc2[l] -= ln * FFF_SQR(acc[l]); 
+    aux = acc2[l]/(long double)(FFF_MAX(n,2)-1); 
+    dz[l] = tol*sqrt(aux); 
+    sum[l] = aux*MIN_RELATIVE_VAR_FFX; 
+    active[l] = 1; 
   }
-  /* Effectively sort */
-  qsort (idx, n, sizeof(fff_indexed_data), &_fff_indexed_data_comp);
-  
-  /* Copy the sorted z into tmp1, and the accordingly sorted w into tmp2 */ 
-  for(i=0, buf1=tmp1->data, buf2=tmp2->data, buf_idx=idx; 
-       i<n; 
-       i++, buf_idx++, buf1+=tmp1->stride, buf2+=tmp2->stride) {
-    is = (*buf_idx).i; 
-    *buf1 = (*buf_idx).x; 
-    *buf2 = w->data[ is*w->stride ]; 
+  for (i=0; i<n; i++) 
+    for (l=0; l<nb; l++) {
+      aux = var[i*tdv+l]; 
+      tvar[i*nb+l] = (aux < sum[l]) ? sum[l] : aux; 
+      w[i*nb+l] = 1/(double)n; 
+      z[i*nb+l] = x[i*tdx+l]; 
+    }
+
+  /* Refine result using an EM loop */ 
+  while ((iter < niter) && (nactive > 0)) {
+
+    if (tol > 0) 
+      for (k=0; k<nl; k++) {
+	w0[k] = w[k]; 
+	z0[k] = z[k]; 
+      }
+
+    /* Posterior probability matrices, for all lanes */ 
+    for (i=0; i<n; i++) {
+      Qik = Q + i*nl; 
+      xi = x + i*tdx; 
+      for (l=0; l<nb; l++) {
+	si[l] = sqrt(tvar[i*nb+l]); 
+	sum[l] = 0.0; 
+      }
+      for (k=0; k<n; k++, Qik+=nb) 
+	for (l=0; l<nb; l++) {
+	  q = (xi[l]-z[k*nb+l])/si[l]; 
+	  q = exp(-.5 * FFF_SQR(q)); 
+	  Qik[l] = FFF_ENSURE_POSITIVE(q) * w[k*nb+l]; 
+	  sum[l] += Qik[l]; 
+	}
+      Qik = Q + i*nl; 
+      for (k=0; k<n; k++, Qik+=nb) 
+	for (l=0; l<nb; l++) 
+	  Qik[l] /= FFF_ENSURE_POSITIVE(sum[l]); 
+    }
+
+    /* Update weights: wk = sum_i Qik / n */ 
+    for (k=0; k<n; k++) {
+      for (l=0; l<nb; l++) 
+	acc[l] = 0.0; 
+      for (i=0; i<n; i++) 
+	for (l=0; l<nb; l++) 
+	  acc[l] += Q[i*nl+k*nb+l]; 
+      for (l=0; l<nb; l++) 
+	if (active[l]) 
+	  w[k*nb+l] = acc[l]/ln; 
+    }
+
+    /* Reweight if restricted maximum likelihood, lane by lane */ 
+    if ( constraint ) 
+      for (l=0; l<nb; l++) {
+	if (!active[l]) 
+	  continue; 
+	for (k=0; k<n; k++) {
+	  tmp1->data[k*tmp1->stride] = z[k*nb+l]; 
+	  wl->data[k*wl->stride] = w[k*nb+l]; 
+	}
+	lda = _fff_el_solve_lda(tmp1, wl); 
+	if (lda < FFF_POSINF) 
+	  for (k=0; k<n; k++) 
+	    w[k*nb+l] *= 1/(1 + lda*z[k*nb+l]); 
+      }
+
+    /* Update centers: zk = sum_i Rik xi / Rk with Rik = Qik/si^2;
+       the scalar products go through the same BLAS routine as in
+       _fff_onesample_mfx_EM, the constrained fit being sensitive to
+       rounding errors */ 
+    for (k=0; k<n; k++) {
+      for (l=0; l<nb; l++) 
+	acc[l] = 0.0; 
+      for (i=0; i<n; i++) 
+	for (l=0; l<nb; l++) {
+	  q = Q[i*nl+k*nb+l] / tvar[i*nb+l]; 
+	  Rik[i*nb+l] = q; 
+	  acc[l] += q; 
+	}
+      for (l=0; l<nb; l++) {
+	if (!active[l]) 
+	  continue; 
+	aux = (double)acc[l]; 
+	aux = FFF_ENSURE_POSITIVE(aux); 
+	a = fff_vector_view(Rik+l, n, nb); 
+	b = fff_vector_view(x+l, n, tdx); 
+	z[k*nb+l] = fff_blas_ddot(&a, &b)/aux; 
+	R[k*nb+l] = aux; 
+      }
+    }
+
+    /* Shift to zero if restricted maximum likelihood */ 
+    if ( constraint ) 
+      for (l=0; l<nb; l++) {
+	if (!active[l]) 
+	  continue; 
+	for (k=0; k<n; k++) {
+	  wl->data[k*wl->stride] = w[k*nb+l]; 
+	  zl->data[k*zl->stride] = z[k*nb+l]; 
+	  tmp1->data[k*tmp1->stride] = w[k*nb+l]/R[k*nb+l]; /* wk/Rk */ 
+	}
+	aux = fff_blas_ddot(wl, tmp1); /* sum_k [ wk^2 / Rk ] */ 
+	lda = fff_blas_ddot(wl, zl); /* sum_k wk zk */ 
+	aux = FFF_ENSURE_POSITIVE(aux); 
+	lda /= aux; 
+	fff_blas_daxpy(-lda, tmp1, zl); /* zk = zk - lda * wk/Rk */ 
+	for (k=0; k<n; k++) 
+	  z[k*nb+l] = zl->data[k*zl->stride]; 
+      }
+
+    /* Lanes whose weights and centers have all converged stop */ 
+    iter ++; 
+    if (tol > 0) 
+      for (l=0; l<nb; l++) {
+	if (!active[l]) 
+	  continue; 
+	for (k=0; k<n; k++) {
+	  if (FFF_ABS(w[k*nb+l] - w0[k*nb+l]) > dw) 
+	    break; 
+	  if (FFF_ABS(z[k*nb+l] - z0[k*nb+l]) > dz[l]) 
+	    break; 
+	}
+	if (k == n) {
+	  active[l] = 0; 
+	  nactive --; 
+	}
+      }
+
+  }
+
+  /* Copy result in output arrays */ 
+  for (k=0; k<n; k++) 
+    for (l=0; l<nb; l++) {
+      W[k*tdw+l] = w[k*nb+l]; 
+      Z[k*tdz+l] = z[k*nb+l]; 
+    }
+
+  return; 
+}
+
+
+int fff_onesample_stat_mfx_pdf_fit_block(fff_matrix* W, fff_matrix* Z, 
+					 fff_onesample_stat_mfx* thisone, 
+					 const fff_matrix* X, const fff_matrix* VX)
+{
+  fff_onesample_mfx* Params = (fff_onesample_mfx*)thisone->params; 
+  size_t n = X->size1, V = X->size2, size, v, nb; 
+
+  /* Check appropriate flag and dimensions */ 
+  if (!thisone->empirical)
+    return 1; 
+  if ((n != Params->w->size) || 
+      (VX->size1 != n) || (VX->size2 != V) || 
+      (W->size1 != n) || (W->size2 != V) || 
+      (Z->size1 != n) || (Z->size2 != V)) {
+    FFF_WARNING("Incompatible dimensions"); 
+    return 1; 
+  }
+
+  /* Scratch buffers: posterior probabilities, thresholded
+     variances, current and previous weights and centers, Rk's and
+     Rik's */ 
+  size = (n+7)*n*FFF_ONESAMPLE_PDF_FIT_BLOCK; 
+  if (Params->block_size < size) {
+    free(Params->block); 
+    Params->block = (double*)malloc(FFF_MAX(size,1)*sizeof(double)); 
+    Params->block_size = (Params->block == NULL) ? 0 : size; 
+    if (Params->block == NULL) {
+      FFF_ERROR("Out of memory", ENOMEM); 
+      return 1; 
+    }
+  }
+
+  for (v=0; v<V; v+=nb) {
+    nb = FFF_MIN(FFF_ONESAMPLE_PDF_FIT_BLOCK, V-v); 
+    _fff_onesample_mfx_EM_block(Params, W->data+v, W->tda, Z->data+v, Z->tda, 
+				X->data+v, X->tda, VX->data+v, VX->tda, 
+				nb, thisone->constraint); 
   }
 
+  return 0; 
+}
+
+
+int fff_onesample_stat_gmfx_pdf_fit_block(fff_vector* mu, fff_vector* v, 
+					  fff_onesample_stat_mfx* thisone, 
+					  const fff_matrix* X, const fff_matrix* VX)
+{
+  double m[FFF_ONESAMPLE_PDF_FIT_BLOCK], s2[FFF_ONESAMPLE_PDF_FIT_BLOCK]; 
+  size_t n = X->size1, V = X->size2, j, l, nb; 
+
+  if ((VX->size1 != n) || (VX->size2 != V) || 
+      (mu->size != V) || (v->size != V)) {
+    FFF_WARNING("Incompatible dimensions"); 
+    return 1; 
+  }
+
+  for (j=0; j<V; j+=nb) {
+    nb = FFF_MIN(FFF_ONESAMPLE_PDF_FIT_BLOCK, V-j); 
+    _fff_onesample_gmfx_EM_block(m, s2, X->data+j, X->tda, VX->data+j, VX->tda, 
+				 n, nb, thisone->niter, thisone->tol, thisone->constraint); 
+    for (l=0; l<nb; l++) {
+      mu->data[(j+l)*mu->stride] = m[l]; 
+      v->data[(j+l)*v->stride] = s2[l]; 
+    }
+  }
+
+  return 0; 
+}
+
+
+/** Sort z array and re-order w accordingly **/ 
+static void _fff_sort_z(fff_vector* tmp1, fff_vector* tmp2, 
+			 const fff_vector* z, const fff_vector* w)
+{
+  /* Copy z into tmp1 and w into tmp2, then sort them together */ 
+  fff_vector_memcpy(tmp1, z); 
+  fff_vector_memcpy(tmp2, w); 
+  fff_vector_sort_with(tmp1, tmp2); 
+
   return; 
 }
 
@@ -1296,3 +1858,164 @@ void fff_onesample_permute_signs(fff_vector* xx, const fff_vector* x, double mag
   
   return; 
 }
+
+
+void fff_onesample_sign_matrix(fff_matrix* S, const fff_vector* magics)
+{
+  size_t n = S->size2, i, k; 
+  double *bufs; 
+  double m, aux; 
+
+  /* Same decoding of the magic number as fff_onesample_permute_signs */ 
+  for (k=0; k<S->size1; k++) {
+    m = fff_vector_get(magics, k); 
+    bufs = S->data + k*S->tda; 
+    for (i=0; i<n; i++, bufs++) {
+      aux = m/2; 
+      m = FFF_FLOOR(aux); 
+      aux -= m; 
+      if (aux > 0) 
+	*bufs = -1.0; 
+      else 
+	*bufs = 1.0; 
+    }
+  }
+  
+  return; 
+}
+
+
+int fff_onesample_stat_signs_init(fff_matrix* Y, const fff_onesample_stat* thisone)
+{
+  size_t n = Y->size2, i, j, k; 
+  double *buf; 
+  fff_vector *a, *idx; 
+
+  switch (thisone->flag) {
+
+  case FFF_ONESAMPLE_EMPIRICAL_MEAN:
+  case FFF_ONESAMPLE_STUDENT:
+  case FFF_ONESAMPLE_ELR:
+    return 1; 
+
+  case FFF_ONESAMPLE_SIGN_STAT:
+    if (thisone->base != 0.0)
+      return 0; 
+    for (i=0; i<Y->size1; i++) {
+      buf = Y->data + i*Y->tda; 
+      for (j=0; j<n; j++) 
+	buf[j] = FFF_SIGN(buf[j]); 
+    }
+    return 1; 
+
+  case FFF_ONESAMPLE_WILCOXON:
+    if (thisone->base != 0.0)
+      return 0; 
+    a = fff_vector_new(n); 
+    idx = fff_vector_new(n); 
+    for (i=0; i<Y->size1; i++) {
+      buf = Y->data + i*Y->tda; 
+      /* Ranks of the absolute values, see _fff_onesample_wilcoxon */ 
+      for (j=0; j<n; j++) {
+	a->data[j] = FFF_ABS(buf[j]); 
+	idx->data[j] = (double)j; 
+      }
+      fff_vector_sort_with(a, idx); 
+      for (j=0; j<n; j++) {
+	k = (size_t)idx->data[j]; 
+	buf[k] = (double)(j+1) * FFF_SIGN(buf[k]); 
+      }
+    }
+    fff_vector_delete(a); 
+    fff_vector_delete(idx); 
+    return 1; 
+
+  default:
+    return 0; 
+
+  }
+}
+
+
+void fff_onesample_stat_eval_signs(fff_matrix* T, const fff_onesample_stat* thisone, 
+				   const fff_matrix* S, const fff_matrix* Y)
+{
+  size_t n = Y->size2, i, k; 
+  double ss, m, std, aux, *buf; 
+  fff_vector y; 
+
+  /* Lockstep solver, see _fff_onesample_elr_signs */ 
+  if (thisone->flag == FFF_ONESAMPLE_ELR) {
+    _fff_onesample_elr_signs(T, thisone->base, S, Y); 
+    return; 
+  }
+
+  /* Permuted means: T = S*Y'/n */ 
+  fff_blas_dgemm(CblasNoTrans, CblasTrans, 1/(double)n, S, Y, 0.0, T); 
+
+  switch (thisone->flag) {
+
+  case FFF_ONESAMPLE_EMPIRICAL_MEAN:
+    fff_matrix_add_constant(T, -thisone->base); 
+    return; 
+
+  case FFF_ONESAMPLE_WILCOXON:
+    fff_matrix_scale(T, 1/(double)n); 
+    return; 
+
+  case FFF_ONESAMPLE_STUDENT:
+    break; 
+
+  default: 
+    return; 
+
+  }
+
+  for (i=0; i<Y->size1; i++) {
+    
+    /* Sum of squares, invariant under sign flips */ 
+    y = fff_matrix_row(Y, i); 
+    ss = fff_blas_ddot(&y, &y); 
+
+    /* See _fff_onesample_student */ 
+    for (k=0, buf=T->data+i; k<T->size1; k++, buf+=T->tda) {
+      m = *buf; 
+      aux = sqrt((double)(n-1))*(m-thisone->base);
+      if (aux == 0.0) {
+	*buf = 0.0; 
+	continue; 
+      }
+      std = ss/(double)n - FFF_SQR(m); 
+      std = sqrt(FFF_MAX(std, 0.0)); 
+      aux = aux / std; 
+      if (aux > 0)
+	*buf = (aux < FFF_POSINF) ? aux : FFF_POSINF; 
+      else 
+	*buf = (aux > FFF_NEGINF) ? aux : FFF_NEGINF; 
+    }
+  }
+
+  return; 
+}
+
+
+void fff_onesample_random_signs(fff_vector* xx, const fff_vector* x, 
+				unsigned long seed, unsigned long perm)
+{
+  size_t n = x->size, i; 
+  double *bufx=x->data, *bufxx=xx->data; 
+  unsigned long bits = 0; 
+
+  /* One 32-bit random word per block of 32 signs */ 
+  for (i=0; i<n; i++, bufx+=x->stride, bufxx+=xx->stride) {
+    if ((i%32) == 0) 
+      bits = rk_counter_random(seed, perm, i/32, 0); 
+    if (bits & 1) 
+      *bufxx = -*bufx;
+    else 
+      *bufxx = *bufx; 
+    bits >>= 1; 
+  }
+  
+  return; 
+}
@@ -15,6 +15,7 @@ extern "C" {
 #endif
 
 #include "fff_vector.h"
+#include "fff_matrix.h"
   
   /*!
     \typedef fff_onesample_stat_flag
@@ -119,6 +120,7 @@ extern "C" {
     double base; /*!< baseline for mean-value testing */
     int empirical; /*!< boolean, tells whether MFX statistic is nonparametric or not */ 
     unsigned int niter; /* non-zero for statistics based on iterative algorithms */ 
+    double tol; /* if positive, relative tolerance at which iterative algorithms stop before niter iterations */ 
     unsigned int constraint; /* non-zero for statistics computed from maximum likelihood under the null hypothesis */ 
     void* params; /*!< auxiliary parameters */
     double (*compute_stat)(void*, const fff_vector*, const fff_vector*, double); /*!< actual statistic implementation */
@@ -148,6 +150,17 @@ extern "C" {
   extern fff_onesample_stat_mfx* fff_onesample_stat_mfx_new(unsigned int n, fff_onesample_stat_flag flag, double base); 
   extern void fff_onesample_stat_mfx_delete(fff_onesample_stat_mfx* thisone); 
   extern double fff_onesample_stat_mfx_eval(fff_onesample_stat_mfx* thisone, const fff_vector* x, const fff_vector* vx);
+  /*
+    Fits the null hypothesis model to \a x and \a vx, and keeps it
+    for subsequent evaluations until the next call, so that the fit
+    is done once per voxel rather than once per permutation. This is
+    only valid when evaluating sign permutations of \a x, and thus
+    only implemented for \c FFF_ONESAMPLE_STUDENT_MFX, whose zero
+    mean fit only depends on the squared data. Returns 1 if the fit
+    is cached, 0 otherwise, e.g. if \a x is NULL, which clears the
+    cache.
+  */
+  extern int fff_onesample_stat_mfx_cache(fff_onesample_stat_mfx* thisone, const fff_vector* x, const fff_vector* vx);
 
   extern void fff_onesample_stat_mfx_pdf_fit(fff_vector* w, fff_vector* z,
 					     fff_onesample_stat_mfx* thisone, 
@@ -157,9 +170,95 @@ extern "C" {
 					      fff_onesample_stat_mfx* thisone, 
 					      const fff_vector* x, const fff_vector* vx);
 
+  /*!
+    \brief Fit the empirical MFX population distributions of many voxels
+    \param W output weights, same size as \a X
+    \param Z output centers, same size as \a X
+    \param thisone empirical MFX structure created for \a X->size1 subjects
+    \param X (number of subjects, number of voxels) data matrix
+    \param VX first-level variances, same size as \a X
+
+    Same as \c fff_onesample_stat_mfx_pdf_fit on each column of \a X
+    and \a VX. The EM iterations run in lockstep over blocks of
+    voxels stored side by side, each voxel stopping at its own
+    convergence; the scratch buffers are kept in \a thisone for
+    subsequent calls. Results agree with the voxel by voxel fit up to
+    rounding errors. Returns 0, or 1 if the dimensions are
+    inconsistent or memory is lacking.
+  */ 
+  extern int fff_onesample_stat_mfx_pdf_fit_block(fff_matrix* W, fff_matrix* Z, 
+						  fff_onesample_stat_mfx* thisone, 
+						  const fff_matrix* X, const fff_matrix* VX);
+
+  /*!
+    \brief Fit the gaussian MFX population distributions of many voxels
+    \param mu output population means, one per column of \a X
+    \param v output population variances, one per column of \a X
+    \param thisone MFX structure 
+    \param X (number of subjects, number of voxels) data matrix
+    \param VX first-level variances, same size as \a X
+
+    Same as \c fff_onesample_stat_gmfx_pdf_fit on each column of \a
+    X and \a VX, with the EM iterations run in lockstep over blocks of
+    voxels. Returns 0, or 1 if the dimensions are inconsistent.
+  */ 
+  extern int fff_onesample_stat_gmfx_pdf_fit_block(fff_vector* mu, fff_vector* v, 
+						   fff_onesample_stat_mfx* thisone, 
+						   const fff_matrix* X, const fff_matrix* VX);
+
   /** Sign permutations **/
   extern void fff_onesample_permute_signs(fff_vector* xx, const fff_vector* x, double magic);  
 
+  /*
+    Random sign permutation number \a perm of stream \a seed. Signs
+    are counter-based random bits (see rk_counter.h), hence a
+    function of (seed, perm) only: permutations can be drawn in any
+    order or on several threads, and are not limited to the 2^53
+    sign patterns that a magic number can encode.
+  */ 
+  extern void fff_onesample_random_signs(fff_vector* xx, const fff_vector* x, 
+					 unsigned long seed, unsigned long perm);  
+
+  /*
+    Sign matrix: the k-th row of \a S holds the signs (+1 or -1) that
+    fff_onesample_permute_signs applies for the k-th magic number.
+  */ 
+  extern void fff_onesample_sign_matrix(fff_matrix* S, const fff_vector* magics);  
+
+  /*
+    Prepare several signals (rows of \a Y) for
+    fff_onesample_stat_eval_signs, in place. 
+
+    FFF_ONESAMPLE_EMPIRICAL_MEAN, FFF_ONESAMPLE_STUDENT and
+    FFF_ONESAMPLE_ELR leave the signals unchanged. For FFF_ONESAMPLE_SIGN_STAT and
+    FFF_ONESAMPLE_WILCOXON with a zero baseline, each signal is
+    replaced with its signs, respectively its signed ranks, which
+    sign flips do not change except for their signs. Returns 0
+    without doing anything for other statistics, or a non-zero
+    baseline with rank statistics, 1 otherwise.
+  */ 
+  extern int fff_onesample_stat_signs_init(fff_matrix* Y, const fff_onesample_stat* thisone);  
+
+  /*
+    Evaluate a one-sample statistic for several sign permutations
+    (rows of \a S, see fff_onesample_sign_matrix) and several signals
+    (rows of \a Y, prepared by fff_onesample_stat_signs_init) at
+    once: T(k,i) is the statistic of the i-th signal with the k-th
+    signs. 
+
+    All the permuted means, signed counts or signed rank sums are
+    obtained with one matrix product. Student statistics then follow
+    from the sum of squares, which is invariant under sign flips.
+    For FFF_ONESAMPLE_ELR, the empirical likelihood problems of all
+    the signals are instead solved in lockstep, with the same
+    iterations as fff_onesample_stat_eval.
+    Up to rounding errors, and to the order of tied values for
+    FFF_ONESAMPLE_WILCOXON, results are the same as with
+    fff_onesample_permute_signs followed by fff_onesample_stat_eval.
+  */ 
+  extern void fff_onesample_stat_eval_signs(fff_matrix* T, const fff_onesample_stat* thisone, 
+					    const fff_matrix* S, const fff_matrix* Y);  
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,240 @@
+#include "fff_reproducibility.h"
+#include "fff_onesample_stat.h"
+#include "fff_threads.h"
+#include "fff_base.h"
+
+#include <stdlib.h>
+#include <math.h>
+#include <errno.h>
+
+
+/* Number of voxels whose Student statistics are evaluated by one
+   matrix product */
+#define FFF_REPRODUCIBILITY_BLOCK 256
+
+/* The rank-th worker processes the rank-th range of subgroups with
+   its own buffers, and counts in its own row of count the subgroups
+   in which each voxel is clustered. */
+typedef struct {
+  fff_array* label;
+  long* count;                 /* nthreads*V counts */
+  int* error;                  /* nthreads flags */
+  const fff_matrix* data;
+  const fff_matrix* vardata;
+  const fff_array* samples;
+  const fff_matrix* signs;
+  const fff_graph* G;
+  fff_reproducibility_method method;
+  double th;
+  long csize;
+  unsigned int niter;
+} _fff_reproducibility_job;
+
+
+/* Group statistic map of the n subjects subj with signs s */
+static void _fff_reproducibility_map(fff_vector* smap, const _fff_reproducibility_job* job,
+				     const long* subj, const fff_vector* s, fff_onesample_stat* stat,
+				     fff_onesample_stat_mfx* stat_mfx, fff_matrix* yb,
+				     fff_vector* x, fff_vector* vx)
+{
+  const fff_matrix* data = job->data;
+  const fff_matrix* vardata = job->vardata;
+  long V = data->size1, n = s->size;
+  long v, i, nb, b;
+  const double *y, *vy;
+  double sum;
+  fff_matrix yk, S, T;
+
+  /* Student statistics: the signs are applied by the matrix product */
+  if (job->method == FFF_REPRODUCIBILITY_RFX){
+    S = fff_matrix_view(s->data, 1, n, n);
+    for (v=0 ; v<V ; v+=nb){
+      nb = FFF_MIN(FFF_REPRODUCIBILITY_BLOCK, V-v);
+      for (b=0 ; b<nb ; b++){
+	y = data->data + (v+b)*data->tda;
+	for (i=0 ; i<n ; i++)
+	  yb->data[b*n+i] = y[subj[i]];
+      }
+      yk = fff_matrix_view(yb->data, nb, n, n);
+      T = fff_matrix_view(smap->data+v, 1, nb, nb);
+      fff_onesample_stat_signs_init(&yk, stat);
+      fff_onesample_stat_eval_signs(&T, stat, &S, &yk);
+    }
+    return;
+  }
+
+  for (v=0 ; v<V ; v++){
+    y = data->data + v*data->tda;
+    vy = vardata->data + v*vardata->tda;
+    for (i=0 ; i<n ; i++){
+      x->data[i] = s->data[i]*y[subj[i]];
+      vx->data[i] = vy[subj[i]];
+    }
+    if (job->method == FFF_REPRODUCIBILITY_FFX){
+      sum = 0;
+      for (i=0 ; i<n ; i++)
+	sum += x->data[i]/sqrt(vx->data[i]);
+      smap->data[v] = sum/sqrt((double)n);
+    }
+    else
+      smap->data[v] = fff_onesample_stat_mfx_eval(stat_mfx, x, vx);
+  }
+}
+
+static void _fff_reproducibility_job_run(int rank, int nthreads, void* params)
+{
+  _fff_reproducibility_job* job = (_fff_reproducibility_job*)params;
+  const fff_array* samples = job->samples;
+  long V = job->data->size1, n = samples->dimY;
+  long* count = job->count + rank*V;
+  size_t start, stop;
+  long g, i, v, l, q, nc;
+  long *subj, *lab, *size;
+  fff_vector *s, *x, *vx, *smap;
+  fff_matrix* yb;
+  fff_onesample_stat* stat = NULL;
+  fff_onesample_stat_mfx* stat_mfx = NULL;
+
+  fff_parallel_range(samples->dimX, rank, nthreads, &start, &stop);
+  subj = (long*) calloc(FFF_MAX(n,1), sizeof(long));
+  lab = (long*) calloc(FFF_MAX(V,1), sizeof(long));
+  size = (long*) calloc(FFF_MAX(V,1), sizeof(long));
+  s = fff_vector_new(n);
+  x = fff_vector_new(n);
+  vx = fff_vector_new(n);
+  smap = fff_vector_new(V);
+  yb = fff_matrix_new(FFF_REPRODUCIBILITY_BLOCK, n);
+  if (job->method == FFF_REPRODUCIBILITY_RFX)
+    stat = fff_onesample_stat_new(n, FFF_ONESAMPLE_STUDENT, 0.0);
+  else if (job->method == FFF_REPRODUCIBILITY_MFX){
+    stat_mfx = fff_onesample_stat_mfx_new(n, FFF_ONESAMPLE_STUDENT_MFX, 0.0);
+    if (stat_mfx != NULL)
+      stat_mfx->niter = job->niter;
+  }
+  if ((subj == NULL) || (lab == NULL) || (size == NULL) || (s == NULL) || (x == NULL) ||
+      (vx == NULL) || (smap == NULL) || (yb == NULL) ||
+      ((job->method == FFF_REPRODUCIBILITY_RFX) && (stat == NULL)) ||
+      ((job->method == FFF_REPRODUCIBILITY_MFX) && (stat_mfx == NULL))){
+    FFF_ERROR("Out of memory", ENOMEM);
+    job->error[rank] = 1;
+    start = stop;
+  }
+
+  for (g=(long)start ; g<(long)stop ; g++){
+    for (i=0 ; i<n ; i++){
+      subj[i] = (long)fff_array_get2d(samples, g, i);
+      s->data[i] = (job->signs == NULL) ? 1.0 : fff_matrix_get(job->signs, g, i);
+    }
+    _fff_reproducibility_map(smap, job, subj, s, stat, stat_mfx, yb, x, vx);
+
+    /* Voxels at or below the threshold are left out as NaNs */
+    for (v=0 ; v<V ; v++)
+      if (!(smap->data[v] > job->th))
+	smap->data[v] = FFF_NAN;
+    nc = fff_graph_cc_label_th(lab, job->G, smap, job->th, 1);
+
+    /* Number the large enough clusters */
+    for (l=0 ; l<nc ; l++)
+      size[l] = 0;
+    for (v=0 ; v<V ; v++)
+      if (lab[v] >= 0)
+	size[lab[v]]++;
+    q = 0;
+    for (l=0 ; l<nc ; l++)
+      size[l] = (size[l] >= job->csize) ? q++ : -1;
+    for (v=0 ; v<V ; v++){
+      l = (lab[v] >= 0) ? size[lab[v]] : -1;
+      if (job->label != NULL)
+	fff_array_set2d(job->label, g, v, l);
+      if (l >= 0)
+	count[v]++;
+    }
+  }
+
+  free(subj);
+  free(lab);
+  free(size);
+  if (s != NULL)
+    fff_vector_delete(s);
+  if (x != NULL)
+    fff_vector_delete(x);
+  if (vx != NULL)
+    fff_vector_delete(vx);
+  if (smap != NULL)
+    fff_vector_delete(smap);
+  if (yb != NULL)
+    fff_matrix_delete(yb);
+  if (stat != NULL)
+    fff_onesample_stat_delete(stat);
+  if (stat_mfx != NULL)
+    fff_onesample_stat_mfx_delete(stat_mfx);
+}
+
+
+int fff_reproducibility_clusters(fff_array* label, fff_vector* rmap,
+				 const fff_matrix* data, const fff_matrix* vardata,
+				 const fff_array* samples, const fff_matrix* signs,
+				 const fff_graph* G, fff_reproducibility_method method,
+				 double th, long csize, unsigned int niter, int nthreads)
+{
+  long V = data->size1, ngroups = samples->dimX;
+  long g, i, j, v;
+  int r, err = 0;
+  _fff_reproducibility_job job;
+
+  /* argument checking */
+  if ((G->V != V) || (samples->dimY < 1) ||
+      ((method != FFF_REPRODUCIBILITY_RFX) &&
+       ((vardata == NULL) || (vardata->size1 != data->size1) || (vardata->size2 != data->size2))) ||
+      ((signs != NULL) && (((long)signs->size1 != ngroups) || (signs->size2 != samples->dimY))) ||
+      ((label != NULL) && (((long)label->dimX != ngroups) || ((long)label->dimY != V))) ||
+      ((rmap != NULL) && ((long)rmap->size != V))){
+    FFF_WARNING("Incompatible dimensions");
+    return(1);
+  }
+  for (g=0 ; g<ngroups ; g++)
+    for (i=0 ; i<(long)samples->dimY ; i++){
+      j = (long)fff_array_get2d(samples, g, i);
+      if ((j < 0) || (j >= (long)data->size2)){
+	FFF_WARNING("Subject index out of range");
+	return(1);
+      }
+    }
+
+  nthreads = fff_threads_count(nthreads);
+  if (nthreads > ngroups)
+    nthreads = (int)FFF_MAX(ngroups, 1);
+  job.count = (long*) calloc(FFF_MAX(nthreads*V,1), sizeof(long));
+  job.error = (int*) calloc(nthreads, sizeof(int));
+  if ((job.count == NULL) || (job.error == NULL)){
+    FFF_ERROR("Out of memory", ENOMEM);
+    free(job.count);
+    free(job.error);
+    return(1);
+  }
+  job.label = label;
+  job.data = data;
+  job.vardata = vardata;
+  job.samples = samples;
+  job.signs = signs;
+  job.G = G;
+  job.method = method;
+  job.th = th;
+  job.csize = csize;
+  job.niter = niter;
+  fff_parallel_run(nthreads, &_fff_reproducibility_job_run, (void*)&job);
+
+  for (r=0 ; r<nthreads ; r++)
+    err = err || job.error[r];
+  if ((rmap != NULL) && (!err))
+    for (v=0 ; v<V ; v++){
+      g = 0;
+      for (r=0 ; r<nthreads ; r++)
+	g += job.count[r*V+v];
+      fff_vector_set(rmap, v, (double)g);
+    }
+
+  free(job.count);
+  free(job.error);
+  return(err);
+}
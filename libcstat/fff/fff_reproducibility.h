@@ -0,0 +1,85 @@
+/*!
+  \file fff_reproducibility.h
+  \brief Clusters of group statistic maps across subgroups of subjects
+  \date 2009
+
+  Reproducibility measures split the subjects of a group study into
+  subgroups, by bootstrap or jackknife, and compute a group
+  statistic map in each subgroup. Each map is thresholded and its
+  supra-threshold clusters are labelled. The measures are then
+  derived from the voxels or the clusters that the subgroups have in
+  common, see nipy.neurospin.utils.reproducibility_measures.
+
+  The subgroups are independent, and are shared among threads.
+*/
+
+#ifndef FFF_REPRODUCIBILITY
+#define FFF_REPRODUCIBILITY
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "fff_array.h"
+#include "fff_vector.h"
+#include "fff_matrix.h"
+#include "fff_graphlib.h"
+
+  /*!
+    \typedef fff_reproducibility_method
+    \brief Group statistic of the subgroups
+
+    \c FFF_REPRODUCIBILITY_RFX is the one-sample Student statistic of
+    the effects (see \c FFF_ONESAMPLE_STUDENT).
+
+    \c FFF_REPRODUCIBILITY_FFX is the fixed-effects statistic \f$ t =
+    \sqrt{n} \frac{1}{n} \sum_i x_i/\sqrt{v_i} \f$, where \a n is the
+    subgroup size, and \f$ x_i, v_i \f$ are the effects and their
+    variances.
+
+    \c FFF_REPRODUCIBILITY_MFX is the mixed-effects Student statistic
+    (see \c FFF_ONESAMPLE_STUDENT_MFX).
+  */
+  typedef enum {
+    FFF_REPRODUCIBILITY_RFX = 0,
+    FFF_REPRODUCIBILITY_FFX = 1,
+    FFF_REPRODUCIBILITY_MFX = 2
+  } fff_reproducibility_method;
+
+  /*!
+    \brief Supra-threshold clusters of the group maps of several subgroups
+    \param label (number of subgroups, V) array of the cluster of each voxel in each subgroup, -1 outside the clusters; may be NULL
+    \param rmap number of subgroups in which each voxel belongs to a cluster (V); may be NULL
+    \param data (V, number of subjects) matrix of effects
+    \param vardata variances of the effects, with the same size as \a data; may be NULL with \c FFF_REPRODUCIBILITY_RFX
+    \param samples (number of subgroups, subgroup size) array of the subjects of each subgroup
+    \param signs signs applied to the effects of each subgroup, with the same size as \a samples; may be NULL
+    \param G graph on the V voxels, e.g. a grid graph
+    \param method group statistic
+    \param th cluster-forming threshold: clusters are the connected components of the voxels whose statistic is strictly above \a th
+    \param csize minimal cluster size: smaller clusters are discarded
+    \param niter number of EM iterations of \c FFF_REPRODUCIBILITY_MFX
+    \param nthreads number of threads (see \c fff_threads_count)
+
+    Subjects may appear several times in a subgroup. The Student
+    statistics of each subgroup are computed block of voxels by block
+    of voxels with \c fff_onesample_stat_eval_signs, and the clusters
+    are labelled by \c fff_graph_cc_label_th; they are numbered from
+    0 in the order of their first voxel, in each subgroup. The
+    subgroups are independent, so that the result does not depend on
+    the number of threads.
+
+    Returns 0, or 1 if the arguments are inconsistent or memory is
+    lacking.
+  */
+  extern int fff_reproducibility_clusters(fff_array* label, fff_vector* rmap,
+					  const fff_matrix* data, const fff_matrix* vardata,
+					  const fff_array* samples, const fff_matrix* signs,
+					  const fff_graph* G, fff_reproducibility_method method,
+					  double th, long csize, unsigned int niter, int nthreads);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -2,6 +2,7 @@
 #include "fff_base.h"
 
 #include <randomkit.h>
+#include <distributions.h>
 
 #include <stdlib.h>
 #include <stdio.h>
@@ -157,16 +158,20 @@ extern int generate_normals(fff_matrix* nvariate, const fff_matrix * means, cons
   rk_state state; 
   int i,j;
   double x,s,m;
+  double* row; 
 
   rk_seed(1, &state);
   
-  for (i=0 ; i<nvariate->size1 ; i++)
+  for (i=0 ; i<nvariate->size1 ; i++){
+	row = nvariate->data + i*nvariate->tda; 
+	rk_fill_gauss(&state, row, nvariate->size2); 
 	for (j=0 ; j<nvariate->size2 ; j++){
 	  s =  1.0/sqrt(fff_matrix_get(precision,i,j));
 	  m = fff_matrix_get(means,i,j);
-	  x = m + s*rk_gauss(&state);
+	  x = m + s*row[j];
 	  fff_matrix_set(nvariate,i,j,x);
 	}
+  }
   
   return(0);
 }
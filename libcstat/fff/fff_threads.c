@@ -0,0 +1,136 @@
+#include "fff_threads.h"
+#include "fff_base.h"
+
+#include <stdlib.h>
+#include <errno.h>
+
+#ifndef FFF_NO_THREADS
+#include <pthread.h>
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <unistd.h>
+#endif
+#endif
+
+
+typedef struct {
+  fff_parallel_func func;
+  int rank;
+  int nthreads;
+  void* params;
+} _fff_parallel_job;
+
+
+int fff_threads_ncpu(void)
+{
+  int ncpu = 1;
+
+#ifndef FFF_NO_THREADS
+#ifdef _WIN32
+  SYSTEM_INFO info;
+  GetSystemInfo(&info);
+  ncpu = (int)info.dwNumberOfProcessors;
+#elif defined(_SC_NPROCESSORS_ONLN)
+  ncpu = (int)sysconf(_SC_NPROCESSORS_ONLN);
+#endif
+#endif
+
+  if (ncpu < 1)
+    ncpu = 1;
+
+  return ncpu;
+}
+
+
+int fff_threads_count(int nthreads)
+{
+#ifdef FFF_NO_THREADS
+  return 1;
+#else
+  if (nthreads <= 0)
+    return fff_threads_ncpu();
+  return nthreads;
+#endif
+}
+
+
+#ifndef FFF_NO_THREADS
+static void* _fff_parallel_start(void* arg)
+{
+  _fff_parallel_job* job = (_fff_parallel_job*)arg;
+  job->func(job->rank, job->nthreads, job->params);
+  return NULL;
+}
+#endif
+
+
+void fff_parallel_run(int nthreads, fff_parallel_func func, void* params)
+{
+#ifndef FFF_NO_THREADS
+  _fff_parallel_job* jobs;
+  pthread_t* threads;
+  int* started;
+  int k;
+#endif
+
+  nthreads = fff_threads_count(nthreads);
+
+  if (nthreads == 1) {
+    func(0, 1, params);
+    return;
+  }
+
+#ifndef FFF_NO_THREADS
+  jobs = (_fff_parallel_job*)malloc(nthreads*sizeof(_fff_parallel_job));
+  threads = (pthread_t*)malloc(nthreads*sizeof(pthread_t));
+  started = (int*)calloc(nthreads, sizeof(int));
+  if ((jobs==NULL) || (threads==NULL) || (started==NULL)) {
+    FFF_WARNING("Could not allocate thread data, running serially");
+    free(jobs); free(threads); free(started);
+    for (k=0; k<nthreads; k++)
+      func(k, nthreads, params);
+    return;
+  }
+
+  for (k=0; k<nthreads; k++) {
+    jobs[k].func = func;
+    jobs[k].rank = k;
+    jobs[k].nthreads = nthreads;
+    jobs[k].params = params;
+  }
+
+  /* Spawn workers 1..nthreads-1 and run rank 0 in the caller */
+  for (k=1; k<nthreads; k++)
+    started[k] = (pthread_create(&threads[k], NULL, &_fff_parallel_start, (void*)(&jobs[k])) == 0);
+  func(0, nthreads, params);
+
+  /* Wait for completion; run jobs that could not be spawned */
+  for (k=1; k<nthreads; k++) {
+    if (started[k])
+      pthread_join(threads[k], NULL);
+    else
+      func(k, nthreads, params);
+  }
+
+  free(jobs);
+  free(threads);
+  free(started);
+#endif
+
+  return;
+}
+
+
+void fff_parallel_range(size_t n, int rank, int nthreads, size_t* start, size_t* stop)
+{
+  size_t chunk = n / nthreads;
+  size_t rem = n % nthreads;
+  size_t r = (size_t)rank;
+
+  /* The first (n % nthreads) chunks get one more item */
+  *start = r*chunk + FFF_MIN(r, rem);
+  *stop = *start + chunk + (r < rem ? 1 : 0);
+
+  return;
+}
@@ -0,0 +1,71 @@
+/*!
+  \file fff_threads.h
+  \brief Minimal support for running independent jobs concurrently
+  \date 2009
+
+  A parallel job is a function that receives its rank in \a
+  [0..nthreads-1] together with the total number of workers, and
+  decides by itself which part of the work it is responsible for
+  (see \c fff_parallel_range). The calling thread runs rank 0.
+
+  Threads are implemented using POSIX threads. Define \c
+  FFF_NO_THREADS at compile time to get a serial library; this is
+  the default on Windows unless \c FFF_HAVE_PTHREAD is defined.
+*/
+
+#ifndef FFF_THREADS
+#define FFF_THREADS
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stddef.h>
+
+#if defined(_WIN32) && !defined(FFF_HAVE_PTHREAD) && !defined(FFF_NO_THREADS)
+#define FFF_NO_THREADS
+#endif
+
+  typedef void (*fff_parallel_func)(int rank, int nthreads, void* params);
+
+  /*!
+    \brief Number of online processors, or 1 if unknown
+  */
+  extern int fff_threads_ncpu(void);
+
+  /*!
+    \brief Resolve a user thread count
+    \param nthreads requested number of threads
+
+    Returns the number of processors if \a nthreads is zero or
+    negative, and always 1 in a serial build.
+  */
+  extern int fff_threads_count(int nthreads);
+
+  /*!
+    \brief Run a job on several threads and wait for completion
+    \param nthreads number of workers (resolved by \c fff_threads_count)
+    \param func job function
+    \param params job parameters, shared by all workers
+
+    If a thread cannot be created, its share of the work is run by
+    the calling thread, so the job always completes.
+  */
+  extern void fff_parallel_run(int nthreads, fff_parallel_func func, void* params);
+
+  /*!
+    \brief Split \a [0..n-1] into contiguous chunks
+    \param n number of items
+    \param rank worker rank
+    \param nthreads number of workers
+    \param start first item of the chunk
+    \param stop last item of the chunk plus one
+  */
+  extern void fff_parallel_range(size_t n, int rank, int nthreads, size_t* start, size_t* stop);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
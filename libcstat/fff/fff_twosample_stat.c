@@ -3,6 +3,9 @@
 #include "fff_gen_stats.h"
 #include "fff_glm_twolevel.h"
 #include "fff_base.h"
+#include "fff_blas.h"
+
+#include <rk_counter.h>
 
 #include <stdlib.h>
 #include <stdlib.h>
@@ -22,10 +25,15 @@ static void  _fff_twosample_mfx_assembly(fff_matrix* X, fff_matrix* PX, fff_matr
 typedef struct{
   fff_glm_twolevel_EM *em; 
   unsigned int* niter; 
+  double* tol; 
   fff_vector* work; 
   fff_matrix* X;
   fff_matrix* PX; 
   fff_matrix* PPX; 
+  int cached; /* non-zero if the null fit below is valid */ 
+  fff_vector* b0; /* null fit */ 
+  double s20; 
+  double ll0; 
 } fff_twosample_mfx; 
 
 
@@ -96,6 +104,7 @@ fff_twosample_stat_mfx* fff_twosample_stat_mfx_new(unsigned int n1, unsigned int
   thisone->n2 = n2; 
   thisone->flag = flag; 
   thisone->niter = 0; 
+  thisone->tol = 0.0; 
 
   switch (flag) {
 
@@ -105,10 +114,13 @@ fff_twosample_stat_mfx* fff_twosample_stat_mfx_new(unsigned int n1, unsigned int
     thisone->params = (void*)aux; 
     aux->em = fff_glm_twolevel_EM_new(n, 2);
     aux->niter = &(thisone->niter); 
+    aux->tol = &(thisone->tol); 
     aux->work = fff_vector_new(n); 
     aux->X = fff_matrix_new(n, 2); 
     aux->PX = fff_matrix_new(2, n); 
     aux->PPX = fff_matrix_new(2, n); 
+    aux->cached = 0; 
+    aux->b0 = fff_vector_new(2); 
     _fff_twosample_mfx_assembly(aux->X, aux->PX, aux->PPX, n1, n2); 
     break;
 
@@ -136,6 +148,7 @@ void fff_twosample_stat_mfx_delete(fff_twosample_stat_mfx* thisone)
     fff_matrix_delete(aux->X); 
     fff_matrix_delete(aux->PX); 
     fff_matrix_delete(aux->PPX); 
+    fff_vector_delete(aux->b0); 
     fff_glm_twolevel_EM_delete(aux->em);
     free(aux);
     break;
@@ -156,6 +169,31 @@ double fff_twosample_stat_mfx_eval(fff_twosample_stat_mfx* thisone,
   return t; 
 }
 
+int fff_twosample_stat_mfx_cache(fff_twosample_stat_mfx* thisone, 
+				 const fff_vector* x, const fff_vector* vx)
+{
+  fff_twosample_mfx* Params; 
+
+  if (thisone->flag != FFF_TWOSAMPLE_STUDENT_MFX) 
+    return 0; 
+
+  Params = (fff_twosample_mfx*)thisone->params; 
+  Params->cached = 0; 
+  if (x == NULL) 
+    return 0; 
+
+  /* Constrained EM, see _fff_twosample_student_mfx */ 
+  Params->em->tol = thisone->tol; 
+  fff_glm_twolevel_EM_init(Params->em);
+  fff_glm_twolevel_EM_run(Params->em, x, vx, Params->X, Params->PPX, thisone->niter);
+  Params->ll0 = fff_glm_twolevel_log_likelihood(x, vx, Params->X, Params->em->b, Params->em->s2, Params->work);   
+  fff_vector_memcpy(Params->b0, Params->em->b); 
+  Params->s20 = Params->em->s2; 
+  Params->cached = 1; 
+
+  return 1; 
+}
+
 
 
 /*********************************************************************
@@ -272,10 +310,18 @@ static double _fff_twosample_student_mfx(void* params, const fff_vector* x,
   double F, sign, ll, ll0; 
   unsigned int niter = *(Params->niter); 
 
-  /* Constrained EM */ 
-  fff_glm_twolevel_EM_init(Params->em);
-  fff_glm_twolevel_EM_run(Params->em, x, vx, Params->X, Params->PPX, niter);
-  ll0 = fff_glm_twolevel_log_likelihood(x, vx, Params->X, Params->em->b, Params->em->s2, Params->work);   
+  /* Constrained EM, unless cached */ 
+  Params->em->tol = *(Params->tol); 
+  if (Params->cached) {
+    fff_vector_memcpy(Params->em->b, Params->b0); 
+    Params->em->s2 = Params->s20; 
+    ll0 = Params->ll0; 
+  }
+  else {
+    fff_glm_twolevel_EM_init(Params->em);
+    fff_glm_twolevel_EM_run(Params->em, x, vx, Params->X, Params->PPX, niter);
+    ll0 = fff_glm_twolevel_log_likelihood(x, vx, Params->X, Params->em->b, Params->em->s2, Params->work);   
+  }
 
   /* Unconstrained EM initialized with constrained maximization results */ 
   fff_glm_twolevel_EM_run(Params->em, x, vx, Params->X, Params->PX, niter);
@@ -351,6 +397,103 @@ unsigned int fff_twosample_permutation(unsigned int* idx1, unsigned int* idx2,
   return i; 
 }
 
+/*
+  Bounds used by fff_twosample_permutation, for i=0..min(n1,n2):
+  cuml[i] = sum_j<i Cn1,j*Cn2,j, c1[i] = Cn1,i and cuml[i+1]. They are
+  computed with the same operations, hence give the same results.
+*/
+static void _fff_twosample_bounds(double* cuml, double* c1, unsigned int n1, unsigned int n2)
+{
+  unsigned int n=FFF_MIN(n1, n2), i;
+  double aux, c2=1; 
+
+  cuml[0] = 0; 
+  cuml[1] = 1; 
+  c1[0] = 1; 
+  for(i=0; i<n; i++) { 
+    aux = (double)(i+1); 
+    c1[i+1] = c1[i]*(n1-i); 
+    c1[i+1] /= aux;
+    c2 *= (n2-i); 
+    c2 /= aux;
+    cuml[i+2] = cuml[i+1] + c1[i+1]*c2; 
+  }
+}
+
+void fff_twosample_permutations(unsigned int* idx1, unsigned int* idx2, unsigned int* nex, 
+				unsigned int n1, unsigned int n2, const double* magic, size_t m)
+{
+  unsigned int n=FFF_MIN(n1, n2), i;
+  double *cuml, *c1, mg, magic1, magic2; 
+  size_t k; 
+
+  cuml = (double*)malloc((n+2)*sizeof(double)); 
+  c1 = (double*)malloc((n+1)*sizeof(double)); 
+  if ((cuml==NULL) || (c1==NULL)) {
+    FFF_ERROR("Out of memory", ENOMEM); 
+    free(cuml); 
+    free(c1); 
+    return; 
+  }
+  _fff_twosample_bounds(cuml, c1, n1, n2); 
+
+  for (k=0; k<m; k++, idx1+=n, idx2+=n) {
+
+    /* Magic numbers beyond the last permutation give the identity,
+       as in fff_twosample_permutation */ 
+    mg = magic[k]; 
+    for(i=0; i<=n; i++)
+      if (mg < cuml[i+1])
+	break; 
+    if (i > n) {
+      nex[k] = 0; 
+      continue; 
+    }
+
+    mg -= cuml[i]; 
+    magic2 = floor(mg/c1[i]);
+    magic1 = mg - magic2*c1[i];  
+    fff_combination(idx1, i, n1, magic1);
+    fff_combination(idx2, i, n2, magic2);
+    nex[k] = i; 
+  }
+
+  free(cuml); 
+  free(c1); 
+  return; 
+}
+
+/* 
+   Draw the n1 elements that form the first group after permutation
+   (selection sampling, Knuth's algorithm S, which gives all subsets
+   the same probability). Unselected elements of group 1 are swapped
+   with selected elements of group 2.
+*/ 
+unsigned int fff_twosample_random_permutation(unsigned int* idx1, unsigned int* idx2, 
+					      unsigned int n1, unsigned int n2, 
+					      unsigned long seed, unsigned long perm)
+{
+  unsigned int n = n1+n2, left = n1, i1 = 0, i2 = 0, t; 
+  double u; 
+
+  for (t=0; t<n; t++) {
+    u = rk_counter_double(seed, perm, t, 0); 
+    if (u*(n-t) < left) {
+      left --; 
+      if (t >= n1) {
+	idx2[i2] = t-n1; 
+	i2 ++; 
+      }
+    }
+    else if (t < n1) {
+      idx1[i1] = t; 
+      i1 ++; 
+    }
+  }
+
+  return i1; 
+}
+
 /*
   px assumed allocated n1 + n2
 */
@@ -404,3 +547,106 @@ void fff_twosample_apply_permutation(fff_vector* px, fff_vector* pv,
 } 
 
 
+void fff_twosample_label_matrix(fff_matrix* G, unsigned int n1, const fff_vector* magics)
+{
+  unsigned int n = G->size2, n2 = n-n1, nmin = FFF_MIN(n1, n2), j; 
+  unsigned int *idx1, *idx2, *nex; 
+  double *bufm, *bufg; 
+  size_t k; 
+
+  idx1 = (unsigned int*)malloc(FFF_MAX(G->size1*nmin, 1)*sizeof(unsigned int)); 
+  idx2 = (unsigned int*)malloc(FFF_MAX(G->size1*nmin, 1)*sizeof(unsigned int)); 
+  nex = (unsigned int*)malloc(FFF_MAX(G->size1, 1)*sizeof(unsigned int)); 
+  bufm = (double*)malloc(FFF_MAX(G->size1, 1)*sizeof(double)); 
+  if ((idx1==NULL) || (idx2==NULL) || (nex==NULL) || (bufm==NULL)) {
+    FFF_ERROR("Out of memory", ENOMEM); 
+    free(idx1); 
+    free(idx2); 
+    free(nex); 
+    free(bufm); 
+    return; 
+  }
+
+  /* Exchanged elements of all the permutations at once */ 
+  for (k=0; k<G->size1; k++) 
+    bufm[k] = fff_vector_get(magics, k); 
+  fff_twosample_permutations(idx1, idx2, nex, n1, n2, bufm, G->size1); 
+
+  for (k=0; k<G->size1; k++) {
+    bufg = G->data + k*G->tda; 
+    for (j=0; j<n; j++) 
+      bufg[j] = (j<n1) ? 1.0 : 0.0; 
+
+    /* See fff_twosample_apply_permutation */ 
+    for (j=0; j<nex[k]; j++) {
+      bufg[idx1[k*nmin+j]] = 0.0; 
+      bufg[n1+idx2[k*nmin+j]] = 1.0; 
+    }
+  }
+
+  free(idx1); 
+  free(idx2); 
+  free(nex); 
+  free(bufm); 
+  return; 
+}
+
+
+int fff_twosample_stat_labels_init(fff_matrix* Y, const fff_twosample_stat* thisone)
+{
+  size_t n = Y->size2, i, j; 
+  double m, *buf; 
+
+  if (thisone->flag != FFF_TWOSAMPLE_STUDENT) 
+    return 0; 
+
+  for (i=0; i<Y->size1; i++) {
+    buf = Y->data + i*Y->tda; 
+    m = 0.0; 
+    for (j=0; j<n; j++) 
+      m += buf[j]; 
+    m /= (double)n; 
+    for (j=0; j<n; j++) 
+      buf[j] -= m; 
+  }
+
+  return 1; 
+}
+
+
+void fff_twosample_stat_eval_labels(fff_matrix* T, const fff_twosample_stat* thisone, 
+				    const fff_matrix* G, const fff_matrix* Y)
+{
+  size_t i, k; 
+  unsigned int n1 = thisone->n1, n2 = thisone->n2, naux; 
+  double q, s1, m1, m2, v, *buf; 
+  fff_vector y; 
+
+  /* Permuted sums of the first group: T = G*Y' */ 
+  fff_blas_dgemm(CblasNoTrans, CblasTrans, 1.0, G, Y, 0.0, T); 
+
+  /* Compute max( n1+n2-2, 1 ), see _fff_twosample_student */ 
+  naux = (n1+n2 > 2) ? n1+n2-2 : 1; 
+
+  for (i=0; i<Y->size1; i++) {
+
+    /* Total sum of squares, the total sum being zero */ 
+    y = fff_matrix_row(Y, i); 
+    q = fff_blas_ddot(&y, &y); 
+    
+    for (k=0, buf=T->data+i; k<T->size1; k++, buf+=T->tda) {
+      s1 = *buf; 
+      m1 = s1/(double)n1; 
+      m2 = -s1/(double)n2; 
+      /* Pooled sum of squared deviations: q - n1*m1^2 - n2*m2^2 */ 
+      v = (q - s1*m1 + s1*m2) / (double)naux; 
+      if (v <= 0.0) 
+	v = FFF_POSINF; 
+      else 
+	v = 1/sqrt(v); 
+      *buf = (m1-m2)*v; 
+    }
+  }
+
+  return; 
+}
@@ -15,6 +15,7 @@ extern "C" {
 #endif
 
 #include "fff_vector.h"
+#include "fff_matrix.h"
   
   /* Two-sample stat flag */
   typedef enum {
@@ -55,6 +56,7 @@ extern "C" {
     unsigned int n2; /*!< number of subjects in second group */
     fff_twosample_stat_flag flag; /*!< statistic's identifier */
     unsigned int niter; 
+    double tol; /*!< if positive, relative tolerance at which EM stops before niter iterations */ 
     void* params; /*! auxiliary structures */ 
     double (*compute_stat)(void*, const fff_vector*, const fff_vector*, unsigned int); /*!< actual statistic implementation */
   } fff_twosample_stat_mfx;
@@ -65,11 +67,44 @@ extern "C" {
   extern void fff_twosample_stat_mfx_delete(fff_twosample_stat_mfx* thisone); 
   extern double fff_twosample_stat_mfx_eval(fff_twosample_stat_mfx* thisone, 
 					    const fff_vector* x, const fff_vector* vx);
+  /*
+    Fits the null hypothesis (common mean) model to \a x and \a vx,
+    and keeps it for subsequent evaluations until the next call. The
+    null fit does not depend on the group labels, so this is valid
+    when evaluating label permutations of \a x and \a vx, for which
+    it is then done once rather than once per permutation. Returns 1
+    if the fit is cached, 0 otherwise, e.g. if \a x is NULL, which
+    clears the cache.
+  */
+  extern int fff_twosample_stat_mfx_cache(fff_twosample_stat_mfx* thisone, 
+					  const fff_vector* x, const fff_vector* vx);
 
 
   /** Label permutations **/
   extern unsigned int fff_twosample_permutation(unsigned int* idx1, unsigned int* idx2, 
 						unsigned int n1, unsigned int n2, double* magic);
+
+  /*
+    Label permutations of several magic numbers at once, as given by
+    fff_twosample_permutation: for the k-th magic number, the number
+    of exchanged elements is stored in \a nex[k], and their indices in
+    \a idx1 and \a idx2 from position k*min(n1, n2) (both assumed
+    allocated m*min(n1, n2)). The bounds that locate the magic
+    numbers are computed only once.
+  */ 
+  extern void fff_twosample_permutations(unsigned int* idx1, unsigned int* idx2, unsigned int* nex, 
+					 unsigned int n1, unsigned int n2, const double* magic, size_t m);
+
+  /*
+    Random label permutation number \a perm of stream \a seed, as a
+    function of (seed, perm) only (see rk_counter.h). Same output as
+    fff_twosample_permutation: returns the number i of exchanged
+    elements, whose indices within each group are stored in idx1 and
+    idx2 (assumed allocated min(n1, n2)).
+  */ 
+  extern unsigned int fff_twosample_random_permutation(unsigned int* idx1, unsigned int* idx2, 
+						       unsigned int n1, unsigned int n2, 
+						       unsigned long seed, unsigned long perm);
   
  
   extern void fff_twosample_apply_permutation(fff_vector* px, fff_vector* pv, 
@@ -77,6 +112,41 @@ extern "C" {
 					      const fff_vector* x2, const fff_vector* v2,
 					      unsigned int i, 
 					      const unsigned int* idx1, const unsigned int* idx2); 
+
+  /*
+    Label matrix: the k-th row of \a G holds the indicator (1 or 0)
+    of the first group after the permutation that
+    fff_twosample_permutation encodes by the k-th magic number, \a
+    n1 being the size of the first group before permutation and \a
+    G->size2 the total number of elements.
+  */ 
+  extern void fff_twosample_label_matrix(fff_matrix* G, unsigned int n1, const fff_vector* magics); 
+
+  /*
+    Prepare several signals (rows of \a Y, group 1 followed by group
+    2) for fff_twosample_stat_eval_labels, in place: for
+    FFF_TWOSAMPLE_STUDENT, each signal is centered, which does not
+    change the statistic. Returns 0 without doing anything for other
+    statistics, 1 otherwise.
+  */ 
+  extern int fff_twosample_stat_labels_init(fff_matrix* Y, const fff_twosample_stat* thisone); 
+
+  /*
+    Evaluate a two-sample statistic for several label permutations
+    (rows of \a G, see fff_twosample_label_matrix) and several signals
+    (rows of \a Y, prepared by fff_twosample_stat_labels_init) at
+    once: T(k,i) is the statistic of the i-th signal with the k-th
+    labels.
+
+    All the permuted sums of the first group are obtained with one
+    matrix product. Those of the second group, and the pooled
+    variances, follow from the total sum and sum of squares, which
+    permutations do not change. Up to rounding errors, results are
+    the same as with fff_twosample_apply_permutation followed by
+    fff_twosample_stat_eval.
+  */ 
+  extern void fff_twosample_stat_eval_labels(fff_matrix* T, const fff_twosample_stat* thisone, 
+					     const fff_matrix* G, const fff_matrix* Y); 
   
 
 #ifdef __cplusplus
@@ -8,10 +8,17 @@
 #include <math.h>
 #include <errno.h>
 
+/* Below this size, order statistics are obtained by sorting */ 
+#define FFF_VECTOR_SELECT_SMALL 8
+
 /* Declaration of static functions */ 
 static double _fff_pth_element(double* x, size_t p, size_t stride, size_t size); 
 static void _fff_pth_interval(double* am, double* aM, 
 			       double* x, size_t p, size_t stride, size_t size); 
+static void _fff_sort_insertion(double* x, size_t n); 
+static void _fff_sort_insertion_with(double* x, double* w, size_t n); 
+static void _fff_sort_small(double* x, size_t stride, size_t n); 
+static int _fff_double_comp(const void * x, const void * y); 
 
 
 /* Constructor */ 
@@ -28,6 +35,7 @@ fff_vector* fff_vector_new(size_t size)
   thisone->data = (double*)calloc(size, sizeof(double)); 
   if (thisone->data == NULL) 
     FFF_ERROR("Allocation failed", ENOMEM); 
+  FFF_PROFILE_COUNT(FFF_PROFILE_ALLOCATIONS, 1); 
 
   thisone->size = size; 
   thisone->stride = 1; 
@@ -60,6 +68,17 @@ fff_vector fff_vector_view(const double* data, size_t size, size_t stride)
   return x; 
 }
 
+/* Scratch vector */ 
+fff_vector fff_vector_arena(fff_arena* arena, size_t size)
+{
+  double* data = (double*)fff_arena_alloc(arena, size*sizeof(double)); 
+
+  if (data != NULL) 
+    memset((void*)data, 0, size*sizeof(double)); 
+
+  return fff_vector_view(data, size, 1); 
+}
+
 
 
 
@@ -340,7 +359,166 @@ double fff_vector_quantile(fff_vector* x, double r, int interp)
 }
 
 
+/* Order statistic */ 
+double fff_vector_select(fff_vector* x, size_t p)
+{
+  return _fff_pth_element(x->data, p, x->stride, x->size); 
+}
+
+
+/* Sort */ 
+void fff_vector_sort(fff_vector* x)
+{
+  size_t i, n = x->size; 
+  double *buf, *bufx; 
+
+  if (n <= FFF_VECTOR_SORT_SMALL) {
+    _fff_sort_small(x->data, x->stride, n); 
+    return; 
+  }
+
+  if (x->stride == 1) {
+    qsort(x->data, n, sizeof(double), &_fff_double_comp); 
+    return; 
+  }
+  
+  buf = (double*)malloc(n*sizeof(double)); 
+  for (i=0, bufx=x->data; i<n; i++, bufx+=x->stride)
+    buf[i] = *bufx; 
+  qsort(buf, n, sizeof(double), &_fff_double_comp); 
+  for (i=0, bufx=x->data; i<n; i++, bufx+=x->stride)
+    *bufx = buf[i]; 
+  free(buf); 
+
+  return; 
+}
+
+
+typedef struct{
+  double x; 
+  double w; 
+} _fff_weighted_data;
+
+static int _fff_weighted_data_comp(const void * x, const void * y)
+{
+  return _fff_double_comp(&((const _fff_weighted_data*)x)->x, 
+			  &((const _fff_weighted_data*)y)->x); 
+}
+
+void fff_vector_sort_with(fff_vector* x, fff_vector* w)
+{
+  size_t i, n = x->size; 
+  double sx[FFF_VECTOR_SORT_SMALL], sw[FFF_VECTOR_SORT_SMALL]; 
+  double *bufx, *bufw; 
+  _fff_weighted_data* buf; 
+
+  if (w->size != n) 
+    return; 
+
+  if (n <= FFF_VECTOR_SORT_SMALL) {
+    for (i=0, bufx=x->data, bufw=w->data; i<n; i++, bufx+=x->stride, bufw+=w->stride) {
+      sx[i] = *bufx; 
+      sw[i] = *bufw; 
+    }
+    _fff_sort_insertion_with(sx, sw, n); 
+    for (i=0, bufx=x->data, bufw=w->data; i<n; i++, bufx+=x->stride, bufw+=w->stride) {
+      *bufx = sx[i]; 
+      *bufw = sw[i]; 
+    }
+    return; 
+  }
+
+  buf = (_fff_weighted_data*)malloc(n*sizeof(_fff_weighted_data)); 
+  for (i=0, bufx=x->data, bufw=w->data; i<n; i++, bufx+=x->stride, bufw+=w->stride) {
+    buf[i].x = *bufx; 
+    buf[i].w = *bufw; 
+  }
+  qsort(buf, n, sizeof(_fff_weighted_data), &_fff_weighted_data_comp); 
+  for (i=0, bufx=x->data, bufw=w->data; i<n; i++, bufx+=x->stride, bufw+=w->stride) {
+    *bufx = buf[i].x; 
+    *bufw = buf[i].w; 
+  }
+  free(buf); 
+
+  return; 
+}
+
+
 /*** STATIC FUNCTIONS ***/ 
+
+static int _fff_double_comp(const void * x, const void * y)
+{
+  double xx = *((const double*)x); 
+  double yy = *((const double*)y); 
+
+  if (xx < yy) 
+    return -1; 
+  if (xx > yy) 
+    return 1; 
+  return 0; 
+}
+
+/* 
+   Insertion sort. For small arrays, it is faster than qsort as it
+   involves no comparison callbacks and few data moves.
+*/ 
+static void _fff_sort_insertion(double* x, size_t n)
+{
+  size_t i, j; 
+  double a; 
+
+  for (i=1; i<n; i++) {
+    a = x[i]; 
+    for (j=i; (j>0) && (x[j-1]>a); j--) 
+      x[j] = x[j-1]; 
+    x[j] = a; 
+  }
+
+  return; 
+}
+
+/* Same as _fff_sort_insertion, moving the elements of w along with x */ 
+static void _fff_sort_insertion_with(double* x, double* w, size_t n)
+{
+  size_t i, j; 
+  double a, wa; 
+
+  for (i=1; i<n; i++) {
+    a = x[i]; 
+    wa = w[i]; 
+    for (j=i; (j>0) && (x[j-1]>a); j--) {
+      x[j] = x[j-1]; 
+      w[j] = w[j-1]; 
+    }
+    x[j] = a; 
+    w[j] = wa; 
+  }
+
+  return; 
+}
+
+/* Sort at most FFF_VECTOR_SORT_SMALL values using a contiguous copy
+   if needed */ 
+static void _fff_sort_small(double* x, size_t stride, size_t n)
+{
+  double buf[FFF_VECTOR_SORT_SMALL], *bufx; 
+  size_t i; 
+
+  if (stride == 1) {
+    _fff_sort_insertion(x, n); 
+    return; 
+  }
+
+  for (i=0, bufx=x; i<n; i++, bufx+=stride)
+    buf[i] = *bufx; 
+  _fff_sort_insertion(buf, n); 
+  for (i=0, bufx=x; i<n; i++, bufx+=stride)
+    *bufx = buf[i]; 
+  
+  return; 
+}
+
+
 /* BEWARE: the input array x gets modified! */ 
 
 /*
@@ -357,6 +535,11 @@ static double _fff_pth_element(double* x, size_t p, size_t stride, size_t n)
   size_t i, j, il, jr, stop1, stop2;
   int same_extremities;
    
+  if (n <= FFF_VECTOR_SELECT_SMALL) {
+    _fff_sort_small(x, stride, n); 
+    return x[p*stride]; 
+  }
+
   stop1 = 0; 
   il = 0; 
   jr = n-1;
@@ -436,6 +619,13 @@ static void _fff_pth_interval(double* am, double* aM,
   size_t pp = p+1; 
   int same_extremities = 0; 
 
+  if (n <= FFF_VECTOR_SELECT_SMALL) {
+    _fff_sort_small(x, stride, n); 
+    *am = x[p*stride]; 
+    *aM = x[(p+1)*stride]; 
+    return; 
+  }
+
   *am = 0.0; 
   *aM = 0.0; 
   stop1 = 0; 
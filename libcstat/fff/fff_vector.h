@@ -48,6 +48,15 @@ extern "C" {
     \param stride array stride
   */
   extern fff_vector fff_vector_view(const double* data, size_t size, size_t stride); 
+  /*!
+    \brief Vector allocated from an arena
+    \param arena scratch memory
+    \param size vector size
+
+    The vector is zero-filled, like with \c fff_vector_new, but does
+    not own its data, which is released by resetting the arena.
+  */
+  extern fff_vector fff_vector_arena(fff_arena* arena, size_t size); 
  
   /*! 
     \brief Get an element 
@@ -154,6 +163,38 @@ extern "C" {
     fff_median_from_temp_data, the array elements are re-arranged.
   */  
   extern double fff_vector_quantile( fff_vector* x, double r, int interp );
+
+  /*!
+    \brief Order statistic from non-const vector
+    \param x input vector 
+    \param p rank, from 0 to the size of \a x minus one
+
+    Returns the element that would have index \a p if \a x was sorted
+    in ascending order. Similarly to \c fff_vector_median, the array
+    elements are re-arranged.
+  */  
+  extern double fff_vector_select( fff_vector* x, size_t p );
+
+#define FFF_VECTOR_SORT_SMALL 64
+
+  /*!
+    \brief Sort a vector in ascending order
+    \param x input vector 
+
+    Vectors of size up to \c FFF_VECTOR_SORT_SMALL are sorted using
+    insertion sort on a contiguous copy, which avoids the comparison
+    callbacks of \c qsort; \c qsort is used otherwise.
+  */  
+  extern void fff_vector_sort( fff_vector* x );
+  /*!
+    \brief Sort a vector in ascending order and reorder another one accordingly
+    \param x input vector 
+    \param w vector of the same size as \a x
+
+    See \c fff_vector_sort. The relative order of the elements of \a
+    w corresponding to equal elements of \a x is unspecified.
+  */  
+  extern void fff_vector_sort_with( fff_vector* x, fff_vector* w );
   /*!
     \brief Weighted median
     \param x already sorted data 
@@ -30,9 +30,9 @@ doublereal dasum_(integer *n, doublereal *dx, integer *incx)
     doublereal ret_val, d__1, d__2, d__3, d__4, d__5, d__6;
 
     /* Local variables */
-    static integer i__, m;
-    static doublereal dtemp;
-    static integer nincx, mp1;
+    integer i__, m;
+    doublereal dtemp;
+    integer nincx, mp1;
 
 
 /*
@@ -113,7 +113,7 @@ L60:
     integer i__1;
 
     /* Local variables */
-    static integer i__, m, ix, iy, mp1;
+    integer i__, m, ix, iy, mp1;
 
 
 /*
@@ -224,7 +224,7 @@ doublereal dcabs1_(doublecomplex *z__)
     integer i__1;
 
     /* Local variables */
-    static integer i__, m, ix, iy, mp1;
+    integer i__, m, ix, iy, mp1;
 
 
 /*
@@ -316,9 +316,9 @@ doublereal ddot_(integer *n, doublereal *dx, integer *incx, doublereal *dy,
     doublereal ret_val;
 
     /* Local variables */
-    static integer i__, m;
-    static doublereal dtemp;
-    static integer ix, iy, mp1;
+    integer i__, m;
+    doublereal dtemp;
+    integer ix, iy, mp1;
 
 
 /*
@@ -413,12 +413,12 @@ L60:
 	    i__3;
 
     /* Local variables */
-    static integer info;
-    static logical nota, notb;
-    static doublereal temp;
-    static integer i__, j, l, ncola;
+    integer info;
+    logical nota, notb;
+    doublereal temp;
+    integer i__, j, l, ncola;
     extern logical lsame_(char *, char *);
-    static integer nrowa, nrowb;
+    integer nrowa, nrowb;
     extern /* Subroutine */ int xerbla_(char *, integer *);
 
 
@@ -773,11 +773,11 @@ L60:
     integer a_dim1, a_offset, i__1, i__2;
 
     /* Local variables */
-    static integer info;
-    static doublereal temp;
-    static integer lenx, leny, i__, j;
+    integer info;
+    doublereal temp;
+    integer lenx, leny, i__, j;
     extern logical lsame_(char *, char *);
-    static integer ix, iy, jx, jy, kx, ky;
+    integer ix, iy, jx, jy, kx, ky;
     extern /* Subroutine */ int xerbla_(char *, integer *);
 
 
@@ -1063,9 +1063,9 @@ L60:
     integer a_dim1, a_offset, i__1, i__2;
 
     /* Local variables */
-    static integer info;
-    static doublereal temp;
-    static integer i__, j, ix, jy, kx;
+    integer info;
+    doublereal temp;
+    integer i__, j, ix, jy, kx;
     extern /* Subroutine */ int xerbla_(char *, integer *);
 
 
@@ -1237,9 +1237,9 @@ doublereal dnrm2_(integer *n, doublereal *x, integer *incx)
     double sqrt(doublereal);
 
     /* Local variables */
-    static doublereal norm, scale, absxi;
-    static integer ix;
-    static doublereal ssq;
+    doublereal norm, scale, absxi;
+    integer ix;
+    doublereal ssq;
 
 
 /*
@@ -1310,9 +1310,9 @@ doublereal dnrm2_(integer *n, doublereal *x, integer *incx)
     integer i__1;
 
     /* Local variables */
-    static integer i__;
-    static doublereal dtemp;
-    static integer ix, iy;
+    integer i__;
+    doublereal dtemp;
+    integer ix, iy;
 
 
 /*
@@ -1384,7 +1384,7 @@ L20:
     double sqrt(doublereal), d_sign(doublereal *, doublereal *);
 
     /* Local variables */
-    static doublereal r__, scale, z__, roe;
+    doublereal r__, scale, z__, roe;
 
 
 /*
@@ -1443,10 +1443,10 @@ L20:
     integer i__1, i__2;
 
     /* Local variables */
-    static integer i__;
-    static doublereal dflag, w, z__;
-    static integer kx, ky, nsteps;
-    static doublereal dh11, dh12, dh21, dh22;
+    integer i__;
+    doublereal dflag, w, z__;
+    integer kx, ky, nsteps;
+    doublereal dh11, dh12, dh21, dh22;
 
 
 /*
@@ -1647,12 +1647,12 @@ L140:
     doublereal d__1;
 
     /* Local variables */
-    static doublereal dflag, dtemp, du, dp1, dp2, dq1, dq2, dh11, dh12, dh21,
+    doublereal dflag, dtemp, du, dp1, dp2, dq1, dq2, dh11, dh12, dh21,
 	    dh22;
-    static integer igo;
+    integer igo;
 
     /* Assigned format variables */
-    static char *igo_fmt;
+    char *igo_fmt;
 
 
 /*
@@ -1903,7 +1903,7 @@ L260:
     integer i__1, i__2;
 
     /* Local variables */
-    static integer i__, m, nincx, mp1;
+    integer i__, m, nincx, mp1;
 
 
 /*
@@ -1981,9 +1981,9 @@ L40:
     integer i__1;
 
     /* Local variables */
-    static integer i__, m;
-    static doublereal dtemp;
-    static integer ix, iy, mp1;
+    integer i__, m;
+    doublereal dtemp;
+    integer ix, iy, mp1;
 
 
 /*
@@ -2082,12 +2082,12 @@ L40:
 	    i__3;
 
     /* Local variables */
-    static integer info;
-    static doublereal temp1, temp2;
-    static integer i__, j, k;
+    integer info;
+    doublereal temp1, temp2;
+    integer i__, j, k;
     extern logical lsame_(char *, char *);
-    static integer nrowa;
-    static logical upper;
+    integer nrowa;
+    logical upper;
     extern /* Subroutine */ int xerbla_(char *, integer *);
 
 
@@ -2417,11 +2417,11 @@ L40:
     integer a_dim1, a_offset, i__1, i__2;
 
     /* Local variables */
-    static integer info;
-    static doublereal temp1, temp2;
-    static integer i__, j;
+    integer info;
+    doublereal temp1, temp2;
+    integer i__, j;
     extern logical lsame_(char *, char *);
-    static integer ix, iy, jx, jy, kx, ky;
+    integer ix, iy, jx, jy, kx, ky;
     extern /* Subroutine */ int xerbla_(char *, integer *);
 
 
@@ -2706,11 +2706,11 @@ L40:
     integer a_dim1, a_offset, i__1, i__2;
 
     /* Local variables */
-    static integer info;
-    static doublereal temp;
-    static integer i__, j;
+    integer info;
+    doublereal temp;
+    integer i__, j;
     extern logical lsame_(char *, char *);
-    static integer ix, jx, kx;
+    integer ix, jx, kx;
     extern /* Subroutine */ int xerbla_(char *, integer *);
 
 
@@ -2922,11 +2922,11 @@ L40:
     integer a_dim1, a_offset, i__1, i__2;
 
     /* Local variables */
-    static integer info;
-    static doublereal temp1, temp2;
-    static integer i__, j;
+    integer info;
+    doublereal temp1, temp2;
+    integer i__, j;
     extern logical lsame_(char *, char *);
-    static integer ix, iy, jx, jy, kx, ky;
+    integer ix, iy, jx, jy, kx, ky;
     extern /* Subroutine */ int xerbla_(char *, integer *);
 
 
@@ -3177,12 +3177,12 @@ L40:
 	    i__3;
 
     /* Local variables */
-    static integer info;
-    static doublereal temp1, temp2;
-    static integer i__, j, l;
+    integer info;
+    doublereal temp1, temp2;
+    integer i__, j, l;
     extern logical lsame_(char *, char *);
-    static integer nrowa;
-    static logical upper;
+    integer nrowa;
+    logical upper;
     extern /* Subroutine */ int xerbla_(char *, integer *);
 
 
@@ -3557,12 +3557,12 @@ L40:
     integer a_dim1, a_offset, c_dim1, c_offset, i__1, i__2, i__3;
 
     /* Local variables */
-    static integer info;
-    static doublereal temp;
-    static integer i__, j, l;
+    integer info;
+    doublereal temp;
+    integer i__, j, l;
     extern logical lsame_(char *, char *);
-    static integer nrowa;
-    static logical upper;
+    integer nrowa;
+    logical upper;
     extern /* Subroutine */ int xerbla_(char *, integer *);
 
 
@@ -3903,15 +3903,15 @@ L40:
     integer a_dim1, a_offset, b_dim1, b_offset, i__1, i__2, i__3;
 
     /* Local variables */
-    static integer info;
-    static doublereal temp;
-    static integer i__, j, k;
-    static logical lside;
+    integer info;
+    doublereal temp;
+    integer i__, j, k;
+    logical lside;
     extern logical lsame_(char *, char *);
-    static integer nrowa;
-    static logical upper;
+    integer nrowa;
+    logical upper;
     extern /* Subroutine */ int xerbla_(char *, integer *);
-    static logical nounit;
+    logical nounit;
 
 
 /*
@@ -4329,13 +4329,13 @@ L40:
     integer a_dim1, a_offset, i__1, i__2;
 
     /* Local variables */
-    static integer info;
-    static doublereal temp;
-    static integer i__, j;
+    integer info;
+    doublereal temp;
+    integer i__, j;
     extern logical lsame_(char *, char *);
-    static integer ix, jx, kx;
+    integer ix, jx, kx;
     extern /* Subroutine */ int xerbla_(char *, integer *);
-    static logical nounit;
+    logical nounit;
 
 
 /*
@@ -4654,15 +4654,15 @@ L40:
     integer a_dim1, a_offset, b_dim1, b_offset, i__1, i__2, i__3;
 
     /* Local variables */
-    static integer info;
-    static doublereal temp;
-    static integer i__, j, k;
-    static logical lside;
+    integer info;
+    doublereal temp;
+    integer i__, j, k;
+    logical lside;
     extern logical lsame_(char *, char *);
-    static integer nrowa;
-    static logical upper;
+    integer nrowa;
+    logical upper;
     extern /* Subroutine */ int xerbla_(char *, integer *);
-    static logical nounit;
+    logical nounit;
 
 
 /*
@@ -5117,13 +5117,13 @@ L40:
     integer a_dim1, a_offset, i__1, i__2;
 
     /* Local variables */
-    static integer info;
-    static doublereal temp;
-    static integer i__, j;
+    integer info;
+    doublereal temp;
+    integer i__, j;
     extern logical lsame_(char *, char *);
-    static integer ix, jx, kx;
+    integer ix, jx, kx;
     extern /* Subroutine */ int xerbla_(char *, integer *);
-    static logical nounit;
+    logical nounit;
 
 
 /*
@@ -5444,8 +5444,8 @@ integer idamax_(integer *n, doublereal *dx, integer *incx)
     doublereal d__1;
 
     /* Local variables */
-    static doublereal dmax__;
-    static integer i__, ix;
+    doublereal dmax__;
+    integer i__, ix;
 
 
 /*
@@ -5516,7 +5516,7 @@ logical lsame_(char *ca, char *cb)
     logical ret_val;
 
     /* Local variables */
-    static integer inta, intb, zcode;
+    integer inta, intb, zcode;
 
 
 /*
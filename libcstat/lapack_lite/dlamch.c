@@ -1,4 +1,5 @@
 #include <stdio.h>
+#include <float.h>
 #include "f2c.h"
 
 /* If config.h is available, we only need dlamc3 */
@@ -47,57 +48,30 @@ doublereal dlamch_(char *cmach)
 
    ===================================================================== 
 */
-/* >>Start of File<<   
-       Initialized data */
-    static logical first = TRUE_;
-    /* System generated locals */
-    integer i__1;
-    doublereal ret_val;
-    /* Builtin functions */
-    double pow_di(doublereal *, integer *);
+/* >>Start of File<< */
     /* Local variables */
-    static doublereal base;
-    static integer beta;
-    static doublereal emin, prec, emax;
-    static integer imin, imax;
-    static logical lrnd;
-    static doublereal rmin, rmax, t, rmach;
+    doublereal base, emin, prec, emax;
+    doublereal rmin, rmax, t, rmach = 0.;
     extern logical lsame_(char *, char *);
-    static doublereal small, sfmin;
-    extern /* Subroutine */ int dlamc2_(integer *, integer *, logical *, 
-	    doublereal *, integer *, doublereal *, integer *, doublereal *);
-    static integer it;
-    static doublereal rnd, eps;
-
-
-
-    if (first) {
-	first = FALSE_;
-	dlamc2_(&beta, &it, &lrnd, &eps, &imin, &rmin, &imax, &rmax);
-	base = (doublereal) beta;
-	t = (doublereal) it;
-	if (lrnd) {
-	    rnd = 1.;
-	    i__1 = 1 - it;
-	    eps = pow_di(&base, &i__1) / 2;
-	} else {
-	    rnd = 0.;
-	    i__1 = 1 - it;
-	    eps = pow_di(&base, &i__1);
-	}
-	prec = eps * base;
-	emin = (doublereal) imin;
-	emax = (doublereal) imax;
-	sfmin = rmin;
-	small = 1. / rmax;
-	if (small >= sfmin) {
-
-/*           Use SMALL plus a bit, to avoid the possibility of rou
-nding   
-             causing overflow when computing  1/sfmin. */
-
-	    sfmin = small * (eps + 1.);
-	}
+    doublereal sfmin;
+    doublereal rnd, eps;
+
+/*     The machine parameters are taken from float.h, as in LAPACK 3.2,
+       rather than computed by DLAMC2 and saved on the first call,
+       which was not safe when called from several threads. */
+
+    base = (doublereal) FLT_RADIX;
+    t = (doublereal) DBL_MANT_DIG;
+    rnd = 1.;
+    eps = DBL_EPSILON * .5;
+    prec = eps * base;
+    emin = (doublereal) DBL_MIN_EXP;
+    rmin = DBL_MIN;
+    emax = (doublereal) DBL_MAX_EXP;
+    rmax = DBL_MAX;
+    sfmin = rmin;
+    if (1. / rmax >= sfmin) {
+	sfmin = 1. / rmax * (eps + 1.);
     }
 
     if (lsame_(cmach, "E")) {
@@ -122,8 +96,7 @@ nding
 	rmach = rmax;
     }
 
-    ret_val = rmach;
-    return ret_val;
+    return rmach;
 
 /*     End of DLAMCH */
 
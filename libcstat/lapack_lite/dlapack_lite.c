@@ -60,20 +60,20 @@ static real c_b4271 = 1.f;
     double d_sign(doublereal *, doublereal *), log(doublereal);
 
     /* Local variables */
-    static integer difl, difr, ierr, perm, mlvl, sqre, i__, j, k;
-    static doublereal p, r__;
-    static integer z__;
+    integer difl, difr, ierr, perm, mlvl, sqre, i__, j, k;
+    doublereal p, r__;
+    integer z__;
     extern logical lsame_(char *, char *);
     extern /* Subroutine */ int dlasr_(char *, char *, char *, integer *,
 	    integer *, doublereal *, doublereal *, doublereal *, integer *), dcopy_(integer *, doublereal *, integer *
 	    , doublereal *, integer *), dswap_(integer *, doublereal *,
 	    integer *, doublereal *, integer *);
-    static integer poles, iuplo, nsize, start;
+    integer poles, iuplo, nsize, start;
     extern /* Subroutine */ int dlasd0_(integer *, integer *, doublereal *,
 	    doublereal *, doublereal *, integer *, doublereal *, integer *,
 	    integer *, integer *, doublereal *, integer *);
-    static integer ic, ii, kk;
-    static doublereal cs;
+    integer ic, ii, kk;
+    doublereal cs;
 
     extern /* Subroutine */ int dlasda_(integer *, integer *, integer *,
 	    integer *, doublereal *, doublereal *, doublereal *, integer *,
@@ -81,8 +81,8 @@ static real c_b4271 = 1.f;
 	     doublereal *, integer *, integer *, integer *, integer *,
 	    doublereal *, doublereal *, doublereal *, doublereal *, integer *,
 	     integer *);
-    static integer is, iu;
-    static doublereal sn;
+    integer is, iu;
+    doublereal sn;
     extern /* Subroutine */ int dlascl_(char *, integer *, integer *,
 	    doublereal *, doublereal *, integer *, integer *, doublereal *,
 	    integer *, integer *), dlasdq_(char *, integer *, integer
@@ -95,13 +95,13 @@ static real c_b4271 = 1.f;
     extern integer ilaenv_(integer *, char *, char *, integer *, integer *,
 	    integer *, integer *, ftnlen, ftnlen);
     extern /* Subroutine */ int xerbla_(char *, integer *);
-    static integer givcol;
+    integer givcol;
     extern doublereal dlanst_(char *, integer *, doublereal *, doublereal *);
-    static integer icompq;
-    static doublereal orgnrm;
-    static integer givnum, givptr, nm1, qstart, smlsiz, wstart, smlszp;
-    static doublereal eps;
-    static integer ivt;
+    integer icompq;
+    doublereal orgnrm;
+    integer givnum, givptr, nm1, qstart, smlsiz, wstart, smlszp;
+    doublereal eps;
+    integer ivt;
 
 
 /*
@@ -554,50 +554,50 @@ L40:
 	    doublereal *, doublereal *);
 
     /* Local variables */
-    static doublereal abse;
-    static integer idir;
-    static doublereal abss;
-    static integer oldm;
-    static doublereal cosl;
-    static integer isub, iter;
-    static doublereal unfl, sinl, cosr, smin, smax, sinr;
+    doublereal abse;
+    integer idir;
+    doublereal abss;
+    integer oldm;
+    doublereal cosl;
+    integer isub, iter;
+    doublereal unfl, sinl, cosr, smin, smax, sinr;
     extern /* Subroutine */ int drot_(integer *, doublereal *, integer *,
 	    doublereal *, integer *, doublereal *, doublereal *), dlas2_(
 	    doublereal *, doublereal *, doublereal *, doublereal *,
 	    doublereal *);
-    static doublereal f, g, h__;
-    static integer i__, j, m;
-    static doublereal r__;
+    doublereal f, g, h__;
+    integer i__, j, m;
+    doublereal r__;
     extern /* Subroutine */ int dscal_(integer *, doublereal *, doublereal *,
 	    integer *);
     extern logical lsame_(char *, char *);
-    static doublereal oldcs;
+    doublereal oldcs;
     extern /* Subroutine */ int dlasr_(char *, char *, char *, integer *,
 	    integer *, doublereal *, doublereal *, doublereal *, integer *);
-    static integer oldll;
-    static doublereal shift, sigmn, oldsn;
+    integer oldll;
+    doublereal shift, sigmn, oldsn;
     extern /* Subroutine */ int dswap_(integer *, doublereal *, integer *,
 	    doublereal *, integer *);
-    static integer maxit;
-    static doublereal sminl, sigmx;
-    static logical lower;
+    integer maxit;
+    doublereal sminl, sigmx;
+    logical lower;
     extern /* Subroutine */ int dlasq1_(integer *, doublereal *, doublereal *,
 	     doublereal *, integer *), dlasv2_(doublereal *, doublereal *,
 	    doublereal *, doublereal *, doublereal *, doublereal *,
 	    doublereal *, doublereal *, doublereal *);
-    static doublereal cs;
-    static integer ll;
+    doublereal cs;
+    integer ll;
 
-    static doublereal sn, mu;
+    doublereal sn, mu;
     extern /* Subroutine */ int dlartg_(doublereal *, doublereal *,
 	    doublereal *, doublereal *, doublereal *), xerbla_(char *,
 	    integer *);
-    static doublereal sminoa, thresh;
-    static logical rotate;
-    static integer nm1;
-    static doublereal tolmul;
-    static integer nm12, nm13, lll;
-    static doublereal eps, sll, tol;
+    doublereal sminoa, thresh;
+    logical rotate;
+    integer nm1;
+    doublereal tolmul;
+    integer nm12, nm13, lll;
+    doublereal eps, sll, tol;
 
 
 /*
@@ -1458,17 +1458,17 @@ L220:
     integer v_dim1, v_offset, i__1;
 
     /* Local variables */
-    static integer i__, k;
-    static doublereal s;
+    integer i__, k;
+    doublereal s;
     extern /* Subroutine */ int dscal_(integer *, doublereal *, doublereal *,
 	    integer *);
     extern logical lsame_(char *, char *);
     extern /* Subroutine */ int dswap_(integer *, doublereal *, integer *,
 	    doublereal *, integer *);
-    static logical leftv;
-    static integer ii;
+    logical leftv;
+    integer ii;
     extern /* Subroutine */ int xerbla_(char *, integer *);
-    static logical rightv;
+    logical rightv;
 
 
 /*
@@ -1670,21 +1670,21 @@ L50:
     doublereal d__1, d__2;
 
     /* Local variables */
-    static integer iexc;
-    static doublereal c__, f, g;
-    static integer i__, j, k, l, m;
-    static doublereal r__, s;
+    integer iexc;
+    doublereal c__, f, g;
+    integer i__, j, k, l, m;
+    doublereal r__, s;
     extern /* Subroutine */ int dscal_(integer *, doublereal *, doublereal *,
 	    integer *);
     extern logical lsame_(char *, char *);
     extern /* Subroutine */ int dswap_(integer *, doublereal *, integer *,
 	    doublereal *, integer *);
-    static doublereal sfmin1, sfmin2, sfmax1, sfmax2, ca, ra;
+    doublereal sfmin1, sfmin2, sfmax1, sfmax2, ca, ra;
 
     extern integer idamax_(integer *, doublereal *, integer *);
     extern /* Subroutine */ int xerbla_(char *, integer *);
-    static logical noconv;
-    static integer ica, ira;
+    logical noconv;
+    integer ica, ira;
 
 
 /*
@@ -2044,7 +2044,7 @@ L210:
     integer a_dim1, a_offset, i__1, i__2, i__3;
 
     /* Local variables */
-    static integer i__;
+    integer i__;
     extern /* Subroutine */ int dlarf_(char *, integer *, integer *,
 	    doublereal *, integer *, doublereal *, doublereal *, integer *,
 	    doublereal *), dlarfg_(integer *, doublereal *,
@@ -2323,25 +2323,25 @@ L210:
     integer a_dim1, a_offset, i__1, i__2, i__3, i__4;
 
     /* Local variables */
-    static integer i__, j;
+    integer i__, j;
     extern /* Subroutine */ int dgemm_(char *, char *, integer *, integer *,
 	    integer *, doublereal *, doublereal *, integer *, doublereal *,
 	    integer *, doublereal *, doublereal *, integer *);
-    static integer nbmin, iinfo, minmn;
+    integer nbmin, iinfo, minmn;
     extern /* Subroutine */ int dgebd2_(integer *, integer *, doublereal *,
 	    integer *, doublereal *, doublereal *, doublereal *, doublereal *,
 	     doublereal *, integer *);
-    static integer nb;
+    integer nb;
     extern /* Subroutine */ int dlabrd_(integer *, integer *, integer *,
 	    doublereal *, integer *, doublereal *, doublereal *, doublereal *,
 	     doublereal *, doublereal *, integer *, doublereal *, integer *);
-    static integer nx;
-    static doublereal ws;
+    integer nx;
+    doublereal ws;
     extern /* Subroutine */ int xerbla_(char *, integer *);
     extern integer ilaenv_(integer *, char *, char *, integer *, integer *,
 	    integer *, integer *, ftnlen, ftnlen);
-    static integer ldwrkx, ldwrky, lwkopt;
-    static logical lquery;
+    integer ldwrkx, ldwrky, lwkopt;
+    logical lquery;
 
 
 /*
@@ -2643,16 +2643,16 @@ L210:
     double sqrt(doublereal);
 
     /* Local variables */
-    static integer ibal;
-    static char side[1];
-    static doublereal anrm;
-    static integer ierr, itau;
+    integer ibal;
+    char side[1];
+    doublereal anrm;
+    integer ierr, itau;
     extern /* Subroutine */ int drot_(integer *, doublereal *, integer *,
 	    doublereal *, integer *, doublereal *, doublereal *);
-    static integer iwrk, nout;
+    integer iwrk, nout;
     extern doublereal dnrm2_(integer *, doublereal *, integer *);
-    static integer i__, k;
-    static doublereal r__;
+    integer i__, k;
+    doublereal r__;
     extern /* Subroutine */ int dscal_(integer *, doublereal *, doublereal *,
 	    integer *);
     extern logical lsame_(char *, char *);
@@ -2662,16 +2662,16 @@ L210:
 	    integer *, doublereal *, integer *, integer *),
 	    dgebal_(char *, integer *, doublereal *, integer *, integer *,
 	    integer *, doublereal *, integer *);
-    static doublereal cs;
-    static logical scalea;
+    doublereal cs;
+    logical scalea;
 
-    static doublereal cscale;
+    doublereal cscale;
     extern doublereal dlange_(char *, integer *, integer *, doublereal *,
 	    integer *, doublereal *);
     extern /* Subroutine */ int dgehrd_(integer *, integer *, integer *,
 	    doublereal *, integer *, doublereal *, doublereal *, integer *,
 	    integer *);
-    static doublereal sn;
+    doublereal sn;
     extern /* Subroutine */ int dlascl_(char *, integer *, integer *,
 	    doublereal *, doublereal *, integer *, integer *, doublereal *,
 	    integer *, integer *);
@@ -2680,10 +2680,10 @@ L210:
 	    doublereal *, integer *, doublereal *, integer *),
 	    dlartg_(doublereal *, doublereal *, doublereal *, doublereal *,
 	    doublereal *), xerbla_(char *, integer *);
-    static logical select[1];
+    logical select[1];
     extern integer ilaenv_(integer *, char *, char *, integer *, integer *,
 	    integer *, integer *, ftnlen, ftnlen);
-    static doublereal bignum;
+    doublereal bignum;
     extern /* Subroutine */ int dorghr_(integer *, integer *, integer *,
 	    doublereal *, integer *, doublereal *, doublereal *, integer *,
 	    integer *), dhseqr_(char *, char *, integer *, integer *, integer
@@ -2691,15 +2691,15 @@ L210:
 	    doublereal *, integer *, doublereal *, integer *, integer *), dtrevc_(char *, char *, logical *, integer *,
 	    doublereal *, integer *, doublereal *, integer *, doublereal *,
 	    integer *, integer *, integer *, doublereal *, integer *);
-    static integer minwrk, maxwrk;
-    static logical wantvl;
-    static doublereal smlnum;
-    static integer hswork;
-    static logical lquery, wantvr;
-    static integer ihi;
-    static doublereal scl;
-    static integer ilo;
-    static doublereal dum[1], eps;
+    integer minwrk, maxwrk;
+    logical wantvl;
+    doublereal smlnum;
+    integer hswork;
+    logical lquery, wantvr;
+    integer ihi;
+    doublereal scl;
+    integer ilo;
+    doublereal dum[1], eps;
 
 
 /*
@@ -3201,12 +3201,12 @@ L50:
     integer a_dim1, a_offset, i__1, i__2, i__3;
 
     /* Local variables */
-    static integer i__;
+    integer i__;
     extern /* Subroutine */ int dlarf_(char *, integer *, integer *,
 	    doublereal *, integer *, doublereal *, doublereal *, integer *,
 	    doublereal *), dlarfg_(integer *, doublereal *,
 	    doublereal *, integer *, doublereal *), xerbla_(char *, integer *);
-    static doublereal aii;
+    doublereal aii;
 
 
 /*
@@ -3363,12 +3363,12 @@ L50:
     integer a_dim1, a_offset, i__1, i__2, i__3, i__4;
 
     /* Local variables */
-    static integer i__, j;
-    static doublereal t[4160]	/* was [65][64] */;
+    integer i__, j;
+    doublereal t[4160]	/* was [65][64] */;
     extern /* Subroutine */ int dgemm_(char *, char *, integer *, integer *,
 	    integer *, doublereal *, doublereal *, integer *, doublereal *,
 	    integer *, doublereal *, doublereal *, integer *);
-    static integer nbmin, iinfo;
+    integer nbmin, iinfo;
     extern /* Subroutine */ int dtrmm_(char *, char *, char *, char *,
 	    integer *, integer *, doublereal *, doublereal *, integer *,
 	    doublereal *, integer *), daxpy_(
@@ -3377,20 +3377,20 @@ L50:
 	     integer *, doublereal *, doublereal *, integer *), dlahr2_(
 	    integer *, integer *, integer *, doublereal *, integer *,
 	    doublereal *, doublereal *, integer *, doublereal *, integer *);
-    static integer ib;
-    static doublereal ei;
-    static integer nb, nh;
+    integer ib;
+    doublereal ei;
+    integer nb, nh;
     extern /* Subroutine */ int dlarfb_(char *, char *, char *, char *,
 	    integer *, integer *, integer *, doublereal *, integer *,
 	    doublereal *, integer *, doublereal *, integer *, doublereal *,
 	    integer *);
-    static integer nx;
+    integer nx;
     extern /* Subroutine */ int xerbla_(char *, integer *);
     extern integer ilaenv_(integer *, char *, char *, integer *, integer *,
 	    integer *, integer *, ftnlen, ftnlen);
-    static integer ldwork, lwkopt;
-    static logical lquery;
-    static integer iws;
+    integer ldwork, lwkopt;
+    logical lquery;
+    integer iws;
 
 
 /*
@@ -3686,12 +3686,12 @@ L50:
     integer a_dim1, a_offset, i__1, i__2, i__3;
 
     /* Local variables */
-    static integer i__, k;
+    integer i__, k;
     extern /* Subroutine */ int dlarf_(char *, integer *, integer *,
 	    doublereal *, integer *, doublereal *, doublereal *, integer *,
 	    doublereal *), dlarfg_(integer *, doublereal *,
 	    doublereal *, integer *, doublereal *), xerbla_(char *, integer *);
-    static doublereal aii;
+    doublereal aii;
 
 
 /*
@@ -3818,22 +3818,22 @@ L50:
     integer a_dim1, a_offset, i__1, i__2, i__3, i__4;
 
     /* Local variables */
-    static integer i__, k, nbmin, iinfo;
+    integer i__, k, nbmin, iinfo;
     extern /* Subroutine */ int dgelq2_(integer *, integer *, doublereal *,
 	    integer *, doublereal *, doublereal *, integer *);
-    static integer ib, nb;
+    integer ib, nb;
     extern /* Subroutine */ int dlarfb_(char *, char *, char *, char *,
 	    integer *, integer *, integer *, doublereal *, integer *,
 	    doublereal *, integer *, doublereal *, integer *, doublereal *,
 	    integer *);
-    static integer nx;
+    integer nx;
     extern /* Subroutine */ int dlarft_(char *, char *, integer *, integer *,
 	    doublereal *, integer *, doublereal *, doublereal *, integer *), xerbla_(char *, integer *);
     extern integer ilaenv_(integer *, char *, char *, integer *, integer *,
 	    integer *, integer *, ftnlen, ftnlen);
-    static integer ldwork, lwkopt;
-    static logical lquery;
-    static integer iws;
+    integer ldwork, lwkopt;
+    logical lquery;
+    integer iws;
 
 
 /*
@@ -4057,17 +4057,17 @@ L50:
     double log(doublereal);
 
     /* Local variables */
-    static doublereal anrm, bnrm;
-    static integer itau, nlvl, iascl, ibscl;
-    static doublereal sfmin;
-    static integer minmn, maxmn, itaup, itauq, mnthr, nwork;
+    doublereal anrm, bnrm;
+    integer itau, nlvl, iascl, ibscl;
+    doublereal sfmin;
+    integer minmn, maxmn, itaup, itauq, mnthr, nwork;
     extern /* Subroutine */ int dlabad_(doublereal *, doublereal *);
-    static integer ie, il;
+    integer ie, il;
     extern /* Subroutine */ int dgebrd_(integer *, integer *, doublereal *,
 	    integer *, doublereal *, doublereal *, doublereal *, doublereal *,
 	     doublereal *, integer *, integer *);
 
-    static integer mm;
+    integer mm;
     extern doublereal dlange_(char *, integer *, integer *, doublereal *,
 	    integer *, doublereal *);
     extern /* Subroutine */ int dgelqf_(integer *, integer *, doublereal *,
@@ -4084,23 +4084,23 @@ L50:
 	    integer *);
     extern integer ilaenv_(integer *, char *, char *, integer *, integer *,
 	    integer *, integer *, ftnlen, ftnlen);
-    static doublereal bignum;
+    doublereal bignum;
     extern /* Subroutine */ int dormbr_(char *, char *, char *, integer *,
 	    integer *, integer *, doublereal *, integer *, doublereal *,
 	    doublereal *, integer *, doublereal *, integer *, integer *);
-    static integer wlalsd;
+    integer wlalsd;
     extern /* Subroutine */ int dormlq_(char *, char *, integer *, integer *,
 	    integer *, doublereal *, integer *, doublereal *, doublereal *,
 	    integer *, doublereal *, integer *, integer *);
-    static integer ldwork;
+    integer ldwork;
     extern /* Subroutine */ int dormqr_(char *, char *, integer *, integer *,
 	    integer *, doublereal *, integer *, doublereal *, doublereal *,
 	    integer *, doublereal *, integer *, integer *);
-    static integer minwrk, maxwrk;
-    static doublereal smlnum;
-    static logical lquery;
-    static integer smlsiz;
-    static doublereal eps;
+    integer minwrk, maxwrk;
+    doublereal smlnum;
+    logical lquery;
+    integer smlsiz;
+    doublereal eps;
 
 
 /*
@@ -4739,12 +4739,12 @@ L10:
     integer a_dim1, a_offset, i__1, i__2, i__3;
 
     /* Local variables */
-    static integer i__, k;
+    integer i__, k;
     extern /* Subroutine */ int dlarf_(char *, integer *, integer *,
 	    doublereal *, integer *, doublereal *, doublereal *, integer *,
 	    doublereal *), dlarfg_(integer *, doublereal *,
 	    doublereal *, integer *, doublereal *), xerbla_(char *, integer *);
-    static doublereal aii;
+    doublereal aii;
 
 
 /*
@@ -4871,22 +4871,22 @@ L10:
     integer a_dim1, a_offset, i__1, i__2, i__3, i__4;
 
     /* Local variables */
-    static integer i__, k, nbmin, iinfo;
+    integer i__, k, nbmin, iinfo;
     extern /* Subroutine */ int dgeqr2_(integer *, integer *, doublereal *,
 	    integer *, doublereal *, doublereal *, integer *);
-    static integer ib, nb;
+    integer ib, nb;
     extern /* Subroutine */ int dlarfb_(char *, char *, char *, char *,
 	    integer *, integer *, integer *, doublereal *, integer *,
 	    doublereal *, integer *, doublereal *, integer *, doublereal *,
 	    integer *);
-    static integer nx;
+    integer nx;
     extern /* Subroutine */ int dlarft_(char *, char *, integer *, integer *,
 	    doublereal *, integer *, doublereal *, doublereal *, integer *), xerbla_(char *, integer *);
     extern integer ilaenv_(integer *, char *, char *, integer *, integer *,
 	    integer *, integer *, ftnlen, ftnlen);
-    static integer ldwork, lwkopt;
-    static logical lquery;
-    static integer iws;
+    integer ldwork, lwkopt;
+    logical lquery;
+    integer iws;
 
 
 /*
@@ -5112,30 +5112,30 @@ L10:
     double sqrt(doublereal);
 
     /* Local variables */
-    static integer iscl;
-    static doublereal anrm;
-    static integer idum[1], ierr, itau, i__;
+    integer iscl;
+    doublereal anrm;
+    integer idum[1], ierr, itau, i__;
     extern /* Subroutine */ int dgemm_(char *, char *, integer *, integer *,
 	    integer *, doublereal *, doublereal *, integer *, doublereal *,
 	    integer *, doublereal *, doublereal *, integer *);
     extern logical lsame_(char *, char *);
-    static integer chunk, minmn, wrkbl, itaup, itauq, mnthr;
-    static logical wntqa;
-    static integer nwork;
-    static logical wntqn, wntqo, wntqs;
-    static integer ie;
+    integer chunk, minmn, wrkbl, itaup, itauq, mnthr;
+    logical wntqa;
+    integer nwork;
+    logical wntqn, wntqo, wntqs;
+    integer ie;
     extern /* Subroutine */ int dbdsdc_(char *, char *, integer *, doublereal
 	    *, doublereal *, doublereal *, integer *, doublereal *, integer *,
 	     doublereal *, integer *, doublereal *, integer *, integer *);
-    static integer il;
+    integer il;
     extern /* Subroutine */ int dgebrd_(integer *, integer *, doublereal *,
 	    integer *, doublereal *, doublereal *, doublereal *, doublereal *,
 	     doublereal *, integer *, integer *);
 
-    static integer ir, bdspac;
+    integer ir, bdspac;
     extern doublereal dlange_(char *, integer *, integer *, doublereal *,
 	    integer *, doublereal *);
-    static integer iu;
+    integer iu;
     extern /* Subroutine */ int dgelqf_(integer *, integer *, doublereal *,
 	    integer *, doublereal *, doublereal *, integer *, integer *),
 	    dlascl_(char *, integer *, integer *, doublereal *, doublereal *,
@@ -5150,19 +5150,19 @@ L10:
 	    doublereal *, integer *, integer *);
     extern integer ilaenv_(integer *, char *, char *, integer *, integer *,
 	    integer *, integer *, ftnlen, ftnlen);
-    static doublereal bignum;
+    doublereal bignum;
     extern /* Subroutine */ int dormbr_(char *, char *, char *, integer *,
 	    integer *, integer *, doublereal *, integer *, doublereal *,
 	    doublereal *, integer *, doublereal *, integer *, integer *), dorglq_(integer *, integer *, integer *,
 	    doublereal *, integer *, doublereal *, doublereal *, integer *,
 	    integer *), dorgqr_(integer *, integer *, integer *, doublereal *,
 	     integer *, doublereal *, doublereal *, integer *, integer *);
-    static integer ldwrkl, ldwrkr, minwrk, ldwrku, maxwrk, ldwkvt;
-    static doublereal smlnum;
-    static logical wntqas, lquery;
-    static integer blk;
-    static doublereal dum[1], eps;
-    static integer ivt;
+    integer ldwrkl, ldwrkr, minwrk, ldwrku, maxwrk, ldwkvt;
+    doublereal smlnum;
+    logical wntqas, lquery;
+    integer blk;
+    doublereal dum[1], eps;
+    integer ivt;
 
 
 /*
@@ -6966,14 +6966,14 @@ L10:
     extern /* Subroutine */ int dger_(integer *, integer *, doublereal *,
 	    doublereal *, integer *, doublereal *, integer *, doublereal *,
 	    integer *);
-    static integer i__, j;
+    integer i__, j;
     extern /* Subroutine */ int dscal_(integer *, doublereal *, doublereal *,
 	    integer *);
-    static doublereal sfmin;
+    doublereal sfmin;
     extern /* Subroutine */ int dswap_(integer *, doublereal *, integer *,
 	    doublereal *, integer *);
 
-    static integer jp;
+    integer jp;
     extern integer idamax_(integer *, doublereal *, integer *);
     extern /* Subroutine */ int xerbla_(char *, integer *);
 
@@ -7126,17 +7126,17 @@ L10:
     integer a_dim1, a_offset, i__1, i__2, i__3, i__4, i__5;
 
     /* Local variables */
-    static integer i__, j;
+    integer i__, j;
     extern /* Subroutine */ int dgemm_(char *, char *, integer *, integer *,
 	    integer *, doublereal *, doublereal *, integer *, doublereal *,
 	    integer *, doublereal *, doublereal *, integer *);
-    static integer iinfo;
+    integer iinfo;
     extern /* Subroutine */ int dtrsm_(char *, char *, char *, char *,
 	    integer *, integer *, doublereal *, doublereal *, integer *,
 	    doublereal *, integer *), dgetf2_(
 	    integer *, integer *, doublereal *, integer *, integer *, integer
 	    *);
-    static integer jb, nb;
+    integer jb, nb;
     extern /* Subroutine */ int xerbla_(char *, integer *);
     extern integer ilaenv_(integer *, char *, char *, integer *, integer *,
 	    integer *, integer *, ftnlen, ftnlen);
@@ -7323,7 +7323,7 @@ L10:
 	    doublereal *, integer *), xerbla_(
 	    char *, integer *), dlaswp_(integer *, doublereal *,
 	    integer *, integer *, integer *, integer *, integer *);
-    static logical notran;
+    logical notran;
 
 
 /*
@@ -7481,16 +7481,16 @@ L10:
     /* Subroutine */ int s_cat(char *, char **, integer *, integer *, ftnlen);
 
     /* Local variables */
-    static integer kbot, nmin, i__;
+    integer kbot, nmin, i__;
     extern logical lsame_(char *, char *);
-    static logical initz;
-    static doublereal workl[49];
-    static logical wantt, wantz;
+    logical initz;
+    doublereal workl[49];
+    logical wantt, wantz;
     extern /* Subroutine */ int dlaqr0_(logical *, logical *, integer *,
 	    integer *, integer *, doublereal *, integer *, doublereal *,
 	    doublereal *, integer *, integer *, doublereal *, integer *,
 	    doublereal *, integer *, integer *);
-    static doublereal hl[2401]	/* was [49][49] */;
+    doublereal hl[2401]	/* was [49][49] */;
     extern /* Subroutine */ int dlahqr_(logical *, logical *, integer *,
 	    integer *, integer *, doublereal *, integer *, doublereal *,
 	    doublereal *, integer *, integer *, doublereal *, integer *,
@@ -7501,7 +7501,7 @@ L10:
     extern integer ilaenv_(integer *, char *, char *, integer *, integer *,
 	    integer *, integer *, ftnlen, ftnlen);
     extern /* Subroutine */ int xerbla_(char *, integer *);
-    static logical lquery;
+    logical lquery;
 
 
 /*
@@ -7989,7 +7989,7 @@ L10:
 	    i__3;
 
     /* Local variables */
-    static integer i__;
+    integer i__;
     extern /* Subroutine */ int dscal_(integer *, doublereal *, doublereal *,
 	    integer *), dgemv_(char *, integer *, integer *, doublereal *,
 	    doublereal *, integer *, doublereal *, integer *, doublereal *,
@@ -8388,7 +8388,7 @@ L10:
     integer a_dim1, a_offset, b_dim1, b_offset, i__1, i__2;
 
     /* Local variables */
-    static integer i__, j;
+    integer i__, j;
     extern logical lsame_(char *, char *);
 
 
@@ -8486,7 +8486,7 @@ L10:
 /* Subroutine */ int dladiv_(doublereal *a, doublereal *b, doublereal *c__,
 	doublereal *d__, doublereal *p, doublereal *q)
 {
-    static doublereal e, f;
+    doublereal e, f;
 
 
 /*
@@ -8552,7 +8552,7 @@ L10:
     double sqrt(doublereal);
 
     /* Local variables */
-    static doublereal acmn, acmx, ab, df, tb, sm, rt, adf;
+    doublereal acmn, acmx, ab, df, tb, sm, rt, adf;
 
 
 /*
@@ -8681,35 +8681,35 @@ L10:
     integer pow_ii(integer *, integer *);
 
     /* Local variables */
-    static doublereal temp;
-    static integer curr, i__, j, k;
+    doublereal temp;
+    integer curr, i__, j, k;
     extern /* Subroutine */ int dgemm_(char *, char *, integer *, integer *,
 	    integer *, doublereal *, doublereal *, integer *, doublereal *,
 	    integer *, doublereal *, doublereal *, integer *);
-    static integer iperm;
+    integer iperm;
     extern /* Subroutine */ int dcopy_(integer *, doublereal *, integer *,
 	    doublereal *, integer *);
-    static integer indxq, iwrem;
+    integer indxq, iwrem;
     extern /* Subroutine */ int dlaed1_(integer *, doublereal *, doublereal *,
 	     integer *, integer *, doublereal *, integer *, doublereal *,
 	    integer *, integer *);
-    static integer iqptr;
+    integer iqptr;
     extern /* Subroutine */ int dlaed7_(integer *, integer *, integer *,
 	    integer *, integer *, integer *, doublereal *, doublereal *,
 	    integer *, integer *, doublereal *, integer *, doublereal *,
 	    integer *, integer *, integer *, integer *, integer *, doublereal
 	    *, doublereal *, integer *, integer *);
-    static integer tlvls, iq;
+    integer tlvls, iq;
     extern /* Subroutine */ int dlacpy_(char *, integer *, integer *,
 	    doublereal *, integer *, doublereal *, integer *);
-    static integer igivcl;
+    integer igivcl;
     extern /* Subroutine */ int xerbla_(char *, integer *);
     extern integer ilaenv_(integer *, char *, char *, integer *, integer *,
 	    integer *, integer *, ftnlen, ftnlen);
-    static integer igivnm, submat, curprb, subpbs, igivpt;
+    integer igivnm, submat, curprb, subpbs, igivpt;
     extern /* Subroutine */ int dsteqr_(char *, integer *, doublereal *,
 	    doublereal *, doublereal *, integer *, doublereal *, integer *);
-    static integer curlvl, matsiz, iprmpt, smlsiz, lgn, msd2, smm1, spm1,
+    integer curlvl, matsiz, iprmpt, smlsiz, lgn, msd2, smm1, spm1,
 	    spm2;
 
 
@@ -9094,10 +9094,10 @@ L140:
     integer q_dim1, q_offset, i__1, i__2;
 
     /* Local variables */
-    static integer indx, i__, k, indxc;
+    integer indx, i__, k, indxc;
     extern /* Subroutine */ int dcopy_(integer *, doublereal *, integer *,
 	    doublereal *, integer *);
-    static integer indxp;
+    integer indxp;
     extern /* Subroutine */ int dlaed2_(integer *, integer *, integer *,
 	    doublereal *, doublereal *, integer *, integer *, doublereal *,
 	    doublereal *, doublereal *, doublereal *, doublereal *, integer *,
@@ -9105,10 +9105,10 @@ L140:
 	    integer *, integer *, doublereal *, doublereal *, integer *,
 	    doublereal *, doublereal *, doublereal *, integer *, integer *,
 	    doublereal *, doublereal *, integer *);
-    static integer n1, n2, idlmda, is, iw, iz;
+    integer n1, n2, idlmda, is, iw, iz;
     extern /* Subroutine */ int dlamrg_(integer *, integer *, doublereal *,
 	    integer *, integer *, integer *), xerbla_(char *, integer *);
-    static integer coltyp, iq2, zpp1;
+    integer coltyp, iq2, zpp1;
 
 
 /*
@@ -9325,28 +9325,28 @@ L20:
     double sqrt(doublereal);
 
     /* Local variables */
-    static integer imax, jmax;
+    integer imax, jmax;
     extern /* Subroutine */ int drot_(integer *, doublereal *, integer *,
 	    doublereal *, integer *, doublereal *, doublereal *);
-    static integer ctot[4];
-    static doublereal c__;
-    static integer i__, j;
-    static doublereal s, t;
+    integer ctot[4];
+    doublereal c__;
+    integer i__, j;
+    doublereal s, t;
     extern /* Subroutine */ int dscal_(integer *, doublereal *, doublereal *,
 	    integer *), dcopy_(integer *, doublereal *, integer *, doublereal
 	    *, integer *);
-    static integer k2, n2;
+    integer k2, n2;
     extern doublereal dlapy2_(doublereal *, doublereal *);
-    static integer ct, nj;
+    integer ct, nj;
 
-    static integer pj, js;
+    integer pj, js;
     extern integer idamax_(integer *, doublereal *, integer *);
     extern /* Subroutine */ int dlamrg_(integer *, integer *, doublereal *,
 	    integer *, integer *, integer *), dlacpy_(char *, integer *,
 	    integer *, doublereal *, integer *, doublereal *, integer *), xerbla_(char *, integer *);
-    static integer iq1, iq2, n1p1;
-    static doublereal eps, tau, tol;
-    static integer psm[4];
+    integer iq1, iq2, n1p1;
+    doublereal eps, tau, tol;
+    integer psm[4];
 
 
 /*
@@ -9843,23 +9843,23 @@ L190:
     double sqrt(doublereal), d_sign(doublereal *, doublereal *);
 
     /* Local variables */
-    static doublereal temp;
+    doublereal temp;
     extern doublereal dnrm2_(integer *, doublereal *, integer *);
-    static integer i__, j;
+    integer i__, j;
     extern /* Subroutine */ int dgemm_(char *, char *, integer *, integer *,
 	    integer *, doublereal *, doublereal *, integer *, doublereal *,
 	    integer *, doublereal *, doublereal *, integer *),
 	     dcopy_(integer *, doublereal *, integer *, doublereal *, integer
 	    *), dlaed4_(integer *, integer *, doublereal *, doublereal *,
 	    doublereal *, doublereal *, doublereal *, integer *);
-    static integer n2;
+    integer n2;
     extern doublereal dlamc3_(doublereal *, doublereal *);
-    static integer n12, ii, n23;
+    integer n12, ii, n23;
     extern /* Subroutine */ int dlacpy_(char *, integer *, integer *,
 	    doublereal *, integer *, doublereal *, integer *),
 	    dlaset_(char *, integer *, integer *, doublereal *, doublereal *,
 	    doublereal *, integer *), xerbla_(char *, integer *);
-    static integer iq2;
+    integer iq2;
 
 
 /*
@@ -10152,26 +10152,26 @@ L120:
     double sqrt(doublereal);
 
     /* Local variables */
-    static doublereal dphi, dpsi;
-    static integer iter;
-    static doublereal temp, prew, temp1, a, b, c__;
-    static integer j;
-    static doublereal w, dltlb, dltub, midpt;
-    static integer niter;
-    static logical swtch;
+    doublereal dphi, dpsi;
+    integer iter;
+    doublereal temp, prew, temp1, a, b, c__;
+    integer j;
+    doublereal w, dltlb, dltub, midpt;
+    integer niter;
+    logical swtch;
     extern /* Subroutine */ int dlaed5_(integer *, doublereal *, doublereal *,
 	     doublereal *, doublereal *, doublereal *), dlaed6_(integer *,
 	    logical *, doublereal *, doublereal *, doublereal *, doublereal *,
 	     doublereal *, integer *);
-    static logical swtch3;
-    static integer ii;
+    logical swtch3;
+    integer ii;
 
-    static doublereal dw, zz[3];
-    static logical orgati;
-    static doublereal erretm, rhoinv;
-    static integer ip1;
-    static doublereal del, eta, phi, eps, tau, psi;
-    static integer iim1, iip1;
+    doublereal dw, zz[3];
+    logical orgati;
+    doublereal erretm, rhoinv;
+    integer ip1;
+    doublereal del, eta, phi, eps, tau, psi;
+    integer iim1, iip1;
 
 
 /*
@@ -11096,7 +11096,7 @@ L250:
     double sqrt(doublereal);
 
     /* Local variables */
-    static doublereal temp, b, c__, w, del, tau;
+    doublereal temp, b, c__, w, del, tau;
 
 
 /*
@@ -11223,15 +11223,15 @@ L250:
     double sqrt(doublereal), log(doublereal), pow_di(doublereal *, integer *);
 
     /* Local variables */
-    static doublereal base;
-    static integer iter;
-    static doublereal temp, temp1, temp2, temp3, temp4, a, b, c__, f;
-    static integer i__;
-    static logical scale;
-    static integer niter;
-    static doublereal small1, small2, fc, df, sminv1, sminv2;
-
-    static doublereal dscale[3], sclfac, zscale[3], erretm, sclinv, ddf, lbd,
+    doublereal base;
+    integer iter;
+    doublereal temp, temp1, temp2, temp3, temp4, a, b, c__, f;
+    integer i__;
+    logical scale;
+    integer niter;
+    doublereal small1, small2, fc, df, sminv1, sminv2;
+
+    doublereal dscale[3], sclfac, zscale[3], erretm, sclinv, ddf, lbd,
 	    eta, ubd, eps;
 
 
@@ -11578,11 +11578,11 @@ L60:
     integer pow_ii(integer *, integer *);
 
     /* Local variables */
-    static integer indx, curr, i__, k;
+    integer indx, curr, i__, k;
     extern /* Subroutine */ int dgemm_(char *, char *, integer *, integer *,
 	    integer *, doublereal *, doublereal *, integer *, doublereal *,
 	    integer *, doublereal *, doublereal *, integer *);
-    static integer indxc, indxp, n1, n2;
+    integer indxc, indxp, n1, n2;
     extern /* Subroutine */ int dlaed8_(integer *, integer *, integer *,
 	    integer *, doublereal *, doublereal *, integer *, integer *,
 	    doublereal *, integer *, doublereal *, doublereal *, doublereal *,
@@ -11594,10 +11594,10 @@ L60:
 	    integer *, integer *, integer *, integer *, integer *, doublereal
 	    *, doublereal *, integer *, doublereal *, doublereal *, integer *)
 	    ;
-    static integer idlmda, is, iw, iz;
+    integer idlmda, is, iw, iz;
     extern /* Subroutine */ int dlamrg_(integer *, integer *, doublereal *,
 	    integer *, integer *, integer *), xerbla_(char *, integer *);
-    static integer coltyp, iq2, ptr, ldq2;
+    integer coltyp, iq2, ptr, ldq2;
 
 
 /*
@@ -11906,24 +11906,24 @@ L30:
     double sqrt(doublereal);
 
     /* Local variables */
-    static integer jlam, imax, jmax;
+    integer jlam, imax, jmax;
     extern /* Subroutine */ int drot_(integer *, doublereal *, integer *,
 	    doublereal *, integer *, doublereal *, doublereal *);
-    static doublereal c__;
-    static integer i__, j;
-    static doublereal s, t;
+    doublereal c__;
+    integer i__, j;
+    doublereal s, t;
     extern /* Subroutine */ int dscal_(integer *, doublereal *, doublereal *,
 	    integer *), dcopy_(integer *, doublereal *, integer *, doublereal
 	    *, integer *);
-    static integer k2, n1, n2;
+    integer k2, n1, n2;
 
-    static integer jp;
+    integer jp;
     extern integer idamax_(integer *, doublereal *, integer *);
     extern /* Subroutine */ int dlamrg_(integer *, integer *, doublereal *,
 	    integer *, integer *, integer *), dlacpy_(char *, integer *,
 	    integer *, doublereal *, integer *, doublereal *, integer *), xerbla_(char *, integer *);
-    static integer n1p1;
-    static doublereal eps, tau, tol;
+    integer n1p1;
+    doublereal eps, tau, tol;
 
 
 /*
@@ -12359,9 +12359,9 @@ L110:
     double sqrt(doublereal), d_sign(doublereal *, doublereal *);
 
     /* Local variables */
-    static doublereal temp;
+    doublereal temp;
     extern doublereal dnrm2_(integer *, doublereal *, integer *);
-    static integer i__, j;
+    integer i__, j;
     extern /* Subroutine */ int dcopy_(integer *, doublereal *, integer *,
 	    doublereal *, integer *), dlaed4_(integer *, integer *,
 	    doublereal *, doublereal *, doublereal *, doublereal *,
@@ -12608,13 +12608,13 @@ L120:
     /* Local variables */
     extern /* Subroutine */ int drot_(integer *, doublereal *, integer *,
 	    doublereal *, integer *, doublereal *, doublereal *);
-    static integer curr, bsiz1, bsiz2, psiz1, psiz2, i__, k, zptr1;
+    integer curr, bsiz1, bsiz2, psiz1, psiz2, i__, k, zptr1;
     extern /* Subroutine */ int dgemv_(char *, integer *, integer *,
 	    doublereal *, doublereal *, integer *, doublereal *, integer *,
 	    doublereal *, doublereal *, integer *), dcopy_(integer *,
 	    doublereal *, integer *, doublereal *, integer *), xerbla_(char *,
 	     integer *);
-    static integer mid, ptr;
+    integer mid, ptr;
 
 
 /*
@@ -12866,8 +12866,8 @@ L120:
     double sqrt(doublereal);
 
     /* Local variables */
-    static doublereal acmn, acmx, ab, df, cs, ct, tb, sm, tn, rt, adf, acs;
-    static integer sgn1, sgn2;
+    doublereal acmn, acmx, ab, df, cs, ct, tb, sm, tn, rt, adf, acs;
+    integer sgn1, sgn2;
 
 
 /*
@@ -13035,36 +13035,36 @@ L120:
     doublereal d__1, d__2, d__3;
 
     /* Local variables */
-    static integer ierr;
-    static doublereal temp;
+    integer ierr;
+    doublereal temp;
     extern /* Subroutine */ int drot_(integer *, doublereal *, integer *,
 	    doublereal *, integer *, doublereal *, doublereal *);
-    static doublereal d__[16]	/* was [4][4] */;
-    static integer k;
-    static doublereal u[3], scale, x[4]	/* was [2][2] */, dnorm;
-    static integer j2, j3, j4;
-    static doublereal xnorm, u1[3], u2[3];
+    doublereal d__[16]	/* was [4][4] */;
+    integer k;
+    doublereal u[3], scale, x[4]	/* was [2][2] */, dnorm;
+    integer j2, j3, j4;
+    doublereal xnorm, u1[3], u2[3];
     extern /* Subroutine */ int dlanv2_(doublereal *, doublereal *,
 	    doublereal *, doublereal *, doublereal *, doublereal *,
 	    doublereal *, doublereal *, doublereal *, doublereal *), dlasy2_(
 	    logical *, logical *, integer *, integer *, integer *, doublereal
 	    *, integer *, doublereal *, integer *, doublereal *, integer *,
 	    doublereal *, doublereal *, integer *, doublereal *, integer *);
-    static integer nd;
-    static doublereal cs, t11, t22;
+    integer nd;
+    doublereal cs, t11, t22;
 
-    static doublereal t33;
+    doublereal t33;
     extern doublereal dlange_(char *, integer *, integer *, doublereal *,
 	    integer *, doublereal *);
     extern /* Subroutine */ int dlarfg_(integer *, doublereal *, doublereal *,
 	     integer *, doublereal *);
-    static doublereal sn;
+    doublereal sn;
     extern /* Subroutine */ int dlacpy_(char *, integer *, integer *,
 	    doublereal *, integer *, doublereal *, integer *),
 	    dlartg_(doublereal *, doublereal *, doublereal *, doublereal *,
 	    doublereal *), dlarfx_(char *, integer *, integer *, doublereal *,
 	     doublereal *, doublereal *, integer *, doublereal *);
-    static doublereal thresh, smlnum, wi1, wi2, wr1, wr2, eps, tau, tau1,
+    doublereal thresh, smlnum, wi1, wi2, wr1, wr2, eps, tau, tau1,
 	    tau2;
 
 
@@ -13481,29 +13481,29 @@ L50:
     /* Local variables */
     extern /* Subroutine */ int drot_(integer *, doublereal *, integer *,
 	    doublereal *, integer *, doublereal *, doublereal *);
-    static integer i__, j, k, l, m;
-    static doublereal s, v[3];
+    integer i__, j, k, l, m;
+    doublereal s, v[3];
     extern /* Subroutine */ int dcopy_(integer *, doublereal *, integer *,
 	    doublereal *, integer *);
-    static integer i1, i2;
-    static doublereal t1, t2, t3, v2, v3;
+    integer i1, i2;
+    doublereal t1, t2, t3, v2, v3;
     extern /* Subroutine */ int dlanv2_(doublereal *, doublereal *,
 	    doublereal *, doublereal *, doublereal *, doublereal *,
 	    doublereal *, doublereal *, doublereal *, doublereal *);
-    static doublereal aa, ab, ba, bb;
+    doublereal aa, ab, ba, bb;
     extern /* Subroutine */ int dlabad_(doublereal *, doublereal *);
-    static doublereal h11, h12, h21, h22, cs;
-    static integer nh;
+    doublereal h11, h12, h21, h22, cs;
+    integer nh;
 
     extern /* Subroutine */ int dlarfg_(integer *, doublereal *, doublereal *,
 	     integer *, doublereal *);
-    static doublereal sn;
-    static integer nr;
-    static doublereal tr;
-    static integer nz;
-    static doublereal safmin, safmax, rtdisc, smlnum, det, h21s;
-    static integer its;
-    static doublereal ulp, sum, tst, rt1i, rt2i, rt1r, rt2r;
+    doublereal sn;
+    integer nr;
+    doublereal tr;
+    integer nz;
+    doublereal safmin, safmax, rtdisc, smlnum, det, h21s;
+    integer its;
+    doublereal ulp, sum, tst, rt1i, rt2i, rt1r, rt2r;
 
 
 /*
@@ -14088,7 +14088,7 @@ L160:
     doublereal d__1;
 
     /* Local variables */
-    static integer i__;
+    integer i__;
     extern /* Subroutine */ int dscal_(integer *, doublereal *, doublereal *,
 	    integer *), dgemm_(char *, char *, integer *, integer *, integer *
 	    , doublereal *, doublereal *, integer *, doublereal *, integer *,
@@ -14101,7 +14101,7 @@ L160:
 	    doublereal *, doublereal *, integer *, doublereal *, integer *),
 	    dtrmv_(char *, char *, char *, integer *, doublereal *, integer *,
 	     doublereal *, integer *);
-    static doublereal ei;
+    doublereal ei;
     extern /* Subroutine */ int dlarfg_(integer *, doublereal *, doublereal *,
 	     integer *, doublereal *), dlacpy_(char *, integer *, integer *,
 	    doublereal *, integer *, doublereal *, integer *);
@@ -14383,23 +14383,23 @@ L160:
     /* System generated locals */
     integer a_dim1, a_offset, b_dim1, b_offset, x_dim1, x_offset;
     doublereal d__1, d__2, d__3, d__4, d__5, d__6;
-    static doublereal equiv_0[4], equiv_1[4];
+    doublereal equiv_0[4], equiv_1[4];
 
     /* Local variables */
-    static doublereal bbnd, cmax, ui11r, ui12s, temp, ur11r, ur12s;
-    static integer j;
-    static doublereal u22abs;
-    static integer icmax;
-    static doublereal bnorm, cnorm, smini;
+    doublereal bbnd, cmax, ui11r, ui12s, temp, ur11r, ur12s;
+    integer j;
+    doublereal u22abs;
+    integer icmax;
+    doublereal bnorm, cnorm, smini;
 #define ci (equiv_0)
 #define cr (equiv_1)
 
     extern /* Subroutine */ int dladiv_(doublereal *, doublereal *,
 	    doublereal *, doublereal *, doublereal *, doublereal *);
-    static doublereal bignum, bi1, bi2, br1, br2, smlnum, xi1, xi2, xr1, xr2,
+    doublereal bignum, bi1, bi2, br1, br2, smlnum, xi1, xi2, xr1, xr2,
 	    ci21, ci22, cr21, cr22, li21, csi, ui11, lr21, ui12, ui22;
 #define civ (equiv_0)
-    static doublereal csr, ur11, ur12, ur22;
+    doublereal csr, ur11, ur12, ur22;
 #define crv (equiv_1)
 
 
@@ -14934,27 +14934,27 @@ L160:
     doublereal d__1;
 
     /* Local variables */
-    static doublereal temp;
+    doublereal temp;
     extern /* Subroutine */ int drot_(integer *, doublereal *, integer *,
 	    doublereal *, integer *, doublereal *, doublereal *);
     extern doublereal dnrm2_(integer *, doublereal *, integer *);
-    static integer i__, j, m, n;
+    integer i__, j, m, n;
     extern /* Subroutine */ int dscal_(integer *, doublereal *, doublereal *,
 	    integer *);
-    static doublereal diflj, difrj, dsigj;
+    doublereal diflj, difrj, dsigj;
     extern /* Subroutine */ int dgemv_(char *, integer *, integer *,
 	    doublereal *, doublereal *, integer *, doublereal *, integer *,
 	    doublereal *, doublereal *, integer *), dcopy_(integer *,
 	    doublereal *, integer *, doublereal *, integer *);
     extern doublereal dlamc3_(doublereal *, doublereal *);
-    static doublereal dj;
+    doublereal dj;
     extern /* Subroutine */ int dlascl_(char *, integer *, integer *,
 	    doublereal *, doublereal *, integer *, integer *, doublereal *,
 	    integer *, integer *), dlacpy_(char *, integer *, integer
 	    *, doublereal *, integer *, doublereal *, integer *),
 	    xerbla_(char *, integer *);
-    static doublereal dsigjp;
-    static integer nlp1;
+    doublereal dsigjp;
+    integer nlp1;
 
 
 /*
@@ -15385,25 +15385,25 @@ L160:
     integer pow_ii(integer *, integer *);
 
     /* Local variables */
-    static integer nlvl, sqre, i__, j;
+    integer nlvl, sqre, i__, j;
     extern /* Subroutine */ int dgemm_(char *, char *, integer *, integer *,
 	    integer *, doublereal *, doublereal *, integer *, doublereal *,
 	    integer *, doublereal *, doublereal *, integer *);
-    static integer inode, ndiml, ndimr;
+    integer inode, ndiml, ndimr;
     extern /* Subroutine */ int dcopy_(integer *, doublereal *, integer *,
 	    doublereal *, integer *);
-    static integer i1;
+    integer i1;
     extern /* Subroutine */ int dlals0_(integer *, integer *, integer *,
 	    integer *, integer *, doublereal *, integer *, doublereal *,
 	    integer *, integer *, integer *, integer *, integer *, doublereal
 	    *, integer *, doublereal *, doublereal *, doublereal *,
 	    doublereal *, integer *, doublereal *, doublereal *, doublereal *,
 	     integer *);
-    static integer ic, lf, nd, ll, nl, nr;
+    integer ic, lf, nd, ll, nl, nr;
     extern /* Subroutine */ int dlasdt_(integer *, integer *, integer *,
 	    integer *, integer *, integer *, integer *), xerbla_(char *,
 	    integer *);
-    static integer im1, nlf, nrf, lvl, ndb1, nlp1, lvl2, nrp1;
+    integer im1, nlf, nrf, lvl, ndb1, nlp1, lvl2, nrp1;
 
 
 /*
@@ -15829,22 +15829,22 @@ L90:
     double log(doublereal), d_sign(doublereal *, doublereal *);
 
     /* Local variables */
-    static integer difl, difr;
-    static doublereal rcnd;
-    static integer perm, nsub;
+    integer difl, difr;
+    doublereal rcnd;
+    integer perm, nsub;
     extern /* Subroutine */ int drot_(integer *, doublereal *, integer *,
 	    doublereal *, integer *, doublereal *, doublereal *);
-    static integer nlvl, sqre, bxst, c__, i__, j, k;
-    static doublereal r__;
-    static integer s, u;
+    integer nlvl, sqre, bxst, c__, i__, j, k;
+    doublereal r__;
+    integer s, u;
     extern /* Subroutine */ int dgemm_(char *, char *, integer *, integer *,
 	    integer *, doublereal *, doublereal *, integer *, doublereal *,
 	    integer *, doublereal *, doublereal *, integer *);
-    static integer z__;
+    integer z__;
     extern /* Subroutine */ int dcopy_(integer *, doublereal *, integer *,
 	    doublereal *, integer *);
-    static integer poles, sizei, nsize, nwork, icmpq1, icmpq2;
-    static doublereal cs;
+    integer poles, sizei, nsize, nwork, icmpq1, icmpq2;
+    doublereal cs;
 
     extern /* Subroutine */ int dlasda_(integer *, integer *, integer *,
 	    integer *, doublereal *, doublereal *, doublereal *, integer *,
@@ -15852,39 +15852,39 @@ L90:
 	     doublereal *, integer *, integer *, integer *, integer *,
 	    doublereal *, doublereal *, doublereal *, doublereal *, integer *,
 	     integer *);
-    static integer bx;
+    integer bx;
     extern /* Subroutine */ int dlalsa_(integer *, integer *, integer *,
 	    integer *, doublereal *, integer *, doublereal *, integer *,
 	    doublereal *, integer *, doublereal *, integer *, doublereal *,
 	    doublereal *, doublereal *, doublereal *, integer *, integer *,
 	    integer *, integer *, doublereal *, doublereal *, doublereal *,
 	    doublereal *, integer *, integer *);
-    static doublereal sn;
+    doublereal sn;
     extern /* Subroutine */ int dlascl_(char *, integer *, integer *,
 	    doublereal *, doublereal *, integer *, integer *, doublereal *,
 	    integer *, integer *);
     extern integer idamax_(integer *, doublereal *, integer *);
-    static integer st;
+    integer st;
     extern /* Subroutine */ int dlasdq_(char *, integer *, integer *, integer
 	    *, integer *, integer *, doublereal *, doublereal *, doublereal *,
 	     integer *, doublereal *, integer *, doublereal *, integer *,
 	    doublereal *, integer *);
-    static integer vt;
+    integer vt;
     extern /* Subroutine */ int dlacpy_(char *, integer *, integer *,
 	    doublereal *, integer *, doublereal *, integer *),
 	    dlartg_(doublereal *, doublereal *, doublereal *, doublereal *,
 	    doublereal *), dlaset_(char *, integer *, integer *, doublereal *,
 	     doublereal *, doublereal *, integer *), xerbla_(char *,
 	    integer *);
-    static integer givcol;
+    integer givcol;
     extern doublereal dlanst_(char *, integer *, doublereal *, doublereal *);
     extern /* Subroutine */ int dlasrt_(char *, integer *, doublereal *,
 	    integer *);
-    static doublereal orgnrm;
-    static integer givnum, givptr, nm1, smlszp, st1;
-    static doublereal eps;
-    static integer iwk;
-    static doublereal tol;
+    doublereal orgnrm;
+    integer givnum, givptr, nm1, smlszp, st1;
+    doublereal eps;
+    integer iwk;
+    doublereal tol;
 
 
 /*
@@ -16334,7 +16334,7 @@ L90:
     integer i__1;
 
     /* Local variables */
-    static integer i__, ind1, ind2, n1sv, n2sv;
+    integer i__, ind1, ind2, n1sv, n2sv;
 
 
 /*
@@ -16450,13 +16450,13 @@ doublereal dlange_(char *norm, integer *m, integer *n, doublereal *a, integer
     double sqrt(doublereal);
 
     /* Local variables */
-    static integer i__, j;
-    static doublereal scale;
+    integer i__, j;
+    doublereal scale;
     extern logical lsame_(char *, char *);
-    static doublereal value;
+    doublereal value;
     extern /* Subroutine */ int dlassq_(integer *, doublereal *, integer *,
 	    doublereal *, doublereal *);
-    static doublereal sum;
+    doublereal sum;
 
 
 /*
@@ -16618,13 +16618,13 @@ doublereal dlanst_(char *norm, integer *n, doublereal *d__, doublereal *e)
     double sqrt(doublereal);
 
     /* Local variables */
-    static integer i__;
-    static doublereal scale;
+    integer i__;
+    doublereal scale;
     extern logical lsame_(char *, char *);
-    static doublereal anorm;
+    doublereal anorm;
     extern /* Subroutine */ int dlassq_(integer *, doublereal *, integer *,
 	    doublereal *, doublereal *);
-    static doublereal sum;
+    doublereal sum;
 
 
 /*
@@ -16755,14 +16755,14 @@ doublereal dlansy_(char *norm, char *uplo, integer *n, doublereal *a, integer
     double sqrt(doublereal);
 
     /* Local variables */
-    static doublereal absa;
-    static integer i__, j;
-    static doublereal scale;
+    doublereal absa;
+    integer i__, j;
+    doublereal scale;
     extern logical lsame_(char *, char *);
-    static doublereal value;
+    doublereal value;
     extern /* Subroutine */ int dlassq_(integer *, doublereal *, integer *,
 	    doublereal *, doublereal *);
-    static doublereal sum;
+    doublereal sum;
 
 
 /*
@@ -16965,11 +16965,11 @@ doublereal dlansy_(char *norm, char *uplo, integer *n, doublereal *a, integer
     double d_sign(doublereal *, doublereal *), sqrt(doublereal);
 
     /* Local variables */
-    static doublereal temp, p, scale, bcmax, z__, bcmis, sigma;
+    doublereal temp, p, scale, bcmax, z__, bcmis, sigma;
     extern doublereal dlapy2_(doublereal *, doublereal *);
-    static doublereal aa, bb, cc, dd;
+    doublereal aa, bb, cc, dd;
 
-    static doublereal cs1, sn1, sab, sac, eps, tau;
+    doublereal cs1, sn1, sab, sac, eps, tau;
 
 
 /*
@@ -17181,7 +17181,7 @@ doublereal dlapy2_(doublereal *x, doublereal *y)
     double sqrt(doublereal);
 
     /* Local variables */
-    static doublereal xabs, yabs, w, z__;
+    doublereal xabs, yabs, w, z__;
 
 
 /*
@@ -17234,13 +17234,13 @@ doublereal dlapy2_(doublereal *x, doublereal *y)
     doublereal d__1, d__2, d__3, d__4;
 
     /* Local variables */
-    static integer ndfl, kbot, nmin;
-    static doublereal swap;
-    static integer ktop;
-    static doublereal zdum[1]	/* was [1][1] */;
-    static integer kacc22, i__, k;
-    static logical nwinc;
-    static integer itmax, nsmax, nwmax, kwtop;
+    integer ndfl, kbot, nmin;
+    doublereal swap;
+    integer ktop;
+    doublereal zdum[1]	/* was [1][1] */;
+    integer kacc22, i__, k;
+    logical nwinc;
+    integer itmax, nsmax, nwmax, kwtop;
     extern /* Subroutine */ int dlanv2_(doublereal *, doublereal *,
 	    doublereal *, doublereal *, doublereal *, doublereal *,
 	    doublereal *, doublereal *, doublereal *, doublereal *), dlaqr3_(
@@ -17258,14 +17258,14 @@ doublereal dlapy2_(doublereal *x, doublereal *y)
 	    integer *, doublereal *, integer *, doublereal *, integer *,
 	    integer *, doublereal *, integer *, integer *, doublereal *,
 	    integer *);
-    static doublereal aa, bb, cc, dd;
-    static integer ld;
-    static doublereal cs;
-    static integer nh, nibble, it, ks, kt;
-    static doublereal sn;
-    static integer ku, kv, ls, ns;
-    static doublereal ss;
-    static integer nw;
+    doublereal aa, bb, cc, dd;
+    integer ld;
+    doublereal cs;
+    integer nh, nibble, it, ks, kt;
+    doublereal sn;
+    integer ku, kv, ls, ns;
+    doublereal ss;
+    integer nw;
     extern /* Subroutine */ int dlahqr_(logical *, logical *, integer *,
 	    integer *, integer *, doublereal *, integer *, doublereal *,
 	    doublereal *, integer *, integer *, doublereal *, integer *,
@@ -17273,9 +17273,9 @@ doublereal dlapy2_(doublereal *x, doublereal *y)
 	    integer *, doublereal *, integer *);
     extern integer ilaenv_(integer *, char *, char *, integer *, integer *,
 	    integer *, integer *, ftnlen, ftnlen);
-    static char jbcmpz[2];
-    static logical sorted;
-    static integer lwkopt, inf, kdu, nho, nve, kwh, nsr, nwr, kwv;
+    char jbcmpz[2];
+    logical sorted;
+    integer lwkopt, inf, kdu, nho, nve, kwh, nsr, nwr, kwv;
 
 
 /*
@@ -18011,7 +18011,7 @@ L90:
     doublereal d__1, d__2, d__3;
 
     /* Local variables */
-    static doublereal s, h21s, h31s;
+    doublereal s, h21s, h31s;
 
 
 /*
@@ -18122,50 +18122,50 @@ L90:
     double sqrt(doublereal);
 
     /* Local variables */
-    static doublereal beta;
-    static integer kend, kcol, info, ifst, ilst, ltop, krow, i__, j, k;
-    static doublereal s;
+    doublereal beta;
+    integer kend, kcol, info, ifst, ilst, ltop, krow, i__, j, k;
+    doublereal s;
     extern /* Subroutine */ int dlarf_(char *, integer *, integer *,
 	    doublereal *, integer *, doublereal *, doublereal *, integer *,
 	    doublereal *), dgemm_(char *, char *, integer *, integer *
 	    , integer *, doublereal *, doublereal *, integer *, doublereal *,
 	    integer *, doublereal *, doublereal *, integer *);
-    static logical bulge;
+    logical bulge;
     extern /* Subroutine */ int dcopy_(integer *, doublereal *, integer *,
 	    doublereal *, integer *);
-    static integer infqr, kwtop;
+    integer infqr, kwtop;
     extern /* Subroutine */ int dlanv2_(doublereal *, doublereal *,
 	    doublereal *, doublereal *, doublereal *, doublereal *,
 	    doublereal *, doublereal *, doublereal *, doublereal *);
-    static doublereal aa, bb, cc;
+    doublereal aa, bb, cc;
     extern /* Subroutine */ int dlabad_(doublereal *, doublereal *);
-    static doublereal dd, cs;
+    doublereal dd, cs;
 
     extern /* Subroutine */ int dgehrd_(integer *, integer *, integer *,
 	    doublereal *, integer *, doublereal *, doublereal *, integer *,
 	    integer *), dlarfg_(integer *, doublereal *, doublereal *,
 	    integer *, doublereal *);
-    static doublereal sn;
-    static integer jw;
+    doublereal sn;
+    integer jw;
     extern /* Subroutine */ int dlahqr_(logical *, logical *, integer *,
 	    integer *, integer *, doublereal *, integer *, doublereal *,
 	    doublereal *, integer *, integer *, doublereal *, integer *,
 	    integer *), dlacpy_(char *, integer *, integer *, doublereal *,
 	    integer *, doublereal *, integer *);
-    static doublereal safmin, safmax;
+    doublereal safmin, safmax;
     extern /* Subroutine */ int dlaset_(char *, integer *, integer *,
 	    doublereal *, doublereal *, doublereal *, integer *),
 	    dorghr_(integer *, integer *, integer *, doublereal *, integer *,
 	    doublereal *, doublereal *, integer *, integer *), dtrexc_(char *,
 	     integer *, doublereal *, integer *, doublereal *, integer *,
 	    integer *, integer *, doublereal *, integer *);
-    static logical sorted;
-    static doublereal smlnum;
-    static integer lwkopt;
-    static doublereal evi, evk, foo;
-    static integer kln;
-    static doublereal tau, ulp;
-    static integer lwk1, lwk2;
+    logical sorted;
+    doublereal smlnum;
+    integer lwkopt;
+    doublereal evi, evk, foo;
+    integer kln;
+    doublereal tau, ulp;
+    integer lwk1, lwk2;
 
 
 /*
@@ -18805,40 +18805,40 @@ L60:
     double sqrt(doublereal);
 
     /* Local variables */
-    static doublereal beta;
-    static integer kend, kcol, info, nmin, ifst, ilst, ltop, krow, i__, j, k;
-    static doublereal s;
+    doublereal beta;
+    integer kend, kcol, info, nmin, ifst, ilst, ltop, krow, i__, j, k;
+    doublereal s;
     extern /* Subroutine */ int dlarf_(char *, integer *, integer *,
 	    doublereal *, integer *, doublereal *, doublereal *, integer *,
 	    doublereal *), dgemm_(char *, char *, integer *, integer *
 	    , integer *, doublereal *, doublereal *, integer *, doublereal *,
 	    integer *, doublereal *, doublereal *, integer *);
-    static logical bulge;
+    logical bulge;
     extern /* Subroutine */ int dcopy_(integer *, doublereal *, integer *,
 	    doublereal *, integer *);
-    static integer infqr, kwtop;
+    integer infqr, kwtop;
     extern /* Subroutine */ int dlanv2_(doublereal *, doublereal *,
 	    doublereal *, doublereal *, doublereal *, doublereal *,
 	    doublereal *, doublereal *, doublereal *, doublereal *), dlaqr4_(
 	    logical *, logical *, integer *, integer *, integer *, doublereal
 	    *, integer *, doublereal *, doublereal *, integer *, integer *,
 	    doublereal *, integer *, doublereal *, integer *, integer *);
-    static doublereal aa, bb, cc;
+    doublereal aa, bb, cc;
     extern /* Subroutine */ int dlabad_(doublereal *, doublereal *);
-    static doublereal dd, cs;
+    doublereal dd, cs;
 
     extern /* Subroutine */ int dgehrd_(integer *, integer *, integer *,
 	    doublereal *, integer *, doublereal *, doublereal *, integer *,
 	    integer *), dlarfg_(integer *, doublereal *, doublereal *,
 	    integer *, doublereal *);
-    static doublereal sn;
-    static integer jw;
+    doublereal sn;
+    integer jw;
     extern /* Subroutine */ int dlahqr_(logical *, logical *, integer *,
 	    integer *, integer *, doublereal *, integer *, doublereal *,
 	    doublereal *, integer *, integer *, doublereal *, integer *,
 	    integer *), dlacpy_(char *, integer *, integer *, doublereal *,
 	    integer *, doublereal *, integer *);
-    static doublereal safmin, safmax;
+    doublereal safmin, safmax;
     extern integer ilaenv_(integer *, char *, char *, integer *, integer *,
 	    integer *, integer *, ftnlen, ftnlen);
     extern /* Subroutine */ int dlaset_(char *, integer *, integer *,
@@ -18847,13 +18847,13 @@ L60:
 	    doublereal *, doublereal *, integer *, integer *), dtrexc_(char *,
 	     integer *, doublereal *, integer *, doublereal *, integer *,
 	    integer *, integer *, doublereal *, integer *);
-    static logical sorted;
-    static doublereal smlnum;
-    static integer lwkopt;
-    static doublereal evi, evk, foo;
-    static integer kln;
-    static doublereal tau, ulp;
-    static integer lwk1, lwk2, lwk3;
+    logical sorted;
+    doublereal smlnum;
+    integer lwkopt;
+    doublereal evi, evk, foo;
+    integer kln;
+    doublereal tau, ulp;
+    integer lwk1, lwk2, lwk3;
 
 
 /*
@@ -19502,13 +19502,13 @@ L60:
     doublereal d__1, d__2, d__3, d__4;
 
     /* Local variables */
-    static integer ndfl, kbot, nmin;
-    static doublereal swap;
-    static integer ktop;
-    static doublereal zdum[1]	/* was [1][1] */;
-    static integer kacc22, i__, k;
-    static logical nwinc;
-    static integer itmax, nsmax, nwmax, kwtop;
+    integer ndfl, kbot, nmin;
+    doublereal swap;
+    integer ktop;
+    doublereal zdum[1]	/* was [1][1] */;
+    integer kacc22, i__, k;
+    logical nwinc;
+    integer itmax, nsmax, nwmax, kwtop;
     extern /* Subroutine */ int dlaqr2_(logical *, logical *, integer *,
 	    integer *, integer *, integer *, doublereal *, integer *, integer
 	    *, integer *, doublereal *, integer *, integer *, integer *,
@@ -19522,14 +19522,14 @@ L60:
 	    integer *, integer *, doublereal *, integer *, doublereal *,
 	    integer *, doublereal *, integer *, integer *, doublereal *,
 	    integer *, integer *, doublereal *, integer *);
-    static doublereal aa, bb, cc, dd;
-    static integer ld;
-    static doublereal cs;
-    static integer nh, nibble, it, ks, kt;
-    static doublereal sn;
-    static integer ku, kv, ls, ns;
-    static doublereal ss;
-    static integer nw;
+    doublereal aa, bb, cc, dd;
+    integer ld;
+    doublereal cs;
+    integer nh, nibble, it, ks, kt;
+    doublereal sn;
+    integer ku, kv, ls, ns;
+    doublereal ss;
+    integer nw;
     extern /* Subroutine */ int dlahqr_(logical *, logical *, integer *,
 	    integer *, integer *, doublereal *, integer *, doublereal *,
 	    doublereal *, integer *, integer *, doublereal *, integer *,
@@ -19537,9 +19537,9 @@ L60:
 	    integer *, doublereal *, integer *);
     extern integer ilaenv_(integer *, char *, char *, integer *, integer *,
 	    integer *, integer *, ftnlen, ftnlen);
-    static char jbcmpz[2];
-    static logical sorted;
-    static integer lwkopt, inf, kdu, nho, nve, kwh, nsr, nwr, kwv;
+    char jbcmpz[2];
+    logical sorted;
+    integer lwkopt, inf, kdu, nho, nve, kwh, nsr, nwr, kwv;
 
 
 /*
@@ -20278,43 +20278,43 @@ L90:
     doublereal d__1, d__2, d__3, d__4;
 
     /* Local variables */
-    static doublereal beta;
-    static logical blk22, bmp22;
-    static integer mend, jcol, jlen, jbot, mbot;
-    static doublereal swap;
-    static integer jtop, jrow, mtop, i__, j, k, m;
-    static doublereal alpha;
-    static logical accum;
+    doublereal beta;
+    logical blk22, bmp22;
+    integer mend, jcol, jlen, jbot, mbot;
+    doublereal swap;
+    integer jtop, jrow, mtop, i__, j, k, m;
+    doublereal alpha;
+    logical accum;
     extern /* Subroutine */ int dgemm_(char *, char *, integer *, integer *,
 	    integer *, doublereal *, doublereal *, integer *, doublereal *,
 	    integer *, doublereal *, doublereal *, integer *);
-    static integer ndcol, incol, krcol, nbmps;
+    integer ndcol, incol, krcol, nbmps;
     extern /* Subroutine */ int dtrmm_(char *, char *, char *, char *,
 	    integer *, integer *, doublereal *, doublereal *, integer *,
 	    doublereal *, integer *);
-    static integer i2, j2, i4, j4, k1;
+    integer i2, j2, i4, j4, k1;
     extern /* Subroutine */ int dlaqr1_(integer *, doublereal *, integer *,
 	    doublereal *, doublereal *, doublereal *, doublereal *,
 	    doublereal *), dlabad_(doublereal *, doublereal *);
-    static doublereal h11, h12, h21, h22;
-    static integer m22;
+    doublereal h11, h12, h21, h22;
+    integer m22;
 
     extern /* Subroutine */ int dlarfg_(integer *, doublereal *, doublereal *,
 	     integer *, doublereal *);
-    static integer ns, nu;
-    static doublereal vt[3];
+    integer ns, nu;
+    doublereal vt[3];
     extern /* Subroutine */ int dlacpy_(char *, integer *, integer *,
 	    doublereal *, integer *, doublereal *, integer *);
-    static doublereal safmin, safmax;
+    doublereal safmin, safmax;
     extern /* Subroutine */ int dlaset_(char *, integer *, integer *,
 	    doublereal *, doublereal *, doublereal *, integer *);
-    static doublereal refsum;
-    static integer mstart;
-    static doublereal smlnum, scl;
-    static integer kdu, kms;
-    static doublereal ulp;
-    static integer knz, kzs;
-    static doublereal tst1, tst2;
+    doublereal refsum;
+    integer mstart;
+    doublereal smlnum, scl;
+    integer kdu, kms;
+    doublereal ulp;
+    integer knz, kzs;
+    doublereal tst1, tst2;
 
 
 /*
@@ -21474,7 +21474,7 @@ L90:
 	    work_offset, i__1, i__2;
 
     /* Local variables */
-    static integer i__, j;
+    integer i__, j;
     extern /* Subroutine */ int dgemm_(char *, char *, integer *, integer *,
 	    integer *, doublereal *, doublereal *, integer *, doublereal *,
 	    integer *, doublereal *, doublereal *, integer *);
@@ -21483,7 +21483,7 @@ L90:
 	    doublereal *, integer *), dtrmm_(char *, char *, char *, char *,
 	    integer *, integer *, doublereal *, doublereal *, integer *,
 	    doublereal *, integer *);
-    static char transt[1];
+    char transt[1];
 
 
 /*
@@ -22197,15 +22197,15 @@ L90:
     double d_sign(doublereal *, doublereal *);
 
     /* Local variables */
-    static doublereal beta;
+    doublereal beta;
     extern doublereal dnrm2_(integer *, doublereal *, integer *);
-    static integer j;
+    integer j;
     extern /* Subroutine */ int dscal_(integer *, doublereal *, doublereal *,
 	    integer *);
-    static doublereal xnorm;
+    doublereal xnorm;
 
-    static doublereal safmin, rsafmn;
-    static integer knt;
+    doublereal safmin, rsafmn;
+    integer knt;
 
 
 /*
@@ -22345,14 +22345,14 @@ L10:
     doublereal d__1;
 
     /* Local variables */
-    static integer i__, j;
+    integer i__, j;
     extern logical lsame_(char *, char *);
     extern /* Subroutine */ int dgemv_(char *, integer *, integer *,
 	    doublereal *, doublereal *, integer *, doublereal *, integer *,
 	    doublereal *, doublereal *, integer *), dtrmv_(char *,
 	    char *, char *, integer *, doublereal *, integer *, doublereal *,
 	    integer *);
-    static doublereal vii;
+    doublereal vii;
 
 
 /*
@@ -22600,12 +22600,12 @@ L10:
     extern /* Subroutine */ int dger_(integer *, integer *, doublereal *,
 	    doublereal *, integer *, doublereal *, integer *, doublereal *,
 	    integer *);
-    static integer j;
+    integer j;
     extern logical lsame_(char *, char *);
     extern /* Subroutine */ int dgemv_(char *, integer *, integer *,
 	    doublereal *, doublereal *, integer *, doublereal *, integer *,
 	    doublereal *, doublereal *, integer *);
-    static doublereal t1, t2, t3, t4, t5, t6, t7, t8, t9, v1, v2, v3, v4, v5,
+    doublereal t1, t2, t3, t4, t5, t6, t7, t8, t9, v1, v2, v3, v4, v5,
 	    v6, v7, v8, v9, t10, v10, sum;
 
 
@@ -23327,12 +23327,12 @@ L410:
     double log(doublereal), pow_di(doublereal *, integer *), sqrt(doublereal);
 
     /* Local variables */
-    static integer i__;
-    static doublereal scale, f1;
-    static integer count;
-    static doublereal g1, safmn2, safmx2;
+    integer i__;
+    doublereal scale, f1;
+    integer count;
+    doublereal g1, safmn2, safmx2;
 
-    static doublereal safmin, eps;
+    doublereal safmin, eps;
 
 
 /*
@@ -23491,7 +23491,7 @@ L30:
     double sqrt(doublereal);
 
     /* Local variables */
-    static doublereal fhmn, fhmx, c__, fa, ga, ha, as, at, au;
+    doublereal fhmn, fhmx, c__, fa, ga, ha, as, at, au;
 
 
 /*
@@ -23614,16 +23614,16 @@ L30:
     integer a_dim1, a_offset, i__1, i__2, i__3, i__4, i__5;
 
     /* Local variables */
-    static logical done;
-    static doublereal ctoc;
-    static integer i__, j;
+    logical done;
+    doublereal ctoc;
+    integer i__, j;
     extern logical lsame_(char *, char *);
-    static integer itype, k1, k2, k3, k4;
-    static doublereal cfrom1;
+    integer itype, k1, k2, k3, k4;
+    doublereal cfrom1;
 
-    static doublereal cfromc;
+    doublereal cfromc;
     extern /* Subroutine */ int xerbla_(char *, integer *);
-    static doublereal bignum, smlnum, mul, cto1;
+    doublereal bignum, smlnum, mul, cto1;
 
 
 /*
@@ -23927,22 +23927,22 @@ L10:
     integer pow_ii(integer *, integer *);
 
     /* Local variables */
-    static doublereal beta;
-    static integer idxq, nlvl, i__, j, m;
-    static doublereal alpha;
-    static integer inode, ndiml, idxqc, ndimr, itemp, sqrei, i1;
+    doublereal beta;
+    integer idxq, nlvl, i__, j, m;
+    doublereal alpha;
+    integer inode, ndiml, idxqc, ndimr, itemp, sqrei, i1;
     extern /* Subroutine */ int dlasd1_(integer *, integer *, integer *,
 	    doublereal *, doublereal *, doublereal *, doublereal *, integer *,
 	     doublereal *, integer *, integer *, integer *, doublereal *,
 	    integer *);
-    static integer ic, lf, nd, ll, nl, nr;
+    integer ic, lf, nd, ll, nl, nr;
     extern /* Subroutine */ int dlasdq_(char *, integer *, integer *, integer
 	    *, integer *, integer *, doublereal *, doublereal *, doublereal *,
 	     integer *, doublereal *, integer *, doublereal *, integer *,
 	    doublereal *, integer *), dlasdt_(integer *, integer *,
 	    integer *, integer *, integer *, integer *, integer *), xerbla_(
 	    char *, integer *);
-    static integer im1, ncc, nlf, nrf, iwk, lvl, ndb1, nlp1, nrp1;
+    integer im1, ncc, nlf, nrf, iwk, lvl, ndb1, nlp1, nrp1;
 
 
 /*
@@ -24197,7 +24197,7 @@ L10:
     doublereal d__1, d__2;
 
     /* Local variables */
-    static integer idxc, idxp, ldvt2, i__, k, m, n, n1, n2;
+    integer idxc, idxp, ldvt2, i__, k, m, n, n1, n2;
     extern /* Subroutine */ int dlasd2_(integer *, integer *, integer *,
 	    integer *, doublereal *, doublereal *, doublereal *, doublereal *,
 	     doublereal *, integer *, doublereal *, integer *, doublereal *,
@@ -24207,17 +24207,17 @@ L10:
 	    doublereal *, integer *, doublereal *, doublereal *, integer *,
 	    doublereal *, integer *, doublereal *, integer *, doublereal *,
 	    integer *, integer *, integer *, doublereal *, integer *);
-    static integer iq;
+    integer iq;
     extern /* Subroutine */ int dlascl_(char *, integer *, integer *,
 	    doublereal *, doublereal *, integer *, integer *, doublereal *,
 	    integer *, integer *);
-    static integer iz;
+    integer iz;
     extern /* Subroutine */ int dlamrg_(integer *, integer *, doublereal *,
 	    integer *, integer *, integer *);
-    static integer isigma;
+    integer isigma;
     extern /* Subroutine */ int xerbla_(char *, integer *);
-    static doublereal orgnrm;
-    static integer coltyp, iu2, ldq, idx, ldu2, ivt2;
+    doublereal orgnrm;
+    integer coltyp, iu2, ldq, idx, ldu2, ivt2;
 
 
 /*
@@ -24461,29 +24461,29 @@ L10:
     doublereal d__1, d__2;
 
     /* Local variables */
-    static integer idxi, idxj;
+    integer idxi, idxj;
     extern /* Subroutine */ int drot_(integer *, doublereal *, integer *,
 	    doublereal *, integer *, doublereal *, doublereal *);
-    static integer ctot[4];
-    static doublereal c__;
-    static integer i__, j, m, n;
-    static doublereal s;
-    static integer idxjp;
+    integer ctot[4];
+    doublereal c__;
+    integer i__, j, m, n;
+    doublereal s;
+    integer idxjp;
     extern /* Subroutine */ int dcopy_(integer *, doublereal *, integer *,
 	    doublereal *, integer *);
-    static integer jprev, k2;
-    static doublereal z1;
+    integer jprev, k2;
+    doublereal z1;
     extern doublereal dlapy2_(doublereal *, doublereal *);
-    static integer ct;
+    integer ct;
 
-    static integer jp;
+    integer jp;
     extern /* Subroutine */ int dlamrg_(integer *, integer *, doublereal *,
 	    integer *, integer *, integer *), dlacpy_(char *, integer *,
 	    integer *, doublereal *, integer *, doublereal *, integer *), dlaset_(char *, integer *, integer *, doublereal *,
 	    doublereal *, doublereal *, integer *), xerbla_(char *,
 	    integer *);
-    static doublereal hlftol, eps, tau, tol;
-    static integer psm[4], nlp1, nlp2;
+    doublereal hlftol, eps, tau, tol;
+    integer psm[4], nlp1, nlp2;
 
 
 /*
@@ -25060,28 +25060,28 @@ L120:
     double sqrt(doublereal), d_sign(doublereal *, doublereal *);
 
     /* Local variables */
-    static doublereal temp;
+    doublereal temp;
     extern doublereal dnrm2_(integer *, doublereal *, integer *);
-    static integer i__, j, m, n;
+    integer i__, j, m, n;
     extern /* Subroutine */ int dgemm_(char *, char *, integer *, integer *,
 	    integer *, doublereal *, doublereal *, integer *, doublereal *,
 	    integer *, doublereal *, doublereal *, integer *);
-    static integer ctemp;
+    integer ctemp;
     extern /* Subroutine */ int dcopy_(integer *, doublereal *, integer *,
 	    doublereal *, integer *);
-    static integer ktemp;
+    integer ktemp;
     extern doublereal dlamc3_(doublereal *, doublereal *);
     extern /* Subroutine */ int dlasd4_(integer *, integer *, doublereal *,
 	    doublereal *, doublereal *, doublereal *, doublereal *,
 	    doublereal *, integer *);
-    static integer jc;
+    integer jc;
     extern /* Subroutine */ int dlascl_(char *, integer *, integer *,
 	    doublereal *, doublereal *, integer *, integer *, doublereal *,
 	    integer *, integer *), dlacpy_(char *, integer *, integer
 	    *, doublereal *, integer *, doublereal *, integer *),
 	    xerbla_(char *, integer *);
-    static doublereal rho;
-    static integer nlp1, nlp2, nrp1;
+    doublereal rho;
+    integer nlp1, nlp2, nrp1;
 
 
 /*
@@ -25481,29 +25481,29 @@ L100:
     double sqrt(doublereal);
 
     /* Local variables */
-    static doublereal dphi, dpsi;
-    static integer iter;
-    static doublereal temp, prew, sg2lb, sg2ub, temp1, temp2, a, b, c__;
-    static integer j;
-    static doublereal w, dtiim, delsq, dtiip;
-    static integer niter;
-    static doublereal dtisq;
-    static logical swtch;
-    static doublereal dtnsq;
+    doublereal dphi, dpsi;
+    integer iter;
+    doublereal temp, prew, sg2lb, sg2ub, temp1, temp2, a, b, c__;
+    integer j;
+    doublereal w, dtiim, delsq, dtiip;
+    integer niter;
+    doublereal dtisq;
+    logical swtch;
+    doublereal dtnsq;
     extern /* Subroutine */ int dlaed6_(integer *, logical *, doublereal *,
 	    doublereal *, doublereal *, doublereal *, doublereal *, integer *)
 	    , dlasd5_(integer *, doublereal *, doublereal *, doublereal *,
 	    doublereal *, doublereal *, doublereal *);
-    static doublereal delsq2, dd[3], dtnsq1;
-    static logical swtch3;
-    static integer ii;
+    doublereal delsq2, dd[3], dtnsq1;
+    logical swtch3;
+    integer ii;
 
-    static doublereal dw, zz[3];
-    static logical orgati;
-    static doublereal erretm, dtipsq, rhoinv;
-    static integer ip1;
-    static doublereal eta, phi, eps, tau, psi;
-    static integer iim1, iip1;
+    doublereal dw, zz[3];
+    logical orgati;
+    doublereal erretm, dtipsq, rhoinv;
+    integer ip1;
+    doublereal eta, phi, eps, tau, psi;
+    integer iim1, iip1;
 
 
 /*
@@ -26488,7 +26488,7 @@ L240:
     double sqrt(doublereal);
 
     /* Local variables */
-    static doublereal b, c__, w, delsq, del, tau;
+    doublereal b, c__, w, delsq, del, tau;
 
 
 /*
@@ -26667,10 +26667,10 @@ L240:
     doublereal d__1, d__2;
 
     /* Local variables */
-    static integer idxc, idxp, ivfw, ivlw, i__, m, n;
+    integer idxc, idxp, ivfw, ivlw, i__, m, n;
     extern /* Subroutine */ int dcopy_(integer *, doublereal *, integer *,
 	    doublereal *, integer *);
-    static integer n1, n2;
+    integer n1, n2;
     extern /* Subroutine */ int dlasd7_(integer *, integer *, integer *,
 	    integer *, integer *, doublereal *, doublereal *, doublereal *,
 	    doublereal *, doublereal *, doublereal *, doublereal *,
@@ -26680,15 +26680,15 @@ L240:
 	    integer *, integer *, doublereal *, doublereal *, doublereal *,
 	    doublereal *, doublereal *, doublereal *, integer *, doublereal *,
 	     doublereal *, integer *);
-    static integer iw;
+    integer iw;
     extern /* Subroutine */ int dlascl_(char *, integer *, integer *,
 	    doublereal *, doublereal *, integer *, integer *, doublereal *,
 	    integer *, integer *), dlamrg_(integer *, integer *,
 	    doublereal *, integer *, integer *, integer *);
-    static integer isigma;
+    integer isigma;
     extern /* Subroutine */ int xerbla_(char *, integer *);
-    static doublereal orgnrm;
-    static integer idx;
+    doublereal orgnrm;
+    integer idx;
 
 
 /*
@@ -27010,20 +27010,20 @@ L240:
     doublereal d__1, d__2;
 
     /* Local variables */
-    static integer idxi, idxj;
+    integer idxi, idxj;
     extern /* Subroutine */ int drot_(integer *, doublereal *, integer *,
 	    doublereal *, integer *, doublereal *, doublereal *);
-    static integer i__, j, m, n, idxjp;
+    integer i__, j, m, n, idxjp;
     extern /* Subroutine */ int dcopy_(integer *, doublereal *, integer *,
 	    doublereal *, integer *);
-    static integer jprev, k2;
-    static doublereal z1;
+    integer jprev, k2;
+    doublereal z1;
 
-    static integer jp;
+    integer jp;
     extern /* Subroutine */ int dlamrg_(integer *, integer *, doublereal *,
 	    integer *, integer *, integer *), xerbla_(char *, integer *);
-    static doublereal hlftol, eps, tau, tol;
-    static integer nlp1, nlp2;
+    doublereal hlftol, eps, tau, tol;
+    integer nlp1, nlp2;
 
 
 /*
@@ -27509,24 +27509,24 @@ L100:
     /* Local variables */
     extern doublereal ddot_(integer *, doublereal *, integer *, doublereal *,
 	    integer *);
-    static doublereal temp;
+    doublereal temp;
     extern doublereal dnrm2_(integer *, doublereal *, integer *);
-    static integer iwk2i, iwk3i, i__, j;
-    static doublereal diflj, difrj, dsigj;
+    integer iwk2i, iwk3i, i__, j;
+    doublereal diflj, difrj, dsigj;
     extern /* Subroutine */ int dcopy_(integer *, doublereal *, integer *,
 	    doublereal *, integer *);
     extern doublereal dlamc3_(doublereal *, doublereal *);
     extern /* Subroutine */ int dlasd4_(integer *, integer *, doublereal *,
 	    doublereal *, doublereal *, doublereal *, doublereal *,
 	    doublereal *, integer *);
-    static doublereal dj;
+    doublereal dj;
     extern /* Subroutine */ int dlascl_(char *, integer *, integer *,
 	    doublereal *, doublereal *, integer *, integer *, doublereal *,
 	    integer *, integer *), dlaset_(char *, integer *, integer
 	    *, doublereal *, doublereal *, doublereal *, integer *),
 	    xerbla_(char *, integer *);
-    static doublereal dsigjp, rho;
-    static integer iwk1, iwk2, iwk3;
+    doublereal dsigjp, rho;
+    integer iwk1, iwk2, iwk3;
 
 
 /*
@@ -27805,20 +27805,20 @@ L100:
     integer pow_ii(integer *, integer *);
 
     /* Local variables */
-    static doublereal beta;
-    static integer idxq, nlvl, i__, j, m;
-    static doublereal alpha;
-    static integer inode, ndiml, ndimr, idxqi, itemp;
+    doublereal beta;
+    integer idxq, nlvl, i__, j, m;
+    doublereal alpha;
+    integer inode, ndiml, ndimr, idxqi, itemp;
     extern /* Subroutine */ int dcopy_(integer *, doublereal *, integer *,
 	    doublereal *, integer *);
-    static integer sqrei, i1;
+    integer sqrei, i1;
     extern /* Subroutine */ int dlasd6_(integer *, integer *, integer *,
 	    integer *, doublereal *, doublereal *, doublereal *, doublereal *,
 	     doublereal *, integer *, integer *, integer *, integer *,
 	    integer *, doublereal *, integer *, doublereal *, doublereal *,
 	    doublereal *, doublereal *, integer *, doublereal *, doublereal *,
 	     doublereal *, integer *, integer *);
-    static integer ic, nwork1, lf, nd, nwork2, ll, nl, vf, nr, vl;
+    integer ic, nwork1, lf, nd, nwork2, ll, nl, vf, nr, vl;
     extern /* Subroutine */ int dlasdq_(char *, integer *, integer *, integer
 	    *, integer *, integer *, doublereal *, doublereal *, doublereal *,
 	     integer *, doublereal *, integer *, doublereal *, integer *,
@@ -27826,7 +27826,7 @@ L100:
 	    integer *, integer *, integer *, integer *, integer *), dlaset_(
 	    char *, integer *, integer *, doublereal *, doublereal *,
 	    doublereal *, integer *), xerbla_(char *, integer *);
-    static integer im1, smlszp, ncc, nlf, nrf, vfi, iwk, vli, lvl, nru, ndb1,
+    integer im1, smlszp, ncc, nlf, nrf, vfi, iwk, vli, lvl, nru, ndb1,
 	    nlp1, lvl2, nrp1;
 
 
@@ -28260,24 +28260,24 @@ L100:
 	    i__2;
 
     /* Local variables */
-    static integer isub;
-    static doublereal smin;
-    static integer sqre1, i__, j;
-    static doublereal r__;
+    integer isub;
+    doublereal smin;
+    integer sqre1, i__, j;
+    doublereal r__;
     extern logical lsame_(char *, char *);
     extern /* Subroutine */ int dlasr_(char *, char *, char *, integer *,
 	    integer *, doublereal *, doublereal *, doublereal *, integer *), dswap_(integer *, doublereal *, integer *
 	    , doublereal *, integer *);
-    static integer iuplo;
-    static doublereal cs, sn;
+    integer iuplo;
+    doublereal cs, sn;
     extern /* Subroutine */ int dlartg_(doublereal *, doublereal *,
 	    doublereal *, doublereal *, doublereal *), xerbla_(char *,
 	    integer *), dbdsqr_(char *, integer *, integer *, integer
 	    *, integer *, doublereal *, doublereal *, doublereal *, integer *,
 	     doublereal *, integer *, doublereal *, integer *, doublereal *,
 	    integer *);
-    static logical rotate;
-    static integer np1;
+    logical rotate;
+    integer np1;
 
 
 /*
@@ -28620,9 +28620,9 @@ L100:
     double log(doublereal);
 
     /* Local variables */
-    static integer maxn;
-    static doublereal temp;
-    static integer nlvl, llst, i__, ncrnt, il, ir;
+    integer maxn;
+    doublereal temp;
+    integer nlvl, llst, i__, ncrnt, il, ir;
 
 
 /*
@@ -28732,7 +28732,7 @@ L100:
     integer a_dim1, a_offset, i__1, i__2, i__3;
 
     /* Local variables */
-    static integer i__, j;
+    integer i__, j;
     extern logical lsame_(char *, char *);
 
 
@@ -28871,22 +28871,22 @@ L100:
     /* Local variables */
     extern /* Subroutine */ int dlas2_(doublereal *, doublereal *, doublereal
 	    *, doublereal *, doublereal *);
-    static integer i__;
-    static doublereal scale;
-    static integer iinfo;
-    static doublereal sigmn;
+    integer i__;
+    doublereal scale;
+    integer iinfo;
+    doublereal sigmn;
     extern /* Subroutine */ int dcopy_(integer *, doublereal *, integer *,
 	    doublereal *, integer *);
-    static doublereal sigmx;
+    doublereal sigmx;
     extern /* Subroutine */ int dlasq2_(integer *, doublereal *, integer *);
 
     extern /* Subroutine */ int dlascl_(char *, integer *, integer *,
 	    doublereal *, doublereal *, integer *, integer *, doublereal *,
 	    integer *, integer *);
-    static doublereal safmin;
+    doublereal safmin;
     extern /* Subroutine */ int xerbla_(char *, integer *), dlasrt_(
 	    char *, integer *, doublereal *, integer *);
-    static doublereal eps;
+    doublereal eps;
 
 
 /*
@@ -29050,35 +29050,35 @@ L100:
     double sqrt(doublereal);
 
     /* Local variables */
-    static logical ieee;
-    static integer nbig;
-    static doublereal dmin__, emin, emax;
-    static integer ndiv, iter;
-    static doublereal qmin, temp, qmax, zmax;
-    static integer splt;
-    static doublereal dmin1, dmin2, d__, e;
-    static integer k;
-    static doublereal s, t;
-    static integer nfail;
-    static doublereal desig, trace, sigma;
-    static integer iinfo, i0, i4, n0, ttype;
+    logical ieee;
+    integer nbig;
+    doublereal dmin__, emin, emax;
+    integer ndiv, iter;
+    doublereal qmin, temp, qmax, zmax;
+    integer splt;
+    doublereal dmin1, dmin2, d__, e;
+    integer k;
+    doublereal s, t;
+    integer nfail;
+    doublereal desig, trace, sigma;
+    integer iinfo, i0, i4, n0, ttype;
     extern /* Subroutine */ int dlazq3_(integer *, integer *, doublereal *,
 	    integer *, doublereal *, doublereal *, doublereal *, doublereal *,
 	     integer *, integer *, integer *, logical *, integer *,
 	    doublereal *, doublereal *, doublereal *, doublereal *,
 	    doublereal *, doublereal *);
-    static doublereal dn;
+    doublereal dn;
 
-    static integer pp, iwhila, iwhilb;
-    static doublereal oldemn, safmin;
+    integer pp, iwhila, iwhilb;
+    doublereal oldemn, safmin;
     extern /* Subroutine */ int xerbla_(char *, integer *);
     extern integer ilaenv_(integer *, char *, char *, integer *, integer *,
 	    integer *, integer *, ftnlen, ftnlen);
     extern /* Subroutine */ int dlasrt_(char *, integer *, doublereal *,
 	    integer *);
-    static doublereal dn1, dn2, eps, tau, tol;
-    static integer ipn4;
-    static doublereal tol2;
+    doublereal dn1, dn2, eps, tau, tol;
+    integer ipn4;
+    doublereal tol2;
 
 
 /*
@@ -29579,8 +29579,8 @@ L150:
     doublereal d__1, d__2;
 
     /* Local variables */
-    static doublereal emin, temp, d__;
-    static integer j4, j4p2;
+    doublereal emin, temp, d__;
+    integer j4, j4p2;
 
 
 /*
@@ -29788,11 +29788,11 @@ L150:
     doublereal d__1, d__2;
 
     /* Local variables */
-    static doublereal emin, temp, d__;
-    static integer j4;
+    doublereal emin, temp, d__;
+    integer j4;
 
-    static doublereal safmin;
-    static integer j4p2;
+    doublereal safmin;
+    integer j4p2;
 
 
 /*
@@ -29968,11 +29968,11 @@ L150:
     integer a_dim1, a_offset, i__1, i__2;
 
     /* Local variables */
-    static integer info;
-    static doublereal temp;
-    static integer i__, j;
+    integer info;
+    doublereal temp;
+    integer i__, j;
     extern logical lsame_(char *, char *);
-    static doublereal ctemp, stemp;
+    doublereal ctemp, stemp;
     extern /* Subroutine */ int xerbla_(char *, integer *);
 
 
@@ -30394,14 +30394,14 @@ L150:
     integer i__1, i__2;
 
     /* Local variables */
-    static integer endd, i__, j;
+    integer endd, i__, j;
     extern logical lsame_(char *, char *);
-    static integer stack[64]	/* was [2][32] */;
-    static doublereal dmnmx, d1, d2, d3;
-    static integer start;
+    integer stack[64]	/* was [2][32] */;
+    doublereal dmnmx, d1, d2, d3;
+    integer start;
     extern /* Subroutine */ int xerbla_(char *, integer *);
-    static integer stkpnt, dir;
-    static doublereal tmp;
+    integer stkpnt, dir;
+    doublereal tmp;
 
 
 /*
@@ -30653,8 +30653,8 @@ L110:
     doublereal d__1;
 
     /* Local variables */
-    static doublereal absxi;
-    static integer ix;
+    doublereal absxi;
+    integer ix;
 
 
 /*
@@ -30749,14 +30749,14 @@ L110:
     double sqrt(doublereal), d_sign(doublereal *, doublereal *);
 
     /* Local variables */
-    static integer pmax;
-    static doublereal temp;
-    static logical swap;
-    static doublereal a, d__, l, m, r__, s, t, tsign, fa, ga, ha;
+    integer pmax;
+    doublereal temp;
+    logical swap;
+    doublereal a, d__, l, m, r__, s, t, tsign, fa, ga, ha;
 
-    static doublereal ft, gt, ht, mm;
-    static logical gasmal;
-    static doublereal tt, clt, crt, slt, srt;
+    doublereal ft, gt, ht, mm;
+    logical gasmal;
+    doublereal tt, clt, crt, slt, srt;
 
 
 /*
@@ -30994,8 +30994,8 @@ L110:
     integer a_dim1, a_offset, i__1, i__2, i__3, i__4;
 
     /* Local variables */
-    static doublereal temp;
-    static integer i__, j, k, i1, i2, n32, ip, ix, ix0, inc;
+    doublereal temp;
+    integer i__, j, k, i1, i2, n32, ip, ix, ix0, inc;
 
 
 /*
@@ -31145,23 +31145,23 @@ L110:
     doublereal d__1, d__2, d__3, d__4, d__5, d__6, d__7, d__8;
 
     /* Local variables */
-    static doublereal btmp[4], smin;
-    static integer ipiv;
-    static doublereal temp;
-    static integer jpiv[4];
-    static doublereal xmax;
-    static integer ipsv, jpsv, i__, j, k;
-    static logical bswap;
+    doublereal btmp[4], smin;
+    integer ipiv;
+    doublereal temp;
+    integer jpiv[4];
+    doublereal xmax;
+    integer ipsv, jpsv, i__, j, k;
+    logical bswap;
     extern /* Subroutine */ int dcopy_(integer *, doublereal *, integer *,
 	    doublereal *, integer *), dswap_(integer *, doublereal *, integer
 	    *, doublereal *, integer *);
-    static logical xswap;
-    static doublereal x2[2], l21, u11, u12;
-    static integer ip, jp;
-    static doublereal u22, t16[16]	/* was [4][4] */;
+    logical xswap;
+    doublereal x2[2], l21, u11, u12;
+    integer ip, jp;
+    doublereal u22, t16[16]	/* was [4][4] */;
 
     extern integer idamax_(integer *, doublereal *, integer *);
-    static doublereal smlnum, gam, bet, eps, sgn, tmp[4], tau1;
+    doublereal smlnum, gam, bet, eps, sgn, tmp[4], tau1;
 
 
 /*
@@ -31587,8 +31587,8 @@ L50:
     /* Local variables */
     extern doublereal ddot_(integer *, doublereal *, integer *, doublereal *,
 	    integer *);
-    static integer i__;
-    static doublereal alpha;
+    integer i__;
+    doublereal alpha;
     extern /* Subroutine */ int dscal_(integer *, doublereal *, doublereal *,
 	    integer *);
     extern logical lsame_(char *, char *);
@@ -31599,7 +31599,7 @@ L50:
 	    dsymv_(char *, integer *, doublereal *, doublereal *, integer *,
 	    doublereal *, integer *, doublereal *, doublereal *, integer *), dlarfg_(integer *, doublereal *, doublereal *, integer *,
 	     doublereal *);
-    static integer iw;
+    integer iw;
 
 
 /*
@@ -31917,8 +31917,8 @@ L50:
     double sqrt(doublereal);
 
     /* Local variables */
-    static doublereal temp, g, s, t;
-    static integer j4;
+    doublereal temp, g, s, t;
+    integer j4;
     extern /* Subroutine */ int dlasq5_(integer *, integer *, doublereal *,
 	    integer *, doublereal *, doublereal *, doublereal *, doublereal *,
 	     doublereal *, doublereal *, doublereal *, logical *), dlasq6_(
@@ -31929,10 +31929,10 @@ L50:
 	    doublereal *, doublereal *, doublereal *, doublereal *, integer *,
 	     doublereal *);
 
-    static integer nn;
-    static doublereal safmin, eps, tol;
-    static integer n0in, ipn4;
-    static doublereal tol2;
+    integer nn;
+    doublereal safmin, eps, tol;
+    integer n0in, ipn4;
+    doublereal tol2;
 
 
 /*
@@ -32240,9 +32240,9 @@ L100:
     double sqrt(doublereal);
 
     /* Local variables */
-    static doublereal s, a2, b1, b2;
-    static integer i4, nn, np;
-    static doublereal gam, gap1, gap2;
+    doublereal s, a2, b1, b2;
+    integer i4, nn, np;
+    doublereal gam, gap1, gap2;
 
 
 /*
@@ -32614,7 +32614,7 @@ L80:
     doublereal d__1;
 
     /* Local variables */
-    static integer i__, j, l;
+    integer i__, j, l;
     extern /* Subroutine */ int dscal_(integer *, doublereal *, doublereal *,
 	    integer *), dlarf_(char *, integer *, integer *, doublereal *,
 	    integer *, doublereal *, doublereal *, integer *, doublereal *), xerbla_(char *, integer *);
@@ -32760,11 +32760,11 @@ L80:
     integer a_dim1, a_offset, i__1, i__2, i__3;
 
     /* Local variables */
-    static integer i__, j;
+    integer i__, j;
     extern logical lsame_(char *, char *);
-    static integer iinfo;
-    static logical wantq;
-    static integer nb, mn;
+    integer iinfo;
+    logical wantq;
+    integer nb, mn;
     extern /* Subroutine */ int xerbla_(char *, integer *);
     extern integer ilaenv_(integer *, char *, char *, integer *, integer *,
 	    integer *, integer *, ftnlen, ftnlen);
@@ -32772,8 +32772,8 @@ L80:
 	    doublereal *, integer *, doublereal *, doublereal *, integer *,
 	    integer *), dorgqr_(integer *, integer *, integer *, doublereal *,
 	     integer *, doublereal *, doublereal *, integer *, integer *);
-    static integer lwkopt;
-    static logical lquery;
+    integer lwkopt;
+    logical lquery;
 
 
 /*
@@ -33038,15 +33038,15 @@ L80:
     integer a_dim1, a_offset, i__1, i__2;
 
     /* Local variables */
-    static integer i__, j, iinfo, nb, nh;
+    integer i__, j, iinfo, nb, nh;
     extern /* Subroutine */ int xerbla_(char *, integer *);
     extern integer ilaenv_(integer *, char *, char *, integer *, integer *,
 	    integer *, integer *, ftnlen, ftnlen);
     extern /* Subroutine */ int dorgqr_(integer *, integer *, integer *,
 	    doublereal *, integer *, doublereal *, doublereal *, integer *,
 	    integer *);
-    static integer lwkopt;
-    static logical lquery;
+    integer lwkopt;
+    logical lquery;
 
 
 /*
@@ -33225,7 +33225,7 @@ L80:
     doublereal d__1;
 
     /* Local variables */
-    static integer i__, j, l;
+    integer i__, j, l;
     extern /* Subroutine */ int dscal_(integer *, doublereal *, doublereal *,
 	    integer *), dlarf_(char *, integer *, integer *, doublereal *,
 	    integer *, doublereal *, doublereal *, integer *, doublereal *), xerbla_(char *, integer *);
@@ -33375,22 +33375,22 @@ L80:
     integer a_dim1, a_offset, i__1, i__2, i__3;
 
     /* Local variables */
-    static integer i__, j, l, nbmin, iinfo;
+    integer i__, j, l, nbmin, iinfo;
     extern /* Subroutine */ int dorgl2_(integer *, integer *, integer *,
 	    doublereal *, integer *, doublereal *, doublereal *, integer *);
-    static integer ib, nb, ki, kk;
+    integer ib, nb, ki, kk;
     extern /* Subroutine */ int dlarfb_(char *, char *, char *, char *,
 	    integer *, integer *, integer *, doublereal *, integer *,
 	    doublereal *, integer *, doublereal *, integer *, doublereal *,
 	    integer *);
-    static integer nx;
+    integer nx;
     extern /* Subroutine */ int dlarft_(char *, char *, integer *, integer *,
 	    doublereal *, integer *, doublereal *, doublereal *, integer *), xerbla_(char *, integer *);
     extern integer ilaenv_(integer *, char *, char *, integer *, integer *,
 	    integer *, integer *, ftnlen, ftnlen);
-    static integer ldwork, lwkopt;
-    static logical lquery;
-    static integer iws;
+    integer ldwork, lwkopt;
+    logical lquery;
+    integer iws;
 
 
 /*
@@ -33636,22 +33636,22 @@ L80:
     integer a_dim1, a_offset, i__1, i__2, i__3;
 
     /* Local variables */
-    static integer i__, j, l, nbmin, iinfo;
+    integer i__, j, l, nbmin, iinfo;
     extern /* Subroutine */ int dorg2r_(integer *, integer *, integer *,
 	    doublereal *, integer *, doublereal *, doublereal *, integer *);
-    static integer ib, nb, ki, kk;
+    integer ib, nb, ki, kk;
     extern /* Subroutine */ int dlarfb_(char *, char *, char *, char *,
 	    integer *, integer *, integer *, doublereal *, integer *,
 	    doublereal *, integer *, doublereal *, integer *, doublereal *,
 	    integer *);
-    static integer nx;
+    integer nx;
     extern /* Subroutine */ int dlarft_(char *, char *, integer *, integer *,
 	    doublereal *, integer *, doublereal *, doublereal *, integer *), xerbla_(char *, integer *);
     extern integer ilaenv_(integer *, char *, char *, integer *, integer *,
 	    integer *, integer *, ftnlen, ftnlen);
-    static integer ldwork, lwkopt;
-    static logical lquery;
-    static integer iws;
+    integer ldwork, lwkopt;
+    logical lquery;
+    integer iws;
 
 
 /*
@@ -33898,16 +33898,16 @@ L80:
     integer a_dim1, a_offset, c_dim1, c_offset, i__1, i__2;
 
     /* Local variables */
-    static logical left;
-    static integer i__;
+    logical left;
+    integer i__;
     extern /* Subroutine */ int dlarf_(char *, integer *, integer *,
 	    doublereal *, integer *, doublereal *, doublereal *, integer *,
 	    doublereal *);
     extern logical lsame_(char *, char *);
-    static integer i1, i2, i3, mi, ni, nq;
+    integer i1, i2, i3, mi, ni, nq;
     extern /* Subroutine */ int xerbla_(char *, integer *);
-    static logical notran;
-    static doublereal aii;
+    logical notran;
+    doublereal aii;
 
 
 /*
@@ -34099,16 +34099,16 @@ L80:
     integer a_dim1, a_offset, c_dim1, c_offset, i__1, i__2;
 
     /* Local variables */
-    static logical left;
-    static integer i__;
+    logical left;
+    integer i__;
     extern /* Subroutine */ int dlarf_(char *, integer *, integer *,
 	    doublereal *, integer *, doublereal *, doublereal *, integer *,
 	    doublereal *);
     extern logical lsame_(char *, char *);
-    static integer i1, i2, i3, ic, jc, mi, ni, nq;
+    integer i1, i2, i3, ic, jc, mi, ni, nq;
     extern /* Subroutine */ int xerbla_(char *, integer *);
-    static logical notran;
-    static doublereal aii;
+    logical notran;
+    doublereal aii;
 
 
 /*
@@ -34310,23 +34310,23 @@ L80:
     /* Subroutine */ int s_cat(char *, char **, integer *, integer *, ftnlen);
 
     /* Local variables */
-    static logical left;
+    logical left;
     extern logical lsame_(char *, char *);
-    static integer iinfo, i1, i2, nb, mi, ni, nq, nw;
+    integer iinfo, i1, i2, nb, mi, ni, nq, nw;
     extern /* Subroutine */ int xerbla_(char *, integer *);
     extern integer ilaenv_(integer *, char *, char *, integer *, integer *,
 	    integer *, integer *, ftnlen, ftnlen);
     extern /* Subroutine */ int dormlq_(char *, char *, integer *, integer *,
 	    integer *, doublereal *, integer *, doublereal *, doublereal *,
 	    integer *, doublereal *, integer *, integer *);
-    static logical notran;
+    logical notran;
     extern /* Subroutine */ int dormqr_(char *, char *, integer *, integer *,
 	    integer *, doublereal *, integer *, doublereal *, doublereal *,
 	    integer *, doublereal *, integer *, integer *);
-    static logical applyq;
-    static char transt[1];
-    static integer lwkopt;
-    static logical lquery;
+    logical applyq;
+    char transt[1];
+    integer lwkopt;
+    logical lquery;
 
 
 /*
@@ -34636,16 +34636,16 @@ L80:
     integer a_dim1, a_offset, c_dim1, c_offset, i__1, i__2;
 
     /* Local variables */
-    static logical left;
-    static integer i__;
+    logical left;
+    integer i__;
     extern /* Subroutine */ int dlarf_(char *, integer *, integer *,
 	    doublereal *, integer *, doublereal *, doublereal *, integer *,
 	    doublereal *);
     extern logical lsame_(char *, char *);
-    static integer i1, i2, i3, ic, jc, mi, ni, nq;
+    integer i1, i2, i3, ic, jc, mi, ni, nq;
     extern /* Subroutine */ int xerbla_(char *, integer *);
-    static logical notran;
-    static doublereal aii;
+    logical notran;
+    doublereal aii;
 
 
 /*
@@ -34847,30 +34847,30 @@ L80:
     /* Subroutine */ int s_cat(char *, char **, integer *, integer *, ftnlen);
 
     /* Local variables */
-    static logical left;
-    static integer i__;
-    static doublereal t[4160]	/* was [65][64] */;
+    logical left;
+    integer i__;
+    doublereal t[4160]	/* was [65][64] */;
     extern logical lsame_(char *, char *);
-    static integer nbmin, iinfo, i1, i2, i3;
+    integer nbmin, iinfo, i1, i2, i3;
     extern /* Subroutine */ int dorml2_(char *, char *, integer *, integer *,
 	    integer *, doublereal *, integer *, doublereal *, doublereal *,
 	    integer *, doublereal *, integer *);
-    static integer ib, ic, jc, nb, mi, ni;
+    integer ib, ic, jc, nb, mi, ni;
     extern /* Subroutine */ int dlarfb_(char *, char *, char *, char *,
 	    integer *, integer *, integer *, doublereal *, integer *,
 	    doublereal *, integer *, doublereal *, integer *, doublereal *,
 	    integer *);
-    static integer nq, nw;
+    integer nq, nw;
     extern /* Subroutine */ int dlarft_(char *, char *, integer *, integer *,
 	    doublereal *, integer *, doublereal *, doublereal *, integer *), xerbla_(char *, integer *);
     extern integer ilaenv_(integer *, char *, char *, integer *, integer *,
 	    integer *, integer *, ftnlen, ftnlen);
-    static logical notran;
-    static integer ldwork;
-    static char transt[1];
-    static integer lwkopt;
-    static logical lquery;
-    static integer iws;
+    logical notran;
+    integer ldwork;
+    char transt[1];
+    integer lwkopt;
+    logical lquery;
+    integer iws;
 
 
 /*
@@ -35157,28 +35157,28 @@ L80:
     /* Subroutine */ int s_cat(char *, char **, integer *, integer *, ftnlen);
 
     /* Local variables */
-    static logical left;
-    static integer i__;
-    static doublereal t[4160]	/* was [65][64] */;
+    logical left;
+    integer i__;
+    doublereal t[4160]	/* was [65][64] */;
     extern logical lsame_(char *, char *);
-    static integer nbmin, iinfo, i1, i2, i3;
+    integer nbmin, iinfo, i1, i2, i3;
     extern /* Subroutine */ int dorm2l_(char *, char *, integer *, integer *,
 	    integer *, doublereal *, integer *, doublereal *, doublereal *,
 	    integer *, doublereal *, integer *);
-    static integer ib, nb, mi, ni;
+    integer ib, nb, mi, ni;
     extern /* Subroutine */ int dlarfb_(char *, char *, char *, char *,
 	    integer *, integer *, integer *, doublereal *, integer *,
 	    doublereal *, integer *, doublereal *, integer *, doublereal *,
 	    integer *);
-    static integer nq, nw;
+    integer nq, nw;
     extern /* Subroutine */ int dlarft_(char *, char *, integer *, integer *,
 	    doublereal *, integer *, doublereal *, doublereal *, integer *), xerbla_(char *, integer *);
     extern integer ilaenv_(integer *, char *, char *, integer *, integer *,
 	    integer *, integer *, ftnlen, ftnlen);
-    static logical notran;
-    static integer ldwork, lwkopt;
-    static logical lquery;
-    static integer iws;
+    logical notran;
+    integer ldwork, lwkopt;
+    logical lquery;
+    integer iws;
 
 
 /*
@@ -35460,28 +35460,28 @@ L80:
     /* Subroutine */ int s_cat(char *, char **, integer *, integer *, ftnlen);
 
     /* Local variables */
-    static logical left;
-    static integer i__;
-    static doublereal t[4160]	/* was [65][64] */;
+    logical left;
+    integer i__;
+    doublereal t[4160]	/* was [65][64] */;
     extern logical lsame_(char *, char *);
-    static integer nbmin, iinfo, i1, i2, i3;
+    integer nbmin, iinfo, i1, i2, i3;
     extern /* Subroutine */ int dorm2r_(char *, char *, integer *, integer *,
 	    integer *, doublereal *, integer *, doublereal *, doublereal *,
 	    integer *, doublereal *, integer *);
-    static integer ib, ic, jc, nb, mi, ni;
+    integer ib, ic, jc, nb, mi, ni;
     extern /* Subroutine */ int dlarfb_(char *, char *, char *, char *,
 	    integer *, integer *, integer *, doublereal *, integer *,
 	    doublereal *, integer *, doublereal *, integer *, doublereal *,
 	    integer *);
-    static integer nq, nw;
+    integer nq, nw;
     extern /* Subroutine */ int dlarft_(char *, char *, integer *, integer *,
 	    doublereal *, integer *, doublereal *, doublereal *, integer *), xerbla_(char *, integer *);
     extern integer ilaenv_(integer *, char *, char *, integer *, integer *,
 	    integer *, integer *, ftnlen, ftnlen);
-    static logical notran;
-    static integer ldwork, lwkopt;
-    static logical lquery;
-    static integer iws;
+    logical notran;
+    integer ldwork, lwkopt;
+    logical lquery;
+    integer iws;
 
 
 /*
@@ -35762,11 +35762,11 @@ L80:
     /* Subroutine */ int s_cat(char *, char **, integer *, integer *, ftnlen);
 
     /* Local variables */
-    static logical left;
+    logical left;
     extern logical lsame_(char *, char *);
-    static integer iinfo, i1;
-    static logical upper;
-    static integer i2, nb, mi, ni, nq, nw;
+    integer iinfo, i1;
+    logical upper;
+    integer i2, nb, mi, ni, nq, nw;
     extern /* Subroutine */ int xerbla_(char *, integer *);
     extern integer ilaenv_(integer *, char *, char *, integer *, integer *,
 	    integer *, integer *, ftnlen, ftnlen);
@@ -35776,8 +35776,8 @@ L80:
 	    dormqr_(char *, char *, integer *, integer *, integer *,
 	    doublereal *, integer *, doublereal *, doublereal *, integer *,
 	    doublereal *, integer *, integer *);
-    static integer lwkopt;
-    static logical lquery;
+    integer lwkopt;
+    logical lquery;
 
 
 /*
@@ -36030,16 +36030,16 @@ L80:
     /* Local variables */
     extern doublereal ddot_(integer *, doublereal *, integer *, doublereal *,
 	    integer *);
-    static integer j;
+    integer j;
     extern /* Subroutine */ int dscal_(integer *, doublereal *, doublereal *,
 	    integer *);
     extern logical lsame_(char *, char *);
     extern /* Subroutine */ int dgemv_(char *, integer *, integer *,
 	    doublereal *, doublereal *, integer *, doublereal *, integer *,
 	    doublereal *, doublereal *, integer *);
-    static logical upper;
+    logical upper;
     extern /* Subroutine */ int xerbla_(char *, integer *);
-    static doublereal ajj;
+    doublereal ajj;
 
 
 /*
@@ -36214,7 +36214,7 @@ L40:
     integer a_dim1, a_offset, i__1, i__2, i__3, i__4;
 
     /* Local variables */
-    static integer j;
+    integer j;
     extern /* Subroutine */ int dgemm_(char *, char *, integer *, integer *,
 	    integer *, doublereal *, doublereal *, integer *, doublereal *,
 	    integer *, doublereal *, doublereal *, integer *);
@@ -36222,12 +36222,12 @@ L40:
     extern /* Subroutine */ int dtrsm_(char *, char *, char *, char *,
 	    integer *, integer *, doublereal *, doublereal *, integer *,
 	    doublereal *, integer *);
-    static logical upper;
+    logical upper;
     extern /* Subroutine */ int dsyrk_(char *, char *, integer *, integer *,
 	    doublereal *, doublereal *, integer *, doublereal *, doublereal *,
 	     integer *), dpotf2_(char *, integer *,
 	    doublereal *, integer *, integer *);
-    static integer jb, nb;
+    integer jb, nb;
     extern /* Subroutine */ int xerbla_(char *, integer *);
     extern integer ilaenv_(integer *, char *, char *, integer *, integer *,
 	    integer *, integer *, ftnlen, ftnlen);
@@ -36438,20 +36438,20 @@ L40:
     double sqrt(doublereal);
 
     /* Local variables */
-    static doublereal tiny;
-    static integer i__, j, k, m;
-    static doublereal p;
+    doublereal tiny;
+    integer i__, j, k, m;
+    doublereal p;
     extern /* Subroutine */ int dgemm_(char *, char *, integer *, integer *,
 	    integer *, doublereal *, doublereal *, integer *, doublereal *,
 	    integer *, doublereal *, doublereal *, integer *);
     extern logical lsame_(char *, char *);
     extern /* Subroutine */ int dswap_(integer *, doublereal *, integer *,
 	    doublereal *, integer *);
-    static integer lwmin;
+    integer lwmin;
     extern /* Subroutine */ int dlaed0_(integer *, integer *, integer *,
 	    doublereal *, doublereal *, doublereal *, integer *, doublereal *,
 	     integer *, doublereal *, integer *, integer *);
-    static integer start, ii;
+    integer start, ii;
 
     extern /* Subroutine */ int dlascl_(char *, integer *, integer *,
 	    doublereal *, doublereal *, integer *, integer *, doublereal *,
@@ -36462,17 +36462,17 @@ L40:
     extern integer ilaenv_(integer *, char *, char *, integer *, integer *,
 	    integer *, integer *, ftnlen, ftnlen);
     extern /* Subroutine */ int xerbla_(char *, integer *);
-    static integer finish;
+    integer finish;
     extern doublereal dlanst_(char *, integer *, doublereal *, doublereal *);
     extern /* Subroutine */ int dsterf_(integer *, doublereal *, doublereal *,
 	     integer *), dlasrt_(char *, integer *, doublereal *, integer *);
-    static integer liwmin, icompz;
+    integer liwmin, icompz;
     extern /* Subroutine */ int dsteqr_(char *, integer *, doublereal *,
 	    doublereal *, doublereal *, integer *, doublereal *, integer *);
-    static doublereal orgnrm;
-    static logical lquery;
-    static integer smlsiz, storez, strtrw, lgn;
-    static doublereal eps;
+    doublereal orgnrm;
+    logical lquery;
+    integer smlsiz, storez, strtrw, lgn;
+    doublereal eps;
 
 
 /*
@@ -36901,47 +36901,47 @@ L50:
     double sqrt(doublereal), d_sign(doublereal *, doublereal *);
 
     /* Local variables */
-    static integer lend, jtot;
+    integer lend, jtot;
     extern /* Subroutine */ int dlae2_(doublereal *, doublereal *, doublereal
 	    *, doublereal *, doublereal *);
-    static doublereal b, c__, f, g;
-    static integer i__, j, k, l, m;
-    static doublereal p, r__, s;
+    doublereal b, c__, f, g;
+    integer i__, j, k, l, m;
+    doublereal p, r__, s;
     extern logical lsame_(char *, char *);
     extern /* Subroutine */ int dlasr_(char *, char *, char *, integer *,
 	    integer *, doublereal *, doublereal *, doublereal *, integer *);
-    static doublereal anorm;
+    doublereal anorm;
     extern /* Subroutine */ int dswap_(integer *, doublereal *, integer *,
 	    doublereal *, integer *);
-    static integer l1;
+    integer l1;
     extern /* Subroutine */ int dlaev2_(doublereal *, doublereal *,
 	    doublereal *, doublereal *, doublereal *, doublereal *,
 	    doublereal *);
-    static integer lendm1, lendp1;
+    integer lendm1, lendp1;
     extern doublereal dlapy2_(doublereal *, doublereal *);
-    static integer ii;
+    integer ii;
 
-    static integer mm, iscale;
+    integer mm, iscale;
     extern /* Subroutine */ int dlascl_(char *, integer *, integer *,
 	    doublereal *, doublereal *, integer *, integer *, doublereal *,
 	    integer *, integer *), dlaset_(char *, integer *, integer
 	    *, doublereal *, doublereal *, doublereal *, integer *);
-    static doublereal safmin;
+    doublereal safmin;
     extern /* Subroutine */ int dlartg_(doublereal *, doublereal *,
 	    doublereal *, doublereal *, doublereal *);
-    static doublereal safmax;
+    doublereal safmax;
     extern /* Subroutine */ int xerbla_(char *, integer *);
     extern doublereal dlanst_(char *, integer *, doublereal *, doublereal *);
     extern /* Subroutine */ int dlasrt_(char *, integer *, doublereal *,
 	    integer *);
-    static integer lendsv;
-    static doublereal ssfmin;
-    static integer nmaxit, icompz;
-    static doublereal ssfmax;
-    static integer lm1, mm1, nm1;
-    static doublereal rt1, rt2, eps;
-    static integer lsv;
-    static doublereal tst, eps2;
+    integer lendsv;
+    doublereal ssfmin;
+    integer nmaxit, icompz;
+    doublereal ssfmax;
+    integer lm1, mm1, nm1;
+    doublereal rt1, rt2, eps;
+    integer lsv;
+    doublereal tst, eps2;
 
 
 /*
@@ -37504,33 +37504,33 @@ L190:
     double sqrt(doublereal), d_sign(doublereal *, doublereal *);
 
     /* Local variables */
-    static doublereal oldc;
-    static integer lend, jtot;
+    doublereal oldc;
+    integer lend, jtot;
     extern /* Subroutine */ int dlae2_(doublereal *, doublereal *, doublereal
 	    *, doublereal *, doublereal *);
-    static doublereal c__;
-    static integer i__, l, m;
-    static doublereal p, gamma, r__, s, alpha, sigma, anorm;
-    static integer l1;
+    doublereal c__;
+    integer i__, l, m;
+    doublereal p, gamma, r__, s, alpha, sigma, anorm;
+    integer l1;
     extern doublereal dlapy2_(doublereal *, doublereal *);
-    static doublereal bb;
+    doublereal bb;
 
-    static integer iscale;
+    integer iscale;
     extern /* Subroutine */ int dlascl_(char *, integer *, integer *,
 	    doublereal *, doublereal *, integer *, integer *, doublereal *,
 	    integer *, integer *);
-    static doublereal oldgam, safmin;
+    doublereal oldgam, safmin;
     extern /* Subroutine */ int xerbla_(char *, integer *);
-    static doublereal safmax;
+    doublereal safmax;
     extern doublereal dlanst_(char *, integer *, doublereal *, doublereal *);
     extern /* Subroutine */ int dlasrt_(char *, integer *, doublereal *,
 	    integer *);
-    static integer lendsv;
-    static doublereal ssfmin;
-    static integer nmaxit;
-    static doublereal ssfmax, rt1, rt2, eps, rte;
-    static integer lsv;
-    static doublereal eps2;
+    integer lendsv;
+    doublereal ssfmin;
+    integer nmaxit;
+    doublereal ssfmax, rt1, rt2, eps, rte;
+    integer lsv;
+    doublereal eps2;
 
 
 /*
@@ -37946,18 +37946,18 @@ L180:
     double sqrt(doublereal);
 
     /* Local variables */
-    static integer inde;
-    static doublereal anrm, rmin, rmax;
-    static integer lopt;
+    integer inde;
+    doublereal anrm, rmin, rmax;
+    integer lopt;
     extern /* Subroutine */ int dscal_(integer *, doublereal *, doublereal *,
 	    integer *);
-    static doublereal sigma;
+    doublereal sigma;
     extern logical lsame_(char *, char *);
-    static integer iinfo, lwmin, liopt;
-    static logical lower, wantz;
-    static integer indwk2, llwrk2;
+    integer iinfo, lwmin, liopt;
+    logical lower, wantz;
+    integer indwk2, llwrk2;
 
-    static integer iscale;
+    integer iscale;
     extern /* Subroutine */ int dlascl_(char *, integer *, integer *,
 	    doublereal *, doublereal *, integer *, integer *, doublereal *,
 	    integer *, integer *), dstedc_(char *, integer *,
@@ -37965,26 +37965,26 @@ L180:
 	     integer *, integer *, integer *, integer *), dlacpy_(
 	    char *, integer *, integer *, doublereal *, integer *, doublereal
 	    *, integer *);
-    static doublereal safmin;
+    doublereal safmin;
     extern integer ilaenv_(integer *, char *, char *, integer *, integer *,
 	    integer *, integer *, ftnlen, ftnlen);
     extern /* Subroutine */ int xerbla_(char *, integer *);
-    static doublereal bignum;
-    static integer indtau;
+    doublereal bignum;
+    integer indtau;
     extern /* Subroutine */ int dsterf_(integer *, doublereal *, doublereal *,
 	     integer *);
     extern doublereal dlansy_(char *, char *, integer *, doublereal *,
 	    integer *, doublereal *);
-    static integer indwrk, liwmin;
+    integer indwrk, liwmin;
     extern /* Subroutine */ int dormtr_(char *, char *, char *, integer *,
 	    integer *, doublereal *, integer *, doublereal *, doublereal *,
 	    integer *, doublereal *, integer *, integer *), dsytrd_(char *, integer *, doublereal *, integer *,
 	    doublereal *, doublereal *, doublereal *, doublereal *, integer *,
 	     integer *);
-    static integer llwork;
-    static doublereal smlnum;
-    static logical lquery;
-    static doublereal eps;
+    integer llwork;
+    doublereal smlnum;
+    logical lquery;
+    doublereal eps;
 
 
 /*
@@ -38265,16 +38265,16 @@ L180:
     /* Local variables */
     extern doublereal ddot_(integer *, doublereal *, integer *, doublereal *,
 	    integer *);
-    static doublereal taui;
+    doublereal taui;
     extern /* Subroutine */ int dsyr2_(char *, integer *, doublereal *,
 	    doublereal *, integer *, doublereal *, integer *, doublereal *,
 	    integer *);
-    static integer i__;
-    static doublereal alpha;
+    integer i__;
+    doublereal alpha;
     extern logical lsame_(char *, char *);
     extern /* Subroutine */ int daxpy_(integer *, doublereal *, doublereal *,
 	    integer *, doublereal *, integer *);
-    static logical upper;
+    logical upper;
     extern /* Subroutine */ int dsymv_(char *, integer *, doublereal *,
 	    doublereal *, integer *, doublereal *, integer *, doublereal *,
 	    doublereal *, integer *), dlarfg_(integer *, doublereal *,
@@ -38546,23 +38546,23 @@ L180:
     integer a_dim1, a_offset, i__1, i__2, i__3;
 
     /* Local variables */
-    static integer i__, j;
+    integer i__, j;
     extern logical lsame_(char *, char *);
-    static integer nbmin, iinfo;
-    static logical upper;
+    integer nbmin, iinfo;
+    logical upper;
     extern /* Subroutine */ int dsytd2_(char *, integer *, doublereal *,
 	    integer *, doublereal *, doublereal *, doublereal *, integer *), dsyr2k_(char *, char *, integer *, integer *, doublereal
 	    *, doublereal *, integer *, doublereal *, integer *, doublereal *,
 	     doublereal *, integer *);
-    static integer nb, kk, nx;
+    integer nb, kk, nx;
     extern /* Subroutine */ int dlatrd_(char *, integer *, integer *,
 	    doublereal *, integer *, doublereal *, doublereal *, doublereal *,
 	     integer *), xerbla_(char *, integer *);
     extern integer ilaenv_(integer *, char *, char *, integer *, integer *,
 	    integer *, integer *, ftnlen, ftnlen);
-    static integer ldwork, lwkopt;
-    static logical lquery;
-    static integer iws;
+    integer ldwork, lwkopt;
+    logical lquery;
+    integer iws;
 
 
 /*
@@ -38899,48 +38899,48 @@ L180:
     double sqrt(doublereal);
 
     /* Local variables */
-    static doublereal beta, emax;
-    static logical pair;
+    doublereal beta, emax;
+    logical pair;
     extern doublereal ddot_(integer *, doublereal *, integer *, doublereal *,
 	    integer *);
-    static logical allv;
-    static integer ierr;
-    static doublereal unfl, ovfl, smin;
-    static logical over;
-    static doublereal vmax;
-    static integer jnxt, i__, j, k;
+    logical allv;
+    integer ierr;
+    doublereal unfl, ovfl, smin;
+    logical over;
+    doublereal vmax;
+    integer jnxt, i__, j, k;
     extern /* Subroutine */ int dscal_(integer *, doublereal *, doublereal *,
 	    integer *);
-    static doublereal scale, x[4]	/* was [2][2] */;
+    doublereal scale, x[4]	/* was [2][2] */;
     extern logical lsame_(char *, char *);
     extern /* Subroutine */ int dgemv_(char *, integer *, integer *,
 	    doublereal *, doublereal *, integer *, doublereal *, integer *,
 	    doublereal *, doublereal *, integer *);
-    static doublereal remax;
+    doublereal remax;
     extern /* Subroutine */ int dcopy_(integer *, doublereal *, integer *,
 	    doublereal *, integer *);
-    static logical leftv, bothv;
+    logical leftv, bothv;
     extern /* Subroutine */ int daxpy_(integer *, doublereal *, doublereal *,
 	    integer *, doublereal *, integer *);
-    static doublereal vcrit;
-    static logical somev;
-    static integer j1, j2, n2;
-    static doublereal xnorm;
+    doublereal vcrit;
+    logical somev;
+    integer j1, j2, n2;
+    doublereal xnorm;
     extern /* Subroutine */ int dlaln2_(logical *, integer *, integer *,
 	    doublereal *, doublereal *, doublereal *, integer *, doublereal *,
 	     doublereal *, doublereal *, integer *, doublereal *, doublereal *
 	    , doublereal *, integer *, doublereal *, doublereal *, integer *),
 	     dlabad_(doublereal *, doublereal *);
-    static integer ii, ki;
+    integer ii, ki;
 
-    static integer ip, is;
-    static doublereal wi;
+    integer ip, is;
+    doublereal wi;
     extern integer idamax_(integer *, doublereal *, integer *);
-    static doublereal wr;
+    doublereal wr;
     extern /* Subroutine */ int xerbla_(char *, integer *);
-    static doublereal bignum;
-    static logical rightv;
-    static doublereal smlnum, rec, ulp;
+    doublereal bignum;
+    logical rightv;
+    doublereal smlnum, rec, ulp;
 
 
 /*
@@ -40123,13 +40123,13 @@ L250:
     integer q_dim1, q_offset, t_dim1, t_offset, i__1;
 
     /* Local variables */
-    static integer here;
+    integer here;
     extern logical lsame_(char *, char *);
-    static logical wantq;
+    logical wantq;
     extern /* Subroutine */ int dlaexc_(logical *, integer *, doublereal *,
 	    integer *, doublereal *, integer *, integer *, integer *, integer
 	    *, doublereal *, integer *), xerbla_(char *, integer *);
-    static integer nbnext, nbf, nbl;
+    integer nbnext, nbf, nbl;
 
 
 /*
@@ -40500,7 +40500,7 @@ integer ieeeck_(integer *ispec, real *zero, real *one)
     integer ret_val;
 
     /* Local variables */
-    static real neginf, posinf, negzro, newzro, nan1, nan2, nan3, nan4, nan5,
+    real neginf, posinf, negzro, newzro, nan1, nan2, nan3, nan4, nan5,
 	    nan6;
 
 
@@ -40654,15 +40654,15 @@ integer ilaenv_(integer *ispec, char *name__, char *opts, integer *n1,
     integer s_cmp(char *, char *, ftnlen, ftnlen);
 
     /* Local variables */
-    static integer i__;
-    static logical cname;
-    static integer nbmin;
-    static logical sname;
-    static char c1[1], c2[2], c3[3], c4[2];
-    static integer ic, nb;
+    integer i__;
+    logical cname;
+    integer nbmin;
+    logical sname;
+    char c1[1], c2[2], c3[3], c4[2];
+    integer ic, nb;
     extern integer ieeeck_(integer *, real *, real *);
-    static integer iz, nx;
-    static char subnam[6];
+    integer iz, nx;
+    char subnam[6];
     extern integer iparmq_(integer *, char *, char *, integer *, integer *,
 	    integer *, integer *);
 
@@ -41290,7 +41290,7 @@ integer iparmq_(integer *ispec, char *name__, char *opts, integer *n, integer
     integer i_nint(real *);
 
     /* Local variables */
-    static integer nh, ns;
+    integer nh, ns;
 
 
 /*
@@ -11,7 +11,7 @@ except NameError:
 # Arguments to pass to f2c. You'll always want -A for ANSI C prototypes
 # Others of interest: -a to not make variables static by default
 #                     -C to check array subscripts
-F2C_ARGS = '-A'
+F2C_ARGS = '-A -a'
 
 # The header to add to the top of the *_lite.c file. Note that dlamch_() calls
 # will be replaced by the macros below by clapack_scrub.scrub_source()
@@ -43,6 +43,7 @@
 
 #include <math.h>
 #include "distributions.h"
+#include "rk_ziggurat.h"
 #include <stdio.h>
 
 #ifndef min
@@ -851,3 +852,170 @@ long rk_logseries(rk_state *state, double p)
     if (V <= q) return 1;
     return 2;
 }
+
+
+/* Batch sampling */
+
+double rk_ziggurat_slow(double u, int i,
+                        unsigned long (*next)(void *), void *src)
+{
+    unsigned long a, b;
+    double x, y, f0, f1;
+
+    for (;;)
+    {
+        /* Base strip: sample from the tail beyond RK_ZIG_R */
+        if (i == 0)
+        {
+            do
+            {
+                a = next(src); b = next(src);
+                x = log(1.0 - RK_ZIG_U53(a, b)) / RK_ZIG_R;
+                a = next(src); b = next(src);
+                y = log(1.0 - RK_ZIG_U53(a, b));
+            } while (-2.0*y < x*x);
+            return (u < 0) ? x - RK_ZIG_R : RK_ZIG_R - x;
+        }
+
+        /* Wedge of layer i */
+        x = u*rk_zig_x[i];
+        f0 = exp(-0.5*(rk_zig_x[i]*rk_zig_x[i] - x*x));
+        f1 = exp(-0.5*(rk_zig_x[i+1]*rk_zig_x[i+1] - x*x));
+        a = next(src); b = next(src);
+        if (f1 + RK_ZIG_U53(a, b)*(f0 - f1) < 1.0)
+            return x;
+
+        /* New draw */
+        a = next(src); b = next(src);
+        u = 2.0*RK_ZIG_U53(a, b) - 1.0;
+        i = RK_ZIG_LAYER(a, b);
+        if (fabs(u) < rk_zig_r[i])
+            return u*rk_zig_x[i];
+    }
+}
+
+static unsigned long rk_next(void *state)
+{
+    return rk_random((rk_state *)state);
+}
+
+static double rk_zig_gauss(rk_state *state)
+{
+    unsigned long a = rk_random(state), b = rk_random(state);
+    double u = 2.0*RK_ZIG_U53(a, b) - 1.0;
+    int i = RK_ZIG_LAYER(a, b);
+
+    if (fabs(u) < rk_zig_r[i])
+        return u*rk_zig_x[i];
+    return rk_ziggurat_slow(u, i, &rk_next, (void *)state);
+}
+
+void rk_fill_gauss(rk_state *state, double *out, size_t n)
+{
+    unsigned long w[2*RK_FILL_BLOCK];
+    size_t k, m;
+    double u;
+    int i;
+
+    for (; n > 0; n -= m, out += m)
+    {
+        m = min(n, RK_FILL_BLOCK);
+        rk_fill_random(state, w, 2*m);
+        for (k = 0; k < m; k++)
+        {
+            u = 2.0*RK_ZIG_U53(w[2*k], w[2*k+1]) - 1.0;
+            i = RK_ZIG_LAYER(w[2*k], w[2*k+1]);
+            if (fabs(u) < rk_zig_r[i])
+                out[k] = u*rk_zig_x[i];
+            else
+                out[k] = rk_ziggurat_slow(u, i, &rk_next, (void *)state);
+        }
+    }
+}
+
+void rk_fill_normal(rk_state *state, double loc, double scale,
+                    double *out, size_t n)
+{
+    size_t k;
+
+    rk_fill_gauss(state, out, n);
+    for (k = 0; k < n; k++)
+        out[k] = loc + scale*out[k];
+}
+
+void rk_fill_standard_exponential(rk_state *state, double *out, size_t n)
+{
+    size_t k;
+
+    rk_fill_double(state, out, n);
+    for (k = 0; k < n; k++)
+        out[k] = -log(1.0 - out[k]);
+}
+
+/* Marsaglia and Tsang's method for shape >= 1 */
+static double rk_zig_standard_gamma(rk_state *state, double b, double c)
+{
+    double U, V, X;
+
+    for (;;)
+    {
+        do
+        {
+            X = rk_zig_gauss(state);
+            V = 1.0 + c*X;
+        } while (V <= 0.0);
+
+        V = V*V*V;
+        U = rk_double(state);
+        if (U < 1.0 - 0.0331*(X*X)*(X*X)) return (b*V);
+        if (log(U) < 0.5*X*X + b*(1. - V + log(V))) return (b*V);
+    }
+}
+
+void rk_fill_standard_gamma(rk_state *state, double shape,
+                            double *out, size_t n)
+{
+    double b, c;
+    size_t k;
+
+    if (shape == 1.0)
+    {
+        rk_fill_standard_exponential(state, out, n);
+        return;
+    }
+
+    b = ((shape < 1.0) ? shape + 1.0 : shape) - 1./3.;
+    c = 1./sqrt(9*b);
+    for (k = 0; k < n; k++)
+        out[k] = rk_zig_standard_gamma(state, b, c);
+
+    /* G(shape) = G(shape+1) U^(1/shape) */
+    if (shape < 1.0)
+        for (k = 0; k < n; k++)
+            out[k] *= pow(1.0 - rk_double(state), 1./shape);
+}
+
+void rk_fill_gamma(rk_state *state, double shape, double scale,
+                   double *out, size_t n)
+{
+    size_t k;
+
+    rk_fill_standard_gamma(state, shape, out, n);
+    for (k = 0; k < n; k++)
+        out[k] *= scale;
+}
+
+void rk_fill_standard_t(rk_state *state, double df, double *out, size_t n)
+{
+    double G[RK_FILL_BLOCK];
+    size_t k, m;
+
+    for (; n > 0; n -= m, out += m)
+    {
+        m = min(n, RK_FILL_BLOCK);
+        rk_fill_gauss(state, out, m);
+        rk_fill_standard_gamma(state, df/2, G, m);
+        for (k = 0; k < m; k++)
+            out[k] *= sqrt(df/2)/sqrt(G[k]);
+    }
+}
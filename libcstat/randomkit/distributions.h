@@ -177,6 +177,28 @@ extern double rk_triangular(rk_state *state, double left, double mode, double ri
 /* Logarithmic series distribution */
 extern long rk_logseries(rk_state *state, double p);
 
+/* Batch sampling.
+ *
+ * The rk_fill_* functions store n draws in out. Normal deviates are
+ * generated by the ziggurat method (Marsaglia and Tsang 2000, in the
+ * form of Doornik 2005) from two 32-bit words each, hence they are
+ * not the same as those of rk_gauss, and neither are the gamma and
+ * t deviates built upon them. Exponential deviates are the same as
+ * n calls of rk_standard_exponential.
+ */
+extern void rk_fill_gauss(rk_state *state, double *out, size_t n);
+extern void rk_fill_normal(rk_state *state, double loc, double scale,
+                           double *out, size_t n);
+extern void rk_fill_standard_exponential(rk_state *state, double *out, size_t n);
+
+/* Gamma deviates by the method of Marsaglia and Tsang for any shape,
+ * with the boost U^(1/shape) when shape < 1. */
+extern void rk_fill_standard_gamma(rk_state *state, double shape,
+                                   double *out, size_t n);
+extern void rk_fill_gamma(rk_state *state, double shape, double scale,
+                          double *out, size_t n);
+extern void rk_fill_standard_t(rk_state *state, double df, double *out, size_t n);
+
 #ifdef __cplusplus
 }
 #endif
@@ -108,6 +108,7 @@ char *rk_strerror[RK_ERR_MAX] =
 
 /* static functions */
 static unsigned long rk_hash(unsigned long key);
+static void rk_reload(rk_state *state);
 
 void rk_seed(unsigned long seed, rk_state *state)
 {
@@ -182,41 +183,77 @@ rk_error rk_randomseed(rk_state *state)
 #define LOWER_MASK 0x7fffffffUL
 
 /* Slightly optimised reference implementation of the Mersenne Twister */
-unsigned long rk_random(rk_state *state)
+
+/* Tempering */
+#define RK_TEMPER(y) \
+  (y) ^= ((y) >> 11); \
+  (y) ^= ((y) << 7) & 0x9d2c5680UL; \
+  (y) ^= ((y) << 15) & 0xefc60000UL; \
+  (y) ^= ((y) >> 18)
+
+static void rk_reload(rk_state *state)
 {
   unsigned long y;
+  int i;
 
-  if (state->pos == RK_STATE_LEN)
+  for (i=0;i<N-M;i++)
 	{
-    int i;
+    y = (state->key[i] & UPPER_MASK) | (state->key[i+1] & LOWER_MASK);
+    state->key[i] = state->key[i+M] ^ (y>>1) ^ (-(y & 1) & MATRIX_A);
+  }
+  for (;i<N-1;i++)
+	{
+    y = (state->key[i] & UPPER_MASK) | (state->key[i+1] & LOWER_MASK);
+    state->key[i] = state->key[i+(M-N)] ^ (y>>1) ^ (-(y & 1) & MATRIX_A);
+  }
+  y = (state->key[N-1] & UPPER_MASK) | (state->key[0] & LOWER_MASK);
+  state->key[N-1] = state->key[M-1] ^ (y>>1) ^ (-(y & 1) & MATRIX_A);
 
-    for (i=0;i<N-M;i++)
-		{
-      y = (state->key[i] & UPPER_MASK) | (state->key[i+1] & LOWER_MASK);
-      state->key[i] = state->key[i+M] ^ (y>>1) ^ (-(y & 1) & MATRIX_A);
-    }
-    for (;i<N-1;i++)
-		{
-      y = (state->key[i] & UPPER_MASK) | (state->key[i+1] & LOWER_MASK);
-      state->key[i] = state->key[i+(M-N)] ^ (y>>1) ^ (-(y & 1) & MATRIX_A);
-    }
-    y = (state->key[N-1] & UPPER_MASK) | (state->key[0] & LOWER_MASK);
-    state->key[N-1] = state->key[M-1] ^ (y>>1) ^ (-(y & 1) & MATRIX_A);
+  state->pos = 0;
+}
 
-    state->pos = 0;
-  }
+unsigned long rk_random(rk_state *state)
+{
+  unsigned long y;
+
+  if (state->pos == RK_STATE_LEN)
+    rk_reload(state);
   
   y = state->key[state->pos++];
-
-  /* Tempering */
-  y ^= (y >> 11);
-  y ^= (y << 7) & 0x9d2c5680UL;
-  y ^= (y << 15) & 0xefc60000UL;
-  y ^= (y >> 18);
+  RK_TEMPER(y);
 
   return y;
 }
 
+void rk_fill_random(rk_state *state, unsigned long *out, size_t n)
+{
+  unsigned long y;
+  size_t i, m;
+  const unsigned long *key;
+
+  while (n > 0)
+  {
+    if (state->pos == RK_STATE_LEN)
+      rk_reload(state);
+    m = RK_STATE_LEN - state->pos;
+    if (m > n)
+      m = n;
+
+    /* Independent iterations, which the compiler may vectorize */
+    key = state->key + state->pos;
+    for (i=0; i<m; i++)
+    {
+      y = key[i];
+      RK_TEMPER(y);
+      out[i] = y;
+    }
+
+    state->pos += (int)m;
+    out += m;
+    n -= m;
+  }
+}
+
 long rk_long(rk_state *state)
 {
 	return rk_ulong(state) >> 1;
@@ -268,6 +305,20 @@ double rk_double(rk_state *state)
 	return (a * 67108864.0 + b) / 9007199254740992.0;
 }
 
+void rk_fill_double(rk_state *state, double *out, size_t n)
+{
+	unsigned long w[2*RK_FILL_BLOCK];
+	size_t i, m;
+
+	for (; n > 0; n -= m, out += m)
+	{
+		m = (n < RK_FILL_BLOCK) ? n : RK_FILL_BLOCK;
+		rk_fill_random(state, w, 2*m);
+		for (i=0; i<m; i++)
+			out[i] = ((w[2*i] >> 5) * 67108864.0 + (w[2*i+1] >> 6)) / 9007199254740992.0;
+	}
+}
+
 void rk_fill(void *buffer, size_t size, rk_state *state)
 {
 	unsigned long r;
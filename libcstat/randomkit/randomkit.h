@@ -109,6 +109,9 @@ extern char *rk_strerror[RK_ERR_MAX];
 /* Maximum generated random value */
 #define RK_MAX 0xFFFFFFFFUL
 
+/* Number of values generated at a time by the rk_fill_* functions */
+#define RK_FILL_BLOCK 256
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -153,6 +156,18 @@ extern unsigned long rk_interval(unsigned long max, rk_state *state);
  */
 extern double rk_double(rk_state *state);
 
+/*
+ * Fills out with n random unsigned longs between 0 and RK_MAX
+ * inclusive, the same as n calls of rk_random but faster.
+ */
+extern void rk_fill_random(rk_state *state, unsigned long *out, size_t n);
+
+/*
+ * Fills out with n random doubles between 0.0 and 1.0, 1.0 excluded,
+ * the same as n calls of rk_double but faster.
+ */
+extern void rk_fill_double(rk_state *state, double *out, size_t n);
+
 /*
  * fill the buffer with size random bytes
  */
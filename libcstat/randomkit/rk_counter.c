@@ -0,0 +1,229 @@
+/* Counter-based random numbers */
+
+#include <limits.h>
+#include <math.h>
+#include "rk_counter.h"
+#include "rk_ziggurat.h"
+
+#define RK_WORD 0xFFFFFFFFUL
+
+/* Number of blocks computed at a time by the fill functions */
+#define RK_LANES 64
+
+/* Philox4x32 multipliers and Weyl key increments */
+#define RK_PHILOX_M0 0xD2511F53UL
+#define RK_PHILOX_M1 0xCD9E8D57UL
+#define RK_PHILOX_W0 0x9E3779B9UL
+#define RK_PHILOX_W1 0xBB67AE85UL
+#define RK_PHILOX_ROUNDS 10
+
+/*
+ * 32x32 -> 64 bit product. Where unsigned long has 64 bits, it is a
+ * single multiplication; otherwise it is computed on 16-bit halves so
+ * that it does not require a 64 bit integer type.
+ */
+#if ULONG_MAX > 0xFFFFFFFFUL
+#define RK_MULHILO(a, b, hi, lo) \
+	do { \
+		unsigned long _p = (a) * (b); \
+		(hi) = _p >> 32; \
+		(lo) = _p & RK_WORD; \
+	} while (0)
+#else
+#define RK_MULHILO(a, b, hi, lo) _rk_mulhilo(a, b, &(hi), &(lo))
+
+static void _rk_mulhilo(unsigned long a, unsigned long b,
+			unsigned long* hi, unsigned long* lo)
+{
+	unsigned long al = a & 0xFFFFUL, ah = a >> 16;
+	unsigned long bl = b & 0xFFFFUL, bh = b >> 16;
+	unsigned long ll = al*bl, lh = al*bh, hl = ah*bl, hh = ah*bh;
+	unsigned long mid = (ll >> 16) + (lh & 0xFFFFUL) + (hl & 0xFFFFUL);
+
+	*lo = (((mid & 0xFFFFUL) << 16) | (ll & 0xFFFFUL)) & RK_WORD;
+	*hi = (hh + (lh >> 16) + (hl >> 16) + (mid >> 16)) & RK_WORD;
+}
+#endif
+
+void rk_philox(unsigned long ctr[4], const unsigned long key[2])
+{
+	unsigned long k0 = key[0] & RK_WORD, k1 = key[1] & RK_WORD;
+	unsigned long c0 = ctr[0] & RK_WORD, c1 = ctr[1] & RK_WORD;
+	unsigned long c2 = ctr[2] & RK_WORD, c3 = ctr[3] & RK_WORD;
+	unsigned long hi0, lo0, hi1, lo1;
+	int r;
+
+	for (r = 0; r < RK_PHILOX_ROUNDS; r++) {
+		if (r > 0) {
+			k0 = (k0 + RK_PHILOX_W0) & RK_WORD;
+			k1 = (k1 + RK_PHILOX_W1) & RK_WORD;
+		}
+		RK_MULHILO(RK_PHILOX_M0, c0, hi0, lo0);
+		RK_MULHILO(RK_PHILOX_M1, c2, hi1, lo1);
+		c0 = hi1 ^ c1 ^ k0;
+		c1 = lo1;
+		c2 = hi0 ^ c3 ^ k1;
+		c3 = lo0;
+	}
+
+	ctr[0] = c0;
+	ctr[1] = c1;
+	ctr[2] = c2;
+	ctr[3] = c3;
+}
+
+/* The seed fills the key, the counter fills the first 3 words */
+static void _rk_counter_block(unsigned long ctr[4], unsigned long seed,
+			      unsigned long i, unsigned long j, unsigned long k)
+{
+	unsigned long key[2];
+
+	key[0] = seed & RK_WORD;
+	key[1] = (seed >> 16 >> 16) & RK_WORD;
+	ctr[0] = i;
+	ctr[1] = j;
+	ctr[2] = k;
+	ctr[3] = 0;
+	rk_philox(ctr, key);
+}
+
+double rk_counter_double(unsigned long seed,
+			 unsigned long i, unsigned long j, unsigned long k)
+{
+	unsigned long ctr[4];
+	long a, b;
+
+	_rk_counter_block(ctr, seed, i, j, k);
+
+	/* Same 53-bit construction as rk_double */
+	a = ctr[0] >> 5;
+	b = ctr[1] >> 6;
+	return (a * 67108864.0 + b) / 9007199254740992.0;
+}
+
+unsigned long rk_counter_random(unsigned long seed,
+				unsigned long i, unsigned long j, unsigned long k)
+{
+	unsigned long ctr[4];
+
+	_rk_counter_block(ctr, seed, i, j, k);
+	return ctr[0];
+}
+
+
+/*
+ * Philox blocks of the n <= RK_LANES counters (i, j, k + l, w), l < n,
+ * stored word by word: c[0][l] is the first word of block l. The
+ * blocks are independent, hence the rounds are computed lane by lane
+ * in a loop the compiler may vectorize.
+ */
+static void _rk_counter_lanes(unsigned long c[4][RK_LANES], int n,
+			      unsigned long seed, unsigned long i,
+			      unsigned long j, unsigned long k,
+			      unsigned long w)
+{
+	unsigned long k0 = seed & RK_WORD, k1 = (seed >> 16 >> 16) & RK_WORD;
+	unsigned long hi0, lo0, hi1, lo1, c0, c1, c2, c3;
+	int l, r;
+
+	for (l = 0; l < n; l++) {
+		c[0][l] = i & RK_WORD;
+		c[1][l] = j & RK_WORD;
+		c[2][l] = (k + l) & RK_WORD;
+		c[3][l] = w & RK_WORD;
+	}
+
+	for (r = 0; r < RK_PHILOX_ROUNDS; r++) {
+		if (r > 0) {
+			k0 = (k0 + RK_PHILOX_W0) & RK_WORD;
+			k1 = (k1 + RK_PHILOX_W1) & RK_WORD;
+		}
+		for (l = 0; l < n; l++) {
+			c0 = c[0][l];
+			c1 = c[1][l];
+			c2 = c[2][l];
+			c3 = c[3][l];
+			RK_MULHILO(RK_PHILOX_M0, c0, hi0, lo0);
+			RK_MULHILO(RK_PHILOX_M1, c2, hi1, lo1);
+			c[0][l] = hi1 ^ c1 ^ k0;
+			c[1][l] = lo1;
+			c[2][l] = hi0 ^ c3 ^ k1;
+			c[3][l] = lo0;
+		}
+	}
+}
+
+void rk_counter_fill_double(unsigned long seed,
+			    unsigned long i, unsigned long j, unsigned long k,
+			    double *out, unsigned long n)
+{
+	unsigned long c[4][RK_LANES];
+	int l, m;
+
+	for (; n > 0; n -= m, k += m, out += m) {
+		m = (n < RK_LANES) ? (int)n : RK_LANES;
+		_rk_counter_lanes(c, m, seed, i, j, k, 0);
+		for (l = 0; l < m; l++)
+			out[l] = RK_ZIG_U53(c[0][l], c[1][l]);
+	}
+}
+
+/*
+ * Words for the slow path of the ziggurat: the last two words of the
+ * block, then those of the blocks (i, j, k, w) for w = 1, 2, ...
+ */
+typedef struct {
+	unsigned long seed, i, j, k, w;
+	unsigned long ctr[4];
+	int pos;
+} _rk_counter_source;
+
+static unsigned long _rk_counter_next(void *src)
+{
+	_rk_counter_source *s = (_rk_counter_source *)src;
+	unsigned long key[2];
+
+	if (s->pos == 4) {
+		key[0] = s->seed & RK_WORD;
+		key[1] = (s->seed >> 16 >> 16) & RK_WORD;
+		s->ctr[0] = s->i;
+		s->ctr[1] = s->j;
+		s->ctr[2] = s->k;
+		s->ctr[3] = ++s->w;
+		rk_philox(s->ctr, key);
+		s->pos = 0;
+	}
+	return s->ctr[s->pos++];
+}
+
+void rk_counter_fill_gauss(unsigned long seed,
+			   unsigned long i, unsigned long j, unsigned long k,
+			   double *out, unsigned long n)
+{
+	unsigned long c[4][RK_LANES];
+	_rk_counter_source s;
+	double u;
+	int l, m, layer;
+
+	for (; n > 0; n -= m, k += m, out += m) {
+		m = (n < RK_LANES) ? (int)n : RK_LANES;
+		_rk_counter_lanes(c, m, seed, i, j, k, 0);
+		for (l = 0; l < m; l++) {
+			u = 2.0 * RK_ZIG_U53(c[0][l], c[1][l]) - 1.0;
+			layer = RK_ZIG_LAYER(c[0][l], c[1][l]);
+			if (fabs(u) < rk_zig_r[layer]) {
+				out[l] = u * rk_zig_x[layer];
+				continue;
+			}
+			s.seed = seed;
+			s.i = i;
+			s.j = j;
+			s.k = (k + l) & RK_WORD;
+			s.w = 0;
+			s.ctr[2] = c[2][l];
+			s.ctr[3] = c[3][l];
+			s.pos = 2;
+			out[l] = rk_ziggurat_slow(u, layer, &_rk_counter_next, &s);
+		}
+	}
+}
@@ -0,0 +1,84 @@
+/* Counter-based random numbers */
+
+/*
+ * Counter-based generators (Salmon et al, "Parallel random numbers:
+ * as easy as 1, 2, 3", SC 2011) compute each random number as a pure
+ * function of a key (the seed) and a counter (e.g. a voxel or
+ * permutation index). Unlike rk_state, there is no sequential state
+ * to share, so draws are reproducible regardless of the order in
+ * which they are made, and therefore of the number of threads.
+ *
+ * Typical use:
+ *
+ * {
+ * 	unsigned long seed = 1, i, j, k;
+ * 	double u;
+ * 	...
+ * 	u = rk_counter_double(seed, i, j, k); // Uniform in [0, 1)
+ * }
+ *
+ * The underlying block function is Philox4x32-10. Words are held in
+ * unsigned longs and only their 32 lower bits are used, so results
+ * are the same on 32 and 64 bit platforms.
+ */
+
+#ifndef _RK_COUNTER_
+#define _RK_COUNTER_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Philox4x32-10 block function: replaces the 4 counter words ctr
+ * with the corresponding 4 random words for the 2 key words key.
+ */
+extern void rk_philox(unsigned long ctr[4], const unsigned long key[2]);
+
+/*
+ * Returns a random double between 0.0 and 1.0, 1.0 excluded, that
+ * only depends on the seed and the counter (i, j, k).
+ */
+extern double rk_counter_double(unsigned long seed,
+				unsigned long i,
+				unsigned long j,
+				unsigned long k);
+
+/*
+ * Returns a random unsigned long between 0 and 0xFFFFFFFF inclusive
+ * (32 random bits) that only depends on the seed and the counter
+ * (i, j, k).
+ */
+extern unsigned long rk_counter_random(unsigned long seed,
+				       unsigned long i,
+				       unsigned long j,
+				       unsigned long k);
+
+/*
+ * Fills out with the n random doubles rk_counter_double(seed, i, j,
+ * k + m), m < n, computing several blocks at a time.
+ */
+extern void rk_counter_fill_double(unsigned long seed,
+				   unsigned long i,
+				   unsigned long j,
+				   unsigned long k,
+				   double *out, unsigned long n);
+
+/*
+ * Fills out with n standard normal deviates drawn by the ziggurat
+ * method, the m-th of which only depends on the seed and the counter
+ * (i, j, k + m). The first two words of that block are those of
+ * rk_counter_double, hence normals and uniforms needed at the same
+ * counters should be drawn with different i or j.
+ */
+extern void rk_counter_fill_gauss(unsigned long seed,
+				  unsigned long i,
+				  unsigned long j,
+				  unsigned long k,
+				  double *out, unsigned long n);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _RK_COUNTER_ */
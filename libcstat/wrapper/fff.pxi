@@ -27,6 +27,30 @@ cdef extern from "fff_base.h":
         
     unsigned int fff_nbytes(fff_datatype type) 
 
+    ctypedef enum fff_profile_timer:
+        FFF_PROFILE_JOINT_HIST = 0,
+        FFF_PROFILE_ONESAMPLE = 1,
+        FFF_PROFILE_GLM_KF = 2,
+        FFF_PROFILE_GMM = 3,
+        FFF_PROFILE_DIJKSTRA = 4,
+        FFF_PROFILE_NTIMERS = 5
+
+    ctypedef enum fff_profile_counter:
+        FFF_PROFILE_VOXELS = 0,
+        FFF_PROFILE_EM_ITERATIONS = 1,
+        FFF_PROFILE_RELAXATIONS = 2,
+        FFF_PROFILE_ALLOCATIONS = 3,
+        FFF_PROFILE_NCOUNTERS = 4
+
+    ctypedef struct fff_profile:
+        unsigned long calls[5]
+        double seconds[5]
+        unsigned long count[4]
+
+    int fff_profile_enabled()
+    fff_profile* fff_profile_get()
+    void fff_profile_reset()
+
 # Exports from fff_vector.h 
 cdef extern from "fff_vector.h":
     
@@ -117,6 +141,9 @@ cdef extern from "fff_array.h":
     fff_array* fff_array_new2d(fff_datatype datatype, size_t dimX, size_t dimY)
     fff_array* fff_array_new3d(fff_datatype datatype, size_t dimX, size_t dimY, size_t dimZ)
     void fff_array_delete(fff_array* thisone)
+    fff_array fff_array_view(fff_datatype datatype, void* buf, 
+                             size_t dimX, size_t dimY, size_t dimZ, size_t dimT,
+                             size_t offX, size_t offY, size_t offZ, size_t offT)
     double fff_array_get(fff_array* thisone, size_t x, size_t y, size_t z, size_t t)
     fff_array fff_array_get_block(fff_array* thisone,
                                   size_t x0, size_t x1, size_t fX,
@@ -170,6 +197,14 @@ cdef extern from "randomkit.h":
     double rk_gauss(rk_state *state)
     
 
+# Exports from fff_threads.h
+cdef extern from "fff_threads.h":
+
+    ctypedef void (*fff_parallel_func)(int rank, int nthreads, void* params)
+
+    int fff_threads_count(int nthreads)
+    void fff_parallel_range(size_t n, int rank, int nthreads, size_t* start, size_t* stop)
+
 
     
 # Exports from the Python fff wrapper
@@ -181,6 +216,7 @@ cdef extern from "fffpy.h":
         fff_vector** vector 
         size_t index 
         size_t size 
+        size_t start
 
     void fffpy_import_array()
     fff_vector* fff_vector_fromPyArray(ndarray x)
@@ -198,5 +234,8 @@ cdef extern from "fffpy.h":
     void fffpy_multi_iterator_delete(fffpy_multi_iterator* thisone)
     void fffpy_multi_iterator_update(fffpy_multi_iterator* thisone)
     void fffpy_multi_iterator_reset(fffpy_multi_iterator* thisone)
+    fffpy_multi_iterator** fffpy_multi_iterator_split(fffpy_multi_iterator* thisone, int nparts)
+    void fffpy_multi_iterator_split_delete(fffpy_multi_iterator** parts, int nparts)
+    void fffpy_parallel_run(int nthreads, fff_parallel_func func, void* params)
 
     
@@ -4,6 +4,8 @@
 
 #define COPY_BUFFERS_USING_NUMPY 1
 
+static void _fffpy_profile_share(void); 
+
 
 /* This function must be called before the module can work
    because PyArray_API is defined static, in order not to share that symbol
@@ -11,15 +13,46 @@
 */
 void fffpy_import_array(void) { 
   import_array(); 
+  _fffpy_profile_share(); 
   return;
 }
 
+/* 
+   Every extension module links with its own copy of the library,
+   hence its own instrumentation counters. The first module to be
+   imported publishes the address of its counters as sys._fff_profile,
+   and the following ones update the same counters.
+*/ 
+static void _fffpy_profile_share(void)
+{
+#ifdef FFF_PROFILE
+  PyObject* addr = PySys_GetObject("_fff_profile"); 
+
+  if (addr != NULL) {
+    fff_profile_share((fff_profile*)PyLong_AsVoidPtr(addr)); 
+    return; 
+  }
+  addr = PyLong_FromVoidPtr((void*)fff_profile_get()); 
+  if (addr == NULL) {
+    PyErr_Clear(); 
+    return; 
+  }
+  PySys_SetObject("_fff_profile", addr); 
+  Py_DECREF(addr); 
+#endif
+  return; 
+}
+
 
 /* Static functions */
 static npy_intp _PyArray_main_axis(const PyArrayObject* x, int* ok); 
+static int _PyArray_is_matrix_view(const PyArrayObject* x); 
 static fff_vector* _fff_vector_new_from_buffer(const char* data, npy_intp dim, npy_intp stride, int type, int itemsize);
 static fff_vector* _fff_vector_new_from_PyArrayIter(const PyArrayIterObject* it, npy_intp axis);
 static void _fff_vector_sync_with_PyArrayIter(fff_vector* y, const PyArrayIterObject* it, npy_intp axis); 
+static fffpy_multi_iterator* _fffpy_multi_iterator_new_from_arrays(int narr, int axis, PyObject** arrays); 
+static void _fffpy_multi_iterator_sync(fffpy_multi_iterator* thisone, int i); 
+static void _PyArray_MultiIter_GOTO1D_AllButAxis(PyArrayMultiIterObject* multi, npy_intp ind); 
 
 
 /* Routines for copying 1d arrays into contiguous double arrays */ 
@@ -62,8 +95,10 @@ static fff_vector* _fff_vector_new_from_buffer(const char* data, npy_intp dim, n
   fff_vector* y; 
   size_t sizeof_double = sizeof(double); 
 
-  /* If the input array is double and is aligned, just wrap without copying */
-  if ((type == NPY_DOUBLE) && (itemsize==sizeof_double)) {
+  /* If the input array is double and is aligned, just wrap without
+     copying; the stride then needs be a whole number of doubles */
+  if ((type == NPY_DOUBLE) && (itemsize==sizeof_double) && 
+      (((size_t)data % sizeof_double) == 0) && ((stride % sizeof_double) == 0)) {
     y = (fff_vector*)malloc(sizeof(fff_vector)); 
     y->size = (size_t)dim;
     y->stride = (size_t)stride/sizeof_double;
@@ -174,6 +209,28 @@ PyArrayObject* fff_vector_const_toPyArray(const fff_vector* y)
 
 
 
+/* 
+   Check whether a two-dimensional PyArray may be seen as a
+   fff_matrix: double and aligned, with unit stride along the second
+   axis (unless it has a single column) and a row stride that is a
+   whole number of doubles at least as large as the number of
+   columns (unless it has a single row).
+*/
+static int _PyArray_is_matrix_view(const PyArrayObject* x)
+{
+  npy_intp size1 = PyArray_DIM(x,0), size2 = PyArray_DIM(x,1);
+  npy_intp stride1 = PyArray_STRIDE(x,0), stride2 = PyArray_STRIDE(x,1);
+  npy_intp sizeof_double = (npy_intp)sizeof(double);
+
+  if ((PyArray_TYPE(x) != NPY_DOUBLE) || (!PyArray_ISALIGNED(x)))
+    return 0;
+  if ((size2 > 1) && (stride2 != sizeof_double))
+    return 0;
+  if ((size1 > 1) && ((stride1 % sizeof_double) || (stride1 < size2*sizeof_double)))
+    return 0;
+  return 1;
+}
+
 /* 
    Get a fff_matrix from an input PyArray. This function acts as a
    fff_vector constructor that is compatible with fff_vector_delete.
@@ -189,15 +246,14 @@ fff_matrix* fff_matrix_fromPyArray(const PyArrayObject* x)
   }
 
 
-  /* If the PyArray is double, contiguous and aligned just wrap without
-     copying */
-  if ((PyArray_TYPE(x) == NPY_DOUBLE) && 
-       (PyArray_ISCONTIGUOUS(x)) && 
-       (PyArray_ISALIGNED(x))) {
+  /* If the PyArray is double and aligned, with contiguous rows,
+     just wrap without copying: the row stride becomes the leading
+     dimension of the fff_matrix */
+  if (_PyArray_is_matrix_view(x)) {
     y = (fff_matrix*) malloc(sizeof(fff_matrix)); 
     y->size1 = (size_t) PyArray_DIM(x,0);
     y->size2 = (size_t) PyArray_DIM(x,1);
-    y->tda = y->size2; 
+    y->tda = (y->size1 > 1) ? (size_t)PyArray_STRIDE(x,0)/sizeof(double) : y->size2; 
     y->data = (double*) PyArray_DATA(x);
     y->owner = 0;
   }
@@ -379,6 +435,7 @@ fff_array* fff_array_fromPyArray(const PyArrayObject* x)
   size_t dimX = 1, dimY = 1, dimZ = 1, dimT = 1; 
   size_t offX = 0, offY = 0, offZ = 0, offT = 0; 
   size_t ndims = (size_t)PyArray_NDIM(x);
+  int i; 
 
   /* Check that the input array has less than four dimensions */ 
   if (ndims > 4) {
@@ -397,8 +454,13 @@ fff_array* fff_array_fromPyArray(const PyArrayObject* x)
     return NULL;    
   }
   
-  /* Dimensions and offsets */ 
+  /* Dimensions and offsets, which must be whole numbers of items */ 
   nbytes = fff_nbytes(datatype); 
+  for (i=0; i<(int)ndims; i++)
+    if (PyArray_STRIDE(x, i) % (npy_intp)nbytes) {
+      FFF_ERROR("Input array strides are not multiples of the item size", EINVAL);
+      return NULL;
+    }
   dimX = PyArray_DIM(x, 0);
   offX = PyArray_STRIDE(x, 0)/nbytes;
   if (ndims > 1) {
@@ -506,9 +568,28 @@ fffpy_multi_iterator* fffpy_multi_iterator_new(int narr, int axis, ...)
 {
   fffpy_multi_iterator* thisone; 
   va_list va;
+  PyObject **arrays; 
+  int i;
+
+  arrays = (PyObject**)malloc(narr*sizeof(PyObject*)); 
+  va_start(va, axis);
+  for (i=0; i<narr; i++) 
+    arrays[i] = va_arg(va, PyObject *);
+  va_end(va);
+
+  thisone = _fffpy_multi_iterator_new_from_arrays(narr, axis, arrays); 
+  free(arrays); 
+
+  return thisone; 
+}
+
+
+static fffpy_multi_iterator* _fffpy_multi_iterator_new_from_arrays(int narr, int axis, PyObject** arrays)
+{
+  fffpy_multi_iterator* thisone; 
   fff_vector** vector; 
   PyArrayMultiIterObject *multi;
-  PyObject *current, *arr;
+  PyObject *arr;
   int i, err=0;
 
   /* Create new instance */ 
@@ -516,7 +597,7 @@ fffpy_multi_iterator* fffpy_multi_iterator_new(int narr, int axis, ...)
   multi = PyArray_malloc(sizeof(PyArrayMultiIterObject));
   vector = (fff_vector**)malloc(narr*sizeof(fff_vector*)); 
 
-  /* Initialize the PyArrayMultiIterObject instance from the variadic arguments */ 
+  /* Initialize the PyArrayMultiIterObject instance from the arrays */ 
   PyObject_Init((PyObject *)multi, &PyArrayMultiIter_Type);
   
   for (i=0; i<narr; i++) 
@@ -524,10 +605,8 @@ fffpy_multi_iterator* fffpy_multi_iterator_new(int narr, int axis, ...)
   multi->numiter = narr;
   multi->index = 0;
   
-  va_start(va, axis);
   for (i=0; i<narr; i++) {
-    current = va_arg(va, PyObject *);
-    arr = PyArray_FROM_O(current);
+    arr = PyArray_FROM_O(arrays[i]);
     if (arr==NULL) {
       err=1; break;
     }
@@ -537,8 +616,6 @@ fffpy_multi_iterator* fffpy_multi_iterator_new(int narr, int axis, ...)
     }
   }
   
-  va_end(va);
-
   /* Test */
   if (!err && _PyArray_BroadcastAllButAxis(multi, axis) < 0) 
     err=1; 
@@ -564,6 +641,8 @@ fffpy_multi_iterator* fffpy_multi_iterator_new(int narr, int axis, ...)
   thisone->multi = multi; 
   thisone->index = thisone->multi->index; 
   thisone->size = thisone->multi->size;   
+  thisone->start = 0; 
+  thisone->nogil = 0; 
 
   return thisone; 
 }
@@ -587,7 +666,7 @@ void fffpy_multi_iterator_update(fffpy_multi_iterator* thisone)
 
   PyArray_MultiIter_NEXT(thisone->multi); 
   for(i=0; i<thisone->narr; i++) 
-    _fff_vector_sync_with_PyArrayIter(thisone->vector[i], (const PyArrayIterObject*)thisone->multi->iters[i], thisone->axis); 
+    _fffpy_multi_iterator_sync(thisone, i); 
   thisone->index = thisone->multi->index; 
   return; 
 }
@@ -596,13 +675,140 @@ void fffpy_multi_iterator_reset(fffpy_multi_iterator* thisone)
 {
   unsigned int i; 
 
-  PyArray_MultiIter_RESET(thisone->multi); 
+  if (thisone->start == 0) 
+    PyArray_MultiIter_RESET(thisone->multi); 
+  else
+    _PyArray_MultiIter_GOTO1D_AllButAxis(thisone->multi, (npy_intp)thisone->start); 
   for(i=0; i<thisone->narr; i++) 
-    _fff_vector_sync_with_PyArrayIter(thisone->vector[i], (const PyArrayIterObject*)thisone->multi->iters[i], thisone->axis); 
+    _fffpy_multi_iterator_sync(thisone, i); 
   thisone->index = thisone->multi->index; 
   return; 
 }
 
+
+/* 
+   Splitting a multi-iterator. 
+
+   Each part is a new multi-iterator on the same arrays, moved to the
+   start of its sub-range and whose size is the end of its
+   sub-range. Parts copy non-double data using fff_vector_fetch
+   rather than NumPy, so that they do not need the GIL once created.
+*/
+fffpy_multi_iterator** fffpy_multi_iterator_split(const fffpy_multi_iterator* thisone, int nparts)
+{
+  fffpy_multi_iterator** parts; 
+  PyObject **arrays; 
+  PyArrayObject* ao; 
+  size_t start, stop; 
+  int i, k, itemsize; 
+
+  /* Check that all copies can be done without NumPy. This holds for
+     double arrays too, since those that cannot be wrapped are
+     copied. */ 
+  for (i=0; i<thisone->narr; i++) {
+    ao = thisone->multi->iters[i]->ao; 
+    itemsize = PyArray_ITEMSIZE(ao); 
+    if ((fff_datatype_fromNumPy(PyArray_TYPE(ao)) == FFF_UNKNOWN_TYPE) || 
+	(!PyArray_ISALIGNED(ao)) || 
+	(PyArray_STRIDE(ao, thisone->axis) < 0) || 
+	(PyArray_STRIDE(ao, thisone->axis) % itemsize)) 
+      return NULL; 
+  }
+
+  parts = (fffpy_multi_iterator**)calloc(nparts, sizeof(fffpy_multi_iterator*)); 
+  arrays = (PyObject**)malloc(thisone->narr*sizeof(PyObject*)); 
+  for (i=0; i<thisone->narr; i++) 
+    arrays[i] = (PyObject*)thisone->multi->iters[i]->ao; 
+
+  for (k=0; k<nparts; k++) {
+    parts[k] = _fffpy_multi_iterator_new_from_arrays(thisone->narr, thisone->axis, arrays); 
+    if (parts[k] == NULL) {
+      fffpy_multi_iterator_split_delete(parts, nparts); 
+      parts = NULL; 
+      break; 
+    }
+    fff_parallel_range(thisone->size, k, nparts, &start, &stop); 
+    parts[k]->start = start; 
+    parts[k]->size = stop; 
+    parts[k]->nogil = 1; 
+    fffpy_multi_iterator_reset(parts[k]); 
+  }
+  
+  free(arrays); 
+  return parts; 
+}
+
+
+void fffpy_multi_iterator_split_delete(fffpy_multi_iterator** parts, int nparts)
+{
+  int k; 
+
+  if (parts == NULL) 
+    return; 
+  for (k=0; k<nparts; k++) 
+    if (parts[k] != NULL) 
+      fffpy_multi_iterator_delete(parts[k]); 
+  free(parts); 
+  return; 
+}
+
+
+void fffpy_parallel_run(int nthreads, fff_parallel_func func, void* params)
+{
+  Py_BEGIN_ALLOW_THREADS
+  fff_parallel_run(nthreads, func, params); 
+  Py_END_ALLOW_THREADS
+  return; 
+}
+
+
+/* Sync the i-th vector of a multi-iterator with the current position */ 
+static void _fffpy_multi_iterator_sync(fffpy_multi_iterator* thisone, int i)
+{
+  const PyArrayIterObject* it = (const PyArrayIterObject*)thisone->multi->iters[i]; 
+  fff_vector* y = thisone->vector[i]; 
+  PyArrayObject* ao; 
+
+  if (thisone->nogil && y->owner) {
+    ao = (PyArrayObject*) it->ao; 
+    fff_vector_fetch(y, (const void*)PyArray_ITER_DATA(it), 
+		     fff_datatype_fromNumPy(PyArray_TYPE(ao)), 
+		     PyArray_STRIDE(ao, thisone->axis)/PyArray_ITEMSIZE(ao)); 
+  }
+  else 
+    _fff_vector_sync_with_PyArrayIter(y, it, thisone->axis); 
+
+  return; 
+}
+
+
+/* 
+   Move a multi-iterator created by fffpy_multi_iterator_new to a
+   given flat index, that is, an index of the iteration over all axes
+   but the non-iterated one (whose iterator dimension is one). 
+*/
+static void _PyArray_MultiIter_GOTO1D_AllButAxis(PyArrayMultiIterObject* multi, npy_intp ind)
+{
+  PyArrayIterObject* it; 
+  npy_intp r, dim; 
+  int i, k; 
+
+  for (i=0; i<multi->numiter; i++) {
+    it = multi->iters[i]; 
+    it->dataptr = it->ao->data; 
+    for (k=it->nd_m1, r=ind; k>=0; k--) {
+      dim = it->dims_m1[k] + 1; 
+      it->coordinates[k] = r % dim; 
+      r /= dim; 
+      it->dataptr += it->coordinates[k]*it->strides[k]; 
+    }
+    it->index = ind; 
+  }
+  multi->index = ind; 
+
+  return; 
+}
+
 static int _PyArray_BroadcastAllButAxis (PyArrayMultiIterObject* mit, int axis)
 {
   int i, nd;
@@ -3,6 +3,7 @@
 #include <fff_vector.h>
 #include <fff_matrix.h>
 #include <fff_array.h>
+#include <fff_threads.h>
 
 
 /*!
@@ -41,8 +42,8 @@ extern void fffpy_import_array(void);
   This function may be seen as a \c fff_vector constructor compatible
   with \c fff_vector_delete. If the input has type \c PyArray_DOUBLE,
   whether or not it is contiguous, the new \c fff_vector is not
-  self-owned and borrows a reference to the PyArrayObject's
-  data. Otherwise, data are copied and the \c fff_vector is
+  self-owned and borrows a reference to the PyArrayObject's data,
+  provided it is aligned. Otherwise, data are copied and the \c fff_vector is
   self-owned (hence contiguous) just like when created from
   scratch. Notice, the function returns \c NULL if the input array
   has more than one dimension.
@@ -77,16 +78,19 @@ extern PyArrayObject* fff_vector_const_toPyArray(const fff_vector* y);
   \param x input numpy array 
   
   This function may be seen as a \c fff_matrix constructor compatible
-  with \c fff_matrix_free. If the input has type \c PyArray_DOUBLE and
-  is contiguous, the new \c fff_matrix is not self-owned and borrows a
-  reference to the PyArrayObject's data. Otherwise, data are copied
-  and the \c fff_matrix is self-owned (hence contiguous) just like
-  when created from scratch. \c NULL is returned if the input array
-  does not have exactly two dimensions.
-
-  Remarks: 1) non-contiguity provokes a copy because the \c fff_matrix
-  structure does not support strides; 2) matrices in column-major
-  order (Fortran convention) always get copied using this function.
+  with \c fff_matrix_free. If the input has type \c PyArray_DOUBLE, is
+  aligned and its rows are contiguous, the new \c fff_matrix is not
+  self-owned and borrows a reference to the PyArrayObject's data, the
+  row stride being its leading dimension \c tda; this includes
+  blocks of rows and columns of C-ordered matrices. Otherwise, data
+  are copied and the \c fff_matrix is self-owned (hence contiguous)
+  just like when created from scratch. \c NULL is returned if the
+  input array does not have exactly two dimensions.
+
+  Remark: matrices in column-major order (Fortran convention) always
+  get copied using this function, since the \c fff_matrix structure
+  is row-major. Kernels that can read non-double data in place
+  should use \c fff_array_fromPyArray instead.
 */  
 extern fff_matrix* fff_matrix_fromPyArray(const PyArrayObject* x);
 
@@ -120,7 +124,9 @@ extern PyArrayObject* fff_matrix_const_toPyArray(const fff_matrix* y);
   \param x input array 
 
   This function instantiates an fff_array that borrows data from the
-  numpy array. Delete using  \c fff_array_delete.
+  numpy array, whatever its numeric type and strides, which need be
+  whole numbers of items. Nothing is copied. Delete using \c
+  fff_array_delete.
 
 */
 extern fff_array* fff_array_fromPyArray(const PyArrayObject* x); 
@@ -144,6 +150,8 @@ typedef struct {
   size_t index; 
   size_t size; 
   PyArrayMultiIterObject *multi;
+  size_t start; 
+  int nogil; 
 
 } fffpy_multi_iterator;
 
@@ -151,3 +159,32 @@ extern fffpy_multi_iterator* fffpy_multi_iterator_new(int narr, int axis, ...);
 extern void fffpy_multi_iterator_delete(fffpy_multi_iterator* thisone); 
 extern void fffpy_multi_iterator_update(fffpy_multi_iterator* thisone); 
 extern void fffpy_multi_iterator_reset(fffpy_multi_iterator* thisone); 
+
+/*!
+  \brief Split a multi-iterator into independent parts
+  \param thisone multi-iterator to be split
+  \param nparts number of parts
+
+  Returns an array of \a nparts multi-iterators over consecutive
+  sub-ranges of \c [0..size-1] (see \c fff_parallel_range), each with
+  its own vectors. Each part runs from its \c start field to its \c
+  size field. Parts are created with the GIL held, but may then be
+  updated and reset from threads that do not hold it: data that
+  cannot be wrapped is copied without calling NumPy. Returns \c NULL
+  if some array is not aligned, or if its type or stride does not
+  allow this, in which case the caller should iterate serially.
+
+  Delete using \c fffpy_multi_iterator_split_delete.
+*/
+extern fffpy_multi_iterator** fffpy_multi_iterator_split(const fffpy_multi_iterator* thisone, int nparts); 
+extern void fffpy_multi_iterator_split_delete(fffpy_multi_iterator** parts, int nparts); 
+
+/*!
+  \brief Run a parallel job with the GIL released
+  \param nthreads number of workers (resolved by \c fff_threads_count)
+  \param func job function, which must not call the Python API
+  \param params job parameters
+
+  See \c fff_parallel_run.
+*/
+extern void fffpy_parallel_run(int nthreads, fff_parallel_func func, void* params); 
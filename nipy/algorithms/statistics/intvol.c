@@ -1,17876 +0,0 @@
-/* Generated by Cython 0.11.2 on Fri Jun 12 13:07:04 2009 */
-
-#define PY_SSIZE_T_CLEAN
-#include "Python.h"
-#include "structmember.h"
-#ifndef Py_PYTHON_H
-    #error Python headers needed to compile C extensions, please install development version of Python.
-#endif
-#ifndef PY_LONG_LONG
-  #define PY_LONG_LONG LONG_LONG
-#endif
-#ifndef DL_EXPORT
-  #define DL_EXPORT(t) t
-#endif
-#if PY_VERSION_HEX < 0x02040000
-  #define METH_COEXIST 0
-  #define PyDict_CheckExact(op) (Py_TYPE(op) == &PyDict_Type)
-#endif
-#if PY_VERSION_HEX < 0x02050000
-  typedef int Py_ssize_t;
-  #define PY_SSIZE_T_MAX INT_MAX
-  #define PY_SSIZE_T_MIN INT_MIN
-  #define PY_FORMAT_SIZE_T ""
-  #define PyInt_FromSsize_t(z) PyInt_FromLong(z)
-  #define PyInt_AsSsize_t(o)   PyInt_AsLong(o)
-  #define PyNumber_Index(o)    PyNumber_Int(o)
-  #define PyIndex_Check(o)     PyNumber_Check(o)
-#endif
-#if PY_VERSION_HEX < 0x02060000
-  #define Py_REFCNT(ob) (((PyObject*)(ob))->ob_refcnt)
-  #define Py_TYPE(ob)   (((PyObject*)(ob))->ob_type)
-  #define Py_SIZE(ob)   (((PyVarObject*)(ob))->ob_size)
-  #define PyVarObject_HEAD_INIT(type, size) \
-          PyObject_HEAD_INIT(type) size,
-  #define PyType_Modified(t)
-
-  typedef struct {
-       void *buf;
-       PyObject *obj;
-       Py_ssize_t len;
-       Py_ssize_t itemsize;
-       int readonly;
-       int ndim;
-       char *format;
-       Py_ssize_t *shape;
-       Py_ssize_t *strides;
-       Py_ssize_t *suboffsets;
-       void *internal;
-  } Py_buffer;
-
-  #define PyBUF_SIMPLE 0
-  #define PyBUF_WRITABLE 0x0001
-  #define PyBUF_FORMAT 0x0004
-  #define PyBUF_ND 0x0008
-  #define PyBUF_STRIDES (0x0010 | PyBUF_ND)
-  #define PyBUF_C_CONTIGUOUS (0x0020 | PyBUF_STRIDES)
-  #define PyBUF_F_CONTIGUOUS (0x0040 | PyBUF_STRIDES)
-  #define PyBUF_ANY_CONTIGUOUS (0x0080 | PyBUF_STRIDES)
-  #define PyBUF_INDIRECT (0x0100 | PyBUF_STRIDES)
-
-#endif
-#if PY_MAJOR_VERSION < 3
-  #define __Pyx_BUILTIN_MODULE_NAME "__builtin__"
-#else
-  #define __Pyx_BUILTIN_MODULE_NAME "builtins"
-#endif
-#if PY_MAJOR_VERSION >= 3
-  #define Py_TPFLAGS_CHECKTYPES 0
-  #define Py_TPFLAGS_HAVE_INDEX 0
-#endif
-#if (PY_VERSION_HEX < 0x02060000) || (PY_MAJOR_VERSION >= 3)
-  #define Py_TPFLAGS_HAVE_NEWBUFFER 0
-#endif
-#if PY_MAJOR_VERSION >= 3
-  #define PyBaseString_Type            PyUnicode_Type
-  #define PyString_Type                PyBytes_Type
-  #define PyString_CheckExact          PyBytes_CheckExact
-  #define PyInt_Type                   PyLong_Type
-  #define PyInt_Check(op)              PyLong_Check(op)
-  #define PyInt_CheckExact(op)         PyLong_CheckExact(op)
-  #define PyInt_FromString             PyLong_FromString
-  #define PyInt_FromUnicode            PyLong_FromUnicode
-  #define PyInt_FromLong               PyLong_FromLong
-  #define PyInt_FromSize_t             PyLong_FromSize_t
-  #define PyInt_FromSsize_t            PyLong_FromSsize_t
-  #define PyInt_AsLong                 PyLong_AsLong
-  #define PyInt_AS_LONG                PyLong_AS_LONG
-  #define PyInt_AsSsize_t              PyLong_AsSsize_t
-  #define PyInt_AsUnsignedLongMask     PyLong_AsUnsignedLongMask
-  #define PyInt_AsUnsignedLongLongMask PyLong_AsUnsignedLongLongMask
-  #define __Pyx_PyNumber_Divide(x,y)         PyNumber_TrueDivide(x,y)
-#else
-  #define __Pyx_PyNumber_Divide(x,y)         PyNumber_Divide(x,y)
-  #define PyBytes_Type                 PyString_Type
-#endif
-#if PY_MAJOR_VERSION >= 3
-  #define PyMethod_New(func, self, klass) PyInstanceMethod_New(func)
-#endif
-#if !defined(WIN32) && !defined(MS_WINDOWS)
-  #ifndef __stdcall
-    #define __stdcall
-  #endif
-  #ifndef __cdecl
-    #define __cdecl
-  #endif
-  #ifndef __fastcall
-    #define __fastcall
-  #endif
-#else
-  #define _USE_MATH_DEFINES
-#endif
-#if PY_VERSION_HEX < 0x02050000
-  #define __Pyx_GetAttrString(o,n)   PyObject_GetAttrString((o),((char *)(n)))
-  #define __Pyx_SetAttrString(o,n,a) PyObject_SetAttrString((o),((char *)(n)),(a))
-  #define __Pyx_DelAttrString(o,n)   PyObject_DelAttrString((o),((char *)(n)))
-#else
-  #define __Pyx_GetAttrString(o,n)   PyObject_GetAttrString((o),(n))
-  #define __Pyx_SetAttrString(o,n,a) PyObject_SetAttrString((o),(n),(a))
-  #define __Pyx_DelAttrString(o,n)   PyObject_DelAttrString((o),(n))
-#endif
-#if PY_VERSION_HEX < 0x02050000
-  #define __Pyx_NAMESTR(n) ((char *)(n))
-  #define __Pyx_DOCSTR(n)  ((char *)(n))
-#else
-  #define __Pyx_NAMESTR(n) (n)
-  #define __Pyx_DOCSTR(n)  (n)
-#endif
-#ifdef __cplusplus
-#define __PYX_EXTERN_C extern "C"
-#else
-#define __PYX_EXTERN_C extern
-#endif
-#include <math.h>
-#define __PYX_HAVE_API__nipy__algorithms__statistics__intvol
-#include "stdlib.h"
-#include "numpy/arrayobject.h"
-#define __PYX_USE_C99_COMPLEX defined(_Complex_I)
-
-
-#ifdef __GNUC__
-#define INLINE __inline__
-#elif _WIN32
-#define INLINE __inline
-#else
-#define INLINE 
-#endif
-
-typedef struct {PyObject **p; char *s; long n; char is_unicode; char intern; char is_identifier;} __Pyx_StringTabEntry; /*proto*/
-
-
-
-static int __pyx_skip_dispatch = 0;
-
-
-/* Type Conversion Predeclarations */
-
-#if PY_MAJOR_VERSION < 3
-#define __Pyx_PyBytes_FromString          PyString_FromString
-#define __Pyx_PyBytes_FromStringAndSize   PyString_FromStringAndSize
-#define __Pyx_PyBytes_AsString            PyString_AsString
-#else
-#define __Pyx_PyBytes_FromString          PyBytes_FromString
-#define __Pyx_PyBytes_FromStringAndSize   PyBytes_FromStringAndSize
-#define __Pyx_PyBytes_AsString            PyBytes_AsString
-#endif
-
-#define __Pyx_PyBool_FromLong(b) ((b) ? (Py_INCREF(Py_True), Py_True) : (Py_INCREF(Py_False), Py_False))
-static INLINE int __Pyx_PyObject_IsTrue(PyObject*);
-static INLINE PyObject* __Pyx_PyNumber_Int(PyObject* x);
-
-#if !defined(T_PYSSIZET)
-#if PY_VERSION_HEX < 0x02050000
-#define T_PYSSIZET T_INT
-#elif !defined(T_LONGLONG)
-#define T_PYSSIZET \
-        ((sizeof(Py_ssize_t) == sizeof(int))  ? T_INT  : \
-        ((sizeof(Py_ssize_t) == sizeof(long)) ? T_LONG : -1))
-#else
-#define T_PYSSIZET \
-        ((sizeof(Py_ssize_t) == sizeof(int))          ? T_INT      : \
-        ((sizeof(Py_ssize_t) == sizeof(long))         ? T_LONG     : \
-        ((sizeof(Py_ssize_t) == sizeof(PY_LONG_LONG)) ? T_LONGLONG : -1)))
-#endif
-#endif
-
-#if !defined(T_SIZET)
-#if !defined(T_ULONGLONG)
-#define T_SIZET \
-        ((sizeof(size_t) == sizeof(unsigned int))  ? T_UINT  : \
-        ((sizeof(size_t) == sizeof(unsigned long)) ? T_ULONG : -1))
-#else
-#define T_SIZET \
-        ((sizeof(size_t) == sizeof(unsigned int))          ? T_UINT      : \
-        ((sizeof(size_t) == sizeof(unsigned long))         ? T_ULONG     : \
-        ((sizeof(size_t) == sizeof(unsigned PY_LONG_LONG)) ? T_ULONGLONG : -1)))
-#endif
-#endif
-
-static INLINE Py_ssize_t __Pyx_PyIndex_AsSsize_t(PyObject*);
-static INLINE PyObject * __Pyx_PyInt_FromSize_t(size_t);
-static INLINE size_t __Pyx_PyInt_AsSize_t(PyObject*);
-
-#define __pyx_PyFloat_AsDouble(x) (PyFloat_CheckExact(x) ? PyFloat_AS_DOUBLE(x) : PyFloat_AsDouble(x))
-
-
-#ifdef __GNUC__
-/* Test for GCC > 2.95 */
-#if __GNUC__ > 2 ||               (__GNUC__ == 2 && (__GNUC_MINOR__ > 95)) 
-#define likely(x)   __builtin_expect(!!(x), 1)
-#define unlikely(x) __builtin_expect(!!(x), 0)
-#else /* __GNUC__ > 2 ... */
-#define likely(x)   (x)
-#define unlikely(x) (x)
-#endif /* __GNUC__ > 2 ... */
-#else /* __GNUC__ */
-#define likely(x)   (x)
-#define unlikely(x) (x)
-#endif /* __GNUC__ */
-    
-static PyObject *__pyx_m;
-static PyObject *__pyx_b;
-static PyObject *__pyx_empty_tuple;
-static int __pyx_lineno;
-static int __pyx_clineno = 0;
-static const char * __pyx_cfilenm= __FILE__;
-static const char *__pyx_filename;
-static const char **__pyx_f;
-
-static char __pyx_mdoc[] = "\nThe estimators for the intrinsic volumes appearing in this module\nwere partially supported by NSF grant DMS-0405970.\n\nTaylor, J.E. & Worsley, K.J. (2007). \"Detecting sparse signal in random fields,\n   with an application to brain mapping.\"\n   Journal of the American Statistical Association, 102(479):913-928.\n\n";
-
-
-#ifdef CYTHON_REFNANNY
-typedef struct {
-  void (*INCREF)(void*, PyObject*, int);
-  void (*DECREF)(void*, PyObject*, int);
-  void (*GOTREF)(void*, PyObject*, int);
-  void (*GIVEREF)(void*, PyObject*, int);
-  void* (*NewContext)(const char*, int, const char*);
-  void (*FinishContext)(void**);
-} __Pyx_RefnannyAPIStruct;
-static __Pyx_RefnannyAPIStruct *__Pyx_Refnanny = NULL;
-#define __Pyx_ImportRefcountAPI(name)   (__Pyx_RefnannyAPIStruct *) PyCObject_Import((char *)name, (char *)"RefnannyAPI")
-#define __Pyx_INCREF(r) __Pyx_Refnanny->INCREF(__pyx_refchk, (PyObject *)(r), __LINE__)
-#define __Pyx_DECREF(r) __Pyx_Refnanny->DECREF(__pyx_refchk, (PyObject *)(r), __LINE__)
-#define __Pyx_GOTREF(r) __Pyx_Refnanny->GOTREF(__pyx_refchk, (PyObject *)(r), __LINE__)
-#define __Pyx_GIVEREF(r) __Pyx_Refnanny->GIVEREF(__pyx_refchk, (PyObject *)(r), __LINE__)
-#define __Pyx_XDECREF(r) if((r) == NULL) ; else __Pyx_DECREF(r)
-#define __Pyx_SetupRefcountContext(name)   void* __pyx_refchk = __Pyx_Refnanny->NewContext((name), __LINE__, __FILE__)
-#define __Pyx_FinishRefcountContext()   __Pyx_Refnanny->FinishContext(&__pyx_refchk)
-#else
-#define __Pyx_INCREF(r) Py_INCREF(r)
-#define __Pyx_DECREF(r) Py_DECREF(r)
-#define __Pyx_GOTREF(r)
-#define __Pyx_GIVEREF(r)
-#define __Pyx_XDECREF(r) Py_XDECREF(r)
-#define __Pyx_SetupRefcountContext(name)
-#define __Pyx_FinishRefcountContext()
-#endif /* CYTHON_REFNANNY */
-#define __Pyx_XGIVEREF(r) if((r) == NULL) ; else __Pyx_GIVEREF(r)
-#define __Pyx_XGOTREF(r) if((r) == NULL) ; else __Pyx_GOTREF(r)
-
-static void __Pyx_RaiseDoubleKeywordsError(
-    const char* func_name, PyObject* kw_name); /*proto*/
-
-static void __Pyx_RaiseArgtupleInvalid(const char* func_name, int exact,
-    Py_ssize_t num_min, Py_ssize_t num_max, Py_ssize_t num_found); /*proto*/
-
-static int __Pyx_ParseOptionalKeywords(PyObject *kwds, PyObject **argnames[],     PyObject *kwds2, PyObject *values[], Py_ssize_t num_pos_args,     const char* function_name); /*proto*/
-
-/* Run-time type information about structs used with buffers */
-struct __Pyx_StructField_;
-
-typedef struct {
-  const char* name; /* for error messages only */
-  struct __Pyx_StructField_* fields;
-  size_t size;     /* sizeof(type) */
-  char typegroup; /* _R_eal, _C_omplex, Signed _I_nt, _U_nsigned int, _S_truct, _P_ointer, _O_bject */
-} __Pyx_TypeInfo;
-
-typedef struct __Pyx_StructField_ {
-  __Pyx_TypeInfo* type;
-  const char* name;
-  size_t offset;
-} __Pyx_StructField;
-
-typedef struct {
-  __Pyx_StructField* field;
-  size_t parent_offset;
-} __Pyx_BufFmt_StackElem;
-
-
-static INLINE void __Pyx_SafeReleaseBuffer(Py_buffer* info);
-static int __Pyx_GetBufferAndValidate(Py_buffer* buf, PyObject* obj, __Pyx_TypeInfo* dtype, int flags, int nd, int cast, __Pyx_BufFmt_StackElem* stack);
-
-static int __Pyx_TypeTest(PyObject *obj, PyTypeObject *type); /*proto*/
-
-static void __Pyx_RaiseBufferFallbackError(void); /*proto*/
-
-
-static INLINE PyObject *__Pyx_GetItemInt_Generic(PyObject *o, PyObject* j) {
-    PyObject *r;
-    if (!j) return NULL;
-    r = PyObject_GetItem(o, j);
-    Py_DECREF(j);
-    return r;
-}
-
-
-#define __Pyx_GetItemInt_List(o, i, size, to_py_func) ((size <= sizeof(Py_ssize_t)) ? \
-                                                    __Pyx_GetItemInt_List_Fast(o, i, size <= sizeof(long)) : \
-                                                    __Pyx_GetItemInt_Generic(o, to_py_func(i)))
-
-static INLINE PyObject *__Pyx_GetItemInt_List_Fast(PyObject *o, Py_ssize_t i, int fits_long) {
-    if (likely(o != Py_None)) {
-        if (likely((0 <= i) & (i < PyList_GET_SIZE(o)))) {
-            PyObject *r = PyList_GET_ITEM(o, i);
-            Py_INCREF(r);
-            return r;
-        }
-        else if ((-PyList_GET_SIZE(o) <= i) & (i < 0)) {
-            PyObject *r = PyList_GET_ITEM(o, PyList_GET_SIZE(o) + i);
-            Py_INCREF(r);
-            return r;
-        }
-    }
-    return __Pyx_GetItemInt_Generic(o, fits_long ? PyInt_FromLong(i) : PyLong_FromLongLong(i));
-}
-
-#define __Pyx_GetItemInt_Tuple(o, i, size, to_py_func) ((size <= sizeof(Py_ssize_t)) ? \
-                                                    __Pyx_GetItemInt_Tuple_Fast(o, i, size <= sizeof(long)) : \
-                                                    __Pyx_GetItemInt_Generic(o, to_py_func(i)))
-
-static INLINE PyObject *__Pyx_GetItemInt_Tuple_Fast(PyObject *o, Py_ssize_t i, int fits_long) {
-    if (likely(o != Py_None)) {
-        if (likely((0 <= i) & (i < PyTuple_GET_SIZE(o)))) {
-            PyObject *r = PyTuple_GET_ITEM(o, i);
-            Py_INCREF(r);
-            return r;
-        }
-        else if ((-PyTuple_GET_SIZE(o) <= i) & (i < 0)) {
-            PyObject *r = PyTuple_GET_ITEM(o, PyTuple_GET_SIZE(o) + i);
-            Py_INCREF(r);
-            return r;
-        }
-    }
-    return __Pyx_GetItemInt_Generic(o, fits_long ? PyInt_FromLong(i) : PyLong_FromLongLong(i));
-}
-
-
-#define __Pyx_GetItemInt(o, i, size, to_py_func) ((size <= sizeof(Py_ssize_t)) ? \
-                                                    __Pyx_GetItemInt_Fast(o, i, size <= sizeof(long)) : \
-                                                    __Pyx_GetItemInt_Generic(o, to_py_func(i)))
-
-static INLINE PyObject *__Pyx_GetItemInt_Fast(PyObject *o, Py_ssize_t i, int fits_long) {
-    PyObject *r;
-    if (PyList_CheckExact(o) && ((0 <= i) & (i < PyList_GET_SIZE(o)))) {
-        r = PyList_GET_ITEM(o, i);
-        Py_INCREF(r);
-    }
-    else if (PyTuple_CheckExact(o) && ((0 <= i) & (i < PyTuple_GET_SIZE(o)))) {
-        r = PyTuple_GET_ITEM(o, i);
-        Py_INCREF(r);
-    }
-    else if (Py_TYPE(o)->tp_as_sequence && Py_TYPE(o)->tp_as_sequence->sq_item && (likely(i >= 0))) {
-        r = PySequence_GetItem(o, i);
-    }
-    else {
-        r = __Pyx_GetItemInt_Generic(o, fits_long ? PyInt_FromLong(i) : PyLong_FromLongLong(i));
-    }
-    return r;
-}
-static void __Pyx_RaiseBufferIndexError(int axis); /*proto*/
-#define __Pyx_BufPtrStrided2d(type, buf, i0, s0, i1, s1) (type)((char*)buf + i0 * s0 + i1 * s1)
-#define __Pyx_BufPtrStrided1d(type, buf, i0, s0) (type)((char*)buf + i0 * s0)
-
-static INLINE void __Pyx_ErrRestore(PyObject *type, PyObject *value, PyObject *tb); /*proto*/
-static INLINE void __Pyx_ErrFetch(PyObject **type, PyObject **value, PyObject **tb); /*proto*/
-
-static int __Pyx_ArgTypeTest(PyObject *obj, PyTypeObject *type, int none_allowed,
-    const char *name, int exact); /*proto*/
-#if PY_MAJOR_VERSION < 3
-static int __Pyx_GetBuffer(PyObject *obj, Py_buffer *view, int flags);
-static void __Pyx_ReleaseBuffer(Py_buffer *view);
-#else
-#define __Pyx_GetBuffer PyObject_GetBuffer
-#define __Pyx_ReleaseBuffer PyBuffer_Release
-#endif
-
-Py_ssize_t __Pyx_zeros[] = {0, 0, 0, 0};
-Py_ssize_t __Pyx_minusones[] = {-1, -1, -1, -1};
-
-static PyObject *__Pyx_Import(PyObject *name, PyObject *from_list); /*proto*/
-
-static PyObject *__Pyx_GetName(PyObject *dict, PyObject *name); /*proto*/
-
-#if PY_VERSION_HEX < 0x02050000
-#ifndef PyAnySet_CheckExact
-
-#define PyAnySet_CheckExact(ob) \
-    ((ob)->ob_type == &PySet_Type || \
-     (ob)->ob_type == &PyFrozenSet_Type)
-
-#define PySet_New(iterable) \
-    PyObject_CallFunctionObjArgs((PyObject *)&PySet_Type, (iterable), NULL)
-
-#define Pyx_PyFrozenSet_New(iterable) \
-    PyObject_CallFunctionObjArgs((PyObject *)&PyFrozenSet_Type, (iterable), NULL)
-
-#define PySet_Size(anyset) \
-    PyObject_Size((anyset))
-
-#define PySet_Contains(anyset, key) \
-    PySequence_Contains((anyset), (key))
-
-#define PySet_Pop(set) \
-    PyObject_CallMethod(set, (char *)"pop", NULL)
-
-static INLINE int PySet_Clear(PyObject *set) {
-    PyObject *ret = PyObject_CallMethod(set, (char *)"clear", NULL);
-    if (!ret) return -1;
-    Py_DECREF(ret); return 0;
-}
-
-static INLINE int PySet_Discard(PyObject *set, PyObject *key) {
-    PyObject *ret = PyObject_CallMethod(set, (char *)"discard", (char *)"O", key);
-    if (!ret) return -1;
-    Py_DECREF(ret); return 0;
-}
-
-static INLINE int PySet_Add(PyObject *set, PyObject *key) {
-    PyObject *ret = PyObject_CallMethod(set, (char *)"add", (char *)"O", key);
-    if (!ret) return -1;
-    Py_DECREF(ret); return 0;
-}
-
-#endif /* PyAnySet_CheckExact (<= Py2.4) */
-
-#if PY_VERSION_HEX < 0x02040000
-#ifndef Py_SETOBJECT_H
-#define Py_SETOBJECT_H
-
-static PyTypeObject *__Pyx_PySet_Type = NULL;
-static PyTypeObject *__Pyx_PyFrozenSet_Type = NULL;
-
-#define PySet_Type (*__Pyx_PySet_Type)
-#define PyFrozenSet_Type (*__Pyx_PyFrozenSet_Type)
-
-#define PyAnySet_Check(ob) \
-    (PyAnySet_CheckExact(ob) || \
-     PyType_IsSubtype((ob)->ob_type, &PySet_Type) || \
-     PyType_IsSubtype((ob)->ob_type, &PyFrozenSet_Type))
-
-#define PyFrozenSet_CheckExact(ob) ((ob)->ob_type == &PyFrozenSet_Type)
-
-static int __Pyx_Py23SetsImport(void) {
-    PyObject *sets=0, *Set=0, *ImmutableSet=0;
-
-    sets = PyImport_ImportModule((char *)"sets");
-    if (!sets) goto bad;
-    Set = PyObject_GetAttrString(sets, (char *)"Set");
-    if (!Set) goto bad;
-    ImmutableSet = PyObject_GetAttrString(sets, (char *)"ImmutableSet");
-    if (!ImmutableSet) goto bad;
-    Py_DECREF(sets);
-
-    __Pyx_PySet_Type       = (PyTypeObject*) Set;
-    __Pyx_PyFrozenSet_Type = (PyTypeObject*) ImmutableSet;
-
-    return 0;
-
- bad:
-    Py_XDECREF(sets);
-    Py_XDECREF(Set);
-    Py_XDECREF(ImmutableSet);
-    return -1;
-}
-
-#else
-static int __Pyx_Py23SetsImport(void) { return 0; }
-#endif /* !Py_SETOBJECT_H */
-#endif /* < Py2.4  */
-#endif /* < Py2.5  */
-
-static void __Pyx_Raise(PyObject *type, PyObject *value, PyObject *tb); /*proto*/
-
-#if __PYX_USE_C99_COMPLEX
-    #define __Pyx_REAL_PART(z) __real__(z)
-    #define __Pyx_IMAG_PART(z) __imag__(z)
-#else
-    #define __Pyx_REAL_PART(z) ((z).real)
-    #define __Pyx_IMAG_PART(z) ((z).imag)
-#endif
-
-#define __pyx_PyObject_from_complex(z) PyComplex_FromDoubles((double)__Pyx_REAL_PART(z), (double)__Pyx_IMAG_PART(z))
-
-#if __PYX_USE_C99_COMPLEX
-
-    typedef float _Complex __pyx_t_float_complex;
-    static INLINE __pyx_t_float_complex __pyx_t_float_complex_from_parts(float x, float y) {
-      return x + y*(__pyx_t_float_complex)_Complex_I;
-    }
-    
-    #define __pyx_t_float_complex_is_zero(a) ((a) == 0)
-    #define __pyx_t_float_complex_eq(a, b) ((a) == (b))
-    #define __pyx_t_float_complex_add(a, b) ((a)+(b))
-    #define __pyx_t_float_complex_sub(a, b) ((a)-(b))
-    #define __pyx_t_float_complex_mul(a, b) ((a)*(b))
-    #define __pyx_t_float_complex_div(a, b) ((a)/(b))
-    #define __pyx_t_float_complex_neg(a) (-(a))
-
-#else
-
-    typedef struct { float real, imag; } __pyx_t_float_complex;
-    static INLINE __pyx_t_float_complex __pyx_t_float_complex_from_parts(float x, float y) {
-      __pyx_t_float_complex c; c.real = x; c.imag = y; return c;
-    }
-    
-    static INLINE int __pyx_t_float_complex_is_zero(__pyx_t_float_complex a) {
-       return (a.real == 0) & (a.imag == 0);
-    }
-
-    static INLINE int __pyx_t_float_complex_eq(__pyx_t_float_complex a, __pyx_t_float_complex b) {
-       return (a.real == b.real) & (a.imag == b.imag);
-    }
-
-    static INLINE __pyx_t_float_complex __pyx_t_float_complex_add(__pyx_t_float_complex a, __pyx_t_float_complex b) {
-        __pyx_t_float_complex z;
-        z.real = a.real + b.real;
-        z.imag = a.imag + b.imag;
-        return z;
-    }
-
-    static INLINE __pyx_t_float_complex __pyx_t_float_complex_sub(__pyx_t_float_complex a, __pyx_t_float_complex b) {
-        __pyx_t_float_complex z;
-        z.real = a.real - b.real;
-        z.imag = a.imag - b.imag;
-        return z;
-    }
-
-    static INLINE __pyx_t_float_complex __pyx_t_float_complex_mul(__pyx_t_float_complex a, __pyx_t_float_complex b) {
-        __pyx_t_float_complex z;
-        z.real = a.real * b.real - a.imag * b.imag;
-        z.imag = a.real * b.imag + a.imag * b.real;
-        return z;
-    }
-
-    static INLINE __pyx_t_float_complex __pyx_t_float_complex_div(__pyx_t_float_complex a, __pyx_t_float_complex b) {
-        __pyx_t_float_complex z;
-        float denom = b.real*b.real + b.imag*b.imag;
-        z.real = (a.real * b.real + a.imag * b.imag) / denom;
-        z.imag = (a.imag * b.real - a.real * b.imag) / denom;
-        return z;
-    }
-
-    static INLINE __pyx_t_float_complex __pyx_t_float_complex_neg(__pyx_t_float_complex a) {
-        __pyx_t_float_complex z;
-        z.real = -a.real;
-        z.imag = -a.imag;
-        return z;
-    }
-
-#endif
-
-#if __PYX_USE_C99_COMPLEX
-
-    typedef double _Complex __pyx_t_double_complex;
-    static INLINE __pyx_t_double_complex __pyx_t_double_complex_from_parts(double x, double y) {
-      return x + y*(__pyx_t_double_complex)_Complex_I;
-    }
-    
-    #define __pyx_t_double_complex_is_zero(a) ((a) == 0)
-    #define __pyx_t_double_complex_eq(a, b) ((a) == (b))
-    #define __pyx_t_double_complex_add(a, b) ((a)+(b))
-    #define __pyx_t_double_complex_sub(a, b) ((a)-(b))
-    #define __pyx_t_double_complex_mul(a, b) ((a)*(b))
-    #define __pyx_t_double_complex_div(a, b) ((a)/(b))
-    #define __pyx_t_double_complex_neg(a) (-(a))
-
-#else
-
-    typedef struct { double real, imag; } __pyx_t_double_complex;
-    static INLINE __pyx_t_double_complex __pyx_t_double_complex_from_parts(double x, double y) {
-      __pyx_t_double_complex c; c.real = x; c.imag = y; return c;
-    }
-    
-    static INLINE int __pyx_t_double_complex_is_zero(__pyx_t_double_complex a) {
-       return (a.real == 0) & (a.imag == 0);
-    }
-
-    static INLINE int __pyx_t_double_complex_eq(__pyx_t_double_complex a, __pyx_t_double_complex b) {
-       return (a.real == b.real) & (a.imag == b.imag);
-    }
-
-    static INLINE __pyx_t_double_complex __pyx_t_double_complex_add(__pyx_t_double_complex a, __pyx_t_double_complex b) {
-        __pyx_t_double_complex z;
-        z.real = a.real + b.real;
-        z.imag = a.imag + b.imag;
-        return z;
-    }
-
-    static INLINE __pyx_t_double_complex __pyx_t_double_complex_sub(__pyx_t_double_complex a, __pyx_t_double_complex b) {
-        __pyx_t_double_complex z;
-        z.real = a.real - b.real;
-        z.imag = a.imag - b.imag;
-        return z;
-    }
-
-    static INLINE __pyx_t_double_complex __pyx_t_double_complex_mul(__pyx_t_double_complex a, __pyx_t_double_complex b) {
-        __pyx_t_double_complex z;
-        z.real = a.real * b.real - a.imag * b.imag;
-        z.imag = a.real * b.imag + a.imag * b.real;
-        return z;
-    }
-
-    static INLINE __pyx_t_double_complex __pyx_t_double_complex_div(__pyx_t_double_complex a, __pyx_t_double_complex b) {
-        __pyx_t_double_complex z;
-        double denom = b.real*b.real + b.imag*b.imag;
-        z.real = (a.real * b.real + a.imag * b.imag) / denom;
-        z.imag = (a.imag * b.real - a.real * b.imag) / denom;
-        return z;
-    }
-
-    static INLINE __pyx_t_double_complex __pyx_t_double_complex_neg(__pyx_t_double_complex a) {
-        __pyx_t_double_complex z;
-        z.real = -a.real;
-        z.imag = -a.imag;
-        return z;
-    }
-
-#endif
-
-#if __PYX_USE_C99_COMPLEX
-
-    typedef long double _Complex __pyx_t_long__double_complex;
-    static INLINE __pyx_t_long__double_complex __pyx_t_long__double_complex_from_parts(long double x, long double y) {
-      return x + y*(__pyx_t_long__double_complex)_Complex_I;
-    }
-    
-    #define __pyx_t_long__double_complex_is_zero(a) ((a) == 0)
-    #define __pyx_t_long__double_complex_eq(a, b) ((a) == (b))
-    #define __pyx_t_long__double_complex_add(a, b) ((a)+(b))
-    #define __pyx_t_long__double_complex_sub(a, b) ((a)-(b))
-    #define __pyx_t_long__double_complex_mul(a, b) ((a)*(b))
-    #define __pyx_t_long__double_complex_div(a, b) ((a)/(b))
-    #define __pyx_t_long__double_complex_neg(a) (-(a))
-
-#else
-
-    typedef struct { long double real, imag; } __pyx_t_long__double_complex;
-    static INLINE __pyx_t_long__double_complex __pyx_t_long__double_complex_from_parts(long double x, long double y) {
-      __pyx_t_long__double_complex c; c.real = x; c.imag = y; return c;
-    }
-    
-    static INLINE int __pyx_t_long__double_complex_is_zero(__pyx_t_long__double_complex a) {
-       return (a.real == 0) & (a.imag == 0);
-    }
-
-    static INLINE int __pyx_t_long__double_complex_eq(__pyx_t_long__double_complex a, __pyx_t_long__double_complex b) {
-       return (a.real == b.real) & (a.imag == b.imag);
-    }
-
-    static INLINE __pyx_t_long__double_complex __pyx_t_long__double_complex_add(__pyx_t_long__double_complex a, __pyx_t_long__double_complex b) {
-        __pyx_t_long__double_complex z;
-        z.real = a.real + b.real;
-        z.imag = a.imag + b.imag;
-        return z;
-    }
-
-    static INLINE __pyx_t_long__double_complex __pyx_t_long__double_complex_sub(__pyx_t_long__double_complex a, __pyx_t_long__double_complex b) {
-        __pyx_t_long__double_complex z;
-        z.real = a.real - b.real;
-        z.imag = a.imag - b.imag;
-        return z;
-    }
-
-    static INLINE __pyx_t_long__double_complex __pyx_t_long__double_complex_mul(__pyx_t_long__double_complex a, __pyx_t_long__double_complex b) {
-        __pyx_t_long__double_complex z;
-        z.real = a.real * b.real - a.imag * b.imag;
-        z.imag = a.real * b.imag + a.imag * b.real;
-        return z;
-    }
-
-    static INLINE __pyx_t_long__double_complex __pyx_t_long__double_complex_div(__pyx_t_long__double_complex a, __pyx_t_long__double_complex b) {
-        __pyx_t_long__double_complex z;
-        long double denom = b.real*b.real + b.imag*b.imag;
-        z.real = (a.real * b.real + a.imag * b.imag) / denom;
-        z.imag = (a.imag * b.real - a.real * b.imag) / denom;
-        return z;
-    }
-
-    static INLINE __pyx_t_long__double_complex __pyx_t_long__double_complex_neg(__pyx_t_long__double_complex a) {
-        __pyx_t_long__double_complex z;
-        z.real = -a.real;
-        z.imag = -a.imag;
-        return z;
-    }
-
-#endif
-
-static INLINE int __Pyx_StrEq(const char *, const char *); /*proto*/
-
-static INLINE unsigned char __Pyx_PyInt_AsUnsignedChar(PyObject *);
-
-static INLINE unsigned short __Pyx_PyInt_AsUnsignedShort(PyObject *);
-
-static INLINE unsigned int __Pyx_PyInt_AsUnsignedInt(PyObject *);
-
-static INLINE char __Pyx_PyInt_AsChar(PyObject *);
-
-static INLINE short __Pyx_PyInt_AsShort(PyObject *);
-
-static INLINE int __Pyx_PyInt_AsInt(PyObject *);
-
-static INLINE signed char __Pyx_PyInt_AsSignedChar(PyObject *);
-
-static INLINE signed short __Pyx_PyInt_AsSignedShort(PyObject *);
-
-static INLINE signed int __Pyx_PyInt_AsSignedInt(PyObject *);
-
-static INLINE unsigned long __Pyx_PyInt_AsUnsignedLong(PyObject *);
-
-static INLINE unsigned PY_LONG_LONG __Pyx_PyInt_AsUnsignedLongLong(PyObject *);
-
-static INLINE long __Pyx_PyInt_AsLong(PyObject *);
-
-static INLINE PY_LONG_LONG __Pyx_PyInt_AsLongLong(PyObject *);
-
-static INLINE signed long __Pyx_PyInt_AsSignedLong(PyObject *);
-
-static INLINE signed PY_LONG_LONG __Pyx_PyInt_AsSignedLongLong(PyObject *);
-
-static void __Pyx_WriteUnraisable(const char *name); /*proto*/
-
-static PyTypeObject *__Pyx_ImportType(const char *module_name, const char *class_name, long size);  /*proto*/
-
-static PyObject *__Pyx_ImportModule(const char *name); /*proto*/
-
-static void __Pyx_AddTraceback(const char *funcname); /*proto*/
-
-static int __Pyx_InitStrings(__Pyx_StringTabEntry *t); /*proto*/
-
-/* Type declarations */
-
-typedef npy_int8 __pyx_t_5numpy_int8_t;
-
-typedef npy_int16 __pyx_t_5numpy_int16_t;
-
-typedef npy_int32 __pyx_t_5numpy_int32_t;
-
-typedef npy_int64 __pyx_t_5numpy_int64_t;
-
-typedef npy_uint8 __pyx_t_5numpy_uint8_t;
-
-typedef npy_uint16 __pyx_t_5numpy_uint16_t;
-
-typedef npy_uint32 __pyx_t_5numpy_uint32_t;
-
-typedef npy_uint64 __pyx_t_5numpy_uint64_t;
-
-typedef npy_float32 __pyx_t_5numpy_float32_t;
-
-typedef npy_float64 __pyx_t_5numpy_float64_t;
-
-typedef npy_complex64 __pyx_t_5numpy_complex64_t;
-
-typedef npy_complex128 __pyx_t_5numpy_complex128_t;
-
-typedef npy_long __pyx_t_5numpy_int_t;
-
-typedef npy_longlong __pyx_t_5numpy_long_t;
-
-typedef npy_ulong __pyx_t_5numpy_uint_t;
-
-typedef npy_ulonglong __pyx_t_5numpy_ulong_t;
-
-typedef npy_double __pyx_t_5numpy_float_t;
-
-typedef npy_double __pyx_t_5numpy_double_t;
-
-typedef npy_longdouble __pyx_t_5numpy_longdouble_t;
-
-typedef npy_cfloat __pyx_t_5numpy_cfloat_t;
-
-typedef npy_cdouble __pyx_t_5numpy_cdouble_t;
-
-typedef npy_clongdouble __pyx_t_5numpy_clongdouble_t;
-
-typedef npy_cdouble __pyx_t_5numpy_complex_t;
-
-typedef __pyx_t_5numpy_float_t __pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_float_t;
-
-typedef __pyx_t_5numpy_int_t __pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_int_t;
-/* Module declarations from python_buffer */
-
-/* Module declarations from stdlib */
-
-/* Module declarations from numpy */
-
-/* Module declarations from numpy */
-
-static PyTypeObject *__pyx_ptype_5numpy_dtype = 0;
-static PyTypeObject *__pyx_ptype_5numpy_ndarray = 0;
-static INLINE char *__pyx_f_5numpy__util_dtypestring(PyArray_Descr *, char *, char *, int *); /*proto*/
-/* Module declarations from nipy.algorithms.statistics.intvol */
-
-static double __pyx_f_4nipy_10algorithms_10statistics_6intvol__mu1_tetface(double, double, double, double, double, double, double, double, double, double); /*proto*/
-static __Pyx_TypeInfo __Pyx_TypeInfo_nn___pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_int_t = { "nipy.algorithms.statistics.intvol.DTYPE_int_t", NULL, sizeof(__pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_int_t), 'I' };
-static __Pyx_TypeInfo __Pyx_TypeInfo_nn___pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_float_t = { "nipy.algorithms.statistics.intvol.DTYPE_float_t", NULL, sizeof(__pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_float_t), 'R' };
-#define __Pyx_MODULE_NAME "nipy.algorithms.statistics.intvol"
-int __pyx_module_is_main_nipy__algorithms__statistics__intvol = 0;
-
-/* Implementation of nipy.algorithms.statistics.intvol */
-static PyObject *__pyx_int_0;
-static PyObject *__pyx_int_2;
-static PyObject *__pyx_int_1;
-static PyObject *__pyx_int_neg_1;
-static PyObject *__pyx_int_4;
-static PyObject *__pyx_int_8;
-static char __pyx_k___main__[] = "__main__";
-static PyObject *__pyx_kp___main__;
-static char __pyx_k_D00[] = "D00";
-static PyObject *__pyx_kp_D00;
-static char __pyx_k_31[] = "D01";
-static PyObject *__pyx_kp_31;
-static char __pyx_k_32[] = "D02";
-static PyObject *__pyx_kp_32;
-static char __pyx_k_33[] = "D03";
-static PyObject *__pyx_kp_33;
-static char __pyx_k_34[] = "D11";
-static PyObject *__pyx_kp_34;
-static char __pyx_k_35[] = "D12";
-static PyObject *__pyx_kp_35;
-static char __pyx_k_36[] = "D13";
-static PyObject *__pyx_kp_36;
-static char __pyx_k_37[] = "D22";
-static PyObject *__pyx_kp_37;
-static char __pyx_k_38[] = "D23";
-static PyObject *__pyx_kp_38;
-static char __pyx_k_39[] = "D33";
-static PyObject *__pyx_kp_39;
-static char __pyx_k_mask[] = "mask";
-static PyObject *__pyx_kp_mask;
-static char __pyx_k_coords[] = "coords";
-static PyObject *__pyx_kp_coords;
-static char __pyx_k_v[] = "v";
-static PyObject *__pyx_kp_v;
-static char __pyx_k_40[] = "stride1";
-static PyObject *__pyx_kp_40;
-static char __pyx_k_41[] = "stride2";
-static PyObject *__pyx_kp_41;
-static char __pyx_k_numpy[] = "numpy";
-static PyObject *__pyx_kp_numpy;
-static char __pyx_k_np[] = "np";
-static PyObject *__pyx_kp_np;
-static char __pyx_k_42[] = "scipy.sparse";
-static PyObject *__pyx_kp_42;
-static char __pyx_k_dok_matrix[] = "dok_matrix";
-static PyObject *__pyx_kp_dok_matrix;
-static char __pyx_k_utils[] = "utils";
-static PyObject *__pyx_kp_utils;
-static char __pyx_k_43[] = "cube_with_strides_center";
-static PyObject *__pyx_kp_43;
-static char __pyx_k_join_complexes[] = "join_complexes";
-static PyObject *__pyx_kp_join_complexes;
-static char __pyx_k_float[] = "float";
-static PyObject *__pyx_kp_float;
-static char __pyx_k_DTYPE_float[] = "DTYPE_float";
-static PyObject *__pyx_kp_DTYPE_float;
-static char __pyx_k_int[] = "int";
-static PyObject *__pyx_kp_int;
-static char __pyx_k_DTYPE_int[] = "DTYPE_int";
-static PyObject *__pyx_kp_DTYPE_int;
-static char __pyx_k_sqrt[] = "sqrt";
-static PyObject *__pyx_kp_sqrt;
-static char __pyx_k_44[] = "mu2_tri";
-static PyObject *__pyx_kp_44;
-static char __pyx_k_pi[] = "pi";
-static PyObject *__pyx_kp_pi;
-static char __pyx_k_arccos[] = "arccos";
-static PyObject *__pyx_kp_arccos;
-static char __pyx_k_isnan[] = "isnan";
-static PyObject *__pyx_kp_isnan;
-static char __pyx_k_45[] = "mu1_edge";
-static PyObject *__pyx_kp_45;
-static char __pyx_k_unique[] = "unique";
-static PyObject *__pyx_kp_unique;
-static char __pyx_k_issubset[] = "issubset";
-static PyObject *__pyx_kp_issubset;
-static char __pyx_k_ValueError[] = "ValueError";
-static PyObject *__pyx_kp_ValueError;
-static char __pyx_k_zeros[] = "zeros";
-static PyObject *__pyx_kp_zeros;
-static char __pyx_k_reshape[] = "reshape";
-static PyObject *__pyx_kp_reshape;
-static char __pyx_k_empty[] = "empty";
-static PyObject *__pyx_kp_empty;
-static char __pyx_k_bool[] = "bool";
-static PyObject *__pyx_kp_bool;
-static char __pyx_k_strides[] = "strides";
-static PyObject *__pyx_kp_strides;
-static char __pyx_k_array[] = "array";
-static PyObject *__pyx_kp_array;
-static char __pyx_k_difference[] = "difference";
-static PyObject *__pyx_kp_difference;
-static char __pyx_k_range[] = "range";
-static PyObject *__pyx_kp_range;
-static char __pyx_k_sum[] = "sum";
-static PyObject *__pyx_kp_sum;
-static char __pyx_k_ravel[] = "ravel";
-static PyObject *__pyx_kp_ravel;
-static char __pyx_k_sort[] = "sort";
-static PyObject *__pyx_kp_sort;
-static char __pyx_k_49[] = "_convert_stride3";
-static PyObject *__pyx_kp_49;
-static char __pyx_k_hstack[] = "hstack";
-static PyObject *__pyx_kp_hstack;
-static char __pyx_k_50[] = "mu3_tet";
-static PyObject *__pyx_kp_50;
-static char __pyx_k_51[] = "mu2_tet";
-static PyObject *__pyx_kp_51;
-static char __pyx_k_52[] = "mu1_tet";
-static PyObject *__pyx_kp_52;
-static char __pyx_k_53[] = "mu1_tri";
-static PyObject *__pyx_kp_53;
-static char __pyx_k_shape[] = "shape";
-static PyObject *__pyx_kp_shape;
-static char __pyx_k_56[] = "_convert_stride2";
-static PyObject *__pyx_kp_56;
-static PyObject *__pyx_builtin_ValueError;
-static PyObject *__pyx_builtin_range;
-static PyObject *__pyx_kp_46;
-static char __pyx_k_46[] = "mask should be filled with 0/1 values, but be of type np.int";
-static PyObject *__pyx_kp_47;
-static PyObject *__pyx_kp_48;
-static char __pyx_k_47[] = "mask should be filled with 0/1 values, but be of type np.int";
-static char __pyx_k_48[] = "shape of mask does not match coordinates";
-static PyObject *__pyx_kp_54;
-static PyObject *__pyx_kp_55;
-static char __pyx_k_54[] = "mask should be filled with 0/1 values, but be of type np.int";
-static char __pyx_k_55[] = "shape of mask does not match coordinates";
-static PyObject *__pyx_kp_57;
-static char __pyx_k_57[] = "mask should be filled with 0/1 values, but be of type np.int";
-static PyObject *__pyx_kp_58;
-static PyObject *__pyx_kp_59;
-static char __pyx_k_58[] = "mask should be filled with 0/1 values, but be of type np.int";
-static char __pyx_k_59[] = "shape of mask does not match coordinates";
-static PyObject *__pyx_kp_60;
-static char __pyx_k_60[] = "mask should be filled with 0/1 values, but be of type np.int";
-static PyObject *__pyx_int_15;
-static char __pyx_k___getbuffer__[] = "__getbuffer__";
-static PyObject *__pyx_kp___getbuffer__;
-static char __pyx_k___releasebuffer__[] = "__releasebuffer__";
-static PyObject *__pyx_kp___releasebuffer__;
-static char __pyx_k_info[] = "info";
-static PyObject *__pyx_kp_info;
-static char __pyx_k_flags[] = "flags";
-static PyObject *__pyx_kp_flags;
-static char __pyx_k_itervalues[] = "itervalues";
-static PyObject *__pyx_kp_itervalues;
-static char __pyx_k_RuntimeError[] = "RuntimeError";
-static PyObject *__pyx_kp_RuntimeError;
-static PyObject *__pyx_kp_1;
-static PyObject *__pyx_kp_2;
-static PyObject *__pyx_kp_5;
-static PyObject *__pyx_kp_23;
-static PyObject *__pyx_builtin_RuntimeError;
-static char __pyx_k_1[] = "ndarray is not C contiguous";
-static char __pyx_k_2[] = "ndarray is not Fortran contiguous";
-static char __pyx_k_3[] = ">";
-static char __pyx_k_4[] = "<";
-static char __pyx_k_5[] = "Non-native byte order not supported";
-static char __pyx_k_6[] = "b";
-static char __pyx_k_7[] = "B";
-static char __pyx_k_8[] = "h";
-static char __pyx_k_9[] = "H";
-static char __pyx_k_10[] = "i";
-static char __pyx_k_11[] = "I";
-static char __pyx_k_12[] = "l";
-static char __pyx_k_13[] = "L";
-static char __pyx_k_14[] = "q";
-static char __pyx_k_15[] = "Q";
-static char __pyx_k_16[] = "f";
-static char __pyx_k_17[] = "d";
-static char __pyx_k_18[] = "g";
-static char __pyx_k_19[] = "Zf";
-static char __pyx_k_20[] = "Zd";
-static char __pyx_k_21[] = "Zg";
-static char __pyx_k_22[] = "O";
-static char __pyx_k_23[] = "unknown dtype code in numpy.pxd (%d)";
-static char __pyx_k_24[] = "^";
-static PyObject *__pyx_kp_25;
-static PyObject *__pyx_kp_28;
-static PyObject *__pyx_kp_29;
-static PyObject *__pyx_kp_30;
-static char __pyx_k_25[] = "Format string allocated too short, see comment in numpy.pxd";
-static char __pyx_k_26[] = ">";
-static char __pyx_k_27[] = "<";
-static char __pyx_k_28[] = "Non-native byte order not supported";
-static char __pyx_k_29[] = "Format string allocated too short.";
-static char __pyx_k_30[] = "unknown dtype code in numpy.pxd (%d)";
-
-/* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":25
- * ctypedef np.int_t DTYPE_int_t
- * 
- * def mu3_tet(double D00, double D01, double D02, double D03,             # <<<<<<<<<<<<<<
- *             double D11, double D12, double D13,
- *             double D22, double D23,
- */
-
-static PyObject *__pyx_pf_4nipy_10algorithms_10statistics_6intvol_mu3_tet(PyObject *__pyx_self, PyObject *__pyx_args, PyObject *__pyx_kwds); /*proto*/
-static char __pyx_doc_4nipy_10algorithms_10statistics_6intvol_mu3_tet[] = "\n  Compute the 3rd intrinsic volume (just volume in this case) of \n  a tetrahedron with coordinates [coords[v0], coords[v1], coords[v2], coords[v3]].\n\n  Inputs:\n  -------\n\n  coords : ndarray((*,2))\n       An array of coordinates of vertices of tetrahedron.\n\n  v0, v1, v2, v3 : int\n       Indices for vertices of the tetrahedron.\n\n  Outputs:\n  --------\n\n  mu3 : float\n\n  ";
-static PyObject *__pyx_pf_4nipy_10algorithms_10statistics_6intvol_mu3_tet(PyObject *__pyx_self, PyObject *__pyx_args, PyObject *__pyx_kwds) {
-  double __pyx_v_D00;
-  double __pyx_v_D01;
-  double __pyx_v_D02;
-  double __pyx_v_D03;
-  double __pyx_v_D11;
-  double __pyx_v_D12;
-  double __pyx_v_D13;
-  double __pyx_v_D22;
-  double __pyx_v_D23;
-  double __pyx_v_D33;
-  PyObject *__pyx_v_C00;
-  PyObject *__pyx_v_C01;
-  PyObject *__pyx_v_C02;
-  PyObject *__pyx_v_C11;
-  PyObject *__pyx_v_C12;
-  PyObject *__pyx_v_C22;
-  PyObject *__pyx_r = NULL;
-  PyObject *__pyx_1 = 0;
-  PyObject *__pyx_t_1 = NULL;
-  PyObject *__pyx_t_2 = NULL;
-  PyObject *__pyx_t_3 = NULL;
-  PyObject *__pyx_t_4 = NULL;
-  PyObject *__pyx_t_5 = NULL;
-  PyObject *__pyx_t_6 = NULL;
-  static PyObject **__pyx_pyargnames[] = {&__pyx_kp_D00,&__pyx_kp_31,&__pyx_kp_32,&__pyx_kp_33,&__pyx_kp_34,&__pyx_kp_35,&__pyx_kp_36,&__pyx_kp_37,&__pyx_kp_38,&__pyx_kp_39,0};
-  __Pyx_SetupRefcountContext("mu3_tet");
-  __pyx_self = __pyx_self;
-  if (unlikely(__pyx_kwds)) {
-    Py_ssize_t kw_args = PyDict_Size(__pyx_kwds);
-    PyObject* values[10] = {0,0,0,0,0,0,0,0,0,0};
-    switch (PyTuple_GET_SIZE(__pyx_args)) {
-      case 10: values[9] = PyTuple_GET_ITEM(__pyx_args, 9);
-      case  9: values[8] = PyTuple_GET_ITEM(__pyx_args, 8);
-      case  8: values[7] = PyTuple_GET_ITEM(__pyx_args, 7);
-      case  7: values[6] = PyTuple_GET_ITEM(__pyx_args, 6);
-      case  6: values[5] = PyTuple_GET_ITEM(__pyx_args, 5);
-      case  5: values[4] = PyTuple_GET_ITEM(__pyx_args, 4);
-      case  4: values[3] = PyTuple_GET_ITEM(__pyx_args, 3);
-      case  3: values[2] = PyTuple_GET_ITEM(__pyx_args, 2);
-      case  2: values[1] = PyTuple_GET_ITEM(__pyx_args, 1);
-      case  1: values[0] = PyTuple_GET_ITEM(__pyx_args, 0);
-      case  0: break;
-      default: goto __pyx_L5_argtuple_error;
-    }
-    switch (PyTuple_GET_SIZE(__pyx_args)) {
-      case  0:
-      values[0] = PyDict_GetItem(__pyx_kwds, __pyx_kp_D00);
-      if (likely(values[0])) kw_args--;
-      else goto __pyx_L5_argtuple_error;
-      case  1:
-      values[1] = PyDict_GetItem(__pyx_kwds, __pyx_kp_31);
-      if (likely(values[1])) kw_args--;
-      else {
-        __Pyx_RaiseArgtupleInvalid("mu3_tet", 1, 10, 10, 1); {__pyx_filename = __pyx_f[0]; __pyx_lineno = 25; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-      }
-      case  2:
-      values[2] = PyDict_GetItem(__pyx_kwds, __pyx_kp_32);
-      if (likely(values[2])) kw_args--;
-      else {
-        __Pyx_RaiseArgtupleInvalid("mu3_tet", 1, 10, 10, 2); {__pyx_filename = __pyx_f[0]; __pyx_lineno = 25; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-      }
-      case  3:
-      values[3] = PyDict_GetItem(__pyx_kwds, __pyx_kp_33);
-      if (likely(values[3])) kw_args--;
-      else {
-        __Pyx_RaiseArgtupleInvalid("mu3_tet", 1, 10, 10, 3); {__pyx_filename = __pyx_f[0]; __pyx_lineno = 25; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-      }
-      case  4:
-      values[4] = PyDict_GetItem(__pyx_kwds, __pyx_kp_34);
-      if (likely(values[4])) kw_args--;
-      else {
-        __Pyx_RaiseArgtupleInvalid("mu3_tet", 1, 10, 10, 4); {__pyx_filename = __pyx_f[0]; __pyx_lineno = 25; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-      }
-      case  5:
-      values[5] = PyDict_GetItem(__pyx_kwds, __pyx_kp_35);
-      if (likely(values[5])) kw_args--;
-      else {
-        __Pyx_RaiseArgtupleInvalid("mu3_tet", 1, 10, 10, 5); {__pyx_filename = __pyx_f[0]; __pyx_lineno = 25; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-      }
-      case  6:
-      values[6] = PyDict_GetItem(__pyx_kwds, __pyx_kp_36);
-      if (likely(values[6])) kw_args--;
-      else {
-        __Pyx_RaiseArgtupleInvalid("mu3_tet", 1, 10, 10, 6); {__pyx_filename = __pyx_f[0]; __pyx_lineno = 25; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-      }
-      case  7:
-      values[7] = PyDict_GetItem(__pyx_kwds, __pyx_kp_37);
-      if (likely(values[7])) kw_args--;
-      else {
-        __Pyx_RaiseArgtupleInvalid("mu3_tet", 1, 10, 10, 7); {__pyx_filename = __pyx_f[0]; __pyx_lineno = 25; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-      }
-      case  8:
-      values[8] = PyDict_GetItem(__pyx_kwds, __pyx_kp_38);
-      if (likely(values[8])) kw_args--;
-      else {
-        __Pyx_RaiseArgtupleInvalid("mu3_tet", 1, 10, 10, 8); {__pyx_filename = __pyx_f[0]; __pyx_lineno = 25; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-      }
-      case  9:
-      values[9] = PyDict_GetItem(__pyx_kwds, __pyx_kp_39);
-      if (likely(values[9])) kw_args--;
-      else {
-        __Pyx_RaiseArgtupleInvalid("mu3_tet", 1, 10, 10, 9); {__pyx_filename = __pyx_f[0]; __pyx_lineno = 25; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-      }
-    }
-    if (unlikely(kw_args > 0)) {
-      if (unlikely(__Pyx_ParseOptionalKeywords(__pyx_kwds, __pyx_pyargnames, 0, values, PyTuple_GET_SIZE(__pyx_args), "mu3_tet") < 0)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 25; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-    }
-    __pyx_v_D00 = __pyx_PyFloat_AsDouble(values[0]); if (unlikely(PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 25; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-    __pyx_v_D01 = __pyx_PyFloat_AsDouble(values[1]); if (unlikely(PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 25; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-    __pyx_v_D02 = __pyx_PyFloat_AsDouble(values[2]); if (unlikely(PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 25; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-    __pyx_v_D03 = __pyx_PyFloat_AsDouble(values[3]); if (unlikely(PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 25; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-    __pyx_v_D11 = __pyx_PyFloat_AsDouble(values[4]); if (unlikely(PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 26; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-    __pyx_v_D12 = __pyx_PyFloat_AsDouble(values[5]); if (unlikely(PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 26; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-    __pyx_v_D13 = __pyx_PyFloat_AsDouble(values[6]); if (unlikely(PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 26; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-    __pyx_v_D22 = __pyx_PyFloat_AsDouble(values[7]); if (unlikely(PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 27; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-    __pyx_v_D23 = __pyx_PyFloat_AsDouble(values[8]); if (unlikely(PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 27; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-    __pyx_v_D33 = __pyx_PyFloat_AsDouble(values[9]); if (unlikely(PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 28; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-  } else if (PyTuple_GET_SIZE(__pyx_args) != 10) {
-    goto __pyx_L5_argtuple_error;
-  } else {
-    __pyx_v_D00 = __pyx_PyFloat_AsDouble(PyTuple_GET_ITEM(__pyx_args, 0)); if (unlikely(PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 25; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-    __pyx_v_D01 = __pyx_PyFloat_AsDouble(PyTuple_GET_ITEM(__pyx_args, 1)); if (unlikely(PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 25; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-    __pyx_v_D02 = __pyx_PyFloat_AsDouble(PyTuple_GET_ITEM(__pyx_args, 2)); if (unlikely(PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 25; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-    __pyx_v_D03 = __pyx_PyFloat_AsDouble(PyTuple_GET_ITEM(__pyx_args, 3)); if (unlikely(PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 25; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-    __pyx_v_D11 = __pyx_PyFloat_AsDouble(PyTuple_GET_ITEM(__pyx_args, 4)); if (unlikely(PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 26; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-    __pyx_v_D12 = __pyx_PyFloat_AsDouble(PyTuple_GET_ITEM(__pyx_args, 5)); if (unlikely(PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 26; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-    __pyx_v_D13 = __pyx_PyFloat_AsDouble(PyTuple_GET_ITEM(__pyx_args, 6)); if (unlikely(PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 26; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-    __pyx_v_D22 = __pyx_PyFloat_AsDouble(PyTuple_GET_ITEM(__pyx_args, 7)); if (unlikely(PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 27; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-    __pyx_v_D23 = __pyx_PyFloat_AsDouble(PyTuple_GET_ITEM(__pyx_args, 8)); if (unlikely(PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 27; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-    __pyx_v_D33 = __pyx_PyFloat_AsDouble(PyTuple_GET_ITEM(__pyx_args, 9)); if (unlikely(PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 28; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-  }
-  goto __pyx_L4_argument_unpacking_done;
-  __pyx_L5_argtuple_error:;
-  __Pyx_RaiseArgtupleInvalid("mu3_tet", 1, 10, 10, PyTuple_GET_SIZE(__pyx_args)); {__pyx_filename = __pyx_f[0]; __pyx_lineno = 25; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-  __pyx_L3_error:;
-  __Pyx_AddTraceback("nipy.algorithms.statistics.intvol.mu3_tet");
-  return NULL;
-  __pyx_L4_argument_unpacking_done:;
-  __pyx_v_C00 = Py_None; __Pyx_INCREF(Py_None);
-  __pyx_v_C01 = Py_None; __Pyx_INCREF(Py_None);
-  __pyx_v_C02 = Py_None; __Pyx_INCREF(Py_None);
-  __pyx_v_C11 = Py_None; __Pyx_INCREF(Py_None);
-  __pyx_v_C12 = Py_None; __Pyx_INCREF(Py_None);
-  __pyx_v_C22 = Py_None; __Pyx_INCREF(Py_None);
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":50
- *   """
- * 
- *   C00, C01, C02, C11, C12, C22 = (D00 - 2*D03 + D33,             # <<<<<<<<<<<<<<
- *                                   D01 - D13 -
- *                                   D03 + D33,
- */
-  __pyx_t_1 = PyFloat_FromDouble(((__pyx_v_D00 - (2 * __pyx_v_D03)) + __pyx_v_D33)); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 50; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_1);
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":52
- *   C00, C01, C02, C11, C12, C22 = (D00 - 2*D03 + D33,
- *                                   D01 - D13 -
- *                                   D03 + D33,             # <<<<<<<<<<<<<<
- *                                   D02 - D23 -
- *                                   D03 + D33,
- */
-  __pyx_t_2 = PyFloat_FromDouble((((__pyx_v_D01 - __pyx_v_D13) - __pyx_v_D03) + __pyx_v_D33)); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 52; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_2);
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":54
- *                                   D03 + D33,
- *                                   D02 - D23 -
- *                                   D03 + D33,             # <<<<<<<<<<<<<<
- *                                   D11 - 2*D13 + D33,
- *                                   D12 - D13 -
- */
-  __pyx_t_3 = PyFloat_FromDouble((((__pyx_v_D02 - __pyx_v_D23) - __pyx_v_D03) + __pyx_v_D33)); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 54; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_3);
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":55
- *                                   D02 - D23 -
- *                                   D03 + D33,
- *                                   D11 - 2*D13 + D33,             # <<<<<<<<<<<<<<
- *                                   D12 - D13 -
- *                                   D23 + D33,
- */
-  __pyx_t_4 = PyFloat_FromDouble(((__pyx_v_D11 - (2 * __pyx_v_D13)) + __pyx_v_D33)); if (unlikely(!__pyx_t_4)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 55; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_4);
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":57
- *                                   D11 - 2*D13 + D33,
- *                                   D12 - D13 -
- *                                   D23 + D33,             # <<<<<<<<<<<<<<
- *                                   D22 - 2*D23 + D33)
- * 
- */
-  __pyx_t_5 = PyFloat_FromDouble((((__pyx_v_D12 - __pyx_v_D13) - __pyx_v_D23) + __pyx_v_D33)); if (unlikely(!__pyx_t_5)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 57; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_5);
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":58
- *                                   D12 - D13 -
- *                                   D23 + D33,
- *                                   D22 - 2*D23 + D33)             # <<<<<<<<<<<<<<
- * 
- *   return np.sqrt((C00 * (C11 * C22 - C12 * C12) -
- */
-  __pyx_t_6 = PyFloat_FromDouble(((__pyx_v_D22 - (2 * __pyx_v_D23)) + __pyx_v_D33)); if (unlikely(!__pyx_t_6)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 58; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_6);
-  __Pyx_DECREF(__pyx_v_C00);
-  __pyx_v_C00 = __pyx_t_1;
-  __pyx_t_1 = 0;
-  __Pyx_DECREF(__pyx_v_C01);
-  __pyx_v_C01 = __pyx_t_2;
-  __pyx_t_2 = 0;
-  __Pyx_DECREF(__pyx_v_C02);
-  __pyx_v_C02 = __pyx_t_3;
-  __pyx_t_3 = 0;
-  __Pyx_DECREF(__pyx_v_C11);
-  __pyx_v_C11 = __pyx_t_4;
-  __pyx_t_4 = 0;
-  __Pyx_DECREF(__pyx_v_C12);
-  __pyx_v_C12 = __pyx_t_5;
-  __pyx_t_5 = 0;
-  __Pyx_DECREF(__pyx_v_C22);
-  __pyx_v_C22 = __pyx_t_6;
-  __pyx_t_6 = 0;
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":60
- *                                   D22 - 2*D23 + D33)
- * 
- *   return np.sqrt((C00 * (C11 * C22 - C12 * C12) -             # <<<<<<<<<<<<<<
- *                   C01 * (C01 * C22 - C02 * C12) +
- *                   C02 * (C01 * C12 - C11 * C02))) / 6.;
- */
-  __Pyx_XDECREF(__pyx_r);
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":62
- *   return np.sqrt((C00 * (C11 * C22 - C12 * C12) -
- *                   C01 * (C01 * C22 - C02 * C12) +
- *                   C02 * (C01 * C12 - C11 * C02))) / 6.;             # <<<<<<<<<<<<<<
- * 
- * def mu2_tet(double D00, double D01, double D02, double D03,
- */
-  __pyx_1 = __Pyx_GetName(__pyx_m, __pyx_kp_np); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 60; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_1);
-  __pyx_t_6 = PyObject_GetAttr(__pyx_1, __pyx_kp_sqrt); if (unlikely(!__pyx_t_6)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 60; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_6);
-  __Pyx_DECREF(__pyx_1); __pyx_1 = 0;
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":60
- *                                   D22 - 2*D23 + D33)
- * 
- *   return np.sqrt((C00 * (C11 * C22 - C12 * C12) -             # <<<<<<<<<<<<<<
- *                   C01 * (C01 * C22 - C02 * C12) +
- *                   C02 * (C01 * C12 - C11 * C02))) / 6.;
- */
-  __pyx_t_5 = PyNumber_Multiply(__pyx_v_C11, __pyx_v_C22); if (unlikely(!__pyx_t_5)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 60; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_5);
-  __pyx_t_4 = PyNumber_Multiply(__pyx_v_C12, __pyx_v_C12); if (unlikely(!__pyx_t_4)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 60; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_4);
-  __pyx_t_3 = PyNumber_Subtract(__pyx_t_5, __pyx_t_4); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 60; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_3);
-  __Pyx_DECREF(__pyx_t_5); __pyx_t_5 = 0;
-  __Pyx_DECREF(__pyx_t_4); __pyx_t_4 = 0;
-  __pyx_t_4 = PyNumber_Multiply(__pyx_v_C00, __pyx_t_3); if (unlikely(!__pyx_t_4)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 60; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_4);
-  __Pyx_DECREF(__pyx_t_3); __pyx_t_3 = 0;
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":61
- * 
- *   return np.sqrt((C00 * (C11 * C22 - C12 * C12) -
- *                   C01 * (C01 * C22 - C02 * C12) +             # <<<<<<<<<<<<<<
- *                   C02 * (C01 * C12 - C11 * C02))) / 6.;
- * 
- */
-  __pyx_t_3 = PyNumber_Multiply(__pyx_v_C01, __pyx_v_C22); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 61; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_3);
-  __pyx_t_5 = PyNumber_Multiply(__pyx_v_C02, __pyx_v_C12); if (unlikely(!__pyx_t_5)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 61; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_5);
-  __pyx_t_2 = PyNumber_Subtract(__pyx_t_3, __pyx_t_5); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 61; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_2);
-  __Pyx_DECREF(__pyx_t_3); __pyx_t_3 = 0;
-  __Pyx_DECREF(__pyx_t_5); __pyx_t_5 = 0;
-  __pyx_t_5 = PyNumber_Multiply(__pyx_v_C01, __pyx_t_2); if (unlikely(!__pyx_t_5)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 61; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_5);
-  __Pyx_DECREF(__pyx_t_2); __pyx_t_2 = 0;
-  __pyx_t_2 = PyNumber_Subtract(__pyx_t_4, __pyx_t_5); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 60; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_2);
-  __Pyx_DECREF(__pyx_t_4); __pyx_t_4 = 0;
-  __Pyx_DECREF(__pyx_t_5); __pyx_t_5 = 0;
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":62
- *   return np.sqrt((C00 * (C11 * C22 - C12 * C12) -
- *                   C01 * (C01 * C22 - C02 * C12) +
- *                   C02 * (C01 * C12 - C11 * C02))) / 6.;             # <<<<<<<<<<<<<<
- * 
- * def mu2_tet(double D00, double D01, double D02, double D03,
- */
-  __pyx_t_5 = PyNumber_Multiply(__pyx_v_C01, __pyx_v_C12); if (unlikely(!__pyx_t_5)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 62; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_5);
-  __pyx_t_4 = PyNumber_Multiply(__pyx_v_C11, __pyx_v_C02); if (unlikely(!__pyx_t_4)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 62; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_4);
-  __pyx_t_3 = PyNumber_Subtract(__pyx_t_5, __pyx_t_4); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 62; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_3);
-  __Pyx_DECREF(__pyx_t_5); __pyx_t_5 = 0;
-  __Pyx_DECREF(__pyx_t_4); __pyx_t_4 = 0;
-  __pyx_t_4 = PyNumber_Multiply(__pyx_v_C02, __pyx_t_3); if (unlikely(!__pyx_t_4)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 62; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_4);
-  __Pyx_DECREF(__pyx_t_3); __pyx_t_3 = 0;
-  __pyx_t_3 = PyNumber_Add(__pyx_t_2, __pyx_t_4); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 61; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_3);
-  __Pyx_DECREF(__pyx_t_2); __pyx_t_2 = 0;
-  __Pyx_DECREF(__pyx_t_4); __pyx_t_4 = 0;
-  __pyx_t_4 = PyTuple_New(1); if (unlikely(!__pyx_t_4)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 60; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_4));
-  PyTuple_SET_ITEM(__pyx_t_4, 0, __pyx_t_3);
-  __Pyx_GIVEREF(__pyx_t_3);
-  __pyx_t_3 = 0;
-  __pyx_t_3 = PyObject_Call(__pyx_t_6, ((PyObject *)__pyx_t_4), NULL); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 60; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_3);
-  __Pyx_DECREF(__pyx_t_6); __pyx_t_6 = 0;
-  __Pyx_DECREF(((PyObject *)__pyx_t_4)); __pyx_t_4 = 0;
-  __pyx_t_4 = PyFloat_FromDouble(6.0); if (unlikely(!__pyx_t_4)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 62; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_4);
-  __pyx_t_6 = __Pyx_PyNumber_Divide(__pyx_t_3, __pyx_t_4); if (unlikely(!__pyx_t_6)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 62; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_6);
-  __Pyx_DECREF(__pyx_t_3); __pyx_t_3 = 0;
-  __Pyx_DECREF(__pyx_t_4); __pyx_t_4 = 0;
-  __pyx_r = __pyx_t_6;
-  __pyx_t_6 = 0;
-  goto __pyx_L0;
-
-  __pyx_r = Py_None; __Pyx_INCREF(Py_None);
-  goto __pyx_L0;
-  __pyx_L1_error:;
-  __Pyx_XDECREF(__pyx_1);
-  __Pyx_XDECREF(__pyx_t_1);
-  __Pyx_XDECREF(__pyx_t_2);
-  __Pyx_XDECREF(__pyx_t_3);
-  __Pyx_XDECREF(__pyx_t_4);
-  __Pyx_XDECREF(__pyx_t_5);
-  __Pyx_XDECREF(__pyx_t_6);
-  __Pyx_AddTraceback("nipy.algorithms.statistics.intvol.mu3_tet");
-  __pyx_r = NULL;
-  __pyx_L0:;
-  __Pyx_DECREF(__pyx_v_C00);
-  __Pyx_DECREF(__pyx_v_C01);
-  __Pyx_DECREF(__pyx_v_C02);
-  __Pyx_DECREF(__pyx_v_C11);
-  __Pyx_DECREF(__pyx_v_C12);
-  __Pyx_DECREF(__pyx_v_C22);
-  __Pyx_XGIVEREF(__pyx_r);
-  __Pyx_FinishRefcountContext();
-  return __pyx_r;
-}
-
-/* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":64
- *                   C02 * (C01 * C12 - C11 * C02))) / 6.;
- * 
- * def mu2_tet(double D00, double D01, double D02, double D03,             # <<<<<<<<<<<<<<
- *             double D11, double D12, double D13,
- *             double D22, double D23,
- */
-
-static PyObject *__pyx_pf_4nipy_10algorithms_10statistics_6intvol_mu2_tet(PyObject *__pyx_self, PyObject *__pyx_args, PyObject *__pyx_kwds); /*proto*/
-static char __pyx_doc_4nipy_10algorithms_10statistics_6intvol_mu2_tet[] = "\n  Compute the 2nd intrinsic volume (half the surface area) of \n  a tetrahedron with coordinates [coords[v0], coords[v1], coords[v2], coords[v3]].\n\n  Inputs:\n  -------\n\n  coords : ndarray((*,2))\n       An array of coordinates of vertices of tetrahedron.\n\n  v0, v1, v2, v3 : int\n       Indices for vertices of the tetrahedron.\n\n  Outputs:\n  --------\n\n  mu2 : float\n\n  ";
-static PyObject *__pyx_pf_4nipy_10algorithms_10statistics_6intvol_mu2_tet(PyObject *__pyx_self, PyObject *__pyx_args, PyObject *__pyx_kwds) {
-  double __pyx_v_D00;
-  double __pyx_v_D01;
-  double __pyx_v_D02;
-  double __pyx_v_D03;
-  double __pyx_v_D11;
-  double __pyx_v_D12;
-  double __pyx_v_D13;
-  double __pyx_v_D22;
-  double __pyx_v_D23;
-  double __pyx_v_D33;
-  double __pyx_v_mu;
-  PyObject *__pyx_r = NULL;
-  PyObject *__pyx_1 = 0;
-  PyObject *__pyx_t_1 = NULL;
-  PyObject *__pyx_t_2 = NULL;
-  PyObject *__pyx_t_3 = NULL;
-  PyObject *__pyx_t_4 = NULL;
-  PyObject *__pyx_t_5 = NULL;
-  PyObject *__pyx_t_6 = NULL;
-  PyObject *__pyx_t_7 = NULL;
-  double __pyx_t_8;
-  static PyObject **__pyx_pyargnames[] = {&__pyx_kp_D00,&__pyx_kp_31,&__pyx_kp_32,&__pyx_kp_33,&__pyx_kp_34,&__pyx_kp_35,&__pyx_kp_36,&__pyx_kp_37,&__pyx_kp_38,&__pyx_kp_39,0};
-  __Pyx_SetupRefcountContext("mu2_tet");
-  __pyx_self = __pyx_self;
-  if (unlikely(__pyx_kwds)) {
-    Py_ssize_t kw_args = PyDict_Size(__pyx_kwds);
-    PyObject* values[10] = {0,0,0,0,0,0,0,0,0,0};
-    switch (PyTuple_GET_SIZE(__pyx_args)) {
-      case 10: values[9] = PyTuple_GET_ITEM(__pyx_args, 9);
-      case  9: values[8] = PyTuple_GET_ITEM(__pyx_args, 8);
-      case  8: values[7] = PyTuple_GET_ITEM(__pyx_args, 7);
-      case  7: values[6] = PyTuple_GET_ITEM(__pyx_args, 6);
-      case  6: values[5] = PyTuple_GET_ITEM(__pyx_args, 5);
-      case  5: values[4] = PyTuple_GET_ITEM(__pyx_args, 4);
-      case  4: values[3] = PyTuple_GET_ITEM(__pyx_args, 3);
-      case  3: values[2] = PyTuple_GET_ITEM(__pyx_args, 2);
-      case  2: values[1] = PyTuple_GET_ITEM(__pyx_args, 1);
-      case  1: values[0] = PyTuple_GET_ITEM(__pyx_args, 0);
-      case  0: break;
-      default: goto __pyx_L5_argtuple_error;
-    }
-    switch (PyTuple_GET_SIZE(__pyx_args)) {
-      case  0:
-      values[0] = PyDict_GetItem(__pyx_kwds, __pyx_kp_D00);
-      if (likely(values[0])) kw_args--;
-      else goto __pyx_L5_argtuple_error;
-      case  1:
-      values[1] = PyDict_GetItem(__pyx_kwds, __pyx_kp_31);
-      if (likely(values[1])) kw_args--;
-      else {
-        __Pyx_RaiseArgtupleInvalid("mu2_tet", 1, 10, 10, 1); {__pyx_filename = __pyx_f[0]; __pyx_lineno = 64; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-      }
-      case  2:
-      values[2] = PyDict_GetItem(__pyx_kwds, __pyx_kp_32);
-      if (likely(values[2])) kw_args--;
-      else {
-        __Pyx_RaiseArgtupleInvalid("mu2_tet", 1, 10, 10, 2); {__pyx_filename = __pyx_f[0]; __pyx_lineno = 64; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-      }
-      case  3:
-      values[3] = PyDict_GetItem(__pyx_kwds, __pyx_kp_33);
-      if (likely(values[3])) kw_args--;
-      else {
-        __Pyx_RaiseArgtupleInvalid("mu2_tet", 1, 10, 10, 3); {__pyx_filename = __pyx_f[0]; __pyx_lineno = 64; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-      }
-      case  4:
-      values[4] = PyDict_GetItem(__pyx_kwds, __pyx_kp_34);
-      if (likely(values[4])) kw_args--;
-      else {
-        __Pyx_RaiseArgtupleInvalid("mu2_tet", 1, 10, 10, 4); {__pyx_filename = __pyx_f[0]; __pyx_lineno = 64; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-      }
-      case  5:
-      values[5] = PyDict_GetItem(__pyx_kwds, __pyx_kp_35);
-      if (likely(values[5])) kw_args--;
-      else {
-        __Pyx_RaiseArgtupleInvalid("mu2_tet", 1, 10, 10, 5); {__pyx_filename = __pyx_f[0]; __pyx_lineno = 64; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-      }
-      case  6:
-      values[6] = PyDict_GetItem(__pyx_kwds, __pyx_kp_36);
-      if (likely(values[6])) kw_args--;
-      else {
-        __Pyx_RaiseArgtupleInvalid("mu2_tet", 1, 10, 10, 6); {__pyx_filename = __pyx_f[0]; __pyx_lineno = 64; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-      }
-      case  7:
-      values[7] = PyDict_GetItem(__pyx_kwds, __pyx_kp_37);
-      if (likely(values[7])) kw_args--;
-      else {
-        __Pyx_RaiseArgtupleInvalid("mu2_tet", 1, 10, 10, 7); {__pyx_filename = __pyx_f[0]; __pyx_lineno = 64; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-      }
-      case  8:
-      values[8] = PyDict_GetItem(__pyx_kwds, __pyx_kp_38);
-      if (likely(values[8])) kw_args--;
-      else {
-        __Pyx_RaiseArgtupleInvalid("mu2_tet", 1, 10, 10, 8); {__pyx_filename = __pyx_f[0]; __pyx_lineno = 64; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-      }
-      case  9:
-      values[9] = PyDict_GetItem(__pyx_kwds, __pyx_kp_39);
-      if (likely(values[9])) kw_args--;
-      else {
-        __Pyx_RaiseArgtupleInvalid("mu2_tet", 1, 10, 10, 9); {__pyx_filename = __pyx_f[0]; __pyx_lineno = 64; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-      }
-    }
-    if (unlikely(kw_args > 0)) {
-      if (unlikely(__Pyx_ParseOptionalKeywords(__pyx_kwds, __pyx_pyargnames, 0, values, PyTuple_GET_SIZE(__pyx_args), "mu2_tet") < 0)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 64; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-    }
-    __pyx_v_D00 = __pyx_PyFloat_AsDouble(values[0]); if (unlikely(PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 64; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-    __pyx_v_D01 = __pyx_PyFloat_AsDouble(values[1]); if (unlikely(PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 64; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-    __pyx_v_D02 = __pyx_PyFloat_AsDouble(values[2]); if (unlikely(PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 64; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-    __pyx_v_D03 = __pyx_PyFloat_AsDouble(values[3]); if (unlikely(PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 64; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-    __pyx_v_D11 = __pyx_PyFloat_AsDouble(values[4]); if (unlikely(PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 65; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-    __pyx_v_D12 = __pyx_PyFloat_AsDouble(values[5]); if (unlikely(PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 65; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-    __pyx_v_D13 = __pyx_PyFloat_AsDouble(values[6]); if (unlikely(PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 65; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-    __pyx_v_D22 = __pyx_PyFloat_AsDouble(values[7]); if (unlikely(PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 66; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-    __pyx_v_D23 = __pyx_PyFloat_AsDouble(values[8]); if (unlikely(PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 66; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-    __pyx_v_D33 = __pyx_PyFloat_AsDouble(values[9]); if (unlikely(PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 67; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-  } else if (PyTuple_GET_SIZE(__pyx_args) != 10) {
-    goto __pyx_L5_argtuple_error;
-  } else {
-    __pyx_v_D00 = __pyx_PyFloat_AsDouble(PyTuple_GET_ITEM(__pyx_args, 0)); if (unlikely(PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 64; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-    __pyx_v_D01 = __pyx_PyFloat_AsDouble(PyTuple_GET_ITEM(__pyx_args, 1)); if (unlikely(PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 64; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-    __pyx_v_D02 = __pyx_PyFloat_AsDouble(PyTuple_GET_ITEM(__pyx_args, 2)); if (unlikely(PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 64; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-    __pyx_v_D03 = __pyx_PyFloat_AsDouble(PyTuple_GET_ITEM(__pyx_args, 3)); if (unlikely(PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 64; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-    __pyx_v_D11 = __pyx_PyFloat_AsDouble(PyTuple_GET_ITEM(__pyx_args, 4)); if (unlikely(PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 65; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-    __pyx_v_D12 = __pyx_PyFloat_AsDouble(PyTuple_GET_ITEM(__pyx_args, 5)); if (unlikely(PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 65; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-    __pyx_v_D13 = __pyx_PyFloat_AsDouble(PyTuple_GET_ITEM(__pyx_args, 6)); if (unlikely(PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 65; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-    __pyx_v_D22 = __pyx_PyFloat_AsDouble(PyTuple_GET_ITEM(__pyx_args, 7)); if (unlikely(PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 66; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-    __pyx_v_D23 = __pyx_PyFloat_AsDouble(PyTuple_GET_ITEM(__pyx_args, 8)); if (unlikely(PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 66; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-    __pyx_v_D33 = __pyx_PyFloat_AsDouble(PyTuple_GET_ITEM(__pyx_args, 9)); if (unlikely(PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 67; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-  }
-  goto __pyx_L4_argument_unpacking_done;
-  __pyx_L5_argtuple_error:;
-  __Pyx_RaiseArgtupleInvalid("mu2_tet", 1, 10, 10, PyTuple_GET_SIZE(__pyx_args)); {__pyx_filename = __pyx_f[0]; __pyx_lineno = 64; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-  __pyx_L3_error:;
-  __Pyx_AddTraceback("nipy.algorithms.statistics.intvol.mu2_tet");
-  return NULL;
-  __pyx_L4_argument_unpacking_done:;
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":88
- *   """
- * 
- *   cdef double mu = 0             # <<<<<<<<<<<<<<
- * 
- *   mu += mu2_tri(D00, D01, D02, D11, D12, D22)
- */
-  __pyx_v_mu = 0;
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":90
- *   cdef double mu = 0
- * 
- *   mu += mu2_tri(D00, D01, D02, D11, D12, D22)             # <<<<<<<<<<<<<<
- *   mu += mu2_tri(D00, D02, D03, D22, D23, D33)
- *   mu += mu2_tri(D11, D12, D13, D22, D23, D33)
- */
-  __pyx_1 = __Pyx_GetName(__pyx_m, __pyx_kp_44); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 90; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_1);
-  __pyx_t_1 = PyFloat_FromDouble(__pyx_v_D00); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 90; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_1);
-  __pyx_t_2 = PyFloat_FromDouble(__pyx_v_D01); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 90; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_2);
-  __pyx_t_3 = PyFloat_FromDouble(__pyx_v_D02); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 90; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_3);
-  __pyx_t_4 = PyFloat_FromDouble(__pyx_v_D11); if (unlikely(!__pyx_t_4)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 90; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_4);
-  __pyx_t_5 = PyFloat_FromDouble(__pyx_v_D12); if (unlikely(!__pyx_t_5)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 90; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_5);
-  __pyx_t_6 = PyFloat_FromDouble(__pyx_v_D22); if (unlikely(!__pyx_t_6)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 90; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_6);
-  __pyx_t_7 = PyTuple_New(6); if (unlikely(!__pyx_t_7)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 90; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_7));
-  PyTuple_SET_ITEM(__pyx_t_7, 0, __pyx_t_1);
-  __Pyx_GIVEREF(__pyx_t_1);
-  PyTuple_SET_ITEM(__pyx_t_7, 1, __pyx_t_2);
-  __Pyx_GIVEREF(__pyx_t_2);
-  PyTuple_SET_ITEM(__pyx_t_7, 2, __pyx_t_3);
-  __Pyx_GIVEREF(__pyx_t_3);
-  PyTuple_SET_ITEM(__pyx_t_7, 3, __pyx_t_4);
-  __Pyx_GIVEREF(__pyx_t_4);
-  PyTuple_SET_ITEM(__pyx_t_7, 4, __pyx_t_5);
-  __Pyx_GIVEREF(__pyx_t_5);
-  PyTuple_SET_ITEM(__pyx_t_7, 5, __pyx_t_6);
-  __Pyx_GIVEREF(__pyx_t_6);
-  __pyx_t_1 = 0;
-  __pyx_t_2 = 0;
-  __pyx_t_3 = 0;
-  __pyx_t_4 = 0;
-  __pyx_t_5 = 0;
-  __pyx_t_6 = 0;
-  __pyx_t_6 = PyObject_Call(__pyx_1, ((PyObject *)__pyx_t_7), NULL); if (unlikely(!__pyx_t_6)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 90; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_6);
-  __Pyx_DECREF(__pyx_1); __pyx_1 = 0;
-  __Pyx_DECREF(((PyObject *)__pyx_t_7)); __pyx_t_7 = 0;
-  __pyx_t_8 = __pyx_PyFloat_AsDouble(__pyx_t_6); if (unlikely(PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 90; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_DECREF(__pyx_t_6); __pyx_t_6 = 0;
-  __pyx_v_mu += __pyx_t_8;
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":91
- * 
- *   mu += mu2_tri(D00, D01, D02, D11, D12, D22)
- *   mu += mu2_tri(D00, D02, D03, D22, D23, D33)             # <<<<<<<<<<<<<<
- *   mu += mu2_tri(D11, D12, D13, D22, D23, D33)
- *   mu += mu2_tri(D00, D01, D03, D11, D13, D33)
- */
-  __pyx_1 = __Pyx_GetName(__pyx_m, __pyx_kp_44); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 91; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_1);
-  __pyx_t_6 = PyFloat_FromDouble(__pyx_v_D00); if (unlikely(!__pyx_t_6)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 91; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_6);
-  __pyx_t_7 = PyFloat_FromDouble(__pyx_v_D02); if (unlikely(!__pyx_t_7)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 91; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_7);
-  __pyx_t_5 = PyFloat_FromDouble(__pyx_v_D03); if (unlikely(!__pyx_t_5)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 91; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_5);
-  __pyx_t_4 = PyFloat_FromDouble(__pyx_v_D22); if (unlikely(!__pyx_t_4)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 91; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_4);
-  __pyx_t_3 = PyFloat_FromDouble(__pyx_v_D23); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 91; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_3);
-  __pyx_t_2 = PyFloat_FromDouble(__pyx_v_D33); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 91; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_2);
-  __pyx_t_1 = PyTuple_New(6); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 91; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_1));
-  PyTuple_SET_ITEM(__pyx_t_1, 0, __pyx_t_6);
-  __Pyx_GIVEREF(__pyx_t_6);
-  PyTuple_SET_ITEM(__pyx_t_1, 1, __pyx_t_7);
-  __Pyx_GIVEREF(__pyx_t_7);
-  PyTuple_SET_ITEM(__pyx_t_1, 2, __pyx_t_5);
-  __Pyx_GIVEREF(__pyx_t_5);
-  PyTuple_SET_ITEM(__pyx_t_1, 3, __pyx_t_4);
-  __Pyx_GIVEREF(__pyx_t_4);
-  PyTuple_SET_ITEM(__pyx_t_1, 4, __pyx_t_3);
-  __Pyx_GIVEREF(__pyx_t_3);
-  PyTuple_SET_ITEM(__pyx_t_1, 5, __pyx_t_2);
-  __Pyx_GIVEREF(__pyx_t_2);
-  __pyx_t_6 = 0;
-  __pyx_t_7 = 0;
-  __pyx_t_5 = 0;
-  __pyx_t_4 = 0;
-  __pyx_t_3 = 0;
-  __pyx_t_2 = 0;
-  __pyx_t_2 = PyObject_Call(__pyx_1, ((PyObject *)__pyx_t_1), NULL); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 91; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_2);
-  __Pyx_DECREF(__pyx_1); __pyx_1 = 0;
-  __Pyx_DECREF(((PyObject *)__pyx_t_1)); __pyx_t_1 = 0;
-  __pyx_t_8 = __pyx_PyFloat_AsDouble(__pyx_t_2); if (unlikely(PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 91; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_DECREF(__pyx_t_2); __pyx_t_2 = 0;
-  __pyx_v_mu += __pyx_t_8;
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":92
- *   mu += mu2_tri(D00, D01, D02, D11, D12, D22)
- *   mu += mu2_tri(D00, D02, D03, D22, D23, D33)
- *   mu += mu2_tri(D11, D12, D13, D22, D23, D33)             # <<<<<<<<<<<<<<
- *   mu += mu2_tri(D00, D01, D03, D11, D13, D33)
- *   return mu * 0.5
- */
-  __pyx_1 = __Pyx_GetName(__pyx_m, __pyx_kp_44); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 92; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_1);
-  __pyx_t_2 = PyFloat_FromDouble(__pyx_v_D11); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 92; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_2);
-  __pyx_t_1 = PyFloat_FromDouble(__pyx_v_D12); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 92; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_1);
-  __pyx_t_3 = PyFloat_FromDouble(__pyx_v_D13); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 92; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_3);
-  __pyx_t_4 = PyFloat_FromDouble(__pyx_v_D22); if (unlikely(!__pyx_t_4)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 92; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_4);
-  __pyx_t_5 = PyFloat_FromDouble(__pyx_v_D23); if (unlikely(!__pyx_t_5)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 92; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_5);
-  __pyx_t_7 = PyFloat_FromDouble(__pyx_v_D33); if (unlikely(!__pyx_t_7)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 92; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_7);
-  __pyx_t_6 = PyTuple_New(6); if (unlikely(!__pyx_t_6)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 92; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_6));
-  PyTuple_SET_ITEM(__pyx_t_6, 0, __pyx_t_2);
-  __Pyx_GIVEREF(__pyx_t_2);
-  PyTuple_SET_ITEM(__pyx_t_6, 1, __pyx_t_1);
-  __Pyx_GIVEREF(__pyx_t_1);
-  PyTuple_SET_ITEM(__pyx_t_6, 2, __pyx_t_3);
-  __Pyx_GIVEREF(__pyx_t_3);
-  PyTuple_SET_ITEM(__pyx_t_6, 3, __pyx_t_4);
-  __Pyx_GIVEREF(__pyx_t_4);
-  PyTuple_SET_ITEM(__pyx_t_6, 4, __pyx_t_5);
-  __Pyx_GIVEREF(__pyx_t_5);
-  PyTuple_SET_ITEM(__pyx_t_6, 5, __pyx_t_7);
-  __Pyx_GIVEREF(__pyx_t_7);
-  __pyx_t_2 = 0;
-  __pyx_t_1 = 0;
-  __pyx_t_3 = 0;
-  __pyx_t_4 = 0;
-  __pyx_t_5 = 0;
-  __pyx_t_7 = 0;
-  __pyx_t_7 = PyObject_Call(__pyx_1, ((PyObject *)__pyx_t_6), NULL); if (unlikely(!__pyx_t_7)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 92; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_7);
-  __Pyx_DECREF(__pyx_1); __pyx_1 = 0;
-  __Pyx_DECREF(((PyObject *)__pyx_t_6)); __pyx_t_6 = 0;
-  __pyx_t_8 = __pyx_PyFloat_AsDouble(__pyx_t_7); if (unlikely(PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 92; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_DECREF(__pyx_t_7); __pyx_t_7 = 0;
-  __pyx_v_mu += __pyx_t_8;
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":93
- *   mu += mu2_tri(D00, D02, D03, D22, D23, D33)
- *   mu += mu2_tri(D11, D12, D13, D22, D23, D33)
- *   mu += mu2_tri(D00, D01, D03, D11, D13, D33)             # <<<<<<<<<<<<<<
- *   return mu * 0.5
- * 
- */
-  __pyx_1 = __Pyx_GetName(__pyx_m, __pyx_kp_44); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 93; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_1);
-  __pyx_t_7 = PyFloat_FromDouble(__pyx_v_D00); if (unlikely(!__pyx_t_7)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 93; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_7);
-  __pyx_t_6 = PyFloat_FromDouble(__pyx_v_D01); if (unlikely(!__pyx_t_6)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 93; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_6);
-  __pyx_t_5 = PyFloat_FromDouble(__pyx_v_D03); if (unlikely(!__pyx_t_5)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 93; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_5);
-  __pyx_t_4 = PyFloat_FromDouble(__pyx_v_D11); if (unlikely(!__pyx_t_4)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 93; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_4);
-  __pyx_t_3 = PyFloat_FromDouble(__pyx_v_D13); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 93; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_3);
-  __pyx_t_1 = PyFloat_FromDouble(__pyx_v_D33); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 93; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_1);
-  __pyx_t_2 = PyTuple_New(6); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 93; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_2));
-  PyTuple_SET_ITEM(__pyx_t_2, 0, __pyx_t_7);
-  __Pyx_GIVEREF(__pyx_t_7);
-  PyTuple_SET_ITEM(__pyx_t_2, 1, __pyx_t_6);
-  __Pyx_GIVEREF(__pyx_t_6);
-  PyTuple_SET_ITEM(__pyx_t_2, 2, __pyx_t_5);
-  __Pyx_GIVEREF(__pyx_t_5);
-  PyTuple_SET_ITEM(__pyx_t_2, 3, __pyx_t_4);
-  __Pyx_GIVEREF(__pyx_t_4);
-  PyTuple_SET_ITEM(__pyx_t_2, 4, __pyx_t_3);
-  __Pyx_GIVEREF(__pyx_t_3);
-  PyTuple_SET_ITEM(__pyx_t_2, 5, __pyx_t_1);
-  __Pyx_GIVEREF(__pyx_t_1);
-  __pyx_t_7 = 0;
-  __pyx_t_6 = 0;
-  __pyx_t_5 = 0;
-  __pyx_t_4 = 0;
-  __pyx_t_3 = 0;
-  __pyx_t_1 = 0;
-  __pyx_t_1 = PyObject_Call(__pyx_1, ((PyObject *)__pyx_t_2), NULL); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 93; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_1);
-  __Pyx_DECREF(__pyx_1); __pyx_1 = 0;
-  __Pyx_DECREF(((PyObject *)__pyx_t_2)); __pyx_t_2 = 0;
-  __pyx_t_8 = __pyx_PyFloat_AsDouble(__pyx_t_1); if (unlikely(PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 93; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-  __pyx_v_mu += __pyx_t_8;
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":94
- *   mu += mu2_tri(D11, D12, D13, D22, D23, D33)
- *   mu += mu2_tri(D00, D01, D03, D11, D13, D33)
- *   return mu * 0.5             # <<<<<<<<<<<<<<
- * 
- * 
- */
-  __Pyx_XDECREF(__pyx_r);
-  __pyx_t_1 = PyFloat_FromDouble((__pyx_v_mu * 0.5)); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 94; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_1);
-  __pyx_r = __pyx_t_1;
-  __pyx_t_1 = 0;
-  goto __pyx_L0;
-
-  __pyx_r = Py_None; __Pyx_INCREF(Py_None);
-  goto __pyx_L0;
-  __pyx_L1_error:;
-  __Pyx_XDECREF(__pyx_1);
-  __Pyx_XDECREF(__pyx_t_1);
-  __Pyx_XDECREF(__pyx_t_2);
-  __Pyx_XDECREF(__pyx_t_3);
-  __Pyx_XDECREF(__pyx_t_4);
-  __Pyx_XDECREF(__pyx_t_5);
-  __Pyx_XDECREF(__pyx_t_6);
-  __Pyx_XDECREF(__pyx_t_7);
-  __Pyx_AddTraceback("nipy.algorithms.statistics.intvol.mu2_tet");
-  __pyx_r = NULL;
-  __pyx_L0:;
-  __Pyx_XGIVEREF(__pyx_r);
-  __Pyx_FinishRefcountContext();
-  return __pyx_r;
-}
-
-/* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":97
- * 
- * 
- * def mu1_tet(double D00, double D01, double D02, double D03,             # <<<<<<<<<<<<<<
- *             double D11, double D12, double D13,
- *             double D22, double D23,
- */
-
-static PyObject *__pyx_pf_4nipy_10algorithms_10statistics_6intvol_mu1_tet(PyObject *__pyx_self, PyObject *__pyx_args, PyObject *__pyx_kwds); /*proto*/
-static char __pyx_doc_4nipy_10algorithms_10statistics_6intvol_mu1_tet[] = "\n  Compute the 3rd intrinsic volume (sum of external angles * edge lengths) of \n  a tetrahedron with coordinates [coords[v0], coords[v1], coords[v2], coords[v3]].\n\n  Inputs:\n  -------\n\n  coords : ndarray((*,2))\n       An array of coordinates of vertices of tetrahedron.\n\n  v0, v1, v2, v3 : int\n       Indices for vertices of the tetrahedron.\n\n  Outputs:\n  --------\n\n  mu1 : float\n\n  ";
-static PyObject *__pyx_pf_4nipy_10algorithms_10statistics_6intvol_mu1_tet(PyObject *__pyx_self, PyObject *__pyx_args, PyObject *__pyx_kwds) {
-  double __pyx_v_D00;
-  double __pyx_v_D01;
-  double __pyx_v_D02;
-  double __pyx_v_D03;
-  double __pyx_v_D11;
-  double __pyx_v_D12;
-  double __pyx_v_D13;
-  double __pyx_v_D22;
-  double __pyx_v_D23;
-  double __pyx_v_D33;
-  PyObject *__pyx_v_mu;
-  PyObject *__pyx_r = NULL;
-  PyObject *__pyx_1 = 0;
-  PyObject *__pyx_t_1 = NULL;
-  static PyObject **__pyx_pyargnames[] = {&__pyx_kp_D00,&__pyx_kp_31,&__pyx_kp_32,&__pyx_kp_33,&__pyx_kp_34,&__pyx_kp_35,&__pyx_kp_36,&__pyx_kp_37,&__pyx_kp_38,&__pyx_kp_39,0};
-  __Pyx_SetupRefcountContext("mu1_tet");
-  __pyx_self = __pyx_self;
-  if (unlikely(__pyx_kwds)) {
-    Py_ssize_t kw_args = PyDict_Size(__pyx_kwds);
-    PyObject* values[10] = {0,0,0,0,0,0,0,0,0,0};
-    switch (PyTuple_GET_SIZE(__pyx_args)) {
-      case 10: values[9] = PyTuple_GET_ITEM(__pyx_args, 9);
-      case  9: values[8] = PyTuple_GET_ITEM(__pyx_args, 8);
-      case  8: values[7] = PyTuple_GET_ITEM(__pyx_args, 7);
-      case  7: values[6] = PyTuple_GET_ITEM(__pyx_args, 6);
-      case  6: values[5] = PyTuple_GET_ITEM(__pyx_args, 5);
-      case  5: values[4] = PyTuple_GET_ITEM(__pyx_args, 4);
-      case  4: values[3] = PyTuple_GET_ITEM(__pyx_args, 3);
-      case  3: values[2] = PyTuple_GET_ITEM(__pyx_args, 2);
-      case  2: values[1] = PyTuple_GET_ITEM(__pyx_args, 1);
-      case  1: values[0] = PyTuple_GET_ITEM(__pyx_args, 0);
-      case  0: break;
-      default: goto __pyx_L5_argtuple_error;
-    }
-    switch (PyTuple_GET_SIZE(__pyx_args)) {
-      case  0:
-      values[0] = PyDict_GetItem(__pyx_kwds, __pyx_kp_D00);
-      if (likely(values[0])) kw_args--;
-      else goto __pyx_L5_argtuple_error;
-      case  1:
-      values[1] = PyDict_GetItem(__pyx_kwds, __pyx_kp_31);
-      if (likely(values[1])) kw_args--;
-      else {
-        __Pyx_RaiseArgtupleInvalid("mu1_tet", 1, 10, 10, 1); {__pyx_filename = __pyx_f[0]; __pyx_lineno = 97; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-      }
-      case  2:
-      values[2] = PyDict_GetItem(__pyx_kwds, __pyx_kp_32);
-      if (likely(values[2])) kw_args--;
-      else {
-        __Pyx_RaiseArgtupleInvalid("mu1_tet", 1, 10, 10, 2); {__pyx_filename = __pyx_f[0]; __pyx_lineno = 97; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-      }
-      case  3:
-      values[3] = PyDict_GetItem(__pyx_kwds, __pyx_kp_33);
-      if (likely(values[3])) kw_args--;
-      else {
-        __Pyx_RaiseArgtupleInvalid("mu1_tet", 1, 10, 10, 3); {__pyx_filename = __pyx_f[0]; __pyx_lineno = 97; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-      }
-      case  4:
-      values[4] = PyDict_GetItem(__pyx_kwds, __pyx_kp_34);
-      if (likely(values[4])) kw_args--;
-      else {
-        __Pyx_RaiseArgtupleInvalid("mu1_tet", 1, 10, 10, 4); {__pyx_filename = __pyx_f[0]; __pyx_lineno = 97; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-      }
-      case  5:
-      values[5] = PyDict_GetItem(__pyx_kwds, __pyx_kp_35);
-      if (likely(values[5])) kw_args--;
-      else {
-        __Pyx_RaiseArgtupleInvalid("mu1_tet", 1, 10, 10, 5); {__pyx_filename = __pyx_f[0]; __pyx_lineno = 97; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-      }
-      case  6:
-      values[6] = PyDict_GetItem(__pyx_kwds, __pyx_kp_36);
-      if (likely(values[6])) kw_args--;
-      else {
-        __Pyx_RaiseArgtupleInvalid("mu1_tet", 1, 10, 10, 6); {__pyx_filename = __pyx_f[0]; __pyx_lineno = 97; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-      }
-      case  7:
-      values[7] = PyDict_GetItem(__pyx_kwds, __pyx_kp_37);
-      if (likely(values[7])) kw_args--;
-      else {
-        __Pyx_RaiseArgtupleInvalid("mu1_tet", 1, 10, 10, 7); {__pyx_filename = __pyx_f[0]; __pyx_lineno = 97; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-      }
-      case  8:
-      values[8] = PyDict_GetItem(__pyx_kwds, __pyx_kp_38);
-      if (likely(values[8])) kw_args--;
-      else {
-        __Pyx_RaiseArgtupleInvalid("mu1_tet", 1, 10, 10, 8); {__pyx_filename = __pyx_f[0]; __pyx_lineno = 97; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-      }
-      case  9:
-      values[9] = PyDict_GetItem(__pyx_kwds, __pyx_kp_39);
-      if (likely(values[9])) kw_args--;
-      else {
-        __Pyx_RaiseArgtupleInvalid("mu1_tet", 1, 10, 10, 9); {__pyx_filename = __pyx_f[0]; __pyx_lineno = 97; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-      }
-    }
-    if (unlikely(kw_args > 0)) {
-      if (unlikely(__Pyx_ParseOptionalKeywords(__pyx_kwds, __pyx_pyargnames, 0, values, PyTuple_GET_SIZE(__pyx_args), "mu1_tet") < 0)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 97; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-    }
-    __pyx_v_D00 = __pyx_PyFloat_AsDouble(values[0]); if (unlikely(PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 97; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-    __pyx_v_D01 = __pyx_PyFloat_AsDouble(values[1]); if (unlikely(PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 97; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-    __pyx_v_D02 = __pyx_PyFloat_AsDouble(values[2]); if (unlikely(PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 97; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-    __pyx_v_D03 = __pyx_PyFloat_AsDouble(values[3]); if (unlikely(PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 97; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-    __pyx_v_D11 = __pyx_PyFloat_AsDouble(values[4]); if (unlikely(PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 98; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-    __pyx_v_D12 = __pyx_PyFloat_AsDouble(values[5]); if (unlikely(PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 98; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-    __pyx_v_D13 = __pyx_PyFloat_AsDouble(values[6]); if (unlikely(PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 98; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-    __pyx_v_D22 = __pyx_PyFloat_AsDouble(values[7]); if (unlikely(PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 99; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-    __pyx_v_D23 = __pyx_PyFloat_AsDouble(values[8]); if (unlikely(PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 99; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-    __pyx_v_D33 = __pyx_PyFloat_AsDouble(values[9]); if (unlikely(PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 100; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-  } else if (PyTuple_GET_SIZE(__pyx_args) != 10) {
-    goto __pyx_L5_argtuple_error;
-  } else {
-    __pyx_v_D00 = __pyx_PyFloat_AsDouble(PyTuple_GET_ITEM(__pyx_args, 0)); if (unlikely(PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 97; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-    __pyx_v_D01 = __pyx_PyFloat_AsDouble(PyTuple_GET_ITEM(__pyx_args, 1)); if (unlikely(PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 97; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-    __pyx_v_D02 = __pyx_PyFloat_AsDouble(PyTuple_GET_ITEM(__pyx_args, 2)); if (unlikely(PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 97; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-    __pyx_v_D03 = __pyx_PyFloat_AsDouble(PyTuple_GET_ITEM(__pyx_args, 3)); if (unlikely(PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 97; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-    __pyx_v_D11 = __pyx_PyFloat_AsDouble(PyTuple_GET_ITEM(__pyx_args, 4)); if (unlikely(PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 98; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-    __pyx_v_D12 = __pyx_PyFloat_AsDouble(PyTuple_GET_ITEM(__pyx_args, 5)); if (unlikely(PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 98; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-    __pyx_v_D13 = __pyx_PyFloat_AsDouble(PyTuple_GET_ITEM(__pyx_args, 6)); if (unlikely(PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 98; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-    __pyx_v_D22 = __pyx_PyFloat_AsDouble(PyTuple_GET_ITEM(__pyx_args, 7)); if (unlikely(PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 99; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-    __pyx_v_D23 = __pyx_PyFloat_AsDouble(PyTuple_GET_ITEM(__pyx_args, 8)); if (unlikely(PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 99; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-    __pyx_v_D33 = __pyx_PyFloat_AsDouble(PyTuple_GET_ITEM(__pyx_args, 9)); if (unlikely(PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 100; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-  }
-  goto __pyx_L4_argument_unpacking_done;
-  __pyx_L5_argtuple_error:;
-  __Pyx_RaiseArgtupleInvalid("mu1_tet", 1, 10, 10, PyTuple_GET_SIZE(__pyx_args)); {__pyx_filename = __pyx_f[0]; __pyx_lineno = 97; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-  __pyx_L3_error:;
-  __Pyx_AddTraceback("nipy.algorithms.statistics.intvol.mu1_tet");
-  return NULL;
-  __pyx_L4_argument_unpacking_done:;
-  __pyx_v_mu = Py_None; __Pyx_INCREF(Py_None);
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":124
- *   cdef mu
- * 
- *   mu = 0             # <<<<<<<<<<<<<<
- *   mu += _mu1_tetface(D00, D01, D11, D02, D03, D12, D13, D22, D23, D33)
- *   mu += _mu1_tetface(D00, D02, D22, D01, D03, D12, D23, D11, D13, D33)
- */
-  __Pyx_INCREF(__pyx_int_0);
-  __Pyx_DECREF(__pyx_v_mu);
-  __pyx_v_mu = __pyx_int_0;
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":125
- * 
- *   mu = 0
- *   mu += _mu1_tetface(D00, D01, D11, D02, D03, D12, D13, D22, D23, D33)             # <<<<<<<<<<<<<<
- *   mu += _mu1_tetface(D00, D02, D22, D01, D03, D12, D23, D11, D13, D33)
- *   mu += _mu1_tetface(D00, D03, D33, D01, D02, D13, D23, D11, D12, D22)
- */
-  __pyx_t_1 = PyFloat_FromDouble(__pyx_f_4nipy_10algorithms_10statistics_6intvol__mu1_tetface(__pyx_v_D00, __pyx_v_D01, __pyx_v_D11, __pyx_v_D02, __pyx_v_D03, __pyx_v_D12, __pyx_v_D13, __pyx_v_D22, __pyx_v_D23, __pyx_v_D33)); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 125; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_1);
-  __pyx_1 = PyNumber_InPlaceAdd(__pyx_v_mu, __pyx_t_1); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 125; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_1);
-  __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-  __Pyx_DECREF(__pyx_v_mu);
-  __pyx_v_mu = __pyx_1;
-  __pyx_1 = 0;
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":126
- *   mu = 0
- *   mu += _mu1_tetface(D00, D01, D11, D02, D03, D12, D13, D22, D23, D33)
- *   mu += _mu1_tetface(D00, D02, D22, D01, D03, D12, D23, D11, D13, D33)             # <<<<<<<<<<<<<<
- *   mu += _mu1_tetface(D00, D03, D33, D01, D02, D13, D23, D11, D12, D22)
- *   mu += _mu1_tetface(D11, D12, D22, D01, D13, D02, D23, D00, D03, D33)
- */
-  __pyx_t_1 = PyFloat_FromDouble(__pyx_f_4nipy_10algorithms_10statistics_6intvol__mu1_tetface(__pyx_v_D00, __pyx_v_D02, __pyx_v_D22, __pyx_v_D01, __pyx_v_D03, __pyx_v_D12, __pyx_v_D23, __pyx_v_D11, __pyx_v_D13, __pyx_v_D33)); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 126; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_1);
-  __pyx_1 = PyNumber_InPlaceAdd(__pyx_v_mu, __pyx_t_1); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 126; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_1);
-  __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-  __Pyx_DECREF(__pyx_v_mu);
-  __pyx_v_mu = __pyx_1;
-  __pyx_1 = 0;
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":127
- *   mu += _mu1_tetface(D00, D01, D11, D02, D03, D12, D13, D22, D23, D33)
- *   mu += _mu1_tetface(D00, D02, D22, D01, D03, D12, D23, D11, D13, D33)
- *   mu += _mu1_tetface(D00, D03, D33, D01, D02, D13, D23, D11, D12, D22)             # <<<<<<<<<<<<<<
- *   mu += _mu1_tetface(D11, D12, D22, D01, D13, D02, D23, D00, D03, D33)
- *   mu += _mu1_tetface(D11, D13, D33, D01, D12, D03, D23, D00, D02, D22)
- */
-  __pyx_t_1 = PyFloat_FromDouble(__pyx_f_4nipy_10algorithms_10statistics_6intvol__mu1_tetface(__pyx_v_D00, __pyx_v_D03, __pyx_v_D33, __pyx_v_D01, __pyx_v_D02, __pyx_v_D13, __pyx_v_D23, __pyx_v_D11, __pyx_v_D12, __pyx_v_D22)); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 127; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_1);
-  __pyx_1 = PyNumber_InPlaceAdd(__pyx_v_mu, __pyx_t_1); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 127; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_1);
-  __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-  __Pyx_DECREF(__pyx_v_mu);
-  __pyx_v_mu = __pyx_1;
-  __pyx_1 = 0;
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":128
- *   mu += _mu1_tetface(D00, D02, D22, D01, D03, D12, D23, D11, D13, D33)
- *   mu += _mu1_tetface(D00, D03, D33, D01, D02, D13, D23, D11, D12, D22)
- *   mu += _mu1_tetface(D11, D12, D22, D01, D13, D02, D23, D00, D03, D33)             # <<<<<<<<<<<<<<
- *   mu += _mu1_tetface(D11, D13, D33, D01, D12, D03, D23, D00, D02, D22)
- *   mu += _mu1_tetface(D22, D23, D33, D02, D12, D03, D13, D00, D01, D11)
- */
-  __pyx_t_1 = PyFloat_FromDouble(__pyx_f_4nipy_10algorithms_10statistics_6intvol__mu1_tetface(__pyx_v_D11, __pyx_v_D12, __pyx_v_D22, __pyx_v_D01, __pyx_v_D13, __pyx_v_D02, __pyx_v_D23, __pyx_v_D00, __pyx_v_D03, __pyx_v_D33)); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 128; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_1);
-  __pyx_1 = PyNumber_InPlaceAdd(__pyx_v_mu, __pyx_t_1); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 128; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_1);
-  __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-  __Pyx_DECREF(__pyx_v_mu);
-  __pyx_v_mu = __pyx_1;
-  __pyx_1 = 0;
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":129
- *   mu += _mu1_tetface(D00, D03, D33, D01, D02, D13, D23, D11, D12, D22)
- *   mu += _mu1_tetface(D11, D12, D22, D01, D13, D02, D23, D00, D03, D33)
- *   mu += _mu1_tetface(D11, D13, D33, D01, D12, D03, D23, D00, D02, D22)             # <<<<<<<<<<<<<<
- *   mu += _mu1_tetface(D22, D23, D33, D02, D12, D03, D13, D00, D01, D11)
- * 
- */
-  __pyx_t_1 = PyFloat_FromDouble(__pyx_f_4nipy_10algorithms_10statistics_6intvol__mu1_tetface(__pyx_v_D11, __pyx_v_D13, __pyx_v_D33, __pyx_v_D01, __pyx_v_D12, __pyx_v_D03, __pyx_v_D23, __pyx_v_D00, __pyx_v_D02, __pyx_v_D22)); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 129; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_1);
-  __pyx_1 = PyNumber_InPlaceAdd(__pyx_v_mu, __pyx_t_1); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 129; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_1);
-  __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-  __Pyx_DECREF(__pyx_v_mu);
-  __pyx_v_mu = __pyx_1;
-  __pyx_1 = 0;
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":130
- *   mu += _mu1_tetface(D11, D12, D22, D01, D13, D02, D23, D00, D03, D33)
- *   mu += _mu1_tetface(D11, D13, D33, D01, D12, D03, D23, D00, D02, D22)
- *   mu += _mu1_tetface(D22, D23, D33, D02, D12, D03, D13, D00, D01, D11)             # <<<<<<<<<<<<<<
- * 
- *   return mu
- */
-  __pyx_t_1 = PyFloat_FromDouble(__pyx_f_4nipy_10algorithms_10statistics_6intvol__mu1_tetface(__pyx_v_D22, __pyx_v_D23, __pyx_v_D33, __pyx_v_D02, __pyx_v_D12, __pyx_v_D03, __pyx_v_D13, __pyx_v_D00, __pyx_v_D01, __pyx_v_D11)); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 130; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_1);
-  __pyx_1 = PyNumber_InPlaceAdd(__pyx_v_mu, __pyx_t_1); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 130; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_1);
-  __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-  __Pyx_DECREF(__pyx_v_mu);
-  __pyx_v_mu = __pyx_1;
-  __pyx_1 = 0;
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":132
- *   mu += _mu1_tetface(D22, D23, D33, D02, D12, D03, D13, D00, D01, D11)
- * 
- *   return mu             # <<<<<<<<<<<<<<
- * 
- * cdef double _mu1_tetface(double Ds0s0,
- */
-  __Pyx_XDECREF(__pyx_r);
-  __Pyx_INCREF(__pyx_v_mu);
-  __pyx_r = __pyx_v_mu;
-  goto __pyx_L0;
-
-  __pyx_r = Py_None; __Pyx_INCREF(Py_None);
-  goto __pyx_L0;
-  __pyx_L1_error:;
-  __Pyx_XDECREF(__pyx_1);
-  __Pyx_XDECREF(__pyx_t_1);
-  __Pyx_AddTraceback("nipy.algorithms.statistics.intvol.mu1_tet");
-  __pyx_r = NULL;
-  __pyx_L0:;
-  __Pyx_DECREF(__pyx_v_mu);
-  __Pyx_XGIVEREF(__pyx_r);
-  __Pyx_FinishRefcountContext();
-  return __pyx_r;
-}
-
-/* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":134
- *   return mu
- * 
- * cdef double _mu1_tetface(double Ds0s0,             # <<<<<<<<<<<<<<
- *                          double Ds0s1,
- *                          double Ds1s1,
- */
-
-static  double __pyx_f_4nipy_10algorithms_10statistics_6intvol__mu1_tetface(double __pyx_v_Ds0s0, double __pyx_v_Ds0s1, double __pyx_v_Ds1s1, double __pyx_v_Ds0t0, double __pyx_v_Ds0t1, double __pyx_v_Ds1t0, double __pyx_v_Ds1t1, double __pyx_v_Dt0t0, double __pyx_v_Dt0t1, double __pyx_v_Dt1t1) {
-  double __pyx_v_A00;
-  double __pyx_v_A01;
-  double __pyx_v_A02;
-  double __pyx_v_A11;
-  double __pyx_v_A12;
-  double __pyx_v_A22;
-  double __pyx_v_length;
-  double __pyx_v_norm_proj0;
-  double __pyx_v_norm_proj1;
-  double __pyx_v_inner_prod_proj;
-  PyObject *__pyx_v_a;
-  double __pyx_r;
-  PyObject *__pyx_1 = 0;
-  PyObject *__pyx_t_1 = NULL;
-  PyObject *__pyx_t_2 = NULL;
-  PyObject *__pyx_t_3 = NULL;
-  double __pyx_t_4;
-  PyObject *__pyx_t_5 = NULL;
-  PyObject *__pyx_t_6 = NULL;
-  PyObject *__pyx_t_7 = NULL;
-  int __pyx_t_8;
-  __Pyx_SetupRefcountContext("_mu1_tetface");
-  __pyx_v_a = Py_None; __Pyx_INCREF(Py_None);
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":148
- *     cdef double length, norm_proj0, norm_proj1, inner_prod_proj
- * 
- *     A00 = Ds1s1 - 2 * Ds0s1 + Ds0s0             # <<<<<<<<<<<<<<
- *     A11 = Dt0t0 - 2 * Ds0t0 + Ds0s0
- *     A22 = Dt1t1 - 2 * Ds0t1 + Ds0s0
- */
-  __pyx_v_A00 = ((__pyx_v_Ds1s1 - (2 * __pyx_v_Ds0s1)) + __pyx_v_Ds0s0);
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":149
- * 
- *     A00 = Ds1s1 - 2 * Ds0s1 + Ds0s0
- *     A11 = Dt0t0 - 2 * Ds0t0 + Ds0s0             # <<<<<<<<<<<<<<
- *     A22 = Dt1t1 - 2 * Ds0t1 + Ds0s0
- * 
- */
-  __pyx_v_A11 = ((__pyx_v_Dt0t0 - (2 * __pyx_v_Ds0t0)) + __pyx_v_Ds0s0);
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":150
- *     A00 = Ds1s1 - 2 * Ds0s1 + Ds0s0
- *     A11 = Dt0t0 - 2 * Ds0t0 + Ds0s0
- *     A22 = Dt1t1 - 2 * Ds0t1 + Ds0s0             # <<<<<<<<<<<<<<
- * 
- *     A01 = Ds1t0 - Ds0t0 - Ds0s1 + Ds0s0
- */
-  __pyx_v_A22 = ((__pyx_v_Dt1t1 - (2 * __pyx_v_Ds0t1)) + __pyx_v_Ds0s0);
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":152
- *     A22 = Dt1t1 - 2 * Ds0t1 + Ds0s0
- * 
- *     A01 = Ds1t0 - Ds0t0 - Ds0s1 + Ds0s0             # <<<<<<<<<<<<<<
- *     A02 = Ds1t1 - Ds0t1 - Ds0s1 + Ds0s0
- *     A12 = Dt0t1 - Ds0t0 - Ds0t1 + Ds0s0
- */
-  __pyx_v_A01 = (((__pyx_v_Ds1t0 - __pyx_v_Ds0t0) - __pyx_v_Ds0s1) + __pyx_v_Ds0s0);
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":153
- * 
- *     A01 = Ds1t0 - Ds0t0 - Ds0s1 + Ds0s0
- *     A02 = Ds1t1 - Ds0t1 - Ds0s1 + Ds0s0             # <<<<<<<<<<<<<<
- *     A12 = Dt0t1 - Ds0t0 - Ds0t1 + Ds0s0
- * 
- */
-  __pyx_v_A02 = (((__pyx_v_Ds1t1 - __pyx_v_Ds0t1) - __pyx_v_Ds0s1) + __pyx_v_Ds0s0);
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":154
- *     A01 = Ds1t0 - Ds0t0 - Ds0s1 + Ds0s0
- *     A02 = Ds1t1 - Ds0t1 - Ds0s1 + Ds0s0
- *     A12 = Dt0t1 - Ds0t0 - Ds0t1 + Ds0s0             # <<<<<<<<<<<<<<
- * 
- *     length = np.sqrt(A00)
- */
-  __pyx_v_A12 = (((__pyx_v_Dt0t1 - __pyx_v_Ds0t0) - __pyx_v_Ds0t1) + __pyx_v_Ds0s0);
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":156
- *     A12 = Dt0t1 - Ds0t0 - Ds0t1 + Ds0s0
- * 
- *     length = np.sqrt(A00)             # <<<<<<<<<<<<<<
- * 
- *     norm_proj0 = A11 - A01 * A01 / A00
- */
-  __pyx_1 = __Pyx_GetName(__pyx_m, __pyx_kp_np); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 156; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_1);
-  __pyx_t_1 = PyObject_GetAttr(__pyx_1, __pyx_kp_sqrt); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 156; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_1);
-  __Pyx_DECREF(__pyx_1); __pyx_1 = 0;
-  __pyx_t_2 = PyFloat_FromDouble(__pyx_v_A00); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 156; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_2);
-  __pyx_t_3 = PyTuple_New(1); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 156; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_3));
-  PyTuple_SET_ITEM(__pyx_t_3, 0, __pyx_t_2);
-  __Pyx_GIVEREF(__pyx_t_2);
-  __pyx_t_2 = 0;
-  __pyx_t_2 = PyObject_Call(__pyx_t_1, ((PyObject *)__pyx_t_3), NULL); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 156; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_2);
-  __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-  __Pyx_DECREF(((PyObject *)__pyx_t_3)); __pyx_t_3 = 0;
-  __pyx_t_4 = __pyx_PyFloat_AsDouble(__pyx_t_2); if (unlikely(PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 156; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_DECREF(__pyx_t_2); __pyx_t_2 = 0;
-  __pyx_v_length = __pyx_t_4;
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":158
- *     length = np.sqrt(A00)
- * 
- *     norm_proj0 = A11 - A01 * A01 / A00             # <<<<<<<<<<<<<<
- *     norm_proj1 = A22 - A02 * A02 / A00
- *     inner_prod_proj = A12 - A01 * A02 / A00
- */
-  __pyx_v_norm_proj0 = (__pyx_v_A11 - ((__pyx_v_A01 * __pyx_v_A01) / __pyx_v_A00));
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":159
- * 
- *     norm_proj0 = A11 - A01 * A01 / A00
- *     norm_proj1 = A22 - A02 * A02 / A00             # <<<<<<<<<<<<<<
- *     inner_prod_proj = A12 - A01 * A02 / A00
- * 
- */
-  __pyx_v_norm_proj1 = (__pyx_v_A22 - ((__pyx_v_A02 * __pyx_v_A02) / __pyx_v_A00));
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":160
- *     norm_proj0 = A11 - A01 * A01 / A00
- *     norm_proj1 = A22 - A02 * A02 / A00
- *     inner_prod_proj = A12 - A01 * A02 / A00             # <<<<<<<<<<<<<<
- * 
- *     a = (np.pi - np.arccos(inner_prod_proj / np.sqrt(norm_proj0 * norm_proj1))) * length / (2 * np.pi)
- */
-  __pyx_v_inner_prod_proj = (__pyx_v_A12 - ((__pyx_v_A01 * __pyx_v_A02) / __pyx_v_A00));
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":162
- *     inner_prod_proj = A12 - A01 * A02 / A00
- * 
- *     a = (np.pi - np.arccos(inner_prod_proj / np.sqrt(norm_proj0 * norm_proj1))) * length / (2 * np.pi)             # <<<<<<<<<<<<<<
- *     if np.isnan(a):
- *         return 0
- */
-  __pyx_1 = __Pyx_GetName(__pyx_m, __pyx_kp_np); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 162; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_1);
-  __pyx_t_2 = PyObject_GetAttr(__pyx_1, __pyx_kp_pi); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 162; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_2);
-  __Pyx_DECREF(__pyx_1); __pyx_1 = 0;
-  __pyx_1 = __Pyx_GetName(__pyx_m, __pyx_kp_np); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 162; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_1);
-  __pyx_t_3 = PyObject_GetAttr(__pyx_1, __pyx_kp_arccos); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 162; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_3);
-  __Pyx_DECREF(__pyx_1); __pyx_1 = 0;
-  __pyx_t_1 = PyFloat_FromDouble(__pyx_v_inner_prod_proj); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 162; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_1);
-  __pyx_1 = __Pyx_GetName(__pyx_m, __pyx_kp_np); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 162; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_1);
-  __pyx_t_5 = PyObject_GetAttr(__pyx_1, __pyx_kp_sqrt); if (unlikely(!__pyx_t_5)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 162; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_5);
-  __Pyx_DECREF(__pyx_1); __pyx_1 = 0;
-  __pyx_t_6 = PyFloat_FromDouble((__pyx_v_norm_proj0 * __pyx_v_norm_proj1)); if (unlikely(!__pyx_t_6)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 162; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_6);
-  __pyx_t_7 = PyTuple_New(1); if (unlikely(!__pyx_t_7)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 162; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_7));
-  PyTuple_SET_ITEM(__pyx_t_7, 0, __pyx_t_6);
-  __Pyx_GIVEREF(__pyx_t_6);
-  __pyx_t_6 = 0;
-  __pyx_t_6 = PyObject_Call(__pyx_t_5, ((PyObject *)__pyx_t_7), NULL); if (unlikely(!__pyx_t_6)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 162; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_6);
-  __Pyx_DECREF(__pyx_t_5); __pyx_t_5 = 0;
-  __Pyx_DECREF(((PyObject *)__pyx_t_7)); __pyx_t_7 = 0;
-  __pyx_t_7 = __Pyx_PyNumber_Divide(__pyx_t_1, __pyx_t_6); if (unlikely(!__pyx_t_7)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 162; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_7);
-  __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-  __Pyx_DECREF(__pyx_t_6); __pyx_t_6 = 0;
-  __pyx_t_6 = PyTuple_New(1); if (unlikely(!__pyx_t_6)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 162; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_6));
-  PyTuple_SET_ITEM(__pyx_t_6, 0, __pyx_t_7);
-  __Pyx_GIVEREF(__pyx_t_7);
-  __pyx_t_7 = 0;
-  __pyx_t_7 = PyObject_Call(__pyx_t_3, ((PyObject *)__pyx_t_6), NULL); if (unlikely(!__pyx_t_7)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 162; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_7);
-  __Pyx_DECREF(__pyx_t_3); __pyx_t_3 = 0;
-  __Pyx_DECREF(((PyObject *)__pyx_t_6)); __pyx_t_6 = 0;
-  __pyx_t_6 = PyNumber_Subtract(__pyx_t_2, __pyx_t_7); if (unlikely(!__pyx_t_6)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 162; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_6);
-  __Pyx_DECREF(__pyx_t_2); __pyx_t_2 = 0;
-  __Pyx_DECREF(__pyx_t_7); __pyx_t_7 = 0;
-  __pyx_t_7 = PyFloat_FromDouble(__pyx_v_length); if (unlikely(!__pyx_t_7)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 162; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_7);
-  __pyx_t_2 = PyNumber_Multiply(__pyx_t_6, __pyx_t_7); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 162; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_2);
-  __Pyx_DECREF(__pyx_t_6); __pyx_t_6 = 0;
-  __Pyx_DECREF(__pyx_t_7); __pyx_t_7 = 0;
-  __pyx_1 = __Pyx_GetName(__pyx_m, __pyx_kp_np); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 162; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_1);
-  __pyx_t_7 = PyObject_GetAttr(__pyx_1, __pyx_kp_pi); if (unlikely(!__pyx_t_7)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 162; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_7);
-  __Pyx_DECREF(__pyx_1); __pyx_1 = 0;
-  __pyx_t_6 = PyNumber_Multiply(__pyx_int_2, __pyx_t_7); if (unlikely(!__pyx_t_6)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 162; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_6);
-  __Pyx_DECREF(__pyx_t_7); __pyx_t_7 = 0;
-  __pyx_t_7 = __Pyx_PyNumber_Divide(__pyx_t_2, __pyx_t_6); if (unlikely(!__pyx_t_7)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 162; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_7);
-  __Pyx_DECREF(__pyx_t_2); __pyx_t_2 = 0;
-  __Pyx_DECREF(__pyx_t_6); __pyx_t_6 = 0;
-  __Pyx_DECREF(__pyx_v_a);
-  __pyx_v_a = __pyx_t_7;
-  __pyx_t_7 = 0;
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":163
- * 
- *     a = (np.pi - np.arccos(inner_prod_proj / np.sqrt(norm_proj0 * norm_proj1))) * length / (2 * np.pi)
- *     if np.isnan(a):             # <<<<<<<<<<<<<<
- *         return 0
- *     return a
- */
-  __pyx_1 = __Pyx_GetName(__pyx_m, __pyx_kp_np); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 163; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_1);
-  __pyx_t_7 = PyObject_GetAttr(__pyx_1, __pyx_kp_isnan); if (unlikely(!__pyx_t_7)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 163; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_7);
-  __Pyx_DECREF(__pyx_1); __pyx_1 = 0;
-  __pyx_t_6 = PyTuple_New(1); if (unlikely(!__pyx_t_6)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 163; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_6));
-  __Pyx_INCREF(__pyx_v_a);
-  PyTuple_SET_ITEM(__pyx_t_6, 0, __pyx_v_a);
-  __Pyx_GIVEREF(__pyx_v_a);
-  __pyx_t_2 = PyObject_Call(__pyx_t_7, ((PyObject *)__pyx_t_6), NULL); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 163; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_2);
-  __Pyx_DECREF(__pyx_t_7); __pyx_t_7 = 0;
-  __Pyx_DECREF(((PyObject *)__pyx_t_6)); __pyx_t_6 = 0;
-  __pyx_t_8 = __Pyx_PyObject_IsTrue(__pyx_t_2); if (unlikely(__pyx_t_8 < 0)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 163; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_DECREF(__pyx_t_2); __pyx_t_2 = 0;
-  if (__pyx_t_8) {
-
-    /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":164
- *     a = (np.pi - np.arccos(inner_prod_proj / np.sqrt(norm_proj0 * norm_proj1))) * length / (2 * np.pi)
- *     if np.isnan(a):
- *         return 0             # <<<<<<<<<<<<<<
- *     return a
- * 
- */
-    __pyx_r = 0;
-    goto __pyx_L0;
-    goto __pyx_L3;
-  }
-  __pyx_L3:;
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":165
- *     if np.isnan(a):
- *         return 0
- *     return a             # <<<<<<<<<<<<<<
- * 
- * def mu2_tri(double D00, double D01, double D02,
- */
-  __pyx_t_4 = __pyx_PyFloat_AsDouble(__pyx_v_a); if (unlikely(PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 165; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __pyx_r = __pyx_t_4;
-  goto __pyx_L0;
-
-  __pyx_r = 0;
-  goto __pyx_L0;
-  __pyx_L1_error:;
-  __Pyx_XDECREF(__pyx_1);
-  __Pyx_XDECREF(__pyx_t_1);
-  __Pyx_XDECREF(__pyx_t_2);
-  __Pyx_XDECREF(__pyx_t_3);
-  __Pyx_XDECREF(__pyx_t_5);
-  __Pyx_XDECREF(__pyx_t_6);
-  __Pyx_XDECREF(__pyx_t_7);
-  __Pyx_WriteUnraisable("nipy.algorithms.statistics.intvol._mu1_tetface");
-  __pyx_r = 0;
-  __pyx_L0:;
-  __Pyx_DECREF(__pyx_v_a);
-  __Pyx_FinishRefcountContext();
-  return __pyx_r;
-}
-
-/* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":167
- *     return a
- * 
- * def mu2_tri(double D00, double D01, double D02,             # <<<<<<<<<<<<<<
- *             double D11, double D12,
- *             double D22):
- */
-
-static PyObject *__pyx_pf_4nipy_10algorithms_10statistics_6intvol_mu2_tri(PyObject *__pyx_self, PyObject *__pyx_args, PyObject *__pyx_kwds); /*proto*/
-static char __pyx_doc_4nipy_10algorithms_10statistics_6intvol_mu2_tri[] = "\n  Compute the 2nd intrinsic volume (just area in this case) of\n  a triangle with coordinates [coords[v0], coords[v1], coords[v2]].\n\n  Inputs:\n  -------\n\n  coords : ndarray((*,2))\n       An array of coordinates of vertices of tetrahedron.\n\n  v0, v1, v2 : int\n       Indices for vertices of the tetrahedron.\n\n  Outputs:\n  --------\n\n  mu2 : float\n  ";
-static PyObject *__pyx_pf_4nipy_10algorithms_10statistics_6intvol_mu2_tri(PyObject *__pyx_self, PyObject *__pyx_args, PyObject *__pyx_kwds) {
-  double __pyx_v_D00;
-  double __pyx_v_D01;
-  double __pyx_v_D02;
-  double __pyx_v_D11;
-  double __pyx_v_D12;
-  double __pyx_v_D22;
-  double __pyx_v_C00;
-  double __pyx_v_C01;
-  double __pyx_v_C11;
-  PyObject *__pyx_r = NULL;
-  PyObject *__pyx_1 = 0;
-  PyObject *__pyx_t_1 = NULL;
-  PyObject *__pyx_t_2 = NULL;
-  PyObject *__pyx_t_3 = NULL;
-  static PyObject **__pyx_pyargnames[] = {&__pyx_kp_D00,&__pyx_kp_31,&__pyx_kp_32,&__pyx_kp_34,&__pyx_kp_35,&__pyx_kp_37,0};
-  __Pyx_SetupRefcountContext("mu2_tri");
-  __pyx_self = __pyx_self;
-  if (unlikely(__pyx_kwds)) {
-    Py_ssize_t kw_args = PyDict_Size(__pyx_kwds);
-    PyObject* values[6] = {0,0,0,0,0,0};
-    switch (PyTuple_GET_SIZE(__pyx_args)) {
-      case  6: values[5] = PyTuple_GET_ITEM(__pyx_args, 5);
-      case  5: values[4] = PyTuple_GET_ITEM(__pyx_args, 4);
-      case  4: values[3] = PyTuple_GET_ITEM(__pyx_args, 3);
-      case  3: values[2] = PyTuple_GET_ITEM(__pyx_args, 2);
-      case  2: values[1] = PyTuple_GET_ITEM(__pyx_args, 1);
-      case  1: values[0] = PyTuple_GET_ITEM(__pyx_args, 0);
-      case  0: break;
-      default: goto __pyx_L5_argtuple_error;
-    }
-    switch (PyTuple_GET_SIZE(__pyx_args)) {
-      case  0:
-      values[0] = PyDict_GetItem(__pyx_kwds, __pyx_kp_D00);
-      if (likely(values[0])) kw_args--;
-      else goto __pyx_L5_argtuple_error;
-      case  1:
-      values[1] = PyDict_GetItem(__pyx_kwds, __pyx_kp_31);
-      if (likely(values[1])) kw_args--;
-      else {
-        __Pyx_RaiseArgtupleInvalid("mu2_tri", 1, 6, 6, 1); {__pyx_filename = __pyx_f[0]; __pyx_lineno = 167; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-      }
-      case  2:
-      values[2] = PyDict_GetItem(__pyx_kwds, __pyx_kp_32);
-      if (likely(values[2])) kw_args--;
-      else {
-        __Pyx_RaiseArgtupleInvalid("mu2_tri", 1, 6, 6, 2); {__pyx_filename = __pyx_f[0]; __pyx_lineno = 167; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-      }
-      case  3:
-      values[3] = PyDict_GetItem(__pyx_kwds, __pyx_kp_34);
-      if (likely(values[3])) kw_args--;
-      else {
-        __Pyx_RaiseArgtupleInvalid("mu2_tri", 1, 6, 6, 3); {__pyx_filename = __pyx_f[0]; __pyx_lineno = 167; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-      }
-      case  4:
-      values[4] = PyDict_GetItem(__pyx_kwds, __pyx_kp_35);
-      if (likely(values[4])) kw_args--;
-      else {
-        __Pyx_RaiseArgtupleInvalid("mu2_tri", 1, 6, 6, 4); {__pyx_filename = __pyx_f[0]; __pyx_lineno = 167; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-      }
-      case  5:
-      values[5] = PyDict_GetItem(__pyx_kwds, __pyx_kp_37);
-      if (likely(values[5])) kw_args--;
-      else {
-        __Pyx_RaiseArgtupleInvalid("mu2_tri", 1, 6, 6, 5); {__pyx_filename = __pyx_f[0]; __pyx_lineno = 167; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-      }
-    }
-    if (unlikely(kw_args > 0)) {
-      if (unlikely(__Pyx_ParseOptionalKeywords(__pyx_kwds, __pyx_pyargnames, 0, values, PyTuple_GET_SIZE(__pyx_args), "mu2_tri") < 0)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 167; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-    }
-    __pyx_v_D00 = __pyx_PyFloat_AsDouble(values[0]); if (unlikely(PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 167; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-    __pyx_v_D01 = __pyx_PyFloat_AsDouble(values[1]); if (unlikely(PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 167; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-    __pyx_v_D02 = __pyx_PyFloat_AsDouble(values[2]); if (unlikely(PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 167; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-    __pyx_v_D11 = __pyx_PyFloat_AsDouble(values[3]); if (unlikely(PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 168; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-    __pyx_v_D12 = __pyx_PyFloat_AsDouble(values[4]); if (unlikely(PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 168; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-    __pyx_v_D22 = __pyx_PyFloat_AsDouble(values[5]); if (unlikely(PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 169; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-  } else if (PyTuple_GET_SIZE(__pyx_args) != 6) {
-    goto __pyx_L5_argtuple_error;
-  } else {
-    __pyx_v_D00 = __pyx_PyFloat_AsDouble(PyTuple_GET_ITEM(__pyx_args, 0)); if (unlikely(PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 167; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-    __pyx_v_D01 = __pyx_PyFloat_AsDouble(PyTuple_GET_ITEM(__pyx_args, 1)); if (unlikely(PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 167; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-    __pyx_v_D02 = __pyx_PyFloat_AsDouble(PyTuple_GET_ITEM(__pyx_args, 2)); if (unlikely(PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 167; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-    __pyx_v_D11 = __pyx_PyFloat_AsDouble(PyTuple_GET_ITEM(__pyx_args, 3)); if (unlikely(PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 168; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-    __pyx_v_D12 = __pyx_PyFloat_AsDouble(PyTuple_GET_ITEM(__pyx_args, 4)); if (unlikely(PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 168; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-    __pyx_v_D22 = __pyx_PyFloat_AsDouble(PyTuple_GET_ITEM(__pyx_args, 5)); if (unlikely(PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 169; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-  }
-  goto __pyx_L4_argument_unpacking_done;
-  __pyx_L5_argtuple_error:;
-  __Pyx_RaiseArgtupleInvalid("mu2_tri", 1, 6, 6, PyTuple_GET_SIZE(__pyx_args)); {__pyx_filename = __pyx_f[0]; __pyx_lineno = 167; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-  __pyx_L3_error:;
-  __Pyx_AddTraceback("nipy.algorithms.statistics.intvol.mu2_tri");
-  return NULL;
-  __pyx_L4_argument_unpacking_done:;
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":192
- *   cdef double C00, C01, C11
- * 
- *   C00 = D11 - 2*D01 + D00             # <<<<<<<<<<<<<<
- *   C01 = D12 - D01 - D02 + D00
- *   C11 = D22 - 2*D02 + D00
- */
-  __pyx_v_C00 = ((__pyx_v_D11 - (2 * __pyx_v_D01)) + __pyx_v_D00);
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":193
- * 
- *   C00 = D11 - 2*D01 + D00
- *   C01 = D12 - D01 - D02 + D00             # <<<<<<<<<<<<<<
- *   C11 = D22 - 2*D02 + D00
- * 
- */
-  __pyx_v_C01 = (((__pyx_v_D12 - __pyx_v_D01) - __pyx_v_D02) + __pyx_v_D00);
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":194
- *   C00 = D11 - 2*D01 + D00
- *   C01 = D12 - D01 - D02 + D00
- *   C11 = D22 - 2*D02 + D00             # <<<<<<<<<<<<<<
- * 
- *   return np.sqrt((C00 * C11 - C01 * C01)) * 0.5
- */
-  __pyx_v_C11 = ((__pyx_v_D22 - (2 * __pyx_v_D02)) + __pyx_v_D00);
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":196
- *   C11 = D22 - 2*D02 + D00
- * 
- *   return np.sqrt((C00 * C11 - C01 * C01)) * 0.5             # <<<<<<<<<<<<<<
- * 
- * def mu1_tri(double D00, double D01, double D02,
- */
-  __Pyx_XDECREF(__pyx_r);
-  __pyx_1 = __Pyx_GetName(__pyx_m, __pyx_kp_np); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 196; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_1);
-  __pyx_t_1 = PyObject_GetAttr(__pyx_1, __pyx_kp_sqrt); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 196; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_1);
-  __Pyx_DECREF(__pyx_1); __pyx_1 = 0;
-  __pyx_t_2 = PyFloat_FromDouble(((__pyx_v_C00 * __pyx_v_C11) - (__pyx_v_C01 * __pyx_v_C01))); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 196; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_2);
-  __pyx_t_3 = PyTuple_New(1); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 196; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_3));
-  PyTuple_SET_ITEM(__pyx_t_3, 0, __pyx_t_2);
-  __Pyx_GIVEREF(__pyx_t_2);
-  __pyx_t_2 = 0;
-  __pyx_t_2 = PyObject_Call(__pyx_t_1, ((PyObject *)__pyx_t_3), NULL); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 196; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_2);
-  __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-  __Pyx_DECREF(((PyObject *)__pyx_t_3)); __pyx_t_3 = 0;
-  __pyx_t_3 = PyFloat_FromDouble(0.5); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 196; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_3);
-  __pyx_t_1 = PyNumber_Multiply(__pyx_t_2, __pyx_t_3); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 196; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_1);
-  __Pyx_DECREF(__pyx_t_2); __pyx_t_2 = 0;
-  __Pyx_DECREF(__pyx_t_3); __pyx_t_3 = 0;
-  __pyx_r = __pyx_t_1;
-  __pyx_t_1 = 0;
-  goto __pyx_L0;
-
-  __pyx_r = Py_None; __Pyx_INCREF(Py_None);
-  goto __pyx_L0;
-  __pyx_L1_error:;
-  __Pyx_XDECREF(__pyx_1);
-  __Pyx_XDECREF(__pyx_t_1);
-  __Pyx_XDECREF(__pyx_t_2);
-  __Pyx_XDECREF(__pyx_t_3);
-  __Pyx_AddTraceback("nipy.algorithms.statistics.intvol.mu2_tri");
-  __pyx_r = NULL;
-  __pyx_L0:;
-  __Pyx_XGIVEREF(__pyx_r);
-  __Pyx_FinishRefcountContext();
-  return __pyx_r;
-}
-
-/* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":198
- *   return np.sqrt((C00 * C11 - C01 * C01)) * 0.5
- * 
- * def mu1_tri(double D00, double D01, double D02,             # <<<<<<<<<<<<<<
- *             double D11, double D12,
- *             double D22):
- */
-
-static PyObject *__pyx_pf_4nipy_10algorithms_10statistics_6intvol_mu1_tri(PyObject *__pyx_self, PyObject *__pyx_args, PyObject *__pyx_kwds); /*proto*/
-static char __pyx_doc_4nipy_10algorithms_10statistics_6intvol_mu1_tri[] = "\n  Compute the 1st intrinsic volume (1/2 the perimeter of\n  a triangle with coordinates [coords[v0], coords[v1], coords[v2]].\n\n  Inputs:\n  -------\n\n  coords : ndarray((*,2))\n       An array of coordinates of vertices of tetrahedron.\n\n  v0, v1, v2 : int\n       Indices for vertices of the tetrahedron.\n\n  Outputs:\n  --------\n\n  mu1 : float\n  ";
-static PyObject *__pyx_pf_4nipy_10algorithms_10statistics_6intvol_mu1_tri(PyObject *__pyx_self, PyObject *__pyx_args, PyObject *__pyx_kwds) {
-  double __pyx_v_D00;
-  double __pyx_v_D01;
-  double __pyx_v_D02;
-  double __pyx_v_D11;
-  double __pyx_v_D12;
-  double __pyx_v_D22;
-  double __pyx_v_mu;
-  PyObject *__pyx_r = NULL;
-  PyObject *__pyx_1 = 0;
-  PyObject *__pyx_t_1 = NULL;
-  PyObject *__pyx_t_2 = NULL;
-  PyObject *__pyx_t_3 = NULL;
-  PyObject *__pyx_t_4 = NULL;
-  double __pyx_t_5;
-  static PyObject **__pyx_pyargnames[] = {&__pyx_kp_D00,&__pyx_kp_31,&__pyx_kp_32,&__pyx_kp_34,&__pyx_kp_35,&__pyx_kp_37,0};
-  __Pyx_SetupRefcountContext("mu1_tri");
-  __pyx_self = __pyx_self;
-  if (unlikely(__pyx_kwds)) {
-    Py_ssize_t kw_args = PyDict_Size(__pyx_kwds);
-    PyObject* values[6] = {0,0,0,0,0,0};
-    switch (PyTuple_GET_SIZE(__pyx_args)) {
-      case  6: values[5] = PyTuple_GET_ITEM(__pyx_args, 5);
-      case  5: values[4] = PyTuple_GET_ITEM(__pyx_args, 4);
-      case  4: values[3] = PyTuple_GET_ITEM(__pyx_args, 3);
-      case  3: values[2] = PyTuple_GET_ITEM(__pyx_args, 2);
-      case  2: values[1] = PyTuple_GET_ITEM(__pyx_args, 1);
-      case  1: values[0] = PyTuple_GET_ITEM(__pyx_args, 0);
-      case  0: break;
-      default: goto __pyx_L5_argtuple_error;
-    }
-    switch (PyTuple_GET_SIZE(__pyx_args)) {
-      case  0:
-      values[0] = PyDict_GetItem(__pyx_kwds, __pyx_kp_D00);
-      if (likely(values[0])) kw_args--;
-      else goto __pyx_L5_argtuple_error;
-      case  1:
-      values[1] = PyDict_GetItem(__pyx_kwds, __pyx_kp_31);
-      if (likely(values[1])) kw_args--;
-      else {
-        __Pyx_RaiseArgtupleInvalid("mu1_tri", 1, 6, 6, 1); {__pyx_filename = __pyx_f[0]; __pyx_lineno = 198; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-      }
-      case  2:
-      values[2] = PyDict_GetItem(__pyx_kwds, __pyx_kp_32);
-      if (likely(values[2])) kw_args--;
-      else {
-        __Pyx_RaiseArgtupleInvalid("mu1_tri", 1, 6, 6, 2); {__pyx_filename = __pyx_f[0]; __pyx_lineno = 198; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-      }
-      case  3:
-      values[3] = PyDict_GetItem(__pyx_kwds, __pyx_kp_34);
-      if (likely(values[3])) kw_args--;
-      else {
-        __Pyx_RaiseArgtupleInvalid("mu1_tri", 1, 6, 6, 3); {__pyx_filename = __pyx_f[0]; __pyx_lineno = 198; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-      }
-      case  4:
-      values[4] = PyDict_GetItem(__pyx_kwds, __pyx_kp_35);
-      if (likely(values[4])) kw_args--;
-      else {
-        __Pyx_RaiseArgtupleInvalid("mu1_tri", 1, 6, 6, 4); {__pyx_filename = __pyx_f[0]; __pyx_lineno = 198; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-      }
-      case  5:
-      values[5] = PyDict_GetItem(__pyx_kwds, __pyx_kp_37);
-      if (likely(values[5])) kw_args--;
-      else {
-        __Pyx_RaiseArgtupleInvalid("mu1_tri", 1, 6, 6, 5); {__pyx_filename = __pyx_f[0]; __pyx_lineno = 198; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-      }
-    }
-    if (unlikely(kw_args > 0)) {
-      if (unlikely(__Pyx_ParseOptionalKeywords(__pyx_kwds, __pyx_pyargnames, 0, values, PyTuple_GET_SIZE(__pyx_args), "mu1_tri") < 0)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 198; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-    }
-    __pyx_v_D00 = __pyx_PyFloat_AsDouble(values[0]); if (unlikely(PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 198; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-    __pyx_v_D01 = __pyx_PyFloat_AsDouble(values[1]); if (unlikely(PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 198; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-    __pyx_v_D02 = __pyx_PyFloat_AsDouble(values[2]); if (unlikely(PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 198; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-    __pyx_v_D11 = __pyx_PyFloat_AsDouble(values[3]); if (unlikely(PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 199; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-    __pyx_v_D12 = __pyx_PyFloat_AsDouble(values[4]); if (unlikely(PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 199; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-    __pyx_v_D22 = __pyx_PyFloat_AsDouble(values[5]); if (unlikely(PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 200; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-  } else if (PyTuple_GET_SIZE(__pyx_args) != 6) {
-    goto __pyx_L5_argtuple_error;
-  } else {
-    __pyx_v_D00 = __pyx_PyFloat_AsDouble(PyTuple_GET_ITEM(__pyx_args, 0)); if (unlikely(PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 198; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-    __pyx_v_D01 = __pyx_PyFloat_AsDouble(PyTuple_GET_ITEM(__pyx_args, 1)); if (unlikely(PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 198; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-    __pyx_v_D02 = __pyx_PyFloat_AsDouble(PyTuple_GET_ITEM(__pyx_args, 2)); if (unlikely(PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 198; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-    __pyx_v_D11 = __pyx_PyFloat_AsDouble(PyTuple_GET_ITEM(__pyx_args, 3)); if (unlikely(PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 199; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-    __pyx_v_D12 = __pyx_PyFloat_AsDouble(PyTuple_GET_ITEM(__pyx_args, 4)); if (unlikely(PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 199; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-    __pyx_v_D22 = __pyx_PyFloat_AsDouble(PyTuple_GET_ITEM(__pyx_args, 5)); if (unlikely(PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 200; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-  }
-  goto __pyx_L4_argument_unpacking_done;
-  __pyx_L5_argtuple_error:;
-  __Pyx_RaiseArgtupleInvalid("mu1_tri", 1, 6, 6, PyTuple_GET_SIZE(__pyx_args)); {__pyx_filename = __pyx_f[0]; __pyx_lineno = 198; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-  __pyx_L3_error:;
-  __Pyx_AddTraceback("nipy.algorithms.statistics.intvol.mu1_tri");
-  return NULL;
-  __pyx_L4_argument_unpacking_done:;
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":220
- *   """
- * 
- *   cdef double mu = 0             # <<<<<<<<<<<<<<
- *   mu += mu1_edge(D00, D01, D11)
- *   mu += mu1_edge(D00, D02, D22)
- */
-  __pyx_v_mu = 0;
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":221
- * 
- *   cdef double mu = 0
- *   mu += mu1_edge(D00, D01, D11)             # <<<<<<<<<<<<<<
- *   mu += mu1_edge(D00, D02, D22)
- *   mu += mu1_edge(D11, D12, D22)
- */
-  __pyx_1 = __Pyx_GetName(__pyx_m, __pyx_kp_45); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 221; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_1);
-  __pyx_t_1 = PyFloat_FromDouble(__pyx_v_D00); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 221; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_1);
-  __pyx_t_2 = PyFloat_FromDouble(__pyx_v_D01); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 221; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_2);
-  __pyx_t_3 = PyFloat_FromDouble(__pyx_v_D11); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 221; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_3);
-  __pyx_t_4 = PyTuple_New(3); if (unlikely(!__pyx_t_4)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 221; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_4));
-  PyTuple_SET_ITEM(__pyx_t_4, 0, __pyx_t_1);
-  __Pyx_GIVEREF(__pyx_t_1);
-  PyTuple_SET_ITEM(__pyx_t_4, 1, __pyx_t_2);
-  __Pyx_GIVEREF(__pyx_t_2);
-  PyTuple_SET_ITEM(__pyx_t_4, 2, __pyx_t_3);
-  __Pyx_GIVEREF(__pyx_t_3);
-  __pyx_t_1 = 0;
-  __pyx_t_2 = 0;
-  __pyx_t_3 = 0;
-  __pyx_t_3 = PyObject_Call(__pyx_1, ((PyObject *)__pyx_t_4), NULL); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 221; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_3);
-  __Pyx_DECREF(__pyx_1); __pyx_1 = 0;
-  __Pyx_DECREF(((PyObject *)__pyx_t_4)); __pyx_t_4 = 0;
-  __pyx_t_5 = __pyx_PyFloat_AsDouble(__pyx_t_3); if (unlikely(PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 221; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_DECREF(__pyx_t_3); __pyx_t_3 = 0;
-  __pyx_v_mu += __pyx_t_5;
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":222
- *   cdef double mu = 0
- *   mu += mu1_edge(D00, D01, D11)
- *   mu += mu1_edge(D00, D02, D22)             # <<<<<<<<<<<<<<
- *   mu += mu1_edge(D11, D12, D22)
- *   return mu * 0.5
- */
-  __pyx_1 = __Pyx_GetName(__pyx_m, __pyx_kp_45); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 222; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_1);
-  __pyx_t_3 = PyFloat_FromDouble(__pyx_v_D00); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 222; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_3);
-  __pyx_t_4 = PyFloat_FromDouble(__pyx_v_D02); if (unlikely(!__pyx_t_4)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 222; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_4);
-  __pyx_t_2 = PyFloat_FromDouble(__pyx_v_D22); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 222; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_2);
-  __pyx_t_1 = PyTuple_New(3); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 222; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_1));
-  PyTuple_SET_ITEM(__pyx_t_1, 0, __pyx_t_3);
-  __Pyx_GIVEREF(__pyx_t_3);
-  PyTuple_SET_ITEM(__pyx_t_1, 1, __pyx_t_4);
-  __Pyx_GIVEREF(__pyx_t_4);
-  PyTuple_SET_ITEM(__pyx_t_1, 2, __pyx_t_2);
-  __Pyx_GIVEREF(__pyx_t_2);
-  __pyx_t_3 = 0;
-  __pyx_t_4 = 0;
-  __pyx_t_2 = 0;
-  __pyx_t_2 = PyObject_Call(__pyx_1, ((PyObject *)__pyx_t_1), NULL); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 222; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_2);
-  __Pyx_DECREF(__pyx_1); __pyx_1 = 0;
-  __Pyx_DECREF(((PyObject *)__pyx_t_1)); __pyx_t_1 = 0;
-  __pyx_t_5 = __pyx_PyFloat_AsDouble(__pyx_t_2); if (unlikely(PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 222; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_DECREF(__pyx_t_2); __pyx_t_2 = 0;
-  __pyx_v_mu += __pyx_t_5;
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":223
- *   mu += mu1_edge(D00, D01, D11)
- *   mu += mu1_edge(D00, D02, D22)
- *   mu += mu1_edge(D11, D12, D22)             # <<<<<<<<<<<<<<
- *   return mu * 0.5
- * 
- */
-  __pyx_1 = __Pyx_GetName(__pyx_m, __pyx_kp_45); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 223; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_1);
-  __pyx_t_2 = PyFloat_FromDouble(__pyx_v_D11); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 223; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_2);
-  __pyx_t_1 = PyFloat_FromDouble(__pyx_v_D12); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 223; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_1);
-  __pyx_t_4 = PyFloat_FromDouble(__pyx_v_D22); if (unlikely(!__pyx_t_4)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 223; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_4);
-  __pyx_t_3 = PyTuple_New(3); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 223; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_3));
-  PyTuple_SET_ITEM(__pyx_t_3, 0, __pyx_t_2);
-  __Pyx_GIVEREF(__pyx_t_2);
-  PyTuple_SET_ITEM(__pyx_t_3, 1, __pyx_t_1);
-  __Pyx_GIVEREF(__pyx_t_1);
-  PyTuple_SET_ITEM(__pyx_t_3, 2, __pyx_t_4);
-  __Pyx_GIVEREF(__pyx_t_4);
-  __pyx_t_2 = 0;
-  __pyx_t_1 = 0;
-  __pyx_t_4 = 0;
-  __pyx_t_4 = PyObject_Call(__pyx_1, ((PyObject *)__pyx_t_3), NULL); if (unlikely(!__pyx_t_4)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 223; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_4);
-  __Pyx_DECREF(__pyx_1); __pyx_1 = 0;
-  __Pyx_DECREF(((PyObject *)__pyx_t_3)); __pyx_t_3 = 0;
-  __pyx_t_5 = __pyx_PyFloat_AsDouble(__pyx_t_4); if (unlikely(PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 223; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_DECREF(__pyx_t_4); __pyx_t_4 = 0;
-  __pyx_v_mu += __pyx_t_5;
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":224
- *   mu += mu1_edge(D00, D02, D22)
- *   mu += mu1_edge(D11, D12, D22)
- *   return mu * 0.5             # <<<<<<<<<<<<<<
- * 
- * def mu1_edge(double D00, double D01,
- */
-  __Pyx_XDECREF(__pyx_r);
-  __pyx_t_4 = PyFloat_FromDouble((__pyx_v_mu * 0.5)); if (unlikely(!__pyx_t_4)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 224; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_4);
-  __pyx_r = __pyx_t_4;
-  __pyx_t_4 = 0;
-  goto __pyx_L0;
-
-  __pyx_r = Py_None; __Pyx_INCREF(Py_None);
-  goto __pyx_L0;
-  __pyx_L1_error:;
-  __Pyx_XDECREF(__pyx_1);
-  __Pyx_XDECREF(__pyx_t_1);
-  __Pyx_XDECREF(__pyx_t_2);
-  __Pyx_XDECREF(__pyx_t_3);
-  __Pyx_XDECREF(__pyx_t_4);
-  __Pyx_AddTraceback("nipy.algorithms.statistics.intvol.mu1_tri");
-  __pyx_r = NULL;
-  __pyx_L0:;
-  __Pyx_XGIVEREF(__pyx_r);
-  __Pyx_FinishRefcountContext();
-  return __pyx_r;
-}
-
-/* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":226
- *   return mu * 0.5
- * 
- * def mu1_edge(double D00, double D01,             # <<<<<<<<<<<<<<
- *              double D11):
- *   """
- */
-
-static PyObject *__pyx_pf_4nipy_10algorithms_10statistics_6intvol_mu1_edge(PyObject *__pyx_self, PyObject *__pyx_args, PyObject *__pyx_kwds); /*proto*/
-static char __pyx_doc_4nipy_10algorithms_10statistics_6intvol_mu1_edge[] = "\n  Compute the 1st intrinsic volume (length)\n  of a line segment with coordinates [coords[v0], coords[v1]]\n\n  Inputs:\n  -------\n\n  coords : ndarray((*,2))\n       An array of coordinates of vertices of tetrahedron.\n\n  v0, v1 : int\n       Indices for vertices of the tetrahedron.\n\n  Outputs:\n  --------\n\n  mu0 : float\n  ";
-static PyObject *__pyx_pf_4nipy_10algorithms_10statistics_6intvol_mu1_edge(PyObject *__pyx_self, PyObject *__pyx_args, PyObject *__pyx_kwds) {
-  double __pyx_v_D00;
-  double __pyx_v_D01;
-  double __pyx_v_D11;
-  double __pyx_v_mu;
-  PyObject *__pyx_r = NULL;
-  PyObject *__pyx_1 = 0;
-  PyObject *__pyx_t_1 = NULL;
-  PyObject *__pyx_t_2 = NULL;
-  PyObject *__pyx_t_3 = NULL;
-  static PyObject **__pyx_pyargnames[] = {&__pyx_kp_D00,&__pyx_kp_31,&__pyx_kp_34,0};
-  __Pyx_SetupRefcountContext("mu1_edge");
-  __pyx_self = __pyx_self;
-  if (unlikely(__pyx_kwds)) {
-    Py_ssize_t kw_args = PyDict_Size(__pyx_kwds);
-    PyObject* values[3] = {0,0,0};
-    switch (PyTuple_GET_SIZE(__pyx_args)) {
-      case  3: values[2] = PyTuple_GET_ITEM(__pyx_args, 2);
-      case  2: values[1] = PyTuple_GET_ITEM(__pyx_args, 1);
-      case  1: values[0] = PyTuple_GET_ITEM(__pyx_args, 0);
-      case  0: break;
-      default: goto __pyx_L5_argtuple_error;
-    }
-    switch (PyTuple_GET_SIZE(__pyx_args)) {
-      case  0:
-      values[0] = PyDict_GetItem(__pyx_kwds, __pyx_kp_D00);
-      if (likely(values[0])) kw_args--;
-      else goto __pyx_L5_argtuple_error;
-      case  1:
-      values[1] = PyDict_GetItem(__pyx_kwds, __pyx_kp_31);
-      if (likely(values[1])) kw_args--;
-      else {
-        __Pyx_RaiseArgtupleInvalid("mu1_edge", 1, 3, 3, 1); {__pyx_filename = __pyx_f[0]; __pyx_lineno = 226; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-      }
-      case  2:
-      values[2] = PyDict_GetItem(__pyx_kwds, __pyx_kp_34);
-      if (likely(values[2])) kw_args--;
-      else {
-        __Pyx_RaiseArgtupleInvalid("mu1_edge", 1, 3, 3, 2); {__pyx_filename = __pyx_f[0]; __pyx_lineno = 226; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-      }
-    }
-    if (unlikely(kw_args > 0)) {
-      if (unlikely(__Pyx_ParseOptionalKeywords(__pyx_kwds, __pyx_pyargnames, 0, values, PyTuple_GET_SIZE(__pyx_args), "mu1_edge") < 0)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 226; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-    }
-    __pyx_v_D00 = __pyx_PyFloat_AsDouble(values[0]); if (unlikely(PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 226; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-    __pyx_v_D01 = __pyx_PyFloat_AsDouble(values[1]); if (unlikely(PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 226; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-    __pyx_v_D11 = __pyx_PyFloat_AsDouble(values[2]); if (unlikely(PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 227; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-  } else if (PyTuple_GET_SIZE(__pyx_args) != 3) {
-    goto __pyx_L5_argtuple_error;
-  } else {
-    __pyx_v_D00 = __pyx_PyFloat_AsDouble(PyTuple_GET_ITEM(__pyx_args, 0)); if (unlikely(PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 226; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-    __pyx_v_D01 = __pyx_PyFloat_AsDouble(PyTuple_GET_ITEM(__pyx_args, 1)); if (unlikely(PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 226; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-    __pyx_v_D11 = __pyx_PyFloat_AsDouble(PyTuple_GET_ITEM(__pyx_args, 2)); if (unlikely(PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 227; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-  }
-  goto __pyx_L4_argument_unpacking_done;
-  __pyx_L5_argtuple_error:;
-  __Pyx_RaiseArgtupleInvalid("mu1_edge", 1, 3, 3, PyTuple_GET_SIZE(__pyx_args)); {__pyx_filename = __pyx_f[0]; __pyx_lineno = 226; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-  __pyx_L3_error:;
-  __Pyx_AddTraceback("nipy.algorithms.statistics.intvol.mu1_edge");
-  return NULL;
-  __pyx_L4_argument_unpacking_done:;
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":248
- * 
- *   cdef double mu
- *   mu = 0             # <<<<<<<<<<<<<<
- * 
- *   return np.sqrt(D00 - 2*D01 + D11)
- */
-  __pyx_v_mu = 0;
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":250
- *   mu = 0
- * 
- *   return np.sqrt(D00 - 2*D01 + D11)             # <<<<<<<<<<<<<<
- * 
- * def EC3d(np.ndarray[DTYPE_int_t, ndim=3] mask):
- */
-  __Pyx_XDECREF(__pyx_r);
-  __pyx_1 = __Pyx_GetName(__pyx_m, __pyx_kp_np); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 250; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_1);
-  __pyx_t_1 = PyObject_GetAttr(__pyx_1, __pyx_kp_sqrt); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 250; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_1);
-  __Pyx_DECREF(__pyx_1); __pyx_1 = 0;
-  __pyx_t_2 = PyFloat_FromDouble(((__pyx_v_D00 - (2 * __pyx_v_D01)) + __pyx_v_D11)); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 250; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_2);
-  __pyx_t_3 = PyTuple_New(1); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 250; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_3));
-  PyTuple_SET_ITEM(__pyx_t_3, 0, __pyx_t_2);
-  __Pyx_GIVEREF(__pyx_t_2);
-  __pyx_t_2 = 0;
-  __pyx_t_2 = PyObject_Call(__pyx_t_1, ((PyObject *)__pyx_t_3), NULL); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 250; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_2);
-  __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-  __Pyx_DECREF(((PyObject *)__pyx_t_3)); __pyx_t_3 = 0;
-  __pyx_r = __pyx_t_2;
-  __pyx_t_2 = 0;
-  goto __pyx_L0;
-
-  __pyx_r = Py_None; __Pyx_INCREF(Py_None);
-  goto __pyx_L0;
-  __pyx_L1_error:;
-  __Pyx_XDECREF(__pyx_1);
-  __Pyx_XDECREF(__pyx_t_1);
-  __Pyx_XDECREF(__pyx_t_2);
-  __Pyx_XDECREF(__pyx_t_3);
-  __Pyx_AddTraceback("nipy.algorithms.statistics.intvol.mu1_edge");
-  __pyx_r = NULL;
-  __pyx_L0:;
-  __Pyx_XGIVEREF(__pyx_r);
-  __Pyx_FinishRefcountContext();
-  return __pyx_r;
-}
-
-/* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":252
- *   return np.sqrt(D00 - 2*D01 + D11)
- * 
- * def EC3d(np.ndarray[DTYPE_int_t, ndim=3] mask):             # <<<<<<<<<<<<<<
- *     """
- *     Given a 3d mask, compute the 0th intrinsic volume
- */
-
-static PyObject *__pyx_pf_4nipy_10algorithms_10statistics_6intvol_EC3d(PyObject *__pyx_self, PyObject *__pyx_v_mask); /*proto*/
-static char __pyx_doc_4nipy_10algorithms_10statistics_6intvol_EC3d[] = "\n    Given a 3d mask, compute the 0th intrinsic volume\n    (Euler characteristic)\n    of the masked region. The region is broken up into tetrahedra /\n    triangles / edges / vertices, which are included based on whether\n    all voxels in the tetrahedron / triangle / edge / vertex are\n    in the mask or not.\n\n    Parameters:\n    -----------\n\n    coords : ndarray((*,i,j,k))\n         Coordinates for the voxels in the mask\n\n    mask : ndarray((i,j,k), np.int)\n         Binary mask determining whether or not\n         a voxel is in the mask.\n\n    Outputs:\n    --------\n\n    mu0 : int\n\n    Notes:\n    ------\n\n    The array mask is assumed to be binary. At the time of \n    writing, it is not clear how to get cython to use np.bool\n    arrays.\n\n    The 3d cubes are triangulated into 6 tetrahedra of equal volume,\n    as described in the reference below.\n\n    References:\n    -----------\n\n    Taylor, J.E. & Worsley, K.J. (2007). \"Detecting sparse signal in random fields,\n      with an application to brain mapping.\"\n      Journal of the American Statistical Association, 102(479):913-928.\n\n\n    ";
-static PyObject *__pyx_pf_4nipy_10algorithms_10statistics_6intvol_EC3d(PyObject *__pyx_self, PyObject *__pyx_v_mask) {
-  PyArrayObject *__pyx_v_fmask;
-  PyArrayObject *__pyx_v_d2;
-  PyArrayObject *__pyx_v_d3;
-  PyArrayObject *__pyx_v_d4;
-  long __pyx_v_i;
-  long __pyx_v_j;
-  long __pyx_v_k;
-  long __pyx_v_l;
-  long __pyx_v_s0;
-  long __pyx_v_s1;
-  long __pyx_v_s2;
-  long __pyx_v_ds2;
-  long __pyx_v_ds3;
-  long __pyx_v_ds4;
-  long __pyx_v_index;
-  long __pyx_v_m;
-  long __pyx_v_nvox;
-  long __pyx_v_ss0;
-  long __pyx_v_ss1;
-  long __pyx_v_ss2;
-  long __pyx_v_v0;
-  long __pyx_v_v1;
-  long __pyx_v_v2;
-  long __pyx_v_v3;
-  long __pyx_v_l0;
-  PyArrayObject *__pyx_v_pmask;
-  PyObject *__pyx_v_strides;
-  PyObject *__pyx_v_union;
-  PyObject *__pyx_v_c;
-  Py_buffer __pyx_bstruct_mask;
-  Py_ssize_t __pyx_bstride_0_mask = 0;
-  Py_ssize_t __pyx_bstride_1_mask = 0;
-  Py_ssize_t __pyx_bstride_2_mask = 0;
-  Py_ssize_t __pyx_bshape_0_mask = 0;
-  Py_ssize_t __pyx_bshape_1_mask = 0;
-  Py_ssize_t __pyx_bshape_2_mask = 0;
-  Py_buffer __pyx_bstruct_d4;
-  Py_ssize_t __pyx_bstride_0_d4 = 0;
-  Py_ssize_t __pyx_bstride_1_d4 = 0;
-  Py_ssize_t __pyx_bshape_0_d4 = 0;
-  Py_ssize_t __pyx_bshape_1_d4 = 0;
-  Py_buffer __pyx_bstruct_d2;
-  Py_ssize_t __pyx_bstride_0_d2 = 0;
-  Py_ssize_t __pyx_bstride_1_d2 = 0;
-  Py_ssize_t __pyx_bshape_0_d2 = 0;
-  Py_ssize_t __pyx_bshape_1_d2 = 0;
-  Py_buffer __pyx_bstruct_d3;
-  Py_ssize_t __pyx_bstride_0_d3 = 0;
-  Py_ssize_t __pyx_bstride_1_d3 = 0;
-  Py_ssize_t __pyx_bshape_0_d3 = 0;
-  Py_ssize_t __pyx_bshape_1_d3 = 0;
-  Py_buffer __pyx_bstruct_pmask;
-  Py_ssize_t __pyx_bstride_0_pmask = 0;
-  Py_ssize_t __pyx_bstride_1_pmask = 0;
-  Py_ssize_t __pyx_bstride_2_pmask = 0;
-  Py_ssize_t __pyx_bshape_0_pmask = 0;
-  Py_ssize_t __pyx_bshape_1_pmask = 0;
-  Py_ssize_t __pyx_bshape_2_pmask = 0;
-  Py_buffer __pyx_bstruct_fmask;
-  Py_ssize_t __pyx_bstride_0_fmask = 0;
-  Py_ssize_t __pyx_bshape_0_fmask = 0;
-  PyObject *__pyx_r = NULL;
-  PyObject *__pyx_1 = 0;
-  PyObject *__pyx_2 = 0;
-  PyObject *__pyx_3 = 0;
-  PyObject *__pyx_t_1 = NULL;
-  PyObject *__pyx_t_2 = NULL;
-  PyObject *__pyx_t_3 = NULL;
-  int __pyx_t_4;
-  int __pyx_t_5;
-  PyObject *__pyx_t_6 = NULL;
-  PyObject *__pyx_t_7 = NULL;
-  PyArrayObject *__pyx_t_8 = NULL;
-  int __pyx_t_9;
-  PyObject *__pyx_t_10 = NULL;
-  PyObject *__pyx_t_11 = NULL;
-  PyObject *__pyx_t_12 = NULL;
-  npy_intp __pyx_t_13;
-  npy_intp __pyx_t_14;
-  npy_intp __pyx_t_15;
-  PyArrayObject *__pyx_t_16 = NULL;
-  PyObject *__pyx_t_17 = NULL;
-  PyObject *__pyx_t_18 = NULL;
-  PyObject *__pyx_t_19 = NULL;
-  PyArrayObject *__pyx_t_20 = NULL;
-  PyArrayObject *__pyx_t_21 = NULL;
-  PyArrayObject *__pyx_t_22 = NULL;
-  long __pyx_t_23;
-  long __pyx_t_24;
-  long __pyx_t_25;
-  long __pyx_t_26;
-  long __pyx_t_27;
-  long __pyx_t_28;
-  long __pyx_t_29;
-  long __pyx_t_30;
-  long __pyx_t_31;
-  long __pyx_t_32;
-  long __pyx_t_33;
-  long __pyx_t_34;
-  long __pyx_t_35;
-  long __pyx_t_36;
-  long __pyx_t_37;
-  long __pyx_t_38;
-  long __pyx_t_39;
-  long __pyx_t_40;
-  long __pyx_t_41;
-  long __pyx_t_42;
-  long __pyx_t_43;
-  long __pyx_t_44;
-  long __pyx_t_45;
-  long __pyx_t_46;
-  long __pyx_t_47;
-  long __pyx_t_48;
-  long __pyx_t_49;
-  long __pyx_t_50;
-  long __pyx_t_51;
-  long __pyx_t_52;
-  long __pyx_t_53;
-  __Pyx_SetupRefcountContext("EC3d");
-  __pyx_self = __pyx_self;
-  __pyx_v_fmask = ((PyArrayObject *)Py_None); __Pyx_INCREF(Py_None);
-  __pyx_v_d2 = ((PyArrayObject *)Py_None); __Pyx_INCREF(Py_None);
-  __pyx_v_d3 = ((PyArrayObject *)Py_None); __Pyx_INCREF(Py_None);
-  __pyx_v_d4 = ((PyArrayObject *)Py_None); __Pyx_INCREF(Py_None);
-  __pyx_v_pmask = ((PyArrayObject *)Py_None); __Pyx_INCREF(Py_None);
-  __pyx_v_strides = Py_None; __Pyx_INCREF(Py_None);
-  __pyx_v_union = Py_None; __Pyx_INCREF(Py_None);
-  __pyx_v_c = Py_None; __Pyx_INCREF(Py_None);
-  __pyx_bstruct_fmask.buf = NULL;
-  __pyx_bstruct_d2.buf = NULL;
-  __pyx_bstruct_d3.buf = NULL;
-  __pyx_bstruct_d4.buf = NULL;
-  __pyx_bstruct_pmask.buf = NULL;
-  __pyx_bstruct_mask.buf = NULL;
-  if (unlikely(!__Pyx_ArgTypeTest(((PyObject *)__pyx_v_mask), __pyx_ptype_5numpy_ndarray, 1, "mask", 0))) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 252; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  {
-    __Pyx_BufFmt_StackElem __pyx_stack[1];
-    if (unlikely(__Pyx_GetBufferAndValidate(&__pyx_bstruct_mask, (PyObject*)__pyx_v_mask, &__Pyx_TypeInfo_nn___pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_int_t, PyBUF_FORMAT| PyBUF_STRIDES, 3, 0, __pyx_stack) == -1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 252; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  }
-  __pyx_bstride_0_mask = __pyx_bstruct_mask.strides[0]; __pyx_bstride_1_mask = __pyx_bstruct_mask.strides[1]; __pyx_bstride_2_mask = __pyx_bstruct_mask.strides[2];
-  __pyx_bshape_0_mask = __pyx_bstruct_mask.shape[0]; __pyx_bshape_1_mask = __pyx_bstruct_mask.shape[1]; __pyx_bshape_2_mask = __pyx_bstruct_mask.shape[2];
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":296
- *     """
- * 
- *     if not set(np.unique(mask)).issubset([0,1]):             # <<<<<<<<<<<<<<
- *       raise ValueError('mask should be filled with 0/1 values, but be of type np.int')
- * 
- */
-  __pyx_1 = __Pyx_GetName(__pyx_m, __pyx_kp_np); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 296; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_1);
-  __pyx_t_1 = PyObject_GetAttr(__pyx_1, __pyx_kp_unique); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 296; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_1);
-  __Pyx_DECREF(__pyx_1); __pyx_1 = 0;
-  __pyx_t_2 = PyTuple_New(1); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 296; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_2));
-  __Pyx_INCREF(__pyx_v_mask);
-  PyTuple_SET_ITEM(__pyx_t_2, 0, __pyx_v_mask);
-  __Pyx_GIVEREF(__pyx_v_mask);
-  __pyx_t_3 = PyObject_Call(__pyx_t_1, ((PyObject *)__pyx_t_2), NULL); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 296; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_3);
-  __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-  __Pyx_DECREF(((PyObject *)__pyx_t_2)); __pyx_t_2 = 0;
-  __pyx_t_2 = PyTuple_New(1); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 296; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_2));
-  PyTuple_SET_ITEM(__pyx_t_2, 0, __pyx_t_3);
-  __Pyx_GIVEREF(__pyx_t_3);
-  __pyx_t_3 = 0;
-  __pyx_t_3 = PyObject_Call(((PyObject *)((PyObject*)&PySet_Type)), ((PyObject *)__pyx_t_2), NULL); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 296; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_3);
-  __Pyx_DECREF(((PyObject *)__pyx_t_2)); __pyx_t_2 = 0;
-  __pyx_t_2 = PyObject_GetAttr(__pyx_t_3, __pyx_kp_issubset); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 296; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_2);
-  __Pyx_DECREF(__pyx_t_3); __pyx_t_3 = 0;
-  __pyx_t_3 = PyList_New(2); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 296; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_3));
-  __Pyx_INCREF(__pyx_int_0);
-  PyList_SET_ITEM(__pyx_t_3, 0, __pyx_int_0);
-  __Pyx_GIVEREF(__pyx_int_0);
-  __Pyx_INCREF(__pyx_int_1);
-  PyList_SET_ITEM(__pyx_t_3, 1, __pyx_int_1);
-  __Pyx_GIVEREF(__pyx_int_1);
-  __pyx_t_1 = PyTuple_New(1); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 296; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_1));
-  PyTuple_SET_ITEM(__pyx_t_1, 0, ((PyObject *)__pyx_t_3));
-  __Pyx_GIVEREF(((PyObject *)__pyx_t_3));
-  __pyx_t_3 = 0;
-  __pyx_t_3 = PyObject_Call(__pyx_t_2, ((PyObject *)__pyx_t_1), NULL); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 296; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_3);
-  __Pyx_DECREF(__pyx_t_2); __pyx_t_2 = 0;
-  __Pyx_DECREF(((PyObject *)__pyx_t_1)); __pyx_t_1 = 0;
-  __pyx_t_4 = __Pyx_PyObject_IsTrue(__pyx_t_3); if (unlikely(__pyx_t_4 < 0)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 296; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_DECREF(__pyx_t_3); __pyx_t_3 = 0;
-  __pyx_t_5 = (!__pyx_t_4);
-  if (__pyx_t_5) {
-
-    /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":297
- * 
- *     if not set(np.unique(mask)).issubset([0,1]):
- *       raise ValueError('mask should be filled with 0/1 values, but be of type np.int')             # <<<<<<<<<<<<<<
- * 
- *     # 'flattened' mask (1d array)
- */
-    __pyx_t_3 = PyTuple_New(1); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 297; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __Pyx_GOTREF(((PyObject *)__pyx_t_3));
-    __Pyx_INCREF(__pyx_kp_46);
-    PyTuple_SET_ITEM(__pyx_t_3, 0, __pyx_kp_46);
-    __Pyx_GIVEREF(__pyx_kp_46);
-    __pyx_t_1 = PyObject_Call(__pyx_builtin_ValueError, ((PyObject *)__pyx_t_3), NULL); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 297; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __Pyx_GOTREF(__pyx_t_1);
-    __Pyx_DECREF(((PyObject *)__pyx_t_3)); __pyx_t_3 = 0;
-    __Pyx_Raise(__pyx_t_1, 0, 0);
-    __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-    {__pyx_filename = __pyx_f[0]; __pyx_lineno = 297; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    goto __pyx_L5;
-  }
-  __pyx_L5:;
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":313
- *     cdef long ss0, ss1, ss2 # strides
- *     cdef long v0, v1, v2, v3 # vertices
- *     cdef long l0 = 0             # <<<<<<<<<<<<<<
- * 
- *     cdef np.ndarray[DTYPE_int_t, ndim=3] pmask
- */
-  __pyx_v_l0 = 0;
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":316
- * 
- *     cdef np.ndarray[DTYPE_int_t, ndim=3] pmask
- *     pmask = np.zeros((mask.shape[0]+1, mask.shape[1]+1, mask.shape[2]+1), np.int)             # <<<<<<<<<<<<<<
- *     pmask[:-1,:-1,:-1] = mask
- * 
- */
-  __pyx_1 = __Pyx_GetName(__pyx_m, __pyx_kp_np); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 316; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_1);
-  __pyx_t_1 = PyObject_GetAttr(__pyx_1, __pyx_kp_zeros); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 316; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_1);
-  __Pyx_DECREF(__pyx_1); __pyx_1 = 0;
-  __pyx_t_3 = PyInt_FromLong(((((PyArrayObject *)__pyx_v_mask)->dimensions[0]) + 1)); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 316; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_3);
-  __pyx_t_2 = PyInt_FromLong(((((PyArrayObject *)__pyx_v_mask)->dimensions[1]) + 1)); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 316; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_2);
-  __pyx_t_6 = PyInt_FromLong(((((PyArrayObject *)__pyx_v_mask)->dimensions[2]) + 1)); if (unlikely(!__pyx_t_6)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 316; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_6);
-  __pyx_t_7 = PyTuple_New(3); if (unlikely(!__pyx_t_7)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 316; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_7));
-  PyTuple_SET_ITEM(__pyx_t_7, 0, __pyx_t_3);
-  __Pyx_GIVEREF(__pyx_t_3);
-  PyTuple_SET_ITEM(__pyx_t_7, 1, __pyx_t_2);
-  __Pyx_GIVEREF(__pyx_t_2);
-  PyTuple_SET_ITEM(__pyx_t_7, 2, __pyx_t_6);
-  __Pyx_GIVEREF(__pyx_t_6);
-  __pyx_t_3 = 0;
-  __pyx_t_2 = 0;
-  __pyx_t_6 = 0;
-  __pyx_1 = __Pyx_GetName(__pyx_m, __pyx_kp_np); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 316; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_1);
-  __pyx_t_6 = PyObject_GetAttr(__pyx_1, __pyx_kp_int); if (unlikely(!__pyx_t_6)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 316; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_6);
-  __Pyx_DECREF(__pyx_1); __pyx_1 = 0;
-  __pyx_t_2 = PyTuple_New(2); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 316; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_2));
-  PyTuple_SET_ITEM(__pyx_t_2, 0, ((PyObject *)__pyx_t_7));
-  __Pyx_GIVEREF(((PyObject *)__pyx_t_7));
-  PyTuple_SET_ITEM(__pyx_t_2, 1, __pyx_t_6);
-  __Pyx_GIVEREF(__pyx_t_6);
-  __pyx_t_7 = 0;
-  __pyx_t_6 = 0;
-  __pyx_t_6 = PyObject_Call(__pyx_t_1, ((PyObject *)__pyx_t_2), NULL); if (unlikely(!__pyx_t_6)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 316; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_6);
-  __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-  __Pyx_DECREF(((PyObject *)__pyx_t_2)); __pyx_t_2 = 0;
-  if (!(__Pyx_TypeTest(__pyx_t_6, __pyx_ptype_5numpy_ndarray))) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 316; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __pyx_t_8 = ((PyArrayObject *)__pyx_t_6);
-  {
-    __Pyx_BufFmt_StackElem __pyx_stack[1];
-    __Pyx_SafeReleaseBuffer(&__pyx_bstruct_pmask);
-    __pyx_t_9 = __Pyx_GetBufferAndValidate(&__pyx_bstruct_pmask, (PyObject*)__pyx_t_8, &__Pyx_TypeInfo_nn___pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_int_t, PyBUF_FORMAT| PyBUF_STRIDES, 3, 0, __pyx_stack);
-    if (unlikely(__pyx_t_9 < 0)) {
-      PyErr_Fetch(&__pyx_t_10, &__pyx_t_11, &__pyx_t_12);
-      if (unlikely(__Pyx_GetBufferAndValidate(&__pyx_bstruct_pmask, (PyObject*)__pyx_v_pmask, &__Pyx_TypeInfo_nn___pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_int_t, PyBUF_FORMAT| PyBUF_STRIDES, 3, 0, __pyx_stack) == -1)) {
-        Py_XDECREF(__pyx_t_10); Py_XDECREF(__pyx_t_11); Py_XDECREF(__pyx_t_12);
-        __Pyx_RaiseBufferFallbackError();
-      } else {
-        PyErr_Restore(__pyx_t_10, __pyx_t_11, __pyx_t_12);
-      }
-    }
-    __pyx_bstride_0_pmask = __pyx_bstruct_pmask.strides[0]; __pyx_bstride_1_pmask = __pyx_bstruct_pmask.strides[1]; __pyx_bstride_2_pmask = __pyx_bstruct_pmask.strides[2];
-    __pyx_bshape_0_pmask = __pyx_bstruct_pmask.shape[0]; __pyx_bshape_1_pmask = __pyx_bstruct_pmask.shape[1]; __pyx_bshape_2_pmask = __pyx_bstruct_pmask.shape[2];
-    if (unlikely(__pyx_t_9 < 0)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 316; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  }
-  __pyx_t_8 = 0;
-  __Pyx_DECREF(((PyObject *)__pyx_v_pmask));
-  __pyx_v_pmask = ((PyArrayObject *)__pyx_t_6);
-  __pyx_t_6 = 0;
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":317
- *     cdef np.ndarray[DTYPE_int_t, ndim=3] pmask
- *     pmask = np.zeros((mask.shape[0]+1, mask.shape[1]+1, mask.shape[2]+1), np.int)
- *     pmask[:-1,:-1,:-1] = mask             # <<<<<<<<<<<<<<
- * 
- *     s0, s1, s2 = (pmask.shape[0], pmask.shape[1], pmask.shape[2])
- */
-  __pyx_1 = PySlice_New(Py_None, __pyx_int_neg_1, Py_None); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 317; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_1);
-  __pyx_2 = PySlice_New(Py_None, __pyx_int_neg_1, Py_None); if (unlikely(!__pyx_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 317; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_2);
-  __pyx_3 = PySlice_New(Py_None, __pyx_int_neg_1, Py_None); if (unlikely(!__pyx_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 317; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_3);
-  __pyx_t_6 = PyTuple_New(3); if (unlikely(!__pyx_t_6)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 317; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_6));
-  PyTuple_SET_ITEM(__pyx_t_6, 0, __pyx_1);
-  __Pyx_GIVEREF(__pyx_1);
-  PyTuple_SET_ITEM(__pyx_t_6, 1, __pyx_2);
-  __Pyx_GIVEREF(__pyx_2);
-  PyTuple_SET_ITEM(__pyx_t_6, 2, __pyx_3);
-  __Pyx_GIVEREF(__pyx_3);
-  __pyx_1 = 0;
-  __pyx_2 = 0;
-  __pyx_3 = 0;
-  if (PyObject_SetItem(((PyObject *)__pyx_v_pmask), ((PyObject *)__pyx_t_6), __pyx_v_mask) < 0) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 317; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_DECREF(((PyObject *)__pyx_t_6)); __pyx_t_6 = 0;
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":319
- *     pmask[:-1,:-1,:-1] = mask
- * 
- *     s0, s1, s2 = (pmask.shape[0], pmask.shape[1], pmask.shape[2])             # <<<<<<<<<<<<<<
- * 
- *     fmask = pmask.reshape((s0*s1*s2))
- */
-  __pyx_t_13 = (__pyx_v_pmask->dimensions[0]);
-  __pyx_t_14 = (__pyx_v_pmask->dimensions[1]);
-  __pyx_t_15 = (__pyx_v_pmask->dimensions[2]);
-  __pyx_v_s0 = __pyx_t_13;
-  __pyx_v_s1 = __pyx_t_14;
-  __pyx_v_s2 = __pyx_t_15;
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":321
- *     s0, s1, s2 = (pmask.shape[0], pmask.shape[1], pmask.shape[2])
- * 
- *     fmask = pmask.reshape((s0*s1*s2))             # <<<<<<<<<<<<<<
- * 
- *     strides = np.empty((s0, s1, s2), np.bool).strides
- */
-  __pyx_t_6 = PyObject_GetAttr(((PyObject *)__pyx_v_pmask), __pyx_kp_reshape); if (unlikely(!__pyx_t_6)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 321; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_6);
-  __pyx_t_2 = PyInt_FromLong(((__pyx_v_s0 * __pyx_v_s1) * __pyx_v_s2)); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 321; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_2);
-  __pyx_t_1 = PyTuple_New(1); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 321; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_1));
-  PyTuple_SET_ITEM(__pyx_t_1, 0, __pyx_t_2);
-  __Pyx_GIVEREF(__pyx_t_2);
-  __pyx_t_2 = 0;
-  __pyx_t_2 = PyObject_Call(__pyx_t_6, ((PyObject *)__pyx_t_1), NULL); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 321; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_2);
-  __Pyx_DECREF(__pyx_t_6); __pyx_t_6 = 0;
-  __Pyx_DECREF(((PyObject *)__pyx_t_1)); __pyx_t_1 = 0;
-  if (!(__Pyx_TypeTest(__pyx_t_2, __pyx_ptype_5numpy_ndarray))) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 321; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __pyx_t_16 = ((PyArrayObject *)__pyx_t_2);
-  {
-    __Pyx_BufFmt_StackElem __pyx_stack[1];
-    __Pyx_SafeReleaseBuffer(&__pyx_bstruct_fmask);
-    __pyx_t_9 = __Pyx_GetBufferAndValidate(&__pyx_bstruct_fmask, (PyObject*)__pyx_t_16, &__Pyx_TypeInfo_nn___pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_int_t, PyBUF_FORMAT| PyBUF_STRIDES, 1, 0, __pyx_stack);
-    if (unlikely(__pyx_t_9 < 0)) {
-      PyErr_Fetch(&__pyx_t_12, &__pyx_t_11, &__pyx_t_10);
-      if (unlikely(__Pyx_GetBufferAndValidate(&__pyx_bstruct_fmask, (PyObject*)__pyx_v_fmask, &__Pyx_TypeInfo_nn___pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_int_t, PyBUF_FORMAT| PyBUF_STRIDES, 1, 0, __pyx_stack) == -1)) {
-        Py_XDECREF(__pyx_t_12); Py_XDECREF(__pyx_t_11); Py_XDECREF(__pyx_t_10);
-        __Pyx_RaiseBufferFallbackError();
-      } else {
-        PyErr_Restore(__pyx_t_12, __pyx_t_11, __pyx_t_10);
-      }
-    }
-    __pyx_bstride_0_fmask = __pyx_bstruct_fmask.strides[0];
-    __pyx_bshape_0_fmask = __pyx_bstruct_fmask.shape[0];
-    if (unlikely(__pyx_t_9 < 0)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 321; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  }
-  __pyx_t_16 = 0;
-  __Pyx_DECREF(((PyObject *)__pyx_v_fmask));
-  __pyx_v_fmask = ((PyArrayObject *)__pyx_t_2);
-  __pyx_t_2 = 0;
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":323
- *     fmask = pmask.reshape((s0*s1*s2))
- * 
- *     strides = np.empty((s0, s1, s2), np.bool).strides             # <<<<<<<<<<<<<<
- * 
- *     # First do the interior contributions.
- */
-  __pyx_1 = __Pyx_GetName(__pyx_m, __pyx_kp_np); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 323; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_1);
-  __pyx_t_2 = PyObject_GetAttr(__pyx_1, __pyx_kp_empty); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 323; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_2);
-  __Pyx_DECREF(__pyx_1); __pyx_1 = 0;
-  __pyx_t_1 = PyInt_FromLong(__pyx_v_s0); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 323; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_1);
-  __pyx_t_6 = PyInt_FromLong(__pyx_v_s1); if (unlikely(!__pyx_t_6)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 323; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_6);
-  __pyx_t_7 = PyInt_FromLong(__pyx_v_s2); if (unlikely(!__pyx_t_7)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 323; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_7);
-  __pyx_t_3 = PyTuple_New(3); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 323; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_3));
-  PyTuple_SET_ITEM(__pyx_t_3, 0, __pyx_t_1);
-  __Pyx_GIVEREF(__pyx_t_1);
-  PyTuple_SET_ITEM(__pyx_t_3, 1, __pyx_t_6);
-  __Pyx_GIVEREF(__pyx_t_6);
-  PyTuple_SET_ITEM(__pyx_t_3, 2, __pyx_t_7);
-  __Pyx_GIVEREF(__pyx_t_7);
-  __pyx_t_1 = 0;
-  __pyx_t_6 = 0;
-  __pyx_t_7 = 0;
-  __pyx_2 = __Pyx_GetName(__pyx_m, __pyx_kp_np); if (unlikely(!__pyx_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 323; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_2);
-  __pyx_t_7 = PyObject_GetAttr(__pyx_2, __pyx_kp_bool); if (unlikely(!__pyx_t_7)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 323; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_7);
-  __Pyx_DECREF(__pyx_2); __pyx_2 = 0;
-  __pyx_t_6 = PyTuple_New(2); if (unlikely(!__pyx_t_6)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 323; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_6));
-  PyTuple_SET_ITEM(__pyx_t_6, 0, ((PyObject *)__pyx_t_3));
-  __Pyx_GIVEREF(((PyObject *)__pyx_t_3));
-  PyTuple_SET_ITEM(__pyx_t_6, 1, __pyx_t_7);
-  __Pyx_GIVEREF(__pyx_t_7);
-  __pyx_t_3 = 0;
-  __pyx_t_7 = 0;
-  __pyx_t_7 = PyObject_Call(__pyx_t_2, ((PyObject *)__pyx_t_6), NULL); if (unlikely(!__pyx_t_7)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 323; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_7);
-  __Pyx_DECREF(__pyx_t_2); __pyx_t_2 = 0;
-  __Pyx_DECREF(((PyObject *)__pyx_t_6)); __pyx_t_6 = 0;
-  __pyx_t_6 = PyObject_GetAttr(__pyx_t_7, __pyx_kp_strides); if (unlikely(!__pyx_t_6)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 323; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_6);
-  __Pyx_DECREF(__pyx_t_7); __pyx_t_7 = 0;
-  __Pyx_DECREF(__pyx_v_strides);
-  __pyx_v_strides = __pyx_t_6;
-  __pyx_t_6 = 0;
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":329
- *     # are uniquely associated with an interior voxel
- * 
- *     union = join_complexes(*[cube_with_strides_center((0,0,1), strides),             # <<<<<<<<<<<<<<
- *                              cube_with_strides_center((0,1,0), strides),
- *                              cube_with_strides_center((0,1,1), strides),
- */
-  __pyx_3 = __Pyx_GetName(__pyx_m, __pyx_kp_join_complexes); if (unlikely(!__pyx_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 329; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_3);
-  __pyx_1 = __Pyx_GetName(__pyx_m, __pyx_kp_43); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 329; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_1);
-  __pyx_t_6 = PyTuple_New(3); if (unlikely(!__pyx_t_6)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 329; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_6));
-  __Pyx_INCREF(__pyx_int_0);
-  PyTuple_SET_ITEM(__pyx_t_6, 0, __pyx_int_0);
-  __Pyx_GIVEREF(__pyx_int_0);
-  __Pyx_INCREF(__pyx_int_0);
-  PyTuple_SET_ITEM(__pyx_t_6, 1, __pyx_int_0);
-  __Pyx_GIVEREF(__pyx_int_0);
-  __Pyx_INCREF(__pyx_int_1);
-  PyTuple_SET_ITEM(__pyx_t_6, 2, __pyx_int_1);
-  __Pyx_GIVEREF(__pyx_int_1);
-  __pyx_t_7 = PyTuple_New(2); if (unlikely(!__pyx_t_7)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 329; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_7));
-  PyTuple_SET_ITEM(__pyx_t_7, 0, ((PyObject *)__pyx_t_6));
-  __Pyx_GIVEREF(((PyObject *)__pyx_t_6));
-  __Pyx_INCREF(__pyx_v_strides);
-  PyTuple_SET_ITEM(__pyx_t_7, 1, __pyx_v_strides);
-  __Pyx_GIVEREF(__pyx_v_strides);
-  __pyx_t_6 = 0;
-  __pyx_t_6 = PyObject_Call(__pyx_1, ((PyObject *)__pyx_t_7), NULL); if (unlikely(!__pyx_t_6)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 329; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_6);
-  __Pyx_DECREF(__pyx_1); __pyx_1 = 0;
-  __Pyx_DECREF(((PyObject *)__pyx_t_7)); __pyx_t_7 = 0;
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":330
- * 
- *     union = join_complexes(*[cube_with_strides_center((0,0,1), strides),
- *                              cube_with_strides_center((0,1,0), strides),             # <<<<<<<<<<<<<<
- *                              cube_with_strides_center((0,1,1), strides),
- *                              cube_with_strides_center((1,0,0), strides),
- */
-  __pyx_2 = __Pyx_GetName(__pyx_m, __pyx_kp_43); if (unlikely(!__pyx_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 330; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_2);
-  __pyx_t_7 = PyTuple_New(3); if (unlikely(!__pyx_t_7)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 330; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_7));
-  __Pyx_INCREF(__pyx_int_0);
-  PyTuple_SET_ITEM(__pyx_t_7, 0, __pyx_int_0);
-  __Pyx_GIVEREF(__pyx_int_0);
-  __Pyx_INCREF(__pyx_int_1);
-  PyTuple_SET_ITEM(__pyx_t_7, 1, __pyx_int_1);
-  __Pyx_GIVEREF(__pyx_int_1);
-  __Pyx_INCREF(__pyx_int_0);
-  PyTuple_SET_ITEM(__pyx_t_7, 2, __pyx_int_0);
-  __Pyx_GIVEREF(__pyx_int_0);
-  __pyx_t_2 = PyTuple_New(2); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 330; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_2));
-  PyTuple_SET_ITEM(__pyx_t_2, 0, ((PyObject *)__pyx_t_7));
-  __Pyx_GIVEREF(((PyObject *)__pyx_t_7));
-  __Pyx_INCREF(__pyx_v_strides);
-  PyTuple_SET_ITEM(__pyx_t_2, 1, __pyx_v_strides);
-  __Pyx_GIVEREF(__pyx_v_strides);
-  __pyx_t_7 = 0;
-  __pyx_t_7 = PyObject_Call(__pyx_2, ((PyObject *)__pyx_t_2), NULL); if (unlikely(!__pyx_t_7)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 330; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_7);
-  __Pyx_DECREF(__pyx_2); __pyx_2 = 0;
-  __Pyx_DECREF(((PyObject *)__pyx_t_2)); __pyx_t_2 = 0;
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":331
- *     union = join_complexes(*[cube_with_strides_center((0,0,1), strides),
- *                              cube_with_strides_center((0,1,0), strides),
- *                              cube_with_strides_center((0,1,1), strides),             # <<<<<<<<<<<<<<
- *                              cube_with_strides_center((1,0,0), strides),
- *                              cube_with_strides_center((1,0,1), strides),
- */
-  __pyx_1 = __Pyx_GetName(__pyx_m, __pyx_kp_43); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 331; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_1);
-  __pyx_t_2 = PyTuple_New(3); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 331; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_2));
-  __Pyx_INCREF(__pyx_int_0);
-  PyTuple_SET_ITEM(__pyx_t_2, 0, __pyx_int_0);
-  __Pyx_GIVEREF(__pyx_int_0);
-  __Pyx_INCREF(__pyx_int_1);
-  PyTuple_SET_ITEM(__pyx_t_2, 1, __pyx_int_1);
-  __Pyx_GIVEREF(__pyx_int_1);
-  __Pyx_INCREF(__pyx_int_1);
-  PyTuple_SET_ITEM(__pyx_t_2, 2, __pyx_int_1);
-  __Pyx_GIVEREF(__pyx_int_1);
-  __pyx_t_3 = PyTuple_New(2); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 331; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_3));
-  PyTuple_SET_ITEM(__pyx_t_3, 0, ((PyObject *)__pyx_t_2));
-  __Pyx_GIVEREF(((PyObject *)__pyx_t_2));
-  __Pyx_INCREF(__pyx_v_strides);
-  PyTuple_SET_ITEM(__pyx_t_3, 1, __pyx_v_strides);
-  __Pyx_GIVEREF(__pyx_v_strides);
-  __pyx_t_2 = 0;
-  __pyx_t_2 = PyObject_Call(__pyx_1, ((PyObject *)__pyx_t_3), NULL); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 331; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_2);
-  __Pyx_DECREF(__pyx_1); __pyx_1 = 0;
-  __Pyx_DECREF(((PyObject *)__pyx_t_3)); __pyx_t_3 = 0;
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":332
- *                              cube_with_strides_center((0,1,0), strides),
- *                              cube_with_strides_center((0,1,1), strides),
- *                              cube_with_strides_center((1,0,0), strides),             # <<<<<<<<<<<<<<
- *                              cube_with_strides_center((1,0,1), strides),
- *                              cube_with_strides_center((1,1,0), strides),
- */
-  __pyx_2 = __Pyx_GetName(__pyx_m, __pyx_kp_43); if (unlikely(!__pyx_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 332; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_2);
-  __pyx_t_3 = PyTuple_New(3); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 332; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_3));
-  __Pyx_INCREF(__pyx_int_1);
-  PyTuple_SET_ITEM(__pyx_t_3, 0, __pyx_int_1);
-  __Pyx_GIVEREF(__pyx_int_1);
-  __Pyx_INCREF(__pyx_int_0);
-  PyTuple_SET_ITEM(__pyx_t_3, 1, __pyx_int_0);
-  __Pyx_GIVEREF(__pyx_int_0);
-  __Pyx_INCREF(__pyx_int_0);
-  PyTuple_SET_ITEM(__pyx_t_3, 2, __pyx_int_0);
-  __Pyx_GIVEREF(__pyx_int_0);
-  __pyx_t_1 = PyTuple_New(2); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 332; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_1));
-  PyTuple_SET_ITEM(__pyx_t_1, 0, ((PyObject *)__pyx_t_3));
-  __Pyx_GIVEREF(((PyObject *)__pyx_t_3));
-  __Pyx_INCREF(__pyx_v_strides);
-  PyTuple_SET_ITEM(__pyx_t_1, 1, __pyx_v_strides);
-  __Pyx_GIVEREF(__pyx_v_strides);
-  __pyx_t_3 = 0;
-  __pyx_t_3 = PyObject_Call(__pyx_2, ((PyObject *)__pyx_t_1), NULL); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 332; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_3);
-  __Pyx_DECREF(__pyx_2); __pyx_2 = 0;
-  __Pyx_DECREF(((PyObject *)__pyx_t_1)); __pyx_t_1 = 0;
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":333
- *                              cube_with_strides_center((0,1,1), strides),
- *                              cube_with_strides_center((1,0,0), strides),
- *                              cube_with_strides_center((1,0,1), strides),             # <<<<<<<<<<<<<<
- *                              cube_with_strides_center((1,1,0), strides),
- *                              cube_with_strides_center((1,1,1), strides)])
- */
-  __pyx_1 = __Pyx_GetName(__pyx_m, __pyx_kp_43); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 333; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_1);
-  __pyx_t_1 = PyTuple_New(3); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 333; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_1));
-  __Pyx_INCREF(__pyx_int_1);
-  PyTuple_SET_ITEM(__pyx_t_1, 0, __pyx_int_1);
-  __Pyx_GIVEREF(__pyx_int_1);
-  __Pyx_INCREF(__pyx_int_0);
-  PyTuple_SET_ITEM(__pyx_t_1, 1, __pyx_int_0);
-  __Pyx_GIVEREF(__pyx_int_0);
-  __Pyx_INCREF(__pyx_int_1);
-  PyTuple_SET_ITEM(__pyx_t_1, 2, __pyx_int_1);
-  __Pyx_GIVEREF(__pyx_int_1);
-  __pyx_t_17 = PyTuple_New(2); if (unlikely(!__pyx_t_17)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 333; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_17));
-  PyTuple_SET_ITEM(__pyx_t_17, 0, ((PyObject *)__pyx_t_1));
-  __Pyx_GIVEREF(((PyObject *)__pyx_t_1));
-  __Pyx_INCREF(__pyx_v_strides);
-  PyTuple_SET_ITEM(__pyx_t_17, 1, __pyx_v_strides);
-  __Pyx_GIVEREF(__pyx_v_strides);
-  __pyx_t_1 = 0;
-  __pyx_t_1 = PyObject_Call(__pyx_1, ((PyObject *)__pyx_t_17), NULL); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 333; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_1);
-  __Pyx_DECREF(__pyx_1); __pyx_1 = 0;
-  __Pyx_DECREF(((PyObject *)__pyx_t_17)); __pyx_t_17 = 0;
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":334
- *                              cube_with_strides_center((1,0,0), strides),
- *                              cube_with_strides_center((1,0,1), strides),
- *                              cube_with_strides_center((1,1,0), strides),             # <<<<<<<<<<<<<<
- *                              cube_with_strides_center((1,1,1), strides)])
- *     c = cube_with_strides_center((0,0,0), strides)
- */
-  __pyx_2 = __Pyx_GetName(__pyx_m, __pyx_kp_43); if (unlikely(!__pyx_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 334; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_2);
-  __pyx_t_17 = PyTuple_New(3); if (unlikely(!__pyx_t_17)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 334; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_17));
-  __Pyx_INCREF(__pyx_int_1);
-  PyTuple_SET_ITEM(__pyx_t_17, 0, __pyx_int_1);
-  __Pyx_GIVEREF(__pyx_int_1);
-  __Pyx_INCREF(__pyx_int_1);
-  PyTuple_SET_ITEM(__pyx_t_17, 1, __pyx_int_1);
-  __Pyx_GIVEREF(__pyx_int_1);
-  __Pyx_INCREF(__pyx_int_0);
-  PyTuple_SET_ITEM(__pyx_t_17, 2, __pyx_int_0);
-  __Pyx_GIVEREF(__pyx_int_0);
-  __pyx_t_18 = PyTuple_New(2); if (unlikely(!__pyx_t_18)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 334; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_18));
-  PyTuple_SET_ITEM(__pyx_t_18, 0, ((PyObject *)__pyx_t_17));
-  __Pyx_GIVEREF(((PyObject *)__pyx_t_17));
-  __Pyx_INCREF(__pyx_v_strides);
-  PyTuple_SET_ITEM(__pyx_t_18, 1, __pyx_v_strides);
-  __Pyx_GIVEREF(__pyx_v_strides);
-  __pyx_t_17 = 0;
-  __pyx_t_17 = PyObject_Call(__pyx_2, ((PyObject *)__pyx_t_18), NULL); if (unlikely(!__pyx_t_17)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 334; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_17);
-  __Pyx_DECREF(__pyx_2); __pyx_2 = 0;
-  __Pyx_DECREF(((PyObject *)__pyx_t_18)); __pyx_t_18 = 0;
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":335
- *                              cube_with_strides_center((1,0,1), strides),
- *                              cube_with_strides_center((1,1,0), strides),
- *                              cube_with_strides_center((1,1,1), strides)])             # <<<<<<<<<<<<<<
- *     c = cube_with_strides_center((0,0,0), strides)
- * 
- */
-  __pyx_1 = __Pyx_GetName(__pyx_m, __pyx_kp_43); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 335; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_1);
-  __pyx_t_18 = PyTuple_New(3); if (unlikely(!__pyx_t_18)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 335; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_18));
-  __Pyx_INCREF(__pyx_int_1);
-  PyTuple_SET_ITEM(__pyx_t_18, 0, __pyx_int_1);
-  __Pyx_GIVEREF(__pyx_int_1);
-  __Pyx_INCREF(__pyx_int_1);
-  PyTuple_SET_ITEM(__pyx_t_18, 1, __pyx_int_1);
-  __Pyx_GIVEREF(__pyx_int_1);
-  __Pyx_INCREF(__pyx_int_1);
-  PyTuple_SET_ITEM(__pyx_t_18, 2, __pyx_int_1);
-  __Pyx_GIVEREF(__pyx_int_1);
-  __pyx_t_19 = PyTuple_New(2); if (unlikely(!__pyx_t_19)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 335; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_19));
-  PyTuple_SET_ITEM(__pyx_t_19, 0, ((PyObject *)__pyx_t_18));
-  __Pyx_GIVEREF(((PyObject *)__pyx_t_18));
-  __Pyx_INCREF(__pyx_v_strides);
-  PyTuple_SET_ITEM(__pyx_t_19, 1, __pyx_v_strides);
-  __Pyx_GIVEREF(__pyx_v_strides);
-  __pyx_t_18 = 0;
-  __pyx_t_18 = PyObject_Call(__pyx_1, ((PyObject *)__pyx_t_19), NULL); if (unlikely(!__pyx_t_18)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 335; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_18);
-  __Pyx_DECREF(__pyx_1); __pyx_1 = 0;
-  __Pyx_DECREF(((PyObject *)__pyx_t_19)); __pyx_t_19 = 0;
-  __pyx_t_19 = PyList_New(7); if (unlikely(!__pyx_t_19)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 329; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_19));
-  PyList_SET_ITEM(__pyx_t_19, 0, __pyx_t_6);
-  __Pyx_GIVEREF(__pyx_t_6);
-  PyList_SET_ITEM(__pyx_t_19, 1, __pyx_t_7);
-  __Pyx_GIVEREF(__pyx_t_7);
-  PyList_SET_ITEM(__pyx_t_19, 2, __pyx_t_2);
-  __Pyx_GIVEREF(__pyx_t_2);
-  PyList_SET_ITEM(__pyx_t_19, 3, __pyx_t_3);
-  __Pyx_GIVEREF(__pyx_t_3);
-  PyList_SET_ITEM(__pyx_t_19, 4, __pyx_t_1);
-  __Pyx_GIVEREF(__pyx_t_1);
-  PyList_SET_ITEM(__pyx_t_19, 5, __pyx_t_17);
-  __Pyx_GIVEREF(__pyx_t_17);
-  PyList_SET_ITEM(__pyx_t_19, 6, __pyx_t_18);
-  __Pyx_GIVEREF(__pyx_t_18);
-  __pyx_t_6 = 0;
-  __pyx_t_7 = 0;
-  __pyx_t_2 = 0;
-  __pyx_t_3 = 0;
-  __pyx_t_1 = 0;
-  __pyx_t_17 = 0;
-  __pyx_t_18 = 0;
-  __pyx_2 = PySequence_Tuple(((PyObject *)__pyx_t_19)); if (unlikely(!__pyx_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 329; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_2));
-  __Pyx_DECREF(((PyObject *)__pyx_t_19)); __pyx_t_19 = 0;
-  __pyx_t_19 = PyObject_Call(__pyx_3, ((PyObject *)__pyx_2), NULL); if (unlikely(!__pyx_t_19)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 329; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_19);
-  __Pyx_DECREF(__pyx_3); __pyx_3 = 0;
-  __Pyx_DECREF(((PyObject *)__pyx_2)); __pyx_2 = 0;
-  __Pyx_DECREF(__pyx_v_union);
-  __pyx_v_union = __pyx_t_19;
-  __pyx_t_19 = 0;
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":336
- *                              cube_with_strides_center((1,1,0), strides),
- *                              cube_with_strides_center((1,1,1), strides)])
- *     c = cube_with_strides_center((0,0,0), strides)             # <<<<<<<<<<<<<<
- * 
- *     d4 = np.array(list(c[4].difference(union[4])))
- */
-  __pyx_1 = __Pyx_GetName(__pyx_m, __pyx_kp_43); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 336; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_1);
-  __pyx_t_19 = PyTuple_New(3); if (unlikely(!__pyx_t_19)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 336; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_19));
-  __Pyx_INCREF(__pyx_int_0);
-  PyTuple_SET_ITEM(__pyx_t_19, 0, __pyx_int_0);
-  __Pyx_GIVEREF(__pyx_int_0);
-  __Pyx_INCREF(__pyx_int_0);
-  PyTuple_SET_ITEM(__pyx_t_19, 1, __pyx_int_0);
-  __Pyx_GIVEREF(__pyx_int_0);
-  __Pyx_INCREF(__pyx_int_0);
-  PyTuple_SET_ITEM(__pyx_t_19, 2, __pyx_int_0);
-  __Pyx_GIVEREF(__pyx_int_0);
-  __pyx_t_18 = PyTuple_New(2); if (unlikely(!__pyx_t_18)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 336; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_18));
-  PyTuple_SET_ITEM(__pyx_t_18, 0, ((PyObject *)__pyx_t_19));
-  __Pyx_GIVEREF(((PyObject *)__pyx_t_19));
-  __Pyx_INCREF(__pyx_v_strides);
-  PyTuple_SET_ITEM(__pyx_t_18, 1, __pyx_v_strides);
-  __Pyx_GIVEREF(__pyx_v_strides);
-  __pyx_t_19 = 0;
-  __pyx_t_19 = PyObject_Call(__pyx_1, ((PyObject *)__pyx_t_18), NULL); if (unlikely(!__pyx_t_19)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 336; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_19);
-  __Pyx_DECREF(__pyx_1); __pyx_1 = 0;
-  __Pyx_DECREF(((PyObject *)__pyx_t_18)); __pyx_t_18 = 0;
-  __Pyx_DECREF(__pyx_v_c);
-  __pyx_v_c = __pyx_t_19;
-  __pyx_t_19 = 0;
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":338
- *     c = cube_with_strides_center((0,0,0), strides)
- * 
- *     d4 = np.array(list(c[4].difference(union[4])))             # <<<<<<<<<<<<<<
- *     d3 = np.array(list(c[3].difference(union[3])))
- *     d2 = np.array(list(c[2].difference(union[2])))
- */
-  __pyx_3 = __Pyx_GetName(__pyx_m, __pyx_kp_np); if (unlikely(!__pyx_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 338; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_3);
-  __pyx_t_19 = PyObject_GetAttr(__pyx_3, __pyx_kp_array); if (unlikely(!__pyx_t_19)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 338; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_19);
-  __Pyx_DECREF(__pyx_3); __pyx_3 = 0;
-  __pyx_2 = __Pyx_GetItemInt(__pyx_v_c, 4, sizeof(long), PyInt_FromLong); if (!__pyx_2) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 338; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_2);
-  __pyx_t_18 = PyObject_GetAttr(__pyx_2, __pyx_kp_difference); if (unlikely(!__pyx_t_18)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 338; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_18);
-  __Pyx_DECREF(__pyx_2); __pyx_2 = 0;
-  __pyx_1 = __Pyx_GetItemInt(__pyx_v_union, 4, sizeof(long), PyInt_FromLong); if (!__pyx_1) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 338; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_1);
-  __pyx_t_17 = PyTuple_New(1); if (unlikely(!__pyx_t_17)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 338; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_17));
-  PyTuple_SET_ITEM(__pyx_t_17, 0, __pyx_1);
-  __Pyx_GIVEREF(__pyx_1);
-  __pyx_1 = 0;
-  __pyx_t_1 = PyObject_Call(__pyx_t_18, ((PyObject *)__pyx_t_17), NULL); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 338; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_1);
-  __Pyx_DECREF(__pyx_t_18); __pyx_t_18 = 0;
-  __Pyx_DECREF(((PyObject *)__pyx_t_17)); __pyx_t_17 = 0;
-  __pyx_t_17 = PyTuple_New(1); if (unlikely(!__pyx_t_17)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 338; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_17));
-  PyTuple_SET_ITEM(__pyx_t_17, 0, __pyx_t_1);
-  __Pyx_GIVEREF(__pyx_t_1);
-  __pyx_t_1 = 0;
-  __pyx_t_1 = PyObject_Call(((PyObject *)((PyObject*)&PyList_Type)), ((PyObject *)__pyx_t_17), NULL); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 338; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_1);
-  __Pyx_DECREF(((PyObject *)__pyx_t_17)); __pyx_t_17 = 0;
-  __pyx_t_17 = PyTuple_New(1); if (unlikely(!__pyx_t_17)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 338; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_17));
-  PyTuple_SET_ITEM(__pyx_t_17, 0, __pyx_t_1);
-  __Pyx_GIVEREF(__pyx_t_1);
-  __pyx_t_1 = 0;
-  __pyx_t_1 = PyObject_Call(__pyx_t_19, ((PyObject *)__pyx_t_17), NULL); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 338; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_1);
-  __Pyx_DECREF(__pyx_t_19); __pyx_t_19 = 0;
-  __Pyx_DECREF(((PyObject *)__pyx_t_17)); __pyx_t_17 = 0;
-  if (!(__Pyx_TypeTest(__pyx_t_1, __pyx_ptype_5numpy_ndarray))) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 338; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __pyx_t_20 = ((PyArrayObject *)__pyx_t_1);
-  {
-    __Pyx_BufFmt_StackElem __pyx_stack[1];
-    __Pyx_SafeReleaseBuffer(&__pyx_bstruct_d4);
-    __pyx_t_9 = __Pyx_GetBufferAndValidate(&__pyx_bstruct_d4, (PyObject*)__pyx_t_20, &__Pyx_TypeInfo_nn___pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_int_t, PyBUF_FORMAT| PyBUF_STRIDES, 2, 0, __pyx_stack);
-    if (unlikely(__pyx_t_9 < 0)) {
-      PyErr_Fetch(&__pyx_t_10, &__pyx_t_11, &__pyx_t_12);
-      if (unlikely(__Pyx_GetBufferAndValidate(&__pyx_bstruct_d4, (PyObject*)__pyx_v_d4, &__Pyx_TypeInfo_nn___pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_int_t, PyBUF_FORMAT| PyBUF_STRIDES, 2, 0, __pyx_stack) == -1)) {
-        Py_XDECREF(__pyx_t_10); Py_XDECREF(__pyx_t_11); Py_XDECREF(__pyx_t_12);
-        __Pyx_RaiseBufferFallbackError();
-      } else {
-        PyErr_Restore(__pyx_t_10, __pyx_t_11, __pyx_t_12);
-      }
-    }
-    __pyx_bstride_0_d4 = __pyx_bstruct_d4.strides[0]; __pyx_bstride_1_d4 = __pyx_bstruct_d4.strides[1];
-    __pyx_bshape_0_d4 = __pyx_bstruct_d4.shape[0]; __pyx_bshape_1_d4 = __pyx_bstruct_d4.shape[1];
-    if (unlikely(__pyx_t_9 < 0)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 338; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  }
-  __pyx_t_20 = 0;
-  __Pyx_DECREF(((PyObject *)__pyx_v_d4));
-  __pyx_v_d4 = ((PyArrayObject *)__pyx_t_1);
-  __pyx_t_1 = 0;
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":339
- * 
- *     d4 = np.array(list(c[4].difference(union[4])))
- *     d3 = np.array(list(c[3].difference(union[3])))             # <<<<<<<<<<<<<<
- *     d2 = np.array(list(c[2].difference(union[2])))
- * 
- */
-  __pyx_3 = __Pyx_GetName(__pyx_m, __pyx_kp_np); if (unlikely(!__pyx_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 339; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_3);
-  __pyx_t_1 = PyObject_GetAttr(__pyx_3, __pyx_kp_array); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 339; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_1);
-  __Pyx_DECREF(__pyx_3); __pyx_3 = 0;
-  __pyx_2 = __Pyx_GetItemInt(__pyx_v_c, 3, sizeof(long), PyInt_FromLong); if (!__pyx_2) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 339; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_2);
-  __pyx_t_17 = PyObject_GetAttr(__pyx_2, __pyx_kp_difference); if (unlikely(!__pyx_t_17)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 339; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_17);
-  __Pyx_DECREF(__pyx_2); __pyx_2 = 0;
-  __pyx_1 = __Pyx_GetItemInt(__pyx_v_union, 3, sizeof(long), PyInt_FromLong); if (!__pyx_1) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 339; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_1);
-  __pyx_t_19 = PyTuple_New(1); if (unlikely(!__pyx_t_19)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 339; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_19));
-  PyTuple_SET_ITEM(__pyx_t_19, 0, __pyx_1);
-  __Pyx_GIVEREF(__pyx_1);
-  __pyx_1 = 0;
-  __pyx_t_18 = PyObject_Call(__pyx_t_17, ((PyObject *)__pyx_t_19), NULL); if (unlikely(!__pyx_t_18)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 339; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_18);
-  __Pyx_DECREF(__pyx_t_17); __pyx_t_17 = 0;
-  __Pyx_DECREF(((PyObject *)__pyx_t_19)); __pyx_t_19 = 0;
-  __pyx_t_19 = PyTuple_New(1); if (unlikely(!__pyx_t_19)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 339; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_19));
-  PyTuple_SET_ITEM(__pyx_t_19, 0, __pyx_t_18);
-  __Pyx_GIVEREF(__pyx_t_18);
-  __pyx_t_18 = 0;
-  __pyx_t_18 = PyObject_Call(((PyObject *)((PyObject*)&PyList_Type)), ((PyObject *)__pyx_t_19), NULL); if (unlikely(!__pyx_t_18)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 339; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_18);
-  __Pyx_DECREF(((PyObject *)__pyx_t_19)); __pyx_t_19 = 0;
-  __pyx_t_19 = PyTuple_New(1); if (unlikely(!__pyx_t_19)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 339; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_19));
-  PyTuple_SET_ITEM(__pyx_t_19, 0, __pyx_t_18);
-  __Pyx_GIVEREF(__pyx_t_18);
-  __pyx_t_18 = 0;
-  __pyx_t_18 = PyObject_Call(__pyx_t_1, ((PyObject *)__pyx_t_19), NULL); if (unlikely(!__pyx_t_18)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 339; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_18);
-  __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-  __Pyx_DECREF(((PyObject *)__pyx_t_19)); __pyx_t_19 = 0;
-  if (!(__Pyx_TypeTest(__pyx_t_18, __pyx_ptype_5numpy_ndarray))) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 339; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __pyx_t_21 = ((PyArrayObject *)__pyx_t_18);
-  {
-    __Pyx_BufFmt_StackElem __pyx_stack[1];
-    __Pyx_SafeReleaseBuffer(&__pyx_bstruct_d3);
-    __pyx_t_9 = __Pyx_GetBufferAndValidate(&__pyx_bstruct_d3, (PyObject*)__pyx_t_21, &__Pyx_TypeInfo_nn___pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_int_t, PyBUF_FORMAT| PyBUF_STRIDES, 2, 0, __pyx_stack);
-    if (unlikely(__pyx_t_9 < 0)) {
-      PyErr_Fetch(&__pyx_t_12, &__pyx_t_11, &__pyx_t_10);
-      if (unlikely(__Pyx_GetBufferAndValidate(&__pyx_bstruct_d3, (PyObject*)__pyx_v_d3, &__Pyx_TypeInfo_nn___pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_int_t, PyBUF_FORMAT| PyBUF_STRIDES, 2, 0, __pyx_stack) == -1)) {
-        Py_XDECREF(__pyx_t_12); Py_XDECREF(__pyx_t_11); Py_XDECREF(__pyx_t_10);
-        __Pyx_RaiseBufferFallbackError();
-      } else {
-        PyErr_Restore(__pyx_t_12, __pyx_t_11, __pyx_t_10);
-      }
-    }
-    __pyx_bstride_0_d3 = __pyx_bstruct_d3.strides[0]; __pyx_bstride_1_d3 = __pyx_bstruct_d3.strides[1];
-    __pyx_bshape_0_d3 = __pyx_bstruct_d3.shape[0]; __pyx_bshape_1_d3 = __pyx_bstruct_d3.shape[1];
-    if (unlikely(__pyx_t_9 < 0)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 339; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  }
-  __pyx_t_21 = 0;
-  __Pyx_DECREF(((PyObject *)__pyx_v_d3));
-  __pyx_v_d3 = ((PyArrayObject *)__pyx_t_18);
-  __pyx_t_18 = 0;
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":340
- *     d4 = np.array(list(c[4].difference(union[4])))
- *     d3 = np.array(list(c[3].difference(union[3])))
- *     d2 = np.array(list(c[2].difference(union[2])))             # <<<<<<<<<<<<<<
- * 
- *     ds2 = d2.shape[0]
- */
-  __pyx_3 = __Pyx_GetName(__pyx_m, __pyx_kp_np); if (unlikely(!__pyx_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 340; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_3);
-  __pyx_t_18 = PyObject_GetAttr(__pyx_3, __pyx_kp_array); if (unlikely(!__pyx_t_18)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 340; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_18);
-  __Pyx_DECREF(__pyx_3); __pyx_3 = 0;
-  __pyx_2 = __Pyx_GetItemInt(__pyx_v_c, 2, sizeof(long), PyInt_FromLong); if (!__pyx_2) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 340; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_2);
-  __pyx_t_19 = PyObject_GetAttr(__pyx_2, __pyx_kp_difference); if (unlikely(!__pyx_t_19)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 340; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_19);
-  __Pyx_DECREF(__pyx_2); __pyx_2 = 0;
-  __pyx_1 = __Pyx_GetItemInt(__pyx_v_union, 2, sizeof(long), PyInt_FromLong); if (!__pyx_1) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 340; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_1);
-  __pyx_t_1 = PyTuple_New(1); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 340; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_1));
-  PyTuple_SET_ITEM(__pyx_t_1, 0, __pyx_1);
-  __Pyx_GIVEREF(__pyx_1);
-  __pyx_1 = 0;
-  __pyx_t_17 = PyObject_Call(__pyx_t_19, ((PyObject *)__pyx_t_1), NULL); if (unlikely(!__pyx_t_17)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 340; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_17);
-  __Pyx_DECREF(__pyx_t_19); __pyx_t_19 = 0;
-  __Pyx_DECREF(((PyObject *)__pyx_t_1)); __pyx_t_1 = 0;
-  __pyx_t_1 = PyTuple_New(1); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 340; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_1));
-  PyTuple_SET_ITEM(__pyx_t_1, 0, __pyx_t_17);
-  __Pyx_GIVEREF(__pyx_t_17);
-  __pyx_t_17 = 0;
-  __pyx_t_17 = PyObject_Call(((PyObject *)((PyObject*)&PyList_Type)), ((PyObject *)__pyx_t_1), NULL); if (unlikely(!__pyx_t_17)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 340; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_17);
-  __Pyx_DECREF(((PyObject *)__pyx_t_1)); __pyx_t_1 = 0;
-  __pyx_t_1 = PyTuple_New(1); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 340; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_1));
-  PyTuple_SET_ITEM(__pyx_t_1, 0, __pyx_t_17);
-  __Pyx_GIVEREF(__pyx_t_17);
-  __pyx_t_17 = 0;
-  __pyx_t_17 = PyObject_Call(__pyx_t_18, ((PyObject *)__pyx_t_1), NULL); if (unlikely(!__pyx_t_17)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 340; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_17);
-  __Pyx_DECREF(__pyx_t_18); __pyx_t_18 = 0;
-  __Pyx_DECREF(((PyObject *)__pyx_t_1)); __pyx_t_1 = 0;
-  if (!(__Pyx_TypeTest(__pyx_t_17, __pyx_ptype_5numpy_ndarray))) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 340; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __pyx_t_22 = ((PyArrayObject *)__pyx_t_17);
-  {
-    __Pyx_BufFmt_StackElem __pyx_stack[1];
-    __Pyx_SafeReleaseBuffer(&__pyx_bstruct_d2);
-    __pyx_t_9 = __Pyx_GetBufferAndValidate(&__pyx_bstruct_d2, (PyObject*)__pyx_t_22, &__Pyx_TypeInfo_nn___pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_int_t, PyBUF_FORMAT| PyBUF_STRIDES, 2, 0, __pyx_stack);
-    if (unlikely(__pyx_t_9 < 0)) {
-      PyErr_Fetch(&__pyx_t_10, &__pyx_t_11, &__pyx_t_12);
-      if (unlikely(__Pyx_GetBufferAndValidate(&__pyx_bstruct_d2, (PyObject*)__pyx_v_d2, &__Pyx_TypeInfo_nn___pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_int_t, PyBUF_FORMAT| PyBUF_STRIDES, 2, 0, __pyx_stack) == -1)) {
-        Py_XDECREF(__pyx_t_10); Py_XDECREF(__pyx_t_11); Py_XDECREF(__pyx_t_12);
-        __Pyx_RaiseBufferFallbackError();
-      } else {
-        PyErr_Restore(__pyx_t_10, __pyx_t_11, __pyx_t_12);
-      }
-    }
-    __pyx_bstride_0_d2 = __pyx_bstruct_d2.strides[0]; __pyx_bstride_1_d2 = __pyx_bstruct_d2.strides[1];
-    __pyx_bshape_0_d2 = __pyx_bstruct_d2.shape[0]; __pyx_bshape_1_d2 = __pyx_bstruct_d2.shape[1];
-    if (unlikely(__pyx_t_9 < 0)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 340; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  }
-  __pyx_t_22 = 0;
-  __Pyx_DECREF(((PyObject *)__pyx_v_d2));
-  __pyx_v_d2 = ((PyArrayObject *)__pyx_t_17);
-  __pyx_t_17 = 0;
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":342
- *     d2 = np.array(list(c[2].difference(union[2])))
- * 
- *     ds2 = d2.shape[0]             # <<<<<<<<<<<<<<
- *     ds3 = d3.shape[0]
- *     ds4 = d4.shape[0]
- */
-  __pyx_v_ds2 = (__pyx_v_d2->dimensions[0]);
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":343
- * 
- *     ds2 = d2.shape[0]
- *     ds3 = d3.shape[0]             # <<<<<<<<<<<<<<
- *     ds4 = d4.shape[0]
- * 
- */
-  __pyx_v_ds3 = (__pyx_v_d3->dimensions[0]);
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":344
- *     ds2 = d2.shape[0]
- *     ds3 = d3.shape[0]
- *     ds4 = d4.shape[0]             # <<<<<<<<<<<<<<
- * 
- *     ss0 = strides[0]
- */
-  __pyx_v_ds4 = (__pyx_v_d4->dimensions[0]);
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":346
- *     ds4 = d4.shape[0]
- * 
- *     ss0 = strides[0]             # <<<<<<<<<<<<<<
- *     ss1 = strides[1]
- *     ss2 = strides[2]
- */
-  __pyx_3 = __Pyx_GetItemInt(__pyx_v_strides, 0, sizeof(long), PyInt_FromLong); if (!__pyx_3) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 346; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_3);
-  __pyx_t_23 = __Pyx_PyInt_AsLong(__pyx_3); if (unlikely((__pyx_t_23 == (long)-1) && PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 346; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_DECREF(__pyx_3); __pyx_3 = 0;
-  __pyx_v_ss0 = __pyx_t_23;
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":347
- * 
- *     ss0 = strides[0]
- *     ss1 = strides[1]             # <<<<<<<<<<<<<<
- *     ss2 = strides[2]
- * 
- */
-  __pyx_2 = __Pyx_GetItemInt(__pyx_v_strides, 1, sizeof(long), PyInt_FromLong); if (!__pyx_2) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 347; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_2);
-  __pyx_t_23 = __Pyx_PyInt_AsLong(__pyx_2); if (unlikely((__pyx_t_23 == (long)-1) && PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 347; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_DECREF(__pyx_2); __pyx_2 = 0;
-  __pyx_v_ss1 = __pyx_t_23;
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":348
- *     ss0 = strides[0]
- *     ss1 = strides[1]
- *     ss2 = strides[2]             # <<<<<<<<<<<<<<
- * 
- *     nvox = s0*s1*s2
- */
-  __pyx_1 = __Pyx_GetItemInt(__pyx_v_strides, 2, sizeof(long), PyInt_FromLong); if (!__pyx_1) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 348; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_1);
-  __pyx_t_23 = __Pyx_PyInt_AsLong(__pyx_1); if (unlikely((__pyx_t_23 == (long)-1) && PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 348; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_DECREF(__pyx_1); __pyx_1 = 0;
-  __pyx_v_ss2 = __pyx_t_23;
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":350
- *     ss2 = strides[2]
- * 
- *     nvox = s0*s1*s2             # <<<<<<<<<<<<<<
- * 
- *     for i in range(s0-1):
- */
-  __pyx_v_nvox = ((__pyx_v_s0 * __pyx_v_s1) * __pyx_v_s2);
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":352
- *     nvox = s0*s1*s2
- * 
- *     for i in range(s0-1):             # <<<<<<<<<<<<<<
- *         for j in range(s1-1):
- *             for k in range(s2-1):
- */
-  for (__pyx_t_23 = 0; __pyx_t_23 < (__pyx_v_s0 - 1); __pyx_t_23+=1) {
-    __pyx_v_i = __pyx_t_23;
-
-    /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":353
- * 
- *     for i in range(s0-1):
- *         for j in range(s1-1):             # <<<<<<<<<<<<<<
- *             for k in range(s2-1):
- *                 index = i*ss0+j*ss1+k*ss2
- */
-    for (__pyx_t_24 = 0; __pyx_t_24 < (__pyx_v_s1 - 1); __pyx_t_24+=1) {
-      __pyx_v_j = __pyx_t_24;
-
-      /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":354
- *     for i in range(s0-1):
- *         for j in range(s1-1):
- *             for k in range(s2-1):             # <<<<<<<<<<<<<<
- *                 index = i*ss0+j*ss1+k*ss2
- *                 for l in range(ds4):
- */
-      for (__pyx_t_25 = 0; __pyx_t_25 < (__pyx_v_s2 - 1); __pyx_t_25+=1) {
-        __pyx_v_k = __pyx_t_25;
-
-        /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":355
- *         for j in range(s1-1):
- *             for k in range(s2-1):
- *                 index = i*ss0+j*ss1+k*ss2             # <<<<<<<<<<<<<<
- *                 for l in range(ds4):
- *                     v0 = index + d4[l,0]
- */
-        __pyx_v_index = (((__pyx_v_i * __pyx_v_ss0) + (__pyx_v_j * __pyx_v_ss1)) + (__pyx_v_k * __pyx_v_ss2));
-
-        /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":356
- *             for k in range(s2-1):
- *                 index = i*ss0+j*ss1+k*ss2
- *                 for l in range(ds4):             # <<<<<<<<<<<<<<
- *                     v0 = index + d4[l,0]
- *                     m = fmask[v0]
- */
-        for (__pyx_t_26 = 0; __pyx_t_26 < __pyx_v_ds4; __pyx_t_26+=1) {
-          __pyx_v_l = __pyx_t_26;
-
-          /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":357
- *                 index = i*ss0+j*ss1+k*ss2
- *                 for l in range(ds4):
- *                     v0 = index + d4[l,0]             # <<<<<<<<<<<<<<
- *                     m = fmask[v0]
- *                     if m:
- */
-          __pyx_t_27 = __pyx_v_l;
-          __pyx_t_28 = 0;
-          __pyx_t_9 = -1;
-          if (__pyx_t_27 < 0) {
-            __pyx_t_27 += __pyx_bshape_0_d4;
-            if (unlikely(__pyx_t_27 < 0)) __pyx_t_9 = 0;
-          } else if (unlikely(__pyx_t_27 >= __pyx_bshape_0_d4)) __pyx_t_9 = 0;
-          if (__pyx_t_28 < 0) {
-            __pyx_t_28 += __pyx_bshape_1_d4;
-            if (unlikely(__pyx_t_28 < 0)) __pyx_t_9 = 1;
-          } else if (unlikely(__pyx_t_28 >= __pyx_bshape_1_d4)) __pyx_t_9 = 1;
-          if (unlikely(__pyx_t_9 != -1)) {
-            __Pyx_RaiseBufferIndexError(__pyx_t_9);
-            {__pyx_filename = __pyx_f[0]; __pyx_lineno = 357; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-          }
-          __pyx_v_v0 = (__pyx_v_index + (*__Pyx_BufPtrStrided2d(__pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_int_t *, __pyx_bstruct_d4.buf, __pyx_t_27, __pyx_bstride_0_d4, __pyx_t_28, __pyx_bstride_1_d4)));
-
-          /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":358
- *                 for l in range(ds4):
- *                     v0 = index + d4[l,0]
- *                     m = fmask[v0]             # <<<<<<<<<<<<<<
- *                     if m:
- *                         v1 = index + d4[l,1]
- */
-          __pyx_t_29 = __pyx_v_v0;
-          __pyx_t_9 = -1;
-          if (__pyx_t_29 < 0) {
-            __pyx_t_29 += __pyx_bshape_0_fmask;
-            if (unlikely(__pyx_t_29 < 0)) __pyx_t_9 = 0;
-          } else if (unlikely(__pyx_t_29 >= __pyx_bshape_0_fmask)) __pyx_t_9 = 0;
-          if (unlikely(__pyx_t_9 != -1)) {
-            __Pyx_RaiseBufferIndexError(__pyx_t_9);
-            {__pyx_filename = __pyx_f[0]; __pyx_lineno = 358; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-          }
-          __pyx_v_m = (*__Pyx_BufPtrStrided1d(__pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_int_t *, __pyx_bstruct_fmask.buf, __pyx_t_29, __pyx_bstride_0_fmask));
-
-          /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":359
- *                     v0 = index + d4[l,0]
- *                     m = fmask[v0]
- *                     if m:             # <<<<<<<<<<<<<<
- *                         v1 = index + d4[l,1]
- *                         v2 = index + d4[l,2]
- */
-          __pyx_t_30 = __pyx_v_m;
-          if (__pyx_t_30) {
-
-            /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":360
- *                     m = fmask[v0]
- *                     if m:
- *                         v1 = index + d4[l,1]             # <<<<<<<<<<<<<<
- *                         v2 = index + d4[l,2]
- *                         v3 = index + d4[l,3]
- */
-            __pyx_t_30 = __pyx_v_l;
-            __pyx_t_31 = 1;
-            __pyx_t_9 = -1;
-            if (__pyx_t_30 < 0) {
-              __pyx_t_30 += __pyx_bshape_0_d4;
-              if (unlikely(__pyx_t_30 < 0)) __pyx_t_9 = 0;
-            } else if (unlikely(__pyx_t_30 >= __pyx_bshape_0_d4)) __pyx_t_9 = 0;
-            if (__pyx_t_31 < 0) {
-              __pyx_t_31 += __pyx_bshape_1_d4;
-              if (unlikely(__pyx_t_31 < 0)) __pyx_t_9 = 1;
-            } else if (unlikely(__pyx_t_31 >= __pyx_bshape_1_d4)) __pyx_t_9 = 1;
-            if (unlikely(__pyx_t_9 != -1)) {
-              __Pyx_RaiseBufferIndexError(__pyx_t_9);
-              {__pyx_filename = __pyx_f[0]; __pyx_lineno = 360; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            }
-            __pyx_v_v1 = (__pyx_v_index + (*__Pyx_BufPtrStrided2d(__pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_int_t *, __pyx_bstruct_d4.buf, __pyx_t_30, __pyx_bstride_0_d4, __pyx_t_31, __pyx_bstride_1_d4)));
-
-            /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":361
- *                     if m:
- *                         v1 = index + d4[l,1]
- *                         v2 = index + d4[l,2]             # <<<<<<<<<<<<<<
- *                         v3 = index + d4[l,3]
- *                         m = m * fmask[v1] * fmask[v2] * fmask[v3]
- */
-            __pyx_t_32 = __pyx_v_l;
-            __pyx_t_33 = 2;
-            __pyx_t_9 = -1;
-            if (__pyx_t_32 < 0) {
-              __pyx_t_32 += __pyx_bshape_0_d4;
-              if (unlikely(__pyx_t_32 < 0)) __pyx_t_9 = 0;
-            } else if (unlikely(__pyx_t_32 >= __pyx_bshape_0_d4)) __pyx_t_9 = 0;
-            if (__pyx_t_33 < 0) {
-              __pyx_t_33 += __pyx_bshape_1_d4;
-              if (unlikely(__pyx_t_33 < 0)) __pyx_t_9 = 1;
-            } else if (unlikely(__pyx_t_33 >= __pyx_bshape_1_d4)) __pyx_t_9 = 1;
-            if (unlikely(__pyx_t_9 != -1)) {
-              __Pyx_RaiseBufferIndexError(__pyx_t_9);
-              {__pyx_filename = __pyx_f[0]; __pyx_lineno = 361; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            }
-            __pyx_v_v2 = (__pyx_v_index + (*__Pyx_BufPtrStrided2d(__pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_int_t *, __pyx_bstruct_d4.buf, __pyx_t_32, __pyx_bstride_0_d4, __pyx_t_33, __pyx_bstride_1_d4)));
-
-            /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":362
- *                         v1 = index + d4[l,1]
- *                         v2 = index + d4[l,2]
- *                         v3 = index + d4[l,3]             # <<<<<<<<<<<<<<
- *                         m = m * fmask[v1] * fmask[v2] * fmask[v3]
- *                         l0 = l0 - m
- */
-            __pyx_t_34 = __pyx_v_l;
-            __pyx_t_35 = 3;
-            __pyx_t_9 = -1;
-            if (__pyx_t_34 < 0) {
-              __pyx_t_34 += __pyx_bshape_0_d4;
-              if (unlikely(__pyx_t_34 < 0)) __pyx_t_9 = 0;
-            } else if (unlikely(__pyx_t_34 >= __pyx_bshape_0_d4)) __pyx_t_9 = 0;
-            if (__pyx_t_35 < 0) {
-              __pyx_t_35 += __pyx_bshape_1_d4;
-              if (unlikely(__pyx_t_35 < 0)) __pyx_t_9 = 1;
-            } else if (unlikely(__pyx_t_35 >= __pyx_bshape_1_d4)) __pyx_t_9 = 1;
-            if (unlikely(__pyx_t_9 != -1)) {
-              __Pyx_RaiseBufferIndexError(__pyx_t_9);
-              {__pyx_filename = __pyx_f[0]; __pyx_lineno = 362; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            }
-            __pyx_v_v3 = (__pyx_v_index + (*__Pyx_BufPtrStrided2d(__pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_int_t *, __pyx_bstruct_d4.buf, __pyx_t_34, __pyx_bstride_0_d4, __pyx_t_35, __pyx_bstride_1_d4)));
-
-            /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":363
- *                         v2 = index + d4[l,2]
- *                         v3 = index + d4[l,3]
- *                         m = m * fmask[v1] * fmask[v2] * fmask[v3]             # <<<<<<<<<<<<<<
- *                         l0 = l0 - m
- * 
- */
-            __pyx_t_36 = __pyx_v_v1;
-            __pyx_t_9 = -1;
-            if (__pyx_t_36 < 0) {
-              __pyx_t_36 += __pyx_bshape_0_fmask;
-              if (unlikely(__pyx_t_36 < 0)) __pyx_t_9 = 0;
-            } else if (unlikely(__pyx_t_36 >= __pyx_bshape_0_fmask)) __pyx_t_9 = 0;
-            if (unlikely(__pyx_t_9 != -1)) {
-              __Pyx_RaiseBufferIndexError(__pyx_t_9);
-              {__pyx_filename = __pyx_f[0]; __pyx_lineno = 363; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            }
-            __pyx_t_37 = __pyx_v_v2;
-            __pyx_t_9 = -1;
-            if (__pyx_t_37 < 0) {
-              __pyx_t_37 += __pyx_bshape_0_fmask;
-              if (unlikely(__pyx_t_37 < 0)) __pyx_t_9 = 0;
-            } else if (unlikely(__pyx_t_37 >= __pyx_bshape_0_fmask)) __pyx_t_9 = 0;
-            if (unlikely(__pyx_t_9 != -1)) {
-              __Pyx_RaiseBufferIndexError(__pyx_t_9);
-              {__pyx_filename = __pyx_f[0]; __pyx_lineno = 363; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            }
-            __pyx_t_38 = __pyx_v_v3;
-            __pyx_t_9 = -1;
-            if (__pyx_t_38 < 0) {
-              __pyx_t_38 += __pyx_bshape_0_fmask;
-              if (unlikely(__pyx_t_38 < 0)) __pyx_t_9 = 0;
-            } else if (unlikely(__pyx_t_38 >= __pyx_bshape_0_fmask)) __pyx_t_9 = 0;
-            if (unlikely(__pyx_t_9 != -1)) {
-              __Pyx_RaiseBufferIndexError(__pyx_t_9);
-              {__pyx_filename = __pyx_f[0]; __pyx_lineno = 363; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            }
-            __pyx_v_m = (((__pyx_v_m * (*__Pyx_BufPtrStrided1d(__pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_int_t *, __pyx_bstruct_fmask.buf, __pyx_t_36, __pyx_bstride_0_fmask))) * (*__Pyx_BufPtrStrided1d(__pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_int_t *, __pyx_bstruct_fmask.buf, __pyx_t_37, __pyx_bstride_0_fmask))) * (*__Pyx_BufPtrStrided1d(__pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_int_t *, __pyx_bstruct_fmask.buf, __pyx_t_38, __pyx_bstride_0_fmask)));
-
-            /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":364
- *                         v3 = index + d4[l,3]
- *                         m = m * fmask[v1] * fmask[v2] * fmask[v3]
- *                         l0 = l0 - m             # <<<<<<<<<<<<<<
- * 
- *                 for l in range(ds3):
- */
-            __pyx_v_l0 = (__pyx_v_l0 - __pyx_v_m);
-            goto __pyx_L14;
-          }
-          __pyx_L14:;
-        }
-
-        /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":366
- *                         l0 = l0 - m
- * 
- *                 for l in range(ds3):             # <<<<<<<<<<<<<<
- *                     v0 = index + d3[l,0]
- *                     m = fmask[v0]
- */
-        for (__pyx_t_26 = 0; __pyx_t_26 < __pyx_v_ds3; __pyx_t_26+=1) {
-          __pyx_v_l = __pyx_t_26;
-
-          /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":367
- * 
- *                 for l in range(ds3):
- *                     v0 = index + d3[l,0]             # <<<<<<<<<<<<<<
- *                     m = fmask[v0]
- *                     if m:
- */
-          __pyx_t_39 = __pyx_v_l;
-          __pyx_t_40 = 0;
-          __pyx_t_9 = -1;
-          if (__pyx_t_39 < 0) {
-            __pyx_t_39 += __pyx_bshape_0_d3;
-            if (unlikely(__pyx_t_39 < 0)) __pyx_t_9 = 0;
-          } else if (unlikely(__pyx_t_39 >= __pyx_bshape_0_d3)) __pyx_t_9 = 0;
-          if (__pyx_t_40 < 0) {
-            __pyx_t_40 += __pyx_bshape_1_d3;
-            if (unlikely(__pyx_t_40 < 0)) __pyx_t_9 = 1;
-          } else if (unlikely(__pyx_t_40 >= __pyx_bshape_1_d3)) __pyx_t_9 = 1;
-          if (unlikely(__pyx_t_9 != -1)) {
-            __Pyx_RaiseBufferIndexError(__pyx_t_9);
-            {__pyx_filename = __pyx_f[0]; __pyx_lineno = 367; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-          }
-          __pyx_v_v0 = (__pyx_v_index + (*__Pyx_BufPtrStrided2d(__pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_int_t *, __pyx_bstruct_d3.buf, __pyx_t_39, __pyx_bstride_0_d3, __pyx_t_40, __pyx_bstride_1_d3)));
-
-          /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":368
- *                 for l in range(ds3):
- *                     v0 = index + d3[l,0]
- *                     m = fmask[v0]             # <<<<<<<<<<<<<<
- *                     if m:
- *                         v1 = index + d3[l,1]
- */
-          __pyx_t_41 = __pyx_v_v0;
-          __pyx_t_9 = -1;
-          if (__pyx_t_41 < 0) {
-            __pyx_t_41 += __pyx_bshape_0_fmask;
-            if (unlikely(__pyx_t_41 < 0)) __pyx_t_9 = 0;
-          } else if (unlikely(__pyx_t_41 >= __pyx_bshape_0_fmask)) __pyx_t_9 = 0;
-          if (unlikely(__pyx_t_9 != -1)) {
-            __Pyx_RaiseBufferIndexError(__pyx_t_9);
-            {__pyx_filename = __pyx_f[0]; __pyx_lineno = 368; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-          }
-          __pyx_v_m = (*__Pyx_BufPtrStrided1d(__pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_int_t *, __pyx_bstruct_fmask.buf, __pyx_t_41, __pyx_bstride_0_fmask));
-
-          /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":369
- *                     v0 = index + d3[l,0]
- *                     m = fmask[v0]
- *                     if m:             # <<<<<<<<<<<<<<
- *                         v1 = index + d3[l,1]
- *                         v2 = index + d3[l,2]
- */
-          __pyx_t_42 = __pyx_v_m;
-          if (__pyx_t_42) {
-
-            /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":370
- *                     m = fmask[v0]
- *                     if m:
- *                         v1 = index + d3[l,1]             # <<<<<<<<<<<<<<
- *                         v2 = index + d3[l,2]
- *                         m = m * fmask[v1] * fmask[v2]
- */
-            __pyx_t_42 = __pyx_v_l;
-            __pyx_t_43 = 1;
-            __pyx_t_9 = -1;
-            if (__pyx_t_42 < 0) {
-              __pyx_t_42 += __pyx_bshape_0_d3;
-              if (unlikely(__pyx_t_42 < 0)) __pyx_t_9 = 0;
-            } else if (unlikely(__pyx_t_42 >= __pyx_bshape_0_d3)) __pyx_t_9 = 0;
-            if (__pyx_t_43 < 0) {
-              __pyx_t_43 += __pyx_bshape_1_d3;
-              if (unlikely(__pyx_t_43 < 0)) __pyx_t_9 = 1;
-            } else if (unlikely(__pyx_t_43 >= __pyx_bshape_1_d3)) __pyx_t_9 = 1;
-            if (unlikely(__pyx_t_9 != -1)) {
-              __Pyx_RaiseBufferIndexError(__pyx_t_9);
-              {__pyx_filename = __pyx_f[0]; __pyx_lineno = 370; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            }
-            __pyx_v_v1 = (__pyx_v_index + (*__Pyx_BufPtrStrided2d(__pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_int_t *, __pyx_bstruct_d3.buf, __pyx_t_42, __pyx_bstride_0_d3, __pyx_t_43, __pyx_bstride_1_d3)));
-
-            /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":371
- *                     if m:
- *                         v1 = index + d3[l,1]
- *                         v2 = index + d3[l,2]             # <<<<<<<<<<<<<<
- *                         m = m * fmask[v1] * fmask[v2]
- *                         l0 = l0 + m
- */
-            __pyx_t_44 = __pyx_v_l;
-            __pyx_t_45 = 2;
-            __pyx_t_9 = -1;
-            if (__pyx_t_44 < 0) {
-              __pyx_t_44 += __pyx_bshape_0_d3;
-              if (unlikely(__pyx_t_44 < 0)) __pyx_t_9 = 0;
-            } else if (unlikely(__pyx_t_44 >= __pyx_bshape_0_d3)) __pyx_t_9 = 0;
-            if (__pyx_t_45 < 0) {
-              __pyx_t_45 += __pyx_bshape_1_d3;
-              if (unlikely(__pyx_t_45 < 0)) __pyx_t_9 = 1;
-            } else if (unlikely(__pyx_t_45 >= __pyx_bshape_1_d3)) __pyx_t_9 = 1;
-            if (unlikely(__pyx_t_9 != -1)) {
-              __Pyx_RaiseBufferIndexError(__pyx_t_9);
-              {__pyx_filename = __pyx_f[0]; __pyx_lineno = 371; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            }
-            __pyx_v_v2 = (__pyx_v_index + (*__Pyx_BufPtrStrided2d(__pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_int_t *, __pyx_bstruct_d3.buf, __pyx_t_44, __pyx_bstride_0_d3, __pyx_t_45, __pyx_bstride_1_d3)));
-
-            /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":372
- *                         v1 = index + d3[l,1]
- *                         v2 = index + d3[l,2]
- *                         m = m * fmask[v1] * fmask[v2]             # <<<<<<<<<<<<<<
- *                         l0 = l0 + m
- * 
- */
-            __pyx_t_46 = __pyx_v_v1;
-            __pyx_t_9 = -1;
-            if (__pyx_t_46 < 0) {
-              __pyx_t_46 += __pyx_bshape_0_fmask;
-              if (unlikely(__pyx_t_46 < 0)) __pyx_t_9 = 0;
-            } else if (unlikely(__pyx_t_46 >= __pyx_bshape_0_fmask)) __pyx_t_9 = 0;
-            if (unlikely(__pyx_t_9 != -1)) {
-              __Pyx_RaiseBufferIndexError(__pyx_t_9);
-              {__pyx_filename = __pyx_f[0]; __pyx_lineno = 372; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            }
-            __pyx_t_47 = __pyx_v_v2;
-            __pyx_t_9 = -1;
-            if (__pyx_t_47 < 0) {
-              __pyx_t_47 += __pyx_bshape_0_fmask;
-              if (unlikely(__pyx_t_47 < 0)) __pyx_t_9 = 0;
-            } else if (unlikely(__pyx_t_47 >= __pyx_bshape_0_fmask)) __pyx_t_9 = 0;
-            if (unlikely(__pyx_t_9 != -1)) {
-              __Pyx_RaiseBufferIndexError(__pyx_t_9);
-              {__pyx_filename = __pyx_f[0]; __pyx_lineno = 372; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            }
-            __pyx_v_m = ((__pyx_v_m * (*__Pyx_BufPtrStrided1d(__pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_int_t *, __pyx_bstruct_fmask.buf, __pyx_t_46, __pyx_bstride_0_fmask))) * (*__Pyx_BufPtrStrided1d(__pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_int_t *, __pyx_bstruct_fmask.buf, __pyx_t_47, __pyx_bstride_0_fmask)));
-
-            /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":373
- *                         v2 = index + d3[l,2]
- *                         m = m * fmask[v1] * fmask[v2]
- *                         l0 = l0 + m             # <<<<<<<<<<<<<<
- * 
- *                 for l in range(ds2):
- */
-            __pyx_v_l0 = (__pyx_v_l0 + __pyx_v_m);
-            goto __pyx_L17;
-          }
-          __pyx_L17:;
-        }
-
-        /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":375
- *                         l0 = l0 + m
- * 
- *                 for l in range(ds2):             # <<<<<<<<<<<<<<
- *                     v0 = index + d2[l,0]
- *                     m = fmask[v0]
- */
-        for (__pyx_t_26 = 0; __pyx_t_26 < __pyx_v_ds2; __pyx_t_26+=1) {
-          __pyx_v_l = __pyx_t_26;
-
-          /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":376
- * 
- *                 for l in range(ds2):
- *                     v0 = index + d2[l,0]             # <<<<<<<<<<<<<<
- *                     m = fmask[v0]
- *                     if m:
- */
-          __pyx_t_48 = __pyx_v_l;
-          __pyx_t_49 = 0;
-          __pyx_t_9 = -1;
-          if (__pyx_t_48 < 0) {
-            __pyx_t_48 += __pyx_bshape_0_d2;
-            if (unlikely(__pyx_t_48 < 0)) __pyx_t_9 = 0;
-          } else if (unlikely(__pyx_t_48 >= __pyx_bshape_0_d2)) __pyx_t_9 = 0;
-          if (__pyx_t_49 < 0) {
-            __pyx_t_49 += __pyx_bshape_1_d2;
-            if (unlikely(__pyx_t_49 < 0)) __pyx_t_9 = 1;
-          } else if (unlikely(__pyx_t_49 >= __pyx_bshape_1_d2)) __pyx_t_9 = 1;
-          if (unlikely(__pyx_t_9 != -1)) {
-            __Pyx_RaiseBufferIndexError(__pyx_t_9);
-            {__pyx_filename = __pyx_f[0]; __pyx_lineno = 376; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-          }
-          __pyx_v_v0 = (__pyx_v_index + (*__Pyx_BufPtrStrided2d(__pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_int_t *, __pyx_bstruct_d2.buf, __pyx_t_48, __pyx_bstride_0_d2, __pyx_t_49, __pyx_bstride_1_d2)));
-
-          /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":377
- *                 for l in range(ds2):
- *                     v0 = index + d2[l,0]
- *                     m = fmask[v0]             # <<<<<<<<<<<<<<
- *                     if m:
- *                         v1 = index + d2[l,1]
- */
-          __pyx_t_50 = __pyx_v_v0;
-          __pyx_t_9 = -1;
-          if (__pyx_t_50 < 0) {
-            __pyx_t_50 += __pyx_bshape_0_fmask;
-            if (unlikely(__pyx_t_50 < 0)) __pyx_t_9 = 0;
-          } else if (unlikely(__pyx_t_50 >= __pyx_bshape_0_fmask)) __pyx_t_9 = 0;
-          if (unlikely(__pyx_t_9 != -1)) {
-            __Pyx_RaiseBufferIndexError(__pyx_t_9);
-            {__pyx_filename = __pyx_f[0]; __pyx_lineno = 377; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-          }
-          __pyx_v_m = (*__Pyx_BufPtrStrided1d(__pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_int_t *, __pyx_bstruct_fmask.buf, __pyx_t_50, __pyx_bstride_0_fmask));
-
-          /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":378
- *                     v0 = index + d2[l,0]
- *                     m = fmask[v0]
- *                     if m:             # <<<<<<<<<<<<<<
- *                         v1 = index + d2[l,1]
- *                         m = m * fmask[v1]
- */
-          __pyx_t_51 = __pyx_v_m;
-          if (__pyx_t_51) {
-
-            /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":379
- *                     m = fmask[v0]
- *                     if m:
- *                         v1 = index + d2[l,1]             # <<<<<<<<<<<<<<
- *                         m = m * fmask[v1]
- *                         l0 = l0 - m
- */
-            __pyx_t_51 = __pyx_v_l;
-            __pyx_t_52 = 1;
-            __pyx_t_9 = -1;
-            if (__pyx_t_51 < 0) {
-              __pyx_t_51 += __pyx_bshape_0_d2;
-              if (unlikely(__pyx_t_51 < 0)) __pyx_t_9 = 0;
-            } else if (unlikely(__pyx_t_51 >= __pyx_bshape_0_d2)) __pyx_t_9 = 0;
-            if (__pyx_t_52 < 0) {
-              __pyx_t_52 += __pyx_bshape_1_d2;
-              if (unlikely(__pyx_t_52 < 0)) __pyx_t_9 = 1;
-            } else if (unlikely(__pyx_t_52 >= __pyx_bshape_1_d2)) __pyx_t_9 = 1;
-            if (unlikely(__pyx_t_9 != -1)) {
-              __Pyx_RaiseBufferIndexError(__pyx_t_9);
-              {__pyx_filename = __pyx_f[0]; __pyx_lineno = 379; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            }
-            __pyx_v_v1 = (__pyx_v_index + (*__Pyx_BufPtrStrided2d(__pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_int_t *, __pyx_bstruct_d2.buf, __pyx_t_51, __pyx_bstride_0_d2, __pyx_t_52, __pyx_bstride_1_d2)));
-
-            /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":380
- *                     if m:
- *                         v1 = index + d2[l,1]
- *                         m = m * fmask[v1]             # <<<<<<<<<<<<<<
- *                         l0 = l0 - m
- *     l0 += mask.sum()
- */
-            __pyx_t_53 = __pyx_v_v1;
-            __pyx_t_9 = -1;
-            if (__pyx_t_53 < 0) {
-              __pyx_t_53 += __pyx_bshape_0_fmask;
-              if (unlikely(__pyx_t_53 < 0)) __pyx_t_9 = 0;
-            } else if (unlikely(__pyx_t_53 >= __pyx_bshape_0_fmask)) __pyx_t_9 = 0;
-            if (unlikely(__pyx_t_9 != -1)) {
-              __Pyx_RaiseBufferIndexError(__pyx_t_9);
-              {__pyx_filename = __pyx_f[0]; __pyx_lineno = 380; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            }
-            __pyx_v_m = (__pyx_v_m * (*__Pyx_BufPtrStrided1d(__pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_int_t *, __pyx_bstruct_fmask.buf, __pyx_t_53, __pyx_bstride_0_fmask)));
-
-            /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":381
- *                         v1 = index + d2[l,1]
- *                         m = m * fmask[v1]
- *                         l0 = l0 - m             # <<<<<<<<<<<<<<
- *     l0 += mask.sum()
- *     return l0
- */
-            __pyx_v_l0 = (__pyx_v_l0 - __pyx_v_m);
-            goto __pyx_L20;
-          }
-          __pyx_L20:;
-        }
-      }
-    }
-  }
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":382
- *                         m = m * fmask[v1]
- *                         l0 = l0 - m
- *     l0 += mask.sum()             # <<<<<<<<<<<<<<
- *     return l0
- * 
- */
-  __pyx_t_17 = PyObject_GetAttr(__pyx_v_mask, __pyx_kp_sum); if (unlikely(!__pyx_t_17)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 382; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_17);
-  __pyx_t_1 = PyObject_Call(__pyx_t_17, ((PyObject *)__pyx_empty_tuple), NULL); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 382; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_1);
-  __Pyx_DECREF(__pyx_t_17); __pyx_t_17 = 0;
-  __pyx_t_23 = __Pyx_PyInt_AsLong(__pyx_t_1); if (unlikely((__pyx_t_23 == (long)-1) && PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 382; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-  __pyx_v_l0 += __pyx_t_23;
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":383
- *                         l0 = l0 - m
- *     l0 += mask.sum()
- *     return l0             # <<<<<<<<<<<<<<
- * 
- * def Lips3d(np.ndarray[DTYPE_float_t, ndim=4] coords,
- */
-  __Pyx_XDECREF(__pyx_r);
-  __pyx_t_1 = PyInt_FromLong(__pyx_v_l0); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 383; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_1);
-  __pyx_r = __pyx_t_1;
-  __pyx_t_1 = 0;
-  goto __pyx_L0;
-
-  __pyx_r = Py_None; __Pyx_INCREF(Py_None);
-  goto __pyx_L0;
-  __pyx_L1_error:;
-  __Pyx_XDECREF(__pyx_1);
-  __Pyx_XDECREF(__pyx_2);
-  __Pyx_XDECREF(__pyx_3);
-  __Pyx_XDECREF(__pyx_t_1);
-  __Pyx_XDECREF(__pyx_t_2);
-  __Pyx_XDECREF(__pyx_t_3);
-  __Pyx_XDECREF(__pyx_t_6);
-  __Pyx_XDECREF(__pyx_t_7);
-  __Pyx_XDECREF(__pyx_t_17);
-  __Pyx_XDECREF(__pyx_t_18);
-  __Pyx_XDECREF(__pyx_t_19);
-  { PyObject *__pyx_type, *__pyx_value, *__pyx_tb;
-    __Pyx_ErrFetch(&__pyx_type, &__pyx_value, &__pyx_tb);
-    __Pyx_SafeReleaseBuffer(&__pyx_bstruct_mask);
-    __Pyx_SafeReleaseBuffer(&__pyx_bstruct_d4);
-    __Pyx_SafeReleaseBuffer(&__pyx_bstruct_d2);
-    __Pyx_SafeReleaseBuffer(&__pyx_bstruct_d3);
-    __Pyx_SafeReleaseBuffer(&__pyx_bstruct_pmask);
-    __Pyx_SafeReleaseBuffer(&__pyx_bstruct_fmask);
-  __Pyx_ErrRestore(__pyx_type, __pyx_value, __pyx_tb);}
-  __Pyx_AddTraceback("nipy.algorithms.statistics.intvol.EC3d");
-  __pyx_r = NULL;
-  goto __pyx_L2;
-  __pyx_L0:;
-  __Pyx_SafeReleaseBuffer(&__pyx_bstruct_mask);
-  __Pyx_SafeReleaseBuffer(&__pyx_bstruct_d4);
-  __Pyx_SafeReleaseBuffer(&__pyx_bstruct_d2);
-  __Pyx_SafeReleaseBuffer(&__pyx_bstruct_d3);
-  __Pyx_SafeReleaseBuffer(&__pyx_bstruct_pmask);
-  __Pyx_SafeReleaseBuffer(&__pyx_bstruct_fmask);
-  __pyx_L2:;
-  __Pyx_DECREF((PyObject *)__pyx_v_fmask);
-  __Pyx_DECREF((PyObject *)__pyx_v_d2);
-  __Pyx_DECREF((PyObject *)__pyx_v_d3);
-  __Pyx_DECREF((PyObject *)__pyx_v_d4);
-  __Pyx_DECREF((PyObject *)__pyx_v_pmask);
-  __Pyx_DECREF(__pyx_v_strides);
-  __Pyx_DECREF(__pyx_v_union);
-  __Pyx_DECREF(__pyx_v_c);
-  __Pyx_XGIVEREF(__pyx_r);
-  __Pyx_FinishRefcountContext();
-  return __pyx_r;
-}
-
-/* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":385
- *     return l0
- * 
- * def Lips3d(np.ndarray[DTYPE_float_t, ndim=4] coords,             # <<<<<<<<<<<<<<
- *           np.ndarray[DTYPE_int_t, ndim=3] mask):
- *     """
- */
-
-static PyObject *__pyx_pf_4nipy_10algorithms_10statistics_6intvol_Lips3d(PyObject *__pyx_self, PyObject *__pyx_args, PyObject *__pyx_kwds); /*proto*/
-static char __pyx_doc_4nipy_10algorithms_10statistics_6intvol_Lips3d[] = "\n    Given a 3d mask and coordinates, estimate the intrinsic volumes\n    of the masked region. The region is broken up into tetrahedra / \n    triangles / edges / vertices, which are included based on whether\n    all voxels in the tetrahedron / triangle / edge / vertex are\n    in the mask or not.\n\n    Parameters:\n    -----------\n\n    coords : ndarray((*,i,j,k))\n         Coordinates for the voxels in the mask\n\n    mask : ndarray((i,j,k), np.int)\n         Binary mask determining whether or not\n         a voxel is in the mask.\n\n    Outputs:\n    --------\n\n    mu : ndarray\n         Array of intrinsic volumes [mu0, mu1, mu2, mu3]\n\n    Notes:\n    ------\n\n    The array mask is assumed to be binary. At the time of \n    writing, it is not clear how to get cython to use np.bool\n    arrays.\n\n    The 3d cubes are triangulated into 6 tetrahedra of equal volume,\n    as described in the reference below.\n\n    References:\n    -----------\n\n    Taylor, J.E. & Worsley, K.J. (2007). \"Detecting sparse signal in random fields,\n      with an application to brain mapping.\"\n      Journal of the American Statistical Association, 102(479):913-928.\n\n    ";
-static PyObject *__pyx_pf_4nipy_10algorithms_10statistics_6intvol_Lips3d(PyObject *__pyx_self, PyObject *__pyx_args, PyObject *__pyx_kwds) {
-  PyArrayObject *__pyx_v_coords = 0;
-  PyArrayObject *__pyx_v_mask = 0;
-  PyArrayObject *__pyx_v_fcoords;
-  PyArrayObject *__pyx_v_D;
-  PyArrayObject *__pyx_v_fmask;
-  PyArrayObject *__pyx_v_fpmask;
-  PyArrayObject *__pyx_v_pmask;
-  PyArrayObject *__pyx_v_d4;
-  PyArrayObject *__pyx_v_m4;
-  PyArrayObject *__pyx_v_d3;
-  PyArrayObject *__pyx_v_m3;
-  PyArrayObject *__pyx_v_d2;
-  PyArrayObject *__pyx_v_m2;
-  PyArrayObject *__pyx_v_cvertices;
-  long __pyx_v_i;
-  long __pyx_v_j;
-  long __pyx_v_k;
-  long __pyx_v_l;
-  long __pyx_v_s0;
-  long __pyx_v_s1;
-  long __pyx_v_s2;
-  long __pyx_v_ds4;
-  long __pyx_v_ds3;
-  long __pyx_v_ds2;
-  long __pyx_v_index;
-  long __pyx_v_pindex;
-  long __pyx_v_m;
-  long __pyx_v_nvox;
-  long __pyx_v_r;
-  long __pyx_v_s;
-  long __pyx_v_rr;
-  long __pyx_v_ss;
-  long __pyx_v_mr;
-  long __pyx_v_ms;
-  long __pyx_v_ss0;
-  long __pyx_v_ss1;
-  long __pyx_v_ss2;
-  long __pyx_v_v0;
-  long __pyx_v_v1;
-  long __pyx_v_v2;
-  long __pyx_v_v3;
-  long __pyx_v_w0;
-  long __pyx_v_w1;
-  long __pyx_v_w2;
-  long __pyx_v_w3;
-  double __pyx_v_l0;
-  double __pyx_v_l1;
-  double __pyx_v_l2;
-  double __pyx_v_l3;
-  double __pyx_v_res;
-  PyObject *__pyx_v_n;
-  PyObject *__pyx_v_strides;
-  PyObject *__pyx_v_dstrides;
-  PyObject *__pyx_v_union;
-  PyObject *__pyx_v_c;
-  PyObject *__pyx_v_ss0d;
-  PyObject *__pyx_v_ss1d;
-  PyObject *__pyx_v_ss2d;
-  PyObject *__pyx_v_d;
-  Py_buffer __pyx_bstruct_fpmask;
-  Py_ssize_t __pyx_bstride_0_fpmask = 0;
-  Py_ssize_t __pyx_bshape_0_fpmask = 0;
-  Py_buffer __pyx_bstruct_d4;
-  Py_ssize_t __pyx_bstride_0_d4 = 0;
-  Py_ssize_t __pyx_bstride_1_d4 = 0;
-  Py_ssize_t __pyx_bshape_0_d4 = 0;
-  Py_ssize_t __pyx_bshape_1_d4 = 0;
-  Py_buffer __pyx_bstruct_d2;
-  Py_ssize_t __pyx_bstride_0_d2 = 0;
-  Py_ssize_t __pyx_bstride_1_d2 = 0;
-  Py_ssize_t __pyx_bshape_0_d2 = 0;
-  Py_ssize_t __pyx_bshape_1_d2 = 0;
-  Py_buffer __pyx_bstruct_d3;
-  Py_ssize_t __pyx_bstride_0_d3 = 0;
-  Py_ssize_t __pyx_bstride_1_d3 = 0;
-  Py_ssize_t __pyx_bshape_0_d3 = 0;
-  Py_ssize_t __pyx_bshape_1_d3 = 0;
-  Py_buffer __pyx_bstruct_cvertices;
-  Py_ssize_t __pyx_bstride_0_cvertices = 0;
-  Py_ssize_t __pyx_bshape_0_cvertices = 0;
-  Py_buffer __pyx_bstruct_m4;
-  Py_ssize_t __pyx_bstride_0_m4 = 0;
-  Py_ssize_t __pyx_bstride_1_m4 = 0;
-  Py_ssize_t __pyx_bshape_0_m4 = 0;
-  Py_ssize_t __pyx_bshape_1_m4 = 0;
-  Py_buffer __pyx_bstruct_m3;
-  Py_ssize_t __pyx_bstride_0_m3 = 0;
-  Py_ssize_t __pyx_bstride_1_m3 = 0;
-  Py_ssize_t __pyx_bshape_0_m3 = 0;
-  Py_ssize_t __pyx_bshape_1_m3 = 0;
-  Py_buffer __pyx_bstruct_m2;
-  Py_ssize_t __pyx_bstride_0_m2 = 0;
-  Py_ssize_t __pyx_bstride_1_m2 = 0;
-  Py_ssize_t __pyx_bshape_0_m2 = 0;
-  Py_ssize_t __pyx_bshape_1_m2 = 0;
-  Py_buffer __pyx_bstruct_pmask;
-  Py_ssize_t __pyx_bstride_0_pmask = 0;
-  Py_ssize_t __pyx_bstride_1_pmask = 0;
-  Py_ssize_t __pyx_bstride_2_pmask = 0;
-  Py_ssize_t __pyx_bshape_0_pmask = 0;
-  Py_ssize_t __pyx_bshape_1_pmask = 0;
-  Py_ssize_t __pyx_bshape_2_pmask = 0;
-  Py_buffer __pyx_bstruct_D;
-  Py_ssize_t __pyx_bstride_0_D = 0;
-  Py_ssize_t __pyx_bstride_1_D = 0;
-  Py_ssize_t __pyx_bshape_0_D = 0;
-  Py_ssize_t __pyx_bshape_1_D = 0;
-  Py_buffer __pyx_bstruct_mask;
-  Py_ssize_t __pyx_bstride_0_mask = 0;
-  Py_ssize_t __pyx_bstride_1_mask = 0;
-  Py_ssize_t __pyx_bstride_2_mask = 0;
-  Py_ssize_t __pyx_bshape_0_mask = 0;
-  Py_ssize_t __pyx_bshape_1_mask = 0;
-  Py_ssize_t __pyx_bshape_2_mask = 0;
-  Py_buffer __pyx_bstruct_fcoords;
-  Py_ssize_t __pyx_bstride_0_fcoords = 0;
-  Py_ssize_t __pyx_bstride_1_fcoords = 0;
-  Py_ssize_t __pyx_bshape_0_fcoords = 0;
-  Py_ssize_t __pyx_bshape_1_fcoords = 0;
-  Py_buffer __pyx_bstruct_coords;
-  Py_ssize_t __pyx_bstride_0_coords = 0;
-  Py_ssize_t __pyx_bstride_1_coords = 0;
-  Py_ssize_t __pyx_bstride_2_coords = 0;
-  Py_ssize_t __pyx_bstride_3_coords = 0;
-  Py_ssize_t __pyx_bshape_0_coords = 0;
-  Py_ssize_t __pyx_bshape_1_coords = 0;
-  Py_ssize_t __pyx_bshape_2_coords = 0;
-  Py_ssize_t __pyx_bshape_3_coords = 0;
-  Py_buffer __pyx_bstruct_fmask;
-  Py_ssize_t __pyx_bstride_0_fmask = 0;
-  Py_ssize_t __pyx_bshape_0_fmask = 0;
-  PyObject *__pyx_v_v;
-  PyObject *__pyx_r = NULL;
-  PyObject *__pyx_1 = 0;
-  PyObject *__pyx_2 = 0;
-  PyObject *__pyx_3 = 0;
-  PyObject *__pyx_t_1 = NULL;
-  PyObject *__pyx_t_2 = NULL;
-  PyObject *__pyx_t_3 = NULL;
-  int __pyx_t_4;
-  int __pyx_t_5;
-  PyObject *__pyx_t_6 = NULL;
-  PyObject *__pyx_t_7 = NULL;
-  PyArrayObject *__pyx_t_8 = NULL;
-  int __pyx_t_9;
-  PyObject *__pyx_t_10 = NULL;
-  PyObject *__pyx_t_11 = NULL;
-  PyObject *__pyx_t_12 = NULL;
-  npy_intp __pyx_t_13;
-  npy_intp __pyx_t_14;
-  npy_intp __pyx_t_15;
-  PyArrayObject *__pyx_t_16 = NULL;
-  PyArrayObject *__pyx_t_17 = NULL;
-  PyArrayObject *__pyx_t_18 = NULL;
-  long __pyx_t_19;
-  long __pyx_t_20;
-  long __pyx_t_21;
-  PyObject *__pyx_t_22 = NULL;
-  PyObject *__pyx_t_23 = NULL;
-  PyArrayObject *__pyx_t_24 = NULL;
-  PyObject *__pyx_t_25 = NULL;
-  PyArrayObject *__pyx_t_26 = NULL;
-  PyArrayObject *__pyx_t_27 = NULL;
-  PyArrayObject *__pyx_t_28 = NULL;
-  Py_ssize_t __pyx_t_29;
-  PyArrayObject *__pyx_t_30 = NULL;
-  PyArrayObject *__pyx_t_31 = NULL;
-  PyArrayObject *__pyx_t_32 = NULL;
-  PyArrayObject *__pyx_t_33 = NULL;
-  long __pyx_t_34;
-  long __pyx_t_35;
-  long __pyx_t_36;
-  long __pyx_t_37;
-  long __pyx_t_38;
-  long __pyx_t_39;
-  long __pyx_t_40;
-  long __pyx_t_41;
-  long __pyx_t_42;
-  long __pyx_t_43;
-  long __pyx_t_44;
-  long __pyx_t_45;
-  long __pyx_t_46;
-  long __pyx_t_47;
-  long __pyx_t_48;
-  long __pyx_t_49;
-  long __pyx_t_50;
-  long __pyx_t_51;
-  long __pyx_t_52;
-  long __pyx_t_53;
-  long __pyx_t_54;
-  long __pyx_t_55;
-  long __pyx_t_56;
-  long __pyx_t_57;
-  long __pyx_t_58;
-  long __pyx_t_59;
-  long __pyx_t_60;
-  long __pyx_t_61;
-  long __pyx_t_62;
-  long __pyx_t_63;
-  long __pyx_t_64;
-  long __pyx_t_65;
-  long __pyx_t_66;
-  long __pyx_t_67;
-  long __pyx_t_68;
-  long __pyx_t_69;
-  long __pyx_t_70;
-  long __pyx_t_71;
-  long __pyx_t_72;
-  long __pyx_t_73;
-  long __pyx_t_74;
-  long __pyx_t_75;
-  long __pyx_t_76;
-  long __pyx_t_77;
-  long __pyx_t_78;
-  long __pyx_t_79;
-  long __pyx_t_80;
-  long __pyx_t_81;
-  long __pyx_t_82;
-  long __pyx_t_83;
-  long __pyx_t_84;
-  long __pyx_t_85;
-  long __pyx_t_86;
-  PyObject *__pyx_t_87 = NULL;
-  long __pyx_t_88;
-  long __pyx_t_89;
-  PyObject *__pyx_t_90 = NULL;
-  long __pyx_t_91;
-  long __pyx_t_92;
-  PyObject *__pyx_t_93 = NULL;
-  PyObject *__pyx_t_94 = NULL;
-  long __pyx_t_95;
-  long __pyx_t_96;
-  long __pyx_t_97;
-  long __pyx_t_98;
-  long __pyx_t_99;
-  long __pyx_t_100;
-  long __pyx_t_101;
-  long __pyx_t_102;
-  long __pyx_t_103;
-  long __pyx_t_104;
-  long __pyx_t_105;
-  long __pyx_t_106;
-  long __pyx_t_107;
-  long __pyx_t_108;
-  long __pyx_t_109;
-  long __pyx_t_110;
-  long __pyx_t_111;
-  long __pyx_t_112;
-  long __pyx_t_113;
-  long __pyx_t_114;
-  PyObject *__pyx_t_115 = NULL;
-  double __pyx_t_116;
-  long __pyx_t_117;
-  long __pyx_t_118;
-  long __pyx_t_119;
-  long __pyx_t_120;
-  long __pyx_t_121;
-  long __pyx_t_122;
-  long __pyx_t_123;
-  long __pyx_t_124;
-  long __pyx_t_125;
-  long __pyx_t_126;
-  long __pyx_t_127;
-  long __pyx_t_128;
-  long __pyx_t_129;
-  long __pyx_t_130;
-  long __pyx_t_131;
-  long __pyx_t_132;
-  long __pyx_t_133;
-  long __pyx_t_134;
-  long __pyx_t_135;
-  long __pyx_t_136;
-  long __pyx_t_137;
-  long __pyx_t_138;
-  long __pyx_t_139;
-  long __pyx_t_140;
-  long __pyx_t_141;
-  long __pyx_t_142;
-  long __pyx_t_143;
-  long __pyx_t_144;
-  long __pyx_t_145;
-  long __pyx_t_146;
-  long __pyx_t_147;
-  long __pyx_t_148;
-  long __pyx_t_149;
-  long __pyx_t_150;
-  long __pyx_t_151;
-  long __pyx_t_152;
-  long __pyx_t_153;
-  long __pyx_t_154;
-  long __pyx_t_155;
-  long __pyx_t_156;
-  long __pyx_t_157;
-  long __pyx_t_158;
-  long __pyx_t_159;
-  long __pyx_t_160;
-  long __pyx_t_161;
-  long __pyx_t_162;
-  long __pyx_t_163;
-  long __pyx_t_164;
-  long __pyx_t_165;
-  long __pyx_t_166;
-  long __pyx_t_167;
-  long __pyx_t_168;
-  long __pyx_t_169;
-  long __pyx_t_170;
-  long __pyx_t_171;
-  long __pyx_t_172;
-  long __pyx_t_173;
-  long __pyx_t_174;
-  long __pyx_t_175;
-  long __pyx_t_176;
-  long __pyx_t_177;
-  long __pyx_t_178;
-  long __pyx_t_179;
-  long __pyx_t_180;
-  long __pyx_t_181;
-  long __pyx_t_182;
-  long __pyx_t_183;
-  long __pyx_t_184;
-  long __pyx_t_185;
-  long __pyx_t_186;
-  long __pyx_t_187;
-  long __pyx_t_188;
-  long __pyx_t_189;
-  long __pyx_t_190;
-  long __pyx_t_191;
-  long __pyx_t_192;
-  long __pyx_t_193;
-  long __pyx_t_194;
-  long __pyx_t_195;
-  long __pyx_t_196;
-  long __pyx_t_197;
-  long __pyx_t_198;
-  long __pyx_t_199;
-  long __pyx_t_200;
-  long __pyx_t_201;
-  long __pyx_t_202;
-  long __pyx_t_203;
-  long __pyx_t_204;
-  long __pyx_t_205;
-  long __pyx_t_206;
-  long __pyx_t_207;
-  long __pyx_t_208;
-  long __pyx_t_209;
-  long __pyx_t_210;
-  long __pyx_t_211;
-  static PyObject **__pyx_pyargnames[] = {&__pyx_kp_coords,&__pyx_kp_mask,0};
-  __Pyx_SetupRefcountContext("Lips3d");
-  __pyx_self = __pyx_self;
-  if (unlikely(__pyx_kwds)) {
-    Py_ssize_t kw_args = PyDict_Size(__pyx_kwds);
-    PyObject* values[2] = {0,0};
-    switch (PyTuple_GET_SIZE(__pyx_args)) {
-      case  2: values[1] = PyTuple_GET_ITEM(__pyx_args, 1);
-      case  1: values[0] = PyTuple_GET_ITEM(__pyx_args, 0);
-      case  0: break;
-      default: goto __pyx_L5_argtuple_error;
-    }
-    switch (PyTuple_GET_SIZE(__pyx_args)) {
-      case  0:
-      values[0] = PyDict_GetItem(__pyx_kwds, __pyx_kp_coords);
-      if (likely(values[0])) kw_args--;
-      else goto __pyx_L5_argtuple_error;
-      case  1:
-      values[1] = PyDict_GetItem(__pyx_kwds, __pyx_kp_mask);
-      if (likely(values[1])) kw_args--;
-      else {
-        __Pyx_RaiseArgtupleInvalid("Lips3d", 1, 2, 2, 1); {__pyx_filename = __pyx_f[0]; __pyx_lineno = 385; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-      }
-    }
-    if (unlikely(kw_args > 0)) {
-      if (unlikely(__Pyx_ParseOptionalKeywords(__pyx_kwds, __pyx_pyargnames, 0, values, PyTuple_GET_SIZE(__pyx_args), "Lips3d") < 0)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 385; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-    }
-    __pyx_v_coords = ((PyArrayObject *)values[0]);
-    __pyx_v_mask = ((PyArrayObject *)values[1]);
-  } else if (PyTuple_GET_SIZE(__pyx_args) != 2) {
-    goto __pyx_L5_argtuple_error;
-  } else {
-    __pyx_v_coords = ((PyArrayObject *)PyTuple_GET_ITEM(__pyx_args, 0));
-    __pyx_v_mask = ((PyArrayObject *)PyTuple_GET_ITEM(__pyx_args, 1));
-  }
-  goto __pyx_L4_argument_unpacking_done;
-  __pyx_L5_argtuple_error:;
-  __Pyx_RaiseArgtupleInvalid("Lips3d", 1, 2, 2, PyTuple_GET_SIZE(__pyx_args)); {__pyx_filename = __pyx_f[0]; __pyx_lineno = 385; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-  __pyx_L3_error:;
-  __Pyx_AddTraceback("nipy.algorithms.statistics.intvol.Lips3d");
-  return NULL;
-  __pyx_L4_argument_unpacking_done:;
-  __pyx_v_fcoords = ((PyArrayObject *)Py_None); __Pyx_INCREF(Py_None);
-  __pyx_v_D = ((PyArrayObject *)Py_None); __Pyx_INCREF(Py_None);
-  __pyx_v_fmask = ((PyArrayObject *)Py_None); __Pyx_INCREF(Py_None);
-  __pyx_v_fpmask = ((PyArrayObject *)Py_None); __Pyx_INCREF(Py_None);
-  __pyx_v_pmask = ((PyArrayObject *)Py_None); __Pyx_INCREF(Py_None);
-  __pyx_v_d4 = ((PyArrayObject *)Py_None); __Pyx_INCREF(Py_None);
-  __pyx_v_m4 = ((PyArrayObject *)Py_None); __Pyx_INCREF(Py_None);
-  __pyx_v_d3 = ((PyArrayObject *)Py_None); __Pyx_INCREF(Py_None);
-  __pyx_v_m3 = ((PyArrayObject *)Py_None); __Pyx_INCREF(Py_None);
-  __pyx_v_d2 = ((PyArrayObject *)Py_None); __Pyx_INCREF(Py_None);
-  __pyx_v_m2 = ((PyArrayObject *)Py_None); __Pyx_INCREF(Py_None);
-  __pyx_v_cvertices = ((PyArrayObject *)Py_None); __Pyx_INCREF(Py_None);
-  __pyx_v_n = Py_None; __Pyx_INCREF(Py_None);
-  __pyx_v_strides = Py_None; __Pyx_INCREF(Py_None);
-  __pyx_v_dstrides = Py_None; __Pyx_INCREF(Py_None);
-  __pyx_v_union = Py_None; __Pyx_INCREF(Py_None);
-  __pyx_v_c = Py_None; __Pyx_INCREF(Py_None);
-  __pyx_v_ss0d = Py_None; __Pyx_INCREF(Py_None);
-  __pyx_v_ss1d = Py_None; __Pyx_INCREF(Py_None);
-  __pyx_v_ss2d = Py_None; __Pyx_INCREF(Py_None);
-  __pyx_v_d = Py_None; __Pyx_INCREF(Py_None);
-  __pyx_v_v = Py_None; __Pyx_INCREF(Py_None);
-  __pyx_bstruct_fcoords.buf = NULL;
-  __pyx_bstruct_D.buf = NULL;
-  __pyx_bstruct_fmask.buf = NULL;
-  __pyx_bstruct_fpmask.buf = NULL;
-  __pyx_bstruct_pmask.buf = NULL;
-  __pyx_bstruct_d4.buf = NULL;
-  __pyx_bstruct_m4.buf = NULL;
-  __pyx_bstruct_d3.buf = NULL;
-  __pyx_bstruct_m3.buf = NULL;
-  __pyx_bstruct_d2.buf = NULL;
-  __pyx_bstruct_m2.buf = NULL;
-  __pyx_bstruct_cvertices.buf = NULL;
-  __pyx_bstruct_coords.buf = NULL;
-  __pyx_bstruct_mask.buf = NULL;
-  if (unlikely(!__Pyx_ArgTypeTest(((PyObject *)__pyx_v_coords), __pyx_ptype_5numpy_ndarray, 1, "coords", 0))) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 385; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  if (unlikely(!__Pyx_ArgTypeTest(((PyObject *)__pyx_v_mask), __pyx_ptype_5numpy_ndarray, 1, "mask", 0))) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 386; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  {
-    __Pyx_BufFmt_StackElem __pyx_stack[1];
-    if (unlikely(__Pyx_GetBufferAndValidate(&__pyx_bstruct_coords, (PyObject*)__pyx_v_coords, &__Pyx_TypeInfo_nn___pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_float_t, PyBUF_FORMAT| PyBUF_STRIDES, 4, 0, __pyx_stack) == -1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 385; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  }
-  __pyx_bstride_0_coords = __pyx_bstruct_coords.strides[0]; __pyx_bstride_1_coords = __pyx_bstruct_coords.strides[1]; __pyx_bstride_2_coords = __pyx_bstruct_coords.strides[2]; __pyx_bstride_3_coords = __pyx_bstruct_coords.strides[3];
-  __pyx_bshape_0_coords = __pyx_bstruct_coords.shape[0]; __pyx_bshape_1_coords = __pyx_bstruct_coords.shape[1]; __pyx_bshape_2_coords = __pyx_bstruct_coords.shape[2]; __pyx_bshape_3_coords = __pyx_bstruct_coords.shape[3];
-  {
-    __Pyx_BufFmt_StackElem __pyx_stack[1];
-    if (unlikely(__Pyx_GetBufferAndValidate(&__pyx_bstruct_mask, (PyObject*)__pyx_v_mask, &__Pyx_TypeInfo_nn___pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_int_t, PyBUF_FORMAT| PyBUF_STRIDES, 3, 0, __pyx_stack) == -1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 385; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  }
-  __pyx_bstride_0_mask = __pyx_bstruct_mask.strides[0]; __pyx_bstride_1_mask = __pyx_bstruct_mask.strides[1]; __pyx_bstride_2_mask = __pyx_bstruct_mask.strides[2];
-  __pyx_bshape_0_mask = __pyx_bstruct_mask.shape[0]; __pyx_bshape_1_mask = __pyx_bstruct_mask.shape[1]; __pyx_bshape_2_mask = __pyx_bstruct_mask.shape[2];
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":429
- *     """
- * 
- *     if not set(np.unique(mask)).issubset([0,1]):             # <<<<<<<<<<<<<<
- *       raise ValueError('mask should be filled with 0/1 values, but be of type np.int')
- * 
- */
-  __pyx_1 = __Pyx_GetName(__pyx_m, __pyx_kp_np); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 429; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_1);
-  __pyx_t_1 = PyObject_GetAttr(__pyx_1, __pyx_kp_unique); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 429; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_1);
-  __Pyx_DECREF(__pyx_1); __pyx_1 = 0;
-  __pyx_t_2 = PyTuple_New(1); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 429; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_2));
-  __Pyx_INCREF(((PyObject *)__pyx_v_mask));
-  PyTuple_SET_ITEM(__pyx_t_2, 0, ((PyObject *)__pyx_v_mask));
-  __Pyx_GIVEREF(((PyObject *)__pyx_v_mask));
-  __pyx_t_3 = PyObject_Call(__pyx_t_1, ((PyObject *)__pyx_t_2), NULL); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 429; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_3);
-  __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-  __Pyx_DECREF(((PyObject *)__pyx_t_2)); __pyx_t_2 = 0;
-  __pyx_t_2 = PyTuple_New(1); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 429; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_2));
-  PyTuple_SET_ITEM(__pyx_t_2, 0, __pyx_t_3);
-  __Pyx_GIVEREF(__pyx_t_3);
-  __pyx_t_3 = 0;
-  __pyx_t_3 = PyObject_Call(((PyObject *)((PyObject*)&PySet_Type)), ((PyObject *)__pyx_t_2), NULL); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 429; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_3);
-  __Pyx_DECREF(((PyObject *)__pyx_t_2)); __pyx_t_2 = 0;
-  __pyx_t_2 = PyObject_GetAttr(__pyx_t_3, __pyx_kp_issubset); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 429; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_2);
-  __Pyx_DECREF(__pyx_t_3); __pyx_t_3 = 0;
-  __pyx_t_3 = PyList_New(2); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 429; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_3));
-  __Pyx_INCREF(__pyx_int_0);
-  PyList_SET_ITEM(__pyx_t_3, 0, __pyx_int_0);
-  __Pyx_GIVEREF(__pyx_int_0);
-  __Pyx_INCREF(__pyx_int_1);
-  PyList_SET_ITEM(__pyx_t_3, 1, __pyx_int_1);
-  __Pyx_GIVEREF(__pyx_int_1);
-  __pyx_t_1 = PyTuple_New(1); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 429; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_1));
-  PyTuple_SET_ITEM(__pyx_t_1, 0, ((PyObject *)__pyx_t_3));
-  __Pyx_GIVEREF(((PyObject *)__pyx_t_3));
-  __pyx_t_3 = 0;
-  __pyx_t_3 = PyObject_Call(__pyx_t_2, ((PyObject *)__pyx_t_1), NULL); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 429; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_3);
-  __Pyx_DECREF(__pyx_t_2); __pyx_t_2 = 0;
-  __Pyx_DECREF(((PyObject *)__pyx_t_1)); __pyx_t_1 = 0;
-  __pyx_t_4 = __Pyx_PyObject_IsTrue(__pyx_t_3); if (unlikely(__pyx_t_4 < 0)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 429; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_DECREF(__pyx_t_3); __pyx_t_3 = 0;
-  __pyx_t_5 = (!__pyx_t_4);
-  if (__pyx_t_5) {
-
-    /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":430
- * 
- *     if not set(np.unique(mask)).issubset([0,1]):
- *       raise ValueError('mask should be filled with 0/1 values, but be of type np.int')             # <<<<<<<<<<<<<<
- * 
- *     # 'flattened' coords (2d array)
- */
-    __pyx_t_3 = PyTuple_New(1); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 430; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __Pyx_GOTREF(((PyObject *)__pyx_t_3));
-    __Pyx_INCREF(__pyx_kp_47);
-    PyTuple_SET_ITEM(__pyx_t_3, 0, __pyx_kp_47);
-    __Pyx_GIVEREF(__pyx_kp_47);
-    __pyx_t_1 = PyObject_Call(__pyx_builtin_ValueError, ((PyObject *)__pyx_t_3), NULL); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 430; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __Pyx_GOTREF(__pyx_t_1);
-    __Pyx_DECREF(((PyObject *)__pyx_t_3)); __pyx_t_3 = 0;
-    __Pyx_Raise(__pyx_t_1, 0, 0);
-    __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-    {__pyx_filename = __pyx_f[0]; __pyx_lineno = 430; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    goto __pyx_L6;
-  }
-  __pyx_L6:;
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":462
- *     cdef double res
- * 
- *     l0 = 0; l1 = 0; l2 = 0; l3 = 0             # <<<<<<<<<<<<<<
- * 
- *     pmask = np.zeros((mask.shape[0]+1, mask.shape[1]+1, mask.shape[2]+1), np.int)
- */
-  __pyx_v_l0 = 0;
-  __pyx_v_l1 = 0;
-  __pyx_v_l2 = 0;
-  __pyx_v_l3 = 0;
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":464
- *     l0 = 0; l1 = 0; l2 = 0; l3 = 0
- * 
- *     pmask = np.zeros((mask.shape[0]+1, mask.shape[1]+1, mask.shape[2]+1), np.int)             # <<<<<<<<<<<<<<
- *     pmask[:-1,:-1,:-1] = mask
- * 
- */
-  __pyx_1 = __Pyx_GetName(__pyx_m, __pyx_kp_np); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 464; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_1);
-  __pyx_t_1 = PyObject_GetAttr(__pyx_1, __pyx_kp_zeros); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 464; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_1);
-  __Pyx_DECREF(__pyx_1); __pyx_1 = 0;
-  __pyx_t_3 = PyInt_FromLong(((__pyx_v_mask->dimensions[0]) + 1)); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 464; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_3);
-  __pyx_t_2 = PyInt_FromLong(((__pyx_v_mask->dimensions[1]) + 1)); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 464; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_2);
-  __pyx_t_6 = PyInt_FromLong(((__pyx_v_mask->dimensions[2]) + 1)); if (unlikely(!__pyx_t_6)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 464; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_6);
-  __pyx_t_7 = PyTuple_New(3); if (unlikely(!__pyx_t_7)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 464; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_7));
-  PyTuple_SET_ITEM(__pyx_t_7, 0, __pyx_t_3);
-  __Pyx_GIVEREF(__pyx_t_3);
-  PyTuple_SET_ITEM(__pyx_t_7, 1, __pyx_t_2);
-  __Pyx_GIVEREF(__pyx_t_2);
-  PyTuple_SET_ITEM(__pyx_t_7, 2, __pyx_t_6);
-  __Pyx_GIVEREF(__pyx_t_6);
-  __pyx_t_3 = 0;
-  __pyx_t_2 = 0;
-  __pyx_t_6 = 0;
-  __pyx_1 = __Pyx_GetName(__pyx_m, __pyx_kp_np); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 464; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_1);
-  __pyx_t_6 = PyObject_GetAttr(__pyx_1, __pyx_kp_int); if (unlikely(!__pyx_t_6)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 464; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_6);
-  __Pyx_DECREF(__pyx_1); __pyx_1 = 0;
-  __pyx_t_2 = PyTuple_New(2); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 464; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_2));
-  PyTuple_SET_ITEM(__pyx_t_2, 0, ((PyObject *)__pyx_t_7));
-  __Pyx_GIVEREF(((PyObject *)__pyx_t_7));
-  PyTuple_SET_ITEM(__pyx_t_2, 1, __pyx_t_6);
-  __Pyx_GIVEREF(__pyx_t_6);
-  __pyx_t_7 = 0;
-  __pyx_t_6 = 0;
-  __pyx_t_6 = PyObject_Call(__pyx_t_1, ((PyObject *)__pyx_t_2), NULL); if (unlikely(!__pyx_t_6)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 464; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_6);
-  __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-  __Pyx_DECREF(((PyObject *)__pyx_t_2)); __pyx_t_2 = 0;
-  if (!(__Pyx_TypeTest(__pyx_t_6, __pyx_ptype_5numpy_ndarray))) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 464; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __pyx_t_8 = ((PyArrayObject *)__pyx_t_6);
-  {
-    __Pyx_BufFmt_StackElem __pyx_stack[1];
-    __Pyx_SafeReleaseBuffer(&__pyx_bstruct_pmask);
-    __pyx_t_9 = __Pyx_GetBufferAndValidate(&__pyx_bstruct_pmask, (PyObject*)__pyx_t_8, &__Pyx_TypeInfo_nn___pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_int_t, PyBUF_FORMAT| PyBUF_STRIDES, 3, 0, __pyx_stack);
-    if (unlikely(__pyx_t_9 < 0)) {
-      PyErr_Fetch(&__pyx_t_10, &__pyx_t_11, &__pyx_t_12);
-      if (unlikely(__Pyx_GetBufferAndValidate(&__pyx_bstruct_pmask, (PyObject*)__pyx_v_pmask, &__Pyx_TypeInfo_nn___pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_int_t, PyBUF_FORMAT| PyBUF_STRIDES, 3, 0, __pyx_stack) == -1)) {
-        Py_XDECREF(__pyx_t_10); Py_XDECREF(__pyx_t_11); Py_XDECREF(__pyx_t_12);
-        __Pyx_RaiseBufferFallbackError();
-      } else {
-        PyErr_Restore(__pyx_t_10, __pyx_t_11, __pyx_t_12);
-      }
-    }
-    __pyx_bstride_0_pmask = __pyx_bstruct_pmask.strides[0]; __pyx_bstride_1_pmask = __pyx_bstruct_pmask.strides[1]; __pyx_bstride_2_pmask = __pyx_bstruct_pmask.strides[2];
-    __pyx_bshape_0_pmask = __pyx_bstruct_pmask.shape[0]; __pyx_bshape_1_pmask = __pyx_bstruct_pmask.shape[1]; __pyx_bshape_2_pmask = __pyx_bstruct_pmask.shape[2];
-    if (unlikely(__pyx_t_9 < 0)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 464; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  }
-  __pyx_t_8 = 0;
-  __Pyx_DECREF(((PyObject *)__pyx_v_pmask));
-  __pyx_v_pmask = ((PyArrayObject *)__pyx_t_6);
-  __pyx_t_6 = 0;
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":465
- * 
- *     pmask = np.zeros((mask.shape[0]+1, mask.shape[1]+1, mask.shape[2]+1), np.int)
- *     pmask[:-1,:-1,:-1] = mask             # <<<<<<<<<<<<<<
- * 
- *     s0, s1, s2 = (pmask.shape[0], pmask.shape[1], pmask.shape[2])
- */
-  __pyx_1 = PySlice_New(Py_None, __pyx_int_neg_1, Py_None); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 465; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_1);
-  __pyx_2 = PySlice_New(Py_None, __pyx_int_neg_1, Py_None); if (unlikely(!__pyx_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 465; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_2);
-  __pyx_3 = PySlice_New(Py_None, __pyx_int_neg_1, Py_None); if (unlikely(!__pyx_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 465; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_3);
-  __pyx_t_6 = PyTuple_New(3); if (unlikely(!__pyx_t_6)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 465; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_6));
-  PyTuple_SET_ITEM(__pyx_t_6, 0, __pyx_1);
-  __Pyx_GIVEREF(__pyx_1);
-  PyTuple_SET_ITEM(__pyx_t_6, 1, __pyx_2);
-  __Pyx_GIVEREF(__pyx_2);
-  PyTuple_SET_ITEM(__pyx_t_6, 2, __pyx_3);
-  __Pyx_GIVEREF(__pyx_3);
-  __pyx_1 = 0;
-  __pyx_2 = 0;
-  __pyx_3 = 0;
-  if (PyObject_SetItem(((PyObject *)__pyx_v_pmask), ((PyObject *)__pyx_t_6), ((PyObject *)__pyx_v_mask)) < 0) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 465; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_DECREF(((PyObject *)__pyx_t_6)); __pyx_t_6 = 0;
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":467
- *     pmask[:-1,:-1,:-1] = mask
- * 
- *     s0, s1, s2 = (pmask.shape[0], pmask.shape[1], pmask.shape[2])             # <<<<<<<<<<<<<<
- * 
- *     fpmask = pmask.reshape((s0*s1*s2))
- */
-  __pyx_t_13 = (__pyx_v_pmask->dimensions[0]);
-  __pyx_t_14 = (__pyx_v_pmask->dimensions[1]);
-  __pyx_t_15 = (__pyx_v_pmask->dimensions[2]);
-  __pyx_v_s0 = __pyx_t_13;
-  __pyx_v_s1 = __pyx_t_14;
-  __pyx_v_s2 = __pyx_t_15;
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":469
- *     s0, s1, s2 = (pmask.shape[0], pmask.shape[1], pmask.shape[2])
- * 
- *     fpmask = pmask.reshape((s0*s1*s2))             # <<<<<<<<<<<<<<
- *     fmask = mask.reshape((s0-1)*(s1-1)*(s2-1))
- * 
- */
-  __pyx_t_6 = PyObject_GetAttr(((PyObject *)__pyx_v_pmask), __pyx_kp_reshape); if (unlikely(!__pyx_t_6)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 469; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_6);
-  __pyx_t_2 = PyInt_FromLong(((__pyx_v_s0 * __pyx_v_s1) * __pyx_v_s2)); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 469; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_2);
-  __pyx_t_1 = PyTuple_New(1); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 469; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_1));
-  PyTuple_SET_ITEM(__pyx_t_1, 0, __pyx_t_2);
-  __Pyx_GIVEREF(__pyx_t_2);
-  __pyx_t_2 = 0;
-  __pyx_t_2 = PyObject_Call(__pyx_t_6, ((PyObject *)__pyx_t_1), NULL); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 469; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_2);
-  __Pyx_DECREF(__pyx_t_6); __pyx_t_6 = 0;
-  __Pyx_DECREF(((PyObject *)__pyx_t_1)); __pyx_t_1 = 0;
-  if (!(__Pyx_TypeTest(__pyx_t_2, __pyx_ptype_5numpy_ndarray))) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 469; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __pyx_t_16 = ((PyArrayObject *)__pyx_t_2);
-  {
-    __Pyx_BufFmt_StackElem __pyx_stack[1];
-    __Pyx_SafeReleaseBuffer(&__pyx_bstruct_fpmask);
-    __pyx_t_9 = __Pyx_GetBufferAndValidate(&__pyx_bstruct_fpmask, (PyObject*)__pyx_t_16, &__Pyx_TypeInfo_nn___pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_int_t, PyBUF_FORMAT| PyBUF_STRIDES, 1, 0, __pyx_stack);
-    if (unlikely(__pyx_t_9 < 0)) {
-      PyErr_Fetch(&__pyx_t_12, &__pyx_t_11, &__pyx_t_10);
-      if (unlikely(__Pyx_GetBufferAndValidate(&__pyx_bstruct_fpmask, (PyObject*)__pyx_v_fpmask, &__Pyx_TypeInfo_nn___pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_int_t, PyBUF_FORMAT| PyBUF_STRIDES, 1, 0, __pyx_stack) == -1)) {
-        Py_XDECREF(__pyx_t_12); Py_XDECREF(__pyx_t_11); Py_XDECREF(__pyx_t_10);
-        __Pyx_RaiseBufferFallbackError();
-      } else {
-        PyErr_Restore(__pyx_t_12, __pyx_t_11, __pyx_t_10);
-      }
-    }
-    __pyx_bstride_0_fpmask = __pyx_bstruct_fpmask.strides[0];
-    __pyx_bshape_0_fpmask = __pyx_bstruct_fpmask.shape[0];
-    if (unlikely(__pyx_t_9 < 0)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 469; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  }
-  __pyx_t_16 = 0;
-  __Pyx_DECREF(((PyObject *)__pyx_v_fpmask));
-  __pyx_v_fpmask = ((PyArrayObject *)__pyx_t_2);
-  __pyx_t_2 = 0;
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":470
- * 
- *     fpmask = pmask.reshape((s0*s1*s2))
- *     fmask = mask.reshape((s0-1)*(s1-1)*(s2-1))             # <<<<<<<<<<<<<<
- * 
- *     if (mask.shape[0], mask.shape[1], mask.shape[2]) != (coords.shape[1], coords.shape[2], coords.shape[3]):
- */
-  __pyx_t_2 = PyObject_GetAttr(((PyObject *)__pyx_v_mask), __pyx_kp_reshape); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 470; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_2);
-  __pyx_t_1 = PyInt_FromLong((((__pyx_v_s0 - 1) * (__pyx_v_s1 - 1)) * (__pyx_v_s2 - 1))); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 470; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_1);
-  __pyx_t_6 = PyTuple_New(1); if (unlikely(!__pyx_t_6)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 470; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_6));
-  PyTuple_SET_ITEM(__pyx_t_6, 0, __pyx_t_1);
-  __Pyx_GIVEREF(__pyx_t_1);
-  __pyx_t_1 = 0;
-  __pyx_t_1 = PyObject_Call(__pyx_t_2, ((PyObject *)__pyx_t_6), NULL); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 470; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_1);
-  __Pyx_DECREF(__pyx_t_2); __pyx_t_2 = 0;
-  __Pyx_DECREF(((PyObject *)__pyx_t_6)); __pyx_t_6 = 0;
-  if (!(__Pyx_TypeTest(__pyx_t_1, __pyx_ptype_5numpy_ndarray))) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 470; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __pyx_t_17 = ((PyArrayObject *)__pyx_t_1);
-  {
-    __Pyx_BufFmt_StackElem __pyx_stack[1];
-    __Pyx_SafeReleaseBuffer(&__pyx_bstruct_fmask);
-    __pyx_t_9 = __Pyx_GetBufferAndValidate(&__pyx_bstruct_fmask, (PyObject*)__pyx_t_17, &__Pyx_TypeInfo_nn___pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_int_t, PyBUF_FORMAT| PyBUF_STRIDES, 1, 0, __pyx_stack);
-    if (unlikely(__pyx_t_9 < 0)) {
-      PyErr_Fetch(&__pyx_t_10, &__pyx_t_11, &__pyx_t_12);
-      if (unlikely(__Pyx_GetBufferAndValidate(&__pyx_bstruct_fmask, (PyObject*)__pyx_v_fmask, &__Pyx_TypeInfo_nn___pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_int_t, PyBUF_FORMAT| PyBUF_STRIDES, 1, 0, __pyx_stack) == -1)) {
-        Py_XDECREF(__pyx_t_10); Py_XDECREF(__pyx_t_11); Py_XDECREF(__pyx_t_12);
-        __Pyx_RaiseBufferFallbackError();
-      } else {
-        PyErr_Restore(__pyx_t_10, __pyx_t_11, __pyx_t_12);
-      }
-    }
-    __pyx_bstride_0_fmask = __pyx_bstruct_fmask.strides[0];
-    __pyx_bshape_0_fmask = __pyx_bstruct_fmask.shape[0];
-    if (unlikely(__pyx_t_9 < 0)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 470; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  }
-  __pyx_t_17 = 0;
-  __Pyx_DECREF(((PyObject *)__pyx_v_fmask));
-  __pyx_v_fmask = ((PyArrayObject *)__pyx_t_1);
-  __pyx_t_1 = 0;
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":472
- *     fmask = mask.reshape((s0-1)*(s1-1)*(s2-1))
- * 
- *     if (mask.shape[0], mask.shape[1], mask.shape[2]) != (coords.shape[1], coords.shape[2], coords.shape[3]):             # <<<<<<<<<<<<<<
- *         raise ValueError('shape of mask does not match coordinates')
- * 
- */
-  __pyx_t_1 = PyInt_FromLong((__pyx_v_mask->dimensions[0])); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 472; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_1);
-  __pyx_t_6 = PyInt_FromLong((__pyx_v_mask->dimensions[1])); if (unlikely(!__pyx_t_6)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 472; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_6);
-  __pyx_t_2 = PyInt_FromLong((__pyx_v_mask->dimensions[2])); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 472; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_2);
-  __pyx_t_7 = PyTuple_New(3); if (unlikely(!__pyx_t_7)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 472; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_7));
-  PyTuple_SET_ITEM(__pyx_t_7, 0, __pyx_t_1);
-  __Pyx_GIVEREF(__pyx_t_1);
-  PyTuple_SET_ITEM(__pyx_t_7, 1, __pyx_t_6);
-  __Pyx_GIVEREF(__pyx_t_6);
-  PyTuple_SET_ITEM(__pyx_t_7, 2, __pyx_t_2);
-  __Pyx_GIVEREF(__pyx_t_2);
-  __pyx_t_1 = 0;
-  __pyx_t_6 = 0;
-  __pyx_t_2 = 0;
-  __pyx_t_2 = PyInt_FromLong((__pyx_v_coords->dimensions[1])); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 472; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_2);
-  __pyx_t_6 = PyInt_FromLong((__pyx_v_coords->dimensions[2])); if (unlikely(!__pyx_t_6)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 472; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_6);
-  __pyx_t_1 = PyInt_FromLong((__pyx_v_coords->dimensions[3])); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 472; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_1);
-  __pyx_t_3 = PyTuple_New(3); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 472; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_3));
-  PyTuple_SET_ITEM(__pyx_t_3, 0, __pyx_t_2);
-  __Pyx_GIVEREF(__pyx_t_2);
-  PyTuple_SET_ITEM(__pyx_t_3, 1, __pyx_t_6);
-  __Pyx_GIVEREF(__pyx_t_6);
-  PyTuple_SET_ITEM(__pyx_t_3, 2, __pyx_t_1);
-  __Pyx_GIVEREF(__pyx_t_1);
-  __pyx_t_2 = 0;
-  __pyx_t_6 = 0;
-  __pyx_t_1 = 0;
-  __pyx_t_1 = PyObject_RichCompare(((PyObject *)__pyx_t_7), ((PyObject *)__pyx_t_3), Py_NE); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 472; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_1);
-  __Pyx_DECREF(((PyObject *)__pyx_t_7)); __pyx_t_7 = 0;
-  __Pyx_DECREF(((PyObject *)__pyx_t_3)); __pyx_t_3 = 0;
-  __pyx_t_5 = __Pyx_PyObject_IsTrue(__pyx_t_1); if (unlikely(__pyx_t_5 < 0)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 472; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-  if (__pyx_t_5) {
-
-    /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":473
- * 
- *     if (mask.shape[0], mask.shape[1], mask.shape[2]) != (coords.shape[1], coords.shape[2], coords.shape[3]):
- *         raise ValueError('shape of mask does not match coordinates')             # <<<<<<<<<<<<<<
- * 
- *     fcoords = coords.reshape((coords.shape[0], (s0-1)*(s1-1)*(s2-1)))
- */
-    __pyx_t_1 = PyTuple_New(1); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 473; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __Pyx_GOTREF(((PyObject *)__pyx_t_1));
-    __Pyx_INCREF(__pyx_kp_48);
-    PyTuple_SET_ITEM(__pyx_t_1, 0, __pyx_kp_48);
-    __Pyx_GIVEREF(__pyx_kp_48);
-    __pyx_t_3 = PyObject_Call(__pyx_builtin_ValueError, ((PyObject *)__pyx_t_1), NULL); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 473; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __Pyx_GOTREF(__pyx_t_3);
-    __Pyx_DECREF(((PyObject *)__pyx_t_1)); __pyx_t_1 = 0;
-    __Pyx_Raise(__pyx_t_3, 0, 0);
-    __Pyx_DECREF(__pyx_t_3); __pyx_t_3 = 0;
-    {__pyx_filename = __pyx_f[0]; __pyx_lineno = 473; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    goto __pyx_L7;
-  }
-  __pyx_L7:;
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":475
- *         raise ValueError('shape of mask does not match coordinates')
- * 
- *     fcoords = coords.reshape((coords.shape[0], (s0-1)*(s1-1)*(s2-1)))             # <<<<<<<<<<<<<<
- *     n = fcoords.shape[0]
- * 
- */
-  __pyx_t_3 = PyObject_GetAttr(((PyObject *)__pyx_v_coords), __pyx_kp_reshape); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 475; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_3);
-  __pyx_t_1 = PyInt_FromLong((__pyx_v_coords->dimensions[0])); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 475; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_1);
-  __pyx_t_7 = PyInt_FromLong((((__pyx_v_s0 - 1) * (__pyx_v_s1 - 1)) * (__pyx_v_s2 - 1))); if (unlikely(!__pyx_t_7)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 475; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_7);
-  __pyx_t_6 = PyTuple_New(2); if (unlikely(!__pyx_t_6)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 475; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_6));
-  PyTuple_SET_ITEM(__pyx_t_6, 0, __pyx_t_1);
-  __Pyx_GIVEREF(__pyx_t_1);
-  PyTuple_SET_ITEM(__pyx_t_6, 1, __pyx_t_7);
-  __Pyx_GIVEREF(__pyx_t_7);
-  __pyx_t_1 = 0;
-  __pyx_t_7 = 0;
-  __pyx_t_7 = PyTuple_New(1); if (unlikely(!__pyx_t_7)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 475; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_7));
-  PyTuple_SET_ITEM(__pyx_t_7, 0, ((PyObject *)__pyx_t_6));
-  __Pyx_GIVEREF(((PyObject *)__pyx_t_6));
-  __pyx_t_6 = 0;
-  __pyx_t_6 = PyObject_Call(__pyx_t_3, ((PyObject *)__pyx_t_7), NULL); if (unlikely(!__pyx_t_6)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 475; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_6);
-  __Pyx_DECREF(__pyx_t_3); __pyx_t_3 = 0;
-  __Pyx_DECREF(((PyObject *)__pyx_t_7)); __pyx_t_7 = 0;
-  if (!(__Pyx_TypeTest(__pyx_t_6, __pyx_ptype_5numpy_ndarray))) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 475; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __pyx_t_18 = ((PyArrayObject *)__pyx_t_6);
-  {
-    __Pyx_BufFmt_StackElem __pyx_stack[1];
-    __Pyx_SafeReleaseBuffer(&__pyx_bstruct_fcoords);
-    __pyx_t_9 = __Pyx_GetBufferAndValidate(&__pyx_bstruct_fcoords, (PyObject*)__pyx_t_18, &__Pyx_TypeInfo_nn___pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_float_t, PyBUF_FORMAT| PyBUF_STRIDES, 2, 0, __pyx_stack);
-    if (unlikely(__pyx_t_9 < 0)) {
-      PyErr_Fetch(&__pyx_t_12, &__pyx_t_11, &__pyx_t_10);
-      if (unlikely(__Pyx_GetBufferAndValidate(&__pyx_bstruct_fcoords, (PyObject*)__pyx_v_fcoords, &__Pyx_TypeInfo_nn___pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_float_t, PyBUF_FORMAT| PyBUF_STRIDES, 2, 0, __pyx_stack) == -1)) {
-        Py_XDECREF(__pyx_t_12); Py_XDECREF(__pyx_t_11); Py_XDECREF(__pyx_t_10);
-        __Pyx_RaiseBufferFallbackError();
-      } else {
-        PyErr_Restore(__pyx_t_12, __pyx_t_11, __pyx_t_10);
-      }
-    }
-    __pyx_bstride_0_fcoords = __pyx_bstruct_fcoords.strides[0]; __pyx_bstride_1_fcoords = __pyx_bstruct_fcoords.strides[1];
-    __pyx_bshape_0_fcoords = __pyx_bstruct_fcoords.shape[0]; __pyx_bshape_1_fcoords = __pyx_bstruct_fcoords.shape[1];
-    if (unlikely(__pyx_t_9 < 0)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 475; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  }
-  __pyx_t_18 = 0;
-  __Pyx_DECREF(((PyObject *)__pyx_v_fcoords));
-  __pyx_v_fcoords = ((PyArrayObject *)__pyx_t_6);
-  __pyx_t_6 = 0;
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":476
- * 
- *     fcoords = coords.reshape((coords.shape[0], (s0-1)*(s1-1)*(s2-1)))
- *     n = fcoords.shape[0]             # <<<<<<<<<<<<<<
- * 
- *     # First do the interior contributions.
- */
-  __pyx_t_6 = PyInt_FromLong((__pyx_v_fcoords->dimensions[0])); if (unlikely(!__pyx_t_6)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 476; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_6);
-  __Pyx_DECREF(__pyx_v_n);
-  __pyx_v_n = __pyx_t_6;
-  __pyx_t_6 = 0;
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":485
- *     # hence it will have different strides than the data
- * 
- *     strides = np.empty((s0, s1, s2), np.bool).strides             # <<<<<<<<<<<<<<
- *     dstrides = np.empty((s0-1, s1-1, s2-1), np.bool).strides
- *     cvertices = np.array([[[dstrides[0]*i+dstrides[1]*j+dstrides[2]*k for i in range(2)] for j in range(2)] for k in range(2)]).ravel()
- */
-  __pyx_1 = __Pyx_GetName(__pyx_m, __pyx_kp_np); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 485; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_1);
-  __pyx_t_6 = PyObject_GetAttr(__pyx_1, __pyx_kp_empty); if (unlikely(!__pyx_t_6)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 485; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_6);
-  __Pyx_DECREF(__pyx_1); __pyx_1 = 0;
-  __pyx_t_7 = PyInt_FromLong(__pyx_v_s0); if (unlikely(!__pyx_t_7)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 485; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_7);
-  __pyx_t_3 = PyInt_FromLong(__pyx_v_s1); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 485; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_3);
-  __pyx_t_1 = PyInt_FromLong(__pyx_v_s2); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 485; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_1);
-  __pyx_t_2 = PyTuple_New(3); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 485; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_2));
-  PyTuple_SET_ITEM(__pyx_t_2, 0, __pyx_t_7);
-  __Pyx_GIVEREF(__pyx_t_7);
-  PyTuple_SET_ITEM(__pyx_t_2, 1, __pyx_t_3);
-  __Pyx_GIVEREF(__pyx_t_3);
-  PyTuple_SET_ITEM(__pyx_t_2, 2, __pyx_t_1);
-  __Pyx_GIVEREF(__pyx_t_1);
-  __pyx_t_7 = 0;
-  __pyx_t_3 = 0;
-  __pyx_t_1 = 0;
-  __pyx_2 = __Pyx_GetName(__pyx_m, __pyx_kp_np); if (unlikely(!__pyx_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 485; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_2);
-  __pyx_t_1 = PyObject_GetAttr(__pyx_2, __pyx_kp_bool); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 485; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_1);
-  __Pyx_DECREF(__pyx_2); __pyx_2 = 0;
-  __pyx_t_3 = PyTuple_New(2); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 485; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_3));
-  PyTuple_SET_ITEM(__pyx_t_3, 0, ((PyObject *)__pyx_t_2));
-  __Pyx_GIVEREF(((PyObject *)__pyx_t_2));
-  PyTuple_SET_ITEM(__pyx_t_3, 1, __pyx_t_1);
-  __Pyx_GIVEREF(__pyx_t_1);
-  __pyx_t_2 = 0;
-  __pyx_t_1 = 0;
-  __pyx_t_1 = PyObject_Call(__pyx_t_6, ((PyObject *)__pyx_t_3), NULL); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 485; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_1);
-  __Pyx_DECREF(__pyx_t_6); __pyx_t_6 = 0;
-  __Pyx_DECREF(((PyObject *)__pyx_t_3)); __pyx_t_3 = 0;
-  __pyx_t_3 = PyObject_GetAttr(__pyx_t_1, __pyx_kp_strides); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 485; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_3);
-  __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-  __Pyx_DECREF(__pyx_v_strides);
-  __pyx_v_strides = __pyx_t_3;
-  __pyx_t_3 = 0;
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":486
- * 
- *     strides = np.empty((s0, s1, s2), np.bool).strides
- *     dstrides = np.empty((s0-1, s1-1, s2-1), np.bool).strides             # <<<<<<<<<<<<<<
- *     cvertices = np.array([[[dstrides[0]*i+dstrides[1]*j+dstrides[2]*k for i in range(2)] for j in range(2)] for k in range(2)]).ravel()
- *     cvertices.sort()
- */
-  __pyx_3 = __Pyx_GetName(__pyx_m, __pyx_kp_np); if (unlikely(!__pyx_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 486; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_3);
-  __pyx_t_3 = PyObject_GetAttr(__pyx_3, __pyx_kp_empty); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 486; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_3);
-  __Pyx_DECREF(__pyx_3); __pyx_3 = 0;
-  __pyx_t_1 = PyInt_FromLong((__pyx_v_s0 - 1)); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 486; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_1);
-  __pyx_t_6 = PyInt_FromLong((__pyx_v_s1 - 1)); if (unlikely(!__pyx_t_6)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 486; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_6);
-  __pyx_t_2 = PyInt_FromLong((__pyx_v_s2 - 1)); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 486; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_2);
-  __pyx_t_7 = PyTuple_New(3); if (unlikely(!__pyx_t_7)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 486; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_7));
-  PyTuple_SET_ITEM(__pyx_t_7, 0, __pyx_t_1);
-  __Pyx_GIVEREF(__pyx_t_1);
-  PyTuple_SET_ITEM(__pyx_t_7, 1, __pyx_t_6);
-  __Pyx_GIVEREF(__pyx_t_6);
-  PyTuple_SET_ITEM(__pyx_t_7, 2, __pyx_t_2);
-  __Pyx_GIVEREF(__pyx_t_2);
-  __pyx_t_1 = 0;
-  __pyx_t_6 = 0;
-  __pyx_t_2 = 0;
-  __pyx_1 = __Pyx_GetName(__pyx_m, __pyx_kp_np); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 486; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_1);
-  __pyx_t_2 = PyObject_GetAttr(__pyx_1, __pyx_kp_bool); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 486; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_2);
-  __Pyx_DECREF(__pyx_1); __pyx_1 = 0;
-  __pyx_t_6 = PyTuple_New(2); if (unlikely(!__pyx_t_6)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 486; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_6));
-  PyTuple_SET_ITEM(__pyx_t_6, 0, ((PyObject *)__pyx_t_7));
-  __Pyx_GIVEREF(((PyObject *)__pyx_t_7));
-  PyTuple_SET_ITEM(__pyx_t_6, 1, __pyx_t_2);
-  __Pyx_GIVEREF(__pyx_t_2);
-  __pyx_t_7 = 0;
-  __pyx_t_2 = 0;
-  __pyx_t_2 = PyObject_Call(__pyx_t_3, ((PyObject *)__pyx_t_6), NULL); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 486; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_2);
-  __Pyx_DECREF(__pyx_t_3); __pyx_t_3 = 0;
-  __Pyx_DECREF(((PyObject *)__pyx_t_6)); __pyx_t_6 = 0;
-  __pyx_t_6 = PyObject_GetAttr(__pyx_t_2, __pyx_kp_strides); if (unlikely(!__pyx_t_6)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 486; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_6);
-  __Pyx_DECREF(__pyx_t_2); __pyx_t_2 = 0;
-  __Pyx_DECREF(__pyx_v_dstrides);
-  __pyx_v_dstrides = __pyx_t_6;
-  __pyx_t_6 = 0;
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":487
- *     strides = np.empty((s0, s1, s2), np.bool).strides
- *     dstrides = np.empty((s0-1, s1-1, s2-1), np.bool).strides
- *     cvertices = np.array([[[dstrides[0]*i+dstrides[1]*j+dstrides[2]*k for i in range(2)] for j in range(2)] for k in range(2)]).ravel()             # <<<<<<<<<<<<<<
- *     cvertices.sort()
- * 
- */
-  __pyx_2 = __Pyx_GetName(__pyx_m, __pyx_kp_np); if (unlikely(!__pyx_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 487; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_2);
-  __pyx_t_6 = PyObject_GetAttr(__pyx_2, __pyx_kp_array); if (unlikely(!__pyx_t_6)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 487; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_6);
-  __Pyx_DECREF(__pyx_2); __pyx_2 = 0;
-  __pyx_t_2 = PyList_New(0); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 487; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_2));
-  for (__pyx_t_19 = 0; __pyx_t_19 < 2; __pyx_t_19+=1) {
-    __pyx_v_k = __pyx_t_19;
-    __pyx_t_3 = PyList_New(0); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 487; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __Pyx_GOTREF(((PyObject *)__pyx_t_3));
-    for (__pyx_t_20 = 0; __pyx_t_20 < 2; __pyx_t_20+=1) {
-      __pyx_v_j = __pyx_t_20;
-      __pyx_t_7 = PyList_New(0); if (unlikely(!__pyx_t_7)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 487; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-      __Pyx_GOTREF(((PyObject *)__pyx_t_7));
-      for (__pyx_t_21 = 0; __pyx_t_21 < 2; __pyx_t_21+=1) {
-        __pyx_v_i = __pyx_t_21;
-        __pyx_3 = __Pyx_GetItemInt(__pyx_v_dstrides, 0, sizeof(long), PyInt_FromLong); if (!__pyx_3) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 487; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-        __Pyx_GOTREF(__pyx_3);
-        __pyx_t_1 = PyInt_FromLong(__pyx_v_i); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 487; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-        __Pyx_GOTREF(__pyx_t_1);
-        __pyx_t_22 = PyNumber_Multiply(__pyx_3, __pyx_t_1); if (unlikely(!__pyx_t_22)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 487; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-        __Pyx_GOTREF(__pyx_t_22);
-        __Pyx_DECREF(__pyx_3); __pyx_3 = 0;
-        __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-        __pyx_1 = __Pyx_GetItemInt(__pyx_v_dstrides, 1, sizeof(long), PyInt_FromLong); if (!__pyx_1) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 487; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-        __Pyx_GOTREF(__pyx_1);
-        __pyx_t_1 = PyInt_FromLong(__pyx_v_j); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 487; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-        __Pyx_GOTREF(__pyx_t_1);
-        __pyx_t_23 = PyNumber_Multiply(__pyx_1, __pyx_t_1); if (unlikely(!__pyx_t_23)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 487; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-        __Pyx_GOTREF(__pyx_t_23);
-        __Pyx_DECREF(__pyx_1); __pyx_1 = 0;
-        __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-        __pyx_t_1 = PyNumber_Add(__pyx_t_22, __pyx_t_23); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 487; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-        __Pyx_GOTREF(__pyx_t_1);
-        __Pyx_DECREF(__pyx_t_22); __pyx_t_22 = 0;
-        __Pyx_DECREF(__pyx_t_23); __pyx_t_23 = 0;
-        __pyx_2 = __Pyx_GetItemInt(__pyx_v_dstrides, 2, sizeof(long), PyInt_FromLong); if (!__pyx_2) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 487; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-        __Pyx_GOTREF(__pyx_2);
-        __pyx_t_23 = PyInt_FromLong(__pyx_v_k); if (unlikely(!__pyx_t_23)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 487; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-        __Pyx_GOTREF(__pyx_t_23);
-        __pyx_t_22 = PyNumber_Multiply(__pyx_2, __pyx_t_23); if (unlikely(!__pyx_t_22)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 487; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-        __Pyx_GOTREF(__pyx_t_22);
-        __Pyx_DECREF(__pyx_2); __pyx_2 = 0;
-        __Pyx_DECREF(__pyx_t_23); __pyx_t_23 = 0;
-        __pyx_t_23 = PyNumber_Add(__pyx_t_1, __pyx_t_22); if (unlikely(!__pyx_t_23)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 487; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-        __Pyx_GOTREF(__pyx_t_23);
-        __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-        __Pyx_DECREF(__pyx_t_22); __pyx_t_22 = 0;
-        __pyx_t_9 = PyList_Append(__pyx_t_7, (PyObject*)__pyx_t_23); if (unlikely(__pyx_t_9)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 487; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-        __Pyx_DECREF(__pyx_t_23); __pyx_t_23 = 0;
-      }
-      __pyx_t_9 = PyList_Append(__pyx_t_3, (PyObject*)__pyx_t_7); if (unlikely(__pyx_t_9)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 487; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-      __Pyx_DECREF(((PyObject *)__pyx_t_7)); __pyx_t_7 = 0;
-    }
-    __pyx_t_9 = PyList_Append(__pyx_t_2, (PyObject*)__pyx_t_3); if (unlikely(__pyx_t_9)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 487; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __Pyx_DECREF(((PyObject *)__pyx_t_3)); __pyx_t_3 = 0;
-  }
-  __pyx_t_3 = PyTuple_New(1); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 487; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_3));
-  __Pyx_INCREF(((PyObject *)__pyx_t_2));
-  PyTuple_SET_ITEM(__pyx_t_3, 0, ((PyObject *)__pyx_t_2));
-  __Pyx_GIVEREF(((PyObject *)__pyx_t_2));
-  __Pyx_DECREF(((PyObject *)__pyx_t_2)); __pyx_t_2 = 0;
-  __pyx_t_2 = PyObject_Call(__pyx_t_6, ((PyObject *)__pyx_t_3), NULL); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 487; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_2);
-  __Pyx_DECREF(__pyx_t_6); __pyx_t_6 = 0;
-  __Pyx_DECREF(((PyObject *)__pyx_t_3)); __pyx_t_3 = 0;
-  __pyx_t_3 = PyObject_GetAttr(__pyx_t_2, __pyx_kp_ravel); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 487; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_3);
-  __Pyx_DECREF(__pyx_t_2); __pyx_t_2 = 0;
-  __pyx_t_2 = PyObject_Call(__pyx_t_3, ((PyObject *)__pyx_empty_tuple), NULL); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 487; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_2);
-  __Pyx_DECREF(__pyx_t_3); __pyx_t_3 = 0;
-  if (!(__Pyx_TypeTest(__pyx_t_2, __pyx_ptype_5numpy_ndarray))) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 487; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __pyx_t_24 = ((PyArrayObject *)__pyx_t_2);
-  {
-    __Pyx_BufFmt_StackElem __pyx_stack[1];
-    __Pyx_SafeReleaseBuffer(&__pyx_bstruct_cvertices);
-    __pyx_t_9 = __Pyx_GetBufferAndValidate(&__pyx_bstruct_cvertices, (PyObject*)__pyx_t_24, &__Pyx_TypeInfo_nn___pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_int_t, PyBUF_FORMAT| PyBUF_STRIDES, 1, 0, __pyx_stack);
-    if (unlikely(__pyx_t_9 < 0)) {
-      PyErr_Fetch(&__pyx_t_10, &__pyx_t_11, &__pyx_t_12);
-      if (unlikely(__Pyx_GetBufferAndValidate(&__pyx_bstruct_cvertices, (PyObject*)__pyx_v_cvertices, &__Pyx_TypeInfo_nn___pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_int_t, PyBUF_FORMAT| PyBUF_STRIDES, 1, 0, __pyx_stack) == -1)) {
-        Py_XDECREF(__pyx_t_10); Py_XDECREF(__pyx_t_11); Py_XDECREF(__pyx_t_12);
-        __Pyx_RaiseBufferFallbackError();
-      } else {
-        PyErr_Restore(__pyx_t_10, __pyx_t_11, __pyx_t_12);
-      }
-    }
-    __pyx_bstride_0_cvertices = __pyx_bstruct_cvertices.strides[0];
-    __pyx_bshape_0_cvertices = __pyx_bstruct_cvertices.shape[0];
-    if (unlikely(__pyx_t_9 < 0)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 487; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  }
-  __pyx_t_24 = 0;
-  __Pyx_DECREF(((PyObject *)__pyx_v_cvertices));
-  __pyx_v_cvertices = ((PyArrayObject *)__pyx_t_2);
-  __pyx_t_2 = 0;
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":488
- *     dstrides = np.empty((s0-1, s1-1, s2-1), np.bool).strides
- *     cvertices = np.array([[[dstrides[0]*i+dstrides[1]*j+dstrides[2]*k for i in range(2)] for j in range(2)] for k in range(2)]).ravel()
- *     cvertices.sort()             # <<<<<<<<<<<<<<
- * 
- *     union = join_complexes(*[cube_with_strides_center((0,0,1), strides),
- */
-  __pyx_t_2 = PyObject_GetAttr(((PyObject *)__pyx_v_cvertices), __pyx_kp_sort); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 488; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_2);
-  __pyx_t_3 = PyObject_Call(__pyx_t_2, ((PyObject *)__pyx_empty_tuple), NULL); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 488; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_3);
-  __Pyx_DECREF(__pyx_t_2); __pyx_t_2 = 0;
-  __Pyx_DECREF(__pyx_t_3); __pyx_t_3 = 0;
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":490
- *     cvertices.sort()
- * 
- *     union = join_complexes(*[cube_with_strides_center((0,0,1), strides),             # <<<<<<<<<<<<<<
- *                              cube_with_strides_center((0,1,0), strides),
- *                              cube_with_strides_center((0,1,1), strides),
- */
-  __pyx_3 = __Pyx_GetName(__pyx_m, __pyx_kp_join_complexes); if (unlikely(!__pyx_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 490; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_3);
-  __pyx_1 = __Pyx_GetName(__pyx_m, __pyx_kp_43); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 490; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_1);
-  __pyx_t_3 = PyTuple_New(3); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 490; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_3));
-  __Pyx_INCREF(__pyx_int_0);
-  PyTuple_SET_ITEM(__pyx_t_3, 0, __pyx_int_0);
-  __Pyx_GIVEREF(__pyx_int_0);
-  __Pyx_INCREF(__pyx_int_0);
-  PyTuple_SET_ITEM(__pyx_t_3, 1, __pyx_int_0);
-  __Pyx_GIVEREF(__pyx_int_0);
-  __Pyx_INCREF(__pyx_int_1);
-  PyTuple_SET_ITEM(__pyx_t_3, 2, __pyx_int_1);
-  __Pyx_GIVEREF(__pyx_int_1);
-  __pyx_t_2 = PyTuple_New(2); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 490; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_2));
-  PyTuple_SET_ITEM(__pyx_t_2, 0, ((PyObject *)__pyx_t_3));
-  __Pyx_GIVEREF(((PyObject *)__pyx_t_3));
-  __Pyx_INCREF(__pyx_v_strides);
-  PyTuple_SET_ITEM(__pyx_t_2, 1, __pyx_v_strides);
-  __Pyx_GIVEREF(__pyx_v_strides);
-  __pyx_t_3 = 0;
-  __pyx_t_3 = PyObject_Call(__pyx_1, ((PyObject *)__pyx_t_2), NULL); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 490; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_3);
-  __Pyx_DECREF(__pyx_1); __pyx_1 = 0;
-  __Pyx_DECREF(((PyObject *)__pyx_t_2)); __pyx_t_2 = 0;
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":491
- * 
- *     union = join_complexes(*[cube_with_strides_center((0,0,1), strides),
- *                              cube_with_strides_center((0,1,0), strides),             # <<<<<<<<<<<<<<
- *                              cube_with_strides_center((0,1,1), strides),
- *                              cube_with_strides_center((1,0,0), strides),
- */
-  __pyx_2 = __Pyx_GetName(__pyx_m, __pyx_kp_43); if (unlikely(!__pyx_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 491; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_2);
-  __pyx_t_2 = PyTuple_New(3); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 491; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_2));
-  __Pyx_INCREF(__pyx_int_0);
-  PyTuple_SET_ITEM(__pyx_t_2, 0, __pyx_int_0);
-  __Pyx_GIVEREF(__pyx_int_0);
-  __Pyx_INCREF(__pyx_int_1);
-  PyTuple_SET_ITEM(__pyx_t_2, 1, __pyx_int_1);
-  __Pyx_GIVEREF(__pyx_int_1);
-  __Pyx_INCREF(__pyx_int_0);
-  PyTuple_SET_ITEM(__pyx_t_2, 2, __pyx_int_0);
-  __Pyx_GIVEREF(__pyx_int_0);
-  __pyx_t_6 = PyTuple_New(2); if (unlikely(!__pyx_t_6)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 491; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_6));
-  PyTuple_SET_ITEM(__pyx_t_6, 0, ((PyObject *)__pyx_t_2));
-  __Pyx_GIVEREF(((PyObject *)__pyx_t_2));
-  __Pyx_INCREF(__pyx_v_strides);
-  PyTuple_SET_ITEM(__pyx_t_6, 1, __pyx_v_strides);
-  __Pyx_GIVEREF(__pyx_v_strides);
-  __pyx_t_2 = 0;
-  __pyx_t_2 = PyObject_Call(__pyx_2, ((PyObject *)__pyx_t_6), NULL); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 491; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_2);
-  __Pyx_DECREF(__pyx_2); __pyx_2 = 0;
-  __Pyx_DECREF(((PyObject *)__pyx_t_6)); __pyx_t_6 = 0;
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":492
- *     union = join_complexes(*[cube_with_strides_center((0,0,1), strides),
- *                              cube_with_strides_center((0,1,0), strides),
- *                              cube_with_strides_center((0,1,1), strides),             # <<<<<<<<<<<<<<
- *                              cube_with_strides_center((1,0,0), strides),
- *                              cube_with_strides_center((1,0,1), strides),
- */
-  __pyx_1 = __Pyx_GetName(__pyx_m, __pyx_kp_43); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 492; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_1);
-  __pyx_t_6 = PyTuple_New(3); if (unlikely(!__pyx_t_6)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 492; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_6));
-  __Pyx_INCREF(__pyx_int_0);
-  PyTuple_SET_ITEM(__pyx_t_6, 0, __pyx_int_0);
-  __Pyx_GIVEREF(__pyx_int_0);
-  __Pyx_INCREF(__pyx_int_1);
-  PyTuple_SET_ITEM(__pyx_t_6, 1, __pyx_int_1);
-  __Pyx_GIVEREF(__pyx_int_1);
-  __Pyx_INCREF(__pyx_int_1);
-  PyTuple_SET_ITEM(__pyx_t_6, 2, __pyx_int_1);
-  __Pyx_GIVEREF(__pyx_int_1);
-  __pyx_t_7 = PyTuple_New(2); if (unlikely(!__pyx_t_7)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 492; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_7));
-  PyTuple_SET_ITEM(__pyx_t_7, 0, ((PyObject *)__pyx_t_6));
-  __Pyx_GIVEREF(((PyObject *)__pyx_t_6));
-  __Pyx_INCREF(__pyx_v_strides);
-  PyTuple_SET_ITEM(__pyx_t_7, 1, __pyx_v_strides);
-  __Pyx_GIVEREF(__pyx_v_strides);
-  __pyx_t_6 = 0;
-  __pyx_t_6 = PyObject_Call(__pyx_1, ((PyObject *)__pyx_t_7), NULL); if (unlikely(!__pyx_t_6)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 492; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_6);
-  __Pyx_DECREF(__pyx_1); __pyx_1 = 0;
-  __Pyx_DECREF(((PyObject *)__pyx_t_7)); __pyx_t_7 = 0;
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":493
- *                              cube_with_strides_center((0,1,0), strides),
- *                              cube_with_strides_center((0,1,1), strides),
- *                              cube_with_strides_center((1,0,0), strides),             # <<<<<<<<<<<<<<
- *                              cube_with_strides_center((1,0,1), strides),
- *                              cube_with_strides_center((1,1,0), strides),
- */
-  __pyx_2 = __Pyx_GetName(__pyx_m, __pyx_kp_43); if (unlikely(!__pyx_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 493; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_2);
-  __pyx_t_7 = PyTuple_New(3); if (unlikely(!__pyx_t_7)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 493; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_7));
-  __Pyx_INCREF(__pyx_int_1);
-  PyTuple_SET_ITEM(__pyx_t_7, 0, __pyx_int_1);
-  __Pyx_GIVEREF(__pyx_int_1);
-  __Pyx_INCREF(__pyx_int_0);
-  PyTuple_SET_ITEM(__pyx_t_7, 1, __pyx_int_0);
-  __Pyx_GIVEREF(__pyx_int_0);
-  __Pyx_INCREF(__pyx_int_0);
-  PyTuple_SET_ITEM(__pyx_t_7, 2, __pyx_int_0);
-  __Pyx_GIVEREF(__pyx_int_0);
-  __pyx_t_23 = PyTuple_New(2); if (unlikely(!__pyx_t_23)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 493; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_23));
-  PyTuple_SET_ITEM(__pyx_t_23, 0, ((PyObject *)__pyx_t_7));
-  __Pyx_GIVEREF(((PyObject *)__pyx_t_7));
-  __Pyx_INCREF(__pyx_v_strides);
-  PyTuple_SET_ITEM(__pyx_t_23, 1, __pyx_v_strides);
-  __Pyx_GIVEREF(__pyx_v_strides);
-  __pyx_t_7 = 0;
-  __pyx_t_7 = PyObject_Call(__pyx_2, ((PyObject *)__pyx_t_23), NULL); if (unlikely(!__pyx_t_7)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 493; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_7);
-  __Pyx_DECREF(__pyx_2); __pyx_2 = 0;
-  __Pyx_DECREF(((PyObject *)__pyx_t_23)); __pyx_t_23 = 0;
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":494
- *                              cube_with_strides_center((0,1,1), strides),
- *                              cube_with_strides_center((1,0,0), strides),
- *                              cube_with_strides_center((1,0,1), strides),             # <<<<<<<<<<<<<<
- *                              cube_with_strides_center((1,1,0), strides),
- *                              cube_with_strides_center((1,1,1), strides)])
- */
-  __pyx_1 = __Pyx_GetName(__pyx_m, __pyx_kp_43); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 494; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_1);
-  __pyx_t_23 = PyTuple_New(3); if (unlikely(!__pyx_t_23)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 494; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_23));
-  __Pyx_INCREF(__pyx_int_1);
-  PyTuple_SET_ITEM(__pyx_t_23, 0, __pyx_int_1);
-  __Pyx_GIVEREF(__pyx_int_1);
-  __Pyx_INCREF(__pyx_int_0);
-  PyTuple_SET_ITEM(__pyx_t_23, 1, __pyx_int_0);
-  __Pyx_GIVEREF(__pyx_int_0);
-  __Pyx_INCREF(__pyx_int_1);
-  PyTuple_SET_ITEM(__pyx_t_23, 2, __pyx_int_1);
-  __Pyx_GIVEREF(__pyx_int_1);
-  __pyx_t_22 = PyTuple_New(2); if (unlikely(!__pyx_t_22)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 494; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_22));
-  PyTuple_SET_ITEM(__pyx_t_22, 0, ((PyObject *)__pyx_t_23));
-  __Pyx_GIVEREF(((PyObject *)__pyx_t_23));
-  __Pyx_INCREF(__pyx_v_strides);
-  PyTuple_SET_ITEM(__pyx_t_22, 1, __pyx_v_strides);
-  __Pyx_GIVEREF(__pyx_v_strides);
-  __pyx_t_23 = 0;
-  __pyx_t_23 = PyObject_Call(__pyx_1, ((PyObject *)__pyx_t_22), NULL); if (unlikely(!__pyx_t_23)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 494; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_23);
-  __Pyx_DECREF(__pyx_1); __pyx_1 = 0;
-  __Pyx_DECREF(((PyObject *)__pyx_t_22)); __pyx_t_22 = 0;
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":495
- *                              cube_with_strides_center((1,0,0), strides),
- *                              cube_with_strides_center((1,0,1), strides),
- *                              cube_with_strides_center((1,1,0), strides),             # <<<<<<<<<<<<<<
- *                              cube_with_strides_center((1,1,1), strides)])
- *     c = cube_with_strides_center((0,0,0), strides)
- */
-  __pyx_2 = __Pyx_GetName(__pyx_m, __pyx_kp_43); if (unlikely(!__pyx_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 495; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_2);
-  __pyx_t_22 = PyTuple_New(3); if (unlikely(!__pyx_t_22)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 495; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_22));
-  __Pyx_INCREF(__pyx_int_1);
-  PyTuple_SET_ITEM(__pyx_t_22, 0, __pyx_int_1);
-  __Pyx_GIVEREF(__pyx_int_1);
-  __Pyx_INCREF(__pyx_int_1);
-  PyTuple_SET_ITEM(__pyx_t_22, 1, __pyx_int_1);
-  __Pyx_GIVEREF(__pyx_int_1);
-  __Pyx_INCREF(__pyx_int_0);
-  PyTuple_SET_ITEM(__pyx_t_22, 2, __pyx_int_0);
-  __Pyx_GIVEREF(__pyx_int_0);
-  __pyx_t_1 = PyTuple_New(2); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 495; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_1));
-  PyTuple_SET_ITEM(__pyx_t_1, 0, ((PyObject *)__pyx_t_22));
-  __Pyx_GIVEREF(((PyObject *)__pyx_t_22));
-  __Pyx_INCREF(__pyx_v_strides);
-  PyTuple_SET_ITEM(__pyx_t_1, 1, __pyx_v_strides);
-  __Pyx_GIVEREF(__pyx_v_strides);
-  __pyx_t_22 = 0;
-  __pyx_t_22 = PyObject_Call(__pyx_2, ((PyObject *)__pyx_t_1), NULL); if (unlikely(!__pyx_t_22)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 495; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_22);
-  __Pyx_DECREF(__pyx_2); __pyx_2 = 0;
-  __Pyx_DECREF(((PyObject *)__pyx_t_1)); __pyx_t_1 = 0;
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":496
- *                              cube_with_strides_center((1,0,1), strides),
- *                              cube_with_strides_center((1,1,0), strides),
- *                              cube_with_strides_center((1,1,1), strides)])             # <<<<<<<<<<<<<<
- *     c = cube_with_strides_center((0,0,0), strides)
- *     m4 = np.array(list(c[4].difference(union[4])))
- */
-  __pyx_1 = __Pyx_GetName(__pyx_m, __pyx_kp_43); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 496; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_1);
-  __pyx_t_1 = PyTuple_New(3); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 496; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_1));
-  __Pyx_INCREF(__pyx_int_1);
-  PyTuple_SET_ITEM(__pyx_t_1, 0, __pyx_int_1);
-  __Pyx_GIVEREF(__pyx_int_1);
-  __Pyx_INCREF(__pyx_int_1);
-  PyTuple_SET_ITEM(__pyx_t_1, 1, __pyx_int_1);
-  __Pyx_GIVEREF(__pyx_int_1);
-  __Pyx_INCREF(__pyx_int_1);
-  PyTuple_SET_ITEM(__pyx_t_1, 2, __pyx_int_1);
-  __Pyx_GIVEREF(__pyx_int_1);
-  __pyx_t_25 = PyTuple_New(2); if (unlikely(!__pyx_t_25)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 496; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_25));
-  PyTuple_SET_ITEM(__pyx_t_25, 0, ((PyObject *)__pyx_t_1));
-  __Pyx_GIVEREF(((PyObject *)__pyx_t_1));
-  __Pyx_INCREF(__pyx_v_strides);
-  PyTuple_SET_ITEM(__pyx_t_25, 1, __pyx_v_strides);
-  __Pyx_GIVEREF(__pyx_v_strides);
-  __pyx_t_1 = 0;
-  __pyx_t_1 = PyObject_Call(__pyx_1, ((PyObject *)__pyx_t_25), NULL); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 496; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_1);
-  __Pyx_DECREF(__pyx_1); __pyx_1 = 0;
-  __Pyx_DECREF(((PyObject *)__pyx_t_25)); __pyx_t_25 = 0;
-  __pyx_t_25 = PyList_New(7); if (unlikely(!__pyx_t_25)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 490; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_25));
-  PyList_SET_ITEM(__pyx_t_25, 0, __pyx_t_3);
-  __Pyx_GIVEREF(__pyx_t_3);
-  PyList_SET_ITEM(__pyx_t_25, 1, __pyx_t_2);
-  __Pyx_GIVEREF(__pyx_t_2);
-  PyList_SET_ITEM(__pyx_t_25, 2, __pyx_t_6);
-  __Pyx_GIVEREF(__pyx_t_6);
-  PyList_SET_ITEM(__pyx_t_25, 3, __pyx_t_7);
-  __Pyx_GIVEREF(__pyx_t_7);
-  PyList_SET_ITEM(__pyx_t_25, 4, __pyx_t_23);
-  __Pyx_GIVEREF(__pyx_t_23);
-  PyList_SET_ITEM(__pyx_t_25, 5, __pyx_t_22);
-  __Pyx_GIVEREF(__pyx_t_22);
-  PyList_SET_ITEM(__pyx_t_25, 6, __pyx_t_1);
-  __Pyx_GIVEREF(__pyx_t_1);
-  __pyx_t_3 = 0;
-  __pyx_t_2 = 0;
-  __pyx_t_6 = 0;
-  __pyx_t_7 = 0;
-  __pyx_t_23 = 0;
-  __pyx_t_22 = 0;
-  __pyx_t_1 = 0;
-  __pyx_2 = PySequence_Tuple(((PyObject *)__pyx_t_25)); if (unlikely(!__pyx_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 490; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_2));
-  __Pyx_DECREF(((PyObject *)__pyx_t_25)); __pyx_t_25 = 0;
-  __pyx_t_25 = PyObject_Call(__pyx_3, ((PyObject *)__pyx_2), NULL); if (unlikely(!__pyx_t_25)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 490; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_25);
-  __Pyx_DECREF(__pyx_3); __pyx_3 = 0;
-  __Pyx_DECREF(((PyObject *)__pyx_2)); __pyx_2 = 0;
-  __Pyx_DECREF(__pyx_v_union);
-  __pyx_v_union = __pyx_t_25;
-  __pyx_t_25 = 0;
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":497
- *                              cube_with_strides_center((1,1,0), strides),
- *                              cube_with_strides_center((1,1,1), strides)])
- *     c = cube_with_strides_center((0,0,0), strides)             # <<<<<<<<<<<<<<
- *     m4 = np.array(list(c[4].difference(union[4])))
- *     m3 = np.array(list(c[3].difference(union[3])))
- */
-  __pyx_1 = __Pyx_GetName(__pyx_m, __pyx_kp_43); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 497; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_1);
-  __pyx_t_25 = PyTuple_New(3); if (unlikely(!__pyx_t_25)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 497; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_25));
-  __Pyx_INCREF(__pyx_int_0);
-  PyTuple_SET_ITEM(__pyx_t_25, 0, __pyx_int_0);
-  __Pyx_GIVEREF(__pyx_int_0);
-  __Pyx_INCREF(__pyx_int_0);
-  PyTuple_SET_ITEM(__pyx_t_25, 1, __pyx_int_0);
-  __Pyx_GIVEREF(__pyx_int_0);
-  __Pyx_INCREF(__pyx_int_0);
-  PyTuple_SET_ITEM(__pyx_t_25, 2, __pyx_int_0);
-  __Pyx_GIVEREF(__pyx_int_0);
-  __pyx_t_1 = PyTuple_New(2); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 497; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_1));
-  PyTuple_SET_ITEM(__pyx_t_1, 0, ((PyObject *)__pyx_t_25));
-  __Pyx_GIVEREF(((PyObject *)__pyx_t_25));
-  __Pyx_INCREF(__pyx_v_strides);
-  PyTuple_SET_ITEM(__pyx_t_1, 1, __pyx_v_strides);
-  __Pyx_GIVEREF(__pyx_v_strides);
-  __pyx_t_25 = 0;
-  __pyx_t_25 = PyObject_Call(__pyx_1, ((PyObject *)__pyx_t_1), NULL); if (unlikely(!__pyx_t_25)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 497; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_25);
-  __Pyx_DECREF(__pyx_1); __pyx_1 = 0;
-  __Pyx_DECREF(((PyObject *)__pyx_t_1)); __pyx_t_1 = 0;
-  __Pyx_DECREF(__pyx_v_c);
-  __pyx_v_c = __pyx_t_25;
-  __pyx_t_25 = 0;
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":498
- *                              cube_with_strides_center((1,1,1), strides)])
- *     c = cube_with_strides_center((0,0,0), strides)
- *     m4 = np.array(list(c[4].difference(union[4])))             # <<<<<<<<<<<<<<
- *     m3 = np.array(list(c[3].difference(union[3])))
- *     m2 = np.array(list(c[2].difference(union[2])))
- */
-  __pyx_3 = __Pyx_GetName(__pyx_m, __pyx_kp_np); if (unlikely(!__pyx_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 498; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_3);
-  __pyx_t_25 = PyObject_GetAttr(__pyx_3, __pyx_kp_array); if (unlikely(!__pyx_t_25)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 498; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_25);
-  __Pyx_DECREF(__pyx_3); __pyx_3 = 0;
-  __pyx_2 = __Pyx_GetItemInt(__pyx_v_c, 4, sizeof(long), PyInt_FromLong); if (!__pyx_2) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 498; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_2);
-  __pyx_t_1 = PyObject_GetAttr(__pyx_2, __pyx_kp_difference); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 498; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_1);
-  __Pyx_DECREF(__pyx_2); __pyx_2 = 0;
-  __pyx_1 = __Pyx_GetItemInt(__pyx_v_union, 4, sizeof(long), PyInt_FromLong); if (!__pyx_1) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 498; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_1);
-  __pyx_t_22 = PyTuple_New(1); if (unlikely(!__pyx_t_22)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 498; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_22));
-  PyTuple_SET_ITEM(__pyx_t_22, 0, __pyx_1);
-  __Pyx_GIVEREF(__pyx_1);
-  __pyx_1 = 0;
-  __pyx_t_23 = PyObject_Call(__pyx_t_1, ((PyObject *)__pyx_t_22), NULL); if (unlikely(!__pyx_t_23)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 498; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_23);
-  __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-  __Pyx_DECREF(((PyObject *)__pyx_t_22)); __pyx_t_22 = 0;
-  __pyx_t_22 = PyTuple_New(1); if (unlikely(!__pyx_t_22)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 498; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_22));
-  PyTuple_SET_ITEM(__pyx_t_22, 0, __pyx_t_23);
-  __Pyx_GIVEREF(__pyx_t_23);
-  __pyx_t_23 = 0;
-  __pyx_t_23 = PyObject_Call(((PyObject *)((PyObject*)&PyList_Type)), ((PyObject *)__pyx_t_22), NULL); if (unlikely(!__pyx_t_23)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 498; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_23);
-  __Pyx_DECREF(((PyObject *)__pyx_t_22)); __pyx_t_22 = 0;
-  __pyx_t_22 = PyTuple_New(1); if (unlikely(!__pyx_t_22)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 498; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_22));
-  PyTuple_SET_ITEM(__pyx_t_22, 0, __pyx_t_23);
-  __Pyx_GIVEREF(__pyx_t_23);
-  __pyx_t_23 = 0;
-  __pyx_t_23 = PyObject_Call(__pyx_t_25, ((PyObject *)__pyx_t_22), NULL); if (unlikely(!__pyx_t_23)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 498; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_23);
-  __Pyx_DECREF(__pyx_t_25); __pyx_t_25 = 0;
-  __Pyx_DECREF(((PyObject *)__pyx_t_22)); __pyx_t_22 = 0;
-  if (!(__Pyx_TypeTest(__pyx_t_23, __pyx_ptype_5numpy_ndarray))) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 498; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __pyx_t_26 = ((PyArrayObject *)__pyx_t_23);
-  {
-    __Pyx_BufFmt_StackElem __pyx_stack[1];
-    __Pyx_SafeReleaseBuffer(&__pyx_bstruct_m4);
-    __pyx_t_9 = __Pyx_GetBufferAndValidate(&__pyx_bstruct_m4, (PyObject*)__pyx_t_26, &__Pyx_TypeInfo_nn___pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_int_t, PyBUF_FORMAT| PyBUF_STRIDES, 2, 0, __pyx_stack);
-    if (unlikely(__pyx_t_9 < 0)) {
-      PyErr_Fetch(&__pyx_t_12, &__pyx_t_11, &__pyx_t_10);
-      if (unlikely(__Pyx_GetBufferAndValidate(&__pyx_bstruct_m4, (PyObject*)__pyx_v_m4, &__Pyx_TypeInfo_nn___pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_int_t, PyBUF_FORMAT| PyBUF_STRIDES, 2, 0, __pyx_stack) == -1)) {
-        Py_XDECREF(__pyx_t_12); Py_XDECREF(__pyx_t_11); Py_XDECREF(__pyx_t_10);
-        __Pyx_RaiseBufferFallbackError();
-      } else {
-        PyErr_Restore(__pyx_t_12, __pyx_t_11, __pyx_t_10);
-      }
-    }
-    __pyx_bstride_0_m4 = __pyx_bstruct_m4.strides[0]; __pyx_bstride_1_m4 = __pyx_bstruct_m4.strides[1];
-    __pyx_bshape_0_m4 = __pyx_bstruct_m4.shape[0]; __pyx_bshape_1_m4 = __pyx_bstruct_m4.shape[1];
-    if (unlikely(__pyx_t_9 < 0)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 498; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  }
-  __pyx_t_26 = 0;
-  __Pyx_DECREF(((PyObject *)__pyx_v_m4));
-  __pyx_v_m4 = ((PyArrayObject *)__pyx_t_23);
-  __pyx_t_23 = 0;
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":499
- *     c = cube_with_strides_center((0,0,0), strides)
- *     m4 = np.array(list(c[4].difference(union[4])))
- *     m3 = np.array(list(c[3].difference(union[3])))             # <<<<<<<<<<<<<<
- *     m2 = np.array(list(c[2].difference(union[2])))
- * 
- */
-  __pyx_3 = __Pyx_GetName(__pyx_m, __pyx_kp_np); if (unlikely(!__pyx_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 499; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_3);
-  __pyx_t_23 = PyObject_GetAttr(__pyx_3, __pyx_kp_array); if (unlikely(!__pyx_t_23)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 499; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_23);
-  __Pyx_DECREF(__pyx_3); __pyx_3 = 0;
-  __pyx_2 = __Pyx_GetItemInt(__pyx_v_c, 3, sizeof(long), PyInt_FromLong); if (!__pyx_2) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 499; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_2);
-  __pyx_t_22 = PyObject_GetAttr(__pyx_2, __pyx_kp_difference); if (unlikely(!__pyx_t_22)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 499; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_22);
-  __Pyx_DECREF(__pyx_2); __pyx_2 = 0;
-  __pyx_1 = __Pyx_GetItemInt(__pyx_v_union, 3, sizeof(long), PyInt_FromLong); if (!__pyx_1) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 499; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_1);
-  __pyx_t_25 = PyTuple_New(1); if (unlikely(!__pyx_t_25)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 499; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_25));
-  PyTuple_SET_ITEM(__pyx_t_25, 0, __pyx_1);
-  __Pyx_GIVEREF(__pyx_1);
-  __pyx_1 = 0;
-  __pyx_t_1 = PyObject_Call(__pyx_t_22, ((PyObject *)__pyx_t_25), NULL); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 499; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_1);
-  __Pyx_DECREF(__pyx_t_22); __pyx_t_22 = 0;
-  __Pyx_DECREF(((PyObject *)__pyx_t_25)); __pyx_t_25 = 0;
-  __pyx_t_25 = PyTuple_New(1); if (unlikely(!__pyx_t_25)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 499; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_25));
-  PyTuple_SET_ITEM(__pyx_t_25, 0, __pyx_t_1);
-  __Pyx_GIVEREF(__pyx_t_1);
-  __pyx_t_1 = 0;
-  __pyx_t_1 = PyObject_Call(((PyObject *)((PyObject*)&PyList_Type)), ((PyObject *)__pyx_t_25), NULL); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 499; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_1);
-  __Pyx_DECREF(((PyObject *)__pyx_t_25)); __pyx_t_25 = 0;
-  __pyx_t_25 = PyTuple_New(1); if (unlikely(!__pyx_t_25)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 499; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_25));
-  PyTuple_SET_ITEM(__pyx_t_25, 0, __pyx_t_1);
-  __Pyx_GIVEREF(__pyx_t_1);
-  __pyx_t_1 = 0;
-  __pyx_t_1 = PyObject_Call(__pyx_t_23, ((PyObject *)__pyx_t_25), NULL); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 499; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_1);
-  __Pyx_DECREF(__pyx_t_23); __pyx_t_23 = 0;
-  __Pyx_DECREF(((PyObject *)__pyx_t_25)); __pyx_t_25 = 0;
-  if (!(__Pyx_TypeTest(__pyx_t_1, __pyx_ptype_5numpy_ndarray))) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 499; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __pyx_t_27 = ((PyArrayObject *)__pyx_t_1);
-  {
-    __Pyx_BufFmt_StackElem __pyx_stack[1];
-    __Pyx_SafeReleaseBuffer(&__pyx_bstruct_m3);
-    __pyx_t_9 = __Pyx_GetBufferAndValidate(&__pyx_bstruct_m3, (PyObject*)__pyx_t_27, &__Pyx_TypeInfo_nn___pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_int_t, PyBUF_FORMAT| PyBUF_STRIDES, 2, 0, __pyx_stack);
-    if (unlikely(__pyx_t_9 < 0)) {
-      PyErr_Fetch(&__pyx_t_10, &__pyx_t_11, &__pyx_t_12);
-      if (unlikely(__Pyx_GetBufferAndValidate(&__pyx_bstruct_m3, (PyObject*)__pyx_v_m3, &__Pyx_TypeInfo_nn___pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_int_t, PyBUF_FORMAT| PyBUF_STRIDES, 2, 0, __pyx_stack) == -1)) {
-        Py_XDECREF(__pyx_t_10); Py_XDECREF(__pyx_t_11); Py_XDECREF(__pyx_t_12);
-        __Pyx_RaiseBufferFallbackError();
-      } else {
-        PyErr_Restore(__pyx_t_10, __pyx_t_11, __pyx_t_12);
-      }
-    }
-    __pyx_bstride_0_m3 = __pyx_bstruct_m3.strides[0]; __pyx_bstride_1_m3 = __pyx_bstruct_m3.strides[1];
-    __pyx_bshape_0_m3 = __pyx_bstruct_m3.shape[0]; __pyx_bshape_1_m3 = __pyx_bstruct_m3.shape[1];
-    if (unlikely(__pyx_t_9 < 0)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 499; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  }
-  __pyx_t_27 = 0;
-  __Pyx_DECREF(((PyObject *)__pyx_v_m3));
-  __pyx_v_m3 = ((PyArrayObject *)__pyx_t_1);
-  __pyx_t_1 = 0;
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":500
- *     m4 = np.array(list(c[4].difference(union[4])))
- *     m3 = np.array(list(c[3].difference(union[3])))
- *     m2 = np.array(list(c[2].difference(union[2])))             # <<<<<<<<<<<<<<
- * 
- *     d4 = np.array([[_convert_stride3(v, strides, (4,2,1)) for v in m4[i]] for i in range(m4.shape[0])])
- */
-  __pyx_3 = __Pyx_GetName(__pyx_m, __pyx_kp_np); if (unlikely(!__pyx_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 500; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_3);
-  __pyx_t_1 = PyObject_GetAttr(__pyx_3, __pyx_kp_array); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 500; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_1);
-  __Pyx_DECREF(__pyx_3); __pyx_3 = 0;
-  __pyx_2 = __Pyx_GetItemInt(__pyx_v_c, 2, sizeof(long), PyInt_FromLong); if (!__pyx_2) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 500; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_2);
-  __pyx_t_25 = PyObject_GetAttr(__pyx_2, __pyx_kp_difference); if (unlikely(!__pyx_t_25)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 500; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_25);
-  __Pyx_DECREF(__pyx_2); __pyx_2 = 0;
-  __pyx_1 = __Pyx_GetItemInt(__pyx_v_union, 2, sizeof(long), PyInt_FromLong); if (!__pyx_1) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 500; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_1);
-  __pyx_t_23 = PyTuple_New(1); if (unlikely(!__pyx_t_23)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 500; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_23));
-  PyTuple_SET_ITEM(__pyx_t_23, 0, __pyx_1);
-  __Pyx_GIVEREF(__pyx_1);
-  __pyx_1 = 0;
-  __pyx_t_22 = PyObject_Call(__pyx_t_25, ((PyObject *)__pyx_t_23), NULL); if (unlikely(!__pyx_t_22)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 500; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_22);
-  __Pyx_DECREF(__pyx_t_25); __pyx_t_25 = 0;
-  __Pyx_DECREF(((PyObject *)__pyx_t_23)); __pyx_t_23 = 0;
-  __pyx_t_23 = PyTuple_New(1); if (unlikely(!__pyx_t_23)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 500; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_23));
-  PyTuple_SET_ITEM(__pyx_t_23, 0, __pyx_t_22);
-  __Pyx_GIVEREF(__pyx_t_22);
-  __pyx_t_22 = 0;
-  __pyx_t_22 = PyObject_Call(((PyObject *)((PyObject*)&PyList_Type)), ((PyObject *)__pyx_t_23), NULL); if (unlikely(!__pyx_t_22)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 500; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_22);
-  __Pyx_DECREF(((PyObject *)__pyx_t_23)); __pyx_t_23 = 0;
-  __pyx_t_23 = PyTuple_New(1); if (unlikely(!__pyx_t_23)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 500; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_23));
-  PyTuple_SET_ITEM(__pyx_t_23, 0, __pyx_t_22);
-  __Pyx_GIVEREF(__pyx_t_22);
-  __pyx_t_22 = 0;
-  __pyx_t_22 = PyObject_Call(__pyx_t_1, ((PyObject *)__pyx_t_23), NULL); if (unlikely(!__pyx_t_22)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 500; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_22);
-  __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-  __Pyx_DECREF(((PyObject *)__pyx_t_23)); __pyx_t_23 = 0;
-  if (!(__Pyx_TypeTest(__pyx_t_22, __pyx_ptype_5numpy_ndarray))) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 500; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __pyx_t_28 = ((PyArrayObject *)__pyx_t_22);
-  {
-    __Pyx_BufFmt_StackElem __pyx_stack[1];
-    __Pyx_SafeReleaseBuffer(&__pyx_bstruct_m2);
-    __pyx_t_9 = __Pyx_GetBufferAndValidate(&__pyx_bstruct_m2, (PyObject*)__pyx_t_28, &__Pyx_TypeInfo_nn___pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_int_t, PyBUF_FORMAT| PyBUF_STRIDES, 2, 0, __pyx_stack);
-    if (unlikely(__pyx_t_9 < 0)) {
-      PyErr_Fetch(&__pyx_t_12, &__pyx_t_11, &__pyx_t_10);
-      if (unlikely(__Pyx_GetBufferAndValidate(&__pyx_bstruct_m2, (PyObject*)__pyx_v_m2, &__Pyx_TypeInfo_nn___pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_int_t, PyBUF_FORMAT| PyBUF_STRIDES, 2, 0, __pyx_stack) == -1)) {
-        Py_XDECREF(__pyx_t_12); Py_XDECREF(__pyx_t_11); Py_XDECREF(__pyx_t_10);
-        __Pyx_RaiseBufferFallbackError();
-      } else {
-        PyErr_Restore(__pyx_t_12, __pyx_t_11, __pyx_t_10);
-      }
-    }
-    __pyx_bstride_0_m2 = __pyx_bstruct_m2.strides[0]; __pyx_bstride_1_m2 = __pyx_bstruct_m2.strides[1];
-    __pyx_bshape_0_m2 = __pyx_bstruct_m2.shape[0]; __pyx_bshape_1_m2 = __pyx_bstruct_m2.shape[1];
-    if (unlikely(__pyx_t_9 < 0)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 500; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  }
-  __pyx_t_28 = 0;
-  __Pyx_DECREF(((PyObject *)__pyx_v_m2));
-  __pyx_v_m2 = ((PyArrayObject *)__pyx_t_22);
-  __pyx_t_22 = 0;
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":502
- *     m2 = np.array(list(c[2].difference(union[2])))
- * 
- *     d4 = np.array([[_convert_stride3(v, strides, (4,2,1)) for v in m4[i]] for i in range(m4.shape[0])])             # <<<<<<<<<<<<<<
- *     d4 = np.hstack([m4, d4])
- *     ds4 = d4.shape[0]
- */
-  __pyx_3 = __Pyx_GetName(__pyx_m, __pyx_kp_np); if (unlikely(!__pyx_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 502; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_3);
-  __pyx_t_22 = PyObject_GetAttr(__pyx_3, __pyx_kp_array); if (unlikely(!__pyx_t_22)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 502; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_22);
-  __Pyx_DECREF(__pyx_3); __pyx_3 = 0;
-  __pyx_t_23 = PyList_New(0); if (unlikely(!__pyx_t_23)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 502; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_23));
-  for (__pyx_t_19 = 0; __pyx_t_19 < (__pyx_v_m4->dimensions[0]); __pyx_t_19+=1) {
-    __pyx_v_i = __pyx_t_19;
-    __pyx_t_1 = PyList_New(0); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 502; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __Pyx_GOTREF(((PyObject *)__pyx_t_1));
-    __pyx_2 = __Pyx_GetItemInt(((PyObject *)__pyx_v_m4), __pyx_v_i, sizeof(long), PyInt_FromLong); if (!__pyx_2) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 502; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __Pyx_GOTREF(__pyx_2);
-    if (PyList_CheckExact(__pyx_2) || PyTuple_CheckExact(__pyx_2)) {
-      __pyx_t_29 = 0; __pyx_t_25 = __pyx_2; __Pyx_INCREF(__pyx_t_25);
-    } else {
-      __pyx_t_29 = -1; __pyx_t_25 = PyObject_GetIter(__pyx_2); if (unlikely(!__pyx_t_25)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 502; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-      __Pyx_GOTREF(__pyx_t_25);
-    }
-    __Pyx_DECREF(__pyx_2); __pyx_2 = 0;
-    for (;;) {
-      if (likely(PyList_CheckExact(__pyx_t_25))) {
-        if (__pyx_t_29 >= PyList_GET_SIZE(__pyx_t_25)) break;
-        __pyx_t_7 = PyList_GET_ITEM(__pyx_t_25, __pyx_t_29); __Pyx_INCREF(__pyx_t_7); __pyx_t_29++;
-      } else if (likely(PyTuple_CheckExact(__pyx_t_25))) {
-        if (__pyx_t_29 >= PyTuple_GET_SIZE(__pyx_t_25)) break;
-        __pyx_t_7 = PyTuple_GET_ITEM(__pyx_t_25, __pyx_t_29); __Pyx_INCREF(__pyx_t_7); __pyx_t_29++;
-      } else {
-        __pyx_t_7 = PyIter_Next(__pyx_t_25);
-        if (!__pyx_t_7) {
-          if (unlikely(PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 502; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-          break;
-        }
-        __Pyx_GOTREF(__pyx_t_7);
-      }
-      __Pyx_DECREF(__pyx_v_v);
-      __pyx_v_v = __pyx_t_7;
-      __pyx_t_7 = 0;
-      __pyx_1 = __Pyx_GetName(__pyx_m, __pyx_kp_49); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 502; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-      __Pyx_GOTREF(__pyx_1);
-      __pyx_t_7 = PyTuple_New(3); if (unlikely(!__pyx_t_7)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 502; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-      __Pyx_GOTREF(((PyObject *)__pyx_t_7));
-      __Pyx_INCREF(__pyx_int_4);
-      PyTuple_SET_ITEM(__pyx_t_7, 0, __pyx_int_4);
-      __Pyx_GIVEREF(__pyx_int_4);
-      __Pyx_INCREF(__pyx_int_2);
-      PyTuple_SET_ITEM(__pyx_t_7, 1, __pyx_int_2);
-      __Pyx_GIVEREF(__pyx_int_2);
-      __Pyx_INCREF(__pyx_int_1);
-      PyTuple_SET_ITEM(__pyx_t_7, 2, __pyx_int_1);
-      __Pyx_GIVEREF(__pyx_int_1);
-      __pyx_t_6 = PyTuple_New(3); if (unlikely(!__pyx_t_6)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 502; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-      __Pyx_GOTREF(((PyObject *)__pyx_t_6));
-      __Pyx_INCREF(__pyx_v_v);
-      PyTuple_SET_ITEM(__pyx_t_6, 0, __pyx_v_v);
-      __Pyx_GIVEREF(__pyx_v_v);
-      __Pyx_INCREF(__pyx_v_strides);
-      PyTuple_SET_ITEM(__pyx_t_6, 1, __pyx_v_strides);
-      __Pyx_GIVEREF(__pyx_v_strides);
-      PyTuple_SET_ITEM(__pyx_t_6, 2, ((PyObject *)__pyx_t_7));
-      __Pyx_GIVEREF(((PyObject *)__pyx_t_7));
-      __pyx_t_7 = 0;
-      __pyx_t_7 = PyObject_Call(__pyx_1, ((PyObject *)__pyx_t_6), NULL); if (unlikely(!__pyx_t_7)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 502; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-      __Pyx_GOTREF(__pyx_t_7);
-      __Pyx_DECREF(__pyx_1); __pyx_1 = 0;
-      __Pyx_DECREF(((PyObject *)__pyx_t_6)); __pyx_t_6 = 0;
-      __pyx_t_9 = PyList_Append(__pyx_t_1, (PyObject*)__pyx_t_7); if (unlikely(__pyx_t_9)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 502; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-      __Pyx_DECREF(__pyx_t_7); __pyx_t_7 = 0;
-    }
-    __Pyx_DECREF(__pyx_t_25); __pyx_t_25 = 0;
-    __pyx_t_9 = PyList_Append(__pyx_t_23, (PyObject*)__pyx_t_1); if (unlikely(__pyx_t_9)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 502; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __Pyx_DECREF(((PyObject *)__pyx_t_1)); __pyx_t_1 = 0;
-  }
-  __pyx_t_1 = PyTuple_New(1); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 502; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_1));
-  __Pyx_INCREF(((PyObject *)__pyx_t_23));
-  PyTuple_SET_ITEM(__pyx_t_1, 0, ((PyObject *)__pyx_t_23));
-  __Pyx_GIVEREF(((PyObject *)__pyx_t_23));
-  __Pyx_DECREF(((PyObject *)__pyx_t_23)); __pyx_t_23 = 0;
-  __pyx_t_23 = PyObject_Call(__pyx_t_22, ((PyObject *)__pyx_t_1), NULL); if (unlikely(!__pyx_t_23)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 502; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_23);
-  __Pyx_DECREF(__pyx_t_22); __pyx_t_22 = 0;
-  __Pyx_DECREF(((PyObject *)__pyx_t_1)); __pyx_t_1 = 0;
-  if (!(__Pyx_TypeTest(__pyx_t_23, __pyx_ptype_5numpy_ndarray))) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 502; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __pyx_t_30 = ((PyArrayObject *)__pyx_t_23);
-  {
-    __Pyx_BufFmt_StackElem __pyx_stack[1];
-    __Pyx_SafeReleaseBuffer(&__pyx_bstruct_d4);
-    __pyx_t_9 = __Pyx_GetBufferAndValidate(&__pyx_bstruct_d4, (PyObject*)__pyx_t_30, &__Pyx_TypeInfo_nn___pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_int_t, PyBUF_FORMAT| PyBUF_STRIDES, 2, 0, __pyx_stack);
-    if (unlikely(__pyx_t_9 < 0)) {
-      PyErr_Fetch(&__pyx_t_10, &__pyx_t_11, &__pyx_t_12);
-      if (unlikely(__Pyx_GetBufferAndValidate(&__pyx_bstruct_d4, (PyObject*)__pyx_v_d4, &__Pyx_TypeInfo_nn___pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_int_t, PyBUF_FORMAT| PyBUF_STRIDES, 2, 0, __pyx_stack) == -1)) {
-        Py_XDECREF(__pyx_t_10); Py_XDECREF(__pyx_t_11); Py_XDECREF(__pyx_t_12);
-        __Pyx_RaiseBufferFallbackError();
-      } else {
-        PyErr_Restore(__pyx_t_10, __pyx_t_11, __pyx_t_12);
-      }
-    }
-    __pyx_bstride_0_d4 = __pyx_bstruct_d4.strides[0]; __pyx_bstride_1_d4 = __pyx_bstruct_d4.strides[1];
-    __pyx_bshape_0_d4 = __pyx_bstruct_d4.shape[0]; __pyx_bshape_1_d4 = __pyx_bstruct_d4.shape[1];
-    if (unlikely(__pyx_t_9 < 0)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 502; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  }
-  __pyx_t_30 = 0;
-  __Pyx_DECREF(((PyObject *)__pyx_v_d4));
-  __pyx_v_d4 = ((PyArrayObject *)__pyx_t_23);
-  __pyx_t_23 = 0;
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":503
- * 
- *     d4 = np.array([[_convert_stride3(v, strides, (4,2,1)) for v in m4[i]] for i in range(m4.shape[0])])
- *     d4 = np.hstack([m4, d4])             # <<<<<<<<<<<<<<
- *     ds4 = d4.shape[0]
- * 
- */
-  __pyx_3 = __Pyx_GetName(__pyx_m, __pyx_kp_np); if (unlikely(!__pyx_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 503; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_3);
-  __pyx_t_23 = PyObject_GetAttr(__pyx_3, __pyx_kp_hstack); if (unlikely(!__pyx_t_23)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 503; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_23);
-  __Pyx_DECREF(__pyx_3); __pyx_3 = 0;
-  __pyx_t_1 = PyList_New(2); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 503; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_1));
-  __Pyx_INCREF(((PyObject *)__pyx_v_m4));
-  PyList_SET_ITEM(__pyx_t_1, 0, ((PyObject *)__pyx_v_m4));
-  __Pyx_GIVEREF(((PyObject *)__pyx_v_m4));
-  __Pyx_INCREF(((PyObject *)__pyx_v_d4));
-  PyList_SET_ITEM(__pyx_t_1, 1, ((PyObject *)__pyx_v_d4));
-  __Pyx_GIVEREF(((PyObject *)__pyx_v_d4));
-  __pyx_t_22 = PyTuple_New(1); if (unlikely(!__pyx_t_22)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 503; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_22));
-  PyTuple_SET_ITEM(__pyx_t_22, 0, ((PyObject *)__pyx_t_1));
-  __Pyx_GIVEREF(((PyObject *)__pyx_t_1));
-  __pyx_t_1 = 0;
-  __pyx_t_1 = PyObject_Call(__pyx_t_23, ((PyObject *)__pyx_t_22), NULL); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 503; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_1);
-  __Pyx_DECREF(__pyx_t_23); __pyx_t_23 = 0;
-  __Pyx_DECREF(((PyObject *)__pyx_t_22)); __pyx_t_22 = 0;
-  if (!(__Pyx_TypeTest(__pyx_t_1, __pyx_ptype_5numpy_ndarray))) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 503; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __pyx_t_30 = ((PyArrayObject *)__pyx_t_1);
-  {
-    __Pyx_BufFmt_StackElem __pyx_stack[1];
-    __Pyx_SafeReleaseBuffer(&__pyx_bstruct_d4);
-    __pyx_t_9 = __Pyx_GetBufferAndValidate(&__pyx_bstruct_d4, (PyObject*)__pyx_t_30, &__Pyx_TypeInfo_nn___pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_int_t, PyBUF_FORMAT| PyBUF_STRIDES, 2, 0, __pyx_stack);
-    if (unlikely(__pyx_t_9 < 0)) {
-      PyErr_Fetch(&__pyx_t_12, &__pyx_t_11, &__pyx_t_10);
-      if (unlikely(__Pyx_GetBufferAndValidate(&__pyx_bstruct_d4, (PyObject*)__pyx_v_d4, &__Pyx_TypeInfo_nn___pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_int_t, PyBUF_FORMAT| PyBUF_STRIDES, 2, 0, __pyx_stack) == -1)) {
-        Py_XDECREF(__pyx_t_12); Py_XDECREF(__pyx_t_11); Py_XDECREF(__pyx_t_10);
-        __Pyx_RaiseBufferFallbackError();
-      } else {
-        PyErr_Restore(__pyx_t_12, __pyx_t_11, __pyx_t_10);
-      }
-    }
-    __pyx_bstride_0_d4 = __pyx_bstruct_d4.strides[0]; __pyx_bstride_1_d4 = __pyx_bstruct_d4.strides[1];
-    __pyx_bshape_0_d4 = __pyx_bstruct_d4.shape[0]; __pyx_bshape_1_d4 = __pyx_bstruct_d4.shape[1];
-    if (unlikely(__pyx_t_9 < 0)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 503; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  }
-  __pyx_t_30 = 0;
-  __Pyx_DECREF(((PyObject *)__pyx_v_d4));
-  __pyx_v_d4 = ((PyArrayObject *)__pyx_t_1);
-  __pyx_t_1 = 0;
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":504
- *     d4 = np.array([[_convert_stride3(v, strides, (4,2,1)) for v in m4[i]] for i in range(m4.shape[0])])
- *     d4 = np.hstack([m4, d4])
- *     ds4 = d4.shape[0]             # <<<<<<<<<<<<<<
- * 
- *     d3 = np.array([[_convert_stride3(v, strides, (4,2,1)) for v in m3[i]] for i in range(m3.shape[0])])
- */
-  __pyx_v_ds4 = (__pyx_v_d4->dimensions[0]);
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":506
- *     ds4 = d4.shape[0]
- * 
- *     d3 = np.array([[_convert_stride3(v, strides, (4,2,1)) for v in m3[i]] for i in range(m3.shape[0])])             # <<<<<<<<<<<<<<
- *     d3 = np.hstack([m3, d3])
- *     ds3 = d3.shape[0]
- */
-  __pyx_2 = __Pyx_GetName(__pyx_m, __pyx_kp_np); if (unlikely(!__pyx_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 506; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_2);
-  __pyx_t_1 = PyObject_GetAttr(__pyx_2, __pyx_kp_array); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 506; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_1);
-  __Pyx_DECREF(__pyx_2); __pyx_2 = 0;
-  __pyx_t_22 = PyList_New(0); if (unlikely(!__pyx_t_22)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 506; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_22));
-  for (__pyx_t_19 = 0; __pyx_t_19 < (__pyx_v_m3->dimensions[0]); __pyx_t_19+=1) {
-    __pyx_v_i = __pyx_t_19;
-    __pyx_t_23 = PyList_New(0); if (unlikely(!__pyx_t_23)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 506; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __Pyx_GOTREF(((PyObject *)__pyx_t_23));
-    __pyx_1 = __Pyx_GetItemInt(((PyObject *)__pyx_v_m3), __pyx_v_i, sizeof(long), PyInt_FromLong); if (!__pyx_1) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 506; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __Pyx_GOTREF(__pyx_1);
-    if (PyList_CheckExact(__pyx_1) || PyTuple_CheckExact(__pyx_1)) {
-      __pyx_t_29 = 0; __pyx_t_25 = __pyx_1; __Pyx_INCREF(__pyx_t_25);
-    } else {
-      __pyx_t_29 = -1; __pyx_t_25 = PyObject_GetIter(__pyx_1); if (unlikely(!__pyx_t_25)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 506; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-      __Pyx_GOTREF(__pyx_t_25);
-    }
-    __Pyx_DECREF(__pyx_1); __pyx_1 = 0;
-    for (;;) {
-      if (likely(PyList_CheckExact(__pyx_t_25))) {
-        if (__pyx_t_29 >= PyList_GET_SIZE(__pyx_t_25)) break;
-        __pyx_t_7 = PyList_GET_ITEM(__pyx_t_25, __pyx_t_29); __Pyx_INCREF(__pyx_t_7); __pyx_t_29++;
-      } else if (likely(PyTuple_CheckExact(__pyx_t_25))) {
-        if (__pyx_t_29 >= PyTuple_GET_SIZE(__pyx_t_25)) break;
-        __pyx_t_7 = PyTuple_GET_ITEM(__pyx_t_25, __pyx_t_29); __Pyx_INCREF(__pyx_t_7); __pyx_t_29++;
-      } else {
-        __pyx_t_7 = PyIter_Next(__pyx_t_25);
-        if (!__pyx_t_7) {
-          if (unlikely(PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 506; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-          break;
-        }
-        __Pyx_GOTREF(__pyx_t_7);
-      }
-      __Pyx_DECREF(__pyx_v_v);
-      __pyx_v_v = __pyx_t_7;
-      __pyx_t_7 = 0;
-      __pyx_3 = __Pyx_GetName(__pyx_m, __pyx_kp_49); if (unlikely(!__pyx_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 506; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-      __Pyx_GOTREF(__pyx_3);
-      __pyx_t_7 = PyTuple_New(3); if (unlikely(!__pyx_t_7)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 506; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-      __Pyx_GOTREF(((PyObject *)__pyx_t_7));
-      __Pyx_INCREF(__pyx_int_4);
-      PyTuple_SET_ITEM(__pyx_t_7, 0, __pyx_int_4);
-      __Pyx_GIVEREF(__pyx_int_4);
-      __Pyx_INCREF(__pyx_int_2);
-      PyTuple_SET_ITEM(__pyx_t_7, 1, __pyx_int_2);
-      __Pyx_GIVEREF(__pyx_int_2);
-      __Pyx_INCREF(__pyx_int_1);
-      PyTuple_SET_ITEM(__pyx_t_7, 2, __pyx_int_1);
-      __Pyx_GIVEREF(__pyx_int_1);
-      __pyx_t_6 = PyTuple_New(3); if (unlikely(!__pyx_t_6)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 506; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-      __Pyx_GOTREF(((PyObject *)__pyx_t_6));
-      __Pyx_INCREF(__pyx_v_v);
-      PyTuple_SET_ITEM(__pyx_t_6, 0, __pyx_v_v);
-      __Pyx_GIVEREF(__pyx_v_v);
-      __Pyx_INCREF(__pyx_v_strides);
-      PyTuple_SET_ITEM(__pyx_t_6, 1, __pyx_v_strides);
-      __Pyx_GIVEREF(__pyx_v_strides);
-      PyTuple_SET_ITEM(__pyx_t_6, 2, ((PyObject *)__pyx_t_7));
-      __Pyx_GIVEREF(((PyObject *)__pyx_t_7));
-      __pyx_t_7 = 0;
-      __pyx_t_7 = PyObject_Call(__pyx_3, ((PyObject *)__pyx_t_6), NULL); if (unlikely(!__pyx_t_7)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 506; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-      __Pyx_GOTREF(__pyx_t_7);
-      __Pyx_DECREF(__pyx_3); __pyx_3 = 0;
-      __Pyx_DECREF(((PyObject *)__pyx_t_6)); __pyx_t_6 = 0;
-      __pyx_t_9 = PyList_Append(__pyx_t_23, (PyObject*)__pyx_t_7); if (unlikely(__pyx_t_9)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 506; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-      __Pyx_DECREF(__pyx_t_7); __pyx_t_7 = 0;
-    }
-    __Pyx_DECREF(__pyx_t_25); __pyx_t_25 = 0;
-    __pyx_t_9 = PyList_Append(__pyx_t_22, (PyObject*)__pyx_t_23); if (unlikely(__pyx_t_9)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 506; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __Pyx_DECREF(((PyObject *)__pyx_t_23)); __pyx_t_23 = 0;
-  }
-  __pyx_t_23 = PyTuple_New(1); if (unlikely(!__pyx_t_23)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 506; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_23));
-  __Pyx_INCREF(((PyObject *)__pyx_t_22));
-  PyTuple_SET_ITEM(__pyx_t_23, 0, ((PyObject *)__pyx_t_22));
-  __Pyx_GIVEREF(((PyObject *)__pyx_t_22));
-  __Pyx_DECREF(((PyObject *)__pyx_t_22)); __pyx_t_22 = 0;
-  __pyx_t_22 = PyObject_Call(__pyx_t_1, ((PyObject *)__pyx_t_23), NULL); if (unlikely(!__pyx_t_22)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 506; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_22);
-  __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-  __Pyx_DECREF(((PyObject *)__pyx_t_23)); __pyx_t_23 = 0;
-  if (!(__Pyx_TypeTest(__pyx_t_22, __pyx_ptype_5numpy_ndarray))) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 506; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __pyx_t_31 = ((PyArrayObject *)__pyx_t_22);
-  {
-    __Pyx_BufFmt_StackElem __pyx_stack[1];
-    __Pyx_SafeReleaseBuffer(&__pyx_bstruct_d3);
-    __pyx_t_9 = __Pyx_GetBufferAndValidate(&__pyx_bstruct_d3, (PyObject*)__pyx_t_31, &__Pyx_TypeInfo_nn___pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_int_t, PyBUF_FORMAT| PyBUF_STRIDES, 2, 0, __pyx_stack);
-    if (unlikely(__pyx_t_9 < 0)) {
-      PyErr_Fetch(&__pyx_t_10, &__pyx_t_11, &__pyx_t_12);
-      if (unlikely(__Pyx_GetBufferAndValidate(&__pyx_bstruct_d3, (PyObject*)__pyx_v_d3, &__Pyx_TypeInfo_nn___pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_int_t, PyBUF_FORMAT| PyBUF_STRIDES, 2, 0, __pyx_stack) == -1)) {
-        Py_XDECREF(__pyx_t_10); Py_XDECREF(__pyx_t_11); Py_XDECREF(__pyx_t_12);
-        __Pyx_RaiseBufferFallbackError();
-      } else {
-        PyErr_Restore(__pyx_t_10, __pyx_t_11, __pyx_t_12);
-      }
-    }
-    __pyx_bstride_0_d3 = __pyx_bstruct_d3.strides[0]; __pyx_bstride_1_d3 = __pyx_bstruct_d3.strides[1];
-    __pyx_bshape_0_d3 = __pyx_bstruct_d3.shape[0]; __pyx_bshape_1_d3 = __pyx_bstruct_d3.shape[1];
-    if (unlikely(__pyx_t_9 < 0)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 506; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  }
-  __pyx_t_31 = 0;
-  __Pyx_DECREF(((PyObject *)__pyx_v_d3));
-  __pyx_v_d3 = ((PyArrayObject *)__pyx_t_22);
-  __pyx_t_22 = 0;
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":507
- * 
- *     d3 = np.array([[_convert_stride3(v, strides, (4,2,1)) for v in m3[i]] for i in range(m3.shape[0])])
- *     d3 = np.hstack([m3, d3])             # <<<<<<<<<<<<<<
- *     ds3 = d3.shape[0]
- * 
- */
-  __pyx_2 = __Pyx_GetName(__pyx_m, __pyx_kp_np); if (unlikely(!__pyx_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 507; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_2);
-  __pyx_t_22 = PyObject_GetAttr(__pyx_2, __pyx_kp_hstack); if (unlikely(!__pyx_t_22)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 507; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_22);
-  __Pyx_DECREF(__pyx_2); __pyx_2 = 0;
-  __pyx_t_23 = PyList_New(2); if (unlikely(!__pyx_t_23)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 507; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_23));
-  __Pyx_INCREF(((PyObject *)__pyx_v_m3));
-  PyList_SET_ITEM(__pyx_t_23, 0, ((PyObject *)__pyx_v_m3));
-  __Pyx_GIVEREF(((PyObject *)__pyx_v_m3));
-  __Pyx_INCREF(((PyObject *)__pyx_v_d3));
-  PyList_SET_ITEM(__pyx_t_23, 1, ((PyObject *)__pyx_v_d3));
-  __Pyx_GIVEREF(((PyObject *)__pyx_v_d3));
-  __pyx_t_1 = PyTuple_New(1); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 507; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_1));
-  PyTuple_SET_ITEM(__pyx_t_1, 0, ((PyObject *)__pyx_t_23));
-  __Pyx_GIVEREF(((PyObject *)__pyx_t_23));
-  __pyx_t_23 = 0;
-  __pyx_t_23 = PyObject_Call(__pyx_t_22, ((PyObject *)__pyx_t_1), NULL); if (unlikely(!__pyx_t_23)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 507; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_23);
-  __Pyx_DECREF(__pyx_t_22); __pyx_t_22 = 0;
-  __Pyx_DECREF(((PyObject *)__pyx_t_1)); __pyx_t_1 = 0;
-  if (!(__Pyx_TypeTest(__pyx_t_23, __pyx_ptype_5numpy_ndarray))) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 507; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __pyx_t_31 = ((PyArrayObject *)__pyx_t_23);
-  {
-    __Pyx_BufFmt_StackElem __pyx_stack[1];
-    __Pyx_SafeReleaseBuffer(&__pyx_bstruct_d3);
-    __pyx_t_9 = __Pyx_GetBufferAndValidate(&__pyx_bstruct_d3, (PyObject*)__pyx_t_31, &__Pyx_TypeInfo_nn___pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_int_t, PyBUF_FORMAT| PyBUF_STRIDES, 2, 0, __pyx_stack);
-    if (unlikely(__pyx_t_9 < 0)) {
-      PyErr_Fetch(&__pyx_t_12, &__pyx_t_11, &__pyx_t_10);
-      if (unlikely(__Pyx_GetBufferAndValidate(&__pyx_bstruct_d3, (PyObject*)__pyx_v_d3, &__Pyx_TypeInfo_nn___pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_int_t, PyBUF_FORMAT| PyBUF_STRIDES, 2, 0, __pyx_stack) == -1)) {
-        Py_XDECREF(__pyx_t_12); Py_XDECREF(__pyx_t_11); Py_XDECREF(__pyx_t_10);
-        __Pyx_RaiseBufferFallbackError();
-      } else {
-        PyErr_Restore(__pyx_t_12, __pyx_t_11, __pyx_t_10);
-      }
-    }
-    __pyx_bstride_0_d3 = __pyx_bstruct_d3.strides[0]; __pyx_bstride_1_d3 = __pyx_bstruct_d3.strides[1];
-    __pyx_bshape_0_d3 = __pyx_bstruct_d3.shape[0]; __pyx_bshape_1_d3 = __pyx_bstruct_d3.shape[1];
-    if (unlikely(__pyx_t_9 < 0)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 507; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  }
-  __pyx_t_31 = 0;
-  __Pyx_DECREF(((PyObject *)__pyx_v_d3));
-  __pyx_v_d3 = ((PyArrayObject *)__pyx_t_23);
-  __pyx_t_23 = 0;
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":508
- *     d3 = np.array([[_convert_stride3(v, strides, (4,2,1)) for v in m3[i]] for i in range(m3.shape[0])])
- *     d3 = np.hstack([m3, d3])
- *     ds3 = d3.shape[0]             # <<<<<<<<<<<<<<
- * 
- *     d2 = np.array([[_convert_stride3(v, strides, (4,2,1)) for v in m2[i]] for i in range(m2.shape[0])])
- */
-  __pyx_v_ds3 = (__pyx_v_d3->dimensions[0]);
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":510
- *     ds3 = d3.shape[0]
- * 
- *     d2 = np.array([[_convert_stride3(v, strides, (4,2,1)) for v in m2[i]] for i in range(m2.shape[0])])             # <<<<<<<<<<<<<<
- *     d2 = np.hstack([m2, d2])
- *     ds2 = d2.shape[0]
- */
-  __pyx_1 = __Pyx_GetName(__pyx_m, __pyx_kp_np); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 510; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_1);
-  __pyx_t_23 = PyObject_GetAttr(__pyx_1, __pyx_kp_array); if (unlikely(!__pyx_t_23)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 510; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_23);
-  __Pyx_DECREF(__pyx_1); __pyx_1 = 0;
-  __pyx_t_1 = PyList_New(0); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 510; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_1));
-  for (__pyx_t_19 = 0; __pyx_t_19 < (__pyx_v_m2->dimensions[0]); __pyx_t_19+=1) {
-    __pyx_v_i = __pyx_t_19;
-    __pyx_t_22 = PyList_New(0); if (unlikely(!__pyx_t_22)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 510; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __Pyx_GOTREF(((PyObject *)__pyx_t_22));
-    __pyx_3 = __Pyx_GetItemInt(((PyObject *)__pyx_v_m2), __pyx_v_i, sizeof(long), PyInt_FromLong); if (!__pyx_3) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 510; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __Pyx_GOTREF(__pyx_3);
-    if (PyList_CheckExact(__pyx_3) || PyTuple_CheckExact(__pyx_3)) {
-      __pyx_t_29 = 0; __pyx_t_25 = __pyx_3; __Pyx_INCREF(__pyx_t_25);
-    } else {
-      __pyx_t_29 = -1; __pyx_t_25 = PyObject_GetIter(__pyx_3); if (unlikely(!__pyx_t_25)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 510; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-      __Pyx_GOTREF(__pyx_t_25);
-    }
-    __Pyx_DECREF(__pyx_3); __pyx_3 = 0;
-    for (;;) {
-      if (likely(PyList_CheckExact(__pyx_t_25))) {
-        if (__pyx_t_29 >= PyList_GET_SIZE(__pyx_t_25)) break;
-        __pyx_t_7 = PyList_GET_ITEM(__pyx_t_25, __pyx_t_29); __Pyx_INCREF(__pyx_t_7); __pyx_t_29++;
-      } else if (likely(PyTuple_CheckExact(__pyx_t_25))) {
-        if (__pyx_t_29 >= PyTuple_GET_SIZE(__pyx_t_25)) break;
-        __pyx_t_7 = PyTuple_GET_ITEM(__pyx_t_25, __pyx_t_29); __Pyx_INCREF(__pyx_t_7); __pyx_t_29++;
-      } else {
-        __pyx_t_7 = PyIter_Next(__pyx_t_25);
-        if (!__pyx_t_7) {
-          if (unlikely(PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 510; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-          break;
-        }
-        __Pyx_GOTREF(__pyx_t_7);
-      }
-      __Pyx_DECREF(__pyx_v_v);
-      __pyx_v_v = __pyx_t_7;
-      __pyx_t_7 = 0;
-      __pyx_2 = __Pyx_GetName(__pyx_m, __pyx_kp_49); if (unlikely(!__pyx_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 510; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-      __Pyx_GOTREF(__pyx_2);
-      __pyx_t_7 = PyTuple_New(3); if (unlikely(!__pyx_t_7)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 510; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-      __Pyx_GOTREF(((PyObject *)__pyx_t_7));
-      __Pyx_INCREF(__pyx_int_4);
-      PyTuple_SET_ITEM(__pyx_t_7, 0, __pyx_int_4);
-      __Pyx_GIVEREF(__pyx_int_4);
-      __Pyx_INCREF(__pyx_int_2);
-      PyTuple_SET_ITEM(__pyx_t_7, 1, __pyx_int_2);
-      __Pyx_GIVEREF(__pyx_int_2);
-      __Pyx_INCREF(__pyx_int_1);
-      PyTuple_SET_ITEM(__pyx_t_7, 2, __pyx_int_1);
-      __Pyx_GIVEREF(__pyx_int_1);
-      __pyx_t_6 = PyTuple_New(3); if (unlikely(!__pyx_t_6)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 510; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-      __Pyx_GOTREF(((PyObject *)__pyx_t_6));
-      __Pyx_INCREF(__pyx_v_v);
-      PyTuple_SET_ITEM(__pyx_t_6, 0, __pyx_v_v);
-      __Pyx_GIVEREF(__pyx_v_v);
-      __Pyx_INCREF(__pyx_v_strides);
-      PyTuple_SET_ITEM(__pyx_t_6, 1, __pyx_v_strides);
-      __Pyx_GIVEREF(__pyx_v_strides);
-      PyTuple_SET_ITEM(__pyx_t_6, 2, ((PyObject *)__pyx_t_7));
-      __Pyx_GIVEREF(((PyObject *)__pyx_t_7));
-      __pyx_t_7 = 0;
-      __pyx_t_7 = PyObject_Call(__pyx_2, ((PyObject *)__pyx_t_6), NULL); if (unlikely(!__pyx_t_7)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 510; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-      __Pyx_GOTREF(__pyx_t_7);
-      __Pyx_DECREF(__pyx_2); __pyx_2 = 0;
-      __Pyx_DECREF(((PyObject *)__pyx_t_6)); __pyx_t_6 = 0;
-      __pyx_t_9 = PyList_Append(__pyx_t_22, (PyObject*)__pyx_t_7); if (unlikely(__pyx_t_9)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 510; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-      __Pyx_DECREF(__pyx_t_7); __pyx_t_7 = 0;
-    }
-    __Pyx_DECREF(__pyx_t_25); __pyx_t_25 = 0;
-    __pyx_t_9 = PyList_Append(__pyx_t_1, (PyObject*)__pyx_t_22); if (unlikely(__pyx_t_9)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 510; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __Pyx_DECREF(((PyObject *)__pyx_t_22)); __pyx_t_22 = 0;
-  }
-  __pyx_t_22 = PyTuple_New(1); if (unlikely(!__pyx_t_22)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 510; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_22));
-  __Pyx_INCREF(((PyObject *)__pyx_t_1));
-  PyTuple_SET_ITEM(__pyx_t_22, 0, ((PyObject *)__pyx_t_1));
-  __Pyx_GIVEREF(((PyObject *)__pyx_t_1));
-  __Pyx_DECREF(((PyObject *)__pyx_t_1)); __pyx_t_1 = 0;
-  __pyx_t_1 = PyObject_Call(__pyx_t_23, ((PyObject *)__pyx_t_22), NULL); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 510; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_1);
-  __Pyx_DECREF(__pyx_t_23); __pyx_t_23 = 0;
-  __Pyx_DECREF(((PyObject *)__pyx_t_22)); __pyx_t_22 = 0;
-  if (!(__Pyx_TypeTest(__pyx_t_1, __pyx_ptype_5numpy_ndarray))) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 510; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __pyx_t_32 = ((PyArrayObject *)__pyx_t_1);
-  {
-    __Pyx_BufFmt_StackElem __pyx_stack[1];
-    __Pyx_SafeReleaseBuffer(&__pyx_bstruct_d2);
-    __pyx_t_9 = __Pyx_GetBufferAndValidate(&__pyx_bstruct_d2, (PyObject*)__pyx_t_32, &__Pyx_TypeInfo_nn___pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_int_t, PyBUF_FORMAT| PyBUF_STRIDES, 2, 0, __pyx_stack);
-    if (unlikely(__pyx_t_9 < 0)) {
-      PyErr_Fetch(&__pyx_t_10, &__pyx_t_11, &__pyx_t_12);
-      if (unlikely(__Pyx_GetBufferAndValidate(&__pyx_bstruct_d2, (PyObject*)__pyx_v_d2, &__Pyx_TypeInfo_nn___pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_int_t, PyBUF_FORMAT| PyBUF_STRIDES, 2, 0, __pyx_stack) == -1)) {
-        Py_XDECREF(__pyx_t_10); Py_XDECREF(__pyx_t_11); Py_XDECREF(__pyx_t_12);
-        __Pyx_RaiseBufferFallbackError();
-      } else {
-        PyErr_Restore(__pyx_t_10, __pyx_t_11, __pyx_t_12);
-      }
-    }
-    __pyx_bstride_0_d2 = __pyx_bstruct_d2.strides[0]; __pyx_bstride_1_d2 = __pyx_bstruct_d2.strides[1];
-    __pyx_bshape_0_d2 = __pyx_bstruct_d2.shape[0]; __pyx_bshape_1_d2 = __pyx_bstruct_d2.shape[1];
-    if (unlikely(__pyx_t_9 < 0)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 510; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  }
-  __pyx_t_32 = 0;
-  __Pyx_DECREF(((PyObject *)__pyx_v_d2));
-  __pyx_v_d2 = ((PyArrayObject *)__pyx_t_1);
-  __pyx_t_1 = 0;
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":511
- * 
- *     d2 = np.array([[_convert_stride3(v, strides, (4,2,1)) for v in m2[i]] for i in range(m2.shape[0])])
- *     d2 = np.hstack([m2, d2])             # <<<<<<<<<<<<<<
- *     ds2 = d2.shape[0]
- * 
- */
-  __pyx_1 = __Pyx_GetName(__pyx_m, __pyx_kp_np); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 511; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_1);
-  __pyx_t_1 = PyObject_GetAttr(__pyx_1, __pyx_kp_hstack); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 511; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_1);
-  __Pyx_DECREF(__pyx_1); __pyx_1 = 0;
-  __pyx_t_22 = PyList_New(2); if (unlikely(!__pyx_t_22)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 511; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_22));
-  __Pyx_INCREF(((PyObject *)__pyx_v_m2));
-  PyList_SET_ITEM(__pyx_t_22, 0, ((PyObject *)__pyx_v_m2));
-  __Pyx_GIVEREF(((PyObject *)__pyx_v_m2));
-  __Pyx_INCREF(((PyObject *)__pyx_v_d2));
-  PyList_SET_ITEM(__pyx_t_22, 1, ((PyObject *)__pyx_v_d2));
-  __Pyx_GIVEREF(((PyObject *)__pyx_v_d2));
-  __pyx_t_23 = PyTuple_New(1); if (unlikely(!__pyx_t_23)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 511; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_23));
-  PyTuple_SET_ITEM(__pyx_t_23, 0, ((PyObject *)__pyx_t_22));
-  __Pyx_GIVEREF(((PyObject *)__pyx_t_22));
-  __pyx_t_22 = 0;
-  __pyx_t_22 = PyObject_Call(__pyx_t_1, ((PyObject *)__pyx_t_23), NULL); if (unlikely(!__pyx_t_22)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 511; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_22);
-  __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-  __Pyx_DECREF(((PyObject *)__pyx_t_23)); __pyx_t_23 = 0;
-  if (!(__Pyx_TypeTest(__pyx_t_22, __pyx_ptype_5numpy_ndarray))) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 511; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __pyx_t_32 = ((PyArrayObject *)__pyx_t_22);
-  {
-    __Pyx_BufFmt_StackElem __pyx_stack[1];
-    __Pyx_SafeReleaseBuffer(&__pyx_bstruct_d2);
-    __pyx_t_9 = __Pyx_GetBufferAndValidate(&__pyx_bstruct_d2, (PyObject*)__pyx_t_32, &__Pyx_TypeInfo_nn___pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_int_t, PyBUF_FORMAT| PyBUF_STRIDES, 2, 0, __pyx_stack);
-    if (unlikely(__pyx_t_9 < 0)) {
-      PyErr_Fetch(&__pyx_t_12, &__pyx_t_11, &__pyx_t_10);
-      if (unlikely(__Pyx_GetBufferAndValidate(&__pyx_bstruct_d2, (PyObject*)__pyx_v_d2, &__Pyx_TypeInfo_nn___pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_int_t, PyBUF_FORMAT| PyBUF_STRIDES, 2, 0, __pyx_stack) == -1)) {
-        Py_XDECREF(__pyx_t_12); Py_XDECREF(__pyx_t_11); Py_XDECREF(__pyx_t_10);
-        __Pyx_RaiseBufferFallbackError();
-      } else {
-        PyErr_Restore(__pyx_t_12, __pyx_t_11, __pyx_t_10);
-      }
-    }
-    __pyx_bstride_0_d2 = __pyx_bstruct_d2.strides[0]; __pyx_bstride_1_d2 = __pyx_bstruct_d2.strides[1];
-    __pyx_bshape_0_d2 = __pyx_bstruct_d2.shape[0]; __pyx_bshape_1_d2 = __pyx_bstruct_d2.shape[1];
-    if (unlikely(__pyx_t_9 < 0)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 511; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  }
-  __pyx_t_32 = 0;
-  __Pyx_DECREF(((PyObject *)__pyx_v_d2));
-  __pyx_v_d2 = ((PyArrayObject *)__pyx_t_22);
-  __pyx_t_22 = 0;
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":512
- *     d2 = np.array([[_convert_stride3(v, strides, (4,2,1)) for v in m2[i]] for i in range(m2.shape[0])])
- *     d2 = np.hstack([m2, d2])
- *     ds2 = d2.shape[0]             # <<<<<<<<<<<<<<
- * 
- *     ss0, ss1, ss2 = strides[0], strides[1], strides[2]
- */
-  __pyx_v_ds2 = (__pyx_v_d2->dimensions[0]);
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":514
- *     ds2 = d2.shape[0]
- * 
- *     ss0, ss1, ss2 = strides[0], strides[1], strides[2]             # <<<<<<<<<<<<<<
- *     ss0d, ss1d, ss2d = dstrides[0], dstrides[1], dstrides[2]
- * 
- */
-  __pyx_3 = __Pyx_GetItemInt(__pyx_v_strides, 0, sizeof(long), PyInt_FromLong); if (!__pyx_3) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 514; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_3);
-  __pyx_t_19 = __Pyx_PyInt_AsLong(__pyx_3); if (unlikely((__pyx_t_19 == (long)-1) && PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 514; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_DECREF(__pyx_3); __pyx_3 = 0;
-  __pyx_2 = __Pyx_GetItemInt(__pyx_v_strides, 1, sizeof(long), PyInt_FromLong); if (!__pyx_2) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 514; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_2);
-  __pyx_t_20 = __Pyx_PyInt_AsLong(__pyx_2); if (unlikely((__pyx_t_20 == (long)-1) && PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 514; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_DECREF(__pyx_2); __pyx_2 = 0;
-  __pyx_1 = __Pyx_GetItemInt(__pyx_v_strides, 2, sizeof(long), PyInt_FromLong); if (!__pyx_1) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 514; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_1);
-  __pyx_t_21 = __Pyx_PyInt_AsLong(__pyx_1); if (unlikely((__pyx_t_21 == (long)-1) && PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 514; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_DECREF(__pyx_1); __pyx_1 = 0;
-  __pyx_v_ss0 = __pyx_t_19;
-  __pyx_v_ss1 = __pyx_t_20;
-  __pyx_v_ss2 = __pyx_t_21;
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":515
- * 
- *     ss0, ss1, ss2 = strides[0], strides[1], strides[2]
- *     ss0d, ss1d, ss2d = dstrides[0], dstrides[1], dstrides[2]             # <<<<<<<<<<<<<<
- * 
- *     nvox = (s0-1)*(s1-1)*(s2-1)
- */
-  __pyx_3 = __Pyx_GetItemInt(__pyx_v_dstrides, 0, sizeof(long), PyInt_FromLong); if (!__pyx_3) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 515; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_3);
-  __pyx_2 = __Pyx_GetItemInt(__pyx_v_dstrides, 1, sizeof(long), PyInt_FromLong); if (!__pyx_2) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 515; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_2);
-  __pyx_1 = __Pyx_GetItemInt(__pyx_v_dstrides, 2, sizeof(long), PyInt_FromLong); if (!__pyx_1) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 515; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_1);
-  __Pyx_DECREF(__pyx_v_ss0d);
-  __pyx_v_ss0d = __pyx_3;
-  __pyx_3 = 0;
-  __Pyx_DECREF(__pyx_v_ss1d);
-  __pyx_v_ss1d = __pyx_2;
-  __pyx_2 = 0;
-  __Pyx_DECREF(__pyx_v_ss2d);
-  __pyx_v_ss2d = __pyx_1;
-  __pyx_1 = 0;
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":517
- *     ss0d, ss1d, ss2d = dstrides[0], dstrides[1], dstrides[2]
- * 
- *     nvox = (s0-1)*(s1-1)*(s2-1)             # <<<<<<<<<<<<<<
- * 
- *     D = np.zeros((8,8))
- */
-  __pyx_v_nvox = (((__pyx_v_s0 - 1) * (__pyx_v_s1 - 1)) * (__pyx_v_s2 - 1));
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":519
- *     nvox = (s0-1)*(s1-1)*(s2-1)
- * 
- *     D = np.zeros((8,8))             # <<<<<<<<<<<<<<
- * 
- *     for i in range(s0-1):
- */
-  __pyx_3 = __Pyx_GetName(__pyx_m, __pyx_kp_np); if (unlikely(!__pyx_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 519; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_3);
-  __pyx_t_22 = PyObject_GetAttr(__pyx_3, __pyx_kp_zeros); if (unlikely(!__pyx_t_22)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 519; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_22);
-  __Pyx_DECREF(__pyx_3); __pyx_3 = 0;
-  __pyx_t_23 = PyTuple_New(2); if (unlikely(!__pyx_t_23)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 519; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_23));
-  __Pyx_INCREF(__pyx_int_8);
-  PyTuple_SET_ITEM(__pyx_t_23, 0, __pyx_int_8);
-  __Pyx_GIVEREF(__pyx_int_8);
-  __Pyx_INCREF(__pyx_int_8);
-  PyTuple_SET_ITEM(__pyx_t_23, 1, __pyx_int_8);
-  __Pyx_GIVEREF(__pyx_int_8);
-  __pyx_t_1 = PyTuple_New(1); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 519; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_1));
-  PyTuple_SET_ITEM(__pyx_t_1, 0, ((PyObject *)__pyx_t_23));
-  __Pyx_GIVEREF(((PyObject *)__pyx_t_23));
-  __pyx_t_23 = 0;
-  __pyx_t_23 = PyObject_Call(__pyx_t_22, ((PyObject *)__pyx_t_1), NULL); if (unlikely(!__pyx_t_23)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 519; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_23);
-  __Pyx_DECREF(__pyx_t_22); __pyx_t_22 = 0;
-  __Pyx_DECREF(((PyObject *)__pyx_t_1)); __pyx_t_1 = 0;
-  if (!(__Pyx_TypeTest(__pyx_t_23, __pyx_ptype_5numpy_ndarray))) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 519; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __pyx_t_33 = ((PyArrayObject *)__pyx_t_23);
-  {
-    __Pyx_BufFmt_StackElem __pyx_stack[1];
-    __Pyx_SafeReleaseBuffer(&__pyx_bstruct_D);
-    __pyx_t_9 = __Pyx_GetBufferAndValidate(&__pyx_bstruct_D, (PyObject*)__pyx_t_33, &__Pyx_TypeInfo_nn___pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_float_t, PyBUF_FORMAT| PyBUF_STRIDES| PyBUF_WRITABLE, 2, 0, __pyx_stack);
-    if (unlikely(__pyx_t_9 < 0)) {
-      PyErr_Fetch(&__pyx_t_10, &__pyx_t_11, &__pyx_t_12);
-      if (unlikely(__Pyx_GetBufferAndValidate(&__pyx_bstruct_D, (PyObject*)__pyx_v_D, &__Pyx_TypeInfo_nn___pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_float_t, PyBUF_FORMAT| PyBUF_STRIDES| PyBUF_WRITABLE, 2, 0, __pyx_stack) == -1)) {
-        Py_XDECREF(__pyx_t_10); Py_XDECREF(__pyx_t_11); Py_XDECREF(__pyx_t_12);
-        __Pyx_RaiseBufferFallbackError();
-      } else {
-        PyErr_Restore(__pyx_t_10, __pyx_t_11, __pyx_t_12);
-      }
-    }
-    __pyx_bstride_0_D = __pyx_bstruct_D.strides[0]; __pyx_bstride_1_D = __pyx_bstruct_D.strides[1];
-    __pyx_bshape_0_D = __pyx_bstruct_D.shape[0]; __pyx_bshape_1_D = __pyx_bstruct_D.shape[1];
-    if (unlikely(__pyx_t_9 < 0)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 519; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  }
-  __pyx_t_33 = 0;
-  __Pyx_DECREF(((PyObject *)__pyx_v_D));
-  __pyx_v_D = ((PyArrayObject *)__pyx_t_23);
-  __pyx_t_23 = 0;
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":521
- *     D = np.zeros((8,8))
- * 
- *     for i in range(s0-1):             # <<<<<<<<<<<<<<
- *         for j in range(s1-1):
- *             for k in range(s2-1):
- */
-  for (__pyx_t_21 = 0; __pyx_t_21 < (__pyx_v_s0 - 1); __pyx_t_21+=1) {
-    __pyx_v_i = __pyx_t_21;
-
-    /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":522
- * 
- *     for i in range(s0-1):
- *         for j in range(s1-1):             # <<<<<<<<<<<<<<
- *             for k in range(s2-1):
- * 
- */
-    for (__pyx_t_20 = 0; __pyx_t_20 < (__pyx_v_s1 - 1); __pyx_t_20+=1) {
-      __pyx_v_j = __pyx_t_20;
-
-      /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":523
- *     for i in range(s0-1):
- *         for j in range(s1-1):
- *             for k in range(s2-1):             # <<<<<<<<<<<<<<
- * 
- *                 pindex = i*ss0+j*ss1+k*ss2
- */
-      for (__pyx_t_19 = 0; __pyx_t_19 < (__pyx_v_s2 - 1); __pyx_t_19+=1) {
-        __pyx_v_k = __pyx_t_19;
-
-        /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":525
- *             for k in range(s2-1):
- * 
- *                 pindex = i*ss0+j*ss1+k*ss2             # <<<<<<<<<<<<<<
- *                 index = i*ss0d+j*ss1d+k*ss2d
- *                 for r in range(8):
- */
-        __pyx_v_pindex = (((__pyx_v_i * __pyx_v_ss0) + (__pyx_v_j * __pyx_v_ss1)) + (__pyx_v_k * __pyx_v_ss2));
-
-        /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":526
- * 
- *                 pindex = i*ss0+j*ss1+k*ss2
- *                 index = i*ss0d+j*ss1d+k*ss2d             # <<<<<<<<<<<<<<
- *                 for r in range(8):
- *                     rr = (index+cvertices[r]) % nvox
- */
-        __pyx_t_23 = PyInt_FromLong(__pyx_v_i); if (unlikely(!__pyx_t_23)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 526; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-        __Pyx_GOTREF(__pyx_t_23);
-        __pyx_t_1 = PyNumber_Multiply(__pyx_t_23, __pyx_v_ss0d); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 526; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-        __Pyx_GOTREF(__pyx_t_1);
-        __Pyx_DECREF(__pyx_t_23); __pyx_t_23 = 0;
-        __pyx_t_23 = PyInt_FromLong(__pyx_v_j); if (unlikely(!__pyx_t_23)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 526; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-        __Pyx_GOTREF(__pyx_t_23);
-        __pyx_t_22 = PyNumber_Multiply(__pyx_t_23, __pyx_v_ss1d); if (unlikely(!__pyx_t_22)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 526; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-        __Pyx_GOTREF(__pyx_t_22);
-        __Pyx_DECREF(__pyx_t_23); __pyx_t_23 = 0;
-        __pyx_t_23 = PyNumber_Add(__pyx_t_1, __pyx_t_22); if (unlikely(!__pyx_t_23)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 526; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-        __Pyx_GOTREF(__pyx_t_23);
-        __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-        __Pyx_DECREF(__pyx_t_22); __pyx_t_22 = 0;
-        __pyx_t_22 = PyInt_FromLong(__pyx_v_k); if (unlikely(!__pyx_t_22)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 526; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-        __Pyx_GOTREF(__pyx_t_22);
-        __pyx_t_1 = PyNumber_Multiply(__pyx_t_22, __pyx_v_ss2d); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 526; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-        __Pyx_GOTREF(__pyx_t_1);
-        __Pyx_DECREF(__pyx_t_22); __pyx_t_22 = 0;
-        __pyx_t_22 = PyNumber_Add(__pyx_t_23, __pyx_t_1); if (unlikely(!__pyx_t_22)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 526; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-        __Pyx_GOTREF(__pyx_t_22);
-        __Pyx_DECREF(__pyx_t_23); __pyx_t_23 = 0;
-        __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-        __pyx_t_34 = __Pyx_PyInt_AsLong(__pyx_t_22); if (unlikely((__pyx_t_34 == (long)-1) && PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 526; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-        __Pyx_DECREF(__pyx_t_22); __pyx_t_22 = 0;
-        __pyx_v_index = __pyx_t_34;
-
-        /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":527
- *                 pindex = i*ss0+j*ss1+k*ss2
- *                 index = i*ss0d+j*ss1d+k*ss2d
- *                 for r in range(8):             # <<<<<<<<<<<<<<
- *                     rr = (index+cvertices[r]) % nvox
- *                     mr = fmask[rr]
- */
-        for (__pyx_t_34 = 0; __pyx_t_34 < 8; __pyx_t_34+=1) {
-          __pyx_v_r = __pyx_t_34;
-
-          /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":528
- *                 index = i*ss0d+j*ss1d+k*ss2d
- *                 for r in range(8):
- *                     rr = (index+cvertices[r]) % nvox             # <<<<<<<<<<<<<<
- *                     mr = fmask[rr]
- *                     for s in range(r+1):
- */
-          __pyx_t_35 = __pyx_v_r;
-          __pyx_t_9 = -1;
-          if (__pyx_t_35 < 0) {
-            __pyx_t_35 += __pyx_bshape_0_cvertices;
-            if (unlikely(__pyx_t_35 < 0)) __pyx_t_9 = 0;
-          } else if (unlikely(__pyx_t_35 >= __pyx_bshape_0_cvertices)) __pyx_t_9 = 0;
-          if (unlikely(__pyx_t_9 != -1)) {
-            __Pyx_RaiseBufferIndexError(__pyx_t_9);
-            {__pyx_filename = __pyx_f[0]; __pyx_lineno = 528; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-          }
-          __pyx_v_rr = ((__pyx_v_index + (*__Pyx_BufPtrStrided1d(__pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_int_t *, __pyx_bstruct_cvertices.buf, __pyx_t_35, __pyx_bstride_0_cvertices))) % __pyx_v_nvox);
-
-          /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":529
- *                 for r in range(8):
- *                     rr = (index+cvertices[r]) % nvox
- *                     mr = fmask[rr]             # <<<<<<<<<<<<<<
- *                     for s in range(r+1):
- *                         res = 0
- */
-          __pyx_t_36 = __pyx_v_rr;
-          __pyx_t_9 = -1;
-          if (__pyx_t_36 < 0) {
-            __pyx_t_36 += __pyx_bshape_0_fmask;
-            if (unlikely(__pyx_t_36 < 0)) __pyx_t_9 = 0;
-          } else if (unlikely(__pyx_t_36 >= __pyx_bshape_0_fmask)) __pyx_t_9 = 0;
-          if (unlikely(__pyx_t_9 != -1)) {
-            __Pyx_RaiseBufferIndexError(__pyx_t_9);
-            {__pyx_filename = __pyx_f[0]; __pyx_lineno = 529; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-          }
-          __pyx_v_mr = (*__Pyx_BufPtrStrided1d(__pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_int_t *, __pyx_bstruct_fmask.buf, __pyx_t_36, __pyx_bstride_0_fmask));
-
-          /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":530
- *                     rr = (index+cvertices[r]) % nvox
- *                     mr = fmask[rr]
- *                     for s in range(r+1):             # <<<<<<<<<<<<<<
- *                         res = 0
- *                         ss = (index+cvertices[s]) % nvox
- */
-          for (__pyx_t_37 = 0; __pyx_t_37 < (__pyx_v_r + 1); __pyx_t_37+=1) {
-            __pyx_v_s = __pyx_t_37;
-
-            /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":531
- *                     mr = fmask[rr]
- *                     for s in range(r+1):
- *                         res = 0             # <<<<<<<<<<<<<<
- *                         ss = (index+cvertices[s]) % nvox
- *                         ms = fmask[ss]
- */
-            __pyx_v_res = 0;
-
-            /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":532
- *                     for s in range(r+1):
- *                         res = 0
- *                         ss = (index+cvertices[s]) % nvox             # <<<<<<<<<<<<<<
- *                         ms = fmask[ss]
- *                         if mr * ms:
- */
-            __pyx_t_38 = __pyx_v_s;
-            __pyx_t_9 = -1;
-            if (__pyx_t_38 < 0) {
-              __pyx_t_38 += __pyx_bshape_0_cvertices;
-              if (unlikely(__pyx_t_38 < 0)) __pyx_t_9 = 0;
-            } else if (unlikely(__pyx_t_38 >= __pyx_bshape_0_cvertices)) __pyx_t_9 = 0;
-            if (unlikely(__pyx_t_9 != -1)) {
-              __Pyx_RaiseBufferIndexError(__pyx_t_9);
-              {__pyx_filename = __pyx_f[0]; __pyx_lineno = 532; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            }
-            __pyx_v_ss = ((__pyx_v_index + (*__Pyx_BufPtrStrided1d(__pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_int_t *, __pyx_bstruct_cvertices.buf, __pyx_t_38, __pyx_bstride_0_cvertices))) % __pyx_v_nvox);
-
-            /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":533
- *                         res = 0
- *                         ss = (index+cvertices[s]) % nvox
- *                         ms = fmask[ss]             # <<<<<<<<<<<<<<
- *                         if mr * ms:
- *                             for l in range(fcoords.shape[0]):
- */
-            __pyx_t_39 = __pyx_v_ss;
-            __pyx_t_9 = -1;
-            if (__pyx_t_39 < 0) {
-              __pyx_t_39 += __pyx_bshape_0_fmask;
-              if (unlikely(__pyx_t_39 < 0)) __pyx_t_9 = 0;
-            } else if (unlikely(__pyx_t_39 >= __pyx_bshape_0_fmask)) __pyx_t_9 = 0;
-            if (unlikely(__pyx_t_9 != -1)) {
-              __Pyx_RaiseBufferIndexError(__pyx_t_9);
-              {__pyx_filename = __pyx_f[0]; __pyx_lineno = 533; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            }
-            __pyx_v_ms = (*__Pyx_BufPtrStrided1d(__pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_int_t *, __pyx_bstruct_fmask.buf, __pyx_t_39, __pyx_bstride_0_fmask));
-
-            /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":534
- *                         ss = (index+cvertices[s]) % nvox
- *                         ms = fmask[ss]
- *                         if mr * ms:             # <<<<<<<<<<<<<<
- *                             for l in range(fcoords.shape[0]):
- *                                 res += fcoords[l,ss] * fcoords[l,rr]
- */
-            __pyx_t_40 = (__pyx_v_mr * __pyx_v_ms);
-            if (__pyx_t_40) {
-
-              /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":535
- *                         ms = fmask[ss]
- *                         if mr * ms:
- *                             for l in range(fcoords.shape[0]):             # <<<<<<<<<<<<<<
- *                                 res += fcoords[l,ss] * fcoords[l,rr]
- *                             D[r,s] = res
- */
-              for (__pyx_t_40 = 0; __pyx_t_40 < (__pyx_v_fcoords->dimensions[0]); __pyx_t_40+=1) {
-                __pyx_v_l = __pyx_t_40;
-
-                /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":536
- *                         if mr * ms:
- *                             for l in range(fcoords.shape[0]):
- *                                 res += fcoords[l,ss] * fcoords[l,rr]             # <<<<<<<<<<<<<<
- *                             D[r,s] = res
- *                             D[s,r] = res
- */
-                __pyx_t_41 = __pyx_v_l;
-                __pyx_t_42 = __pyx_v_ss;
-                __pyx_t_9 = -1;
-                if (__pyx_t_41 < 0) {
-                  __pyx_t_41 += __pyx_bshape_0_fcoords;
-                  if (unlikely(__pyx_t_41 < 0)) __pyx_t_9 = 0;
-                } else if (unlikely(__pyx_t_41 >= __pyx_bshape_0_fcoords)) __pyx_t_9 = 0;
-                if (__pyx_t_42 < 0) {
-                  __pyx_t_42 += __pyx_bshape_1_fcoords;
-                  if (unlikely(__pyx_t_42 < 0)) __pyx_t_9 = 1;
-                } else if (unlikely(__pyx_t_42 >= __pyx_bshape_1_fcoords)) __pyx_t_9 = 1;
-                if (unlikely(__pyx_t_9 != -1)) {
-                  __Pyx_RaiseBufferIndexError(__pyx_t_9);
-                  {__pyx_filename = __pyx_f[0]; __pyx_lineno = 536; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-                }
-                __pyx_t_43 = __pyx_v_l;
-                __pyx_t_44 = __pyx_v_rr;
-                __pyx_t_9 = -1;
-                if (__pyx_t_43 < 0) {
-                  __pyx_t_43 += __pyx_bshape_0_fcoords;
-                  if (unlikely(__pyx_t_43 < 0)) __pyx_t_9 = 0;
-                } else if (unlikely(__pyx_t_43 >= __pyx_bshape_0_fcoords)) __pyx_t_9 = 0;
-                if (__pyx_t_44 < 0) {
-                  __pyx_t_44 += __pyx_bshape_1_fcoords;
-                  if (unlikely(__pyx_t_44 < 0)) __pyx_t_9 = 1;
-                } else if (unlikely(__pyx_t_44 >= __pyx_bshape_1_fcoords)) __pyx_t_9 = 1;
-                if (unlikely(__pyx_t_9 != -1)) {
-                  __Pyx_RaiseBufferIndexError(__pyx_t_9);
-                  {__pyx_filename = __pyx_f[0]; __pyx_lineno = 536; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-                }
-                __pyx_v_res += ((*__Pyx_BufPtrStrided2d(__pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_float_t *, __pyx_bstruct_fcoords.buf, __pyx_t_41, __pyx_bstride_0_fcoords, __pyx_t_42, __pyx_bstride_1_fcoords)) * (*__Pyx_BufPtrStrided2d(__pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_float_t *, __pyx_bstruct_fcoords.buf, __pyx_t_43, __pyx_bstride_0_fcoords, __pyx_t_44, __pyx_bstride_1_fcoords)));
-              }
-
-              /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":537
- *                             for l in range(fcoords.shape[0]):
- *                                 res += fcoords[l,ss] * fcoords[l,rr]
- *                             D[r,s] = res             # <<<<<<<<<<<<<<
- *                             D[s,r] = res
- *                         else:
- */
-              __pyx_t_40 = __pyx_v_r;
-              __pyx_t_45 = __pyx_v_s;
-              __pyx_t_9 = -1;
-              if (__pyx_t_40 < 0) {
-                __pyx_t_40 += __pyx_bshape_0_D;
-                if (unlikely(__pyx_t_40 < 0)) __pyx_t_9 = 0;
-              } else if (unlikely(__pyx_t_40 >= __pyx_bshape_0_D)) __pyx_t_9 = 0;
-              if (__pyx_t_45 < 0) {
-                __pyx_t_45 += __pyx_bshape_1_D;
-                if (unlikely(__pyx_t_45 < 0)) __pyx_t_9 = 1;
-              } else if (unlikely(__pyx_t_45 >= __pyx_bshape_1_D)) __pyx_t_9 = 1;
-              if (unlikely(__pyx_t_9 != -1)) {
-                __Pyx_RaiseBufferIndexError(__pyx_t_9);
-                {__pyx_filename = __pyx_f[0]; __pyx_lineno = 537; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-              }
-              *__Pyx_BufPtrStrided2d(__pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_float_t *, __pyx_bstruct_D.buf, __pyx_t_40, __pyx_bstride_0_D, __pyx_t_45, __pyx_bstride_1_D) = __pyx_v_res;
-
-              /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":538
- *                                 res += fcoords[l,ss] * fcoords[l,rr]
- *                             D[r,s] = res
- *                             D[s,r] = res             # <<<<<<<<<<<<<<
- *                         else:
- *                             D[r,s] = 0
- */
-              __pyx_t_46 = __pyx_v_s;
-              __pyx_t_47 = __pyx_v_r;
-              __pyx_t_9 = -1;
-              if (__pyx_t_46 < 0) {
-                __pyx_t_46 += __pyx_bshape_0_D;
-                if (unlikely(__pyx_t_46 < 0)) __pyx_t_9 = 0;
-              } else if (unlikely(__pyx_t_46 >= __pyx_bshape_0_D)) __pyx_t_9 = 0;
-              if (__pyx_t_47 < 0) {
-                __pyx_t_47 += __pyx_bshape_1_D;
-                if (unlikely(__pyx_t_47 < 0)) __pyx_t_9 = 1;
-              } else if (unlikely(__pyx_t_47 >= __pyx_bshape_1_D)) __pyx_t_9 = 1;
-              if (unlikely(__pyx_t_9 != -1)) {
-                __Pyx_RaiseBufferIndexError(__pyx_t_9);
-                {__pyx_filename = __pyx_f[0]; __pyx_lineno = 538; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-              }
-              *__Pyx_BufPtrStrided2d(__pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_float_t *, __pyx_bstruct_D.buf, __pyx_t_46, __pyx_bstride_0_D, __pyx_t_47, __pyx_bstride_1_D) = __pyx_v_res;
-              goto __pyx_L36;
-            }
-            /*else*/ {
-
-              /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":540
- *                             D[s,r] = res
- *                         else:
- *                             D[r,s] = 0             # <<<<<<<<<<<<<<
- *                             D[s,r] = 0
- * 
- */
-              __pyx_t_48 = __pyx_v_r;
-              __pyx_t_49 = __pyx_v_s;
-              __pyx_t_9 = -1;
-              if (__pyx_t_48 < 0) {
-                __pyx_t_48 += __pyx_bshape_0_D;
-                if (unlikely(__pyx_t_48 < 0)) __pyx_t_9 = 0;
-              } else if (unlikely(__pyx_t_48 >= __pyx_bshape_0_D)) __pyx_t_9 = 0;
-              if (__pyx_t_49 < 0) {
-                __pyx_t_49 += __pyx_bshape_1_D;
-                if (unlikely(__pyx_t_49 < 0)) __pyx_t_9 = 1;
-              } else if (unlikely(__pyx_t_49 >= __pyx_bshape_1_D)) __pyx_t_9 = 1;
-              if (unlikely(__pyx_t_9 != -1)) {
-                __Pyx_RaiseBufferIndexError(__pyx_t_9);
-                {__pyx_filename = __pyx_f[0]; __pyx_lineno = 540; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-              }
-              *__Pyx_BufPtrStrided2d(__pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_float_t *, __pyx_bstruct_D.buf, __pyx_t_48, __pyx_bstride_0_D, __pyx_t_49, __pyx_bstride_1_D) = 0;
-
-              /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":541
- *                         else:
- *                             D[r,s] = 0
- *                             D[s,r] = 0             # <<<<<<<<<<<<<<
- * 
- *                 for l in range(ds4):
- */
-              __pyx_t_50 = __pyx_v_s;
-              __pyx_t_51 = __pyx_v_r;
-              __pyx_t_9 = -1;
-              if (__pyx_t_50 < 0) {
-                __pyx_t_50 += __pyx_bshape_0_D;
-                if (unlikely(__pyx_t_50 < 0)) __pyx_t_9 = 0;
-              } else if (unlikely(__pyx_t_50 >= __pyx_bshape_0_D)) __pyx_t_9 = 0;
-              if (__pyx_t_51 < 0) {
-                __pyx_t_51 += __pyx_bshape_1_D;
-                if (unlikely(__pyx_t_51 < 0)) __pyx_t_9 = 1;
-              } else if (unlikely(__pyx_t_51 >= __pyx_bshape_1_D)) __pyx_t_9 = 1;
-              if (unlikely(__pyx_t_9 != -1)) {
-                __Pyx_RaiseBufferIndexError(__pyx_t_9);
-                {__pyx_filename = __pyx_f[0]; __pyx_lineno = 541; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-              }
-              *__Pyx_BufPtrStrided2d(__pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_float_t *, __pyx_bstruct_D.buf, __pyx_t_50, __pyx_bstride_0_D, __pyx_t_51, __pyx_bstride_1_D) = 0;
-            }
-            __pyx_L36:;
-          }
-        }
-
-        /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":543
- *                             D[s,r] = 0
- * 
- *                 for l in range(ds4):             # <<<<<<<<<<<<<<
- *                     v0 = pindex + d4[l,0]
- *                     w0 = d4[l,4]
- */
-        for (__pyx_t_34 = 0; __pyx_t_34 < __pyx_v_ds4; __pyx_t_34+=1) {
-          __pyx_v_l = __pyx_t_34;
-
-          /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":544
- * 
- *                 for l in range(ds4):
- *                     v0 = pindex + d4[l,0]             # <<<<<<<<<<<<<<
- *                     w0 = d4[l,4]
- *                     m = fpmask[v0]
- */
-          __pyx_t_37 = __pyx_v_l;
-          __pyx_t_52 = 0;
-          __pyx_t_9 = -1;
-          if (__pyx_t_37 < 0) {
-            __pyx_t_37 += __pyx_bshape_0_d4;
-            if (unlikely(__pyx_t_37 < 0)) __pyx_t_9 = 0;
-          } else if (unlikely(__pyx_t_37 >= __pyx_bshape_0_d4)) __pyx_t_9 = 0;
-          if (__pyx_t_52 < 0) {
-            __pyx_t_52 += __pyx_bshape_1_d4;
-            if (unlikely(__pyx_t_52 < 0)) __pyx_t_9 = 1;
-          } else if (unlikely(__pyx_t_52 >= __pyx_bshape_1_d4)) __pyx_t_9 = 1;
-          if (unlikely(__pyx_t_9 != -1)) {
-            __Pyx_RaiseBufferIndexError(__pyx_t_9);
-            {__pyx_filename = __pyx_f[0]; __pyx_lineno = 544; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-          }
-          __pyx_v_v0 = (__pyx_v_pindex + (*__Pyx_BufPtrStrided2d(__pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_int_t *, __pyx_bstruct_d4.buf, __pyx_t_37, __pyx_bstride_0_d4, __pyx_t_52, __pyx_bstride_1_d4)));
-
-          /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":545
- *                 for l in range(ds4):
- *                     v0 = pindex + d4[l,0]
- *                     w0 = d4[l,4]             # <<<<<<<<<<<<<<
- *                     m = fpmask[v0]
- *                     if m:
- */
-          __pyx_t_53 = __pyx_v_l;
-          __pyx_t_54 = 4;
-          __pyx_t_9 = -1;
-          if (__pyx_t_53 < 0) {
-            __pyx_t_53 += __pyx_bshape_0_d4;
-            if (unlikely(__pyx_t_53 < 0)) __pyx_t_9 = 0;
-          } else if (unlikely(__pyx_t_53 >= __pyx_bshape_0_d4)) __pyx_t_9 = 0;
-          if (__pyx_t_54 < 0) {
-            __pyx_t_54 += __pyx_bshape_1_d4;
-            if (unlikely(__pyx_t_54 < 0)) __pyx_t_9 = 1;
-          } else if (unlikely(__pyx_t_54 >= __pyx_bshape_1_d4)) __pyx_t_9 = 1;
-          if (unlikely(__pyx_t_9 != -1)) {
-            __Pyx_RaiseBufferIndexError(__pyx_t_9);
-            {__pyx_filename = __pyx_f[0]; __pyx_lineno = 545; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-          }
-          __pyx_v_w0 = (*__Pyx_BufPtrStrided2d(__pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_int_t *, __pyx_bstruct_d4.buf, __pyx_t_53, __pyx_bstride_0_d4, __pyx_t_54, __pyx_bstride_1_d4));
-
-          /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":546
- *                     v0 = pindex + d4[l,0]
- *                     w0 = d4[l,4]
- *                     m = fpmask[v0]             # <<<<<<<<<<<<<<
- *                     if m:
- *                         v1 = pindex + d4[l,1]
- */
-          __pyx_t_55 = __pyx_v_v0;
-          __pyx_t_9 = -1;
-          if (__pyx_t_55 < 0) {
-            __pyx_t_55 += __pyx_bshape_0_fpmask;
-            if (unlikely(__pyx_t_55 < 0)) __pyx_t_9 = 0;
-          } else if (unlikely(__pyx_t_55 >= __pyx_bshape_0_fpmask)) __pyx_t_9 = 0;
-          if (unlikely(__pyx_t_9 != -1)) {
-            __Pyx_RaiseBufferIndexError(__pyx_t_9);
-            {__pyx_filename = __pyx_f[0]; __pyx_lineno = 546; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-          }
-          __pyx_v_m = (*__Pyx_BufPtrStrided1d(__pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_int_t *, __pyx_bstruct_fpmask.buf, __pyx_t_55, __pyx_bstride_0_fpmask));
-
-          /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":547
- *                     w0 = d4[l,4]
- *                     m = fpmask[v0]
- *                     if m:             # <<<<<<<<<<<<<<
- *                         v1 = pindex + d4[l,1]
- *                         v2 = pindex + d4[l,2]
- */
-          __pyx_t_56 = __pyx_v_m;
-          if (__pyx_t_56) {
-
-            /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":548
- *                     m = fpmask[v0]
- *                     if m:
- *                         v1 = pindex + d4[l,1]             # <<<<<<<<<<<<<<
- *                         v2 = pindex + d4[l,2]
- *                         v3 = pindex + d4[l,3]
- */
-            __pyx_t_56 = __pyx_v_l;
-            __pyx_t_57 = 1;
-            __pyx_t_9 = -1;
-            if (__pyx_t_56 < 0) {
-              __pyx_t_56 += __pyx_bshape_0_d4;
-              if (unlikely(__pyx_t_56 < 0)) __pyx_t_9 = 0;
-            } else if (unlikely(__pyx_t_56 >= __pyx_bshape_0_d4)) __pyx_t_9 = 0;
-            if (__pyx_t_57 < 0) {
-              __pyx_t_57 += __pyx_bshape_1_d4;
-              if (unlikely(__pyx_t_57 < 0)) __pyx_t_9 = 1;
-            } else if (unlikely(__pyx_t_57 >= __pyx_bshape_1_d4)) __pyx_t_9 = 1;
-            if (unlikely(__pyx_t_9 != -1)) {
-              __Pyx_RaiseBufferIndexError(__pyx_t_9);
-              {__pyx_filename = __pyx_f[0]; __pyx_lineno = 548; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            }
-            __pyx_v_v1 = (__pyx_v_pindex + (*__Pyx_BufPtrStrided2d(__pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_int_t *, __pyx_bstruct_d4.buf, __pyx_t_56, __pyx_bstride_0_d4, __pyx_t_57, __pyx_bstride_1_d4)));
-
-            /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":549
- *                     if m:
- *                         v1 = pindex + d4[l,1]
- *                         v2 = pindex + d4[l,2]             # <<<<<<<<<<<<<<
- *                         v3 = pindex + d4[l,3]
- *                         w1 = d4[l,5]
- */
-            __pyx_t_58 = __pyx_v_l;
-            __pyx_t_59 = 2;
-            __pyx_t_9 = -1;
-            if (__pyx_t_58 < 0) {
-              __pyx_t_58 += __pyx_bshape_0_d4;
-              if (unlikely(__pyx_t_58 < 0)) __pyx_t_9 = 0;
-            } else if (unlikely(__pyx_t_58 >= __pyx_bshape_0_d4)) __pyx_t_9 = 0;
-            if (__pyx_t_59 < 0) {
-              __pyx_t_59 += __pyx_bshape_1_d4;
-              if (unlikely(__pyx_t_59 < 0)) __pyx_t_9 = 1;
-            } else if (unlikely(__pyx_t_59 >= __pyx_bshape_1_d4)) __pyx_t_9 = 1;
-            if (unlikely(__pyx_t_9 != -1)) {
-              __Pyx_RaiseBufferIndexError(__pyx_t_9);
-              {__pyx_filename = __pyx_f[0]; __pyx_lineno = 549; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            }
-            __pyx_v_v2 = (__pyx_v_pindex + (*__Pyx_BufPtrStrided2d(__pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_int_t *, __pyx_bstruct_d4.buf, __pyx_t_58, __pyx_bstride_0_d4, __pyx_t_59, __pyx_bstride_1_d4)));
-
-            /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":550
- *                         v1 = pindex + d4[l,1]
- *                         v2 = pindex + d4[l,2]
- *                         v3 = pindex + d4[l,3]             # <<<<<<<<<<<<<<
- *                         w1 = d4[l,5]
- *                         w2 = d4[l,6]
- */
-            __pyx_t_60 = __pyx_v_l;
-            __pyx_t_61 = 3;
-            __pyx_t_9 = -1;
-            if (__pyx_t_60 < 0) {
-              __pyx_t_60 += __pyx_bshape_0_d4;
-              if (unlikely(__pyx_t_60 < 0)) __pyx_t_9 = 0;
-            } else if (unlikely(__pyx_t_60 >= __pyx_bshape_0_d4)) __pyx_t_9 = 0;
-            if (__pyx_t_61 < 0) {
-              __pyx_t_61 += __pyx_bshape_1_d4;
-              if (unlikely(__pyx_t_61 < 0)) __pyx_t_9 = 1;
-            } else if (unlikely(__pyx_t_61 >= __pyx_bshape_1_d4)) __pyx_t_9 = 1;
-            if (unlikely(__pyx_t_9 != -1)) {
-              __Pyx_RaiseBufferIndexError(__pyx_t_9);
-              {__pyx_filename = __pyx_f[0]; __pyx_lineno = 550; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            }
-            __pyx_v_v3 = (__pyx_v_pindex + (*__Pyx_BufPtrStrided2d(__pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_int_t *, __pyx_bstruct_d4.buf, __pyx_t_60, __pyx_bstride_0_d4, __pyx_t_61, __pyx_bstride_1_d4)));
-
-            /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":551
- *                         v2 = pindex + d4[l,2]
- *                         v3 = pindex + d4[l,3]
- *                         w1 = d4[l,5]             # <<<<<<<<<<<<<<
- *                         w2 = d4[l,6]
- *                         w3 = d4[l,7]
- */
-            __pyx_t_62 = __pyx_v_l;
-            __pyx_t_63 = 5;
-            __pyx_t_9 = -1;
-            if (__pyx_t_62 < 0) {
-              __pyx_t_62 += __pyx_bshape_0_d4;
-              if (unlikely(__pyx_t_62 < 0)) __pyx_t_9 = 0;
-            } else if (unlikely(__pyx_t_62 >= __pyx_bshape_0_d4)) __pyx_t_9 = 0;
-            if (__pyx_t_63 < 0) {
-              __pyx_t_63 += __pyx_bshape_1_d4;
-              if (unlikely(__pyx_t_63 < 0)) __pyx_t_9 = 1;
-            } else if (unlikely(__pyx_t_63 >= __pyx_bshape_1_d4)) __pyx_t_9 = 1;
-            if (unlikely(__pyx_t_9 != -1)) {
-              __Pyx_RaiseBufferIndexError(__pyx_t_9);
-              {__pyx_filename = __pyx_f[0]; __pyx_lineno = 551; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            }
-            __pyx_v_w1 = (*__Pyx_BufPtrStrided2d(__pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_int_t *, __pyx_bstruct_d4.buf, __pyx_t_62, __pyx_bstride_0_d4, __pyx_t_63, __pyx_bstride_1_d4));
-
-            /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":552
- *                         v3 = pindex + d4[l,3]
- *                         w1 = d4[l,5]
- *                         w2 = d4[l,6]             # <<<<<<<<<<<<<<
- *                         w3 = d4[l,7]
- * 
- */
-            __pyx_t_64 = __pyx_v_l;
-            __pyx_t_65 = 6;
-            __pyx_t_9 = -1;
-            if (__pyx_t_64 < 0) {
-              __pyx_t_64 += __pyx_bshape_0_d4;
-              if (unlikely(__pyx_t_64 < 0)) __pyx_t_9 = 0;
-            } else if (unlikely(__pyx_t_64 >= __pyx_bshape_0_d4)) __pyx_t_9 = 0;
-            if (__pyx_t_65 < 0) {
-              __pyx_t_65 += __pyx_bshape_1_d4;
-              if (unlikely(__pyx_t_65 < 0)) __pyx_t_9 = 1;
-            } else if (unlikely(__pyx_t_65 >= __pyx_bshape_1_d4)) __pyx_t_9 = 1;
-            if (unlikely(__pyx_t_9 != -1)) {
-              __Pyx_RaiseBufferIndexError(__pyx_t_9);
-              {__pyx_filename = __pyx_f[0]; __pyx_lineno = 552; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            }
-            __pyx_v_w2 = (*__Pyx_BufPtrStrided2d(__pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_int_t *, __pyx_bstruct_d4.buf, __pyx_t_64, __pyx_bstride_0_d4, __pyx_t_65, __pyx_bstride_1_d4));
-
-            /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":553
- *                         w1 = d4[l,5]
- *                         w2 = d4[l,6]
- *                         w3 = d4[l,7]             # <<<<<<<<<<<<<<
- * 
- *                         m = m * fpmask[v1] * fpmask[v2] * fpmask[v3]
- */
-            __pyx_t_66 = __pyx_v_l;
-            __pyx_t_67 = 7;
-            __pyx_t_9 = -1;
-            if (__pyx_t_66 < 0) {
-              __pyx_t_66 += __pyx_bshape_0_d4;
-              if (unlikely(__pyx_t_66 < 0)) __pyx_t_9 = 0;
-            } else if (unlikely(__pyx_t_66 >= __pyx_bshape_0_d4)) __pyx_t_9 = 0;
-            if (__pyx_t_67 < 0) {
-              __pyx_t_67 += __pyx_bshape_1_d4;
-              if (unlikely(__pyx_t_67 < 0)) __pyx_t_9 = 1;
-            } else if (unlikely(__pyx_t_67 >= __pyx_bshape_1_d4)) __pyx_t_9 = 1;
-            if (unlikely(__pyx_t_9 != -1)) {
-              __Pyx_RaiseBufferIndexError(__pyx_t_9);
-              {__pyx_filename = __pyx_f[0]; __pyx_lineno = 553; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            }
-            __pyx_v_w3 = (*__Pyx_BufPtrStrided2d(__pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_int_t *, __pyx_bstruct_d4.buf, __pyx_t_66, __pyx_bstride_0_d4, __pyx_t_67, __pyx_bstride_1_d4));
-
-            /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":555
- *                         w3 = d4[l,7]
- * 
- *                         m = m * fpmask[v1] * fpmask[v2] * fpmask[v3]             # <<<<<<<<<<<<<<
- *                         d = m * mu3_tet(D[w0,w0], D[w0,w1], D[w0,w2],
- *                                         D[w0,w3], D[w1,w1], D[w1,w2],
- */
-            __pyx_t_68 = __pyx_v_v1;
-            __pyx_t_9 = -1;
-            if (__pyx_t_68 < 0) {
-              __pyx_t_68 += __pyx_bshape_0_fpmask;
-              if (unlikely(__pyx_t_68 < 0)) __pyx_t_9 = 0;
-            } else if (unlikely(__pyx_t_68 >= __pyx_bshape_0_fpmask)) __pyx_t_9 = 0;
-            if (unlikely(__pyx_t_9 != -1)) {
-              __Pyx_RaiseBufferIndexError(__pyx_t_9);
-              {__pyx_filename = __pyx_f[0]; __pyx_lineno = 555; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            }
-            __pyx_t_69 = __pyx_v_v2;
-            __pyx_t_9 = -1;
-            if (__pyx_t_69 < 0) {
-              __pyx_t_69 += __pyx_bshape_0_fpmask;
-              if (unlikely(__pyx_t_69 < 0)) __pyx_t_9 = 0;
-            } else if (unlikely(__pyx_t_69 >= __pyx_bshape_0_fpmask)) __pyx_t_9 = 0;
-            if (unlikely(__pyx_t_9 != -1)) {
-              __Pyx_RaiseBufferIndexError(__pyx_t_9);
-              {__pyx_filename = __pyx_f[0]; __pyx_lineno = 555; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            }
-            __pyx_t_70 = __pyx_v_v3;
-            __pyx_t_9 = -1;
-            if (__pyx_t_70 < 0) {
-              __pyx_t_70 += __pyx_bshape_0_fpmask;
-              if (unlikely(__pyx_t_70 < 0)) __pyx_t_9 = 0;
-            } else if (unlikely(__pyx_t_70 >= __pyx_bshape_0_fpmask)) __pyx_t_9 = 0;
-            if (unlikely(__pyx_t_9 != -1)) {
-              __Pyx_RaiseBufferIndexError(__pyx_t_9);
-              {__pyx_filename = __pyx_f[0]; __pyx_lineno = 555; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            }
-            __pyx_v_m = (((__pyx_v_m * (*__Pyx_BufPtrStrided1d(__pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_int_t *, __pyx_bstruct_fpmask.buf, __pyx_t_68, __pyx_bstride_0_fpmask))) * (*__Pyx_BufPtrStrided1d(__pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_int_t *, __pyx_bstruct_fpmask.buf, __pyx_t_69, __pyx_bstride_0_fpmask))) * (*__Pyx_BufPtrStrided1d(__pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_int_t *, __pyx_bstruct_fpmask.buf, __pyx_t_70, __pyx_bstride_0_fpmask)));
-
-            /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":556
- * 
- *                         m = m * fpmask[v1] * fpmask[v2] * fpmask[v3]
- *                         d = m * mu3_tet(D[w0,w0], D[w0,w1], D[w0,w2],             # <<<<<<<<<<<<<<
- *                                         D[w0,w3], D[w1,w1], D[w1,w2],
- *                                         D[w1,w3], D[w2,w2], D[w2,w3],
- */
-            __pyx_t_22 = PyInt_FromLong(__pyx_v_m); if (unlikely(!__pyx_t_22)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 556; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            __Pyx_GOTREF(__pyx_t_22);
-            __pyx_2 = __Pyx_GetName(__pyx_m, __pyx_kp_50); if (unlikely(!__pyx_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 556; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            __Pyx_GOTREF(__pyx_2);
-            __pyx_t_71 = __pyx_v_w0;
-            __pyx_t_72 = __pyx_v_w0;
-            __pyx_t_9 = -1;
-            if (__pyx_t_71 < 0) {
-              __pyx_t_71 += __pyx_bshape_0_D;
-              if (unlikely(__pyx_t_71 < 0)) __pyx_t_9 = 0;
-            } else if (unlikely(__pyx_t_71 >= __pyx_bshape_0_D)) __pyx_t_9 = 0;
-            if (__pyx_t_72 < 0) {
-              __pyx_t_72 += __pyx_bshape_1_D;
-              if (unlikely(__pyx_t_72 < 0)) __pyx_t_9 = 1;
-            } else if (unlikely(__pyx_t_72 >= __pyx_bshape_1_D)) __pyx_t_9 = 1;
-            if (unlikely(__pyx_t_9 != -1)) {
-              __Pyx_RaiseBufferIndexError(__pyx_t_9);
-              {__pyx_filename = __pyx_f[0]; __pyx_lineno = 556; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            }
-            __pyx_t_1 = PyFloat_FromDouble((*__Pyx_BufPtrStrided2d(__pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_float_t *, __pyx_bstruct_D.buf, __pyx_t_71, __pyx_bstride_0_D, __pyx_t_72, __pyx_bstride_1_D))); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 556; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            __Pyx_GOTREF(__pyx_t_1);
-            __pyx_t_73 = __pyx_v_w0;
-            __pyx_t_74 = __pyx_v_w1;
-            __pyx_t_9 = -1;
-            if (__pyx_t_73 < 0) {
-              __pyx_t_73 += __pyx_bshape_0_D;
-              if (unlikely(__pyx_t_73 < 0)) __pyx_t_9 = 0;
-            } else if (unlikely(__pyx_t_73 >= __pyx_bshape_0_D)) __pyx_t_9 = 0;
-            if (__pyx_t_74 < 0) {
-              __pyx_t_74 += __pyx_bshape_1_D;
-              if (unlikely(__pyx_t_74 < 0)) __pyx_t_9 = 1;
-            } else if (unlikely(__pyx_t_74 >= __pyx_bshape_1_D)) __pyx_t_9 = 1;
-            if (unlikely(__pyx_t_9 != -1)) {
-              __Pyx_RaiseBufferIndexError(__pyx_t_9);
-              {__pyx_filename = __pyx_f[0]; __pyx_lineno = 556; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            }
-            __pyx_t_23 = PyFloat_FromDouble((*__Pyx_BufPtrStrided2d(__pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_float_t *, __pyx_bstruct_D.buf, __pyx_t_73, __pyx_bstride_0_D, __pyx_t_74, __pyx_bstride_1_D))); if (unlikely(!__pyx_t_23)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 556; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            __Pyx_GOTREF(__pyx_t_23);
-            __pyx_t_75 = __pyx_v_w0;
-            __pyx_t_76 = __pyx_v_w2;
-            __pyx_t_9 = -1;
-            if (__pyx_t_75 < 0) {
-              __pyx_t_75 += __pyx_bshape_0_D;
-              if (unlikely(__pyx_t_75 < 0)) __pyx_t_9 = 0;
-            } else if (unlikely(__pyx_t_75 >= __pyx_bshape_0_D)) __pyx_t_9 = 0;
-            if (__pyx_t_76 < 0) {
-              __pyx_t_76 += __pyx_bshape_1_D;
-              if (unlikely(__pyx_t_76 < 0)) __pyx_t_9 = 1;
-            } else if (unlikely(__pyx_t_76 >= __pyx_bshape_1_D)) __pyx_t_9 = 1;
-            if (unlikely(__pyx_t_9 != -1)) {
-              __Pyx_RaiseBufferIndexError(__pyx_t_9);
-              {__pyx_filename = __pyx_f[0]; __pyx_lineno = 556; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            }
-            __pyx_t_25 = PyFloat_FromDouble((*__Pyx_BufPtrStrided2d(__pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_float_t *, __pyx_bstruct_D.buf, __pyx_t_75, __pyx_bstride_0_D, __pyx_t_76, __pyx_bstride_1_D))); if (unlikely(!__pyx_t_25)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 556; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            __Pyx_GOTREF(__pyx_t_25);
-
-            /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":557
- *                         m = m * fpmask[v1] * fpmask[v2] * fpmask[v3]
- *                         d = m * mu3_tet(D[w0,w0], D[w0,w1], D[w0,w2],
- *                                         D[w0,w3], D[w1,w1], D[w1,w2],             # <<<<<<<<<<<<<<
- *                                         D[w1,w3], D[w2,w2], D[w2,w3],
- *                                         D[w3,w3])
- */
-            __pyx_t_77 = __pyx_v_w0;
-            __pyx_t_78 = __pyx_v_w3;
-            __pyx_t_9 = -1;
-            if (__pyx_t_77 < 0) {
-              __pyx_t_77 += __pyx_bshape_0_D;
-              if (unlikely(__pyx_t_77 < 0)) __pyx_t_9 = 0;
-            } else if (unlikely(__pyx_t_77 >= __pyx_bshape_0_D)) __pyx_t_9 = 0;
-            if (__pyx_t_78 < 0) {
-              __pyx_t_78 += __pyx_bshape_1_D;
-              if (unlikely(__pyx_t_78 < 0)) __pyx_t_9 = 1;
-            } else if (unlikely(__pyx_t_78 >= __pyx_bshape_1_D)) __pyx_t_9 = 1;
-            if (unlikely(__pyx_t_9 != -1)) {
-              __Pyx_RaiseBufferIndexError(__pyx_t_9);
-              {__pyx_filename = __pyx_f[0]; __pyx_lineno = 557; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            }
-            __pyx_t_7 = PyFloat_FromDouble((*__Pyx_BufPtrStrided2d(__pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_float_t *, __pyx_bstruct_D.buf, __pyx_t_77, __pyx_bstride_0_D, __pyx_t_78, __pyx_bstride_1_D))); if (unlikely(!__pyx_t_7)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 557; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            __Pyx_GOTREF(__pyx_t_7);
-            __pyx_t_79 = __pyx_v_w1;
-            __pyx_t_80 = __pyx_v_w1;
-            __pyx_t_9 = -1;
-            if (__pyx_t_79 < 0) {
-              __pyx_t_79 += __pyx_bshape_0_D;
-              if (unlikely(__pyx_t_79 < 0)) __pyx_t_9 = 0;
-            } else if (unlikely(__pyx_t_79 >= __pyx_bshape_0_D)) __pyx_t_9 = 0;
-            if (__pyx_t_80 < 0) {
-              __pyx_t_80 += __pyx_bshape_1_D;
-              if (unlikely(__pyx_t_80 < 0)) __pyx_t_9 = 1;
-            } else if (unlikely(__pyx_t_80 >= __pyx_bshape_1_D)) __pyx_t_9 = 1;
-            if (unlikely(__pyx_t_9 != -1)) {
-              __Pyx_RaiseBufferIndexError(__pyx_t_9);
-              {__pyx_filename = __pyx_f[0]; __pyx_lineno = 557; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            }
-            __pyx_t_6 = PyFloat_FromDouble((*__Pyx_BufPtrStrided2d(__pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_float_t *, __pyx_bstruct_D.buf, __pyx_t_79, __pyx_bstride_0_D, __pyx_t_80, __pyx_bstride_1_D))); if (unlikely(!__pyx_t_6)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 557; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            __Pyx_GOTREF(__pyx_t_6);
-            __pyx_t_81 = __pyx_v_w1;
-            __pyx_t_82 = __pyx_v_w2;
-            __pyx_t_9 = -1;
-            if (__pyx_t_81 < 0) {
-              __pyx_t_81 += __pyx_bshape_0_D;
-              if (unlikely(__pyx_t_81 < 0)) __pyx_t_9 = 0;
-            } else if (unlikely(__pyx_t_81 >= __pyx_bshape_0_D)) __pyx_t_9 = 0;
-            if (__pyx_t_82 < 0) {
-              __pyx_t_82 += __pyx_bshape_1_D;
-              if (unlikely(__pyx_t_82 < 0)) __pyx_t_9 = 1;
-            } else if (unlikely(__pyx_t_82 >= __pyx_bshape_1_D)) __pyx_t_9 = 1;
-            if (unlikely(__pyx_t_9 != -1)) {
-              __Pyx_RaiseBufferIndexError(__pyx_t_9);
-              {__pyx_filename = __pyx_f[0]; __pyx_lineno = 557; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            }
-            __pyx_t_2 = PyFloat_FromDouble((*__Pyx_BufPtrStrided2d(__pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_float_t *, __pyx_bstruct_D.buf, __pyx_t_81, __pyx_bstride_0_D, __pyx_t_82, __pyx_bstride_1_D))); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 557; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            __Pyx_GOTREF(__pyx_t_2);
-
-            /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":558
- *                         d = m * mu3_tet(D[w0,w0], D[w0,w1], D[w0,w2],
- *                                         D[w0,w3], D[w1,w1], D[w1,w2],
- *                                         D[w1,w3], D[w2,w2], D[w2,w3],             # <<<<<<<<<<<<<<
- *                                         D[w3,w3])
- * 
- */
-            __pyx_t_83 = __pyx_v_w1;
-            __pyx_t_84 = __pyx_v_w3;
-            __pyx_t_9 = -1;
-            if (__pyx_t_83 < 0) {
-              __pyx_t_83 += __pyx_bshape_0_D;
-              if (unlikely(__pyx_t_83 < 0)) __pyx_t_9 = 0;
-            } else if (unlikely(__pyx_t_83 >= __pyx_bshape_0_D)) __pyx_t_9 = 0;
-            if (__pyx_t_84 < 0) {
-              __pyx_t_84 += __pyx_bshape_1_D;
-              if (unlikely(__pyx_t_84 < 0)) __pyx_t_9 = 1;
-            } else if (unlikely(__pyx_t_84 >= __pyx_bshape_1_D)) __pyx_t_9 = 1;
-            if (unlikely(__pyx_t_9 != -1)) {
-              __Pyx_RaiseBufferIndexError(__pyx_t_9);
-              {__pyx_filename = __pyx_f[0]; __pyx_lineno = 558; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            }
-            __pyx_t_3 = PyFloat_FromDouble((*__Pyx_BufPtrStrided2d(__pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_float_t *, __pyx_bstruct_D.buf, __pyx_t_83, __pyx_bstride_0_D, __pyx_t_84, __pyx_bstride_1_D))); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 558; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            __Pyx_GOTREF(__pyx_t_3);
-            __pyx_t_85 = __pyx_v_w2;
-            __pyx_t_86 = __pyx_v_w2;
-            __pyx_t_9 = -1;
-            if (__pyx_t_85 < 0) {
-              __pyx_t_85 += __pyx_bshape_0_D;
-              if (unlikely(__pyx_t_85 < 0)) __pyx_t_9 = 0;
-            } else if (unlikely(__pyx_t_85 >= __pyx_bshape_0_D)) __pyx_t_9 = 0;
-            if (__pyx_t_86 < 0) {
-              __pyx_t_86 += __pyx_bshape_1_D;
-              if (unlikely(__pyx_t_86 < 0)) __pyx_t_9 = 1;
-            } else if (unlikely(__pyx_t_86 >= __pyx_bshape_1_D)) __pyx_t_9 = 1;
-            if (unlikely(__pyx_t_9 != -1)) {
-              __Pyx_RaiseBufferIndexError(__pyx_t_9);
-              {__pyx_filename = __pyx_f[0]; __pyx_lineno = 558; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            }
-            __pyx_t_87 = PyFloat_FromDouble((*__Pyx_BufPtrStrided2d(__pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_float_t *, __pyx_bstruct_D.buf, __pyx_t_85, __pyx_bstride_0_D, __pyx_t_86, __pyx_bstride_1_D))); if (unlikely(!__pyx_t_87)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 558; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            __Pyx_GOTREF(__pyx_t_87);
-            __pyx_t_88 = __pyx_v_w2;
-            __pyx_t_89 = __pyx_v_w3;
-            __pyx_t_9 = -1;
-            if (__pyx_t_88 < 0) {
-              __pyx_t_88 += __pyx_bshape_0_D;
-              if (unlikely(__pyx_t_88 < 0)) __pyx_t_9 = 0;
-            } else if (unlikely(__pyx_t_88 >= __pyx_bshape_0_D)) __pyx_t_9 = 0;
-            if (__pyx_t_89 < 0) {
-              __pyx_t_89 += __pyx_bshape_1_D;
-              if (unlikely(__pyx_t_89 < 0)) __pyx_t_9 = 1;
-            } else if (unlikely(__pyx_t_89 >= __pyx_bshape_1_D)) __pyx_t_9 = 1;
-            if (unlikely(__pyx_t_9 != -1)) {
-              __Pyx_RaiseBufferIndexError(__pyx_t_9);
-              {__pyx_filename = __pyx_f[0]; __pyx_lineno = 558; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            }
-            __pyx_t_90 = PyFloat_FromDouble((*__Pyx_BufPtrStrided2d(__pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_float_t *, __pyx_bstruct_D.buf, __pyx_t_88, __pyx_bstride_0_D, __pyx_t_89, __pyx_bstride_1_D))); if (unlikely(!__pyx_t_90)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 558; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            __Pyx_GOTREF(__pyx_t_90);
-
-            /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":559
- *                                         D[w0,w3], D[w1,w1], D[w1,w2],
- *                                         D[w1,w3], D[w2,w2], D[w2,w3],
- *                                         D[w3,w3])             # <<<<<<<<<<<<<<
- * 
- *                         l3 = l3 + m * mu3_tet(D[w0,w0], D[w0,w1], D[w0,w2],
- */
-            __pyx_t_91 = __pyx_v_w3;
-            __pyx_t_92 = __pyx_v_w3;
-            __pyx_t_9 = -1;
-            if (__pyx_t_91 < 0) {
-              __pyx_t_91 += __pyx_bshape_0_D;
-              if (unlikely(__pyx_t_91 < 0)) __pyx_t_9 = 0;
-            } else if (unlikely(__pyx_t_91 >= __pyx_bshape_0_D)) __pyx_t_9 = 0;
-            if (__pyx_t_92 < 0) {
-              __pyx_t_92 += __pyx_bshape_1_D;
-              if (unlikely(__pyx_t_92 < 0)) __pyx_t_9 = 1;
-            } else if (unlikely(__pyx_t_92 >= __pyx_bshape_1_D)) __pyx_t_9 = 1;
-            if (unlikely(__pyx_t_9 != -1)) {
-              __Pyx_RaiseBufferIndexError(__pyx_t_9);
-              {__pyx_filename = __pyx_f[0]; __pyx_lineno = 559; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            }
-            __pyx_t_93 = PyFloat_FromDouble((*__Pyx_BufPtrStrided2d(__pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_float_t *, __pyx_bstruct_D.buf, __pyx_t_91, __pyx_bstride_0_D, __pyx_t_92, __pyx_bstride_1_D))); if (unlikely(!__pyx_t_93)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 559; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            __Pyx_GOTREF(__pyx_t_93);
-            __pyx_t_94 = PyTuple_New(10); if (unlikely(!__pyx_t_94)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 556; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            __Pyx_GOTREF(((PyObject *)__pyx_t_94));
-            PyTuple_SET_ITEM(__pyx_t_94, 0, __pyx_t_1);
-            __Pyx_GIVEREF(__pyx_t_1);
-            PyTuple_SET_ITEM(__pyx_t_94, 1, __pyx_t_23);
-            __Pyx_GIVEREF(__pyx_t_23);
-            PyTuple_SET_ITEM(__pyx_t_94, 2, __pyx_t_25);
-            __Pyx_GIVEREF(__pyx_t_25);
-            PyTuple_SET_ITEM(__pyx_t_94, 3, __pyx_t_7);
-            __Pyx_GIVEREF(__pyx_t_7);
-            PyTuple_SET_ITEM(__pyx_t_94, 4, __pyx_t_6);
-            __Pyx_GIVEREF(__pyx_t_6);
-            PyTuple_SET_ITEM(__pyx_t_94, 5, __pyx_t_2);
-            __Pyx_GIVEREF(__pyx_t_2);
-            PyTuple_SET_ITEM(__pyx_t_94, 6, __pyx_t_3);
-            __Pyx_GIVEREF(__pyx_t_3);
-            PyTuple_SET_ITEM(__pyx_t_94, 7, __pyx_t_87);
-            __Pyx_GIVEREF(__pyx_t_87);
-            PyTuple_SET_ITEM(__pyx_t_94, 8, __pyx_t_90);
-            __Pyx_GIVEREF(__pyx_t_90);
-            PyTuple_SET_ITEM(__pyx_t_94, 9, __pyx_t_93);
-            __Pyx_GIVEREF(__pyx_t_93);
-            __pyx_t_1 = 0;
-            __pyx_t_23 = 0;
-            __pyx_t_25 = 0;
-            __pyx_t_7 = 0;
-            __pyx_t_6 = 0;
-            __pyx_t_2 = 0;
-            __pyx_t_3 = 0;
-            __pyx_t_87 = 0;
-            __pyx_t_90 = 0;
-            __pyx_t_93 = 0;
-            __pyx_t_93 = PyObject_Call(__pyx_2, ((PyObject *)__pyx_t_94), NULL); if (unlikely(!__pyx_t_93)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 556; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            __Pyx_GOTREF(__pyx_t_93);
-            __Pyx_DECREF(__pyx_2); __pyx_2 = 0;
-            __Pyx_DECREF(((PyObject *)__pyx_t_94)); __pyx_t_94 = 0;
-            __pyx_t_94 = PyNumber_Multiply(__pyx_t_22, __pyx_t_93); if (unlikely(!__pyx_t_94)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 556; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            __Pyx_GOTREF(__pyx_t_94);
-            __Pyx_DECREF(__pyx_t_22); __pyx_t_22 = 0;
-            __Pyx_DECREF(__pyx_t_93); __pyx_t_93 = 0;
-            __Pyx_DECREF(__pyx_v_d);
-            __pyx_v_d = __pyx_t_94;
-            __pyx_t_94 = 0;
-
-            /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":561
- *                                         D[w3,w3])
- * 
- *                         l3 = l3 + m * mu3_tet(D[w0,w0], D[w0,w1], D[w0,w2],             # <<<<<<<<<<<<<<
- *                                               D[w0,w3], D[w1,w1], D[w1,w2],
- *                                               D[w1,w3], D[w2,w2], D[w2,w3],
- */
-            __pyx_t_94 = PyFloat_FromDouble(__pyx_v_l3); if (unlikely(!__pyx_t_94)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 561; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            __Pyx_GOTREF(__pyx_t_94);
-            __pyx_t_93 = PyInt_FromLong(__pyx_v_m); if (unlikely(!__pyx_t_93)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 561; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            __Pyx_GOTREF(__pyx_t_93);
-            __pyx_1 = __Pyx_GetName(__pyx_m, __pyx_kp_50); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 561; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            __Pyx_GOTREF(__pyx_1);
-            __pyx_t_95 = __pyx_v_w0;
-            __pyx_t_96 = __pyx_v_w0;
-            __pyx_t_9 = -1;
-            if (__pyx_t_95 < 0) {
-              __pyx_t_95 += __pyx_bshape_0_D;
-              if (unlikely(__pyx_t_95 < 0)) __pyx_t_9 = 0;
-            } else if (unlikely(__pyx_t_95 >= __pyx_bshape_0_D)) __pyx_t_9 = 0;
-            if (__pyx_t_96 < 0) {
-              __pyx_t_96 += __pyx_bshape_1_D;
-              if (unlikely(__pyx_t_96 < 0)) __pyx_t_9 = 1;
-            } else if (unlikely(__pyx_t_96 >= __pyx_bshape_1_D)) __pyx_t_9 = 1;
-            if (unlikely(__pyx_t_9 != -1)) {
-              __Pyx_RaiseBufferIndexError(__pyx_t_9);
-              {__pyx_filename = __pyx_f[0]; __pyx_lineno = 561; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            }
-            __pyx_t_22 = PyFloat_FromDouble((*__Pyx_BufPtrStrided2d(__pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_float_t *, __pyx_bstruct_D.buf, __pyx_t_95, __pyx_bstride_0_D, __pyx_t_96, __pyx_bstride_1_D))); if (unlikely(!__pyx_t_22)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 561; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            __Pyx_GOTREF(__pyx_t_22);
-            __pyx_t_97 = __pyx_v_w0;
-            __pyx_t_98 = __pyx_v_w1;
-            __pyx_t_9 = -1;
-            if (__pyx_t_97 < 0) {
-              __pyx_t_97 += __pyx_bshape_0_D;
-              if (unlikely(__pyx_t_97 < 0)) __pyx_t_9 = 0;
-            } else if (unlikely(__pyx_t_97 >= __pyx_bshape_0_D)) __pyx_t_9 = 0;
-            if (__pyx_t_98 < 0) {
-              __pyx_t_98 += __pyx_bshape_1_D;
-              if (unlikely(__pyx_t_98 < 0)) __pyx_t_9 = 1;
-            } else if (unlikely(__pyx_t_98 >= __pyx_bshape_1_D)) __pyx_t_9 = 1;
-            if (unlikely(__pyx_t_9 != -1)) {
-              __Pyx_RaiseBufferIndexError(__pyx_t_9);
-              {__pyx_filename = __pyx_f[0]; __pyx_lineno = 561; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            }
-            __pyx_t_90 = PyFloat_FromDouble((*__Pyx_BufPtrStrided2d(__pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_float_t *, __pyx_bstruct_D.buf, __pyx_t_97, __pyx_bstride_0_D, __pyx_t_98, __pyx_bstride_1_D))); if (unlikely(!__pyx_t_90)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 561; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            __Pyx_GOTREF(__pyx_t_90);
-            __pyx_t_99 = __pyx_v_w0;
-            __pyx_t_100 = __pyx_v_w2;
-            __pyx_t_9 = -1;
-            if (__pyx_t_99 < 0) {
-              __pyx_t_99 += __pyx_bshape_0_D;
-              if (unlikely(__pyx_t_99 < 0)) __pyx_t_9 = 0;
-            } else if (unlikely(__pyx_t_99 >= __pyx_bshape_0_D)) __pyx_t_9 = 0;
-            if (__pyx_t_100 < 0) {
-              __pyx_t_100 += __pyx_bshape_1_D;
-              if (unlikely(__pyx_t_100 < 0)) __pyx_t_9 = 1;
-            } else if (unlikely(__pyx_t_100 >= __pyx_bshape_1_D)) __pyx_t_9 = 1;
-            if (unlikely(__pyx_t_9 != -1)) {
-              __Pyx_RaiseBufferIndexError(__pyx_t_9);
-              {__pyx_filename = __pyx_f[0]; __pyx_lineno = 561; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            }
-            __pyx_t_87 = PyFloat_FromDouble((*__Pyx_BufPtrStrided2d(__pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_float_t *, __pyx_bstruct_D.buf, __pyx_t_99, __pyx_bstride_0_D, __pyx_t_100, __pyx_bstride_1_D))); if (unlikely(!__pyx_t_87)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 561; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            __Pyx_GOTREF(__pyx_t_87);
-
-            /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":562
- * 
- *                         l3 = l3 + m * mu3_tet(D[w0,w0], D[w0,w1], D[w0,w2],
- *                                               D[w0,w3], D[w1,w1], D[w1,w2],             # <<<<<<<<<<<<<<
- *                                               D[w1,w3], D[w2,w2], D[w2,w3],
- *                                               D[w3,w3])
- */
-            __pyx_t_101 = __pyx_v_w0;
-            __pyx_t_102 = __pyx_v_w3;
-            __pyx_t_9 = -1;
-            if (__pyx_t_101 < 0) {
-              __pyx_t_101 += __pyx_bshape_0_D;
-              if (unlikely(__pyx_t_101 < 0)) __pyx_t_9 = 0;
-            } else if (unlikely(__pyx_t_101 >= __pyx_bshape_0_D)) __pyx_t_9 = 0;
-            if (__pyx_t_102 < 0) {
-              __pyx_t_102 += __pyx_bshape_1_D;
-              if (unlikely(__pyx_t_102 < 0)) __pyx_t_9 = 1;
-            } else if (unlikely(__pyx_t_102 >= __pyx_bshape_1_D)) __pyx_t_9 = 1;
-            if (unlikely(__pyx_t_9 != -1)) {
-              __Pyx_RaiseBufferIndexError(__pyx_t_9);
-              {__pyx_filename = __pyx_f[0]; __pyx_lineno = 562; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            }
-            __pyx_t_3 = PyFloat_FromDouble((*__Pyx_BufPtrStrided2d(__pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_float_t *, __pyx_bstruct_D.buf, __pyx_t_101, __pyx_bstride_0_D, __pyx_t_102, __pyx_bstride_1_D))); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 562; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            __Pyx_GOTREF(__pyx_t_3);
-            __pyx_t_103 = __pyx_v_w1;
-            __pyx_t_104 = __pyx_v_w1;
-            __pyx_t_9 = -1;
-            if (__pyx_t_103 < 0) {
-              __pyx_t_103 += __pyx_bshape_0_D;
-              if (unlikely(__pyx_t_103 < 0)) __pyx_t_9 = 0;
-            } else if (unlikely(__pyx_t_103 >= __pyx_bshape_0_D)) __pyx_t_9 = 0;
-            if (__pyx_t_104 < 0) {
-              __pyx_t_104 += __pyx_bshape_1_D;
-              if (unlikely(__pyx_t_104 < 0)) __pyx_t_9 = 1;
-            } else if (unlikely(__pyx_t_104 >= __pyx_bshape_1_D)) __pyx_t_9 = 1;
-            if (unlikely(__pyx_t_9 != -1)) {
-              __Pyx_RaiseBufferIndexError(__pyx_t_9);
-              {__pyx_filename = __pyx_f[0]; __pyx_lineno = 562; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            }
-            __pyx_t_2 = PyFloat_FromDouble((*__Pyx_BufPtrStrided2d(__pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_float_t *, __pyx_bstruct_D.buf, __pyx_t_103, __pyx_bstride_0_D, __pyx_t_104, __pyx_bstride_1_D))); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 562; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            __Pyx_GOTREF(__pyx_t_2);
-            __pyx_t_105 = __pyx_v_w1;
-            __pyx_t_106 = __pyx_v_w2;
-            __pyx_t_9 = -1;
-            if (__pyx_t_105 < 0) {
-              __pyx_t_105 += __pyx_bshape_0_D;
-              if (unlikely(__pyx_t_105 < 0)) __pyx_t_9 = 0;
-            } else if (unlikely(__pyx_t_105 >= __pyx_bshape_0_D)) __pyx_t_9 = 0;
-            if (__pyx_t_106 < 0) {
-              __pyx_t_106 += __pyx_bshape_1_D;
-              if (unlikely(__pyx_t_106 < 0)) __pyx_t_9 = 1;
-            } else if (unlikely(__pyx_t_106 >= __pyx_bshape_1_D)) __pyx_t_9 = 1;
-            if (unlikely(__pyx_t_9 != -1)) {
-              __Pyx_RaiseBufferIndexError(__pyx_t_9);
-              {__pyx_filename = __pyx_f[0]; __pyx_lineno = 562; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            }
-            __pyx_t_6 = PyFloat_FromDouble((*__Pyx_BufPtrStrided2d(__pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_float_t *, __pyx_bstruct_D.buf, __pyx_t_105, __pyx_bstride_0_D, __pyx_t_106, __pyx_bstride_1_D))); if (unlikely(!__pyx_t_6)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 562; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            __Pyx_GOTREF(__pyx_t_6);
-
-            /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":563
- *                         l3 = l3 + m * mu3_tet(D[w0,w0], D[w0,w1], D[w0,w2],
- *                                               D[w0,w3], D[w1,w1], D[w1,w2],
- *                                               D[w1,w3], D[w2,w2], D[w2,w3],             # <<<<<<<<<<<<<<
- *                                               D[w3,w3])
- * 
- */
-            __pyx_t_107 = __pyx_v_w1;
-            __pyx_t_108 = __pyx_v_w3;
-            __pyx_t_9 = -1;
-            if (__pyx_t_107 < 0) {
-              __pyx_t_107 += __pyx_bshape_0_D;
-              if (unlikely(__pyx_t_107 < 0)) __pyx_t_9 = 0;
-            } else if (unlikely(__pyx_t_107 >= __pyx_bshape_0_D)) __pyx_t_9 = 0;
-            if (__pyx_t_108 < 0) {
-              __pyx_t_108 += __pyx_bshape_1_D;
-              if (unlikely(__pyx_t_108 < 0)) __pyx_t_9 = 1;
-            } else if (unlikely(__pyx_t_108 >= __pyx_bshape_1_D)) __pyx_t_9 = 1;
-            if (unlikely(__pyx_t_9 != -1)) {
-              __Pyx_RaiseBufferIndexError(__pyx_t_9);
-              {__pyx_filename = __pyx_f[0]; __pyx_lineno = 563; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            }
-            __pyx_t_7 = PyFloat_FromDouble((*__Pyx_BufPtrStrided2d(__pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_float_t *, __pyx_bstruct_D.buf, __pyx_t_107, __pyx_bstride_0_D, __pyx_t_108, __pyx_bstride_1_D))); if (unlikely(!__pyx_t_7)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 563; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            __Pyx_GOTREF(__pyx_t_7);
-            __pyx_t_109 = __pyx_v_w2;
-            __pyx_t_110 = __pyx_v_w2;
-            __pyx_t_9 = -1;
-            if (__pyx_t_109 < 0) {
-              __pyx_t_109 += __pyx_bshape_0_D;
-              if (unlikely(__pyx_t_109 < 0)) __pyx_t_9 = 0;
-            } else if (unlikely(__pyx_t_109 >= __pyx_bshape_0_D)) __pyx_t_9 = 0;
-            if (__pyx_t_110 < 0) {
-              __pyx_t_110 += __pyx_bshape_1_D;
-              if (unlikely(__pyx_t_110 < 0)) __pyx_t_9 = 1;
-            } else if (unlikely(__pyx_t_110 >= __pyx_bshape_1_D)) __pyx_t_9 = 1;
-            if (unlikely(__pyx_t_9 != -1)) {
-              __Pyx_RaiseBufferIndexError(__pyx_t_9);
-              {__pyx_filename = __pyx_f[0]; __pyx_lineno = 563; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            }
-            __pyx_t_25 = PyFloat_FromDouble((*__Pyx_BufPtrStrided2d(__pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_float_t *, __pyx_bstruct_D.buf, __pyx_t_109, __pyx_bstride_0_D, __pyx_t_110, __pyx_bstride_1_D))); if (unlikely(!__pyx_t_25)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 563; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            __Pyx_GOTREF(__pyx_t_25);
-            __pyx_t_111 = __pyx_v_w2;
-            __pyx_t_112 = __pyx_v_w3;
-            __pyx_t_9 = -1;
-            if (__pyx_t_111 < 0) {
-              __pyx_t_111 += __pyx_bshape_0_D;
-              if (unlikely(__pyx_t_111 < 0)) __pyx_t_9 = 0;
-            } else if (unlikely(__pyx_t_111 >= __pyx_bshape_0_D)) __pyx_t_9 = 0;
-            if (__pyx_t_112 < 0) {
-              __pyx_t_112 += __pyx_bshape_1_D;
-              if (unlikely(__pyx_t_112 < 0)) __pyx_t_9 = 1;
-            } else if (unlikely(__pyx_t_112 >= __pyx_bshape_1_D)) __pyx_t_9 = 1;
-            if (unlikely(__pyx_t_9 != -1)) {
-              __Pyx_RaiseBufferIndexError(__pyx_t_9);
-              {__pyx_filename = __pyx_f[0]; __pyx_lineno = 563; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            }
-            __pyx_t_23 = PyFloat_FromDouble((*__Pyx_BufPtrStrided2d(__pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_float_t *, __pyx_bstruct_D.buf, __pyx_t_111, __pyx_bstride_0_D, __pyx_t_112, __pyx_bstride_1_D))); if (unlikely(!__pyx_t_23)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 563; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            __Pyx_GOTREF(__pyx_t_23);
-
-            /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":564
- *                                               D[w0,w3], D[w1,w1], D[w1,w2],
- *                                               D[w1,w3], D[w2,w2], D[w2,w3],
- *                                               D[w3,w3])             # <<<<<<<<<<<<<<
- * 
- *                         l2 = l2 - m * mu2_tet(D[w0,w0], D[w0,w1], D[w0,w2],
- */
-            __pyx_t_113 = __pyx_v_w3;
-            __pyx_t_114 = __pyx_v_w3;
-            __pyx_t_9 = -1;
-            if (__pyx_t_113 < 0) {
-              __pyx_t_113 += __pyx_bshape_0_D;
-              if (unlikely(__pyx_t_113 < 0)) __pyx_t_9 = 0;
-            } else if (unlikely(__pyx_t_113 >= __pyx_bshape_0_D)) __pyx_t_9 = 0;
-            if (__pyx_t_114 < 0) {
-              __pyx_t_114 += __pyx_bshape_1_D;
-              if (unlikely(__pyx_t_114 < 0)) __pyx_t_9 = 1;
-            } else if (unlikely(__pyx_t_114 >= __pyx_bshape_1_D)) __pyx_t_9 = 1;
-            if (unlikely(__pyx_t_9 != -1)) {
-              __Pyx_RaiseBufferIndexError(__pyx_t_9);
-              {__pyx_filename = __pyx_f[0]; __pyx_lineno = 564; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            }
-            __pyx_t_1 = PyFloat_FromDouble((*__Pyx_BufPtrStrided2d(__pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_float_t *, __pyx_bstruct_D.buf, __pyx_t_113, __pyx_bstride_0_D, __pyx_t_114, __pyx_bstride_1_D))); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 564; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            __Pyx_GOTREF(__pyx_t_1);
-            __pyx_t_115 = PyTuple_New(10); if (unlikely(!__pyx_t_115)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 561; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            __Pyx_GOTREF(((PyObject *)__pyx_t_115));
-            PyTuple_SET_ITEM(__pyx_t_115, 0, __pyx_t_22);
-            __Pyx_GIVEREF(__pyx_t_22);
-            PyTuple_SET_ITEM(__pyx_t_115, 1, __pyx_t_90);
-            __Pyx_GIVEREF(__pyx_t_90);
-            PyTuple_SET_ITEM(__pyx_t_115, 2, __pyx_t_87);
-            __Pyx_GIVEREF(__pyx_t_87);
-            PyTuple_SET_ITEM(__pyx_t_115, 3, __pyx_t_3);
-            __Pyx_GIVEREF(__pyx_t_3);
-            PyTuple_SET_ITEM(__pyx_t_115, 4, __pyx_t_2);
-            __Pyx_GIVEREF(__pyx_t_2);
-            PyTuple_SET_ITEM(__pyx_t_115, 5, __pyx_t_6);
-            __Pyx_GIVEREF(__pyx_t_6);
-            PyTuple_SET_ITEM(__pyx_t_115, 6, __pyx_t_7);
-            __Pyx_GIVEREF(__pyx_t_7);
-            PyTuple_SET_ITEM(__pyx_t_115, 7, __pyx_t_25);
-            __Pyx_GIVEREF(__pyx_t_25);
-            PyTuple_SET_ITEM(__pyx_t_115, 8, __pyx_t_23);
-            __Pyx_GIVEREF(__pyx_t_23);
-            PyTuple_SET_ITEM(__pyx_t_115, 9, __pyx_t_1);
-            __Pyx_GIVEREF(__pyx_t_1);
-            __pyx_t_22 = 0;
-            __pyx_t_90 = 0;
-            __pyx_t_87 = 0;
-            __pyx_t_3 = 0;
-            __pyx_t_2 = 0;
-            __pyx_t_6 = 0;
-            __pyx_t_7 = 0;
-            __pyx_t_25 = 0;
-            __pyx_t_23 = 0;
-            __pyx_t_1 = 0;
-            __pyx_t_1 = PyObject_Call(__pyx_1, ((PyObject *)__pyx_t_115), NULL); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 561; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            __Pyx_GOTREF(__pyx_t_1);
-            __Pyx_DECREF(__pyx_1); __pyx_1 = 0;
-            __Pyx_DECREF(((PyObject *)__pyx_t_115)); __pyx_t_115 = 0;
-            __pyx_t_115 = PyNumber_Multiply(__pyx_t_93, __pyx_t_1); if (unlikely(!__pyx_t_115)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 561; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            __Pyx_GOTREF(__pyx_t_115);
-            __Pyx_DECREF(__pyx_t_93); __pyx_t_93 = 0;
-            __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-            __pyx_t_1 = PyNumber_Add(__pyx_t_94, __pyx_t_115); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 561; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            __Pyx_GOTREF(__pyx_t_1);
-            __Pyx_DECREF(__pyx_t_94); __pyx_t_94 = 0;
-            __Pyx_DECREF(__pyx_t_115); __pyx_t_115 = 0;
-            __pyx_t_116 = __pyx_PyFloat_AsDouble(__pyx_t_1); if (unlikely(PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 561; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-            __pyx_v_l3 = __pyx_t_116;
-
-            /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":566
- *                                               D[w3,w3])
- * 
- *                         l2 = l2 - m * mu2_tet(D[w0,w0], D[w0,w1], D[w0,w2],             # <<<<<<<<<<<<<<
- *                                               D[w0,w3], D[w1,w1], D[w1,w2],
- *                                               D[w1,w3], D[w2,w2], D[w2,w3],
- */
-            __pyx_t_1 = PyFloat_FromDouble(__pyx_v_l2); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 566; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            __Pyx_GOTREF(__pyx_t_1);
-            __pyx_t_115 = PyInt_FromLong(__pyx_v_m); if (unlikely(!__pyx_t_115)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 566; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            __Pyx_GOTREF(__pyx_t_115);
-            __pyx_3 = __Pyx_GetName(__pyx_m, __pyx_kp_51); if (unlikely(!__pyx_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 566; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            __Pyx_GOTREF(__pyx_3);
-            __pyx_t_117 = __pyx_v_w0;
-            __pyx_t_118 = __pyx_v_w0;
-            __pyx_t_9 = -1;
-            if (__pyx_t_117 < 0) {
-              __pyx_t_117 += __pyx_bshape_0_D;
-              if (unlikely(__pyx_t_117 < 0)) __pyx_t_9 = 0;
-            } else if (unlikely(__pyx_t_117 >= __pyx_bshape_0_D)) __pyx_t_9 = 0;
-            if (__pyx_t_118 < 0) {
-              __pyx_t_118 += __pyx_bshape_1_D;
-              if (unlikely(__pyx_t_118 < 0)) __pyx_t_9 = 1;
-            } else if (unlikely(__pyx_t_118 >= __pyx_bshape_1_D)) __pyx_t_9 = 1;
-            if (unlikely(__pyx_t_9 != -1)) {
-              __Pyx_RaiseBufferIndexError(__pyx_t_9);
-              {__pyx_filename = __pyx_f[0]; __pyx_lineno = 566; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            }
-            __pyx_t_94 = PyFloat_FromDouble((*__Pyx_BufPtrStrided2d(__pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_float_t *, __pyx_bstruct_D.buf, __pyx_t_117, __pyx_bstride_0_D, __pyx_t_118, __pyx_bstride_1_D))); if (unlikely(!__pyx_t_94)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 566; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            __Pyx_GOTREF(__pyx_t_94);
-            __pyx_t_119 = __pyx_v_w0;
-            __pyx_t_120 = __pyx_v_w1;
-            __pyx_t_9 = -1;
-            if (__pyx_t_119 < 0) {
-              __pyx_t_119 += __pyx_bshape_0_D;
-              if (unlikely(__pyx_t_119 < 0)) __pyx_t_9 = 0;
-            } else if (unlikely(__pyx_t_119 >= __pyx_bshape_0_D)) __pyx_t_9 = 0;
-            if (__pyx_t_120 < 0) {
-              __pyx_t_120 += __pyx_bshape_1_D;
-              if (unlikely(__pyx_t_120 < 0)) __pyx_t_9 = 1;
-            } else if (unlikely(__pyx_t_120 >= __pyx_bshape_1_D)) __pyx_t_9 = 1;
-            if (unlikely(__pyx_t_9 != -1)) {
-              __Pyx_RaiseBufferIndexError(__pyx_t_9);
-              {__pyx_filename = __pyx_f[0]; __pyx_lineno = 566; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            }
-            __pyx_t_93 = PyFloat_FromDouble((*__Pyx_BufPtrStrided2d(__pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_float_t *, __pyx_bstruct_D.buf, __pyx_t_119, __pyx_bstride_0_D, __pyx_t_120, __pyx_bstride_1_D))); if (unlikely(!__pyx_t_93)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 566; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            __Pyx_GOTREF(__pyx_t_93);
-            __pyx_t_121 = __pyx_v_w0;
-            __pyx_t_122 = __pyx_v_w2;
-            __pyx_t_9 = -1;
-            if (__pyx_t_121 < 0) {
-              __pyx_t_121 += __pyx_bshape_0_D;
-              if (unlikely(__pyx_t_121 < 0)) __pyx_t_9 = 0;
-            } else if (unlikely(__pyx_t_121 >= __pyx_bshape_0_D)) __pyx_t_9 = 0;
-            if (__pyx_t_122 < 0) {
-              __pyx_t_122 += __pyx_bshape_1_D;
-              if (unlikely(__pyx_t_122 < 0)) __pyx_t_9 = 1;
-            } else if (unlikely(__pyx_t_122 >= __pyx_bshape_1_D)) __pyx_t_9 = 1;
-            if (unlikely(__pyx_t_9 != -1)) {
-              __Pyx_RaiseBufferIndexError(__pyx_t_9);
-              {__pyx_filename = __pyx_f[0]; __pyx_lineno = 566; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            }
-            __pyx_t_23 = PyFloat_FromDouble((*__Pyx_BufPtrStrided2d(__pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_float_t *, __pyx_bstruct_D.buf, __pyx_t_121, __pyx_bstride_0_D, __pyx_t_122, __pyx_bstride_1_D))); if (unlikely(!__pyx_t_23)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 566; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            __Pyx_GOTREF(__pyx_t_23);
-
-            /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":567
- * 
- *                         l2 = l2 - m * mu2_tet(D[w0,w0], D[w0,w1], D[w0,w2],
- *                                               D[w0,w3], D[w1,w1], D[w1,w2],             # <<<<<<<<<<<<<<
- *                                               D[w1,w3], D[w2,w2], D[w2,w3],
- *                                               D[w3,w3])
- */
-            __pyx_t_123 = __pyx_v_w0;
-            __pyx_t_124 = __pyx_v_w3;
-            __pyx_t_9 = -1;
-            if (__pyx_t_123 < 0) {
-              __pyx_t_123 += __pyx_bshape_0_D;
-              if (unlikely(__pyx_t_123 < 0)) __pyx_t_9 = 0;
-            } else if (unlikely(__pyx_t_123 >= __pyx_bshape_0_D)) __pyx_t_9 = 0;
-            if (__pyx_t_124 < 0) {
-              __pyx_t_124 += __pyx_bshape_1_D;
-              if (unlikely(__pyx_t_124 < 0)) __pyx_t_9 = 1;
-            } else if (unlikely(__pyx_t_124 >= __pyx_bshape_1_D)) __pyx_t_9 = 1;
-            if (unlikely(__pyx_t_9 != -1)) {
-              __Pyx_RaiseBufferIndexError(__pyx_t_9);
-              {__pyx_filename = __pyx_f[0]; __pyx_lineno = 567; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            }
-            __pyx_t_25 = PyFloat_FromDouble((*__Pyx_BufPtrStrided2d(__pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_float_t *, __pyx_bstruct_D.buf, __pyx_t_123, __pyx_bstride_0_D, __pyx_t_124, __pyx_bstride_1_D))); if (unlikely(!__pyx_t_25)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 567; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            __Pyx_GOTREF(__pyx_t_25);
-            __pyx_t_125 = __pyx_v_w1;
-            __pyx_t_126 = __pyx_v_w1;
-            __pyx_t_9 = -1;
-            if (__pyx_t_125 < 0) {
-              __pyx_t_125 += __pyx_bshape_0_D;
-              if (unlikely(__pyx_t_125 < 0)) __pyx_t_9 = 0;
-            } else if (unlikely(__pyx_t_125 >= __pyx_bshape_0_D)) __pyx_t_9 = 0;
-            if (__pyx_t_126 < 0) {
-              __pyx_t_126 += __pyx_bshape_1_D;
-              if (unlikely(__pyx_t_126 < 0)) __pyx_t_9 = 1;
-            } else if (unlikely(__pyx_t_126 >= __pyx_bshape_1_D)) __pyx_t_9 = 1;
-            if (unlikely(__pyx_t_9 != -1)) {
-              __Pyx_RaiseBufferIndexError(__pyx_t_9);
-              {__pyx_filename = __pyx_f[0]; __pyx_lineno = 567; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            }
-            __pyx_t_7 = PyFloat_FromDouble((*__Pyx_BufPtrStrided2d(__pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_float_t *, __pyx_bstruct_D.buf, __pyx_t_125, __pyx_bstride_0_D, __pyx_t_126, __pyx_bstride_1_D))); if (unlikely(!__pyx_t_7)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 567; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            __Pyx_GOTREF(__pyx_t_7);
-            __pyx_t_127 = __pyx_v_w1;
-            __pyx_t_128 = __pyx_v_w2;
-            __pyx_t_9 = -1;
-            if (__pyx_t_127 < 0) {
-              __pyx_t_127 += __pyx_bshape_0_D;
-              if (unlikely(__pyx_t_127 < 0)) __pyx_t_9 = 0;
-            } else if (unlikely(__pyx_t_127 >= __pyx_bshape_0_D)) __pyx_t_9 = 0;
-            if (__pyx_t_128 < 0) {
-              __pyx_t_128 += __pyx_bshape_1_D;
-              if (unlikely(__pyx_t_128 < 0)) __pyx_t_9 = 1;
-            } else if (unlikely(__pyx_t_128 >= __pyx_bshape_1_D)) __pyx_t_9 = 1;
-            if (unlikely(__pyx_t_9 != -1)) {
-              __Pyx_RaiseBufferIndexError(__pyx_t_9);
-              {__pyx_filename = __pyx_f[0]; __pyx_lineno = 567; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            }
-            __pyx_t_6 = PyFloat_FromDouble((*__Pyx_BufPtrStrided2d(__pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_float_t *, __pyx_bstruct_D.buf, __pyx_t_127, __pyx_bstride_0_D, __pyx_t_128, __pyx_bstride_1_D))); if (unlikely(!__pyx_t_6)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 567; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            __Pyx_GOTREF(__pyx_t_6);
-
-            /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":568
- *                         l2 = l2 - m * mu2_tet(D[w0,w0], D[w0,w1], D[w0,w2],
- *                                               D[w0,w3], D[w1,w1], D[w1,w2],
- *                                               D[w1,w3], D[w2,w2], D[w2,w3],             # <<<<<<<<<<<<<<
- *                                               D[w3,w3])
- * 
- */
-            __pyx_t_129 = __pyx_v_w1;
-            __pyx_t_130 = __pyx_v_w3;
-            __pyx_t_9 = -1;
-            if (__pyx_t_129 < 0) {
-              __pyx_t_129 += __pyx_bshape_0_D;
-              if (unlikely(__pyx_t_129 < 0)) __pyx_t_9 = 0;
-            } else if (unlikely(__pyx_t_129 >= __pyx_bshape_0_D)) __pyx_t_9 = 0;
-            if (__pyx_t_130 < 0) {
-              __pyx_t_130 += __pyx_bshape_1_D;
-              if (unlikely(__pyx_t_130 < 0)) __pyx_t_9 = 1;
-            } else if (unlikely(__pyx_t_130 >= __pyx_bshape_1_D)) __pyx_t_9 = 1;
-            if (unlikely(__pyx_t_9 != -1)) {
-              __Pyx_RaiseBufferIndexError(__pyx_t_9);
-              {__pyx_filename = __pyx_f[0]; __pyx_lineno = 568; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            }
-            __pyx_t_2 = PyFloat_FromDouble((*__Pyx_BufPtrStrided2d(__pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_float_t *, __pyx_bstruct_D.buf, __pyx_t_129, __pyx_bstride_0_D, __pyx_t_130, __pyx_bstride_1_D))); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 568; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            __Pyx_GOTREF(__pyx_t_2);
-            __pyx_t_131 = __pyx_v_w2;
-            __pyx_t_132 = __pyx_v_w2;
-            __pyx_t_9 = -1;
-            if (__pyx_t_131 < 0) {
-              __pyx_t_131 += __pyx_bshape_0_D;
-              if (unlikely(__pyx_t_131 < 0)) __pyx_t_9 = 0;
-            } else if (unlikely(__pyx_t_131 >= __pyx_bshape_0_D)) __pyx_t_9 = 0;
-            if (__pyx_t_132 < 0) {
-              __pyx_t_132 += __pyx_bshape_1_D;
-              if (unlikely(__pyx_t_132 < 0)) __pyx_t_9 = 1;
-            } else if (unlikely(__pyx_t_132 >= __pyx_bshape_1_D)) __pyx_t_9 = 1;
-            if (unlikely(__pyx_t_9 != -1)) {
-              __Pyx_RaiseBufferIndexError(__pyx_t_9);
-              {__pyx_filename = __pyx_f[0]; __pyx_lineno = 568; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            }
-            __pyx_t_3 = PyFloat_FromDouble((*__Pyx_BufPtrStrided2d(__pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_float_t *, __pyx_bstruct_D.buf, __pyx_t_131, __pyx_bstride_0_D, __pyx_t_132, __pyx_bstride_1_D))); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 568; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            __Pyx_GOTREF(__pyx_t_3);
-            __pyx_t_133 = __pyx_v_w2;
-            __pyx_t_134 = __pyx_v_w3;
-            __pyx_t_9 = -1;
-            if (__pyx_t_133 < 0) {
-              __pyx_t_133 += __pyx_bshape_0_D;
-              if (unlikely(__pyx_t_133 < 0)) __pyx_t_9 = 0;
-            } else if (unlikely(__pyx_t_133 >= __pyx_bshape_0_D)) __pyx_t_9 = 0;
-            if (__pyx_t_134 < 0) {
-              __pyx_t_134 += __pyx_bshape_1_D;
-              if (unlikely(__pyx_t_134 < 0)) __pyx_t_9 = 1;
-            } else if (unlikely(__pyx_t_134 >= __pyx_bshape_1_D)) __pyx_t_9 = 1;
-            if (unlikely(__pyx_t_9 != -1)) {
-              __Pyx_RaiseBufferIndexError(__pyx_t_9);
-              {__pyx_filename = __pyx_f[0]; __pyx_lineno = 568; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            }
-            __pyx_t_87 = PyFloat_FromDouble((*__Pyx_BufPtrStrided2d(__pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_float_t *, __pyx_bstruct_D.buf, __pyx_t_133, __pyx_bstride_0_D, __pyx_t_134, __pyx_bstride_1_D))); if (unlikely(!__pyx_t_87)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 568; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            __Pyx_GOTREF(__pyx_t_87);
-
-            /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":569
- *                                               D[w0,w3], D[w1,w1], D[w1,w2],
- *                                               D[w1,w3], D[w2,w2], D[w2,w3],
- *                                               D[w3,w3])             # <<<<<<<<<<<<<<
- * 
- *                         l1 = l1 + m * mu1_tet(D[w0,w0], D[w0,w1], D[w0,w2],
- */
-            __pyx_t_135 = __pyx_v_w3;
-            __pyx_t_136 = __pyx_v_w3;
-            __pyx_t_9 = -1;
-            if (__pyx_t_135 < 0) {
-              __pyx_t_135 += __pyx_bshape_0_D;
-              if (unlikely(__pyx_t_135 < 0)) __pyx_t_9 = 0;
-            } else if (unlikely(__pyx_t_135 >= __pyx_bshape_0_D)) __pyx_t_9 = 0;
-            if (__pyx_t_136 < 0) {
-              __pyx_t_136 += __pyx_bshape_1_D;
-              if (unlikely(__pyx_t_136 < 0)) __pyx_t_9 = 1;
-            } else if (unlikely(__pyx_t_136 >= __pyx_bshape_1_D)) __pyx_t_9 = 1;
-            if (unlikely(__pyx_t_9 != -1)) {
-              __Pyx_RaiseBufferIndexError(__pyx_t_9);
-              {__pyx_filename = __pyx_f[0]; __pyx_lineno = 569; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            }
-            __pyx_t_90 = PyFloat_FromDouble((*__Pyx_BufPtrStrided2d(__pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_float_t *, __pyx_bstruct_D.buf, __pyx_t_135, __pyx_bstride_0_D, __pyx_t_136, __pyx_bstride_1_D))); if (unlikely(!__pyx_t_90)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 569; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            __Pyx_GOTREF(__pyx_t_90);
-            __pyx_t_22 = PyTuple_New(10); if (unlikely(!__pyx_t_22)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 566; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            __Pyx_GOTREF(((PyObject *)__pyx_t_22));
-            PyTuple_SET_ITEM(__pyx_t_22, 0, __pyx_t_94);
-            __Pyx_GIVEREF(__pyx_t_94);
-            PyTuple_SET_ITEM(__pyx_t_22, 1, __pyx_t_93);
-            __Pyx_GIVEREF(__pyx_t_93);
-            PyTuple_SET_ITEM(__pyx_t_22, 2, __pyx_t_23);
-            __Pyx_GIVEREF(__pyx_t_23);
-            PyTuple_SET_ITEM(__pyx_t_22, 3, __pyx_t_25);
-            __Pyx_GIVEREF(__pyx_t_25);
-            PyTuple_SET_ITEM(__pyx_t_22, 4, __pyx_t_7);
-            __Pyx_GIVEREF(__pyx_t_7);
-            PyTuple_SET_ITEM(__pyx_t_22, 5, __pyx_t_6);
-            __Pyx_GIVEREF(__pyx_t_6);
-            PyTuple_SET_ITEM(__pyx_t_22, 6, __pyx_t_2);
-            __Pyx_GIVEREF(__pyx_t_2);
-            PyTuple_SET_ITEM(__pyx_t_22, 7, __pyx_t_3);
-            __Pyx_GIVEREF(__pyx_t_3);
-            PyTuple_SET_ITEM(__pyx_t_22, 8, __pyx_t_87);
-            __Pyx_GIVEREF(__pyx_t_87);
-            PyTuple_SET_ITEM(__pyx_t_22, 9, __pyx_t_90);
-            __Pyx_GIVEREF(__pyx_t_90);
-            __pyx_t_94 = 0;
-            __pyx_t_93 = 0;
-            __pyx_t_23 = 0;
-            __pyx_t_25 = 0;
-            __pyx_t_7 = 0;
-            __pyx_t_6 = 0;
-            __pyx_t_2 = 0;
-            __pyx_t_3 = 0;
-            __pyx_t_87 = 0;
-            __pyx_t_90 = 0;
-            __pyx_t_90 = PyObject_Call(__pyx_3, ((PyObject *)__pyx_t_22), NULL); if (unlikely(!__pyx_t_90)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 566; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            __Pyx_GOTREF(__pyx_t_90);
-            __Pyx_DECREF(__pyx_3); __pyx_3 = 0;
-            __Pyx_DECREF(((PyObject *)__pyx_t_22)); __pyx_t_22 = 0;
-            __pyx_t_22 = PyNumber_Multiply(__pyx_t_115, __pyx_t_90); if (unlikely(!__pyx_t_22)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 566; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            __Pyx_GOTREF(__pyx_t_22);
-            __Pyx_DECREF(__pyx_t_115); __pyx_t_115 = 0;
-            __Pyx_DECREF(__pyx_t_90); __pyx_t_90 = 0;
-            __pyx_t_90 = PyNumber_Subtract(__pyx_t_1, __pyx_t_22); if (unlikely(!__pyx_t_90)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 566; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            __Pyx_GOTREF(__pyx_t_90);
-            __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-            __Pyx_DECREF(__pyx_t_22); __pyx_t_22 = 0;
-            __pyx_t_116 = __pyx_PyFloat_AsDouble(__pyx_t_90); if (unlikely(PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 566; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            __Pyx_DECREF(__pyx_t_90); __pyx_t_90 = 0;
-            __pyx_v_l2 = __pyx_t_116;
-
-            /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":571
- *                                               D[w3,w3])
- * 
- *                         l1 = l1 + m * mu1_tet(D[w0,w0], D[w0,w1], D[w0,w2],             # <<<<<<<<<<<<<<
- *                                               D[w0,w3], D[w1,w1], D[w1,w2],
- *                                               D[w1,w3], D[w2,w2], D[w2,w3],
- */
-            __pyx_t_90 = PyFloat_FromDouble(__pyx_v_l1); if (unlikely(!__pyx_t_90)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 571; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            __Pyx_GOTREF(__pyx_t_90);
-            __pyx_t_22 = PyInt_FromLong(__pyx_v_m); if (unlikely(!__pyx_t_22)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 571; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            __Pyx_GOTREF(__pyx_t_22);
-            __pyx_2 = __Pyx_GetName(__pyx_m, __pyx_kp_52); if (unlikely(!__pyx_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 571; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            __Pyx_GOTREF(__pyx_2);
-            __pyx_t_137 = __pyx_v_w0;
-            __pyx_t_138 = __pyx_v_w0;
-            __pyx_t_9 = -1;
-            if (__pyx_t_137 < 0) {
-              __pyx_t_137 += __pyx_bshape_0_D;
-              if (unlikely(__pyx_t_137 < 0)) __pyx_t_9 = 0;
-            } else if (unlikely(__pyx_t_137 >= __pyx_bshape_0_D)) __pyx_t_9 = 0;
-            if (__pyx_t_138 < 0) {
-              __pyx_t_138 += __pyx_bshape_1_D;
-              if (unlikely(__pyx_t_138 < 0)) __pyx_t_9 = 1;
-            } else if (unlikely(__pyx_t_138 >= __pyx_bshape_1_D)) __pyx_t_9 = 1;
-            if (unlikely(__pyx_t_9 != -1)) {
-              __Pyx_RaiseBufferIndexError(__pyx_t_9);
-              {__pyx_filename = __pyx_f[0]; __pyx_lineno = 571; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            }
-            __pyx_t_1 = PyFloat_FromDouble((*__Pyx_BufPtrStrided2d(__pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_float_t *, __pyx_bstruct_D.buf, __pyx_t_137, __pyx_bstride_0_D, __pyx_t_138, __pyx_bstride_1_D))); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 571; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            __Pyx_GOTREF(__pyx_t_1);
-            __pyx_t_139 = __pyx_v_w0;
-            __pyx_t_140 = __pyx_v_w1;
-            __pyx_t_9 = -1;
-            if (__pyx_t_139 < 0) {
-              __pyx_t_139 += __pyx_bshape_0_D;
-              if (unlikely(__pyx_t_139 < 0)) __pyx_t_9 = 0;
-            } else if (unlikely(__pyx_t_139 >= __pyx_bshape_0_D)) __pyx_t_9 = 0;
-            if (__pyx_t_140 < 0) {
-              __pyx_t_140 += __pyx_bshape_1_D;
-              if (unlikely(__pyx_t_140 < 0)) __pyx_t_9 = 1;
-            } else if (unlikely(__pyx_t_140 >= __pyx_bshape_1_D)) __pyx_t_9 = 1;
-            if (unlikely(__pyx_t_9 != -1)) {
-              __Pyx_RaiseBufferIndexError(__pyx_t_9);
-              {__pyx_filename = __pyx_f[0]; __pyx_lineno = 571; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            }
-            __pyx_t_115 = PyFloat_FromDouble((*__Pyx_BufPtrStrided2d(__pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_float_t *, __pyx_bstruct_D.buf, __pyx_t_139, __pyx_bstride_0_D, __pyx_t_140, __pyx_bstride_1_D))); if (unlikely(!__pyx_t_115)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 571; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            __Pyx_GOTREF(__pyx_t_115);
-            __pyx_t_141 = __pyx_v_w0;
-            __pyx_t_142 = __pyx_v_w2;
-            __pyx_t_9 = -1;
-            if (__pyx_t_141 < 0) {
-              __pyx_t_141 += __pyx_bshape_0_D;
-              if (unlikely(__pyx_t_141 < 0)) __pyx_t_9 = 0;
-            } else if (unlikely(__pyx_t_141 >= __pyx_bshape_0_D)) __pyx_t_9 = 0;
-            if (__pyx_t_142 < 0) {
-              __pyx_t_142 += __pyx_bshape_1_D;
-              if (unlikely(__pyx_t_142 < 0)) __pyx_t_9 = 1;
-            } else if (unlikely(__pyx_t_142 >= __pyx_bshape_1_D)) __pyx_t_9 = 1;
-            if (unlikely(__pyx_t_9 != -1)) {
-              __Pyx_RaiseBufferIndexError(__pyx_t_9);
-              {__pyx_filename = __pyx_f[0]; __pyx_lineno = 571; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            }
-            __pyx_t_87 = PyFloat_FromDouble((*__Pyx_BufPtrStrided2d(__pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_float_t *, __pyx_bstruct_D.buf, __pyx_t_141, __pyx_bstride_0_D, __pyx_t_142, __pyx_bstride_1_D))); if (unlikely(!__pyx_t_87)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 571; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            __Pyx_GOTREF(__pyx_t_87);
-
-            /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":572
- * 
- *                         l1 = l1 + m * mu1_tet(D[w0,w0], D[w0,w1], D[w0,w2],
- *                                               D[w0,w3], D[w1,w1], D[w1,w2],             # <<<<<<<<<<<<<<
- *                                               D[w1,w3], D[w2,w2], D[w2,w3],
- *                                               D[w3,w3])
- */
-            __pyx_t_143 = __pyx_v_w0;
-            __pyx_t_144 = __pyx_v_w3;
-            __pyx_t_9 = -1;
-            if (__pyx_t_143 < 0) {
-              __pyx_t_143 += __pyx_bshape_0_D;
-              if (unlikely(__pyx_t_143 < 0)) __pyx_t_9 = 0;
-            } else if (unlikely(__pyx_t_143 >= __pyx_bshape_0_D)) __pyx_t_9 = 0;
-            if (__pyx_t_144 < 0) {
-              __pyx_t_144 += __pyx_bshape_1_D;
-              if (unlikely(__pyx_t_144 < 0)) __pyx_t_9 = 1;
-            } else if (unlikely(__pyx_t_144 >= __pyx_bshape_1_D)) __pyx_t_9 = 1;
-            if (unlikely(__pyx_t_9 != -1)) {
-              __Pyx_RaiseBufferIndexError(__pyx_t_9);
-              {__pyx_filename = __pyx_f[0]; __pyx_lineno = 572; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            }
-            __pyx_t_3 = PyFloat_FromDouble((*__Pyx_BufPtrStrided2d(__pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_float_t *, __pyx_bstruct_D.buf, __pyx_t_143, __pyx_bstride_0_D, __pyx_t_144, __pyx_bstride_1_D))); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 572; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            __Pyx_GOTREF(__pyx_t_3);
-            __pyx_t_145 = __pyx_v_w1;
-            __pyx_t_146 = __pyx_v_w1;
-            __pyx_t_9 = -1;
-            if (__pyx_t_145 < 0) {
-              __pyx_t_145 += __pyx_bshape_0_D;
-              if (unlikely(__pyx_t_145 < 0)) __pyx_t_9 = 0;
-            } else if (unlikely(__pyx_t_145 >= __pyx_bshape_0_D)) __pyx_t_9 = 0;
-            if (__pyx_t_146 < 0) {
-              __pyx_t_146 += __pyx_bshape_1_D;
-              if (unlikely(__pyx_t_146 < 0)) __pyx_t_9 = 1;
-            } else if (unlikely(__pyx_t_146 >= __pyx_bshape_1_D)) __pyx_t_9 = 1;
-            if (unlikely(__pyx_t_9 != -1)) {
-              __Pyx_RaiseBufferIndexError(__pyx_t_9);
-              {__pyx_filename = __pyx_f[0]; __pyx_lineno = 572; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            }
-            __pyx_t_2 = PyFloat_FromDouble((*__Pyx_BufPtrStrided2d(__pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_float_t *, __pyx_bstruct_D.buf, __pyx_t_145, __pyx_bstride_0_D, __pyx_t_146, __pyx_bstride_1_D))); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 572; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            __Pyx_GOTREF(__pyx_t_2);
-            __pyx_t_147 = __pyx_v_w1;
-            __pyx_t_148 = __pyx_v_w2;
-            __pyx_t_9 = -1;
-            if (__pyx_t_147 < 0) {
-              __pyx_t_147 += __pyx_bshape_0_D;
-              if (unlikely(__pyx_t_147 < 0)) __pyx_t_9 = 0;
-            } else if (unlikely(__pyx_t_147 >= __pyx_bshape_0_D)) __pyx_t_9 = 0;
-            if (__pyx_t_148 < 0) {
-              __pyx_t_148 += __pyx_bshape_1_D;
-              if (unlikely(__pyx_t_148 < 0)) __pyx_t_9 = 1;
-            } else if (unlikely(__pyx_t_148 >= __pyx_bshape_1_D)) __pyx_t_9 = 1;
-            if (unlikely(__pyx_t_9 != -1)) {
-              __Pyx_RaiseBufferIndexError(__pyx_t_9);
-              {__pyx_filename = __pyx_f[0]; __pyx_lineno = 572; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            }
-            __pyx_t_6 = PyFloat_FromDouble((*__Pyx_BufPtrStrided2d(__pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_float_t *, __pyx_bstruct_D.buf, __pyx_t_147, __pyx_bstride_0_D, __pyx_t_148, __pyx_bstride_1_D))); if (unlikely(!__pyx_t_6)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 572; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            __Pyx_GOTREF(__pyx_t_6);
-
-            /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":573
- *                         l1 = l1 + m * mu1_tet(D[w0,w0], D[w0,w1], D[w0,w2],
- *                                               D[w0,w3], D[w1,w1], D[w1,w2],
- *                                               D[w1,w3], D[w2,w2], D[w2,w3],             # <<<<<<<<<<<<<<
- *                                               D[w3,w3])
- * 
- */
-            __pyx_t_149 = __pyx_v_w1;
-            __pyx_t_150 = __pyx_v_w3;
-            __pyx_t_9 = -1;
-            if (__pyx_t_149 < 0) {
-              __pyx_t_149 += __pyx_bshape_0_D;
-              if (unlikely(__pyx_t_149 < 0)) __pyx_t_9 = 0;
-            } else if (unlikely(__pyx_t_149 >= __pyx_bshape_0_D)) __pyx_t_9 = 0;
-            if (__pyx_t_150 < 0) {
-              __pyx_t_150 += __pyx_bshape_1_D;
-              if (unlikely(__pyx_t_150 < 0)) __pyx_t_9 = 1;
-            } else if (unlikely(__pyx_t_150 >= __pyx_bshape_1_D)) __pyx_t_9 = 1;
-            if (unlikely(__pyx_t_9 != -1)) {
-              __Pyx_RaiseBufferIndexError(__pyx_t_9);
-              {__pyx_filename = __pyx_f[0]; __pyx_lineno = 573; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            }
-            __pyx_t_7 = PyFloat_FromDouble((*__Pyx_BufPtrStrided2d(__pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_float_t *, __pyx_bstruct_D.buf, __pyx_t_149, __pyx_bstride_0_D, __pyx_t_150, __pyx_bstride_1_D))); if (unlikely(!__pyx_t_7)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 573; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            __Pyx_GOTREF(__pyx_t_7);
-            __pyx_t_151 = __pyx_v_w2;
-            __pyx_t_152 = __pyx_v_w2;
-            __pyx_t_9 = -1;
-            if (__pyx_t_151 < 0) {
-              __pyx_t_151 += __pyx_bshape_0_D;
-              if (unlikely(__pyx_t_151 < 0)) __pyx_t_9 = 0;
-            } else if (unlikely(__pyx_t_151 >= __pyx_bshape_0_D)) __pyx_t_9 = 0;
-            if (__pyx_t_152 < 0) {
-              __pyx_t_152 += __pyx_bshape_1_D;
-              if (unlikely(__pyx_t_152 < 0)) __pyx_t_9 = 1;
-            } else if (unlikely(__pyx_t_152 >= __pyx_bshape_1_D)) __pyx_t_9 = 1;
-            if (unlikely(__pyx_t_9 != -1)) {
-              __Pyx_RaiseBufferIndexError(__pyx_t_9);
-              {__pyx_filename = __pyx_f[0]; __pyx_lineno = 573; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            }
-            __pyx_t_25 = PyFloat_FromDouble((*__Pyx_BufPtrStrided2d(__pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_float_t *, __pyx_bstruct_D.buf, __pyx_t_151, __pyx_bstride_0_D, __pyx_t_152, __pyx_bstride_1_D))); if (unlikely(!__pyx_t_25)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 573; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            __Pyx_GOTREF(__pyx_t_25);
-            __pyx_t_153 = __pyx_v_w2;
-            __pyx_t_154 = __pyx_v_w3;
-            __pyx_t_9 = -1;
-            if (__pyx_t_153 < 0) {
-              __pyx_t_153 += __pyx_bshape_0_D;
-              if (unlikely(__pyx_t_153 < 0)) __pyx_t_9 = 0;
-            } else if (unlikely(__pyx_t_153 >= __pyx_bshape_0_D)) __pyx_t_9 = 0;
-            if (__pyx_t_154 < 0) {
-              __pyx_t_154 += __pyx_bshape_1_D;
-              if (unlikely(__pyx_t_154 < 0)) __pyx_t_9 = 1;
-            } else if (unlikely(__pyx_t_154 >= __pyx_bshape_1_D)) __pyx_t_9 = 1;
-            if (unlikely(__pyx_t_9 != -1)) {
-              __Pyx_RaiseBufferIndexError(__pyx_t_9);
-              {__pyx_filename = __pyx_f[0]; __pyx_lineno = 573; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            }
-            __pyx_t_23 = PyFloat_FromDouble((*__Pyx_BufPtrStrided2d(__pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_float_t *, __pyx_bstruct_D.buf, __pyx_t_153, __pyx_bstride_0_D, __pyx_t_154, __pyx_bstride_1_D))); if (unlikely(!__pyx_t_23)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 573; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            __Pyx_GOTREF(__pyx_t_23);
-
-            /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":574
- *                                               D[w0,w3], D[w1,w1], D[w1,w2],
- *                                               D[w1,w3], D[w2,w2], D[w2,w3],
- *                                               D[w3,w3])             # <<<<<<<<<<<<<<
- * 
- *                         l0 = l0 - m
- */
-            __pyx_t_155 = __pyx_v_w3;
-            __pyx_t_156 = __pyx_v_w3;
-            __pyx_t_9 = -1;
-            if (__pyx_t_155 < 0) {
-              __pyx_t_155 += __pyx_bshape_0_D;
-              if (unlikely(__pyx_t_155 < 0)) __pyx_t_9 = 0;
-            } else if (unlikely(__pyx_t_155 >= __pyx_bshape_0_D)) __pyx_t_9 = 0;
-            if (__pyx_t_156 < 0) {
-              __pyx_t_156 += __pyx_bshape_1_D;
-              if (unlikely(__pyx_t_156 < 0)) __pyx_t_9 = 1;
-            } else if (unlikely(__pyx_t_156 >= __pyx_bshape_1_D)) __pyx_t_9 = 1;
-            if (unlikely(__pyx_t_9 != -1)) {
-              __Pyx_RaiseBufferIndexError(__pyx_t_9);
-              {__pyx_filename = __pyx_f[0]; __pyx_lineno = 574; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            }
-            __pyx_t_93 = PyFloat_FromDouble((*__Pyx_BufPtrStrided2d(__pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_float_t *, __pyx_bstruct_D.buf, __pyx_t_155, __pyx_bstride_0_D, __pyx_t_156, __pyx_bstride_1_D))); if (unlikely(!__pyx_t_93)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 574; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            __Pyx_GOTREF(__pyx_t_93);
-            __pyx_t_94 = PyTuple_New(10); if (unlikely(!__pyx_t_94)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 571; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            __Pyx_GOTREF(((PyObject *)__pyx_t_94));
-            PyTuple_SET_ITEM(__pyx_t_94, 0, __pyx_t_1);
-            __Pyx_GIVEREF(__pyx_t_1);
-            PyTuple_SET_ITEM(__pyx_t_94, 1, __pyx_t_115);
-            __Pyx_GIVEREF(__pyx_t_115);
-            PyTuple_SET_ITEM(__pyx_t_94, 2, __pyx_t_87);
-            __Pyx_GIVEREF(__pyx_t_87);
-            PyTuple_SET_ITEM(__pyx_t_94, 3, __pyx_t_3);
-            __Pyx_GIVEREF(__pyx_t_3);
-            PyTuple_SET_ITEM(__pyx_t_94, 4, __pyx_t_2);
-            __Pyx_GIVEREF(__pyx_t_2);
-            PyTuple_SET_ITEM(__pyx_t_94, 5, __pyx_t_6);
-            __Pyx_GIVEREF(__pyx_t_6);
-            PyTuple_SET_ITEM(__pyx_t_94, 6, __pyx_t_7);
-            __Pyx_GIVEREF(__pyx_t_7);
-            PyTuple_SET_ITEM(__pyx_t_94, 7, __pyx_t_25);
-            __Pyx_GIVEREF(__pyx_t_25);
-            PyTuple_SET_ITEM(__pyx_t_94, 8, __pyx_t_23);
-            __Pyx_GIVEREF(__pyx_t_23);
-            PyTuple_SET_ITEM(__pyx_t_94, 9, __pyx_t_93);
-            __Pyx_GIVEREF(__pyx_t_93);
-            __pyx_t_1 = 0;
-            __pyx_t_115 = 0;
-            __pyx_t_87 = 0;
-            __pyx_t_3 = 0;
-            __pyx_t_2 = 0;
-            __pyx_t_6 = 0;
-            __pyx_t_7 = 0;
-            __pyx_t_25 = 0;
-            __pyx_t_23 = 0;
-            __pyx_t_93 = 0;
-            __pyx_t_93 = PyObject_Call(__pyx_2, ((PyObject *)__pyx_t_94), NULL); if (unlikely(!__pyx_t_93)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 571; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            __Pyx_GOTREF(__pyx_t_93);
-            __Pyx_DECREF(__pyx_2); __pyx_2 = 0;
-            __Pyx_DECREF(((PyObject *)__pyx_t_94)); __pyx_t_94 = 0;
-            __pyx_t_94 = PyNumber_Multiply(__pyx_t_22, __pyx_t_93); if (unlikely(!__pyx_t_94)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 571; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            __Pyx_GOTREF(__pyx_t_94);
-            __Pyx_DECREF(__pyx_t_22); __pyx_t_22 = 0;
-            __Pyx_DECREF(__pyx_t_93); __pyx_t_93 = 0;
-            __pyx_t_93 = PyNumber_Add(__pyx_t_90, __pyx_t_94); if (unlikely(!__pyx_t_93)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 571; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            __Pyx_GOTREF(__pyx_t_93);
-            __Pyx_DECREF(__pyx_t_90); __pyx_t_90 = 0;
-            __Pyx_DECREF(__pyx_t_94); __pyx_t_94 = 0;
-            __pyx_t_116 = __pyx_PyFloat_AsDouble(__pyx_t_93); if (unlikely(PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 571; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            __Pyx_DECREF(__pyx_t_93); __pyx_t_93 = 0;
-            __pyx_v_l1 = __pyx_t_116;
-
-            /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":576
- *                                               D[w3,w3])
- * 
- *                         l0 = l0 - m             # <<<<<<<<<<<<<<
- * 
- *                 for l in range(ds3):
- */
-            __pyx_v_l0 = (__pyx_v_l0 - __pyx_v_m);
-            goto __pyx_L41;
-          }
-          __pyx_L41:;
-        }
-
-        /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":578
- *                         l0 = l0 - m
- * 
- *                 for l in range(ds3):             # <<<<<<<<<<<<<<
- *                     v0 = pindex + d3[l,0]
- *                     w0 = d3[l,3]
- */
-        for (__pyx_t_34 = 0; __pyx_t_34 < __pyx_v_ds3; __pyx_t_34+=1) {
-          __pyx_v_l = __pyx_t_34;
-
-          /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":579
- * 
- *                 for l in range(ds3):
- *                     v0 = pindex + d3[l,0]             # <<<<<<<<<<<<<<
- *                     w0 = d3[l,3]
- *                     m = fpmask[v0]
- */
-          __pyx_t_157 = __pyx_v_l;
-          __pyx_t_158 = 0;
-          __pyx_t_9 = -1;
-          if (__pyx_t_157 < 0) {
-            __pyx_t_157 += __pyx_bshape_0_d3;
-            if (unlikely(__pyx_t_157 < 0)) __pyx_t_9 = 0;
-          } else if (unlikely(__pyx_t_157 >= __pyx_bshape_0_d3)) __pyx_t_9 = 0;
-          if (__pyx_t_158 < 0) {
-            __pyx_t_158 += __pyx_bshape_1_d3;
-            if (unlikely(__pyx_t_158 < 0)) __pyx_t_9 = 1;
-          } else if (unlikely(__pyx_t_158 >= __pyx_bshape_1_d3)) __pyx_t_9 = 1;
-          if (unlikely(__pyx_t_9 != -1)) {
-            __Pyx_RaiseBufferIndexError(__pyx_t_9);
-            {__pyx_filename = __pyx_f[0]; __pyx_lineno = 579; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-          }
-          __pyx_v_v0 = (__pyx_v_pindex + (*__Pyx_BufPtrStrided2d(__pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_int_t *, __pyx_bstruct_d3.buf, __pyx_t_157, __pyx_bstride_0_d3, __pyx_t_158, __pyx_bstride_1_d3)));
-
-          /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":580
- *                 for l in range(ds3):
- *                     v0 = pindex + d3[l,0]
- *                     w0 = d3[l,3]             # <<<<<<<<<<<<<<
- *                     m = fpmask[v0]
- *                     if m:
- */
-          __pyx_t_159 = __pyx_v_l;
-          __pyx_t_160 = 3;
-          __pyx_t_9 = -1;
-          if (__pyx_t_159 < 0) {
-            __pyx_t_159 += __pyx_bshape_0_d3;
-            if (unlikely(__pyx_t_159 < 0)) __pyx_t_9 = 0;
-          } else if (unlikely(__pyx_t_159 >= __pyx_bshape_0_d3)) __pyx_t_9 = 0;
-          if (__pyx_t_160 < 0) {
-            __pyx_t_160 += __pyx_bshape_1_d3;
-            if (unlikely(__pyx_t_160 < 0)) __pyx_t_9 = 1;
-          } else if (unlikely(__pyx_t_160 >= __pyx_bshape_1_d3)) __pyx_t_9 = 1;
-          if (unlikely(__pyx_t_9 != -1)) {
-            __Pyx_RaiseBufferIndexError(__pyx_t_9);
-            {__pyx_filename = __pyx_f[0]; __pyx_lineno = 580; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-          }
-          __pyx_v_w0 = (*__Pyx_BufPtrStrided2d(__pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_int_t *, __pyx_bstruct_d3.buf, __pyx_t_159, __pyx_bstride_0_d3, __pyx_t_160, __pyx_bstride_1_d3));
-
-          /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":581
- *                     v0 = pindex + d3[l,0]
- *                     w0 = d3[l,3]
- *                     m = fpmask[v0]             # <<<<<<<<<<<<<<
- *                     if m:
- *                         v1 = pindex + d3[l,1]
- */
-          __pyx_t_161 = __pyx_v_v0;
-          __pyx_t_9 = -1;
-          if (__pyx_t_161 < 0) {
-            __pyx_t_161 += __pyx_bshape_0_fpmask;
-            if (unlikely(__pyx_t_161 < 0)) __pyx_t_9 = 0;
-          } else if (unlikely(__pyx_t_161 >= __pyx_bshape_0_fpmask)) __pyx_t_9 = 0;
-          if (unlikely(__pyx_t_9 != -1)) {
-            __Pyx_RaiseBufferIndexError(__pyx_t_9);
-            {__pyx_filename = __pyx_f[0]; __pyx_lineno = 581; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-          }
-          __pyx_v_m = (*__Pyx_BufPtrStrided1d(__pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_int_t *, __pyx_bstruct_fpmask.buf, __pyx_t_161, __pyx_bstride_0_fpmask));
-
-          /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":582
- *                     w0 = d3[l,3]
- *                     m = fpmask[v0]
- *                     if m:             # <<<<<<<<<<<<<<
- *                         v1 = pindex + d3[l,1]
- *                         v2 = pindex + d3[l,2]
- */
-          __pyx_t_162 = __pyx_v_m;
-          if (__pyx_t_162) {
-
-            /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":583
- *                     m = fpmask[v0]
- *                     if m:
- *                         v1 = pindex + d3[l,1]             # <<<<<<<<<<<<<<
- *                         v2 = pindex + d3[l,2]
- *                         w1 = d3[l,4]
- */
-            __pyx_t_162 = __pyx_v_l;
-            __pyx_t_163 = 1;
-            __pyx_t_9 = -1;
-            if (__pyx_t_162 < 0) {
-              __pyx_t_162 += __pyx_bshape_0_d3;
-              if (unlikely(__pyx_t_162 < 0)) __pyx_t_9 = 0;
-            } else if (unlikely(__pyx_t_162 >= __pyx_bshape_0_d3)) __pyx_t_9 = 0;
-            if (__pyx_t_163 < 0) {
-              __pyx_t_163 += __pyx_bshape_1_d3;
-              if (unlikely(__pyx_t_163 < 0)) __pyx_t_9 = 1;
-            } else if (unlikely(__pyx_t_163 >= __pyx_bshape_1_d3)) __pyx_t_9 = 1;
-            if (unlikely(__pyx_t_9 != -1)) {
-              __Pyx_RaiseBufferIndexError(__pyx_t_9);
-              {__pyx_filename = __pyx_f[0]; __pyx_lineno = 583; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            }
-            __pyx_v_v1 = (__pyx_v_pindex + (*__Pyx_BufPtrStrided2d(__pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_int_t *, __pyx_bstruct_d3.buf, __pyx_t_162, __pyx_bstride_0_d3, __pyx_t_163, __pyx_bstride_1_d3)));
-
-            /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":584
- *                     if m:
- *                         v1 = pindex + d3[l,1]
- *                         v2 = pindex + d3[l,2]             # <<<<<<<<<<<<<<
- *                         w1 = d3[l,4]
- *                         w2 = d3[l,5]
- */
-            __pyx_t_164 = __pyx_v_l;
-            __pyx_t_165 = 2;
-            __pyx_t_9 = -1;
-            if (__pyx_t_164 < 0) {
-              __pyx_t_164 += __pyx_bshape_0_d3;
-              if (unlikely(__pyx_t_164 < 0)) __pyx_t_9 = 0;
-            } else if (unlikely(__pyx_t_164 >= __pyx_bshape_0_d3)) __pyx_t_9 = 0;
-            if (__pyx_t_165 < 0) {
-              __pyx_t_165 += __pyx_bshape_1_d3;
-              if (unlikely(__pyx_t_165 < 0)) __pyx_t_9 = 1;
-            } else if (unlikely(__pyx_t_165 >= __pyx_bshape_1_d3)) __pyx_t_9 = 1;
-            if (unlikely(__pyx_t_9 != -1)) {
-              __Pyx_RaiseBufferIndexError(__pyx_t_9);
-              {__pyx_filename = __pyx_f[0]; __pyx_lineno = 584; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            }
-            __pyx_v_v2 = (__pyx_v_pindex + (*__Pyx_BufPtrStrided2d(__pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_int_t *, __pyx_bstruct_d3.buf, __pyx_t_164, __pyx_bstride_0_d3, __pyx_t_165, __pyx_bstride_1_d3)));
-
-            /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":585
- *                         v1 = pindex + d3[l,1]
- *                         v2 = pindex + d3[l,2]
- *                         w1 = d3[l,4]             # <<<<<<<<<<<<<<
- *                         w2 = d3[l,5]
- * 
- */
-            __pyx_t_166 = __pyx_v_l;
-            __pyx_t_167 = 4;
-            __pyx_t_9 = -1;
-            if (__pyx_t_166 < 0) {
-              __pyx_t_166 += __pyx_bshape_0_d3;
-              if (unlikely(__pyx_t_166 < 0)) __pyx_t_9 = 0;
-            } else if (unlikely(__pyx_t_166 >= __pyx_bshape_0_d3)) __pyx_t_9 = 0;
-            if (__pyx_t_167 < 0) {
-              __pyx_t_167 += __pyx_bshape_1_d3;
-              if (unlikely(__pyx_t_167 < 0)) __pyx_t_9 = 1;
-            } else if (unlikely(__pyx_t_167 >= __pyx_bshape_1_d3)) __pyx_t_9 = 1;
-            if (unlikely(__pyx_t_9 != -1)) {
-              __Pyx_RaiseBufferIndexError(__pyx_t_9);
-              {__pyx_filename = __pyx_f[0]; __pyx_lineno = 585; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            }
-            __pyx_v_w1 = (*__Pyx_BufPtrStrided2d(__pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_int_t *, __pyx_bstruct_d3.buf, __pyx_t_166, __pyx_bstride_0_d3, __pyx_t_167, __pyx_bstride_1_d3));
-
-            /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":586
- *                         v2 = pindex + d3[l,2]
- *                         w1 = d3[l,4]
- *                         w2 = d3[l,5]             # <<<<<<<<<<<<<<
- * 
- *                         m = m * fpmask[v1] * fpmask[v2]
- */
-            __pyx_t_168 = __pyx_v_l;
-            __pyx_t_169 = 5;
-            __pyx_t_9 = -1;
-            if (__pyx_t_168 < 0) {
-              __pyx_t_168 += __pyx_bshape_0_d3;
-              if (unlikely(__pyx_t_168 < 0)) __pyx_t_9 = 0;
-            } else if (unlikely(__pyx_t_168 >= __pyx_bshape_0_d3)) __pyx_t_9 = 0;
-            if (__pyx_t_169 < 0) {
-              __pyx_t_169 += __pyx_bshape_1_d3;
-              if (unlikely(__pyx_t_169 < 0)) __pyx_t_9 = 1;
-            } else if (unlikely(__pyx_t_169 >= __pyx_bshape_1_d3)) __pyx_t_9 = 1;
-            if (unlikely(__pyx_t_9 != -1)) {
-              __Pyx_RaiseBufferIndexError(__pyx_t_9);
-              {__pyx_filename = __pyx_f[0]; __pyx_lineno = 586; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            }
-            __pyx_v_w2 = (*__Pyx_BufPtrStrided2d(__pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_int_t *, __pyx_bstruct_d3.buf, __pyx_t_168, __pyx_bstride_0_d3, __pyx_t_169, __pyx_bstride_1_d3));
-
-            /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":588
- *                         w2 = d3[l,5]
- * 
- *                         m = m * fpmask[v1] * fpmask[v2]             # <<<<<<<<<<<<<<
- *                         l2 = l2 + m * mu2_tri(D[w0,w0], D[w0,w1], D[w0,w2],
- *                                               D[w1,w1], D[w1,w2], D[w2,w2])
- */
-            __pyx_t_170 = __pyx_v_v1;
-            __pyx_t_9 = -1;
-            if (__pyx_t_170 < 0) {
-              __pyx_t_170 += __pyx_bshape_0_fpmask;
-              if (unlikely(__pyx_t_170 < 0)) __pyx_t_9 = 0;
-            } else if (unlikely(__pyx_t_170 >= __pyx_bshape_0_fpmask)) __pyx_t_9 = 0;
-            if (unlikely(__pyx_t_9 != -1)) {
-              __Pyx_RaiseBufferIndexError(__pyx_t_9);
-              {__pyx_filename = __pyx_f[0]; __pyx_lineno = 588; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            }
-            __pyx_t_171 = __pyx_v_v2;
-            __pyx_t_9 = -1;
-            if (__pyx_t_171 < 0) {
-              __pyx_t_171 += __pyx_bshape_0_fpmask;
-              if (unlikely(__pyx_t_171 < 0)) __pyx_t_9 = 0;
-            } else if (unlikely(__pyx_t_171 >= __pyx_bshape_0_fpmask)) __pyx_t_9 = 0;
-            if (unlikely(__pyx_t_9 != -1)) {
-              __Pyx_RaiseBufferIndexError(__pyx_t_9);
-              {__pyx_filename = __pyx_f[0]; __pyx_lineno = 588; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            }
-            __pyx_v_m = ((__pyx_v_m * (*__Pyx_BufPtrStrided1d(__pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_int_t *, __pyx_bstruct_fpmask.buf, __pyx_t_170, __pyx_bstride_0_fpmask))) * (*__Pyx_BufPtrStrided1d(__pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_int_t *, __pyx_bstruct_fpmask.buf, __pyx_t_171, __pyx_bstride_0_fpmask)));
-
-            /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":589
- * 
- *                         m = m * fpmask[v1] * fpmask[v2]
- *                         l2 = l2 + m * mu2_tri(D[w0,w0], D[w0,w1], D[w0,w2],             # <<<<<<<<<<<<<<
- *                                               D[w1,w1], D[w1,w2], D[w2,w2])
- * 
- */
-            __pyx_t_93 = PyFloat_FromDouble(__pyx_v_l2); if (unlikely(!__pyx_t_93)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 589; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            __Pyx_GOTREF(__pyx_t_93);
-            __pyx_t_94 = PyInt_FromLong(__pyx_v_m); if (unlikely(!__pyx_t_94)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 589; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            __Pyx_GOTREF(__pyx_t_94);
-            __pyx_1 = __Pyx_GetName(__pyx_m, __pyx_kp_44); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 589; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            __Pyx_GOTREF(__pyx_1);
-            __pyx_t_172 = __pyx_v_w0;
-            __pyx_t_173 = __pyx_v_w0;
-            __pyx_t_9 = -1;
-            if (__pyx_t_172 < 0) {
-              __pyx_t_172 += __pyx_bshape_0_D;
-              if (unlikely(__pyx_t_172 < 0)) __pyx_t_9 = 0;
-            } else if (unlikely(__pyx_t_172 >= __pyx_bshape_0_D)) __pyx_t_9 = 0;
-            if (__pyx_t_173 < 0) {
-              __pyx_t_173 += __pyx_bshape_1_D;
-              if (unlikely(__pyx_t_173 < 0)) __pyx_t_9 = 1;
-            } else if (unlikely(__pyx_t_173 >= __pyx_bshape_1_D)) __pyx_t_9 = 1;
-            if (unlikely(__pyx_t_9 != -1)) {
-              __Pyx_RaiseBufferIndexError(__pyx_t_9);
-              {__pyx_filename = __pyx_f[0]; __pyx_lineno = 589; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            }
-            __pyx_t_90 = PyFloat_FromDouble((*__Pyx_BufPtrStrided2d(__pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_float_t *, __pyx_bstruct_D.buf, __pyx_t_172, __pyx_bstride_0_D, __pyx_t_173, __pyx_bstride_1_D))); if (unlikely(!__pyx_t_90)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 589; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            __Pyx_GOTREF(__pyx_t_90);
-            __pyx_t_174 = __pyx_v_w0;
-            __pyx_t_175 = __pyx_v_w1;
-            __pyx_t_9 = -1;
-            if (__pyx_t_174 < 0) {
-              __pyx_t_174 += __pyx_bshape_0_D;
-              if (unlikely(__pyx_t_174 < 0)) __pyx_t_9 = 0;
-            } else if (unlikely(__pyx_t_174 >= __pyx_bshape_0_D)) __pyx_t_9 = 0;
-            if (__pyx_t_175 < 0) {
-              __pyx_t_175 += __pyx_bshape_1_D;
-              if (unlikely(__pyx_t_175 < 0)) __pyx_t_9 = 1;
-            } else if (unlikely(__pyx_t_175 >= __pyx_bshape_1_D)) __pyx_t_9 = 1;
-            if (unlikely(__pyx_t_9 != -1)) {
-              __Pyx_RaiseBufferIndexError(__pyx_t_9);
-              {__pyx_filename = __pyx_f[0]; __pyx_lineno = 589; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            }
-            __pyx_t_22 = PyFloat_FromDouble((*__Pyx_BufPtrStrided2d(__pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_float_t *, __pyx_bstruct_D.buf, __pyx_t_174, __pyx_bstride_0_D, __pyx_t_175, __pyx_bstride_1_D))); if (unlikely(!__pyx_t_22)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 589; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            __Pyx_GOTREF(__pyx_t_22);
-            __pyx_t_176 = __pyx_v_w0;
-            __pyx_t_177 = __pyx_v_w2;
-            __pyx_t_9 = -1;
-            if (__pyx_t_176 < 0) {
-              __pyx_t_176 += __pyx_bshape_0_D;
-              if (unlikely(__pyx_t_176 < 0)) __pyx_t_9 = 0;
-            } else if (unlikely(__pyx_t_176 >= __pyx_bshape_0_D)) __pyx_t_9 = 0;
-            if (__pyx_t_177 < 0) {
-              __pyx_t_177 += __pyx_bshape_1_D;
-              if (unlikely(__pyx_t_177 < 0)) __pyx_t_9 = 1;
-            } else if (unlikely(__pyx_t_177 >= __pyx_bshape_1_D)) __pyx_t_9 = 1;
-            if (unlikely(__pyx_t_9 != -1)) {
-              __Pyx_RaiseBufferIndexError(__pyx_t_9);
-              {__pyx_filename = __pyx_f[0]; __pyx_lineno = 589; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            }
-            __pyx_t_23 = PyFloat_FromDouble((*__Pyx_BufPtrStrided2d(__pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_float_t *, __pyx_bstruct_D.buf, __pyx_t_176, __pyx_bstride_0_D, __pyx_t_177, __pyx_bstride_1_D))); if (unlikely(!__pyx_t_23)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 589; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            __Pyx_GOTREF(__pyx_t_23);
-
-            /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":590
- *                         m = m * fpmask[v1] * fpmask[v2]
- *                         l2 = l2 + m * mu2_tri(D[w0,w0], D[w0,w1], D[w0,w2],
- *                                               D[w1,w1], D[w1,w2], D[w2,w2])             # <<<<<<<<<<<<<<
- * 
- *                         l1 = l1 - m * mu1_tri(D[w0,w0], D[w0,w1], D[w0,w2],
- */
-            __pyx_t_178 = __pyx_v_w1;
-            __pyx_t_179 = __pyx_v_w1;
-            __pyx_t_9 = -1;
-            if (__pyx_t_178 < 0) {
-              __pyx_t_178 += __pyx_bshape_0_D;
-              if (unlikely(__pyx_t_178 < 0)) __pyx_t_9 = 0;
-            } else if (unlikely(__pyx_t_178 >= __pyx_bshape_0_D)) __pyx_t_9 = 0;
-            if (__pyx_t_179 < 0) {
-              __pyx_t_179 += __pyx_bshape_1_D;
-              if (unlikely(__pyx_t_179 < 0)) __pyx_t_9 = 1;
-            } else if (unlikely(__pyx_t_179 >= __pyx_bshape_1_D)) __pyx_t_9 = 1;
-            if (unlikely(__pyx_t_9 != -1)) {
-              __Pyx_RaiseBufferIndexError(__pyx_t_9);
-              {__pyx_filename = __pyx_f[0]; __pyx_lineno = 590; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            }
-            __pyx_t_25 = PyFloat_FromDouble((*__Pyx_BufPtrStrided2d(__pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_float_t *, __pyx_bstruct_D.buf, __pyx_t_178, __pyx_bstride_0_D, __pyx_t_179, __pyx_bstride_1_D))); if (unlikely(!__pyx_t_25)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 590; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            __Pyx_GOTREF(__pyx_t_25);
-            __pyx_t_180 = __pyx_v_w1;
-            __pyx_t_181 = __pyx_v_w2;
-            __pyx_t_9 = -1;
-            if (__pyx_t_180 < 0) {
-              __pyx_t_180 += __pyx_bshape_0_D;
-              if (unlikely(__pyx_t_180 < 0)) __pyx_t_9 = 0;
-            } else if (unlikely(__pyx_t_180 >= __pyx_bshape_0_D)) __pyx_t_9 = 0;
-            if (__pyx_t_181 < 0) {
-              __pyx_t_181 += __pyx_bshape_1_D;
-              if (unlikely(__pyx_t_181 < 0)) __pyx_t_9 = 1;
-            } else if (unlikely(__pyx_t_181 >= __pyx_bshape_1_D)) __pyx_t_9 = 1;
-            if (unlikely(__pyx_t_9 != -1)) {
-              __Pyx_RaiseBufferIndexError(__pyx_t_9);
-              {__pyx_filename = __pyx_f[0]; __pyx_lineno = 590; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            }
-            __pyx_t_7 = PyFloat_FromDouble((*__Pyx_BufPtrStrided2d(__pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_float_t *, __pyx_bstruct_D.buf, __pyx_t_180, __pyx_bstride_0_D, __pyx_t_181, __pyx_bstride_1_D))); if (unlikely(!__pyx_t_7)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 590; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            __Pyx_GOTREF(__pyx_t_7);
-            __pyx_t_182 = __pyx_v_w2;
-            __pyx_t_183 = __pyx_v_w2;
-            __pyx_t_9 = -1;
-            if (__pyx_t_182 < 0) {
-              __pyx_t_182 += __pyx_bshape_0_D;
-              if (unlikely(__pyx_t_182 < 0)) __pyx_t_9 = 0;
-            } else if (unlikely(__pyx_t_182 >= __pyx_bshape_0_D)) __pyx_t_9 = 0;
-            if (__pyx_t_183 < 0) {
-              __pyx_t_183 += __pyx_bshape_1_D;
-              if (unlikely(__pyx_t_183 < 0)) __pyx_t_9 = 1;
-            } else if (unlikely(__pyx_t_183 >= __pyx_bshape_1_D)) __pyx_t_9 = 1;
-            if (unlikely(__pyx_t_9 != -1)) {
-              __Pyx_RaiseBufferIndexError(__pyx_t_9);
-              {__pyx_filename = __pyx_f[0]; __pyx_lineno = 590; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            }
-            __pyx_t_6 = PyFloat_FromDouble((*__Pyx_BufPtrStrided2d(__pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_float_t *, __pyx_bstruct_D.buf, __pyx_t_182, __pyx_bstride_0_D, __pyx_t_183, __pyx_bstride_1_D))); if (unlikely(!__pyx_t_6)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 590; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            __Pyx_GOTREF(__pyx_t_6);
-            __pyx_t_2 = PyTuple_New(6); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 589; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            __Pyx_GOTREF(((PyObject *)__pyx_t_2));
-            PyTuple_SET_ITEM(__pyx_t_2, 0, __pyx_t_90);
-            __Pyx_GIVEREF(__pyx_t_90);
-            PyTuple_SET_ITEM(__pyx_t_2, 1, __pyx_t_22);
-            __Pyx_GIVEREF(__pyx_t_22);
-            PyTuple_SET_ITEM(__pyx_t_2, 2, __pyx_t_23);
-            __Pyx_GIVEREF(__pyx_t_23);
-            PyTuple_SET_ITEM(__pyx_t_2, 3, __pyx_t_25);
-            __Pyx_GIVEREF(__pyx_t_25);
-            PyTuple_SET_ITEM(__pyx_t_2, 4, __pyx_t_7);
-            __Pyx_GIVEREF(__pyx_t_7);
-            PyTuple_SET_ITEM(__pyx_t_2, 5, __pyx_t_6);
-            __Pyx_GIVEREF(__pyx_t_6);
-            __pyx_t_90 = 0;
-            __pyx_t_22 = 0;
-            __pyx_t_23 = 0;
-            __pyx_t_25 = 0;
-            __pyx_t_7 = 0;
-            __pyx_t_6 = 0;
-            __pyx_t_6 = PyObject_Call(__pyx_1, ((PyObject *)__pyx_t_2), NULL); if (unlikely(!__pyx_t_6)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 589; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            __Pyx_GOTREF(__pyx_t_6);
-            __Pyx_DECREF(__pyx_1); __pyx_1 = 0;
-            __Pyx_DECREF(((PyObject *)__pyx_t_2)); __pyx_t_2 = 0;
-            __pyx_t_2 = PyNumber_Multiply(__pyx_t_94, __pyx_t_6); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 589; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            __Pyx_GOTREF(__pyx_t_2);
-            __Pyx_DECREF(__pyx_t_94); __pyx_t_94 = 0;
-            __Pyx_DECREF(__pyx_t_6); __pyx_t_6 = 0;
-            __pyx_t_6 = PyNumber_Add(__pyx_t_93, __pyx_t_2); if (unlikely(!__pyx_t_6)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 589; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            __Pyx_GOTREF(__pyx_t_6);
-            __Pyx_DECREF(__pyx_t_93); __pyx_t_93 = 0;
-            __Pyx_DECREF(__pyx_t_2); __pyx_t_2 = 0;
-            __pyx_t_116 = __pyx_PyFloat_AsDouble(__pyx_t_6); if (unlikely(PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 589; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            __Pyx_DECREF(__pyx_t_6); __pyx_t_6 = 0;
-            __pyx_v_l2 = __pyx_t_116;
-
-            /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":592
- *                                               D[w1,w1], D[w1,w2], D[w2,w2])
- * 
- *                         l1 = l1 - m * mu1_tri(D[w0,w0], D[w0,w1], D[w0,w2],             # <<<<<<<<<<<<<<
- *                                               D[w1,w1], D[w1,w2], D[w2,w2])
- * 
- */
-            __pyx_t_6 = PyFloat_FromDouble(__pyx_v_l1); if (unlikely(!__pyx_t_6)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 592; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            __Pyx_GOTREF(__pyx_t_6);
-            __pyx_t_2 = PyInt_FromLong(__pyx_v_m); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 592; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            __Pyx_GOTREF(__pyx_t_2);
-            __pyx_3 = __Pyx_GetName(__pyx_m, __pyx_kp_53); if (unlikely(!__pyx_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 592; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            __Pyx_GOTREF(__pyx_3);
-            __pyx_t_184 = __pyx_v_w0;
-            __pyx_t_185 = __pyx_v_w0;
-            __pyx_t_9 = -1;
-            if (__pyx_t_184 < 0) {
-              __pyx_t_184 += __pyx_bshape_0_D;
-              if (unlikely(__pyx_t_184 < 0)) __pyx_t_9 = 0;
-            } else if (unlikely(__pyx_t_184 >= __pyx_bshape_0_D)) __pyx_t_9 = 0;
-            if (__pyx_t_185 < 0) {
-              __pyx_t_185 += __pyx_bshape_1_D;
-              if (unlikely(__pyx_t_185 < 0)) __pyx_t_9 = 1;
-            } else if (unlikely(__pyx_t_185 >= __pyx_bshape_1_D)) __pyx_t_9 = 1;
-            if (unlikely(__pyx_t_9 != -1)) {
-              __Pyx_RaiseBufferIndexError(__pyx_t_9);
-              {__pyx_filename = __pyx_f[0]; __pyx_lineno = 592; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            }
-            __pyx_t_93 = PyFloat_FromDouble((*__Pyx_BufPtrStrided2d(__pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_float_t *, __pyx_bstruct_D.buf, __pyx_t_184, __pyx_bstride_0_D, __pyx_t_185, __pyx_bstride_1_D))); if (unlikely(!__pyx_t_93)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 592; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            __Pyx_GOTREF(__pyx_t_93);
-            __pyx_t_186 = __pyx_v_w0;
-            __pyx_t_187 = __pyx_v_w1;
-            __pyx_t_9 = -1;
-            if (__pyx_t_186 < 0) {
-              __pyx_t_186 += __pyx_bshape_0_D;
-              if (unlikely(__pyx_t_186 < 0)) __pyx_t_9 = 0;
-            } else if (unlikely(__pyx_t_186 >= __pyx_bshape_0_D)) __pyx_t_9 = 0;
-            if (__pyx_t_187 < 0) {
-              __pyx_t_187 += __pyx_bshape_1_D;
-              if (unlikely(__pyx_t_187 < 0)) __pyx_t_9 = 1;
-            } else if (unlikely(__pyx_t_187 >= __pyx_bshape_1_D)) __pyx_t_9 = 1;
-            if (unlikely(__pyx_t_9 != -1)) {
-              __Pyx_RaiseBufferIndexError(__pyx_t_9);
-              {__pyx_filename = __pyx_f[0]; __pyx_lineno = 592; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            }
-            __pyx_t_94 = PyFloat_FromDouble((*__Pyx_BufPtrStrided2d(__pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_float_t *, __pyx_bstruct_D.buf, __pyx_t_186, __pyx_bstride_0_D, __pyx_t_187, __pyx_bstride_1_D))); if (unlikely(!__pyx_t_94)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 592; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            __Pyx_GOTREF(__pyx_t_94);
-            __pyx_t_188 = __pyx_v_w0;
-            __pyx_t_189 = __pyx_v_w2;
-            __pyx_t_9 = -1;
-            if (__pyx_t_188 < 0) {
-              __pyx_t_188 += __pyx_bshape_0_D;
-              if (unlikely(__pyx_t_188 < 0)) __pyx_t_9 = 0;
-            } else if (unlikely(__pyx_t_188 >= __pyx_bshape_0_D)) __pyx_t_9 = 0;
-            if (__pyx_t_189 < 0) {
-              __pyx_t_189 += __pyx_bshape_1_D;
-              if (unlikely(__pyx_t_189 < 0)) __pyx_t_9 = 1;
-            } else if (unlikely(__pyx_t_189 >= __pyx_bshape_1_D)) __pyx_t_9 = 1;
-            if (unlikely(__pyx_t_9 != -1)) {
-              __Pyx_RaiseBufferIndexError(__pyx_t_9);
-              {__pyx_filename = __pyx_f[0]; __pyx_lineno = 592; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            }
-            __pyx_t_7 = PyFloat_FromDouble((*__Pyx_BufPtrStrided2d(__pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_float_t *, __pyx_bstruct_D.buf, __pyx_t_188, __pyx_bstride_0_D, __pyx_t_189, __pyx_bstride_1_D))); if (unlikely(!__pyx_t_7)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 592; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            __Pyx_GOTREF(__pyx_t_7);
-
-            /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":593
- * 
- *                         l1 = l1 - m * mu1_tri(D[w0,w0], D[w0,w1], D[w0,w2],
- *                                               D[w1,w1], D[w1,w2], D[w2,w2])             # <<<<<<<<<<<<<<
- * 
- *                         l0 = l0 + m
- */
-            __pyx_t_190 = __pyx_v_w1;
-            __pyx_t_191 = __pyx_v_w1;
-            __pyx_t_9 = -1;
-            if (__pyx_t_190 < 0) {
-              __pyx_t_190 += __pyx_bshape_0_D;
-              if (unlikely(__pyx_t_190 < 0)) __pyx_t_9 = 0;
-            } else if (unlikely(__pyx_t_190 >= __pyx_bshape_0_D)) __pyx_t_9 = 0;
-            if (__pyx_t_191 < 0) {
-              __pyx_t_191 += __pyx_bshape_1_D;
-              if (unlikely(__pyx_t_191 < 0)) __pyx_t_9 = 1;
-            } else if (unlikely(__pyx_t_191 >= __pyx_bshape_1_D)) __pyx_t_9 = 1;
-            if (unlikely(__pyx_t_9 != -1)) {
-              __Pyx_RaiseBufferIndexError(__pyx_t_9);
-              {__pyx_filename = __pyx_f[0]; __pyx_lineno = 593; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            }
-            __pyx_t_25 = PyFloat_FromDouble((*__Pyx_BufPtrStrided2d(__pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_float_t *, __pyx_bstruct_D.buf, __pyx_t_190, __pyx_bstride_0_D, __pyx_t_191, __pyx_bstride_1_D))); if (unlikely(!__pyx_t_25)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 593; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            __Pyx_GOTREF(__pyx_t_25);
-            __pyx_t_192 = __pyx_v_w1;
-            __pyx_t_193 = __pyx_v_w2;
-            __pyx_t_9 = -1;
-            if (__pyx_t_192 < 0) {
-              __pyx_t_192 += __pyx_bshape_0_D;
-              if (unlikely(__pyx_t_192 < 0)) __pyx_t_9 = 0;
-            } else if (unlikely(__pyx_t_192 >= __pyx_bshape_0_D)) __pyx_t_9 = 0;
-            if (__pyx_t_193 < 0) {
-              __pyx_t_193 += __pyx_bshape_1_D;
-              if (unlikely(__pyx_t_193 < 0)) __pyx_t_9 = 1;
-            } else if (unlikely(__pyx_t_193 >= __pyx_bshape_1_D)) __pyx_t_9 = 1;
-            if (unlikely(__pyx_t_9 != -1)) {
-              __Pyx_RaiseBufferIndexError(__pyx_t_9);
-              {__pyx_filename = __pyx_f[0]; __pyx_lineno = 593; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            }
-            __pyx_t_23 = PyFloat_FromDouble((*__Pyx_BufPtrStrided2d(__pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_float_t *, __pyx_bstruct_D.buf, __pyx_t_192, __pyx_bstride_0_D, __pyx_t_193, __pyx_bstride_1_D))); if (unlikely(!__pyx_t_23)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 593; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            __Pyx_GOTREF(__pyx_t_23);
-            __pyx_t_194 = __pyx_v_w2;
-            __pyx_t_195 = __pyx_v_w2;
-            __pyx_t_9 = -1;
-            if (__pyx_t_194 < 0) {
-              __pyx_t_194 += __pyx_bshape_0_D;
-              if (unlikely(__pyx_t_194 < 0)) __pyx_t_9 = 0;
-            } else if (unlikely(__pyx_t_194 >= __pyx_bshape_0_D)) __pyx_t_9 = 0;
-            if (__pyx_t_195 < 0) {
-              __pyx_t_195 += __pyx_bshape_1_D;
-              if (unlikely(__pyx_t_195 < 0)) __pyx_t_9 = 1;
-            } else if (unlikely(__pyx_t_195 >= __pyx_bshape_1_D)) __pyx_t_9 = 1;
-            if (unlikely(__pyx_t_9 != -1)) {
-              __Pyx_RaiseBufferIndexError(__pyx_t_9);
-              {__pyx_filename = __pyx_f[0]; __pyx_lineno = 593; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            }
-            __pyx_t_22 = PyFloat_FromDouble((*__Pyx_BufPtrStrided2d(__pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_float_t *, __pyx_bstruct_D.buf, __pyx_t_194, __pyx_bstride_0_D, __pyx_t_195, __pyx_bstride_1_D))); if (unlikely(!__pyx_t_22)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 593; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            __Pyx_GOTREF(__pyx_t_22);
-            __pyx_t_90 = PyTuple_New(6); if (unlikely(!__pyx_t_90)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 592; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            __Pyx_GOTREF(((PyObject *)__pyx_t_90));
-            PyTuple_SET_ITEM(__pyx_t_90, 0, __pyx_t_93);
-            __Pyx_GIVEREF(__pyx_t_93);
-            PyTuple_SET_ITEM(__pyx_t_90, 1, __pyx_t_94);
-            __Pyx_GIVEREF(__pyx_t_94);
-            PyTuple_SET_ITEM(__pyx_t_90, 2, __pyx_t_7);
-            __Pyx_GIVEREF(__pyx_t_7);
-            PyTuple_SET_ITEM(__pyx_t_90, 3, __pyx_t_25);
-            __Pyx_GIVEREF(__pyx_t_25);
-            PyTuple_SET_ITEM(__pyx_t_90, 4, __pyx_t_23);
-            __Pyx_GIVEREF(__pyx_t_23);
-            PyTuple_SET_ITEM(__pyx_t_90, 5, __pyx_t_22);
-            __Pyx_GIVEREF(__pyx_t_22);
-            __pyx_t_93 = 0;
-            __pyx_t_94 = 0;
-            __pyx_t_7 = 0;
-            __pyx_t_25 = 0;
-            __pyx_t_23 = 0;
-            __pyx_t_22 = 0;
-            __pyx_t_22 = PyObject_Call(__pyx_3, ((PyObject *)__pyx_t_90), NULL); if (unlikely(!__pyx_t_22)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 592; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            __Pyx_GOTREF(__pyx_t_22);
-            __Pyx_DECREF(__pyx_3); __pyx_3 = 0;
-            __Pyx_DECREF(((PyObject *)__pyx_t_90)); __pyx_t_90 = 0;
-            __pyx_t_90 = PyNumber_Multiply(__pyx_t_2, __pyx_t_22); if (unlikely(!__pyx_t_90)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 592; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            __Pyx_GOTREF(__pyx_t_90);
-            __Pyx_DECREF(__pyx_t_2); __pyx_t_2 = 0;
-            __Pyx_DECREF(__pyx_t_22); __pyx_t_22 = 0;
-            __pyx_t_22 = PyNumber_Subtract(__pyx_t_6, __pyx_t_90); if (unlikely(!__pyx_t_22)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 592; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            __Pyx_GOTREF(__pyx_t_22);
-            __Pyx_DECREF(__pyx_t_6); __pyx_t_6 = 0;
-            __Pyx_DECREF(__pyx_t_90); __pyx_t_90 = 0;
-            __pyx_t_116 = __pyx_PyFloat_AsDouble(__pyx_t_22); if (unlikely(PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 592; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            __Pyx_DECREF(__pyx_t_22); __pyx_t_22 = 0;
-            __pyx_v_l1 = __pyx_t_116;
-
-            /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":595
- *                                               D[w1,w1], D[w1,w2], D[w2,w2])
- * 
- *                         l0 = l0 + m             # <<<<<<<<<<<<<<
- * 
- *                 for l in range(ds2):
- */
-            __pyx_v_l0 = (__pyx_v_l0 + __pyx_v_m);
-            goto __pyx_L44;
-          }
-          __pyx_L44:;
-        }
-
-        /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":597
- *                         l0 = l0 + m
- * 
- *                 for l in range(ds2):             # <<<<<<<<<<<<<<
- *                     v0 = pindex + d2[l,0]
- *                     w0 = d2[l,2]
- */
-        for (__pyx_t_34 = 0; __pyx_t_34 < __pyx_v_ds2; __pyx_t_34+=1) {
-          __pyx_v_l = __pyx_t_34;
-
-          /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":598
- * 
- *                 for l in range(ds2):
- *                     v0 = pindex + d2[l,0]             # <<<<<<<<<<<<<<
- *                     w0 = d2[l,2]
- *                     m = fpmask[v0]
- */
-          __pyx_t_196 = __pyx_v_l;
-          __pyx_t_197 = 0;
-          __pyx_t_9 = -1;
-          if (__pyx_t_196 < 0) {
-            __pyx_t_196 += __pyx_bshape_0_d2;
-            if (unlikely(__pyx_t_196 < 0)) __pyx_t_9 = 0;
-          } else if (unlikely(__pyx_t_196 >= __pyx_bshape_0_d2)) __pyx_t_9 = 0;
-          if (__pyx_t_197 < 0) {
-            __pyx_t_197 += __pyx_bshape_1_d2;
-            if (unlikely(__pyx_t_197 < 0)) __pyx_t_9 = 1;
-          } else if (unlikely(__pyx_t_197 >= __pyx_bshape_1_d2)) __pyx_t_9 = 1;
-          if (unlikely(__pyx_t_9 != -1)) {
-            __Pyx_RaiseBufferIndexError(__pyx_t_9);
-            {__pyx_filename = __pyx_f[0]; __pyx_lineno = 598; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-          }
-          __pyx_v_v0 = (__pyx_v_pindex + (*__Pyx_BufPtrStrided2d(__pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_int_t *, __pyx_bstruct_d2.buf, __pyx_t_196, __pyx_bstride_0_d2, __pyx_t_197, __pyx_bstride_1_d2)));
-
-          /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":599
- *                 for l in range(ds2):
- *                     v0 = pindex + d2[l,0]
- *                     w0 = d2[l,2]             # <<<<<<<<<<<<<<
- *                     m = fpmask[v0]
- *                     if m:
- */
-          __pyx_t_198 = __pyx_v_l;
-          __pyx_t_199 = 2;
-          __pyx_t_9 = -1;
-          if (__pyx_t_198 < 0) {
-            __pyx_t_198 += __pyx_bshape_0_d2;
-            if (unlikely(__pyx_t_198 < 0)) __pyx_t_9 = 0;
-          } else if (unlikely(__pyx_t_198 >= __pyx_bshape_0_d2)) __pyx_t_9 = 0;
-          if (__pyx_t_199 < 0) {
-            __pyx_t_199 += __pyx_bshape_1_d2;
-            if (unlikely(__pyx_t_199 < 0)) __pyx_t_9 = 1;
-          } else if (unlikely(__pyx_t_199 >= __pyx_bshape_1_d2)) __pyx_t_9 = 1;
-          if (unlikely(__pyx_t_9 != -1)) {
-            __Pyx_RaiseBufferIndexError(__pyx_t_9);
-            {__pyx_filename = __pyx_f[0]; __pyx_lineno = 599; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-          }
-          __pyx_v_w0 = (*__Pyx_BufPtrStrided2d(__pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_int_t *, __pyx_bstruct_d2.buf, __pyx_t_198, __pyx_bstride_0_d2, __pyx_t_199, __pyx_bstride_1_d2));
-
-          /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":600
- *                     v0 = pindex + d2[l,0]
- *                     w0 = d2[l,2]
- *                     m = fpmask[v0]             # <<<<<<<<<<<<<<
- *                     if m:
- *                         v1 = pindex + d2[l,1]
- */
-          __pyx_t_200 = __pyx_v_v0;
-          __pyx_t_9 = -1;
-          if (__pyx_t_200 < 0) {
-            __pyx_t_200 += __pyx_bshape_0_fpmask;
-            if (unlikely(__pyx_t_200 < 0)) __pyx_t_9 = 0;
-          } else if (unlikely(__pyx_t_200 >= __pyx_bshape_0_fpmask)) __pyx_t_9 = 0;
-          if (unlikely(__pyx_t_9 != -1)) {
-            __Pyx_RaiseBufferIndexError(__pyx_t_9);
-            {__pyx_filename = __pyx_f[0]; __pyx_lineno = 600; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-          }
-          __pyx_v_m = (*__Pyx_BufPtrStrided1d(__pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_int_t *, __pyx_bstruct_fpmask.buf, __pyx_t_200, __pyx_bstride_0_fpmask));
-
-          /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":601
- *                     w0 = d2[l,2]
- *                     m = fpmask[v0]
- *                     if m:             # <<<<<<<<<<<<<<
- *                         v1 = pindex + d2[l,1]
- *                         w1 = d2[l,3]
- */
-          __pyx_t_201 = __pyx_v_m;
-          if (__pyx_t_201) {
-
-            /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":602
- *                     m = fpmask[v0]
- *                     if m:
- *                         v1 = pindex + d2[l,1]             # <<<<<<<<<<<<<<
- *                         w1 = d2[l,3]
- *                         m = m * fpmask[v1]
- */
-            __pyx_t_201 = __pyx_v_l;
-            __pyx_t_202 = 1;
-            __pyx_t_9 = -1;
-            if (__pyx_t_201 < 0) {
-              __pyx_t_201 += __pyx_bshape_0_d2;
-              if (unlikely(__pyx_t_201 < 0)) __pyx_t_9 = 0;
-            } else if (unlikely(__pyx_t_201 >= __pyx_bshape_0_d2)) __pyx_t_9 = 0;
-            if (__pyx_t_202 < 0) {
-              __pyx_t_202 += __pyx_bshape_1_d2;
-              if (unlikely(__pyx_t_202 < 0)) __pyx_t_9 = 1;
-            } else if (unlikely(__pyx_t_202 >= __pyx_bshape_1_d2)) __pyx_t_9 = 1;
-            if (unlikely(__pyx_t_9 != -1)) {
-              __Pyx_RaiseBufferIndexError(__pyx_t_9);
-              {__pyx_filename = __pyx_f[0]; __pyx_lineno = 602; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            }
-            __pyx_v_v1 = (__pyx_v_pindex + (*__Pyx_BufPtrStrided2d(__pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_int_t *, __pyx_bstruct_d2.buf, __pyx_t_201, __pyx_bstride_0_d2, __pyx_t_202, __pyx_bstride_1_d2)));
-
-            /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":603
- *                     if m:
- *                         v1 = pindex + d2[l,1]
- *                         w1 = d2[l,3]             # <<<<<<<<<<<<<<
- *                         m = m * fpmask[v1]
- *                         l1 = l1 + m * mu1_edge(D[w0,w0], D[w0,w1], D[w1,w1])
- */
-            __pyx_t_203 = __pyx_v_l;
-            __pyx_t_204 = 3;
-            __pyx_t_9 = -1;
-            if (__pyx_t_203 < 0) {
-              __pyx_t_203 += __pyx_bshape_0_d2;
-              if (unlikely(__pyx_t_203 < 0)) __pyx_t_9 = 0;
-            } else if (unlikely(__pyx_t_203 >= __pyx_bshape_0_d2)) __pyx_t_9 = 0;
-            if (__pyx_t_204 < 0) {
-              __pyx_t_204 += __pyx_bshape_1_d2;
-              if (unlikely(__pyx_t_204 < 0)) __pyx_t_9 = 1;
-            } else if (unlikely(__pyx_t_204 >= __pyx_bshape_1_d2)) __pyx_t_9 = 1;
-            if (unlikely(__pyx_t_9 != -1)) {
-              __Pyx_RaiseBufferIndexError(__pyx_t_9);
-              {__pyx_filename = __pyx_f[0]; __pyx_lineno = 603; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            }
-            __pyx_v_w1 = (*__Pyx_BufPtrStrided2d(__pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_int_t *, __pyx_bstruct_d2.buf, __pyx_t_203, __pyx_bstride_0_d2, __pyx_t_204, __pyx_bstride_1_d2));
-
-            /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":604
- *                         v1 = pindex + d2[l,1]
- *                         w1 = d2[l,3]
- *                         m = m * fpmask[v1]             # <<<<<<<<<<<<<<
- *                         l1 = l1 + m * mu1_edge(D[w0,w0], D[w0,w1], D[w1,w1])
- * 
- */
-            __pyx_t_205 = __pyx_v_v1;
-            __pyx_t_9 = -1;
-            if (__pyx_t_205 < 0) {
-              __pyx_t_205 += __pyx_bshape_0_fpmask;
-              if (unlikely(__pyx_t_205 < 0)) __pyx_t_9 = 0;
-            } else if (unlikely(__pyx_t_205 >= __pyx_bshape_0_fpmask)) __pyx_t_9 = 0;
-            if (unlikely(__pyx_t_9 != -1)) {
-              __Pyx_RaiseBufferIndexError(__pyx_t_9);
-              {__pyx_filename = __pyx_f[0]; __pyx_lineno = 604; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            }
-            __pyx_v_m = (__pyx_v_m * (*__Pyx_BufPtrStrided1d(__pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_int_t *, __pyx_bstruct_fpmask.buf, __pyx_t_205, __pyx_bstride_0_fpmask)));
-
-            /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":605
- *                         w1 = d2[l,3]
- *                         m = m * fpmask[v1]
- *                         l1 = l1 + m * mu1_edge(D[w0,w0], D[w0,w1], D[w1,w1])             # <<<<<<<<<<<<<<
- * 
- *                         l0 = l0 - m
- */
-            __pyx_t_22 = PyFloat_FromDouble(__pyx_v_l1); if (unlikely(!__pyx_t_22)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 605; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            __Pyx_GOTREF(__pyx_t_22);
-            __pyx_t_90 = PyInt_FromLong(__pyx_v_m); if (unlikely(!__pyx_t_90)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 605; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            __Pyx_GOTREF(__pyx_t_90);
-            __pyx_2 = __Pyx_GetName(__pyx_m, __pyx_kp_45); if (unlikely(!__pyx_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 605; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            __Pyx_GOTREF(__pyx_2);
-            __pyx_t_206 = __pyx_v_w0;
-            __pyx_t_207 = __pyx_v_w0;
-            __pyx_t_9 = -1;
-            if (__pyx_t_206 < 0) {
-              __pyx_t_206 += __pyx_bshape_0_D;
-              if (unlikely(__pyx_t_206 < 0)) __pyx_t_9 = 0;
-            } else if (unlikely(__pyx_t_206 >= __pyx_bshape_0_D)) __pyx_t_9 = 0;
-            if (__pyx_t_207 < 0) {
-              __pyx_t_207 += __pyx_bshape_1_D;
-              if (unlikely(__pyx_t_207 < 0)) __pyx_t_9 = 1;
-            } else if (unlikely(__pyx_t_207 >= __pyx_bshape_1_D)) __pyx_t_9 = 1;
-            if (unlikely(__pyx_t_9 != -1)) {
-              __Pyx_RaiseBufferIndexError(__pyx_t_9);
-              {__pyx_filename = __pyx_f[0]; __pyx_lineno = 605; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            }
-            __pyx_t_6 = PyFloat_FromDouble((*__Pyx_BufPtrStrided2d(__pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_float_t *, __pyx_bstruct_D.buf, __pyx_t_206, __pyx_bstride_0_D, __pyx_t_207, __pyx_bstride_1_D))); if (unlikely(!__pyx_t_6)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 605; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            __Pyx_GOTREF(__pyx_t_6);
-            __pyx_t_208 = __pyx_v_w0;
-            __pyx_t_209 = __pyx_v_w1;
-            __pyx_t_9 = -1;
-            if (__pyx_t_208 < 0) {
-              __pyx_t_208 += __pyx_bshape_0_D;
-              if (unlikely(__pyx_t_208 < 0)) __pyx_t_9 = 0;
-            } else if (unlikely(__pyx_t_208 >= __pyx_bshape_0_D)) __pyx_t_9 = 0;
-            if (__pyx_t_209 < 0) {
-              __pyx_t_209 += __pyx_bshape_1_D;
-              if (unlikely(__pyx_t_209 < 0)) __pyx_t_9 = 1;
-            } else if (unlikely(__pyx_t_209 >= __pyx_bshape_1_D)) __pyx_t_9 = 1;
-            if (unlikely(__pyx_t_9 != -1)) {
-              __Pyx_RaiseBufferIndexError(__pyx_t_9);
-              {__pyx_filename = __pyx_f[0]; __pyx_lineno = 605; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            }
-            __pyx_t_2 = PyFloat_FromDouble((*__Pyx_BufPtrStrided2d(__pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_float_t *, __pyx_bstruct_D.buf, __pyx_t_208, __pyx_bstride_0_D, __pyx_t_209, __pyx_bstride_1_D))); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 605; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            __Pyx_GOTREF(__pyx_t_2);
-            __pyx_t_210 = __pyx_v_w1;
-            __pyx_t_211 = __pyx_v_w1;
-            __pyx_t_9 = -1;
-            if (__pyx_t_210 < 0) {
-              __pyx_t_210 += __pyx_bshape_0_D;
-              if (unlikely(__pyx_t_210 < 0)) __pyx_t_9 = 0;
-            } else if (unlikely(__pyx_t_210 >= __pyx_bshape_0_D)) __pyx_t_9 = 0;
-            if (__pyx_t_211 < 0) {
-              __pyx_t_211 += __pyx_bshape_1_D;
-              if (unlikely(__pyx_t_211 < 0)) __pyx_t_9 = 1;
-            } else if (unlikely(__pyx_t_211 >= __pyx_bshape_1_D)) __pyx_t_9 = 1;
-            if (unlikely(__pyx_t_9 != -1)) {
-              __Pyx_RaiseBufferIndexError(__pyx_t_9);
-              {__pyx_filename = __pyx_f[0]; __pyx_lineno = 605; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            }
-            __pyx_t_23 = PyFloat_FromDouble((*__Pyx_BufPtrStrided2d(__pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_float_t *, __pyx_bstruct_D.buf, __pyx_t_210, __pyx_bstride_0_D, __pyx_t_211, __pyx_bstride_1_D))); if (unlikely(!__pyx_t_23)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 605; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            __Pyx_GOTREF(__pyx_t_23);
-            __pyx_t_25 = PyTuple_New(3); if (unlikely(!__pyx_t_25)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 605; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            __Pyx_GOTREF(((PyObject *)__pyx_t_25));
-            PyTuple_SET_ITEM(__pyx_t_25, 0, __pyx_t_6);
-            __Pyx_GIVEREF(__pyx_t_6);
-            PyTuple_SET_ITEM(__pyx_t_25, 1, __pyx_t_2);
-            __Pyx_GIVEREF(__pyx_t_2);
-            PyTuple_SET_ITEM(__pyx_t_25, 2, __pyx_t_23);
-            __Pyx_GIVEREF(__pyx_t_23);
-            __pyx_t_6 = 0;
-            __pyx_t_2 = 0;
-            __pyx_t_23 = 0;
-            __pyx_t_23 = PyObject_Call(__pyx_2, ((PyObject *)__pyx_t_25), NULL); if (unlikely(!__pyx_t_23)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 605; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            __Pyx_GOTREF(__pyx_t_23);
-            __Pyx_DECREF(__pyx_2); __pyx_2 = 0;
-            __Pyx_DECREF(((PyObject *)__pyx_t_25)); __pyx_t_25 = 0;
-            __pyx_t_25 = PyNumber_Multiply(__pyx_t_90, __pyx_t_23); if (unlikely(!__pyx_t_25)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 605; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            __Pyx_GOTREF(__pyx_t_25);
-            __Pyx_DECREF(__pyx_t_90); __pyx_t_90 = 0;
-            __Pyx_DECREF(__pyx_t_23); __pyx_t_23 = 0;
-            __pyx_t_23 = PyNumber_Add(__pyx_t_22, __pyx_t_25); if (unlikely(!__pyx_t_23)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 605; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            __Pyx_GOTREF(__pyx_t_23);
-            __Pyx_DECREF(__pyx_t_22); __pyx_t_22 = 0;
-            __Pyx_DECREF(__pyx_t_25); __pyx_t_25 = 0;
-            __pyx_t_116 = __pyx_PyFloat_AsDouble(__pyx_t_23); if (unlikely(PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 605; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            __Pyx_DECREF(__pyx_t_23); __pyx_t_23 = 0;
-            __pyx_v_l1 = __pyx_t_116;
-
-            /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":607
- *                         l1 = l1 + m * mu1_edge(D[w0,w0], D[w0,w1], D[w1,w1])
- * 
- *                         l0 = l0 - m             # <<<<<<<<<<<<<<
- * 
- *     l0 += mask.sum()
- */
-            __pyx_v_l0 = (__pyx_v_l0 - __pyx_v_m);
-            goto __pyx_L47;
-          }
-          __pyx_L47:;
-        }
-      }
-    }
-  }
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":609
- *                         l0 = l0 - m
- * 
- *     l0 += mask.sum()             # <<<<<<<<<<<<<<
- *     return np.array([l0, l1, l2, l3])
- * 
- */
-  __pyx_t_23 = PyObject_GetAttr(((PyObject *)__pyx_v_mask), __pyx_kp_sum); if (unlikely(!__pyx_t_23)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 609; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_23);
-  __pyx_t_25 = PyObject_Call(__pyx_t_23, ((PyObject *)__pyx_empty_tuple), NULL); if (unlikely(!__pyx_t_25)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 609; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_25);
-  __Pyx_DECREF(__pyx_t_23); __pyx_t_23 = 0;
-  __pyx_t_116 = __pyx_PyFloat_AsDouble(__pyx_t_25); if (unlikely(PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 609; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_DECREF(__pyx_t_25); __pyx_t_25 = 0;
-  __pyx_v_l0 += __pyx_t_116;
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":610
- * 
- *     l0 += mask.sum()
- *     return np.array([l0, l1, l2, l3])             # <<<<<<<<<<<<<<
- * 
- * def _convert_stride3(v, stride1, stride2):
- */
-  __Pyx_XDECREF(__pyx_r);
-  __pyx_1 = __Pyx_GetName(__pyx_m, __pyx_kp_np); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 610; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_1);
-  __pyx_t_25 = PyObject_GetAttr(__pyx_1, __pyx_kp_array); if (unlikely(!__pyx_t_25)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 610; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_25);
-  __Pyx_DECREF(__pyx_1); __pyx_1 = 0;
-  __pyx_t_23 = PyFloat_FromDouble(__pyx_v_l0); if (unlikely(!__pyx_t_23)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 610; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_23);
-  __pyx_t_22 = PyFloat_FromDouble(__pyx_v_l1); if (unlikely(!__pyx_t_22)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 610; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_22);
-  __pyx_t_90 = PyFloat_FromDouble(__pyx_v_l2); if (unlikely(!__pyx_t_90)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 610; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_90);
-  __pyx_t_2 = PyFloat_FromDouble(__pyx_v_l3); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 610; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_2);
-  __pyx_t_6 = PyList_New(4); if (unlikely(!__pyx_t_6)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 610; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_6));
-  PyList_SET_ITEM(__pyx_t_6, 0, __pyx_t_23);
-  __Pyx_GIVEREF(__pyx_t_23);
-  PyList_SET_ITEM(__pyx_t_6, 1, __pyx_t_22);
-  __Pyx_GIVEREF(__pyx_t_22);
-  PyList_SET_ITEM(__pyx_t_6, 2, __pyx_t_90);
-  __Pyx_GIVEREF(__pyx_t_90);
-  PyList_SET_ITEM(__pyx_t_6, 3, __pyx_t_2);
-  __Pyx_GIVEREF(__pyx_t_2);
-  __pyx_t_23 = 0;
-  __pyx_t_22 = 0;
-  __pyx_t_90 = 0;
-  __pyx_t_2 = 0;
-  __pyx_t_2 = PyTuple_New(1); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 610; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_2));
-  PyTuple_SET_ITEM(__pyx_t_2, 0, ((PyObject *)__pyx_t_6));
-  __Pyx_GIVEREF(((PyObject *)__pyx_t_6));
-  __pyx_t_6 = 0;
-  __pyx_t_6 = PyObject_Call(__pyx_t_25, ((PyObject *)__pyx_t_2), NULL); if (unlikely(!__pyx_t_6)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 610; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_6);
-  __Pyx_DECREF(__pyx_t_25); __pyx_t_25 = 0;
-  __Pyx_DECREF(((PyObject *)__pyx_t_2)); __pyx_t_2 = 0;
-  __pyx_r = __pyx_t_6;
-  __pyx_t_6 = 0;
-  goto __pyx_L0;
-
-  __pyx_r = Py_None; __Pyx_INCREF(Py_None);
-  goto __pyx_L0;
-  __pyx_L1_error:;
-  __Pyx_XDECREF(__pyx_1);
-  __Pyx_XDECREF(__pyx_2);
-  __Pyx_XDECREF(__pyx_3);
-  __Pyx_XDECREF(__pyx_t_1);
-  __Pyx_XDECREF(__pyx_t_2);
-  __Pyx_XDECREF(__pyx_t_3);
-  __Pyx_XDECREF(__pyx_t_6);
-  __Pyx_XDECREF(__pyx_t_7);
-  __Pyx_XDECREF(__pyx_t_22);
-  __Pyx_XDECREF(__pyx_t_23);
-  __Pyx_XDECREF(__pyx_t_25);
-  __Pyx_XDECREF(__pyx_t_87);
-  __Pyx_XDECREF(__pyx_t_90);
-  __Pyx_XDECREF(__pyx_t_93);
-  __Pyx_XDECREF(__pyx_t_94);
-  __Pyx_XDECREF(__pyx_t_115);
-  { PyObject *__pyx_type, *__pyx_value, *__pyx_tb;
-    __Pyx_ErrFetch(&__pyx_type, &__pyx_value, &__pyx_tb);
-    __Pyx_SafeReleaseBuffer(&__pyx_bstruct_fpmask);
-    __Pyx_SafeReleaseBuffer(&__pyx_bstruct_d4);
-    __Pyx_SafeReleaseBuffer(&__pyx_bstruct_d2);
-    __Pyx_SafeReleaseBuffer(&__pyx_bstruct_d3);
-    __Pyx_SafeReleaseBuffer(&__pyx_bstruct_cvertices);
-    __Pyx_SafeReleaseBuffer(&__pyx_bstruct_m4);
-    __Pyx_SafeReleaseBuffer(&__pyx_bstruct_m3);
-    __Pyx_SafeReleaseBuffer(&__pyx_bstruct_m2);
-    __Pyx_SafeReleaseBuffer(&__pyx_bstruct_pmask);
-    __Pyx_SafeReleaseBuffer(&__pyx_bstruct_D);
-    __Pyx_SafeReleaseBuffer(&__pyx_bstruct_mask);
-    __Pyx_SafeReleaseBuffer(&__pyx_bstruct_fcoords);
-    __Pyx_SafeReleaseBuffer(&__pyx_bstruct_coords);
-    __Pyx_SafeReleaseBuffer(&__pyx_bstruct_fmask);
-  __Pyx_ErrRestore(__pyx_type, __pyx_value, __pyx_tb);}
-  __Pyx_AddTraceback("nipy.algorithms.statistics.intvol.Lips3d");
-  __pyx_r = NULL;
-  goto __pyx_L2;
-  __pyx_L0:;
-  __Pyx_SafeReleaseBuffer(&__pyx_bstruct_fpmask);
-  __Pyx_SafeReleaseBuffer(&__pyx_bstruct_d4);
-  __Pyx_SafeReleaseBuffer(&__pyx_bstruct_d2);
-  __Pyx_SafeReleaseBuffer(&__pyx_bstruct_d3);
-  __Pyx_SafeReleaseBuffer(&__pyx_bstruct_cvertices);
-  __Pyx_SafeReleaseBuffer(&__pyx_bstruct_m4);
-  __Pyx_SafeReleaseBuffer(&__pyx_bstruct_m3);
-  __Pyx_SafeReleaseBuffer(&__pyx_bstruct_m2);
-  __Pyx_SafeReleaseBuffer(&__pyx_bstruct_pmask);
-  __Pyx_SafeReleaseBuffer(&__pyx_bstruct_D);
-  __Pyx_SafeReleaseBuffer(&__pyx_bstruct_mask);
-  __Pyx_SafeReleaseBuffer(&__pyx_bstruct_fcoords);
-  __Pyx_SafeReleaseBuffer(&__pyx_bstruct_coords);
-  __Pyx_SafeReleaseBuffer(&__pyx_bstruct_fmask);
-  __pyx_L2:;
-  __Pyx_DECREF((PyObject *)__pyx_v_fcoords);
-  __Pyx_DECREF((PyObject *)__pyx_v_D);
-  __Pyx_DECREF((PyObject *)__pyx_v_fmask);
-  __Pyx_DECREF((PyObject *)__pyx_v_fpmask);
-  __Pyx_DECREF((PyObject *)__pyx_v_pmask);
-  __Pyx_DECREF((PyObject *)__pyx_v_d4);
-  __Pyx_DECREF((PyObject *)__pyx_v_m4);
-  __Pyx_DECREF((PyObject *)__pyx_v_d3);
-  __Pyx_DECREF((PyObject *)__pyx_v_m3);
-  __Pyx_DECREF((PyObject *)__pyx_v_d2);
-  __Pyx_DECREF((PyObject *)__pyx_v_m2);
-  __Pyx_DECREF((PyObject *)__pyx_v_cvertices);
-  __Pyx_DECREF(__pyx_v_n);
-  __Pyx_DECREF(__pyx_v_strides);
-  __Pyx_DECREF(__pyx_v_dstrides);
-  __Pyx_DECREF(__pyx_v_union);
-  __Pyx_DECREF(__pyx_v_c);
-  __Pyx_DECREF(__pyx_v_ss0d);
-  __Pyx_DECREF(__pyx_v_ss1d);
-  __Pyx_DECREF(__pyx_v_ss2d);
-  __Pyx_DECREF(__pyx_v_d);
-  __Pyx_DECREF(__pyx_v_v);
-  __Pyx_XGIVEREF(__pyx_r);
-  __Pyx_FinishRefcountContext();
-  return __pyx_r;
-}
-
-/* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":612
- *     return np.array([l0, l1, l2, l3])
- * 
- * def _convert_stride3(v, stride1, stride2):             # <<<<<<<<<<<<<<
- *     """
- *     Take a voxel, expressed as in index in stride1 and
- */
-
-static PyObject *__pyx_pf_4nipy_10algorithms_10statistics_6intvol__convert_stride3(PyObject *__pyx_self, PyObject *__pyx_args, PyObject *__pyx_kwds); /*proto*/
-static char __pyx_doc_4nipy_10algorithms_10statistics_6intvol__convert_stride3[] = "\n    Take a voxel, expressed as in index in stride1 and\n    re-express it as an index in stride2\n    ";
-static PyObject *__pyx_pf_4nipy_10algorithms_10statistics_6intvol__convert_stride3(PyObject *__pyx_self, PyObject *__pyx_args, PyObject *__pyx_kwds) {
-  PyObject *__pyx_v_v = 0;
-  PyObject *__pyx_v_stride1 = 0;
-  PyObject *__pyx_v_stride2 = 0;
-  PyObject *__pyx_v_v0;
-  PyObject *__pyx_v_v1;
-  PyObject *__pyx_v_v2;
-  PyObject *__pyx_r = NULL;
-  PyObject *__pyx_1 = 0;
-  PyObject *__pyx_2 = 0;
-  PyObject *__pyx_t_1 = NULL;
-  PyObject *__pyx_t_2 = NULL;
-  PyObject *__pyx_t_3 = NULL;
-  static PyObject **__pyx_pyargnames[] = {&__pyx_kp_v,&__pyx_kp_40,&__pyx_kp_41,0};
-  __Pyx_SetupRefcountContext("_convert_stride3");
-  __pyx_self = __pyx_self;
-  if (unlikely(__pyx_kwds)) {
-    Py_ssize_t kw_args = PyDict_Size(__pyx_kwds);
-    PyObject* values[3] = {0,0,0};
-    switch (PyTuple_GET_SIZE(__pyx_args)) {
-      case  3: values[2] = PyTuple_GET_ITEM(__pyx_args, 2);
-      case  2: values[1] = PyTuple_GET_ITEM(__pyx_args, 1);
-      case  1: values[0] = PyTuple_GET_ITEM(__pyx_args, 0);
-      case  0: break;
-      default: goto __pyx_L5_argtuple_error;
-    }
-    switch (PyTuple_GET_SIZE(__pyx_args)) {
-      case  0:
-      values[0] = PyDict_GetItem(__pyx_kwds, __pyx_kp_v);
-      if (likely(values[0])) kw_args--;
-      else goto __pyx_L5_argtuple_error;
-      case  1:
-      values[1] = PyDict_GetItem(__pyx_kwds, __pyx_kp_40);
-      if (likely(values[1])) kw_args--;
-      else {
-        __Pyx_RaiseArgtupleInvalid("_convert_stride3", 1, 3, 3, 1); {__pyx_filename = __pyx_f[0]; __pyx_lineno = 612; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-      }
-      case  2:
-      values[2] = PyDict_GetItem(__pyx_kwds, __pyx_kp_41);
-      if (likely(values[2])) kw_args--;
-      else {
-        __Pyx_RaiseArgtupleInvalid("_convert_stride3", 1, 3, 3, 2); {__pyx_filename = __pyx_f[0]; __pyx_lineno = 612; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-      }
-    }
-    if (unlikely(kw_args > 0)) {
-      if (unlikely(__Pyx_ParseOptionalKeywords(__pyx_kwds, __pyx_pyargnames, 0, values, PyTuple_GET_SIZE(__pyx_args), "_convert_stride3") < 0)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 612; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-    }
-    __pyx_v_v = values[0];
-    __pyx_v_stride1 = values[1];
-    __pyx_v_stride2 = values[2];
-  } else if (PyTuple_GET_SIZE(__pyx_args) != 3) {
-    goto __pyx_L5_argtuple_error;
-  } else {
-    __pyx_v_v = PyTuple_GET_ITEM(__pyx_args, 0);
-    __pyx_v_stride1 = PyTuple_GET_ITEM(__pyx_args, 1);
-    __pyx_v_stride2 = PyTuple_GET_ITEM(__pyx_args, 2);
-  }
-  goto __pyx_L4_argument_unpacking_done;
-  __pyx_L5_argtuple_error:;
-  __Pyx_RaiseArgtupleInvalid("_convert_stride3", 1, 3, 3, PyTuple_GET_SIZE(__pyx_args)); {__pyx_filename = __pyx_f[0]; __pyx_lineno = 612; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-  __pyx_L3_error:;
-  __Pyx_AddTraceback("nipy.algorithms.statistics.intvol._convert_stride3");
-  return NULL;
-  __pyx_L4_argument_unpacking_done:;
-  __Pyx_INCREF(__pyx_v_v);
-  __pyx_v_v0 = Py_None; __Pyx_INCREF(Py_None);
-  __pyx_v_v1 = Py_None; __Pyx_INCREF(Py_None);
-  __pyx_v_v2 = Py_None; __Pyx_INCREF(Py_None);
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":617
- *     re-express it as an index in stride2
- *     """
- *     v0 = v / stride1[0]             # <<<<<<<<<<<<<<
- *     v -= v0 * stride1[0]
- *     v1 = v / stride1[1]
- */
-  __pyx_1 = __Pyx_GetItemInt(__pyx_v_stride1, 0, sizeof(long), PyInt_FromLong); if (!__pyx_1) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 617; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_1);
-  __pyx_t_1 = __Pyx_PyNumber_Divide(__pyx_v_v, __pyx_1); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 617; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_1);
-  __Pyx_DECREF(__pyx_1); __pyx_1 = 0;
-  __Pyx_DECREF(__pyx_v_v0);
-  __pyx_v_v0 = __pyx_t_1;
-  __pyx_t_1 = 0;
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":618
- *     """
- *     v0 = v / stride1[0]
- *     v -= v0 * stride1[0]             # <<<<<<<<<<<<<<
- *     v1 = v / stride1[1]
- *     v2 = v - v1 * stride1[1]
- */
-  __pyx_2 = __Pyx_GetItemInt(__pyx_v_stride1, 0, sizeof(long), PyInt_FromLong); if (!__pyx_2) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 618; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_2);
-  __pyx_t_1 = PyNumber_Multiply(__pyx_v_v0, __pyx_2); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 618; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_1);
-  __Pyx_DECREF(__pyx_2); __pyx_2 = 0;
-  __pyx_1 = PyNumber_InPlaceSubtract(__pyx_v_v, __pyx_t_1); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 618; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_1);
-  __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-  __Pyx_DECREF(__pyx_v_v);
-  __pyx_v_v = __pyx_1;
-  __pyx_1 = 0;
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":619
- *     v0 = v / stride1[0]
- *     v -= v0 * stride1[0]
- *     v1 = v / stride1[1]             # <<<<<<<<<<<<<<
- *     v2 = v - v1 * stride1[1]
- *     return v0*stride2[0] + v1*stride2[1] + v2*stride2[2]
- */
-  __pyx_2 = __Pyx_GetItemInt(__pyx_v_stride1, 1, sizeof(long), PyInt_FromLong); if (!__pyx_2) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 619; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_2);
-  __pyx_t_1 = __Pyx_PyNumber_Divide(__pyx_v_v, __pyx_2); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 619; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_1);
-  __Pyx_DECREF(__pyx_2); __pyx_2 = 0;
-  __Pyx_DECREF(__pyx_v_v1);
-  __pyx_v_v1 = __pyx_t_1;
-  __pyx_t_1 = 0;
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":620
- *     v -= v0 * stride1[0]
- *     v1 = v / stride1[1]
- *     v2 = v - v1 * stride1[1]             # <<<<<<<<<<<<<<
- *     return v0*stride2[0] + v1*stride2[1] + v2*stride2[2]
- * 
- */
-  __pyx_1 = __Pyx_GetItemInt(__pyx_v_stride1, 1, sizeof(long), PyInt_FromLong); if (!__pyx_1) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 620; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_1);
-  __pyx_t_1 = PyNumber_Multiply(__pyx_v_v1, __pyx_1); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 620; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_1);
-  __Pyx_DECREF(__pyx_1); __pyx_1 = 0;
-  __pyx_t_2 = PyNumber_Subtract(__pyx_v_v, __pyx_t_1); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 620; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_2);
-  __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-  __Pyx_DECREF(__pyx_v_v2);
-  __pyx_v_v2 = __pyx_t_2;
-  __pyx_t_2 = 0;
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":621
- *     v1 = v / stride1[1]
- *     v2 = v - v1 * stride1[1]
- *     return v0*stride2[0] + v1*stride2[1] + v2*stride2[2]             # <<<<<<<<<<<<<<
- * 
- * def _convert_stride2(v, stride1, stride2):
- */
-  __Pyx_XDECREF(__pyx_r);
-  __pyx_2 = __Pyx_GetItemInt(__pyx_v_stride2, 0, sizeof(long), PyInt_FromLong); if (!__pyx_2) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 621; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_2);
-  __pyx_t_2 = PyNumber_Multiply(__pyx_v_v0, __pyx_2); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 621; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_2);
-  __Pyx_DECREF(__pyx_2); __pyx_2 = 0;
-  __pyx_1 = __Pyx_GetItemInt(__pyx_v_stride2, 1, sizeof(long), PyInt_FromLong); if (!__pyx_1) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 621; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_1);
-  __pyx_t_1 = PyNumber_Multiply(__pyx_v_v1, __pyx_1); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 621; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_1);
-  __Pyx_DECREF(__pyx_1); __pyx_1 = 0;
-  __pyx_t_3 = PyNumber_Add(__pyx_t_2, __pyx_t_1); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 621; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_3);
-  __Pyx_DECREF(__pyx_t_2); __pyx_t_2 = 0;
-  __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-  __pyx_2 = __Pyx_GetItemInt(__pyx_v_stride2, 2, sizeof(long), PyInt_FromLong); if (!__pyx_2) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 621; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_2);
-  __pyx_t_1 = PyNumber_Multiply(__pyx_v_v2, __pyx_2); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 621; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_1);
-  __Pyx_DECREF(__pyx_2); __pyx_2 = 0;
-  __pyx_t_2 = PyNumber_Add(__pyx_t_3, __pyx_t_1); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 621; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_2);
-  __Pyx_DECREF(__pyx_t_3); __pyx_t_3 = 0;
-  __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-  __pyx_r = __pyx_t_2;
-  __pyx_t_2 = 0;
-  goto __pyx_L0;
-
-  __pyx_r = Py_None; __Pyx_INCREF(Py_None);
-  goto __pyx_L0;
-  __pyx_L1_error:;
-  __Pyx_XDECREF(__pyx_1);
-  __Pyx_XDECREF(__pyx_2);
-  __Pyx_XDECREF(__pyx_t_1);
-  __Pyx_XDECREF(__pyx_t_2);
-  __Pyx_XDECREF(__pyx_t_3);
-  __Pyx_AddTraceback("nipy.algorithms.statistics.intvol._convert_stride3");
-  __pyx_r = NULL;
-  __pyx_L0:;
-  __Pyx_DECREF(__pyx_v_v0);
-  __Pyx_DECREF(__pyx_v_v1);
-  __Pyx_DECREF(__pyx_v_v2);
-  __Pyx_DECREF(__pyx_v_v);
-  __Pyx_XGIVEREF(__pyx_r);
-  __Pyx_FinishRefcountContext();
-  return __pyx_r;
-}
-
-/* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":623
- *     return v0*stride2[0] + v1*stride2[1] + v2*stride2[2]
- * 
- * def _convert_stride2(v, stride1, stride2):             # <<<<<<<<<<<<<<
- *     """
- *     Take a voxel, expressed as in index in stride1 and
- */
-
-static PyObject *__pyx_pf_4nipy_10algorithms_10statistics_6intvol__convert_stride2(PyObject *__pyx_self, PyObject *__pyx_args, PyObject *__pyx_kwds); /*proto*/
-static char __pyx_doc_4nipy_10algorithms_10statistics_6intvol__convert_stride2[] = "\n    Take a voxel, expressed as in index in stride1 and\n    re-express it as an index in stride2\n    ";
-static PyObject *__pyx_pf_4nipy_10algorithms_10statistics_6intvol__convert_stride2(PyObject *__pyx_self, PyObject *__pyx_args, PyObject *__pyx_kwds) {
-  PyObject *__pyx_v_v = 0;
-  PyObject *__pyx_v_stride1 = 0;
-  PyObject *__pyx_v_stride2 = 0;
-  PyObject *__pyx_v_v0;
-  PyObject *__pyx_v_v1;
-  PyObject *__pyx_r = NULL;
-  PyObject *__pyx_1 = 0;
-  PyObject *__pyx_t_1 = NULL;
-  PyObject *__pyx_t_2 = NULL;
-  PyObject *__pyx_t_3 = NULL;
-  static PyObject **__pyx_pyargnames[] = {&__pyx_kp_v,&__pyx_kp_40,&__pyx_kp_41,0};
-  __Pyx_SetupRefcountContext("_convert_stride2");
-  __pyx_self = __pyx_self;
-  if (unlikely(__pyx_kwds)) {
-    Py_ssize_t kw_args = PyDict_Size(__pyx_kwds);
-    PyObject* values[3] = {0,0,0};
-    switch (PyTuple_GET_SIZE(__pyx_args)) {
-      case  3: values[2] = PyTuple_GET_ITEM(__pyx_args, 2);
-      case  2: values[1] = PyTuple_GET_ITEM(__pyx_args, 1);
-      case  1: values[0] = PyTuple_GET_ITEM(__pyx_args, 0);
-      case  0: break;
-      default: goto __pyx_L5_argtuple_error;
-    }
-    switch (PyTuple_GET_SIZE(__pyx_args)) {
-      case  0:
-      values[0] = PyDict_GetItem(__pyx_kwds, __pyx_kp_v);
-      if (likely(values[0])) kw_args--;
-      else goto __pyx_L5_argtuple_error;
-      case  1:
-      values[1] = PyDict_GetItem(__pyx_kwds, __pyx_kp_40);
-      if (likely(values[1])) kw_args--;
-      else {
-        __Pyx_RaiseArgtupleInvalid("_convert_stride2", 1, 3, 3, 1); {__pyx_filename = __pyx_f[0]; __pyx_lineno = 623; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-      }
-      case  2:
-      values[2] = PyDict_GetItem(__pyx_kwds, __pyx_kp_41);
-      if (likely(values[2])) kw_args--;
-      else {
-        __Pyx_RaiseArgtupleInvalid("_convert_stride2", 1, 3, 3, 2); {__pyx_filename = __pyx_f[0]; __pyx_lineno = 623; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-      }
-    }
-    if (unlikely(kw_args > 0)) {
-      if (unlikely(__Pyx_ParseOptionalKeywords(__pyx_kwds, __pyx_pyargnames, 0, values, PyTuple_GET_SIZE(__pyx_args), "_convert_stride2") < 0)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 623; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-    }
-    __pyx_v_v = values[0];
-    __pyx_v_stride1 = values[1];
-    __pyx_v_stride2 = values[2];
-  } else if (PyTuple_GET_SIZE(__pyx_args) != 3) {
-    goto __pyx_L5_argtuple_error;
-  } else {
-    __pyx_v_v = PyTuple_GET_ITEM(__pyx_args, 0);
-    __pyx_v_stride1 = PyTuple_GET_ITEM(__pyx_args, 1);
-    __pyx_v_stride2 = PyTuple_GET_ITEM(__pyx_args, 2);
-  }
-  goto __pyx_L4_argument_unpacking_done;
-  __pyx_L5_argtuple_error:;
-  __Pyx_RaiseArgtupleInvalid("_convert_stride2", 1, 3, 3, PyTuple_GET_SIZE(__pyx_args)); {__pyx_filename = __pyx_f[0]; __pyx_lineno = 623; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-  __pyx_L3_error:;
-  __Pyx_AddTraceback("nipy.algorithms.statistics.intvol._convert_stride2");
-  return NULL;
-  __pyx_L4_argument_unpacking_done:;
-  __pyx_v_v0 = Py_None; __Pyx_INCREF(Py_None);
-  __pyx_v_v1 = Py_None; __Pyx_INCREF(Py_None);
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":628
- *     re-express it as an index in stride2
- *     """
- *     v0 = v / stride1[0]             # <<<<<<<<<<<<<<
- *     v1 = v - v0 * stride1[0]
- *     return v0*stride2[0] + v1*stride2[1]
- */
-  __pyx_1 = __Pyx_GetItemInt(__pyx_v_stride1, 0, sizeof(long), PyInt_FromLong); if (!__pyx_1) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 628; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_1);
-  __pyx_t_1 = __Pyx_PyNumber_Divide(__pyx_v_v, __pyx_1); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 628; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_1);
-  __Pyx_DECREF(__pyx_1); __pyx_1 = 0;
-  __Pyx_DECREF(__pyx_v_v0);
-  __pyx_v_v0 = __pyx_t_1;
-  __pyx_t_1 = 0;
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":629
- *     """
- *     v0 = v / stride1[0]
- *     v1 = v - v0 * stride1[0]             # <<<<<<<<<<<<<<
- *     return v0*stride2[0] + v1*stride2[1]
- * 
- */
-  __pyx_1 = __Pyx_GetItemInt(__pyx_v_stride1, 0, sizeof(long), PyInt_FromLong); if (!__pyx_1) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 629; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_1);
-  __pyx_t_1 = PyNumber_Multiply(__pyx_v_v0, __pyx_1); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 629; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_1);
-  __Pyx_DECREF(__pyx_1); __pyx_1 = 0;
-  __pyx_t_2 = PyNumber_Subtract(__pyx_v_v, __pyx_t_1); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 629; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_2);
-  __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-  __Pyx_DECREF(__pyx_v_v1);
-  __pyx_v_v1 = __pyx_t_2;
-  __pyx_t_2 = 0;
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":630
- *     v0 = v / stride1[0]
- *     v1 = v - v0 * stride1[0]
- *     return v0*stride2[0] + v1*stride2[1]             # <<<<<<<<<<<<<<
- * 
- * def _convert_stride1(v, stride1, stride2):
- */
-  __Pyx_XDECREF(__pyx_r);
-  __pyx_1 = __Pyx_GetItemInt(__pyx_v_stride2, 0, sizeof(long), PyInt_FromLong); if (!__pyx_1) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 630; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_1);
-  __pyx_t_2 = PyNumber_Multiply(__pyx_v_v0, __pyx_1); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 630; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_2);
-  __Pyx_DECREF(__pyx_1); __pyx_1 = 0;
-  __pyx_1 = __Pyx_GetItemInt(__pyx_v_stride2, 1, sizeof(long), PyInt_FromLong); if (!__pyx_1) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 630; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_1);
-  __pyx_t_1 = PyNumber_Multiply(__pyx_v_v1, __pyx_1); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 630; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_1);
-  __Pyx_DECREF(__pyx_1); __pyx_1 = 0;
-  __pyx_t_3 = PyNumber_Add(__pyx_t_2, __pyx_t_1); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 630; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_3);
-  __Pyx_DECREF(__pyx_t_2); __pyx_t_2 = 0;
-  __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-  __pyx_r = __pyx_t_3;
-  __pyx_t_3 = 0;
-  goto __pyx_L0;
-
-  __pyx_r = Py_None; __Pyx_INCREF(Py_None);
-  goto __pyx_L0;
-  __pyx_L1_error:;
-  __Pyx_XDECREF(__pyx_1);
-  __Pyx_XDECREF(__pyx_t_1);
-  __Pyx_XDECREF(__pyx_t_2);
-  __Pyx_XDECREF(__pyx_t_3);
-  __Pyx_AddTraceback("nipy.algorithms.statistics.intvol._convert_stride2");
-  __pyx_r = NULL;
-  __pyx_L0:;
-  __Pyx_DECREF(__pyx_v_v0);
-  __Pyx_DECREF(__pyx_v_v1);
-  __Pyx_XGIVEREF(__pyx_r);
-  __Pyx_FinishRefcountContext();
-  return __pyx_r;
-}
-
-/* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":632
- *     return v0*stride2[0] + v1*stride2[1]
- * 
- * def _convert_stride1(v, stride1, stride2):             # <<<<<<<<<<<<<<
- *     """
- *     Take a voxel, expressed as in index in stride1 and
- */
-
-static PyObject *__pyx_pf_4nipy_10algorithms_10statistics_6intvol__convert_stride1(PyObject *__pyx_self, PyObject *__pyx_args, PyObject *__pyx_kwds); /*proto*/
-static char __pyx_doc_4nipy_10algorithms_10statistics_6intvol__convert_stride1[] = "\n    Take a voxel, expressed as in index in stride1 and\n    re-express it as an index in stride2\n    ";
-static PyObject *__pyx_pf_4nipy_10algorithms_10statistics_6intvol__convert_stride1(PyObject *__pyx_self, PyObject *__pyx_args, PyObject *__pyx_kwds) {
-  PyObject *__pyx_v_v = 0;
-  PyObject *__pyx_v_stride1 = 0;
-  PyObject *__pyx_v_stride2 = 0;
-  PyObject *__pyx_v_v0;
-  PyObject *__pyx_r = NULL;
-  PyObject *__pyx_1 = 0;
-  PyObject *__pyx_t_1 = NULL;
-  static PyObject **__pyx_pyargnames[] = {&__pyx_kp_v,&__pyx_kp_40,&__pyx_kp_41,0};
-  __Pyx_SetupRefcountContext("_convert_stride1");
-  __pyx_self = __pyx_self;
-  if (unlikely(__pyx_kwds)) {
-    Py_ssize_t kw_args = PyDict_Size(__pyx_kwds);
-    PyObject* values[3] = {0,0,0};
-    switch (PyTuple_GET_SIZE(__pyx_args)) {
-      case  3: values[2] = PyTuple_GET_ITEM(__pyx_args, 2);
-      case  2: values[1] = PyTuple_GET_ITEM(__pyx_args, 1);
-      case  1: values[0] = PyTuple_GET_ITEM(__pyx_args, 0);
-      case  0: break;
-      default: goto __pyx_L5_argtuple_error;
-    }
-    switch (PyTuple_GET_SIZE(__pyx_args)) {
-      case  0:
-      values[0] = PyDict_GetItem(__pyx_kwds, __pyx_kp_v);
-      if (likely(values[0])) kw_args--;
-      else goto __pyx_L5_argtuple_error;
-      case  1:
-      values[1] = PyDict_GetItem(__pyx_kwds, __pyx_kp_40);
-      if (likely(values[1])) kw_args--;
-      else {
-        __Pyx_RaiseArgtupleInvalid("_convert_stride1", 1, 3, 3, 1); {__pyx_filename = __pyx_f[0]; __pyx_lineno = 632; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-      }
-      case  2:
-      values[2] = PyDict_GetItem(__pyx_kwds, __pyx_kp_41);
-      if (likely(values[2])) kw_args--;
-      else {
-        __Pyx_RaiseArgtupleInvalid("_convert_stride1", 1, 3, 3, 2); {__pyx_filename = __pyx_f[0]; __pyx_lineno = 632; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-      }
-    }
-    if (unlikely(kw_args > 0)) {
-      if (unlikely(__Pyx_ParseOptionalKeywords(__pyx_kwds, __pyx_pyargnames, 0, values, PyTuple_GET_SIZE(__pyx_args), "_convert_stride1") < 0)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 632; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-    }
-    __pyx_v_v = values[0];
-    __pyx_v_stride1 = values[1];
-    __pyx_v_stride2 = values[2];
-  } else if (PyTuple_GET_SIZE(__pyx_args) != 3) {
-    goto __pyx_L5_argtuple_error;
-  } else {
-    __pyx_v_v = PyTuple_GET_ITEM(__pyx_args, 0);
-    __pyx_v_stride1 = PyTuple_GET_ITEM(__pyx_args, 1);
-    __pyx_v_stride2 = PyTuple_GET_ITEM(__pyx_args, 2);
-  }
-  goto __pyx_L4_argument_unpacking_done;
-  __pyx_L5_argtuple_error:;
-  __Pyx_RaiseArgtupleInvalid("_convert_stride1", 1, 3, 3, PyTuple_GET_SIZE(__pyx_args)); {__pyx_filename = __pyx_f[0]; __pyx_lineno = 632; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-  __pyx_L3_error:;
-  __Pyx_AddTraceback("nipy.algorithms.statistics.intvol._convert_stride1");
-  return NULL;
-  __pyx_L4_argument_unpacking_done:;
-  __pyx_v_v0 = Py_None; __Pyx_INCREF(Py_None);
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":637
- *     re-express it as an index in stride2
- *     """
- *     v0 = v / stride1[0]             # <<<<<<<<<<<<<<
- *     return v0 * stride2[0]
- * 
- */
-  __pyx_1 = __Pyx_GetItemInt(__pyx_v_stride1, 0, sizeof(long), PyInt_FromLong); if (!__pyx_1) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 637; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_1);
-  __pyx_t_1 = __Pyx_PyNumber_Divide(__pyx_v_v, __pyx_1); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 637; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_1);
-  __Pyx_DECREF(__pyx_1); __pyx_1 = 0;
-  __Pyx_DECREF(__pyx_v_v0);
-  __pyx_v_v0 = __pyx_t_1;
-  __pyx_t_1 = 0;
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":638
- *     """
- *     v0 = v / stride1[0]
- *     return v0 * stride2[0]             # <<<<<<<<<<<<<<
- * 
- * def Lips2d(np.ndarray[DTYPE_float_t, ndim=3] coords,
- */
-  __Pyx_XDECREF(__pyx_r);
-  __pyx_1 = __Pyx_GetItemInt(__pyx_v_stride2, 0, sizeof(long), PyInt_FromLong); if (!__pyx_1) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 638; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_1);
-  __pyx_t_1 = PyNumber_Multiply(__pyx_v_v0, __pyx_1); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 638; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_1);
-  __Pyx_DECREF(__pyx_1); __pyx_1 = 0;
-  __pyx_r = __pyx_t_1;
-  __pyx_t_1 = 0;
-  goto __pyx_L0;
-
-  __pyx_r = Py_None; __Pyx_INCREF(Py_None);
-  goto __pyx_L0;
-  __pyx_L1_error:;
-  __Pyx_XDECREF(__pyx_1);
-  __Pyx_XDECREF(__pyx_t_1);
-  __Pyx_AddTraceback("nipy.algorithms.statistics.intvol._convert_stride1");
-  __pyx_r = NULL;
-  __pyx_L0:;
-  __Pyx_DECREF(__pyx_v_v0);
-  __Pyx_XGIVEREF(__pyx_r);
-  __Pyx_FinishRefcountContext();
-  return __pyx_r;
-}
-
-/* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":640
- *     return v0 * stride2[0]
- * 
- * def Lips2d(np.ndarray[DTYPE_float_t, ndim=3] coords,             # <<<<<<<<<<<<<<
- *            np.ndarray[DTYPE_int_t, ndim=2] mask):
- *     """
- */
-
-static PyObject *__pyx_pf_4nipy_10algorithms_10statistics_6intvol_Lips2d(PyObject *__pyx_self, PyObject *__pyx_args, PyObject *__pyx_kwds); /*proto*/
-static char __pyx_doc_4nipy_10algorithms_10statistics_6intvol_Lips2d[] = "\n    Given a 2d mask and coordinates, estimate the intrinsic volumes\n    of the masked region. The region is broken up into\n    triangles / edges / vertices, which are included based on whether\n    all voxels in the triangle / edge / vertex are\n    in the mask or not.\n\n    Parameters:\n    -----------\n\n    coords : ndarray((*,i,j))\n         Coordinates for the voxels in the mask\n\n    mask : ndarray((i,j), np.int)\n         Binary mask determining whether or not\n         a voxel is in the mask.\n\n    Outputs:\n    --------\n\n    mu : ndarray\n         Array of intrinsic volumes [mu0, mu1, mu2]\n\n    Notes:\n    ------\n\n    The array mask is assumed to be binary. At the time of \n    writing, it is not clear how to get cython to use np.bool\n    arrays.\n\n    References:\n    -----------\n\n    Taylor, J.E. & Worsley, K.J. (2007). \"Detecting sparse signal in random fields,\n      with an application to brain mapping.\"\n      Journal of the American Statistical Association, 102(479):913-928.\n\n\n    ";
-static PyObject *__pyx_pf_4nipy_10algorithms_10statistics_6intvol_Lips2d(PyObject *__pyx_self, PyObject *__pyx_args, PyObject *__pyx_kwds) {
-  PyArrayObject *__pyx_v_coords = 0;
-  PyArrayObject *__pyx_v_mask = 0;
-  PyArrayObject *__pyx_v_fcoords;
-  PyArrayObject *__pyx_v_fmask;
-  PyArrayObject *__pyx_v_fpmask;
-  PyArrayObject *__pyx_v_pmask;
-  PyArrayObject *__pyx_v_d3;
-  PyArrayObject *__pyx_v_d2;
-  long __pyx_v_i;
-  long __pyx_v_j;
-  long __pyx_v_l;
-  long __pyx_v_r;
-  long __pyx_v_s;
-  long __pyx_v_rr;
-  long __pyx_v_ss;
-  long __pyx_v_mr;
-  long __pyx_v_ms;
-  long __pyx_v_s0;
-  long __pyx_v_s1;
-  long __pyx_v_ds2;
-  long __pyx_v_ds3;
-  long __pyx_v_index;
-  long __pyx_v_m;
-  long __pyx_v_npix;
-  long __pyx_v_ss0;
-  long __pyx_v_ss1;
-  long __pyx_v_ss0d;
-  long __pyx_v_ss1d;
-  long __pyx_v_v0;
-  long __pyx_v_v1;
-  long __pyx_v_v2;
-  double __pyx_v_l0;
-  double __pyx_v_l1;
-  double __pyx_v_l2;
-  double __pyx_v_res;
-  PyObject *__pyx_v_l3;
-  PyObject *__pyx_v_n;
-  PyObject *__pyx_v_strides;
-  PyObject *__pyx_v_dstrides;
-  PyObject *__pyx_v_cvertices;
-  PyObject *__pyx_v_union;
-  PyObject *__pyx_v_c;
-  PyObject *__pyx_v_m3;
-  PyObject *__pyx_v_m2;
-  PyObject *__pyx_v_D;
-  PyObject *__pyx_v_pindex;
-  PyObject *__pyx_v_w0;
-  PyObject *__pyx_v_w1;
-  PyObject *__pyx_v_w2;
-  Py_buffer __pyx_bstruct_mask;
-  Py_ssize_t __pyx_bstride_0_mask = 0;
-  Py_ssize_t __pyx_bstride_1_mask = 0;
-  Py_ssize_t __pyx_bshape_0_mask = 0;
-  Py_ssize_t __pyx_bshape_1_mask = 0;
-  Py_buffer __pyx_bstruct_fpmask;
-  Py_ssize_t __pyx_bstride_0_fpmask = 0;
-  Py_ssize_t __pyx_bshape_0_fpmask = 0;
-  Py_buffer __pyx_bstruct_d2;
-  Py_ssize_t __pyx_bstride_0_d2 = 0;
-  Py_ssize_t __pyx_bstride_1_d2 = 0;
-  Py_ssize_t __pyx_bshape_0_d2 = 0;
-  Py_ssize_t __pyx_bshape_1_d2 = 0;
-  Py_buffer __pyx_bstruct_d3;
-  Py_ssize_t __pyx_bstride_0_d3 = 0;
-  Py_ssize_t __pyx_bstride_1_d3 = 0;
-  Py_ssize_t __pyx_bshape_0_d3 = 0;
-  Py_ssize_t __pyx_bshape_1_d3 = 0;
-  Py_buffer __pyx_bstruct_fcoords;
-  Py_ssize_t __pyx_bstride_0_fcoords = 0;
-  Py_ssize_t __pyx_bstride_1_fcoords = 0;
-  Py_ssize_t __pyx_bshape_0_fcoords = 0;
-  Py_ssize_t __pyx_bshape_1_fcoords = 0;
-  Py_buffer __pyx_bstruct_pmask;
-  Py_ssize_t __pyx_bstride_0_pmask = 0;
-  Py_ssize_t __pyx_bstride_1_pmask = 0;
-  Py_ssize_t __pyx_bshape_0_pmask = 0;
-  Py_ssize_t __pyx_bshape_1_pmask = 0;
-  Py_buffer __pyx_bstruct_coords;
-  Py_ssize_t __pyx_bstride_0_coords = 0;
-  Py_ssize_t __pyx_bstride_1_coords = 0;
-  Py_ssize_t __pyx_bstride_2_coords = 0;
-  Py_ssize_t __pyx_bshape_0_coords = 0;
-  Py_ssize_t __pyx_bshape_1_coords = 0;
-  Py_ssize_t __pyx_bshape_2_coords = 0;
-  Py_buffer __pyx_bstruct_fmask;
-  Py_ssize_t __pyx_bstride_0_fmask = 0;
-  Py_ssize_t __pyx_bshape_0_fmask = 0;
-  PyObject *__pyx_v_v;
-  PyObject *__pyx_r = NULL;
-  PyObject *__pyx_1 = 0;
-  PyObject *__pyx_2 = 0;
-  PyObject *__pyx_3 = 0;
-  PyObject *__pyx_4 = 0;
-  PyObject *__pyx_5 = 0;
-  PyObject *__pyx_6 = 0;
-  PyObject *__pyx_7 = 0;
-  PyObject *__pyx_t_1 = NULL;
-  PyObject *__pyx_t_2 = NULL;
-  PyObject *__pyx_t_3 = NULL;
-  int __pyx_t_4;
-  int __pyx_t_5;
-  PyObject *__pyx_t_6 = NULL;
-  PyArrayObject *__pyx_t_7 = NULL;
-  int __pyx_t_8;
-  PyObject *__pyx_t_9 = NULL;
-  PyObject *__pyx_t_10 = NULL;
-  PyObject *__pyx_t_11 = NULL;
-  npy_intp __pyx_t_12;
-  npy_intp __pyx_t_13;
-  PyArrayObject *__pyx_t_14 = NULL;
-  PyArrayObject *__pyx_t_15 = NULL;
-  PyArrayObject *__pyx_t_16 = NULL;
-  long __pyx_t_17;
-  long __pyx_t_18;
-  PyObject *__pyx_t_19 = NULL;
-  PyObject *__pyx_t_20 = NULL;
-  Py_ssize_t __pyx_t_21;
-  PyArrayObject *__pyx_t_22 = NULL;
-  PyArrayObject *__pyx_t_23 = NULL;
-  long __pyx_t_24;
-  long __pyx_t_25;
-  long __pyx_t_26;
-  long __pyx_t_27;
-  long __pyx_t_28;
-  long __pyx_t_29;
-  long __pyx_t_30;
-  long __pyx_t_31;
-  long __pyx_t_32;
-  long __pyx_t_33;
-  long __pyx_t_34;
-  long __pyx_t_35;
-  long __pyx_t_36;
-  long __pyx_t_37;
-  long __pyx_t_38;
-  long __pyx_t_39;
-  long __pyx_t_40;
-  long __pyx_t_41;
-  long __pyx_t_42;
-  long __pyx_t_43;
-  long __pyx_t_44;
-  long __pyx_t_45;
-  double __pyx_t_46;
-  long __pyx_t_47;
-  long __pyx_t_48;
-  long __pyx_t_49;
-  long __pyx_t_50;
-  long __pyx_t_51;
-  long __pyx_t_52;
-  long __pyx_t_53;
-  long __pyx_t_54;
-  long __pyx_t_55;
-  long __pyx_t_56;
-  static PyObject **__pyx_pyargnames[] = {&__pyx_kp_coords,&__pyx_kp_mask,0};
-  __Pyx_SetupRefcountContext("Lips2d");
-  __pyx_self = __pyx_self;
-  if (unlikely(__pyx_kwds)) {
-    Py_ssize_t kw_args = PyDict_Size(__pyx_kwds);
-    PyObject* values[2] = {0,0};
-    switch (PyTuple_GET_SIZE(__pyx_args)) {
-      case  2: values[1] = PyTuple_GET_ITEM(__pyx_args, 1);
-      case  1: values[0] = PyTuple_GET_ITEM(__pyx_args, 0);
-      case  0: break;
-      default: goto __pyx_L5_argtuple_error;
-    }
-    switch (PyTuple_GET_SIZE(__pyx_args)) {
-      case  0:
-      values[0] = PyDict_GetItem(__pyx_kwds, __pyx_kp_coords);
-      if (likely(values[0])) kw_args--;
-      else goto __pyx_L5_argtuple_error;
-      case  1:
-      values[1] = PyDict_GetItem(__pyx_kwds, __pyx_kp_mask);
-      if (likely(values[1])) kw_args--;
-      else {
-        __Pyx_RaiseArgtupleInvalid("Lips2d", 1, 2, 2, 1); {__pyx_filename = __pyx_f[0]; __pyx_lineno = 640; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-      }
-    }
-    if (unlikely(kw_args > 0)) {
-      if (unlikely(__Pyx_ParseOptionalKeywords(__pyx_kwds, __pyx_pyargnames, 0, values, PyTuple_GET_SIZE(__pyx_args), "Lips2d") < 0)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 640; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-    }
-    __pyx_v_coords = ((PyArrayObject *)values[0]);
-    __pyx_v_mask = ((PyArrayObject *)values[1]);
-  } else if (PyTuple_GET_SIZE(__pyx_args) != 2) {
-    goto __pyx_L5_argtuple_error;
-  } else {
-    __pyx_v_coords = ((PyArrayObject *)PyTuple_GET_ITEM(__pyx_args, 0));
-    __pyx_v_mask = ((PyArrayObject *)PyTuple_GET_ITEM(__pyx_args, 1));
-  }
-  goto __pyx_L4_argument_unpacking_done;
-  __pyx_L5_argtuple_error:;
-  __Pyx_RaiseArgtupleInvalid("Lips2d", 1, 2, 2, PyTuple_GET_SIZE(__pyx_args)); {__pyx_filename = __pyx_f[0]; __pyx_lineno = 640; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-  __pyx_L3_error:;
-  __Pyx_AddTraceback("nipy.algorithms.statistics.intvol.Lips2d");
-  return NULL;
-  __pyx_L4_argument_unpacking_done:;
-  __pyx_v_fcoords = ((PyArrayObject *)Py_None); __Pyx_INCREF(Py_None);
-  __pyx_v_fmask = ((PyArrayObject *)Py_None); __Pyx_INCREF(Py_None);
-  __pyx_v_fpmask = ((PyArrayObject *)Py_None); __Pyx_INCREF(Py_None);
-  __pyx_v_pmask = ((PyArrayObject *)Py_None); __Pyx_INCREF(Py_None);
-  __pyx_v_d3 = ((PyArrayObject *)Py_None); __Pyx_INCREF(Py_None);
-  __pyx_v_d2 = ((PyArrayObject *)Py_None); __Pyx_INCREF(Py_None);
-  __pyx_v_l3 = Py_None; __Pyx_INCREF(Py_None);
-  __pyx_v_n = Py_None; __Pyx_INCREF(Py_None);
-  __pyx_v_strides = Py_None; __Pyx_INCREF(Py_None);
-  __pyx_v_dstrides = Py_None; __Pyx_INCREF(Py_None);
-  __pyx_v_cvertices = Py_None; __Pyx_INCREF(Py_None);
-  __pyx_v_union = Py_None; __Pyx_INCREF(Py_None);
-  __pyx_v_c = Py_None; __Pyx_INCREF(Py_None);
-  __pyx_v_m3 = Py_None; __Pyx_INCREF(Py_None);
-  __pyx_v_m2 = Py_None; __Pyx_INCREF(Py_None);
-  __pyx_v_D = Py_None; __Pyx_INCREF(Py_None);
-  __pyx_v_pindex = Py_None; __Pyx_INCREF(Py_None);
-  __pyx_v_w0 = Py_None; __Pyx_INCREF(Py_None);
-  __pyx_v_w1 = Py_None; __Pyx_INCREF(Py_None);
-  __pyx_v_w2 = Py_None; __Pyx_INCREF(Py_None);
-  __pyx_v_v = Py_None; __Pyx_INCREF(Py_None);
-  __pyx_bstruct_fcoords.buf = NULL;
-  __pyx_bstruct_fmask.buf = NULL;
-  __pyx_bstruct_fpmask.buf = NULL;
-  __pyx_bstruct_pmask.buf = NULL;
-  __pyx_bstruct_d3.buf = NULL;
-  __pyx_bstruct_d2.buf = NULL;
-  __pyx_bstruct_coords.buf = NULL;
-  __pyx_bstruct_mask.buf = NULL;
-  if (unlikely(!__Pyx_ArgTypeTest(((PyObject *)__pyx_v_coords), __pyx_ptype_5numpy_ndarray, 1, "coords", 0))) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 640; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  if (unlikely(!__Pyx_ArgTypeTest(((PyObject *)__pyx_v_mask), __pyx_ptype_5numpy_ndarray, 1, "mask", 0))) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 641; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  {
-    __Pyx_BufFmt_StackElem __pyx_stack[1];
-    if (unlikely(__Pyx_GetBufferAndValidate(&__pyx_bstruct_coords, (PyObject*)__pyx_v_coords, &__Pyx_TypeInfo_nn___pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_float_t, PyBUF_FORMAT| PyBUF_STRIDES, 3, 0, __pyx_stack) == -1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 640; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  }
-  __pyx_bstride_0_coords = __pyx_bstruct_coords.strides[0]; __pyx_bstride_1_coords = __pyx_bstruct_coords.strides[1]; __pyx_bstride_2_coords = __pyx_bstruct_coords.strides[2];
-  __pyx_bshape_0_coords = __pyx_bstruct_coords.shape[0]; __pyx_bshape_1_coords = __pyx_bstruct_coords.shape[1]; __pyx_bshape_2_coords = __pyx_bstruct_coords.shape[2];
-  {
-    __Pyx_BufFmt_StackElem __pyx_stack[1];
-    if (unlikely(__Pyx_GetBufferAndValidate(&__pyx_bstruct_mask, (PyObject*)__pyx_v_mask, &__Pyx_TypeInfo_nn___pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_int_t, PyBUF_FORMAT| PyBUF_STRIDES, 2, 0, __pyx_stack) == -1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 640; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  }
-  __pyx_bstride_0_mask = __pyx_bstruct_mask.strides[0]; __pyx_bstride_1_mask = __pyx_bstruct_mask.strides[1];
-  __pyx_bshape_0_mask = __pyx_bstruct_mask.shape[0]; __pyx_bshape_1_mask = __pyx_bstruct_mask.shape[1];
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":682
- *     """
- * 
- *     if not set(np.unique(mask)).issubset([0,1]):             # <<<<<<<<<<<<<<
- *       raise ValueError('mask should be filled with 0/1 values, but be of type np.int')
- * 
- */
-  __pyx_1 = __Pyx_GetName(__pyx_m, __pyx_kp_np); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 682; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_1);
-  __pyx_t_1 = PyObject_GetAttr(__pyx_1, __pyx_kp_unique); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 682; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_1);
-  __Pyx_DECREF(__pyx_1); __pyx_1 = 0;
-  __pyx_t_2 = PyTuple_New(1); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 682; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_2));
-  __Pyx_INCREF(((PyObject *)__pyx_v_mask));
-  PyTuple_SET_ITEM(__pyx_t_2, 0, ((PyObject *)__pyx_v_mask));
-  __Pyx_GIVEREF(((PyObject *)__pyx_v_mask));
-  __pyx_t_3 = PyObject_Call(__pyx_t_1, ((PyObject *)__pyx_t_2), NULL); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 682; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_3);
-  __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-  __Pyx_DECREF(((PyObject *)__pyx_t_2)); __pyx_t_2 = 0;
-  __pyx_t_2 = PyTuple_New(1); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 682; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_2));
-  PyTuple_SET_ITEM(__pyx_t_2, 0, __pyx_t_3);
-  __Pyx_GIVEREF(__pyx_t_3);
-  __pyx_t_3 = 0;
-  __pyx_t_3 = PyObject_Call(((PyObject *)((PyObject*)&PySet_Type)), ((PyObject *)__pyx_t_2), NULL); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 682; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_3);
-  __Pyx_DECREF(((PyObject *)__pyx_t_2)); __pyx_t_2 = 0;
-  __pyx_t_2 = PyObject_GetAttr(__pyx_t_3, __pyx_kp_issubset); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 682; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_2);
-  __Pyx_DECREF(__pyx_t_3); __pyx_t_3 = 0;
-  __pyx_t_3 = PyList_New(2); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 682; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_3));
-  __Pyx_INCREF(__pyx_int_0);
-  PyList_SET_ITEM(__pyx_t_3, 0, __pyx_int_0);
-  __Pyx_GIVEREF(__pyx_int_0);
-  __Pyx_INCREF(__pyx_int_1);
-  PyList_SET_ITEM(__pyx_t_3, 1, __pyx_int_1);
-  __Pyx_GIVEREF(__pyx_int_1);
-  __pyx_t_1 = PyTuple_New(1); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 682; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_1));
-  PyTuple_SET_ITEM(__pyx_t_1, 0, ((PyObject *)__pyx_t_3));
-  __Pyx_GIVEREF(((PyObject *)__pyx_t_3));
-  __pyx_t_3 = 0;
-  __pyx_t_3 = PyObject_Call(__pyx_t_2, ((PyObject *)__pyx_t_1), NULL); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 682; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_3);
-  __Pyx_DECREF(__pyx_t_2); __pyx_t_2 = 0;
-  __Pyx_DECREF(((PyObject *)__pyx_t_1)); __pyx_t_1 = 0;
-  __pyx_t_4 = __Pyx_PyObject_IsTrue(__pyx_t_3); if (unlikely(__pyx_t_4 < 0)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 682; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_DECREF(__pyx_t_3); __pyx_t_3 = 0;
-  __pyx_t_5 = (!__pyx_t_4);
-  if (__pyx_t_5) {
-
-    /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":683
- * 
- *     if not set(np.unique(mask)).issubset([0,1]):
- *       raise ValueError('mask should be filled with 0/1 values, but be of type np.int')             # <<<<<<<<<<<<<<
- * 
- *     # 'flattened' coords (2d array)
- */
-    __pyx_t_3 = PyTuple_New(1); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 683; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __Pyx_GOTREF(((PyObject *)__pyx_t_3));
-    __Pyx_INCREF(__pyx_kp_54);
-    PyTuple_SET_ITEM(__pyx_t_3, 0, __pyx_kp_54);
-    __Pyx_GIVEREF(__pyx_kp_54);
-    __pyx_t_1 = PyObject_Call(__pyx_builtin_ValueError, ((PyObject *)__pyx_t_3), NULL); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 683; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __Pyx_GOTREF(__pyx_t_1);
-    __Pyx_DECREF(((PyObject *)__pyx_t_3)); __pyx_t_3 = 0;
-    __Pyx_Raise(__pyx_t_1, 0, 0);
-    __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-    {__pyx_filename = __pyx_f[0]; __pyx_lineno = 683; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    goto __pyx_L6;
-  }
-  __pyx_L6:;
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":707
- *     cdef double res
- * 
- *     l0 = 0; l1 = 0; l2 = 0; l3 = 0             # <<<<<<<<<<<<<<
- * 
- *     pmask = np.zeros((mask.shape[0]+1, mask.shape[1]+1), np.int)
- */
-  __pyx_v_l0 = 0;
-  __pyx_v_l1 = 0;
-  __pyx_v_l2 = 0;
-  __Pyx_INCREF(__pyx_int_0);
-  __Pyx_DECREF(__pyx_v_l3);
-  __pyx_v_l3 = __pyx_int_0;
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":709
- *     l0 = 0; l1 = 0; l2 = 0; l3 = 0
- * 
- *     pmask = np.zeros((mask.shape[0]+1, mask.shape[1]+1), np.int)             # <<<<<<<<<<<<<<
- *     pmask[:-1,:-1] = mask
- * 
- */
-  __pyx_1 = __Pyx_GetName(__pyx_m, __pyx_kp_np); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 709; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_1);
-  __pyx_t_1 = PyObject_GetAttr(__pyx_1, __pyx_kp_zeros); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 709; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_1);
-  __Pyx_DECREF(__pyx_1); __pyx_1 = 0;
-  __pyx_t_3 = PyInt_FromLong(((__pyx_v_mask->dimensions[0]) + 1)); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 709; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_3);
-  __pyx_t_2 = PyInt_FromLong(((__pyx_v_mask->dimensions[1]) + 1)); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 709; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_2);
-  __pyx_t_6 = PyTuple_New(2); if (unlikely(!__pyx_t_6)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 709; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_6));
-  PyTuple_SET_ITEM(__pyx_t_6, 0, __pyx_t_3);
-  __Pyx_GIVEREF(__pyx_t_3);
-  PyTuple_SET_ITEM(__pyx_t_6, 1, __pyx_t_2);
-  __Pyx_GIVEREF(__pyx_t_2);
-  __pyx_t_3 = 0;
-  __pyx_t_2 = 0;
-  __pyx_1 = __Pyx_GetName(__pyx_m, __pyx_kp_np); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 709; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_1);
-  __pyx_t_2 = PyObject_GetAttr(__pyx_1, __pyx_kp_int); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 709; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_2);
-  __Pyx_DECREF(__pyx_1); __pyx_1 = 0;
-  __pyx_t_3 = PyTuple_New(2); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 709; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_3));
-  PyTuple_SET_ITEM(__pyx_t_3, 0, ((PyObject *)__pyx_t_6));
-  __Pyx_GIVEREF(((PyObject *)__pyx_t_6));
-  PyTuple_SET_ITEM(__pyx_t_3, 1, __pyx_t_2);
-  __Pyx_GIVEREF(__pyx_t_2);
-  __pyx_t_6 = 0;
-  __pyx_t_2 = 0;
-  __pyx_t_2 = PyObject_Call(__pyx_t_1, ((PyObject *)__pyx_t_3), NULL); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 709; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_2);
-  __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-  __Pyx_DECREF(((PyObject *)__pyx_t_3)); __pyx_t_3 = 0;
-  if (!(__Pyx_TypeTest(__pyx_t_2, __pyx_ptype_5numpy_ndarray))) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 709; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __pyx_t_7 = ((PyArrayObject *)__pyx_t_2);
-  {
-    __Pyx_BufFmt_StackElem __pyx_stack[1];
-    __Pyx_SafeReleaseBuffer(&__pyx_bstruct_pmask);
-    __pyx_t_8 = __Pyx_GetBufferAndValidate(&__pyx_bstruct_pmask, (PyObject*)__pyx_t_7, &__Pyx_TypeInfo_nn___pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_int_t, PyBUF_FORMAT| PyBUF_STRIDES, 2, 0, __pyx_stack);
-    if (unlikely(__pyx_t_8 < 0)) {
-      PyErr_Fetch(&__pyx_t_9, &__pyx_t_10, &__pyx_t_11);
-      if (unlikely(__Pyx_GetBufferAndValidate(&__pyx_bstruct_pmask, (PyObject*)__pyx_v_pmask, &__Pyx_TypeInfo_nn___pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_int_t, PyBUF_FORMAT| PyBUF_STRIDES, 2, 0, __pyx_stack) == -1)) {
-        Py_XDECREF(__pyx_t_9); Py_XDECREF(__pyx_t_10); Py_XDECREF(__pyx_t_11);
-        __Pyx_RaiseBufferFallbackError();
-      } else {
-        PyErr_Restore(__pyx_t_9, __pyx_t_10, __pyx_t_11);
-      }
-    }
-    __pyx_bstride_0_pmask = __pyx_bstruct_pmask.strides[0]; __pyx_bstride_1_pmask = __pyx_bstruct_pmask.strides[1];
-    __pyx_bshape_0_pmask = __pyx_bstruct_pmask.shape[0]; __pyx_bshape_1_pmask = __pyx_bstruct_pmask.shape[1];
-    if (unlikely(__pyx_t_8 < 0)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 709; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  }
-  __pyx_t_7 = 0;
-  __Pyx_DECREF(((PyObject *)__pyx_v_pmask));
-  __pyx_v_pmask = ((PyArrayObject *)__pyx_t_2);
-  __pyx_t_2 = 0;
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":710
- * 
- *     pmask = np.zeros((mask.shape[0]+1, mask.shape[1]+1), np.int)
- *     pmask[:-1,:-1] = mask             # <<<<<<<<<<<<<<
- * 
- *     s0, s1 = pmask.shape[0], pmask.shape[1]
- */
-  __pyx_1 = PySlice_New(Py_None, __pyx_int_neg_1, Py_None); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 710; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_1);
-  __pyx_2 = PySlice_New(Py_None, __pyx_int_neg_1, Py_None); if (unlikely(!__pyx_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 710; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_2);
-  __pyx_t_2 = PyTuple_New(2); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 710; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_2));
-  PyTuple_SET_ITEM(__pyx_t_2, 0, __pyx_1);
-  __Pyx_GIVEREF(__pyx_1);
-  PyTuple_SET_ITEM(__pyx_t_2, 1, __pyx_2);
-  __Pyx_GIVEREF(__pyx_2);
-  __pyx_1 = 0;
-  __pyx_2 = 0;
-  if (PyObject_SetItem(((PyObject *)__pyx_v_pmask), ((PyObject *)__pyx_t_2), ((PyObject *)__pyx_v_mask)) < 0) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 710; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_DECREF(((PyObject *)__pyx_t_2)); __pyx_t_2 = 0;
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":712
- *     pmask[:-1,:-1] = mask
- * 
- *     s0, s1 = pmask.shape[0], pmask.shape[1]             # <<<<<<<<<<<<<<
- * 
- *     if (mask.shape[0], mask.shape[1]) != (coords.shape[1], coords.shape[2]):
- */
-  __pyx_t_12 = (__pyx_v_pmask->dimensions[0]);
-  __pyx_t_13 = (__pyx_v_pmask->dimensions[1]);
-  __pyx_v_s0 = __pyx_t_12;
-  __pyx_v_s1 = __pyx_t_13;
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":714
- *     s0, s1 = pmask.shape[0], pmask.shape[1]
- * 
- *     if (mask.shape[0], mask.shape[1]) != (coords.shape[1], coords.shape[2]):             # <<<<<<<<<<<<<<
- *         raise ValueError('shape of mask does not match coordinates')
- * 
- */
-  __pyx_t_2 = PyInt_FromLong((__pyx_v_mask->dimensions[0])); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 714; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_2);
-  __pyx_t_3 = PyInt_FromLong((__pyx_v_mask->dimensions[1])); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 714; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_3);
-  __pyx_t_1 = PyTuple_New(2); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 714; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_1));
-  PyTuple_SET_ITEM(__pyx_t_1, 0, __pyx_t_2);
-  __Pyx_GIVEREF(__pyx_t_2);
-  PyTuple_SET_ITEM(__pyx_t_1, 1, __pyx_t_3);
-  __Pyx_GIVEREF(__pyx_t_3);
-  __pyx_t_2 = 0;
-  __pyx_t_3 = 0;
-  __pyx_t_3 = PyInt_FromLong((__pyx_v_coords->dimensions[1])); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 714; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_3);
-  __pyx_t_2 = PyInt_FromLong((__pyx_v_coords->dimensions[2])); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 714; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_2);
-  __pyx_t_6 = PyTuple_New(2); if (unlikely(!__pyx_t_6)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 714; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_6));
-  PyTuple_SET_ITEM(__pyx_t_6, 0, __pyx_t_3);
-  __Pyx_GIVEREF(__pyx_t_3);
-  PyTuple_SET_ITEM(__pyx_t_6, 1, __pyx_t_2);
-  __Pyx_GIVEREF(__pyx_t_2);
-  __pyx_t_3 = 0;
-  __pyx_t_2 = 0;
-  __pyx_t_2 = PyObject_RichCompare(((PyObject *)__pyx_t_1), ((PyObject *)__pyx_t_6), Py_NE); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 714; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_2);
-  __Pyx_DECREF(((PyObject *)__pyx_t_1)); __pyx_t_1 = 0;
-  __Pyx_DECREF(((PyObject *)__pyx_t_6)); __pyx_t_6 = 0;
-  __pyx_t_5 = __Pyx_PyObject_IsTrue(__pyx_t_2); if (unlikely(__pyx_t_5 < 0)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 714; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_DECREF(__pyx_t_2); __pyx_t_2 = 0;
-  if (__pyx_t_5) {
-
-    /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":715
- * 
- *     if (mask.shape[0], mask.shape[1]) != (coords.shape[1], coords.shape[2]):
- *         raise ValueError('shape of mask does not match coordinates')             # <<<<<<<<<<<<<<
- * 
- *     fcoords = coords.reshape((coords.shape[0], (s0-1)*(s1-1)))
- */
-    __pyx_t_2 = PyTuple_New(1); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 715; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __Pyx_GOTREF(((PyObject *)__pyx_t_2));
-    __Pyx_INCREF(__pyx_kp_55);
-    PyTuple_SET_ITEM(__pyx_t_2, 0, __pyx_kp_55);
-    __Pyx_GIVEREF(__pyx_kp_55);
-    __pyx_t_6 = PyObject_Call(__pyx_builtin_ValueError, ((PyObject *)__pyx_t_2), NULL); if (unlikely(!__pyx_t_6)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 715; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __Pyx_GOTREF(__pyx_t_6);
-    __Pyx_DECREF(((PyObject *)__pyx_t_2)); __pyx_t_2 = 0;
-    __Pyx_Raise(__pyx_t_6, 0, 0);
-    __Pyx_DECREF(__pyx_t_6); __pyx_t_6 = 0;
-    {__pyx_filename = __pyx_f[0]; __pyx_lineno = 715; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    goto __pyx_L7;
-  }
-  __pyx_L7:;
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":717
- *         raise ValueError('shape of mask does not match coordinates')
- * 
- *     fcoords = coords.reshape((coords.shape[0], (s0-1)*(s1-1)))             # <<<<<<<<<<<<<<
- *     n = fcoords.shape[0]
- *     fpmask = pmask.reshape((s0*s1))
- */
-  __pyx_t_6 = PyObject_GetAttr(((PyObject *)__pyx_v_coords), __pyx_kp_reshape); if (unlikely(!__pyx_t_6)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 717; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_6);
-  __pyx_t_2 = PyInt_FromLong((__pyx_v_coords->dimensions[0])); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 717; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_2);
-  __pyx_t_1 = PyInt_FromLong(((__pyx_v_s0 - 1) * (__pyx_v_s1 - 1))); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 717; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_1);
-  __pyx_t_3 = PyTuple_New(2); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 717; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_3));
-  PyTuple_SET_ITEM(__pyx_t_3, 0, __pyx_t_2);
-  __Pyx_GIVEREF(__pyx_t_2);
-  PyTuple_SET_ITEM(__pyx_t_3, 1, __pyx_t_1);
-  __Pyx_GIVEREF(__pyx_t_1);
-  __pyx_t_2 = 0;
-  __pyx_t_1 = 0;
-  __pyx_t_1 = PyTuple_New(1); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 717; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_1));
-  PyTuple_SET_ITEM(__pyx_t_1, 0, ((PyObject *)__pyx_t_3));
-  __Pyx_GIVEREF(((PyObject *)__pyx_t_3));
-  __pyx_t_3 = 0;
-  __pyx_t_3 = PyObject_Call(__pyx_t_6, ((PyObject *)__pyx_t_1), NULL); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 717; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_3);
-  __Pyx_DECREF(__pyx_t_6); __pyx_t_6 = 0;
-  __Pyx_DECREF(((PyObject *)__pyx_t_1)); __pyx_t_1 = 0;
-  if (!(__Pyx_TypeTest(__pyx_t_3, __pyx_ptype_5numpy_ndarray))) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 717; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __pyx_t_14 = ((PyArrayObject *)__pyx_t_3);
-  {
-    __Pyx_BufFmt_StackElem __pyx_stack[1];
-    __Pyx_SafeReleaseBuffer(&__pyx_bstruct_fcoords);
-    __pyx_t_8 = __Pyx_GetBufferAndValidate(&__pyx_bstruct_fcoords, (PyObject*)__pyx_t_14, &__Pyx_TypeInfo_nn___pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_float_t, PyBUF_FORMAT| PyBUF_STRIDES, 2, 0, __pyx_stack);
-    if (unlikely(__pyx_t_8 < 0)) {
-      PyErr_Fetch(&__pyx_t_11, &__pyx_t_10, &__pyx_t_9);
-      if (unlikely(__Pyx_GetBufferAndValidate(&__pyx_bstruct_fcoords, (PyObject*)__pyx_v_fcoords, &__Pyx_TypeInfo_nn___pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_float_t, PyBUF_FORMAT| PyBUF_STRIDES, 2, 0, __pyx_stack) == -1)) {
-        Py_XDECREF(__pyx_t_11); Py_XDECREF(__pyx_t_10); Py_XDECREF(__pyx_t_9);
-        __Pyx_RaiseBufferFallbackError();
-      } else {
-        PyErr_Restore(__pyx_t_11, __pyx_t_10, __pyx_t_9);
-      }
-    }
-    __pyx_bstride_0_fcoords = __pyx_bstruct_fcoords.strides[0]; __pyx_bstride_1_fcoords = __pyx_bstruct_fcoords.strides[1];
-    __pyx_bshape_0_fcoords = __pyx_bstruct_fcoords.shape[0]; __pyx_bshape_1_fcoords = __pyx_bstruct_fcoords.shape[1];
-    if (unlikely(__pyx_t_8 < 0)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 717; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  }
-  __pyx_t_14 = 0;
-  __Pyx_DECREF(((PyObject *)__pyx_v_fcoords));
-  __pyx_v_fcoords = ((PyArrayObject *)__pyx_t_3);
-  __pyx_t_3 = 0;
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":718
- * 
- *     fcoords = coords.reshape((coords.shape[0], (s0-1)*(s1-1)))
- *     n = fcoords.shape[0]             # <<<<<<<<<<<<<<
- *     fpmask = pmask.reshape((s0*s1))
- *     fmask = mask.reshape((s0-1)*(s1-1))
- */
-  __pyx_t_3 = PyInt_FromLong((__pyx_v_fcoords->dimensions[0])); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 718; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_3);
-  __Pyx_DECREF(__pyx_v_n);
-  __pyx_v_n = __pyx_t_3;
-  __pyx_t_3 = 0;
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":719
- *     fcoords = coords.reshape((coords.shape[0], (s0-1)*(s1-1)))
- *     n = fcoords.shape[0]
- *     fpmask = pmask.reshape((s0*s1))             # <<<<<<<<<<<<<<
- *     fmask = mask.reshape((s0-1)*(s1-1))
- * 
- */
-  __pyx_t_3 = PyObject_GetAttr(((PyObject *)__pyx_v_pmask), __pyx_kp_reshape); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 719; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_3);
-  __pyx_t_1 = PyInt_FromLong((__pyx_v_s0 * __pyx_v_s1)); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 719; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_1);
-  __pyx_t_6 = PyTuple_New(1); if (unlikely(!__pyx_t_6)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 719; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_6));
-  PyTuple_SET_ITEM(__pyx_t_6, 0, __pyx_t_1);
-  __Pyx_GIVEREF(__pyx_t_1);
-  __pyx_t_1 = 0;
-  __pyx_t_1 = PyObject_Call(__pyx_t_3, ((PyObject *)__pyx_t_6), NULL); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 719; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_1);
-  __Pyx_DECREF(__pyx_t_3); __pyx_t_3 = 0;
-  __Pyx_DECREF(((PyObject *)__pyx_t_6)); __pyx_t_6 = 0;
-  if (!(__Pyx_TypeTest(__pyx_t_1, __pyx_ptype_5numpy_ndarray))) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 719; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __pyx_t_15 = ((PyArrayObject *)__pyx_t_1);
-  {
-    __Pyx_BufFmt_StackElem __pyx_stack[1];
-    __Pyx_SafeReleaseBuffer(&__pyx_bstruct_fpmask);
-    __pyx_t_8 = __Pyx_GetBufferAndValidate(&__pyx_bstruct_fpmask, (PyObject*)__pyx_t_15, &__Pyx_TypeInfo_nn___pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_int_t, PyBUF_FORMAT| PyBUF_STRIDES, 1, 0, __pyx_stack);
-    if (unlikely(__pyx_t_8 < 0)) {
-      PyErr_Fetch(&__pyx_t_9, &__pyx_t_10, &__pyx_t_11);
-      if (unlikely(__Pyx_GetBufferAndValidate(&__pyx_bstruct_fpmask, (PyObject*)__pyx_v_fpmask, &__Pyx_TypeInfo_nn___pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_int_t, PyBUF_FORMAT| PyBUF_STRIDES, 1, 0, __pyx_stack) == -1)) {
-        Py_XDECREF(__pyx_t_9); Py_XDECREF(__pyx_t_10); Py_XDECREF(__pyx_t_11);
-        __Pyx_RaiseBufferFallbackError();
-      } else {
-        PyErr_Restore(__pyx_t_9, __pyx_t_10, __pyx_t_11);
-      }
-    }
-    __pyx_bstride_0_fpmask = __pyx_bstruct_fpmask.strides[0];
-    __pyx_bshape_0_fpmask = __pyx_bstruct_fpmask.shape[0];
-    if (unlikely(__pyx_t_8 < 0)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 719; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  }
-  __pyx_t_15 = 0;
-  __Pyx_DECREF(((PyObject *)__pyx_v_fpmask));
-  __pyx_v_fpmask = ((PyArrayObject *)__pyx_t_1);
-  __pyx_t_1 = 0;
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":720
- *     n = fcoords.shape[0]
- *     fpmask = pmask.reshape((s0*s1))
- *     fmask = mask.reshape((s0-1)*(s1-1))             # <<<<<<<<<<<<<<
- * 
- *     # First do the interior contributions.
- */
-  __pyx_t_1 = PyObject_GetAttr(((PyObject *)__pyx_v_mask), __pyx_kp_reshape); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 720; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_1);
-  __pyx_t_6 = PyInt_FromLong(((__pyx_v_s0 - 1) * (__pyx_v_s1 - 1))); if (unlikely(!__pyx_t_6)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 720; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_6);
-  __pyx_t_3 = PyTuple_New(1); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 720; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_3));
-  PyTuple_SET_ITEM(__pyx_t_3, 0, __pyx_t_6);
-  __Pyx_GIVEREF(__pyx_t_6);
-  __pyx_t_6 = 0;
-  __pyx_t_6 = PyObject_Call(__pyx_t_1, ((PyObject *)__pyx_t_3), NULL); if (unlikely(!__pyx_t_6)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 720; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_6);
-  __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-  __Pyx_DECREF(((PyObject *)__pyx_t_3)); __pyx_t_3 = 0;
-  if (!(__Pyx_TypeTest(__pyx_t_6, __pyx_ptype_5numpy_ndarray))) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 720; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __pyx_t_16 = ((PyArrayObject *)__pyx_t_6);
-  {
-    __Pyx_BufFmt_StackElem __pyx_stack[1];
-    __Pyx_SafeReleaseBuffer(&__pyx_bstruct_fmask);
-    __pyx_t_8 = __Pyx_GetBufferAndValidate(&__pyx_bstruct_fmask, (PyObject*)__pyx_t_16, &__Pyx_TypeInfo_nn___pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_int_t, PyBUF_FORMAT| PyBUF_STRIDES, 1, 0, __pyx_stack);
-    if (unlikely(__pyx_t_8 < 0)) {
-      PyErr_Fetch(&__pyx_t_11, &__pyx_t_10, &__pyx_t_9);
-      if (unlikely(__Pyx_GetBufferAndValidate(&__pyx_bstruct_fmask, (PyObject*)__pyx_v_fmask, &__Pyx_TypeInfo_nn___pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_int_t, PyBUF_FORMAT| PyBUF_STRIDES, 1, 0, __pyx_stack) == -1)) {
-        Py_XDECREF(__pyx_t_11); Py_XDECREF(__pyx_t_10); Py_XDECREF(__pyx_t_9);
-        __Pyx_RaiseBufferFallbackError();
-      } else {
-        PyErr_Restore(__pyx_t_11, __pyx_t_10, __pyx_t_9);
-      }
-    }
-    __pyx_bstride_0_fmask = __pyx_bstruct_fmask.strides[0];
-    __pyx_bshape_0_fmask = __pyx_bstruct_fmask.shape[0];
-    if (unlikely(__pyx_t_8 < 0)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 720; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  }
-  __pyx_t_16 = 0;
-  __Pyx_DECREF(((PyObject *)__pyx_v_fmask));
-  __pyx_v_fmask = ((PyArrayObject *)__pyx_t_6);
-  __pyx_t_6 = 0;
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":726
- *     # are uniquely associated with an interior voxel
- * 
- *     strides = np.empty((s0, s1), np.bool).strides             # <<<<<<<<<<<<<<
- *     dstrides = np.empty((s0-1, s1-1), np.bool).strides
- *     cvertices = np.array([[dstrides[0]*i+dstrides[1]*j for i in range(2)] for j in range(2)]).ravel()
- */
-  __pyx_1 = __Pyx_GetName(__pyx_m, __pyx_kp_np); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 726; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_1);
-  __pyx_t_6 = PyObject_GetAttr(__pyx_1, __pyx_kp_empty); if (unlikely(!__pyx_t_6)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 726; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_6);
-  __Pyx_DECREF(__pyx_1); __pyx_1 = 0;
-  __pyx_t_3 = PyInt_FromLong(__pyx_v_s0); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 726; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_3);
-  __pyx_t_1 = PyInt_FromLong(__pyx_v_s1); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 726; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_1);
-  __pyx_t_2 = PyTuple_New(2); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 726; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_2));
-  PyTuple_SET_ITEM(__pyx_t_2, 0, __pyx_t_3);
-  __Pyx_GIVEREF(__pyx_t_3);
-  PyTuple_SET_ITEM(__pyx_t_2, 1, __pyx_t_1);
-  __Pyx_GIVEREF(__pyx_t_1);
-  __pyx_t_3 = 0;
-  __pyx_t_1 = 0;
-  __pyx_2 = __Pyx_GetName(__pyx_m, __pyx_kp_np); if (unlikely(!__pyx_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 726; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_2);
-  __pyx_t_1 = PyObject_GetAttr(__pyx_2, __pyx_kp_bool); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 726; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_1);
-  __Pyx_DECREF(__pyx_2); __pyx_2 = 0;
-  __pyx_t_3 = PyTuple_New(2); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 726; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_3));
-  PyTuple_SET_ITEM(__pyx_t_3, 0, ((PyObject *)__pyx_t_2));
-  __Pyx_GIVEREF(((PyObject *)__pyx_t_2));
-  PyTuple_SET_ITEM(__pyx_t_3, 1, __pyx_t_1);
-  __Pyx_GIVEREF(__pyx_t_1);
-  __pyx_t_2 = 0;
-  __pyx_t_1 = 0;
-  __pyx_t_1 = PyObject_Call(__pyx_t_6, ((PyObject *)__pyx_t_3), NULL); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 726; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_1);
-  __Pyx_DECREF(__pyx_t_6); __pyx_t_6 = 0;
-  __Pyx_DECREF(((PyObject *)__pyx_t_3)); __pyx_t_3 = 0;
-  __pyx_t_3 = PyObject_GetAttr(__pyx_t_1, __pyx_kp_strides); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 726; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_3);
-  __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-  __Pyx_DECREF(__pyx_v_strides);
-  __pyx_v_strides = __pyx_t_3;
-  __pyx_t_3 = 0;
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":727
- * 
- *     strides = np.empty((s0, s1), np.bool).strides
- *     dstrides = np.empty((s0-1, s1-1), np.bool).strides             # <<<<<<<<<<<<<<
- *     cvertices = np.array([[dstrides[0]*i+dstrides[1]*j for i in range(2)] for j in range(2)]).ravel()
- *     cvertices.sort()
- */
-  __pyx_1 = __Pyx_GetName(__pyx_m, __pyx_kp_np); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 727; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_1);
-  __pyx_t_3 = PyObject_GetAttr(__pyx_1, __pyx_kp_empty); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 727; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_3);
-  __Pyx_DECREF(__pyx_1); __pyx_1 = 0;
-  __pyx_t_1 = PyInt_FromLong((__pyx_v_s0 - 1)); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 727; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_1);
-  __pyx_t_6 = PyInt_FromLong((__pyx_v_s1 - 1)); if (unlikely(!__pyx_t_6)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 727; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_6);
-  __pyx_t_2 = PyTuple_New(2); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 727; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_2));
-  PyTuple_SET_ITEM(__pyx_t_2, 0, __pyx_t_1);
-  __Pyx_GIVEREF(__pyx_t_1);
-  PyTuple_SET_ITEM(__pyx_t_2, 1, __pyx_t_6);
-  __Pyx_GIVEREF(__pyx_t_6);
-  __pyx_t_1 = 0;
-  __pyx_t_6 = 0;
-  __pyx_2 = __Pyx_GetName(__pyx_m, __pyx_kp_np); if (unlikely(!__pyx_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 727; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_2);
-  __pyx_t_6 = PyObject_GetAttr(__pyx_2, __pyx_kp_bool); if (unlikely(!__pyx_t_6)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 727; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_6);
-  __Pyx_DECREF(__pyx_2); __pyx_2 = 0;
-  __pyx_t_1 = PyTuple_New(2); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 727; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_1));
-  PyTuple_SET_ITEM(__pyx_t_1, 0, ((PyObject *)__pyx_t_2));
-  __Pyx_GIVEREF(((PyObject *)__pyx_t_2));
-  PyTuple_SET_ITEM(__pyx_t_1, 1, __pyx_t_6);
-  __Pyx_GIVEREF(__pyx_t_6);
-  __pyx_t_2 = 0;
-  __pyx_t_6 = 0;
-  __pyx_t_6 = PyObject_Call(__pyx_t_3, ((PyObject *)__pyx_t_1), NULL); if (unlikely(!__pyx_t_6)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 727; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_6);
-  __Pyx_DECREF(__pyx_t_3); __pyx_t_3 = 0;
-  __Pyx_DECREF(((PyObject *)__pyx_t_1)); __pyx_t_1 = 0;
-  __pyx_t_1 = PyObject_GetAttr(__pyx_t_6, __pyx_kp_strides); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 727; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_1);
-  __Pyx_DECREF(__pyx_t_6); __pyx_t_6 = 0;
-  __Pyx_DECREF(__pyx_v_dstrides);
-  __pyx_v_dstrides = __pyx_t_1;
-  __pyx_t_1 = 0;
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":728
- *     strides = np.empty((s0, s1), np.bool).strides
- *     dstrides = np.empty((s0-1, s1-1), np.bool).strides
- *     cvertices = np.array([[dstrides[0]*i+dstrides[1]*j for i in range(2)] for j in range(2)]).ravel()             # <<<<<<<<<<<<<<
- *     cvertices.sort()
- * 
- */
-  __pyx_1 = __Pyx_GetName(__pyx_m, __pyx_kp_np); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 728; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_1);
-  __pyx_t_1 = PyObject_GetAttr(__pyx_1, __pyx_kp_array); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 728; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_1);
-  __Pyx_DECREF(__pyx_1); __pyx_1 = 0;
-  __pyx_t_6 = PyList_New(0); if (unlikely(!__pyx_t_6)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 728; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_6));
-  for (__pyx_t_17 = 0; __pyx_t_17 < 2; __pyx_t_17+=1) {
-    __pyx_v_j = __pyx_t_17;
-    __pyx_t_3 = PyList_New(0); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 728; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __Pyx_GOTREF(((PyObject *)__pyx_t_3));
-    for (__pyx_t_18 = 0; __pyx_t_18 < 2; __pyx_t_18+=1) {
-      __pyx_v_i = __pyx_t_18;
-      __pyx_2 = __Pyx_GetItemInt(__pyx_v_dstrides, 0, sizeof(long), PyInt_FromLong); if (!__pyx_2) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 728; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-      __Pyx_GOTREF(__pyx_2);
-      __pyx_t_2 = PyInt_FromLong(__pyx_v_i); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 728; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-      __Pyx_GOTREF(__pyx_t_2);
-      __pyx_t_19 = PyNumber_Multiply(__pyx_2, __pyx_t_2); if (unlikely(!__pyx_t_19)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 728; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-      __Pyx_GOTREF(__pyx_t_19);
-      __Pyx_DECREF(__pyx_2); __pyx_2 = 0;
-      __Pyx_DECREF(__pyx_t_2); __pyx_t_2 = 0;
-      __pyx_1 = __Pyx_GetItemInt(__pyx_v_dstrides, 1, sizeof(long), PyInt_FromLong); if (!__pyx_1) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 728; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-      __Pyx_GOTREF(__pyx_1);
-      __pyx_t_2 = PyInt_FromLong(__pyx_v_j); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 728; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-      __Pyx_GOTREF(__pyx_t_2);
-      __pyx_t_20 = PyNumber_Multiply(__pyx_1, __pyx_t_2); if (unlikely(!__pyx_t_20)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 728; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-      __Pyx_GOTREF(__pyx_t_20);
-      __Pyx_DECREF(__pyx_1); __pyx_1 = 0;
-      __Pyx_DECREF(__pyx_t_2); __pyx_t_2 = 0;
-      __pyx_t_2 = PyNumber_Add(__pyx_t_19, __pyx_t_20); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 728; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-      __Pyx_GOTREF(__pyx_t_2);
-      __Pyx_DECREF(__pyx_t_19); __pyx_t_19 = 0;
-      __Pyx_DECREF(__pyx_t_20); __pyx_t_20 = 0;
-      __pyx_t_8 = PyList_Append(__pyx_t_3, (PyObject*)__pyx_t_2); if (unlikely(__pyx_t_8)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 728; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-      __Pyx_DECREF(__pyx_t_2); __pyx_t_2 = 0;
-    }
-    __pyx_t_8 = PyList_Append(__pyx_t_6, (PyObject*)__pyx_t_3); if (unlikely(__pyx_t_8)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 728; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __Pyx_DECREF(((PyObject *)__pyx_t_3)); __pyx_t_3 = 0;
-  }
-  __pyx_t_3 = PyTuple_New(1); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 728; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_3));
-  __Pyx_INCREF(((PyObject *)__pyx_t_6));
-  PyTuple_SET_ITEM(__pyx_t_3, 0, ((PyObject *)__pyx_t_6));
-  __Pyx_GIVEREF(((PyObject *)__pyx_t_6));
-  __Pyx_DECREF(((PyObject *)__pyx_t_6)); __pyx_t_6 = 0;
-  __pyx_t_6 = PyObject_Call(__pyx_t_1, ((PyObject *)__pyx_t_3), NULL); if (unlikely(!__pyx_t_6)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 728; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_6);
-  __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-  __Pyx_DECREF(((PyObject *)__pyx_t_3)); __pyx_t_3 = 0;
-  __pyx_t_3 = PyObject_GetAttr(__pyx_t_6, __pyx_kp_ravel); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 728; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_3);
-  __Pyx_DECREF(__pyx_t_6); __pyx_t_6 = 0;
-  __pyx_t_6 = PyObject_Call(__pyx_t_3, ((PyObject *)__pyx_empty_tuple), NULL); if (unlikely(!__pyx_t_6)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 728; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_6);
-  __Pyx_DECREF(__pyx_t_3); __pyx_t_3 = 0;
-  __Pyx_DECREF(__pyx_v_cvertices);
-  __pyx_v_cvertices = __pyx_t_6;
-  __pyx_t_6 = 0;
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":729
- *     dstrides = np.empty((s0-1, s1-1), np.bool).strides
- *     cvertices = np.array([[dstrides[0]*i+dstrides[1]*j for i in range(2)] for j in range(2)]).ravel()
- *     cvertices.sort()             # <<<<<<<<<<<<<<
- * 
- *     union = join_complexes(*[cube_with_strides_center((0,1), strides),
- */
-  __pyx_t_6 = PyObject_GetAttr(__pyx_v_cvertices, __pyx_kp_sort); if (unlikely(!__pyx_t_6)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 729; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_6);
-  __pyx_t_3 = PyObject_Call(__pyx_t_6, ((PyObject *)__pyx_empty_tuple), NULL); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 729; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_3);
-  __Pyx_DECREF(__pyx_t_6); __pyx_t_6 = 0;
-  __Pyx_DECREF(__pyx_t_3); __pyx_t_3 = 0;
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":731
- *     cvertices.sort()
- * 
- *     union = join_complexes(*[cube_with_strides_center((0,1), strides),             # <<<<<<<<<<<<<<
- *                              cube_with_strides_center((1,0), strides),
- *                              cube_with_strides_center((1,1), strides)])
- */
-  __pyx_2 = __Pyx_GetName(__pyx_m, __pyx_kp_join_complexes); if (unlikely(!__pyx_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 731; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_2);
-  __pyx_1 = __Pyx_GetName(__pyx_m, __pyx_kp_43); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 731; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_1);
-  __pyx_t_3 = PyTuple_New(2); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 731; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_3));
-  __Pyx_INCREF(__pyx_int_0);
-  PyTuple_SET_ITEM(__pyx_t_3, 0, __pyx_int_0);
-  __Pyx_GIVEREF(__pyx_int_0);
-  __Pyx_INCREF(__pyx_int_1);
-  PyTuple_SET_ITEM(__pyx_t_3, 1, __pyx_int_1);
-  __Pyx_GIVEREF(__pyx_int_1);
-  __pyx_t_6 = PyTuple_New(2); if (unlikely(!__pyx_t_6)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 731; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_6));
-  PyTuple_SET_ITEM(__pyx_t_6, 0, ((PyObject *)__pyx_t_3));
-  __Pyx_GIVEREF(((PyObject *)__pyx_t_3));
-  __Pyx_INCREF(__pyx_v_strides);
-  PyTuple_SET_ITEM(__pyx_t_6, 1, __pyx_v_strides);
-  __Pyx_GIVEREF(__pyx_v_strides);
-  __pyx_t_3 = 0;
-  __pyx_t_3 = PyObject_Call(__pyx_1, ((PyObject *)__pyx_t_6), NULL); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 731; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_3);
-  __Pyx_DECREF(__pyx_1); __pyx_1 = 0;
-  __Pyx_DECREF(((PyObject *)__pyx_t_6)); __pyx_t_6 = 0;
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":732
- * 
- *     union = join_complexes(*[cube_with_strides_center((0,1), strides),
- *                              cube_with_strides_center((1,0), strides),             # <<<<<<<<<<<<<<
- *                              cube_with_strides_center((1,1), strides)])
- * 
- */
-  __pyx_1 = __Pyx_GetName(__pyx_m, __pyx_kp_43); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 732; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_1);
-  __pyx_t_6 = PyTuple_New(2); if (unlikely(!__pyx_t_6)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 732; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_6));
-  __Pyx_INCREF(__pyx_int_1);
-  PyTuple_SET_ITEM(__pyx_t_6, 0, __pyx_int_1);
-  __Pyx_GIVEREF(__pyx_int_1);
-  __Pyx_INCREF(__pyx_int_0);
-  PyTuple_SET_ITEM(__pyx_t_6, 1, __pyx_int_0);
-  __Pyx_GIVEREF(__pyx_int_0);
-  __pyx_t_1 = PyTuple_New(2); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 732; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_1));
-  PyTuple_SET_ITEM(__pyx_t_1, 0, ((PyObject *)__pyx_t_6));
-  __Pyx_GIVEREF(((PyObject *)__pyx_t_6));
-  __Pyx_INCREF(__pyx_v_strides);
-  PyTuple_SET_ITEM(__pyx_t_1, 1, __pyx_v_strides);
-  __Pyx_GIVEREF(__pyx_v_strides);
-  __pyx_t_6 = 0;
-  __pyx_t_6 = PyObject_Call(__pyx_1, ((PyObject *)__pyx_t_1), NULL); if (unlikely(!__pyx_t_6)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 732; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_6);
-  __Pyx_DECREF(__pyx_1); __pyx_1 = 0;
-  __Pyx_DECREF(((PyObject *)__pyx_t_1)); __pyx_t_1 = 0;
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":733
- *     union = join_complexes(*[cube_with_strides_center((0,1), strides),
- *                              cube_with_strides_center((1,0), strides),
- *                              cube_with_strides_center((1,1), strides)])             # <<<<<<<<<<<<<<
- * 
- *     c = cube_with_strides_center((0,0), strides)
- */
-  __pyx_1 = __Pyx_GetName(__pyx_m, __pyx_kp_43); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 733; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_1);
-  __pyx_t_1 = PyTuple_New(2); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 733; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_1));
-  __Pyx_INCREF(__pyx_int_1);
-  PyTuple_SET_ITEM(__pyx_t_1, 0, __pyx_int_1);
-  __Pyx_GIVEREF(__pyx_int_1);
-  __Pyx_INCREF(__pyx_int_1);
-  PyTuple_SET_ITEM(__pyx_t_1, 1, __pyx_int_1);
-  __Pyx_GIVEREF(__pyx_int_1);
-  __pyx_t_2 = PyTuple_New(2); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 733; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_2));
-  PyTuple_SET_ITEM(__pyx_t_2, 0, ((PyObject *)__pyx_t_1));
-  __Pyx_GIVEREF(((PyObject *)__pyx_t_1));
-  __Pyx_INCREF(__pyx_v_strides);
-  PyTuple_SET_ITEM(__pyx_t_2, 1, __pyx_v_strides);
-  __Pyx_GIVEREF(__pyx_v_strides);
-  __pyx_t_1 = 0;
-  __pyx_t_1 = PyObject_Call(__pyx_1, ((PyObject *)__pyx_t_2), NULL); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 733; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_1);
-  __Pyx_DECREF(__pyx_1); __pyx_1 = 0;
-  __Pyx_DECREF(((PyObject *)__pyx_t_2)); __pyx_t_2 = 0;
-  __pyx_t_2 = PyList_New(3); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 731; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_2));
-  PyList_SET_ITEM(__pyx_t_2, 0, __pyx_t_3);
-  __Pyx_GIVEREF(__pyx_t_3);
-  PyList_SET_ITEM(__pyx_t_2, 1, __pyx_t_6);
-  __Pyx_GIVEREF(__pyx_t_6);
-  PyList_SET_ITEM(__pyx_t_2, 2, __pyx_t_1);
-  __Pyx_GIVEREF(__pyx_t_1);
-  __pyx_t_3 = 0;
-  __pyx_t_6 = 0;
-  __pyx_t_1 = 0;
-  __pyx_1 = PySequence_Tuple(((PyObject *)__pyx_t_2)); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 731; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_1));
-  __Pyx_DECREF(((PyObject *)__pyx_t_2)); __pyx_t_2 = 0;
-  __pyx_t_2 = PyObject_Call(__pyx_2, ((PyObject *)__pyx_1), NULL); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 731; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_2);
-  __Pyx_DECREF(__pyx_2); __pyx_2 = 0;
-  __Pyx_DECREF(((PyObject *)__pyx_1)); __pyx_1 = 0;
-  __Pyx_DECREF(__pyx_v_union);
-  __pyx_v_union = __pyx_t_2;
-  __pyx_t_2 = 0;
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":735
- *                              cube_with_strides_center((1,1), strides)])
- * 
- *     c = cube_with_strides_center((0,0), strides)             # <<<<<<<<<<<<<<
- *     m3 = np.array(list(c[3].difference(union[3])))
- *     m2 = np.array(list(c[2].difference(union[2])))
- */
-  __pyx_2 = __Pyx_GetName(__pyx_m, __pyx_kp_43); if (unlikely(!__pyx_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 735; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_2);
-  __pyx_t_2 = PyTuple_New(2); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 735; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_2));
-  __Pyx_INCREF(__pyx_int_0);
-  PyTuple_SET_ITEM(__pyx_t_2, 0, __pyx_int_0);
-  __Pyx_GIVEREF(__pyx_int_0);
-  __Pyx_INCREF(__pyx_int_0);
-  PyTuple_SET_ITEM(__pyx_t_2, 1, __pyx_int_0);
-  __Pyx_GIVEREF(__pyx_int_0);
-  __pyx_t_1 = PyTuple_New(2); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 735; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_1));
-  PyTuple_SET_ITEM(__pyx_t_1, 0, ((PyObject *)__pyx_t_2));
-  __Pyx_GIVEREF(((PyObject *)__pyx_t_2));
-  __Pyx_INCREF(__pyx_v_strides);
-  PyTuple_SET_ITEM(__pyx_t_1, 1, __pyx_v_strides);
-  __Pyx_GIVEREF(__pyx_v_strides);
-  __pyx_t_2 = 0;
-  __pyx_t_2 = PyObject_Call(__pyx_2, ((PyObject *)__pyx_t_1), NULL); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 735; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_2);
-  __Pyx_DECREF(__pyx_2); __pyx_2 = 0;
-  __Pyx_DECREF(((PyObject *)__pyx_t_1)); __pyx_t_1 = 0;
-  __Pyx_DECREF(__pyx_v_c);
-  __pyx_v_c = __pyx_t_2;
-  __pyx_t_2 = 0;
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":736
- * 
- *     c = cube_with_strides_center((0,0), strides)
- *     m3 = np.array(list(c[3].difference(union[3])))             # <<<<<<<<<<<<<<
- *     m2 = np.array(list(c[2].difference(union[2])))
- * 
- */
-  __pyx_1 = __Pyx_GetName(__pyx_m, __pyx_kp_np); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 736; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_1);
-  __pyx_t_2 = PyObject_GetAttr(__pyx_1, __pyx_kp_array); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 736; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_2);
-  __Pyx_DECREF(__pyx_1); __pyx_1 = 0;
-  __pyx_2 = __Pyx_GetItemInt(__pyx_v_c, 3, sizeof(long), PyInt_FromLong); if (!__pyx_2) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 736; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_2);
-  __pyx_t_1 = PyObject_GetAttr(__pyx_2, __pyx_kp_difference); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 736; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_1);
-  __Pyx_DECREF(__pyx_2); __pyx_2 = 0;
-  __pyx_1 = __Pyx_GetItemInt(__pyx_v_union, 3, sizeof(long), PyInt_FromLong); if (!__pyx_1) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 736; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_1);
-  __pyx_t_6 = PyTuple_New(1); if (unlikely(!__pyx_t_6)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 736; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_6));
-  PyTuple_SET_ITEM(__pyx_t_6, 0, __pyx_1);
-  __Pyx_GIVEREF(__pyx_1);
-  __pyx_1 = 0;
-  __pyx_t_3 = PyObject_Call(__pyx_t_1, ((PyObject *)__pyx_t_6), NULL); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 736; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_3);
-  __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-  __Pyx_DECREF(((PyObject *)__pyx_t_6)); __pyx_t_6 = 0;
-  __pyx_t_6 = PyTuple_New(1); if (unlikely(!__pyx_t_6)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 736; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_6));
-  PyTuple_SET_ITEM(__pyx_t_6, 0, __pyx_t_3);
-  __Pyx_GIVEREF(__pyx_t_3);
-  __pyx_t_3 = 0;
-  __pyx_t_3 = PyObject_Call(((PyObject *)((PyObject*)&PyList_Type)), ((PyObject *)__pyx_t_6), NULL); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 736; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_3);
-  __Pyx_DECREF(((PyObject *)__pyx_t_6)); __pyx_t_6 = 0;
-  __pyx_t_6 = PyTuple_New(1); if (unlikely(!__pyx_t_6)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 736; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_6));
-  PyTuple_SET_ITEM(__pyx_t_6, 0, __pyx_t_3);
-  __Pyx_GIVEREF(__pyx_t_3);
-  __pyx_t_3 = 0;
-  __pyx_t_3 = PyObject_Call(__pyx_t_2, ((PyObject *)__pyx_t_6), NULL); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 736; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_3);
-  __Pyx_DECREF(__pyx_t_2); __pyx_t_2 = 0;
-  __Pyx_DECREF(((PyObject *)__pyx_t_6)); __pyx_t_6 = 0;
-  __Pyx_DECREF(__pyx_v_m3);
-  __pyx_v_m3 = __pyx_t_3;
-  __pyx_t_3 = 0;
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":737
- *     c = cube_with_strides_center((0,0), strides)
- *     m3 = np.array(list(c[3].difference(union[3])))
- *     m2 = np.array(list(c[2].difference(union[2])))             # <<<<<<<<<<<<<<
- * 
- *     d3 = np.array([[_convert_stride2(v, strides, (2,1)) for v in m3[i]] for i in range(m3.shape[0])])
- */
-  __pyx_2 = __Pyx_GetName(__pyx_m, __pyx_kp_np); if (unlikely(!__pyx_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 737; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_2);
-  __pyx_t_3 = PyObject_GetAttr(__pyx_2, __pyx_kp_array); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 737; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_3);
-  __Pyx_DECREF(__pyx_2); __pyx_2 = 0;
-  __pyx_1 = __Pyx_GetItemInt(__pyx_v_c, 2, sizeof(long), PyInt_FromLong); if (!__pyx_1) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 737; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_1);
-  __pyx_t_6 = PyObject_GetAttr(__pyx_1, __pyx_kp_difference); if (unlikely(!__pyx_t_6)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 737; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_6);
-  __Pyx_DECREF(__pyx_1); __pyx_1 = 0;
-  __pyx_2 = __Pyx_GetItemInt(__pyx_v_union, 2, sizeof(long), PyInt_FromLong); if (!__pyx_2) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 737; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_2);
-  __pyx_t_2 = PyTuple_New(1); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 737; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_2));
-  PyTuple_SET_ITEM(__pyx_t_2, 0, __pyx_2);
-  __Pyx_GIVEREF(__pyx_2);
-  __pyx_2 = 0;
-  __pyx_t_1 = PyObject_Call(__pyx_t_6, ((PyObject *)__pyx_t_2), NULL); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 737; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_1);
-  __Pyx_DECREF(__pyx_t_6); __pyx_t_6 = 0;
-  __Pyx_DECREF(((PyObject *)__pyx_t_2)); __pyx_t_2 = 0;
-  __pyx_t_2 = PyTuple_New(1); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 737; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_2));
-  PyTuple_SET_ITEM(__pyx_t_2, 0, __pyx_t_1);
-  __Pyx_GIVEREF(__pyx_t_1);
-  __pyx_t_1 = 0;
-  __pyx_t_1 = PyObject_Call(((PyObject *)((PyObject*)&PyList_Type)), ((PyObject *)__pyx_t_2), NULL); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 737; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_1);
-  __Pyx_DECREF(((PyObject *)__pyx_t_2)); __pyx_t_2 = 0;
-  __pyx_t_2 = PyTuple_New(1); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 737; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_2));
-  PyTuple_SET_ITEM(__pyx_t_2, 0, __pyx_t_1);
-  __Pyx_GIVEREF(__pyx_t_1);
-  __pyx_t_1 = 0;
-  __pyx_t_1 = PyObject_Call(__pyx_t_3, ((PyObject *)__pyx_t_2), NULL); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 737; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_1);
-  __Pyx_DECREF(__pyx_t_3); __pyx_t_3 = 0;
-  __Pyx_DECREF(((PyObject *)__pyx_t_2)); __pyx_t_2 = 0;
-  __Pyx_DECREF(__pyx_v_m2);
-  __pyx_v_m2 = __pyx_t_1;
-  __pyx_t_1 = 0;
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":739
- *     m2 = np.array(list(c[2].difference(union[2])))
- * 
- *     d3 = np.array([[_convert_stride2(v, strides, (2,1)) for v in m3[i]] for i in range(m3.shape[0])])             # <<<<<<<<<<<<<<
- *     d3 = np.hstack([m3, d3])
- *     ds3 = d3.shape[0]
- */
-  __pyx_1 = __Pyx_GetName(__pyx_m, __pyx_kp_np); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 739; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_1);
-  __pyx_t_1 = PyObject_GetAttr(__pyx_1, __pyx_kp_array); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 739; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_1);
-  __Pyx_DECREF(__pyx_1); __pyx_1 = 0;
-  __pyx_t_2 = PyList_New(0); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 739; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_2));
-  __pyx_t_3 = PyObject_GetAttr(__pyx_v_m3, __pyx_kp_shape); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 739; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_3);
-  __pyx_2 = __Pyx_GetItemInt(__pyx_t_3, 0, sizeof(long), PyInt_FromLong); if (!__pyx_2) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 739; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_2);
-  __Pyx_DECREF(__pyx_t_3); __pyx_t_3 = 0;
-  __pyx_t_17 = __Pyx_PyInt_AsLong(__pyx_2); if (unlikely((__pyx_t_17 == (long)-1) && PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 739; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_DECREF(__pyx_2); __pyx_2 = 0;
-  for (__pyx_t_18 = 0; __pyx_t_18 < __pyx_t_17; __pyx_t_18+=1) {
-    __pyx_v_i = __pyx_t_18;
-    __pyx_t_3 = PyList_New(0); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 739; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __Pyx_GOTREF(((PyObject *)__pyx_t_3));
-    __pyx_1 = __Pyx_GetItemInt(__pyx_v_m3, __pyx_v_i, sizeof(long), PyInt_FromLong); if (!__pyx_1) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 739; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __Pyx_GOTREF(__pyx_1);
-    if (PyList_CheckExact(__pyx_1) || PyTuple_CheckExact(__pyx_1)) {
-      __pyx_t_21 = 0; __pyx_t_6 = __pyx_1; __Pyx_INCREF(__pyx_t_6);
-    } else {
-      __pyx_t_21 = -1; __pyx_t_6 = PyObject_GetIter(__pyx_1); if (unlikely(!__pyx_t_6)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 739; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-      __Pyx_GOTREF(__pyx_t_6);
-    }
-    __Pyx_DECREF(__pyx_1); __pyx_1 = 0;
-    for (;;) {
-      if (likely(PyList_CheckExact(__pyx_t_6))) {
-        if (__pyx_t_21 >= PyList_GET_SIZE(__pyx_t_6)) break;
-        __pyx_t_20 = PyList_GET_ITEM(__pyx_t_6, __pyx_t_21); __Pyx_INCREF(__pyx_t_20); __pyx_t_21++;
-      } else if (likely(PyTuple_CheckExact(__pyx_t_6))) {
-        if (__pyx_t_21 >= PyTuple_GET_SIZE(__pyx_t_6)) break;
-        __pyx_t_20 = PyTuple_GET_ITEM(__pyx_t_6, __pyx_t_21); __Pyx_INCREF(__pyx_t_20); __pyx_t_21++;
-      } else {
-        __pyx_t_20 = PyIter_Next(__pyx_t_6);
-        if (!__pyx_t_20) {
-          if (unlikely(PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 739; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-          break;
-        }
-        __Pyx_GOTREF(__pyx_t_20);
-      }
-      __Pyx_DECREF(__pyx_v_v);
-      __pyx_v_v = __pyx_t_20;
-      __pyx_t_20 = 0;
-      __pyx_2 = __Pyx_GetName(__pyx_m, __pyx_kp_56); if (unlikely(!__pyx_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 739; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-      __Pyx_GOTREF(__pyx_2);
-      __pyx_t_20 = PyTuple_New(2); if (unlikely(!__pyx_t_20)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 739; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-      __Pyx_GOTREF(((PyObject *)__pyx_t_20));
-      __Pyx_INCREF(__pyx_int_2);
-      PyTuple_SET_ITEM(__pyx_t_20, 0, __pyx_int_2);
-      __Pyx_GIVEREF(__pyx_int_2);
-      __Pyx_INCREF(__pyx_int_1);
-      PyTuple_SET_ITEM(__pyx_t_20, 1, __pyx_int_1);
-      __Pyx_GIVEREF(__pyx_int_1);
-      __pyx_t_19 = PyTuple_New(3); if (unlikely(!__pyx_t_19)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 739; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-      __Pyx_GOTREF(((PyObject *)__pyx_t_19));
-      __Pyx_INCREF(__pyx_v_v);
-      PyTuple_SET_ITEM(__pyx_t_19, 0, __pyx_v_v);
-      __Pyx_GIVEREF(__pyx_v_v);
-      __Pyx_INCREF(__pyx_v_strides);
-      PyTuple_SET_ITEM(__pyx_t_19, 1, __pyx_v_strides);
-      __Pyx_GIVEREF(__pyx_v_strides);
-      PyTuple_SET_ITEM(__pyx_t_19, 2, ((PyObject *)__pyx_t_20));
-      __Pyx_GIVEREF(((PyObject *)__pyx_t_20));
-      __pyx_t_20 = 0;
-      __pyx_t_20 = PyObject_Call(__pyx_2, ((PyObject *)__pyx_t_19), NULL); if (unlikely(!__pyx_t_20)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 739; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-      __Pyx_GOTREF(__pyx_t_20);
-      __Pyx_DECREF(__pyx_2); __pyx_2 = 0;
-      __Pyx_DECREF(((PyObject *)__pyx_t_19)); __pyx_t_19 = 0;
-      __pyx_t_8 = PyList_Append(__pyx_t_3, (PyObject*)__pyx_t_20); if (unlikely(__pyx_t_8)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 739; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-      __Pyx_DECREF(__pyx_t_20); __pyx_t_20 = 0;
-    }
-    __Pyx_DECREF(__pyx_t_6); __pyx_t_6 = 0;
-    __pyx_t_8 = PyList_Append(__pyx_t_2, (PyObject*)__pyx_t_3); if (unlikely(__pyx_t_8)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 739; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __Pyx_DECREF(((PyObject *)__pyx_t_3)); __pyx_t_3 = 0;
-  }
-  __pyx_t_3 = PyTuple_New(1); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 739; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_3));
-  __Pyx_INCREF(((PyObject *)__pyx_t_2));
-  PyTuple_SET_ITEM(__pyx_t_3, 0, ((PyObject *)__pyx_t_2));
-  __Pyx_GIVEREF(((PyObject *)__pyx_t_2));
-  __Pyx_DECREF(((PyObject *)__pyx_t_2)); __pyx_t_2 = 0;
-  __pyx_t_2 = PyObject_Call(__pyx_t_1, ((PyObject *)__pyx_t_3), NULL); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 739; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_2);
-  __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-  __Pyx_DECREF(((PyObject *)__pyx_t_3)); __pyx_t_3 = 0;
-  if (!(__Pyx_TypeTest(__pyx_t_2, __pyx_ptype_5numpy_ndarray))) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 739; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __pyx_t_22 = ((PyArrayObject *)__pyx_t_2);
-  {
-    __Pyx_BufFmt_StackElem __pyx_stack[1];
-    __Pyx_SafeReleaseBuffer(&__pyx_bstruct_d3);
-    __pyx_t_8 = __Pyx_GetBufferAndValidate(&__pyx_bstruct_d3, (PyObject*)__pyx_t_22, &__Pyx_TypeInfo_nn___pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_int_t, PyBUF_FORMAT| PyBUF_STRIDES, 2, 0, __pyx_stack);
-    if (unlikely(__pyx_t_8 < 0)) {
-      PyErr_Fetch(&__pyx_t_9, &__pyx_t_10, &__pyx_t_11);
-      if (unlikely(__Pyx_GetBufferAndValidate(&__pyx_bstruct_d3, (PyObject*)__pyx_v_d3, &__Pyx_TypeInfo_nn___pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_int_t, PyBUF_FORMAT| PyBUF_STRIDES, 2, 0, __pyx_stack) == -1)) {
-        Py_XDECREF(__pyx_t_9); Py_XDECREF(__pyx_t_10); Py_XDECREF(__pyx_t_11);
-        __Pyx_RaiseBufferFallbackError();
-      } else {
-        PyErr_Restore(__pyx_t_9, __pyx_t_10, __pyx_t_11);
-      }
-    }
-    __pyx_bstride_0_d3 = __pyx_bstruct_d3.strides[0]; __pyx_bstride_1_d3 = __pyx_bstruct_d3.strides[1];
-    __pyx_bshape_0_d3 = __pyx_bstruct_d3.shape[0]; __pyx_bshape_1_d3 = __pyx_bstruct_d3.shape[1];
-    if (unlikely(__pyx_t_8 < 0)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 739; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  }
-  __pyx_t_22 = 0;
-  __Pyx_DECREF(((PyObject *)__pyx_v_d3));
-  __pyx_v_d3 = ((PyArrayObject *)__pyx_t_2);
-  __pyx_t_2 = 0;
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":740
- * 
- *     d3 = np.array([[_convert_stride2(v, strides, (2,1)) for v in m3[i]] for i in range(m3.shape[0])])
- *     d3 = np.hstack([m3, d3])             # <<<<<<<<<<<<<<
- *     ds3 = d3.shape[0]
- * 
- */
-  __pyx_1 = __Pyx_GetName(__pyx_m, __pyx_kp_np); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 740; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_1);
-  __pyx_t_2 = PyObject_GetAttr(__pyx_1, __pyx_kp_hstack); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 740; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_2);
-  __Pyx_DECREF(__pyx_1); __pyx_1 = 0;
-  __pyx_t_3 = PyList_New(2); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 740; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_3));
-  __Pyx_INCREF(__pyx_v_m3);
-  PyList_SET_ITEM(__pyx_t_3, 0, __pyx_v_m3);
-  __Pyx_GIVEREF(__pyx_v_m3);
-  __Pyx_INCREF(((PyObject *)__pyx_v_d3));
-  PyList_SET_ITEM(__pyx_t_3, 1, ((PyObject *)__pyx_v_d3));
-  __Pyx_GIVEREF(((PyObject *)__pyx_v_d3));
-  __pyx_t_1 = PyTuple_New(1); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 740; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_1));
-  PyTuple_SET_ITEM(__pyx_t_1, 0, ((PyObject *)__pyx_t_3));
-  __Pyx_GIVEREF(((PyObject *)__pyx_t_3));
-  __pyx_t_3 = 0;
-  __pyx_t_3 = PyObject_Call(__pyx_t_2, ((PyObject *)__pyx_t_1), NULL); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 740; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_3);
-  __Pyx_DECREF(__pyx_t_2); __pyx_t_2 = 0;
-  __Pyx_DECREF(((PyObject *)__pyx_t_1)); __pyx_t_1 = 0;
-  if (!(__Pyx_TypeTest(__pyx_t_3, __pyx_ptype_5numpy_ndarray))) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 740; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __pyx_t_22 = ((PyArrayObject *)__pyx_t_3);
-  {
-    __Pyx_BufFmt_StackElem __pyx_stack[1];
-    __Pyx_SafeReleaseBuffer(&__pyx_bstruct_d3);
-    __pyx_t_8 = __Pyx_GetBufferAndValidate(&__pyx_bstruct_d3, (PyObject*)__pyx_t_22, &__Pyx_TypeInfo_nn___pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_int_t, PyBUF_FORMAT| PyBUF_STRIDES, 2, 0, __pyx_stack);
-    if (unlikely(__pyx_t_8 < 0)) {
-      PyErr_Fetch(&__pyx_t_11, &__pyx_t_10, &__pyx_t_9);
-      if (unlikely(__Pyx_GetBufferAndValidate(&__pyx_bstruct_d3, (PyObject*)__pyx_v_d3, &__Pyx_TypeInfo_nn___pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_int_t, PyBUF_FORMAT| PyBUF_STRIDES, 2, 0, __pyx_stack) == -1)) {
-        Py_XDECREF(__pyx_t_11); Py_XDECREF(__pyx_t_10); Py_XDECREF(__pyx_t_9);
-        __Pyx_RaiseBufferFallbackError();
-      } else {
-        PyErr_Restore(__pyx_t_11, __pyx_t_10, __pyx_t_9);
-      }
-    }
-    __pyx_bstride_0_d3 = __pyx_bstruct_d3.strides[0]; __pyx_bstride_1_d3 = __pyx_bstruct_d3.strides[1];
-    __pyx_bshape_0_d3 = __pyx_bstruct_d3.shape[0]; __pyx_bshape_1_d3 = __pyx_bstruct_d3.shape[1];
-    if (unlikely(__pyx_t_8 < 0)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 740; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  }
-  __pyx_t_22 = 0;
-  __Pyx_DECREF(((PyObject *)__pyx_v_d3));
-  __pyx_v_d3 = ((PyArrayObject *)__pyx_t_3);
-  __pyx_t_3 = 0;
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":741
- *     d3 = np.array([[_convert_stride2(v, strides, (2,1)) for v in m3[i]] for i in range(m3.shape[0])])
- *     d3 = np.hstack([m3, d3])
- *     ds3 = d3.shape[0]             # <<<<<<<<<<<<<<
- * 
- *     d2 = np.array([[_convert_stride2(v, strides, (2,1)) for v in m2[i]] for i in range(m2.shape[0])])
- */
-  __pyx_v_ds3 = (__pyx_v_d3->dimensions[0]);
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":743
- *     ds3 = d3.shape[0]
- * 
- *     d2 = np.array([[_convert_stride2(v, strides, (2,1)) for v in m2[i]] for i in range(m2.shape[0])])             # <<<<<<<<<<<<<<
- *     d2 = np.hstack([m2, d2])
- *     ds2 = d2.shape[0]
- */
-  __pyx_2 = __Pyx_GetName(__pyx_m, __pyx_kp_np); if (unlikely(!__pyx_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 743; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_2);
-  __pyx_t_3 = PyObject_GetAttr(__pyx_2, __pyx_kp_array); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 743; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_3);
-  __Pyx_DECREF(__pyx_2); __pyx_2 = 0;
-  __pyx_t_1 = PyList_New(0); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 743; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_1));
-  __pyx_t_2 = PyObject_GetAttr(__pyx_v_m2, __pyx_kp_shape); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 743; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_2);
-  __pyx_1 = __Pyx_GetItemInt(__pyx_t_2, 0, sizeof(long), PyInt_FromLong); if (!__pyx_1) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 743; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_1);
-  __Pyx_DECREF(__pyx_t_2); __pyx_t_2 = 0;
-  __pyx_t_18 = __Pyx_PyInt_AsLong(__pyx_1); if (unlikely((__pyx_t_18 == (long)-1) && PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 743; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_DECREF(__pyx_1); __pyx_1 = 0;
-  for (__pyx_t_17 = 0; __pyx_t_17 < __pyx_t_18; __pyx_t_17+=1) {
-    __pyx_v_i = __pyx_t_17;
-    __pyx_t_2 = PyList_New(0); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 743; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __Pyx_GOTREF(((PyObject *)__pyx_t_2));
-    __pyx_2 = __Pyx_GetItemInt(__pyx_v_m2, __pyx_v_i, sizeof(long), PyInt_FromLong); if (!__pyx_2) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 743; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __Pyx_GOTREF(__pyx_2);
-    if (PyList_CheckExact(__pyx_2) || PyTuple_CheckExact(__pyx_2)) {
-      __pyx_t_21 = 0; __pyx_t_6 = __pyx_2; __Pyx_INCREF(__pyx_t_6);
-    } else {
-      __pyx_t_21 = -1; __pyx_t_6 = PyObject_GetIter(__pyx_2); if (unlikely(!__pyx_t_6)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 743; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-      __Pyx_GOTREF(__pyx_t_6);
-    }
-    __Pyx_DECREF(__pyx_2); __pyx_2 = 0;
-    for (;;) {
-      if (likely(PyList_CheckExact(__pyx_t_6))) {
-        if (__pyx_t_21 >= PyList_GET_SIZE(__pyx_t_6)) break;
-        __pyx_t_20 = PyList_GET_ITEM(__pyx_t_6, __pyx_t_21); __Pyx_INCREF(__pyx_t_20); __pyx_t_21++;
-      } else if (likely(PyTuple_CheckExact(__pyx_t_6))) {
-        if (__pyx_t_21 >= PyTuple_GET_SIZE(__pyx_t_6)) break;
-        __pyx_t_20 = PyTuple_GET_ITEM(__pyx_t_6, __pyx_t_21); __Pyx_INCREF(__pyx_t_20); __pyx_t_21++;
-      } else {
-        __pyx_t_20 = PyIter_Next(__pyx_t_6);
-        if (!__pyx_t_20) {
-          if (unlikely(PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 743; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-          break;
-        }
-        __Pyx_GOTREF(__pyx_t_20);
-      }
-      __Pyx_DECREF(__pyx_v_v);
-      __pyx_v_v = __pyx_t_20;
-      __pyx_t_20 = 0;
-      __pyx_1 = __Pyx_GetName(__pyx_m, __pyx_kp_56); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 743; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-      __Pyx_GOTREF(__pyx_1);
-      __pyx_t_20 = PyTuple_New(2); if (unlikely(!__pyx_t_20)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 743; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-      __Pyx_GOTREF(((PyObject *)__pyx_t_20));
-      __Pyx_INCREF(__pyx_int_2);
-      PyTuple_SET_ITEM(__pyx_t_20, 0, __pyx_int_2);
-      __Pyx_GIVEREF(__pyx_int_2);
-      __Pyx_INCREF(__pyx_int_1);
-      PyTuple_SET_ITEM(__pyx_t_20, 1, __pyx_int_1);
-      __Pyx_GIVEREF(__pyx_int_1);
-      __pyx_t_19 = PyTuple_New(3); if (unlikely(!__pyx_t_19)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 743; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-      __Pyx_GOTREF(((PyObject *)__pyx_t_19));
-      __Pyx_INCREF(__pyx_v_v);
-      PyTuple_SET_ITEM(__pyx_t_19, 0, __pyx_v_v);
-      __Pyx_GIVEREF(__pyx_v_v);
-      __Pyx_INCREF(__pyx_v_strides);
-      PyTuple_SET_ITEM(__pyx_t_19, 1, __pyx_v_strides);
-      __Pyx_GIVEREF(__pyx_v_strides);
-      PyTuple_SET_ITEM(__pyx_t_19, 2, ((PyObject *)__pyx_t_20));
-      __Pyx_GIVEREF(((PyObject *)__pyx_t_20));
-      __pyx_t_20 = 0;
-      __pyx_t_20 = PyObject_Call(__pyx_1, ((PyObject *)__pyx_t_19), NULL); if (unlikely(!__pyx_t_20)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 743; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-      __Pyx_GOTREF(__pyx_t_20);
-      __Pyx_DECREF(__pyx_1); __pyx_1 = 0;
-      __Pyx_DECREF(((PyObject *)__pyx_t_19)); __pyx_t_19 = 0;
-      __pyx_t_8 = PyList_Append(__pyx_t_2, (PyObject*)__pyx_t_20); if (unlikely(__pyx_t_8)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 743; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-      __Pyx_DECREF(__pyx_t_20); __pyx_t_20 = 0;
-    }
-    __Pyx_DECREF(__pyx_t_6); __pyx_t_6 = 0;
-    __pyx_t_8 = PyList_Append(__pyx_t_1, (PyObject*)__pyx_t_2); if (unlikely(__pyx_t_8)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 743; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __Pyx_DECREF(((PyObject *)__pyx_t_2)); __pyx_t_2 = 0;
-  }
-  __pyx_t_2 = PyTuple_New(1); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 743; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_2));
-  __Pyx_INCREF(((PyObject *)__pyx_t_1));
-  PyTuple_SET_ITEM(__pyx_t_2, 0, ((PyObject *)__pyx_t_1));
-  __Pyx_GIVEREF(((PyObject *)__pyx_t_1));
-  __Pyx_DECREF(((PyObject *)__pyx_t_1)); __pyx_t_1 = 0;
-  __pyx_t_1 = PyObject_Call(__pyx_t_3, ((PyObject *)__pyx_t_2), NULL); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 743; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_1);
-  __Pyx_DECREF(__pyx_t_3); __pyx_t_3 = 0;
-  __Pyx_DECREF(((PyObject *)__pyx_t_2)); __pyx_t_2 = 0;
-  if (!(__Pyx_TypeTest(__pyx_t_1, __pyx_ptype_5numpy_ndarray))) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 743; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __pyx_t_23 = ((PyArrayObject *)__pyx_t_1);
-  {
-    __Pyx_BufFmt_StackElem __pyx_stack[1];
-    __Pyx_SafeReleaseBuffer(&__pyx_bstruct_d2);
-    __pyx_t_8 = __Pyx_GetBufferAndValidate(&__pyx_bstruct_d2, (PyObject*)__pyx_t_23, &__Pyx_TypeInfo_nn___pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_int_t, PyBUF_FORMAT| PyBUF_STRIDES, 2, 0, __pyx_stack);
-    if (unlikely(__pyx_t_8 < 0)) {
-      PyErr_Fetch(&__pyx_t_9, &__pyx_t_10, &__pyx_t_11);
-      if (unlikely(__Pyx_GetBufferAndValidate(&__pyx_bstruct_d2, (PyObject*)__pyx_v_d2, &__Pyx_TypeInfo_nn___pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_int_t, PyBUF_FORMAT| PyBUF_STRIDES, 2, 0, __pyx_stack) == -1)) {
-        Py_XDECREF(__pyx_t_9); Py_XDECREF(__pyx_t_10); Py_XDECREF(__pyx_t_11);
-        __Pyx_RaiseBufferFallbackError();
-      } else {
-        PyErr_Restore(__pyx_t_9, __pyx_t_10, __pyx_t_11);
-      }
-    }
-    __pyx_bstride_0_d2 = __pyx_bstruct_d2.strides[0]; __pyx_bstride_1_d2 = __pyx_bstruct_d2.strides[1];
-    __pyx_bshape_0_d2 = __pyx_bstruct_d2.shape[0]; __pyx_bshape_1_d2 = __pyx_bstruct_d2.shape[1];
-    if (unlikely(__pyx_t_8 < 0)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 743; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  }
-  __pyx_t_23 = 0;
-  __Pyx_DECREF(((PyObject *)__pyx_v_d2));
-  __pyx_v_d2 = ((PyArrayObject *)__pyx_t_1);
-  __pyx_t_1 = 0;
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":744
- * 
- *     d2 = np.array([[_convert_stride2(v, strides, (2,1)) for v in m2[i]] for i in range(m2.shape[0])])
- *     d2 = np.hstack([m2, d2])             # <<<<<<<<<<<<<<
- *     ds2 = d2.shape[0]
- * 
- */
-  __pyx_2 = __Pyx_GetName(__pyx_m, __pyx_kp_np); if (unlikely(!__pyx_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 744; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_2);
-  __pyx_t_1 = PyObject_GetAttr(__pyx_2, __pyx_kp_hstack); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 744; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_1);
-  __Pyx_DECREF(__pyx_2); __pyx_2 = 0;
-  __pyx_t_2 = PyList_New(2); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 744; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_2));
-  __Pyx_INCREF(__pyx_v_m2);
-  PyList_SET_ITEM(__pyx_t_2, 0, __pyx_v_m2);
-  __Pyx_GIVEREF(__pyx_v_m2);
-  __Pyx_INCREF(((PyObject *)__pyx_v_d2));
-  PyList_SET_ITEM(__pyx_t_2, 1, ((PyObject *)__pyx_v_d2));
-  __Pyx_GIVEREF(((PyObject *)__pyx_v_d2));
-  __pyx_t_3 = PyTuple_New(1); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 744; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_3));
-  PyTuple_SET_ITEM(__pyx_t_3, 0, ((PyObject *)__pyx_t_2));
-  __Pyx_GIVEREF(((PyObject *)__pyx_t_2));
-  __pyx_t_2 = 0;
-  __pyx_t_2 = PyObject_Call(__pyx_t_1, ((PyObject *)__pyx_t_3), NULL); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 744; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_2);
-  __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-  __Pyx_DECREF(((PyObject *)__pyx_t_3)); __pyx_t_3 = 0;
-  if (!(__Pyx_TypeTest(__pyx_t_2, __pyx_ptype_5numpy_ndarray))) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 744; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __pyx_t_23 = ((PyArrayObject *)__pyx_t_2);
-  {
-    __Pyx_BufFmt_StackElem __pyx_stack[1];
-    __Pyx_SafeReleaseBuffer(&__pyx_bstruct_d2);
-    __pyx_t_8 = __Pyx_GetBufferAndValidate(&__pyx_bstruct_d2, (PyObject*)__pyx_t_23, &__Pyx_TypeInfo_nn___pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_int_t, PyBUF_FORMAT| PyBUF_STRIDES, 2, 0, __pyx_stack);
-    if (unlikely(__pyx_t_8 < 0)) {
-      PyErr_Fetch(&__pyx_t_11, &__pyx_t_10, &__pyx_t_9);
-      if (unlikely(__Pyx_GetBufferAndValidate(&__pyx_bstruct_d2, (PyObject*)__pyx_v_d2, &__Pyx_TypeInfo_nn___pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_int_t, PyBUF_FORMAT| PyBUF_STRIDES, 2, 0, __pyx_stack) == -1)) {
-        Py_XDECREF(__pyx_t_11); Py_XDECREF(__pyx_t_10); Py_XDECREF(__pyx_t_9);
-        __Pyx_RaiseBufferFallbackError();
-      } else {
-        PyErr_Restore(__pyx_t_11, __pyx_t_10, __pyx_t_9);
-      }
-    }
-    __pyx_bstride_0_d2 = __pyx_bstruct_d2.strides[0]; __pyx_bstride_1_d2 = __pyx_bstruct_d2.strides[1];
-    __pyx_bshape_0_d2 = __pyx_bstruct_d2.shape[0]; __pyx_bshape_1_d2 = __pyx_bstruct_d2.shape[1];
-    if (unlikely(__pyx_t_8 < 0)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 744; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  }
-  __pyx_t_23 = 0;
-  __Pyx_DECREF(((PyObject *)__pyx_v_d2));
-  __pyx_v_d2 = ((PyArrayObject *)__pyx_t_2);
-  __pyx_t_2 = 0;
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":745
- *     d2 = np.array([[_convert_stride2(v, strides, (2,1)) for v in m2[i]] for i in range(m2.shape[0])])
- *     d2 = np.hstack([m2, d2])
- *     ds2 = d2.shape[0]             # <<<<<<<<<<<<<<
- * 
- *     ss0, ss1 = strides[0], strides[1]
- */
-  __pyx_v_ds2 = (__pyx_v_d2->dimensions[0]);
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":747
- *     ds2 = d2.shape[0]
- * 
- *     ss0, ss1 = strides[0], strides[1]             # <<<<<<<<<<<<<<
- *     ss0d, ss1d = dstrides[0], dstrides[1]
- * 
- */
-  __pyx_1 = __Pyx_GetItemInt(__pyx_v_strides, 0, sizeof(long), PyInt_FromLong); if (!__pyx_1) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 747; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_1);
-  __pyx_t_17 = __Pyx_PyInt_AsLong(__pyx_1); if (unlikely((__pyx_t_17 == (long)-1) && PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 747; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_DECREF(__pyx_1); __pyx_1 = 0;
-  __pyx_2 = __Pyx_GetItemInt(__pyx_v_strides, 1, sizeof(long), PyInt_FromLong); if (!__pyx_2) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 747; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_2);
-  __pyx_t_18 = __Pyx_PyInt_AsLong(__pyx_2); if (unlikely((__pyx_t_18 == (long)-1) && PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 747; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_DECREF(__pyx_2); __pyx_2 = 0;
-  __pyx_v_ss0 = __pyx_t_17;
-  __pyx_v_ss1 = __pyx_t_18;
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":748
- * 
- *     ss0, ss1 = strides[0], strides[1]
- *     ss0d, ss1d = dstrides[0], dstrides[1]             # <<<<<<<<<<<<<<
- * 
- *     D = np.zeros((4,4))
- */
-  __pyx_1 = __Pyx_GetItemInt(__pyx_v_dstrides, 0, sizeof(long), PyInt_FromLong); if (!__pyx_1) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 748; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_1);
-  __pyx_t_18 = __Pyx_PyInt_AsLong(__pyx_1); if (unlikely((__pyx_t_18 == (long)-1) && PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 748; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_DECREF(__pyx_1); __pyx_1 = 0;
-  __pyx_2 = __Pyx_GetItemInt(__pyx_v_dstrides, 1, sizeof(long), PyInt_FromLong); if (!__pyx_2) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 748; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_2);
-  __pyx_t_17 = __Pyx_PyInt_AsLong(__pyx_2); if (unlikely((__pyx_t_17 == (long)-1) && PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 748; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_DECREF(__pyx_2); __pyx_2 = 0;
-  __pyx_v_ss0d = __pyx_t_18;
-  __pyx_v_ss1d = __pyx_t_17;
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":750
- *     ss0d, ss1d = dstrides[0], dstrides[1]
- * 
- *     D = np.zeros((4,4))             # <<<<<<<<<<<<<<
- * 
- *     npix = (s0-1)*(s1-1)
- */
-  __pyx_1 = __Pyx_GetName(__pyx_m, __pyx_kp_np); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 750; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_1);
-  __pyx_t_2 = PyObject_GetAttr(__pyx_1, __pyx_kp_zeros); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 750; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_2);
-  __Pyx_DECREF(__pyx_1); __pyx_1 = 0;
-  __pyx_t_3 = PyTuple_New(2); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 750; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_3));
-  __Pyx_INCREF(__pyx_int_4);
-  PyTuple_SET_ITEM(__pyx_t_3, 0, __pyx_int_4);
-  __Pyx_GIVEREF(__pyx_int_4);
-  __Pyx_INCREF(__pyx_int_4);
-  PyTuple_SET_ITEM(__pyx_t_3, 1, __pyx_int_4);
-  __Pyx_GIVEREF(__pyx_int_4);
-  __pyx_t_1 = PyTuple_New(1); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 750; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_1));
-  PyTuple_SET_ITEM(__pyx_t_1, 0, ((PyObject *)__pyx_t_3));
-  __Pyx_GIVEREF(((PyObject *)__pyx_t_3));
-  __pyx_t_3 = 0;
-  __pyx_t_3 = PyObject_Call(__pyx_t_2, ((PyObject *)__pyx_t_1), NULL); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 750; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_3);
-  __Pyx_DECREF(__pyx_t_2); __pyx_t_2 = 0;
-  __Pyx_DECREF(((PyObject *)__pyx_t_1)); __pyx_t_1 = 0;
-  __Pyx_DECREF(__pyx_v_D);
-  __pyx_v_D = __pyx_t_3;
-  __pyx_t_3 = 0;
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":752
- *     D = np.zeros((4,4))
- * 
- *     npix = (s0-1)*(s1-1)             # <<<<<<<<<<<<<<
- * 
- *     for i in range(s0-1):
- */
-  __pyx_v_npix = ((__pyx_v_s0 - 1) * (__pyx_v_s1 - 1));
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":754
- *     npix = (s0-1)*(s1-1)
- * 
- *     for i in range(s0-1):             # <<<<<<<<<<<<<<
- *         for j in range(s1-1):
- *           pindex = i*ss0+j*ss1
- */
-  for (__pyx_t_17 = 0; __pyx_t_17 < (__pyx_v_s0 - 1); __pyx_t_17+=1) {
-    __pyx_v_i = __pyx_t_17;
-
-    /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":755
- * 
- *     for i in range(s0-1):
- *         for j in range(s1-1):             # <<<<<<<<<<<<<<
- *           pindex = i*ss0+j*ss1
- *           index = i*ss0d+j*ss1d
- */
-    for (__pyx_t_18 = 0; __pyx_t_18 < (__pyx_v_s1 - 1); __pyx_t_18+=1) {
-      __pyx_v_j = __pyx_t_18;
-
-      /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":756
- *     for i in range(s0-1):
- *         for j in range(s1-1):
- *           pindex = i*ss0+j*ss1             # <<<<<<<<<<<<<<
- *           index = i*ss0d+j*ss1d
- * 
- */
-      __pyx_t_3 = PyInt_FromLong(((__pyx_v_i * __pyx_v_ss0) + (__pyx_v_j * __pyx_v_ss1))); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 756; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-      __Pyx_GOTREF(__pyx_t_3);
-      __Pyx_DECREF(__pyx_v_pindex);
-      __pyx_v_pindex = __pyx_t_3;
-      __pyx_t_3 = 0;
-
-      /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":757
- *         for j in range(s1-1):
- *           pindex = i*ss0+j*ss1
- *           index = i*ss0d+j*ss1d             # <<<<<<<<<<<<<<
- * 
- *           for r in range(4):
- */
-      __pyx_v_index = ((__pyx_v_i * __pyx_v_ss0d) + (__pyx_v_j * __pyx_v_ss1d));
-
-      /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":759
- *           index = i*ss0d+j*ss1d
- * 
- *           for r in range(4):             # <<<<<<<<<<<<<<
- *             rr = (index+cvertices[r]) % npix
- *             mr = fmask[rr]
- */
-      for (__pyx_t_24 = 0; __pyx_t_24 < 4; __pyx_t_24+=1) {
-        __pyx_v_r = __pyx_t_24;
-
-        /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":760
- * 
- *           for r in range(4):
- *             rr = (index+cvertices[r]) % npix             # <<<<<<<<<<<<<<
- *             mr = fmask[rr]
- *             for s in range(r+1):
- */
-        __pyx_t_3 = PyInt_FromLong(__pyx_v_index); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 760; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-        __Pyx_GOTREF(__pyx_t_3);
-        __pyx_2 = __Pyx_GetItemInt(__pyx_v_cvertices, __pyx_v_r, sizeof(long), PyInt_FromLong); if (!__pyx_2) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 760; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-        __Pyx_GOTREF(__pyx_2);
-        __pyx_t_1 = PyNumber_Add(__pyx_t_3, __pyx_2); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 760; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-        __Pyx_GOTREF(__pyx_t_1);
-        __Pyx_DECREF(__pyx_t_3); __pyx_t_3 = 0;
-        __Pyx_DECREF(__pyx_2); __pyx_2 = 0;
-        __pyx_t_3 = PyInt_FromLong(__pyx_v_npix); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 760; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-        __Pyx_GOTREF(__pyx_t_3);
-        __pyx_t_2 = PyNumber_Remainder(__pyx_t_1, __pyx_t_3); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 760; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-        __Pyx_GOTREF(__pyx_t_2);
-        __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-        __Pyx_DECREF(__pyx_t_3); __pyx_t_3 = 0;
-        __pyx_t_25 = __Pyx_PyInt_AsLong(__pyx_t_2); if (unlikely((__pyx_t_25 == (long)-1) && PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 760; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-        __Pyx_DECREF(__pyx_t_2); __pyx_t_2 = 0;
-        __pyx_v_rr = __pyx_t_25;
-
-        /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":761
- *           for r in range(4):
- *             rr = (index+cvertices[r]) % npix
- *             mr = fmask[rr]             # <<<<<<<<<<<<<<
- *             for s in range(r+1):
- *               res = 0
- */
-        __pyx_t_25 = __pyx_v_rr;
-        __pyx_t_8 = -1;
-        if (__pyx_t_25 < 0) {
-          __pyx_t_25 += __pyx_bshape_0_fmask;
-          if (unlikely(__pyx_t_25 < 0)) __pyx_t_8 = 0;
-        } else if (unlikely(__pyx_t_25 >= __pyx_bshape_0_fmask)) __pyx_t_8 = 0;
-        if (unlikely(__pyx_t_8 != -1)) {
-          __Pyx_RaiseBufferIndexError(__pyx_t_8);
-          {__pyx_filename = __pyx_f[0]; __pyx_lineno = 761; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-        }
-        __pyx_v_mr = (*__Pyx_BufPtrStrided1d(__pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_int_t *, __pyx_bstruct_fmask.buf, __pyx_t_25, __pyx_bstride_0_fmask));
-
-        /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":762
- *             rr = (index+cvertices[r]) % npix
- *             mr = fmask[rr]
- *             for s in range(r+1):             # <<<<<<<<<<<<<<
- *               res = 0
- *               ss = (index+cvertices[s]) % npix
- */
-        for (__pyx_t_26 = 0; __pyx_t_26 < (__pyx_v_r + 1); __pyx_t_26+=1) {
-          __pyx_v_s = __pyx_t_26;
-
-          /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":763
- *             mr = fmask[rr]
- *             for s in range(r+1):
- *               res = 0             # <<<<<<<<<<<<<<
- *               ss = (index+cvertices[s]) % npix
- *               ms = fmask[ss]
- */
-          __pyx_v_res = 0;
-
-          /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":764
- *             for s in range(r+1):
- *               res = 0
- *               ss = (index+cvertices[s]) % npix             # <<<<<<<<<<<<<<
- *               ms = fmask[ss]
- *               if mr * ms:
- */
-          __pyx_t_2 = PyInt_FromLong(__pyx_v_index); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 764; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-          __Pyx_GOTREF(__pyx_t_2);
-          __pyx_1 = __Pyx_GetItemInt(__pyx_v_cvertices, __pyx_v_s, sizeof(long), PyInt_FromLong); if (!__pyx_1) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 764; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-          __Pyx_GOTREF(__pyx_1);
-          __pyx_t_3 = PyNumber_Add(__pyx_t_2, __pyx_1); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 764; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-          __Pyx_GOTREF(__pyx_t_3);
-          __Pyx_DECREF(__pyx_t_2); __pyx_t_2 = 0;
-          __Pyx_DECREF(__pyx_1); __pyx_1 = 0;
-          __pyx_t_2 = PyInt_FromLong(__pyx_v_npix); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 764; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-          __Pyx_GOTREF(__pyx_t_2);
-          __pyx_t_1 = PyNumber_Remainder(__pyx_t_3, __pyx_t_2); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 764; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-          __Pyx_GOTREF(__pyx_t_1);
-          __Pyx_DECREF(__pyx_t_3); __pyx_t_3 = 0;
-          __Pyx_DECREF(__pyx_t_2); __pyx_t_2 = 0;
-          __pyx_t_27 = __Pyx_PyInt_AsLong(__pyx_t_1); if (unlikely((__pyx_t_27 == (long)-1) && PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 764; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-          __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-          __pyx_v_ss = __pyx_t_27;
-
-          /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":765
- *               res = 0
- *               ss = (index+cvertices[s]) % npix
- *               ms = fmask[ss]             # <<<<<<<<<<<<<<
- *               if mr * ms:
- *                 for l in range(fcoords.shape[0]):
- */
-          __pyx_t_27 = __pyx_v_ss;
-          __pyx_t_8 = -1;
-          if (__pyx_t_27 < 0) {
-            __pyx_t_27 += __pyx_bshape_0_fmask;
-            if (unlikely(__pyx_t_27 < 0)) __pyx_t_8 = 0;
-          } else if (unlikely(__pyx_t_27 >= __pyx_bshape_0_fmask)) __pyx_t_8 = 0;
-          if (unlikely(__pyx_t_8 != -1)) {
-            __Pyx_RaiseBufferIndexError(__pyx_t_8);
-            {__pyx_filename = __pyx_f[0]; __pyx_lineno = 765; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-          }
-          __pyx_v_ms = (*__Pyx_BufPtrStrided1d(__pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_int_t *, __pyx_bstruct_fmask.buf, __pyx_t_27, __pyx_bstride_0_fmask));
-
-          /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":766
- *               ss = (index+cvertices[s]) % npix
- *               ms = fmask[ss]
- *               if mr * ms:             # <<<<<<<<<<<<<<
- *                 for l in range(fcoords.shape[0]):
- *                   res += fcoords[l,ss] * fcoords[l,rr]
- */
-          __pyx_t_28 = (__pyx_v_mr * __pyx_v_ms);
-          if (__pyx_t_28) {
-
-            /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":767
- *               ms = fmask[ss]
- *               if mr * ms:
- *                 for l in range(fcoords.shape[0]):             # <<<<<<<<<<<<<<
- *                   res += fcoords[l,ss] * fcoords[l,rr]
- *                 D[r,s] = res
- */
-            for (__pyx_t_28 = 0; __pyx_t_28 < (__pyx_v_fcoords->dimensions[0]); __pyx_t_28+=1) {
-              __pyx_v_l = __pyx_t_28;
-
-              /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":768
- *               if mr * ms:
- *                 for l in range(fcoords.shape[0]):
- *                   res += fcoords[l,ss] * fcoords[l,rr]             # <<<<<<<<<<<<<<
- *                 D[r,s] = res
- *                 D[s,r] = res
- */
-              __pyx_t_29 = __pyx_v_l;
-              __pyx_t_30 = __pyx_v_ss;
-              __pyx_t_8 = -1;
-              if (__pyx_t_29 < 0) {
-                __pyx_t_29 += __pyx_bshape_0_fcoords;
-                if (unlikely(__pyx_t_29 < 0)) __pyx_t_8 = 0;
-              } else if (unlikely(__pyx_t_29 >= __pyx_bshape_0_fcoords)) __pyx_t_8 = 0;
-              if (__pyx_t_30 < 0) {
-                __pyx_t_30 += __pyx_bshape_1_fcoords;
-                if (unlikely(__pyx_t_30 < 0)) __pyx_t_8 = 1;
-              } else if (unlikely(__pyx_t_30 >= __pyx_bshape_1_fcoords)) __pyx_t_8 = 1;
-              if (unlikely(__pyx_t_8 != -1)) {
-                __Pyx_RaiseBufferIndexError(__pyx_t_8);
-                {__pyx_filename = __pyx_f[0]; __pyx_lineno = 768; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-              }
-              __pyx_t_31 = __pyx_v_l;
-              __pyx_t_32 = __pyx_v_rr;
-              __pyx_t_8 = -1;
-              if (__pyx_t_31 < 0) {
-                __pyx_t_31 += __pyx_bshape_0_fcoords;
-                if (unlikely(__pyx_t_31 < 0)) __pyx_t_8 = 0;
-              } else if (unlikely(__pyx_t_31 >= __pyx_bshape_0_fcoords)) __pyx_t_8 = 0;
-              if (__pyx_t_32 < 0) {
-                __pyx_t_32 += __pyx_bshape_1_fcoords;
-                if (unlikely(__pyx_t_32 < 0)) __pyx_t_8 = 1;
-              } else if (unlikely(__pyx_t_32 >= __pyx_bshape_1_fcoords)) __pyx_t_8 = 1;
-              if (unlikely(__pyx_t_8 != -1)) {
-                __Pyx_RaiseBufferIndexError(__pyx_t_8);
-                {__pyx_filename = __pyx_f[0]; __pyx_lineno = 768; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-              }
-              __pyx_v_res += ((*__Pyx_BufPtrStrided2d(__pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_float_t *, __pyx_bstruct_fcoords.buf, __pyx_t_29, __pyx_bstride_0_fcoords, __pyx_t_30, __pyx_bstride_1_fcoords)) * (*__Pyx_BufPtrStrided2d(__pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_float_t *, __pyx_bstruct_fcoords.buf, __pyx_t_31, __pyx_bstride_0_fcoords, __pyx_t_32, __pyx_bstride_1_fcoords)));
-            }
-
-            /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":769
- *                 for l in range(fcoords.shape[0]):
- *                   res += fcoords[l,ss] * fcoords[l,rr]
- *                 D[r,s] = res             # <<<<<<<<<<<<<<
- *                 D[s,r] = res
- *               else:
- */
-            __pyx_t_1 = PyFloat_FromDouble(__pyx_v_res); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 769; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            __Pyx_GOTREF(__pyx_t_1);
-            __pyx_t_2 = PyInt_FromLong(__pyx_v_r); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 769; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            __Pyx_GOTREF(__pyx_t_2);
-            __pyx_t_3 = PyInt_FromLong(__pyx_v_s); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 769; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            __Pyx_GOTREF(__pyx_t_3);
-            __pyx_t_6 = PyTuple_New(2); if (unlikely(!__pyx_t_6)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 769; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            __Pyx_GOTREF(((PyObject *)__pyx_t_6));
-            PyTuple_SET_ITEM(__pyx_t_6, 0, __pyx_t_2);
-            __Pyx_GIVEREF(__pyx_t_2);
-            PyTuple_SET_ITEM(__pyx_t_6, 1, __pyx_t_3);
-            __Pyx_GIVEREF(__pyx_t_3);
-            __pyx_t_2 = 0;
-            __pyx_t_3 = 0;
-            if (PyObject_SetItem(__pyx_v_D, ((PyObject *)__pyx_t_6), __pyx_t_1) < 0) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 769; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            __Pyx_DECREF(((PyObject *)__pyx_t_6)); __pyx_t_6 = 0;
-            __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-
-            /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":770
- *                   res += fcoords[l,ss] * fcoords[l,rr]
- *                 D[r,s] = res
- *                 D[s,r] = res             # <<<<<<<<<<<<<<
- *               else:
- *                 D[r,s] = 0
- */
-            __pyx_t_1 = PyFloat_FromDouble(__pyx_v_res); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 770; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            __Pyx_GOTREF(__pyx_t_1);
-            __pyx_t_6 = PyInt_FromLong(__pyx_v_s); if (unlikely(!__pyx_t_6)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 770; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            __Pyx_GOTREF(__pyx_t_6);
-            __pyx_t_3 = PyInt_FromLong(__pyx_v_r); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 770; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            __Pyx_GOTREF(__pyx_t_3);
-            __pyx_t_2 = PyTuple_New(2); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 770; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            __Pyx_GOTREF(((PyObject *)__pyx_t_2));
-            PyTuple_SET_ITEM(__pyx_t_2, 0, __pyx_t_6);
-            __Pyx_GIVEREF(__pyx_t_6);
-            PyTuple_SET_ITEM(__pyx_t_2, 1, __pyx_t_3);
-            __Pyx_GIVEREF(__pyx_t_3);
-            __pyx_t_6 = 0;
-            __pyx_t_3 = 0;
-            if (PyObject_SetItem(__pyx_v_D, ((PyObject *)__pyx_t_2), __pyx_t_1) < 0) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 770; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            __Pyx_DECREF(((PyObject *)__pyx_t_2)); __pyx_t_2 = 0;
-            __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-            goto __pyx_L28;
-          }
-          /*else*/ {
-
-            /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":772
- *                 D[s,r] = res
- *               else:
- *                 D[r,s] = 0             # <<<<<<<<<<<<<<
- *                 D[s,r] = 0
- * 
- */
-            __pyx_t_1 = PyInt_FromLong(__pyx_v_r); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 772; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            __Pyx_GOTREF(__pyx_t_1);
-            __pyx_t_2 = PyInt_FromLong(__pyx_v_s); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 772; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            __Pyx_GOTREF(__pyx_t_2);
-            __pyx_t_3 = PyTuple_New(2); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 772; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            __Pyx_GOTREF(((PyObject *)__pyx_t_3));
-            PyTuple_SET_ITEM(__pyx_t_3, 0, __pyx_t_1);
-            __Pyx_GIVEREF(__pyx_t_1);
-            PyTuple_SET_ITEM(__pyx_t_3, 1, __pyx_t_2);
-            __Pyx_GIVEREF(__pyx_t_2);
-            __pyx_t_1 = 0;
-            __pyx_t_2 = 0;
-            if (PyObject_SetItem(__pyx_v_D, ((PyObject *)__pyx_t_3), __pyx_int_0) < 0) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 772; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            __Pyx_DECREF(((PyObject *)__pyx_t_3)); __pyx_t_3 = 0;
-
-            /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":773
- *               else:
- *                 D[r,s] = 0
- *                 D[s,r] = 0             # <<<<<<<<<<<<<<
- * 
- *           for l in range(ds3):
- */
-            __pyx_t_3 = PyInt_FromLong(__pyx_v_s); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 773; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            __Pyx_GOTREF(__pyx_t_3);
-            __pyx_t_2 = PyInt_FromLong(__pyx_v_r); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 773; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            __Pyx_GOTREF(__pyx_t_2);
-            __pyx_t_1 = PyTuple_New(2); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 773; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            __Pyx_GOTREF(((PyObject *)__pyx_t_1));
-            PyTuple_SET_ITEM(__pyx_t_1, 0, __pyx_t_3);
-            __Pyx_GIVEREF(__pyx_t_3);
-            PyTuple_SET_ITEM(__pyx_t_1, 1, __pyx_t_2);
-            __Pyx_GIVEREF(__pyx_t_2);
-            __pyx_t_3 = 0;
-            __pyx_t_2 = 0;
-            if (PyObject_SetItem(__pyx_v_D, ((PyObject *)__pyx_t_1), __pyx_int_0) < 0) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 773; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            __Pyx_DECREF(((PyObject *)__pyx_t_1)); __pyx_t_1 = 0;
-          }
-          __pyx_L28:;
-        }
-      }
-
-      /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":775
- *                 D[s,r] = 0
- * 
- *           for l in range(ds3):             # <<<<<<<<<<<<<<
- *             v0 = pindex + d3[l,0]
- *             w0 = d3[l,3]
- */
-      for (__pyx_t_24 = 0; __pyx_t_24 < __pyx_v_ds3; __pyx_t_24+=1) {
-        __pyx_v_l = __pyx_t_24;
-
-        /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":776
- * 
- *           for l in range(ds3):
- *             v0 = pindex + d3[l,0]             # <<<<<<<<<<<<<<
- *             w0 = d3[l,3]
- *             m = fpmask[v0]
- */
-        __pyx_t_26 = __pyx_v_l;
-        __pyx_t_28 = 0;
-        __pyx_t_8 = -1;
-        if (__pyx_t_26 < 0) {
-          __pyx_t_26 += __pyx_bshape_0_d3;
-          if (unlikely(__pyx_t_26 < 0)) __pyx_t_8 = 0;
-        } else if (unlikely(__pyx_t_26 >= __pyx_bshape_0_d3)) __pyx_t_8 = 0;
-        if (__pyx_t_28 < 0) {
-          __pyx_t_28 += __pyx_bshape_1_d3;
-          if (unlikely(__pyx_t_28 < 0)) __pyx_t_8 = 1;
-        } else if (unlikely(__pyx_t_28 >= __pyx_bshape_1_d3)) __pyx_t_8 = 1;
-        if (unlikely(__pyx_t_8 != -1)) {
-          __Pyx_RaiseBufferIndexError(__pyx_t_8);
-          {__pyx_filename = __pyx_f[0]; __pyx_lineno = 776; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-        }
-        __pyx_t_1 = PyInt_FromLong((*__Pyx_BufPtrStrided2d(__pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_int_t *, __pyx_bstruct_d3.buf, __pyx_t_26, __pyx_bstride_0_d3, __pyx_t_28, __pyx_bstride_1_d3))); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 776; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-        __Pyx_GOTREF(__pyx_t_1);
-        __pyx_t_2 = PyNumber_Add(__pyx_v_pindex, __pyx_t_1); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 776; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-        __Pyx_GOTREF(__pyx_t_2);
-        __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-        __pyx_t_33 = __Pyx_PyInt_AsLong(__pyx_t_2); if (unlikely((__pyx_t_33 == (long)-1) && PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 776; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-        __Pyx_DECREF(__pyx_t_2); __pyx_t_2 = 0;
-        __pyx_v_v0 = __pyx_t_33;
-
-        /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":777
- *           for l in range(ds3):
- *             v0 = pindex + d3[l,0]
- *             w0 = d3[l,3]             # <<<<<<<<<<<<<<
- *             m = fpmask[v0]
- *             if m:
- */
-        __pyx_t_33 = __pyx_v_l;
-        __pyx_t_34 = 3;
-        __pyx_t_8 = -1;
-        if (__pyx_t_33 < 0) {
-          __pyx_t_33 += __pyx_bshape_0_d3;
-          if (unlikely(__pyx_t_33 < 0)) __pyx_t_8 = 0;
-        } else if (unlikely(__pyx_t_33 >= __pyx_bshape_0_d3)) __pyx_t_8 = 0;
-        if (__pyx_t_34 < 0) {
-          __pyx_t_34 += __pyx_bshape_1_d3;
-          if (unlikely(__pyx_t_34 < 0)) __pyx_t_8 = 1;
-        } else if (unlikely(__pyx_t_34 >= __pyx_bshape_1_d3)) __pyx_t_8 = 1;
-        if (unlikely(__pyx_t_8 != -1)) {
-          __Pyx_RaiseBufferIndexError(__pyx_t_8);
-          {__pyx_filename = __pyx_f[0]; __pyx_lineno = 777; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-        }
-        __pyx_t_2 = PyInt_FromLong((*__Pyx_BufPtrStrided2d(__pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_int_t *, __pyx_bstruct_d3.buf, __pyx_t_33, __pyx_bstride_0_d3, __pyx_t_34, __pyx_bstride_1_d3))); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 777; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-        __Pyx_GOTREF(__pyx_t_2);
-        __Pyx_DECREF(__pyx_v_w0);
-        __pyx_v_w0 = __pyx_t_2;
-        __pyx_t_2 = 0;
-
-        /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":778
- *             v0 = pindex + d3[l,0]
- *             w0 = d3[l,3]
- *             m = fpmask[v0]             # <<<<<<<<<<<<<<
- *             if m:
- *               v1 = pindex + d3[l,1]
- */
-        __pyx_t_35 = __pyx_v_v0;
-        __pyx_t_8 = -1;
-        if (__pyx_t_35 < 0) {
-          __pyx_t_35 += __pyx_bshape_0_fpmask;
-          if (unlikely(__pyx_t_35 < 0)) __pyx_t_8 = 0;
-        } else if (unlikely(__pyx_t_35 >= __pyx_bshape_0_fpmask)) __pyx_t_8 = 0;
-        if (unlikely(__pyx_t_8 != -1)) {
-          __Pyx_RaiseBufferIndexError(__pyx_t_8);
-          {__pyx_filename = __pyx_f[0]; __pyx_lineno = 778; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-        }
-        __pyx_v_m = (*__Pyx_BufPtrStrided1d(__pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_int_t *, __pyx_bstruct_fpmask.buf, __pyx_t_35, __pyx_bstride_0_fpmask));
-
-        /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":779
- *             w0 = d3[l,3]
- *             m = fpmask[v0]
- *             if m:             # <<<<<<<<<<<<<<
- *               v1 = pindex + d3[l,1]
- *               v2 = pindex + d3[l,2]
- */
-        __pyx_t_36 = __pyx_v_m;
-        if (__pyx_t_36) {
-
-          /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":780
- *             m = fpmask[v0]
- *             if m:
- *               v1 = pindex + d3[l,1]             # <<<<<<<<<<<<<<
- *               v2 = pindex + d3[l,2]
- *               w1 = d3[l,4]
- */
-          __pyx_t_36 = __pyx_v_l;
-          __pyx_t_37 = 1;
-          __pyx_t_8 = -1;
-          if (__pyx_t_36 < 0) {
-            __pyx_t_36 += __pyx_bshape_0_d3;
-            if (unlikely(__pyx_t_36 < 0)) __pyx_t_8 = 0;
-          } else if (unlikely(__pyx_t_36 >= __pyx_bshape_0_d3)) __pyx_t_8 = 0;
-          if (__pyx_t_37 < 0) {
-            __pyx_t_37 += __pyx_bshape_1_d3;
-            if (unlikely(__pyx_t_37 < 0)) __pyx_t_8 = 1;
-          } else if (unlikely(__pyx_t_37 >= __pyx_bshape_1_d3)) __pyx_t_8 = 1;
-          if (unlikely(__pyx_t_8 != -1)) {
-            __Pyx_RaiseBufferIndexError(__pyx_t_8);
-            {__pyx_filename = __pyx_f[0]; __pyx_lineno = 780; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-          }
-          __pyx_t_2 = PyInt_FromLong((*__Pyx_BufPtrStrided2d(__pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_int_t *, __pyx_bstruct_d3.buf, __pyx_t_36, __pyx_bstride_0_d3, __pyx_t_37, __pyx_bstride_1_d3))); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 780; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-          __Pyx_GOTREF(__pyx_t_2);
-          __pyx_t_1 = PyNumber_Add(__pyx_v_pindex, __pyx_t_2); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 780; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-          __Pyx_GOTREF(__pyx_t_1);
-          __Pyx_DECREF(__pyx_t_2); __pyx_t_2 = 0;
-          __pyx_t_38 = __Pyx_PyInt_AsLong(__pyx_t_1); if (unlikely((__pyx_t_38 == (long)-1) && PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 780; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-          __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-          __pyx_v_v1 = __pyx_t_38;
-
-          /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":781
- *             if m:
- *               v1 = pindex + d3[l,1]
- *               v2 = pindex + d3[l,2]             # <<<<<<<<<<<<<<
- *               w1 = d3[l,4]
- *               w2 = d3[l,5]
- */
-          __pyx_t_38 = __pyx_v_l;
-          __pyx_t_39 = 2;
-          __pyx_t_8 = -1;
-          if (__pyx_t_38 < 0) {
-            __pyx_t_38 += __pyx_bshape_0_d3;
-            if (unlikely(__pyx_t_38 < 0)) __pyx_t_8 = 0;
-          } else if (unlikely(__pyx_t_38 >= __pyx_bshape_0_d3)) __pyx_t_8 = 0;
-          if (__pyx_t_39 < 0) {
-            __pyx_t_39 += __pyx_bshape_1_d3;
-            if (unlikely(__pyx_t_39 < 0)) __pyx_t_8 = 1;
-          } else if (unlikely(__pyx_t_39 >= __pyx_bshape_1_d3)) __pyx_t_8 = 1;
-          if (unlikely(__pyx_t_8 != -1)) {
-            __Pyx_RaiseBufferIndexError(__pyx_t_8);
-            {__pyx_filename = __pyx_f[0]; __pyx_lineno = 781; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-          }
-          __pyx_t_1 = PyInt_FromLong((*__Pyx_BufPtrStrided2d(__pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_int_t *, __pyx_bstruct_d3.buf, __pyx_t_38, __pyx_bstride_0_d3, __pyx_t_39, __pyx_bstride_1_d3))); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 781; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-          __Pyx_GOTREF(__pyx_t_1);
-          __pyx_t_2 = PyNumber_Add(__pyx_v_pindex, __pyx_t_1); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 781; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-          __Pyx_GOTREF(__pyx_t_2);
-          __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-          __pyx_t_40 = __Pyx_PyInt_AsLong(__pyx_t_2); if (unlikely((__pyx_t_40 == (long)-1) && PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 781; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-          __Pyx_DECREF(__pyx_t_2); __pyx_t_2 = 0;
-          __pyx_v_v2 = __pyx_t_40;
-
-          /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":782
- *               v1 = pindex + d3[l,1]
- *               v2 = pindex + d3[l,2]
- *               w1 = d3[l,4]             # <<<<<<<<<<<<<<
- *               w2 = d3[l,5]
- *               m = m * fpmask[v1] * fpmask[v2]
- */
-          __pyx_t_40 = __pyx_v_l;
-          __pyx_t_41 = 4;
-          __pyx_t_8 = -1;
-          if (__pyx_t_40 < 0) {
-            __pyx_t_40 += __pyx_bshape_0_d3;
-            if (unlikely(__pyx_t_40 < 0)) __pyx_t_8 = 0;
-          } else if (unlikely(__pyx_t_40 >= __pyx_bshape_0_d3)) __pyx_t_8 = 0;
-          if (__pyx_t_41 < 0) {
-            __pyx_t_41 += __pyx_bshape_1_d3;
-            if (unlikely(__pyx_t_41 < 0)) __pyx_t_8 = 1;
-          } else if (unlikely(__pyx_t_41 >= __pyx_bshape_1_d3)) __pyx_t_8 = 1;
-          if (unlikely(__pyx_t_8 != -1)) {
-            __Pyx_RaiseBufferIndexError(__pyx_t_8);
-            {__pyx_filename = __pyx_f[0]; __pyx_lineno = 782; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-          }
-          __pyx_t_2 = PyInt_FromLong((*__Pyx_BufPtrStrided2d(__pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_int_t *, __pyx_bstruct_d3.buf, __pyx_t_40, __pyx_bstride_0_d3, __pyx_t_41, __pyx_bstride_1_d3))); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 782; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-          __Pyx_GOTREF(__pyx_t_2);
-          __Pyx_DECREF(__pyx_v_w1);
-          __pyx_v_w1 = __pyx_t_2;
-          __pyx_t_2 = 0;
-
-          /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":783
- *               v2 = pindex + d3[l,2]
- *               w1 = d3[l,4]
- *               w2 = d3[l,5]             # <<<<<<<<<<<<<<
- *               m = m * fpmask[v1] * fpmask[v2]
- *               l2 = l2 + mu2_tri(D[w0,w0], D[w0,w1], D[w0,w2],
- */
-          __pyx_t_42 = __pyx_v_l;
-          __pyx_t_43 = 5;
-          __pyx_t_8 = -1;
-          if (__pyx_t_42 < 0) {
-            __pyx_t_42 += __pyx_bshape_0_d3;
-            if (unlikely(__pyx_t_42 < 0)) __pyx_t_8 = 0;
-          } else if (unlikely(__pyx_t_42 >= __pyx_bshape_0_d3)) __pyx_t_8 = 0;
-          if (__pyx_t_43 < 0) {
-            __pyx_t_43 += __pyx_bshape_1_d3;
-            if (unlikely(__pyx_t_43 < 0)) __pyx_t_8 = 1;
-          } else if (unlikely(__pyx_t_43 >= __pyx_bshape_1_d3)) __pyx_t_8 = 1;
-          if (unlikely(__pyx_t_8 != -1)) {
-            __Pyx_RaiseBufferIndexError(__pyx_t_8);
-            {__pyx_filename = __pyx_f[0]; __pyx_lineno = 783; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-          }
-          __pyx_t_2 = PyInt_FromLong((*__Pyx_BufPtrStrided2d(__pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_int_t *, __pyx_bstruct_d3.buf, __pyx_t_42, __pyx_bstride_0_d3, __pyx_t_43, __pyx_bstride_1_d3))); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 783; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-          __Pyx_GOTREF(__pyx_t_2);
-          __Pyx_DECREF(__pyx_v_w2);
-          __pyx_v_w2 = __pyx_t_2;
-          __pyx_t_2 = 0;
-
-          /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":784
- *               w1 = d3[l,4]
- *               w2 = d3[l,5]
- *               m = m * fpmask[v1] * fpmask[v2]             # <<<<<<<<<<<<<<
- *               l2 = l2 + mu2_tri(D[w0,w0], D[w0,w1], D[w0,w2],
- *                                 D[w1,w1], D[w1,w2], D[w2,w2]) * m
- */
-          __pyx_t_44 = __pyx_v_v1;
-          __pyx_t_8 = -1;
-          if (__pyx_t_44 < 0) {
-            __pyx_t_44 += __pyx_bshape_0_fpmask;
-            if (unlikely(__pyx_t_44 < 0)) __pyx_t_8 = 0;
-          } else if (unlikely(__pyx_t_44 >= __pyx_bshape_0_fpmask)) __pyx_t_8 = 0;
-          if (unlikely(__pyx_t_8 != -1)) {
-            __Pyx_RaiseBufferIndexError(__pyx_t_8);
-            {__pyx_filename = __pyx_f[0]; __pyx_lineno = 784; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-          }
-          __pyx_t_45 = __pyx_v_v2;
-          __pyx_t_8 = -1;
-          if (__pyx_t_45 < 0) {
-            __pyx_t_45 += __pyx_bshape_0_fpmask;
-            if (unlikely(__pyx_t_45 < 0)) __pyx_t_8 = 0;
-          } else if (unlikely(__pyx_t_45 >= __pyx_bshape_0_fpmask)) __pyx_t_8 = 0;
-          if (unlikely(__pyx_t_8 != -1)) {
-            __Pyx_RaiseBufferIndexError(__pyx_t_8);
-            {__pyx_filename = __pyx_f[0]; __pyx_lineno = 784; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-          }
-          __pyx_v_m = ((__pyx_v_m * (*__Pyx_BufPtrStrided1d(__pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_int_t *, __pyx_bstruct_fpmask.buf, __pyx_t_44, __pyx_bstride_0_fpmask))) * (*__Pyx_BufPtrStrided1d(__pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_int_t *, __pyx_bstruct_fpmask.buf, __pyx_t_45, __pyx_bstride_0_fpmask)));
-
-          /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":785
- *               w2 = d3[l,5]
- *               m = m * fpmask[v1] * fpmask[v2]
- *               l2 = l2 + mu2_tri(D[w0,w0], D[w0,w1], D[w0,w2],             # <<<<<<<<<<<<<<
- *                                 D[w1,w1], D[w1,w2], D[w2,w2]) * m
- *               l1 = l1 - mu1_tri(D[w0,w0], D[w0,w1], D[w0,w2],
- */
-          __pyx_t_2 = PyFloat_FromDouble(__pyx_v_l2); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 785; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-          __Pyx_GOTREF(__pyx_t_2);
-
-          /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":786
- *               m = m * fpmask[v1] * fpmask[v2]
- *               l2 = l2 + mu2_tri(D[w0,w0], D[w0,w1], D[w0,w2],
- *                                 D[w1,w1], D[w1,w2], D[w2,w2]) * m             # <<<<<<<<<<<<<<
- *               l1 = l1 - mu1_tri(D[w0,w0], D[w0,w1], D[w0,w2],
- *                                 D[w1,w1], D[w1,w2], D[w2,w2]) * m
- */
-          __pyx_2 = __Pyx_GetName(__pyx_m, __pyx_kp_44); if (unlikely(!__pyx_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 785; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-          __Pyx_GOTREF(__pyx_2);
-
-          /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":785
- *               w2 = d3[l,5]
- *               m = m * fpmask[v1] * fpmask[v2]
- *               l2 = l2 + mu2_tri(D[w0,w0], D[w0,w1], D[w0,w2],             # <<<<<<<<<<<<<<
- *                                 D[w1,w1], D[w1,w2], D[w2,w2]) * m
- *               l1 = l1 - mu1_tri(D[w0,w0], D[w0,w1], D[w0,w2],
- */
-          __pyx_t_1 = PyTuple_New(2); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 785; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-          __Pyx_GOTREF(((PyObject *)__pyx_t_1));
-          __Pyx_INCREF(__pyx_v_w0);
-          PyTuple_SET_ITEM(__pyx_t_1, 0, __pyx_v_w0);
-          __Pyx_GIVEREF(__pyx_v_w0);
-          __Pyx_INCREF(__pyx_v_w0);
-          PyTuple_SET_ITEM(__pyx_t_1, 1, __pyx_v_w0);
-          __Pyx_GIVEREF(__pyx_v_w0);
-          __pyx_1 = PyObject_GetItem(__pyx_v_D, ((PyObject *)__pyx_t_1)); if (!__pyx_1) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 785; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-          __Pyx_GOTREF(__pyx_1);
-          __Pyx_DECREF(((PyObject *)__pyx_t_1)); __pyx_t_1 = 0;
-          __pyx_t_1 = PyTuple_New(2); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 785; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-          __Pyx_GOTREF(((PyObject *)__pyx_t_1));
-          __Pyx_INCREF(__pyx_v_w0);
-          PyTuple_SET_ITEM(__pyx_t_1, 0, __pyx_v_w0);
-          __Pyx_GIVEREF(__pyx_v_w0);
-          __Pyx_INCREF(__pyx_v_w1);
-          PyTuple_SET_ITEM(__pyx_t_1, 1, __pyx_v_w1);
-          __Pyx_GIVEREF(__pyx_v_w1);
-          __pyx_3 = PyObject_GetItem(__pyx_v_D, ((PyObject *)__pyx_t_1)); if (!__pyx_3) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 785; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-          __Pyx_GOTREF(__pyx_3);
-          __Pyx_DECREF(((PyObject *)__pyx_t_1)); __pyx_t_1 = 0;
-          __pyx_t_1 = PyTuple_New(2); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 785; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-          __Pyx_GOTREF(((PyObject *)__pyx_t_1));
-          __Pyx_INCREF(__pyx_v_w0);
-          PyTuple_SET_ITEM(__pyx_t_1, 0, __pyx_v_w0);
-          __Pyx_GIVEREF(__pyx_v_w0);
-          __Pyx_INCREF(__pyx_v_w2);
-          PyTuple_SET_ITEM(__pyx_t_1, 1, __pyx_v_w2);
-          __Pyx_GIVEREF(__pyx_v_w2);
-          __pyx_4 = PyObject_GetItem(__pyx_v_D, ((PyObject *)__pyx_t_1)); if (!__pyx_4) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 785; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-          __Pyx_GOTREF(__pyx_4);
-          __Pyx_DECREF(((PyObject *)__pyx_t_1)); __pyx_t_1 = 0;
-
-          /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":786
- *               m = m * fpmask[v1] * fpmask[v2]
- *               l2 = l2 + mu2_tri(D[w0,w0], D[w0,w1], D[w0,w2],
- *                                 D[w1,w1], D[w1,w2], D[w2,w2]) * m             # <<<<<<<<<<<<<<
- *               l1 = l1 - mu1_tri(D[w0,w0], D[w0,w1], D[w0,w2],
- *                                 D[w1,w1], D[w1,w2], D[w2,w2]) * m
- */
-          __pyx_t_1 = PyTuple_New(2); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 786; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-          __Pyx_GOTREF(((PyObject *)__pyx_t_1));
-          __Pyx_INCREF(__pyx_v_w1);
-          PyTuple_SET_ITEM(__pyx_t_1, 0, __pyx_v_w1);
-          __Pyx_GIVEREF(__pyx_v_w1);
-          __Pyx_INCREF(__pyx_v_w1);
-          PyTuple_SET_ITEM(__pyx_t_1, 1, __pyx_v_w1);
-          __Pyx_GIVEREF(__pyx_v_w1);
-          __pyx_5 = PyObject_GetItem(__pyx_v_D, ((PyObject *)__pyx_t_1)); if (!__pyx_5) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 786; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-          __Pyx_GOTREF(__pyx_5);
-          __Pyx_DECREF(((PyObject *)__pyx_t_1)); __pyx_t_1 = 0;
-          __pyx_t_1 = PyTuple_New(2); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 786; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-          __Pyx_GOTREF(((PyObject *)__pyx_t_1));
-          __Pyx_INCREF(__pyx_v_w1);
-          PyTuple_SET_ITEM(__pyx_t_1, 0, __pyx_v_w1);
-          __Pyx_GIVEREF(__pyx_v_w1);
-          __Pyx_INCREF(__pyx_v_w2);
-          PyTuple_SET_ITEM(__pyx_t_1, 1, __pyx_v_w2);
-          __Pyx_GIVEREF(__pyx_v_w2);
-          __pyx_6 = PyObject_GetItem(__pyx_v_D, ((PyObject *)__pyx_t_1)); if (!__pyx_6) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 786; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-          __Pyx_GOTREF(__pyx_6);
-          __Pyx_DECREF(((PyObject *)__pyx_t_1)); __pyx_t_1 = 0;
-          __pyx_t_1 = PyTuple_New(2); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 786; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-          __Pyx_GOTREF(((PyObject *)__pyx_t_1));
-          __Pyx_INCREF(__pyx_v_w2);
-          PyTuple_SET_ITEM(__pyx_t_1, 0, __pyx_v_w2);
-          __Pyx_GIVEREF(__pyx_v_w2);
-          __Pyx_INCREF(__pyx_v_w2);
-          PyTuple_SET_ITEM(__pyx_t_1, 1, __pyx_v_w2);
-          __Pyx_GIVEREF(__pyx_v_w2);
-          __pyx_7 = PyObject_GetItem(__pyx_v_D, ((PyObject *)__pyx_t_1)); if (!__pyx_7) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 786; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-          __Pyx_GOTREF(__pyx_7);
-          __Pyx_DECREF(((PyObject *)__pyx_t_1)); __pyx_t_1 = 0;
-          __pyx_t_1 = PyTuple_New(6); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 785; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-          __Pyx_GOTREF(((PyObject *)__pyx_t_1));
-          PyTuple_SET_ITEM(__pyx_t_1, 0, __pyx_1);
-          __Pyx_GIVEREF(__pyx_1);
-          PyTuple_SET_ITEM(__pyx_t_1, 1, __pyx_3);
-          __Pyx_GIVEREF(__pyx_3);
-          PyTuple_SET_ITEM(__pyx_t_1, 2, __pyx_4);
-          __Pyx_GIVEREF(__pyx_4);
-          PyTuple_SET_ITEM(__pyx_t_1, 3, __pyx_5);
-          __Pyx_GIVEREF(__pyx_5);
-          PyTuple_SET_ITEM(__pyx_t_1, 4, __pyx_6);
-          __Pyx_GIVEREF(__pyx_6);
-          PyTuple_SET_ITEM(__pyx_t_1, 5, __pyx_7);
-          __Pyx_GIVEREF(__pyx_7);
-          __pyx_1 = 0;
-          __pyx_3 = 0;
-          __pyx_4 = 0;
-          __pyx_5 = 0;
-          __pyx_6 = 0;
-          __pyx_7 = 0;
-          __pyx_t_3 = PyObject_Call(__pyx_2, ((PyObject *)__pyx_t_1), NULL); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 785; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-          __Pyx_GOTREF(__pyx_t_3);
-          __Pyx_DECREF(__pyx_2); __pyx_2 = 0;
-          __Pyx_DECREF(((PyObject *)__pyx_t_1)); __pyx_t_1 = 0;
-          __pyx_t_1 = PyInt_FromLong(__pyx_v_m); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 786; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-          __Pyx_GOTREF(__pyx_t_1);
-          __pyx_t_6 = PyNumber_Multiply(__pyx_t_3, __pyx_t_1); if (unlikely(!__pyx_t_6)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 786; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-          __Pyx_GOTREF(__pyx_t_6);
-          __Pyx_DECREF(__pyx_t_3); __pyx_t_3 = 0;
-          __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-          __pyx_t_1 = PyNumber_Add(__pyx_t_2, __pyx_t_6); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 785; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-          __Pyx_GOTREF(__pyx_t_1);
-          __Pyx_DECREF(__pyx_t_2); __pyx_t_2 = 0;
-          __Pyx_DECREF(__pyx_t_6); __pyx_t_6 = 0;
-          __pyx_t_46 = __pyx_PyFloat_AsDouble(__pyx_t_1); if (unlikely(PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 785; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-          __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-          __pyx_v_l2 = __pyx_t_46;
-
-          /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":787
- *               l2 = l2 + mu2_tri(D[w0,w0], D[w0,w1], D[w0,w2],
- *                                 D[w1,w1], D[w1,w2], D[w2,w2]) * m
- *               l1 = l1 - mu1_tri(D[w0,w0], D[w0,w1], D[w0,w2],             # <<<<<<<<<<<<<<
- *                                 D[w1,w1], D[w1,w2], D[w2,w2]) * m
- *               l0 = l0 + m
- */
-          __pyx_t_1 = PyFloat_FromDouble(__pyx_v_l1); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 787; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-          __Pyx_GOTREF(__pyx_t_1);
-
-          /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":788
- *                                 D[w1,w1], D[w1,w2], D[w2,w2]) * m
- *               l1 = l1 - mu1_tri(D[w0,w0], D[w0,w1], D[w0,w2],
- *                                 D[w1,w1], D[w1,w2], D[w2,w2]) * m             # <<<<<<<<<<<<<<
- *               l0 = l0 + m
- * 
- */
-          __pyx_1 = __Pyx_GetName(__pyx_m, __pyx_kp_53); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 787; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-          __Pyx_GOTREF(__pyx_1);
-
-          /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":787
- *               l2 = l2 + mu2_tri(D[w0,w0], D[w0,w1], D[w0,w2],
- *                                 D[w1,w1], D[w1,w2], D[w2,w2]) * m
- *               l1 = l1 - mu1_tri(D[w0,w0], D[w0,w1], D[w0,w2],             # <<<<<<<<<<<<<<
- *                                 D[w1,w1], D[w1,w2], D[w2,w2]) * m
- *               l0 = l0 + m
- */
-          __pyx_t_6 = PyTuple_New(2); if (unlikely(!__pyx_t_6)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 787; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-          __Pyx_GOTREF(((PyObject *)__pyx_t_6));
-          __Pyx_INCREF(__pyx_v_w0);
-          PyTuple_SET_ITEM(__pyx_t_6, 0, __pyx_v_w0);
-          __Pyx_GIVEREF(__pyx_v_w0);
-          __Pyx_INCREF(__pyx_v_w0);
-          PyTuple_SET_ITEM(__pyx_t_6, 1, __pyx_v_w0);
-          __Pyx_GIVEREF(__pyx_v_w0);
-          __pyx_3 = PyObject_GetItem(__pyx_v_D, ((PyObject *)__pyx_t_6)); if (!__pyx_3) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 787; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-          __Pyx_GOTREF(__pyx_3);
-          __Pyx_DECREF(((PyObject *)__pyx_t_6)); __pyx_t_6 = 0;
-          __pyx_t_6 = PyTuple_New(2); if (unlikely(!__pyx_t_6)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 787; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-          __Pyx_GOTREF(((PyObject *)__pyx_t_6));
-          __Pyx_INCREF(__pyx_v_w0);
-          PyTuple_SET_ITEM(__pyx_t_6, 0, __pyx_v_w0);
-          __Pyx_GIVEREF(__pyx_v_w0);
-          __Pyx_INCREF(__pyx_v_w1);
-          PyTuple_SET_ITEM(__pyx_t_6, 1, __pyx_v_w1);
-          __Pyx_GIVEREF(__pyx_v_w1);
-          __pyx_4 = PyObject_GetItem(__pyx_v_D, ((PyObject *)__pyx_t_6)); if (!__pyx_4) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 787; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-          __Pyx_GOTREF(__pyx_4);
-          __Pyx_DECREF(((PyObject *)__pyx_t_6)); __pyx_t_6 = 0;
-          __pyx_t_6 = PyTuple_New(2); if (unlikely(!__pyx_t_6)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 787; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-          __Pyx_GOTREF(((PyObject *)__pyx_t_6));
-          __Pyx_INCREF(__pyx_v_w0);
-          PyTuple_SET_ITEM(__pyx_t_6, 0, __pyx_v_w0);
-          __Pyx_GIVEREF(__pyx_v_w0);
-          __Pyx_INCREF(__pyx_v_w2);
-          PyTuple_SET_ITEM(__pyx_t_6, 1, __pyx_v_w2);
-          __Pyx_GIVEREF(__pyx_v_w2);
-          __pyx_5 = PyObject_GetItem(__pyx_v_D, ((PyObject *)__pyx_t_6)); if (!__pyx_5) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 787; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-          __Pyx_GOTREF(__pyx_5);
-          __Pyx_DECREF(((PyObject *)__pyx_t_6)); __pyx_t_6 = 0;
-
-          /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":788
- *                                 D[w1,w1], D[w1,w2], D[w2,w2]) * m
- *               l1 = l1 - mu1_tri(D[w0,w0], D[w0,w1], D[w0,w2],
- *                                 D[w1,w1], D[w1,w2], D[w2,w2]) * m             # <<<<<<<<<<<<<<
- *               l0 = l0 + m
- * 
- */
-          __pyx_t_6 = PyTuple_New(2); if (unlikely(!__pyx_t_6)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 788; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-          __Pyx_GOTREF(((PyObject *)__pyx_t_6));
-          __Pyx_INCREF(__pyx_v_w1);
-          PyTuple_SET_ITEM(__pyx_t_6, 0, __pyx_v_w1);
-          __Pyx_GIVEREF(__pyx_v_w1);
-          __Pyx_INCREF(__pyx_v_w1);
-          PyTuple_SET_ITEM(__pyx_t_6, 1, __pyx_v_w1);
-          __Pyx_GIVEREF(__pyx_v_w1);
-          __pyx_6 = PyObject_GetItem(__pyx_v_D, ((PyObject *)__pyx_t_6)); if (!__pyx_6) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 788; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-          __Pyx_GOTREF(__pyx_6);
-          __Pyx_DECREF(((PyObject *)__pyx_t_6)); __pyx_t_6 = 0;
-          __pyx_t_6 = PyTuple_New(2); if (unlikely(!__pyx_t_6)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 788; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-          __Pyx_GOTREF(((PyObject *)__pyx_t_6));
-          __Pyx_INCREF(__pyx_v_w1);
-          PyTuple_SET_ITEM(__pyx_t_6, 0, __pyx_v_w1);
-          __Pyx_GIVEREF(__pyx_v_w1);
-          __Pyx_INCREF(__pyx_v_w2);
-          PyTuple_SET_ITEM(__pyx_t_6, 1, __pyx_v_w2);
-          __Pyx_GIVEREF(__pyx_v_w2);
-          __pyx_7 = PyObject_GetItem(__pyx_v_D, ((PyObject *)__pyx_t_6)); if (!__pyx_7) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 788; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-          __Pyx_GOTREF(__pyx_7);
-          __Pyx_DECREF(((PyObject *)__pyx_t_6)); __pyx_t_6 = 0;
-          __pyx_t_6 = PyTuple_New(2); if (unlikely(!__pyx_t_6)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 788; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-          __Pyx_GOTREF(((PyObject *)__pyx_t_6));
-          __Pyx_INCREF(__pyx_v_w2);
-          PyTuple_SET_ITEM(__pyx_t_6, 0, __pyx_v_w2);
-          __Pyx_GIVEREF(__pyx_v_w2);
-          __Pyx_INCREF(__pyx_v_w2);
-          PyTuple_SET_ITEM(__pyx_t_6, 1, __pyx_v_w2);
-          __Pyx_GIVEREF(__pyx_v_w2);
-          __pyx_2 = PyObject_GetItem(__pyx_v_D, ((PyObject *)__pyx_t_6)); if (!__pyx_2) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 788; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-          __Pyx_GOTREF(__pyx_2);
-          __Pyx_DECREF(((PyObject *)__pyx_t_6)); __pyx_t_6 = 0;
-          __pyx_t_6 = PyTuple_New(6); if (unlikely(!__pyx_t_6)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 787; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-          __Pyx_GOTREF(((PyObject *)__pyx_t_6));
-          PyTuple_SET_ITEM(__pyx_t_6, 0, __pyx_3);
-          __Pyx_GIVEREF(__pyx_3);
-          PyTuple_SET_ITEM(__pyx_t_6, 1, __pyx_4);
-          __Pyx_GIVEREF(__pyx_4);
-          PyTuple_SET_ITEM(__pyx_t_6, 2, __pyx_5);
-          __Pyx_GIVEREF(__pyx_5);
-          PyTuple_SET_ITEM(__pyx_t_6, 3, __pyx_6);
-          __Pyx_GIVEREF(__pyx_6);
-          PyTuple_SET_ITEM(__pyx_t_6, 4, __pyx_7);
-          __Pyx_GIVEREF(__pyx_7);
-          PyTuple_SET_ITEM(__pyx_t_6, 5, __pyx_2);
-          __Pyx_GIVEREF(__pyx_2);
-          __pyx_3 = 0;
-          __pyx_4 = 0;
-          __pyx_5 = 0;
-          __pyx_6 = 0;
-          __pyx_7 = 0;
-          __pyx_2 = 0;
-          __pyx_t_2 = PyObject_Call(__pyx_1, ((PyObject *)__pyx_t_6), NULL); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 787; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-          __Pyx_GOTREF(__pyx_t_2);
-          __Pyx_DECREF(__pyx_1); __pyx_1 = 0;
-          __Pyx_DECREF(((PyObject *)__pyx_t_6)); __pyx_t_6 = 0;
-          __pyx_t_6 = PyInt_FromLong(__pyx_v_m); if (unlikely(!__pyx_t_6)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 788; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-          __Pyx_GOTREF(__pyx_t_6);
-          __pyx_t_3 = PyNumber_Multiply(__pyx_t_2, __pyx_t_6); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 788; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-          __Pyx_GOTREF(__pyx_t_3);
-          __Pyx_DECREF(__pyx_t_2); __pyx_t_2 = 0;
-          __Pyx_DECREF(__pyx_t_6); __pyx_t_6 = 0;
-          __pyx_t_6 = PyNumber_Subtract(__pyx_t_1, __pyx_t_3); if (unlikely(!__pyx_t_6)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 787; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-          __Pyx_GOTREF(__pyx_t_6);
-          __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-          __Pyx_DECREF(__pyx_t_3); __pyx_t_3 = 0;
-          __pyx_t_46 = __pyx_PyFloat_AsDouble(__pyx_t_6); if (unlikely(PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 787; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-          __Pyx_DECREF(__pyx_t_6); __pyx_t_6 = 0;
-          __pyx_v_l1 = __pyx_t_46;
-
-          /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":789
- *               l1 = l1 - mu1_tri(D[w0,w0], D[w0,w1], D[w0,w2],
- *                                 D[w1,w1], D[w1,w2], D[w2,w2]) * m
- *               l0 = l0 + m             # <<<<<<<<<<<<<<
- * 
- *           for l in range(ds2):
- */
-          __pyx_v_l0 = (__pyx_v_l0 + __pyx_v_m);
-          goto __pyx_L33;
-        }
-        __pyx_L33:;
-      }
-
-      /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":791
- *               l0 = l0 + m
- * 
- *           for l in range(ds2):             # <<<<<<<<<<<<<<
- *             v0 = pindex + d2[l,0]
- *             w0 = d2[l,2]
- */
-      for (__pyx_t_24 = 0; __pyx_t_24 < __pyx_v_ds2; __pyx_t_24+=1) {
-        __pyx_v_l = __pyx_t_24;
-
-        /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":792
- * 
- *           for l in range(ds2):
- *             v0 = pindex + d2[l,0]             # <<<<<<<<<<<<<<
- *             w0 = d2[l,2]
- *             m = fpmask[v0]
- */
-        __pyx_t_47 = __pyx_v_l;
-        __pyx_t_48 = 0;
-        __pyx_t_8 = -1;
-        if (__pyx_t_47 < 0) {
-          __pyx_t_47 += __pyx_bshape_0_d2;
-          if (unlikely(__pyx_t_47 < 0)) __pyx_t_8 = 0;
-        } else if (unlikely(__pyx_t_47 >= __pyx_bshape_0_d2)) __pyx_t_8 = 0;
-        if (__pyx_t_48 < 0) {
-          __pyx_t_48 += __pyx_bshape_1_d2;
-          if (unlikely(__pyx_t_48 < 0)) __pyx_t_8 = 1;
-        } else if (unlikely(__pyx_t_48 >= __pyx_bshape_1_d2)) __pyx_t_8 = 1;
-        if (unlikely(__pyx_t_8 != -1)) {
-          __Pyx_RaiseBufferIndexError(__pyx_t_8);
-          {__pyx_filename = __pyx_f[0]; __pyx_lineno = 792; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-        }
-        __pyx_t_6 = PyInt_FromLong((*__Pyx_BufPtrStrided2d(__pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_int_t *, __pyx_bstruct_d2.buf, __pyx_t_47, __pyx_bstride_0_d2, __pyx_t_48, __pyx_bstride_1_d2))); if (unlikely(!__pyx_t_6)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 792; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-        __Pyx_GOTREF(__pyx_t_6);
-        __pyx_t_3 = PyNumber_Add(__pyx_v_pindex, __pyx_t_6); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 792; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-        __Pyx_GOTREF(__pyx_t_3);
-        __Pyx_DECREF(__pyx_t_6); __pyx_t_6 = 0;
-        __pyx_t_49 = __Pyx_PyInt_AsLong(__pyx_t_3); if (unlikely((__pyx_t_49 == (long)-1) && PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 792; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-        __Pyx_DECREF(__pyx_t_3); __pyx_t_3 = 0;
-        __pyx_v_v0 = __pyx_t_49;
-
-        /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":793
- *           for l in range(ds2):
- *             v0 = pindex + d2[l,0]
- *             w0 = d2[l,2]             # <<<<<<<<<<<<<<
- *             m = fpmask[v0]
- *             if m:
- */
-        __pyx_t_49 = __pyx_v_l;
-        __pyx_t_50 = 2;
-        __pyx_t_8 = -1;
-        if (__pyx_t_49 < 0) {
-          __pyx_t_49 += __pyx_bshape_0_d2;
-          if (unlikely(__pyx_t_49 < 0)) __pyx_t_8 = 0;
-        } else if (unlikely(__pyx_t_49 >= __pyx_bshape_0_d2)) __pyx_t_8 = 0;
-        if (__pyx_t_50 < 0) {
-          __pyx_t_50 += __pyx_bshape_1_d2;
-          if (unlikely(__pyx_t_50 < 0)) __pyx_t_8 = 1;
-        } else if (unlikely(__pyx_t_50 >= __pyx_bshape_1_d2)) __pyx_t_8 = 1;
-        if (unlikely(__pyx_t_8 != -1)) {
-          __Pyx_RaiseBufferIndexError(__pyx_t_8);
-          {__pyx_filename = __pyx_f[0]; __pyx_lineno = 793; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-        }
-        __pyx_t_3 = PyInt_FromLong((*__Pyx_BufPtrStrided2d(__pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_int_t *, __pyx_bstruct_d2.buf, __pyx_t_49, __pyx_bstride_0_d2, __pyx_t_50, __pyx_bstride_1_d2))); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 793; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-        __Pyx_GOTREF(__pyx_t_3);
-        __Pyx_DECREF(__pyx_v_w0);
-        __pyx_v_w0 = __pyx_t_3;
-        __pyx_t_3 = 0;
-
-        /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":794
- *             v0 = pindex + d2[l,0]
- *             w0 = d2[l,2]
- *             m = fpmask[v0]             # <<<<<<<<<<<<<<
- *             if m:
- *               v1 = pindex + d2[l,1]
- */
-        __pyx_t_51 = __pyx_v_v0;
-        __pyx_t_8 = -1;
-        if (__pyx_t_51 < 0) {
-          __pyx_t_51 += __pyx_bshape_0_fpmask;
-          if (unlikely(__pyx_t_51 < 0)) __pyx_t_8 = 0;
-        } else if (unlikely(__pyx_t_51 >= __pyx_bshape_0_fpmask)) __pyx_t_8 = 0;
-        if (unlikely(__pyx_t_8 != -1)) {
-          __Pyx_RaiseBufferIndexError(__pyx_t_8);
-          {__pyx_filename = __pyx_f[0]; __pyx_lineno = 794; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-        }
-        __pyx_v_m = (*__Pyx_BufPtrStrided1d(__pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_int_t *, __pyx_bstruct_fpmask.buf, __pyx_t_51, __pyx_bstride_0_fpmask));
-
-        /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":795
- *             w0 = d2[l,2]
- *             m = fpmask[v0]
- *             if m:             # <<<<<<<<<<<<<<
- *               v1 = pindex + d2[l,1]
- *               w1 = d2[l,3]
- */
-        __pyx_t_52 = __pyx_v_m;
-        if (__pyx_t_52) {
-
-          /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":796
- *             m = fpmask[v0]
- *             if m:
- *               v1 = pindex + d2[l,1]             # <<<<<<<<<<<<<<
- *               w1 = d2[l,3]
- *               m = m * fpmask[v1]
- */
-          __pyx_t_52 = __pyx_v_l;
-          __pyx_t_53 = 1;
-          __pyx_t_8 = -1;
-          if (__pyx_t_52 < 0) {
-            __pyx_t_52 += __pyx_bshape_0_d2;
-            if (unlikely(__pyx_t_52 < 0)) __pyx_t_8 = 0;
-          } else if (unlikely(__pyx_t_52 >= __pyx_bshape_0_d2)) __pyx_t_8 = 0;
-          if (__pyx_t_53 < 0) {
-            __pyx_t_53 += __pyx_bshape_1_d2;
-            if (unlikely(__pyx_t_53 < 0)) __pyx_t_8 = 1;
-          } else if (unlikely(__pyx_t_53 >= __pyx_bshape_1_d2)) __pyx_t_8 = 1;
-          if (unlikely(__pyx_t_8 != -1)) {
-            __Pyx_RaiseBufferIndexError(__pyx_t_8);
-            {__pyx_filename = __pyx_f[0]; __pyx_lineno = 796; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-          }
-          __pyx_t_3 = PyInt_FromLong((*__Pyx_BufPtrStrided2d(__pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_int_t *, __pyx_bstruct_d2.buf, __pyx_t_52, __pyx_bstride_0_d2, __pyx_t_53, __pyx_bstride_1_d2))); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 796; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-          __Pyx_GOTREF(__pyx_t_3);
-          __pyx_t_6 = PyNumber_Add(__pyx_v_pindex, __pyx_t_3); if (unlikely(!__pyx_t_6)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 796; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-          __Pyx_GOTREF(__pyx_t_6);
-          __Pyx_DECREF(__pyx_t_3); __pyx_t_3 = 0;
-          __pyx_t_54 = __Pyx_PyInt_AsLong(__pyx_t_6); if (unlikely((__pyx_t_54 == (long)-1) && PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 796; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-          __Pyx_DECREF(__pyx_t_6); __pyx_t_6 = 0;
-          __pyx_v_v1 = __pyx_t_54;
-
-          /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":797
- *             if m:
- *               v1 = pindex + d2[l,1]
- *               w1 = d2[l,3]             # <<<<<<<<<<<<<<
- *               m = m * fpmask[v1]
- *               l1 = l1 + m * mu1_edge(D[w0,w0], D[w0,w1], D[w1,w1])
- */
-          __pyx_t_54 = __pyx_v_l;
-          __pyx_t_55 = 3;
-          __pyx_t_8 = -1;
-          if (__pyx_t_54 < 0) {
-            __pyx_t_54 += __pyx_bshape_0_d2;
-            if (unlikely(__pyx_t_54 < 0)) __pyx_t_8 = 0;
-          } else if (unlikely(__pyx_t_54 >= __pyx_bshape_0_d2)) __pyx_t_8 = 0;
-          if (__pyx_t_55 < 0) {
-            __pyx_t_55 += __pyx_bshape_1_d2;
-            if (unlikely(__pyx_t_55 < 0)) __pyx_t_8 = 1;
-          } else if (unlikely(__pyx_t_55 >= __pyx_bshape_1_d2)) __pyx_t_8 = 1;
-          if (unlikely(__pyx_t_8 != -1)) {
-            __Pyx_RaiseBufferIndexError(__pyx_t_8);
-            {__pyx_filename = __pyx_f[0]; __pyx_lineno = 797; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-          }
-          __pyx_t_6 = PyInt_FromLong((*__Pyx_BufPtrStrided2d(__pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_int_t *, __pyx_bstruct_d2.buf, __pyx_t_54, __pyx_bstride_0_d2, __pyx_t_55, __pyx_bstride_1_d2))); if (unlikely(!__pyx_t_6)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 797; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-          __Pyx_GOTREF(__pyx_t_6);
-          __Pyx_DECREF(__pyx_v_w1);
-          __pyx_v_w1 = __pyx_t_6;
-          __pyx_t_6 = 0;
-
-          /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":798
- *               v1 = pindex + d2[l,1]
- *               w1 = d2[l,3]
- *               m = m * fpmask[v1]             # <<<<<<<<<<<<<<
- *               l1 = l1 + m * mu1_edge(D[w0,w0], D[w0,w1], D[w1,w1])
- *               l0 = l0 - m
- */
-          __pyx_t_56 = __pyx_v_v1;
-          __pyx_t_8 = -1;
-          if (__pyx_t_56 < 0) {
-            __pyx_t_56 += __pyx_bshape_0_fpmask;
-            if (unlikely(__pyx_t_56 < 0)) __pyx_t_8 = 0;
-          } else if (unlikely(__pyx_t_56 >= __pyx_bshape_0_fpmask)) __pyx_t_8 = 0;
-          if (unlikely(__pyx_t_8 != -1)) {
-            __Pyx_RaiseBufferIndexError(__pyx_t_8);
-            {__pyx_filename = __pyx_f[0]; __pyx_lineno = 798; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-          }
-          __pyx_v_m = (__pyx_v_m * (*__Pyx_BufPtrStrided1d(__pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_int_t *, __pyx_bstruct_fpmask.buf, __pyx_t_56, __pyx_bstride_0_fpmask)));
-
-          /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":799
- *               w1 = d2[l,3]
- *               m = m * fpmask[v1]
- *               l1 = l1 + m * mu1_edge(D[w0,w0], D[w0,w1], D[w1,w1])             # <<<<<<<<<<<<<<
- *               l0 = l0 - m
- * 
- */
-          __pyx_t_6 = PyFloat_FromDouble(__pyx_v_l1); if (unlikely(!__pyx_t_6)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 799; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-          __Pyx_GOTREF(__pyx_t_6);
-          __pyx_t_3 = PyInt_FromLong(__pyx_v_m); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 799; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-          __Pyx_GOTREF(__pyx_t_3);
-          __pyx_3 = __Pyx_GetName(__pyx_m, __pyx_kp_45); if (unlikely(!__pyx_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 799; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-          __Pyx_GOTREF(__pyx_3);
-          __pyx_t_1 = PyTuple_New(2); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 799; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-          __Pyx_GOTREF(((PyObject *)__pyx_t_1));
-          __Pyx_INCREF(__pyx_v_w0);
-          PyTuple_SET_ITEM(__pyx_t_1, 0, __pyx_v_w0);
-          __Pyx_GIVEREF(__pyx_v_w0);
-          __Pyx_INCREF(__pyx_v_w0);
-          PyTuple_SET_ITEM(__pyx_t_1, 1, __pyx_v_w0);
-          __Pyx_GIVEREF(__pyx_v_w0);
-          __pyx_4 = PyObject_GetItem(__pyx_v_D, ((PyObject *)__pyx_t_1)); if (!__pyx_4) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 799; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-          __Pyx_GOTREF(__pyx_4);
-          __Pyx_DECREF(((PyObject *)__pyx_t_1)); __pyx_t_1 = 0;
-          __pyx_t_1 = PyTuple_New(2); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 799; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-          __Pyx_GOTREF(((PyObject *)__pyx_t_1));
-          __Pyx_INCREF(__pyx_v_w0);
-          PyTuple_SET_ITEM(__pyx_t_1, 0, __pyx_v_w0);
-          __Pyx_GIVEREF(__pyx_v_w0);
-          __Pyx_INCREF(__pyx_v_w1);
-          PyTuple_SET_ITEM(__pyx_t_1, 1, __pyx_v_w1);
-          __Pyx_GIVEREF(__pyx_v_w1);
-          __pyx_5 = PyObject_GetItem(__pyx_v_D, ((PyObject *)__pyx_t_1)); if (!__pyx_5) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 799; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-          __Pyx_GOTREF(__pyx_5);
-          __Pyx_DECREF(((PyObject *)__pyx_t_1)); __pyx_t_1 = 0;
-          __pyx_t_1 = PyTuple_New(2); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 799; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-          __Pyx_GOTREF(((PyObject *)__pyx_t_1));
-          __Pyx_INCREF(__pyx_v_w1);
-          PyTuple_SET_ITEM(__pyx_t_1, 0, __pyx_v_w1);
-          __Pyx_GIVEREF(__pyx_v_w1);
-          __Pyx_INCREF(__pyx_v_w1);
-          PyTuple_SET_ITEM(__pyx_t_1, 1, __pyx_v_w1);
-          __Pyx_GIVEREF(__pyx_v_w1);
-          __pyx_6 = PyObject_GetItem(__pyx_v_D, ((PyObject *)__pyx_t_1)); if (!__pyx_6) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 799; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-          __Pyx_GOTREF(__pyx_6);
-          __Pyx_DECREF(((PyObject *)__pyx_t_1)); __pyx_t_1 = 0;
-          __pyx_t_1 = PyTuple_New(3); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 799; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-          __Pyx_GOTREF(((PyObject *)__pyx_t_1));
-          PyTuple_SET_ITEM(__pyx_t_1, 0, __pyx_4);
-          __Pyx_GIVEREF(__pyx_4);
-          PyTuple_SET_ITEM(__pyx_t_1, 1, __pyx_5);
-          __Pyx_GIVEREF(__pyx_5);
-          PyTuple_SET_ITEM(__pyx_t_1, 2, __pyx_6);
-          __Pyx_GIVEREF(__pyx_6);
-          __pyx_4 = 0;
-          __pyx_5 = 0;
-          __pyx_6 = 0;
-          __pyx_t_2 = PyObject_Call(__pyx_3, ((PyObject *)__pyx_t_1), NULL); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 799; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-          __Pyx_GOTREF(__pyx_t_2);
-          __Pyx_DECREF(__pyx_3); __pyx_3 = 0;
-          __Pyx_DECREF(((PyObject *)__pyx_t_1)); __pyx_t_1 = 0;
-          __pyx_t_1 = PyNumber_Multiply(__pyx_t_3, __pyx_t_2); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 799; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-          __Pyx_GOTREF(__pyx_t_1);
-          __Pyx_DECREF(__pyx_t_3); __pyx_t_3 = 0;
-          __Pyx_DECREF(__pyx_t_2); __pyx_t_2 = 0;
-          __pyx_t_2 = PyNumber_Add(__pyx_t_6, __pyx_t_1); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 799; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-          __Pyx_GOTREF(__pyx_t_2);
-          __Pyx_DECREF(__pyx_t_6); __pyx_t_6 = 0;
-          __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-          __pyx_t_46 = __pyx_PyFloat_AsDouble(__pyx_t_2); if (unlikely(PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 799; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-          __Pyx_DECREF(__pyx_t_2); __pyx_t_2 = 0;
-          __pyx_v_l1 = __pyx_t_46;
-
-          /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":800
- *               m = m * fpmask[v1]
- *               l1 = l1 + m * mu1_edge(D[w0,w0], D[w0,w1], D[w1,w1])
- *               l0 = l0 - m             # <<<<<<<<<<<<<<
- * 
- *     l0 += mask.sum()
- */
-          __pyx_v_l0 = (__pyx_v_l0 - __pyx_v_m);
-          goto __pyx_L36;
-        }
-        __pyx_L36:;
-      }
-    }
-  }
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":802
- *               l0 = l0 - m
- * 
- *     l0 += mask.sum()             # <<<<<<<<<<<<<<
- *     return np.array([l0,l1,l2])
- * 
- */
-  __pyx_t_2 = PyObject_GetAttr(((PyObject *)__pyx_v_mask), __pyx_kp_sum); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 802; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_2);
-  __pyx_t_1 = PyObject_Call(__pyx_t_2, ((PyObject *)__pyx_empty_tuple), NULL); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 802; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_1);
-  __Pyx_DECREF(__pyx_t_2); __pyx_t_2 = 0;
-  __pyx_t_46 = __pyx_PyFloat_AsDouble(__pyx_t_1); if (unlikely(PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 802; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-  __pyx_v_l0 += __pyx_t_46;
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":803
- * 
- *     l0 += mask.sum()
- *     return np.array([l0,l1,l2])             # <<<<<<<<<<<<<<
- * 
- * def EC2d(np.ndarray[DTYPE_int_t, ndim=2] mask):
- */
-  __Pyx_XDECREF(__pyx_r);
-  __pyx_7 = __Pyx_GetName(__pyx_m, __pyx_kp_np); if (unlikely(!__pyx_7)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 803; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_7);
-  __pyx_t_1 = PyObject_GetAttr(__pyx_7, __pyx_kp_array); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 803; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_1);
-  __Pyx_DECREF(__pyx_7); __pyx_7 = 0;
-  __pyx_t_2 = PyFloat_FromDouble(__pyx_v_l0); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 803; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_2);
-  __pyx_t_6 = PyFloat_FromDouble(__pyx_v_l1); if (unlikely(!__pyx_t_6)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 803; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_6);
-  __pyx_t_3 = PyFloat_FromDouble(__pyx_v_l2); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 803; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_3);
-  __pyx_t_20 = PyList_New(3); if (unlikely(!__pyx_t_20)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 803; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_20));
-  PyList_SET_ITEM(__pyx_t_20, 0, __pyx_t_2);
-  __Pyx_GIVEREF(__pyx_t_2);
-  PyList_SET_ITEM(__pyx_t_20, 1, __pyx_t_6);
-  __Pyx_GIVEREF(__pyx_t_6);
-  PyList_SET_ITEM(__pyx_t_20, 2, __pyx_t_3);
-  __Pyx_GIVEREF(__pyx_t_3);
-  __pyx_t_2 = 0;
-  __pyx_t_6 = 0;
-  __pyx_t_3 = 0;
-  __pyx_t_3 = PyTuple_New(1); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 803; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_3));
-  PyTuple_SET_ITEM(__pyx_t_3, 0, ((PyObject *)__pyx_t_20));
-  __Pyx_GIVEREF(((PyObject *)__pyx_t_20));
-  __pyx_t_20 = 0;
-  __pyx_t_20 = PyObject_Call(__pyx_t_1, ((PyObject *)__pyx_t_3), NULL); if (unlikely(!__pyx_t_20)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 803; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_20);
-  __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-  __Pyx_DECREF(((PyObject *)__pyx_t_3)); __pyx_t_3 = 0;
-  __pyx_r = __pyx_t_20;
-  __pyx_t_20 = 0;
-  goto __pyx_L0;
-
-  __pyx_r = Py_None; __Pyx_INCREF(Py_None);
-  goto __pyx_L0;
-  __pyx_L1_error:;
-  __Pyx_XDECREF(__pyx_1);
-  __Pyx_XDECREF(__pyx_2);
-  __Pyx_XDECREF(__pyx_3);
-  __Pyx_XDECREF(__pyx_4);
-  __Pyx_XDECREF(__pyx_5);
-  __Pyx_XDECREF(__pyx_6);
-  __Pyx_XDECREF(__pyx_7);
-  __Pyx_XDECREF(__pyx_t_1);
-  __Pyx_XDECREF(__pyx_t_2);
-  __Pyx_XDECREF(__pyx_t_3);
-  __Pyx_XDECREF(__pyx_t_6);
-  __Pyx_XDECREF(__pyx_t_19);
-  __Pyx_XDECREF(__pyx_t_20);
-  { PyObject *__pyx_type, *__pyx_value, *__pyx_tb;
-    __Pyx_ErrFetch(&__pyx_type, &__pyx_value, &__pyx_tb);
-    __Pyx_SafeReleaseBuffer(&__pyx_bstruct_mask);
-    __Pyx_SafeReleaseBuffer(&__pyx_bstruct_fpmask);
-    __Pyx_SafeReleaseBuffer(&__pyx_bstruct_d2);
-    __Pyx_SafeReleaseBuffer(&__pyx_bstruct_d3);
-    __Pyx_SafeReleaseBuffer(&__pyx_bstruct_fcoords);
-    __Pyx_SafeReleaseBuffer(&__pyx_bstruct_pmask);
-    __Pyx_SafeReleaseBuffer(&__pyx_bstruct_coords);
-    __Pyx_SafeReleaseBuffer(&__pyx_bstruct_fmask);
-  __Pyx_ErrRestore(__pyx_type, __pyx_value, __pyx_tb);}
-  __Pyx_AddTraceback("nipy.algorithms.statistics.intvol.Lips2d");
-  __pyx_r = NULL;
-  goto __pyx_L2;
-  __pyx_L0:;
-  __Pyx_SafeReleaseBuffer(&__pyx_bstruct_mask);
-  __Pyx_SafeReleaseBuffer(&__pyx_bstruct_fpmask);
-  __Pyx_SafeReleaseBuffer(&__pyx_bstruct_d2);
-  __Pyx_SafeReleaseBuffer(&__pyx_bstruct_d3);
-  __Pyx_SafeReleaseBuffer(&__pyx_bstruct_fcoords);
-  __Pyx_SafeReleaseBuffer(&__pyx_bstruct_pmask);
-  __Pyx_SafeReleaseBuffer(&__pyx_bstruct_coords);
-  __Pyx_SafeReleaseBuffer(&__pyx_bstruct_fmask);
-  __pyx_L2:;
-  __Pyx_DECREF((PyObject *)__pyx_v_fcoords);
-  __Pyx_DECREF((PyObject *)__pyx_v_fmask);
-  __Pyx_DECREF((PyObject *)__pyx_v_fpmask);
-  __Pyx_DECREF((PyObject *)__pyx_v_pmask);
-  __Pyx_DECREF((PyObject *)__pyx_v_d3);
-  __Pyx_DECREF((PyObject *)__pyx_v_d2);
-  __Pyx_DECREF(__pyx_v_l3);
-  __Pyx_DECREF(__pyx_v_n);
-  __Pyx_DECREF(__pyx_v_strides);
-  __Pyx_DECREF(__pyx_v_dstrides);
-  __Pyx_DECREF(__pyx_v_cvertices);
-  __Pyx_DECREF(__pyx_v_union);
-  __Pyx_DECREF(__pyx_v_c);
-  __Pyx_DECREF(__pyx_v_m3);
-  __Pyx_DECREF(__pyx_v_m2);
-  __Pyx_DECREF(__pyx_v_D);
-  __Pyx_DECREF(__pyx_v_pindex);
-  __Pyx_DECREF(__pyx_v_w0);
-  __Pyx_DECREF(__pyx_v_w1);
-  __Pyx_DECREF(__pyx_v_w2);
-  __Pyx_DECREF(__pyx_v_v);
-  __Pyx_XGIVEREF(__pyx_r);
-  __Pyx_FinishRefcountContext();
-  return __pyx_r;
-}
-
-/* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":805
- *     return np.array([l0,l1,l2])
- * 
- * def EC2d(np.ndarray[DTYPE_int_t, ndim=2] mask):             # <<<<<<<<<<<<<<
- *     """
- *     Given a 2d mask, compute the 0th intrinsic volume
- */
-
-static PyObject *__pyx_pf_4nipy_10algorithms_10statistics_6intvol_EC2d(PyObject *__pyx_self, PyObject *__pyx_v_mask); /*proto*/
-static char __pyx_doc_4nipy_10algorithms_10statistics_6intvol_EC2d[] = "\n    Given a 2d mask, compute the 0th intrinsic volume\n    (Euler characteristic)\n    of the masked region. The region is broken up into \n    triangles / edges / vertices, which are included based on whether\n    all voxels in the triangle / edge / vertex are\n    in the mask or not.\n\n    Parameters:\n    -----------\n\n    mask : ndarray((i,j), np.int)\n         Binary mask determining whether or not\n         a voxel is in the mask.\n\n    Outputs:\n    --------\n\n    mu0 : int\n\n    Notes:\n    ------\n\n    The array mask is assumed to be binary. At the time of \n    writing, it is not clear how to get cython to use np.bool\n    arrays.\n\n    The 3d cubes are triangulated into 6 tetrahedra of equal volume,\n    as described in the reference below.\n\n    References:\n    -----------\n\n    Taylor, J.E. & Worsley, K.J. (2007). \"Detecting sparse signal in random fields,\n      with an application to brain mapping.\"\n      Journal of the American Statistical Association, 102(479):913-928.\n\n\n    ";
-static PyObject *__pyx_pf_4nipy_10algorithms_10statistics_6intvol_EC2d(PyObject *__pyx_self, PyObject *__pyx_v_mask) {
-  PyArrayObject *__pyx_v_fmask;
-  PyArrayObject *__pyx_v_d2;
-  PyArrayObject *__pyx_v_d3;
-  long __pyx_v_i;
-  long __pyx_v_j;
-  long __pyx_v_l;
-  long __pyx_v_s0;
-  long __pyx_v_s1;
-  long __pyx_v_ds2;
-  long __pyx_v_ds3;
-  long __pyx_v_index;
-  long __pyx_v_m;
-  long __pyx_v_ss0;
-  long __pyx_v_ss1;
-  long __pyx_v_v0;
-  long __pyx_v_v1;
-  long __pyx_v_v2;
-  long __pyx_v_l0;
-  PyArrayObject *__pyx_v_pmask;
-  PyObject *__pyx_v_strides;
-  PyObject *__pyx_v_union;
-  PyObject *__pyx_v_c;
-  Py_buffer __pyx_bstruct_mask;
-  Py_ssize_t __pyx_bstride_0_mask = 0;
-  Py_ssize_t __pyx_bstride_1_mask = 0;
-  Py_ssize_t __pyx_bshape_0_mask = 0;
-  Py_ssize_t __pyx_bshape_1_mask = 0;
-  Py_buffer __pyx_bstruct_d2;
-  Py_ssize_t __pyx_bstride_0_d2 = 0;
-  Py_ssize_t __pyx_bstride_1_d2 = 0;
-  Py_ssize_t __pyx_bshape_0_d2 = 0;
-  Py_ssize_t __pyx_bshape_1_d2 = 0;
-  Py_buffer __pyx_bstruct_d3;
-  Py_ssize_t __pyx_bstride_0_d3 = 0;
-  Py_ssize_t __pyx_bstride_1_d3 = 0;
-  Py_ssize_t __pyx_bshape_0_d3 = 0;
-  Py_ssize_t __pyx_bshape_1_d3 = 0;
-  Py_buffer __pyx_bstruct_pmask;
-  Py_ssize_t __pyx_bstride_0_pmask = 0;
-  Py_ssize_t __pyx_bstride_1_pmask = 0;
-  Py_ssize_t __pyx_bshape_0_pmask = 0;
-  Py_ssize_t __pyx_bshape_1_pmask = 0;
-  Py_buffer __pyx_bstruct_fmask;
-  Py_ssize_t __pyx_bstride_0_fmask = 0;
-  Py_ssize_t __pyx_bshape_0_fmask = 0;
-  PyObject *__pyx_r = NULL;
-  PyObject *__pyx_1 = 0;
-  PyObject *__pyx_2 = 0;
-  PyObject *__pyx_t_1 = NULL;
-  PyObject *__pyx_t_2 = NULL;
-  PyObject *__pyx_t_3 = NULL;
-  int __pyx_t_4;
-  int __pyx_t_5;
-  PyObject *__pyx_t_6 = NULL;
-  PyArrayObject *__pyx_t_7 = NULL;
-  int __pyx_t_8;
-  PyObject *__pyx_t_9 = NULL;
-  PyObject *__pyx_t_10 = NULL;
-  PyObject *__pyx_t_11 = NULL;
-  npy_intp __pyx_t_12;
-  npy_intp __pyx_t_13;
-  PyArrayObject *__pyx_t_14 = NULL;
-  PyArrayObject *__pyx_t_15 = NULL;
-  PyArrayObject *__pyx_t_16 = NULL;
-  long __pyx_t_17;
-  long __pyx_t_18;
-  long __pyx_t_19;
-  long __pyx_t_20;
-  long __pyx_t_21;
-  long __pyx_t_22;
-  long __pyx_t_23;
-  long __pyx_t_24;
-  long __pyx_t_25;
-  long __pyx_t_26;
-  long __pyx_t_27;
-  long __pyx_t_28;
-  long __pyx_t_29;
-  long __pyx_t_30;
-  long __pyx_t_31;
-  long __pyx_t_32;
-  long __pyx_t_33;
-  long __pyx_t_34;
-  __Pyx_SetupRefcountContext("EC2d");
-  __pyx_self = __pyx_self;
-  __pyx_v_fmask = ((PyArrayObject *)Py_None); __Pyx_INCREF(Py_None);
-  __pyx_v_d2 = ((PyArrayObject *)Py_None); __Pyx_INCREF(Py_None);
-  __pyx_v_d3 = ((PyArrayObject *)Py_None); __Pyx_INCREF(Py_None);
-  __pyx_v_pmask = ((PyArrayObject *)Py_None); __Pyx_INCREF(Py_None);
-  __pyx_v_strides = Py_None; __Pyx_INCREF(Py_None);
-  __pyx_v_union = Py_None; __Pyx_INCREF(Py_None);
-  __pyx_v_c = Py_None; __Pyx_INCREF(Py_None);
-  __pyx_bstruct_fmask.buf = NULL;
-  __pyx_bstruct_d2.buf = NULL;
-  __pyx_bstruct_d3.buf = NULL;
-  __pyx_bstruct_pmask.buf = NULL;
-  __pyx_bstruct_mask.buf = NULL;
-  if (unlikely(!__Pyx_ArgTypeTest(((PyObject *)__pyx_v_mask), __pyx_ptype_5numpy_ndarray, 1, "mask", 0))) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 805; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  {
-    __Pyx_BufFmt_StackElem __pyx_stack[1];
-    if (unlikely(__Pyx_GetBufferAndValidate(&__pyx_bstruct_mask, (PyObject*)__pyx_v_mask, &__Pyx_TypeInfo_nn___pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_int_t, PyBUF_FORMAT| PyBUF_STRIDES, 2, 0, __pyx_stack) == -1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 805; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  }
-  __pyx_bstride_0_mask = __pyx_bstruct_mask.strides[0]; __pyx_bstride_1_mask = __pyx_bstruct_mask.strides[1];
-  __pyx_bshape_0_mask = __pyx_bstruct_mask.shape[0]; __pyx_bshape_1_mask = __pyx_bstruct_mask.shape[1];
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":846
- *     """
- * 
- *     if not set(np.unique(mask)).issubset([0,1]):             # <<<<<<<<<<<<<<
- *       raise ValueError('mask should be filled with 0/1 values, but be of type np.int')
- * 
- */
-  __pyx_1 = __Pyx_GetName(__pyx_m, __pyx_kp_np); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 846; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_1);
-  __pyx_t_1 = PyObject_GetAttr(__pyx_1, __pyx_kp_unique); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 846; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_1);
-  __Pyx_DECREF(__pyx_1); __pyx_1 = 0;
-  __pyx_t_2 = PyTuple_New(1); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 846; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_2));
-  __Pyx_INCREF(__pyx_v_mask);
-  PyTuple_SET_ITEM(__pyx_t_2, 0, __pyx_v_mask);
-  __Pyx_GIVEREF(__pyx_v_mask);
-  __pyx_t_3 = PyObject_Call(__pyx_t_1, ((PyObject *)__pyx_t_2), NULL); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 846; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_3);
-  __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-  __Pyx_DECREF(((PyObject *)__pyx_t_2)); __pyx_t_2 = 0;
-  __pyx_t_2 = PyTuple_New(1); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 846; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_2));
-  PyTuple_SET_ITEM(__pyx_t_2, 0, __pyx_t_3);
-  __Pyx_GIVEREF(__pyx_t_3);
-  __pyx_t_3 = 0;
-  __pyx_t_3 = PyObject_Call(((PyObject *)((PyObject*)&PySet_Type)), ((PyObject *)__pyx_t_2), NULL); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 846; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_3);
-  __Pyx_DECREF(((PyObject *)__pyx_t_2)); __pyx_t_2 = 0;
-  __pyx_t_2 = PyObject_GetAttr(__pyx_t_3, __pyx_kp_issubset); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 846; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_2);
-  __Pyx_DECREF(__pyx_t_3); __pyx_t_3 = 0;
-  __pyx_t_3 = PyList_New(2); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 846; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_3));
-  __Pyx_INCREF(__pyx_int_0);
-  PyList_SET_ITEM(__pyx_t_3, 0, __pyx_int_0);
-  __Pyx_GIVEREF(__pyx_int_0);
-  __Pyx_INCREF(__pyx_int_1);
-  PyList_SET_ITEM(__pyx_t_3, 1, __pyx_int_1);
-  __Pyx_GIVEREF(__pyx_int_1);
-  __pyx_t_1 = PyTuple_New(1); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 846; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_1));
-  PyTuple_SET_ITEM(__pyx_t_1, 0, ((PyObject *)__pyx_t_3));
-  __Pyx_GIVEREF(((PyObject *)__pyx_t_3));
-  __pyx_t_3 = 0;
-  __pyx_t_3 = PyObject_Call(__pyx_t_2, ((PyObject *)__pyx_t_1), NULL); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 846; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_3);
-  __Pyx_DECREF(__pyx_t_2); __pyx_t_2 = 0;
-  __Pyx_DECREF(((PyObject *)__pyx_t_1)); __pyx_t_1 = 0;
-  __pyx_t_4 = __Pyx_PyObject_IsTrue(__pyx_t_3); if (unlikely(__pyx_t_4 < 0)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 846; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_DECREF(__pyx_t_3); __pyx_t_3 = 0;
-  __pyx_t_5 = (!__pyx_t_4);
-  if (__pyx_t_5) {
-
-    /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":847
- * 
- *     if not set(np.unique(mask)).issubset([0,1]):
- *       raise ValueError('mask should be filled with 0/1 values, but be of type np.int')             # <<<<<<<<<<<<<<
- * 
- *     # 'flattened' mask (1d array)
- */
-    __pyx_t_3 = PyTuple_New(1); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 847; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __Pyx_GOTREF(((PyObject *)__pyx_t_3));
-    __Pyx_INCREF(__pyx_kp_57);
-    PyTuple_SET_ITEM(__pyx_t_3, 0, __pyx_kp_57);
-    __Pyx_GIVEREF(__pyx_kp_57);
-    __pyx_t_1 = PyObject_Call(__pyx_builtin_ValueError, ((PyObject *)__pyx_t_3), NULL); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 847; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __Pyx_GOTREF(__pyx_t_1);
-    __Pyx_DECREF(((PyObject *)__pyx_t_3)); __pyx_t_3 = 0;
-    __Pyx_Raise(__pyx_t_1, 0, 0);
-    __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-    {__pyx_filename = __pyx_f[0]; __pyx_lineno = 847; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    goto __pyx_L5;
-  }
-  __pyx_L5:;
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":862
- *     cdef long ss0, ss1, ss2 # strides
- *     cdef long v0, v1, v2, v3 # vertices
- *     cdef long l0 = 0             # <<<<<<<<<<<<<<
- * 
- *     cdef np.ndarray[DTYPE_int_t, ndim=2] pmask
- */
-  __pyx_v_l0 = 0;
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":865
- * 
- *     cdef np.ndarray[DTYPE_int_t, ndim=2] pmask
- *     pmask = np.zeros((mask.shape[0]+1, mask.shape[1]+1), np.int)             # <<<<<<<<<<<<<<
- *     pmask[:-1,:-1] = mask
- * 
- */
-  __pyx_1 = __Pyx_GetName(__pyx_m, __pyx_kp_np); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 865; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_1);
-  __pyx_t_1 = PyObject_GetAttr(__pyx_1, __pyx_kp_zeros); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 865; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_1);
-  __Pyx_DECREF(__pyx_1); __pyx_1 = 0;
-  __pyx_t_3 = PyInt_FromLong(((((PyArrayObject *)__pyx_v_mask)->dimensions[0]) + 1)); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 865; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_3);
-  __pyx_t_2 = PyInt_FromLong(((((PyArrayObject *)__pyx_v_mask)->dimensions[1]) + 1)); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 865; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_2);
-  __pyx_t_6 = PyTuple_New(2); if (unlikely(!__pyx_t_6)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 865; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_6));
-  PyTuple_SET_ITEM(__pyx_t_6, 0, __pyx_t_3);
-  __Pyx_GIVEREF(__pyx_t_3);
-  PyTuple_SET_ITEM(__pyx_t_6, 1, __pyx_t_2);
-  __Pyx_GIVEREF(__pyx_t_2);
-  __pyx_t_3 = 0;
-  __pyx_t_2 = 0;
-  __pyx_1 = __Pyx_GetName(__pyx_m, __pyx_kp_np); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 865; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_1);
-  __pyx_t_2 = PyObject_GetAttr(__pyx_1, __pyx_kp_int); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 865; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_2);
-  __Pyx_DECREF(__pyx_1); __pyx_1 = 0;
-  __pyx_t_3 = PyTuple_New(2); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 865; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_3));
-  PyTuple_SET_ITEM(__pyx_t_3, 0, ((PyObject *)__pyx_t_6));
-  __Pyx_GIVEREF(((PyObject *)__pyx_t_6));
-  PyTuple_SET_ITEM(__pyx_t_3, 1, __pyx_t_2);
-  __Pyx_GIVEREF(__pyx_t_2);
-  __pyx_t_6 = 0;
-  __pyx_t_2 = 0;
-  __pyx_t_2 = PyObject_Call(__pyx_t_1, ((PyObject *)__pyx_t_3), NULL); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 865; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_2);
-  __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-  __Pyx_DECREF(((PyObject *)__pyx_t_3)); __pyx_t_3 = 0;
-  if (!(__Pyx_TypeTest(__pyx_t_2, __pyx_ptype_5numpy_ndarray))) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 865; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __pyx_t_7 = ((PyArrayObject *)__pyx_t_2);
-  {
-    __Pyx_BufFmt_StackElem __pyx_stack[1];
-    __Pyx_SafeReleaseBuffer(&__pyx_bstruct_pmask);
-    __pyx_t_8 = __Pyx_GetBufferAndValidate(&__pyx_bstruct_pmask, (PyObject*)__pyx_t_7, &__Pyx_TypeInfo_nn___pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_int_t, PyBUF_FORMAT| PyBUF_STRIDES, 2, 0, __pyx_stack);
-    if (unlikely(__pyx_t_8 < 0)) {
-      PyErr_Fetch(&__pyx_t_9, &__pyx_t_10, &__pyx_t_11);
-      if (unlikely(__Pyx_GetBufferAndValidate(&__pyx_bstruct_pmask, (PyObject*)__pyx_v_pmask, &__Pyx_TypeInfo_nn___pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_int_t, PyBUF_FORMAT| PyBUF_STRIDES, 2, 0, __pyx_stack) == -1)) {
-        Py_XDECREF(__pyx_t_9); Py_XDECREF(__pyx_t_10); Py_XDECREF(__pyx_t_11);
-        __Pyx_RaiseBufferFallbackError();
-      } else {
-        PyErr_Restore(__pyx_t_9, __pyx_t_10, __pyx_t_11);
-      }
-    }
-    __pyx_bstride_0_pmask = __pyx_bstruct_pmask.strides[0]; __pyx_bstride_1_pmask = __pyx_bstruct_pmask.strides[1];
-    __pyx_bshape_0_pmask = __pyx_bstruct_pmask.shape[0]; __pyx_bshape_1_pmask = __pyx_bstruct_pmask.shape[1];
-    if (unlikely(__pyx_t_8 < 0)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 865; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  }
-  __pyx_t_7 = 0;
-  __Pyx_DECREF(((PyObject *)__pyx_v_pmask));
-  __pyx_v_pmask = ((PyArrayObject *)__pyx_t_2);
-  __pyx_t_2 = 0;
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":866
- *     cdef np.ndarray[DTYPE_int_t, ndim=2] pmask
- *     pmask = np.zeros((mask.shape[0]+1, mask.shape[1]+1), np.int)
- *     pmask[:-1,:-1] = mask             # <<<<<<<<<<<<<<
- * 
- *     s0, s1 = (pmask.shape[0], pmask.shape[1])
- */
-  __pyx_1 = PySlice_New(Py_None, __pyx_int_neg_1, Py_None); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 866; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_1);
-  __pyx_2 = PySlice_New(Py_None, __pyx_int_neg_1, Py_None); if (unlikely(!__pyx_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 866; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_2);
-  __pyx_t_2 = PyTuple_New(2); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 866; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_2));
-  PyTuple_SET_ITEM(__pyx_t_2, 0, __pyx_1);
-  __Pyx_GIVEREF(__pyx_1);
-  PyTuple_SET_ITEM(__pyx_t_2, 1, __pyx_2);
-  __Pyx_GIVEREF(__pyx_2);
-  __pyx_1 = 0;
-  __pyx_2 = 0;
-  if (PyObject_SetItem(((PyObject *)__pyx_v_pmask), ((PyObject *)__pyx_t_2), __pyx_v_mask) < 0) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 866; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_DECREF(((PyObject *)__pyx_t_2)); __pyx_t_2 = 0;
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":868
- *     pmask[:-1,:-1] = mask
- * 
- *     s0, s1 = (pmask.shape[0], pmask.shape[1])             # <<<<<<<<<<<<<<
- * 
- *     fmask = pmask.reshape((s0*s1))
- */
-  __pyx_t_12 = (__pyx_v_pmask->dimensions[0]);
-  __pyx_t_13 = (__pyx_v_pmask->dimensions[1]);
-  __pyx_v_s0 = __pyx_t_12;
-  __pyx_v_s1 = __pyx_t_13;
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":870
- *     s0, s1 = (pmask.shape[0], pmask.shape[1])
- * 
- *     fmask = pmask.reshape((s0*s1))             # <<<<<<<<<<<<<<
- * 
- *     strides = np.empty((s0, s1), np.bool).strides
- */
-  __pyx_t_2 = PyObject_GetAttr(((PyObject *)__pyx_v_pmask), __pyx_kp_reshape); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 870; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_2);
-  __pyx_t_3 = PyInt_FromLong((__pyx_v_s0 * __pyx_v_s1)); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 870; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_3);
-  __pyx_t_1 = PyTuple_New(1); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 870; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_1));
-  PyTuple_SET_ITEM(__pyx_t_1, 0, __pyx_t_3);
-  __Pyx_GIVEREF(__pyx_t_3);
-  __pyx_t_3 = 0;
-  __pyx_t_3 = PyObject_Call(__pyx_t_2, ((PyObject *)__pyx_t_1), NULL); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 870; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_3);
-  __Pyx_DECREF(__pyx_t_2); __pyx_t_2 = 0;
-  __Pyx_DECREF(((PyObject *)__pyx_t_1)); __pyx_t_1 = 0;
-  if (!(__Pyx_TypeTest(__pyx_t_3, __pyx_ptype_5numpy_ndarray))) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 870; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __pyx_t_14 = ((PyArrayObject *)__pyx_t_3);
-  {
-    __Pyx_BufFmt_StackElem __pyx_stack[1];
-    __Pyx_SafeReleaseBuffer(&__pyx_bstruct_fmask);
-    __pyx_t_8 = __Pyx_GetBufferAndValidate(&__pyx_bstruct_fmask, (PyObject*)__pyx_t_14, &__Pyx_TypeInfo_nn___pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_int_t, PyBUF_FORMAT| PyBUF_STRIDES, 1, 0, __pyx_stack);
-    if (unlikely(__pyx_t_8 < 0)) {
-      PyErr_Fetch(&__pyx_t_11, &__pyx_t_10, &__pyx_t_9);
-      if (unlikely(__Pyx_GetBufferAndValidate(&__pyx_bstruct_fmask, (PyObject*)__pyx_v_fmask, &__Pyx_TypeInfo_nn___pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_int_t, PyBUF_FORMAT| PyBUF_STRIDES, 1, 0, __pyx_stack) == -1)) {
-        Py_XDECREF(__pyx_t_11); Py_XDECREF(__pyx_t_10); Py_XDECREF(__pyx_t_9);
-        __Pyx_RaiseBufferFallbackError();
-      } else {
-        PyErr_Restore(__pyx_t_11, __pyx_t_10, __pyx_t_9);
-      }
-    }
-    __pyx_bstride_0_fmask = __pyx_bstruct_fmask.strides[0];
-    __pyx_bshape_0_fmask = __pyx_bstruct_fmask.shape[0];
-    if (unlikely(__pyx_t_8 < 0)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 870; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  }
-  __pyx_t_14 = 0;
-  __Pyx_DECREF(((PyObject *)__pyx_v_fmask));
-  __pyx_v_fmask = ((PyArrayObject *)__pyx_t_3);
-  __pyx_t_3 = 0;
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":872
- *     fmask = pmask.reshape((s0*s1))
- * 
- *     strides = np.empty((s0, s1), np.bool).strides             # <<<<<<<<<<<<<<
- * 
- *     # First do the interior contributions.
- */
-  __pyx_1 = __Pyx_GetName(__pyx_m, __pyx_kp_np); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 872; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_1);
-  __pyx_t_3 = PyObject_GetAttr(__pyx_1, __pyx_kp_empty); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 872; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_3);
-  __Pyx_DECREF(__pyx_1); __pyx_1 = 0;
-  __pyx_t_1 = PyInt_FromLong(__pyx_v_s0); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 872; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_1);
-  __pyx_t_2 = PyInt_FromLong(__pyx_v_s1); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 872; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_2);
-  __pyx_t_6 = PyTuple_New(2); if (unlikely(!__pyx_t_6)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 872; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_6));
-  PyTuple_SET_ITEM(__pyx_t_6, 0, __pyx_t_1);
-  __Pyx_GIVEREF(__pyx_t_1);
-  PyTuple_SET_ITEM(__pyx_t_6, 1, __pyx_t_2);
-  __Pyx_GIVEREF(__pyx_t_2);
-  __pyx_t_1 = 0;
-  __pyx_t_2 = 0;
-  __pyx_2 = __Pyx_GetName(__pyx_m, __pyx_kp_np); if (unlikely(!__pyx_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 872; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_2);
-  __pyx_t_2 = PyObject_GetAttr(__pyx_2, __pyx_kp_bool); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 872; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_2);
-  __Pyx_DECREF(__pyx_2); __pyx_2 = 0;
-  __pyx_t_1 = PyTuple_New(2); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 872; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_1));
-  PyTuple_SET_ITEM(__pyx_t_1, 0, ((PyObject *)__pyx_t_6));
-  __Pyx_GIVEREF(((PyObject *)__pyx_t_6));
-  PyTuple_SET_ITEM(__pyx_t_1, 1, __pyx_t_2);
-  __Pyx_GIVEREF(__pyx_t_2);
-  __pyx_t_6 = 0;
-  __pyx_t_2 = 0;
-  __pyx_t_2 = PyObject_Call(__pyx_t_3, ((PyObject *)__pyx_t_1), NULL); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 872; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_2);
-  __Pyx_DECREF(__pyx_t_3); __pyx_t_3 = 0;
-  __Pyx_DECREF(((PyObject *)__pyx_t_1)); __pyx_t_1 = 0;
-  __pyx_t_1 = PyObject_GetAttr(__pyx_t_2, __pyx_kp_strides); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 872; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_1);
-  __Pyx_DECREF(__pyx_t_2); __pyx_t_2 = 0;
-  __Pyx_DECREF(__pyx_v_strides);
-  __pyx_v_strides = __pyx_t_1;
-  __pyx_t_1 = 0;
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":878
- *     # are uniquely associated with an interior voxel
- * 
- *     union = join_complexes(*[cube_with_strides_center((0,1), strides),             # <<<<<<<<<<<<<<
- *                              cube_with_strides_center((1,0), strides),
- *                              cube_with_strides_center((1,1), strides)])
- */
-  __pyx_1 = __Pyx_GetName(__pyx_m, __pyx_kp_join_complexes); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 878; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_1);
-  __pyx_2 = __Pyx_GetName(__pyx_m, __pyx_kp_43); if (unlikely(!__pyx_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 878; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_2);
-  __pyx_t_1 = PyTuple_New(2); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 878; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_1));
-  __Pyx_INCREF(__pyx_int_0);
-  PyTuple_SET_ITEM(__pyx_t_1, 0, __pyx_int_0);
-  __Pyx_GIVEREF(__pyx_int_0);
-  __Pyx_INCREF(__pyx_int_1);
-  PyTuple_SET_ITEM(__pyx_t_1, 1, __pyx_int_1);
-  __Pyx_GIVEREF(__pyx_int_1);
-  __pyx_t_2 = PyTuple_New(2); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 878; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_2));
-  PyTuple_SET_ITEM(__pyx_t_2, 0, ((PyObject *)__pyx_t_1));
-  __Pyx_GIVEREF(((PyObject *)__pyx_t_1));
-  __Pyx_INCREF(__pyx_v_strides);
-  PyTuple_SET_ITEM(__pyx_t_2, 1, __pyx_v_strides);
-  __Pyx_GIVEREF(__pyx_v_strides);
-  __pyx_t_1 = 0;
-  __pyx_t_1 = PyObject_Call(__pyx_2, ((PyObject *)__pyx_t_2), NULL); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 878; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_1);
-  __Pyx_DECREF(__pyx_2); __pyx_2 = 0;
-  __Pyx_DECREF(((PyObject *)__pyx_t_2)); __pyx_t_2 = 0;
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":879
- * 
- *     union = join_complexes(*[cube_with_strides_center((0,1), strides),
- *                              cube_with_strides_center((1,0), strides),             # <<<<<<<<<<<<<<
- *                              cube_with_strides_center((1,1), strides)])
- *     c = cube_with_strides_center((0,0), strides)
- */
-  __pyx_2 = __Pyx_GetName(__pyx_m, __pyx_kp_43); if (unlikely(!__pyx_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 879; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_2);
-  __pyx_t_2 = PyTuple_New(2); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 879; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_2));
-  __Pyx_INCREF(__pyx_int_1);
-  PyTuple_SET_ITEM(__pyx_t_2, 0, __pyx_int_1);
-  __Pyx_GIVEREF(__pyx_int_1);
-  __Pyx_INCREF(__pyx_int_0);
-  PyTuple_SET_ITEM(__pyx_t_2, 1, __pyx_int_0);
-  __Pyx_GIVEREF(__pyx_int_0);
-  __pyx_t_3 = PyTuple_New(2); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 879; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_3));
-  PyTuple_SET_ITEM(__pyx_t_3, 0, ((PyObject *)__pyx_t_2));
-  __Pyx_GIVEREF(((PyObject *)__pyx_t_2));
-  __Pyx_INCREF(__pyx_v_strides);
-  PyTuple_SET_ITEM(__pyx_t_3, 1, __pyx_v_strides);
-  __Pyx_GIVEREF(__pyx_v_strides);
-  __pyx_t_2 = 0;
-  __pyx_t_2 = PyObject_Call(__pyx_2, ((PyObject *)__pyx_t_3), NULL); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 879; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_2);
-  __Pyx_DECREF(__pyx_2); __pyx_2 = 0;
-  __Pyx_DECREF(((PyObject *)__pyx_t_3)); __pyx_t_3 = 0;
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":880
- *     union = join_complexes(*[cube_with_strides_center((0,1), strides),
- *                              cube_with_strides_center((1,0), strides),
- *                              cube_with_strides_center((1,1), strides)])             # <<<<<<<<<<<<<<
- *     c = cube_with_strides_center((0,0), strides)
- * 
- */
-  __pyx_2 = __Pyx_GetName(__pyx_m, __pyx_kp_43); if (unlikely(!__pyx_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 880; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_2);
-  __pyx_t_3 = PyTuple_New(2); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 880; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_3));
-  __Pyx_INCREF(__pyx_int_1);
-  PyTuple_SET_ITEM(__pyx_t_3, 0, __pyx_int_1);
-  __Pyx_GIVEREF(__pyx_int_1);
-  __Pyx_INCREF(__pyx_int_1);
-  PyTuple_SET_ITEM(__pyx_t_3, 1, __pyx_int_1);
-  __Pyx_GIVEREF(__pyx_int_1);
-  __pyx_t_6 = PyTuple_New(2); if (unlikely(!__pyx_t_6)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 880; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_6));
-  PyTuple_SET_ITEM(__pyx_t_6, 0, ((PyObject *)__pyx_t_3));
-  __Pyx_GIVEREF(((PyObject *)__pyx_t_3));
-  __Pyx_INCREF(__pyx_v_strides);
-  PyTuple_SET_ITEM(__pyx_t_6, 1, __pyx_v_strides);
-  __Pyx_GIVEREF(__pyx_v_strides);
-  __pyx_t_3 = 0;
-  __pyx_t_3 = PyObject_Call(__pyx_2, ((PyObject *)__pyx_t_6), NULL); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 880; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_3);
-  __Pyx_DECREF(__pyx_2); __pyx_2 = 0;
-  __Pyx_DECREF(((PyObject *)__pyx_t_6)); __pyx_t_6 = 0;
-  __pyx_t_6 = PyList_New(3); if (unlikely(!__pyx_t_6)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 878; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_6));
-  PyList_SET_ITEM(__pyx_t_6, 0, __pyx_t_1);
-  __Pyx_GIVEREF(__pyx_t_1);
-  PyList_SET_ITEM(__pyx_t_6, 1, __pyx_t_2);
-  __Pyx_GIVEREF(__pyx_t_2);
-  PyList_SET_ITEM(__pyx_t_6, 2, __pyx_t_3);
-  __Pyx_GIVEREF(__pyx_t_3);
-  __pyx_t_1 = 0;
-  __pyx_t_2 = 0;
-  __pyx_t_3 = 0;
-  __pyx_2 = PySequence_Tuple(((PyObject *)__pyx_t_6)); if (unlikely(!__pyx_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 878; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_2));
-  __Pyx_DECREF(((PyObject *)__pyx_t_6)); __pyx_t_6 = 0;
-  __pyx_t_6 = PyObject_Call(__pyx_1, ((PyObject *)__pyx_2), NULL); if (unlikely(!__pyx_t_6)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 878; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_6);
-  __Pyx_DECREF(__pyx_1); __pyx_1 = 0;
-  __Pyx_DECREF(((PyObject *)__pyx_2)); __pyx_2 = 0;
-  __Pyx_DECREF(__pyx_v_union);
-  __pyx_v_union = __pyx_t_6;
-  __pyx_t_6 = 0;
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":881
- *                              cube_with_strides_center((1,0), strides),
- *                              cube_with_strides_center((1,1), strides)])
- *     c = cube_with_strides_center((0,0), strides)             # <<<<<<<<<<<<<<
- * 
- *     d3 = np.array(list(c[3].difference(union[3])))
- */
-  __pyx_1 = __Pyx_GetName(__pyx_m, __pyx_kp_43); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 881; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_1);
-  __pyx_t_6 = PyTuple_New(2); if (unlikely(!__pyx_t_6)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 881; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_6));
-  __Pyx_INCREF(__pyx_int_0);
-  PyTuple_SET_ITEM(__pyx_t_6, 0, __pyx_int_0);
-  __Pyx_GIVEREF(__pyx_int_0);
-  __Pyx_INCREF(__pyx_int_0);
-  PyTuple_SET_ITEM(__pyx_t_6, 1, __pyx_int_0);
-  __Pyx_GIVEREF(__pyx_int_0);
-  __pyx_t_3 = PyTuple_New(2); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 881; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_3));
-  PyTuple_SET_ITEM(__pyx_t_3, 0, ((PyObject *)__pyx_t_6));
-  __Pyx_GIVEREF(((PyObject *)__pyx_t_6));
-  __Pyx_INCREF(__pyx_v_strides);
-  PyTuple_SET_ITEM(__pyx_t_3, 1, __pyx_v_strides);
-  __Pyx_GIVEREF(__pyx_v_strides);
-  __pyx_t_6 = 0;
-  __pyx_t_6 = PyObject_Call(__pyx_1, ((PyObject *)__pyx_t_3), NULL); if (unlikely(!__pyx_t_6)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 881; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_6);
-  __Pyx_DECREF(__pyx_1); __pyx_1 = 0;
-  __Pyx_DECREF(((PyObject *)__pyx_t_3)); __pyx_t_3 = 0;
-  __Pyx_DECREF(__pyx_v_c);
-  __pyx_v_c = __pyx_t_6;
-  __pyx_t_6 = 0;
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":883
- *     c = cube_with_strides_center((0,0), strides)
- * 
- *     d3 = np.array(list(c[3].difference(union[3])))             # <<<<<<<<<<<<<<
- *     d2 = np.array(list(c[2].difference(union[2])))
- * 
- */
-  __pyx_2 = __Pyx_GetName(__pyx_m, __pyx_kp_np); if (unlikely(!__pyx_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 883; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_2);
-  __pyx_t_6 = PyObject_GetAttr(__pyx_2, __pyx_kp_array); if (unlikely(!__pyx_t_6)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 883; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_6);
-  __Pyx_DECREF(__pyx_2); __pyx_2 = 0;
-  __pyx_1 = __Pyx_GetItemInt(__pyx_v_c, 3, sizeof(long), PyInt_FromLong); if (!__pyx_1) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 883; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_1);
-  __pyx_t_3 = PyObject_GetAttr(__pyx_1, __pyx_kp_difference); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 883; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_3);
-  __Pyx_DECREF(__pyx_1); __pyx_1 = 0;
-  __pyx_2 = __Pyx_GetItemInt(__pyx_v_union, 3, sizeof(long), PyInt_FromLong); if (!__pyx_2) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 883; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_2);
-  __pyx_t_2 = PyTuple_New(1); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 883; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_2));
-  PyTuple_SET_ITEM(__pyx_t_2, 0, __pyx_2);
-  __Pyx_GIVEREF(__pyx_2);
-  __pyx_2 = 0;
-  __pyx_t_1 = PyObject_Call(__pyx_t_3, ((PyObject *)__pyx_t_2), NULL); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 883; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_1);
-  __Pyx_DECREF(__pyx_t_3); __pyx_t_3 = 0;
-  __Pyx_DECREF(((PyObject *)__pyx_t_2)); __pyx_t_2 = 0;
-  __pyx_t_2 = PyTuple_New(1); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 883; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_2));
-  PyTuple_SET_ITEM(__pyx_t_2, 0, __pyx_t_1);
-  __Pyx_GIVEREF(__pyx_t_1);
-  __pyx_t_1 = 0;
-  __pyx_t_1 = PyObject_Call(((PyObject *)((PyObject*)&PyList_Type)), ((PyObject *)__pyx_t_2), NULL); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 883; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_1);
-  __Pyx_DECREF(((PyObject *)__pyx_t_2)); __pyx_t_2 = 0;
-  __pyx_t_2 = PyTuple_New(1); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 883; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_2));
-  PyTuple_SET_ITEM(__pyx_t_2, 0, __pyx_t_1);
-  __Pyx_GIVEREF(__pyx_t_1);
-  __pyx_t_1 = 0;
-  __pyx_t_1 = PyObject_Call(__pyx_t_6, ((PyObject *)__pyx_t_2), NULL); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 883; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_1);
-  __Pyx_DECREF(__pyx_t_6); __pyx_t_6 = 0;
-  __Pyx_DECREF(((PyObject *)__pyx_t_2)); __pyx_t_2 = 0;
-  if (!(__Pyx_TypeTest(__pyx_t_1, __pyx_ptype_5numpy_ndarray))) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 883; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __pyx_t_15 = ((PyArrayObject *)__pyx_t_1);
-  {
-    __Pyx_BufFmt_StackElem __pyx_stack[1];
-    __Pyx_SafeReleaseBuffer(&__pyx_bstruct_d3);
-    __pyx_t_8 = __Pyx_GetBufferAndValidate(&__pyx_bstruct_d3, (PyObject*)__pyx_t_15, &__Pyx_TypeInfo_nn___pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_int_t, PyBUF_FORMAT| PyBUF_STRIDES, 2, 0, __pyx_stack);
-    if (unlikely(__pyx_t_8 < 0)) {
-      PyErr_Fetch(&__pyx_t_9, &__pyx_t_10, &__pyx_t_11);
-      if (unlikely(__Pyx_GetBufferAndValidate(&__pyx_bstruct_d3, (PyObject*)__pyx_v_d3, &__Pyx_TypeInfo_nn___pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_int_t, PyBUF_FORMAT| PyBUF_STRIDES, 2, 0, __pyx_stack) == -1)) {
-        Py_XDECREF(__pyx_t_9); Py_XDECREF(__pyx_t_10); Py_XDECREF(__pyx_t_11);
-        __Pyx_RaiseBufferFallbackError();
-      } else {
-        PyErr_Restore(__pyx_t_9, __pyx_t_10, __pyx_t_11);
-      }
-    }
-    __pyx_bstride_0_d3 = __pyx_bstruct_d3.strides[0]; __pyx_bstride_1_d3 = __pyx_bstruct_d3.strides[1];
-    __pyx_bshape_0_d3 = __pyx_bstruct_d3.shape[0]; __pyx_bshape_1_d3 = __pyx_bstruct_d3.shape[1];
-    if (unlikely(__pyx_t_8 < 0)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 883; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  }
-  __pyx_t_15 = 0;
-  __Pyx_DECREF(((PyObject *)__pyx_v_d3));
-  __pyx_v_d3 = ((PyArrayObject *)__pyx_t_1);
-  __pyx_t_1 = 0;
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":884
- * 
- *     d3 = np.array(list(c[3].difference(union[3])))
- *     d2 = np.array(list(c[2].difference(union[2])))             # <<<<<<<<<<<<<<
- * 
- *     ds2 = d2.shape[0]
- */
-  __pyx_1 = __Pyx_GetName(__pyx_m, __pyx_kp_np); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 884; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_1);
-  __pyx_t_1 = PyObject_GetAttr(__pyx_1, __pyx_kp_array); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 884; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_1);
-  __Pyx_DECREF(__pyx_1); __pyx_1 = 0;
-  __pyx_2 = __Pyx_GetItemInt(__pyx_v_c, 2, sizeof(long), PyInt_FromLong); if (!__pyx_2) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 884; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_2);
-  __pyx_t_2 = PyObject_GetAttr(__pyx_2, __pyx_kp_difference); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 884; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_2);
-  __Pyx_DECREF(__pyx_2); __pyx_2 = 0;
-  __pyx_1 = __Pyx_GetItemInt(__pyx_v_union, 2, sizeof(long), PyInt_FromLong); if (!__pyx_1) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 884; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_1);
-  __pyx_t_6 = PyTuple_New(1); if (unlikely(!__pyx_t_6)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 884; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_6));
-  PyTuple_SET_ITEM(__pyx_t_6, 0, __pyx_1);
-  __Pyx_GIVEREF(__pyx_1);
-  __pyx_1 = 0;
-  __pyx_t_3 = PyObject_Call(__pyx_t_2, ((PyObject *)__pyx_t_6), NULL); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 884; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_3);
-  __Pyx_DECREF(__pyx_t_2); __pyx_t_2 = 0;
-  __Pyx_DECREF(((PyObject *)__pyx_t_6)); __pyx_t_6 = 0;
-  __pyx_t_6 = PyTuple_New(1); if (unlikely(!__pyx_t_6)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 884; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_6));
-  PyTuple_SET_ITEM(__pyx_t_6, 0, __pyx_t_3);
-  __Pyx_GIVEREF(__pyx_t_3);
-  __pyx_t_3 = 0;
-  __pyx_t_3 = PyObject_Call(((PyObject *)((PyObject*)&PyList_Type)), ((PyObject *)__pyx_t_6), NULL); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 884; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_3);
-  __Pyx_DECREF(((PyObject *)__pyx_t_6)); __pyx_t_6 = 0;
-  __pyx_t_6 = PyTuple_New(1); if (unlikely(!__pyx_t_6)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 884; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_6));
-  PyTuple_SET_ITEM(__pyx_t_6, 0, __pyx_t_3);
-  __Pyx_GIVEREF(__pyx_t_3);
-  __pyx_t_3 = 0;
-  __pyx_t_3 = PyObject_Call(__pyx_t_1, ((PyObject *)__pyx_t_6), NULL); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 884; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_3);
-  __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-  __Pyx_DECREF(((PyObject *)__pyx_t_6)); __pyx_t_6 = 0;
-  if (!(__Pyx_TypeTest(__pyx_t_3, __pyx_ptype_5numpy_ndarray))) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 884; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __pyx_t_16 = ((PyArrayObject *)__pyx_t_3);
-  {
-    __Pyx_BufFmt_StackElem __pyx_stack[1];
-    __Pyx_SafeReleaseBuffer(&__pyx_bstruct_d2);
-    __pyx_t_8 = __Pyx_GetBufferAndValidate(&__pyx_bstruct_d2, (PyObject*)__pyx_t_16, &__Pyx_TypeInfo_nn___pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_int_t, PyBUF_FORMAT| PyBUF_STRIDES, 2, 0, __pyx_stack);
-    if (unlikely(__pyx_t_8 < 0)) {
-      PyErr_Fetch(&__pyx_t_11, &__pyx_t_10, &__pyx_t_9);
-      if (unlikely(__Pyx_GetBufferAndValidate(&__pyx_bstruct_d2, (PyObject*)__pyx_v_d2, &__Pyx_TypeInfo_nn___pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_int_t, PyBUF_FORMAT| PyBUF_STRIDES, 2, 0, __pyx_stack) == -1)) {
-        Py_XDECREF(__pyx_t_11); Py_XDECREF(__pyx_t_10); Py_XDECREF(__pyx_t_9);
-        __Pyx_RaiseBufferFallbackError();
-      } else {
-        PyErr_Restore(__pyx_t_11, __pyx_t_10, __pyx_t_9);
-      }
-    }
-    __pyx_bstride_0_d2 = __pyx_bstruct_d2.strides[0]; __pyx_bstride_1_d2 = __pyx_bstruct_d2.strides[1];
-    __pyx_bshape_0_d2 = __pyx_bstruct_d2.shape[0]; __pyx_bshape_1_d2 = __pyx_bstruct_d2.shape[1];
-    if (unlikely(__pyx_t_8 < 0)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 884; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  }
-  __pyx_t_16 = 0;
-  __Pyx_DECREF(((PyObject *)__pyx_v_d2));
-  __pyx_v_d2 = ((PyArrayObject *)__pyx_t_3);
-  __pyx_t_3 = 0;
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":886
- *     d2 = np.array(list(c[2].difference(union[2])))
- * 
- *     ds2 = d2.shape[0]             # <<<<<<<<<<<<<<
- *     ds3 = d3.shape[0]
- * 
- */
-  __pyx_v_ds2 = (__pyx_v_d2->dimensions[0]);
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":887
- * 
- *     ds2 = d2.shape[0]
- *     ds3 = d3.shape[0]             # <<<<<<<<<<<<<<
- * 
- *     ss0 = strides[0]
- */
-  __pyx_v_ds3 = (__pyx_v_d3->dimensions[0]);
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":889
- *     ds3 = d3.shape[0]
- * 
- *     ss0 = strides[0]             # <<<<<<<<<<<<<<
- *     ss1 = strides[1]
- * 
- */
-  __pyx_2 = __Pyx_GetItemInt(__pyx_v_strides, 0, sizeof(long), PyInt_FromLong); if (!__pyx_2) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 889; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_2);
-  __pyx_t_17 = __Pyx_PyInt_AsLong(__pyx_2); if (unlikely((__pyx_t_17 == (long)-1) && PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 889; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_DECREF(__pyx_2); __pyx_2 = 0;
-  __pyx_v_ss0 = __pyx_t_17;
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":890
- * 
- *     ss0 = strides[0]
- *     ss1 = strides[1]             # <<<<<<<<<<<<<<
- * 
- *     for i in range(s0-1):
- */
-  __pyx_1 = __Pyx_GetItemInt(__pyx_v_strides, 1, sizeof(long), PyInt_FromLong); if (!__pyx_1) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 890; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_1);
-  __pyx_t_17 = __Pyx_PyInt_AsLong(__pyx_1); if (unlikely((__pyx_t_17 == (long)-1) && PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 890; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_DECREF(__pyx_1); __pyx_1 = 0;
-  __pyx_v_ss1 = __pyx_t_17;
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":892
- *     ss1 = strides[1]
- * 
- *     for i in range(s0-1):             # <<<<<<<<<<<<<<
- *         for j in range(s1-1):
- *           index = i*ss0+j*ss1
- */
-  for (__pyx_t_17 = 0; __pyx_t_17 < (__pyx_v_s0 - 1); __pyx_t_17+=1) {
-    __pyx_v_i = __pyx_t_17;
-
-    /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":893
- * 
- *     for i in range(s0-1):
- *         for j in range(s1-1):             # <<<<<<<<<<<<<<
- *           index = i*ss0+j*ss1
- * 
- */
-    for (__pyx_t_18 = 0; __pyx_t_18 < (__pyx_v_s1 - 1); __pyx_t_18+=1) {
-      __pyx_v_j = __pyx_t_18;
-
-      /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":894
- *     for i in range(s0-1):
- *         for j in range(s1-1):
- *           index = i*ss0+j*ss1             # <<<<<<<<<<<<<<
- * 
- *           for l in range(ds3):
- */
-      __pyx_v_index = ((__pyx_v_i * __pyx_v_ss0) + (__pyx_v_j * __pyx_v_ss1));
-
-      /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":896
- *           index = i*ss0+j*ss1
- * 
- *           for l in range(ds3):             # <<<<<<<<<<<<<<
- *             v0 = index + d3[l,0]
- *             m = fmask[v0]
- */
-      for (__pyx_t_19 = 0; __pyx_t_19 < __pyx_v_ds3; __pyx_t_19+=1) {
-        __pyx_v_l = __pyx_t_19;
-
-        /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":897
- * 
- *           for l in range(ds3):
- *             v0 = index + d3[l,0]             # <<<<<<<<<<<<<<
- *             m = fmask[v0]
- *             if m and v0:
- */
-        __pyx_t_20 = __pyx_v_l;
-        __pyx_t_21 = 0;
-        __pyx_t_8 = -1;
-        if (__pyx_t_20 < 0) {
-          __pyx_t_20 += __pyx_bshape_0_d3;
-          if (unlikely(__pyx_t_20 < 0)) __pyx_t_8 = 0;
-        } else if (unlikely(__pyx_t_20 >= __pyx_bshape_0_d3)) __pyx_t_8 = 0;
-        if (__pyx_t_21 < 0) {
-          __pyx_t_21 += __pyx_bshape_1_d3;
-          if (unlikely(__pyx_t_21 < 0)) __pyx_t_8 = 1;
-        } else if (unlikely(__pyx_t_21 >= __pyx_bshape_1_d3)) __pyx_t_8 = 1;
-        if (unlikely(__pyx_t_8 != -1)) {
-          __Pyx_RaiseBufferIndexError(__pyx_t_8);
-          {__pyx_filename = __pyx_f[0]; __pyx_lineno = 897; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-        }
-        __pyx_v_v0 = (__pyx_v_index + (*__Pyx_BufPtrStrided2d(__pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_int_t *, __pyx_bstruct_d3.buf, __pyx_t_20, __pyx_bstride_0_d3, __pyx_t_21, __pyx_bstride_1_d3)));
-
-        /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":898
- *           for l in range(ds3):
- *             v0 = index + d3[l,0]
- *             m = fmask[v0]             # <<<<<<<<<<<<<<
- *             if m and v0:
- *               v1 = index + d3[l,1]
- */
-        __pyx_t_22 = __pyx_v_v0;
-        __pyx_t_8 = -1;
-        if (__pyx_t_22 < 0) {
-          __pyx_t_22 += __pyx_bshape_0_fmask;
-          if (unlikely(__pyx_t_22 < 0)) __pyx_t_8 = 0;
-        } else if (unlikely(__pyx_t_22 >= __pyx_bshape_0_fmask)) __pyx_t_8 = 0;
-        if (unlikely(__pyx_t_8 != -1)) {
-          __Pyx_RaiseBufferIndexError(__pyx_t_8);
-          {__pyx_filename = __pyx_f[0]; __pyx_lineno = 898; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-        }
-        __pyx_v_m = (*__Pyx_BufPtrStrided1d(__pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_int_t *, __pyx_bstruct_fmask.buf, __pyx_t_22, __pyx_bstride_0_fmask));
-
-        /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":899
- *             v0 = index + d3[l,0]
- *             m = fmask[v0]
- *             if m and v0:             # <<<<<<<<<<<<<<
- *               v1 = index + d3[l,1]
- *               v2 = index + d3[l,2]
- */
-        if (__pyx_v_m) {
-          __pyx_t_5 = __pyx_v_v0;
-        } else {
-          __pyx_t_5 = __pyx_v_m;
-        }
-        if (__pyx_t_5) {
-
-          /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":900
- *             m = fmask[v0]
- *             if m and v0:
- *               v1 = index + d3[l,1]             # <<<<<<<<<<<<<<
- *               v2 = index + d3[l,2]
- *               m = m * fmask[v1] * fmask[v2]
- */
-          __pyx_t_23 = __pyx_v_l;
-          __pyx_t_24 = 1;
-          __pyx_t_8 = -1;
-          if (__pyx_t_23 < 0) {
-            __pyx_t_23 += __pyx_bshape_0_d3;
-            if (unlikely(__pyx_t_23 < 0)) __pyx_t_8 = 0;
-          } else if (unlikely(__pyx_t_23 >= __pyx_bshape_0_d3)) __pyx_t_8 = 0;
-          if (__pyx_t_24 < 0) {
-            __pyx_t_24 += __pyx_bshape_1_d3;
-            if (unlikely(__pyx_t_24 < 0)) __pyx_t_8 = 1;
-          } else if (unlikely(__pyx_t_24 >= __pyx_bshape_1_d3)) __pyx_t_8 = 1;
-          if (unlikely(__pyx_t_8 != -1)) {
-            __Pyx_RaiseBufferIndexError(__pyx_t_8);
-            {__pyx_filename = __pyx_f[0]; __pyx_lineno = 900; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-          }
-          __pyx_v_v1 = (__pyx_v_index + (*__Pyx_BufPtrStrided2d(__pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_int_t *, __pyx_bstruct_d3.buf, __pyx_t_23, __pyx_bstride_0_d3, __pyx_t_24, __pyx_bstride_1_d3)));
-
-          /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":901
- *             if m and v0:
- *               v1 = index + d3[l,1]
- *               v2 = index + d3[l,2]             # <<<<<<<<<<<<<<
- *               m = m * fmask[v1] * fmask[v2]
- *               l0 = l0 + m
- */
-          __pyx_t_25 = __pyx_v_l;
-          __pyx_t_26 = 2;
-          __pyx_t_8 = -1;
-          if (__pyx_t_25 < 0) {
-            __pyx_t_25 += __pyx_bshape_0_d3;
-            if (unlikely(__pyx_t_25 < 0)) __pyx_t_8 = 0;
-          } else if (unlikely(__pyx_t_25 >= __pyx_bshape_0_d3)) __pyx_t_8 = 0;
-          if (__pyx_t_26 < 0) {
-            __pyx_t_26 += __pyx_bshape_1_d3;
-            if (unlikely(__pyx_t_26 < 0)) __pyx_t_8 = 1;
-          } else if (unlikely(__pyx_t_26 >= __pyx_bshape_1_d3)) __pyx_t_8 = 1;
-          if (unlikely(__pyx_t_8 != -1)) {
-            __Pyx_RaiseBufferIndexError(__pyx_t_8);
-            {__pyx_filename = __pyx_f[0]; __pyx_lineno = 901; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-          }
-          __pyx_v_v2 = (__pyx_v_index + (*__Pyx_BufPtrStrided2d(__pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_int_t *, __pyx_bstruct_d3.buf, __pyx_t_25, __pyx_bstride_0_d3, __pyx_t_26, __pyx_bstride_1_d3)));
-
-          /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":902
- *               v1 = index + d3[l,1]
- *               v2 = index + d3[l,2]
- *               m = m * fmask[v1] * fmask[v2]             # <<<<<<<<<<<<<<
- *               l0 = l0 + m
- * 
- */
-          __pyx_t_27 = __pyx_v_v1;
-          __pyx_t_8 = -1;
-          if (__pyx_t_27 < 0) {
-            __pyx_t_27 += __pyx_bshape_0_fmask;
-            if (unlikely(__pyx_t_27 < 0)) __pyx_t_8 = 0;
-          } else if (unlikely(__pyx_t_27 >= __pyx_bshape_0_fmask)) __pyx_t_8 = 0;
-          if (unlikely(__pyx_t_8 != -1)) {
-            __Pyx_RaiseBufferIndexError(__pyx_t_8);
-            {__pyx_filename = __pyx_f[0]; __pyx_lineno = 902; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-          }
-          __pyx_t_28 = __pyx_v_v2;
-          __pyx_t_8 = -1;
-          if (__pyx_t_28 < 0) {
-            __pyx_t_28 += __pyx_bshape_0_fmask;
-            if (unlikely(__pyx_t_28 < 0)) __pyx_t_8 = 0;
-          } else if (unlikely(__pyx_t_28 >= __pyx_bshape_0_fmask)) __pyx_t_8 = 0;
-          if (unlikely(__pyx_t_8 != -1)) {
-            __Pyx_RaiseBufferIndexError(__pyx_t_8);
-            {__pyx_filename = __pyx_f[0]; __pyx_lineno = 902; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-          }
-          __pyx_v_m = ((__pyx_v_m * (*__Pyx_BufPtrStrided1d(__pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_int_t *, __pyx_bstruct_fmask.buf, __pyx_t_27, __pyx_bstride_0_fmask))) * (*__Pyx_BufPtrStrided1d(__pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_int_t *, __pyx_bstruct_fmask.buf, __pyx_t_28, __pyx_bstride_0_fmask)));
-
-          /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":903
- *               v2 = index + d3[l,2]
- *               m = m * fmask[v1] * fmask[v2]
- *               l0 = l0 + m             # <<<<<<<<<<<<<<
- * 
- *           for l in range(ds2):
- */
-          __pyx_v_l0 = (__pyx_v_l0 + __pyx_v_m);
-          goto __pyx_L12;
-        }
-        __pyx_L12:;
-      }
-
-      /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":905
- *               l0 = l0 + m
- * 
- *           for l in range(ds2):             # <<<<<<<<<<<<<<
- *             v0 = index + d2[l,0]
- *             m = fmask[v0]
- */
-      for (__pyx_t_19 = 0; __pyx_t_19 < __pyx_v_ds2; __pyx_t_19+=1) {
-        __pyx_v_l = __pyx_t_19;
-
-        /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":906
- * 
- *           for l in range(ds2):
- *             v0 = index + d2[l,0]             # <<<<<<<<<<<<<<
- *             m = fmask[v0]
- *             if m:
- */
-        __pyx_t_29 = __pyx_v_l;
-        __pyx_t_30 = 0;
-        __pyx_t_8 = -1;
-        if (__pyx_t_29 < 0) {
-          __pyx_t_29 += __pyx_bshape_0_d2;
-          if (unlikely(__pyx_t_29 < 0)) __pyx_t_8 = 0;
-        } else if (unlikely(__pyx_t_29 >= __pyx_bshape_0_d2)) __pyx_t_8 = 0;
-        if (__pyx_t_30 < 0) {
-          __pyx_t_30 += __pyx_bshape_1_d2;
-          if (unlikely(__pyx_t_30 < 0)) __pyx_t_8 = 1;
-        } else if (unlikely(__pyx_t_30 >= __pyx_bshape_1_d2)) __pyx_t_8 = 1;
-        if (unlikely(__pyx_t_8 != -1)) {
-          __Pyx_RaiseBufferIndexError(__pyx_t_8);
-          {__pyx_filename = __pyx_f[0]; __pyx_lineno = 906; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-        }
-        __pyx_v_v0 = (__pyx_v_index + (*__Pyx_BufPtrStrided2d(__pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_int_t *, __pyx_bstruct_d2.buf, __pyx_t_29, __pyx_bstride_0_d2, __pyx_t_30, __pyx_bstride_1_d2)));
-
-        /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":907
- *           for l in range(ds2):
- *             v0 = index + d2[l,0]
- *             m = fmask[v0]             # <<<<<<<<<<<<<<
- *             if m:
- *               v1 = index + d2[l,1]
- */
-        __pyx_t_31 = __pyx_v_v0;
-        __pyx_t_8 = -1;
-        if (__pyx_t_31 < 0) {
-          __pyx_t_31 += __pyx_bshape_0_fmask;
-          if (unlikely(__pyx_t_31 < 0)) __pyx_t_8 = 0;
-        } else if (unlikely(__pyx_t_31 >= __pyx_bshape_0_fmask)) __pyx_t_8 = 0;
-        if (unlikely(__pyx_t_8 != -1)) {
-          __Pyx_RaiseBufferIndexError(__pyx_t_8);
-          {__pyx_filename = __pyx_f[0]; __pyx_lineno = 907; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-        }
-        __pyx_v_m = (*__Pyx_BufPtrStrided1d(__pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_int_t *, __pyx_bstruct_fmask.buf, __pyx_t_31, __pyx_bstride_0_fmask));
-
-        /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":908
- *             v0 = index + d2[l,0]
- *             m = fmask[v0]
- *             if m:             # <<<<<<<<<<<<<<
- *               v1 = index + d2[l,1]
- *               m = m * fmask[v1]
- */
-        __pyx_t_32 = __pyx_v_m;
-        if (__pyx_t_32) {
-
-          /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":909
- *             m = fmask[v0]
- *             if m:
- *               v1 = index + d2[l,1]             # <<<<<<<<<<<<<<
- *               m = m * fmask[v1]
- *               l0 = l0 - m
- */
-          __pyx_t_32 = __pyx_v_l;
-          __pyx_t_33 = 1;
-          __pyx_t_8 = -1;
-          if (__pyx_t_32 < 0) {
-            __pyx_t_32 += __pyx_bshape_0_d2;
-            if (unlikely(__pyx_t_32 < 0)) __pyx_t_8 = 0;
-          } else if (unlikely(__pyx_t_32 >= __pyx_bshape_0_d2)) __pyx_t_8 = 0;
-          if (__pyx_t_33 < 0) {
-            __pyx_t_33 += __pyx_bshape_1_d2;
-            if (unlikely(__pyx_t_33 < 0)) __pyx_t_8 = 1;
-          } else if (unlikely(__pyx_t_33 >= __pyx_bshape_1_d2)) __pyx_t_8 = 1;
-          if (unlikely(__pyx_t_8 != -1)) {
-            __Pyx_RaiseBufferIndexError(__pyx_t_8);
-            {__pyx_filename = __pyx_f[0]; __pyx_lineno = 909; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-          }
-          __pyx_v_v1 = (__pyx_v_index + (*__Pyx_BufPtrStrided2d(__pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_int_t *, __pyx_bstruct_d2.buf, __pyx_t_32, __pyx_bstride_0_d2, __pyx_t_33, __pyx_bstride_1_d2)));
-
-          /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":910
- *             if m:
- *               v1 = index + d2[l,1]
- *               m = m * fmask[v1]             # <<<<<<<<<<<<<<
- *               l0 = l0 - m
- *     l0 += mask.sum()
- */
-          __pyx_t_34 = __pyx_v_v1;
-          __pyx_t_8 = -1;
-          if (__pyx_t_34 < 0) {
-            __pyx_t_34 += __pyx_bshape_0_fmask;
-            if (unlikely(__pyx_t_34 < 0)) __pyx_t_8 = 0;
-          } else if (unlikely(__pyx_t_34 >= __pyx_bshape_0_fmask)) __pyx_t_8 = 0;
-          if (unlikely(__pyx_t_8 != -1)) {
-            __Pyx_RaiseBufferIndexError(__pyx_t_8);
-            {__pyx_filename = __pyx_f[0]; __pyx_lineno = 910; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-          }
-          __pyx_v_m = (__pyx_v_m * (*__Pyx_BufPtrStrided1d(__pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_int_t *, __pyx_bstruct_fmask.buf, __pyx_t_34, __pyx_bstride_0_fmask)));
-
-          /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":911
- *               v1 = index + d2[l,1]
- *               m = m * fmask[v1]
- *               l0 = l0 - m             # <<<<<<<<<<<<<<
- *     l0 += mask.sum()
- *     return l0
- */
-          __pyx_v_l0 = (__pyx_v_l0 - __pyx_v_m);
-          goto __pyx_L15;
-        }
-        __pyx_L15:;
-      }
-    }
-  }
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":912
- *               m = m * fmask[v1]
- *               l0 = l0 - m
- *     l0 += mask.sum()             # <<<<<<<<<<<<<<
- *     return l0
- * 
- */
-  __pyx_t_3 = PyObject_GetAttr(__pyx_v_mask, __pyx_kp_sum); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 912; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_3);
-  __pyx_t_6 = PyObject_Call(__pyx_t_3, ((PyObject *)__pyx_empty_tuple), NULL); if (unlikely(!__pyx_t_6)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 912; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_6);
-  __Pyx_DECREF(__pyx_t_3); __pyx_t_3 = 0;
-  __pyx_t_17 = __Pyx_PyInt_AsLong(__pyx_t_6); if (unlikely((__pyx_t_17 == (long)-1) && PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 912; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_DECREF(__pyx_t_6); __pyx_t_6 = 0;
-  __pyx_v_l0 += __pyx_t_17;
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":913
- *               l0 = l0 - m
- *     l0 += mask.sum()
- *     return l0             # <<<<<<<<<<<<<<
- * 
- * def Lips1d(np.ndarray[DTYPE_float_t, ndim=2] coords,
- */
-  __Pyx_XDECREF(__pyx_r);
-  __pyx_t_6 = PyInt_FromLong(__pyx_v_l0); if (unlikely(!__pyx_t_6)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 913; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_6);
-  __pyx_r = __pyx_t_6;
-  __pyx_t_6 = 0;
-  goto __pyx_L0;
-
-  __pyx_r = Py_None; __Pyx_INCREF(Py_None);
-  goto __pyx_L0;
-  __pyx_L1_error:;
-  __Pyx_XDECREF(__pyx_1);
-  __Pyx_XDECREF(__pyx_2);
-  __Pyx_XDECREF(__pyx_t_1);
-  __Pyx_XDECREF(__pyx_t_2);
-  __Pyx_XDECREF(__pyx_t_3);
-  __Pyx_XDECREF(__pyx_t_6);
-  { PyObject *__pyx_type, *__pyx_value, *__pyx_tb;
-    __Pyx_ErrFetch(&__pyx_type, &__pyx_value, &__pyx_tb);
-    __Pyx_SafeReleaseBuffer(&__pyx_bstruct_mask);
-    __Pyx_SafeReleaseBuffer(&__pyx_bstruct_d2);
-    __Pyx_SafeReleaseBuffer(&__pyx_bstruct_d3);
-    __Pyx_SafeReleaseBuffer(&__pyx_bstruct_pmask);
-    __Pyx_SafeReleaseBuffer(&__pyx_bstruct_fmask);
-  __Pyx_ErrRestore(__pyx_type, __pyx_value, __pyx_tb);}
-  __Pyx_AddTraceback("nipy.algorithms.statistics.intvol.EC2d");
-  __pyx_r = NULL;
-  goto __pyx_L2;
-  __pyx_L0:;
-  __Pyx_SafeReleaseBuffer(&__pyx_bstruct_mask);
-  __Pyx_SafeReleaseBuffer(&__pyx_bstruct_d2);
-  __Pyx_SafeReleaseBuffer(&__pyx_bstruct_d3);
-  __Pyx_SafeReleaseBuffer(&__pyx_bstruct_pmask);
-  __Pyx_SafeReleaseBuffer(&__pyx_bstruct_fmask);
-  __pyx_L2:;
-  __Pyx_DECREF((PyObject *)__pyx_v_fmask);
-  __Pyx_DECREF((PyObject *)__pyx_v_d2);
-  __Pyx_DECREF((PyObject *)__pyx_v_d3);
-  __Pyx_DECREF((PyObject *)__pyx_v_pmask);
-  __Pyx_DECREF(__pyx_v_strides);
-  __Pyx_DECREF(__pyx_v_union);
-  __Pyx_DECREF(__pyx_v_c);
-  __Pyx_XGIVEREF(__pyx_r);
-  __Pyx_FinishRefcountContext();
-  return __pyx_r;
-}
-
-/* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":915
- *     return l0
- * 
- * def Lips1d(np.ndarray[DTYPE_float_t, ndim=2] coords,             # <<<<<<<<<<<<<<
- *            np.ndarray[DTYPE_int_t, ndim=1] mask):
- *     """
- */
-
-static PyObject *__pyx_pf_4nipy_10algorithms_10statistics_6intvol_Lips1d(PyObject *__pyx_self, PyObject *__pyx_args, PyObject *__pyx_kwds); /*proto*/
-static char __pyx_doc_4nipy_10algorithms_10statistics_6intvol_Lips1d[] = "\n    Given a 1d mask and coordinates, estimate the intrinsic volumes\n    of the masked region. The region is broken up into\n    edges / vertices, which are included based on whether\n    all voxels in the edge / vertex are\n    in the mask or not.\n\n    Parameters:\n    -----------\n\n    coords : ndarray((*,i))\n         Coordinates for the voxels in the mask\n\n    mask : ndarray((i,), np.int)\n         Binary mask determining whether or not\n         a voxel is in the mask.\n\n    Outputs:\n    --------\n\n    mu : ndarray\n         Array of intrinsic volumes [mu0, mu1]\n\n    Notes:\n    ------\n\n    The array mask is assumed to be binary. At the time of \n    writing, it is not clear how to get cython to use np.bool\n    arrays.\n\n    References:\n    -----------\n\n    Taylor, J.E. & Worsley, K.J. (2007). \"Detecting sparse signal in random fields,\n      with an application to brain mapping.\"\n      Journal of the American Statistical Association, 102(479):913-928.\n\n\n    ";
-static PyObject *__pyx_pf_4nipy_10algorithms_10statistics_6intvol_Lips1d(PyObject *__pyx_self, PyObject *__pyx_args, PyObject *__pyx_kwds) {
-  PyArrayObject *__pyx_v_coords = 0;
-  PyArrayObject *__pyx_v_mask = 0;
-  long __pyx_v_i;
-  long __pyx_v_l;
-  long __pyx_v_r;
-  long __pyx_v_s;
-  long __pyx_v_rr;
-  long __pyx_v_ss;
-  long __pyx_v_mr;
-  long __pyx_v_ms;
-  long __pyx_v_s0;
-  long __pyx_v_m;
-  double __pyx_v_l0;
-  double __pyx_v_l1;
-  double __pyx_v_res;
-  PyObject *__pyx_v_n;
-  PyObject *__pyx_v_D;
-  Py_buffer __pyx_bstruct_mask;
-  Py_ssize_t __pyx_bstride_0_mask = 0;
-  Py_ssize_t __pyx_bshape_0_mask = 0;
-  Py_buffer __pyx_bstruct_coords;
-  Py_ssize_t __pyx_bstride_0_coords = 0;
-  Py_ssize_t __pyx_bstride_1_coords = 0;
-  Py_ssize_t __pyx_bshape_0_coords = 0;
-  Py_ssize_t __pyx_bshape_1_coords = 0;
-  PyObject *__pyx_r = NULL;
-  PyObject *__pyx_1 = 0;
-  PyObject *__pyx_2 = 0;
-  PyObject *__pyx_3 = 0;
-  PyObject *__pyx_4 = 0;
-  PyObject *__pyx_t_1 = NULL;
-  PyObject *__pyx_t_2 = NULL;
-  PyObject *__pyx_t_3 = NULL;
-  int __pyx_t_4;
-  int __pyx_t_5;
-  long __pyx_t_6;
-  long __pyx_t_7;
-  long __pyx_t_8;
-  int __pyx_t_9;
-  long __pyx_t_10;
-  long __pyx_t_11;
-  long __pyx_t_12;
-  long __pyx_t_13;
-  long __pyx_t_14;
-  long __pyx_t_15;
-  long __pyx_t_16;
-  PyObject *__pyx_t_17 = NULL;
-  double __pyx_t_18;
-  static PyObject **__pyx_pyargnames[] = {&__pyx_kp_coords,&__pyx_kp_mask,0};
-  __Pyx_SetupRefcountContext("Lips1d");
-  __pyx_self = __pyx_self;
-  if (unlikely(__pyx_kwds)) {
-    Py_ssize_t kw_args = PyDict_Size(__pyx_kwds);
-    PyObject* values[2] = {0,0};
-    switch (PyTuple_GET_SIZE(__pyx_args)) {
-      case  2: values[1] = PyTuple_GET_ITEM(__pyx_args, 1);
-      case  1: values[0] = PyTuple_GET_ITEM(__pyx_args, 0);
-      case  0: break;
-      default: goto __pyx_L5_argtuple_error;
-    }
-    switch (PyTuple_GET_SIZE(__pyx_args)) {
-      case  0:
-      values[0] = PyDict_GetItem(__pyx_kwds, __pyx_kp_coords);
-      if (likely(values[0])) kw_args--;
-      else goto __pyx_L5_argtuple_error;
-      case  1:
-      values[1] = PyDict_GetItem(__pyx_kwds, __pyx_kp_mask);
-      if (likely(values[1])) kw_args--;
-      else {
-        __Pyx_RaiseArgtupleInvalid("Lips1d", 1, 2, 2, 1); {__pyx_filename = __pyx_f[0]; __pyx_lineno = 915; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-      }
-    }
-    if (unlikely(kw_args > 0)) {
-      if (unlikely(__Pyx_ParseOptionalKeywords(__pyx_kwds, __pyx_pyargnames, 0, values, PyTuple_GET_SIZE(__pyx_args), "Lips1d") < 0)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 915; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-    }
-    __pyx_v_coords = ((PyArrayObject *)values[0]);
-    __pyx_v_mask = ((PyArrayObject *)values[1]);
-  } else if (PyTuple_GET_SIZE(__pyx_args) != 2) {
-    goto __pyx_L5_argtuple_error;
-  } else {
-    __pyx_v_coords = ((PyArrayObject *)PyTuple_GET_ITEM(__pyx_args, 0));
-    __pyx_v_mask = ((PyArrayObject *)PyTuple_GET_ITEM(__pyx_args, 1));
-  }
-  goto __pyx_L4_argument_unpacking_done;
-  __pyx_L5_argtuple_error:;
-  __Pyx_RaiseArgtupleInvalid("Lips1d", 1, 2, 2, PyTuple_GET_SIZE(__pyx_args)); {__pyx_filename = __pyx_f[0]; __pyx_lineno = 915; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-  __pyx_L3_error:;
-  __Pyx_AddTraceback("nipy.algorithms.statistics.intvol.Lips1d");
-  return NULL;
-  __pyx_L4_argument_unpacking_done:;
-  __pyx_v_n = Py_None; __Pyx_INCREF(Py_None);
-  __pyx_v_D = Py_None; __Pyx_INCREF(Py_None);
-  __pyx_bstruct_coords.buf = NULL;
-  __pyx_bstruct_mask.buf = NULL;
-  if (unlikely(!__Pyx_ArgTypeTest(((PyObject *)__pyx_v_coords), __pyx_ptype_5numpy_ndarray, 1, "coords", 0))) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 915; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  if (unlikely(!__Pyx_ArgTypeTest(((PyObject *)__pyx_v_mask), __pyx_ptype_5numpy_ndarray, 1, "mask", 0))) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 916; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  {
-    __Pyx_BufFmt_StackElem __pyx_stack[1];
-    if (unlikely(__Pyx_GetBufferAndValidate(&__pyx_bstruct_coords, (PyObject*)__pyx_v_coords, &__Pyx_TypeInfo_nn___pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_float_t, PyBUF_FORMAT| PyBUF_STRIDES, 2, 0, __pyx_stack) == -1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 915; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  }
-  __pyx_bstride_0_coords = __pyx_bstruct_coords.strides[0]; __pyx_bstride_1_coords = __pyx_bstruct_coords.strides[1];
-  __pyx_bshape_0_coords = __pyx_bstruct_coords.shape[0]; __pyx_bshape_1_coords = __pyx_bstruct_coords.shape[1];
-  {
-    __Pyx_BufFmt_StackElem __pyx_stack[1];
-    if (unlikely(__Pyx_GetBufferAndValidate(&__pyx_bstruct_mask, (PyObject*)__pyx_v_mask, &__Pyx_TypeInfo_nn___pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_int_t, PyBUF_FORMAT| PyBUF_STRIDES, 1, 0, __pyx_stack) == -1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 915; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  }
-  __pyx_bstride_0_mask = __pyx_bstruct_mask.strides[0];
-  __pyx_bshape_0_mask = __pyx_bstruct_mask.shape[0];
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":957
- *     """
- * 
- *     if not set(np.unique(mask)).issubset([0,1]):             # <<<<<<<<<<<<<<
- *       raise ValueError('mask should be filled with 0/1 values, but be of type np.int')
- * 
- */
-  __pyx_1 = __Pyx_GetName(__pyx_m, __pyx_kp_np); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 957; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_1);
-  __pyx_t_1 = PyObject_GetAttr(__pyx_1, __pyx_kp_unique); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 957; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_1);
-  __Pyx_DECREF(__pyx_1); __pyx_1 = 0;
-  __pyx_t_2 = PyTuple_New(1); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 957; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_2));
-  __Pyx_INCREF(((PyObject *)__pyx_v_mask));
-  PyTuple_SET_ITEM(__pyx_t_2, 0, ((PyObject *)__pyx_v_mask));
-  __Pyx_GIVEREF(((PyObject *)__pyx_v_mask));
-  __pyx_t_3 = PyObject_Call(__pyx_t_1, ((PyObject *)__pyx_t_2), NULL); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 957; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_3);
-  __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-  __Pyx_DECREF(((PyObject *)__pyx_t_2)); __pyx_t_2 = 0;
-  __pyx_t_2 = PyTuple_New(1); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 957; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_2));
-  PyTuple_SET_ITEM(__pyx_t_2, 0, __pyx_t_3);
-  __Pyx_GIVEREF(__pyx_t_3);
-  __pyx_t_3 = 0;
-  __pyx_t_3 = PyObject_Call(((PyObject *)((PyObject*)&PySet_Type)), ((PyObject *)__pyx_t_2), NULL); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 957; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_3);
-  __Pyx_DECREF(((PyObject *)__pyx_t_2)); __pyx_t_2 = 0;
-  __pyx_t_2 = PyObject_GetAttr(__pyx_t_3, __pyx_kp_issubset); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 957; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_2);
-  __Pyx_DECREF(__pyx_t_3); __pyx_t_3 = 0;
-  __pyx_t_3 = PyList_New(2); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 957; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_3));
-  __Pyx_INCREF(__pyx_int_0);
-  PyList_SET_ITEM(__pyx_t_3, 0, __pyx_int_0);
-  __Pyx_GIVEREF(__pyx_int_0);
-  __Pyx_INCREF(__pyx_int_1);
-  PyList_SET_ITEM(__pyx_t_3, 1, __pyx_int_1);
-  __Pyx_GIVEREF(__pyx_int_1);
-  __pyx_t_1 = PyTuple_New(1); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 957; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_1));
-  PyTuple_SET_ITEM(__pyx_t_1, 0, ((PyObject *)__pyx_t_3));
-  __Pyx_GIVEREF(((PyObject *)__pyx_t_3));
-  __pyx_t_3 = 0;
-  __pyx_t_3 = PyObject_Call(__pyx_t_2, ((PyObject *)__pyx_t_1), NULL); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 957; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_3);
-  __Pyx_DECREF(__pyx_t_2); __pyx_t_2 = 0;
-  __Pyx_DECREF(((PyObject *)__pyx_t_1)); __pyx_t_1 = 0;
-  __pyx_t_4 = __Pyx_PyObject_IsTrue(__pyx_t_3); if (unlikely(__pyx_t_4 < 0)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 957; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_DECREF(__pyx_t_3); __pyx_t_3 = 0;
-  __pyx_t_5 = (!__pyx_t_4);
-  if (__pyx_t_5) {
-
-    /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":958
- * 
- *     if not set(np.unique(mask)).issubset([0,1]):
- *       raise ValueError('mask should be filled with 0/1 values, but be of type np.int')             # <<<<<<<<<<<<<<
- * 
- *     # 'flattened' coords (2d array)
- */
-    __pyx_t_3 = PyTuple_New(1); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 958; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __Pyx_GOTREF(((PyObject *)__pyx_t_3));
-    __Pyx_INCREF(__pyx_kp_58);
-    PyTuple_SET_ITEM(__pyx_t_3, 0, __pyx_kp_58);
-    __Pyx_GIVEREF(__pyx_kp_58);
-    __pyx_t_1 = PyObject_Call(__pyx_builtin_ValueError, ((PyObject *)__pyx_t_3), NULL); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 958; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __Pyx_GOTREF(__pyx_t_1);
-    __Pyx_DECREF(((PyObject *)__pyx_t_3)); __pyx_t_3 = 0;
-    __Pyx_Raise(__pyx_t_1, 0, 0);
-    __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-    {__pyx_filename = __pyx_f[0]; __pyx_lineno = 958; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    goto __pyx_L6;
-  }
-  __pyx_L6:;
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":971
- *     cdef double res
- * 
- *     l0 = 0; l1 = 0             # <<<<<<<<<<<<<<
- * 
- *     s0 = mask.shape[0]
- */
-  __pyx_v_l0 = 0;
-  __pyx_v_l1 = 0;
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":973
- *     l0 = 0; l1 = 0
- * 
- *     s0 = mask.shape[0]             # <<<<<<<<<<<<<<
- * 
- *     if mask.shape[0] != coords.shape[1]:
- */
-  __pyx_v_s0 = (__pyx_v_mask->dimensions[0]);
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":975
- *     s0 = mask.shape[0]
- * 
- *     if mask.shape[0] != coords.shape[1]:             # <<<<<<<<<<<<<<
- *         raise ValueError('shape of mask does not match coordinates')
- * 
- */
-  __pyx_t_5 = ((__pyx_v_mask->dimensions[0]) != (__pyx_v_coords->dimensions[1]));
-  if (__pyx_t_5) {
-
-    /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":976
- * 
- *     if mask.shape[0] != coords.shape[1]:
- *         raise ValueError('shape of mask does not match coordinates')             # <<<<<<<<<<<<<<
- * 
- *     n = coords.shape[0]
- */
-    __pyx_t_1 = PyTuple_New(1); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 976; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __Pyx_GOTREF(((PyObject *)__pyx_t_1));
-    __Pyx_INCREF(__pyx_kp_59);
-    PyTuple_SET_ITEM(__pyx_t_1, 0, __pyx_kp_59);
-    __Pyx_GIVEREF(__pyx_kp_59);
-    __pyx_t_3 = PyObject_Call(__pyx_builtin_ValueError, ((PyObject *)__pyx_t_1), NULL); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 976; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __Pyx_GOTREF(__pyx_t_3);
-    __Pyx_DECREF(((PyObject *)__pyx_t_1)); __pyx_t_1 = 0;
-    __Pyx_Raise(__pyx_t_3, 0, 0);
-    __Pyx_DECREF(__pyx_t_3); __pyx_t_3 = 0;
-    {__pyx_filename = __pyx_f[0]; __pyx_lineno = 976; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    goto __pyx_L7;
-  }
-  __pyx_L7:;
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":978
- *         raise ValueError('shape of mask does not match coordinates')
- * 
- *     n = coords.shape[0]             # <<<<<<<<<<<<<<
- * 
- *     # First do the interior contributions.
- */
-  __pyx_t_3 = PyInt_FromLong((__pyx_v_coords->dimensions[0])); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 978; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_3);
-  __Pyx_DECREF(__pyx_v_n);
-  __pyx_v_n = __pyx_t_3;
-  __pyx_t_3 = 0;
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":984
- *     # are uniquely associated with an interior voxel
- * 
- *     D = np.zeros((2,2))             # <<<<<<<<<<<<<<
- * 
- *     for i in range(s0):
- */
-  __pyx_1 = __Pyx_GetName(__pyx_m, __pyx_kp_np); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 984; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_1);
-  __pyx_t_3 = PyObject_GetAttr(__pyx_1, __pyx_kp_zeros); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 984; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_3);
-  __Pyx_DECREF(__pyx_1); __pyx_1 = 0;
-  __pyx_t_1 = PyTuple_New(2); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 984; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_1));
-  __Pyx_INCREF(__pyx_int_2);
-  PyTuple_SET_ITEM(__pyx_t_1, 0, __pyx_int_2);
-  __Pyx_GIVEREF(__pyx_int_2);
-  __Pyx_INCREF(__pyx_int_2);
-  PyTuple_SET_ITEM(__pyx_t_1, 1, __pyx_int_2);
-  __Pyx_GIVEREF(__pyx_int_2);
-  __pyx_t_2 = PyTuple_New(1); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 984; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_2));
-  PyTuple_SET_ITEM(__pyx_t_2, 0, ((PyObject *)__pyx_t_1));
-  __Pyx_GIVEREF(((PyObject *)__pyx_t_1));
-  __pyx_t_1 = 0;
-  __pyx_t_1 = PyObject_Call(__pyx_t_3, ((PyObject *)__pyx_t_2), NULL); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 984; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_1);
-  __Pyx_DECREF(__pyx_t_3); __pyx_t_3 = 0;
-  __Pyx_DECREF(((PyObject *)__pyx_t_2)); __pyx_t_2 = 0;
-  __Pyx_DECREF(__pyx_v_D);
-  __pyx_v_D = __pyx_t_1;
-  __pyx_t_1 = 0;
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":986
- *     D = np.zeros((2,2))
- * 
- *     for i in range(s0):             # <<<<<<<<<<<<<<
- *       for r in range(2):
- *         rr = (i+r) % s0
- */
-  for (__pyx_t_6 = 0; __pyx_t_6 < __pyx_v_s0; __pyx_t_6+=1) {
-    __pyx_v_i = __pyx_t_6;
-
-    /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":987
- * 
- *     for i in range(s0):
- *       for r in range(2):             # <<<<<<<<<<<<<<
- *         rr = (i+r) % s0
- *         mr = mask[rr]
- */
-    for (__pyx_t_7 = 0; __pyx_t_7 < 2; __pyx_t_7+=1) {
-      __pyx_v_r = __pyx_t_7;
-
-      /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":988
- *     for i in range(s0):
- *       for r in range(2):
- *         rr = (i+r) % s0             # <<<<<<<<<<<<<<
- *         mr = mask[rr]
- *         for s in range(r+1):
- */
-      __pyx_v_rr = ((__pyx_v_i + __pyx_v_r) % __pyx_v_s0);
-
-      /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":989
- *       for r in range(2):
- *         rr = (i+r) % s0
- *         mr = mask[rr]             # <<<<<<<<<<<<<<
- *         for s in range(r+1):
- *           res = 0
- */
-      __pyx_t_8 = __pyx_v_rr;
-      __pyx_t_9 = -1;
-      if (__pyx_t_8 < 0) {
-        __pyx_t_8 += __pyx_bshape_0_mask;
-        if (unlikely(__pyx_t_8 < 0)) __pyx_t_9 = 0;
-      } else if (unlikely(__pyx_t_8 >= __pyx_bshape_0_mask)) __pyx_t_9 = 0;
-      if (unlikely(__pyx_t_9 != -1)) {
-        __Pyx_RaiseBufferIndexError(__pyx_t_9);
-        {__pyx_filename = __pyx_f[0]; __pyx_lineno = 989; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-      }
-      __pyx_v_mr = (*__Pyx_BufPtrStrided1d(__pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_int_t *, __pyx_bstruct_mask.buf, __pyx_t_8, __pyx_bstride_0_mask));
-
-      /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":990
- *         rr = (i+r) % s0
- *         mr = mask[rr]
- *         for s in range(r+1):             # <<<<<<<<<<<<<<
- *           res = 0
- *           ss = (i+s) % s0
- */
-      for (__pyx_t_10 = 0; __pyx_t_10 < (__pyx_v_r + 1); __pyx_t_10+=1) {
-        __pyx_v_s = __pyx_t_10;
-
-        /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":991
- *         mr = mask[rr]
- *         for s in range(r+1):
- *           res = 0             # <<<<<<<<<<<<<<
- *           ss = (i+s) % s0
- *           ms = mask[ss]
- */
-        __pyx_v_res = 0;
-
-        /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":992
- *         for s in range(r+1):
- *           res = 0
- *           ss = (i+s) % s0             # <<<<<<<<<<<<<<
- *           ms = mask[ss]
- *           if mr * ms * ((i+r) < s0) * ((i+s) < s0):
- */
-        __pyx_v_ss = ((__pyx_v_i + __pyx_v_s) % __pyx_v_s0);
-
-        /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":993
- *           res = 0
- *           ss = (i+s) % s0
- *           ms = mask[ss]             # <<<<<<<<<<<<<<
- *           if mr * ms * ((i+r) < s0) * ((i+s) < s0):
- *             for l in range(coords.shape[0]):
- */
-        __pyx_t_11 = __pyx_v_ss;
-        __pyx_t_9 = -1;
-        if (__pyx_t_11 < 0) {
-          __pyx_t_11 += __pyx_bshape_0_mask;
-          if (unlikely(__pyx_t_11 < 0)) __pyx_t_9 = 0;
-        } else if (unlikely(__pyx_t_11 >= __pyx_bshape_0_mask)) __pyx_t_9 = 0;
-        if (unlikely(__pyx_t_9 != -1)) {
-          __Pyx_RaiseBufferIndexError(__pyx_t_9);
-          {__pyx_filename = __pyx_f[0]; __pyx_lineno = 993; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-        }
-        __pyx_v_ms = (*__Pyx_BufPtrStrided1d(__pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_int_t *, __pyx_bstruct_mask.buf, __pyx_t_11, __pyx_bstride_0_mask));
-
-        /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":994
- *           ss = (i+s) % s0
- *           ms = mask[ss]
- *           if mr * ms * ((i+r) < s0) * ((i+s) < s0):             # <<<<<<<<<<<<<<
- *             for l in range(coords.shape[0]):
- *               res += coords[l,ss] * coords[l,rr]
- */
-        __pyx_t_12 = (((__pyx_v_mr * __pyx_v_ms) * ((__pyx_v_i + __pyx_v_r) < __pyx_v_s0)) * ((__pyx_v_i + __pyx_v_s) < __pyx_v_s0));
-        if (__pyx_t_12) {
-
-          /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":995
- *           ms = mask[ss]
- *           if mr * ms * ((i+r) < s0) * ((i+s) < s0):
- *             for l in range(coords.shape[0]):             # <<<<<<<<<<<<<<
- *               res += coords[l,ss] * coords[l,rr]
- *             D[r,s] = res
- */
-          for (__pyx_t_12 = 0; __pyx_t_12 < (__pyx_v_coords->dimensions[0]); __pyx_t_12+=1) {
-            __pyx_v_l = __pyx_t_12;
-
-            /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":996
- *           if mr * ms * ((i+r) < s0) * ((i+s) < s0):
- *             for l in range(coords.shape[0]):
- *               res += coords[l,ss] * coords[l,rr]             # <<<<<<<<<<<<<<
- *             D[r,s] = res
- *             D[s,r] = res
- */
-            __pyx_t_13 = __pyx_v_l;
-            __pyx_t_14 = __pyx_v_ss;
-            __pyx_t_9 = -1;
-            if (__pyx_t_13 < 0) {
-              __pyx_t_13 += __pyx_bshape_0_coords;
-              if (unlikely(__pyx_t_13 < 0)) __pyx_t_9 = 0;
-            } else if (unlikely(__pyx_t_13 >= __pyx_bshape_0_coords)) __pyx_t_9 = 0;
-            if (__pyx_t_14 < 0) {
-              __pyx_t_14 += __pyx_bshape_1_coords;
-              if (unlikely(__pyx_t_14 < 0)) __pyx_t_9 = 1;
-            } else if (unlikely(__pyx_t_14 >= __pyx_bshape_1_coords)) __pyx_t_9 = 1;
-            if (unlikely(__pyx_t_9 != -1)) {
-              __Pyx_RaiseBufferIndexError(__pyx_t_9);
-              {__pyx_filename = __pyx_f[0]; __pyx_lineno = 996; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            }
-            __pyx_t_15 = __pyx_v_l;
-            __pyx_t_16 = __pyx_v_rr;
-            __pyx_t_9 = -1;
-            if (__pyx_t_15 < 0) {
-              __pyx_t_15 += __pyx_bshape_0_coords;
-              if (unlikely(__pyx_t_15 < 0)) __pyx_t_9 = 0;
-            } else if (unlikely(__pyx_t_15 >= __pyx_bshape_0_coords)) __pyx_t_9 = 0;
-            if (__pyx_t_16 < 0) {
-              __pyx_t_16 += __pyx_bshape_1_coords;
-              if (unlikely(__pyx_t_16 < 0)) __pyx_t_9 = 1;
-            } else if (unlikely(__pyx_t_16 >= __pyx_bshape_1_coords)) __pyx_t_9 = 1;
-            if (unlikely(__pyx_t_9 != -1)) {
-              __Pyx_RaiseBufferIndexError(__pyx_t_9);
-              {__pyx_filename = __pyx_f[0]; __pyx_lineno = 996; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-            }
-            __pyx_v_res += ((*__Pyx_BufPtrStrided2d(__pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_float_t *, __pyx_bstruct_coords.buf, __pyx_t_13, __pyx_bstride_0_coords, __pyx_t_14, __pyx_bstride_1_coords)) * (*__Pyx_BufPtrStrided2d(__pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_float_t *, __pyx_bstruct_coords.buf, __pyx_t_15, __pyx_bstride_0_coords, __pyx_t_16, __pyx_bstride_1_coords)));
-          }
-
-          /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":997
- *             for l in range(coords.shape[0]):
- *               res += coords[l,ss] * coords[l,rr]
- *             D[r,s] = res             # <<<<<<<<<<<<<<
- *             D[s,r] = res
- *           else:
- */
-          __pyx_t_1 = PyFloat_FromDouble(__pyx_v_res); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 997; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-          __Pyx_GOTREF(__pyx_t_1);
-          __pyx_t_2 = PyInt_FromLong(__pyx_v_r); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 997; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-          __Pyx_GOTREF(__pyx_t_2);
-          __pyx_t_3 = PyInt_FromLong(__pyx_v_s); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 997; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-          __Pyx_GOTREF(__pyx_t_3);
-          __pyx_t_17 = PyTuple_New(2); if (unlikely(!__pyx_t_17)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 997; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-          __Pyx_GOTREF(((PyObject *)__pyx_t_17));
-          PyTuple_SET_ITEM(__pyx_t_17, 0, __pyx_t_2);
-          __Pyx_GIVEREF(__pyx_t_2);
-          PyTuple_SET_ITEM(__pyx_t_17, 1, __pyx_t_3);
-          __Pyx_GIVEREF(__pyx_t_3);
-          __pyx_t_2 = 0;
-          __pyx_t_3 = 0;
-          if (PyObject_SetItem(__pyx_v_D, ((PyObject *)__pyx_t_17), __pyx_t_1) < 0) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 997; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-          __Pyx_DECREF(((PyObject *)__pyx_t_17)); __pyx_t_17 = 0;
-          __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-
-          /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":998
- *               res += coords[l,ss] * coords[l,rr]
- *             D[r,s] = res
- *             D[s,r] = res             # <<<<<<<<<<<<<<
- *           else:
- *             D[r,s] = 0
- */
-          __pyx_t_1 = PyFloat_FromDouble(__pyx_v_res); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 998; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-          __Pyx_GOTREF(__pyx_t_1);
-          __pyx_t_17 = PyInt_FromLong(__pyx_v_s); if (unlikely(!__pyx_t_17)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 998; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-          __Pyx_GOTREF(__pyx_t_17);
-          __pyx_t_3 = PyInt_FromLong(__pyx_v_r); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 998; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-          __Pyx_GOTREF(__pyx_t_3);
-          __pyx_t_2 = PyTuple_New(2); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 998; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-          __Pyx_GOTREF(((PyObject *)__pyx_t_2));
-          PyTuple_SET_ITEM(__pyx_t_2, 0, __pyx_t_17);
-          __Pyx_GIVEREF(__pyx_t_17);
-          PyTuple_SET_ITEM(__pyx_t_2, 1, __pyx_t_3);
-          __Pyx_GIVEREF(__pyx_t_3);
-          __pyx_t_17 = 0;
-          __pyx_t_3 = 0;
-          if (PyObject_SetItem(__pyx_v_D, ((PyObject *)__pyx_t_2), __pyx_t_1) < 0) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 998; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-          __Pyx_DECREF(((PyObject *)__pyx_t_2)); __pyx_t_2 = 0;
-          __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-          goto __pyx_L14;
-        }
-        /*else*/ {
-
-          /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":1000
- *             D[s,r] = res
- *           else:
- *             D[r,s] = 0             # <<<<<<<<<<<<<<
- *             D[s,r] = 0
- * 
- */
-          __pyx_t_1 = PyInt_FromLong(__pyx_v_r); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 1000; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-          __Pyx_GOTREF(__pyx_t_1);
-          __pyx_t_2 = PyInt_FromLong(__pyx_v_s); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 1000; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-          __Pyx_GOTREF(__pyx_t_2);
-          __pyx_t_3 = PyTuple_New(2); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 1000; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-          __Pyx_GOTREF(((PyObject *)__pyx_t_3));
-          PyTuple_SET_ITEM(__pyx_t_3, 0, __pyx_t_1);
-          __Pyx_GIVEREF(__pyx_t_1);
-          PyTuple_SET_ITEM(__pyx_t_3, 1, __pyx_t_2);
-          __Pyx_GIVEREF(__pyx_t_2);
-          __pyx_t_1 = 0;
-          __pyx_t_2 = 0;
-          if (PyObject_SetItem(__pyx_v_D, ((PyObject *)__pyx_t_3), __pyx_int_0) < 0) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 1000; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-          __Pyx_DECREF(((PyObject *)__pyx_t_3)); __pyx_t_3 = 0;
-
-          /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":1001
- *           else:
- *             D[r,s] = 0
- *             D[s,r] = 0             # <<<<<<<<<<<<<<
- * 
- *       m = mask[i]
- */
-          __pyx_t_3 = PyInt_FromLong(__pyx_v_s); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 1001; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-          __Pyx_GOTREF(__pyx_t_3);
-          __pyx_t_2 = PyInt_FromLong(__pyx_v_r); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 1001; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-          __Pyx_GOTREF(__pyx_t_2);
-          __pyx_t_1 = PyTuple_New(2); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 1001; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-          __Pyx_GOTREF(((PyObject *)__pyx_t_1));
-          PyTuple_SET_ITEM(__pyx_t_1, 0, __pyx_t_3);
-          __Pyx_GIVEREF(__pyx_t_3);
-          PyTuple_SET_ITEM(__pyx_t_1, 1, __pyx_t_2);
-          __Pyx_GIVEREF(__pyx_t_2);
-          __pyx_t_3 = 0;
-          __pyx_t_2 = 0;
-          if (PyObject_SetItem(__pyx_v_D, ((PyObject *)__pyx_t_1), __pyx_int_0) < 0) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 1001; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-          __Pyx_DECREF(((PyObject *)__pyx_t_1)); __pyx_t_1 = 0;
-        }
-        __pyx_L14:;
-      }
-    }
-
-    /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":1003
- *             D[s,r] = 0
- * 
- *       m = mask[i]             # <<<<<<<<<<<<<<
- *       if m:
- *         m = m * (mask[(i+1) % s0] * (i < s0))
- */
-    __pyx_t_7 = __pyx_v_i;
-    __pyx_t_9 = -1;
-    if (__pyx_t_7 < 0) {
-      __pyx_t_7 += __pyx_bshape_0_mask;
-      if (unlikely(__pyx_t_7 < 0)) __pyx_t_9 = 0;
-    } else if (unlikely(__pyx_t_7 >= __pyx_bshape_0_mask)) __pyx_t_9 = 0;
-    if (unlikely(__pyx_t_9 != -1)) {
-      __Pyx_RaiseBufferIndexError(__pyx_t_9);
-      {__pyx_filename = __pyx_f[0]; __pyx_lineno = 1003; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    }
-    __pyx_v_m = (*__Pyx_BufPtrStrided1d(__pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_int_t *, __pyx_bstruct_mask.buf, __pyx_t_7, __pyx_bstride_0_mask));
-
-    /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":1004
- * 
- *       m = mask[i]
- *       if m:             # <<<<<<<<<<<<<<
- *         m = m * (mask[(i+1) % s0] * (i < s0))
- *         l1 = l1 + m * mu1_edge(D[0,0], D[0,1], D[1,1])
- */
-    __pyx_t_10 = __pyx_v_m;
-    if (__pyx_t_10) {
-
-      /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":1005
- *       m = mask[i]
- *       if m:
- *         m = m * (mask[(i+1) % s0] * (i < s0))             # <<<<<<<<<<<<<<
- *         l1 = l1 + m * mu1_edge(D[0,0], D[0,1], D[1,1])
- *         l0 = l0 - m
- */
-      __pyx_t_10 = ((__pyx_v_i + 1) % __pyx_v_s0);
-      __pyx_t_9 = -1;
-      if (__pyx_t_10 < 0) {
-        __pyx_t_10 += __pyx_bshape_0_mask;
-        if (unlikely(__pyx_t_10 < 0)) __pyx_t_9 = 0;
-      } else if (unlikely(__pyx_t_10 >= __pyx_bshape_0_mask)) __pyx_t_9 = 0;
-      if (unlikely(__pyx_t_9 != -1)) {
-        __Pyx_RaiseBufferIndexError(__pyx_t_9);
-        {__pyx_filename = __pyx_f[0]; __pyx_lineno = 1005; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-      }
-      __pyx_v_m = (__pyx_v_m * ((*__Pyx_BufPtrStrided1d(__pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_int_t *, __pyx_bstruct_mask.buf, __pyx_t_10, __pyx_bstride_0_mask)) * (__pyx_v_i < __pyx_v_s0)));
-
-      /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":1006
- *       if m:
- *         m = m * (mask[(i+1) % s0] * (i < s0))
- *         l1 = l1 + m * mu1_edge(D[0,0], D[0,1], D[1,1])             # <<<<<<<<<<<<<<
- *         l0 = l0 - m
- * 
- */
-      __pyx_t_1 = PyFloat_FromDouble(__pyx_v_l1); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 1006; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-      __Pyx_GOTREF(__pyx_t_1);
-      __pyx_t_2 = PyInt_FromLong(__pyx_v_m); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 1006; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-      __Pyx_GOTREF(__pyx_t_2);
-      __pyx_1 = __Pyx_GetName(__pyx_m, __pyx_kp_45); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 1006; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-      __Pyx_GOTREF(__pyx_1);
-      __pyx_t_3 = PyTuple_New(2); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 1006; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-      __Pyx_GOTREF(((PyObject *)__pyx_t_3));
-      __Pyx_INCREF(__pyx_int_0);
-      PyTuple_SET_ITEM(__pyx_t_3, 0, __pyx_int_0);
-      __Pyx_GIVEREF(__pyx_int_0);
-      __Pyx_INCREF(__pyx_int_0);
-      PyTuple_SET_ITEM(__pyx_t_3, 1, __pyx_int_0);
-      __Pyx_GIVEREF(__pyx_int_0);
-      __pyx_2 = PyObject_GetItem(__pyx_v_D, ((PyObject *)__pyx_t_3)); if (!__pyx_2) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 1006; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-      __Pyx_GOTREF(__pyx_2);
-      __Pyx_DECREF(((PyObject *)__pyx_t_3)); __pyx_t_3 = 0;
-      __pyx_t_3 = PyTuple_New(2); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 1006; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-      __Pyx_GOTREF(((PyObject *)__pyx_t_3));
-      __Pyx_INCREF(__pyx_int_0);
-      PyTuple_SET_ITEM(__pyx_t_3, 0, __pyx_int_0);
-      __Pyx_GIVEREF(__pyx_int_0);
-      __Pyx_INCREF(__pyx_int_1);
-      PyTuple_SET_ITEM(__pyx_t_3, 1, __pyx_int_1);
-      __Pyx_GIVEREF(__pyx_int_1);
-      __pyx_3 = PyObject_GetItem(__pyx_v_D, ((PyObject *)__pyx_t_3)); if (!__pyx_3) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 1006; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-      __Pyx_GOTREF(__pyx_3);
-      __Pyx_DECREF(((PyObject *)__pyx_t_3)); __pyx_t_3 = 0;
-      __pyx_t_3 = PyTuple_New(2); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 1006; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-      __Pyx_GOTREF(((PyObject *)__pyx_t_3));
-      __Pyx_INCREF(__pyx_int_1);
-      PyTuple_SET_ITEM(__pyx_t_3, 0, __pyx_int_1);
-      __Pyx_GIVEREF(__pyx_int_1);
-      __Pyx_INCREF(__pyx_int_1);
-      PyTuple_SET_ITEM(__pyx_t_3, 1, __pyx_int_1);
-      __Pyx_GIVEREF(__pyx_int_1);
-      __pyx_4 = PyObject_GetItem(__pyx_v_D, ((PyObject *)__pyx_t_3)); if (!__pyx_4) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 1006; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-      __Pyx_GOTREF(__pyx_4);
-      __Pyx_DECREF(((PyObject *)__pyx_t_3)); __pyx_t_3 = 0;
-      __pyx_t_3 = PyTuple_New(3); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 1006; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-      __Pyx_GOTREF(((PyObject *)__pyx_t_3));
-      PyTuple_SET_ITEM(__pyx_t_3, 0, __pyx_2);
-      __Pyx_GIVEREF(__pyx_2);
-      PyTuple_SET_ITEM(__pyx_t_3, 1, __pyx_3);
-      __Pyx_GIVEREF(__pyx_3);
-      PyTuple_SET_ITEM(__pyx_t_3, 2, __pyx_4);
-      __Pyx_GIVEREF(__pyx_4);
-      __pyx_2 = 0;
-      __pyx_3 = 0;
-      __pyx_4 = 0;
-      __pyx_t_17 = PyObject_Call(__pyx_1, ((PyObject *)__pyx_t_3), NULL); if (unlikely(!__pyx_t_17)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 1006; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-      __Pyx_GOTREF(__pyx_t_17);
-      __Pyx_DECREF(__pyx_1); __pyx_1 = 0;
-      __Pyx_DECREF(((PyObject *)__pyx_t_3)); __pyx_t_3 = 0;
-      __pyx_t_3 = PyNumber_Multiply(__pyx_t_2, __pyx_t_17); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 1006; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-      __Pyx_GOTREF(__pyx_t_3);
-      __Pyx_DECREF(__pyx_t_2); __pyx_t_2 = 0;
-      __Pyx_DECREF(__pyx_t_17); __pyx_t_17 = 0;
-      __pyx_t_17 = PyNumber_Add(__pyx_t_1, __pyx_t_3); if (unlikely(!__pyx_t_17)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 1006; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-      __Pyx_GOTREF(__pyx_t_17);
-      __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-      __Pyx_DECREF(__pyx_t_3); __pyx_t_3 = 0;
-      __pyx_t_18 = __pyx_PyFloat_AsDouble(__pyx_t_17); if (unlikely(PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 1006; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-      __Pyx_DECREF(__pyx_t_17); __pyx_t_17 = 0;
-      __pyx_v_l1 = __pyx_t_18;
-
-      /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":1007
- *         m = m * (mask[(i+1) % s0] * (i < s0))
- *         l1 = l1 + m * mu1_edge(D[0,0], D[0,1], D[1,1])
- *         l0 = l0 - m             # <<<<<<<<<<<<<<
- * 
- *     l0 += mask.sum()
- */
-      __pyx_v_l0 = (__pyx_v_l0 - __pyx_v_m);
-      goto __pyx_L17;
-    }
-    __pyx_L17:;
-  }
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":1009
- *         l0 = l0 - m
- * 
- *     l0 += mask.sum()             # <<<<<<<<<<<<<<
- *     return np.array([l0,l1])
- * 
- */
-  __pyx_t_17 = PyObject_GetAttr(((PyObject *)__pyx_v_mask), __pyx_kp_sum); if (unlikely(!__pyx_t_17)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 1009; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_17);
-  __pyx_t_3 = PyObject_Call(__pyx_t_17, ((PyObject *)__pyx_empty_tuple), NULL); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 1009; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_3);
-  __Pyx_DECREF(__pyx_t_17); __pyx_t_17 = 0;
-  __pyx_t_18 = __pyx_PyFloat_AsDouble(__pyx_t_3); if (unlikely(PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 1009; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_DECREF(__pyx_t_3); __pyx_t_3 = 0;
-  __pyx_v_l0 += __pyx_t_18;
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":1010
- * 
- *     l0 += mask.sum()
- *     return np.array([l0,l1])             # <<<<<<<<<<<<<<
- * 
- * def EC1d(np.ndarray[DTYPE_int_t, ndim=1] mask):
- */
-  __Pyx_XDECREF(__pyx_r);
-  __pyx_2 = __Pyx_GetName(__pyx_m, __pyx_kp_np); if (unlikely(!__pyx_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 1010; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_2);
-  __pyx_t_3 = PyObject_GetAttr(__pyx_2, __pyx_kp_array); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 1010; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_3);
-  __Pyx_DECREF(__pyx_2); __pyx_2 = 0;
-  __pyx_t_17 = PyFloat_FromDouble(__pyx_v_l0); if (unlikely(!__pyx_t_17)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 1010; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_17);
-  __pyx_t_1 = PyFloat_FromDouble(__pyx_v_l1); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 1010; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_1);
-  __pyx_t_2 = PyList_New(2); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 1010; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_2));
-  PyList_SET_ITEM(__pyx_t_2, 0, __pyx_t_17);
-  __Pyx_GIVEREF(__pyx_t_17);
-  PyList_SET_ITEM(__pyx_t_2, 1, __pyx_t_1);
-  __Pyx_GIVEREF(__pyx_t_1);
-  __pyx_t_17 = 0;
-  __pyx_t_1 = 0;
-  __pyx_t_1 = PyTuple_New(1); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 1010; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_1));
-  PyTuple_SET_ITEM(__pyx_t_1, 0, ((PyObject *)__pyx_t_2));
-  __Pyx_GIVEREF(((PyObject *)__pyx_t_2));
-  __pyx_t_2 = 0;
-  __pyx_t_2 = PyObject_Call(__pyx_t_3, ((PyObject *)__pyx_t_1), NULL); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 1010; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_2);
-  __Pyx_DECREF(__pyx_t_3); __pyx_t_3 = 0;
-  __Pyx_DECREF(((PyObject *)__pyx_t_1)); __pyx_t_1 = 0;
-  __pyx_r = __pyx_t_2;
-  __pyx_t_2 = 0;
-  goto __pyx_L0;
-
-  __pyx_r = Py_None; __Pyx_INCREF(Py_None);
-  goto __pyx_L0;
-  __pyx_L1_error:;
-  __Pyx_XDECREF(__pyx_1);
-  __Pyx_XDECREF(__pyx_2);
-  __Pyx_XDECREF(__pyx_3);
-  __Pyx_XDECREF(__pyx_4);
-  __Pyx_XDECREF(__pyx_t_1);
-  __Pyx_XDECREF(__pyx_t_2);
-  __Pyx_XDECREF(__pyx_t_3);
-  __Pyx_XDECREF(__pyx_t_17);
-  { PyObject *__pyx_type, *__pyx_value, *__pyx_tb;
-    __Pyx_ErrFetch(&__pyx_type, &__pyx_value, &__pyx_tb);
-    __Pyx_SafeReleaseBuffer(&__pyx_bstruct_mask);
-    __Pyx_SafeReleaseBuffer(&__pyx_bstruct_coords);
-  __Pyx_ErrRestore(__pyx_type, __pyx_value, __pyx_tb);}
-  __Pyx_AddTraceback("nipy.algorithms.statistics.intvol.Lips1d");
-  __pyx_r = NULL;
-  goto __pyx_L2;
-  __pyx_L0:;
-  __Pyx_SafeReleaseBuffer(&__pyx_bstruct_mask);
-  __Pyx_SafeReleaseBuffer(&__pyx_bstruct_coords);
-  __pyx_L2:;
-  __Pyx_DECREF(__pyx_v_n);
-  __Pyx_DECREF(__pyx_v_D);
-  __Pyx_XGIVEREF(__pyx_r);
-  __Pyx_FinishRefcountContext();
-  return __pyx_r;
-}
-
-/* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":1012
- *     return np.array([l0,l1])
- * 
- * def EC1d(np.ndarray[DTYPE_int_t, ndim=1] mask):             # <<<<<<<<<<<<<<
- *     """
- *     Given a 1d mask, compute the 0th intrinsic volume
- */
-
-static PyObject *__pyx_pf_4nipy_10algorithms_10statistics_6intvol_EC1d(PyObject *__pyx_self, PyObject *__pyx_v_mask); /*proto*/
-static char __pyx_doc_4nipy_10algorithms_10statistics_6intvol_EC1d[] = "\n    Given a 1d mask, compute the 0th intrinsic volume\n    (Euler characteristic)\n    of the masked region. The region is broken up into \n    edges / vertices, which are included based on whether\n    all voxels in the edge / vertex are\n    in the mask or not.\n\n    Parameters:\n    -----------\n\n    mask : ndarray((i,), np.int)\n         Binary mask determining whether or not\n         a voxel is in the mask.\n\n    Outputs:\n    --------\n\n    mu0 : int\n\n    Notes:\n    ------\n\n    The array mask is assumed to be binary. At the time of \n    writing, it is not clear how to get cython to use np.bool\n    arrays.\n\n    The 3d cubes are triangulated into 6 tetrahedra of equal volume,\n    as described in the reference below.\n\n    References:\n    -----------\n\n    Taylor, J.E. & Worsley, K.J. (2007). \"Detecting sparse signal in random fields,\n      with an application to brain mapping.\"\n      Journal of the American Statistical Association, 102(479):913-928.\n\n\n    ";
-static PyObject *__pyx_pf_4nipy_10algorithms_10statistics_6intvol_EC1d(PyObject *__pyx_self, PyObject *__pyx_v_mask) {
-  long __pyx_v_i;
-  long __pyx_v_m;
-  long __pyx_v_s0;
-  double __pyx_v_l0;
-  Py_buffer __pyx_bstruct_mask;
-  Py_ssize_t __pyx_bstride_0_mask = 0;
-  Py_ssize_t __pyx_bshape_0_mask = 0;
-  PyObject *__pyx_r = NULL;
-  PyObject *__pyx_1 = 0;
-  PyObject *__pyx_t_1 = NULL;
-  PyObject *__pyx_t_2 = NULL;
-  PyObject *__pyx_t_3 = NULL;
-  int __pyx_t_4;
-  int __pyx_t_5;
-  long __pyx_t_6;
-  long __pyx_t_7;
-  int __pyx_t_8;
-  long __pyx_t_9;
-  double __pyx_t_10;
-  __Pyx_SetupRefcountContext("EC1d");
-  __pyx_self = __pyx_self;
-  __pyx_bstruct_mask.buf = NULL;
-  if (unlikely(!__Pyx_ArgTypeTest(((PyObject *)__pyx_v_mask), __pyx_ptype_5numpy_ndarray, 1, "mask", 0))) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 1012; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  {
-    __Pyx_BufFmt_StackElem __pyx_stack[1];
-    if (unlikely(__Pyx_GetBufferAndValidate(&__pyx_bstruct_mask, (PyObject*)__pyx_v_mask, &__Pyx_TypeInfo_nn___pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_int_t, PyBUF_FORMAT| PyBUF_STRIDES, 1, 0, __pyx_stack) == -1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 1012; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  }
-  __pyx_bstride_0_mask = __pyx_bstruct_mask.strides[0];
-  __pyx_bshape_0_mask = __pyx_bstruct_mask.shape[0];
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":1053
- *     """
- * 
- *     if not set(np.unique(mask)).issubset([0,1]):             # <<<<<<<<<<<<<<
- *       raise ValueError('mask should be filled with 0/1 values, but be of type np.int')
- * 
- */
-  __pyx_1 = __Pyx_GetName(__pyx_m, __pyx_kp_np); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 1053; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_1);
-  __pyx_t_1 = PyObject_GetAttr(__pyx_1, __pyx_kp_unique); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 1053; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_1);
-  __Pyx_DECREF(__pyx_1); __pyx_1 = 0;
-  __pyx_t_2 = PyTuple_New(1); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 1053; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_2));
-  __Pyx_INCREF(__pyx_v_mask);
-  PyTuple_SET_ITEM(__pyx_t_2, 0, __pyx_v_mask);
-  __Pyx_GIVEREF(__pyx_v_mask);
-  __pyx_t_3 = PyObject_Call(__pyx_t_1, ((PyObject *)__pyx_t_2), NULL); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 1053; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_3);
-  __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-  __Pyx_DECREF(((PyObject *)__pyx_t_2)); __pyx_t_2 = 0;
-  __pyx_t_2 = PyTuple_New(1); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 1053; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_2));
-  PyTuple_SET_ITEM(__pyx_t_2, 0, __pyx_t_3);
-  __Pyx_GIVEREF(__pyx_t_3);
-  __pyx_t_3 = 0;
-  __pyx_t_3 = PyObject_Call(((PyObject *)((PyObject*)&PySet_Type)), ((PyObject *)__pyx_t_2), NULL); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 1053; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_3);
-  __Pyx_DECREF(((PyObject *)__pyx_t_2)); __pyx_t_2 = 0;
-  __pyx_t_2 = PyObject_GetAttr(__pyx_t_3, __pyx_kp_issubset); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 1053; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_2);
-  __Pyx_DECREF(__pyx_t_3); __pyx_t_3 = 0;
-  __pyx_t_3 = PyList_New(2); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 1053; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_3));
-  __Pyx_INCREF(__pyx_int_0);
-  PyList_SET_ITEM(__pyx_t_3, 0, __pyx_int_0);
-  __Pyx_GIVEREF(__pyx_int_0);
-  __Pyx_INCREF(__pyx_int_1);
-  PyList_SET_ITEM(__pyx_t_3, 1, __pyx_int_1);
-  __Pyx_GIVEREF(__pyx_int_1);
-  __pyx_t_1 = PyTuple_New(1); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 1053; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_1));
-  PyTuple_SET_ITEM(__pyx_t_1, 0, ((PyObject *)__pyx_t_3));
-  __Pyx_GIVEREF(((PyObject *)__pyx_t_3));
-  __pyx_t_3 = 0;
-  __pyx_t_3 = PyObject_Call(__pyx_t_2, ((PyObject *)__pyx_t_1), NULL); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 1053; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_3);
-  __Pyx_DECREF(__pyx_t_2); __pyx_t_2 = 0;
-  __Pyx_DECREF(((PyObject *)__pyx_t_1)); __pyx_t_1 = 0;
-  __pyx_t_4 = __Pyx_PyObject_IsTrue(__pyx_t_3); if (unlikely(__pyx_t_4 < 0)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 1053; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_DECREF(__pyx_t_3); __pyx_t_3 = 0;
-  __pyx_t_5 = (!__pyx_t_4);
-  if (__pyx_t_5) {
-
-    /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":1054
- * 
- *     if not set(np.unique(mask)).issubset([0,1]):
- *       raise ValueError('mask should be filled with 0/1 values, but be of type np.int')             # <<<<<<<<<<<<<<
- * 
- *     # 'flattened' coords (2d array)
- */
-    __pyx_t_3 = PyTuple_New(1); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 1054; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __Pyx_GOTREF(((PyObject *)__pyx_t_3));
-    __Pyx_INCREF(__pyx_kp_60);
-    PyTuple_SET_ITEM(__pyx_t_3, 0, __pyx_kp_60);
-    __Pyx_GIVEREF(__pyx_kp_60);
-    __pyx_t_1 = PyObject_Call(__pyx_builtin_ValueError, ((PyObject *)__pyx_t_3), NULL); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 1054; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __Pyx_GOTREF(__pyx_t_1);
-    __Pyx_DECREF(((PyObject *)__pyx_t_3)); __pyx_t_3 = 0;
-    __Pyx_Raise(__pyx_t_1, 0, 0);
-    __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-    {__pyx_filename = __pyx_f[0]; __pyx_lineno = 1054; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    goto __pyx_L5;
-  }
-  __pyx_L5:;
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":1062
- * 
- *     cdef long i, m, s0
- *     cdef double l0 = 0             # <<<<<<<<<<<<<<
- * 
- *     # First do the interior contributions.
- */
-  __pyx_v_l0 = 0;
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":1068
- *     # are uniquely associated with an interior voxel
- * 
- *     s0 = mask.shape[0]             # <<<<<<<<<<<<<<
- *     for i in range(s0):
- *       m = mask[i]
- */
-  __pyx_v_s0 = (((PyArrayObject *)__pyx_v_mask)->dimensions[0]);
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":1069
- * 
- *     s0 = mask.shape[0]
- *     for i in range(s0):             # <<<<<<<<<<<<<<
- *       m = mask[i]
- *       if m:
- */
-  for (__pyx_t_6 = 0; __pyx_t_6 < __pyx_v_s0; __pyx_t_6+=1) {
-    __pyx_v_i = __pyx_t_6;
-
-    /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":1070
- *     s0 = mask.shape[0]
- *     for i in range(s0):
- *       m = mask[i]             # <<<<<<<<<<<<<<
- *       if m:
- *         m = m * (mask[(i+1) % s0] * (i < s0))
- */
-    __pyx_t_7 = __pyx_v_i;
-    __pyx_t_8 = -1;
-    if (__pyx_t_7 < 0) {
-      __pyx_t_7 += __pyx_bshape_0_mask;
-      if (unlikely(__pyx_t_7 < 0)) __pyx_t_8 = 0;
-    } else if (unlikely(__pyx_t_7 >= __pyx_bshape_0_mask)) __pyx_t_8 = 0;
-    if (unlikely(__pyx_t_8 != -1)) {
-      __Pyx_RaiseBufferIndexError(__pyx_t_8);
-      {__pyx_filename = __pyx_f[0]; __pyx_lineno = 1070; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    }
-    __pyx_v_m = (*__Pyx_BufPtrStrided1d(__pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_int_t *, __pyx_bstruct_mask.buf, __pyx_t_7, __pyx_bstride_0_mask));
-
-    /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":1071
- *     for i in range(s0):
- *       m = mask[i]
- *       if m:             # <<<<<<<<<<<<<<
- *         m = m * (mask[(i+1) % s0] * (i < s0))
- *         l0 = l0 - m
- */
-    __pyx_t_9 = __pyx_v_m;
-    if (__pyx_t_9) {
-
-      /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":1072
- *       m = mask[i]
- *       if m:
- *         m = m * (mask[(i+1) % s0] * (i < s0))             # <<<<<<<<<<<<<<
- *         l0 = l0 - m
- * 
- */
-      __pyx_t_9 = ((__pyx_v_i + 1) % __pyx_v_s0);
-      __pyx_t_8 = -1;
-      if (__pyx_t_9 < 0) {
-        __pyx_t_9 += __pyx_bshape_0_mask;
-        if (unlikely(__pyx_t_9 < 0)) __pyx_t_8 = 0;
-      } else if (unlikely(__pyx_t_9 >= __pyx_bshape_0_mask)) __pyx_t_8 = 0;
-      if (unlikely(__pyx_t_8 != -1)) {
-        __Pyx_RaiseBufferIndexError(__pyx_t_8);
-        {__pyx_filename = __pyx_f[0]; __pyx_lineno = 1072; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-      }
-      __pyx_v_m = (__pyx_v_m * ((*__Pyx_BufPtrStrided1d(__pyx_t_4nipy_10algorithms_10statistics_6intvol_DTYPE_int_t *, __pyx_bstruct_mask.buf, __pyx_t_9, __pyx_bstride_0_mask)) * (__pyx_v_i < __pyx_v_s0)));
-
-      /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":1073
- *       if m:
- *         m = m * (mask[(i+1) % s0] * (i < s0))
- *         l0 = l0 - m             # <<<<<<<<<<<<<<
- * 
- *     l0 += mask.sum()
- */
-      __pyx_v_l0 = (__pyx_v_l0 - __pyx_v_m);
-      goto __pyx_L8;
-    }
-    __pyx_L8:;
-  }
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":1075
- *         l0 = l0 - m
- * 
- *     l0 += mask.sum()             # <<<<<<<<<<<<<<
- *     return l0
- */
-  __pyx_t_1 = PyObject_GetAttr(__pyx_v_mask, __pyx_kp_sum); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 1075; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_1);
-  __pyx_t_3 = PyObject_Call(__pyx_t_1, ((PyObject *)__pyx_empty_tuple), NULL); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 1075; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_3);
-  __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-  __pyx_t_10 = __pyx_PyFloat_AsDouble(__pyx_t_3); if (unlikely(PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 1075; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_DECREF(__pyx_t_3); __pyx_t_3 = 0;
-  __pyx_v_l0 += __pyx_t_10;
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":1076
- * 
- *     l0 += mask.sum()
- *     return l0             # <<<<<<<<<<<<<<
- */
-  __Pyx_XDECREF(__pyx_r);
-  __pyx_t_3 = PyFloat_FromDouble(__pyx_v_l0); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 1076; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_3);
-  __pyx_r = __pyx_t_3;
-  __pyx_t_3 = 0;
-  goto __pyx_L0;
-
-  __pyx_r = Py_None; __Pyx_INCREF(Py_None);
-  goto __pyx_L0;
-  __pyx_L1_error:;
-  __Pyx_XDECREF(__pyx_1);
-  __Pyx_XDECREF(__pyx_t_1);
-  __Pyx_XDECREF(__pyx_t_2);
-  __Pyx_XDECREF(__pyx_t_3);
-  { PyObject *__pyx_type, *__pyx_value, *__pyx_tb;
-    __Pyx_ErrFetch(&__pyx_type, &__pyx_value, &__pyx_tb);
-    __Pyx_SafeReleaseBuffer(&__pyx_bstruct_mask);
-  __Pyx_ErrRestore(__pyx_type, __pyx_value, __pyx_tb);}
-  __Pyx_AddTraceback("nipy.algorithms.statistics.intvol.EC1d");
-  __pyx_r = NULL;
-  goto __pyx_L2;
-  __pyx_L0:;
-  __Pyx_SafeReleaseBuffer(&__pyx_bstruct_mask);
-  __pyx_L2:;
-  __Pyx_XGIVEREF(__pyx_r);
-  __Pyx_FinishRefcountContext();
-  return __pyx_r;
-}
-
-/* "/home/mb312/usr/local/lib/python2.5/site-packages/Cython/Includes/numpy.pxd":65
- *         # experimental exception made for __getbuffer__ and __releasebuffer__
- *         # -- the details of this may change.
- *         def __getbuffer__(ndarray self, Py_buffer* info, int flags):             # <<<<<<<<<<<<<<
- *             # This implementation of getbuffer is geared towards Cython
- *             # requirements, and does not yet fullfill the PEP.
- */
-
-static int __pyx_pf_5numpy_7ndarray___getbuffer__(PyObject *__pyx_v_self, Py_buffer *__pyx_v_info, int __pyx_v_flags); /*proto*/
-static int __pyx_pf_5numpy_7ndarray___getbuffer__(PyObject *__pyx_v_self, Py_buffer *__pyx_v_info, int __pyx_v_flags) {
-  int __pyx_v_copy_shape;
-  int __pyx_v_i;
-  int __pyx_v_ndim;
-  int __pyx_v_endian_detector;
-  int __pyx_v_little_endian;
-  int __pyx_v_t;
-  char *__pyx_v_f;
-  PyArray_Descr *__pyx_v_descr = 0;
-  int __pyx_v_offset;
-  int __pyx_v_hasfields;
-  int __pyx_r;
-  int __pyx_t_1;
-  PyObject *__pyx_t_2 = NULL;
-  PyObject *__pyx_t_3 = NULL;
-  int __pyx_t_4;
-  int __pyx_t_5;
-  int __pyx_t_6;
-  char *__pyx_t_7;
-  __Pyx_SetupRefcountContext("__getbuffer__");
-  if (__pyx_v_info == NULL) return 0;
-  __pyx_v_info->obj = Py_None; __Pyx_INCREF(Py_None);
-  __Pyx_GIVEREF(__pyx_v_info->obj);
-
-  /* "/home/mb312/usr/local/lib/python2.5/site-packages/Cython/Includes/numpy.pxd":71
- *             # of flags
- *             cdef int copy_shape, i, ndim
- *             cdef int endian_detector = 1             # <<<<<<<<<<<<<<
- *             cdef bint little_endian = ((<char*>&endian_detector)[0] != 0)
- * 
- */
-  __pyx_v_endian_detector = 1;
-
-  /* "/home/mb312/usr/local/lib/python2.5/site-packages/Cython/Includes/numpy.pxd":72
- *             cdef int copy_shape, i, ndim
- *             cdef int endian_detector = 1
- *             cdef bint little_endian = ((<char*>&endian_detector)[0] != 0)             # <<<<<<<<<<<<<<
- * 
- *             ndim = PyArray_NDIM(self)
- */
-  __pyx_v_little_endian = ((((char *)(&__pyx_v_endian_detector))[0]) != 0);
-
-  /* "/home/mb312/usr/local/lib/python2.5/site-packages/Cython/Includes/numpy.pxd":74
- *             cdef bint little_endian = ((<char*>&endian_detector)[0] != 0)
- * 
- *             ndim = PyArray_NDIM(self)             # <<<<<<<<<<<<<<
- * 
- *             if sizeof(npy_intp) != sizeof(Py_ssize_t):
- */
-  __pyx_v_ndim = PyArray_NDIM(((PyArrayObject *)__pyx_v_self));
-
-  /* "/home/mb312/usr/local/lib/python2.5/site-packages/Cython/Includes/numpy.pxd":76
- *             ndim = PyArray_NDIM(self)
- * 
- *             if sizeof(npy_intp) != sizeof(Py_ssize_t):             # <<<<<<<<<<<<<<
- *                 copy_shape = 1
- *             else:
- */
-  __pyx_t_1 = ((sizeof(npy_intp)) != (sizeof(Py_ssize_t)));
-  if (__pyx_t_1) {
-
-    /* "/home/mb312/usr/local/lib/python2.5/site-packages/Cython/Includes/numpy.pxd":77
- * 
- *             if sizeof(npy_intp) != sizeof(Py_ssize_t):
- *                 copy_shape = 1             # <<<<<<<<<<<<<<
- *             else:
- *                 copy_shape = 0
- */
-    __pyx_v_copy_shape = 1;
-    goto __pyx_L5;
-  }
-  /*else*/ {
-
-    /* "/home/mb312/usr/local/lib/python2.5/site-packages/Cython/Includes/numpy.pxd":79
- *                 copy_shape = 1
- *             else:
- *                 copy_shape = 0             # <<<<<<<<<<<<<<
- * 
- *             if ((flags & pybuf.PyBUF_C_CONTIGUOUS == pybuf.PyBUF_C_CONTIGUOUS)
- */
-    __pyx_v_copy_shape = 0;
-  }
-  __pyx_L5:;
-
-  /* "/home/mb312/usr/local/lib/python2.5/site-packages/Cython/Includes/numpy.pxd":81
- *                 copy_shape = 0
- * 
- *             if ((flags & pybuf.PyBUF_C_CONTIGUOUS == pybuf.PyBUF_C_CONTIGUOUS)             # <<<<<<<<<<<<<<
- *                 and not PyArray_CHKFLAGS(self, NPY_C_CONTIGUOUS)):
- *                 raise ValueError("ndarray is not C contiguous")
- */
-  if (((__pyx_v_flags & PyBUF_C_CONTIGUOUS) == PyBUF_C_CONTIGUOUS)) {
-
-    /* "/home/mb312/usr/local/lib/python2.5/site-packages/Cython/Includes/numpy.pxd":82
- * 
- *             if ((flags & pybuf.PyBUF_C_CONTIGUOUS == pybuf.PyBUF_C_CONTIGUOUS)
- *                 and not PyArray_CHKFLAGS(self, NPY_C_CONTIGUOUS)):             # <<<<<<<<<<<<<<
- *                 raise ValueError("ndarray is not C contiguous")
- * 
- */
-    __pyx_t_1 = (!PyArray_CHKFLAGS(((PyArrayObject *)__pyx_v_self), NPY_C_CONTIGUOUS));
-  } else {
-    __pyx_t_1 = ((__pyx_v_flags & PyBUF_C_CONTIGUOUS) == PyBUF_C_CONTIGUOUS);
-  }
-  if (__pyx_t_1) {
-
-    /* "/home/mb312/usr/local/lib/python2.5/site-packages/Cython/Includes/numpy.pxd":83
- *             if ((flags & pybuf.PyBUF_C_CONTIGUOUS == pybuf.PyBUF_C_CONTIGUOUS)
- *                 and not PyArray_CHKFLAGS(self, NPY_C_CONTIGUOUS)):
- *                 raise ValueError("ndarray is not C contiguous")             # <<<<<<<<<<<<<<
- * 
- *             if ((flags & pybuf.PyBUF_F_CONTIGUOUS == pybuf.PyBUF_F_CONTIGUOUS)
- */
-    __pyx_t_2 = PyTuple_New(1); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 83; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __Pyx_GOTREF(((PyObject *)__pyx_t_2));
-    __Pyx_INCREF(__pyx_kp_1);
-    PyTuple_SET_ITEM(__pyx_t_2, 0, __pyx_kp_1);
-    __Pyx_GIVEREF(__pyx_kp_1);
-    __pyx_t_3 = PyObject_Call(__pyx_builtin_ValueError, ((PyObject *)__pyx_t_2), NULL); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 83; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __Pyx_GOTREF(__pyx_t_3);
-    __Pyx_DECREF(((PyObject *)__pyx_t_2)); __pyx_t_2 = 0;
-    __Pyx_Raise(__pyx_t_3, 0, 0);
-    __Pyx_DECREF(__pyx_t_3); __pyx_t_3 = 0;
-    {__pyx_filename = __pyx_f[1]; __pyx_lineno = 83; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    goto __pyx_L6;
-  }
-  __pyx_L6:;
-
-  /* "/home/mb312/usr/local/lib/python2.5/site-packages/Cython/Includes/numpy.pxd":85
- *                 raise ValueError("ndarray is not C contiguous")
- * 
- *             if ((flags & pybuf.PyBUF_F_CONTIGUOUS == pybuf.PyBUF_F_CONTIGUOUS)             # <<<<<<<<<<<<<<
- *                 and not PyArray_CHKFLAGS(self, NPY_F_CONTIGUOUS)):
- *                 raise ValueError("ndarray is not Fortran contiguous")
- */
-  if (((__pyx_v_flags & PyBUF_F_CONTIGUOUS) == PyBUF_F_CONTIGUOUS)) {
-
-    /* "/home/mb312/usr/local/lib/python2.5/site-packages/Cython/Includes/numpy.pxd":86
- * 
- *             if ((flags & pybuf.PyBUF_F_CONTIGUOUS == pybuf.PyBUF_F_CONTIGUOUS)
- *                 and not PyArray_CHKFLAGS(self, NPY_F_CONTIGUOUS)):             # <<<<<<<<<<<<<<
- *                 raise ValueError("ndarray is not Fortran contiguous")
- * 
- */
-    __pyx_t_1 = (!PyArray_CHKFLAGS(((PyArrayObject *)__pyx_v_self), NPY_F_CONTIGUOUS));
-  } else {
-    __pyx_t_1 = ((__pyx_v_flags & PyBUF_F_CONTIGUOUS) == PyBUF_F_CONTIGUOUS);
-  }
-  if (__pyx_t_1) {
-
-    /* "/home/mb312/usr/local/lib/python2.5/site-packages/Cython/Includes/numpy.pxd":87
- *             if ((flags & pybuf.PyBUF_F_CONTIGUOUS == pybuf.PyBUF_F_CONTIGUOUS)
- *                 and not PyArray_CHKFLAGS(self, NPY_F_CONTIGUOUS)):
- *                 raise ValueError("ndarray is not Fortran contiguous")             # <<<<<<<<<<<<<<
- * 
- *             info.buf = PyArray_DATA(self)
- */
-    __pyx_t_3 = PyTuple_New(1); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 87; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __Pyx_GOTREF(((PyObject *)__pyx_t_3));
-    __Pyx_INCREF(__pyx_kp_2);
-    PyTuple_SET_ITEM(__pyx_t_3, 0, __pyx_kp_2);
-    __Pyx_GIVEREF(__pyx_kp_2);
-    __pyx_t_2 = PyObject_Call(__pyx_builtin_ValueError, ((PyObject *)__pyx_t_3), NULL); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 87; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __Pyx_GOTREF(__pyx_t_2);
-    __Pyx_DECREF(((PyObject *)__pyx_t_3)); __pyx_t_3 = 0;
-    __Pyx_Raise(__pyx_t_2, 0, 0);
-    __Pyx_DECREF(__pyx_t_2); __pyx_t_2 = 0;
-    {__pyx_filename = __pyx_f[1]; __pyx_lineno = 87; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    goto __pyx_L7;
-  }
-  __pyx_L7:;
-
-  /* "/home/mb312/usr/local/lib/python2.5/site-packages/Cython/Includes/numpy.pxd":89
- *                 raise ValueError("ndarray is not Fortran contiguous")
- * 
- *             info.buf = PyArray_DATA(self)             # <<<<<<<<<<<<<<
- *             info.ndim = ndim
- *             if copy_shape:
- */
-  __pyx_v_info->buf = PyArray_DATA(((PyArrayObject *)__pyx_v_self));
-
-  /* "/home/mb312/usr/local/lib/python2.5/site-packages/Cython/Includes/numpy.pxd":90
- * 
- *             info.buf = PyArray_DATA(self)
- *             info.ndim = ndim             # <<<<<<<<<<<<<<
- *             if copy_shape:
- *                 # Allocate new buffer for strides and shape info. This is allocated
- */
-  __pyx_v_info->ndim = __pyx_v_ndim;
-
-  /* "/home/mb312/usr/local/lib/python2.5/site-packages/Cython/Includes/numpy.pxd":91
- *             info.buf = PyArray_DATA(self)
- *             info.ndim = ndim
- *             if copy_shape:             # <<<<<<<<<<<<<<
- *                 # Allocate new buffer for strides and shape info. This is allocated
- *                 # as one block, strides first.
- */
-  __pyx_t_4 = __pyx_v_copy_shape;
-  if (__pyx_t_4) {
-
-    /* "/home/mb312/usr/local/lib/python2.5/site-packages/Cython/Includes/numpy.pxd":94
- *                 # Allocate new buffer for strides and shape info. This is allocated
- *                 # as one block, strides first.
- *                 info.strides = <Py_ssize_t*>stdlib.malloc(sizeof(Py_ssize_t) * ndim * 2)             # <<<<<<<<<<<<<<
- *                 info.shape = info.strides + ndim
- *                 for i in range(ndim):
- */
-    __pyx_v_info->strides = ((Py_ssize_t *)malloc((((sizeof(Py_ssize_t)) * __pyx_v_ndim) * 2)));
-
-    /* "/home/mb312/usr/local/lib/python2.5/site-packages/Cython/Includes/numpy.pxd":95
- *                 # as one block, strides first.
- *                 info.strides = <Py_ssize_t*>stdlib.malloc(sizeof(Py_ssize_t) * ndim * 2)
- *                 info.shape = info.strides + ndim             # <<<<<<<<<<<<<<
- *                 for i in range(ndim):
- *                     info.strides[i] = PyArray_STRIDES(self)[i]
- */
-    __pyx_v_info->shape = (__pyx_v_info->strides + __pyx_v_ndim);
-
-    /* "/home/mb312/usr/local/lib/python2.5/site-packages/Cython/Includes/numpy.pxd":96
- *                 info.strides = <Py_ssize_t*>stdlib.malloc(sizeof(Py_ssize_t) * ndim * 2)
- *                 info.shape = info.strides + ndim
- *                 for i in range(ndim):             # <<<<<<<<<<<<<<
- *                     info.strides[i] = PyArray_STRIDES(self)[i]
- *                     info.shape[i] = PyArray_DIMS(self)[i]
- */
-    for (__pyx_t_4 = 0; __pyx_t_4 < __pyx_v_ndim; __pyx_t_4+=1) {
-      __pyx_v_i = __pyx_t_4;
-
-      /* "/home/mb312/usr/local/lib/python2.5/site-packages/Cython/Includes/numpy.pxd":97
- *                 info.shape = info.strides + ndim
- *                 for i in range(ndim):
- *                     info.strides[i] = PyArray_STRIDES(self)[i]             # <<<<<<<<<<<<<<
- *                     info.shape[i] = PyArray_DIMS(self)[i]
- *             else:
- */
-      (__pyx_v_info->strides[__pyx_v_i]) = (PyArray_STRIDES(((PyArrayObject *)__pyx_v_self))[__pyx_v_i]);
-
-      /* "/home/mb312/usr/local/lib/python2.5/site-packages/Cython/Includes/numpy.pxd":98
- *                 for i in range(ndim):
- *                     info.strides[i] = PyArray_STRIDES(self)[i]
- *                     info.shape[i] = PyArray_DIMS(self)[i]             # <<<<<<<<<<<<<<
- *             else:
- *                 info.strides = <Py_ssize_t*>PyArray_STRIDES(self)
- */
-      (__pyx_v_info->shape[__pyx_v_i]) = (PyArray_DIMS(((PyArrayObject *)__pyx_v_self))[__pyx_v_i]);
-    }
-    goto __pyx_L8;
-  }
-  /*else*/ {
-
-    /* "/home/mb312/usr/local/lib/python2.5/site-packages/Cython/Includes/numpy.pxd":100
- *                     info.shape[i] = PyArray_DIMS(self)[i]
- *             else:
- *                 info.strides = <Py_ssize_t*>PyArray_STRIDES(self)             # <<<<<<<<<<<<<<
- *                 info.shape = <Py_ssize_t*>PyArray_DIMS(self)
- *             info.suboffsets = NULL
- */
-    __pyx_v_info->strides = ((Py_ssize_t *)PyArray_STRIDES(((PyArrayObject *)__pyx_v_self)));
-
-    /* "/home/mb312/usr/local/lib/python2.5/site-packages/Cython/Includes/numpy.pxd":101
- *             else:
- *                 info.strides = <Py_ssize_t*>PyArray_STRIDES(self)
- *                 info.shape = <Py_ssize_t*>PyArray_DIMS(self)             # <<<<<<<<<<<<<<
- *             info.suboffsets = NULL
- *             info.itemsize = PyArray_ITEMSIZE(self)
- */
-    __pyx_v_info->shape = ((Py_ssize_t *)PyArray_DIMS(((PyArrayObject *)__pyx_v_self)));
-  }
-  __pyx_L8:;
-
-  /* "/home/mb312/usr/local/lib/python2.5/site-packages/Cython/Includes/numpy.pxd":102
- *                 info.strides = <Py_ssize_t*>PyArray_STRIDES(self)
- *                 info.shape = <Py_ssize_t*>PyArray_DIMS(self)
- *             info.suboffsets = NULL             # <<<<<<<<<<<<<<
- *             info.itemsize = PyArray_ITEMSIZE(self)
- *             info.readonly = not PyArray_ISWRITEABLE(self)
- */
-  __pyx_v_info->suboffsets = NULL;
-
-  /* "/home/mb312/usr/local/lib/python2.5/site-packages/Cython/Includes/numpy.pxd":103
- *                 info.shape = <Py_ssize_t*>PyArray_DIMS(self)
- *             info.suboffsets = NULL
- *             info.itemsize = PyArray_ITEMSIZE(self)             # <<<<<<<<<<<<<<
- *             info.readonly = not PyArray_ISWRITEABLE(self)
- * 
- */
-  __pyx_v_info->itemsize = PyArray_ITEMSIZE(((PyArrayObject *)__pyx_v_self));
-
-  /* "/home/mb312/usr/local/lib/python2.5/site-packages/Cython/Includes/numpy.pxd":104
- *             info.suboffsets = NULL
- *             info.itemsize = PyArray_ITEMSIZE(self)
- *             info.readonly = not PyArray_ISWRITEABLE(self)             # <<<<<<<<<<<<<<
- * 
- *             cdef int t
- */
-  __pyx_v_info->readonly = (!PyArray_ISWRITEABLE(((PyArrayObject *)__pyx_v_self)));
-
-  /* "/home/mb312/usr/local/lib/python2.5/site-packages/Cython/Includes/numpy.pxd":107
- * 
- *             cdef int t
- *             cdef char* f = NULL             # <<<<<<<<<<<<<<
- *             cdef dtype descr = self.descr
- *             cdef list stack
- */
-  __pyx_v_f = NULL;
-
-  /* "/home/mb312/usr/local/lib/python2.5/site-packages/Cython/Includes/numpy.pxd":108
- *             cdef int t
- *             cdef char* f = NULL
- *             cdef dtype descr = self.descr             # <<<<<<<<<<<<<<
- *             cdef list stack
- *             cdef int offset
- */
-  __Pyx_INCREF(((PyObject *)((PyArrayObject *)__pyx_v_self)->descr));
-  __pyx_v_descr = ((PyArrayObject *)__pyx_v_self)->descr;
-
-  /* "/home/mb312/usr/local/lib/python2.5/site-packages/Cython/Includes/numpy.pxd":112
- *             cdef int offset
- * 
- *             cdef bint hasfields = PyDataType_HASFIELDS(descr)             # <<<<<<<<<<<<<<
- * 
- *             if not hasfields and not copy_shape:
- */
-  __pyx_v_hasfields = PyDataType_HASFIELDS(__pyx_v_descr);
-
-  /* "/home/mb312/usr/local/lib/python2.5/site-packages/Cython/Includes/numpy.pxd":114
- *             cdef bint hasfields = PyDataType_HASFIELDS(descr)
- * 
- *             if not hasfields and not copy_shape:             # <<<<<<<<<<<<<<
- *                 # do not call releasebuffer
- *                 info.obj = None
- */
-  if ((!__pyx_v_hasfields)) {
-    __pyx_t_1 = (!__pyx_v_copy_shape);
-  } else {
-    __pyx_t_1 = (!__pyx_v_hasfields);
-  }
-  if (__pyx_t_1) {
-
-    /* "/home/mb312/usr/local/lib/python2.5/site-packages/Cython/Includes/numpy.pxd":116
- *             if not hasfields and not copy_shape:
- *                 # do not call releasebuffer
- *                 info.obj = None             # <<<<<<<<<<<<<<
- *             else:
- *                 # need to call releasebuffer
- */
-    __Pyx_INCREF(Py_None);
-    __Pyx_GIVEREF(Py_None);
-    __Pyx_GOTREF(__pyx_v_info->obj);
-    __Pyx_DECREF(__pyx_v_info->obj);
-    __pyx_v_info->obj = Py_None;
-    goto __pyx_L11;
-  }
-  /*else*/ {
-
-    /* "/home/mb312/usr/local/lib/python2.5/site-packages/Cython/Includes/numpy.pxd":119
- *             else:
- *                 # need to call releasebuffer
- *                 info.obj = self             # <<<<<<<<<<<<<<
- * 
- *             if not hasfields:
- */
-    __Pyx_INCREF(__pyx_v_self);
-    __Pyx_GIVEREF(__pyx_v_self);
-    __Pyx_GOTREF(__pyx_v_info->obj);
-    __Pyx_DECREF(__pyx_v_info->obj);
-    __pyx_v_info->obj = __pyx_v_self;
-  }
-  __pyx_L11:;
-
-  /* "/home/mb312/usr/local/lib/python2.5/site-packages/Cython/Includes/numpy.pxd":121
- *                 info.obj = self
- * 
- *             if not hasfields:             # <<<<<<<<<<<<<<
- *                 t = descr.type_num
- *                 if ((descr.byteorder == '>' and little_endian) or
- */
-  __pyx_t_1 = (!__pyx_v_hasfields);
-  if (__pyx_t_1) {
-
-    /* "/home/mb312/usr/local/lib/python2.5/site-packages/Cython/Includes/numpy.pxd":122
- * 
- *             if not hasfields:
- *                 t = descr.type_num             # <<<<<<<<<<<<<<
- *                 if ((descr.byteorder == '>' and little_endian) or
- *                     (descr.byteorder == '<' and not little_endian)):
- */
-    __pyx_v_t = __pyx_v_descr->type_num;
-
-    /* "/home/mb312/usr/local/lib/python2.5/site-packages/Cython/Includes/numpy.pxd":123
- *             if not hasfields:
- *                 t = descr.type_num
- *                 if ((descr.byteorder == '>' and little_endian) or             # <<<<<<<<<<<<<<
- *                     (descr.byteorder == '<' and not little_endian)):
- *                     raise ValueError("Non-native byte order not supported")
- */
-    if ((__pyx_v_descr->byteorder == '>')) {
-      __pyx_t_1 = __pyx_v_little_endian;
-    } else {
-      __pyx_t_1 = (__pyx_v_descr->byteorder == '>');
-    }
-    if (!__pyx_t_1) {
-
-      /* "/home/mb312/usr/local/lib/python2.5/site-packages/Cython/Includes/numpy.pxd":124
- *                 t = descr.type_num
- *                 if ((descr.byteorder == '>' and little_endian) or
- *                     (descr.byteorder == '<' and not little_endian)):             # <<<<<<<<<<<<<<
- *                     raise ValueError("Non-native byte order not supported")
- *                 if   t == NPY_BYTE:        f = "b"
- */
-      if ((__pyx_v_descr->byteorder == '<')) {
-        __pyx_t_5 = (!__pyx_v_little_endian);
-      } else {
-        __pyx_t_5 = (__pyx_v_descr->byteorder == '<');
-      }
-      __pyx_t_6 = __pyx_t_5;
-    } else {
-      __pyx_t_6 = __pyx_t_1;
-    }
-    if (__pyx_t_6) {
-
-      /* "/home/mb312/usr/local/lib/python2.5/site-packages/Cython/Includes/numpy.pxd":125
- *                 if ((descr.byteorder == '>' and little_endian) or
- *                     (descr.byteorder == '<' and not little_endian)):
- *                     raise ValueError("Non-native byte order not supported")             # <<<<<<<<<<<<<<
- *                 if   t == NPY_BYTE:        f = "b"
- *                 elif t == NPY_UBYTE:       f = "B"
- */
-      __pyx_t_2 = PyTuple_New(1); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 125; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-      __Pyx_GOTREF(((PyObject *)__pyx_t_2));
-      __Pyx_INCREF(__pyx_kp_5);
-      PyTuple_SET_ITEM(__pyx_t_2, 0, __pyx_kp_5);
-      __Pyx_GIVEREF(__pyx_kp_5);
-      __pyx_t_3 = PyObject_Call(__pyx_builtin_ValueError, ((PyObject *)__pyx_t_2), NULL); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 125; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-      __Pyx_GOTREF(__pyx_t_3);
-      __Pyx_DECREF(((PyObject *)__pyx_t_2)); __pyx_t_2 = 0;
-      __Pyx_Raise(__pyx_t_3, 0, 0);
-      __Pyx_DECREF(__pyx_t_3); __pyx_t_3 = 0;
-      {__pyx_filename = __pyx_f[1]; __pyx_lineno = 125; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-      goto __pyx_L13;
-    }
-    __pyx_L13:;
-
-    /* "/home/mb312/usr/local/lib/python2.5/site-packages/Cython/Includes/numpy.pxd":126
- *                     (descr.byteorder == '<' and not little_endian)):
- *                     raise ValueError("Non-native byte order not supported")
- *                 if   t == NPY_BYTE:        f = "b"             # <<<<<<<<<<<<<<
- *                 elif t == NPY_UBYTE:       f = "B"
- *                 elif t == NPY_SHORT:       f = "h"
- */
-    switch (__pyx_v_t) {
-      case NPY_BYTE:
-      __pyx_v_f = __pyx_k_6;
-      break;
-
-      /* "/home/mb312/usr/local/lib/python2.5/site-packages/Cython/Includes/numpy.pxd":127
- *                     raise ValueError("Non-native byte order not supported")
- *                 if   t == NPY_BYTE:        f = "b"
- *                 elif t == NPY_UBYTE:       f = "B"             # <<<<<<<<<<<<<<
- *                 elif t == NPY_SHORT:       f = "h"
- *                 elif t == NPY_USHORT:      f = "H"
- */
-      case NPY_UBYTE:
-      __pyx_v_f = __pyx_k_7;
-      break;
-
-      /* "/home/mb312/usr/local/lib/python2.5/site-packages/Cython/Includes/numpy.pxd":128
- *                 if   t == NPY_BYTE:        f = "b"
- *                 elif t == NPY_UBYTE:       f = "B"
- *                 elif t == NPY_SHORT:       f = "h"             # <<<<<<<<<<<<<<
- *                 elif t == NPY_USHORT:      f = "H"
- *                 elif t == NPY_INT:         f = "i"
- */
-      case NPY_SHORT:
-      __pyx_v_f = __pyx_k_8;
-      break;
-
-      /* "/home/mb312/usr/local/lib/python2.5/site-packages/Cython/Includes/numpy.pxd":129
- *                 elif t == NPY_UBYTE:       f = "B"
- *                 elif t == NPY_SHORT:       f = "h"
- *                 elif t == NPY_USHORT:      f = "H"             # <<<<<<<<<<<<<<
- *                 elif t == NPY_INT:         f = "i"
- *                 elif t == NPY_UINT:        f = "I"
- */
-      case NPY_USHORT:
-      __pyx_v_f = __pyx_k_9;
-      break;
-
-      /* "/home/mb312/usr/local/lib/python2.5/site-packages/Cython/Includes/numpy.pxd":130
- *                 elif t == NPY_SHORT:       f = "h"
- *                 elif t == NPY_USHORT:      f = "H"
- *                 elif t == NPY_INT:         f = "i"             # <<<<<<<<<<<<<<
- *                 elif t == NPY_UINT:        f = "I"
- *                 elif t == NPY_LONG:        f = "l"
- */
-      case NPY_INT:
-      __pyx_v_f = __pyx_k_10;
-      break;
-
-      /* "/home/mb312/usr/local/lib/python2.5/site-packages/Cython/Includes/numpy.pxd":131
- *                 elif t == NPY_USHORT:      f = "H"
- *                 elif t == NPY_INT:         f = "i"
- *                 elif t == NPY_UINT:        f = "I"             # <<<<<<<<<<<<<<
- *                 elif t == NPY_LONG:        f = "l"
- *                 elif t == NPY_ULONG:       f = "L"
- */
-      case NPY_UINT:
-      __pyx_v_f = __pyx_k_11;
-      break;
-
-      /* "/home/mb312/usr/local/lib/python2.5/site-packages/Cython/Includes/numpy.pxd":132
- *                 elif t == NPY_INT:         f = "i"
- *                 elif t == NPY_UINT:        f = "I"
- *                 elif t == NPY_LONG:        f = "l"             # <<<<<<<<<<<<<<
- *                 elif t == NPY_ULONG:       f = "L"
- *                 elif t == NPY_LONGLONG:    f = "q"
- */
-      case NPY_LONG:
-      __pyx_v_f = __pyx_k_12;
-      break;
-
-      /* "/home/mb312/usr/local/lib/python2.5/site-packages/Cython/Includes/numpy.pxd":133
- *                 elif t == NPY_UINT:        f = "I"
- *                 elif t == NPY_LONG:        f = "l"
- *                 elif t == NPY_ULONG:       f = "L"             # <<<<<<<<<<<<<<
- *                 elif t == NPY_LONGLONG:    f = "q"
- *                 elif t == NPY_ULONGLONG:   f = "Q"
- */
-      case NPY_ULONG:
-      __pyx_v_f = __pyx_k_13;
-      break;
-
-      /* "/home/mb312/usr/local/lib/python2.5/site-packages/Cython/Includes/numpy.pxd":134
- *                 elif t == NPY_LONG:        f = "l"
- *                 elif t == NPY_ULONG:       f = "L"
- *                 elif t == NPY_LONGLONG:    f = "q"             # <<<<<<<<<<<<<<
- *                 elif t == NPY_ULONGLONG:   f = "Q"
- *                 elif t == NPY_FLOAT:       f = "f"
- */
-      case NPY_LONGLONG:
-      __pyx_v_f = __pyx_k_14;
-      break;
-
-      /* "/home/mb312/usr/local/lib/python2.5/site-packages/Cython/Includes/numpy.pxd":135
- *                 elif t == NPY_ULONG:       f = "L"
- *                 elif t == NPY_LONGLONG:    f = "q"
- *                 elif t == NPY_ULONGLONG:   f = "Q"             # <<<<<<<<<<<<<<
- *                 elif t == NPY_FLOAT:       f = "f"
- *                 elif t == NPY_DOUBLE:      f = "d"
- */
-      case NPY_ULONGLONG:
-      __pyx_v_f = __pyx_k_15;
-      break;
-
-      /* "/home/mb312/usr/local/lib/python2.5/site-packages/Cython/Includes/numpy.pxd":136
- *                 elif t == NPY_LONGLONG:    f = "q"
- *                 elif t == NPY_ULONGLONG:   f = "Q"
- *                 elif t == NPY_FLOAT:       f = "f"             # <<<<<<<<<<<<<<
- *                 elif t == NPY_DOUBLE:      f = "d"
- *                 elif t == NPY_LONGDOUBLE:  f = "g"
- */
-      case NPY_FLOAT:
-      __pyx_v_f = __pyx_k_16;
-      break;
-
-      /* "/home/mb312/usr/local/lib/python2.5/site-packages/Cython/Includes/numpy.pxd":137
- *                 elif t == NPY_ULONGLONG:   f = "Q"
- *                 elif t == NPY_FLOAT:       f = "f"
- *                 elif t == NPY_DOUBLE:      f = "d"             # <<<<<<<<<<<<<<
- *                 elif t == NPY_LONGDOUBLE:  f = "g"
- *                 elif t == NPY_CFLOAT:      f = "Zf"
- */
-      case NPY_DOUBLE:
-      __pyx_v_f = __pyx_k_17;
-      break;
-
-      /* "/home/mb312/usr/local/lib/python2.5/site-packages/Cython/Includes/numpy.pxd":138
- *                 elif t == NPY_FLOAT:       f = "f"
- *                 elif t == NPY_DOUBLE:      f = "d"
- *                 elif t == NPY_LONGDOUBLE:  f = "g"             # <<<<<<<<<<<<<<
- *                 elif t == NPY_CFLOAT:      f = "Zf"
- *                 elif t == NPY_CDOUBLE:     f = "Zd"
- */
-      case NPY_LONGDOUBLE:
-      __pyx_v_f = __pyx_k_18;
-      break;
-
-      /* "/home/mb312/usr/local/lib/python2.5/site-packages/Cython/Includes/numpy.pxd":139
- *                 elif t == NPY_DOUBLE:      f = "d"
- *                 elif t == NPY_LONGDOUBLE:  f = "g"
- *                 elif t == NPY_CFLOAT:      f = "Zf"             # <<<<<<<<<<<<<<
- *                 elif t == NPY_CDOUBLE:     f = "Zd"
- *                 elif t == NPY_CLONGDOUBLE: f = "Zg"
- */
-      case NPY_CFLOAT:
-      __pyx_v_f = __pyx_k_19;
-      break;
-
-      /* "/home/mb312/usr/local/lib/python2.5/site-packages/Cython/Includes/numpy.pxd":140
- *                 elif t == NPY_LONGDOUBLE:  f = "g"
- *                 elif t == NPY_CFLOAT:      f = "Zf"
- *                 elif t == NPY_CDOUBLE:     f = "Zd"             # <<<<<<<<<<<<<<
- *                 elif t == NPY_CLONGDOUBLE: f = "Zg"
- *                 elif t == NPY_OBJECT:      f = "O"
- */
-      case NPY_CDOUBLE:
-      __pyx_v_f = __pyx_k_20;
-      break;
-
-      /* "/home/mb312/usr/local/lib/python2.5/site-packages/Cython/Includes/numpy.pxd":141
- *                 elif t == NPY_CFLOAT:      f = "Zf"
- *                 elif t == NPY_CDOUBLE:     f = "Zd"
- *                 elif t == NPY_CLONGDOUBLE: f = "Zg"             # <<<<<<<<<<<<<<
- *                 elif t == NPY_OBJECT:      f = "O"
- *                 else:
- */
-      case NPY_CLONGDOUBLE:
-      __pyx_v_f = __pyx_k_21;
-      break;
-
-      /* "/home/mb312/usr/local/lib/python2.5/site-packages/Cython/Includes/numpy.pxd":142
- *                 elif t == NPY_CDOUBLE:     f = "Zd"
- *                 elif t == NPY_CLONGDOUBLE: f = "Zg"
- *                 elif t == NPY_OBJECT:      f = "O"             # <<<<<<<<<<<<<<
- *                 else:
- *                     raise ValueError("unknown dtype code in numpy.pxd (%d)" % t)
- */
-      case NPY_OBJECT:
-      __pyx_v_f = __pyx_k_22;
-      break;
-      default:
-
-      /* "/home/mb312/usr/local/lib/python2.5/site-packages/Cython/Includes/numpy.pxd":144
- *                 elif t == NPY_OBJECT:      f = "O"
- *                 else:
- *                     raise ValueError("unknown dtype code in numpy.pxd (%d)" % t)             # <<<<<<<<<<<<<<
- *                 info.format = f
- *                 return
- */
-      __pyx_t_3 = PyInt_FromLong(__pyx_v_t); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 144; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-      __Pyx_GOTREF(__pyx_t_3);
-      __pyx_t_2 = PyNumber_Remainder(__pyx_kp_23, __pyx_t_3); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 144; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-      __Pyx_GOTREF(__pyx_t_2);
-      __Pyx_DECREF(__pyx_t_3); __pyx_t_3 = 0;
-      __pyx_t_3 = PyTuple_New(1); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 144; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-      __Pyx_GOTREF(((PyObject *)__pyx_t_3));
-      PyTuple_SET_ITEM(__pyx_t_3, 0, __pyx_t_2);
-      __Pyx_GIVEREF(__pyx_t_2);
-      __pyx_t_2 = 0;
-      __pyx_t_2 = PyObject_Call(__pyx_builtin_ValueError, ((PyObject *)__pyx_t_3), NULL); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 144; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-      __Pyx_GOTREF(__pyx_t_2);
-      __Pyx_DECREF(((PyObject *)__pyx_t_3)); __pyx_t_3 = 0;
-      __Pyx_Raise(__pyx_t_2, 0, 0);
-      __Pyx_DECREF(__pyx_t_2); __pyx_t_2 = 0;
-      {__pyx_filename = __pyx_f[1]; __pyx_lineno = 144; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-      break;
-    }
-
-    /* "/home/mb312/usr/local/lib/python2.5/site-packages/Cython/Includes/numpy.pxd":145
- *                 else:
- *                     raise ValueError("unknown dtype code in numpy.pxd (%d)" % t)
- *                 info.format = f             # <<<<<<<<<<<<<<
- *                 return
- *             else:
- */
-    __pyx_v_info->format = __pyx_v_f;
-
-    /* "/home/mb312/usr/local/lib/python2.5/site-packages/Cython/Includes/numpy.pxd":146
- *                     raise ValueError("unknown dtype code in numpy.pxd (%d)" % t)
- *                 info.format = f
- *                 return             # <<<<<<<<<<<<<<
- *             else:
- *                 info.format = <char*>stdlib.malloc(_buffer_format_string_len)
- */
-    __pyx_r = 0;
-    goto __pyx_L0;
-    goto __pyx_L12;
-  }
-  /*else*/ {
-
-    /* "/home/mb312/usr/local/lib/python2.5/site-packages/Cython/Includes/numpy.pxd":148
- *                 return
- *             else:
- *                 info.format = <char*>stdlib.malloc(_buffer_format_string_len)             # <<<<<<<<<<<<<<
- *                 info.format[0] = '^' # Native data types, manual alignment
- *                 offset = 0
- */
-    __pyx_v_info->format = ((char *)malloc(255));
-
-    /* "/home/mb312/usr/local/lib/python2.5/site-packages/Cython/Includes/numpy.pxd":149
- *             else:
- *                 info.format = <char*>stdlib.malloc(_buffer_format_string_len)
- *                 info.format[0] = '^' # Native data types, manual alignment             # <<<<<<<<<<<<<<
- *                 offset = 0
- *                 f = _util_dtypestring(descr, info.format + 1,
- */
-    (__pyx_v_info->format[0]) = '^';
-
-    /* "/home/mb312/usr/local/lib/python2.5/site-packages/Cython/Includes/numpy.pxd":150
- *                 info.format = <char*>stdlib.malloc(_buffer_format_string_len)
- *                 info.format[0] = '^' # Native data types, manual alignment
- *                 offset = 0             # <<<<<<<<<<<<<<
- *                 f = _util_dtypestring(descr, info.format + 1,
- *                                       info.format + _buffer_format_string_len,
- */
-    __pyx_v_offset = 0;
-
-    /* "/home/mb312/usr/local/lib/python2.5/site-packages/Cython/Includes/numpy.pxd":153
- *                 f = _util_dtypestring(descr, info.format + 1,
- *                                       info.format + _buffer_format_string_len,
- *                                       &offset)             # <<<<<<<<<<<<<<
- *                 f[0] = 0 # Terminate format string
- * 
- */
-    __pyx_t_7 = __pyx_f_5numpy__util_dtypestring(__pyx_v_descr, (__pyx_v_info->format + 1), (__pyx_v_info->format + 255), (&__pyx_v_offset)); if (unlikely(__pyx_t_7 == NULL)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 151; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __pyx_v_f = __pyx_t_7;
-
-    /* "/home/mb312/usr/local/lib/python2.5/site-packages/Cython/Includes/numpy.pxd":154
- *                                       info.format + _buffer_format_string_len,
- *                                       &offset)
- *                 f[0] = 0 # Terminate format string             # <<<<<<<<<<<<<<
- * 
- *         def __releasebuffer__(ndarray self, Py_buffer* info):
- */
-    (__pyx_v_f[0]) = 0;
-  }
-  __pyx_L12:;
-
-  __pyx_r = 0;
-  goto __pyx_L0;
-  __pyx_L1_error:;
-  __Pyx_XDECREF(__pyx_t_2);
-  __Pyx_XDECREF(__pyx_t_3);
-  __Pyx_AddTraceback("numpy.ndarray.__getbuffer__");
-  __pyx_r = -1;
-  __Pyx_GOTREF(__pyx_v_info->obj);
-  __Pyx_DECREF(__pyx_v_info->obj); __pyx_v_info->obj = NULL;
-  goto __pyx_L2;
-  __pyx_L0:;
-  if (__pyx_v_info->obj == Py_None) {
-    __Pyx_GOTREF(Py_None);
-    __Pyx_DECREF(Py_None); __pyx_v_info->obj = NULL;
-  }
-  __pyx_L2:;
-  __Pyx_XDECREF((PyObject *)__pyx_v_descr);
-  __Pyx_FinishRefcountContext();
-  return __pyx_r;
-}
-
-/* "/home/mb312/usr/local/lib/python2.5/site-packages/Cython/Includes/numpy.pxd":156
- *                 f[0] = 0 # Terminate format string
- * 
- *         def __releasebuffer__(ndarray self, Py_buffer* info):             # <<<<<<<<<<<<<<
- *             if PyArray_HASFIELDS(self):
- *                 stdlib.free(info.format)
- */
-
-static void __pyx_pf_5numpy_7ndarray___releasebuffer__(PyObject *__pyx_v_self, Py_buffer *__pyx_v_info); /*proto*/
-static void __pyx_pf_5numpy_7ndarray___releasebuffer__(PyObject *__pyx_v_self, Py_buffer *__pyx_v_info) {
-  int __pyx_t_1;
-  int __pyx_t_2;
-  __Pyx_SetupRefcountContext("__releasebuffer__");
-
-  /* "/home/mb312/usr/local/lib/python2.5/site-packages/Cython/Includes/numpy.pxd":157
- * 
- *         def __releasebuffer__(ndarray self, Py_buffer* info):
- *             if PyArray_HASFIELDS(self):             # <<<<<<<<<<<<<<
- *                 stdlib.free(info.format)
- *             if sizeof(npy_intp) != sizeof(Py_ssize_t):
- */
-  __pyx_t_1 = PyArray_HASFIELDS(((PyArrayObject *)__pyx_v_self));
-  if (__pyx_t_1) {
-
-    /* "/home/mb312/usr/local/lib/python2.5/site-packages/Cython/Includes/numpy.pxd":158
- *         def __releasebuffer__(ndarray self, Py_buffer* info):
- *             if PyArray_HASFIELDS(self):
- *                 stdlib.free(info.format)             # <<<<<<<<<<<<<<
- *             if sizeof(npy_intp) != sizeof(Py_ssize_t):
- *                 stdlib.free(info.strides)
- */
-    free(__pyx_v_info->format);
-    goto __pyx_L5;
-  }
-  __pyx_L5:;
-
-  /* "/home/mb312/usr/local/lib/python2.5/site-packages/Cython/Includes/numpy.pxd":159
- *             if PyArray_HASFIELDS(self):
- *                 stdlib.free(info.format)
- *             if sizeof(npy_intp) != sizeof(Py_ssize_t):             # <<<<<<<<<<<<<<
- *                 stdlib.free(info.strides)
- *                 # info.shape was stored after info.strides in the same block
- */
-  __pyx_t_2 = ((sizeof(npy_intp)) != (sizeof(Py_ssize_t)));
-  if (__pyx_t_2) {
-
-    /* "/home/mb312/usr/local/lib/python2.5/site-packages/Cython/Includes/numpy.pxd":160
- *                 stdlib.free(info.format)
- *             if sizeof(npy_intp) != sizeof(Py_ssize_t):
- *                 stdlib.free(info.strides)             # <<<<<<<<<<<<<<
- *                 # info.shape was stored after info.strides in the same block
- * 
- */
-    free(__pyx_v_info->strides);
-    goto __pyx_L6;
-  }
-  __pyx_L6:;
-
-  __Pyx_FinishRefcountContext();
-}
-
-/* "/home/mb312/usr/local/lib/python2.5/site-packages/Cython/Includes/numpy.pxd":277
- * ctypedef npy_cdouble     complex_t
- * 
- * cdef inline char* _util_dtypestring(dtype descr, char* f, char* end, int* offset) except NULL:             # <<<<<<<<<<<<<<
- *     # Recursive utility function used in __getbuffer__ to get format
- *     # string. The new location in the format string is returned.
- */
-
-static INLINE char *__pyx_f_5numpy__util_dtypestring(PyArray_Descr *__pyx_v_descr, char *__pyx_v_f, char *__pyx_v_end, int *__pyx_v_offset) {
-  PyArray_Descr *__pyx_v_child;
-  PyObject *__pyx_v_i;
-  int __pyx_v_endian_detector;
-  int __pyx_v_little_endian;
-  PyObject *__pyx_v_new_offset;
-  PyObject *__pyx_v_t;
-  char *__pyx_r;
-  PyObject *__pyx_1 = 0;
-  Py_ssize_t __pyx_t_1;
-  PyObject *__pyx_t_2 = NULL;
-  PyObject *__pyx_t_3 = NULL;
-  PyObject *__pyx_t_4 = NULL;
-  PyObject *__pyx_t_5 = NULL;
-  int __pyx_t_6;
-  int __pyx_t_7;
-  int __pyx_t_8;
-  char *__pyx_t_9;
-  __Pyx_SetupRefcountContext("_util_dtypestring");
-  __pyx_v_child = ((PyArray_Descr *)Py_None); __Pyx_INCREF(Py_None);
-  __pyx_v_i = ((PyObject *)Py_None); __Pyx_INCREF(Py_None);
-  __pyx_v_new_offset = Py_None; __Pyx_INCREF(Py_None);
-  __pyx_v_t = Py_None; __Pyx_INCREF(Py_None);
-
-  /* "/home/mb312/usr/local/lib/python2.5/site-packages/Cython/Includes/numpy.pxd":284
- *     cdef int delta_offset
- *     cdef tuple i
- *     cdef int endian_detector = 1             # <<<<<<<<<<<<<<
- *     cdef bint little_endian = ((<char*>&endian_detector)[0] != 0)
- * 
- */
-  __pyx_v_endian_detector = 1;
-
-  /* "/home/mb312/usr/local/lib/python2.5/site-packages/Cython/Includes/numpy.pxd":285
- *     cdef tuple i
- *     cdef int endian_detector = 1
- *     cdef bint little_endian = ((<char*>&endian_detector)[0] != 0)             # <<<<<<<<<<<<<<
- * 
- *     for i in descr.fields.itervalues():
- */
-  __pyx_v_little_endian = ((((char *)(&__pyx_v_endian_detector))[0]) != 0);
-
-  /* "/home/mb312/usr/local/lib/python2.5/site-packages/Cython/Includes/numpy.pxd":287
- *     cdef bint little_endian = ((<char*>&endian_detector)[0] != 0)
- * 
- *     for i in descr.fields.itervalues():             # <<<<<<<<<<<<<<
- *         child = i[0]
- *         new_offset = i[1]
- */
-  __pyx_t_2 = PyObject_GetAttr(__pyx_v_descr->fields, __pyx_kp_itervalues); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 287; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_2);
-  __pyx_t_3 = PyObject_Call(__pyx_t_2, ((PyObject *)__pyx_empty_tuple), NULL); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 287; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_3);
-  __Pyx_DECREF(__pyx_t_2); __pyx_t_2 = 0;
-  if (PyList_CheckExact(__pyx_t_3) || PyTuple_CheckExact(__pyx_t_3)) {
-    __pyx_t_1 = 0; __pyx_t_2 = __pyx_t_3; __Pyx_INCREF(__pyx_t_2);
-  } else {
-    __pyx_t_1 = -1; __pyx_t_2 = PyObject_GetIter(__pyx_t_3); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 287; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __Pyx_GOTREF(__pyx_t_2);
-  }
-  __Pyx_DECREF(__pyx_t_3); __pyx_t_3 = 0;
-  for (;;) {
-    if (likely(PyList_CheckExact(__pyx_t_2))) {
-      if (__pyx_t_1 >= PyList_GET_SIZE(__pyx_t_2)) break;
-      __pyx_t_3 = PyList_GET_ITEM(__pyx_t_2, __pyx_t_1); __Pyx_INCREF(__pyx_t_3); __pyx_t_1++;
-    } else if (likely(PyTuple_CheckExact(__pyx_t_2))) {
-      if (__pyx_t_1 >= PyTuple_GET_SIZE(__pyx_t_2)) break;
-      __pyx_t_3 = PyTuple_GET_ITEM(__pyx_t_2, __pyx_t_1); __Pyx_INCREF(__pyx_t_3); __pyx_t_1++;
-    } else {
-      __pyx_t_3 = PyIter_Next(__pyx_t_2);
-      if (!__pyx_t_3) {
-        if (unlikely(PyErr_Occurred())) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 287; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-        break;
-      }
-      __Pyx_GOTREF(__pyx_t_3);
-    }
-    if (!(likely(PyTuple_CheckExact(__pyx_t_3)) || (__pyx_t_3) == Py_None || (PyErr_Format(PyExc_TypeError, "Expected tuple, got %s", Py_TYPE(__pyx_t_3)->tp_name), 0))) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 287; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __Pyx_DECREF(((PyObject *)__pyx_v_i));
-    __pyx_v_i = ((PyObject *)__pyx_t_3);
-    __pyx_t_3 = 0;
-
-    /* "/home/mb312/usr/local/lib/python2.5/site-packages/Cython/Includes/numpy.pxd":288
- * 
- *     for i in descr.fields.itervalues():
- *         child = i[0]             # <<<<<<<<<<<<<<
- *         new_offset = i[1]
- * 
- */
-    __pyx_1 = __Pyx_GetItemInt_Tuple(((PyObject *)__pyx_v_i), 0, sizeof(long), PyInt_FromLong); if (!__pyx_1) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 288; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __Pyx_GOTREF(__pyx_1);
-    if (!(__Pyx_TypeTest(__pyx_1, __pyx_ptype_5numpy_dtype))) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 288; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __Pyx_DECREF(((PyObject *)__pyx_v_child));
-    __pyx_v_child = ((PyArray_Descr *)__pyx_1);
-    __pyx_1 = 0;
-
-    /* "/home/mb312/usr/local/lib/python2.5/site-packages/Cython/Includes/numpy.pxd":289
- *     for i in descr.fields.itervalues():
- *         child = i[0]
- *         new_offset = i[1]             # <<<<<<<<<<<<<<
- * 
- *         if (end - f) - (new_offset - offset[0]) < 15:
- */
-    __pyx_1 = __Pyx_GetItemInt_Tuple(((PyObject *)__pyx_v_i), 1, sizeof(long), PyInt_FromLong); if (!__pyx_1) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 289; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __Pyx_GOTREF(__pyx_1);
-    __Pyx_DECREF(__pyx_v_new_offset);
-    __pyx_v_new_offset = __pyx_1;
-    __pyx_1 = 0;
-
-    /* "/home/mb312/usr/local/lib/python2.5/site-packages/Cython/Includes/numpy.pxd":291
- *         new_offset = i[1]
- * 
- *         if (end - f) - (new_offset - offset[0]) < 15:             # <<<<<<<<<<<<<<
- *             raise RuntimeError("Format string allocated too short, see comment in numpy.pxd")
- * 
- */
-    __pyx_t_3 = PyInt_FromLong((__pyx_v_end - __pyx_v_f)); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 291; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __Pyx_GOTREF(__pyx_t_3);
-    __pyx_t_4 = PyInt_FromLong((__pyx_v_offset[0])); if (unlikely(!__pyx_t_4)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 291; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __Pyx_GOTREF(__pyx_t_4);
-    __pyx_t_5 = PyNumber_Subtract(__pyx_v_new_offset, __pyx_t_4); if (unlikely(!__pyx_t_5)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 291; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __Pyx_GOTREF(__pyx_t_5);
-    __Pyx_DECREF(__pyx_t_4); __pyx_t_4 = 0;
-    __pyx_t_4 = PyNumber_Subtract(__pyx_t_3, __pyx_t_5); if (unlikely(!__pyx_t_4)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 291; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __Pyx_GOTREF(__pyx_t_4);
-    __Pyx_DECREF(__pyx_t_3); __pyx_t_3 = 0;
-    __Pyx_DECREF(__pyx_t_5); __pyx_t_5 = 0;
-    __pyx_t_5 = PyObject_RichCompare(__pyx_t_4, __pyx_int_15, Py_LT); if (unlikely(!__pyx_t_5)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 291; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __Pyx_GOTREF(__pyx_t_5);
-    __Pyx_DECREF(__pyx_t_4); __pyx_t_4 = 0;
-    __pyx_t_6 = __Pyx_PyObject_IsTrue(__pyx_t_5); if (unlikely(__pyx_t_6 < 0)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 291; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __Pyx_DECREF(__pyx_t_5); __pyx_t_5 = 0;
-    if (__pyx_t_6) {
-
-      /* "/home/mb312/usr/local/lib/python2.5/site-packages/Cython/Includes/numpy.pxd":292
- * 
- *         if (end - f) - (new_offset - offset[0]) < 15:
- *             raise RuntimeError("Format string allocated too short, see comment in numpy.pxd")             # <<<<<<<<<<<<<<
- * 
- *         if ((child.byteorder == '>' and little_endian) or
- */
-      __pyx_t_5 = PyTuple_New(1); if (unlikely(!__pyx_t_5)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 292; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-      __Pyx_GOTREF(((PyObject *)__pyx_t_5));
-      __Pyx_INCREF(__pyx_kp_25);
-      PyTuple_SET_ITEM(__pyx_t_5, 0, __pyx_kp_25);
-      __Pyx_GIVEREF(__pyx_kp_25);
-      __pyx_t_4 = PyObject_Call(__pyx_builtin_RuntimeError, ((PyObject *)__pyx_t_5), NULL); if (unlikely(!__pyx_t_4)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 292; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-      __Pyx_GOTREF(__pyx_t_4);
-      __Pyx_DECREF(((PyObject *)__pyx_t_5)); __pyx_t_5 = 0;
-      __Pyx_Raise(__pyx_t_4, 0, 0);
-      __Pyx_DECREF(__pyx_t_4); __pyx_t_4 = 0;
-      {__pyx_filename = __pyx_f[1]; __pyx_lineno = 292; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-      goto __pyx_L5;
-    }
-    __pyx_L5:;
-
-    /* "/home/mb312/usr/local/lib/python2.5/site-packages/Cython/Includes/numpy.pxd":294
- *             raise RuntimeError("Format string allocated too short, see comment in numpy.pxd")
- * 
- *         if ((child.byteorder == '>' and little_endian) or             # <<<<<<<<<<<<<<
- *             (child.byteorder == '<' and not little_endian)):
- *             raise ValueError("Non-native byte order not supported")
- */
-    if ((__pyx_v_child->byteorder == '>')) {
-      __pyx_t_6 = __pyx_v_little_endian;
-    } else {
-      __pyx_t_6 = (__pyx_v_child->byteorder == '>');
-    }
-    if (!__pyx_t_6) {
-
-      /* "/home/mb312/usr/local/lib/python2.5/site-packages/Cython/Includes/numpy.pxd":295
- * 
- *         if ((child.byteorder == '>' and little_endian) or
- *             (child.byteorder == '<' and not little_endian)):             # <<<<<<<<<<<<<<
- *             raise ValueError("Non-native byte order not supported")
- *             # One could encode it in the format string and have Cython
- */
-      if ((__pyx_v_child->byteorder == '<')) {
-        __pyx_t_7 = (!__pyx_v_little_endian);
-      } else {
-        __pyx_t_7 = (__pyx_v_child->byteorder == '<');
-      }
-      __pyx_t_8 = __pyx_t_7;
-    } else {
-      __pyx_t_8 = __pyx_t_6;
-    }
-    if (__pyx_t_8) {
-
-      /* "/home/mb312/usr/local/lib/python2.5/site-packages/Cython/Includes/numpy.pxd":296
- *         if ((child.byteorder == '>' and little_endian) or
- *             (child.byteorder == '<' and not little_endian)):
- *             raise ValueError("Non-native byte order not supported")             # <<<<<<<<<<<<<<
- *             # One could encode it in the format string and have Cython
- *             # complain instead, BUT: < and > in format strings also imply
- */
-      __pyx_t_4 = PyTuple_New(1); if (unlikely(!__pyx_t_4)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 296; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-      __Pyx_GOTREF(((PyObject *)__pyx_t_4));
-      __Pyx_INCREF(__pyx_kp_28);
-      PyTuple_SET_ITEM(__pyx_t_4, 0, __pyx_kp_28);
-      __Pyx_GIVEREF(__pyx_kp_28);
-      __pyx_t_5 = PyObject_Call(__pyx_builtin_ValueError, ((PyObject *)__pyx_t_4), NULL); if (unlikely(!__pyx_t_5)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 296; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-      __Pyx_GOTREF(__pyx_t_5);
-      __Pyx_DECREF(((PyObject *)__pyx_t_4)); __pyx_t_4 = 0;
-      __Pyx_Raise(__pyx_t_5, 0, 0);
-      __Pyx_DECREF(__pyx_t_5); __pyx_t_5 = 0;
-      {__pyx_filename = __pyx_f[1]; __pyx_lineno = 296; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-      goto __pyx_L6;
-    }
-    __pyx_L6:;
-
-    /* "/home/mb312/usr/local/lib/python2.5/site-packages/Cython/Includes/numpy.pxd":306
- * 
- *         # Output padding bytes
- *         while offset[0] < new_offset:             # <<<<<<<<<<<<<<
- *             f[0] = 120 # "x"; pad byte
- *             f += 1
- */
-    while (1) {
-      __pyx_t_5 = PyInt_FromLong((__pyx_v_offset[0])); if (unlikely(!__pyx_t_5)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 306; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-      __Pyx_GOTREF(__pyx_t_5);
-      __pyx_t_4 = PyObject_RichCompare(__pyx_t_5, __pyx_v_new_offset, Py_LT); if (unlikely(!__pyx_t_4)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 306; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-      __Pyx_GOTREF(__pyx_t_4);
-      __Pyx_DECREF(__pyx_t_5); __pyx_t_5 = 0;
-      __pyx_t_8 = __Pyx_PyObject_IsTrue(__pyx_t_4); if (unlikely(__pyx_t_8 < 0)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 306; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-      __Pyx_DECREF(__pyx_t_4); __pyx_t_4 = 0;
-      if (!__pyx_t_8) break;
-
-      /* "/home/mb312/usr/local/lib/python2.5/site-packages/Cython/Includes/numpy.pxd":307
- *         # Output padding bytes
- *         while offset[0] < new_offset:
- *             f[0] = 120 # "x"; pad byte             # <<<<<<<<<<<<<<
- *             f += 1
- *             offset[0] += 1
- */
-      (__pyx_v_f[0]) = 120;
-
-      /* "/home/mb312/usr/local/lib/python2.5/site-packages/Cython/Includes/numpy.pxd":308
- *         while offset[0] < new_offset:
- *             f[0] = 120 # "x"; pad byte
- *             f += 1             # <<<<<<<<<<<<<<
- *             offset[0] += 1
- * 
- */
-      __pyx_v_f += 1;
-
-      /* "/home/mb312/usr/local/lib/python2.5/site-packages/Cython/Includes/numpy.pxd":309
- *             f[0] = 120 # "x"; pad byte
- *             f += 1
- *             offset[0] += 1             # <<<<<<<<<<<<<<
- * 
- *         offset[0] += child.itemsize
- */
-      (__pyx_v_offset[0]) += 1;
-    }
-
-    /* "/home/mb312/usr/local/lib/python2.5/site-packages/Cython/Includes/numpy.pxd":311
- *             offset[0] += 1
- * 
- *         offset[0] += child.itemsize             # <<<<<<<<<<<<<<
- * 
- *         if not PyDataType_HASFIELDS(child):
- */
-    (__pyx_v_offset[0]) += __pyx_v_child->elsize;
-
-    /* "/home/mb312/usr/local/lib/python2.5/site-packages/Cython/Includes/numpy.pxd":313
- *         offset[0] += child.itemsize
- * 
- *         if not PyDataType_HASFIELDS(child):             # <<<<<<<<<<<<<<
- *             t = child.type_num
- *             if end - f < 5:
- */
-    __pyx_t_8 = (!PyDataType_HASFIELDS(__pyx_v_child));
-    if (__pyx_t_8) {
-
-      /* "/home/mb312/usr/local/lib/python2.5/site-packages/Cython/Includes/numpy.pxd":314
- * 
- *         if not PyDataType_HASFIELDS(child):
- *             t = child.type_num             # <<<<<<<<<<<<<<
- *             if end - f < 5:
- *                 raise RuntimeError("Format string allocated too short.")
- */
-      __pyx_t_4 = PyInt_FromLong(__pyx_v_child->type_num); if (unlikely(!__pyx_t_4)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 314; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-      __Pyx_GOTREF(__pyx_t_4);
-      __Pyx_DECREF(__pyx_v_t);
-      __pyx_v_t = __pyx_t_4;
-      __pyx_t_4 = 0;
-
-      /* "/home/mb312/usr/local/lib/python2.5/site-packages/Cython/Includes/numpy.pxd":315
- *         if not PyDataType_HASFIELDS(child):
- *             t = child.type_num
- *             if end - f < 5:             # <<<<<<<<<<<<<<
- *                 raise RuntimeError("Format string allocated too short.")
- * 
- */
-      __pyx_t_8 = ((__pyx_v_end - __pyx_v_f) < 5);
-      if (__pyx_t_8) {
-
-        /* "/home/mb312/usr/local/lib/python2.5/site-packages/Cython/Includes/numpy.pxd":316
- *             t = child.type_num
- *             if end - f < 5:
- *                 raise RuntimeError("Format string allocated too short.")             # <<<<<<<<<<<<<<
- * 
- *             # Until ticket #99 is fixed, use integers to avoid warnings
- */
-        __pyx_t_4 = PyTuple_New(1); if (unlikely(!__pyx_t_4)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 316; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-        __Pyx_GOTREF(((PyObject *)__pyx_t_4));
-        __Pyx_INCREF(__pyx_kp_29);
-        PyTuple_SET_ITEM(__pyx_t_4, 0, __pyx_kp_29);
-        __Pyx_GIVEREF(__pyx_kp_29);
-        __pyx_t_5 = PyObject_Call(__pyx_builtin_RuntimeError, ((PyObject *)__pyx_t_4), NULL); if (unlikely(!__pyx_t_5)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 316; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-        __Pyx_GOTREF(__pyx_t_5);
-        __Pyx_DECREF(((PyObject *)__pyx_t_4)); __pyx_t_4 = 0;
-        __Pyx_Raise(__pyx_t_5, 0, 0);
-        __Pyx_DECREF(__pyx_t_5); __pyx_t_5 = 0;
-        {__pyx_filename = __pyx_f[1]; __pyx_lineno = 316; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-        goto __pyx_L10;
-      }
-      __pyx_L10:;
-
-      /* "/home/mb312/usr/local/lib/python2.5/site-packages/Cython/Includes/numpy.pxd":319
- * 
- *             # Until ticket #99 is fixed, use integers to avoid warnings
- *             if   t == NPY_BYTE:        f[0] =  98 #"b"             # <<<<<<<<<<<<<<
- *             elif t == NPY_UBYTE:       f[0] =  66 #"B"
- *             elif t == NPY_SHORT:       f[0] = 104 #"h"
- */
-      __pyx_t_5 = PyInt_FromLong(NPY_BYTE); if (unlikely(!__pyx_t_5)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 319; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-      __Pyx_GOTREF(__pyx_t_5);
-      __pyx_t_4 = PyObject_RichCompare(__pyx_v_t, __pyx_t_5, Py_EQ); if (unlikely(!__pyx_t_4)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 319; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-      __Pyx_GOTREF(__pyx_t_4);
-      __Pyx_DECREF(__pyx_t_5); __pyx_t_5 = 0;
-      __pyx_t_8 = __Pyx_PyObject_IsTrue(__pyx_t_4); if (unlikely(__pyx_t_8 < 0)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 319; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-      __Pyx_DECREF(__pyx_t_4); __pyx_t_4 = 0;
-      if (__pyx_t_8) {
-        (__pyx_v_f[0]) = 98;
-        goto __pyx_L11;
-      }
-
-      /* "/home/mb312/usr/local/lib/python2.5/site-packages/Cython/Includes/numpy.pxd":320
- *             # Until ticket #99 is fixed, use integers to avoid warnings
- *             if   t == NPY_BYTE:        f[0] =  98 #"b"
- *             elif t == NPY_UBYTE:       f[0] =  66 #"B"             # <<<<<<<<<<<<<<
- *             elif t == NPY_SHORT:       f[0] = 104 #"h"
- *             elif t == NPY_USHORT:      f[0] =  72 #"H"
- */
-      __pyx_t_4 = PyInt_FromLong(NPY_UBYTE); if (unlikely(!__pyx_t_4)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 320; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-      __Pyx_GOTREF(__pyx_t_4);
-      __pyx_t_5 = PyObject_RichCompare(__pyx_v_t, __pyx_t_4, Py_EQ); if (unlikely(!__pyx_t_5)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 320; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-      __Pyx_GOTREF(__pyx_t_5);
-      __Pyx_DECREF(__pyx_t_4); __pyx_t_4 = 0;
-      __pyx_t_8 = __Pyx_PyObject_IsTrue(__pyx_t_5); if (unlikely(__pyx_t_8 < 0)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 320; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-      __Pyx_DECREF(__pyx_t_5); __pyx_t_5 = 0;
-      if (__pyx_t_8) {
-        (__pyx_v_f[0]) = 66;
-        goto __pyx_L11;
-      }
-
-      /* "/home/mb312/usr/local/lib/python2.5/site-packages/Cython/Includes/numpy.pxd":321
- *             if   t == NPY_BYTE:        f[0] =  98 #"b"
- *             elif t == NPY_UBYTE:       f[0] =  66 #"B"
- *             elif t == NPY_SHORT:       f[0] = 104 #"h"             # <<<<<<<<<<<<<<
- *             elif t == NPY_USHORT:      f[0] =  72 #"H"
- *             elif t == NPY_INT:         f[0] = 105 #"i"
- */
-      __pyx_t_5 = PyInt_FromLong(NPY_SHORT); if (unlikely(!__pyx_t_5)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 321; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-      __Pyx_GOTREF(__pyx_t_5);
-      __pyx_t_4 = PyObject_RichCompare(__pyx_v_t, __pyx_t_5, Py_EQ); if (unlikely(!__pyx_t_4)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 321; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-      __Pyx_GOTREF(__pyx_t_4);
-      __Pyx_DECREF(__pyx_t_5); __pyx_t_5 = 0;
-      __pyx_t_8 = __Pyx_PyObject_IsTrue(__pyx_t_4); if (unlikely(__pyx_t_8 < 0)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 321; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-      __Pyx_DECREF(__pyx_t_4); __pyx_t_4 = 0;
-      if (__pyx_t_8) {
-        (__pyx_v_f[0]) = 104;
-        goto __pyx_L11;
-      }
-
-      /* "/home/mb312/usr/local/lib/python2.5/site-packages/Cython/Includes/numpy.pxd":322
- *             elif t == NPY_UBYTE:       f[0] =  66 #"B"
- *             elif t == NPY_SHORT:       f[0] = 104 #"h"
- *             elif t == NPY_USHORT:      f[0] =  72 #"H"             # <<<<<<<<<<<<<<
- *             elif t == NPY_INT:         f[0] = 105 #"i"
- *             elif t == NPY_UINT:        f[0] =  73 #"I"
- */
-      __pyx_t_4 = PyInt_FromLong(NPY_USHORT); if (unlikely(!__pyx_t_4)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 322; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-      __Pyx_GOTREF(__pyx_t_4);
-      __pyx_t_5 = PyObject_RichCompare(__pyx_v_t, __pyx_t_4, Py_EQ); if (unlikely(!__pyx_t_5)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 322; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-      __Pyx_GOTREF(__pyx_t_5);
-      __Pyx_DECREF(__pyx_t_4); __pyx_t_4 = 0;
-      __pyx_t_8 = __Pyx_PyObject_IsTrue(__pyx_t_5); if (unlikely(__pyx_t_8 < 0)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 322; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-      __Pyx_DECREF(__pyx_t_5); __pyx_t_5 = 0;
-      if (__pyx_t_8) {
-        (__pyx_v_f[0]) = 72;
-        goto __pyx_L11;
-      }
-
-      /* "/home/mb312/usr/local/lib/python2.5/site-packages/Cython/Includes/numpy.pxd":323
- *             elif t == NPY_SHORT:       f[0] = 104 #"h"
- *             elif t == NPY_USHORT:      f[0] =  72 #"H"
- *             elif t == NPY_INT:         f[0] = 105 #"i"             # <<<<<<<<<<<<<<
- *             elif t == NPY_UINT:        f[0] =  73 #"I"
- *             elif t == NPY_LONG:        f[0] = 108 #"l"
- */
-      __pyx_t_5 = PyInt_FromLong(NPY_INT); if (unlikely(!__pyx_t_5)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 323; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-      __Pyx_GOTREF(__pyx_t_5);
-      __pyx_t_4 = PyObject_RichCompare(__pyx_v_t, __pyx_t_5, Py_EQ); if (unlikely(!__pyx_t_4)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 323; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-      __Pyx_GOTREF(__pyx_t_4);
-      __Pyx_DECREF(__pyx_t_5); __pyx_t_5 = 0;
-      __pyx_t_8 = __Pyx_PyObject_IsTrue(__pyx_t_4); if (unlikely(__pyx_t_8 < 0)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 323; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-      __Pyx_DECREF(__pyx_t_4); __pyx_t_4 = 0;
-      if (__pyx_t_8) {
-        (__pyx_v_f[0]) = 105;
-        goto __pyx_L11;
-      }
-
-      /* "/home/mb312/usr/local/lib/python2.5/site-packages/Cython/Includes/numpy.pxd":324
- *             elif t == NPY_USHORT:      f[0] =  72 #"H"
- *             elif t == NPY_INT:         f[0] = 105 #"i"
- *             elif t == NPY_UINT:        f[0] =  73 #"I"             # <<<<<<<<<<<<<<
- *             elif t == NPY_LONG:        f[0] = 108 #"l"
- *             elif t == NPY_ULONG:       f[0] = 76  #"L"
- */
-      __pyx_t_4 = PyInt_FromLong(NPY_UINT); if (unlikely(!__pyx_t_4)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 324; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-      __Pyx_GOTREF(__pyx_t_4);
-      __pyx_t_5 = PyObject_RichCompare(__pyx_v_t, __pyx_t_4, Py_EQ); if (unlikely(!__pyx_t_5)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 324; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-      __Pyx_GOTREF(__pyx_t_5);
-      __Pyx_DECREF(__pyx_t_4); __pyx_t_4 = 0;
-      __pyx_t_8 = __Pyx_PyObject_IsTrue(__pyx_t_5); if (unlikely(__pyx_t_8 < 0)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 324; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-      __Pyx_DECREF(__pyx_t_5); __pyx_t_5 = 0;
-      if (__pyx_t_8) {
-        (__pyx_v_f[0]) = 73;
-        goto __pyx_L11;
-      }
-
-      /* "/home/mb312/usr/local/lib/python2.5/site-packages/Cython/Includes/numpy.pxd":325
- *             elif t == NPY_INT:         f[0] = 105 #"i"
- *             elif t == NPY_UINT:        f[0] =  73 #"I"
- *             elif t == NPY_LONG:        f[0] = 108 #"l"             # <<<<<<<<<<<<<<
- *             elif t == NPY_ULONG:       f[0] = 76  #"L"
- *             elif t == NPY_LONGLONG:    f[0] = 113 #"q"
- */
-      __pyx_t_5 = PyInt_FromLong(NPY_LONG); if (unlikely(!__pyx_t_5)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 325; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-      __Pyx_GOTREF(__pyx_t_5);
-      __pyx_t_4 = PyObject_RichCompare(__pyx_v_t, __pyx_t_5, Py_EQ); if (unlikely(!__pyx_t_4)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 325; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-      __Pyx_GOTREF(__pyx_t_4);
-      __Pyx_DECREF(__pyx_t_5); __pyx_t_5 = 0;
-      __pyx_t_8 = __Pyx_PyObject_IsTrue(__pyx_t_4); if (unlikely(__pyx_t_8 < 0)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 325; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-      __Pyx_DECREF(__pyx_t_4); __pyx_t_4 = 0;
-      if (__pyx_t_8) {
-        (__pyx_v_f[0]) = 108;
-        goto __pyx_L11;
-      }
-
-      /* "/home/mb312/usr/local/lib/python2.5/site-packages/Cython/Includes/numpy.pxd":326
- *             elif t == NPY_UINT:        f[0] =  73 #"I"
- *             elif t == NPY_LONG:        f[0] = 108 #"l"
- *             elif t == NPY_ULONG:       f[0] = 76  #"L"             # <<<<<<<<<<<<<<
- *             elif t == NPY_LONGLONG:    f[0] = 113 #"q"
- *             elif t == NPY_ULONGLONG:   f[0] = 81  #"Q"
- */
-      __pyx_t_4 = PyInt_FromLong(NPY_ULONG); if (unlikely(!__pyx_t_4)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 326; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-      __Pyx_GOTREF(__pyx_t_4);
-      __pyx_t_5 = PyObject_RichCompare(__pyx_v_t, __pyx_t_4, Py_EQ); if (unlikely(!__pyx_t_5)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 326; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-      __Pyx_GOTREF(__pyx_t_5);
-      __Pyx_DECREF(__pyx_t_4); __pyx_t_4 = 0;
-      __pyx_t_8 = __Pyx_PyObject_IsTrue(__pyx_t_5); if (unlikely(__pyx_t_8 < 0)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 326; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-      __Pyx_DECREF(__pyx_t_5); __pyx_t_5 = 0;
-      if (__pyx_t_8) {
-        (__pyx_v_f[0]) = 76;
-        goto __pyx_L11;
-      }
-
-      /* "/home/mb312/usr/local/lib/python2.5/site-packages/Cython/Includes/numpy.pxd":327
- *             elif t == NPY_LONG:        f[0] = 108 #"l"
- *             elif t == NPY_ULONG:       f[0] = 76  #"L"
- *             elif t == NPY_LONGLONG:    f[0] = 113 #"q"             # <<<<<<<<<<<<<<
- *             elif t == NPY_ULONGLONG:   f[0] = 81  #"Q"
- *             elif t == NPY_FLOAT:       f[0] = 102 #"f"
- */
-      __pyx_t_5 = PyInt_FromLong(NPY_LONGLONG); if (unlikely(!__pyx_t_5)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 327; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-      __Pyx_GOTREF(__pyx_t_5);
-      __pyx_t_4 = PyObject_RichCompare(__pyx_v_t, __pyx_t_5, Py_EQ); if (unlikely(!__pyx_t_4)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 327; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-      __Pyx_GOTREF(__pyx_t_4);
-      __Pyx_DECREF(__pyx_t_5); __pyx_t_5 = 0;
-      __pyx_t_8 = __Pyx_PyObject_IsTrue(__pyx_t_4); if (unlikely(__pyx_t_8 < 0)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 327; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-      __Pyx_DECREF(__pyx_t_4); __pyx_t_4 = 0;
-      if (__pyx_t_8) {
-        (__pyx_v_f[0]) = 113;
-        goto __pyx_L11;
-      }
-
-      /* "/home/mb312/usr/local/lib/python2.5/site-packages/Cython/Includes/numpy.pxd":328
- *             elif t == NPY_ULONG:       f[0] = 76  #"L"
- *             elif t == NPY_LONGLONG:    f[0] = 113 #"q"
- *             elif t == NPY_ULONGLONG:   f[0] = 81  #"Q"             # <<<<<<<<<<<<<<
- *             elif t == NPY_FLOAT:       f[0] = 102 #"f"
- *             elif t == NPY_DOUBLE:      f[0] = 100 #"d"
- */
-      __pyx_t_4 = PyInt_FromLong(NPY_ULONGLONG); if (unlikely(!__pyx_t_4)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 328; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-      __Pyx_GOTREF(__pyx_t_4);
-      __pyx_t_5 = PyObject_RichCompare(__pyx_v_t, __pyx_t_4, Py_EQ); if (unlikely(!__pyx_t_5)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 328; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-      __Pyx_GOTREF(__pyx_t_5);
-      __Pyx_DECREF(__pyx_t_4); __pyx_t_4 = 0;
-      __pyx_t_8 = __Pyx_PyObject_IsTrue(__pyx_t_5); if (unlikely(__pyx_t_8 < 0)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 328; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-      __Pyx_DECREF(__pyx_t_5); __pyx_t_5 = 0;
-      if (__pyx_t_8) {
-        (__pyx_v_f[0]) = 81;
-        goto __pyx_L11;
-      }
-
-      /* "/home/mb312/usr/local/lib/python2.5/site-packages/Cython/Includes/numpy.pxd":329
- *             elif t == NPY_LONGLONG:    f[0] = 113 #"q"
- *             elif t == NPY_ULONGLONG:   f[0] = 81  #"Q"
- *             elif t == NPY_FLOAT:       f[0] = 102 #"f"             # <<<<<<<<<<<<<<
- *             elif t == NPY_DOUBLE:      f[0] = 100 #"d"
- *             elif t == NPY_LONGDOUBLE:  f[0] = 103 #"g"
- */
-      __pyx_t_5 = PyInt_FromLong(NPY_FLOAT); if (unlikely(!__pyx_t_5)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 329; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-      __Pyx_GOTREF(__pyx_t_5);
-      __pyx_t_4 = PyObject_RichCompare(__pyx_v_t, __pyx_t_5, Py_EQ); if (unlikely(!__pyx_t_4)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 329; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-      __Pyx_GOTREF(__pyx_t_4);
-      __Pyx_DECREF(__pyx_t_5); __pyx_t_5 = 0;
-      __pyx_t_8 = __Pyx_PyObject_IsTrue(__pyx_t_4); if (unlikely(__pyx_t_8 < 0)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 329; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-      __Pyx_DECREF(__pyx_t_4); __pyx_t_4 = 0;
-      if (__pyx_t_8) {
-        (__pyx_v_f[0]) = 102;
-        goto __pyx_L11;
-      }
-
-      /* "/home/mb312/usr/local/lib/python2.5/site-packages/Cython/Includes/numpy.pxd":330
- *             elif t == NPY_ULONGLONG:   f[0] = 81  #"Q"
- *             elif t == NPY_FLOAT:       f[0] = 102 #"f"
- *             elif t == NPY_DOUBLE:      f[0] = 100 #"d"             # <<<<<<<<<<<<<<
- *             elif t == NPY_LONGDOUBLE:  f[0] = 103 #"g"
- *             elif t == NPY_CFLOAT:      f[0] = 90; f[1] = 102; f += 1 # Zf
- */
-      __pyx_t_4 = PyInt_FromLong(NPY_DOUBLE); if (unlikely(!__pyx_t_4)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 330; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-      __Pyx_GOTREF(__pyx_t_4);
-      __pyx_t_5 = PyObject_RichCompare(__pyx_v_t, __pyx_t_4, Py_EQ); if (unlikely(!__pyx_t_5)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 330; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-      __Pyx_GOTREF(__pyx_t_5);
-      __Pyx_DECREF(__pyx_t_4); __pyx_t_4 = 0;
-      __pyx_t_8 = __Pyx_PyObject_IsTrue(__pyx_t_5); if (unlikely(__pyx_t_8 < 0)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 330; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-      __Pyx_DECREF(__pyx_t_5); __pyx_t_5 = 0;
-      if (__pyx_t_8) {
-        (__pyx_v_f[0]) = 100;
-        goto __pyx_L11;
-      }
-
-      /* "/home/mb312/usr/local/lib/python2.5/site-packages/Cython/Includes/numpy.pxd":331
- *             elif t == NPY_FLOAT:       f[0] = 102 #"f"
- *             elif t == NPY_DOUBLE:      f[0] = 100 #"d"
- *             elif t == NPY_LONGDOUBLE:  f[0] = 103 #"g"             # <<<<<<<<<<<<<<
- *             elif t == NPY_CFLOAT:      f[0] = 90; f[1] = 102; f += 1 # Zf
- *             elif t == NPY_CDOUBLE:     f[0] = 90; f[1] = 100; f += 1 # Zd
- */
-      __pyx_t_5 = PyInt_FromLong(NPY_LONGDOUBLE); if (unlikely(!__pyx_t_5)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 331; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-      __Pyx_GOTREF(__pyx_t_5);
-      __pyx_t_4 = PyObject_RichCompare(__pyx_v_t, __pyx_t_5, Py_EQ); if (unlikely(!__pyx_t_4)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 331; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-      __Pyx_GOTREF(__pyx_t_4);
-      __Pyx_DECREF(__pyx_t_5); __pyx_t_5 = 0;
-      __pyx_t_8 = __Pyx_PyObject_IsTrue(__pyx_t_4); if (unlikely(__pyx_t_8 < 0)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 331; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-      __Pyx_DECREF(__pyx_t_4); __pyx_t_4 = 0;
-      if (__pyx_t_8) {
-        (__pyx_v_f[0]) = 103;
-        goto __pyx_L11;
-      }
-
-      /* "/home/mb312/usr/local/lib/python2.5/site-packages/Cython/Includes/numpy.pxd":332
- *             elif t == NPY_DOUBLE:      f[0] = 100 #"d"
- *             elif t == NPY_LONGDOUBLE:  f[0] = 103 #"g"
- *             elif t == NPY_CFLOAT:      f[0] = 90; f[1] = 102; f += 1 # Zf             # <<<<<<<<<<<<<<
- *             elif t == NPY_CDOUBLE:     f[0] = 90; f[1] = 100; f += 1 # Zd
- *             elif t == NPY_CLONGDOUBLE: f[0] = 90; f[1] = 103; f += 1 # Zg
- */
-      __pyx_t_4 = PyInt_FromLong(NPY_CFLOAT); if (unlikely(!__pyx_t_4)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 332; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-      __Pyx_GOTREF(__pyx_t_4);
-      __pyx_t_5 = PyObject_RichCompare(__pyx_v_t, __pyx_t_4, Py_EQ); if (unlikely(!__pyx_t_5)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 332; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-      __Pyx_GOTREF(__pyx_t_5);
-      __Pyx_DECREF(__pyx_t_4); __pyx_t_4 = 0;
-      __pyx_t_8 = __Pyx_PyObject_IsTrue(__pyx_t_5); if (unlikely(__pyx_t_8 < 0)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 332; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-      __Pyx_DECREF(__pyx_t_5); __pyx_t_5 = 0;
-      if (__pyx_t_8) {
-        (__pyx_v_f[0]) = 90;
-        (__pyx_v_f[1]) = 102;
-        __pyx_v_f += 1;
-        goto __pyx_L11;
-      }
-
-      /* "/home/mb312/usr/local/lib/python2.5/site-packages/Cython/Includes/numpy.pxd":333
- *             elif t == NPY_LONGDOUBLE:  f[0] = 103 #"g"
- *             elif t == NPY_CFLOAT:      f[0] = 90; f[1] = 102; f += 1 # Zf
- *             elif t == NPY_CDOUBLE:     f[0] = 90; f[1] = 100; f += 1 # Zd             # <<<<<<<<<<<<<<
- *             elif t == NPY_CLONGDOUBLE: f[0] = 90; f[1] = 103; f += 1 # Zg
- *             elif t == NPY_OBJECT:      f[0] = 79 #"O"
- */
-      __pyx_t_5 = PyInt_FromLong(NPY_CDOUBLE); if (unlikely(!__pyx_t_5)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 333; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-      __Pyx_GOTREF(__pyx_t_5);
-      __pyx_t_4 = PyObject_RichCompare(__pyx_v_t, __pyx_t_5, Py_EQ); if (unlikely(!__pyx_t_4)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 333; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-      __Pyx_GOTREF(__pyx_t_4);
-      __Pyx_DECREF(__pyx_t_5); __pyx_t_5 = 0;
-      __pyx_t_8 = __Pyx_PyObject_IsTrue(__pyx_t_4); if (unlikely(__pyx_t_8 < 0)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 333; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-      __Pyx_DECREF(__pyx_t_4); __pyx_t_4 = 0;
-      if (__pyx_t_8) {
-        (__pyx_v_f[0]) = 90;
-        (__pyx_v_f[1]) = 100;
-        __pyx_v_f += 1;
-        goto __pyx_L11;
-      }
-
-      /* "/home/mb312/usr/local/lib/python2.5/site-packages/Cython/Includes/numpy.pxd":334
- *             elif t == NPY_CFLOAT:      f[0] = 90; f[1] = 102; f += 1 # Zf
- *             elif t == NPY_CDOUBLE:     f[0] = 90; f[1] = 100; f += 1 # Zd
- *             elif t == NPY_CLONGDOUBLE: f[0] = 90; f[1] = 103; f += 1 # Zg             # <<<<<<<<<<<<<<
- *             elif t == NPY_OBJECT:      f[0] = 79 #"O"
- *             else:
- */
-      __pyx_t_4 = PyInt_FromLong(NPY_CLONGDOUBLE); if (unlikely(!__pyx_t_4)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 334; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-      __Pyx_GOTREF(__pyx_t_4);
-      __pyx_t_5 = PyObject_RichCompare(__pyx_v_t, __pyx_t_4, Py_EQ); if (unlikely(!__pyx_t_5)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 334; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-      __Pyx_GOTREF(__pyx_t_5);
-      __Pyx_DECREF(__pyx_t_4); __pyx_t_4 = 0;
-      __pyx_t_8 = __Pyx_PyObject_IsTrue(__pyx_t_5); if (unlikely(__pyx_t_8 < 0)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 334; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-      __Pyx_DECREF(__pyx_t_5); __pyx_t_5 = 0;
-      if (__pyx_t_8) {
-        (__pyx_v_f[0]) = 90;
-        (__pyx_v_f[1]) = 103;
-        __pyx_v_f += 1;
-        goto __pyx_L11;
-      }
-
-      /* "/home/mb312/usr/local/lib/python2.5/site-packages/Cython/Includes/numpy.pxd":335
- *             elif t == NPY_CDOUBLE:     f[0] = 90; f[1] = 100; f += 1 # Zd
- *             elif t == NPY_CLONGDOUBLE: f[0] = 90; f[1] = 103; f += 1 # Zg
- *             elif t == NPY_OBJECT:      f[0] = 79 #"O"             # <<<<<<<<<<<<<<
- *             else:
- *                 raise ValueError("unknown dtype code in numpy.pxd (%d)" % t)
- */
-      __pyx_t_5 = PyInt_FromLong(NPY_OBJECT); if (unlikely(!__pyx_t_5)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 335; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-      __Pyx_GOTREF(__pyx_t_5);
-      __pyx_t_4 = PyObject_RichCompare(__pyx_v_t, __pyx_t_5, Py_EQ); if (unlikely(!__pyx_t_4)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 335; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-      __Pyx_GOTREF(__pyx_t_4);
-      __Pyx_DECREF(__pyx_t_5); __pyx_t_5 = 0;
-      __pyx_t_8 = __Pyx_PyObject_IsTrue(__pyx_t_4); if (unlikely(__pyx_t_8 < 0)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 335; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-      __Pyx_DECREF(__pyx_t_4); __pyx_t_4 = 0;
-      if (__pyx_t_8) {
-        (__pyx_v_f[0]) = 79;
-        goto __pyx_L11;
-      }
-      /*else*/ {
-
-        /* "/home/mb312/usr/local/lib/python2.5/site-packages/Cython/Includes/numpy.pxd":337
- *             elif t == NPY_OBJECT:      f[0] = 79 #"O"
- *             else:
- *                 raise ValueError("unknown dtype code in numpy.pxd (%d)" % t)             # <<<<<<<<<<<<<<
- *             f += 1
- *         else:
- */
-        __pyx_t_4 = PyNumber_Remainder(__pyx_kp_30, __pyx_v_t); if (unlikely(!__pyx_t_4)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 337; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-        __Pyx_GOTREF(__pyx_t_4);
-        __pyx_t_5 = PyTuple_New(1); if (unlikely(!__pyx_t_5)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 337; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-        __Pyx_GOTREF(((PyObject *)__pyx_t_5));
-        PyTuple_SET_ITEM(__pyx_t_5, 0, __pyx_t_4);
-        __Pyx_GIVEREF(__pyx_t_4);
-        __pyx_t_4 = 0;
-        __pyx_t_4 = PyObject_Call(__pyx_builtin_ValueError, ((PyObject *)__pyx_t_5), NULL); if (unlikely(!__pyx_t_4)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 337; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-        __Pyx_GOTREF(__pyx_t_4);
-        __Pyx_DECREF(((PyObject *)__pyx_t_5)); __pyx_t_5 = 0;
-        __Pyx_Raise(__pyx_t_4, 0, 0);
-        __Pyx_DECREF(__pyx_t_4); __pyx_t_4 = 0;
-        {__pyx_filename = __pyx_f[1]; __pyx_lineno = 337; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-      }
-      __pyx_L11:;
-
-      /* "/home/mb312/usr/local/lib/python2.5/site-packages/Cython/Includes/numpy.pxd":338
- *             else:
- *                 raise ValueError("unknown dtype code in numpy.pxd (%d)" % t)
- *             f += 1             # <<<<<<<<<<<<<<
- *         else:
- *             # Cython ignores struct boundary information ("T{...}"),
- */
-      __pyx_v_f += 1;
-      goto __pyx_L9;
-    }
-    /*else*/ {
-
-      /* "/home/mb312/usr/local/lib/python2.5/site-packages/Cython/Includes/numpy.pxd":342
- *             # Cython ignores struct boundary information ("T{...}"),
- *             # so don't output it
- *             f = _util_dtypestring(child, f, end, offset)             # <<<<<<<<<<<<<<
- *     return f
- * 
- */
-      __pyx_t_9 = __pyx_f_5numpy__util_dtypestring(__pyx_v_child, __pyx_v_f, __pyx_v_end, __pyx_v_offset); if (unlikely(__pyx_t_9 == NULL)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 342; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-      __pyx_v_f = __pyx_t_9;
-    }
-    __pyx_L9:;
-  }
-  __Pyx_DECREF(__pyx_t_2); __pyx_t_2 = 0;
-
-  /* "/home/mb312/usr/local/lib/python2.5/site-packages/Cython/Includes/numpy.pxd":343
- *             # so don't output it
- *             f = _util_dtypestring(child, f, end, offset)
- *     return f             # <<<<<<<<<<<<<<
- * 
- */
-  __pyx_r = __pyx_v_f;
-  goto __pyx_L0;
-
-  __pyx_r = 0;
-  goto __pyx_L0;
-  __pyx_L1_error:;
-  __Pyx_XDECREF(__pyx_1);
-  __Pyx_XDECREF(__pyx_t_2);
-  __Pyx_XDECREF(__pyx_t_3);
-  __Pyx_XDECREF(__pyx_t_4);
-  __Pyx_XDECREF(__pyx_t_5);
-  __Pyx_AddTraceback("numpy._util_dtypestring");
-  __pyx_r = NULL;
-  __pyx_L0:;
-  __Pyx_DECREF((PyObject *)__pyx_v_child);
-  __Pyx_DECREF(__pyx_v_i);
-  __Pyx_DECREF(__pyx_v_new_offset);
-  __Pyx_DECREF(__pyx_v_t);
-  __Pyx_FinishRefcountContext();
-  return __pyx_r;
-}
-
-static struct PyMethodDef __pyx_methods[] = {
-  {__Pyx_NAMESTR("mu3_tet"), (PyCFunction)__pyx_pf_4nipy_10algorithms_10statistics_6intvol_mu3_tet, METH_VARARGS|METH_KEYWORDS, __Pyx_DOCSTR(__pyx_doc_4nipy_10algorithms_10statistics_6intvol_mu3_tet)},
-  {__Pyx_NAMESTR("mu2_tet"), (PyCFunction)__pyx_pf_4nipy_10algorithms_10statistics_6intvol_mu2_tet, METH_VARARGS|METH_KEYWORDS, __Pyx_DOCSTR(__pyx_doc_4nipy_10algorithms_10statistics_6intvol_mu2_tet)},
-  {__Pyx_NAMESTR("mu1_tet"), (PyCFunction)__pyx_pf_4nipy_10algorithms_10statistics_6intvol_mu1_tet, METH_VARARGS|METH_KEYWORDS, __Pyx_DOCSTR(__pyx_doc_4nipy_10algorithms_10statistics_6intvol_mu1_tet)},
-  {__Pyx_NAMESTR("mu2_tri"), (PyCFunction)__pyx_pf_4nipy_10algorithms_10statistics_6intvol_mu2_tri, METH_VARARGS|METH_KEYWORDS, __Pyx_DOCSTR(__pyx_doc_4nipy_10algorithms_10statistics_6intvol_mu2_tri)},
-  {__Pyx_NAMESTR("mu1_tri"), (PyCFunction)__pyx_pf_4nipy_10algorithms_10statistics_6intvol_mu1_tri, METH_VARARGS|METH_KEYWORDS, __Pyx_DOCSTR(__pyx_doc_4nipy_10algorithms_10statistics_6intvol_mu1_tri)},
-  {__Pyx_NAMESTR("mu1_edge"), (PyCFunction)__pyx_pf_4nipy_10algorithms_10statistics_6intvol_mu1_edge, METH_VARARGS|METH_KEYWORDS, __Pyx_DOCSTR(__pyx_doc_4nipy_10algorithms_10statistics_6intvol_mu1_edge)},
-  {__Pyx_NAMESTR("EC3d"), (PyCFunction)__pyx_pf_4nipy_10algorithms_10statistics_6intvol_EC3d, METH_O, __Pyx_DOCSTR(__pyx_doc_4nipy_10algorithms_10statistics_6intvol_EC3d)},
-  {__Pyx_NAMESTR("Lips3d"), (PyCFunction)__pyx_pf_4nipy_10algorithms_10statistics_6intvol_Lips3d, METH_VARARGS|METH_KEYWORDS, __Pyx_DOCSTR(__pyx_doc_4nipy_10algorithms_10statistics_6intvol_Lips3d)},
-  {__Pyx_NAMESTR("_convert_stride3"), (PyCFunction)__pyx_pf_4nipy_10algorithms_10statistics_6intvol__convert_stride3, METH_VARARGS|METH_KEYWORDS, __Pyx_DOCSTR(__pyx_doc_4nipy_10algorithms_10statistics_6intvol__convert_stride3)},
-  {__Pyx_NAMESTR("_convert_stride2"), (PyCFunction)__pyx_pf_4nipy_10algorithms_10statistics_6intvol__convert_stride2, METH_VARARGS|METH_KEYWORDS, __Pyx_DOCSTR(__pyx_doc_4nipy_10algorithms_10statistics_6intvol__convert_stride2)},
-  {__Pyx_NAMESTR("_convert_stride1"), (PyCFunction)__pyx_pf_4nipy_10algorithms_10statistics_6intvol__convert_stride1, METH_VARARGS|METH_KEYWORDS, __Pyx_DOCSTR(__pyx_doc_4nipy_10algorithms_10statistics_6intvol__convert_stride1)},
-  {__Pyx_NAMESTR("Lips2d"), (PyCFunction)__pyx_pf_4nipy_10algorithms_10statistics_6intvol_Lips2d, METH_VARARGS|METH_KEYWORDS, __Pyx_DOCSTR(__pyx_doc_4nipy_10algorithms_10statistics_6intvol_Lips2d)},
-  {__Pyx_NAMESTR("EC2d"), (PyCFunction)__pyx_pf_4nipy_10algorithms_10statistics_6intvol_EC2d, METH_O, __Pyx_DOCSTR(__pyx_doc_4nipy_10algorithms_10statistics_6intvol_EC2d)},
-  {__Pyx_NAMESTR("Lips1d"), (PyCFunction)__pyx_pf_4nipy_10algorithms_10statistics_6intvol_Lips1d, METH_VARARGS|METH_KEYWORDS, __Pyx_DOCSTR(__pyx_doc_4nipy_10algorithms_10statistics_6intvol_Lips1d)},
-  {__Pyx_NAMESTR("EC1d"), (PyCFunction)__pyx_pf_4nipy_10algorithms_10statistics_6intvol_EC1d, METH_O, __Pyx_DOCSTR(__pyx_doc_4nipy_10algorithms_10statistics_6intvol_EC1d)},
-  {0, 0, 0, 0}
-};
-
-static void __pyx_init_filenames(void); /*proto*/
-
-#if PY_MAJOR_VERSION >= 3
-static struct PyModuleDef __pyx_moduledef = {
-    PyModuleDef_HEAD_INIT,
-    __Pyx_NAMESTR("intvol"),
-    __Pyx_DOCSTR(__pyx_mdoc), /* m_doc */
-    -1, /* m_size */
-    __pyx_methods /* m_methods */,
-    NULL, /* m_reload */
-    NULL, /* m_traverse */
-    NULL, /* m_clear */
-    NULL /* m_free */
-};
-#endif
-
-static __Pyx_StringTabEntry __pyx_string_tab[] = {
-  {&__pyx_kp___main__, __pyx_k___main__, sizeof(__pyx_k___main__), 1, 1, 1},
-  {&__pyx_kp_D00, __pyx_k_D00, sizeof(__pyx_k_D00), 1, 1, 1},
-  {&__pyx_kp_31, __pyx_k_31, sizeof(__pyx_k_31), 1, 1, 1},
-  {&__pyx_kp_32, __pyx_k_32, sizeof(__pyx_k_32), 1, 1, 1},
-  {&__pyx_kp_33, __pyx_k_33, sizeof(__pyx_k_33), 1, 1, 1},
-  {&__pyx_kp_34, __pyx_k_34, sizeof(__pyx_k_34), 1, 1, 1},
-  {&__pyx_kp_35, __pyx_k_35, sizeof(__pyx_k_35), 1, 1, 1},
-  {&__pyx_kp_36, __pyx_k_36, sizeof(__pyx_k_36), 1, 1, 1},
-  {&__pyx_kp_37, __pyx_k_37, sizeof(__pyx_k_37), 1, 1, 1},
-  {&__pyx_kp_38, __pyx_k_38, sizeof(__pyx_k_38), 1, 1, 1},
-  {&__pyx_kp_39, __pyx_k_39, sizeof(__pyx_k_39), 1, 1, 1},
-  {&__pyx_kp_mask, __pyx_k_mask, sizeof(__pyx_k_mask), 1, 1, 1},
-  {&__pyx_kp_coords, __pyx_k_coords, sizeof(__pyx_k_coords), 1, 1, 1},
-  {&__pyx_kp_v, __pyx_k_v, sizeof(__pyx_k_v), 1, 1, 1},
-  {&__pyx_kp_40, __pyx_k_40, sizeof(__pyx_k_40), 1, 1, 1},
-  {&__pyx_kp_41, __pyx_k_41, sizeof(__pyx_k_41), 1, 1, 1},
-  {&__pyx_kp_numpy, __pyx_k_numpy, sizeof(__pyx_k_numpy), 1, 1, 1},
-  {&__pyx_kp_np, __pyx_k_np, sizeof(__pyx_k_np), 0, 1, 1},
-  {&__pyx_kp_42, __pyx_k_42, sizeof(__pyx_k_42), 1, 1, 1},
-  {&__pyx_kp_dok_matrix, __pyx_k_dok_matrix, sizeof(__pyx_k_dok_matrix), 1, 1, 1},
-  {&__pyx_kp_utils, __pyx_k_utils, sizeof(__pyx_k_utils), 1, 1, 1},
-  {&__pyx_kp_43, __pyx_k_43, sizeof(__pyx_k_43), 1, 1, 1},
-  {&__pyx_kp_join_complexes, __pyx_k_join_complexes, sizeof(__pyx_k_join_complexes), 1, 1, 1},
-  {&__pyx_kp_float, __pyx_k_float, sizeof(__pyx_k_float), 1, 1, 1},
-  {&__pyx_kp_DTYPE_float, __pyx_k_DTYPE_float, sizeof(__pyx_k_DTYPE_float), 1, 1, 1},
-  {&__pyx_kp_int, __pyx_k_int, sizeof(__pyx_k_int), 1, 1, 1},
-  {&__pyx_kp_DTYPE_int, __pyx_k_DTYPE_int, sizeof(__pyx_k_DTYPE_int), 1, 1, 1},
-  {&__pyx_kp_sqrt, __pyx_k_sqrt, sizeof(__pyx_k_sqrt), 1, 1, 1},
-  {&__pyx_kp_44, __pyx_k_44, sizeof(__pyx_k_44), 1, 1, 1},
-  {&__pyx_kp_pi, __pyx_k_pi, sizeof(__pyx_k_pi), 1, 1, 1},
-  {&__pyx_kp_arccos, __pyx_k_arccos, sizeof(__pyx_k_arccos), 1, 1, 1},
-  {&__pyx_kp_isnan, __pyx_k_isnan, sizeof(__pyx_k_isnan), 1, 1, 1},
-  {&__pyx_kp_45, __pyx_k_45, sizeof(__pyx_k_45), 1, 1, 1},
-  {&__pyx_kp_unique, __pyx_k_unique, sizeof(__pyx_k_unique), 1, 1, 1},
-  {&__pyx_kp_issubset, __pyx_k_issubset, sizeof(__pyx_k_issubset), 1, 1, 1},
-  {&__pyx_kp_ValueError, __pyx_k_ValueError, sizeof(__pyx_k_ValueError), 1, 1, 1},
-  {&__pyx_kp_zeros, __pyx_k_zeros, sizeof(__pyx_k_zeros), 1, 1, 1},
-  {&__pyx_kp_reshape, __pyx_k_reshape, sizeof(__pyx_k_reshape), 1, 1, 1},
-  {&__pyx_kp_empty, __pyx_k_empty, sizeof(__pyx_k_empty), 1, 1, 1},
-  {&__pyx_kp_bool, __pyx_k_bool, sizeof(__pyx_k_bool), 1, 1, 1},
-  {&__pyx_kp_strides, __pyx_k_strides, sizeof(__pyx_k_strides), 1, 1, 1},
-  {&__pyx_kp_array, __pyx_k_array, sizeof(__pyx_k_array), 1, 1, 1},
-  {&__pyx_kp_difference, __pyx_k_difference, sizeof(__pyx_k_difference), 1, 1, 1},
-  {&__pyx_kp_range, __pyx_k_range, sizeof(__pyx_k_range), 1, 1, 1},
-  {&__pyx_kp_sum, __pyx_k_sum, sizeof(__pyx_k_sum), 1, 1, 1},
-  {&__pyx_kp_ravel, __pyx_k_ravel, sizeof(__pyx_k_ravel), 1, 1, 1},
-  {&__pyx_kp_sort, __pyx_k_sort, sizeof(__pyx_k_sort), 1, 1, 1},
-  {&__pyx_kp_49, __pyx_k_49, sizeof(__pyx_k_49), 1, 1, 1},
-  {&__pyx_kp_hstack, __pyx_k_hstack, sizeof(__pyx_k_hstack), 1, 1, 1},
-  {&__pyx_kp_50, __pyx_k_50, sizeof(__pyx_k_50), 1, 1, 1},
-  {&__pyx_kp_51, __pyx_k_51, sizeof(__pyx_k_51), 1, 1, 1},
-  {&__pyx_kp_52, __pyx_k_52, sizeof(__pyx_k_52), 1, 1, 1},
-  {&__pyx_kp_53, __pyx_k_53, sizeof(__pyx_k_53), 1, 1, 1},
-  {&__pyx_kp_shape, __pyx_k_shape, sizeof(__pyx_k_shape), 1, 1, 1},
-  {&__pyx_kp_56, __pyx_k_56, sizeof(__pyx_k_56), 1, 1, 1},
-  {&__pyx_kp_46, __pyx_k_46, sizeof(__pyx_k_46), 0, 0, 0},
-  {&__pyx_kp_47, __pyx_k_47, sizeof(__pyx_k_47), 0, 0, 0},
-  {&__pyx_kp_48, __pyx_k_48, sizeof(__pyx_k_48), 0, 0, 0},
-  {&__pyx_kp_54, __pyx_k_54, sizeof(__pyx_k_54), 0, 0, 0},
-  {&__pyx_kp_55, __pyx_k_55, sizeof(__pyx_k_55), 0, 0, 0},
-  {&__pyx_kp_57, __pyx_k_57, sizeof(__pyx_k_57), 0, 0, 0},
-  {&__pyx_kp_58, __pyx_k_58, sizeof(__pyx_k_58), 0, 0, 0},
-  {&__pyx_kp_59, __pyx_k_59, sizeof(__pyx_k_59), 0, 0, 0},
-  {&__pyx_kp_60, __pyx_k_60, sizeof(__pyx_k_60), 0, 0, 0},
-  {&__pyx_kp___getbuffer__, __pyx_k___getbuffer__, sizeof(__pyx_k___getbuffer__), 1, 1, 1},
-  {&__pyx_kp___releasebuffer__, __pyx_k___releasebuffer__, sizeof(__pyx_k___releasebuffer__), 1, 1, 1},
-  {&__pyx_kp_info, __pyx_k_info, sizeof(__pyx_k_info), 1, 1, 1},
-  {&__pyx_kp_flags, __pyx_k_flags, sizeof(__pyx_k_flags), 1, 1, 1},
-  {&__pyx_kp_itervalues, __pyx_k_itervalues, sizeof(__pyx_k_itervalues), 1, 1, 1},
-  {&__pyx_kp_RuntimeError, __pyx_k_RuntimeError, sizeof(__pyx_k_RuntimeError), 1, 1, 1},
-  {&__pyx_kp_1, __pyx_k_1, sizeof(__pyx_k_1), 0, 0, 0},
-  {&__pyx_kp_2, __pyx_k_2, sizeof(__pyx_k_2), 0, 0, 0},
-  {&__pyx_kp_5, __pyx_k_5, sizeof(__pyx_k_5), 0, 0, 0},
-  {&__pyx_kp_23, __pyx_k_23, sizeof(__pyx_k_23), 0, 0, 0},
-  {&__pyx_kp_25, __pyx_k_25, sizeof(__pyx_k_25), 0, 0, 0},
-  {&__pyx_kp_28, __pyx_k_28, sizeof(__pyx_k_28), 0, 0, 0},
-  {&__pyx_kp_29, __pyx_k_29, sizeof(__pyx_k_29), 0, 0, 0},
-  {&__pyx_kp_30, __pyx_k_30, sizeof(__pyx_k_30), 0, 0, 0},
-  {0, 0, 0, 0, 0, 0}
-};
-static int __Pyx_InitCachedBuiltins(void) {
-  __pyx_builtin_ValueError = __Pyx_GetName(__pyx_b, __pyx_kp_ValueError); if (!__pyx_builtin_ValueError) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 297; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __pyx_builtin_range = __Pyx_GetName(__pyx_b, __pyx_kp_range); if (!__pyx_builtin_range) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 352; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __pyx_builtin_RuntimeError = __Pyx_GetName(__pyx_b, __pyx_kp_RuntimeError); if (!__pyx_builtin_RuntimeError) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 292; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  return 0;
-  __pyx_L1_error:;
-  return -1;
-}
-
-static int __Pyx_InitGlobals(void) {
-  __pyx_int_0 = PyInt_FromLong(0); if (unlikely(!__pyx_int_0)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 1; __pyx_clineno = __LINE__; goto __pyx_L1_error;};
-  __pyx_int_2 = PyInt_FromLong(2); if (unlikely(!__pyx_int_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 1; __pyx_clineno = __LINE__; goto __pyx_L1_error;};
-  __pyx_int_1 = PyInt_FromLong(1); if (unlikely(!__pyx_int_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 1; __pyx_clineno = __LINE__; goto __pyx_L1_error;};
-  __pyx_int_neg_1 = PyInt_FromLong(-1); if (unlikely(!__pyx_int_neg_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 1; __pyx_clineno = __LINE__; goto __pyx_L1_error;};
-  __pyx_int_4 = PyInt_FromLong(4); if (unlikely(!__pyx_int_4)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 1; __pyx_clineno = __LINE__; goto __pyx_L1_error;};
-  __pyx_int_8 = PyInt_FromLong(8); if (unlikely(!__pyx_int_8)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 1; __pyx_clineno = __LINE__; goto __pyx_L1_error;};
-  __pyx_int_15 = PyInt_FromLong(15); if (unlikely(!__pyx_int_15)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 1; __pyx_clineno = __LINE__; goto __pyx_L1_error;};
-  #if PY_VERSION_HEX < 0x02040000
-  if (unlikely(__Pyx_Py23SetsImport() < 0)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 1; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  #endif
-  if (__Pyx_InitStrings(__pyx_string_tab) < 0) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 1; __pyx_clineno = __LINE__; goto __pyx_L1_error;};
-  return 0;
-  __pyx_L1_error:;
-  return -1;
-}
-
-#if PY_MAJOR_VERSION < 3
-PyMODINIT_FUNC initintvol(void); /*proto*/
-PyMODINIT_FUNC initintvol(void)
-#else
-PyMODINIT_FUNC PyInit_intvol(void); /*proto*/
-PyMODINIT_FUNC PyInit_intvol(void)
-#endif
-{
-  PyObject *__pyx_1 = 0;
-  PyObject *__pyx_2 = 0;
-  PyObject *__pyx_t_1 = NULL;
-  #ifdef CYTHON_REFNANNY
-  void* __pyx_refchk = NULL;
-  __Pyx_Refnanny = __Pyx_ImportRefcountAPI("refnanny");
-  if (!__Pyx_Refnanny) {
-      PyErr_Clear();
-      __Pyx_Refnanny = __Pyx_ImportRefcountAPI("Cython.Runtime.refnanny");
-      if (!__Pyx_Refnanny)
-          Py_FatalError("failed to import refnanny module");
-  }
-  __pyx_refchk = __Pyx_Refnanny->NewContext("PyMODINIT_FUNC PyInit_intvol(void)", __LINE__, __FILE__);
-  #endif
-  __pyx_empty_tuple = PyTuple_New(0); if (unlikely(!__pyx_empty_tuple)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 1; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  /*--- Library function declarations ---*/
-  __pyx_init_filenames();
-  /*--- Threads initialization code ---*/
-  #if defined(__PYX_FORCE_INIT_THREADS) && __PYX_FORCE_INIT_THREADS
-  #ifdef WITH_THREAD /* Python build with threading support? */
-  PyEval_InitThreads();
-  #endif
-  #endif
-  /*--- Initialize various global constants etc. ---*/
-  if (unlikely(__Pyx_InitGlobals() < 0)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 1; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  /*--- Module creation code ---*/
-  #if PY_MAJOR_VERSION < 3
-  __pyx_m = Py_InitModule4(__Pyx_NAMESTR("intvol"), __pyx_methods, __pyx_mdoc, 0, PYTHON_API_VERSION);
-  #else
-  __pyx_m = PyModule_Create(&__pyx_moduledef);
-  #endif
-  if (!__pyx_m) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 1; __pyx_clineno = __LINE__; goto __pyx_L1_error;};
-  #if PY_MAJOR_VERSION < 3
-  Py_INCREF(__pyx_m);
-  #endif
-  __pyx_b = PyImport_AddModule(__Pyx_NAMESTR(__Pyx_BUILTIN_MODULE_NAME));
-  if (!__pyx_b) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 1; __pyx_clineno = __LINE__; goto __pyx_L1_error;};
-  if (__Pyx_SetAttrString(__pyx_m, "__builtins__", __pyx_b) < 0) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 1; __pyx_clineno = __LINE__; goto __pyx_L1_error;};
-  if (__pyx_module_is_main_nipy__algorithms__statistics__intvol) {
-    if (__Pyx_SetAttrString(__pyx_m, "__name__", __pyx_kp___main__) < 0) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 1; __pyx_clineno = __LINE__; goto __pyx_L1_error;};
-  }
-  /*--- Builtin init code ---*/
-  if (unlikely(__Pyx_InitCachedBuiltins() < 0)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 1; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __pyx_skip_dispatch = 0;
-  /*--- Global init code ---*/
-  /*--- Function export code ---*/
-  /*--- Type init code ---*/
-  /*--- Type import code ---*/
-  __pyx_ptype_5numpy_dtype = __Pyx_ImportType("numpy", "dtype", sizeof(PyArray_Descr)); if (unlikely(!__pyx_ptype_5numpy_dtype)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 43; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __pyx_ptype_5numpy_ndarray = __Pyx_ImportType("numpy", "ndarray", sizeof(PyArrayObject)); if (unlikely(!__pyx_ptype_5numpy_ndarray)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 51; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  /*--- Function import code ---*/
-  /*--- Execution code ---*/
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":11
- * """
- * 
- * import numpy as np             # <<<<<<<<<<<<<<
- * cimport numpy as np
- * from scipy.sparse import dok_matrix
- */
-  __pyx_1 = __Pyx_Import(__pyx_kp_numpy, 0); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 11; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_1);
-  if (PyObject_SetAttr(__pyx_m, __pyx_kp_np, __pyx_1) < 0) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 11; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_DECREF(__pyx_1); __pyx_1 = 0;
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":13
- * import numpy as np
- * cimport numpy as np
- * from scipy.sparse import dok_matrix             # <<<<<<<<<<<<<<
- * 
- * # local imports
- */
-  __pyx_t_1 = PyList_New(1); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 13; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_1));
-  __Pyx_INCREF(__pyx_kp_dok_matrix);
-  PyList_SET_ITEM(__pyx_t_1, 0, __pyx_kp_dok_matrix);
-  __Pyx_GIVEREF(__pyx_kp_dok_matrix);
-  __pyx_1 = __Pyx_Import(__pyx_kp_42, ((PyObject *)__pyx_t_1)); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 13; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_1);
-  __Pyx_DECREF(((PyObject *)__pyx_t_1)); __pyx_t_1 = 0;
-  __pyx_2 = PyObject_GetAttr(__pyx_1, __pyx_kp_dok_matrix); if (unlikely(!__pyx_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 13; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_2);
-  if (PyObject_SetAttr(__pyx_m, __pyx_kp_dok_matrix, __pyx_2) < 0) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 13; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_DECREF(__pyx_2); __pyx_2 = 0;
-  __Pyx_DECREF(__pyx_1); __pyx_1 = 0;
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":17
- * # local imports
- * 
- * from utils import cube_with_strides_center, join_complexes             # <<<<<<<<<<<<<<
- * 
- * DTYPE_float = np.float
- */
-  __pyx_t_1 = PyList_New(2); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 17; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_1));
-  __Pyx_INCREF(__pyx_kp_43);
-  PyList_SET_ITEM(__pyx_t_1, 0, __pyx_kp_43);
-  __Pyx_GIVEREF(__pyx_kp_43);
-  __Pyx_INCREF(__pyx_kp_join_complexes);
-  PyList_SET_ITEM(__pyx_t_1, 1, __pyx_kp_join_complexes);
-  __Pyx_GIVEREF(__pyx_kp_join_complexes);
-  __pyx_1 = __Pyx_Import(__pyx_kp_utils, ((PyObject *)__pyx_t_1)); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 17; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_1);
-  __Pyx_DECREF(((PyObject *)__pyx_t_1)); __pyx_t_1 = 0;
-  __pyx_2 = PyObject_GetAttr(__pyx_1, __pyx_kp_43); if (unlikely(!__pyx_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 17; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_2);
-  if (PyObject_SetAttr(__pyx_m, __pyx_kp_43, __pyx_2) < 0) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 17; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_DECREF(__pyx_2); __pyx_2 = 0;
-  __pyx_2 = PyObject_GetAttr(__pyx_1, __pyx_kp_join_complexes); if (unlikely(!__pyx_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 17; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_2);
-  if (PyObject_SetAttr(__pyx_m, __pyx_kp_join_complexes, __pyx_2) < 0) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 17; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_DECREF(__pyx_2); __pyx_2 = 0;
-  __Pyx_DECREF(__pyx_1); __pyx_1 = 0;
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":19
- * from utils import cube_with_strides_center, join_complexes
- * 
- * DTYPE_float = np.float             # <<<<<<<<<<<<<<
- * ctypedef np.float_t DTYPE_float_t
- * 
- */
-  __pyx_1 = __Pyx_GetName(__pyx_m, __pyx_kp_np); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 19; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_1);
-  __pyx_t_1 = PyObject_GetAttr(__pyx_1, __pyx_kp_float); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 19; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_1);
-  __Pyx_DECREF(__pyx_1); __pyx_1 = 0;
-  if (PyObject_SetAttr(__pyx_m, __pyx_kp_DTYPE_float, __pyx_t_1) < 0) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 19; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-
-  /* "/home/mb312/dev_trees/nipy-repo/model_dev/nipy/algorithms/statistics/intvol.pyx":22
- * ctypedef np.float_t DTYPE_float_t
- * 
- * DTYPE_int = np.int             # <<<<<<<<<<<<<<
- * ctypedef np.int_t DTYPE_int_t
- * 
- */
-  __pyx_2 = __Pyx_GetName(__pyx_m, __pyx_kp_np); if (unlikely(!__pyx_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 22; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_2);
-  __pyx_t_1 = PyObject_GetAttr(__pyx_2, __pyx_kp_int); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 22; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_1);
-  __Pyx_DECREF(__pyx_2); __pyx_2 = 0;
-  if (PyObject_SetAttr(__pyx_m, __pyx_kp_DTYPE_int, __pyx_t_1) < 0) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 22; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-
-  /* "/home/mb312/usr/local/lib/python2.5/site-packages/Cython/Includes/stdlib.pxd":2
- * 
- * cdef extern from "stdlib.h" nogil:             # <<<<<<<<<<<<<<
- *     void free(void *ptr)
- *     void *malloc(size_t size)
- */
-  goto __pyx_L0;
-  __pyx_L1_error:;
-  __Pyx_XDECREF(__pyx_1);
-  __Pyx_XDECREF(__pyx_2);
-  __Pyx_XDECREF(__pyx_t_1);
-  __Pyx_AddTraceback("nipy.algorithms.statistics.intvol");
-  Py_DECREF(__pyx_m); __pyx_m = 0;
-  __pyx_L0:;
-  __Pyx_FinishRefcountContext();
-  #if PY_MAJOR_VERSION < 3
-  return;
-  #else
-  return __pyx_m;
-  #endif
-}
-
-static const char *__pyx_filenames[] = {
-  "intvol.pyx",
-  "numpy.pxd",
-};
-
-/* Runtime support code */
-
-static void __pyx_init_filenames(void) {
-  __pyx_f = __pyx_filenames;
-}
-
-static void __Pyx_RaiseDoubleKeywordsError(
-    const char* func_name,
-    PyObject* kw_name)
-{
-    PyErr_Format(PyExc_TypeError,
-        #if PY_MAJOR_VERSION >= 3
-        "%s() got multiple values for keyword argument '%U'", func_name, kw_name);
-        #else
-        "%s() got multiple values for keyword argument '%s'", func_name,
-        PyString_AS_STRING(kw_name));
-        #endif
-}
-
-static void __Pyx_RaiseArgtupleInvalid(
-    const char* func_name,
-    int exact,
-    Py_ssize_t num_min,
-    Py_ssize_t num_max,
-    Py_ssize_t num_found)
-{
-    Py_ssize_t num_expected;
-    const char *number, *more_or_less;
-
-    if (num_found < num_min) {
-        num_expected = num_min;
-        more_or_less = "at least";
-    } else {
-        num_expected = num_max;
-        more_or_less = "at most";
-    }
-    if (exact) {
-        more_or_less = "exactly";
-    }
-    number = (num_expected == 1) ? "" : "s";
-    PyErr_Format(PyExc_TypeError,
-        #if PY_VERSION_HEX < 0x02050000
-            "%s() takes %s %d positional argument%s (%d given)",
-        #else
-            "%s() takes %s %zd positional argument%s (%zd given)",
-        #endif
-        func_name, more_or_less, num_expected, number, num_found);
-}
-
-static int __Pyx_ParseOptionalKeywords(
-    PyObject *kwds,
-    PyObject **argnames[],
-    PyObject *kwds2,
-    PyObject *values[],
-    Py_ssize_t num_pos_args,
-    const char* function_name)
-{
-    PyObject *key = 0, *value = 0;
-    Py_ssize_t pos = 0;
-    PyObject*** name;
-    PyObject*** first_kw_arg = argnames + num_pos_args;
-
-    while (PyDict_Next(kwds, &pos, &key, &value)) {
-        name = first_kw_arg;
-        while (*name && (**name != key)) name++;
-        if (*name) {
-            values[name-argnames] = value;
-        } else {
-            #if PY_MAJOR_VERSION < 3
-            if (unlikely(!PyString_CheckExact(key)) && unlikely(!PyString_Check(key))) {
-            #else
-            if (unlikely(!PyUnicode_CheckExact(key)) && unlikely(!PyUnicode_Check(key))) {
-            #endif
-                goto invalid_keyword_type;
-            } else {
-                for (name = first_kw_arg; *name; name++) {
-                    #if PY_MAJOR_VERSION >= 3
-                    if (PyUnicode_GET_SIZE(**name) == PyUnicode_GET_SIZE(key) &&
-                        PyUnicode_Compare(**name, key) == 0) break;
-                    #else
-                    if (PyString_GET_SIZE(**name) == PyString_GET_SIZE(key) &&
-                        _PyString_Eq(**name, key)) break;
-                    #endif
-                }
-                if (*name) {
-                    values[name-argnames] = value;
-                } else {
-                    /* unexpected keyword found */
-                    for (name=argnames; name != first_kw_arg; name++) {
-                        if (**name == key) goto arg_passed_twice;
-                        #if PY_MAJOR_VERSION >= 3
-                        if (PyUnicode_GET_SIZE(**name) == PyUnicode_GET_SIZE(key) &&
-                            PyUnicode_Compare(**name, key) == 0) goto arg_passed_twice;
-                        #else
-                        if (PyString_GET_SIZE(**name) == PyString_GET_SIZE(key) &&
-                            _PyString_Eq(**name, key)) goto arg_passed_twice;
-                        #endif
-                    }
-                    if (kwds2) {
-                        if (unlikely(PyDict_SetItem(kwds2, key, value))) goto bad;
-                    } else {
-                        goto invalid_keyword;
-                    }
-                }
-            }
-        }
-    }
-    return 0;
-arg_passed_twice:
-    __Pyx_RaiseDoubleKeywordsError(function_name, **name);
-    goto bad;
-invalid_keyword_type:
-    PyErr_Format(PyExc_TypeError,
-        "%s() keywords must be strings", function_name);
-    goto bad;
-invalid_keyword:
-    PyErr_Format(PyExc_TypeError,
-    #if PY_MAJOR_VERSION < 3
-        "%s() got an unexpected keyword argument '%s'",
-        function_name, PyString_AsString(key));
-    #else
-        "%s() got an unexpected keyword argument '%U'",
-        function_name, key);
-    #endif
-bad:
-    return -1;
-}
-
-static INLINE int __Pyx_IsLittleEndian(void) {
-  unsigned int n = 1;
-  return *(unsigned char*)(&n) != 0;
-}
-
-typedef struct {
-  __Pyx_StructField root;
-  __Pyx_BufFmt_StackElem* head;
-  size_t fmt_offset;
-  int new_count, enc_count;
-  int is_complex;
-  char enc_type;
-  char packmode;
-} __Pyx_BufFmt_Context;
-
-static void __Pyx_BufFmt_Init(__Pyx_BufFmt_Context* ctx,
-                              __Pyx_BufFmt_StackElem* stack,
-                              __Pyx_TypeInfo* type) {
-  stack[0].field = &ctx->root;
-  stack[0].parent_offset = 0;
-  ctx->root.type = type;
-  ctx->root.name = "buffer dtype";
-  ctx->root.offset = 0;
-  ctx->head = stack;
-  ctx->head->field = &ctx->root;
-  ctx->fmt_offset = 0;
-  ctx->head->parent_offset = 0;
-  ctx->packmode = '@';
-  ctx->new_count = 1;
-  ctx->enc_count = 0;
-  ctx->enc_type = 0;
-  ctx->is_complex = 0;
-  while (type->typegroup == 'S') {
-    ++ctx->head;
-    ctx->head->field = type->fields;
-    ctx->head->parent_offset = 0;
-    type = type->fields->type;
-  }
-}
-
-static int __Pyx_BufFmt_ParseNumber(const char** ts) {
-    int count;
-    const char* t = *ts;
-    if (*t < '0' || *t > '9') {
-      return -1;
-    } else {
-        count = *t++ - '0';
-        while (*t >= '0' && *t < '9') {
-            count *= 10;
-            count += *t++ - '0';
-        }
-    }
-    *ts = t;
-    return count;
-}
-
-static void __Pyx_BufFmt_RaiseUnexpectedChar(char ch) {
-  char msg[] = {ch, 0};
-  PyErr_Format(PyExc_ValueError, "Unexpected format string character: '%s'", msg);
-}
-
-static const char* __Pyx_BufFmt_DescribeTypeChar(char ch, int is_complex) {
-  switch (ch) {
-    case 'b': return "'char'";
-    case 'B': return "'unsigned char'";
-    case 'h': return "'short'";
-    case 'H': return "'unsigned short'";
-    case 'i': return "'int'";
-    case 'I': return "'unsigned int'";
-    case 'l': return "'long'";
-    case 'L': return "'unsigned long'";
-    case 'q': return "'long long'";
-    case 'Q': return "'unsigned long long'";
-    case 'f': return (is_complex ? "'complex float'" : "'float'");
-    case 'd': return (is_complex ? "'complex double'" : "'double'");
-    case 'g': return (is_complex ? "'complex long double'" : "'long double'");
-    case 'T': return "a struct";
-    case 'O': return "Python object";
-    case 'P': return "a pointer";
-    case 0: return "end";
-    default: return "unparseable format string";
-  }
-}
-
-static size_t __Pyx_BufFmt_TypeCharToStandardSize(char ch, int is_complex) {
-  switch (ch) {
-    case '?': case 'c': case 'b': case 'B': return 1;
-    case 'h': case 'H': return 2;
-    case 'i': case 'I': case 'l': case 'L': return 4;
-    case 'q': case 'Q': return 8;
-    case 'f': return (is_complex ? 8 : 4);
-    case 'd': return (is_complex ? 16 : 8);
-    case 'g': {
-      PyErr_SetString(PyExc_ValueError, "Python does not define a standard format string size for long double ('g')..");
-      return 0;
-    }
-    case 'O': case 'P': return sizeof(void*);
-    default:
-      __Pyx_BufFmt_RaiseUnexpectedChar(ch);
-      return 0;
-    }
-}
-
-static size_t __Pyx_BufFmt_TypeCharToNativeSize(char ch, int is_complex) {
-  switch (ch) {
-    case 'c': case 'b': case 'B': return 1;
-    case 'h': case 'H': return sizeof(short);
-    case 'i': case 'I': return sizeof(int);
-    case 'l': case 'L': return sizeof(long);
-    #ifdef HAVE_LONG_LONG
-    case 'q': case 'Q': return sizeof(PY_LONG_LONG);
-    #endif
-    case 'f': return sizeof(float) * (is_complex ? 2 : 1);
-    case 'd': return sizeof(double) * (is_complex ? 2 : 1);
-    case 'g': return sizeof(long double) * (is_complex ? 2 : 1);
-    case 'O': case 'P': return sizeof(void*);
-    default: {
-      __Pyx_BufFmt_RaiseUnexpectedChar(ch);
-      return 0;
-    }    
-  }
-}
-
-typedef struct { char c; short x; } __Pyx_st_short;
-typedef struct { char c; int x; } __Pyx_st_int;
-typedef struct { char c; long x; } __Pyx_st_long;
-typedef struct { char c; float x; } __Pyx_st_float;
-typedef struct { char c; double x; } __Pyx_st_double;
-typedef struct { char c; long double x; } __Pyx_st_longdouble;
-typedef struct { char c; void *x; } __Pyx_st_void_p;
-#ifdef HAVE_LONG_LONG
-typedef struct { char c; PY_LONG_LONG x; } __Pyx_s_long_long;
-#endif
-
-static size_t __Pyx_BufFmt_TypeCharToAlignment(char ch, int is_complex) {
-  switch (ch) {
-    case '?': case 'c': case 'b': case 'B': return 1;
-    case 'h': case 'H': return sizeof(__Pyx_st_short) - sizeof(short);
-    case 'i': case 'I': return sizeof(__Pyx_st_int) - sizeof(int);
-    case 'l': case 'L': return sizeof(__Pyx_st_long) - sizeof(long);
-#ifdef HAVE_LONG_LONG
-    case 'q': case 'Q': return sizeof(__Pyx_s_long_long) - sizeof(PY_LONG_LONG);
-#endif
-    case 'f': return sizeof(__Pyx_st_float) - sizeof(float);
-    case 'd': return sizeof(__Pyx_st_double) - sizeof(double);
-    case 'g': return sizeof(__Pyx_st_longdouble) - sizeof(long double);
-    case 'P': case 'O': return sizeof(__Pyx_st_void_p) - sizeof(void*);
-    default:
-      __Pyx_BufFmt_RaiseUnexpectedChar(ch);
-      return 0;
-    }
-}
-
-static size_t __Pyx_BufFmt_TypeCharToGroup(char ch, int is_complex) {
-  switch (ch) {
-    case 'c': case 'b': case 'h': case 'i': case 'l': case 'q': return 'I';
-    case 'B': case 'H': case 'I': case 'L': case 'Q': return 'U';
-    case 'f': case 'd': case 'g': return (is_complex ? 'C' : 'R');
-    case 'O': return 'O';
-    case 'P': return 'P';
-    default: {
-      __Pyx_BufFmt_RaiseUnexpectedChar(ch);
-      return 0;
-    }    
-  }
-}
-
-static void __Pyx_BufFmt_RaiseExpected(__Pyx_BufFmt_Context* ctx) {
-  if (ctx->head == NULL || ctx->head->field == &ctx->root) {
-    const char* expected;
-    const char* quote;
-    if (ctx->head == NULL) {
-      expected = "end";
-      quote = "";
-    } else {
-      expected = ctx->head->field->type->name;
-      quote = "'";
-    }
-    PyErr_Format(PyExc_ValueError,
-                 "Buffer dtype mismatch, expected %s%s%s but got %s",
-                 quote, expected, quote,
-                 __Pyx_BufFmt_DescribeTypeChar(ctx->enc_type, ctx->is_complex));
-  } else {
-    __Pyx_StructField* field = ctx->head->field;
-    __Pyx_StructField* parent = (ctx->head - 1)->field;
-    PyErr_Format(PyExc_ValueError,
-                 "Buffer dtype mismatch, expected '%s' but got %s in '%s.%s'",
-                 field->type->name, __Pyx_BufFmt_DescribeTypeChar(ctx->enc_type, ctx->is_complex),
-                 parent->type->name, field->name);
-  }
-}
-
-static int __Pyx_BufFmt_ProcessTypeChunk(__Pyx_BufFmt_Context* ctx) {
-  char group;
-  size_t size, offset;
-  if (ctx->enc_type == 0) return 0;
-  group = __Pyx_BufFmt_TypeCharToGroup(ctx->enc_type, ctx->is_complex);
-  do {
-    __Pyx_StructField* field = ctx->head->field;
-    __Pyx_TypeInfo* type = field->type;
-  
-    if (ctx->packmode == '@' || ctx->packmode == '^') {
-      size = __Pyx_BufFmt_TypeCharToNativeSize(ctx->enc_type, ctx->is_complex);
-    } else {
-      size = __Pyx_BufFmt_TypeCharToStandardSize(ctx->enc_type, ctx->is_complex);
-    }
-    if (ctx->packmode == '@') {
-      int align_at = __Pyx_BufFmt_TypeCharToAlignment(ctx->enc_type, ctx->is_complex);
-      int align_mod_offset;
-      if (align_at == 0) return -1;
-      align_mod_offset = ctx->fmt_offset % align_at;
-      if (align_mod_offset > 0) ctx->fmt_offset += align_at - align_mod_offset;
-    }
-
-    if (type->size != size || type->typegroup != group) {
-      if (type->typegroup == 'C' && type->fields != NULL) {
-        /* special case -- treat as struct rather than complex number */
-        size_t parent_offset = ctx->head->parent_offset + field->offset;
-        ++ctx->head;
-        ctx->head->field = type->fields;
-        ctx->head->parent_offset = parent_offset;
-        continue;
-      }
-    
-      __Pyx_BufFmt_RaiseExpected(ctx);
-      return -1;
-    }
-
-    offset = ctx->head->parent_offset + field->offset;
-    if (ctx->fmt_offset != offset) {
-      PyErr_Format(PyExc_ValueError,
-                   "Buffer dtype mismatch; next field is at offset %"PY_FORMAT_SIZE_T"d "
-                   "but %"PY_FORMAT_SIZE_T"d expected", ctx->fmt_offset, offset);
-      return -1;
-    }
-
-    ctx->fmt_offset += size;
-  
-    --ctx->enc_count; /* Consume from buffer string */
-
-    /* Done checking, move to next field, pushing or popping struct stack if needed */
-    while (1) {
-      if (field == &ctx->root) {
-        ctx->head = NULL;
-        if (ctx->enc_count != 0) {
-          __Pyx_BufFmt_RaiseExpected(ctx);
-          return -1;
-        }
-        break; /* breaks both loops as ctx->enc_count == 0 */
-      }
-      ctx->head->field = ++field;
-      if (field->type == NULL) {
-        --ctx->head;
-        field = ctx->head->field;
-        continue;
-      } else if (field->type->typegroup == 'S') {
-        size_t parent_offset = ctx->head->parent_offset + field->offset;
-        if (field->type->fields->type == NULL) continue; /* empty struct */
-        field = field->type->fields;
-        ++ctx->head;
-        ctx->head->field = field;
-        ctx->head->parent_offset = parent_offset;
-        break;
-      } else {
-        break;
-      }
-    }
-  } while (ctx->enc_count);
-  ctx->enc_type = 0;
-  ctx->is_complex = 0;
-  return 0;    
-}
-
-static int __Pyx_BufFmt_FirstPack(__Pyx_BufFmt_Context* ctx) {
-  if (ctx->enc_type != 0 || ctx->packmode != '@') {
-    PyErr_SetString(PyExc_ValueError, "Buffer packing mode currently only allowed at beginning of format string (this is a defect)");
-    return -1;
-  }
-  return 0;
-}
-
-static const char* __Pyx_BufFmt_CheckString(__Pyx_BufFmt_Context* ctx, const char* ts) {
-  int got_Z = 0;
-  while (1) {
-    switch(*ts) {
-      case 0:
-        if (ctx->enc_type != 0 && ctx->head == NULL) {
-          __Pyx_BufFmt_RaiseExpected(ctx);
-          return NULL;
-        }
-        if (__Pyx_BufFmt_ProcessTypeChunk(ctx) == -1) return NULL;
-        if (ctx->head != NULL) {
-          __Pyx_BufFmt_RaiseExpected(ctx);
-          return NULL;
-        }
-        return ts;
-      case ' ':
-      case 10:
-      case 13:
-        ++ts;
-        break;
-      case '<':
-        if (!__Pyx_IsLittleEndian()) {
-          PyErr_SetString(PyExc_ValueError, "Little-endian buffer not supported on big-endian compiler");
-          return NULL;
-        }
-        if (__Pyx_BufFmt_FirstPack(ctx) == -1) return NULL;
-        ctx->packmode = '=';
-        ++ts;
-        break;
-      case '>':
-      case '!':
-        if (__Pyx_IsLittleEndian()) {
-          PyErr_SetString(PyExc_ValueError, "Big-endian buffer not supported on little-endian compiler");
-          return NULL;
-        }
-        if (__Pyx_BufFmt_FirstPack(ctx) == -1) return NULL;
-        ctx->packmode = '=';
-        ++ts;
-        break;
-      case '=':
-      case '@':
-      case '^':
-        if (__Pyx_BufFmt_FirstPack(ctx) == -1) return NULL;
-        ctx->packmode = *ts++;
-        break;
-      case 'T': /* substruct */
-        {
-          int i;
-          const char* ts_after_sub;
-          int struct_count = ctx->new_count;
-          ctx->new_count = 1;
-          ++ts;
-          if (*ts != '{') {
-            PyErr_SetString(PyExc_ValueError, "Buffer acquisition: Expected '{' after 'T'");
-            return NULL;
-          }
-          ++ts;
-          ts_after_sub = ts;
-          for (i = 0; i != struct_count; ++i) {
-            ts_after_sub = __Pyx_BufFmt_CheckString(ctx, ts);
-            if (!ts_after_sub) return NULL;
-          }
-          ts = ts_after_sub;
-        }
-        break;
-      case '}': /* end of substruct; either repeat or move on */
-        ++ts;
-        return ts;
-      case 'x':
-        if (__Pyx_BufFmt_ProcessTypeChunk(ctx) == -1) return NULL;
-        ctx->fmt_offset += ctx->new_count;
-        ctx->new_count = 1;
-        ctx->enc_count = 0;
-        ctx->enc_type = 0;
-        ++ts;
-        break;
-      case 'Z':
-        got_Z = 1;
-        ++ts;
-        if (*ts != 'f' && *ts != 'd' && *ts != 'g') {
-          __Pyx_BufFmt_RaiseUnexpectedChar('Z');
-          return NULL;
-        }        /* fall through */
-      case 'c': case 'b': case 'B': case 'h': case 'H': case 'i': case 'I':
-      case 'l': case 'L': case 'q': case 'Q':
-      case 'f': case 'd': case 'g':
-      case 'O':
-        if (ctx->enc_type == *ts && got_Z == ctx->is_complex) {
-          /* Continue pooling same type */
-          ctx->enc_count += ctx->new_count;
-        } else {
-          /* New type */
-          if (__Pyx_BufFmt_ProcessTypeChunk(ctx) == -1) return NULL;
-          ctx->enc_count = ctx->new_count;
-          ctx->enc_type = *ts;
-          ctx->is_complex = got_Z;
-        }
-        ++ts;
-        ctx->new_count = 1;
-        got_Z = 0;
-        break;
-      default:
-        {
-          ctx->new_count = __Pyx_BufFmt_ParseNumber(&ts);
-          if (ctx->new_count == -1) { /* First char was not a digit */
-            char msg[2] = { *ts, 0 };
-            PyErr_Format(PyExc_ValueError,
-                         "Does not understand character buffer dtype format string ('%s')", msg);
-            return NULL;
-          }
-        }
-      
-    }
-  }
-}
-
-static INLINE void __Pyx_ZeroBuffer(Py_buffer* buf) {
-  buf->buf = NULL;
-  buf->obj = NULL;
-  buf->strides = __Pyx_zeros;
-  buf->shape = __Pyx_zeros;
-  buf->suboffsets = __Pyx_minusones;
-}
-
-static int __Pyx_GetBufferAndValidate(Py_buffer* buf, PyObject* obj, __Pyx_TypeInfo* dtype, int flags, int nd, int cast, __Pyx_BufFmt_StackElem* stack) {
-  if (obj == Py_None) {
-    __Pyx_ZeroBuffer(buf);
-    return 0;
-  }
-  buf->buf = NULL;
-  if (__Pyx_GetBuffer(obj, buf, flags) == -1) goto fail;
-  if (buf->ndim != nd) {
-    PyErr_Format(PyExc_ValueError,
-                 "Buffer has wrong number of dimensions (expected %d, got %d)",
-                 nd, buf->ndim);
-    goto fail;
-  }
-  if (!cast) {
-    __Pyx_BufFmt_Context ctx;
-    __Pyx_BufFmt_Init(&ctx, stack, dtype);
-    if (!__Pyx_BufFmt_CheckString(&ctx, buf->format)) goto fail;
-  }
-  if ((unsigned)buf->itemsize != dtype->size) {
-    PyErr_Format(PyExc_ValueError,
-      "Item size of buffer (%"PY_FORMAT_SIZE_T"d byte%s) does not match size of '%s' (%"PY_FORMAT_SIZE_T"d byte%s)",
-      buf->itemsize, (buf->itemsize > 1) ? "s" : "",
-      dtype->name,
-      dtype->size, (dtype->size > 1) ? "s" : "");
-    goto fail;
-  }
-  if (buf->suboffsets == NULL) buf->suboffsets = __Pyx_minusones;
-  return 0;
-fail:;
-  __Pyx_ZeroBuffer(buf);
-  return -1;
-}
-
-static INLINE void __Pyx_SafeReleaseBuffer(Py_buffer* info) {
-  if (info->buf == NULL) return;
-  if (info->suboffsets == __Pyx_minusones) info->suboffsets = NULL;
-  __Pyx_ReleaseBuffer(info);
-}
-
-static int __Pyx_TypeTest(PyObject *obj, PyTypeObject *type) {
-    if (!type) {
-        PyErr_Format(PyExc_SystemError, "Missing type object");
-        return 0;
-    }
-    if (obj == Py_None || PyObject_TypeCheck(obj, type))
-        return 1;
-    PyErr_Format(PyExc_TypeError, "Cannot convert %s to %s",
-        Py_TYPE(obj)->tp_name, type->tp_name);
-    return 0;
-}
-
-static void __Pyx_RaiseBufferFallbackError(void) {
-  PyErr_Format(PyExc_ValueError,
-     "Buffer acquisition failed on assignment; and then reacquiring the old buffer failed too!");
-}
-
-
-static void __Pyx_RaiseBufferIndexError(int axis) {
-  PyErr_Format(PyExc_IndexError,
-     "Out of bounds on buffer access (axis %d)", axis);
-}
-
-
-static INLINE void __Pyx_ErrRestore(PyObject *type, PyObject *value, PyObject *tb) {
-    PyObject *tmp_type, *tmp_value, *tmp_tb;
-    PyThreadState *tstate = PyThreadState_GET();
-
-#if PY_MAJOR_VERSION >= 3
-    /* Note: this is a temporary work-around to prevent crashes in Python 3.0 */
-    if ((tstate->exc_type != NULL) & (tstate->exc_type != Py_None)) {
-        tmp_type = tstate->exc_type;
-        tmp_value = tstate->exc_value;
-        tmp_tb = tstate->exc_traceback;
-        PyErr_NormalizeException(&type, &value, &tb);
-        PyErr_NormalizeException(&tmp_type, &tmp_value, &tmp_tb);
-        tstate->exc_type = 0;
-        tstate->exc_value = 0;
-        tstate->exc_traceback = 0;
-        PyException_SetContext(value, tmp_value);
-        Py_DECREF(tmp_type);
-        Py_XDECREF(tmp_tb);
-    }
-#endif
-
-    tmp_type = tstate->curexc_type;
-    tmp_value = tstate->curexc_value;
-    tmp_tb = tstate->curexc_traceback;
-    tstate->curexc_type = type;
-    tstate->curexc_value = value;
-    tstate->curexc_traceback = tb;
-    Py_XDECREF(tmp_type);
-    Py_XDECREF(tmp_value);
-    Py_XDECREF(tmp_tb);
-}
-
-static INLINE void __Pyx_ErrFetch(PyObject **type, PyObject **value, PyObject **tb) {
-    PyThreadState *tstate = PyThreadState_GET();
-    *type = tstate->curexc_type;
-    *value = tstate->curexc_value;
-    *tb = tstate->curexc_traceback;
-
-    tstate->curexc_type = 0;
-    tstate->curexc_value = 0;
-    tstate->curexc_traceback = 0;
-}
-
-
-static int __Pyx_ArgTypeTest(PyObject *obj, PyTypeObject *type, int none_allowed,
-    const char *name, int exact)
-{
-    if (!type) {
-        PyErr_Format(PyExc_SystemError, "Missing type object");
-        return 0;
-    }
-    if (none_allowed && obj == Py_None) return 1;
-    else if (exact) {
-        if (Py_TYPE(obj) == type) return 1;
-    }
-    else {
-        if (PyObject_TypeCheck(obj, type)) return 1;
-    }
-    PyErr_Format(PyExc_TypeError,
-        "Argument '%s' has incorrect type (expected %s, got %s)",
-        name, type->tp_name, Py_TYPE(obj)->tp_name);
-    return 0;
-}
-
-#if PY_MAJOR_VERSION < 3
-static int __Pyx_GetBuffer(PyObject *obj, Py_buffer *view, int flags) {
-  #if PY_VERSION_HEX >= 0x02060000
-  if (Py_TYPE(obj)->tp_flags & Py_TPFLAGS_HAVE_NEWBUFFER)
-      return PyObject_GetBuffer(obj, view, flags);
-  #endif
-  if (PyObject_TypeCheck(obj, __pyx_ptype_5numpy_ndarray)) return __pyx_pf_5numpy_7ndarray___getbuffer__(obj, view, flags);
-  else {
-  PyErr_Format(PyExc_TypeError, "'%100s' does not have the buffer interface", Py_TYPE(obj)->tp_name);
-  return -1;
-    }
-}
-
-static void __Pyx_ReleaseBuffer(Py_buffer *view) {
-  PyObject* obj = view->obj;
-  if (obj) {
-if (PyObject_TypeCheck(obj, __pyx_ptype_5numpy_ndarray)) __pyx_pf_5numpy_7ndarray___releasebuffer__(obj, view);
-    Py_DECREF(obj);
-    view->obj = NULL;
-  }
-}
-
-#endif
-
-static PyObject *__Pyx_Import(PyObject *name, PyObject *from_list) {
-    PyObject *__import__ = 0;
-    PyObject *empty_list = 0;
-    PyObject *module = 0;
-    PyObject *global_dict = 0;
-    PyObject *empty_dict = 0;
-    PyObject *list;
-    __import__ = __Pyx_GetAttrString(__pyx_b, "__import__");
-    if (!__import__)
-        goto bad;
-    if (from_list)
-        list = from_list;
-    else {
-        empty_list = PyList_New(0);
-        if (!empty_list)
-            goto bad;
-        list = empty_list;
-    }
-    global_dict = PyModule_GetDict(__pyx_m);
-    if (!global_dict)
-        goto bad;
-    empty_dict = PyDict_New();
-    if (!empty_dict)
-        goto bad;
-    module = PyObject_CallFunctionObjArgs(__import__,
-        name, global_dict, empty_dict, list, NULL);
-bad:
-    Py_XDECREF(empty_list);
-    Py_XDECREF(__import__);
-    Py_XDECREF(empty_dict);
-    return module;
-}
-
-static PyObject *__Pyx_GetName(PyObject *dict, PyObject *name) {
-    PyObject *result;
-    result = PyObject_GetAttr(dict, name);
-    if (!result)
-        PyErr_SetObject(PyExc_NameError, name);
-    return result;
-}
-
-static void __Pyx_Raise(PyObject *type, PyObject *value, PyObject *tb) {
-    Py_XINCREF(type);
-    Py_XINCREF(value);
-    Py_XINCREF(tb);
-    /* First, check the traceback argument, replacing None with NULL. */
-    if (tb == Py_None) {
-        Py_DECREF(tb);
-        tb = 0;
-    }
-    else if (tb != NULL && !PyTraceBack_Check(tb)) {
-        PyErr_SetString(PyExc_TypeError,
-            "raise: arg 3 must be a traceback or None");
-        goto raise_error;
-    }
-    /* Next, replace a missing value with None */
-    if (value == NULL) {
-        value = Py_None;
-        Py_INCREF(value);
-    }
-    #if PY_VERSION_HEX < 0x02050000
-    if (!PyClass_Check(type))
-    #else
-    if (!PyType_Check(type))
-    #endif
-    {
-        /* Raising an instance.  The value should be a dummy. */
-        if (value != Py_None) {
-            PyErr_SetString(PyExc_TypeError,
-                "instance exception may not have a separate value");
-            goto raise_error;
-        }
-        /* Normalize to raise <class>, <instance> */
-        Py_DECREF(value);
-        value = type;
-        #if PY_VERSION_HEX < 0x02050000
-            if (PyInstance_Check(type)) {
-                type = (PyObject*) ((PyInstanceObject*)type)->in_class;
-                Py_INCREF(type);
-            }
-            else {
-                type = 0;
-                PyErr_SetString(PyExc_TypeError,
-                    "raise: exception must be an old-style class or instance");
-                goto raise_error;
-            }
-        #else
-            type = (PyObject*) Py_TYPE(type);
-            Py_INCREF(type);
-            if (!PyType_IsSubtype((PyTypeObject *)type, (PyTypeObject *)PyExc_BaseException)) {
-                PyErr_SetString(PyExc_TypeError,
-                    "raise: exception class must be a subclass of BaseException");
-                goto raise_error;
-            }
-        #endif
-    }
-    __Pyx_ErrRestore(type, value, tb);
-    return;
-raise_error:
-    Py_XDECREF(value);
-    Py_XDECREF(type);
-    Py_XDECREF(tb);
-    return;
-}
-
-static INLINE int __Pyx_StrEq(const char *s1, const char *s2) {
-     while (*s1 != '\0' && *s1 == *s2) { s1++; s2++; }
-     return *s1 == *s2;
-}
-
-static INLINE unsigned char __Pyx_PyInt_AsUnsignedChar(PyObject* x) {
-    if (sizeof(unsigned char) < sizeof(long)) {
-        long val = __Pyx_PyInt_AsLong(x);
-        if (unlikely(val != (long)(unsigned char)val)) {
-            if (unlikely(val == -1 && PyErr_Occurred()))
-                return (unsigned char)-1;
-            if (unlikely(val < 0)) {
-                PyErr_SetString(PyExc_OverflowError,
-                                "can't convert negative value to unsigned char");
-                return (unsigned char)-1;
-            }
-            PyErr_SetString(PyExc_OverflowError,
-                           "value too large to convert to unsigned char");
-            return (unsigned char)-1;
-        }
-        return (unsigned char)val;
-    }
-    return (unsigned char)__Pyx_PyInt_AsUnsignedLong(x);
-}
-
-static INLINE unsigned short __Pyx_PyInt_AsUnsignedShort(PyObject* x) {
-    if (sizeof(unsigned short) < sizeof(long)) {
-        long val = __Pyx_PyInt_AsLong(x);
-        if (unlikely(val != (long)(unsigned short)val)) {
-            if (unlikely(val == -1 && PyErr_Occurred()))
-                return (unsigned short)-1;
-            if (unlikely(val < 0)) {
-                PyErr_SetString(PyExc_OverflowError,
-                                "can't convert negative value to unsigned short");
-                return (unsigned short)-1;
-            }
-            PyErr_SetString(PyExc_OverflowError,
-                           "value too large to convert to unsigned short");
-            return (unsigned short)-1;
-        }
-        return (unsigned short)val;
-    }
-    return (unsigned short)__Pyx_PyInt_AsUnsignedLong(x);
-}
-
-static INLINE unsigned int __Pyx_PyInt_AsUnsignedInt(PyObject* x) {
-    if (sizeof(unsigned int) < sizeof(long)) {
-        long val = __Pyx_PyInt_AsLong(x);
-        if (unlikely(val != (long)(unsigned int)val)) {
-            if (unlikely(val == -1 && PyErr_Occurred()))
-                return (unsigned int)-1;
-            if (unlikely(val < 0)) {
-                PyErr_SetString(PyExc_OverflowError,
-                                "can't convert negative value to unsigned int");
-                return (unsigned int)-1;
-            }
-            PyErr_SetString(PyExc_OverflowError,
-                           "value too large to convert to unsigned int");
-            return (unsigned int)-1;
-        }
-        return (unsigned int)val;
-    }
-    return (unsigned int)__Pyx_PyInt_AsUnsignedLong(x);
-}
-
-static INLINE char __Pyx_PyInt_AsChar(PyObject* x) {
-    if (sizeof(char) < sizeof(long)) {
-        long val = __Pyx_PyInt_AsLong(x);
-        if (unlikely(val != (long)(char)val)) {
-            if (unlikely(val == -1 && PyErr_Occurred()))
-                return (char)-1;
-            PyErr_SetString(PyExc_OverflowError,
-                           "value too large to convert to char");
-            return (char)-1;
-        }
-        return (char)val;
-    }
-    return (char)__Pyx_PyInt_AsLong(x);
-}
-
-static INLINE short __Pyx_PyInt_AsShort(PyObject* x) {
-    if (sizeof(short) < sizeof(long)) {
-        long val = __Pyx_PyInt_AsLong(x);
-        if (unlikely(val != (long)(short)val)) {
-            if (unlikely(val == -1 && PyErr_Occurred()))
-                return (short)-1;
-            PyErr_SetString(PyExc_OverflowError,
-                           "value too large to convert to short");
-            return (short)-1;
-        }
-        return (short)val;
-    }
-    return (short)__Pyx_PyInt_AsLong(x);
-}
-
-static INLINE int __Pyx_PyInt_AsInt(PyObject* x) {
-    if (sizeof(int) < sizeof(long)) {
-        long val = __Pyx_PyInt_AsLong(x);
-        if (unlikely(val != (long)(int)val)) {
-            if (unlikely(val == -1 && PyErr_Occurred()))
-                return (int)-1;
-            PyErr_SetString(PyExc_OverflowError,
-                           "value too large to convert to int");
-            return (int)-1;
-        }
-        return (int)val;
-    }
-    return (int)__Pyx_PyInt_AsLong(x);
-}
-
-static INLINE signed char __Pyx_PyInt_AsSignedChar(PyObject* x) {
-    if (sizeof(signed char) < sizeof(long)) {
-        long val = __Pyx_PyInt_AsLong(x);
-        if (unlikely(val != (long)(signed char)val)) {
-            if (unlikely(val == -1 && PyErr_Occurred()))
-                return (signed char)-1;
-            PyErr_SetString(PyExc_OverflowError,
-                           "value too large to convert to signed char");
-            return (signed char)-1;
-        }
-        return (signed char)val;
-    }
-    return (signed char)__Pyx_PyInt_AsSignedLong(x);
-}
-
-static INLINE signed short __Pyx_PyInt_AsSignedShort(PyObject* x) {
-    if (sizeof(signed short) < sizeof(long)) {
-        long val = __Pyx_PyInt_AsLong(x);
-        if (unlikely(val != (long)(signed short)val)) {
-            if (unlikely(val == -1 && PyErr_Occurred()))
-                return (signed short)-1;
-            PyErr_SetString(PyExc_OverflowError,
-                           "value too large to convert to signed short");
-            return (signed short)-1;
-        }
-        return (signed short)val;
-    }
-    return (signed short)__Pyx_PyInt_AsSignedLong(x);
-}
-
-static INLINE signed int __Pyx_PyInt_AsSignedInt(PyObject* x) {
-    if (sizeof(signed int) < sizeof(long)) {
-        long val = __Pyx_PyInt_AsLong(x);
-        if (unlikely(val != (long)(signed int)val)) {
-            if (unlikely(val == -1 && PyErr_Occurred()))
-                return (signed int)-1;
-            PyErr_SetString(PyExc_OverflowError,
-                           "value too large to convert to signed int");
-            return (signed int)-1;
-        }
-        return (signed int)val;
-    }
-    return (signed int)__Pyx_PyInt_AsSignedLong(x);
-}
-
-static INLINE unsigned long __Pyx_PyInt_AsUnsignedLong(PyObject* x) {
-#if PY_VERSION_HEX < 0x03000000
-    if (likely(PyInt_CheckExact(x) || PyInt_Check(x))) {
-        long val = PyInt_AS_LONG(x);
-        if (unlikely(val < 0)) {
-            PyErr_SetString(PyExc_OverflowError,
-                            "can't convert negative value to unsigned long");
-            return (unsigned long)-1;
-        }
-        return (unsigned long)val;
-    } else
-#endif
-    if (likely(PyLong_CheckExact(x) || PyLong_Check(x))) {
-        if (unlikely(Py_SIZE(x) < 0)) {
-            PyErr_SetString(PyExc_OverflowError,
-                            "can't convert negative value to unsigned long");
-            return (unsigned long)-1;
-        }
-        return PyLong_AsUnsignedLong(x);
-    } else {
-        unsigned long val;
-        PyObject *tmp = __Pyx_PyNumber_Int(x);
-        if (!tmp) return (unsigned long)-1;
-        val = __Pyx_PyInt_AsUnsignedLong(tmp);
-        Py_DECREF(tmp);
-        return val;
-    }
-}
-
-static INLINE unsigned PY_LONG_LONG __Pyx_PyInt_AsUnsignedLongLong(PyObject* x) {
-#if PY_VERSION_HEX < 0x03000000
-    if (likely(PyInt_CheckExact(x) || PyInt_Check(x))) {
-        long val = PyInt_AS_LONG(x);
-        if (unlikely(val < 0)) {
-            PyErr_SetString(PyExc_OverflowError,
-                            "can't convert negative value to unsigned PY_LONG_LONG");
-            return (unsigned PY_LONG_LONG)-1;
-        }
-        return (unsigned PY_LONG_LONG)val;
-    } else
-#endif
-    if (likely(PyLong_CheckExact(x) || PyLong_Check(x))) {
-        if (unlikely(Py_SIZE(x) < 0)) {
-            PyErr_SetString(PyExc_OverflowError,
-                            "can't convert negative value to unsigned PY_LONG_LONG");
-            return (unsigned PY_LONG_LONG)-1;
-        }
-        return PyLong_AsUnsignedLongLong(x);
-    } else {
-        unsigned PY_LONG_LONG val;
-        PyObject *tmp = __Pyx_PyNumber_Int(x);
-        if (!tmp) return (unsigned PY_LONG_LONG)-1;
-        val = __Pyx_PyInt_AsUnsignedLongLong(tmp);
-        Py_DECREF(tmp);
-        return val;
-    }
-}
-
-static INLINE long __Pyx_PyInt_AsLong(PyObject* x) {
-#if PY_VERSION_HEX < 0x03000000
-    if (likely(PyInt_CheckExact(x) || PyInt_Check(x))) {
-        long val = PyInt_AS_LONG(x);
-        return (long)val;
-    } else
-#endif
-    if (likely(PyLong_CheckExact(x) || PyLong_Check(x))) {
-        return PyLong_AsLong(x);
-    } else {
-        long val;
-        PyObject *tmp = __Pyx_PyNumber_Int(x);
-        if (!tmp) return (long)-1;
-        val = __Pyx_PyInt_AsLong(tmp);
-        Py_DECREF(tmp);
-        return val;
-    }
-}
-
-static INLINE PY_LONG_LONG __Pyx_PyInt_AsLongLong(PyObject* x) {
-#if PY_VERSION_HEX < 0x03000000
-    if (likely(PyInt_CheckExact(x) || PyInt_Check(x))) {
-        long val = PyInt_AS_LONG(x);
-        return (PY_LONG_LONG)val;
-    } else
-#endif
-    if (likely(PyLong_CheckExact(x) || PyLong_Check(x))) {
-        return PyLong_AsLongLong(x);
-    } else {
-        PY_LONG_LONG val;
-        PyObject *tmp = __Pyx_PyNumber_Int(x);
-        if (!tmp) return (PY_LONG_LONG)-1;
-        val = __Pyx_PyInt_AsLongLong(tmp);
-        Py_DECREF(tmp);
-        return val;
-    }
-}
-
-static INLINE signed long __Pyx_PyInt_AsSignedLong(PyObject* x) {
-#if PY_VERSION_HEX < 0x03000000
-    if (likely(PyInt_CheckExact(x) || PyInt_Check(x))) {
-        long val = PyInt_AS_LONG(x);
-        return (signed long)val;
-    } else
-#endif
-    if (likely(PyLong_CheckExact(x) || PyLong_Check(x))) {
-        return PyLong_AsLong(x);
-    } else {
-        signed long val;
-        PyObject *tmp = __Pyx_PyNumber_Int(x);
-        if (!tmp) return (signed long)-1;
-        val = __Pyx_PyInt_AsSignedLong(tmp);
-        Py_DECREF(tmp);
-        return val;
-    }
-}
-
-static INLINE signed PY_LONG_LONG __Pyx_PyInt_AsSignedLongLong(PyObject* x) {
-#if PY_VERSION_HEX < 0x03000000
-    if (likely(PyInt_CheckExact(x) || PyInt_Check(x))) {
-        long val = PyInt_AS_LONG(x);
-        return (signed PY_LONG_LONG)val;
-    } else
-#endif
-    if (likely(PyLong_CheckExact(x) || PyLong_Check(x))) {
-        return PyLong_AsLongLong(x);
-    } else {
-        signed PY_LONG_LONG val;
-        PyObject *tmp = __Pyx_PyNumber_Int(x);
-        if (!tmp) return (signed PY_LONG_LONG)-1;
-        val = __Pyx_PyInt_AsSignedLongLong(tmp);
-        Py_DECREF(tmp);
-        return val;
-    }
-}
-
-static void __Pyx_WriteUnraisable(const char *name) {
-    PyObject *old_exc, *old_val, *old_tb;
-    PyObject *ctx;
-    __Pyx_ErrFetch(&old_exc, &old_val, &old_tb);
-    #if PY_MAJOR_VERSION < 3
-    ctx = PyString_FromString(name);
-    #else
-    ctx = PyUnicode_FromString(name);
-    #endif
-    __Pyx_ErrRestore(old_exc, old_val, old_tb);
-    if (!ctx) {
-        PyErr_WriteUnraisable(Py_None);
-    } else {
-        PyErr_WriteUnraisable(ctx);
-        Py_DECREF(ctx);
-    }
-}
-
-#ifndef __PYX_HAVE_RT_ImportType
-#define __PYX_HAVE_RT_ImportType
-static PyTypeObject *__Pyx_ImportType(const char *module_name, const char *class_name,
-    long size)
-{
-    PyObject *py_module = 0;
-    PyObject *result = 0;
-    PyObject *py_name = 0;
-
-    py_module = __Pyx_ImportModule(module_name);
-    if (!py_module)
-        goto bad;
-    #if PY_MAJOR_VERSION < 3
-    py_name = PyString_FromString(class_name);
-    #else
-    py_name = PyUnicode_FromString(class_name);
-    #endif
-    if (!py_name)
-        goto bad;
-    result = PyObject_GetAttr(py_module, py_name);
-    Py_DECREF(py_name);
-    py_name = 0;
-    Py_DECREF(py_module);
-    py_module = 0;
-    if (!result)
-        goto bad;
-    if (!PyType_Check(result)) {
-        PyErr_Format(PyExc_TypeError, 
-            "%s.%s is not a type object",
-            module_name, class_name);
-        goto bad;
-    }
-    if (((PyTypeObject *)result)->tp_basicsize != size) {
-        PyErr_Format(PyExc_ValueError, 
-            "%s.%s does not appear to be the correct type object",
-            module_name, class_name);
-        goto bad;
-    }
-    return (PyTypeObject *)result;
-bad:
-    Py_XDECREF(py_module);
-    Py_XDECREF(result);
-    return 0;
-}
-#endif
-
-#ifndef __PYX_HAVE_RT_ImportModule
-#define __PYX_HAVE_RT_ImportModule
-static PyObject *__Pyx_ImportModule(const char *name) {
-    PyObject *py_name = 0;
-    PyObject *py_module = 0;
-
-    #if PY_MAJOR_VERSION < 3
-    py_name = PyString_FromString(name);
-    #else
-    py_name = PyUnicode_FromString(name);
-    #endif
-    if (!py_name)
-        goto bad;
-    py_module = PyImport_Import(py_name);
-    Py_DECREF(py_name);
-    return py_module;
-bad:
-    Py_XDECREF(py_name);
-    return 0;
-}
-#endif
-
-#include "compile.h"
-#include "frameobject.h"
-#include "traceback.h"
-
-static void __Pyx_AddTraceback(const char *funcname) {
-    PyObject *py_srcfile = 0;
-    PyObject *py_funcname = 0;
-    PyObject *py_globals = 0;
-    PyObject *empty_string = 0;
-    PyCodeObject *py_code = 0;
-    PyFrameObject *py_frame = 0;
-
-    #if PY_MAJOR_VERSION < 3
-    py_srcfile = PyString_FromString(__pyx_filename);
-    #else
-    py_srcfile = PyUnicode_FromString(__pyx_filename);
-    #endif
-    if (!py_srcfile) goto bad;
-    if (__pyx_clineno) {
-        #if PY_MAJOR_VERSION < 3
-        py_funcname = PyString_FromFormat( "%s (%s:%d)", funcname, __pyx_cfilenm, __pyx_clineno);
-        #else
-        py_funcname = PyUnicode_FromFormat( "%s (%s:%d)", funcname, __pyx_cfilenm, __pyx_clineno);
-        #endif
-    }
-    else {
-        #if PY_MAJOR_VERSION < 3
-        py_funcname = PyString_FromString(funcname);
-        #else
-        py_funcname = PyUnicode_FromString(funcname);
-        #endif
-    }
-    if (!py_funcname) goto bad;
-    py_globals = PyModule_GetDict(__pyx_m);
-    if (!py_globals) goto bad;
-    #if PY_MAJOR_VERSION < 3
-    empty_string = PyString_FromStringAndSize("", 0);
-    #else
-    empty_string = PyBytes_FromStringAndSize("", 0);
-    #endif
-    if (!empty_string) goto bad;
-    py_code = PyCode_New(
-        0,            /*int argcount,*/
-        #if PY_MAJOR_VERSION >= 3
-        0,            /*int kwonlyargcount,*/
-        #endif
-        0,            /*int nlocals,*/
-        0,            /*int stacksize,*/
-        0,            /*int flags,*/
-        empty_string, /*PyObject *code,*/
-        __pyx_empty_tuple,  /*PyObject *consts,*/
-        __pyx_empty_tuple,  /*PyObject *names,*/
-        __pyx_empty_tuple,  /*PyObject *varnames,*/
-        __pyx_empty_tuple,  /*PyObject *freevars,*/
-        __pyx_empty_tuple,  /*PyObject *cellvars,*/
-        py_srcfile,   /*PyObject *filename,*/
-        py_funcname,  /*PyObject *name,*/
-        __pyx_lineno,   /*int firstlineno,*/
-        empty_string  /*PyObject *lnotab*/
-    );
-    if (!py_code) goto bad;
-    py_frame = PyFrame_New(
-        PyThreadState_GET(), /*PyThreadState *tstate,*/
-        py_code,             /*PyCodeObject *code,*/
-        py_globals,          /*PyObject *globals,*/
-        0                    /*PyObject *locals*/
-    );
-    if (!py_frame) goto bad;
-    py_frame->f_lineno = __pyx_lineno;
-    PyTraceBack_Here(py_frame);
-bad:
-    Py_XDECREF(py_srcfile);
-    Py_XDECREF(py_funcname);
-    Py_XDECREF(empty_string);
-    Py_XDECREF(py_code);
-    Py_XDECREF(py_frame);
-}
-
-static int __Pyx_InitStrings(__Pyx_StringTabEntry *t) {
-    while (t->p) {
-        #if PY_MAJOR_VERSION < 3
-        if (t->is_unicode && (!t->is_identifier)) {
-            *t->p = PyUnicode_DecodeUTF8(t->s, t->n - 1, NULL);
-        } else if (t->intern) {
-            *t->p = PyString_InternFromString(t->s);
-        } else {
-            *t->p = PyString_FromStringAndSize(t->s, t->n - 1);
-        }
-        #else  /* Python 3+ has unicode identifiers */
-        if (t->is_identifier || (t->is_unicode && t->intern)) {
-            *t->p = PyUnicode_InternFromString(t->s);
-        } else if (t->is_unicode) {
-            *t->p = PyUnicode_FromStringAndSize(t->s, t->n - 1);
-        } else {
-            *t->p = PyBytes_FromStringAndSize(t->s, t->n - 1);
-        }
-        #endif
-        if (!*t->p)
-            return -1;
-        ++t;
-    }
-    return 0;
-}
-
-/* Type Conversion Functions */
-
-static INLINE int __Pyx_PyObject_IsTrue(PyObject* x) {
-   if (x == Py_True) return 1;
-   else if ((x == Py_False) | (x == Py_None)) return 0;
-   else return PyObject_IsTrue(x);
-}
-
-static INLINE PyObject* __Pyx_PyNumber_Int(PyObject* x) {
-  PyNumberMethods *m;
-  const char *name = NULL;
-  PyObject *res = NULL;
-#if PY_VERSION_HEX < 0x03000000
-  if (PyInt_Check(x) || PyLong_Check(x))
-#else
-  if (PyLong_Check(x))
-#endif
-    return Py_INCREF(x), x;
-  m = Py_TYPE(x)->tp_as_number;
-#if PY_VERSION_HEX < 0x03000000
-  if (m && m->nb_int) {
-    name = "int";
-    res = PyNumber_Int(x);
-  }
-  else if (m && m->nb_long) {
-    name = "long";
-    res = PyNumber_Long(x);
-  }
-#else
-  if (m && m->nb_int) {
-    name = "int";
-    res = PyNumber_Long(x);
-  }
-#endif
-  if (res) {
-#if PY_VERSION_HEX < 0x03000000
-    if (!PyInt_Check(res) && !PyLong_Check(res)) {
-#else
-    if (!PyLong_Check(res)) {
-#endif
-      PyErr_Format(PyExc_TypeError,
-                   "__%s__ returned non-%s (type %.200s)",
-                   name, name, Py_TYPE(res)->tp_name);
-      Py_DECREF(res);
-      return NULL;
-    }
-  }
-  else if (!PyErr_Occurred()) {
-    PyErr_SetString(PyExc_TypeError,
-                    "an integer is required");
-  }
-  return res;
-}
-
-static INLINE Py_ssize_t __Pyx_PyIndex_AsSsize_t(PyObject* b) {
-  Py_ssize_t ival;
-  PyObject* x = PyNumber_Index(b);
-  if (!x) return -1;
-  ival = PyInt_AsSsize_t(x);
-  Py_DECREF(x);
-  return ival;
-}
-
-static INLINE PyObject * __Pyx_PyInt_FromSize_t(size_t ival) {
-#if PY_VERSION_HEX < 0x02050000
-   if (ival <= LONG_MAX)
-       return PyInt_FromLong((long)ival);
-   else {
-       unsigned char *bytes = (unsigned char *) &ival;
-       int one = 1; int little = (int)*(unsigned char*)&one;
-       return _PyLong_FromByteArray(bytes, sizeof(size_t), little, 0);
-   }
-#else
-   return PyInt_FromSize_t(ival);
-#endif
-}
-
-static INLINE size_t __Pyx_PyInt_AsSize_t(PyObject* x) {
-   unsigned PY_LONG_LONG val = __Pyx_PyInt_AsUnsignedLongLong(x);
-   if (unlikely(val == (unsigned PY_LONG_LONG)-1 && PyErr_Occurred())) {
-       return (size_t)-1;
-   } else if (unlikely(val != (unsigned PY_LONG_LONG)(size_t)val)) {
-       PyErr_SetString(PyExc_OverflowError,
-                       "value too large to convert to size_t");
-       return (size_t)-1;
-   }
-   return (size_t)val;
-}
-
-
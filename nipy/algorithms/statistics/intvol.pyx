@@ -8,6 +8,8 @@ Taylor, J.E. & Worsley, K.J. (2007). "Detecting sparse signal in random fields,
 
 """
 
+import threading
+import multiprocessing
 import numpy as np
 cimport numpy as np
 from scipy.sparse import dok_matrix
@@ -22,6 +24,142 @@ ctypedef np.float_t DTYPE_float_t
 DTYPE_int = np.int
 ctypedef np.int_t DTYPE_int_t
 
+cdef extern from "math.h":
+    double sqrt(double x) nogil
+    double acos(double x) nogil
+
+cdef double PI = np.pi
+
+# C versions of the intrinsic volumes of simplices, which run without
+# the GIL; the Python functions below call them. The operations are
+# those of the former numpy code, in the same order.
+
+cdef inline double _mu3_tet(double D00, double D01, double D02, double D03,
+                            double D11, double D12, double D13, 
+                            double D22, double D23, 
+                            double D33) nogil:
+  cdef double C00, C01, C02, C11, C12, C22
+  C00 = D00 - 2*D03 + D33
+  C01 = D01 - D13 - D03 + D33
+  C02 = D02 - D23 - D03 + D33
+  C11 = D11 - 2*D13 + D33
+  C12 = D12 - D13 - D23 + D33
+  C22 = D22 - 2*D23 + D33
+  return sqrt((C00 * (C11 * C22 - C12 * C12) -
+               C01 * (C01 * C22 - C02 * C12) +
+               C02 * (C01 * C12 - C11 * C02))) / 6.
+
+cdef inline double _mu2_tri(double D00, double D01, double D02,
+                            double D11, double D12,
+                            double D22) nogil:
+  cdef double C00, C01, C11
+  C00 = D11 - 2*D01 + D00
+  C01 = D12 - D01 - D02 + D00
+  C11 = D22 - 2*D02 + D00
+  return sqrt((C00 * C11 - C01 * C01)) * 0.5
+
+cdef inline double _mu1_edge(double D00, double D01, 
+                             double D11) nogil:
+  return sqrt(D00 - 2*D01 + D11)
+
+cdef inline double _mu1_tri(double D00, double D01, double D02,
+                            double D11, double D12,
+                            double D22) nogil:
+  cdef double mu = 0
+  mu += _mu1_edge(D00, D01, D11)
+  mu += _mu1_edge(D00, D02, D22)
+  mu += _mu1_edge(D11, D12, D22)
+  return mu * 0.5
+
+cdef inline double _mu2_tet(double D00, double D01, double D02, double D03,
+                            double D11, double D12, double D13, 
+                            double D22, double D23,
+                            double D33) nogil:
+  cdef double mu = 0
+  mu += _mu2_tri(D00, D01, D02, D11, D12, D22)
+  mu += _mu2_tri(D00, D02, D03, D22, D23, D33)
+  mu += _mu2_tri(D11, D12, D13, D22, D23, D33)
+  mu += _mu2_tri(D00, D01, D03, D11, D13, D33)
+  return mu * 0.5
+
+cdef double _mu1_tetface(double Ds0s0,
+                         double Ds0s1,
+                         double Ds1s1,
+                         double Ds0t0,
+                         double Ds0t1,
+                         double Ds1t0,
+                         double Ds1t1,
+                         double Dt0t0,
+                         double Dt0t1,
+                         double Dt1t1) nogil:
+
+    cdef double A00, A01, A02, A11, A12, A22
+    cdef double length, norm_proj0, norm_proj1, inner_prod_proj, a
+
+    A00 = Ds1s1 - 2 * Ds0s1 + Ds0s0
+    A11 = Dt0t0 - 2 * Ds0t0 + Ds0s0
+    A22 = Dt1t1 - 2 * Ds0t1 + Ds0s0
+
+    A01 = Ds1t0 - Ds0t0 - Ds0s1 + Ds0s0 
+    A02 = Ds1t1 - Ds0t1 - Ds0s1 + Ds0s0 
+    A12 = Dt0t1 - Ds0t0 - Ds0t1 + Ds0s0 
+
+    length = sqrt(A00)
+
+    norm_proj0 = A11 - A01 * A01 / A00
+    norm_proj1 = A22 - A02 * A02 / A00
+    inner_prod_proj = A12 - A01 * A02 / A00
+
+    a = (PI - acos(inner_prod_proj / sqrt(norm_proj0 * norm_proj1))) * length / (2 * PI)
+    if a != a:
+        return 0
+    return a
+
+cdef inline double _mu1_tet(double D00, double D01, double D02, double D03,
+                            double D11, double D12, double D13, 
+                            double D22, double D23,
+                            double D33) nogil:
+  cdef double mu = 0
+  mu += _mu1_tetface(D00, D01, D11, D02, D03, D12, D13, D22, D23, D33)
+  mu += _mu1_tetface(D00, D02, D22, D01, D03, D12, D23, D11, D13, D33)
+  mu += _mu1_tetface(D00, D03, D33, D01, D02, D13, D23, D11, D12, D22)
+  mu += _mu1_tetface(D11, D12, D22, D01, D13, D02, D23, D00, D03, D33)
+  mu += _mu1_tetface(D11, D13, D33, D01, D12, D03, D23, D00, D02, D22)
+  mu += _mu1_tetface(D22, D23, D33, D02, D12, D03, D13, D00, D01, D11)
+  return mu
+
+
+def _threads_count(nthreads):
+  """
+  Number of threads to use: all processors if nthreads is zero or
+  negative.
+  """
+  if nthreads > 0:
+    return nthreads
+  try:
+    return multiprocessing.cpu_count()
+  except NotImplementedError:
+    return 1
+
+def _run_slabs(work, args, long nplanes, nthreads):
+  """
+  Call work(start, stop, *args) on nthreads consecutive ranges of
+  the nplanes first-axis planes of a volume, each from its own
+  thread. work is expected to release the GIL.
+  """
+  nthreads = min(_threads_count(nthreads), max(nplanes, 1))
+  if nthreads < 2:
+    work(0, nplanes, *args)
+    return
+  bounds = [(nplanes*rank)//nthreads for rank in range(nthreads+1)]
+  threads = [threading.Thread(target=work, args=(bounds[rank], bounds[rank+1]) + tuple(args)) 
+             for rank in range(nthreads)]
+  for thread in threads:
+    thread.start()
+  for thread in threads:
+    thread.join()
+
+
 def mu3_tet(double D00, double D01, double D02, double D03,
             double D11, double D12, double D13, 
             double D22, double D23, 
@@ -46,20 +184,8 @@ def mu3_tet(double D00, double D01, double D02, double D03,
   mu3 : float
 
   """
+  return _mu3_tet(D00, D01, D02, D03, D11, D12, D13, D22, D23, D33)
 
-  C00, C01, C02, C11, C12, C22 = (D00 - 2*D03 + D33,
-                                  D01 - D13 - 
-                                  D03 + D33,
-                                  D02 - D23 - 
-                                  D03 + D33,            
-                                  D11 - 2*D13 + D33,
-                                  D12 - D13 - 
-                                  D23 + D33,
-                                  D22 - 2*D23 + D33)
-
-  return np.sqrt((C00 * (C11 * C22 - C12 * C12) -
-                  C01 * (C01 * C22 - C02 * C12) +
-                  C02 * (C01 * C12 - C11 * C02))) / 6.;
 
 def mu2_tet(double D00, double D01, double D02, double D03,
             double D11, double D12, double D13, 
@@ -84,16 +210,9 @@ def mu2_tet(double D00, double D01, double D02, double D03,
   mu2 : float
 
   """
-  
-  cdef double mu = 0
+  return _mu2_tet(D00, D01, D02, D03, D11, D12, D13, D22, D23, D33)
 
-  mu += mu2_tri(D00, D01, D02, D11, D12, D22)
-  mu += mu2_tri(D00, D02, D03, D22, D23, D33)
-  mu += mu2_tri(D11, D12, D13, D22, D23, D33)
-  mu += mu2_tri(D00, D01, D03, D11, D13, D33)
-  return mu * 0.5
 
-  
 def mu1_tet(double D00, double D01, double D02, double D03,
             double D11, double D12, double D13, 
             double D22, double D23,
@@ -118,51 +237,8 @@ def mu1_tet(double D00, double D01, double D02, double D03,
   mu1 : float
 
   """
+  return _mu1_tet(D00, D01, D02, D03, D11, D12, D13, D22, D23, D33)
 
-  cdef mu
-  
-  mu = 0
-  mu += _mu1_tetface(D00, D01, D11, D02, D03, D12, D13, D22, D23, D33)
-  mu += _mu1_tetface(D00, D02, D22, D01, D03, D12, D23, D11, D13, D33)
-  mu += _mu1_tetface(D00, D03, D33, D01, D02, D13, D23, D11, D12, D22)
-  mu += _mu1_tetface(D11, D12, D22, D01, D13, D02, D23, D00, D03, D33)
-  mu += _mu1_tetface(D11, D13, D33, D01, D12, D03, D23, D00, D02, D22)
-  mu += _mu1_tetface(D22, D23, D33, D02, D12, D03, D13, D00, D01, D11)
-  
-  return mu
-
-cdef double _mu1_tetface(double Ds0s0,
-                         double Ds0s1,
-                         double Ds1s1,
-                         double Ds0t0,
-                         double Ds0t1,
-                         double Ds1t0,
-                         double Ds1t1,
-                         double Dt0t0,
-                         double Dt0t1,
-                         double Dt1t1):
-
-    cdef double A00, A01, A02, A11, A12, A22
-    cdef double length, norm_proj0, norm_proj1, inner_prod_proj
-
-    A00 = Ds1s1 - 2 * Ds0s1 + Ds0s0
-    A11 = Dt0t0 - 2 * Ds0t0 + Ds0s0
-    A22 = Dt1t1 - 2 * Ds0t1 + Ds0s0
-
-    A01 = Ds1t0 - Ds0t0 - Ds0s1 + Ds0s0 
-    A02 = Ds1t1 - Ds0t1 - Ds0s1 + Ds0s0 
-    A12 = Dt0t1 - Ds0t0 - Ds0t1 + Ds0s0 
-
-    length = np.sqrt(A00)
-
-    norm_proj0 = A11 - A01 * A01 / A00
-    norm_proj1 = A22 - A02 * A02 / A00
-    inner_prod_proj = A12 - A01 * A02 / A00
-
-    a = (np.pi - np.arccos(inner_prod_proj / np.sqrt(norm_proj0 * norm_proj1))) * length / (2 * np.pi)
-    if np.isnan(a):
-        return 0
-    return a
 
 def mu2_tri(double D00, double D01, double D02,
             double D11, double D12,
@@ -186,14 +262,8 @@ def mu2_tri(double D00, double D01, double D02,
 
   mu2 : float
   """
+  return _mu2_tri(D00, D01, D02, D11, D12, D22)
 
-  cdef double C00, C01, C11
-
-  C00 = D11 - 2*D01 + D00
-  C01 = D12 - D01 - D02 + D00
-  C11 = D22 - 2*D02 + D00
-
-  return np.sqrt((C00 * C11 - C01 * C01)) * 0.5
 
 def mu1_tri(double D00, double D01, double D02,
             double D11, double D12,
@@ -216,13 +286,9 @@ def mu1_tri(double D00, double D01, double D02,
 
   mu1 : float
   """
+  return _mu1_tri(D00, D01, D02, D11, D12, D22)
+
 
-  cdef double mu = 0
-  mu += mu1_edge(D00, D01, D11)
-  mu += mu1_edge(D00, D02, D22)
-  mu += mu1_edge(D11, D12, D22)
-  return mu * 0.5
-  
 def mu1_edge(double D00, double D01, 
              double D11):
   """
@@ -243,13 +309,68 @@ def mu1_edge(double D00, double D01,
 
   mu0 : float
   """
+  return _mu1_edge(D00, D01, D11)
+
+
+cdef long _ec3d_planes(long i0, long i1, long s1, long s2,
+                       long ss0, long ss1, long ss2, DTYPE_int_t* fmask,
+                       DTYPE_int_t* d4, long ds4, DTYPE_int_t* d3, long ds3,
+                       DTYPE_int_t* d2, long ds2) nogil:
+    """
+    Contributions of the simplices of the voxels in the planes
+    [i0,i1) to the Euler characteristic of EC3d; the simplices are
+    those uniquely associated with each voxel, hence the planes can be
+    processed separately.
+    """
+    cdef long i, j, k, l, index, m
+    cdef long l0 = 0
+
+    for i from i0 <= i < i1:
+        for j from 0 <= j < s1-1:
+            for k from 0 <= k < s2-1:
+                index = i*ss0+j*ss1+k*ss2
+                for l from 0 <= l < ds4:
+                    m = fmask[index + d4[4*l]]
+                    if m:
+                        m = m * fmask[index + d4[4*l+1]] * fmask[index + d4[4*l+2]] * fmask[index + d4[4*l+3]]
+                        l0 = l0 - m
 
-  cdef double mu
-  mu = 0
+                for l from 0 <= l < ds3:
+                    m = fmask[index + d3[3*l]]
+                    if m:
+                        m = m * fmask[index + d3[3*l+1]] * fmask[index + d3[3*l+2]]
+                        l0 = l0 + m
 
-  return np.sqrt(D00 - 2*D01 + D11)
+                for l from 0 <= l < ds2:
+                    m = fmask[index + d2[2*l]]
+                    if m:
+                        m = m * fmask[index + d2[2*l+1]]
+                        l0 = l0 - m
+    return l0
 
-def EC3d(np.ndarray[DTYPE_int_t, ndim=3] mask):
+def _ec3d_work(long start, long stop, long s1, long s2, long ss0, long ss1, long ss2,
+               np.ndarray[DTYPE_int_t, ndim=1] fmask,
+               np.ndarray[DTYPE_int_t, ndim=2] d4,
+               np.ndarray[DTYPE_int_t, ndim=2] d3,
+               np.ndarray[DTYPE_int_t, ndim=2] d2,
+               np.ndarray[DTYPE_int_t, ndim=1] partial):
+    """
+    Slab of EC3d, whose contribution is written in partial[start].
+    """
+    cdef long l0
+    cdef DTYPE_int_t *pfmask, *pd4, *pd3, *pd2
+    cdef long ds4 = d4.shape[0], ds3 = d3.shape[0], ds2 = d2.shape[0]
+
+    pfmask = <DTYPE_int_t*>fmask.data
+    pd4 = <DTYPE_int_t*>d4.data
+    pd3 = <DTYPE_int_t*>d3.data
+    pd2 = <DTYPE_int_t*>d2.data
+    with nogil:
+        l0 = _ec3d_planes(start, stop, s1, s2, ss0, ss1, ss2, pfmask, 
+                          pd4, ds4, pd3, ds3, pd2, ds2)
+    partial[start] = l0
+
+def EC3d(np.ndarray[DTYPE_int_t, ndim=3] mask, nthreads=1):
     """
     Given a 3d mask, compute the 0th intrinsic volume
     (Euler characteristic)
@@ -268,6 +389,11 @@ def EC3d(np.ndarray[DTYPE_int_t, ndim=3] mask):
          Binary mask determining whether or not
          a voxel is in the mask.
 
+    nthreads : int
+         Number of threads (all processors if zero or negative),
+         which process slabs of consecutive planes along the first
+         axis.
+
     Outputs:
     --------
 
@@ -307,9 +433,8 @@ def EC3d(np.ndarray[DTYPE_int_t, ndim=3] mask):
     cdef np.ndarray[DTYPE_int_t, ndim=2] d3
     cdef np.ndarray[DTYPE_int_t, ndim=2] d4
 
-    cdef long i, j, k, l, s0, s1, s2, ds2, ds3, ds4, index, m, nvox
+    cdef long s0, s1, s2, ds2, ds3, ds4
     cdef long ss0, ss1, ss2 # strides
-    cdef long v0, v1, v2, v3 # vertices
     cdef long l0 = 0
 
     cdef np.ndarray[DTYPE_int_t, ndim=3] pmask
@@ -347,43 +472,200 @@ def EC3d(np.ndarray[DTYPE_int_t, ndim=3] mask):
     ss1 = strides[1]
     ss2 = strides[2]
 
-    nvox = s0*s1*s2
-
-    for i in range(s0-1):
-        for j in range(s1-1):
-            for k in range(s2-1):
-                index = i*ss0+j*ss1+k*ss2
-                for l in range(ds4):
-                    v0 = index + d4[l,0]
-                    m = fmask[v0]
-                    if m:
-                        v1 = index + d4[l,1]
-                        v2 = index + d4[l,2]
-                        v3 = index + d4[l,3]
-                        m = m * fmask[v1] * fmask[v2] * fmask[v3]
-                        l0 = l0 - m
-
-                for l in range(ds3):
-                    v0 = index + d3[l,0]
-                    m = fmask[v0]
-                    if m:
-                        v1 = index + d3[l,1]
-                        v2 = index + d3[l,2]
-                        m = m * fmask[v1] * fmask[v2]
-                        l0 = l0 + m
+    d4 = np.ascontiguousarray(d4)
+    d3 = np.ascontiguousarray(d3)
+    d2 = np.ascontiguousarray(d2)
 
-                for l in range(ds2):
-                    v0 = index + d2[l,0]
-                    m = fmask[v0]
-                    if m:
-                        v1 = index + d2[l,1]
-                        m = m * fmask[v1]
-                        l0 = l0 - m
+    partial = np.zeros(s0, np.int)
+    _run_slabs(_ec3d_work, (s1, s2, ss0, ss1, ss2, fmask, d4, d3, d2, partial),
+               s0-1, nthreads)
+    l0 = partial.sum()
     l0 += mask.sum()
     return l0
 
+cdef void _lips3d_cube(DTYPE_float_t* D, long pindex, DTYPE_int_t* fpmask,
+                       DTYPE_int_t* d4, long ds4, DTYPE_int_t* d3, long ds3,
+                       DTYPE_int_t* d2, long ds2, double* mu) nogil:
+    """
+    Add the contributions of the simplices associated with the voxel
+    pindex of the padded mask to mu[0:4], given the 8x8 Gram matrix D
+    of the vertices of its cube.
+    """
+    cdef long l, m
+    cdef long v0, v1, v2, v3 # vertices for mask
+    cdef long w0, w1, w2, w3 # vertices for data
+
+    for l from 0 <= l < ds4:
+        v0 = pindex + d4[8*l]
+        w0 = d4[8*l+4]
+        m = fpmask[v0]
+        if m:
+            v1 = pindex + d4[8*l+1]
+            v2 = pindex + d4[8*l+2]
+            v3 = pindex + d4[8*l+3]
+            w1 = d4[8*l+5]
+            w2 = d4[8*l+6]
+            w3 = d4[8*l+7]
+
+            m = m * fpmask[v1] * fpmask[v2] * fpmask[v3]
+
+            mu[3] = mu[3] + m * _mu3_tet(D[w0*8+w0], D[w0*8+w1], D[w0*8+w2], 
+                                         D[w0*8+w3], D[w1*8+w1], D[w1*8+w2], 
+                                         D[w1*8+w3], D[w2*8+w2], D[w2*8+w3],
+                                         D[w3*8+w3])
+
+            mu[2] = mu[2] - m * _mu2_tet(D[w0*8+w0], D[w0*8+w1], D[w0*8+w2], 
+                                         D[w0*8+w3], D[w1*8+w1], D[w1*8+w2], 
+                                         D[w1*8+w3], D[w2*8+w2], D[w2*8+w3],
+                                         D[w3*8+w3])
+
+            mu[1] = mu[1] + m * _mu1_tet(D[w0*8+w0], D[w0*8+w1], D[w0*8+w2], 
+                                         D[w0*8+w3], D[w1*8+w1], D[w1*8+w2], 
+                                         D[w1*8+w3], D[w2*8+w2], D[w2*8+w3],
+                                         D[w3*8+w3])
+
+            mu[0] = mu[0] - m
+
+    for l from 0 <= l < ds3:
+        v0 = pindex + d3[6*l]
+        w0 = d3[6*l+3]
+        m = fpmask[v0]
+        if m:
+            v1 = pindex + d3[6*l+1]
+            v2 = pindex + d3[6*l+2]
+            w1 = d3[6*l+4]
+            w2 = d3[6*l+5]
+
+            m = m * fpmask[v1] * fpmask[v2] 
+            mu[2] = mu[2] + m * _mu2_tri(D[w0*8+w0], D[w0*8+w1], D[w0*8+w2], 
+                                         D[w1*8+w1], D[w1*8+w2], D[w2*8+w2]) 
+
+            mu[1] = mu[1] - m * _mu1_tri(D[w0*8+w0], D[w0*8+w1], D[w0*8+w2], 
+                                         D[w1*8+w1], D[w1*8+w2], D[w2*8+w2]) 
+
+            mu[0] = mu[0] + m
+
+    for l from 0 <= l < ds2:
+        v0 = pindex + d2[4*l]
+        w0 = d2[4*l+2]
+        m = fpmask[v0]
+        if m:
+            v1 = pindex + d2[4*l+1]
+            w1 = d2[4*l+3]
+            m = m * fpmask[v1]
+            mu[1] = mu[1] + m * _mu1_edge(D[w0*8+w0], D[w0*8+w1], D[w1*8+w1])
+
+            mu[0] = mu[0] - m
+
+cdef void _lips3d_planes(long i0, long i1, long s1, long s2,
+                         long ss0, long ss1, long ss2, 
+                         long ss0d, long ss1d, long ss2d, long nvox, long n,
+                         DTYPE_int_t* fmask, DTYPE_int_t* fpmask, 
+                         DTYPE_float_t* fcoords, DTYPE_int_t* cvertices,
+                         DTYPE_int_t* d4, long ds4, DTYPE_int_t* d3, long ds3,
+                         DTYPE_int_t* d2, long ds2, DTYPE_float_t* out) nogil:
+    """
+    Contributions of the simplices of the voxels in each plane i of
+    [i0,i1) to the intrinsic volumes of Lips3d, written in
+    out[4*i:4*i+4].
+    """
+    cdef long i, j, k, l, index, pindex, r, s, rr, ss, mr, ms
+    cdef double res
+    cdef double D[64]
+
+    for i from i0 <= i < i1:
+        out[4*i] = 0; out[4*i+1] = 0; out[4*i+2] = 0; out[4*i+3] = 0
+        for j from 0 <= j < s1-1:
+            for k from 0 <= k < s2-1:
+
+                pindex = i*ss0+j*ss1+k*ss2
+                index = i*ss0d+j*ss1d+k*ss2d
+                for r from 0 <= r < 8:
+                    rr = index+cvertices[r]
+                    if rr >= nvox:
+                        rr = rr - nvox
+                    mr = fmask[rr]
+                    for s from 0 <= s <= r:
+                        res = 0
+                        ss = index+cvertices[s]
+                        if ss >= nvox:
+                            ss = ss - nvox
+                        ms = fmask[ss]
+                        if mr * ms:
+                            for l from 0 <= l < n:
+                                res += fcoords[l*nvox+ss] * fcoords[l*nvox+rr]
+                            D[r*8+s] = res
+                            D[s*8+r] = res
+                        else:
+                            D[r*8+s] = 0
+                            D[s*8+r] = 0
+
+                _lips3d_cube(D, pindex, fpmask, d4, ds4, d3, ds3, d2, ds2, out+4*i)
+
+def _lips3d_work(long start, long stop, long s1, long s2, long ss0, long ss1, long ss2,
+                 long ss0d, long ss1d, long ss2d, 
+                 np.ndarray[DTYPE_int_t, ndim=1] fmask,
+                 np.ndarray[DTYPE_int_t, ndim=1] fpmask,
+                 np.ndarray[DTYPE_float_t, ndim=2] fcoords,
+                 np.ndarray[DTYPE_int_t, ndim=1] cvertices,
+                 np.ndarray[DTYPE_int_t, ndim=2] d4,
+                 np.ndarray[DTYPE_int_t, ndim=2] d3,
+                 np.ndarray[DTYPE_int_t, ndim=2] d2,
+                 np.ndarray[DTYPE_float_t, ndim=2] partial):
+    """
+    Slab of Lips3d, whose contributions are written in the rows
+    [start,stop) of partial.
+    """
+    cdef DTYPE_int_t *pfmask, *pfpmask, *pcvertices, *pd4, *pd3, *pd2
+    cdef DTYPE_float_t *pfcoords, *ppartial
+    cdef long nvox = fcoords.shape[1], n = fcoords.shape[0]
+    cdef long ds4 = d4.shape[0], ds3 = d3.shape[0], ds2 = d2.shape[0]
+
+    pfmask = <DTYPE_int_t*>fmask.data
+    pfpmask = <DTYPE_int_t*>fpmask.data
+    pfcoords = <DTYPE_float_t*>fcoords.data
+    pcvertices = <DTYPE_int_t*>cvertices.data
+    pd4 = <DTYPE_int_t*>d4.data
+    pd3 = <DTYPE_int_t*>d3.data
+    pd2 = <DTYPE_int_t*>d2.data
+    ppartial = <DTYPE_float_t*>partial.data
+    with nogil:
+        _lips3d_planes(start, stop, s1, s2, ss0, ss1, ss2, ss0d, ss1d, ss2d, 
+                       nvox, n, pfmask, pfpmask, pfcoords, pcvertices,
+                       pd4, ds4, pd3, ds3, pd2, ds2, ppartial)
+
+def _lips3d_tables(strides):
+    """
+    Tetrahedra, triangles and edges uniquely associated with a voxel
+    of a 3d array with the given strides, as rows of d4, d3 and d2.
+    The first columns hold the offsets of their vertices in the array,
+    the last ones the indices 4*a+2*b+c of the vertices (a,b,c) of the
+    cube of the voxel.
+    """
+    union = join_complexes(*[cube_with_strides_center((0,0,1), strides),
+                             cube_with_strides_center((0,1,0), strides),
+                             cube_with_strides_center((0,1,1), strides),
+                             cube_with_strides_center((1,0,0), strides),
+                             cube_with_strides_center((1,0,1), strides),
+                             cube_with_strides_center((1,1,0), strides),
+                             cube_with_strides_center((1,1,1), strides)])
+    c = cube_with_strides_center((0,0,0), strides)
+    m4 = np.array(list(c[4].difference(union[4])))
+    m3 = np.array(list(c[3].difference(union[3])))
+    m2 = np.array(list(c[2].difference(union[2])))
+
+    d4 = np.array([[_convert_stride3(v, strides, (4,2,1)) for v in m4[i]] for i in range(m4.shape[0])])
+    d4 = np.ascontiguousarray(np.hstack([m4, d4]))
+
+    d3 = np.array([[_convert_stride3(v, strides, (4,2,1)) for v in m3[i]] for i in range(m3.shape[0])])
+    d3 = np.ascontiguousarray(np.hstack([m3, d3]))
+
+    d2 = np.array([[_convert_stride3(v, strides, (4,2,1)) for v in m2[i]] for i in range(m2.shape[0])])
+    d2 = np.ascontiguousarray(np.hstack([m2, d2]))
+    return d4, d3, d2
+
 def Lips3d(np.ndarray[DTYPE_float_t, ndim=4] coords,
-          np.ndarray[DTYPE_int_t, ndim=3] mask):
+          np.ndarray[DTYPE_int_t, ndim=3] mask, nthreads=1):
     """
     Given a 3d mask and coordinates, estimate the intrinsic volumes
     of the masked region. The region is broken up into tetrahedra / 
@@ -401,6 +683,11 @@ def Lips3d(np.ndarray[DTYPE_float_t, ndim=4] coords,
          Binary mask determining whether or not
          a voxel is in the mask.
 
+    nthreads : int
+         Number of threads (all processors if zero or negative),
+         which process slabs of consecutive planes along the first
+         axis. The result does not depend on it.
+
     Outputs:
     --------
 
@@ -432,7 +719,7 @@ def Lips3d(np.ndarray[DTYPE_float_t, ndim=4] coords,
     # 'flattened' coords (2d array)
 
     cdef np.ndarray[DTYPE_float_t, ndim=2] fcoords 
-    cdef np.ndarray[DTYPE_float_t, ndim=2] D
+    cdef np.ndarray[DTYPE_float_t, ndim=2] partial
 
     # 'flattened' mask (1d array)
 
@@ -444,20 +731,13 @@ def Lips3d(np.ndarray[DTYPE_float_t, ndim=4] coords,
     # associated to particular voxels in the cuve
 
     cdef np.ndarray[DTYPE_int_t, ndim=2] d4
-    cdef np.ndarray[DTYPE_int_t, ndim=2] m4
     cdef np.ndarray[DTYPE_int_t, ndim=2] d3
-    cdef np.ndarray[DTYPE_int_t, ndim=2] m3
     cdef np.ndarray[DTYPE_int_t, ndim=2] d2
-    cdef np.ndarray[DTYPE_int_t, ndim=2] m2
     cdef np.ndarray[DTYPE_int_t, ndim=1] cvertices
 
-    cdef long i, j, k, l, s0, s1, s2, ds4, ds3, ds2
-    cdef long index, pindex, m, nvox, r, s, rr, ss, mr, ms
+    cdef long i, s0, s1, s2, ds4, ds3, ds2
     cdef long ss0, ss1, ss2 # strides
-    cdef long v0, v1, v2, v3 # vertices for mask
-    cdef long w0, w1, w2, w3 # vertices for data
     cdef double l0, l1, l2, l3
-    cdef double res
 
     l0 = 0; l1 = 0; l2 = 0; l3 = 0
 
@@ -472,7 +752,7 @@ def Lips3d(np.ndarray[DTYPE_float_t, ndim=4] coords,
     if (mask.shape[0], mask.shape[1], mask.shape[2]) != (coords.shape[1], coords.shape[2], coords.shape[3]):
         raise ValueError('shape of mask does not match coordinates')
 
-    fcoords = coords.reshape((coords.shape[0], (s0-1)*(s1-1)*(s2-1)))
+    fcoords = np.ascontiguousarray(coords.reshape((coords.shape[0], (s0-1)*(s1-1)*(s2-1))))
     n = fcoords.shape[0]
 
     # First do the interior contributions.
@@ -487,124 +767,257 @@ def Lips3d(np.ndarray[DTYPE_float_t, ndim=4] coords,
     cvertices = np.array([[[dstrides[0]*i+dstrides[1]*j+dstrides[2]*k for i in range(2)] for j in range(2)] for k in range(2)]).ravel()
     cvertices.sort()
 
-    union = join_complexes(*[cube_with_strides_center((0,0,1), strides),
-                             cube_with_strides_center((0,1,0), strides),
-                             cube_with_strides_center((0,1,1), strides),
-                             cube_with_strides_center((1,0,0), strides),
-                             cube_with_strides_center((1,0,1), strides),
-                             cube_with_strides_center((1,1,0), strides),
-                             cube_with_strides_center((1,1,1), strides)])
-    c = cube_with_strides_center((0,0,0), strides)
-    m4 = np.array(list(c[4].difference(union[4])))
-    m3 = np.array(list(c[3].difference(union[3])))
-    m2 = np.array(list(c[2].difference(union[2])))
-
-    d4 = np.array([[_convert_stride3(v, strides, (4,2,1)) for v in m4[i]] for i in range(m4.shape[0])])
-    d4 = np.hstack([m4, d4])
+    d4, d3, d2 = _lips3d_tables(strides)
     ds4 = d4.shape[0]
-
-    d3 = np.array([[_convert_stride3(v, strides, (4,2,1)) for v in m3[i]] for i in range(m3.shape[0])])
-    d3 = np.hstack([m3, d3])
     ds3 = d3.shape[0]
-
-    d2 = np.array([[_convert_stride3(v, strides, (4,2,1)) for v in m2[i]] for i in range(m2.shape[0])])
-    d2 = np.hstack([m2, d2])
     ds2 = d2.shape[0]
 
     ss0, ss1, ss2 = strides[0], strides[1], strides[2]
     ss0d, ss1d, ss2d = dstrides[0], dstrides[1], dstrides[2]
 
-    nvox = (s0-1)*(s1-1)*(s2-1)
+    # Each simplex is uniquely associated with a voxel, hence the
+    # planes along the first axis may be processed separately; the
+    # contributions are then summed plane by plane, so that the
+    # result does not depend on the number of threads
 
-    D = np.zeros((8,8))
+    fmask = np.ascontiguousarray(fmask)
+    cvertices = np.ascontiguousarray(cvertices)
 
+    partial = np.zeros((s0, 4))
+    _run_slabs(_lips3d_work, (s1, s2, ss0, ss1, ss2, ss0d, ss1d, ss2d, 
+                              fmask, fpmask, fcoords, cvertices, d4, d3, d2, partial),
+               s0-1, nthreads)
     for i in range(s0-1):
-        for j in range(s1-1):
-            for k in range(s2-1):
+        l0 = l0 + partial[i,0]
+        l1 = l1 + partial[i,1]
+        l2 = l2 + partial[i,2]
+        l3 = l3 + partial[i,3]
 
-                pindex = i*ss0+j*ss1+k*ss2
-                index = i*ss0d+j*ss1d+k*ss2d
-                for r in range(8):
-                    rr = (index+cvertices[r]) % nvox
-                    mr = fmask[rr]
-                    for s in range(r+1):
-                        res = 0
-                        ss = (index+cvertices[s]) % nvox
-                        ms = fmask[ss]
-                        if mr * ms:
-                            for l in range(fcoords.shape[0]):
-                                res += fcoords[l,ss] * fcoords[l,rr]
-                            D[r,s] = res
-                            D[s,r] = res
-                        else:
-                            D[r,s] = 0
-                            D[s,r] = 0
+    l0 += mask.sum()
+    return np.array([l0, l1, l2, l3])
 
-                for l in range(ds4):
-                    v0 = pindex + d4[l,0]
-                    w0 = d4[l,4]
-                    m = fpmask[v0]
-                    if m:
-                        v1 = pindex + d4[l,1]
-                        v2 = pindex + d4[l,2]
-                        v3 = pindex + d4[l,3]
-                        w1 = d4[l,5]
-                        w2 = d4[l,6]
-                        w3 = d4[l,7]
-
-                        m = m * fpmask[v1] * fpmask[v2] * fpmask[v3]
-                        d = m * mu3_tet(D[w0,w0], D[w0,w1], D[w0,w2], 
-                                        D[w0,w3], D[w1,w1], D[w1,w2], 
-                                        D[w1,w3], D[w2,w2], D[w2,w3],
-                                        D[w3,w3])
-
-                        l3 = l3 + m * mu3_tet(D[w0,w0], D[w0,w1], D[w0,w2], 
-                                              D[w0,w3], D[w1,w1], D[w1,w2], 
-                                              D[w1,w3], D[w2,w2], D[w2,w3],
-                                              D[w3,w3])
-
-                        l2 = l2 - m * mu2_tet(D[w0,w0], D[w0,w1], D[w0,w2], 
-                                              D[w0,w3], D[w1,w1], D[w1,w2], 
-                                              D[w1,w3], D[w2,w2], D[w2,w3],
-                                              D[w3,w3])
-
-                        l1 = l1 + m * mu1_tet(D[w0,w0], D[w0,w1], D[w0,w2], 
-                                              D[w0,w3], D[w1,w1], D[w1,w2], 
-                                              D[w1,w3], D[w2,w2], D[w2,w3],
-                                              D[w3,w3])
+# Lipschitz-Killing curvatures from residuals, streaming over the
+# planes along the first axis. The inner products of the fields at
+# neighbouring voxels of the planes i and i+1 are accumulated into 19
+# tables of the size of a padded plane: 5 within plane i (offsets
+# (0,0), (0,1), (1,0), (1,1) and (1,-1) along the two last axes), 5
+# within plane i+1 and 9 between the planes (offset (dj,dk) in table
+# 10+3*(dj+1)+(dk+1)). Each product is thus computed once, instead of
+# once per cube including both voxels.
+
+cdef void _gram_within(DTYPE_float_t* Y, long n, long s1, long s2,
+                       DTYPE_float_t* T) nogil:
+    cdef long l, j, k, u, npl = s1*s2
+    cdef DTYPE_float_t* y
+    cdef double a
+
+    for u from 0 <= u < 5*npl:
+        T[u] = 0
+    for l from 0 <= l < n:
+        y = Y + l*npl
+        for j from 0 <= j < s1:
+            for k from 0 <= k < s2:
+                u = j*s2+k
+                a = y[u]
+                T[u] += a * y[u]
+                if k+1 < s2:
+                    T[npl+u] += a * y[u+1]
+                if j+1 < s1:
+                    T[2*npl+u] += a * y[u+s2]
+                    if k+1 < s2:
+                        T[3*npl+u] += a * y[u+s2+1]
+                    if k > 0:
+                        T[4*npl+u] += a * y[u+s2-1]
+
+cdef void _gram_cross(DTYPE_float_t* Y0, DTYPE_float_t* Y1, long n, long s1, long s2,
+                      DTYPE_float_t* T) nogil:
+    cdef long l, j, k, u, dj, dk, npl = s1*s2
+    cdef DTYPE_float_t *y0, *y1
+    cdef double a
+
+    for u from 0 <= u < 9*npl:
+        T[u] = 0
+    for l from 0 <= l < n:
+        y0 = Y0 + l*npl
+        y1 = Y1 + l*npl
+        for j from 0 <= j < s1:
+            for k from 0 <= k < s2:
+                u = j*s2+k
+                a = y0[u]
+                for dj from -1 <= dj <= 1:
+                    if (j+dj < 0) or (j+dj >= s1):
+                        continue
+                    for dk from -1 <= dk <= 1:
+                        if (k+dk < 0) or (k+dk >= s2):
+                            continue
+                        T[(3*(dj+1)+dk+1)*npl+u] += a * y1[u+dj*s2+dk]
+
+cdef void _lips3d_resid_plane(long i, long s1, long s2, long ss0, DTYPE_float_t* T,
+                              DTYPE_int_t* ptab, DTYPE_int_t* fpmask, 
+                              DTYPE_int_t* d4, long ds4, DTYPE_int_t* d3, long ds3,
+                              DTYPE_int_t* d2, long ds2, DTYPE_float_t* out) nogil:
+    """
+    Contributions of the simplices of the voxels of plane i, written
+    in out[0:4], given the tables T of the planes i and i+1.
+    """
+    cdef long j, k, u, rs
+    cdef double D[64]
+
+    out[0] = 0; out[1] = 0; out[2] = 0; out[3] = 0
+    for j from 0 <= j < s1-1:
+        for k from 0 <= k < s2-1:
+            u = j*s2+k
+            for rs from 0 <= rs < 64:
+                D[rs] = T[ptab[rs]+u]
+            _lips3d_cube(D, i*ss0+u, fpmask, d4, ds4, d3, ds3, d2, ds2, out)
+
+def _resid_plane(resid, mask, long i, standardize):
+    """
+    Padded plane i of the residuals, set to zero outside the mask and
+    optionally divided by their norm at each voxel.
+    """
+    y = np.where(mask[i], resid[:,i], 0).astype(np.float)
+    if standardize:
+        norm = np.sqrt((y**2).sum(0))
+        norm[norm == 0] = 1
+        y /= norm
+    Y = np.zeros((resid.shape[0], mask.shape[1]+1, mask.shape[2]+1))
+    Y[:,:-1,:-1] = y
+    return Y
+
+def Lips3d_resid(resid, np.ndarray[DTYPE_int_t, ndim=3] mask, standardize=True):
+    """
+    Given a 3d mask and residuals, estimate the Lipschitz-Killing
+    curvatures of the masked region, with the metric induced by the
+    residual fields. This is Lips3d(u, mask), with u the
+    standardized residuals, but the residuals are read once, one plane
+    at a time along the first axis, and the inner products of
+    neighbouring voxels are computed once for all the cubes that
+    share them.
 
-                        l0 = l0 - m
+    Parameters:
+    -----------
 
-                for l in range(ds3):
-                    v0 = pindex + d3[l,0]
-                    w0 = d3[l,3]
-                    m = fpmask[v0]
-                    if m:
-                        v1 = pindex + d3[l,1]
-                        v2 = pindex + d3[l,2]
-                        w1 = d3[l,4]
-                        w2 = d3[l,5]
+    resid : ndarray((*,i,j,k))
+         Residuals, one field per row of the first axis
 
-                        m = m * fpmask[v1] * fpmask[v2] 
-                        l2 = l2 + m * mu2_tri(D[w0,w0], D[w0,w1], D[w0,w2], 
-                                              D[w1,w1], D[w1,w2], D[w2,w2]) 
+    mask : ndarray((i,j,k), np.int)
+         Binary mask determining whether or not
+         a voxel is in the mask.
 
-                        l1 = l1 - m * mu1_tri(D[w0,w0], D[w0,w1], D[w0,w2], 
-                                              D[w1,w1], D[w1,w2], D[w2,w2]) 
+    standardize : bool
+         If True, the residuals are divided by their norm at each
+         voxel of the mask; otherwise they are used as the
+         coordinates of Lips3d.
 
-                        l0 = l0 + m
+    Outputs:
+    --------
 
-                for l in range(ds2):
-                    v0 = pindex + d2[l,0]
-                    w0 = d2[l,2]
-                    m = fpmask[v0]
-                    if m:
-                        v1 = pindex + d2[l,1]
-                        w1 = d2[l,3]
-                        m = m * fpmask[v1]
-                        l1 = l1 + m * mu1_edge(D[w0,w0], D[w0,w1], D[w1,w1])
+    mu : ndarray
+         Array of intrinsic volumes [mu0, mu1, mu2, mu3]
 
-                        l0 = l0 - m
+    Notes:
+    ------
+
+    Besides the residuals, the memory used is proportional to the
+    number of fields times the size of a plane.
+
+    """
+
+    if not set(np.unique(mask)).issubset([0,1]):
+      raise ValueError('mask should be filled with 0/1 values, but be of type np.int')
+
+    resid = np.asarray(resid)
+    if (mask.shape[0], mask.shape[1], mask.shape[2]) != resid.shape[1:]:
+        raise ValueError('shape of mask does not match residuals')
+
+    cdef np.ndarray[DTYPE_int_t, ndim=1] fpmask
+    cdef np.ndarray[DTYPE_int_t, ndim=3] pmask
+    cdef np.ndarray[DTYPE_int_t, ndim=2] d4
+    cdef np.ndarray[DTYPE_int_t, ndim=2] d3
+    cdef np.ndarray[DTYPE_int_t, ndim=2] d2
+    cdef np.ndarray[DTYPE_int_t, ndim=1] ptab
+    cdef np.ndarray[DTYPE_float_t, ndim=3] Y0
+    cdef np.ndarray[DTYPE_float_t, ndim=3] Y1
+    cdef np.ndarray[DTYPE_float_t, ndim=2] T
+    cdef np.ndarray[DTYPE_float_t, ndim=2] partial
+
+    cdef long i, n, s0, s1, s2, ss0, npl, ds4, ds3, ds2
+    cdef DTYPE_float_t *pT, *pY0, *pY1, *ppartial
+    cdef DTYPE_int_t *pptab, *pfpmask, *pd4, *pd3, *pd2
+    cdef double l0, l1, l2, l3
+
+    l0 = 0; l1 = 0; l2 = 0; l3 = 0
+
+    pmask = np.zeros((mask.shape[0]+1, mask.shape[1]+1, mask.shape[2]+1), np.int)
+    pmask[:-1,:-1,:-1] = mask
+
+    s0, s1, s2 = (pmask.shape[0], pmask.shape[1], pmask.shape[2])
+    fpmask = pmask.reshape((s0*s1*s2))
+    n = resid.shape[0]
+    npl = s1*s2
+
+    strides = np.empty((s0, s1, s2), np.bool).strides
+    ss0 = strides[0]
+    d4, d3, d2 = _lips3d_tables(strides)
+    ds4 = d4.shape[0]
+    ds3 = d3.shape[0]
+    ds2 = d2.shape[0]
+
+    # Position in the tables of the inner product of the vertices r
+    # and s of the cube of voxel (0,0) of a plane
+
+    within = {(0,0):0, (0,1):1, (1,0):2, (1,1):3, (1,-1):4}
+    ptab = np.zeros(64, np.int)
+    for r in range(8):
+        for s in range(8):
+            u = [r // 4, (r // 2) % 2, r % 2]
+            v = [s // 4, (s // 2) % 2, s % 2]
+            if u[0] == v[0]:
+                if (v[1]-u[1], v[2]-u[2]) not in within:
+                    u, v = v, u
+                t = 5*u[0] + within[(v[1]-u[1], v[2]-u[2])]
+            else:
+                if u[0] == 1:
+                    u, v = v, u
+                t = 10 + 3*(v[1]-u[1]+1) + v[2]-u[2]+1
+            ptab[8*r+s] = t*npl + u[1]*s2 + u[2]
+
+    T = np.zeros((19, npl))
+    partial = np.zeros((s0, 4))
+    pT = <DTYPE_float_t*>T.data
+    ppartial = <DTYPE_float_t*>partial.data
+    pptab = <DTYPE_int_t*>ptab.data
+    pfpmask = <DTYPE_int_t*>fpmask.data
+    pd4 = <DTYPE_int_t*>d4.data
+    pd3 = <DTYPE_int_t*>d3.data
+    pd2 = <DTYPE_int_t*>d2.data
+
+    Y0 = _resid_plane(resid, mask, 0, standardize)
+    pY0 = <DTYPE_float_t*>Y0.data
+    with nogil:
+        _gram_within(pY0, n, s1, s2, pT)
+
+    for i in range(s0-1):
+        if i < s0-2:
+            Y1 = _resid_plane(resid, mask, i+1, standardize)
+        else:
+            Y1 = np.zeros((n, s1, s2))
+        pY1 = <DTYPE_float_t*>Y1.data
+        with nogil:
+            _gram_within(pY1, n, s1, s2, pT+5*npl)
+            _gram_cross(pY0, pY1, n, s1, s2, pT+10*npl)
+            _lips3d_resid_plane(i, s1, s2, ss0, pT, pptab, pfpmask, 
+                                pd4, ds4, pd3, ds3, pd2, ds2, ppartial+4*i)
+        T[0:5] = T[5:10]
+        Y0 = Y1
+        pY0 = pY1
+
+    for i in range(s0-1):
+        l0 = l0 + partial[i,0]
+        l1 = l1 + partial[i,1]
+        l2 = l2 + partial[i,2]
+        l3 = l3 + partial[i,3]
 
     l0 += mask.sum()
     return np.array([l0, l1, l2, l3])
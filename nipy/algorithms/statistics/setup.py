@@ -6,7 +6,7 @@ def configuration(parent_package='',top_path=None):
     config = Configuration('statistics', parent_package, top_path)
 
     config.add_data_dir('tests')
-    config.add_extension('intvol', ['intvol.c'], include_dirs = [os.path.abspath(os.path.join(os.path.dirname(numpy.core.__file__), 'include'))])
+    config.add_extension('intvol', ['intvol.pyx'], include_dirs = [os.path.abspath(os.path.join(os.path.dirname(numpy.core.__file__), 'include'))])
 
     return config
 
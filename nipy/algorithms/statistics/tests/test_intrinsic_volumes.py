@@ -216,3 +216,25 @@ def test_slices():
 
 
 
+
+
+def test_threads():
+    # Slabs processed by several threads give the serial result
+    box1, box2, edge1, edge2 = nonintersecting_boxes((20,)*3)
+    d = np.random.standard_normal((10,20,20,20))
+    m = box1 + box2
+    yield assert_equal, intvol.EC3d(m, nthreads=3), intvol.EC3d(m)
+    yield assert_equal, intvol.Lips3d(d, m, nthreads=3), intvol.Lips3d(d, m)
+    yield assert_equal, intvol.Lips3d(d, m, nthreads=0), intvol.Lips3d(d, m)
+
+
+def test_lips3d_resid():
+    # Streaming over the planes gives the curvatures of Lips3d
+    box1, box2, edge1, edge2 = nonintersecting_boxes((20,)*3)
+    m = box1 + box2
+    r = np.random.standard_normal((10,20,20,20))
+    u = r / np.sqrt((r**2).sum(0))
+    yield assert_almost_equal, intvol.Lips3d_resid(r, m, standardize=False), intvol.Lips3d(r, m)
+    yield assert_almost_equal, intvol.Lips3d_resid(r, m), intvol.Lips3d(u, m)
+    c = np.indices((20,)*3).astype(np.float)
+    yield assert_almost_equal, intvol.Lips3d_resid(c, m, standardize=False), intvol.Lips3d(c, m)
@@ -79,6 +79,18 @@ cdef extern from "fff_blas.h":
                         double alpha,  fff_matrix * A,  fff_matrix * B, 
                         double beta, fff_matrix * C) 
 
+# Exports from fff_backend.h
+cdef extern from "fff_backend.h":
+
+    ctypedef struct fff_backend:
+        char* blas
+        char* lapack
+
+    fff_backend* fff_backend_get()
+    int fff_backend_get_num_threads()
+    int fff_backend_set_num_threads(int nthreads)
+
+
 
 # Initialize numpy
 fffpy_import_array()
@@ -87,6 +99,37 @@ import numpy as np
 
 # Binded routines
 
+## fff_backend.h
+def blas_backend():
+    """
+    Names of the libraries providing the BLAS and LAPACK routines.
+    blas, lapack = blas_backend()
+
+    'builtin' stands for the routines libcstat is linked with. The
+    library is searched when first needed, and may be chosen by
+    setting the FFF_BLAS environment variable to its path, or to
+    'builtin', before importing nipy.
+    """
+    cdef fff_backend* b
+    b = fff_backend_get()
+    return b.blas, b.lapack
+
+def blas_get_num_threads():
+    """
+    Number of threads of the BLAS library, 0 if unknown.
+    n = blas_get_num_threads()
+    """
+    return fff_backend_get_num_threads()
+
+def blas_set_num_threads(int n):
+    """
+    Set the number of threads of the BLAS library, if it can be
+    controlled.
+    ok = blas_set_num_threads(n)
+    """
+    return fff_backend_set_num_threads(n) == 0
+
+
 ## fff_vector.h 
 def vector_get(X, size_t i):
     """
@@ -83,6 +83,21 @@ def test_array_div():
     y = np.random.rand(d0, d1, d2, d3)-.5
     _test_array_div(x, y)
 
+def test_array_add_strided(): 
+    d0, d1, d2, d3 = random_shape(4)
+    x = (np.random.rand(d3, d2, d1, 2*d0)-.5).T[::2]
+    y = (np.random.rand(d0, d1, d2+1, d3)-.5)[:, :, 1:]
+    _test_array_add(x, y)
+    _test_array_sub(x, y)
+    _test_array_mul(x, y)
+
+def test_array_add_int(): 
+    d0, d1, d2, d3 = random_shape(4)
+    x = (100*np.random.rand(d0, d1, d2, d3)).astype('int16')
+    y = (100*np.random.rand(d3, d2, d1, d0)).astype('int16').T
+    _test_array_add(x, y)
+    _test_array_sub(x, y)
+
 
 if __name__ == "__main__":
     import nose
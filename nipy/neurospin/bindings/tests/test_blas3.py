@@ -180,6 +180,16 @@ def test_dsyr2k():
     assert_almost_equal(Lgold, L)
 
 
+def test_backend(): 
+    blas, lapack = fb.blas_backend()
+    assert isinstance(blas, str) and isinstance(lapack, str)
+    n = fb.blas_get_num_threads()
+    assert n >= 0
+    if n > 0 and fb.blas_set_num_threads(1): 
+        assert fb.blas_get_num_threads() == 1
+        fb.blas_set_num_threads(n)
+
+
 if __name__ == "__main__":
     import nose
     nose.run(argv=['', __file__])
@@ -228,6 +228,19 @@ def test_sum_via_iterators_uint8():
     _test_sum_via_iterators(Y)
     
 
+def test_cstat_profile():
+    fb.cstat_profile_reset()
+    fb.pass_vector(np.random.rand(10))
+    P = fb.cstat_profile(reset=True)
+    assert_equal(sorted(P['calls'].keys()), sorted(fb.profile_timers))
+    if fb.cstat_profile_enabled():
+        assert P['allocations'] >= 1
+    else: 
+        assert_equal(P['allocations'], 0)
+    P = fb.cstat_profile()
+    assert_equal(P['allocations'], 0)
+    
+
 if __name__ == "__main__":
     import nose
     nose.run(argv=['', __file__])
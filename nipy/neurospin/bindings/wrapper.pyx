@@ -208,3 +208,49 @@ def sum_via_iterators(ndarray Y, int axis=0):
     return Z.squeeze()
 
 
+
+
+profile_timers = ['joint_hist', 'onesample_stat', 'glm_kalman', 'gmm', 'dijkstra']
+profile_counters = ['voxels', 'em_iterations', 'relaxations', 'allocations']
+
+def cstat_profile_enabled(): 
+    """
+    flag = cstat_profile_enabled()
+
+    True if libcstat was compiled with the instrumentation layer
+    (define FFF_PROFILE, or set NIPY_PROFILE when building), False
+    otherwise, in which case the counters remain zero.
+    """
+    return bool(fff_profile_enabled())
+
+
+def cstat_profile(reset=False): 
+    """
+    P = cstat_profile(reset=False)
+
+    Read the libcstat instrumentation counters, which are shared by
+    all the nipy.neurospin extension modules. Return a dictionary with
+    a 'calls' and 'seconds' dictionary, keyed by the names in
+    profile_timers, and one entry per name in profile_counters. If
+    reset is True, the counters are reset to zero after reading.
+    """
+    cdef fff_profile* p = fff_profile_get()
+    cdef int i
+    P = {'calls': {}, 'seconds': {}}
+    for i in range(FFF_PROFILE_NTIMERS): 
+        P['calls'][profile_timers[i]] = p.calls[i]
+        P['seconds'][profile_timers[i]] = p.seconds[i]
+    for i in range(FFF_PROFILE_NCOUNTERS): 
+        P[profile_counters[i]] = p.count[i]
+    if reset: 
+        fff_profile_reset()
+    return P
+
+
+def cstat_profile_reset(): 
+    """
+    cstat_profile_reset()
+
+    Reset the libcstat instrumentation counters to zero. 
+    """
+    fff_profile_reset()
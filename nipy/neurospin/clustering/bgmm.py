@@ -1322,7 +1322,8 @@ class BGMM_old(GMM):
 
         return Li
 
-    def Gibbs_estimate(self,x,niter = 1000,method = 1):
+    def Gibbs_estimate(self,x,niter = 1000,method = 1, nchains=1, seed=1,
+                       nthreads=1):
         """
         Estimation of the BGMM using Gibbs sampling
         
@@ -1333,6 +1334,11 @@ class BGMM_old(GMM):
         method = 1: boolean to state whether covariance
                are fixed (0 ; normal model) or variable 
                (1 ; normal-wishart model)
+        nchains=1: number of independent chains, 
+                   whose estimates are averaged
+        seed=1: seed of the random draws
+        nthreads=1: number of threads the chains run on
+                    (all processors if 0)
 
         Returns
         -------
@@ -1341,7 +1347,8 @@ class BGMM_old(GMM):
         x = self.check_data(x)
         label, mean, meansc, prec, we,dof,Li = fc.gibbs_gmm (x,\
                self.prior_means, self.prior_precisions, self.prior_shrinkage,
-               self.prior_weights, self.prior_dof, niter, method)
+               self.prior_weights, self.prior_dof, niter, method, x, 0,
+               nchains, seed, nthreads)
         self.estimated = 1
         self.means = mean
         self.shrinkage = meansc
@@ -1352,7 +1359,8 @@ class BGMM_old(GMM):
         return label
         
     def Gibbs_estimate_and_sample(self, x, niter = 1000, method = 1, 
-                                        gd = None, nsamp = 1000, verbose=0):
+                                        gd = None, nsamp = 1000, verbose=0,
+                                        nchains=1, seed=1, nthreads=1):
         """
         Estimation of the BGMM using Gibbs sampling
         and sampling of the posterior on test points
@@ -1369,6 +1377,11 @@ class BGMM_old(GMM):
            if gd==None, x is used as Grid
         nsamp = 1000 number of draws of the posterior
         verbose = 0: the verboseity level
+        nchains=1: number of independent chains, 
+                   whose estimates are averaged
+        seed=1: seed of the random draws
+        nthreads=1: number of threads the chains run on
+                    (all processors if 0)
         
         Returns
         -------
@@ -1383,7 +1396,8 @@ class BGMM_old(GMM):
             
         label, mean, meansc, prec, we,dof,Li = fc.gibbs_gmm (x, \
                self.prior_means, self.prior_precisions, self.prior_shrinkage,
-               self.prior_weights, self.prior_dof, niter, method, grid, nsamp)
+               self.prior_weights, self.prior_dof, niter, method, grid, nsamp,
+               nchains, seed, nthreads)
         self.estimated = 1
         self.means = mean
         self.shrinkage = meansc
@@ -13,6 +13,7 @@ Author : Bertrand Thirion, 2008
 
 import numpy as np
 from nipy.neurospin.clustering.hierarchical_clustering import ward_simple
+from nipy.neurospin.clustering.clustering import ward_bootstrap
 from numpy.random import random_integers
 
 # -------------------------------------------------------------------
@@ -66,7 +67,7 @@ def _bootstrap_cols(x, p=-1):
     return y
 
 
-def ward_msb(X, niter=1000):
+def ward_msb(X, niter=1000, seed=None, nthreads=1):
     """
     multi-scale bootstrap procedure
     
@@ -77,6 +78,12 @@ def ward_msb(X, niter=1000):
       p is their dimensions
     niter=1000
         number of iterations of the bootstrap
+    seed=None
+        seed of the bootstrap draws; by default, it is drawn
+        from numpy's random generator
+    nthreads=1
+        number of threads the bootstrap replicates run on
+        (0 for all processors); the results do not depend on it
     
     Returns
     -------
@@ -92,20 +99,15 @@ def ward_msb(X, niter=1000):
     n = X.shape[0]
     d = X.shape[1]
     t = ward_simple(X)
-    l = t.list_of_subtrees()
 
     db = (d*np.exp((np.arange(7)-3)*np.log(1.1))).astype(np.int)
-    pval = np.zeros((len(l),len(db)))
-
-    # get the bootstrap samples
-    for j in range(len(db)):
-        for i in range(niter):
-            # nb : spends 95% of the time in ward algo
-            # when n=100,d=30
-            x = _bootstrap_cols(X,db[j])
-            t = ward_simple(x)
-            laux = t.list_of_subtrees()
-            pval[:,j] += _compare_list_of_arrays(l, laux)
+    if seed is None:
+        seed = int(random_integers(0, 2**31-1))
+
+    # get the bootstrap samples:
+    # the replicates are clustered and compared to t in C
+    pval = ward_bootstrap(np.asarray(X, np.float), t.parents, db, niter,
+                          seed, nthreads)
 
     # collect the empirical pval for different boostrap sizes
     pval = pval/niter
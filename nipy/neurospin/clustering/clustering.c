@@ -26,6 +26,40 @@ associated with the hierrachical clustering \n\
 that represents the cost value associated with each cluster\n\
 (the first n values are zero)";
 
+static char ward_graph_doc[]=
+" parent,cost = ward_graph(A,B,D,X) \n\
+connectivity-constrained ward clustering algorithm\n\
+INPUT:\n\
+- A,B,D the edges origins, ends and weights of a graph\n\
+that defines the allowed merges\n\
+- X data array with shape(n,p)\n\
+OUPUT:\n\
+- parent: array of shape (2*n-c), c being the number\n\
+of connected components of the graph,\n\
+that represents the forest structure \n\
+associated with the hierrachical clustering \n\
+- cost: array of shape (2*n-c)\n\
+that represents the cost value associated with each cluster\n\
+(the first n values are zero)";
+
+static char ward_bootstrap_doc[]=
+" hits = ward_bootstrap(X,parent,sizes,niter,seed=1,nthreads=1) \n\
+multi-scale bootstrap of ward clustering\n\
+INPUT:\n\
+- X data array with shape(n,p)\n\
+- parent: array of shape (2*n-1), the reference tree of X,\n\
+with parent[i]>i for each non-root node, as given by ward\n\
+- sizes: array of shape (m), the numbers of columns \n\
+of X drawn with replacement in the replicates\n\
+- niter (int) the number of replicates per size\n\
+- seed = 1 is the seed of the random draws \n\
+- nthreads = 1 is the number of threads the replicates run on \n\
+(0 for all processors) ; the result does not depend on it \n\
+OUPUT:\n\
+- hits: array of shape (n-1,m), hits[i,j] being the number of \n\
+replicates of size sizes[j] whose tree contains the subtree \n\
+rooted on node n+i of the reference tree";
+
 static char cmeans_doc[] =
 " Centers, Labels, J = cmeans(X,nbclusters,Labels,maxiter,delta)\n\
   cmeans clustering algorithm \n\
@@ -117,7 +151,7 @@ best matching data, given the template\n\
 */
 static char gmm_doc[] = 
   
-" Centers, Precision, Weights, Labels, LogLike = gmm(X,nbclusters,Labels,prec_type,maxiter,delta)\n\
+" Centers, Precision, Weights, Labels, LogLike = gmm(X,nbclusters,Labels,prec_type,maxiter,delta,chunksize,verbose,nthreads)\n\
   Gaussian Mixture Model (GMM) clustering algorithm \n\
  INPUT :\n\
  -	A data array X, supposed to be written as (n*p)\n\
@@ -134,6 +168,10 @@ static char gmm_doc[] =
    of iterations  before convergence\n\
  - delta(double, =0.0001 by default), \n\
   the relative increment in the results before declaring convergence\n\
+ - chunksize(int), the number of items used for estimation \n\
+ - verbose(int, =0 by default), verbosity mode \n\
+ - nthreads(int, =1 by default), the number of threads used \n\
+   for heteroscedastic models (all processors if <=0) \n\
  OUPUT :\n\
  - Centers: array of size nbclusters*p, the centroids of \n\
   the resulting clusters\n\
@@ -144,7 +182,7 @@ static char gmm_doc[] =
 
 static char gmm_relax_doc[] = 
   
-" Centers, Precision, Weights, Labels, LogLike = gmm_relax(X,Centers, Precision, Weights,maxiter,delta)\n\
+" Centers, Precision, Weights, Labels, LogLike = gmm_relax(X,Centers, Precision, Weights,maxiter,delta,nthreads)\n\
   Relaxing of the  GMM on the dataset X\n\
  INPUT :\n\
  -	A data array X, supposed to be written as (n*p)\n\
@@ -157,6 +195,7 @@ static char gmm_relax_doc[] =
    of iterations  before convergence\n\
  - delta(double, =0.0001 by default), \n\
   the relative increment in the results before declaring convergence\n\
+ - nthreads(int, =1 by default), the number of threads, see gmm \n\
  OUPUT :\n\
  - Centers: array of size nbclusters*p, the centroids of \n\
   the resulting clusters\n\
@@ -166,7 +205,7 @@ static char gmm_relax_doc[] =
  - LogLike : array of size n, the Log-Likelihood of the data for the GMM model";
 
 static char gmm_partition_doc[] = 
-" LogLike, Labels = gmm_partition(X,Centers,Precision, Weights)\n\
+" LogLike, Labels = gmm_partition(X,Centers,Precision, Weights,nthreads)\n\
   Fits Gaussian Mixture Model (GMM) to the data X \n\
  INPUT :\n\
  -	A data array X, supposed to be written as (n*p)\n\
@@ -175,11 +214,48 @@ static char gmm_partition_doc[] =
   the clusters\n\
  - Precision: array of size nbclusters*p, the precision of \n\
   the  clusters\n\
+ - nthreads(int, =1 by default), the number of threads, see gmm \n\
  OUPUT :\n\
  - Labels : arroy of size n, the discrete labels of the input items\n\
  - LogLike : array of size n, the log-likelihood of the items \n\
 	with respect to the model.";
 
+static char gmm_stats_doc[] = 
+" W, M, S, LogLike = gmm_stats(X, Centers, Precision, Weights, W, M, S, step, nthreads)\n\
+  Stepwise update of the sufficient statistics of a GMM with a chunk of data\n\
+  (E-step of a mini-batch EM algorithm)\n\
+ INPUT :\n\
+ -	A data array X, supposed to be written as (n*p)\n\
+	where n = number of features in the chunk, p =number of dimensions\n\
+ - Centers: array of size nbclusters*p, the centroids of \n\
+  the clusters\n\
+ - Precision: the precision matrices of the clusters, \n\
+   of size nbclusters*(p*p) or nbclusters*p\n\
+ - Weights: the weight of the mixture \n\
+ - W, M, S: the current statistics, i.e. the running averages of \n\
+  the responsibilities, of the first-order and of the second-order moments,\n\
+  with the shapes of Weights, Centers and Precision\n\
+ - step(double, =1 by default): the statistics become \n\
+   (1-step)*(W,M,S) + step*(statistics of X)\n\
+ - nthreads(int, =1 by default), the number of threads, see gmm \n\
+ OUPUT :\n\
+ - W, M, S: the updated statistics \n\
+ - LogLike : (scalar)average Log-Likelihood of X for the GMM model";
+
+static char gmm_stats_model_doc[] = 
+" Centers, Precision, Weights = gmm_stats_model(W, M, S, Centers, Precision)\n\
+  GMM parameters from the sufficient statistics computed by gmm_stats\n\
+  (M-step of a mini-batch EM algorithm)\n\
+ INPUT :\n\
+ - W, M, S: the statistics \n\
+ - Centers, Precision: the current parameters, that are kept \n\
+   for components with no responsibility\n\
+ OUPUT :\n\
+ - Centers: array of size nbclusters*p, the centroids of \n\
+  the clusters\n\
+ - Precision: the precision matrices of the clusters\n\
+ - Weights: the weight of the mixture";
+
 static char gmm_membership_doc[] = 
 " a,b,d = gmm_membserhsip(X,Centers,Precision, Weights)\n\
   Gets membership of X with respect to the GMM \n\
@@ -261,7 +337,7 @@ the posterior  degrees of freedom  of the precisions.\n\
  - density : Density of the data on the sampling grid.";
 
 static char gibbs_gmm_doc[] = 
-" membership, mean, mean_scale, precision_scale, weights,dof,density = gibbs_gmm(X,prior_centers,prior_precision, prior_mean_scale, prior_weights, prior_dof, niter=1000,method=1,grid = None,nsamplings = 1)\n\
+" membership, mean, mean_scale, precision_scale, weights,dof,density = gibbs_gmm(X,prior_centers,prior_precision, prior_mean_scale, prior_weights, prior_dof, niter=1000,method=1,grid = None,nsamplings = 1, nchains=1, seed=1, nthreads=1)\n\
   MCMC Bayesian Gaussian Mixture Model (GMM) clustering algorithm \n\
 This is a based on a conjugate Wishart-Normal prior model. \n\
 Moreover, covariance/precision matrices are restricted to be diagonal \n\
@@ -284,6 +360,11 @@ Moreover, covariance/precision matrices are restricted to be diagonal \n\
  - grid = None is a sampling for the posterior \n\
    by default grid = X \n\
  - nsamples = 1 is the number of samplings for averaging the posterior \n\
+ - nchains = 1 is the number of independent chains, whose components \n\
+   are matched with those of the first chain before averaging \n\
+ - seed = 1 is the seed of the random draws \n\
+ - nthreads = 1 is the number of threads the chains run on \n\
+   (all processors if zero or negative) \n\
  OUPUT :\n\
  - membership: array of size n*nbclusters, \n\
 the relative probabilities of the membership \n\
@@ -385,6 +466,88 @@ static PyObject* ward(PyObject* self, PyObject* args)
 	return ret;
 }
 
+static PyObject* ward_graph(PyObject* self, PyObject* args)
+{
+  PyArrayObject *a, *b, *d, *x, *cost, *parent ;
+  long n,q,i;
+
+  int OK = PyArg_ParseTuple( args, "O!O!O!O!:ward_graph", 
+			     &PyArray_Type, &a,
+			     &PyArray_Type, &b,
+			     &PyArray_Type, &d,
+			     &PyArray_Type, &x);
+  if (!OK) return NULL;
+  
+  /* prepare C arguments */ 
+  fff_array* A = fff_array_fromPyArray( a ); 
+  fff_array* B = fff_array_fromPyArray( b );
+  fff_vector* D = fff_vector_fromPyArray( d );
+  fff_matrix* X = fff_matrix_fromPyArray( x );
+  n = X->size1;
+  fff_graph *G = fff_graph_build_safe(n,A->dimX,A,B,D);
+  fff_array_delete(A);
+  fff_array_delete(B);
+  fff_vector_delete(D);
+  
+  fff_array *Parent = fff_array_new1d(FFF_LONG,2*n-1);
+  fff_vector *Cost = fff_vector_new(2*n-1);
+  fff_vector_set_all(Cost,0);
+  
+  q = n + fff_clustering_ward_graph(Parent,Cost,G,X);
+  fff_graph_delete(G);
+  fff_matrix_delete(X);
+
+  /* keep the q first nodes */
+  fff_array *P = fff_array_new1d(FFF_LONG,q);
+  fff_vector *C = fff_vector_new(q);
+  for (i=0 ; i<q ; i++){
+    fff_array_set1d(P,i,fff_array_get1d(Parent,i));
+    fff_vector_set(C,i,fff_vector_get(Cost,i));
+  }
+  fff_array_delete(Parent);
+  fff_vector_delete(Cost);
+  
+  /* get the results as python arrrays */
+  cost = fff_vector_toPyArray( C ); 
+  parent = fff_array_toPyArray( P );
+
+  /* Output tuple */ 
+  PyObject *ret = Py_BuildValue("NN",parent,cost);
+  return ret;
+}
+
+static PyObject* ward_bootstrap(PyObject* self, PyObject* args)
+{
+  PyArrayObject *x, *parent, *sizes, *hits;
+  int niter;
+  unsigned long seed = 1;
+  int nthreads = 1;
+
+  int OK = PyArg_ParseTuple( args, "O!O!O!i|ki:ward_bootstrap", 
+			     &PyArray_Type, &x,
+			     &PyArray_Type, &parent,
+			     &PyArray_Type, &sizes,
+			     &niter,
+			     &seed,
+			     &nthreads);
+  if (!OK) return NULL;
+  
+  /* prepare C arguments */ 
+  fff_matrix* X = fff_matrix_fromPyArray( x );
+  fff_array* Parent = fff_array_fromPyArray( parent );
+  fff_array* Sizes = fff_array_fromPyArray( sizes );
+  fff_matrix* Hits = fff_matrix_new(X->size1-1, Sizes->dimX);
+
+  fff_clustering_ward_bootstrap(Hits, Parent, X, Sizes, niter, seed, nthreads);
+  fff_matrix_delete(X);
+  fff_array_delete(Parent);
+  fff_array_delete(Sizes);
+
+  /* get the results as python arrrays */
+  hits = fff_matrix_toPyArray( Hits );
+  return Py_BuildValue("N", hits);
+}
+
 static PyObject* cmeans(PyObject* self, PyObject* args)
 {
   PyArrayObject *x, *centers, *labels ;
@@ -599,8 +762,9 @@ static PyObject* gmm(PyObject* self, PyObject* args)
   fff_array* Label;
   labels = NULL;
   int verbose = 0;
+  int nthreads = 1;
   
-  int OK = PyArg_ParseTuple( args, "O!i|O!iidii:gmm", 
+  int OK = PyArg_ParseTuple( args, "O!i|O!iidiii:gmm", 
 							 &PyArray_Type, &x, 
 							 &nbclusters,
 							 &PyArray_Type, &labels, 
@@ -608,7 +772,8 @@ static PyObject* gmm(PyObject* self, PyObject* args)
 							 &maxiter, 
 							 &delta,
 							 &chunksize,
-							 &verbose
+							 &verbose,
+							 &nthreads
 							 ); 
   if (!OK) Py_RETURN_NONE; 
   
@@ -648,7 +813,7 @@ static PyObject* gmm(PyObject* self, PyObject* args)
   
   double J = 0;
   
-  J = fff_clustering_gmm( Centers, Precision, Weights, Label, X, maxiter, delta, chunksize, verbose );
+  J = fff_clustering_gmm( Centers, Precision, Weights, Label, X, maxiter, delta, chunksize, verbose, nthreads );
 
   fff_matrix_delete(X);
   centers = fff_matrix_toPyArray( Centers ); 
@@ -666,16 +831,18 @@ static PyObject* gmm_relax(PyObject* self, PyObject* args)
 
   int maxiter = 300;
   double delta = 0.0001;
+  int nthreads = 1;
   fff_array* Label;
   labels = NULL;
   
-  int OK = PyArg_ParseTuple( args, "O!O!O!O!|id:gmm", 
+  int OK = PyArg_ParseTuple( args, "O!O!O!O!|idi:gmm", 
 							 &PyArray_Type, &x, 
 							 &PyArray_Type, &centers, 
 							 &PyArray_Type, &precision, 
 							 &PyArray_Type, &weights, 
 							 &maxiter, 
-							 &delta
+							 &delta,
+							 &nthreads
 							 ); 
   if (!OK) Py_RETURN_NONE; 
   
@@ -687,7 +854,7 @@ static PyObject* gmm_relax(PyObject* self, PyObject* args)
   Label = fff_array_new1d(FFF_LONG, X->size1 );
   fff_vector * LogLike = fff_vector_new( X->size1 ); 
   
-  fff_gmm_relax( LogLike, Label, Centers, Precision, Weights, X, maxiter, delta);
+  fff_gmm_relax( LogLike, Label, Centers, Precision, Weights, X, maxiter, delta, nthreads);
 
   fff_matrix_delete(X);
   centers = fff_matrix_toPyArray( Centers ); 
@@ -707,12 +874,14 @@ static PyObject* gmm_partition(PyObject* self, PyObject* args)
 
   fff_array* Label;
   fff_vector *LogLike;
+  int nthreads = 1;
   
-  int OK = PyArg_ParseTuple( args, "O!O!O!O!:gmm_partition", 
+  int OK = PyArg_ParseTuple( args, "O!O!O!O!|i:gmm_partition", 
 			  &PyArray_Type, &x, 
 			  &PyArray_Type, &centers, 
 			  &PyArray_Type, &precision, 
-			  &PyArray_Type, &weights ); 
+			  &PyArray_Type, &weights,
+			  &nthreads ); 
     if (!OK) Py_RETURN_NONE; 
 
   fff_matrix* X = fff_matrix_fromPyArray( x ); 
@@ -723,7 +892,7 @@ static PyObject* gmm_partition(PyObject* self, PyObject* args)
   Label = fff_array_new1d(FFF_LONG, X->size1 );
   LogLike = fff_vector_new( X->size1);
 
-  fff_gmm_partition( LogLike, Label, X, Centers, Precision, Weights);
+  fff_gmm_partition( LogLike, Label, X, Centers, Precision, Weights, nthreads);
   fff_matrix_delete(X);
   fff_matrix_delete(Centers);
   fff_matrix_delete(Precision);
@@ -738,6 +907,97 @@ static PyObject* gmm_partition(PyObject* self, PyObject* args)
   return ret;
 }
 
+static PyObject* gmm_stats(PyObject* self, PyObject* args)
+{
+  PyArrayObject *x, *centers, *precision, *weights, *w, *m, *s ;
+  double step = 1;
+  int nthreads = 1;
+  
+  int OK = PyArg_ParseTuple( args, "O!O!O!O!O!O!O!|di:gmm_stats", 
+			  &PyArray_Type, &x, 
+			  &PyArray_Type, &centers, 
+			  &PyArray_Type, &precision, 
+			  &PyArray_Type, &weights,
+			  &PyArray_Type, &w, 
+			  &PyArray_Type, &m, 
+			  &PyArray_Type, &s,
+			  &step,
+			  &nthreads ); 
+    if (!OK) Py_RETURN_NONE; 
+
+  fff_matrix* X = fff_matrix_fromPyArray( x ); 
+  fff_matrix* Centers = fff_matrix_fromPyArray( centers );
+  fff_matrix* Precision = fff_matrix_fromPyArray( precision ); 
+  fff_vector* Weights = fff_vector_fromPyArray( weights );
+
+  /* copy the statistics so that the input arrays are not modified */
+  fff_vector* aux = fff_vector_fromPyArray( w );
+  fff_vector* W = fff_vector_new( aux->size );
+  fff_vector_memcpy( W, aux );
+  fff_vector_delete( aux );
+  fff_matrix* auxm = fff_matrix_fromPyArray( m );
+  fff_matrix* M = fff_matrix_new( auxm->size1, auxm->size2 );
+  fff_matrix_memcpy( M, auxm );
+  fff_matrix_delete( auxm );
+  auxm = fff_matrix_fromPyArray( s );
+  fff_matrix* S = fff_matrix_new( auxm->size1, auxm->size2 );
+  fff_matrix_memcpy( S, auxm );
+  fff_matrix_delete( auxm );
+
+  double L = fff_gmm_stats_update( W, M, S, X, Centers, Precision, Weights, step, nthreads);
+  fff_matrix_delete(X);
+  fff_matrix_delete(Centers);
+  fff_matrix_delete(Precision);
+  fff_vector_delete(Weights);
+  
+  w = fff_vector_toPyArray( W ); 
+  m = fff_matrix_toPyArray( M ); 
+  s = fff_matrix_toPyArray( S ); 
+
+  PyObject *ret = Py_BuildValue("NNNd",w, m, s, L);
+   
+  return ret;
+}
+
+static PyObject* gmm_stats_model(PyObject* self, PyObject* args)
+{
+  PyArrayObject *centers, *precision, *weights, *w, *m, *s ;
+  
+  int OK = PyArg_ParseTuple( args, "O!O!O!O!O!:gmm_stats_model", 
+			  &PyArray_Type, &w, 
+			  &PyArray_Type, &m, 
+			  &PyArray_Type, &s,
+			  &PyArray_Type, &centers, 
+			  &PyArray_Type, &precision ); 
+    if (!OK) Py_RETURN_NONE; 
+
+  fff_vector* W = fff_vector_fromPyArray( w ); 
+  fff_matrix* M = fff_matrix_fromPyArray( m ); 
+  fff_matrix* S = fff_matrix_fromPyArray( s ); 
+  fff_matrix* aux = fff_matrix_fromPyArray( centers );
+  fff_matrix* Centers = fff_matrix_new( aux->size1, aux->size2 );
+  fff_matrix_memcpy( Centers, aux );
+  fff_matrix_delete( aux );
+  aux = fff_matrix_fromPyArray( precision );
+  fff_matrix* Precision = fff_matrix_new( aux->size1, aux->size2 );
+  fff_matrix_memcpy( Precision, aux );
+  fff_matrix_delete( aux );
+  fff_vector* Weights = fff_vector_new( W->size );
+
+  fff_gmm_stats_model( Centers, Precision, Weights, W, M, S );
+  fff_vector_delete(W);
+  fff_matrix_delete(M);
+  fff_matrix_delete(S);
+  
+  centers = fff_matrix_toPyArray( Centers ); 
+  precision = fff_matrix_toPyArray( Precision ); 
+  weights = fff_vector_toPyArray( Weights ); 
+
+  PyObject *ret = Py_BuildValue("NNN",centers, precision, weights);
+   
+  return ret;
+}
+
 static PyObject* gmm_membership(PyObject* self, PyObject* args)
 {
   PyArrayObject *x, *centers, *a, *b, *d, *precision, *weights;
@@ -978,8 +1238,11 @@ static PyObject* gibbs_gmm(PyObject* self, PyObject* args)
   int method = 1;
   grid = NULL;
   int nsamplings = 0;
+  int nchains = 1;
+  unsigned long seed = 1;
+  int nthreads = 1;
   
-  int OK = PyArg_ParseTuple( args, "O!O!O!O!O!O!|iiO!i:gibbs_gmm", 
+  int OK = PyArg_ParseTuple( args, "O!O!O!O!O!O!|iiO!iiki:gibbs_gmm", 
 							 &PyArray_Type, &x, 
 							 &PyArray_Type, &prior_centers,
 							 &PyArray_Type, &prior_precision,
@@ -989,7 +1252,10 @@ static PyObject* gibbs_gmm(PyObject* self, PyObject* args)
 							 &niter,
 							 &method,
 							 &PyArray_Type, &grid,
-							 &nsamplings
+							 &nsamplings,
+							 &nchains,
+							 &seed,
+							 &nthreads
 							); 
   if (!OK) Py_RETURN_NONE; 
  
@@ -1016,10 +1282,6 @@ static PyObject* gibbs_gmm(PyObject* self, PyObject* args)
   
   fff_BGMM_set_priors(BG, PriorCenters, PriorMeanScale, PriorPrecision, PriorDof, PriorWeights);  
   
-  fff_BGMM_Gibbs_estimation(Membership,BG, X, niter,method);
-  
-  fff_BGMM_get_model( Mean, MeanScale,PrecisionScale, Dof, Weights, BG);
-  
   fff_matrix* Grid;
   if (grid==NULL){
 	Grid = X;
@@ -1028,8 +1290,11 @@ static PyObject* gibbs_gmm(PyObject* self, PyObject* args)
 	Grid = fff_matrix_fromPyArray( grid );
   }
   fff_vector *Density = fff_vector_new(Grid->size1);
-  if (nsamplings>0)
-	fff_BGMM_Gibbs_sampling(Density, BG, X,Grid, nsamplings,method);
+  fff_vector_set_all(Density,0);
+
+  fff_BGMM_Gibbs_chains(Membership, Density, BG, X, Grid, niter, nsamplings, method, nchains, seed, nthreads);
+  
+  fff_BGMM_get_model( Mean, MeanScale,PrecisionScale, Dof, Weights, BG);
   
   density = fff_vector_toPyArray( Density);
   
@@ -1277,6 +1542,14 @@ static PyMethodDef module_methods[] = {
    (PyCFunction)ward,      /* corresponding C function */
    METH_KEYWORDS,   /* ordinary (not keyword) arguments */
    ward_doc}, /* doc string */
+  {"ward_graph",
+   (PyCFunction)ward_graph,
+   METH_KEYWORDS,
+   ward_graph_doc},
+  {"ward_bootstrap",
+   (PyCFunction)ward_bootstrap,
+   METH_KEYWORDS,
+   ward_bootstrap_doc},
     {"cmeans",    /* name of func when called from Python */
    (PyCFunction)cmeans,      /* corresponding C function */
    METH_KEYWORDS,   /* ordinary (not keyword) arguments */
@@ -1297,6 +1570,14 @@ static PyMethodDef module_methods[] = {
    (PyCFunction)gmm_partition,
    METH_KEYWORDS,
    gmm_partition_doc},
+  {"gmm_stats",
+   (PyCFunction)gmm_stats,
+   METH_KEYWORDS,
+   gmm_stats_doc},
+  {"gmm_stats_model",
+   (PyCFunction)gmm_stats_model,
+   METH_KEYWORDS,
+   gmm_stats_model_doc},
   {"bayesian_gmm",
    (PyCFunction)bayesian_gmm,
    METH_KEYWORDS,
@@ -978,6 +978,73 @@ class GMM_old(GMM):
                 Labels = labels
         return Labels,bll, self.bic_from_all (bll,data.shape[0])
 
+    def estimate_stream(self, data, chunksize=10000, niter=5, kappa=0.6,
+                        nthreads=1, verbose=0):
+        """
+        Mini-batch (stepwise) EM estimation of the GMM, for datasets
+        that do not fit in memory
+
+        Parameters
+        ----------
+        data : (n*p) feature array, n = nb items, p=feature dimension,
+            e.g. a numpy.memmap; only chunksize items are loaded at once
+        chunksize=10000 : number of items per chunk
+        niter=5 : number of passes over the data
+        kappa=0.6 : decay of the step sizes (t+1)**(-kappa), where t
+            is the number of chunks processed so far;
+            kappa should be in (0.5,1]
+        nthreads=1 : number of threads of the E-step (all processors if <=0)
+        verbose=0 : verbosity mode
+
+        Returns
+        -------
+        LL : (float) average log-likelihood of the data
+            during the last pass
+
+        The model is initialized by a standard estimation on the first
+        chunk. Running averages of the sufficient statistics are
+        then updated chunk by chunk, and the parameters are
+        re-estimated after each chunk.
+        """
+        n = data.shape[0]
+        if (data.shape[1]!=self.dim):
+            raise ValueError, 'incorrect size for data'
+        if self.prec_type not in ['full','diag']:
+            raise ValueError, 'unknown precisions type'
+        self.estimate(np.asarray(data[:chunksize], np.double))
+        
+        if self.prec_type=='full':
+            P = np.reshape(self.precisions,(self.k,self.dim*self.dim))
+        else:
+            P = self.precisions
+        C = self.means
+        W = self.weights
+        sw = np.zeros(self.k)
+        sm = np.zeros((self.k,self.dim))
+        ss = np.zeros(P.shape)
+        t = 0
+        for i in range(niter):
+            ll = 0
+            for j in range(0,n,chunksize):
+                x = np.asarray(data[j:j+chunksize], np.double)
+                step = (t+1.)**(-kappa)
+                sw, sm, ss, llc = fc.gmm_stats(x, C, P, W, sw, sm, ss, step,
+                                              nthreads)
+                C, P, W = fc.gmm_stats_model(sw, sm, ss, C, P)
+                ll += llc*x.shape[0]
+                t += 1
+            ll /= n
+            if verbose:
+                print i, ll
+        
+        self.means = C
+        if self.prec_type=='full':
+            self.precisions = np.reshape(P,(self.k,self.dim,self.dim))
+        else:
+            self.precisions = P
+        self.weights = W
+        self.check()
+        return ll
 
     def partition(self,data):
         """
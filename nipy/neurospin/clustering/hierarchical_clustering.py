@@ -28,7 +28,7 @@ import nipy.neurospin.graph.graph as fg
 import nipy.neurospin.graph.forest as fo
 
 from nipy.neurospin.eda.dimension_reduction import Euclidian_distance
-from nipy.neurospin.clustering.clustering import ward
+from nipy.neurospin.clustering.clustering import ward, ward_graph
 
 class WeightedForest(fo.Forest):
     """
@@ -1220,6 +1220,9 @@ def ward(G, feature, verbose=0):
     ----
     When G has more than 1 connected component, t is no longer a tree.
     This case is handled cleanly now
+
+    The merges are computed in C, with candidate merges kept in a
+    heap keyed on the edges of G, in O(E log E) time.
     """
     # basic check
     if feature.ndim==1:
@@ -1229,61 +1232,18 @@ def ward(G, feature, verbose=0):
         raise ValueError, "Incompatible dimension for\
         the feature matrix and the graph"
     
-    Features = []
-    for i in range(G.V):
-        Features.append(np.reshape(feature[i],(1,feature.shape[1])))
-    
-    # prepare a graph with twice the number of vertices
-    # this graph will contain the connectivity information
-    # along the merges.
     n = G.V
-    nbcc = G.cc().max()+1
-    K = _auxiliary_graph(G,Features)
-
-    # prepare some variables that are useful tp speed up the algorithm 
-    parent = np.arange(2*n-nbcc).astype(np.int)
-    pop = np.ones(2*n-nbcc).astype(np.int)
-    height = np.zeros(2*n-nbcc)
-    linc = K.left_incidence()
-    rinc = K.right_incidence()
-
-    # iteratively merge clusters
-    for q in range(n-nbcc):
-        # 1. find the lightest edge
-        m = (K.weights).argmin()
-        cost = K.weights[m]
-        k = q+n
-        i = K.edges[m,0]
-        j = K.edges[m,1]
-        height[k] = cost
-        if verbose:
-            print q,i,j, m,cost
-        
-        # 2. remove the current edge
-        K.edges[m,:] = -1
-        K.weights[m] = np.infty
-        linc[i].remove(m)
-        rinc[j].remove(m)
-        
-        ml = linc[j]
-        if np.sum(K.edges[ml,1]==i)>0:
-            m = ml[np.flatnonzero(K.edges[ml,1]==i)]
-            K.edges[m,:] = -1
-            K.weights[m] = np.infty
-            linc[j].remove(m)
-            rinc[i].remove(m)
-        
-        # 3. merge the edges with third part edges
-        parent[i] = k
-        parent[j] = k
-        totalFeatures = np.vstack((Features[i],Features[j]))
-        Features.append(totalFeatures)
-        Features[i] = []
-        Features[j] = []
-        linc,rinc = _remap(K,i,j,k,Features,linc,rinc)
+    if G.E==0:
+        parent = np.arange(n)
+        height = np.zeros(n)
+    else:
+        parent, height = ward_graph(G.edges[:,0], G.edges[:,1],
+                                    G.weights, feature)
+    if verbose:
+        print n, "vertices", np.size(parent)-n, "merges"
 
     # build a tree to encode the results
-    t = WeightedForest(2*n-nbcc,parent,height)
+    t = WeightedForest(np.size(parent),parent,height)
     return t
 
 
@@ -8,7 +8,7 @@ import numpy as np
 from numpy.random import rand, permutation
 
 from nipy.neurospin.clustering.bootstrap_hc import _bootstrap_cols, \
-     _compare_list_of_arrays
+     _compare_list_of_arrays, ward_msb
 
 def test_bootstrap_cols():
     """ Unit test _bootstrap_cols.
@@ -27,6 +27,18 @@ def test_compare_list_of_arrays():
     assert np.all(_compare_list_of_arrays(a, b))
 
 
+def test_ward_msb():
+    """ Check that the bootstrap does not depend on the number of threads,
+    and that the root, which holds all the items, is always found.
+    """
+    X = rand(30, 10)
+    t, cpval, upval = ward_msb(X, niter=20, seed=3)
+    t, cpval2, upval2 = ward_msb(X, niter=20, seed=3, nthreads=4)
+    assert np.all(upval == upval2)
+    assert np.all(cpval == cpval2)
+    assert upval[-1] == 1
+
+
 if __name__ == '__main__':
     import nose
     nose.run(argv=['', __file__])
@@ -144,6 +144,29 @@ class TestGMM(TestCase):
             print expectC,mean
         self.assert_( np.allclose(expectC, mean,0.3,0.3))
 
+    def test_Gibbs_GMM_chains(self, verbose=0):
+        k = 2
+        dim = 2
+        prior_means = np.concatenate([np.zeros((1,dim)),np.ones((1,dim))])
+        prior_precision_scale =  1*np.ones((k,dim),'d')
+        prior_mean_scale = 1*np.ones(k,'d')
+        prior_weights = np.ones(k,'d')
+        prior_dof =  (dim+1)*np.ones(k,'d')
+        X = nr.randn(100,dim)-1
+        X[-30:] = X[-30:]+ 4
+        res1 = fc.gibbs_gmm(X, prior_means, prior_precision_scale,
+                            prior_mean_scale, prior_weights, prior_dof,
+                            500, 1, X, 100, 4, 3, 1)
+        res2 = fc.gibbs_gmm(X, prior_means, prior_precision_scale,
+                            prior_mean_scale, prior_weights, prior_dof,
+                            500, 1, X, 100, 4, 3, 2)
+        expectC = np.array([[-1,-1],[3,3]])
+        if verbose:
+            print expectC,res1[1]
+        self.assert_( np.allclose(expectC, res1[1],0.3,0.3))
+        for a, b in zip(res1, res2):
+            self.assert_( np.all(a==b))
+
 
 class TestTypeProof(TestCase):
 
@@ -375,3 +375,58 @@ def test_select_gmm_old_diag(verbose=0):
         
     assert_true(lgmm.k<5)
 
+
+
+def test_gmm_partition_threads():
+    # the blocked E-step should not depend on the number of threads,
+    # and samples far from all components should keep a finite
+    # log-likelihood
+    import nipy.neurospin.clustering.clustering as fc
+    nr.seed(1)
+    n, dim, k = 1000, 3, 2
+    x = np.concatenate((nr.randn(n,dim),3+nr.randn(n,dim)))
+    labels = np.repeat(np.arange(k),n)
+    C, P, W, L, ll = fc.gmm(x, k, labels, 0, 100, 1.e-6, 2*n, 0, 1)
+    C2, P2, W2, L2, ll2 = fc.gmm(x, k, labels, 0, 100, 1.e-6, 2*n, 0, 4)
+    assert_true(np.allclose(C, C2))
+    assert_true(np.allclose(P, P2))
+    assert_true(np.absolute(ll-ll2)<1.e-10)
+    y = np.concatenate((x, 100*np.ones((1,dim))))
+    L1, LL1 = fc.gmm_partition(y, C, P, W, 1)
+    L4, LL4 = fc.gmm_partition(y, C, P, W, 4)
+    assert_true((L1==L4).all())
+    assert_true(np.allclose(LL1, LL4))
+    # reference log-likelihood of the far sample (log-sum-exp)
+    lw = np.zeros(k)
+    for j in range(k):
+        Pj = np.reshape(P[j], (dim,dim))
+        yc = y[-1] - C[j]
+        lw[j] = np.log(W[j]) + 0.5*np.log(np.linalg.det(Pj)) \
+            - 0.5*np.dot(yc, np.dot(Pj, yc))
+    ref = lw.max() + np.log(np.exp(lw-lw.max()).sum()) - 0.5*dim*np.log(2*np.pi)
+    assert_true(np.absolute(LL1[-1]-ref)<1.e-6*np.absolute(ref))
+    assert_true(L1[-1]==lw.argmax())
+
+
+def test_em_gmm_stream():
+    # mini-batch EM on a memory-mapped dataset should get close
+    # to the batch estimate
+    import tempfile, os
+    nr.seed(2)
+    n, dim, k = 2000, 3, 2
+    x = np.concatenate((nr.randn(n,dim),5+nr.randn(n,dim)))
+    x = x[nr.permutation(2*n)]
+    fd, fname = tempfile.mkstemp()
+    os.close(fd)
+    xm = np.memmap(fname, dtype=np.double, mode='w+', shape=x.shape)
+    xm[:] = x
+    for prec_type in ['full','diag']:
+        bgmm = gmm.GMM_old(k,dim,prec_type)
+        Labels, bll, bic = bgmm.estimate(x, None, 300, 1.e-6)
+        sgmm = gmm.GMM_old(k,dim,prec_type)
+        sll = sgmm.estimate_stream(xm, chunksize=500, niter=5)
+        assert_true(np.absolute(sll-bll)<0.05)
+        assert_true(np.absolute(np.sort(sgmm.means[:,0])-
+                                np.sort(bgmm.means[:,0])).max()<0.1)
+    del xm
+    os.remove(fname)
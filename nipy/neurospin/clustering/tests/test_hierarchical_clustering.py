@@ -48,6 +48,18 @@ def ward_nograph_test_basic1(n=100,k=5):
     w = np.absolute(u-v)
     assert(np.sum(w*(1-w))==0)
 
+def ward_nograph_test_c(n=50):
+    """
+    Check that the C implementation builds the same tree
+    """
+    import nipy.neurospin.clustering.clustering as fc
+    np.random.seed(0)
+    x = np.random.randn(n,3)
+    t = ward_simple(x)
+    parent, cost = fc.ward(x)
+    assert (parent==t.parents).all()
+    assert np.allclose(cost, t.height)
+
 def alcd_test_basic():
     np.random.seed(0)
     x = np.random.randn(10,2)
@@ -135,6 +147,29 @@ def ward_test_basic(n=100,k=5):
     w = np.absolute(u-v)
     assert(np.sum(w*(1-w))==0)
 
+def ward_test_complete(n=30):
+    """ With a complete graph, the constrained and unconstrained
+    versions give the same tree
+    """
+    np.random.seed(0)
+    x = np.random.randn(n,2)
+    G = fg.WeightedGraph(n)
+    G.complete()
+    t = ward(G,x)
+    t0 = ward_simple(x)
+    assert (t.parents==t0.parents).all()
+    assert np.allclose(t.height,t0.height)
+
+def ward_test_components(n=40):
+    """ One tree per connected component
+    """
+    np.random.seed(0)
+    x = np.random.randn(n,2)
+    G = fg.WeightedGraph(n)
+    G.knn(x,3)
+    t = ward(G,x)
+    assert t.V == 2*n-(G.cc().max()+1)
+
 def wardq_test_basic(n=100,k=5):
     """ Basic check of ward's algorithm
     """
@@ -96,15 +96,23 @@ def infer_latent_dim(X, verbose=0, maxr=-1):
     -------
     r, int, the inferred dimension
     """
+    S = nl.svd(X, compute_uv=0)
+    return _infer_latent_dim_(S, X.shape[1], X.shape[0], verbose, maxr)
+
+def _infer_latent_dim_(S, dimf, n, verbose=0, maxr=-1):
+    """
+    r = _infer_latent_dim_(S, dimf, n, verbose=0, maxr=-1)
+    Same as infer_latent_dim, given the singular values S of 
+    the (n, dimf) data array
+    """
     if maxr ==-1:
-        maxr = np.minimum(X.shape[0],X.shape[1])
+        maxr = np.minimum(n, dimf)
         
-    U,S,V = nl.svd(X,0)
     if verbose>1:
         print "Singular Values", S
     L = []
     for k in range(maxr):
-        L.append(_linear_dim_criterion_(S,k,X.shape[1],X.shape[0])/X.shape[0])
+        L.append(_linear_dim_criterion_(S,k,dimf,n)/n)
 
     L = np.array(L)
     rank = np.argmax(L)
@@ -116,6 +124,48 @@ def infer_latent_dim(X, verbose=0, maxr=-1):
     return rank
 
 
+def randomized_svd(X, k, niter=2, oversampling=10):
+    """
+    U, S, Vt = randomized_svd(X, k, niter=2, oversampling=10)
+    Approximate the k largest singular values of X and the
+    corresponding singular vectors
+    
+    Parameters
+    ----------
+    X, array of shape (n, p)
+    k, int, number of components
+    niter=2, int, number of power iterations
+    oversampling=10, int, number of additional random directions
+    
+    Returns
+    -------
+    U, array of shape (n, k)
+    S, array of shape (k), the singular values in descending order
+    Vt, array of shape (k, p)
+    
+    Note
+    ----
+    The range of X is sampled by a few products of X with a random
+    (p, k+oversampling) matrix, and each power iteration sharpens the
+    spectrum by multiplying the sample by X X^T; only a small matrix
+    then needs to be decomposed. See Halko et al., SIAM Review, 2011.
+    The power iterations make the approximation accurate even when
+    the spectrum decays slowly.
+    """
+    n, p = X.shape
+    k = int(np.minimum(k, np.minimum(n, p)))
+    l = int(np.minimum(k+oversampling, np.minimum(n, p)))
+    Q, R = nl.qr(np.dot(X, nr.randn(p, l)))
+    # the samples are orthonormalized at each step
+    # so that the small singular values are not lost
+    for i in range(niter):
+        Z, R = nl.qr(np.dot(X.T, Q))
+        Q, R = nl.qr(np.dot(X, Z))
+    u, S, Vt = nl.svd(np.dot(Q.T, X), 0)
+    U = np.dot(Q, u[:, :k])
+    return U, S[:k], Vt[:k]
+
+
 def Euclidian_distance(X, Y=None):
     """
     Considering the rows of X (and Y=X) as vectors, compute the
@@ -227,7 +277,15 @@ def mds_parameters(dm, dim=1, verbose=0):
     rm1 = sqdm.mean(1)
     sqdm = (sqdm.T-rm1).T
 
-    U,S,V = nl.svd(sqdm,0)
+    if sqdm.shape[0]>sqdm.shape[1]:
+        # distances to a few landmarks (nystrom): only the small
+        # Gram matrix needs to be decomposed
+        S,V = nl.eigh(np.dot(sqdm.T,sqdm))
+        order = np.argsort(-S)
+        S = np.sqrt(np.maximum(S[order],0))
+        V = V[:,order].T
+    else:
+        U,S,V = nl.svd(sqdm,0)
     sqs = np.sqrt(S)
     embedding_direction = V.T [:,:dim]
     scaling = sqs[:dim]
@@ -301,7 +359,7 @@ def mds(dm, dim=1, verbose=0):
 
     return chart, embedding_direction, scaling, offset
 
-def isomap(G, dim=1, p=300, verbose=0):
+def isomap(G, dim=1, p=300, verbose=0, nthreads=1):
     """
     Isomapping of the data
     return the dim-dimensional ISOMAP chart that best represents the graph G
@@ -312,6 +370,7 @@ def isomap(G, dim=1, p=300, verbose=0):
     dim=1, int number of dimensions
     p=300, int nystrom reduction of the problem
     verbose = 0: verbosity level
+    nthreads=1, int, number of threads for the geodesic distances
     
     Returns
     -------
@@ -337,9 +396,9 @@ def isomap(G, dim=1, p=300, verbose=0):
     if p<n:
         toto = nr.rand(n)
         seed = toto.argsort()[:p]
-        dg = G.floyd(seed)
+        dg = G.floyd(seed, nthreads)
     else:
-        dg = G.floyd()
+        dg = G.floyd(None, nthreads)
         seed = np.arange(n)
     
     #print G.edges, G.weights, G.E
@@ -412,6 +471,89 @@ def Orthonormalize(M):
     M = np.dot(M,(nl.inv(C)).T)
     return M
 
+def _orthonormal_span_(S, AS, eps=1.e-10):
+    """
+    Q, AQ = _orthonormal_span_(S, AS, eps=1.e-10)
+    orthonormal basis Q of the span of the columns of S, and its image
+    AQ given the image AS of S by a linear operator; the directions
+    that are numerically dependent on the others are dropped
+    """
+    norm = np.sqrt(np.sum(S**2,0))
+    norm[norm==0] = 1
+    S = S/norm
+    AS = AS/norm
+    w,u = nl.eigh(np.dot(S.T,S))
+    keep = w>eps*w.max()
+    T = u[:,keep]/np.sqrt(w[keep])
+    return np.dot(S,T), np.dot(AS,T)
+
+def _rayleigh_ritz_(Q, AQ, k):
+    """
+    l, X, AX = _rayleigh_ritz_(Q, AQ, k)
+    k largest Ritz pairs of a symmetric operator in the span of the
+    orthonormal columns of Q, whose image is AQ
+    """
+    H = np.dot(Q.T,AQ)
+    l,C = nl.eigh(0.5*(H+H.T))
+    C = C[:,::-1][:,:k]
+    return l[::-1][:k], np.dot(Q,C), np.dot(AQ,C)
+
+def lobpcg(matvec, X, maxiter=1000, tol=1.e-7, verbose=0):
+    """
+    l, X = lobpcg(matvec, X, maxiter=1000, tol=1.e-7, verbose=0)
+    Largest eigenvalues and eigenvectors of a symmetric operator,
+    computed by the locally optimal block conjugate gradient method
+    (LOBPCG, Knyazev, 2001), without preconditioning
+    
+    Parameters
+    ----------
+    matvec, function that applies the operator to each column
+            of an array of shape (n, k)
+    X, array of shape (n, k), initial guess of the k eigenvectors
+    maxiter=1000, int, maximum number of iterations
+    tol=1.e-7, float, tolerance on the norm of the residuals,
+               relative to the largest eigenvalue
+    verbose=0, verbosity level
+    
+    Returns
+    -------
+    l, array of shape (k), the eigenvalues in descending order
+    X, array of shape (n, k), the corresponding eigenvectors
+    
+    Note
+    ----
+    Each iteration applies the operator once to k vectors, and only
+    needs the decomposition of a (3k, 3k) matrix, so that the operator
+    may be a sparse product on a large graph.
+    """
+    k = X.shape[1]
+    Q, AQ = _orthonormal_span_(X, matvec(X))
+    l, X, AX = _rayleigh_ritz_(Q, AQ, k)
+    P = None
+    for i in range(maxiter):
+        R = AX-X*l
+        rnorm = np.sqrt(np.sum(R**2,0)).max()
+        if rnorm<=tol*np.maximum(np.abs(l).max(),1.e-300):
+            break
+        # search in the span of the eigenvectors, the residuals
+        # and the previous displacement
+        if P is None:
+            S = np.hstack((X,R))
+            AS = np.hstack((AX,matvec(R)))
+        else:
+            S = np.hstack((X,R,P))
+            AS = np.hstack((AX,matvec(R),AP))
+        Q, AQ = _orthonormal_span_(S, AS)
+        l, Xn, AXn = _rayleigh_ritz_(Q, AQ, k)
+        C = np.dot(X.T,Xn)
+        P = Xn-np.dot(X,C)
+        AP = AXn-np.dot(AX,C)
+        X, AX = Xn, AXn
+
+    if verbose:
+        print i, rnorm
+    return l, X
+
 def local_sym_normalize(G):
     """
     graph symmetric normalization; moiover, the normalizing vector is returned
@@ -419,26 +561,24 @@ def local_sym_normalize(G):
     """
     LNorm = np.zeros(G.V)
     RNorm = np.zeros(G.V)
-    for e in range(G.E):
-        a = G.edges[e,0]
-        b = G.edges[e,1]
-        d = G.weights[e]
-        LNorm[a] = LNorm[a] + d
-        RNorm[b] = RNorm[b] + d
+    if G.E>0:
+        a = G.edges[:,0]
+        b = G.edges[:,1]
+        d = np.bincount(a,G.weights)
+        LNorm[:d.size] = d
+        d = np.bincount(b,G.weights)
+        RNorm[:d.size] = d
 
     LNorm[LNorm==0]=1
     RNorm[RNorm==0]=1
     
-    for e in range(G.E):
-        a = G.edges[e,0]
-        b = G.edges[e,1]
-        d = G.weights[e]/np.sqrt(LNorm[a]*RNorm[b])
-        G.weights[e]=d
+    if G.E>0:
+        G.weights[:] = G.weights/np.sqrt(LNorm[a]*RNorm[b])
     
     return LNorm,RNorm
 
 
-def LE(G, dim, verbose=0, maxiter=1000):
+def LE(G, dim, verbose=0, maxiter=1000, nthreads=1):
     """
     Laplacian Embedding of the data
     returns the dim-dimensional LE of the graph G
@@ -449,6 +589,7 @@ def LE(G, dim, verbose=0, maxiter=1000):
     dim=1, int, number of dimensions
     verbose=0, verbosity level
     maxiter=1000, int, maximum number of iterations of the algorithm 
+    nthreads=1, int, number of threads (all the processors if <=0)
     
     Returns
     -------
@@ -456,35 +597,28 @@ def LE(G, dim, verbose=0, maxiter=1000):
     
     Note
     ----
-    In fact the current implementation retruns
-    what is now referred to a diffusion map at time t=1
+    The leading eigenvectors of the normalized adjacency matrix are
+    computed by lobpcg, the matrix being applied by diffusion in the
+    graph, i.e. by a sparse product, so that no (G.V, G.V) matrix
+    is ever formed. Note that the weights of G are normalized.
     """
     n = G.V
     dim = np.minimum(dim,n)
-    chart = nr.randn(G.V,dim+2)
-    f = ff.Field(G.V,G.edges,G.weights,chart)
     LNorm,RNorm = local_sym_normalize(G)
     # note : normally Rnorm = Lnorm
     if verbose:
         print np.sqrt(np.sum((LNorm-RNorm)**2))/np.sum(LNorm)
     eps = 1.e-7
 
-    f1 = np.zeros((G.V,dim+2))
-    for i in range(maxiter):
-        f.diffusion(10)
-        f0 = Orthonormalize(f.field)
-        f.field = f0
-        if nl.norm(f1-f0)<eps:
-            break
-        else:
-            f1 = f0
-
-    if verbose:
-        print i,nl.norm(f1-f0)
-    f.diffusion()
-    f0 = f.field
+    f = ff.Field(G.V,G.edges,G.weights)
+    def matvec(x):
+        if f.E==0:
+            return np.zeros(np.shape(x))
+        f.field = x
+        f.diffusion(1,nthreads)
+        return f.field
+    S,U = lobpcg(matvec, nr.randn(G.V,dim+2), maxiter, eps, verbose)
     
-    U,S,V = nl.svd(f0,0)
     RNorm = np.reshape(np.sqrt(RNorm),(n,1))
     chart = S[:dim]*np.repeat(1./RNorm,dim,1)*U[:,1:dim+1]
     chart = chart/np.sqrt(np.sum(chart**2,0))
@@ -515,15 +649,21 @@ def LPP(G, X, dim, verbose=0, maxiter=1000):
 
     Note
     ----
-    non-sparse version ; breaks for large number of input items
+    the (G.V, G.V) adjacency matrix is not formed: the products
+    with X are accumulated over the edges
     """
     n = G.V
     dim = np.minimum(dim,n) 
-    G = fg.WeightedGraph(G.V,G.edges,G.weights)
-    W = G.adjacency()
-    D = np.diag(np.sum(W,1))
-    M1 = np.dot(np.dot(X.T,D-W),X)
-    M2 = np.dot(np.dot(X.T,D),X)
+    D = np.zeros(n)
+    XWX = np.zeros((X.shape[1],X.shape[1]))
+    if G.E>0:
+        a = G.edges[:,0]
+        b = G.edges[:,1]
+        d = np.bincount(a,G.weights)
+        D[:d.size] = d
+        XWX = np.dot(X[a].T*G.weights,X[b])
+    M2 = np.dot(X.T*D,X)
+    M1 = M2-XWX
     C = nl.cholesky(M2)
     iC = nl.pinv(C)
     M1 = np.dot(iC,np.dot(M1,iC.T))
@@ -610,13 +750,15 @@ class PCA(NLDR):
     
     """
 
-    def train(self, verbose=0):
+    def train(self, verbose=0, randomized=False):
         """
         training procedure
         
         Parameters
         ----------
         verbose=0 : verbosity mode
+        randomized=False: if True, only the rdim first components
+                          are approximated by a randomized svd
         
         Returns
         -------
@@ -626,7 +768,10 @@ class PCA(NLDR):
         self.check_data(self.train_data)
         self.offset = self.train_data.mean(0)
         x = self.train_data-self.offset
-        u,s,v  = svd(x,0)
+        if randomized:
+            u,s,v = randomized_svd(x, self.rdim)
+        else:
+            u,s,v  = svd(x,0)
         self.embedding = (u*s)[:,:self.rdim]
         self.scaling = s[:self.rdim]
         self.projector = v[:self.rdim,:].T
@@ -659,6 +804,99 @@ class PCA(NLDR):
 
 
 
+class StreamingPCA(PCA):
+    """
+    PCA of data that are fed by chunks of items, e.g. the blocks of
+    voxels of an ImageSource, so that the whole data never needs to
+    be held in memory
+
+    Only the mean and the (fdim, fdim) scatter matrix of the
+    items seen so far are kept; they are updated chunk by chunk with
+    the pairwise formulas of Chan et al., which remain accurate when
+    the mean is large with respect to the spread of the data.
+    The embedding of the training data is not available, but the
+    items may be embedded in a second pass with the test method.
+    """
+
+    def __init__(self, fdim=1, rdim=1):
+        NLDR.__init__(self, rdim=rdim, fdim=fdim)
+        self.nbitems = 0
+        self.mean = np.zeros(fdim)
+        self.scatter = np.zeros((fdim, fdim))
+
+    def update(self, X):
+        """
+        Add a chunk X of shape (nbitems, fdim) to the data
+        """
+        X = np.asarray(X, 'd')
+        if np.size(X)==self.fdim:
+            X = np.reshape(X,(1,self.fdim))
+        self.check_data(X)
+        nb = X.shape[0]
+        if nb == 0:
+            return
+        mb = X.mean(0)
+        x = X-mb
+        n = self.nbitems+nb
+        delta = mb-self.mean
+        self.scatter += np.dot(x.T, x) + \
+            np.outer(delta, delta)*(self.nbitems*nb/float(n))
+        self.mean += delta*(nb/float(n))
+        self.nbitems = n
+        self.trained = 0
+
+    def update_source(self, source, mask, block_size=4096):
+        """
+        Add the voxels of a mask, read by blocks from an ImageSource;
+        the voxels are the items and the images are the features
+        """
+        for sl, Y in source.blocks(mask, block_size=block_size):
+            self.update(Y.T)
+
+    def spectrum(self, center=True):
+        """
+        Singular values and right singular vectors of the data seen
+        so far, centered or not, in descending order
+
+        Returns
+        -------
+        s: array of shape (fdim)
+        v: array of shape (fdim, fdim), whose columns are the singular vectors
+        """
+        C = self.scatter
+        if not center:
+            C = C + self.nbitems*np.outer(self.mean, self.mean)
+        w, v = nl.eigh(C)
+        order = np.argsort(-w)
+        return np.sqrt(np.maximum(w[order], 0)), v[:, order]
+
+    def train(self, verbose=0):
+        """
+        training procedure, on the data seen so far
+        
+        Returns
+        -------
+        scaling: the rdim first singular values
+        """
+        if self.nbitems < 1:
+            raise ValueError, "No data to train on"
+        s, v = self.spectrum()
+        self.offset = self.mean.copy()
+        self.scaling = s[:self.rdim]
+        self.projector = v[:, :self.rdim]
+        self.trained = 1
+        return(self.scaling)
+
+    def infer_latent_dim(self, verbose=0, maxr=-1):
+        """
+        Same as infer_latent_dim on the (uncentered) data seen so far
+        """
+        s, v = self.spectrum(center=False)
+        s = s[:np.minimum(self.nbitems, self.fdim)]
+        return _infer_latent_dim_(s, self.fdim, self.nbitems, verbose, maxr)
+
+
+
 class MDS(NLDR):
     """
     This is a particular class that perfoms linear dimension reduction
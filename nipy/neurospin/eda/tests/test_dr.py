@@ -9,7 +9,9 @@ Author : Bertrand Thirion, 2008-2009
 import numpy as np
 from numpy.random import randn
 from nipy.neurospin.eda.dimension_reduction import CCA, MDS, knn_Isomap, \
-        eps_Isomap, infer_latent_dim, PCA
+        eps_Isomap, infer_latent_dim, PCA, StreamingPCA, randomized_svd, \
+        lobpcg, LE
+import nipy.neurospin.graph.graph as fg
 
 def test_cca():
     """
@@ -120,6 +122,75 @@ def test_dimension_estimation_2():
     print k, ek
     assert(k==ek)
 
+def test_randomized_svd():
+    """
+    Test the randomized svd on a low-rank matrix
+    """
+    x = np.dot(randn(100,5),randn(5,20))
+    U,S,Vt = randomized_svd(x, 5)
+    s = np.linalg.svd(x, compute_uv=0)
+    assert np.allclose(S, s[:5])
+    assert np.allclose(np.dot(U*S,Vt), x)
+    P = PCA(x, rdim=3)
+    u1 = P.train()
+    u2 = P.train(randomized=True)
+    assert np.allclose(np.abs(u1), np.abs(u2))
+
+def test_streaming_pca():
+    """
+    Test the PCA of data given by chunks against the batch PCA
+    """
+    X = 100+randn(200,6)
+    P = PCA(X, rdim=2)
+    P.train()
+    Q = StreamingPCA(fdim=6, rdim=2)
+    for i in range(0, 200, 37):
+        Q.update(X[i:i+37])
+    Q.train()
+    assert np.allclose(Q.offset, P.offset)
+    assert np.allclose(Q.scaling, P.scaling)
+    assert np.allclose(np.abs(Q.test(X[:10])), np.abs(P.test(X[:10])))
+
+def test_streaming_dimension_estimation():
+    """
+    Test the dimension selection with data given by chunks
+    """
+    k = 3
+    x = 10*np.dot(randn(100,k),randn(k,10))
+    x += randn(100,10)
+    Q = StreamingPCA(fdim=10)
+    for i in range(0, 100, 30):
+        Q.update(x[i:i+30])
+    ek = Q.infer_latent_dim()
+    assert(ek==infer_latent_dim(x))
+def test_lobpcg():
+    """
+    Test the block eigensolver against the dense decomposition
+    """
+    A = randn(30,30)
+    A = np.dot(A,A.T)
+    l,X = lobpcg(lambda x: np.dot(A,x), randn(30,3), tol=1.e-10)
+    w = np.linalg.eigvalsh(A)[::-1]
+    assert np.allclose(l,w[:3])
+    assert np.allclose(np.dot(A,X),X*l)
+
+def test_LE():
+    """
+    Test the laplacian embedding of a chain against the eigenvectors
+    of its dense normalized adjacency matrix
+    """
+    n = 30
+    i = np.arange(n-1)
+    edges = np.vstack((np.hstack((i,i+1)),np.hstack((i+1,i)))).T
+    G = fg.WeightedGraph(n,edges,np.ones(2*(n-1)))
+    W = G.adjacency()
+    d = np.sqrt(W.sum(1))
+    w,u = np.linalg.eigh(W/np.outer(d,d))
+    chart = LE(G,2)
+    for k in range(2):
+        c = chart[:,k]*d
+        c /= np.sqrt(np.sum(c**2))
+        assert np.abs(np.dot(c,u[:,-2-k]))>1-1.e-6
 
 if __name__ == '__main__':
     import nose
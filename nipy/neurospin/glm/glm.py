@@ -13,15 +13,21 @@ models = {'spherical':['ols', 'kalman'],
 
 class glm:
 	def __init__(self, Y=None, X=None, formula=None, axis=0, 
-		     model='spherical', method=None, niter=2):
+		     model='spherical', method=None, niter=2, bins=0):
 
 		# Check dimensions
+		self.bins = 0
 		if Y == None:
 			return
 		else:
-			self.fit(Y, X, formula, axis, model, method, niter)
+			self.fit(Y, X, formula, axis, model, method, niter, bins)
 
-	def fit(self, Y, X, formula=None, axis=0, model='spherical', method=None, niter=2):
+	def fit(self, Y, X, formula=None, axis=0, model='spherical', method=None, niter=2, bins=0):
+		"""
+		If bins is positive, the ar1 model is fitted by the binned
+		AR(1) method of kalman.ar1, so that the voxels of a bin share
+		the same effect variance matrix.
+		"""
 		
 		if Y.shape[axis] != X.shape[0]:
 			raise ValueError, 'Response and predictors are inconsistent'
@@ -54,7 +60,7 @@ class glm:
 				out = kalman.ols(Y, X, axis=axis)
                 elif self.model == 'ar1':
 			constants = ['a']
-			out = kalman.ar1(Y, X, axis=axis, niter=niter)
+			out = kalman.ar1(Y, X, axis=axis, niter=niter, bins=bins)
 			a = out[4]
 			out = out[0:4]
 			
@@ -63,6 +69,7 @@ class glm:
 		self.beta, self.nvbeta, self.s2, self.dof = out 
 		self.s2 = self.s2.squeeze()
 		self.a = a
+		self.bins = bins
 		self._constants = constants
 
 	"""
@@ -78,6 +85,7 @@ class glm:
 			 model=self.model,
 			 method=self.method,
 			 axis=self._axis, 
+			 bins=self.bins, 
 			 constants=self._constants)
 
 
@@ -128,9 +136,84 @@ class glm:
 		c.variance = vcon
 		c.dof = self.dof
 		return c
+
+	def contrasts(self, cons, tiny=DEF_TINY, nthreads=1):
+		"""
+		Statistics of several contrasts, evaluated in one pass over
+		the voxels with kalman.contrast_stats: a list holding
+		contrast(c).stat() for each c in cons, i.e. the t statistic
+		of contrast vectors and the F statistic of q x p contrast
+		matrices. F uses the Cholesky factor of c*nvbeta*c', and is
+		NaN where that matrix is not positive definite.
+		"""
+		axis = self._axis
+		ndims = len(self.beta.shape)
+		p = self.beta.shape[axis]
+		nvbeta = np.asarray(self.nvbeta)
+		labels = None
+		if not 'nvbeta' in self._constants and self.bins > 0: 
+			# Binned AR(1) fits: one variance matrix per bin 
+			a = np.asarray(self.a).reshape(-1)
+			aux, first, labels = np.unique(a, return_index=True, return_inverse=True)
+			nvbeta = np.rollaxis(nvbeta, axis, ndims+1)
+			nvbeta = np.rollaxis(nvbeta, axis, ndims+1) # X, p, p
+			nvbeta = nvbeta.reshape((-1, p, p))[first]
+		return kalman.contrast_stats(self.beta, nvbeta, self.s2, cons, axis=axis, 
+					     labels=labels, tiny=tiny, nthreads=nthreads)
                 
 
 
+class online(glm):
+	"""
+	Incremental ordinary least-square fit of whole scans, e.g. for
+	real-time fMRI. Each call to push updates the standard Kalman
+	filter of every voxel at once, which costs O(voxels*p) plus
+	O(p**2) for the effect variance matrix, common to all voxels.
+	The fit may be queried at any time using the contrast method.
+
+	Example:
+	  m = online((64, 64, 32), 3)
+	  for t in range(n):
+	      m.push(volume[t], X[t])
+	      tmap = m.contrast([1, 0, 0]).stat()
+	"""
+	def __init__(self, shape, p):
+		shape = tuple(np.atleast_1d(shape))
+		nvox = int(np.prod(shape))
+		self.model = 'spherical'
+		self.method = 'kalman'
+		self.a = 0
+		self.bins = 0
+		self._axis = 0
+		self._constants = ['nvbeta', 'a']
+		self._shape = shape
+		# State arrays: voxels are stored contiguously for each
+		# regressor 
+		self._B = np.zeros((p, nvox))
+		self._ssd = np.zeros(nvox)
+		self.t = 0
+		self.beta = self._B.reshape((p,)+shape)
+		self.nvbeta = kalman.INIT_VAR*np.eye(p)
+		self.s2 = np.zeros(shape)
+		self.dof = float(-p) 
+
+	def push(self, volume, x):
+		"""
+		Update the fit with a new scan volume, of the same shape as
+		the model, and the corresponding row x of the design matrix. 
+		"""
+		volume = np.asarray(volume)
+		x = np.asarray(x, dtype='double')
+		if not volume.shape == self._shape: 
+			raise ValueError, 'Volume and model shapes are inconsistent'
+		if not x.size == self.nvbeta.shape[0]:
+			raise ValueError, 'Design row and model are inconsistent'
+		kalman.push(self._B, self._ssd, self.nvbeta, volume, x)
+		self.t += 1
+		self.s2 = (self._ssd/self.t).reshape(self._shape)
+		self.dof = float(self.t - x.size)
+
+
 class contrast:
 
 	def __init__(self, dim, type='t', tiny=DEF_TINY, dofmax=DEF_DOFMAX):
@@ -287,6 +370,8 @@ def load(file):
 	mod.model = str(fmod['model'])
 	mod.method = str(fmod['method'])
 	mod._axis = int(fmod['axis'])
+	if 'bins' in fmod.files:
+		mod.bins = int(fmod['bins'])
 	mod._constants = list(fmod['constants'])
 	return mod
 
@@ -44,6 +44,13 @@ cdef extern from "fff_glm_kalman.h":
         fff_vector* vaux
         fff_matrix* Maux
 
+    ctypedef struct fff_glm_OLS:
+        size_t n
+        size_t dim
+        fff_matrix* PX
+        fff_matrix* Vb
+        double dof
+
     fff_glm_KF* fff_glm_KF_new(size_t dim)
     void fff_glm_KF_delete(fff_glm_KF* thisone)
     void fff_glm_KF_reset(fff_glm_KF* thisone)
@@ -57,6 +64,24 @@ cdef extern from "fff_glm_kalman.h":
     void fff_glm_KF_fit(fff_glm_KF* thisone, fff_vector* y, fff_matrix* X)
     void fff_glm_RKF_fit(fff_glm_RKF* thisone, unsigned int nloop, 
                          fff_vector* y, fff_matrix* X)
+    fff_glm_OLS* fff_glm_OLS_new(fff_matrix* X)
+    void fff_glm_OLS_delete(fff_glm_OLS* thisone)
+    void fff_glm_OLS_fit(fff_glm_OLS* thisone, fff_matrix* B, fff_vector* s2, 
+                         fff_matrix* Y, fff_matrix* X, fff_matrix* R)
+    void fff_glm_ar1_estimate(fff_vector* a, fff_matrix* R)
+    void fff_glm_ar1_whiten(fff_matrix* A, double a)
+    void fff_glm_KF_iterate_batch(fff_matrix* B, fff_vector* ssd, fff_matrix* Vb, 
+                                  fff_vector* y, fff_vector* x, 
+                                  fff_vector* Cby, fff_vector* ino)
+    double FFF_GLM_KALMAN_INIT_VAR
+
+# Exports from fff_glm_contrast.h
+cdef extern from "fff_glm_contrast.h":
+
+    int fff_glm_contrast_stats(fff_matrix* T, fff_matrix* B, fff_vector* s2,
+                               fff_matrix* VB, fff_array* label,
+                               fff_matrix* C, fff_array* dim,
+                               double tiny, int nthreads)
 
 
 # Initialize numpy
@@ -64,16 +89,64 @@ fffpy_import_array()
 import_array()
 import numpy as np
 
+# Number of signals fitted at once by ols
+OLS_CHUNK = 1024
+
+# Bound on the binned AR(1) autocorrelation
+AR1_MAX = .99
+
+# Initial effect variance of the Kalman filters
+INIT_VAR = FFF_GLM_KALMAN_INIT_VAR
+
 # Standard Kalman filter
 
-def ols(ndarray Y, ndarray X, int axis=0): 
+cdef _ols_chunks(fff_glm_OLS* ofilt, fff_matrix* x, ndarray Yf, 
+                 ndarray Bf, ndarray S2f, ndarray Af, size_t chunk):
+    """
+    Batched fit of the signals stored along the rows of Yf, writing
+    into the contiguous arrays Bf, S2f and, unless None, Af (AR(1)
+    estimates of the residuals). Chunks of signals are only copied if
+    they are not double contiguous.
+    """
+    cdef fff_matrix *y, *r
+    cdef fff_matrix b, rc
+    cdef fff_vector s2, a
+    cdef size_t n, p, nvox, i, nc
+
+    n = x.size1
+    p = x.size2
+    nvox = Yf.shape[0]
+    r = fff_matrix_new(chunk, n)
+
+    i = 0
+    while i < nvox:
+        nc = min(chunk, nvox-i)
+        y = fff_matrix_fromPyArray(Yf[i:i+nc])
+        b = fff_matrix_view(<double*>Bf.data + i*p, nc, p, p)
+        s2 = fff_vector_view(<double*>S2f.data + i, nc, 1)
+        rc = fff_matrix_view(r.data, nc, n, n)
+        fff_glm_OLS_fit(ofilt, &b, &s2, y, x, &rc)
+        if Af is not None:
+            a = fff_vector_view(<double*>Af.data + i, nc, 1)
+            fff_glm_ar1_estimate(&a, &rc)
+        fff_matrix_delete(y)
+        i = i + nc
+
+    fff_matrix_delete(r)
+
+
+def ols(ndarray Y, ndarray X, int axis=0, int chunk=OLS_CHUNK): 
     """
-    (beta, norm_var_beta, s2, dof) = ols(Y, X, axis=0).
+    (beta, norm_var_beta, s2, dof) = ols(Y, X, axis=0, chunk=OLS_CHUNK).
 
     Ordinary least-square multiple regression using the Kalman filter.
     Fit the N-dimensional array Y along the given axis in terms of the
     regressors in matrix X. The regressors must be stored columnwise.
 
+    The Kalman filter estimates are computed at once for `chunk`
+    signals using matrix products, since the design matrix is common
+    to all signals.
+
     OUTPUT: a four-element tuple
     beta -- array of parameter estimates
     norm_var_beta -- normalized variance matrix of the parameter
@@ -85,60 +158,142 @@ def ols(ndarray Y, ndarray X, int axis=0):
 
     REFERENCE:  Roche et al, ISBI 2004.
     """
-    cdef fff_vector *y, *b, *s2
     cdef fff_matrix *x
-    cdef fff_glm_KF *kfilt
-    cdef size_t p
-    cdef fffpy_multi_iterator* multi
+    cdef fff_glm_OLS *ofilt
+    cdef size_t p, n, nvox
     cdef double dof
 
     # View on design matrix
     x = fff_matrix_fromPyArray(X)
 
-    # Number of regressors 
+    # Number of regressors and time frames
     p = x.size2
+    n = x.size1
+    if Y.shape[axis] != n:
+        fff_matrix_delete(x)
+        raise ValueError('Y and X must have the same number of time frames')
+    if chunk < 1:
+        chunk = 1
+
+    # Signals along rows
+    Yf = np.rollaxis(Y, axis, Y.ndim)
+    dims = list(Yf.shape[:-1])
+    Yf = Yf.reshape((-1, n))
+    nvox = Yf.shape[0]
+
+    # Fit
+    Bf = np.zeros((nvox, p))
+    S2f = np.zeros(nvox)
+    ofilt = fff_glm_OLS_new(x)
+    _ols_chunks(ofilt, x, Yf, Bf, S2f, None, chunk)
+
+    # Reshape outputs
+    B = np.rollaxis(Bf.reshape(dims + [p]), -1, axis)
+    B = np.ascontiguousarray(B)
+    dims.insert(axis, 1)
+    S2 = S2f.reshape(dims)
+
+    # Normalized variance (data independent)
+    VB = fff_matrix_const_toPyArray(ofilt.Vb)
+    dof = ofilt.dof
     
-    # Allocate output arrays B and S2
-    dims = list(Y.shape)
-    dims[axis] = p
-    B = np.zeros(dims)
-    dims[axis] = 1
-    S2 = np.zeros(dims)
+    # Free memory
+    fff_matrix_delete(x)
+    fff_glm_OLS_delete(ofilt)
 
-    # Allocate local structure
-    kfilt = fff_glm_KF_new(p)
+    # Return
+    return B, VB, S2, dof
+    
 
-    # Create a new array iterator 
-    multi = fffpy_multi_iterator_new(3, axis, <void*>Y, <void*>B, <void*>S2)
+def push(ndarray B, ndarray SSD, ndarray VB, ndarray y, ndarray x):
+    """
+    push(B, SSD, VB, y, x).
+
+    One standard Kalman filter iteration for many signals at once,
+    typically the voxels of a newly acquired scan. The state arrays
+    are updated in place and must be double contiguous:
+
+    B -- effects, one column per signal (p x nvox)
+    SSD -- sums of squared residuals (nvox)
+    VB -- normalized effect variance matrix, common to all signals (p x p)
+
+    Start with zero effects and sums of squares and VB = INIT_VAR*I.
+    After n iterations, the outputs of ols are B, VB and SSD/n.
+
+    y -- current signal samples (nvox)
+    x -- current regressor values (p)
+    """
+    cdef fff_vector *yv, *xv, *cby, *ino
+    cdef fff_matrix b, vb
+    cdef fff_vector ssd
+    cdef size_t p, nvox
+
+    for A in (B, SSD, VB):
+        if not A.dtype == np.double or not A.flags['C_CONTIGUOUS']:
+            raise ValueError('State arrays must be double contiguous')
+    p = VB.shape[0]
+    nvox = SSD.size
+    if not B.shape[0] == p or not B.size == p*nvox or not VB.size == p*p:
+        raise ValueError('Inconsistent state arrays')
+    if not y.size == nvox or not x.size == p:
+        raise ValueError('Inconsistent scan and state arrays')
+
+    # Views on the state arrays
+    b = fff_matrix_view(<double*>B.data, p, nvox, nvox)
+    vb = fff_matrix_view(<double*>VB.data, p, p, p)
+    ssd = fff_vector_view(<double*>SSD.data, nvox, 1)
+    yv = fff_vector_fromPyArray(y.ravel())
+    xv = fff_vector_fromPyArray(x.ravel())
+    cby = fff_vector_new(p)
+    ino = fff_vector_new(nvox)
+
+    # Update
+    fff_glm_KF_iterate_batch(&b, &ssd, &vb, yv, xv, cby, ino)
+
+    # Free memory
+    fff_vector_delete(yv)
+    fff_vector_delete(xv)
+    fff_vector_delete(cby)
+    fff_vector_delete(ino)
+
+
+# Parallel job for the refined Kalman filter, see
+# group.onesample._stat_job.
+cdef struct _ar1_job_params:
+    fffpy_multi_iterator** parts
+    fff_matrix* x
+    unsigned int niter
+
+cdef void _ar1_job(int rank, int nthreads, void* p):
+    cdef _ar1_job_params* params = <_ar1_job_params*>p
+    cdef fffpy_multi_iterator* multi = params.parts[rank]
+    cdef fff_vector *y, *b, *vb, *s2, *a
+    cdef fff_vector Vb_flat
+    cdef fff_glm_RKF *rkfilt
+    cdef size_t p2
 
-    # Create views
     y = multi.vector[0]
     b = multi.vector[1]
-    s2 = multi.vector[2]
-
-    # Loop 
+    vb = multi.vector[2]
+    s2 = multi.vector[3]
+    a = multi.vector[4]
+    rkfilt = fff_glm_RKF_new(params.x.size2)
+    p2 = params.x.size2*params.x.size2
     while(multi.index < multi.size):
-        fff_glm_KF_fit(kfilt, y, x)
-        fff_vector_memcpy(b, kfilt.b)
-        s2.data[0] = kfilt.s2
+        fff_glm_RKF_fit(rkfilt, params.niter, y, params.x)
+        fff_vector_memcpy(b, rkfilt.b)
+        Vb_flat = fff_vector_view(rkfilt.Vb.data, p2, 1) # rkfilt.Vb contiguous by construction
+        fff_vector_memcpy(vb, &Vb_flat)
+        s2.data[0] = rkfilt.s2
+        a.data[0] = rkfilt.a
         fffpy_multi_iterator_update(multi)
+    fff_glm_RKF_delete(rkfilt)
 
-    # Normalized variance (computed from the last item)
-    VB = fff_matrix_const_toPyArray(kfilt.Vb);    
-    dof = kfilt.dof
-    
-    # Free memory
-    fff_matrix_delete(x)
-    fff_glm_KF_delete(kfilt)
-    fffpy_multi_iterator_delete(multi)
-
-    # Return
-    return B, VB, S2, dof
-    
 
-def ar1(ndarray Y, ndarray X, int niter=2, int axis=0):
+def ar1(ndarray Y, ndarray X, int niter=2, int axis=0, int bins=0, int chunk=OLS_CHUNK,
+        int nthreads=1):
     """
-    (beta, norm_var_beta, s2, dof, a) = ar1(Y, X, niter=2, axis=0)
+    (beta, norm_var_beta, s2, dof, a) = ar1(Y, X, niter=2, axis=0, bins=0, chunk=OLS_CHUNK, nthreads=1)
 
     Refined Kalman filter -- enhanced Kalman filter to account for
     noise autocorrelation using an AR(1) model. Pseudo-likelihood
@@ -155,6 +310,18 @@ def ar1(ndarray Y, ndarray X, int niter=2, int axis=0):
     dof -- scalar degrees of freedom
     a -- array of error autocorrelation estimates
 
+    If bins is positive, the refined Kalman filter is replaced with a
+    binned generalized least-square fit: the autocorrelation is
+    estimated from the OLS residuals and quantized into `bins` values
+    spanning the estimates. The signals of each bin are whitened and
+    fitted at once, `chunk` signals at a time, with the whitened
+    design, hence at roughly the cost of ols. niter is then unused and
+    a holds the quantized autocorrelation.
+
+    Otherwise, voxels are split across nthreads threads (all
+    processors if nthreads is zero or negative), which yields the
+    same result.
+
     REFERENCE:
     Roche et al, MICCAI 2004.
     """
@@ -164,8 +331,13 @@ def ar1(ndarray Y, ndarray X, int niter=2, int axis=0):
     cdef fff_glm_RKF *rkfilt
     cdef size_t p, p2
     cdef fffpy_multi_iterator* multi
+    cdef fffpy_multi_iterator** parts
+    cdef _ar1_job_params params
     cdef double dof
 
+    if bins > 0:
+        return _ar1_bins(Y, X, axis, bins, chunk)
+
     # View on design matrix
     x = fff_matrix_fromPyArray(X)
 
@@ -196,18 +368,30 @@ def ar1(ndarray Y, ndarray X, int niter=2, int axis=0):
     s2 = multi.vector[3]
     a = multi.vector[4]
 
-    # Loop 
-    while(multi.index < multi.size):
-        fff_glm_RKF_fit(rkfilt, niter, y, x)
-        fff_vector_memcpy(b, rkfilt.b)
-        Vb_flat = fff_vector_view(rkfilt.Vb.data, p2, 1) # rkfilt.Vb contiguous by construction
-        fff_vector_memcpy(vb, &Vb_flat)
-        s2.data[0] = rkfilt.s2
-        a.data[0] = rkfilt.a
-        fffpy_multi_iterator_update(multi)
+    # Threaded loop
+    nthreads = fff_threads_count(nthreads)
+    parts = NULL
+    if nthreads > 1:
+        parts = fffpy_multi_iterator_split(multi, nthreads)
+    if parts != NULL:
+        params.parts = parts
+        params.x = x
+        params.niter = niter
+        fffpy_parallel_run(nthreads, _ar1_job, <void*>&params)
+        fffpy_multi_iterator_split_delete(parts, nthreads)
+    else:
+        # Serial loop 
+        while(multi.index < multi.size):
+            fff_glm_RKF_fit(rkfilt, niter, y, x)
+            fff_vector_memcpy(b, rkfilt.b)
+            Vb_flat = fff_vector_view(rkfilt.Vb.data, p2, 1) # rkfilt.Vb contiguous by construction
+            fff_vector_memcpy(vb, &Vb_flat)
+            s2.data[0] = rkfilt.s2
+            a.data[0] = rkfilt.a
+            fffpy_multi_iterator_update(multi)
 
     # Dof 
-    dof = rkfilt.dof
+    dof = <double>(x.size1 - x.size2)
     
     # Free memory
     fff_matrix_delete(x)
@@ -224,4 +408,190 @@ def ar1(ndarray Y, ndarray X, int niter=2, int axis=0):
     
 
 
+def _ar1_bins(ndarray Y, ndarray X, int axis, int bins, int chunk):
+    """
+    Binned AR(1) fit, see ar1. 
+    """
+    cdef fff_matrix *x, *xw, *y, *r
+    cdef fff_matrix b, rc
+    cdef fff_vector s2
+    cdef fff_glm_OLS *ofilt
+    cdef size_t p, n, nvox, i, nc, k
+    cdef double dof, ak
+    cdef ndarray Bf, S2f, Af, Bc, S2c, Yc, Xw
 
+    # View on design matrix
+    x = fff_matrix_fromPyArray(X)
+
+    # Number of regressors and time frames
+    p = x.size2
+    n = x.size1
+    if Y.shape[axis] != n:
+        fff_matrix_delete(x)
+        raise ValueError('Y and X must have the same number of time frames')
+    if chunk < 1:
+        chunk = 1
+
+    # Signals along rows
+    Yf = np.rollaxis(Y, axis, Y.ndim)
+    dims = list(Yf.shape[:-1])
+    Yf = Yf.reshape((-1, n))
+    nvox = Yf.shape[0]
+
+    # OLS fit and AR(1) estimates from the residuals
+    Bf = np.zeros((nvox, p))
+    S2f = np.zeros(nvox)
+    Af = np.zeros(nvox)
+    ofilt = fff_glm_OLS_new(x)
+    _ols_chunks(ofilt, x, Yf, Bf, S2f, Af, chunk)
+    dof = ofilt.dof
+    fff_glm_OLS_delete(ofilt)
+
+    # Quantize the autocorrelation into bins spanning the estimates
+    Af = np.clip(Af, -AR1_MAX, AR1_MAX)
+    if nvox > 0:
+        amin, amax = Af.min(), Af.max()
+    else:
+        amin, amax = 0., 0.
+    width = (amax-amin)/bins
+    if width > 0:
+        K = np.minimum(((Af-amin)/width).astype('int'), bins-1)
+    else:
+        K = np.zeros(nvox, dtype='int')
+    order = np.argsort(K, kind='mergesort')
+    bounds = np.searchsorted(K[order], np.arange(bins+1))
+
+    # Whitened fit of each bin
+    VBf = np.zeros((nvox, p, p))
+    r = fff_matrix_new(chunk, n)
+    for k from 0 <= k < bins:
+        idx = order[bounds[k]:bounds[k+1]]
+        if idx.size == 0:
+            continue
+        ak = amin + (k+.5)*width
+        Af[idx] = ak
+
+        # Whitened design matrix and pseudo-inverse
+        Xw = np.array(X.T, dtype='double')
+        xw = fff_matrix_fromPyArray(Xw)
+        fff_glm_ar1_whiten(xw, ak)
+        fff_matrix_delete(xw)
+        Xw = np.ascontiguousarray(Xw.T)
+        xw = fff_matrix_fromPyArray(Xw)
+        ofilt = fff_glm_OLS_new(xw)
+        VBf[idx] = fff_matrix_const_toPyArray(ofilt.Vb)
+
+        # Whitened signals
+        i = 0
+        while i < idx.size:
+            nc = min(chunk, idx.size-i)
+            Yc = np.array(Yf[idx[i:i+nc]], dtype='double')
+            Bc = np.zeros((nc, p))
+            S2c = np.zeros(nc)
+            y = fff_matrix_fromPyArray(Yc)
+            fff_glm_ar1_whiten(y, ak)
+            b = fff_matrix_view(<double*>Bc.data, nc, p, p)
+            s2 = fff_vector_view(<double*>S2c.data, nc, 1)
+            rc = fff_matrix_view(r.data, nc, n, n)
+            fff_glm_OLS_fit(ofilt, &b, &s2, y, xw, &rc)
+            fff_matrix_delete(y)
+            Bf[idx[i:i+nc]] = Bc
+            S2f[idx[i:i+nc]] = S2c
+            i = i + nc
+
+        fff_matrix_delete(xw)
+        fff_glm_OLS_delete(ofilt)
+
+    # Free memory
+    fff_matrix_delete(r)
+    fff_matrix_delete(x)
+
+    # Reshape outputs
+    B = np.ascontiguousarray(np.rollaxis(Bf.reshape(dims + [p]), -1, axis))
+    VB = VBf.reshape(dims + [p, p])
+    VB = np.ascontiguousarray(np.rollaxis(np.rollaxis(VB, -1, axis), -1, axis))
+    dims.insert(axis, 1)
+    S2 = S2f.reshape(dims)
+    A = Af.reshape(dims)
+
+    return B, VB, S2, dof, A
+
+
+def contrast_stats(ndarray B, ndarray VB, S2, contrasts, int axis=0, labels=None,
+                   double tiny=1e-50, int nthreads=1):
+    """
+    T = contrast_stats(B, VB, S2, contrasts, axis=0, labels=None, tiny=1e-50, nthreads=1).
+
+    Statistics of several contrasts of a fit of ols or ar1, evaluated
+    in one pass over blocks of voxels shared among nthreads threads.
+
+    B -- array of parameter estimates, regressors along axis
+    VB -- normalized variance matrices of the estimates: either a
+    (p, p) matrix common to all voxels, or a (K, p, p) array indexed
+    by labels, or voxelwise matrices shaped as the output of ar1
+    S2 -- array of squared scale parameters
+    contrasts -- sequence of contrast vectors (p) or matrices (q, p)
+    labels -- index of the variance matrix of each voxel, with as many
+    items as S2
+
+    OUTPUT: a list of arrays with the shape of the voxels, holding the
+    t statistic of each contrast vector, and the F statistic of each
+    contrast matrix. The contrast variances are factored once for each
+    variance matrix that is shared by several voxels.
+    """
+    cdef fff_matrix *b, *vb, *c, *t
+    cdef fff_vector *s2
+    cdef fff_array *lab, *dim
+    cdef size_t p
+    cdef int err
+
+    # Voxels side by side
+    p = B.shape[axis]
+    Br = np.rollaxis(B, axis)
+    shape = Br.shape[1:]
+    Br = np.ascontiguousarray(Br.reshape((p, -1)), dtype='double')
+    S2r = np.ascontiguousarray(S2, dtype='double').reshape(-1)
+    Lr = None
+    if VB.ndim == 2:
+        VBr = VB.reshape((1, p*p))
+    elif labels is not None:
+        VBr = VB.reshape((-1, p*p))
+        Lr = np.asarray(labels, dtype=np.long).reshape(-1)
+    else:
+        VBr = np.rollaxis(np.rollaxis(VB, axis, VB.ndim), axis, VB.ndim)
+        VBr = VBr.reshape((-1, p*p))
+    VBr = np.ascontiguousarray(VBr, dtype='double')
+
+    # Stacked contrast rows
+    C = [np.atleast_2d(np.asarray(con, dtype='double')) for con in contrasts]
+    dims = np.array([con.shape[0] for con in C], dtype=np.long)
+    if len(C) == 0:
+        return []
+    C = np.ascontiguousarray(np.concatenate(C))
+    T = np.zeros((len(dims), Br.shape[1]))
+
+    b = fff_matrix_fromPyArray(Br)
+    vb = fff_matrix_fromPyArray(VBr)
+    s2 = fff_vector_fromPyArray(S2r)
+    c = fff_matrix_fromPyArray(C)
+    t = fff_matrix_fromPyArray(T)
+    dim = fff_array_fromPyArray(dims)
+    lab = NULL
+    if Lr is not None:
+        lab = fff_array_fromPyArray(Lr)
+
+    err = fff_glm_contrast_stats(t, b, s2, vb, lab, c, dim, tiny, nthreads)
+
+    # Free memory
+    fff_matrix_delete(b)
+    fff_matrix_delete(vb)
+    fff_vector_delete(s2)
+    fff_matrix_delete(c)
+    fff_matrix_delete(t)
+    fff_array_delete(dim)
+    if lab != NULL:
+        fff_array_delete(lab)
+    if err:
+        raise ValueError('Inconsistent estimates, variances and contrasts')
+
+    return [T[j].reshape(shape) for j in range(len(dims))]
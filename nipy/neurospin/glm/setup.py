@@ -19,7 +19,7 @@ def configuration(parent_package='',top_path=None):
 
     config.add_extension(
                 'kalman',
-                sources=['kalman.c'],
+                sources=['kalman.pyx'],
                 libraries=['cstat'],
                 extra_info=lapack_info,
                 )
@@ -2,7 +2,8 @@
 
 from numpy.testing import assert_almost_equal, TestCase
 import numpy as np
-from nipy.neurospin.glm.glm import glm
+from nipy.neurospin.glm.glm import glm, ols, online
+from nipy.neurospin.glm import kalman
 
 class TestFitting(TestCase):
 
@@ -54,6 +55,78 @@ class TestFitting(TestCase):
     def test_ols_axis3(self):
         self.make_data()
         self.ols(3)
+
+    def test_kalman_ols_chunks(self):
+        self.make_data()
+        y = np.rollaxis(self.y, 0, 3)
+        b, vb, s2, dof = kalman.ols(y, self.X, axis=2)
+        b1, vb1, s21, dof1 = kalman.ols(y, self.X, axis=2, chunk=7)
+        assert_almost_equal(b, b1)
+        assert_almost_equal(s2, s21)
+        b2, vb2, s22, dof2 = ols(y, self.X, axis=2)
+        n = y.shape[2]
+        assert_almost_equal(b, b2)
+        assert_almost_equal(vb, vb2)
+        assert_almost_equal(s2.squeeze()*n/dof, s22)
+        self.assertEqual(dof, dof2)
+
+    def test_online(self):
+        self.make_data()
+        y, X = self.y, self.X
+        m = online(y.shape[1:], X.shape[1])
+        for t in range(X.shape[0]):
+            m.push(y[t], X[t])
+        m1 = glm(y, X, axis=0, method='kalman')
+        assert_almost_equal(m.beta, m1.beta)
+        assert_almost_equal(m.nvbeta, m1.nvbeta)
+        assert_almost_equal(m.s2, m1.s2)
+        self.assertEqual(m.dof, m1.dof)
+        assert_almost_equal(m.contrast([1,0]).stat(), m1.contrast([1,0]).stat())
+
+    def test_ar1_bins(self):
+        self.make_data()
+        y, X = self.y, self.X
+        b, vb, s2, dof, a = kalman.ar1(y, X, axis=0, bins=1)
+        a0 = a.ravel()[0]
+        assert_almost_equal(a, a0)
+        yw = y.copy()
+        yw[1:] -= a0*y[:-1]
+        yw[0] *= np.sqrt(1-a0**2)
+        Xw = X.astype('double')
+        Xw[1:] -= a0*X[:-1]
+        Xw[0] *= np.sqrt(1-a0**2)
+        b1, vb1, s21, dof1 = ols(yw, Xw, axis=0)
+        n = y.shape[0]
+        assert_almost_equal(b, b1)
+        assert_almost_equal(vb[:,:,0,0,0], vb1)
+        assert_almost_equal(s2.squeeze()*n/dof, s21)
+        b, vb, s2, dof, a = kalman.ar1(y, X, axis=0, bins=5)
+        self.assertEqual(b.shape, (2,)+y.shape[1:])
+        self.assertEqual(vb.shape, (2,2)+y.shape[1:])
+        self.assert_(np.unique(a).size <= 5)
+
+    def test_contrasts(self):
+        self.make_data()
+        y, X = self.y, self.X
+        c, C = np.array([1, -.5]), np.eye(2)
+        m = glm(y, X, axis=0, method='kalman')
+        t, F = m.contrasts([c, C])
+        assert_almost_equal(t, m.contrast(c).stat())
+        # F statistic from the common effect variance
+        e = np.tensordot(C, m.beta, (1, 0))
+        iV = np.linalg.inv(np.dot(C, np.dot(m.nvbeta, C.T)))
+        F1 = (e*np.tensordot(iV, e, (1, 0))).sum(0)/(2*m.s2)
+        assert_almost_equal(F, F1)
+        # Voxelwise and binned AR(1) effect variances
+        m = glm(y, X, axis=0, model='ar1')
+        t, = m.contrasts([c], nthreads=2)
+        assert_almost_equal(t, m.contrast(c).stat())
+        m = glm(y, X, axis=0, model='ar1', bins=4)
+        t, F = m.contrasts([c, C])
+        t1, F1 = kalman.contrast_stats(m.beta, m.nvbeta, m.s2, [c, C])
+        assert_almost_equal(t, m.contrast(c).stat())
+        assert_almost_equal(t, t1)
+        assert_almost_equal(F, F1)
     
     
 if __name__ == "__main__":
@@ -36,6 +36,38 @@ def BPmatch(c1,c2,graph,dmax):
     k = belief[i,j]
     return i,j,k
 
+def BPmatch_sparse(c1, c2, G, dmax, damping=0., nthreads=1):
+    """
+    Matching the rows of c1 to those of c2 based on their relative positions,
+    with a memory and time that scale with the edges of G
+    
+    Parameters
+    ----------
+    c1, array of shape (nbitems1, dim),
+        dataset 1
+    c2, array of shape (nbitems2, dim),
+        dataset 2
+    G, WeightedGraph instance with nbitems1 vertices,
+       the graph structure between the items of c1
+    dmax, float, scale parameter; the pairs farther than 3*dmax are pruned
+    damping=0., float in [0,1[, weight of the former messages in each update
+    nthreads=1, int, number of threads (all the processors if <=0)
+
+    Returns
+    -------
+    i,j,k: arrays of shape(E) 
+           sparse adjacency matrix of the bipartite association graph
+    """
+    if G.E==0:
+        edges = np.zeros((0,2),np.int)
+        weights = np.zeros(0)
+    else:
+        edges = G.edges
+        weights = G.weights
+    i,j,k = fg.graph_bpmatch_sparse(c1, c2, edges[:,0], edges[:,1], weights,
+                                    dmax, damping, nthreads)
+    return i,j,k
+
 def match_trivial(c1, c2, scale, eps = 1.e-12 ):
     """
     Matching the rows of c1 to those of c2 based on their relative positions
@@ -6,7 +6,7 @@
 
 /* Code pour la creation du module */ 
 static char diffusion_doc[] = 
-" field = diffusion(a,b,d,field,nbiter=1)\n\
+" field = diffusion(a,b,d,field,nbiter=1,nthreads=1)\n\
   diffusion of a field of data in a weighted graph structure\n\
  INPUT :\n\
  - (a,b,d) sparse coding of the adjacency matrix of the graph \n\
@@ -16,10 +16,25 @@ static char diffusion_doc[] =
   p = dimension of the firld \n\
  - nbiter : the number of iterations required \n\
   (the larger the smoother) \n\
+ - nthreads : the number of threads (all the processors if <=0) \n\
  OUTPUT:\n\
  - field:   the resulting smoothed field\n\
  ";
 
+static char gaussian_smoothing_doc[] = 
+" field = gaussian_smoothing(XYZ,field,sigma,nthreads=1)\n\
+  separable Gaussian smoothing of a field of data on a set of voxels\n\
+ INPUT :\n\
+ - XYZ is an (n,3) array of voxel coordinates \n\
+ - field is an (n,p) array of data that has to be smoothed \n\
+  p = dimension of the field \n\
+ - sigma : the kernel width, in voxels \n\
+ - nthreads : the number of threads (all the processors if <=0) \n\
+ OUTPUT:\n\
+ - field:   the resulting smoothed field, normalized by the kernel \n\
+  mass within the voxels, so that constant fields are unchanged\n\
+ ";
+
 static char dilation_doc[] = 
 " field = dilation(a,b,field,nbiter=1)\n\
   Morphological dilation of a field of values in a graph structure\n\
@@ -158,6 +173,27 @@ static char threshold_bifurcations_doc[] =
  ";
 
 
+static char threshold_clusters_doc[] = 
+" idx,size,mass,peak,labels = threshold_clusters(XYZ,field,th,k=18)\n\
+  supra-threshold clusters of a field on a grid, for several thresholds\n\
+   at once: the voxels are swept only once by decreasing value \n\
+ INPUT :\n\
+ - XYZ is an (n,3) array of voxel coordinates \n\
+ - field is an (n) array of data \n\
+ - th is an array of thresholds, in any order \n\
+ - k is the grid connectivity (6, 18 or 26) \n\
+ OUTPUT:\n\
+ - idx: the index in th of the threshold of each cluster \n\
+   clusters are given threshold by threshold, in the order of th, \n\
+   and by decreasing peak value for each threshold \n\
+ - size: the number of voxels of each cluster \n\
+ - mass: the sum of (field-th) over each cluster \n\
+ - peak: the voxel of each cluster with the maximal field value \n\
+ - labels: (n,len(th)) labelling of the voxels according to the \n\
+   clusters of each threshold, numbered from 0 in the above order. \n\
+   its value is -1 for voxels below the threshold \n\
+ ";
+
 static char field_voronoi_doc[] = 
 " labels = threshold_bifurcations(a,b,field,seed)\n \
   performs a nearest-neighbour labelling of the field starting from the seeds \n\
@@ -182,16 +218,18 @@ Author: Bertrand Thirion (INRIA Futurs, Orsay, France), 2004-2006.";
 static PyArrayObject* diffusion(PyObject* self, PyObject* args)
 {
    PyArrayObject *a, *b, *d, *f;
-   int V,E,i,iter=1;
+   int V,E,iter=1;
+   int nthreads=1;
   
   /* Parse input */ 
   /* see http://www.python.org/doc/1.5.2p2/ext/parseTuple.html*/
-  int OK = PyArg_ParseTuple( args, "O!O!O!O!|i:diffusion", 
+  int OK = PyArg_ParseTuple( args, "O!O!O!O!|ii:diffusion", 
 			     &PyArray_Type, &a,
 			     &PyArray_Type, &b,
 			     &PyArray_Type, &d,
 			     &PyArray_Type, &f,
-			     &iter
+			     &iter,
+			     &nthreads
 			     ); 
   if (!OK) return NULL;   
 
@@ -218,8 +256,7 @@ static PyArrayObject* diffusion(PyObject* self, PyObject* args)
   fff_array_delete(B);
   fff_vector_delete(D);
   
-  for (i=0 ; i<iter ; i++)
-    fff_field_md_diffusion(field, G);
+  fff_field_md_diffusion_iter(field, G, iter, nthreads);
   
   
   fff_graph_delete(G);
@@ -230,6 +267,59 @@ static PyArrayObject* diffusion(PyObject* self, PyObject* args)
   return f;
 }
 
+static PyArrayObject* gaussian_smoothing(PyObject* self, PyObject* args)
+{
+  PyArrayObject *xyz, *f;
+  double sigma;
+  int nthreads=1;
+  long i, t, N;
+
+  /* Parse input */ 
+  /* see http://www.python.org/doc/1.5.2p2/ext/parseTuple.html*/
+  int OK = PyArg_ParseTuple( args, "O!O!d|i:gaussian_smoothing", 
+			     &PyArray_Type, &xyz,
+			     &PyArray_Type, &f,
+			     &sigma,
+			     &nthreads
+			     ); 
+  if (!OK) return NULL;   
+
+  /* prepare C arguments */
+  fff_array* XYZ = fff_array_fromPyArray( xyz );   
+  N = XYZ->dimX;
+  if (XYZ->dimY != 3) {
+    fff_array_delete(XYZ);
+    FFF_WARNING("Incorrect grid matrix supplied");
+    return NULL;
+  }
+  long* lxyz = (long*) calloc(FFF_MAX(3*N,1), sizeof(long));
+  for (i=0 ; i<N ; i++)
+    for (t=0 ; t<3 ; t++)
+      lxyz[i+t*N] = fff_array_get2d(XYZ,i,t);
+  fff_array_delete(XYZ);
+
+  /* Make a copy of the field matrix to avoid it being modified */
+  fff_matrix *ftemp = fff_matrix_fromPyArray(f);
+  fff_matrix *field = fff_matrix_new(ftemp->size1,ftemp->size2);
+  fff_matrix_memcpy (field, ftemp);
+  fff_matrix_delete(ftemp);
+  if ((long)field->size1 != N) {
+    free(lxyz);
+    fff_matrix_delete(field);
+    FFF_WARNING("incompatible dimension for data and XYZ");
+    return NULL;
+  }
+
+  /* do the job */
+  fff_field_gaussian_smoothing(field, lxyz, sigma, nthreads);
+  free(lxyz);
+
+  /* get the results as python arrrays*/  
+  f = fff_matrix_toPyArray( field ); 
+  
+  return f;
+}
+
 static PyArrayObject* dilation(PyObject* self, PyObject* args)
 {
    PyArrayObject *a, *b, *f;
@@ -640,6 +730,95 @@ static PyObject* threshold_bifurcations(PyObject* self, PyObject* args)
   return ret;
 }
 
+static PyObject* threshold_clusters(PyObject* self, PyObject* args)
+{
+  PyArrayObject *xyz, *f, *t, *idx, *size, *mass, *peak, *lab;
+  int k = 18;
+  long i, j, N, E, q;
+  npy_intp dim = 0;
+
+  /* Parse input */ 
+  /* see http://www.python.org/doc/1.5.2p2/ext/parseTuple.html*/
+  int OK = PyArg_ParseTuple( args, "O!O!O!|i:threshold_clusters", 
+			     &PyArray_Type, &xyz,
+			     &PyArray_Type, &f,
+			     &PyArray_Type, &t,
+			     &k
+			     ); 
+  if (!OK) return NULL;   
+
+  /* prepare C arguments */
+  fff_array* XYZ = fff_array_fromPyArray( xyz );   
+  N = XYZ->dimX;
+  if ((XYZ->dimY != 3) || (N < 1)) {
+    fff_array_delete(XYZ);
+    FFF_WARNING("Incorrect grid matrix supplied");
+    return NULL;
+  }
+  long* lxyz = (long*) calloc(3*N, sizeof(long));
+  for (i=0 ; i<N ; i++)
+    for (j=0 ; j<3 ; j++)
+      lxyz[i+j*N] = fff_array_get2d(XYZ,i,j);
+  fff_array_delete(XYZ);
+
+  fff_vector *field = fff_vector_fromPyArray(f);
+  fff_vector *th = fff_vector_fromPyArray(t);
+  if ((long)field->size != N) {
+    free(lxyz);
+    fff_vector_delete(field);
+    fff_vector_delete(th);
+    FFF_WARNING("incompatible dimension for data and XYZ");
+    return NULL;
+  }
+
+  /* do the job on the implicit graph */
+  fff_graph *G;
+  E = fff_graph_grid_stencil(&G, lxyz, N, k);
+  free(lxyz);
+  if (E == 0) {
+    fff_vector_delete(field);
+    fff_vector_delete(th);
+    FFF_WARNING("Graph creation failed");
+    return NULL;
+  }
+  fff_array* indices;
+  fff_array* sizes;
+  fff_vector* masses;
+  fff_array* peaks;
+  fff_array *label = fff_array_new2d(FFF_LONG,N,th->size);
+  q = fff_field_threshold_clusters(&indices, &sizes, &masses, &peaks, label, field, G, th);
+  fff_graph_delete(G);
+  fff_vector_delete(field);
+  fff_vector_delete(th);
+  if (q < 0) {
+    fff_array_delete(label);
+    return NULL;
+  }
+
+  /* get the results as python arrrays*/  
+  lab = fff_array_toPyArray( label );
+  if (q>0){
+    idx = fff_array_toPyArray( indices );
+    size = fff_array_toPyArray( sizes );
+    mass = fff_vector_toPyArray( masses );
+    peak = fff_array_toPyArray( peaks );
+  }
+  else{
+    fff_array_delete(indices);
+    fff_array_delete(sizes);
+    fff_vector_delete(masses);
+    fff_array_delete(peaks);
+    idx = fffpyZeroLONG(); 
+    size = fffpyZeroLONG(); 
+    mass = (PyArrayObject*)PyArray_SimpleNew(1, &dim, PyArray_DOUBLE);
+    peak = fffpyZeroLONG(); 
+  }
+
+  PyObject* ret = Py_BuildValue("NNNNN",idx,size,mass,peak,lab); 
+
+  return ret;
+}
+
 static PyObject* field_voronoi(PyObject* self, PyObject* args)
 {
   PyArrayObject *a, *b, *f, *seed, *label;
@@ -695,6 +874,10 @@ static PyMethodDef module_methods[] = {
    (PyCFunction)diffusion,      /* corresponding C function */
    METH_KEYWORDS,   /* ordinary (not keyword) arguments */
    diffusion_doc}, /* doc string */
+  {"gaussian_smoothing",    /* name of func when called from Python */
+   (PyCFunction)gaussian_smoothing,      /* corresponding C function */
+   METH_KEYWORDS,   /* ordinary (not keyword) arguments */
+   gaussian_smoothing_doc}, /* doc string */
   {"dilation",    /* name of func when called from Python */
    (PyCFunction)dilation,      /* corresponding C function */
    METH_KEYWORDS,   /* ordinary (not keyword) arguments */
@@ -723,6 +906,10 @@ static PyMethodDef module_methods[] = {
    (PyCFunction)threshold_bifurcations,      /* corresponding C function */
    METH_KEYWORDS,   /* ordinary (not keyword) arguments */
    threshold_bifurcations_doc}, /* doc string */
+  {"threshold_clusters",    /* name of func when called from Python */
+   (PyCFunction)threshold_clusters,      /* corresponding C function */
+   METH_KEYWORDS,   /* ordinary (not keyword) arguments */
+   threshold_clusters_doc}, /* doc string */
   {"custom_watershed",    /* name of func when called from Python */
    (PyCFunction)custom_watershed,      /* corresponding C function */
    METH_KEYWORDS,   /* ordinary (not keyword) arguments */
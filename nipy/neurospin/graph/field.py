@@ -194,7 +194,7 @@ class Field(fg.WeightedGraph):
                                  self.field[:,refdim])
         return depth
 
-    def diffusion(self,nbiter=1):
+    def diffusion(self,nbiter=1,nthreads=1):
        """
        diffusion of a field of data in the weighted graph structure
        Note that this changes self.field       
@@ -203,13 +203,14 @@ class Field(fg.WeightedGraph):
        ----------
        nbiter=1: the number of iterations required
                  (the larger the smoother)
+       nthreads=1: the number of threads (all the processors if <=0)
        
        Note : The process is run for all the dimensions of the field
        """
        nbiter = int(nbiter)
        if (self.E>0)&(nbiter>0)&(np.size(self.field)>0):
             self.field = diffusion(self.edges[:,0],self.edges[:,1],
-                                   self.weights,self.field,nbiter)
+                                   self.weights,self.field,nbiter,nthreads)
 
 
     def custom_watershed(self,refdim=0,th=-np.infty):
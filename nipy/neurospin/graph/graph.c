@@ -22,7 +22,7 @@ and 0 for each trivial edge\n\
 ";
 
 static char graph_knn_doc[] = 
-" (A,B,D) = graph_knn(X,k)\n\
+" (A,B,D) = graph_knn(X,k,nthreads=1)\n\
   Building the k-nearest-neighbours graph of the data \n\
 INPUT:\n\
 The array X is assumed to be a n*p feature matrix \n\
@@ -30,6 +30,7 @@ where n is the number of features \n\
 and p is the dimension of the features \n\
 It is assumed that the features are embedded in a (locally) Euclidian space \n\
 k is the number of neighbours considered\n\
+nthreads is the number of threads of the k-d tree queries (all the processors if <=0) \n\
 OUTPUT:\n\
 The edges of the resulting (directed) graph are defined through the triplet of 1-d arrays \n\
 A,B,D such that [A[e] B[e]] are the vertices D[e] = ||A[e]-B[e]|| Euclidian.\n\
@@ -41,7 +42,7 @@ then (B[e] A[e] D[e]) is another edge \n\
   ";
 
 static char graph_eps_doc[] = 
-" (A,B,D) = graph_eps(X,eps)\n\
+" (A,B,D) = graph_eps(X,eps,nthreads=1)\n\
 Building the epsilon-nearest-neighbours graph of the data\n\
 INPUT:\n\
 The array X is assumed to be a n*p feature matrix \n\
@@ -49,6 +50,7 @@ where n is the number of features \n\
 and p is the dimension of the features \n\
 It is assumed that the features are embedded in a (locally) Euclidian space \n\
 epsilon is the number of neighbourood size considered \n\
+nthreads is the number of threads of the k-d tree queries (all the processors if <=0) \n\
 OUTPUT:\n\
 The edges of the resulting (directed) graph are defined through the triplet of 1-d arrays \n\
 A,B,D such that [A[e] B[e]] are the vertices D[e] = ||A[e]-B[e]|| Euclidian.\n\
@@ -58,7 +60,7 @@ NB:\n\
 ";
 
 static char graph_cross_knn_doc[] = 
-" (A,B,D) = graph_cross_knn(X,Y,k)\n\
+" (A,B,D) = graph_cross_knn(X,Y,k,nthreads=1)\n\
   Building the cross-knn graph of the data \n\
 INPUT:\n\
 The arrays X  and Y is assumed to be a n1*p and n2*p feature matrices \n\
@@ -66,6 +68,7 @@ where (n1,n2) are the number of features in either candy \n\
 and p is the dimension of the features \n\
 It is assumed that the features are embedded in a (locally) Euclidian space \n\
  is the number of neighbours considered \n\
+nthreads is the number of threads of the k-d tree queries (all the processors if <=0) \n\
 OUTPUT:\n\
 The edges of the resulting (directed) graph are defined through the triplet of 1-d arrays \n\
 A,B,D such that [A[e] B[e]] are the vertices D[e] = ||A[e]-B[e]|| Euclidian.\n\
@@ -74,7 +77,7 @@ NB:\n\
   ";
 
 static char graph_cross_eps_doc[] = 
-" (A,B,D) = graph_cross_eps(X,Y,eps)\n\
+" (A,B,D) = graph_cross_eps(X,Y,eps,nthreads=1)\n\
   Building the cross_eps graph of the data \n\
 INPUT:\n\
 The arrays X  and Y is assumed to be a n1*p and n2*p feature matrices \n\
@@ -82,6 +85,7 @@ where (n1,n2) are the number of features in either candy \n\
 and p is the dimension of the features \n\
 It is assumed that the features are embedded in a (locally) Euclidian space \n\
 epsilon is the number of neighbourood size considered \n\
+nthreads is the number of threads of the k-d tree queries (all the processors if <=0) \n\
 OUTPUT:\n\
 The edges of the resulting (directed) graph are defined through the triplet of 1-d arrays \n\
 A,B,D such that [A[e] B[e]] are the vertices D[e] = ||A[e]-B[e]|| Euclidian.\n\
@@ -90,7 +94,7 @@ NB:\n\
   ";
 
 static char graph_cross_eps_robust_doc[] = 
-" (A,B,D) = graph_cross_eps_robust(X,Y,eps)\n\
+" (A,B,D) = graph_cross_eps_robust(X,Y,eps,nthreads=1)\n\
   Building the cross_eps graph of the data \n\
 INPUT:\n\
 The arrays X  and Y is assumed to be a n1*p and n2*p feature matrices \n\
@@ -98,6 +102,7 @@ where (n1,n2) are the number of features in either candy \n\
 and p is the dimension of the features \n\
 It is assumed that the features are embedded in a (locally) Euclidian space \n\
 epsilon is the number of neighbourood size considered \n\
+nthreads is the number of threads of the k-d tree queries (all the processors if <=0) \n\
 OUTPUT:\n\
 The edges of the resulting (directed) graph are defined through the triplet of 1-d arrays \n\
 A,B,D such that [A[e] B[e]] are the vertices D[e] = ||A[e]-B[e]|| Euclidian.\n\
@@ -106,13 +111,14 @@ NB:\n\
   ";
 
 static char graph_mst_doc[] = 
-" (A,B,D) = graph_mst(X)\n\
+" (A,B,D) = graph_mst(X,nthreads=1)\n\
   Building the MST of the data \n\
 INPUT:\n\
 The array X is assumed to be a n*p feature matrix \n\
 where n is the number of features \n\
 and p is the dimension of the features \n\
 It is assumed that the features are embedded in a (locally) Euclidian space \n\
+nthreads is the number of threads of the minimal link search (all the processors if <=0) \n\
 OUTPUT:\n\
 The edges of the resulting (directed) graph are defined through the triplet of 1-d arrays \n\
 A,B,D such that [A[e] B[e]] are the vertices D[e] = ||A[e]-B[e]|| Euclidian.\n\
@@ -123,13 +129,15 @@ then (B[e] A[e] D[e]) is another edge \n\
   ";
 
 static char graph_skeleton_doc[] = 
-" (A,B,D) = graph_mst(A1,B1,D1)\n\
+" (A,B,D) = graph_skeleton(A1,B1,D1,V,nthreads=1)\n\
   Building the MST of the data \n\
 INPUT:\n\
 The array X is assumed to be a n*p feature matrix \n\
 where n is the number of features \n\
 and p is the dimension of the features \n\
 It is assumed that the features are embedded in a (locally) Euclidian space \n\
+V is the number of vertices of the graph \n\
+nthreads is the number of threads of the minimal link search (all the processors if <=0) \n\
 OUTPUT:\n\
 The edges of the resulting (directed) graph are defined through the triplet of 1-d arrays \n\
 A,B,D such that [A[e] B[e]] are the vertices D[e] = ||A[e]-B[e]|| Euclidian.\n\
@@ -330,6 +338,38 @@ OUTPUT:\n\
 - label is a length V label vector\n\
   ";
 
+static char graph_cc_th_doc[] = 
+" label = graph_cc_th(a,b,d,x,th,V)\n\
+  returns the connected components of the subgraph of the vertices \n\
+  such that x>=th as labels, without building the subgraph.\n\
+  the graph is assumed symmetric \n\
+  INPUT:\n\
+- The edges of the input graph are defined through the couple of 1-d arrays \n\
+A,B such that [A[e] B[e]] are the vertices and D[e] an associated attribute \n\
+(distance/weight/affinity) \n\
+- x is a length V vector of vertex values \n\
+- th is the threshold \n\
+- V is the numner of vertices of the graph\n\
+It is an optional argument, by default v = size(x)\n\
+OUTPUT:\n\
+- label is a length V label vector, -1 for the vertices such that x<th;\n\
+the components are numbered as those of the subgraph would be\n\
+  ";
+
+static char graph_3d_grid_cc_doc[] = 
+" label = graph_3d_grid_cc(XYZ,k=18,nthreads=1)\n\
+  returns the connected components of the 6-nn, 18-nn or 26nn graph\n\
+of points sampled on a three-dimensional grid, as graph_cc would on\n\
+the edges of graph_3d_grid(XYZ,k), without building them.\n\
+ INPUT:\n\
+- The array XYZ is assumed to be a n*3 coordinate matrix \n\
+which are assumed to have integer values.  \n\
+- k (=6 or 18 or 26) is the neighboring system considered \n\
+- nthreads is the number of threads (all the processors if <=0) \n\
+OUTPUT:\n\
+- label is a length n label vector\n\
+  ";
+
 static char graph_is_connected_doc[] = 
 " bool = graph_is_connected(a,b,d,V)\n\
   states whether the given graph is connected or not.\n\
@@ -344,6 +384,23 @@ OUTPUT:\n\
 - bool, the response \n\
   ";
 
+static char graph_cc_max_doc[] = 
+" (size, mass) = graph_cc_max(a,b,d,X,th)\n\
+  returns the size and mass of the largest clusters above a threshold\n\
+  for each row of X.\n\
+  the graph is assumed symmetric \n\
+ INPUT:\n\
+- The edges of the input graph are defined through the couple of 1-d arrays \n\
+A,B such that [A[e] B[e]] are the vertices and D[e] an associated attribute \n\
+(distance/weight/affinity) \n\
+- X is a n*V array of vertex values, V being the number of vertices \n\
+- th is the height threshold \n\
+OUTPUT:\n\
+- size, the n maximal numbers of vertices in a connected component of \n\
+the subgraph such that X[i]>=th \n\
+- mass, the n maximal sums of X[i]-th over such connected components \n\
+  ";
+
 static char graph_mcc_doc[] = 
 " idx = graph_main_cc(a,b,d,V)\n\
   returns the main connected component of the graph.\n\
@@ -389,7 +446,7 @@ OUTPUT:\n\
   ";
 
 static char graph_floyd_doc[] = 
-" dg = graph_floyd(a,b,d,seed=NULL,V)\n\
+" dg = graph_floyd(a,b,d,seed=None,V,nthreads=1,out=None)\n\
   returns all the geodesic distances starting from seeds\n\
   d>=0 is mandatory and checked in the function c\n\
 INPUT:\n\
@@ -397,9 +454,12 @@ INPUT:\n\
 A,B such that [A[e] B[e]] are the vertices and D[e] an associated attribute \n\
 (distance/weight/affinity) \n\
 - seed is an arry of  edges from which the distances are computed \n\
-if seed==NULL, then every edge is a seed point\n\
+if seed==None, then every edge is a seed point\n\
 - V is the numner of vertices of the graph\n\
 It is an optional argument, by default v = max(max(a),max(b))+1\n\
+- nthreads is the number of threads (all the processors if <=0)\n\
+- out is an optional C-contiguous float64 array of size (nbseed,V), \n\
+e.g. a numpy.memmap, in which the result is directly written\n\
 OUTPUT:\n\
 - the graph distance dg from each seed to any edge \n\
 Note that it has size (nbseed,nbedges)\n\
@@ -457,6 +517,23 @@ OUTPUT: \n\
 - belief: the probabilistic correspondence matrix; size (n1,n2)\n\
 ";
 
+static char graph_bpmatch_sparse_doc[] = 
+" (i,j,k) = graph_bpmatch_sparse(sources,targets,a,b,d,d0,damping=0,nthreads=1) \n\
+   sparse version of graph_bpmatch, whose memory and time scale with the \n\
+   edges of the graph rather than with the number of source*target pairs: \n\
+   the targets farther than 3*d0 from a source are pruned, and the messages \n\
+   are only stored along the edges of the graph and for the remaining pairs.\n\
+INPUT:\n\
+- sources: the position of the sources \n\
+- targets: the posistion of the targets\n\
+- a,b,d: edges of the graph structure between sources \n\
+- d0 is a cutoff/scale parameter \n\
+- damping is the weight of the former messages in each update, in [0,1[ \n\
+- nthreads is the number of threads (all the processors if <=0) \n\
+OUTPUT:\n\
+- i,j,k: the belief k that source i matches target j, for the remaining pairs\n\
+";
+
 static char module_doc[] = 
 " Graph routines.\n\
 Author: Bertrand Thirion (INRIA Futurs, Orsay, France), 2004-2008.";
@@ -526,12 +603,14 @@ static PyObject* graph_knn(PyObject* self, PyObject* args)
 
   PyArrayObject *x, *a, *b, *d;
   int E,k;
+  int nthreads = 1;
 
   /* Parse input */ 
   /* see http://www.python.org/doc/1.5.2p2/ext/parseTuple.html*/
-  int OK = PyArg_ParseTuple( args, "O!i:graph_knn", 
+  int OK = PyArg_ParseTuple( args, "O!i|i:graph_knn", 
 			  &PyArray_Type, &x, 
-			  &k); 
+			  &k,
+			  &nthreads); 
     if (!OK) Py_RETURN_NONE; 
 
   /* prepare C arguments */
@@ -539,7 +618,7 @@ static PyObject* graph_knn(PyObject* self, PyObject* args)
   fff_graph *G;
 
   /* do the job */
-  E = fff_graph_knn(&G, X, k); 
+  E = fff_graph_knn(&G, X, k, nthreads); 
 
   fff_array *A = fff_array_new1d(FFF_LONG,E);
   fff_array *B = fff_array_new1d(FFF_LONG,E);
@@ -567,13 +646,15 @@ static PyObject* graph_cross_knn(PyObject* self, PyObject* args)
 {
   PyArrayObject *x, *y, *a, *b, *d;
   int k;
+  int nthreads = 1;
 
   /* Parse input */ 
   /* see http://www.python.org/doc/1.5.2p2/ext/parseTuple.html*/
-  int OK = PyArg_ParseTuple( args, "O!O!i:graph_crossknn", 
+  int OK = PyArg_ParseTuple( args, "O!O!i|i:graph_crossknn", 
 			  &PyArray_Type, &x, 
 			  &PyArray_Type, &y, 
-			  &k); 
+			  &k,
+			  &nthreads); 
   if (!OK) Py_RETURN_NONE; 
  
 
@@ -583,12 +664,12 @@ static PyObject* graph_cross_knn(PyObject* self, PyObject* args)
   int V = X->size1; 
   int E = k*V;
   fff_graph *G = fff_graph_new(V,E);
+  
+  /* do the job */
+  E = fff_graph_cross_knn(G, X, Y, k, nthreads);  
   fff_array *A = fff_array_new1d(FFF_LONG,E);
   fff_array *B = fff_array_new1d(FFF_LONG,E);
   fff_vector *D = fff_vector_new(E);
-  
-  /* do the job */
-  E = fff_graph_cross_knn(G, X, Y, k);  
   fff_graph_edit_safe(A,B,D,G);
   fff_graph_delete(G);
   fff_matrix_delete(X);
@@ -614,12 +695,14 @@ static PyObject* graph_eps(PyObject* self, PyObject* args)
   PyArrayObject *x, *a, *b, *d;
   int E;
   double eps;
+  int nthreads = 1;
 
   /* Parse input */ 
   /* see http://www.python.org/doc/1.5.2p2/ext/parseTuple.html*/
-  int OK = PyArg_ParseTuple( args, "O!d:graph_eps", 
+  int OK = PyArg_ParseTuple( args, "O!d|i:graph_eps", 
 			  &PyArray_Type, &x, 
-			  &eps); 
+			  &eps,
+			  &nthreads); 
   if (!OK) Py_RETURN_NONE; 
   
   /* prepare C arguments */
@@ -627,7 +710,7 @@ static PyObject* graph_eps(PyObject* self, PyObject* args)
   fff_graph *G;
   
   /* do the job */
-  E = fff_graph_eps(&G, X, eps); 
+  E = fff_graph_eps(&G, X, eps, nthreads); 
   fff_array *A = fff_array_new1d(FFF_LONG,E);
   fff_array *B = fff_array_new1d(FFF_LONG,E);
   fff_vector *D = fff_vector_new(E);
@@ -655,13 +738,15 @@ static PyObject* graph_cross_eps(PyObject* self, PyObject* args)
   PyArrayObject *x, *y, *a, *b, *d;
   int E;
   double eps;
+  int nthreads = 1;
 
   /* Parse input */ 
   /* see http://www.python.org/doc/1.5.2p2/ext/parseTuple.html*/
-  int OK = PyArg_ParseTuple( args, "O!O!d:graph_cross_eps", 
+  int OK = PyArg_ParseTuple( args, "O!O!d|i:graph_cross_eps", 
 			  &PyArray_Type, &x, 
 			  &PyArray_Type, &y,
-			  &eps); 
+			  &eps,
+			  &nthreads); 
   if (!OK) Py_RETURN_NONE; 
   
   /* prepare C arguments */
@@ -670,7 +755,7 @@ static PyObject* graph_cross_eps(PyObject* self, PyObject* args)
   fff_graph *G;
   
   /* do the job */
-  E = fff_graph_cross_eps(&G, X, Y, eps); 
+  E = fff_graph_cross_eps(&G, X, Y, eps, nthreads); 
   fff_array *A = fff_array_new1d(FFF_LONG,E);
   fff_array *B = fff_array_new1d(FFF_LONG,E);
   fff_vector *D = fff_vector_new(E);
@@ -699,13 +784,15 @@ static PyObject* graph_cross_eps_robust(PyObject* self, PyObject* args)
   PyArrayObject *x, *y, *a, *b, *d;
   int E;
   double eps;
+  int nthreads = 1;
 
   /* Parse input */ 
   /* see http://www.python.org/doc/1.5.2p2/ext/parseTuple.html*/
-  int OK = PyArg_ParseTuple( args, "O!O!d:graph_cross_eps_robust", 
+  int OK = PyArg_ParseTuple( args, "O!O!d|i:graph_cross_eps_robust", 
 			  &PyArray_Type, &x, 
 			  &PyArray_Type, &y,
-			  &eps); 
+			  &eps,
+			  &nthreads); 
   if (!OK) Py_RETURN_NONE; 
   
   /* prepare C arguments */
@@ -714,7 +801,7 @@ static PyObject* graph_cross_eps_robust(PyObject* self, PyObject* args)
   fff_graph *G;
   
   /* do the job */
-  E = fff_graph_cross_eps_robust(&G, X, Y, eps); 
+  E = fff_graph_cross_eps_robust(&G, X, Y, eps, nthreads); 
   fff_array *A = fff_array_new1d(FFF_LONG,E);
   fff_array *B = fff_array_new1d(FFF_LONG,E);
   fff_vector *D = fff_vector_new(E);
@@ -741,11 +828,13 @@ static PyObject* graph_cross_eps_robust(PyObject* self, PyObject* args)
 static PyObject* graph_mst(PyObject* self, PyObject* args)
 {
   PyArrayObject *x, *a, *b, *d;
+  int nthreads = 1;
   
   /* Parse input */ 
   /* see http://www.python.org/doc/1.5.2p2/ext/parseTuple.html*/
-  int OK = PyArg_ParseTuple( args, "O!:graph_mst", 
-			  &PyArray_Type, &x); 
+  int OK = PyArg_ParseTuple( args, "O!|i:graph_mst", 
+			  &PyArray_Type, &x,
+			  &nthreads); 
   if (!OK) Py_RETURN_NONE; 
   
   /* prepare C arguments */
@@ -758,7 +847,7 @@ static PyObject* graph_mst(PyObject* self, PyObject* args)
   fff_vector *D = fff_vector_new(E);
 
   /* do the job */
-  fff_graph_MST(G, X);   
+  fff_graph_MST(G, X, nthreads);   
   fff_graph_edit_safe(A,B,D,G);
   fff_graph_delete(G);
   fff_matrix_delete(X);
@@ -781,13 +870,15 @@ static PyObject* graph_skeleton(PyObject* self, PyObject* args)
 {
   PyArrayObject *a, *b, *d;
   int V;
+  int nthreads = 1;
   /* Parse input */ 
   /* see http://www.python.org/doc/1.5.2p2/ext/parseTuple.html*/
-  int OK = PyArg_ParseTuple( args, "O!O!O!|i:graph_skeleton", 
+  int OK = PyArg_ParseTuple( args, "O!O!O!|ii:graph_skeleton", 
 			     &PyArray_Type, &a,
 			     &PyArray_Type, &b,
 			     &PyArray_Type, &d,
-							 &V); 
+			     &V,
+			     &nthreads); 
   if (!OK) Py_RETURN_NONE; 
   
   /* prepare C arguments */
@@ -807,7 +898,7 @@ static PyObject* graph_skeleton(PyObject* self, PyObject* args)
   fff_graph *K = fff_graph_new(V,E);
 
  /* do the job */
-  fff_graph_skeleton(K, G);   
+  fff_graph_skeleton(K, G, nthreads);   
   A = fff_array_new1d(FFF_LONG,E);
   B = fff_array_new1d(FFF_LONG,E);
   D = fff_vector_new(E);  
@@ -1489,6 +1580,97 @@ static PyArrayObject* graph_cc(PyObject* self, PyObject* args)
   return l;
 }
 
+static PyArrayObject* graph_cc_th(PyObject* self, PyObject* args)
+{
+  PyArrayObject *a, *b, *d, *x, *l;
+  double th;
+  int V=0;
+
+  /* Parse input */ 
+  /* see http://www.python.org/doc/1.5.2p2/ext/parseTuple.html*/
+  int OK = PyArg_ParseTuple( args, "O!O!O!O!d|i:graph_cc_th", 
+			     &PyArray_Type, &a,
+			     &PyArray_Type, &b,
+			     &PyArray_Type, &d,
+			     &PyArray_Type, &x,
+			     &th,
+			     &V
+			     ); 
+  if (!OK) return NULL; 
+    
+  /* prepare C arguments */
+  fff_array* A = fff_array_fromPyArray( a ); 
+  fff_array* B = fff_array_fromPyArray( b );
+  fff_vector* D = fff_vector_fromPyArray(d);
+  fff_vector* X = fff_vector_fromPyArray(x);
+  int E = A->dimX;
+  if (V<1)
+    V = X->size;
+  fff_array *label = fff_array_new1d(FFF_LONG,V);
+  
+  /* do the job */
+  fff_graph *G = fff_graph_build_safe(V,E,A,B,D);
+  fff_array_delete(A);
+  fff_array_delete(B);
+  fff_vector_delete(D);
+  
+  fff_graph_cc_label_th(label->data, G, X, th, 1);
+  fff_graph_delete(G);
+  fff_vector_delete(X);
+  
+  /* get the results as python arrrays*/
+  l = fff_array_toPyArray( label );
+  
+  return l;
+}
+
+static PyArrayObject* graph_3d_grid_cc(PyObject* self, PyObject* args)
+{
+  PyArrayObject *xyz, *l;
+  int k=18;
+  int nthreads = 1;
+  long i, t, N, E;
+
+  /* Parse input */ 
+  /* see http://www.python.org/doc/1.5.2p2/ext/parseTuple.html*/
+  int OK = PyArg_ParseTuple( args, "O!|ii:graph_3d_grid_cc", 
+			     &PyArray_Type, &xyz, 
+			     &k,
+			     &nthreads); 
+  if (!OK) return NULL; 
+  
+  /* prepare C arguments */
+  fff_array* XYZ = fff_array_fromPyArray( xyz );   
+  fff_graph *G;
+  N = XYZ->dimX;
+  if ((XYZ->dimY != 3) || (N < 1)) {
+    fff_array_delete(XYZ);
+    FFF_WARNING("Incorrect grid matrix supplied");
+    return NULL;
+  }
+  long* lxyz = (long*) calloc(3*N, sizeof(long));
+  for (i=0 ; i<N ; i++)
+    for (t=0 ; t<3 ; t++)
+      lxyz[i+t*N] = fff_array_get2d(XYZ,i,t);
+  fff_array_delete(XYZ);
+
+  /* do the job on the implicit graph */
+  E = fff_graph_grid_stencil(&G, lxyz, N, k);
+  free(lxyz);
+  if (E == 0) {
+    FFF_WARNING("Graph creation failed");
+    return NULL;
+  }
+  fff_array *label = fff_array_new1d(FFF_LONG,N);
+  fff_graph_cc_label_th(label->data, G, NULL, 0, nthreads);
+  fff_graph_delete(G);
+
+  /* get the results as python arrrays*/
+  l = fff_array_toPyArray( label );
+  
+  return l;
+}
+
 static PyArrayObject* graph_main_cc(PyObject* self, PyObject* args)
 {
   PyArrayObject *a, *b, *d, *m;
@@ -1532,6 +1714,57 @@ static PyArrayObject* graph_main_cc(PyObject* self, PyObject* args)
   return m;
 }
 
+static PyObject* graph_cc_max(PyObject* self, PyObject* args)
+{
+  PyArrayObject *a, *b, *d, *x, *s, *m;
+  double th;
+  long i, size;
+
+  /* Parse input */ 
+  /* see http://www.python.org/doc/1.5.2p2/ext/parseTuple.html*/
+  int OK = PyArg_ParseTuple( args, "O!O!O!O!d:graph_cc_max", 
+			     &PyArray_Type, &a,
+			     &PyArray_Type, &b,
+			     &PyArray_Type, &d,
+			     &PyArray_Type, &x,
+			     &th
+			     ); 
+  if (!OK) return NULL; 
+    
+  /* prepare C arguments */
+  fff_array* A = fff_array_fromPyArray( a ); 
+  fff_array* B = fff_array_fromPyArray( b );
+  fff_vector* D = fff_vector_fromPyArray(d);
+  fff_matrix* X = fff_matrix_fromPyArray( x ); 
+  int E = A->dimX;
+  int V = X->size2; 
+  fff_array *S = fff_array_new1d(FFF_LONG,X->size1);
+  fff_vector *M = fff_vector_new(X->size1);
+  fff_vector xi; 
+  
+  /* do the job */
+  fff_graph *G = fff_graph_build_safe(V,E,A,B,D);
+  fff_array_delete(A);
+  fff_array_delete(B);
+  fff_vector_delete(D);
+
+  for (i=0; i<X->size1; i++) {
+    xi = fff_matrix_row(X, i); 
+    fff_graph_cc_max(&size, M->data+i, G, &xi, th); 
+    fff_array_set1d(S, i, size); 
+  }
+  fff_graph_delete(G);
+  fff_matrix_delete(X); 
+
+  /* get the results as python arrrays*/
+  s = fff_array_toPyArray( S );
+  m = fff_vector_toPyArray( M );
+
+  /* Output tuple */
+  PyObject* ret = Py_BuildValue("NN", s, m); 
+  return ret;
+}
+
 static PyArrayObject* graph_dijkstra(PyObject* self, PyObject* args)
 {
   PyArrayObject *a, *b, *d, *m;
@@ -1629,23 +1862,33 @@ static PyArrayObject* graph_dijkstra_multiseed(PyObject* self, PyObject* args)
 
 static PyArrayObject* graph_floyd(PyObject* self, PyObject* args)
 {
-  PyArrayObject *a, *b, *d, *m, *seed;
+  PyArrayObject *a, *b, *d, *m;
+  PyObject *seed = NULL, *out = NULL;
   int eA, eB, V = 0;
-  int ns=0;
-  seed = NULL;
+  int nthreads = 1;
+  long ns=0;
   fff_matrix *gd ;
   fff_array* seeds = NULL;
+  long* lseeds = NULL;
 
   /* Parse input */ 
   /* see http://www.python.org/doc/1.5.2p2/ext/parseTuple.html*/
-  int OK = PyArg_ParseTuple( args, "O!O!O!|O!i:graph_floyd", 
+  int OK = PyArg_ParseTuple( args, "O!O!O!|OiiO:graph_floyd", 
 			     &PyArray_Type, &a,
 			     &PyArray_Type, &b,
 			     &PyArray_Type, &d,
-			     &PyArray_Type, &seed,
-			     &V
+			     &seed,
+			     &V,
+			     &nthreads,
+			     &out
 			     ); 
   if (!OK) return NULL;   
+  if (seed == Py_None) seed = NULL;
+  if (out == Py_None) out = NULL;
+  if ((seed != NULL) && (!PyArray_Check(seed))){
+    PyErr_SetString(PyExc_TypeError, "seed should be an array or None");
+    return NULL;
+  }
 
   /* prepare C arguments */
   fff_array* A = fff_array_fromPyArray( a ); 
@@ -1658,31 +1901,50 @@ static PyArrayObject* graph_floyd(PyObject* self, PyObject* args)
      if (eA>V) V = eA;
      if (eB>V) V = eB;
    }
+  if (seed==NULL)
+    ns = V;
+  else{
+    seeds = fff_array_fromPyArray( (PyArrayObject*)seed );
+    ns = seeds->dimX;
+    lseeds = (long*) seeds->data;
+  }
+
+  /* the output can be written in place, e.g. in a memory-mapped array */
+  if (out != NULL){
+    m = (PyArrayObject*) out;
+    if ((!PyArray_Check(out)) || (PyArray_TYPE(m) != NPY_DOUBLE) || (PyArray_NDIM(m) != 2) ||
+	(!PyArray_ISCONTIGUOUS(m)) || (!PyArray_ISALIGNED(m)) || (!PyArray_ISWRITEABLE(m)) ||
+	(PyArray_DIM(m,0) != ns) || (PyArray_DIM(m,1) != V)){
+      PyErr_SetString(PyExc_ValueError, "out should be a writeable, contiguous float64 array of shape (nbseed, V)");
+      fff_array_delete(A);
+      fff_array_delete(B);
+      fff_vector_delete(D);
+      if (seeds != NULL) fff_array_delete(seeds);
+      return NULL;
+    }
+    gd = fff_matrix_fromPyArray(m);
+  }
+  else
+    gd = fff_matrix_new(ns,V); 
+
   /* do the job */
-  
   fff_graph *G = fff_graph_build_safe(V,E,A,B,D);
   fff_array_delete(A);
   fff_array_delete(B);
   fff_vector_delete(D);
   
-  if (seed==NULL){
-    gd = fff_matrix_new(V,V); 
-    fff_graph_Floyd(gd,G);
-  }
-  else{ 
-    seeds = fff_array_fromPyArray( seed );
-    ns = seeds->dimX;
-    
-    gd = fff_matrix_new(ns,V);
-        
-    fff_graph_partial_Floyd(gd,G,seeds->data);
+  fff_graph_geodesic_distances(gd,G,lseeds,nthreads);
     
+  if (seeds != NULL)
     fff_array_delete(seeds);
-    
-    }
   fff_graph_delete(G);
   
   /* get the results as python arrrays*/
+  if (out != NULL){
+    fff_matrix_delete(gd);
+    Py_INCREF(out);
+    return m;
+  }
   m = fff_matrix_toPyArray( gd);
   
   return m;
@@ -1814,6 +2076,67 @@ static PyArrayObject* graph_bpmatch(PyObject* self, PyObject* args)
 }
 
 
+static PyObject* graph_bpmatch_sparse(PyObject* self, PyObject* args)
+{
+  PyArrayObject *t, *s, *a, *b, *d, *i, *j, *k;
+  double d0, damping = 0;
+  int nthreads = 1;
+
+  /* Parse input */
+  /* see http://www.python.org/doc/1.5.2p2/ext/parseTuple.html */
+  int OK = PyArg_ParseTuple( args, "O!O!O!O!O!d|di:graph_bpmatch_sparse", 
+			     &PyArray_Type, &s,
+			     &PyArray_Type, &t,
+			     &PyArray_Type, &a,
+			     &PyArray_Type, &b,
+			     &PyArray_Type, &d,
+			     &d0,
+			     &damping,
+			     &nthreads
+                             ); 
+  if (!OK) return NULL;   
+    
+  /* prepare C arguments */
+  fff_matrix* source = fff_matrix_fromPyArray( s ); 
+  fff_matrix* target = fff_matrix_fromPyArray( t );
+  fff_array* A = fff_array_fromPyArray( a ); 
+  fff_array* B = fff_array_fromPyArray( b );
+  fff_vector* D = fff_vector_fromPyArray( d );
+  fff_graph *G = fff_graph_build_safe(source->size1,A->dimX,A,B,D);
+  fff_graph *K;
+  fff_array_delete(A);
+  fff_array_delete(B);
+  fff_vector_delete(D);
+  if (G == NULL){
+    fff_matrix_delete(source);
+    fff_matrix_delete(target);
+    return NULL;
+  }
+
+  /* do the job */
+  long E = fff_BPmatch_sparse(&K, source, target, G, d0, damping, nthreads);
+  fff_graph_delete(G);
+  fff_matrix_delete(source);
+  fff_matrix_delete(target);
+  if (K == NULL)
+    return NULL;
+
+  A = fff_array_new1d(FFF_LONG,E);
+  B = fff_array_new1d(FFF_LONG,E);
+  D = fff_vector_new(E);
+  fff_graph_edit_safe(A,B,D,K);
+  fff_graph_delete(K);
+
+  /* get the results as python arrrays */
+  i = fff_array_toPyArray( A );
+  j = fff_array_toPyArray( B );
+  k = fff_vector_toPyArray( D );
+
+  /* Output tuple  */
+  return Py_BuildValue("NNN", i, j, k);
+}
+
+
 
 static PyMethodDef module_methods[] = {
    {"graph_complete",           /* name of func when called from Python */
@@ -1892,6 +2215,18 @@ static PyMethodDef module_methods[] = {
    (PyCFunction)graph_cc,          /* corresponding C function */
    METH_KEYWORDS,          /* ordinary (not keyword) arguments */
    graph_cc_doc},        /* doc string */
+  {"graph_cc_th",        /* name of func when called from Python */
+   (PyCFunction)graph_cc_th,          /* corresponding C function */
+   METH_KEYWORDS,          /* ordinary (not keyword) arguments */
+   graph_cc_th_doc},        /* doc string */
+  {"graph_3d_grid_cc",        /* name of func when called from Python */
+   (PyCFunction)graph_3d_grid_cc,          /* corresponding C function */
+   METH_KEYWORDS,          /* ordinary (not keyword) arguments */
+   graph_3d_grid_cc_doc},        /* doc string */
+  {"graph_cc_max",        /* name of func when called from Python */
+   (PyCFunction)graph_cc_max,          /* corresponding C function */
+   METH_KEYWORDS,          /* ordinary (not keyword) arguments */
+   graph_cc_max_doc},        /* doc string */
   {"graph_main_cc",        /* name of func when called from Python */
    (PyCFunction)graph_main_cc,          /* corresponding C function */
    METH_KEYWORDS,          /* ordinary (not keyword) arguments */
@@ -1920,6 +2255,10 @@ static PyMethodDef module_methods[] = {
 	(PyCFunction)graph_bpmatch,          /* corresponding C function */
 	METH_KEYWORDS,          /*ordinary (not keyword) arguments */
 	graph_bpmatch_doc},        /* doc string */
+   {"graph_bpmatch_sparse",        /* name of func when called from Python */
+	(PyCFunction)graph_bpmatch_sparse,          /* corresponding C function */
+	METH_KEYWORDS,          /*ordinary (not keyword) arguments */
+	graph_bpmatch_sparse_doc},        /* doc string */
    {"graph_skeleton",        /* name of func when called from Python */
 	(PyCFunction)graph_skeleton,          /* corresponding C function */
 	METH_KEYWORDS,          /*ordinary (not keyword) arguments */
@@ -295,7 +295,7 @@ class WeightedGraph(Graph):
         self.weights = np.array(d)
         
         
-    def eps(self,X,eps=1.):
+    def eps(self,X,eps=1.,nthreads=1):
         """
         set the graph to be the eps-nearest-neighbours graph of the data
         
@@ -305,6 +305,8 @@ class WeightedGraph(Graph):
           where p = dimension of the features
           data used for eps-neighbours computation
         eps=1. (float),  the neighborhood width
+        nthreads=1 (int), number of threads of the neighbour search
+           (all the processors if <=0)
 
         Returns
         -------
@@ -330,7 +332,7 @@ class WeightedGraph(Graph):
             raise ValueError, 'eps is nan'
         if np.isinf(eps):
             raise ValueError, 'eps is inf'
-        i,j,d = graph_eps(X,eps)
+        i,j,d = graph_eps(X,eps,nthreads)
         self.E = np.size(i)
         self.edges = np.zeros((self.E,2),np.int)
         self.edges[:,0] = i
@@ -338,7 +340,7 @@ class WeightedGraph(Graph):
         self.weights = np.array(d)
         
         
-    def knn(self,X,k=1):
+    def knn(self,X,k=1,nthreads=1):
         """
         E = knn(X,k)
         set the graph to be the k-nearest-neighbours graph of the data
@@ -349,6 +351,8 @@ class WeightedGraph(Graph):
           where p = dimension of the features
           data used for eps-neighbours computation
         k=1 :  is the number of neighbours considered
+        nthreads=1 (int), number of threads of the neighbour search
+           (all the processors if <=0)
         
         Returns
         -------
@@ -376,7 +380,7 @@ class WeightedGraph(Graph):
             raise ValueError, 'k is nan'
         if np.isinf(k):
             raise ValueError, 'k is inf'
-        i,j,d = graph_knn(X,k)
+        i,j,d = graph_knn(X,k,nthreads)
         self.E = np.size(i)
         self.edges = np.zeros((self.E,2),np.int)
         self.edges[:,0] = i
@@ -384,7 +388,7 @@ class WeightedGraph(Graph):
         self.weights = np.array(d)
         return self.E
 
-    def mst(self,X):
+    def mst(self,X,nthreads=1):
         """
         makes self the MST of the array X
 
@@ -392,6 +396,7 @@ class WeightedGraph(Graph):
         ----------
         X: an array of shape (self.V,dim) 
            p is the feature dimension of X
+        nthreads=1 (int), number of threads of the minimal link search
         
         Returns
         -------
@@ -410,7 +415,7 @@ class WeightedGraph(Graph):
             X = np.reshape(X,(np.size(X),1))
         if X.shape[0]!=self.V:
             raise ValueError, 'X.shape[0] != self.V'
-        i,j,d = graph_mst(X)
+        i,j,d = graph_mst(X,nthreads)
         self.E = np.size(i)
         self.edges = np.zeros((self.E,2),np.int)
         self.edges[:,0] = i
@@ -477,7 +482,7 @@ class WeightedGraph(Graph):
                 dg[seed[i],i] = 0 
         return dg
 
-    def floyd(self, seed=None):
+    def floyd(self, seed=None, nthreads=1, out=None):
         """
         Compute all the geodesic distances starting from seeds
         it is mandatory that the graph weights are non-negative
@@ -487,6 +492,11 @@ class WeightedGraph(Graph):
         seed= None: array of shape (nbseed), type np.int 
              vertex indexes from which the distances are computed
              if seed==None, then every edge is a seed point
+        nthreads=1: int, optional
+             number of threads; if <=0, all the processors are used
+        out=None: array of shape (nbseed,self.V), optional
+             C-contiguous float64 array, e.g. a numpy.memmap, 
+             in which the distances are written
         
         Returns
         -------
@@ -497,13 +507,14 @@ class WeightedGraph(Graph):
         ----
         It is mandatory that the graph weights are non-negative
         The algorithm  proceeds byr epeating dijkstra's algo for each
-            seed. floyd's algo is not used (O(self.V)^3 complexity...)
+            seed, on several threads. When all the distances are required
+            and the graph is dense, the blocked Floyd-Warshall
+            algorithm is used instead.
         By convention, infinte distances are coded with sum(self.wedges)+1
         """
-        if seed == None:
-            seed = np.arange(self.V)
-
         if self.E==0:
+            if seed == None:
+                seed = np.arange(self.V)
             dg = np.infty*np.ones((self.V,np.size(seed)))
             for i in range(np.size(seed)): dg[seed[i],i] = 0 
             return dg
@@ -515,7 +526,7 @@ class WeightedGraph(Graph):
             raise ValueError,'undefined weights'
        
         dg = graph_floyd(self.edges[:,0], self.edges[:,1], self.weights, 
-                                          seed, self.V)
+                                          seed, self.V, nthreads, out)
         return dg
 
     def normalize(self,c=0):
@@ -1079,9 +1090,10 @@ class WeightedGraph(Graph):
         G = WeightedGraph(self.V,self.edges.copy(),self.weights.copy())
         return G
 
-    def skeleton(self):
+    def skeleton(self,nthreads=1):
         """
         returns a MST that based on self.weights
+        nthreads=1 (int), number of threads of the minimal link search
         Note: self must be connected
         """
         # check that self is connected
@@ -1090,7 +1102,7 @@ class WeightedGraph(Graph):
             raise ValueError, "cannot create the skeleton for \
                               unconnected graphs"
         i,j,d = graph_skeleton(self.edges[:,0],self.edges[:,1],
-                                self.weights,self.V)
+                                self.weights,self.V,nthreads)
         E = np.size(i)
         edges = np.zeros((E,2),np.int)
         edges[:,0] = i
@@ -1281,7 +1293,7 @@ class BipartiteGraph(WeightedGraph):
         return G
     
 
-    def cross_eps(self,X,Y,eps=1.):
+    def cross_eps(self,X,Y,eps=1.,nthreads=1):
         """
         set the graph to be the eps-neighbours graph of from X to Y
 
@@ -1291,6 +1303,7 @@ class BipartiteGraph(WeightedGraph):
             and (self.W) or (self.W,p) respectively
             where p = common dimension of the features
         eps=1, float : the neighbourhood size considered
+        nthreads=1, int: number of threads of the neighbour search
         
         Returns
         -------
@@ -1312,7 +1325,7 @@ class BipartiteGraph(WeightedGraph):
             raise ValueError, 'eps is nan'
         if np.isinf(eps):
             raise ValueError, 'eps is inf'
-        i,j,d = graph_cross_eps(X,Y,eps)
+        i,j,d = graph_cross_eps(X,Y,eps,nthreads)
         self.E = np.size(i)
         self.edges = np.zeros((self.E,2),np.int)
         self.edges[:,0] = i
@@ -1320,7 +1333,7 @@ class BipartiteGraph(WeightedGraph):
         self.weights = np.array(d)
         return self.E
 
-    def cross_eps_robust(self,X,Y,eps=1.):
+    def cross_eps_robust(self,X,Y,eps=1.,nthreads=1):
         """
         Set the graph to be the eps-neighbours graph of from X to Y
         this procedure is robust in the sense that for each row of X
@@ -1333,6 +1346,7 @@ class BipartiteGraph(WeightedGraph):
              and (self.W) or (self.W,p) respectively
              where p = dimension of the features
         eps=1, float, the neighbourhood size considered
+        nthreads=1, int: number of threads of the neighbour search
         
         Returns
         -------
@@ -1354,7 +1368,7 @@ class BipartiteGraph(WeightedGraph):
             raise ValueError, 'eps is nan'
         if np.isinf(eps):
             raise ValueError, 'eps is inf'
-        i,j,d = graph_cross_eps_robust(X,Y,eps)
+        i,j,d = graph_cross_eps_robust(X,Y,eps,nthreads)
         self.E = np.size(i)
         self.edges = np.zeros((self.E,2),np.int)
         self.edges[:,0] = i
@@ -1362,7 +1376,7 @@ class BipartiteGraph(WeightedGraph):
         self.weights = np.array(d)
         return self.E
     
-    def cross_knn(self,X,Y,k=1):
+    def cross_knn(self,X,Y,k=1,nthreads=1):
         """
         set the graph to be the k-nearest-neighbours graph of from X to Y
 
@@ -1372,6 +1386,7 @@ class BipartiteGraph(WeightedGraph):
             and (self.W) or (self.W,p) respectively
             where p = dimension of the features
         k=1, int  is the number of neighbours considered
+        nthreads=1, int: number of threads of the neighbour search
         
         Returns
         -------
@@ -1393,7 +1408,7 @@ class BipartiteGraph(WeightedGraph):
             raise ValueError, 'k is nan'
         if np.isinf(k):
             raise ValueError, 'k is inf'
-        i,j,d = graph_cross_knn(X,Y,k)
+        i,j,d = graph_cross_knn(X,Y,k,nthreads)
         self.E = np.size(i)
         self.edges = np.zeros((self.E,2),np.int)
         self.edges[:,0] = i
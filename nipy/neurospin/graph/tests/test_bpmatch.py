@@ -82,6 +82,26 @@ def test_match_3():
     a[i,j] = k
     assert_almost_equal(a.argmax(1),[0,1,2])
 
+def test_match_sparse():
+    c1 = np.array([[0],[1],[2]])
+    c2 = c1+0.6
+    adjacency = np.ones((3,3))-np.eye(3)
+    adjacency[2,0] = 0
+    adjacency[0,2] = 0
+    dmax = 1.0
+    i1, j1, k1 = BPmatch(c1, c2, adjacency, dmax)
+    G = fg.WeightedGraph(3)
+    G.from_adjacency(adjacency)
+    i2, j2, k2 = BPmatch_sparse(c1, c2, G, dmax, nthreads=2)
+    # no pair is pruned at this scale, hence the same beliefs
+    assert_almost_equal(i1, i2)
+    assert_almost_equal(j1, j2)
+    assert_almost_equal(k1, k2)
+    i3, j3, k3 = BPmatch_sparse(c1, c2, G, dmax, damping=0.5)
+    a = np.zeros((3,3))    
+    a[i3,j3] = k3
+    assert_almost_equal(a.argmax(1),[0,1,2])
+
 
 if __name__ == "__main__":
     import nose
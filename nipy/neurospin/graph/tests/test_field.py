@@ -118,6 +118,17 @@ class test_Field(TestCase):
         OK = OK1 & OK2 & OK3 & OK4
         self.assert_(OK)
 
+    def test_smooth_threads(self):
+        G  = basic_graph()
+        field = np.random.randn(1000,3)
+        G.set_field(field)
+        for i in range(3):
+            G.diffusion()
+        sfield = G.get_field()
+        G.set_field(field)
+        G.diffusion(3,nthreads=2)
+        self.assert_((G.get_field()==sfield).all())
+
     def test_dilation(self):
         F  = basic_field()
         F.field[555] = 30
@@ -130,6 +141,20 @@ class test_Field(TestCase):
         OK = OK1 & OK2 & OK3 & OK4
         self.assert_(OK)
 
+    def test_dilation_radius(self):
+        G  = basic_graph()
+        field = np.random.randn(1000,1)
+        G.set_field(field)
+        for i in range(5):
+            G.dilation()
+        dfield = G.get_field()
+        G.set_field(field)
+        G.dilation(5)
+        self.assert_((G.get_field()==dfield).all())
+        G.set_field(field)
+        G.erosion(5)
+        self.assert_((G.get_field()<=field).all())
+
     def test_erosion(self):
         F  = basic_field()
         F.field[555] = 30
@@ -214,6 +239,26 @@ class test_Field(TestCase):
         OK = np.size(idx==15)
         self.assert_(OK)
 
+    def test_threshold_clusters(self):
+        import numpy.random as nr
+        xyz = np.array( [[x,y,z] for z in range(8) for y in range(8) for x in range(8)] )
+        data = nr.randn(xyz.shape[0])
+        th = np.array([1., -0.5, 0.])
+        idx, size, mass, peak, label = ff.threshold_clusters(xyz, data, th, 18)
+        for t in range(th.size):
+            above = data>th[t]
+            F = ff.Field(np.sum(above), field=data[above])
+            F.from_3d_grid(xyz[above], 18)
+            cc = F.cc()
+            s = np.sort([np.sum(cc==k) for k in range(cc.max()+1)])
+            self.assert_((np.sort(size[idx==t])==s).all())
+            self.assert_(np.sum(label[:,t]>-1)==np.sum(above))
+            self.assert_(np.allclose(mass[idx==t].sum(), np.sum(data[above]-th[t])))
+            # peaks by descending order, and labelled as in idx
+            z = data[peak[idx==t]]
+            self.assert_((np.diff(z)<=0).all())
+            self.assert_((label[peak[idx==t],t]==np.arange(z.size)).all())
+
     def test_geodesic_kmeans(self,nbseeds=10,verbose=0):
         import numpy.random as nr
         F = basic_field_random()
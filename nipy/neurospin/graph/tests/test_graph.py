@@ -52,6 +52,21 @@ class test_Graph(TestCase):
         A = G.get_edges()[:,0]
         OK = (np.shape(A)[0]==(14))
         self.assert_(OK)
+
+    def test_knn_eps_brute_force(self):
+        x = nr.rand(500,3)
+        d = np.sqrt(((x[:,np.newaxis]-x[np.newaxis])**2).sum(2))
+        G = fg.WeightedGraph(500)
+        G.knn(x,5,nthreads=2)
+        ref = np.argsort(d,1)[:,1:6]
+        for i in range(500):
+            nb = G.edges[G.edges[:,0]==i,1]
+            self.assert_(set(ref[i])<=set(nb))
+        G.eps(x,0.1,nthreads=2)
+        i,j = np.nonzero((d<0.1)&(d>0))
+        self.assert_(G.E==np.size(i))
+        self.assert_(np.allclose(G.weights.sum(), d[i,j].sum()))
+
     def test_set_euclidian(self):
         G,x = basic_graph_2()
         d = G.weights
@@ -95,6 +110,17 @@ class test_Graph(TestCase):
         OK = (np.size(D)==18)
         self.assert_(OK)
 
+    def test_mst_threads(self):
+        x = nr.rand(100,3)
+        G = fg.WeightedGraph(x.shape[0])
+        G.mst(x)
+        Gt = fg.WeightedGraph(x.shape[0])
+        Gt.mst(x,nthreads=3)
+        self.assert_((G.edges==Gt.edges).all())
+        self.assert_((G.weights==Gt.weights).all())
+        K = G.skeleton(nthreads=3)
+        self.assert_(np.absolute(K.weights.sum()-G.weights.sum())<1.e-12)
+
     def test_cross_knn_1(self):
         x = basicdata()
         G = fg.BipartiteGraph(x.shape[0],x.shape[0])
@@ -256,6 +282,23 @@ class test_Graph(TestCase):
         OK = L.all()
         self.assert_(OK)
 
+    def test_cc_th(self):
+        x = basicdata()
+        G = fg.WeightedGraph(x.shape[0])
+        G.knn(x,2)
+        T = nr.rand(x.shape[0])
+        I = T>=0.3
+        l = fg.graph_cc_th(G.edges[:,0],G.edges[:,1],np.zeros(G.E),T,0.3)
+        self.assert_((l[I]==G.subgraph(I).cc()).all())
+        self.assert_((l[I==0]==-1).all())
+
+    def test_3d_grid_cc(self):
+        xyz = np.array(np.where(nr.rand(6,5,4)>0.4)).T
+        G = fg.WeightedGraph(xyz.shape[0])
+        G.from_3d_grid(xyz,6)
+        l = fg.graph_3d_grid_cc(xyz,6,nthreads=2)
+        self.assert_((l==G.cc()).all())
+
     def test_isconnected(self):
         G = basic_graph()
         b = G.is_connected()
@@ -312,6 +355,17 @@ class test_Graph(TestCase):
         
         self.assert_(OK)
   
+    def test_floyd_threads(self):
+        G = basic_graph()
+        seeds = np.array([0,3,10,17])
+        l = G.floyd(seeds)
+        lt = G.floyd(seeds, nthreads=3)
+        out = np.zeros((4,20))
+        lo = G.floyd(seeds, out=out)
+        self.assert_((l==lt).all())
+        self.assert_((l==out).all() & (lo is out))
+        self.assert_((np.absolute(G.floyd()[seeds]-l)).max()<1.e-12)
+
     def test_symmeterize(self):
         a = np.array([0,0,1,1,2,2,3,3,4,4,5,5,6,6])
         b = np.array([1,2,2,3,3,4,4,5,5,6,6,0,0,1])
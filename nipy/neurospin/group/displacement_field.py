@@ -3,6 +3,8 @@ from scipy.ndimage import correlate1d, _ni_support, gaussian_filter, \
                 binary_erosion
 from scipy import math
 
+from routines import add_lines
+
 def square_gaussian_filter1d(input, sigma, axis = -1, output = None, mode = "reflect", cval = 0.0):
     """One-dimensional Squared Gaussian filter.
 
@@ -78,6 +80,10 @@ class displacement_field:
         The constructor creates the following fields :
         self.block           List of N block masks (voxel index vectors)
         self.weights         List of N block weights (same shape as the masks)
+        self.block_voxels, self.block_weights, self.block_start
+                             Concatenated masks and weights, block b being
+                             block_voxels[block_start[b]:block_start[b+1]]
+        self.block_rows      Block of each entry of block_voxels
         self.U       (3,n,N) Displacement coefficients
         self.V       (3,n,p) Displacements
         self.W       (3,n,p) Discretize displacements
@@ -146,6 +152,15 @@ class displacement_field:
                         #print i,j,k
                         self.block.append(block_vol[XYZ_block[0], XYZ_block[1], XYZ_block[2]])
                         self.weights.append(kernel[XYZ_block[0], XYZ_block[1], XYZ_block[2]])
+        # Blocks concatenated for routines.sample_displacements, as the
+        # rows of a sparse (blocks x voxels) matrix in CSR format
+        self.block_start = np.cumsum([0] + [len(b) for b in self.block]).astype(int)
+        self.block_rows = np.repeat(np.arange(len(self.block)), np.diff(self.block_start))
+        self.block_voxels = np.zeros(0, int)
+        self.block_weights = np.zeros(0, float)
+        if len(self.block) > 0:
+            self.block_voxels = np.concatenate(self.block).astype(int)
+            self.block_weights = np.concatenate(self.weights).astype(float)
     
     def compute_inner_blocks(self):
         """
@@ -199,6 +214,17 @@ class displacement_field:
                 valid_proposal = True
         return U, V, block[L], W[:, L], I
     
+    def apply_blocks(self, U):
+        """
+        Displacements (3,p) generated by the block coefficients U (3,N),
+        i.e. the product of U with the sparse block weight matrix
+        """
+        p = self.XYZ.shape[1]
+        V = np.zeros((p, 3), float)
+        UW = (U[:, self.block_rows] * self.block_weights).T.copy()
+        add_lines(UW, V, self.block_voxels)
+        return V.T
+    
     def sample_all_blocks(self, proposal_std=None, proposal_mean=None):
         """
         Generates U, V, W, I, proposals for self.U[:, i], self.V[:, i], self.W[:, i], self.I[i].
@@ -212,9 +238,7 @@ class displacement_field:
             U = np.random.randn(3, B) * proposal_std
             if proposal_mean != None:
                 U += proposal_mean
-            V *= 0
-            for b in xrange(B):
-                V[:, self.block[b]] += self.weights[b].reshape(1, -1) * U[:, b].reshape(3,1)
+            V = self.apply_blocks(U)
             W = np.round(V).astype(int)
             XYZ_W = np.clip(self.XYZ + W, self.XYZ_min, self.XYZ_max)
             I = self.XYZ_vol[XYZ_W[0], XYZ_W[1], XYZ_W[2]]
@@ -1,2413 +0,0 @@
-/* Generated by Cython 0.10.3 on Sat Feb 28 00:26:25 2009 */
-
-#define PY_SSIZE_T_CLEAN
-#include "Python.h"
-#include "structmember.h"
-#ifndef PY_LONG_LONG
-  #define PY_LONG_LONG LONG_LONG
-#endif
-#ifndef DL_EXPORT
-  #define DL_EXPORT(t) t
-#endif
-#if PY_VERSION_HEX < 0x02040000
-  #define METH_COEXIST 0
-#endif
-#if PY_VERSION_HEX < 0x02050000
-  typedef int Py_ssize_t;
-  #define PY_SSIZE_T_MAX INT_MAX
-  #define PY_SSIZE_T_MIN INT_MIN
-  #define PyInt_FromSsize_t(z) PyInt_FromLong(z)
-  #define PyInt_AsSsize_t(o)   PyInt_AsLong(o)
-  #define PyNumber_Index(o)    PyNumber_Int(o)
-  #define PyIndex_Check(o)     PyNumber_Check(o)
-#endif
-#if PY_VERSION_HEX < 0x02060000
-  #define Py_REFCNT(ob) (((PyObject*)(ob))->ob_refcnt)
-  #define Py_TYPE(ob)   (((PyObject*)(ob))->ob_type)
-  #define Py_SIZE(ob)   (((PyVarObject*)(ob))->ob_size)
-  #define PyVarObject_HEAD_INIT(type, size) \
-          PyObject_HEAD_INIT(type) size,
-  #define PyType_Modified(t)
-
-  typedef struct {
-       void *buf;
-       PyObject *obj;
-       Py_ssize_t len;
-       Py_ssize_t itemsize;
-       int readonly;
-       int ndim;
-       char *format;
-       Py_ssize_t *shape;
-       Py_ssize_t *strides;
-       Py_ssize_t *suboffsets;
-       void *internal;
-  } Py_buffer;
-
-  #define PyBUF_SIMPLE 0
-  #define PyBUF_WRITABLE 0x0001
-  #define PyBUF_LOCK 0x0002
-  #define PyBUF_FORMAT 0x0004
-  #define PyBUF_ND 0x0008
-  #define PyBUF_STRIDES (0x0010 | PyBUF_ND)
-  #define PyBUF_C_CONTIGUOUS (0x0020 | PyBUF_STRIDES)
-  #define PyBUF_F_CONTIGUOUS (0x0040 | PyBUF_STRIDES)
-  #define PyBUF_ANY_CONTIGUOUS (0x0080 | PyBUF_STRIDES)
-  #define PyBUF_INDIRECT (0x0100 | PyBUF_STRIDES)
-
-#endif
-#if PY_MAJOR_VERSION < 3
-  #define __Pyx_BUILTIN_MODULE_NAME "__builtin__"
-#else
-  #define __Pyx_BUILTIN_MODULE_NAME "builtins"
-#endif
-#if PY_MAJOR_VERSION >= 3
-  #define Py_TPFLAGS_CHECKTYPES 0
-  #define Py_TPFLAGS_HAVE_INDEX 0
-#endif
-#if (PY_VERSION_HEX < 0x02060000) || (PY_MAJOR_VERSION >= 3)
-  #define Py_TPFLAGS_HAVE_NEWBUFFER 0
-#endif
-#if PY_MAJOR_VERSION >= 3
-  #define PyBaseString_Type            PyUnicode_Type
-  #define PyString_Type                PyBytes_Type
-  #define PyInt_Type                   PyLong_Type
-  #define PyInt_Check(op)              PyLong_Check(op)
-  #define PyInt_CheckExact(op)         PyLong_CheckExact(op)
-  #define PyInt_FromString             PyLong_FromString
-  #define PyInt_FromUnicode            PyLong_FromUnicode
-  #define PyInt_FromLong               PyLong_FromLong
-  #define PyInt_FromSize_t             PyLong_FromSize_t
-  #define PyInt_FromSsize_t            PyLong_FromSsize_t
-  #define PyInt_AsLong                 PyLong_AsLong
-  #define PyInt_AS_LONG                PyLong_AS_LONG
-  #define PyInt_AsSsize_t              PyLong_AsSsize_t
-  #define PyInt_AsUnsignedLongMask     PyLong_AsUnsignedLongMask
-  #define PyInt_AsUnsignedLongLongMask PyLong_AsUnsignedLongLongMask
-  #define __Pyx_PyNumber_Divide(x,y)         PyNumber_TrueDivide(x,y)
-#else
-  #define __Pyx_PyNumber_Divide(x,y)         PyNumber_Divide(x,y)
-  #define PyBytes_Type                 PyString_Type
-#endif
-#if PY_MAJOR_VERSION >= 3
-  #define PyMethod_New(func, self, klass) PyInstanceMethod_New(func)
-#endif
-#if !defined(WIN32) && !defined(MS_WINDOWS)
-  #ifndef __stdcall
-    #define __stdcall
-  #endif
-  #ifndef __cdecl
-    #define __cdecl
-  #endif
-#else
-  #define _USE_MATH_DEFINES
-#endif
-#ifdef __cplusplus
-#define __PYX_EXTERN_C extern "C"
-#else
-#define __PYX_EXTERN_C extern
-#endif
-#include <math.h>
-#define __PYX_HAVE_API__fff2__group__glm_twolevel
-#include "numpy/arrayobject.h"
-#include "fff_vector.h"
-#include "fff_matrix.h"
-#include "fff_base.h"
-#include "fff_array.h"
-#include "randomkit.h"
-#include "fffpy.h"
-#include "fff_glm_twolevel.h"
-
-
-#ifdef __GNUC__
-#define INLINE __inline__
-#elif _WIN32
-#define INLINE __inline
-#else
-#define INLINE 
-#endif
-
-typedef struct {PyObject **p; char *s; long n; char is_unicode; char intern; char is_identifier;} __Pyx_StringTabEntry; /*proto*/
-
-
-
-static int __pyx_skip_dispatch = 0;
-
-
-/* Type Conversion Predeclarations */
-
-#if PY_MAJOR_VERSION < 3
-#define __Pyx_PyBytes_FromString PyString_FromString
-#define __Pyx_PyBytes_AsString   PyString_AsString
-#else
-#define __Pyx_PyBytes_FromString PyBytes_FromString
-#define __Pyx_PyBytes_AsString   PyBytes_AsString
-#endif
-
-#define __Pyx_PyBool_FromLong(b) ((b) ? (Py_INCREF(Py_True), Py_True) : (Py_INCREF(Py_False), Py_False))
-static INLINE int __Pyx_PyObject_IsTrue(PyObject* x);
-static INLINE PY_LONG_LONG __pyx_PyInt_AsLongLong(PyObject* x);
-static INLINE unsigned PY_LONG_LONG __pyx_PyInt_AsUnsignedLongLong(PyObject* x);
-static INLINE Py_ssize_t __pyx_PyIndex_AsSsize_t(PyObject* b);
-
-#define __pyx_PyInt_AsLong(x) (PyInt_CheckExact(x) ? PyInt_AS_LONG(x) : PyInt_AsLong(x))
-#define __pyx_PyFloat_AsDouble(x) (PyFloat_CheckExact(x) ? PyFloat_AS_DOUBLE(x) : PyFloat_AsDouble(x))
-
-static INLINE unsigned char __pyx_PyInt_unsigned_char(PyObject* x);
-static INLINE unsigned short __pyx_PyInt_unsigned_short(PyObject* x);
-static INLINE char __pyx_PyInt_char(PyObject* x);
-static INLINE short __pyx_PyInt_short(PyObject* x);
-static INLINE int __pyx_PyInt_int(PyObject* x);
-static INLINE long __pyx_PyInt_long(PyObject* x);
-static INLINE signed char __pyx_PyInt_signed_char(PyObject* x);
-static INLINE signed short __pyx_PyInt_signed_short(PyObject* x);
-static INLINE signed int __pyx_PyInt_signed_int(PyObject* x);
-static INLINE signed long __pyx_PyInt_signed_long(PyObject* x);
-static INLINE long double __pyx_PyInt_long_double(PyObject* x);
-#ifdef __GNUC__
-/* Test for GCC > 2.95 */
-#if __GNUC__ > 2 ||               (__GNUC__ == 2 && (__GNUC_MINOR__ > 95)) 
-#define likely(x)   __builtin_expect(!!(x), 1)
-#define unlikely(x) __builtin_expect(!!(x), 0)
-#else /* __GNUC__ > 2 ... */
-#define likely(x)   (x)
-#define unlikely(x) (x)
-#endif /* __GNUC__ > 2 ... */
-#else /* __GNUC__ */
-#define likely(x)   (x)
-#define unlikely(x) (x)
-#endif /* __GNUC__ */
-    
-static PyObject *__pyx_m;
-static PyObject *__pyx_b;
-static PyObject *__pyx_empty_tuple;
-static int __pyx_lineno;
-static int __pyx_clineno = 0;
-static const char * __pyx_cfilenm= __FILE__;
-static const char *__pyx_filename;
-static const char **__pyx_f;
-
-static char __pyx_mdoc[] = "\nTwo-level general linear model for group analyses.\n\nAuthor: Alexis Roche, 2008.\n";
-
-static void __Pyx_RaiseDoubleKeywordsError(
-    const char* func_name, PyObject* kw_name); /*proto*/
-
-static void __Pyx_RaiseArgtupleInvalid(const char* func_name, int exact,
-    Py_ssize_t num_min, Py_ssize_t num_max, Py_ssize_t num_found); /*proto*/
-
-static int __Pyx_ParseOptionalKeywords(PyObject *kwds, PyObject **argnames[],     PyObject *kwds2, PyObject *values[], Py_ssize_t num_pos_args,     const char* function_name); /*proto*/
-
-static INLINE int __Pyx_SetItemInt(PyObject *o, Py_ssize_t i, PyObject *v, int is_unsigned) {
-    int r;
-    if (PyList_CheckExact(o) && 0 <= i && i < PyList_GET_SIZE(o)) {
-        Py_DECREF(PyList_GET_ITEM(o, i));
-        Py_INCREF(v);
-        PyList_SET_ITEM(o, i, v);
-        return 1;
-    }
-    else if (Py_TYPE(o)->tp_as_sequence && Py_TYPE(o)->tp_as_sequence->sq_ass_item && (likely(i >= 0) || !is_unsigned))
-        r = PySequence_SetItem(o, i, v);
-    else {
-        PyObject *j = (likely(i >= 0) || !is_unsigned) ? PyInt_FromLong(i) : PyLong_FromUnsignedLongLong((sizeof(unsigned long long) > sizeof(Py_ssize_t) ? (1ULL << (sizeof(Py_ssize_t)*8)) : 0) + i);
-        if (!j)
-            return -1;
-        r = PyObject_SetItem(o, j, v);
-        Py_DECREF(j);
-    }
-    return r;
-}
-
-static int __Pyx_ArgTypeTest(PyObject *obj, PyTypeObject *type, int none_allowed,
-    const char *name, int exact); /*proto*/
-
-static PyObject *__Pyx_Import(PyObject *name, PyObject *from_list); /*proto*/
-
-static PyObject *__Pyx_GetName(PyObject *dict, PyObject *name); /*proto*/
-
-static int __Pyx_TypeTest(PyObject *obj, PyTypeObject *type); /*proto*/
-
-static PyObject *__Pyx_UnpackItem(PyObject *, Py_ssize_t index); /*proto*/
-static int __Pyx_EndUnpack(PyObject *); /*proto*/
-
-static PyTypeObject *__Pyx_ImportType(const char *module_name, const char *class_name, long size);  /*proto*/
-
-static PyObject *__Pyx_ImportModule(const char *name); /*proto*/
-
-static void __Pyx_AddTraceback(const char *funcname); /*proto*/
-
-static int __Pyx_InitStrings(__Pyx_StringTabEntry *t); /*proto*/
-
-/* Type declarations */
-
-typedef unsigned long __pyx_t_4fff2_5group_12glm_twolevel_size_t;
-/* Module declarations from numpy */
-
-/* Module declarations from fff2.group.glm_twolevel */
-
-static PyTypeObject *__pyx_ptype_4fff2_5group_12glm_twolevel_dtype = 0;
-static PyTypeObject *__pyx_ptype_4fff2_5group_12glm_twolevel_ndarray = 0;
-static PyTypeObject *__pyx_ptype_4fff2_5group_12glm_twolevel_flatiter = 0;
-static PyTypeObject *__pyx_ptype_4fff2_5group_12glm_twolevel_broadcast = 0;
-static int __pyx_k_3;
-static int __pyx_k_4;
-
-
-/* Implementation of fff2.group.glm_twolevel */
-static char __pyx_k_2[] = "0.1";
-static PyObject *__pyx_int_2;
-static PyObject *__pyx_int_1;
-static char __pyx_k_Y[] = "Y";
-static PyObject *__pyx_kp_Y;
-static char __pyx_k_VY[] = "VY";
-static PyObject *__pyx_kp_VY;
-static char __pyx_k_X[] = "X";
-static PyObject *__pyx_kp_X;
-static char __pyx_k_C[] = "C";
-static PyObject *__pyx_kp_C;
-static char __pyx_k_axis[] = "axis";
-static PyObject *__pyx_kp_axis;
-static char __pyx_k_niter[] = "niter";
-static PyObject *__pyx_kp_niter;
-static char __pyx_k_B[] = "B";
-static PyObject *__pyx_kp_B;
-static char __pyx_k_1[] = "S2";
-static PyObject *__pyx_kp_1;
-static char __pyx_k___version__[] = "__version__";
-static PyObject *__pyx_kp___version__;
-static char __pyx_k_numpy[] = "numpy";
-static PyObject *__pyx_kp_numpy;
-static char __pyx_k_np[] = "np";
-static PyObject *__pyx_kp_np;
-static char __pyx_k_DEF_NITER[] = "DEF_NITER";
-static PyObject *__pyx_kp_DEF_NITER;
-static char __pyx_k_linalg[] = "linalg";
-static PyObject *__pyx_kp_linalg;
-static char __pyx_k_pinv[] = "pinv";
-static PyObject *__pyx_kp_pinv;
-static char __pyx_k_inv[] = "inv";
-static PyObject *__pyx_kp_inv;
-static char __pyx_k_dot[] = "dot";
-static PyObject *__pyx_kp_dot;
-static char __pyx_k_transpose[] = "transpose";
-static PyObject *__pyx_kp_transpose;
-static char __pyx_k_eye[] = "eye";
-static PyObject *__pyx_kp_eye;
-static char __pyx_k_shape[] = "shape";
-static PyObject *__pyx_kp_shape;
-static char __pyx_k_zeros[] = "zeros";
-static PyObject *__pyx_kp_zeros;
-static char __pyx_k_em[] = "em";
-static PyObject *__pyx_kp_em;
-static char __pyx_k_log_likelihood[] = "log_likelihood";
-static PyObject *__pyx_kp_log_likelihood;
-static char __pyx_k_maximum[] = "maximum";
-static PyObject *__pyx_kp_maximum;
-static PyObject *__pyx_kp_2;
-
-/* "d:\home\ar203069\bzr\nipy\fff2\fff2\group\glm_twolevel.pyx":42
- * DEF_NITER = 2
- * 
- * def em(ndarray Y, ndarray VY, ndarray X, ndarray C=None, int axis=0, int niter=DEF_NITER):             # <<<<<<<<<<<<<<
- * 	"""
- * 	b, s2 = em(y, vy, X, C=None, axis=0, niter=DEF_NITER).
- */
-
-static PyObject *__pyx_pf_4fff2_5group_12glm_twolevel_em(PyObject *__pyx_self, PyObject *__pyx_args, PyObject *__pyx_kwds); /*proto*/
-static char __pyx_doc_4fff2_5group_12glm_twolevel_em[] = "\n\tb, s2 = em(y, vy, X, C=None, axis=0, niter=DEF_NITER).\n\n\tMaximum likelihood regression in a mixed-effect GLM using the\n\tEM algorithm.\n\n\tC is the contrast matrix. Conventionally, C is p x q where p\n\tis the number of regressors. \n\t\n\tOUTPUT: beta, s2\n\tbeta -- array of parameter estimates\n\ts2 -- array of squared scale parameters.\n\t\n\tREFERENCE:\n\tKeller and Roche, ISBI 2008.\n\t";
-static PyObject *__pyx_pf_4fff2_5group_12glm_twolevel_em(PyObject *__pyx_self, PyObject *__pyx_args, PyObject *__pyx_kwds) {
-  PyArrayObject *__pyx_v_Y = 0;
-  PyArrayObject *__pyx_v_VY = 0;
-  PyArrayObject *__pyx_v_X = 0;
-  PyArrayObject *__pyx_v_C = 0;
-  int __pyx_v_axis;
-  int __pyx_v_niter;
-  __pyx_t_4fff2_5group_12glm_twolevel_size_t __pyx_v_n;
-  __pyx_t_4fff2_5group_12glm_twolevel_size_t __pyx_v_p;
-  fff_vector *__pyx_v_y;
-  fff_vector *__pyx_v_vy;
-  fff_vector *__pyx_v_b;
-  fff_vector *__pyx_v_s2;
-  fff_matrix *__pyx_v_x;
-  fff_matrix *__pyx_v_ppx;
-  fff_glm_twolevel_EM *__pyx_v_em;
-  fffpy_multi_iterator *__pyx_v_multi;
-  PyObject *__pyx_v_PpX;
-  PyObject *__pyx_v_A;
-  PyObject *__pyx_v_B;
-  PyObject *__pyx_v_P;
-  PyObject *__pyx_v_dims;
-  PyObject *__pyx_v_S2;
-  PyObject *__pyx_r;
-  PyObject *__pyx_1 = 0;
-  int __pyx_2;
-  PyObject *__pyx_3 = 0;
-  PyObject *__pyx_4 = 0;
-  PyObject *__pyx_5 = 0;
-  PyObject *__pyx_6 = 0;
-  PyObject *__pyx_7 = 0;
-  PyObject *__pyx_t_1 = NULL;
-  static PyObject **__pyx_pyargnames[] = {&__pyx_kp_Y,&__pyx_kp_VY,&__pyx_kp_X,&__pyx_kp_C,&__pyx_kp_axis,&__pyx_kp_niter,0};
-  __pyx_self = __pyx_self;
-  __pyx_v_C = ((PyArrayObject *)Py_None);
-  __pyx_v_axis = 0;
-  __pyx_v_niter = __pyx_k_3;
-  if (unlikely(__pyx_kwds)) {
-    PyObject* values[6] = {0,0,0,0,0,0};
-    Py_ssize_t kw_args = PyDict_Size(__pyx_kwds);
-    switch (PyTuple_GET_SIZE(__pyx_args)) {
-      case  6: values[5] = PyTuple_GET_ITEM(__pyx_args, 5);
-      case  5: values[4] = PyTuple_GET_ITEM(__pyx_args, 4);
-      case  4: values[3] = PyTuple_GET_ITEM(__pyx_args, 3);
-      case  3: values[2] = PyTuple_GET_ITEM(__pyx_args, 2);
-      case  2: values[1] = PyTuple_GET_ITEM(__pyx_args, 1);
-      case  1: values[0] = PyTuple_GET_ITEM(__pyx_args, 0);
-      case  0: break;
-      default: goto __pyx_L5_argtuple_error;
-    }
-    switch (PyTuple_GET_SIZE(__pyx_args)) {
-      case  0:
-      values[0] = PyDict_GetItem(__pyx_kwds, __pyx_kp_Y);
-      if (likely(values[0])) kw_args--;
-      else goto __pyx_L5_argtuple_error;
-      case  1:
-      values[1] = PyDict_GetItem(__pyx_kwds, __pyx_kp_VY);
-      if (likely(values[1])) kw_args--;
-      else {
-        __Pyx_RaiseArgtupleInvalid("em", 0, 3, 6, 1); {__pyx_filename = __pyx_f[0]; __pyx_lineno = 42; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-      }
-      case  2:
-      values[2] = PyDict_GetItem(__pyx_kwds, __pyx_kp_X);
-      if (likely(values[2])) kw_args--;
-      else {
-        __Pyx_RaiseArgtupleInvalid("em", 0, 3, 6, 2); {__pyx_filename = __pyx_f[0]; __pyx_lineno = 42; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-      }
-    }
-    if (unlikely(kw_args > 0)) {
-      if (unlikely(__Pyx_ParseOptionalKeywords(__pyx_kwds, __pyx_pyargnames, 0, values, PyTuple_GET_SIZE(__pyx_args), "em") < 0)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 42; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-    }
-    __pyx_v_Y = ((PyArrayObject *)values[0]);
-    __pyx_v_VY = ((PyArrayObject *)values[1]);
-    __pyx_v_X = ((PyArrayObject *)values[2]);
-    if (values[3]) {
-      __pyx_v_C = ((PyArrayObject *)values[3]);
-    }
-    if (values[4]) {
-      __pyx_v_axis = __pyx_PyInt_int(values[4]); if (unlikely((__pyx_v_axis == (int)-1) && PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 42; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-    }
-    if (values[5]) {
-      __pyx_v_niter = __pyx_PyInt_int(values[5]); if (unlikely((__pyx_v_niter == (int)-1) && PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 42; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-    }
-  } else {
-    switch (PyTuple_GET_SIZE(__pyx_args)) {
-      case  6:
-      __pyx_v_niter = __pyx_PyInt_int(PyTuple_GET_ITEM(__pyx_args, 5)); if (unlikely((__pyx_v_niter == (int)-1) && PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 42; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-      case  5:
-      __pyx_v_axis = __pyx_PyInt_int(PyTuple_GET_ITEM(__pyx_args, 4)); if (unlikely((__pyx_v_axis == (int)-1) && PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 42; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-      case  4:
-      __pyx_v_C = ((PyArrayObject *)PyTuple_GET_ITEM(__pyx_args, 3));
-      case  3:
-      __pyx_v_X = ((PyArrayObject *)PyTuple_GET_ITEM(__pyx_args, 2));
-      __pyx_v_VY = ((PyArrayObject *)PyTuple_GET_ITEM(__pyx_args, 1));
-      __pyx_v_Y = ((PyArrayObject *)PyTuple_GET_ITEM(__pyx_args, 0));
-      break;
-      default: goto __pyx_L5_argtuple_error;
-    }
-  }
-  goto __pyx_L4_argument_unpacking_done;
-  __pyx_L5_argtuple_error:;
-  __Pyx_RaiseArgtupleInvalid("em", 0, 3, 6, PyTuple_GET_SIZE(__pyx_args)); {__pyx_filename = __pyx_f[0]; __pyx_lineno = 42; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-  __pyx_L3_error:;
-  __Pyx_AddTraceback("fff2.group.glm_twolevel.em");
-  return NULL;
-  __pyx_L4_argument_unpacking_done:;
-  __pyx_v_PpX = Py_None; Py_INCREF(Py_None);
-  __pyx_v_A = Py_None; Py_INCREF(Py_None);
-  __pyx_v_B = Py_None; Py_INCREF(Py_None);
-  __pyx_v_P = Py_None; Py_INCREF(Py_None);
-  __pyx_v_dims = Py_None; Py_INCREF(Py_None);
-  __pyx_v_S2 = Py_None; Py_INCREF(Py_None);
-  if (unlikely(!__Pyx_ArgTypeTest(((PyObject *)__pyx_v_Y), __pyx_ptype_4fff2_5group_12glm_twolevel_ndarray, 1, "Y", 0))) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 42; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  if (unlikely(!__Pyx_ArgTypeTest(((PyObject *)__pyx_v_VY), __pyx_ptype_4fff2_5group_12glm_twolevel_ndarray, 1, "VY", 0))) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 42; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  if (unlikely(!__Pyx_ArgTypeTest(((PyObject *)__pyx_v_X), __pyx_ptype_4fff2_5group_12glm_twolevel_ndarray, 1, "X", 0))) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 42; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  if (unlikely(!__Pyx_ArgTypeTest(((PyObject *)__pyx_v_C), __pyx_ptype_4fff2_5group_12glm_twolevel_ndarray, 1, "C", 0))) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 42; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-
-  /* "d:\home\ar203069\bzr\nipy\fff2\fff2\group\glm_twolevel.pyx":66
- * 
- * 	# View on design matrix
- * 	x = fff_matrix_fromPyArray(X)             # <<<<<<<<<<<<<<
- * 
- * 	# Number of observations / regressors
- */
-  __pyx_v_x = fff_matrix_fromPyArray(__pyx_v_X);
-
-  /* "d:\home\ar203069\bzr\nipy\fff2\fff2\group\glm_twolevel.pyx":69
- * 
- * 	# Number of observations / regressors
- * 	n = x.size1             # <<<<<<<<<<<<<<
- * 	p = x.size2
- * 
- */
-  __pyx_v_n = __pyx_v_x->size1;
-
-  /* "d:\home\ar203069\bzr\nipy\fff2\fff2\group\glm_twolevel.pyx":70
- * 	# Number of observations / regressors
- * 	n = x.size1
- * 	p = x.size2             # <<<<<<<<<<<<<<
- * 
- * 	# Compute the projected pseudo-inverse matrix
- */
-  __pyx_v_p = __pyx_v_x->size2;
-
-  /* "d:\home\ar203069\bzr\nipy\fff2\fff2\group\glm_twolevel.pyx":73
- * 
- * 	# Compute the projected pseudo-inverse matrix
- * 	if C == None:             # <<<<<<<<<<<<<<
- * 		PpX =  np.linalg.pinv(X)
- * 	else:
- */
-  __pyx_1 = PyObject_RichCompare(((PyObject *)__pyx_v_C), Py_None, Py_EQ); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 73; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __pyx_2 = __Pyx_PyObject_IsTrue(__pyx_1); if (unlikely(__pyx_2 < 0)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 73; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_DECREF(__pyx_1); __pyx_1 = 0;
-  if (__pyx_2) {
-
-    /* "d:\home\ar203069\bzr\nipy\fff2\fff2\group\glm_twolevel.pyx":74
- * 	# Compute the projected pseudo-inverse matrix
- * 	if C == None:
- * 		PpX =  np.linalg.pinv(X)             # <<<<<<<<<<<<<<
- * 	else:
- * 		A = np.linalg.inv(np.dot(X.transpose(), X)) # (p,p)
- */
-    __pyx_1 = __Pyx_GetName(__pyx_m, __pyx_kp_np); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 74; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __pyx_3 = PyObject_GetAttr(__pyx_1, __pyx_kp_linalg); if (unlikely(!__pyx_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 74; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_DECREF(__pyx_1); __pyx_1 = 0;
-    __pyx_1 = PyObject_GetAttr(__pyx_3, __pyx_kp_pinv); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 74; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_DECREF(__pyx_3); __pyx_3 = 0;
-    __pyx_3 = PyTuple_New(1); if (unlikely(!__pyx_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 74; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_INCREF(((PyObject *)__pyx_v_X));
-    PyTuple_SET_ITEM(__pyx_3, 0, ((PyObject *)__pyx_v_X));
-    __pyx_4 = PyObject_Call(__pyx_1, ((PyObject *)__pyx_3), NULL); if (unlikely(!__pyx_4)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 74; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_DECREF(__pyx_1); __pyx_1 = 0;
-    Py_DECREF(((PyObject *)__pyx_3)); __pyx_3 = 0;
-    Py_DECREF(__pyx_v_PpX);
-    __pyx_v_PpX = __pyx_4;
-    __pyx_4 = 0;
-    goto __pyx_L6;
-  }
-  /*else*/ {
-
-    /* "d:\home\ar203069\bzr\nipy\fff2\fff2\group\glm_twolevel.pyx":76
- * 		PpX =  np.linalg.pinv(X)
- * 	else:
- * 		A = np.linalg.inv(np.dot(X.transpose(), X)) # (p,p)             # <<<<<<<<<<<<<<
- * 		B = np.linalg.inv(np.dot(np.dot(C.transpose(), A), C)) # (q,q)
- * 		P = np.eye(p) - np.dot(np.dot(np.dot(A, C), B), C.transpose()) # (p,p)
- */
-    __pyx_1 = __Pyx_GetName(__pyx_m, __pyx_kp_np); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 76; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __pyx_3 = PyObject_GetAttr(__pyx_1, __pyx_kp_linalg); if (unlikely(!__pyx_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 76; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_DECREF(__pyx_1); __pyx_1 = 0;
-    __pyx_4 = PyObject_GetAttr(__pyx_3, __pyx_kp_inv); if (unlikely(!__pyx_4)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 76; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_DECREF(__pyx_3); __pyx_3 = 0;
-    __pyx_1 = __Pyx_GetName(__pyx_m, __pyx_kp_np); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 76; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __pyx_3 = PyObject_GetAttr(__pyx_1, __pyx_kp_dot); if (unlikely(!__pyx_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 76; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_DECREF(__pyx_1); __pyx_1 = 0;
-    __pyx_1 = PyObject_GetAttr(((PyObject *)__pyx_v_X), __pyx_kp_transpose); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 76; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __pyx_5 = PyObject_Call(__pyx_1, ((PyObject *)__pyx_empty_tuple), NULL); if (unlikely(!__pyx_5)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 76; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_DECREF(__pyx_1); __pyx_1 = 0;
-    __pyx_1 = PyTuple_New(2); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 76; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    PyTuple_SET_ITEM(__pyx_1, 0, __pyx_5);
-    Py_INCREF(((PyObject *)__pyx_v_X));
-    PyTuple_SET_ITEM(__pyx_1, 1, ((PyObject *)__pyx_v_X));
-    __pyx_5 = 0;
-    __pyx_5 = PyObject_Call(__pyx_3, ((PyObject *)__pyx_1), NULL); if (unlikely(!__pyx_5)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 76; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_DECREF(__pyx_3); __pyx_3 = 0;
-    Py_DECREF(((PyObject *)__pyx_1)); __pyx_1 = 0;
-    __pyx_3 = PyTuple_New(1); if (unlikely(!__pyx_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 76; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    PyTuple_SET_ITEM(__pyx_3, 0, __pyx_5);
-    __pyx_5 = 0;
-    __pyx_1 = PyObject_Call(__pyx_4, ((PyObject *)__pyx_3), NULL); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 76; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_DECREF(__pyx_4); __pyx_4 = 0;
-    Py_DECREF(((PyObject *)__pyx_3)); __pyx_3 = 0;
-    Py_DECREF(__pyx_v_A);
-    __pyx_v_A = __pyx_1;
-    __pyx_1 = 0;
-
-    /* "d:\home\ar203069\bzr\nipy\fff2\fff2\group\glm_twolevel.pyx":77
- * 	else:
- * 		A = np.linalg.inv(np.dot(X.transpose(), X)) # (p,p)
- * 		B = np.linalg.inv(np.dot(np.dot(C.transpose(), A), C)) # (q,q)             # <<<<<<<<<<<<<<
- * 		P = np.eye(p) - np.dot(np.dot(np.dot(A, C), B), C.transpose()) # (p,p)
- * 		PpX = np.dot(np.dot(P, A), X.transpose()) # (p,n)
- */
-    __pyx_5 = __Pyx_GetName(__pyx_m, __pyx_kp_np); if (unlikely(!__pyx_5)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 77; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __pyx_4 = PyObject_GetAttr(__pyx_5, __pyx_kp_linalg); if (unlikely(!__pyx_4)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 77; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_DECREF(__pyx_5); __pyx_5 = 0;
-    __pyx_3 = PyObject_GetAttr(__pyx_4, __pyx_kp_inv); if (unlikely(!__pyx_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 77; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_DECREF(__pyx_4); __pyx_4 = 0;
-    __pyx_1 = __Pyx_GetName(__pyx_m, __pyx_kp_np); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 77; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __pyx_5 = PyObject_GetAttr(__pyx_1, __pyx_kp_dot); if (unlikely(!__pyx_5)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 77; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_DECREF(__pyx_1); __pyx_1 = 0;
-    __pyx_4 = __Pyx_GetName(__pyx_m, __pyx_kp_np); if (unlikely(!__pyx_4)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 77; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __pyx_1 = PyObject_GetAttr(__pyx_4, __pyx_kp_dot); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 77; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_DECREF(__pyx_4); __pyx_4 = 0;
-    __pyx_4 = PyObject_GetAttr(((PyObject *)__pyx_v_C), __pyx_kp_transpose); if (unlikely(!__pyx_4)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 77; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __pyx_6 = PyObject_Call(__pyx_4, ((PyObject *)__pyx_empty_tuple), NULL); if (unlikely(!__pyx_6)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 77; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_DECREF(__pyx_4); __pyx_4 = 0;
-    __pyx_4 = PyTuple_New(2); if (unlikely(!__pyx_4)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 77; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    PyTuple_SET_ITEM(__pyx_4, 0, __pyx_6);
-    Py_INCREF(__pyx_v_A);
-    PyTuple_SET_ITEM(__pyx_4, 1, __pyx_v_A);
-    __pyx_6 = 0;
-    __pyx_6 = PyObject_Call(__pyx_1, ((PyObject *)__pyx_4), NULL); if (unlikely(!__pyx_6)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 77; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_DECREF(__pyx_1); __pyx_1 = 0;
-    Py_DECREF(((PyObject *)__pyx_4)); __pyx_4 = 0;
-    __pyx_1 = PyTuple_New(2); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 77; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    PyTuple_SET_ITEM(__pyx_1, 0, __pyx_6);
-    Py_INCREF(((PyObject *)__pyx_v_C));
-    PyTuple_SET_ITEM(__pyx_1, 1, ((PyObject *)__pyx_v_C));
-    __pyx_6 = 0;
-    __pyx_4 = PyObject_Call(__pyx_5, ((PyObject *)__pyx_1), NULL); if (unlikely(!__pyx_4)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 77; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_DECREF(__pyx_5); __pyx_5 = 0;
-    Py_DECREF(((PyObject *)__pyx_1)); __pyx_1 = 0;
-    __pyx_6 = PyTuple_New(1); if (unlikely(!__pyx_6)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 77; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    PyTuple_SET_ITEM(__pyx_6, 0, __pyx_4);
-    __pyx_4 = 0;
-    __pyx_5 = PyObject_Call(__pyx_3, ((PyObject *)__pyx_6), NULL); if (unlikely(!__pyx_5)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 77; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_DECREF(__pyx_3); __pyx_3 = 0;
-    Py_DECREF(((PyObject *)__pyx_6)); __pyx_6 = 0;
-    Py_DECREF(__pyx_v_B);
-    __pyx_v_B = __pyx_5;
-    __pyx_5 = 0;
-
-    /* "d:\home\ar203069\bzr\nipy\fff2\fff2\group\glm_twolevel.pyx":78
- * 		A = np.linalg.inv(np.dot(X.transpose(), X)) # (p,p)
- * 		B = np.linalg.inv(np.dot(np.dot(C.transpose(), A), C)) # (q,q)
- * 		P = np.eye(p) - np.dot(np.dot(np.dot(A, C), B), C.transpose()) # (p,p)             # <<<<<<<<<<<<<<
- * 		PpX = np.dot(np.dot(P, A), X.transpose()) # (p,n)
- * 	ppx = fff_matrix_fromPyArray(PpX)
- */
-    __pyx_1 = __Pyx_GetName(__pyx_m, __pyx_kp_np); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 78; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __pyx_4 = PyObject_GetAttr(__pyx_1, __pyx_kp_eye); if (unlikely(!__pyx_4)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 78; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_DECREF(__pyx_1); __pyx_1 = 0;
-    __pyx_3 = PyLong_FromUnsignedLong(__pyx_v_p); if (unlikely(!__pyx_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 78; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __pyx_6 = PyTuple_New(1); if (unlikely(!__pyx_6)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 78; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    PyTuple_SET_ITEM(__pyx_6, 0, __pyx_3);
-    __pyx_3 = 0;
-    __pyx_5 = PyObject_Call(__pyx_4, ((PyObject *)__pyx_6), NULL); if (unlikely(!__pyx_5)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 78; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_DECREF(__pyx_4); __pyx_4 = 0;
-    Py_DECREF(((PyObject *)__pyx_6)); __pyx_6 = 0;
-    __pyx_1 = __Pyx_GetName(__pyx_m, __pyx_kp_np); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 78; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __pyx_3 = PyObject_GetAttr(__pyx_1, __pyx_kp_dot); if (unlikely(!__pyx_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 78; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_DECREF(__pyx_1); __pyx_1 = 0;
-    __pyx_4 = __Pyx_GetName(__pyx_m, __pyx_kp_np); if (unlikely(!__pyx_4)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 78; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __pyx_6 = PyObject_GetAttr(__pyx_4, __pyx_kp_dot); if (unlikely(!__pyx_6)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 78; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_DECREF(__pyx_4); __pyx_4 = 0;
-    __pyx_1 = __Pyx_GetName(__pyx_m, __pyx_kp_np); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 78; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __pyx_4 = PyObject_GetAttr(__pyx_1, __pyx_kp_dot); if (unlikely(!__pyx_4)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 78; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_DECREF(__pyx_1); __pyx_1 = 0;
-    __pyx_1 = PyTuple_New(2); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 78; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_INCREF(__pyx_v_A);
-    PyTuple_SET_ITEM(__pyx_1, 0, __pyx_v_A);
-    Py_INCREF(((PyObject *)__pyx_v_C));
-    PyTuple_SET_ITEM(__pyx_1, 1, ((PyObject *)__pyx_v_C));
-    __pyx_7 = PyObject_Call(__pyx_4, ((PyObject *)__pyx_1), NULL); if (unlikely(!__pyx_7)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 78; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_DECREF(__pyx_4); __pyx_4 = 0;
-    Py_DECREF(((PyObject *)__pyx_1)); __pyx_1 = 0;
-    __pyx_4 = PyTuple_New(2); if (unlikely(!__pyx_4)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 78; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    PyTuple_SET_ITEM(__pyx_4, 0, __pyx_7);
-    Py_INCREF(__pyx_v_B);
-    PyTuple_SET_ITEM(__pyx_4, 1, __pyx_v_B);
-    __pyx_7 = 0;
-    __pyx_1 = PyObject_Call(__pyx_6, ((PyObject *)__pyx_4), NULL); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 78; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_DECREF(__pyx_6); __pyx_6 = 0;
-    Py_DECREF(((PyObject *)__pyx_4)); __pyx_4 = 0;
-    __pyx_7 = PyObject_GetAttr(((PyObject *)__pyx_v_C), __pyx_kp_transpose); if (unlikely(!__pyx_7)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 78; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __pyx_6 = PyObject_Call(__pyx_7, ((PyObject *)__pyx_empty_tuple), NULL); if (unlikely(!__pyx_6)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 78; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_DECREF(__pyx_7); __pyx_7 = 0;
-    __pyx_4 = PyTuple_New(2); if (unlikely(!__pyx_4)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 78; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    PyTuple_SET_ITEM(__pyx_4, 0, __pyx_1);
-    PyTuple_SET_ITEM(__pyx_4, 1, __pyx_6);
-    __pyx_1 = 0;
-    __pyx_6 = 0;
-    __pyx_7 = PyObject_Call(__pyx_3, ((PyObject *)__pyx_4), NULL); if (unlikely(!__pyx_7)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 78; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_DECREF(__pyx_3); __pyx_3 = 0;
-    Py_DECREF(((PyObject *)__pyx_4)); __pyx_4 = 0;
-    __pyx_t_1 = PyNumber_Subtract(__pyx_5, __pyx_7); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 78; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_DECREF(__pyx_5); __pyx_5 = 0;
-    Py_DECREF(__pyx_7); __pyx_7 = 0;
-    Py_DECREF(__pyx_v_P);
-    __pyx_v_P = __pyx_t_1;
-    __pyx_t_1 = 0;
-
-    /* "d:\home\ar203069\bzr\nipy\fff2\fff2\group\glm_twolevel.pyx":79
- * 		B = np.linalg.inv(np.dot(np.dot(C.transpose(), A), C)) # (q,q)
- * 		P = np.eye(p) - np.dot(np.dot(np.dot(A, C), B), C.transpose()) # (p,p)
- * 		PpX = np.dot(np.dot(P, A), X.transpose()) # (p,n)             # <<<<<<<<<<<<<<
- * 	ppx = fff_matrix_fromPyArray(PpX)
- * 
- */
-    __pyx_1 = __Pyx_GetName(__pyx_m, __pyx_kp_np); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 79; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __pyx_6 = PyObject_GetAttr(__pyx_1, __pyx_kp_dot); if (unlikely(!__pyx_6)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 79; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_DECREF(__pyx_1); __pyx_1 = 0;
-    __pyx_3 = __Pyx_GetName(__pyx_m, __pyx_kp_np); if (unlikely(!__pyx_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 79; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __pyx_4 = PyObject_GetAttr(__pyx_3, __pyx_kp_dot); if (unlikely(!__pyx_4)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 79; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_DECREF(__pyx_3); __pyx_3 = 0;
-    __pyx_5 = PyTuple_New(2); if (unlikely(!__pyx_5)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 79; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_INCREF(__pyx_v_P);
-    PyTuple_SET_ITEM(__pyx_5, 0, __pyx_v_P);
-    Py_INCREF(__pyx_v_A);
-    PyTuple_SET_ITEM(__pyx_5, 1, __pyx_v_A);
-    __pyx_7 = PyObject_Call(__pyx_4, ((PyObject *)__pyx_5), NULL); if (unlikely(!__pyx_7)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 79; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_DECREF(__pyx_4); __pyx_4 = 0;
-    Py_DECREF(((PyObject *)__pyx_5)); __pyx_5 = 0;
-    __pyx_1 = PyObject_GetAttr(((PyObject *)__pyx_v_X), __pyx_kp_transpose); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 79; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __pyx_3 = PyObject_Call(__pyx_1, ((PyObject *)__pyx_empty_tuple), NULL); if (unlikely(!__pyx_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 79; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_DECREF(__pyx_1); __pyx_1 = 0;
-    __pyx_4 = PyTuple_New(2); if (unlikely(!__pyx_4)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 79; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    PyTuple_SET_ITEM(__pyx_4, 0, __pyx_7);
-    PyTuple_SET_ITEM(__pyx_4, 1, __pyx_3);
-    __pyx_7 = 0;
-    __pyx_3 = 0;
-    __pyx_5 = PyObject_Call(__pyx_6, ((PyObject *)__pyx_4), NULL); if (unlikely(!__pyx_5)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 79; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_DECREF(__pyx_6); __pyx_6 = 0;
-    Py_DECREF(((PyObject *)__pyx_4)); __pyx_4 = 0;
-    Py_DECREF(__pyx_v_PpX);
-    __pyx_v_PpX = __pyx_5;
-    __pyx_5 = 0;
-  }
-  __pyx_L6:;
-
-  /* "d:\home\ar203069\bzr\nipy\fff2\fff2\group\glm_twolevel.pyx":80
- * 		P = np.eye(p) - np.dot(np.dot(np.dot(A, C), B), C.transpose()) # (p,p)
- * 		PpX = np.dot(np.dot(P, A), X.transpose()) # (p,n)
- * 	ppx = fff_matrix_fromPyArray(PpX)             # <<<<<<<<<<<<<<
- * 
- * 	# Allocate output arrays
- */
-  if (!(__Pyx_TypeTest(__pyx_v_PpX, __pyx_ptype_4fff2_5group_12glm_twolevel_ndarray))) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 80; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __pyx_v_ppx = fff_matrix_fromPyArray(((PyArrayObject *)__pyx_v_PpX));
-
-  /* "d:\home\ar203069\bzr\nipy\fff2\fff2\group\glm_twolevel.pyx":83
- * 
- * 	# Allocate output arrays
- * 	dims = list(Y.shape)             # <<<<<<<<<<<<<<
- * 	dims[axis] = p
- * 	B = np.zeros(dims)
- */
-  __pyx_1 = PyObject_GetAttr(((PyObject *)__pyx_v_Y), __pyx_kp_shape); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 83; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __pyx_7 = PyTuple_New(1); if (unlikely(!__pyx_7)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 83; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  PyTuple_SET_ITEM(__pyx_7, 0, __pyx_1);
-  __pyx_1 = 0;
-  __pyx_3 = PyObject_Call(((PyObject *)((PyObject*)&PyList_Type)), ((PyObject *)__pyx_7), NULL); if (unlikely(!__pyx_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 83; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_DECREF(((PyObject *)__pyx_7)); __pyx_7 = 0;
-  Py_DECREF(__pyx_v_dims);
-  __pyx_v_dims = __pyx_3;
-  __pyx_3 = 0;
-
-  /* "d:\home\ar203069\bzr\nipy\fff2\fff2\group\glm_twolevel.pyx":84
- * 	# Allocate output arrays
- * 	dims = list(Y.shape)
- * 	dims[axis] = p             # <<<<<<<<<<<<<<
- * 	B = np.zeros(dims)
- * 	dims[axis] = 1
- */
-  __pyx_6 = PyLong_FromUnsignedLong(__pyx_v_p); if (unlikely(!__pyx_6)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 84; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  if (__Pyx_SetItemInt(__pyx_v_dims, __pyx_v_axis, __pyx_6, 0) < 0) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 84; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_DECREF(__pyx_6); __pyx_6 = 0;
-
-  /* "d:\home\ar203069\bzr\nipy\fff2\fff2\group\glm_twolevel.pyx":85
- * 	dims = list(Y.shape)
- * 	dims[axis] = p
- * 	B = np.zeros(dims)             # <<<<<<<<<<<<<<
- * 	dims[axis] = 1
- * 	S2 = np.zeros(dims)
- */
-  __pyx_4 = __Pyx_GetName(__pyx_m, __pyx_kp_np); if (unlikely(!__pyx_4)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 85; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __pyx_5 = PyObject_GetAttr(__pyx_4, __pyx_kp_zeros); if (unlikely(!__pyx_5)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 85; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_DECREF(__pyx_4); __pyx_4 = 0;
-  __pyx_1 = PyTuple_New(1); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 85; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_INCREF(__pyx_v_dims);
-  PyTuple_SET_ITEM(__pyx_1, 0, __pyx_v_dims);
-  __pyx_7 = PyObject_Call(__pyx_5, ((PyObject *)__pyx_1), NULL); if (unlikely(!__pyx_7)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 85; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_DECREF(__pyx_5); __pyx_5 = 0;
-  Py_DECREF(((PyObject *)__pyx_1)); __pyx_1 = 0;
-  Py_DECREF(__pyx_v_B);
-  __pyx_v_B = __pyx_7;
-  __pyx_7 = 0;
-
-  /* "d:\home\ar203069\bzr\nipy\fff2\fff2\group\glm_twolevel.pyx":86
- * 	dims[axis] = p
- * 	B = np.zeros(dims)
- * 	dims[axis] = 1             # <<<<<<<<<<<<<<
- * 	S2 = np.zeros(dims)
- * 
- */
-  if (__Pyx_SetItemInt(__pyx_v_dims, __pyx_v_axis, __pyx_int_1, 0) < 0) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 86; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-
-  /* "d:\home\ar203069\bzr\nipy\fff2\fff2\group\glm_twolevel.pyx":87
- * 	B = np.zeros(dims)
- * 	dims[axis] = 1
- * 	S2 = np.zeros(dims)             # <<<<<<<<<<<<<<
- * 
- * 	# Local structs
- */
-  __pyx_3 = __Pyx_GetName(__pyx_m, __pyx_kp_np); if (unlikely(!__pyx_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 87; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __pyx_6 = PyObject_GetAttr(__pyx_3, __pyx_kp_zeros); if (unlikely(!__pyx_6)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 87; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_DECREF(__pyx_3); __pyx_3 = 0;
-  __pyx_4 = PyTuple_New(1); if (unlikely(!__pyx_4)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 87; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_INCREF(__pyx_v_dims);
-  PyTuple_SET_ITEM(__pyx_4, 0, __pyx_v_dims);
-  __pyx_5 = PyObject_Call(__pyx_6, ((PyObject *)__pyx_4), NULL); if (unlikely(!__pyx_5)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 87; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_DECREF(__pyx_6); __pyx_6 = 0;
-  Py_DECREF(((PyObject *)__pyx_4)); __pyx_4 = 0;
-  Py_DECREF(__pyx_v_S2);
-  __pyx_v_S2 = __pyx_5;
-  __pyx_5 = 0;
-
-  /* "d:\home\ar203069\bzr\nipy\fff2\fff2\group\glm_twolevel.pyx":90
- * 
- * 	# Local structs
- * 	em = fff_glm_twolevel_EM_new(n, p)             # <<<<<<<<<<<<<<
- * 
- * 	# Create a new array iterator
- */
-  __pyx_v_em = fff_glm_twolevel_EM_new(__pyx_v_n, __pyx_v_p);
-
-  /* "d:\home\ar203069\bzr\nipy\fff2\fff2\group\glm_twolevel.pyx":94
- * 	# Create a new array iterator
- * 	multi = fffpy_multi_iterator_new(4, axis, <void*>Y, <void*>VY,
- * 					 <void*>B, <void*>S2)             # <<<<<<<<<<<<<<
- * 
- * 	# Create views
- */
-  __pyx_v_multi = fffpy_multi_iterator_new(4, __pyx_v_axis, ((void *)__pyx_v_Y), ((void *)__pyx_v_VY), ((void *)__pyx_v_B), ((void *)__pyx_v_S2));
-
-  /* "d:\home\ar203069\bzr\nipy\fff2\fff2\group\glm_twolevel.pyx":97
- * 
- * 	# Create views
- * 	y = multi.vector[0]             # <<<<<<<<<<<<<<
- * 	vy = multi.vector[1]
- * 	b = multi.vector[2]
- */
-  __pyx_v_y = (__pyx_v_multi->vector[0]);
-
-  /* "d:\home\ar203069\bzr\nipy\fff2\fff2\group\glm_twolevel.pyx":98
- * 	# Create views
- * 	y = multi.vector[0]
- * 	vy = multi.vector[1]             # <<<<<<<<<<<<<<
- * 	b = multi.vector[2]
- * 	s2 = multi.vector[3]
- */
-  __pyx_v_vy = (__pyx_v_multi->vector[1]);
-
-  /* "d:\home\ar203069\bzr\nipy\fff2\fff2\group\glm_twolevel.pyx":99
- * 	y = multi.vector[0]
- * 	vy = multi.vector[1]
- * 	b = multi.vector[2]             # <<<<<<<<<<<<<<
- * 	s2 = multi.vector[3]
- * 
- */
-  __pyx_v_b = (__pyx_v_multi->vector[2]);
-
-  /* "d:\home\ar203069\bzr\nipy\fff2\fff2\group\glm_twolevel.pyx":100
- * 	vy = multi.vector[1]
- * 	b = multi.vector[2]
- * 	s2 = multi.vector[3]             # <<<<<<<<<<<<<<
- * 
- *         # Loop
- */
-  __pyx_v_s2 = (__pyx_v_multi->vector[3]);
-
-  /* "d:\home\ar203069\bzr\nipy\fff2\fff2\group\glm_twolevel.pyx":103
- * 
- *         # Loop
- * 	while(multi.index < multi.size):             # <<<<<<<<<<<<<<
- * 		fff_glm_twolevel_EM_init(em)
- * 		fff_glm_twolevel_EM_run(em, y, vy, x, ppx, niter)
- */
-  while (1) {
-    __pyx_2 = (__pyx_v_multi->index < __pyx_v_multi->size);
-    if (!__pyx_2) break;
-
-    /* "d:\home\ar203069\bzr\nipy\fff2\fff2\group\glm_twolevel.pyx":104
- *         # Loop
- * 	while(multi.index < multi.size):
- * 		fff_glm_twolevel_EM_init(em)             # <<<<<<<<<<<<<<
- * 		fff_glm_twolevel_EM_run(em, y, vy, x, ppx, niter)
- * 		fff_vector_memcpy(b, em.b)
- */
-    fff_glm_twolevel_EM_init(__pyx_v_em);
-
-    /* "d:\home\ar203069\bzr\nipy\fff2\fff2\group\glm_twolevel.pyx":105
- * 	while(multi.index < multi.size):
- * 		fff_glm_twolevel_EM_init(em)
- * 		fff_glm_twolevel_EM_run(em, y, vy, x, ppx, niter)             # <<<<<<<<<<<<<<
- * 		fff_vector_memcpy(b, em.b)
- * 		s2.data[0] = em.s2
- */
-    fff_glm_twolevel_EM_run(__pyx_v_em, __pyx_v_y, __pyx_v_vy, __pyx_v_x, __pyx_v_ppx, __pyx_v_niter);
-
-    /* "d:\home\ar203069\bzr\nipy\fff2\fff2\group\glm_twolevel.pyx":106
- * 		fff_glm_twolevel_EM_init(em)
- * 		fff_glm_twolevel_EM_run(em, y, vy, x, ppx, niter)
- * 		fff_vector_memcpy(b, em.b)             # <<<<<<<<<<<<<<
- * 		s2.data[0] = em.s2
- * 		fffpy_multi_iterator_update(multi)
- */
-    fff_vector_memcpy(__pyx_v_b, __pyx_v_em->b);
-
-    /* "d:\home\ar203069\bzr\nipy\fff2\fff2\group\glm_twolevel.pyx":107
- * 		fff_glm_twolevel_EM_run(em, y, vy, x, ppx, niter)
- * 		fff_vector_memcpy(b, em.b)
- * 		s2.data[0] = em.s2             # <<<<<<<<<<<<<<
- * 		fffpy_multi_iterator_update(multi)
- * 
- */
-    (__pyx_v_s2->data[0]) = __pyx_v_em->s2;
-
-    /* "d:\home\ar203069\bzr\nipy\fff2\fff2\group\glm_twolevel.pyx":108
- * 		fff_vector_memcpy(b, em.b)
- * 		s2.data[0] = em.s2
- * 		fffpy_multi_iterator_update(multi)             # <<<<<<<<<<<<<<
- * 
- * 	# Free memory
- */
-    fffpy_multi_iterator_update(__pyx_v_multi);
-  }
-
-  /* "d:\home\ar203069\bzr\nipy\fff2\fff2\group\glm_twolevel.pyx":111
- * 
- * 	# Free memory
- * 	fff_matrix_delete(x)             # <<<<<<<<<<<<<<
- * 	fff_matrix_delete(ppx)
- * 	fffpy_multi_iterator_delete(multi)
- */
-  fff_matrix_delete(__pyx_v_x);
-
-  /* "d:\home\ar203069\bzr\nipy\fff2\fff2\group\glm_twolevel.pyx":112
- * 	# Free memory
- * 	fff_matrix_delete(x)
- * 	fff_matrix_delete(ppx)             # <<<<<<<<<<<<<<
- * 	fffpy_multi_iterator_delete(multi)
- * 	fff_glm_twolevel_EM_delete(em)
- */
-  fff_matrix_delete(__pyx_v_ppx);
-
-  /* "d:\home\ar203069\bzr\nipy\fff2\fff2\group\glm_twolevel.pyx":113
- * 	fff_matrix_delete(x)
- * 	fff_matrix_delete(ppx)
- * 	fffpy_multi_iterator_delete(multi)             # <<<<<<<<<<<<<<
- * 	fff_glm_twolevel_EM_delete(em)
- * 
- */
-  fffpy_multi_iterator_delete(__pyx_v_multi);
-
-  /* "d:\home\ar203069\bzr\nipy\fff2\fff2\group\glm_twolevel.pyx":114
- * 	fff_matrix_delete(ppx)
- * 	fffpy_multi_iterator_delete(multi)
- * 	fff_glm_twolevel_EM_delete(em)             # <<<<<<<<<<<<<<
- * 
- * 	# Return
- */
-  fff_glm_twolevel_EM_delete(__pyx_v_em);
-
-  /* "d:\home\ar203069\bzr\nipy\fff2\fff2\group\glm_twolevel.pyx":117
- * 
- * 	# Return
- * 	return B, S2             # <<<<<<<<<<<<<<
- * 
- * 
- */
-  __pyx_1 = PyTuple_New(2); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 117; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_INCREF(__pyx_v_B);
-  PyTuple_SET_ITEM(__pyx_1, 0, __pyx_v_B);
-  Py_INCREF(__pyx_v_S2);
-  PyTuple_SET_ITEM(__pyx_1, 1, __pyx_v_S2);
-  __pyx_r = ((PyObject *)__pyx_1);
-  __pyx_1 = 0;
-  goto __pyx_L0;
-
-  __pyx_r = Py_None; Py_INCREF(Py_None);
-  goto __pyx_L0;
-  __pyx_L1_error:;
-  Py_XDECREF(__pyx_1);
-  Py_XDECREF(__pyx_3);
-  Py_XDECREF(__pyx_4);
-  Py_XDECREF(__pyx_5);
-  Py_XDECREF(__pyx_6);
-  Py_XDECREF(__pyx_7);
-  __Pyx_AddTraceback("fff2.group.glm_twolevel.em");
-  __pyx_r = NULL;
-  __pyx_L0:;
-  Py_DECREF(__pyx_v_PpX);
-  Py_DECREF(__pyx_v_A);
-  Py_DECREF(__pyx_v_B);
-  Py_DECREF(__pyx_v_P);
-  Py_DECREF(__pyx_v_dims);
-  Py_DECREF(__pyx_v_S2);
-  return __pyx_r;
-}
-
-/* "d:\home\ar203069\bzr\nipy\fff2\fff2\group\glm_twolevel.pyx":122
- * 
- * 
- * def log_likelihood(Y, VY, X, B, S2, int axis=0):             # <<<<<<<<<<<<<<
- * 	"""
- * 	ll = log_likelihood(y, vy, X, b, s2, axis=0)
- */
-
-static PyObject *__pyx_pf_4fff2_5group_12glm_twolevel_log_likelihood(PyObject *__pyx_self, PyObject *__pyx_args, PyObject *__pyx_kwds); /*proto*/
-static char __pyx_doc_4fff2_5group_12glm_twolevel_log_likelihood[] = "\n\tll = log_likelihood(y, vy, X, b, s2, axis=0)\n\tLog likelihood in a mixed-effect GLM.\n\tOUTPUT: array\n\tREFERENCE:\n\tKeller and Roche, ISBI 2008.\n\t";
-static PyObject *__pyx_pf_4fff2_5group_12glm_twolevel_log_likelihood(PyObject *__pyx_self, PyObject *__pyx_args, PyObject *__pyx_kwds) {
-  PyObject *__pyx_v_Y = 0;
-  PyObject *__pyx_v_VY = 0;
-  PyObject *__pyx_v_X = 0;
-  PyObject *__pyx_v_B = 0;
-  PyObject *__pyx_v_S2 = 0;
-  int __pyx_v_axis;
-  fff_vector *__pyx_v_y;
-  fff_vector *__pyx_v_vy;
-  fff_vector *__pyx_v_b;
-  fff_vector *__pyx_v_s2;
-  fff_vector *__pyx_v_ll;
-  fff_vector *__pyx_v_tmp;
-  fff_matrix *__pyx_v_x;
-  fffpy_multi_iterator *__pyx_v_multi;
-  PyObject *__pyx_v_dims;
-  PyObject *__pyx_v_LL;
-  PyObject *__pyx_r;
-  PyObject *__pyx_1 = 0;
-  PyObject *__pyx_2 = 0;
-  PyObject *__pyx_3 = 0;
-  int __pyx_4;
-  static PyObject **__pyx_pyargnames[] = {&__pyx_kp_Y,&__pyx_kp_VY,&__pyx_kp_X,&__pyx_kp_B,&__pyx_kp_1,&__pyx_kp_axis,0};
-  __pyx_self = __pyx_self;
-  __pyx_v_axis = 0;
-  if (unlikely(__pyx_kwds)) {
-    PyObject* values[6] = {0,0,0,0,0,0};
-    Py_ssize_t kw_args = PyDict_Size(__pyx_kwds);
-    switch (PyTuple_GET_SIZE(__pyx_args)) {
-      case  6: values[5] = PyTuple_GET_ITEM(__pyx_args, 5);
-      case  5: values[4] = PyTuple_GET_ITEM(__pyx_args, 4);
-      case  4: values[3] = PyTuple_GET_ITEM(__pyx_args, 3);
-      case  3: values[2] = PyTuple_GET_ITEM(__pyx_args, 2);
-      case  2: values[1] = PyTuple_GET_ITEM(__pyx_args, 1);
-      case  1: values[0] = PyTuple_GET_ITEM(__pyx_args, 0);
-      case  0: break;
-      default: goto __pyx_L5_argtuple_error;
-    }
-    switch (PyTuple_GET_SIZE(__pyx_args)) {
-      case  0:
-      values[0] = PyDict_GetItem(__pyx_kwds, __pyx_kp_Y);
-      if (likely(values[0])) kw_args--;
-      else goto __pyx_L5_argtuple_error;
-      case  1:
-      values[1] = PyDict_GetItem(__pyx_kwds, __pyx_kp_VY);
-      if (likely(values[1])) kw_args--;
-      else {
-        __Pyx_RaiseArgtupleInvalid("log_likelihood", 0, 5, 6, 1); {__pyx_filename = __pyx_f[0]; __pyx_lineno = 122; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-      }
-      case  2:
-      values[2] = PyDict_GetItem(__pyx_kwds, __pyx_kp_X);
-      if (likely(values[2])) kw_args--;
-      else {
-        __Pyx_RaiseArgtupleInvalid("log_likelihood", 0, 5, 6, 2); {__pyx_filename = __pyx_f[0]; __pyx_lineno = 122; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-      }
-      case  3:
-      values[3] = PyDict_GetItem(__pyx_kwds, __pyx_kp_B);
-      if (likely(values[3])) kw_args--;
-      else {
-        __Pyx_RaiseArgtupleInvalid("log_likelihood", 0, 5, 6, 3); {__pyx_filename = __pyx_f[0]; __pyx_lineno = 122; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-      }
-      case  4:
-      values[4] = PyDict_GetItem(__pyx_kwds, __pyx_kp_1);
-      if (likely(values[4])) kw_args--;
-      else {
-        __Pyx_RaiseArgtupleInvalid("log_likelihood", 0, 5, 6, 4); {__pyx_filename = __pyx_f[0]; __pyx_lineno = 122; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-      }
-    }
-    if (unlikely(kw_args > 0)) {
-      if (unlikely(__Pyx_ParseOptionalKeywords(__pyx_kwds, __pyx_pyargnames, 0, values, PyTuple_GET_SIZE(__pyx_args), "log_likelihood") < 0)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 122; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-    }
-    __pyx_v_Y = values[0];
-    __pyx_v_VY = values[1];
-    __pyx_v_X = values[2];
-    __pyx_v_B = values[3];
-    __pyx_v_S2 = values[4];
-    if (values[5]) {
-      __pyx_v_axis = __pyx_PyInt_int(values[5]); if (unlikely((__pyx_v_axis == (int)-1) && PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 122; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-    }
-  } else {
-    switch (PyTuple_GET_SIZE(__pyx_args)) {
-      case  6:
-      __pyx_v_axis = __pyx_PyInt_int(PyTuple_GET_ITEM(__pyx_args, 5)); if (unlikely((__pyx_v_axis == (int)-1) && PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 122; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-      case  5:
-      __pyx_v_S2 = PyTuple_GET_ITEM(__pyx_args, 4);
-      __pyx_v_B = PyTuple_GET_ITEM(__pyx_args, 3);
-      __pyx_v_X = PyTuple_GET_ITEM(__pyx_args, 2);
-      __pyx_v_VY = PyTuple_GET_ITEM(__pyx_args, 1);
-      __pyx_v_Y = PyTuple_GET_ITEM(__pyx_args, 0);
-      break;
-      default: goto __pyx_L5_argtuple_error;
-    }
-  }
-  goto __pyx_L4_argument_unpacking_done;
-  __pyx_L5_argtuple_error:;
-  __Pyx_RaiseArgtupleInvalid("log_likelihood", 0, 5, 6, PyTuple_GET_SIZE(__pyx_args)); {__pyx_filename = __pyx_f[0]; __pyx_lineno = 122; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-  __pyx_L3_error:;
-  __Pyx_AddTraceback("fff2.group.glm_twolevel.log_likelihood");
-  return NULL;
-  __pyx_L4_argument_unpacking_done:;
-  __pyx_v_dims = Py_None; Py_INCREF(Py_None);
-  __pyx_v_LL = Py_None; Py_INCREF(Py_None);
-
-  /* "d:\home\ar203069\bzr\nipy\fff2\fff2\group\glm_twolevel.pyx":135
- * 
- * 	# Allocate output array
- * 	dims = list(Y.shape)             # <<<<<<<<<<<<<<
- * 	dims[axis] = 1
- * 	LL = np.zeros(dims)
- */
-  __pyx_1 = PyObject_GetAttr(__pyx_v_Y, __pyx_kp_shape); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 135; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __pyx_2 = PyTuple_New(1); if (unlikely(!__pyx_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 135; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  PyTuple_SET_ITEM(__pyx_2, 0, __pyx_1);
-  __pyx_1 = 0;
-  __pyx_1 = PyObject_Call(((PyObject *)((PyObject*)&PyList_Type)), ((PyObject *)__pyx_2), NULL); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 135; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_DECREF(((PyObject *)__pyx_2)); __pyx_2 = 0;
-  Py_DECREF(__pyx_v_dims);
-  __pyx_v_dims = __pyx_1;
-  __pyx_1 = 0;
-
-  /* "d:\home\ar203069\bzr\nipy\fff2\fff2\group\glm_twolevel.pyx":136
- * 	# Allocate output array
- * 	dims = list(Y.shape)
- * 	dims[axis] = 1             # <<<<<<<<<<<<<<
- * 	LL = np.zeros(dims)
- * 
- */
-  if (__Pyx_SetItemInt(__pyx_v_dims, __pyx_v_axis, __pyx_int_1, 0) < 0) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 136; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-
-  /* "d:\home\ar203069\bzr\nipy\fff2\fff2\group\glm_twolevel.pyx":137
- * 	dims = list(Y.shape)
- * 	dims[axis] = 1
- * 	LL = np.zeros(dims)             # <<<<<<<<<<<<<<
- * 
- * 	# View on design matrix
- */
-  __pyx_2 = __Pyx_GetName(__pyx_m, __pyx_kp_np); if (unlikely(!__pyx_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 137; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __pyx_1 = PyObject_GetAttr(__pyx_2, __pyx_kp_zeros); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 137; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_DECREF(__pyx_2); __pyx_2 = 0;
-  __pyx_2 = PyTuple_New(1); if (unlikely(!__pyx_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 137; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_INCREF(__pyx_v_dims);
-  PyTuple_SET_ITEM(__pyx_2, 0, __pyx_v_dims);
-  __pyx_3 = PyObject_Call(__pyx_1, ((PyObject *)__pyx_2), NULL); if (unlikely(!__pyx_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 137; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_DECREF(__pyx_1); __pyx_1 = 0;
-  Py_DECREF(((PyObject *)__pyx_2)); __pyx_2 = 0;
-  Py_DECREF(__pyx_v_LL);
-  __pyx_v_LL = __pyx_3;
-  __pyx_3 = 0;
-
-  /* "d:\home\ar203069\bzr\nipy\fff2\fff2\group\glm_twolevel.pyx":140
- * 
- * 	# View on design matrix
- * 	x = fff_matrix_fromPyArray(X)             # <<<<<<<<<<<<<<
- * 
- * 	# Local structure
- */
-  if (!(__Pyx_TypeTest(__pyx_v_X, __pyx_ptype_4fff2_5group_12glm_twolevel_ndarray))) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 140; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __pyx_v_x = fff_matrix_fromPyArray(((PyArrayObject *)__pyx_v_X));
-
-  /* "d:\home\ar203069\bzr\nipy\fff2\fff2\group\glm_twolevel.pyx":143
- * 
- * 	# Local structure
- * 	tmp = fff_vector_new(x.size1)             # <<<<<<<<<<<<<<
- * 
- * 	# Multi iterator
- */
-  __pyx_v_tmp = fff_vector_new(__pyx_v_x->size1);
-
-  /* "d:\home\ar203069\bzr\nipy\fff2\fff2\group\glm_twolevel.pyx":147
- * 	# Multi iterator
- * 	multi = fffpy_multi_iterator_new(5, axis, <void*>Y, <void*>VY,
- * 					 <void*>B, <void*>S2, <void*>LL)             # <<<<<<<<<<<<<<
- * 
- * 	# View on iterable arrays
- */
-  __pyx_v_multi = fffpy_multi_iterator_new(5, __pyx_v_axis, ((void *)__pyx_v_Y), ((void *)__pyx_v_VY), ((void *)__pyx_v_B), ((void *)__pyx_v_S2), ((void *)__pyx_v_LL));
-
-  /* "d:\home\ar203069\bzr\nipy\fff2\fff2\group\glm_twolevel.pyx":150
- * 
- * 	# View on iterable arrays
- * 	y = multi.vector[0]             # <<<<<<<<<<<<<<
- * 	vy = multi.vector[1]
- * 	b = multi.vector[2]
- */
-  __pyx_v_y = (__pyx_v_multi->vector[0]);
-
-  /* "d:\home\ar203069\bzr\nipy\fff2\fff2\group\glm_twolevel.pyx":151
- * 	# View on iterable arrays
- * 	y = multi.vector[0]
- * 	vy = multi.vector[1]             # <<<<<<<<<<<<<<
- * 	b = multi.vector[2]
- * 	s2 = multi.vector[3]
- */
-  __pyx_v_vy = (__pyx_v_multi->vector[1]);
-
-  /* "d:\home\ar203069\bzr\nipy\fff2\fff2\group\glm_twolevel.pyx":152
- * 	y = multi.vector[0]
- * 	vy = multi.vector[1]
- * 	b = multi.vector[2]             # <<<<<<<<<<<<<<
- * 	s2 = multi.vector[3]
- * 	ll = multi.vector[4]
- */
-  __pyx_v_b = (__pyx_v_multi->vector[2]);
-
-  /* "d:\home\ar203069\bzr\nipy\fff2\fff2\group\glm_twolevel.pyx":153
- * 	vy = multi.vector[1]
- * 	b = multi.vector[2]
- * 	s2 = multi.vector[3]             # <<<<<<<<<<<<<<
- * 	ll = multi.vector[4]
- * 
- */
-  __pyx_v_s2 = (__pyx_v_multi->vector[3]);
-
-  /* "d:\home\ar203069\bzr\nipy\fff2\fff2\group\glm_twolevel.pyx":154
- * 	b = multi.vector[2]
- * 	s2 = multi.vector[3]
- * 	ll = multi.vector[4]             # <<<<<<<<<<<<<<
- * 
- * 	# Loop
- */
-  __pyx_v_ll = (__pyx_v_multi->vector[4]);
-
-  /* "d:\home\ar203069\bzr\nipy\fff2\fff2\group\glm_twolevel.pyx":157
- * 
- * 	# Loop
- * 	while(multi.index < multi.size):             # <<<<<<<<<<<<<<
- * 		ll.data[0] = fff_glm_twolevel_log_likelihood(y, vy, x, b, s2.data[0], tmp)
- * 		fffpy_multi_iterator_update(multi)
- */
-  while (1) {
-    __pyx_4 = (__pyx_v_multi->index < __pyx_v_multi->size);
-    if (!__pyx_4) break;
-
-    /* "d:\home\ar203069\bzr\nipy\fff2\fff2\group\glm_twolevel.pyx":158
- * 	# Loop
- * 	while(multi.index < multi.size):
- * 		ll.data[0] = fff_glm_twolevel_log_likelihood(y, vy, x, b, s2.data[0], tmp)             # <<<<<<<<<<<<<<
- * 		fffpy_multi_iterator_update(multi)
- * 
- */
-    (__pyx_v_ll->data[0]) = fff_glm_twolevel_log_likelihood(__pyx_v_y, __pyx_v_vy, __pyx_v_x, __pyx_v_b, (__pyx_v_s2->data[0]), __pyx_v_tmp);
-
-    /* "d:\home\ar203069\bzr\nipy\fff2\fff2\group\glm_twolevel.pyx":159
- * 	while(multi.index < multi.size):
- * 		ll.data[0] = fff_glm_twolevel_log_likelihood(y, vy, x, b, s2.data[0], tmp)
- * 		fffpy_multi_iterator_update(multi)             # <<<<<<<<<<<<<<
- * 
- * 	# Free memory
- */
-    fffpy_multi_iterator_update(__pyx_v_multi);
-  }
-
-  /* "d:\home\ar203069\bzr\nipy\fff2\fff2\group\glm_twolevel.pyx":162
- * 
- * 	# Free memory
- * 	fff_matrix_delete(x)             # <<<<<<<<<<<<<<
- * 	fff_vector_delete(tmp)
- * 	fffpy_multi_iterator_delete(multi)
- */
-  fff_matrix_delete(__pyx_v_x);
-
-  /* "d:\home\ar203069\bzr\nipy\fff2\fff2\group\glm_twolevel.pyx":163
- * 	# Free memory
- * 	fff_matrix_delete(x)
- * 	fff_vector_delete(tmp)             # <<<<<<<<<<<<<<
- * 	fffpy_multi_iterator_delete(multi)
- * 
- */
-  fff_vector_delete(__pyx_v_tmp);
-
-  /* "d:\home\ar203069\bzr\nipy\fff2\fff2\group\glm_twolevel.pyx":164
- * 	fff_matrix_delete(x)
- * 	fff_vector_delete(tmp)
- * 	fffpy_multi_iterator_delete(multi)             # <<<<<<<<<<<<<<
- * 
- * 	# Return
- */
-  fffpy_multi_iterator_delete(__pyx_v_multi);
-
-  /* "d:\home\ar203069\bzr\nipy\fff2\fff2\group\glm_twolevel.pyx":167
- * 
- * 	# Return
- * 	return LL             # <<<<<<<<<<<<<<
- * 
- * 
- */
-  Py_INCREF(__pyx_v_LL);
-  __pyx_r = __pyx_v_LL;
-  goto __pyx_L0;
-
-  __pyx_r = Py_None; Py_INCREF(Py_None);
-  goto __pyx_L0;
-  __pyx_L1_error:;
-  Py_XDECREF(__pyx_1);
-  Py_XDECREF(__pyx_2);
-  Py_XDECREF(__pyx_3);
-  __Pyx_AddTraceback("fff2.group.glm_twolevel.log_likelihood");
-  __pyx_r = NULL;
-  __pyx_L0:;
-  Py_DECREF(__pyx_v_dims);
-  Py_DECREF(__pyx_v_LL);
-  return __pyx_r;
-}
-
-/* "d:\home\ar203069\bzr\nipy\fff2\fff2\group\glm_twolevel.pyx":170
- * 
- * 
- * def log_likelihood_ratio(Y, VY, X, C, int axis=0, int niter=DEF_NITER):             # <<<<<<<<<<<<<<
- * 	"""
- * 	lda = em(y, vy, X, C, axis=0, niter=DEF_NITER).
- */
-
-static PyObject *__pyx_pf_4fff2_5group_12glm_twolevel_log_likelihood_ratio(PyObject *__pyx_self, PyObject *__pyx_args, PyObject *__pyx_kwds); /*proto*/
-static char __pyx_doc_4fff2_5group_12glm_twolevel_log_likelihood_ratio[] = "\n\tlda = em(y, vy, X, C, axis=0, niter=DEF_NITER).\n\t";
-static PyObject *__pyx_pf_4fff2_5group_12glm_twolevel_log_likelihood_ratio(PyObject *__pyx_self, PyObject *__pyx_args, PyObject *__pyx_kwds) {
-  PyObject *__pyx_v_Y = 0;
-  PyObject *__pyx_v_VY = 0;
-  PyObject *__pyx_v_X = 0;
-  PyObject *__pyx_v_C = 0;
-  int __pyx_v_axis;
-  int __pyx_v_niter;
-  PyObject *__pyx_v_B;
-  PyObject *__pyx_v_S2;
-  PyObject *__pyx_v_ll0;
-  PyObject *__pyx_v_ll;
-  PyObject *__pyx_v_lda;
-  PyObject *__pyx_r;
-  PyObject *__pyx_1 = 0;
-  PyObject *__pyx_2 = 0;
-  PyObject *__pyx_3 = 0;
-  PyObject *__pyx_4 = 0;
-  PyObject *__pyx_t_1 = NULL;
-  PyObject *__pyx_t_2 = NULL;
-  static PyObject **__pyx_pyargnames[] = {&__pyx_kp_Y,&__pyx_kp_VY,&__pyx_kp_X,&__pyx_kp_C,&__pyx_kp_axis,&__pyx_kp_niter,0};
-  __pyx_self = __pyx_self;
-  __pyx_v_axis = 0;
-  __pyx_v_niter = __pyx_k_4;
-  if (unlikely(__pyx_kwds)) {
-    PyObject* values[6] = {0,0,0,0,0,0};
-    Py_ssize_t kw_args = PyDict_Size(__pyx_kwds);
-    switch (PyTuple_GET_SIZE(__pyx_args)) {
-      case  6: values[5] = PyTuple_GET_ITEM(__pyx_args, 5);
-      case  5: values[4] = PyTuple_GET_ITEM(__pyx_args, 4);
-      case  4: values[3] = PyTuple_GET_ITEM(__pyx_args, 3);
-      case  3: values[2] = PyTuple_GET_ITEM(__pyx_args, 2);
-      case  2: values[1] = PyTuple_GET_ITEM(__pyx_args, 1);
-      case  1: values[0] = PyTuple_GET_ITEM(__pyx_args, 0);
-      case  0: break;
-      default: goto __pyx_L5_argtuple_error;
-    }
-    switch (PyTuple_GET_SIZE(__pyx_args)) {
-      case  0:
-      values[0] = PyDict_GetItem(__pyx_kwds, __pyx_kp_Y);
-      if (likely(values[0])) kw_args--;
-      else goto __pyx_L5_argtuple_error;
-      case  1:
-      values[1] = PyDict_GetItem(__pyx_kwds, __pyx_kp_VY);
-      if (likely(values[1])) kw_args--;
-      else {
-        __Pyx_RaiseArgtupleInvalid("log_likelihood_ratio", 0, 4, 6, 1); {__pyx_filename = __pyx_f[0]; __pyx_lineno = 170; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-      }
-      case  2:
-      values[2] = PyDict_GetItem(__pyx_kwds, __pyx_kp_X);
-      if (likely(values[2])) kw_args--;
-      else {
-        __Pyx_RaiseArgtupleInvalid("log_likelihood_ratio", 0, 4, 6, 2); {__pyx_filename = __pyx_f[0]; __pyx_lineno = 170; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-      }
-      case  3:
-      values[3] = PyDict_GetItem(__pyx_kwds, __pyx_kp_C);
-      if (likely(values[3])) kw_args--;
-      else {
-        __Pyx_RaiseArgtupleInvalid("log_likelihood_ratio", 0, 4, 6, 3); {__pyx_filename = __pyx_f[0]; __pyx_lineno = 170; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-      }
-    }
-    if (unlikely(kw_args > 0)) {
-      if (unlikely(__Pyx_ParseOptionalKeywords(__pyx_kwds, __pyx_pyargnames, 0, values, PyTuple_GET_SIZE(__pyx_args), "log_likelihood_ratio") < 0)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 170; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-    }
-    __pyx_v_Y = values[0];
-    __pyx_v_VY = values[1];
-    __pyx_v_X = values[2];
-    __pyx_v_C = values[3];
-    if (values[4]) {
-      __pyx_v_axis = __pyx_PyInt_int(values[4]); if (unlikely((__pyx_v_axis == (int)-1) && PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 170; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-    }
-    if (values[5]) {
-      __pyx_v_niter = __pyx_PyInt_int(values[5]); if (unlikely((__pyx_v_niter == (int)-1) && PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 170; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-    }
-  } else {
-    switch (PyTuple_GET_SIZE(__pyx_args)) {
-      case  6:
-      __pyx_v_niter = __pyx_PyInt_int(PyTuple_GET_ITEM(__pyx_args, 5)); if (unlikely((__pyx_v_niter == (int)-1) && PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 170; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-      case  5:
-      __pyx_v_axis = __pyx_PyInt_int(PyTuple_GET_ITEM(__pyx_args, 4)); if (unlikely((__pyx_v_axis == (int)-1) && PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 170; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-      case  4:
-      __pyx_v_C = PyTuple_GET_ITEM(__pyx_args, 3);
-      __pyx_v_X = PyTuple_GET_ITEM(__pyx_args, 2);
-      __pyx_v_VY = PyTuple_GET_ITEM(__pyx_args, 1);
-      __pyx_v_Y = PyTuple_GET_ITEM(__pyx_args, 0);
-      break;
-      default: goto __pyx_L5_argtuple_error;
-    }
-  }
-  goto __pyx_L4_argument_unpacking_done;
-  __pyx_L5_argtuple_error:;
-  __Pyx_RaiseArgtupleInvalid("log_likelihood_ratio", 0, 4, 6, PyTuple_GET_SIZE(__pyx_args)); {__pyx_filename = __pyx_f[0]; __pyx_lineno = 170; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-  __pyx_L3_error:;
-  __Pyx_AddTraceback("fff2.group.glm_twolevel.log_likelihood_ratio");
-  return NULL;
-  __pyx_L4_argument_unpacking_done:;
-  __pyx_v_B = Py_None; Py_INCREF(Py_None);
-  __pyx_v_S2 = Py_None; Py_INCREF(Py_None);
-  __pyx_v_ll0 = Py_None; Py_INCREF(Py_None);
-  __pyx_v_ll = Py_None; Py_INCREF(Py_None);
-  __pyx_v_lda = Py_None; Py_INCREF(Py_None);
-
-  /* "d:\home\ar203069\bzr\nipy\fff2\fff2\group\glm_twolevel.pyx":176
- * 
- * 	# Constrained log-likelihood
- * 	B, S2 = em(Y, VY, X, C, axis, niter)             # <<<<<<<<<<<<<<
- * 	ll0 = log_likelihood(Y, VY, X, B, S2, axis)
- * 
- */
-  __pyx_1 = __Pyx_GetName(__pyx_m, __pyx_kp_em); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 176; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __pyx_2 = PyInt_FromLong(__pyx_v_axis); if (unlikely(!__pyx_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 176; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __pyx_3 = PyInt_FromLong(__pyx_v_niter); if (unlikely(!__pyx_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 176; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __pyx_4 = PyTuple_New(6); if (unlikely(!__pyx_4)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 176; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_INCREF(__pyx_v_Y);
-  PyTuple_SET_ITEM(__pyx_4, 0, __pyx_v_Y);
-  Py_INCREF(__pyx_v_VY);
-  PyTuple_SET_ITEM(__pyx_4, 1, __pyx_v_VY);
-  Py_INCREF(__pyx_v_X);
-  PyTuple_SET_ITEM(__pyx_4, 2, __pyx_v_X);
-  Py_INCREF(__pyx_v_C);
-  PyTuple_SET_ITEM(__pyx_4, 3, __pyx_v_C);
-  PyTuple_SET_ITEM(__pyx_4, 4, __pyx_2);
-  PyTuple_SET_ITEM(__pyx_4, 5, __pyx_3);
-  __pyx_2 = 0;
-  __pyx_3 = 0;
-  __pyx_2 = PyObject_Call(__pyx_1, ((PyObject *)__pyx_4), NULL); if (unlikely(!__pyx_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 176; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_DECREF(__pyx_1); __pyx_1 = 0;
-  Py_DECREF(((PyObject *)__pyx_4)); __pyx_4 = 0;
-  if (PyTuple_CheckExact(__pyx_2) && PyTuple_GET_SIZE(__pyx_2) == 2) {
-    PyObject* tuple = __pyx_2;
-    __pyx_1 = PyTuple_GET_ITEM(tuple, 0);
-    Py_INCREF(__pyx_1);
-    Py_DECREF(__pyx_v_B);
-    __pyx_v_B = __pyx_1;
-    __pyx_1 = 0;
-    __pyx_4 = PyTuple_GET_ITEM(tuple, 1);
-    Py_INCREF(__pyx_4);
-    Py_DECREF(__pyx_v_S2);
-    __pyx_v_S2 = __pyx_4;
-    __pyx_4 = 0;
-    Py_DECREF(__pyx_2); __pyx_2 = 0;
-  }
-  else {
-    __pyx_3 = PyObject_GetIter(__pyx_2); if (unlikely(!__pyx_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 176; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_DECREF(__pyx_2); __pyx_2 = 0;
-    __pyx_1 = __Pyx_UnpackItem(__pyx_3, 0); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 176; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_DECREF(__pyx_v_B);
-    __pyx_v_B = __pyx_1;
-    __pyx_1 = 0;
-    __pyx_4 = __Pyx_UnpackItem(__pyx_3, 1); if (unlikely(!__pyx_4)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 176; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_DECREF(__pyx_v_S2);
-    __pyx_v_S2 = __pyx_4;
-    __pyx_4 = 0;
-    if (__Pyx_EndUnpack(__pyx_3) < 0) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 176; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_DECREF(__pyx_3); __pyx_3 = 0;
-  }
-
-  /* "d:\home\ar203069\bzr\nipy\fff2\fff2\group\glm_twolevel.pyx":177
- * 	# Constrained log-likelihood
- * 	B, S2 = em(Y, VY, X, C, axis, niter)
- * 	ll0 = log_likelihood(Y, VY, X, B, S2, axis)             # <<<<<<<<<<<<<<
- * 
- * 	# Unconstrained log-likelihood
- */
-  __pyx_1 = __Pyx_GetName(__pyx_m, __pyx_kp_log_likelihood); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 177; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __pyx_4 = PyInt_FromLong(__pyx_v_axis); if (unlikely(!__pyx_4)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 177; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __pyx_2 = PyTuple_New(6); if (unlikely(!__pyx_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 177; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_INCREF(__pyx_v_Y);
-  PyTuple_SET_ITEM(__pyx_2, 0, __pyx_v_Y);
-  Py_INCREF(__pyx_v_VY);
-  PyTuple_SET_ITEM(__pyx_2, 1, __pyx_v_VY);
-  Py_INCREF(__pyx_v_X);
-  PyTuple_SET_ITEM(__pyx_2, 2, __pyx_v_X);
-  Py_INCREF(__pyx_v_B);
-  PyTuple_SET_ITEM(__pyx_2, 3, __pyx_v_B);
-  Py_INCREF(__pyx_v_S2);
-  PyTuple_SET_ITEM(__pyx_2, 4, __pyx_v_S2);
-  PyTuple_SET_ITEM(__pyx_2, 5, __pyx_4);
-  __pyx_4 = 0;
-  __pyx_3 = PyObject_Call(__pyx_1, ((PyObject *)__pyx_2), NULL); if (unlikely(!__pyx_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 177; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_DECREF(__pyx_1); __pyx_1 = 0;
-  Py_DECREF(((PyObject *)__pyx_2)); __pyx_2 = 0;
-  Py_DECREF(__pyx_v_ll0);
-  __pyx_v_ll0 = __pyx_3;
-  __pyx_3 = 0;
-
-  /* "d:\home\ar203069\bzr\nipy\fff2\fff2\group\glm_twolevel.pyx":180
- * 
- * 	# Unconstrained log-likelihood
- * 	B, S2 = em(Y, VY, X, None, axis, niter)             # <<<<<<<<<<<<<<
- * 	ll = log_likelihood(Y, VY, X, B, S2, axis)
- * 
- */
-  __pyx_4 = __Pyx_GetName(__pyx_m, __pyx_kp_em); if (unlikely(!__pyx_4)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 180; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __pyx_1 = PyInt_FromLong(__pyx_v_axis); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 180; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __pyx_2 = PyInt_FromLong(__pyx_v_niter); if (unlikely(!__pyx_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 180; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __pyx_3 = PyTuple_New(6); if (unlikely(!__pyx_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 180; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_INCREF(__pyx_v_Y);
-  PyTuple_SET_ITEM(__pyx_3, 0, __pyx_v_Y);
-  Py_INCREF(__pyx_v_VY);
-  PyTuple_SET_ITEM(__pyx_3, 1, __pyx_v_VY);
-  Py_INCREF(__pyx_v_X);
-  PyTuple_SET_ITEM(__pyx_3, 2, __pyx_v_X);
-  Py_INCREF(Py_None);
-  PyTuple_SET_ITEM(__pyx_3, 3, Py_None);
-  PyTuple_SET_ITEM(__pyx_3, 4, __pyx_1);
-  PyTuple_SET_ITEM(__pyx_3, 5, __pyx_2);
-  __pyx_1 = 0;
-  __pyx_2 = 0;
-  __pyx_1 = PyObject_Call(__pyx_4, ((PyObject *)__pyx_3), NULL); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 180; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_DECREF(__pyx_4); __pyx_4 = 0;
-  Py_DECREF(((PyObject *)__pyx_3)); __pyx_3 = 0;
-  if (PyTuple_CheckExact(__pyx_1) && PyTuple_GET_SIZE(__pyx_1) == 2) {
-    PyObject* tuple = __pyx_1;
-    __pyx_4 = PyTuple_GET_ITEM(tuple, 0);
-    Py_INCREF(__pyx_4);
-    Py_DECREF(__pyx_v_B);
-    __pyx_v_B = __pyx_4;
-    __pyx_4 = 0;
-    __pyx_3 = PyTuple_GET_ITEM(tuple, 1);
-    Py_INCREF(__pyx_3);
-    Py_DECREF(__pyx_v_S2);
-    __pyx_v_S2 = __pyx_3;
-    __pyx_3 = 0;
-    Py_DECREF(__pyx_1); __pyx_1 = 0;
-  }
-  else {
-    __pyx_2 = PyObject_GetIter(__pyx_1); if (unlikely(!__pyx_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 180; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_DECREF(__pyx_1); __pyx_1 = 0;
-    __pyx_4 = __Pyx_UnpackItem(__pyx_2, 0); if (unlikely(!__pyx_4)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 180; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_DECREF(__pyx_v_B);
-    __pyx_v_B = __pyx_4;
-    __pyx_4 = 0;
-    __pyx_3 = __Pyx_UnpackItem(__pyx_2, 1); if (unlikely(!__pyx_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 180; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_DECREF(__pyx_v_S2);
-    __pyx_v_S2 = __pyx_3;
-    __pyx_3 = 0;
-    if (__Pyx_EndUnpack(__pyx_2) < 0) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 180; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_DECREF(__pyx_2); __pyx_2 = 0;
-  }
-
-  /* "d:\home\ar203069\bzr\nipy\fff2\fff2\group\glm_twolevel.pyx":181
- * 	# Unconstrained log-likelihood
- * 	B, S2 = em(Y, VY, X, None, axis, niter)
- * 	ll = log_likelihood(Y, VY, X, B, S2, axis)             # <<<<<<<<<<<<<<
- * 
- * 	# -2 log R = 2*(ll-ll0)
- */
-  __pyx_4 = __Pyx_GetName(__pyx_m, __pyx_kp_log_likelihood); if (unlikely(!__pyx_4)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 181; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __pyx_3 = PyInt_FromLong(__pyx_v_axis); if (unlikely(!__pyx_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 181; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __pyx_1 = PyTuple_New(6); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 181; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_INCREF(__pyx_v_Y);
-  PyTuple_SET_ITEM(__pyx_1, 0, __pyx_v_Y);
-  Py_INCREF(__pyx_v_VY);
-  PyTuple_SET_ITEM(__pyx_1, 1, __pyx_v_VY);
-  Py_INCREF(__pyx_v_X);
-  PyTuple_SET_ITEM(__pyx_1, 2, __pyx_v_X);
-  Py_INCREF(__pyx_v_B);
-  PyTuple_SET_ITEM(__pyx_1, 3, __pyx_v_B);
-  Py_INCREF(__pyx_v_S2);
-  PyTuple_SET_ITEM(__pyx_1, 4, __pyx_v_S2);
-  PyTuple_SET_ITEM(__pyx_1, 5, __pyx_3);
-  __pyx_3 = 0;
-  __pyx_2 = PyObject_Call(__pyx_4, ((PyObject *)__pyx_1), NULL); if (unlikely(!__pyx_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 181; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_DECREF(__pyx_4); __pyx_4 = 0;
-  Py_DECREF(((PyObject *)__pyx_1)); __pyx_1 = 0;
-  Py_DECREF(__pyx_v_ll);
-  __pyx_v_ll = __pyx_2;
-  __pyx_2 = 0;
-
-  /* "d:\home\ar203069\bzr\nipy\fff2\fff2\group\glm_twolevel.pyx":184
- * 
- * 	# -2 log R = 2*(ll-ll0)
- * 	lda = 2*(ll-ll0)             # <<<<<<<<<<<<<<
- * 	return np.maximum(lda, 0.0)
- */
-  __pyx_t_1 = PyNumber_Subtract(__pyx_v_ll, __pyx_v_ll0); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 184; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __pyx_t_2 = PyNumber_Multiply(__pyx_int_2, __pyx_t_1); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 184; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-  Py_DECREF(__pyx_v_lda);
-  __pyx_v_lda = __pyx_t_2;
-  __pyx_t_2 = 0;
-
-  /* "d:\home\ar203069\bzr\nipy\fff2\fff2\group\glm_twolevel.pyx":185
- * 	# -2 log R = 2*(ll-ll0)
- * 	lda = 2*(ll-ll0)
- * 	return np.maximum(lda, 0.0)             # <<<<<<<<<<<<<<
- */
-  __pyx_3 = __Pyx_GetName(__pyx_m, __pyx_kp_np); if (unlikely(!__pyx_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 185; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __pyx_4 = PyObject_GetAttr(__pyx_3, __pyx_kp_maximum); if (unlikely(!__pyx_4)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 185; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_DECREF(__pyx_3); __pyx_3 = 0;
-  __pyx_1 = PyFloat_FromDouble(0.0); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 185; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __pyx_2 = PyTuple_New(2); if (unlikely(!__pyx_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 185; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_INCREF(__pyx_v_lda);
-  PyTuple_SET_ITEM(__pyx_2, 0, __pyx_v_lda);
-  PyTuple_SET_ITEM(__pyx_2, 1, __pyx_1);
-  __pyx_1 = 0;
-  __pyx_3 = PyObject_Call(__pyx_4, ((PyObject *)__pyx_2), NULL); if (unlikely(!__pyx_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 185; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_DECREF(__pyx_4); __pyx_4 = 0;
-  Py_DECREF(((PyObject *)__pyx_2)); __pyx_2 = 0;
-  __pyx_r = __pyx_3;
-  __pyx_3 = 0;
-  goto __pyx_L0;
-
-  __pyx_r = Py_None; Py_INCREF(Py_None);
-  goto __pyx_L0;
-  __pyx_L1_error:;
-  Py_XDECREF(__pyx_1);
-  Py_XDECREF(__pyx_2);
-  Py_XDECREF(__pyx_3);
-  Py_XDECREF(__pyx_4);
-  __Pyx_AddTraceback("fff2.group.glm_twolevel.log_likelihood_ratio");
-  __pyx_r = NULL;
-  __pyx_L0:;
-  Py_DECREF(__pyx_v_B);
-  Py_DECREF(__pyx_v_S2);
-  Py_DECREF(__pyx_v_ll0);
-  Py_DECREF(__pyx_v_ll);
-  Py_DECREF(__pyx_v_lda);
-  return __pyx_r;
-}
-
-static struct PyMethodDef __pyx_methods[] = {
-  {"em", (PyCFunction)__pyx_pf_4fff2_5group_12glm_twolevel_em, METH_VARARGS|METH_KEYWORDS, __pyx_doc_4fff2_5group_12glm_twolevel_em},
-  {"log_likelihood", (PyCFunction)__pyx_pf_4fff2_5group_12glm_twolevel_log_likelihood, METH_VARARGS|METH_KEYWORDS, __pyx_doc_4fff2_5group_12glm_twolevel_log_likelihood},
-  {"log_likelihood_ratio", (PyCFunction)__pyx_pf_4fff2_5group_12glm_twolevel_log_likelihood_ratio, METH_VARARGS|METH_KEYWORDS, __pyx_doc_4fff2_5group_12glm_twolevel_log_likelihood_ratio},
-  {0, 0, 0, 0}
-};
-
-static void __pyx_init_filenames(void); /*proto*/
-
-#if PY_MAJOR_VERSION >= 3
-static struct PyModuleDef __pyx_moduledef = {
-    PyModuleDef_HEAD_INIT,
-    "glm_twolevel",
-    __pyx_mdoc, /* m_doc */
-    -1, /* m_size */
-    __pyx_methods /* m_methods */,
-    NULL, /* m_reload */
-    NULL, /* m_traverse */
-    NULL, /* m_clear */
-    NULL /* m_free */
-};
-#endif
-
-static __Pyx_StringTabEntry __pyx_string_tab[] = {
-  {&__pyx_kp_Y, __pyx_k_Y, sizeof(__pyx_k_Y), 1, 1, 1},
-  {&__pyx_kp_VY, __pyx_k_VY, sizeof(__pyx_k_VY), 1, 1, 1},
-  {&__pyx_kp_X, __pyx_k_X, sizeof(__pyx_k_X), 1, 1, 1},
-  {&__pyx_kp_C, __pyx_k_C, sizeof(__pyx_k_C), 1, 1, 1},
-  {&__pyx_kp_axis, __pyx_k_axis, sizeof(__pyx_k_axis), 1, 1, 1},
-  {&__pyx_kp_niter, __pyx_k_niter, sizeof(__pyx_k_niter), 1, 1, 1},
-  {&__pyx_kp_B, __pyx_k_B, sizeof(__pyx_k_B), 1, 1, 1},
-  {&__pyx_kp_1, __pyx_k_1, sizeof(__pyx_k_1), 1, 1, 1},
-  {&__pyx_kp___version__, __pyx_k___version__, sizeof(__pyx_k___version__), 1, 1, 1},
-  {&__pyx_kp_numpy, __pyx_k_numpy, sizeof(__pyx_k_numpy), 1, 1, 1},
-  {&__pyx_kp_np, __pyx_k_np, sizeof(__pyx_k_np), 0, 1, 1},
-  {&__pyx_kp_DEF_NITER, __pyx_k_DEF_NITER, sizeof(__pyx_k_DEF_NITER), 1, 1, 1},
-  {&__pyx_kp_linalg, __pyx_k_linalg, sizeof(__pyx_k_linalg), 1, 1, 1},
-  {&__pyx_kp_pinv, __pyx_k_pinv, sizeof(__pyx_k_pinv), 1, 1, 1},
-  {&__pyx_kp_inv, __pyx_k_inv, sizeof(__pyx_k_inv), 1, 1, 1},
-  {&__pyx_kp_dot, __pyx_k_dot, sizeof(__pyx_k_dot), 1, 1, 1},
-  {&__pyx_kp_transpose, __pyx_k_transpose, sizeof(__pyx_k_transpose), 1, 1, 1},
-  {&__pyx_kp_eye, __pyx_k_eye, sizeof(__pyx_k_eye), 1, 1, 1},
-  {&__pyx_kp_shape, __pyx_k_shape, sizeof(__pyx_k_shape), 1, 1, 1},
-  {&__pyx_kp_zeros, __pyx_k_zeros, sizeof(__pyx_k_zeros), 1, 1, 1},
-  {&__pyx_kp_em, __pyx_k_em, sizeof(__pyx_k_em), 1, 1, 1},
-  {&__pyx_kp_log_likelihood, __pyx_k_log_likelihood, sizeof(__pyx_k_log_likelihood), 1, 1, 1},
-  {&__pyx_kp_maximum, __pyx_k_maximum, sizeof(__pyx_k_maximum), 1, 1, 1},
-  {&__pyx_kp_2, __pyx_k_2, sizeof(__pyx_k_2), 0, 0, 0},
-  {0, 0, 0, 0, 0, 0}
-};
-static int __Pyx_InitCachedBuiltins(void) {
-  return 0;
-  return -1;
-}
-
-static int __Pyx_InitGlobals(void) {
-  __pyx_int_2 = PyInt_FromLong(2); if (unlikely(!__pyx_int_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 1; __pyx_clineno = __LINE__; goto __pyx_L1_error;};
-  __pyx_int_1 = PyInt_FromLong(1); if (unlikely(!__pyx_int_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 1; __pyx_clineno = __LINE__; goto __pyx_L1_error;};
-  if (__Pyx_InitStrings(__pyx_string_tab) < 0) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 1; __pyx_clineno = __LINE__; goto __pyx_L1_error;};
-  return 0;
-  __pyx_L1_error:;
-  return -1;
-}
-
-#if PY_MAJOR_VERSION < 3
-PyMODINIT_FUNC initglm_twolevel(void); /*proto*/
-PyMODINIT_FUNC initglm_twolevel(void)
-#else
-PyMODINIT_FUNC PyInit_glm_twolevel(void); /*proto*/
-PyMODINIT_FUNC PyInit_glm_twolevel(void)
-#endif
-{
-  PyObject *__pyx_1 = 0;
-  int __pyx_2;
-  int __pyx_3;
-  __pyx_empty_tuple = PyTuple_New(0); if (unlikely(!__pyx_empty_tuple)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 1; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  /*--- Library function declarations ---*/
-  __pyx_init_filenames();
-  /*--- Initialize various global constants etc. ---*/
-  if (unlikely(__Pyx_InitGlobals() < 0)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 1; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  /*--- Module creation code ---*/
-  #if PY_MAJOR_VERSION < 3
-  __pyx_m = Py_InitModule4("glm_twolevel", __pyx_methods, __pyx_mdoc, 0, PYTHON_API_VERSION);
-  #else
-  __pyx_m = PyModule_Create(&__pyx_moduledef);
-  #endif
-  if (!__pyx_m) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 1; __pyx_clineno = __LINE__; goto __pyx_L1_error;};
-  #if PY_MAJOR_VERSION < 3
-  Py_INCREF(__pyx_m);
-  #endif
-  __pyx_b = PyImport_AddModule(__Pyx_BUILTIN_MODULE_NAME);
-  if (!__pyx_b) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 1; __pyx_clineno = __LINE__; goto __pyx_L1_error;};
-  if (PyObject_SetAttrString(__pyx_m, "__builtins__", __pyx_b) < 0) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 1; __pyx_clineno = __LINE__; goto __pyx_L1_error;};
-  /*--- Builtin init code ---*/
-  if (unlikely(__Pyx_InitCachedBuiltins() < 0)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 1; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __pyx_skip_dispatch = 0;
-  /*--- Global init code ---*/
-  /*--- Function export code ---*/
-  /*--- Type init code ---*/
-  __pyx_ptype_4fff2_5group_12glm_twolevel_dtype = __Pyx_ImportType("numpy", "dtype", sizeof(PyArray_Descr)); if (unlikely(!__pyx_ptype_4fff2_5group_12glm_twolevel_dtype)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 74; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __pyx_ptype_4fff2_5group_12glm_twolevel_ndarray = __Pyx_ImportType("numpy", "ndarray", sizeof(PyArrayObject)); if (unlikely(!__pyx_ptype_4fff2_5group_12glm_twolevel_ndarray)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 79; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __pyx_ptype_4fff2_5group_12glm_twolevel_flatiter = __Pyx_ImportType("numpy", "flatiter", sizeof(PyArrayIterObject)); if (unlikely(!__pyx_ptype_4fff2_5group_12glm_twolevel_flatiter)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 88; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __pyx_ptype_4fff2_5group_12glm_twolevel_broadcast = __Pyx_ImportType("numpy", "broadcast", sizeof(PyArrayMultiIterObject)); if (unlikely(!__pyx_ptype_4fff2_5group_12glm_twolevel_broadcast)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 94; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  /*--- Type import code ---*/
-  /*--- Function import code ---*/
-  /*--- Execution code ---*/
-
-  /* "d:\home\ar203069\bzr\nipy\fff2\fff2\group\glm_twolevel.pyx":10
- * """
- * 
- * __version__ = '0.1'             # <<<<<<<<<<<<<<
- * 
- * 
- */
-  if (PyObject_SetAttr(__pyx_m, __pyx_kp___version__, __pyx_kp_2) < 0) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 10; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-
-  /* "d:\home\ar203069\bzr\nipy\fff2\fff2\group\glm_twolevel.pyx":34
- * 
- * # Initialize numpy
- * fffpy_import_array()             # <<<<<<<<<<<<<<
- * import_array()
- * import numpy as np
- */
-  fffpy_import_array();
-
-  /* "d:\home\ar203069\bzr\nipy\fff2\fff2\group\glm_twolevel.pyx":35
- * # Initialize numpy
- * fffpy_import_array()
- * import_array()             # <<<<<<<<<<<<<<
- * import numpy as np
- * 
- */
-  import_array();
-
-  /* "d:\home\ar203069\bzr\nipy\fff2\fff2\group\glm_twolevel.pyx":36
- * fffpy_import_array()
- * import_array()
- * import numpy as np             # <<<<<<<<<<<<<<
- * 
- * 
- */
-  __pyx_1 = __Pyx_Import(__pyx_kp_numpy, 0); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 36; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  if (PyObject_SetAttr(__pyx_m, __pyx_kp_np, __pyx_1) < 0) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 36; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_DECREF(__pyx_1); __pyx_1 = 0;
-
-  /* "d:\home\ar203069\bzr\nipy\fff2\fff2\group\glm_twolevel.pyx":40
- * 
- * # Constants
- * DEF_NITER = 2             # <<<<<<<<<<<<<<
- * 
- * def em(ndarray Y, ndarray VY, ndarray X, ndarray C=None, int axis=0, int niter=DEF_NITER):
- */
-  if (PyObject_SetAttr(__pyx_m, __pyx_kp_DEF_NITER, __pyx_int_2) < 0) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 40; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-
-  /* "d:\home\ar203069\bzr\nipy\fff2\fff2\group\glm_twolevel.pyx":42
- * DEF_NITER = 2
- * 
- * def em(ndarray Y, ndarray VY, ndarray X, ndarray C=None, int axis=0, int niter=DEF_NITER):             # <<<<<<<<<<<<<<
- * 	"""
- * 	b, s2 = em(y, vy, X, C=None, axis=0, niter=DEF_NITER).
- */
-  __pyx_1 = __Pyx_GetName(__pyx_m, __pyx_kp_DEF_NITER); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 42; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __pyx_2 = __pyx_PyInt_int(__pyx_1); if (unlikely((__pyx_2 == (int)-1) && PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 42; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_DECREF(__pyx_1); __pyx_1 = 0;
-  __pyx_k_3 = __pyx_2;
-
-  /* "d:\home\ar203069\bzr\nipy\fff2\fff2\group\glm_twolevel.pyx":170
- * 
- * 
- * def log_likelihood_ratio(Y, VY, X, C, int axis=0, int niter=DEF_NITER):             # <<<<<<<<<<<<<<
- * 	"""
- * 	lda = em(y, vy, X, C, axis=0, niter=DEF_NITER).
- */
-  __pyx_1 = __Pyx_GetName(__pyx_m, __pyx_kp_DEF_NITER); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 170; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __pyx_3 = __pyx_PyInt_int(__pyx_1); if (unlikely((__pyx_3 == (int)-1) && PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 170; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_DECREF(__pyx_1); __pyx_1 = 0;
-  __pyx_k_4 = __pyx_3;
-  #if PY_MAJOR_VERSION < 3
-  return;
-  #else
-  return __pyx_m;
-  #endif
-  __pyx_L1_error:;
-  Py_XDECREF(__pyx_1);
-  __Pyx_AddTraceback("fff2.group.glm_twolevel");
-  #if PY_MAJOR_VERSION >= 3
-  return NULL;
-  #endif
-}
-
-static const char *__pyx_filenames[] = {
-  "glm_twolevel.pyx",
-  "numpy.pxi",
-};
-
-/* Runtime support code */
-
-static void __pyx_init_filenames(void) {
-  __pyx_f = __pyx_filenames;
-}
-
-static void __Pyx_RaiseDoubleKeywordsError(
-    const char* func_name,
-    PyObject* kw_name)
-{
-    PyErr_Format(PyExc_TypeError,
-        #if PY_MAJOR_VERSION >= 3
-        "%s() got multiple values for keyword argument '%U'", func_name, kw_name);
-        #else
-        "%s() got multiple values for keyword argument '%s'", func_name,
-        PyString_AS_STRING(kw_name));
-        #endif
-}
-
-static void __Pyx_RaiseArgtupleInvalid(
-    const char* func_name,
-    int exact,
-    Py_ssize_t num_min,
-    Py_ssize_t num_max,
-    Py_ssize_t num_found)
-{
-    Py_ssize_t num_expected;
-    const char *number, *more_or_less;
-
-    if (num_found < num_min) {
-        num_expected = num_min;
-        more_or_less = "at least";
-    } else {
-        num_expected = num_max;
-        more_or_less = "at most";
-    }
-    if (exact) {
-        more_or_less = "exactly";
-    }
-    number = (num_expected == 1) ? "" : "s";
-    PyErr_Format(PyExc_TypeError,
-        #if PY_VERSION_HEX < 0x02050000
-            "%s() takes %s %d positional argument%s (%d given)",
-        #else
-            "%s() takes %s %zd positional argument%s (%zd given)",
-        #endif
-        func_name, more_or_less, num_expected, number, num_found);
-}
-
-static int __Pyx_ParseOptionalKeywords(
-    PyObject *kwds,
-    PyObject **argnames[],
-    PyObject *kwds2,
-    PyObject *values[],
-    Py_ssize_t num_pos_args,
-    const char* function_name)
-{
-    PyObject *key = 0, *value = 0;
-    Py_ssize_t pos = 0;
-    PyObject*** name;
-    PyObject*** first_kw_arg = argnames + num_pos_args;
-
-    while (PyDict_Next(kwds, &pos, &key, &value)) {
-        #if PY_MAJOR_VERSION < 3
-        if (unlikely(!PyString_CheckExact(key)) && unlikely(!PyString_Check(key))) {
-        #else
-        if (unlikely(!PyUnicode_CheckExact(key)) && unlikely(!PyUnicode_Check(key))) {
-        #endif
-            goto invalid_keyword_type;
-        } else {
-            name = argnames;
-            while (*name && (**name != key)) name++;
-            if (*name) {
-                if (name < first_kw_arg) goto arg_passed_twice;
-                values[name-argnames] = value;
-            } else {
-                for (name = first_kw_arg; *name; name++) {
-                    #if PY_MAJOR_VERSION >= 3
-                    if (PyUnicode_GET_SIZE(**name) == PyUnicode_GET_SIZE(key) &&
-                        PyUnicode_Compare(**name, key) == 0) break;
-                    #else
-                    if (PyString_GET_SIZE(**name) == PyString_GET_SIZE(key) &&
-                        strcmp(PyString_AS_STRING(**name),
-                               PyString_AS_STRING(key)) == 0) break;
-                    #endif
-                }
-                if (*name) {
-                    values[name-argnames] = value;
-                } else {
-                    /* unexpected keyword found */
-                    for (name=argnames; name != first_kw_arg; name++) {
-                        if (**name == key) goto arg_passed_twice;
-                        #if PY_MAJOR_VERSION >= 3
-                        if (PyUnicode_GET_SIZE(**name) == PyUnicode_GET_SIZE(key) &&
-                            PyUnicode_Compare(**name, key) == 0) goto arg_passed_twice;
-                        #else
-                        if (PyString_GET_SIZE(**name) == PyString_GET_SIZE(key) &&
-                            strcmp(PyString_AS_STRING(**name),
-                                   PyString_AS_STRING(key)) == 0) goto arg_passed_twice;
-                        #endif
-                    }
-                    if (kwds2) {
-                        if (unlikely(PyDict_SetItem(kwds2, key, value))) goto bad;
-                    } else {
-                        goto invalid_keyword;
-                    }
-                }
-            }
-        }
-    }
-    return 0;
-arg_passed_twice:
-    __Pyx_RaiseDoubleKeywordsError(function_name, **name);
-    goto bad;
-invalid_keyword_type:
-    PyErr_Format(PyExc_TypeError,
-        "%s() keywords must be strings", function_name);
-    goto bad;
-invalid_keyword:
-    PyErr_Format(PyExc_TypeError,
-    #if PY_MAJOR_VERSION < 3
-        "%s() got an unexpected keyword argument '%s'",
-        function_name, PyString_AsString(key));
-    #else
-        "%s() got an unexpected keyword argument '%U'",
-        function_name, key);
-    #endif
-bad:
-    return -1;
-}
-
-
-static int __Pyx_ArgTypeTest(PyObject *obj, PyTypeObject *type, int none_allowed,
-    const char *name, int exact)
-{
-    if (!type) {
-        PyErr_Format(PyExc_SystemError, "Missing type object");
-        return 0;
-    }
-    if (none_allowed && obj == Py_None) return 1;
-    else if (exact) {
-        if (Py_TYPE(obj) == type) return 1;
-    }
-    else {
-        if (PyObject_TypeCheck(obj, type)) return 1;
-    }
-    PyErr_Format(PyExc_TypeError,
-        "Argument '%s' has incorrect type (expected %s, got %s)",
-        name, type->tp_name, Py_TYPE(obj)->tp_name);
-    return 0;
-}
-
-static PyObject *__Pyx_Import(PyObject *name, PyObject *from_list) {
-    PyObject *__import__ = 0;
-    PyObject *empty_list = 0;
-    PyObject *module = 0;
-    PyObject *global_dict = 0;
-    PyObject *empty_dict = 0;
-    PyObject *list;
-    __import__ = PyObject_GetAttrString(__pyx_b, "__import__");
-    if (!__import__)
-        goto bad;
-    if (from_list)
-        list = from_list;
-    else {
-        empty_list = PyList_New(0);
-        if (!empty_list)
-            goto bad;
-        list = empty_list;
-    }
-    global_dict = PyModule_GetDict(__pyx_m);
-    if (!global_dict)
-        goto bad;
-    empty_dict = PyDict_New();
-    if (!empty_dict)
-        goto bad;
-    module = PyObject_CallFunction(__import__, "OOOO",
-        name, global_dict, empty_dict, list);
-bad:
-    Py_XDECREF(empty_list);
-    Py_XDECREF(__import__);
-    Py_XDECREF(empty_dict);
-    return module;
-}
-
-static PyObject *__Pyx_GetName(PyObject *dict, PyObject *name) {
-    PyObject *result;
-    result = PyObject_GetAttr(dict, name);
-    if (!result)
-        PyErr_SetObject(PyExc_NameError, name);
-    return result;
-}
-
-static int __Pyx_TypeTest(PyObject *obj, PyTypeObject *type) {
-    if (!type) {
-        PyErr_Format(PyExc_SystemError, "Missing type object");
-        return 0;
-    }
-    if (obj == Py_None || PyObject_TypeCheck(obj, type))
-        return 1;
-    PyErr_Format(PyExc_TypeError, "Cannot convert %s to %s",
-        Py_TYPE(obj)->tp_name, type->tp_name);
-    return 0;
-}
-
-static PyObject *__Pyx_UnpackItem(PyObject *iter, Py_ssize_t index) {
-    PyObject *item;
-    if (!(item = PyIter_Next(iter))) {
-        if (!PyErr_Occurred()) {
-            PyErr_Format(PyExc_ValueError,
-                #if PY_VERSION_HEX < 0x02050000
-                    "need more than %d values to unpack", (int)index);
-                #else
-                    "need more than %zd values to unpack", index);
-                #endif
-        }
-    }
-    return item;
-}
-
-static int __Pyx_EndUnpack(PyObject *iter) {
-    PyObject *item;
-    if ((item = PyIter_Next(iter))) {
-        Py_DECREF(item);
-        PyErr_SetString(PyExc_ValueError, "too many values to unpack");
-        return -1;
-    }
-    else if (!PyErr_Occurred())
-        return 0;
-    else
-        return -1;
-}
-
-#ifndef __PYX_HAVE_RT_ImportType
-#define __PYX_HAVE_RT_ImportType
-static PyTypeObject *__Pyx_ImportType(const char *module_name, const char *class_name,
-    long size)
-{
-    PyObject *py_module = 0;
-    PyObject *result = 0;
-    PyObject *py_name = 0;
-
-    py_module = __Pyx_ImportModule(module_name);
-    if (!py_module)
-        goto bad;
-    #if PY_MAJOR_VERSION < 3
-    py_name = PyString_FromString(class_name);
-    #else
-    py_name = PyUnicode_FromString(class_name);
-    #endif
-    if (!py_name)
-        goto bad;
-    result = PyObject_GetAttr(py_module, py_name);
-    Py_DECREF(py_name);
-    py_name = 0;
-    Py_DECREF(py_module);
-    py_module = 0;
-    if (!result)
-        goto bad;
-    if (!PyType_Check(result)) {
-        PyErr_Format(PyExc_TypeError, 
-            "%s.%s is not a type object",
-            module_name, class_name);
-        goto bad;
-    }
-    if (((PyTypeObject *)result)->tp_basicsize != size) {
-        PyErr_Format(PyExc_ValueError, 
-            "%s.%s does not appear to be the correct type object",
-            module_name, class_name);
-        goto bad;
-    }
-    return (PyTypeObject *)result;
-bad:
-    Py_XDECREF(py_module);
-    Py_XDECREF(result);
-    return 0;
-}
-#endif
-
-#ifndef __PYX_HAVE_RT_ImportModule
-#define __PYX_HAVE_RT_ImportModule
-static PyObject *__Pyx_ImportModule(const char *name) {
-    PyObject *py_name = 0;
-    PyObject *py_module = 0;
-
-    #if PY_MAJOR_VERSION < 3
-    py_name = PyString_FromString(name);
-    #else
-    py_name = PyUnicode_FromString(name);
-    #endif
-    if (!py_name)
-        goto bad;
-    py_module = PyImport_Import(py_name);
-    Py_DECREF(py_name);
-    return py_module;
-bad:
-    Py_XDECREF(py_name);
-    return 0;
-}
-#endif
-
-#include "compile.h"
-#include "frameobject.h"
-#include "traceback.h"
-
-static void __Pyx_AddTraceback(const char *funcname) {
-    PyObject *py_srcfile = 0;
-    PyObject *py_funcname = 0;
-    PyObject *py_globals = 0;
-    PyObject *empty_string = 0;
-    PyCodeObject *py_code = 0;
-    PyFrameObject *py_frame = 0;
-
-    #if PY_MAJOR_VERSION < 3
-    py_srcfile = PyString_FromString(__pyx_filename);
-    #else
-    py_srcfile = PyUnicode_FromString(__pyx_filename);
-    #endif
-    if (!py_srcfile) goto bad;
-    if (__pyx_clineno) {
-        #if PY_MAJOR_VERSION < 3
-        py_funcname = PyString_FromFormat( "%s (%s:%d)", funcname, __pyx_cfilenm, __pyx_clineno);
-        #else
-        py_funcname = PyUnicode_FromFormat( "%s (%s:%d)", funcname, __pyx_cfilenm, __pyx_clineno);
-        #endif
-    }
-    else {
-        #if PY_MAJOR_VERSION < 3
-        py_funcname = PyString_FromString(funcname);
-        #else
-        py_funcname = PyUnicode_FromString(funcname);
-        #endif
-    }
-    if (!py_funcname) goto bad;
-    py_globals = PyModule_GetDict(__pyx_m);
-    if (!py_globals) goto bad;
-    #if PY_MAJOR_VERSION < 3
-    empty_string = PyString_FromStringAndSize("", 0);
-    #else
-    empty_string = PyBytes_FromStringAndSize("", 0);
-    #endif
-    if (!empty_string) goto bad;
-    py_code = PyCode_New(
-        0,            /*int argcount,*/
-        #if PY_MAJOR_VERSION >= 3
-        0,            /*int kwonlyargcount,*/
-        #endif
-        0,            /*int nlocals,*/
-        0,            /*int stacksize,*/
-        0,            /*int flags,*/
-        empty_string, /*PyObject *code,*/
-        __pyx_empty_tuple,  /*PyObject *consts,*/
-        __pyx_empty_tuple,  /*PyObject *names,*/
-        __pyx_empty_tuple,  /*PyObject *varnames,*/
-        __pyx_empty_tuple,  /*PyObject *freevars,*/
-        __pyx_empty_tuple,  /*PyObject *cellvars,*/
-        py_srcfile,   /*PyObject *filename,*/
-        py_funcname,  /*PyObject *name,*/
-        __pyx_lineno,   /*int firstlineno,*/
-        empty_string  /*PyObject *lnotab*/
-    );
-    if (!py_code) goto bad;
-    py_frame = PyFrame_New(
-        PyThreadState_GET(), /*PyThreadState *tstate,*/
-        py_code,             /*PyCodeObject *code,*/
-        py_globals,          /*PyObject *globals,*/
-        0                    /*PyObject *locals*/
-    );
-    if (!py_frame) goto bad;
-    py_frame->f_lineno = __pyx_lineno;
-    PyTraceBack_Here(py_frame);
-bad:
-    Py_XDECREF(py_srcfile);
-    Py_XDECREF(py_funcname);
-    Py_XDECREF(empty_string);
-    Py_XDECREF(py_code);
-    Py_XDECREF(py_frame);
-}
-
-static int __Pyx_InitStrings(__Pyx_StringTabEntry *t) {
-    while (t->p) {
-        #if PY_MAJOR_VERSION < 3
-        if (t->is_unicode && (!t->is_identifier)) {
-            *t->p = PyUnicode_DecodeUTF8(t->s, t->n - 1, NULL);
-        } else if (t->intern) {
-            *t->p = PyString_InternFromString(t->s);
-        } else {
-            *t->p = PyString_FromStringAndSize(t->s, t->n - 1);
-        }
-        #else  /* Python 3+ has unicode identifiers */
-        if (t->is_identifier || (t->is_unicode && t->intern)) {
-            *t->p = PyUnicode_InternFromString(t->s);
-        } else if (t->is_unicode) {
-            *t->p = PyUnicode_FromStringAndSize(t->s, t->n - 1);
-        } else {
-            *t->p = PyBytes_FromStringAndSize(t->s, t->n - 1);
-        }
-        #endif
-        if (!*t->p)
-            return -1;
-        ++t;
-    }
-    return 0;
-}
-
-/* Type Conversion Functions */
-
-static INLINE Py_ssize_t __pyx_PyIndex_AsSsize_t(PyObject* b) {
-  Py_ssize_t ival;
-  PyObject* x = PyNumber_Index(b);
-  if (!x) return -1;
-  ival = PyInt_AsSsize_t(x);
-  Py_DECREF(x);
-  return ival;
-}
-
-static INLINE int __Pyx_PyObject_IsTrue(PyObject* x) {
-   if (x == Py_True) return 1;
-   else if (x == Py_False) return 0;
-   else return PyObject_IsTrue(x);
-}
-
-static INLINE PY_LONG_LONG __pyx_PyInt_AsLongLong(PyObject* x) {
-    if (PyInt_CheckExact(x)) {
-        return PyInt_AS_LONG(x);
-    }
-    else if (PyLong_CheckExact(x)) {
-        return PyLong_AsLongLong(x);
-    }
-    else {
-        PY_LONG_LONG val;
-        PyObject* tmp = PyNumber_Int(x); if (!tmp) return (PY_LONG_LONG)-1;
-        val = __pyx_PyInt_AsLongLong(tmp);
-        Py_DECREF(tmp);
-        return val;
-    }
-}
-
-static INLINE unsigned PY_LONG_LONG __pyx_PyInt_AsUnsignedLongLong(PyObject* x) {
-    if (PyInt_CheckExact(x)) {
-        long val = PyInt_AS_LONG(x);
-        if (unlikely(val < 0)) {
-            PyErr_SetString(PyExc_TypeError, "Negative assignment to unsigned type.");
-            return (unsigned PY_LONG_LONG)-1;
-        }
-        return val;
-    }
-    else if (PyLong_CheckExact(x)) {
-        return PyLong_AsUnsignedLongLong(x);
-    }
-    else {
-        PY_LONG_LONG val;
-        PyObject* tmp = PyNumber_Int(x); if (!tmp) return (PY_LONG_LONG)-1;
-        val = __pyx_PyInt_AsUnsignedLongLong(tmp);
-        Py_DECREF(tmp);
-        return val;
-    }
-}
-
-
-static INLINE unsigned char __pyx_PyInt_unsigned_char(PyObject* x) {
-    if (sizeof(unsigned char) < sizeof(long)) {
-        long long_val = __pyx_PyInt_AsLong(x);
-        unsigned char val = (unsigned char)long_val;
-        if (unlikely((val != long_val)  || (long_val < 0))) {
-            PyErr_SetString(PyExc_OverflowError, "value too large to convert to unsigned char");
-            return (unsigned char)-1;
-        }
-        return val;
-    }
-    else {
-        return __pyx_PyInt_AsLong(x);
-    }
-}
-
-static INLINE unsigned short __pyx_PyInt_unsigned_short(PyObject* x) {
-    if (sizeof(unsigned short) < sizeof(long)) {
-        long long_val = __pyx_PyInt_AsLong(x);
-        unsigned short val = (unsigned short)long_val;
-        if (unlikely((val != long_val)  || (long_val < 0))) {
-            PyErr_SetString(PyExc_OverflowError, "value too large to convert to unsigned short");
-            return (unsigned short)-1;
-        }
-        return val;
-    }
-    else {
-        return __pyx_PyInt_AsLong(x);
-    }
-}
-
-static INLINE char __pyx_PyInt_char(PyObject* x) {
-    if (sizeof(char) < sizeof(long)) {
-        long long_val = __pyx_PyInt_AsLong(x);
-        char val = (char)long_val;
-        if (unlikely((val != long_val) )) {
-            PyErr_SetString(PyExc_OverflowError, "value too large to convert to char");
-            return (char)-1;
-        }
-        return val;
-    }
-    else {
-        return __pyx_PyInt_AsLong(x);
-    }
-}
-
-static INLINE short __pyx_PyInt_short(PyObject* x) {
-    if (sizeof(short) < sizeof(long)) {
-        long long_val = __pyx_PyInt_AsLong(x);
-        short val = (short)long_val;
-        if (unlikely((val != long_val) )) {
-            PyErr_SetString(PyExc_OverflowError, "value too large to convert to short");
-            return (short)-1;
-        }
-        return val;
-    }
-    else {
-        return __pyx_PyInt_AsLong(x);
-    }
-}
-
-static INLINE int __pyx_PyInt_int(PyObject* x) {
-    if (sizeof(int) < sizeof(long)) {
-        long long_val = __pyx_PyInt_AsLong(x);
-        int val = (int)long_val;
-        if (unlikely((val != long_val) )) {
-            PyErr_SetString(PyExc_OverflowError, "value too large to convert to int");
-            return (int)-1;
-        }
-        return val;
-    }
-    else {
-        return __pyx_PyInt_AsLong(x);
-    }
-}
-
-static INLINE long __pyx_PyInt_long(PyObject* x) {
-    if (sizeof(long) < sizeof(long)) {
-        long long_val = __pyx_PyInt_AsLong(x);
-        long val = (long)long_val;
-        if (unlikely((val != long_val) )) {
-            PyErr_SetString(PyExc_OverflowError, "value too large to convert to long");
-            return (long)-1;
-        }
-        return val;
-    }
-    else {
-        return __pyx_PyInt_AsLong(x);
-    }
-}
-
-static INLINE signed char __pyx_PyInt_signed_char(PyObject* x) {
-    if (sizeof(signed char) < sizeof(long)) {
-        long long_val = __pyx_PyInt_AsLong(x);
-        signed char val = (signed char)long_val;
-        if (unlikely((val != long_val) )) {
-            PyErr_SetString(PyExc_OverflowError, "value too large to convert to signed char");
-            return (signed char)-1;
-        }
-        return val;
-    }
-    else {
-        return __pyx_PyInt_AsLong(x);
-    }
-}
-
-static INLINE signed short __pyx_PyInt_signed_short(PyObject* x) {
-    if (sizeof(signed short) < sizeof(long)) {
-        long long_val = __pyx_PyInt_AsLong(x);
-        signed short val = (signed short)long_val;
-        if (unlikely((val != long_val) )) {
-            PyErr_SetString(PyExc_OverflowError, "value too large to convert to signed short");
-            return (signed short)-1;
-        }
-        return val;
-    }
-    else {
-        return __pyx_PyInt_AsLong(x);
-    }
-}
-
-static INLINE signed int __pyx_PyInt_signed_int(PyObject* x) {
-    if (sizeof(signed int) < sizeof(long)) {
-        long long_val = __pyx_PyInt_AsLong(x);
-        signed int val = (signed int)long_val;
-        if (unlikely((val != long_val) )) {
-            PyErr_SetString(PyExc_OverflowError, "value too large to convert to signed int");
-            return (signed int)-1;
-        }
-        return val;
-    }
-    else {
-        return __pyx_PyInt_AsLong(x);
-    }
-}
-
-static INLINE signed long __pyx_PyInt_signed_long(PyObject* x) {
-    if (sizeof(signed long) < sizeof(long)) {
-        long long_val = __pyx_PyInt_AsLong(x);
-        signed long val = (signed long)long_val;
-        if (unlikely((val != long_val) )) {
-            PyErr_SetString(PyExc_OverflowError, "value too large to convert to signed long");
-            return (signed long)-1;
-        }
-        return val;
-    }
-    else {
-        return __pyx_PyInt_AsLong(x);
-    }
-}
-
-static INLINE long double __pyx_PyInt_long_double(PyObject* x) {
-    if (sizeof(long double) < sizeof(long)) {
-        long long_val = __pyx_PyInt_AsLong(x);
-        long double val = (long double)long_val;
-        if (unlikely((val != long_val) )) {
-            PyErr_SetString(PyExc_OverflowError, "value too large to convert to long double");
-            return (long double)-1;
-        }
-        return val;
-    }
-    else {
-        return __pyx_PyInt_AsLong(x);
-    }
-}
-
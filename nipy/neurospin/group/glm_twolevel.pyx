@@ -27,6 +27,17 @@ cdef extern from "fff_glm_twolevel.h":
 	void fff_glm_twolevel_EM_init(fff_glm_twolevel_EM* em)
 	void fff_glm_twolevel_EM_run(fff_glm_twolevel_EM* em, fff_vector* y, fff_vector* vy, 
 				fff_matrix* X, fff_matrix* PpiX, unsigned int niter)	
+	ctypedef struct fff_glm_twolevel_batch:
+		fff_matrix* Y
+		fff_matrix* VY
+		fff_matrix* B
+		fff_vector* s2
+
+	fff_glm_twolevel_batch* fff_glm_twolevel_batch_new(size_t m, size_t n, size_t p)
+	void fff_glm_twolevel_batch_delete(fff_glm_twolevel_batch* thisone)
+	void fff_glm_twolevel_batch_run(fff_glm_twolevel_batch* thisone, size_t m, 
+					fff_matrix* X, fff_matrix* PpiX, 
+					unsigned int niter, double tol)
 	double fff_glm_twolevel_log_likelihood(fff_vector* y, fff_vector* vy, fff_matrix* X, 
 					  fff_vector* b, double s2, fff_vector* tmp )
 
@@ -38,14 +49,94 @@ import numpy as np
 
 # Constants
 DEF_NITER = 2
+DEF_CHUNK = 256
 
-def em(ndarray Y, ndarray VY, ndarray X, ndarray C=None, int axis=0, int niter=DEF_NITER):
+
+def _signals(ndarray Y, int axis, size_t n):
+	"""
+	View on the signals of Y along the given axis, one per row. The
+	data are only converted to double if they can not be read in
+	place by fff_array (unknown type, foreign byte order or
+	misaligned data).
+	"""
+	Yf = np.rollaxis(Y, axis, Y.ndim)
+	Yf = Yf.reshape((-1, n))
+	if (fff_datatype_fromNumPy(Yf.dtype.num) == FFF_UNKNOWN_TYPE) or \
+		    (not Yf.dtype.isnative) or (not Yf.flags.aligned):
+		Yf = Yf.astype('double')
+	return Yf
+
+
+# Parallel job for em: each thread fits its range of signals by
+# blocks of params.chunk signals, which are read from typed views of
+# the input arrays.
+cdef struct _em_job_params:
+	fff_array* y
+	fff_array* vy
+	double* b
+	double* s2
+	size_t nvox
+	size_t chunk
+	fff_matrix* x
+	fff_matrix* ppx
+	unsigned int niter
+	double tol
+
+cdef void _em_job(int rank, int nthreads, void* p):
+	cdef _em_job_params* params = <_em_job_params*>p
+	cdef fff_glm_twolevel_batch* batch
+	cdef fff_array y, vy, yb, vyb
+	cdef fff_matrix b, bb
+	cdef fff_vector s2, s2b
+	cdef size_t n, q, i, start, stop, nc
+
+	n = params.x.size1
+	q = params.x.size2
+	fff_parallel_range(params.nvox, rank, nthreads, &start, &stop)
+	batch = fff_glm_twolevel_batch_new(params.chunk, n, q)
+	i = start
+	while i < stop:
+		nc = stop-i
+		if nc > params.chunk:
+			nc = params.chunk
+		y = fff_array_get_block2d(params.y, i, i+nc-1, 1, 0, n-1, 1)
+		vy = fff_array_get_block2d(params.vy, i, i+nc-1, 1, 0, n-1, 1)
+		yb = fff_array_view(FFF_DOUBLE, <void*>batch.Y.data, nc, n, 1, 1, n, 1, 1, 1)
+		vyb = fff_array_view(FFF_DOUBLE, <void*>batch.VY.data, nc, n, 1, 1, n, 1, 1, 1)
+		fff_array_copy(&yb, &y)
+		fff_array_copy(&vyb, &vy)
+		fff_glm_twolevel_batch_run(batch, nc, params.x, params.ppx, params.niter, params.tol)
+		b = fff_matrix_view(params.b + i*q, nc, q, q)
+		bb = fff_matrix_view(batch.B.data, nc, q, q)
+		fff_matrix_memcpy(&b, &bb)
+		s2 = fff_vector_view(params.s2 + i, nc, 1)
+		s2b = fff_vector_view(batch.s2.data, nc, 1)
+		fff_vector_memcpy(&s2, &s2b)
+		i = i + nc
+	fff_glm_twolevel_batch_delete(batch)
+
+
+def em(ndarray Y, ndarray VY, ndarray X, ndarray C=None, int axis=0, int niter=DEF_NITER,
+       int nthreads=1, double tol=0.0, int chunk=DEF_CHUNK):
 	"""
-	b, s2 = em(y, vy, X, C=None, axis=0, niter=DEF_NITER).
+	b, s2 = em(y, vy, X, C=None, axis=0, niter=DEF_NITER, nthreads=1, tol=0, chunk=DEF_CHUNK).
 
 	Maximum likelihood regression in a mixed-effect GLM using the
 	EM algorithm.
 
+	The EM iterations are run for `chunk` voxels at once using
+	matrix products, since the design matrix is common to all
+	voxels. If tol is positive, each voxel stops iterating before
+	niter iterations as soon as the relative change of its variance,
+	and the change of its effects relative to the standard
+	deviation, are below tol.
+
+	Voxels are split across nthreads threads (all processors if
+	nthreads is zero or negative), which yields the same result.
+
+	Y and VY are read in place, by blocks of `chunk` voxels, whatever
+	their numeric type.
+
 	C is the contrast matrix. Conventionally, C is p x q where p
 	is the number of regressors. 
 	
@@ -56,11 +147,9 @@ def em(ndarray Y, ndarray VY, ndarray X, ndarray C=None, int axis=0, int niter=D
 	REFERENCE:
 	Keller and Roche, ISBI 2008.
 	"""
-	cdef size_t n, p
-	cdef fff_vector *y, *vy, *b, *s2
+	cdef size_t n, p, nvox
 	cdef fff_matrix *x, *ppx
-	cdef fff_glm_twolevel_EM *em
-	cdef fffpy_multi_iterator* multi
+	cdef _em_job_params params
 
 	# View on design matrix
 	x = fff_matrix_fromPyArray(X)
@@ -68,6 +157,8 @@ def em(ndarray Y, ndarray VY, ndarray X, ndarray C=None, int axis=0, int niter=D
 	# Number of observations / regressors 
 	n = x.size1
 	p = x.size2
+	if chunk < 1:
+		chunk = 1
 
 	# Compute the projected pseudo-inverse matrix
 	if C == None:
@@ -79,39 +170,42 @@ def em(ndarray Y, ndarray VY, ndarray X, ndarray C=None, int axis=0, int niter=D
 		PpX = np.dot(np.dot(P, A), X.transpose()) # (p,n)
 	ppx = fff_matrix_fromPyArray(PpX)
 
-	# Allocate output arrays
-	dims = list(Y.shape)
-	dims[axis] = p
-	B = np.zeros(dims)
-	dims[axis] = 1
-	S2 = np.zeros(dims)
-
-	# Local structs
-	em = fff_glm_twolevel_EM_new(n, p)
+	# Signals along rows
+	if not VY.shape == Y.shape:
+		VY = np.lib.stride_tricks.broadcast_arrays(VY, Y)[0]
+	dims = list(np.rollaxis(Y, axis, Y.ndim).shape[:-1])
+	Yf = _signals(Y, axis, n)
+	VYf = _signals(VY, axis, n)
+	nvox = Yf.shape[0]
 
-	# Create a new array iterator 
-	multi = fffpy_multi_iterator_new(4, axis, <void*>Y, <void*>VY,
-					 <void*>B, <void*>S2)
-
-	# Create views
-	y = multi.vector[0]
-	vy = multi.vector[1]
-	b = multi.vector[2]
-	s2 = multi.vector[3]
-
-        # Loop 
-	while(multi.index < multi.size):
-		fff_glm_twolevel_EM_init(em)
-		fff_glm_twolevel_EM_run(em, y, vy, x, ppx, niter)
-		fff_vector_memcpy(b, em.b)
-		s2.data[0] = em.s2
-		fffpy_multi_iterator_update(multi)
+	# Allocate output arrays
+	Bf = np.zeros((nvox, p))
+	S2f = np.zeros(nvox)
+
+	# Threaded fit
+	params.y = fff_array_fromPyArray(Yf)
+	params.vy = fff_array_fromPyArray(VYf)
+	params.b = <double*>Bf.data
+	params.s2 = <double*>S2f.data
+	params.nvox = nvox
+	params.chunk = chunk
+	params.x = x
+	params.ppx = ppx
+	params.niter = niter
+	params.tol = tol
+	nthreads = fff_threads_count(nthreads)
+	fffpy_parallel_run(nthreads, _em_job, <void*>&params)
 	
 	# Free memory
+	fff_array_delete(params.y)
+	fff_array_delete(params.vy)
 	fff_matrix_delete(x)
 	fff_matrix_delete(ppx)
-	fffpy_multi_iterator_delete(multi)
-	fff_glm_twolevel_EM_delete(em)
+
+	# Reshape outputs
+	B = np.ascontiguousarray(np.rollaxis(Bf.reshape(dims + [p]), -1, axis))
+	dims.insert(axis, 1)
+	S2 = S2f.reshape(dims)
 
 	# Return
 	return B, S2
@@ -167,17 +261,18 @@ def log_likelihood(Y, VY, X, B, S2, int axis=0):
 	return LL
 
 
-def log_likelihood_ratio(Y, VY, X, C, int axis=0, int niter=DEF_NITER):
+def log_likelihood_ratio(Y, VY, X, C, int axis=0, int niter=DEF_NITER, 
+			 int nthreads=1, double tol=0.0):
 	"""
-	lda = em(y, vy, X, C, axis=0, niter=DEF_NITER).
+	lda = em(y, vy, X, C, axis=0, niter=DEF_NITER, nthreads=1, tol=0).
 	"""
 
 	# Constrained log-likelihood
-	B, S2 = em(Y, VY, X, C, axis, niter)
+	B, S2 = em(Y, VY, X, C, axis, niter, nthreads, tol)
 	ll0 = log_likelihood(Y, VY, X, B, S2, axis)
 
 	# Unconstrained log-likelihood
-	B, S2 = em(Y, VY, X, None, axis, niter)
+	B, S2 = em(Y, VY, X, None, axis, niter, nthreads, tol)
 	ll = log_likelihood(Y, VY, X, B, S2, axis)
 	
 	# -2 log R = 2*(ll-ll0)
@@ -1,3291 +0,0 @@
-/* Generated by Cython 0.11.2 on Sat Oct 24 23:48:22 2009 */
-
-#define PY_SSIZE_T_CLEAN
-#include "Python.h"
-#include "structmember.h"
-#ifndef Py_PYTHON_H
-    #error Python headers needed to compile C extensions, please install development version of Python.
-#endif
-#ifndef PY_LONG_LONG
-  #define PY_LONG_LONG LONG_LONG
-#endif
-#ifndef DL_EXPORT
-  #define DL_EXPORT(t) t
-#endif
-#if PY_VERSION_HEX < 0x02040000
-  #define METH_COEXIST 0
-  #define PyDict_CheckExact(op) (Py_TYPE(op) == &PyDict_Type)
-#endif
-#if PY_VERSION_HEX < 0x02050000
-  typedef int Py_ssize_t;
-  #define PY_SSIZE_T_MAX INT_MAX
-  #define PY_SSIZE_T_MIN INT_MIN
-  #define PY_FORMAT_SIZE_T ""
-  #define PyInt_FromSsize_t(z) PyInt_FromLong(z)
-  #define PyInt_AsSsize_t(o)   PyInt_AsLong(o)
-  #define PyNumber_Index(o)    PyNumber_Int(o)
-  #define PyIndex_Check(o)     PyNumber_Check(o)
-#endif
-#if PY_VERSION_HEX < 0x02060000
-  #define Py_REFCNT(ob) (((PyObject*)(ob))->ob_refcnt)
-  #define Py_TYPE(ob)   (((PyObject*)(ob))->ob_type)
-  #define Py_SIZE(ob)   (((PyVarObject*)(ob))->ob_size)
-  #define PyVarObject_HEAD_INIT(type, size) \
-          PyObject_HEAD_INIT(type) size,
-  #define PyType_Modified(t)
-
-  typedef struct {
-       void *buf;
-       PyObject *obj;
-       Py_ssize_t len;
-       Py_ssize_t itemsize;
-       int readonly;
-       int ndim;
-       char *format;
-       Py_ssize_t *shape;
-       Py_ssize_t *strides;
-       Py_ssize_t *suboffsets;
-       void *internal;
-  } Py_buffer;
-
-  #define PyBUF_SIMPLE 0
-  #define PyBUF_WRITABLE 0x0001
-  #define PyBUF_FORMAT 0x0004
-  #define PyBUF_ND 0x0008
-  #define PyBUF_STRIDES (0x0010 | PyBUF_ND)
-  #define PyBUF_C_CONTIGUOUS (0x0020 | PyBUF_STRIDES)
-  #define PyBUF_F_CONTIGUOUS (0x0040 | PyBUF_STRIDES)
-  #define PyBUF_ANY_CONTIGUOUS (0x0080 | PyBUF_STRIDES)
-  #define PyBUF_INDIRECT (0x0100 | PyBUF_STRIDES)
-
-#endif
-#if PY_MAJOR_VERSION < 3
-  #define __Pyx_BUILTIN_MODULE_NAME "__builtin__"
-#else
-  #define __Pyx_BUILTIN_MODULE_NAME "builtins"
-#endif
-#if PY_MAJOR_VERSION >= 3
-  #define Py_TPFLAGS_CHECKTYPES 0
-  #define Py_TPFLAGS_HAVE_INDEX 0
-#endif
-#if (PY_VERSION_HEX < 0x02060000) || (PY_MAJOR_VERSION >= 3)
-  #define Py_TPFLAGS_HAVE_NEWBUFFER 0
-#endif
-#if PY_MAJOR_VERSION >= 3
-  #define PyBaseString_Type            PyUnicode_Type
-  #define PyString_Type                PyBytes_Type
-  #define PyString_CheckExact          PyBytes_CheckExact
-  #define PyInt_Type                   PyLong_Type
-  #define PyInt_Check(op)              PyLong_Check(op)
-  #define PyInt_CheckExact(op)         PyLong_CheckExact(op)
-  #define PyInt_FromString             PyLong_FromString
-  #define PyInt_FromUnicode            PyLong_FromUnicode
-  #define PyInt_FromLong               PyLong_FromLong
-  #define PyInt_FromSize_t             PyLong_FromSize_t
-  #define PyInt_FromSsize_t            PyLong_FromSsize_t
-  #define PyInt_AsLong                 PyLong_AsLong
-  #define PyInt_AS_LONG                PyLong_AS_LONG
-  #define PyInt_AsSsize_t              PyLong_AsSsize_t
-  #define PyInt_AsUnsignedLongMask     PyLong_AsUnsignedLongMask
-  #define PyInt_AsUnsignedLongLongMask PyLong_AsUnsignedLongLongMask
-  #define __Pyx_PyNumber_Divide(x,y)         PyNumber_TrueDivide(x,y)
-#else
-  #define __Pyx_PyNumber_Divide(x,y)         PyNumber_Divide(x,y)
-  #define PyBytes_Type                 PyString_Type
-#endif
-#if PY_MAJOR_VERSION >= 3
-  #define PyMethod_New(func, self, klass) PyInstanceMethod_New(func)
-#endif
-#if !defined(WIN32) && !defined(MS_WINDOWS)
-  #ifndef __stdcall
-    #define __stdcall
-  #endif
-  #ifndef __cdecl
-    #define __cdecl
-  #endif
-  #ifndef __fastcall
-    #define __fastcall
-  #endif
-#else
-  #define _USE_MATH_DEFINES
-#endif
-#if PY_VERSION_HEX < 0x02050000
-  #define __Pyx_GetAttrString(o,n)   PyObject_GetAttrString((o),((char *)(n)))
-  #define __Pyx_SetAttrString(o,n,a) PyObject_SetAttrString((o),((char *)(n)),(a))
-  #define __Pyx_DelAttrString(o,n)   PyObject_DelAttrString((o),((char *)(n)))
-#else
-  #define __Pyx_GetAttrString(o,n)   PyObject_GetAttrString((o),(n))
-  #define __Pyx_SetAttrString(o,n,a) PyObject_SetAttrString((o),(n),(a))
-  #define __Pyx_DelAttrString(o,n)   PyObject_DelAttrString((o),(n))
-#endif
-#if PY_VERSION_HEX < 0x02050000
-  #define __Pyx_NAMESTR(n) ((char *)(n))
-  #define __Pyx_DOCSTR(n)  ((char *)(n))
-#else
-  #define __Pyx_NAMESTR(n) (n)
-  #define __Pyx_DOCSTR(n)  (n)
-#endif
-#ifdef __cplusplus
-#define __PYX_EXTERN_C extern "C"
-#else
-#define __PYX_EXTERN_C extern
-#endif
-#include <math.h>
-#define __PYX_HAVE_API__nipy__neurospin__group__onesample
-#include "numpy/arrayobject.h"
-#include "fff_base.h"
-#include "fff_vector.h"
-#include "fff_matrix.h"
-#include "fff_array.h"
-#include "randomkit.h"
-#include "fffpy.h"
-#include "fff_onesample_stat.h"
-#define __PYX_USE_C99_COMPLEX defined(_Complex_I)
-
-
-#ifdef __GNUC__
-#define INLINE __inline__
-#elif _WIN32
-#define INLINE __inline
-#else
-#define INLINE 
-#endif
-
-typedef struct {PyObject **p; char *s; long n; char is_unicode; char intern; char is_identifier;} __Pyx_StringTabEntry; /*proto*/
-
-
-
-static int __pyx_skip_dispatch = 0;
-
-
-/* Type Conversion Predeclarations */
-
-#if PY_MAJOR_VERSION < 3
-#define __Pyx_PyBytes_FromString          PyString_FromString
-#define __Pyx_PyBytes_FromStringAndSize   PyString_FromStringAndSize
-#define __Pyx_PyBytes_AsString            PyString_AsString
-#else
-#define __Pyx_PyBytes_FromString          PyBytes_FromString
-#define __Pyx_PyBytes_FromStringAndSize   PyBytes_FromStringAndSize
-#define __Pyx_PyBytes_AsString            PyBytes_AsString
-#endif
-
-#define __Pyx_PyBool_FromLong(b) ((b) ? (Py_INCREF(Py_True), Py_True) : (Py_INCREF(Py_False), Py_False))
-static INLINE int __Pyx_PyObject_IsTrue(PyObject*);
-static INLINE PyObject* __Pyx_PyNumber_Int(PyObject* x);
-
-#if !defined(T_PYSSIZET)
-#if PY_VERSION_HEX < 0x02050000
-#define T_PYSSIZET T_INT
-#elif !defined(T_LONGLONG)
-#define T_PYSSIZET \
-        ((sizeof(Py_ssize_t) == sizeof(int))  ? T_INT  : \
-        ((sizeof(Py_ssize_t) == sizeof(long)) ? T_LONG : -1))
-#else
-#define T_PYSSIZET \
-        ((sizeof(Py_ssize_t) == sizeof(int))          ? T_INT      : \
-        ((sizeof(Py_ssize_t) == sizeof(long))         ? T_LONG     : \
-        ((sizeof(Py_ssize_t) == sizeof(PY_LONG_LONG)) ? T_LONGLONG : -1)))
-#endif
-#endif
-
-#if !defined(T_SIZET)
-#if !defined(T_ULONGLONG)
-#define T_SIZET \
-        ((sizeof(size_t) == sizeof(unsigned int))  ? T_UINT  : \
-        ((sizeof(size_t) == sizeof(unsigned long)) ? T_ULONG : -1))
-#else
-#define T_SIZET \
-        ((sizeof(size_t) == sizeof(unsigned int))          ? T_UINT      : \
-        ((sizeof(size_t) == sizeof(unsigned long))         ? T_ULONG     : \
-        ((sizeof(size_t) == sizeof(unsigned PY_LONG_LONG)) ? T_ULONGLONG : -1)))
-#endif
-#endif
-
-static INLINE Py_ssize_t __Pyx_PyIndex_AsSsize_t(PyObject*);
-static INLINE PyObject * __Pyx_PyInt_FromSize_t(size_t);
-static INLINE size_t __Pyx_PyInt_AsSize_t(PyObject*);
-
-#define __pyx_PyFloat_AsDouble(x) (PyFloat_CheckExact(x) ? PyFloat_AS_DOUBLE(x) : PyFloat_AsDouble(x))
-
-
-#ifdef __GNUC__
-/* Test for GCC > 2.95 */
-#if __GNUC__ > 2 ||               (__GNUC__ == 2 && (__GNUC_MINOR__ > 95)) 
-#define likely(x)   __builtin_expect(!!(x), 1)
-#define unlikely(x) __builtin_expect(!!(x), 0)
-#else /* __GNUC__ > 2 ... */
-#define likely(x)   (x)
-#define unlikely(x) (x)
-#endif /* __GNUC__ > 2 ... */
-#else /* __GNUC__ */
-#define likely(x)   (x)
-#define unlikely(x) (x)
-#endif /* __GNUC__ */
-    
-static PyObject *__pyx_m;
-static PyObject *__pyx_b;
-static PyObject *__pyx_empty_tuple;
-static int __pyx_lineno;
-static int __pyx_clineno = 0;
-static const char * __pyx_cfilenm= __FILE__;
-static const char *__pyx_filename;
-static const char **__pyx_f;
-
-static char __pyx_mdoc[] = "\nRoutines for massively univariate random-effect and mixed-effect analysis.\n\nAuthor: Alexis Roche, 2008.\n";
-
-
-#ifdef CYTHON_REFNANNY
-typedef struct {
-  void (*INCREF)(void*, PyObject*, int);
-  void (*DECREF)(void*, PyObject*, int);
-  void (*GOTREF)(void*, PyObject*, int);
-  void (*GIVEREF)(void*, PyObject*, int);
-  void* (*NewContext)(const char*, int, const char*);
-  void (*FinishContext)(void**);
-} __Pyx_RefnannyAPIStruct;
-static __Pyx_RefnannyAPIStruct *__Pyx_Refnanny = NULL;
-#define __Pyx_ImportRefcountAPI(name)   (__Pyx_RefnannyAPIStruct *) PyCObject_Import((char *)name, (char *)"RefnannyAPI")
-#define __Pyx_INCREF(r) __Pyx_Refnanny->INCREF(__pyx_refchk, (PyObject *)(r), __LINE__)
-#define __Pyx_DECREF(r) __Pyx_Refnanny->DECREF(__pyx_refchk, (PyObject *)(r), __LINE__)
-#define __Pyx_GOTREF(r) __Pyx_Refnanny->GOTREF(__pyx_refchk, (PyObject *)(r), __LINE__)
-#define __Pyx_GIVEREF(r) __Pyx_Refnanny->GIVEREF(__pyx_refchk, (PyObject *)(r), __LINE__)
-#define __Pyx_XDECREF(r) if((r) == NULL) ; else __Pyx_DECREF(r)
-#define __Pyx_SetupRefcountContext(name)   void* __pyx_refchk = __Pyx_Refnanny->NewContext((name), __LINE__, __FILE__)
-#define __Pyx_FinishRefcountContext()   __Pyx_Refnanny->FinishContext(&__pyx_refchk)
-#else
-#define __Pyx_INCREF(r) Py_INCREF(r)
-#define __Pyx_DECREF(r) Py_DECREF(r)
-#define __Pyx_GOTREF(r)
-#define __Pyx_GIVEREF(r)
-#define __Pyx_XDECREF(r) Py_XDECREF(r)
-#define __Pyx_SetupRefcountContext(name)
-#define __Pyx_FinishRefcountContext()
-#endif /* CYTHON_REFNANNY */
-#define __Pyx_XGIVEREF(r) if((r) == NULL) ; else __Pyx_GIVEREF(r)
-#define __Pyx_XGOTREF(r) if((r) == NULL) ; else __Pyx_GOTREF(r)
-
-static void __Pyx_RaiseDoubleKeywordsError(
-    const char* func_name, PyObject* kw_name); /*proto*/
-
-static void __Pyx_RaiseArgtupleInvalid(const char* func_name, int exact,
-    Py_ssize_t num_min, Py_ssize_t num_max, Py_ssize_t num_found); /*proto*/
-
-static int __Pyx_ParseOptionalKeywords(PyObject *kwds, PyObject **argnames[],     PyObject *kwds2, PyObject *values[], Py_ssize_t num_pos_args,     const char* function_name); /*proto*/
-
-#define __Pyx_SetItemInt(o, i, v, size, to_py_func) ((size <= sizeof(Py_ssize_t)) ? \
-                                                    __Pyx_SetItemInt_Fast(o, i, v, size <= sizeof(long)) : \
-                                                    __Pyx_SetItemInt_Generic(o, to_py_func(i), v))
-
-static INLINE int __Pyx_SetItemInt_Generic(PyObject *o, PyObject *j, PyObject *v) {
-    int r;
-    if (!j) return -1;
-    r = PyObject_SetItem(o, j, v);
-    Py_DECREF(j);
-    return r;
-}
-
-static INLINE int __Pyx_SetItemInt_Fast(PyObject *o, Py_ssize_t i, PyObject *v, int fits_long) {
-    if (PyList_CheckExact(o) && ((0 <= i) & (i < PyList_GET_SIZE(o)))) {
-        Py_INCREF(v);
-        Py_DECREF(PyList_GET_ITEM(o, i));
-        PyList_SET_ITEM(o, i, v);
-        return 1;
-    }
-    else if (Py_TYPE(o)->tp_as_sequence && Py_TYPE(o)->tp_as_sequence->sq_ass_item && (likely(i >= 0)))
-        return PySequence_SetItem(o, i, v);
-    else {
-        PyObject *j = fits_long ? PyInt_FromLong(i) : PyLong_FromLongLong(i);
-        return __Pyx_SetItemInt_Generic(o, j, v);
-    }
-}
-
-static int __Pyx_ArgTypeTest(PyObject *obj, PyTypeObject *type, int none_allowed,
-    const char *name, int exact); /*proto*/
-
-static PyObject *__Pyx_Import(PyObject *name, PyObject *from_list); /*proto*/
-
-static PyObject *__Pyx_GetName(PyObject *dict, PyObject *name); /*proto*/
-
-static INLINE int __Pyx_StrEq(const char *, const char *); /*proto*/
-
-static INLINE unsigned char __Pyx_PyInt_AsUnsignedChar(PyObject *);
-
-static INLINE unsigned short __Pyx_PyInt_AsUnsignedShort(PyObject *);
-
-static INLINE unsigned int __Pyx_PyInt_AsUnsignedInt(PyObject *);
-
-static INLINE char __Pyx_PyInt_AsChar(PyObject *);
-
-static INLINE short __Pyx_PyInt_AsShort(PyObject *);
-
-static INLINE int __Pyx_PyInt_AsInt(PyObject *);
-
-static INLINE signed char __Pyx_PyInt_AsSignedChar(PyObject *);
-
-static INLINE signed short __Pyx_PyInt_AsSignedShort(PyObject *);
-
-static INLINE signed int __Pyx_PyInt_AsSignedInt(PyObject *);
-
-static INLINE unsigned long __Pyx_PyInt_AsUnsignedLong(PyObject *);
-
-static INLINE unsigned PY_LONG_LONG __Pyx_PyInt_AsUnsignedLongLong(PyObject *);
-
-static INLINE long __Pyx_PyInt_AsLong(PyObject *);
-
-static INLINE PY_LONG_LONG __Pyx_PyInt_AsLongLong(PyObject *);
-
-static INLINE signed long __Pyx_PyInt_AsSignedLong(PyObject *);
-
-static INLINE signed PY_LONG_LONG __Pyx_PyInt_AsSignedLongLong(PyObject *);
-
-static PyTypeObject *__Pyx_ImportType(const char *module_name, const char *class_name, long size);  /*proto*/
-
-static PyObject *__Pyx_ImportModule(const char *name); /*proto*/
-
-static void __Pyx_AddTraceback(const char *funcname); /*proto*/
-
-static int __Pyx_InitStrings(__Pyx_StringTabEntry *t); /*proto*/
-
-/* Type declarations */
-
-typedef unsigned long __pyx_t_4nipy_9neurospin_5group_9onesample_size_t;
-/* Module declarations from numpy */
-
-/* Module declarations from nipy.neurospin.group.onesample */
-
-static PyTypeObject *__pyx_ptype_4nipy_9neurospin_5group_9onesample_dtype = 0;
-static PyTypeObject *__pyx_ptype_4nipy_9neurospin_5group_9onesample_ndarray = 0;
-static PyTypeObject *__pyx_ptype_4nipy_9neurospin_5group_9onesample_flatiter = 0;
-static PyTypeObject *__pyx_ptype_4nipy_9neurospin_5group_9onesample_broadcast = 0;
-#define __Pyx_MODULE_NAME "nipy.neurospin.group.onesample"
-int __pyx_module_is_main_nipy__neurospin__group__onesample = 0;
-
-/* Implementation of nipy.neurospin.group.onesample */
-static char __pyx_k_1[] = "0.1";
-static PyObject *__pyx_int_1;
-static char __pyx_k___main__[] = "__main__";
-static PyObject *__pyx_kp___main__;
-static char __pyx_k_Y[] = "Y";
-static PyObject *__pyx_kp_Y;
-static char __pyx_k_id[] = "id";
-static PyObject *__pyx_kp_id;
-static char __pyx_k_base[] = "base";
-static PyObject *__pyx_kp_base;
-static char __pyx_k_axis[] = "axis";
-static PyObject *__pyx_kp_axis;
-static char __pyx_k_Magics[] = "Magics";
-static PyObject *__pyx_kp_Magics;
-static char __pyx_k_V[] = "V";
-static PyObject *__pyx_kp_V;
-static char __pyx_k_niter[] = "niter";
-static PyObject *__pyx_kp_niter;
-static char __pyx_k_constraint[] = "constraint";
-static PyObject *__pyx_kp_constraint;
-static char __pyx_k___version__[] = "__version__";
-static PyObject *__pyx_kp___version__;
-static char __pyx_k_numpy[] = "numpy";
-static PyObject *__pyx_kp_numpy;
-static char __pyx_k_np[] = "np";
-static PyObject *__pyx_kp_np;
-static char __pyx_k_2[] = "mean";
-static PyObject *__pyx_kp_2;
-static char __pyx_k_3[] = "median";
-static PyObject *__pyx_kp_3;
-static char __pyx_k_4[] = "student";
-static PyObject *__pyx_kp_4;
-static char __pyx_k_5[] = "laplace";
-static PyObject *__pyx_kp_5;
-static char __pyx_k_6[] = "tukey";
-static PyObject *__pyx_kp_6;
-static char __pyx_k_7[] = "sign";
-static PyObject *__pyx_kp_7;
-static char __pyx_k_8[] = "wilcoxon";
-static PyObject *__pyx_kp_8;
-static char __pyx_k_9[] = "elr";
-static PyObject *__pyx_kp_9;
-static char __pyx_k_10[] = "grubb";
-static PyObject *__pyx_kp_10;
-static char __pyx_k_11[] = "mean_mfx";
-static PyObject *__pyx_kp_11;
-static char __pyx_k_12[] = "median_mfx";
-static PyObject *__pyx_kp_12;
-static char __pyx_k_13[] = "mean_gauss_mfx";
-static PyObject *__pyx_kp_13;
-static char __pyx_k_14[] = "student_mfx";
-static PyObject *__pyx_kp_14;
-static char __pyx_k_15[] = "sign_mfx";
-static PyObject *__pyx_kp_15;
-static char __pyx_k_16[] = "wilcoxon_mfx";
-static PyObject *__pyx_kp_16;
-static char __pyx_k_17[] = "elr_mfx";
-static PyObject *__pyx_kp_17;
-static char __pyx_k_stats[] = "stats";
-static PyObject *__pyx_kp_stats;
-static char __pyx_k_18[] = "student";
-static PyObject *__pyx_kp_18;
-static char __pyx_k_19[] = "student_mfx";
-static PyObject *__pyx_kp_19;
-static char __pyx_k_shape[] = "shape";
-static PyObject *__pyx_kp_shape;
-static char __pyx_k_zeros[] = "zeros";
-static PyObject *__pyx_kp_zeros;
-static PyObject *__pyx_kp_1;
-
-/* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\group\onesample.pyx":90
- * 
- * # Test stat without mixed-effect correction
- * def stat(ndarray Y, id='student', double base=0.0,             # <<<<<<<<<<<<<<
- *          int axis=0, ndarray Magics=None):
- *   """
- */
-
-static PyObject *__pyx_pf_4nipy_9neurospin_5group_9onesample_stat(PyObject *__pyx_self, PyObject *__pyx_args, PyObject *__pyx_kwds); /*proto*/
-static char __pyx_doc_4nipy_9neurospin_5group_9onesample_stat[] = "\n  T = stat(Y, id='student', base=0.0, axis=0, magics=None).\n  \n  Compute a one-sample test statistic over a number of deterministic\n  or random permutations. \n  ";
-static PyObject *__pyx_pf_4nipy_9neurospin_5group_9onesample_stat(PyObject *__pyx_self, PyObject *__pyx_args, PyObject *__pyx_kwds) {
-  PyArrayObject *__pyx_v_Y = 0;
-  PyObject *__pyx_v_id = 0;
-  double __pyx_v_base;
-  int __pyx_v_axis;
-  PyArrayObject *__pyx_v_Magics = 0;
-  fff_vector *__pyx_v_y;
-  fff_vector *__pyx_v_t;
-  fff_vector *__pyx_v_magics;
-  fff_vector *__pyx_v_yp;
-  fff_onesample_stat *__pyx_v_stat;
-  fff_onesample_stat_flag __pyx_v_flag_stat;
-  unsigned int __pyx_v_n;
-  unsigned long __pyx_v_simu;
-  unsigned long __pyx_v_nsimu;
-  unsigned long __pyx_v_idx;
-  double __pyx_v_magic;
-  fffpy_multi_iterator *__pyx_v_multi;
-  PyObject *__pyx_v_dims;
-  PyObject *__pyx_v_T;
-  PyObject *__pyx_r = NULL;
-  PyObject *__pyx_1 = 0;
-  PyObject *__pyx_2 = 0;
-  fff_onesample_stat_flag __pyx_t_1;
-  PyObject *__pyx_t_2 = NULL;
-  int __pyx_t_3;
-  PyObject *__pyx_t_4 = NULL;
-  PyObject *__pyx_t_5 = NULL;
-  unsigned long __pyx_t_6;
-  static PyObject **__pyx_pyargnames[] = {&__pyx_kp_Y,&__pyx_kp_id,&__pyx_kp_base,&__pyx_kp_axis,&__pyx_kp_Magics,0};
-  __Pyx_SetupRefcountContext("stat");
-  __pyx_self = __pyx_self;
-  if (unlikely(__pyx_kwds)) {
-    Py_ssize_t kw_args = PyDict_Size(__pyx_kwds);
-    PyObject* values[5] = {0,0,0,0,0};
-    values[1] = __pyx_kp_18;
-    values[4] = (PyObject*)((PyArrayObject *)Py_None);
-    switch (PyTuple_GET_SIZE(__pyx_args)) {
-      case  5: values[4] = PyTuple_GET_ITEM(__pyx_args, 4);
-      case  4: values[3] = PyTuple_GET_ITEM(__pyx_args, 3);
-      case  3: values[2] = PyTuple_GET_ITEM(__pyx_args, 2);
-      case  2: values[1] = PyTuple_GET_ITEM(__pyx_args, 1);
-      case  1: values[0] = PyTuple_GET_ITEM(__pyx_args, 0);
-      case  0: break;
-      default: goto __pyx_L5_argtuple_error;
-    }
-    switch (PyTuple_GET_SIZE(__pyx_args)) {
-      case  0:
-      values[0] = PyDict_GetItem(__pyx_kwds, __pyx_kp_Y);
-      if (likely(values[0])) kw_args--;
-      else goto __pyx_L5_argtuple_error;
-      case  1:
-      if (kw_args > 0) {
-        PyObject* value = PyDict_GetItem(__pyx_kwds, __pyx_kp_id);
-        if (unlikely(value)) { values[1] = value; kw_args--; }
-      }
-      case  2:
-      if (kw_args > 0) {
-        PyObject* value = PyDict_GetItem(__pyx_kwds, __pyx_kp_base);
-        if (unlikely(value)) { values[2] = value; kw_args--; }
-      }
-      case  3:
-      if (kw_args > 0) {
-        PyObject* value = PyDict_GetItem(__pyx_kwds, __pyx_kp_axis);
-        if (unlikely(value)) { values[3] = value; kw_args--; }
-      }
-      case  4:
-      if (kw_args > 0) {
-        PyObject* value = PyDict_GetItem(__pyx_kwds, __pyx_kp_Magics);
-        if (unlikely(value)) { values[4] = value; kw_args--; }
-      }
-    }
-    if (unlikely(kw_args > 0)) {
-      if (unlikely(__Pyx_ParseOptionalKeywords(__pyx_kwds, __pyx_pyargnames, 0, values, PyTuple_GET_SIZE(__pyx_args), "stat") < 0)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 90; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-    }
-    __pyx_v_Y = ((PyArrayObject *)values[0]);
-    __pyx_v_id = values[1];
-    if (values[2]) {
-      __pyx_v_base = __pyx_PyFloat_AsDouble(values[2]); if (unlikely(PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 90; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-    } else {
-      __pyx_v_base = 0.0;
-    }
-    if (values[3]) {
-      __pyx_v_axis = __Pyx_PyInt_AsInt(values[3]); if (unlikely((__pyx_v_axis == (int)-1) && PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 91; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-    } else {
-      __pyx_v_axis = 0;
-    }
-    __pyx_v_Magics = ((PyArrayObject *)values[4]);
-  } else {
-    __pyx_v_id = __pyx_kp_18;
-    __pyx_v_base = 0.0;
-    __pyx_v_axis = 0;
-    __pyx_v_Magics = ((PyArrayObject *)Py_None);
-    switch (PyTuple_GET_SIZE(__pyx_args)) {
-      case  5: __pyx_v_Magics = ((PyArrayObject *)PyTuple_GET_ITEM(__pyx_args, 4));
-      case  4: __pyx_v_axis = __Pyx_PyInt_AsInt(PyTuple_GET_ITEM(__pyx_args, 3)); if (unlikely((__pyx_v_axis == (int)-1) && PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 91; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-      case  3: __pyx_v_base = __pyx_PyFloat_AsDouble(PyTuple_GET_ITEM(__pyx_args, 2)); if (unlikely(PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 90; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-      case  2: __pyx_v_id = PyTuple_GET_ITEM(__pyx_args, 1);
-      case  1: __pyx_v_Y = ((PyArrayObject *)PyTuple_GET_ITEM(__pyx_args, 0));
-      break;
-      default: goto __pyx_L5_argtuple_error;
-    }
-  }
-  goto __pyx_L4_argument_unpacking_done;
-  __pyx_L5_argtuple_error:;
-  __Pyx_RaiseArgtupleInvalid("stat", 0, 1, 5, PyTuple_GET_SIZE(__pyx_args)); {__pyx_filename = __pyx_f[0]; __pyx_lineno = 90; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-  __pyx_L3_error:;
-  __Pyx_AddTraceback("nipy.neurospin.group.onesample.stat");
-  return NULL;
-  __pyx_L4_argument_unpacking_done:;
-  __pyx_v_dims = Py_None; __Pyx_INCREF(Py_None);
-  __pyx_v_T = Py_None; __Pyx_INCREF(Py_None);
-  if (unlikely(!__Pyx_ArgTypeTest(((PyObject *)__pyx_v_Y), __pyx_ptype_4nipy_9neurospin_5group_9onesample_ndarray, 1, "Y", 0))) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 90; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  if (unlikely(!__Pyx_ArgTypeTest(((PyObject *)__pyx_v_Magics), __pyx_ptype_4nipy_9neurospin_5group_9onesample_ndarray, 1, "Magics", 0))) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 91; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-
-  /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\group\onesample.pyx":100
- *   cdef fff_vector *y, *t, *magics, *yp
- *   cdef fff_onesample_stat* stat
- *   cdef fff_onesample_stat_flag flag_stat = stats[id]             # <<<<<<<<<<<<<<
- *   cdef unsigned int n
- *   cdef unsigned long int simu, nsimu, idx
- */
-  __pyx_1 = __Pyx_GetName(__pyx_m, __pyx_kp_stats); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 100; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_1);
-  __pyx_2 = PyObject_GetItem(__pyx_1, __pyx_v_id); if (!__pyx_2) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 100; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_2);
-  __Pyx_DECREF(__pyx_1); __pyx_1 = 0;
-  __pyx_t_1 = ((fff_onesample_stat_flag)PyInt_AsLong(__pyx_2)); if (unlikely(PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 100; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_DECREF(__pyx_2); __pyx_2 = 0;
-  __pyx_v_flag_stat = __pyx_t_1;
-
-  /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\group\onesample.pyx":107
- * 
- *   # Get number of observations
- *   n = <unsigned int>Y.dimensions[axis]             # <<<<<<<<<<<<<<
- * 
- *   # Read out magic numbers
- */
-  __pyx_v_n = ((unsigned int)(__pyx_v_Y->dimensions[__pyx_v_axis]));
-
-  /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\group\onesample.pyx":110
- * 
- *   # Read out magic numbers
- *   if Magics == None:             # <<<<<<<<<<<<<<
- *     magics = fff_vector_new(1)
- *     magics.data[0] = 0 ## Just to make sure
- */
-  __pyx_t_2 = PyObject_RichCompare(((PyObject *)__pyx_v_Magics), Py_None, Py_EQ); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 110; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_2);
-  __pyx_t_3 = __Pyx_PyObject_IsTrue(__pyx_t_2); if (unlikely(__pyx_t_3 < 0)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 110; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_DECREF(__pyx_t_2); __pyx_t_2 = 0;
-  if (__pyx_t_3) {
-
-    /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\group\onesample.pyx":111
- *   # Read out magic numbers
- *   if Magics == None:
- *     magics = fff_vector_new(1)             # <<<<<<<<<<<<<<
- *     magics.data[0] = 0 ## Just to make sure
- *   else:
- */
-    __pyx_v_magics = fff_vector_new(1);
-
-    /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\group\onesample.pyx":112
- *   if Magics == None:
- *     magics = fff_vector_new(1)
- *     magics.data[0] = 0 ## Just to make sure             # <<<<<<<<<<<<<<
- *   else:
- *     magics = fff_vector_fromPyArray(Magics)
- */
-    (__pyx_v_magics->data[0]) = 0;
-    goto __pyx_L6;
-  }
-  /*else*/ {
-
-    /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\group\onesample.pyx":114
- *     magics.data[0] = 0 ## Just to make sure
- *   else:
- *     magics = fff_vector_fromPyArray(Magics)             # <<<<<<<<<<<<<<
- * 
- *   # Create output array
- */
-    __pyx_v_magics = fff_vector_fromPyArray(__pyx_v_Magics);
-  }
-  __pyx_L6:;
-
-  /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\group\onesample.pyx":117
- * 
- *   # Create output array
- *   nsimu = magics.size             # <<<<<<<<<<<<<<
- *   dims = list(Y.shape)
- *   dims[axis] = nsimu
- */
-  __pyx_v_nsimu = __pyx_v_magics->size;
-
-  /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\group\onesample.pyx":118
- *   # Create output array
- *   nsimu = magics.size
- *   dims = list(Y.shape)             # <<<<<<<<<<<<<<
- *   dims[axis] = nsimu
- *   T = np.zeros(dims)
- */
-  __pyx_t_2 = PyObject_GetAttr(((PyObject *)__pyx_v_Y), __pyx_kp_shape); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 118; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_2);
-  __pyx_t_4 = PyTuple_New(1); if (unlikely(!__pyx_t_4)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 118; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_4));
-  PyTuple_SET_ITEM(__pyx_t_4, 0, __pyx_t_2);
-  __Pyx_GIVEREF(__pyx_t_2);
-  __pyx_t_2 = 0;
-  __pyx_t_2 = PyObject_Call(((PyObject *)((PyObject*)&PyList_Type)), ((PyObject *)__pyx_t_4), NULL); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 118; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_2);
-  __Pyx_DECREF(((PyObject *)__pyx_t_4)); __pyx_t_4 = 0;
-  __Pyx_DECREF(__pyx_v_dims);
-  __pyx_v_dims = __pyx_t_2;
-  __pyx_t_2 = 0;
-
-  /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\group\onesample.pyx":119
- *   nsimu = magics.size
- *   dims = list(Y.shape)
- *   dims[axis] = nsimu             # <<<<<<<<<<<<<<
- *   T = np.zeros(dims)
- * 
- */
-  __pyx_t_2 = PyLong_FromUnsignedLong(__pyx_v_nsimu); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 119; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_2);
-  if (__Pyx_SetItemInt(__pyx_v_dims, __pyx_v_axis, __pyx_t_2, sizeof(int), PyInt_FromLong) < 0) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 119; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_DECREF(__pyx_t_2); __pyx_t_2 = 0;
-
-  /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\group\onesample.pyx":120
- *   dims = list(Y.shape)
- *   dims[axis] = nsimu
- *   T = np.zeros(dims)             # <<<<<<<<<<<<<<
- * 
- *   # Create local structure
- */
-  __pyx_1 = __Pyx_GetName(__pyx_m, __pyx_kp_np); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 120; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_1);
-  __pyx_t_2 = PyObject_GetAttr(__pyx_1, __pyx_kp_zeros); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 120; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_2);
-  __Pyx_DECREF(__pyx_1); __pyx_1 = 0;
-  __pyx_t_4 = PyTuple_New(1); if (unlikely(!__pyx_t_4)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 120; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_4));
-  __Pyx_INCREF(__pyx_v_dims);
-  PyTuple_SET_ITEM(__pyx_t_4, 0, __pyx_v_dims);
-  __Pyx_GIVEREF(__pyx_v_dims);
-  __pyx_t_5 = PyObject_Call(__pyx_t_2, ((PyObject *)__pyx_t_4), NULL); if (unlikely(!__pyx_t_5)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 120; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_5);
-  __Pyx_DECREF(__pyx_t_2); __pyx_t_2 = 0;
-  __Pyx_DECREF(((PyObject *)__pyx_t_4)); __pyx_t_4 = 0;
-  __Pyx_DECREF(__pyx_v_T);
-  __pyx_v_T = __pyx_t_5;
-  __pyx_t_5 = 0;
-
-  /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\group\onesample.pyx":123
- * 
- *   # Create local structure
- *   stat = fff_onesample_stat_new(n, flag_stat, base)             # <<<<<<<<<<<<<<
- *   yp = fff_vector_new(n)
- * 
- */
-  __pyx_v_stat = fff_onesample_stat_new(__pyx_v_n, __pyx_v_flag_stat, __pyx_v_base);
-
-  /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\group\onesample.pyx":124
- *   # Create local structure
- *   stat = fff_onesample_stat_new(n, flag_stat, base)
- *   yp = fff_vector_new(n)             # <<<<<<<<<<<<<<
- * 
- *   # Multi-iterator
- */
-  __pyx_v_yp = fff_vector_new(__pyx_v_n);
-
-  /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\group\onesample.pyx":127
- * 
- *   # Multi-iterator
- *   multi = fffpy_multi_iterator_new(2, axis, <void*>Y, <void*>T)             # <<<<<<<<<<<<<<
- * 
- *   # Vector views
- */
-  __pyx_v_multi = fffpy_multi_iterator_new(2, __pyx_v_axis, ((void *)__pyx_v_Y), ((void *)__pyx_v_T));
-
-  /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\group\onesample.pyx":130
- * 
- *   # Vector views
- *   y = multi.vector[0]             # <<<<<<<<<<<<<<
- *   t = multi.vector[1]
- * 
- */
-  __pyx_v_y = (__pyx_v_multi->vector[0]);
-
-  /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\group\onesample.pyx":131
- *   # Vector views
- *   y = multi.vector[0]
- *   t = multi.vector[1]             # <<<<<<<<<<<<<<
- * 
- *   # Loop
- */
-  __pyx_v_t = (__pyx_v_multi->vector[1]);
-
-  /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\group\onesample.pyx":134
- * 
- *   # Loop
- *   for simu from 0 <= simu < nsimu:             # <<<<<<<<<<<<<<
- * 
- *     # Set the magic number
- */
-  __pyx_t_6 = __pyx_v_nsimu;
-  for (__pyx_v_simu = 0; __pyx_v_simu < __pyx_t_6; __pyx_v_simu++) {
-
-    /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\group\onesample.pyx":137
- * 
- *     # Set the magic number
- *     magic = magics.data[simu*magics.stride]             # <<<<<<<<<<<<<<
- * 
- *     # Reset the multi-iterator
- */
-    __pyx_v_magic = (__pyx_v_magics->data[(__pyx_v_simu * __pyx_v_magics->stride)]);
-
-    /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\group\onesample.pyx":140
- * 
- *     # Reset the multi-iterator
- *     fffpy_multi_iterator_reset(multi);             # <<<<<<<<<<<<<<
- * 
- *     # Perform the loop
- */
-    fffpy_multi_iterator_reset(__pyx_v_multi);
-
-    /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\group\onesample.pyx":143
- * 
- *     # Perform the loop
- *     idx = simu*t.stride             # <<<<<<<<<<<<<<
- *     while(multi.index < multi.size):
- *       fff_onesample_permute_signs(yp, y, magic)
- */
-    __pyx_v_idx = (__pyx_v_simu * __pyx_v_t->stride);
-
-    /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\group\onesample.pyx":144
- *     # Perform the loop
- *     idx = simu*t.stride
- *     while(multi.index < multi.size):             # <<<<<<<<<<<<<<
- *       fff_onesample_permute_signs(yp, y, magic)
- *       t.data[idx] = fff_onesample_stat_eval(stat, yp)
- */
-    while (1) {
-      __pyx_t_3 = (__pyx_v_multi->index < __pyx_v_multi->size);
-      if (!__pyx_t_3) break;
-
-      /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\group\onesample.pyx":145
- *     idx = simu*t.stride
- *     while(multi.index < multi.size):
- *       fff_onesample_permute_signs(yp, y, magic)             # <<<<<<<<<<<<<<
- *       t.data[idx] = fff_onesample_stat_eval(stat, yp)
- *       fffpy_multi_iterator_update(multi)
- */
-      fff_onesample_permute_signs(__pyx_v_yp, __pyx_v_y, __pyx_v_magic);
-
-      /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\group\onesample.pyx":146
- *     while(multi.index < multi.size):
- *       fff_onesample_permute_signs(yp, y, magic)
- *       t.data[idx] = fff_onesample_stat_eval(stat, yp)             # <<<<<<<<<<<<<<
- *       fffpy_multi_iterator_update(multi)
- * 
- */
-      (__pyx_v_t->data[__pyx_v_idx]) = fff_onesample_stat_eval(__pyx_v_stat, __pyx_v_yp);
-
-      /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\group\onesample.pyx":147
- *       fff_onesample_permute_signs(yp, y, magic)
- *       t.data[idx] = fff_onesample_stat_eval(stat, yp)
- *       fffpy_multi_iterator_update(multi)             # <<<<<<<<<<<<<<
- * 
- *   # Free memory
- */
-      fffpy_multi_iterator_update(__pyx_v_multi);
-    }
-  }
-
-  /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\group\onesample.pyx":150
- * 
- *   # Free memory
- *   fffpy_multi_iterator_delete(multi)             # <<<<<<<<<<<<<<
- *   fff_vector_delete(yp)
- *   fff_vector_delete(magics)
- */
-  fffpy_multi_iterator_delete(__pyx_v_multi);
-
-  /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\group\onesample.pyx":151
- *   # Free memory
- *   fffpy_multi_iterator_delete(multi)
- *   fff_vector_delete(yp)             # <<<<<<<<<<<<<<
- *   fff_vector_delete(magics)
- *   fff_onesample_stat_delete(stat)
- */
-  fff_vector_delete(__pyx_v_yp);
-
-  /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\group\onesample.pyx":152
- *   fffpy_multi_iterator_delete(multi)
- *   fff_vector_delete(yp)
- *   fff_vector_delete(magics)             # <<<<<<<<<<<<<<
- *   fff_onesample_stat_delete(stat)
- * 
- */
-  fff_vector_delete(__pyx_v_magics);
-
-  /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\group\onesample.pyx":153
- *   fff_vector_delete(yp)
- *   fff_vector_delete(magics)
- *   fff_onesample_stat_delete(stat)             # <<<<<<<<<<<<<<
- * 
- *   # Return
- */
-  fff_onesample_stat_delete(__pyx_v_stat);
-
-  /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\group\onesample.pyx":156
- * 
- *   # Return
- *   return T             # <<<<<<<<<<<<<<
- * 
- * 
- */
-  __Pyx_XDECREF(__pyx_r);
-  __Pyx_INCREF(__pyx_v_T);
-  __pyx_r = __pyx_v_T;
-  goto __pyx_L0;
-
-  __pyx_r = Py_None; __Pyx_INCREF(Py_None);
-  goto __pyx_L0;
-  __pyx_L1_error:;
-  __Pyx_XDECREF(__pyx_1);
-  __Pyx_XDECREF(__pyx_2);
-  __Pyx_XDECREF(__pyx_t_2);
-  __Pyx_XDECREF(__pyx_t_4);
-  __Pyx_XDECREF(__pyx_t_5);
-  __Pyx_AddTraceback("nipy.neurospin.group.onesample.stat");
-  __pyx_r = NULL;
-  __pyx_L0:;
-  __Pyx_DECREF(__pyx_v_dims);
-  __Pyx_DECREF(__pyx_v_T);
-  __Pyx_XGIVEREF(__pyx_r);
-  __Pyx_FinishRefcountContext();
-  return __pyx_r;
-}
-
-/* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\group\onesample.pyx":159
- * 
- * 
- * def stat_mfx(ndarray Y, ndarray V, id='student_mfx', double base=0.0,             # <<<<<<<<<<<<<<
- *              int axis=0, ndarray Magics=None, unsigned int niter=5):
- *   """
- */
-
-static PyObject *__pyx_pf_4nipy_9neurospin_5group_9onesample_stat_mfx(PyObject *__pyx_self, PyObject *__pyx_args, PyObject *__pyx_kwds); /*proto*/
-static char __pyx_doc_4nipy_9neurospin_5group_9onesample_stat_mfx[] = "\n  T = stat_mfx(Y, V, id='student_mfx', base=0.0, axis=0, magics=None, niter=5).\n  \n  Compute a one-sample test statistic, with mixed-effect correction,\n  over a number of deterministic or random permutations.\n  ";
-static PyObject *__pyx_pf_4nipy_9neurospin_5group_9onesample_stat_mfx(PyObject *__pyx_self, PyObject *__pyx_args, PyObject *__pyx_kwds) {
-  PyArrayObject *__pyx_v_Y = 0;
-  PyArrayObject *__pyx_v_V = 0;
-  PyObject *__pyx_v_id = 0;
-  double __pyx_v_base;
-  int __pyx_v_axis;
-  PyArrayObject *__pyx_v_Magics = 0;
-  unsigned int __pyx_v_niter;
-  fff_vector *__pyx_v_y;
-  fff_vector *__pyx_v_v;
-  fff_vector *__pyx_v_t;
-  fff_vector *__pyx_v_magics;
-  fff_vector *__pyx_v_yp;
-  fff_onesample_stat_mfx *__pyx_v_stat;
-  fff_onesample_stat_flag __pyx_v_flag_stat;
-  int __pyx_v_n;
-  unsigned long __pyx_v_simu;
-  unsigned long __pyx_v_idx;
-  double __pyx_v_magic;
-  fffpy_multi_iterator *__pyx_v_multi;
-  PyObject *__pyx_v_nsimu;
-  PyObject *__pyx_v_dims;
-  PyObject *__pyx_v_T;
-  PyObject *__pyx_r = NULL;
-  PyObject *__pyx_1 = 0;
-  PyObject *__pyx_2 = 0;
-  fff_onesample_stat_flag __pyx_t_1;
-  PyObject *__pyx_t_2 = NULL;
-  int __pyx_t_3;
-  PyObject *__pyx_t_4 = NULL;
-  PyObject *__pyx_t_5 = NULL;
-  unsigned long __pyx_t_6;
-  static PyObject **__pyx_pyargnames[] = {&__pyx_kp_Y,&__pyx_kp_V,&__pyx_kp_id,&__pyx_kp_base,&__pyx_kp_axis,&__pyx_kp_Magics,&__pyx_kp_niter,0};
-  __Pyx_SetupRefcountContext("stat_mfx");
-  __pyx_self = __pyx_self;
-  if (unlikely(__pyx_kwds)) {
-    Py_ssize_t kw_args = PyDict_Size(__pyx_kwds);
-    PyObject* values[7] = {0,0,0,0,0,0,0};
-    values[2] = __pyx_kp_19;
-    values[5] = (PyObject*)((PyArrayObject *)Py_None);
-    switch (PyTuple_GET_SIZE(__pyx_args)) {
-      case  7: values[6] = PyTuple_GET_ITEM(__pyx_args, 6);
-      case  6: values[5] = PyTuple_GET_ITEM(__pyx_args, 5);
-      case  5: values[4] = PyTuple_GET_ITEM(__pyx_args, 4);
-      case  4: values[3] = PyTuple_GET_ITEM(__pyx_args, 3);
-      case  3: values[2] = PyTuple_GET_ITEM(__pyx_args, 2);
-      case  2: values[1] = PyTuple_GET_ITEM(__pyx_args, 1);
-      case  1: values[0] = PyTuple_GET_ITEM(__pyx_args, 0);
-      case  0: break;
-      default: goto __pyx_L5_argtuple_error;
-    }
-    switch (PyTuple_GET_SIZE(__pyx_args)) {
-      case  0:
-      values[0] = PyDict_GetItem(__pyx_kwds, __pyx_kp_Y);
-      if (likely(values[0])) kw_args--;
-      else goto __pyx_L5_argtuple_error;
-      case  1:
-      values[1] = PyDict_GetItem(__pyx_kwds, __pyx_kp_V);
-      if (likely(values[1])) kw_args--;
-      else {
-        __Pyx_RaiseArgtupleInvalid("stat_mfx", 0, 2, 7, 1); {__pyx_filename = __pyx_f[0]; __pyx_lineno = 159; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-      }
-      case  2:
-      if (kw_args > 0) {
-        PyObject* value = PyDict_GetItem(__pyx_kwds, __pyx_kp_id);
-        if (unlikely(value)) { values[2] = value; kw_args--; }
-      }
-      case  3:
-      if (kw_args > 0) {
-        PyObject* value = PyDict_GetItem(__pyx_kwds, __pyx_kp_base);
-        if (unlikely(value)) { values[3] = value; kw_args--; }
-      }
-      case  4:
-      if (kw_args > 0) {
-        PyObject* value = PyDict_GetItem(__pyx_kwds, __pyx_kp_axis);
-        if (unlikely(value)) { values[4] = value; kw_args--; }
-      }
-      case  5:
-      if (kw_args > 0) {
-        PyObject* value = PyDict_GetItem(__pyx_kwds, __pyx_kp_Magics);
-        if (unlikely(value)) { values[5] = value; kw_args--; }
-      }
-      case  6:
-      if (kw_args > 0) {
-        PyObject* value = PyDict_GetItem(__pyx_kwds, __pyx_kp_niter);
-        if (unlikely(value)) { values[6] = value; kw_args--; }
-      }
-    }
-    if (unlikely(kw_args > 0)) {
-      if (unlikely(__Pyx_ParseOptionalKeywords(__pyx_kwds, __pyx_pyargnames, 0, values, PyTuple_GET_SIZE(__pyx_args), "stat_mfx") < 0)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 159; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-    }
-    __pyx_v_Y = ((PyArrayObject *)values[0]);
-    __pyx_v_V = ((PyArrayObject *)values[1]);
-    __pyx_v_id = values[2];
-    if (values[3]) {
-      __pyx_v_base = __pyx_PyFloat_AsDouble(values[3]); if (unlikely(PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 159; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-    } else {
-      __pyx_v_base = 0.0;
-    }
-    if (values[4]) {
-      __pyx_v_axis = __Pyx_PyInt_AsInt(values[4]); if (unlikely((__pyx_v_axis == (int)-1) && PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 160; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-    } else {
-      __pyx_v_axis = 0;
-    }
-    __pyx_v_Magics = ((PyArrayObject *)values[5]);
-    if (values[6]) {
-      __pyx_v_niter = __Pyx_PyInt_AsUnsignedInt(values[6]); if (unlikely((__pyx_v_niter == (unsigned int)-1) && PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 160; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-    } else {
-      __pyx_v_niter = 5;
-    }
-  } else {
-    __pyx_v_id = __pyx_kp_19;
-    __pyx_v_base = 0.0;
-    __pyx_v_axis = 0;
-    __pyx_v_Magics = ((PyArrayObject *)Py_None);
-    __pyx_v_niter = 5;
-    switch (PyTuple_GET_SIZE(__pyx_args)) {
-      case  7:
-      __pyx_v_niter = __Pyx_PyInt_AsUnsignedInt(PyTuple_GET_ITEM(__pyx_args, 6)); if (unlikely((__pyx_v_niter == (unsigned int)-1) && PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 160; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-      case  6:
-      __pyx_v_Magics = ((PyArrayObject *)PyTuple_GET_ITEM(__pyx_args, 5));
-      case  5:
-      __pyx_v_axis = __Pyx_PyInt_AsInt(PyTuple_GET_ITEM(__pyx_args, 4)); if (unlikely((__pyx_v_axis == (int)-1) && PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 160; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-      case  4:
-      __pyx_v_base = __pyx_PyFloat_AsDouble(PyTuple_GET_ITEM(__pyx_args, 3)); if (unlikely(PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 159; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-      case  3:
-      __pyx_v_id = PyTuple_GET_ITEM(__pyx_args, 2);
-      case  2:
-      __pyx_v_V = ((PyArrayObject *)PyTuple_GET_ITEM(__pyx_args, 1));
-      __pyx_v_Y = ((PyArrayObject *)PyTuple_GET_ITEM(__pyx_args, 0));
-      break;
-      default: goto __pyx_L5_argtuple_error;
-    }
-  }
-  goto __pyx_L4_argument_unpacking_done;
-  __pyx_L5_argtuple_error:;
-  __Pyx_RaiseArgtupleInvalid("stat_mfx", 0, 2, 7, PyTuple_GET_SIZE(__pyx_args)); {__pyx_filename = __pyx_f[0]; __pyx_lineno = 159; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-  __pyx_L3_error:;
-  __Pyx_AddTraceback("nipy.neurospin.group.onesample.stat_mfx");
-  return NULL;
-  __pyx_L4_argument_unpacking_done:;
-  __pyx_v_nsimu = Py_None; __Pyx_INCREF(Py_None);
-  __pyx_v_dims = Py_None; __Pyx_INCREF(Py_None);
-  __pyx_v_T = Py_None; __Pyx_INCREF(Py_None);
-  if (unlikely(!__Pyx_ArgTypeTest(((PyObject *)__pyx_v_Y), __pyx_ptype_4nipy_9neurospin_5group_9onesample_ndarray, 1, "Y", 0))) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 159; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  if (unlikely(!__Pyx_ArgTypeTest(((PyObject *)__pyx_v_V), __pyx_ptype_4nipy_9neurospin_5group_9onesample_ndarray, 1, "V", 0))) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 159; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  if (unlikely(!__Pyx_ArgTypeTest(((PyObject *)__pyx_v_Magics), __pyx_ptype_4nipy_9neurospin_5group_9onesample_ndarray, 1, "Magics", 0))) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 160; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-
-  /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\group\onesample.pyx":169
- *   cdef fff_vector *y, *v, *t, *magics, *yp
- *   cdef fff_onesample_stat_mfx* stat
- *   cdef fff_onesample_stat_flag flag_stat = stats[id]             # <<<<<<<<<<<<<<
- *   cdef int n
- *   cdef unsigned long int nsimu_max, simu, idx
- */
-  __pyx_1 = __Pyx_GetName(__pyx_m, __pyx_kp_stats); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 169; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_1);
-  __pyx_2 = PyObject_GetItem(__pyx_1, __pyx_v_id); if (!__pyx_2) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 169; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_2);
-  __Pyx_DECREF(__pyx_1); __pyx_1 = 0;
-  __pyx_t_1 = ((fff_onesample_stat_flag)PyInt_AsLong(__pyx_2)); if (unlikely(PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 169; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_DECREF(__pyx_2); __pyx_2 = 0;
-  __pyx_v_flag_stat = __pyx_t_1;
-
-  /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\group\onesample.pyx":176
- * 
- *   # Get number of observations
- *   n = <int>Y.dimensions[axis]             # <<<<<<<<<<<<<<
- * 
- *   # Read out magic numbers
- */
-  __pyx_v_n = ((int)(__pyx_v_Y->dimensions[__pyx_v_axis]));
-
-  /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\group\onesample.pyx":179
- * 
- *   # Read out magic numbers
- *   if Magics == None:             # <<<<<<<<<<<<<<
- *     magics = fff_vector_new(1)
- *     magics.data[0] = 0 ## Just to make sure
- */
-  __pyx_t_2 = PyObject_RichCompare(((PyObject *)__pyx_v_Magics), Py_None, Py_EQ); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 179; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_2);
-  __pyx_t_3 = __Pyx_PyObject_IsTrue(__pyx_t_2); if (unlikely(__pyx_t_3 < 0)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 179; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_DECREF(__pyx_t_2); __pyx_t_2 = 0;
-  if (__pyx_t_3) {
-
-    /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\group\onesample.pyx":180
- *   # Read out magic numbers
- *   if Magics == None:
- *     magics = fff_vector_new(1)             # <<<<<<<<<<<<<<
- *     magics.data[0] = 0 ## Just to make sure
- *   else:
- */
-    __pyx_v_magics = fff_vector_new(1);
-
-    /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\group\onesample.pyx":181
- *   if Magics == None:
- *     magics = fff_vector_new(1)
- *     magics.data[0] = 0 ## Just to make sure             # <<<<<<<<<<<<<<
- *   else:
- *     magics = fff_vector_fromPyArray(Magics)
- */
-    (__pyx_v_magics->data[0]) = 0;
-    goto __pyx_L6;
-  }
-  /*else*/ {
-
-    /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\group\onesample.pyx":183
- *     magics.data[0] = 0 ## Just to make sure
- *   else:
- *     magics = fff_vector_fromPyArray(Magics)             # <<<<<<<<<<<<<<
- * 
- *   # Create output array
- */
-    __pyx_v_magics = fff_vector_fromPyArray(__pyx_v_Magics);
-  }
-  __pyx_L6:;
-
-  /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\group\onesample.pyx":186
- * 
- *   # Create output array
- *   nsimu = magics.size             # <<<<<<<<<<<<<<
- *   dims = list(Y.shape)
- *   dims[axis] = nsimu
- */
-  __pyx_t_2 = __Pyx_PyInt_FromSize_t(__pyx_v_magics->size); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 186; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_2);
-  __Pyx_DECREF(__pyx_v_nsimu);
-  __pyx_v_nsimu = __pyx_t_2;
-  __pyx_t_2 = 0;
-
-  /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\group\onesample.pyx":187
- *   # Create output array
- *   nsimu = magics.size
- *   dims = list(Y.shape)             # <<<<<<<<<<<<<<
- *   dims[axis] = nsimu
- *   T = np.zeros(dims)
- */
-  __pyx_t_2 = PyObject_GetAttr(((PyObject *)__pyx_v_Y), __pyx_kp_shape); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 187; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_2);
-  __pyx_t_4 = PyTuple_New(1); if (unlikely(!__pyx_t_4)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 187; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_4));
-  PyTuple_SET_ITEM(__pyx_t_4, 0, __pyx_t_2);
-  __Pyx_GIVEREF(__pyx_t_2);
-  __pyx_t_2 = 0;
-  __pyx_t_2 = PyObject_Call(((PyObject *)((PyObject*)&PyList_Type)), ((PyObject *)__pyx_t_4), NULL); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 187; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_2);
-  __Pyx_DECREF(((PyObject *)__pyx_t_4)); __pyx_t_4 = 0;
-  __Pyx_DECREF(__pyx_v_dims);
-  __pyx_v_dims = __pyx_t_2;
-  __pyx_t_2 = 0;
-
-  /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\group\onesample.pyx":188
- *   nsimu = magics.size
- *   dims = list(Y.shape)
- *   dims[axis] = nsimu             # <<<<<<<<<<<<<<
- *   T = np.zeros(dims)
- * 
- */
-  if (__Pyx_SetItemInt(__pyx_v_dims, __pyx_v_axis, __pyx_v_nsimu, sizeof(int), PyInt_FromLong) < 0) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 188; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-
-  /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\group\onesample.pyx":189
- *   dims = list(Y.shape)
- *   dims[axis] = nsimu
- *   T = np.zeros(dims)             # <<<<<<<<<<<<<<
- * 
- *   # Create local structure
- */
-  __pyx_1 = __Pyx_GetName(__pyx_m, __pyx_kp_np); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 189; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_1);
-  __pyx_t_2 = PyObject_GetAttr(__pyx_1, __pyx_kp_zeros); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 189; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_2);
-  __Pyx_DECREF(__pyx_1); __pyx_1 = 0;
-  __pyx_t_4 = PyTuple_New(1); if (unlikely(!__pyx_t_4)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 189; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_4));
-  __Pyx_INCREF(__pyx_v_dims);
-  PyTuple_SET_ITEM(__pyx_t_4, 0, __pyx_v_dims);
-  __Pyx_GIVEREF(__pyx_v_dims);
-  __pyx_t_5 = PyObject_Call(__pyx_t_2, ((PyObject *)__pyx_t_4), NULL); if (unlikely(!__pyx_t_5)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 189; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_5);
-  __Pyx_DECREF(__pyx_t_2); __pyx_t_2 = 0;
-  __Pyx_DECREF(((PyObject *)__pyx_t_4)); __pyx_t_4 = 0;
-  __Pyx_DECREF(__pyx_v_T);
-  __pyx_v_T = __pyx_t_5;
-  __pyx_t_5 = 0;
-
-  /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\group\onesample.pyx":192
- * 
- *   # Create local structure
- *   stat = fff_onesample_stat_mfx_new(n, flag_stat, base)             # <<<<<<<<<<<<<<
- *   stat.niter = niter
- *   yp = fff_vector_new(n)
- */
-  __pyx_v_stat = fff_onesample_stat_mfx_new(__pyx_v_n, __pyx_v_flag_stat, __pyx_v_base);
-
-  /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\group\onesample.pyx":193
- *   # Create local structure
- *   stat = fff_onesample_stat_mfx_new(n, flag_stat, base)
- *   stat.niter = niter             # <<<<<<<<<<<<<<
- *   yp = fff_vector_new(n)
- * 
- */
-  __pyx_v_stat->niter = __pyx_v_niter;
-
-  /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\group\onesample.pyx":194
- *   stat = fff_onesample_stat_mfx_new(n, flag_stat, base)
- *   stat.niter = niter
- *   yp = fff_vector_new(n)             # <<<<<<<<<<<<<<
- * 
- *   # Multi-iterator
- */
-  __pyx_v_yp = fff_vector_new(__pyx_v_n);
-
-  /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\group\onesample.pyx":197
- * 
- *   # Multi-iterator
- *   multi = fffpy_multi_iterator_new(3, axis, <void*>Y, <void*>V, <void*>T)             # <<<<<<<<<<<<<<
- * 
- *   # Vector views
- */
-  __pyx_v_multi = fffpy_multi_iterator_new(3, __pyx_v_axis, ((void *)__pyx_v_Y), ((void *)__pyx_v_V), ((void *)__pyx_v_T));
-
-  /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\group\onesample.pyx":200
- * 
- *   # Vector views
- *   y = multi.vector[0]             # <<<<<<<<<<<<<<
- *   v = multi.vector[1]
- *   t = multi.vector[2]
- */
-  __pyx_v_y = (__pyx_v_multi->vector[0]);
-
-  /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\group\onesample.pyx":201
- *   # Vector views
- *   y = multi.vector[0]
- *   v = multi.vector[1]             # <<<<<<<<<<<<<<
- *   t = multi.vector[2]
- * 
- */
-  __pyx_v_v = (__pyx_v_multi->vector[1]);
-
-  /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\group\onesample.pyx":202
- *   y = multi.vector[0]
- *   v = multi.vector[1]
- *   t = multi.vector[2]             # <<<<<<<<<<<<<<
- * 
- *   # Loop
- */
-  __pyx_v_t = (__pyx_v_multi->vector[2]);
-
-  /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\group\onesample.pyx":205
- * 
- *   # Loop
- *   for simu from 0 <= simu < nsimu:             # <<<<<<<<<<<<<<
- * 
- *     # Set the magic number
- */
-  __pyx_t_6 = __Pyx_PyInt_AsUnsignedLong(__pyx_v_nsimu); if (unlikely((__pyx_t_6 == (unsigned long)-1) && PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 205; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  for (__pyx_v_simu = 0; __pyx_v_simu < __pyx_t_6; __pyx_v_simu++) {
-
-    /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\group\onesample.pyx":208
- * 
- *     # Set the magic number
- *     magic = magics.data[simu*magics.stride]             # <<<<<<<<<<<<<<
- * 
- *     # Reset the multi-iterator
- */
-    __pyx_v_magic = (__pyx_v_magics->data[(__pyx_v_simu * __pyx_v_magics->stride)]);
-
-    /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\group\onesample.pyx":211
- * 
- *     # Reset the multi-iterator
- *     fffpy_multi_iterator_reset(multi)             # <<<<<<<<<<<<<<
- * 
- *     # Perform the loop
- */
-    fffpy_multi_iterator_reset(__pyx_v_multi);
-
-    /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\group\onesample.pyx":214
- * 
- *     # Perform the loop
- *     idx = simu*t.stride             # <<<<<<<<<<<<<<
- *     while(multi.index < multi.size):
- *       fff_onesample_permute_signs(yp, y, magic)
- */
-    __pyx_v_idx = (__pyx_v_simu * __pyx_v_t->stride);
-
-    /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\group\onesample.pyx":215
- *     # Perform the loop
- *     idx = simu*t.stride
- *     while(multi.index < multi.size):             # <<<<<<<<<<<<<<
- *       fff_onesample_permute_signs(yp, y, magic)
- *       t.data[idx] = fff_onesample_stat_mfx_eval(stat, yp, v)
- */
-    while (1) {
-      __pyx_t_3 = (__pyx_v_multi->index < __pyx_v_multi->size);
-      if (!__pyx_t_3) break;
-
-      /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\group\onesample.pyx":216
- *     idx = simu*t.stride
- *     while(multi.index < multi.size):
- *       fff_onesample_permute_signs(yp, y, magic)             # <<<<<<<<<<<<<<
- *       t.data[idx] = fff_onesample_stat_mfx_eval(stat, yp, v)
- *       fffpy_multi_iterator_update(multi)
- */
-      fff_onesample_permute_signs(__pyx_v_yp, __pyx_v_y, __pyx_v_magic);
-
-      /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\group\onesample.pyx":217
- *     while(multi.index < multi.size):
- *       fff_onesample_permute_signs(yp, y, magic)
- *       t.data[idx] = fff_onesample_stat_mfx_eval(stat, yp, v)             # <<<<<<<<<<<<<<
- *       fffpy_multi_iterator_update(multi)
- * 
- */
-      (__pyx_v_t->data[__pyx_v_idx]) = fff_onesample_stat_mfx_eval(__pyx_v_stat, __pyx_v_yp, __pyx_v_v);
-
-      /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\group\onesample.pyx":218
- *       fff_onesample_permute_signs(yp, y, magic)
- *       t.data[idx] = fff_onesample_stat_mfx_eval(stat, yp, v)
- *       fffpy_multi_iterator_update(multi)             # <<<<<<<<<<<<<<
- * 
- * 
- */
-      fffpy_multi_iterator_update(__pyx_v_multi);
-    }
-  }
-
-  /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\group\onesample.pyx":222
- * 
- *   # Free memory
- *   fffpy_multi_iterator_delete(multi)             # <<<<<<<<<<<<<<
- *   fff_vector_delete(yp)
- *   fff_vector_delete(magics)
- */
-  fffpy_multi_iterator_delete(__pyx_v_multi);
-
-  /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\group\onesample.pyx":223
- *   # Free memory
- *   fffpy_multi_iterator_delete(multi)
- *   fff_vector_delete(yp)             # <<<<<<<<<<<<<<
- *   fff_vector_delete(magics)
- *   fff_onesample_stat_mfx_delete(stat)
- */
-  fff_vector_delete(__pyx_v_yp);
-
-  /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\group\onesample.pyx":224
- *   fffpy_multi_iterator_delete(multi)
- *   fff_vector_delete(yp)
- *   fff_vector_delete(magics)             # <<<<<<<<<<<<<<
- *   fff_onesample_stat_mfx_delete(stat)
- * 
- */
-  fff_vector_delete(__pyx_v_magics);
-
-  /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\group\onesample.pyx":225
- *   fff_vector_delete(yp)
- *   fff_vector_delete(magics)
- *   fff_onesample_stat_mfx_delete(stat)             # <<<<<<<<<<<<<<
- * 
- *   # Return
- */
-  fff_onesample_stat_mfx_delete(__pyx_v_stat);
-
-  /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\group\onesample.pyx":228
- * 
- *   # Return
- *   return T             # <<<<<<<<<<<<<<
- * 
- * 
- */
-  __Pyx_XDECREF(__pyx_r);
-  __Pyx_INCREF(__pyx_v_T);
-  __pyx_r = __pyx_v_T;
-  goto __pyx_L0;
-
-  __pyx_r = Py_None; __Pyx_INCREF(Py_None);
-  goto __pyx_L0;
-  __pyx_L1_error:;
-  __Pyx_XDECREF(__pyx_1);
-  __Pyx_XDECREF(__pyx_2);
-  __Pyx_XDECREF(__pyx_t_2);
-  __Pyx_XDECREF(__pyx_t_4);
-  __Pyx_XDECREF(__pyx_t_5);
-  __Pyx_AddTraceback("nipy.neurospin.group.onesample.stat_mfx");
-  __pyx_r = NULL;
-  __pyx_L0:;
-  __Pyx_DECREF(__pyx_v_nsimu);
-  __Pyx_DECREF(__pyx_v_dims);
-  __Pyx_DECREF(__pyx_v_T);
-  __Pyx_XGIVEREF(__pyx_r);
-  __Pyx_FinishRefcountContext();
-  return __pyx_r;
-}
-
-/* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\group\onesample.pyx":232
- * 
- * 
- * def pdf_fit_mfx(ndarray Y, ndarray V, int axis=0, int niter=5, int constraint=0, double base=0.0):             # <<<<<<<<<<<<<<
- *   """
- *   (W, Z) = pdf_fit_mfx(data=Y, vardata=V, axis=0, niter=5, constraint=False, base=0.0).
- */
-
-static PyObject *__pyx_pf_4nipy_9neurospin_5group_9onesample_pdf_fit_mfx(PyObject *__pyx_self, PyObject *__pyx_args, PyObject *__pyx_kwds); /*proto*/
-static char __pyx_doc_4nipy_9neurospin_5group_9onesample_pdf_fit_mfx[] = "\n  (W, Z) = pdf_fit_mfx(data=Y, vardata=V, axis=0, niter=5, constraint=False, base=0.0).\n  \n  Comments to follow.\n  ";
-static PyObject *__pyx_pf_4nipy_9neurospin_5group_9onesample_pdf_fit_mfx(PyObject *__pyx_self, PyObject *__pyx_args, PyObject *__pyx_kwds) {
-  PyArrayObject *__pyx_v_Y = 0;
-  PyArrayObject *__pyx_v_V = 0;
-  int __pyx_v_axis;
-  int __pyx_v_niter;
-  int __pyx_v_constraint;
-  double __pyx_v_base;
-  fff_vector *__pyx_v_y;
-  fff_vector *__pyx_v_v;
-  fff_vector *__pyx_v_w;
-  fff_vector *__pyx_v_z;
-  fff_onesample_stat_mfx *__pyx_v_stat;
-  fffpy_multi_iterator *__pyx_v_multi;
-  int __pyx_v_n;
-  PyObject *__pyx_v_dims;
-  PyObject *__pyx_v_W;
-  PyObject *__pyx_v_Z;
-  PyObject *__pyx_r = NULL;
-  PyObject *__pyx_1 = 0;
-  PyObject *__pyx_t_1 = NULL;
-  PyObject *__pyx_t_2 = NULL;
-  PyObject *__pyx_t_3 = NULL;
-  int __pyx_t_4;
-  static PyObject **__pyx_pyargnames[] = {&__pyx_kp_Y,&__pyx_kp_V,&__pyx_kp_axis,&__pyx_kp_niter,&__pyx_kp_constraint,&__pyx_kp_base,0};
-  __Pyx_SetupRefcountContext("pdf_fit_mfx");
-  __pyx_self = __pyx_self;
-  if (unlikely(__pyx_kwds)) {
-    Py_ssize_t kw_args = PyDict_Size(__pyx_kwds);
-    PyObject* values[6] = {0,0,0,0,0,0};
-    switch (PyTuple_GET_SIZE(__pyx_args)) {
-      case  6: values[5] = PyTuple_GET_ITEM(__pyx_args, 5);
-      case  5: values[4] = PyTuple_GET_ITEM(__pyx_args, 4);
-      case  4: values[3] = PyTuple_GET_ITEM(__pyx_args, 3);
-      case  3: values[2] = PyTuple_GET_ITEM(__pyx_args, 2);
-      case  2: values[1] = PyTuple_GET_ITEM(__pyx_args, 1);
-      case  1: values[0] = PyTuple_GET_ITEM(__pyx_args, 0);
-      case  0: break;
-      default: goto __pyx_L5_argtuple_error;
-    }
-    switch (PyTuple_GET_SIZE(__pyx_args)) {
-      case  0:
-      values[0] = PyDict_GetItem(__pyx_kwds, __pyx_kp_Y);
-      if (likely(values[0])) kw_args--;
-      else goto __pyx_L5_argtuple_error;
-      case  1:
-      values[1] = PyDict_GetItem(__pyx_kwds, __pyx_kp_V);
-      if (likely(values[1])) kw_args--;
-      else {
-        __Pyx_RaiseArgtupleInvalid("pdf_fit_mfx", 0, 2, 6, 1); {__pyx_filename = __pyx_f[0]; __pyx_lineno = 232; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-      }
-      case  2:
-      if (kw_args > 0) {
-        PyObject* value = PyDict_GetItem(__pyx_kwds, __pyx_kp_axis);
-        if (unlikely(value)) { values[2] = value; kw_args--; }
-      }
-      case  3:
-      if (kw_args > 0) {
-        PyObject* value = PyDict_GetItem(__pyx_kwds, __pyx_kp_niter);
-        if (unlikely(value)) { values[3] = value; kw_args--; }
-      }
-      case  4:
-      if (kw_args > 0) {
-        PyObject* value = PyDict_GetItem(__pyx_kwds, __pyx_kp_constraint);
-        if (unlikely(value)) { values[4] = value; kw_args--; }
-      }
-      case  5:
-      if (kw_args > 0) {
-        PyObject* value = PyDict_GetItem(__pyx_kwds, __pyx_kp_base);
-        if (unlikely(value)) { values[5] = value; kw_args--; }
-      }
-    }
-    if (unlikely(kw_args > 0)) {
-      if (unlikely(__Pyx_ParseOptionalKeywords(__pyx_kwds, __pyx_pyargnames, 0, values, PyTuple_GET_SIZE(__pyx_args), "pdf_fit_mfx") < 0)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 232; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-    }
-    __pyx_v_Y = ((PyArrayObject *)values[0]);
-    __pyx_v_V = ((PyArrayObject *)values[1]);
-    if (values[2]) {
-      __pyx_v_axis = __Pyx_PyInt_AsInt(values[2]); if (unlikely((__pyx_v_axis == (int)-1) && PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 232; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-    } else {
-      __pyx_v_axis = 0;
-    }
-    if (values[3]) {
-      __pyx_v_niter = __Pyx_PyInt_AsInt(values[3]); if (unlikely((__pyx_v_niter == (int)-1) && PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 232; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-    } else {
-      __pyx_v_niter = 5;
-    }
-    if (values[4]) {
-      __pyx_v_constraint = __Pyx_PyInt_AsInt(values[4]); if (unlikely((__pyx_v_constraint == (int)-1) && PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 232; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-    } else {
-      __pyx_v_constraint = 0;
-    }
-    if (values[5]) {
-      __pyx_v_base = __pyx_PyFloat_AsDouble(values[5]); if (unlikely(PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 232; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-    } else {
-      __pyx_v_base = 0.0;
-    }
-  } else {
-    __pyx_v_axis = 0;
-    __pyx_v_niter = 5;
-    __pyx_v_constraint = 0;
-    __pyx_v_base = 0.0;
-    switch (PyTuple_GET_SIZE(__pyx_args)) {
-      case  6:
-      __pyx_v_base = __pyx_PyFloat_AsDouble(PyTuple_GET_ITEM(__pyx_args, 5)); if (unlikely(PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 232; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-      case  5:
-      __pyx_v_constraint = __Pyx_PyInt_AsInt(PyTuple_GET_ITEM(__pyx_args, 4)); if (unlikely((__pyx_v_constraint == (int)-1) && PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 232; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-      case  4:
-      __pyx_v_niter = __Pyx_PyInt_AsInt(PyTuple_GET_ITEM(__pyx_args, 3)); if (unlikely((__pyx_v_niter == (int)-1) && PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 232; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-      case  3:
-      __pyx_v_axis = __Pyx_PyInt_AsInt(PyTuple_GET_ITEM(__pyx_args, 2)); if (unlikely((__pyx_v_axis == (int)-1) && PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 232; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-      case  2:
-      __pyx_v_V = ((PyArrayObject *)PyTuple_GET_ITEM(__pyx_args, 1));
-      __pyx_v_Y = ((PyArrayObject *)PyTuple_GET_ITEM(__pyx_args, 0));
-      break;
-      default: goto __pyx_L5_argtuple_error;
-    }
-  }
-  goto __pyx_L4_argument_unpacking_done;
-  __pyx_L5_argtuple_error:;
-  __Pyx_RaiseArgtupleInvalid("pdf_fit_mfx", 0, 2, 6, PyTuple_GET_SIZE(__pyx_args)); {__pyx_filename = __pyx_f[0]; __pyx_lineno = 232; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-  __pyx_L3_error:;
-  __Pyx_AddTraceback("nipy.neurospin.group.onesample.pdf_fit_mfx");
-  return NULL;
-  __pyx_L4_argument_unpacking_done:;
-  __pyx_v_dims = Py_None; __Pyx_INCREF(Py_None);
-  __pyx_v_W = Py_None; __Pyx_INCREF(Py_None);
-  __pyx_v_Z = Py_None; __Pyx_INCREF(Py_None);
-  if (unlikely(!__Pyx_ArgTypeTest(((PyObject *)__pyx_v_Y), __pyx_ptype_4nipy_9neurospin_5group_9onesample_ndarray, 1, "Y", 0))) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 232; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  if (unlikely(!__Pyx_ArgTypeTest(((PyObject *)__pyx_v_V), __pyx_ptype_4nipy_9neurospin_5group_9onesample_ndarray, 1, "V", 0))) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 232; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-
-  /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\group\onesample.pyx":241
- *   cdef fff_onesample_stat_mfx* stat
- *   cdef fffpy_multi_iterator* multi
- *   cdef int n = Y.dimensions[axis]             # <<<<<<<<<<<<<<
- * 
- *   # Create output array
- */
-  __pyx_v_n = (__pyx_v_Y->dimensions[__pyx_v_axis]);
-
-  /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\group\onesample.pyx":244
- * 
- *   # Create output array
- *   dims = list(Y.shape)             # <<<<<<<<<<<<<<
- *   W = np.zeros(dims)
- *   Z = np.zeros(dims)
- */
-  __pyx_t_1 = PyObject_GetAttr(((PyObject *)__pyx_v_Y), __pyx_kp_shape); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 244; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_1);
-  __pyx_t_2 = PyTuple_New(1); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 244; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_2));
-  PyTuple_SET_ITEM(__pyx_t_2, 0, __pyx_t_1);
-  __Pyx_GIVEREF(__pyx_t_1);
-  __pyx_t_1 = 0;
-  __pyx_t_1 = PyObject_Call(((PyObject *)((PyObject*)&PyList_Type)), ((PyObject *)__pyx_t_2), NULL); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 244; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_1);
-  __Pyx_DECREF(((PyObject *)__pyx_t_2)); __pyx_t_2 = 0;
-  __Pyx_DECREF(__pyx_v_dims);
-  __pyx_v_dims = __pyx_t_1;
-  __pyx_t_1 = 0;
-
-  /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\group\onesample.pyx":245
- *   # Create output array
- *   dims = list(Y.shape)
- *   W = np.zeros(dims)             # <<<<<<<<<<<<<<
- *   Z = np.zeros(dims)
- * 
- */
-  __pyx_1 = __Pyx_GetName(__pyx_m, __pyx_kp_np); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 245; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_1);
-  __pyx_t_1 = PyObject_GetAttr(__pyx_1, __pyx_kp_zeros); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 245; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_1);
-  __Pyx_DECREF(__pyx_1); __pyx_1 = 0;
-  __pyx_t_2 = PyTuple_New(1); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 245; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_2));
-  __Pyx_INCREF(__pyx_v_dims);
-  PyTuple_SET_ITEM(__pyx_t_2, 0, __pyx_v_dims);
-  __Pyx_GIVEREF(__pyx_v_dims);
-  __pyx_t_3 = PyObject_Call(__pyx_t_1, ((PyObject *)__pyx_t_2), NULL); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 245; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_3);
-  __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-  __Pyx_DECREF(((PyObject *)__pyx_t_2)); __pyx_t_2 = 0;
-  __Pyx_DECREF(__pyx_v_W);
-  __pyx_v_W = __pyx_t_3;
-  __pyx_t_3 = 0;
-
-  /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\group\onesample.pyx":246
- *   dims = list(Y.shape)
- *   W = np.zeros(dims)
- *   Z = np.zeros(dims)             # <<<<<<<<<<<<<<
- * 
- *   # Create local structure
- */
-  __pyx_1 = __Pyx_GetName(__pyx_m, __pyx_kp_np); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 246; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_1);
-  __pyx_t_3 = PyObject_GetAttr(__pyx_1, __pyx_kp_zeros); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 246; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_3);
-  __Pyx_DECREF(__pyx_1); __pyx_1 = 0;
-  __pyx_t_2 = PyTuple_New(1); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 246; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_2));
-  __Pyx_INCREF(__pyx_v_dims);
-  PyTuple_SET_ITEM(__pyx_t_2, 0, __pyx_v_dims);
-  __Pyx_GIVEREF(__pyx_v_dims);
-  __pyx_t_1 = PyObject_Call(__pyx_t_3, ((PyObject *)__pyx_t_2), NULL); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 246; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_1);
-  __Pyx_DECREF(__pyx_t_3); __pyx_t_3 = 0;
-  __Pyx_DECREF(((PyObject *)__pyx_t_2)); __pyx_t_2 = 0;
-  __Pyx_DECREF(__pyx_v_Z);
-  __pyx_v_Z = __pyx_t_1;
-  __pyx_t_1 = 0;
-
-  /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\group\onesample.pyx":249
- * 
- *   # Create local structure
- *   stat = fff_onesample_stat_mfx_new(n, FFF_ONESAMPLE_EMPIRICAL_MEAN_MFX, base)             # <<<<<<<<<<<<<<
- *   stat.niter = niter
- *   stat.constraint = constraint
- */
-  __pyx_v_stat = fff_onesample_stat_mfx_new(__pyx_v_n, FFF_ONESAMPLE_EMPIRICAL_MEAN_MFX, __pyx_v_base);
-
-  /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\group\onesample.pyx":250
- *   # Create local structure
- *   stat = fff_onesample_stat_mfx_new(n, FFF_ONESAMPLE_EMPIRICAL_MEAN_MFX, base)
- *   stat.niter = niter             # <<<<<<<<<<<<<<
- *   stat.constraint = constraint
- * 
- */
-  __pyx_v_stat->niter = __pyx_v_niter;
-
-  /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\group\onesample.pyx":251
- *   stat = fff_onesample_stat_mfx_new(n, FFF_ONESAMPLE_EMPIRICAL_MEAN_MFX, base)
- *   stat.niter = niter
- *   stat.constraint = constraint             # <<<<<<<<<<<<<<
- * 
- *   # Multi-iterator
- */
-  __pyx_v_stat->constraint = __pyx_v_constraint;
-
-  /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\group\onesample.pyx":254
- * 
- *   # Multi-iterator
- *   multi = fffpy_multi_iterator_new(4, axis, <void*>Y, <void*>V, <void*>W, <void*>Z)             # <<<<<<<<<<<<<<
- * 
- *   # Create views on nd-arrays
- */
-  __pyx_v_multi = fffpy_multi_iterator_new(4, __pyx_v_axis, ((void *)__pyx_v_Y), ((void *)__pyx_v_V), ((void *)__pyx_v_W), ((void *)__pyx_v_Z));
-
-  /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\group\onesample.pyx":257
- * 
- *   # Create views on nd-arrays
- *   y = multi.vector[0]             # <<<<<<<<<<<<<<
- *   v = multi.vector[1]
- *   w = multi.vector[2]
- */
-  __pyx_v_y = (__pyx_v_multi->vector[0]);
-
-  /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\group\onesample.pyx":258
- *   # Create views on nd-arrays
- *   y = multi.vector[0]
- *   v = multi.vector[1]             # <<<<<<<<<<<<<<
- *   w = multi.vector[2]
- *   z = multi.vector[3]
- */
-  __pyx_v_v = (__pyx_v_multi->vector[1]);
-
-  /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\group\onesample.pyx":259
- *   y = multi.vector[0]
- *   v = multi.vector[1]
- *   w = multi.vector[2]             # <<<<<<<<<<<<<<
- *   z = multi.vector[3]
- * 
- */
-  __pyx_v_w = (__pyx_v_multi->vector[2]);
-
-  /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\group\onesample.pyx":260
- *   v = multi.vector[1]
- *   w = multi.vector[2]
- *   z = multi.vector[3]             # <<<<<<<<<<<<<<
- * 
- *   # Loop
- */
-  __pyx_v_z = (__pyx_v_multi->vector[3]);
-
-  /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\group\onesample.pyx":263
- * 
- *   # Loop
- *   while(multi.index < multi.size):             # <<<<<<<<<<<<<<
- *     fff_onesample_stat_mfx_pdf_fit(w, z, stat, y, v)
- *     fffpy_multi_iterator_update(multi)
- */
-  while (1) {
-    __pyx_t_4 = (__pyx_v_multi->index < __pyx_v_multi->size);
-    if (!__pyx_t_4) break;
-
-    /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\group\onesample.pyx":264
- *   # Loop
- *   while(multi.index < multi.size):
- *     fff_onesample_stat_mfx_pdf_fit(w, z, stat, y, v)             # <<<<<<<<<<<<<<
- *     fffpy_multi_iterator_update(multi)
- * 
- */
-    fff_onesample_stat_mfx_pdf_fit(__pyx_v_w, __pyx_v_z, __pyx_v_stat, __pyx_v_y, __pyx_v_v);
-
-    /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\group\onesample.pyx":265
- *   while(multi.index < multi.size):
- *     fff_onesample_stat_mfx_pdf_fit(w, z, stat, y, v)
- *     fffpy_multi_iterator_update(multi)             # <<<<<<<<<<<<<<
- * 
- * 
- */
-    fffpy_multi_iterator_update(__pyx_v_multi);
-  }
-
-  /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\group\onesample.pyx":269
- * 
- *   # Delete local structures
- *   fffpy_multi_iterator_delete(multi)             # <<<<<<<<<<<<<<
- *   fff_onesample_stat_mfx_delete(stat)
- * 
- */
-  fffpy_multi_iterator_delete(__pyx_v_multi);
-
-  /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\group\onesample.pyx":270
- *   # Delete local structures
- *   fffpy_multi_iterator_delete(multi)
- *   fff_onesample_stat_mfx_delete(stat)             # <<<<<<<<<<<<<<
- * 
- *   # Return
- */
-  fff_onesample_stat_mfx_delete(__pyx_v_stat);
-
-  /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\group\onesample.pyx":273
- * 
- *   # Return
- *   return W, Z             # <<<<<<<<<<<<<<
- * 
- * 
- */
-  __Pyx_XDECREF(__pyx_r);
-  __pyx_t_1 = PyTuple_New(2); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 273; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_1));
-  __Pyx_INCREF(__pyx_v_W);
-  PyTuple_SET_ITEM(__pyx_t_1, 0, __pyx_v_W);
-  __Pyx_GIVEREF(__pyx_v_W);
-  __Pyx_INCREF(__pyx_v_Z);
-  PyTuple_SET_ITEM(__pyx_t_1, 1, __pyx_v_Z);
-  __Pyx_GIVEREF(__pyx_v_Z);
-  __pyx_r = ((PyObject *)__pyx_t_1);
-  __pyx_t_1 = 0;
-  goto __pyx_L0;
-
-  __pyx_r = Py_None; __Pyx_INCREF(Py_None);
-  goto __pyx_L0;
-  __pyx_L1_error:;
-  __Pyx_XDECREF(__pyx_1);
-  __Pyx_XDECREF(__pyx_t_1);
-  __Pyx_XDECREF(__pyx_t_2);
-  __Pyx_XDECREF(__pyx_t_3);
-  __Pyx_AddTraceback("nipy.neurospin.group.onesample.pdf_fit_mfx");
-  __pyx_r = NULL;
-  __pyx_L0:;
-  __Pyx_DECREF(__pyx_v_dims);
-  __Pyx_DECREF(__pyx_v_W);
-  __Pyx_DECREF(__pyx_v_Z);
-  __Pyx_XGIVEREF(__pyx_r);
-  __Pyx_FinishRefcountContext();
-  return __pyx_r;
-}
-
-/* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\group\onesample.pyx":276
- * 
- * 
- * def pdf_fit_gmfx(ndarray Y, ndarray V, int axis=0, int niter=5, int constraint=0, double base=0.0):             # <<<<<<<<<<<<<<
- *   """
- *   (MU, S2) = pdf_fit_gmfx(data=Y, vardata=V, axis=0, niter=5, constraint=False, base=0.0).
- */
-
-static PyObject *__pyx_pf_4nipy_9neurospin_5group_9onesample_pdf_fit_gmfx(PyObject *__pyx_self, PyObject *__pyx_args, PyObject *__pyx_kwds); /*proto*/
-static char __pyx_doc_4nipy_9neurospin_5group_9onesample_pdf_fit_gmfx[] = "\n  (MU, S2) = pdf_fit_gmfx(data=Y, vardata=V, axis=0, niter=5, constraint=False, base=0.0).\n  \n  Comments to follow.\n  ";
-static PyObject *__pyx_pf_4nipy_9neurospin_5group_9onesample_pdf_fit_gmfx(PyObject *__pyx_self, PyObject *__pyx_args, PyObject *__pyx_kwds) {
-  PyArrayObject *__pyx_v_Y = 0;
-  PyArrayObject *__pyx_v_V = 0;
-  int __pyx_v_axis;
-  int __pyx_v_niter;
-  int __pyx_v_constraint;
-  double __pyx_v_base;
-  fff_vector *__pyx_v_y;
-  fff_vector *__pyx_v_v;
-  fff_vector *__pyx_v_mu;
-  fff_vector *__pyx_v_s2;
-  fff_onesample_stat_mfx *__pyx_v_stat;
-  fffpy_multi_iterator *__pyx_v_multi;
-  int __pyx_v_n;
-  PyObject *__pyx_v_dims;
-  PyObject *__pyx_v_MU;
-  PyObject *__pyx_v_S2;
-  PyObject *__pyx_r = NULL;
-  PyObject *__pyx_1 = 0;
-  PyObject *__pyx_t_1 = NULL;
-  PyObject *__pyx_t_2 = NULL;
-  PyObject *__pyx_t_3 = NULL;
-  int __pyx_t_4;
-  static PyObject **__pyx_pyargnames[] = {&__pyx_kp_Y,&__pyx_kp_V,&__pyx_kp_axis,&__pyx_kp_niter,&__pyx_kp_constraint,&__pyx_kp_base,0};
-  __Pyx_SetupRefcountContext("pdf_fit_gmfx");
-  __pyx_self = __pyx_self;
-  if (unlikely(__pyx_kwds)) {
-    Py_ssize_t kw_args = PyDict_Size(__pyx_kwds);
-    PyObject* values[6] = {0,0,0,0,0,0};
-    switch (PyTuple_GET_SIZE(__pyx_args)) {
-      case  6: values[5] = PyTuple_GET_ITEM(__pyx_args, 5);
-      case  5: values[4] = PyTuple_GET_ITEM(__pyx_args, 4);
-      case  4: values[3] = PyTuple_GET_ITEM(__pyx_args, 3);
-      case  3: values[2] = PyTuple_GET_ITEM(__pyx_args, 2);
-      case  2: values[1] = PyTuple_GET_ITEM(__pyx_args, 1);
-      case  1: values[0] = PyTuple_GET_ITEM(__pyx_args, 0);
-      case  0: break;
-      default: goto __pyx_L5_argtuple_error;
-    }
-    switch (PyTuple_GET_SIZE(__pyx_args)) {
-      case  0:
-      values[0] = PyDict_GetItem(__pyx_kwds, __pyx_kp_Y);
-      if (likely(values[0])) kw_args--;
-      else goto __pyx_L5_argtuple_error;
-      case  1:
-      values[1] = PyDict_GetItem(__pyx_kwds, __pyx_kp_V);
-      if (likely(values[1])) kw_args--;
-      else {
-        __Pyx_RaiseArgtupleInvalid("pdf_fit_gmfx", 0, 2, 6, 1); {__pyx_filename = __pyx_f[0]; __pyx_lineno = 276; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-      }
-      case  2:
-      if (kw_args > 0) {
-        PyObject* value = PyDict_GetItem(__pyx_kwds, __pyx_kp_axis);
-        if (unlikely(value)) { values[2] = value; kw_args--; }
-      }
-      case  3:
-      if (kw_args > 0) {
-        PyObject* value = PyDict_GetItem(__pyx_kwds, __pyx_kp_niter);
-        if (unlikely(value)) { values[3] = value; kw_args--; }
-      }
-      case  4:
-      if (kw_args > 0) {
-        PyObject* value = PyDict_GetItem(__pyx_kwds, __pyx_kp_constraint);
-        if (unlikely(value)) { values[4] = value; kw_args--; }
-      }
-      case  5:
-      if (kw_args > 0) {
-        PyObject* value = PyDict_GetItem(__pyx_kwds, __pyx_kp_base);
-        if (unlikely(value)) { values[5] = value; kw_args--; }
-      }
-    }
-    if (unlikely(kw_args > 0)) {
-      if (unlikely(__Pyx_ParseOptionalKeywords(__pyx_kwds, __pyx_pyargnames, 0, values, PyTuple_GET_SIZE(__pyx_args), "pdf_fit_gmfx") < 0)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 276; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-    }
-    __pyx_v_Y = ((PyArrayObject *)values[0]);
-    __pyx_v_V = ((PyArrayObject *)values[1]);
-    if (values[2]) {
-      __pyx_v_axis = __Pyx_PyInt_AsInt(values[2]); if (unlikely((__pyx_v_axis == (int)-1) && PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 276; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-    } else {
-      __pyx_v_axis = 0;
-    }
-    if (values[3]) {
-      __pyx_v_niter = __Pyx_PyInt_AsInt(values[3]); if (unlikely((__pyx_v_niter == (int)-1) && PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 276; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-    } else {
-      __pyx_v_niter = 5;
-    }
-    if (values[4]) {
-      __pyx_v_constraint = __Pyx_PyInt_AsInt(values[4]); if (unlikely((__pyx_v_constraint == (int)-1) && PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 276; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-    } else {
-      __pyx_v_constraint = 0;
-    }
-    if (values[5]) {
-      __pyx_v_base = __pyx_PyFloat_AsDouble(values[5]); if (unlikely(PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 276; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-    } else {
-      __pyx_v_base = 0.0;
-    }
-  } else {
-    __pyx_v_axis = 0;
-    __pyx_v_niter = 5;
-    __pyx_v_constraint = 0;
-    __pyx_v_base = 0.0;
-    switch (PyTuple_GET_SIZE(__pyx_args)) {
-      case  6:
-      __pyx_v_base = __pyx_PyFloat_AsDouble(PyTuple_GET_ITEM(__pyx_args, 5)); if (unlikely(PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 276; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-      case  5:
-      __pyx_v_constraint = __Pyx_PyInt_AsInt(PyTuple_GET_ITEM(__pyx_args, 4)); if (unlikely((__pyx_v_constraint == (int)-1) && PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 276; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-      case  4:
-      __pyx_v_niter = __Pyx_PyInt_AsInt(PyTuple_GET_ITEM(__pyx_args, 3)); if (unlikely((__pyx_v_niter == (int)-1) && PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 276; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-      case  3:
-      __pyx_v_axis = __Pyx_PyInt_AsInt(PyTuple_GET_ITEM(__pyx_args, 2)); if (unlikely((__pyx_v_axis == (int)-1) && PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 276; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-      case  2:
-      __pyx_v_V = ((PyArrayObject *)PyTuple_GET_ITEM(__pyx_args, 1));
-      __pyx_v_Y = ((PyArrayObject *)PyTuple_GET_ITEM(__pyx_args, 0));
-      break;
-      default: goto __pyx_L5_argtuple_error;
-    }
-  }
-  goto __pyx_L4_argument_unpacking_done;
-  __pyx_L5_argtuple_error:;
-  __Pyx_RaiseArgtupleInvalid("pdf_fit_gmfx", 0, 2, 6, PyTuple_GET_SIZE(__pyx_args)); {__pyx_filename = __pyx_f[0]; __pyx_lineno = 276; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-  __pyx_L3_error:;
-  __Pyx_AddTraceback("nipy.neurospin.group.onesample.pdf_fit_gmfx");
-  return NULL;
-  __pyx_L4_argument_unpacking_done:;
-  __pyx_v_dims = Py_None; __Pyx_INCREF(Py_None);
-  __pyx_v_MU = Py_None; __Pyx_INCREF(Py_None);
-  __pyx_v_S2 = Py_None; __Pyx_INCREF(Py_None);
-  if (unlikely(!__Pyx_ArgTypeTest(((PyObject *)__pyx_v_Y), __pyx_ptype_4nipy_9neurospin_5group_9onesample_ndarray, 1, "Y", 0))) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 276; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  if (unlikely(!__Pyx_ArgTypeTest(((PyObject *)__pyx_v_V), __pyx_ptype_4nipy_9neurospin_5group_9onesample_ndarray, 1, "V", 0))) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 276; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-
-  /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\group\onesample.pyx":285
- *   cdef fff_onesample_stat_mfx* stat
- *   cdef fffpy_multi_iterator* multi
- *   cdef int n = Y.dimensions[axis]             # <<<<<<<<<<<<<<
- * 
- *   # Create output array
- */
-  __pyx_v_n = (__pyx_v_Y->dimensions[__pyx_v_axis]);
-
-  /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\group\onesample.pyx":288
- * 
- *   # Create output array
- *   dims = list(Y.shape)             # <<<<<<<<<<<<<<
- *   dims[axis] = 1
- *   MU = np.zeros(dims)
- */
-  __pyx_t_1 = PyObject_GetAttr(((PyObject *)__pyx_v_Y), __pyx_kp_shape); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 288; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_1);
-  __pyx_t_2 = PyTuple_New(1); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 288; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_2));
-  PyTuple_SET_ITEM(__pyx_t_2, 0, __pyx_t_1);
-  __Pyx_GIVEREF(__pyx_t_1);
-  __pyx_t_1 = 0;
-  __pyx_t_1 = PyObject_Call(((PyObject *)((PyObject*)&PyList_Type)), ((PyObject *)__pyx_t_2), NULL); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 288; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_1);
-  __Pyx_DECREF(((PyObject *)__pyx_t_2)); __pyx_t_2 = 0;
-  __Pyx_DECREF(__pyx_v_dims);
-  __pyx_v_dims = __pyx_t_1;
-  __pyx_t_1 = 0;
-
-  /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\group\onesample.pyx":289
- *   # Create output array
- *   dims = list(Y.shape)
- *   dims[axis] = 1             # <<<<<<<<<<<<<<
- *   MU = np.zeros(dims)
- *   S2 = np.zeros(dims)
- */
-  if (__Pyx_SetItemInt(__pyx_v_dims, __pyx_v_axis, __pyx_int_1, sizeof(int), PyInt_FromLong) < 0) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 289; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-
-  /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\group\onesample.pyx":290
- *   dims = list(Y.shape)
- *   dims[axis] = 1
- *   MU = np.zeros(dims)             # <<<<<<<<<<<<<<
- *   S2 = np.zeros(dims)
- * 
- */
-  __pyx_1 = __Pyx_GetName(__pyx_m, __pyx_kp_np); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 290; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_1);
-  __pyx_t_1 = PyObject_GetAttr(__pyx_1, __pyx_kp_zeros); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 290; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_1);
-  __Pyx_DECREF(__pyx_1); __pyx_1 = 0;
-  __pyx_t_2 = PyTuple_New(1); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 290; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_2));
-  __Pyx_INCREF(__pyx_v_dims);
-  PyTuple_SET_ITEM(__pyx_t_2, 0, __pyx_v_dims);
-  __Pyx_GIVEREF(__pyx_v_dims);
-  __pyx_t_3 = PyObject_Call(__pyx_t_1, ((PyObject *)__pyx_t_2), NULL); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 290; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_3);
-  __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-  __Pyx_DECREF(((PyObject *)__pyx_t_2)); __pyx_t_2 = 0;
-  __Pyx_DECREF(__pyx_v_MU);
-  __pyx_v_MU = __pyx_t_3;
-  __pyx_t_3 = 0;
-
-  /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\group\onesample.pyx":291
- *   dims[axis] = 1
- *   MU = np.zeros(dims)
- *   S2 = np.zeros(dims)             # <<<<<<<<<<<<<<
- * 
- *   # Create local structure
- */
-  __pyx_1 = __Pyx_GetName(__pyx_m, __pyx_kp_np); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 291; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_1);
-  __pyx_t_3 = PyObject_GetAttr(__pyx_1, __pyx_kp_zeros); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 291; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_3);
-  __Pyx_DECREF(__pyx_1); __pyx_1 = 0;
-  __pyx_t_2 = PyTuple_New(1); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 291; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_2));
-  __Pyx_INCREF(__pyx_v_dims);
-  PyTuple_SET_ITEM(__pyx_t_2, 0, __pyx_v_dims);
-  __Pyx_GIVEREF(__pyx_v_dims);
-  __pyx_t_1 = PyObject_Call(__pyx_t_3, ((PyObject *)__pyx_t_2), NULL); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 291; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_1);
-  __Pyx_DECREF(__pyx_t_3); __pyx_t_3 = 0;
-  __Pyx_DECREF(((PyObject *)__pyx_t_2)); __pyx_t_2 = 0;
-  __Pyx_DECREF(__pyx_v_S2);
-  __pyx_v_S2 = __pyx_t_1;
-  __pyx_t_1 = 0;
-
-  /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\group\onesample.pyx":294
- * 
- *   # Create local structure
- *   stat = fff_onesample_stat_mfx_new(n, FFF_ONESAMPLE_STUDENT_MFX, base)             # <<<<<<<<<<<<<<
- *   stat.niter = niter
- *   stat.constraint = constraint
- */
-  __pyx_v_stat = fff_onesample_stat_mfx_new(__pyx_v_n, FFF_ONESAMPLE_STUDENT_MFX, __pyx_v_base);
-
-  /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\group\onesample.pyx":295
- *   # Create local structure
- *   stat = fff_onesample_stat_mfx_new(n, FFF_ONESAMPLE_STUDENT_MFX, base)
- *   stat.niter = niter             # <<<<<<<<<<<<<<
- *   stat.constraint = constraint
- * 
- */
-  __pyx_v_stat->niter = __pyx_v_niter;
-
-  /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\group\onesample.pyx":296
- *   stat = fff_onesample_stat_mfx_new(n, FFF_ONESAMPLE_STUDENT_MFX, base)
- *   stat.niter = niter
- *   stat.constraint = constraint             # <<<<<<<<<<<<<<
- * 
- *   # Multi-iterator
- */
-  __pyx_v_stat->constraint = __pyx_v_constraint;
-
-  /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\group\onesample.pyx":299
- * 
- *   # Multi-iterator
- *   multi = fffpy_multi_iterator_new(4, axis, <void*>Y, <void*>V, <void*>MU, <void*>S2)             # <<<<<<<<<<<<<<
- * 
- *   # Create views on nd-arrays
- */
-  __pyx_v_multi = fffpy_multi_iterator_new(4, __pyx_v_axis, ((void *)__pyx_v_Y), ((void *)__pyx_v_V), ((void *)__pyx_v_MU), ((void *)__pyx_v_S2));
-
-  /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\group\onesample.pyx":302
- * 
- *   # Create views on nd-arrays
- *   y = multi.vector[0]             # <<<<<<<<<<<<<<
- *   v = multi.vector[1]
- *   mu = multi.vector[2]
- */
-  __pyx_v_y = (__pyx_v_multi->vector[0]);
-
-  /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\group\onesample.pyx":303
- *   # Create views on nd-arrays
- *   y = multi.vector[0]
- *   v = multi.vector[1]             # <<<<<<<<<<<<<<
- *   mu = multi.vector[2]
- *   s2 = multi.vector[3]
- */
-  __pyx_v_v = (__pyx_v_multi->vector[1]);
-
-  /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\group\onesample.pyx":304
- *   y = multi.vector[0]
- *   v = multi.vector[1]
- *   mu = multi.vector[2]             # <<<<<<<<<<<<<<
- *   s2 = multi.vector[3]
- * 
- */
-  __pyx_v_mu = (__pyx_v_multi->vector[2]);
-
-  /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\group\onesample.pyx":305
- *   v = multi.vector[1]
- *   mu = multi.vector[2]
- *   s2 = multi.vector[3]             # <<<<<<<<<<<<<<
- * 
- *   # Loop
- */
-  __pyx_v_s2 = (__pyx_v_multi->vector[3]);
-
-  /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\group\onesample.pyx":308
- * 
- *   # Loop
- *   while(multi.index < multi.size):             # <<<<<<<<<<<<<<
- *     fff_onesample_stat_gmfx_pdf_fit(mu.data, s2.data, stat, y, v)
- *     fffpy_multi_iterator_update(multi)
- */
-  while (1) {
-    __pyx_t_4 = (__pyx_v_multi->index < __pyx_v_multi->size);
-    if (!__pyx_t_4) break;
-
-    /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\group\onesample.pyx":309
- *   # Loop
- *   while(multi.index < multi.size):
- *     fff_onesample_stat_gmfx_pdf_fit(mu.data, s2.data, stat, y, v)             # <<<<<<<<<<<<<<
- *     fffpy_multi_iterator_update(multi)
- * 
- */
-    fff_onesample_stat_gmfx_pdf_fit(__pyx_v_mu->data, __pyx_v_s2->data, __pyx_v_stat, __pyx_v_y, __pyx_v_v);
-
-    /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\group\onesample.pyx":310
- *   while(multi.index < multi.size):
- *     fff_onesample_stat_gmfx_pdf_fit(mu.data, s2.data, stat, y, v)
- *     fffpy_multi_iterator_update(multi)             # <<<<<<<<<<<<<<
- * 
- * 
- */
-    fffpy_multi_iterator_update(__pyx_v_multi);
-  }
-
-  /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\group\onesample.pyx":314
- * 
- *   # Delete local structures
- *   fffpy_multi_iterator_delete(multi)             # <<<<<<<<<<<<<<
- *   fff_onesample_stat_mfx_delete(stat)
- * 
- */
-  fffpy_multi_iterator_delete(__pyx_v_multi);
-
-  /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\group\onesample.pyx":315
- *   # Delete local structures
- *   fffpy_multi_iterator_delete(multi)
- *   fff_onesample_stat_mfx_delete(stat)             # <<<<<<<<<<<<<<
- * 
- *   # Return
- */
-  fff_onesample_stat_mfx_delete(__pyx_v_stat);
-
-  /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\group\onesample.pyx":318
- * 
- *   # Return
- *   return MU, S2             # <<<<<<<<<<<<<<
- * 
- * 
- */
-  __Pyx_XDECREF(__pyx_r);
-  __pyx_t_1 = PyTuple_New(2); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 318; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_1));
-  __Pyx_INCREF(__pyx_v_MU);
-  PyTuple_SET_ITEM(__pyx_t_1, 0, __pyx_v_MU);
-  __Pyx_GIVEREF(__pyx_v_MU);
-  __Pyx_INCREF(__pyx_v_S2);
-  PyTuple_SET_ITEM(__pyx_t_1, 1, __pyx_v_S2);
-  __Pyx_GIVEREF(__pyx_v_S2);
-  __pyx_r = ((PyObject *)__pyx_t_1);
-  __pyx_t_1 = 0;
-  goto __pyx_L0;
-
-  __pyx_r = Py_None; __Pyx_INCREF(Py_None);
-  goto __pyx_L0;
-  __pyx_L1_error:;
-  __Pyx_XDECREF(__pyx_1);
-  __Pyx_XDECREF(__pyx_t_1);
-  __Pyx_XDECREF(__pyx_t_2);
-  __Pyx_XDECREF(__pyx_t_3);
-  __Pyx_AddTraceback("nipy.neurospin.group.onesample.pdf_fit_gmfx");
-  __pyx_r = NULL;
-  __pyx_L0:;
-  __Pyx_DECREF(__pyx_v_dims);
-  __Pyx_DECREF(__pyx_v_MU);
-  __Pyx_DECREF(__pyx_v_S2);
-  __Pyx_XGIVEREF(__pyx_r);
-  __Pyx_FinishRefcountContext();
-  return __pyx_r;
-}
-
-static struct PyMethodDef __pyx_methods[] = {
-  {__Pyx_NAMESTR("stat"), (PyCFunction)__pyx_pf_4nipy_9neurospin_5group_9onesample_stat, METH_VARARGS|METH_KEYWORDS, __Pyx_DOCSTR(__pyx_doc_4nipy_9neurospin_5group_9onesample_stat)},
-  {__Pyx_NAMESTR("stat_mfx"), (PyCFunction)__pyx_pf_4nipy_9neurospin_5group_9onesample_stat_mfx, METH_VARARGS|METH_KEYWORDS, __Pyx_DOCSTR(__pyx_doc_4nipy_9neurospin_5group_9onesample_stat_mfx)},
-  {__Pyx_NAMESTR("pdf_fit_mfx"), (PyCFunction)__pyx_pf_4nipy_9neurospin_5group_9onesample_pdf_fit_mfx, METH_VARARGS|METH_KEYWORDS, __Pyx_DOCSTR(__pyx_doc_4nipy_9neurospin_5group_9onesample_pdf_fit_mfx)},
-  {__Pyx_NAMESTR("pdf_fit_gmfx"), (PyCFunction)__pyx_pf_4nipy_9neurospin_5group_9onesample_pdf_fit_gmfx, METH_VARARGS|METH_KEYWORDS, __Pyx_DOCSTR(__pyx_doc_4nipy_9neurospin_5group_9onesample_pdf_fit_gmfx)},
-  {0, 0, 0, 0}
-};
-
-static void __pyx_init_filenames(void); /*proto*/
-
-#if PY_MAJOR_VERSION >= 3
-static struct PyModuleDef __pyx_moduledef = {
-    PyModuleDef_HEAD_INIT,
-    __Pyx_NAMESTR("onesample"),
-    __Pyx_DOCSTR(__pyx_mdoc), /* m_doc */
-    -1, /* m_size */
-    __pyx_methods /* m_methods */,
-    NULL, /* m_reload */
-    NULL, /* m_traverse */
-    NULL, /* m_clear */
-    NULL /* m_free */
-};
-#endif
-
-static __Pyx_StringTabEntry __pyx_string_tab[] = {
-  {&__pyx_kp___main__, __pyx_k___main__, sizeof(__pyx_k___main__), 1, 1, 1},
-  {&__pyx_kp_Y, __pyx_k_Y, sizeof(__pyx_k_Y), 1, 1, 1},
-  {&__pyx_kp_id, __pyx_k_id, sizeof(__pyx_k_id), 1, 1, 1},
-  {&__pyx_kp_base, __pyx_k_base, sizeof(__pyx_k_base), 1, 1, 1},
-  {&__pyx_kp_axis, __pyx_k_axis, sizeof(__pyx_k_axis), 1, 1, 1},
-  {&__pyx_kp_Magics, __pyx_k_Magics, sizeof(__pyx_k_Magics), 1, 1, 1},
-  {&__pyx_kp_V, __pyx_k_V, sizeof(__pyx_k_V), 1, 1, 1},
-  {&__pyx_kp_niter, __pyx_k_niter, sizeof(__pyx_k_niter), 1, 1, 1},
-  {&__pyx_kp_constraint, __pyx_k_constraint, sizeof(__pyx_k_constraint), 1, 1, 1},
-  {&__pyx_kp___version__, __pyx_k___version__, sizeof(__pyx_k___version__), 1, 1, 1},
-  {&__pyx_kp_numpy, __pyx_k_numpy, sizeof(__pyx_k_numpy), 1, 1, 1},
-  {&__pyx_kp_np, __pyx_k_np, sizeof(__pyx_k_np), 0, 1, 1},
-  {&__pyx_kp_2, __pyx_k_2, sizeof(__pyx_k_2), 0, 1, 0},
-  {&__pyx_kp_3, __pyx_k_3, sizeof(__pyx_k_3), 0, 1, 0},
-  {&__pyx_kp_4, __pyx_k_4, sizeof(__pyx_k_4), 0, 1, 0},
-  {&__pyx_kp_5, __pyx_k_5, sizeof(__pyx_k_5), 0, 1, 0},
-  {&__pyx_kp_6, __pyx_k_6, sizeof(__pyx_k_6), 0, 1, 0},
-  {&__pyx_kp_7, __pyx_k_7, sizeof(__pyx_k_7), 0, 1, 0},
-  {&__pyx_kp_8, __pyx_k_8, sizeof(__pyx_k_8), 0, 1, 0},
-  {&__pyx_kp_9, __pyx_k_9, sizeof(__pyx_k_9), 0, 1, 0},
-  {&__pyx_kp_10, __pyx_k_10, sizeof(__pyx_k_10), 0, 1, 0},
-  {&__pyx_kp_11, __pyx_k_11, sizeof(__pyx_k_11), 0, 1, 0},
-  {&__pyx_kp_12, __pyx_k_12, sizeof(__pyx_k_12), 0, 1, 0},
-  {&__pyx_kp_13, __pyx_k_13, sizeof(__pyx_k_13), 0, 1, 0},
-  {&__pyx_kp_14, __pyx_k_14, sizeof(__pyx_k_14), 0, 1, 0},
-  {&__pyx_kp_15, __pyx_k_15, sizeof(__pyx_k_15), 0, 1, 0},
-  {&__pyx_kp_16, __pyx_k_16, sizeof(__pyx_k_16), 0, 1, 0},
-  {&__pyx_kp_17, __pyx_k_17, sizeof(__pyx_k_17), 0, 1, 0},
-  {&__pyx_kp_stats, __pyx_k_stats, sizeof(__pyx_k_stats), 1, 1, 1},
-  {&__pyx_kp_18, __pyx_k_18, sizeof(__pyx_k_18), 0, 1, 0},
-  {&__pyx_kp_19, __pyx_k_19, sizeof(__pyx_k_19), 0, 1, 0},
-  {&__pyx_kp_shape, __pyx_k_shape, sizeof(__pyx_k_shape), 1, 1, 1},
-  {&__pyx_kp_zeros, __pyx_k_zeros, sizeof(__pyx_k_zeros), 1, 1, 1},
-  {&__pyx_kp_1, __pyx_k_1, sizeof(__pyx_k_1), 0, 0, 0},
-  {0, 0, 0, 0, 0, 0}
-};
-static int __Pyx_InitCachedBuiltins(void) {
-  return 0;
-  return -1;
-}
-
-static int __Pyx_InitGlobals(void) {
-  __pyx_int_1 = PyInt_FromLong(1); if (unlikely(!__pyx_int_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 1; __pyx_clineno = __LINE__; goto __pyx_L1_error;};
-  if (__Pyx_InitStrings(__pyx_string_tab) < 0) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 1; __pyx_clineno = __LINE__; goto __pyx_L1_error;};
-  return 0;
-  __pyx_L1_error:;
-  return -1;
-}
-
-#if PY_MAJOR_VERSION < 3
-PyMODINIT_FUNC initonesample(void); /*proto*/
-PyMODINIT_FUNC initonesample(void)
-#else
-PyMODINIT_FUNC PyInit_onesample(void); /*proto*/
-PyMODINIT_FUNC PyInit_onesample(void)
-#endif
-{
-  PyObject *__pyx_1 = 0;
-  PyObject *__pyx_t_1 = NULL;
-  #ifdef CYTHON_REFNANNY
-  void* __pyx_refchk = NULL;
-  __Pyx_Refnanny = __Pyx_ImportRefcountAPI("refnanny");
-  if (!__Pyx_Refnanny) {
-      PyErr_Clear();
-      __Pyx_Refnanny = __Pyx_ImportRefcountAPI("Cython.Runtime.refnanny");
-      if (!__Pyx_Refnanny)
-          Py_FatalError("failed to import refnanny module");
-  }
-  __pyx_refchk = __Pyx_Refnanny->NewContext("PyMODINIT_FUNC PyInit_onesample(void)", __LINE__, __FILE__);
-  #endif
-  __pyx_empty_tuple = PyTuple_New(0); if (unlikely(!__pyx_empty_tuple)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 1; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  /*--- Library function declarations ---*/
-  __pyx_init_filenames();
-  /*--- Threads initialization code ---*/
-  #if defined(__PYX_FORCE_INIT_THREADS) && __PYX_FORCE_INIT_THREADS
-  #ifdef WITH_THREAD /* Python build with threading support? */
-  PyEval_InitThreads();
-  #endif
-  #endif
-  /*--- Initialize various global constants etc. ---*/
-  if (unlikely(__Pyx_InitGlobals() < 0)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 1; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  /*--- Module creation code ---*/
-  #if PY_MAJOR_VERSION < 3
-  __pyx_m = Py_InitModule4(__Pyx_NAMESTR("onesample"), __pyx_methods, __pyx_mdoc, 0, PYTHON_API_VERSION);
-  #else
-  __pyx_m = PyModule_Create(&__pyx_moduledef);
-  #endif
-  if (!__pyx_m) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 1; __pyx_clineno = __LINE__; goto __pyx_L1_error;};
-  #if PY_MAJOR_VERSION < 3
-  Py_INCREF(__pyx_m);
-  #endif
-  __pyx_b = PyImport_AddModule(__Pyx_NAMESTR(__Pyx_BUILTIN_MODULE_NAME));
-  if (!__pyx_b) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 1; __pyx_clineno = __LINE__; goto __pyx_L1_error;};
-  if (__Pyx_SetAttrString(__pyx_m, "__builtins__", __pyx_b) < 0) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 1; __pyx_clineno = __LINE__; goto __pyx_L1_error;};
-  if (__pyx_module_is_main_nipy__neurospin__group__onesample) {
-    if (__Pyx_SetAttrString(__pyx_m, "__name__", __pyx_kp___main__) < 0) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 1; __pyx_clineno = __LINE__; goto __pyx_L1_error;};
-  }
-  /*--- Builtin init code ---*/
-  if (unlikely(__Pyx_InitCachedBuiltins() < 0)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 1; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __pyx_skip_dispatch = 0;
-  /*--- Global init code ---*/
-  /*--- Function export code ---*/
-  /*--- Type init code ---*/
-  __pyx_ptype_4nipy_9neurospin_5group_9onesample_dtype = __Pyx_ImportType("numpy", "dtype", sizeof(PyArray_Descr)); if (unlikely(!__pyx_ptype_4nipy_9neurospin_5group_9onesample_dtype)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 74; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __pyx_ptype_4nipy_9neurospin_5group_9onesample_ndarray = __Pyx_ImportType("numpy", "ndarray", sizeof(PyArrayObject)); if (unlikely(!__pyx_ptype_4nipy_9neurospin_5group_9onesample_ndarray)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 79; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __pyx_ptype_4nipy_9neurospin_5group_9onesample_flatiter = __Pyx_ImportType("numpy", "flatiter", sizeof(PyArrayIterObject)); if (unlikely(!__pyx_ptype_4nipy_9neurospin_5group_9onesample_flatiter)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 88; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __pyx_ptype_4nipy_9neurospin_5group_9onesample_broadcast = __Pyx_ImportType("numpy", "broadcast", sizeof(PyArrayMultiIterObject)); if (unlikely(!__pyx_ptype_4nipy_9neurospin_5group_9onesample_broadcast)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 94; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  /*--- Type import code ---*/
-  /*--- Function import code ---*/
-  /*--- Execution code ---*/
-
-  /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\group\onesample.pyx":10
- * """
- * 
- * __version__ = '0.1'             # <<<<<<<<<<<<<<
- * 
- * 
- */
-  if (PyObject_SetAttr(__pyx_m, __pyx_kp___version__, __pyx_kp_1) < 0) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 10; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-
-  /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\group\onesample.pyx":63
- * 
- * # Initialize numpy
- * fffpy_import_array()             # <<<<<<<<<<<<<<
- * import_array()
- * import numpy as np
- */
-  fffpy_import_array();
-
-  /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\group\onesample.pyx":64
- * # Initialize numpy
- * fffpy_import_array()
- * import_array()             # <<<<<<<<<<<<<<
- * import numpy as np
- * 
- */
-  import_array();
-
-  /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\group\onesample.pyx":65
- * fffpy_import_array()
- * import_array()
- * import numpy as np             # <<<<<<<<<<<<<<
- * 
- * 
- */
-  __pyx_1 = __Pyx_Import(__pyx_kp_numpy, 0); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 65; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_1);
-  if (PyObject_SetAttr(__pyx_m, __pyx_kp_np, __pyx_1) < 0) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 65; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_DECREF(__pyx_1); __pyx_1 = 0;
-
-  /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\group\onesample.pyx":69
- * 
- * # Stat dictionary
- * stats = {'mean': FFF_ONESAMPLE_EMPIRICAL_MEAN,             # <<<<<<<<<<<<<<
- *          'median': FFF_ONESAMPLE_EMPIRICAL_MEDIAN,
- *          'student': FFF_ONESAMPLE_STUDENT,
- */
-  __pyx_1 = PyDict_New(); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 69; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_1));
-  __pyx_t_1 = PyInt_FromLong(FFF_ONESAMPLE_EMPIRICAL_MEAN); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 69; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_1);
-  if (PyDict_SetItem(__pyx_1, __pyx_kp_2, __pyx_t_1) < 0) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 69; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-
-  /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\group\onesample.pyx":70
- * # Stat dictionary
- * stats = {'mean': FFF_ONESAMPLE_EMPIRICAL_MEAN,
- *          'median': FFF_ONESAMPLE_EMPIRICAL_MEDIAN,             # <<<<<<<<<<<<<<
- *          'student': FFF_ONESAMPLE_STUDENT,
- *          'laplace': FFF_ONESAMPLE_LAPLACE,
- */
-  __pyx_t_1 = PyInt_FromLong(FFF_ONESAMPLE_EMPIRICAL_MEDIAN); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 70; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_1);
-  if (PyDict_SetItem(__pyx_1, __pyx_kp_3, __pyx_t_1) < 0) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 69; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-
-  /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\group\onesample.pyx":71
- * stats = {'mean': FFF_ONESAMPLE_EMPIRICAL_MEAN,
- *          'median': FFF_ONESAMPLE_EMPIRICAL_MEDIAN,
- *          'student': FFF_ONESAMPLE_STUDENT,             # <<<<<<<<<<<<<<
- *          'laplace': FFF_ONESAMPLE_LAPLACE,
- *          'tukey': FFF_ONESAMPLE_TUKEY,
- */
-  __pyx_t_1 = PyInt_FromLong(FFF_ONESAMPLE_STUDENT); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 71; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_1);
-  if (PyDict_SetItem(__pyx_1, __pyx_kp_4, __pyx_t_1) < 0) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 69; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-
-  /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\group\onesample.pyx":72
- *          'median': FFF_ONESAMPLE_EMPIRICAL_MEDIAN,
- *          'student': FFF_ONESAMPLE_STUDENT,
- *          'laplace': FFF_ONESAMPLE_LAPLACE,             # <<<<<<<<<<<<<<
- *          'tukey': FFF_ONESAMPLE_TUKEY,
- *          'sign': FFF_ONESAMPLE_SIGN_STAT,
- */
-  __pyx_t_1 = PyInt_FromLong(FFF_ONESAMPLE_LAPLACE); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 72; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_1);
-  if (PyDict_SetItem(__pyx_1, __pyx_kp_5, __pyx_t_1) < 0) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 69; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-
-  /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\group\onesample.pyx":73
- *          'student': FFF_ONESAMPLE_STUDENT,
- *          'laplace': FFF_ONESAMPLE_LAPLACE,
- *          'tukey': FFF_ONESAMPLE_TUKEY,             # <<<<<<<<<<<<<<
- *          'sign': FFF_ONESAMPLE_SIGN_STAT,
- *          'wilcoxon': FFF_ONESAMPLE_WILCOXON,
- */
-  __pyx_t_1 = PyInt_FromLong(FFF_ONESAMPLE_TUKEY); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 73; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_1);
-  if (PyDict_SetItem(__pyx_1, __pyx_kp_6, __pyx_t_1) < 0) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 69; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-
-  /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\group\onesample.pyx":74
- *          'laplace': FFF_ONESAMPLE_LAPLACE,
- *          'tukey': FFF_ONESAMPLE_TUKEY,
- *          'sign': FFF_ONESAMPLE_SIGN_STAT,             # <<<<<<<<<<<<<<
- *          'wilcoxon': FFF_ONESAMPLE_WILCOXON,
- *          'elr': FFF_ONESAMPLE_ELR,
- */
-  __pyx_t_1 = PyInt_FromLong(FFF_ONESAMPLE_SIGN_STAT); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 74; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_1);
-  if (PyDict_SetItem(__pyx_1, __pyx_kp_7, __pyx_t_1) < 0) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 69; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-
-  /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\group\onesample.pyx":75
- *          'tukey': FFF_ONESAMPLE_TUKEY,
- *          'sign': FFF_ONESAMPLE_SIGN_STAT,
- *          'wilcoxon': FFF_ONESAMPLE_WILCOXON,             # <<<<<<<<<<<<<<
- *          'elr': FFF_ONESAMPLE_ELR,
- *          'grubb': FFF_ONESAMPLE_GRUBB,
- */
-  __pyx_t_1 = PyInt_FromLong(FFF_ONESAMPLE_WILCOXON); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 75; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_1);
-  if (PyDict_SetItem(__pyx_1, __pyx_kp_8, __pyx_t_1) < 0) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 69; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-
-  /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\group\onesample.pyx":76
- *          'sign': FFF_ONESAMPLE_SIGN_STAT,
- *          'wilcoxon': FFF_ONESAMPLE_WILCOXON,
- *          'elr': FFF_ONESAMPLE_ELR,             # <<<<<<<<<<<<<<
- *          'grubb': FFF_ONESAMPLE_GRUBB,
- *          'mean_mfx': FFF_ONESAMPLE_EMPIRICAL_MEAN_MFX,
- */
-  __pyx_t_1 = PyInt_FromLong(FFF_ONESAMPLE_ELR); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 76; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_1);
-  if (PyDict_SetItem(__pyx_1, __pyx_kp_9, __pyx_t_1) < 0) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 69; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-
-  /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\group\onesample.pyx":77
- *          'wilcoxon': FFF_ONESAMPLE_WILCOXON,
- *          'elr': FFF_ONESAMPLE_ELR,
- *          'grubb': FFF_ONESAMPLE_GRUBB,             # <<<<<<<<<<<<<<
- *          'mean_mfx': FFF_ONESAMPLE_EMPIRICAL_MEAN_MFX,
- *          'median_mfx': FFF_ONESAMPLE_EMPIRICAL_MEDIAN_MFX,
- */
-  __pyx_t_1 = PyInt_FromLong(FFF_ONESAMPLE_GRUBB); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 77; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_1);
-  if (PyDict_SetItem(__pyx_1, __pyx_kp_10, __pyx_t_1) < 0) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 69; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-
-  /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\group\onesample.pyx":78
- *          'elr': FFF_ONESAMPLE_ELR,
- *          'grubb': FFF_ONESAMPLE_GRUBB,
- *          'mean_mfx': FFF_ONESAMPLE_EMPIRICAL_MEAN_MFX,             # <<<<<<<<<<<<<<
- *          'median_mfx': FFF_ONESAMPLE_EMPIRICAL_MEDIAN_MFX,
- *          'mean_gauss_mfx': FFF_ONESAMPLE_GAUSSIAN_MEAN_MFX,
- */
-  __pyx_t_1 = PyInt_FromLong(FFF_ONESAMPLE_EMPIRICAL_MEAN_MFX); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 78; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_1);
-  if (PyDict_SetItem(__pyx_1, __pyx_kp_11, __pyx_t_1) < 0) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 69; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-
-  /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\group\onesample.pyx":79
- *          'grubb': FFF_ONESAMPLE_GRUBB,
- *          'mean_mfx': FFF_ONESAMPLE_EMPIRICAL_MEAN_MFX,
- *          'median_mfx': FFF_ONESAMPLE_EMPIRICAL_MEDIAN_MFX,             # <<<<<<<<<<<<<<
- *          'mean_gauss_mfx': FFF_ONESAMPLE_GAUSSIAN_MEAN_MFX,
- *          'student_mfx': FFF_ONESAMPLE_STUDENT_MFX,
- */
-  __pyx_t_1 = PyInt_FromLong(FFF_ONESAMPLE_EMPIRICAL_MEDIAN_MFX); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 79; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_1);
-  if (PyDict_SetItem(__pyx_1, __pyx_kp_12, __pyx_t_1) < 0) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 69; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-
-  /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\group\onesample.pyx":80
- *          'mean_mfx': FFF_ONESAMPLE_EMPIRICAL_MEAN_MFX,
- *          'median_mfx': FFF_ONESAMPLE_EMPIRICAL_MEDIAN_MFX,
- *          'mean_gauss_mfx': FFF_ONESAMPLE_GAUSSIAN_MEAN_MFX,             # <<<<<<<<<<<<<<
- *          'student_mfx': FFF_ONESAMPLE_STUDENT_MFX,
- *          'sign_mfx': FFF_ONESAMPLE_SIGN_STAT_MFX,
- */
-  __pyx_t_1 = PyInt_FromLong(FFF_ONESAMPLE_GAUSSIAN_MEAN_MFX); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 80; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_1);
-  if (PyDict_SetItem(__pyx_1, __pyx_kp_13, __pyx_t_1) < 0) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 69; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-
-  /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\group\onesample.pyx":81
- *          'median_mfx': FFF_ONESAMPLE_EMPIRICAL_MEDIAN_MFX,
- *          'mean_gauss_mfx': FFF_ONESAMPLE_GAUSSIAN_MEAN_MFX,
- *          'student_mfx': FFF_ONESAMPLE_STUDENT_MFX,             # <<<<<<<<<<<<<<
- *          'sign_mfx': FFF_ONESAMPLE_SIGN_STAT_MFX,
- *          'wilcoxon_mfx': FFF_ONESAMPLE_WILCOXON_MFX,
- */
-  __pyx_t_1 = PyInt_FromLong(FFF_ONESAMPLE_STUDENT_MFX); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 81; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_1);
-  if (PyDict_SetItem(__pyx_1, __pyx_kp_14, __pyx_t_1) < 0) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 69; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-
-  /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\group\onesample.pyx":82
- *          'mean_gauss_mfx': FFF_ONESAMPLE_GAUSSIAN_MEAN_MFX,
- *          'student_mfx': FFF_ONESAMPLE_STUDENT_MFX,
- *          'sign_mfx': FFF_ONESAMPLE_SIGN_STAT_MFX,             # <<<<<<<<<<<<<<
- *          'wilcoxon_mfx': FFF_ONESAMPLE_WILCOXON_MFX,
- *          'elr_mfx': FFF_ONESAMPLE_ELR_MFX}
- */
-  __pyx_t_1 = PyInt_FromLong(FFF_ONESAMPLE_SIGN_STAT_MFX); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 82; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_1);
-  if (PyDict_SetItem(__pyx_1, __pyx_kp_15, __pyx_t_1) < 0) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 69; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-
-  /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\group\onesample.pyx":83
- *          'student_mfx': FFF_ONESAMPLE_STUDENT_MFX,
- *          'sign_mfx': FFF_ONESAMPLE_SIGN_STAT_MFX,
- *          'wilcoxon_mfx': FFF_ONESAMPLE_WILCOXON_MFX,             # <<<<<<<<<<<<<<
- *          'elr_mfx': FFF_ONESAMPLE_ELR_MFX}
- * 
- */
-  __pyx_t_1 = PyInt_FromLong(FFF_ONESAMPLE_WILCOXON_MFX); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 83; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_1);
-  if (PyDict_SetItem(__pyx_1, __pyx_kp_16, __pyx_t_1) < 0) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 69; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-
-  /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\group\onesample.pyx":84
- *          'sign_mfx': FFF_ONESAMPLE_SIGN_STAT_MFX,
- *          'wilcoxon_mfx': FFF_ONESAMPLE_WILCOXON_MFX,
- *          'elr_mfx': FFF_ONESAMPLE_ELR_MFX}             # <<<<<<<<<<<<<<
- * 
- * 
- */
-  __pyx_t_1 = PyInt_FromLong(FFF_ONESAMPLE_ELR_MFX); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 84; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_1);
-  if (PyDict_SetItem(__pyx_1, __pyx_kp_17, __pyx_t_1) < 0) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 69; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-  if (PyObject_SetAttr(__pyx_m, __pyx_kp_stats, ((PyObject *)__pyx_1)) < 0) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 69; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_DECREF(((PyObject *)__pyx_1)); __pyx_1 = 0;
-
-  /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\group\onesample.pyx":276
- * 
- * 
- * def pdf_fit_gmfx(ndarray Y, ndarray V, int axis=0, int niter=5, int constraint=0, double base=0.0):             # <<<<<<<<<<<<<<
- *   """
- *   (MU, S2) = pdf_fit_gmfx(data=Y, vardata=V, axis=0, niter=5, constraint=False, base=0.0).
- */
-  goto __pyx_L0;
-  __pyx_L1_error:;
-  __Pyx_XDECREF(__pyx_1);
-  __Pyx_XDECREF(__pyx_t_1);
-  __Pyx_AddTraceback("nipy.neurospin.group.onesample");
-  Py_DECREF(__pyx_m); __pyx_m = 0;
-  __pyx_L0:;
-  __Pyx_FinishRefcountContext();
-  #if PY_MAJOR_VERSION < 3
-  return;
-  #else
-  return __pyx_m;
-  #endif
-}
-
-static const char *__pyx_filenames[] = {
-  "onesample.pyx",
-  "numpy.pxi",
-};
-
-/* Runtime support code */
-
-static void __pyx_init_filenames(void) {
-  __pyx_f = __pyx_filenames;
-}
-
-static void __Pyx_RaiseDoubleKeywordsError(
-    const char* func_name,
-    PyObject* kw_name)
-{
-    PyErr_Format(PyExc_TypeError,
-        #if PY_MAJOR_VERSION >= 3
-        "%s() got multiple values for keyword argument '%U'", func_name, kw_name);
-        #else
-        "%s() got multiple values for keyword argument '%s'", func_name,
-        PyString_AS_STRING(kw_name));
-        #endif
-}
-
-static void __Pyx_RaiseArgtupleInvalid(
-    const char* func_name,
-    int exact,
-    Py_ssize_t num_min,
-    Py_ssize_t num_max,
-    Py_ssize_t num_found)
-{
-    Py_ssize_t num_expected;
-    const char *number, *more_or_less;
-
-    if (num_found < num_min) {
-        num_expected = num_min;
-        more_or_less = "at least";
-    } else {
-        num_expected = num_max;
-        more_or_less = "at most";
-    }
-    if (exact) {
-        more_or_less = "exactly";
-    }
-    number = (num_expected == 1) ? "" : "s";
-    PyErr_Format(PyExc_TypeError,
-        #if PY_VERSION_HEX < 0x02050000
-            "%s() takes %s %d positional argument%s (%d given)",
-        #else
-            "%s() takes %s %zd positional argument%s (%zd given)",
-        #endif
-        func_name, more_or_less, num_expected, number, num_found);
-}
-
-static int __Pyx_ParseOptionalKeywords(
-    PyObject *kwds,
-    PyObject **argnames[],
-    PyObject *kwds2,
-    PyObject *values[],
-    Py_ssize_t num_pos_args,
-    const char* function_name)
-{
-    PyObject *key = 0, *value = 0;
-    Py_ssize_t pos = 0;
-    PyObject*** name;
-    PyObject*** first_kw_arg = argnames + num_pos_args;
-
-    while (PyDict_Next(kwds, &pos, &key, &value)) {
-        name = first_kw_arg;
-        while (*name && (**name != key)) name++;
-        if (*name) {
-            values[name-argnames] = value;
-        } else {
-            #if PY_MAJOR_VERSION < 3
-            if (unlikely(!PyString_CheckExact(key)) && unlikely(!PyString_Check(key))) {
-            #else
-            if (unlikely(!PyUnicode_CheckExact(key)) && unlikely(!PyUnicode_Check(key))) {
-            #endif
-                goto invalid_keyword_type;
-            } else {
-                for (name = first_kw_arg; *name; name++) {
-                    #if PY_MAJOR_VERSION >= 3
-                    if (PyUnicode_GET_SIZE(**name) == PyUnicode_GET_SIZE(key) &&
-                        PyUnicode_Compare(**name, key) == 0) break;
-                    #else
-                    if (PyString_GET_SIZE(**name) == PyString_GET_SIZE(key) &&
-                        _PyString_Eq(**name, key)) break;
-                    #endif
-                }
-                if (*name) {
-                    values[name-argnames] = value;
-                } else {
-                    /* unexpected keyword found */
-                    for (name=argnames; name != first_kw_arg; name++) {
-                        if (**name == key) goto arg_passed_twice;
-                        #if PY_MAJOR_VERSION >= 3
-                        if (PyUnicode_GET_SIZE(**name) == PyUnicode_GET_SIZE(key) &&
-                            PyUnicode_Compare(**name, key) == 0) goto arg_passed_twice;
-                        #else
-                        if (PyString_GET_SIZE(**name) == PyString_GET_SIZE(key) &&
-                            _PyString_Eq(**name, key)) goto arg_passed_twice;
-                        #endif
-                    }
-                    if (kwds2) {
-                        if (unlikely(PyDict_SetItem(kwds2, key, value))) goto bad;
-                    } else {
-                        goto invalid_keyword;
-                    }
-                }
-            }
-        }
-    }
-    return 0;
-arg_passed_twice:
-    __Pyx_RaiseDoubleKeywordsError(function_name, **name);
-    goto bad;
-invalid_keyword_type:
-    PyErr_Format(PyExc_TypeError,
-        "%s() keywords must be strings", function_name);
-    goto bad;
-invalid_keyword:
-    PyErr_Format(PyExc_TypeError,
-    #if PY_MAJOR_VERSION < 3
-        "%s() got an unexpected keyword argument '%s'",
-        function_name, PyString_AsString(key));
-    #else
-        "%s() got an unexpected keyword argument '%U'",
-        function_name, key);
-    #endif
-bad:
-    return -1;
-}
-
-
-static int __Pyx_ArgTypeTest(PyObject *obj, PyTypeObject *type, int none_allowed,
-    const char *name, int exact)
-{
-    if (!type) {
-        PyErr_Format(PyExc_SystemError, "Missing type object");
-        return 0;
-    }
-    if (none_allowed && obj == Py_None) return 1;
-    else if (exact) {
-        if (Py_TYPE(obj) == type) return 1;
-    }
-    else {
-        if (PyObject_TypeCheck(obj, type)) return 1;
-    }
-    PyErr_Format(PyExc_TypeError,
-        "Argument '%s' has incorrect type (expected %s, got %s)",
-        name, type->tp_name, Py_TYPE(obj)->tp_name);
-    return 0;
-}
-
-static PyObject *__Pyx_Import(PyObject *name, PyObject *from_list) {
-    PyObject *__import__ = 0;
-    PyObject *empty_list = 0;
-    PyObject *module = 0;
-    PyObject *global_dict = 0;
-    PyObject *empty_dict = 0;
-    PyObject *list;
-    __import__ = __Pyx_GetAttrString(__pyx_b, "__import__");
-    if (!__import__)
-        goto bad;
-    if (from_list)
-        list = from_list;
-    else {
-        empty_list = PyList_New(0);
-        if (!empty_list)
-            goto bad;
-        list = empty_list;
-    }
-    global_dict = PyModule_GetDict(__pyx_m);
-    if (!global_dict)
-        goto bad;
-    empty_dict = PyDict_New();
-    if (!empty_dict)
-        goto bad;
-    module = PyObject_CallFunctionObjArgs(__import__,
-        name, global_dict, empty_dict, list, NULL);
-bad:
-    Py_XDECREF(empty_list);
-    Py_XDECREF(__import__);
-    Py_XDECREF(empty_dict);
-    return module;
-}
-
-static PyObject *__Pyx_GetName(PyObject *dict, PyObject *name) {
-    PyObject *result;
-    result = PyObject_GetAttr(dict, name);
-    if (!result)
-        PyErr_SetObject(PyExc_NameError, name);
-    return result;
-}
-
-static INLINE int __Pyx_StrEq(const char *s1, const char *s2) {
-     while (*s1 != '\0' && *s1 == *s2) { s1++; s2++; }
-     return *s1 == *s2;
-}
-
-static INLINE unsigned char __Pyx_PyInt_AsUnsignedChar(PyObject* x) {
-    if (sizeof(unsigned char) < sizeof(long)) {
-        long val = __Pyx_PyInt_AsLong(x);
-        if (unlikely(val != (long)(unsigned char)val)) {
-            if (unlikely(val == -1 && PyErr_Occurred()))
-                return (unsigned char)-1;
-            if (unlikely(val < 0)) {
-                PyErr_SetString(PyExc_OverflowError,
-                                "can't convert negative value to unsigned char");
-                return (unsigned char)-1;
-            }
-            PyErr_SetString(PyExc_OverflowError,
-                           "value too large to convert to unsigned char");
-            return (unsigned char)-1;
-        }
-        return (unsigned char)val;
-    }
-    return (unsigned char)__Pyx_PyInt_AsUnsignedLong(x);
-}
-
-static INLINE unsigned short __Pyx_PyInt_AsUnsignedShort(PyObject* x) {
-    if (sizeof(unsigned short) < sizeof(long)) {
-        long val = __Pyx_PyInt_AsLong(x);
-        if (unlikely(val != (long)(unsigned short)val)) {
-            if (unlikely(val == -1 && PyErr_Occurred()))
-                return (unsigned short)-1;
-            if (unlikely(val < 0)) {
-                PyErr_SetString(PyExc_OverflowError,
-                                "can't convert negative value to unsigned short");
-                return (unsigned short)-1;
-            }
-            PyErr_SetString(PyExc_OverflowError,
-                           "value too large to convert to unsigned short");
-            return (unsigned short)-1;
-        }
-        return (unsigned short)val;
-    }
-    return (unsigned short)__Pyx_PyInt_AsUnsignedLong(x);
-}
-
-static INLINE unsigned int __Pyx_PyInt_AsUnsignedInt(PyObject* x) {
-    if (sizeof(unsigned int) < sizeof(long)) {
-        long val = __Pyx_PyInt_AsLong(x);
-        if (unlikely(val != (long)(unsigned int)val)) {
-            if (unlikely(val == -1 && PyErr_Occurred()))
-                return (unsigned int)-1;
-            if (unlikely(val < 0)) {
-                PyErr_SetString(PyExc_OverflowError,
-                                "can't convert negative value to unsigned int");
-                return (unsigned int)-1;
-            }
-            PyErr_SetString(PyExc_OverflowError,
-                           "value too large to convert to unsigned int");
-            return (unsigned int)-1;
-        }
-        return (unsigned int)val;
-    }
-    return (unsigned int)__Pyx_PyInt_AsUnsignedLong(x);
-}
-
-static INLINE char __Pyx_PyInt_AsChar(PyObject* x) {
-    if (sizeof(char) < sizeof(long)) {
-        long val = __Pyx_PyInt_AsLong(x);
-        if (unlikely(val != (long)(char)val)) {
-            if (unlikely(val == -1 && PyErr_Occurred()))
-                return (char)-1;
-            PyErr_SetString(PyExc_OverflowError,
-                           "value too large to convert to char");
-            return (char)-1;
-        }
-        return (char)val;
-    }
-    return (char)__Pyx_PyInt_AsLong(x);
-}
-
-static INLINE short __Pyx_PyInt_AsShort(PyObject* x) {
-    if (sizeof(short) < sizeof(long)) {
-        long val = __Pyx_PyInt_AsLong(x);
-        if (unlikely(val != (long)(short)val)) {
-            if (unlikely(val == -1 && PyErr_Occurred()))
-                return (short)-1;
-            PyErr_SetString(PyExc_OverflowError,
-                           "value too large to convert to short");
-            return (short)-1;
-        }
-        return (short)val;
-    }
-    return (short)__Pyx_PyInt_AsLong(x);
-}
-
-static INLINE int __Pyx_PyInt_AsInt(PyObject* x) {
-    if (sizeof(int) < sizeof(long)) {
-        long val = __Pyx_PyInt_AsLong(x);
-        if (unlikely(val != (long)(int)val)) {
-            if (unlikely(val == -1 && PyErr_Occurred()))
-                return (int)-1;
-            PyErr_SetString(PyExc_OverflowError,
-                           "value too large to convert to int");
-            return (int)-1;
-        }
-        return (int)val;
-    }
-    return (int)__Pyx_PyInt_AsLong(x);
-}
-
-static INLINE signed char __Pyx_PyInt_AsSignedChar(PyObject* x) {
-    if (sizeof(signed char) < sizeof(long)) {
-        long val = __Pyx_PyInt_AsLong(x);
-        if (unlikely(val != (long)(signed char)val)) {
-            if (unlikely(val == -1 && PyErr_Occurred()))
-                return (signed char)-1;
-            PyErr_SetString(PyExc_OverflowError,
-                           "value too large to convert to signed char");
-            return (signed char)-1;
-        }
-        return (signed char)val;
-    }
-    return (signed char)__Pyx_PyInt_AsSignedLong(x);
-}
-
-static INLINE signed short __Pyx_PyInt_AsSignedShort(PyObject* x) {
-    if (sizeof(signed short) < sizeof(long)) {
-        long val = __Pyx_PyInt_AsLong(x);
-        if (unlikely(val != (long)(signed short)val)) {
-            if (unlikely(val == -1 && PyErr_Occurred()))
-                return (signed short)-1;
-            PyErr_SetString(PyExc_OverflowError,
-                           "value too large to convert to signed short");
-            return (signed short)-1;
-        }
-        return (signed short)val;
-    }
-    return (signed short)__Pyx_PyInt_AsSignedLong(x);
-}
-
-static INLINE signed int __Pyx_PyInt_AsSignedInt(PyObject* x) {
-    if (sizeof(signed int) < sizeof(long)) {
-        long val = __Pyx_PyInt_AsLong(x);
-        if (unlikely(val != (long)(signed int)val)) {
-            if (unlikely(val == -1 && PyErr_Occurred()))
-                return (signed int)-1;
-            PyErr_SetString(PyExc_OverflowError,
-                           "value too large to convert to signed int");
-            return (signed int)-1;
-        }
-        return (signed int)val;
-    }
-    return (signed int)__Pyx_PyInt_AsSignedLong(x);
-}
-
-static INLINE unsigned long __Pyx_PyInt_AsUnsignedLong(PyObject* x) {
-#if PY_VERSION_HEX < 0x03000000
-    if (likely(PyInt_CheckExact(x) || PyInt_Check(x))) {
-        long val = PyInt_AS_LONG(x);
-        if (unlikely(val < 0)) {
-            PyErr_SetString(PyExc_OverflowError,
-                            "can't convert negative value to unsigned long");
-            return (unsigned long)-1;
-        }
-        return (unsigned long)val;
-    } else
-#endif
-    if (likely(PyLong_CheckExact(x) || PyLong_Check(x))) {
-        if (unlikely(Py_SIZE(x) < 0)) {
-            PyErr_SetString(PyExc_OverflowError,
-                            "can't convert negative value to unsigned long");
-            return (unsigned long)-1;
-        }
-        return PyLong_AsUnsignedLong(x);
-    } else {
-        unsigned long val;
-        PyObject *tmp = __Pyx_PyNumber_Int(x);
-        if (!tmp) return (unsigned long)-1;
-        val = __Pyx_PyInt_AsUnsignedLong(tmp);
-        Py_DECREF(tmp);
-        return val;
-    }
-}
-
-static INLINE unsigned PY_LONG_LONG __Pyx_PyInt_AsUnsignedLongLong(PyObject* x) {
-#if PY_VERSION_HEX < 0x03000000
-    if (likely(PyInt_CheckExact(x) || PyInt_Check(x))) {
-        long val = PyInt_AS_LONG(x);
-        if (unlikely(val < 0)) {
-            PyErr_SetString(PyExc_OverflowError,
-                            "can't convert negative value to unsigned PY_LONG_LONG");
-            return (unsigned PY_LONG_LONG)-1;
-        }
-        return (unsigned PY_LONG_LONG)val;
-    } else
-#endif
-    if (likely(PyLong_CheckExact(x) || PyLong_Check(x))) {
-        if (unlikely(Py_SIZE(x) < 0)) {
-            PyErr_SetString(PyExc_OverflowError,
-                            "can't convert negative value to unsigned PY_LONG_LONG");
-            return (unsigned PY_LONG_LONG)-1;
-        }
-        return PyLong_AsUnsignedLongLong(x);
-    } else {
-        unsigned PY_LONG_LONG val;
-        PyObject *tmp = __Pyx_PyNumber_Int(x);
-        if (!tmp) return (unsigned PY_LONG_LONG)-1;
-        val = __Pyx_PyInt_AsUnsignedLongLong(tmp);
-        Py_DECREF(tmp);
-        return val;
-    }
-}
-
-static INLINE long __Pyx_PyInt_AsLong(PyObject* x) {
-#if PY_VERSION_HEX < 0x03000000
-    if (likely(PyInt_CheckExact(x) || PyInt_Check(x))) {
-        long val = PyInt_AS_LONG(x);
-        return (long)val;
-    } else
-#endif
-    if (likely(PyLong_CheckExact(x) || PyLong_Check(x))) {
-        return PyLong_AsLong(x);
-    } else {
-        long val;
-        PyObject *tmp = __Pyx_PyNumber_Int(x);
-        if (!tmp) return (long)-1;
-        val = __Pyx_PyInt_AsLong(tmp);
-        Py_DECREF(tmp);
-        return val;
-    }
-}
-
-static INLINE PY_LONG_LONG __Pyx_PyInt_AsLongLong(PyObject* x) {
-#if PY_VERSION_HEX < 0x03000000
-    if (likely(PyInt_CheckExact(x) || PyInt_Check(x))) {
-        long val = PyInt_AS_LONG(x);
-        return (PY_LONG_LONG)val;
-    } else
-#endif
-    if (likely(PyLong_CheckExact(x) || PyLong_Check(x))) {
-        return PyLong_AsLongLong(x);
-    } else {
-        PY_LONG_LONG val;
-        PyObject *tmp = __Pyx_PyNumber_Int(x);
-        if (!tmp) return (PY_LONG_LONG)-1;
-        val = __Pyx_PyInt_AsLongLong(tmp);
-        Py_DECREF(tmp);
-        return val;
-    }
-}
-
-static INLINE signed long __Pyx_PyInt_AsSignedLong(PyObject* x) {
-#if PY_VERSION_HEX < 0x03000000
-    if (likely(PyInt_CheckExact(x) || PyInt_Check(x))) {
-        long val = PyInt_AS_LONG(x);
-        return (signed long)val;
-    } else
-#endif
-    if (likely(PyLong_CheckExact(x) || PyLong_Check(x))) {
-        return PyLong_AsLong(x);
-    } else {
-        signed long val;
-        PyObject *tmp = __Pyx_PyNumber_Int(x);
-        if (!tmp) return (signed long)-1;
-        val = __Pyx_PyInt_AsSignedLong(tmp);
-        Py_DECREF(tmp);
-        return val;
-    }
-}
-
-static INLINE signed PY_LONG_LONG __Pyx_PyInt_AsSignedLongLong(PyObject* x) {
-#if PY_VERSION_HEX < 0x03000000
-    if (likely(PyInt_CheckExact(x) || PyInt_Check(x))) {
-        long val = PyInt_AS_LONG(x);
-        return (signed PY_LONG_LONG)val;
-    } else
-#endif
-    if (likely(PyLong_CheckExact(x) || PyLong_Check(x))) {
-        return PyLong_AsLongLong(x);
-    } else {
-        signed PY_LONG_LONG val;
-        PyObject *tmp = __Pyx_PyNumber_Int(x);
-        if (!tmp) return (signed PY_LONG_LONG)-1;
-        val = __Pyx_PyInt_AsSignedLongLong(tmp);
-        Py_DECREF(tmp);
-        return val;
-    }
-}
-
-#ifndef __PYX_HAVE_RT_ImportType
-#define __PYX_HAVE_RT_ImportType
-static PyTypeObject *__Pyx_ImportType(const char *module_name, const char *class_name,
-    long size)
-{
-    PyObject *py_module = 0;
-    PyObject *result = 0;
-    PyObject *py_name = 0;
-
-    py_module = __Pyx_ImportModule(module_name);
-    if (!py_module)
-        goto bad;
-    #if PY_MAJOR_VERSION < 3
-    py_name = PyString_FromString(class_name);
-    #else
-    py_name = PyUnicode_FromString(class_name);
-    #endif
-    if (!py_name)
-        goto bad;
-    result = PyObject_GetAttr(py_module, py_name);
-    Py_DECREF(py_name);
-    py_name = 0;
-    Py_DECREF(py_module);
-    py_module = 0;
-    if (!result)
-        goto bad;
-    if (!PyType_Check(result)) {
-        PyErr_Format(PyExc_TypeError, 
-            "%s.%s is not a type object",
-            module_name, class_name);
-        goto bad;
-    }
-    if (((PyTypeObject *)result)->tp_basicsize != size) {
-        PyErr_Format(PyExc_ValueError, 
-            "%s.%s does not appear to be the correct type object",
-            module_name, class_name);
-        goto bad;
-    }
-    return (PyTypeObject *)result;
-bad:
-    Py_XDECREF(py_module);
-    Py_XDECREF(result);
-    return 0;
-}
-#endif
-
-#ifndef __PYX_HAVE_RT_ImportModule
-#define __PYX_HAVE_RT_ImportModule
-static PyObject *__Pyx_ImportModule(const char *name) {
-    PyObject *py_name = 0;
-    PyObject *py_module = 0;
-
-    #if PY_MAJOR_VERSION < 3
-    py_name = PyString_FromString(name);
-    #else
-    py_name = PyUnicode_FromString(name);
-    #endif
-    if (!py_name)
-        goto bad;
-    py_module = PyImport_Import(py_name);
-    Py_DECREF(py_name);
-    return py_module;
-bad:
-    Py_XDECREF(py_name);
-    return 0;
-}
-#endif
-
-#include "compile.h"
-#include "frameobject.h"
-#include "traceback.h"
-
-static void __Pyx_AddTraceback(const char *funcname) {
-    PyObject *py_srcfile = 0;
-    PyObject *py_funcname = 0;
-    PyObject *py_globals = 0;
-    PyObject *empty_string = 0;
-    PyCodeObject *py_code = 0;
-    PyFrameObject *py_frame = 0;
-
-    #if PY_MAJOR_VERSION < 3
-    py_srcfile = PyString_FromString(__pyx_filename);
-    #else
-    py_srcfile = PyUnicode_FromString(__pyx_filename);
-    #endif
-    if (!py_srcfile) goto bad;
-    if (__pyx_clineno) {
-        #if PY_MAJOR_VERSION < 3
-        py_funcname = PyString_FromFormat( "%s (%s:%d)", funcname, __pyx_cfilenm, __pyx_clineno);
-        #else
-        py_funcname = PyUnicode_FromFormat( "%s (%s:%d)", funcname, __pyx_cfilenm, __pyx_clineno);
-        #endif
-    }
-    else {
-        #if PY_MAJOR_VERSION < 3
-        py_funcname = PyString_FromString(funcname);
-        #else
-        py_funcname = PyUnicode_FromString(funcname);
-        #endif
-    }
-    if (!py_funcname) goto bad;
-    py_globals = PyModule_GetDict(__pyx_m);
-    if (!py_globals) goto bad;
-    #if PY_MAJOR_VERSION < 3
-    empty_string = PyString_FromStringAndSize("", 0);
-    #else
-    empty_string = PyBytes_FromStringAndSize("", 0);
-    #endif
-    if (!empty_string) goto bad;
-    py_code = PyCode_New(
-        0,            /*int argcount,*/
-        #if PY_MAJOR_VERSION >= 3
-        0,            /*int kwonlyargcount,*/
-        #endif
-        0,            /*int nlocals,*/
-        0,            /*int stacksize,*/
-        0,            /*int flags,*/
-        empty_string, /*PyObject *code,*/
-        __pyx_empty_tuple,  /*PyObject *consts,*/
-        __pyx_empty_tuple,  /*PyObject *names,*/
-        __pyx_empty_tuple,  /*PyObject *varnames,*/
-        __pyx_empty_tuple,  /*PyObject *freevars,*/
-        __pyx_empty_tuple,  /*PyObject *cellvars,*/
-        py_srcfile,   /*PyObject *filename,*/
-        py_funcname,  /*PyObject *name,*/
-        __pyx_lineno,   /*int firstlineno,*/
-        empty_string  /*PyObject *lnotab*/
-    );
-    if (!py_code) goto bad;
-    py_frame = PyFrame_New(
-        PyThreadState_GET(), /*PyThreadState *tstate,*/
-        py_code,             /*PyCodeObject *code,*/
-        py_globals,          /*PyObject *globals,*/
-        0                    /*PyObject *locals*/
-    );
-    if (!py_frame) goto bad;
-    py_frame->f_lineno = __pyx_lineno;
-    PyTraceBack_Here(py_frame);
-bad:
-    Py_XDECREF(py_srcfile);
-    Py_XDECREF(py_funcname);
-    Py_XDECREF(empty_string);
-    Py_XDECREF(py_code);
-    Py_XDECREF(py_frame);
-}
-
-static int __Pyx_InitStrings(__Pyx_StringTabEntry *t) {
-    while (t->p) {
-        #if PY_MAJOR_VERSION < 3
-        if (t->is_unicode && (!t->is_identifier)) {
-            *t->p = PyUnicode_DecodeUTF8(t->s, t->n - 1, NULL);
-        } else if (t->intern) {
-            *t->p = PyString_InternFromString(t->s);
-        } else {
-            *t->p = PyString_FromStringAndSize(t->s, t->n - 1);
-        }
-        #else  /* Python 3+ has unicode identifiers */
-        if (t->is_identifier || (t->is_unicode && t->intern)) {
-            *t->p = PyUnicode_InternFromString(t->s);
-        } else if (t->is_unicode) {
-            *t->p = PyUnicode_FromStringAndSize(t->s, t->n - 1);
-        } else {
-            *t->p = PyBytes_FromStringAndSize(t->s, t->n - 1);
-        }
-        #endif
-        if (!*t->p)
-            return -1;
-        ++t;
-    }
-    return 0;
-}
-
-/* Type Conversion Functions */
-
-static INLINE int __Pyx_PyObject_IsTrue(PyObject* x) {
-   if (x == Py_True) return 1;
-   else if ((x == Py_False) | (x == Py_None)) return 0;
-   else return PyObject_IsTrue(x);
-}
-
-static INLINE PyObject* __Pyx_PyNumber_Int(PyObject* x) {
-  PyNumberMethods *m;
-  const char *name = NULL;
-  PyObject *res = NULL;
-#if PY_VERSION_HEX < 0x03000000
-  if (PyInt_Check(x) || PyLong_Check(x))
-#else
-  if (PyLong_Check(x))
-#endif
-    return Py_INCREF(x), x;
-  m = Py_TYPE(x)->tp_as_number;
-#if PY_VERSION_HEX < 0x03000000
-  if (m && m->nb_int) {
-    name = "int";
-    res = PyNumber_Int(x);
-  }
-  else if (m && m->nb_long) {
-    name = "long";
-    res = PyNumber_Long(x);
-  }
-#else
-  if (m && m->nb_int) {
-    name = "int";
-    res = PyNumber_Long(x);
-  }
-#endif
-  if (res) {
-#if PY_VERSION_HEX < 0x03000000
-    if (!PyInt_Check(res) && !PyLong_Check(res)) {
-#else
-    if (!PyLong_Check(res)) {
-#endif
-      PyErr_Format(PyExc_TypeError,
-                   "__%s__ returned non-%s (type %.200s)",
-                   name, name, Py_TYPE(res)->tp_name);
-      Py_DECREF(res);
-      return NULL;
-    }
-  }
-  else if (!PyErr_Occurred()) {
-    PyErr_SetString(PyExc_TypeError,
-                    "an integer is required");
-  }
-  return res;
-}
-
-static INLINE Py_ssize_t __Pyx_PyIndex_AsSsize_t(PyObject* b) {
-  Py_ssize_t ival;
-  PyObject* x = PyNumber_Index(b);
-  if (!x) return -1;
-  ival = PyInt_AsSsize_t(x);
-  Py_DECREF(x);
-  return ival;
-}
-
-static INLINE PyObject * __Pyx_PyInt_FromSize_t(size_t ival) {
-#if PY_VERSION_HEX < 0x02050000
-   if (ival <= LONG_MAX)
-       return PyInt_FromLong((long)ival);
-   else {
-       unsigned char *bytes = (unsigned char *) &ival;
-       int one = 1; int little = (int)*(unsigned char*)&one;
-       return _PyLong_FromByteArray(bytes, sizeof(size_t), little, 0);
-   }
-#else
-   return PyInt_FromSize_t(ival);
-#endif
-}
-
-static INLINE size_t __Pyx_PyInt_AsSize_t(PyObject* x) {
-   unsigned PY_LONG_LONG val = __Pyx_PyInt_AsUnsignedLongLong(x);
-   if (unlikely(val == (unsigned PY_LONG_LONG)-1 && PyErr_Occurred())) {
-       return (size_t)-1;
-   } else if (unlikely(val != (unsigned PY_LONG_LONG)(size_t)val)) {
-       PyErr_SetString(PyExc_OverflowError,
-                       "value too large to convert to size_t");
-       return (size_t)-1;
-   }
-   return (size_t)val;
-}
-
-
@@ -13,6 +13,10 @@ __version__ = '0.1'
 # Includes
 include "fff.pxi"
 
+cdef extern from "stdlib.h":
+  void* malloc(size_t size)
+  void free(void* ptr)
+
 # Exports from fff_onesample_stat.h
 cdef extern from "fff_onesample_stat.h":
 
@@ -39,6 +43,7 @@ cdef extern from "fff_onesample_stat.h":
 
   ctypedef struct fff_onesample_stat_mfx:
     unsigned int niter
+    double tol
     unsigned int constraint
     
 
@@ -49,6 +54,7 @@ cdef extern from "fff_onesample_stat.h":
   fff_onesample_stat_mfx* fff_onesample_stat_mfx_new(size_t n, fff_onesample_stat_flag flag, double base) 
   void fff_onesample_stat_mfx_delete(fff_onesample_stat_mfx* thisone) 
   double fff_onesample_stat_mfx_eval(fff_onesample_stat_mfx* thisone, fff_vector* x, fff_vector* vx)
+  int fff_onesample_stat_mfx_cache(fff_onesample_stat_mfx* thisone, fff_vector* x, fff_vector* vx)
 
   void fff_onesample_stat_mfx_pdf_fit(fff_vector* w, fff_vector* z,
                                       fff_onesample_stat_mfx* thisone, 
@@ -56,8 +62,41 @@ cdef extern from "fff_onesample_stat.h":
   void fff_onesample_stat_gmfx_pdf_fit(double* mu, double* v, 
                                        fff_onesample_stat_mfx* thisone, 
                                        fff_vector* x, fff_vector* vx)
+  int fff_onesample_stat_mfx_pdf_fit_block(fff_matrix* W, fff_matrix* Z, 
+                                           fff_onesample_stat_mfx* thisone, 
+                                           fff_matrix* X, fff_matrix* VX)
+  int fff_onesample_stat_gmfx_pdf_fit_block(fff_vector* mu, fff_vector* v, 
+                                            fff_onesample_stat_mfx* thisone, 
+                                            fff_matrix* X, fff_matrix* VX)
 
   void fff_onesample_permute_signs(fff_vector* xx, fff_vector* x, double magic)
+  void fff_onesample_sign_matrix(fff_matrix* S, fff_vector* magics)
+  int fff_onesample_stat_signs_init(fff_matrix* Y, fff_onesample_stat* thisone)
+  void fff_onesample_stat_eval_signs(fff_matrix* T, fff_onesample_stat* thisone, 
+                                     fff_matrix* S, fff_matrix* Y)
+
+# Exports from fff_graphlib.h
+cdef extern from "fff_graphlib.h":
+
+  ctypedef struct fff_graph:
+    pass
+
+  long fff_graph_grid_stencil(fff_graph** G, long* xyz, long N, long k)
+  void fff_graph_delete(fff_graph* thisone)
+
+# Exports from fff_reproducibility.h
+cdef extern from "fff_reproducibility.h":
+
+  ctypedef enum fff_reproducibility_method:
+    FFF_REPRODUCIBILITY_RFX = 0
+    FFF_REPRODUCIBILITY_FFX = 1
+    FFF_REPRODUCIBILITY_MFX = 2
+
+  int fff_reproducibility_clusters(fff_array* label, fff_vector* rmap,
+                                   fff_matrix* data, fff_matrix* vardata,
+                                   fff_array* samples, fff_matrix* signs,
+                                   fff_graph* G, fff_reproducibility_method method,
+                                   double th, long csize, unsigned int niter, int nthreads)
 
 # Initialize numpy
 fffpy_import_array()
@@ -83,24 +122,201 @@ stats = {'mean': FFF_ONESAMPLE_EMPIRICAL_MEAN,
          'wilcoxon_mfx': FFF_ONESAMPLE_WILCOXON_MFX,
          'elr_mfx': FFF_ONESAMPLE_ELR_MFX}
 
+# Group statistics of reproducibility_clusters
+reproducibility_methods = {'crfx': FFF_REPRODUCIBILITY_RFX,
+                           'cffx': FFF_REPRODUCIBILITY_FFX,
+                           'cmfx': FFF_REPRODUCIBILITY_MFX}
+
+
+
+
+# Number of voxels evaluated together over all permutations
+DEF STAT_BLOCK = 256
+
+# Number of sign permutations evaluated by one matrix product
+DEF PERM_BLOCK = 256
+
+# Parallel job for stat and stat_mfx. The rank-th worker computes the
+# statistic over the rank-th part of a split multi-iterator, using its
+# own local structures. It does not call the Python API.
+#
+# Voxels are copied by blocks into contiguous storage, and all the
+# permutations are evaluated for a block before moving on to the
+# next one, so that each voxel is read from the input arrays only
+# once. For the mean, Student, sign, Wilcoxon and ELR statistics,
+# permutations are evaluated by blocks using
+# fff_onesample_stat_eval_signs, so that Wilcoxon ranks are only
+# computed once per voxel and ELR problems are solved for a whole
+# block of voxels in lockstep. For MFX statistics, permutations are
+# evaluated one voxel at a time so that, if warm is non-zero, the null
+# hypothesis fit of the voxel is cached by fff_onesample_stat_mfx_cache.
+cdef struct _stat_job_params:
+  fffpy_multi_iterator** parts
+  fff_vector* magics
+  size_t n
+  int flag
+  double base
+  unsigned int niter
+  double tol
+  int warm
+  int mfx
+
+cdef void _stat_job(int rank, int nthreads, void* p):
+  cdef _stat_job_params* params = <_stat_job_params*>p
+  cdef fffpy_multi_iterator* multi = params.parts[rank]
+  cdef fff_onesample_stat* stat
+  cdef fff_onesample_stat_mfx* stat_mfx
+  cdef fff_vector *y, *v, *t, *yp
+  cdef fff_vector yi, vi, mk
+  cdef fff_matrix *yb, *vb, *sb, *pb
+  cdef fff_matrix yk, sk, pk
+  cdef double** tb
+  cdef unsigned long int simu, idx, nsimu = params.magics.size
+  cdef size_t i, k, nb, nk, n = params.n
+  cdef double magic
+  cdef int signs = 0
+
+  # Vector views and local structures
+  y = multi.vector[0]
+  if params.mfx:
+    v = multi.vector[1]
+    t = multi.vector[2]
+    stat_mfx = fff_onesample_stat_mfx_new(n, <fff_onesample_stat_flag>params.flag, params.base)
+    stat_mfx.niter = params.niter
+    stat_mfx.tol = params.tol
+    vb = fff_matrix_new(STAT_BLOCK, n)
+  else:
+    t = multi.vector[1]
+    stat = fff_onesample_stat_new(n, <fff_onesample_stat_flag>params.flag, params.base)
+    signs = (params.flag == FFF_ONESAMPLE_EMPIRICAL_MEAN or params.flag == FFF_ONESAMPLE_STUDENT or 
+             params.flag == FFF_ONESAMPLE_SIGN_STAT or params.flag == FFF_ONESAMPLE_WILCOXON or 
+             params.flag == FFF_ONESAMPLE_ELR)
+  if signs:
+    sb = fff_matrix_new(PERM_BLOCK, n)
+    pb = fff_matrix_new(PERM_BLOCK, STAT_BLOCK)
+  yp = fff_vector_new(n)
+  yb = fff_matrix_new(STAT_BLOCK, n)
+  tb = <double**>malloc(STAT_BLOCK*sizeof(double*))
+
+  # Loop over blocks of voxels
+  fffpy_multi_iterator_reset(multi)
+  while(multi.index < multi.size):
+
+    # Copy the block and keep track of the output locations
+    nb = 0
+    while nb < STAT_BLOCK and multi.index < multi.size:
+      yi = fff_vector_view(yb.data + nb*n, n, 1)
+      fff_vector_memcpy(&yi, y)
+      if params.mfx:
+        vi = fff_vector_view(vb.data + nb*n, n, 1)
+        fff_vector_memcpy(&vi, v)
+      tb[nb] = t.data
+      nb = nb + 1
+      fffpy_multi_iterator_update(multi)
+
+    # Matrix form of the sign permutations
+    yk = fff_matrix_view(yb.data, nb, n, n)
+    if signs and fff_onesample_stat_signs_init(&yk, stat):
+      simu = 0
+      while simu < nsimu:
+        nk = nsimu - simu
+        if nk > PERM_BLOCK:
+          nk = PERM_BLOCK
+        mk = fff_vector_view(params.magics.data + simu*params.magics.stride, nk, params.magics.stride)
+        sk = fff_matrix_view(sb.data, nk, n, n)
+        pk = fff_matrix_view(pb.data, nk, nb, nb)
+        fff_onesample_sign_matrix(&sk, &mk)
+        fff_onesample_stat_eval_signs(&pk, stat, &sk, &yk)
+        for k from 0 <= k < nk:
+          idx = (simu+k)*t.stride
+          for i from 0 <= i < nb:
+            tb[i][idx] = pk.data[k*nb+i]
+        simu = simu + nk
+      continue
+
+    # Loop over voxels, then permutations
+    if params.mfx:
+      for i from 0 <= i < nb:
+        yi = fff_vector_view(yb.data + i*n, n, 1)
+        vi = fff_vector_view(vb.data + i*n, n, 1)
+        if params.warm:
+          fff_onesample_stat_mfx_cache(stat_mfx, &yi, &vi)
+        for simu from 0 <= simu < nsimu:
+          magic = params.magics.data[simu*params.magics.stride]
+          fff_onesample_permute_signs(yp, &yi, magic)
+          tb[i][simu*t.stride] = fff_onesample_stat_mfx_eval(stat_mfx, yp, &vi)
+      continue
+
+    # Loop over permutations
+    for simu from 0 <= simu < nsimu:
+      magic = params.magics.data[simu*params.magics.stride]
+      idx = simu*t.stride
+      for i from 0 <= i < nb:
+        yi = fff_vector_view(yb.data + i*n, n, 1)
+        fff_onesample_permute_signs(yp, &yi, magic)
+        tb[i][idx] = fff_onesample_stat_eval(stat, yp)
+
+  # Free memory
+  free(tb)
+  if signs:
+    fff_matrix_delete(sb)
+    fff_matrix_delete(pb)
+  fff_matrix_delete(yb)
+  fff_vector_delete(yp)
+  if params.mfx:
+    fff_matrix_delete(vb)
+    fff_onesample_stat_mfx_delete(stat_mfx)
+  else:
+    fff_onesample_stat_delete(stat)
+
+
+cdef _stat_run(fffpy_multi_iterator* multi, fff_vector* magics, size_t n, 
+               int flag, double base, unsigned int niter, double tol, int warm, 
+               int mfx, int nthreads):
+  """
+  Run _stat_job on nthreads threads with the GIL released, or
+  serially if nthreads is one or the multi-iterator cannot be split.
+  """
+  cdef _stat_job_params params
+  cdef fffpy_multi_iterator** parts
+
+  parts = NULL
+  if nthreads > 1:
+    parts = fffpy_multi_iterator_split(multi, nthreads)
+  params.magics = magics
+  params.n = n
+  params.flag = flag
+  params.base = base
+  params.niter = niter
+  params.tol = tol
+  params.warm = warm
+  params.mfx = mfx
+  if parts != NULL:
+    params.parts = parts
+    fffpy_parallel_run(nthreads, _stat_job, <void*>&params)
+    fffpy_multi_iterator_split_delete(parts, nthreads)
+  else:
+    params.parts = &multi
+    _stat_job(0, 1, <void*>&params)
 
 
 
 # Test stat without mixed-effect correction
 def stat(ndarray Y, id='student', double base=0.0,
-         int axis=0, ndarray Magics=None):
+         int axis=0, ndarray Magics=None, int nthreads=1):
   """
-  T = stat(Y, id='student', base=0.0, axis=0, magics=None).
+  T = stat(Y, id='student', base=0.0, axis=0, magics=None, nthreads=1).
   
   Compute a one-sample test statistic over a number of deterministic
   or random permutations. 
+
+  Voxels are split across nthreads threads (all processors if
+  nthreads is zero or negative), which yields the same result.
   """
-  cdef fff_vector *y, *t, *magics, *yp
-  cdef fff_onesample_stat* stat
+  cdef fff_vector *magics
   cdef fff_onesample_stat_flag flag_stat = stats[id]
   cdef unsigned int n
-  cdef unsigned long int simu, nsimu, idx
-  cdef double magic
+  cdef unsigned long int nsimu
   cdef fffpy_multi_iterator* multi
 
   # Get number of observations
@@ -119,57 +335,42 @@ def stat(ndarray Y, id='student', double base=0.0,
   dims[axis] = nsimu 
   T = np.zeros(dims)
 
-  # Create local structure
-  stat = fff_onesample_stat_new(n, flag_stat, base)
-  yp = fff_vector_new(n)
-
   # Multi-iterator 
   multi = fffpy_multi_iterator_new(2, axis, <void*>Y, <void*>T)
 
-  # Vector views
-  y = multi.vector[0]
-  t = multi.vector[1]
-  
-  # Loop
-  for simu from 0 <= simu < nsimu:
-    
-    # Set the magic number
-    magic = magics.data[simu*magics.stride]
-      
-    # Reset the multi-iterator
-    fffpy_multi_iterator_reset(multi); 
-    
-    # Perform the loop 
-    idx = simu*t.stride
-    while(multi.index < multi.size):
-      fff_onesample_permute_signs(yp, y, magic)
-      t.data[idx] = fff_onesample_stat_eval(stat, yp)
-      fffpy_multi_iterator_update(multi)
+  # Loop 
+  nthreads = fff_threads_count(nthreads)
+  _stat_run(multi, magics, n, flag_stat, base, 0, 0.0, 0, 0, nthreads)
 
   # Free memory 
   fffpy_multi_iterator_delete(multi)
-  fff_vector_delete(yp)
   fff_vector_delete(magics)
-  fff_onesample_stat_delete(stat)
 
   # Return
   return T
 
 
 def stat_mfx(ndarray Y, ndarray V, id='student_mfx', double base=0.0,
-             int axis=0, ndarray Magics=None, unsigned int niter=5):
+             int axis=0, ndarray Magics=None, unsigned int niter=5, int nthreads=1,
+             double tol=0.0, int warm=0):
   """
-  T = stat_mfx(Y, V, id='student_mfx', base=0.0, axis=0, magics=None, niter=5).
+  T = stat_mfx(Y, V, id='student_mfx', base=0.0, axis=0, magics=None, niter=5, nthreads=1, tol=0.0, warm=False).
   
   Compute a one-sample test statistic, with mixed-effect correction,
   over a number of deterministic or random permutations.
+
+  Voxels are split across nthreads threads, see stat.
+
+  If tol is positive, EM stops before niter iterations once the
+  relative change of the estimates is below tol. If warm is true,
+  the null hypothesis fit is computed once per voxel and reused for
+  all permutations, which is only supported by 'student_mfx' and
+  does not change the result.
   """
-  cdef fff_vector *y, *v, *t, *magics, *yp
-  cdef fff_onesample_stat_mfx* stat
+  cdef fff_vector *magics
   cdef fff_onesample_stat_flag flag_stat = stats[id]
   cdef int n
-  cdef unsigned long int nsimu_max, simu, idx
-  cdef double magic
+  cdef unsigned long int nsimu
   cdef fffpy_multi_iterator* multi
 
   # Get number of observations
@@ -188,89 +389,81 @@ def stat_mfx(ndarray Y, ndarray V, id='student_mfx', double base=0.0,
   dims[axis] = nsimu 
   T = np.zeros(dims)
 
-  # Create local structure
-  stat = fff_onesample_stat_mfx_new(n, flag_stat, base)
-  stat.niter = niter
-  yp = fff_vector_new(n)
-
   # Multi-iterator 
   multi = fffpy_multi_iterator_new(3, axis, <void*>Y, <void*>V, <void*>T)
 
-  # Vector views
-  y = multi.vector[0]
-  v = multi.vector[1]
-  t = multi.vector[2]
-  
-  # Loop  
-  for simu from 0 <= simu < nsimu:
-
-    # Set the magic number
-    magic = magics.data[simu*magics.stride]
-    
-    # Reset the multi-iterator      
-    fffpy_multi_iterator_reset(multi)
-    
-    # Perform the loop 
-    idx = simu*t.stride
-    while(multi.index < multi.size):
-      fff_onesample_permute_signs(yp, y, magic)
-      t.data[idx] = fff_onesample_stat_mfx_eval(stat, yp, v)
-      fffpy_multi_iterator_update(multi)
-      
+  # Loop 
+  nthreads = fff_threads_count(nthreads)
+  _stat_run(multi, magics, n, flag_stat, base, niter, tol, warm, 1, nthreads)
 
   # Free memory
   fffpy_multi_iterator_delete(multi)
-  fff_vector_delete(yp)
   fff_vector_delete(magics)
-  fff_onesample_stat_mfx_delete(stat)
   
   # Return
   return T
 
 
 
+def _subjects_first(ndarray Y, int axis):
+  """
+  (n, nvox) C-contiguous double array of the data of Y along axis,
+  one column per voxel. 
+  """
+  Yr = np.rollaxis(Y, axis)
+  return np.ascontiguousarray(Yr.reshape((Yr.shape[0], -1)), dtype='double')
+
+
+def _voxels_back(ndarray X, shape, int axis):
+  """
+  Inverse of _subjects_first, X having X.shape[0] items per voxel. 
+  """
+  return np.rollaxis(X.reshape((X.shape[0],)+shape), 0, axis+1)
+
+
 def pdf_fit_mfx(ndarray Y, ndarray V, int axis=0, int niter=5, int constraint=0, double base=0.0):
   """
   (W, Z) = pdf_fit_mfx(data=Y, vardata=V, axis=0, niter=5, constraint=False, base=0.0).
   
   Comments to follow.
+
+  The voxels are fitted by blocks, with the EM iterations run in
+  lockstep. 
   """
-  cdef fff_vector *y, *v, *w, *z
+  cdef fff_matrix *y, *v, *w, *z
   cdef fff_onesample_stat_mfx* stat
-  cdef fffpy_multi_iterator* multi
-  cdef int n = Y.dimensions[axis]
+  cdef int n = Y.shape[axis]
+  cdef int err
 
-  # Create output array
-  dims = list(Y.shape)
-  W = np.zeros(dims)
-  Z = np.zeros(dims)
+  # Subjects first, voxels side by side 
+  shape = tuple([Y.shape[i] for i in range(Y.ndim) if not i == axis])
+  Ya = _subjects_first(Y, axis)
+  Va = _subjects_first(V, axis)
+  Wa = np.zeros((Ya.shape[0], Ya.shape[1]))
+  Za = np.zeros((Ya.shape[0], Ya.shape[1]))
 
-  # Create local structure
+  # Create local structures
   stat = fff_onesample_stat_mfx_new(n, FFF_ONESAMPLE_EMPIRICAL_MEAN_MFX, base)
   stat.niter = niter
   stat.constraint = constraint
+  y = fff_matrix_fromPyArray(Ya)
+  v = fff_matrix_fromPyArray(Va)
+  w = fff_matrix_fromPyArray(Wa)
+  z = fff_matrix_fromPyArray(Za)
 
-  # Multi-iterator 
-  multi = fffpy_multi_iterator_new(4, axis, <void*>Y, <void*>V, <void*>W, <void*>Z)
-
-  # Create views on nd-arrays
-  y = multi.vector[0]
-  v = multi.vector[1]
-  w = multi.vector[2]
-  z = multi.vector[3]
-
-  # Loop
-  while(multi.index < multi.size):
-    fff_onesample_stat_mfx_pdf_fit(w, z, stat, y, v)
-    fffpy_multi_iterator_update(multi)
-  
+  err = fff_onesample_stat_mfx_pdf_fit_block(w, z, stat, y, v)
 
   # Delete local structures
-  fffpy_multi_iterator_delete(multi)
+  fff_matrix_delete(y)
+  fff_matrix_delete(v)
+  fff_matrix_delete(w)
+  fff_matrix_delete(z)
   fff_onesample_stat_mfx_delete(stat)
+  if err:
+    raise ValueError('mixed-effects fit failed: inconsistent data and variances')
 
   # Return
-  return W, Z
+  return _voxels_back(Wa, shape, axis), _voxels_back(Za, shape, axis)
 
 
 def pdf_fit_gmfx(ndarray Y, ndarray V, int axis=0, int niter=5, int constraint=0, double base=0.0):
@@ -278,43 +471,112 @@ def pdf_fit_gmfx(ndarray Y, ndarray V, int axis=0, int niter=5, int constraint=0
   (MU, S2) = pdf_fit_gmfx(data=Y, vardata=V, axis=0, niter=5, constraint=False, base=0.0).
   
   Comments to follow.
+
+  The voxels are fitted by blocks, with the EM iterations run in
+  lockstep. 
   """
-  cdef fff_vector *y, *v, *mu, *s2
+  cdef fff_matrix *y, *v
+  cdef fff_vector *mu, *s2
   cdef fff_onesample_stat_mfx* stat
-  cdef fffpy_multi_iterator* multi
-  cdef int n = Y.dimensions[axis]
+  cdef int n = Y.shape[axis]
+  cdef int err
   
-  # Create output array
-  dims = list(Y.shape)
-  dims[axis] = 1
-  MU = np.zeros(dims)
-  S2 = np.zeros(dims)
-
-  # Create local structure
+  # Subjects first, voxels side by side 
+  shape = tuple([Y.shape[i] for i in range(Y.ndim) if not i == axis])
+  Ya = _subjects_first(Y, axis)
+  Va = _subjects_first(V, axis)
+  MU = np.zeros((1, Ya.shape[1]))
+  S2 = np.zeros((1, Ya.shape[1]))
+
+  # Create local structures
   stat = fff_onesample_stat_mfx_new(n, FFF_ONESAMPLE_STUDENT_MFX, base)
   stat.niter = niter
   stat.constraint = constraint
+  y = fff_matrix_fromPyArray(Ya)
+  v = fff_matrix_fromPyArray(Va)
+  mu = fff_vector_fromPyArray(MU[0])
+  s2 = fff_vector_fromPyArray(S2[0])
 
-  # Multi-iterator 
-  multi = fffpy_multi_iterator_new(4, axis, <void*>Y, <void*>V, <void*>MU, <void*>S2)
-
-  # Create views on nd-arrays
-  y = multi.vector[0]
-  v = multi.vector[1]
-  mu = multi.vector[2]
-  s2 = multi.vector[3]
-
-  # Loop
-  while(multi.index < multi.size):
-    fff_onesample_stat_gmfx_pdf_fit(mu.data, s2.data, stat, y, v)
-    fffpy_multi_iterator_update(multi)
-  
+  err = fff_onesample_stat_gmfx_pdf_fit_block(mu, s2, stat, y, v)
 
   # Delete local structures
-  fffpy_multi_iterator_delete(multi)
+  fff_matrix_delete(y)
+  fff_matrix_delete(v)
+  fff_vector_delete(mu)
+  fff_vector_delete(s2)
   fff_onesample_stat_mfx_delete(stat)
+  if err:
+    raise ValueError('mixed-effects fit failed: inconsistent data and variances')
 
   # Return
-  return MU, S2
+  return _voxels_back(MU, shape, axis), _voxels_back(S2, shape, axis)
 
-  
+
+def reproducibility_clusters(ndarray data, ndarray vardata, ndarray xyz, ndarray samples,
+                             double threshold, long csize, method='crfx', ndarray signs=None,
+                             unsigned int niter=5, int k=18, int nthreads=1):
+  """
+  (Labels, rmap) = reproducibility_clusters(data, vardata, xyz, samples, threshold, csize, method='crfx', signs=None, niter=5, k=18, nthreads=1).
+
+  Cluster the group statistic maps of several subgroups of subjects.
+  data and vardata are (nvox, nsubj) arrays of effects and
+  variances, xyz is the (nvox, 3) array of grid coordinates, and
+  samples is the (ngroups, groupsize) array of the subjects of each
+  subgroup. If given, signs is an array of signs of the same shape
+  as samples, applied to the effects.
+
+  The statistic of each subgroup is the Student ('crfx'),
+  fixed-effects ('cffx') or mixed-effects ('cmfx', with niter EM
+  iterations) one-sample statistic. Clusters are the k-connected
+  components of the voxels above threshold with at least csize
+  voxels. Labels is the (ngroups, nvox) array of the cluster of each
+  voxel in each subgroup, -1 outside the clusters, and rmap counts
+  the subgroups in which each voxel is clustered.
+
+  Subgroups are split across nthreads threads, see stat.
+  """
+  cdef fff_matrix *d, *vd = NULL, *s = NULL
+  cdef fff_array *smp, *lab
+  cdef fff_vector *r
+  cdef fff_graph* G
+  cdef ndarray ijk
+  cdef fff_reproducibility_method flag = reproducibility_methods[method]
+  cdef long nvox = data.shape[0]
+  cdef int err
+
+  # Grid graph, with coordinates stored coordinate by coordinate 
+  ijk = np.ascontiguousarray(xyz.T, dtype=np.long)
+  fff_graph_grid_stencil(&G, <long*>ijk.data, nvox, k)
+
+  # Views or copies of the inputs 
+  samples = np.asarray(samples, dtype=np.long)
+  d = fff_matrix_fromPyArray(data)
+  if flag != FFF_REPRODUCIBILITY_RFX:
+    vd = fff_matrix_fromPyArray(vardata)
+  if signs != None:
+    s = fff_matrix_fromPyArray(np.asarray(signs, dtype='d'))
+  smp = fff_array_fromPyArray(samples)
+
+  # Outputs
+  Labels = np.zeros((samples.shape[0], nvox), dtype=np.long)
+  lab = fff_array_fromPyArray(Labels)
+  r = fff_vector_new(nvox)
+
+  err = fff_reproducibility_clusters(lab, r, d, vd, smp, s, G, flag,
+                                     threshold, csize, niter, nthreads)
+
+  # Free memory 
+  fff_graph_delete(G)
+  fff_matrix_delete(d)
+  if vd != NULL:
+    fff_matrix_delete(vd)
+  if s != NULL:
+    fff_matrix_delete(s)
+  fff_array_delete(smp)
+  fff_array_delete(lab)
+  rmap = fff_vector_toPyArray(r)
+  if err:
+    raise ValueError('incompatible dimensions or subject indices')
+
+  # Return
+  return Labels, rmap
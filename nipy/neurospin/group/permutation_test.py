@@ -5,7 +5,7 @@ import numpy as np
 import scipy.misc as sm
 
 # Our own imports
-from nipy.neurospin.graph import graph_3d_grid, graph_cc
+from nipy.neurospin.graph import graph_3d_grid, graph_cc, graph_cc_max, graph_cc_th
 from nipy.neurospin.graph.field import Field
 from onesample import stat as os_stat, stat_mfx as os_stat_mfx
 from twosample import stat as ts_stat, stat_mfx as ts_stat_mfx
@@ -17,6 +17,7 @@ DEF_NPERMS = int(1e4)
 DEF_NITER = 5
 DEF_STAT_ONESAMPLE = 'student'
 DEF_STAT_TWOSAMPLE = 'student'
+DEF_NULL_BLOCK = 32
 
 
 #===========================================
@@ -156,7 +157,12 @@ def extract_clusters_from_graph(T, G, th):
     I = T >= th
     nlabels = I.sum()
     if nlabels > 0:
-        labels[I] = G.subgraph(I).cc()
+        if G.E > 0:
+            # same labels as G.subgraph(I).cc(), without the subgraph
+            labels = graph_cc_th(G.edges[:,0], G.edges[:,1], np.zeros(G.E),
+                                 np.asarray(T, float), th, G.V)
+        else:
+            labels[I] = np.arange(nlabels)
     return labels
 
 
@@ -200,6 +206,59 @@ def twosample_stat(Y1, V1, Y2, V2, stat_id, axis=0, Magics=None, niter=DEF_NITER
     else:
         return ts_stat_mfx(Y1, V1, Y2, V2, stat_id, axis, Magics, niter)
 
+def null_summaries(stat, magic_numbers, axis=0, XYZ=None, thresh=None, k=18, 
+                   block=DEF_NULL_BLOCK):
+    """
+    maxT, maxsize, maxmass = null_summaries(stat, magic_numbers, axis=0, XYZ=None, thresh=None, k=18)
+    Accumulate the maximum statistic and, if a threshold is given, the
+    maximum suprathreshold cluster size and mass (sum of T-thresh) for
+    each permutation, without storing the permuted statistic maps.
+    In:  stat          function returning the statistic map for an array 
+                       of magic numbers, stacked along axis
+         magic_numbers (nperms) permutation magic numbers 
+         XYZ           (3,p) voxels coordinates, required with thresh
+         thresh        <float> cluster-forming threshold
+         k             <int> the number of neighbours considered. (6,18 or 26)
+         block         <int> number of permutations computed at once
+    Out: maxT          (nperms) maximum statistic values
+         maxsize       (nperms) maximum cluster sizes, or None 
+         maxmass       (nperms) maximum cluster masses, or None
+    Only block statistic maps are held in memory at a time, so memory 
+    is O(block*p + nperms) rather than O(nperms*p).
+    """
+    magic_numbers = np.asarray(magic_numbers)
+    nmagic = len(magic_numbers)
+    maxT = np.zeros(nmagic, float)
+    maxsize, maxmass = None, None
+    if thresh != None:
+        A, B, D = graph_3d_grid(XYZ.transpose(), k)
+        maxsize = np.zeros(nmagic, int)
+        maxmass = np.zeros(nmagic, float)
+    for j in xrange(0, nmagic, block):
+        T = stat(magic_numbers[j:j+block])
+        nk = T.shape[axis]
+        T = np.rollaxis(T, axis).reshape(nk, -1)
+        maxT[j:j+nk] = T.max(1)
+        if thresh != None:
+            maxsize[j:j+nk], maxmass[j:j+nk] = graph_cc_max(A, B, D, T, thresh)
+    return maxT, maxsize, maxmass
+
+def onesample_null(Y, V, stat_id, Magics, base=0.0, axis=0, niter=DEF_NITER, 
+                   XYZ=None, thresh=None, k=18, block=DEF_NULL_BLOCK):
+    """
+    Per-permutation summaries of onesample_stat, see null_summaries
+    """
+    stat = lambda m: onesample_stat(Y, V, stat_id, base, axis, m, niter)
+    return null_summaries(stat, Magics, axis, XYZ, thresh, k, block)
+
+def twosample_null(Y1, V1, Y2, V2, stat_id, Magics, axis=0, niter=DEF_NITER, 
+                   XYZ=None, thresh=None, k=18, block=DEF_NULL_BLOCK):
+    """
+    Per-permutation summaries of twosample_stat, see null_summaries
+    """
+    stat = lambda m: twosample_stat(Y1, V1, Y2, V2, stat_id, axis, m, niter)
+    return null_summaries(stat, Magics, axis, XYZ, thresh, k, block)
+
 #=================================================
 #=================================================
 # Compute cluster and region summary statistics
@@ -1,2919 +0,0 @@
-/* Generated by Cython 0.10.3 on Sat Feb 28 00:26:33 2009 */
-
-#define PY_SSIZE_T_CLEAN
-#include "Python.h"
-#include "structmember.h"
-#ifndef PY_LONG_LONG
-  #define PY_LONG_LONG LONG_LONG
-#endif
-#ifndef DL_EXPORT
-  #define DL_EXPORT(t) t
-#endif
-#if PY_VERSION_HEX < 0x02040000
-  #define METH_COEXIST 0
-#endif
-#if PY_VERSION_HEX < 0x02050000
-  typedef int Py_ssize_t;
-  #define PY_SSIZE_T_MAX INT_MAX
-  #define PY_SSIZE_T_MIN INT_MIN
-  #define PyInt_FromSsize_t(z) PyInt_FromLong(z)
-  #define PyInt_AsSsize_t(o)   PyInt_AsLong(o)
-  #define PyNumber_Index(o)    PyNumber_Int(o)
-  #define PyIndex_Check(o)     PyNumber_Check(o)
-#endif
-#if PY_VERSION_HEX < 0x02060000
-  #define Py_REFCNT(ob) (((PyObject*)(ob))->ob_refcnt)
-  #define Py_TYPE(ob)   (((PyObject*)(ob))->ob_type)
-  #define Py_SIZE(ob)   (((PyVarObject*)(ob))->ob_size)
-  #define PyVarObject_HEAD_INIT(type, size) \
-          PyObject_HEAD_INIT(type) size,
-  #define PyType_Modified(t)
-
-  typedef struct {
-       void *buf;
-       PyObject *obj;
-       Py_ssize_t len;
-       Py_ssize_t itemsize;
-       int readonly;
-       int ndim;
-       char *format;
-       Py_ssize_t *shape;
-       Py_ssize_t *strides;
-       Py_ssize_t *suboffsets;
-       void *internal;
-  } Py_buffer;
-
-  #define PyBUF_SIMPLE 0
-  #define PyBUF_WRITABLE 0x0001
-  #define PyBUF_LOCK 0x0002
-  #define PyBUF_FORMAT 0x0004
-  #define PyBUF_ND 0x0008
-  #define PyBUF_STRIDES (0x0010 | PyBUF_ND)
-  #define PyBUF_C_CONTIGUOUS (0x0020 | PyBUF_STRIDES)
-  #define PyBUF_F_CONTIGUOUS (0x0040 | PyBUF_STRIDES)
-  #define PyBUF_ANY_CONTIGUOUS (0x0080 | PyBUF_STRIDES)
-  #define PyBUF_INDIRECT (0x0100 | PyBUF_STRIDES)
-
-#endif
-#if PY_MAJOR_VERSION < 3
-  #define __Pyx_BUILTIN_MODULE_NAME "__builtin__"
-#else
-  #define __Pyx_BUILTIN_MODULE_NAME "builtins"
-#endif
-#if PY_MAJOR_VERSION >= 3
-  #define Py_TPFLAGS_CHECKTYPES 0
-  #define Py_TPFLAGS_HAVE_INDEX 0
-#endif
-#if (PY_VERSION_HEX < 0x02060000) || (PY_MAJOR_VERSION >= 3)
-  #define Py_TPFLAGS_HAVE_NEWBUFFER 0
-#endif
-#if PY_MAJOR_VERSION >= 3
-  #define PyBaseString_Type            PyUnicode_Type
-  #define PyString_Type                PyBytes_Type
-  #define PyInt_Type                   PyLong_Type
-  #define PyInt_Check(op)              PyLong_Check(op)
-  #define PyInt_CheckExact(op)         PyLong_CheckExact(op)
-  #define PyInt_FromString             PyLong_FromString
-  #define PyInt_FromUnicode            PyLong_FromUnicode
-  #define PyInt_FromLong               PyLong_FromLong
-  #define PyInt_FromSize_t             PyLong_FromSize_t
-  #define PyInt_FromSsize_t            PyLong_FromSsize_t
-  #define PyInt_AsLong                 PyLong_AsLong
-  #define PyInt_AS_LONG                PyLong_AS_LONG
-  #define PyInt_AsSsize_t              PyLong_AsSsize_t
-  #define PyInt_AsUnsignedLongMask     PyLong_AsUnsignedLongMask
-  #define PyInt_AsUnsignedLongLongMask PyLong_AsUnsignedLongLongMask
-  #define __Pyx_PyNumber_Divide(x,y)         PyNumber_TrueDivide(x,y)
-#else
-  #define __Pyx_PyNumber_Divide(x,y)         PyNumber_Divide(x,y)
-  #define PyBytes_Type                 PyString_Type
-#endif
-#if PY_MAJOR_VERSION >= 3
-  #define PyMethod_New(func, self, klass) PyInstanceMethod_New(func)
-#endif
-#if !defined(WIN32) && !defined(MS_WINDOWS)
-  #ifndef __stdcall
-    #define __stdcall
-  #endif
-  #ifndef __cdecl
-    #define __cdecl
-  #endif
-#else
-  #define _USE_MATH_DEFINES
-#endif
-#ifdef __cplusplus
-#define __PYX_EXTERN_C extern "C"
-#else
-#define __PYX_EXTERN_C extern
-#endif
-#include <math.h>
-#define __PYX_HAVE_API__fff2__group__routines
-#include "stdlib.h"
-#include "numpy/arrayobject.h"
-
-
-#ifdef __GNUC__
-#define INLINE __inline__
-#elif _WIN32
-#define INLINE __inline
-#else
-#define INLINE 
-#endif
-
-typedef struct {PyObject **p; char *s; long n; char is_unicode; char intern; char is_identifier;} __Pyx_StringTabEntry; /*proto*/
-
-
-
-static int __pyx_skip_dispatch = 0;
-
-
-/* Type Conversion Predeclarations */
-
-#if PY_MAJOR_VERSION < 3
-#define __Pyx_PyBytes_FromString PyString_FromString
-#define __Pyx_PyBytes_AsString   PyString_AsString
-#else
-#define __Pyx_PyBytes_FromString PyBytes_FromString
-#define __Pyx_PyBytes_AsString   PyBytes_AsString
-#endif
-
-#define __Pyx_PyBool_FromLong(b) ((b) ? (Py_INCREF(Py_True), Py_True) : (Py_INCREF(Py_False), Py_False))
-static INLINE int __Pyx_PyObject_IsTrue(PyObject* x);
-static INLINE PY_LONG_LONG __pyx_PyInt_AsLongLong(PyObject* x);
-static INLINE unsigned PY_LONG_LONG __pyx_PyInt_AsUnsignedLongLong(PyObject* x);
-static INLINE Py_ssize_t __pyx_PyIndex_AsSsize_t(PyObject* b);
-
-#define __pyx_PyInt_AsLong(x) (PyInt_CheckExact(x) ? PyInt_AS_LONG(x) : PyInt_AsLong(x))
-#define __pyx_PyFloat_AsDouble(x) (PyFloat_CheckExact(x) ? PyFloat_AS_DOUBLE(x) : PyFloat_AsDouble(x))
-
-static INLINE unsigned char __pyx_PyInt_unsigned_char(PyObject* x);
-static INLINE unsigned short __pyx_PyInt_unsigned_short(PyObject* x);
-static INLINE char __pyx_PyInt_char(PyObject* x);
-static INLINE short __pyx_PyInt_short(PyObject* x);
-static INLINE int __pyx_PyInt_int(PyObject* x);
-static INLINE long __pyx_PyInt_long(PyObject* x);
-static INLINE signed char __pyx_PyInt_signed_char(PyObject* x);
-static INLINE signed short __pyx_PyInt_signed_short(PyObject* x);
-static INLINE signed int __pyx_PyInt_signed_int(PyObject* x);
-static INLINE signed long __pyx_PyInt_signed_long(PyObject* x);
-static INLINE long double __pyx_PyInt_long_double(PyObject* x);
-#ifdef __GNUC__
-/* Test for GCC > 2.95 */
-#if __GNUC__ > 2 ||               (__GNUC__ == 2 && (__GNUC_MINOR__ > 95)) 
-#define likely(x)   __builtin_expect(!!(x), 1)
-#define unlikely(x) __builtin_expect(!!(x), 0)
-#else /* __GNUC__ > 2 ... */
-#define likely(x)   (x)
-#define unlikely(x) (x)
-#endif /* __GNUC__ > 2 ... */
-#else /* __GNUC__ */
-#define likely(x)   (x)
-#define unlikely(x) (x)
-#endif /* __GNUC__ */
-    
-static PyObject *__pyx_m;
-static PyObject *__pyx_b;
-static PyObject *__pyx_empty_tuple;
-static int __pyx_lineno;
-static int __pyx_clineno = 0;
-static const char * __pyx_cfilenm= __FILE__;
-static const char *__pyx_filename;
-static const char **__pyx_f;
-
-static char __pyx_mdoc[] = "\nBasic ndarray routines for faster computations.\n\nAuthor: Alexis Roche, 2008.\n";
-
-static void __Pyx_RaiseDoubleKeywordsError(
-    const char* func_name, PyObject* kw_name); /*proto*/
-
-static void __Pyx_RaiseArgtupleInvalid(const char* func_name, int exact,
-    Py_ssize_t num_min, Py_ssize_t num_max, Py_ssize_t num_found); /*proto*/
-
-static int __Pyx_ParseOptionalKeywords(PyObject *kwds, PyObject **argnames[],     PyObject *kwds2, PyObject *values[], Py_ssize_t num_pos_args,     const char* function_name); /*proto*/
-static INLINE void __Pyx_SafeReleaseBuffer(Py_buffer* info);
-static INLINE void __Pyx_ZeroBuffer(Py_buffer* buf); /*proto*/
-static INLINE const char* __Pyx_ConsumeWhitespace(const char* ts); /*proto*/
-static void __Pyx_BufferNdimError(Py_buffer* buffer, int expected_ndim); /*proto*/
-static const char* __Pyx_DescribeTokenInFormatString(const char* ts); /*proto*/
-static const char* __Pyx_CheckTypestring_nn___pyx_t_5numpy_float_t(const char* ts); /*proto*/
-
-static int __Pyx_GetBuffer_nn___pyx_t_5numpy_float_t(PyObject* obj, Py_buffer* buf, int flags, int nd, int cast); /*proto*/
-static const char* __Pyx_CheckTypestring_nn___pyx_t_5numpy_int_t(const char* ts); /*proto*/
-
-static int __Pyx_GetBuffer_nn___pyx_t_5numpy_int_t(PyObject* obj, Py_buffer* buf, int flags, int nd, int cast); /*proto*/
-#define __Pyx_BufPtrStrided1d(type, buf, i0, s0) (type)((char*)buf + i0 * s0)
-#define __Pyx_BufPtrStrided2d(type, buf, i0, s0, i1, s1) (type)((char*)buf + i0 * s0 + i1 * s1)
-
-static INLINE void __Pyx_ErrRestore(PyObject *type, PyObject *value, PyObject *tb); /*proto*/
-static INLINE void __Pyx_ErrFetch(PyObject **type, PyObject **value, PyObject **tb); /*proto*/
-
-static INLINE PyObject *__Pyx_GetItemInt(PyObject *o, Py_ssize_t i, int is_unsigned) {
-    PyObject *r;
-    if (PyList_CheckExact(o) && 0 <= i && i < PyList_GET_SIZE(o)) {
-        r = PyList_GET_ITEM(o, i);
-        Py_INCREF(r);
-    }
-    else if (PyTuple_CheckExact(o) && 0 <= i && i < PyTuple_GET_SIZE(o)) {
-        r = PyTuple_GET_ITEM(o, i);
-        Py_INCREF(r);
-    }
-    else if (Py_TYPE(o)->tp_as_sequence && Py_TYPE(o)->tp_as_sequence->sq_item && (likely(i >= 0) || !is_unsigned))
-        r = PySequence_GetItem(o, i);
-    else {
-        PyObject *j = (likely(i >= 0) || !is_unsigned) ? PyInt_FromLong(i) : PyLong_FromUnsignedLongLong((sizeof(unsigned long long) > sizeof(Py_ssize_t) ? (1ULL << (sizeof(Py_ssize_t)*8)) : 0) + i);
-        if (!j)
-            return 0;
-        r = PyObject_GetItem(o, j);
-        Py_DECREF(j);
-    }
-    return r;
-}
-
-static int __Pyx_ArgTypeTest(PyObject *obj, PyTypeObject *type, int none_allowed,
-    const char *name, int exact); /*proto*/
-#if PY_MAJOR_VERSION < 3
-static int __Pyx_GetBuffer(PyObject *obj, Py_buffer *view, int flags);
-static void __Pyx_ReleaseBuffer(Py_buffer *view);
-#else
-#define __Pyx_GetBuffer PyObject_GetBuffer
-#define __Pyx_ReleaseBuffer PyBuffer_Release
-#endif
-
-Py_ssize_t __Pyx_zeros[] = {0, 0};
-Py_ssize_t __Pyx_minusones[] = {-1, -1};
-
-static PyObject *__Pyx_Import(PyObject *name, PyObject *from_list); /*proto*/
-
-static INLINE void __Pyx_ExceptionSave(PyObject **type, PyObject **value, PyObject **tb); /*proto*/
-static void __Pyx_ExceptionReset(PyObject *type, PyObject *value, PyObject *tb); /*proto*/
-
-static PyObject *__Pyx_GetName(PyObject *dict, PyObject *name); /*proto*/
-
-static void __Pyx_Raise(PyObject *type, PyObject *value, PyObject *tb); /*proto*/
-
-static int __Pyx_TypeTest(PyObject *obj, PyTypeObject *type); /*proto*/
-
-static int __Pyx_GetException(PyObject **type, PyObject **value, PyObject **tb); /*proto*/
-
-static PyTypeObject *__Pyx_ImportType(const char *module_name, const char *class_name, long size);  /*proto*/
-
-static PyObject *__Pyx_ImportModule(const char *name); /*proto*/
-
-static void __Pyx_AddTraceback(const char *funcname); /*proto*/
-
-static int __Pyx_InitStrings(__Pyx_StringTabEntry *t); /*proto*/
-
-/* Type declarations */
-
-typedef npy_int8 __pyx_t_5numpy_int8_t;
-
-typedef npy_int16 __pyx_t_5numpy_int16_t;
-
-typedef npy_int32 __pyx_t_5numpy_int32_t;
-
-typedef npy_int64 __pyx_t_5numpy_int64_t;
-
-typedef npy_uint8 __pyx_t_5numpy_uint8_t;
-
-typedef npy_uint16 __pyx_t_5numpy_uint16_t;
-
-typedef npy_uint32 __pyx_t_5numpy_uint32_t;
-
-typedef npy_uint64 __pyx_t_5numpy_uint64_t;
-
-typedef npy_float32 __pyx_t_5numpy_float32_t;
-
-typedef npy_float64 __pyx_t_5numpy_float64_t;
-
-typedef npy_long __pyx_t_5numpy_int_t;
-
-typedef npy_longlong __pyx_t_5numpy_long_t;
-
-typedef npy_ulong __pyx_t_5numpy_uint_t;
-
-typedef npy_ulonglong __pyx_t_5numpy_ulong_t;
-
-typedef npy_double __pyx_t_5numpy_float_t;
-
-typedef npy_double __pyx_t_5numpy_double_t;
-
-typedef npy_longdouble __pyx_t_5numpy_longdouble_t;
-
-typedef npy_cfloat __pyx_t_5numpy_cfloat_t;
-
-typedef npy_cdouble __pyx_t_5numpy_cdouble_t;
-
-typedef npy_clongdouble __pyx_t_5numpy_clongdouble_t;
-/* Module declarations from python_buffer */
-
-/* Module declarations from stdlib */
-
-/* Module declarations from numpy */
-
-/* Module declarations from numpy */
-
-static PyTypeObject *__pyx_ptype_5numpy_dtype = 0;
-static PyTypeObject *__pyx_ptype_5numpy_ndarray = 0;
-/* Module declarations from cython */
-
-/* Module declarations from fff2.group.routines */
-
-
-
-/* Implementation of fff2.group.routines */
-static char __pyx_k_23[] = "0.1";
-static char __pyx_k_A[] = "A";
-static PyObject *__pyx_kp_A;
-static char __pyx_k_B[] = "B";
-static PyObject *__pyx_kp_B;
-static char __pyx_k_I[] = "I";
-static PyObject *__pyx_kp_I;
-static char __pyx_k___version__[] = "__version__";
-static PyObject *__pyx_kp___version__;
-static char __pyx_k_numpy[] = "numpy";
-static PyObject *__pyx_kp_numpy;
-static char __pyx_k_np[] = "np";
-static PyObject *__pyx_kp_np;
-static PyObject *__pyx_kp_23;
-static char __pyx_k___getbuffer__[] = "__getbuffer__";
-static PyObject *__pyx_kp___getbuffer__;
-static char __pyx_k___releasebuffer__[] = "__releasebuffer__";
-static PyObject *__pyx_kp___releasebuffer__;
-static char __pyx_k_info[] = "info";
-static PyObject *__pyx_kp_info;
-static char __pyx_k_flags[] = "flags";
-static PyObject *__pyx_kp_flags;
-static char __pyx_k_ValueError[] = "ValueError";
-static PyObject *__pyx_kp_ValueError;
-static char __pyx_k_iteritems[] = "iteritems";
-static PyObject *__pyx_kp_iteritems;
-static char __pyx_k_next[] = "next";
-static PyObject *__pyx_kp_next;
-static char __pyx_k_StopIteration[] = "StopIteration";
-static PyObject *__pyx_kp_StopIteration;
-static char __pyx_k_pop[] = "pop";
-static PyObject *__pyx_kp_pop;
-static char __pyx_k_RuntimeError[] = "RuntimeError";
-static PyObject *__pyx_kp_RuntimeError;
-static PyObject *__pyx_kp_1;
-static PyObject *__pyx_kp_2;
-static PyObject *__pyx_kp_20;
-static PyObject *__pyx_kp_21;
-static PyObject *__pyx_kp_22;
-static PyObject *__pyx_builtin_ValueError;
-static PyObject *__pyx_builtin_StopIteration;
-static PyObject *__pyx_builtin_RuntimeError;
-static char __pyx_k_1[] = "ndarray is not C contiguous";
-static char __pyx_k_2[] = "ndarray is not Fortran contiguous";
-static char __pyx_k_3[] = "b";
-static char __pyx_k_4[] = "B";
-static char __pyx_k_5[] = "h";
-static char __pyx_k_6[] = "H";
-static char __pyx_k_7[] = "i";
-static char __pyx_k_8[] = "I";
-static char __pyx_k_9[] = "l";
-static char __pyx_k_10[] = "L";
-static char __pyx_k_11[] = "q";
-static char __pyx_k_12[] = "Q";
-static char __pyx_k_13[] = "f";
-static char __pyx_k_14[] = "d";
-static char __pyx_k_15[] = "g";
-static char __pyx_k_16[] = "Zf";
-static char __pyx_k_17[] = "Zd";
-static char __pyx_k_18[] = "Zg";
-static char __pyx_k_19[] = "O";
-static char __pyx_k_20[] = "unknown dtype code in numpy.pxd (%d)";
-static char __pyx_k_21[] = "Format string allocated too short.";
-static char __pyx_k_22[] = "unknown dtype code in numpy.pxd (%d)";
-
-/* "d:\home\ar203069\bzr\nipy\fff2\fff2\group\routines.pyx":17
- * 
- * @cython.boundscheck(False)
- * def add_lines(np.ndarray[np.float_t, ndim=2] A,             # <<<<<<<<<<<<<<
- *                np.ndarray[np.float_t, ndim=2] B,
- *                np.ndarray[np.int_t,   ndim=1] I):
- */
-
-static PyObject *__pyx_pf_4fff2_5group_8routines_add_lines(PyObject *__pyx_self, PyObject *__pyx_args, PyObject *__pyx_kwds); /*proto*/
-static char __pyx_doc_4fff2_5group_8routines_add_lines[] = "\n    add(A, B, I)\n\n    Add each line of A to a line of B indexed by I, where\n    A and B are two-dimensional arrays and I is a\n    one-dimensional array of indices.\n\n    This is equivalent to: \n\n    for i in xrange(len(I)):\n      B[I[i]] += A[i]\n\n    ";
-static PyObject *__pyx_pf_4fff2_5group_8routines_add_lines(PyObject *__pyx_self, PyObject *__pyx_args, PyObject *__pyx_kwds) {
-  PyArrayObject *__pyx_v_A = 0;
-  PyArrayObject *__pyx_v_B = 0;
-  PyArrayObject *__pyx_v_I = 0;
-  int __pyx_v_i;
-  int __pyx_v_j;
-  int __pyx_v_index;
-  int __pyx_v_i_max;
-  int __pyx_v_j_max;
-  Py_buffer __pyx_bstruct_A;
-  Py_ssize_t __pyx_bstride_0_A = 0;
-  Py_ssize_t __pyx_bstride_1_A = 0;
-  Py_ssize_t __pyx_bshape_0_A = 0;
-  Py_ssize_t __pyx_bshape_1_A = 0;
-  Py_buffer __pyx_bstruct_B;
-  Py_ssize_t __pyx_bstride_0_B = 0;
-  Py_ssize_t __pyx_bstride_1_B = 0;
-  Py_ssize_t __pyx_bshape_0_B = 0;
-  Py_ssize_t __pyx_bshape_1_B = 0;
-  Py_buffer __pyx_bstruct_I;
-  Py_ssize_t __pyx_bstride_0_I = 0;
-  Py_ssize_t __pyx_bshape_0_I = 0;
-  PyObject *__pyx_r;
-  int __pyx_t_1;
-  int __pyx_t_2;
-  int __pyx_t_3;
-  int __pyx_t_4;
-  int __pyx_t_5;
-  int __pyx_t_6;
-  int __pyx_t_7;
-  static PyObject **__pyx_pyargnames[] = {&__pyx_kp_A,&__pyx_kp_B,&__pyx_kp_I,0};
-  __pyx_self = __pyx_self;
-  if (unlikely(__pyx_kwds)) {
-    PyObject* values[3] = {0,0,0};
-    Py_ssize_t kw_args = PyDict_Size(__pyx_kwds);
-    switch (PyTuple_GET_SIZE(__pyx_args)) {
-      case  3: values[2] = PyTuple_GET_ITEM(__pyx_args, 2);
-      case  2: values[1] = PyTuple_GET_ITEM(__pyx_args, 1);
-      case  1: values[0] = PyTuple_GET_ITEM(__pyx_args, 0);
-      case  0: break;
-      default: goto __pyx_L5_argtuple_error;
-    }
-    switch (PyTuple_GET_SIZE(__pyx_args)) {
-      case  0:
-      values[0] = PyDict_GetItem(__pyx_kwds, __pyx_kp_A);
-      if (likely(values[0])) kw_args--;
-      else goto __pyx_L5_argtuple_error;
-      case  1:
-      values[1] = PyDict_GetItem(__pyx_kwds, __pyx_kp_B);
-      if (likely(values[1])) kw_args--;
-      else {
-        __Pyx_RaiseArgtupleInvalid("add_lines", 1, 3, 3, 1); {__pyx_filename = __pyx_f[0]; __pyx_lineno = 17; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-      }
-      case  2:
-      values[2] = PyDict_GetItem(__pyx_kwds, __pyx_kp_I);
-      if (likely(values[2])) kw_args--;
-      else {
-        __Pyx_RaiseArgtupleInvalid("add_lines", 1, 3, 3, 2); {__pyx_filename = __pyx_f[0]; __pyx_lineno = 17; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-      }
-    }
-    if (unlikely(kw_args > 0)) {
-      if (unlikely(__Pyx_ParseOptionalKeywords(__pyx_kwds, __pyx_pyargnames, 0, values, PyTuple_GET_SIZE(__pyx_args), "add_lines") < 0)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 17; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-    }
-    __pyx_v_A = ((PyArrayObject *)values[0]);
-    __pyx_v_B = ((PyArrayObject *)values[1]);
-    __pyx_v_I = ((PyArrayObject *)values[2]);
-  } else if (PyTuple_GET_SIZE(__pyx_args) != 3) {
-    goto __pyx_L5_argtuple_error;
-  } else {
-    __pyx_v_A = ((PyArrayObject *)PyTuple_GET_ITEM(__pyx_args, 0));
-    __pyx_v_B = ((PyArrayObject *)PyTuple_GET_ITEM(__pyx_args, 1));
-    __pyx_v_I = ((PyArrayObject *)PyTuple_GET_ITEM(__pyx_args, 2));
-  }
-  goto __pyx_L4_argument_unpacking_done;
-  __pyx_L5_argtuple_error:;
-  __Pyx_RaiseArgtupleInvalid("add_lines", 1, 3, 3, PyTuple_GET_SIZE(__pyx_args)); {__pyx_filename = __pyx_f[0]; __pyx_lineno = 17; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-  __pyx_L3_error:;
-  __Pyx_AddTraceback("fff2.group.routines.add_lines");
-  return NULL;
-  __pyx_L4_argument_unpacking_done:;
-  __pyx_bstruct_A.buf = NULL;
-  __pyx_bstruct_B.buf = NULL;
-  __pyx_bstruct_I.buf = NULL;
-  if (unlikely(!__Pyx_ArgTypeTest(((PyObject *)__pyx_v_A), __pyx_ptype_5numpy_ndarray, 1, "A", 0))) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 17; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  if (unlikely(!__Pyx_ArgTypeTest(((PyObject *)__pyx_v_B), __pyx_ptype_5numpy_ndarray, 1, "B", 0))) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 18; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  if (unlikely(!__Pyx_ArgTypeTest(((PyObject *)__pyx_v_I), __pyx_ptype_5numpy_ndarray, 1, "I", 0))) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 19; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  if (unlikely(__Pyx_GetBuffer_nn___pyx_t_5numpy_float_t((PyObject*)__pyx_v_A, &__pyx_bstruct_A, PyBUF_FORMAT| PyBUF_STRIDES, 2, 0) == -1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 17; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __pyx_bstride_0_A = __pyx_bstruct_A.strides[0]; __pyx_bstride_1_A = __pyx_bstruct_A.strides[1];
-  __pyx_bshape_0_A = __pyx_bstruct_A.shape[0]; __pyx_bshape_1_A = __pyx_bstruct_A.shape[1];
-  if (unlikely(__Pyx_GetBuffer_nn___pyx_t_5numpy_float_t((PyObject*)__pyx_v_B, &__pyx_bstruct_B, PyBUF_FORMAT| PyBUF_STRIDES| PyBUF_WRITABLE, 2, 0) == -1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 17; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __pyx_bstride_0_B = __pyx_bstruct_B.strides[0]; __pyx_bstride_1_B = __pyx_bstruct_B.strides[1];
-  __pyx_bshape_0_B = __pyx_bstruct_B.shape[0]; __pyx_bshape_1_B = __pyx_bstruct_B.shape[1];
-  if (unlikely(__Pyx_GetBuffer_nn___pyx_t_5numpy_int_t((PyObject*)__pyx_v_I, &__pyx_bstruct_I, PyBUF_FORMAT| PyBUF_STRIDES, 1, 0) == -1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 17; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __pyx_bstride_0_I = __pyx_bstruct_I.strides[0];
-  __pyx_bshape_0_I = __pyx_bstruct_I.shape[0];
-
-  /* "d:\home\ar203069\bzr\nipy\fff2\fff2\group\routines.pyx":34
- *     """
- *     cdef int i, j, index
- *     cdef int i_max = I.shape[0]             # <<<<<<<<<<<<<<
- *     cdef int j_max = B.shape[1]
- * 
- */
-  __pyx_v_i_max = (__pyx_v_I->dimensions[0]);
-
-  /* "d:\home\ar203069\bzr\nipy\fff2\fff2\group\routines.pyx":35
- *     cdef int i, j, index
- *     cdef int i_max = I.shape[0]
- *     cdef int j_max = B.shape[1]             # <<<<<<<<<<<<<<
- * 
- *     for i in range(i_max):
- */
-  __pyx_v_j_max = (__pyx_v_B->dimensions[1]);
-
-  /* "d:\home\ar203069\bzr\nipy\fff2\fff2\group\routines.pyx":37
- *     cdef int j_max = B.shape[1]
- * 
- *     for i in range(i_max):             # <<<<<<<<<<<<<<
- *         index = I[i]
- *         for j in range(j_max):
- */
-  for (__pyx_v_i = 0; __pyx_v_i < __pyx_v_i_max; __pyx_v_i+=1) {
-
-    /* "d:\home\ar203069\bzr\nipy\fff2\fff2\group\routines.pyx":38
- * 
- *     for i in range(i_max):
- *         index = I[i]             # <<<<<<<<<<<<<<
- *         for j in range(j_max):
- *             B[index, j] = B[index, j] + A[i, j]
- */
-    __pyx_t_1 = __pyx_v_i;
-    if (__pyx_t_1 < 0) __pyx_t_1 += __pyx_bshape_0_I;
-    __pyx_v_index = (*__Pyx_BufPtrStrided1d(__pyx_t_5numpy_int_t *, __pyx_bstruct_I.buf, __pyx_t_1, __pyx_bstride_0_I));
-
-    /* "d:\home\ar203069\bzr\nipy\fff2\fff2\group\routines.pyx":39
- *     for i in range(i_max):
- *         index = I[i]
- *         for j in range(j_max):             # <<<<<<<<<<<<<<
- *             B[index, j] = B[index, j] + A[i, j]
- * 
- */
-    for (__pyx_v_j = 0; __pyx_v_j < __pyx_v_j_max; __pyx_v_j+=1) {
-
-      /* "d:\home\ar203069\bzr\nipy\fff2\fff2\group\routines.pyx":40
- *         index = I[i]
- *         for j in range(j_max):
- *             B[index, j] = B[index, j] + A[i, j]             # <<<<<<<<<<<<<<
- * 
- */
-      __pyx_t_2 = __pyx_v_index;
-      __pyx_t_3 = __pyx_v_j;
-      if (__pyx_t_2 < 0) __pyx_t_2 += __pyx_bshape_0_B;
-      if (__pyx_t_3 < 0) __pyx_t_3 += __pyx_bshape_1_B;
-      __pyx_t_4 = __pyx_v_i;
-      __pyx_t_5 = __pyx_v_j;
-      if (__pyx_t_4 < 0) __pyx_t_4 += __pyx_bshape_0_A;
-      if (__pyx_t_5 < 0) __pyx_t_5 += __pyx_bshape_1_A;
-      __pyx_t_6 = __pyx_v_index;
-      __pyx_t_7 = __pyx_v_j;
-      if (__pyx_t_6 < 0) __pyx_t_6 += __pyx_bshape_0_B;
-      if (__pyx_t_7 < 0) __pyx_t_7 += __pyx_bshape_1_B;
-      *__Pyx_BufPtrStrided2d(__pyx_t_5numpy_float_t *, __pyx_bstruct_B.buf, __pyx_t_6, __pyx_bstride_0_B, __pyx_t_7, __pyx_bstride_1_B) = ((*__Pyx_BufPtrStrided2d(__pyx_t_5numpy_float_t *, __pyx_bstruct_B.buf, __pyx_t_2, __pyx_bstride_0_B, __pyx_t_3, __pyx_bstride_1_B)) + (*__Pyx_BufPtrStrided2d(__pyx_t_5numpy_float_t *, __pyx_bstruct_A.buf, __pyx_t_4, __pyx_bstride_0_A, __pyx_t_5, __pyx_bstride_1_A)));
-    }
-  }
-
-  __pyx_r = Py_None; Py_INCREF(Py_None);
-  goto __pyx_L0;
-  __pyx_L1_error:;
-  { PyObject *__pyx_type, *__pyx_value, *__pyx_tb;
-    __Pyx_ErrFetch(&__pyx_type, &__pyx_value, &__pyx_tb);
-    __Pyx_SafeReleaseBuffer(&__pyx_bstruct_A);
-    __Pyx_SafeReleaseBuffer(&__pyx_bstruct_B);
-    __Pyx_SafeReleaseBuffer(&__pyx_bstruct_I);
-  __Pyx_ErrRestore(__pyx_type, __pyx_value, __pyx_tb);}
-  __Pyx_AddTraceback("fff2.group.routines.add_lines");
-  __pyx_r = NULL;
-  goto __pyx_L2;
-  __pyx_L0:;
-  __Pyx_SafeReleaseBuffer(&__pyx_bstruct_A);
-  __Pyx_SafeReleaseBuffer(&__pyx_bstruct_B);
-  __Pyx_SafeReleaseBuffer(&__pyx_bstruct_I);
-  __pyx_L2:;
-  return __pyx_r;
-}
-
-/* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":50
- *         # experimental exception made for __getbuffer__ and __releasebuffer__
- *         # -- the details of this may change.
- *         def __getbuffer__(ndarray self, Py_buffer* info, int flags):             # <<<<<<<<<<<<<<
- *             # This implementation of getbuffer is geared towards Cython
- *             # requirements, and does not yet fullfill the PEP.
- */
-
-static int __pyx_pf_5numpy_7ndarray___getbuffer__(PyObject *__pyx_v_self, Py_buffer *__pyx_v_info, int __pyx_v_flags); /*proto*/
-static int __pyx_pf_5numpy_7ndarray___getbuffer__(PyObject *__pyx_v_self, Py_buffer *__pyx_v_info, int __pyx_v_flags) {
-  int __pyx_v_copy_shape;
-  int __pyx_v_i;
-  int __pyx_v_ndim;
-  int __pyx_v_t;
-  char *__pyx_v_f;
-  PyArray_Descr *__pyx_v_descr = 0;
-  PyObject *__pyx_v_stack;
-  int __pyx_v_hasfields;
-  PyObject *__pyx_v_iterator;
-  int __pyx_r;
-  int __pyx_1;
-  PyObject *__pyx_2 = 0;
-  PyObject *__pyx_3 = 0;
-  int __pyx_4;
-  PyObject *__pyx_5 = 0;
-  PyObject *__pyx_6 = 0;
-  PyObject *__pyx_7 = 0;
-  Py_ssize_t __pyx_8 = 0;
-  PyObject *__pyx_t_1 = NULL;
-  if (__pyx_v_info == NULL) return 0;
-  __pyx_v_info->obj = Py_None; Py_INCREF(Py_None);
-  __pyx_v_stack = ((PyObject *)Py_None); Py_INCREF(Py_None);
-  __pyx_v_iterator = Py_None; Py_INCREF(Py_None);
-
-  /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":56
- *             # of flags
- *             cdef int copy_shape, i, ndim
- *             ndim = PyArray_NDIM(self)             # <<<<<<<<<<<<<<
- * 
- *             if sizeof(npy_intp) != sizeof(Py_ssize_t):
- */
-  __pyx_v_ndim = PyArray_NDIM(((PyArrayObject *)__pyx_v_self));
-
-  /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":58
- *             ndim = PyArray_NDIM(self)
- * 
- *             if sizeof(npy_intp) != sizeof(Py_ssize_t):             # <<<<<<<<<<<<<<
- *                 copy_shape = 1
- *             else:
- */
-  __pyx_1 = ((sizeof(npy_intp)) != (sizeof(Py_ssize_t)));
-  if (__pyx_1) {
-
-    /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":59
- * 
- *             if sizeof(npy_intp) != sizeof(Py_ssize_t):
- *                 copy_shape = 1             # <<<<<<<<<<<<<<
- *             else:
- *                 copy_shape = 0
- */
-    __pyx_v_copy_shape = 1;
-    goto __pyx_L5;
-  }
-  /*else*/ {
-
-    /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":61
- *                 copy_shape = 1
- *             else:
- *                 copy_shape = 0             # <<<<<<<<<<<<<<
- * 
- *             if ((flags & pybuf.PyBUF_C_CONTIGUOUS == pybuf.PyBUF_C_CONTIGUOUS)
- */
-    __pyx_v_copy_shape = 0;
-  }
-  __pyx_L5:;
-
-  /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":63
- *                 copy_shape = 0
- * 
- *             if ((flags & pybuf.PyBUF_C_CONTIGUOUS == pybuf.PyBUF_C_CONTIGUOUS)             # <<<<<<<<<<<<<<
- *                 and not PyArray_CHKFLAGS(self, NPY_C_CONTIGUOUS)):
- *                 raise ValueError("ndarray is not C contiguous")
- */
-  __pyx_1 = ((__pyx_v_flags & PyBUF_C_CONTIGUOUS) == PyBUF_C_CONTIGUOUS);
-  if (__pyx_1) {
-
-    /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":64
- * 
- *             if ((flags & pybuf.PyBUF_C_CONTIGUOUS == pybuf.PyBUF_C_CONTIGUOUS)
- *                 and not PyArray_CHKFLAGS(self, NPY_C_CONTIGUOUS)):             # <<<<<<<<<<<<<<
- *                 raise ValueError("ndarray is not C contiguous")
- * 
- */
-    __pyx_1 = (!PyArray_CHKFLAGS(((PyArrayObject *)__pyx_v_self), NPY_C_CONTIGUOUS));
-  }
-  if (__pyx_1) {
-
-    /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":65
- *             if ((flags & pybuf.PyBUF_C_CONTIGUOUS == pybuf.PyBUF_C_CONTIGUOUS)
- *                 and not PyArray_CHKFLAGS(self, NPY_C_CONTIGUOUS)):
- *                 raise ValueError("ndarray is not C contiguous")             # <<<<<<<<<<<<<<
- * 
- *             if ((flags & pybuf.PyBUF_F_CONTIGUOUS == pybuf.PyBUF_F_CONTIGUOUS)
- */
-    __pyx_2 = PyTuple_New(1); if (unlikely(!__pyx_2)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 65; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_INCREF(__pyx_kp_1);
-    PyTuple_SET_ITEM(__pyx_2, 0, __pyx_kp_1);
-    __pyx_3 = PyObject_Call(__pyx_builtin_ValueError, ((PyObject *)__pyx_2), NULL); if (unlikely(!__pyx_3)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 65; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_DECREF(((PyObject *)__pyx_2)); __pyx_2 = 0;
-    __Pyx_Raise(__pyx_3, 0, 0);
-    Py_DECREF(__pyx_3); __pyx_3 = 0;
-    {__pyx_filename = __pyx_f[1]; __pyx_lineno = 65; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    goto __pyx_L6;
-  }
-  __pyx_L6:;
-
-  /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":67
- *                 raise ValueError("ndarray is not C contiguous")
- * 
- *             if ((flags & pybuf.PyBUF_F_CONTIGUOUS == pybuf.PyBUF_F_CONTIGUOUS)             # <<<<<<<<<<<<<<
- *                 and not PyArray_CHKFLAGS(self, NPY_F_CONTIGUOUS)):
- *                 raise ValueError("ndarray is not Fortran contiguous")
- */
-  __pyx_1 = ((__pyx_v_flags & PyBUF_F_CONTIGUOUS) == PyBUF_F_CONTIGUOUS);
-  if (__pyx_1) {
-
-    /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":68
- * 
- *             if ((flags & pybuf.PyBUF_F_CONTIGUOUS == pybuf.PyBUF_F_CONTIGUOUS)
- *                 and not PyArray_CHKFLAGS(self, NPY_F_CONTIGUOUS)):             # <<<<<<<<<<<<<<
- *                 raise ValueError("ndarray is not Fortran contiguous")
- * 
- */
-    __pyx_1 = (!PyArray_CHKFLAGS(((PyArrayObject *)__pyx_v_self), NPY_F_CONTIGUOUS));
-  }
-  if (__pyx_1) {
-
-    /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":69
- *             if ((flags & pybuf.PyBUF_F_CONTIGUOUS == pybuf.PyBUF_F_CONTIGUOUS)
- *                 and not PyArray_CHKFLAGS(self, NPY_F_CONTIGUOUS)):
- *                 raise ValueError("ndarray is not Fortran contiguous")             # <<<<<<<<<<<<<<
- * 
- *             info.buf = PyArray_DATA(self)
- */
-    __pyx_2 = PyTuple_New(1); if (unlikely(!__pyx_2)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 69; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_INCREF(__pyx_kp_2);
-    PyTuple_SET_ITEM(__pyx_2, 0, __pyx_kp_2);
-    __pyx_3 = PyObject_Call(__pyx_builtin_ValueError, ((PyObject *)__pyx_2), NULL); if (unlikely(!__pyx_3)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 69; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_DECREF(((PyObject *)__pyx_2)); __pyx_2 = 0;
-    __Pyx_Raise(__pyx_3, 0, 0);
-    Py_DECREF(__pyx_3); __pyx_3 = 0;
-    {__pyx_filename = __pyx_f[1]; __pyx_lineno = 69; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    goto __pyx_L7;
-  }
-  __pyx_L7:;
-
-  /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":71
- *                 raise ValueError("ndarray is not Fortran contiguous")
- * 
- *             info.buf = PyArray_DATA(self)             # <<<<<<<<<<<<<<
- *             info.ndim = ndim
- *             if copy_shape:
- */
-  __pyx_v_info->buf = PyArray_DATA(((PyArrayObject *)__pyx_v_self));
-
-  /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":72
- * 
- *             info.buf = PyArray_DATA(self)
- *             info.ndim = ndim             # <<<<<<<<<<<<<<
- *             if copy_shape:
- *                 # Allocate new buffer for strides and shape info. This is allocated
- */
-  __pyx_v_info->ndim = __pyx_v_ndim;
-
-  /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":73
- *             info.buf = PyArray_DATA(self)
- *             info.ndim = ndim
- *             if copy_shape:             # <<<<<<<<<<<<<<
- *                 # Allocate new buffer for strides and shape info. This is allocated
- *                 # as one block, strides first.
- */
-  __pyx_4 = __pyx_v_copy_shape;
-  if (__pyx_4) {
-
-    /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":76
- *                 # Allocate new buffer for strides and shape info. This is allocated
- *                 # as one block, strides first.
- *                 info.strides = <Py_ssize_t*>stdlib.malloc(sizeof(Py_ssize_t) * ndim * 2)             # <<<<<<<<<<<<<<
- *                 info.shape = info.strides + ndim
- *                 for i in range(ndim):
- */
-    __pyx_v_info->strides = ((Py_ssize_t *)malloc((((sizeof(Py_ssize_t)) * __pyx_v_ndim) * 2)));
-
-    /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":77
- *                 # as one block, strides first.
- *                 info.strides = <Py_ssize_t*>stdlib.malloc(sizeof(Py_ssize_t) * ndim * 2)
- *                 info.shape = info.strides + ndim             # <<<<<<<<<<<<<<
- *                 for i in range(ndim):
- *                     info.strides[i] = PyArray_STRIDES(self)[i]
- */
-    __pyx_v_info->shape = (__pyx_v_info->strides + __pyx_v_ndim);
-
-    /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":78
- *                 info.strides = <Py_ssize_t*>stdlib.malloc(sizeof(Py_ssize_t) * ndim * 2)
- *                 info.shape = info.strides + ndim
- *                 for i in range(ndim):             # <<<<<<<<<<<<<<
- *                     info.strides[i] = PyArray_STRIDES(self)[i]
- *                     info.shape[i] = PyArray_DIMS(self)[i]
- */
-    for (__pyx_v_i = 0; __pyx_v_i < __pyx_v_ndim; __pyx_v_i+=1) {
-
-      /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":79
- *                 info.shape = info.strides + ndim
- *                 for i in range(ndim):
- *                     info.strides[i] = PyArray_STRIDES(self)[i]             # <<<<<<<<<<<<<<
- *                     info.shape[i] = PyArray_DIMS(self)[i]
- *             else:
- */
-      (__pyx_v_info->strides[__pyx_v_i]) = (PyArray_STRIDES(((PyArrayObject *)__pyx_v_self))[__pyx_v_i]);
-
-      /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":80
- *                 for i in range(ndim):
- *                     info.strides[i] = PyArray_STRIDES(self)[i]
- *                     info.shape[i] = PyArray_DIMS(self)[i]             # <<<<<<<<<<<<<<
- *             else:
- *                 info.strides = <Py_ssize_t*>PyArray_STRIDES(self)
- */
-      (__pyx_v_info->shape[__pyx_v_i]) = (PyArray_DIMS(((PyArrayObject *)__pyx_v_self))[__pyx_v_i]);
-    }
-    goto __pyx_L8;
-  }
-  /*else*/ {
-
-    /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":82
- *                     info.shape[i] = PyArray_DIMS(self)[i]
- *             else:
- *                 info.strides = <Py_ssize_t*>PyArray_STRIDES(self)             # <<<<<<<<<<<<<<
- *                 info.shape = <Py_ssize_t*>PyArray_DIMS(self)
- *             info.suboffsets = NULL
- */
-    __pyx_v_info->strides = ((Py_ssize_t *)PyArray_STRIDES(((PyArrayObject *)__pyx_v_self)));
-
-    /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":83
- *             else:
- *                 info.strides = <Py_ssize_t*>PyArray_STRIDES(self)
- *                 info.shape = <Py_ssize_t*>PyArray_DIMS(self)             # <<<<<<<<<<<<<<
- *             info.suboffsets = NULL
- *             info.itemsize = PyArray_ITEMSIZE(self)
- */
-    __pyx_v_info->shape = ((Py_ssize_t *)PyArray_DIMS(((PyArrayObject *)__pyx_v_self)));
-  }
-  __pyx_L8:;
-
-  /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":84
- *                 info.strides = <Py_ssize_t*>PyArray_STRIDES(self)
- *                 info.shape = <Py_ssize_t*>PyArray_DIMS(self)
- *             info.suboffsets = NULL             # <<<<<<<<<<<<<<
- *             info.itemsize = PyArray_ITEMSIZE(self)
- *             info.readonly = not PyArray_ISWRITEABLE(self)
- */
-  __pyx_v_info->suboffsets = NULL;
-
-  /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":85
- *                 info.shape = <Py_ssize_t*>PyArray_DIMS(self)
- *             info.suboffsets = NULL
- *             info.itemsize = PyArray_ITEMSIZE(self)             # <<<<<<<<<<<<<<
- *             info.readonly = not PyArray_ISWRITEABLE(self)
- * 
- */
-  __pyx_v_info->itemsize = PyArray_ITEMSIZE(((PyArrayObject *)__pyx_v_self));
-
-  /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":86
- *             info.suboffsets = NULL
- *             info.itemsize = PyArray_ITEMSIZE(self)
- *             info.readonly = not PyArray_ISWRITEABLE(self)             # <<<<<<<<<<<<<<
- * 
- *             cdef int t
- */
-  __pyx_v_info->readonly = (!PyArray_ISWRITEABLE(((PyArrayObject *)__pyx_v_self)));
-
-  /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":89
- * 
- *             cdef int t
- *             cdef char* f = NULL             # <<<<<<<<<<<<<<
- *             cdef dtype descr = self.descr
- *             cdef list stack
- */
-  __pyx_v_f = NULL;
-
-  /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":90
- *             cdef int t
- *             cdef char* f = NULL
- *             cdef dtype descr = self.descr             # <<<<<<<<<<<<<<
- *             cdef list stack
- * 
- */
-  Py_INCREF(((PyObject *)((PyArrayObject *)__pyx_v_self)->descr));
-  __pyx_v_descr = ((PyArrayObject *)__pyx_v_self)->descr;
-
-  /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":93
- *             cdef list stack
- * 
- *             cdef bint hasfields = PyDataType_HASFIELDS(descr)             # <<<<<<<<<<<<<<
- * 
- *             # Ugly hack warning:
- */
-  __pyx_v_hasfields = PyDataType_HASFIELDS(__pyx_v_descr);
-
-  /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":103
- *             # functions).
- * 
- *             if not hasfields and not copy_shape:             # <<<<<<<<<<<<<<
- *                 # do not call releasebuffer
- *                 info.obj = None
- */
-  __pyx_1 = (!__pyx_v_hasfields);
-  if (__pyx_1) {
-    __pyx_1 = (!__pyx_v_copy_shape);
-  }
-  if (__pyx_1) {
-
-    /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":105
- *             if not hasfields and not copy_shape:
- *                 # do not call releasebuffer
- *                 info.obj = None             # <<<<<<<<<<<<<<
- *             else:
- *                 # need to call releasebuffer
- */
-    Py_INCREF(Py_None);
-    Py_DECREF(__pyx_v_info->obj);
-    __pyx_v_info->obj = Py_None;
-    goto __pyx_L11;
-  }
-  /*else*/ {
-
-    /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":108
- *             else:
- *                 # need to call releasebuffer
- *                 info.obj = self             # <<<<<<<<<<<<<<
- * 
- *             if not hasfields:
- */
-    Py_INCREF(__pyx_v_self);
-    Py_DECREF(__pyx_v_info->obj);
-    __pyx_v_info->obj = __pyx_v_self;
-  }
-  __pyx_L11:;
-
-  /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":110
- *                 info.obj = self
- * 
- *             if not hasfields:             # <<<<<<<<<<<<<<
- *                 t = descr.type_num
- *                 if   t == NPY_BYTE:        f = "b"
- */
-  __pyx_1 = (!__pyx_v_hasfields);
-  if (__pyx_1) {
-
-    /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":111
- * 
- *             if not hasfields:
- *                 t = descr.type_num             # <<<<<<<<<<<<<<
- *                 if   t == NPY_BYTE:        f = "b"
- *                 elif t == NPY_UBYTE:       f = "B"
- */
-    __pyx_v_t = __pyx_v_descr->type_num;
-
-    /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":112
- *             if not hasfields:
- *                 t = descr.type_num
- *                 if   t == NPY_BYTE:        f = "b"             # <<<<<<<<<<<<<<
- *                 elif t == NPY_UBYTE:       f = "B"
- *                 elif t == NPY_SHORT:       f = "h"
- */
-    switch (__pyx_v_t) {
-      case NPY_BYTE:
-      __pyx_v_f = __pyx_k_3;
-      break;
-      case NPY_UBYTE:
-
-      /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":113
- *                 t = descr.type_num
- *                 if   t == NPY_BYTE:        f = "b"
- *                 elif t == NPY_UBYTE:       f = "B"             # <<<<<<<<<<<<<<
- *                 elif t == NPY_SHORT:       f = "h"
- *                 elif t == NPY_USHORT:      f = "H"
- */
-      __pyx_v_f = __pyx_k_4;
-      break;
-      case NPY_SHORT:
-
-      /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":114
- *                 if   t == NPY_BYTE:        f = "b"
- *                 elif t == NPY_UBYTE:       f = "B"
- *                 elif t == NPY_SHORT:       f = "h"             # <<<<<<<<<<<<<<
- *                 elif t == NPY_USHORT:      f = "H"
- *                 elif t == NPY_INT:         f = "i"
- */
-      __pyx_v_f = __pyx_k_5;
-      break;
-      case NPY_USHORT:
-
-      /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":115
- *                 elif t == NPY_UBYTE:       f = "B"
- *                 elif t == NPY_SHORT:       f = "h"
- *                 elif t == NPY_USHORT:      f = "H"             # <<<<<<<<<<<<<<
- *                 elif t == NPY_INT:         f = "i"
- *                 elif t == NPY_UINT:        f = "I"
- */
-      __pyx_v_f = __pyx_k_6;
-      break;
-      case NPY_INT:
-
-      /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":116
- *                 elif t == NPY_SHORT:       f = "h"
- *                 elif t == NPY_USHORT:      f = "H"
- *                 elif t == NPY_INT:         f = "i"             # <<<<<<<<<<<<<<
- *                 elif t == NPY_UINT:        f = "I"
- *                 elif t == NPY_LONG:        f = "l"
- */
-      __pyx_v_f = __pyx_k_7;
-      break;
-      case NPY_UINT:
-
-      /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":117
- *                 elif t == NPY_USHORT:      f = "H"
- *                 elif t == NPY_INT:         f = "i"
- *                 elif t == NPY_UINT:        f = "I"             # <<<<<<<<<<<<<<
- *                 elif t == NPY_LONG:        f = "l"
- *                 elif t == NPY_ULONG:       f = "L"
- */
-      __pyx_v_f = __pyx_k_8;
-      break;
-      case NPY_LONG:
-
-      /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":118
- *                 elif t == NPY_INT:         f = "i"
- *                 elif t == NPY_UINT:        f = "I"
- *                 elif t == NPY_LONG:        f = "l"             # <<<<<<<<<<<<<<
- *                 elif t == NPY_ULONG:       f = "L"
- *                 elif t == NPY_LONGLONG:    f = "q"
- */
-      __pyx_v_f = __pyx_k_9;
-      break;
-      case NPY_ULONG:
-
-      /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":119
- *                 elif t == NPY_UINT:        f = "I"
- *                 elif t == NPY_LONG:        f = "l"
- *                 elif t == NPY_ULONG:       f = "L"             # <<<<<<<<<<<<<<
- *                 elif t == NPY_LONGLONG:    f = "q"
- *                 elif t == NPY_ULONGLONG:   f = "Q"
- */
-      __pyx_v_f = __pyx_k_10;
-      break;
-      case NPY_LONGLONG:
-
-      /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":120
- *                 elif t == NPY_LONG:        f = "l"
- *                 elif t == NPY_ULONG:       f = "L"
- *                 elif t == NPY_LONGLONG:    f = "q"             # <<<<<<<<<<<<<<
- *                 elif t == NPY_ULONGLONG:   f = "Q"
- *                 elif t == NPY_FLOAT:       f = "f"
- */
-      __pyx_v_f = __pyx_k_11;
-      break;
-      case NPY_ULONGLONG:
-
-      /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":121
- *                 elif t == NPY_ULONG:       f = "L"
- *                 elif t == NPY_LONGLONG:    f = "q"
- *                 elif t == NPY_ULONGLONG:   f = "Q"             # <<<<<<<<<<<<<<
- *                 elif t == NPY_FLOAT:       f = "f"
- *                 elif t == NPY_DOUBLE:      f = "d"
- */
-      __pyx_v_f = __pyx_k_12;
-      break;
-      case NPY_FLOAT:
-
-      /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":122
- *                 elif t == NPY_LONGLONG:    f = "q"
- *                 elif t == NPY_ULONGLONG:   f = "Q"
- *                 elif t == NPY_FLOAT:       f = "f"             # <<<<<<<<<<<<<<
- *                 elif t == NPY_DOUBLE:      f = "d"
- *                 elif t == NPY_LONGDOUBLE:  f = "g"
- */
-      __pyx_v_f = __pyx_k_13;
-      break;
-      case NPY_DOUBLE:
-
-      /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":123
- *                 elif t == NPY_ULONGLONG:   f = "Q"
- *                 elif t == NPY_FLOAT:       f = "f"
- *                 elif t == NPY_DOUBLE:      f = "d"             # <<<<<<<<<<<<<<
- *                 elif t == NPY_LONGDOUBLE:  f = "g"
- *                 elif t == NPY_CFLOAT:      f = "Zf"
- */
-      __pyx_v_f = __pyx_k_14;
-      break;
-      case NPY_LONGDOUBLE:
-
-      /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":124
- *                 elif t == NPY_FLOAT:       f = "f"
- *                 elif t == NPY_DOUBLE:      f = "d"
- *                 elif t == NPY_LONGDOUBLE:  f = "g"             # <<<<<<<<<<<<<<
- *                 elif t == NPY_CFLOAT:      f = "Zf"
- *                 elif t == NPY_CDOUBLE:     f = "Zd"
- */
-      __pyx_v_f = __pyx_k_15;
-      break;
-      case NPY_CFLOAT:
-
-      /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":125
- *                 elif t == NPY_DOUBLE:      f = "d"
- *                 elif t == NPY_LONGDOUBLE:  f = "g"
- *                 elif t == NPY_CFLOAT:      f = "Zf"             # <<<<<<<<<<<<<<
- *                 elif t == NPY_CDOUBLE:     f = "Zd"
- *                 elif t == NPY_CLONGDOUBLE: f = "Zg"
- */
-      __pyx_v_f = __pyx_k_16;
-      break;
-      case NPY_CDOUBLE:
-
-      /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":126
- *                 elif t == NPY_LONGDOUBLE:  f = "g"
- *                 elif t == NPY_CFLOAT:      f = "Zf"
- *                 elif t == NPY_CDOUBLE:     f = "Zd"             # <<<<<<<<<<<<<<
- *                 elif t == NPY_CLONGDOUBLE: f = "Zg"
- *                 elif t == NPY_OBJECT:      f = "O"
- */
-      __pyx_v_f = __pyx_k_17;
-      break;
-      case NPY_CLONGDOUBLE:
-
-      /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":127
- *                 elif t == NPY_CFLOAT:      f = "Zf"
- *                 elif t == NPY_CDOUBLE:     f = "Zd"
- *                 elif t == NPY_CLONGDOUBLE: f = "Zg"             # <<<<<<<<<<<<<<
- *                 elif t == NPY_OBJECT:      f = "O"
- *                 else:
- */
-      __pyx_v_f = __pyx_k_18;
-      break;
-      case NPY_OBJECT:
-
-      /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":128
- *                 elif t == NPY_CDOUBLE:     f = "Zd"
- *                 elif t == NPY_CLONGDOUBLE: f = "Zg"
- *                 elif t == NPY_OBJECT:      f = "O"             # <<<<<<<<<<<<<<
- *                 else:
- *                     raise ValueError("unknown dtype code in numpy.pxd (%d)" % t)
- */
-      __pyx_v_f = __pyx_k_19;
-      break;
-      default:
-
-      /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":130
- *                 elif t == NPY_OBJECT:      f = "O"
- *                 else:
- *                     raise ValueError("unknown dtype code in numpy.pxd (%d)" % t)             # <<<<<<<<<<<<<<
- *                 info.format = f
- *                 return
- */
-      __pyx_2 = PyInt_FromLong(__pyx_v_t); if (unlikely(!__pyx_2)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 130; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-      __pyx_t_1 = PyNumber_Remainder(__pyx_kp_20, __pyx_2); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 130; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-      Py_DECREF(__pyx_2); __pyx_2 = 0;
-      __pyx_3 = PyTuple_New(1); if (unlikely(!__pyx_3)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 130; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-      PyTuple_SET_ITEM(__pyx_3, 0, __pyx_t_1);
-      __pyx_t_1 = 0;
-      __pyx_2 = PyObject_Call(__pyx_builtin_ValueError, ((PyObject *)__pyx_3), NULL); if (unlikely(!__pyx_2)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 130; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-      Py_DECREF(((PyObject *)__pyx_3)); __pyx_3 = 0;
-      __Pyx_Raise(__pyx_2, 0, 0);
-      Py_DECREF(__pyx_2); __pyx_2 = 0;
-      {__pyx_filename = __pyx_f[1]; __pyx_lineno = 130; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-      break;
-    }
-
-    /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":131
- *                 else:
- *                     raise ValueError("unknown dtype code in numpy.pxd (%d)" % t)
- *                 info.format = f             # <<<<<<<<<<<<<<
- *                 return
- *             else:
- */
-    __pyx_v_info->format = __pyx_v_f;
-
-    /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":132
- *                     raise ValueError("unknown dtype code in numpy.pxd (%d)" % t)
- *                 info.format = f
- *                 return             # <<<<<<<<<<<<<<
- *             else:
- *                 info.format = <char*>stdlib.malloc(255) # static size
- */
-    __pyx_r = 0;
-    goto __pyx_L0;
-    goto __pyx_L12;
-  }
-  /*else*/ {
-
-    /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":134
- *                 return
- *             else:
- *                 info.format = <char*>stdlib.malloc(255) # static size             # <<<<<<<<<<<<<<
- *                 f = info.format
- *                 stack = [iter(descr.fields.iteritems())]
- */
-    __pyx_v_info->format = ((char *)malloc(255));
-
-    /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":135
- *             else:
- *                 info.format = <char*>stdlib.malloc(255) # static size
- *                 f = info.format             # <<<<<<<<<<<<<<
- *                 stack = [iter(descr.fields.iteritems())]
- * 
- */
-    __pyx_v_f = __pyx_v_info->format;
-
-    /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":136
- *                 info.format = <char*>stdlib.malloc(255) # static size
- *                 f = info.format
- *                 stack = [iter(descr.fields.iteritems())]             # <<<<<<<<<<<<<<
- * 
- *                 while True:
- */
-    __pyx_3 = PyObject_GetAttr(__pyx_v_descr->fields, __pyx_kp_iteritems); if (unlikely(!__pyx_3)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 136; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __pyx_2 = PyObject_Call(__pyx_3, ((PyObject *)__pyx_empty_tuple), NULL); if (unlikely(!__pyx_2)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 136; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_DECREF(__pyx_3); __pyx_3 = 0;
-    __pyx_3 = PyObject_GetIter(__pyx_2); if (unlikely(!__pyx_3)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 136; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_DECREF(__pyx_2); __pyx_2 = 0;
-    __pyx_2 = PyList_New(1); if (unlikely(!__pyx_2)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 136; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    PyList_SET_ITEM(__pyx_2, 0, __pyx_3);
-    __pyx_3 = 0;
-    Py_DECREF(((PyObject *)__pyx_v_stack));
-    __pyx_v_stack = __pyx_2;
-    __pyx_2 = 0;
-
-    /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":138
- *                 stack = [iter(descr.fields.iteritems())]
- * 
- *                 while True:             # <<<<<<<<<<<<<<
- *                     iterator = stack[-1]
- *                     descr = None
- */
-    while (1) {
-      __pyx_1 = 1;
-      if (!__pyx_1) break;
-
-      /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":139
- * 
- *                 while True:
- *                     iterator = stack[-1]             # <<<<<<<<<<<<<<
- *                     descr = None
- *                     while descr is None:
- */
-      __pyx_3 = __Pyx_GetItemInt(((PyObject *)__pyx_v_stack), -1, 0); if (!__pyx_3) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 139; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-      Py_DECREF(__pyx_v_iterator);
-      __pyx_v_iterator = __pyx_3;
-      __pyx_3 = 0;
-
-      /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":140
- *                 while True:
- *                     iterator = stack[-1]
- *                     descr = None             # <<<<<<<<<<<<<<
- *                     while descr is None:
- *                         try:
- */
-      Py_INCREF(Py_None);
-      Py_DECREF(((PyObject *)__pyx_v_descr));
-      __pyx_v_descr = ((PyArray_Descr *)Py_None);
-
-      /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":141
- *                     iterator = stack[-1]
- *                     descr = None
- *                     while descr is None:             # <<<<<<<<<<<<<<
- *                         try:
- *                             descr = iterator.next()[1][0]
- */
-      while (1) {
-        __pyx_1 = (((PyObject *)__pyx_v_descr) == Py_None);
-        if (!__pyx_1) break;
-
-        /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":142
- *                     descr = None
- *                     while descr is None:
- *                         try:             # <<<<<<<<<<<<<<
- *                             descr = iterator.next()[1][0]
- *                         except StopIteration:
- */
-        {
-          PyObject *__pyx_save_exc_type, *__pyx_save_exc_value, *__pyx_save_exc_tb;
-          __Pyx_ExceptionSave(&__pyx_save_exc_type, &__pyx_save_exc_value, &__pyx_save_exc_tb);
-          /*try:*/ {
-
-            /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":143
- *                     while descr is None:
- *                         try:
- *                             descr = iterator.next()[1][0]             # <<<<<<<<<<<<<<
- *                         except StopIteration:
- *                             stack.pop()
- */
-            __pyx_2 = PyObject_GetAttr(__pyx_v_iterator, __pyx_kp_next); if (unlikely(!__pyx_2)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 143; __pyx_clineno = __LINE__; goto __pyx_L17_error;}
-            __pyx_3 = PyObject_Call(__pyx_2, ((PyObject *)__pyx_empty_tuple), NULL); if (unlikely(!__pyx_3)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 143; __pyx_clineno = __LINE__; goto __pyx_L17_error;}
-            Py_DECREF(__pyx_2); __pyx_2 = 0;
-            __pyx_2 = __Pyx_GetItemInt(__pyx_3, 1, 0); if (!__pyx_2) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 143; __pyx_clineno = __LINE__; goto __pyx_L17_error;}
-            Py_DECREF(__pyx_3); __pyx_3 = 0;
-            __pyx_3 = __Pyx_GetItemInt(__pyx_2, 0, 0); if (!__pyx_3) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 143; __pyx_clineno = __LINE__; goto __pyx_L17_error;}
-            Py_DECREF(__pyx_2); __pyx_2 = 0;
-            if (!(__Pyx_TypeTest(__pyx_3, __pyx_ptype_5numpy_dtype))) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 143; __pyx_clineno = __LINE__; goto __pyx_L17_error;}
-            Py_DECREF(((PyObject *)__pyx_v_descr));
-            __pyx_v_descr = ((PyArray_Descr *)__pyx_3);
-            __pyx_3 = 0;
-          }
-          Py_XDECREF(__pyx_save_exc_type); __pyx_save_exc_type = 0;
-          Py_XDECREF(__pyx_save_exc_value); __pyx_save_exc_value = 0;
-          Py_XDECREF(__pyx_save_exc_tb); __pyx_save_exc_tb = 0;
-          goto __pyx_L22_try;
-          __pyx_L17_error:;
-          Py_XDECREF(__pyx_2); __pyx_2 = 0;
-          Py_XDECREF(__pyx_3); __pyx_3 = 0;
-
-          /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":144
- *                         try:
- *                             descr = iterator.next()[1][0]
- *                         except StopIteration:             # <<<<<<<<<<<<<<
- *                             stack.pop()
- *                             if len(stack) > 0:
- */
-          __pyx_4 = PyErr_ExceptionMatches(__pyx_builtin_StopIteration);
-          if (__pyx_4) {
-            __Pyx_AddTraceback("numpy.__getbuffer__");
-            if (__Pyx_GetException(&__pyx_2, &__pyx_3, &__pyx_5) < 0) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 144; __pyx_clineno = __LINE__; goto __pyx_L19_except_error;}
-
-            /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":145
- *                             descr = iterator.next()[1][0]
- *                         except StopIteration:
- *                             stack.pop()             # <<<<<<<<<<<<<<
- *                             if len(stack) > 0:
- *                                 f[0] = 125 #"}"
- */
-            __pyx_6 = PyObject_GetAttr(((PyObject *)__pyx_v_stack), __pyx_kp_pop); if (unlikely(!__pyx_6)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 145; __pyx_clineno = __LINE__; goto __pyx_L19_except_error;}
-            __pyx_7 = PyObject_Call(__pyx_6, ((PyObject *)__pyx_empty_tuple), NULL); if (unlikely(!__pyx_7)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 145; __pyx_clineno = __LINE__; goto __pyx_L19_except_error;}
-            Py_DECREF(__pyx_6); __pyx_6 = 0;
-            Py_DECREF(__pyx_7); __pyx_7 = 0;
-
-            /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":146
- *                         except StopIteration:
- *                             stack.pop()
- *                             if len(stack) > 0:             # <<<<<<<<<<<<<<
- *                                 f[0] = 125 #"}"
- *                                 f += 1
- */
-            __pyx_8 = PyObject_Length(((PyObject *)__pyx_v_stack)); if (unlikely(__pyx_8 == -1)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 146; __pyx_clineno = __LINE__; goto __pyx_L19_except_error;}
-            __pyx_1 = (__pyx_8 > 0);
-            if (__pyx_1) {
-
-              /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":147
- *                             stack.pop()
- *                             if len(stack) > 0:
- *                                 f[0] = 125 #"}"             # <<<<<<<<<<<<<<
- *                                 f += 1
- *                                 iterator = stack[-1]
- */
-              (__pyx_v_f[0]) = 125;
-
-              /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":148
- *                             if len(stack) > 0:
- *                                 f[0] = 125 #"}"
- *                                 f += 1             # <<<<<<<<<<<<<<
- *                                 iterator = stack[-1]
- *                             else:
- */
-              __pyx_v_f += 1;
-
-              /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":149
- *                                 f[0] = 125 #"}"
- *                                 f += 1
- *                                 iterator = stack[-1]             # <<<<<<<<<<<<<<
- *                             else:
- *                                 f[0] = 0 # Terminate string!
- */
-              __pyx_6 = __Pyx_GetItemInt(((PyObject *)__pyx_v_stack), -1, 0); if (!__pyx_6) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 149; __pyx_clineno = __LINE__; goto __pyx_L19_except_error;}
-              Py_DECREF(__pyx_v_iterator);
-              __pyx_v_iterator = __pyx_6;
-              __pyx_6 = 0;
-              goto __pyx_L23;
-            }
-            /*else*/ {
-
-              /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":151
- *                                 iterator = stack[-1]
- *                             else:
- *                                 f[0] = 0 # Terminate string!             # <<<<<<<<<<<<<<
- *                                 return
- * 
- */
-              (__pyx_v_f[0]) = 0;
-
-              /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":152
- *                             else:
- *                                 f[0] = 0 # Terminate string!
- *                                 return             # <<<<<<<<<<<<<<
- * 
- *                     hasfields = PyDataType_HASFIELDS(descr)
- */
-              __pyx_r = 0;
-              Py_DECREF(__pyx_2); __pyx_2 = 0;
-              Py_DECREF(__pyx_3); __pyx_3 = 0;
-              Py_DECREF(__pyx_5); __pyx_5 = 0;
-              goto __pyx_L20_except_return;
-            }
-            __pyx_L23:;
-            Py_DECREF(__pyx_2); __pyx_2 = 0;
-            Py_DECREF(__pyx_3); __pyx_3 = 0;
-            Py_DECREF(__pyx_5); __pyx_5 = 0;
-            goto __pyx_L18_exception_handled;
-          }
-          __pyx_L19_except_error:;
-          Py_XDECREF(__pyx_save_exc_type);
-          Py_XDECREF(__pyx_save_exc_value);
-          Py_XDECREF(__pyx_save_exc_tb);
-          goto __pyx_L1_error;
-          __pyx_L20_except_return:;
-          __Pyx_ExceptionReset(__pyx_save_exc_type, __pyx_save_exc_value, __pyx_save_exc_tb);
-          goto __pyx_L0;
-          __pyx_L18_exception_handled:;
-          __Pyx_ExceptionReset(__pyx_save_exc_type, __pyx_save_exc_value, __pyx_save_exc_tb);
-          __pyx_L22_try:;
-        }
-      }
-
-      /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":154
- *                                 return
- * 
- *                     hasfields = PyDataType_HASFIELDS(descr)             # <<<<<<<<<<<<<<
- *                     if not hasfields:
- *                         t = descr.type_num
- */
-      __pyx_v_hasfields = PyDataType_HASFIELDS(__pyx_v_descr);
-
-      /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":155
- * 
- *                     hasfields = PyDataType_HASFIELDS(descr)
- *                     if not hasfields:             # <<<<<<<<<<<<<<
- *                         t = descr.type_num
- *                         if f - info.format > 240: # this should leave room for "T{" and "}" as well
- */
-      __pyx_1 = (!__pyx_v_hasfields);
-      if (__pyx_1) {
-
-        /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":156
- *                     hasfields = PyDataType_HASFIELDS(descr)
- *                     if not hasfields:
- *                         t = descr.type_num             # <<<<<<<<<<<<<<
- *                         if f - info.format > 240: # this should leave room for "T{" and "}" as well
- *                             raise RuntimeError("Format string allocated too short.")
- */
-        __pyx_v_t = __pyx_v_descr->type_num;
-
-        /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":157
- *                     if not hasfields:
- *                         t = descr.type_num
- *                         if f - info.format > 240: # this should leave room for "T{" and "}" as well             # <<<<<<<<<<<<<<
- *                             raise RuntimeError("Format string allocated too short.")
- * 
- */
-        __pyx_1 = ((__pyx_v_f - __pyx_v_info->format) > 240);
-        if (__pyx_1) {
-
-          /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":158
- *                         t = descr.type_num
- *                         if f - info.format > 240: # this should leave room for "T{" and "}" as well
- *                             raise RuntimeError("Format string allocated too short.")             # <<<<<<<<<<<<<<
- * 
- *                         # Until ticket #99 is fixed, use integers to avoid warnings
- */
-          __pyx_7 = PyTuple_New(1); if (unlikely(!__pyx_7)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 158; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-          Py_INCREF(__pyx_kp_21);
-          PyTuple_SET_ITEM(__pyx_7, 0, __pyx_kp_21);
-          __pyx_6 = PyObject_Call(__pyx_builtin_RuntimeError, ((PyObject *)__pyx_7), NULL); if (unlikely(!__pyx_6)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 158; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-          Py_DECREF(((PyObject *)__pyx_7)); __pyx_7 = 0;
-          __Pyx_Raise(__pyx_6, 0, 0);
-          Py_DECREF(__pyx_6); __pyx_6 = 0;
-          {__pyx_filename = __pyx_f[1]; __pyx_lineno = 158; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-          goto __pyx_L25;
-        }
-        __pyx_L25:;
-
-        /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":161
- * 
- *                         # Until ticket #99 is fixed, use integers to avoid warnings
- *                         if   t == NPY_BYTE:        f[0] =  98 #"b"             # <<<<<<<<<<<<<<
- *                         elif t == NPY_UBYTE:       f[0] =  66 #"B"
- *                         elif t == NPY_SHORT:       f[0] = 104 #"h"
- */
-        switch (__pyx_v_t) {
-          case NPY_BYTE:
-          (__pyx_v_f[0]) = 98;
-          break;
-          case NPY_UBYTE:
-
-          /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":162
- *                         # Until ticket #99 is fixed, use integers to avoid warnings
- *                         if   t == NPY_BYTE:        f[0] =  98 #"b"
- *                         elif t == NPY_UBYTE:       f[0] =  66 #"B"             # <<<<<<<<<<<<<<
- *                         elif t == NPY_SHORT:       f[0] = 104 #"h"
- *                         elif t == NPY_USHORT:      f[0] =  72 #"H"
- */
-          (__pyx_v_f[0]) = 66;
-          break;
-          case NPY_SHORT:
-
-          /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":163
- *                         if   t == NPY_BYTE:        f[0] =  98 #"b"
- *                         elif t == NPY_UBYTE:       f[0] =  66 #"B"
- *                         elif t == NPY_SHORT:       f[0] = 104 #"h"             # <<<<<<<<<<<<<<
- *                         elif t == NPY_USHORT:      f[0] =  72 #"H"
- *                         elif t == NPY_INT:         f[0] = 105 #"i"
- */
-          (__pyx_v_f[0]) = 104;
-          break;
-          case NPY_USHORT:
-
-          /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":164
- *                         elif t == NPY_UBYTE:       f[0] =  66 #"B"
- *                         elif t == NPY_SHORT:       f[0] = 104 #"h"
- *                         elif t == NPY_USHORT:      f[0] =  72 #"H"             # <<<<<<<<<<<<<<
- *                         elif t == NPY_INT:         f[0] = 105 #"i"
- *                         elif t == NPY_UINT:        f[0] =  73 #"I"
- */
-          (__pyx_v_f[0]) = 72;
-          break;
-          case NPY_INT:
-
-          /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":165
- *                         elif t == NPY_SHORT:       f[0] = 104 #"h"
- *                         elif t == NPY_USHORT:      f[0] =  72 #"H"
- *                         elif t == NPY_INT:         f[0] = 105 #"i"             # <<<<<<<<<<<<<<
- *                         elif t == NPY_UINT:        f[0] =  73 #"I"
- *                         elif t == NPY_LONG:        f[0] = 108 #"l"
- */
-          (__pyx_v_f[0]) = 105;
-          break;
-          case NPY_UINT:
-
-          /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":166
- *                         elif t == NPY_USHORT:      f[0] =  72 #"H"
- *                         elif t == NPY_INT:         f[0] = 105 #"i"
- *                         elif t == NPY_UINT:        f[0] =  73 #"I"             # <<<<<<<<<<<<<<
- *                         elif t == NPY_LONG:        f[0] = 108 #"l"
- *                         elif t == NPY_ULONG:       f[0] = 76  #"L"
- */
-          (__pyx_v_f[0]) = 73;
-          break;
-          case NPY_LONG:
-
-          /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":167
- *                         elif t == NPY_INT:         f[0] = 105 #"i"
- *                         elif t == NPY_UINT:        f[0] =  73 #"I"
- *                         elif t == NPY_LONG:        f[0] = 108 #"l"             # <<<<<<<<<<<<<<
- *                         elif t == NPY_ULONG:       f[0] = 76  #"L"
- *                         elif t == NPY_LONGLONG:    f[0] = 113 #"q"
- */
-          (__pyx_v_f[0]) = 108;
-          break;
-          case NPY_ULONG:
-
-          /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":168
- *                         elif t == NPY_UINT:        f[0] =  73 #"I"
- *                         elif t == NPY_LONG:        f[0] = 108 #"l"
- *                         elif t == NPY_ULONG:       f[0] = 76  #"L"             # <<<<<<<<<<<<<<
- *                         elif t == NPY_LONGLONG:    f[0] = 113 #"q"
- *                         elif t == NPY_ULONGLONG:   f[0] = 81  #"Q"
- */
-          (__pyx_v_f[0]) = 76;
-          break;
-          case NPY_LONGLONG:
-
-          /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":169
- *                         elif t == NPY_LONG:        f[0] = 108 #"l"
- *                         elif t == NPY_ULONG:       f[0] = 76  #"L"
- *                         elif t == NPY_LONGLONG:    f[0] = 113 #"q"             # <<<<<<<<<<<<<<
- *                         elif t == NPY_ULONGLONG:   f[0] = 81  #"Q"
- *                         elif t == NPY_FLOAT:       f[0] = 102 #"f"
- */
-          (__pyx_v_f[0]) = 113;
-          break;
-          case NPY_ULONGLONG:
-
-          /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":170
- *                         elif t == NPY_ULONG:       f[0] = 76  #"L"
- *                         elif t == NPY_LONGLONG:    f[0] = 113 #"q"
- *                         elif t == NPY_ULONGLONG:   f[0] = 81  #"Q"             # <<<<<<<<<<<<<<
- *                         elif t == NPY_FLOAT:       f[0] = 102 #"f"
- *                         elif t == NPY_DOUBLE:      f[0] = 100 #"d"
- */
-          (__pyx_v_f[0]) = 81;
-          break;
-          case NPY_FLOAT:
-
-          /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":171
- *                         elif t == NPY_LONGLONG:    f[0] = 113 #"q"
- *                         elif t == NPY_ULONGLONG:   f[0] = 81  #"Q"
- *                         elif t == NPY_FLOAT:       f[0] = 102 #"f"             # <<<<<<<<<<<<<<
- *                         elif t == NPY_DOUBLE:      f[0] = 100 #"d"
- *                         elif t == NPY_LONGDOUBLE:  f[0] = 103 #"g"
- */
-          (__pyx_v_f[0]) = 102;
-          break;
-          case NPY_DOUBLE:
-
-          /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":172
- *                         elif t == NPY_ULONGLONG:   f[0] = 81  #"Q"
- *                         elif t == NPY_FLOAT:       f[0] = 102 #"f"
- *                         elif t == NPY_DOUBLE:      f[0] = 100 #"d"             # <<<<<<<<<<<<<<
- *                         elif t == NPY_LONGDOUBLE:  f[0] = 103 #"g"
- *                         elif t == NPY_CFLOAT:      f[0] = 90; f[1] = 102; f += 1
- */
-          (__pyx_v_f[0]) = 100;
-          break;
-          case NPY_LONGDOUBLE:
-
-          /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":173
- *                         elif t == NPY_FLOAT:       f[0] = 102 #"f"
- *                         elif t == NPY_DOUBLE:      f[0] = 100 #"d"
- *                         elif t == NPY_LONGDOUBLE:  f[0] = 103 #"g"             # <<<<<<<<<<<<<<
- *                         elif t == NPY_CFLOAT:      f[0] = 90; f[1] = 102; f += 1
- *                         elif t == NPY_CDOUBLE:     f[0] = 90; f[1] = 100; f += 1
- */
-          (__pyx_v_f[0]) = 103;
-          break;
-          case NPY_CFLOAT:
-
-          /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":174
- *                         elif t == NPY_DOUBLE:      f[0] = 100 #"d"
- *                         elif t == NPY_LONGDOUBLE:  f[0] = 103 #"g"
- *                         elif t == NPY_CFLOAT:      f[0] = 90; f[1] = 102; f += 1             # <<<<<<<<<<<<<<
- *                         elif t == NPY_CDOUBLE:     f[0] = 90; f[1] = 100; f += 1
- *                         elif t == NPY_CLONGDOUBLE: f[0] = 90; f[1] = 103; f += 1
- */
-          (__pyx_v_f[0]) = 90;
-          (__pyx_v_f[1]) = 102;
-          __pyx_v_f += 1;
-          break;
-          case NPY_CDOUBLE:
-
-          /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":175
- *                         elif t == NPY_LONGDOUBLE:  f[0] = 103 #"g"
- *                         elif t == NPY_CFLOAT:      f[0] = 90; f[1] = 102; f += 1
- *                         elif t == NPY_CDOUBLE:     f[0] = 90; f[1] = 100; f += 1             # <<<<<<<<<<<<<<
- *                         elif t == NPY_CLONGDOUBLE: f[0] = 90; f[1] = 103; f += 1
- *                         elif t == NPY_OBJECT:      f[0] = 79 #"O"
- */
-          (__pyx_v_f[0]) = 90;
-          (__pyx_v_f[1]) = 100;
-          __pyx_v_f += 1;
-          break;
-          case NPY_CLONGDOUBLE:
-
-          /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":176
- *                         elif t == NPY_CFLOAT:      f[0] = 90; f[1] = 102; f += 1
- *                         elif t == NPY_CDOUBLE:     f[0] = 90; f[1] = 100; f += 1
- *                         elif t == NPY_CLONGDOUBLE: f[0] = 90; f[1] = 103; f += 1             # <<<<<<<<<<<<<<
- *                         elif t == NPY_OBJECT:      f[0] = 79 #"O"
- *                         else:
- */
-          (__pyx_v_f[0]) = 90;
-          (__pyx_v_f[1]) = 103;
-          __pyx_v_f += 1;
-          break;
-          case NPY_OBJECT:
-
-          /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":177
- *                         elif t == NPY_CDOUBLE:     f[0] = 90; f[1] = 100; f += 1
- *                         elif t == NPY_CLONGDOUBLE: f[0] = 90; f[1] = 103; f += 1
- *                         elif t == NPY_OBJECT:      f[0] = 79 #"O"             # <<<<<<<<<<<<<<
- *                         else:
- *                             raise ValueError("unknown dtype code in numpy.pxd (%d)" % t)
- */
-          (__pyx_v_f[0]) = 79;
-          break;
-          default:
-
-          /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":179
- *                         elif t == NPY_OBJECT:      f[0] = 79 #"O"
- *                         else:
- *                             raise ValueError("unknown dtype code in numpy.pxd (%d)" % t)             # <<<<<<<<<<<<<<
- *                         f += 1
- *                     else:
- */
-          __pyx_2 = PyInt_FromLong(__pyx_v_t); if (unlikely(!__pyx_2)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 179; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-          __pyx_t_1 = PyNumber_Remainder(__pyx_kp_22, __pyx_2); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 179; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-          Py_DECREF(__pyx_2); __pyx_2 = 0;
-          __pyx_3 = PyTuple_New(1); if (unlikely(!__pyx_3)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 179; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-          PyTuple_SET_ITEM(__pyx_3, 0, __pyx_t_1);
-          __pyx_t_1 = 0;
-          __pyx_5 = PyObject_Call(__pyx_builtin_ValueError, ((PyObject *)__pyx_3), NULL); if (unlikely(!__pyx_5)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 179; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-          Py_DECREF(((PyObject *)__pyx_3)); __pyx_3 = 0;
-          __Pyx_Raise(__pyx_5, 0, 0);
-          Py_DECREF(__pyx_5); __pyx_5 = 0;
-          {__pyx_filename = __pyx_f[1]; __pyx_lineno = 179; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-          break;
-        }
-
-        /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":180
- *                         else:
- *                             raise ValueError("unknown dtype code in numpy.pxd (%d)" % t)
- *                         f += 1             # <<<<<<<<<<<<<<
- *                     else:
- *                         f[0] = 84 #"T"
- */
-        __pyx_v_f += 1;
-        goto __pyx_L24;
-      }
-      /*else*/ {
-
-        /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":182
- *                         f += 1
- *                     else:
- *                         f[0] = 84 #"T"             # <<<<<<<<<<<<<<
- *                         f[1] = 123 #"{"
- *                         f += 2
- */
-        (__pyx_v_f[0]) = 84;
-
-        /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":183
- *                     else:
- *                         f[0] = 84 #"T"
- *                         f[1] = 123 #"{"             # <<<<<<<<<<<<<<
- *                         f += 2
- *                         stack.append(iter(descr.fields.iteritems()))
- */
-        (__pyx_v_f[1]) = 123;
-
-        /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":184
- *                         f[0] = 84 #"T"
- *                         f[1] = 123 #"{"
- *                         f += 2             # <<<<<<<<<<<<<<
- *                         stack.append(iter(descr.fields.iteritems()))
- * 
- */
-        __pyx_v_f += 2;
-
-        /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":185
- *                         f[1] = 123 #"{"
- *                         f += 2
- *                         stack.append(iter(descr.fields.iteritems()))             # <<<<<<<<<<<<<<
- * 
- *         def __releasebuffer__(ndarray self, Py_buffer* info):
- */
-        __pyx_7 = PyObject_GetAttr(__pyx_v_descr->fields, __pyx_kp_iteritems); if (unlikely(!__pyx_7)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 185; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-        __pyx_6 = PyObject_Call(__pyx_7, ((PyObject *)__pyx_empty_tuple), NULL); if (unlikely(!__pyx_6)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 185; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-        Py_DECREF(__pyx_7); __pyx_7 = 0;
-        __pyx_2 = PyObject_GetIter(__pyx_6); if (unlikely(!__pyx_2)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 185; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-        Py_DECREF(__pyx_6); __pyx_6 = 0;
-        __pyx_4 = PyList_Append(((PyObject *)__pyx_v_stack), __pyx_2); if (unlikely(__pyx_4 == -1)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 185; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-        Py_DECREF(__pyx_2); __pyx_2 = 0;
-      }
-      __pyx_L24:;
-    }
-  }
-  __pyx_L12:;
-
-  __pyx_r = 0;
-  goto __pyx_L0;
-  __pyx_L1_error:;
-  Py_XDECREF(__pyx_2);
-  Py_XDECREF(__pyx_3);
-  Py_XDECREF(__pyx_5);
-  Py_XDECREF(__pyx_6);
-  Py_XDECREF(__pyx_7);
-  __Pyx_AddTraceback("numpy.ndarray.__getbuffer__");
-  __pyx_r = -1;
-  Py_DECREF(__pyx_v_info->obj); __pyx_v_info->obj = NULL;
-  goto __pyx_L2;
-  __pyx_L0:;
-  if (__pyx_v_info->obj == Py_None) { Py_DECREF(Py_None); __pyx_v_info->obj = NULL; }
-  __pyx_L2:;
-  Py_XDECREF(__pyx_v_descr);
-  Py_DECREF(__pyx_v_stack);
-  Py_DECREF(__pyx_v_iterator);
-  return __pyx_r;
-}
-
-/* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":187
- *                         stack.append(iter(descr.fields.iteritems()))
- * 
- *         def __releasebuffer__(ndarray self, Py_buffer* info):             # <<<<<<<<<<<<<<
- *             if PyArray_HASFIELDS(self):
- *                 stdlib.free(info.format)
- */
-
-static void __pyx_pf_5numpy_7ndarray___releasebuffer__(PyObject *__pyx_v_self, Py_buffer *__pyx_v_info); /*proto*/
-static void __pyx_pf_5numpy_7ndarray___releasebuffer__(PyObject *__pyx_v_self, Py_buffer *__pyx_v_info) {
-  int __pyx_1;
-  int __pyx_2;
-
-  /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":188
- * 
- *         def __releasebuffer__(ndarray self, Py_buffer* info):
- *             if PyArray_HASFIELDS(self):             # <<<<<<<<<<<<<<
- *                 stdlib.free(info.format)
- *             if sizeof(npy_intp) != sizeof(Py_ssize_t):
- */
-  __pyx_1 = PyArray_HASFIELDS(((PyArrayObject *)__pyx_v_self));
-  if (__pyx_1) {
-
-    /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":189
- *         def __releasebuffer__(ndarray self, Py_buffer* info):
- *             if PyArray_HASFIELDS(self):
- *                 stdlib.free(info.format)             # <<<<<<<<<<<<<<
- *             if sizeof(npy_intp) != sizeof(Py_ssize_t):
- *                 stdlib.free(info.strides)
- */
-    free(__pyx_v_info->format);
-    goto __pyx_L5;
-  }
-  __pyx_L5:;
-
-  /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":190
- *             if PyArray_HASFIELDS(self):
- *                 stdlib.free(info.format)
- *             if sizeof(npy_intp) != sizeof(Py_ssize_t):             # <<<<<<<<<<<<<<
- *                 stdlib.free(info.strides)
- *                 # info.shape was stored after info.strides in the same block
- */
-  __pyx_2 = ((sizeof(npy_intp)) != (sizeof(Py_ssize_t)));
-  if (__pyx_2) {
-
-    /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":191
- *                 stdlib.free(info.format)
- *             if sizeof(npy_intp) != sizeof(Py_ssize_t):
- *                 stdlib.free(info.strides)             # <<<<<<<<<<<<<<
- *                 # info.shape was stored after info.strides in the same block
- * 
- */
-    free(__pyx_v_info->strides);
-    goto __pyx_L6;
-  }
-  __pyx_L6:;
-
-}
-
-static struct PyMethodDef __pyx_methods[] = {
-  {"add_lines", (PyCFunction)__pyx_pf_4fff2_5group_8routines_add_lines, METH_VARARGS|METH_KEYWORDS, __pyx_doc_4fff2_5group_8routines_add_lines},
-  {0, 0, 0, 0}
-};
-
-static void __pyx_init_filenames(void); /*proto*/
-
-#if PY_MAJOR_VERSION >= 3
-static struct PyModuleDef __pyx_moduledef = {
-    PyModuleDef_HEAD_INIT,
-    "routines",
-    __pyx_mdoc, /* m_doc */
-    -1, /* m_size */
-    __pyx_methods /* m_methods */,
-    NULL, /* m_reload */
-    NULL, /* m_traverse */
-    NULL, /* m_clear */
-    NULL /* m_free */
-};
-#endif
-
-static __Pyx_StringTabEntry __pyx_string_tab[] = {
-  {&__pyx_kp_A, __pyx_k_A, sizeof(__pyx_k_A), 1, 1, 1},
-  {&__pyx_kp_B, __pyx_k_B, sizeof(__pyx_k_B), 1, 1, 1},
-  {&__pyx_kp_I, __pyx_k_I, sizeof(__pyx_k_I), 1, 1, 1},
-  {&__pyx_kp___version__, __pyx_k___version__, sizeof(__pyx_k___version__), 1, 1, 1},
-  {&__pyx_kp_numpy, __pyx_k_numpy, sizeof(__pyx_k_numpy), 1, 1, 1},
-  {&__pyx_kp_np, __pyx_k_np, sizeof(__pyx_k_np), 0, 1, 1},
-  {&__pyx_kp_23, __pyx_k_23, sizeof(__pyx_k_23), 0, 0, 0},
-  {&__pyx_kp___getbuffer__, __pyx_k___getbuffer__, sizeof(__pyx_k___getbuffer__), 1, 1, 1},
-  {&__pyx_kp___releasebuffer__, __pyx_k___releasebuffer__, sizeof(__pyx_k___releasebuffer__), 1, 1, 1},
-  {&__pyx_kp_info, __pyx_k_info, sizeof(__pyx_k_info), 1, 1, 1},
-  {&__pyx_kp_flags, __pyx_k_flags, sizeof(__pyx_k_flags), 1, 1, 1},
-  {&__pyx_kp_ValueError, __pyx_k_ValueError, sizeof(__pyx_k_ValueError), 1, 1, 1},
-  {&__pyx_kp_iteritems, __pyx_k_iteritems, sizeof(__pyx_k_iteritems), 1, 1, 1},
-  {&__pyx_kp_next, __pyx_k_next, sizeof(__pyx_k_next), 1, 1, 1},
-  {&__pyx_kp_StopIteration, __pyx_k_StopIteration, sizeof(__pyx_k_StopIteration), 1, 1, 1},
-  {&__pyx_kp_pop, __pyx_k_pop, sizeof(__pyx_k_pop), 1, 1, 1},
-  {&__pyx_kp_RuntimeError, __pyx_k_RuntimeError, sizeof(__pyx_k_RuntimeError), 1, 1, 1},
-  {&__pyx_kp_1, __pyx_k_1, sizeof(__pyx_k_1), 0, 0, 0},
-  {&__pyx_kp_2, __pyx_k_2, sizeof(__pyx_k_2), 0, 0, 0},
-  {&__pyx_kp_20, __pyx_k_20, sizeof(__pyx_k_20), 0, 0, 0},
-  {&__pyx_kp_21, __pyx_k_21, sizeof(__pyx_k_21), 0, 0, 0},
-  {&__pyx_kp_22, __pyx_k_22, sizeof(__pyx_k_22), 0, 0, 0},
-  {0, 0, 0, 0, 0, 0}
-};
-static int __Pyx_InitCachedBuiltins(void) {
-  __pyx_builtin_ValueError = __Pyx_GetName(__pyx_b, __pyx_kp_ValueError); if (!__pyx_builtin_ValueError) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 65; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __pyx_builtin_StopIteration = __Pyx_GetName(__pyx_b, __pyx_kp_StopIteration); if (!__pyx_builtin_StopIteration) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 144; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __pyx_builtin_RuntimeError = __Pyx_GetName(__pyx_b, __pyx_kp_RuntimeError); if (!__pyx_builtin_RuntimeError) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 158; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  return 0;
-  __pyx_L1_error:;
-  return -1;
-}
-
-static int __Pyx_InitGlobals(void) {
-  if (__Pyx_InitStrings(__pyx_string_tab) < 0) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 1; __pyx_clineno = __LINE__; goto __pyx_L1_error;};
-  return 0;
-  __pyx_L1_error:;
-  return -1;
-}
-
-#if PY_MAJOR_VERSION < 3
-PyMODINIT_FUNC initroutines(void); /*proto*/
-PyMODINIT_FUNC initroutines(void)
-#else
-PyMODINIT_FUNC PyInit_routines(void); /*proto*/
-PyMODINIT_FUNC PyInit_routines(void)
-#endif
-{
-  PyObject *__pyx_1 = 0;
-  __pyx_empty_tuple = PyTuple_New(0); if (unlikely(!__pyx_empty_tuple)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 1; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  /*--- Library function declarations ---*/
-  __pyx_init_filenames();
-  /*--- Initialize various global constants etc. ---*/
-  if (unlikely(__Pyx_InitGlobals() < 0)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 1; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  /*--- Module creation code ---*/
-  #if PY_MAJOR_VERSION < 3
-  __pyx_m = Py_InitModule4("routines", __pyx_methods, __pyx_mdoc, 0, PYTHON_API_VERSION);
-  #else
-  __pyx_m = PyModule_Create(&__pyx_moduledef);
-  #endif
-  if (!__pyx_m) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 1; __pyx_clineno = __LINE__; goto __pyx_L1_error;};
-  #if PY_MAJOR_VERSION < 3
-  Py_INCREF(__pyx_m);
-  #endif
-  __pyx_b = PyImport_AddModule(__Pyx_BUILTIN_MODULE_NAME);
-  if (!__pyx_b) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 1; __pyx_clineno = __LINE__; goto __pyx_L1_error;};
-  if (PyObject_SetAttrString(__pyx_m, "__builtins__", __pyx_b) < 0) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 1; __pyx_clineno = __LINE__; goto __pyx_L1_error;};
-  /*--- Builtin init code ---*/
-  if (unlikely(__Pyx_InitCachedBuiltins() < 0)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 1; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __pyx_skip_dispatch = 0;
-  /*--- Global init code ---*/
-  /*--- Function export code ---*/
-  /*--- Type init code ---*/
-  /*--- Type import code ---*/
-  __pyx_ptype_5numpy_dtype = __Pyx_ImportType("numpy", "dtype", sizeof(PyArray_Descr)); if (unlikely(!__pyx_ptype_5numpy_dtype)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 30; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __pyx_ptype_5numpy_ndarray = __Pyx_ImportType("numpy", "ndarray", sizeof(PyArrayObject)); if (unlikely(!__pyx_ptype_5numpy_ndarray)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 36; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  /*--- Function import code ---*/
-  /*--- Execution code ---*/
-
-  /* "d:\home\ar203069\bzr\nipy\fff2\fff2\group\routines.pyx":9
- * """
- * 
- * __version__ = '0.1'             # <<<<<<<<<<<<<<
- * 
- * import numpy as np
- */
-  if (PyObject_SetAttr(__pyx_m, __pyx_kp___version__, __pyx_kp_23) < 0) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 9; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-
-  /* "d:\home\ar203069\bzr\nipy\fff2\fff2\group\routines.pyx":11
- * __version__ = '0.1'
- * 
- * import numpy as np             # <<<<<<<<<<<<<<
- * cimport numpy as np
- * 
- */
-  __pyx_1 = __Pyx_Import(__pyx_kp_numpy, 0); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 11; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  if (PyObject_SetAttr(__pyx_m, __pyx_kp_np, __pyx_1) < 0) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 11; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_DECREF(__pyx_1); __pyx_1 = 0;
-
-  /* "c:\Python25\lib\site-packages\Cython\Includes\stdlib.pxd":2
- * 
- * cdef extern from "stdlib.h":             # <<<<<<<<<<<<<<
- *     ctypedef unsigned long size_t
- *     void free(void *ptr)
- */
-  #if PY_MAJOR_VERSION < 3
-  return;
-  #else
-  return __pyx_m;
-  #endif
-  __pyx_L1_error:;
-  Py_XDECREF(__pyx_1);
-  __Pyx_AddTraceback("fff2.group.routines");
-  #if PY_MAJOR_VERSION >= 3
-  return NULL;
-  #endif
-}
-
-static const char *__pyx_filenames[] = {
-  "routines.pyx",
-  "numpy.pxd",
-};
-
-/* Runtime support code */
-
-static void __pyx_init_filenames(void) {
-  __pyx_f = __pyx_filenames;
-}
-
-static void __Pyx_RaiseDoubleKeywordsError(
-    const char* func_name,
-    PyObject* kw_name)
-{
-    PyErr_Format(PyExc_TypeError,
-        #if PY_MAJOR_VERSION >= 3
-        "%s() got multiple values for keyword argument '%U'", func_name, kw_name);
-        #else
-        "%s() got multiple values for keyword argument '%s'", func_name,
-        PyString_AS_STRING(kw_name));
-        #endif
-}
-
-static void __Pyx_RaiseArgtupleInvalid(
-    const char* func_name,
-    int exact,
-    Py_ssize_t num_min,
-    Py_ssize_t num_max,
-    Py_ssize_t num_found)
-{
-    Py_ssize_t num_expected;
-    const char *number, *more_or_less;
-
-    if (num_found < num_min) {
-        num_expected = num_min;
-        more_or_less = "at least";
-    } else {
-        num_expected = num_max;
-        more_or_less = "at most";
-    }
-    if (exact) {
-        more_or_less = "exactly";
-    }
-    number = (num_expected == 1) ? "" : "s";
-    PyErr_Format(PyExc_TypeError,
-        #if PY_VERSION_HEX < 0x02050000
-            "%s() takes %s %d positional argument%s (%d given)",
-        #else
-            "%s() takes %s %zd positional argument%s (%zd given)",
-        #endif
-        func_name, more_or_less, num_expected, number, num_found);
-}
-
-static int __Pyx_ParseOptionalKeywords(
-    PyObject *kwds,
-    PyObject **argnames[],
-    PyObject *kwds2,
-    PyObject *values[],
-    Py_ssize_t num_pos_args,
-    const char* function_name)
-{
-    PyObject *key = 0, *value = 0;
-    Py_ssize_t pos = 0;
-    PyObject*** name;
-    PyObject*** first_kw_arg = argnames + num_pos_args;
-
-    while (PyDict_Next(kwds, &pos, &key, &value)) {
-        #if PY_MAJOR_VERSION < 3
-        if (unlikely(!PyString_CheckExact(key)) && unlikely(!PyString_Check(key))) {
-        #else
-        if (unlikely(!PyUnicode_CheckExact(key)) && unlikely(!PyUnicode_Check(key))) {
-        #endif
-            goto invalid_keyword_type;
-        } else {
-            name = argnames;
-            while (*name && (**name != key)) name++;
-            if (*name) {
-                if (name < first_kw_arg) goto arg_passed_twice;
-                values[name-argnames] = value;
-            } else {
-                for (name = first_kw_arg; *name; name++) {
-                    #if PY_MAJOR_VERSION >= 3
-                    if (PyUnicode_GET_SIZE(**name) == PyUnicode_GET_SIZE(key) &&
-                        PyUnicode_Compare(**name, key) == 0) break;
-                    #else
-                    if (PyString_GET_SIZE(**name) == PyString_GET_SIZE(key) &&
-                        strcmp(PyString_AS_STRING(**name),
-                               PyString_AS_STRING(key)) == 0) break;
-                    #endif
-                }
-                if (*name) {
-                    values[name-argnames] = value;
-                } else {
-                    /* unexpected keyword found */
-                    for (name=argnames; name != first_kw_arg; name++) {
-                        if (**name == key) goto arg_passed_twice;
-                        #if PY_MAJOR_VERSION >= 3
-                        if (PyUnicode_GET_SIZE(**name) == PyUnicode_GET_SIZE(key) &&
-                            PyUnicode_Compare(**name, key) == 0) goto arg_passed_twice;
-                        #else
-                        if (PyString_GET_SIZE(**name) == PyString_GET_SIZE(key) &&
-                            strcmp(PyString_AS_STRING(**name),
-                                   PyString_AS_STRING(key)) == 0) goto arg_passed_twice;
-                        #endif
-                    }
-                    if (kwds2) {
-                        if (unlikely(PyDict_SetItem(kwds2, key, value))) goto bad;
-                    } else {
-                        goto invalid_keyword;
-                    }
-                }
-            }
-        }
-    }
-    return 0;
-arg_passed_twice:
-    __Pyx_RaiseDoubleKeywordsError(function_name, **name);
-    goto bad;
-invalid_keyword_type:
-    PyErr_Format(PyExc_TypeError,
-        "%s() keywords must be strings", function_name);
-    goto bad;
-invalid_keyword:
-    PyErr_Format(PyExc_TypeError,
-    #if PY_MAJOR_VERSION < 3
-        "%s() got an unexpected keyword argument '%s'",
-        function_name, PyString_AsString(key));
-    #else
-        "%s() got an unexpected keyword argument '%U'",
-        function_name, key);
-    #endif
-bad:
-    return -1;
-}
-
-static INLINE void __Pyx_SafeReleaseBuffer(Py_buffer* info) {
-  if (info->buf == NULL) return;
-  if (info->suboffsets == __Pyx_minusones) info->suboffsets = NULL;
-  __Pyx_ReleaseBuffer(info);
-}
-
-static INLINE void __Pyx_ZeroBuffer(Py_buffer* buf) {
-  buf->buf = NULL;
-  buf->obj = NULL;
-  buf->strides = __Pyx_zeros;
-  buf->shape = __Pyx_zeros;
-  buf->suboffsets = __Pyx_minusones;
-}
-
-static INLINE const char* __Pyx_ConsumeWhitespace(const char* ts) {
-  while (1) {
-    switch (*ts) {
-      case '@':
-      case 10:
-      case 13:
-      case ' ':
-        ++ts;
-        break;
-      case '=':
-      case '<':
-      case '>':
-      case '!':
-        PyErr_SetString(PyExc_ValueError, "Buffer acquisition error: Only native byte order, size and alignment supported.");
-        return NULL;               
-      default:
-        return ts;
-    }
-  }
-}
-
-static void __Pyx_BufferNdimError(Py_buffer* buffer, int expected_ndim) {
-  PyErr_Format(PyExc_ValueError,
-               "Buffer has wrong number of dimensions (expected %d, got %d)",
-               expected_ndim, buffer->ndim);
-}
-
-static const char* __Pyx_DescribeTokenInFormatString(const char* ts) {
-  switch (*ts) {
-    case 'b': return "char";
-    case 'B': return "unsigned char";
-    case 'h': return "short";
-    case 'H': return "unsigned short";
-    case 'i': return "int";
-    case 'I': return "unsigned int";
-    case 'l': return "long";
-    case 'L': return "unsigned long";
-    case 'q': return "long long";
-    case 'Q': return "unsigned long long";
-    case 'f': return "float";
-    case 'd': return "double";
-    case 'g': return "long double";
-    case 'Z': switch (*(ts+1)) {
-        case 'f': return "complex float";
-        case 'd': return "complex double";
-        case 'g': return "complex long double";
-        default: return "unparseable format string";
-    }
-    case 'T': return "a struct";
-    case 'O': return "Python object";
-    case 'P': return "a pointer";
-    default: return "unparseable format string";
-  }
-}
-
-static const char* __Pyx_CheckTypestring_nn___pyx_t_5numpy_float_t(const char* ts) {
-    int ok;
-    ts = __Pyx_ConsumeWhitespace(ts); if (!ts) return NULL;
-    if (*ts == '1') ++ts;
-    switch (*ts) {
-      case 'f': ok = (sizeof(__pyx_t_5numpy_float_t) == sizeof(float) && (__pyx_t_5numpy_float_t)-1 < 0); break;
-      case 'd': ok = (sizeof(__pyx_t_5numpy_float_t) == sizeof(double) && (__pyx_t_5numpy_float_t)-1 < 0); break;
-      case 'g': ok = (sizeof(__pyx_t_5numpy_float_t) == sizeof(long double) && (__pyx_t_5numpy_float_t)-1 < 0); break;
-      default: ok = 0;
-    }
-    if (!(ok)) {
-      PyErr_Format(PyExc_ValueError, "Buffer dtype mismatch (expected numpy.float_t, got %s)", __Pyx_DescribeTokenInFormatString(ts));
-      return NULL;
-    }
-    ++ts;
-    return ts;
-  }
-  
-static int __Pyx_GetBuffer_nn___pyx_t_5numpy_float_t(PyObject* obj, Py_buffer* buf, int flags, int nd, int cast) {
-  const char* ts;
-  if (obj == Py_None) {
-    __Pyx_ZeroBuffer(buf);
-    return 0;
-  }
-  buf->buf = NULL;
-  if (__Pyx_GetBuffer(obj, buf, flags) == -1) goto fail;
-  if (buf->ndim != nd) {
-    __Pyx_BufferNdimError(buf, nd);
-    goto fail;
-  }
-  if (!cast) {
-    ts = buf->format;
-    ts = __Pyx_ConsumeWhitespace(ts);
-    if (!ts) goto fail;
-    ts = __Pyx_CheckTypestring_nn___pyx_t_5numpy_float_t(ts);
-    if (!ts) goto fail;
-    ts = __Pyx_ConsumeWhitespace(ts);
-    if (!ts) goto fail;
-    if (*ts != 0) {
-      PyErr_Format(PyExc_ValueError,
-        "Buffer dtype mismatch (expected end, got %s)",
-        __Pyx_DescribeTokenInFormatString(ts));
-      goto fail;
-    }
-  } else {
-    if (buf->itemsize != sizeof(__pyx_t_5numpy_float_t)) {
-      PyErr_SetString(PyExc_ValueError,
-        "Attempted cast of buffer to datatype of different size.");
-      goto fail;
-    }
-  }
-  if (buf->suboffsets == NULL) buf->suboffsets = __Pyx_minusones;
-  return 0;
-fail:;
-  __Pyx_ZeroBuffer(buf);
-  return -1;
-}static const char* __Pyx_CheckTypestring_nn___pyx_t_5numpy_int_t(const char* ts) {
-    int ok;
-    ts = __Pyx_ConsumeWhitespace(ts); if (!ts) return NULL;
-    if (*ts == '1') ++ts;
-    switch (*ts) {
-      case 'b': ok = (sizeof(__pyx_t_5numpy_int_t) == sizeof(char) && (__pyx_t_5numpy_int_t)-1 < 0); break;
-      case 'h': ok = (sizeof(__pyx_t_5numpy_int_t) == sizeof(short) && (__pyx_t_5numpy_int_t)-1 < 0); break;
-      case 'i': ok = (sizeof(__pyx_t_5numpy_int_t) == sizeof(int) && (__pyx_t_5numpy_int_t)-1 < 0); break;
-      case 'l': ok = (sizeof(__pyx_t_5numpy_int_t) == sizeof(long) && (__pyx_t_5numpy_int_t)-1 < 0); break;
-      case 'q': ok = (sizeof(__pyx_t_5numpy_int_t) == sizeof(long long) && (__pyx_t_5numpy_int_t)-1 < 0); break;
-      default: ok = 0;
-    }
-    if (!(ok)) {
-      PyErr_Format(PyExc_ValueError, "Buffer dtype mismatch (expected numpy.int_t, got %s)", __Pyx_DescribeTokenInFormatString(ts));
-      return NULL;
-    }
-    ++ts;
-    return ts;
-  }
-  
-static int __Pyx_GetBuffer_nn___pyx_t_5numpy_int_t(PyObject* obj, Py_buffer* buf, int flags, int nd, int cast) {
-  const char* ts;
-  if (obj == Py_None) {
-    __Pyx_ZeroBuffer(buf);
-    return 0;
-  }
-  buf->buf = NULL;
-  if (__Pyx_GetBuffer(obj, buf, flags) == -1) goto fail;
-  if (buf->ndim != nd) {
-    __Pyx_BufferNdimError(buf, nd);
-    goto fail;
-  }
-  if (!cast) {
-    ts = buf->format;
-    ts = __Pyx_ConsumeWhitespace(ts);
-    if (!ts) goto fail;
-    ts = __Pyx_CheckTypestring_nn___pyx_t_5numpy_int_t(ts);
-    if (!ts) goto fail;
-    ts = __Pyx_ConsumeWhitespace(ts);
-    if (!ts) goto fail;
-    if (*ts != 0) {
-      PyErr_Format(PyExc_ValueError,
-        "Buffer dtype mismatch (expected end, got %s)",
-        __Pyx_DescribeTokenInFormatString(ts));
-      goto fail;
-    }
-  } else {
-    if (buf->itemsize != sizeof(__pyx_t_5numpy_int_t)) {
-      PyErr_SetString(PyExc_ValueError,
-        "Attempted cast of buffer to datatype of different size.");
-      goto fail;
-    }
-  }
-  if (buf->suboffsets == NULL) buf->suboffsets = __Pyx_minusones;
-  return 0;
-fail:;
-  __Pyx_ZeroBuffer(buf);
-  return -1;
-}
-static INLINE void __Pyx_ErrRestore(PyObject *type, PyObject *value, PyObject *tb) {
-    PyObject *tmp_type, *tmp_value, *tmp_tb;
-    PyThreadState *tstate = PyThreadState_GET();
-
-    tmp_type = tstate->curexc_type;
-    tmp_value = tstate->curexc_value;
-    tmp_tb = tstate->curexc_traceback;
-    tstate->curexc_type = type;
-    tstate->curexc_value = value;
-    tstate->curexc_traceback = tb;
-    Py_XDECREF(tmp_type);
-    Py_XDECREF(tmp_value);
-    Py_XDECREF(tmp_tb);
-}
-
-static INLINE void __Pyx_ErrFetch(PyObject **type, PyObject **value, PyObject **tb) {
-    PyThreadState *tstate = PyThreadState_GET();
-    *type = tstate->curexc_type;
-    *value = tstate->curexc_value;
-    *tb = tstate->curexc_traceback;
-
-    tstate->curexc_type = 0;
-    tstate->curexc_value = 0;
-    tstate->curexc_traceback = 0;
-}
-
-
-
-static int __Pyx_ArgTypeTest(PyObject *obj, PyTypeObject *type, int none_allowed,
-    const char *name, int exact)
-{
-    if (!type) {
-        PyErr_Format(PyExc_SystemError, "Missing type object");
-        return 0;
-    }
-    if (none_allowed && obj == Py_None) return 1;
-    else if (exact) {
-        if (Py_TYPE(obj) == type) return 1;
-    }
-    else {
-        if (PyObject_TypeCheck(obj, type)) return 1;
-    }
-    PyErr_Format(PyExc_TypeError,
-        "Argument '%s' has incorrect type (expected %s, got %s)",
-        name, type->tp_name, Py_TYPE(obj)->tp_name);
-    return 0;
-}
-
-#if PY_MAJOR_VERSION < 3
-static int __Pyx_GetBuffer(PyObject *obj, Py_buffer *view, int flags) {
-  #if PY_VERSION_HEX >= 0x02060000
-  if (Py_TYPE(obj)->tp_flags & Py_TPFLAGS_HAVE_NEWBUFFER)
-      return PyObject_GetBuffer(obj, view, flags);
-  #endif
-  if (PyObject_TypeCheck(obj, __pyx_ptype_5numpy_ndarray)) return __pyx_pf_5numpy_7ndarray___getbuffer__(obj, view, flags);
-  else {
-  PyErr_Format(PyExc_TypeError, "'%100s' does not have the buffer interface", Py_TYPE(obj)->tp_name);
-  return -1;
-    }
-}
-
-static void __Pyx_ReleaseBuffer(Py_buffer *view) {
-  PyObject* obj = view->obj;
-  if (obj) {
-if (PyObject_TypeCheck(obj, __pyx_ptype_5numpy_ndarray)) __pyx_pf_5numpy_7ndarray___releasebuffer__(obj, view);
-    Py_DECREF(obj);
-    view->obj = NULL;
-  }
-}
-
-#endif
-
-static PyObject *__Pyx_Import(PyObject *name, PyObject *from_list) {
-    PyObject *__import__ = 0;
-    PyObject *empty_list = 0;
-    PyObject *module = 0;
-    PyObject *global_dict = 0;
-    PyObject *empty_dict = 0;
-    PyObject *list;
-    __import__ = PyObject_GetAttrString(__pyx_b, "__import__");
-    if (!__import__)
-        goto bad;
-    if (from_list)
-        list = from_list;
-    else {
-        empty_list = PyList_New(0);
-        if (!empty_list)
-            goto bad;
-        list = empty_list;
-    }
-    global_dict = PyModule_GetDict(__pyx_m);
-    if (!global_dict)
-        goto bad;
-    empty_dict = PyDict_New();
-    if (!empty_dict)
-        goto bad;
-    module = PyObject_CallFunction(__import__, "OOOO",
-        name, global_dict, empty_dict, list);
-bad:
-    Py_XDECREF(empty_list);
-    Py_XDECREF(__import__);
-    Py_XDECREF(empty_dict);
-    return module;
-}
-
-static INLINE void __Pyx_ExceptionSave(PyObject **type, PyObject **value, PyObject **tb) {
-    PyThreadState *tstate = PyThreadState_GET();
-    *type = tstate->exc_type;
-    *value = tstate->exc_value;
-    *tb = tstate->exc_traceback;
-    Py_XINCREF(*type);
-    Py_XINCREF(*value);
-    Py_XINCREF(*tb);
-}
-
-static void __Pyx_ExceptionReset(PyObject *type, PyObject *value, PyObject *tb) {
-    PyObject *tmp_type, *tmp_value, *tmp_tb;
-    PyThreadState *tstate = PyThreadState_GET();
-    tmp_type = tstate->exc_type;
-    tmp_value = tstate->exc_value;
-    tmp_tb = tstate->exc_traceback;
-    tstate->exc_type = type;
-    tstate->exc_value = value;
-    tstate->exc_traceback = tb;
-    Py_XDECREF(tmp_type);
-    Py_XDECREF(tmp_value);
-    Py_XDECREF(tmp_tb);
-}
-
-static PyObject *__Pyx_GetName(PyObject *dict, PyObject *name) {
-    PyObject *result;
-    result = PyObject_GetAttr(dict, name);
-    if (!result)
-        PyErr_SetObject(PyExc_NameError, name);
-    return result;
-}
-
-static void __Pyx_Raise(PyObject *type, PyObject *value, PyObject *tb) {
-    Py_XINCREF(type);
-    Py_XINCREF(value);
-    Py_XINCREF(tb);
-    /* First, check the traceback argument, replacing None with NULL. */
-    if (tb == Py_None) {
-        Py_DECREF(tb);
-        tb = 0;
-    }
-    else if (tb != NULL && !PyTraceBack_Check(tb)) {
-        PyErr_SetString(PyExc_TypeError,
-            "raise: arg 3 must be a traceback or None");
-        goto raise_error;
-    }
-    /* Next, replace a missing value with None */
-    if (value == NULL) {
-        value = Py_None;
-        Py_INCREF(value);
-    }
-    #if PY_VERSION_HEX < 0x02050000
-    if (!PyClass_Check(type))
-    #else
-    if (!PyType_Check(type))
-    #endif
-    {
-        /* Raising an instance.  The value should be a dummy. */
-        if (value != Py_None) {
-            PyErr_SetString(PyExc_TypeError,
-                "instance exception may not have a separate value");
-            goto raise_error;
-        }
-        /* Normalize to raise <class>, <instance> */
-        Py_DECREF(value);
-        value = type;
-        #if PY_VERSION_HEX < 0x02050000
-            if (PyInstance_Check(type)) {
-                type = (PyObject*) ((PyInstanceObject*)type)->in_class;
-                Py_INCREF(type);
-            }
-            else {
-                type = 0;
-                PyErr_SetString(PyExc_TypeError,
-                    "raise: exception must be an old-style class or instance");
-                goto raise_error;
-            }
-        #else
-            type = (PyObject*) Py_TYPE(type);
-            Py_INCREF(type);
-            if (!PyType_IsSubtype((PyTypeObject *)type, (PyTypeObject *)PyExc_BaseException)) {
-                PyErr_SetString(PyExc_TypeError,
-                    "raise: exception class must be a subclass of BaseException");
-                goto raise_error;
-            }
-        #endif
-    }
-    __Pyx_ErrRestore(type, value, tb);
-    return;
-raise_error:
-    Py_XDECREF(value);
-    Py_XDECREF(type);
-    Py_XDECREF(tb);
-    return;
-}
-
-static int __Pyx_TypeTest(PyObject *obj, PyTypeObject *type) {
-    if (!type) {
-        PyErr_Format(PyExc_SystemError, "Missing type object");
-        return 0;
-    }
-    if (obj == Py_None || PyObject_TypeCheck(obj, type))
-        return 1;
-    PyErr_Format(PyExc_TypeError, "Cannot convert %s to %s",
-        Py_TYPE(obj)->tp_name, type->tp_name);
-    return 0;
-}
-
-static int __Pyx_GetException(PyObject **type, PyObject **value, PyObject **tb) {
-    PyObject *tmp_type, *tmp_value, *tmp_tb;
-    PyThreadState *tstate = PyThreadState_GET();
-    __Pyx_ErrFetch(type, value, tb);
-    PyErr_NormalizeException(type, value, tb);
-    if (PyErr_Occurred())
-        goto bad;
-    Py_INCREF(*type);
-    Py_INCREF(*value);
-    Py_INCREF(*tb);
-    tmp_type = tstate->exc_type;
-    tmp_value = tstate->exc_value;
-    tmp_tb = tstate->exc_traceback;
-    tstate->exc_type = *type;
-    tstate->exc_value = *value;
-    tstate->exc_traceback = *tb;
-    /* Make sure tstate is in a consistent state when we XDECREF
-    these objects (XDECREF may run arbitrary code). */
-    Py_XDECREF(tmp_type);
-    Py_XDECREF(tmp_value);
-    Py_XDECREF(tmp_tb);
-    return 0;
-bad:
-    Py_XDECREF(*type);
-    Py_XDECREF(*value);
-    Py_XDECREF(*tb);
-    return -1;
-}
-
-
-#ifndef __PYX_HAVE_RT_ImportType
-#define __PYX_HAVE_RT_ImportType
-static PyTypeObject *__Pyx_ImportType(const char *module_name, const char *class_name,
-    long size)
-{
-    PyObject *py_module = 0;
-    PyObject *result = 0;
-    PyObject *py_name = 0;
-
-    py_module = __Pyx_ImportModule(module_name);
-    if (!py_module)
-        goto bad;
-    #if PY_MAJOR_VERSION < 3
-    py_name = PyString_FromString(class_name);
-    #else
-    py_name = PyUnicode_FromString(class_name);
-    #endif
-    if (!py_name)
-        goto bad;
-    result = PyObject_GetAttr(py_module, py_name);
-    Py_DECREF(py_name);
-    py_name = 0;
-    Py_DECREF(py_module);
-    py_module = 0;
-    if (!result)
-        goto bad;
-    if (!PyType_Check(result)) {
-        PyErr_Format(PyExc_TypeError, 
-            "%s.%s is not a type object",
-            module_name, class_name);
-        goto bad;
-    }
-    if (((PyTypeObject *)result)->tp_basicsize != size) {
-        PyErr_Format(PyExc_ValueError, 
-            "%s.%s does not appear to be the correct type object",
-            module_name, class_name);
-        goto bad;
-    }
-    return (PyTypeObject *)result;
-bad:
-    Py_XDECREF(py_module);
-    Py_XDECREF(result);
-    return 0;
-}
-#endif
-
-#ifndef __PYX_HAVE_RT_ImportModule
-#define __PYX_HAVE_RT_ImportModule
-static PyObject *__Pyx_ImportModule(const char *name) {
-    PyObject *py_name = 0;
-    PyObject *py_module = 0;
-
-    #if PY_MAJOR_VERSION < 3
-    py_name = PyString_FromString(name);
-    #else
-    py_name = PyUnicode_FromString(name);
-    #endif
-    if (!py_name)
-        goto bad;
-    py_module = PyImport_Import(py_name);
-    Py_DECREF(py_name);
-    return py_module;
-bad:
-    Py_XDECREF(py_name);
-    return 0;
-}
-#endif
-
-#include "compile.h"
-#include "frameobject.h"
-#include "traceback.h"
-
-static void __Pyx_AddTraceback(const char *funcname) {
-    PyObject *py_srcfile = 0;
-    PyObject *py_funcname = 0;
-    PyObject *py_globals = 0;
-    PyObject *empty_string = 0;
-    PyCodeObject *py_code = 0;
-    PyFrameObject *py_frame = 0;
-
-    #if PY_MAJOR_VERSION < 3
-    py_srcfile = PyString_FromString(__pyx_filename);
-    #else
-    py_srcfile = PyUnicode_FromString(__pyx_filename);
-    #endif
-    if (!py_srcfile) goto bad;
-    if (__pyx_clineno) {
-        #if PY_MAJOR_VERSION < 3
-        py_funcname = PyString_FromFormat( "%s (%s:%d)", funcname, __pyx_cfilenm, __pyx_clineno);
-        #else
-        py_funcname = PyUnicode_FromFormat( "%s (%s:%d)", funcname, __pyx_cfilenm, __pyx_clineno);
-        #endif
-    }
-    else {
-        #if PY_MAJOR_VERSION < 3
-        py_funcname = PyString_FromString(funcname);
-        #else
-        py_funcname = PyUnicode_FromString(funcname);
-        #endif
-    }
-    if (!py_funcname) goto bad;
-    py_globals = PyModule_GetDict(__pyx_m);
-    if (!py_globals) goto bad;
-    #if PY_MAJOR_VERSION < 3
-    empty_string = PyString_FromStringAndSize("", 0);
-    #else
-    empty_string = PyBytes_FromStringAndSize("", 0);
-    #endif
-    if (!empty_string) goto bad;
-    py_code = PyCode_New(
-        0,            /*int argcount,*/
-        #if PY_MAJOR_VERSION >= 3
-        0,            /*int kwonlyargcount,*/
-        #endif
-        0,            /*int nlocals,*/
-        0,            /*int stacksize,*/
-        0,            /*int flags,*/
-        empty_string, /*PyObject *code,*/
-        __pyx_empty_tuple,  /*PyObject *consts,*/
-        __pyx_empty_tuple,  /*PyObject *names,*/
-        __pyx_empty_tuple,  /*PyObject *varnames,*/
-        __pyx_empty_tuple,  /*PyObject *freevars,*/
-        __pyx_empty_tuple,  /*PyObject *cellvars,*/
-        py_srcfile,   /*PyObject *filename,*/
-        py_funcname,  /*PyObject *name,*/
-        __pyx_lineno,   /*int firstlineno,*/
-        empty_string  /*PyObject *lnotab*/
-    );
-    if (!py_code) goto bad;
-    py_frame = PyFrame_New(
-        PyThreadState_GET(), /*PyThreadState *tstate,*/
-        py_code,             /*PyCodeObject *code,*/
-        py_globals,          /*PyObject *globals,*/
-        0                    /*PyObject *locals*/
-    );
-    if (!py_frame) goto bad;
-    py_frame->f_lineno = __pyx_lineno;
-    PyTraceBack_Here(py_frame);
-bad:
-    Py_XDECREF(py_srcfile);
-    Py_XDECREF(py_funcname);
-    Py_XDECREF(empty_string);
-    Py_XDECREF(py_code);
-    Py_XDECREF(py_frame);
-}
-
-static int __Pyx_InitStrings(__Pyx_StringTabEntry *t) {
-    while (t->p) {
-        #if PY_MAJOR_VERSION < 3
-        if (t->is_unicode && (!t->is_identifier)) {
-            *t->p = PyUnicode_DecodeUTF8(t->s, t->n - 1, NULL);
-        } else if (t->intern) {
-            *t->p = PyString_InternFromString(t->s);
-        } else {
-            *t->p = PyString_FromStringAndSize(t->s, t->n - 1);
-        }
-        #else  /* Python 3+ has unicode identifiers */
-        if (t->is_identifier || (t->is_unicode && t->intern)) {
-            *t->p = PyUnicode_InternFromString(t->s);
-        } else if (t->is_unicode) {
-            *t->p = PyUnicode_FromStringAndSize(t->s, t->n - 1);
-        } else {
-            *t->p = PyBytes_FromStringAndSize(t->s, t->n - 1);
-        }
-        #endif
-        if (!*t->p)
-            return -1;
-        ++t;
-    }
-    return 0;
-}
-
-/* Type Conversion Functions */
-
-static INLINE Py_ssize_t __pyx_PyIndex_AsSsize_t(PyObject* b) {
-  Py_ssize_t ival;
-  PyObject* x = PyNumber_Index(b);
-  if (!x) return -1;
-  ival = PyInt_AsSsize_t(x);
-  Py_DECREF(x);
-  return ival;
-}
-
-static INLINE int __Pyx_PyObject_IsTrue(PyObject* x) {
-   if (x == Py_True) return 1;
-   else if (x == Py_False) return 0;
-   else return PyObject_IsTrue(x);
-}
-
-static INLINE PY_LONG_LONG __pyx_PyInt_AsLongLong(PyObject* x) {
-    if (PyInt_CheckExact(x)) {
-        return PyInt_AS_LONG(x);
-    }
-    else if (PyLong_CheckExact(x)) {
-        return PyLong_AsLongLong(x);
-    }
-    else {
-        PY_LONG_LONG val;
-        PyObject* tmp = PyNumber_Int(x); if (!tmp) return (PY_LONG_LONG)-1;
-        val = __pyx_PyInt_AsLongLong(tmp);
-        Py_DECREF(tmp);
-        return val;
-    }
-}
-
-static INLINE unsigned PY_LONG_LONG __pyx_PyInt_AsUnsignedLongLong(PyObject* x) {
-    if (PyInt_CheckExact(x)) {
-        long val = PyInt_AS_LONG(x);
-        if (unlikely(val < 0)) {
-            PyErr_SetString(PyExc_TypeError, "Negative assignment to unsigned type.");
-            return (unsigned PY_LONG_LONG)-1;
-        }
-        return val;
-    }
-    else if (PyLong_CheckExact(x)) {
-        return PyLong_AsUnsignedLongLong(x);
-    }
-    else {
-        PY_LONG_LONG val;
-        PyObject* tmp = PyNumber_Int(x); if (!tmp) return (PY_LONG_LONG)-1;
-        val = __pyx_PyInt_AsUnsignedLongLong(tmp);
-        Py_DECREF(tmp);
-        return val;
-    }
-}
-
-
-static INLINE unsigned char __pyx_PyInt_unsigned_char(PyObject* x) {
-    if (sizeof(unsigned char) < sizeof(long)) {
-        long long_val = __pyx_PyInt_AsLong(x);
-        unsigned char val = (unsigned char)long_val;
-        if (unlikely((val != long_val)  || (long_val < 0))) {
-            PyErr_SetString(PyExc_OverflowError, "value too large to convert to unsigned char");
-            return (unsigned char)-1;
-        }
-        return val;
-    }
-    else {
-        return __pyx_PyInt_AsLong(x);
-    }
-}
-
-static INLINE unsigned short __pyx_PyInt_unsigned_short(PyObject* x) {
-    if (sizeof(unsigned short) < sizeof(long)) {
-        long long_val = __pyx_PyInt_AsLong(x);
-        unsigned short val = (unsigned short)long_val;
-        if (unlikely((val != long_val)  || (long_val < 0))) {
-            PyErr_SetString(PyExc_OverflowError, "value too large to convert to unsigned short");
-            return (unsigned short)-1;
-        }
-        return val;
-    }
-    else {
-        return __pyx_PyInt_AsLong(x);
-    }
-}
-
-static INLINE char __pyx_PyInt_char(PyObject* x) {
-    if (sizeof(char) < sizeof(long)) {
-        long long_val = __pyx_PyInt_AsLong(x);
-        char val = (char)long_val;
-        if (unlikely((val != long_val) )) {
-            PyErr_SetString(PyExc_OverflowError, "value too large to convert to char");
-            return (char)-1;
-        }
-        return val;
-    }
-    else {
-        return __pyx_PyInt_AsLong(x);
-    }
-}
-
-static INLINE short __pyx_PyInt_short(PyObject* x) {
-    if (sizeof(short) < sizeof(long)) {
-        long long_val = __pyx_PyInt_AsLong(x);
-        short val = (short)long_val;
-        if (unlikely((val != long_val) )) {
-            PyErr_SetString(PyExc_OverflowError, "value too large to convert to short");
-            return (short)-1;
-        }
-        return val;
-    }
-    else {
-        return __pyx_PyInt_AsLong(x);
-    }
-}
-
-static INLINE int __pyx_PyInt_int(PyObject* x) {
-    if (sizeof(int) < sizeof(long)) {
-        long long_val = __pyx_PyInt_AsLong(x);
-        int val = (int)long_val;
-        if (unlikely((val != long_val) )) {
-            PyErr_SetString(PyExc_OverflowError, "value too large to convert to int");
-            return (int)-1;
-        }
-        return val;
-    }
-    else {
-        return __pyx_PyInt_AsLong(x);
-    }
-}
-
-static INLINE long __pyx_PyInt_long(PyObject* x) {
-    if (sizeof(long) < sizeof(long)) {
-        long long_val = __pyx_PyInt_AsLong(x);
-        long val = (long)long_val;
-        if (unlikely((val != long_val) )) {
-            PyErr_SetString(PyExc_OverflowError, "value too large to convert to long");
-            return (long)-1;
-        }
-        return val;
-    }
-    else {
-        return __pyx_PyInt_AsLong(x);
-    }
-}
-
-static INLINE signed char __pyx_PyInt_signed_char(PyObject* x) {
-    if (sizeof(signed char) < sizeof(long)) {
-        long long_val = __pyx_PyInt_AsLong(x);
-        signed char val = (signed char)long_val;
-        if (unlikely((val != long_val) )) {
-            PyErr_SetString(PyExc_OverflowError, "value too large to convert to signed char");
-            return (signed char)-1;
-        }
-        return val;
-    }
-    else {
-        return __pyx_PyInt_AsLong(x);
-    }
-}
-
-static INLINE signed short __pyx_PyInt_signed_short(PyObject* x) {
-    if (sizeof(signed short) < sizeof(long)) {
-        long long_val = __pyx_PyInt_AsLong(x);
-        signed short val = (signed short)long_val;
-        if (unlikely((val != long_val) )) {
-            PyErr_SetString(PyExc_OverflowError, "value too large to convert to signed short");
-            return (signed short)-1;
-        }
-        return val;
-    }
-    else {
-        return __pyx_PyInt_AsLong(x);
-    }
-}
-
-static INLINE signed int __pyx_PyInt_signed_int(PyObject* x) {
-    if (sizeof(signed int) < sizeof(long)) {
-        long long_val = __pyx_PyInt_AsLong(x);
-        signed int val = (signed int)long_val;
-        if (unlikely((val != long_val) )) {
-            PyErr_SetString(PyExc_OverflowError, "value too large to convert to signed int");
-            return (signed int)-1;
-        }
-        return val;
-    }
-    else {
-        return __pyx_PyInt_AsLong(x);
-    }
-}
-
-static INLINE signed long __pyx_PyInt_signed_long(PyObject* x) {
-    if (sizeof(signed long) < sizeof(long)) {
-        long long_val = __pyx_PyInt_AsLong(x);
-        signed long val = (signed long)long_val;
-        if (unlikely((val != long_val) )) {
-            PyErr_SetString(PyExc_OverflowError, "value too large to convert to signed long");
-            return (signed long)-1;
-        }
-        return val;
-    }
-    else {
-        return __pyx_PyInt_AsLong(x);
-    }
-}
-
-static INLINE long double __pyx_PyInt_long_double(PyObject* x) {
-    if (sizeof(long double) < sizeof(long)) {
-        long long_val = __pyx_PyInt_AsLong(x);
-        long double val = (long double)long_val;
-        if (unlikely((val != long_val) )) {
-            PyErr_SetString(PyExc_OverflowError, "value too large to convert to long double");
-            return (long double)-1;
-        }
-        return val;
-    }
-    else {
-        return __pyx_PyInt_AsLong(x);
-    }
-}
-
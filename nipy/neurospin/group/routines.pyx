@@ -13,6 +13,11 @@ cimport numpy as np
 
 import cython
 
+cdef extern from "math.h":
+    double rint(double x)
+    double log(double x)
+    double exp(double x)
+
 @cython.boundscheck(False)
 def add_lines(np.ndarray[np.float_t, ndim=2] A, 
                np.ndarray[np.float_t, ndim=2] B, 
@@ -39,3 +44,162 @@ def add_lines(np.ndarray[np.float_t, ndim=2] A,
         for j in range(j_max):
             B[index, j] = B[index, j] + A[i, j]
 
+
+@cython.boundscheck(False)
+@cython.wraparound(False)
+def sample_displacements(np.ndarray[np.float_t, ndim=3] U,
+                         np.ndarray[np.float_t, ndim=3] V,
+                         np.ndarray[np.int_t, ndim=3] W,
+                         np.ndarray[np.int_t, ndim=2] I,
+                         np.ndarray[np.float_t, ndim=1] N,
+                         np.ndarray[np.int_t, ndim=2] R,
+                         np.ndarray[np.int_t, ndim=2] XYZ,
+                         np.ndarray[np.int_t, ndim=3] XYZ_vol,
+                         np.ndarray[np.int_t, ndim=1] XYZ_min,
+                         np.ndarray[np.int_t, ndim=1] XYZ_max,
+                         np.ndarray[np.int_t, ndim=1] block_voxels,
+                         np.ndarray[np.int_t, ndim=1] block_start,
+                         np.ndarray[np.float_t, ndim=1] block_weights,
+                         np.ndarray[np.float_t, ndim=2] X,
+                         np.ndarray[np.float_t, ndim=1] m,
+                         np.ndarray[np.float_t, ndim=1] v,
+                         np.ndarray[np.int_t, ndim=2] order,
+                         np.ndarray[np.float_t, ndim=3] Z,
+                         np.ndarray[np.float_t, ndim=2] unif,
+                         np.ndarray[np.float_t, ndim=3] proposal_std,
+                         np.ndarray[np.float_t, ndim=3] proposal_mean,
+                         double std, int proposal=0):
+    """
+    sample_displacements(U, V, W, I, N, R, XYZ, XYZ_vol, XYZ_min, XYZ_max,
+                         block_voxels, block_start, block_weights, X, m, v,
+                         order, Z, unif, proposal_std, proposal_mean, std,
+                         proposal=0)
+
+    One Metropolis-Hastings sweep over the displacement blocks of
+    all the fields of a displacement_field, updating U, V, W, I in
+    place, N (the number of fields hitting each voxel) and R (the
+    rejections of the sweep).
+
+    The blocks of field i are visited in the order order[i], and the
+    proposal of block b of field i is drawn from the standard normals
+    Z[:, i, b] and accepted against the uniform unif[i, b], with the
+    same acceptance ratio as multivariate_stat.update_block, given
+    the effects X, the mean effects m and the voxel variances v.
+    proposal is 0 for a prior proposal with standard deviation
+    std, 1 for a random walk, and 2 for a fixed proposal centered on
+    proposal_mean. Proposals which move a voxel out of the lattice
+    are drawn again with numpy.random, as in displacement_field.sample.
+    """
+    cdef int n = U.shape[1]
+    cdef int B = U.shape[2]
+    cdef int dX = XYZ_vol.shape[0], dY = XYZ_vol.shape[1], dZ = XYZ_vol.shape[2]
+    cdef int i, b, k, l, d, s0, nb, nL, vox, ic, inew, valid, changed, nmax = 1
+    cdef long t
+    cdef double A, x, w, du, smax
+    cdef np.ndarray[np.float_t, ndim=1] Unew = np.zeros(3)
+    cdef np.ndarray[np.float_t, ndim=1] Zb = np.zeros(3)
+    cdef np.ndarray[np.int_t, ndim=1] c = np.zeros(3, dtype=np.int)
+    cdef np.ndarray[np.float_t, ndim=2] Vb
+    cdef np.ndarray[np.int_t, ndim=2] Wb
+    cdef np.ndarray[np.int_t, ndim=1] Lb, Ib
+
+    # Buffers of the largest block
+    for b in range(B):
+        if block_start[b+1] - block_start[b] > nmax:
+            nmax = block_start[b+1] - block_start[b]
+    Vb = np.zeros((3, nmax))
+    Wb = np.zeros((3, nmax), dtype=np.int)
+    Lb = np.zeros(nmax, dtype=np.int)
+    Ib = np.zeros(nmax, dtype=np.int)
+
+    for i in range(n):
+        for k in range(B):
+            b = order[i, k]
+            s0 = block_start[b]
+            nb = block_start[b+1] - s0
+            for d in range(3):
+                Zb[d] = Z[d, i, b]
+
+            # Propose a new displacement which keeps the block in the lattice
+            valid = 0
+            while not valid:
+                for d in range(3):
+                    Unew[d] = Zb[d] * proposal_std[d, i, b]
+                    if proposal == 1:
+                        Unew[d] += U[d, i, b]
+                    elif proposal == 2:
+                        Unew[d] += proposal_mean[d, i, b]
+                valid = 1
+                nL = 0
+                for l in range(nb):
+                    vox = block_voxels[s0+l]
+                    w = block_weights[s0+l]
+                    changed = 0
+                    for d in range(3):
+                        Vb[d, l] = V[d, i, vox] + w * (Unew[d] - U[d, i, b])
+                        Wb[d, l] = <long>rint(Vb[d, l])
+                        if Wb[d, l] != W[d, i, vox]:
+                            changed = 1
+                    if not changed:
+                        continue
+                    for d in range(3):
+                        t = XYZ[d, vox] + Wb[d, l]
+                        if t < XYZ_min[d]:
+                            t = XYZ_min[d]
+                        elif t > XYZ_max[d]:
+                            t = XYZ_max[d]
+                        c[d] = t
+                    if c[0] < 0 or c[0] >= dX or c[1] < 0 or c[1] >= dY or c[2] < 0 or c[2] >= dZ:
+                        inew = -1
+                    else:
+                        inew = XYZ_vol[c[0], c[1], c[2]]
+                    if inew < 0:
+                        valid = 0
+                        break
+                    Lb[nL] = l
+                    Ib[nL] = inew
+                    nL += 1
+                if not valid:
+                    Zb = np.random.randn(3)
+
+            # Log acceptance rate
+            A = 0.0
+            for l in range(nL):
+                vox = block_voxels[s0+Lb[l]]
+                ic = I[i, vox]
+                inew = Ib[l]
+                x = X[i, vox]
+                A += log(v[inew]) - log(v[ic]) \
+                    + (x - m[ic])**2 / v[ic] - (x - m[inew])**2 / v[inew]
+            if proposal > 0:
+                smax = 0.0
+                for d in range(3):
+                    A += (U[d, i, b]**2 - Unew[d]**2) / std**2
+                    if proposal_std[d, i, b] > smax:
+                        smax = proposal_std[d, i, b]
+                if proposal == 2:
+                    if smax == 0:
+                        A = np.inf
+                    else:
+                        for d in range(3):
+                            du = Unew[d] - U[d, i, b]
+                            A += du * (Unew[d] + U[d, i, b] - 2 * proposal_mean[d, i, b]) \
+                                / proposal_std[d, i, b]**2
+            R[i, b] = unif[i, b] > exp(0.5 * A)
+            if R[i, b]:
+                continue
+
+            # Accept
+            for d in range(3):
+                U[d, i, b] = Unew[d]
+            for l in range(nb):
+                vox = block_voxels[s0+l]
+                for d in range(3):
+                    V[d, i, vox] = Vb[d, l]
+            for l in range(nL):
+                vox = block_voxels[s0+Lb[l]]
+                for d in range(3):
+                    W[d, i, vox] = Wb[d, Lb[l]]
+                N[I[i, vox]] -= 1
+                N[Ib[l]] += 1
+                I[i, vox] = Ib[l]
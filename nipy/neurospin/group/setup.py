@@ -20,25 +20,25 @@ def configuration(parent_package='',top_path=None):
     config.add_data_dir('tests')
     config.add_extension(
         'onesample',
-        sources=['onesample.c'],
+        sources=['onesample.pyx'],
         libraries=['cstat'],
         extra_info=lapack_info,
         )
     config.add_extension(
         'twosample',
-        sources=['twosample.c'],
+        sources=['twosample.pyx'],
         libraries=['cstat'],
         extra_info=lapack_info,
         )
     config.add_extension(
         'routines',
-        sources=['routines.c'],
+        sources=['routines.pyx'],
         libraries=['cstat'],
         extra_info=lapack_info,
         )
     config.add_extension(
         'glm_twolevel',
-        sources=['glm_twolevel.c'],
+        sources=['glm_twolevel.pyx'],
         libraries=['cstat'],
         extra_info=lapack_info,
         )
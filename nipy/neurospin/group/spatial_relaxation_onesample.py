@@ -5,7 +5,7 @@
 import numpy as np
 import scipy.special as sp
 
-from routines import add_lines
+from routines import add_lines, sample_displacements
 from displacement_field import displacement_field
 
 #####################################################################################
@@ -242,34 +242,36 @@ class multivariate_stat:
             self.m_var[j] = 2 * self.m_var_post_scale[j] / np.random.chisquare(df = size[j] + 2 * shape[j])
     
     def update_displacements(self):
+        """
+        Metropolis-Hastings sweep over the displacement blocks of all
+        the fields, visited in random order, see routines.sample_displacements
+        """
         n, p = self.data.shape
-        B = len(self.D.block)
+        D = self.D
+        B = len(D.block)
+        proposal_std = np.zeros((3, n, B), float)
+        proposal_mean = np.zeros((3, n, B), float)
         if self.proposal == 'prior':
-            for i in xrange(n):
-                for b in np.random.permutation(range(B)):
-                    block = self.D.block[b]
-                    A = self.update_block(i, b, 'prior', self.std)
+            proposal = 0
+            proposal_std += self.std
         elif self.proposal == 'rand_walk':
-            if np.isscalar(self.proposal_std):
-                for i in xrange(n):
-                    for b in np.random.permutation(range(B)):
-                        block = self.D.block[b]
-                        A = self.update_block(i, b, 'rand_walk', self.proposal_std)
-            else:
-                for i in xrange(n):
-                    for b in np.random.permutation(range(B)):
-                        block = self.D.block[b]
-                        A = self.update_block(i, b, 'rand_walk', self.proposal_std[:, i, b])
+            proposal = 1
+            proposal_std += self.proposal_std
         else:
-            for i in xrange(n):
-                for b in np.random.permutation(range(B)):
-                    block = self.D.block[b]
-                    A = self.update_block(i, b, 'fixed', self.proposal_std[:, i, b], self.proposal_mean[:, i, b])
-        self.N *= 0
-        ones = np.ones((p, 1), float)
-        for i in xrange(n):
-            Ii = self.D.I[i]
-            add_lines(ones, self.N.reshape(p, 1), Ii)
+            proposal = 2
+            proposal_std += self.proposal_std
+            proposal_mean += self.proposal_mean
+        # Random numbers of the whole sweep
+        order = np.argsort(np.random.rand(n, B), axis=1)
+        Z = np.random.randn(3, n, B)
+        unif = np.random.rand(n, B)
+        sample_displacements(D.U, D.V, D.W, D.I, self.N, self.R,
+                             np.asarray(D.XYZ, int), D.XYZ_vol,
+                             D.XYZ_min.ravel(), D.XYZ_max.ravel(),
+                             D.block_voxels, D.block_start, D.block_weights,
+                             self.X, self.m, self.v[self.labels],
+                             order, Z, unif, proposal_std, proposal_mean,
+                             float(self.std), proposal)
         if self.verbose:
             print "mean rejected displacements :", self.R.mean(axis=0)
     
@@ -304,6 +306,9 @@ class multivariate_stat:
             self.D.U[:, i, b] = U
             self.D.V[:, i, block] = V
             if len(L)> 0:
+                ones = np.ones((len(L), 1), float)
+                add_lines(-ones, self.N.reshape(-1, 1), Ic)
+                add_lines(ones, self.N.reshape(-1, 1), I)
                 self.D.W[:, i, L] = W
                 self.D.I[i, L] = I
         return A
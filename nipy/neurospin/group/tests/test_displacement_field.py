@@ -94,6 +94,16 @@ class test_displacement_field(unittest.TestCase):
             D.W[:, i] = W
             D.I[i] = I
 
+    def test_apply_blocks(self):
+        data, XYZ, mask, XYZvol, vardata, signal = make_data(n=2, dim=20, r=3, mdim=15, maskdim=15, amplitude=5, noise=1, jitter=1, activation=True)
+        D = df.displacement_field(XYZ, sigma=2.5, n=data.shape[0], mask=mask)
+        B = len(D.block)
+        U = np.random.randn(3, B)
+        V = np.zeros((3, XYZ.shape[1]))
+        for b in xrange(B):
+            V[:, D.block[b]] += D.weights[b].reshape(1, -1) * U[:, b].reshape(3,1)
+        self.assertAlmostEqual(abs(D.apply_blocks(U) - V).max(), 0)
+
 class test_gaussian_random_field(unittest.TestCase):
     
     def test_sample(self, verbose=False):
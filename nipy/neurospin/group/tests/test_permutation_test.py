@@ -64,5 +64,22 @@ class test_permutation_test(unittest.TestCase):
         P = PT.permutation_test_twosample(data1, data2, XYZ, vardata1=vardata1, vardata2=vardata2, stat_id="student_mfx", ndraws=ndraws)
         p_values, cluster_results, region_results = P.calibrate(nperms=nperms, clusters=c, regions=r)
 
+    def test_onesample_null(self):
+        data, vardata, XYZ = make_data(mask_shape=(6,6,6))
+        magics = np.arange(10)
+        thresh = 1.0
+        maxT, maxsize, maxmass = PT.onesample_null(data, None, 'student', magics, 
+                                                    XYZ=XYZ, thresh=thresh, block=3)
+        T = PT.onesample_stat(data, None, 'student', Magics=magics)
+        for j in range(len(magics)):
+            self.assertAlmostEqual(maxT[j], T[j].max())
+            labels = PT.extract_clusters_from_thresh(T[j], XYZ, thresh)
+            size, mass = 0, 0.0
+            for l in range(labels.max()+1):
+                size = max(size, (labels==l).sum())
+                mass = max(mass, (T[j][labels==l]-thresh).sum())
+            self.assertEqual(maxsize[j], size)
+            self.assertAlmostEqual(maxmass[j], mass)
+
 if __name__ == "__main__":
     unittest.main()
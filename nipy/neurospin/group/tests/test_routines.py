@@ -1,7 +1,7 @@
 from numpy.testing import assert_equal, assert_almost_equal
 import numpy as np
 
-from nipy.neurospin.group import routines, onesample, twosample
+from nipy.neurospin.group import routines, onesample, twosample, glm_twolevel
 
 def slow_add_lines(A, B, I):
     for i in xrange(len(I)):
@@ -55,7 +55,125 @@ def test_onesample_stat():
     xT = x.T.copy()
     y = onesample.stat(xT, axis=0).reshape(nvox)
     assert_equal(y, y_target)
-    
+
+
+def test_stat_threads():
+    # Integer, non-contiguous data is copied by each thread
+    x = np.random.randint(100, size=(12, 5, 4, 3))
+    magics = np.arange(4)
+    for y in (x, x.astype('double').T):
+        axis = list(y.shape).index(12)
+        t1 = onesample.stat(y, axis=axis, Magics=magics)
+        t3 = onesample.stat(y, axis=axis, Magics=magics, nthreads=3)
+        assert_equal(t1, t3)
+        t1 = twosample.stat(y, y+1, axis=axis, Magics=magics)
+        t3 = twosample.stat(y, y+1, axis=axis, Magics=magics, nthreads=3)
+        assert_equal(t1, t3)
+
+
+def test_stat_blocks():
+    # More voxels than a block, each permutation evaluated separately
+    x = np.random.randn(10, 300)
+    magics = np.arange(5)
+    t = onesample.stat(x, axis=0, Magics=magics)
+    for k in magics:
+        tk = onesample.stat(x, axis=0, Magics=np.array([k]))
+        assert_almost_equal(t[k], tk[0])
+
+
+def test_stat_signs():
+    # Permuted means from the binary digits of the magic numbers
+    x = np.random.randn(10, 300)
+    magics = np.array([0, 1, 6, 1023, 600])
+    t = onesample.stat(x, 'mean', axis=0, Magics=magics)
+    ts = onesample.stat(x, 'sign', axis=0, Magics=magics)
+    tw = onesample.stat(x, 'wilcoxon', axis=0, Magics=magics)
+    te = onesample.stat(x, 'elr', axis=0, Magics=magics)
+    for k in range(magics.size):
+        signs = 1 - 2*((magics[k] >> np.arange(10)) & 1)
+        xp = signs[:, np.newaxis]*x
+        ranks = np.abs(xp).argsort(0).argsort(0) + 1
+        assert_almost_equal(t[k], xp.sum(0)/10.)
+        assert_almost_equal(ts[k], np.sign(xp).sum(0)/10.)
+        assert_almost_equal(tw[k], (ranks*np.sign(xp)).sum(0)/100.)
+        assert_almost_equal(te[k], onesample.stat(xp, 'elr', axis=0)[0])
+
+
+def test_stat_labels():
+    # Pooled-variance t statistic, more voxels than a block
+    x = 10 + np.random.randn(13, 300)
+    magics = np.arange(6)
+    t = twosample.stat(x[:5], x[5:], axis=0, Magics=magics)
+    d = x[:5].mean(0) - x[5:].mean(0)
+    v = (((x[:5]-x[:5].mean(0))**2).sum(0) + ((x[5:]-x[5:].mean(0))**2).sum(0))/11.
+    assert_almost_equal(t[0], d/np.sqrt(v))
+    for k in magics:
+        tk = twosample.stat(x[:5], x[5:], axis=0, Magics=np.array([k]))
+        assert_almost_equal(t[k], tk[0])
+
+
+def test_em_batch():
+    # Same fit whatever the block size, and early exit once converged 
+    y = np.random.randn(5, 20, 7)
+    vy = np.random.rand(5, 20, 7)
+    X = np.array([np.ones(20), np.arange(20)<10], dtype='double').T
+    b1, s21 = glm_twolevel.em(y, vy, X, axis=1, chunk=1)
+    b, s2 = glm_twolevel.em(y, vy, X, axis=1, nthreads=3)
+    assert_almost_equal(b, b1)
+    assert_almost_equal(s2, s21)
+    b, s2 = glm_twolevel.em(y, vy, X, axis=1, niter=5000)
+    b1, s21 = glm_twolevel.em(y, vy, X, axis=1, niter=5000, tol=1e-8)
+    assert_almost_equal(b, b1)
+    assert_almost_equal(s2, s21)
+
+
+def test_em_typed():
+    # Single precision and broadcast variances are read in place
+    y = np.random.randn(5, 20, 7).astype('float32')
+    vy = np.random.rand(5, 1, 7).astype('float32')
+    X = np.array([np.ones(20), np.arange(20)<10], dtype='double').T
+    b, s2 = glm_twolevel.em(y, vy, X, axis=1)
+    b1, s21 = glm_twolevel.em(y.astype('double'), vy + np.zeros(y.shape), X, axis=1)
+    assert_almost_equal(b, b1)
+    assert_almost_equal(s2, s21)
+
+
+
+def test_stat_mfx_warm():
+    # Cached null fits and early stopping leave the statistics unchanged
+    x = np.random.randn(12, 30)
+    v = np.random.rand(12, 30)
+    magics = np.arange(8)
+    t = onesample.stat_mfx(x, v, axis=0, Magics=magics, niter=200)
+    tw = onesample.stat_mfx(x, v, axis=0, Magics=magics, niter=200, warm=True)
+    assert_almost_equal(t, tw)
+    tw = onesample.stat_mfx(x, v, axis=0, Magics=magics, niter=200, tol=1e-8, warm=True)
+    assert_almost_equal(t, tw, decimal=5)
+    t = twosample.stat_mfx(x[:5], v[:5], x[5:], v[5:], axis=0, Magics=magics, niter=200)
+    tw = twosample.stat_mfx(x[:5], v[:5], x[5:], v[5:], axis=0, Magics=magics, niter=200, 
+                            tol=1e-8, warm=True)
+    assert_almost_equal(t, tw, decimal=5)
+
+
+def test_pdf_fit_blocks():
+    # Voxels fitted by blocks as one by one, whatever the data layout
+    x = np.random.randn(8, 70)
+    v = np.random.rand(8, 70)
+    w, z = onesample.pdf_fit_mfx(x, v, axis=0, niter=10)
+    mu, s2 = onesample.pdf_fit_gmfx(x, v, axis=0, niter=10)
+    assert_equal(w.shape, x.shape)
+    assert_equal(mu.shape, (1, 70))
+    for j in (0, 31, 32, 69):
+        wj, zj = onesample.pdf_fit_mfx(x[:, j:j+1], v[:, j:j+1], axis=0, niter=10)
+        assert_almost_equal(w[:, j:j+1], wj)
+        assert_almost_equal(z[:, j:j+1], zj)
+        muj, s2j = onesample.pdf_fit_gmfx(x[:, j:j+1], v[:, j:j+1], axis=0, niter=10)
+        assert_almost_equal(mu[:, j:j+1], muj)
+        assert_almost_equal(s2[:, j:j+1], s2j)
+    wt, zt = onesample.pdf_fit_mfx(x.T.reshape(10, 7, 8), v.T.reshape(10, 7, 8), axis=2, niter=10)
+    assert_equal(wt, w.T.reshape(10, 7, 8))
+    assert_equal(zt, z.T.reshape(10, 7, 8))
+
 
     
 if __name__ == "__main__":
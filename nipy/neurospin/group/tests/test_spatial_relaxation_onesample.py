@@ -160,6 +160,44 @@ def test_evaluate_mfx_spatial():
                       #burnin=10, verbose=verbose)
 
 
+@parametric
+def test_update_displacements():
+    # A sweep keeps the displacements, their discretization, the
+    # displaced voxels and their counts consistent 
+    prng = np.random.RandomState(10)
+    data, XYZ, XYZvol, vardata, signal = make_data(n=5, 
+                dim=10, r=3, amplitude=5, noise=1, jitter=1,
+                prng=prng)
+    P = os.multivariate_stat(data, vardata, XYZ, std=1, sigma=3)
+    P.init_hidden_variables()
+    P.verbose = verbose
+    n, p = data.shape
+    D = P.D
+    for proposal in ['prior', 'rand_walk']:
+        P.proposal = proposal
+        P.proposal_std = 0.5
+        for k in range(3):
+            P.update_displacements()
+        V = np.zeros((3, n, p))
+        for b in range(len(D.block)):
+            V[:, :, D.block[b]] += D.weights[b] * D.U[:, :, b].reshape(3, n, 1)
+        yield assert_almost_equal(abs(V - D.V).max(), 0)
+        yield assert_equal(abs(np.round(D.V) - D.W).max(), 0)
+        for i in range(n):
+            XYZ_W = np.clip(XYZ + D.W[:, i], D.XYZ_min, D.XYZ_max)
+            yield assert_equal(abs(D.XYZ_vol[XYZ_W[0], XYZ_W[1], XYZ_W[2]] - D.I[i]).max(), 0)
+        yield assert_equal(abs(np.bincount(D.I.ravel()) - P.N[:D.I.max()+1]).max(), 0)
+        yield assert_true(P.R.max() <= 1)
+    # A fixed proposal with zero variance is always accepted
+    U = D.U.copy()
+    P.proposal = 'fixed'
+    P.proposal_mean = U
+    P.proposal_std = U * 0
+    P.update_displacements()
+    yield assert_almost_equal(abs(D.U - U).max(), 0)
+    yield assert_equal(P.R.max(), 0)
+
+
 @parametric                    
 def test_update_labels():
     prng = np.random.RandomState(10)
@@ -14,6 +14,10 @@ __version__ = '0.1'
 # Includes
 include "fff.pxi"
 
+cdef extern from "stdlib.h":
+  void* malloc(size_t size)
+  void free(void* ptr)
+
 # Exports from fff_twosample_stat.h
 cdef extern from "fff_twosample_stat.h":
 
@@ -27,6 +31,7 @@ cdef extern from "fff_twosample_stat.h":
 
   ctypedef struct fff_twosample_stat_mfx:
     unsigned int niter
+    double tol
 
   fff_twosample_stat* fff_twosample_stat_new(unsigned int n1, unsigned int n2, fff_twosample_stat_flag flag)
   void fff_twosample_stat_delete(fff_twosample_stat* thisone) 
@@ -37,6 +42,8 @@ cdef extern from "fff_twosample_stat.h":
   void fff_twosample_stat_mfx_delete(fff_twosample_stat_mfx* thisone) 
   double fff_twosample_stat_mfx_eval(fff_twosample_stat_mfx* thisone, 
                                      fff_vector* x, fff_vector* vx)
+  int fff_twosample_stat_mfx_cache(fff_twosample_stat_mfx* thisone, 
+                                   fff_vector* x, fff_vector* vx)
   
   unsigned int fff_twosample_permutation(unsigned int* idx1, unsigned int* idx2, 
                                          unsigned int n1, unsigned int n2, double* magic)
@@ -45,6 +52,11 @@ cdef extern from "fff_twosample_stat.h":
                                        fff_vector* x1, fff_vector* v1, 
                                        fff_vector* x2,  fff_vector* v2,
                                        unsigned int i, unsigned int* idx1, unsigned int* idx2)
+
+  void fff_twosample_label_matrix(fff_matrix* G, unsigned int n1, fff_vector* magics)
+  int fff_twosample_stat_labels_init(fff_matrix* Y, fff_twosample_stat* thisone)
+  void fff_twosample_stat_eval_labels(fff_matrix* T, fff_twosample_stat* thisone, 
+                                      fff_matrix* G, fff_matrix* Y)
    
 
 # Initialize numpy
@@ -59,32 +71,212 @@ stats = {'student': FFF_TWOSAMPLE_STUDENT,
          'student_mfx': FFF_TWOSAMPLE_STUDENT_MFX}
 
 
+# Number of voxels evaluated together over all permutations
+DEF STAT_BLOCK = 256
+
+# Number of label permutations evaluated by one matrix product
+DEF PERM_BLOCK = 256
+
+# Parallel job for stat and stat_mfx, see onesample._stat_job. For
+# the Student statistic, voxels are copied by blocks and permutations
+# are evaluated by blocks using fff_twosample_stat_eval_labels, which
+# avoids copying permuted data. For MFX statistics, permutations are
+# evaluated one voxel at a time so that, if warm is non-zero, the null
+# hypothesis fit of the voxel is cached by fff_twosample_stat_mfx_cache.
+cdef struct _stat_job_params:
+  fffpy_multi_iterator** parts
+  fff_vector* magics
+  unsigned int n1
+  unsigned int n2
+  int flag
+  unsigned int niter
+  double tol
+  int warm
+  int mfx
+
+cdef void _stat_job(int rank, int nthreads, void* p):
+  cdef _stat_job_params* params = <_stat_job_params*>p
+  cdef fffpy_multi_iterator* multi = params.parts[rank]
+  cdef fff_twosample_stat* stat
+  cdef fff_twosample_stat_mfx* stat_mfx
+  cdef fff_vector *y1, *y2, *v1, *v2, *t, *yp, *vp
+  cdef fff_array *idx1, *idx2
+  cdef unsigned int n1 = params.n1, n2 = params.n2, n = n1+n2, nex
+  cdef unsigned long int simu, idx, nsimu = params.magics.size
+  cdef double magic
+  cdef fff_vector y, v, mk
+  cdef fff_matrix *yb, *gb, *pb
+  cdef fff_matrix yk, gk, pk
+  cdef double** tb
+  cdef size_t nb, nk, i, k
+
+  # Vector views and local structures
+  yp = fff_vector_new(n1+n2)
+  idx1 = fff_array_new1d(FFF_UINT, n1)
+  idx2 = fff_array_new1d(FFF_UINT, n2)
+  if params.mfx:
+    y1 = multi.vector[0]
+    v1 = multi.vector[1]
+    y2 = multi.vector[2]
+    v2 = multi.vector[3]
+    t = multi.vector[4]
+    vp = fff_vector_new(n1+n2)
+    stat_mfx = fff_twosample_stat_mfx_new(n1, n2, <fff_twosample_stat_flag>params.flag)
+    stat_mfx.niter = params.niter
+    stat_mfx.tol = params.tol
+  else:
+    y1 = multi.vector[0]
+    y2 = multi.vector[1]
+    t = multi.vector[2]
+    stat = fff_twosample_stat_new(n1, n2, <fff_twosample_stat_flag>params.flag)
+
+  # Loop over voxels, then permutations
+  if params.mfx:
+    fffpy_multi_iterator_reset(multi)
+    while(multi.index < multi.size):
+      if params.warm:
+        y = fff_vector_view(yp.data, n1, 1)
+        fff_vector_memcpy(&y, y1)
+        y = fff_vector_view(yp.data + n1, n2, 1)
+        fff_vector_memcpy(&y, y2)
+        v = fff_vector_view(vp.data, n1, 1)
+        fff_vector_memcpy(&v, v1)
+        v = fff_vector_view(vp.data + n1, n2, 1)
+        fff_vector_memcpy(&v, v2)
+        fff_twosample_stat_mfx_cache(stat_mfx, yp, vp)
+      for simu from 0 <= simu < params.magics.size:
+        magic = params.magics.data[simu*params.magics.stride]
+        nex = fff_twosample_permutation(<unsigned int*>idx1.data,
+                                        <unsigned int*>idx2.data,
+                                        n1, n2, &magic)
+        fff_twosample_apply_permutation(yp, vp, y1, v1, y2, v2, nex,
+                                        <unsigned int*>idx1.data,
+                                        <unsigned int*>idx2.data)
+        t.data[simu*t.stride] = fff_twosample_stat_mfx_eval(stat_mfx, yp, vp)
+      fffpy_multi_iterator_update(multi)
+
+  # Matrix form of the label permutations, by blocks of voxels
+  elif params.flag == FFF_TWOSAMPLE_STUDENT:
+    yb = fff_matrix_new(STAT_BLOCK, n)
+    gb = fff_matrix_new(PERM_BLOCK, n)
+    pb = fff_matrix_new(PERM_BLOCK, STAT_BLOCK)
+    tb = <double**>malloc(STAT_BLOCK*sizeof(double*))
+    fffpy_multi_iterator_reset(multi)
+    while(multi.index < multi.size):
+      nb = 0
+      while nb < STAT_BLOCK and multi.index < multi.size:
+        y = fff_vector_view(yb.data + nb*n, n1, 1)
+        fff_vector_memcpy(&y, y1)
+        y = fff_vector_view(yb.data + nb*n + n1, n2, 1)
+        fff_vector_memcpy(&y, y2)
+        tb[nb] = t.data
+        nb = nb + 1
+        fffpy_multi_iterator_update(multi)
+      yk = fff_matrix_view(yb.data, nb, n, n)
+      fff_twosample_stat_labels_init(&yk, stat)
+      simu = 0
+      while simu < nsimu:
+        nk = nsimu - simu
+        if nk > PERM_BLOCK:
+          nk = PERM_BLOCK
+        mk = fff_vector_view(params.magics.data + simu*params.magics.stride, nk, params.magics.stride)
+        gk = fff_matrix_view(gb.data, nk, n, n)
+        pk = fff_matrix_view(pb.data, nk, nb, nb)
+        fff_twosample_label_matrix(&gk, n1, &mk)
+        fff_twosample_stat_eval_labels(&pk, stat, &gk, &yk)
+        for k from 0 <= k < nk:
+          idx = (simu+k)*t.stride
+          for i from 0 <= i < nb:
+            tb[i][idx] = pk.data[k*nb+i]
+        simu = simu + nk
+    free(tb)
+    fff_matrix_delete(yb)
+    fff_matrix_delete(gb)
+    fff_matrix_delete(pb)
+
+  # Loop over permutations, then voxels
+  else:
+    for simu from 0 <= simu < params.magics.size:
+      magic = params.magics.data[simu*params.magics.stride]
+      nex = fff_twosample_permutation(<unsigned int*>idx1.data,
+                                      <unsigned int*>idx2.data,
+                                      n1, n2, &magic)
+      fffpy_multi_iterator_reset(multi)
+      idx = simu*t.stride
+      while(multi.index < multi.size):
+        fff_twosample_apply_permutation(yp, NULL, y1, NULL, y2, NULL, nex,
+                                        <unsigned int*>idx1.data,
+                                        <unsigned int*>idx2.data)
+        t.data[idx] = fff_twosample_stat_eval(stat, yp)
+        fffpy_multi_iterator_update(multi)
+
+  # Free memory
+  fff_vector_delete(yp)
+  fff_array_delete(idx1)
+  fff_array_delete(idx2)
+  if params.mfx:
+    fff_vector_delete(vp)
+    fff_twosample_stat_mfx_delete(stat_mfx)
+  else:
+    fff_twosample_stat_delete(stat)
+
+
+cdef _stat_run(fffpy_multi_iterator* multi, fff_vector* magics, 
+               unsigned int n1, unsigned int n2, int flag, 
+               unsigned int niter, double tol, int warm, int mfx, int nthreads):
+  """
+  Run _stat_job on nthreads threads with the GIL released, or
+  serially if nthreads is one or the multi-iterator cannot be split.
+  """
+  cdef _stat_job_params params
+  cdef fffpy_multi_iterator** parts
+
+  parts = NULL
+  if nthreads > 1:
+    parts = fffpy_multi_iterator_split(multi, nthreads)
+  params.magics = magics
+  params.n1 = n1
+  params.n2 = n2
+  params.flag = flag
+  params.niter = niter
+  params.tol = tol
+  params.warm = warm
+  params.mfx = mfx
+  if parts != NULL:
+    params.parts = parts
+    fffpy_parallel_run(nthreads, _stat_job, <void*>&params)
+    fffpy_multi_iterator_split_delete(parts, nthreads)
+  else:
+    params.parts = &multi
+    _stat_job(0, 1, <void*>&params)
+
+
 def count_permutations(unsigned int n1, unsigned int n2):
   cdef double  n
   fff_twosample_permutation(NULL, NULL, n1, n2, &n)
   return int(n)
   
 
-def stat(ndarray Y1, ndarray Y2, id='student', int axis=0, ndarray Magics=None):
+def stat(ndarray Y1, ndarray Y2, id='student', int axis=0, ndarray Magics=None,
+         int nthreads=1):
   """
-  T = stat(Y1, Y2, id='student', axis=0, magics=None).
+  T = stat(Y1, Y2, id='student', axis=0, magics=None, nthreads=1).
   
   Compute a two-sample test statistic (Y1>Y2) over a number of
   deterministic or random permutations.
+
+  Voxels are split across nthreads threads (all processors if
+  nthreads is zero or negative), which yields the same result.
   """
-  cdef fff_vector *y1, *y2, *t, *yp, *magics
-  cdef fff_array *idx1, *idx2
-  cdef unsigned int n, n1, n2, nex
-  cdef unsigned long int simu, nsimu, idx
-  cdef fff_twosample_stat* stat
+  cdef fff_vector *magics
+  cdef unsigned int n1, n2
+  cdef unsigned long int nsimu
   cdef fff_twosample_stat_flag flag_stat = stats[id]
-  cdef double magic
   cdef fffpy_multi_iterator* multi
 
   # Get number of observations
   n1 = <unsigned int>Y1.dimensions[axis]
   n2 = <unsigned int>Y2.dimensions[axis]
-  n = n1 + n2
 
   # Read out magic numbers
   if Magics == None:
@@ -99,50 +291,16 @@ def stat(ndarray Y1, ndarray Y2, id='student', int axis=0, ndarray Magics=None):
   dims[axis] = nsimu 
   T = np.zeros(dims)
 
-  # Create local structure
-  yp = fff_vector_new(n)
-  idx1 = fff_array_new1d(FFF_UINT, n1)
-  idx2 = fff_array_new1d(FFF_UINT, n2)
-  stat = fff_twosample_stat_new(n1, n2, flag_stat)
-
   # Multi-iterator 
   multi = fffpy_multi_iterator_new(3, axis, <void*>Y1, <void*>Y2, <void*>T)
 
-  # Vector views
-  y1 = multi.vector[0]
-  y2 = multi.vector[1]
-  t = multi.vector[2]
-  
   # Loop
-  for simu from 0 <= simu < nsimu:
-    
-    # Set the magic number
-    magic = magics.data[simu*magics.stride]
-
-    # Generate permutation 
-    nex = fff_twosample_permutation(<unsigned int*>idx1.data,
-                                    <unsigned int*>idx2.data,
-                                    n1, n2, &magic)
-   
-    # Reset the multi-iterator
-    fffpy_multi_iterator_reset(multi)
-    
-    # Perform the loop 
-    idx = simu*t.stride
-    while(multi.index < multi.size):
-      fff_twosample_apply_permutation(yp, NULL, y1, NULL, y2, NULL, nex,
-                                      <unsigned int*>idx1.data,
-                                      <unsigned int*>idx2.data)
-      t.data[idx] = fff_twosample_stat_eval(stat, yp)
-      fffpy_multi_iterator_update(multi)
+  nthreads = fff_threads_count(nthreads)
+  _stat_run(multi, magics, n1, n2, flag_stat, 0, 0.0, 0, 0, nthreads)
 
   # Delete local structures
   fffpy_multi_iterator_delete(multi)
   fff_vector_delete(magics)
-  fff_vector_delete(yp)
-  fff_array_delete(idx1)
-  fff_array_delete(idx2)
-  fff_twosample_stat_delete(stat)
 
   # Return
   return T
@@ -150,26 +308,30 @@ def stat(ndarray Y1, ndarray Y2, id='student', int axis=0, ndarray Magics=None):
 
 def stat_mfx(ndarray Y1, ndarray V1, ndarray Y2, ndarray V2,
              id='student_mfx', int axis=0, ndarray Magics=None,
-             unsigned int niter=5):
+             unsigned int niter=5, int nthreads=1, double tol=0.0, int warm=0):
   """
-  T = stat(Y1, V1, Y2, V2, id='student', axis=0, magics=None, niter=5).
+  T = stat(Y1, V1, Y2, V2, id='student', axis=0, magics=None, niter=5, nthreads=1, tol=0.0, warm=False).
   
   Compute a two-sample test statistic (Y1>Y2) over a number of
   deterministic or random permutations.
+
+  Voxels are split across nthreads threads, see stat.
+
+  If tol is positive, EM stops before niter iterations once the
+  relative change of the estimates is below tol. If warm is true,
+  the null hypothesis (common mean) fit is computed once per voxel
+  and reused for all permutations, as it does not depend on the
+  group labels.
   """
-  cdef fff_vector *y1, *y2, *v1, *v2, *t, *yp, *vp, *magics
-  cdef fff_array *idx1, *idx2
-  cdef unsigned int n, n1, n2, nex
-  cdef unsigned long int simu, nsimu, idx
-  cdef fff_twosample_stat_mfx* stat
+  cdef fff_vector *magics
+  cdef unsigned int n1, n2
+  cdef unsigned long int nsimu
   cdef fff_twosample_stat_flag flag_stat = stats[id]
-  cdef double magic
   cdef fffpy_multi_iterator* multi
 
   # Get number of observations
   n1 = <unsigned int>Y1.dimensions[axis]
   n2 = <unsigned int>Y2.dimensions[axis]
-  n = n1 + n2
 
   # Read out magic numbers
   if Magics == None:
@@ -184,58 +346,19 @@ def stat_mfx(ndarray Y1, ndarray V1, ndarray Y2, ndarray V2,
   dims[axis] = nsimu 
   T = np.zeros(dims)
 
-  # Create local structure
-  yp = fff_vector_new(n)
-  vp = fff_vector_new(n)
-  idx1 = fff_array_new1d(FFF_UINT, n1)
-  idx2 = fff_array_new1d(FFF_UINT, n2)
-  stat = fff_twosample_stat_mfx_new(n1, n2, flag_stat)
-  stat.niter = niter
-
   # Multi-iterator 
   multi = fffpy_multi_iterator_new(5, axis,
                                    <void*>Y1, <void*>V1,
                                    <void*>Y2, <void*>V2,
                                    <void*>T)
 
-  # Vector views
-  y1 = multi.vector[0]
-  v1 = multi.vector[1]
-  y2 = multi.vector[2]
-  v2 = multi.vector[3]
-  t = multi.vector[4]
-  
   # Loop
-  for simu from 0 <= simu < nsimu:
-    
-    # Set the magic number
-    magic = magics.data[simu*magics.stride]
-
-    # Generate permutation 
-    nex = fff_twosample_permutation(<unsigned int*>idx1.data,
-                                    <unsigned int*>idx2.data,
-                                    n1, n2, &magic)
-   
-    # Reset the multi-iterator      
-    fffpy_multi_iterator_reset(multi)
-    
-    # Perform the loop 
-    idx = simu*t.stride
-    while(multi.index < multi.size):
-      fff_twosample_apply_permutation(yp, vp, y1, v1, y2, v2, nex,
-                                      <unsigned int*>idx1.data,
-                                      <unsigned int*>idx2.data)
-      t.data[idx] = fff_twosample_stat_mfx_eval(stat, yp, vp)
-      fffpy_multi_iterator_update(multi)
+  nthreads = fff_threads_count(nthreads)
+  _stat_run(multi, magics, n1, n2, flag_stat, niter, tol, warm, 1, nthreads)
 
   # Delete local structures
   fffpy_multi_iterator_delete(multi)
   fff_vector_delete(magics)
-  fff_vector_delete(yp)
-  fff_vector_delete(vp)
-  fff_array_delete(idx1)
-  fff_array_delete(idx2)
-  fff_twosample_stat_mfx_delete(stat)
 
   # Return
   return T
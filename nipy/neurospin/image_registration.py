@@ -6,6 +6,7 @@ from nipy.neurospin.register.realign4d import Image4d, realign4d, _resample4d
 
 # Use the brifti image object
 from nipy.io.imageformats import Nifti1Image as Image 
+from nipy.io.imageformats import Nifti1Header
 
 def affine_register(source, 
                     target, 
@@ -15,7 +16,8 @@ def affine_register(source,
                     normalize=None, 
                     search='affine',
                     graduate_search=False,
-                    optimizer='powell'):
+                    optimizer='powell', 
+                    pyramid_levels=1):
     
     """
     Three-dimensional affine image registration. 
@@ -46,7 +48,12 @@ def affine_register(source,
        Run registration by doing first 'rigid', then 'similarity', then
        'affine' - if True
     optimizer : str
-       One of 'powell', 'simplex', 'conjugate_gradient'
+       One of 'powell', 'simplex', 'conjugate_gradient', 'bfgs'
+    pyramid_levels : int
+       Number of resolution levels. If greater than one, registration
+       is run coarse-to-fine on a pyramid of smoothed, decimated copies
+       of both images, which is computed once and shared by all
+       searches. See ``IconicMatcher.optimize_pyramid``
        
     Returns
     -------
@@ -71,13 +78,19 @@ def affine_register(source,
     print('Normalize: %s' % matcher.normalize) 
     print('Interpolation: %s' % matcher.interp)
 
+    def optimize(search, start): 
+        if pyramid_levels > 1: 
+            return matcher.optimize_pyramid(levels=pyramid_levels, method=optimizer, 
+                                            search=search, start=start)
+        return matcher.optimize(method=optimizer, search=search, start=start)
+
     T = None
     if graduate_search or search=='rigid':
-        T = matcher.optimize(method=optimizer, search='rigid')
+        T = optimize('rigid', T)
     if graduate_search or search=='similarity':
-        T = matcher.optimize(method=optimizer, search='similarity', start=T)
+        T = optimize('similarity', T)
     if graduate_search or search=='affine':
-        T = matcher.optimize(method=optimizer, search='affine', start=T)
+        T = optimize('affine', T)
     return T
 
 
@@ -140,15 +153,50 @@ def image4d(im, tr, tr_slices=None, start=0.0,
 
     Assumes that the input image referential is 'scanner' and that the
     third array index stands for 'z', i.e. the slice index. 
+
+    The image data is not copied: for an unscaled image loaded from
+    disk, it is a memory map that can be processed out-of-core (see
+    the streaming option of realign4d and resample4d). 
     """
     return Image4d(im.get_data(), im.get_affine(),
                    tr=tr, tr_slices=tr_slices, start=start,
                    slice_order=slice_order, interleaved=interleaved)
 
 
-def resample4d(im4d, transforms=None): 
+def resample4d(im4d, transforms=None, nthreads=1, streaming=False, filename=None): 
     """
-    corr_img = resample4d(im4d, transforms=None)
+    corr_img = resample4d(im4d, transforms=None, nthreads=1, streaming=False, filename=None)
+
+    If filename is given, the resampled scans are written one block
+    at a time to a memory-mapped NIfTI file of that name, see
+    nifti_memmap. 
     """
-    return Image(_resample4d(im4d, transforms),
+    out = None
+    if not filename == None: 
+        out = nifti_memmap(filename, im4d.get_data().shape, im4d.get_affine())
+    return Image(_resample4d(im4d, transforms, nthreads=nthreads, streaming=streaming, out=out),
                  im4d.get_affine())
+
+
+def nifti_memmap(filename, shape, affine, dtype='double'): 
+    """
+    Create a single-file NIfTI image of given shape, affine and data
+    type, and return its data array as a writable memory map. 
+    """
+    hdr = Nifti1Header()
+    hdr.set_data_shape(shape)
+    hdr.set_data_dtype(dtype)
+    hdr.set_sform(affine)
+    hdr.set_qform(affine)
+    offset = hdr.get_data_offset()
+    f = open(filename, 'wb')
+    hdr.write_to(f)
+    f.write('\x00' * (offset-f.tell()))
+    # Allocate the file without writing the data 
+    size = int(np.prod(shape))*hdr.get_data_dtype().itemsize
+    if size > 0: 
+        f.seek(offset+size-1)
+        f.write('\x00')
+    f.close()
+    return np.memmap(filename, dtype=hdr.get_data_dtype(), mode='r+', 
+                     offset=offset, shape=tuple(shape), order='F')
@@ -1,2223 +0,0 @@
-/* Generated by Cython 0.9.8.1.1 on Mon Mar  2 11:29:52 2009 */
-
-#define PY_SSIZE_T_CLEAN
-#include "Python.h"
-#include "structmember.h"
-#ifndef PY_LONG_LONG
-  #define PY_LONG_LONG LONG_LONG
-#endif
-#ifndef DL_EXPORT
-  #define DL_EXPORT(t) t
-#endif
-#if PY_VERSION_HEX < 0x02040000
-  #define METH_COEXIST 0
-#endif
-#if PY_VERSION_HEX < 0x02050000
-  typedef int Py_ssize_t;
-  #define PY_SSIZE_T_MAX INT_MAX
-  #define PY_SSIZE_T_MIN INT_MIN
-  #define PyInt_FromSsize_t(z) PyInt_FromLong(z)
-  #define PyInt_AsSsize_t(o)   PyInt_AsLong(o)
-  #define PyNumber_Index(o)    PyNumber_Int(o)
-  #define PyIndex_Check(o)     PyNumber_Check(o)
-#endif
-#if PY_VERSION_HEX < 0x02060000
-  #define Py_REFCNT(ob) (((PyObject*)(ob))->ob_refcnt)
-  #define Py_TYPE(ob)   (((PyObject*)(ob))->ob_type)
-  #define Py_SIZE(ob)   (((PyVarObject*)(ob))->ob_size)
-  #define PyVarObject_HEAD_INIT(type, size) \
-          PyObject_HEAD_INIT(type) size,
-  #define PyType_Modified(t)
-
-  typedef struct {
-       void *buf;
-       Py_ssize_t len;
-       int readonly;
-       const char *format;
-       int ndim;
-       Py_ssize_t *shape;
-       Py_ssize_t *strides;
-       Py_ssize_t *suboffsets;
-       Py_ssize_t itemsize;
-       void *internal;
-  } Py_buffer;
-
-  #define PyBUF_SIMPLE 0
-  #define PyBUF_WRITABLE 0x0001
-  #define PyBUF_LOCK 0x0002
-  #define PyBUF_FORMAT 0x0004
-  #define PyBUF_ND 0x0008
-  #define PyBUF_STRIDES (0x0010 | PyBUF_ND)
-  #define PyBUF_C_CONTIGUOUS (0x0020 | PyBUF_STRIDES)
-  #define PyBUF_F_CONTIGUOUS (0x0040 | PyBUF_STRIDES)
-  #define PyBUF_ANY_CONTIGUOUS (0x0080 | PyBUF_STRIDES)
-  #define PyBUF_INDIRECT (0x0100 | PyBUF_STRIDES)
-
-#endif
-#if PY_MAJOR_VERSION < 3
-  #define __Pyx_BUILTIN_MODULE_NAME "__builtin__"
-#else
-  #define __Pyx_BUILTIN_MODULE_NAME "builtins"
-#endif
-#if PY_MAJOR_VERSION >= 3
-  #define Py_TPFLAGS_CHECKTYPES 0
-  #define Py_TPFLAGS_HAVE_INDEX 0
-#endif
-#if PY_MAJOR_VERSION >= 3
-  #define PyBaseString_Type            PyUnicode_Type
-  #define PyString_Type                PyBytes_Type
-  #define PyInt_Type                   PyLong_Type
-  #define PyInt_Check(op)              PyLong_Check(op)
-  #define PyInt_CheckExact(op)         PyLong_CheckExact(op)
-  #define PyInt_FromString             PyLong_FromString
-  #define PyInt_FromUnicode            PyLong_FromUnicode
-  #define PyInt_FromLong               PyLong_FromLong
-  #define PyInt_FromSize_t             PyLong_FromSize_t
-  #define PyInt_FromSsize_t            PyLong_FromSsize_t
-  #define PyInt_AsLong                 PyLong_AsLong
-  #define PyInt_AS_LONG                PyLong_AS_LONG
-  #define PyInt_AsSsize_t              PyLong_AsSsize_t
-  #define PyInt_AsUnsignedLongMask     PyLong_AsUnsignedLongMask
-  #define PyInt_AsUnsignedLongLongMask PyLong_AsUnsignedLongLongMask
-  #define __Pyx_PyNumber_Divide(x,y)         PyNumber_TrueDivide(x,y)
-#else
-  #define __Pyx_PyNumber_Divide(x,y)         PyNumber_Divide(x,y)
-  #define PyBytes_Type                 PyString_Type
-#endif
-#if PY_MAJOR_VERSION >= 3
-  #define PyMethod_New(func, self, klass) PyInstanceMethod_New(func)
-#endif
-#if !defined(WIN32) && !defined(MS_WINDOWS)
-  #ifndef __stdcall
-    #define __stdcall
-  #endif
-  #ifndef __cdecl
-    #define __cdecl
-  #endif
-#else
-  #define _USE_MATH_DEFINES
-#endif
-#ifdef __cplusplus
-#define __PYX_EXTERN_C extern "C"
-#else
-#define __PYX_EXTERN_C extern
-#endif
-#include <math.h>
-#define __PYX_HAVE_API__fff2__registration___transform_affine
-#include "numpy/arrayobject.h"
-#include "fff_vector.h"
-#include "fff_matrix.h"
-#include "fff_base.h"
-#include "fff_array.h"
-#include "randomkit.h"
-#include "fffpy.h"
-#include "fff_iconic_match.h"
-
-
-#ifdef __GNUC__
-#define INLINE __inline__
-#elif _WIN32
-#define INLINE __inline
-#else
-#define INLINE 
-#endif
-
-typedef struct {PyObject **p; char *s; long n; char is_unicode; char intern; char is_identifier;} __Pyx_StringTabEntry; /*proto*/
-
-
-
-static int __pyx_skip_dispatch = 0;
-
-
-/* Type Conversion Predeclarations */
-
-#if PY_MAJOR_VERSION < 3
-#define __Pyx_PyBytes_FromString PyString_FromString
-#define __Pyx_PyBytes_AsString   PyString_AsString
-#else
-#define __Pyx_PyBytes_FromString PyBytes_FromString
-#define __Pyx_PyBytes_AsString   PyBytes_AsString
-#endif
-
-#define __Pyx_PyBool_FromLong(b) ((b) ? (Py_INCREF(Py_True), Py_True) : (Py_INCREF(Py_False), Py_False))
-static INLINE int __Pyx_PyObject_IsTrue(PyObject* x);
-static INLINE PY_LONG_LONG __pyx_PyInt_AsLongLong(PyObject* x);
-static INLINE unsigned PY_LONG_LONG __pyx_PyInt_AsUnsignedLongLong(PyObject* x);
-static INLINE Py_ssize_t __pyx_PyIndex_AsSsize_t(PyObject* b);
-
-#define __pyx_PyInt_AsLong(x) (PyInt_CheckExact(x) ? PyInt_AS_LONG(x) : PyInt_AsLong(x))
-#define __pyx_PyFloat_AsDouble(x) (PyFloat_CheckExact(x) ? PyFloat_AS_DOUBLE(x) : PyFloat_AsDouble(x))
-
-static INLINE unsigned char __pyx_PyInt_unsigned_char(PyObject* x);
-static INLINE unsigned short __pyx_PyInt_unsigned_short(PyObject* x);
-static INLINE char __pyx_PyInt_char(PyObject* x);
-static INLINE short __pyx_PyInt_short(PyObject* x);
-static INLINE int __pyx_PyInt_int(PyObject* x);
-static INLINE long __pyx_PyInt_long(PyObject* x);
-static INLINE signed char __pyx_PyInt_signed_char(PyObject* x);
-static INLINE signed short __pyx_PyInt_signed_short(PyObject* x);
-static INLINE signed int __pyx_PyInt_signed_int(PyObject* x);
-static INLINE signed long __pyx_PyInt_signed_long(PyObject* x);
-static INLINE long double __pyx_PyInt_long_double(PyObject* x);
-#ifdef __GNUC__
-/* Test for GCC > 2.95 */
-#if __GNUC__ > 2 ||               (__GNUC__ == 2 && (__GNUC_MINOR__ > 95)) 
-#define likely(x)   __builtin_expect(!!(x), 1)
-#define unlikely(x) __builtin_expect(!!(x), 0)
-#else /* __GNUC__ > 2 ... */
-#define likely(x)   (x)
-#define unlikely(x) (x)
-#endif /* __GNUC__ > 2 ... */
-#else /* __GNUC__ */
-#define likely(x)   (x)
-#define unlikely(x) (x)
-#endif /* __GNUC__ */
-    
-static PyObject *__pyx_m;
-static PyObject *__pyx_b;
-static PyObject *__pyx_empty_tuple;
-static int __pyx_lineno;
-static int __pyx_clineno = 0;
-static const char * __pyx_cfilenm= __FILE__;
-static const char *__pyx_filename;
-static const char **__pyx_f;
-
-static int __Pyx_ArgTypeTest(PyObject *obj, PyTypeObject *type, int none_allowed, char *name, int exact); /*proto*/
-
-static INLINE void __Pyx_RaiseArgtupleTooLong(Py_ssize_t num_expected, Py_ssize_t num_found); /*proto*/
-
-static PyObject *__Pyx_Import(PyObject *name, PyObject *from_list); /*proto*/
-
-static PyObject *__Pyx_GetName(PyObject *dict, PyObject *name); /*proto*/
-
-static INLINE PyObject *__Pyx_GetItemInt(PyObject *o, Py_ssize_t i, int is_unsigned) {
-    PyObject *r;
-    if (PyList_CheckExact(o) && 0 <= i && i < PyList_GET_SIZE(o)) {
-        r = PyList_GET_ITEM(o, i);
-        Py_INCREF(r);
-    }
-    else if (PyTuple_CheckExact(o) && 0 <= i && i < PyTuple_GET_SIZE(o)) {
-        r = PyTuple_GET_ITEM(o, i);
-        Py_INCREF(r);
-    }
-    else if (Py_TYPE(o)->tp_as_sequence && Py_TYPE(o)->tp_as_sequence->sq_item && (likely(i >= 0) || !is_unsigned))
-        r = PySequence_GetItem(o, i);
-    else {
-        PyObject *j = (likely(i >= 0) || !is_unsigned) ? PyInt_FromLong(i) : PyLong_FromUnsignedLongLong((sizeof(unsigned long long) > sizeof(Py_ssize_t) ? (1ULL << (sizeof(Py_ssize_t)*8)) : 0) + i);
-        if (!j)
-            return 0;
-        r = PyObject_GetItem(o, j);
-        Py_DECREF(j);
-    }
-    return r;
-}
-
-static int __Pyx_TypeTest(PyObject *obj, PyTypeObject *type); /*proto*/
-
-static PyTypeObject *__Pyx_ImportType(char *module_name, char *class_name, long size);  /*proto*/
-
-static PyObject *__Pyx_ImportModule(char *name); /*proto*/
-
-static void __Pyx_AddTraceback(const char *funcname); /*proto*/
-
-static int __Pyx_InitStrings(__Pyx_StringTabEntry *t); /*proto*/
-
-/* Type declarations */
-
-typedef unsigned long __pyx_t_4fff2_12registration_17_transform_affine_size_t;
-
-/* "/volatile/roche/bzr/nipy/fff2/fff2/registration/_transform_affine.pyx":29
- * 
- * # Enumerate transformation types
- * cdef enum transformation_type:             # <<<<<<<<<<<<<<
- *     RIGID2D, SIMILARITY2D, AFFINE2D,
- *     RIGID3D, SIMILARITY3D, AFFINE3D
- */
-
-enum __pyx_t_4fff2_12registration_17_transform_affine_transformation_type {
-  __pyx_e_4fff2_12registration_17_transform_affine_RIGID2D,
-  __pyx_e_4fff2_12registration_17_transform_affine_SIMILARITY2D,
-  __pyx_e_4fff2_12registration_17_transform_affine_AFFINE2D,
-  __pyx_e_4fff2_12registration_17_transform_affine_RIGID3D,
-  __pyx_e_4fff2_12registration_17_transform_affine_SIMILARITY3D,
-  __pyx_e_4fff2_12registration_17_transform_affine_AFFINE3D
-};
-/* Module declarations from numpy */
-
-/* Module declarations from fff2.registration._transform_affine */
-
-static PyTypeObject *__pyx_ptype_4fff2_12registration_17_transform_affine_dtype = 0;
-static PyTypeObject *__pyx_ptype_4fff2_12registration_17_transform_affine_ndarray = 0;
-static PyTypeObject *__pyx_ptype_4fff2_12registration_17_transform_affine_flatiter = 0;
-static PyTypeObject *__pyx_ptype_4fff2_12registration_17_transform_affine_broadcast = 0;
-static int __pyx_k_9;
-
-
-/* Implementation of fff2.registration._transform_affine */
-static char __pyx_k_1[] = "0.1";
-static char __pyx_k_2[] = "rigid 2D";
-static char __pyx_k_3[] = "similarity 2D";
-static char __pyx_k_4[] = "affine 2D";
-static char __pyx_k_5[] = "rigid 3D";
-static char __pyx_k_6[] = "similarity 3D";
-static char __pyx_k_7[] = "affine 3D";
-static PyObject *__pyx_int_0;
-static PyObject *__pyx_int_3;
-static PyObject *__pyx_int_1;
-static PyObject *__pyx_int_2;
-static PyObject *__pyx_int_4;
-static PyObject *__pyx_int_5;
-static PyObject *__pyx_int_6;
-static PyObject *__pyx_int_7;
-static PyObject *__pyx_int_11;
-static char __pyx_k___version__[] = "__version__";
-static PyObject *__pyx_kp___version__;
-static char __pyx_k_numpy[] = "numpy";
-static PyObject *__pyx_kp_numpy;
-static char __pyx_k_np[] = "np";
-static PyObject *__pyx_kp_np;
-static char __pyx_k_8[] = "transformation_types";
-static PyObject *__pyx_kp_8;
-static char __pyx_k_linalg[] = "linalg";
-static PyObject *__pyx_kp_linalg;
-static char __pyx_k_norm[] = "norm";
-static PyObject *__pyx_kp_norm;
-static char __pyx_k_array[] = "array";
-static PyObject *__pyx_kp_array;
-static char __pyx_k_eye[] = "eye";
-static PyObject *__pyx_kp_eye;
-static char __pyx_k_sin[] = "sin";
-static PyObject *__pyx_kp_sin;
-static char __pyx_k_cos[] = "cos";
-static PyObject *__pyx_kp_cos;
-static char __pyx_k_dot[] = "dot";
-static PyObject *__pyx_kp_dot;
-static char __pyx_k_rvector_to_matrix[] = "rvector_to_matrix";
-static PyObject *__pyx_kp_rvector_to_matrix;
-static char __pyx_k_diag[] = "diag";
-static PyObject *__pyx_kp_diag;
-static char __pyx_k_dtype[] = "dtype";
-static PyObject *__pyx_kp_dtype;
-static char __pyx_k_zeros[] = "zeros";
-static PyObject *__pyx_kp_zeros;
-static char __pyx_k_astype[] = "astype";
-static PyObject *__pyx_kp_astype;
-static char __pyx_k_asarray[] = "asarray";
-static PyObject *__pyx_kp_asarray;
-static char __pyx_k_order[] = "order";
-static PyObject *__pyx_kp_order;
-static char __pyx_k_10[] = "C";
-static PyObject *__pyx_kp_10;
-static PyObject *__pyx_kp_1;
-static PyObject *__pyx_kp_2;
-static PyObject *__pyx_kp_3;
-static PyObject *__pyx_kp_4;
-static PyObject *__pyx_kp_5;
-static PyObject *__pyx_kp_6;
-static PyObject *__pyx_kp_7;
-
-/* "/volatile/roche/bzr/nipy/fff2/fff2/registration/_transform_affine.pyx":41
- *                         'affine 3D': AFFINE3D}
- * 
- * def rvector_to_matrix(r):             # <<<<<<<<<<<<<<
- * 
- *     """
- */
-
-static PyObject *__pyx_pf_4fff2_12registration_17_transform_affine_rvector_to_matrix(PyObject *__pyx_self, PyObject *__pyx_v_r); /*proto*/
-static char __pyx_doc_4fff2_12registration_17_transform_affine_rvector_to_matrix[] = "\n    R = rvector_to_matrix(r)\n\n    The rotation matrix is given by the Rodrigues formula:\n    \n    R = Id + sin(theta)*Sn + (1-cos(theta))*Sn^2  \n    \n    with:\n    \n           0  -nz  ny\n    Sn =   nz   0 -nx\n          -ny  nx   0\n    \n    where n = r / ||r||\n    \n    In case the angle ||r|| is very small, the above formula may lead\n    to numerical instabilities. We instead use a Taylor expansion\n    around theta=0:\n    \n    R = I + sin(theta)/tetha Sr + (1-cos(theta))/teta2 Sr^2\n    \n    leading to:\n    \n    R = I + (1-theta2/6)*Sr + (1/2-theta2/24)*Sr^2\n    ";
-static PyObject *__pyx_pf_4fff2_12registration_17_transform_affine_rvector_to_matrix(PyObject *__pyx_self, PyObject *__pyx_v_r) {
-  double __pyx_v_theta;
-  double __pyx_v_theta2;
-  PyObject *__pyx_v_n;
-  PyObject *__pyx_v_Sn;
-  PyObject *__pyx_v_R;
-  PyObject *__pyx_v_Sr;
-  PyObject *__pyx_r;
-  PyObject *__pyx_1 = 0;
-  PyObject *__pyx_2 = 0;
-  PyObject *__pyx_3 = 0;
-  double __pyx_4;
-  int __pyx_5;
-  PyObject *__pyx_6 = 0;
-  PyObject *__pyx_7 = 0;
-  PyObject *__pyx_8 = 0;
-  __pyx_self = __pyx_self;
-  __pyx_v_n = Py_None; Py_INCREF(Py_None);
-  __pyx_v_Sn = Py_None; Py_INCREF(Py_None);
-  __pyx_v_R = Py_None; Py_INCREF(Py_None);
-  __pyx_v_Sr = Py_None; Py_INCREF(Py_None);
-
-  /* "/volatile/roche/bzr/nipy/fff2/fff2/registration/_transform_affine.pyx":69
- *     """
- *     cdef double theta, theta2
- *     theta = <double> np.linalg.norm(r)             # <<<<<<<<<<<<<<
- *     if theta > 1e-30:
- *         n = r/theta
- */
-  __pyx_1 = __Pyx_GetName(__pyx_m, __pyx_kp_np); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 69; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __pyx_2 = PyObject_GetAttr(__pyx_1, __pyx_kp_linalg); if (unlikely(!__pyx_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 69; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_DECREF(__pyx_1); __pyx_1 = 0;
-  __pyx_1 = PyObject_GetAttr(__pyx_2, __pyx_kp_norm); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 69; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_DECREF(__pyx_2); __pyx_2 = 0;
-  __pyx_2 = PyTuple_New(1); if (unlikely(!__pyx_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 69; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_INCREF(__pyx_v_r);
-  PyTuple_SET_ITEM(__pyx_2, 0, __pyx_v_r);
-  __pyx_3 = PyObject_Call(__pyx_1, ((PyObject *)__pyx_2), NULL); if (unlikely(!__pyx_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 69; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_DECREF(__pyx_1); __pyx_1 = 0;
-  Py_DECREF(((PyObject *)__pyx_2)); __pyx_2 = 0;
-  __pyx_4 = __pyx_PyFloat_AsDouble(__pyx_3); if (unlikely(PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 69; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_DECREF(__pyx_3); __pyx_3 = 0;
-  __pyx_v_theta = ((double)__pyx_4);
-
-  /* "/volatile/roche/bzr/nipy/fff2/fff2/registration/_transform_affine.pyx":70
- *     cdef double theta, theta2
- *     theta = <double> np.linalg.norm(r)
- *     if theta > 1e-30:             # <<<<<<<<<<<<<<
- *         n = r/theta
- *         Sn = np.array([[0,-n[2],n[1]],[n[2],0,-n[0]],[-n[1],n[0],0]])
- */
-  __pyx_5 = (__pyx_v_theta > 1e-30);
-  if (__pyx_5) {
-
-    /* "/volatile/roche/bzr/nipy/fff2/fff2/registration/_transform_affine.pyx":71
- *     theta = <double> np.linalg.norm(r)
- *     if theta > 1e-30:
- *         n = r/theta             # <<<<<<<<<<<<<<
- *         Sn = np.array([[0,-n[2],n[1]],[n[2],0,-n[0]],[-n[1],n[0],0]])
- *         R = np.eye(3) + np.sin(theta)*Sn + (1-np.cos(theta))*np.dot(Sn,Sn)
- */
-    __pyx_1 = PyFloat_FromDouble(__pyx_v_theta); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 71; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __pyx_2 = __Pyx_PyNumber_Divide(__pyx_v_r, __pyx_1); if (unlikely(!__pyx_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 71; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_DECREF(__pyx_1); __pyx_1 = 0;
-    Py_DECREF(__pyx_v_n);
-    __pyx_v_n = __pyx_2;
-    __pyx_2 = 0;
-
-    /* "/volatile/roche/bzr/nipy/fff2/fff2/registration/_transform_affine.pyx":72
- *     if theta > 1e-30:
- *         n = r/theta
- *         Sn = np.array([[0,-n[2],n[1]],[n[2],0,-n[0]],[-n[1],n[0],0]])             # <<<<<<<<<<<<<<
- *         R = np.eye(3) + np.sin(theta)*Sn + (1-np.cos(theta))*np.dot(Sn,Sn)
- *     else:
- */
-    __pyx_3 = __Pyx_GetName(__pyx_m, __pyx_kp_np); if (unlikely(!__pyx_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 72; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __pyx_1 = PyObject_GetAttr(__pyx_3, __pyx_kp_array); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 72; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_DECREF(__pyx_3); __pyx_3 = 0;
-    __pyx_2 = __Pyx_GetItemInt(__pyx_v_n, 2, 0); if (!__pyx_2) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 72; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __pyx_3 = PyNumber_Negative(__pyx_2); if (unlikely(!__pyx_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 72; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_DECREF(__pyx_2); __pyx_2 = 0;
-    __pyx_2 = __Pyx_GetItemInt(__pyx_v_n, 1, 0); if (!__pyx_2) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 72; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __pyx_6 = PyList_New(3); if (unlikely(!__pyx_6)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 72; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_INCREF(__pyx_int_0);
-    PyList_SET_ITEM(__pyx_6, 0, __pyx_int_0);
-    PyList_SET_ITEM(__pyx_6, 1, __pyx_3);
-    PyList_SET_ITEM(__pyx_6, 2, __pyx_2);
-    __pyx_3 = 0;
-    __pyx_2 = 0;
-    __pyx_3 = __Pyx_GetItemInt(__pyx_v_n, 2, 0); if (!__pyx_3) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 72; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __pyx_2 = __Pyx_GetItemInt(__pyx_v_n, 0, 0); if (!__pyx_2) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 72; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __pyx_7 = PyNumber_Negative(__pyx_2); if (unlikely(!__pyx_7)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 72; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_DECREF(__pyx_2); __pyx_2 = 0;
-    __pyx_2 = PyList_New(3); if (unlikely(!__pyx_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 72; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    PyList_SET_ITEM(__pyx_2, 0, __pyx_3);
-    Py_INCREF(__pyx_int_0);
-    PyList_SET_ITEM(__pyx_2, 1, __pyx_int_0);
-    PyList_SET_ITEM(__pyx_2, 2, __pyx_7);
-    __pyx_3 = 0;
-    __pyx_7 = 0;
-    __pyx_3 = __Pyx_GetItemInt(__pyx_v_n, 1, 0); if (!__pyx_3) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 72; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __pyx_7 = PyNumber_Negative(__pyx_3); if (unlikely(!__pyx_7)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 72; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_DECREF(__pyx_3); __pyx_3 = 0;
-    __pyx_3 = __Pyx_GetItemInt(__pyx_v_n, 0, 0); if (!__pyx_3) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 72; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __pyx_8 = PyList_New(3); if (unlikely(!__pyx_8)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 72; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    PyList_SET_ITEM(__pyx_8, 0, __pyx_7);
-    PyList_SET_ITEM(__pyx_8, 1, __pyx_3);
-    Py_INCREF(__pyx_int_0);
-    PyList_SET_ITEM(__pyx_8, 2, __pyx_int_0);
-    __pyx_7 = 0;
-    __pyx_3 = 0;
-    __pyx_7 = PyList_New(3); if (unlikely(!__pyx_7)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 72; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    PyList_SET_ITEM(__pyx_7, 0, ((PyObject *)__pyx_6));
-    PyList_SET_ITEM(__pyx_7, 1, ((PyObject *)__pyx_2));
-    PyList_SET_ITEM(__pyx_7, 2, ((PyObject *)__pyx_8));
-    __pyx_6 = 0;
-    __pyx_2 = 0;
-    __pyx_8 = 0;
-    __pyx_3 = PyTuple_New(1); if (unlikely(!__pyx_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 72; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    PyTuple_SET_ITEM(__pyx_3, 0, ((PyObject *)__pyx_7));
-    __pyx_7 = 0;
-    __pyx_6 = PyObject_Call(__pyx_1, ((PyObject *)__pyx_3), NULL); if (unlikely(!__pyx_6)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 72; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_DECREF(__pyx_1); __pyx_1 = 0;
-    Py_DECREF(((PyObject *)__pyx_3)); __pyx_3 = 0;
-    Py_DECREF(__pyx_v_Sn);
-    __pyx_v_Sn = __pyx_6;
-    __pyx_6 = 0;
-
-    /* "/volatile/roche/bzr/nipy/fff2/fff2/registration/_transform_affine.pyx":73
- *         n = r/theta
- *         Sn = np.array([[0,-n[2],n[1]],[n[2],0,-n[0]],[-n[1],n[0],0]])
- *         R = np.eye(3) + np.sin(theta)*Sn + (1-np.cos(theta))*np.dot(Sn,Sn)             # <<<<<<<<<<<<<<
- *     else:
- *         Sr = np.array([[0,-r[2],r[1]],[r[2],0,-r[0]],[-r[1],r[0],0]])
- */
-    __pyx_2 = __Pyx_GetName(__pyx_m, __pyx_kp_np); if (unlikely(!__pyx_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 73; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __pyx_8 = PyObject_GetAttr(__pyx_2, __pyx_kp_eye); if (unlikely(!__pyx_8)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 73; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_DECREF(__pyx_2); __pyx_2 = 0;
-    __pyx_7 = PyTuple_New(1); if (unlikely(!__pyx_7)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 73; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_INCREF(__pyx_int_3);
-    PyTuple_SET_ITEM(__pyx_7, 0, __pyx_int_3);
-    __pyx_1 = PyObject_Call(__pyx_8, ((PyObject *)__pyx_7), NULL); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 73; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_DECREF(__pyx_8); __pyx_8 = 0;
-    Py_DECREF(((PyObject *)__pyx_7)); __pyx_7 = 0;
-    __pyx_3 = __Pyx_GetName(__pyx_m, __pyx_kp_np); if (unlikely(!__pyx_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 73; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __pyx_6 = PyObject_GetAttr(__pyx_3, __pyx_kp_sin); if (unlikely(!__pyx_6)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 73; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_DECREF(__pyx_3); __pyx_3 = 0;
-    __pyx_2 = PyFloat_FromDouble(__pyx_v_theta); if (unlikely(!__pyx_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 73; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __pyx_8 = PyTuple_New(1); if (unlikely(!__pyx_8)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 73; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    PyTuple_SET_ITEM(__pyx_8, 0, __pyx_2);
-    __pyx_2 = 0;
-    __pyx_7 = PyObject_Call(__pyx_6, ((PyObject *)__pyx_8), NULL); if (unlikely(!__pyx_7)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 73; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_DECREF(__pyx_6); __pyx_6 = 0;
-    Py_DECREF(((PyObject *)__pyx_8)); __pyx_8 = 0;
-    __pyx_3 = PyNumber_Multiply(__pyx_7, __pyx_v_Sn); if (unlikely(!__pyx_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 73; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_DECREF(__pyx_7); __pyx_7 = 0;
-    __pyx_2 = PyNumber_Add(__pyx_1, __pyx_3); if (unlikely(!__pyx_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 73; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_DECREF(__pyx_1); __pyx_1 = 0;
-    Py_DECREF(__pyx_3); __pyx_3 = 0;
-    __pyx_6 = __Pyx_GetName(__pyx_m, __pyx_kp_np); if (unlikely(!__pyx_6)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 73; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __pyx_8 = PyObject_GetAttr(__pyx_6, __pyx_kp_cos); if (unlikely(!__pyx_8)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 73; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_DECREF(__pyx_6); __pyx_6 = 0;
-    __pyx_7 = PyFloat_FromDouble(__pyx_v_theta); if (unlikely(!__pyx_7)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 73; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __pyx_1 = PyTuple_New(1); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 73; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    PyTuple_SET_ITEM(__pyx_1, 0, __pyx_7);
-    __pyx_7 = 0;
-    __pyx_3 = PyObject_Call(__pyx_8, ((PyObject *)__pyx_1), NULL); if (unlikely(!__pyx_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 73; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_DECREF(__pyx_8); __pyx_8 = 0;
-    Py_DECREF(((PyObject *)__pyx_1)); __pyx_1 = 0;
-    __pyx_6 = PyNumber_Subtract(__pyx_int_1, __pyx_3); if (unlikely(!__pyx_6)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 73; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_DECREF(__pyx_3); __pyx_3 = 0;
-    __pyx_7 = __Pyx_GetName(__pyx_m, __pyx_kp_np); if (unlikely(!__pyx_7)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 73; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __pyx_8 = PyObject_GetAttr(__pyx_7, __pyx_kp_dot); if (unlikely(!__pyx_8)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 73; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_DECREF(__pyx_7); __pyx_7 = 0;
-    __pyx_1 = PyTuple_New(2); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 73; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_INCREF(__pyx_v_Sn);
-    PyTuple_SET_ITEM(__pyx_1, 0, __pyx_v_Sn);
-    Py_INCREF(__pyx_v_Sn);
-    PyTuple_SET_ITEM(__pyx_1, 1, __pyx_v_Sn);
-    __pyx_3 = PyObject_Call(__pyx_8, ((PyObject *)__pyx_1), NULL); if (unlikely(!__pyx_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 73; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_DECREF(__pyx_8); __pyx_8 = 0;
-    Py_DECREF(((PyObject *)__pyx_1)); __pyx_1 = 0;
-    __pyx_7 = PyNumber_Multiply(__pyx_6, __pyx_3); if (unlikely(!__pyx_7)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 73; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_DECREF(__pyx_6); __pyx_6 = 0;
-    Py_DECREF(__pyx_3); __pyx_3 = 0;
-    __pyx_8 = PyNumber_Add(__pyx_2, __pyx_7); if (unlikely(!__pyx_8)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 73; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_DECREF(__pyx_2); __pyx_2 = 0;
-    Py_DECREF(__pyx_7); __pyx_7 = 0;
-    Py_DECREF(__pyx_v_R);
-    __pyx_v_R = __pyx_8;
-    __pyx_8 = 0;
-    goto __pyx_L5;
-  }
-  /*else*/ {
-
-    /* "/volatile/roche/bzr/nipy/fff2/fff2/registration/_transform_affine.pyx":75
- *         R = np.eye(3) + np.sin(theta)*Sn + (1-np.cos(theta))*np.dot(Sn,Sn)
- *     else:
- *         Sr = np.array([[0,-r[2],r[1]],[r[2],0,-r[0]],[-r[1],r[0],0]])             # <<<<<<<<<<<<<<
- *         theta2 = theta*theta
- *         R = np.eye(3) + (1-theta2/6.)*Sr + (.5-theta2/24.)*np.dot(Sr,Sr)
- */
-    __pyx_1 = __Pyx_GetName(__pyx_m, __pyx_kp_np); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 75; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __pyx_6 = PyObject_GetAttr(__pyx_1, __pyx_kp_array); if (unlikely(!__pyx_6)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 75; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_DECREF(__pyx_1); __pyx_1 = 0;
-    __pyx_3 = __Pyx_GetItemInt(__pyx_v_r, 2, 0); if (!__pyx_3) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 75; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __pyx_2 = PyNumber_Negative(__pyx_3); if (unlikely(!__pyx_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 75; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_DECREF(__pyx_3); __pyx_3 = 0;
-    __pyx_7 = __Pyx_GetItemInt(__pyx_v_r, 1, 0); if (!__pyx_7) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 75; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __pyx_8 = PyList_New(3); if (unlikely(!__pyx_8)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 75; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_INCREF(__pyx_int_0);
-    PyList_SET_ITEM(__pyx_8, 0, __pyx_int_0);
-    PyList_SET_ITEM(__pyx_8, 1, __pyx_2);
-    PyList_SET_ITEM(__pyx_8, 2, __pyx_7);
-    __pyx_2 = 0;
-    __pyx_7 = 0;
-    __pyx_1 = __Pyx_GetItemInt(__pyx_v_r, 2, 0); if (!__pyx_1) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 75; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __pyx_3 = __Pyx_GetItemInt(__pyx_v_r, 0, 0); if (!__pyx_3) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 75; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __pyx_2 = PyNumber_Negative(__pyx_3); if (unlikely(!__pyx_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 75; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_DECREF(__pyx_3); __pyx_3 = 0;
-    __pyx_7 = PyList_New(3); if (unlikely(!__pyx_7)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 75; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    PyList_SET_ITEM(__pyx_7, 0, __pyx_1);
-    Py_INCREF(__pyx_int_0);
-    PyList_SET_ITEM(__pyx_7, 1, __pyx_int_0);
-    PyList_SET_ITEM(__pyx_7, 2, __pyx_2);
-    __pyx_1 = 0;
-    __pyx_2 = 0;
-    __pyx_3 = __Pyx_GetItemInt(__pyx_v_r, 1, 0); if (!__pyx_3) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 75; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __pyx_1 = PyNumber_Negative(__pyx_3); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 75; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_DECREF(__pyx_3); __pyx_3 = 0;
-    __pyx_2 = __Pyx_GetItemInt(__pyx_v_r, 0, 0); if (!__pyx_2) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 75; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __pyx_3 = PyList_New(3); if (unlikely(!__pyx_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 75; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    PyList_SET_ITEM(__pyx_3, 0, __pyx_1);
-    PyList_SET_ITEM(__pyx_3, 1, __pyx_2);
-    Py_INCREF(__pyx_int_0);
-    PyList_SET_ITEM(__pyx_3, 2, __pyx_int_0);
-    __pyx_1 = 0;
-    __pyx_2 = 0;
-    __pyx_1 = PyList_New(3); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 75; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    PyList_SET_ITEM(__pyx_1, 0, ((PyObject *)__pyx_8));
-    PyList_SET_ITEM(__pyx_1, 1, ((PyObject *)__pyx_7));
-    PyList_SET_ITEM(__pyx_1, 2, ((PyObject *)__pyx_3));
-    __pyx_8 = 0;
-    __pyx_7 = 0;
-    __pyx_3 = 0;
-    __pyx_2 = PyTuple_New(1); if (unlikely(!__pyx_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 75; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    PyTuple_SET_ITEM(__pyx_2, 0, ((PyObject *)__pyx_1));
-    __pyx_1 = 0;
-    __pyx_8 = PyObject_Call(__pyx_6, ((PyObject *)__pyx_2), NULL); if (unlikely(!__pyx_8)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 75; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_DECREF(__pyx_6); __pyx_6 = 0;
-    Py_DECREF(((PyObject *)__pyx_2)); __pyx_2 = 0;
-    Py_DECREF(__pyx_v_Sr);
-    __pyx_v_Sr = __pyx_8;
-    __pyx_8 = 0;
-
-    /* "/volatile/roche/bzr/nipy/fff2/fff2/registration/_transform_affine.pyx":76
- *     else:
- *         Sr = np.array([[0,-r[2],r[1]],[r[2],0,-r[0]],[-r[1],r[0],0]])
- *         theta2 = theta*theta             # <<<<<<<<<<<<<<
- *         R = np.eye(3) + (1-theta2/6.)*Sr + (.5-theta2/24.)*np.dot(Sr,Sr)
- *     return R
- */
-    __pyx_v_theta2 = (__pyx_v_theta * __pyx_v_theta);
-
-    /* "/volatile/roche/bzr/nipy/fff2/fff2/registration/_transform_affine.pyx":77
- *         Sr = np.array([[0,-r[2],r[1]],[r[2],0,-r[0]],[-r[1],r[0],0]])
- *         theta2 = theta*theta
- *         R = np.eye(3) + (1-theta2/6.)*Sr + (.5-theta2/24.)*np.dot(Sr,Sr)             # <<<<<<<<<<<<<<
- *     return R
- * 
- */
-    __pyx_7 = __Pyx_GetName(__pyx_m, __pyx_kp_np); if (unlikely(!__pyx_7)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 77; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __pyx_3 = PyObject_GetAttr(__pyx_7, __pyx_kp_eye); if (unlikely(!__pyx_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 77; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_DECREF(__pyx_7); __pyx_7 = 0;
-    __pyx_1 = PyTuple_New(1); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 77; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_INCREF(__pyx_int_3);
-    PyTuple_SET_ITEM(__pyx_1, 0, __pyx_int_3);
-    __pyx_6 = PyObject_Call(__pyx_3, ((PyObject *)__pyx_1), NULL); if (unlikely(!__pyx_6)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 77; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_DECREF(__pyx_3); __pyx_3 = 0;
-    Py_DECREF(((PyObject *)__pyx_1)); __pyx_1 = 0;
-    __pyx_2 = PyFloat_FromDouble((1 - (__pyx_v_theta2 / 6.))); if (unlikely(!__pyx_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 77; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __pyx_8 = PyNumber_Multiply(__pyx_2, __pyx_v_Sr); if (unlikely(!__pyx_8)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 77; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_DECREF(__pyx_2); __pyx_2 = 0;
-    __pyx_7 = PyNumber_Add(__pyx_6, __pyx_8); if (unlikely(!__pyx_7)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 77; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_DECREF(__pyx_6); __pyx_6 = 0;
-    Py_DECREF(__pyx_8); __pyx_8 = 0;
-    __pyx_3 = PyFloat_FromDouble((.5 - (__pyx_v_theta2 / 24.))); if (unlikely(!__pyx_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 77; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __pyx_1 = __Pyx_GetName(__pyx_m, __pyx_kp_np); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 77; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __pyx_2 = PyObject_GetAttr(__pyx_1, __pyx_kp_dot); if (unlikely(!__pyx_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 77; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_DECREF(__pyx_1); __pyx_1 = 0;
-    __pyx_6 = PyTuple_New(2); if (unlikely(!__pyx_6)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 77; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_INCREF(__pyx_v_Sr);
-    PyTuple_SET_ITEM(__pyx_6, 0, __pyx_v_Sr);
-    Py_INCREF(__pyx_v_Sr);
-    PyTuple_SET_ITEM(__pyx_6, 1, __pyx_v_Sr);
-    __pyx_8 = PyObject_Call(__pyx_2, ((PyObject *)__pyx_6), NULL); if (unlikely(!__pyx_8)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 77; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_DECREF(__pyx_2); __pyx_2 = 0;
-    Py_DECREF(((PyObject *)__pyx_6)); __pyx_6 = 0;
-    __pyx_1 = PyNumber_Multiply(__pyx_3, __pyx_8); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 77; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_DECREF(__pyx_3); __pyx_3 = 0;
-    Py_DECREF(__pyx_8); __pyx_8 = 0;
-    __pyx_2 = PyNumber_Add(__pyx_7, __pyx_1); if (unlikely(!__pyx_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 77; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_DECREF(__pyx_7); __pyx_7 = 0;
-    Py_DECREF(__pyx_1); __pyx_1 = 0;
-    Py_DECREF(__pyx_v_R);
-    __pyx_v_R = __pyx_2;
-    __pyx_2 = 0;
-  }
-  __pyx_L5:;
-
-  /* "/volatile/roche/bzr/nipy/fff2/fff2/registration/_transform_affine.pyx":78
- *         theta2 = theta*theta
- *         R = np.eye(3) + (1-theta2/6.)*Sr + (.5-theta2/24.)*np.dot(Sr,Sr)
- *     return R             # <<<<<<<<<<<<<<
- * 
- * 
- */
-  Py_INCREF(__pyx_v_R);
-  __pyx_r = __pyx_v_R;
-  goto __pyx_L0;
-
-  __pyx_r = Py_None; Py_INCREF(Py_None);
-  goto __pyx_L0;
-  __pyx_L1_error:;
-  Py_XDECREF(__pyx_1);
-  Py_XDECREF(__pyx_2);
-  Py_XDECREF(__pyx_3);
-  Py_XDECREF(__pyx_6);
-  Py_XDECREF(__pyx_7);
-  Py_XDECREF(__pyx_8);
-  __Pyx_AddTraceback("fff2.registration._transform_affine.rvector_to_matrix");
-  __pyx_r = NULL;
-  __pyx_L0:;
-  Py_DECREF(__pyx_v_n);
-  Py_DECREF(__pyx_v_Sn);
-  Py_DECREF(__pyx_v_R);
-  Py_DECREF(__pyx_v_Sr);
-  return __pyx_r;
-}
-
-/* "/volatile/roche/bzr/nipy/fff2/fff2/registration/_transform_affine.pyx":82
- * 
- * 
- * def param_to_vector12(ndarray param, ndarray t0, ndarray precond, int stamp=AFFINE3D):             # <<<<<<<<<<<<<<
- *     """
- *     t = param_to_vector12(p, t, precond, stamp=AFFINE3D).
- */
-
-static PyObject *__pyx_pf_4fff2_12registration_17_transform_affine_param_to_vector12(PyObject *__pyx_self, PyObject *__pyx_args, PyObject *__pyx_kwds); /*proto*/
-static char __pyx_doc_4fff2_12registration_17_transform_affine_param_to_vector12[] = "\n    t = param_to_vector12(p, t, precond, stamp=AFFINE3D).\n\n    In-place modification of t. \n\n    p is a 1d-array of affine transformation parameters with size\n    dependent on the transformation type, which is coded by the\n    integer stamp.\n    ";
-static PyObject *__pyx_pf_4fff2_12registration_17_transform_affine_param_to_vector12(PyObject *__pyx_self, PyObject *__pyx_args, PyObject *__pyx_kwds) {
-  PyArrayObject *__pyx_v_param = 0;
-  PyArrayObject *__pyx_v_t0 = 0;
-  PyArrayObject *__pyx_v_precond = 0;
-  int __pyx_v_stamp;
-  PyObject *__pyx_v_t;
-  PyObject *__pyx_r;
-  int __pyx_1;
-  PyObject *__pyx_2 = 0;
-  PyObject *__pyx_3 = 0;
-  PyObject *__pyx_4 = 0;
-  static char *__pyx_argnames[] = {"param","t0","precond","stamp",0};
-  __pyx_self = __pyx_self;
-  __pyx_v_stamp = __pyx_k_9;
-  if (likely(!__pyx_kwds) && likely(3 <= PyTuple_GET_SIZE(__pyx_args)) && likely(PyTuple_GET_SIZE(__pyx_args) <= 4)) {
-    __pyx_v_param = ((PyArrayObject *)PyTuple_GET_ITEM(__pyx_args, 0));
-    __pyx_v_t0 = ((PyArrayObject *)PyTuple_GET_ITEM(__pyx_args, 1));
-    __pyx_v_precond = ((PyArrayObject *)PyTuple_GET_ITEM(__pyx_args, 2));
-    if (PyTuple_GET_SIZE(__pyx_args) > 3) {
-      __pyx_v_stamp = __pyx_PyInt_int(PyTuple_GET_ITEM(__pyx_args, 3)); if (unlikely((__pyx_v_stamp == (int)-1) && PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 82; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-    }
-  }
-  else {
-    if (unlikely(!PyArg_ParseTupleAndKeywords(__pyx_args, __pyx_kwds, "OOO|i", __pyx_argnames, &__pyx_v_param, &__pyx_v_t0, &__pyx_v_precond, &__pyx_v_stamp))) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 82; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-  }
-  goto __pyx_L4;
-  __pyx_L3_error:;
-  __Pyx_AddTraceback("fff2.registration._transform_affine.param_to_vector12");
-  return NULL;
-  __pyx_L4:;
-  __pyx_v_t = Py_None; Py_INCREF(Py_None);
-  if (unlikely(!__Pyx_ArgTypeTest(((PyObject *)__pyx_v_param), __pyx_ptype_4fff2_12registration_17_transform_affine_ndarray, 1, "param", 0))) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 82; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  if (unlikely(!__Pyx_ArgTypeTest(((PyObject *)__pyx_v_t0), __pyx_ptype_4fff2_12registration_17_transform_affine_ndarray, 1, "t0", 0))) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 82; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  if (unlikely(!__Pyx_ArgTypeTest(((PyObject *)__pyx_v_precond), __pyx_ptype_4fff2_12registration_17_transform_affine_ndarray, 1, "precond", 0))) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 82; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-
-  /* "/volatile/roche/bzr/nipy/fff2/fff2/registration/_transform_affine.pyx":92
- *     integer stamp.
- *     """
- *     t = t0             # <<<<<<<<<<<<<<
- * 
- *     # Switch on transformation type
- */
-  Py_INCREF(((PyObject *)__pyx_v_t0));
-  Py_DECREF(__pyx_v_t);
-  __pyx_v_t = ((PyObject *)__pyx_v_t0);
-
-  /* "/volatile/roche/bzr/nipy/fff2/fff2/registration/_transform_affine.pyx":95
- * 
- *     # Switch on transformation type
- *     if stamp == RIGID3D:             # <<<<<<<<<<<<<<
- *         t[0:6] = param*precond[0:6]
- *     elif stamp == SIMILARITY3D:
- */
-  __pyx_1 = (__pyx_v_stamp == __pyx_e_4fff2_12registration_17_transform_affine_RIGID3D);
-  if (__pyx_1) {
-
-    /* "/volatile/roche/bzr/nipy/fff2/fff2/registration/_transform_affine.pyx":96
- *     # Switch on transformation type
- *     if stamp == RIGID3D:
- *         t[0:6] = param*precond[0:6]             # <<<<<<<<<<<<<<
- *     elif stamp == SIMILARITY3D:
- *         t[0:9] = param[[0,1,2,3,4,5,6,6,6]]*precond[0:9]
- */
-    __pyx_2 = PySequence_GetSlice(((PyObject *)__pyx_v_precond), 0, 6); if (unlikely(!__pyx_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 96; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __pyx_3 = PyNumber_Multiply(((PyObject *)__pyx_v_param), __pyx_2); if (unlikely(!__pyx_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 96; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_DECREF(__pyx_2); __pyx_2 = 0;
-    if (PySequence_SetSlice(__pyx_v_t, 0, 6, __pyx_3) < 0) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 96; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_DECREF(__pyx_3); __pyx_3 = 0;
-    goto __pyx_L5;
-  }
-
-  /* "/volatile/roche/bzr/nipy/fff2/fff2/registration/_transform_affine.pyx":97
- *     if stamp == RIGID3D:
- *         t[0:6] = param*precond[0:6]
- *     elif stamp == SIMILARITY3D:             # <<<<<<<<<<<<<<
- *         t[0:9] = param[[0,1,2,3,4,5,6,6,6]]*precond[0:9]
- *     elif stamp == AFFINE3D:
- */
-  __pyx_1 = (__pyx_v_stamp == __pyx_e_4fff2_12registration_17_transform_affine_SIMILARITY3D);
-  if (__pyx_1) {
-
-    /* "/volatile/roche/bzr/nipy/fff2/fff2/registration/_transform_affine.pyx":98
- *         t[0:6] = param*precond[0:6]
- *     elif stamp == SIMILARITY3D:
- *         t[0:9] = param[[0,1,2,3,4,5,6,6,6]]*precond[0:9]             # <<<<<<<<<<<<<<
- *     elif stamp == AFFINE3D:
- *         t = param*precond
- */
-    __pyx_2 = PyList_New(9); if (unlikely(!__pyx_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 98; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_INCREF(__pyx_int_0);
-    PyList_SET_ITEM(__pyx_2, 0, __pyx_int_0);
-    Py_INCREF(__pyx_int_1);
-    PyList_SET_ITEM(__pyx_2, 1, __pyx_int_1);
-    Py_INCREF(__pyx_int_2);
-    PyList_SET_ITEM(__pyx_2, 2, __pyx_int_2);
-    Py_INCREF(__pyx_int_3);
-    PyList_SET_ITEM(__pyx_2, 3, __pyx_int_3);
-    Py_INCREF(__pyx_int_4);
-    PyList_SET_ITEM(__pyx_2, 4, __pyx_int_4);
-    Py_INCREF(__pyx_int_5);
-    PyList_SET_ITEM(__pyx_2, 5, __pyx_int_5);
-    Py_INCREF(__pyx_int_6);
-    PyList_SET_ITEM(__pyx_2, 6, __pyx_int_6);
-    Py_INCREF(__pyx_int_6);
-    PyList_SET_ITEM(__pyx_2, 7, __pyx_int_6);
-    Py_INCREF(__pyx_int_6);
-    PyList_SET_ITEM(__pyx_2, 8, __pyx_int_6);
-    __pyx_3 = PyObject_GetItem(((PyObject *)__pyx_v_param), ((PyObject *)__pyx_2)); if (!__pyx_3) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 98; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_DECREF(((PyObject *)__pyx_2)); __pyx_2 = 0;
-    __pyx_2 = PySequence_GetSlice(((PyObject *)__pyx_v_precond), 0, 9); if (unlikely(!__pyx_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 98; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __pyx_4 = PyNumber_Multiply(__pyx_3, __pyx_2); if (unlikely(!__pyx_4)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 98; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_DECREF(__pyx_3); __pyx_3 = 0;
-    Py_DECREF(__pyx_2); __pyx_2 = 0;
-    if (PySequence_SetSlice(__pyx_v_t, 0, 9, __pyx_4) < 0) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 98; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_DECREF(__pyx_4); __pyx_4 = 0;
-    goto __pyx_L5;
-  }
-
-  /* "/volatile/roche/bzr/nipy/fff2/fff2/registration/_transform_affine.pyx":99
- *     elif stamp == SIMILARITY3D:
- *         t[0:9] = param[[0,1,2,3,4,5,6,6,6]]*precond[0:9]
- *     elif stamp == AFFINE3D:             # <<<<<<<<<<<<<<
- *         t = param*precond
- *     elif stamp == RIGID2D:
- */
-  __pyx_1 = (__pyx_v_stamp == __pyx_e_4fff2_12registration_17_transform_affine_AFFINE3D);
-  if (__pyx_1) {
-
-    /* "/volatile/roche/bzr/nipy/fff2/fff2/registration/_transform_affine.pyx":100
- *         t[0:9] = param[[0,1,2,3,4,5,6,6,6]]*precond[0:9]
- *     elif stamp == AFFINE3D:
- *         t = param*precond             # <<<<<<<<<<<<<<
- *     elif stamp == RIGID2D:
- *         t[[0,1,5]] = param*precond[[0,1,5]]
- */
-    __pyx_3 = PyNumber_Multiply(((PyObject *)__pyx_v_param), ((PyObject *)__pyx_v_precond)); if (unlikely(!__pyx_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 100; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_DECREF(__pyx_v_t);
-    __pyx_v_t = __pyx_3;
-    __pyx_3 = 0;
-    goto __pyx_L5;
-  }
-
-  /* "/volatile/roche/bzr/nipy/fff2/fff2/registration/_transform_affine.pyx":101
- *     elif stamp == AFFINE3D:
- *         t = param*precond
- *     elif stamp == RIGID2D:             # <<<<<<<<<<<<<<
- *         t[[0,1,5]] = param*precond[[0,1,5]]
- *     elif stamp == SIMILARITY2D:
- */
-  __pyx_1 = (__pyx_v_stamp == __pyx_e_4fff2_12registration_17_transform_affine_RIGID2D);
-  if (__pyx_1) {
-
-    /* "/volatile/roche/bzr/nipy/fff2/fff2/registration/_transform_affine.pyx":102
- *         t = param*precond
- *     elif stamp == RIGID2D:
- *         t[[0,1,5]] = param*precond[[0,1,5]]             # <<<<<<<<<<<<<<
- *     elif stamp == SIMILARITY2D:
- *         t[[0,1,5,6,7]] = param[[0,1,2,3,3]]*precond[[0,1,5,6,7]]
- */
-    __pyx_2 = PyList_New(3); if (unlikely(!__pyx_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 102; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_INCREF(__pyx_int_0);
-    PyList_SET_ITEM(__pyx_2, 0, __pyx_int_0);
-    Py_INCREF(__pyx_int_1);
-    PyList_SET_ITEM(__pyx_2, 1, __pyx_int_1);
-    Py_INCREF(__pyx_int_5);
-    PyList_SET_ITEM(__pyx_2, 2, __pyx_int_5);
-    __pyx_4 = PyObject_GetItem(((PyObject *)__pyx_v_precond), ((PyObject *)__pyx_2)); if (!__pyx_4) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 102; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_DECREF(((PyObject *)__pyx_2)); __pyx_2 = 0;
-    __pyx_3 = PyNumber_Multiply(((PyObject *)__pyx_v_param), __pyx_4); if (unlikely(!__pyx_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 102; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_DECREF(__pyx_4); __pyx_4 = 0;
-    __pyx_2 = PyList_New(3); if (unlikely(!__pyx_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 102; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_INCREF(__pyx_int_0);
-    PyList_SET_ITEM(__pyx_2, 0, __pyx_int_0);
-    Py_INCREF(__pyx_int_1);
-    PyList_SET_ITEM(__pyx_2, 1, __pyx_int_1);
-    Py_INCREF(__pyx_int_5);
-    PyList_SET_ITEM(__pyx_2, 2, __pyx_int_5);
-    if (PyObject_SetItem(__pyx_v_t, ((PyObject *)__pyx_2), __pyx_3) < 0) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 102; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_DECREF(((PyObject *)__pyx_2)); __pyx_2 = 0;
-    Py_DECREF(__pyx_3); __pyx_3 = 0;
-    goto __pyx_L5;
-  }
-
-  /* "/volatile/roche/bzr/nipy/fff2/fff2/registration/_transform_affine.pyx":103
- *     elif stamp == RIGID2D:
- *         t[[0,1,5]] = param*precond[[0,1,5]]
- *     elif stamp == SIMILARITY2D:             # <<<<<<<<<<<<<<
- *         t[[0,1,5,6,7]] = param[[0,1,2,3,3]]*precond[[0,1,5,6,7]]
- *     elif stamp == AFFINE2D:
- */
-  __pyx_1 = (__pyx_v_stamp == __pyx_e_4fff2_12registration_17_transform_affine_SIMILARITY2D);
-  if (__pyx_1) {
-
-    /* "/volatile/roche/bzr/nipy/fff2/fff2/registration/_transform_affine.pyx":104
- *         t[[0,1,5]] = param*precond[[0,1,5]]
- *     elif stamp == SIMILARITY2D:
- *         t[[0,1,5,6,7]] = param[[0,1,2,3,3]]*precond[[0,1,5,6,7]]             # <<<<<<<<<<<<<<
- *     elif stamp == AFFINE2D:
- *         t[[0,1,5,6,7,11]] = param*precond[[0,1,5,6,7,11]]
- */
-    __pyx_4 = PyList_New(5); if (unlikely(!__pyx_4)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 104; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_INCREF(__pyx_int_0);
-    PyList_SET_ITEM(__pyx_4, 0, __pyx_int_0);
-    Py_INCREF(__pyx_int_1);
-    PyList_SET_ITEM(__pyx_4, 1, __pyx_int_1);
-    Py_INCREF(__pyx_int_2);
-    PyList_SET_ITEM(__pyx_4, 2, __pyx_int_2);
-    Py_INCREF(__pyx_int_3);
-    PyList_SET_ITEM(__pyx_4, 3, __pyx_int_3);
-    Py_INCREF(__pyx_int_3);
-    PyList_SET_ITEM(__pyx_4, 4, __pyx_int_3);
-    __pyx_3 = PyObject_GetItem(((PyObject *)__pyx_v_param), ((PyObject *)__pyx_4)); if (!__pyx_3) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 104; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_DECREF(((PyObject *)__pyx_4)); __pyx_4 = 0;
-    __pyx_2 = PyList_New(5); if (unlikely(!__pyx_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 104; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_INCREF(__pyx_int_0);
-    PyList_SET_ITEM(__pyx_2, 0, __pyx_int_0);
-    Py_INCREF(__pyx_int_1);
-    PyList_SET_ITEM(__pyx_2, 1, __pyx_int_1);
-    Py_INCREF(__pyx_int_5);
-    PyList_SET_ITEM(__pyx_2, 2, __pyx_int_5);
-    Py_INCREF(__pyx_int_6);
-    PyList_SET_ITEM(__pyx_2, 3, __pyx_int_6);
-    Py_INCREF(__pyx_int_7);
-    PyList_SET_ITEM(__pyx_2, 4, __pyx_int_7);
-    __pyx_4 = PyObject_GetItem(((PyObject *)__pyx_v_precond), ((PyObject *)__pyx_2)); if (!__pyx_4) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 104; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_DECREF(((PyObject *)__pyx_2)); __pyx_2 = 0;
-    __pyx_2 = PyNumber_Multiply(__pyx_3, __pyx_4); if (unlikely(!__pyx_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 104; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_DECREF(__pyx_3); __pyx_3 = 0;
-    Py_DECREF(__pyx_4); __pyx_4 = 0;
-    __pyx_3 = PyList_New(5); if (unlikely(!__pyx_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 104; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_INCREF(__pyx_int_0);
-    PyList_SET_ITEM(__pyx_3, 0, __pyx_int_0);
-    Py_INCREF(__pyx_int_1);
-    PyList_SET_ITEM(__pyx_3, 1, __pyx_int_1);
-    Py_INCREF(__pyx_int_5);
-    PyList_SET_ITEM(__pyx_3, 2, __pyx_int_5);
-    Py_INCREF(__pyx_int_6);
-    PyList_SET_ITEM(__pyx_3, 3, __pyx_int_6);
-    Py_INCREF(__pyx_int_7);
-    PyList_SET_ITEM(__pyx_3, 4, __pyx_int_7);
-    if (PyObject_SetItem(__pyx_v_t, ((PyObject *)__pyx_3), __pyx_2) < 0) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 104; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_DECREF(((PyObject *)__pyx_3)); __pyx_3 = 0;
-    Py_DECREF(__pyx_2); __pyx_2 = 0;
-    goto __pyx_L5;
-  }
-
-  /* "/volatile/roche/bzr/nipy/fff2/fff2/registration/_transform_affine.pyx":105
- *     elif stamp == SIMILARITY2D:
- *         t[[0,1,5,6,7]] = param[[0,1,2,3,3]]*precond[[0,1,5,6,7]]
- *     elif stamp == AFFINE2D:             # <<<<<<<<<<<<<<
- *         t[[0,1,5,6,7,11]] = param*precond[[0,1,5,6,7,11]]
- * 
- */
-  __pyx_1 = (__pyx_v_stamp == __pyx_e_4fff2_12registration_17_transform_affine_AFFINE2D);
-  if (__pyx_1) {
-
-    /* "/volatile/roche/bzr/nipy/fff2/fff2/registration/_transform_affine.pyx":106
- *         t[[0,1,5,6,7]] = param[[0,1,2,3,3]]*precond[[0,1,5,6,7]]
- *     elif stamp == AFFINE2D:
- *         t[[0,1,5,6,7,11]] = param*precond[[0,1,5,6,7,11]]             # <<<<<<<<<<<<<<
- * 
- *     return t
- */
-    __pyx_4 = PyList_New(6); if (unlikely(!__pyx_4)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 106; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_INCREF(__pyx_int_0);
-    PyList_SET_ITEM(__pyx_4, 0, __pyx_int_0);
-    Py_INCREF(__pyx_int_1);
-    PyList_SET_ITEM(__pyx_4, 1, __pyx_int_1);
-    Py_INCREF(__pyx_int_5);
-    PyList_SET_ITEM(__pyx_4, 2, __pyx_int_5);
-    Py_INCREF(__pyx_int_6);
-    PyList_SET_ITEM(__pyx_4, 3, __pyx_int_6);
-    Py_INCREF(__pyx_int_7);
-    PyList_SET_ITEM(__pyx_4, 4, __pyx_int_7);
-    Py_INCREF(__pyx_int_11);
-    PyList_SET_ITEM(__pyx_4, 5, __pyx_int_11);
-    __pyx_2 = PyObject_GetItem(((PyObject *)__pyx_v_precond), ((PyObject *)__pyx_4)); if (!__pyx_2) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 106; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_DECREF(((PyObject *)__pyx_4)); __pyx_4 = 0;
-    __pyx_3 = PyNumber_Multiply(((PyObject *)__pyx_v_param), __pyx_2); if (unlikely(!__pyx_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 106; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_DECREF(__pyx_2); __pyx_2 = 0;
-    __pyx_4 = PyList_New(6); if (unlikely(!__pyx_4)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 106; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_INCREF(__pyx_int_0);
-    PyList_SET_ITEM(__pyx_4, 0, __pyx_int_0);
-    Py_INCREF(__pyx_int_1);
-    PyList_SET_ITEM(__pyx_4, 1, __pyx_int_1);
-    Py_INCREF(__pyx_int_5);
-    PyList_SET_ITEM(__pyx_4, 2, __pyx_int_5);
-    Py_INCREF(__pyx_int_6);
-    PyList_SET_ITEM(__pyx_4, 3, __pyx_int_6);
-    Py_INCREF(__pyx_int_7);
-    PyList_SET_ITEM(__pyx_4, 4, __pyx_int_7);
-    Py_INCREF(__pyx_int_11);
-    PyList_SET_ITEM(__pyx_4, 5, __pyx_int_11);
-    if (PyObject_SetItem(__pyx_v_t, ((PyObject *)__pyx_4), __pyx_3) < 0) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 106; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_DECREF(((PyObject *)__pyx_4)); __pyx_4 = 0;
-    Py_DECREF(__pyx_3); __pyx_3 = 0;
-    goto __pyx_L5;
-  }
-  __pyx_L5:;
-
-  /* "/volatile/roche/bzr/nipy/fff2/fff2/registration/_transform_affine.pyx":108
- *         t[[0,1,5,6,7,11]] = param*precond[[0,1,5,6,7,11]]
- * 
- *     return t             # <<<<<<<<<<<<<<
- * 
- * 
- */
-  Py_INCREF(__pyx_v_t);
-  __pyx_r = __pyx_v_t;
-  goto __pyx_L0;
-
-  __pyx_r = Py_None; Py_INCREF(Py_None);
-  goto __pyx_L0;
-  __pyx_L1_error:;
-  Py_XDECREF(__pyx_2);
-  Py_XDECREF(__pyx_3);
-  Py_XDECREF(__pyx_4);
-  __Pyx_AddTraceback("fff2.registration._transform_affine.param_to_vector12");
-  __pyx_r = NULL;
-  __pyx_L0:;
-  Py_DECREF(__pyx_v_t);
-  return __pyx_r;
-}
-
-/* "/volatile/roche/bzr/nipy/fff2/fff2/registration/_transform_affine.pyx":111
- * 
- * 
- * def matrix44(ndarray t):             # <<<<<<<<<<<<<<
- *     """
- *     T = matrix44(t)
- */
-
-static PyObject *__pyx_pf_4fff2_12registration_17_transform_affine_matrix44(PyObject *__pyx_self, PyObject *__pyx_v_t); /*proto*/
-static char __pyx_doc_4fff2_12registration_17_transform_affine_matrix44[] = "\n    T = matrix44(t)\n\n    t is a vector of of affine transformation parameters with size at\n    least 6.\n\n    size < 6 ==> error\n    size == 6 ==> t is interpreted as translation + rotation\n    size == 7 ==> t is interpreted as translation + rotation + isotropic scaling\n    7 < size < 12 ==> error\n    size >= 12 ==> t is interpreted as translation + rotation + scaling + shearing \n    ";
-static PyObject *__pyx_pf_4fff2_12registration_17_transform_affine_matrix44(PyObject *__pyx_self, PyObject *__pyx_v_t) {
-  int __pyx_v_size;
-  PyObject *__pyx_v_T;
-  PyObject *__pyx_v_R;
-  PyObject *__pyx_v_S;
-  PyObject *__pyx_v_Q;
-  PyObject *__pyx_r;
-  PyObject *__pyx_1 = 0;
-  PyObject *__pyx_2 = 0;
-  PyObject *__pyx_3 = 0;
-  int __pyx_4;
-  PyObject *__pyx_5 = 0;
-  __pyx_self = __pyx_self;
-  __pyx_v_T = Py_None; Py_INCREF(Py_None);
-  __pyx_v_R = Py_None; Py_INCREF(Py_None);
-  __pyx_v_S = Py_None; Py_INCREF(Py_None);
-  __pyx_v_Q = Py_None; Py_INCREF(Py_None);
-  if (unlikely(!__Pyx_ArgTypeTest(((PyObject *)__pyx_v_t), __pyx_ptype_4fff2_12registration_17_transform_affine_ndarray, 1, "t", 0))) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 111; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-
-  /* "/volatile/roche/bzr/nipy/fff2/fff2/registration/_transform_affine.pyx":126
- *     cdef int size
- * 
- *     size = <int>PyArray_SIZE(t)             # <<<<<<<<<<<<<<
- * 
- *     T = np.eye(4)
- */
-  __pyx_v_size = ((int)PyArray_SIZE(((PyArrayObject *)__pyx_v_t)));
-
-  /* "/volatile/roche/bzr/nipy/fff2/fff2/registration/_transform_affine.pyx":128
- *     size = <int>PyArray_SIZE(t)
- * 
- *     T = np.eye(4)             # <<<<<<<<<<<<<<
- *     R = rvector_to_matrix(t[3:6])
- *     if size == 6:
- */
-  __pyx_1 = __Pyx_GetName(__pyx_m, __pyx_kp_np); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 128; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __pyx_2 = PyObject_GetAttr(__pyx_1, __pyx_kp_eye); if (unlikely(!__pyx_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 128; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_DECREF(__pyx_1); __pyx_1 = 0;
-  __pyx_1 = PyTuple_New(1); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 128; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_INCREF(__pyx_int_4);
-  PyTuple_SET_ITEM(__pyx_1, 0, __pyx_int_4);
-  __pyx_3 = PyObject_Call(__pyx_2, ((PyObject *)__pyx_1), NULL); if (unlikely(!__pyx_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 128; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_DECREF(__pyx_2); __pyx_2 = 0;
-  Py_DECREF(((PyObject *)__pyx_1)); __pyx_1 = 0;
-  Py_DECREF(__pyx_v_T);
-  __pyx_v_T = __pyx_3;
-  __pyx_3 = 0;
-
-  /* "/volatile/roche/bzr/nipy/fff2/fff2/registration/_transform_affine.pyx":129
- * 
- *     T = np.eye(4)
- *     R = rvector_to_matrix(t[3:6])             # <<<<<<<<<<<<<<
- *     if size == 6:
- *         T[0:3,0:3] = R
- */
-  __pyx_2 = __Pyx_GetName(__pyx_m, __pyx_kp_rvector_to_matrix); if (unlikely(!__pyx_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 129; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __pyx_1 = PySequence_GetSlice(__pyx_v_t, 3, 6); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 129; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __pyx_3 = PyTuple_New(1); if (unlikely(!__pyx_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 129; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  PyTuple_SET_ITEM(__pyx_3, 0, __pyx_1);
-  __pyx_1 = 0;
-  __pyx_1 = PyObject_Call(__pyx_2, ((PyObject *)__pyx_3), NULL); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 129; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_DECREF(__pyx_2); __pyx_2 = 0;
-  Py_DECREF(((PyObject *)__pyx_3)); __pyx_3 = 0;
-  Py_DECREF(__pyx_v_R);
-  __pyx_v_R = __pyx_1;
-  __pyx_1 = 0;
-
-  /* "/volatile/roche/bzr/nipy/fff2/fff2/registration/_transform_affine.pyx":130
- *     T = np.eye(4)
- *     R = rvector_to_matrix(t[3:6])
- *     if size == 6:             # <<<<<<<<<<<<<<
- *         T[0:3,0:3] = R
- *     elif size == 7:
- */
-  __pyx_4 = (__pyx_v_size == 6);
-  if (__pyx_4) {
-
-    /* "/volatile/roche/bzr/nipy/fff2/fff2/registration/_transform_affine.pyx":131
- *     R = rvector_to_matrix(t[3:6])
- *     if size == 6:
- *         T[0:3,0:3] = R             # <<<<<<<<<<<<<<
- *     elif size == 7:
- *         T[0:3,0:3] = t[6]*R
- */
-    __pyx_2 = PySlice_New(__pyx_int_0, __pyx_int_3, Py_None); if (unlikely(!__pyx_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 131; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __pyx_3 = PySlice_New(__pyx_int_0, __pyx_int_3, Py_None); if (unlikely(!__pyx_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 131; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __pyx_1 = PyTuple_New(2); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 131; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    PyTuple_SET_ITEM(__pyx_1, 0, __pyx_2);
-    PyTuple_SET_ITEM(__pyx_1, 1, __pyx_3);
-    __pyx_2 = 0;
-    __pyx_3 = 0;
-    if (PyObject_SetItem(__pyx_v_T, ((PyObject *)__pyx_1), __pyx_v_R) < 0) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 131; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_DECREF(((PyObject *)__pyx_1)); __pyx_1 = 0;
-    goto __pyx_L5;
-  }
-
-  /* "/volatile/roche/bzr/nipy/fff2/fff2/registration/_transform_affine.pyx":132
- *     if size == 6:
- *         T[0:3,0:3] = R
- *     elif size == 7:             # <<<<<<<<<<<<<<
- *         T[0:3,0:3] = t[6]*R
- *     else:
- */
-  __pyx_4 = (__pyx_v_size == 7);
-  if (__pyx_4) {
-
-    /* "/volatile/roche/bzr/nipy/fff2/fff2/registration/_transform_affine.pyx":133
- *         T[0:3,0:3] = R
- *     elif size == 7:
- *         T[0:3,0:3] = t[6]*R             # <<<<<<<<<<<<<<
- *     else:
- *         S = np.diag(t[6:9])
- */
-    __pyx_2 = __Pyx_GetItemInt(__pyx_v_t, 6, 0); if (!__pyx_2) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 133; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __pyx_3 = PyNumber_Multiply(__pyx_2, __pyx_v_R); if (unlikely(!__pyx_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 133; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_DECREF(__pyx_2); __pyx_2 = 0;
-    __pyx_1 = PySlice_New(__pyx_int_0, __pyx_int_3, Py_None); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 133; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __pyx_2 = PySlice_New(__pyx_int_0, __pyx_int_3, Py_None); if (unlikely(!__pyx_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 133; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __pyx_5 = PyTuple_New(2); if (unlikely(!__pyx_5)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 133; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    PyTuple_SET_ITEM(__pyx_5, 0, __pyx_1);
-    PyTuple_SET_ITEM(__pyx_5, 1, __pyx_2);
-    __pyx_1 = 0;
-    __pyx_2 = 0;
-    if (PyObject_SetItem(__pyx_v_T, ((PyObject *)__pyx_5), __pyx_3) < 0) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 133; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_DECREF(((PyObject *)__pyx_5)); __pyx_5 = 0;
-    Py_DECREF(__pyx_3); __pyx_3 = 0;
-    goto __pyx_L5;
-  }
-  /*else*/ {
-
-    /* "/volatile/roche/bzr/nipy/fff2/fff2/registration/_transform_affine.pyx":135
- *         T[0:3,0:3] = t[6]*R
- *     else:
- *         S = np.diag(t[6:9])             # <<<<<<<<<<<<<<
- *         Q = rvector_to_matrix(t[9:12])
- *         T[0:3,0:3] = np.dot(Q,np.dot(S,R))
- */
-    __pyx_1 = __Pyx_GetName(__pyx_m, __pyx_kp_np); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 135; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __pyx_2 = PyObject_GetAttr(__pyx_1, __pyx_kp_diag); if (unlikely(!__pyx_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 135; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_DECREF(__pyx_1); __pyx_1 = 0;
-    __pyx_3 = PySequence_GetSlice(__pyx_v_t, 6, 9); if (unlikely(!__pyx_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 135; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __pyx_5 = PyTuple_New(1); if (unlikely(!__pyx_5)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 135; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    PyTuple_SET_ITEM(__pyx_5, 0, __pyx_3);
-    __pyx_3 = 0;
-    __pyx_1 = PyObject_Call(__pyx_2, ((PyObject *)__pyx_5), NULL); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 135; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_DECREF(__pyx_2); __pyx_2 = 0;
-    Py_DECREF(((PyObject *)__pyx_5)); __pyx_5 = 0;
-    Py_DECREF(__pyx_v_S);
-    __pyx_v_S = __pyx_1;
-    __pyx_1 = 0;
-
-    /* "/volatile/roche/bzr/nipy/fff2/fff2/registration/_transform_affine.pyx":136
- *     else:
- *         S = np.diag(t[6:9])
- *         Q = rvector_to_matrix(t[9:12])             # <<<<<<<<<<<<<<
- *         T[0:3,0:3] = np.dot(Q,np.dot(S,R))
- *     T[0:3,3] = t[0:3]
- */
-    __pyx_3 = __Pyx_GetName(__pyx_m, __pyx_kp_rvector_to_matrix); if (unlikely(!__pyx_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 136; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __pyx_2 = PySequence_GetSlice(__pyx_v_t, 9, 12); if (unlikely(!__pyx_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 136; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __pyx_5 = PyTuple_New(1); if (unlikely(!__pyx_5)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 136; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    PyTuple_SET_ITEM(__pyx_5, 0, __pyx_2);
-    __pyx_2 = 0;
-    __pyx_1 = PyObject_Call(__pyx_3, ((PyObject *)__pyx_5), NULL); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 136; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_DECREF(__pyx_3); __pyx_3 = 0;
-    Py_DECREF(((PyObject *)__pyx_5)); __pyx_5 = 0;
-    Py_DECREF(__pyx_v_Q);
-    __pyx_v_Q = __pyx_1;
-    __pyx_1 = 0;
-
-    /* "/volatile/roche/bzr/nipy/fff2/fff2/registration/_transform_affine.pyx":137
- *         S = np.diag(t[6:9])
- *         Q = rvector_to_matrix(t[9:12])
- *         T[0:3,0:3] = np.dot(Q,np.dot(S,R))             # <<<<<<<<<<<<<<
- *     T[0:3,3] = t[0:3]
- *     return T
- */
-    __pyx_2 = __Pyx_GetName(__pyx_m, __pyx_kp_np); if (unlikely(!__pyx_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 137; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __pyx_3 = PyObject_GetAttr(__pyx_2, __pyx_kp_dot); if (unlikely(!__pyx_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 137; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_DECREF(__pyx_2); __pyx_2 = 0;
-    __pyx_5 = __Pyx_GetName(__pyx_m, __pyx_kp_np); if (unlikely(!__pyx_5)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 137; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __pyx_1 = PyObject_GetAttr(__pyx_5, __pyx_kp_dot); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 137; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_DECREF(__pyx_5); __pyx_5 = 0;
-    __pyx_2 = PyTuple_New(2); if (unlikely(!__pyx_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 137; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_INCREF(__pyx_v_S);
-    PyTuple_SET_ITEM(__pyx_2, 0, __pyx_v_S);
-    Py_INCREF(__pyx_v_R);
-    PyTuple_SET_ITEM(__pyx_2, 1, __pyx_v_R);
-    __pyx_5 = PyObject_Call(__pyx_1, ((PyObject *)__pyx_2), NULL); if (unlikely(!__pyx_5)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 137; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_DECREF(__pyx_1); __pyx_1 = 0;
-    Py_DECREF(((PyObject *)__pyx_2)); __pyx_2 = 0;
-    __pyx_1 = PyTuple_New(2); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 137; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_INCREF(__pyx_v_Q);
-    PyTuple_SET_ITEM(__pyx_1, 0, __pyx_v_Q);
-    PyTuple_SET_ITEM(__pyx_1, 1, __pyx_5);
-    __pyx_5 = 0;
-    __pyx_2 = PyObject_Call(__pyx_3, ((PyObject *)__pyx_1), NULL); if (unlikely(!__pyx_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 137; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_DECREF(__pyx_3); __pyx_3 = 0;
-    Py_DECREF(((PyObject *)__pyx_1)); __pyx_1 = 0;
-    __pyx_5 = PySlice_New(__pyx_int_0, __pyx_int_3, Py_None); if (unlikely(!__pyx_5)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 137; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __pyx_3 = PySlice_New(__pyx_int_0, __pyx_int_3, Py_None); if (unlikely(!__pyx_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 137; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __pyx_1 = PyTuple_New(2); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 137; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    PyTuple_SET_ITEM(__pyx_1, 0, __pyx_5);
-    PyTuple_SET_ITEM(__pyx_1, 1, __pyx_3);
-    __pyx_5 = 0;
-    __pyx_3 = 0;
-    if (PyObject_SetItem(__pyx_v_T, ((PyObject *)__pyx_1), __pyx_2) < 0) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 137; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_DECREF(((PyObject *)__pyx_1)); __pyx_1 = 0;
-    Py_DECREF(__pyx_2); __pyx_2 = 0;
-  }
-  __pyx_L5:;
-
-  /* "/volatile/roche/bzr/nipy/fff2/fff2/registration/_transform_affine.pyx":138
- *         Q = rvector_to_matrix(t[9:12])
- *         T[0:3,0:3] = np.dot(Q,np.dot(S,R))
- *     T[0:3,3] = t[0:3]             # <<<<<<<<<<<<<<
- *     return T
- * 
- */
-  __pyx_5 = PySequence_GetSlice(__pyx_v_t, 0, 3); if (unlikely(!__pyx_5)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 138; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __pyx_3 = PySlice_New(__pyx_int_0, __pyx_int_3, Py_None); if (unlikely(!__pyx_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 138; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __pyx_2 = PyTuple_New(2); if (unlikely(!__pyx_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 138; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  PyTuple_SET_ITEM(__pyx_2, 0, __pyx_3);
-  Py_INCREF(__pyx_int_3);
-  PyTuple_SET_ITEM(__pyx_2, 1, __pyx_int_3);
-  __pyx_3 = 0;
-  if (PyObject_SetItem(__pyx_v_T, ((PyObject *)__pyx_2), __pyx_5) < 0) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 138; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_DECREF(((PyObject *)__pyx_2)); __pyx_2 = 0;
-  Py_DECREF(__pyx_5); __pyx_5 = 0;
-
-  /* "/volatile/roche/bzr/nipy/fff2/fff2/registration/_transform_affine.pyx":139
- *         T[0:3,0:3] = np.dot(Q,np.dot(S,R))
- *     T[0:3,3] = t[0:3]
- *     return T             # <<<<<<<<<<<<<<
- * 
- * 
- */
-  Py_INCREF(__pyx_v_T);
-  __pyx_r = __pyx_v_T;
-  goto __pyx_L0;
-
-  __pyx_r = Py_None; Py_INCREF(Py_None);
-  goto __pyx_L0;
-  __pyx_L1_error:;
-  Py_XDECREF(__pyx_1);
-  Py_XDECREF(__pyx_2);
-  Py_XDECREF(__pyx_3);
-  Py_XDECREF(__pyx_5);
-  __Pyx_AddTraceback("fff2.registration._transform_affine.matrix44");
-  __pyx_r = NULL;
-  __pyx_L0:;
-  Py_DECREF(__pyx_v_T);
-  Py_DECREF(__pyx_v_R);
-  Py_DECREF(__pyx_v_S);
-  Py_DECREF(__pyx_v_Q);
-  return __pyx_r;
-}
-
-/* "/volatile/roche/bzr/nipy/fff2/fff2/registration/_transform_affine.pyx":143
- * 
- * 
- * def resample(ndarray Im, dims, ndarray Tvox, datatype=None):             # <<<<<<<<<<<<<<
- *     """
- *     Resample(im, dims, Tvox, datatype=None)
- */
-
-static PyObject *__pyx_pf_4fff2_12registration_17_transform_affine_resample(PyObject *__pyx_self, PyObject *__pyx_args, PyObject *__pyx_kwds); /*proto*/
-static char __pyx_doc_4fff2_12registration_17_transform_affine_resample[] = "\n    Resample(im, dims, Tvox, datatype=None)\n\n    Note that the input transformation Tvox will be re-ordered in C\n    convention if needed.\n    ";
-static PyObject *__pyx_pf_4fff2_12registration_17_transform_affine_resample(PyObject *__pyx_self, PyObject *__pyx_args, PyObject *__pyx_kwds) {
-  PyArrayObject *__pyx_v_Im = 0;
-  PyObject *__pyx_v_dims = 0;
-  PyArrayObject *__pyx_v_Tvox = 0;
-  PyObject *__pyx_v_datatype = 0;
-  fff_array *__pyx_v_im_resampled;
-  fff_array *__pyx_v_im;
-  double *__pyx_v_tvox;
-  PyObject *__pyx_v_Im_resampled;
-  PyObject *__pyx_r;
-  PyObject *__pyx_1 = 0;
-  int __pyx_2;
-  PyObject *__pyx_3 = 0;
-  PyObject *__pyx_4 = 0;
-  PyObject *__pyx_5 = 0;
-  static char *__pyx_argnames[] = {"Im","dims","Tvox","datatype",0};
-  __pyx_self = __pyx_self;
-  __pyx_v_datatype = Py_None;
-  if (likely(!__pyx_kwds) && likely(3 <= PyTuple_GET_SIZE(__pyx_args)) && likely(PyTuple_GET_SIZE(__pyx_args) <= 4)) {
-    __pyx_v_Im = ((PyArrayObject *)PyTuple_GET_ITEM(__pyx_args, 0));
-    __pyx_v_dims = PyTuple_GET_ITEM(__pyx_args, 1);
-    __pyx_v_Tvox = ((PyArrayObject *)PyTuple_GET_ITEM(__pyx_args, 2));
-    if (PyTuple_GET_SIZE(__pyx_args) > 3) {
-      __pyx_v_datatype = PyTuple_GET_ITEM(__pyx_args, 3);
-    }
-  }
-  else {
-    if (unlikely(!PyArg_ParseTupleAndKeywords(__pyx_args, __pyx_kwds, "OOO|O", __pyx_argnames, &__pyx_v_Im, &__pyx_v_dims, &__pyx_v_Tvox, &__pyx_v_datatype))) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 143; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-  }
-  goto __pyx_L4;
-  __pyx_L3_error:;
-  __Pyx_AddTraceback("fff2.registration._transform_affine.resample");
-  return NULL;
-  __pyx_L4:;
-  Py_INCREF(__pyx_v_Tvox);
-  Py_INCREF(__pyx_v_datatype);
-  __pyx_v_Im_resampled = Py_None; Py_INCREF(Py_None);
-  if (unlikely(!__Pyx_ArgTypeTest(((PyObject *)__pyx_v_Im), __pyx_ptype_4fff2_12registration_17_transform_affine_ndarray, 1, "Im", 0))) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 143; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  if (unlikely(!__Pyx_ArgTypeTest(((PyObject *)__pyx_v_Tvox), __pyx_ptype_4fff2_12registration_17_transform_affine_ndarray, 1, "Tvox", 0))) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 143; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-
-  /* "/volatile/roche/bzr/nipy/fff2/fff2/registration/_transform_affine.pyx":154
- * 
- *     # Create output array
- *     if datatype == None:             # <<<<<<<<<<<<<<
- *         datatype = Im.dtype
- *     Im_resampled = np.zeros(tuple(dims)).astype(datatype)
- */
-  __pyx_1 = PyObject_RichCompare(__pyx_v_datatype, Py_None, Py_EQ); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 154; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __pyx_2 = __Pyx_PyObject_IsTrue(__pyx_1); if (unlikely(__pyx_2 < 0)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 154; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_DECREF(__pyx_1); __pyx_1 = 0;
-  if (__pyx_2) {
-
-    /* "/volatile/roche/bzr/nipy/fff2/fff2/registration/_transform_affine.pyx":155
- *     # Create output array
- *     if datatype == None:
- *         datatype = Im.dtype             # <<<<<<<<<<<<<<
- *     Im_resampled = np.zeros(tuple(dims)).astype(datatype)
- * 
- */
-    __pyx_1 = PyObject_GetAttr(((PyObject *)__pyx_v_Im), __pyx_kp_dtype); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 155; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_DECREF(__pyx_v_datatype);
-    __pyx_v_datatype = __pyx_1;
-    __pyx_1 = 0;
-    goto __pyx_L5;
-  }
-  __pyx_L5:;
-
-  /* "/volatile/roche/bzr/nipy/fff2/fff2/registration/_transform_affine.pyx":156
- *     if datatype == None:
- *         datatype = Im.dtype
- *     Im_resampled = np.zeros(tuple(dims)).astype(datatype)             # <<<<<<<<<<<<<<
- * 
- *     # View on Python arrays
- */
-  __pyx_1 = __Pyx_GetName(__pyx_m, __pyx_kp_np); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 156; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __pyx_3 = PyObject_GetAttr(__pyx_1, __pyx_kp_zeros); if (unlikely(!__pyx_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 156; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_DECREF(__pyx_1); __pyx_1 = 0;
-  __pyx_1 = PyTuple_New(1); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 156; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_INCREF(__pyx_v_dims);
-  PyTuple_SET_ITEM(__pyx_1, 0, __pyx_v_dims);
-  __pyx_4 = PyObject_Call(((PyObject*)&PyTuple_Type), ((PyObject *)__pyx_1), NULL); if (unlikely(!__pyx_4)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 156; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_DECREF(((PyObject *)__pyx_1)); __pyx_1 = 0;
-  __pyx_1 = PyTuple_New(1); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 156; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  PyTuple_SET_ITEM(__pyx_1, 0, __pyx_4);
-  __pyx_4 = 0;
-  __pyx_4 = PyObject_Call(__pyx_3, ((PyObject *)__pyx_1), NULL); if (unlikely(!__pyx_4)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 156; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_DECREF(__pyx_3); __pyx_3 = 0;
-  Py_DECREF(((PyObject *)__pyx_1)); __pyx_1 = 0;
-  __pyx_3 = PyObject_GetAttr(__pyx_4, __pyx_kp_astype); if (unlikely(!__pyx_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 156; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_DECREF(__pyx_4); __pyx_4 = 0;
-  __pyx_1 = PyTuple_New(1); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 156; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_INCREF(__pyx_v_datatype);
-  PyTuple_SET_ITEM(__pyx_1, 0, __pyx_v_datatype);
-  __pyx_4 = PyObject_Call(__pyx_3, ((PyObject *)__pyx_1), NULL); if (unlikely(!__pyx_4)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 156; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_DECREF(__pyx_3); __pyx_3 = 0;
-  Py_DECREF(((PyObject *)__pyx_1)); __pyx_1 = 0;
-  Py_DECREF(__pyx_v_Im_resampled);
-  __pyx_v_Im_resampled = __pyx_4;
-  __pyx_4 = 0;
-
-  /* "/volatile/roche/bzr/nipy/fff2/fff2/registration/_transform_affine.pyx":159
- * 
- *     # View on Python arrays
- *     im_resampled = fff_array_fromPyArray(Im_resampled)             # <<<<<<<<<<<<<<
- *     im = fff_array_fromPyArray(Im)
- * 
- */
-  if (!(__Pyx_TypeTest(__pyx_v_Im_resampled, __pyx_ptype_4fff2_12registration_17_transform_affine_ndarray))) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 159; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __pyx_v_im_resampled = fff_array_fromPyArray(((PyArrayObject *)__pyx_v_Im_resampled));
-
-  /* "/volatile/roche/bzr/nipy/fff2/fff2/registration/_transform_affine.pyx":160
- *     # View on Python arrays
- *     im_resampled = fff_array_fromPyArray(Im_resampled)
- *     im = fff_array_fromPyArray(Im)             # <<<<<<<<<<<<<<
- * 
- *     # Ensure that the Tvox array is C-contiguous (required by the
- */
-  __pyx_v_im = fff_array_fromPyArray(__pyx_v_Im);
-
-  /* "/volatile/roche/bzr/nipy/fff2/fff2/registration/_transform_affine.pyx":164
- *     # Ensure that the Tvox array is C-contiguous (required by the
- *     # underlying fff routine)
- *     Tvox = np.asarray(Tvox, order='C')             # <<<<<<<<<<<<<<
- *     tvox = <double*>Tvox.data
- * 
- */
-  __pyx_3 = __Pyx_GetName(__pyx_m, __pyx_kp_np); if (unlikely(!__pyx_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 164; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __pyx_1 = PyObject_GetAttr(__pyx_3, __pyx_kp_asarray); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 164; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_DECREF(__pyx_3); __pyx_3 = 0;
-  __pyx_4 = PyTuple_New(1); if (unlikely(!__pyx_4)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 164; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_INCREF(((PyObject *)__pyx_v_Tvox));
-  PyTuple_SET_ITEM(__pyx_4, 0, ((PyObject *)__pyx_v_Tvox));
-  __pyx_3 = PyDict_New(); if (unlikely(!__pyx_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 164; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  if (PyDict_SetItem(__pyx_3, __pyx_kp_order, __pyx_kp_10) < 0) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 164; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __pyx_5 = PyEval_CallObjectWithKeywords(__pyx_1, ((PyObject *)__pyx_4), ((PyObject *)__pyx_3)); if (unlikely(!__pyx_5)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 164; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_DECREF(__pyx_1); __pyx_1 = 0;
-  Py_DECREF(((PyObject *)__pyx_4)); __pyx_4 = 0;
-  Py_DECREF(((PyObject *)__pyx_3)); __pyx_3 = 0;
-  if (!(__Pyx_TypeTest(__pyx_5, __pyx_ptype_4fff2_12registration_17_transform_affine_ndarray))) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 164; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_DECREF(((PyObject *)__pyx_v_Tvox));
-  __pyx_v_Tvox = ((PyArrayObject *)__pyx_5);
-  __pyx_5 = 0;
-
-  /* "/volatile/roche/bzr/nipy/fff2/fff2/registration/_transform_affine.pyx":165
- *     # underlying fff routine)
- *     Tvox = np.asarray(Tvox, order='C')
- *     tvox = <double*>Tvox.data             # <<<<<<<<<<<<<<
- * 
- *     # Actual resampling
- */
-  __pyx_v_tvox = ((double *)__pyx_v_Tvox->data);
-
-  /* "/volatile/roche/bzr/nipy/fff2/fff2/registration/_transform_affine.pyx":168
- * 
- *     # Actual resampling
- *     fff_imatch_resample(im_resampled, im, tvox)             # <<<<<<<<<<<<<<
- * 
- *     # Delete local structures
- */
-  fff_imatch_resample(__pyx_v_im_resampled, __pyx_v_im, __pyx_v_tvox);
-
-  /* "/volatile/roche/bzr/nipy/fff2/fff2/registration/_transform_affine.pyx":171
- * 
- *     # Delete local structures
- *     fff_array_delete(im_resampled)             # <<<<<<<<<<<<<<
- *     fff_array_delete(im)
- * 
- */
-  fff_array_delete(__pyx_v_im_resampled);
-
-  /* "/volatile/roche/bzr/nipy/fff2/fff2/registration/_transform_affine.pyx":172
- *     # Delete local structures
- *     fff_array_delete(im_resampled)
- *     fff_array_delete(im)             # <<<<<<<<<<<<<<
- * 
- *     return Im_resampled
- */
-  fff_array_delete(__pyx_v_im);
-
-  /* "/volatile/roche/bzr/nipy/fff2/fff2/registration/_transform_affine.pyx":174
- *     fff_array_delete(im)
- * 
- *     return Im_resampled             # <<<<<<<<<<<<<<
- * 
- */
-  Py_INCREF(__pyx_v_Im_resampled);
-  __pyx_r = __pyx_v_Im_resampled;
-  goto __pyx_L0;
-
-  __pyx_r = Py_None; Py_INCREF(Py_None);
-  goto __pyx_L0;
-  __pyx_L1_error:;
-  Py_XDECREF(__pyx_1);
-  Py_XDECREF(__pyx_3);
-  Py_XDECREF(__pyx_4);
-  Py_XDECREF(__pyx_5);
-  __Pyx_AddTraceback("fff2.registration._transform_affine.resample");
-  __pyx_r = NULL;
-  __pyx_L0:;
-  Py_DECREF(__pyx_v_Im_resampled);
-  Py_DECREF(__pyx_v_Tvox);
-  Py_DECREF(__pyx_v_datatype);
-  return __pyx_r;
-}
-
-static struct PyMethodDef __pyx_methods[] = {
-  {"rvector_to_matrix", (PyCFunction)__pyx_pf_4fff2_12registration_17_transform_affine_rvector_to_matrix, METH_O, __pyx_doc_4fff2_12registration_17_transform_affine_rvector_to_matrix},
-  {"param_to_vector12", (PyCFunction)__pyx_pf_4fff2_12registration_17_transform_affine_param_to_vector12, METH_VARARGS|METH_KEYWORDS, __pyx_doc_4fff2_12registration_17_transform_affine_param_to_vector12},
-  {"matrix44", (PyCFunction)__pyx_pf_4fff2_12registration_17_transform_affine_matrix44, METH_O, __pyx_doc_4fff2_12registration_17_transform_affine_matrix44},
-  {"resample", (PyCFunction)__pyx_pf_4fff2_12registration_17_transform_affine_resample, METH_VARARGS|METH_KEYWORDS, __pyx_doc_4fff2_12registration_17_transform_affine_resample},
-  {0, 0, 0, 0}
-};
-
-static void __pyx_init_filenames(void); /*proto*/
-
-#if PY_MAJOR_VERSION >= 3
-static struct PyModuleDef __pyx_moduledef = {
-    PyModuleDef_HEAD_INIT,
-    "_transform_affine",
-    0, /* m_doc */
-    -1, /* m_size */
-    __pyx_methods /* m_methods */,
-    NULL, /* m_reload */
-    NULL, /* m_traverse */
-    NULL, /* m_clear */
-    NULL /* m_free */
-};
-#endif
-
-static __Pyx_StringTabEntry __pyx_string_tab[] = {
-  {&__pyx_kp___version__, __pyx_k___version__, sizeof(__pyx_k___version__), 1, 1, 1},
-  {&__pyx_kp_numpy, __pyx_k_numpy, sizeof(__pyx_k_numpy), 1, 1, 1},
-  {&__pyx_kp_np, __pyx_k_np, sizeof(__pyx_k_np), 0, 1, 1},
-  {&__pyx_kp_8, __pyx_k_8, sizeof(__pyx_k_8), 1, 1, 1},
-  {&__pyx_kp_linalg, __pyx_k_linalg, sizeof(__pyx_k_linalg), 1, 1, 1},
-  {&__pyx_kp_norm, __pyx_k_norm, sizeof(__pyx_k_norm), 1, 1, 1},
-  {&__pyx_kp_array, __pyx_k_array, sizeof(__pyx_k_array), 1, 1, 1},
-  {&__pyx_kp_eye, __pyx_k_eye, sizeof(__pyx_k_eye), 1, 1, 1},
-  {&__pyx_kp_sin, __pyx_k_sin, sizeof(__pyx_k_sin), 1, 1, 1},
-  {&__pyx_kp_cos, __pyx_k_cos, sizeof(__pyx_k_cos), 1, 1, 1},
-  {&__pyx_kp_dot, __pyx_k_dot, sizeof(__pyx_k_dot), 1, 1, 1},
-  {&__pyx_kp_rvector_to_matrix, __pyx_k_rvector_to_matrix, sizeof(__pyx_k_rvector_to_matrix), 0, 1, 1},
-  {&__pyx_kp_diag, __pyx_k_diag, sizeof(__pyx_k_diag), 1, 1, 1},
-  {&__pyx_kp_dtype, __pyx_k_dtype, sizeof(__pyx_k_dtype), 1, 1, 1},
-  {&__pyx_kp_zeros, __pyx_k_zeros, sizeof(__pyx_k_zeros), 1, 1, 1},
-  {&__pyx_kp_astype, __pyx_k_astype, sizeof(__pyx_k_astype), 1, 1, 1},
-  {&__pyx_kp_asarray, __pyx_k_asarray, sizeof(__pyx_k_asarray), 1, 1, 1},
-  {&__pyx_kp_order, __pyx_k_order, sizeof(__pyx_k_order), 1, 1, 1},
-  {&__pyx_kp_10, __pyx_k_10, sizeof(__pyx_k_10), 0, 1, 0},
-  {&__pyx_kp_1, __pyx_k_1, sizeof(__pyx_k_1), 0, 0, 0},
-  {&__pyx_kp_2, __pyx_k_2, sizeof(__pyx_k_2), 0, 0, 0},
-  {&__pyx_kp_3, __pyx_k_3, sizeof(__pyx_k_3), 0, 0, 0},
-  {&__pyx_kp_4, __pyx_k_4, sizeof(__pyx_k_4), 0, 0, 0},
-  {&__pyx_kp_5, __pyx_k_5, sizeof(__pyx_k_5), 0, 0, 0},
-  {&__pyx_kp_6, __pyx_k_6, sizeof(__pyx_k_6), 0, 0, 0},
-  {&__pyx_kp_7, __pyx_k_7, sizeof(__pyx_k_7), 0, 0, 0},
-  {0, 0, 0, 0, 0, 0}
-};
-static int __Pyx_InitCachedBuiltins(void) {
-  return 0;
-  return -1;
-}
-
-static int __Pyx_InitGlobals(void) {
-  __pyx_int_0 = PyInt_FromLong(0); if (unlikely(!__pyx_int_0)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 1; __pyx_clineno = __LINE__; goto __pyx_L1_error;};
-  __pyx_int_3 = PyInt_FromLong(3); if (unlikely(!__pyx_int_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 1; __pyx_clineno = __LINE__; goto __pyx_L1_error;};
-  __pyx_int_1 = PyInt_FromLong(1); if (unlikely(!__pyx_int_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 1; __pyx_clineno = __LINE__; goto __pyx_L1_error;};
-  __pyx_int_2 = PyInt_FromLong(2); if (unlikely(!__pyx_int_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 1; __pyx_clineno = __LINE__; goto __pyx_L1_error;};
-  __pyx_int_4 = PyInt_FromLong(4); if (unlikely(!__pyx_int_4)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 1; __pyx_clineno = __LINE__; goto __pyx_L1_error;};
-  __pyx_int_5 = PyInt_FromLong(5); if (unlikely(!__pyx_int_5)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 1; __pyx_clineno = __LINE__; goto __pyx_L1_error;};
-  __pyx_int_6 = PyInt_FromLong(6); if (unlikely(!__pyx_int_6)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 1; __pyx_clineno = __LINE__; goto __pyx_L1_error;};
-  __pyx_int_7 = PyInt_FromLong(7); if (unlikely(!__pyx_int_7)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 1; __pyx_clineno = __LINE__; goto __pyx_L1_error;};
-  __pyx_int_11 = PyInt_FromLong(11); if (unlikely(!__pyx_int_11)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 1; __pyx_clineno = __LINE__; goto __pyx_L1_error;};
-  if (__Pyx_InitStrings(__pyx_string_tab) < 0) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 1; __pyx_clineno = __LINE__; goto __pyx_L1_error;};
-  return 0;
-  __pyx_L1_error:;
-  return -1;
-}
-
-#if PY_MAJOR_VERSION < 3
-PyMODINIT_FUNC init_transform_affine(void); /*proto*/
-PyMODINIT_FUNC init_transform_affine(void)
-#else
-PyMODINIT_FUNC PyInit__transform_affine(void); /*proto*/
-PyMODINIT_FUNC PyInit__transform_affine(void)
-#endif
-{
-  PyObject *__pyx_1 = 0;
-  PyObject *__pyx_2 = 0;
-  __pyx_empty_tuple = PyTuple_New(0); if (unlikely(!__pyx_empty_tuple)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 1; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  /*--- Libary function declarations ---*/
-  __pyx_init_filenames();
-  /*--- Initialize various global constants etc. ---*/
-  if (unlikely(__Pyx_InitGlobals() < 0)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 1; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  /*--- Module creation code ---*/
-  #if PY_MAJOR_VERSION < 3
-  __pyx_m = Py_InitModule4("_transform_affine", __pyx_methods, 0, 0, PYTHON_API_VERSION);
-  #else
-  __pyx_m = PyModule_Create(&__pyx_moduledef);
-  #endif
-  if (!__pyx_m) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 1; __pyx_clineno = __LINE__; goto __pyx_L1_error;};
-  #if PY_MAJOR_VERSION < 3
-  Py_INCREF(__pyx_m);
-  #endif
-  __pyx_b = PyImport_AddModule(__Pyx_BUILTIN_MODULE_NAME);
-  if (!__pyx_b) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 1; __pyx_clineno = __LINE__; goto __pyx_L1_error;};
-  if (PyObject_SetAttrString(__pyx_m, "__builtins__", __pyx_b) < 0) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 1; __pyx_clineno = __LINE__; goto __pyx_L1_error;};
-  /*--- Builtin init code ---*/
-  if (unlikely(__Pyx_InitCachedBuiltins() < 0)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 1; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __pyx_skip_dispatch = 0;
-  /*--- Global init code ---*/
-  /*--- Function export code ---*/
-  /*--- Type init code ---*/
-  __pyx_ptype_4fff2_12registration_17_transform_affine_dtype = __Pyx_ImportType("numpy", "dtype", sizeof(PyArray_Descr)); if (unlikely(!__pyx_ptype_4fff2_12registration_17_transform_affine_dtype)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 74; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __pyx_ptype_4fff2_12registration_17_transform_affine_ndarray = __Pyx_ImportType("numpy", "ndarray", sizeof(PyArrayObject)); if (unlikely(!__pyx_ptype_4fff2_12registration_17_transform_affine_ndarray)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 79; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __pyx_ptype_4fff2_12registration_17_transform_affine_flatiter = __Pyx_ImportType("numpy", "flatiter", sizeof(PyArrayIterObject)); if (unlikely(!__pyx_ptype_4fff2_12registration_17_transform_affine_flatiter)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 88; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __pyx_ptype_4fff2_12registration_17_transform_affine_broadcast = __Pyx_ImportType("numpy", "broadcast", sizeof(PyArrayMultiIterObject)); if (unlikely(!__pyx_ptype_4fff2_12registration_17_transform_affine_broadcast)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 94; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  /*--- Type import code ---*/
-  /*--- Function import code ---*/
-  /*--- Execution code ---*/
-
-  /* "/volatile/roche/bzr/nipy/fff2/fff2/registration/_transform_affine.pyx":10
- * """
- * 
- * __version__ = '0.1'             # <<<<<<<<<<<<<<
- * 
- * 
- */
-  if (PyObject_SetAttr(__pyx_m, __pyx_kp___version__, __pyx_kp_1) < 0) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 10; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-
-  /* "/volatile/roche/bzr/nipy/fff2/fff2/registration/_transform_affine.pyx":23
- * 
- * # Initialize numpy
- * fffpy_import_array()             # <<<<<<<<<<<<<<
- * import_array()
- * import numpy as np
- */
-  fffpy_import_array();
-
-  /* "/volatile/roche/bzr/nipy/fff2/fff2/registration/_transform_affine.pyx":24
- * # Initialize numpy
- * fffpy_import_array()
- * import_array()             # <<<<<<<<<<<<<<
- * import numpy as np
- * 
- */
-  import_array();
-
-  /* "/volatile/roche/bzr/nipy/fff2/fff2/registration/_transform_affine.pyx":25
- * fffpy_import_array()
- * import_array()
- * import numpy as np             # <<<<<<<<<<<<<<
- * 
- * 
- */
-  __pyx_1 = __Pyx_Import(__pyx_kp_numpy, 0); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 25; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  if (PyObject_SetAttr(__pyx_m, __pyx_kp_np, __pyx_1) < 0) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 25; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_DECREF(__pyx_1); __pyx_1 = 0;
-
-  /* "/volatile/roche/bzr/nipy/fff2/fff2/registration/_transform_affine.pyx":34
- * 
- * # Corresponding Python constants
- * transformation_types = {'rigid 2D': RIGID2D,             # <<<<<<<<<<<<<<
- *                         'similarity 2D': SIMILARITY2D,
- *                         'affine 2D': AFFINE2D,
- */
-  __pyx_1 = PyDict_New(); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 34; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __pyx_2 = PyInt_FromLong(__pyx_e_4fff2_12registration_17_transform_affine_RIGID2D); if (unlikely(!__pyx_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 34; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  if (PyDict_SetItem(__pyx_1, __pyx_kp_2, __pyx_2) < 0) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 34; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_DECREF(__pyx_2); __pyx_2 = 0;
-
-  /* "/volatile/roche/bzr/nipy/fff2/fff2/registration/_transform_affine.pyx":35
- * # Corresponding Python constants
- * transformation_types = {'rigid 2D': RIGID2D,
- *                         'similarity 2D': SIMILARITY2D,             # <<<<<<<<<<<<<<
- *                         'affine 2D': AFFINE2D,
- *                         'rigid 3D': RIGID3D,
- */
-  __pyx_2 = PyInt_FromLong(__pyx_e_4fff2_12registration_17_transform_affine_SIMILARITY2D); if (unlikely(!__pyx_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 35; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  if (PyDict_SetItem(__pyx_1, __pyx_kp_3, __pyx_2) < 0) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 34; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_DECREF(__pyx_2); __pyx_2 = 0;
-
-  /* "/volatile/roche/bzr/nipy/fff2/fff2/registration/_transform_affine.pyx":36
- * transformation_types = {'rigid 2D': RIGID2D,
- *                         'similarity 2D': SIMILARITY2D,
- *                         'affine 2D': AFFINE2D,             # <<<<<<<<<<<<<<
- *                         'rigid 3D': RIGID3D,
- *                         'similarity 3D': SIMILARITY3D,
- */
-  __pyx_2 = PyInt_FromLong(__pyx_e_4fff2_12registration_17_transform_affine_AFFINE2D); if (unlikely(!__pyx_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 36; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  if (PyDict_SetItem(__pyx_1, __pyx_kp_4, __pyx_2) < 0) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 34; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_DECREF(__pyx_2); __pyx_2 = 0;
-
-  /* "/volatile/roche/bzr/nipy/fff2/fff2/registration/_transform_affine.pyx":37
- *                         'similarity 2D': SIMILARITY2D,
- *                         'affine 2D': AFFINE2D,
- *                         'rigid 3D': RIGID3D,             # <<<<<<<<<<<<<<
- *                         'similarity 3D': SIMILARITY3D,
- *                         'affine 3D': AFFINE3D}
- */
-  __pyx_2 = PyInt_FromLong(__pyx_e_4fff2_12registration_17_transform_affine_RIGID3D); if (unlikely(!__pyx_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 37; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  if (PyDict_SetItem(__pyx_1, __pyx_kp_5, __pyx_2) < 0) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 34; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_DECREF(__pyx_2); __pyx_2 = 0;
-
-  /* "/volatile/roche/bzr/nipy/fff2/fff2/registration/_transform_affine.pyx":38
- *                         'affine 2D': AFFINE2D,
- *                         'rigid 3D': RIGID3D,
- *                         'similarity 3D': SIMILARITY3D,             # <<<<<<<<<<<<<<
- *                         'affine 3D': AFFINE3D}
- * 
- */
-  __pyx_2 = PyInt_FromLong(__pyx_e_4fff2_12registration_17_transform_affine_SIMILARITY3D); if (unlikely(!__pyx_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 38; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  if (PyDict_SetItem(__pyx_1, __pyx_kp_6, __pyx_2) < 0) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 34; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_DECREF(__pyx_2); __pyx_2 = 0;
-
-  /* "/volatile/roche/bzr/nipy/fff2/fff2/registration/_transform_affine.pyx":39
- *                         'rigid 3D': RIGID3D,
- *                         'similarity 3D': SIMILARITY3D,
- *                         'affine 3D': AFFINE3D}             # <<<<<<<<<<<<<<
- * 
- * def rvector_to_matrix(r):
- */
-  __pyx_2 = PyInt_FromLong(__pyx_e_4fff2_12registration_17_transform_affine_AFFINE3D); if (unlikely(!__pyx_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 39; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  if (PyDict_SetItem(__pyx_1, __pyx_kp_7, __pyx_2) < 0) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 34; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_DECREF(__pyx_2); __pyx_2 = 0;
-  if (PyObject_SetAttr(__pyx_m, __pyx_kp_8, ((PyObject *)__pyx_1)) < 0) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 34; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_DECREF(((PyObject *)__pyx_1)); __pyx_1 = 0;
-
-  /* "/volatile/roche/bzr/nipy/fff2/fff2/registration/_transform_affine.pyx":82
- * 
- * 
- * def param_to_vector12(ndarray param, ndarray t0, ndarray precond, int stamp=AFFINE3D):             # <<<<<<<<<<<<<<
- *     """
- *     t = param_to_vector12(p, t, precond, stamp=AFFINE3D).
- */
-  __pyx_k_9 = __pyx_e_4fff2_12registration_17_transform_affine_AFFINE3D;
-
-  /* "/volatile/roche/bzr/nipy/fff2/fff2/registration/_transform_affine.pyx":143
- * 
- * 
- * def resample(ndarray Im, dims, ndarray Tvox, datatype=None):             # <<<<<<<<<<<<<<
- *     """
- *     Resample(im, dims, Tvox, datatype=None)
- */
-  #if PY_MAJOR_VERSION < 3
-  return;
-  #else
-  return __pyx_m;
-  #endif
-  __pyx_L1_error:;
-  Py_XDECREF(__pyx_1);
-  Py_XDECREF(__pyx_2);
-  __Pyx_AddTraceback("fff2.registration._transform_affine");
-  #if PY_MAJOR_VERSION >= 3
-  return NULL;
-  #endif
-}
-
-static const char *__pyx_filenames[] = {
-  "_transform_affine.pyx",
-  "numpy.pxi",
-};
-
-/* Runtime support code */
-
-static void __pyx_init_filenames(void) {
-  __pyx_f = __pyx_filenames;
-}
-
-static int __Pyx_ArgTypeTest(PyObject *obj, PyTypeObject *type, int none_allowed, char *name, int exact) {
-    if (!type) {
-        PyErr_Format(PyExc_SystemError, "Missing type object");
-        return 0;
-    }
-    if (none_allowed && obj == Py_None) return 1;
-    else if (exact) {
-        if (Py_TYPE(obj) == type) return 1;
-    }
-    else {
-        if (PyObject_TypeCheck(obj, type)) return 1;
-    }
-    PyErr_Format(PyExc_TypeError,
-        "Argument '%s' has incorrect type (expected %s, got %s)",
-        name, type->tp_name, Py_TYPE(obj)->tp_name);
-    return 0;
-}
-
-static INLINE void __Pyx_RaiseArgtupleTooLong(
-    Py_ssize_t num_expected,
-    Py_ssize_t num_found)
-{
-    const char* error_message =
-    #if PY_VERSION_HEX < 0x02050000
-        "function takes at most %d positional arguments (%d given)";
-    #else
-        "function takes at most %zd positional arguments (%zd given)";
-    #endif
-    PyErr_Format(PyExc_TypeError, error_message, num_expected, num_found);
-}
-
-static PyObject *__Pyx_Import(PyObject *name, PyObject *from_list) {
-    PyObject *__import__ = 0;
-    PyObject *empty_list = 0;
-    PyObject *module = 0;
-    PyObject *global_dict = 0;
-    PyObject *empty_dict = 0;
-    PyObject *list;
-    __import__ = PyObject_GetAttrString(__pyx_b, "__import__");
-    if (!__import__)
-        goto bad;
-    if (from_list)
-        list = from_list;
-    else {
-        empty_list = PyList_New(0);
-        if (!empty_list)
-            goto bad;
-        list = empty_list;
-    }
-    global_dict = PyModule_GetDict(__pyx_m);
-    if (!global_dict)
-        goto bad;
-    empty_dict = PyDict_New();
-    if (!empty_dict)
-        goto bad;
-    module = PyObject_CallFunction(__import__, "OOOO",
-        name, global_dict, empty_dict, list);
-bad:
-    Py_XDECREF(empty_list);
-    Py_XDECREF(__import__);
-    Py_XDECREF(empty_dict);
-    return module;
-}
-
-static PyObject *__Pyx_GetName(PyObject *dict, PyObject *name) {
-    PyObject *result;
-    result = PyObject_GetAttr(dict, name);
-    if (!result)
-        PyErr_SetObject(PyExc_NameError, name);
-    return result;
-}
-
-
-static int __Pyx_TypeTest(PyObject *obj, PyTypeObject *type) {
-    if (!type) {
-        PyErr_Format(PyExc_SystemError, "Missing type object");
-        return 0;
-    }
-    if (obj == Py_None || PyObject_TypeCheck(obj, type))
-        return 1;
-    PyErr_Format(PyExc_TypeError, "Cannot convert %s to %s",
-        Py_TYPE(obj)->tp_name, type->tp_name);
-    return 0;
-}
-
-#ifndef __PYX_HAVE_RT_ImportType
-#define __PYX_HAVE_RT_ImportType
-static PyTypeObject *__Pyx_ImportType(char *module_name, char *class_name,
-    long size)
-{
-    PyObject *py_module = 0;
-    PyObject *result = 0;
-    PyObject *py_name = 0;
-
-    #if PY_MAJOR_VERSION < 3
-    py_name = PyString_FromString(module_name);
-    #else
-    py_name = PyUnicode_FromString(module_name);
-    #endif
-    if (!py_name)
-        goto bad;
-
-    py_module = __Pyx_ImportModule(module_name);
-    if (!py_module)
-        goto bad;
-    result = PyObject_GetAttrString(py_module, class_name);
-    if (!result)
-        goto bad;
-    if (!PyType_Check(result)) {
-        PyErr_Format(PyExc_TypeError, 
-            "%s.%s is not a type object",
-            module_name, class_name);
-        goto bad;
-    }
-    if (((PyTypeObject *)result)->tp_basicsize != size) {
-        PyErr_Format(PyExc_ValueError, 
-            "%s.%s does not appear to be the correct type object",
-            module_name, class_name);
-        goto bad;
-    }
-    return (PyTypeObject *)result;
-bad:
-    Py_XDECREF(py_name);
-    Py_XDECREF(result);
-    return 0;
-}
-#endif
-
-#ifndef __PYX_HAVE_RT_ImportModule
-#define __PYX_HAVE_RT_ImportModule
-static PyObject *__Pyx_ImportModule(char *name) {
-    PyObject *py_name = 0;
-    PyObject *py_module = 0;
-
-    #if PY_MAJOR_VERSION < 3
-    py_name = PyString_FromString(name);
-    #else
-    py_name = PyUnicode_FromString(name);
-    #endif
-    if (!py_name)
-        goto bad;
-    py_module = PyImport_Import(py_name);
-    Py_DECREF(py_name);
-    return py_module;
-bad:
-    Py_XDECREF(py_name);
-    return 0;
-}
-#endif
-
-#include "compile.h"
-#include "frameobject.h"
-#include "traceback.h"
-
-static void __Pyx_AddTraceback(const char *funcname) {
-    PyObject *py_srcfile = 0;
-    PyObject *py_funcname = 0;
-    PyObject *py_globals = 0;
-    PyObject *empty_string = 0;
-    PyCodeObject *py_code = 0;
-    PyFrameObject *py_frame = 0;
-
-    #if PY_MAJOR_VERSION < 3
-    py_srcfile = PyString_FromString(__pyx_filename);
-    #else
-    py_srcfile = PyUnicode_FromString(__pyx_filename);
-    #endif
-    if (!py_srcfile) goto bad;
-    if (__pyx_clineno) {
-        #if PY_MAJOR_VERSION < 3
-        py_funcname = PyString_FromFormat( "%s (%s:%d)", funcname, __pyx_cfilenm, __pyx_clineno);
-        #else
-        py_funcname = PyUnicode_FromFormat( "%s (%s:%d)", funcname, __pyx_cfilenm, __pyx_clineno);
-        #endif
-    }
-    else {
-        #if PY_MAJOR_VERSION < 3
-        py_funcname = PyString_FromString(funcname);
-        #else
-        py_funcname = PyUnicode_FromString(funcname);
-        #endif
-    }
-    if (!py_funcname) goto bad;
-    py_globals = PyModule_GetDict(__pyx_m);
-    if (!py_globals) goto bad;
-    #if PY_MAJOR_VERSION < 3
-    empty_string = PyString_FromStringAndSize("", 0);
-    #else
-    empty_string = PyBytes_FromStringAndSize("", 0);
-    #endif
-    if (!empty_string) goto bad;
-    py_code = PyCode_New(
-        0,            /*int argcount,*/
-        #if PY_MAJOR_VERSION >= 3
-        0,            /*int kwonlyargcount,*/
-        #endif
-        0,            /*int nlocals,*/
-        0,            /*int stacksize,*/
-        0,            /*int flags,*/
-        empty_string, /*PyObject *code,*/
-        __pyx_empty_tuple,  /*PyObject *consts,*/
-        __pyx_empty_tuple,  /*PyObject *names,*/
-        __pyx_empty_tuple,  /*PyObject *varnames,*/
-        __pyx_empty_tuple,  /*PyObject *freevars,*/
-        __pyx_empty_tuple,  /*PyObject *cellvars,*/
-        py_srcfile,   /*PyObject *filename,*/
-        py_funcname,  /*PyObject *name,*/
-        __pyx_lineno,   /*int firstlineno,*/
-        empty_string  /*PyObject *lnotab*/
-    );
-    if (!py_code) goto bad;
-    py_frame = PyFrame_New(
-        PyThreadState_Get(), /*PyThreadState *tstate,*/
-        py_code,             /*PyCodeObject *code,*/
-        py_globals,          /*PyObject *globals,*/
-        0                    /*PyObject *locals*/
-    );
-    if (!py_frame) goto bad;
-    py_frame->f_lineno = __pyx_lineno;
-    PyTraceBack_Here(py_frame);
-bad:
-    Py_XDECREF(py_srcfile);
-    Py_XDECREF(py_funcname);
-    Py_XDECREF(empty_string);
-    Py_XDECREF(py_code);
-    Py_XDECREF(py_frame);
-}
-
-static int __Pyx_InitStrings(__Pyx_StringTabEntry *t) {
-    while (t->p) {
-        #if PY_MAJOR_VERSION < 3
-        if (t->is_unicode && (!t->is_identifier)) {
-            *t->p = PyUnicode_DecodeUTF8(t->s, t->n - 1, NULL);
-        } else if (t->intern) {
-            *t->p = PyString_InternFromString(t->s);
-        } else {
-            *t->p = PyString_FromStringAndSize(t->s, t->n - 1);
-        }
-        #else  /* Python 3+ has unicode identifiers */
-        if (t->is_identifier || (t->is_unicode && t->intern)) {
-            *t->p = PyUnicode_InternFromString(t->s);
-        } else if (t->is_unicode) {
-            *t->p = PyUnicode_FromStringAndSize(t->s, t->n - 1);
-        } else {
-            *t->p = PyBytes_FromStringAndSize(t->s, t->n - 1);
-        }
-        #endif
-        if (!*t->p)
-            return -1;
-        ++t;
-    }
-    return 0;
-}
-
-/* Type Conversion Functions */
-
-static INLINE Py_ssize_t __pyx_PyIndex_AsSsize_t(PyObject* b) {
-  Py_ssize_t ival;
-  PyObject* x = PyNumber_Index(b);
-  if (!x) return -1;
-  ival = PyInt_AsSsize_t(x);
-  Py_DECREF(x);
-  return ival;
-}
-
-static INLINE int __Pyx_PyObject_IsTrue(PyObject* x) {
-   if (x == Py_True) return 1;
-   else if (x == Py_False) return 0;
-   else return PyObject_IsTrue(x);
-}
-
-static INLINE PY_LONG_LONG __pyx_PyInt_AsLongLong(PyObject* x) {
-    if (PyInt_CheckExact(x)) {
-        return PyInt_AS_LONG(x);
-    }
-    else if (PyLong_CheckExact(x)) {
-        return PyLong_AsLongLong(x);
-    }
-    else {
-        PY_LONG_LONG val;
-        PyObject* tmp = PyNumber_Int(x); if (!tmp) return (PY_LONG_LONG)-1;
-        val = __pyx_PyInt_AsLongLong(tmp);
-        Py_DECREF(tmp);
-        return val;
-    }
-}
-
-static INLINE unsigned PY_LONG_LONG __pyx_PyInt_AsUnsignedLongLong(PyObject* x) {
-    if (PyInt_CheckExact(x)) {
-        long val = PyInt_AS_LONG(x);
-        if (unlikely(val < 0)) {
-            PyErr_SetString(PyExc_TypeError, "Negative assignment to unsigned type.");
-            return (unsigned PY_LONG_LONG)-1;
-        }
-        return val;
-    }
-    else if (PyLong_CheckExact(x)) {
-        return PyLong_AsUnsignedLongLong(x);
-    }
-    else {
-        PY_LONG_LONG val;
-        PyObject* tmp = PyNumber_Int(x); if (!tmp) return (PY_LONG_LONG)-1;
-        val = __pyx_PyInt_AsUnsignedLongLong(tmp);
-        Py_DECREF(tmp);
-        return val;
-    }
-}
-
-
-static INLINE unsigned char __pyx_PyInt_unsigned_char(PyObject* x) {
-    if (sizeof(unsigned char) < sizeof(long)) {
-        long long_val = __pyx_PyInt_AsLong(x);
-        unsigned char val = (unsigned char)long_val;
-        if (unlikely((val != long_val)  || (long_val < 0))) {
-            PyErr_SetString(PyExc_OverflowError, "value too large to convert to unsigned char");
-            return (unsigned char)-1;
-        }
-        return val;
-    }
-    else {
-        return __pyx_PyInt_AsLong(x);
-    }
-}
-
-static INLINE unsigned short __pyx_PyInt_unsigned_short(PyObject* x) {
-    if (sizeof(unsigned short) < sizeof(long)) {
-        long long_val = __pyx_PyInt_AsLong(x);
-        unsigned short val = (unsigned short)long_val;
-        if (unlikely((val != long_val)  || (long_val < 0))) {
-            PyErr_SetString(PyExc_OverflowError, "value too large to convert to unsigned short");
-            return (unsigned short)-1;
-        }
-        return val;
-    }
-    else {
-        return __pyx_PyInt_AsLong(x);
-    }
-}
-
-static INLINE char __pyx_PyInt_char(PyObject* x) {
-    if (sizeof(char) < sizeof(long)) {
-        long long_val = __pyx_PyInt_AsLong(x);
-        char val = (char)long_val;
-        if (unlikely((val != long_val) )) {
-            PyErr_SetString(PyExc_OverflowError, "value too large to convert to char");
-            return (char)-1;
-        }
-        return val;
-    }
-    else {
-        return __pyx_PyInt_AsLong(x);
-    }
-}
-
-static INLINE short __pyx_PyInt_short(PyObject* x) {
-    if (sizeof(short) < sizeof(long)) {
-        long long_val = __pyx_PyInt_AsLong(x);
-        short val = (short)long_val;
-        if (unlikely((val != long_val) )) {
-            PyErr_SetString(PyExc_OverflowError, "value too large to convert to short");
-            return (short)-1;
-        }
-        return val;
-    }
-    else {
-        return __pyx_PyInt_AsLong(x);
-    }
-}
-
-static INLINE int __pyx_PyInt_int(PyObject* x) {
-    if (sizeof(int) < sizeof(long)) {
-        long long_val = __pyx_PyInt_AsLong(x);
-        int val = (int)long_val;
-        if (unlikely((val != long_val) )) {
-            PyErr_SetString(PyExc_OverflowError, "value too large to convert to int");
-            return (int)-1;
-        }
-        return val;
-    }
-    else {
-        return __pyx_PyInt_AsLong(x);
-    }
-}
-
-static INLINE long __pyx_PyInt_long(PyObject* x) {
-    if (sizeof(long) < sizeof(long)) {
-        long long_val = __pyx_PyInt_AsLong(x);
-        long val = (long)long_val;
-        if (unlikely((val != long_val) )) {
-            PyErr_SetString(PyExc_OverflowError, "value too large to convert to long");
-            return (long)-1;
-        }
-        return val;
-    }
-    else {
-        return __pyx_PyInt_AsLong(x);
-    }
-}
-
-static INLINE signed char __pyx_PyInt_signed_char(PyObject* x) {
-    if (sizeof(signed char) < sizeof(long)) {
-        long long_val = __pyx_PyInt_AsLong(x);
-        signed char val = (signed char)long_val;
-        if (unlikely((val != long_val) )) {
-            PyErr_SetString(PyExc_OverflowError, "value too large to convert to signed char");
-            return (signed char)-1;
-        }
-        return val;
-    }
-    else {
-        return __pyx_PyInt_AsLong(x);
-    }
-}
-
-static INLINE signed short __pyx_PyInt_signed_short(PyObject* x) {
-    if (sizeof(signed short) < sizeof(long)) {
-        long long_val = __pyx_PyInt_AsLong(x);
-        signed short val = (signed short)long_val;
-        if (unlikely((val != long_val) )) {
-            PyErr_SetString(PyExc_OverflowError, "value too large to convert to signed short");
-            return (signed short)-1;
-        }
-        return val;
-    }
-    else {
-        return __pyx_PyInt_AsLong(x);
-    }
-}
-
-static INLINE signed int __pyx_PyInt_signed_int(PyObject* x) {
-    if (sizeof(signed int) < sizeof(long)) {
-        long long_val = __pyx_PyInt_AsLong(x);
-        signed int val = (signed int)long_val;
-        if (unlikely((val != long_val) )) {
-            PyErr_SetString(PyExc_OverflowError, "value too large to convert to signed int");
-            return (signed int)-1;
-        }
-        return val;
-    }
-    else {
-        return __pyx_PyInt_AsLong(x);
-    }
-}
-
-static INLINE signed long __pyx_PyInt_signed_long(PyObject* x) {
-    if (sizeof(signed long) < sizeof(long)) {
-        long long_val = __pyx_PyInt_AsLong(x);
-        signed long val = (signed long)long_val;
-        if (unlikely((val != long_val) )) {
-            PyErr_SetString(PyExc_OverflowError, "value too large to convert to signed long");
-            return (signed long)-1;
-        }
-        return val;
-    }
-    else {
-        return __pyx_PyInt_AsLong(x);
-    }
-}
-
-static INLINE long double __pyx_PyInt_long_double(PyObject* x) {
-    if (sizeof(long double) < sizeof(long)) {
-        long long_val = __pyx_PyInt_AsLong(x);
-        long double val = (long double)long_val;
-        if (unlikely((val != long_val) )) {
-            PyErr_SetString(PyExc_OverflowError, "value too large to convert to long double");
-            return (long double)-1;
-        }
-        return val;
-    }
-    else {
-        return __pyx_PyInt_AsLong(x);
-    }
-}
-
@@ -16,7 +16,8 @@ include "fff.pxi"
 # Additional exports from fff_iconic_match.h
 cdef extern from "fff_iconic_match.h":
 
-    void fff_imatch_resample(fff_array* im_resampled, fff_array* im, double* Tvox) 
+    void fff_imatch_resample_mt(fff_array* im_resampled, fff_array* im, double* Tvox, 
+                                int order, int clip, int nthreads) 
 
 
 # Initialize numpy
@@ -140,9 +141,19 @@ def matrix44(ndarray t):
 
 
 
-def resample(ndarray Im, dims, ndarray Tvox, datatype=None):
+def resample(ndarray Im, dims, ndarray Tvox, datatype=None, int order=3, 
+             clip=False, int nthreads=1):
     """
-    Resample(im, dims, Tvox, datatype=None)
+    Resample(im, dims, Tvox, datatype=None, order=3, clip=False, nthreads=1)
+
+    order is the interpolation order: 0 (nearest neighbour, e.g. for
+    label images), 1 (trilinear) or 3 (cubic spline). Values are
+    written directly in datatype, rounded for integer types, and are
+    zero outside the input image. If clip is True, only the output
+    voxels within the bounding box of the transformed input corners
+    are resampled, which does not change the result. Output voxels
+    are distributed across nthreads threads (all available
+    processors if nthreads<=0).
 
     Note that the input transformation Tvox will be re-ordered in C
     convention if needed.
@@ -153,7 +164,9 @@ def resample(ndarray Im, dims, ndarray Tvox, datatype=None):
     # Create output array
     if datatype == None:
         datatype = Im.dtype
-    Im_resampled = np.zeros(tuple(dims)).astype(datatype)
+    if order not in (0, 1, 3): 
+        raise ValueError('interpolation order must be 0, 1 or 3')
+    Im_resampled = np.zeros(tuple(dims), dtype=datatype)
 
     # View on Python arrays 
     im_resampled = fff_array_fromPyArray(Im_resampled) 
@@ -161,11 +174,11 @@ def resample(ndarray Im, dims, ndarray Tvox, datatype=None):
 
     # Ensure that the Tvox array is C-contiguous (required by the
     # underlying fff routine)
-    Tvox = np.asarray(Tvox, order='C')
+    Tvox = np.asarray(Tvox, dtype='double', order='C')
     tvox = <double*>Tvox.data
 
     # Actual resampling 
-    fff_imatch_resample(im_resampled, im, tvox) 
+    fff_imatch_resample_mt(im_resampled, im, tvox, order, int(clip), nthreads) 
 
     # Delete local structures 
     fff_array_delete(im_resampled) 
@@ -5,7 +5,8 @@ import numpy as np
 from scipy.ndimage import affine_transform
 
 from nipy.neurospin.register.transform import rotation_vec2mat
-from nipy.neurospin.register.routines import cspline_resample
+from nipy.neurospin.register.routines import cspline_resample, _joint_histogram
+from nipy.neurospin.register.iconic_matcher import IconicMatcher
 
 
 class Image(object):
@@ -55,3 +56,36 @@ def bench_resampling():
     Tv[0:3,0:3] = matrix
     Tv[0:3,3] = offset
     resampling(Tv)
+
+
+def joint_histogram(Tv, interp='pv', nthreads=1, repeat=5):
+    """
+    Report the throughput of the joint histogram kernel in source
+    voxels processed per second.
+    """
+    I = Image(make_data_int16(dx=160, dy=160, dz=100))
+    J = Image(make_data_int16(dx=160, dy=160, dz=100))
+    IM = IconicMatcher(I.array, J.array, I.toworld, J.toworld, nthreads=nthreads)
+    IM.set_interpolation(interp)
+    Tv = np.asarray(Tv, order='C')
+    t0 = time.time()
+    for i in range(repeat):
+        _joint_histogram(IM.joint_hist, IM.source_block.flat, IM.target_clamped, 
+                         Tv, IM._interp, nthreads)
+    dt = (time.time()-t0)/repeat
+    print('joint histogram (%s, %d thread(s))' % (interp, nthreads))
+    print('  %f sec, %.2f Mvoxels/sec' % (dt, IM.source_block.size/dt*1e-6))
+
+
+def bench_joint_histogram():
+    """
+    Joint histogram throughput for a random similarity transformation
+    """
+    rot = .1*np.random.rand(3) 
+    sca = 1+.2*np.random.rand()
+    Tv = np.eye(4)
+    Tv[0:3,0:3] = sca*rotation_vec2mat(rot)
+    Tv[0:3,3] = 10*np.random.rand(3)
+    for interp in ['pv', 'tri', 'rand']:
+        joint_histogram(Tv, interp=interp)
+    joint_histogram(Tv, interp='pv', nthreads=0)
@@ -1,6 +1,8 @@
 #include "cubic_spline.h"
 
 #include <randomkit.h>
+#include <fff_cubic_spline.h>
+#include <fff_threads.h>
 
 #include <math.h>
 #include <stdlib.h>
@@ -170,35 +172,683 @@ static void _cubic_spline_transform(PyArrayObject* res, int axis, double* work)
 }
 
 
-void cubic_spline_transform(PyArrayObject* res, const PyArrayObject* src)
+/* 
+   Checks that the strides of a double array are non-negative
+   multiples of sizeof(double), and converts them into numbers of
+   doubles.
+*/
+static int _double_strides(size_t* strides, size_t* dims, const PyArrayObject* res)
+{
+  int axis; 
+  npy_intp stride; 
+
+  for(axis=0; axis<res->nd; axis++) {
+    stride = PyArray_STRIDE(res, axis); 
+    if ((stride < 0) || (stride % sizeof(double)))
+      return 0; 
+    strides[axis] = stride/sizeof(double);
+    dims[axis] = PyArray_DIM(res, axis); 
+  }
+
+  return 1; 
+}
+
+void cubic_spline_transform_axis(PyArrayObject* res, int axis, int nthreads)
+{
+  double* work; 
+  size_t dims[NPY_MAXDIMS], strides[NPY_MAXDIMS]; 
+
+  if (_double_strides(strides, dims, res)) {
+    fff_cubic_spline_transform_axis((double*)PyArray_DATA(res), res->nd, dims, strides, axis, nthreads); 
+    return; 
+  }
+
+  work = (double*)malloc(sizeof(double)*PyArray_DIM(res, axis)); 
+  _cubic_spline_transform(res, axis, work);
+  free(work); 
+
+  return; 
+}
+
+void cubic_spline_transform(PyArrayObject* res, const PyArrayObject* src, int nthreads)
 {
   double* work; 
+  size_t dims[NPY_MAXDIMS], strides[NPY_MAXDIMS]; 
   unsigned int axis, aux=0, dimmax=0; 
 
   /* Copy src into res */ 
   PyArray_CastTo(res, (PyArrayObject*)src); 
 
-  /* Compute the maximum array dimension over axes */ 
+  /* Apply separable cubic spline transforms using the tiled
+     transform of libcstat */ 
+  if (_double_strides(strides, dims, res)) {
+    for(axis=0; axis<res->nd; axis++) 
+      fff_cubic_spline_transform_axis((double*)PyArray_DATA(res), res->nd, dims, strides, axis, nthreads); 
+    return; 
+  }
+
+  /* Unusual strides: filter line by line */ 
   for(axis=0; axis<res->nd; axis++) {
     aux = PyArray_DIM(res, axis);
     if (aux > dimmax) 
       dimmax = aux; 
   }
-
-  /* Allocate auxiliary buffer */ 
   work = (double*)malloc(sizeof(double)*dimmax); 
-
-  /* Apply separable cubic spline transforms */ 
   for(axis=0; axis<res->nd; axis++) 
     _cubic_spline_transform(res, axis, work);
-
-  /* Free auxiliary buffer */ 
   free(work); 
 
   return; 
 }
 
 
+/* 
+   Smooth and decimate by two along one axis of a C-contiguous
+   buffer of dimensions (outer, dim, inner), using the cubic B-spline
+   dilated by two as a smoothing kernel, i.e. weights
+   cubic_spline_basis(k/2)/2 for k=-3..3, with mirror conditions. 
+*/
+static void _cubic_spline_reduce_axis(double* res, const double* src, 
+				      size_t outer, unsigned int dim, size_t inner)
+{
+  double w[4]; 
+  unsigned int rdim = (dim+1)/2, m, two_ddim = 2*(dim-1); 
+  int k, xx; 
+  size_t o, i; 
+  const double *bufs; 
+  double *bufr, s; 
+
+  for (k=0; k<4; k++) 
+    w[k] = .5*cubic_spline_basis(.5*k); 
+
+  for (o=0; o<outer; o++) 
+    for (m=0; m<rdim; m++) {
+      bufr = res + (o*rdim + m)*inner; 
+      for (i=0; i<inner; i++) {
+	bufs = src + o*dim*inner + i; 
+	s = 0.0; 
+	for (k=-3; k<=3; k++) {
+	  xx = 2*m + k; 
+	  if (dim == 1) 
+	    xx = 0; 
+	  else /* Repeated mirroring is needed for small dimensions */
+	    while ((xx<0) || (xx>(int)(dim-1))) 
+	      xx = CUBIC_SPLINE_MIRROR(xx, (int)(dim-1), (int)two_ddim); 
+	  s += w[ABS(k)] * bufs[xx*inner]; 
+	}
+	bufr[i] = s; 
+      }
+    }
+
+  return; 
+}
+
+
+void cubic_spline_reduce(PyArrayObject* res, const PyArrayObject* src)
+{
+  double *buf, *aux, *tmp; 
+  size_t size, outer, inner; 
+  unsigned int axis, k, dim[NPY_MAXDIMS]; 
+
+  /* Work buffers */ 
+  size = PyArray_SIZE(src); 
+  buf = (double*)malloc(size*sizeof(double)); 
+  aux = (double*)malloc(size*sizeof(double)); 
+  memcpy((void*)buf, PyArray_DATA(src), size*sizeof(double)); 
+  for(axis=0; axis<src->nd; axis++) 
+    dim[axis] = PyArray_DIM(src, axis); 
+
+  /* Apply separable reductions */
+  for(axis=0; axis<src->nd; axis++) {
+    if (PyArray_DIM(res, axis) == dim[axis]) 
+      continue; 
+    for (k=0, outer=1; k<axis; k++) 
+      outer *= dim[k]; 
+    for (k=axis+1, inner=1; k<src->nd; k++) 
+      inner *= dim[k]; 
+    _cubic_spline_reduce_axis(aux, buf, outer, dim[axis], inner); 
+    dim[axis] = (dim[axis]+1)/2; 
+    tmp = buf; buf = aux; aux = tmp; 
+  }
+
+  /* Copy result */ 
+  memcpy(PyArray_DATA(res), (void*)buf, PyArray_SIZE(res)*sizeof(double)); 
+
+  /* Free work buffers */ 
+  free(buf); 
+  free(aux); 
+
+  return; 
+}
+
+
+
+/* 
+   Mirror an integer coordinate into [0, ddim]. Same as
+   CUBIC_SPLINE_MIRROR in the domain where the sampling routines use
+   it, and safe for any coordinate. 
+*/
+static inline int _cubic_spline_mirror(int xx, int ddim)
+{
+  int period = 2*ddim; 
+
+  if (ddim == 0) 
+    return 0; 
+  if (xx < 0) 
+    xx = -xx; 
+  xx %= period; 
+  if (xx > ddim) 
+    return period - xx; 
+  return xx; 
+}
+
+/* 
+   B-spline weights and (mirrored) coefficient offsets for the 4
+   coefficients contributing to the interpolated value at x. The
+   weights are computed in closed form from the fractional part of
+   x. Returns 0 if x is outside [-ddim, 2*ddim], like the sampling
+   routines. 
+*/
+static inline int _cubic_spline_weights(double x, int ddim, int stride, double* w, int* off)
+{
+  double aux = x + ddim, f, g; 
+  int n, k; 
+
+  if ((aux<0) || (aux>3*ddim)) 
+    return 0; 
+
+  /* n = floor(x) */ 
+  n = (int)aux - ddim; 
+  f = x - n; 
+  g = 1 - f; 
+  w[0] = g*g*g*(1.0/6.0); 
+  w[1] = (2.0/3.0) - f*f + .5*f*f*f; 
+  w[2] = (2.0/3.0) - g*g + .5*g*g*g; 
+  w[3] = f*f*f*(1.0/6.0); 
+
+  /* Mirror conditions are only needed close to the borders */ 
+  if ((n >= 1) && (n+2 <= ddim)) 
+    for (k=0; k<4; k++) 
+      off[k] = stride*(n-1+k); 
+  else 
+    for (k=0; k<4; k++) 
+      off[k] = stride*_cubic_spline_mirror(n-1+k, ddim); 
+
+  return 1; 
+}
+
+
+/* 
+   Affine resampling kernels. 
+
+   Output voxels are visited row by row along the last axis. The
+   transformed coordinates of each row origin are computed once and
+   then stepped incrementally. When the transformation leaves a
+   coordinate constant along rows (e.g. no rotation mixing the last
+   axis with the first ones), its weights are computed once per
+   row. The last axis of the coefficient image, which is contiguous
+   in C order, is accumulated innermost with the 4 taps unrolled so
+   that the compiler may vectorize them. Instantiated for DOUBLE and
+   FLOAT coefficient images. 
+*/ 
+#define CUBIC_SPLINE_RESAMPLE3D(NAME, TYPE)				\
+static void NAME(PyArrayObject* res, const PyArrayObject* Coef,		\
+		 const double* Tvox, int bounded)			\
+{									\
+  const TYPE *coef = (const TYPE*)PyArray_DATA(Coef), *c;		\
+  int ddimX = PyArray_DIM(Coef, 0)-1;					\
+  int ddimY = PyArray_DIM(Coef, 1)-1;					\
+  int ddimZ = PyArray_DIM(Coef, 2)-1;					\
+  int offX = PyArray_STRIDE(Coef, 0)/sizeof(TYPE);			\
+  int offY = PyArray_STRIDE(Coef, 1)/sizeof(TYPE);			\
+  int offZ = PyArray_STRIDE(Coef, 2)/sizeof(TYPE);			\
+  npy_intp dimX = PyArray_DIM(res, 0);					\
+  npy_intp dimY = PyArray_DIM(res, 1);					\
+  npy_intp dimZ = PyArray_DIM(res, 2);					\
+  npy_intp x, y, z;							\
+  double wx[4], wy[4], wz[4];						\
+  int ox[4], oy[4], oz[4];						\
+  int a, b, okx=0, oky=0, okz;						\
+  int rowx = (Tvox[2]==0.0), rowy = (Tvox[6]==0.0);			\
+  double Tx, Ty, Tz, Rx, Ry, Rz, s, sy;					\
+  char* row;								\
+									\
+  for (x=0; x<dimX; x++)						\
+    for (y=0; y<dimY; y++) {						\
+									\
+      row = (char*)PyArray_DATA(res) + x*PyArray_STRIDE(res, 0) + y*PyArray_STRIDE(res, 1); \
+									\
+      /* Transformed coordinates of the row origin */			\
+      Rx = Tvox[0]*x; Rx += Tvox[1]*y; Rx += Tvox[3];			\
+      Ry = Tvox[4]*x; Ry += Tvox[5]*y; Ry += Tvox[7];			\
+      Rz = Tvox[8]*x; Rz += Tvox[9]*y; Rz += Tvox[11];			\
+      if (rowx)								\
+	okx = _cubic_spline_weights(Rx, ddimX, offX, wx, ox);		\
+      if (rowy)								\
+	oky = _cubic_spline_weights(Ry, ddimY, offY, wy, oy);		\
+									\
+      for (z=0; z<dimZ; z++) {						\
+	Tx = Rx + Tvox[2]*z;						\
+	Ty = Ry + Tvox[6]*z;						\
+	Tz = Rz + Tvox[10]*z;						\
+	s = 0.0;							\
+									\
+	if (bounded && ((Tx<0) || (Tx>ddimX) ||				\
+			(Ty<0) || (Ty>ddimY) ||				\
+			(Tz<0) || (Tz>ddimZ)))				\
+	  okz = 0;							\
+	else {								\
+	  if (!rowx)							\
+	    okx = _cubic_spline_weights(Tx, ddimX, offX, wx, ox);	\
+	  if (!rowy)							\
+	    oky = _cubic_spline_weights(Ty, ddimY, offY, wy, oy);	\
+	  okz = okx && oky &&						\
+	    _cubic_spline_weights(Tz, ddimZ, offZ, wz, oz);		\
+	}								\
+									\
+	if (okz)							\
+	  for (a=0; a<4; a++) {						\
+	    sy = 0.0;							\
+	    for (b=0; b<4; b++) {					\
+	      c = coef + ox[a] + oy[b];					\
+	      sy += wy[b]*(wz[0]*c[oz[0]] + wz[1]*c[oz[1]] +		\
+			   wz[2]*c[oz[2]] + wz[3]*c[oz[3]]);		\
+	    }								\
+	    s += wx[a]*sy;						\
+	  }								\
+									\
+	*((double*)(row + z*PyArray_STRIDE(res, 2))) = s;		\
+      }									\
+    }									\
+									\
+  return;								\
+}
+
+CUBIC_SPLINE_RESAMPLE3D(_cubic_spline_resample3d_double, double)
+CUBIC_SPLINE_RESAMPLE3D(_cubic_spline_resample3d_float, float)
+
+
+/* 
+   Same as above for a 4d coefficient image. The first three
+   coordinates are affine in the output voxel, and the fourth one is
+   read from the double buffer tt, of the same shape as the
+   output. The output and time buffers are passed as raw data and
+   byte strides so that the kernel may run on frames of a batch
+   without the Python API. 
+*/ 
+#define CUBIC_SPLINE_RESAMPLE4D(NAME, TYPE)				\
+static void NAME(char* res, const npy_intp* dims, const npy_intp* rstrides, \
+		 const PyArrayObject* Coef, const double* Tvox,		\
+		 const char* tt, const npy_intp* tstrides, int bounded)	\
+{									\
+  const TYPE *coef = (const TYPE*)PyArray_DATA(Coef), *c;		\
+  int ddimX = PyArray_DIM(Coef, 0)-1;					\
+  int ddimY = PyArray_DIM(Coef, 1)-1;					\
+  int ddimZ = PyArray_DIM(Coef, 2)-1;					\
+  int ddimT = PyArray_DIM(Coef, 3)-1;					\
+  int offX = PyArray_STRIDE(Coef, 0)/sizeof(TYPE);			\
+  int offY = PyArray_STRIDE(Coef, 1)/sizeof(TYPE);			\
+  int offZ = PyArray_STRIDE(Coef, 2)/sizeof(TYPE);			\
+  int offT = PyArray_STRIDE(Coef, 3)/sizeof(TYPE);			\
+  npy_intp dimX = dims[0], dimY = dims[1], dimZ = dims[2];		\
+  npy_intp x, y, z;							\
+  double wx[4], wy[4], wz[4], wt[4];					\
+  int ox[4], oy[4], oz[4], ot[4];					\
+  int a, b, d, okx=0, oky=0, ok;					\
+  int rowx = (Tvox[2]==0.0), rowy = (Tvox[6]==0.0);			\
+  double Tx, Ty, Tz, Rx, Ry, Rz, t, s, sy, sz;				\
+  char *row;								\
+  const char *trow;							\
+									\
+  for (x=0; x<dimX; x++)						\
+    for (y=0; y<dimY; y++) {						\
+									\
+      row = res + x*rstrides[0] + y*rstrides[1];			\
+      trow = tt + x*tstrides[0] + y*tstrides[1];			\
+									\
+      /* Transformed coordinates of the row origin */			\
+      Rx = Tvox[0]*x; Rx += Tvox[1]*y; Rx += Tvox[3];			\
+      Ry = Tvox[4]*x; Ry += Tvox[5]*y; Ry += Tvox[7];			\
+      Rz = Tvox[8]*x; Rz += Tvox[9]*y; Rz += Tvox[11];			\
+      if (rowx)								\
+	okx = _cubic_spline_weights(Rx, ddimX, offX, wx, ox);		\
+      if (rowy)								\
+	oky = _cubic_spline_weights(Ry, ddimY, offY, wy, oy);		\
+									\
+      for (z=0; z<dimZ; z++) {						\
+	Tx = Rx + Tvox[2]*z;						\
+	Ty = Ry + Tvox[6]*z;						\
+	Tz = Rz + Tvox[10]*z;						\
+	t = *((const double*)(trow + z*tstrides[2]));			\
+	s = 0.0;							\
+									\
+	if (bounded && ((Tx<0) || (Tx>ddimX) ||				\
+			(Ty<0) || (Ty>ddimY) ||				\
+			(Tz<0) || (Tz>ddimZ) ||				\
+			(t<0) || (t>ddimT)))				\
+	  ok = 0;							\
+	else {								\
+	  if (!rowx)							\
+	    okx = _cubic_spline_weights(Tx, ddimX, offX, wx, ox);	\
+	  if (!rowy)							\
+	    oky = _cubic_spline_weights(Ty, ddimY, offY, wy, oy);	\
+	  ok = okx && oky &&						\
+	    _cubic_spline_weights(Tz, ddimZ, offZ, wz, oz) &&		\
+	    _cubic_spline_weights(t, ddimT, offT, wt, ot);		\
+	}								\
+									\
+	if (ok)								\
+	  for (a=0; a<4; a++) {						\
+	    sy = 0.0;							\
+	    for (b=0; b<4; b++) {					\
+	      sz = 0.0;							\
+	      for (d=0; d<4; d++) {					\
+		c = coef + ox[a] + oy[b] + oz[d];			\
+		sz += wz[d]*(wt[0]*c[ot[0]] + wt[1]*c[ot[1]] +		\
+			     wt[2]*c[ot[2]] + wt[3]*c[ot[3]]);		\
+	      }								\
+	      sy += wy[b]*sz;						\
+	    }								\
+	    s += wx[a]*sy;						\
+	  }								\
+									\
+	*((double*)(row + z*rstrides[2])) = s;				\
+      }									\
+    }									\
+									\
+  return;								\
+}
+
+CUBIC_SPLINE_RESAMPLE4D(_cubic_spline_resample4d_double, double)
+CUBIC_SPLINE_RESAMPLE4D(_cubic_spline_resample4d_float, float)
+
+
+/* 
+   Fourth coordinate of the voxels at transformed slice coordinate z
+   in a frame acquired at time t0, computed as Image4d.from_time
+   does from the slice acquisition times (see routines.slice_time).
+*/
+static inline double _cubic_spline_slice_time(double z, double t0, 
+					      const cubic_spline_slice_timing* timing)
+{
+  const double* s = timing->slice_order; 
+  unsigned int nslices = timing->nslices; 
+  unsigned int zfloor, cycles, zl; 
+  double weight, slice_interp; 
+
+  if (timing->reversed)
+    z = timing->last_slice - z; 
+  zfloor = (unsigned int)z; 
+  cycles = zfloor / nslices; 
+  zl = zfloor % nslices; 
+  weight = z - zfloor; 
+  if (zl < (nslices-1))
+    slice_interp = (1-weight)*s[zl] + weight*s[zl+1]; 
+  else
+    slice_interp = (1-weight)*s[zl] + weight*nslices; 
+
+  return (t0 - timing->start - (cycles + timing->tr_slices*slice_interp))/timing->tr; 
+}
+
+/* 
+   Frames sharing one transformation, resampled together: the
+   spatial weights and the slice time of each output voxel are
+   computed once for all the frames, which only differ by their
+   temporal weights. Each frame is accumulated in the same order as
+   by the kernels above. 
+*/
+#define CUBIC_SPLINE_RESAMPLE4D_SLICES(NAME, TYPE)			\
+static void NAME(char* res, npy_intp nframes, const npy_intp* dims,	\
+		 const npy_intp* rstrides, const PyArrayObject* Coef,	\
+		 const double* Tvox, const double* times,		\
+		 const cubic_spline_slice_timing* timing, double shift, int bounded) \
+{									\
+  const TYPE *coef = (const TYPE*)PyArray_DATA(Coef), *c;		\
+  int ddimX = PyArray_DIM(Coef, 0)-1;					\
+  int ddimY = PyArray_DIM(Coef, 1)-1;					\
+  int ddimZ = PyArray_DIM(Coef, 2)-1;					\
+  int ddimT = PyArray_DIM(Coef, 3)-1;					\
+  int offX = PyArray_STRIDE(Coef, 0)/sizeof(TYPE);			\
+  int offY = PyArray_STRIDE(Coef, 1)/sizeof(TYPE);			\
+  int offZ = PyArray_STRIDE(Coef, 2)/sizeof(TYPE);			\
+  int offT = PyArray_STRIDE(Coef, 3)/sizeof(TYPE);			\
+  npy_intp dimX = dims[0], dimY = dims[1], dimZ = dims[2];		\
+  npy_intp x, y, z, f;							\
+  double wx[4], wy[4], wz[4], wt[4];					\
+  int ox[4], oy[4], oz[4], ot[4];					\
+  int a, b, d, okx=0, oky=0, ok;					\
+  int rowx = (Tvox[2]==0.0), rowy = (Tvox[6]==0.0);			\
+  double Tx, Ty, Tz, Rx, Ry, Rz, t, s, sy, sz;				\
+  char *row;								\
+									\
+  for (x=0; x<dimX; x++)						\
+    for (y=0; y<dimY; y++) {						\
+									\
+      row = res + x*rstrides[1] + y*rstrides[2];			\
+									\
+      /* Transformed coordinates of the row origin */			\
+      Rx = Tvox[0]*x; Rx += Tvox[1]*y; Rx += Tvox[3];			\
+      Ry = Tvox[4]*x; Ry += Tvox[5]*y; Ry += Tvox[7];			\
+      Rz = Tvox[8]*x; Rz += Tvox[9]*y; Rz += Tvox[11];			\
+      if (rowx)								\
+	okx = _cubic_spline_weights(Rx, ddimX, offX, wx, ox);		\
+      if (rowy)								\
+	oky = _cubic_spline_weights(Ry, ddimY, offY, wy, oy);		\
+									\
+      for (z=0; z<dimZ; z++) {						\
+	Tx = Rx + Tvox[2]*z;						\
+	Ty = Ry + Tvox[6]*z;						\
+	Tz = Rz + Tvox[10]*z;						\
+									\
+	/* Spatial weights */						\
+	if (bounded && ((Tx<0) || (Tx>ddimX) ||				\
+			(Ty<0) || (Ty>ddimY) ||				\
+			(Tz<0) || (Tz>ddimZ)))				\
+	  ok = 0;							\
+	else {								\
+	  if (!rowx)							\
+	    okx = _cubic_spline_weights(Tx, ddimX, offX, wx, ox);	\
+	  if (!rowy)							\
+	    oky = _cubic_spline_weights(Ty, ddimY, offY, wy, oy);	\
+	  ok = okx && oky &&						\
+	    _cubic_spline_weights(Tz, ddimZ, offZ, wz, oz);		\
+	}								\
+									\
+	for (f=0; f<nframes; f++) {					\
+	  s = 0.0;							\
+	  if (ok) {							\
+	    t = _cubic_spline_slice_time(Tz, times[f], timing) - shift; \
+	    if ((!bounded || ((t>=0) && (t<=ddimT))) &&			\
+		_cubic_spline_weights(t, ddimT, offT, wt, ot))		\
+	      for (a=0; a<4; a++) {					\
+		sy = 0.0;						\
+		for (b=0; b<4; b++) {					\
+		  sz = 0.0;						\
+		  for (d=0; d<4; d++) {					\
+		    c = coef + ox[a] + oy[b] + oz[d];			\
+		    sz += wz[d]*(wt[0]*c[ot[0]] + wt[1]*c[ot[1]] +	\
+				 wt[2]*c[ot[2]] + wt[3]*c[ot[3]]);	\
+		  }							\
+		  sy += wy[b]*sz;					\
+		}							\
+		s += wx[a]*sy;						\
+	      }								\
+	  }								\
+	  *((double*)(row + f*rstrides[0] + z*rstrides[3])) = s;	\
+	}								\
+      }									\
+    }									\
+									\
+  return;								\
+}
+
+CUBIC_SPLINE_RESAMPLE4D_SLICES(_cubic_spline_resample4d_slices_double, double)
+CUBIC_SPLINE_RESAMPLE4D_SLICES(_cubic_spline_resample4d_slices_float, float)
+
+
+void cubic_spline_resample3d(PyArrayObject* res, const PyArrayObject* coef, 
+			     const double* Tvox, int bounded)
+{
+  if (PyArray_TYPE(coef) == NPY_FLOAT) 
+    _cubic_spline_resample3d_float(res, coef, Tvox, bounded); 
+  else 
+    _cubic_spline_resample3d_double(res, coef, Tvox, bounded); 
+  return; 
+}
+
+typedef void (*_resample4d_kernel)(char*, const npy_intp*, const npy_intp*, 
+				   const PyArrayObject*, const double*, 
+				   const char*, const npy_intp*, int); 
+
+static _resample4d_kernel _cubic_spline_resample4d_kernel(const PyArrayObject* coef)
+{
+  if (PyArray_TYPE(coef) == NPY_FLOAT) 
+    return &_cubic_spline_resample4d_float; 
+  return &_cubic_spline_resample4d_double; 
+}
+
+void cubic_spline_resample4d(PyArrayObject* res, const PyArrayObject* coef, 
+			     const double* Tvox, const PyArrayObject* t, int bounded)
+{
+  _resample4d_kernel kernel = _cubic_spline_resample4d_kernel(coef); 
+
+  /* Other Python threads, e.g. estimating other frames, may run
+     meanwhile */ 
+  Py_BEGIN_ALLOW_THREADS
+  kernel((char*)PyArray_DATA(res), PyArray_DIMS(res), PyArray_STRIDES(res), 
+	 coef, Tvox, (const char*)PyArray_DATA(t), PyArray_STRIDES(t), bounded); 
+  Py_END_ALLOW_THREADS
+
+  return; 
+}
+
+
+/* Frames of a batch are split across threads */ 
+typedef struct {
+  _resample4d_kernel kernel; 
+  PyArrayObject* res; 
+  const PyArrayObject* coef; 
+  const double* Tvox; 
+  const PyArrayObject* t; 
+  int bounded; 
+} _resample4d_frames_job; 
+
+static void _resample4d_frames_job_run(int rank, int nthreads, void* params)
+{
+  _resample4d_frames_job* job = (_resample4d_frames_job*)params; 
+  const npy_intp* rstrides = PyArray_STRIDES(job->res); 
+  const npy_intp* tstrides = PyArray_STRIDES(job->t); 
+  size_t k, k0, k1; 
+
+  fff_parallel_range(PyArray_DIM(job->res, 0), rank, nthreads, &k0, &k1); 
+  for (k=k0; k<k1; k++) 
+    job->kernel((char*)PyArray_DATA(job->res) + k*rstrides[0], 
+		PyArray_DIMS(job->res)+1, rstrides+1, 
+		job->coef, job->Tvox + 16*k, 
+		(const char*)PyArray_DATA(job->t) + k*tstrides[0], tstrides+1, 
+		job->bounded); 
+
+  return; 
+}
+
+void cubic_spline_resample4d_frames(PyArrayObject* res, const PyArrayObject* coef, 
+				    const double* Tvox, const PyArrayObject* t, int bounded, 
+				    int nthreads)
+{
+  _resample4d_frames_job job; 
+  npy_intp nframes = PyArray_DIM(res, 0); 
+
+  job.kernel = _cubic_spline_resample4d_kernel(coef); 
+  job.res = res; 
+  job.coef = coef; 
+  job.Tvox = Tvox; 
+  job.t = t; 
+  job.bounded = bounded; 
+
+  nthreads = fff_threads_count(nthreads); 
+  if (nthreads > nframes) 
+    nthreads = (int)nframes; 
+  if (nthreads < 1) 
+    return; 
+
+  Py_BEGIN_ALLOW_THREADS
+  fff_parallel_run(nthreads, &_resample4d_frames_job_run, (void*)&job); 
+  Py_END_ALLOW_THREADS
+
+  return; 
+}
+
+
+
+/* The frames of each thread are processed by runs of consecutive
+   frames with the same transformation */ 
+typedef struct {
+  PyArrayObject* res; 
+  const PyArrayObject* coef; 
+  const double* Tvox; 
+  const double* times; 
+  const cubic_spline_slice_timing* timing; 
+  double shift; 
+  int bounded; 
+} _resample4d_slices_job; 
+
+static void _resample4d_slices_job_run(int rank, int nthreads, void* params)
+{
+  _resample4d_slices_job* job = (_resample4d_slices_job*)params; 
+  const npy_intp* rstrides = PyArray_STRIDES(job->res); 
+  size_t k, l, k0, k1; 
+
+  fff_parallel_range(PyArray_DIM(job->res, 0), rank, nthreads, &k0, &k1); 
+  for (k=k0; k<k1; k=l) {
+    for (l=k+1; l<k1; l++)
+      if (memcmp(job->Tvox + 16*l, job->Tvox + 16*k, 16*sizeof(double)))
+	break; 
+    if (PyArray_TYPE(job->coef) == NPY_FLOAT) 
+      _cubic_spline_resample4d_slices_float((char*)PyArray_DATA(job->res) + k*rstrides[0], 
+					    l-k, PyArray_DIMS(job->res)+1, rstrides, 
+					    job->coef, job->Tvox + 16*k, job->times + k, 
+					    job->timing, job->shift, job->bounded); 
+    else 
+      _cubic_spline_resample4d_slices_double((char*)PyArray_DATA(job->res) + k*rstrides[0], 
+					     l-k, PyArray_DIMS(job->res)+1, rstrides, 
+					     job->coef, job->Tvox + 16*k, job->times + k, 
+					     job->timing, job->shift, job->bounded); 
+  }
+
+  return; 
+}
+
+void cubic_spline_resample4d_slices(PyArrayObject* res, const PyArrayObject* coef, 
+				    const double* Tvox, const double* times, 
+				    const cubic_spline_slice_timing* timing, double shift, 
+				    int bounded, int nthreads)
+{
+  _resample4d_slices_job job; 
+  npy_intp nframes = PyArray_DIM(res, 0); 
+
+  job.res = res; 
+  job.coef = coef; 
+  job.Tvox = Tvox; 
+  job.times = times; 
+  job.timing = timing; 
+  job.shift = shift; 
+  job.bounded = bounded; 
+
+  nthreads = fff_threads_count(nthreads); 
+  if (nthreads > nframes) 
+    nthreads = (int)nframes; 
+  if (nthreads < 1) 
+    return; 
+
+  Py_BEGIN_ALLOW_THREADS
+  fff_parallel_run(nthreads, &_resample4d_slices_job_run, (void*)&job); 
+  Py_END_ALLOW_THREADS
+
+  return; 
+}
+
+
+
 /* 
 
 Assumes: -(dimX-1) <= x <= 2*(dimX-1) 
@@ -36,17 +36,128 @@ extern "C" {
   */
   extern double cubic_spline_basis(double x); 
   /*! 
-    \brief Cubic spline transform of a one-dimensional signal 
-    \param src input signal 
-    \param res output signal (same size)
+    \brief Cubic spline transform of an array
+    \param src input array
+    \param res output double array (same size)
+    \param nthreads number of threads (all available processors if
+    nthreads<=0)
+
+    The result does not depend on \a nthreads.
+  */
+  extern void cubic_spline_transform(PyArrayObject* res, const PyArrayObject* src, int nthreads);
+  /*! 
+    \brief In-place cubic spline transform of a double array along one axis
+    \param res double array
+    \param axis transformed axis
+    \param nthreads number of threads (all available processors if
+    nthreads<=0)
+  */
+  extern void cubic_spline_transform_axis(PyArrayObject* res, int axis, int nthreads);
+
+  /*! 
+    \brief Smooth and decimate an image by a factor two 
+    \param res output image
+    \param src input image
+
+    Both images are C-contiguous DOUBLE arrays with the same number of
+    dimensions. Along each axis, the output size is either the input
+    size, in which case the axis is left untouched, or (n+1)/2, in
+    which case output sample m is the input signal at 2m smoothed by
+    the cubic B-spline dilated by two.
   */
-  extern void cubic_spline_transform(PyArrayObject* res, const PyArrayObject* src);
+  extern void cubic_spline_reduce(PyArrayObject* res, const PyArrayObject* src);
 
   extern double cubic_spline_sample1d(double x, const PyArrayObject* coef); 
   extern double cubic_spline_sample2d(double x, double y, const PyArrayObject* coef); 
   extern double cubic_spline_sample3d(double x, double y, double z, const PyArrayObject* coef); 
   extern double cubic_spline_sample4d(double x, double y, double z, double t, const PyArrayObject* coef); 
 
+  /*! 
+    \brief Resample a cubic spline image through an affine transformation
+    \param res output image (3d, DOUBLE) 
+    \param coef cubic spline coefficients (3d, DOUBLE or FLOAT)
+    \param Tvox voxel transformation from res to coef (C-contiguous 12 or 16-sized)
+    \param bounded if non-zero, points outside the image domain are set
+    to zero; otherwise mirror conditions are used as in \c cubic_spline_sample3d
+
+    Equivalent to calling \c cubic_spline_sample3d at each transformed
+    output voxel (up to rounding errors), with incremental coordinates
+    and closed-form kernel weights. A FLOAT coefficient image halves
+    the memory traffic.
+  */
+  extern void cubic_spline_resample3d(PyArrayObject* res, const PyArrayObject* coef, 
+				      const double* Tvox, int bounded); 
+
+  /*! 
+    \brief Same as \c cubic_spline_resample3d for a 4d coefficient image
+    \param t fourth coordinate of each output voxel (3d DOUBLE, same shape as res)
+  */
+  extern void cubic_spline_resample4d(PyArrayObject* res, const PyArrayObject* coef, 
+				      const double* Tvox, const PyArrayObject* t, int bounded); 
+
+  /*! 
+    \brief Resample several frames of a 4d cubic spline image at once
+    \param res output frames (4d DOUBLE, frame index first)
+    \param coef cubic spline coefficients (4d, DOUBLE or FLOAT)
+    \param Tvox per-frame voxel transformations (C-contiguous, 16 values per frame)
+    \param t fourth coordinate of each output voxel (4d DOUBLE, same shape as res)
+    \param bounded see \c cubic_spline_resample3d
+    \param nthreads number of threads (all available processors if
+    nthreads<=0)
+
+    Same as calling \c cubic_spline_resample4d on each frame, frames
+    being distributed across threads. The result does not depend on
+    \a nthreads. 
+  */
+  extern void cubic_spline_resample4d_frames(PyArrayObject* res, const PyArrayObject* coef, 
+					     const double* Tvox, const PyArrayObject* t, int bounded, 
+					     int nthreads); 
+
+  /*! 
+    \brief Slice acquisition timing of a 4d image
+
+    Slice \a s of the scan acquired at time \a t0 is acquired at
+    time \a t0 + \a tr_slices * \a slice_order[s], and is sampled
+    at the fourth coordinate (\a t0 + that time - \a start) / \a tr,
+    as in \c Image4d.from_time. Non-integer slice coordinates are
+    linearly interpolated, see \c routines.slice_time. If \a
+    reversed is non-zero, slice coordinates z are counted as \a
+    last_slice - z.
+  */
+  typedef struct {
+    double start; 
+    double tr; 
+    double tr_slices; 
+    const double* slice_order; 
+    unsigned int nslices; 
+    int reversed; 
+    double last_slice; 
+  } cubic_spline_slice_timing; 
+
+  /*! 
+    \brief Resample several frames of a 4d cubic spline image with slice timing 
+    \param res output frames (4d DOUBLE, frame index first)
+    \param coef cubic spline coefficients (4d, DOUBLE or FLOAT)
+    \param Tvox per-frame voxel transformations (C-contiguous, 16 values per frame)
+    \param times acquisition time of each frame
+    \param timing slice acquisition timing 
+    \param shift offset subtracted from the fourth coordinates 
+    \param bounded see \c cubic_spline_resample3d
+    \param nthreads number of threads (all available processors if
+    nthreads<=0)
+
+    Same as \c cubic_spline_resample4d_frames, the fourth coordinate
+    of each output voxel being computed on the fly from its
+    transformed slice coordinate rather than read from an array as
+    large as \a res. Consecutive frames with the same transformation
+    share the spatial weights of each voxel. The result does not
+    depend on \a nthreads.
+  */
+  extern void cubic_spline_resample4d_slices(PyArrayObject* res, const PyArrayObject* coef, 
+					     const double* Tvox, const double* times, 
+					     const cubic_spline_slice_timing* timing, double shift, 
+					     int bounded, int nthreads); 
+
     
 
 #ifdef __cplusplus
@@ -1,7 +1,8 @@
 #include "iconic.h"
 #include "cubic_spline.h"
 
-#include <randomkit.h>
+#include <rk_counter.h>
+#include <fff_threads.h>
 
 #include <math.h>
 #include <stdlib.h>
@@ -24,18 +25,15 @@
 
 
 
+static void _nlogn_table_init(void); 
+static inline double _nlogn(double h); 
+static int _nlogn_table_ready; 
+
 static double _marginalize(double* h, 
 			   const double* H, 
 			   unsigned int clampI, 
 			   unsigned int clampJ, 
 			   int axis); 
-static inline void _apply_affine_transform(double* Tx, 
-					   double* Ty, 
-					   double* Tz, 
-					   const double* Tvox, 
-					   size_t x, 
-					   size_t y, 
-					   size_t z); 
 static inline void _pv_interpolation(unsigned int i, 
 				     double* H, unsigned int clampJ, 
 				     const signed short* J, 
@@ -177,12 +175,104 @@ void local_histogram(double* H,
 
 
 
+/*
+   Sliding local histogram.
+
+   The block is moved along the last axis by removing its leaving
+   slab and adding its entering slab, which costs O(size^2) per voxel
+   instead of O(size^3). The moments are updated along with the
+   histogram. Counts and intensity sums are integers, hence exact, and
+   the sum of h*log(h) is reset at the start of each row.
+*/
+
+static inline void _local_histogram_update(double* H, local_moments* m,
+					   signed short i, double delta)
+{
+  double di = (double)i;
+
+  if (i < 0)
+    return;
+  m->hlogh -= _nlogn(H[i]);
+  H[i] += delta;
+  m->hlogh += _nlogn(H[i]);
+  m->n += delta;
+  m->s1 += delta*di;
+  m->s2 += delta*di*di;
+
+  return;
+}
+
+static void _local_histogram_slab(double* H, local_moments* m, const PyArrayObject* im,
+				  const npy_intp* left, const npy_intp* right,
+				  npy_intp z, double delta)
+{
+  npy_intp x, y;
+  const char *bufx, *bufy;
+
+  bufx = (const char*)PyArray_DATA(im) + left[0]*PyArray_STRIDE(im, 0) + z*PyArray_STRIDE(im, 2);
+  for (x=left[0]; x<right[0]; x++, bufx+=PyArray_STRIDE(im, 0)) {
+    bufy = bufx + left[1]*PyArray_STRIDE(im, 1);
+    for (y=left[1]; y<right[1]; y++, bufy+=PyArray_STRIDE(im, 1))
+      _local_histogram_update(H, m, *((const signed short*)bufy), delta);
+  }
+
+  return;
+}
+
+void local_histogram_sliding(double* H,
+			     local_moments* m,
+			     unsigned int clamp,
+			     PyArrayIterObject* iter,
+			     const unsigned int* size)
+{
+  PyArrayObject *im = iter->ao;
+  npy_intp left[3], right[3], center, halfsize, dim, z;
+  int i;
+
+  UPDATE_ITERATOR_COORDS(iter);
+
+  if (!_nlogn_table_ready)
+    _nlogn_table_init();
+
+  /* Block corners, see local_histogram */
+  for (i=0; i<3; i++) {
+    center = iter->coordinates[i];
+    halfsize = size[i]/2;
+    dim = PyArray_DIM(im, i);
+    left[i] = (center<halfsize) ? 0 : center-halfsize;
+    right[i] = center+halfsize+1;
+    if (right[i]>dim)
+      right[i] = dim;
+  }
+
+  /* Start of a row: compute the histogram from scratch */
+  center = iter->coordinates[2];
+  if (center == 0) {
+    memset((void*)H, 0, clamp*sizeof(double));
+    memset((void*)m, 0, sizeof(local_moments));
+    for (z=left[2]; z<right[2]; z++)
+      _local_histogram_slab(H, m, im, left, right, z, 1.0);
+    return;
+  }
+
+  /* Remove the leaving slab and add the entering one */
+  halfsize = size[2]/2;
+  z = center-halfsize-1;
+  if (z >= 0)
+    _local_histogram_slab(H, m, im, left, right, z, -1.0);
+  z = center+halfsize;
+  if (z < PyArray_DIM(im, 2))
+    _local_histogram_slab(H, m, im, left, right, z, 1.0);
+
+  return;
+}
+
 /* 
    
 JOINT HISTOGRAM COMPUTATION. 
   
 iterI : assumed to iterate over a signed short encoded, possibly
-non-contiguous array.
+non-contiguous 3d array. Only the underlying array is used.
 
 imJ_padded : assumed C-contiguous (last index varies faster) & signed
 short encoded.
@@ -203,157 +293,800 @@ Negative intensities are ignored.
     nn ++; }
 
 
-void joint_histogram(double* H, 
-		     unsigned int clampI, 
-		     unsigned int clampJ,  
-		     PyArrayIterObject* iterI,
-		     const PyArrayObject* imJ_padded, 
-		     const double* Tvox, 
-		     int interp)
-{
-  const signed short* J=(signed short*)imJ_padded->data; 
-  size_t dimJX=imJ_padded->dimensions[0]-2, dimJY=imJ_padded->dimensions[1]-2, dimJZ=imJ_padded->dimensions[2]-2;  
-  signed short Jnn[8]; 
-  double W[8]; 
-  signed short *bufI, *bufJnn; 
-  double *bufW; 
-  signed short i, j;
-  size_t off;
-  size_t u2 = imJ_padded->dimensions[2]; 
-  size_t u3 = u2+1; 
-  size_t u4 = imJ_padded->dimensions[1]*u2;
-  size_t u5 = u4+1; 
-  size_t u6 = u4+u2; 
-  size_t u7 = u6+1; 
-  double wx, wy, wz, wxwy, wxwz, wywz; 
-  double W0, W2, W3, W4; 
-  size_t x, y, z; 
-  int nn, nx, ny, nz;
-  double Tx, Ty, Tz; 
+/* 
+   Random interpolation parameters. Draws are a function of the seed
+   and of the current source voxel coordinates, which the kernels set
+   before each update, hence they do not depend on the processing
+   order. 
+*/
+typedef struct {
+  unsigned long seed; 
+  unsigned long x; 
+  unsigned long y; 
+  unsigned long z; 
+} rand_params; 
+
+
+/* 
+   Padded target image and interpolation method, shared by the
+   joint histogram kernels. 
+*/
+typedef struct {
+  const signed short* J; 
+  double dimX; /* Dimensions of the NON-PADDED grid */ 
+  double dimY; 
+  double dimZ; 
+  size_t u2; /* Offsets of neighbors 2..7 */
+  size_t u3; 
+  size_t u4; 
+  size_t u5; 
+  size_t u6; 
+  size_t u7; 
   void (*interpolate)(unsigned int, double*, unsigned int, const signed short*, const double*, int, void*); 
-  void* interp_params = NULL; 
-  rk_state rng; 
+  void* interp_params; 
+  rand_params rand; 
+} target_grid; 
 
-  /* Reset the source image iterator */
-  PyArray_ITER_RESET(iterI);
+
+static void _target_grid_init(target_grid* tg, 
+			      const PyArrayObject* imJ_padded, 
+			      int interp)
+{
+  tg->J = (signed short*)imJ_padded->data; 
+  tg->dimX = imJ_padded->dimensions[0]-2; 
+  tg->dimY = imJ_padded->dimensions[1]-2; 
+  tg->dimZ = imJ_padded->dimensions[2]-2;  
+  tg->u2 = imJ_padded->dimensions[2]; 
+  tg->u3 = tg->u2+1; 
+  tg->u4 = imJ_padded->dimensions[1]*tg->u2;
+  tg->u5 = tg->u4+1; 
+  tg->u6 = tg->u4+tg->u2; 
+  tg->u7 = tg->u6+1; 
+  tg->interp_params = NULL; 
 
   /* Set interpolation method */ 
   if (interp==0) 
-    interpolate = &_pv_interpolation;
+    tg->interpolate = &_pv_interpolation;
   else if (interp>0) 
-    interpolate = &_tri_interpolation; 
+    tg->interpolate = &_tri_interpolation; 
   else { /* interp < 0 */ 
-    interpolate = &_rand_interpolation;
-    rk_seed(-interp, &rng); 
-    interp_params = (void*)(&rng); 
+    tg->interpolate = &_rand_interpolation;
+    tg->rand.seed = (unsigned long)(-interp); 
+    tg->interp_params = (void*)(&tg->rand); 
   }
 
-  /* Re-initialize joint histogram */ 
-  memset((void*)H, 0, clampI*clampJ*sizeof(double));
+  return; 
+}
 
-  /* Looop over source voxels */
-  while(iterI->index < iterI->size) {
-  
-    /* Source voxel intensity */
-    bufI = (signed short*)PyArray_ITER_DATA(iterI); 
-    i = bufI[0];
 
-    /* Source voxel coordinates */
-    x = iterI->coordinates[0];
-    y = iterI->coordinates[1];
-    z = iterI->coordinates[2];
-    
-    /* Compute the transformed grid coordinates of current voxel */ 
-    _apply_affine_transform(&Tx, &Ty, &Tz, Tvox, x, y, z); 
-    
-    /* Test whether the current voxel is below the intensity
-       threshold, or the transformed point is completly outside
-       the reference grid */
-    if ((i>=0) && 
-	(Tx>-1) && (Tx<dimJX) && 
-	(Ty>-1) && (Ty<dimJY) && 
-	(Tz>-1) && (Tz<dimJZ)) {
+/* 
+   Add the contribution of a source voxel with intensity i that
+   transforms to (Tx, Ty, Tz) in the target grid. 
+*/ 
+static inline void _joint_histogram_update(double* H, 
+					   unsigned int clampJ, 
+					   signed short i, 
+					   double Tx, 
+					   double Ty, 
+					   double Tz, 
+					   const target_grid* tg)
+{
+  const signed short* J = tg->J; 
+  signed short Jnn[8]; 
+  double W[8]; 
+  signed short *bufJnn, j; 
+  double *bufW; 
+  size_t off;
+  double wx, wy, wz, wxwy, wxwz, wywz; 
+  double W0, W2, W3, W4; 
+  int nn, nx, ny, nz;
+
+  /* Test whether the transformed point is completly outside the
+     reference grid */
+  if (!((Tx>-1) && (Tx<tg->dimX) && 
+	(Ty>-1) && (Ty<tg->dimY) && 
+	(Tz>-1) && (Tz<tg->dimZ))) 
+    return; 
 	
-      /* 
-	 Nearest neighbor (floor coordinates in the padded
-	 image, hence +1). 
-	 
-	 Notice that using the floor function doubles excetution time.
-	 
-	 FIXME: see if we can replace this with assembler instructions. 
-      */
-      nx = FLOOR(Tx) + 1;
-      ny = FLOOR(Ty) + 1;
-      nz = FLOOR(Tz) + 1;
+  /* 
+     Nearest neighbor (floor coordinates in the padded image, hence
+     +1). As Tx>-1, FLOOR(Tx)+1 is 0 if Tx<0 and (int)Tx+1 otherwise.
+  */
+  nx = (int)Tx + (Tx>=0);
+  ny = (int)Ty + (Ty>=0);
+  nz = (int)Tz + (Tz>=0);
       
-      /* The convention for neighbor indexing is as follows:
-       *
-       *   Floor slice        Ceil slice
-       *
-       *     2----6             3----7                     y          
-       *     |    |             |    |                     ^ 
-       *     |    |             |    |                     |
-       *     0----4             1----5                     ---> x
-       */
+  /* The convention for neighbor indexing is as follows:
+   *
+   *   Floor slice        Ceil slice
+   *
+   *     2----6             3----7                     y          
+   *     |    |             |    |                     ^ 
+   *     |    |             |    |                     |
+   *     0----4             1----5                     ---> x
+   */
       
-      /*** Trilinear interpolation weights.  
-	   Note: wx = nnx + 1 - Tx, where nnx is the location in
-	   the NON-PADDED grid */ 
-      wx = nx - Tx; 
-      wy = ny - Ty;
-      wz = nz - Tz;
-      wxwy = wx*wy;    
-      wxwz = wx*wz;
-      wywz = wy*wz;
+  /*** Trilinear interpolation weights.  
+       Note: wx = nnx + 1 - Tx, where nnx is the location in
+       the NON-PADDED grid */ 
+  wx = nx - Tx; 
+  wy = ny - Ty;
+  wz = nz - Tz;
+  wxwy = wx*wy;    
+  wxwz = wx*wz;
+  wywz = wy*wz;
       
-      /*** Prepare buffers */ 
-      bufJnn = Jnn;
-      bufW = W; 
+  /*** Prepare buffers */ 
+  bufJnn = Jnn;
+  bufW = W; 
       
-      /*** Initialize neighbor list */
-      off = nx*u4 + ny*u2 + nz; 
-      nn = 0; 
+  /*** Initialize neighbor list */
+  off = nx*tg->u4 + ny*tg->u2 + nz; 
+  nn = 0; 
       
-      /*** Neighbor 0: (0,0,0) */ 
-      W0 = wxwy*wz; 
-      APPEND_NEIGHBOR(off, W0); 
+  /*** Neighbor 0: (0,0,0) */ 
+  W0 = wxwy*wz; 
+  APPEND_NEIGHBOR(off, W0); 
       
-      /*** Neighbor 1: (0,0,1) */ 
-      APPEND_NEIGHBOR(off+1, wxwy-W0);
+  /*** Neighbor 1: (0,0,1) */ 
+  APPEND_NEIGHBOR(off+1, wxwy-W0);
       
-      /*** Neighbor 2: (0,1,0) */ 
-      W2 = wxwz-W0; 
-      APPEND_NEIGHBOR(off+u2, W2);  
+  /*** Neighbor 2: (0,1,0) */ 
+  W2 = wxwz-W0; 
+  APPEND_NEIGHBOR(off+tg->u2, W2);  
       
-      /*** Neightbor 3: (0,1,1) */
-      W3 = wx-wxwy-W2;  
-      APPEND_NEIGHBOR(off+u3, W3);  
+  /*** Neightbor 3: (0,1,1) */
+  W3 = wx-wxwy-W2;  
+  APPEND_NEIGHBOR(off+tg->u3, W3);  
       
-      /*** Neighbor 4: (1,0,0) */
-      W4 = wywz-W0;  
-      APPEND_NEIGHBOR(off+u4, W4); 
+  /*** Neighbor 4: (1,0,0) */
+  W4 = wywz-W0;  
+  APPEND_NEIGHBOR(off+tg->u4, W4); 
       
-      /*** Neighbor 5: (1,0,1) */ 
-      APPEND_NEIGHBOR(off+u5, wy-wxwy-W4);   
+  /*** Neighbor 5: (1,0,1) */ 
+  APPEND_NEIGHBOR(off+tg->u5, wy-wxwy-W4);   
       
-      /*** Neighbor 6: (1,1,0) */ 
-      APPEND_NEIGHBOR(off+u6, wz-wxwz-W4);  
+  /*** Neighbor 6: (1,1,0) */ 
+  APPEND_NEIGHBOR(off+tg->u6, wz-wxwz-W4);  
       
-      /*** Neighbor 7: (1,1,1) */ 
-      APPEND_NEIGHBOR(off+u7, 1-W3-wy-wz+wywz);  
+  /*** Neighbor 7: (1,1,1) */ 
+  APPEND_NEIGHBOR(off+tg->u7, 1-W3-wy-wz+wywz);  
       
-      /* Update the joint histogram using the desired interpolation technique */ 
-      interpolate(i, H, clampJ, Jnn, W, nn, interp_params); 
+  /* Update the joint histogram using the desired interpolation technique */ 
+  tg->interpolate(i, H, clampJ, Jnn, W, nn, tg->interp_params); 
+
+  return; 
+}
+
+
+/* 
+   Scanline joint histogram kernel. 
+
+   Source voxels are processed row by row along the fastest axis
+   (z). The transformed coordinates of the row origin are computed
+   once per row, so that each voxel only adds the contribution of z
+   (3 products instead of 9). Since the bounds test guarantees Tx>-1,
+   the floor is computed as (int)Tx+(Tx>=0) rather than with the
+   generic FLOOR macro. The arithmetic is otherwise the same as in
+   a full matrix-vector product, in the same order, so the result is
+   unchanged.
+
+   Only voxels with intensities in [ilo, ihi[ are processed. 
+
+   imI is assumed 3d, signed short encoded, possibly non-contiguous.
+*/
+static void _joint_histogram_band(double* H, 
+				  unsigned int clampI, 
+				  unsigned int clampJ,  
+				  const PyArrayObject* imI,
+				  const PyArrayObject* imJ_padded, 
+				  const double* Tvox, 
+				  int interp, 
+				  int ilo, 
+				  int ihi)
+{
+  target_grid tg; 
+  signed short i;
+  size_t x, y, dimX = PyArray_DIM(imI, 0), dimY = PyArray_DIM(imI, 1); 
+  int z, dimZ = (int)PyArray_DIM(imI, 2); 
+  double Tx, Ty, Tz, Rx, Ry, Rz; 
+  double Tx_z = Tvox[2], Ty_z = Tvox[6], Tz_z = Tvox[10]; 
+  double Tx_0 = Tvox[3], Ty_0 = Tvox[7], Tz_0 = Tvox[11]; 
+  const char* row; 
+  npy_intp incX = PyArray_STRIDE(imI, 0), incY = PyArray_STRIDE(imI, 1), incZ = PyArray_STRIDE(imI, 2); 
+
+  _target_grid_init(&tg, imJ_padded, interp); 
+
+  /* Loop over source rows */ 
+  for (x=0; x<dimX; x++) 
+    for (y=0; y<dimY; y++) {
+
+      row = (const char*)PyArray_DATA(imI) + x*incX + y*incY; 
       
+      /* Transformed coordinates of the row origin */ 
+      Rx = Tvox[0]*x; Rx += Tvox[1]*y;
+      Ry = Tvox[4]*x; Ry += Tvox[5]*y;
+      Rz = Tvox[8]*x; Rz += Tvox[9]*y;
+
+      /* Loop over row voxels */ 
+      for (z=0; z<dimZ; z++) {
+
+	/* Source voxel intensity */
+	i = *((signed short*)(row + z*incZ)); 
+
+	/* Skip voxels whose intensity is outside the band of
+	   histogram rows handled by this call (this includes voxels
+	   below the intensity threshold) */
+	if ((i<ilo) || (i>=ihi)) 
+	  continue; 
+
+	/* Compute the transformed grid coordinates of current voxel */ 
+	Tx = Rx + Tx_z*z; Tx += Tx_0; 
+	Ty = Ry + Ty_z*z; Ty += Ty_0; 
+	Tz = Rz + Tz_z*z; Tz += Tz_0; 
+
+	tg.rand.x = x; 
+	tg.rand.y = y; 
+	tg.rand.z = z; 
+	_joint_histogram_update(H, clampJ, i, Tx, Ty, Tz, &tg); 
       
-    } /* End of IF TRANSFORMS INSIDE */
-    
-    /* Update source index */ 
-    PyArray_ITER_NEXT(iterI); 
-    
-  } /* End of loop over voxels */ 
+      } /* End of loop over row voxels */ 
+
+    } /* End of loop over rows */ 
+  
+  return; 
+}
+
+
+/* 
+   Point-list joint histogram kernel: processes source points
+   [start, stop[ of a prepared source point set (see
+   joint_histogram_points). 
+*/
+static void _joint_histogram_points_range(double* H, 
+					  unsigned int clampJ,  
+					  const signed short* xyz, 
+					  const unsigned short* bins, 
+					  size_t npoints, 
+					  size_t start, 
+					  size_t stop, 
+					  const PyArrayObject* imJ_padded, 
+					  const double* Tvox, 
+					  int interp)
+{
+  target_grid tg; 
+  const signed short *bufX = xyz, *bufY = xyz + npoints, *bufZ = xyz + 2*npoints; 
+  double x, y, z, Tx, Ty, Tz; 
+  size_t k; 
+
+  _target_grid_init(&tg, imJ_padded, interp); 
+
+  for (k=start; k<stop; k++) {
+    x = bufX[k]; 
+    y = bufY[k]; 
+    z = bufZ[k]; 
+
+    /* Same operations as in the scanline kernel */ 
+    Tx = Tvox[0]*x; Tx += Tvox[1]*y; Tx += Tvox[2]*z; Tx += Tvox[3]; 
+    Ty = Tvox[4]*x; Ty += Tvox[5]*y; Ty += Tvox[6]*z; Ty += Tvox[7]; 
+    Tz = Tvox[8]*x; Tz += Tvox[9]*y; Tz += Tvox[10]*z; Tz += Tvox[11]; 
+
+    tg.rand.x = bufX[k]; 
+    tg.rand.y = bufY[k]; 
+    tg.rand.z = bufZ[k]; 
+    _joint_histogram_update(H, clampJ, (signed short)bins[k], Tx, Ty, Tz, &tg); 
+  }
+
+  return; 
+}
+
+
+/* 
+   Multi-threaded joint histogram. 
+
+   Each worker owns a band of consecutive rows of H (a range of source
+   intensities) and scans the whole source image, only processing the
+   voxels that fall into its band. No two workers write to the same
+   bin, and each bin receives its contributions in the serial voxel
+   order, so the result is bit-identical to the serial loop for any
+   number of threads. Bands are balanced by first counting source
+   intensities in parallel over slabs of the source image.
+
+   Random interpolation draws are functions of the source voxel
+   coordinates (see rand_params), so this holds for all interpolation
+   methods.
+*/
+
+typedef struct {
+  double* H; 
+  unsigned int clampI; 
+  unsigned int clampJ; 
+  const PyArrayObject* imI; 
+  const PyArrayObject* imJ_padded; 
+  const double* Tvox; 
+  int interp; 
+  unsigned int* counts; 
+  int* bands; 
+} joint_histogram_job; 
+
+
+static void _count_source_slab(int rank, int nthreads, void* params)
+{
+  joint_histogram_job* job = (joint_histogram_job*)params; 
+  const PyArrayObject* imI = job->imI; 
+  unsigned int* counts = job->counts + rank*job->clampI; 
+  size_t x, y, z, x0, x1; 
+  const char* row; 
+  signed short i; 
+
+  fff_parallel_range(PyArray_DIM(imI, 0), rank, nthreads, &x0, &x1); 
+
+  for (x=x0; x<x1; x++) 
+    for (y=0; y<PyArray_DIM(imI, 1); y++) {
+      row = (const char*)PyArray_DATA(imI) + x*PyArray_STRIDE(imI, 0) + y*PyArray_STRIDE(imI, 1); 
+      for (z=0; z<PyArray_DIM(imI, 2); z++) {
+	i = *((signed short*)(row + z*PyArray_STRIDE(imI, 2))); 
+	if ((i>=0) && (i<job->clampI)) 
+	  counts[i] ++; 
+      }
+    }
+
+  return; 
+}
+
+static void _joint_histogram_band_job(int rank, int nthreads, void* params)
+{
+  joint_histogram_job* job = (joint_histogram_job*)params; 
+  int ilo = job->bands[rank], ihi = job->bands[rank+1]; 
+
+  if (ihi > ilo) 
+    _joint_histogram_band(job->H, job->clampI, job->clampJ, job->imI, 
+			  job->imJ_padded, job->Tvox, job->interp, ilo, ihi); 
+  return; 
+}
+
+void joint_histogram(double* H, 
+		     unsigned int clampI, 
+		     unsigned int clampJ,  
+		     PyArrayIterObject* iterI,
+		     const PyArrayObject* imJ_padded, 
+		     const double* Tvox, 
+		     int interp, 
+		     int nthreads)
+{
+  const PyArrayObject* imI = iterI->ao; 
+  joint_histogram_job job; 
+  double total, cum, target; 
+  int k; 
+  unsigned int i; 
+
+  /* Re-initialize joint histogram */ 
+  memset((void*)H, 0, clampI*clampJ*sizeof(double));
+
+  nthreads = fff_threads_count(nthreads); 
+  if (nthreads > (int)clampI) 
+    nthreads = (int)clampI; 
+
+  /* Serial case */ 
+  if (nthreads <= 1) {
+    _joint_histogram_band(H, clampI, clampJ, imI, imJ_padded, Tvox, interp, 0, clampI); 
+    return; 
+  }
+
+  job.H = H; 
+  job.clampI = clampI; 
+  job.clampJ = clampJ; 
+  job.imI = imI; 
+  job.imJ_padded = imJ_padded; 
+  job.Tvox = Tvox; 
+  job.interp = interp; 
+  job.counts = (unsigned int*)calloc(nthreads*clampI, sizeof(unsigned int)); 
+  job.bands = (int*)malloc((nthreads+1)*sizeof(int)); 
+  if ((job.counts == NULL) || (job.bands == NULL)) {
+    free(job.counts); 
+    free(job.bands); 
+    _joint_histogram_band(H, clampI, clampJ, imI, imJ_padded, Tvox, interp, 0, clampI); 
+    return; 
+  }
+
+  /* Count source intensities over slabs, reduce counts (exact) */ 
+  fff_parallel_run(nthreads, &_count_source_slab, (void*)&job); 
+  for (k=1; k<nthreads; k++) 
+    for (i=0; i<clampI; i++) 
+      job.counts[i] += job.counts[k*clampI+i]; 
+
+  /* Split histogram rows into bands of roughly equal voxel counts */ 
+  for (i=0, total=0.0; i<clampI; i++) 
+    total += job.counts[i]; 
+  job.bands[0] = 0; 
+  for (k=1, i=0, cum=0.0; k<nthreads; k++) {
+    target = (total*k)/nthreads; 
+    while ((i<clampI) && (cum+job.counts[i] <= target)) {
+      cum += job.counts[i]; 
+      i ++; 
+    }
+    job.bands[k] = ((int)i > job.bands[k-1]) ? (int)i : job.bands[k-1]; 
+  }
+  job.bands[nthreads] = clampI; 
+
+  /* Accumulate the joint histogram band-wise */ 
+  fff_parallel_run(nthreads, &_joint_histogram_band_job, (void*)&job); 
+
+  free(job.counts); 
+  free(job.bands); 
+
+  return; 
+}
+
+
+/* 
+   Partial volume joint histogram and its derivatives with respect to
+   the 12 coefficients of Tvox, for source points [start, stop[. 
+
+   The PV weight of neighbor (a,b,c) is fx*fy*fz with fx = wx if a=0
+   and 1-wx if a=1 (same for y and z), and wx = nx-Tx, hence
+   dfx/dTx = -1 if a=0 and +1 if a=1. The derivative with respect to
+   Tvox[4*r+c] is then the derivative with respect to the r-th
+   transformed coordinate times the c-th homogeneous source
+   coordinate. dH is C-contiguous (clampI, clampJ, 12).
+*/
+
+#define APPEND_GRADIENT(q, w, gx, gy, gz)				\
+  j = J[q];								\
+  if (j>=0) {								\
+    bufH = H + i*clampJ + j;						\
+    *bufH += w;								\
+    bufdH = dH + 12*(i*clampJ + j);					\
+    for (c=0; c<4; c++) {						\
+      bufdH[c] += (gx)*X[c];						\
+      bufdH[4+c] += (gy)*X[c];						\
+      bufdH[8+c] += (gz)*X[c]; }}
+
+static void _joint_histogram_gradient_range(double* H, 
+					    double* dH, 
+					    unsigned int clampJ,  
+					    const signed short* xyz, 
+					    const unsigned short* bins, 
+					    size_t npoints, 
+					    size_t start, 
+					    size_t stop, 
+					    const PyArrayObject* imJ_padded, 
+					    const double* Tvox)
+{
+  target_grid tg; 
+  const signed short *J, *bufX = xyz, *bufY = xyz + npoints, *bufZ = xyz + 2*npoints; 
+  double *bufH, *bufdH; 
+  double X[4], Tx, Ty, Tz; 
+  double wx, wy, wz, wxwy, wxwz, wywz, vx, vy, vz; 
+  double W0, W2, W3, W4; 
+  size_t k, off, i; 
+  signed short j; 
+  int c, nx, ny, nz; 
+
+  _target_grid_init(&tg, imJ_padded, 0); 
+  J = tg.J; 
+  X[3] = 1.0; 
+
+  for (k=start; k<stop; k++) {
+    i = bins[k]; 
+    X[0] = bufX[k]; 
+    X[1] = bufY[k]; 
+    X[2] = bufZ[k]; 
+
+    /* Same operations as in the point-list kernel */ 
+    Tx = Tvox[0]*X[0]; Tx += Tvox[1]*X[1]; Tx += Tvox[2]*X[2]; Tx += Tvox[3]; 
+    Ty = Tvox[4]*X[0]; Ty += Tvox[5]*X[1]; Ty += Tvox[6]*X[2]; Ty += Tvox[7]; 
+    Tz = Tvox[8]*X[0]; Tz += Tvox[9]*X[1]; Tz += Tvox[10]*X[2]; Tz += Tvox[11]; 
+
+    if (!((Tx>-1) && (Tx<tg.dimX) && 
+	  (Ty>-1) && (Ty<tg.dimY) && 
+	  (Tz>-1) && (Tz<tg.dimZ))) 
+      continue; 
+
+    nx = (int)Tx + (Tx>=0);
+    ny = (int)Ty + (Ty>=0);
+    nz = (int)Tz + (Tz>=0);
+    wx = nx - Tx; 
+    wy = ny - Ty;
+    wz = nz - Tz;
+    vx = 1 - wx; 
+    vy = 1 - wy; 
+    vz = 1 - wz; 
+    wxwy = wx*wy;    
+    wxwz = wx*wz;
+    wywz = wy*wz;
+    off = nx*tg.u4 + ny*tg.u2 + nz; 
+
+    /* Weights are computed as in _joint_histogram_update, so that H
+       is the PV histogram returned by joint_histogram_points */ 
+    W0 = wxwy*wz; 
+    APPEND_GRADIENT(off, W0, -wy*wz, -wx*wz, -wxwy); 
+    APPEND_GRADIENT(off+1, wxwy-W0, -wy*vz, -wx*vz, wxwy); 
+    W2 = wxwz-W0; 
+    APPEND_GRADIENT(off+tg.u2, W2, -vy*wz, wxwz, -wx*vy); 
+    W3 = wx-wxwy-W2;  
+    APPEND_GRADIENT(off+tg.u3, W3, -vy*vz, wx*vz, wx*vy); 
+    W4 = wywz-W0;  
+    APPEND_GRADIENT(off+tg.u4, W4, wywz, -vx*wz, -vx*wy); 
+    APPEND_GRADIENT(off+tg.u5, wy-wxwy-W4, wy*vz, -vx*vz, vx*wy); 
+    APPEND_GRADIENT(off+tg.u6, wz-wxwz-W4, vy*wz, vx*wz, -vx*vy); 
+    APPEND_GRADIENT(off+tg.u7, 1-W3-wy-wz+wywz, vy*vz, vx*vz, vx*vy); 
+  }
+
+  return; 
+}
+
+
+/* 
+   Multi-threaded joint histogram on a source point set. 
+
+   Points are assumed sorted by intensity bin, so that the band
+   partitioning used by joint_histogram amounts to splitting the point
+   list into contiguous chunks whose boundaries fall on bin changes. 
+   The same jobs compute the PV gradient when dH is not NULL. 
+*/
+
+typedef struct {
+  double* H; 
+  double* dH; 
+  unsigned int clampJ; 
+  const signed short* xyz; 
+  const unsigned short* bins; 
+  size_t npoints; 
+  const PyArrayObject* imJ_padded; 
+  const double* Tvox; 
+  int interp; 
+} joint_histogram_points_job; 
+
+
+/* Move a chunk boundary forward to the next bin change */
+static size_t _align_on_bin(const unsigned short* bins, size_t npoints, size_t k)
+{
+  if (k == 0)
+    return 0; 
+  while ((k<npoints) && (bins[k]==bins[k-1]))
+    k ++; 
+  return k; 
+}
+
+static void _joint_histogram_points_job(int rank, int nthreads, void* params)
+{
+  joint_histogram_points_job* job = (joint_histogram_points_job*)params; 
+  size_t start, stop; 
+
+  fff_parallel_range(job->npoints, rank, nthreads, &start, &stop); 
+  start = _align_on_bin(job->bins, job->npoints, start); 
+  stop = _align_on_bin(job->bins, job->npoints, stop); 
+
+  if (stop <= start) 
+    return; 
+
+  if (job->dH != NULL) 
+    _joint_histogram_gradient_range(job->H, job->dH, job->clampJ, job->xyz, job->bins, job->npoints, 
+				    start, stop, job->imJ_padded, job->Tvox); 
+  else 
+    _joint_histogram_points_range(job->H, job->clampJ, job->xyz, job->bins, job->npoints, 
+				  start, stop, job->imJ_padded, job->Tvox, job->interp); 
+  return; 
+}
+
+void joint_histogram_points(double* H, 
+			    unsigned int clampI, 
+			    unsigned int clampJ,  
+			    const signed short* xyz, 
+			    const unsigned short* bins, 
+			    size_t npoints, 
+			    const PyArrayObject* imJ_padded, 
+			    const double* Tvox, 
+			    int interp, 
+			    int nthreads)
+{
+  joint_histogram_points_job job; 
+
+  /* Re-initialize joint histogram */ 
+  memset((void*)H, 0, clampI*clampJ*sizeof(double));
+
+  nthreads = fff_threads_count(nthreads); 
+  if ((nthreads <= 1) || (npoints < (size_t)nthreads)) {
+    _joint_histogram_points_range(H, clampJ, xyz, bins, npoints, 0, npoints, 
+				  imJ_padded, Tvox, interp); 
+    return; 
+  }
+
+  job.H = H; 
+  job.dH = NULL; 
+  job.clampJ = clampJ; 
+  job.xyz = xyz; 
+  job.bins = bins; 
+  job.npoints = npoints; 
+  job.imJ_padded = imJ_padded; 
+  job.Tvox = Tvox; 
+  job.interp = interp; 
+  fff_parallel_run(nthreads, &_joint_histogram_points_job, (void*)&job); 
   
+  return; 
+}
+
+void joint_histogram_gradient(double* H, 
+			      double* dH, 
+			      unsigned int clampI, 
+			      unsigned int clampJ,  
+			      const signed short* xyz, 
+			      const unsigned short* bins, 
+			      size_t npoints, 
+			      const PyArrayObject* imJ_padded, 
+			      const double* Tvox, 
+			      int nthreads)
+{
+  joint_histogram_points_job job; 
+
+  /* Re-initialize joint histogram and derivatives */ 
+  memset((void*)H, 0, clampI*clampJ*sizeof(double));
+  memset((void*)dH, 0, 12*clampI*clampJ*sizeof(double));
 
+  nthreads = fff_threads_count(nthreads); 
+  if ((nthreads <= 1) || (npoints < (size_t)nthreads)) {
+    _joint_histogram_gradient_range(H, dH, clampJ, xyz, bins, npoints, 0, npoints, imJ_padded, Tvox); 
+    return; 
+  }
+
+  job.H = H; 
+  job.dH = dH; 
+  job.clampJ = clampJ; 
+  job.xyz = xyz; 
+  job.bins = bins; 
+  job.npoints = npoints; 
+  job.imJ_padded = imJ_padded; 
+  job.Tvox = Tvox; 
+  job.interp = 0; 
+  fff_parallel_run(nthreads, &_joint_histogram_points_job, (void*)&job); 
+  
+  return; 
+}
+
+
+/* 
+   Batched joint histograms on a source point set. 
+
+   The point list is scanned in blocks of JOINT_HISTOGRAM_BATCH_BLOCK
+   points, and each block is processed for all transformations before
+   moving to the next one, so that source coordinates and intensities
+   are loaded once for the whole batch. Each histogram receives its
+   contributions in the point order, hence the result is the same as
+   with K separate calls to joint_histogram_points. Threads are
+   assigned disjoint subsets of transformations. 
+*/
+
+#define JOINT_HISTOGRAM_BATCH_BLOCK 2048
+
+typedef struct {
+  double* H; 
+  unsigned int clampI; 
+  unsigned int clampJ; 
+  const signed short* xyz; 
+  const unsigned short* bins; 
+  size_t npoints; 
+  const PyArrayObject* imJ_padded; 
+  const double* Tvox; 
+  unsigned int ntransforms; 
+  int interp; 
+} joint_histogram_batch_job; 
+
+
+static void _joint_histogram_batch_range(double* H, 
+					 unsigned int clampI, 
+					 unsigned int clampJ,  
+					 const signed short* xyz, 
+					 const unsigned short* bins, 
+					 size_t npoints, 
+					 const PyArrayObject* imJ_padded, 
+					 const double* Tvox, 
+					 int interp, 
+					 size_t k0, 
+					 size_t k1)
+{
+  target_grid* tg; 
+  const signed short *bufX = xyz, *bufY = xyz + npoints, *bufZ = xyz + 2*npoints; 
+  const double* T; 
+  double *Hk, x, y, z, Tx, Ty, Tz; 
+  size_t k, p, p0, p1, size = clampI*clampJ; 
+
+  if (k1 <= k0) 
+    return; 
+
+  /* One target grid per transformation, as random interpolation
+     parameters are updated point-wise */  
+  tg = (target_grid*)malloc((k1-k0)*sizeof(target_grid)); 
+  if (tg == NULL) {
+    for (k=k0; k<k1; k++) 
+      _joint_histogram_points_range(H+k*size, clampJ, xyz, bins, npoints, 0, npoints, 
+				    imJ_padded, Tvox+16*k, interp); 
+    return; 
+  }
+  for (k=k0; k<k1; k++) 
+    _target_grid_init(tg+k-k0, imJ_padded, interp); 
+
+  /* Loop over point blocks */ 
+  for (p0=0; p0<npoints; p0=p1) {
+    p1 = p0 + JOINT_HISTOGRAM_BATCH_BLOCK; 
+    if (p1 > npoints) 
+      p1 = npoints; 
+
+    /* Loop over transformations */ 
+    for (k=k0; k<k1; k++) {
+      T = Tvox + 16*k; 
+      Hk = H + k*size; 
+      for (p=p0; p<p1; p++) {
+	x = bufX[p]; 
+	y = bufY[p]; 
+	z = bufZ[p]; 
+	
+	/* Same operations as in the point-list kernel */ 
+	Tx = T[0]*x; Tx += T[1]*y; Tx += T[2]*z; Tx += T[3]; 
+	Ty = T[4]*x; Ty += T[5]*y; Ty += T[6]*z; Ty += T[7]; 
+	Tz = T[8]*x; Tz += T[9]*y; Tz += T[10]*z; Tz += T[11]; 
+	
+	tg[k-k0].rand.x = bufX[p]; 
+	tg[k-k0].rand.y = bufY[p]; 
+	tg[k-k0].rand.z = bufZ[p]; 
+	_joint_histogram_update(Hk, clampJ, (signed short)bins[p], Tx, Ty, Tz, tg+k-k0); 
+      }
+    }
+  }
+
+  free(tg); 
+  return; 
+}
+
+static void _joint_histogram_batch_job(int rank, int nthreads, void* params)
+{
+  joint_histogram_batch_job* job = (joint_histogram_batch_job*)params; 
+  size_t k0, k1; 
+
+  fff_parallel_range(job->ntransforms, rank, nthreads, &k0, &k1); 
+  _joint_histogram_batch_range(job->H, job->clampI, job->clampJ, job->xyz, job->bins, job->npoints, 
+			       job->imJ_padded, job->Tvox, job->interp, k0, k1); 
+  return; 
+}
+
+void joint_histogram_batch(double* H, 
+			   unsigned int clampI, 
+			   unsigned int clampJ,  
+			   const signed short* xyz, 
+			   const unsigned short* bins, 
+			   size_t npoints, 
+			   const PyArrayObject* imJ_padded, 
+			   const double* Tvox, 
+			   unsigned int ntransforms, 
+			   int interp, 
+			   int nthreads)
+{
+  joint_histogram_batch_job job; 
+
+  /* Re-initialize joint histograms */ 
+  memset((void*)H, 0, ntransforms*clampI*clampJ*sizeof(double));
+
+  nthreads = fff_threads_count(nthreads); 
+  if (nthreads > (int)ntransforms) 
+    nthreads = (int)ntransforms; 
+  if (nthreads <= 1) {
+    _joint_histogram_batch_range(H, clampI, clampJ, xyz, bins, npoints, 
+				 imJ_padded, Tvox, interp, 0, ntransforms); 
+    return; 
+  }
+
+  job.H = H; 
+  job.clampI = clampI; 
+  job.clampJ = clampJ; 
+  job.xyz = xyz; 
+  job.bins = bins; 
+  job.npoints = npoints; 
+  job.imJ_padded = imJ_padded; 
+  job.Tvox = Tvox; 
+  job.ntransforms = ntransforms; 
+  job.interp = interp; 
+  fff_parallel_run(nthreads, &_joint_histogram_batch_job, (void*)&job); 
+  
   return; 
 }
 
@@ -402,7 +1135,8 @@ static inline void _tri_interpolation(unsigned int i,
   return; 
 }
 
-/* Random interpolation. */
+/* Random interpolation. The draw is a function of the seed and the
+   source voxel coordinates. */
 static inline void _rand_interpolation(unsigned int i, 
 				       double* H, unsigned int clampJ, 
 				       const signed short* J, 
@@ -410,7 +1144,7 @@ static inline void _rand_interpolation(unsigned int i,
 				       int nn, 
 				       void* params) 
 { 
-  rk_state* rng = (rk_state*)params; 
+  rand_params* rp = (rand_params*)params; 
   int k;
   unsigned int clampJ_i = clampJ*i;
   const double *bufW;
@@ -419,7 +1153,7 @@ static inline void _rand_interpolation(unsigned int i,
   for(k=0, bufW=W, sumW=0.0; k<nn; k++, bufW++) 
     sumW += *bufW; 
   
-  draw = sumW*rk_double(rng); 
+  draw = sumW*rk_counter_double(rp->seed, rp->x, rp->y, rp->z); 
 
   for(k=0, bufW=W, sumW=0.0; k<nn; k++, bufW++) {
     sumW += *bufW; 
@@ -434,26 +1168,6 @@ static inline void _rand_interpolation(unsigned int i,
 
 
 
-static inline void _apply_affine_transform(double* Tx, double* Ty, double* Tz, 
-					   const double* Tvox, size_t x, size_t y, size_t z)
-{
-  double* bufTvox = (double*)Tvox; 
-
-  *Tx = (*bufTvox)*x; bufTvox++;
-  *Tx += (*bufTvox)*y; bufTvox++;
-  *Tx += (*bufTvox)*z; bufTvox++;
-  *Tx += *bufTvox; bufTvox++;
-  *Ty = (*bufTvox)*x; bufTvox++;
-  *Ty += (*bufTvox)*y; bufTvox++;
-  *Ty += (*bufTvox)*z; bufTvox++;
-  *Ty += *bufTvox; bufTvox++;
-  *Tz = (*bufTvox)*x; bufTvox++;
-  *Tz += (*bufTvox)*y; bufTvox++;
-  *Tz += (*bufTvox)*z; bufTvox++;
-  *Tz += *bufTvox;
-
-  return; 
-}
 
 
 
@@ -714,6 +1428,380 @@ double normalized_mutual_information(const double* H, double* hI, unsigned int c
 }
 
 
+/* 
+   Fused similarity measures. 
+
+   The joint histogram is scanned once to get the marginals and all
+   the moments. Entropies are computed as log(n) - sum h*log(h)/n,
+   which is the same quantity as in entropy() with a single log per
+   bin. With PV interpolation, bins are fractional but, with other
+   interpolation methods and for the marginals of count histograms,
+   they are integers, whose n*log(n) values are looked up in a table
+   filled on first use.
+*/ 
+
+#define NLOGN_TABLE_SIZE 4096
+
+static double _nlogn_table[NLOGN_TABLE_SIZE]; 
+static int _nlogn_table_ready = 0; 
+
+static void _nlogn_table_init(void)
+{
+  int k; 
+
+  _nlogn_table[0] = 0.0; 
+  for (k=1; k<NLOGN_TABLE_SIZE; k++) 
+    _nlogn_table[k] = k*log((double)k); 
+  _nlogn_table_ready = 1; 
+
+  return; 
+}
+
+static inline double _nlogn(double h)
+{
+  int k; 
+
+  if (h <= 0.0) 
+    return 0.0; 
+  if (h < NLOGN_TABLE_SIZE) {
+    k = (int)h; 
+    if (k == h) 
+      return _nlogn_table[k]; 
+  }
+  return h*log(h); 
+}
+
+static double _entropy_from_nlogn(double sumh_logh, double n)
+{
+  if (n <= 0) 
+    return 0.0; 
+  return log(n) - sumh_logh/n; 
+}
+
+void similarities(similarity_values* res, 
+		  const double* H, 
+		  double* hI, 
+		  unsigned int clampI, 
+		  double* hJ, 
+		  unsigned int clampJ, 
+		  unsigned int which)
+{
+  const double *bufH = H; 
+  double *S1 = NULL, *S2 = NULL; 
+  double h, hi, rowj, n = 0.0, sIJ = 0.0, sI = 0.0, sJ = 0.0; 
+  double mi = 0.0, mj = 0.0, mi2 = 0.0, mj2 = 0.0, mij = 0.0; 
+  double vari, varj, covij, cvar, aux, entI, entJ, entIJ, dev, cdev; 
+  double moments[3]; 
+  unsigned int i, j; 
+  int need_cr = which & SIMILARITY_CR; 
+  int need_ent = which & (SIMILARITY_JE|SIMILARITY_CE|SIMILARITY_MI|SIMILARITY_NMI); 
+
+  memset((void*)res, 0, sizeof(similarity_values)); 
+  memset((void*)hJ, 0, clampJ*sizeof(double));
+
+  /* Conditional moments of I given J, accumulated row-wise */ 
+  if (need_cr) {
+    S1 = (double*)calloc(2*clampJ, sizeof(double)); 
+    if (S1 == NULL) {
+      res->cr = correlation_ratio(H, clampI, clampJ, &aux); 
+      need_cr = 0; 
+    }
+    else 
+      S2 = S1 + clampJ; 
+  }
+  if (need_ent && !_nlogn_table_ready) 
+    _nlogn_table_init(); 
+
+  /* Single pass over H */ 
+  for (i=0; i<clampI; i++) {
+    hi = rowj = 0.0; 
+    for (j=0; j<clampJ; j++, bufH++) {
+      h = *bufH; 
+      hi += h; 
+      rowj += j*h; 
+      hJ[j] += h; 
+      if (need_cr) {
+	S1[j] += i*h; 
+	S2[j] += i*(i*h); 
+      }
+      if (need_ent) 
+	sIJ += _nlogn(h); 
+    }
+    hI[i] = hi; 
+    n += hi; 
+    mi += i*hi; 
+    mi2 += i*(i*hi); 
+    mij += i*rowj; 
+  }
+  for (j=0; j<clampJ; j++) {
+    h = hJ[j]; 
+    mj += j*h; 
+    mj2 += j*(j*h); 
+  }
+
+  res->n = n; 
+  if (n <= 0) {
+    free(S1); 
+    return; 
+  }
+
+  /* Correlation coefficient */ 
+  mi /= n; 
+  mj /= n; 
+  mi2 /= n; 
+  mj2 /= n; 
+  mij /= n; 
+  vari = mi2 - mi*mi; 
+  varj = mj2 - mj*mj; 
+  if (which & SIMILARITY_CC) {
+    covij = mij - mi*mj; 
+    aux = vari*varj; 
+    if (aux > 0) 
+      res->cc = SQR(covij)/aux; 
+  }
+
+  /* Correlation ratio */ 
+  if (need_cr) {
+    for (j=0, cvar=0.0; j<clampJ; j++) 
+      if (hJ[j] > 0) 
+	cvar += S2[j] - SQR(S1[j])/hJ[j]; 
+    cvar /= n; 
+    if (vari > 0) 
+      res->cr = 1 - cvar/vari; 
+  }
+  free(S1); 
+
+  /* L1 correlation ratio */ 
+  if (which & SIMILARITY_CRL1) {
+    for (j=0, cdev=0.0; j<clampJ; j++) {
+      L1_moments_with_stride(H+j, clampI, clampJ, moments); 
+      cdev += moments[0]*moments[2]; 
+    }
+    cdev /= n; 
+    L1_moments_with_stride(hI, clampI, 1, moments); 
+    dev = moments[2]; 
+    if (dev != 0.0) 
+      res->crl1 = 1 - SQR(cdev)/SQR(dev); 
+  }
+
+  /* Entropy-based measures */ 
+  if (need_ent) {
+    for (i=0; i<clampI; i++) 
+      sI += _nlogn(hI[i]); 
+    for (j=0; j<clampJ; j++) 
+      sJ += _nlogn(hJ[j]); 
+    entIJ = _entropy_from_nlogn(sIJ, n); 
+    entI = _entropy_from_nlogn(sI, n); 
+    entJ = _entropy_from_nlogn(sJ, n); 
+    res->je = entIJ; 
+    res->ce = entIJ - entJ; 
+    res->mi = entI + entJ - entIJ; 
+    aux = entI + entJ; 
+    if (aux > 0.0) 
+      res->nmi = 2*(1-entIJ/aux); 
+  }
+
+  return; 
+}
+
+
+/* 
+   Similarity measure derivatives with respect to the joint
+   histogram. Each function returns the same value as the
+   corresponding similarity measure and stores dS/dH(i,j) in G
+   (C-contiguous, same size as H). 
+
+   Derivatives are obtained by differentiating the normalized moments
+   or probabilities, e.g. d(mi)/dH(i,j) = (i-mi)/n. 
+*/ 
+
+double correlation_coefficient_gradient(double* G, const double* H, 
+					unsigned int clampI, unsigned int clampJ)
+{
+  int i, j;
+  double CC, na, mi, mj, cov, vari, varj, aux, dcov, dvari, dvarj; 
+  double *bufG = G; 
+  const double *bufH = H; 
+
+  memset((void*)G, 0, clampI*clampJ*sizeof(double));
+  CC = correlation_coefficient(H, clampI, clampJ, &na); 
+  if (na <= 0)
+    return CC; 
+
+  /* Means */ 
+  mi = mj = 0.0; 
+  for (i=0; i<clampI; i++) 
+    for (j=0; j<clampJ; j++, bufH++) {
+      aux = *bufH; 
+      mi += i*aux; 
+      mj += j*aux; 
+    }
+  mi /= na; 
+  mj /= na; 
+
+  /* Centered second order moments */ 
+  cov = vari = varj = 0.0; 
+  bufH = H; 
+  for (i=0; i<clampI; i++) 
+    for (j=0; j<clampJ; j++, bufH++) {
+      aux = *bufH; 
+      cov += (i-mi)*(j-mj)*aux; 
+      vari += SQR(i-mi)*aux; 
+      varj += SQR(j-mj)*aux; 
+    }
+  cov /= na; 
+  vari /= na; 
+  varj /= na; 
+  aux = vari*varj; 
+  if (aux <= 0)
+    return CC; 
+  aux = SQR(cov)/aux; 
+
+  /* dCC = 2 cov dcov/(vari varj) - CC (dvari/vari + dvarj/varj) */
+  for (i=0; i<clampI; i++) 
+    for (j=0; j<clampJ; j++, bufG++) {
+      dcov = ((i-mi)*(j-mj) - cov)/na; 
+      dvari = (SQR(i-mi) - vari)/na; 
+      dvarj = (SQR(j-mj) - varj)/na; 
+      *bufG = aux*(2*dcov/cov - dvari/vari - dvarj/varj); 
+      if (cov == 0.0)
+	*bufG = 0.0; 
+    }
+
+  return CC; 
+}
+
+
+double correlation_ratio_gradient(double* G, const double* H, 
+				  unsigned int clampI, unsigned int clampJ)
+{
+  int i, j;
+  double CR, na, mean, var, cvar, nJ, mJ, dcvar, dvar; 
+  double moments[5]; 
+  double *bufG; 
+
+  memset((void*)G, 0, clampI*clampJ*sizeof(double));
+  CR = correlation_ratio(H, clampI, clampJ, &na); 
+  if (na <= 0)
+    return CR; 
+
+  /* Total and conditional variances, as in correlation_ratio */ 
+  mean = var = cvar = 0; 
+  for (j=0; j<clampJ; j++) {
+    L2_moments_with_stride (H+j, clampI, clampJ, moments);
+    mean += moments[3]; 
+    var += moments[4]; 
+    cvar += moments[0]*moments[2];
+  }
+  mean /= na;
+  var = var/na - mean*mean;
+  cvar /= na;
+  if (var <= 0)
+    return CR; 
+
+  /* dCR = -(dcvar - (cvar/var) dvar)/var, with dvar =
+     ((i-mean)^2-var)/n and dcvar = ((i-mJ)^2-cvar)/n, where the
+     first term vanishes if column j is empty */ 
+  for (j=0; j<clampJ; j++) {
+    L2_moments_with_stride (H+j, clampI, clampJ, moments);
+    nJ = moments[0]; 
+    mJ = moments[1]; 
+    for (i=0, bufG=G+j; i<clampI; i++, bufG+=clampJ) {
+      dcvar = -cvar; 
+      if (nJ > 0) 
+	dcvar += SQR(i-mJ); 
+      dvar = SQR(i-mean) - var; 
+      *bufG = -(dcvar - (cvar/var)*dvar)/(var*na); 
+    }
+  }
+
+  return CR; 
+}
+
+
+/* 
+   With p = h/n, dE/dh(k) = -(log p(k) + E)/n for the entropy
+   functions above. 
+*/ 
+double mutual_information_gradient(double* G, const double* H, double* hI, unsigned int clampI, 
+				   double* hJ, unsigned int clampJ)
+{
+  int i, j; 
+  double MI, na, aux; 
+  double *bufG = G; 
+  const double *bufH = H; 
+
+  MI = mutual_information(H, hI, clampI, hJ, clampJ, &na); 
+  if (na <= 0) {
+    memset((void*)G, 0, clampI*clampJ*sizeof(double));
+    return MI; 
+  }
+
+  /* dMI = (log(pij/(pi pj)) - MI)/n */ 
+  for (i=0; i<clampI; i++) 
+    for (j=0; j<clampJ; j++, bufG++, bufH++) {
+      aux = NICELOG(*bufH/na) - NICELOG(hI[i]/na) - NICELOG(hJ[j]/na); 
+      *bufG = (aux - MI)/na; 
+    }
+  
+  return MI; 
+}
+
+
+double normalized_mutual_information_gradient(double* G, const double* H, double* hI, unsigned int clampI, 
+					      double* hJ, unsigned int clampJ)
+{
+  int i, j; 
+  double NMI, na, entIJ, entI, entJ, aux, dentIJ, dentIandJ; 
+  double *bufG = G; 
+  const double *bufH = H; 
+
+  memset((void*)G, 0, clampI*clampJ*sizeof(double));
+  NMI = normalized_mutual_information(H, hI, clampI, hJ, clampJ, &na); 
+  if (na <= 0)
+    return NMI; 
+  entI = entropy(hI, clampI, &na); 
+  entJ = entropy(hJ, clampJ, &na); 
+  entIJ = entropy(H, clampI*clampJ, &na);
+  aux = entI + entJ; 
+  if (aux <= 0.0) 
+    return NMI; 
+
+  /* dNMI = -2 (dentIJ (entI+entJ) - entIJ (dentI+dentJ))/(entI+entJ)^2 */ 
+  for (i=0; i<clampI; i++) 
+    for (j=0; j<clampJ; j++, bufG++, bufH++) {
+      dentIJ = -(NICELOG(*bufH/na) + entIJ)/na; 
+      dentIandJ = -(NICELOG(hI[i]/na) + NICELOG(hJ[j]/na) + aux)/na; 
+      *bufG = -2*(dentIJ*aux - entIJ*dentIandJ)/SQR(aux); 
+    }
+  
+  return NMI; 
+}
+
+
+/* Contract dS/dH with dH/dTvox (see joint_histogram_gradient) */ 
+void similarity_gradient(double* grad, const double* G, const double* dH, 
+			 unsigned int clampI, unsigned int clampJ)
+{
+  size_t k, size = clampI*clampJ; 
+  int c; 
+  const double *bufG = G, *bufdH = dH; 
+  double g; 
+
+  memset((void*)grad, 0, 12*sizeof(double)); 
+
+  for (k=0; k<size; k++, bufG++, bufdH+=12) {
+    g = *bufG; 
+    if (g == 0.0) 
+      continue; 
+    for (c=0; c<12; c++)
+      grad[c] += g*bufdH[c]; 
+  }
+
+  return; 
+}
+
+
 /*
 
 Supervised mutual information. 
@@ -941,54 +2029,31 @@ void cubic_spline_resample(PyArrayObject* im_resampled,
 			   const double* Tvox, 
 			   int cast_integer)
 {
-  double i1;
-  PyObject* py_i1;
-  PyArrayObject* im_spline_coeff;
-  PyArrayIterObject* imIter = (PyArrayIterObject*)PyArray_IterNew((PyObject*)im_resampled); 
-  unsigned int x, y, z;
-  unsigned dimX = PyArray_DIM(im, 0);
-  unsigned dimY = PyArray_DIM(im, 1);
-  unsigned dimZ = PyArray_DIM(im, 2);
-  unsigned ddimX=dimX-1, ddimY=dimY-1, ddimZ=dimZ-1; 
-  npy_intp dims[3] = {dimX, dimY, dimZ}; 
-  double Tx, Ty, Tz;
+  PyArrayObject *im_spline_coeff, *im_double;
+  double* buf; 
+  npy_intp k, size; 
+  npy_intp dims[3] = {PyArray_DIM(im, 0), PyArray_DIM(im, 1), PyArray_DIM(im, 2)}; 
 
   /* Compute the spline coefficient image */
   im_spline_coeff = (PyArrayObject*)PyArray_SimpleNew(3, dims, NPY_DOUBLE);
-  cubic_spline_transform(im_spline_coeff, im);
-
-  /* Force iterator coordinates to be updated */
-  UPDATE_ITERATOR_COORDS(imIter); 
-
-  /* Resampling loop */
-  while(imIter->index < imIter->size) {
-    x = imIter->coordinates[0];
-    y = imIter->coordinates[1]; 
-    z = imIter->coordinates[2]; 
-    _apply_affine_transform(&Tx, &Ty, &Tz, Tvox, x, y, z); 
-
-    if ((Tx<0) || (Tx>ddimX) ||
-	(Ty<0) || (Ty>ddimY) ||
-	(Tz<0) || (Tz>ddimZ))
-      i1 = 0.0; 
-    else{ 
-      i1 = cubic_spline_sample3d(Tx, Ty, Tz, im_spline_coeff); 
-      if (cast_integer)
-	i1 = ROUND(i1); 
-    }
-
-    /* Copy interpolated value into numpy array */
-    py_i1 = PyFloat_FromDouble(i1); 
-    PyArray_SETITEM(im_resampled, PyArray_ITER_DATA(imIter), py_i1); 
-    Py_DECREF(py_i1); 
-    
-    /* Increment iterator */
-    PyArray_ITER_NEXT(imIter); 
-
+  cubic_spline_transform(im_spline_coeff, im, 1);
+
+  /* Resample in a double buffer, setting points outside the input
+     grid to zero */ 
+  im_double = (PyArrayObject*)PyArray_SimpleNew(3, PyArray_DIMS(im_resampled), NPY_DOUBLE);
+  cubic_spline_resample3d(im_double, im_spline_coeff, Tvox, 1); 
+  if (cast_integer) {
+    buf = (double*)PyArray_DATA(im_double); 
+    size = PyArray_SIZE(im_double); 
+    for (k=0; k<size; k++, buf++) 
+      *buf = ROUND(*buf); 
   }
 
+  /* Copy interpolated values into the output array */
+  PyArray_CastTo(im_resampled, im_double); 
+
   /* Free memory */
-  Py_DECREF(imIter);
+  Py_DECREF(im_double);
   Py_DECREF(im_spline_coeff); 
     
   return;
@@ -39,6 +39,30 @@ extern "C" {
 			      PyArrayIterObject* iter, 
 			      const unsigned int* size);
 
+  /* 
+     Running moments of a local histogram: number of voxels, sums of
+     intensities and squared intensities, and sum of h*log(h) over
+     bins. 
+  */ 
+  typedef struct {
+    double n; 
+    double s1; 
+    double s2; 
+    double hlogh; 
+  } local_moments; 
+
+  /* 
+     Same as local_histogram, also computing the running moments m,
+     for voxels visited in C order: unless the voxel starts a row
+     (last coordinate zero), H and m must hold the result for the
+     previous voxel of the row, and are updated incrementally. 
+  */ 
+  extern void local_histogram_sliding(double* H, 
+				      local_moments* m, 
+				      unsigned int clamp, 
+				      PyArrayIterObject* iter, 
+				      const unsigned int* size);
+
 
   /* 
      Update a pre-allocated joint histogram. Important notice: in all
@@ -54,6 +78,13 @@ extern "C" {
        0 - PV interpolation
        1 - TRILINEAR interpolation 
        <0 - RANDOM interpolation with seed=-interp
+
+     RANDOM interpolation draws are counter-based (see rk_counter.h):
+     each is a function of the seed and the source voxel coordinates.
+
+     nthreads: number of threads (all processors if <=0). The result
+     does not depend on the number of threads, for all interpolation
+     methods.
   */ 
   extern void joint_histogram(double* H, 
 			      unsigned int clampI, 
@@ -61,7 +92,67 @@ extern "C" {
 			      PyArrayIterObject* iterI,
 			      const PyArrayObject* imJ_padded, 
 			      const double* Tvox, 
-			      int interp); 
+			      int interp, 
+			      int nthreads); 
+
+  /* 
+     Same as joint_histogram, for a source point set prepared once
+     and reused across evaluations. xyz is a C-contiguous (3, npoints)
+     array of source voxel coordinates and bins holds the
+     corresponding source intensities, which must be in [0, clampI[
+     and sorted in increasing order. The result equals that of
+     joint_histogram on the voxels in the set, taken in the same
+     order, for any number of threads.
+  */ 
+  extern void joint_histogram_points(double* H, 
+				     unsigned int clampI, 
+				     unsigned int clampJ,  
+				     const signed short* xyz, 
+				     const unsigned short* bins, 
+				     size_t npoints, 
+				     const PyArrayObject* imJ_padded, 
+				     const double* Tvox, 
+				     int interp, 
+				     int nthreads); 
+
+  /* 
+     PV joint histogram of a source point set (see
+     joint_histogram_points) together with its derivatives with
+     respect to the 12 coefficients of Tvox (first three rows, in
+     C order). dH is a pre-allocated C-contiguous (clampI, clampJ, 12)
+     array.
+  */ 
+  extern void joint_histogram_gradient(double* H, 
+				       double* dH, 
+				       unsigned int clampI, 
+				       unsigned int clampJ,  
+				       const signed short* xyz, 
+				       const unsigned short* bins, 
+				       size_t npoints, 
+				       const PyArrayObject* imJ_padded, 
+				       const double* Tvox, 
+				       int nthreads); 
+
+  /* 
+     Joint histograms of a source point set (see
+     joint_histogram_points) for a batch of ntransforms voxel
+     transformations, computed in a single pass over the points. Tvox
+     is a C-contiguous (ntransforms, 4, 4) array and H a C-contiguous
+     (ntransforms, clampI, clampJ) array. With RANDOM interpolation,
+     all histograms use the seed -interp. Threads handle disjoint
+     subsets of transformations.
+  */ 
+  extern void joint_histogram_batch(double* H, 
+				    unsigned int clampI, 
+				    unsigned int clampJ,  
+				    const signed short* xyz, 
+				    const unsigned short* bins, 
+				    size_t npoints, 
+				    const PyArrayObject* imJ_padded, 
+				    const double* Tvox, 
+				    unsigned int ntransforms, 
+				    int interp, 
+				    int nthreads); 
 
 
   extern double entropy(const double* h, unsigned int size, double* n); 
@@ -110,6 +201,73 @@ extern "C" {
 					      double* fJ, 
 					      unsigned int clampJ, 
 					      double* n);
+
+  /* 
+     Similarity measures returning dS/dH in G (same size as H), and
+     the contraction of G with the output of joint_histogram_gradient,
+     which yields the 12 derivatives of the similarity with respect
+     to Tvox.
+  */ 
+  extern double correlation_coefficient_gradient(double* G, 
+						 const double* H, 
+						 unsigned int clampI, 
+						 unsigned int clampJ); 
+  extern double correlation_ratio_gradient(double* G, 
+					   const double* H, 
+					   unsigned int clampI, 
+					   unsigned int clampJ); 
+  extern double mutual_information_gradient(double* G, 
+					    const double* H, 
+					    double* hI, 
+					    unsigned int clampI, 
+					    double* hJ, 
+					    unsigned int clampJ); 
+  extern double normalized_mutual_information_gradient(double* G, 
+						       const double* H, 
+						       double* hI, 
+						       unsigned int clampI, 
+						       double* hJ, 
+						       unsigned int clampJ); 
+  extern void similarity_gradient(double* grad, 
+				  const double* G, 
+				  const double* dH, 
+				  unsigned int clampI, 
+				  unsigned int clampJ); 
+
+  /* 
+     Fused evaluation of several similarity measures. The marginal
+     histograms hI and hJ (output) and the entropies are computed
+     once, in a single pass over H, for all the measures whose flags
+     are set in \a which. Values are the same as returned by the
+     individual functions, up to rounding errors. Entropies of
+     integer-valued histograms use a cached table of n*log(n).
+  */ 
+#define SIMILARITY_CC 1
+#define SIMILARITY_CR 2
+#define SIMILARITY_CRL1 4
+#define SIMILARITY_JE 8
+#define SIMILARITY_CE 16
+#define SIMILARITY_MI 32
+#define SIMILARITY_NMI 64
+
+  typedef struct {
+    double n; /* Sum of H */ 
+    double cc; 
+    double cr; 
+    double crl1; 
+    double je; 
+    double ce; 
+    double mi; 
+    double nmi; 
+  } similarity_values; 
+
+  extern void similarities(similarity_values* res, 
+			   const double* H, 
+			   double* hI, 
+			   unsigned int clampI, 
+			   double* hJ, 
+			   unsigned int clampJ, 
+			   unsigned int which); 
         
 
         
@@ -3,7 +3,10 @@ Intensity-based matching.
 
 Questions: alexis.roche@gmail.com
 """
-from routines import _joint_histogram, _similarity, similarity_measures
+from routines import _joint_histogram, _joint_histogram_points, _similarity, similarity_measures
+from routines import _joint_histogram_batch, _joint_histogram_gradient, _similarity_gradient
+from routines import _similarities
+from routines import cspline_reduce
 from transform import Affine, BRAIN_RADIUS_MM
 from utils import clamp, CLAMP_DTYPE, subsample
 
@@ -31,6 +34,9 @@ For the time being, any transformation is assumed to be a 4x4 matrix.
 # rand: Random interpolation
 interp_methods = {'pv': 0, 'tri': 1, 'rand': -1}
 
+# Similarity measures with an analytic gradient
+gradient_similarities = ['cc', 'cr', 'mi', 'nmi']
+
 
 class IconicMatcher:
 
@@ -39,10 +45,14 @@ class IconicMatcher:
                  source_toworld, target_toworld,
                  source_th=0, target_th=0,  
                  source_mask=None, target_mask=None,
-                 source_bins=256, target_bins=256):
+                 source_bins=256, target_bins=256, 
+                 nthreads=1):
 
         """
         IconicMatcher class for intensity-based image registration. 
+
+        nthreads: number of threads used to compute the joint
+        histogram (all available processors if nthreads<=0). 
         """
         ## FIXME: test that input images are 3d
 
@@ -61,8 +71,18 @@ class IconicMatcher:
         self.source_hist = np.zeros(s_bins)
         self.target_hist = np.zeros(t_bins)
         
+        # Threads used in joint histogram computation
+        self.nthreads = nthreads
+
+        # Clamping parameters, used to build pyramid levels 
+        self._clamp_params = {'source_th': source_th, 'target_th': target_th, 
+                              'source_mask': source_mask, 'target_mask': target_mask, 
+                              'source_bins': source_bins, 'target_bins': target_bins}
+        self._pyramid = [self]
+
         # Image-to-world transforms 
         self.source_toworld = source_toworld
+        self.target_toworld = target_toworld
         self.target_fromworld = np.linalg.inv(target_toworld)
 
         # Set default registration parameters
@@ -70,9 +90,23 @@ class IconicMatcher:
         self.set_field_of_view()
         self.set_similarity()
 
-    def set_interpolation(self, method='pv'):
+    def set_interpolation(self, method='pv', seed=None):
+        """
+        With random interpolation, each draw is a function of the
+        seed and the source voxel coordinates. If seed is None, a new
+        seed is drawn at each similarity evaluation; otherwise
+        evaluations are reproducible, whatever the number of threads.
+        """
         self.interp = method
         self._interp = interp_methods[method]
+        self.interp_seed = seed
+
+    def _interp_code(self):
+        if self._interp >= 0:
+            return self._interp
+        if self.interp_seed == None:
+            return - np.random.randint(1, maxint)
+        return - int(self.interp_seed)
 
     def set_field_of_view(self, subsampling=[1,1,1], corner=[0,0,0], size=None, fixed_npoints=None):
         self.block_corner = np.array(corner, dtype='uint')
@@ -91,11 +125,27 @@ class IconicMatcher:
             self.source_block, self.block_subsampling, self.block_npoints = \
                 subsample(aux, npoints=fixed_npoints)
 
+        self._set_source_points()
+
         ## Taux: block to full array transformation
         Taux = np.diag(np.concatenate((self.block_subsampling,[1]),1))
         Taux[0:3,3] = self.block_corner
         self.block_transform = np.dot(self.source_toworld, Taux)
 
+    def _set_source_points(self):
+        """
+        Compact the in-mask voxels of the source block into a point
+        set (voxel coordinates and intensities), sorted by intensity,
+        that is reused across all similarity evaluations.
+        """
+        block = self.source_block
+        xyz = np.where(block >= 0)
+        bins = block[xyz]
+        ## Stable sort keeps the voxel order within each intensity
+        idx = np.argsort(bins, kind='mergesort')
+        self.source_xyz = np.array([x[idx] for x in xyz], dtype='int16')
+        self.source_bins = np.array(bins[idx], dtype='uint16')
+
     def set_similarity(self, similarity='cc', normalize=None, pdf=None): 
         self.similarity = similarity
         if similarity in similarity_measures: 
@@ -118,16 +168,18 @@ class IconicMatcher:
         ## C-contiguity ensured 
         return np.dot(self.target_fromworld, np.dot(T, self.block_transform)) 
 
-    def eval(self, T):
+    def _set_joint_hist(self, T): 
         Tv = self.block_voxel_transform(T)
-        seed = self._interp
-        if self._interp < 0:
-            seed = - np.random.randint(maxint)
-        _joint_histogram(self.joint_hist, 
-                         self.source_block.flat, ## array iterator
-                         self.target_clamped, 
-                         Tv, 
-                         seed)
+        _joint_histogram_points(self.joint_hist, 
+                                self.source_xyz, 
+                                self.source_bins, 
+                                self.target_clamped, 
+                                Tv, 
+                                self._interp_code(), 
+                                self.nthreads)
+
+    def eval(self, T):
+        self._set_joint_hist(T)
         #self.source_hist = np.sum(self.joint_histo, 1)
         #self.target_hist = np.sum(self.joint_histo, 0)
         return _similarity(self.joint_hist, 
@@ -136,10 +188,95 @@ class IconicMatcher:
                            self._similarity, 
                            self.pdf)
 
+    def eval_similarities(self, T, similarities=['cc', 'cr', 'mi', 'nmi']):
+        """
+        values = eval_similarities(T, similarities=['cc', 'cr', 'mi', 'nmi'])
+
+        Dictionary of several similarity measures for the same
+        transformation T, e.g. for quality control. The joint
+        histogram is computed once, and the measures are evaluated in
+        a single pass over it. Available measures: 'cc', 'cr', 'crl1',
+        'je', 'ce', 'mi' and 'nmi'. 
+        """
+        self._set_joint_hist(T)
+        return _similarities(self.joint_hist, 
+                             self.source_hist, 
+                             self.target_hist, 
+                             similarities)
+
+    def eval_batch(self, Ts, batch_size=64):
+        """
+        simis = eval_batch(Ts, batch_size=64)
+
+        Similarity measures for a sequence of 4x4 transformations,
+        equivalent to [self.eval(T) for T in Ts]. Joint histograms
+        are computed by batches of at most batch_size transformations,
+        each in a single pass over the source points. 
+        """
+        Ts = list(Ts)
+        simis = np.zeros(len(Ts))
+        for k0 in range(0, len(Ts), batch_size):
+            k1 = min(k0+batch_size, len(Ts))
+            ## Use array rather than asarray to ensure contiguity 
+            Tvs = np.array([self.block_voxel_transform(T) for T in Ts[k0:k1]])
+            H = np.zeros((k1-k0,)+self.joint_hist.shape)
+            _joint_histogram_batch(H, 
+                                   self.source_xyz, 
+                                   self.source_bins, 
+                                   self.target_clamped, 
+                                   Tvs, 
+                                   self._interp_code(), 
+                                   self.nthreads)
+            for k in range(k1-k0):
+                self.joint_hist[:] = H[k]
+                simis[k0+k] = _similarity(self.joint_hist, 
+                                          self.source_hist, 
+                                          self.target_hist, 
+                                          self._similarity, 
+                                          self.pdf)
+        return simis
+
+    def eval_gradient(self, T):
+        """
+        simi, grad = eval_gradient(T)
+
+        Similarity measure and its derivatives with respect to the
+        coefficients of the 4x4 transformation T, as a (4,4) array
+        (with a zero last row). The joint histogram is computed using
+        PV interpolation regardless of the interpolation setting.
+        """
+        if not self.similarity in gradient_similarities: 
+            raise ValueError('No analytic gradient for similarity: ' + self.similarity)
+        if self.normalize != None: 
+            raise ValueError('No analytic gradient for normalized similarities')
+        Tv = self.block_voxel_transform(T)
+        if not hasattr(self, '_joint_hist_grad'): 
+            self._joint_hist_grad = np.zeros(self.joint_hist.shape+(12,))
+        _joint_histogram_gradient(self.joint_hist, 
+                                  self._joint_hist_grad, 
+                                  self.source_xyz, 
+                                  self.source_bins, 
+                                  self.target_clamped, 
+                                  Tv, 
+                                  self.nthreads)
+        simi, gv = _similarity_gradient(self.joint_hist, 
+                                        self._joint_hist_grad, 
+                                        self.source_hist, 
+                                        self.target_hist, 
+                                        self._similarity)
+        ## Tv = Tt^-1 * T * Ts ==> dS/dT = Tt^-t * dS/dTv * Ts^t
+        return simi, np.dot(self.target_fromworld[0:3,:].T, np.dot(gv, self.block_transform.T))
+
     ## FIXME: check that the dimension of start is consistent with the search space. 
     def optimize(self, search='rigid', method='powell', start=None, 
                  radius=BRAIN_RADIUS_MM, tol=1e-1, ftol=1e-2):
         """
+        method: 'simplex', 'powell', 'conjugate_gradient' or
+        'bfgs'. Gradient-based methods use the analytic similarity
+        gradient (see eval_gradient) for similarity measures 'cc',
+        'cr', 'mi' and 'nmi' with PV interpolation, and numerical
+        differentiation otherwise.
+
         radius: a parameter for the 'typical size' in mm of the object
         being registered. This is used to reformat the parameter
         vector (translation+rotation+scaling+shearing) so that each
@@ -155,6 +292,19 @@ class IconicMatcher:
         def loss(tc):
             T.from_param(tc)
             return -self.eval(T) 
+
+        # Loss function gradient 
+        def loss_gradient(tc):
+            T.from_param(tc)
+            simi, grad = self.eval_gradient(T)
+            return -np.sum(np.sum(T.param_jacobian()*grad, 2), 1)
+
+        # The analytic gradient is that of the PV joint histogram 
+        if self.similarity in gradient_similarities and self.normalize == None \
+                and self._interp == interp_methods['pv']: 
+            fprime = loss_gradient
+        else: 
+            fprime = None
     
         def callback(tc):
             T.from_param(tc)
@@ -175,7 +325,10 @@ class IconicMatcher:
             tc = sp.optimize.fmin_powell(loss, tc0, callback=callback, xtol=tol, ftol=ftol)
         elif method=='conjugate_gradient':
             print ('Optimizing using conjugate gradient descent...')
-            tc = sp.optimize.fmin_cg(loss, tc0, callback=callback, gtol=ftol)
+            tc = sp.optimize.fmin_cg(loss, tc0, fprime=fprime, callback=callback, gtol=ftol)
+        elif method=='bfgs':
+            print ('Optimizing using the BFGS method...')
+            tc = sp.optimize.fmin_bfgs(loss, tc0, fprime=fprime, callback=callback, gtol=ftol)
         else:
             raise ValueError('Unrecognized optimizer')
         
@@ -183,6 +336,60 @@ class IconicMatcher:
         T.from_param(tc)
         return T 
 
+    def pyramid(self, levels=3, min_size=16):
+        """
+        matchers = pyramid(levels=3, min_size=16)
+
+        Multi-resolution pyramid of IconicMatcher instances, from the
+        coarsest to the finest level (self). Each level is obtained by
+        cubic B-spline smoothing and decimation by two of both images
+        of the previous level, along each axis whose reduced size is
+        at least min_size. Levels are computed once and cached.
+        """
+        while len(self._pyramid) < levels: 
+            fine = self._pyramid[-1]
+            params = {}
+            for key in ['source', 'target']:
+                im = getattr(fine, key)
+                toworld = getattr(fine, key+'_toworld')
+                mask = fine._clamp_params[key+'_mask']
+                axes = [a for a in range(3) if (im.shape[a]+1)//2 >= min_size]
+                S = np.eye(4)
+                S[axes, axes] = 2
+                sl = [slice(None)]*3
+                for a in axes: 
+                    sl[a] = slice(None, None, 2)
+                params[key] = cspline_reduce(im, axes)
+                params[key+'_toworld'] = np.dot(toworld, S)
+                if mask is not None: 
+                    params[key+'_mask'] = np.array(mask[tuple(sl)])
+            coarse = IconicMatcher(params['source'], params['target'], 
+                                   params['source_toworld'], params['target_toworld'],
+                                   fine._clamp_params['source_th'], fine._clamp_params['target_th'], 
+                                   params.get('source_mask'), params.get('target_mask'),
+                                   fine._clamp_params['source_bins'], fine._clamp_params['target_bins'], 
+                                   nthreads=self.nthreads)
+            self._pyramid.append(coarse)
+        return self._pyramid[levels-1::-1]
+
+    def optimize_pyramid(self, levels=3, search='rigid', method='powell', start=None, 
+                         **kwargs): 
+        """
+        Coarse-to-fine registration: run optimize at each level of the
+        pyramid (see pyramid), starting each level from the result of
+        the previous one. Coarse levels use the current interpolation
+        and similarity settings with a full field of view, and the
+        finest level uses the field of view of self. Extra keyword
+        arguments are passed to optimize.
+        """
+        T = start
+        for matcher in self.pyramid(levels): 
+            if not matcher is self: 
+                matcher.set_interpolation(self.interp, self.interp_seed)
+                matcher.set_similarity(self.similarity, self.normalize, self.pdf)
+            T = matcher.optimize(search=search, method=method, start=T, **kwargs)
+        return T
+
     # Return a set of similarity
     def explore(self, 
                 ux=[0], uy=[0], uz=[0],
@@ -208,18 +415,17 @@ class IconicMatcher:
         QX = np.asarray(qx)[grids[9,:]].ravel()
         QY = np.asarray(qy)[grids[10,:]].ravel()
         QZ = np.asarray(qz)[grids[11,:]].ravel()
-        simis = np.zeros(ntrials)
         vec12s = np.zeros([12, ntrials])
 
-        T = Affine()
+        Ts = []
         for i in range(ntrials):
             t = np.array([UX[i], UY[i], UZ[i],
                           RX[i], RY[i], RZ[i],
                           SX[i], SY[i], SZ[i],
                           QX[i], QY[i], QZ[i]])
-            T.set_vec12(t)
-            simis[i] = self.eval(T)
+            Ts.append(Affine(vec12=t).__array__())
             vec12s[:, i] = t 
+        simis = self.eval_batch(Ts)
 
         return simis, vec12s
         
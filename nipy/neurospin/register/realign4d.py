@@ -1,6 +1,8 @@
-from routines import cspline_transform, cspline_sample4d, slice_time
+from routines import cspline_transform, cspline_resample4d, cspline_resample4d_frames, \
+    cspline_resample4d_slices, slice_time, threads_count
 from transform import Affine, apply_affine, BRAIN_RADIUS_MM
 
+import threading
 import numpy as np
 from scipy import optimize
         
@@ -8,6 +10,9 @@ DEFAULT_SPEEDUP = 4
 DEFAULT_OPTIMIZER = 'powell'
 DEFAULT_WITHIN_LOOPS = 2
 DEFAULT_BETWEEN_LOOPS = 5 
+RESAMPLE_BLOCK = 16 # number of scans fully resampled per call
+STREAM_BLOCK = 16 # minimum number of scans served by a streaming window
+STREAM_MARGIN = 16 # extra scans filtered on each side of a streaming window
 
 
 def grid_coords(xyz, affine, from_world, to_world):
@@ -97,20 +102,114 @@ class Image4d(object):
         return self.to_world
 
 
+class SplineWindow(object):
+    """
+    Cubic spline coefficients of a sliding window of scans of a 4d
+    array, which may be a memory map: only the scans of the window,
+    extended by STREAM_MARGIN scans on each side, are read and held
+    in memory. 
+
+    The temporal prefilter has infinite support but decays as
+    0.268**k, hence the window coefficients differ from those of the
+    whole run by about 1e-10 times the signal amplitude (not at all if
+    the extended window covers the run). 
+    """
+    def __init__(self, array, dtype='double', nthreads=1, 
+                 block=STREAM_BLOCK, margin=STREAM_MARGIN):
+        self.array = array
+        self.nscans = array.shape[3]
+        self.dtype = dtype
+        self.nthreads = nthreads
+        self.block = block
+        self.margin = margin
+        self.coef = None
+        self.start = 0
+        self.stop = 0
+        self.spatial = None
+        self.spatial_start = 0
+        self.lock = threading.Lock()
+
+    def get(self, tmin, tmax): 
+        """
+        C, offset = get(tmin, tmax)
+
+        Coefficients C such that time coordinates in [tmin, tmax]
+        become coordinates in [tmin-offset, tmax-offset] in C. The
+        window is moved if needed. 
+        """
+        start = min(max(int(np.floor(tmin))-1, 0), self.nscans-1)
+        stop = max(min(int(np.floor(tmax))+3, self.nscans), start+1)
+        self.lock.acquire()
+        try: 
+            if self.coef is None or start < self.start or stop > self.stop: 
+                # One scan of slack on each side against small motions
+                start = max(start-1, 0)
+                stop = min(max(stop+1, start+self.block), self.nscans)
+                self._load(start, stop)
+            return self.coef, self.start
+        finally: 
+            self.lock.release()
+
+    def _load(self, start, stop):
+        a = max(start-self.margin, 0)
+        b = min(stop+self.margin, self.nscans)
+        # Spatial coefficients of scans [a, b), reusing those of the
+        # previous window
+        S = np.zeros(self.array.shape[0:3]+(b-a,))
+        for t in range(a, b):
+            k = t - self.spatial_start
+            if self.spatial is not None and k >= 0 and k < self.spatial.shape[3]: 
+                S[:,:,:,t-a] = self.spatial[:,:,:,k]
+            else: 
+                S[:,:,:,t-a] = cspline_transform(np.asarray(self.array[:,:,:,t]), nthreads=self.nthreads)
+        self.spatial = S
+        self.spatial_start = a 
+        C = cspline_transform(S, axes=[3], nthreads=self.nthreads)
+        self.coef = np.array(C[:,:,:,start-a:stop-a], dtype=self.dtype)
+        self.start = start
+        self.stop = stop
+
+
 class Realign4d(object):
 
     def __init__(self, 
                  im4d, 
                  speedup=DEFAULT_SPEEDUP,
                  optimizer=DEFAULT_OPTIMIZER, 
-                 transforms=None):
+                 transforms=None, 
+                 single_precision=False, 
+                 nthreads=1, 
+                 streaming=False):
+        """
+        If single_precision is True, the 4d cubic spline coefficients
+        are stored in float32, which halves their memory footprint
+        and bandwidth at the expense of a relative interpolation
+        error of about 1e-7.
+
+        nthreads is the number of threads used to compute the cubic
+        spline coefficients and to resample scans (all available
+        processors if nthreads<=0). If nthreads is not 1, the scans
+        are also estimated concurrently within each motion correction
+        sweep, each against the other scans as resampled at the
+        beginning of the sweep, rather than one after the other. The
+        result then does not depend on the actual number of threads.
+
+        If streaming is True, the 4d array of im4d, typically a memory
+        map, is read scan by scan, and only the cubic spline
+        coefficients of a sliding window of scans are kept in memory
+        (see SplineWindow), so that memory does not grow with the
+        number of scans except for the subsampled in-mask data. 
+        """
+        self.nthreads = nthreads
         self.optimizer = optimizer
         dims = im4d.array.shape
         self.dims = dims 
         self.nscans = dims[3]
         # Define mask
         speedup = max(1, int(speedup))
+        self.speedup = speedup
         xyz = np.mgrid[0:dims[0]:speedup, 0:dims[1]:speedup, 0:dims[2]:speedup]
+        self.mask_shape = xyz.shape[1::]
         self.xyz = xyz.reshape(3, np.prod(xyz.shape[1::]))   
         masksize = self.xyz.shape[1]
         self.data = np.zeros([masksize, self.nscans], dtype='double')
@@ -122,19 +221,116 @@ class Realign4d(object):
         else: 
             self.transforms = transforms
         self.from_time = im4d.from_time
+        self.im4d = im4d
         self.timestamps = im4d.tr*np.array(range(self.nscans))
         # Compute the 4d cubic spline transform
-        self.cbspline = cspline_transform(im4d.array)
+        if single_precision: 
+            dtype = 'float32'
+        else: 
+            dtype = 'double'
+        if streaming: 
+            self.cbspline = None
+            self.window = SplineWindow(im4d.array, dtype=dtype, nthreads=nthreads)
+            self.block = STREAM_BLOCK
+        else: 
+            self.cbspline = cspline_transform(im4d.array, nthreads=nthreads)
+            if single_precision: 
+                self.cbspline = self.cbspline.astype(dtype)
+            self.window = None
+            self.block = self.nscans
+
+    def _coef(self, tmin, tmax):
+        """
+        C, offset = _coef(tmin, tmax)
+
+        Cubic spline coefficients to be sampled at time coordinates
+        T-offset, with tmin <= T <= tmax. 
+        """
+        if self.window is None: 
+            return self.cbspline, 0
+        return self.window.get(tmin, tmax)
+
+    def _time_bounds(self, Tv, frames, shape):
+        """
+        tmin, tmax = _time_bounds(Tv, frames, shape)
+
+        Bounds of the time coordinates of the given scans resampled by
+        _resample_frames, derived from the range of their transformed
+        slice coordinates. None if some of these are negative, in
+        which case the time coordinates are to be computed explicitly.
+        """
+        im4d = self.im4d
+        corners = np.array([[x, y, z, 1] for x in (0, shape[0]-1) 
+                            for y in (0, shape[1]-1) for z in (0, shape[2]-1)]).T
+        Z = np.dot(Tv[:,2,:], corners)
+        if im4d.reversed_slices: 
+            Z = im4d.nslices - 1 - Z
+        if Z.min() <= -1: 
+            return None
+        nslices = im4d.slice_order.size
+        cycles = np.floor(np.maximum(Z, 0))//nslices
+        interp = np.concatenate((im4d.slice_order, [nslices]))
+        s = [c + im4d.tr_slices*i for c in (cycles.min(), cycles.max()) 
+             for i in (interp.min(), interp.max())]
+        t = self.timestamps[frames] - im4d.start
+        return (t.min()-max(s))/im4d.tr, (t.max()-min(s))/im4d.tr
+
+    def _blocks(self, size):
+        return [range(t, min(t+size, self.nscans)) for t in range(0, self.nscans, size)]
+
+    def _resample_grid(self, t, shape, step=1):
+        """
+        Resample scan t on the grid of the given shape with spacing
+        step (in voxels) by affine cubic spline resampling. Only the
+        transformed z coordinates are computed explicitly, to get the
+        slice acquisition times. 
+        """
+        Tv = np.dot(self.from_world, np.dot(self.transforms[t], self.to_world))
+        Tv = np.dot(Tv, np.diag([step, step, step, 1]))
+        x, y, z = np.ogrid[0:shape[0], 0:shape[1], 0:shape[2]]
+        Z = Tv[2,0]*x + Tv[2,1]*y + Tv[2,2]*z + Tv[2,3]
+        T = self.from_time(Z, self.timestamps[t])
+        C, offset = self._coef(T.min(), T.max())
+        return cspline_resample4d(C, Tv, T-offset)
+
+    def _resample_frames(self, frames, shape, step=1):
+        """
+        Same as _resample_grid for a list of scans, resampled in a
+        single call with scans distributed across threads. Returns an
+        array with the scan index first. The time coordinates are
+        derived from the slice timing of the input image within the
+        interpolation kernel, unless their range can't be bounded
+        beforehand. 
+        """
+        S = np.diag([step, step, step, 1])
+        Tv = np.array([np.dot(np.dot(self.from_world, np.dot(self.transforms[t], self.to_world)), S) 
+                       for t in frames])
+        if self.window is None: 
+            bounds = (0, 0)
+        else: 
+            bounds = self._time_bounds(Tv, frames, shape)
+        if not bounds == None: 
+            C, offset = self._coef(*bounds)
+            im4d = self.im4d
+            return cspline_resample4d_slices(C, Tv, self.timestamps[frames], shape, 
+                                             im4d.start, im4d.tr, im4d.tr_slices, im4d.slice_order, 
+                                             reversed=im4d.reversed_slices, last_slice=im4d.nslices-1, 
+                                             shift=offset, nthreads=self.nthreads)
+        x, y, z = np.ogrid[0:shape[0], 0:shape[1], 0:shape[2]]
+        A = Tv[:,2,:,np.newaxis,np.newaxis,np.newaxis]
+        Z = A[:,0]*x + A[:,1]*y + A[:,2]*z + A[:,3]
+        T = self.from_time(Z, self.timestamps[frames][:,np.newaxis,np.newaxis,np.newaxis])
+        C, offset = self._coef(T.min(), T.max())
+        return cspline_resample4d_frames(C, Tv, T-offset, nthreads=self.nthreads)
               
     def resample_inmask(self, t):
-        X, Y, Z = grid_coords(self.xyz, self.transforms[t], self.from_world, self.to_world)
-        T = self.from_time(Z, self.timestamps[t])
-        cspline_sample4d(self.data[:,t], self.cbspline, X, Y, Z, T)
+        self.data[:,t] = self._resample_grid(t, self.mask_shape, self.speedup).ravel()
 
     def resample_all_inmask(self):
-        for t in range(self.nscans):
-            print('Resampling scan %d/%d' % (t+1, self.nscans))
-            self.resample_inmask(t)
+        print('Resampling %d scans' % self.nscans)
+        for frames in self._blocks(self.block): 
+            R = self._resample_frames(frames, self.mask_shape, self.speedup)
+            self.data[:,frames[0]:frames[-1]+1] = R.reshape(len(frames), -1).T
 
     def init_motion_detection(self, t):
         """
@@ -202,6 +398,9 @@ class Realign4d(object):
         self.resample_all_inmask()
 
         # Optimize motion parameters 
+        if not self.nthreads == 1: 
+            self._correct_motion_threads(fmin)
+            return 
         for t in range(self.nscans):
             print('Correcting motion of scan %d/%d...' % (t+1, self.nscans))
 
@@ -214,46 +413,106 @@ class Realign4d(object):
             pc = fmin(loss, pc0, callback=callback)
             self.transforms[t].from_param(pc)
 
+    def _estimate_motion(self, t, fmin, m):
+        """
+        Optimize the motion parameters of scan t with respect to the
+        mean square difference with the fixed in-mask image m. Only
+        the transform of scan t is modified. 
+        """
+        def loss(pc):
+            self.transforms[t].from_param(pc)
+            d = self._resample_grid(t, self.mask_shape, self.speedup).ravel()
+            d -= m
+            d **= 2
+            return d.mean()
+
+        pc0 = self.transforms[t].to_param()
+        pc = fmin(loss, pc0, disp=0)
+        self.transforms[t].from_param(pc)
 
-    def resample(self):
-        print('Gridding...')
+    def _correct_motion_threads(self, fmin):
+        """
+        Estimate all scans concurrently, each against the mean of
+        the other scans in self.data. Python threads mostly run in
+        the C resampling routine, which releases the GIL. In streaming
+        mode, scans are estimated block by block. 
+        """
+        n = self.nscans
+        nthreads = min(threads_count(self.nthreads), n)
+        total = self.data.sum(1)
+        errors = []
+
+        def work(frames):
+            try: 
+                for t in frames:
+                    print('Correcting motion of scan %d/%d...' % (t+1, n))
+                    m = (total - self.data[:,t])/(n-1.0)
+                    self._estimate_motion(t, fmin, m)
+            except Exception as e: 
+                errors.append(e)
+
+        for frames in self._blocks(self.block): 
+            threads = [threading.Thread(target=work, args=(frames[rank::nthreads],)) for rank in range(nthreads)]
+            for thread in threads: 
+                thread.start()
+            for thread in threads: 
+                thread.join()
+            if errors: 
+                raise errors[0]
+
+    def resample(self, out=None):
+        """
+        Resample all scans into out, a writable array of the shape of
+        the input (e.g. a memory map), or a new array if None. 
+        """
         dims = self.dims
-        XYZ = np.mgrid[0:dims[0], 0:dims[1], 0:dims[2]]
-        XYZ = XYZ.reshape(3, np.prod(XYZ.shape[1::]))
-        res = np.zeros(dims)
-        for t in range(self.nscans):
-            print('Fully resampling scan %d/%d' % (t+1, self.nscans))
-            X, Y, Z = grid_coords(XYZ, self.transforms[t], self.from_world, self.to_world)
-            T = self.from_time(Z, self.timestamps[t])
-            cspline_sample4d(res[:,:,:,t], self.cbspline, X, Y, Z, T)
+        if out is None: 
+            out = np.zeros(dims)
+        for frames in self._blocks(RESAMPLE_BLOCK):
+            print('Fully resampling scans %d-%d/%d' % (frames[0]+1, frames[-1]+1, self.nscans))
+            R = self._resample_frames(frames, dims[0:3])
+            out[:,:,:,frames[0]:frames[-1]+1] = np.rollaxis(R, 0, 4)
+        return out
+
+    def resample_mean(self):
+        """
+        Mean of the resampled scans, computed block by block without
+        holding the whole resampled run. 
+        """
+        res = np.zeros(self.dims[0:3])
+        for frames in self._blocks(RESAMPLE_BLOCK):
+            res += self._resample_frames(frames, self.dims[0:3]).sum(0)
+        res /= self.nscans
         return res
     
 
 
 
 
-def _resample4d(im4d, transforms=None): 
+def _resample4d(im4d, transforms=None, nthreads=1, streaming=False, out=None): 
     """
-    corr_im4d_array = _resample4d(im4d, transforms=None)
+    corr_im4d_array = _resample4d(im4d, transforms=None, nthreads=1, streaming=False, out=None)
     """
-    r = Realign4d(im4d, transforms=transforms)
-    return r.resample()
+    r = Realign4d(im4d, transforms=transforms, nthreads=nthreads, streaming=streaming)
+    return r.resample(out=out)
 
 
 
 def _realign4d(im4d, 
                loops=DEFAULT_WITHIN_LOOPS, 
                speedup=DEFAULT_SPEEDUP, 
-               optimizer=DEFAULT_OPTIMIZER): 
+               optimizer=DEFAULT_OPTIMIZER, 
+               nthreads=1, 
+               streaming=False): 
     """
-    transforms = _realign4d(im4d, loops=2, speedup=4, optimizer='powell')
+    transforms = _realign4d(im4d, loops=2, speedup=4, optimizer='powell', nthreads=1, streaming=False)
 
     Parameters
     ----------
     im4d : Image4d instance
 
     """ 
-    r = Realign4d(im4d, speedup=speedup, optimizer=optimizer)
+    r = Realign4d(im4d, speedup=speedup, optimizer=optimizer, nthreads=nthreads, streaming=streaming)
     for loop in range(loops): 
         r.correct_motion()
     return r.transforms
@@ -263,14 +522,21 @@ def realign4d(runs,
               between_loops=DEFAULT_BETWEEN_LOOPS, 
               speedup=DEFAULT_SPEEDUP, 
               optimizer=DEFAULT_OPTIMIZER, 
-              align_runs=True): 
+              align_runs=True, 
+              nthreads=1, 
+              streaming=False): 
     """
-    transforms = realign4d(runs, within_loops=2, bewteen_loops=5, speedup=4, optimizer='powell')
+    transforms = realign4d(runs, within_loops=2, bewteen_loops=5, speedup=4, optimizer='powell', 
+                           nthreads=1, streaming=False)
 
     Parameters
     ----------
 
     runs : list of Image4d objects
+
+    nthreads : number of threads, see Realign4d
+
+    streaming : out-of-core processing of each run, see Realign4d
     
     Returns
     -------
@@ -284,7 +550,9 @@ def realign4d(runs,
     nruns = len(runs)
 
     # Correct motion and slice timing in each sequence separately
-    transfo_runs = [_realign4d(run, loops=within_loops, speedup=speedup, optimizer=optimizer) for run in runs]
+    transfo_runs = [_realign4d(run, loops=within_loops, speedup=speedup, optimizer=optimizer, 
+                               nthreads=nthreads, streaming=streaming) 
+                    for run in runs]
     if nruns==1: 
         return transfo_runs[0]
 
@@ -292,13 +560,19 @@ def realign4d(runs,
         return transfo_runs
 
     # Correct between-session motion using the mean image of each corrected run 
-    corr_runs = [_resample4d(runs[i], transforms=transfo_runs[i]) for i in range(nruns)]
-    aux = np.rollaxis(np.asarray([corr_run.mean(3) for corr_run in corr_runs]), 0, 4)
+    if streaming: 
+        means = [Realign4d(runs[i], transforms=transfo_runs[i], nthreads=nthreads, 
+                           streaming=True).resample_mean() for i in range(nruns)]
+    else: 
+        corr_runs = [_resample4d(runs[i], transforms=transfo_runs[i], nthreads=nthreads) for i in range(nruns)]
+        means = [corr_run.mean(3) for corr_run in corr_runs]
+    aux = np.rollaxis(np.asarray(means), 0, 4)
     ## Fake time series with zero inter-slice time 
     ## FIXME: check that all runs have the same to-world transform
     mean_img = Image4d(aux, to_world=runs[0].to_world, tr=1.0, tr_slices=0.0) 
-    transfo_mean = _realign4d(mean_img, loops=between_loops, speedup=speedup, optimizer=optimizer)
-    corr_mean = _resample4d(mean_img, transforms=transfo_mean)
+    transfo_mean = _realign4d(mean_img, loops=between_loops, speedup=speedup, optimizer=optimizer, 
+                              nthreads=nthreads)
+    corr_mean = _resample4d(mean_img, transforms=transfo_mean, nthreads=nthreads)
 
     # Compose transformations for each run
     for i in range(nruns):
@@ -1,7256 +0,0 @@
-/* Generated by Cython 0.10.3 on Fri Aug 28 00:24:08 2009 */
-
-#define PY_SSIZE_T_CLEAN
-#include "Python.h"
-#include "structmember.h"
-#ifndef PY_LONG_LONG
-  #define PY_LONG_LONG LONG_LONG
-#endif
-#ifndef DL_EXPORT
-  #define DL_EXPORT(t) t
-#endif
-#if PY_VERSION_HEX < 0x02040000
-  #define METH_COEXIST 0
-#endif
-#if PY_VERSION_HEX < 0x02050000
-  typedef int Py_ssize_t;
-  #define PY_SSIZE_T_MAX INT_MAX
-  #define PY_SSIZE_T_MIN INT_MIN
-  #define PyInt_FromSsize_t(z) PyInt_FromLong(z)
-  #define PyInt_AsSsize_t(o)   PyInt_AsLong(o)
-  #define PyNumber_Index(o)    PyNumber_Int(o)
-  #define PyIndex_Check(o)     PyNumber_Check(o)
-#endif
-#if PY_VERSION_HEX < 0x02060000
-  #define Py_REFCNT(ob) (((PyObject*)(ob))->ob_refcnt)
-  #define Py_TYPE(ob)   (((PyObject*)(ob))->ob_type)
-  #define Py_SIZE(ob)   (((PyVarObject*)(ob))->ob_size)
-  #define PyVarObject_HEAD_INIT(type, size) \
-          PyObject_HEAD_INIT(type) size,
-  #define PyType_Modified(t)
-
-  typedef struct {
-       void *buf;
-       PyObject *obj;
-       Py_ssize_t len;
-       Py_ssize_t itemsize;
-       int readonly;
-       int ndim;
-       char *format;
-       Py_ssize_t *shape;
-       Py_ssize_t *strides;
-       Py_ssize_t *suboffsets;
-       void *internal;
-  } Py_buffer;
-
-  #define PyBUF_SIMPLE 0
-  #define PyBUF_WRITABLE 0x0001
-  #define PyBUF_LOCK 0x0002
-  #define PyBUF_FORMAT 0x0004
-  #define PyBUF_ND 0x0008
-  #define PyBUF_STRIDES (0x0010 | PyBUF_ND)
-  #define PyBUF_C_CONTIGUOUS (0x0020 | PyBUF_STRIDES)
-  #define PyBUF_F_CONTIGUOUS (0x0040 | PyBUF_STRIDES)
-  #define PyBUF_ANY_CONTIGUOUS (0x0080 | PyBUF_STRIDES)
-  #define PyBUF_INDIRECT (0x0100 | PyBUF_STRIDES)
-
-#endif
-#if PY_MAJOR_VERSION < 3
-  #define __Pyx_BUILTIN_MODULE_NAME "__builtin__"
-#else
-  #define __Pyx_BUILTIN_MODULE_NAME "builtins"
-#endif
-#if PY_MAJOR_VERSION >= 3
-  #define Py_TPFLAGS_CHECKTYPES 0
-  #define Py_TPFLAGS_HAVE_INDEX 0
-#endif
-#if (PY_VERSION_HEX < 0x02060000) || (PY_MAJOR_VERSION >= 3)
-  #define Py_TPFLAGS_HAVE_NEWBUFFER 0
-#endif
-#if PY_MAJOR_VERSION >= 3
-  #define PyBaseString_Type            PyUnicode_Type
-  #define PyString_Type                PyBytes_Type
-  #define PyInt_Type                   PyLong_Type
-  #define PyInt_Check(op)              PyLong_Check(op)
-  #define PyInt_CheckExact(op)         PyLong_CheckExact(op)
-  #define PyInt_FromString             PyLong_FromString
-  #define PyInt_FromUnicode            PyLong_FromUnicode
-  #define PyInt_FromLong               PyLong_FromLong
-  #define PyInt_FromSize_t             PyLong_FromSize_t
-  #define PyInt_FromSsize_t            PyLong_FromSsize_t
-  #define PyInt_AsLong                 PyLong_AsLong
-  #define PyInt_AS_LONG                PyLong_AS_LONG
-  #define PyInt_AsSsize_t              PyLong_AsSsize_t
-  #define PyInt_AsUnsignedLongMask     PyLong_AsUnsignedLongMask
-  #define PyInt_AsUnsignedLongLongMask PyLong_AsUnsignedLongLongMask
-  #define __Pyx_PyNumber_Divide(x,y)         PyNumber_TrueDivide(x,y)
-#else
-  #define __Pyx_PyNumber_Divide(x,y)         PyNumber_Divide(x,y)
-  #define PyBytes_Type                 PyString_Type
-#endif
-#if PY_MAJOR_VERSION >= 3
-  #define PyMethod_New(func, self, klass) PyInstanceMethod_New(func)
-#endif
-#if !defined(WIN32) && !defined(MS_WINDOWS)
-  #ifndef __stdcall
-    #define __stdcall
-  #endif
-  #ifndef __cdecl
-    #define __cdecl
-  #endif
-#else
-  #define _USE_MATH_DEFINES
-#endif
-#ifdef __cplusplus
-#define __PYX_EXTERN_C extern "C"
-#else
-#define __PYX_EXTERN_C extern
-#endif
-#include <math.h>
-#define __PYX_HAVE_API__nipy__neurospin__register__routines
-#include "numpy/arrayobject.h"
-#include "iconic.h"
-#include "cubic_spline.h"
-#include "stdlib.h"
-
-
-#ifdef __GNUC__
-#define INLINE __inline__
-#elif _WIN32
-#define INLINE __inline
-#else
-#define INLINE 
-#endif
-
-typedef struct {PyObject **p; char *s; long n; char is_unicode; char intern; char is_identifier;} __Pyx_StringTabEntry; /*proto*/
-
-
-
-static int __pyx_skip_dispatch = 0;
-
-
-/* Type Conversion Predeclarations */
-
-#if PY_MAJOR_VERSION < 3
-#define __Pyx_PyBytes_FromString PyString_FromString
-#define __Pyx_PyBytes_AsString   PyString_AsString
-#else
-#define __Pyx_PyBytes_FromString PyBytes_FromString
-#define __Pyx_PyBytes_AsString   PyBytes_AsString
-#endif
-
-#define __Pyx_PyBool_FromLong(b) ((b) ? (Py_INCREF(Py_True), Py_True) : (Py_INCREF(Py_False), Py_False))
-static INLINE int __Pyx_PyObject_IsTrue(PyObject* x);
-static INLINE PY_LONG_LONG __pyx_PyInt_AsLongLong(PyObject* x);
-static INLINE unsigned PY_LONG_LONG __pyx_PyInt_AsUnsignedLongLong(PyObject* x);
-static INLINE Py_ssize_t __pyx_PyIndex_AsSsize_t(PyObject* b);
-
-#define __pyx_PyInt_AsLong(x) (PyInt_CheckExact(x) ? PyInt_AS_LONG(x) : PyInt_AsLong(x))
-#define __pyx_PyFloat_AsDouble(x) (PyFloat_CheckExact(x) ? PyFloat_AS_DOUBLE(x) : PyFloat_AsDouble(x))
-
-static INLINE unsigned char __pyx_PyInt_unsigned_char(PyObject* x);
-static INLINE unsigned short __pyx_PyInt_unsigned_short(PyObject* x);
-static INLINE char __pyx_PyInt_char(PyObject* x);
-static INLINE short __pyx_PyInt_short(PyObject* x);
-static INLINE int __pyx_PyInt_int(PyObject* x);
-static INLINE long __pyx_PyInt_long(PyObject* x);
-static INLINE signed char __pyx_PyInt_signed_char(PyObject* x);
-static INLINE signed short __pyx_PyInt_signed_short(PyObject* x);
-static INLINE signed int __pyx_PyInt_signed_int(PyObject* x);
-static INLINE signed long __pyx_PyInt_signed_long(PyObject* x);
-static INLINE long double __pyx_PyInt_long_double(PyObject* x);
-#ifdef __GNUC__
-/* Test for GCC > 2.95 */
-#if __GNUC__ > 2 ||               (__GNUC__ == 2 && (__GNUC_MINOR__ > 95)) 
-#define likely(x)   __builtin_expect(!!(x), 1)
-#define unlikely(x) __builtin_expect(!!(x), 0)
-#else /* __GNUC__ > 2 ... */
-#define likely(x)   (x)
-#define unlikely(x) (x)
-#endif /* __GNUC__ > 2 ... */
-#else /* __GNUC__ */
-#define likely(x)   (x)
-#define unlikely(x) (x)
-#endif /* __GNUC__ */
-    
-static PyObject *__pyx_m;
-static PyObject *__pyx_b;
-static PyObject *__pyx_empty_tuple;
-static int __pyx_lineno;
-static int __pyx_clineno = 0;
-static const char * __pyx_cfilenm= __FILE__;
-static const char *__pyx_filename;
-static const char **__pyx_f;
-
-static char __pyx_mdoc[] = "\nFast registration routines module: joint histogram computation,\nsimilarity measures, cubic spline resampling, affine transformation\nparameterization.\n\nAuthor: Alexis Roche, 2008.\n";
-
-static void __Pyx_RaiseDoubleKeywordsError(
-    const char* func_name, PyObject* kw_name); /*proto*/
-
-static void __Pyx_RaiseArgtupleInvalid(const char* func_name, int exact,
-    Py_ssize_t num_min, Py_ssize_t num_max, Py_ssize_t num_found); /*proto*/
-
-static int __Pyx_ParseOptionalKeywords(PyObject *kwds, PyObject **argnames[],     PyObject *kwds2, PyObject *values[], Py_ssize_t num_pos_args,     const char* function_name); /*proto*/
-
-static INLINE PyObject *__Pyx_GetItemInt(PyObject *o, Py_ssize_t i, int is_unsigned) {
-    PyObject *r;
-    if (PyList_CheckExact(o) && 0 <= i && i < PyList_GET_SIZE(o)) {
-        r = PyList_GET_ITEM(o, i);
-        Py_INCREF(r);
-    }
-    else if (PyTuple_CheckExact(o) && 0 <= i && i < PyTuple_GET_SIZE(o)) {
-        r = PyTuple_GET_ITEM(o, i);
-        Py_INCREF(r);
-    }
-    else if (Py_TYPE(o)->tp_as_sequence && Py_TYPE(o)->tp_as_sequence->sq_item && (likely(i >= 0) || !is_unsigned))
-        r = PySequence_GetItem(o, i);
-    else {
-        PyObject *j = (likely(i >= 0) || !is_unsigned) ? PyInt_FromLong(i) : PyLong_FromUnsignedLongLong((sizeof(unsigned long long) > sizeof(Py_ssize_t) ? (1ULL << (sizeof(Py_ssize_t)*8)) : 0) + i);
-        if (!j)
-            return 0;
-        r = PyObject_GetItem(o, j);
-        Py_DECREF(j);
-    }
-    return r;
-}
-
-static int __Pyx_ArgTypeTest(PyObject *obj, PyTypeObject *type, int none_allowed,
-    const char *name, int exact); /*proto*/
-
-static PyObject *__Pyx_Import(PyObject *name, PyObject *from_list); /*proto*/
-
-static PyObject *__Pyx_GetName(PyObject *dict, PyObject *name); /*proto*/
-
-static int __Pyx_TypeTest(PyObject *obj, PyTypeObject *type); /*proto*/
-
-static INLINE void __Pyx_ExceptionSave(PyObject **type, PyObject **value, PyObject **tb); /*proto*/
-static void __Pyx_ExceptionReset(PyObject *type, PyObject *value, PyObject *tb); /*proto*/
-
-static void __Pyx_Raise(PyObject *type, PyObject *value, PyObject *tb); /*proto*/
-
-static INLINE void __Pyx_ErrRestore(PyObject *type, PyObject *value, PyObject *tb); /*proto*/
-static INLINE void __Pyx_ErrFetch(PyObject **type, PyObject **value, PyObject **tb); /*proto*/
-
-static int __Pyx_GetException(PyObject **type, PyObject **value, PyObject **tb); /*proto*/
-
-static PyTypeObject *__Pyx_ImportType(const char *module_name, const char *class_name, long size);  /*proto*/
-
-static PyObject *__Pyx_ImportModule(const char *name); /*proto*/
-
-static void __Pyx_AddTraceback(const char *funcname); /*proto*/
-
-static int __Pyx_InitStrings(__Pyx_StringTabEntry *t); /*proto*/
-
-/* Type declarations */
-
-typedef npy_int8 __pyx_t_5numpy_int8_t;
-
-typedef npy_int16 __pyx_t_5numpy_int16_t;
-
-typedef npy_int32 __pyx_t_5numpy_int32_t;
-
-typedef npy_int64 __pyx_t_5numpy_int64_t;
-
-typedef npy_uint8 __pyx_t_5numpy_uint8_t;
-
-typedef npy_uint16 __pyx_t_5numpy_uint16_t;
-
-typedef npy_uint32 __pyx_t_5numpy_uint32_t;
-
-typedef npy_uint64 __pyx_t_5numpy_uint64_t;
-
-typedef npy_float32 __pyx_t_5numpy_float32_t;
-
-typedef npy_float64 __pyx_t_5numpy_float64_t;
-
-typedef npy_long __pyx_t_5numpy_int_t;
-
-typedef npy_longlong __pyx_t_5numpy_long_t;
-
-typedef npy_ulong __pyx_t_5numpy_uint_t;
-
-typedef npy_ulonglong __pyx_t_5numpy_ulong_t;
-
-typedef npy_double __pyx_t_5numpy_float_t;
-
-typedef npy_double __pyx_t_5numpy_double_t;
-
-typedef npy_longdouble __pyx_t_5numpy_longdouble_t;
-
-typedef npy_cfloat __pyx_t_5numpy_cfloat_t;
-
-typedef npy_cdouble __pyx_t_5numpy_cdouble_t;
-
-typedef npy_clongdouble __pyx_t_5numpy_clongdouble_t;
-
-/* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":69
- * 
- * # Enumerate texture measures
- * cdef enum texture_measure:             # <<<<<<<<<<<<<<
- *     MIN,
- *     MAX,
- */
-
-enum __pyx_t_4nipy_9neurospin_8register_8routines_texture_measure {
-  __pyx_e_4nipy_9neurospin_8register_8routines_MIN,
-  __pyx_e_4nipy_9neurospin_8register_8routines_MAX,
-  __pyx_e_4nipy_9neurospin_8register_8routines_DRANGE,
-  __pyx_e_4nipy_9neurospin_8register_8routines_MEAN,
-  __pyx_e_4nipy_9neurospin_8register_8routines_VARIANCE,
-  __pyx_e_4nipy_9neurospin_8register_8routines_MEDIAN,
-  __pyx_e_4nipy_9neurospin_8register_8routines_L1DEV,
-  __pyx_e_4nipy_9neurospin_8register_8routines_ENTROPY,
-  __pyx_e_4nipy_9neurospin_8register_8routines_CUSTOM_TEXTURE
-};
-
-/* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":93
- * 
- * # Enumerate similarity measures
- * cdef enum similarity_measure:             # <<<<<<<<<<<<<<
- *     CORRELATION_COEFFICIENT,
- *     CORRELATION_RATIO,
- */
-
-enum __pyx_t_4nipy_9neurospin_8register_8routines_similarity_measure {
-  __pyx_e_4nipy_9neurospin_8register_8routines_CORRELATION_COEFFICIENT,
-  __pyx_e_4nipy_9neurospin_8register_8routines_CORRELATION_RATIO,
-  __pyx_e_4nipy_9neurospin_8register_8routines_CORRELATION_RATIO_L1,
-  __pyx_e_4nipy_9neurospin_8register_8routines_JOINT_ENTROPY,
-  __pyx_e_4nipy_9neurospin_8register_8routines_CONDITIONAL_ENTROPY,
-  __pyx_e_4nipy_9neurospin_8register_8routines_MUTUAL_INFORMATION,
-  __pyx_e_4nipy_9neurospin_8register_8routines_NORMALIZED_MUTUAL_INFORMATION,
-  __pyx_e_4nipy_9neurospin_8register_8routines_SUPERVISED_MUTUAL_INFORMATION,
-  __pyx_e_4nipy_9neurospin_8register_8routines_CUSTOM_SIMILARITY
-};
-
-/* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":394
- * 
- * # Enumerate transformation types
- * cdef enum transformation_type:             # <<<<<<<<<<<<<<
- *     RIGID2D=0, SIMILARITY2D=1, AFFINE2D=2,
- *     RIGID3D=3, SIMILARITY3D=4, AFFINE3D=5
- */
-
-enum __pyx_t_4nipy_9neurospin_8register_8routines_transformation_type {
-  __pyx_e_4nipy_9neurospin_8register_8routines_RIGID2D = 0,
-  __pyx_e_4nipy_9neurospin_8register_8routines_SIMILARITY2D = 1,
-  __pyx_e_4nipy_9neurospin_8register_8routines_AFFINE2D = 2,
-  __pyx_e_4nipy_9neurospin_8register_8routines_RIGID3D = 3,
-  __pyx_e_4nipy_9neurospin_8register_8routines_SIMILARITY3D = 4,
-  __pyx_e_4nipy_9neurospin_8register_8routines_AFFINE3D = 5
-};
-/* Module declarations from numpy */
-
-/* Module declarations from python_buffer */
-
-/* Module declarations from stdlib */
-
-/* Module declarations from numpy */
-
-/* Module declarations from numpy */
-
-static PyTypeObject *__pyx_ptype_5numpy_dtype = 0;
-static PyTypeObject *__pyx_ptype_5numpy_ndarray = 0;
-/* Module declarations from nipy.neurospin.register.routines */
-
-static PyTypeObject *__pyx_ptype_4nipy_9neurospin_8register_8routines_dtype = 0;
-static PyTypeObject *__pyx_ptype_4nipy_9neurospin_8register_8routines_ndarray = 0;
-static PyTypeObject *__pyx_ptype_4nipy_9neurospin_8register_8routines_flatiter = 0;
-static PyTypeObject *__pyx_ptype_4nipy_9neurospin_8register_8routines_broadcast = 0;
-static int __pyx_k_51;
-
-
-/* Implementation of nipy.neurospin.register.routines */
-static char __pyx_k_23[] = "0.2";
-static PyObject *__pyx_int_0;
-static PyObject *__pyx_int_1;
-static PyObject *__pyx_int_5;
-static PyObject *__pyx_int_6;
-static PyObject *__pyx_int_7;
-static PyObject *__pyx_int_11;
-static PyObject *__pyx_int_9;
-static PyObject *__pyx_int_12;
-static PyObject *__pyx_int_3;
-static PyObject *__pyx_int_2;
-static PyObject *__pyx_int_4;
-static char __pyx_k_im[] = "im";
-static PyObject *__pyx_kp_im;
-static char __pyx_k_H[] = "H";
-static PyObject *__pyx_kp_H;
-static char __pyx_k_Size[] = "Size";
-static PyObject *__pyx_kp_Size;
-static char __pyx_k_texture[] = "texture";
-static PyObject *__pyx_kp_texture;
-static char __pyx_k_method[] = "method";
-static PyObject *__pyx_kp_method;
-static char __pyx_k_iter[] = "iter";
-static PyObject *__pyx_kp_iter;
-static char __pyx_k_iterI[] = "iterI";
-static PyObject *__pyx_kp_iterI;
-static char __pyx_k_imJ[] = "imJ";
-static PyObject *__pyx_kp_imJ;
-static char __pyx_k_Tvox[] = "Tvox";
-static PyObject *__pyx_kp_Tvox;
-static char __pyx_k_interp[] = "interp";
-static PyObject *__pyx_kp_interp;
-static char __pyx_k_HI[] = "HI";
-static PyObject *__pyx_kp_HI;
-static char __pyx_k_HJ[] = "HJ";
-static PyObject *__pyx_kp_HJ;
-static char __pyx_k_simitype[] = "simitype";
-static PyObject *__pyx_kp_simitype;
-static char __pyx_k_F[] = "F";
-static PyObject *__pyx_kp_F;
-static char __pyx_k_x[] = "x";
-static PyObject *__pyx_kp_x;
-static char __pyx_k_R[] = "R";
-static PyObject *__pyx_kp_R;
-static char __pyx_k_C[] = "C";
-static PyObject *__pyx_kp_C;
-static char __pyx_k_X[] = "X";
-static PyObject *__pyx_kp_X;
-static char __pyx_k_Y[] = "Y";
-static PyObject *__pyx_kp_Y;
-static char __pyx_k_Z[] = "Z";
-static PyObject *__pyx_kp_Z;
-static char __pyx_k_T[] = "T";
-static PyObject *__pyx_kp_T;
-static char __pyx_k_dims[] = "dims";
-static PyObject *__pyx_kp_dims;
-static char __pyx_k_dtype[] = "dtype";
-static PyObject *__pyx_kp_dtype;
-static char __pyx_k_tr_slices[] = "tr_slices";
-static PyObject *__pyx_kp_tr_slices;
-static char __pyx_k_slice_order[] = "slice_order";
-static PyObject *__pyx_kp_slice_order;
-static char __pyx_k_r[] = "r";
-static PyObject *__pyx_kp_r;
-static char __pyx_k_param[] = "param";
-static PyObject *__pyx_kp_param;
-static char __pyx_k_t0[] = "t0";
-static PyObject *__pyx_kp_t0;
-static char __pyx_k_precond[] = "precond";
-static PyObject *__pyx_kp_precond;
-static char __pyx_k_stamp[] = "stamp";
-static PyObject *__pyx_kp_stamp;
-static char __pyx_k_t[] = "t";
-static PyObject *__pyx_kp_t;
-static char __pyx_k___version__[] = "__version__";
-static PyObject *__pyx_kp___version__;
-static char __pyx_k_numpy[] = "numpy";
-static PyObject *__pyx_kp_numpy;
-static char __pyx_k_np[] = "np";
-static PyObject *__pyx_kp_np;
-static char __pyx_k_24[] = "min";
-static PyObject *__pyx_kp_24;
-static char __pyx_k_25[] = "max";
-static PyObject *__pyx_kp_25;
-static char __pyx_k_26[] = "drange";
-static PyObject *__pyx_kp_26;
-static char __pyx_k_27[] = "mean";
-static PyObject *__pyx_kp_27;
-static char __pyx_k_28[] = "variance";
-static PyObject *__pyx_kp_28;
-static char __pyx_k_29[] = "median";
-static PyObject *__pyx_kp_29;
-static char __pyx_k_30[] = "l1dev";
-static PyObject *__pyx_kp_30;
-static char __pyx_k_31[] = "entropy";
-static PyObject *__pyx_kp_31;
-static char __pyx_k_32[] = "custom";
-static PyObject *__pyx_kp_32;
-static char __pyx_k_texture_measures[] = "texture_measures";
-static PyObject *__pyx_kp_texture_measures;
-static char __pyx_k_33[] = "cc";
-static PyObject *__pyx_kp_33;
-static char __pyx_k_34[] = "cr";
-static PyObject *__pyx_kp_34;
-static char __pyx_k_35[] = "crl1";
-static PyObject *__pyx_kp_35;
-static char __pyx_k_36[] = "mi";
-static PyObject *__pyx_kp_36;
-static char __pyx_k_37[] = "je";
-static PyObject *__pyx_kp_37;
-static char __pyx_k_38[] = "ce";
-static PyObject *__pyx_kp_38;
-static char __pyx_k_39[] = "nmi";
-static PyObject *__pyx_kp_39;
-static char __pyx_k_40[] = "smi";
-static PyObject *__pyx_kp_40;
-static char __pyx_k_41[] = "custom";
-static PyObject *__pyx_kp_41;
-static char __pyx_k_similarity_measures[] = "similarity_measures";
-static PyObject *__pyx_kp_similarity_measures;
-static char __pyx_k_42[] = "rigid";
-static PyObject *__pyx_kp_42;
-static char __pyx_k_43[] = "similarity";
-static PyObject *__pyx_kp_43;
-static char __pyx_k_44[] = "affine";
-static PyObject *__pyx_kp_44;
-static char __pyx_k_affines[] = "affines";
-static PyObject *__pyx_kp_affines;
-static char __pyx_k_45[] = "_rigid2d";
-static PyObject *__pyx_kp_45;
-static char __pyx_k_46[] = "_similarity2d";
-static PyObject *__pyx_kp_46;
-static char __pyx_k_47[] = "_affine2d";
-static PyObject *__pyx_kp_47;
-static char __pyx_k_range[] = "range";
-static PyObject *__pyx_kp_range;
-static char __pyx_k_48[] = "_rigid3d";
-static PyObject *__pyx_kp_48;
-static char __pyx_k_49[] = "_similarity3d";
-static PyObject *__pyx_kp_49;
-static char __pyx_k_50[] = "_affine3d";
-static PyObject *__pyx_kp_50;
-static char __pyx_k__affines[] = "_affines";
-static PyObject *__pyx_kp__affines;
-static char __pyx_k_zeros[] = "zeros";
-static PyObject *__pyx_kp_zeros;
-static char __pyx_k_shape[] = "shape";
-static PyObject *__pyx_kp_shape;
-static char __pyx_k_52[] = "double";
-static PyObject *__pyx_kp_52;
-static char __pyx_k_reshape[] = "reshape";
-static PyObject *__pyx_kp_reshape;
-static char __pyx_k_astype[] = "astype";
-static PyObject *__pyx_kp_astype;
-static char __pyx_k_53[] = "double";
-static PyObject *__pyx_kp_53;
-static char __pyx_k_54[] = "double";
-static PyObject *__pyx_kp_54;
-static char __pyx_k_55[] = "double";
-static PyObject *__pyx_kp_55;
-static char __pyx_k_56[] = "double";
-static PyObject *__pyx_kp_56;
-static char __pyx_k_57[] = "double";
-static PyObject *__pyx_kp_57;
-static char __pyx_k_58[] = "double";
-static PyObject *__pyx_kp_58;
-static char __pyx_k_59[] = "double";
-static PyObject *__pyx_kp_59;
-static char __pyx_k_60[] = "double";
-static PyObject *__pyx_kp_60;
-static char __pyx_k_61[] = "double";
-static PyObject *__pyx_kp_61;
-static char __pyx_k_62[] = "double";
-static PyObject *__pyx_kp_62;
-static char __pyx_k_asarray[] = "asarray";
-static PyObject *__pyx_kp_asarray;
-static char __pyx_k_order[] = "order";
-static PyObject *__pyx_kp_order;
-static char __pyx_k_63[] = "C";
-static PyObject *__pyx_kp_63;
-static char __pyx_k_issubdtype[] = "issubdtype";
-static PyObject *__pyx_kp_issubdtype;
-static char __pyx_k_64[] = "double";
-static PyObject *__pyx_kp_64;
-static char __pyx_k_65[] = "double";
-static PyObject *__pyx_kp_65;
-static char __pyx_k_ascontiguousarray[] = "ascontiguousarray";
-static PyObject *__pyx_kp_ascontiguousarray;
-static char __pyx_k_66[] = "double";
-static PyObject *__pyx_kp_66;
-static char __pyx_k_size[] = "size";
-static PyObject *__pyx_kp_size;
-static char __pyx_k_linalg[] = "linalg";
-static PyObject *__pyx_kp_linalg;
-static char __pyx_k_norm[] = "norm";
-static PyObject *__pyx_kp_norm;
-static char __pyx_k_array[] = "array";
-static PyObject *__pyx_kp_array;
-static char __pyx_k_eye[] = "eye";
-static PyObject *__pyx_kp_eye;
-static char __pyx_k_sin[] = "sin";
-static PyObject *__pyx_kp_sin;
-static char __pyx_k_cos[] = "cos";
-static PyObject *__pyx_kp_cos;
-static char __pyx_k_dot[] = "dot";
-static PyObject *__pyx_kp_dot;
-static char __pyx_k_67[] = "rotation_vec2mat";
-static PyObject *__pyx_kp_67;
-static char __pyx_k_diag[] = "diag";
-static PyObject *__pyx_kp_diag;
-static PyObject *__pyx_kp_23;
-static PyObject *__pyx_builtin_range;
-static char __pyx_k___getbuffer__[] = "__getbuffer__";
-static PyObject *__pyx_kp___getbuffer__;
-static char __pyx_k___releasebuffer__[] = "__releasebuffer__";
-static PyObject *__pyx_kp___releasebuffer__;
-static char __pyx_k_info[] = "info";
-static PyObject *__pyx_kp_info;
-static char __pyx_k_flags[] = "flags";
-static PyObject *__pyx_kp_flags;
-static char __pyx_k_ValueError[] = "ValueError";
-static PyObject *__pyx_kp_ValueError;
-static char __pyx_k_iteritems[] = "iteritems";
-static PyObject *__pyx_kp_iteritems;
-static char __pyx_k_next[] = "next";
-static PyObject *__pyx_kp_next;
-static char __pyx_k_StopIteration[] = "StopIteration";
-static PyObject *__pyx_kp_StopIteration;
-static char __pyx_k_pop[] = "pop";
-static PyObject *__pyx_kp_pop;
-static char __pyx_k_RuntimeError[] = "RuntimeError";
-static PyObject *__pyx_kp_RuntimeError;
-static PyObject *__pyx_kp_1;
-static PyObject *__pyx_kp_2;
-static PyObject *__pyx_kp_20;
-static PyObject *__pyx_kp_21;
-static PyObject *__pyx_kp_22;
-static PyObject *__pyx_builtin_ValueError;
-static PyObject *__pyx_builtin_StopIteration;
-static PyObject *__pyx_builtin_RuntimeError;
-static char __pyx_k_1[] = "ndarray is not C contiguous";
-static char __pyx_k_2[] = "ndarray is not Fortran contiguous";
-static char __pyx_k_3[] = "b";
-static char __pyx_k_4[] = "B";
-static char __pyx_k_5[] = "h";
-static char __pyx_k_6[] = "H";
-static char __pyx_k_7[] = "i";
-static char __pyx_k_8[] = "I";
-static char __pyx_k_9[] = "l";
-static char __pyx_k_10[] = "L";
-static char __pyx_k_11[] = "q";
-static char __pyx_k_12[] = "Q";
-static char __pyx_k_13[] = "f";
-static char __pyx_k_14[] = "d";
-static char __pyx_k_15[] = "g";
-static char __pyx_k_16[] = "Zf";
-static char __pyx_k_17[] = "Zd";
-static char __pyx_k_18[] = "Zg";
-static char __pyx_k_19[] = "O";
-static char __pyx_k_20[] = "unknown dtype code in numpy.pxd (%d)";
-static char __pyx_k_21[] = "Format string allocated too short.";
-static char __pyx_k_22[] = "unknown dtype code in numpy.pxd (%d)";
-
-/* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":116
- * 
- * 
- * def _texture(ndarray im, ndarray H, Size, int texture, method=None):             # <<<<<<<<<<<<<<
- * 
- *     cdef double *res, *h
- */
-
-static PyObject *__pyx_pf_4nipy_9neurospin_8register_8routines__texture(PyObject *__pyx_self, PyObject *__pyx_args, PyObject *__pyx_kwds); /*proto*/
-static PyObject *__pyx_pf_4nipy_9neurospin_8register_8routines__texture(PyObject *__pyx_self, PyObject *__pyx_args, PyObject *__pyx_kwds) {
-  PyArrayObject *__pyx_v_im = 0;
-  PyArrayObject *__pyx_v_H = 0;
-  PyObject *__pyx_v_Size = 0;
-  int __pyx_v_texture;
-  PyObject *__pyx_v_method = 0;
-  double *__pyx_v_res;
-  double *__pyx_v_h;
-  double __pyx_v_moments[5];
-  unsigned int __pyx_v_clamp;
-  unsigned int __pyx_v_size[3];
-  PyArrayMultiIterObject *__pyx_v_multi;
-  PyArrayIterObject *__pyx_v_im_iter;
-  PyObject *__pyx_v_imtext;
-  PyObject *__pyx_r;
-  PyObject *__pyx_1 = 0;
-  unsigned int __pyx_2;
-  PyObject *__pyx_3 = 0;
-  PyObject *__pyx_4 = 0;
-  PyObject *__pyx_5 = 0;
-  int __pyx_6;
-  void *__pyx_7;
-  double __pyx_8;
-  static PyObject **__pyx_pyargnames[] = {&__pyx_kp_im,&__pyx_kp_H,&__pyx_kp_Size,&__pyx_kp_texture,&__pyx_kp_method,0};
-  __pyx_self = __pyx_self;
-  __pyx_v_method = Py_None;
-  if (unlikely(__pyx_kwds)) {
-    PyObject* values[5] = {0,0,0,0,0};
-    Py_ssize_t kw_args = PyDict_Size(__pyx_kwds);
-    switch (PyTuple_GET_SIZE(__pyx_args)) {
-      case  5: values[4] = PyTuple_GET_ITEM(__pyx_args, 4);
-      case  4: values[3] = PyTuple_GET_ITEM(__pyx_args, 3);
-      case  3: values[2] = PyTuple_GET_ITEM(__pyx_args, 2);
-      case  2: values[1] = PyTuple_GET_ITEM(__pyx_args, 1);
-      case  1: values[0] = PyTuple_GET_ITEM(__pyx_args, 0);
-      case  0: break;
-      default: goto __pyx_L5_argtuple_error;
-    }
-    switch (PyTuple_GET_SIZE(__pyx_args)) {
-      case  0:
-      values[0] = PyDict_GetItem(__pyx_kwds, __pyx_kp_im);
-      if (likely(values[0])) kw_args--;
-      else goto __pyx_L5_argtuple_error;
-      case  1:
-      values[1] = PyDict_GetItem(__pyx_kwds, __pyx_kp_H);
-      if (likely(values[1])) kw_args--;
-      else {
-        __Pyx_RaiseArgtupleInvalid("_texture", 0, 4, 5, 1); {__pyx_filename = __pyx_f[0]; __pyx_lineno = 116; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-      }
-      case  2:
-      values[2] = PyDict_GetItem(__pyx_kwds, __pyx_kp_Size);
-      if (likely(values[2])) kw_args--;
-      else {
-        __Pyx_RaiseArgtupleInvalid("_texture", 0, 4, 5, 2); {__pyx_filename = __pyx_f[0]; __pyx_lineno = 116; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-      }
-      case  3:
-      values[3] = PyDict_GetItem(__pyx_kwds, __pyx_kp_texture);
-      if (likely(values[3])) kw_args--;
-      else {
-        __Pyx_RaiseArgtupleInvalid("_texture", 0, 4, 5, 3); {__pyx_filename = __pyx_f[0]; __pyx_lineno = 116; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-      }
-    }
-    if (unlikely(kw_args > 0)) {
-      if (unlikely(__Pyx_ParseOptionalKeywords(__pyx_kwds, __pyx_pyargnames, 0, values, PyTuple_GET_SIZE(__pyx_args), "_texture") < 0)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 116; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-    }
-    __pyx_v_im = ((PyArrayObject *)values[0]);
-    __pyx_v_H = ((PyArrayObject *)values[1]);
-    __pyx_v_Size = values[2];
-    __pyx_v_texture = __pyx_PyInt_int(values[3]); if (unlikely((__pyx_v_texture == (int)-1) && PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 116; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-    if (values[4]) {
-      __pyx_v_method = values[4];
-    }
-  } else {
-    switch (PyTuple_GET_SIZE(__pyx_args)) {
-      case  5:
-      __pyx_v_method = PyTuple_GET_ITEM(__pyx_args, 4);
-      case  4:
-      __pyx_v_texture = __pyx_PyInt_int(PyTuple_GET_ITEM(__pyx_args, 3)); if (unlikely((__pyx_v_texture == (int)-1) && PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 116; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-      __pyx_v_Size = PyTuple_GET_ITEM(__pyx_args, 2);
-      __pyx_v_H = ((PyArrayObject *)PyTuple_GET_ITEM(__pyx_args, 1));
-      __pyx_v_im = ((PyArrayObject *)PyTuple_GET_ITEM(__pyx_args, 0));
-      break;
-      default: goto __pyx_L5_argtuple_error;
-    }
-  }
-  goto __pyx_L4_argument_unpacking_done;
-  __pyx_L5_argtuple_error:;
-  __Pyx_RaiseArgtupleInvalid("_texture", 0, 4, 5, PyTuple_GET_SIZE(__pyx_args)); {__pyx_filename = __pyx_f[0]; __pyx_lineno = 116; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-  __pyx_L3_error:;
-  __Pyx_AddTraceback("nipy.neurospin.register.routines._texture");
-  return NULL;
-  __pyx_L4_argument_unpacking_done:;
-  __pyx_v_multi = ((PyArrayMultiIterObject *)Py_None); Py_INCREF(Py_None);
-  __pyx_v_im_iter = ((PyArrayIterObject *)Py_None); Py_INCREF(Py_None);
-  __pyx_v_imtext = Py_None; Py_INCREF(Py_None);
-  if (unlikely(!__Pyx_ArgTypeTest(((PyObject *)__pyx_v_im), __pyx_ptype_4nipy_9neurospin_8register_8routines_ndarray, 1, "im", 0))) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 116; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  if (unlikely(!__Pyx_ArgTypeTest(((PyObject *)__pyx_v_H), __pyx_ptype_4nipy_9neurospin_8register_8routines_ndarray, 1, "H", 0))) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 116; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-
-  /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":126
- * 
- *     # Views
- *     clamp = <unsigned int>H.dimensions[0]             # <<<<<<<<<<<<<<
- *     h = <double*>H.data
- * 
- */
-  __pyx_v_clamp = ((unsigned int)(__pyx_v_H->dimensions[0]));
-
-  /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":127
- *     # Views
- *     clamp = <unsigned int>H.dimensions[0]
- *     h = <double*>H.data             # <<<<<<<<<<<<<<
- * 
- *     # Copy size parameters
- */
-  __pyx_v_h = ((double *)__pyx_v_H->data);
-
-  /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":130
- * 
- *     # Copy size parameters
- *     size[0] = <unsigned int>Size[0]             # <<<<<<<<<<<<<<
- *     size[1] = <unsigned int>Size[1]
- *     size[2] = <unsigned int>Size[2]
- */
-  __pyx_1 = __Pyx_GetItemInt(__pyx_v_Size, 0, 0); if (!__pyx_1) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 130; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __pyx_2 = PyInt_AsUnsignedLongMask(__pyx_1); if (unlikely((__pyx_2 == (unsigned int)-1) && PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 130; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_DECREF(__pyx_1); __pyx_1 = 0;
-  (__pyx_v_size[0]) = ((unsigned int)__pyx_2);
-
-  /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":131
- *     # Copy size parameters
- *     size[0] = <unsigned int>Size[0]
- *     size[1] = <unsigned int>Size[1]             # <<<<<<<<<<<<<<
- *     size[2] = <unsigned int>Size[2]
- * 
- */
-  __pyx_1 = __Pyx_GetItemInt(__pyx_v_Size, 1, 0); if (!__pyx_1) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 131; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __pyx_2 = PyInt_AsUnsignedLongMask(__pyx_1); if (unlikely((__pyx_2 == (unsigned int)-1) && PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 131; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_DECREF(__pyx_1); __pyx_1 = 0;
-  (__pyx_v_size[1]) = ((unsigned int)__pyx_2);
-
-  /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":132
- *     size[0] = <unsigned int>Size[0]
- *     size[1] = <unsigned int>Size[1]
- *     size[2] = <unsigned int>Size[2]             # <<<<<<<<<<<<<<
- * 
- *     # Allocate output
- */
-  __pyx_1 = __Pyx_GetItemInt(__pyx_v_Size, 2, 0); if (!__pyx_1) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 132; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __pyx_2 = PyInt_AsUnsignedLongMask(__pyx_1); if (unlikely((__pyx_2 == (unsigned int)-1) && PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 132; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_DECREF(__pyx_1); __pyx_1 = 0;
-  (__pyx_v_size[2]) = ((unsigned int)__pyx_2);
-
-  /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":135
- * 
- *     # Allocate output
- *     imtext = np.zeros(im.shape, dtype='double')             # <<<<<<<<<<<<<<
- * 
- *     # Loop over input and output images
- */
-  __pyx_1 = __Pyx_GetName(__pyx_m, __pyx_kp_np); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 135; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __pyx_3 = PyObject_GetAttr(__pyx_1, __pyx_kp_zeros); if (unlikely(!__pyx_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 135; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_DECREF(__pyx_1); __pyx_1 = 0;
-  __pyx_1 = PyObject_GetAttr(((PyObject *)__pyx_v_im), __pyx_kp_shape); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 135; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __pyx_4 = PyTuple_New(1); if (unlikely(!__pyx_4)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 135; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  PyTuple_SET_ITEM(__pyx_4, 0, __pyx_1);
-  __pyx_1 = 0;
-  __pyx_1 = PyDict_New(); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 135; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  if (PyDict_SetItem(__pyx_1, __pyx_kp_dtype, __pyx_kp_52) < 0) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 135; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __pyx_5 = PyEval_CallObjectWithKeywords(__pyx_3, ((PyObject *)__pyx_4), ((PyObject *)__pyx_1)); if (unlikely(!__pyx_5)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 135; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_DECREF(__pyx_3); __pyx_3 = 0;
-  Py_DECREF(((PyObject *)__pyx_4)); __pyx_4 = 0;
-  Py_DECREF(((PyObject *)__pyx_1)); __pyx_1 = 0;
-  Py_DECREF(__pyx_v_imtext);
-  __pyx_v_imtext = __pyx_5;
-  __pyx_5 = 0;
-
-  /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":138
- * 
- *     # Loop over input and output images
- *     multi = PyArray_MultiIterNew(2, <void*>imtext, <void*>im)             # <<<<<<<<<<<<<<
- *     while(multi.index < multi.size):
- *         res = <double*>PyArray_MultiIter_DATA(multi, 0)
- */
-  __pyx_3 = PyArray_MultiIterNew(2, ((void *)__pyx_v_imtext), ((void *)__pyx_v_im)); if (unlikely(!__pyx_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 138; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  if (!(__Pyx_TypeTest(__pyx_3, __pyx_ptype_4nipy_9neurospin_8register_8routines_broadcast))) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 138; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_DECREF(((PyObject *)__pyx_v_multi));
-  __pyx_v_multi = ((PyArrayMultiIterObject *)__pyx_3);
-  __pyx_3 = 0;
-
-  /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":139
- *     # Loop over input and output images
- *     multi = PyArray_MultiIterNew(2, <void*>imtext, <void*>im)
- *     while(multi.index < multi.size):             # <<<<<<<<<<<<<<
- *         res = <double*>PyArray_MultiIter_DATA(multi, 0)
- *         im_iter = <flatiter>multi.iters[1]
- */
-  while (1) {
-    __pyx_6 = (__pyx_v_multi->index < __pyx_v_multi->size);
-    if (!__pyx_6) break;
-
-    /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":140
- *     multi = PyArray_MultiIterNew(2, <void*>imtext, <void*>im)
- *     while(multi.index < multi.size):
- *         res = <double*>PyArray_MultiIter_DATA(multi, 0)             # <<<<<<<<<<<<<<
- *         im_iter = <flatiter>multi.iters[1]
- *         # Compute local image histogram
- */
-    __pyx_v_res = ((double *)PyArray_MultiIter_DATA(__pyx_v_multi, 0));
-
-    /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":141
- *     while(multi.index < multi.size):
- *         res = <double*>PyArray_MultiIter_DATA(multi, 0)
- *         im_iter = <flatiter>multi.iters[1]             # <<<<<<<<<<<<<<
- *         # Compute local image histogram
- *         local_histogram(h, clamp, im_iter, size)
- */
-    __pyx_7 = (__pyx_v_multi->iters[1]);
-    Py_INCREF(((PyObject *)((PyArrayIterObject *)__pyx_7)));
-    Py_DECREF(((PyObject *)__pyx_v_im_iter));
-    __pyx_v_im_iter = ((PyArrayIterObject *)__pyx_7);
-
-    /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":143
- *         im_iter = <flatiter>multi.iters[1]
- *         # Compute local image histogram
- *         local_histogram(h, clamp, im_iter, size)             # <<<<<<<<<<<<<<
- *         # Switch
- *         if texture == MIN:
- */
-    local_histogram(__pyx_v_h, __pyx_v_clamp, __pyx_v_im_iter, __pyx_v_size);
-
-    /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":145
- *         local_histogram(h, clamp, im_iter, size)
- *         # Switch
- *         if texture == MIN:             # <<<<<<<<<<<<<<
- *             drange(h, clamp, moments)
- *             res[0] = moments[0]
- */
-    __pyx_6 = (__pyx_v_texture == __pyx_e_4nipy_9neurospin_8register_8routines_MIN);
-    if (__pyx_6) {
-
-      /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":146
- *         # Switch
- *         if texture == MIN:
- *             drange(h, clamp, moments)             # <<<<<<<<<<<<<<
- *             res[0] = moments[0]
- *         elif texture == MAX:
- */
-      drange(__pyx_v_h, __pyx_v_clamp, __pyx_v_moments);
-
-      /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":147
- *         if texture == MIN:
- *             drange(h, clamp, moments)
- *             res[0] = moments[0]             # <<<<<<<<<<<<<<
- *         elif texture == MAX:
- *             drange(h, clamp, moments)
- */
-      (__pyx_v_res[0]) = (__pyx_v_moments[0]);
-      goto __pyx_L8;
-    }
-
-    /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":148
- *             drange(h, clamp, moments)
- *             res[0] = moments[0]
- *         elif texture == MAX:             # <<<<<<<<<<<<<<
- *             drange(h, clamp, moments)
- *             res[0] = moments[1]
- */
-    __pyx_6 = (__pyx_v_texture == __pyx_e_4nipy_9neurospin_8register_8routines_MAX);
-    if (__pyx_6) {
-
-      /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":149
- *             res[0] = moments[0]
- *         elif texture == MAX:
- *             drange(h, clamp, moments)             # <<<<<<<<<<<<<<
- *             res[0] = moments[1]
- *         elif texture == DRANGE:
- */
-      drange(__pyx_v_h, __pyx_v_clamp, __pyx_v_moments);
-
-      /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":150
- *         elif texture == MAX:
- *             drange(h, clamp, moments)
- *             res[0] = moments[1]             # <<<<<<<<<<<<<<
- *         elif texture == DRANGE:
- *             drange(h, clamp, moments)
- */
-      (__pyx_v_res[0]) = (__pyx_v_moments[1]);
-      goto __pyx_L8;
-    }
-
-    /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":151
- *             drange(h, clamp, moments)
- *             res[0] = moments[1]
- *         elif texture == DRANGE:             # <<<<<<<<<<<<<<
- *             drange(h, clamp, moments)
- *             res[0] = moments[1]-moments[0]
- */
-    __pyx_6 = (__pyx_v_texture == __pyx_e_4nipy_9neurospin_8register_8routines_DRANGE);
-    if (__pyx_6) {
-
-      /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":152
- *             res[0] = moments[1]
- *         elif texture == DRANGE:
- *             drange(h, clamp, moments)             # <<<<<<<<<<<<<<
- *             res[0] = moments[1]-moments[0]
- *         elif texture == MEAN:
- */
-      drange(__pyx_v_h, __pyx_v_clamp, __pyx_v_moments);
-
-      /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":153
- *         elif texture == DRANGE:
- *             drange(h, clamp, moments)
- *             res[0] = moments[1]-moments[0]             # <<<<<<<<<<<<<<
- *         elif texture == MEAN:
- *             L2_moments(h, clamp, moments)
- */
-      (__pyx_v_res[0]) = ((__pyx_v_moments[1]) - (__pyx_v_moments[0]));
-      goto __pyx_L8;
-    }
-
-    /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":154
- *             drange(h, clamp, moments)
- *             res[0] = moments[1]-moments[0]
- *         elif texture == MEAN:             # <<<<<<<<<<<<<<
- *             L2_moments(h, clamp, moments)
- *             res[0] = moments[1]
- */
-    __pyx_6 = (__pyx_v_texture == __pyx_e_4nipy_9neurospin_8register_8routines_MEAN);
-    if (__pyx_6) {
-
-      /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":155
- *             res[0] = moments[1]-moments[0]
- *         elif texture == MEAN:
- *             L2_moments(h, clamp, moments)             # <<<<<<<<<<<<<<
- *             res[0] = moments[1]
- *         elif texture == MEAN:
- */
-      L2_moments(__pyx_v_h, __pyx_v_clamp, __pyx_v_moments);
-
-      /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":156
- *         elif texture == MEAN:
- *             L2_moments(h, clamp, moments)
- *             res[0] = moments[1]             # <<<<<<<<<<<<<<
- *         elif texture == MEAN:
- *             L2_moments(h, clamp, moments)
- */
-      (__pyx_v_res[0]) = (__pyx_v_moments[1]);
-      goto __pyx_L8;
-    }
-
-    /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":157
- *             L2_moments(h, clamp, moments)
- *             res[0] = moments[1]
- *         elif texture == MEAN:             # <<<<<<<<<<<<<<
- *             L2_moments(h, clamp, moments)
- *             res[0] = moments[2]
- */
-    __pyx_6 = (__pyx_v_texture == __pyx_e_4nipy_9neurospin_8register_8routines_MEAN);
-    if (__pyx_6) {
-
-      /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":158
- *             res[0] = moments[1]
- *         elif texture == MEAN:
- *             L2_moments(h, clamp, moments)             # <<<<<<<<<<<<<<
- *             res[0] = moments[2]
- *         elif texture == MEDIAN:
- */
-      L2_moments(__pyx_v_h, __pyx_v_clamp, __pyx_v_moments);
-
-      /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":159
- *         elif texture == MEAN:
- *             L2_moments(h, clamp, moments)
- *             res[0] = moments[2]             # <<<<<<<<<<<<<<
- *         elif texture == MEDIAN:
- *             L1_moments(h, clamp, moments)
- */
-      (__pyx_v_res[0]) = (__pyx_v_moments[2]);
-      goto __pyx_L8;
-    }
-
-    /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":160
- *             L2_moments(h, clamp, moments)
- *             res[0] = moments[2]
- *         elif texture == MEDIAN:             # <<<<<<<<<<<<<<
- *             L1_moments(h, clamp, moments)
- *             res[0] = moments[1]
- */
-    __pyx_6 = (__pyx_v_texture == __pyx_e_4nipy_9neurospin_8register_8routines_MEDIAN);
-    if (__pyx_6) {
-
-      /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":161
- *             res[0] = moments[2]
- *         elif texture == MEDIAN:
- *             L1_moments(h, clamp, moments)             # <<<<<<<<<<<<<<
- *             res[0] = moments[1]
- *         elif texture == L1DEV:
- */
-      L1_moments(__pyx_v_h, __pyx_v_clamp, __pyx_v_moments);
-
-      /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":162
- *         elif texture == MEDIAN:
- *             L1_moments(h, clamp, moments)
- *             res[0] = moments[1]             # <<<<<<<<<<<<<<
- *         elif texture == L1DEV:
- *             L1_moments(h, clamp, moments)
- */
-      (__pyx_v_res[0]) = (__pyx_v_moments[1]);
-      goto __pyx_L8;
-    }
-
-    /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":163
- *             L1_moments(h, clamp, moments)
- *             res[0] = moments[1]
- *         elif texture == L1DEV:             # <<<<<<<<<<<<<<
- *             L1_moments(h, clamp, moments)
- *             res[0] = moments[2]
- */
-    __pyx_6 = (__pyx_v_texture == __pyx_e_4nipy_9neurospin_8register_8routines_L1DEV);
-    if (__pyx_6) {
-
-      /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":164
- *             res[0] = moments[1]
- *         elif texture == L1DEV:
- *             L1_moments(h, clamp, moments)             # <<<<<<<<<<<<<<
- *             res[0] = moments[2]
- *         elif texture == ENTROPY:
- */
-      L1_moments(__pyx_v_h, __pyx_v_clamp, __pyx_v_moments);
-
-      /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":165
- *         elif texture == L1DEV:
- *             L1_moments(h, clamp, moments)
- *             res[0] = moments[2]             # <<<<<<<<<<<<<<
- *         elif texture == ENTROPY:
- *             res[0] = entropy(h, clamp, moments)
- */
-      (__pyx_v_res[0]) = (__pyx_v_moments[2]);
-      goto __pyx_L8;
-    }
-
-    /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":166
- *             L1_moments(h, clamp, moments)
- *             res[0] = moments[2]
- *         elif texture == ENTROPY:             # <<<<<<<<<<<<<<
- *             res[0] = entropy(h, clamp, moments)
- *         else: # CUSTOM
- */
-    __pyx_6 = (__pyx_v_texture == __pyx_e_4nipy_9neurospin_8register_8routines_ENTROPY);
-    if (__pyx_6) {
-
-      /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":167
- *             res[0] = moments[2]
- *         elif texture == ENTROPY:
- *             res[0] = entropy(h, clamp, moments)             # <<<<<<<<<<<<<<
- *         else: # CUSTOM
- *             res[0] = method(H)
- */
-      (__pyx_v_res[0]) = entropy(__pyx_v_h, __pyx_v_clamp, __pyx_v_moments);
-      goto __pyx_L8;
-    }
-    /*else*/ {
-
-      /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":169
- *             res[0] = entropy(h, clamp, moments)
- *         else: # CUSTOM
- *             res[0] = method(H)             # <<<<<<<<<<<<<<
- *         # Next voxel please
- *         PyArray_MultiIter_NEXT(multi)
- */
-      __pyx_4 = PyTuple_New(1); if (unlikely(!__pyx_4)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 169; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-      Py_INCREF(((PyObject *)__pyx_v_H));
-      PyTuple_SET_ITEM(__pyx_4, 0, ((PyObject *)__pyx_v_H));
-      __pyx_1 = PyObject_Call(__pyx_v_method, ((PyObject *)__pyx_4), NULL); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 169; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-      Py_DECREF(((PyObject *)__pyx_4)); __pyx_4 = 0;
-      __pyx_8 = __pyx_PyFloat_AsDouble(__pyx_1); if (unlikely(PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 169; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-      Py_DECREF(__pyx_1); __pyx_1 = 0;
-      (__pyx_v_res[0]) = __pyx_8;
-    }
-    __pyx_L8:;
-
-    /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":171
- *             res[0] = method(H)
- *         # Next voxel please
- *         PyArray_MultiIter_NEXT(multi)             # <<<<<<<<<<<<<<
- * 
- *     return imtext
- */
-    PyArray_MultiIter_NEXT(__pyx_v_multi);
-  }
-
-  /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":173
- *         PyArray_MultiIter_NEXT(multi)
- * 
- *     return imtext             # <<<<<<<<<<<<<<
- * 
- * 
- */
-  Py_INCREF(__pyx_v_imtext);
-  __pyx_r = __pyx_v_imtext;
-  goto __pyx_L0;
-
-  __pyx_r = Py_None; Py_INCREF(Py_None);
-  goto __pyx_L0;
-  __pyx_L1_error:;
-  Py_XDECREF(__pyx_1);
-  Py_XDECREF(__pyx_3);
-  Py_XDECREF(__pyx_4);
-  Py_XDECREF(__pyx_5);
-  __Pyx_AddTraceback("nipy.neurospin.register.routines._texture");
-  __pyx_r = NULL;
-  __pyx_L0:;
-  Py_DECREF(__pyx_v_multi);
-  Py_DECREF(__pyx_v_im_iter);
-  Py_DECREF(__pyx_v_imtext);
-  return __pyx_r;
-}
-
-/* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":176
- * 
- * 
- * def _histogram(ndarray H, flatiter iter):             # <<<<<<<<<<<<<<
- *     """
- *     _joint_histogram(H, iterI)
- */
-
-static PyObject *__pyx_pf_4nipy_9neurospin_8register_8routines__histogram(PyObject *__pyx_self, PyObject *__pyx_args, PyObject *__pyx_kwds); /*proto*/
-static char __pyx_doc_4nipy_9neurospin_8register_8routines__histogram[] = "\n    _joint_histogram(H, iterI)\n    Comments to follow.\n    ";
-static PyObject *__pyx_pf_4nipy_9neurospin_8register_8routines__histogram(PyObject *__pyx_self, PyObject *__pyx_args, PyObject *__pyx_kwds) {
-  PyArrayObject *__pyx_v_H = 0;
-  PyArrayIterObject *__pyx_v_iter = 0;
-  double *__pyx_v_h;
-  unsigned int __pyx_v_clamp;
-  PyObject *__pyx_r;
-  static PyObject **__pyx_pyargnames[] = {&__pyx_kp_H,&__pyx_kp_iter,0};
-  __pyx_self = __pyx_self;
-  if (unlikely(__pyx_kwds)) {
-    PyObject* values[2] = {0,0};
-    Py_ssize_t kw_args = PyDict_Size(__pyx_kwds);
-    switch (PyTuple_GET_SIZE(__pyx_args)) {
-      case  2: values[1] = PyTuple_GET_ITEM(__pyx_args, 1);
-      case  1: values[0] = PyTuple_GET_ITEM(__pyx_args, 0);
-      case  0: break;
-      default: goto __pyx_L5_argtuple_error;
-    }
-    switch (PyTuple_GET_SIZE(__pyx_args)) {
-      case  0:
-      values[0] = PyDict_GetItem(__pyx_kwds, __pyx_kp_H);
-      if (likely(values[0])) kw_args--;
-      else goto __pyx_L5_argtuple_error;
-      case  1:
-      values[1] = PyDict_GetItem(__pyx_kwds, __pyx_kp_iter);
-      if (likely(values[1])) kw_args--;
-      else {
-        __Pyx_RaiseArgtupleInvalid("_histogram", 1, 2, 2, 1); {__pyx_filename = __pyx_f[0]; __pyx_lineno = 176; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-      }
-    }
-    if (unlikely(kw_args > 0)) {
-      if (unlikely(__Pyx_ParseOptionalKeywords(__pyx_kwds, __pyx_pyargnames, 0, values, PyTuple_GET_SIZE(__pyx_args), "_histogram") < 0)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 176; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-    }
-    __pyx_v_H = ((PyArrayObject *)values[0]);
-    __pyx_v_iter = ((PyArrayIterObject *)values[1]);
-  } else if (PyTuple_GET_SIZE(__pyx_args) != 2) {
-    goto __pyx_L5_argtuple_error;
-  } else {
-    __pyx_v_H = ((PyArrayObject *)PyTuple_GET_ITEM(__pyx_args, 0));
-    __pyx_v_iter = ((PyArrayIterObject *)PyTuple_GET_ITEM(__pyx_args, 1));
-  }
-  goto __pyx_L4_argument_unpacking_done;
-  __pyx_L5_argtuple_error:;
-  __Pyx_RaiseArgtupleInvalid("_histogram", 1, 2, 2, PyTuple_GET_SIZE(__pyx_args)); {__pyx_filename = __pyx_f[0]; __pyx_lineno = 176; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-  __pyx_L3_error:;
-  __Pyx_AddTraceback("nipy.neurospin.register.routines._histogram");
-  return NULL;
-  __pyx_L4_argument_unpacking_done:;
-  if (unlikely(!__Pyx_ArgTypeTest(((PyObject *)__pyx_v_H), __pyx_ptype_4nipy_9neurospin_8register_8routines_ndarray, 1, "H", 0))) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 176; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  if (unlikely(!__Pyx_ArgTypeTest(((PyObject *)__pyx_v_iter), __pyx_ptype_4nipy_9neurospin_8register_8routines_flatiter, 1, "iter", 0))) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 176; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-
-  /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":185
- * 
- *     # Views
- *     clamp = <unsigned int>H.dimensions[0]             # <<<<<<<<<<<<<<
- *     h = <double*>H.data
- * 
- */
-  __pyx_v_clamp = ((unsigned int)(__pyx_v_H->dimensions[0]));
-
-  /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":186
- *     # Views
- *     clamp = <unsigned int>H.dimensions[0]
- *     h = <double*>H.data             # <<<<<<<<<<<<<<
- * 
- *     # Compute image histogram
- */
-  __pyx_v_h = ((double *)__pyx_v_H->data);
-
-  /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":189
- * 
- *     # Compute image histogram
- *     histogram(h, clamp, iter)             # <<<<<<<<<<<<<<
- * 
- *     return
- */
-  histogram(__pyx_v_h, __pyx_v_clamp, __pyx_v_iter);
-
-  /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":191
- *     histogram(h, clamp, iter)
- * 
- *     return             # <<<<<<<<<<<<<<
- * 
- * 
- */
-  __pyx_r = Py_None; Py_INCREF(Py_None);
-  goto __pyx_L0;
-
-  __pyx_r = Py_None; Py_INCREF(Py_None);
-  goto __pyx_L0;
-  __pyx_L1_error:;
-  __Pyx_AddTraceback("nipy.neurospin.register.routines._histogram");
-  __pyx_r = NULL;
-  __pyx_L0:;
-  return __pyx_r;
-}
-
-/* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":194
- * 
- * 
- * def _joint_histogram(ndarray H, flatiter iterI, ndarray imJ, ndarray Tvox, int interp):             # <<<<<<<<<<<<<<
- *     """
- *     _joint_histogram(H, iterI, imJ, Tvox, interp)
- */
-
-static PyObject *__pyx_pf_4nipy_9neurospin_8register_8routines__joint_histogram(PyObject *__pyx_self, PyObject *__pyx_args, PyObject *__pyx_kwds); /*proto*/
-static char __pyx_doc_4nipy_9neurospin_8register_8routines__joint_histogram[] = "\n    _joint_histogram(H, iterI, imJ, Tvox, interp)\n    Comments to follow.\n    ";
-static PyObject *__pyx_pf_4nipy_9neurospin_8register_8routines__joint_histogram(PyObject *__pyx_self, PyObject *__pyx_args, PyObject *__pyx_kwds) {
-  PyArrayObject *__pyx_v_H = 0;
-  PyArrayIterObject *__pyx_v_iterI = 0;
-  PyArrayObject *__pyx_v_imJ = 0;
-  PyArrayObject *__pyx_v_Tvox = 0;
-  int __pyx_v_interp;
-  double *__pyx_v_h;
-  double *__pyx_v_tvox;
-  unsigned int __pyx_v_clampI;
-  unsigned int __pyx_v_clampJ;
-  PyObject *__pyx_r;
-  static PyObject **__pyx_pyargnames[] = {&__pyx_kp_H,&__pyx_kp_iterI,&__pyx_kp_imJ,&__pyx_kp_Tvox,&__pyx_kp_interp,0};
-  __pyx_self = __pyx_self;
-  if (unlikely(__pyx_kwds)) {
-    PyObject* values[5] = {0,0,0,0,0};
-    Py_ssize_t kw_args = PyDict_Size(__pyx_kwds);
-    switch (PyTuple_GET_SIZE(__pyx_args)) {
-      case  5: values[4] = PyTuple_GET_ITEM(__pyx_args, 4);
-      case  4: values[3] = PyTuple_GET_ITEM(__pyx_args, 3);
-      case  3: values[2] = PyTuple_GET_ITEM(__pyx_args, 2);
-      case  2: values[1] = PyTuple_GET_ITEM(__pyx_args, 1);
-      case  1: values[0] = PyTuple_GET_ITEM(__pyx_args, 0);
-      case  0: break;
-      default: goto __pyx_L5_argtuple_error;
-    }
-    switch (PyTuple_GET_SIZE(__pyx_args)) {
-      case  0:
-      values[0] = PyDict_GetItem(__pyx_kwds, __pyx_kp_H);
-      if (likely(values[0])) kw_args--;
-      else goto __pyx_L5_argtuple_error;
-      case  1:
-      values[1] = PyDict_GetItem(__pyx_kwds, __pyx_kp_iterI);
-      if (likely(values[1])) kw_args--;
-      else {
-        __Pyx_RaiseArgtupleInvalid("_joint_histogram", 1, 5, 5, 1); {__pyx_filename = __pyx_f[0]; __pyx_lineno = 194; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-      }
-      case  2:
-      values[2] = PyDict_GetItem(__pyx_kwds, __pyx_kp_imJ);
-      if (likely(values[2])) kw_args--;
-      else {
-        __Pyx_RaiseArgtupleInvalid("_joint_histogram", 1, 5, 5, 2); {__pyx_filename = __pyx_f[0]; __pyx_lineno = 194; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-      }
-      case  3:
-      values[3] = PyDict_GetItem(__pyx_kwds, __pyx_kp_Tvox);
-      if (likely(values[3])) kw_args--;
-      else {
-        __Pyx_RaiseArgtupleInvalid("_joint_histogram", 1, 5, 5, 3); {__pyx_filename = __pyx_f[0]; __pyx_lineno = 194; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-      }
-      case  4:
-      values[4] = PyDict_GetItem(__pyx_kwds, __pyx_kp_interp);
-      if (likely(values[4])) kw_args--;
-      else {
-        __Pyx_RaiseArgtupleInvalid("_joint_histogram", 1, 5, 5, 4); {__pyx_filename = __pyx_f[0]; __pyx_lineno = 194; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-      }
-    }
-    if (unlikely(kw_args > 0)) {
-      if (unlikely(__Pyx_ParseOptionalKeywords(__pyx_kwds, __pyx_pyargnames, 0, values, PyTuple_GET_SIZE(__pyx_args), "_joint_histogram") < 0)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 194; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-    }
-    __pyx_v_H = ((PyArrayObject *)values[0]);
-    __pyx_v_iterI = ((PyArrayIterObject *)values[1]);
-    __pyx_v_imJ = ((PyArrayObject *)values[2]);
-    __pyx_v_Tvox = ((PyArrayObject *)values[3]);
-    __pyx_v_interp = __pyx_PyInt_int(values[4]); if (unlikely((__pyx_v_interp == (int)-1) && PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 194; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-  } else if (PyTuple_GET_SIZE(__pyx_args) != 5) {
-    goto __pyx_L5_argtuple_error;
-  } else {
-    __pyx_v_H = ((PyArrayObject *)PyTuple_GET_ITEM(__pyx_args, 0));
-    __pyx_v_iterI = ((PyArrayIterObject *)PyTuple_GET_ITEM(__pyx_args, 1));
-    __pyx_v_imJ = ((PyArrayObject *)PyTuple_GET_ITEM(__pyx_args, 2));
-    __pyx_v_Tvox = ((PyArrayObject *)PyTuple_GET_ITEM(__pyx_args, 3));
-    __pyx_v_interp = __pyx_PyInt_int(PyTuple_GET_ITEM(__pyx_args, 4)); if (unlikely((__pyx_v_interp == (int)-1) && PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 194; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-  }
-  goto __pyx_L4_argument_unpacking_done;
-  __pyx_L5_argtuple_error:;
-  __Pyx_RaiseArgtupleInvalid("_joint_histogram", 1, 5, 5, PyTuple_GET_SIZE(__pyx_args)); {__pyx_filename = __pyx_f[0]; __pyx_lineno = 194; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-  __pyx_L3_error:;
-  __Pyx_AddTraceback("nipy.neurospin.register.routines._joint_histogram");
-  return NULL;
-  __pyx_L4_argument_unpacking_done:;
-  if (unlikely(!__Pyx_ArgTypeTest(((PyObject *)__pyx_v_H), __pyx_ptype_4nipy_9neurospin_8register_8routines_ndarray, 1, "H", 0))) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 194; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  if (unlikely(!__Pyx_ArgTypeTest(((PyObject *)__pyx_v_iterI), __pyx_ptype_4nipy_9neurospin_8register_8routines_flatiter, 1, "iterI", 0))) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 194; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  if (unlikely(!__Pyx_ArgTypeTest(((PyObject *)__pyx_v_imJ), __pyx_ptype_4nipy_9neurospin_8register_8routines_ndarray, 1, "imJ", 0))) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 194; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  if (unlikely(!__Pyx_ArgTypeTest(((PyObject *)__pyx_v_Tvox), __pyx_ptype_4nipy_9neurospin_8register_8routines_ndarray, 1, "Tvox", 0))) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 194; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-
-  /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":203
- * 
- *     # Views
- *     clampI = <unsigned int>H.dimensions[0]             # <<<<<<<<<<<<<<
- *     clampJ = <unsigned int>H.dimensions[1]
- *     h = <double*>H.data
- */
-  __pyx_v_clampI = ((unsigned int)(__pyx_v_H->dimensions[0]));
-
-  /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":204
- *     # Views
- *     clampI = <unsigned int>H.dimensions[0]
- *     clampJ = <unsigned int>H.dimensions[1]             # <<<<<<<<<<<<<<
- *     h = <double*>H.data
- *     tvox = <double*>Tvox.data
- */
-  __pyx_v_clampJ = ((unsigned int)(__pyx_v_H->dimensions[1]));
-
-  /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":205
- *     clampI = <unsigned int>H.dimensions[0]
- *     clampJ = <unsigned int>H.dimensions[1]
- *     h = <double*>H.data             # <<<<<<<<<<<<<<
- *     tvox = <double*>Tvox.data
- * 
- */
-  __pyx_v_h = ((double *)__pyx_v_H->data);
-
-  /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":206
- *     clampJ = <unsigned int>H.dimensions[1]
- *     h = <double*>H.data
- *     tvox = <double*>Tvox.data             # <<<<<<<<<<<<<<
- * 
- *     # Compute joint histogram
- */
-  __pyx_v_tvox = ((double *)__pyx_v_Tvox->data);
-
-  /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":209
- * 
- *     # Compute joint histogram
- *     joint_histogram(h, clampI, clampJ, iterI, imJ, tvox, interp)             # <<<<<<<<<<<<<<
- * 
- *     return
- */
-  joint_histogram(__pyx_v_h, __pyx_v_clampI, __pyx_v_clampJ, __pyx_v_iterI, __pyx_v_imJ, __pyx_v_tvox, __pyx_v_interp);
-
-  /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":211
- *     joint_histogram(h, clampI, clampJ, iterI, imJ, tvox, interp)
- * 
- *     return             # <<<<<<<<<<<<<<
- * 
- * 
- */
-  __pyx_r = Py_None; Py_INCREF(Py_None);
-  goto __pyx_L0;
-
-  __pyx_r = Py_None; Py_INCREF(Py_None);
-  goto __pyx_L0;
-  __pyx_L1_error:;
-  __Pyx_AddTraceback("nipy.neurospin.register.routines._joint_histogram");
-  __pyx_r = NULL;
-  __pyx_L0:;
-  return __pyx_r;
-}
-
-/* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":214
- * 
- * 
- * def _similarity(ndarray H, ndarray HI, ndarray HJ, int simitype,             # <<<<<<<<<<<<<<
- *                 ndarray F=None, method=None):
- *     """
- */
-
-static PyObject *__pyx_pf_4nipy_9neurospin_8register_8routines__similarity(PyObject *__pyx_self, PyObject *__pyx_args, PyObject *__pyx_kwds); /*proto*/
-static char __pyx_doc_4nipy_9neurospin_8register_8routines__similarity[] = "\n    _similarity(H, hI, hJ, simitype, ndarray F=None)\n    Comments to follow\n    ";
-static PyObject *__pyx_pf_4nipy_9neurospin_8register_8routines__similarity(PyObject *__pyx_self, PyObject *__pyx_args, PyObject *__pyx_kwds) {
-  PyArrayObject *__pyx_v_H = 0;
-  PyArrayObject *__pyx_v_HI = 0;
-  PyArrayObject *__pyx_v_HJ = 0;
-  int __pyx_v_simitype;
-  PyArrayObject *__pyx_v_F = 0;
-  PyObject *__pyx_v_method = 0;
-  int __pyx_v_isF;
-  double *__pyx_v_h;
-  double *__pyx_v_hI;
-  double *__pyx_v_hJ;
-  double *__pyx_v_f;
-  double __pyx_v_simi;
-  double __pyx_v_n;
-  unsigned int __pyx_v_clampI;
-  unsigned int __pyx_v_clampJ;
-  PyObject *__pyx_r;
-  PyObject *__pyx_1 = 0;
-  int __pyx_2;
-  PyObject *__pyx_3 = 0;
-  double __pyx_4;
-  static PyObject **__pyx_pyargnames[] = {&__pyx_kp_H,&__pyx_kp_HI,&__pyx_kp_HJ,&__pyx_kp_simitype,&__pyx_kp_F,&__pyx_kp_method,0};
-  __pyx_self = __pyx_self;
-  __pyx_v_F = ((PyArrayObject *)Py_None);
-  __pyx_v_method = Py_None;
-  if (unlikely(__pyx_kwds)) {
-    PyObject* values[6] = {0,0,0,0,0,0};
-    Py_ssize_t kw_args = PyDict_Size(__pyx_kwds);
-    switch (PyTuple_GET_SIZE(__pyx_args)) {
-      case  6: values[5] = PyTuple_GET_ITEM(__pyx_args, 5);
-      case  5: values[4] = PyTuple_GET_ITEM(__pyx_args, 4);
-      case  4: values[3] = PyTuple_GET_ITEM(__pyx_args, 3);
-      case  3: values[2] = PyTuple_GET_ITEM(__pyx_args, 2);
-      case  2: values[1] = PyTuple_GET_ITEM(__pyx_args, 1);
-      case  1: values[0] = PyTuple_GET_ITEM(__pyx_args, 0);
-      case  0: break;
-      default: goto __pyx_L5_argtuple_error;
-    }
-    switch (PyTuple_GET_SIZE(__pyx_args)) {
-      case  0:
-      values[0] = PyDict_GetItem(__pyx_kwds, __pyx_kp_H);
-      if (likely(values[0])) kw_args--;
-      else goto __pyx_L5_argtuple_error;
-      case  1:
-      values[1] = PyDict_GetItem(__pyx_kwds, __pyx_kp_HI);
-      if (likely(values[1])) kw_args--;
-      else {
-        __Pyx_RaiseArgtupleInvalid("_similarity", 0, 4, 6, 1); {__pyx_filename = __pyx_f[0]; __pyx_lineno = 214; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-      }
-      case  2:
-      values[2] = PyDict_GetItem(__pyx_kwds, __pyx_kp_HJ);
-      if (likely(values[2])) kw_args--;
-      else {
-        __Pyx_RaiseArgtupleInvalid("_similarity", 0, 4, 6, 2); {__pyx_filename = __pyx_f[0]; __pyx_lineno = 214; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-      }
-      case  3:
-      values[3] = PyDict_GetItem(__pyx_kwds, __pyx_kp_simitype);
-      if (likely(values[3])) kw_args--;
-      else {
-        __Pyx_RaiseArgtupleInvalid("_similarity", 0, 4, 6, 3); {__pyx_filename = __pyx_f[0]; __pyx_lineno = 214; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-      }
-    }
-    if (unlikely(kw_args > 0)) {
-      if (unlikely(__Pyx_ParseOptionalKeywords(__pyx_kwds, __pyx_pyargnames, 0, values, PyTuple_GET_SIZE(__pyx_args), "_similarity") < 0)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 214; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-    }
-    __pyx_v_H = ((PyArrayObject *)values[0]);
-    __pyx_v_HI = ((PyArrayObject *)values[1]);
-    __pyx_v_HJ = ((PyArrayObject *)values[2]);
-    __pyx_v_simitype = __pyx_PyInt_int(values[3]); if (unlikely((__pyx_v_simitype == (int)-1) && PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 214; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-    if (values[4]) {
-      __pyx_v_F = ((PyArrayObject *)values[4]);
-    }
-    if (values[5]) {
-      __pyx_v_method = values[5];
-    }
-  } else {
-    switch (PyTuple_GET_SIZE(__pyx_args)) {
-      case  6:
-      __pyx_v_method = PyTuple_GET_ITEM(__pyx_args, 5);
-      case  5:
-      __pyx_v_F = ((PyArrayObject *)PyTuple_GET_ITEM(__pyx_args, 4));
-      case  4:
-      __pyx_v_simitype = __pyx_PyInt_int(PyTuple_GET_ITEM(__pyx_args, 3)); if (unlikely((__pyx_v_simitype == (int)-1) && PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 214; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-      __pyx_v_HJ = ((PyArrayObject *)PyTuple_GET_ITEM(__pyx_args, 2));
-      __pyx_v_HI = ((PyArrayObject *)PyTuple_GET_ITEM(__pyx_args, 1));
-      __pyx_v_H = ((PyArrayObject *)PyTuple_GET_ITEM(__pyx_args, 0));
-      break;
-      default: goto __pyx_L5_argtuple_error;
-    }
-  }
-  goto __pyx_L4_argument_unpacking_done;
-  __pyx_L5_argtuple_error:;
-  __Pyx_RaiseArgtupleInvalid("_similarity", 0, 4, 6, PyTuple_GET_SIZE(__pyx_args)); {__pyx_filename = __pyx_f[0]; __pyx_lineno = 214; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-  __pyx_L3_error:;
-  __Pyx_AddTraceback("nipy.neurospin.register.routines._similarity");
-  return NULL;
-  __pyx_L4_argument_unpacking_done:;
-  if (unlikely(!__Pyx_ArgTypeTest(((PyObject *)__pyx_v_H), __pyx_ptype_4nipy_9neurospin_8register_8routines_ndarray, 1, "H", 0))) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 214; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  if (unlikely(!__Pyx_ArgTypeTest(((PyObject *)__pyx_v_HI), __pyx_ptype_4nipy_9neurospin_8register_8routines_ndarray, 1, "HI", 0))) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 214; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  if (unlikely(!__Pyx_ArgTypeTest(((PyObject *)__pyx_v_HJ), __pyx_ptype_4nipy_9neurospin_8register_8routines_ndarray, 1, "HJ", 0))) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 214; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  if (unlikely(!__Pyx_ArgTypeTest(((PyObject *)__pyx_v_F), __pyx_ptype_4nipy_9neurospin_8register_8routines_ndarray, 1, "F", 0))) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 215; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-
-  /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":220
- *     Comments to follow
- *     """
- *     cdef int isF = 0             # <<<<<<<<<<<<<<
- *     cdef double *h, *hI, *hJ, *f=NULL
- *     cdef double simi=0.0, n
- */
-  __pyx_v_isF = 0;
-
-  /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":221
- *     """
- *     cdef int isF = 0
- *     cdef double *h, *hI, *hJ, *f=NULL             # <<<<<<<<<<<<<<
- *     cdef double simi=0.0, n
- *     cdef unsigned int clampI, clampJ
- */
-  __pyx_v_f = NULL;
-
-  /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":222
- *     cdef int isF = 0
- *     cdef double *h, *hI, *hJ, *f=NULL
- *     cdef double simi=0.0, n             # <<<<<<<<<<<<<<
- *     cdef unsigned int clampI, clampJ
- * 
- */
-  __pyx_v_simi = 0.0;
-
-  /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":226
- * 
- *     # Array views
- *     clampI = <unsigned int>H.dimensions[0]             # <<<<<<<<<<<<<<
- *     clampJ = <unsigned int>H.dimensions[1]
- *     h = <double*>H.data
- */
-  __pyx_v_clampI = ((unsigned int)(__pyx_v_H->dimensions[0]));
-
-  /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":227
- *     # Array views
- *     clampI = <unsigned int>H.dimensions[0]
- *     clampJ = <unsigned int>H.dimensions[1]             # <<<<<<<<<<<<<<
- *     h = <double*>H.data
- *     hI = <double*>HI.data
- */
-  __pyx_v_clampJ = ((unsigned int)(__pyx_v_H->dimensions[1]));
-
-  /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":228
- *     clampI = <unsigned int>H.dimensions[0]
- *     clampJ = <unsigned int>H.dimensions[1]
- *     h = <double*>H.data             # <<<<<<<<<<<<<<
- *     hI = <double*>HI.data
- *     hJ = <double*>HJ.data
- */
-  __pyx_v_h = ((double *)__pyx_v_H->data);
-
-  /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":229
- *     clampJ = <unsigned int>H.dimensions[1]
- *     h = <double*>H.data
- *     hI = <double*>HI.data             # <<<<<<<<<<<<<<
- *     hJ = <double*>HJ.data
- *     if F != None:
- */
-  __pyx_v_hI = ((double *)__pyx_v_HI->data);
-
-  /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":230
- *     h = <double*>H.data
- *     hI = <double*>HI.data
- *     hJ = <double*>HJ.data             # <<<<<<<<<<<<<<
- *     if F != None:
- *         f = <double*>F.data
- */
-  __pyx_v_hJ = ((double *)__pyx_v_HJ->data);
-
-  /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":231
- *     hI = <double*>HI.data
- *     hJ = <double*>HJ.data
- *     if F != None:             # <<<<<<<<<<<<<<
- *         f = <double*>F.data
- *         isF = 1
- */
-  __pyx_1 = PyObject_RichCompare(((PyObject *)__pyx_v_F), Py_None, Py_NE); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 231; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __pyx_2 = __Pyx_PyObject_IsTrue(__pyx_1); if (unlikely(__pyx_2 < 0)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 231; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_DECREF(__pyx_1); __pyx_1 = 0;
-  if (__pyx_2) {
-
-    /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":232
- *     hJ = <double*>HJ.data
- *     if F != None:
- *         f = <double*>F.data             # <<<<<<<<<<<<<<
- *         isF = 1
- * 
- */
-    __pyx_v_f = ((double *)__pyx_v_F->data);
-
-    /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":233
- *     if F != None:
- *         f = <double*>F.data
- *         isF = 1             # <<<<<<<<<<<<<<
- * 
- *     # Switch
- */
-    __pyx_v_isF = 1;
-    goto __pyx_L6;
-  }
-  __pyx_L6:;
-
-  /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":236
- * 
- *     # Switch
- *     if simitype == CORRELATION_COEFFICIENT:             # <<<<<<<<<<<<<<
- *         simi = correlation_coefficient(h, clampI, clampJ, &n)
- *     elif simitype == CORRELATION_RATIO:
- */
-  __pyx_2 = (__pyx_v_simitype == __pyx_e_4nipy_9neurospin_8register_8routines_CORRELATION_COEFFICIENT);
-  if (__pyx_2) {
-
-    /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":237
- *     # Switch
- *     if simitype == CORRELATION_COEFFICIENT:
- *         simi = correlation_coefficient(h, clampI, clampJ, &n)             # <<<<<<<<<<<<<<
- *     elif simitype == CORRELATION_RATIO:
- *         simi = correlation_ratio(h, clampI, clampJ, &n)
- */
-    __pyx_v_simi = correlation_coefficient(__pyx_v_h, __pyx_v_clampI, __pyx_v_clampJ, (&__pyx_v_n));
-    goto __pyx_L7;
-  }
-
-  /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":238
- *     if simitype == CORRELATION_COEFFICIENT:
- *         simi = correlation_coefficient(h, clampI, clampJ, &n)
- *     elif simitype == CORRELATION_RATIO:             # <<<<<<<<<<<<<<
- *         simi = correlation_ratio(h, clampI, clampJ, &n)
- *     elif simitype == CORRELATION_RATIO_L1:
- */
-  __pyx_2 = (__pyx_v_simitype == __pyx_e_4nipy_9neurospin_8register_8routines_CORRELATION_RATIO);
-  if (__pyx_2) {
-
-    /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":239
- *         simi = correlation_coefficient(h, clampI, clampJ, &n)
- *     elif simitype == CORRELATION_RATIO:
- *         simi = correlation_ratio(h, clampI, clampJ, &n)             # <<<<<<<<<<<<<<
- *     elif simitype == CORRELATION_RATIO_L1:
- *         simi = correlation_ratio_L1(h, hI, clampI, clampJ, &n)
- */
-    __pyx_v_simi = correlation_ratio(__pyx_v_h, __pyx_v_clampI, __pyx_v_clampJ, (&__pyx_v_n));
-    goto __pyx_L7;
-  }
-
-  /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":240
- *     elif simitype == CORRELATION_RATIO:
- *         simi = correlation_ratio(h, clampI, clampJ, &n)
- *     elif simitype == CORRELATION_RATIO_L1:             # <<<<<<<<<<<<<<
- *         simi = correlation_ratio_L1(h, hI, clampI, clampJ, &n)
- *     elif simitype == MUTUAL_INFORMATION:
- */
-  __pyx_2 = (__pyx_v_simitype == __pyx_e_4nipy_9neurospin_8register_8routines_CORRELATION_RATIO_L1);
-  if (__pyx_2) {
-
-    /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":241
- *         simi = correlation_ratio(h, clampI, clampJ, &n)
- *     elif simitype == CORRELATION_RATIO_L1:
- *         simi = correlation_ratio_L1(h, hI, clampI, clampJ, &n)             # <<<<<<<<<<<<<<
- *     elif simitype == MUTUAL_INFORMATION:
- *         simi = mutual_information(h, hI, clampI, hJ, clampJ, &n)
- */
-    __pyx_v_simi = correlation_ratio_L1(__pyx_v_h, __pyx_v_hI, __pyx_v_clampI, __pyx_v_clampJ, (&__pyx_v_n));
-    goto __pyx_L7;
-  }
-
-  /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":242
- *     elif simitype == CORRELATION_RATIO_L1:
- *         simi = correlation_ratio_L1(h, hI, clampI, clampJ, &n)
- *     elif simitype == MUTUAL_INFORMATION:             # <<<<<<<<<<<<<<
- *         simi = mutual_information(h, hI, clampI, hJ, clampJ, &n)
- *     elif simitype == JOINT_ENTROPY:
- */
-  __pyx_2 = (__pyx_v_simitype == __pyx_e_4nipy_9neurospin_8register_8routines_MUTUAL_INFORMATION);
-  if (__pyx_2) {
-
-    /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":243
- *         simi = correlation_ratio_L1(h, hI, clampI, clampJ, &n)
- *     elif simitype == MUTUAL_INFORMATION:
- *         simi = mutual_information(h, hI, clampI, hJ, clampJ, &n)             # <<<<<<<<<<<<<<
- *     elif simitype == JOINT_ENTROPY:
- *         simi = joint_entropy(h, clampI, clampJ)
- */
-    __pyx_v_simi = mutual_information(__pyx_v_h, __pyx_v_hI, __pyx_v_clampI, __pyx_v_hJ, __pyx_v_clampJ, (&__pyx_v_n));
-    goto __pyx_L7;
-  }
-
-  /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":244
- *     elif simitype == MUTUAL_INFORMATION:
- *         simi = mutual_information(h, hI, clampI, hJ, clampJ, &n)
- *     elif simitype == JOINT_ENTROPY:             # <<<<<<<<<<<<<<
- *         simi = joint_entropy(h, clampI, clampJ)
- *     elif simitype == CONDITIONAL_ENTROPY:
- */
-  __pyx_2 = (__pyx_v_simitype == __pyx_e_4nipy_9neurospin_8register_8routines_JOINT_ENTROPY);
-  if (__pyx_2) {
-
-    /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":245
- *         simi = mutual_information(h, hI, clampI, hJ, clampJ, &n)
- *     elif simitype == JOINT_ENTROPY:
- *         simi = joint_entropy(h, clampI, clampJ)             # <<<<<<<<<<<<<<
- *     elif simitype == CONDITIONAL_ENTROPY:
- *         simi = conditional_entropy(h, hJ, clampI, clampJ)
- */
-    __pyx_v_simi = joint_entropy(__pyx_v_h, __pyx_v_clampI, __pyx_v_clampJ);
-    goto __pyx_L7;
-  }
-
-  /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":246
- *     elif simitype == JOINT_ENTROPY:
- *         simi = joint_entropy(h, clampI, clampJ)
- *     elif simitype == CONDITIONAL_ENTROPY:             # <<<<<<<<<<<<<<
- *         simi = conditional_entropy(h, hJ, clampI, clampJ)
- *     elif simitype == NORMALIZED_MUTUAL_INFORMATION:
- */
-  __pyx_2 = (__pyx_v_simitype == __pyx_e_4nipy_9neurospin_8register_8routines_CONDITIONAL_ENTROPY);
-  if (__pyx_2) {
-
-    /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":247
- *         simi = joint_entropy(h, clampI, clampJ)
- *     elif simitype == CONDITIONAL_ENTROPY:
- *         simi = conditional_entropy(h, hJ, clampI, clampJ)             # <<<<<<<<<<<<<<
- *     elif simitype == NORMALIZED_MUTUAL_INFORMATION:
- *         simi = normalized_mutual_information(h, hI, clampI, hJ, clampJ, &n)
- */
-    __pyx_v_simi = conditional_entropy(__pyx_v_h, __pyx_v_hJ, __pyx_v_clampI, __pyx_v_clampJ);
-    goto __pyx_L7;
-  }
-
-  /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":248
- *     elif simitype == CONDITIONAL_ENTROPY:
- *         simi = conditional_entropy(h, hJ, clampI, clampJ)
- *     elif simitype == NORMALIZED_MUTUAL_INFORMATION:             # <<<<<<<<<<<<<<
- *         simi = normalized_mutual_information(h, hI, clampI, hJ, clampJ, &n)
- *     elif simitype == SUPERVISED_MUTUAL_INFORMATION:
- */
-  __pyx_2 = (__pyx_v_simitype == __pyx_e_4nipy_9neurospin_8register_8routines_NORMALIZED_MUTUAL_INFORMATION);
-  if (__pyx_2) {
-
-    /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":249
- *         simi = conditional_entropy(h, hJ, clampI, clampJ)
- *     elif simitype == NORMALIZED_MUTUAL_INFORMATION:
- *         simi = normalized_mutual_information(h, hI, clampI, hJ, clampJ, &n)             # <<<<<<<<<<<<<<
- *     elif simitype == SUPERVISED_MUTUAL_INFORMATION:
- *         simi = supervised_mutual_information(h, f, hI, clampI, hJ, clampJ, &n)
- */
-    __pyx_v_simi = normalized_mutual_information(__pyx_v_h, __pyx_v_hI, __pyx_v_clampI, __pyx_v_hJ, __pyx_v_clampJ, (&__pyx_v_n));
-    goto __pyx_L7;
-  }
-
-  /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":250
- *     elif simitype == NORMALIZED_MUTUAL_INFORMATION:
- *         simi = normalized_mutual_information(h, hI, clampI, hJ, clampJ, &n)
- *     elif simitype == SUPERVISED_MUTUAL_INFORMATION:             # <<<<<<<<<<<<<<
- *         simi = supervised_mutual_information(h, f, hI, clampI, hJ, clampJ, &n)
- *     else: # CUSTOM
- */
-  __pyx_2 = (__pyx_v_simitype == __pyx_e_4nipy_9neurospin_8register_8routines_SUPERVISED_MUTUAL_INFORMATION);
-  if (__pyx_2) {
-
-    /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":251
- *         simi = normalized_mutual_information(h, hI, clampI, hJ, clampJ, &n)
- *     elif simitype == SUPERVISED_MUTUAL_INFORMATION:
- *         simi = supervised_mutual_information(h, f, hI, clampI, hJ, clampJ, &n)             # <<<<<<<<<<<<<<
- *     else: # CUSTOM
- *         simi = method(H)
- */
-    __pyx_v_simi = supervised_mutual_information(__pyx_v_h, __pyx_v_f, __pyx_v_hI, __pyx_v_clampI, __pyx_v_hJ, __pyx_v_clampJ, (&__pyx_v_n));
-    goto __pyx_L7;
-  }
-  /*else*/ {
-
-    /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":253
- *         simi = supervised_mutual_information(h, f, hI, clampI, hJ, clampJ, &n)
- *     else: # CUSTOM
- *         simi = method(H)             # <<<<<<<<<<<<<<
- * 
- *     return simi
- */
-    __pyx_1 = PyTuple_New(1); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 253; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_INCREF(((PyObject *)__pyx_v_H));
-    PyTuple_SET_ITEM(__pyx_1, 0, ((PyObject *)__pyx_v_H));
-    __pyx_3 = PyObject_Call(__pyx_v_method, ((PyObject *)__pyx_1), NULL); if (unlikely(!__pyx_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 253; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_DECREF(((PyObject *)__pyx_1)); __pyx_1 = 0;
-    __pyx_4 = __pyx_PyFloat_AsDouble(__pyx_3); if (unlikely(PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 253; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_DECREF(__pyx_3); __pyx_3 = 0;
-    __pyx_v_simi = __pyx_4;
-  }
-  __pyx_L7:;
-
-  /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":255
- *         simi = method(H)
- * 
- *     return simi             # <<<<<<<<<<<<<<
- * 
- * 
- */
-  __pyx_1 = PyFloat_FromDouble(__pyx_v_simi); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 255; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __pyx_r = __pyx_1;
-  __pyx_1 = 0;
-  goto __pyx_L0;
-
-  __pyx_r = Py_None; Py_INCREF(Py_None);
-  goto __pyx_L0;
-  __pyx_L1_error:;
-  Py_XDECREF(__pyx_1);
-  Py_XDECREF(__pyx_3);
-  __Pyx_AddTraceback("nipy.neurospin.register.routines._similarity");
-  __pyx_r = NULL;
-  __pyx_L0:;
-  return __pyx_r;
-}
-
-/* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":259
- * 
- * 
- * def cspline_transform(ndarray x):             # <<<<<<<<<<<<<<
- *     c = np.zeros(x.shape)
- *     cubic_spline_transform(c, x)
- */
-
-static PyObject *__pyx_pf_4nipy_9neurospin_8register_8routines_cspline_transform(PyObject *__pyx_self, PyObject *__pyx_v_x); /*proto*/
-static PyObject *__pyx_pf_4nipy_9neurospin_8register_8routines_cspline_transform(PyObject *__pyx_self, PyObject *__pyx_v_x) {
-  PyObject *__pyx_v_c;
-  PyObject *__pyx_r;
-  PyObject *__pyx_1 = 0;
-  PyObject *__pyx_2 = 0;
-  PyObject *__pyx_3 = 0;
-  __pyx_self = __pyx_self;
-  __pyx_v_c = Py_None; Py_INCREF(Py_None);
-  if (unlikely(!__Pyx_ArgTypeTest(((PyObject *)__pyx_v_x), __pyx_ptype_4nipy_9neurospin_8register_8routines_ndarray, 1, "x", 0))) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 259; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-
-  /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":260
- * 
- * def cspline_transform(ndarray x):
- *     c = np.zeros(x.shape)             # <<<<<<<<<<<<<<
- *     cubic_spline_transform(c, x)
- *     return c
- */
-  __pyx_1 = __Pyx_GetName(__pyx_m, __pyx_kp_np); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 260; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __pyx_2 = PyObject_GetAttr(__pyx_1, __pyx_kp_zeros); if (unlikely(!__pyx_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 260; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_DECREF(__pyx_1); __pyx_1 = 0;
-  __pyx_1 = PyObject_GetAttr(__pyx_v_x, __pyx_kp_shape); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 260; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __pyx_3 = PyTuple_New(1); if (unlikely(!__pyx_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 260; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  PyTuple_SET_ITEM(__pyx_3, 0, __pyx_1);
-  __pyx_1 = 0;
-  __pyx_1 = PyObject_Call(__pyx_2, ((PyObject *)__pyx_3), NULL); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 260; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_DECREF(__pyx_2); __pyx_2 = 0;
-  Py_DECREF(((PyObject *)__pyx_3)); __pyx_3 = 0;
-  Py_DECREF(__pyx_v_c);
-  __pyx_v_c = __pyx_1;
-  __pyx_1 = 0;
-
-  /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":261
- * def cspline_transform(ndarray x):
- *     c = np.zeros(x.shape)
- *     cubic_spline_transform(c, x)             # <<<<<<<<<<<<<<
- *     return c
- * 
- */
-  if (!(__Pyx_TypeTest(__pyx_v_c, __pyx_ptype_4nipy_9neurospin_8register_8routines_ndarray))) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 261; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  cubic_spline_transform(((PyArrayObject *)__pyx_v_c), ((PyArrayObject *)__pyx_v_x));
-
-  /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":262
- *     c = np.zeros(x.shape)
- *     cubic_spline_transform(c, x)
- *     return c             # <<<<<<<<<<<<<<
- * 
- * def cspline_sample1d(ndarray R, ndarray C, X=0):
- */
-  Py_INCREF(__pyx_v_c);
-  __pyx_r = __pyx_v_c;
-  goto __pyx_L0;
-
-  __pyx_r = Py_None; Py_INCREF(Py_None);
-  goto __pyx_L0;
-  __pyx_L1_error:;
-  Py_XDECREF(__pyx_1);
-  Py_XDECREF(__pyx_2);
-  Py_XDECREF(__pyx_3);
-  __Pyx_AddTraceback("nipy.neurospin.register.routines.cspline_transform");
-  __pyx_r = NULL;
-  __pyx_L0:;
-  Py_DECREF(__pyx_v_c);
-  return __pyx_r;
-}
-
-/* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":264
- *     return c
- * 
- * def cspline_sample1d(ndarray R, ndarray C, X=0):             # <<<<<<<<<<<<<<
- *     cdef double *r, *x
- *     cdef broadcast multi
- */
-
-static PyObject *__pyx_pf_4nipy_9neurospin_8register_8routines_cspline_sample1d(PyObject *__pyx_self, PyObject *__pyx_args, PyObject *__pyx_kwds); /*proto*/
-static PyObject *__pyx_pf_4nipy_9neurospin_8register_8routines_cspline_sample1d(PyObject *__pyx_self, PyObject *__pyx_args, PyObject *__pyx_kwds) {
-  PyArrayObject *__pyx_v_R = 0;
-  PyArrayObject *__pyx_v_C = 0;
-  PyObject *__pyx_v_X = 0;
-  double *__pyx_v_r;
-  double *__pyx_v_x;
-  PyArrayMultiIterObject *__pyx_v_multi;
-  PyObject *__pyx_v_Xa;
-  PyObject *__pyx_r;
-  PyObject *__pyx_1 = 0;
-  PyObject *__pyx_2 = 0;
-  PyObject *__pyx_3 = 0;
-  int __pyx_4;
-  static PyObject **__pyx_pyargnames[] = {&__pyx_kp_R,&__pyx_kp_C,&__pyx_kp_X,0};
-  __pyx_self = __pyx_self;
-  __pyx_v_X = __pyx_int_0;
-  if (unlikely(__pyx_kwds)) {
-    PyObject* values[3] = {0,0,0};
-    Py_ssize_t kw_args = PyDict_Size(__pyx_kwds);
-    switch (PyTuple_GET_SIZE(__pyx_args)) {
-      case  3: values[2] = PyTuple_GET_ITEM(__pyx_args, 2);
-      case  2: values[1] = PyTuple_GET_ITEM(__pyx_args, 1);
-      case  1: values[0] = PyTuple_GET_ITEM(__pyx_args, 0);
-      case  0: break;
-      default: goto __pyx_L5_argtuple_error;
-    }
-    switch (PyTuple_GET_SIZE(__pyx_args)) {
-      case  0:
-      values[0] = PyDict_GetItem(__pyx_kwds, __pyx_kp_R);
-      if (likely(values[0])) kw_args--;
-      else goto __pyx_L5_argtuple_error;
-      case  1:
-      values[1] = PyDict_GetItem(__pyx_kwds, __pyx_kp_C);
-      if (likely(values[1])) kw_args--;
-      else {
-        __Pyx_RaiseArgtupleInvalid("cspline_sample1d", 0, 2, 3, 1); {__pyx_filename = __pyx_f[0]; __pyx_lineno = 264; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-      }
-    }
-    if (unlikely(kw_args > 0)) {
-      if (unlikely(__Pyx_ParseOptionalKeywords(__pyx_kwds, __pyx_pyargnames, 0, values, PyTuple_GET_SIZE(__pyx_args), "cspline_sample1d") < 0)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 264; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-    }
-    __pyx_v_R = ((PyArrayObject *)values[0]);
-    __pyx_v_C = ((PyArrayObject *)values[1]);
-    if (values[2]) {
-      __pyx_v_X = values[2];
-    }
-  } else {
-    switch (PyTuple_GET_SIZE(__pyx_args)) {
-      case  3:
-      __pyx_v_X = PyTuple_GET_ITEM(__pyx_args, 2);
-      case  2:
-      __pyx_v_C = ((PyArrayObject *)PyTuple_GET_ITEM(__pyx_args, 1));
-      __pyx_v_R = ((PyArrayObject *)PyTuple_GET_ITEM(__pyx_args, 0));
-      break;
-      default: goto __pyx_L5_argtuple_error;
-    }
-  }
-  goto __pyx_L4_argument_unpacking_done;
-  __pyx_L5_argtuple_error:;
-  __Pyx_RaiseArgtupleInvalid("cspline_sample1d", 0, 2, 3, PyTuple_GET_SIZE(__pyx_args)); {__pyx_filename = __pyx_f[0]; __pyx_lineno = 264; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-  __pyx_L3_error:;
-  __Pyx_AddTraceback("nipy.neurospin.register.routines.cspline_sample1d");
-  return NULL;
-  __pyx_L4_argument_unpacking_done:;
-  __pyx_v_multi = ((PyArrayMultiIterObject *)Py_None); Py_INCREF(Py_None);
-  __pyx_v_Xa = Py_None; Py_INCREF(Py_None);
-  if (unlikely(!__Pyx_ArgTypeTest(((PyObject *)__pyx_v_R), __pyx_ptype_4nipy_9neurospin_8register_8routines_ndarray, 1, "R", 0))) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 264; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  if (unlikely(!__Pyx_ArgTypeTest(((PyObject *)__pyx_v_C), __pyx_ptype_4nipy_9neurospin_8register_8routines_ndarray, 1, "C", 0))) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 264; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-
-  /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":267
- *     cdef double *r, *x
- *     cdef broadcast multi
- *     Xa = np.reshape(X, R.shape).astype('double')             # <<<<<<<<<<<<<<
- *     multi = PyArray_MultiIterNew(2, <void*>R, <void*>Xa)
- *     while(multi.index < multi.size):
- */
-  __pyx_1 = __Pyx_GetName(__pyx_m, __pyx_kp_np); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 267; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __pyx_2 = PyObject_GetAttr(__pyx_1, __pyx_kp_reshape); if (unlikely(!__pyx_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 267; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_DECREF(__pyx_1); __pyx_1 = 0;
-  __pyx_1 = PyObject_GetAttr(((PyObject *)__pyx_v_R), __pyx_kp_shape); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 267; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __pyx_3 = PyTuple_New(2); if (unlikely(!__pyx_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 267; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_INCREF(__pyx_v_X);
-  PyTuple_SET_ITEM(__pyx_3, 0, __pyx_v_X);
-  PyTuple_SET_ITEM(__pyx_3, 1, __pyx_1);
-  __pyx_1 = 0;
-  __pyx_1 = PyObject_Call(__pyx_2, ((PyObject *)__pyx_3), NULL); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 267; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_DECREF(__pyx_2); __pyx_2 = 0;
-  Py_DECREF(((PyObject *)__pyx_3)); __pyx_3 = 0;
-  __pyx_2 = PyObject_GetAttr(__pyx_1, __pyx_kp_astype); if (unlikely(!__pyx_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 267; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_DECREF(__pyx_1); __pyx_1 = 0;
-  __pyx_3 = PyTuple_New(1); if (unlikely(!__pyx_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 267; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_INCREF(__pyx_kp_53);
-  PyTuple_SET_ITEM(__pyx_3, 0, __pyx_kp_53);
-  __pyx_1 = PyObject_Call(__pyx_2, ((PyObject *)__pyx_3), NULL); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 267; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_DECREF(__pyx_2); __pyx_2 = 0;
-  Py_DECREF(((PyObject *)__pyx_3)); __pyx_3 = 0;
-  Py_DECREF(__pyx_v_Xa);
-  __pyx_v_Xa = __pyx_1;
-  __pyx_1 = 0;
-
-  /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":268
- *     cdef broadcast multi
- *     Xa = np.reshape(X, R.shape).astype('double')
- *     multi = PyArray_MultiIterNew(2, <void*>R, <void*>Xa)             # <<<<<<<<<<<<<<
- *     while(multi.index < multi.size):
- *         r = <double*>PyArray_MultiIter_DATA(multi, 0)
- */
-  __pyx_2 = PyArray_MultiIterNew(2, ((void *)__pyx_v_R), ((void *)__pyx_v_Xa)); if (unlikely(!__pyx_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 268; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  if (!(__Pyx_TypeTest(__pyx_2, __pyx_ptype_4nipy_9neurospin_8register_8routines_broadcast))) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 268; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_DECREF(((PyObject *)__pyx_v_multi));
-  __pyx_v_multi = ((PyArrayMultiIterObject *)__pyx_2);
-  __pyx_2 = 0;
-
-  /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":269
- *     Xa = np.reshape(X, R.shape).astype('double')
- *     multi = PyArray_MultiIterNew(2, <void*>R, <void*>Xa)
- *     while(multi.index < multi.size):             # <<<<<<<<<<<<<<
- *         r = <double*>PyArray_MultiIter_DATA(multi, 0)
- *         x = <double*>PyArray_MultiIter_DATA(multi, 1)
- */
-  while (1) {
-    __pyx_4 = (__pyx_v_multi->index < __pyx_v_multi->size);
-    if (!__pyx_4) break;
-
-    /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":270
- *     multi = PyArray_MultiIterNew(2, <void*>R, <void*>Xa)
- *     while(multi.index < multi.size):
- *         r = <double*>PyArray_MultiIter_DATA(multi, 0)             # <<<<<<<<<<<<<<
- *         x = <double*>PyArray_MultiIter_DATA(multi, 1)
- *         r[0] = cubic_spline_sample1d(x[0], C)
- */
-    __pyx_v_r = ((double *)PyArray_MultiIter_DATA(__pyx_v_multi, 0));
-
-    /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":271
- *     while(multi.index < multi.size):
- *         r = <double*>PyArray_MultiIter_DATA(multi, 0)
- *         x = <double*>PyArray_MultiIter_DATA(multi, 1)             # <<<<<<<<<<<<<<
- *         r[0] = cubic_spline_sample1d(x[0], C)
- *         PyArray_MultiIter_NEXT(multi)
- */
-    __pyx_v_x = ((double *)PyArray_MultiIter_DATA(__pyx_v_multi, 1));
-
-    /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":272
- *         r = <double*>PyArray_MultiIter_DATA(multi, 0)
- *         x = <double*>PyArray_MultiIter_DATA(multi, 1)
- *         r[0] = cubic_spline_sample1d(x[0], C)             # <<<<<<<<<<<<<<
- *         PyArray_MultiIter_NEXT(multi)
- *     return R
- */
-    (__pyx_v_r[0]) = cubic_spline_sample1d((__pyx_v_x[0]), __pyx_v_C);
-
-    /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":273
- *         x = <double*>PyArray_MultiIter_DATA(multi, 1)
- *         r[0] = cubic_spline_sample1d(x[0], C)
- *         PyArray_MultiIter_NEXT(multi)             # <<<<<<<<<<<<<<
- *     return R
- * 
- */
-    PyArray_MultiIter_NEXT(__pyx_v_multi);
-  }
-
-  /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":274
- *         r[0] = cubic_spline_sample1d(x[0], C)
- *         PyArray_MultiIter_NEXT(multi)
- *     return R             # <<<<<<<<<<<<<<
- * 
- * def cspline_sample2d(ndarray R, ndarray C, X=0, Y=0):
- */
-  Py_INCREF(((PyObject *)__pyx_v_R));
-  __pyx_r = ((PyObject *)__pyx_v_R);
-  goto __pyx_L0;
-
-  __pyx_r = Py_None; Py_INCREF(Py_None);
-  goto __pyx_L0;
-  __pyx_L1_error:;
-  Py_XDECREF(__pyx_1);
-  Py_XDECREF(__pyx_2);
-  Py_XDECREF(__pyx_3);
-  __Pyx_AddTraceback("nipy.neurospin.register.routines.cspline_sample1d");
-  __pyx_r = NULL;
-  __pyx_L0:;
-  Py_DECREF(__pyx_v_multi);
-  Py_DECREF(__pyx_v_Xa);
-  return __pyx_r;
-}
-
-/* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":276
- *     return R
- * 
- * def cspline_sample2d(ndarray R, ndarray C, X=0, Y=0):             # <<<<<<<<<<<<<<
- *     cdef double *r, *x, *y
- *     cdef broadcast multi
- */
-
-static PyObject *__pyx_pf_4nipy_9neurospin_8register_8routines_cspline_sample2d(PyObject *__pyx_self, PyObject *__pyx_args, PyObject *__pyx_kwds); /*proto*/
-static PyObject *__pyx_pf_4nipy_9neurospin_8register_8routines_cspline_sample2d(PyObject *__pyx_self, PyObject *__pyx_args, PyObject *__pyx_kwds) {
-  PyArrayObject *__pyx_v_R = 0;
-  PyArrayObject *__pyx_v_C = 0;
-  PyObject *__pyx_v_X = 0;
-  PyObject *__pyx_v_Y = 0;
-  double *__pyx_v_r;
-  double *__pyx_v_x;
-  double *__pyx_v_y;
-  PyArrayMultiIterObject *__pyx_v_multi;
-  PyObject *__pyx_v_Xa;
-  PyObject *__pyx_v_Ya;
-  PyObject *__pyx_r;
-  PyObject *__pyx_1 = 0;
-  PyObject *__pyx_2 = 0;
-  PyObject *__pyx_3 = 0;
-  int __pyx_4;
-  static PyObject **__pyx_pyargnames[] = {&__pyx_kp_R,&__pyx_kp_C,&__pyx_kp_X,&__pyx_kp_Y,0};
-  __pyx_self = __pyx_self;
-  __pyx_v_X = __pyx_int_0;
-  __pyx_v_Y = __pyx_int_0;
-  if (unlikely(__pyx_kwds)) {
-    PyObject* values[4] = {0,0,0,0};
-    Py_ssize_t kw_args = PyDict_Size(__pyx_kwds);
-    switch (PyTuple_GET_SIZE(__pyx_args)) {
-      case  4: values[3] = PyTuple_GET_ITEM(__pyx_args, 3);
-      case  3: values[2] = PyTuple_GET_ITEM(__pyx_args, 2);
-      case  2: values[1] = PyTuple_GET_ITEM(__pyx_args, 1);
-      case  1: values[0] = PyTuple_GET_ITEM(__pyx_args, 0);
-      case  0: break;
-      default: goto __pyx_L5_argtuple_error;
-    }
-    switch (PyTuple_GET_SIZE(__pyx_args)) {
-      case  0:
-      values[0] = PyDict_GetItem(__pyx_kwds, __pyx_kp_R);
-      if (likely(values[0])) kw_args--;
-      else goto __pyx_L5_argtuple_error;
-      case  1:
-      values[1] = PyDict_GetItem(__pyx_kwds, __pyx_kp_C);
-      if (likely(values[1])) kw_args--;
-      else {
-        __Pyx_RaiseArgtupleInvalid("cspline_sample2d", 0, 2, 4, 1); {__pyx_filename = __pyx_f[0]; __pyx_lineno = 276; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-      }
-    }
-    if (unlikely(kw_args > 0)) {
-      if (unlikely(__Pyx_ParseOptionalKeywords(__pyx_kwds, __pyx_pyargnames, 0, values, PyTuple_GET_SIZE(__pyx_args), "cspline_sample2d") < 0)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 276; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-    }
-    __pyx_v_R = ((PyArrayObject *)values[0]);
-    __pyx_v_C = ((PyArrayObject *)values[1]);
-    if (values[2]) {
-      __pyx_v_X = values[2];
-    }
-    if (values[3]) {
-      __pyx_v_Y = values[3];
-    }
-  } else {
-    switch (PyTuple_GET_SIZE(__pyx_args)) {
-      case  4:
-      __pyx_v_Y = PyTuple_GET_ITEM(__pyx_args, 3);
-      case  3:
-      __pyx_v_X = PyTuple_GET_ITEM(__pyx_args, 2);
-      case  2:
-      __pyx_v_C = ((PyArrayObject *)PyTuple_GET_ITEM(__pyx_args, 1));
-      __pyx_v_R = ((PyArrayObject *)PyTuple_GET_ITEM(__pyx_args, 0));
-      break;
-      default: goto __pyx_L5_argtuple_error;
-    }
-  }
-  goto __pyx_L4_argument_unpacking_done;
-  __pyx_L5_argtuple_error:;
-  __Pyx_RaiseArgtupleInvalid("cspline_sample2d", 0, 2, 4, PyTuple_GET_SIZE(__pyx_args)); {__pyx_filename = __pyx_f[0]; __pyx_lineno = 276; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-  __pyx_L3_error:;
-  __Pyx_AddTraceback("nipy.neurospin.register.routines.cspline_sample2d");
-  return NULL;
-  __pyx_L4_argument_unpacking_done:;
-  __pyx_v_multi = ((PyArrayMultiIterObject *)Py_None); Py_INCREF(Py_None);
-  __pyx_v_Xa = Py_None; Py_INCREF(Py_None);
-  __pyx_v_Ya = Py_None; Py_INCREF(Py_None);
-  if (unlikely(!__Pyx_ArgTypeTest(((PyObject *)__pyx_v_R), __pyx_ptype_4nipy_9neurospin_8register_8routines_ndarray, 1, "R", 0))) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 276; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  if (unlikely(!__Pyx_ArgTypeTest(((PyObject *)__pyx_v_C), __pyx_ptype_4nipy_9neurospin_8register_8routines_ndarray, 1, "C", 0))) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 276; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-
-  /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":279
- *     cdef double *r, *x, *y
- *     cdef broadcast multi
- *     Xa = np.reshape(X, R.shape).astype('double')             # <<<<<<<<<<<<<<
- *     Ya = np.reshape(Y, R.shape).astype('double')
- *     multi = PyArray_MultiIterNew(3, <void*>R, <void*>Xa, <void*>Ya)
- */
-  __pyx_1 = __Pyx_GetName(__pyx_m, __pyx_kp_np); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 279; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __pyx_2 = PyObject_GetAttr(__pyx_1, __pyx_kp_reshape); if (unlikely(!__pyx_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 279; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_DECREF(__pyx_1); __pyx_1 = 0;
-  __pyx_1 = PyObject_GetAttr(((PyObject *)__pyx_v_R), __pyx_kp_shape); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 279; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __pyx_3 = PyTuple_New(2); if (unlikely(!__pyx_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 279; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_INCREF(__pyx_v_X);
-  PyTuple_SET_ITEM(__pyx_3, 0, __pyx_v_X);
-  PyTuple_SET_ITEM(__pyx_3, 1, __pyx_1);
-  __pyx_1 = 0;
-  __pyx_1 = PyObject_Call(__pyx_2, ((PyObject *)__pyx_3), NULL); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 279; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_DECREF(__pyx_2); __pyx_2 = 0;
-  Py_DECREF(((PyObject *)__pyx_3)); __pyx_3 = 0;
-  __pyx_2 = PyObject_GetAttr(__pyx_1, __pyx_kp_astype); if (unlikely(!__pyx_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 279; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_DECREF(__pyx_1); __pyx_1 = 0;
-  __pyx_3 = PyTuple_New(1); if (unlikely(!__pyx_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 279; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_INCREF(__pyx_kp_54);
-  PyTuple_SET_ITEM(__pyx_3, 0, __pyx_kp_54);
-  __pyx_1 = PyObject_Call(__pyx_2, ((PyObject *)__pyx_3), NULL); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 279; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_DECREF(__pyx_2); __pyx_2 = 0;
-  Py_DECREF(((PyObject *)__pyx_3)); __pyx_3 = 0;
-  Py_DECREF(__pyx_v_Xa);
-  __pyx_v_Xa = __pyx_1;
-  __pyx_1 = 0;
-
-  /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":280
- *     cdef broadcast multi
- *     Xa = np.reshape(X, R.shape).astype('double')
- *     Ya = np.reshape(Y, R.shape).astype('double')             # <<<<<<<<<<<<<<
- *     multi = PyArray_MultiIterNew(3, <void*>R, <void*>Xa, <void*>Ya)
- *     while(multi.index < multi.size):
- */
-  __pyx_2 = __Pyx_GetName(__pyx_m, __pyx_kp_np); if (unlikely(!__pyx_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 280; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __pyx_3 = PyObject_GetAttr(__pyx_2, __pyx_kp_reshape); if (unlikely(!__pyx_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 280; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_DECREF(__pyx_2); __pyx_2 = 0;
-  __pyx_1 = PyObject_GetAttr(((PyObject *)__pyx_v_R), __pyx_kp_shape); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 280; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __pyx_2 = PyTuple_New(2); if (unlikely(!__pyx_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 280; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_INCREF(__pyx_v_Y);
-  PyTuple_SET_ITEM(__pyx_2, 0, __pyx_v_Y);
-  PyTuple_SET_ITEM(__pyx_2, 1, __pyx_1);
-  __pyx_1 = 0;
-  __pyx_1 = PyObject_Call(__pyx_3, ((PyObject *)__pyx_2), NULL); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 280; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_DECREF(__pyx_3); __pyx_3 = 0;
-  Py_DECREF(((PyObject *)__pyx_2)); __pyx_2 = 0;
-  __pyx_3 = PyObject_GetAttr(__pyx_1, __pyx_kp_astype); if (unlikely(!__pyx_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 280; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_DECREF(__pyx_1); __pyx_1 = 0;
-  __pyx_2 = PyTuple_New(1); if (unlikely(!__pyx_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 280; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_INCREF(__pyx_kp_55);
-  PyTuple_SET_ITEM(__pyx_2, 0, __pyx_kp_55);
-  __pyx_1 = PyObject_Call(__pyx_3, ((PyObject *)__pyx_2), NULL); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 280; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_DECREF(__pyx_3); __pyx_3 = 0;
-  Py_DECREF(((PyObject *)__pyx_2)); __pyx_2 = 0;
-  Py_DECREF(__pyx_v_Ya);
-  __pyx_v_Ya = __pyx_1;
-  __pyx_1 = 0;
-
-  /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":281
- *     Xa = np.reshape(X, R.shape).astype('double')
- *     Ya = np.reshape(Y, R.shape).astype('double')
- *     multi = PyArray_MultiIterNew(3, <void*>R, <void*>Xa, <void*>Ya)             # <<<<<<<<<<<<<<
- *     while(multi.index < multi.size):
- *         r = <double*>PyArray_MultiIter_DATA(multi, 0)
- */
-  __pyx_3 = PyArray_MultiIterNew(3, ((void *)__pyx_v_R), ((void *)__pyx_v_Xa), ((void *)__pyx_v_Ya)); if (unlikely(!__pyx_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 281; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  if (!(__Pyx_TypeTest(__pyx_3, __pyx_ptype_4nipy_9neurospin_8register_8routines_broadcast))) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 281; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_DECREF(((PyObject *)__pyx_v_multi));
-  __pyx_v_multi = ((PyArrayMultiIterObject *)__pyx_3);
-  __pyx_3 = 0;
-
-  /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":282
- *     Ya = np.reshape(Y, R.shape).astype('double')
- *     multi = PyArray_MultiIterNew(3, <void*>R, <void*>Xa, <void*>Ya)
- *     while(multi.index < multi.size):             # <<<<<<<<<<<<<<
- *         r = <double*>PyArray_MultiIter_DATA(multi, 0)
- *         x = <double*>PyArray_MultiIter_DATA(multi, 1)
- */
-  while (1) {
-    __pyx_4 = (__pyx_v_multi->index < __pyx_v_multi->size);
-    if (!__pyx_4) break;
-
-    /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":283
- *     multi = PyArray_MultiIterNew(3, <void*>R, <void*>Xa, <void*>Ya)
- *     while(multi.index < multi.size):
- *         r = <double*>PyArray_MultiIter_DATA(multi, 0)             # <<<<<<<<<<<<<<
- *         x = <double*>PyArray_MultiIter_DATA(multi, 1)
- *         y = <double*>PyArray_MultiIter_DATA(multi, 2)
- */
-    __pyx_v_r = ((double *)PyArray_MultiIter_DATA(__pyx_v_multi, 0));
-
-    /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":284
- *     while(multi.index < multi.size):
- *         r = <double*>PyArray_MultiIter_DATA(multi, 0)
- *         x = <double*>PyArray_MultiIter_DATA(multi, 1)             # <<<<<<<<<<<<<<
- *         y = <double*>PyArray_MultiIter_DATA(multi, 2)
- *         r[0] = cubic_spline_sample2d(x[0], y[0], C)
- */
-    __pyx_v_x = ((double *)PyArray_MultiIter_DATA(__pyx_v_multi, 1));
-
-    /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":285
- *         r = <double*>PyArray_MultiIter_DATA(multi, 0)
- *         x = <double*>PyArray_MultiIter_DATA(multi, 1)
- *         y = <double*>PyArray_MultiIter_DATA(multi, 2)             # <<<<<<<<<<<<<<
- *         r[0] = cubic_spline_sample2d(x[0], y[0], C)
- *         PyArray_MultiIter_NEXT(multi)
- */
-    __pyx_v_y = ((double *)PyArray_MultiIter_DATA(__pyx_v_multi, 2));
-
-    /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":286
- *         x = <double*>PyArray_MultiIter_DATA(multi, 1)
- *         y = <double*>PyArray_MultiIter_DATA(multi, 2)
- *         r[0] = cubic_spline_sample2d(x[0], y[0], C)             # <<<<<<<<<<<<<<
- *         PyArray_MultiIter_NEXT(multi)
- *     return R
- */
-    (__pyx_v_r[0]) = cubic_spline_sample2d((__pyx_v_x[0]), (__pyx_v_y[0]), __pyx_v_C);
-
-    /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":287
- *         y = <double*>PyArray_MultiIter_DATA(multi, 2)
- *         r[0] = cubic_spline_sample2d(x[0], y[0], C)
- *         PyArray_MultiIter_NEXT(multi)             # <<<<<<<<<<<<<<
- *     return R
- * 
- */
-    PyArray_MultiIter_NEXT(__pyx_v_multi);
-  }
-
-  /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":288
- *         r[0] = cubic_spline_sample2d(x[0], y[0], C)
- *         PyArray_MultiIter_NEXT(multi)
- *     return R             # <<<<<<<<<<<<<<
- * 
- * def cspline_sample3d(ndarray R, ndarray C, X=0, Y=0, Z=0):
- */
-  Py_INCREF(((PyObject *)__pyx_v_R));
-  __pyx_r = ((PyObject *)__pyx_v_R);
-  goto __pyx_L0;
-
-  __pyx_r = Py_None; Py_INCREF(Py_None);
-  goto __pyx_L0;
-  __pyx_L1_error:;
-  Py_XDECREF(__pyx_1);
-  Py_XDECREF(__pyx_2);
-  Py_XDECREF(__pyx_3);
-  __Pyx_AddTraceback("nipy.neurospin.register.routines.cspline_sample2d");
-  __pyx_r = NULL;
-  __pyx_L0:;
-  Py_DECREF(__pyx_v_multi);
-  Py_DECREF(__pyx_v_Xa);
-  Py_DECREF(__pyx_v_Ya);
-  return __pyx_r;
-}
-
-/* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":290
- *     return R
- * 
- * def cspline_sample3d(ndarray R, ndarray C, X=0, Y=0, Z=0):             # <<<<<<<<<<<<<<
- *     cdef double *r, *x, *y, *z
- *     cdef broadcast multi
- */
-
-static PyObject *__pyx_pf_4nipy_9neurospin_8register_8routines_cspline_sample3d(PyObject *__pyx_self, PyObject *__pyx_args, PyObject *__pyx_kwds); /*proto*/
-static PyObject *__pyx_pf_4nipy_9neurospin_8register_8routines_cspline_sample3d(PyObject *__pyx_self, PyObject *__pyx_args, PyObject *__pyx_kwds) {
-  PyArrayObject *__pyx_v_R = 0;
-  PyArrayObject *__pyx_v_C = 0;
-  PyObject *__pyx_v_X = 0;
-  PyObject *__pyx_v_Y = 0;
-  PyObject *__pyx_v_Z = 0;
-  double *__pyx_v_r;
-  double *__pyx_v_x;
-  double *__pyx_v_y;
-  double *__pyx_v_z;
-  PyArrayMultiIterObject *__pyx_v_multi;
-  PyObject *__pyx_v_Xa;
-  PyObject *__pyx_v_Ya;
-  PyObject *__pyx_v_Za;
-  PyObject *__pyx_r;
-  PyObject *__pyx_1 = 0;
-  PyObject *__pyx_2 = 0;
-  PyObject *__pyx_3 = 0;
-  int __pyx_4;
-  static PyObject **__pyx_pyargnames[] = {&__pyx_kp_R,&__pyx_kp_C,&__pyx_kp_X,&__pyx_kp_Y,&__pyx_kp_Z,0};
-  __pyx_self = __pyx_self;
-  __pyx_v_X = __pyx_int_0;
-  __pyx_v_Y = __pyx_int_0;
-  __pyx_v_Z = __pyx_int_0;
-  if (unlikely(__pyx_kwds)) {
-    PyObject* values[5] = {0,0,0,0,0};
-    Py_ssize_t kw_args = PyDict_Size(__pyx_kwds);
-    switch (PyTuple_GET_SIZE(__pyx_args)) {
-      case  5: values[4] = PyTuple_GET_ITEM(__pyx_args, 4);
-      case  4: values[3] = PyTuple_GET_ITEM(__pyx_args, 3);
-      case  3: values[2] = PyTuple_GET_ITEM(__pyx_args, 2);
-      case  2: values[1] = PyTuple_GET_ITEM(__pyx_args, 1);
-      case  1: values[0] = PyTuple_GET_ITEM(__pyx_args, 0);
-      case  0: break;
-      default: goto __pyx_L5_argtuple_error;
-    }
-    switch (PyTuple_GET_SIZE(__pyx_args)) {
-      case  0:
-      values[0] = PyDict_GetItem(__pyx_kwds, __pyx_kp_R);
-      if (likely(values[0])) kw_args--;
-      else goto __pyx_L5_argtuple_error;
-      case  1:
-      values[1] = PyDict_GetItem(__pyx_kwds, __pyx_kp_C);
-      if (likely(values[1])) kw_args--;
-      else {
-        __Pyx_RaiseArgtupleInvalid("cspline_sample3d", 0, 2, 5, 1); {__pyx_filename = __pyx_f[0]; __pyx_lineno = 290; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-      }
-    }
-    if (unlikely(kw_args > 0)) {
-      if (unlikely(__Pyx_ParseOptionalKeywords(__pyx_kwds, __pyx_pyargnames, 0, values, PyTuple_GET_SIZE(__pyx_args), "cspline_sample3d") < 0)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 290; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-    }
-    __pyx_v_R = ((PyArrayObject *)values[0]);
-    __pyx_v_C = ((PyArrayObject *)values[1]);
-    if (values[2]) {
-      __pyx_v_X = values[2];
-    }
-    if (values[3]) {
-      __pyx_v_Y = values[3];
-    }
-    if (values[4]) {
-      __pyx_v_Z = values[4];
-    }
-  } else {
-    switch (PyTuple_GET_SIZE(__pyx_args)) {
-      case  5:
-      __pyx_v_Z = PyTuple_GET_ITEM(__pyx_args, 4);
-      case  4:
-      __pyx_v_Y = PyTuple_GET_ITEM(__pyx_args, 3);
-      case  3:
-      __pyx_v_X = PyTuple_GET_ITEM(__pyx_args, 2);
-      case  2:
-      __pyx_v_C = ((PyArrayObject *)PyTuple_GET_ITEM(__pyx_args, 1));
-      __pyx_v_R = ((PyArrayObject *)PyTuple_GET_ITEM(__pyx_args, 0));
-      break;
-      default: goto __pyx_L5_argtuple_error;
-    }
-  }
-  goto __pyx_L4_argument_unpacking_done;
-  __pyx_L5_argtuple_error:;
-  __Pyx_RaiseArgtupleInvalid("cspline_sample3d", 0, 2, 5, PyTuple_GET_SIZE(__pyx_args)); {__pyx_filename = __pyx_f[0]; __pyx_lineno = 290; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-  __pyx_L3_error:;
-  __Pyx_AddTraceback("nipy.neurospin.register.routines.cspline_sample3d");
-  return NULL;
-  __pyx_L4_argument_unpacking_done:;
-  __pyx_v_multi = ((PyArrayMultiIterObject *)Py_None); Py_INCREF(Py_None);
-  __pyx_v_Xa = Py_None; Py_INCREF(Py_None);
-  __pyx_v_Ya = Py_None; Py_INCREF(Py_None);
-  __pyx_v_Za = Py_None; Py_INCREF(Py_None);
-  if (unlikely(!__Pyx_ArgTypeTest(((PyObject *)__pyx_v_R), __pyx_ptype_4nipy_9neurospin_8register_8routines_ndarray, 1, "R", 0))) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 290; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  if (unlikely(!__Pyx_ArgTypeTest(((PyObject *)__pyx_v_C), __pyx_ptype_4nipy_9neurospin_8register_8routines_ndarray, 1, "C", 0))) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 290; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-
-  /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":293
- *     cdef double *r, *x, *y, *z
- *     cdef broadcast multi
- *     Xa = np.reshape(X, R.shape).astype('double')             # <<<<<<<<<<<<<<
- *     Ya = np.reshape(Y, R.shape).astype('double')
- *     Za = np.reshape(Z, R.shape).astype('double')
- */
-  __pyx_1 = __Pyx_GetName(__pyx_m, __pyx_kp_np); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 293; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __pyx_2 = PyObject_GetAttr(__pyx_1, __pyx_kp_reshape); if (unlikely(!__pyx_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 293; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_DECREF(__pyx_1); __pyx_1 = 0;
-  __pyx_1 = PyObject_GetAttr(((PyObject *)__pyx_v_R), __pyx_kp_shape); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 293; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __pyx_3 = PyTuple_New(2); if (unlikely(!__pyx_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 293; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_INCREF(__pyx_v_X);
-  PyTuple_SET_ITEM(__pyx_3, 0, __pyx_v_X);
-  PyTuple_SET_ITEM(__pyx_3, 1, __pyx_1);
-  __pyx_1 = 0;
-  __pyx_1 = PyObject_Call(__pyx_2, ((PyObject *)__pyx_3), NULL); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 293; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_DECREF(__pyx_2); __pyx_2 = 0;
-  Py_DECREF(((PyObject *)__pyx_3)); __pyx_3 = 0;
-  __pyx_2 = PyObject_GetAttr(__pyx_1, __pyx_kp_astype); if (unlikely(!__pyx_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 293; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_DECREF(__pyx_1); __pyx_1 = 0;
-  __pyx_3 = PyTuple_New(1); if (unlikely(!__pyx_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 293; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_INCREF(__pyx_kp_56);
-  PyTuple_SET_ITEM(__pyx_3, 0, __pyx_kp_56);
-  __pyx_1 = PyObject_Call(__pyx_2, ((PyObject *)__pyx_3), NULL); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 293; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_DECREF(__pyx_2); __pyx_2 = 0;
-  Py_DECREF(((PyObject *)__pyx_3)); __pyx_3 = 0;
-  Py_DECREF(__pyx_v_Xa);
-  __pyx_v_Xa = __pyx_1;
-  __pyx_1 = 0;
-
-  /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":294
- *     cdef broadcast multi
- *     Xa = np.reshape(X, R.shape).astype('double')
- *     Ya = np.reshape(Y, R.shape).astype('double')             # <<<<<<<<<<<<<<
- *     Za = np.reshape(Z, R.shape).astype('double')
- *     multi = PyArray_MultiIterNew(4, <void*>R, <void*>Xa, <void*>Ya, <void*>Za)
- */
-  __pyx_2 = __Pyx_GetName(__pyx_m, __pyx_kp_np); if (unlikely(!__pyx_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 294; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __pyx_3 = PyObject_GetAttr(__pyx_2, __pyx_kp_reshape); if (unlikely(!__pyx_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 294; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_DECREF(__pyx_2); __pyx_2 = 0;
-  __pyx_1 = PyObject_GetAttr(((PyObject *)__pyx_v_R), __pyx_kp_shape); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 294; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __pyx_2 = PyTuple_New(2); if (unlikely(!__pyx_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 294; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_INCREF(__pyx_v_Y);
-  PyTuple_SET_ITEM(__pyx_2, 0, __pyx_v_Y);
-  PyTuple_SET_ITEM(__pyx_2, 1, __pyx_1);
-  __pyx_1 = 0;
-  __pyx_1 = PyObject_Call(__pyx_3, ((PyObject *)__pyx_2), NULL); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 294; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_DECREF(__pyx_3); __pyx_3 = 0;
-  Py_DECREF(((PyObject *)__pyx_2)); __pyx_2 = 0;
-  __pyx_3 = PyObject_GetAttr(__pyx_1, __pyx_kp_astype); if (unlikely(!__pyx_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 294; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_DECREF(__pyx_1); __pyx_1 = 0;
-  __pyx_2 = PyTuple_New(1); if (unlikely(!__pyx_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 294; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_INCREF(__pyx_kp_57);
-  PyTuple_SET_ITEM(__pyx_2, 0, __pyx_kp_57);
-  __pyx_1 = PyObject_Call(__pyx_3, ((PyObject *)__pyx_2), NULL); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 294; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_DECREF(__pyx_3); __pyx_3 = 0;
-  Py_DECREF(((PyObject *)__pyx_2)); __pyx_2 = 0;
-  Py_DECREF(__pyx_v_Ya);
-  __pyx_v_Ya = __pyx_1;
-  __pyx_1 = 0;
-
-  /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":295
- *     Xa = np.reshape(X, R.shape).astype('double')
- *     Ya = np.reshape(Y, R.shape).astype('double')
- *     Za = np.reshape(Z, R.shape).astype('double')             # <<<<<<<<<<<<<<
- *     multi = PyArray_MultiIterNew(4, <void*>R, <void*>Xa, <void*>Ya, <void*>Za)
- *     while(multi.index < multi.size):
- */
-  __pyx_3 = __Pyx_GetName(__pyx_m, __pyx_kp_np); if (unlikely(!__pyx_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 295; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __pyx_2 = PyObject_GetAttr(__pyx_3, __pyx_kp_reshape); if (unlikely(!__pyx_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 295; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_DECREF(__pyx_3); __pyx_3 = 0;
-  __pyx_1 = PyObject_GetAttr(((PyObject *)__pyx_v_R), __pyx_kp_shape); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 295; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __pyx_3 = PyTuple_New(2); if (unlikely(!__pyx_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 295; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_INCREF(__pyx_v_Z);
-  PyTuple_SET_ITEM(__pyx_3, 0, __pyx_v_Z);
-  PyTuple_SET_ITEM(__pyx_3, 1, __pyx_1);
-  __pyx_1 = 0;
-  __pyx_1 = PyObject_Call(__pyx_2, ((PyObject *)__pyx_3), NULL); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 295; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_DECREF(__pyx_2); __pyx_2 = 0;
-  Py_DECREF(((PyObject *)__pyx_3)); __pyx_3 = 0;
-  __pyx_2 = PyObject_GetAttr(__pyx_1, __pyx_kp_astype); if (unlikely(!__pyx_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 295; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_DECREF(__pyx_1); __pyx_1 = 0;
-  __pyx_3 = PyTuple_New(1); if (unlikely(!__pyx_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 295; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_INCREF(__pyx_kp_58);
-  PyTuple_SET_ITEM(__pyx_3, 0, __pyx_kp_58);
-  __pyx_1 = PyObject_Call(__pyx_2, ((PyObject *)__pyx_3), NULL); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 295; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_DECREF(__pyx_2); __pyx_2 = 0;
-  Py_DECREF(((PyObject *)__pyx_3)); __pyx_3 = 0;
-  Py_DECREF(__pyx_v_Za);
-  __pyx_v_Za = __pyx_1;
-  __pyx_1 = 0;
-
-  /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":296
- *     Ya = np.reshape(Y, R.shape).astype('double')
- *     Za = np.reshape(Z, R.shape).astype('double')
- *     multi = PyArray_MultiIterNew(4, <void*>R, <void*>Xa, <void*>Ya, <void*>Za)             # <<<<<<<<<<<<<<
- *     while(multi.index < multi.size):
- *         r = <double*>PyArray_MultiIter_DATA(multi, 0)
- */
-  __pyx_2 = PyArray_MultiIterNew(4, ((void *)__pyx_v_R), ((void *)__pyx_v_Xa), ((void *)__pyx_v_Ya), ((void *)__pyx_v_Za)); if (unlikely(!__pyx_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 296; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  if (!(__Pyx_TypeTest(__pyx_2, __pyx_ptype_4nipy_9neurospin_8register_8routines_broadcast))) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 296; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_DECREF(((PyObject *)__pyx_v_multi));
-  __pyx_v_multi = ((PyArrayMultiIterObject *)__pyx_2);
-  __pyx_2 = 0;
-
-  /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":297
- *     Za = np.reshape(Z, R.shape).astype('double')
- *     multi = PyArray_MultiIterNew(4, <void*>R, <void*>Xa, <void*>Ya, <void*>Za)
- *     while(multi.index < multi.size):             # <<<<<<<<<<<<<<
- *         r = <double*>PyArray_MultiIter_DATA(multi, 0)
- *         x = <double*>PyArray_MultiIter_DATA(multi, 1)
- */
-  while (1) {
-    __pyx_4 = (__pyx_v_multi->index < __pyx_v_multi->size);
-    if (!__pyx_4) break;
-
-    /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":298
- *     multi = PyArray_MultiIterNew(4, <void*>R, <void*>Xa, <void*>Ya, <void*>Za)
- *     while(multi.index < multi.size):
- *         r = <double*>PyArray_MultiIter_DATA(multi, 0)             # <<<<<<<<<<<<<<
- *         x = <double*>PyArray_MultiIter_DATA(multi, 1)
- *         y = <double*>PyArray_MultiIter_DATA(multi, 2)
- */
-    __pyx_v_r = ((double *)PyArray_MultiIter_DATA(__pyx_v_multi, 0));
-
-    /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":299
- *     while(multi.index < multi.size):
- *         r = <double*>PyArray_MultiIter_DATA(multi, 0)
- *         x = <double*>PyArray_MultiIter_DATA(multi, 1)             # <<<<<<<<<<<<<<
- *         y = <double*>PyArray_MultiIter_DATA(multi, 2)
- *         z = <double*>PyArray_MultiIter_DATA(multi, 3)
- */
-    __pyx_v_x = ((double *)PyArray_MultiIter_DATA(__pyx_v_multi, 1));
-
-    /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":300
- *         r = <double*>PyArray_MultiIter_DATA(multi, 0)
- *         x = <double*>PyArray_MultiIter_DATA(multi, 1)
- *         y = <double*>PyArray_MultiIter_DATA(multi, 2)             # <<<<<<<<<<<<<<
- *         z = <double*>PyArray_MultiIter_DATA(multi, 3)
- *         r[0] = cubic_spline_sample3d(x[0], y[0], z[0], C)
- */
-    __pyx_v_y = ((double *)PyArray_MultiIter_DATA(__pyx_v_multi, 2));
-
-    /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":301
- *         x = <double*>PyArray_MultiIter_DATA(multi, 1)
- *         y = <double*>PyArray_MultiIter_DATA(multi, 2)
- *         z = <double*>PyArray_MultiIter_DATA(multi, 3)             # <<<<<<<<<<<<<<
- *         r[0] = cubic_spline_sample3d(x[0], y[0], z[0], C)
- *         PyArray_MultiIter_NEXT(multi)
- */
-    __pyx_v_z = ((double *)PyArray_MultiIter_DATA(__pyx_v_multi, 3));
-
-    /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":302
- *         y = <double*>PyArray_MultiIter_DATA(multi, 2)
- *         z = <double*>PyArray_MultiIter_DATA(multi, 3)
- *         r[0] = cubic_spline_sample3d(x[0], y[0], z[0], C)             # <<<<<<<<<<<<<<
- *         PyArray_MultiIter_NEXT(multi)
- *     return R
- */
-    (__pyx_v_r[0]) = cubic_spline_sample3d((__pyx_v_x[0]), (__pyx_v_y[0]), (__pyx_v_z[0]), __pyx_v_C);
-
-    /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":303
- *         z = <double*>PyArray_MultiIter_DATA(multi, 3)
- *         r[0] = cubic_spline_sample3d(x[0], y[0], z[0], C)
- *         PyArray_MultiIter_NEXT(multi)             # <<<<<<<<<<<<<<
- *     return R
- * 
- */
-    PyArray_MultiIter_NEXT(__pyx_v_multi);
-  }
-
-  /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":304
- *         r[0] = cubic_spline_sample3d(x[0], y[0], z[0], C)
- *         PyArray_MultiIter_NEXT(multi)
- *     return R             # <<<<<<<<<<<<<<
- * 
- * 
- */
-  Py_INCREF(((PyObject *)__pyx_v_R));
-  __pyx_r = ((PyObject *)__pyx_v_R);
-  goto __pyx_L0;
-
-  __pyx_r = Py_None; Py_INCREF(Py_None);
-  goto __pyx_L0;
-  __pyx_L1_error:;
-  Py_XDECREF(__pyx_1);
-  Py_XDECREF(__pyx_2);
-  Py_XDECREF(__pyx_3);
-  __Pyx_AddTraceback("nipy.neurospin.register.routines.cspline_sample3d");
-  __pyx_r = NULL;
-  __pyx_L0:;
-  Py_DECREF(__pyx_v_multi);
-  Py_DECREF(__pyx_v_Xa);
-  Py_DECREF(__pyx_v_Ya);
-  Py_DECREF(__pyx_v_Za);
-  return __pyx_r;
-}
-
-/* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":307
- * 
- * 
- * def cspline_sample4d(ndarray R, ndarray C, X=0, Y=0, Z=0, T=0):             # <<<<<<<<<<<<<<
- *     """
- *     cubic_spline_sample4d(R, C, X=0, Y=0, Z=0, T=0):
- */
-
-static PyObject *__pyx_pf_4nipy_9neurospin_8register_8routines_cspline_sample4d(PyObject *__pyx_self, PyObject *__pyx_args, PyObject *__pyx_kwds); /*proto*/
-static char __pyx_doc_4nipy_9neurospin_8register_8routines_cspline_sample4d[] = "\n    cubic_spline_sample4d(R, C, X=0, Y=0, Z=0, T=0):\n\n    In-place cubic spline sampling. \n    ";
-static PyObject *__pyx_pf_4nipy_9neurospin_8register_8routines_cspline_sample4d(PyObject *__pyx_self, PyObject *__pyx_args, PyObject *__pyx_kwds) {
-  PyArrayObject *__pyx_v_R = 0;
-  PyArrayObject *__pyx_v_C = 0;
-  PyObject *__pyx_v_X = 0;
-  PyObject *__pyx_v_Y = 0;
-  PyObject *__pyx_v_Z = 0;
-  PyObject *__pyx_v_T = 0;
-  double *__pyx_v_r;
-  double *__pyx_v_x;
-  double *__pyx_v_y;
-  double *__pyx_v_z;
-  double *__pyx_v_t;
-  PyArrayMultiIterObject *__pyx_v_multi;
-  PyObject *__pyx_v_Xa;
-  PyObject *__pyx_v_Ya;
-  PyObject *__pyx_v_Za;
-  PyObject *__pyx_v_Ta;
-  PyObject *__pyx_r;
-  PyObject *__pyx_1 = 0;
-  PyObject *__pyx_2 = 0;
-  PyObject *__pyx_3 = 0;
-  int __pyx_4;
-  static PyObject **__pyx_pyargnames[] = {&__pyx_kp_R,&__pyx_kp_C,&__pyx_kp_X,&__pyx_kp_Y,&__pyx_kp_Z,&__pyx_kp_T,0};
-  __pyx_self = __pyx_self;
-  __pyx_v_X = __pyx_int_0;
-  __pyx_v_Y = __pyx_int_0;
-  __pyx_v_Z = __pyx_int_0;
-  __pyx_v_T = __pyx_int_0;
-  if (unlikely(__pyx_kwds)) {
-    PyObject* values[6] = {0,0,0,0,0,0};
-    Py_ssize_t kw_args = PyDict_Size(__pyx_kwds);
-    switch (PyTuple_GET_SIZE(__pyx_args)) {
-      case  6: values[5] = PyTuple_GET_ITEM(__pyx_args, 5);
-      case  5: values[4] = PyTuple_GET_ITEM(__pyx_args, 4);
-      case  4: values[3] = PyTuple_GET_ITEM(__pyx_args, 3);
-      case  3: values[2] = PyTuple_GET_ITEM(__pyx_args, 2);
-      case  2: values[1] = PyTuple_GET_ITEM(__pyx_args, 1);
-      case  1: values[0] = PyTuple_GET_ITEM(__pyx_args, 0);
-      case  0: break;
-      default: goto __pyx_L5_argtuple_error;
-    }
-    switch (PyTuple_GET_SIZE(__pyx_args)) {
-      case  0:
-      values[0] = PyDict_GetItem(__pyx_kwds, __pyx_kp_R);
-      if (likely(values[0])) kw_args--;
-      else goto __pyx_L5_argtuple_error;
-      case  1:
-      values[1] = PyDict_GetItem(__pyx_kwds, __pyx_kp_C);
-      if (likely(values[1])) kw_args--;
-      else {
-        __Pyx_RaiseArgtupleInvalid("cspline_sample4d", 0, 2, 6, 1); {__pyx_filename = __pyx_f[0]; __pyx_lineno = 307; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-      }
-    }
-    if (unlikely(kw_args > 0)) {
-      if (unlikely(__Pyx_ParseOptionalKeywords(__pyx_kwds, __pyx_pyargnames, 0, values, PyTuple_GET_SIZE(__pyx_args), "cspline_sample4d") < 0)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 307; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-    }
-    __pyx_v_R = ((PyArrayObject *)values[0]);
-    __pyx_v_C = ((PyArrayObject *)values[1]);
-    if (values[2]) {
-      __pyx_v_X = values[2];
-    }
-    if (values[3]) {
-      __pyx_v_Y = values[3];
-    }
-    if (values[4]) {
-      __pyx_v_Z = values[4];
-    }
-    if (values[5]) {
-      __pyx_v_T = values[5];
-    }
-  } else {
-    switch (PyTuple_GET_SIZE(__pyx_args)) {
-      case  6:
-      __pyx_v_T = PyTuple_GET_ITEM(__pyx_args, 5);
-      case  5:
-      __pyx_v_Z = PyTuple_GET_ITEM(__pyx_args, 4);
-      case  4:
-      __pyx_v_Y = PyTuple_GET_ITEM(__pyx_args, 3);
-      case  3:
-      __pyx_v_X = PyTuple_GET_ITEM(__pyx_args, 2);
-      case  2:
-      __pyx_v_C = ((PyArrayObject *)PyTuple_GET_ITEM(__pyx_args, 1));
-      __pyx_v_R = ((PyArrayObject *)PyTuple_GET_ITEM(__pyx_args, 0));
-      break;
-      default: goto __pyx_L5_argtuple_error;
-    }
-  }
-  goto __pyx_L4_argument_unpacking_done;
-  __pyx_L5_argtuple_error:;
-  __Pyx_RaiseArgtupleInvalid("cspline_sample4d", 0, 2, 6, PyTuple_GET_SIZE(__pyx_args)); {__pyx_filename = __pyx_f[0]; __pyx_lineno = 307; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-  __pyx_L3_error:;
-  __Pyx_AddTraceback("nipy.neurospin.register.routines.cspline_sample4d");
-  return NULL;
-  __pyx_L4_argument_unpacking_done:;
-  __pyx_v_multi = ((PyArrayMultiIterObject *)Py_None); Py_INCREF(Py_None);
-  __pyx_v_Xa = Py_None; Py_INCREF(Py_None);
-  __pyx_v_Ya = Py_None; Py_INCREF(Py_None);
-  __pyx_v_Za = Py_None; Py_INCREF(Py_None);
-  __pyx_v_Ta = Py_None; Py_INCREF(Py_None);
-  if (unlikely(!__Pyx_ArgTypeTest(((PyObject *)__pyx_v_R), __pyx_ptype_4nipy_9neurospin_8register_8routines_ndarray, 1, "R", 0))) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 307; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  if (unlikely(!__Pyx_ArgTypeTest(((PyObject *)__pyx_v_C), __pyx_ptype_4nipy_9neurospin_8register_8routines_ndarray, 1, "C", 0))) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 307; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-
-  /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":315
- *     cdef double *r, *x, *y, *z, *t
- *     cdef broadcast multi
- *     Xa = np.reshape(X, R.shape).astype('double')             # <<<<<<<<<<<<<<
- *     Ya = np.reshape(Y, R.shape).astype('double')
- *     Za = np.reshape(Z, R.shape).astype('double')
- */
-  __pyx_1 = __Pyx_GetName(__pyx_m, __pyx_kp_np); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 315; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __pyx_2 = PyObject_GetAttr(__pyx_1, __pyx_kp_reshape); if (unlikely(!__pyx_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 315; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_DECREF(__pyx_1); __pyx_1 = 0;
-  __pyx_1 = PyObject_GetAttr(((PyObject *)__pyx_v_R), __pyx_kp_shape); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 315; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __pyx_3 = PyTuple_New(2); if (unlikely(!__pyx_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 315; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_INCREF(__pyx_v_X);
-  PyTuple_SET_ITEM(__pyx_3, 0, __pyx_v_X);
-  PyTuple_SET_ITEM(__pyx_3, 1, __pyx_1);
-  __pyx_1 = 0;
-  __pyx_1 = PyObject_Call(__pyx_2, ((PyObject *)__pyx_3), NULL); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 315; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_DECREF(__pyx_2); __pyx_2 = 0;
-  Py_DECREF(((PyObject *)__pyx_3)); __pyx_3 = 0;
-  __pyx_2 = PyObject_GetAttr(__pyx_1, __pyx_kp_astype); if (unlikely(!__pyx_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 315; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_DECREF(__pyx_1); __pyx_1 = 0;
-  __pyx_3 = PyTuple_New(1); if (unlikely(!__pyx_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 315; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_INCREF(__pyx_kp_59);
-  PyTuple_SET_ITEM(__pyx_3, 0, __pyx_kp_59);
-  __pyx_1 = PyObject_Call(__pyx_2, ((PyObject *)__pyx_3), NULL); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 315; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_DECREF(__pyx_2); __pyx_2 = 0;
-  Py_DECREF(((PyObject *)__pyx_3)); __pyx_3 = 0;
-  Py_DECREF(__pyx_v_Xa);
-  __pyx_v_Xa = __pyx_1;
-  __pyx_1 = 0;
-
-  /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":316
- *     cdef broadcast multi
- *     Xa = np.reshape(X, R.shape).astype('double')
- *     Ya = np.reshape(Y, R.shape).astype('double')             # <<<<<<<<<<<<<<
- *     Za = np.reshape(Z, R.shape).astype('double')
- *     Ta = np.reshape(T, R.shape).astype('double')
- */
-  __pyx_2 = __Pyx_GetName(__pyx_m, __pyx_kp_np); if (unlikely(!__pyx_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 316; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __pyx_3 = PyObject_GetAttr(__pyx_2, __pyx_kp_reshape); if (unlikely(!__pyx_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 316; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_DECREF(__pyx_2); __pyx_2 = 0;
-  __pyx_1 = PyObject_GetAttr(((PyObject *)__pyx_v_R), __pyx_kp_shape); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 316; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __pyx_2 = PyTuple_New(2); if (unlikely(!__pyx_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 316; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_INCREF(__pyx_v_Y);
-  PyTuple_SET_ITEM(__pyx_2, 0, __pyx_v_Y);
-  PyTuple_SET_ITEM(__pyx_2, 1, __pyx_1);
-  __pyx_1 = 0;
-  __pyx_1 = PyObject_Call(__pyx_3, ((PyObject *)__pyx_2), NULL); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 316; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_DECREF(__pyx_3); __pyx_3 = 0;
-  Py_DECREF(((PyObject *)__pyx_2)); __pyx_2 = 0;
-  __pyx_3 = PyObject_GetAttr(__pyx_1, __pyx_kp_astype); if (unlikely(!__pyx_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 316; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_DECREF(__pyx_1); __pyx_1 = 0;
-  __pyx_2 = PyTuple_New(1); if (unlikely(!__pyx_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 316; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_INCREF(__pyx_kp_60);
-  PyTuple_SET_ITEM(__pyx_2, 0, __pyx_kp_60);
-  __pyx_1 = PyObject_Call(__pyx_3, ((PyObject *)__pyx_2), NULL); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 316; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_DECREF(__pyx_3); __pyx_3 = 0;
-  Py_DECREF(((PyObject *)__pyx_2)); __pyx_2 = 0;
-  Py_DECREF(__pyx_v_Ya);
-  __pyx_v_Ya = __pyx_1;
-  __pyx_1 = 0;
-
-  /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":317
- *     Xa = np.reshape(X, R.shape).astype('double')
- *     Ya = np.reshape(Y, R.shape).astype('double')
- *     Za = np.reshape(Z, R.shape).astype('double')             # <<<<<<<<<<<<<<
- *     Ta = np.reshape(T, R.shape).astype('double')
- *     multi = PyArray_MultiIterNew(5, <void*>R, <void*>Xa, <void*>Ya, <void*>Za, <void*>Ta)
- */
-  __pyx_3 = __Pyx_GetName(__pyx_m, __pyx_kp_np); if (unlikely(!__pyx_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 317; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __pyx_2 = PyObject_GetAttr(__pyx_3, __pyx_kp_reshape); if (unlikely(!__pyx_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 317; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_DECREF(__pyx_3); __pyx_3 = 0;
-  __pyx_1 = PyObject_GetAttr(((PyObject *)__pyx_v_R), __pyx_kp_shape); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 317; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __pyx_3 = PyTuple_New(2); if (unlikely(!__pyx_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 317; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_INCREF(__pyx_v_Z);
-  PyTuple_SET_ITEM(__pyx_3, 0, __pyx_v_Z);
-  PyTuple_SET_ITEM(__pyx_3, 1, __pyx_1);
-  __pyx_1 = 0;
-  __pyx_1 = PyObject_Call(__pyx_2, ((PyObject *)__pyx_3), NULL); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 317; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_DECREF(__pyx_2); __pyx_2 = 0;
-  Py_DECREF(((PyObject *)__pyx_3)); __pyx_3 = 0;
-  __pyx_2 = PyObject_GetAttr(__pyx_1, __pyx_kp_astype); if (unlikely(!__pyx_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 317; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_DECREF(__pyx_1); __pyx_1 = 0;
-  __pyx_3 = PyTuple_New(1); if (unlikely(!__pyx_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 317; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_INCREF(__pyx_kp_61);
-  PyTuple_SET_ITEM(__pyx_3, 0, __pyx_kp_61);
-  __pyx_1 = PyObject_Call(__pyx_2, ((PyObject *)__pyx_3), NULL); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 317; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_DECREF(__pyx_2); __pyx_2 = 0;
-  Py_DECREF(((PyObject *)__pyx_3)); __pyx_3 = 0;
-  Py_DECREF(__pyx_v_Za);
-  __pyx_v_Za = __pyx_1;
-  __pyx_1 = 0;
-
-  /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":318
- *     Ya = np.reshape(Y, R.shape).astype('double')
- *     Za = np.reshape(Z, R.shape).astype('double')
- *     Ta = np.reshape(T, R.shape).astype('double')             # <<<<<<<<<<<<<<
- *     multi = PyArray_MultiIterNew(5, <void*>R, <void*>Xa, <void*>Ya, <void*>Za, <void*>Ta)
- *     while(multi.index < multi.size):
- */
-  __pyx_2 = __Pyx_GetName(__pyx_m, __pyx_kp_np); if (unlikely(!__pyx_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 318; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __pyx_3 = PyObject_GetAttr(__pyx_2, __pyx_kp_reshape); if (unlikely(!__pyx_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 318; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_DECREF(__pyx_2); __pyx_2 = 0;
-  __pyx_1 = PyObject_GetAttr(((PyObject *)__pyx_v_R), __pyx_kp_shape); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 318; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __pyx_2 = PyTuple_New(2); if (unlikely(!__pyx_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 318; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_INCREF(__pyx_v_T);
-  PyTuple_SET_ITEM(__pyx_2, 0, __pyx_v_T);
-  PyTuple_SET_ITEM(__pyx_2, 1, __pyx_1);
-  __pyx_1 = 0;
-  __pyx_1 = PyObject_Call(__pyx_3, ((PyObject *)__pyx_2), NULL); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 318; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_DECREF(__pyx_3); __pyx_3 = 0;
-  Py_DECREF(((PyObject *)__pyx_2)); __pyx_2 = 0;
-  __pyx_3 = PyObject_GetAttr(__pyx_1, __pyx_kp_astype); if (unlikely(!__pyx_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 318; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_DECREF(__pyx_1); __pyx_1 = 0;
-  __pyx_2 = PyTuple_New(1); if (unlikely(!__pyx_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 318; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_INCREF(__pyx_kp_62);
-  PyTuple_SET_ITEM(__pyx_2, 0, __pyx_kp_62);
-  __pyx_1 = PyObject_Call(__pyx_3, ((PyObject *)__pyx_2), NULL); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 318; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_DECREF(__pyx_3); __pyx_3 = 0;
-  Py_DECREF(((PyObject *)__pyx_2)); __pyx_2 = 0;
-  Py_DECREF(__pyx_v_Ta);
-  __pyx_v_Ta = __pyx_1;
-  __pyx_1 = 0;
-
-  /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":319
- *     Za = np.reshape(Z, R.shape).astype('double')
- *     Ta = np.reshape(T, R.shape).astype('double')
- *     multi = PyArray_MultiIterNew(5, <void*>R, <void*>Xa, <void*>Ya, <void*>Za, <void*>Ta)             # <<<<<<<<<<<<<<
- *     while(multi.index < multi.size):
- *         r = <double*>PyArray_MultiIter_DATA(multi, 0)
- */
-  __pyx_3 = PyArray_MultiIterNew(5, ((void *)__pyx_v_R), ((void *)__pyx_v_Xa), ((void *)__pyx_v_Ya), ((void *)__pyx_v_Za), ((void *)__pyx_v_Ta)); if (unlikely(!__pyx_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 319; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  if (!(__Pyx_TypeTest(__pyx_3, __pyx_ptype_4nipy_9neurospin_8register_8routines_broadcast))) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 319; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_DECREF(((PyObject *)__pyx_v_multi));
-  __pyx_v_multi = ((PyArrayMultiIterObject *)__pyx_3);
-  __pyx_3 = 0;
-
-  /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":320
- *     Ta = np.reshape(T, R.shape).astype('double')
- *     multi = PyArray_MultiIterNew(5, <void*>R, <void*>Xa, <void*>Ya, <void*>Za, <void*>Ta)
- *     while(multi.index < multi.size):             # <<<<<<<<<<<<<<
- *         r = <double*>PyArray_MultiIter_DATA(multi, 0)
- *         x = <double*>PyArray_MultiIter_DATA(multi, 1)
- */
-  while (1) {
-    __pyx_4 = (__pyx_v_multi->index < __pyx_v_multi->size);
-    if (!__pyx_4) break;
-
-    /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":321
- *     multi = PyArray_MultiIterNew(5, <void*>R, <void*>Xa, <void*>Ya, <void*>Za, <void*>Ta)
- *     while(multi.index < multi.size):
- *         r = <double*>PyArray_MultiIter_DATA(multi, 0)             # <<<<<<<<<<<<<<
- *         x = <double*>PyArray_MultiIter_DATA(multi, 1)
- *         y = <double*>PyArray_MultiIter_DATA(multi, 2)
- */
-    __pyx_v_r = ((double *)PyArray_MultiIter_DATA(__pyx_v_multi, 0));
-
-    /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":322
- *     while(multi.index < multi.size):
- *         r = <double*>PyArray_MultiIter_DATA(multi, 0)
- *         x = <double*>PyArray_MultiIter_DATA(multi, 1)             # <<<<<<<<<<<<<<
- *         y = <double*>PyArray_MultiIter_DATA(multi, 2)
- *         z = <double*>PyArray_MultiIter_DATA(multi, 3)
- */
-    __pyx_v_x = ((double *)PyArray_MultiIter_DATA(__pyx_v_multi, 1));
-
-    /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":323
- *         r = <double*>PyArray_MultiIter_DATA(multi, 0)
- *         x = <double*>PyArray_MultiIter_DATA(multi, 1)
- *         y = <double*>PyArray_MultiIter_DATA(multi, 2)             # <<<<<<<<<<<<<<
- *         z = <double*>PyArray_MultiIter_DATA(multi, 3)
- *         t = <double*>PyArray_MultiIter_DATA(multi, 4)
- */
-    __pyx_v_y = ((double *)PyArray_MultiIter_DATA(__pyx_v_multi, 2));
-
-    /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":324
- *         x = <double*>PyArray_MultiIter_DATA(multi, 1)
- *         y = <double*>PyArray_MultiIter_DATA(multi, 2)
- *         z = <double*>PyArray_MultiIter_DATA(multi, 3)             # <<<<<<<<<<<<<<
- *         t = <double*>PyArray_MultiIter_DATA(multi, 4)
- *         r[0] = cubic_spline_sample4d(x[0], y[0], z[0], t[0], C)
- */
-    __pyx_v_z = ((double *)PyArray_MultiIter_DATA(__pyx_v_multi, 3));
-
-    /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":325
- *         y = <double*>PyArray_MultiIter_DATA(multi, 2)
- *         z = <double*>PyArray_MultiIter_DATA(multi, 3)
- *         t = <double*>PyArray_MultiIter_DATA(multi, 4)             # <<<<<<<<<<<<<<
- *         r[0] = cubic_spline_sample4d(x[0], y[0], z[0], t[0], C)
- *         PyArray_MultiIter_NEXT(multi)
- */
-    __pyx_v_t = ((double *)PyArray_MultiIter_DATA(__pyx_v_multi, 4));
-
-    /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":326
- *         z = <double*>PyArray_MultiIter_DATA(multi, 3)
- *         t = <double*>PyArray_MultiIter_DATA(multi, 4)
- *         r[0] = cubic_spline_sample4d(x[0], y[0], z[0], t[0], C)             # <<<<<<<<<<<<<<
- *         PyArray_MultiIter_NEXT(multi)
- *     return R
- */
-    (__pyx_v_r[0]) = cubic_spline_sample4d((__pyx_v_x[0]), (__pyx_v_y[0]), (__pyx_v_z[0]), (__pyx_v_t[0]), __pyx_v_C);
-
-    /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":327
- *         t = <double*>PyArray_MultiIter_DATA(multi, 4)
- *         r[0] = cubic_spline_sample4d(x[0], y[0], z[0], t[0], C)
- *         PyArray_MultiIter_NEXT(multi)             # <<<<<<<<<<<<<<
- *     return R
- * 
- */
-    PyArray_MultiIter_NEXT(__pyx_v_multi);
-  }
-
-  /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":328
- *         r[0] = cubic_spline_sample4d(x[0], y[0], z[0], t[0], C)
- *         PyArray_MultiIter_NEXT(multi)
- *     return R             # <<<<<<<<<<<<<<
- * 
- * 
- */
-  Py_INCREF(((PyObject *)__pyx_v_R));
-  __pyx_r = ((PyObject *)__pyx_v_R);
-  goto __pyx_L0;
-
-  __pyx_r = Py_None; Py_INCREF(Py_None);
-  goto __pyx_L0;
-  __pyx_L1_error:;
-  Py_XDECREF(__pyx_1);
-  Py_XDECREF(__pyx_2);
-  Py_XDECREF(__pyx_3);
-  __Pyx_AddTraceback("nipy.neurospin.register.routines.cspline_sample4d");
-  __pyx_r = NULL;
-  __pyx_L0:;
-  Py_DECREF(__pyx_v_multi);
-  Py_DECREF(__pyx_v_Xa);
-  Py_DECREF(__pyx_v_Ya);
-  Py_DECREF(__pyx_v_Za);
-  Py_DECREF(__pyx_v_Ta);
-  return __pyx_r;
-}
-
-/* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":331
- * 
- * 
- * def cspline_resample(ndarray im, dims, ndarray Tvox, dtype=None):             # <<<<<<<<<<<<<<
- *     """
- *     cspline_resample(im, dims, Tvox, dtype=None)
- */
-
-static PyObject *__pyx_pf_4nipy_9neurospin_8register_8routines_cspline_resample(PyObject *__pyx_self, PyObject *__pyx_args, PyObject *__pyx_kwds); /*proto*/
-static char __pyx_doc_4nipy_9neurospin_8register_8routines_cspline_resample[] = "\n    cspline_resample(im, dims, Tvox, dtype=None)\n\n    Note that the input transformation Tvox will be re-ordered in C\n    convention if needed.\n    ";
-static PyObject *__pyx_pf_4nipy_9neurospin_8register_8routines_cspline_resample(PyObject *__pyx_self, PyObject *__pyx_args, PyObject *__pyx_kwds) {
-  PyArrayObject *__pyx_v_im = 0;
-  PyObject *__pyx_v_dims = 0;
-  PyArrayObject *__pyx_v_Tvox = 0;
-  PyObject *__pyx_v_dtype = 0;
-  double *__pyx_v_tvox;
-  int __pyx_v_cast_integer;
-  PyObject *__pyx_v_im_resampled;
-  PyObject *__pyx_r;
-  PyObject *__pyx_1 = 0;
-  int __pyx_2;
-  PyObject *__pyx_3 = 0;
-  PyObject *__pyx_4 = 0;
-  PyObject *__pyx_5 = 0;
-  int __pyx_6;
-  static PyObject **__pyx_pyargnames[] = {&__pyx_kp_im,&__pyx_kp_dims,&__pyx_kp_Tvox,&__pyx_kp_dtype,0};
-  __pyx_self = __pyx_self;
-  __pyx_v_dtype = Py_None;
-  if (unlikely(__pyx_kwds)) {
-    PyObject* values[4] = {0,0,0,0};
-    Py_ssize_t kw_args = PyDict_Size(__pyx_kwds);
-    switch (PyTuple_GET_SIZE(__pyx_args)) {
-      case  4: values[3] = PyTuple_GET_ITEM(__pyx_args, 3);
-      case  3: values[2] = PyTuple_GET_ITEM(__pyx_args, 2);
-      case  2: values[1] = PyTuple_GET_ITEM(__pyx_args, 1);
-      case  1: values[0] = PyTuple_GET_ITEM(__pyx_args, 0);
-      case  0: break;
-      default: goto __pyx_L5_argtuple_error;
-    }
-    switch (PyTuple_GET_SIZE(__pyx_args)) {
-      case  0:
-      values[0] = PyDict_GetItem(__pyx_kwds, __pyx_kp_im);
-      if (likely(values[0])) kw_args--;
-      else goto __pyx_L5_argtuple_error;
-      case  1:
-      values[1] = PyDict_GetItem(__pyx_kwds, __pyx_kp_dims);
-      if (likely(values[1])) kw_args--;
-      else {
-        __Pyx_RaiseArgtupleInvalid("cspline_resample", 0, 3, 4, 1); {__pyx_filename = __pyx_f[0]; __pyx_lineno = 331; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-      }
-      case  2:
-      values[2] = PyDict_GetItem(__pyx_kwds, __pyx_kp_Tvox);
-      if (likely(values[2])) kw_args--;
-      else {
-        __Pyx_RaiseArgtupleInvalid("cspline_resample", 0, 3, 4, 2); {__pyx_filename = __pyx_f[0]; __pyx_lineno = 331; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-      }
-    }
-    if (unlikely(kw_args > 0)) {
-      if (unlikely(__Pyx_ParseOptionalKeywords(__pyx_kwds, __pyx_pyargnames, 0, values, PyTuple_GET_SIZE(__pyx_args), "cspline_resample") < 0)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 331; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-    }
-    __pyx_v_im = ((PyArrayObject *)values[0]);
-    __pyx_v_dims = values[1];
-    __pyx_v_Tvox = ((PyArrayObject *)values[2]);
-    if (values[3]) {
-      __pyx_v_dtype = values[3];
-    }
-  } else {
-    switch (PyTuple_GET_SIZE(__pyx_args)) {
-      case  4:
-      __pyx_v_dtype = PyTuple_GET_ITEM(__pyx_args, 3);
-      case  3:
-      __pyx_v_Tvox = ((PyArrayObject *)PyTuple_GET_ITEM(__pyx_args, 2));
-      __pyx_v_dims = PyTuple_GET_ITEM(__pyx_args, 1);
-      __pyx_v_im = ((PyArrayObject *)PyTuple_GET_ITEM(__pyx_args, 0));
-      break;
-      default: goto __pyx_L5_argtuple_error;
-    }
-  }
-  goto __pyx_L4_argument_unpacking_done;
-  __pyx_L5_argtuple_error:;
-  __Pyx_RaiseArgtupleInvalid("cspline_resample", 0, 3, 4, PyTuple_GET_SIZE(__pyx_args)); {__pyx_filename = __pyx_f[0]; __pyx_lineno = 331; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-  __pyx_L3_error:;
-  __Pyx_AddTraceback("nipy.neurospin.register.routines.cspline_resample");
-  return NULL;
-  __pyx_L4_argument_unpacking_done:;
-  Py_INCREF(__pyx_v_Tvox);
-  Py_INCREF(__pyx_v_dtype);
-  __pyx_v_im_resampled = Py_None; Py_INCREF(Py_None);
-  if (unlikely(!__Pyx_ArgTypeTest(((PyObject *)__pyx_v_im), __pyx_ptype_4nipy_9neurospin_8register_8routines_ndarray, 1, "im", 0))) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 331; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  if (unlikely(!__Pyx_ArgTypeTest(((PyObject *)__pyx_v_Tvox), __pyx_ptype_4nipy_9neurospin_8register_8routines_ndarray, 1, "Tvox", 0))) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 331; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-
-  /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":342
- * 
- *     # Create output array
- *     if dtype == None:             # <<<<<<<<<<<<<<
- *         dtype = im.dtype
- *     im_resampled = np.zeros(tuple(dims), dtype=dtype)
- */
-  __pyx_1 = PyObject_RichCompare(__pyx_v_dtype, Py_None, Py_EQ); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 342; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __pyx_2 = __Pyx_PyObject_IsTrue(__pyx_1); if (unlikely(__pyx_2 < 0)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 342; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_DECREF(__pyx_1); __pyx_1 = 0;
-  if (__pyx_2) {
-
-    /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":343
- *     # Create output array
- *     if dtype == None:
- *         dtype = im.dtype             # <<<<<<<<<<<<<<
- *     im_resampled = np.zeros(tuple(dims), dtype=dtype)
- * 
- */
-    __pyx_1 = PyObject_GetAttr(((PyObject *)__pyx_v_im), __pyx_kp_dtype); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 343; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_DECREF(__pyx_v_dtype);
-    __pyx_v_dtype = __pyx_1;
-    __pyx_1 = 0;
-    goto __pyx_L6;
-  }
-  __pyx_L6:;
-
-  /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":344
- *     if dtype == None:
- *         dtype = im.dtype
- *     im_resampled = np.zeros(tuple(dims), dtype=dtype)             # <<<<<<<<<<<<<<
- * 
- *     # Ensure that the Tvox array is C-contiguous (required by the
- */
-  __pyx_1 = __Pyx_GetName(__pyx_m, __pyx_kp_np); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 344; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __pyx_3 = PyObject_GetAttr(__pyx_1, __pyx_kp_zeros); if (unlikely(!__pyx_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 344; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_DECREF(__pyx_1); __pyx_1 = 0;
-  __pyx_1 = PyTuple_New(1); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 344; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_INCREF(__pyx_v_dims);
-  PyTuple_SET_ITEM(__pyx_1, 0, __pyx_v_dims);
-  __pyx_4 = PyObject_Call(((PyObject *)((PyObject*)&PyTuple_Type)), ((PyObject *)__pyx_1), NULL); if (unlikely(!__pyx_4)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 344; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_DECREF(((PyObject *)__pyx_1)); __pyx_1 = 0;
-  __pyx_1 = PyTuple_New(1); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 344; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  PyTuple_SET_ITEM(__pyx_1, 0, __pyx_4);
-  __pyx_4 = 0;
-  __pyx_4 = PyDict_New(); if (unlikely(!__pyx_4)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 344; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  if (PyDict_SetItem(__pyx_4, __pyx_kp_dtype, __pyx_v_dtype) < 0) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 344; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __pyx_5 = PyEval_CallObjectWithKeywords(__pyx_3, ((PyObject *)__pyx_1), ((PyObject *)__pyx_4)); if (unlikely(!__pyx_5)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 344; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_DECREF(__pyx_3); __pyx_3 = 0;
-  Py_DECREF(((PyObject *)__pyx_1)); __pyx_1 = 0;
-  Py_DECREF(((PyObject *)__pyx_4)); __pyx_4 = 0;
-  Py_DECREF(__pyx_v_im_resampled);
-  __pyx_v_im_resampled = __pyx_5;
-  __pyx_5 = 0;
-
-  /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":348
- *     # Ensure that the Tvox array is C-contiguous (required by the
- *     # underlying C routine)
- *     Tvox = np.asarray(Tvox, order='C')             # <<<<<<<<<<<<<<
- *     tvox = <double*>Tvox.data
- * 
- */
-  __pyx_3 = __Pyx_GetName(__pyx_m, __pyx_kp_np); if (unlikely(!__pyx_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 348; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __pyx_1 = PyObject_GetAttr(__pyx_3, __pyx_kp_asarray); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 348; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_DECREF(__pyx_3); __pyx_3 = 0;
-  __pyx_4 = PyTuple_New(1); if (unlikely(!__pyx_4)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 348; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_INCREF(((PyObject *)__pyx_v_Tvox));
-  PyTuple_SET_ITEM(__pyx_4, 0, ((PyObject *)__pyx_v_Tvox));
-  __pyx_5 = PyDict_New(); if (unlikely(!__pyx_5)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 348; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  if (PyDict_SetItem(__pyx_5, __pyx_kp_order, __pyx_kp_63) < 0) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 348; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __pyx_3 = PyEval_CallObjectWithKeywords(__pyx_1, ((PyObject *)__pyx_4), ((PyObject *)__pyx_5)); if (unlikely(!__pyx_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 348; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_DECREF(__pyx_1); __pyx_1 = 0;
-  Py_DECREF(((PyObject *)__pyx_4)); __pyx_4 = 0;
-  Py_DECREF(((PyObject *)__pyx_5)); __pyx_5 = 0;
-  if (!(__Pyx_TypeTest(__pyx_3, __pyx_ptype_4nipy_9neurospin_8register_8routines_ndarray))) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 348; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_DECREF(((PyObject *)__pyx_v_Tvox));
-  __pyx_v_Tvox = ((PyArrayObject *)__pyx_3);
-  __pyx_3 = 0;
-
-  /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":349
- *     # underlying C routine)
- *     Tvox = np.asarray(Tvox, order='C')
- *     tvox = <double*>Tvox.data             # <<<<<<<<<<<<<<
- * 
- *     # Actual resampling
- */
-  __pyx_v_tvox = ((double *)__pyx_v_Tvox->data);
-
-  /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":352
- * 
- *     # Actual resampling
- *     cast_integer = np.issubdtype(dtype, int)             # <<<<<<<<<<<<<<
- *     cubic_spline_resample(im_resampled, im, tvox, cast_integer)
- * 
- */
-  __pyx_1 = __Pyx_GetName(__pyx_m, __pyx_kp_np); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 352; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __pyx_4 = PyObject_GetAttr(__pyx_1, __pyx_kp_issubdtype); if (unlikely(!__pyx_4)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 352; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_DECREF(__pyx_1); __pyx_1 = 0;
-  __pyx_5 = PyTuple_New(2); if (unlikely(!__pyx_5)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 352; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_INCREF(__pyx_v_dtype);
-  PyTuple_SET_ITEM(__pyx_5, 0, __pyx_v_dtype);
-  Py_INCREF(((PyObject *)((PyObject*)&PyInt_Type)));
-  PyTuple_SET_ITEM(__pyx_5, 1, ((PyObject *)((PyObject*)&PyInt_Type)));
-  __pyx_3 = PyObject_Call(__pyx_4, ((PyObject *)__pyx_5), NULL); if (unlikely(!__pyx_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 352; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_DECREF(__pyx_4); __pyx_4 = 0;
-  Py_DECREF(((PyObject *)__pyx_5)); __pyx_5 = 0;
-  __pyx_6 = __pyx_PyInt_int(__pyx_3); if (unlikely((__pyx_6 == (int)-1) && PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 352; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_DECREF(__pyx_3); __pyx_3 = 0;
-  __pyx_v_cast_integer = __pyx_6;
-
-  /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":353
- *     # Actual resampling
- *     cast_integer = np.issubdtype(dtype, int)
- *     cubic_spline_resample(im_resampled, im, tvox, cast_integer)             # <<<<<<<<<<<<<<
- * 
- *     return im_resampled
- */
-  if (!(__Pyx_TypeTest(__pyx_v_im_resampled, __pyx_ptype_4nipy_9neurospin_8register_8routines_ndarray))) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 353; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  cubic_spline_resample(((PyArrayObject *)__pyx_v_im_resampled), __pyx_v_im, __pyx_v_tvox, __pyx_v_cast_integer);
-
-  /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":355
- *     cubic_spline_resample(im_resampled, im, tvox, cast_integer)
- * 
- *     return im_resampled             # <<<<<<<<<<<<<<
- * 
- * 
- */
-  Py_INCREF(__pyx_v_im_resampled);
-  __pyx_r = __pyx_v_im_resampled;
-  goto __pyx_L0;
-
-  __pyx_r = Py_None; Py_INCREF(Py_None);
-  goto __pyx_L0;
-  __pyx_L1_error:;
-  Py_XDECREF(__pyx_1);
-  Py_XDECREF(__pyx_3);
-  Py_XDECREF(__pyx_4);
-  Py_XDECREF(__pyx_5);
-  __Pyx_AddTraceback("nipy.neurospin.register.routines.cspline_resample");
-  __pyx_r = NULL;
-  __pyx_L0:;
-  Py_DECREF(__pyx_v_im_resampled);
-  Py_DECREF(__pyx_v_Tvox);
-  Py_DECREF(__pyx_v_dtype);
-  return __pyx_r;
-}
-
-/* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":359
- * 
- * 
- * def slice_time(Z, double tr_slices, slice_order):             # <<<<<<<<<<<<<<
- *     """
- *     Fast routine to compute the time when a slice is acquired given its index
- */
-
-static PyObject *__pyx_pf_4nipy_9neurospin_8register_8routines_slice_time(PyObject *__pyx_self, PyObject *__pyx_args, PyObject *__pyx_kwds); /*proto*/
-static char __pyx_doc_4nipy_9neurospin_8register_8routines_slice_time[] = "\n    Fast routine to compute the time when a slice is acquired given its index\n    ";
-static PyObject *__pyx_pf_4nipy_9neurospin_8register_8routines_slice_time(PyObject *__pyx_self, PyObject *__pyx_args, PyObject *__pyx_kwds) {
-  PyObject *__pyx_v_Z = 0;
-  double __pyx_v_tr_slices;
-  PyObject *__pyx_v_slice_order = 0;
-  double *__pyx_v_z;
-  double *__pyx_v_t;
-  double *__pyx_v_s;
-  double __pyx_v_weight;
-  double __pyx_v_slice_interp;
-  unsigned int __pyx_v_zfloor;
-  unsigned int __pyx_v_cycles;
-  unsigned int __pyx_v_zl;
-  unsigned int __pyx_v_zr;
-  PyArrayMultiIterObject *__pyx_v_multi;
-  unsigned int __pyx_v_nslices;
-  PyObject *__pyx_v_Za;
-  PyObject *__pyx_v_T;
-  PyObject *__pyx_v_S;
-  PyObject *__pyx_r;
-  PyObject *__pyx_1 = 0;
-  PyObject *__pyx_2 = 0;
-  PyObject *__pyx_3 = 0;
-  PyObject *__pyx_4 = 0;
-  unsigned int __pyx_5;
-  int __pyx_6;
-  static PyObject **__pyx_pyargnames[] = {&__pyx_kp_Z,&__pyx_kp_tr_slices,&__pyx_kp_slice_order,0};
-  __pyx_self = __pyx_self;
-  if (unlikely(__pyx_kwds)) {
-    PyObject* values[3] = {0,0,0};
-    Py_ssize_t kw_args = PyDict_Size(__pyx_kwds);
-    switch (PyTuple_GET_SIZE(__pyx_args)) {
-      case  3: values[2] = PyTuple_GET_ITEM(__pyx_args, 2);
-      case  2: values[1] = PyTuple_GET_ITEM(__pyx_args, 1);
-      case  1: values[0] = PyTuple_GET_ITEM(__pyx_args, 0);
-      case  0: break;
-      default: goto __pyx_L5_argtuple_error;
-    }
-    switch (PyTuple_GET_SIZE(__pyx_args)) {
-      case  0:
-      values[0] = PyDict_GetItem(__pyx_kwds, __pyx_kp_Z);
-      if (likely(values[0])) kw_args--;
-      else goto __pyx_L5_argtuple_error;
-      case  1:
-      values[1] = PyDict_GetItem(__pyx_kwds, __pyx_kp_tr_slices);
-      if (likely(values[1])) kw_args--;
-      else {
-        __Pyx_RaiseArgtupleInvalid("slice_time", 1, 3, 3, 1); {__pyx_filename = __pyx_f[0]; __pyx_lineno = 359; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-      }
-      case  2:
-      values[2] = PyDict_GetItem(__pyx_kwds, __pyx_kp_slice_order);
-      if (likely(values[2])) kw_args--;
-      else {
-        __Pyx_RaiseArgtupleInvalid("slice_time", 1, 3, 3, 2); {__pyx_filename = __pyx_f[0]; __pyx_lineno = 359; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-      }
-    }
-    if (unlikely(kw_args > 0)) {
-      if (unlikely(__Pyx_ParseOptionalKeywords(__pyx_kwds, __pyx_pyargnames, 0, values, PyTuple_GET_SIZE(__pyx_args), "slice_time") < 0)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 359; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-    }
-    __pyx_v_Z = values[0];
-    __pyx_v_tr_slices = __pyx_PyFloat_AsDouble(values[1]); if (unlikely(PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 359; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-    __pyx_v_slice_order = values[2];
-  } else if (PyTuple_GET_SIZE(__pyx_args) != 3) {
-    goto __pyx_L5_argtuple_error;
-  } else {
-    __pyx_v_Z = PyTuple_GET_ITEM(__pyx_args, 0);
-    __pyx_v_tr_slices = __pyx_PyFloat_AsDouble(PyTuple_GET_ITEM(__pyx_args, 1)); if (unlikely(PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 359; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-    __pyx_v_slice_order = PyTuple_GET_ITEM(__pyx_args, 2);
-  }
-  goto __pyx_L4_argument_unpacking_done;
-  __pyx_L5_argtuple_error:;
-  __Pyx_RaiseArgtupleInvalid("slice_time", 1, 3, 3, PyTuple_GET_SIZE(__pyx_args)); {__pyx_filename = __pyx_f[0]; __pyx_lineno = 359; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-  __pyx_L3_error:;
-  __Pyx_AddTraceback("nipy.neurospin.register.routines.slice_time");
-  return NULL;
-  __pyx_L4_argument_unpacking_done:;
-  __pyx_v_multi = ((PyArrayMultiIterObject *)Py_None); Py_INCREF(Py_None);
-  __pyx_v_Za = Py_None; Py_INCREF(Py_None);
-  __pyx_v_T = Py_None; Py_INCREF(Py_None);
-  __pyx_v_S = Py_None; Py_INCREF(Py_None);
-
-  /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":369
- *     cdef unsigned int nslices
- * 
- *     Za = np.asarray(Z, dtype='double')             # <<<<<<<<<<<<<<
- *     T = np.zeros(Za.shape, dtype='double')
- *     S = np.ascontiguousarray(slice_order, dtype='double')
- */
-  __pyx_1 = __Pyx_GetName(__pyx_m, __pyx_kp_np); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 369; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __pyx_2 = PyObject_GetAttr(__pyx_1, __pyx_kp_asarray); if (unlikely(!__pyx_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 369; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_DECREF(__pyx_1); __pyx_1 = 0;
-  __pyx_1 = PyTuple_New(1); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 369; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_INCREF(__pyx_v_Z);
-  PyTuple_SET_ITEM(__pyx_1, 0, __pyx_v_Z);
-  __pyx_3 = PyDict_New(); if (unlikely(!__pyx_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 369; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  if (PyDict_SetItem(__pyx_3, __pyx_kp_dtype, __pyx_kp_64) < 0) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 369; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __pyx_4 = PyEval_CallObjectWithKeywords(__pyx_2, ((PyObject *)__pyx_1), ((PyObject *)__pyx_3)); if (unlikely(!__pyx_4)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 369; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_DECREF(__pyx_2); __pyx_2 = 0;
-  Py_DECREF(((PyObject *)__pyx_1)); __pyx_1 = 0;
-  Py_DECREF(((PyObject *)__pyx_3)); __pyx_3 = 0;
-  Py_DECREF(__pyx_v_Za);
-  __pyx_v_Za = __pyx_4;
-  __pyx_4 = 0;
-
-  /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":370
- * 
- *     Za = np.asarray(Z, dtype='double')
- *     T = np.zeros(Za.shape, dtype='double')             # <<<<<<<<<<<<<<
- *     S = np.ascontiguousarray(slice_order, dtype='double')
- *     s = <double*>PyArray_DATA(<ndarray>S)
- */
-  __pyx_2 = __Pyx_GetName(__pyx_m, __pyx_kp_np); if (unlikely(!__pyx_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 370; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __pyx_1 = PyObject_GetAttr(__pyx_2, __pyx_kp_zeros); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 370; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_DECREF(__pyx_2); __pyx_2 = 0;
-  __pyx_3 = PyObject_GetAttr(__pyx_v_Za, __pyx_kp_shape); if (unlikely(!__pyx_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 370; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __pyx_4 = PyTuple_New(1); if (unlikely(!__pyx_4)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 370; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  PyTuple_SET_ITEM(__pyx_4, 0, __pyx_3);
-  __pyx_3 = 0;
-  __pyx_2 = PyDict_New(); if (unlikely(!__pyx_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 370; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  if (PyDict_SetItem(__pyx_2, __pyx_kp_dtype, __pyx_kp_65) < 0) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 370; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __pyx_3 = PyEval_CallObjectWithKeywords(__pyx_1, ((PyObject *)__pyx_4), ((PyObject *)__pyx_2)); if (unlikely(!__pyx_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 370; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_DECREF(__pyx_1); __pyx_1 = 0;
-  Py_DECREF(((PyObject *)__pyx_4)); __pyx_4 = 0;
-  Py_DECREF(((PyObject *)__pyx_2)); __pyx_2 = 0;
-  Py_DECREF(__pyx_v_T);
-  __pyx_v_T = __pyx_3;
-  __pyx_3 = 0;
-
-  /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":371
- *     Za = np.asarray(Z, dtype='double')
- *     T = np.zeros(Za.shape, dtype='double')
- *     S = np.ascontiguousarray(slice_order, dtype='double')             # <<<<<<<<<<<<<<
- *     s = <double*>PyArray_DATA(<ndarray>S)
- *     nslices = S.size
- */
-  __pyx_1 = __Pyx_GetName(__pyx_m, __pyx_kp_np); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 371; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __pyx_4 = PyObject_GetAttr(__pyx_1, __pyx_kp_ascontiguousarray); if (unlikely(!__pyx_4)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 371; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_DECREF(__pyx_1); __pyx_1 = 0;
-  __pyx_2 = PyTuple_New(1); if (unlikely(!__pyx_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 371; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_INCREF(__pyx_v_slice_order);
-  PyTuple_SET_ITEM(__pyx_2, 0, __pyx_v_slice_order);
-  __pyx_3 = PyDict_New(); if (unlikely(!__pyx_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 371; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  if (PyDict_SetItem(__pyx_3, __pyx_kp_dtype, __pyx_kp_66) < 0) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 371; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __pyx_1 = PyEval_CallObjectWithKeywords(__pyx_4, ((PyObject *)__pyx_2), ((PyObject *)__pyx_3)); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 371; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_DECREF(__pyx_4); __pyx_4 = 0;
-  Py_DECREF(((PyObject *)__pyx_2)); __pyx_2 = 0;
-  Py_DECREF(((PyObject *)__pyx_3)); __pyx_3 = 0;
-  Py_DECREF(__pyx_v_S);
-  __pyx_v_S = __pyx_1;
-  __pyx_1 = 0;
-
-  /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":372
- *     T = np.zeros(Za.shape, dtype='double')
- *     S = np.ascontiguousarray(slice_order, dtype='double')
- *     s = <double*>PyArray_DATA(<ndarray>S)             # <<<<<<<<<<<<<<
- *     nslices = S.size
- * 
- */
-  __pyx_v_s = ((double *)PyArray_DATA(((PyArrayObject *)__pyx_v_S)));
-
-  /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":373
- *     S = np.ascontiguousarray(slice_order, dtype='double')
- *     s = <double*>PyArray_DATA(<ndarray>S)
- *     nslices = S.size             # <<<<<<<<<<<<<<
- * 
- *     multi = PyArray_MultiIterNew(2, <void*>Za, <void*>T)
- */
-  __pyx_4 = PyObject_GetAttr(__pyx_v_S, __pyx_kp_size); if (unlikely(!__pyx_4)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 373; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __pyx_5 = PyInt_AsUnsignedLongMask(__pyx_4); if (unlikely((__pyx_5 == (unsigned int)-1) && PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 373; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_DECREF(__pyx_4); __pyx_4 = 0;
-  __pyx_v_nslices = __pyx_5;
-
-  /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":375
- *     nslices = S.size
- * 
- *     multi = PyArray_MultiIterNew(2, <void*>Za, <void*>T)             # <<<<<<<<<<<<<<
- *     while(multi.index < multi.size):
- *         z = <double*>PyArray_MultiIter_DATA(multi, 0)
- */
-  __pyx_2 = PyArray_MultiIterNew(2, ((void *)__pyx_v_Za), ((void *)__pyx_v_T)); if (unlikely(!__pyx_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 375; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  if (!(__Pyx_TypeTest(__pyx_2, __pyx_ptype_4nipy_9neurospin_8register_8routines_broadcast))) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 375; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_DECREF(((PyObject *)__pyx_v_multi));
-  __pyx_v_multi = ((PyArrayMultiIterObject *)__pyx_2);
-  __pyx_2 = 0;
-
-  /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":376
- * 
- *     multi = PyArray_MultiIterNew(2, <void*>Za, <void*>T)
- *     while(multi.index < multi.size):             # <<<<<<<<<<<<<<
- *         z = <double*>PyArray_MultiIter_DATA(multi, 0)
- *         t = <double*>PyArray_MultiIter_DATA(multi, 1)
- */
-  while (1) {
-    __pyx_6 = (__pyx_v_multi->index < __pyx_v_multi->size);
-    if (!__pyx_6) break;
-
-    /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":377
- *     multi = PyArray_MultiIterNew(2, <void*>Za, <void*>T)
- *     while(multi.index < multi.size):
- *         z = <double*>PyArray_MultiIter_DATA(multi, 0)             # <<<<<<<<<<<<<<
- *         t = <double*>PyArray_MultiIter_DATA(multi, 1)
- *         zfloor = <unsigned int>z[0]
- */
-    __pyx_v_z = ((double *)PyArray_MultiIter_DATA(__pyx_v_multi, 0));
-
-    /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":378
- *     while(multi.index < multi.size):
- *         z = <double*>PyArray_MultiIter_DATA(multi, 0)
- *         t = <double*>PyArray_MultiIter_DATA(multi, 1)             # <<<<<<<<<<<<<<
- *         zfloor = <unsigned int>z[0]
- *         cycles = zfloor / nslices
- */
-    __pyx_v_t = ((double *)PyArray_MultiIter_DATA(__pyx_v_multi, 1));
-
-    /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":379
- *         z = <double*>PyArray_MultiIter_DATA(multi, 0)
- *         t = <double*>PyArray_MultiIter_DATA(multi, 1)
- *         zfloor = <unsigned int>z[0]             # <<<<<<<<<<<<<<
- *         cycles = zfloor / nslices
- *         zl = zfloor % nslices
- */
-    __pyx_v_zfloor = ((unsigned int)(__pyx_v_z[0]));
-
-    /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":380
- *         t = <double*>PyArray_MultiIter_DATA(multi, 1)
- *         zfloor = <unsigned int>z[0]
- *         cycles = zfloor / nslices             # <<<<<<<<<<<<<<
- *         zl = zfloor % nslices
- *         zr = zl + 1
- */
-    __pyx_v_cycles = (__pyx_v_zfloor / __pyx_v_nslices);
-
-    /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":381
- *         zfloor = <unsigned int>z[0]
- *         cycles = zfloor / nslices
- *         zl = zfloor % nslices             # <<<<<<<<<<<<<<
- *         zr = zl + 1
- *         weight = z[0]-zfloor
- */
-    __pyx_v_zl = (__pyx_v_zfloor % __pyx_v_nslices);
-
-    /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":382
- *         cycles = zfloor / nslices
- *         zl = zfloor % nslices
- *         zr = zl + 1             # <<<<<<<<<<<<<<
- *         weight = z[0]-zfloor
- *         if zl < (nslices-1):
- */
-    __pyx_v_zr = (__pyx_v_zl + 1);
-
-    /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":383
- *         zl = zfloor % nslices
- *         zr = zl + 1
- *         weight = z[0]-zfloor             # <<<<<<<<<<<<<<
- *         if zl < (nslices-1):
- *             slice_interp = (1-weight)*s[zl] + weight*s[zr]
- */
-    __pyx_v_weight = ((__pyx_v_z[0]) - __pyx_v_zfloor);
-
-    /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":384
- *         zr = zl + 1
- *         weight = z[0]-zfloor
- *         if zl < (nslices-1):             # <<<<<<<<<<<<<<
- *             slice_interp = (1-weight)*s[zl] + weight*s[zr]
- *         else:
- */
-    __pyx_6 = (__pyx_v_zl < (__pyx_v_nslices - 1));
-    if (__pyx_6) {
-
-      /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":385
- *         weight = z[0]-zfloor
- *         if zl < (nslices-1):
- *             slice_interp = (1-weight)*s[zl] + weight*s[zr]             # <<<<<<<<<<<<<<
- *         else:
- *             slice_interp = (1-weight)*s[zl] + weight*nslices
- */
-      __pyx_v_slice_interp = (((1 - __pyx_v_weight) * (__pyx_v_s[__pyx_v_zl])) + (__pyx_v_weight * (__pyx_v_s[__pyx_v_zr])));
-      goto __pyx_L8;
-    }
-    /*else*/ {
-
-      /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":387
- *             slice_interp = (1-weight)*s[zl] + weight*s[zr]
- *         else:
- *             slice_interp = (1-weight)*s[zl] + weight*nslices             # <<<<<<<<<<<<<<
- *         t[0] = cycles + tr_slices*slice_interp
- *         PyArray_MultiIter_NEXT(multi)
- */
-      __pyx_v_slice_interp = (((1 - __pyx_v_weight) * (__pyx_v_s[__pyx_v_zl])) + (__pyx_v_weight * __pyx_v_nslices));
-    }
-    __pyx_L8:;
-
-    /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":388
- *         else:
- *             slice_interp = (1-weight)*s[zl] + weight*nslices
- *         t[0] = cycles + tr_slices*slice_interp             # <<<<<<<<<<<<<<
- *         PyArray_MultiIter_NEXT(multi)
- *     return T
- */
-    (__pyx_v_t[0]) = (__pyx_v_cycles + (__pyx_v_tr_slices * __pyx_v_slice_interp));
-
-    /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":389
- *             slice_interp = (1-weight)*s[zl] + weight*nslices
- *         t[0] = cycles + tr_slices*slice_interp
- *         PyArray_MultiIter_NEXT(multi)             # <<<<<<<<<<<<<<
- *     return T
- * 
- */
-    PyArray_MultiIter_NEXT(__pyx_v_multi);
-  }
-
-  /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":390
- *         t[0] = cycles + tr_slices*slice_interp
- *         PyArray_MultiIter_NEXT(multi)
- *     return T             # <<<<<<<<<<<<<<
- * 
- * 
- */
-  Py_INCREF(__pyx_v_T);
-  __pyx_r = __pyx_v_T;
-  goto __pyx_L0;
-
-  __pyx_r = Py_None; Py_INCREF(Py_None);
-  goto __pyx_L0;
-  __pyx_L1_error:;
-  Py_XDECREF(__pyx_1);
-  Py_XDECREF(__pyx_2);
-  Py_XDECREF(__pyx_3);
-  Py_XDECREF(__pyx_4);
-  __Pyx_AddTraceback("nipy.neurospin.register.routines.slice_time");
-  __pyx_r = NULL;
-  __pyx_L0:;
-  Py_DECREF(__pyx_v_multi);
-  Py_DECREF(__pyx_v_Za);
-  Py_DECREF(__pyx_v_T);
-  Py_DECREF(__pyx_v_S);
-  return __pyx_r;
-}
-
-/* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":413
- * 
- * 
- * def rotation_vec2mat(r):             # <<<<<<<<<<<<<<
- *     """
- *     R = rotation_vec2mat(r)
- */
-
-static PyObject *__pyx_pf_4nipy_9neurospin_8register_8routines_rotation_vec2mat(PyObject *__pyx_self, PyObject *__pyx_v_r); /*proto*/
-static char __pyx_doc_4nipy_9neurospin_8register_8routines_rotation_vec2mat[] = "\n    R = rotation_vec2mat(r)\n\n    The rotation matrix is given by the Rodrigues formula:\n    \n    R = Id + sin(theta)*Sn + (1-cos(theta))*Sn^2  \n    \n    with:\n    \n           0  -nz  ny\n    Sn =   nz   0 -nx\n          -ny  nx   0\n    \n    where n = r / ||r||\n    \n    In case the angle ||r|| is very small, the above formula may lead\n    to numerical instabilities. We instead use a Taylor expansion\n    around theta=0:\n    \n    R = I + sin(theta)/tetha Sr + (1-cos(theta))/teta2 Sr^2\n    \n    leading to:\n    \n    R = I + (1-theta2/6)*Sr + (1/2-theta2/24)*Sr^2\n    ";
-static PyObject *__pyx_pf_4nipy_9neurospin_8register_8routines_rotation_vec2mat(PyObject *__pyx_self, PyObject *__pyx_v_r) {
-  double __pyx_v_theta;
-  double __pyx_v_theta2;
-  PyObject *__pyx_v_n;
-  PyObject *__pyx_v_Sn;
-  PyObject *__pyx_v_R;
-  PyObject *__pyx_v_Sr;
-  PyObject *__pyx_r;
-  PyObject *__pyx_1 = 0;
-  PyObject *__pyx_2 = 0;
-  PyObject *__pyx_3 = 0;
-  double __pyx_4;
-  int __pyx_5;
-  PyObject *__pyx_6 = 0;
-  PyObject *__pyx_7 = 0;
-  PyObject *__pyx_8 = 0;
-  PyObject *__pyx_t_1 = NULL;
-  PyObject *__pyx_t_2 = NULL;
-  PyObject *__pyx_t_3 = NULL;
-  __pyx_self = __pyx_self;
-  __pyx_v_n = Py_None; Py_INCREF(Py_None);
-  __pyx_v_Sn = Py_None; Py_INCREF(Py_None);
-  __pyx_v_R = Py_None; Py_INCREF(Py_None);
-  __pyx_v_Sr = Py_None; Py_INCREF(Py_None);
-
-  /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":440
- *     """
- *     cdef double theta, theta2
- *     theta = <double> np.linalg.norm(r)             # <<<<<<<<<<<<<<
- *     if theta > 1e-30:
- *         n = r/theta
- */
-  __pyx_1 = __Pyx_GetName(__pyx_m, __pyx_kp_np); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 440; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __pyx_2 = PyObject_GetAttr(__pyx_1, __pyx_kp_linalg); if (unlikely(!__pyx_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 440; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_DECREF(__pyx_1); __pyx_1 = 0;
-  __pyx_1 = PyObject_GetAttr(__pyx_2, __pyx_kp_norm); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 440; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_DECREF(__pyx_2); __pyx_2 = 0;
-  __pyx_2 = PyTuple_New(1); if (unlikely(!__pyx_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 440; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_INCREF(__pyx_v_r);
-  PyTuple_SET_ITEM(__pyx_2, 0, __pyx_v_r);
-  __pyx_3 = PyObject_Call(__pyx_1, ((PyObject *)__pyx_2), NULL); if (unlikely(!__pyx_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 440; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_DECREF(__pyx_1); __pyx_1 = 0;
-  Py_DECREF(((PyObject *)__pyx_2)); __pyx_2 = 0;
-  __pyx_4 = __pyx_PyFloat_AsDouble(__pyx_3); if (unlikely(PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 440; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_DECREF(__pyx_3); __pyx_3 = 0;
-  __pyx_v_theta = ((double)__pyx_4);
-
-  /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":441
- *     cdef double theta, theta2
- *     theta = <double> np.linalg.norm(r)
- *     if theta > 1e-30:             # <<<<<<<<<<<<<<
- *         n = r/theta
- *         Sn = np.array([[0,-n[2],n[1]],[n[2],0,-n[0]],[-n[1],n[0],0]])
- */
-  __pyx_5 = (__pyx_v_theta > 1e-30);
-  if (__pyx_5) {
-
-    /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":442
- *     theta = <double> np.linalg.norm(r)
- *     if theta > 1e-30:
- *         n = r/theta             # <<<<<<<<<<<<<<
- *         Sn = np.array([[0,-n[2],n[1]],[n[2],0,-n[0]],[-n[1],n[0],0]])
- *         R = np.eye(3) + np.sin(theta)*Sn + (1-np.cos(theta))*np.dot(Sn,Sn)
- */
-    __pyx_1 = PyFloat_FromDouble(__pyx_v_theta); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 442; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __pyx_t_1 = __Pyx_PyNumber_Divide(__pyx_v_r, __pyx_1); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 442; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_DECREF(__pyx_1); __pyx_1 = 0;
-    Py_DECREF(__pyx_v_n);
-    __pyx_v_n = __pyx_t_1;
-    __pyx_t_1 = 0;
-
-    /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":443
- *     if theta > 1e-30:
- *         n = r/theta
- *         Sn = np.array([[0,-n[2],n[1]],[n[2],0,-n[0]],[-n[1],n[0],0]])             # <<<<<<<<<<<<<<
- *         R = np.eye(3) + np.sin(theta)*Sn + (1-np.cos(theta))*np.dot(Sn,Sn)
- *     else:
- */
-    __pyx_2 = __Pyx_GetName(__pyx_m, __pyx_kp_np); if (unlikely(!__pyx_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 443; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __pyx_3 = PyObject_GetAttr(__pyx_2, __pyx_kp_array); if (unlikely(!__pyx_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 443; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_DECREF(__pyx_2); __pyx_2 = 0;
-    __pyx_1 = __Pyx_GetItemInt(__pyx_v_n, 2, 0); if (!__pyx_1) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 443; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __pyx_2 = PyNumber_Negative(__pyx_1); if (unlikely(!__pyx_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 443; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_DECREF(__pyx_1); __pyx_1 = 0;
-    __pyx_1 = __Pyx_GetItemInt(__pyx_v_n, 1, 0); if (!__pyx_1) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 443; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __pyx_6 = PyList_New(3); if (unlikely(!__pyx_6)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 443; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_INCREF(__pyx_int_0);
-    PyList_SET_ITEM(__pyx_6, 0, __pyx_int_0);
-    PyList_SET_ITEM(__pyx_6, 1, __pyx_2);
-    PyList_SET_ITEM(__pyx_6, 2, __pyx_1);
-    __pyx_2 = 0;
-    __pyx_1 = 0;
-    __pyx_2 = __Pyx_GetItemInt(__pyx_v_n, 2, 0); if (!__pyx_2) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 443; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __pyx_1 = __Pyx_GetItemInt(__pyx_v_n, 0, 0); if (!__pyx_1) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 443; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __pyx_7 = PyNumber_Negative(__pyx_1); if (unlikely(!__pyx_7)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 443; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_DECREF(__pyx_1); __pyx_1 = 0;
-    __pyx_1 = PyList_New(3); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 443; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    PyList_SET_ITEM(__pyx_1, 0, __pyx_2);
-    Py_INCREF(__pyx_int_0);
-    PyList_SET_ITEM(__pyx_1, 1, __pyx_int_0);
-    PyList_SET_ITEM(__pyx_1, 2, __pyx_7);
-    __pyx_2 = 0;
-    __pyx_7 = 0;
-    __pyx_2 = __Pyx_GetItemInt(__pyx_v_n, 1, 0); if (!__pyx_2) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 443; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __pyx_7 = PyNumber_Negative(__pyx_2); if (unlikely(!__pyx_7)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 443; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_DECREF(__pyx_2); __pyx_2 = 0;
-    __pyx_2 = __Pyx_GetItemInt(__pyx_v_n, 0, 0); if (!__pyx_2) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 443; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __pyx_8 = PyList_New(3); if (unlikely(!__pyx_8)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 443; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    PyList_SET_ITEM(__pyx_8, 0, __pyx_7);
-    PyList_SET_ITEM(__pyx_8, 1, __pyx_2);
-    Py_INCREF(__pyx_int_0);
-    PyList_SET_ITEM(__pyx_8, 2, __pyx_int_0);
-    __pyx_7 = 0;
-    __pyx_2 = 0;
-    __pyx_7 = PyList_New(3); if (unlikely(!__pyx_7)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 443; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    PyList_SET_ITEM(__pyx_7, 0, ((PyObject *)__pyx_6));
-    PyList_SET_ITEM(__pyx_7, 1, ((PyObject *)__pyx_1));
-    PyList_SET_ITEM(__pyx_7, 2, ((PyObject *)__pyx_8));
-    __pyx_6 = 0;
-    __pyx_1 = 0;
-    __pyx_8 = 0;
-    __pyx_2 = PyTuple_New(1); if (unlikely(!__pyx_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 443; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    PyTuple_SET_ITEM(__pyx_2, 0, ((PyObject *)__pyx_7));
-    __pyx_7 = 0;
-    __pyx_6 = PyObject_Call(__pyx_3, ((PyObject *)__pyx_2), NULL); if (unlikely(!__pyx_6)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 443; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_DECREF(__pyx_3); __pyx_3 = 0;
-    Py_DECREF(((PyObject *)__pyx_2)); __pyx_2 = 0;
-    Py_DECREF(__pyx_v_Sn);
-    __pyx_v_Sn = __pyx_6;
-    __pyx_6 = 0;
-
-    /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":444
- *         n = r/theta
- *         Sn = np.array([[0,-n[2],n[1]],[n[2],0,-n[0]],[-n[1],n[0],0]])
- *         R = np.eye(3) + np.sin(theta)*Sn + (1-np.cos(theta))*np.dot(Sn,Sn)             # <<<<<<<<<<<<<<
- *     else:
- *         Sr = np.array([[0,-r[2],r[1]],[r[2],0,-r[0]],[-r[1],r[0],0]])
- */
-    __pyx_1 = __Pyx_GetName(__pyx_m, __pyx_kp_np); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 444; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __pyx_8 = PyObject_GetAttr(__pyx_1, __pyx_kp_eye); if (unlikely(!__pyx_8)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 444; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_DECREF(__pyx_1); __pyx_1 = 0;
-    __pyx_7 = PyTuple_New(1); if (unlikely(!__pyx_7)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 444; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_INCREF(__pyx_int_3);
-    PyTuple_SET_ITEM(__pyx_7, 0, __pyx_int_3);
-    __pyx_3 = PyObject_Call(__pyx_8, ((PyObject *)__pyx_7), NULL); if (unlikely(!__pyx_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 444; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_DECREF(__pyx_8); __pyx_8 = 0;
-    Py_DECREF(((PyObject *)__pyx_7)); __pyx_7 = 0;
-    __pyx_2 = __Pyx_GetName(__pyx_m, __pyx_kp_np); if (unlikely(!__pyx_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 444; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __pyx_6 = PyObject_GetAttr(__pyx_2, __pyx_kp_sin); if (unlikely(!__pyx_6)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 444; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_DECREF(__pyx_2); __pyx_2 = 0;
-    __pyx_1 = PyFloat_FromDouble(__pyx_v_theta); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 444; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __pyx_8 = PyTuple_New(1); if (unlikely(!__pyx_8)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 444; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    PyTuple_SET_ITEM(__pyx_8, 0, __pyx_1);
-    __pyx_1 = 0;
-    __pyx_7 = PyObject_Call(__pyx_6, ((PyObject *)__pyx_8), NULL); if (unlikely(!__pyx_7)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 444; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_DECREF(__pyx_6); __pyx_6 = 0;
-    Py_DECREF(((PyObject *)__pyx_8)); __pyx_8 = 0;
-    __pyx_t_1 = PyNumber_Multiply(__pyx_7, __pyx_v_Sn); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 444; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_DECREF(__pyx_7); __pyx_7 = 0;
-    __pyx_t_2 = PyNumber_Add(__pyx_3, __pyx_t_1); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 444; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_DECREF(__pyx_3); __pyx_3 = 0;
-    Py_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-    __pyx_2 = __Pyx_GetName(__pyx_m, __pyx_kp_np); if (unlikely(!__pyx_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 444; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __pyx_1 = PyObject_GetAttr(__pyx_2, __pyx_kp_cos); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 444; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_DECREF(__pyx_2); __pyx_2 = 0;
-    __pyx_6 = PyFloat_FromDouble(__pyx_v_theta); if (unlikely(!__pyx_6)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 444; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __pyx_8 = PyTuple_New(1); if (unlikely(!__pyx_8)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 444; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    PyTuple_SET_ITEM(__pyx_8, 0, __pyx_6);
-    __pyx_6 = 0;
-    __pyx_7 = PyObject_Call(__pyx_1, ((PyObject *)__pyx_8), NULL); if (unlikely(!__pyx_7)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 444; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_DECREF(__pyx_1); __pyx_1 = 0;
-    Py_DECREF(((PyObject *)__pyx_8)); __pyx_8 = 0;
-    __pyx_t_1 = PyNumber_Subtract(__pyx_int_1, __pyx_7); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 444; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_DECREF(__pyx_7); __pyx_7 = 0;
-    __pyx_3 = __Pyx_GetName(__pyx_m, __pyx_kp_np); if (unlikely(!__pyx_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 444; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __pyx_2 = PyObject_GetAttr(__pyx_3, __pyx_kp_dot); if (unlikely(!__pyx_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 444; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_DECREF(__pyx_3); __pyx_3 = 0;
-    __pyx_6 = PyTuple_New(2); if (unlikely(!__pyx_6)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 444; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_INCREF(__pyx_v_Sn);
-    PyTuple_SET_ITEM(__pyx_6, 0, __pyx_v_Sn);
-    Py_INCREF(__pyx_v_Sn);
-    PyTuple_SET_ITEM(__pyx_6, 1, __pyx_v_Sn);
-    __pyx_1 = PyObject_Call(__pyx_2, ((PyObject *)__pyx_6), NULL); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 444; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_DECREF(__pyx_2); __pyx_2 = 0;
-    Py_DECREF(((PyObject *)__pyx_6)); __pyx_6 = 0;
-    __pyx_t_3 = PyNumber_Multiply(__pyx_t_1, __pyx_1); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 444; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-    Py_DECREF(__pyx_1); __pyx_1 = 0;
-    __pyx_t_1 = PyNumber_Add(__pyx_t_2, __pyx_t_3); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 444; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_DECREF(__pyx_t_2); __pyx_t_2 = 0;
-    Py_DECREF(__pyx_t_3); __pyx_t_3 = 0;
-    Py_DECREF(__pyx_v_R);
-    __pyx_v_R = __pyx_t_1;
-    __pyx_t_1 = 0;
-    goto __pyx_L5;
-  }
-  /*else*/ {
-
-    /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":446
- *         R = np.eye(3) + np.sin(theta)*Sn + (1-np.cos(theta))*np.dot(Sn,Sn)
- *     else:
- *         Sr = np.array([[0,-r[2],r[1]],[r[2],0,-r[0]],[-r[1],r[0],0]])             # <<<<<<<<<<<<<<
- *         theta2 = theta*theta
- *         R = np.eye(3) + (1-theta2/6.)*Sr + (.5-theta2/24.)*np.dot(Sr,Sr)
- */
-    __pyx_8 = __Pyx_GetName(__pyx_m, __pyx_kp_np); if (unlikely(!__pyx_8)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 446; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __pyx_7 = PyObject_GetAttr(__pyx_8, __pyx_kp_array); if (unlikely(!__pyx_7)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 446; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_DECREF(__pyx_8); __pyx_8 = 0;
-    __pyx_3 = __Pyx_GetItemInt(__pyx_v_r, 2, 0); if (!__pyx_3) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 446; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __pyx_2 = PyNumber_Negative(__pyx_3); if (unlikely(!__pyx_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 446; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_DECREF(__pyx_3); __pyx_3 = 0;
-    __pyx_6 = __Pyx_GetItemInt(__pyx_v_r, 1, 0); if (!__pyx_6) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 446; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __pyx_1 = PyList_New(3); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 446; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_INCREF(__pyx_int_0);
-    PyList_SET_ITEM(__pyx_1, 0, __pyx_int_0);
-    PyList_SET_ITEM(__pyx_1, 1, __pyx_2);
-    PyList_SET_ITEM(__pyx_1, 2, __pyx_6);
-    __pyx_2 = 0;
-    __pyx_6 = 0;
-    __pyx_8 = __Pyx_GetItemInt(__pyx_v_r, 2, 0); if (!__pyx_8) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 446; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __pyx_3 = __Pyx_GetItemInt(__pyx_v_r, 0, 0); if (!__pyx_3) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 446; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __pyx_2 = PyNumber_Negative(__pyx_3); if (unlikely(!__pyx_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 446; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_DECREF(__pyx_3); __pyx_3 = 0;
-    __pyx_6 = PyList_New(3); if (unlikely(!__pyx_6)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 446; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    PyList_SET_ITEM(__pyx_6, 0, __pyx_8);
-    Py_INCREF(__pyx_int_0);
-    PyList_SET_ITEM(__pyx_6, 1, __pyx_int_0);
-    PyList_SET_ITEM(__pyx_6, 2, __pyx_2);
-    __pyx_8 = 0;
-    __pyx_2 = 0;
-    __pyx_3 = __Pyx_GetItemInt(__pyx_v_r, 1, 0); if (!__pyx_3) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 446; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __pyx_8 = PyNumber_Negative(__pyx_3); if (unlikely(!__pyx_8)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 446; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_DECREF(__pyx_3); __pyx_3 = 0;
-    __pyx_2 = __Pyx_GetItemInt(__pyx_v_r, 0, 0); if (!__pyx_2) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 446; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __pyx_3 = PyList_New(3); if (unlikely(!__pyx_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 446; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    PyList_SET_ITEM(__pyx_3, 0, __pyx_8);
-    PyList_SET_ITEM(__pyx_3, 1, __pyx_2);
-    Py_INCREF(__pyx_int_0);
-    PyList_SET_ITEM(__pyx_3, 2, __pyx_int_0);
-    __pyx_8 = 0;
-    __pyx_2 = 0;
-    __pyx_8 = PyList_New(3); if (unlikely(!__pyx_8)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 446; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    PyList_SET_ITEM(__pyx_8, 0, ((PyObject *)__pyx_1));
-    PyList_SET_ITEM(__pyx_8, 1, ((PyObject *)__pyx_6));
-    PyList_SET_ITEM(__pyx_8, 2, ((PyObject *)__pyx_3));
-    __pyx_1 = 0;
-    __pyx_6 = 0;
-    __pyx_3 = 0;
-    __pyx_2 = PyTuple_New(1); if (unlikely(!__pyx_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 446; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    PyTuple_SET_ITEM(__pyx_2, 0, ((PyObject *)__pyx_8));
-    __pyx_8 = 0;
-    __pyx_1 = PyObject_Call(__pyx_7, ((PyObject *)__pyx_2), NULL); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 446; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_DECREF(__pyx_7); __pyx_7 = 0;
-    Py_DECREF(((PyObject *)__pyx_2)); __pyx_2 = 0;
-    Py_DECREF(__pyx_v_Sr);
-    __pyx_v_Sr = __pyx_1;
-    __pyx_1 = 0;
-
-    /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":447
- *     else:
- *         Sr = np.array([[0,-r[2],r[1]],[r[2],0,-r[0]],[-r[1],r[0],0]])
- *         theta2 = theta*theta             # <<<<<<<<<<<<<<
- *         R = np.eye(3) + (1-theta2/6.)*Sr + (.5-theta2/24.)*np.dot(Sr,Sr)
- *     return R
- */
-    __pyx_v_theta2 = (__pyx_v_theta * __pyx_v_theta);
-
-    /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":448
- *         Sr = np.array([[0,-r[2],r[1]],[r[2],0,-r[0]],[-r[1],r[0],0]])
- *         theta2 = theta*theta
- *         R = np.eye(3) + (1-theta2/6.)*Sr + (.5-theta2/24.)*np.dot(Sr,Sr)             # <<<<<<<<<<<<<<
- *     return R
- * 
- */
-    __pyx_6 = __Pyx_GetName(__pyx_m, __pyx_kp_np); if (unlikely(!__pyx_6)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 448; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __pyx_3 = PyObject_GetAttr(__pyx_6, __pyx_kp_eye); if (unlikely(!__pyx_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 448; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_DECREF(__pyx_6); __pyx_6 = 0;
-    __pyx_8 = PyTuple_New(1); if (unlikely(!__pyx_8)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 448; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_INCREF(__pyx_int_3);
-    PyTuple_SET_ITEM(__pyx_8, 0, __pyx_int_3);
-    __pyx_7 = PyObject_Call(__pyx_3, ((PyObject *)__pyx_8), NULL); if (unlikely(!__pyx_7)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 448; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_DECREF(__pyx_3); __pyx_3 = 0;
-    Py_DECREF(((PyObject *)__pyx_8)); __pyx_8 = 0;
-    __pyx_2 = PyFloat_FromDouble((1 - (__pyx_v_theta2 / 6.))); if (unlikely(!__pyx_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 448; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __pyx_t_1 = PyNumber_Multiply(__pyx_2, __pyx_v_Sr); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 448; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_DECREF(__pyx_2); __pyx_2 = 0;
-    __pyx_t_3 = PyNumber_Add(__pyx_7, __pyx_t_1); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 448; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_DECREF(__pyx_7); __pyx_7 = 0;
-    Py_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-    __pyx_1 = PyFloat_FromDouble((.5 - (__pyx_v_theta2 / 24.))); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 448; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __pyx_6 = __Pyx_GetName(__pyx_m, __pyx_kp_np); if (unlikely(!__pyx_6)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 448; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __pyx_3 = PyObject_GetAttr(__pyx_6, __pyx_kp_dot); if (unlikely(!__pyx_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 448; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_DECREF(__pyx_6); __pyx_6 = 0;
-    __pyx_8 = PyTuple_New(2); if (unlikely(!__pyx_8)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 448; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_INCREF(__pyx_v_Sr);
-    PyTuple_SET_ITEM(__pyx_8, 0, __pyx_v_Sr);
-    Py_INCREF(__pyx_v_Sr);
-    PyTuple_SET_ITEM(__pyx_8, 1, __pyx_v_Sr);
-    __pyx_2 = PyObject_Call(__pyx_3, ((PyObject *)__pyx_8), NULL); if (unlikely(!__pyx_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 448; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_DECREF(__pyx_3); __pyx_3 = 0;
-    Py_DECREF(((PyObject *)__pyx_8)); __pyx_8 = 0;
-    __pyx_t_1 = PyNumber_Multiply(__pyx_1, __pyx_2); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 448; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_DECREF(__pyx_1); __pyx_1 = 0;
-    Py_DECREF(__pyx_2); __pyx_2 = 0;
-    __pyx_t_2 = PyNumber_Add(__pyx_t_3, __pyx_t_1); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 448; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_DECREF(__pyx_t_3); __pyx_t_3 = 0;
-    Py_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-    Py_DECREF(__pyx_v_R);
-    __pyx_v_R = __pyx_t_2;
-    __pyx_t_2 = 0;
-  }
-  __pyx_L5:;
-
-  /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":449
- *         theta2 = theta*theta
- *         R = np.eye(3) + (1-theta2/6.)*Sr + (.5-theta2/24.)*np.dot(Sr,Sr)
- *     return R             # <<<<<<<<<<<<<<
- * 
- * 
- */
-  Py_INCREF(__pyx_v_R);
-  __pyx_r = __pyx_v_R;
-  goto __pyx_L0;
-
-  __pyx_r = Py_None; Py_INCREF(Py_None);
-  goto __pyx_L0;
-  __pyx_L1_error:;
-  Py_XDECREF(__pyx_1);
-  Py_XDECREF(__pyx_2);
-  Py_XDECREF(__pyx_3);
-  Py_XDECREF(__pyx_6);
-  Py_XDECREF(__pyx_7);
-  Py_XDECREF(__pyx_8);
-  __Pyx_AddTraceback("nipy.neurospin.register.routines.rotation_vec2mat");
-  __pyx_r = NULL;
-  __pyx_L0:;
-  Py_DECREF(__pyx_v_n);
-  Py_DECREF(__pyx_v_Sn);
-  Py_DECREF(__pyx_v_R);
-  Py_DECREF(__pyx_v_Sr);
-  return __pyx_r;
-}
-
-/* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":454
- * 
- * 
- * def param_to_vector12(ndarray param, ndarray t0, ndarray precond, int stamp=AFFINE3D):             # <<<<<<<<<<<<<<
- *     """
- *     t = param_to_vector12(p, t, precond, stamp=AFFINE3D).
- */
-
-static PyObject *__pyx_pf_4nipy_9neurospin_8register_8routines_param_to_vector12(PyObject *__pyx_self, PyObject *__pyx_args, PyObject *__pyx_kwds); /*proto*/
-static char __pyx_doc_4nipy_9neurospin_8register_8routines_param_to_vector12[] = "\n    t = param_to_vector12(p, t, precond, stamp=AFFINE3D).\n\n    In-place modification of t. \n\n    p is a 1d-array of affine transformation parameters with size\n    dependent on the transformation type, which is coded by the\n    integer stamp.\n    ";
-static PyObject *__pyx_pf_4nipy_9neurospin_8register_8routines_param_to_vector12(PyObject *__pyx_self, PyObject *__pyx_args, PyObject *__pyx_kwds) {
-  PyArrayObject *__pyx_v_param = 0;
-  PyArrayObject *__pyx_v_t0 = 0;
-  PyArrayObject *__pyx_v_precond = 0;
-  int __pyx_v_stamp;
-  PyObject *__pyx_v_t;
-  PyObject *__pyx_r;
-  int __pyx_1;
-  PyObject *__pyx_2 = 0;
-  PyObject *__pyx_3 = 0;
-  PyObject *__pyx_4 = 0;
-  PyObject *__pyx_t_1 = NULL;
-  static PyObject **__pyx_pyargnames[] = {&__pyx_kp_param,&__pyx_kp_t0,&__pyx_kp_precond,&__pyx_kp_stamp,0};
-  __pyx_self = __pyx_self;
-  __pyx_v_stamp = __pyx_k_51;
-  if (unlikely(__pyx_kwds)) {
-    PyObject* values[4] = {0,0,0,0};
-    Py_ssize_t kw_args = PyDict_Size(__pyx_kwds);
-    switch (PyTuple_GET_SIZE(__pyx_args)) {
-      case  4: values[3] = PyTuple_GET_ITEM(__pyx_args, 3);
-      case  3: values[2] = PyTuple_GET_ITEM(__pyx_args, 2);
-      case  2: values[1] = PyTuple_GET_ITEM(__pyx_args, 1);
-      case  1: values[0] = PyTuple_GET_ITEM(__pyx_args, 0);
-      case  0: break;
-      default: goto __pyx_L5_argtuple_error;
-    }
-    switch (PyTuple_GET_SIZE(__pyx_args)) {
-      case  0:
-      values[0] = PyDict_GetItem(__pyx_kwds, __pyx_kp_param);
-      if (likely(values[0])) kw_args--;
-      else goto __pyx_L5_argtuple_error;
-      case  1:
-      values[1] = PyDict_GetItem(__pyx_kwds, __pyx_kp_t0);
-      if (likely(values[1])) kw_args--;
-      else {
-        __Pyx_RaiseArgtupleInvalid("param_to_vector12", 0, 3, 4, 1); {__pyx_filename = __pyx_f[0]; __pyx_lineno = 454; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-      }
-      case  2:
-      values[2] = PyDict_GetItem(__pyx_kwds, __pyx_kp_precond);
-      if (likely(values[2])) kw_args--;
-      else {
-        __Pyx_RaiseArgtupleInvalid("param_to_vector12", 0, 3, 4, 2); {__pyx_filename = __pyx_f[0]; __pyx_lineno = 454; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-      }
-    }
-    if (unlikely(kw_args > 0)) {
-      if (unlikely(__Pyx_ParseOptionalKeywords(__pyx_kwds, __pyx_pyargnames, 0, values, PyTuple_GET_SIZE(__pyx_args), "param_to_vector12") < 0)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 454; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-    }
-    __pyx_v_param = ((PyArrayObject *)values[0]);
-    __pyx_v_t0 = ((PyArrayObject *)values[1]);
-    __pyx_v_precond = ((PyArrayObject *)values[2]);
-    if (values[3]) {
-      __pyx_v_stamp = __pyx_PyInt_int(values[3]); if (unlikely((__pyx_v_stamp == (int)-1) && PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 454; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-    }
-  } else {
-    switch (PyTuple_GET_SIZE(__pyx_args)) {
-      case  4:
-      __pyx_v_stamp = __pyx_PyInt_int(PyTuple_GET_ITEM(__pyx_args, 3)); if (unlikely((__pyx_v_stamp == (int)-1) && PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 454; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-      case  3:
-      __pyx_v_precond = ((PyArrayObject *)PyTuple_GET_ITEM(__pyx_args, 2));
-      __pyx_v_t0 = ((PyArrayObject *)PyTuple_GET_ITEM(__pyx_args, 1));
-      __pyx_v_param = ((PyArrayObject *)PyTuple_GET_ITEM(__pyx_args, 0));
-      break;
-      default: goto __pyx_L5_argtuple_error;
-    }
-  }
-  goto __pyx_L4_argument_unpacking_done;
-  __pyx_L5_argtuple_error:;
-  __Pyx_RaiseArgtupleInvalid("param_to_vector12", 0, 3, 4, PyTuple_GET_SIZE(__pyx_args)); {__pyx_filename = __pyx_f[0]; __pyx_lineno = 454; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-  __pyx_L3_error:;
-  __Pyx_AddTraceback("nipy.neurospin.register.routines.param_to_vector12");
-  return NULL;
-  __pyx_L4_argument_unpacking_done:;
-  __pyx_v_t = Py_None; Py_INCREF(Py_None);
-  if (unlikely(!__Pyx_ArgTypeTest(((PyObject *)__pyx_v_param), __pyx_ptype_4nipy_9neurospin_8register_8routines_ndarray, 1, "param", 0))) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 454; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  if (unlikely(!__Pyx_ArgTypeTest(((PyObject *)__pyx_v_t0), __pyx_ptype_4nipy_9neurospin_8register_8routines_ndarray, 1, "t0", 0))) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 454; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  if (unlikely(!__Pyx_ArgTypeTest(((PyObject *)__pyx_v_precond), __pyx_ptype_4nipy_9neurospin_8register_8routines_ndarray, 1, "precond", 0))) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 454; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-
-  /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":464
- *     integer stamp.
- *     """
- *     t = t0             # <<<<<<<<<<<<<<
- * 
- *     # Switch on transformation type
- */
-  Py_INCREF(((PyObject *)__pyx_v_t0));
-  Py_DECREF(__pyx_v_t);
-  __pyx_v_t = ((PyObject *)__pyx_v_t0);
-
-  /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":467
- * 
- *     # Switch on transformation type
- *     if stamp == RIGID3D:             # <<<<<<<<<<<<<<
- *         t[_rigid3d] = param*precond[_rigid3d]
- *     elif stamp == SIMILARITY3D:
- */
-  __pyx_1 = (__pyx_v_stamp == __pyx_e_4nipy_9neurospin_8register_8routines_RIGID3D);
-  if (__pyx_1) {
-
-    /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":468
- *     # Switch on transformation type
- *     if stamp == RIGID3D:
- *         t[_rigid3d] = param*precond[_rigid3d]             # <<<<<<<<<<<<<<
- *     elif stamp == SIMILARITY3D:
- *         t[_similarity3d] = param[[0,1,2,3,4,5,6,6,6]]*precond[_similarity3d]
- */
-    __pyx_2 = __Pyx_GetName(__pyx_m, __pyx_kp_48); if (unlikely(!__pyx_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 468; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __pyx_3 = PyObject_GetItem(((PyObject *)__pyx_v_precond), __pyx_2); if (!__pyx_3) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 468; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_DECREF(__pyx_2); __pyx_2 = 0;
-    __pyx_t_1 = PyNumber_Multiply(((PyObject *)__pyx_v_param), __pyx_3); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 468; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_DECREF(__pyx_3); __pyx_3 = 0;
-    __pyx_2 = __Pyx_GetName(__pyx_m, __pyx_kp_48); if (unlikely(!__pyx_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 468; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    if (PyObject_SetItem(__pyx_v_t, __pyx_2, __pyx_t_1) < 0) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 468; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_DECREF(__pyx_2); __pyx_2 = 0;
-    Py_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-    goto __pyx_L6;
-  }
-
-  /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":469
- *     if stamp == RIGID3D:
- *         t[_rigid3d] = param*precond[_rigid3d]
- *     elif stamp == SIMILARITY3D:             # <<<<<<<<<<<<<<
- *         t[_similarity3d] = param[[0,1,2,3,4,5,6,6,6]]*precond[_similarity3d]
- *     elif stamp == AFFINE3D:
- */
-  __pyx_1 = (__pyx_v_stamp == __pyx_e_4nipy_9neurospin_8register_8routines_SIMILARITY3D);
-  if (__pyx_1) {
-
-    /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":470
- *         t[_rigid3d] = param*precond[_rigid3d]
- *     elif stamp == SIMILARITY3D:
- *         t[_similarity3d] = param[[0,1,2,3,4,5,6,6,6]]*precond[_similarity3d]             # <<<<<<<<<<<<<<
- *     elif stamp == AFFINE3D:
- *         t = param*precond
- */
-    __pyx_3 = PyList_New(9); if (unlikely(!__pyx_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 470; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_INCREF(__pyx_int_0);
-    PyList_SET_ITEM(__pyx_3, 0, __pyx_int_0);
-    Py_INCREF(__pyx_int_1);
-    PyList_SET_ITEM(__pyx_3, 1, __pyx_int_1);
-    Py_INCREF(__pyx_int_2);
-    PyList_SET_ITEM(__pyx_3, 2, __pyx_int_2);
-    Py_INCREF(__pyx_int_3);
-    PyList_SET_ITEM(__pyx_3, 3, __pyx_int_3);
-    Py_INCREF(__pyx_int_4);
-    PyList_SET_ITEM(__pyx_3, 4, __pyx_int_4);
-    Py_INCREF(__pyx_int_5);
-    PyList_SET_ITEM(__pyx_3, 5, __pyx_int_5);
-    Py_INCREF(__pyx_int_6);
-    PyList_SET_ITEM(__pyx_3, 6, __pyx_int_6);
-    Py_INCREF(__pyx_int_6);
-    PyList_SET_ITEM(__pyx_3, 7, __pyx_int_6);
-    Py_INCREF(__pyx_int_6);
-    PyList_SET_ITEM(__pyx_3, 8, __pyx_int_6);
-    __pyx_2 = PyObject_GetItem(((PyObject *)__pyx_v_param), ((PyObject *)__pyx_3)); if (!__pyx_2) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 470; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_DECREF(((PyObject *)__pyx_3)); __pyx_3 = 0;
-    __pyx_3 = __Pyx_GetName(__pyx_m, __pyx_kp_49); if (unlikely(!__pyx_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 470; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __pyx_4 = PyObject_GetItem(((PyObject *)__pyx_v_precond), __pyx_3); if (!__pyx_4) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 470; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_DECREF(__pyx_3); __pyx_3 = 0;
-    __pyx_t_1 = PyNumber_Multiply(__pyx_2, __pyx_4); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 470; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_DECREF(__pyx_2); __pyx_2 = 0;
-    Py_DECREF(__pyx_4); __pyx_4 = 0;
-    __pyx_3 = __Pyx_GetName(__pyx_m, __pyx_kp_49); if (unlikely(!__pyx_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 470; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    if (PyObject_SetItem(__pyx_v_t, __pyx_3, __pyx_t_1) < 0) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 470; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_DECREF(__pyx_3); __pyx_3 = 0;
-    Py_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-    goto __pyx_L6;
-  }
-
-  /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":471
- *     elif stamp == SIMILARITY3D:
- *         t[_similarity3d] = param[[0,1,2,3,4,5,6,6,6]]*precond[_similarity3d]
- *     elif stamp == AFFINE3D:             # <<<<<<<<<<<<<<
- *         t = param*precond
- *     elif stamp == RIGID2D:
- */
-  __pyx_1 = (__pyx_v_stamp == __pyx_e_4nipy_9neurospin_8register_8routines_AFFINE3D);
-  if (__pyx_1) {
-
-    /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":472
- *         t[_similarity3d] = param[[0,1,2,3,4,5,6,6,6]]*precond[_similarity3d]
- *     elif stamp == AFFINE3D:
- *         t = param*precond             # <<<<<<<<<<<<<<
- *     elif stamp == RIGID2D:
- *         t[_rigid2d] = param*precond[_rigid2d]
- */
-    __pyx_t_1 = PyNumber_Multiply(((PyObject *)__pyx_v_param), ((PyObject *)__pyx_v_precond)); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 472; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_DECREF(__pyx_v_t);
-    __pyx_v_t = __pyx_t_1;
-    __pyx_t_1 = 0;
-    goto __pyx_L6;
-  }
-
-  /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":473
- *     elif stamp == AFFINE3D:
- *         t = param*precond
- *     elif stamp == RIGID2D:             # <<<<<<<<<<<<<<
- *         t[_rigid2d] = param*precond[_rigid2d]
- *     elif stamp == SIMILARITY2D:
- */
-  __pyx_1 = (__pyx_v_stamp == __pyx_e_4nipy_9neurospin_8register_8routines_RIGID2D);
-  if (__pyx_1) {
-
-    /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":474
- *         t = param*precond
- *     elif stamp == RIGID2D:
- *         t[_rigid2d] = param*precond[_rigid2d]             # <<<<<<<<<<<<<<
- *     elif stamp == SIMILARITY2D:
- *         t[_similarity2d] = param[[0,1,2,3,3]]*precond[_similarity2d]
- */
-    __pyx_2 = __Pyx_GetName(__pyx_m, __pyx_kp_45); if (unlikely(!__pyx_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 474; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __pyx_4 = PyObject_GetItem(((PyObject *)__pyx_v_precond), __pyx_2); if (!__pyx_4) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 474; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_DECREF(__pyx_2); __pyx_2 = 0;
-    __pyx_t_1 = PyNumber_Multiply(((PyObject *)__pyx_v_param), __pyx_4); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 474; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_DECREF(__pyx_4); __pyx_4 = 0;
-    __pyx_3 = __Pyx_GetName(__pyx_m, __pyx_kp_45); if (unlikely(!__pyx_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 474; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    if (PyObject_SetItem(__pyx_v_t, __pyx_3, __pyx_t_1) < 0) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 474; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_DECREF(__pyx_3); __pyx_3 = 0;
-    Py_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-    goto __pyx_L6;
-  }
-
-  /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":475
- *     elif stamp == RIGID2D:
- *         t[_rigid2d] = param*precond[_rigid2d]
- *     elif stamp == SIMILARITY2D:             # <<<<<<<<<<<<<<
- *         t[_similarity2d] = param[[0,1,2,3,3]]*precond[_similarity2d]
- *     elif stamp == AFFINE2D:
- */
-  __pyx_1 = (__pyx_v_stamp == __pyx_e_4nipy_9neurospin_8register_8routines_SIMILARITY2D);
-  if (__pyx_1) {
-
-    /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":476
- *         t[_rigid2d] = param*precond[_rigid2d]
- *     elif stamp == SIMILARITY2D:
- *         t[_similarity2d] = param[[0,1,2,3,3]]*precond[_similarity2d]             # <<<<<<<<<<<<<<
- *     elif stamp == AFFINE2D:
- *         t[_affine2d] = param*precond[_affine2d]
- */
-    __pyx_2 = PyList_New(5); if (unlikely(!__pyx_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 476; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_INCREF(__pyx_int_0);
-    PyList_SET_ITEM(__pyx_2, 0, __pyx_int_0);
-    Py_INCREF(__pyx_int_1);
-    PyList_SET_ITEM(__pyx_2, 1, __pyx_int_1);
-    Py_INCREF(__pyx_int_2);
-    PyList_SET_ITEM(__pyx_2, 2, __pyx_int_2);
-    Py_INCREF(__pyx_int_3);
-    PyList_SET_ITEM(__pyx_2, 3, __pyx_int_3);
-    Py_INCREF(__pyx_int_3);
-    PyList_SET_ITEM(__pyx_2, 4, __pyx_int_3);
-    __pyx_4 = PyObject_GetItem(((PyObject *)__pyx_v_param), ((PyObject *)__pyx_2)); if (!__pyx_4) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 476; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_DECREF(((PyObject *)__pyx_2)); __pyx_2 = 0;
-    __pyx_3 = __Pyx_GetName(__pyx_m, __pyx_kp_46); if (unlikely(!__pyx_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 476; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __pyx_2 = PyObject_GetItem(((PyObject *)__pyx_v_precond), __pyx_3); if (!__pyx_2) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 476; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_DECREF(__pyx_3); __pyx_3 = 0;
-    __pyx_t_1 = PyNumber_Multiply(__pyx_4, __pyx_2); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 476; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_DECREF(__pyx_4); __pyx_4 = 0;
-    Py_DECREF(__pyx_2); __pyx_2 = 0;
-    __pyx_3 = __Pyx_GetName(__pyx_m, __pyx_kp_46); if (unlikely(!__pyx_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 476; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    if (PyObject_SetItem(__pyx_v_t, __pyx_3, __pyx_t_1) < 0) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 476; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_DECREF(__pyx_3); __pyx_3 = 0;
-    Py_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-    goto __pyx_L6;
-  }
-
-  /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":477
- *     elif stamp == SIMILARITY2D:
- *         t[_similarity2d] = param[[0,1,2,3,3]]*precond[_similarity2d]
- *     elif stamp == AFFINE2D:             # <<<<<<<<<<<<<<
- *         t[_affine2d] = param*precond[_affine2d]
- * 
- */
-  __pyx_1 = (__pyx_v_stamp == __pyx_e_4nipy_9neurospin_8register_8routines_AFFINE2D);
-  if (__pyx_1) {
-
-    /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":478
- *         t[_similarity2d] = param[[0,1,2,3,3]]*precond[_similarity2d]
- *     elif stamp == AFFINE2D:
- *         t[_affine2d] = param*precond[_affine2d]             # <<<<<<<<<<<<<<
- * 
- *     return t
- */
-    __pyx_4 = __Pyx_GetName(__pyx_m, __pyx_kp_47); if (unlikely(!__pyx_4)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 478; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __pyx_2 = PyObject_GetItem(((PyObject *)__pyx_v_precond), __pyx_4); if (!__pyx_2) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 478; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_DECREF(__pyx_4); __pyx_4 = 0;
-    __pyx_t_1 = PyNumber_Multiply(((PyObject *)__pyx_v_param), __pyx_2); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 478; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_DECREF(__pyx_2); __pyx_2 = 0;
-    __pyx_3 = __Pyx_GetName(__pyx_m, __pyx_kp_47); if (unlikely(!__pyx_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 478; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    if (PyObject_SetItem(__pyx_v_t, __pyx_3, __pyx_t_1) < 0) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 478; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_DECREF(__pyx_3); __pyx_3 = 0;
-    Py_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-    goto __pyx_L6;
-  }
-  __pyx_L6:;
-
-  /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":480
- *         t[_affine2d] = param*precond[_affine2d]
- * 
- *     return t             # <<<<<<<<<<<<<<
- * 
- * 
- */
-  Py_INCREF(__pyx_v_t);
-  __pyx_r = __pyx_v_t;
-  goto __pyx_L0;
-
-  __pyx_r = Py_None; Py_INCREF(Py_None);
-  goto __pyx_L0;
-  __pyx_L1_error:;
-  Py_XDECREF(__pyx_2);
-  Py_XDECREF(__pyx_3);
-  Py_XDECREF(__pyx_4);
-  __Pyx_AddTraceback("nipy.neurospin.register.routines.param_to_vector12");
-  __pyx_r = NULL;
-  __pyx_L0:;
-  Py_DECREF(__pyx_v_t);
-  return __pyx_r;
-}
-
-/* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":483
- * 
- * 
- * def matrix44(ndarray t, dtype):             # <<<<<<<<<<<<<<
- *     """
- *     T = matrix44(t)
- */
-
-static PyObject *__pyx_pf_4nipy_9neurospin_8register_8routines_matrix44(PyObject *__pyx_self, PyObject *__pyx_args, PyObject *__pyx_kwds); /*proto*/
-static char __pyx_doc_4nipy_9neurospin_8register_8routines_matrix44[] = "\n    T = matrix44(t)\n\n    t is a vector of of affine transformation parameters with size at\n    least 6.\n\n    size < 6 ==> error\n    size == 6 ==> t is interpreted as translation + rotation\n    size == 7 ==> t is interpreted as translation + rotation + isotropic scaling\n    7 < size < 12 ==> error\n    size >= 12 ==> t is interpreted as translation + rotation + scaling + shearing \n    ";
-static PyObject *__pyx_pf_4nipy_9neurospin_8register_8routines_matrix44(PyObject *__pyx_self, PyObject *__pyx_args, PyObject *__pyx_kwds) {
-  PyArrayObject *__pyx_v_t = 0;
-  PyObject *__pyx_v_dtype = 0;
-  unsigned int __pyx_v_size;
-  PyObject *__pyx_v_T;
-  PyObject *__pyx_v_R;
-  PyObject *__pyx_v_S;
-  PyObject *__pyx_v_Q;
-  PyObject *__pyx_r;
-  PyObject *__pyx_1 = 0;
-  PyObject *__pyx_2 = 0;
-  PyObject *__pyx_3 = 0;
-  PyObject *__pyx_4 = 0;
-  int __pyx_5;
-  PyObject *__pyx_t_1 = NULL;
-  static PyObject **__pyx_pyargnames[] = {&__pyx_kp_t,&__pyx_kp_dtype,0};
-  __pyx_self = __pyx_self;
-  if (unlikely(__pyx_kwds)) {
-    PyObject* values[2] = {0,0};
-    Py_ssize_t kw_args = PyDict_Size(__pyx_kwds);
-    switch (PyTuple_GET_SIZE(__pyx_args)) {
-      case  2: values[1] = PyTuple_GET_ITEM(__pyx_args, 1);
-      case  1: values[0] = PyTuple_GET_ITEM(__pyx_args, 0);
-      case  0: break;
-      default: goto __pyx_L5_argtuple_error;
-    }
-    switch (PyTuple_GET_SIZE(__pyx_args)) {
-      case  0:
-      values[0] = PyDict_GetItem(__pyx_kwds, __pyx_kp_t);
-      if (likely(values[0])) kw_args--;
-      else goto __pyx_L5_argtuple_error;
-      case  1:
-      values[1] = PyDict_GetItem(__pyx_kwds, __pyx_kp_dtype);
-      if (likely(values[1])) kw_args--;
-      else {
-        __Pyx_RaiseArgtupleInvalid("matrix44", 1, 2, 2, 1); {__pyx_filename = __pyx_f[0]; __pyx_lineno = 483; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-      }
-    }
-    if (unlikely(kw_args > 0)) {
-      if (unlikely(__Pyx_ParseOptionalKeywords(__pyx_kwds, __pyx_pyargnames, 0, values, PyTuple_GET_SIZE(__pyx_args), "matrix44") < 0)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 483; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-    }
-    __pyx_v_t = ((PyArrayObject *)values[0]);
-    __pyx_v_dtype = values[1];
-  } else if (PyTuple_GET_SIZE(__pyx_args) != 2) {
-    goto __pyx_L5_argtuple_error;
-  } else {
-    __pyx_v_t = ((PyArrayObject *)PyTuple_GET_ITEM(__pyx_args, 0));
-    __pyx_v_dtype = PyTuple_GET_ITEM(__pyx_args, 1);
-  }
-  goto __pyx_L4_argument_unpacking_done;
-  __pyx_L5_argtuple_error:;
-  __Pyx_RaiseArgtupleInvalid("matrix44", 1, 2, 2, PyTuple_GET_SIZE(__pyx_args)); {__pyx_filename = __pyx_f[0]; __pyx_lineno = 483; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-  __pyx_L3_error:;
-  __Pyx_AddTraceback("nipy.neurospin.register.routines.matrix44");
-  return NULL;
-  __pyx_L4_argument_unpacking_done:;
-  __pyx_v_T = Py_None; Py_INCREF(Py_None);
-  __pyx_v_R = Py_None; Py_INCREF(Py_None);
-  __pyx_v_S = Py_None; Py_INCREF(Py_None);
-  __pyx_v_Q = Py_None; Py_INCREF(Py_None);
-  if (unlikely(!__Pyx_ArgTypeTest(((PyObject *)__pyx_v_t), __pyx_ptype_4nipy_9neurospin_8register_8routines_ndarray, 1, "t", 0))) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 483; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-
-  /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":497
- *     """
- *     cdef unsigned int size
- *     size = <unsigned int>PyArray_SIZE(t)             # <<<<<<<<<<<<<<
- *     T = np.eye(4, dtype=dtype)
- *     R = rotation_vec2mat(t[3:6])
- */
-  __pyx_v_size = ((unsigned int)PyArray_SIZE(__pyx_v_t));
-
-  /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":498
- *     cdef unsigned int size
- *     size = <unsigned int>PyArray_SIZE(t)
- *     T = np.eye(4, dtype=dtype)             # <<<<<<<<<<<<<<
- *     R = rotation_vec2mat(t[3:6])
- *     if size == 6:
- */
-  __pyx_1 = __Pyx_GetName(__pyx_m, __pyx_kp_np); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 498; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __pyx_2 = PyObject_GetAttr(__pyx_1, __pyx_kp_eye); if (unlikely(!__pyx_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 498; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_DECREF(__pyx_1); __pyx_1 = 0;
-  __pyx_1 = PyTuple_New(1); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 498; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_INCREF(__pyx_int_4);
-  PyTuple_SET_ITEM(__pyx_1, 0, __pyx_int_4);
-  __pyx_3 = PyDict_New(); if (unlikely(!__pyx_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 498; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  if (PyDict_SetItem(__pyx_3, __pyx_kp_dtype, __pyx_v_dtype) < 0) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 498; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __pyx_4 = PyEval_CallObjectWithKeywords(__pyx_2, ((PyObject *)__pyx_1), ((PyObject *)__pyx_3)); if (unlikely(!__pyx_4)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 498; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_DECREF(__pyx_2); __pyx_2 = 0;
-  Py_DECREF(((PyObject *)__pyx_1)); __pyx_1 = 0;
-  Py_DECREF(((PyObject *)__pyx_3)); __pyx_3 = 0;
-  Py_DECREF(__pyx_v_T);
-  __pyx_v_T = __pyx_4;
-  __pyx_4 = 0;
-
-  /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":499
- *     size = <unsigned int>PyArray_SIZE(t)
- *     T = np.eye(4, dtype=dtype)
- *     R = rotation_vec2mat(t[3:6])             # <<<<<<<<<<<<<<
- *     if size == 6:
- *         T[0:3,0:3] = R
- */
-  __pyx_2 = __Pyx_GetName(__pyx_m, __pyx_kp_67); if (unlikely(!__pyx_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 499; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __pyx_1 = PySequence_GetSlice(((PyObject *)__pyx_v_t), 3, 6); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 499; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __pyx_3 = PyTuple_New(1); if (unlikely(!__pyx_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 499; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  PyTuple_SET_ITEM(__pyx_3, 0, __pyx_1);
-  __pyx_1 = 0;
-  __pyx_4 = PyObject_Call(__pyx_2, ((PyObject *)__pyx_3), NULL); if (unlikely(!__pyx_4)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 499; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_DECREF(__pyx_2); __pyx_2 = 0;
-  Py_DECREF(((PyObject *)__pyx_3)); __pyx_3 = 0;
-  Py_DECREF(__pyx_v_R);
-  __pyx_v_R = __pyx_4;
-  __pyx_4 = 0;
-
-  /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":500
- *     T = np.eye(4, dtype=dtype)
- *     R = rotation_vec2mat(t[3:6])
- *     if size == 6:             # <<<<<<<<<<<<<<
- *         T[0:3,0:3] = R
- *     elif size == 7:
- */
-  switch (__pyx_v_size) {
-    case 6:
-
-    /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":501
- *     R = rotation_vec2mat(t[3:6])
- *     if size == 6:
- *         T[0:3,0:3] = R             # <<<<<<<<<<<<<<
- *     elif size == 7:
- *         T[0:3,0:3] = t[6]*R
- */
-    __pyx_1 = PySlice_New(__pyx_int_0, __pyx_int_3, Py_None); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 501; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __pyx_2 = PySlice_New(__pyx_int_0, __pyx_int_3, Py_None); if (unlikely(!__pyx_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 501; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __pyx_3 = PyTuple_New(2); if (unlikely(!__pyx_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 501; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    PyTuple_SET_ITEM(__pyx_3, 0, __pyx_1);
-    PyTuple_SET_ITEM(__pyx_3, 1, __pyx_2);
-    __pyx_1 = 0;
-    __pyx_2 = 0;
-    if (PyObject_SetItem(__pyx_v_T, ((PyObject *)__pyx_3), __pyx_v_R) < 0) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 501; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_DECREF(((PyObject *)__pyx_3)); __pyx_3 = 0;
-    break;
-    case 7:
-
-    /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":503
- *         T[0:3,0:3] = R
- *     elif size == 7:
- *         T[0:3,0:3] = t[6]*R             # <<<<<<<<<<<<<<
- *     else:
- *         S = np.diag(t[6:9])
- */
-    __pyx_4 = __Pyx_GetItemInt(((PyObject *)__pyx_v_t), 6, 0); if (!__pyx_4) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 503; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __pyx_t_1 = PyNumber_Multiply(__pyx_4, __pyx_v_R); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 503; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_DECREF(__pyx_4); __pyx_4 = 0;
-    __pyx_1 = PySlice_New(__pyx_int_0, __pyx_int_3, Py_None); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 503; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __pyx_2 = PySlice_New(__pyx_int_0, __pyx_int_3, Py_None); if (unlikely(!__pyx_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 503; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __pyx_3 = PyTuple_New(2); if (unlikely(!__pyx_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 503; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    PyTuple_SET_ITEM(__pyx_3, 0, __pyx_1);
-    PyTuple_SET_ITEM(__pyx_3, 1, __pyx_2);
-    __pyx_1 = 0;
-    __pyx_2 = 0;
-    if (PyObject_SetItem(__pyx_v_T, ((PyObject *)__pyx_3), __pyx_t_1) < 0) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 503; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_DECREF(((PyObject *)__pyx_3)); __pyx_3 = 0;
-    Py_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-    break;
-    default:
-
-    /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":505
- *         T[0:3,0:3] = t[6]*R
- *     else:
- *         S = np.diag(t[6:9])             # <<<<<<<<<<<<<<
- *         Q = rotation_vec2mat(t[9:12])
- *         # Beware: R*s*Q
- */
-    __pyx_4 = __Pyx_GetName(__pyx_m, __pyx_kp_np); if (unlikely(!__pyx_4)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 505; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __pyx_1 = PyObject_GetAttr(__pyx_4, __pyx_kp_diag); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 505; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_DECREF(__pyx_4); __pyx_4 = 0;
-    __pyx_2 = PySequence_GetSlice(((PyObject *)__pyx_v_t), 6, 9); if (unlikely(!__pyx_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 505; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __pyx_3 = PyTuple_New(1); if (unlikely(!__pyx_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 505; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    PyTuple_SET_ITEM(__pyx_3, 0, __pyx_2);
-    __pyx_2 = 0;
-    __pyx_4 = PyObject_Call(__pyx_1, ((PyObject *)__pyx_3), NULL); if (unlikely(!__pyx_4)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 505; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_DECREF(__pyx_1); __pyx_1 = 0;
-    Py_DECREF(((PyObject *)__pyx_3)); __pyx_3 = 0;
-    Py_DECREF(__pyx_v_S);
-    __pyx_v_S = __pyx_4;
-    __pyx_4 = 0;
-
-    /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":506
- *     else:
- *         S = np.diag(t[6:9])
- *         Q = rotation_vec2mat(t[9:12])             # <<<<<<<<<<<<<<
- *         # Beware: R*s*Q
- *         T[0:3,0:3] = np.dot(R,np.dot(S,Q))
- */
-    __pyx_2 = __Pyx_GetName(__pyx_m, __pyx_kp_67); if (unlikely(!__pyx_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 506; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __pyx_1 = PySequence_GetSlice(((PyObject *)__pyx_v_t), 9, 12); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 506; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __pyx_3 = PyTuple_New(1); if (unlikely(!__pyx_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 506; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    PyTuple_SET_ITEM(__pyx_3, 0, __pyx_1);
-    __pyx_1 = 0;
-    __pyx_4 = PyObject_Call(__pyx_2, ((PyObject *)__pyx_3), NULL); if (unlikely(!__pyx_4)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 506; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_DECREF(__pyx_2); __pyx_2 = 0;
-    Py_DECREF(((PyObject *)__pyx_3)); __pyx_3 = 0;
-    Py_DECREF(__pyx_v_Q);
-    __pyx_v_Q = __pyx_4;
-    __pyx_4 = 0;
-
-    /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":508
- *         Q = rotation_vec2mat(t[9:12])
- *         # Beware: R*s*Q
- *         T[0:3,0:3] = np.dot(R,np.dot(S,Q))             # <<<<<<<<<<<<<<
- *     T[0:3,3] = t[0:3]
- *     return T
- */
-    __pyx_1 = __Pyx_GetName(__pyx_m, __pyx_kp_np); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 508; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __pyx_2 = PyObject_GetAttr(__pyx_1, __pyx_kp_dot); if (unlikely(!__pyx_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 508; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_DECREF(__pyx_1); __pyx_1 = 0;
-    __pyx_3 = __Pyx_GetName(__pyx_m, __pyx_kp_np); if (unlikely(!__pyx_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 508; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __pyx_4 = PyObject_GetAttr(__pyx_3, __pyx_kp_dot); if (unlikely(!__pyx_4)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 508; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_DECREF(__pyx_3); __pyx_3 = 0;
-    __pyx_1 = PyTuple_New(2); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 508; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_INCREF(__pyx_v_S);
-    PyTuple_SET_ITEM(__pyx_1, 0, __pyx_v_S);
-    Py_INCREF(__pyx_v_Q);
-    PyTuple_SET_ITEM(__pyx_1, 1, __pyx_v_Q);
-    __pyx_3 = PyObject_Call(__pyx_4, ((PyObject *)__pyx_1), NULL); if (unlikely(!__pyx_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 508; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_DECREF(__pyx_4); __pyx_4 = 0;
-    Py_DECREF(((PyObject *)__pyx_1)); __pyx_1 = 0;
-    __pyx_4 = PyTuple_New(2); if (unlikely(!__pyx_4)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 508; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_INCREF(__pyx_v_R);
-    PyTuple_SET_ITEM(__pyx_4, 0, __pyx_v_R);
-    PyTuple_SET_ITEM(__pyx_4, 1, __pyx_3);
-    __pyx_3 = 0;
-    __pyx_1 = PyObject_Call(__pyx_2, ((PyObject *)__pyx_4), NULL); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 508; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_DECREF(__pyx_2); __pyx_2 = 0;
-    Py_DECREF(((PyObject *)__pyx_4)); __pyx_4 = 0;
-    __pyx_3 = PySlice_New(__pyx_int_0, __pyx_int_3, Py_None); if (unlikely(!__pyx_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 508; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __pyx_2 = PySlice_New(__pyx_int_0, __pyx_int_3, Py_None); if (unlikely(!__pyx_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 508; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __pyx_4 = PyTuple_New(2); if (unlikely(!__pyx_4)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 508; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    PyTuple_SET_ITEM(__pyx_4, 0, __pyx_3);
-    PyTuple_SET_ITEM(__pyx_4, 1, __pyx_2);
-    __pyx_3 = 0;
-    __pyx_2 = 0;
-    if (PyObject_SetItem(__pyx_v_T, ((PyObject *)__pyx_4), __pyx_1) < 0) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 508; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_DECREF(((PyObject *)__pyx_4)); __pyx_4 = 0;
-    Py_DECREF(__pyx_1); __pyx_1 = 0;
-    break;
-  }
-
-  /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":509
- *         # Beware: R*s*Q
- *         T[0:3,0:3] = np.dot(R,np.dot(S,Q))
- *     T[0:3,3] = t[0:3]             # <<<<<<<<<<<<<<
- *     return T
- * 
- */
-  __pyx_3 = PySequence_GetSlice(((PyObject *)__pyx_v_t), 0, 3); if (unlikely(!__pyx_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 509; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __pyx_2 = PySlice_New(__pyx_int_0, __pyx_int_3, Py_None); if (unlikely(!__pyx_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 509; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __pyx_1 = PyTuple_New(2); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 509; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  PyTuple_SET_ITEM(__pyx_1, 0, __pyx_2);
-  Py_INCREF(__pyx_int_3);
-  PyTuple_SET_ITEM(__pyx_1, 1, __pyx_int_3);
-  __pyx_2 = 0;
-  if (PyObject_SetItem(__pyx_v_T, ((PyObject *)__pyx_1), __pyx_3) < 0) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 509; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_DECREF(((PyObject *)__pyx_1)); __pyx_1 = 0;
-  Py_DECREF(__pyx_3); __pyx_3 = 0;
-
-  /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":510
- *         T[0:3,0:3] = np.dot(R,np.dot(S,Q))
- *     T[0:3,3] = t[0:3]
- *     return T             # <<<<<<<<<<<<<<
- * 
- * 
- */
-  Py_INCREF(__pyx_v_T);
-  __pyx_r = __pyx_v_T;
-  goto __pyx_L0;
-
-  __pyx_r = Py_None; Py_INCREF(Py_None);
-  goto __pyx_L0;
-  __pyx_L1_error:;
-  Py_XDECREF(__pyx_1);
-  Py_XDECREF(__pyx_2);
-  Py_XDECREF(__pyx_3);
-  Py_XDECREF(__pyx_4);
-  __Pyx_AddTraceback("nipy.neurospin.register.routines.matrix44");
-  __pyx_r = NULL;
-  __pyx_L0:;
-  Py_DECREF(__pyx_v_T);
-  Py_DECREF(__pyx_v_R);
-  Py_DECREF(__pyx_v_S);
-  Py_DECREF(__pyx_v_Q);
-  return __pyx_r;
-}
-
-/* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":50
- *         # experimental exception made for __getbuffer__ and __releasebuffer__
- *         # -- the details of this may change.
- *         def __getbuffer__(ndarray self, Py_buffer* info, int flags):             # <<<<<<<<<<<<<<
- *             # This implementation of getbuffer is geared towards Cython
- *             # requirements, and does not yet fullfill the PEP.
- */
-
-static int __pyx_pf_5numpy_7ndarray___getbuffer__(PyObject *__pyx_v_self, Py_buffer *__pyx_v_info, int __pyx_v_flags); /*proto*/
-static int __pyx_pf_5numpy_7ndarray___getbuffer__(PyObject *__pyx_v_self, Py_buffer *__pyx_v_info, int __pyx_v_flags) {
-  int __pyx_v_copy_shape;
-  int __pyx_v_i;
-  int __pyx_v_ndim;
-  int __pyx_v_t;
-  char *__pyx_v_f;
-  PyArray_Descr *__pyx_v_descr = 0;
-  PyObject *__pyx_v_stack;
-  int __pyx_v_hasfields;
-  PyObject *__pyx_v_iterator;
-  int __pyx_r;
-  int __pyx_1;
-  PyObject *__pyx_2 = 0;
-  PyObject *__pyx_3 = 0;
-  int __pyx_4;
-  PyObject *__pyx_5 = 0;
-  PyObject *__pyx_6 = 0;
-  PyObject *__pyx_7 = 0;
-  Py_ssize_t __pyx_8 = 0;
-  PyObject *__pyx_t_1 = NULL;
-  if (__pyx_v_info == NULL) return 0;
-  __pyx_v_info->obj = Py_None; Py_INCREF(Py_None);
-  __pyx_v_stack = ((PyObject *)Py_None); Py_INCREF(Py_None);
-  __pyx_v_iterator = Py_None; Py_INCREF(Py_None);
-
-  /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":56
- *             # of flags
- *             cdef int copy_shape, i, ndim
- *             ndim = PyArray_NDIM(self)             # <<<<<<<<<<<<<<
- * 
- *             if sizeof(npy_intp) != sizeof(Py_ssize_t):
- */
-  __pyx_v_ndim = PyArray_NDIM(((PyArrayObject *)__pyx_v_self));
-
-  /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":58
- *             ndim = PyArray_NDIM(self)
- * 
- *             if sizeof(npy_intp) != sizeof(Py_ssize_t):             # <<<<<<<<<<<<<<
- *                 copy_shape = 1
- *             else:
- */
-  __pyx_1 = ((sizeof(npy_intp)) != (sizeof(Py_ssize_t)));
-  if (__pyx_1) {
-
-    /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":59
- * 
- *             if sizeof(npy_intp) != sizeof(Py_ssize_t):
- *                 copy_shape = 1             # <<<<<<<<<<<<<<
- *             else:
- *                 copy_shape = 0
- */
-    __pyx_v_copy_shape = 1;
-    goto __pyx_L5;
-  }
-  /*else*/ {
-
-    /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":61
- *                 copy_shape = 1
- *             else:
- *                 copy_shape = 0             # <<<<<<<<<<<<<<
- * 
- *             if ((flags & pybuf.PyBUF_C_CONTIGUOUS == pybuf.PyBUF_C_CONTIGUOUS)
- */
-    __pyx_v_copy_shape = 0;
-  }
-  __pyx_L5:;
-
-  /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":63
- *                 copy_shape = 0
- * 
- *             if ((flags & pybuf.PyBUF_C_CONTIGUOUS == pybuf.PyBUF_C_CONTIGUOUS)             # <<<<<<<<<<<<<<
- *                 and not PyArray_CHKFLAGS(self, NPY_C_CONTIGUOUS)):
- *                 raise ValueError("ndarray is not C contiguous")
- */
-  __pyx_1 = ((__pyx_v_flags & PyBUF_C_CONTIGUOUS) == PyBUF_C_CONTIGUOUS);
-  if (__pyx_1) {
-
-    /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":64
- * 
- *             if ((flags & pybuf.PyBUF_C_CONTIGUOUS == pybuf.PyBUF_C_CONTIGUOUS)
- *                 and not PyArray_CHKFLAGS(self, NPY_C_CONTIGUOUS)):             # <<<<<<<<<<<<<<
- *                 raise ValueError("ndarray is not C contiguous")
- * 
- */
-    __pyx_1 = (!PyArray_CHKFLAGS(((PyArrayObject *)__pyx_v_self), NPY_C_CONTIGUOUS));
-  }
-  if (__pyx_1) {
-
-    /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":65
- *             if ((flags & pybuf.PyBUF_C_CONTIGUOUS == pybuf.PyBUF_C_CONTIGUOUS)
- *                 and not PyArray_CHKFLAGS(self, NPY_C_CONTIGUOUS)):
- *                 raise ValueError("ndarray is not C contiguous")             # <<<<<<<<<<<<<<
- * 
- *             if ((flags & pybuf.PyBUF_F_CONTIGUOUS == pybuf.PyBUF_F_CONTIGUOUS)
- */
-    __pyx_2 = PyTuple_New(1); if (unlikely(!__pyx_2)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 65; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_INCREF(__pyx_kp_1);
-    PyTuple_SET_ITEM(__pyx_2, 0, __pyx_kp_1);
-    __pyx_3 = PyObject_Call(__pyx_builtin_ValueError, ((PyObject *)__pyx_2), NULL); if (unlikely(!__pyx_3)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 65; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_DECREF(((PyObject *)__pyx_2)); __pyx_2 = 0;
-    __Pyx_Raise(__pyx_3, 0, 0);
-    Py_DECREF(__pyx_3); __pyx_3 = 0;
-    {__pyx_filename = __pyx_f[1]; __pyx_lineno = 65; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    goto __pyx_L6;
-  }
-  __pyx_L6:;
-
-  /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":67
- *                 raise ValueError("ndarray is not C contiguous")
- * 
- *             if ((flags & pybuf.PyBUF_F_CONTIGUOUS == pybuf.PyBUF_F_CONTIGUOUS)             # <<<<<<<<<<<<<<
- *                 and not PyArray_CHKFLAGS(self, NPY_F_CONTIGUOUS)):
- *                 raise ValueError("ndarray is not Fortran contiguous")
- */
-  __pyx_1 = ((__pyx_v_flags & PyBUF_F_CONTIGUOUS) == PyBUF_F_CONTIGUOUS);
-  if (__pyx_1) {
-
-    /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":68
- * 
- *             if ((flags & pybuf.PyBUF_F_CONTIGUOUS == pybuf.PyBUF_F_CONTIGUOUS)
- *                 and not PyArray_CHKFLAGS(self, NPY_F_CONTIGUOUS)):             # <<<<<<<<<<<<<<
- *                 raise ValueError("ndarray is not Fortran contiguous")
- * 
- */
-    __pyx_1 = (!PyArray_CHKFLAGS(((PyArrayObject *)__pyx_v_self), NPY_F_CONTIGUOUS));
-  }
-  if (__pyx_1) {
-
-    /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":69
- *             if ((flags & pybuf.PyBUF_F_CONTIGUOUS == pybuf.PyBUF_F_CONTIGUOUS)
- *                 and not PyArray_CHKFLAGS(self, NPY_F_CONTIGUOUS)):
- *                 raise ValueError("ndarray is not Fortran contiguous")             # <<<<<<<<<<<<<<
- * 
- *             info.buf = PyArray_DATA(self)
- */
-    __pyx_2 = PyTuple_New(1); if (unlikely(!__pyx_2)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 69; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_INCREF(__pyx_kp_2);
-    PyTuple_SET_ITEM(__pyx_2, 0, __pyx_kp_2);
-    __pyx_3 = PyObject_Call(__pyx_builtin_ValueError, ((PyObject *)__pyx_2), NULL); if (unlikely(!__pyx_3)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 69; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_DECREF(((PyObject *)__pyx_2)); __pyx_2 = 0;
-    __Pyx_Raise(__pyx_3, 0, 0);
-    Py_DECREF(__pyx_3); __pyx_3 = 0;
-    {__pyx_filename = __pyx_f[1]; __pyx_lineno = 69; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    goto __pyx_L7;
-  }
-  __pyx_L7:;
-
-  /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":71
- *                 raise ValueError("ndarray is not Fortran contiguous")
- * 
- *             info.buf = PyArray_DATA(self)             # <<<<<<<<<<<<<<
- *             info.ndim = ndim
- *             if copy_shape:
- */
-  __pyx_v_info->buf = PyArray_DATA(((PyArrayObject *)__pyx_v_self));
-
-  /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":72
- * 
- *             info.buf = PyArray_DATA(self)
- *             info.ndim = ndim             # <<<<<<<<<<<<<<
- *             if copy_shape:
- *                 # Allocate new buffer for strides and shape info. This is allocated
- */
-  __pyx_v_info->ndim = __pyx_v_ndim;
-
-  /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":73
- *             info.buf = PyArray_DATA(self)
- *             info.ndim = ndim
- *             if copy_shape:             # <<<<<<<<<<<<<<
- *                 # Allocate new buffer for strides and shape info. This is allocated
- *                 # as one block, strides first.
- */
-  __pyx_4 = __pyx_v_copy_shape;
-  if (__pyx_4) {
-
-    /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":76
- *                 # Allocate new buffer for strides and shape info. This is allocated
- *                 # as one block, strides first.
- *                 info.strides = <Py_ssize_t*>stdlib.malloc(sizeof(Py_ssize_t) * ndim * 2)             # <<<<<<<<<<<<<<
- *                 info.shape = info.strides + ndim
- *                 for i in range(ndim):
- */
-    __pyx_v_info->strides = ((Py_ssize_t *)malloc((((sizeof(Py_ssize_t)) * __pyx_v_ndim) * 2)));
-
-    /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":77
- *                 # as one block, strides first.
- *                 info.strides = <Py_ssize_t*>stdlib.malloc(sizeof(Py_ssize_t) * ndim * 2)
- *                 info.shape = info.strides + ndim             # <<<<<<<<<<<<<<
- *                 for i in range(ndim):
- *                     info.strides[i] = PyArray_STRIDES(self)[i]
- */
-    __pyx_v_info->shape = (__pyx_v_info->strides + __pyx_v_ndim);
-
-    /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":78
- *                 info.strides = <Py_ssize_t*>stdlib.malloc(sizeof(Py_ssize_t) * ndim * 2)
- *                 info.shape = info.strides + ndim
- *                 for i in range(ndim):             # <<<<<<<<<<<<<<
- *                     info.strides[i] = PyArray_STRIDES(self)[i]
- *                     info.shape[i] = PyArray_DIMS(self)[i]
- */
-    for (__pyx_v_i = 0; __pyx_v_i < __pyx_v_ndim; __pyx_v_i+=1) {
-
-      /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":79
- *                 info.shape = info.strides + ndim
- *                 for i in range(ndim):
- *                     info.strides[i] = PyArray_STRIDES(self)[i]             # <<<<<<<<<<<<<<
- *                     info.shape[i] = PyArray_DIMS(self)[i]
- *             else:
- */
-      (__pyx_v_info->strides[__pyx_v_i]) = (PyArray_STRIDES(((PyArrayObject *)__pyx_v_self))[__pyx_v_i]);
-
-      /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":80
- *                 for i in range(ndim):
- *                     info.strides[i] = PyArray_STRIDES(self)[i]
- *                     info.shape[i] = PyArray_DIMS(self)[i]             # <<<<<<<<<<<<<<
- *             else:
- *                 info.strides = <Py_ssize_t*>PyArray_STRIDES(self)
- */
-      (__pyx_v_info->shape[__pyx_v_i]) = (PyArray_DIMS(((PyArrayObject *)__pyx_v_self))[__pyx_v_i]);
-    }
-    goto __pyx_L8;
-  }
-  /*else*/ {
-
-    /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":82
- *                     info.shape[i] = PyArray_DIMS(self)[i]
- *             else:
- *                 info.strides = <Py_ssize_t*>PyArray_STRIDES(self)             # <<<<<<<<<<<<<<
- *                 info.shape = <Py_ssize_t*>PyArray_DIMS(self)
- *             info.suboffsets = NULL
- */
-    __pyx_v_info->strides = ((Py_ssize_t *)PyArray_STRIDES(((PyArrayObject *)__pyx_v_self)));
-
-    /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":83
- *             else:
- *                 info.strides = <Py_ssize_t*>PyArray_STRIDES(self)
- *                 info.shape = <Py_ssize_t*>PyArray_DIMS(self)             # <<<<<<<<<<<<<<
- *             info.suboffsets = NULL
- *             info.itemsize = PyArray_ITEMSIZE(self)
- */
-    __pyx_v_info->shape = ((Py_ssize_t *)PyArray_DIMS(((PyArrayObject *)__pyx_v_self)));
-  }
-  __pyx_L8:;
-
-  /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":84
- *                 info.strides = <Py_ssize_t*>PyArray_STRIDES(self)
- *                 info.shape = <Py_ssize_t*>PyArray_DIMS(self)
- *             info.suboffsets = NULL             # <<<<<<<<<<<<<<
- *             info.itemsize = PyArray_ITEMSIZE(self)
- *             info.readonly = not PyArray_ISWRITEABLE(self)
- */
-  __pyx_v_info->suboffsets = NULL;
-
-  /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":85
- *                 info.shape = <Py_ssize_t*>PyArray_DIMS(self)
- *             info.suboffsets = NULL
- *             info.itemsize = PyArray_ITEMSIZE(self)             # <<<<<<<<<<<<<<
- *             info.readonly = not PyArray_ISWRITEABLE(self)
- * 
- */
-  __pyx_v_info->itemsize = PyArray_ITEMSIZE(((PyArrayObject *)__pyx_v_self));
-
-  /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":86
- *             info.suboffsets = NULL
- *             info.itemsize = PyArray_ITEMSIZE(self)
- *             info.readonly = not PyArray_ISWRITEABLE(self)             # <<<<<<<<<<<<<<
- * 
- *             cdef int t
- */
-  __pyx_v_info->readonly = (!PyArray_ISWRITEABLE(((PyArrayObject *)__pyx_v_self)));
-
-  /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":89
- * 
- *             cdef int t
- *             cdef char* f = NULL             # <<<<<<<<<<<<<<
- *             cdef dtype descr = self.descr
- *             cdef list stack
- */
-  __pyx_v_f = NULL;
-
-  /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":90
- *             cdef int t
- *             cdef char* f = NULL
- *             cdef dtype descr = self.descr             # <<<<<<<<<<<<<<
- *             cdef list stack
- * 
- */
-  Py_INCREF(((PyObject *)((PyArrayObject *)__pyx_v_self)->descr));
-  __pyx_v_descr = ((PyArrayObject *)__pyx_v_self)->descr;
-
-  /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":93
- *             cdef list stack
- * 
- *             cdef bint hasfields = PyDataType_HASFIELDS(descr)             # <<<<<<<<<<<<<<
- * 
- *             # Ugly hack warning:
- */
-  __pyx_v_hasfields = PyDataType_HASFIELDS(__pyx_v_descr);
-
-  /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":103
- *             # functions).
- * 
- *             if not hasfields and not copy_shape:             # <<<<<<<<<<<<<<
- *                 # do not call releasebuffer
- *                 info.obj = None
- */
-  __pyx_1 = (!__pyx_v_hasfields);
-  if (__pyx_1) {
-    __pyx_1 = (!__pyx_v_copy_shape);
-  }
-  if (__pyx_1) {
-
-    /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":105
- *             if not hasfields and not copy_shape:
- *                 # do not call releasebuffer
- *                 info.obj = None             # <<<<<<<<<<<<<<
- *             else:
- *                 # need to call releasebuffer
- */
-    Py_INCREF(Py_None);
-    Py_DECREF(__pyx_v_info->obj);
-    __pyx_v_info->obj = Py_None;
-    goto __pyx_L11;
-  }
-  /*else*/ {
-
-    /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":108
- *             else:
- *                 # need to call releasebuffer
- *                 info.obj = self             # <<<<<<<<<<<<<<
- * 
- *             if not hasfields:
- */
-    Py_INCREF(__pyx_v_self);
-    Py_DECREF(__pyx_v_info->obj);
-    __pyx_v_info->obj = __pyx_v_self;
-  }
-  __pyx_L11:;
-
-  /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":110
- *                 info.obj = self
- * 
- *             if not hasfields:             # <<<<<<<<<<<<<<
- *                 t = descr.type_num
- *                 if   t == NPY_BYTE:        f = "b"
- */
-  __pyx_1 = (!__pyx_v_hasfields);
-  if (__pyx_1) {
-
-    /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":111
- * 
- *             if not hasfields:
- *                 t = descr.type_num             # <<<<<<<<<<<<<<
- *                 if   t == NPY_BYTE:        f = "b"
- *                 elif t == NPY_UBYTE:       f = "B"
- */
-    __pyx_v_t = __pyx_v_descr->type_num;
-
-    /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":112
- *             if not hasfields:
- *                 t = descr.type_num
- *                 if   t == NPY_BYTE:        f = "b"             # <<<<<<<<<<<<<<
- *                 elif t == NPY_UBYTE:       f = "B"
- *                 elif t == NPY_SHORT:       f = "h"
- */
-    switch (__pyx_v_t) {
-      case NPY_BYTE:
-      __pyx_v_f = __pyx_k_3;
-      break;
-      case NPY_UBYTE:
-
-      /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":113
- *                 t = descr.type_num
- *                 if   t == NPY_BYTE:        f = "b"
- *                 elif t == NPY_UBYTE:       f = "B"             # <<<<<<<<<<<<<<
- *                 elif t == NPY_SHORT:       f = "h"
- *                 elif t == NPY_USHORT:      f = "H"
- */
-      __pyx_v_f = __pyx_k_4;
-      break;
-      case NPY_SHORT:
-
-      /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":114
- *                 if   t == NPY_BYTE:        f = "b"
- *                 elif t == NPY_UBYTE:       f = "B"
- *                 elif t == NPY_SHORT:       f = "h"             # <<<<<<<<<<<<<<
- *                 elif t == NPY_USHORT:      f = "H"
- *                 elif t == NPY_INT:         f = "i"
- */
-      __pyx_v_f = __pyx_k_5;
-      break;
-      case NPY_USHORT:
-
-      /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":115
- *                 elif t == NPY_UBYTE:       f = "B"
- *                 elif t == NPY_SHORT:       f = "h"
- *                 elif t == NPY_USHORT:      f = "H"             # <<<<<<<<<<<<<<
- *                 elif t == NPY_INT:         f = "i"
- *                 elif t == NPY_UINT:        f = "I"
- */
-      __pyx_v_f = __pyx_k_6;
-      break;
-      case NPY_INT:
-
-      /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":116
- *                 elif t == NPY_SHORT:       f = "h"
- *                 elif t == NPY_USHORT:      f = "H"
- *                 elif t == NPY_INT:         f = "i"             # <<<<<<<<<<<<<<
- *                 elif t == NPY_UINT:        f = "I"
- *                 elif t == NPY_LONG:        f = "l"
- */
-      __pyx_v_f = __pyx_k_7;
-      break;
-      case NPY_UINT:
-
-      /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":117
- *                 elif t == NPY_USHORT:      f = "H"
- *                 elif t == NPY_INT:         f = "i"
- *                 elif t == NPY_UINT:        f = "I"             # <<<<<<<<<<<<<<
- *                 elif t == NPY_LONG:        f = "l"
- *                 elif t == NPY_ULONG:       f = "L"
- */
-      __pyx_v_f = __pyx_k_8;
-      break;
-      case NPY_LONG:
-
-      /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":118
- *                 elif t == NPY_INT:         f = "i"
- *                 elif t == NPY_UINT:        f = "I"
- *                 elif t == NPY_LONG:        f = "l"             # <<<<<<<<<<<<<<
- *                 elif t == NPY_ULONG:       f = "L"
- *                 elif t == NPY_LONGLONG:    f = "q"
- */
-      __pyx_v_f = __pyx_k_9;
-      break;
-      case NPY_ULONG:
-
-      /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":119
- *                 elif t == NPY_UINT:        f = "I"
- *                 elif t == NPY_LONG:        f = "l"
- *                 elif t == NPY_ULONG:       f = "L"             # <<<<<<<<<<<<<<
- *                 elif t == NPY_LONGLONG:    f = "q"
- *                 elif t == NPY_ULONGLONG:   f = "Q"
- */
-      __pyx_v_f = __pyx_k_10;
-      break;
-      case NPY_LONGLONG:
-
-      /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":120
- *                 elif t == NPY_LONG:        f = "l"
- *                 elif t == NPY_ULONG:       f = "L"
- *                 elif t == NPY_LONGLONG:    f = "q"             # <<<<<<<<<<<<<<
- *                 elif t == NPY_ULONGLONG:   f = "Q"
- *                 elif t == NPY_FLOAT:       f = "f"
- */
-      __pyx_v_f = __pyx_k_11;
-      break;
-      case NPY_ULONGLONG:
-
-      /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":121
- *                 elif t == NPY_ULONG:       f = "L"
- *                 elif t == NPY_LONGLONG:    f = "q"
- *                 elif t == NPY_ULONGLONG:   f = "Q"             # <<<<<<<<<<<<<<
- *                 elif t == NPY_FLOAT:       f = "f"
- *                 elif t == NPY_DOUBLE:      f = "d"
- */
-      __pyx_v_f = __pyx_k_12;
-      break;
-      case NPY_FLOAT:
-
-      /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":122
- *                 elif t == NPY_LONGLONG:    f = "q"
- *                 elif t == NPY_ULONGLONG:   f = "Q"
- *                 elif t == NPY_FLOAT:       f = "f"             # <<<<<<<<<<<<<<
- *                 elif t == NPY_DOUBLE:      f = "d"
- *                 elif t == NPY_LONGDOUBLE:  f = "g"
- */
-      __pyx_v_f = __pyx_k_13;
-      break;
-      case NPY_DOUBLE:
-
-      /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":123
- *                 elif t == NPY_ULONGLONG:   f = "Q"
- *                 elif t == NPY_FLOAT:       f = "f"
- *                 elif t == NPY_DOUBLE:      f = "d"             # <<<<<<<<<<<<<<
- *                 elif t == NPY_LONGDOUBLE:  f = "g"
- *                 elif t == NPY_CFLOAT:      f = "Zf"
- */
-      __pyx_v_f = __pyx_k_14;
-      break;
-      case NPY_LONGDOUBLE:
-
-      /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":124
- *                 elif t == NPY_FLOAT:       f = "f"
- *                 elif t == NPY_DOUBLE:      f = "d"
- *                 elif t == NPY_LONGDOUBLE:  f = "g"             # <<<<<<<<<<<<<<
- *                 elif t == NPY_CFLOAT:      f = "Zf"
- *                 elif t == NPY_CDOUBLE:     f = "Zd"
- */
-      __pyx_v_f = __pyx_k_15;
-      break;
-      case NPY_CFLOAT:
-
-      /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":125
- *                 elif t == NPY_DOUBLE:      f = "d"
- *                 elif t == NPY_LONGDOUBLE:  f = "g"
- *                 elif t == NPY_CFLOAT:      f = "Zf"             # <<<<<<<<<<<<<<
- *                 elif t == NPY_CDOUBLE:     f = "Zd"
- *                 elif t == NPY_CLONGDOUBLE: f = "Zg"
- */
-      __pyx_v_f = __pyx_k_16;
-      break;
-      case NPY_CDOUBLE:
-
-      /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":126
- *                 elif t == NPY_LONGDOUBLE:  f = "g"
- *                 elif t == NPY_CFLOAT:      f = "Zf"
- *                 elif t == NPY_CDOUBLE:     f = "Zd"             # <<<<<<<<<<<<<<
- *                 elif t == NPY_CLONGDOUBLE: f = "Zg"
- *                 elif t == NPY_OBJECT:      f = "O"
- */
-      __pyx_v_f = __pyx_k_17;
-      break;
-      case NPY_CLONGDOUBLE:
-
-      /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":127
- *                 elif t == NPY_CFLOAT:      f = "Zf"
- *                 elif t == NPY_CDOUBLE:     f = "Zd"
- *                 elif t == NPY_CLONGDOUBLE: f = "Zg"             # <<<<<<<<<<<<<<
- *                 elif t == NPY_OBJECT:      f = "O"
- *                 else:
- */
-      __pyx_v_f = __pyx_k_18;
-      break;
-      case NPY_OBJECT:
-
-      /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":128
- *                 elif t == NPY_CDOUBLE:     f = "Zd"
- *                 elif t == NPY_CLONGDOUBLE: f = "Zg"
- *                 elif t == NPY_OBJECT:      f = "O"             # <<<<<<<<<<<<<<
- *                 else:
- *                     raise ValueError("unknown dtype code in numpy.pxd (%d)" % t)
- */
-      __pyx_v_f = __pyx_k_19;
-      break;
-      default:
-
-      /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":130
- *                 elif t == NPY_OBJECT:      f = "O"
- *                 else:
- *                     raise ValueError("unknown dtype code in numpy.pxd (%d)" % t)             # <<<<<<<<<<<<<<
- *                 info.format = f
- *                 return
- */
-      __pyx_2 = PyInt_FromLong(__pyx_v_t); if (unlikely(!__pyx_2)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 130; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-      __pyx_t_1 = PyNumber_Remainder(__pyx_kp_20, __pyx_2); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 130; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-      Py_DECREF(__pyx_2); __pyx_2 = 0;
-      __pyx_3 = PyTuple_New(1); if (unlikely(!__pyx_3)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 130; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-      PyTuple_SET_ITEM(__pyx_3, 0, __pyx_t_1);
-      __pyx_t_1 = 0;
-      __pyx_2 = PyObject_Call(__pyx_builtin_ValueError, ((PyObject *)__pyx_3), NULL); if (unlikely(!__pyx_2)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 130; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-      Py_DECREF(((PyObject *)__pyx_3)); __pyx_3 = 0;
-      __Pyx_Raise(__pyx_2, 0, 0);
-      Py_DECREF(__pyx_2); __pyx_2 = 0;
-      {__pyx_filename = __pyx_f[1]; __pyx_lineno = 130; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-      break;
-    }
-
-    /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":131
- *                 else:
- *                     raise ValueError("unknown dtype code in numpy.pxd (%d)" % t)
- *                 info.format = f             # <<<<<<<<<<<<<<
- *                 return
- *             else:
- */
-    __pyx_v_info->format = __pyx_v_f;
-
-    /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":132
- *                     raise ValueError("unknown dtype code in numpy.pxd (%d)" % t)
- *                 info.format = f
- *                 return             # <<<<<<<<<<<<<<
- *             else:
- *                 info.format = <char*>stdlib.malloc(255) # static size
- */
-    __pyx_r = 0;
-    goto __pyx_L0;
-    goto __pyx_L12;
-  }
-  /*else*/ {
-
-    /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":134
- *                 return
- *             else:
- *                 info.format = <char*>stdlib.malloc(255) # static size             # <<<<<<<<<<<<<<
- *                 f = info.format
- *                 stack = [iter(descr.fields.iteritems())]
- */
-    __pyx_v_info->format = ((char *)malloc(255));
-
-    /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":135
- *             else:
- *                 info.format = <char*>stdlib.malloc(255) # static size
- *                 f = info.format             # <<<<<<<<<<<<<<
- *                 stack = [iter(descr.fields.iteritems())]
- * 
- */
-    __pyx_v_f = __pyx_v_info->format;
-
-    /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":136
- *                 info.format = <char*>stdlib.malloc(255) # static size
- *                 f = info.format
- *                 stack = [iter(descr.fields.iteritems())]             # <<<<<<<<<<<<<<
- * 
- *                 while True:
- */
-    __pyx_3 = PyObject_GetAttr(__pyx_v_descr->fields, __pyx_kp_iteritems); if (unlikely(!__pyx_3)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 136; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __pyx_2 = PyObject_Call(__pyx_3, ((PyObject *)__pyx_empty_tuple), NULL); if (unlikely(!__pyx_2)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 136; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_DECREF(__pyx_3); __pyx_3 = 0;
-    __pyx_3 = PyObject_GetIter(__pyx_2); if (unlikely(!__pyx_3)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 136; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    Py_DECREF(__pyx_2); __pyx_2 = 0;
-    __pyx_2 = PyList_New(1); if (unlikely(!__pyx_2)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 136; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    PyList_SET_ITEM(__pyx_2, 0, __pyx_3);
-    __pyx_3 = 0;
-    Py_DECREF(((PyObject *)__pyx_v_stack));
-    __pyx_v_stack = __pyx_2;
-    __pyx_2 = 0;
-
-    /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":138
- *                 stack = [iter(descr.fields.iteritems())]
- * 
- *                 while True:             # <<<<<<<<<<<<<<
- *                     iterator = stack[-1]
- *                     descr = None
- */
-    while (1) {
-      __pyx_1 = 1;
-      if (!__pyx_1) break;
-
-      /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":139
- * 
- *                 while True:
- *                     iterator = stack[-1]             # <<<<<<<<<<<<<<
- *                     descr = None
- *                     while descr is None:
- */
-      __pyx_3 = __Pyx_GetItemInt(((PyObject *)__pyx_v_stack), -1, 0); if (!__pyx_3) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 139; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-      Py_DECREF(__pyx_v_iterator);
-      __pyx_v_iterator = __pyx_3;
-      __pyx_3 = 0;
-
-      /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":140
- *                 while True:
- *                     iterator = stack[-1]
- *                     descr = None             # <<<<<<<<<<<<<<
- *                     while descr is None:
- *                         try:
- */
-      Py_INCREF(Py_None);
-      Py_DECREF(((PyObject *)__pyx_v_descr));
-      __pyx_v_descr = ((PyArray_Descr *)Py_None);
-
-      /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":141
- *                     iterator = stack[-1]
- *                     descr = None
- *                     while descr is None:             # <<<<<<<<<<<<<<
- *                         try:
- *                             descr = iterator.next()[1][0]
- */
-      while (1) {
-        __pyx_1 = (((PyObject *)__pyx_v_descr) == Py_None);
-        if (!__pyx_1) break;
-
-        /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":142
- *                     descr = None
- *                     while descr is None:
- *                         try:             # <<<<<<<<<<<<<<
- *                             descr = iterator.next()[1][0]
- *                         except StopIteration:
- */
-        {
-          PyObject *__pyx_save_exc_type, *__pyx_save_exc_value, *__pyx_save_exc_tb;
-          __Pyx_ExceptionSave(&__pyx_save_exc_type, &__pyx_save_exc_value, &__pyx_save_exc_tb);
-          /*try:*/ {
-
-            /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":143
- *                     while descr is None:
- *                         try:
- *                             descr = iterator.next()[1][0]             # <<<<<<<<<<<<<<
- *                         except StopIteration:
- *                             stack.pop()
- */
-            __pyx_2 = PyObject_GetAttr(__pyx_v_iterator, __pyx_kp_next); if (unlikely(!__pyx_2)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 143; __pyx_clineno = __LINE__; goto __pyx_L17_error;}
-            __pyx_3 = PyObject_Call(__pyx_2, ((PyObject *)__pyx_empty_tuple), NULL); if (unlikely(!__pyx_3)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 143; __pyx_clineno = __LINE__; goto __pyx_L17_error;}
-            Py_DECREF(__pyx_2); __pyx_2 = 0;
-            __pyx_2 = __Pyx_GetItemInt(__pyx_3, 1, 0); if (!__pyx_2) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 143; __pyx_clineno = __LINE__; goto __pyx_L17_error;}
-            Py_DECREF(__pyx_3); __pyx_3 = 0;
-            __pyx_3 = __Pyx_GetItemInt(__pyx_2, 0, 0); if (!__pyx_3) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 143; __pyx_clineno = __LINE__; goto __pyx_L17_error;}
-            Py_DECREF(__pyx_2); __pyx_2 = 0;
-            if (!(__Pyx_TypeTest(__pyx_3, __pyx_ptype_5numpy_dtype))) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 143; __pyx_clineno = __LINE__; goto __pyx_L17_error;}
-            Py_DECREF(((PyObject *)__pyx_v_descr));
-            __pyx_v_descr = ((PyArray_Descr *)__pyx_3);
-            __pyx_3 = 0;
-          }
-          Py_XDECREF(__pyx_save_exc_type); __pyx_save_exc_type = 0;
-          Py_XDECREF(__pyx_save_exc_value); __pyx_save_exc_value = 0;
-          Py_XDECREF(__pyx_save_exc_tb); __pyx_save_exc_tb = 0;
-          goto __pyx_L22_try;
-          __pyx_L17_error:;
-          Py_XDECREF(__pyx_2); __pyx_2 = 0;
-          Py_XDECREF(__pyx_3); __pyx_3 = 0;
-
-          /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":144
- *                         try:
- *                             descr = iterator.next()[1][0]
- *                         except StopIteration:             # <<<<<<<<<<<<<<
- *                             stack.pop()
- *                             if len(stack) > 0:
- */
-          __pyx_4 = PyErr_ExceptionMatches(__pyx_builtin_StopIteration);
-          if (__pyx_4) {
-            __Pyx_AddTraceback("numpy.__getbuffer__");
-            if (__Pyx_GetException(&__pyx_2, &__pyx_3, &__pyx_5) < 0) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 144; __pyx_clineno = __LINE__; goto __pyx_L19_except_error;}
-
-            /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":145
- *                             descr = iterator.next()[1][0]
- *                         except StopIteration:
- *                             stack.pop()             # <<<<<<<<<<<<<<
- *                             if len(stack) > 0:
- *                                 f[0] = 125 #"}"
- */
-            __pyx_6 = PyObject_GetAttr(((PyObject *)__pyx_v_stack), __pyx_kp_pop); if (unlikely(!__pyx_6)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 145; __pyx_clineno = __LINE__; goto __pyx_L19_except_error;}
-            __pyx_7 = PyObject_Call(__pyx_6, ((PyObject *)__pyx_empty_tuple), NULL); if (unlikely(!__pyx_7)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 145; __pyx_clineno = __LINE__; goto __pyx_L19_except_error;}
-            Py_DECREF(__pyx_6); __pyx_6 = 0;
-            Py_DECREF(__pyx_7); __pyx_7 = 0;
-
-            /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":146
- *                         except StopIteration:
- *                             stack.pop()
- *                             if len(stack) > 0:             # <<<<<<<<<<<<<<
- *                                 f[0] = 125 #"}"
- *                                 f += 1
- */
-            __pyx_8 = PyObject_Length(((PyObject *)__pyx_v_stack)); if (unlikely(__pyx_8 == -1)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 146; __pyx_clineno = __LINE__; goto __pyx_L19_except_error;}
-            __pyx_1 = (__pyx_8 > 0);
-            if (__pyx_1) {
-
-              /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":147
- *                             stack.pop()
- *                             if len(stack) > 0:
- *                                 f[0] = 125 #"}"             # <<<<<<<<<<<<<<
- *                                 f += 1
- *                                 iterator = stack[-1]
- */
-              (__pyx_v_f[0]) = 125;
-
-              /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":148
- *                             if len(stack) > 0:
- *                                 f[0] = 125 #"}"
- *                                 f += 1             # <<<<<<<<<<<<<<
- *                                 iterator = stack[-1]
- *                             else:
- */
-              __pyx_v_f += 1;
-
-              /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":149
- *                                 f[0] = 125 #"}"
- *                                 f += 1
- *                                 iterator = stack[-1]             # <<<<<<<<<<<<<<
- *                             else:
- *                                 f[0] = 0 # Terminate string!
- */
-              __pyx_6 = __Pyx_GetItemInt(((PyObject *)__pyx_v_stack), -1, 0); if (!__pyx_6) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 149; __pyx_clineno = __LINE__; goto __pyx_L19_except_error;}
-              Py_DECREF(__pyx_v_iterator);
-              __pyx_v_iterator = __pyx_6;
-              __pyx_6 = 0;
-              goto __pyx_L23;
-            }
-            /*else*/ {
-
-              /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":151
- *                                 iterator = stack[-1]
- *                             else:
- *                                 f[0] = 0 # Terminate string!             # <<<<<<<<<<<<<<
- *                                 return
- * 
- */
-              (__pyx_v_f[0]) = 0;
-
-              /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":152
- *                             else:
- *                                 f[0] = 0 # Terminate string!
- *                                 return             # <<<<<<<<<<<<<<
- * 
- *                     hasfields = PyDataType_HASFIELDS(descr)
- */
-              __pyx_r = 0;
-              Py_DECREF(__pyx_2); __pyx_2 = 0;
-              Py_DECREF(__pyx_3); __pyx_3 = 0;
-              Py_DECREF(__pyx_5); __pyx_5 = 0;
-              goto __pyx_L20_except_return;
-            }
-            __pyx_L23:;
-            Py_DECREF(__pyx_2); __pyx_2 = 0;
-            Py_DECREF(__pyx_3); __pyx_3 = 0;
-            Py_DECREF(__pyx_5); __pyx_5 = 0;
-            goto __pyx_L18_exception_handled;
-          }
-          __pyx_L19_except_error:;
-          Py_XDECREF(__pyx_save_exc_type);
-          Py_XDECREF(__pyx_save_exc_value);
-          Py_XDECREF(__pyx_save_exc_tb);
-          goto __pyx_L1_error;
-          __pyx_L20_except_return:;
-          __Pyx_ExceptionReset(__pyx_save_exc_type, __pyx_save_exc_value, __pyx_save_exc_tb);
-          goto __pyx_L0;
-          __pyx_L18_exception_handled:;
-          __Pyx_ExceptionReset(__pyx_save_exc_type, __pyx_save_exc_value, __pyx_save_exc_tb);
-          __pyx_L22_try:;
-        }
-      }
-
-      /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":154
- *                                 return
- * 
- *                     hasfields = PyDataType_HASFIELDS(descr)             # <<<<<<<<<<<<<<
- *                     if not hasfields:
- *                         t = descr.type_num
- */
-      __pyx_v_hasfields = PyDataType_HASFIELDS(__pyx_v_descr);
-
-      /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":155
- * 
- *                     hasfields = PyDataType_HASFIELDS(descr)
- *                     if not hasfields:             # <<<<<<<<<<<<<<
- *                         t = descr.type_num
- *                         if f - info.format > 240: # this should leave room for "T{" and "}" as well
- */
-      __pyx_1 = (!__pyx_v_hasfields);
-      if (__pyx_1) {
-
-        /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":156
- *                     hasfields = PyDataType_HASFIELDS(descr)
- *                     if not hasfields:
- *                         t = descr.type_num             # <<<<<<<<<<<<<<
- *                         if f - info.format > 240: # this should leave room for "T{" and "}" as well
- *                             raise RuntimeError("Format string allocated too short.")
- */
-        __pyx_v_t = __pyx_v_descr->type_num;
-
-        /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":157
- *                     if not hasfields:
- *                         t = descr.type_num
- *                         if f - info.format > 240: # this should leave room for "T{" and "}" as well             # <<<<<<<<<<<<<<
- *                             raise RuntimeError("Format string allocated too short.")
- * 
- */
-        __pyx_1 = ((__pyx_v_f - __pyx_v_info->format) > 240);
-        if (__pyx_1) {
-
-          /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":158
- *                         t = descr.type_num
- *                         if f - info.format > 240: # this should leave room for "T{" and "}" as well
- *                             raise RuntimeError("Format string allocated too short.")             # <<<<<<<<<<<<<<
- * 
- *                         # Until ticket #99 is fixed, use integers to avoid warnings
- */
-          __pyx_7 = PyTuple_New(1); if (unlikely(!__pyx_7)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 158; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-          Py_INCREF(__pyx_kp_21);
-          PyTuple_SET_ITEM(__pyx_7, 0, __pyx_kp_21);
-          __pyx_6 = PyObject_Call(__pyx_builtin_RuntimeError, ((PyObject *)__pyx_7), NULL); if (unlikely(!__pyx_6)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 158; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-          Py_DECREF(((PyObject *)__pyx_7)); __pyx_7 = 0;
-          __Pyx_Raise(__pyx_6, 0, 0);
-          Py_DECREF(__pyx_6); __pyx_6 = 0;
-          {__pyx_filename = __pyx_f[1]; __pyx_lineno = 158; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-          goto __pyx_L25;
-        }
-        __pyx_L25:;
-
-        /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":161
- * 
- *                         # Until ticket #99 is fixed, use integers to avoid warnings
- *                         if   t == NPY_BYTE:        f[0] =  98 #"b"             # <<<<<<<<<<<<<<
- *                         elif t == NPY_UBYTE:       f[0] =  66 #"B"
- *                         elif t == NPY_SHORT:       f[0] = 104 #"h"
- */
-        switch (__pyx_v_t) {
-          case NPY_BYTE:
-          (__pyx_v_f[0]) = 98;
-          break;
-          case NPY_UBYTE:
-
-          /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":162
- *                         # Until ticket #99 is fixed, use integers to avoid warnings
- *                         if   t == NPY_BYTE:        f[0] =  98 #"b"
- *                         elif t == NPY_UBYTE:       f[0] =  66 #"B"             # <<<<<<<<<<<<<<
- *                         elif t == NPY_SHORT:       f[0] = 104 #"h"
- *                         elif t == NPY_USHORT:      f[0] =  72 #"H"
- */
-          (__pyx_v_f[0]) = 66;
-          break;
-          case NPY_SHORT:
-
-          /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":163
- *                         if   t == NPY_BYTE:        f[0] =  98 #"b"
- *                         elif t == NPY_UBYTE:       f[0] =  66 #"B"
- *                         elif t == NPY_SHORT:       f[0] = 104 #"h"             # <<<<<<<<<<<<<<
- *                         elif t == NPY_USHORT:      f[0] =  72 #"H"
- *                         elif t == NPY_INT:         f[0] = 105 #"i"
- */
-          (__pyx_v_f[0]) = 104;
-          break;
-          case NPY_USHORT:
-
-          /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":164
- *                         elif t == NPY_UBYTE:       f[0] =  66 #"B"
- *                         elif t == NPY_SHORT:       f[0] = 104 #"h"
- *                         elif t == NPY_USHORT:      f[0] =  72 #"H"             # <<<<<<<<<<<<<<
- *                         elif t == NPY_INT:         f[0] = 105 #"i"
- *                         elif t == NPY_UINT:        f[0] =  73 #"I"
- */
-          (__pyx_v_f[0]) = 72;
-          break;
-          case NPY_INT:
-
-          /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":165
- *                         elif t == NPY_SHORT:       f[0] = 104 #"h"
- *                         elif t == NPY_USHORT:      f[0] =  72 #"H"
- *                         elif t == NPY_INT:         f[0] = 105 #"i"             # <<<<<<<<<<<<<<
- *                         elif t == NPY_UINT:        f[0] =  73 #"I"
- *                         elif t == NPY_LONG:        f[0] = 108 #"l"
- */
-          (__pyx_v_f[0]) = 105;
-          break;
-          case NPY_UINT:
-
-          /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":166
- *                         elif t == NPY_USHORT:      f[0] =  72 #"H"
- *                         elif t == NPY_INT:         f[0] = 105 #"i"
- *                         elif t == NPY_UINT:        f[0] =  73 #"I"             # <<<<<<<<<<<<<<
- *                         elif t == NPY_LONG:        f[0] = 108 #"l"
- *                         elif t == NPY_ULONG:       f[0] = 76  #"L"
- */
-          (__pyx_v_f[0]) = 73;
-          break;
-          case NPY_LONG:
-
-          /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":167
- *                         elif t == NPY_INT:         f[0] = 105 #"i"
- *                         elif t == NPY_UINT:        f[0] =  73 #"I"
- *                         elif t == NPY_LONG:        f[0] = 108 #"l"             # <<<<<<<<<<<<<<
- *                         elif t == NPY_ULONG:       f[0] = 76  #"L"
- *                         elif t == NPY_LONGLONG:    f[0] = 113 #"q"
- */
-          (__pyx_v_f[0]) = 108;
-          break;
-          case NPY_ULONG:
-
-          /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":168
- *                         elif t == NPY_UINT:        f[0] =  73 #"I"
- *                         elif t == NPY_LONG:        f[0] = 108 #"l"
- *                         elif t == NPY_ULONG:       f[0] = 76  #"L"             # <<<<<<<<<<<<<<
- *                         elif t == NPY_LONGLONG:    f[0] = 113 #"q"
- *                         elif t == NPY_ULONGLONG:   f[0] = 81  #"Q"
- */
-          (__pyx_v_f[0]) = 76;
-          break;
-          case NPY_LONGLONG:
-
-          /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":169
- *                         elif t == NPY_LONG:        f[0] = 108 #"l"
- *                         elif t == NPY_ULONG:       f[0] = 76  #"L"
- *                         elif t == NPY_LONGLONG:    f[0] = 113 #"q"             # <<<<<<<<<<<<<<
- *                         elif t == NPY_ULONGLONG:   f[0] = 81  #"Q"
- *                         elif t == NPY_FLOAT:       f[0] = 102 #"f"
- */
-          (__pyx_v_f[0]) = 113;
-          break;
-          case NPY_ULONGLONG:
-
-          /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":170
- *                         elif t == NPY_ULONG:       f[0] = 76  #"L"
- *                         elif t == NPY_LONGLONG:    f[0] = 113 #"q"
- *                         elif t == NPY_ULONGLONG:   f[0] = 81  #"Q"             # <<<<<<<<<<<<<<
- *                         elif t == NPY_FLOAT:       f[0] = 102 #"f"
- *                         elif t == NPY_DOUBLE:      f[0] = 100 #"d"
- */
-          (__pyx_v_f[0]) = 81;
-          break;
-          case NPY_FLOAT:
-
-          /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":171
- *                         elif t == NPY_LONGLONG:    f[0] = 113 #"q"
- *                         elif t == NPY_ULONGLONG:   f[0] = 81  #"Q"
- *                         elif t == NPY_FLOAT:       f[0] = 102 #"f"             # <<<<<<<<<<<<<<
- *                         elif t == NPY_DOUBLE:      f[0] = 100 #"d"
- *                         elif t == NPY_LONGDOUBLE:  f[0] = 103 #"g"
- */
-          (__pyx_v_f[0]) = 102;
-          break;
-          case NPY_DOUBLE:
-
-          /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":172
- *                         elif t == NPY_ULONGLONG:   f[0] = 81  #"Q"
- *                         elif t == NPY_FLOAT:       f[0] = 102 #"f"
- *                         elif t == NPY_DOUBLE:      f[0] = 100 #"d"             # <<<<<<<<<<<<<<
- *                         elif t == NPY_LONGDOUBLE:  f[0] = 103 #"g"
- *                         elif t == NPY_CFLOAT:      f[0] = 90; f[1] = 102; f += 1
- */
-          (__pyx_v_f[0]) = 100;
-          break;
-          case NPY_LONGDOUBLE:
-
-          /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":173
- *                         elif t == NPY_FLOAT:       f[0] = 102 #"f"
- *                         elif t == NPY_DOUBLE:      f[0] = 100 #"d"
- *                         elif t == NPY_LONGDOUBLE:  f[0] = 103 #"g"             # <<<<<<<<<<<<<<
- *                         elif t == NPY_CFLOAT:      f[0] = 90; f[1] = 102; f += 1
- *                         elif t == NPY_CDOUBLE:     f[0] = 90; f[1] = 100; f += 1
- */
-          (__pyx_v_f[0]) = 103;
-          break;
-          case NPY_CFLOAT:
-
-          /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":174
- *                         elif t == NPY_DOUBLE:      f[0] = 100 #"d"
- *                         elif t == NPY_LONGDOUBLE:  f[0] = 103 #"g"
- *                         elif t == NPY_CFLOAT:      f[0] = 90; f[1] = 102; f += 1             # <<<<<<<<<<<<<<
- *                         elif t == NPY_CDOUBLE:     f[0] = 90; f[1] = 100; f += 1
- *                         elif t == NPY_CLONGDOUBLE: f[0] = 90; f[1] = 103; f += 1
- */
-          (__pyx_v_f[0]) = 90;
-          (__pyx_v_f[1]) = 102;
-          __pyx_v_f += 1;
-          break;
-          case NPY_CDOUBLE:
-
-          /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":175
- *                         elif t == NPY_LONGDOUBLE:  f[0] = 103 #"g"
- *                         elif t == NPY_CFLOAT:      f[0] = 90; f[1] = 102; f += 1
- *                         elif t == NPY_CDOUBLE:     f[0] = 90; f[1] = 100; f += 1             # <<<<<<<<<<<<<<
- *                         elif t == NPY_CLONGDOUBLE: f[0] = 90; f[1] = 103; f += 1
- *                         elif t == NPY_OBJECT:      f[0] = 79 #"O"
- */
-          (__pyx_v_f[0]) = 90;
-          (__pyx_v_f[1]) = 100;
-          __pyx_v_f += 1;
-          break;
-          case NPY_CLONGDOUBLE:
-
-          /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":176
- *                         elif t == NPY_CFLOAT:      f[0] = 90; f[1] = 102; f += 1
- *                         elif t == NPY_CDOUBLE:     f[0] = 90; f[1] = 100; f += 1
- *                         elif t == NPY_CLONGDOUBLE: f[0] = 90; f[1] = 103; f += 1             # <<<<<<<<<<<<<<
- *                         elif t == NPY_OBJECT:      f[0] = 79 #"O"
- *                         else:
- */
-          (__pyx_v_f[0]) = 90;
-          (__pyx_v_f[1]) = 103;
-          __pyx_v_f += 1;
-          break;
-          case NPY_OBJECT:
-
-          /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":177
- *                         elif t == NPY_CDOUBLE:     f[0] = 90; f[1] = 100; f += 1
- *                         elif t == NPY_CLONGDOUBLE: f[0] = 90; f[1] = 103; f += 1
- *                         elif t == NPY_OBJECT:      f[0] = 79 #"O"             # <<<<<<<<<<<<<<
- *                         else:
- *                             raise ValueError("unknown dtype code in numpy.pxd (%d)" % t)
- */
-          (__pyx_v_f[0]) = 79;
-          break;
-          default:
-
-          /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":179
- *                         elif t == NPY_OBJECT:      f[0] = 79 #"O"
- *                         else:
- *                             raise ValueError("unknown dtype code in numpy.pxd (%d)" % t)             # <<<<<<<<<<<<<<
- *                         f += 1
- *                     else:
- */
-          __pyx_2 = PyInt_FromLong(__pyx_v_t); if (unlikely(!__pyx_2)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 179; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-          __pyx_t_1 = PyNumber_Remainder(__pyx_kp_22, __pyx_2); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 179; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-          Py_DECREF(__pyx_2); __pyx_2 = 0;
-          __pyx_3 = PyTuple_New(1); if (unlikely(!__pyx_3)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 179; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-          PyTuple_SET_ITEM(__pyx_3, 0, __pyx_t_1);
-          __pyx_t_1 = 0;
-          __pyx_5 = PyObject_Call(__pyx_builtin_ValueError, ((PyObject *)__pyx_3), NULL); if (unlikely(!__pyx_5)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 179; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-          Py_DECREF(((PyObject *)__pyx_3)); __pyx_3 = 0;
-          __Pyx_Raise(__pyx_5, 0, 0);
-          Py_DECREF(__pyx_5); __pyx_5 = 0;
-          {__pyx_filename = __pyx_f[1]; __pyx_lineno = 179; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-          break;
-        }
-
-        /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":180
- *                         else:
- *                             raise ValueError("unknown dtype code in numpy.pxd (%d)" % t)
- *                         f += 1             # <<<<<<<<<<<<<<
- *                     else:
- *                         f[0] = 84 #"T"
- */
-        __pyx_v_f += 1;
-        goto __pyx_L24;
-      }
-      /*else*/ {
-
-        /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":182
- *                         f += 1
- *                     else:
- *                         f[0] = 84 #"T"             # <<<<<<<<<<<<<<
- *                         f[1] = 123 #"{"
- *                         f += 2
- */
-        (__pyx_v_f[0]) = 84;
-
-        /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":183
- *                     else:
- *                         f[0] = 84 #"T"
- *                         f[1] = 123 #"{"             # <<<<<<<<<<<<<<
- *                         f += 2
- *                         stack.append(iter(descr.fields.iteritems()))
- */
-        (__pyx_v_f[1]) = 123;
-
-        /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":184
- *                         f[0] = 84 #"T"
- *                         f[1] = 123 #"{"
- *                         f += 2             # <<<<<<<<<<<<<<
- *                         stack.append(iter(descr.fields.iteritems()))
- * 
- */
-        __pyx_v_f += 2;
-
-        /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":185
- *                         f[1] = 123 #"{"
- *                         f += 2
- *                         stack.append(iter(descr.fields.iteritems()))             # <<<<<<<<<<<<<<
- * 
- *         def __releasebuffer__(ndarray self, Py_buffer* info):
- */
-        __pyx_7 = PyObject_GetAttr(__pyx_v_descr->fields, __pyx_kp_iteritems); if (unlikely(!__pyx_7)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 185; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-        __pyx_6 = PyObject_Call(__pyx_7, ((PyObject *)__pyx_empty_tuple), NULL); if (unlikely(!__pyx_6)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 185; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-        Py_DECREF(__pyx_7); __pyx_7 = 0;
-        __pyx_2 = PyObject_GetIter(__pyx_6); if (unlikely(!__pyx_2)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 185; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-        Py_DECREF(__pyx_6); __pyx_6 = 0;
-        __pyx_4 = PyList_Append(((PyObject *)__pyx_v_stack), __pyx_2); if (unlikely(__pyx_4 == -1)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 185; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-        Py_DECREF(__pyx_2); __pyx_2 = 0;
-      }
-      __pyx_L24:;
-    }
-  }
-  __pyx_L12:;
-
-  __pyx_r = 0;
-  goto __pyx_L0;
-  __pyx_L1_error:;
-  Py_XDECREF(__pyx_2);
-  Py_XDECREF(__pyx_3);
-  Py_XDECREF(__pyx_5);
-  Py_XDECREF(__pyx_6);
-  Py_XDECREF(__pyx_7);
-  __Pyx_AddTraceback("numpy.ndarray.__getbuffer__");
-  __pyx_r = -1;
-  Py_DECREF(__pyx_v_info->obj); __pyx_v_info->obj = NULL;
-  goto __pyx_L2;
-  __pyx_L0:;
-  if (__pyx_v_info->obj == Py_None) { Py_DECREF(Py_None); __pyx_v_info->obj = NULL; }
-  __pyx_L2:;
-  Py_XDECREF(__pyx_v_descr);
-  Py_DECREF(__pyx_v_stack);
-  Py_DECREF(__pyx_v_iterator);
-  return __pyx_r;
-}
-
-/* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":187
- *                         stack.append(iter(descr.fields.iteritems()))
- * 
- *         def __releasebuffer__(ndarray self, Py_buffer* info):             # <<<<<<<<<<<<<<
- *             if PyArray_HASFIELDS(self):
- *                 stdlib.free(info.format)
- */
-
-static void __pyx_pf_5numpy_7ndarray___releasebuffer__(PyObject *__pyx_v_self, Py_buffer *__pyx_v_info); /*proto*/
-static void __pyx_pf_5numpy_7ndarray___releasebuffer__(PyObject *__pyx_v_self, Py_buffer *__pyx_v_info) {
-  int __pyx_1;
-  int __pyx_2;
-
-  /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":188
- * 
- *         def __releasebuffer__(ndarray self, Py_buffer* info):
- *             if PyArray_HASFIELDS(self):             # <<<<<<<<<<<<<<
- *                 stdlib.free(info.format)
- *             if sizeof(npy_intp) != sizeof(Py_ssize_t):
- */
-  __pyx_1 = PyArray_HASFIELDS(((PyArrayObject *)__pyx_v_self));
-  if (__pyx_1) {
-
-    /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":189
- *         def __releasebuffer__(ndarray self, Py_buffer* info):
- *             if PyArray_HASFIELDS(self):
- *                 stdlib.free(info.format)             # <<<<<<<<<<<<<<
- *             if sizeof(npy_intp) != sizeof(Py_ssize_t):
- *                 stdlib.free(info.strides)
- */
-    free(__pyx_v_info->format);
-    goto __pyx_L5;
-  }
-  __pyx_L5:;
-
-  /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":190
- *             if PyArray_HASFIELDS(self):
- *                 stdlib.free(info.format)
- *             if sizeof(npy_intp) != sizeof(Py_ssize_t):             # <<<<<<<<<<<<<<
- *                 stdlib.free(info.strides)
- *                 # info.shape was stored after info.strides in the same block
- */
-  __pyx_2 = ((sizeof(npy_intp)) != (sizeof(Py_ssize_t)));
-  if (__pyx_2) {
-
-    /* "c:\Python25\lib\site-packages\Cython\Includes\numpy.pxd":191
- *                 stdlib.free(info.format)
- *             if sizeof(npy_intp) != sizeof(Py_ssize_t):
- *                 stdlib.free(info.strides)             # <<<<<<<<<<<<<<
- *                 # info.shape was stored after info.strides in the same block
- * 
- */
-    free(__pyx_v_info->strides);
-    goto __pyx_L6;
-  }
-  __pyx_L6:;
-
-}
-
-static struct PyMethodDef __pyx_methods[] = {
-  {"_texture", (PyCFunction)__pyx_pf_4nipy_9neurospin_8register_8routines__texture, METH_VARARGS|METH_KEYWORDS, 0},
-  {"_histogram", (PyCFunction)__pyx_pf_4nipy_9neurospin_8register_8routines__histogram, METH_VARARGS|METH_KEYWORDS, __pyx_doc_4nipy_9neurospin_8register_8routines__histogram},
-  {"_joint_histogram", (PyCFunction)__pyx_pf_4nipy_9neurospin_8register_8routines__joint_histogram, METH_VARARGS|METH_KEYWORDS, __pyx_doc_4nipy_9neurospin_8register_8routines__joint_histogram},
-  {"_similarity", (PyCFunction)__pyx_pf_4nipy_9neurospin_8register_8routines__similarity, METH_VARARGS|METH_KEYWORDS, __pyx_doc_4nipy_9neurospin_8register_8routines__similarity},
-  {"cspline_transform", (PyCFunction)__pyx_pf_4nipy_9neurospin_8register_8routines_cspline_transform, METH_O, 0},
-  {"cspline_sample1d", (PyCFunction)__pyx_pf_4nipy_9neurospin_8register_8routines_cspline_sample1d, METH_VARARGS|METH_KEYWORDS, 0},
-  {"cspline_sample2d", (PyCFunction)__pyx_pf_4nipy_9neurospin_8register_8routines_cspline_sample2d, METH_VARARGS|METH_KEYWORDS, 0},
-  {"cspline_sample3d", (PyCFunction)__pyx_pf_4nipy_9neurospin_8register_8routines_cspline_sample3d, METH_VARARGS|METH_KEYWORDS, 0},
-  {"cspline_sample4d", (PyCFunction)__pyx_pf_4nipy_9neurospin_8register_8routines_cspline_sample4d, METH_VARARGS|METH_KEYWORDS, __pyx_doc_4nipy_9neurospin_8register_8routines_cspline_sample4d},
-  {"cspline_resample", (PyCFunction)__pyx_pf_4nipy_9neurospin_8register_8routines_cspline_resample, METH_VARARGS|METH_KEYWORDS, __pyx_doc_4nipy_9neurospin_8register_8routines_cspline_resample},
-  {"slice_time", (PyCFunction)__pyx_pf_4nipy_9neurospin_8register_8routines_slice_time, METH_VARARGS|METH_KEYWORDS, __pyx_doc_4nipy_9neurospin_8register_8routines_slice_time},
-  {"rotation_vec2mat", (PyCFunction)__pyx_pf_4nipy_9neurospin_8register_8routines_rotation_vec2mat, METH_O, __pyx_doc_4nipy_9neurospin_8register_8routines_rotation_vec2mat},
-  {"param_to_vector12", (PyCFunction)__pyx_pf_4nipy_9neurospin_8register_8routines_param_to_vector12, METH_VARARGS|METH_KEYWORDS, __pyx_doc_4nipy_9neurospin_8register_8routines_param_to_vector12},
-  {"matrix44", (PyCFunction)__pyx_pf_4nipy_9neurospin_8register_8routines_matrix44, METH_VARARGS|METH_KEYWORDS, __pyx_doc_4nipy_9neurospin_8register_8routines_matrix44},
-  {0, 0, 0, 0}
-};
-
-static void __pyx_init_filenames(void); /*proto*/
-
-#if PY_MAJOR_VERSION >= 3
-static struct PyModuleDef __pyx_moduledef = {
-    PyModuleDef_HEAD_INIT,
-    "routines",
-    __pyx_mdoc, /* m_doc */
-    -1, /* m_size */
-    __pyx_methods /* m_methods */,
-    NULL, /* m_reload */
-    NULL, /* m_traverse */
-    NULL, /* m_clear */
-    NULL /* m_free */
-};
-#endif
-
-static __Pyx_StringTabEntry __pyx_string_tab[] = {
-  {&__pyx_kp_im, __pyx_k_im, sizeof(__pyx_k_im), 1, 1, 1},
-  {&__pyx_kp_H, __pyx_k_H, sizeof(__pyx_k_H), 1, 1, 1},
-  {&__pyx_kp_Size, __pyx_k_Size, sizeof(__pyx_k_Size), 1, 1, 1},
-  {&__pyx_kp_texture, __pyx_k_texture, sizeof(__pyx_k_texture), 1, 1, 1},
-  {&__pyx_kp_method, __pyx_k_method, sizeof(__pyx_k_method), 1, 1, 1},
-  {&__pyx_kp_iter, __pyx_k_iter, sizeof(__pyx_k_iter), 1, 1, 1},
-  {&__pyx_kp_iterI, __pyx_k_iterI, sizeof(__pyx_k_iterI), 1, 1, 1},
-  {&__pyx_kp_imJ, __pyx_k_imJ, sizeof(__pyx_k_imJ), 1, 1, 1},
-  {&__pyx_kp_Tvox, __pyx_k_Tvox, sizeof(__pyx_k_Tvox), 1, 1, 1},
-  {&__pyx_kp_interp, __pyx_k_interp, sizeof(__pyx_k_interp), 1, 1, 1},
-  {&__pyx_kp_HI, __pyx_k_HI, sizeof(__pyx_k_HI), 1, 1, 1},
-  {&__pyx_kp_HJ, __pyx_k_HJ, sizeof(__pyx_k_HJ), 1, 1, 1},
-  {&__pyx_kp_simitype, __pyx_k_simitype, sizeof(__pyx_k_simitype), 1, 1, 1},
-  {&__pyx_kp_F, __pyx_k_F, sizeof(__pyx_k_F), 1, 1, 1},
-  {&__pyx_kp_x, __pyx_k_x, sizeof(__pyx_k_x), 1, 1, 1},
-  {&__pyx_kp_R, __pyx_k_R, sizeof(__pyx_k_R), 1, 1, 1},
-  {&__pyx_kp_C, __pyx_k_C, sizeof(__pyx_k_C), 1, 1, 1},
-  {&__pyx_kp_X, __pyx_k_X, sizeof(__pyx_k_X), 1, 1, 1},
-  {&__pyx_kp_Y, __pyx_k_Y, sizeof(__pyx_k_Y), 1, 1, 1},
-  {&__pyx_kp_Z, __pyx_k_Z, sizeof(__pyx_k_Z), 1, 1, 1},
-  {&__pyx_kp_T, __pyx_k_T, sizeof(__pyx_k_T), 1, 1, 1},
-  {&__pyx_kp_dims, __pyx_k_dims, sizeof(__pyx_k_dims), 1, 1, 1},
-  {&__pyx_kp_dtype, __pyx_k_dtype, sizeof(__pyx_k_dtype), 1, 1, 1},
-  {&__pyx_kp_tr_slices, __pyx_k_tr_slices, sizeof(__pyx_k_tr_slices), 1, 1, 1},
-  {&__pyx_kp_slice_order, __pyx_k_slice_order, sizeof(__pyx_k_slice_order), 1, 1, 1},
-  {&__pyx_kp_r, __pyx_k_r, sizeof(__pyx_k_r), 1, 1, 1},
-  {&__pyx_kp_param, __pyx_k_param, sizeof(__pyx_k_param), 1, 1, 1},
-  {&__pyx_kp_t0, __pyx_k_t0, sizeof(__pyx_k_t0), 1, 1, 1},
-  {&__pyx_kp_precond, __pyx_k_precond, sizeof(__pyx_k_precond), 1, 1, 1},
-  {&__pyx_kp_stamp, __pyx_k_stamp, sizeof(__pyx_k_stamp), 1, 1, 1},
-  {&__pyx_kp_t, __pyx_k_t, sizeof(__pyx_k_t), 1, 1, 1},
-  {&__pyx_kp___version__, __pyx_k___version__, sizeof(__pyx_k___version__), 1, 1, 1},
-  {&__pyx_kp_numpy, __pyx_k_numpy, sizeof(__pyx_k_numpy), 1, 1, 1},
-  {&__pyx_kp_np, __pyx_k_np, sizeof(__pyx_k_np), 0, 1, 1},
-  {&__pyx_kp_24, __pyx_k_24, sizeof(__pyx_k_24), 0, 1, 0},
-  {&__pyx_kp_25, __pyx_k_25, sizeof(__pyx_k_25), 0, 1, 0},
-  {&__pyx_kp_26, __pyx_k_26, sizeof(__pyx_k_26), 0, 1, 0},
-  {&__pyx_kp_27, __pyx_k_27, sizeof(__pyx_k_27), 0, 1, 0},
-  {&__pyx_kp_28, __pyx_k_28, sizeof(__pyx_k_28), 0, 1, 0},
-  {&__pyx_kp_29, __pyx_k_29, sizeof(__pyx_k_29), 0, 1, 0},
-  {&__pyx_kp_30, __pyx_k_30, sizeof(__pyx_k_30), 0, 1, 0},
-  {&__pyx_kp_31, __pyx_k_31, sizeof(__pyx_k_31), 0, 1, 0},
-  {&__pyx_kp_32, __pyx_k_32, sizeof(__pyx_k_32), 0, 1, 0},
-  {&__pyx_kp_texture_measures, __pyx_k_texture_measures, sizeof(__pyx_k_texture_measures), 1, 1, 1},
-  {&__pyx_kp_33, __pyx_k_33, sizeof(__pyx_k_33), 0, 1, 0},
-  {&__pyx_kp_34, __pyx_k_34, sizeof(__pyx_k_34), 0, 1, 0},
-  {&__pyx_kp_35, __pyx_k_35, sizeof(__pyx_k_35), 0, 1, 0},
-  {&__pyx_kp_36, __pyx_k_36, sizeof(__pyx_k_36), 0, 1, 0},
-  {&__pyx_kp_37, __pyx_k_37, sizeof(__pyx_k_37), 0, 1, 0},
-  {&__pyx_kp_38, __pyx_k_38, sizeof(__pyx_k_38), 0, 1, 0},
-  {&__pyx_kp_39, __pyx_k_39, sizeof(__pyx_k_39), 0, 1, 0},
-  {&__pyx_kp_40, __pyx_k_40, sizeof(__pyx_k_40), 0, 1, 0},
-  {&__pyx_kp_41, __pyx_k_41, sizeof(__pyx_k_41), 0, 1, 0},
-  {&__pyx_kp_similarity_measures, __pyx_k_similarity_measures, sizeof(__pyx_k_similarity_measures), 1, 1, 1},
-  {&__pyx_kp_42, __pyx_k_42, sizeof(__pyx_k_42), 0, 1, 0},
-  {&__pyx_kp_43, __pyx_k_43, sizeof(__pyx_k_43), 0, 1, 0},
-  {&__pyx_kp_44, __pyx_k_44, sizeof(__pyx_k_44), 0, 1, 0},
-  {&__pyx_kp_affines, __pyx_k_affines, sizeof(__pyx_k_affines), 1, 1, 1},
-  {&__pyx_kp_45, __pyx_k_45, sizeof(__pyx_k_45), 1, 1, 1},
-  {&__pyx_kp_46, __pyx_k_46, sizeof(__pyx_k_46), 1, 1, 1},
-  {&__pyx_kp_47, __pyx_k_47, sizeof(__pyx_k_47), 1, 1, 1},
-  {&__pyx_kp_range, __pyx_k_range, sizeof(__pyx_k_range), 1, 1, 1},
-  {&__pyx_kp_48, __pyx_k_48, sizeof(__pyx_k_48), 1, 1, 1},
-  {&__pyx_kp_49, __pyx_k_49, sizeof(__pyx_k_49), 1, 1, 1},
-  {&__pyx_kp_50, __pyx_k_50, sizeof(__pyx_k_50), 1, 1, 1},
-  {&__pyx_kp__affines, __pyx_k__affines, sizeof(__pyx_k__affines), 1, 1, 1},
-  {&__pyx_kp_zeros, __pyx_k_zeros, sizeof(__pyx_k_zeros), 1, 1, 1},
-  {&__pyx_kp_shape, __pyx_k_shape, sizeof(__pyx_k_shape), 1, 1, 1},
-  {&__pyx_kp_52, __pyx_k_52, sizeof(__pyx_k_52), 0, 1, 0},
-  {&__pyx_kp_reshape, __pyx_k_reshape, sizeof(__pyx_k_reshape), 1, 1, 1},
-  {&__pyx_kp_astype, __pyx_k_astype, sizeof(__pyx_k_astype), 1, 1, 1},
-  {&__pyx_kp_53, __pyx_k_53, sizeof(__pyx_k_53), 0, 1, 0},
-  {&__pyx_kp_54, __pyx_k_54, sizeof(__pyx_k_54), 0, 1, 0},
-  {&__pyx_kp_55, __pyx_k_55, sizeof(__pyx_k_55), 0, 1, 0},
-  {&__pyx_kp_56, __pyx_k_56, sizeof(__pyx_k_56), 0, 1, 0},
-  {&__pyx_kp_57, __pyx_k_57, sizeof(__pyx_k_57), 0, 1, 0},
-  {&__pyx_kp_58, __pyx_k_58, sizeof(__pyx_k_58), 0, 1, 0},
-  {&__pyx_kp_59, __pyx_k_59, sizeof(__pyx_k_59), 0, 1, 0},
-  {&__pyx_kp_60, __pyx_k_60, sizeof(__pyx_k_60), 0, 1, 0},
-  {&__pyx_kp_61, __pyx_k_61, sizeof(__pyx_k_61), 0, 1, 0},
-  {&__pyx_kp_62, __pyx_k_62, sizeof(__pyx_k_62), 0, 1, 0},
-  {&__pyx_kp_asarray, __pyx_k_asarray, sizeof(__pyx_k_asarray), 1, 1, 1},
-  {&__pyx_kp_order, __pyx_k_order, sizeof(__pyx_k_order), 1, 1, 1},
-  {&__pyx_kp_63, __pyx_k_63, sizeof(__pyx_k_63), 0, 1, 0},
-  {&__pyx_kp_issubdtype, __pyx_k_issubdtype, sizeof(__pyx_k_issubdtype), 1, 1, 1},
-  {&__pyx_kp_64, __pyx_k_64, sizeof(__pyx_k_64), 0, 1, 0},
-  {&__pyx_kp_65, __pyx_k_65, sizeof(__pyx_k_65), 0, 1, 0},
-  {&__pyx_kp_ascontiguousarray, __pyx_k_ascontiguousarray, sizeof(__pyx_k_ascontiguousarray), 1, 1, 1},
-  {&__pyx_kp_66, __pyx_k_66, sizeof(__pyx_k_66), 0, 1, 0},
-  {&__pyx_kp_size, __pyx_k_size, sizeof(__pyx_k_size), 1, 1, 1},
-  {&__pyx_kp_linalg, __pyx_k_linalg, sizeof(__pyx_k_linalg), 1, 1, 1},
-  {&__pyx_kp_norm, __pyx_k_norm, sizeof(__pyx_k_norm), 1, 1, 1},
-  {&__pyx_kp_array, __pyx_k_array, sizeof(__pyx_k_array), 1, 1, 1},
-  {&__pyx_kp_eye, __pyx_k_eye, sizeof(__pyx_k_eye), 1, 1, 1},
-  {&__pyx_kp_sin, __pyx_k_sin, sizeof(__pyx_k_sin), 1, 1, 1},
-  {&__pyx_kp_cos, __pyx_k_cos, sizeof(__pyx_k_cos), 1, 1, 1},
-  {&__pyx_kp_dot, __pyx_k_dot, sizeof(__pyx_k_dot), 1, 1, 1},
-  {&__pyx_kp_67, __pyx_k_67, sizeof(__pyx_k_67), 1, 1, 1},
-  {&__pyx_kp_diag, __pyx_k_diag, sizeof(__pyx_k_diag), 1, 1, 1},
-  {&__pyx_kp_23, __pyx_k_23, sizeof(__pyx_k_23), 0, 0, 0},
-  {&__pyx_kp___getbuffer__, __pyx_k___getbuffer__, sizeof(__pyx_k___getbuffer__), 1, 1, 1},
-  {&__pyx_kp___releasebuffer__, __pyx_k___releasebuffer__, sizeof(__pyx_k___releasebuffer__), 1, 1, 1},
-  {&__pyx_kp_info, __pyx_k_info, sizeof(__pyx_k_info), 1, 1, 1},
-  {&__pyx_kp_flags, __pyx_k_flags, sizeof(__pyx_k_flags), 1, 1, 1},
-  {&__pyx_kp_ValueError, __pyx_k_ValueError, sizeof(__pyx_k_ValueError), 1, 1, 1},
-  {&__pyx_kp_iteritems, __pyx_k_iteritems, sizeof(__pyx_k_iteritems), 1, 1, 1},
-  {&__pyx_kp_next, __pyx_k_next, sizeof(__pyx_k_next), 1, 1, 1},
-  {&__pyx_kp_StopIteration, __pyx_k_StopIteration, sizeof(__pyx_k_StopIteration), 1, 1, 1},
-  {&__pyx_kp_pop, __pyx_k_pop, sizeof(__pyx_k_pop), 1, 1, 1},
-  {&__pyx_kp_RuntimeError, __pyx_k_RuntimeError, sizeof(__pyx_k_RuntimeError), 1, 1, 1},
-  {&__pyx_kp_1, __pyx_k_1, sizeof(__pyx_k_1), 0, 0, 0},
-  {&__pyx_kp_2, __pyx_k_2, sizeof(__pyx_k_2), 0, 0, 0},
-  {&__pyx_kp_20, __pyx_k_20, sizeof(__pyx_k_20), 0, 0, 0},
-  {&__pyx_kp_21, __pyx_k_21, sizeof(__pyx_k_21), 0, 0, 0},
-  {&__pyx_kp_22, __pyx_k_22, sizeof(__pyx_k_22), 0, 0, 0},
-  {0, 0, 0, 0, 0, 0}
-};
-static int __Pyx_InitCachedBuiltins(void) {
-  __pyx_builtin_range = __Pyx_GetName(__pyx_b, __pyx_kp_range); if (!__pyx_builtin_range) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 404; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __pyx_builtin_ValueError = __Pyx_GetName(__pyx_b, __pyx_kp_ValueError); if (!__pyx_builtin_ValueError) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 65; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __pyx_builtin_StopIteration = __Pyx_GetName(__pyx_b, __pyx_kp_StopIteration); if (!__pyx_builtin_StopIteration) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 144; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __pyx_builtin_RuntimeError = __Pyx_GetName(__pyx_b, __pyx_kp_RuntimeError); if (!__pyx_builtin_RuntimeError) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 158; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  return 0;
-  __pyx_L1_error:;
-  return -1;
-}
-
-static int __Pyx_InitGlobals(void) {
-  __pyx_int_0 = PyInt_FromLong(0); if (unlikely(!__pyx_int_0)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 1; __pyx_clineno = __LINE__; goto __pyx_L1_error;};
-  __pyx_int_1 = PyInt_FromLong(1); if (unlikely(!__pyx_int_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 1; __pyx_clineno = __LINE__; goto __pyx_L1_error;};
-  __pyx_int_5 = PyInt_FromLong(5); if (unlikely(!__pyx_int_5)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 1; __pyx_clineno = __LINE__; goto __pyx_L1_error;};
-  __pyx_int_6 = PyInt_FromLong(6); if (unlikely(!__pyx_int_6)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 1; __pyx_clineno = __LINE__; goto __pyx_L1_error;};
-  __pyx_int_7 = PyInt_FromLong(7); if (unlikely(!__pyx_int_7)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 1; __pyx_clineno = __LINE__; goto __pyx_L1_error;};
-  __pyx_int_11 = PyInt_FromLong(11); if (unlikely(!__pyx_int_11)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 1; __pyx_clineno = __LINE__; goto __pyx_L1_error;};
-  __pyx_int_9 = PyInt_FromLong(9); if (unlikely(!__pyx_int_9)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 1; __pyx_clineno = __LINE__; goto __pyx_L1_error;};
-  __pyx_int_12 = PyInt_FromLong(12); if (unlikely(!__pyx_int_12)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 1; __pyx_clineno = __LINE__; goto __pyx_L1_error;};
-  __pyx_int_3 = PyInt_FromLong(3); if (unlikely(!__pyx_int_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 1; __pyx_clineno = __LINE__; goto __pyx_L1_error;};
-  __pyx_int_2 = PyInt_FromLong(2); if (unlikely(!__pyx_int_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 1; __pyx_clineno = __LINE__; goto __pyx_L1_error;};
-  __pyx_int_4 = PyInt_FromLong(4); if (unlikely(!__pyx_int_4)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 1; __pyx_clineno = __LINE__; goto __pyx_L1_error;};
-  if (__Pyx_InitStrings(__pyx_string_tab) < 0) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 1; __pyx_clineno = __LINE__; goto __pyx_L1_error;};
-  return 0;
-  __pyx_L1_error:;
-  return -1;
-}
-
-#if PY_MAJOR_VERSION < 3
-PyMODINIT_FUNC initroutines(void); /*proto*/
-PyMODINIT_FUNC initroutines(void)
-#else
-PyMODINIT_FUNC PyInit_routines(void); /*proto*/
-PyMODINIT_FUNC PyInit_routines(void)
-#endif
-{
-  PyObject *__pyx_1 = 0;
-  PyObject *__pyx_2 = 0;
-  PyObject *__pyx_3 = 0;
-  PyObject *__pyx_4 = 0;
-  PyObject *__pyx_5 = 0;
-  PyObject *__pyx_6 = 0;
-  PyObject *__pyx_7 = 0;
-  __pyx_empty_tuple = PyTuple_New(0); if (unlikely(!__pyx_empty_tuple)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 1; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  /*--- Library function declarations ---*/
-  __pyx_init_filenames();
-  /*--- Initialize various global constants etc. ---*/
-  if (unlikely(__Pyx_InitGlobals() < 0)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 1; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  /*--- Module creation code ---*/
-  #if PY_MAJOR_VERSION < 3
-  __pyx_m = Py_InitModule4("routines", __pyx_methods, __pyx_mdoc, 0, PYTHON_API_VERSION);
-  #else
-  __pyx_m = PyModule_Create(&__pyx_moduledef);
-  #endif
-  if (!__pyx_m) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 1; __pyx_clineno = __LINE__; goto __pyx_L1_error;};
-  #if PY_MAJOR_VERSION < 3
-  Py_INCREF(__pyx_m);
-  #endif
-  __pyx_b = PyImport_AddModule(__Pyx_BUILTIN_MODULE_NAME);
-  if (!__pyx_b) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 1; __pyx_clineno = __LINE__; goto __pyx_L1_error;};
-  if (PyObject_SetAttrString(__pyx_m, "__builtins__", __pyx_b) < 0) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 1; __pyx_clineno = __LINE__; goto __pyx_L1_error;};
-  /*--- Builtin init code ---*/
-  if (unlikely(__Pyx_InitCachedBuiltins() < 0)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 1; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __pyx_skip_dispatch = 0;
-  /*--- Global init code ---*/
-  /*--- Function export code ---*/
-  /*--- Type init code ---*/
-  __pyx_ptype_4nipy_9neurospin_8register_8routines_dtype = __Pyx_ImportType("numpy", "dtype", sizeof(PyArray_Descr)); if (unlikely(!__pyx_ptype_4nipy_9neurospin_8register_8routines_dtype)) {__pyx_filename = __pyx_f[2]; __pyx_lineno = 74; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __pyx_ptype_4nipy_9neurospin_8register_8routines_ndarray = __Pyx_ImportType("numpy", "ndarray", sizeof(PyArrayObject)); if (unlikely(!__pyx_ptype_4nipy_9neurospin_8register_8routines_ndarray)) {__pyx_filename = __pyx_f[2]; __pyx_lineno = 79; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __pyx_ptype_4nipy_9neurospin_8register_8routines_flatiter = __Pyx_ImportType("numpy", "flatiter", sizeof(PyArrayIterObject)); if (unlikely(!__pyx_ptype_4nipy_9neurospin_8register_8routines_flatiter)) {__pyx_filename = __pyx_f[2]; __pyx_lineno = 88; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __pyx_ptype_4nipy_9neurospin_8register_8routines_broadcast = __Pyx_ImportType("numpy", "broadcast", sizeof(PyArrayMultiIterObject)); if (unlikely(!__pyx_ptype_4nipy_9neurospin_8register_8routines_broadcast)) {__pyx_filename = __pyx_f[2]; __pyx_lineno = 94; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  /*--- Type import code ---*/
-  __pyx_ptype_5numpy_dtype = __Pyx_ImportType("numpy", "dtype", sizeof(PyArray_Descr)); if (unlikely(!__pyx_ptype_5numpy_dtype)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 30; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __pyx_ptype_5numpy_ndarray = __Pyx_ImportType("numpy", "ndarray", sizeof(PyArrayObject)); if (unlikely(!__pyx_ptype_5numpy_ndarray)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 36; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  /*--- Function import code ---*/
-  /*--- Execution code ---*/
-
-  /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":11
- * """
- * 
- * __version__ = '0.2'             # <<<<<<<<<<<<<<
- * 
- * 
- */
-  if (PyObject_SetAttr(__pyx_m, __pyx_kp___version__, __pyx_kp_23) < 0) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 11; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-
-  /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":62
- * 
- * # Initialize numpy
- * iconic_import_array()             # <<<<<<<<<<<<<<
- * cubic_spline_import_array()
- * import_array()
- */
-  iconic_import_array();
-
-  /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":63
- * # Initialize numpy
- * iconic_import_array()
- * cubic_spline_import_array()             # <<<<<<<<<<<<<<
- * import_array()
- * import numpy as np
- */
-  cubic_spline_import_array();
-
-  /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":64
- * iconic_import_array()
- * cubic_spline_import_array()
- * import_array()             # <<<<<<<<<<<<<<
- * import numpy as np
- * cimport numpy as np
- */
-  import_array();
-
-  /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":65
- * cubic_spline_import_array()
- * import_array()
- * import numpy as np             # <<<<<<<<<<<<<<
- * cimport numpy as np
- * 
- */
-  __pyx_1 = __Pyx_Import(__pyx_kp_numpy, 0); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 65; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  if (PyObject_SetAttr(__pyx_m, __pyx_kp_np, __pyx_1) < 0) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 65; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_DECREF(__pyx_1); __pyx_1 = 0;
-
-  /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":81
- * 
- * # Corresponding Python dictionary
- * texture_measures = {             # <<<<<<<<<<<<<<
- *     'min': MIN,
- *     'max': MAX,
- */
-  __pyx_1 = PyDict_New(); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 81; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-
-  /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":82
- * # Corresponding Python dictionary
- * texture_measures = {
- *     'min': MIN,             # <<<<<<<<<<<<<<
- *     'max': MAX,
- *     'drange': DRANGE,
- */
-  __pyx_2 = PyInt_FromLong(__pyx_e_4nipy_9neurospin_8register_8routines_MIN); if (unlikely(!__pyx_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 82; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  if (PyDict_SetItem(__pyx_1, __pyx_kp_24, __pyx_2) < 0) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 81; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_DECREF(__pyx_2); __pyx_2 = 0;
-
-  /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":83
- * texture_measures = {
- *     'min': MIN,
- *     'max': MAX,             # <<<<<<<<<<<<<<
- *     'drange': DRANGE,
- *     'mean': MEAN,
- */
-  __pyx_2 = PyInt_FromLong(__pyx_e_4nipy_9neurospin_8register_8routines_MAX); if (unlikely(!__pyx_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 83; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  if (PyDict_SetItem(__pyx_1, __pyx_kp_25, __pyx_2) < 0) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 81; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_DECREF(__pyx_2); __pyx_2 = 0;
-
-  /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":84
- *     'min': MIN,
- *     'max': MAX,
- *     'drange': DRANGE,             # <<<<<<<<<<<<<<
- *     'mean': MEAN,
- *     'variance': VARIANCE,
- */
-  __pyx_2 = PyInt_FromLong(__pyx_e_4nipy_9neurospin_8register_8routines_DRANGE); if (unlikely(!__pyx_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 84; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  if (PyDict_SetItem(__pyx_1, __pyx_kp_26, __pyx_2) < 0) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 81; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_DECREF(__pyx_2); __pyx_2 = 0;
-
-  /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":85
- *     'max': MAX,
- *     'drange': DRANGE,
- *     'mean': MEAN,             # <<<<<<<<<<<<<<
- *     'variance': VARIANCE,
- *     'median': MEDIAN,
- */
-  __pyx_2 = PyInt_FromLong(__pyx_e_4nipy_9neurospin_8register_8routines_MEAN); if (unlikely(!__pyx_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 85; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  if (PyDict_SetItem(__pyx_1, __pyx_kp_27, __pyx_2) < 0) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 81; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_DECREF(__pyx_2); __pyx_2 = 0;
-
-  /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":86
- *     'drange': DRANGE,
- *     'mean': MEAN,
- *     'variance': VARIANCE,             # <<<<<<<<<<<<<<
- *     'median': MEDIAN,
- *     'l1dev': L1DEV,
- */
-  __pyx_2 = PyInt_FromLong(__pyx_e_4nipy_9neurospin_8register_8routines_VARIANCE); if (unlikely(!__pyx_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 86; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  if (PyDict_SetItem(__pyx_1, __pyx_kp_28, __pyx_2) < 0) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 81; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_DECREF(__pyx_2); __pyx_2 = 0;
-
-  /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":87
- *     'mean': MEAN,
- *     'variance': VARIANCE,
- *     'median': MEDIAN,             # <<<<<<<<<<<<<<
- *     'l1dev': L1DEV,
- *     'entropy': ENTROPY,
- */
-  __pyx_2 = PyInt_FromLong(__pyx_e_4nipy_9neurospin_8register_8routines_MEDIAN); if (unlikely(!__pyx_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 87; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  if (PyDict_SetItem(__pyx_1, __pyx_kp_29, __pyx_2) < 0) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 81; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_DECREF(__pyx_2); __pyx_2 = 0;
-
-  /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":88
- *     'variance': VARIANCE,
- *     'median': MEDIAN,
- *     'l1dev': L1DEV,             # <<<<<<<<<<<<<<
- *     'entropy': ENTROPY,
- *     'custom': CUSTOM_TEXTURE}
- */
-  __pyx_2 = PyInt_FromLong(__pyx_e_4nipy_9neurospin_8register_8routines_L1DEV); if (unlikely(!__pyx_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 88; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  if (PyDict_SetItem(__pyx_1, __pyx_kp_30, __pyx_2) < 0) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 81; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_DECREF(__pyx_2); __pyx_2 = 0;
-
-  /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":89
- *     'median': MEDIAN,
- *     'l1dev': L1DEV,
- *     'entropy': ENTROPY,             # <<<<<<<<<<<<<<
- *     'custom': CUSTOM_TEXTURE}
- * 
- */
-  __pyx_2 = PyInt_FromLong(__pyx_e_4nipy_9neurospin_8register_8routines_ENTROPY); if (unlikely(!__pyx_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 89; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  if (PyDict_SetItem(__pyx_1, __pyx_kp_31, __pyx_2) < 0) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 81; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_DECREF(__pyx_2); __pyx_2 = 0;
-
-  /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":90
- *     'l1dev': L1DEV,
- *     'entropy': ENTROPY,
- *     'custom': CUSTOM_TEXTURE}             # <<<<<<<<<<<<<<
- * 
- * # Enumerate similarity measures
- */
-  __pyx_2 = PyInt_FromLong(__pyx_e_4nipy_9neurospin_8register_8routines_CUSTOM_TEXTURE); if (unlikely(!__pyx_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 90; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  if (PyDict_SetItem(__pyx_1, __pyx_kp_32, __pyx_2) < 0) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 81; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_DECREF(__pyx_2); __pyx_2 = 0;
-  if (PyObject_SetAttr(__pyx_m, __pyx_kp_texture_measures, ((PyObject *)__pyx_1)) < 0) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 81; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_DECREF(((PyObject *)__pyx_1)); __pyx_1 = 0;
-
-  /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":105
- * 
- * # Corresponding Python dictionary
- * similarity_measures = {'cc': CORRELATION_COEFFICIENT,             # <<<<<<<<<<<<<<
- *                        'cr': CORRELATION_RATIO,
- *                        'crl1': CORRELATION_RATIO_L1,
- */
-  __pyx_2 = PyDict_New(); if (unlikely(!__pyx_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 105; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __pyx_1 = PyInt_FromLong(__pyx_e_4nipy_9neurospin_8register_8routines_CORRELATION_COEFFICIENT); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 105; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  if (PyDict_SetItem(__pyx_2, __pyx_kp_33, __pyx_1) < 0) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 105; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_DECREF(__pyx_1); __pyx_1 = 0;
-
-  /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":106
- * # Corresponding Python dictionary
- * similarity_measures = {'cc': CORRELATION_COEFFICIENT,
- *                        'cr': CORRELATION_RATIO,             # <<<<<<<<<<<<<<
- *                        'crl1': CORRELATION_RATIO_L1,
- *                        'mi': MUTUAL_INFORMATION,
- */
-  __pyx_1 = PyInt_FromLong(__pyx_e_4nipy_9neurospin_8register_8routines_CORRELATION_RATIO); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 106; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  if (PyDict_SetItem(__pyx_2, __pyx_kp_34, __pyx_1) < 0) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 105; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_DECREF(__pyx_1); __pyx_1 = 0;
-
-  /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":107
- * similarity_measures = {'cc': CORRELATION_COEFFICIENT,
- *                        'cr': CORRELATION_RATIO,
- *                        'crl1': CORRELATION_RATIO_L1,             # <<<<<<<<<<<<<<
- *                        'mi': MUTUAL_INFORMATION,
- *                        'je': JOINT_ENTROPY,
- */
-  __pyx_1 = PyInt_FromLong(__pyx_e_4nipy_9neurospin_8register_8routines_CORRELATION_RATIO_L1); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 107; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  if (PyDict_SetItem(__pyx_2, __pyx_kp_35, __pyx_1) < 0) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 105; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_DECREF(__pyx_1); __pyx_1 = 0;
-
-  /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":108
- *                        'cr': CORRELATION_RATIO,
- *                        'crl1': CORRELATION_RATIO_L1,
- *                        'mi': MUTUAL_INFORMATION,             # <<<<<<<<<<<<<<
- *                        'je': JOINT_ENTROPY,
- *                        'ce': CONDITIONAL_ENTROPY,
- */
-  __pyx_1 = PyInt_FromLong(__pyx_e_4nipy_9neurospin_8register_8routines_MUTUAL_INFORMATION); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 108; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  if (PyDict_SetItem(__pyx_2, __pyx_kp_36, __pyx_1) < 0) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 105; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_DECREF(__pyx_1); __pyx_1 = 0;
-
-  /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":109
- *                        'crl1': CORRELATION_RATIO_L1,
- *                        'mi': MUTUAL_INFORMATION,
- *                        'je': JOINT_ENTROPY,             # <<<<<<<<<<<<<<
- *                        'ce': CONDITIONAL_ENTROPY,
- *                        'nmi': NORMALIZED_MUTUAL_INFORMATION,
- */
-  __pyx_1 = PyInt_FromLong(__pyx_e_4nipy_9neurospin_8register_8routines_JOINT_ENTROPY); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 109; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  if (PyDict_SetItem(__pyx_2, __pyx_kp_37, __pyx_1) < 0) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 105; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_DECREF(__pyx_1); __pyx_1 = 0;
-
-  /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":110
- *                        'mi': MUTUAL_INFORMATION,
- *                        'je': JOINT_ENTROPY,
- *                        'ce': CONDITIONAL_ENTROPY,             # <<<<<<<<<<<<<<
- *                        'nmi': NORMALIZED_MUTUAL_INFORMATION,
- *                        'smi': SUPERVISED_MUTUAL_INFORMATION,
- */
-  __pyx_1 = PyInt_FromLong(__pyx_e_4nipy_9neurospin_8register_8routines_CONDITIONAL_ENTROPY); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 110; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  if (PyDict_SetItem(__pyx_2, __pyx_kp_38, __pyx_1) < 0) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 105; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_DECREF(__pyx_1); __pyx_1 = 0;
-
-  /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":111
- *                        'je': JOINT_ENTROPY,
- *                        'ce': CONDITIONAL_ENTROPY,
- *                        'nmi': NORMALIZED_MUTUAL_INFORMATION,             # <<<<<<<<<<<<<<
- *                        'smi': SUPERVISED_MUTUAL_INFORMATION,
- *                        'custom': CUSTOM_SIMILARITY}
- */
-  __pyx_1 = PyInt_FromLong(__pyx_e_4nipy_9neurospin_8register_8routines_NORMALIZED_MUTUAL_INFORMATION); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 111; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  if (PyDict_SetItem(__pyx_2, __pyx_kp_39, __pyx_1) < 0) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 105; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_DECREF(__pyx_1); __pyx_1 = 0;
-
-  /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":112
- *                        'ce': CONDITIONAL_ENTROPY,
- *                        'nmi': NORMALIZED_MUTUAL_INFORMATION,
- *                        'smi': SUPERVISED_MUTUAL_INFORMATION,             # <<<<<<<<<<<<<<
- *                        'custom': CUSTOM_SIMILARITY}
- * 
- */
-  __pyx_1 = PyInt_FromLong(__pyx_e_4nipy_9neurospin_8register_8routines_SUPERVISED_MUTUAL_INFORMATION); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 112; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  if (PyDict_SetItem(__pyx_2, __pyx_kp_40, __pyx_1) < 0) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 105; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_DECREF(__pyx_1); __pyx_1 = 0;
-
-  /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":113
- *                        'nmi': NORMALIZED_MUTUAL_INFORMATION,
- *                        'smi': SUPERVISED_MUTUAL_INFORMATION,
- *                        'custom': CUSTOM_SIMILARITY}             # <<<<<<<<<<<<<<
- * 
- * 
- */
-  __pyx_1 = PyInt_FromLong(__pyx_e_4nipy_9neurospin_8register_8routines_CUSTOM_SIMILARITY); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 113; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  if (PyDict_SetItem(__pyx_2, __pyx_kp_41, __pyx_1) < 0) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 105; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_DECREF(__pyx_1); __pyx_1 = 0;
-  if (PyObject_SetAttr(__pyx_m, __pyx_kp_similarity_measures, ((PyObject *)__pyx_2)) < 0) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 105; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_DECREF(((PyObject *)__pyx_2)); __pyx_2 = 0;
-
-  /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":399
- * 
- * # Corresponding Python constants
- * affines = ['rigid', 'similarity', 'affine']             # <<<<<<<<<<<<<<
- * 
- * _rigid2d = [0,1,5]
- */
-  __pyx_1 = PyList_New(3); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 399; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_INCREF(__pyx_kp_42);
-  PyList_SET_ITEM(__pyx_1, 0, __pyx_kp_42);
-  Py_INCREF(__pyx_kp_43);
-  PyList_SET_ITEM(__pyx_1, 1, __pyx_kp_43);
-  Py_INCREF(__pyx_kp_44);
-  PyList_SET_ITEM(__pyx_1, 2, __pyx_kp_44);
-  if (PyObject_SetAttr(__pyx_m, __pyx_kp_affines, ((PyObject *)__pyx_1)) < 0) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 399; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_DECREF(((PyObject *)__pyx_1)); __pyx_1 = 0;
-
-  /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":401
- * affines = ['rigid', 'similarity', 'affine']
- * 
- * _rigid2d = [0,1,5]             # <<<<<<<<<<<<<<
- * _similarity2d = [0,1,5,6,7]
- * _affine2d = [0,1,5,6,7,11]
- */
-  __pyx_2 = PyList_New(3); if (unlikely(!__pyx_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 401; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_INCREF(__pyx_int_0);
-  PyList_SET_ITEM(__pyx_2, 0, __pyx_int_0);
-  Py_INCREF(__pyx_int_1);
-  PyList_SET_ITEM(__pyx_2, 1, __pyx_int_1);
-  Py_INCREF(__pyx_int_5);
-  PyList_SET_ITEM(__pyx_2, 2, __pyx_int_5);
-  if (PyObject_SetAttr(__pyx_m, __pyx_kp_45, ((PyObject *)__pyx_2)) < 0) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 401; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_DECREF(((PyObject *)__pyx_2)); __pyx_2 = 0;
-
-  /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":402
- * 
- * _rigid2d = [0,1,5]
- * _similarity2d = [0,1,5,6,7]             # <<<<<<<<<<<<<<
- * _affine2d = [0,1,5,6,7,11]
- * _rigid3d = range(6)
- */
-  __pyx_1 = PyList_New(5); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 402; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_INCREF(__pyx_int_0);
-  PyList_SET_ITEM(__pyx_1, 0, __pyx_int_0);
-  Py_INCREF(__pyx_int_1);
-  PyList_SET_ITEM(__pyx_1, 1, __pyx_int_1);
-  Py_INCREF(__pyx_int_5);
-  PyList_SET_ITEM(__pyx_1, 2, __pyx_int_5);
-  Py_INCREF(__pyx_int_6);
-  PyList_SET_ITEM(__pyx_1, 3, __pyx_int_6);
-  Py_INCREF(__pyx_int_7);
-  PyList_SET_ITEM(__pyx_1, 4, __pyx_int_7);
-  if (PyObject_SetAttr(__pyx_m, __pyx_kp_46, ((PyObject *)__pyx_1)) < 0) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 402; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_DECREF(((PyObject *)__pyx_1)); __pyx_1 = 0;
-
-  /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":403
- * _rigid2d = [0,1,5]
- * _similarity2d = [0,1,5,6,7]
- * _affine2d = [0,1,5,6,7,11]             # <<<<<<<<<<<<<<
- * _rigid3d = range(6)
- * _similarity3d = range(9)
- */
-  __pyx_2 = PyList_New(6); if (unlikely(!__pyx_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 403; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_INCREF(__pyx_int_0);
-  PyList_SET_ITEM(__pyx_2, 0, __pyx_int_0);
-  Py_INCREF(__pyx_int_1);
-  PyList_SET_ITEM(__pyx_2, 1, __pyx_int_1);
-  Py_INCREF(__pyx_int_5);
-  PyList_SET_ITEM(__pyx_2, 2, __pyx_int_5);
-  Py_INCREF(__pyx_int_6);
-  PyList_SET_ITEM(__pyx_2, 3, __pyx_int_6);
-  Py_INCREF(__pyx_int_7);
-  PyList_SET_ITEM(__pyx_2, 4, __pyx_int_7);
-  Py_INCREF(__pyx_int_11);
-  PyList_SET_ITEM(__pyx_2, 5, __pyx_int_11);
-  if (PyObject_SetAttr(__pyx_m, __pyx_kp_47, ((PyObject *)__pyx_2)) < 0) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 403; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_DECREF(((PyObject *)__pyx_2)); __pyx_2 = 0;
-
-  /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":404
- * _similarity2d = [0,1,5,6,7]
- * _affine2d = [0,1,5,6,7,11]
- * _rigid3d = range(6)             # <<<<<<<<<<<<<<
- * _similarity3d = range(9)
- * _affine3d = range(12)
- */
-  __pyx_1 = PyTuple_New(1); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 404; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_INCREF(__pyx_int_6);
-  PyTuple_SET_ITEM(__pyx_1, 0, __pyx_int_6);
-  __pyx_2 = PyObject_Call(__pyx_builtin_range, ((PyObject *)__pyx_1), NULL); if (unlikely(!__pyx_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 404; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_DECREF(((PyObject *)__pyx_1)); __pyx_1 = 0;
-  if (PyObject_SetAttr(__pyx_m, __pyx_kp_48, __pyx_2) < 0) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 404; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_DECREF(__pyx_2); __pyx_2 = 0;
-
-  /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":405
- * _affine2d = [0,1,5,6,7,11]
- * _rigid3d = range(6)
- * _similarity3d = range(9)             # <<<<<<<<<<<<<<
- * _affine3d = range(12)
- * 
- */
-  __pyx_1 = PyTuple_New(1); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 405; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_INCREF(__pyx_int_9);
-  PyTuple_SET_ITEM(__pyx_1, 0, __pyx_int_9);
-  __pyx_2 = PyObject_Call(__pyx_builtin_range, ((PyObject *)__pyx_1), NULL); if (unlikely(!__pyx_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 405; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_DECREF(((PyObject *)__pyx_1)); __pyx_1 = 0;
-  if (PyObject_SetAttr(__pyx_m, __pyx_kp_49, __pyx_2) < 0) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 405; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_DECREF(__pyx_2); __pyx_2 = 0;
-
-  /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":406
- * _rigid3d = range(6)
- * _similarity3d = range(9)
- * _affine3d = range(12)             # <<<<<<<<<<<<<<
- * 
- * _affines = [_rigid2d, _similarity2d[0:4], _affine2d,
- */
-  __pyx_1 = PyTuple_New(1); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 406; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_INCREF(__pyx_int_12);
-  PyTuple_SET_ITEM(__pyx_1, 0, __pyx_int_12);
-  __pyx_2 = PyObject_Call(__pyx_builtin_range, ((PyObject *)__pyx_1), NULL); if (unlikely(!__pyx_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 406; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_DECREF(((PyObject *)__pyx_1)); __pyx_1 = 0;
-  if (PyObject_SetAttr(__pyx_m, __pyx_kp_50, __pyx_2) < 0) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 406; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_DECREF(__pyx_2); __pyx_2 = 0;
-
-  /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":408
- * _affine3d = range(12)
- * 
- * _affines = [_rigid2d, _similarity2d[0:4], _affine2d,             # <<<<<<<<<<<<<<
- *             _rigid3d, _similarity3d[0:7], _affine3d]
- * 
- */
-  __pyx_1 = __Pyx_GetName(__pyx_m, __pyx_kp_45); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 408; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __pyx_2 = __Pyx_GetName(__pyx_m, __pyx_kp_46); if (unlikely(!__pyx_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 408; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __pyx_3 = PySequence_GetSlice(__pyx_2, 0, 4); if (unlikely(!__pyx_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 408; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_DECREF(__pyx_2); __pyx_2 = 0;
-  __pyx_2 = __Pyx_GetName(__pyx_m, __pyx_kp_47); if (unlikely(!__pyx_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 408; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-
-  /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":409
- * 
- * _affines = [_rigid2d, _similarity2d[0:4], _affine2d,
- *             _rigid3d, _similarity3d[0:7], _affine3d]             # <<<<<<<<<<<<<<
- * 
- * 
- */
-  __pyx_4 = __Pyx_GetName(__pyx_m, __pyx_kp_48); if (unlikely(!__pyx_4)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 409; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __pyx_5 = __Pyx_GetName(__pyx_m, __pyx_kp_49); if (unlikely(!__pyx_5)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 409; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __pyx_6 = PySequence_GetSlice(__pyx_5, 0, 7); if (unlikely(!__pyx_6)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 409; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_DECREF(__pyx_5); __pyx_5 = 0;
-  __pyx_5 = __Pyx_GetName(__pyx_m, __pyx_kp_50); if (unlikely(!__pyx_5)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 409; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __pyx_7 = PyList_New(6); if (unlikely(!__pyx_7)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 408; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  PyList_SET_ITEM(__pyx_7, 0, __pyx_1);
-  PyList_SET_ITEM(__pyx_7, 1, __pyx_3);
-  PyList_SET_ITEM(__pyx_7, 2, __pyx_2);
-  PyList_SET_ITEM(__pyx_7, 3, __pyx_4);
-  PyList_SET_ITEM(__pyx_7, 4, __pyx_6);
-  PyList_SET_ITEM(__pyx_7, 5, __pyx_5);
-  __pyx_1 = 0;
-  __pyx_3 = 0;
-  __pyx_2 = 0;
-  __pyx_4 = 0;
-  __pyx_6 = 0;
-  __pyx_5 = 0;
-  if (PyObject_SetAttr(__pyx_m, __pyx_kp__affines, ((PyObject *)__pyx_7)) < 0) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 408; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  Py_DECREF(((PyObject *)__pyx_7)); __pyx_7 = 0;
-
-  /* "d:\home\ar203069\bzr\nipy\dev-trunk-neurospin\nipy\neurospin\register\routines.pyx":454
- * 
- * 
- * def param_to_vector12(ndarray param, ndarray t0, ndarray precond, int stamp=AFFINE3D):             # <<<<<<<<<<<<<<
- *     """
- *     t = param_to_vector12(p, t, precond, stamp=AFFINE3D).
- */
-  __pyx_k_51 = __pyx_e_4nipy_9neurospin_8register_8routines_AFFINE3D;
-
-  /* "c:\Python25\lib\site-packages\Cython\Includes\stdlib.pxd":2
- * 
- * cdef extern from "stdlib.h":             # <<<<<<<<<<<<<<
- *     ctypedef unsigned long size_t
- *     void free(void *ptr)
- */
-  #if PY_MAJOR_VERSION < 3
-  return;
-  #else
-  return __pyx_m;
-  #endif
-  __pyx_L1_error:;
-  Py_XDECREF(__pyx_1);
-  Py_XDECREF(__pyx_2);
-  Py_XDECREF(__pyx_3);
-  Py_XDECREF(__pyx_4);
-  Py_XDECREF(__pyx_5);
-  Py_XDECREF(__pyx_6);
-  Py_XDECREF(__pyx_7);
-  __Pyx_AddTraceback("nipy.neurospin.register.routines");
-  #if PY_MAJOR_VERSION >= 3
-  return NULL;
-  #endif
-}
-
-static const char *__pyx_filenames[] = {
-  "routines.pyx",
-  "numpy.pxd",
-  "numpy.pxi",
-};
-
-/* Runtime support code */
-
-static void __pyx_init_filenames(void) {
-  __pyx_f = __pyx_filenames;
-}
-
-static void __Pyx_RaiseDoubleKeywordsError(
-    const char* func_name,
-    PyObject* kw_name)
-{
-    PyErr_Format(PyExc_TypeError,
-        #if PY_MAJOR_VERSION >= 3
-        "%s() got multiple values for keyword argument '%U'", func_name, kw_name);
-        #else
-        "%s() got multiple values for keyword argument '%s'", func_name,
-        PyString_AS_STRING(kw_name));
-        #endif
-}
-
-static void __Pyx_RaiseArgtupleInvalid(
-    const char* func_name,
-    int exact,
-    Py_ssize_t num_min,
-    Py_ssize_t num_max,
-    Py_ssize_t num_found)
-{
-    Py_ssize_t num_expected;
-    const char *number, *more_or_less;
-
-    if (num_found < num_min) {
-        num_expected = num_min;
-        more_or_less = "at least";
-    } else {
-        num_expected = num_max;
-        more_or_less = "at most";
-    }
-    if (exact) {
-        more_or_less = "exactly";
-    }
-    number = (num_expected == 1) ? "" : "s";
-    PyErr_Format(PyExc_TypeError,
-        #if PY_VERSION_HEX < 0x02050000
-            "%s() takes %s %d positional argument%s (%d given)",
-        #else
-            "%s() takes %s %zd positional argument%s (%zd given)",
-        #endif
-        func_name, more_or_less, num_expected, number, num_found);
-}
-
-static int __Pyx_ParseOptionalKeywords(
-    PyObject *kwds,
-    PyObject **argnames[],
-    PyObject *kwds2,
-    PyObject *values[],
-    Py_ssize_t num_pos_args,
-    const char* function_name)
-{
-    PyObject *key = 0, *value = 0;
-    Py_ssize_t pos = 0;
-    PyObject*** name;
-    PyObject*** first_kw_arg = argnames + num_pos_args;
-
-    while (PyDict_Next(kwds, &pos, &key, &value)) {
-        #if PY_MAJOR_VERSION < 3
-        if (unlikely(!PyString_CheckExact(key)) && unlikely(!PyString_Check(key))) {
-        #else
-        if (unlikely(!PyUnicode_CheckExact(key)) && unlikely(!PyUnicode_Check(key))) {
-        #endif
-            goto invalid_keyword_type;
-        } else {
-            name = argnames;
-            while (*name && (**name != key)) name++;
-            if (*name) {
-                if (name < first_kw_arg) goto arg_passed_twice;
-                values[name-argnames] = value;
-            } else {
-                for (name = first_kw_arg; *name; name++) {
-                    #if PY_MAJOR_VERSION >= 3
-                    if (PyUnicode_GET_SIZE(**name) == PyUnicode_GET_SIZE(key) &&
-                        PyUnicode_Compare(**name, key) == 0) break;
-                    #else
-                    if (PyString_GET_SIZE(**name) == PyString_GET_SIZE(key) &&
-                        strcmp(PyString_AS_STRING(**name),
-                               PyString_AS_STRING(key)) == 0) break;
-                    #endif
-                }
-                if (*name) {
-                    values[name-argnames] = value;
-                } else {
-                    /* unexpected keyword found */
-                    for (name=argnames; name != first_kw_arg; name++) {
-                        if (**name == key) goto arg_passed_twice;
-                        #if PY_MAJOR_VERSION >= 3
-                        if (PyUnicode_GET_SIZE(**name) == PyUnicode_GET_SIZE(key) &&
-                            PyUnicode_Compare(**name, key) == 0) goto arg_passed_twice;
-                        #else
-                        if (PyString_GET_SIZE(**name) == PyString_GET_SIZE(key) &&
-                            strcmp(PyString_AS_STRING(**name),
-                                   PyString_AS_STRING(key)) == 0) goto arg_passed_twice;
-                        #endif
-                    }
-                    if (kwds2) {
-                        if (unlikely(PyDict_SetItem(kwds2, key, value))) goto bad;
-                    } else {
-                        goto invalid_keyword;
-                    }
-                }
-            }
-        }
-    }
-    return 0;
-arg_passed_twice:
-    __Pyx_RaiseDoubleKeywordsError(function_name, **name);
-    goto bad;
-invalid_keyword_type:
-    PyErr_Format(PyExc_TypeError,
-        "%s() keywords must be strings", function_name);
-    goto bad;
-invalid_keyword:
-    PyErr_Format(PyExc_TypeError,
-    #if PY_MAJOR_VERSION < 3
-        "%s() got an unexpected keyword argument '%s'",
-        function_name, PyString_AsString(key));
-    #else
-        "%s() got an unexpected keyword argument '%U'",
-        function_name, key);
-    #endif
-bad:
-    return -1;
-}
-
-
-static int __Pyx_ArgTypeTest(PyObject *obj, PyTypeObject *type, int none_allowed,
-    const char *name, int exact)
-{
-    if (!type) {
-        PyErr_Format(PyExc_SystemError, "Missing type object");
-        return 0;
-    }
-    if (none_allowed && obj == Py_None) return 1;
-    else if (exact) {
-        if (Py_TYPE(obj) == type) return 1;
-    }
-    else {
-        if (PyObject_TypeCheck(obj, type)) return 1;
-    }
-    PyErr_Format(PyExc_TypeError,
-        "Argument '%s' has incorrect type (expected %s, got %s)",
-        name, type->tp_name, Py_TYPE(obj)->tp_name);
-    return 0;
-}
-
-static PyObject *__Pyx_Import(PyObject *name, PyObject *from_list) {
-    PyObject *__import__ = 0;
-    PyObject *empty_list = 0;
-    PyObject *module = 0;
-    PyObject *global_dict = 0;
-    PyObject *empty_dict = 0;
-    PyObject *list;
-    __import__ = PyObject_GetAttrString(__pyx_b, "__import__");
-    if (!__import__)
-        goto bad;
-    if (from_list)
-        list = from_list;
-    else {
-        empty_list = PyList_New(0);
-        if (!empty_list)
-            goto bad;
-        list = empty_list;
-    }
-    global_dict = PyModule_GetDict(__pyx_m);
-    if (!global_dict)
-        goto bad;
-    empty_dict = PyDict_New();
-    if (!empty_dict)
-        goto bad;
-    module = PyObject_CallFunction(__import__, "OOOO",
-        name, global_dict, empty_dict, list);
-bad:
-    Py_XDECREF(empty_list);
-    Py_XDECREF(__import__);
-    Py_XDECREF(empty_dict);
-    return module;
-}
-
-static PyObject *__Pyx_GetName(PyObject *dict, PyObject *name) {
-    PyObject *result;
-    result = PyObject_GetAttr(dict, name);
-    if (!result)
-        PyErr_SetObject(PyExc_NameError, name);
-    return result;
-}
-
-static int __Pyx_TypeTest(PyObject *obj, PyTypeObject *type) {
-    if (!type) {
-        PyErr_Format(PyExc_SystemError, "Missing type object");
-        return 0;
-    }
-    if (obj == Py_None || PyObject_TypeCheck(obj, type))
-        return 1;
-    PyErr_Format(PyExc_TypeError, "Cannot convert %s to %s",
-        Py_TYPE(obj)->tp_name, type->tp_name);
-    return 0;
-}
-
-static INLINE void __Pyx_ExceptionSave(PyObject **type, PyObject **value, PyObject **tb) {
-    PyThreadState *tstate = PyThreadState_GET();
-    *type = tstate->exc_type;
-    *value = tstate->exc_value;
-    *tb = tstate->exc_traceback;
-    Py_XINCREF(*type);
-    Py_XINCREF(*value);
-    Py_XINCREF(*tb);
-}
-
-static void __Pyx_ExceptionReset(PyObject *type, PyObject *value, PyObject *tb) {
-    PyObject *tmp_type, *tmp_value, *tmp_tb;
-    PyThreadState *tstate = PyThreadState_GET();
-    tmp_type = tstate->exc_type;
-    tmp_value = tstate->exc_value;
-    tmp_tb = tstate->exc_traceback;
-    tstate->exc_type = type;
-    tstate->exc_value = value;
-    tstate->exc_traceback = tb;
-    Py_XDECREF(tmp_type);
-    Py_XDECREF(tmp_value);
-    Py_XDECREF(tmp_tb);
-}
-
-static void __Pyx_Raise(PyObject *type, PyObject *value, PyObject *tb) {
-    Py_XINCREF(type);
-    Py_XINCREF(value);
-    Py_XINCREF(tb);
-    /* First, check the traceback argument, replacing None with NULL. */
-    if (tb == Py_None) {
-        Py_DECREF(tb);
-        tb = 0;
-    }
-    else if (tb != NULL && !PyTraceBack_Check(tb)) {
-        PyErr_SetString(PyExc_TypeError,
-            "raise: arg 3 must be a traceback or None");
-        goto raise_error;
-    }
-    /* Next, replace a missing value with None */
-    if (value == NULL) {
-        value = Py_None;
-        Py_INCREF(value);
-    }
-    #if PY_VERSION_HEX < 0x02050000
-    if (!PyClass_Check(type))
-    #else
-    if (!PyType_Check(type))
-    #endif
-    {
-        /* Raising an instance.  The value should be a dummy. */
-        if (value != Py_None) {
-            PyErr_SetString(PyExc_TypeError,
-                "instance exception may not have a separate value");
-            goto raise_error;
-        }
-        /* Normalize to raise <class>, <instance> */
-        Py_DECREF(value);
-        value = type;
-        #if PY_VERSION_HEX < 0x02050000
-            if (PyInstance_Check(type)) {
-                type = (PyObject*) ((PyInstanceObject*)type)->in_class;
-                Py_INCREF(type);
-            }
-            else {
-                type = 0;
-                PyErr_SetString(PyExc_TypeError,
-                    "raise: exception must be an old-style class or instance");
-                goto raise_error;
-            }
-        #else
-            type = (PyObject*) Py_TYPE(type);
-            Py_INCREF(type);
-            if (!PyType_IsSubtype((PyTypeObject *)type, (PyTypeObject *)PyExc_BaseException)) {
-                PyErr_SetString(PyExc_TypeError,
-                    "raise: exception class must be a subclass of BaseException");
-                goto raise_error;
-            }
-        #endif
-    }
-    __Pyx_ErrRestore(type, value, tb);
-    return;
-raise_error:
-    Py_XDECREF(value);
-    Py_XDECREF(type);
-    Py_XDECREF(tb);
-    return;
-}
-
-static INLINE void __Pyx_ErrRestore(PyObject *type, PyObject *value, PyObject *tb) {
-    PyObject *tmp_type, *tmp_value, *tmp_tb;
-    PyThreadState *tstate = PyThreadState_GET();
-
-    tmp_type = tstate->curexc_type;
-    tmp_value = tstate->curexc_value;
-    tmp_tb = tstate->curexc_traceback;
-    tstate->curexc_type = type;
-    tstate->curexc_value = value;
-    tstate->curexc_traceback = tb;
-    Py_XDECREF(tmp_type);
-    Py_XDECREF(tmp_value);
-    Py_XDECREF(tmp_tb);
-}
-
-static INLINE void __Pyx_ErrFetch(PyObject **type, PyObject **value, PyObject **tb) {
-    PyThreadState *tstate = PyThreadState_GET();
-    *type = tstate->curexc_type;
-    *value = tstate->curexc_value;
-    *tb = tstate->curexc_traceback;
-
-    tstate->curexc_type = 0;
-    tstate->curexc_value = 0;
-    tstate->curexc_traceback = 0;
-}
-
-
-static int __Pyx_GetException(PyObject **type, PyObject **value, PyObject **tb) {
-    PyObject *tmp_type, *tmp_value, *tmp_tb;
-    PyThreadState *tstate = PyThreadState_GET();
-    __Pyx_ErrFetch(type, value, tb);
-    PyErr_NormalizeException(type, value, tb);
-    if (PyErr_Occurred())
-        goto bad;
-    Py_INCREF(*type);
-    Py_INCREF(*value);
-    Py_INCREF(*tb);
-    tmp_type = tstate->exc_type;
-    tmp_value = tstate->exc_value;
-    tmp_tb = tstate->exc_traceback;
-    tstate->exc_type = *type;
-    tstate->exc_value = *value;
-    tstate->exc_traceback = *tb;
-    /* Make sure tstate is in a consistent state when we XDECREF
-    these objects (XDECREF may run arbitrary code). */
-    Py_XDECREF(tmp_type);
-    Py_XDECREF(tmp_value);
-    Py_XDECREF(tmp_tb);
-    return 0;
-bad:
-    Py_XDECREF(*type);
-    Py_XDECREF(*value);
-    Py_XDECREF(*tb);
-    return -1;
-}
-
-
-#ifndef __PYX_HAVE_RT_ImportType
-#define __PYX_HAVE_RT_ImportType
-static PyTypeObject *__Pyx_ImportType(const char *module_name, const char *class_name,
-    long size)
-{
-    PyObject *py_module = 0;
-    PyObject *result = 0;
-    PyObject *py_name = 0;
-
-    py_module = __Pyx_ImportModule(module_name);
-    if (!py_module)
-        goto bad;
-    #if PY_MAJOR_VERSION < 3
-    py_name = PyString_FromString(class_name);
-    #else
-    py_name = PyUnicode_FromString(class_name);
-    #endif
-    if (!py_name)
-        goto bad;
-    result = PyObject_GetAttr(py_module, py_name);
-    Py_DECREF(py_name);
-    py_name = 0;
-    Py_DECREF(py_module);
-    py_module = 0;
-    if (!result)
-        goto bad;
-    if (!PyType_Check(result)) {
-        PyErr_Format(PyExc_TypeError, 
-            "%s.%s is not a type object",
-            module_name, class_name);
-        goto bad;
-    }
-    if (((PyTypeObject *)result)->tp_basicsize != size) {
-        PyErr_Format(PyExc_ValueError, 
-            "%s.%s does not appear to be the correct type object",
-            module_name, class_name);
-        goto bad;
-    }
-    return (PyTypeObject *)result;
-bad:
-    Py_XDECREF(py_module);
-    Py_XDECREF(result);
-    return 0;
-}
-#endif
-
-#ifndef __PYX_HAVE_RT_ImportModule
-#define __PYX_HAVE_RT_ImportModule
-static PyObject *__Pyx_ImportModule(const char *name) {
-    PyObject *py_name = 0;
-    PyObject *py_module = 0;
-
-    #if PY_MAJOR_VERSION < 3
-    py_name = PyString_FromString(name);
-    #else
-    py_name = PyUnicode_FromString(name);
-    #endif
-    if (!py_name)
-        goto bad;
-    py_module = PyImport_Import(py_name);
-    Py_DECREF(py_name);
-    return py_module;
-bad:
-    Py_XDECREF(py_name);
-    return 0;
-}
-#endif
-
-#include "compile.h"
-#include "frameobject.h"
-#include "traceback.h"
-
-static void __Pyx_AddTraceback(const char *funcname) {
-    PyObject *py_srcfile = 0;
-    PyObject *py_funcname = 0;
-    PyObject *py_globals = 0;
-    PyObject *empty_string = 0;
-    PyCodeObject *py_code = 0;
-    PyFrameObject *py_frame = 0;
-
-    #if PY_MAJOR_VERSION < 3
-    py_srcfile = PyString_FromString(__pyx_filename);
-    #else
-    py_srcfile = PyUnicode_FromString(__pyx_filename);
-    #endif
-    if (!py_srcfile) goto bad;
-    if (__pyx_clineno) {
-        #if PY_MAJOR_VERSION < 3
-        py_funcname = PyString_FromFormat( "%s (%s:%d)", funcname, __pyx_cfilenm, __pyx_clineno);
-        #else
-        py_funcname = PyUnicode_FromFormat( "%s (%s:%d)", funcname, __pyx_cfilenm, __pyx_clineno);
-        #endif
-    }
-    else {
-        #if PY_MAJOR_VERSION < 3
-        py_funcname = PyString_FromString(funcname);
-        #else
-        py_funcname = PyUnicode_FromString(funcname);
-        #endif
-    }
-    if (!py_funcname) goto bad;
-    py_globals = PyModule_GetDict(__pyx_m);
-    if (!py_globals) goto bad;
-    #if PY_MAJOR_VERSION < 3
-    empty_string = PyString_FromStringAndSize("", 0);
-    #else
-    empty_string = PyBytes_FromStringAndSize("", 0);
-    #endif
-    if (!empty_string) goto bad;
-    py_code = PyCode_New(
-        0,            /*int argcount,*/
-        #if PY_MAJOR_VERSION >= 3
-        0,            /*int kwonlyargcount,*/
-        #endif
-        0,            /*int nlocals,*/
-        0,            /*int stacksize,*/
-        0,            /*int flags,*/
-        empty_string, /*PyObject *code,*/
-        __pyx_empty_tuple,  /*PyObject *consts,*/
-        __pyx_empty_tuple,  /*PyObject *names,*/
-        __pyx_empty_tuple,  /*PyObject *varnames,*/
-        __pyx_empty_tuple,  /*PyObject *freevars,*/
-        __pyx_empty_tuple,  /*PyObject *cellvars,*/
-        py_srcfile,   /*PyObject *filename,*/
-        py_funcname,  /*PyObject *name,*/
-        __pyx_lineno,   /*int firstlineno,*/
-        empty_string  /*PyObject *lnotab*/
-    );
-    if (!py_code) goto bad;
-    py_frame = PyFrame_New(
-        PyThreadState_GET(), /*PyThreadState *tstate,*/
-        py_code,             /*PyCodeObject *code,*/
-        py_globals,          /*PyObject *globals,*/
-        0                    /*PyObject *locals*/
-    );
-    if (!py_frame) goto bad;
-    py_frame->f_lineno = __pyx_lineno;
-    PyTraceBack_Here(py_frame);
-bad:
-    Py_XDECREF(py_srcfile);
-    Py_XDECREF(py_funcname);
-    Py_XDECREF(empty_string);
-    Py_XDECREF(py_code);
-    Py_XDECREF(py_frame);
-}
-
-static int __Pyx_InitStrings(__Pyx_StringTabEntry *t) {
-    while (t->p) {
-        #if PY_MAJOR_VERSION < 3
-        if (t->is_unicode && (!t->is_identifier)) {
-            *t->p = PyUnicode_DecodeUTF8(t->s, t->n - 1, NULL);
-        } else if (t->intern) {
-            *t->p = PyString_InternFromString(t->s);
-        } else {
-            *t->p = PyString_FromStringAndSize(t->s, t->n - 1);
-        }
-        #else  /* Python 3+ has unicode identifiers */
-        if (t->is_identifier || (t->is_unicode && t->intern)) {
-            *t->p = PyUnicode_InternFromString(t->s);
-        } else if (t->is_unicode) {
-            *t->p = PyUnicode_FromStringAndSize(t->s, t->n - 1);
-        } else {
-            *t->p = PyBytes_FromStringAndSize(t->s, t->n - 1);
-        }
-        #endif
-        if (!*t->p)
-            return -1;
-        ++t;
-    }
-    return 0;
-}
-
-/* Type Conversion Functions */
-
-static INLINE Py_ssize_t __pyx_PyIndex_AsSsize_t(PyObject* b) {
-  Py_ssize_t ival;
-  PyObject* x = PyNumber_Index(b);
-  if (!x) return -1;
-  ival = PyInt_AsSsize_t(x);
-  Py_DECREF(x);
-  return ival;
-}
-
-static INLINE int __Pyx_PyObject_IsTrue(PyObject* x) {
-   if (x == Py_True) return 1;
-   else if (x == Py_False) return 0;
-   else return PyObject_IsTrue(x);
-}
-
-static INLINE PY_LONG_LONG __pyx_PyInt_AsLongLong(PyObject* x) {
-    if (PyInt_CheckExact(x)) {
-        return PyInt_AS_LONG(x);
-    }
-    else if (PyLong_CheckExact(x)) {
-        return PyLong_AsLongLong(x);
-    }
-    else {
-        PY_LONG_LONG val;
-        PyObject* tmp = PyNumber_Int(x); if (!tmp) return (PY_LONG_LONG)-1;
-        val = __pyx_PyInt_AsLongLong(tmp);
-        Py_DECREF(tmp);
-        return val;
-    }
-}
-
-static INLINE unsigned PY_LONG_LONG __pyx_PyInt_AsUnsignedLongLong(PyObject* x) {
-    if (PyInt_CheckExact(x)) {
-        long val = PyInt_AS_LONG(x);
-        if (unlikely(val < 0)) {
-            PyErr_SetString(PyExc_TypeError, "Negative assignment to unsigned type.");
-            return (unsigned PY_LONG_LONG)-1;
-        }
-        return val;
-    }
-    else if (PyLong_CheckExact(x)) {
-        return PyLong_AsUnsignedLongLong(x);
-    }
-    else {
-        PY_LONG_LONG val;
-        PyObject* tmp = PyNumber_Int(x); if (!tmp) return (PY_LONG_LONG)-1;
-        val = __pyx_PyInt_AsUnsignedLongLong(tmp);
-        Py_DECREF(tmp);
-        return val;
-    }
-}
-
-
-static INLINE unsigned char __pyx_PyInt_unsigned_char(PyObject* x) {
-    if (sizeof(unsigned char) < sizeof(long)) {
-        long long_val = __pyx_PyInt_AsLong(x);
-        unsigned char val = (unsigned char)long_val;
-        if (unlikely((val != long_val)  || (long_val < 0))) {
-            PyErr_SetString(PyExc_OverflowError, "value too large to convert to unsigned char");
-            return (unsigned char)-1;
-        }
-        return val;
-    }
-    else {
-        return __pyx_PyInt_AsLong(x);
-    }
-}
-
-static INLINE unsigned short __pyx_PyInt_unsigned_short(PyObject* x) {
-    if (sizeof(unsigned short) < sizeof(long)) {
-        long long_val = __pyx_PyInt_AsLong(x);
-        unsigned short val = (unsigned short)long_val;
-        if (unlikely((val != long_val)  || (long_val < 0))) {
-            PyErr_SetString(PyExc_OverflowError, "value too large to convert to unsigned short");
-            return (unsigned short)-1;
-        }
-        return val;
-    }
-    else {
-        return __pyx_PyInt_AsLong(x);
-    }
-}
-
-static INLINE char __pyx_PyInt_char(PyObject* x) {
-    if (sizeof(char) < sizeof(long)) {
-        long long_val = __pyx_PyInt_AsLong(x);
-        char val = (char)long_val;
-        if (unlikely((val != long_val) )) {
-            PyErr_SetString(PyExc_OverflowError, "value too large to convert to char");
-            return (char)-1;
-        }
-        return val;
-    }
-    else {
-        return __pyx_PyInt_AsLong(x);
-    }
-}
-
-static INLINE short __pyx_PyInt_short(PyObject* x) {
-    if (sizeof(short) < sizeof(long)) {
-        long long_val = __pyx_PyInt_AsLong(x);
-        short val = (short)long_val;
-        if (unlikely((val != long_val) )) {
-            PyErr_SetString(PyExc_OverflowError, "value too large to convert to short");
-            return (short)-1;
-        }
-        return val;
-    }
-    else {
-        return __pyx_PyInt_AsLong(x);
-    }
-}
-
-static INLINE int __pyx_PyInt_int(PyObject* x) {
-    if (sizeof(int) < sizeof(long)) {
-        long long_val = __pyx_PyInt_AsLong(x);
-        int val = (int)long_val;
-        if (unlikely((val != long_val) )) {
-            PyErr_SetString(PyExc_OverflowError, "value too large to convert to int");
-            return (int)-1;
-        }
-        return val;
-    }
-    else {
-        return __pyx_PyInt_AsLong(x);
-    }
-}
-
-static INLINE long __pyx_PyInt_long(PyObject* x) {
-    if (sizeof(long) < sizeof(long)) {
-        long long_val = __pyx_PyInt_AsLong(x);
-        long val = (long)long_val;
-        if (unlikely((val != long_val) )) {
-            PyErr_SetString(PyExc_OverflowError, "value too large to convert to long");
-            return (long)-1;
-        }
-        return val;
-    }
-    else {
-        return __pyx_PyInt_AsLong(x);
-    }
-}
-
-static INLINE signed char __pyx_PyInt_signed_char(PyObject* x) {
-    if (sizeof(signed char) < sizeof(long)) {
-        long long_val = __pyx_PyInt_AsLong(x);
-        signed char val = (signed char)long_val;
-        if (unlikely((val != long_val) )) {
-            PyErr_SetString(PyExc_OverflowError, "value too large to convert to signed char");
-            return (signed char)-1;
-        }
-        return val;
-    }
-    else {
-        return __pyx_PyInt_AsLong(x);
-    }
-}
-
-static INLINE signed short __pyx_PyInt_signed_short(PyObject* x) {
-    if (sizeof(signed short) < sizeof(long)) {
-        long long_val = __pyx_PyInt_AsLong(x);
-        signed short val = (signed short)long_val;
-        if (unlikely((val != long_val) )) {
-            PyErr_SetString(PyExc_OverflowError, "value too large to convert to signed short");
-            return (signed short)-1;
-        }
-        return val;
-    }
-    else {
-        return __pyx_PyInt_AsLong(x);
-    }
-}
-
-static INLINE signed int __pyx_PyInt_signed_int(PyObject* x) {
-    if (sizeof(signed int) < sizeof(long)) {
-        long long_val = __pyx_PyInt_AsLong(x);
-        signed int val = (signed int)long_val;
-        if (unlikely((val != long_val) )) {
-            PyErr_SetString(PyExc_OverflowError, "value too large to convert to signed int");
-            return (signed int)-1;
-        }
-        return val;
-    }
-    else {
-        return __pyx_PyInt_AsLong(x);
-    }
-}
-
-static INLINE signed long __pyx_PyInt_signed_long(PyObject* x) {
-    if (sizeof(signed long) < sizeof(long)) {
-        long long_val = __pyx_PyInt_AsLong(x);
-        signed long val = (signed long)long_val;
-        if (unlikely((val != long_val) )) {
-            PyErr_SetString(PyExc_OverflowError, "value too large to convert to signed long");
-            return (signed long)-1;
-        }
-        return val;
-    }
-    else {
-        return __pyx_PyInt_AsLong(x);
-    }
-}
-
-static INLINE long double __pyx_PyInt_long_double(PyObject* x) {
-    if (sizeof(long double) < sizeof(long)) {
-        long long_val = __pyx_PyInt_AsLong(x);
-        long double val = (long double)long_val;
-        if (unlikely((val != long_val) )) {
-            PyErr_SetString(PyExc_OverflowError, "value too large to convert to long double");
-            return (long double)-1;
-        }
-        return val;
-    }
-    else {
-        return __pyx_PyInt_AsLong(x);
-    }
-}
-
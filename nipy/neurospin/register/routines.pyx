@@ -15,19 +15,41 @@ __version__ = '0.2'
 include "numpy.pxi"
 
 # Externals
+cdef extern from "math.h":
+
+    double log(double x)
+
 cdef extern from "iconic.h":
 
     void iconic_import_array()
     void histogram(double* H, unsigned int clamp, flatiter iter)
     void local_histogram(double* H, unsigned int clamp, 
                          flatiter iter, unsigned int* size)
+    ctypedef struct local_moments:
+        double n
+        double s1
+        double s2
+        double hlogh
+    void local_histogram_sliding(double* H, local_moments* m, unsigned int clamp, 
+                                 flatiter iter, unsigned int* size)
     void drange(double* h, unsigned int size, double* res)
     void L2_moments(double* h, unsigned int size, double* res)
     void L1_moments(double * h, unsigned int size, double *res)
     double entropy(double* h, unsigned int size, double* n)
     void joint_histogram(double* H, unsigned int clampI, unsigned int clampJ,  
                          flatiter iterI, ndarray imJ_padded, 
-                         double* Tvox, int interp)
+                         double* Tvox, int interp, int nthreads)
+    void joint_histogram_points(double* H, unsigned int clampI, unsigned int clampJ,  
+                                short* xyz, unsigned short* bins, size_t npoints, 
+                                ndarray imJ_padded, 
+                                double* Tvox, int interp, int nthreads)
+    void joint_histogram_gradient(double* H, double* dH, unsigned int clampI, unsigned int clampJ,  
+                                  short* xyz, unsigned short* bins, size_t npoints, 
+                                  ndarray imJ_padded, double* Tvox, int nthreads)
+    void joint_histogram_batch(double* H, unsigned int clampI, unsigned int clampJ,  
+                               short* xyz, unsigned short* bins, size_t npoints, 
+                               ndarray imJ_padded, double* Tvox, unsigned int ntransforms, 
+                               int interp, int nthreads)
     double correlation_coefficient(double* H, unsigned int clampI, unsigned int clampJ, double* n)
     double correlation_ratio(double* H, unsigned int clampI, unsigned int clampJ, double* n) 
     double correlation_ratio_L1(double* H, double* hI, unsigned int clampI, unsigned int clampJ, double* n) 
@@ -45,17 +67,69 @@ cdef extern from "iconic.h":
                                          double* fI, unsigned int clampI, 
                                          double* fJ, unsigned int clampJ,
                                          double* n) 
+    double correlation_coefficient_gradient(double* G, double* H, unsigned int clampI, unsigned int clampJ)
+    double correlation_ratio_gradient(double* G, double* H, unsigned int clampI, unsigned int clampJ)
+    double mutual_information_gradient(double* G, double* H, 
+                                       double* hI, unsigned int clampI, 
+                                       double* hJ, unsigned int clampJ)
+    double normalized_mutual_information_gradient(double* G, double* H, 
+                                                  double* hI, unsigned int clampI, 
+                                                  double* hJ, unsigned int clampJ)
+    void similarity_gradient(double* grad, double* G, double* dH, unsigned int clampI, unsigned int clampJ)
+    enum: 
+        SIMILARITY_CC
+        SIMILARITY_CR
+        SIMILARITY_CRL1
+        SIMILARITY_JE
+        SIMILARITY_CE
+        SIMILARITY_MI
+        SIMILARITY_NMI
+    ctypedef struct similarity_values: 
+        double n
+        double cc
+        double cr
+        double crl1
+        double je
+        double ce
+        double mi
+        double nmi
+    void similarities(similarity_values* res, double* H, 
+                      double* hI, unsigned int clampI, 
+                      double* hJ, unsigned int clampJ, 
+                      unsigned int which)
     void cubic_spline_resample(ndarray im_resampled, ndarray im, double* Tvox, int cast_integer)
 
 
 cdef extern from "cubic_spline.h":
     
     void cubic_spline_import_array()
-    void cubic_spline_transform(ndarray res, ndarray src)
+    void cubic_spline_transform(ndarray res, ndarray src, int nthreads)
+    void cubic_spline_transform_axis(ndarray res, int axis, int nthreads)
+    void cubic_spline_reduce(ndarray res, ndarray src)
     double cubic_spline_sample1d(double x, ndarray coef) 
     double cubic_spline_sample2d(double x, double y, ndarray coef) 
     double cubic_spline_sample3d(double x, double y, double z, ndarray coef) 
     double cubic_spline_sample4d(double x, double y, double z, double t, ndarray coef) 
+    void cubic_spline_resample3d(ndarray res, ndarray coef, double* Tvox, int bounded)
+    void cubic_spline_resample4d(ndarray res, ndarray coef, double* Tvox, ndarray t, int bounded)
+    void cubic_spline_resample4d_frames(ndarray res, ndarray coef, double* Tvox, ndarray t, 
+                                        int bounded, int nthreads)
+    ctypedef struct cubic_spline_slice_timing: 
+        double start
+        double tr
+        double tr_slices
+        double* slice_order
+        unsigned int nslices
+        int reversed
+        double last_slice
+    void cubic_spline_resample4d_slices(ndarray res, ndarray coef, double* Tvox, double* times, 
+                                        cubic_spline_slice_timing* timing, double shift, 
+                                        int bounded, int nthreads)
+
+
+cdef extern from "fff_threads.h":
+
+    int fff_threads_count(int nthreads)
 
 
 # Initialize numpy
@@ -117,8 +191,10 @@ def _texture(ndarray im, ndarray H, Size, int texture, method=None):
 
     cdef double *res, *h
     cdef double moments[5]
+    cdef double mean
     cdef unsigned int clamp
     cdef unsigned int coords[3], size[3]
+    cdef local_moments m
     cdef broadcast multi
     cdef flatiter im_iter
 
@@ -134,13 +210,14 @@ def _texture(ndarray im, ndarray H, Size, int texture, method=None):
     # Allocate output 
     imtext = np.zeros(im.shape, dtype='double')
 
-    # Loop over input and output images
+    # Loop over input and output images in C order, so that the local
+    # histogram slides along the last axis
     multi = PyArray_MultiIterNew(2, <void*>imtext, <void*>im)
     while(multi.index < multi.size):
         res = <double*>PyArray_MultiIter_DATA(multi, 0)
         im_iter = <flatiter>multi.iters[1]
-        # Compute local image histogram
-        local_histogram(h, clamp, im_iter, size)
+        # Update local image histogram
+        local_histogram_sliding(h, &m, clamp, im_iter, size)
         # Switch 
         if texture == MIN:
             drange(h, clamp, moments)
@@ -152,11 +229,12 @@ def _texture(ndarray im, ndarray H, Size, int texture, method=None):
             drange(h, clamp, moments)
             res[0] = moments[1]-moments[0]
         elif texture == MEAN: 
-            L2_moments(h, clamp, moments)
-            res[0] = moments[1]
-        elif texture == MEAN: 
-            L2_moments(h, clamp, moments)
-            res[0] = moments[2]
+            if m.n > 0: 
+                res[0] = m.s1/m.n
+        elif texture == VARIANCE: 
+            if m.n > 0: 
+                mean = m.s1/m.n
+                res[0] = m.s2/m.n - mean*mean
         elif texture == MEDIAN:
             L1_moments(h, clamp, moments)
             res[0] = moments[1] 
@@ -164,7 +242,8 @@ def _texture(ndarray im, ndarray H, Size, int texture, method=None):
             L1_moments(h, clamp, moments)
             res[0] = moments[2] 
         elif texture == ENTROPY: 
-            res[0] = entropy(h, clamp, moments)
+            if m.n > 0: 
+                res[0] = log(m.n) - m.hlogh/m.n
         else: # CUSTOM
             res[0] = method(H)
         # Next voxel please
@@ -191,26 +270,210 @@ def _histogram(ndarray H, flatiter iter):
     return 
 
 
-def _joint_histogram(ndarray H, flatiter iterI, ndarray imJ, ndarray Tvox, int interp):
+def _joint_histogram(ndarray H, flatiter iterI, ndarray imJ, ndarray Tvox, int interp, 
+                     int nthreads=1):
     """
-    _joint_histogram(H, iterI, imJ, Tvox, interp)
+    _joint_histogram(H, iterI, imJ, Tvox, interp, nthreads=1)
     Comments to follow.
+
+    nthreads is the number of threads used to accumulate H (all
+    available processors if nthreads<=0). The result does not depend
+    on nthreads, including for random interpolation (interp<0), whose
+    draws are functions of the seed -interp and the voxel coordinates.
+    """
+    cdef double *h, *tvox
+    cdef unsigned int clampI, clampJ
+
+    # Views
+    clampI = <unsigned int>H.dimensions[0]
+    clampJ = <unsigned int>H.dimensions[1]    
+    h = <double*>H.data
+    tvox = <double*>Tvox.data
+
+    # Compute joint histogram 
+    joint_histogram(h, clampI, clampJ, iterI, imJ, tvox, interp, nthreads)
+
+    return 
+
+
+def _joint_histogram_points(ndarray H, ndarray xyz, ndarray bins, ndarray imJ, 
+                            ndarray Tvox, int interp, int nthreads=1):
+    """
+    _joint_histogram_points(H, xyz, bins, imJ, Tvox, interp, nthreads=1)
+
+    Same as _joint_histogram for a source point set: xyz is a
+    C-contiguous (3,N) int16 array of voxel coordinates and bins a
+    contiguous (N,) uint16 array of intensities sorted in increasing
+    order.
     """
     cdef double *h, *tvox
+    cdef short *pxyz
+    cdef unsigned short *pbins
     cdef unsigned int clampI, clampJ
+    cdef size_t npoints
 
     # Views
     clampI = <unsigned int>H.dimensions[0]
     clampJ = <unsigned int>H.dimensions[1]    
     h = <double*>H.data
     tvox = <double*>Tvox.data
+    pxyz = <short*>xyz.data
+    pbins = <unsigned short*>bins.data
+    npoints = <size_t>bins.dimensions[0]
 
     # Compute joint histogram 
-    joint_histogram(h, clampI, clampJ, iterI, imJ, tvox, interp)
+    joint_histogram_points(h, clampI, clampJ, pxyz, pbins, npoints, imJ, tvox, interp, nthreads)
+
+    return 
+
+
+def _joint_histogram_batch(ndarray H, ndarray xyz, ndarray bins, ndarray imJ, 
+                           ndarray Tvox, int interp, int nthreads=1):
+    """
+    _joint_histogram_batch(H, xyz, bins, imJ, Tvox, interp, nthreads=1)
+
+    Same as _joint_histogram_points for a batch of K voxel
+    transformations, passed as a C-contiguous (K,4,4) array Tvox. H
+    is a C-contiguous (K,clampI,clampJ) array. The source points are
+    scanned only once for the whole batch.
+    """
+    cdef double *h, *tvox
+    cdef short *pxyz
+    cdef unsigned short *pbins
+    cdef unsigned int clampI, clampJ, ntransforms
+    cdef size_t npoints
+
+    # Views
+    ntransforms = <unsigned int>H.dimensions[0]
+    clampI = <unsigned int>H.dimensions[1]
+    clampJ = <unsigned int>H.dimensions[2]    
+    h = <double*>H.data
+    tvox = <double*>Tvox.data
+    pxyz = <short*>xyz.data
+    pbins = <unsigned short*>bins.data
+    npoints = <size_t>bins.dimensions[0]
+
+    # Compute joint histograms 
+    joint_histogram_batch(h, clampI, clampJ, pxyz, pbins, npoints, imJ, tvox, 
+                          ntransforms, interp, nthreads)
+
+    return 
+
+
+def _joint_histogram_gradient(ndarray H, ndarray dH, ndarray xyz, ndarray bins, ndarray imJ, 
+                              ndarray Tvox, int nthreads=1):
+    """
+    _joint_histogram_gradient(H, dH, xyz, bins, imJ, Tvox, nthreads=1)
+
+    Same as _joint_histogram_points with PV interpolation, also
+    computing the derivatives of H with respect to the coefficients
+    of Tvox[0:3,:] in the pre-allocated (clampI, clampJ, 12) array dH.
+    """
+    cdef double *h, *dh, *tvox
+    cdef short *pxyz
+    cdef unsigned short *pbins
+    cdef unsigned int clampI, clampJ
+    cdef size_t npoints
+
+    # Views
+    clampI = <unsigned int>H.dimensions[0]
+    clampJ = <unsigned int>H.dimensions[1]    
+    h = <double*>H.data
+    dh = <double*>dH.data
+    tvox = <double*>Tvox.data
+    pxyz = <short*>xyz.data
+    pbins = <unsigned short*>bins.data
+    npoints = <size_t>bins.dimensions[0]
+
+    # Compute joint histogram and derivatives 
+    joint_histogram_gradient(h, dh, clampI, clampJ, pxyz, pbins, npoints, imJ, tvox, nthreads)
 
     return 
 
 
+def _similarity_gradient(ndarray H, ndarray dH, ndarray HI, ndarray HJ, int simitype):
+    """
+    simi, grad = _similarity_gradient(H, dH, hI, hJ, simitype)
+
+    Similarity measure and its (3,4) array of derivatives with respect
+    to Tvox[0:3,:], given H and dH as computed by
+    _joint_histogram_gradient. Only 'cc', 'cr', 'mi' and 'nmi' are
+    supported.
+    """
+    cdef double *h, *dh, *hI, *hJ, *g, *grad
+    cdef double simi=0.0
+    cdef unsigned int clampI, clampJ
+    cdef ndarray G, Grad
+
+    # Array views
+    clampI = <unsigned int>H.dimensions[0]
+    clampJ = <unsigned int>H.dimensions[1]
+    G = np.zeros([clampI, clampJ])
+    Grad = np.zeros([3, 4])
+    h = <double*>H.data
+    dh = <double*>dH.data
+    hI = <double*>HI.data
+    hJ = <double*>HJ.data
+    g = <double*>G.data
+    grad = <double*>Grad.data
+
+    # Switch 
+    if simitype == CORRELATION_COEFFICIENT:
+        simi = correlation_coefficient_gradient(g, h, clampI, clampJ)
+    elif simitype == CORRELATION_RATIO: 
+        simi = correlation_ratio_gradient(g, h, clampI, clampJ) 
+    elif simitype == MUTUAL_INFORMATION: 
+        simi = mutual_information_gradient(g, h, hI, clampI, hJ, clampJ) 
+    elif simitype == NORMALIZED_MUTUAL_INFORMATION:
+        simi = normalized_mutual_information_gradient(g, h, hI, clampI, hJ, clampJ) 
+    else: 
+        raise ValueError('Similarity gradient not available')
+
+    similarity_gradient(grad, g, dh, clampI, clampJ)
+
+    return simi, Grad
+
+
+# Similarity measures available from _similarities 
+fused_similarities = {'cc': SIMILARITY_CC, 
+                      'cr': SIMILARITY_CR, 
+                      'crl1': SIMILARITY_CRL1, 
+                      'je': SIMILARITY_JE, 
+                      'ce': SIMILARITY_CE, 
+                      'mi': SIMILARITY_MI, 
+                      'nmi': SIMILARITY_NMI}
+
+def _similarities(ndarray H, ndarray HI, ndarray HJ, simis):
+    """
+    values = _similarities(H, hI, hJ, simis)
+
+    Dictionary of the similarity measures named in simis (keys of
+    fused_similarities), computed in a single pass over H. The
+    marginal histograms are returned in hI and hJ. 
+    """
+    cdef double *h, *hI, *hJ
+    cdef unsigned int clampI, clampJ, which=0
+    cdef similarity_values res
+
+    # Array views
+    clampI = <unsigned int>H.dimensions[0]
+    clampJ = <unsigned int>H.dimensions[1]
+    h = <double*>H.data
+    hI = <double*>HI.data
+    hJ = <double*>HJ.data
+
+    for s in simis: 
+        if not s in fused_similarities: 
+            raise ValueError('Unknown similarity measure: %s' % s)
+        which = which | fused_similarities[s]
+
+    similarities(&res, h, hI, clampI, hJ, clampJ, which)
+
+    values = {'cc': res.cc, 'cr': res.cr, 'crl1': res.crl1, 'je': res.je, 
+              'ce': res.ce, 'mi': res.mi, 'nmi': res.nmi}
+    return dict([(s, values[s]) for s in simis])
+
+
 def _similarity(ndarray H, ndarray HI, ndarray HJ, int simitype, 
                 ndarray F=None, method=None):
     """
@@ -256,9 +519,24 @@ def _similarity(ndarray H, ndarray HI, ndarray HJ, int simitype,
 
 
 
-def cspline_transform(ndarray x):
+def cspline_transform(ndarray x, axes=None, int nthreads=1):
+    """
+    c = cspline_transform(x, axes=None, nthreads=1)
+
+    Cubic spline coefficients of array x along the given axes (all
+    axes if None). nthreads is the number of threads (all available
+    processors if nthreads<=0); the result does not depend on it.
+    """
+    cdef ndarray c
     c = np.zeros(x.shape)
-    cubic_spline_transform(c, x)
+    if axes == None: 
+        cubic_spline_transform(c, x, nthreads)
+        return c
+    c[:] = x
+    for axis in axes: 
+        if axis < 0 or axis >= x.ndim: 
+            raise ValueError('invalid axis')
+        cubic_spline_transform_axis(c, axis, nthreads)
     return c
 
 def cspline_sample1d(ndarray R, ndarray C, X=0):
@@ -328,6 +606,131 @@ def cspline_sample4d(ndarray R, ndarray C, X=0, Y=0, Z=0, T=0):
     return R
 
 
+def _cspline_coef(ndarray C):
+    if C.dtype == np.float32: 
+        return C
+    return np.asarray(C, dtype='double')
+
+def cspline_resample3d(ndarray C, dims, Tvox, bounded=False):
+    """
+    R = cspline_resample3d(C, dims, Tvox, bounded=False)
+
+    Resample the 3d image whose cubic spline coefficients are C (see
+    cspline_transform) on a grid of shape dims, given the 4x4 voxel
+    transformation Tvox from the output grid to C. Same as
+    cspline_sample3d at the transformed grid points, but much faster.
+    C may be single precision (float32) to save memory. Points outside
+    C are set to zero if bounded is True, and mirrored otherwise.
+    """
+    cdef ndarray Ca, Ta, R
+    Ca = _cspline_coef(C)
+    if Ca.ndim != 3 or len(dims) != 3: 
+        raise ValueError('3d arrays expected')
+    Ta = np.asarray(Tvox, dtype='double', order='C')
+    R = np.zeros(tuple(dims))
+    cubic_spline_resample3d(R, Ca, <double*>Ta.data, int(bounded))
+    return R
+
+def cspline_resample4d(ndarray C, Tvox, T, bounded=False):
+    """
+    R = cspline_resample4d(C, Tvox, T, bounded=False)
+
+    Same as cspline_resample3d for a 4d coefficient image C. The
+    first three coordinates are given by the 4x4 voxel transformation
+    Tvox and the fourth coordinate by the 3d array T, which has the
+    shape of the output. 
+    """
+    cdef ndarray Ca, Ta, Tt, R
+    Ca = _cspline_coef(C)
+    Ta = np.asarray(Tvox, dtype='double', order='C')
+    Tt = np.asarray(T, dtype='double')
+    if Ca.ndim != 4 or Tt.ndim != 3: 
+        raise ValueError('4d coefficients and 3d time coordinates expected')
+    R = np.zeros(Tt.shape)
+    cubic_spline_resample4d(R, Ca, <double*>Ta.data, Tt, int(bounded))
+    return R
+
+
+def cspline_resample4d_frames(ndarray C, Tvox, T, bounded=False, int nthreads=1):
+    """
+    R = cspline_resample4d_frames(C, Tvox, T, bounded=False, nthreads=1)
+
+    Resample several frames of a 4d coefficient image C in one
+    call. Tvox is a (n,4,4) array of voxel transformations and T the
+    (n,X,Y,Z) array of fourth coordinates, frame k being resampled as
+    cspline_resample4d(C, Tvox[k], T[k]) into R[k]. Frames are
+    distributed across nthreads threads (all available processors if
+    nthreads<=0); the result does not depend on nthreads.
+    """
+    cdef ndarray Ca, Ta, Tt, R
+    Ca = _cspline_coef(C)
+    Ta = np.ascontiguousarray(Tvox, dtype='double')
+    Tt = np.asarray(T, dtype='double')
+    if Ca.ndim != 4 or Tt.ndim != 4: 
+        raise ValueError('4d coefficients and 4d time coordinates expected')
+    if Ta.shape != (Tt.shape[0], 4, 4):
+        raise ValueError('one 4x4 transformation per frame expected')
+    R = np.zeros(Tt.shape)
+    cubic_spline_resample4d_frames(R, Ca, <double*>Ta.data, Tt, int(bounded), nthreads)
+    return R
+
+
+def cspline_resample4d_slices(ndarray C, Tvox, times, dims, double start, double tr, 
+                              double tr_slices, slice_order, reversed=False, 
+                              double last_slice=0, double shift=0, bounded=False, 
+                              int nthreads=1):
+    """
+    R = cspline_resample4d_slices(C, Tvox, times, dims, start, tr, tr_slices, slice_order, 
+                                  reversed=False, last_slice=0, shift=0, bounded=False, 
+                                  nthreads=1)
+
+    Same as cspline_resample4d_frames(C, Tvox, T-shift) on grids of
+    shape dims, the time coordinates T of frame k being those of an
+    Image4d acquired at time times[k]:
+
+      T = (times[k] - start - slice_time(z, tr_slices, slice_order))/tr
+
+    where z is the transformed slice coordinate, or last_slice-z if
+    reversed is True. T is computed on the fly rather than stored,
+    and consecutive frames with the same transformation share the
+    spatial interpolation weights. 
+    """
+    cdef ndarray Ca, Ta, ta, Sa, R
+    cdef cubic_spline_slice_timing timing
+    Ca = _cspline_coef(C)
+    Ta = np.ascontiguousarray(Tvox, dtype='double')
+    ta = np.ascontiguousarray(times, dtype='double')
+    Sa = np.ascontiguousarray(slice_order, dtype='double')
+    if Ca.ndim != 4 or len(dims) != 3: 
+        raise ValueError('4d coefficients and 3d grids expected')
+    if Ta.shape != (ta.size, 4, 4):
+        raise ValueError('one 4x4 transformation per frame expected')
+    if Sa.size == 0: 
+        raise ValueError('empty slice order')
+    timing.start = start
+    timing.tr = tr
+    timing.tr_slices = tr_slices
+    timing.slice_order = <double*>Sa.data
+    timing.nslices = Sa.size
+    timing.reversed = int(reversed)
+    timing.last_slice = last_slice
+    R = np.zeros((ta.size,)+tuple(dims))
+    cubic_spline_resample4d_slices(R, Ca, <double*>Ta.data, <double*>ta.data, &timing, 
+                                   shift, int(bounded), nthreads)
+    return R
+
+
+def threads_count(int nthreads=0):
+    """
+    n = threads_count(nthreads=0)
+
+    Number of threads actually used by the routines of this module
+    for a given nthreads argument: the number of available processors
+    if nthreads<=0, 1 if the module was built without thread support.
+    """
+    return fff_threads_count(nthreads)
+
+
 def cspline_resample(ndarray im, dims, ndarray Tvox, dtype=None):
     """
     cspline_resample(im, dims, Tvox, dtype=None)
@@ -356,6 +759,27 @@ def cspline_resample(ndarray im, dims, ndarray Tvox, dtype=None):
 
 
 
+def cspline_reduce(ndarray im, axes=None):
+    """
+    cspline_reduce(im, axes=None)
+
+    Smooth an image with the cubic B-spline dilated by two and
+    decimate it by two along the given axes (all axes if None). The
+    output has size (n+1)/2 along reduced axes, its sample m
+    corresponding to input sample 2m.
+    """
+    if axes == None: 
+        axes = range(im.ndim)
+    dims = [d for d in im.shape]
+    for axis in axes: 
+        dims[axis] = (dims[axis]+1)//2
+    src = np.ascontiguousarray(im, dtype='double')
+    res = np.zeros(dims)
+    cubic_spline_reduce(res, src)
+    return res
+
+
+
 def slice_time(Z, double tr_slices, slice_order):
     """
     Fast routine to compute the time when a slice is acquired given its index
@@ -1,4 +1,5 @@
 #!/usr/bin/env python
+import os
 
 def configuration(parent_package='',top_path=None):
     
@@ -12,13 +13,24 @@ def configuration(parent_package='',top_path=None):
         # instead.  NOTE: scipy.linalg uses lapack_opt, not 'lapack'...
         lapack_info = get_info('lapack',0)
 
+    # Multi-threaded routines in libcstat rely on POSIX threads 
+    libraries = ['cstat']
+    if os.name == 'posix':
+        libraries.append('pthread')
+
     config = Configuration('register', parent_package, top_path)
     config.add_data_dir('tests')
     config.add_data_dir('benchmarks')
     config.add_extension(
                 'routines',
-                sources=['routines.c', 'iconic.c', 'cubic_spline.c'],
-                libraries = ['cstat'],
+                sources=['routines.pyx', 'iconic.c', 'cubic_spline.c'],
+                libraries = libraries,
+                extra_info=lapack_info,
+                )
+    config.add_extension(
+                '_transform_affine',
+                sources=['_transform_affine.pyx'],
+                libraries = libraries,
                 extra_info=lapack_info,
                 )
 
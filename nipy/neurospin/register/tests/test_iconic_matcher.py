@@ -4,6 +4,9 @@ from nipy.testing import assert_equal, assert_almost_equal, assert_raises
 import numpy as np
 
 from nipy.neurospin.register.iconic_matcher import IconicMatcher
+from nipy.neurospin.register.routines import _joint_histogram, cspline_reduce
+from nipy.neurospin.register.routines import cspline_transform, cspline_sample3d, cspline_sample4d
+from nipy.neurospin.register.routines import cspline_resample3d, cspline_resample4d, cspline_resample4d_frames
 
 
 class Image(object):
@@ -80,6 +83,162 @@ def test_correlation_ratio():
 def test_normalized_mutual_information():
     _test_similarity_measure('nmi', 1.0) 
 
+def _test_joint_histogram_threads(interp):
+    I = Image(make_data_int16())
+    J = Image(make_data_int16())
+    IM = IconicMatcher(I.array, J.array, I.toworld, J.toworld)
+    IM.set_field_of_view(subsampling=[2,1,3])
+    IM.set_interpolation(interp, seed=12)
+    T = np.eye(4)
+    T[0:3,3] = np.random.rand(3)
+    IM.eval(T)
+    H = IM.joint_hist.copy()
+    for nthreads in [2, 3, 0]:
+        IM.nthreads = nthreads
+        IM.eval(T)
+        assert_equal(H, IM.joint_hist)
+
+def test_joint_histogram_threads_pv():
+    _test_joint_histogram_threads('pv')
+
+def test_joint_histogram_threads_tri():
+    _test_joint_histogram_threads('tri')
+
+def test_joint_histogram_threads_rand():
+    _test_joint_histogram_threads('rand')
+
+def _test_joint_histogram_points(interp):
+    I = Image(make_data_int16())
+    J = Image(make_data_int16())
+    IM = IconicMatcher(I.array, J.array, I.toworld, J.toworld)
+    IM.set_field_of_view(subsampling=[2,1,3])
+    IM.set_interpolation(interp, seed=12)
+    T = np.eye(4)
+    T[0:3,3] = np.random.rand(3)
+    IM.eval(T)
+    H = np.zeros(IM.joint_hist.shape)
+    _joint_histogram(H, IM.source_block.flat, IM.target_clamped, 
+                     IM.block_voxel_transform(T), IM._interp_code())
+    assert_equal(H, IM.joint_hist)
+
+def test_joint_histogram_points_pv():
+    _test_joint_histogram_points('pv')
+
+def test_joint_histogram_points_tri():
+    _test_joint_histogram_points('tri')
+
+def test_joint_histogram_points_rand():
+    _test_joint_histogram_points('rand')
+
+def _test_similarity_gradient(simi):
+    I = Image(make_data_int16())
+    J = Image(I.array.copy())
+    IM = IconicMatcher(I.array, J.array, I.toworld, J.toworld, 
+                       source_bins=32, target_bins=32)
+    IM.set_similarity(simi)
+    T = np.eye(4)
+    T[0:3,3] = [.3141, -.2718, .1414]
+    s, grad = IM.eval_gradient(T)
+    assert_almost_equal(s, IM.eval(T))
+    delta = 1e-5
+    for k in range(3):
+        T1 = T.copy(); T1[k,3] += delta
+        T0 = T.copy(); T0[k,3] -= delta
+        g = (IM.eval(T1)-IM.eval(T0))/(2*delta)
+        assert_almost_equal(grad[k,3]/g, 1, 2)
+
+def test_similarity_gradient_cc():
+    _test_similarity_gradient('cc')
+
+def test_similarity_gradient_mi():
+    _test_similarity_gradient('mi')
+
+def test_eval_similarities():
+    I = Image(make_data_int16())
+    J = Image(make_data_int16())
+    IM = IconicMatcher(I.array, J.array, I.toworld, J.toworld)
+    T = np.eye(4)
+    T[0:3,3] = np.random.rand(3)
+    simis = ['cc', 'cr', 'crl1', 'je', 'ce', 'mi', 'nmi']
+    values = IM.eval_similarities(T, simis)
+    for simi in simis: 
+        IM.set_similarity(simi)
+        assert_almost_equal(values[simi], IM.eval(T))
+
+def test_eval_batch():
+    I = Image(make_data_int16())
+    J = Image(make_data_int16())
+    IM = IconicMatcher(I.array, J.array, I.toworld, J.toworld)
+    Ts = [np.eye(4) for k in range(5)]
+    for T in Ts: 
+        T[0:3,3] = np.random.rand(3)
+    simis = IM.eval_batch(Ts, batch_size=2)
+    assert_equal(simis, [IM.eval(T) for T in Ts])
+
+def test_cspline_reduce():
+    x = 3.5*np.ones((9, 8, 3))
+    y = cspline_reduce(x, axes=[0, 1])
+    assert_equal(y.shape, (5, 4, 3))
+    assert_almost_equal(y, 3.5*np.ones((5, 4, 3)))
+
+def test_cspline_transform_threads():
+    x = np.random.rand(12, 11, 10, 5)
+    C = cspline_transform(x)
+    assert_equal(cspline_transform(x, nthreads=3), C)
+    # Cubic spline interpolation at grid points gives back the data
+    t, z, y, k = np.mgrid[0:12, 0:11, 0:10, 0:5]
+    R = np.zeros(x.shape)
+    cspline_sample4d(R, C, t, z, y, k)
+    assert_almost_equal(R, x)
+
+def _affine_grid(Tv, shape):
+    xyz = np.mgrid[0:shape[0], 0:shape[1], 0:shape[2]].reshape(3, -1)
+    XYZ = np.dot(Tv[0:3,0:3], xyz) + Tv[0:3,3:4]
+    return [c.reshape(shape) for c in XYZ]
+
+def test_cspline_resample3d():
+    C = cspline_transform(np.random.rand(12, 11, 10))
+    Tv = np.eye(4)
+    Tv[0:3,0:3] += .05*np.random.rand(3,3)
+    Tv[0:3,3] = [-1.3, .7, 2.1]
+    X, Y, Z = _affine_grid(Tv, (10, 12, 9))
+    R = np.zeros((10, 12, 9))
+    cspline_sample3d(R, C, X, Y, Z)
+    assert_almost_equal(cspline_resample3d(C, (10, 12, 9), Tv), R)
+    assert_almost_equal(cspline_resample3d(C.astype('float32'), (10, 12, 9), Tv), R, 5)
+
+def test_cspline_resample4d():
+    C = cspline_transform(np.random.rand(12, 11, 10, 5))
+    Tv = np.eye(4)
+    Tv[0:3,0:3] += .05*np.random.rand(3,3)
+    Tv[0:3,3] = [-1.3, .7, 2.1]
+    X, Y, Z = _affine_grid(Tv, (10, 12, 9))
+    T = 2 + .1*Z
+    R = np.zeros((10, 12, 9))
+    cspline_sample4d(R, C, X, Y, Z, T)
+    assert_almost_equal(cspline_resample4d(C, Tv, T), R)
+
+def test_cspline_resample4d_frames():
+    C = cspline_transform(np.random.rand(12, 11, 10, 5))
+    Tv = np.array([np.eye(4) for k in range(3)])
+    Tv[:,0:3,0:3] += .05*np.random.rand(3,3,3)
+    Tv[:,0:3,3] = [-1.3, .7, 2.1]
+    T = 1 + 2*np.random.rand(3, 10, 12, 9)
+    R = cspline_resample4d_frames(C, Tv, T, nthreads=2)
+    for k in range(3): 
+        assert_equal(R[k], cspline_resample4d(C, Tv[k], T[k]))
+
+def test_pyramid():
+    I = Image(make_data_int16())
+    J = Image(make_data_int16())
+    IM = IconicMatcher(I.array, J.array, I.toworld, J.toworld)
+    levels = IM.pyramid(3)
+    assert_equal(len(levels), 3)
+    assert levels[-1] is IM
+    assert_equal(levels[0].source.shape, (25, 25, 25))
+    assert_equal(levels[0].source_toworld, np.diag([4, 4, 2, 1]))
+    assert levels[1] is IM.pyramid(2)[0]
+
 def test_explore(): 
     I = Image(make_data_int16())
     J = Image(make_data_int16())
@@ -0,0 +1,65 @@
+#!/usr/bin/env python
+
+from nipy.testing import assert_equal, assert_almost_equal
+import numpy as np
+
+from nipy.neurospin.register.realign4d import Image4d, Realign4d, SplineWindow
+from nipy.neurospin.register.routines import cspline_transform, \
+    cspline_resample4d_frames, cspline_resample4d_slices
+
+
+def make_im4d(nscans):
+    array = np.random.rand(7, 6, 5, nscans)
+    return Image4d(array, np.eye(4), tr=2.0)
+
+def test_spline_window():
+    x = np.random.rand(4, 3, 5, 50)
+    C = cspline_transform(x)
+    W = SplineWindow(x, block=4, margin=16)
+    Cw, offset = W.get(20.5, 22)
+    assert_equal(offset, 18)
+    assert_almost_equal(Cw, C[:,:,:,offset:offset+Cw.shape[3]], 8)
+    # Margins covering the whole run
+    W = SplineWindow(x[:,:,:,0:10])
+    Cw, offset = W.get(3, 4)
+    C = cspline_transform(x[:,:,:,0:10])
+    assert_equal(Cw, C[:,:,:,offset:offset+Cw.shape[3]])
+
+def test_resample_streaming():
+    im4d = make_im4d(40)
+    R = Realign4d(im4d, speedup=2)
+    Rs = Realign4d(im4d, speedup=2, streaming=True)
+    assert_almost_equal(Rs.resample(), R.resample(), 8)
+    Rs.resample_all_inmask()
+    R.resample_all_inmask()
+    assert_almost_equal(Rs.data, R.data, 8)
+
+def test_resample_streaming_short_run():
+    im4d = make_im4d(10)
+    R = Realign4d(im4d)
+    Rs = Realign4d(im4d, streaming=True)
+    out = np.zeros(im4d.array.shape)
+    Rs.resample(out=out)
+    assert_equal(out, R.resample())
+
+def test_resample4d_slices():
+    im4d = Image4d(np.random.rand(7, 6, 5, 12), np.diag([1, 1, -1, 1]), tr=2.0, 
+                   slice_order='ascending', interleaved=True)
+    C = cspline_transform(im4d.array)
+    Tv = np.array([np.eye(4) for k in range(4)])
+    Tv[2:,0:3,3] = [.3, -.2, .4]
+    Tv[2:,2,0] = .01
+    times = im4d.tr*np.arange(3, 7)
+    x, y, z = np.ogrid[0:7, 0:6, 0:5]
+    A = Tv[:,2,:,np.newaxis,np.newaxis,np.newaxis]
+    Z = A[:,0]*x + A[:,1]*y + A[:,2]*z + A[:,3]
+    T = im4d.from_time(Z, times[:,np.newaxis,np.newaxis,np.newaxis])
+    R = cspline_resample4d_slices(C, Tv, times, (7, 6, 5), im4d.start, im4d.tr, 
+                                  im4d.tr_slices, im4d.slice_order, reversed=True, 
+                                  last_slice=4, shift=1, nthreads=2)
+    assert_almost_equal(R, cspline_resample4d_frames(C, Tv, T-1), 12)
+
+
+if __name__ == "__main__":
+        import nose
+        nose.run(argv=['', __file__])
@@ -0,0 +1,34 @@
+#!/usr/bin/env python
+
+from nipy.testing import assert_almost_equal
+import numpy as np
+
+from nipy.neurospin.register.routines import _texture, texture_measures
+
+
+def _local_values(im, x, y, z, size):
+    h = [s/2 for s in size]
+    block = im[max(x-h[0],0):x+h[0]+1, max(y-h[1],0):y+h[1]+1, max(z-h[2],0):z+h[2]+1]
+    return block[block>=0]
+
+def test_sliding_texture():
+    im = np.random.randint(-1, 16, size=(9, 8, 11)).astype('short')
+    size = [5, 3, 7]
+    H = np.zeros(16)
+    mean = _texture(im, H, size, texture_measures['mean'])
+    var = _texture(im, H, size, texture_measures['variance'])
+    ent = _texture(im, H, size, texture_measures['entropy'])
+    maxi = _texture(im, H, size, texture_measures['max'])
+    for x, y, z in [(0, 0, 0), (4, 3, 5), (8, 7, 10), (2, 7, 1)]:
+        v = _local_values(im, x, y, z, size)
+        p = np.bincount(v)/float(v.size)
+        p = p[p>0]
+        assert_almost_equal(mean[x,y,z], v.mean())
+        assert_almost_equal(var[x,y,z], v.var())
+        assert_almost_equal(ent[x,y,z], -np.sum(p*np.log(p)))
+        assert_almost_equal(maxi[x,y,z], v.max())
+
+
+if __name__ == "__main__":
+        import nose
+        nose.run(argv=['', __file__])
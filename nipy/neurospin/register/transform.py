@@ -152,6 +152,28 @@ class Affine(object):
         param = self.vec12/self.precond
         return param[_affines[self._subtype]]
         
+    def param_jacobian(self, delta=1e-6): 
+        """
+        Derivatives of the 4x4 matrix with respect to the parameters
+        returned by to_param, as a (nparams,4,4) array. Computed by
+        central differences, which is accurate since the matrix is a
+        smooth closed-form function of the parameters.
+        """
+        p0 = self.to_param()
+        vec12 = self.vec12.copy()
+        J = np.zeros((p0.size, 4, 4))
+        for k in range(p0.size): 
+            dp = np.zeros(p0.size)
+            dp[k] = delta
+            self.from_param(p0+dp)
+            M1 = self.__array__()
+            self.set_vec12(vec12.copy())
+            self.from_param(p0-dp)
+            M0 = self.__array__()
+            self.set_vec12(vec12.copy())
+            J[k] = (M1-M0)/(2*delta)
+        return J
+
     def set_vec12(self, vec12): 
         # Specify dtype to allow in-place operations
         self.vec12 = np.asarray(vec12, dtype='double') 
@@ -71,10 +71,16 @@ def configuration(parent_package='',top_path=None):
     print('lapack_info: %s ' % lapack_info)
 
 
+    # Instrumentation counters, see fff_base.h
+    macros = []
+    if os.environ.get('NIPY_PROFILE'):
+        macros.append(('FFF_PROFILE', None))
+
     config.add_library('cstat',
                        sources=sources,
                        library_dirs=library_dirs,
                        libraries=libraries,
+                       macros=macros,
                        extra_info=lapack_info)
 
     # Subpackages
@@ -1,9 +1,10 @@
 import numpy as np
 import scipy.stats as sp_stats
 
-from nipy.neurospin.graph.field import Field
+from nipy.neurospin.graph.field import Field, threshold_clusters
 from nipy.neurospin.register.transform import apply_affine
 from nipy.neurospin.utils import emp_null
+from nipy.neurospin.utils.image_source import ImageSource
 from nipy.neurospin.glm import glm
 from nipy.neurospin.group.permutation_test import \
      permutation_test_onesample, permutation_test_twosample
@@ -72,11 +73,13 @@ def cluster_stats(zimg, mask, height_th, height_control='fpr',
     ff = Field(np.size(zmap_th), field=zmap_th)
     ff.from_3d_grid(xyz_th, k=18)
     maxima, depth = ff.get_local_maxima(th=zth)
-    labels = ff.cc()
+    _, sizes, _, _, labels = threshold_clusters(xyz_th, zmap_th,
+                                                np.array([zth]), 18)
+    labels = labels[:, 0]
     ## Make list of clusters, each cluster being a dictionary 
     clusters = []
-    for k in range(labels.max() + 1):
-        s = np.sum(labels == k)
+    for k in range(sizes.size):
+        s = sizes[k]
         if s >= cluster_th:
             in_cluster = labels[maxima] == k
             m = maxima[in_cluster]
@@ -140,6 +143,44 @@ def cluster_stats(zimg, mask, height_th, height_control='fpr',
     return clusters, info 
 
 
+def multi_threshold_clusters(zimg, mask, thresholds, k=18):
+    """
+    Supra-threshold clusters of a z-map for several cluster forming
+    thresholds, found in a single sweep of the voxels.
+
+    Parameters
+    ----------
+    zimg: z-score image
+    mask: mask image
+    thresholds: sequence of z thresholds, in any order
+    k: grid connectivity, 6, 18 or 26
+
+    Returns a list with, for each threshold, the list of its clusters
+    sorted by descending size order, each cluster being a dictionary
+    with keys 'size', 'mass' (sum of the z-scores minus the threshold),
+    'zmax' and 'peak' (coordinates of the maximum).
+    """
+    xyz = np.where(mask.get_data().squeeze()>0)
+    zmap = zimg.get_data().squeeze()[xyz]
+    xyz = np.array(xyz).T
+    thresholds = np.asarray(thresholds, dtype='double').ravel()
+    clusters = [[] for th in thresholds]
+    if thresholds.size == 0 or zmap.size == 0:
+        return clusters
+    idx, sizes, masses, peaks, _ = threshold_clusters(xyz, zmap,
+                                                      thresholds, k)
+    if idx.size == 0:
+        return clusters
+    coords = apply_affine(zimg.get_affine(), xyz[peaks].T).T
+    for c in range(idx.size):
+        clusters[idx[c]].append({'size': sizes[c], 'mass': masses[c],
+                                 'zmax': zmap[peaks[c]],
+                                 'peak': coords[c]})
+    for cl in clusters:
+        cl.sort(key=lambda c: -c['size'])
+    return clusters
+
+
 ################################################################################
 # Statistical tests
 ################################################################################
@@ -160,14 +201,13 @@ def prepare_arrays(data_images, vardata_images, mask_images):
     mask = mask_intersection([mask.get_data() for mask in mask_images])
     # Compute xyz coordinates from mask 
     xyz = np.array(np.where(mask>0))
-    # Prepare data & vardata arrays 
-    data = np.array([d.get_data()[xyz[0], xyz[1], xyz[2]]
-                    for d in data_images]).squeeze()
+    # Prepare data & vardata arrays: images are memory-mapped, and
+    # only the voxels of the mask are read
+    data = ImageSource(data_images).read(mask).squeeze()
     if vardata_images == None: 
         vardata = None
     else: 
-        vardata = np.array([d.get_data()[xyz[0], xyz[1], xyz[2]] 
-                           for d in vardata_images]).squeeze()
+        vardata = ImageSource(vardata_images).read(mask).squeeze()
     return data, vardata, xyz, mask 
 
 
@@ -374,6 +414,33 @@ class LinearModel(object):
         
         return con_img, vcon_img, z_img, dof
 
+    def contrasts(self, vectors, nthreads=1):
+        """
+        Images of the t or F statistics of several contrasts. With a
+        single model, all the statistics are computed in one pass
+        over the voxels, see glm.contrasts; otherwise, the contrasts
+        are summed across models as in contrast. 
+        """
+        if len(self.glm) == 1: 
+            stats = self.glm[0].contrasts(vectors, nthreads=nthreads)
+        else: 
+            stats = []
+            for vector in vectors: 
+                c = self.glm[0].contrast(vector)
+                for g in self.glm[1:]: 
+                    c += g.contrast(vector)
+                stats.append(c.stat())
+
+        imgs = []
+        for stat in stats: 
+            if self.xyz == None: 
+                data = stat
+            else: 
+                data = np.zeros(self.spatial_shape)
+                data[self.xyz] = stat
+            imgs.append(Image(data, self.affine))
+        return imgs
+
 
 
 
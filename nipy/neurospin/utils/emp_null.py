@@ -7,9 +7,10 @@ data behaves as a standard normal under H_0.
 Author : Bertrand Thirion, 2008-2009
 """
 import numpy as np
-from numpy.linalg import pinv
 import scipy.stats as st
 
+from nipy.neurospin.utils.routines import fdr_threshold, emp_null_fit
+
 class FDR(object):
     """
     This is the basic class to handle false discovery rate computation
@@ -64,11 +65,9 @@ class FDR(object):
         n = np.size(pv)
         isx = np.argsort(pv)
         q = np.zeros(n)
-        for ip in range(n):
-            q[isx[ip]] = np.minimum(1, 
-                                np.maximum(n*pv[isx[ip]]/(ip+1), q[isx[ip]]))
-            if (ip<n-1):
-                q[isx[ip+1]] = q[isx[ip]]
+        # running maximum of n*p/rank in ascending p-value order 
+        q[isx] = np.minimum(1, np.maximum.accumulate(
+                n*pv[isx]/np.arange(1, n+1)))
         
         if verbose:
             import matplotlib.pylab as mp
@@ -117,16 +116,7 @@ class FDR(object):
             The p value corresponding to the FDR alpha
         """
         pv = self.check_pv(pv)
-        
-        npv = np.size(pv)
-        pcorr = alpha/npv
-        spv = np.sort(pv)
-        ip = 0
-        pth = 0.
-        while (spv[ip]<pcorr*(ip+1))&(ip<npv):
-            pth = spv[ip]
-            ip = ip+1
-        return pth
+        return float(fdr_threshold(np.ravel(pv), alpha))
 
     def threshold_from_student(self, df, alpha=0.05, x=None):
         """
@@ -223,35 +213,13 @@ class ENN(object):
          * sigma = np.sqrt(sqsigma) : variance of the estimated
            normal distribution
         """
-        # take a central subsample of x
-        x = self.x[int(self.n*left):int(self.n*right)]
-    
-        # generate the histogram
-        step = 3.5*np.std(self.x)/np.exp(np.log(self.n)/3)
-        bins = max(10, (self.x.max() - self.x.min())/step)
-        hist, ledge = np.histogram(x, bins=bins)
-        step = ledge[1]-ledge[0]
-        medge = ledge + 0.5*step
-    
-        # remove null bins
-        whist = hist>0
-        hist = hist[whist]
-        medge = medge[whist]
-        hist = hist.astype('f')
-
-        # fit the histogram
-        DMtx = np.ones((3, np.sum(whist)))
-        DMtx[1] = medge
-        DMtx[2] = medge**2
-        coef = np.dot(np.log(hist), pinv(DMtx))
-        sqsigma = -1.0/(2*coef[2])
-        mu = coef[1]*sqsigma
-        lp0 = (coef[0]- np.log(step*self.n) 
-                + 0.5*np.log(2*np.pi*sqsigma) + mu**2/(2*sqsigma))
-        self.mu = mu
-        self.p0 = min(1, np.exp(lp0))
-        self.sigma = np.sqrt(sqsigma)
-        self.sqsigma = sqsigma
+        # fit the histogram of the central subsample of x, with bins
+        # of width 3.5*std(x)/n**(1/3) (see emp_null_fit)
+        mu, sigma, p0 = emp_null_fit(self.x, left, right)
+        self.mu = float(mu)
+        self.p0 = float(p0)
+        self.sigma = float(sigma)
+        self.sqsigma = self.sigma**2
 
     def fdrcurve(self):
         """
@@ -382,6 +350,52 @@ class ENN(object):
     
 
  
+def fdr_thresholds(pvals, alpha=0.05, nthreads=1):
+    """
+    Benjamini-Hochberg thresholds of several p-value maps
+
+    Parameters
+    -----------
+    pvals : ndarray of shape (nmaps, n)
+        The p-values, one map per row
+    alpha : float, optional
+        The desired FDR significance
+    nthreads : int, optional
+        The number of threads, all the processors if zero or negative
+
+    Returns
+    -------
+    pth : ndarray of shape (nmaps)
+        The critical p-value of each map, see FDR.pth_from_pvals
+    """
+    return fdr_threshold(pvals, alpha, nthreads)
+
+
+def empirical_nulls(maps, left=0.2, right=0.8, nthreads=1):
+    """
+    Empirical null normal fits of several maps
+
+    Parameters
+    -----------
+    maps : ndarray of shape (nmaps, n)
+        The data, one map per row
+    left : float, optional
+        Left cut parameter, see ENN.learn
+    right : float, optional
+        Right cut parameter, see ENN.learn
+    nthreads : int, optional
+        The number of threads, all the processors if zero or negative
+
+    Returns
+    -------
+    mu, sigma, p0 : ndarrays of shape (nmaps)
+        The mean, standard deviation and proportion of the empirical
+        null of each map, as the attributes of ENN after learn; NaNs
+        where the fit fails
+    """
+    return emp_null_fit(maps, left, right, nthreads)
+
+
 def three_classes_GMM_fit(x, test=None, alpha=0.01, prior_strength=100,
                           verbose=0, fixed_scale=False, mpaxes=None, bias=0, 
                           theta=0, return_estimator=False):
@@ -0,0 +1,177 @@
+"""
+Lazy access to stacks of images stored on disk.
+
+An `ImageSource` holds the raw data of each image as a memory map of
+its NIfTI or Analyze file, so that opening a large group of images
+loads nothing. The image scaling (scl_slope and scl_inter) is only
+applied to the voxels that are actually read, and masked voxels are
+read by blocks in the order in which they are stored on disk, so that
+each block only touches a few slabs of each file.
+
+Author: Alexis Roche, 2009.
+"""
+
+import numpy as np
+
+from nipy.io.imageformats import load
+
+# Default number of voxels per block
+BLOCK_SIZE = 4096
+
+
+def _raw_data(img):
+    """
+    Unscaled data of an image, as a memory map when the image is
+    stored on disk, and the corresponding slope and intercept (None
+    if no scaling applies).
+    """
+    if isinstance(img, np.ndarray):
+        return img, None, None
+    raw = None
+    if hasattr(img, 'get_unscaled_data'):
+        raw = img.get_unscaled_data()
+    if raw is None:
+        return np.asarray(img.get_data()), None, None
+    slope, inter = img.get_header().get_slope_inter()
+    # Same rules as nipy.io.imageformats.header_ufuncs.read_data
+    if not slope:
+        return raw, None, None
+    return raw, slope, inter
+
+
+class ImageSource(object):
+    """
+    Memory-mapped stack of volumes with the same spatial shape.
+
+    Parameters
+    ----------
+    images : sequence of images, filenames or arrays
+        3D or 4D images; each volume of a 4D image is a separate item
+        of the stack, in the same order as in the image.
+    """
+
+    def __init__(self, images):
+        self._raw = []
+        self._scale = []
+        self.shape = None
+        self.affine = None
+        for img in images:
+            if isinstance(img, basestring):
+                img = load(img)
+            raw, slope, inter = _raw_data(img)
+            shape = raw.shape[0:3]
+            if self.shape == None:
+                self.shape = shape
+                if hasattr(img, 'get_affine'):
+                    self.affine = img.get_affine()
+            elif not shape == self.shape:
+                raise ValueError('Images must have the same spatial shape')
+            # Volumes are views of the raw data
+            if raw.ndim > 4:
+                raw = raw.reshape(shape + (-1,), order='F')
+            if raw.ndim < 4:
+                vols = [raw]
+            else:
+                vols = [raw[:, :, :, t] for t in range(raw.shape[3])]
+            for vol in vols:
+                self._raw.append(vol)
+                self._scale.append((slope, inter))
+
+    def __len__(self):
+        return len(self._raw)
+
+    def raw(self, i):
+        """
+        Unscaled data of the i-th volume, without copy: for an image
+        stored on disk, this is a read-only memory map which may be
+        passed as is to the fff routines.
+        """
+        return self._raw[i]
+
+    def get_slope_inter(self, i):
+        """
+        Scaling of the i-th volume, (None, None) if there is none.
+        """
+        return self._scale[i]
+
+    def _scaled(self, i, values):
+        slope, inter = self._scale[i]
+        values = np.array(values, dtype='double')
+        if slope == None:
+            return values
+        if slope != 1.0:
+            values *= slope
+        if inter:
+            values += inter
+        return values
+
+    def volume(self, i, scaled=True):
+        """
+        Data of the i-th volume, as a 3D array of doubles. If
+        `scaled` is False, the image scaling is not applied.
+        """
+        if not scaled:
+            return np.array(self._raw[i], dtype='double').reshape(self.shape)
+        return self._scaled(i, self._raw[i]).reshape(self.shape)
+
+    def mean(self, scaled=True):
+        """
+        Mean volume, accumulated one volume at a time so that only a
+        couple of volumes are held in memory.
+        """
+        mean = np.zeros(self.shape)
+        for i in range(len(self)):
+            mean += self.volume(i, scaled=scaled)
+        if len(self) > 0:
+            mean /= float(len(self))
+        return mean
+
+    def mask_indices(self, mask):
+        """
+        Indices of the voxels of a mask in disk order, i.e. in the
+        order in which the blocks are read.
+        """
+        mask = np.asarray(mask).reshape(self.shape)
+        return np.where(mask.ravel(order='F') > 0)[0]
+
+    def mask_coordinates(self, mask):
+        """
+        Voxel coordinates (3, nvox) corresponding to `mask_indices`.
+        """
+        idx = self.mask_indices(mask)
+        nx, ny = self.shape[0], self.shape[1]
+        return np.array([idx % nx, (idx / nx) % ny, idx / (nx*ny)])
+
+    def blocks(self, mask, block_size=BLOCK_SIZE):
+        """
+        Iterate over the voxels of a mask by blocks.
+
+        Yields (sl, Y) pairs where Y is a (number of volumes, number of
+        voxels in the block) array of doubles, and sl is the slice of
+        the block in the voxels returned by `mask_coordinates`.
+        """
+        x, y, z = self.mask_coordinates(mask)
+        nvox = x.size
+        for start in range(0, nvox, block_size):
+            sl = slice(start, min(start+block_size, nvox))
+            Y = np.zeros((len(self), sl.stop-sl.start))
+            for i in range(len(self)):
+                vol = self._raw[i].reshape(self.shape)
+                Y[i] = self._scaled(i, vol[x[sl], y[sl], z[sl]])
+            yield sl, Y
+
+    def read(self, mask, block_size=BLOCK_SIZE):
+        """
+        Scaled values of the voxels of a mask, as a (number of volumes,
+        number of voxels) array of doubles, the voxels being ordered
+        as in np.where(mask>0). They are read by blocks, and only the
+        masked voxels are loaded in memory.
+        """
+        idx = self.mask_indices(mask)
+        Y = np.zeros((len(self), idx.size))
+        for sl, Yb in self.blocks(mask, block_size=block_size):
+            Y[:, sl] = Yb
+        # Disk order to np.where order
+        nx, ny = self.shape[0], self.shape[1]
+        x, y, z = np.where(np.asarray(mask).reshape(self.shape) > 0)
+        return Y[:, np.searchsorted(idx, x + nx*(y + ny*z))]
@@ -7,6 +7,7 @@ import numpy as np
 
 # Neuroimaging libraries imports
 from nipy.io.imageformats import load, nifti1, save, AnalyzeImage
+from nipy.neurospin.utils.image_source import ImageSource
 
 import nipy.neurospin.graph as fg
 
@@ -27,11 +28,9 @@ def _largest_cc(mask):
     # We use asarray to be able to work with masked arrays.
     mask = np.asarray(mask)
     xyz = np.array(np.where(mask))
-    nbvox = mask.sum()
-    g = fg.WeightedGraph(nbvox)
-    g.from_3d_grid(xyz.T)
-    u = g.main_cc()
-    xyz = xyz[:,u]
+    # label the 18-connectivity graph without building its edges
+    label = fg.graph_3d_grid_cc(xyz.T, 18)
+    xyz = xyz[:,label==np.argmax(np.bincount(label))]
     
     mask_cc = np.zeros(mask.shape, np.int8)
     mask_cc[tuple(xyz)] = 1
@@ -111,42 +110,33 @@ def compute_mask_files(input_filename, output_filename=None,
         The main of all the images used to estimate the mask. Only
         provided if `return_mean` is True.
     """
+    # The images are memory-mapped, and the mean is accumulated one
+    # volume at a time, to avoid loading all the data in the memory
     if isinstance(input_filename, basestring):
         # One single filename
-        nim, vol_arr = get_unscaled_img(input_filename)
-        header = nim.get_header()
-        affine = nim.get_affine()
-        # Make a copy, to avoid holding a reference on the full array,
-        # and thus polluting the memory.
-        if vol_arr.ndim == 4:
-            mean_volume = vol_arr.mean(axis=-1)
-            first_volume = vol_arr[:,:,:,0].copy()
-        elif vol_arr.ndim == 3:
-            mean_volume = first_volume = vol_arr
-        else:
+        nim = load(input_filename)
+        if not len(nim.get_shape()) in (3, 4):
             raise ValueError('Need 4D file for mask')
-        del vol_arr
+        # Integer Analyze-type data are not scaled, see get_unscaled_img
+        scaled = not (isinstance(nim, AnalyzeImage) and 
+                      nim.get_data_dtype().kind in ('i', 'u'))
+        source = ImageSource([nim])
     else:
         # List of filenames
         if len(input_filename) == 0:
             raise ValueError('input_filename should be a non-empty '
                 'list of file names')
-        # We have several images, we do mean on the fly, 
-        # to avoid loading all the data in the memory
         # We do not use the unscaled data here?:
         # if the scalefactor is being used to record real
         # differences in intensity over the run this would break
-        for index, filename in enumerate(input_filename):
-            nim = load(filename)
-            if index == 0:
-                first_volume = nim.get_data().squeeze()
-                mean_volume = first_volume.copy().astype(np.float32)
-                header = nim.get_header()
-                affine = nim.get_affine()
-            else:
-                mean_volume += nim.get_data().squeeze()
-        mean_volume /= float(len(input_filename))
-    del nim
+        scaled = True
+        nim = load(input_filename[0])
+        source = ImageSource([nim] + list(input_filename[1:]))
+    header = nim.get_header()
+    affine = nim.get_affine()
+    first_volume = source.volume(0, scaled=scaled)
+    mean_volume = source.mean(scaled=scaled)
+    del source, nim
 
     mask = compute_mask(mean_volume, first_volume, m, M, cc)
       
@@ -247,15 +237,16 @@ def compute_mask_sessions(session_files, m=0.2, M=0.9, cc=1, threshold=0.5):
     mask : 3D boolean ndarray 
         The brain mask
     """
+    # One mask at a time is held in memory; the counts are int32 so
+    # that any number of sessions may be combined
     mask = None
     for session in session_files:
         this_mask = compute_mask_files(session,
                                        m=m, M=M,
-                                       cc=cc).astype(np.int8)
+                                       cc=cc)
         if mask is None:
-            mask = this_mask
-        else:
-            mask += this_mask
+            mask = np.zeros(this_mask.shape, np.int32)
+        mask += this_mask
         # Free memory early
         del this_mask
         
@@ -299,20 +290,19 @@ def intersect_masks(input_mask_files, output_filename=None,
     -------
     gmask, boolean array of shape the image shape
     """  
-    gmask = None 
-
-    for filename in input_mask_files:
-        nim = load(filename)
-        if gmask is None:
-            gmask = nim.get_data().copy() # !!!
-        else:
-            gmask += nim.get_data()  
+    # The masks are memory-mapped and summed one at a time
+    source = ImageSource(input_mask_files)
+    gmask = np.zeros(source.shape)
+    for i in range(len(source)):
+        gmask += source.volume(i)
+    del source
     
     gmask = gmask>(threshold*len(input_mask_files))
     if np.any(gmask>0) and cc:
         gmask = _largest_cc(gmask)
     
     if output_filename is not None:
+        nim = load(input_mask_files[-1])
         header = nim.get_header()
         header['descrip'] = 'mask image'
         output_image = nifti1.Nifti1Image(gmask.astype(np.uint8),
@@ -137,6 +137,32 @@ def get_cluster_position_from_thresholded_map(smap, ijk, coord, thr=3.0,
 
 
 
+def cluster_positions(label, coord):
+    """
+    return the barycenters of the clusters of a label map
+
+    Parameters
+    ----------
+    label: array of shape (nbvox): cluster labels in [0..k-1],
+           -1 outside the clusters
+    coord: array of shape (nbvox,anat_dim) physical ccordinates
+
+    Returns
+    -------
+    positions array of shape(k,anat_dim):
+              the cluster positions in physical coordinates
+              if there is no cluster, None is returned
+    """
+    k = label.max()+1
+    if k==0:
+        return None
+    size = np.bincount(label[label>-1])
+    coord = np.reshape(coord,(np.size(label),-1))
+    baryc = np.array([np.bincount(label[label>-1], coord[label>-1, j])
+                      for j in range(coord.shape[1])]).T
+    return baryc/np.reshape(size,(k,1))
+
+
 # ---------------------------------------------------------
 # ----- data splitting functions ------------------------
 # ---------------------------------------------------------
@@ -232,6 +258,49 @@ def mfx_ttest(x, vx):
     t = fos.stat_mfx(x.T,vx.T,id='student_mfx',axis=0)
     return np.squeeze(t)
 
+def subgroup_clusters(data, vardata, xyz, samples, method='crfx',
+                      swap=False, threshold=3.0, csize=10, nthreads=1):
+    """
+    compute the clusters of the statistical maps of several subgroups
+    
+    Parameters
+    ----------
+    data: array of shape (nvox,nsubj): effect matrix
+    vardata: array of the same size: variance matrix
+    xyz array of shape (nvox,3): the grid ccordinates of the voxels
+    samples: list of ngroups equally-sized arrays of subject indexes,
+             see draw_samples
+    method='crfx', string to be chosen among 'crfx', 'cmfx', 'cffx' 
+           inference method under study
+    swap=False: if True, the signs of the subjects of each subgroup
+                are randomly swapped
+    threshold=3.0 (float): cluster-forming threshold
+    csize=10 (int): cluster size threshold, in 18-connectivity
+    nthreads=1 (int): number of threads the subgroups are split across
+
+    Returns
+    -------
+    label: array of shape (ngroups,nvox):
+           the cluster labels of each subgroup, -1 outside the clusters
+    rmap: array of shape(nvox): the number of subgroups
+          in which each voxel is clustered
+    
+    Note
+    ----
+    The statistics are those of ttest, fttest and mfx_ttest,
+    the subgroups being processed together by a C routine
+    """
+    import nipy.neurospin.group.onesample as fos
+    if not fos.reproducibility_methods.has_key(method):
+        raise ValueError, 'unknown method'
+    samples = np.array(samples)
+    signs = None
+    if swap:
+        signs = 2*(np.random.rand(*samples.shape)>0.5)-1
+    return fos.reproducibility_clusters(data, vardata, xyz, samples,
+                                        threshold, csize, method, signs,
+                                        nthreads=nthreads)
+
 def voxel_thresholded_ttest(x,threshold):
     """returns a binary map of the ttest>threshold
     """
@@ -397,33 +466,9 @@ def map_reproducibility(data, vardata, xyz, ngroups, method='crfx',
           the reproducibility map
     """
     nsubj = data.shape[1]
-    nvox = data.shape[0]
     samples = draw_samples(nsubj, ngroups)
-    rmap = np.zeros(nvox)
-    
-    for i in range(ngroups):
-        x = data[:,samples[i]]
-
-        if swap:
-           # randomly swap the sign of x
-           x *= (2*(np.random.rand(len(samples[i]))>0.5)-1)
-        
-        vx = vardata[:,samples[i]]
-        csize = kwargs['csize']
-        threshold = kwargs['threshold']
-
-        # compute the statistical maps according to the method you like
-        if method=='crfx':
-            smap = ttest(x)
-        elif method=='cffx':
-            smap = fttest(x,vx)
-        elif method=='cmfx':
-            smap = mfx_ttest(x,vx)
-        else: raise ValueError, 'unknown method'
-
-        # add the binarized map to a reproducibility map
-        rmap += cluster_threshold(smap, xyz, threshold, csize)>0
-
+    label, rmap = subgroup_clusters(data, vardata, xyz, samples, method, swap,
+                                    kwargs['threshold'], kwargs['csize'])
     return rmap
 
 
@@ -465,30 +510,21 @@ def cluster_reproducibility(data, vardata, xyz, ngroups, coord, sigma,
     samples = draw_samples(nsubj, ngroups)
     all_pos = []
 
-    # compute the positions in the different subgroups
-    for i in range(ngroups):           
-        x = data[:,samples[i]]
-
-        if swap:
-           # apply a random sign swap to x
-           x *= (2*(np.random.rand(len(samples[i]))>0.5)-1)
-
-        vx = vardata[:,samples[i]]
-        if method!='bsa':
-            csize = kwargs['csize']
-            threshold = kwargs['threshold']
-           
-            if method =='crfx':
-                smap = ttest(x)
-            elif method == 'cmfx':
-                smap = mfx_ttest(x,vx)
-            elif method == 'cffx':
-                smap = fttest(x,vx)
-            pos = get_cluster_position_from_thresholded_map(smap, xyz, coord,
-                                                            threshold, csize)
-            all_pos.append(pos)
-        else: 
-            # method='bsa' is a special case
+    if method!='bsa':
+        label, rmap = subgroup_clusters(data, vardata, xyz, samples, method,
+                                        swap, kwargs['threshold'],
+                                        kwargs['csize'])
+        for i in range(ngroups):
+            all_pos.append(cluster_positions(label[i], coord))
+        
+    # method='bsa' is a special case
+    else:
+        for i in range(ngroups):
+            x = data[:,samples[i]]
+            if swap:
+                # apply a random sign swap to x
+                x *= (2*(np.random.rand(len(samples[i]))>0.5)-1)
+            vx = vardata[:,samples[i]]
             tx = x/(tiny+np.sqrt(vx))
             afname = kwargs['afname']
             shape = kwargs['shape']
@@ -502,7 +538,7 @@ def cluster_reproducibility(data, vardata, xyz, ngroups, coord, sigma,
             afname = afname+'_%02d_%04d.pic'%(niter,i)
             pos = coord_bsa(xyz, coord, tx, affine, shape, theta, dmax,
                             ths, thq, smin, afname)
-        all_pos.append(pos)
+            all_pos.append(pos)
 
     # derive a kernel-based goodness measure from the pairwise comparison
     # of sets of positions
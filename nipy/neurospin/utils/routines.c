@@ -1,3220 +0,0 @@
-/* Generated by Cython 0.11.2 on Wed Oct 28 00:55:57 2009 */
-
-#define PY_SSIZE_T_CLEAN
-#include "Python.h"
-#include "structmember.h"
-#ifndef Py_PYTHON_H
-    #error Python headers needed to compile C extensions, please install development version of Python.
-#endif
-#ifndef PY_LONG_LONG
-  #define PY_LONG_LONG LONG_LONG
-#endif
-#ifndef DL_EXPORT
-  #define DL_EXPORT(t) t
-#endif
-#if PY_VERSION_HEX < 0x02040000
-  #define METH_COEXIST 0
-  #define PyDict_CheckExact(op) (Py_TYPE(op) == &PyDict_Type)
-#endif
-#if PY_VERSION_HEX < 0x02050000
-  typedef int Py_ssize_t;
-  #define PY_SSIZE_T_MAX INT_MAX
-  #define PY_SSIZE_T_MIN INT_MIN
-  #define PY_FORMAT_SIZE_T ""
-  #define PyInt_FromSsize_t(z) PyInt_FromLong(z)
-  #define PyInt_AsSsize_t(o)   PyInt_AsLong(o)
-  #define PyNumber_Index(o)    PyNumber_Int(o)
-  #define PyIndex_Check(o)     PyNumber_Check(o)
-#endif
-#if PY_VERSION_HEX < 0x02060000
-  #define Py_REFCNT(ob) (((PyObject*)(ob))->ob_refcnt)
-  #define Py_TYPE(ob)   (((PyObject*)(ob))->ob_type)
-  #define Py_SIZE(ob)   (((PyVarObject*)(ob))->ob_size)
-  #define PyVarObject_HEAD_INIT(type, size) \
-          PyObject_HEAD_INIT(type) size,
-  #define PyType_Modified(t)
-
-  typedef struct {
-       void *buf;
-       PyObject *obj;
-       Py_ssize_t len;
-       Py_ssize_t itemsize;
-       int readonly;
-       int ndim;
-       char *format;
-       Py_ssize_t *shape;
-       Py_ssize_t *strides;
-       Py_ssize_t *suboffsets;
-       void *internal;
-  } Py_buffer;
-
-  #define PyBUF_SIMPLE 0
-  #define PyBUF_WRITABLE 0x0001
-  #define PyBUF_FORMAT 0x0004
-  #define PyBUF_ND 0x0008
-  #define PyBUF_STRIDES (0x0010 | PyBUF_ND)
-  #define PyBUF_C_CONTIGUOUS (0x0020 | PyBUF_STRIDES)
-  #define PyBUF_F_CONTIGUOUS (0x0040 | PyBUF_STRIDES)
-  #define PyBUF_ANY_CONTIGUOUS (0x0080 | PyBUF_STRIDES)
-  #define PyBUF_INDIRECT (0x0100 | PyBUF_STRIDES)
-
-#endif
-#if PY_MAJOR_VERSION < 3
-  #define __Pyx_BUILTIN_MODULE_NAME "__builtin__"
-#else
-  #define __Pyx_BUILTIN_MODULE_NAME "builtins"
-#endif
-#if PY_MAJOR_VERSION >= 3
-  #define Py_TPFLAGS_CHECKTYPES 0
-  #define Py_TPFLAGS_HAVE_INDEX 0
-#endif
-#if (PY_VERSION_HEX < 0x02060000) || (PY_MAJOR_VERSION >= 3)
-  #define Py_TPFLAGS_HAVE_NEWBUFFER 0
-#endif
-#if PY_MAJOR_VERSION >= 3
-  #define PyBaseString_Type            PyUnicode_Type
-  #define PyString_Type                PyBytes_Type
-  #define PyString_CheckExact          PyBytes_CheckExact
-  #define PyInt_Type                   PyLong_Type
-  #define PyInt_Check(op)              PyLong_Check(op)
-  #define PyInt_CheckExact(op)         PyLong_CheckExact(op)
-  #define PyInt_FromString             PyLong_FromString
-  #define PyInt_FromUnicode            PyLong_FromUnicode
-  #define PyInt_FromLong               PyLong_FromLong
-  #define PyInt_FromSize_t             PyLong_FromSize_t
-  #define PyInt_FromSsize_t            PyLong_FromSsize_t
-  #define PyInt_AsLong                 PyLong_AsLong
-  #define PyInt_AS_LONG                PyLong_AS_LONG
-  #define PyInt_AsSsize_t              PyLong_AsSsize_t
-  #define PyInt_AsUnsignedLongMask     PyLong_AsUnsignedLongMask
-  #define PyInt_AsUnsignedLongLongMask PyLong_AsUnsignedLongLongMask
-  #define __Pyx_PyNumber_Divide(x,y)         PyNumber_TrueDivide(x,y)
-#else
-  #define __Pyx_PyNumber_Divide(x,y)         PyNumber_Divide(x,y)
-  #define PyBytes_Type                 PyString_Type
-#endif
-#if PY_MAJOR_VERSION >= 3
-  #define PyMethod_New(func, self, klass) PyInstanceMethod_New(func)
-#endif
-#if !defined(WIN32) && !defined(MS_WINDOWS)
-  #ifndef __stdcall
-    #define __stdcall
-  #endif
-  #ifndef __cdecl
-    #define __cdecl
-  #endif
-  #ifndef __fastcall
-    #define __fastcall
-  #endif
-#else
-  #define _USE_MATH_DEFINES
-#endif
-#if PY_VERSION_HEX < 0x02050000
-  #define __Pyx_GetAttrString(o,n)   PyObject_GetAttrString((o),((char *)(n)))
-  #define __Pyx_SetAttrString(o,n,a) PyObject_SetAttrString((o),((char *)(n)),(a))
-  #define __Pyx_DelAttrString(o,n)   PyObject_DelAttrString((o),((char *)(n)))
-#else
-  #define __Pyx_GetAttrString(o,n)   PyObject_GetAttrString((o),(n))
-  #define __Pyx_SetAttrString(o,n,a) PyObject_SetAttrString((o),(n),(a))
-  #define __Pyx_DelAttrString(o,n)   PyObject_DelAttrString((o),(n))
-#endif
-#if PY_VERSION_HEX < 0x02050000
-  #define __Pyx_NAMESTR(n) ((char *)(n))
-  #define __Pyx_DOCSTR(n)  ((char *)(n))
-#else
-  #define __Pyx_NAMESTR(n) (n)
-  #define __Pyx_DOCSTR(n)  (n)
-#endif
-#ifdef __cplusplus
-#define __PYX_EXTERN_C extern "C"
-#else
-#define __PYX_EXTERN_C extern
-#endif
-#include <math.h>
-#define __PYX_HAVE_API__nipy__neurospin__utils__routines
-#include "numpy/arrayobject.h"
-#include "fff_base.h"
-#include "fff_vector.h"
-#include "fff_matrix.h"
-#include "fff_array.h"
-#include "randomkit.h"
-#include "fffpy.h"
-#include "fff_gen_stats.h"
-#include "fff_specfun.h"
-#include "fff_lapack.h"
-#define __PYX_USE_C99_COMPLEX defined(_Complex_I)
-
-
-#ifdef __GNUC__
-#define INLINE __inline__
-#elif _WIN32
-#define INLINE __inline
-#else
-#define INLINE 
-#endif
-
-typedef struct {PyObject **p; char *s; long n; char is_unicode; char intern; char is_identifier;} __Pyx_StringTabEntry; /*proto*/
-
-
-
-static int __pyx_skip_dispatch = 0;
-
-
-/* Type Conversion Predeclarations */
-
-#if PY_MAJOR_VERSION < 3
-#define __Pyx_PyBytes_FromString          PyString_FromString
-#define __Pyx_PyBytes_FromStringAndSize   PyString_FromStringAndSize
-#define __Pyx_PyBytes_AsString            PyString_AsString
-#else
-#define __Pyx_PyBytes_FromString          PyBytes_FromString
-#define __Pyx_PyBytes_FromStringAndSize   PyBytes_FromStringAndSize
-#define __Pyx_PyBytes_AsString            PyBytes_AsString
-#endif
-
-#define __Pyx_PyBool_FromLong(b) ((b) ? (Py_INCREF(Py_True), Py_True) : (Py_INCREF(Py_False), Py_False))
-static INLINE int __Pyx_PyObject_IsTrue(PyObject*);
-static INLINE PyObject* __Pyx_PyNumber_Int(PyObject* x);
-
-#if !defined(T_PYSSIZET)
-#if PY_VERSION_HEX < 0x02050000
-#define T_PYSSIZET T_INT
-#elif !defined(T_LONGLONG)
-#define T_PYSSIZET \
-        ((sizeof(Py_ssize_t) == sizeof(int))  ? T_INT  : \
-        ((sizeof(Py_ssize_t) == sizeof(long)) ? T_LONG : -1))
-#else
-#define T_PYSSIZET \
-        ((sizeof(Py_ssize_t) == sizeof(int))          ? T_INT      : \
-        ((sizeof(Py_ssize_t) == sizeof(long))         ? T_LONG     : \
-        ((sizeof(Py_ssize_t) == sizeof(PY_LONG_LONG)) ? T_LONGLONG : -1)))
-#endif
-#endif
-
-#if !defined(T_SIZET)
-#if !defined(T_ULONGLONG)
-#define T_SIZET \
-        ((sizeof(size_t) == sizeof(unsigned int))  ? T_UINT  : \
-        ((sizeof(size_t) == sizeof(unsigned long)) ? T_ULONG : -1))
-#else
-#define T_SIZET \
-        ((sizeof(size_t) == sizeof(unsigned int))          ? T_UINT      : \
-        ((sizeof(size_t) == sizeof(unsigned long))         ? T_ULONG     : \
-        ((sizeof(size_t) == sizeof(unsigned PY_LONG_LONG)) ? T_ULONGLONG : -1)))
-#endif
-#endif
-
-static INLINE Py_ssize_t __Pyx_PyIndex_AsSsize_t(PyObject*);
-static INLINE PyObject * __Pyx_PyInt_FromSize_t(size_t);
-static INLINE size_t __Pyx_PyInt_AsSize_t(PyObject*);
-
-#define __pyx_PyFloat_AsDouble(x) (PyFloat_CheckExact(x) ? PyFloat_AS_DOUBLE(x) : PyFloat_AsDouble(x))
-
-
-#ifdef __GNUC__
-/* Test for GCC > 2.95 */
-#if __GNUC__ > 2 ||               (__GNUC__ == 2 && (__GNUC_MINOR__ > 95)) 
-#define likely(x)   __builtin_expect(!!(x), 1)
-#define unlikely(x) __builtin_expect(!!(x), 0)
-#else /* __GNUC__ > 2 ... */
-#define likely(x)   (x)
-#define unlikely(x) (x)
-#endif /* __GNUC__ > 2 ... */
-#else /* __GNUC__ */
-#define likely(x)   (x)
-#define unlikely(x) (x)
-#endif /* __GNUC__ */
-    
-static PyObject *__pyx_m;
-static PyObject *__pyx_b;
-static PyObject *__pyx_empty_tuple;
-static int __pyx_lineno;
-static int __pyx_clineno = 0;
-static const char * __pyx_cfilenm= __FILE__;
-static const char *__pyx_filename;
-static const char **__pyx_f;
-
-static char __pyx_mdoc[] = "\nMiscellaneous fff routines.\n\nAuthor: Alexis Roche, 2008.\n";
-
-
-#ifdef CYTHON_REFNANNY
-typedef struct {
-  void (*INCREF)(void*, PyObject*, int);
-  void (*DECREF)(void*, PyObject*, int);
-  void (*GOTREF)(void*, PyObject*, int);
-  void (*GIVEREF)(void*, PyObject*, int);
-  void* (*NewContext)(const char*, int, const char*);
-  void (*FinishContext)(void**);
-} __Pyx_RefnannyAPIStruct;
-static __Pyx_RefnannyAPIStruct *__Pyx_Refnanny = NULL;
-#define __Pyx_ImportRefcountAPI(name)   (__Pyx_RefnannyAPIStruct *) PyCObject_Import((char *)name, (char *)"RefnannyAPI")
-#define __Pyx_INCREF(r) __Pyx_Refnanny->INCREF(__pyx_refchk, (PyObject *)(r), __LINE__)
-#define __Pyx_DECREF(r) __Pyx_Refnanny->DECREF(__pyx_refchk, (PyObject *)(r), __LINE__)
-#define __Pyx_GOTREF(r) __Pyx_Refnanny->GOTREF(__pyx_refchk, (PyObject *)(r), __LINE__)
-#define __Pyx_GIVEREF(r) __Pyx_Refnanny->GIVEREF(__pyx_refchk, (PyObject *)(r), __LINE__)
-#define __Pyx_XDECREF(r) if((r) == NULL) ; else __Pyx_DECREF(r)
-#define __Pyx_SetupRefcountContext(name)   void* __pyx_refchk = __Pyx_Refnanny->NewContext((name), __LINE__, __FILE__)
-#define __Pyx_FinishRefcountContext()   __Pyx_Refnanny->FinishContext(&__pyx_refchk)
-#else
-#define __Pyx_INCREF(r) Py_INCREF(r)
-#define __Pyx_DECREF(r) Py_DECREF(r)
-#define __Pyx_GOTREF(r)
-#define __Pyx_GIVEREF(r)
-#define __Pyx_XDECREF(r) Py_XDECREF(r)
-#define __Pyx_SetupRefcountContext(name)
-#define __Pyx_FinishRefcountContext()
-#endif /* CYTHON_REFNANNY */
-#define __Pyx_XGIVEREF(r) if((r) == NULL) ; else __Pyx_GIVEREF(r)
-#define __Pyx_XGOTREF(r) if((r) == NULL) ; else __Pyx_GOTREF(r)
-
-static void __Pyx_RaiseDoubleKeywordsError(
-    const char* func_name, PyObject* kw_name); /*proto*/
-
-static void __Pyx_RaiseArgtupleInvalid(const char* func_name, int exact,
-    Py_ssize_t num_min, Py_ssize_t num_max, Py_ssize_t num_found); /*proto*/
-
-static int __Pyx_ParseOptionalKeywords(PyObject *kwds, PyObject **argnames[],     PyObject *kwds2, PyObject *values[], Py_ssize_t num_pos_args,     const char* function_name); /*proto*/
-
-#define __Pyx_SetItemInt(o, i, v, size, to_py_func) ((size <= sizeof(Py_ssize_t)) ? \
-                                                    __Pyx_SetItemInt_Fast(o, i, v, size <= sizeof(long)) : \
-                                                    __Pyx_SetItemInt_Generic(o, to_py_func(i), v))
-
-static INLINE int __Pyx_SetItemInt_Generic(PyObject *o, PyObject *j, PyObject *v) {
-    int r;
-    if (!j) return -1;
-    r = PyObject_SetItem(o, j, v);
-    Py_DECREF(j);
-    return r;
-}
-
-static INLINE int __Pyx_SetItemInt_Fast(PyObject *o, Py_ssize_t i, PyObject *v, int fits_long) {
-    if (PyList_CheckExact(o) && ((0 <= i) & (i < PyList_GET_SIZE(o)))) {
-        Py_INCREF(v);
-        Py_DECREF(PyList_GET_ITEM(o, i));
-        PyList_SET_ITEM(o, i, v);
-        return 1;
-    }
-    else if (Py_TYPE(o)->tp_as_sequence && Py_TYPE(o)->tp_as_sequence->sq_ass_item && (likely(i >= 0)))
-        return PySequence_SetItem(o, i, v);
-    else {
-        PyObject *j = fits_long ? PyInt_FromLong(i) : PyLong_FromLongLong(i);
-        return __Pyx_SetItemInt_Generic(o, j, v);
-    }
-}
-
-
-static INLINE PyObject *__Pyx_GetItemInt_Generic(PyObject *o, PyObject* j) {
-    PyObject *r;
-    if (!j) return NULL;
-    r = PyObject_GetItem(o, j);
-    Py_DECREF(j);
-    return r;
-}
-
-
-#define __Pyx_GetItemInt_List(o, i, size, to_py_func) ((size <= sizeof(Py_ssize_t)) ? \
-                                                    __Pyx_GetItemInt_List_Fast(o, i, size <= sizeof(long)) : \
-                                                    __Pyx_GetItemInt_Generic(o, to_py_func(i)))
-
-static INLINE PyObject *__Pyx_GetItemInt_List_Fast(PyObject *o, Py_ssize_t i, int fits_long) {
-    if (likely(o != Py_None)) {
-        if (likely((0 <= i) & (i < PyList_GET_SIZE(o)))) {
-            PyObject *r = PyList_GET_ITEM(o, i);
-            Py_INCREF(r);
-            return r;
-        }
-        else if ((-PyList_GET_SIZE(o) <= i) & (i < 0)) {
-            PyObject *r = PyList_GET_ITEM(o, PyList_GET_SIZE(o) + i);
-            Py_INCREF(r);
-            return r;
-        }
-    }
-    return __Pyx_GetItemInt_Generic(o, fits_long ? PyInt_FromLong(i) : PyLong_FromLongLong(i));
-}
-
-#define __Pyx_GetItemInt_Tuple(o, i, size, to_py_func) ((size <= sizeof(Py_ssize_t)) ? \
-                                                    __Pyx_GetItemInt_Tuple_Fast(o, i, size <= sizeof(long)) : \
-                                                    __Pyx_GetItemInt_Generic(o, to_py_func(i)))
-
-static INLINE PyObject *__Pyx_GetItemInt_Tuple_Fast(PyObject *o, Py_ssize_t i, int fits_long) {
-    if (likely(o != Py_None)) {
-        if (likely((0 <= i) & (i < PyTuple_GET_SIZE(o)))) {
-            PyObject *r = PyTuple_GET_ITEM(o, i);
-            Py_INCREF(r);
-            return r;
-        }
-        else if ((-PyTuple_GET_SIZE(o) <= i) & (i < 0)) {
-            PyObject *r = PyTuple_GET_ITEM(o, PyTuple_GET_SIZE(o) + i);
-            Py_INCREF(r);
-            return r;
-        }
-    }
-    return __Pyx_GetItemInt_Generic(o, fits_long ? PyInt_FromLong(i) : PyLong_FromLongLong(i));
-}
-
-
-#define __Pyx_GetItemInt(o, i, size, to_py_func) ((size <= sizeof(Py_ssize_t)) ? \
-                                                    __Pyx_GetItemInt_Fast(o, i, size <= sizeof(long)) : \
-                                                    __Pyx_GetItemInt_Generic(o, to_py_func(i)))
-
-static INLINE PyObject *__Pyx_GetItemInt_Fast(PyObject *o, Py_ssize_t i, int fits_long) {
-    PyObject *r;
-    if (PyList_CheckExact(o) && ((0 <= i) & (i < PyList_GET_SIZE(o)))) {
-        r = PyList_GET_ITEM(o, i);
-        Py_INCREF(r);
-    }
-    else if (PyTuple_CheckExact(o) && ((0 <= i) & (i < PyTuple_GET_SIZE(o)))) {
-        r = PyTuple_GET_ITEM(o, i);
-        Py_INCREF(r);
-    }
-    else if (Py_TYPE(o)->tp_as_sequence && Py_TYPE(o)->tp_as_sequence->sq_item && (likely(i >= 0))) {
-        r = PySequence_GetItem(o, i);
-    }
-    else {
-        r = __Pyx_GetItemInt_Generic(o, fits_long ? PyInt_FromLong(i) : PyLong_FromLongLong(i));
-    }
-    return r;
-}
-
-static PyObject *__Pyx_Import(PyObject *name, PyObject *from_list); /*proto*/
-
-static PyObject *__Pyx_GetName(PyObject *dict, PyObject *name); /*proto*/
-
-static INLINE int __Pyx_StrEq(const char *, const char *); /*proto*/
-
-static INLINE unsigned char __Pyx_PyInt_AsUnsignedChar(PyObject *);
-
-static INLINE unsigned short __Pyx_PyInt_AsUnsignedShort(PyObject *);
-
-static INLINE unsigned int __Pyx_PyInt_AsUnsignedInt(PyObject *);
-
-static INLINE char __Pyx_PyInt_AsChar(PyObject *);
-
-static INLINE short __Pyx_PyInt_AsShort(PyObject *);
-
-static INLINE int __Pyx_PyInt_AsInt(PyObject *);
-
-static INLINE signed char __Pyx_PyInt_AsSignedChar(PyObject *);
-
-static INLINE signed short __Pyx_PyInt_AsSignedShort(PyObject *);
-
-static INLINE signed int __Pyx_PyInt_AsSignedInt(PyObject *);
-
-static INLINE unsigned long __Pyx_PyInt_AsUnsignedLong(PyObject *);
-
-static INLINE unsigned PY_LONG_LONG __Pyx_PyInt_AsUnsignedLongLong(PyObject *);
-
-static INLINE long __Pyx_PyInt_AsLong(PyObject *);
-
-static INLINE PY_LONG_LONG __Pyx_PyInt_AsLongLong(PyObject *);
-
-static INLINE signed long __Pyx_PyInt_AsSignedLong(PyObject *);
-
-static INLINE signed PY_LONG_LONG __Pyx_PyInt_AsSignedLongLong(PyObject *);
-
-static PyTypeObject *__Pyx_ImportType(const char *module_name, const char *class_name, long size);  /*proto*/
-
-static PyObject *__Pyx_ImportModule(const char *name); /*proto*/
-
-static void __Pyx_AddTraceback(const char *funcname); /*proto*/
-
-static int __Pyx_InitStrings(__Pyx_StringTabEntry *t); /*proto*/
-
-/* Type declarations */
-
-typedef unsigned long __pyx_t_4nipy_9neurospin_5utils_8routines_size_t;
-/* Module declarations from numpy */
-
-/* Module declarations from nipy.neurospin.utils.routines */
-
-static PyTypeObject *__pyx_ptype_4nipy_9neurospin_5utils_8routines_dtype = 0;
-static PyTypeObject *__pyx_ptype_4nipy_9neurospin_5utils_8routines_ndarray = 0;
-static PyTypeObject *__pyx_ptype_4nipy_9neurospin_5utils_8routines_flatiter = 0;
-static PyTypeObject *__pyx_ptype_4nipy_9neurospin_5utils_8routines_broadcast = 0;
-#define __Pyx_MODULE_NAME "nipy.neurospin.utils.routines"
-int __pyx_module_is_main_nipy__neurospin__utils__routines = 0;
-
-/* Implementation of nipy.neurospin.utils.routines */
-static char __pyx_k_1[] = "0.1";
-static PyObject *__pyx_int_0;
-static PyObject *__pyx_int_1;
-static char __pyx_k___main__[] = "__main__";
-static PyObject *__pyx_kp___main__;
-static char __pyx_k_X[] = "X";
-static PyObject *__pyx_kp_X;
-static char __pyx_k_ratio[] = "ratio";
-static PyObject *__pyx_kp_ratio;
-static char __pyx_k_interp[] = "interp";
-static PyObject *__pyx_kp_interp;
-static char __pyx_k_axis[] = "axis";
-static PyObject *__pyx_kp_axis;
-static char __pyx_k_x[] = "x";
-static PyObject *__pyx_kp_x;
-static char __pyx_k_VX[] = "VX";
-static PyObject *__pyx_kp_VX;
-static char __pyx_k_n[] = "n";
-static PyObject *__pyx_kp_n;
-static char __pyx_k_m[] = "m";
-static PyObject *__pyx_kp_m;
-static char __pyx_k_magic[] = "magic";
-static PyObject *__pyx_kp_magic;
-static char __pyx_k_k[] = "k";
-static PyObject *__pyx_kp_k;
-static char __pyx_k___version__[] = "__version__";
-static PyObject *__pyx_kp___version__;
-static char __pyx_k_numpy[] = "numpy";
-static PyObject *__pyx_kp_numpy;
-static char __pyx_k_np[] = "np";
-static PyObject *__pyx_kp_np;
-static char __pyx_k_shape[] = "shape";
-static PyObject *__pyx_kp_shape;
-static char __pyx_k_zeros[] = "zeros";
-static PyObject *__pyx_kp_zeros;
-static char __pyx_k_quantile[] = "quantile";
-static PyObject *__pyx_kp_quantile;
-static char __pyx_k_reshape[] = "reshape";
-static PyObject *__pyx_kp_reshape;
-static PyObject *__pyx_kp_1;
-
-/* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\utils\routines.pyx":43
- * 
- * # FIXME: Check that this is faster than scipy.stats.scoreatpercentile
- * def quantile(X, double ratio, int interp=False, int axis=0):             # <<<<<<<<<<<<<<
- *     """
- *     q = quantile(data, ratio, interp=False, axis=0).
- */
-
-static PyObject *__pyx_pf_4nipy_9neurospin_5utils_8routines_quantile(PyObject *__pyx_self, PyObject *__pyx_args, PyObject *__pyx_kwds); /*proto*/
-static char __pyx_doc_4nipy_9neurospin_5utils_8routines_quantile[] = "\n    q = quantile(data, ratio, interp=False, axis=0).\n\n    Partial sorting algorithm, very fast!!!\n    ";
-static PyObject *__pyx_pf_4nipy_9neurospin_5utils_8routines_quantile(PyObject *__pyx_self, PyObject *__pyx_args, PyObject *__pyx_kwds) {
-  PyObject *__pyx_v_X = 0;
-  double __pyx_v_ratio;
-  int __pyx_v_interp;
-  int __pyx_v_axis;
-  fff_vector *__pyx_v_x;
-  fff_vector *__pyx_v_y;
-  fffpy_multi_iterator *__pyx_v_multi;
-  PyObject *__pyx_v_dims;
-  PyObject *__pyx_v_Y;
-  PyObject *__pyx_r = NULL;
-  PyObject *__pyx_1 = 0;
-  PyObject *__pyx_t_1 = NULL;
-  PyObject *__pyx_t_2 = NULL;
-  PyObject *__pyx_t_3 = NULL;
-  int __pyx_t_4;
-  static PyObject **__pyx_pyargnames[] = {&__pyx_kp_X,&__pyx_kp_ratio,&__pyx_kp_interp,&__pyx_kp_axis,0};
-  __Pyx_SetupRefcountContext("quantile");
-  __pyx_self = __pyx_self;
-  if (unlikely(__pyx_kwds)) {
-    Py_ssize_t kw_args = PyDict_Size(__pyx_kwds);
-    PyObject* values[4] = {0,0,0,0};
-    switch (PyTuple_GET_SIZE(__pyx_args)) {
-      case  4: values[3] = PyTuple_GET_ITEM(__pyx_args, 3);
-      case  3: values[2] = PyTuple_GET_ITEM(__pyx_args, 2);
-      case  2: values[1] = PyTuple_GET_ITEM(__pyx_args, 1);
-      case  1: values[0] = PyTuple_GET_ITEM(__pyx_args, 0);
-      case  0: break;
-      default: goto __pyx_L5_argtuple_error;
-    }
-    switch (PyTuple_GET_SIZE(__pyx_args)) {
-      case  0:
-      values[0] = PyDict_GetItem(__pyx_kwds, __pyx_kp_X);
-      if (likely(values[0])) kw_args--;
-      else goto __pyx_L5_argtuple_error;
-      case  1:
-      values[1] = PyDict_GetItem(__pyx_kwds, __pyx_kp_ratio);
-      if (likely(values[1])) kw_args--;
-      else {
-        __Pyx_RaiseArgtupleInvalid("quantile", 0, 2, 4, 1); {__pyx_filename = __pyx_f[0]; __pyx_lineno = 43; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-      }
-      case  2:
-      if (kw_args > 0) {
-        PyObject* value = PyDict_GetItem(__pyx_kwds, __pyx_kp_interp);
-        if (unlikely(value)) { values[2] = value; kw_args--; }
-      }
-      case  3:
-      if (kw_args > 0) {
-        PyObject* value = PyDict_GetItem(__pyx_kwds, __pyx_kp_axis);
-        if (unlikely(value)) { values[3] = value; kw_args--; }
-      }
-    }
-    if (unlikely(kw_args > 0)) {
-      if (unlikely(__Pyx_ParseOptionalKeywords(__pyx_kwds, __pyx_pyargnames, 0, values, PyTuple_GET_SIZE(__pyx_args), "quantile") < 0)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 43; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-    }
-    __pyx_v_X = values[0];
-    __pyx_v_ratio = __pyx_PyFloat_AsDouble(values[1]); if (unlikely(PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 43; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-    if (values[2]) {
-      __pyx_v_interp = __Pyx_PyInt_AsInt(values[2]); if (unlikely((__pyx_v_interp == (int)-1) && PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 43; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-    } else {
-      __pyx_v_interp = 0;
-    }
-    if (values[3]) {
-      __pyx_v_axis = __Pyx_PyInt_AsInt(values[3]); if (unlikely((__pyx_v_axis == (int)-1) && PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 43; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-    } else {
-      __pyx_v_axis = 0;
-    }
-  } else {
-    __pyx_v_interp = 0;
-    __pyx_v_axis = 0;
-    switch (PyTuple_GET_SIZE(__pyx_args)) {
-      case  4:
-      __pyx_v_axis = __Pyx_PyInt_AsInt(PyTuple_GET_ITEM(__pyx_args, 3)); if (unlikely((__pyx_v_axis == (int)-1) && PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 43; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-      case  3:
-      __pyx_v_interp = __Pyx_PyInt_AsInt(PyTuple_GET_ITEM(__pyx_args, 2)); if (unlikely((__pyx_v_interp == (int)-1) && PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 43; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-      case  2:
-      __pyx_v_ratio = __pyx_PyFloat_AsDouble(PyTuple_GET_ITEM(__pyx_args, 1)); if (unlikely(PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 43; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-      __pyx_v_X = PyTuple_GET_ITEM(__pyx_args, 0);
-      break;
-      default: goto __pyx_L5_argtuple_error;
-    }
-  }
-  goto __pyx_L4_argument_unpacking_done;
-  __pyx_L5_argtuple_error:;
-  __Pyx_RaiseArgtupleInvalid("quantile", 0, 2, 4, PyTuple_GET_SIZE(__pyx_args)); {__pyx_filename = __pyx_f[0]; __pyx_lineno = 43; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-  __pyx_L3_error:;
-  __Pyx_AddTraceback("nipy.neurospin.utils.routines.quantile");
-  return NULL;
-  __pyx_L4_argument_unpacking_done:;
-  __pyx_v_dims = Py_None; __Pyx_INCREF(Py_None);
-  __pyx_v_Y = Py_None; __Pyx_INCREF(Py_None);
-
-  /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\utils\routines.pyx":53
- * 
- *     # Allocate output array Y
- *     dims = list(X.shape)             # <<<<<<<<<<<<<<
- *     dims[axis] = 1
- *     Y = np.zeros(dims)
- */
-  __pyx_t_1 = PyObject_GetAttr(__pyx_v_X, __pyx_kp_shape); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 53; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_1);
-  __pyx_t_2 = PyTuple_New(1); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 53; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_2));
-  PyTuple_SET_ITEM(__pyx_t_2, 0, __pyx_t_1);
-  __Pyx_GIVEREF(__pyx_t_1);
-  __pyx_t_1 = 0;
-  __pyx_t_1 = PyObject_Call(((PyObject *)((PyObject*)&PyList_Type)), ((PyObject *)__pyx_t_2), NULL); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 53; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_1);
-  __Pyx_DECREF(((PyObject *)__pyx_t_2)); __pyx_t_2 = 0;
-  __Pyx_DECREF(__pyx_v_dims);
-  __pyx_v_dims = __pyx_t_1;
-  __pyx_t_1 = 0;
-
-  /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\utils\routines.pyx":54
- *     # Allocate output array Y
- *     dims = list(X.shape)
- *     dims[axis] = 1             # <<<<<<<<<<<<<<
- *     Y = np.zeros(dims)
- * 
- */
-  if (__Pyx_SetItemInt(__pyx_v_dims, __pyx_v_axis, __pyx_int_1, sizeof(int), PyInt_FromLong) < 0) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 54; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-
-  /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\utils\routines.pyx":55
- *     dims = list(X.shape)
- *     dims[axis] = 1
- *     Y = np.zeros(dims)             # <<<<<<<<<<<<<<
- * 
- *     # Create a new array iterator
- */
-  __pyx_1 = __Pyx_GetName(__pyx_m, __pyx_kp_np); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 55; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_1);
-  __pyx_t_1 = PyObject_GetAttr(__pyx_1, __pyx_kp_zeros); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 55; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_1);
-  __Pyx_DECREF(__pyx_1); __pyx_1 = 0;
-  __pyx_t_2 = PyTuple_New(1); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 55; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_2));
-  __Pyx_INCREF(__pyx_v_dims);
-  PyTuple_SET_ITEM(__pyx_t_2, 0, __pyx_v_dims);
-  __Pyx_GIVEREF(__pyx_v_dims);
-  __pyx_t_3 = PyObject_Call(__pyx_t_1, ((PyObject *)__pyx_t_2), NULL); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 55; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_3);
-  __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-  __Pyx_DECREF(((PyObject *)__pyx_t_2)); __pyx_t_2 = 0;
-  __Pyx_DECREF(__pyx_v_Y);
-  __pyx_v_Y = __pyx_t_3;
-  __pyx_t_3 = 0;
-
-  /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\utils\routines.pyx":58
- * 
- *     # Create a new array iterator
- *     multi = fffpy_multi_iterator_new(2, axis, <void*>X, <void*>Y)             # <<<<<<<<<<<<<<
- * 
- *     # Create vector views on both X and Y
- */
-  __pyx_v_multi = fffpy_multi_iterator_new(2, __pyx_v_axis, ((void *)__pyx_v_X), ((void *)__pyx_v_Y));
-
-  /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\utils\routines.pyx":61
- * 
- *     # Create vector views on both X and Y
- *     x = multi.vector[0]             # <<<<<<<<<<<<<<
- *     y = multi.vector[1]
- * 
- */
-  __pyx_v_x = (__pyx_v_multi->vector[0]);
-
-  /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\utils\routines.pyx":62
- *     # Create vector views on both X and Y
- *     x = multi.vector[0]
- *     y = multi.vector[1]             # <<<<<<<<<<<<<<
- * 
- *     # Loop
- */
-  __pyx_v_y = (__pyx_v_multi->vector[1]);
-
-  /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\utils\routines.pyx":65
- * 
- *     # Loop
- *     while(multi.index < multi.size):             # <<<<<<<<<<<<<<
- *         y.data[0] = fff_vector_quantile(x, ratio, interp)
- *         fffpy_multi_iterator_update(multi)
- */
-  while (1) {
-    __pyx_t_4 = (__pyx_v_multi->index < __pyx_v_multi->size);
-    if (!__pyx_t_4) break;
-
-    /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\utils\routines.pyx":66
- *     # Loop
- *     while(multi.index < multi.size):
- *         y.data[0] = fff_vector_quantile(x, ratio, interp)             # <<<<<<<<<<<<<<
- *         fffpy_multi_iterator_update(multi)
- * 
- */
-    (__pyx_v_y->data[0]) = fff_vector_quantile(__pyx_v_x, __pyx_v_ratio, __pyx_v_interp);
-
-    /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\utils\routines.pyx":67
- *     while(multi.index < multi.size):
- *         y.data[0] = fff_vector_quantile(x, ratio, interp)
- *         fffpy_multi_iterator_update(multi)             # <<<<<<<<<<<<<<
- * 
- *     # Delete local structures
- */
-    fffpy_multi_iterator_update(__pyx_v_multi);
-  }
-
-  /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\utils\routines.pyx":70
- * 
- *     # Delete local structures
- *     fffpy_multi_iterator_delete(multi)             # <<<<<<<<<<<<<<
- *     return Y
- * 
- */
-  fffpy_multi_iterator_delete(__pyx_v_multi);
-
-  /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\utils\routines.pyx":71
- *     # Delete local structures
- *     fffpy_multi_iterator_delete(multi)
- *     return Y             # <<<<<<<<<<<<<<
- * 
- * # FIXME: Why this and not the numpy median? Check that this is faster.
- */
-  __Pyx_XDECREF(__pyx_r);
-  __Pyx_INCREF(__pyx_v_Y);
-  __pyx_r = __pyx_v_Y;
-  goto __pyx_L0;
-
-  __pyx_r = Py_None; __Pyx_INCREF(Py_None);
-  goto __pyx_L0;
-  __pyx_L1_error:;
-  __Pyx_XDECREF(__pyx_1);
-  __Pyx_XDECREF(__pyx_t_1);
-  __Pyx_XDECREF(__pyx_t_2);
-  __Pyx_XDECREF(__pyx_t_3);
-  __Pyx_AddTraceback("nipy.neurospin.utils.routines.quantile");
-  __pyx_r = NULL;
-  __pyx_L0:;
-  __Pyx_DECREF(__pyx_v_dims);
-  __Pyx_DECREF(__pyx_v_Y);
-  __Pyx_XGIVEREF(__pyx_r);
-  __Pyx_FinishRefcountContext();
-  return __pyx_r;
-}
-
-/* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\utils\routines.pyx":76
- * # AR: it is faster due to the underlying algorithm that relies on
- * # partial sorting as opposed to full sorting.
- * def median(x, axis=0):             # <<<<<<<<<<<<<<
- *     """
- *     median(x, axis=0).
- */
-
-static PyObject *__pyx_pf_4nipy_9neurospin_5utils_8routines_median(PyObject *__pyx_self, PyObject *__pyx_args, PyObject *__pyx_kwds); /*proto*/
-static char __pyx_doc_4nipy_9neurospin_5utils_8routines_median[] = "\n    median(x, axis=0).\n    Equivalent to: quantile(x, ratio=0.5, interp=True, axis=axis).\n    ";
-static PyObject *__pyx_pf_4nipy_9neurospin_5utils_8routines_median(PyObject *__pyx_self, PyObject *__pyx_args, PyObject *__pyx_kwds) {
-  PyObject *__pyx_v_x = 0;
-  PyObject *__pyx_v_axis = 0;
-  PyObject *__pyx_r = NULL;
-  PyObject *__pyx_1 = 0;
-  PyObject *__pyx_2 = 0;
-  PyObject *__pyx_t_1 = NULL;
-  PyObject *__pyx_t_2 = NULL;
-  static PyObject **__pyx_pyargnames[] = {&__pyx_kp_x,&__pyx_kp_axis,0};
-  __Pyx_SetupRefcountContext("median");
-  __pyx_self = __pyx_self;
-  if (unlikely(__pyx_kwds)) {
-    Py_ssize_t kw_args = PyDict_Size(__pyx_kwds);
-    PyObject* values[2] = {0,0};
-    values[1] = __pyx_int_0;
-    switch (PyTuple_GET_SIZE(__pyx_args)) {
-      case  2: values[1] = PyTuple_GET_ITEM(__pyx_args, 1);
-      case  1: values[0] = PyTuple_GET_ITEM(__pyx_args, 0);
-      case  0: break;
-      default: goto __pyx_L5_argtuple_error;
-    }
-    switch (PyTuple_GET_SIZE(__pyx_args)) {
-      case  0:
-      values[0] = PyDict_GetItem(__pyx_kwds, __pyx_kp_x);
-      if (likely(values[0])) kw_args--;
-      else goto __pyx_L5_argtuple_error;
-      case  1:
-      if (kw_args > 0) {
-        PyObject* value = PyDict_GetItem(__pyx_kwds, __pyx_kp_axis);
-        if (unlikely(value)) { values[1] = value; kw_args--; }
-      }
-    }
-    if (unlikely(kw_args > 0)) {
-      if (unlikely(__Pyx_ParseOptionalKeywords(__pyx_kwds, __pyx_pyargnames, 0, values, PyTuple_GET_SIZE(__pyx_args), "median") < 0)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 76; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-    }
-    __pyx_v_x = values[0];
-    __pyx_v_axis = values[1];
-  } else {
-    __pyx_v_axis = __pyx_int_0;
-    switch (PyTuple_GET_SIZE(__pyx_args)) {
-      case  2: __pyx_v_axis = PyTuple_GET_ITEM(__pyx_args, 1);
-      case  1: __pyx_v_x = PyTuple_GET_ITEM(__pyx_args, 0);
-      break;
-      default: goto __pyx_L5_argtuple_error;
-    }
-  }
-  goto __pyx_L4_argument_unpacking_done;
-  __pyx_L5_argtuple_error:;
-  __Pyx_RaiseArgtupleInvalid("median", 0, 1, 2, PyTuple_GET_SIZE(__pyx_args)); {__pyx_filename = __pyx_f[0]; __pyx_lineno = 76; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-  __pyx_L3_error:;
-  __Pyx_AddTraceback("nipy.neurospin.utils.routines.median");
-  return NULL;
-  __pyx_L4_argument_unpacking_done:;
-
-  /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\utils\routines.pyx":81
- *     Equivalent to: quantile(x, ratio=0.5, interp=True, axis=axis).
- *     """
- *     return quantile(x, axis=axis, ratio=0.5, interp=True)             # <<<<<<<<<<<<<<
- * 
- * 
- */
-  __Pyx_XDECREF(__pyx_r);
-  __pyx_1 = __Pyx_GetName(__pyx_m, __pyx_kp_quantile); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 81; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_1);
-  __pyx_t_1 = PyTuple_New(1); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 81; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_1));
-  __Pyx_INCREF(__pyx_v_x);
-  PyTuple_SET_ITEM(__pyx_t_1, 0, __pyx_v_x);
-  __Pyx_GIVEREF(__pyx_v_x);
-  __pyx_2 = PyDict_New(); if (unlikely(!__pyx_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 81; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_2));
-  if (PyDict_SetItem(__pyx_2, __pyx_kp_axis, __pyx_v_axis) < 0) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 81; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __pyx_t_2 = PyFloat_FromDouble(0.5); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 81; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_2);
-  if (PyDict_SetItem(__pyx_2, __pyx_kp_ratio, __pyx_t_2) < 0) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 81; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_DECREF(__pyx_t_2); __pyx_t_2 = 0;
-  __pyx_t_2 = __Pyx_PyBool_FromLong(1); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 81; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_2);
-  if (PyDict_SetItem(__pyx_2, __pyx_kp_interp, __pyx_t_2) < 0) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 81; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_DECREF(__pyx_t_2); __pyx_t_2 = 0;
-  __pyx_t_2 = PyEval_CallObjectWithKeywords(__pyx_1, ((PyObject *)__pyx_t_1), ((PyObject *)__pyx_2)); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 81; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_2);
-  __Pyx_DECREF(__pyx_1); __pyx_1 = 0;
-  __Pyx_DECREF(((PyObject *)__pyx_t_1)); __pyx_t_1 = 0;
-  __Pyx_DECREF(((PyObject *)__pyx_2)); __pyx_2 = 0;
-  __pyx_r = __pyx_t_2;
-  __pyx_t_2 = 0;
-  goto __pyx_L0;
-
-  __pyx_r = Py_None; __Pyx_INCREF(Py_None);
-  goto __pyx_L0;
-  __pyx_L1_error:;
-  __Pyx_XDECREF(__pyx_1);
-  __Pyx_XDECREF(__pyx_2);
-  __Pyx_XDECREF(__pyx_t_1);
-  __Pyx_XDECREF(__pyx_t_2);
-  __Pyx_AddTraceback("nipy.neurospin.utils.routines.median");
-  __pyx_r = NULL;
-  __pyx_L0:;
-  __Pyx_XGIVEREF(__pyx_r);
-  __Pyx_FinishRefcountContext();
-  return __pyx_r;
-}
-
-/* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\utils\routines.pyx":84
- * 
- * 
- * def mahalanobis(X, VX):             # <<<<<<<<<<<<<<
- *     """
- *     d2 = mahalanobis(X, VX).
- */
-
-static PyObject *__pyx_pf_4nipy_9neurospin_5utils_8routines_mahalanobis(PyObject *__pyx_self, PyObject *__pyx_args, PyObject *__pyx_kwds); /*proto*/
-static char __pyx_doc_4nipy_9neurospin_5utils_8routines_mahalanobis[] = "\n    d2 = mahalanobis(X, VX).\n\n    ufunc-like function to compute Mahalanobis squared distances\n    x'*inv(Vx)*x.  \n\n    axis == 0 assumed. If X is shaped (d,K), VX must be shaped\n    (d,d,K).\n    ";
-static PyObject *__pyx_pf_4nipy_9neurospin_5utils_8routines_mahalanobis(PyObject *__pyx_self, PyObject *__pyx_args, PyObject *__pyx_kwds) {
-  PyObject *__pyx_v_X = 0;
-  PyObject *__pyx_v_VX = 0;
-  fff_vector *__pyx_v_x;
-  fff_vector *__pyx_v_vx;
-  fff_vector *__pyx_v_x_tmp;
-  fff_vector *__pyx_v_vx_tmp;
-  fff_vector *__pyx_v_d2;
-  fff_matrix __pyx_v_Sx;
-  fff_matrix *__pyx_v_Sx_tmp;
-  fffpy_multi_iterator *__pyx_v_multi;
-  int __pyx_v_axis;
-  int __pyx_v_n;
-  PyObject *__pyx_v_dims;
-  PyObject *__pyx_v_dim;
-  PyObject *__pyx_v_D2;
-  PyObject *__pyx_v_VX_flat;
-  PyObject *__pyx_r = NULL;
-  PyObject *__pyx_1 = 0;
-  PyObject *__pyx_t_1 = NULL;
-  PyObject *__pyx_t_2 = NULL;
-  PyObject *__pyx_t_3 = NULL;
-  PyObject *__pyx_t_4 = NULL;
-  int __pyx_t_5;
-  int __pyx_t_6;
-  static PyObject **__pyx_pyargnames[] = {&__pyx_kp_X,&__pyx_kp_VX,0};
-  __Pyx_SetupRefcountContext("mahalanobis");
-  __pyx_self = __pyx_self;
-  if (unlikely(__pyx_kwds)) {
-    Py_ssize_t kw_args = PyDict_Size(__pyx_kwds);
-    PyObject* values[2] = {0,0};
-    switch (PyTuple_GET_SIZE(__pyx_args)) {
-      case  2: values[1] = PyTuple_GET_ITEM(__pyx_args, 1);
-      case  1: values[0] = PyTuple_GET_ITEM(__pyx_args, 0);
-      case  0: break;
-      default: goto __pyx_L5_argtuple_error;
-    }
-    switch (PyTuple_GET_SIZE(__pyx_args)) {
-      case  0:
-      values[0] = PyDict_GetItem(__pyx_kwds, __pyx_kp_X);
-      if (likely(values[0])) kw_args--;
-      else goto __pyx_L5_argtuple_error;
-      case  1:
-      values[1] = PyDict_GetItem(__pyx_kwds, __pyx_kp_VX);
-      if (likely(values[1])) kw_args--;
-      else {
-        __Pyx_RaiseArgtupleInvalid("mahalanobis", 1, 2, 2, 1); {__pyx_filename = __pyx_f[0]; __pyx_lineno = 84; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-      }
-    }
-    if (unlikely(kw_args > 0)) {
-      if (unlikely(__Pyx_ParseOptionalKeywords(__pyx_kwds, __pyx_pyargnames, 0, values, PyTuple_GET_SIZE(__pyx_args), "mahalanobis") < 0)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 84; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-    }
-    __pyx_v_X = values[0];
-    __pyx_v_VX = values[1];
-  } else if (PyTuple_GET_SIZE(__pyx_args) != 2) {
-    goto __pyx_L5_argtuple_error;
-  } else {
-    __pyx_v_X = PyTuple_GET_ITEM(__pyx_args, 0);
-    __pyx_v_VX = PyTuple_GET_ITEM(__pyx_args, 1);
-  }
-  goto __pyx_L4_argument_unpacking_done;
-  __pyx_L5_argtuple_error:;
-  __Pyx_RaiseArgtupleInvalid("mahalanobis", 1, 2, 2, PyTuple_GET_SIZE(__pyx_args)); {__pyx_filename = __pyx_f[0]; __pyx_lineno = 84; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-  __pyx_L3_error:;
-  __Pyx_AddTraceback("nipy.neurospin.utils.routines.mahalanobis");
-  return NULL;
-  __pyx_L4_argument_unpacking_done:;
-  __pyx_v_dims = Py_None; __Pyx_INCREF(Py_None);
-  __pyx_v_dim = Py_None; __Pyx_INCREF(Py_None);
-  __pyx_v_D2 = Py_None; __Pyx_INCREF(Py_None);
-  __pyx_v_VX_flat = Py_None; __Pyx_INCREF(Py_None);
-
-  /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\utils\routines.pyx":98
- *     cdef fff_matrix *Sx_tmp
- *     cdef fffpy_multi_iterator* multi
- *     cdef int axis=0, n             # <<<<<<<<<<<<<<
- * 
- *     # Allocate output array
- */
-  __pyx_v_axis = 0;
-
-  /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\utils\routines.pyx":101
- * 
- *     # Allocate output array
- *     dims = list(X.shape)             # <<<<<<<<<<<<<<
- *     dim = dims[0]
- *     dims[0] = 1
- */
-  __pyx_t_1 = PyObject_GetAttr(__pyx_v_X, __pyx_kp_shape); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 101; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_1);
-  __pyx_t_2 = PyTuple_New(1); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 101; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_2));
-  PyTuple_SET_ITEM(__pyx_t_2, 0, __pyx_t_1);
-  __Pyx_GIVEREF(__pyx_t_1);
-  __pyx_t_1 = 0;
-  __pyx_t_1 = PyObject_Call(((PyObject *)((PyObject*)&PyList_Type)), ((PyObject *)__pyx_t_2), NULL); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 101; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_1);
-  __Pyx_DECREF(((PyObject *)__pyx_t_2)); __pyx_t_2 = 0;
-  __Pyx_DECREF(__pyx_v_dims);
-  __pyx_v_dims = __pyx_t_1;
-  __pyx_t_1 = 0;
-
-  /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\utils\routines.pyx":102
- *     # Allocate output array
- *     dims = list(X.shape)
- *     dim = dims[0]             # <<<<<<<<<<<<<<
- *     dims[0] = 1
- *     D2 = np.zeros(dims)
- */
-  __pyx_1 = __Pyx_GetItemInt(__pyx_v_dims, 0, sizeof(long), PyInt_FromLong); if (!__pyx_1) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 102; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_1);
-  __Pyx_DECREF(__pyx_v_dim);
-  __pyx_v_dim = __pyx_1;
-  __pyx_1 = 0;
-
-  /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\utils\routines.pyx":103
- *     dims = list(X.shape)
- *     dim = dims[0]
- *     dims[0] = 1             # <<<<<<<<<<<<<<
- *     D2 = np.zeros(dims)
- * 
- */
-  if (__Pyx_SetItemInt(__pyx_v_dims, 0, __pyx_int_1, sizeof(long), PyInt_FromLong) < 0) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 103; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-
-  /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\utils\routines.pyx":104
- *     dim = dims[0]
- *     dims[0] = 1
- *     D2 = np.zeros(dims)             # <<<<<<<<<<<<<<
- * 
- *     # Flatten input variance array
- */
-  __pyx_1 = __Pyx_GetName(__pyx_m, __pyx_kp_np); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 104; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_1);
-  __pyx_t_1 = PyObject_GetAttr(__pyx_1, __pyx_kp_zeros); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 104; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_1);
-  __Pyx_DECREF(__pyx_1); __pyx_1 = 0;
-  __pyx_t_2 = PyTuple_New(1); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 104; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_2));
-  __Pyx_INCREF(__pyx_v_dims);
-  PyTuple_SET_ITEM(__pyx_t_2, 0, __pyx_v_dims);
-  __Pyx_GIVEREF(__pyx_v_dims);
-  __pyx_t_3 = PyObject_Call(__pyx_t_1, ((PyObject *)__pyx_t_2), NULL); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 104; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_3);
-  __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-  __Pyx_DECREF(((PyObject *)__pyx_t_2)); __pyx_t_2 = 0;
-  __Pyx_DECREF(__pyx_v_D2);
-  __pyx_v_D2 = __pyx_t_3;
-  __pyx_t_3 = 0;
-
-  /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\utils\routines.pyx":107
- * 
- *     # Flatten input variance array
- *     VX_flat = VX.reshape( [dim*dim]+list(VX.shape[2:]) )             # <<<<<<<<<<<<<<
- * 
- *     # Create a new array iterator
- */
-  __pyx_t_3 = PyObject_GetAttr(__pyx_v_VX, __pyx_kp_reshape); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 107; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_3);
-  __pyx_t_2 = PyNumber_Multiply(__pyx_v_dim, __pyx_v_dim); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 107; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_2);
-  __pyx_t_1 = PyList_New(1); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 107; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_1));
-  PyList_SET_ITEM(__pyx_t_1, 0, __pyx_t_2);
-  __Pyx_GIVEREF(__pyx_t_2);
-  __pyx_t_2 = 0;
-  __pyx_t_2 = PyObject_GetAttr(__pyx_v_VX, __pyx_kp_shape); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 107; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_2);
-  __pyx_1 = PySequence_GetSlice(__pyx_t_2, 2, PY_SSIZE_T_MAX); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 107; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_1);
-  __Pyx_DECREF(__pyx_t_2); __pyx_t_2 = 0;
-  __pyx_t_2 = PyTuple_New(1); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 107; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_2));
-  PyTuple_SET_ITEM(__pyx_t_2, 0, __pyx_1);
-  __Pyx_GIVEREF(__pyx_1);
-  __pyx_1 = 0;
-  __pyx_t_4 = PyObject_Call(((PyObject *)((PyObject*)&PyList_Type)), ((PyObject *)__pyx_t_2), NULL); if (unlikely(!__pyx_t_4)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 107; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_4);
-  __Pyx_DECREF(((PyObject *)__pyx_t_2)); __pyx_t_2 = 0;
-  __pyx_t_2 = PyNumber_Add(((PyObject *)__pyx_t_1), __pyx_t_4); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 107; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_2);
-  __Pyx_DECREF(((PyObject *)__pyx_t_1)); __pyx_t_1 = 0;
-  __Pyx_DECREF(__pyx_t_4); __pyx_t_4 = 0;
-  __pyx_t_4 = PyTuple_New(1); if (unlikely(!__pyx_t_4)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 107; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_4));
-  PyTuple_SET_ITEM(__pyx_t_4, 0, __pyx_t_2);
-  __Pyx_GIVEREF(__pyx_t_2);
-  __pyx_t_2 = 0;
-  __pyx_t_2 = PyObject_Call(__pyx_t_3, ((PyObject *)__pyx_t_4), NULL); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 107; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_2);
-  __Pyx_DECREF(__pyx_t_3); __pyx_t_3 = 0;
-  __Pyx_DECREF(((PyObject *)__pyx_t_4)); __pyx_t_4 = 0;
-  __Pyx_DECREF(__pyx_v_VX_flat);
-  __pyx_v_VX_flat = __pyx_t_2;
-  __pyx_t_2 = 0;
-
-  /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\utils\routines.pyx":110
- * 
- *     # Create a new array iterator
- *     multi = fffpy_multi_iterator_new(3, axis, <void*>X, <void*>VX_flat, <void*>D2)             # <<<<<<<<<<<<<<
- * 
- *     # Allocate local structures
- */
-  __pyx_v_multi = fffpy_multi_iterator_new(3, __pyx_v_axis, ((void *)__pyx_v_X), ((void *)__pyx_v_VX_flat), ((void *)__pyx_v_D2));
-
-  /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\utils\routines.pyx":113
- * 
- *     # Allocate local structures
- *     n = <int> X.shape[axis]             # <<<<<<<<<<<<<<
- *     x_tmp = fff_vector_new(n)
- *     vx_tmp = fff_vector_new(n*n)
- */
-  __pyx_t_2 = PyObject_GetAttr(__pyx_v_X, __pyx_kp_shape); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 113; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_2);
-  __pyx_1 = __Pyx_GetItemInt(__pyx_t_2, __pyx_v_axis, sizeof(int), PyInt_FromLong); if (!__pyx_1) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 113; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_1);
-  __Pyx_DECREF(__pyx_t_2); __pyx_t_2 = 0;
-  __pyx_t_5 = __Pyx_PyInt_AsInt(__pyx_1); if (unlikely((__pyx_t_5 == (int)-1) && PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 113; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_DECREF(__pyx_1); __pyx_1 = 0;
-  __pyx_v_n = ((int)__pyx_t_5);
-
-  /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\utils\routines.pyx":114
- *     # Allocate local structures
- *     n = <int> X.shape[axis]
- *     x_tmp = fff_vector_new(n)             # <<<<<<<<<<<<<<
- *     vx_tmp = fff_vector_new(n*n)
- *     Sx_tmp = fff_matrix_new(n, n)
- */
-  __pyx_v_x_tmp = fff_vector_new(__pyx_v_n);
-
-  /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\utils\routines.pyx":115
- *     n = <int> X.shape[axis]
- *     x_tmp = fff_vector_new(n)
- *     vx_tmp = fff_vector_new(n*n)             # <<<<<<<<<<<<<<
- *     Sx_tmp = fff_matrix_new(n, n)
- * 
- */
-  __pyx_v_vx_tmp = fff_vector_new((__pyx_v_n * __pyx_v_n));
-
-  /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\utils\routines.pyx":116
- *     x_tmp = fff_vector_new(n)
- *     vx_tmp = fff_vector_new(n*n)
- *     Sx_tmp = fff_matrix_new(n, n)             # <<<<<<<<<<<<<<
- * 
- *     # Create vector views on X, VX_flat and D2
- */
-  __pyx_v_Sx_tmp = fff_matrix_new(__pyx_v_n, __pyx_v_n);
-
-  /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\utils\routines.pyx":119
- * 
- *     # Create vector views on X, VX_flat and D2
- *     x = multi.vector[0]             # <<<<<<<<<<<<<<
- *     vx = multi.vector[1]
- *     d2 = multi.vector[2]
- */
-  __pyx_v_x = (__pyx_v_multi->vector[0]);
-
-  /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\utils\routines.pyx":120
- *     # Create vector views on X, VX_flat and D2
- *     x = multi.vector[0]
- *     vx = multi.vector[1]             # <<<<<<<<<<<<<<
- *     d2 = multi.vector[2]
- * 
- */
-  __pyx_v_vx = (__pyx_v_multi->vector[1]);
-
-  /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\utils\routines.pyx":121
- *     x = multi.vector[0]
- *     vx = multi.vector[1]
- *     d2 = multi.vector[2]             # <<<<<<<<<<<<<<
- * 
- *     # Loop
- */
-  __pyx_v_d2 = (__pyx_v_multi->vector[2]);
-
-  /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\utils\routines.pyx":124
- * 
- *     # Loop
- *     while(multi.index < multi.size):             # <<<<<<<<<<<<<<
- *         fff_vector_memcpy(x_tmp, x)
- *         fff_vector_memcpy(vx_tmp, vx)
- */
-  while (1) {
-    __pyx_t_6 = (__pyx_v_multi->index < __pyx_v_multi->size);
-    if (!__pyx_t_6) break;
-
-    /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\utils\routines.pyx":125
- *     # Loop
- *     while(multi.index < multi.size):
- *         fff_vector_memcpy(x_tmp, x)             # <<<<<<<<<<<<<<
- *         fff_vector_memcpy(vx_tmp, vx)
- *         Sx = fff_matrix_view(vx_tmp.data, n, n, n) # OK because vx_tmp is contiguous
- */
-    fff_vector_memcpy(__pyx_v_x_tmp, __pyx_v_x);
-
-    /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\utils\routines.pyx":126
- *     while(multi.index < multi.size):
- *         fff_vector_memcpy(x_tmp, x)
- *         fff_vector_memcpy(vx_tmp, vx)             # <<<<<<<<<<<<<<
- *         Sx = fff_matrix_view(vx_tmp.data, n, n, n) # OK because vx_tmp is contiguous
- *         d2.data[0] = fff_mahalanobis(x_tmp, &Sx, Sx_tmp)
- */
-    fff_vector_memcpy(__pyx_v_vx_tmp, __pyx_v_vx);
-
-    /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\utils\routines.pyx":127
- *         fff_vector_memcpy(x_tmp, x)
- *         fff_vector_memcpy(vx_tmp, vx)
- *         Sx = fff_matrix_view(vx_tmp.data, n, n, n) # OK because vx_tmp is contiguous             # <<<<<<<<<<<<<<
- *         d2.data[0] = fff_mahalanobis(x_tmp, &Sx, Sx_tmp)
- *         fffpy_multi_iterator_update(multi)
- */
-    __pyx_v_Sx = fff_matrix_view(__pyx_v_vx_tmp->data, __pyx_v_n, __pyx_v_n, __pyx_v_n);
-
-    /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\utils\routines.pyx":128
- *         fff_vector_memcpy(vx_tmp, vx)
- *         Sx = fff_matrix_view(vx_tmp.data, n, n, n) # OK because vx_tmp is contiguous
- *         d2.data[0] = fff_mahalanobis(x_tmp, &Sx, Sx_tmp)             # <<<<<<<<<<<<<<
- *         fffpy_multi_iterator_update(multi)
- * 
- */
-    (__pyx_v_d2->data[0]) = fff_mahalanobis(__pyx_v_x_tmp, (&__pyx_v_Sx), __pyx_v_Sx_tmp);
-
-    /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\utils\routines.pyx":129
- *         Sx = fff_matrix_view(vx_tmp.data, n, n, n) # OK because vx_tmp is contiguous
- *         d2.data[0] = fff_mahalanobis(x_tmp, &Sx, Sx_tmp)
- *         fffpy_multi_iterator_update(multi)             # <<<<<<<<<<<<<<
- * 
- *     # Delete local structs and views
- */
-    fffpy_multi_iterator_update(__pyx_v_multi);
-  }
-
-  /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\utils\routines.pyx":132
- * 
- *     # Delete local structs and views
- *     fff_vector_delete(x_tmp)             # <<<<<<<<<<<<<<
- *     fff_vector_delete(vx_tmp)
- *     fff_matrix_delete(Sx_tmp)
- */
-  fff_vector_delete(__pyx_v_x_tmp);
-
-  /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\utils\routines.pyx":133
- *     # Delete local structs and views
- *     fff_vector_delete(x_tmp)
- *     fff_vector_delete(vx_tmp)             # <<<<<<<<<<<<<<
- *     fff_matrix_delete(Sx_tmp)
- *     fffpy_multi_iterator_delete(multi)
- */
-  fff_vector_delete(__pyx_v_vx_tmp);
-
-  /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\utils\routines.pyx":134
- *     fff_vector_delete(x_tmp)
- *     fff_vector_delete(vx_tmp)
- *     fff_matrix_delete(Sx_tmp)             # <<<<<<<<<<<<<<
- *     fffpy_multi_iterator_delete(multi)
- * 
- */
-  fff_matrix_delete(__pyx_v_Sx_tmp);
-
-  /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\utils\routines.pyx":135
- *     fff_vector_delete(vx_tmp)
- *     fff_matrix_delete(Sx_tmp)
- *     fffpy_multi_iterator_delete(multi)             # <<<<<<<<<<<<<<
- * 
- *     # Return
- */
-  fffpy_multi_iterator_delete(__pyx_v_multi);
-
-  /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\utils\routines.pyx":138
- * 
- *     # Return
- *     D2 = D2.reshape(VX.shape[2:])             # <<<<<<<<<<<<<<
- *     return D2
- * 
- */
-  __pyx_t_2 = PyObject_GetAttr(__pyx_v_D2, __pyx_kp_reshape); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 138; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_2);
-  __pyx_t_4 = PyObject_GetAttr(__pyx_v_VX, __pyx_kp_shape); if (unlikely(!__pyx_t_4)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 138; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_4);
-  __pyx_1 = PySequence_GetSlice(__pyx_t_4, 2, PY_SSIZE_T_MAX); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 138; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_1);
-  __Pyx_DECREF(__pyx_t_4); __pyx_t_4 = 0;
-  __pyx_t_4 = PyTuple_New(1); if (unlikely(!__pyx_t_4)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 138; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_4));
-  PyTuple_SET_ITEM(__pyx_t_4, 0, __pyx_1);
-  __Pyx_GIVEREF(__pyx_1);
-  __pyx_1 = 0;
-  __pyx_t_3 = PyObject_Call(__pyx_t_2, ((PyObject *)__pyx_t_4), NULL); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 138; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_3);
-  __Pyx_DECREF(__pyx_t_2); __pyx_t_2 = 0;
-  __Pyx_DECREF(((PyObject *)__pyx_t_4)); __pyx_t_4 = 0;
-  __Pyx_DECREF(__pyx_v_D2);
-  __pyx_v_D2 = __pyx_t_3;
-  __pyx_t_3 = 0;
-
-  /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\utils\routines.pyx":139
- *     # Return
- *     D2 = D2.reshape(VX.shape[2:])
- *     return D2             # <<<<<<<<<<<<<<
- * 
- * 
- */
-  __Pyx_XDECREF(__pyx_r);
-  __Pyx_INCREF(__pyx_v_D2);
-  __pyx_r = __pyx_v_D2;
-  goto __pyx_L0;
-
-  __pyx_r = Py_None; __Pyx_INCREF(Py_None);
-  goto __pyx_L0;
-  __pyx_L1_error:;
-  __Pyx_XDECREF(__pyx_1);
-  __Pyx_XDECREF(__pyx_t_1);
-  __Pyx_XDECREF(__pyx_t_2);
-  __Pyx_XDECREF(__pyx_t_3);
-  __Pyx_XDECREF(__pyx_t_4);
-  __Pyx_AddTraceback("nipy.neurospin.utils.routines.mahalanobis");
-  __pyx_r = NULL;
-  __pyx_L0:;
-  __Pyx_DECREF(__pyx_v_dims);
-  __Pyx_DECREF(__pyx_v_dim);
-  __Pyx_DECREF(__pyx_v_D2);
-  __Pyx_DECREF(__pyx_v_VX_flat);
-  __Pyx_XGIVEREF(__pyx_r);
-  __Pyx_FinishRefcountContext();
-  return __pyx_r;
-}
-
-/* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\utils\routines.pyx":142
- * 
- * 
- * def svd(X):             # <<<<<<<<<<<<<<
- *     """
- *     Y = svd(X)
- */
-
-static PyObject *__pyx_pf_4nipy_9neurospin_5utils_8routines_svd(PyObject *__pyx_self, PyObject *__pyx_v_X); /*proto*/
-static char __pyx_doc_4nipy_9neurospin_5utils_8routines_svd[] = "\n    Y = svd(X)\n\n    ufunc-like svd. Given an array X (m, n, K), perform an SVD\n    decomposition.\n    \n    Returns: \n    S (min(m,n), K)\n    U (m, m, K)\n    Vt (n, n, K) \n    ";
-static PyObject *__pyx_pf_4nipy_9neurospin_5utils_8routines_svd(PyObject *__pyx_self, PyObject *__pyx_v_X) {
-  int __pyx_v_axis;
-  int __pyx_v_m;
-  int __pyx_v_n;
-  int __pyx_v_dmin;
-  int __pyx_v_dmax;
-  int __pyx_v_lwork;
-  int __pyx_v_liwork;
-  int __pyx_v_info;
-  fff_vector *__pyx_v_work;
-  fff_vector *__pyx_v_x_flat;
-  fff_vector *__pyx_v_x_flat_tmp;
-  fff_vector *__pyx_v_s;
-  fff_vector *__pyx_v_s_tmp;
-  fff_matrix __pyx_v_x;
-  fff_array *__pyx_v_iwork;
-  fff_matrix *__pyx_v_Aux;
-  fff_matrix *__pyx_v_U;
-  fff_matrix *__pyx_v_Vt;
-  fffpy_multi_iterator *__pyx_v_multi;
-  PyObject *__pyx_v_endims;
-  PyObject *__pyx_v_S;
-  PyObject *__pyx_v_X_flat;
-  PyObject *__pyx_r = NULL;
-  PyObject *__pyx_1 = 0;
-  PyObject *__pyx_t_1 = NULL;
-  int __pyx_t_2;
-  int __pyx_t_3;
-  PyObject *__pyx_t_4 = NULL;
-  PyObject *__pyx_t_5 = NULL;
-  __Pyx_SetupRefcountContext("svd");
-  __pyx_self = __pyx_self;
-  __pyx_v_endims = Py_None; __Pyx_INCREF(Py_None);
-  __pyx_v_S = Py_None; __Pyx_INCREF(Py_None);
-  __pyx_v_X_flat = Py_None; __Pyx_INCREF(Py_None);
-
-  /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\utils\routines.pyx":154
- *     Vt (n, n, K)
- *     """
- *     cdef int axis=0             # <<<<<<<<<<<<<<
- *     cdef int m, n, dmin, dmax, lwork, liwork, info
- *     cdef fff_vector *work, *x_flat, *x_flat_tmp, *s, *s_tmp
- */
-  __pyx_v_axis = 0;
-
-  /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\utils\routines.pyx":163
- * 
- *     # Shape of matrices
- *     m = <int> X.shape[0]             # <<<<<<<<<<<<<<
- *     n = <int> X.shape[1]
- *     if m > n:
- */
-  __pyx_t_1 = PyObject_GetAttr(__pyx_v_X, __pyx_kp_shape); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 163; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_1);
-  __pyx_1 = __Pyx_GetItemInt(__pyx_t_1, 0, sizeof(long), PyInt_FromLong); if (!__pyx_1) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 163; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_1);
-  __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-  __pyx_t_2 = __Pyx_PyInt_AsInt(__pyx_1); if (unlikely((__pyx_t_2 == (int)-1) && PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 163; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_DECREF(__pyx_1); __pyx_1 = 0;
-  __pyx_v_m = ((int)__pyx_t_2);
-
-  /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\utils\routines.pyx":164
- *     # Shape of matrices
- *     m = <int> X.shape[0]
- *     n = <int> X.shape[1]             # <<<<<<<<<<<<<<
- *     if m > n:
- *         dmin = n
- */
-  __pyx_t_1 = PyObject_GetAttr(__pyx_v_X, __pyx_kp_shape); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 164; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_1);
-  __pyx_1 = __Pyx_GetItemInt(__pyx_t_1, 1, sizeof(long), PyInt_FromLong); if (!__pyx_1) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 164; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_1);
-  __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-  __pyx_t_2 = __Pyx_PyInt_AsInt(__pyx_1); if (unlikely((__pyx_t_2 == (int)-1) && PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 164; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_DECREF(__pyx_1); __pyx_1 = 0;
-  __pyx_v_n = ((int)__pyx_t_2);
-
-  /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\utils\routines.pyx":165
- *     m = <int> X.shape[0]
- *     n = <int> X.shape[1]
- *     if m > n:             # <<<<<<<<<<<<<<
- *         dmin = n
- *         dmax = m
- */
-  __pyx_t_3 = (__pyx_v_m > __pyx_v_n);
-  if (__pyx_t_3) {
-
-    /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\utils\routines.pyx":166
- *     n = <int> X.shape[1]
- *     if m > n:
- *         dmin = n             # <<<<<<<<<<<<<<
- *         dmax = m
- *     else:
- */
-    __pyx_v_dmin = __pyx_v_n;
-
-    /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\utils\routines.pyx":167
- *     if m > n:
- *         dmin = n
- *         dmax = m             # <<<<<<<<<<<<<<
- *     else:
- *         dmin = m
- */
-    __pyx_v_dmax = __pyx_v_m;
-    goto __pyx_L5;
-  }
-  /*else*/ {
-
-    /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\utils\routines.pyx":169
- *         dmax = m
- *     else:
- *         dmin = m             # <<<<<<<<<<<<<<
- *         dmax = n
- * 
- */
-    __pyx_v_dmin = __pyx_v_m;
-
-    /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\utils\routines.pyx":170
- *     else:
- *         dmin = m
- *         dmax = n             # <<<<<<<<<<<<<<
- * 
- *     # Create auxiliary arrays
- */
-    __pyx_v_dmax = __pyx_v_n;
-  }
-  __pyx_L5:;
-
-  /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\utils\routines.pyx":173
- * 
- *     # Create auxiliary arrays
- *     lwork = 4*dmin*(dmin+1)             # <<<<<<<<<<<<<<
- *     if dmax > lwork:
- *         lwork = dmax
- */
-  __pyx_v_lwork = ((4 * __pyx_v_dmin) * (__pyx_v_dmin + 1));
-
-  /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\utils\routines.pyx":174
- *     # Create auxiliary arrays
- *     lwork = 4*dmin*(dmin+1)
- *     if dmax > lwork:             # <<<<<<<<<<<<<<
- *         lwork = dmax
- *     lwork = 2*(3*dmin*dmin + lwork)
- */
-  __pyx_t_3 = (__pyx_v_dmax > __pyx_v_lwork);
-  if (__pyx_t_3) {
-
-    /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\utils\routines.pyx":175
- *     lwork = 4*dmin*(dmin+1)
- *     if dmax > lwork:
- *         lwork = dmax             # <<<<<<<<<<<<<<
- *     lwork = 2*(3*dmin*dmin + lwork)
- *     liwork = 8*dmin
- */
-    __pyx_v_lwork = __pyx_v_dmax;
-    goto __pyx_L6;
-  }
-  __pyx_L6:;
-
-  /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\utils\routines.pyx":176
- *     if dmax > lwork:
- *         lwork = dmax
- *     lwork = 2*(3*dmin*dmin + lwork)             # <<<<<<<<<<<<<<
- *     liwork = 8*dmin
- *     work = fff_vector_new(lwork)
- */
-  __pyx_v_lwork = (2 * (((3 * __pyx_v_dmin) * __pyx_v_dmin) + __pyx_v_lwork));
-
-  /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\utils\routines.pyx":177
- *         lwork = dmax
- *     lwork = 2*(3*dmin*dmin + lwork)
- *     liwork = 8*dmin             # <<<<<<<<<<<<<<
- *     work = fff_vector_new(lwork)
- *     iwork = fff_array_new1d(FFF_INT, liwork)
- */
-  __pyx_v_liwork = (8 * __pyx_v_dmin);
-
-  /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\utils\routines.pyx":178
- *     lwork = 2*(3*dmin*dmin + lwork)
- *     liwork = 8*dmin
- *     work = fff_vector_new(lwork)             # <<<<<<<<<<<<<<
- *     iwork = fff_array_new1d(FFF_INT, liwork)
- *     Aux = fff_matrix_new(dmax, dmax)
- */
-  __pyx_v_work = fff_vector_new(__pyx_v_lwork);
-
-  /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\utils\routines.pyx":179
- *     liwork = 8*dmin
- *     work = fff_vector_new(lwork)
- *     iwork = fff_array_new1d(FFF_INT, liwork)             # <<<<<<<<<<<<<<
- *     Aux = fff_matrix_new(dmax, dmax)
- *     U = fff_matrix_new(m, m)
- */
-  __pyx_v_iwork = fff_array_new1d(FFF_INT, __pyx_v_liwork);
-
-  /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\utils\routines.pyx":180
- *     work = fff_vector_new(lwork)
- *     iwork = fff_array_new1d(FFF_INT, liwork)
- *     Aux = fff_matrix_new(dmax, dmax)             # <<<<<<<<<<<<<<
- *     U = fff_matrix_new(m, m)
- *     Vt = fff_matrix_new(n, n)
- */
-  __pyx_v_Aux = fff_matrix_new(__pyx_v_dmax, __pyx_v_dmax);
-
-  /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\utils\routines.pyx":181
- *     iwork = fff_array_new1d(FFF_INT, liwork)
- *     Aux = fff_matrix_new(dmax, dmax)
- *     U = fff_matrix_new(m, m)             # <<<<<<<<<<<<<<
- *     Vt = fff_matrix_new(n, n)
- *     x_flat_tmp = fff_vector_new(m*n)
- */
-  __pyx_v_U = fff_matrix_new(__pyx_v_m, __pyx_v_m);
-
-  /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\utils\routines.pyx":182
- *     Aux = fff_matrix_new(dmax, dmax)
- *     U = fff_matrix_new(m, m)
- *     Vt = fff_matrix_new(n, n)             # <<<<<<<<<<<<<<
- *     x_flat_tmp = fff_vector_new(m*n)
- *     s_tmp = fff_vector_new(dmin)
- */
-  __pyx_v_Vt = fff_matrix_new(__pyx_v_n, __pyx_v_n);
-
-  /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\utils\routines.pyx":183
- *     U = fff_matrix_new(m, m)
- *     Vt = fff_matrix_new(n, n)
- *     x_flat_tmp = fff_vector_new(m*n)             # <<<<<<<<<<<<<<
- *     s_tmp = fff_vector_new(dmin)
- * 
- */
-  __pyx_v_x_flat_tmp = fff_vector_new((__pyx_v_m * __pyx_v_n));
-
-  /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\utils\routines.pyx":184
- *     Vt = fff_matrix_new(n, n)
- *     x_flat_tmp = fff_vector_new(m*n)
- *     s_tmp = fff_vector_new(dmin)             # <<<<<<<<<<<<<<
- * 
- *     # Allocate output array
- */
-  __pyx_v_s_tmp = fff_vector_new(__pyx_v_dmin);
-
-  /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\utils\routines.pyx":187
- * 
- *     # Allocate output array
- *     endims = list(X.shape[2:])             # <<<<<<<<<<<<<<
- *     S = np.zeros([dmin]+endims)
- * 
- */
-  __pyx_t_1 = PyObject_GetAttr(__pyx_v_X, __pyx_kp_shape); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 187; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_1);
-  __pyx_1 = PySequence_GetSlice(__pyx_t_1, 2, PY_SSIZE_T_MAX); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 187; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_1);
-  __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-  __pyx_t_1 = PyTuple_New(1); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 187; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_1));
-  PyTuple_SET_ITEM(__pyx_t_1, 0, __pyx_1);
-  __Pyx_GIVEREF(__pyx_1);
-  __pyx_1 = 0;
-  __pyx_t_4 = PyObject_Call(((PyObject *)((PyObject*)&PyList_Type)), ((PyObject *)__pyx_t_1), NULL); if (unlikely(!__pyx_t_4)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 187; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_4);
-  __Pyx_DECREF(((PyObject *)__pyx_t_1)); __pyx_t_1 = 0;
-  __Pyx_DECREF(__pyx_v_endims);
-  __pyx_v_endims = __pyx_t_4;
-  __pyx_t_4 = 0;
-
-  /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\utils\routines.pyx":188
- *     # Allocate output array
- *     endims = list(X.shape[2:])
- *     S = np.zeros([dmin]+endims)             # <<<<<<<<<<<<<<
- * 
- *     # Flatten input array
- */
-  __pyx_1 = __Pyx_GetName(__pyx_m, __pyx_kp_np); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 188; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_1);
-  __pyx_t_4 = PyObject_GetAttr(__pyx_1, __pyx_kp_zeros); if (unlikely(!__pyx_t_4)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 188; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_4);
-  __Pyx_DECREF(__pyx_1); __pyx_1 = 0;
-  __pyx_t_1 = PyInt_FromLong(__pyx_v_dmin); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 188; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_1);
-  __pyx_t_5 = PyList_New(1); if (unlikely(!__pyx_t_5)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 188; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_5));
-  PyList_SET_ITEM(__pyx_t_5, 0, __pyx_t_1);
-  __Pyx_GIVEREF(__pyx_t_1);
-  __pyx_t_1 = 0;
-  __pyx_t_1 = PyNumber_Add(((PyObject *)__pyx_t_5), __pyx_v_endims); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 188; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_1);
-  __Pyx_DECREF(((PyObject *)__pyx_t_5)); __pyx_t_5 = 0;
-  __pyx_t_5 = PyTuple_New(1); if (unlikely(!__pyx_t_5)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 188; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_5));
-  PyTuple_SET_ITEM(__pyx_t_5, 0, __pyx_t_1);
-  __Pyx_GIVEREF(__pyx_t_1);
-  __pyx_t_1 = 0;
-  __pyx_t_1 = PyObject_Call(__pyx_t_4, ((PyObject *)__pyx_t_5), NULL); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 188; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_1);
-  __Pyx_DECREF(__pyx_t_4); __pyx_t_4 = 0;
-  __Pyx_DECREF(((PyObject *)__pyx_t_5)); __pyx_t_5 = 0;
-  __Pyx_DECREF(__pyx_v_S);
-  __pyx_v_S = __pyx_t_1;
-  __pyx_t_1 = 0;
-
-  /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\utils\routines.pyx":191
- * 
- *     # Flatten input array
- *     X_flat = X.reshape([m*n]+endims)             # <<<<<<<<<<<<<<
- * 
- *     # Create a new array iterator
- */
-  __pyx_t_1 = PyObject_GetAttr(__pyx_v_X, __pyx_kp_reshape); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 191; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_1);
-  __pyx_t_5 = PyInt_FromLong((__pyx_v_m * __pyx_v_n)); if (unlikely(!__pyx_t_5)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 191; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_5);
-  __pyx_t_4 = PyList_New(1); if (unlikely(!__pyx_t_4)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 191; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_4));
-  PyList_SET_ITEM(__pyx_t_4, 0, __pyx_t_5);
-  __Pyx_GIVEREF(__pyx_t_5);
-  __pyx_t_5 = 0;
-  __pyx_t_5 = PyNumber_Add(((PyObject *)__pyx_t_4), __pyx_v_endims); if (unlikely(!__pyx_t_5)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 191; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_5);
-  __Pyx_DECREF(((PyObject *)__pyx_t_4)); __pyx_t_4 = 0;
-  __pyx_t_4 = PyTuple_New(1); if (unlikely(!__pyx_t_4)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 191; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_4));
-  PyTuple_SET_ITEM(__pyx_t_4, 0, __pyx_t_5);
-  __Pyx_GIVEREF(__pyx_t_5);
-  __pyx_t_5 = 0;
-  __pyx_t_5 = PyObject_Call(__pyx_t_1, ((PyObject *)__pyx_t_4), NULL); if (unlikely(!__pyx_t_5)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 191; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_5);
-  __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-  __Pyx_DECREF(((PyObject *)__pyx_t_4)); __pyx_t_4 = 0;
-  __Pyx_DECREF(__pyx_v_X_flat);
-  __pyx_v_X_flat = __pyx_t_5;
-  __pyx_t_5 = 0;
-
-  /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\utils\routines.pyx":194
- * 
- *     # Create a new array iterator
- *     multi = fffpy_multi_iterator_new(2, axis, <void*>X_flat, <void*>S)             # <<<<<<<<<<<<<<
- * 
- *     # Create vector views
- */
-  __pyx_v_multi = fffpy_multi_iterator_new(2, __pyx_v_axis, ((void *)__pyx_v_X_flat), ((void *)__pyx_v_S));
-
-  /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\utils\routines.pyx":197
- * 
- *     # Create vector views
- *     x_flat = multi.vector[0]             # <<<<<<<<<<<<<<
- *     s = multi.vector[1]
- * 
- */
-  __pyx_v_x_flat = (__pyx_v_multi->vector[0]);
-
-  /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\utils\routines.pyx":198
- *     # Create vector views
- *     x_flat = multi.vector[0]
- *     s = multi.vector[1]             # <<<<<<<<<<<<<<
- * 
- *     # Loop
- */
-  __pyx_v_s = (__pyx_v_multi->vector[1]);
-
-  /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\utils\routines.pyx":201
- * 
- *     # Loop
- *     while(multi.index < multi.size):             # <<<<<<<<<<<<<<
- *         fff_vector_memcpy(x_flat_tmp, x_flat)
- *         fff_vector_memcpy(s_tmp, s)
- */
-  while (1) {
-    __pyx_t_3 = (__pyx_v_multi->index < __pyx_v_multi->size);
-    if (!__pyx_t_3) break;
-
-    /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\utils\routines.pyx":202
- *     # Loop
- *     while(multi.index < multi.size):
- *         fff_vector_memcpy(x_flat_tmp, x_flat)             # <<<<<<<<<<<<<<
- *         fff_vector_memcpy(s_tmp, s)
- *         x = fff_matrix_view(x_flat_tmp.data, m, n, n) # OK because x_flat_tmp is contiguous
- */
-    fff_vector_memcpy(__pyx_v_x_flat_tmp, __pyx_v_x_flat);
-
-    /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\utils\routines.pyx":203
- *     while(multi.index < multi.size):
- *         fff_vector_memcpy(x_flat_tmp, x_flat)
- *         fff_vector_memcpy(s_tmp, s)             # <<<<<<<<<<<<<<
- *         x = fff_matrix_view(x_flat_tmp.data, m, n, n) # OK because x_flat_tmp is contiguous
- *         info = fff_lapack_dgesdd(&x, s_tmp, U, Vt, work, iwork, Aux )
- */
-    fff_vector_memcpy(__pyx_v_s_tmp, __pyx_v_s);
-
-    /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\utils\routines.pyx":204
- *         fff_vector_memcpy(x_flat_tmp, x_flat)
- *         fff_vector_memcpy(s_tmp, s)
- *         x = fff_matrix_view(x_flat_tmp.data, m, n, n) # OK because x_flat_tmp is contiguous             # <<<<<<<<<<<<<<
- *         info = fff_lapack_dgesdd(&x, s_tmp, U, Vt, work, iwork, Aux )
- *         fff_vector_memcpy(s, s_tmp)
- */
-    __pyx_v_x = fff_matrix_view(__pyx_v_x_flat_tmp->data, __pyx_v_m, __pyx_v_n, __pyx_v_n);
-
-    /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\utils\routines.pyx":205
- *         fff_vector_memcpy(s_tmp, s)
- *         x = fff_matrix_view(x_flat_tmp.data, m, n, n) # OK because x_flat_tmp is contiguous
- *         info = fff_lapack_dgesdd(&x, s_tmp, U, Vt, work, iwork, Aux )             # <<<<<<<<<<<<<<
- *         fff_vector_memcpy(s, s_tmp)
- *         fffpy_multi_iterator_update(multi)
- */
-    __pyx_v_info = fff_lapack_dgesdd((&__pyx_v_x), __pyx_v_s_tmp, __pyx_v_U, __pyx_v_Vt, __pyx_v_work, __pyx_v_iwork, __pyx_v_Aux);
-
-    /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\utils\routines.pyx":206
- *         x = fff_matrix_view(x_flat_tmp.data, m, n, n) # OK because x_flat_tmp is contiguous
- *         info = fff_lapack_dgesdd(&x, s_tmp, U, Vt, work, iwork, Aux )
- *         fff_vector_memcpy(s, s_tmp)             # <<<<<<<<<<<<<<
- *         fffpy_multi_iterator_update(multi)
- * 
- */
-    fff_vector_memcpy(__pyx_v_s, __pyx_v_s_tmp);
-
-    /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\utils\routines.pyx":207
- *         info = fff_lapack_dgesdd(&x, s_tmp, U, Vt, work, iwork, Aux )
- *         fff_vector_memcpy(s, s_tmp)
- *         fffpy_multi_iterator_update(multi)             # <<<<<<<<<<<<<<
- * 
- *     # Delete local structures
- */
-    fffpy_multi_iterator_update(__pyx_v_multi);
-  }
-
-  /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\utils\routines.pyx":210
- * 
- *     # Delete local structures
- *     fff_vector_delete(work)             # <<<<<<<<<<<<<<
- *     fff_vector_delete(x_flat_tmp)
- *     fff_vector_delete(s_tmp)
- */
-  fff_vector_delete(__pyx_v_work);
-
-  /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\utils\routines.pyx":211
- *     # Delete local structures
- *     fff_vector_delete(work)
- *     fff_vector_delete(x_flat_tmp)             # <<<<<<<<<<<<<<
- *     fff_vector_delete(s_tmp)
- *     fff_array_delete(iwork)
- */
-  fff_vector_delete(__pyx_v_x_flat_tmp);
-
-  /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\utils\routines.pyx":212
- *     fff_vector_delete(work)
- *     fff_vector_delete(x_flat_tmp)
- *     fff_vector_delete(s_tmp)             # <<<<<<<<<<<<<<
- *     fff_array_delete(iwork)
- *     fff_matrix_delete(Aux)
- */
-  fff_vector_delete(__pyx_v_s_tmp);
-
-  /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\utils\routines.pyx":213
- *     fff_vector_delete(x_flat_tmp)
- *     fff_vector_delete(s_tmp)
- *     fff_array_delete(iwork)             # <<<<<<<<<<<<<<
- *     fff_matrix_delete(Aux)
- *     fff_matrix_delete(U)
- */
-  fff_array_delete(__pyx_v_iwork);
-
-  /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\utils\routines.pyx":214
- *     fff_vector_delete(s_tmp)
- *     fff_array_delete(iwork)
- *     fff_matrix_delete(Aux)             # <<<<<<<<<<<<<<
- *     fff_matrix_delete(U)
- *     fff_matrix_delete(Vt)
- */
-  fff_matrix_delete(__pyx_v_Aux);
-
-  /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\utils\routines.pyx":215
- *     fff_array_delete(iwork)
- *     fff_matrix_delete(Aux)
- *     fff_matrix_delete(U)             # <<<<<<<<<<<<<<
- *     fff_matrix_delete(Vt)
- *     fffpy_multi_iterator_delete(multi)
- */
-  fff_matrix_delete(__pyx_v_U);
-
-  /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\utils\routines.pyx":216
- *     fff_matrix_delete(Aux)
- *     fff_matrix_delete(U)
- *     fff_matrix_delete(Vt)             # <<<<<<<<<<<<<<
- *     fffpy_multi_iterator_delete(multi)
- * 
- */
-  fff_matrix_delete(__pyx_v_Vt);
-
-  /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\utils\routines.pyx":217
- *     fff_matrix_delete(U)
- *     fff_matrix_delete(Vt)
- *     fffpy_multi_iterator_delete(multi)             # <<<<<<<<<<<<<<
- * 
- *     # Return
- */
-  fffpy_multi_iterator_delete(__pyx_v_multi);
-
-  /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\utils\routines.pyx":220
- * 
- *     # Return
- *     return S             # <<<<<<<<<<<<<<
- * 
- * 
- */
-  __Pyx_XDECREF(__pyx_r);
-  __Pyx_INCREF(__pyx_v_S);
-  __pyx_r = __pyx_v_S;
-  goto __pyx_L0;
-
-  __pyx_r = Py_None; __Pyx_INCREF(Py_None);
-  goto __pyx_L0;
-  __pyx_L1_error:;
-  __Pyx_XDECREF(__pyx_1);
-  __Pyx_XDECREF(__pyx_t_1);
-  __Pyx_XDECREF(__pyx_t_4);
-  __Pyx_XDECREF(__pyx_t_5);
-  __Pyx_AddTraceback("nipy.neurospin.utils.routines.svd");
-  __pyx_r = NULL;
-  __pyx_L0:;
-  __Pyx_DECREF(__pyx_v_endims);
-  __Pyx_DECREF(__pyx_v_S);
-  __Pyx_DECREF(__pyx_v_X_flat);
-  __Pyx_XGIVEREF(__pyx_r);
-  __Pyx_FinishRefcountContext();
-  return __pyx_r;
-}
-
-/* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\utils\routines.pyx":223
- * 
- * 
- * def permutations(unsigned int n, unsigned int m=1, unsigned long magic=0):             # <<<<<<<<<<<<<<
- *     """
- *     P = permutations(n, m=1, magic=0).
- */
-
-static PyObject *__pyx_pf_4nipy_9neurospin_5utils_8routines_permutations(PyObject *__pyx_self, PyObject *__pyx_args, PyObject *__pyx_kwds); /*proto*/
-static char __pyx_doc_4nipy_9neurospin_5utils_8routines_permutations[] = "\n    P = permutations(n, m=1, magic=0).\n    Generate m permutations from [0..n[.\n    ";
-static PyObject *__pyx_pf_4nipy_9neurospin_5utils_8routines_permutations(PyObject *__pyx_self, PyObject *__pyx_args, PyObject *__pyx_kwds) {
-  unsigned int __pyx_v_n;
-  unsigned int __pyx_v_m;
-  unsigned long __pyx_v_magic;
-  fff_array *__pyx_v_p;
-  fff_array *__pyx_v_pi;
-  fff_array __pyx_v_pi_view;
-  unsigned int __pyx_v_i;
-  PyObject *__pyx_v_P;
-  PyObject *__pyx_r = NULL;
-  unsigned int __pyx_t_1;
-  PyObject *__pyx_t_2 = NULL;
-  static PyObject **__pyx_pyargnames[] = {&__pyx_kp_n,&__pyx_kp_m,&__pyx_kp_magic,0};
-  __Pyx_SetupRefcountContext("permutations");
-  __pyx_self = __pyx_self;
-  if (unlikely(__pyx_kwds)) {
-    Py_ssize_t kw_args = PyDict_Size(__pyx_kwds);
-    PyObject* values[3] = {0,0,0};
-    switch (PyTuple_GET_SIZE(__pyx_args)) {
-      case  3: values[2] = PyTuple_GET_ITEM(__pyx_args, 2);
-      case  2: values[1] = PyTuple_GET_ITEM(__pyx_args, 1);
-      case  1: values[0] = PyTuple_GET_ITEM(__pyx_args, 0);
-      case  0: break;
-      default: goto __pyx_L5_argtuple_error;
-    }
-    switch (PyTuple_GET_SIZE(__pyx_args)) {
-      case  0:
-      values[0] = PyDict_GetItem(__pyx_kwds, __pyx_kp_n);
-      if (likely(values[0])) kw_args--;
-      else goto __pyx_L5_argtuple_error;
-      case  1:
-      if (kw_args > 0) {
-        PyObject* value = PyDict_GetItem(__pyx_kwds, __pyx_kp_m);
-        if (unlikely(value)) { values[1] = value; kw_args--; }
-      }
-      case  2:
-      if (kw_args > 0) {
-        PyObject* value = PyDict_GetItem(__pyx_kwds, __pyx_kp_magic);
-        if (unlikely(value)) { values[2] = value; kw_args--; }
-      }
-    }
-    if (unlikely(kw_args > 0)) {
-      if (unlikely(__Pyx_ParseOptionalKeywords(__pyx_kwds, __pyx_pyargnames, 0, values, PyTuple_GET_SIZE(__pyx_args), "permutations") < 0)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 223; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-    }
-    __pyx_v_n = __Pyx_PyInt_AsUnsignedInt(values[0]); if (unlikely((__pyx_v_n == (unsigned int)-1) && PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 223; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-    if (values[1]) {
-      __pyx_v_m = __Pyx_PyInt_AsUnsignedInt(values[1]); if (unlikely((__pyx_v_m == (unsigned int)-1) && PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 223; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-    } else {
-      __pyx_v_m = 1;
-    }
-    if (values[2]) {
-      __pyx_v_magic = __Pyx_PyInt_AsUnsignedLong(values[2]); if (unlikely((__pyx_v_magic == (unsigned long)-1) && PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 223; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-    } else {
-      __pyx_v_magic = 0;
-    }
-  } else {
-    __pyx_v_m = 1;
-    __pyx_v_magic = 0;
-    switch (PyTuple_GET_SIZE(__pyx_args)) {
-      case  3: __pyx_v_magic = __Pyx_PyInt_AsUnsignedLong(PyTuple_GET_ITEM(__pyx_args, 2)); if (unlikely((__pyx_v_magic == (unsigned long)-1) && PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 223; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-      case  2: __pyx_v_m = __Pyx_PyInt_AsUnsignedInt(PyTuple_GET_ITEM(__pyx_args, 1)); if (unlikely((__pyx_v_m == (unsigned int)-1) && PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 223; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-      case  1: __pyx_v_n = __Pyx_PyInt_AsUnsignedInt(PyTuple_GET_ITEM(__pyx_args, 0)); if (unlikely((__pyx_v_n == (unsigned int)-1) && PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 223; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-      break;
-      default: goto __pyx_L5_argtuple_error;
-    }
-  }
-  goto __pyx_L4_argument_unpacking_done;
-  __pyx_L5_argtuple_error:;
-  __Pyx_RaiseArgtupleInvalid("permutations", 0, 1, 3, PyTuple_GET_SIZE(__pyx_args)); {__pyx_filename = __pyx_f[0]; __pyx_lineno = 223; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-  __pyx_L3_error:;
-  __Pyx_AddTraceback("nipy.neurospin.utils.routines.permutations");
-  return NULL;
-  __pyx_L4_argument_unpacking_done:;
-  __pyx_v_P = Py_None; __Pyx_INCREF(Py_None);
-
-  /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\utils\routines.pyx":231
- *     cdef fff_array pi_view
- *     cdef unsigned int i
- *     p = fff_array_new2d(FFF_UINT, n, m)             # <<<<<<<<<<<<<<
- *     pi = fff_array_new1d(FFF_UINT, n) ## contiguous, dims=(n,1,1,1)
- * 
- */
-  __pyx_v_p = fff_array_new2d(FFF_UINT, __pyx_v_n, __pyx_v_m);
-
-  /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\utils\routines.pyx":232
- *     cdef unsigned int i
- *     p = fff_array_new2d(FFF_UINT, n, m)
- *     pi = fff_array_new1d(FFF_UINT, n) ## contiguous, dims=(n,1,1,1)             # <<<<<<<<<<<<<<
- * 
- *     for i from 0 <= i < m:
- */
-  __pyx_v_pi = fff_array_new1d(FFF_UINT, __pyx_v_n);
-
-  /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\utils\routines.pyx":234
- *     pi = fff_array_new1d(FFF_UINT, n) ## contiguous, dims=(n,1,1,1)
- * 
- *     for i from 0 <= i < m:             # <<<<<<<<<<<<<<
- *         fff_permutation(<unsigned int*>pi.data, n, magic+i)
- *         pi_view = fff_array_get_block2d(p, 0, n-1, 1, i, i, 1) ## dims=(n,1,1,1)
- */
-  __pyx_t_1 = __pyx_v_m;
-  for (__pyx_v_i = 0; __pyx_v_i < __pyx_t_1; __pyx_v_i++) {
-
-    /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\utils\routines.pyx":235
- * 
- *     for i from 0 <= i < m:
- *         fff_permutation(<unsigned int*>pi.data, n, magic+i)             # <<<<<<<<<<<<<<
- *         pi_view = fff_array_get_block2d(p, 0, n-1, 1, i, i, 1) ## dims=(n,1,1,1)
- *         fff_array_copy(&pi_view, pi)
- */
-    fff_permutation(((unsigned int *)__pyx_v_pi->data), __pyx_v_n, (__pyx_v_magic + __pyx_v_i));
-
-    /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\utils\routines.pyx":236
- *     for i from 0 <= i < m:
- *         fff_permutation(<unsigned int*>pi.data, n, magic+i)
- *         pi_view = fff_array_get_block2d(p, 0, n-1, 1, i, i, 1) ## dims=(n,1,1,1)             # <<<<<<<<<<<<<<
- *         fff_array_copy(&pi_view, pi)
- * 
- */
-    __pyx_v_pi_view = fff_array_get_block2d(__pyx_v_p, 0, (__pyx_v_n - 1), 1, __pyx_v_i, __pyx_v_i, 1);
-
-    /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\utils\routines.pyx":237
- *         fff_permutation(<unsigned int*>pi.data, n, magic+i)
- *         pi_view = fff_array_get_block2d(p, 0, n-1, 1, i, i, 1) ## dims=(n,1,1,1)
- *         fff_array_copy(&pi_view, pi)             # <<<<<<<<<<<<<<
- * 
- *     P = fff_array_toPyArray(p)
- */
-    fff_array_copy((&__pyx_v_pi_view), __pyx_v_pi);
-  }
-
-  /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\utils\routines.pyx":239
- *         fff_array_copy(&pi_view, pi)
- * 
- *     P = fff_array_toPyArray(p)             # <<<<<<<<<<<<<<
- *     return P
- * 
- */
-  __pyx_t_2 = ((PyObject *)fff_array_toPyArray(__pyx_v_p)); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 239; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_2);
-  __Pyx_DECREF(__pyx_v_P);
-  __pyx_v_P = __pyx_t_2;
-  __pyx_t_2 = 0;
-
-  /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\utils\routines.pyx":240
- * 
- *     P = fff_array_toPyArray(p)
- *     return P             # <<<<<<<<<<<<<<
- * 
- * 
- */
-  __Pyx_XDECREF(__pyx_r);
-  __Pyx_INCREF(__pyx_v_P);
-  __pyx_r = __pyx_v_P;
-  goto __pyx_L0;
-
-  __pyx_r = Py_None; __Pyx_INCREF(Py_None);
-  goto __pyx_L0;
-  __pyx_L1_error:;
-  __Pyx_XDECREF(__pyx_t_2);
-  __Pyx_AddTraceback("nipy.neurospin.utils.routines.permutations");
-  __pyx_r = NULL;
-  __pyx_L0:;
-  __Pyx_DECREF(__pyx_v_P);
-  __Pyx_XGIVEREF(__pyx_r);
-  __Pyx_FinishRefcountContext();
-  return __pyx_r;
-}
-
-/* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\utils\routines.pyx":243
- * 
- * 
- * def combinations(unsigned int k, unsigned int n, unsigned int m=1, unsigned long magic=0):             # <<<<<<<<<<<<<<
- *     """
- *     P = combinations(k, n, m=1, magic=0).
- */
-
-static PyObject *__pyx_pf_4nipy_9neurospin_5utils_8routines_combinations(PyObject *__pyx_self, PyObject *__pyx_args, PyObject *__pyx_kwds); /*proto*/
-static char __pyx_doc_4nipy_9neurospin_5utils_8routines_combinations[] = "\n    P = combinations(k, n, m=1, magic=0).\n    Generate m combinations of k elements  from [0..n[.\n    ";
-static PyObject *__pyx_pf_4nipy_9neurospin_5utils_8routines_combinations(PyObject *__pyx_self, PyObject *__pyx_args, PyObject *__pyx_kwds) {
-  unsigned int __pyx_v_k;
-  unsigned int __pyx_v_n;
-  unsigned int __pyx_v_m;
-  unsigned long __pyx_v_magic;
-  fff_array *__pyx_v_p;
-  fff_array *__pyx_v_pi;
-  fff_array __pyx_v_pi_view;
-  unsigned int __pyx_v_i;
-  PyObject *__pyx_v_C;
-  PyObject *__pyx_r = NULL;
-  unsigned int __pyx_t_1;
-  PyObject *__pyx_t_2 = NULL;
-  static PyObject **__pyx_pyargnames[] = {&__pyx_kp_k,&__pyx_kp_n,&__pyx_kp_m,&__pyx_kp_magic,0};
-  __Pyx_SetupRefcountContext("combinations");
-  __pyx_self = __pyx_self;
-  if (unlikely(__pyx_kwds)) {
-    Py_ssize_t kw_args = PyDict_Size(__pyx_kwds);
-    PyObject* values[4] = {0,0,0,0};
-    switch (PyTuple_GET_SIZE(__pyx_args)) {
-      case  4: values[3] = PyTuple_GET_ITEM(__pyx_args, 3);
-      case  3: values[2] = PyTuple_GET_ITEM(__pyx_args, 2);
-      case  2: values[1] = PyTuple_GET_ITEM(__pyx_args, 1);
-      case  1: values[0] = PyTuple_GET_ITEM(__pyx_args, 0);
-      case  0: break;
-      default: goto __pyx_L5_argtuple_error;
-    }
-    switch (PyTuple_GET_SIZE(__pyx_args)) {
-      case  0:
-      values[0] = PyDict_GetItem(__pyx_kwds, __pyx_kp_k);
-      if (likely(values[0])) kw_args--;
-      else goto __pyx_L5_argtuple_error;
-      case  1:
-      values[1] = PyDict_GetItem(__pyx_kwds, __pyx_kp_n);
-      if (likely(values[1])) kw_args--;
-      else {
-        __Pyx_RaiseArgtupleInvalid("combinations", 0, 2, 4, 1); {__pyx_filename = __pyx_f[0]; __pyx_lineno = 243; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-      }
-      case  2:
-      if (kw_args > 0) {
-        PyObject* value = PyDict_GetItem(__pyx_kwds, __pyx_kp_m);
-        if (unlikely(value)) { values[2] = value; kw_args--; }
-      }
-      case  3:
-      if (kw_args > 0) {
-        PyObject* value = PyDict_GetItem(__pyx_kwds, __pyx_kp_magic);
-        if (unlikely(value)) { values[3] = value; kw_args--; }
-      }
-    }
-    if (unlikely(kw_args > 0)) {
-      if (unlikely(__Pyx_ParseOptionalKeywords(__pyx_kwds, __pyx_pyargnames, 0, values, PyTuple_GET_SIZE(__pyx_args), "combinations") < 0)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 243; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-    }
-    __pyx_v_k = __Pyx_PyInt_AsUnsignedInt(values[0]); if (unlikely((__pyx_v_k == (unsigned int)-1) && PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 243; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-    __pyx_v_n = __Pyx_PyInt_AsUnsignedInt(values[1]); if (unlikely((__pyx_v_n == (unsigned int)-1) && PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 243; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-    if (values[2]) {
-      __pyx_v_m = __Pyx_PyInt_AsUnsignedInt(values[2]); if (unlikely((__pyx_v_m == (unsigned int)-1) && PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 243; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-    } else {
-      __pyx_v_m = 1;
-    }
-    if (values[3]) {
-      __pyx_v_magic = __Pyx_PyInt_AsUnsignedLong(values[3]); if (unlikely((__pyx_v_magic == (unsigned long)-1) && PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 243; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-    } else {
-      __pyx_v_magic = 0;
-    }
-  } else {
-    __pyx_v_m = 1;
-    __pyx_v_magic = 0;
-    switch (PyTuple_GET_SIZE(__pyx_args)) {
-      case  4:
-      __pyx_v_magic = __Pyx_PyInt_AsUnsignedLong(PyTuple_GET_ITEM(__pyx_args, 3)); if (unlikely((__pyx_v_magic == (unsigned long)-1) && PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 243; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-      case  3:
-      __pyx_v_m = __Pyx_PyInt_AsUnsignedInt(PyTuple_GET_ITEM(__pyx_args, 2)); if (unlikely((__pyx_v_m == (unsigned int)-1) && PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 243; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-      case  2:
-      __pyx_v_n = __Pyx_PyInt_AsUnsignedInt(PyTuple_GET_ITEM(__pyx_args, 1)); if (unlikely((__pyx_v_n == (unsigned int)-1) && PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 243; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-      __pyx_v_k = __Pyx_PyInt_AsUnsignedInt(PyTuple_GET_ITEM(__pyx_args, 0)); if (unlikely((__pyx_v_k == (unsigned int)-1) && PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 243; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-      break;
-      default: goto __pyx_L5_argtuple_error;
-    }
-  }
-  goto __pyx_L4_argument_unpacking_done;
-  __pyx_L5_argtuple_error:;
-  __Pyx_RaiseArgtupleInvalid("combinations", 0, 2, 4, PyTuple_GET_SIZE(__pyx_args)); {__pyx_filename = __pyx_f[0]; __pyx_lineno = 243; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-  __pyx_L3_error:;
-  __Pyx_AddTraceback("nipy.neurospin.utils.routines.combinations");
-  return NULL;
-  __pyx_L4_argument_unpacking_done:;
-  __pyx_v_C = Py_None; __Pyx_INCREF(Py_None);
-
-  /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\utils\routines.pyx":251
- *     cdef fff_array pi_view
- *     cdef unsigned int i
- *     p = fff_array_new2d(FFF_UINT, k, m)             # <<<<<<<<<<<<<<
- *     pi = fff_array_new1d(FFF_UINT, k) ## contiguous, dims=(n,1,1,1)
- * 
- */
-  __pyx_v_p = fff_array_new2d(FFF_UINT, __pyx_v_k, __pyx_v_m);
-
-  /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\utils\routines.pyx":252
- *     cdef unsigned int i
- *     p = fff_array_new2d(FFF_UINT, k, m)
- *     pi = fff_array_new1d(FFF_UINT, k) ## contiguous, dims=(n,1,1,1)             # <<<<<<<<<<<<<<
- * 
- *     for i from 0 <= i < m:
- */
-  __pyx_v_pi = fff_array_new1d(FFF_UINT, __pyx_v_k);
-
-  /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\utils\routines.pyx":254
- *     pi = fff_array_new1d(FFF_UINT, k) ## contiguous, dims=(n,1,1,1)
- * 
- *     for i from 0 <= i < m:             # <<<<<<<<<<<<<<
- *         fff_combination(<unsigned int*>pi.data, k, n, magic+i)
- *         pi_view = fff_array_get_block2d(p, 0, k-1, 1, i, i, 1) ## dims=(k,1,1,1)
- */
-  __pyx_t_1 = __pyx_v_m;
-  for (__pyx_v_i = 0; __pyx_v_i < __pyx_t_1; __pyx_v_i++) {
-
-    /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\utils\routines.pyx":255
- * 
- *     for i from 0 <= i < m:
- *         fff_combination(<unsigned int*>pi.data, k, n, magic+i)             # <<<<<<<<<<<<<<
- *         pi_view = fff_array_get_block2d(p, 0, k-1, 1, i, i, 1) ## dims=(k,1,1,1)
- *         fff_array_copy(&pi_view, pi)
- */
-    fff_combination(((unsigned int *)__pyx_v_pi->data), __pyx_v_k, __pyx_v_n, (__pyx_v_magic + __pyx_v_i));
-
-    /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\utils\routines.pyx":256
- *     for i from 0 <= i < m:
- *         fff_combination(<unsigned int*>pi.data, k, n, magic+i)
- *         pi_view = fff_array_get_block2d(p, 0, k-1, 1, i, i, 1) ## dims=(k,1,1,1)             # <<<<<<<<<<<<<<
- *         fff_array_copy(&pi_view, pi)
- * 
- */
-    __pyx_v_pi_view = fff_array_get_block2d(__pyx_v_p, 0, (__pyx_v_k - 1), 1, __pyx_v_i, __pyx_v_i, 1);
-
-    /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\utils\routines.pyx":257
- *         fff_combination(<unsigned int*>pi.data, k, n, magic+i)
- *         pi_view = fff_array_get_block2d(p, 0, k-1, 1, i, i, 1) ## dims=(k,1,1,1)
- *         fff_array_copy(&pi_view, pi)             # <<<<<<<<<<<<<<
- * 
- *     C = fff_array_toPyArray(p)
- */
-    fff_array_copy((&__pyx_v_pi_view), __pyx_v_pi);
-  }
-
-  /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\utils\routines.pyx":259
- *         fff_array_copy(&pi_view, pi)
- * 
- *     C = fff_array_toPyArray(p)             # <<<<<<<<<<<<<<
- *     return C
- * 
- */
-  __pyx_t_2 = ((PyObject *)fff_array_toPyArray(__pyx_v_p)); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 259; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_2);
-  __Pyx_DECREF(__pyx_v_C);
-  __pyx_v_C = __pyx_t_2;
-  __pyx_t_2 = 0;
-
-  /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\utils\routines.pyx":260
- * 
- *     C = fff_array_toPyArray(p)
- *     return C             # <<<<<<<<<<<<<<
- * 
- * 
- */
-  __Pyx_XDECREF(__pyx_r);
-  __Pyx_INCREF(__pyx_v_C);
-  __pyx_r = __pyx_v_C;
-  goto __pyx_L0;
-
-  __pyx_r = Py_None; __Pyx_INCREF(Py_None);
-  goto __pyx_L0;
-  __pyx_L1_error:;
-  __Pyx_XDECREF(__pyx_t_2);
-  __Pyx_AddTraceback("nipy.neurospin.utils.routines.combinations");
-  __pyx_r = NULL;
-  __pyx_L0:;
-  __Pyx_DECREF(__pyx_v_C);
-  __Pyx_XGIVEREF(__pyx_r);
-  __Pyx_FinishRefcountContext();
-  return __pyx_r;
-}
-
-/* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\utils\routines.pyx":263
- * 
- * 
- * def gamln(double x):             # <<<<<<<<<<<<<<
- *     """ Python bindings to log gamma. Do not use, this is there only for
- *         testing. Use scipy.special.gammaln.
- */
-
-static PyObject *__pyx_pf_4nipy_9neurospin_5utils_8routines_gamln(PyObject *__pyx_self, PyObject *__pyx_arg_x); /*proto*/
-static char __pyx_doc_4nipy_9neurospin_5utils_8routines_gamln[] = " Python bindings to log gamma. Do not use, this is there only for\n        testing. Use scipy.special.gammaln.\n    ";
-static PyObject *__pyx_pf_4nipy_9neurospin_5utils_8routines_gamln(PyObject *__pyx_self, PyObject *__pyx_arg_x) {
-  double __pyx_v_x;
-  double __pyx_v_y;
-  PyObject *__pyx_r = NULL;
-  PyObject *__pyx_t_1 = NULL;
-  __Pyx_SetupRefcountContext("gamln");
-  __pyx_self = __pyx_self;
-  assert(__pyx_arg_x); {
-    __pyx_v_x = __pyx_PyFloat_AsDouble(__pyx_arg_x); if (unlikely(PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 263; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-  }
-  goto __pyx_L4_argument_unpacking_done;
-  __pyx_L3_error:;
-  __Pyx_AddTraceback("nipy.neurospin.utils.routines.gamln");
-  return NULL;
-  __pyx_L4_argument_unpacking_done:;
-
-  /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\utils\routines.pyx":268
- *     """
- *     cdef double y
- *     y = fff_gamln(x)             # <<<<<<<<<<<<<<
- *     return y
- * 
- */
-  __pyx_v_y = fff_gamln(__pyx_v_x);
-
-  /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\utils\routines.pyx":269
- *     cdef double y
- *     y = fff_gamln(x)
- *     return y             # <<<<<<<<<<<<<<
- * 
- * 
- */
-  __Pyx_XDECREF(__pyx_r);
-  __pyx_t_1 = PyFloat_FromDouble(__pyx_v_y); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 269; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_1);
-  __pyx_r = __pyx_t_1;
-  __pyx_t_1 = 0;
-  goto __pyx_L0;
-
-  __pyx_r = Py_None; __Pyx_INCREF(Py_None);
-  goto __pyx_L0;
-  __pyx_L1_error:;
-  __Pyx_XDECREF(__pyx_t_1);
-  __Pyx_AddTraceback("nipy.neurospin.utils.routines.gamln");
-  __pyx_r = NULL;
-  __pyx_L0:;
-  __Pyx_XGIVEREF(__pyx_r);
-  __Pyx_FinishRefcountContext();
-  return __pyx_r;
-}
-
-/* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\utils\routines.pyx":272
- * 
- * 
- * def psi(double x):             # <<<<<<<<<<<<<<
- *     """ Python bindings to psi (d gamln(x)/dx. Do not use, this is there only
- *         for testing. Use scipy.special.psi.
- */
-
-static PyObject *__pyx_pf_4nipy_9neurospin_5utils_8routines_psi(PyObject *__pyx_self, PyObject *__pyx_arg_x); /*proto*/
-static char __pyx_doc_4nipy_9neurospin_5utils_8routines_psi[] = " Python bindings to psi (d gamln(x)/dx. Do not use, this is there only \n        for testing. Use scipy.special.psi.\n    ";
-static PyObject *__pyx_pf_4nipy_9neurospin_5utils_8routines_psi(PyObject *__pyx_self, PyObject *__pyx_arg_x) {
-  double __pyx_v_x;
-  double __pyx_v_y;
-  PyObject *__pyx_r = NULL;
-  PyObject *__pyx_t_1 = NULL;
-  __Pyx_SetupRefcountContext("psi");
-  __pyx_self = __pyx_self;
-  assert(__pyx_arg_x); {
-    __pyx_v_x = __pyx_PyFloat_AsDouble(__pyx_arg_x); if (unlikely(PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 272; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-  }
-  goto __pyx_L4_argument_unpacking_done;
-  __pyx_L3_error:;
-  __Pyx_AddTraceback("nipy.neurospin.utils.routines.psi");
-  return NULL;
-  __pyx_L4_argument_unpacking_done:;
-
-  /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\utils\routines.pyx":277
- *     """
- *     cdef double y
- *     y = fff_psi(x)             # <<<<<<<<<<<<<<
- *     return y
- * 
- */
-  __pyx_v_y = fff_psi(__pyx_v_x);
-
-  /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\utils\routines.pyx":278
- *     cdef double y
- *     y = fff_psi(x)
- *     return y             # <<<<<<<<<<<<<<
- * 
- */
-  __Pyx_XDECREF(__pyx_r);
-  __pyx_t_1 = PyFloat_FromDouble(__pyx_v_y); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 278; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_1);
-  __pyx_r = __pyx_t_1;
-  __pyx_t_1 = 0;
-  goto __pyx_L0;
-
-  __pyx_r = Py_None; __Pyx_INCREF(Py_None);
-  goto __pyx_L0;
-  __pyx_L1_error:;
-  __Pyx_XDECREF(__pyx_t_1);
-  __Pyx_AddTraceback("nipy.neurospin.utils.routines.psi");
-  __pyx_r = NULL;
-  __pyx_L0:;
-  __Pyx_XGIVEREF(__pyx_r);
-  __Pyx_FinishRefcountContext();
-  return __pyx_r;
-}
-
-static struct PyMethodDef __pyx_methods[] = {
-  {__Pyx_NAMESTR("quantile"), (PyCFunction)__pyx_pf_4nipy_9neurospin_5utils_8routines_quantile, METH_VARARGS|METH_KEYWORDS, __Pyx_DOCSTR(__pyx_doc_4nipy_9neurospin_5utils_8routines_quantile)},
-  {__Pyx_NAMESTR("median"), (PyCFunction)__pyx_pf_4nipy_9neurospin_5utils_8routines_median, METH_VARARGS|METH_KEYWORDS, __Pyx_DOCSTR(__pyx_doc_4nipy_9neurospin_5utils_8routines_median)},
-  {__Pyx_NAMESTR("mahalanobis"), (PyCFunction)__pyx_pf_4nipy_9neurospin_5utils_8routines_mahalanobis, METH_VARARGS|METH_KEYWORDS, __Pyx_DOCSTR(__pyx_doc_4nipy_9neurospin_5utils_8routines_mahalanobis)},
-  {__Pyx_NAMESTR("svd"), (PyCFunction)__pyx_pf_4nipy_9neurospin_5utils_8routines_svd, METH_O, __Pyx_DOCSTR(__pyx_doc_4nipy_9neurospin_5utils_8routines_svd)},
-  {__Pyx_NAMESTR("permutations"), (PyCFunction)__pyx_pf_4nipy_9neurospin_5utils_8routines_permutations, METH_VARARGS|METH_KEYWORDS, __Pyx_DOCSTR(__pyx_doc_4nipy_9neurospin_5utils_8routines_permutations)},
-  {__Pyx_NAMESTR("combinations"), (PyCFunction)__pyx_pf_4nipy_9neurospin_5utils_8routines_combinations, METH_VARARGS|METH_KEYWORDS, __Pyx_DOCSTR(__pyx_doc_4nipy_9neurospin_5utils_8routines_combinations)},
-  {__Pyx_NAMESTR("gamln"), (PyCFunction)__pyx_pf_4nipy_9neurospin_5utils_8routines_gamln, METH_O, __Pyx_DOCSTR(__pyx_doc_4nipy_9neurospin_5utils_8routines_gamln)},
-  {__Pyx_NAMESTR("psi"), (PyCFunction)__pyx_pf_4nipy_9neurospin_5utils_8routines_psi, METH_O, __Pyx_DOCSTR(__pyx_doc_4nipy_9neurospin_5utils_8routines_psi)},
-  {0, 0, 0, 0}
-};
-
-static void __pyx_init_filenames(void); /*proto*/
-
-#if PY_MAJOR_VERSION >= 3
-static struct PyModuleDef __pyx_moduledef = {
-    PyModuleDef_HEAD_INIT,
-    __Pyx_NAMESTR("routines"),
-    __Pyx_DOCSTR(__pyx_mdoc), /* m_doc */
-    -1, /* m_size */
-    __pyx_methods /* m_methods */,
-    NULL, /* m_reload */
-    NULL, /* m_traverse */
-    NULL, /* m_clear */
-    NULL /* m_free */
-};
-#endif
-
-static __Pyx_StringTabEntry __pyx_string_tab[] = {
-  {&__pyx_kp___main__, __pyx_k___main__, sizeof(__pyx_k___main__), 1, 1, 1},
-  {&__pyx_kp_X, __pyx_k_X, sizeof(__pyx_k_X), 1, 1, 1},
-  {&__pyx_kp_ratio, __pyx_k_ratio, sizeof(__pyx_k_ratio), 1, 1, 1},
-  {&__pyx_kp_interp, __pyx_k_interp, sizeof(__pyx_k_interp), 1, 1, 1},
-  {&__pyx_kp_axis, __pyx_k_axis, sizeof(__pyx_k_axis), 1, 1, 1},
-  {&__pyx_kp_x, __pyx_k_x, sizeof(__pyx_k_x), 1, 1, 1},
-  {&__pyx_kp_VX, __pyx_k_VX, sizeof(__pyx_k_VX), 1, 1, 1},
-  {&__pyx_kp_n, __pyx_k_n, sizeof(__pyx_k_n), 1, 1, 1},
-  {&__pyx_kp_m, __pyx_k_m, sizeof(__pyx_k_m), 1, 1, 1},
-  {&__pyx_kp_magic, __pyx_k_magic, sizeof(__pyx_k_magic), 1, 1, 1},
-  {&__pyx_kp_k, __pyx_k_k, sizeof(__pyx_k_k), 1, 1, 1},
-  {&__pyx_kp___version__, __pyx_k___version__, sizeof(__pyx_k___version__), 1, 1, 1},
-  {&__pyx_kp_numpy, __pyx_k_numpy, sizeof(__pyx_k_numpy), 1, 1, 1},
-  {&__pyx_kp_np, __pyx_k_np, sizeof(__pyx_k_np), 0, 1, 1},
-  {&__pyx_kp_shape, __pyx_k_shape, sizeof(__pyx_k_shape), 1, 1, 1},
-  {&__pyx_kp_zeros, __pyx_k_zeros, sizeof(__pyx_k_zeros), 1, 1, 1},
-  {&__pyx_kp_quantile, __pyx_k_quantile, sizeof(__pyx_k_quantile), 1, 1, 1},
-  {&__pyx_kp_reshape, __pyx_k_reshape, sizeof(__pyx_k_reshape), 1, 1, 1},
-  {&__pyx_kp_1, __pyx_k_1, sizeof(__pyx_k_1), 0, 0, 0},
-  {0, 0, 0, 0, 0, 0}
-};
-static int __Pyx_InitCachedBuiltins(void) {
-  return 0;
-  return -1;
-}
-
-static int __Pyx_InitGlobals(void) {
-  __pyx_int_0 = PyInt_FromLong(0); if (unlikely(!__pyx_int_0)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 1; __pyx_clineno = __LINE__; goto __pyx_L1_error;};
-  __pyx_int_1 = PyInt_FromLong(1); if (unlikely(!__pyx_int_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 1; __pyx_clineno = __LINE__; goto __pyx_L1_error;};
-  if (__Pyx_InitStrings(__pyx_string_tab) < 0) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 1; __pyx_clineno = __LINE__; goto __pyx_L1_error;};
-  return 0;
-  __pyx_L1_error:;
-  return -1;
-}
-
-#if PY_MAJOR_VERSION < 3
-PyMODINIT_FUNC initroutines(void); /*proto*/
-PyMODINIT_FUNC initroutines(void)
-#else
-PyMODINIT_FUNC PyInit_routines(void); /*proto*/
-PyMODINIT_FUNC PyInit_routines(void)
-#endif
-{
-  PyObject *__pyx_1 = 0;
-  #ifdef CYTHON_REFNANNY
-  void* __pyx_refchk = NULL;
-  __Pyx_Refnanny = __Pyx_ImportRefcountAPI("refnanny");
-  if (!__Pyx_Refnanny) {
-      PyErr_Clear();
-      __Pyx_Refnanny = __Pyx_ImportRefcountAPI("Cython.Runtime.refnanny");
-      if (!__Pyx_Refnanny)
-          Py_FatalError("failed to import refnanny module");
-  }
-  __pyx_refchk = __Pyx_Refnanny->NewContext("PyMODINIT_FUNC PyInit_routines(void)", __LINE__, __FILE__);
-  #endif
-  __pyx_empty_tuple = PyTuple_New(0); if (unlikely(!__pyx_empty_tuple)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 1; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  /*--- Library function declarations ---*/
-  __pyx_init_filenames();
-  /*--- Threads initialization code ---*/
-  #if defined(__PYX_FORCE_INIT_THREADS) && __PYX_FORCE_INIT_THREADS
-  #ifdef WITH_THREAD /* Python build with threading support? */
-  PyEval_InitThreads();
-  #endif
-  #endif
-  /*--- Initialize various global constants etc. ---*/
-  if (unlikely(__Pyx_InitGlobals() < 0)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 1; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  /*--- Module creation code ---*/
-  #if PY_MAJOR_VERSION < 3
-  __pyx_m = Py_InitModule4(__Pyx_NAMESTR("routines"), __pyx_methods, __pyx_mdoc, 0, PYTHON_API_VERSION);
-  #else
-  __pyx_m = PyModule_Create(&__pyx_moduledef);
-  #endif
-  if (!__pyx_m) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 1; __pyx_clineno = __LINE__; goto __pyx_L1_error;};
-  #if PY_MAJOR_VERSION < 3
-  Py_INCREF(__pyx_m);
-  #endif
-  __pyx_b = PyImport_AddModule(__Pyx_NAMESTR(__Pyx_BUILTIN_MODULE_NAME));
-  if (!__pyx_b) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 1; __pyx_clineno = __LINE__; goto __pyx_L1_error;};
-  if (__Pyx_SetAttrString(__pyx_m, "__builtins__", __pyx_b) < 0) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 1; __pyx_clineno = __LINE__; goto __pyx_L1_error;};
-  if (__pyx_module_is_main_nipy__neurospin__utils__routines) {
-    if (__Pyx_SetAttrString(__pyx_m, "__name__", __pyx_kp___main__) < 0) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 1; __pyx_clineno = __LINE__; goto __pyx_L1_error;};
-  }
-  /*--- Builtin init code ---*/
-  if (unlikely(__Pyx_InitCachedBuiltins() < 0)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 1; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __pyx_skip_dispatch = 0;
-  /*--- Global init code ---*/
-  /*--- Function export code ---*/
-  /*--- Type init code ---*/
-  __pyx_ptype_4nipy_9neurospin_5utils_8routines_dtype = __Pyx_ImportType("numpy", "dtype", sizeof(PyArray_Descr)); if (unlikely(!__pyx_ptype_4nipy_9neurospin_5utils_8routines_dtype)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 74; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __pyx_ptype_4nipy_9neurospin_5utils_8routines_ndarray = __Pyx_ImportType("numpy", "ndarray", sizeof(PyArrayObject)); if (unlikely(!__pyx_ptype_4nipy_9neurospin_5utils_8routines_ndarray)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 79; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __pyx_ptype_4nipy_9neurospin_5utils_8routines_flatiter = __Pyx_ImportType("numpy", "flatiter", sizeof(PyArrayIterObject)); if (unlikely(!__pyx_ptype_4nipy_9neurospin_5utils_8routines_flatiter)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 88; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __pyx_ptype_4nipy_9neurospin_5utils_8routines_broadcast = __Pyx_ImportType("numpy", "broadcast", sizeof(PyArrayMultiIterObject)); if (unlikely(!__pyx_ptype_4nipy_9neurospin_5utils_8routines_broadcast)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 94; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  /*--- Type import code ---*/
-  /*--- Function import code ---*/
-  /*--- Execution code ---*/
-
-  /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\utils\routines.pyx":9
- * """
- * 
- * __version__ = '0.1'             # <<<<<<<<<<<<<<
- * 
- * # Includes from the python headers
- */
-  if (PyObject_SetAttr(__pyx_m, __pyx_kp___version__, __pyx_kp_1) < 0) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 9; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-
-  /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\utils\routines.pyx":38
- * 
- * # Initialize numpy
- * fffpy_import_array()             # <<<<<<<<<<<<<<
- * import_array()
- * import numpy as np
- */
-  fffpy_import_array();
-
-  /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\utils\routines.pyx":39
- * # Initialize numpy
- * fffpy_import_array()
- * import_array()             # <<<<<<<<<<<<<<
- * import numpy as np
- * 
- */
-  import_array();
-
-  /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\utils\routines.pyx":40
- * fffpy_import_array()
- * import_array()
- * import numpy as np             # <<<<<<<<<<<<<<
- * 
- * # FIXME: Check that this is faster than scipy.stats.scoreatpercentile
- */
-  __pyx_1 = __Pyx_Import(__pyx_kp_numpy, 0); if (unlikely(!__pyx_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 40; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_1);
-  if (PyObject_SetAttr(__pyx_m, __pyx_kp_np, __pyx_1) < 0) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 40; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_DECREF(__pyx_1); __pyx_1 = 0;
-
-  /* "d:\home\Alexis\bzr\dev-neurospin\nipy\neurospin\utils\routines.pyx":272
- * 
- * 
- * def psi(double x):             # <<<<<<<<<<<<<<
- *     """ Python bindings to psi (d gamln(x)/dx. Do not use, this is there only
- *         for testing. Use scipy.special.psi.
- */
-  goto __pyx_L0;
-  __pyx_L1_error:;
-  __Pyx_XDECREF(__pyx_1);
-  __Pyx_AddTraceback("nipy.neurospin.utils.routines");
-  Py_DECREF(__pyx_m); __pyx_m = 0;
-  __pyx_L0:;
-  __Pyx_FinishRefcountContext();
-  #if PY_MAJOR_VERSION < 3
-  return;
-  #else
-  return __pyx_m;
-  #endif
-}
-
-static const char *__pyx_filenames[] = {
-  "routines.pyx",
-  "numpy.pxi",
-};
-
-/* Runtime support code */
-
-static void __pyx_init_filenames(void) {
-  __pyx_f = __pyx_filenames;
-}
-
-static void __Pyx_RaiseDoubleKeywordsError(
-    const char* func_name,
-    PyObject* kw_name)
-{
-    PyErr_Format(PyExc_TypeError,
-        #if PY_MAJOR_VERSION >= 3
-        "%s() got multiple values for keyword argument '%U'", func_name, kw_name);
-        #else
-        "%s() got multiple values for keyword argument '%s'", func_name,
-        PyString_AS_STRING(kw_name));
-        #endif
-}
-
-static void __Pyx_RaiseArgtupleInvalid(
-    const char* func_name,
-    int exact,
-    Py_ssize_t num_min,
-    Py_ssize_t num_max,
-    Py_ssize_t num_found)
-{
-    Py_ssize_t num_expected;
-    const char *number, *more_or_less;
-
-    if (num_found < num_min) {
-        num_expected = num_min;
-        more_or_less = "at least";
-    } else {
-        num_expected = num_max;
-        more_or_less = "at most";
-    }
-    if (exact) {
-        more_or_less = "exactly";
-    }
-    number = (num_expected == 1) ? "" : "s";
-    PyErr_Format(PyExc_TypeError,
-        #if PY_VERSION_HEX < 0x02050000
-            "%s() takes %s %d positional argument%s (%d given)",
-        #else
-            "%s() takes %s %zd positional argument%s (%zd given)",
-        #endif
-        func_name, more_or_less, num_expected, number, num_found);
-}
-
-static int __Pyx_ParseOptionalKeywords(
-    PyObject *kwds,
-    PyObject **argnames[],
-    PyObject *kwds2,
-    PyObject *values[],
-    Py_ssize_t num_pos_args,
-    const char* function_name)
-{
-    PyObject *key = 0, *value = 0;
-    Py_ssize_t pos = 0;
-    PyObject*** name;
-    PyObject*** first_kw_arg = argnames + num_pos_args;
-
-    while (PyDict_Next(kwds, &pos, &key, &value)) {
-        name = first_kw_arg;
-        while (*name && (**name != key)) name++;
-        if (*name) {
-            values[name-argnames] = value;
-        } else {
-            #if PY_MAJOR_VERSION < 3
-            if (unlikely(!PyString_CheckExact(key)) && unlikely(!PyString_Check(key))) {
-            #else
-            if (unlikely(!PyUnicode_CheckExact(key)) && unlikely(!PyUnicode_Check(key))) {
-            #endif
-                goto invalid_keyword_type;
-            } else {
-                for (name = first_kw_arg; *name; name++) {
-                    #if PY_MAJOR_VERSION >= 3
-                    if (PyUnicode_GET_SIZE(**name) == PyUnicode_GET_SIZE(key) &&
-                        PyUnicode_Compare(**name, key) == 0) break;
-                    #else
-                    if (PyString_GET_SIZE(**name) == PyString_GET_SIZE(key) &&
-                        _PyString_Eq(**name, key)) break;
-                    #endif
-                }
-                if (*name) {
-                    values[name-argnames] = value;
-                } else {
-                    /* unexpected keyword found */
-                    for (name=argnames; name != first_kw_arg; name++) {
-                        if (**name == key) goto arg_passed_twice;
-                        #if PY_MAJOR_VERSION >= 3
-                        if (PyUnicode_GET_SIZE(**name) == PyUnicode_GET_SIZE(key) &&
-                            PyUnicode_Compare(**name, key) == 0) goto arg_passed_twice;
-                        #else
-                        if (PyString_GET_SIZE(**name) == PyString_GET_SIZE(key) &&
-                            _PyString_Eq(**name, key)) goto arg_passed_twice;
-                        #endif
-                    }
-                    if (kwds2) {
-                        if (unlikely(PyDict_SetItem(kwds2, key, value))) goto bad;
-                    } else {
-                        goto invalid_keyword;
-                    }
-                }
-            }
-        }
-    }
-    return 0;
-arg_passed_twice:
-    __Pyx_RaiseDoubleKeywordsError(function_name, **name);
-    goto bad;
-invalid_keyword_type:
-    PyErr_Format(PyExc_TypeError,
-        "%s() keywords must be strings", function_name);
-    goto bad;
-invalid_keyword:
-    PyErr_Format(PyExc_TypeError,
-    #if PY_MAJOR_VERSION < 3
-        "%s() got an unexpected keyword argument '%s'",
-        function_name, PyString_AsString(key));
-    #else
-        "%s() got an unexpected keyword argument '%U'",
-        function_name, key);
-    #endif
-bad:
-    return -1;
-}
-
-
-
-static PyObject *__Pyx_Import(PyObject *name, PyObject *from_list) {
-    PyObject *__import__ = 0;
-    PyObject *empty_list = 0;
-    PyObject *module = 0;
-    PyObject *global_dict = 0;
-    PyObject *empty_dict = 0;
-    PyObject *list;
-    __import__ = __Pyx_GetAttrString(__pyx_b, "__import__");
-    if (!__import__)
-        goto bad;
-    if (from_list)
-        list = from_list;
-    else {
-        empty_list = PyList_New(0);
-        if (!empty_list)
-            goto bad;
-        list = empty_list;
-    }
-    global_dict = PyModule_GetDict(__pyx_m);
-    if (!global_dict)
-        goto bad;
-    empty_dict = PyDict_New();
-    if (!empty_dict)
-        goto bad;
-    module = PyObject_CallFunctionObjArgs(__import__,
-        name, global_dict, empty_dict, list, NULL);
-bad:
-    Py_XDECREF(empty_list);
-    Py_XDECREF(__import__);
-    Py_XDECREF(empty_dict);
-    return module;
-}
-
-static PyObject *__Pyx_GetName(PyObject *dict, PyObject *name) {
-    PyObject *result;
-    result = PyObject_GetAttr(dict, name);
-    if (!result)
-        PyErr_SetObject(PyExc_NameError, name);
-    return result;
-}
-
-static INLINE int __Pyx_StrEq(const char *s1, const char *s2) {
-     while (*s1 != '\0' && *s1 == *s2) { s1++; s2++; }
-     return *s1 == *s2;
-}
-
-static INLINE unsigned char __Pyx_PyInt_AsUnsignedChar(PyObject* x) {
-    if (sizeof(unsigned char) < sizeof(long)) {
-        long val = __Pyx_PyInt_AsLong(x);
-        if (unlikely(val != (long)(unsigned char)val)) {
-            if (unlikely(val == -1 && PyErr_Occurred()))
-                return (unsigned char)-1;
-            if (unlikely(val < 0)) {
-                PyErr_SetString(PyExc_OverflowError,
-                                "can't convert negative value to unsigned char");
-                return (unsigned char)-1;
-            }
-            PyErr_SetString(PyExc_OverflowError,
-                           "value too large to convert to unsigned char");
-            return (unsigned char)-1;
-        }
-        return (unsigned char)val;
-    }
-    return (unsigned char)__Pyx_PyInt_AsUnsignedLong(x);
-}
-
-static INLINE unsigned short __Pyx_PyInt_AsUnsignedShort(PyObject* x) {
-    if (sizeof(unsigned short) < sizeof(long)) {
-        long val = __Pyx_PyInt_AsLong(x);
-        if (unlikely(val != (long)(unsigned short)val)) {
-            if (unlikely(val == -1 && PyErr_Occurred()))
-                return (unsigned short)-1;
-            if (unlikely(val < 0)) {
-                PyErr_SetString(PyExc_OverflowError,
-                                "can't convert negative value to unsigned short");
-                return (unsigned short)-1;
-            }
-            PyErr_SetString(PyExc_OverflowError,
-                           "value too large to convert to unsigned short");
-            return (unsigned short)-1;
-        }
-        return (unsigned short)val;
-    }
-    return (unsigned short)__Pyx_PyInt_AsUnsignedLong(x);
-}
-
-static INLINE unsigned int __Pyx_PyInt_AsUnsignedInt(PyObject* x) {
-    if (sizeof(unsigned int) < sizeof(long)) {
-        long val = __Pyx_PyInt_AsLong(x);
-        if (unlikely(val != (long)(unsigned int)val)) {
-            if (unlikely(val == -1 && PyErr_Occurred()))
-                return (unsigned int)-1;
-            if (unlikely(val < 0)) {
-                PyErr_SetString(PyExc_OverflowError,
-                                "can't convert negative value to unsigned int");
-                return (unsigned int)-1;
-            }
-            PyErr_SetString(PyExc_OverflowError,
-                           "value too large to convert to unsigned int");
-            return (unsigned int)-1;
-        }
-        return (unsigned int)val;
-    }
-    return (unsigned int)__Pyx_PyInt_AsUnsignedLong(x);
-}
-
-static INLINE char __Pyx_PyInt_AsChar(PyObject* x) {
-    if (sizeof(char) < sizeof(long)) {
-        long val = __Pyx_PyInt_AsLong(x);
-        if (unlikely(val != (long)(char)val)) {
-            if (unlikely(val == -1 && PyErr_Occurred()))
-                return (char)-1;
-            PyErr_SetString(PyExc_OverflowError,
-                           "value too large to convert to char");
-            return (char)-1;
-        }
-        return (char)val;
-    }
-    return (char)__Pyx_PyInt_AsLong(x);
-}
-
-static INLINE short __Pyx_PyInt_AsShort(PyObject* x) {
-    if (sizeof(short) < sizeof(long)) {
-        long val = __Pyx_PyInt_AsLong(x);
-        if (unlikely(val != (long)(short)val)) {
-            if (unlikely(val == -1 && PyErr_Occurred()))
-                return (short)-1;
-            PyErr_SetString(PyExc_OverflowError,
-                           "value too large to convert to short");
-            return (short)-1;
-        }
-        return (short)val;
-    }
-    return (short)__Pyx_PyInt_AsLong(x);
-}
-
-static INLINE int __Pyx_PyInt_AsInt(PyObject* x) {
-    if (sizeof(int) < sizeof(long)) {
-        long val = __Pyx_PyInt_AsLong(x);
-        if (unlikely(val != (long)(int)val)) {
-            if (unlikely(val == -1 && PyErr_Occurred()))
-                return (int)-1;
-            PyErr_SetString(PyExc_OverflowError,
-                           "value too large to convert to int");
-            return (int)-1;
-        }
-        return (int)val;
-    }
-    return (int)__Pyx_PyInt_AsLong(x);
-}
-
-static INLINE signed char __Pyx_PyInt_AsSignedChar(PyObject* x) {
-    if (sizeof(signed char) < sizeof(long)) {
-        long val = __Pyx_PyInt_AsLong(x);
-        if (unlikely(val != (long)(signed char)val)) {
-            if (unlikely(val == -1 && PyErr_Occurred()))
-                return (signed char)-1;
-            PyErr_SetString(PyExc_OverflowError,
-                           "value too large to convert to signed char");
-            return (signed char)-1;
-        }
-        return (signed char)val;
-    }
-    return (signed char)__Pyx_PyInt_AsSignedLong(x);
-}
-
-static INLINE signed short __Pyx_PyInt_AsSignedShort(PyObject* x) {
-    if (sizeof(signed short) < sizeof(long)) {
-        long val = __Pyx_PyInt_AsLong(x);
-        if (unlikely(val != (long)(signed short)val)) {
-            if (unlikely(val == -1 && PyErr_Occurred()))
-                return (signed short)-1;
-            PyErr_SetString(PyExc_OverflowError,
-                           "value too large to convert to signed short");
-            return (signed short)-1;
-        }
-        return (signed short)val;
-    }
-    return (signed short)__Pyx_PyInt_AsSignedLong(x);
-}
-
-static INLINE signed int __Pyx_PyInt_AsSignedInt(PyObject* x) {
-    if (sizeof(signed int) < sizeof(long)) {
-        long val = __Pyx_PyInt_AsLong(x);
-        if (unlikely(val != (long)(signed int)val)) {
-            if (unlikely(val == -1 && PyErr_Occurred()))
-                return (signed int)-1;
-            PyErr_SetString(PyExc_OverflowError,
-                           "value too large to convert to signed int");
-            return (signed int)-1;
-        }
-        return (signed int)val;
-    }
-    return (signed int)__Pyx_PyInt_AsSignedLong(x);
-}
-
-static INLINE unsigned long __Pyx_PyInt_AsUnsignedLong(PyObject* x) {
-#if PY_VERSION_HEX < 0x03000000
-    if (likely(PyInt_CheckExact(x) || PyInt_Check(x))) {
-        long val = PyInt_AS_LONG(x);
-        if (unlikely(val < 0)) {
-            PyErr_SetString(PyExc_OverflowError,
-                            "can't convert negative value to unsigned long");
-            return (unsigned long)-1;
-        }
-        return (unsigned long)val;
-    } else
-#endif
-    if (likely(PyLong_CheckExact(x) || PyLong_Check(x))) {
-        if (unlikely(Py_SIZE(x) < 0)) {
-            PyErr_SetString(PyExc_OverflowError,
-                            "can't convert negative value to unsigned long");
-            return (unsigned long)-1;
-        }
-        return PyLong_AsUnsignedLong(x);
-    } else {
-        unsigned long val;
-        PyObject *tmp = __Pyx_PyNumber_Int(x);
-        if (!tmp) return (unsigned long)-1;
-        val = __Pyx_PyInt_AsUnsignedLong(tmp);
-        Py_DECREF(tmp);
-        return val;
-    }
-}
-
-static INLINE unsigned PY_LONG_LONG __Pyx_PyInt_AsUnsignedLongLong(PyObject* x) {
-#if PY_VERSION_HEX < 0x03000000
-    if (likely(PyInt_CheckExact(x) || PyInt_Check(x))) {
-        long val = PyInt_AS_LONG(x);
-        if (unlikely(val < 0)) {
-            PyErr_SetString(PyExc_OverflowError,
-                            "can't convert negative value to unsigned PY_LONG_LONG");
-            return (unsigned PY_LONG_LONG)-1;
-        }
-        return (unsigned PY_LONG_LONG)val;
-    } else
-#endif
-    if (likely(PyLong_CheckExact(x) || PyLong_Check(x))) {
-        if (unlikely(Py_SIZE(x) < 0)) {
-            PyErr_SetString(PyExc_OverflowError,
-                            "can't convert negative value to unsigned PY_LONG_LONG");
-            return (unsigned PY_LONG_LONG)-1;
-        }
-        return PyLong_AsUnsignedLongLong(x);
-    } else {
-        unsigned PY_LONG_LONG val;
-        PyObject *tmp = __Pyx_PyNumber_Int(x);
-        if (!tmp) return (unsigned PY_LONG_LONG)-1;
-        val = __Pyx_PyInt_AsUnsignedLongLong(tmp);
-        Py_DECREF(tmp);
-        return val;
-    }
-}
-
-static INLINE long __Pyx_PyInt_AsLong(PyObject* x) {
-#if PY_VERSION_HEX < 0x03000000
-    if (likely(PyInt_CheckExact(x) || PyInt_Check(x))) {
-        long val = PyInt_AS_LONG(x);
-        return (long)val;
-    } else
-#endif
-    if (likely(PyLong_CheckExact(x) || PyLong_Check(x))) {
-        return PyLong_AsLong(x);
-    } else {
-        long val;
-        PyObject *tmp = __Pyx_PyNumber_Int(x);
-        if (!tmp) return (long)-1;
-        val = __Pyx_PyInt_AsLong(tmp);
-        Py_DECREF(tmp);
-        return val;
-    }
-}
-
-static INLINE PY_LONG_LONG __Pyx_PyInt_AsLongLong(PyObject* x) {
-#if PY_VERSION_HEX < 0x03000000
-    if (likely(PyInt_CheckExact(x) || PyInt_Check(x))) {
-        long val = PyInt_AS_LONG(x);
-        return (PY_LONG_LONG)val;
-    } else
-#endif
-    if (likely(PyLong_CheckExact(x) || PyLong_Check(x))) {
-        return PyLong_AsLongLong(x);
-    } else {
-        PY_LONG_LONG val;
-        PyObject *tmp = __Pyx_PyNumber_Int(x);
-        if (!tmp) return (PY_LONG_LONG)-1;
-        val = __Pyx_PyInt_AsLongLong(tmp);
-        Py_DECREF(tmp);
-        return val;
-    }
-}
-
-static INLINE signed long __Pyx_PyInt_AsSignedLong(PyObject* x) {
-#if PY_VERSION_HEX < 0x03000000
-    if (likely(PyInt_CheckExact(x) || PyInt_Check(x))) {
-        long val = PyInt_AS_LONG(x);
-        return (signed long)val;
-    } else
-#endif
-    if (likely(PyLong_CheckExact(x) || PyLong_Check(x))) {
-        return PyLong_AsLong(x);
-    } else {
-        signed long val;
-        PyObject *tmp = __Pyx_PyNumber_Int(x);
-        if (!tmp) return (signed long)-1;
-        val = __Pyx_PyInt_AsSignedLong(tmp);
-        Py_DECREF(tmp);
-        return val;
-    }
-}
-
-static INLINE signed PY_LONG_LONG __Pyx_PyInt_AsSignedLongLong(PyObject* x) {
-#if PY_VERSION_HEX < 0x03000000
-    if (likely(PyInt_CheckExact(x) || PyInt_Check(x))) {
-        long val = PyInt_AS_LONG(x);
-        return (signed PY_LONG_LONG)val;
-    } else
-#endif
-    if (likely(PyLong_CheckExact(x) || PyLong_Check(x))) {
-        return PyLong_AsLongLong(x);
-    } else {
-        signed PY_LONG_LONG val;
-        PyObject *tmp = __Pyx_PyNumber_Int(x);
-        if (!tmp) return (signed PY_LONG_LONG)-1;
-        val = __Pyx_PyInt_AsSignedLongLong(tmp);
-        Py_DECREF(tmp);
-        return val;
-    }
-}
-
-#ifndef __PYX_HAVE_RT_ImportType
-#define __PYX_HAVE_RT_ImportType
-static PyTypeObject *__Pyx_ImportType(const char *module_name, const char *class_name,
-    long size)
-{
-    PyObject *py_module = 0;
-    PyObject *result = 0;
-    PyObject *py_name = 0;
-
-    py_module = __Pyx_ImportModule(module_name);
-    if (!py_module)
-        goto bad;
-    #if PY_MAJOR_VERSION < 3
-    py_name = PyString_FromString(class_name);
-    #else
-    py_name = PyUnicode_FromString(class_name);
-    #endif
-    if (!py_name)
-        goto bad;
-    result = PyObject_GetAttr(py_module, py_name);
-    Py_DECREF(py_name);
-    py_name = 0;
-    Py_DECREF(py_module);
-    py_module = 0;
-    if (!result)
-        goto bad;
-    if (!PyType_Check(result)) {
-        PyErr_Format(PyExc_TypeError, 
-            "%s.%s is not a type object",
-            module_name, class_name);
-        goto bad;
-    }
-    if (((PyTypeObject *)result)->tp_basicsize != size) {
-        PyErr_Format(PyExc_ValueError, 
-            "%s.%s does not appear to be the correct type object",
-            module_name, class_name);
-        goto bad;
-    }
-    return (PyTypeObject *)result;
-bad:
-    Py_XDECREF(py_module);
-    Py_XDECREF(result);
-    return 0;
-}
-#endif
-
-#ifndef __PYX_HAVE_RT_ImportModule
-#define __PYX_HAVE_RT_ImportModule
-static PyObject *__Pyx_ImportModule(const char *name) {
-    PyObject *py_name = 0;
-    PyObject *py_module = 0;
-
-    #if PY_MAJOR_VERSION < 3
-    py_name = PyString_FromString(name);
-    #else
-    py_name = PyUnicode_FromString(name);
-    #endif
-    if (!py_name)
-        goto bad;
-    py_module = PyImport_Import(py_name);
-    Py_DECREF(py_name);
-    return py_module;
-bad:
-    Py_XDECREF(py_name);
-    return 0;
-}
-#endif
-
-#include "compile.h"
-#include "frameobject.h"
-#include "traceback.h"
-
-static void __Pyx_AddTraceback(const char *funcname) {
-    PyObject *py_srcfile = 0;
-    PyObject *py_funcname = 0;
-    PyObject *py_globals = 0;
-    PyObject *empty_string = 0;
-    PyCodeObject *py_code = 0;
-    PyFrameObject *py_frame = 0;
-
-    #if PY_MAJOR_VERSION < 3
-    py_srcfile = PyString_FromString(__pyx_filename);
-    #else
-    py_srcfile = PyUnicode_FromString(__pyx_filename);
-    #endif
-    if (!py_srcfile) goto bad;
-    if (__pyx_clineno) {
-        #if PY_MAJOR_VERSION < 3
-        py_funcname = PyString_FromFormat( "%s (%s:%d)", funcname, __pyx_cfilenm, __pyx_clineno);
-        #else
-        py_funcname = PyUnicode_FromFormat( "%s (%s:%d)", funcname, __pyx_cfilenm, __pyx_clineno);
-        #endif
-    }
-    else {
-        #if PY_MAJOR_VERSION < 3
-        py_funcname = PyString_FromString(funcname);
-        #else
-        py_funcname = PyUnicode_FromString(funcname);
-        #endif
-    }
-    if (!py_funcname) goto bad;
-    py_globals = PyModule_GetDict(__pyx_m);
-    if (!py_globals) goto bad;
-    #if PY_MAJOR_VERSION < 3
-    empty_string = PyString_FromStringAndSize("", 0);
-    #else
-    empty_string = PyBytes_FromStringAndSize("", 0);
-    #endif
-    if (!empty_string) goto bad;
-    py_code = PyCode_New(
-        0,            /*int argcount,*/
-        #if PY_MAJOR_VERSION >= 3
-        0,            /*int kwonlyargcount,*/
-        #endif
-        0,            /*int nlocals,*/
-        0,            /*int stacksize,*/
-        0,            /*int flags,*/
-        empty_string, /*PyObject *code,*/
-        __pyx_empty_tuple,  /*PyObject *consts,*/
-        __pyx_empty_tuple,  /*PyObject *names,*/
-        __pyx_empty_tuple,  /*PyObject *varnames,*/
-        __pyx_empty_tuple,  /*PyObject *freevars,*/
-        __pyx_empty_tuple,  /*PyObject *cellvars,*/
-        py_srcfile,   /*PyObject *filename,*/
-        py_funcname,  /*PyObject *name,*/
-        __pyx_lineno,   /*int firstlineno,*/
-        empty_string  /*PyObject *lnotab*/
-    );
-    if (!py_code) goto bad;
-    py_frame = PyFrame_New(
-        PyThreadState_GET(), /*PyThreadState *tstate,*/
-        py_code,             /*PyCodeObject *code,*/
-        py_globals,          /*PyObject *globals,*/
-        0                    /*PyObject *locals*/
-    );
-    if (!py_frame) goto bad;
-    py_frame->f_lineno = __pyx_lineno;
-    PyTraceBack_Here(py_frame);
-bad:
-    Py_XDECREF(py_srcfile);
-    Py_XDECREF(py_funcname);
-    Py_XDECREF(empty_string);
-    Py_XDECREF(py_code);
-    Py_XDECREF(py_frame);
-}
-
-static int __Pyx_InitStrings(__Pyx_StringTabEntry *t) {
-    while (t->p) {
-        #if PY_MAJOR_VERSION < 3
-        if (t->is_unicode && (!t->is_identifier)) {
-            *t->p = PyUnicode_DecodeUTF8(t->s, t->n - 1, NULL);
-        } else if (t->intern) {
-            *t->p = PyString_InternFromString(t->s);
-        } else {
-            *t->p = PyString_FromStringAndSize(t->s, t->n - 1);
-        }
-        #else  /* Python 3+ has unicode identifiers */
-        if (t->is_identifier || (t->is_unicode && t->intern)) {
-            *t->p = PyUnicode_InternFromString(t->s);
-        } else if (t->is_unicode) {
-            *t->p = PyUnicode_FromStringAndSize(t->s, t->n - 1);
-        } else {
-            *t->p = PyBytes_FromStringAndSize(t->s, t->n - 1);
-        }
-        #endif
-        if (!*t->p)
-            return -1;
-        ++t;
-    }
-    return 0;
-}
-
-/* Type Conversion Functions */
-
-static INLINE int __Pyx_PyObject_IsTrue(PyObject* x) {
-   if (x == Py_True) return 1;
-   else if ((x == Py_False) | (x == Py_None)) return 0;
-   else return PyObject_IsTrue(x);
-}
-
-static INLINE PyObject* __Pyx_PyNumber_Int(PyObject* x) {
-  PyNumberMethods *m;
-  const char *name = NULL;
-  PyObject *res = NULL;
-#if PY_VERSION_HEX < 0x03000000
-  if (PyInt_Check(x) || PyLong_Check(x))
-#else
-  if (PyLong_Check(x))
-#endif
-    return Py_INCREF(x), x;
-  m = Py_TYPE(x)->tp_as_number;
-#if PY_VERSION_HEX < 0x03000000
-  if (m && m->nb_int) {
-    name = "int";
-    res = PyNumber_Int(x);
-  }
-  else if (m && m->nb_long) {
-    name = "long";
-    res = PyNumber_Long(x);
-  }
-#else
-  if (m && m->nb_int) {
-    name = "int";
-    res = PyNumber_Long(x);
-  }
-#endif
-  if (res) {
-#if PY_VERSION_HEX < 0x03000000
-    if (!PyInt_Check(res) && !PyLong_Check(res)) {
-#else
-    if (!PyLong_Check(res)) {
-#endif
-      PyErr_Format(PyExc_TypeError,
-                   "__%s__ returned non-%s (type %.200s)",
-                   name, name, Py_TYPE(res)->tp_name);
-      Py_DECREF(res);
-      return NULL;
-    }
-  }
-  else if (!PyErr_Occurred()) {
-    PyErr_SetString(PyExc_TypeError,
-                    "an integer is required");
-  }
-  return res;
-}
-
-static INLINE Py_ssize_t __Pyx_PyIndex_AsSsize_t(PyObject* b) {
-  Py_ssize_t ival;
-  PyObject* x = PyNumber_Index(b);
-  if (!x) return -1;
-  ival = PyInt_AsSsize_t(x);
-  Py_DECREF(x);
-  return ival;
-}
-
-static INLINE PyObject * __Pyx_PyInt_FromSize_t(size_t ival) {
-#if PY_VERSION_HEX < 0x02050000
-   if (ival <= LONG_MAX)
-       return PyInt_FromLong((long)ival);
-   else {
-       unsigned char *bytes = (unsigned char *) &ival;
-       int one = 1; int little = (int)*(unsigned char*)&one;
-       return _PyLong_FromByteArray(bytes, sizeof(size_t), little, 0);
-   }
-#else
-   return PyInt_FromSize_t(ival);
-#endif
-}
-
-static INLINE size_t __Pyx_PyInt_AsSize_t(PyObject* x) {
-   unsigned PY_LONG_LONG val = __Pyx_PyInt_AsUnsignedLongLong(x);
-   if (unlikely(val == (unsigned PY_LONG_LONG)-1 && PyErr_Occurred())) {
-       return (size_t)-1;
-   } else if (unlikely(val != (unsigned PY_LONG_LONG)(size_t)val)) {
-       PyErr_SetString(PyExc_OverflowError,
-                       "value too large to convert to size_t");
-       return (size_t)-1;
-   }
-   return (size_t)val;
-}
-
-
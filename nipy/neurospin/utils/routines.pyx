@@ -19,6 +19,10 @@ cdef extern from "fff_gen_stats.h":
                          unsigned long int magic)
     void fff_combination(unsigned int* x, unsigned int k, unsigned int n,
                          unsigned long magic)
+    void fff_permutations(unsigned int* x, unsigned int n,
+                          unsigned long magic, unsigned int m)
+    void fff_combinations(unsigned int* x, unsigned int k, unsigned int n,
+                          unsigned long magic, unsigned int m)
 
 # Exports from fff_specfun.h
 cdef extern from "fff_specfun.h":
@@ -33,6 +37,13 @@ cdef extern from "fff_lapack.h":
     extern int fff_lapack_dgesdd(fff_matrix* A, fff_vector* s, fff_matrix* U, fff_matrix* Vt, 
                                  fff_vector* work, fff_array* iwork, fff_matrix* Aux)
 
+# Exports from fff_emp_null.h
+cdef extern from "fff_emp_null.h":
+
+    extern int fff_fdr_threshold_batch(fff_vector* pth, fff_matrix* P, double alpha, int nthreads)
+    extern int fff_emp_null_fit_batch(fff_vector* mu, fff_vector* sigma, fff_vector* p0,
+                                      fff_matrix* X, double left, double right, int nthreads)
+
 
 # Initialize numpy
 fffpy_import_array()
@@ -225,19 +236,16 @@ def permutations(unsigned int n, unsigned int m=1, unsigned long magic=0):
     P = permutations(n, m=1, magic=0).
     Generate m permutations from [0..n[.
     """
-    cdef fff_array *p, *pi
-    cdef fff_array pi_view
-    cdef unsigned int i
-    p = fff_array_new2d(FFF_UINT, n, m)
-    pi = fff_array_new1d(FFF_UINT, n) ## contiguous, dims=(n,1,1,1)
+    cdef fff_array *p
+    p = fff_array_new2d(FFF_UINT, m, n) ## contiguous, one permutation per row
 
-    for i from 0 <= i < m:
-        fff_permutation(<unsigned int*>pi.data, n, magic+i)
-        pi_view = fff_array_get_block2d(p, 0, n-1, 1, i, i, 1) ## dims=(n,1,1,1)
-        fff_array_copy(&pi_view, pi)
+    fff_permutations(<unsigned int*>p.data, n, magic, m)
 
-    P = fff_array_toPyArray(p)
-    return P 
+    ## one permutation per column, a single one as a 1d array
+    P = fff_array_toPyArray(p).reshape((m, n)).T
+    if m == 1:
+        P = P[:, 0]
+    return P
 
 
 def combinations(unsigned int k, unsigned int n, unsigned int m=1, unsigned long magic=0):
@@ -245,21 +253,85 @@ def combinations(unsigned int k, unsigned int n, unsigned int m=1, unsigned long
     P = combinations(k, n, m=1, magic=0).
     Generate m combinations of k elements  from [0..n[.
     """
-    cdef fff_array *p, *pi
-    cdef fff_array pi_view
-    cdef unsigned int i
-    p = fff_array_new2d(FFF_UINT, k, m)
-    pi = fff_array_new1d(FFF_UINT, k) ## contiguous, dims=(n,1,1,1)
-
-    for i from 0 <= i < m:
-        fff_combination(<unsigned int*>pi.data, k, n, magic+i)
-        pi_view = fff_array_get_block2d(p, 0, k-1, 1, i, i, 1) ## dims=(k,1,1,1)
-        fff_array_copy(&pi_view, pi)
-
-    C = fff_array_toPyArray(p)
+    cdef fff_array *p
+    p = fff_array_new2d(FFF_UINT, m, k) ## contiguous, one combination per row
+
+    fff_combinations(<unsigned int*>p.data, k, n, magic, m)
+
+    C = fff_array_toPyArray(p).reshape((m, k)).T
+    if m == 1:
+        C = C[:, 0]
     return C
 
 
+def _maps(X):
+    """
+    (nmaps, n) C-contiguous double array of the maps in X, one per
+    row, and the shape of the outputs. 
+    """
+    X = np.asarray(X)
+    shape = X.shape[:-1]
+    return np.ascontiguousarray(X.reshape((-1, X.shape[-1])), dtype='double'), shape
+
+
+def fdr_threshold(P, double alpha=0.05, int nthreads=1):
+    """
+    pth = fdr_threshold(P, alpha=0.05, nthreads=1).
+
+    Benjamini-Hochberg threshold of each p-value map stored along the
+    last axis of P, as emp_null.FDR.pth_from_pvals. The p-values are
+    counted between consecutive critical values instead of being
+    sorted, and the maps are split across nthreads threads.
+    """
+    cdef fff_matrix *p
+    cdef fff_vector *pth
+    cdef int err
+
+    Pr, shape = _maps(P)
+    Pth = np.zeros(Pr.shape[0])
+    p = fff_matrix_fromPyArray(Pr)
+    pth = fff_vector_fromPyArray(Pth)
+    err = fff_fdr_threshold_batch(pth, p, alpha, nthreads)
+    fff_matrix_delete(p)
+    fff_vector_delete(pth)
+    if err:
+        raise MemoryError('FDR thresholds failed')
+    return Pth.reshape(shape)
+
+
+def emp_null_fit(X, double left=0.2, double right=0.8, int nthreads=1):
+    """
+    (mu, sigma, p0) = emp_null_fit(X, left=0.2, right=0.8, nthreads=1).
+
+    Empirical null of each map stored along the last axis of X, as
+    emp_null.ENN.learn: normal density fitted to the histogram of the
+    samples between the left and right quantiles. The quantiles are
+    found by selection instead of sorting, and the maps are split
+    across nthreads threads. Maps that cannot be fitted have NaN
+    parameters.
+    """
+    cdef fff_matrix *x
+    cdef fff_vector *mu, *sigma, *p0
+    cdef int err
+
+    Xr, shape = _maps(X)
+    Mu = np.zeros(Xr.shape[0])
+    Sigma = np.zeros(Xr.shape[0])
+    P0 = np.zeros(Xr.shape[0])
+    x = fff_matrix_fromPyArray(Xr)
+    mu = fff_vector_fromPyArray(Mu)
+    sigma = fff_vector_fromPyArray(Sigma)
+    p0 = fff_vector_fromPyArray(P0)
+    err = fff_emp_null_fit_batch(mu, sigma, p0, x, left, right, nthreads)
+    fff_matrix_delete(x)
+    fff_vector_delete(mu)
+    fff_vector_delete(sigma)
+    fff_vector_delete(p0)
+    if err:
+        raise MemoryError('Empirical null fits failed')
+    return Mu.reshape(shape), Sigma.reshape(shape), P0.reshape(shape)
+
+
 def gamln(double x):
     """ Python bindings to log gamma. Do not use, this is there only for
         testing. Use scipy.special.gammaln.
@@ -1,10 +1,10 @@
 """
-Routine for smoothing data using diffusion on graphs.
-Works well only for small kernels.
+Routine for smoothing data sampled on (incomplete) cartesian grids.
 
-Note that this is not useful for regular grids, where direct
-application of smoothing kernels is much faster. But the idea might be
-kept to perform smoothing on irregular structures (meshes).
+The data are convolved with a separable Gaussian kernel, by passes
+along each axis of the grid (see fff_field_gaussian_smoothing). Each
+pass is normalized by the kernel mass within the grid, so that voxels
+close to its border are only averaged over their neighbours.
 
 Author : Bertrand Thirion, 2006-2009
 """
@@ -12,7 +12,7 @@ Author : Bertrand Thirion, 2006-2009
 import numpy as np
 import nipy.neurospin.graph.field as ff
 
-def cartesian_smoothing(ijk,data,sigma):
+def cartesian_smoothing(ijk,data,sigma,nthreads=1):
 	"""
 	Smoothing data on a(n uncomplete) cartesian grid
 	
@@ -22,13 +22,12 @@ def cartesian_smoothing(ijk,data,sigma):
         it is typically returned by (array(np.where())).T
 	data :array of shape (ijk.shape[0],d) where d is the datas dimension 
          data sampled on the grid 
-	sigma : the kernel parameter
+	sigma : the kernel parameter, in voxels
+	nthreads : the number of threads (all the processors if <=0)
 	
     Returns
     -------
-	data, which is the smoothed data
-
-    fixme : in-place change of data ?
+	data, which is the smoothed data; the input is not modified
 	"""
 	if ijk.shape[1]!=3:
 		raise ValueError, "please provide a (n,3) position array"
@@ -40,23 +39,4 @@ def cartesian_smoothing(ijk,data,sigma):
 	if np.size(data)==n:
 		data = np.reshape(data,(n,1))
 	
-	f = ff.Field(n)
-	f.from_3d_grid(ijk,6)
-	f.normalize(1)
-	D = f.weights
-	L = D*6-6*(D==0)
-	f.set_weights(L)
-
-	niter = max(10,int(1+0.5*sigma*sigma*(1+np.absolute(L).max())))
-	
-	kp = 0.5*sigma*sigma/niter
-	for i in range(niter):
-		#print data
-		f.set_field(data.copy())
-		f.diffusion()
-		data = data + kp * f.field
-				
-	return data
-
-
-
+	return ff.gaussian_smoothing(ijk, data, float(sigma), nthreads)
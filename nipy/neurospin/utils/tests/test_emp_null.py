@@ -27,3 +27,61 @@ def test_efdr():
     np.testing.assert_array_less(-efdr.threshold(alpha=0.05), -3)
     np.testing.assert_array_less(-efdr.uncorrected_threshold(alpha=0.001), -3)
 
+
+def test_fdr_threshold():
+    from nipy.neurospin.utils.emp_null import FDR, fdr_thresholds
+    pv = np.random.rand(3, 1000)
+    pv[:, :20] *= 1.e-4
+    pv[1] = np.round(pv[1], 2)
+    pth = fdr_thresholds(pv, alpha=0.05, nthreads=2)
+    for k in range(3):
+        # first crossing of the critical values in ascending order
+        spv = np.sort(pv[k])
+        below = spv < 0.05*np.arange(1, 1001)/1000.
+        ip = np.argmin(below)
+        ref = (ip > 0)*spv[ip-1]
+        np.testing.assert_equal(pth[k], ref)
+        np.testing.assert_equal(FDR(pv[k]).pth_from_pvals(pv[k]), ref)
+        # FDR values: running maximum of n*p/rank
+        q = FDR(pv[k]).all_fdr_from_pvals(pv[k])
+        isx = np.argsort(pv[k])
+        qs = np.zeros(1000)
+        for i in range(1000):
+            qs[i] = min(1, max(1000*spv[i]/(i+1), qs[i-1]*(i>0)))
+        np.testing.assert_almost_equal(q[isx], qs)
+
+def _learn(x, left=0.2, right=0.8):
+    # numpy version of ENN.learn
+    x = np.sort(x)
+    n = x.size
+    sx = x[int(n*left):int(n*right)]
+    step = 3.5*np.std(x)/np.exp(np.log(n)/3)
+    bins = int(max(10, (x.max() - x.min())/step))
+    hist, ledge = np.histogram(sx, bins=bins)
+    step = ledge[1]-ledge[0]
+    medge = ledge[:-1] + 0.5*step
+    whist = hist>0
+    hist = hist[whist].astype('d')
+    medge = medge[whist]
+    DMtx = np.ones((3, np.sum(whist)))
+    DMtx[1] = medge
+    DMtx[2] = medge**2
+    coef = np.dot(np.log(hist), np.linalg.pinv(DMtx))
+    sqsigma = -1.0/(2*coef[2])
+    mu = coef[1]*sqsigma
+    lp0 = (coef[0]- np.log(step*n) 
+           + 0.5*np.log(2*np.pi*sqsigma) + mu**2/(2*sqsigma))
+    return mu, np.sqrt(sqsigma), min(1, np.exp(lp0))
+
+def test_empirical_nulls():
+    from nipy.neurospin.utils.emp_null import empirical_nulls
+    x = np.random.randn(4, 10000)*np.array([[1], [2], [1], [.5]]) + \
+        np.array([[0], [1], [-1], [0]])
+    x[:, :300] += 4
+    mu, sigma, p0 = empirical_nulls(x, nthreads=3)
+    for k in range(4):
+        mu_k, sigma_k, p0_k = _learn(x[k])
+        np.testing.assert_almost_equal(mu[k], mu_k)
+        np.testing.assert_almost_equal(sigma[k], sigma_k)
+        np.testing.assert_almost_equal(p0[k], p0_k)
+    np.testing.assert_(np.isnan(empirical_nulls(np.ones((1, 100)))[0]).all())
@@ -0,0 +1,72 @@
+"""
+Test the memory-mapped image stacks.
+"""
+
+import numpy as np
+
+import nipy.io.imageformats as nii
+from nipy.neurospin.utils.image_source import ImageSource
+
+from nipy.utils import InTemporaryDirectory
+
+from nipy.testing import assert_equal, assert_true, \
+    assert_array_almost_equal, assert_array_equal
+
+
+def _make_images(shape=(7, 6, 5), nimages=3):
+    """ Save int16 images, hence with a scaling, and reload them.
+    """
+    imgs = []
+    for i in range(nimages):
+        arr = 100*np.random.rand(*shape) - 20.
+        img = nii.Nifti1Image(arr, np.eye(4))
+        img.get_header().set_data_dtype(np.int16)
+        fname = 'img%d.nii' % i
+        nii.save(img, fname)
+        imgs.append(nii.load(fname))
+    return imgs
+
+
+def test_read():
+    with InTemporaryDirectory():
+        imgs = _make_images()
+        mask = np.random.rand(7, 6, 5) > .5
+        source = ImageSource(imgs)
+        yield assert_equal, len(source), 3
+        yield assert_equal, source.shape, (7, 6, 5)
+        # The fixtures are stored with a scaling
+        yield assert_true, not source.get_slope_inter(0)[0] == None
+        Y = np.array([img.get_data()[mask] for img in imgs])
+        yield assert_array_almost_equal, source.read(mask, block_size=10), Y
+        yield assert_array_almost_equal, source.volume(1), imgs[1].get_data()
+
+
+def test_blocks():
+    with InTemporaryDirectory():
+        imgs = _make_images()
+        mask = np.random.rand(7, 6, 5) > .3
+        source = ImageSource(imgs)
+        x, y, z = source.mask_coordinates(mask)
+        idx = source.mask_indices(mask)
+        # Blocks are read in disk (Fortran) order
+        yield assert_true, np.all(np.diff(idx) > 0)
+        yield assert_array_equal, mask[x, y, z], True
+        yield assert_equal, x.size, mask.sum()
+        nvox = 0
+        for sl, Y in source.blocks(mask, block_size=16):
+            yield assert_true, Y.shape[1] <= 16
+            yield assert_array_almost_equal, Y[2], \
+                imgs[2].get_data()[x[sl], y[sl], z[sl]]
+            nvox += Y.shape[1]
+        yield assert_equal, nvox, mask.sum()
+
+
+def test_4d():
+    with InTemporaryDirectory():
+        arr = np.random.rand(5, 4, 3, 6)
+        nii.save(nii.Nifti1Image(arr, np.eye(4)), 'fourd.nii')
+        source = ImageSource(['fourd.nii'])
+        yield assert_equal, len(source), 6
+        yield assert_equal, source.shape, (5, 4, 3)
+        yield assert_array_almost_equal, source.volume(2), arr[:, :, :, 2]
+        yield assert_array_almost_equal, source.mean(), arr.mean(-1)
@@ -25,6 +25,11 @@ class TestAll(TestCase):
         x = rand(10,30,11)
         assert_almost_equal(squeeze(fu.median(x,axis=1)), median(x,axis=1))
 
+    def test_median_small(self):
+        for n in range(1, 10):
+            x = rand(n)
+            assert_almost_equal(fu.median(x), median(x))
+
     def test_mahalanobis(self):
         x = rand(100)
         A = rand(100,100)
@@ -58,6 +63,21 @@ class TestAll(TestCase):
             my_psi = routines.psi(x)
             assert_almost_equal(scipy_psi, my_psi)
 
+    def test_permutations(self):
+        P = routines.permutations(5, m=120)
+        assert_equal(P.shape, (5, 120))
+        assert_equal(np.sort(P, 0), np.tile(np.arange(5), (120, 1)).T)
+        assert_equal(len(set(tuple(p) for p in P.T)), 120)
+        assert_equal(P[:, 7], routines.permutations(5, magic=7))
+
+    def test_combinations(self):
+        C = routines.combinations(3, 6, m=20)
+        assert_equal(C.shape, (3, 20))
+        assert_equal(C[:, 0], [0, 1, 2])
+        assert_equal(C[:, 19], [3, 4, 5])
+        assert_equal(sorted(tuple(c) for c in C.T), [tuple(c) for c in C.T])
+        assert_equal(C[:, 11], routines.combinations(3, 6, magic=11))
+
 
 if __name__ == "__main__":
     import nose
@@ -8,7 +8,8 @@ not whether it is exact
 import numpy as np
 import nipy.neurospin.utils.simul_2d_multisubject_fmri_dataset as simul
 from nipy.neurospin.utils.reproducibility_measures import \
-     voxel_reproducibility, cluster_reproducibility
+     voxel_reproducibility, cluster_reproducibility, subgroup_clusters, \
+     draw_samples, ttest, fttest, cluster_threshold
 
 from nipy.testing import (parametric, dec, assert_almost_equal,
                            assert_true)
@@ -130,3 +131,23 @@ def test_repro8():
     kap,clt = apply_repro_analysis_analysis(dataset, thresholds=[5.0])
     assert_true((clt.mean()>0.5))
 
+
+def test_subgroup_clusters():
+    # The subgroups clustered together match the maps clustered one
+    # at a time
+    dataset = make_dataset()
+    nsubj, dimx, dimy = dataset.shape
+    func = np.reshape(dataset,(nsubj, dimx*dimy)).T
+    var = 1+np.random.rand(dimx*dimy, nsubj)
+    xyz = np.reshape(np.indices((dimx, dimy,1)).T,(dimx*dimy,3))
+    samples = draw_samples(nsubj, 5)
+    for method, stat in [('crfx', lambda x, vx: ttest(x)), ('cffx', fttest)]:
+        label, rmap = subgroup_clusters(func, var, xyz, samples, method,
+                                        threshold=3.0, csize=10, nthreads=2)
+        rmap_ = 0
+        for i in range(len(samples)):
+            smap = stat(func[:,samples[i]], var[:,samples[i]])
+            binary = cluster_threshold(smap, xyz, 3.0, 10)
+            assert_true(((label[i]>-1)==binary).all())
+            rmap_ += binary
+        assert_true((rmap==rmap_).all())
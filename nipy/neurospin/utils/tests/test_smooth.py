@@ -32,6 +32,21 @@ def test_smoothing():
     print "error:", error
     assert (error<1.e-4)
 
+def test_smoothing_mask():
+    # a constant field on an irregular mask is left unchanged, and
+    # the columns are smoothed independently
+    mask = np.random.rand(12, 10, 8) > .4
+    ijk = np.array(np.where(mask)).T
+    n = ijk.shape[0]
+    data = np.random.rand(n, 3)
+    data[:, 1] = 2.
+    res = cartesian_smoothing(ijk, data, 1.5, nthreads=2)
+    assert res.shape == (n, 3)
+    assert np.abs(res[:, 1]-2.).max() < 1.e-12
+    res0 = cartesian_smoothing(ijk, data[:, 0], 1.5)
+    assert np.abs(res0[:, 0]-res[:, 0]).max() < 1.e-12
+
+
 if __name__ == "__main__":
     import nose
     nose.run(argv=['', __file__])
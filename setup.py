@@ -120,6 +120,13 @@ except ImportError:
     cmdclass = {}
 
 
+################################################################################
+# Compile the .pyx sources of the extensions with Cython
+
+from numpy.distutils.command import build_src
+from build_helpers import generate_a_pyrex_source
+build_src.build_src.generate_a_pyrex_source = generate_a_pyrex_source
+
 ################################################################################
 # commands for installing the data
 from numpy.distutils.command.install_data import install_data